@@ -0,0 +1,18565 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,0x64650000,0x2f757372,0x2f696e63,0x6c756465,
+0x0,0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,0x64650000,0x2f757372,0x2f6c6f63,
+0x616c2f69,0x6e636c75,0x64652f43,0x43000000,0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,
+0x64650000,0x2f757372,0x2f696e63,0x6c756465,0x0,0x2d446d69,0x7073202d,0x44756e69,
+0x78000000,0x64656669,0x6e650000,0x69660000,0x69666465,0x66000000,0x69666e64,0x65660000,
+0x656e6469,0x66000000,0x656c7365,0x0,0x656c6966,0x0,0x6c696e65,0x0,
+0x696e636c,0x75646500,0x756e6465,0x66000000,0x6572726f,0x72000000,0x73636373,0x0,
+0x6964656e,0x74000000,0x70726167,0x6d610000,0x0,0x6f757470,0x75742070,0x69706520,
+0x68617320,0x6265656e,0x20636c6f,0x73656400,0x2e6f0000,0x55736167,0x653a2025,0x73205b73,
+0x77697463,0x6865735d,0x20696e70,0x7574206f,0x75747075,0x740a0000,0x4f757470,0x75742066,
+0x696c656e,0x616d6520,0x73706563,0x69666965,0x64207477,0x6963650a,0x0,0x2d000000,
+0x0,0x2d747261,0x64697469,0x6f6e616c,0x0,0x2d747269,0x67726170,0x68730000,
+0x2d577472,0x69677261,0x70687300,0x2d57636f,0x6d6d656e,0x74730000,0x2d57636f,0x6d6d656e,
+0x74000000,0x2d57616c,0x6c000000,0x74617267,0x65740000,0x75706461,0x74650000,0x2573206f,
+0x7074696f,0x6e207265,0x71756972,0x65732061,0x6e206172,0x67756d65,0x6e740000,0x2d4d0000,
+0x2d4d4d00,0x474e5520,0x43505020,0x76657273,0x696f6e20,0x25730a00,0x2d000000,0x2d73686f,
+0x77646566,0x696e6573,0x0,0x2d6e6f73,0x706c6963,0x65000000,0x0,0x0,
+0x496e7661,0x6c696420,0x6f707469,0x6f6e2060,0x2573270a,0x0,0x0,0x53554e50,
+0x524f5f44,0x4550454e,0x44454e43,0x49455300,0x44455045,0x4e44454e,0x43494553,0x5f4f5554,
+0x50555400,0x44455045,0x4e44454e,0x43494553,0x5f4f5554,0x50555400,0x53554e50,0x524f5f44,
+0x4550454e,0x44454e43,0x49455300,0x61000000,0x3a000000,0x2d3a2000,0x3a200000,0x20000000,
+0x4e6f2069,0x6e707574,0x2066696c,0x656e616d,0x65207370,0x65636966,0x69656420,0x77697468,
+0x202d4d44,0x75706461,0x7465206f,0x7074696f,0x6e000000,0x63707000,0x0,0x7374646f,
+0x75740000,0x77000000,0x492f4f20,0x6572726f,0x72206f6e,0x206f7574,0x70757400,0x492f4f20,
+0x6572726f,0x72206f6e,0x206f7574,0x70757400,0x492f4f20,0x6572726f,0x72206f6e,0x206f7574,
+0x70757400,0x23257320,0x25732023,0x6c696e65,0x20256420,0x25730a00,0x25642074,0x72696772,
+0x61706828,0x73292065,0x6e636f75,0x6e746572,0x65640000,0x756e7465,0x726d696e,0x61746564,
+0x20737472,0x696e6720,0x6f722063,0x68617261,0x63746572,0x20636f6e,0x7374616e,0x74000000,
+0x756e7465,0x726d696e,0x61746564,0x20737472,0x696e6720,0x6f722063,0x68617261,0x63746572,
+0x20636f6e,0x7374616e,0x74000000,0x602f2a27,0x20776974,0x68696e20,0x636f6d6d,0x656e7400,
+0x756e7465,0x726d696e,0x61746564,0x20636f6d,0x6d656e74,0x0,0x69660000,0x69666465,
+0x66000000,0x69666e64,0x65660000,0x656c7365,0x0,0x656c6966,0x0,0x756e7465,
+0x726d696e,0x61746564,0x20232573,0x20636f6e,0x64697469,0x6f6e616c,0x0,0x6d616372,
+0x6f206f72,0x2023696e,0x636c7564,0x65207265,0x63757273,0x696f6e20,0x746f6f20,0x64656570,
+0x0,0x4e6f7420,0x61206c65,0x67616c20,0x70726570,0x726f6365,0x7373696e,0x67206469,
+0x72656374,0x6976653b,0x20696e61,0x7070726f,0x70726961,0x7465206e,0x6f6e2d77,0x68697465,
+0x73706163,0x65206368,0x61726163,0x74657273,0x20617265,0x20707265,0x73656e74,0x2028414e,
+0x53492033,0x2e382900,0x4a616e00,0x46656200,0x4d617200,0x41707200,0x4d617900,0x4a756e00,
+0x4a756c00,0x41756700,0x53657000,0x4f637400,0x4e6f7600,0x44656300,0x63636370,0x20657272,
+0x6f723a20,0x6e6f7420,0x696e2061,0x6e792066,0x696c653f,0x21000000,0x22257322,0x0,
+0x22220000,0x25640000,0x22257322,0x0,0x25640000,0x25640000,0x22257320,0x25326420,
+0x25346422,0x0,0x22253032,0x643a2530,0x32643a25,0x30326422,0x0,0x20302000,
+0x20312000,0x60646566,0x696e6564,0x27206d75,0x73742062,0x6520666f,0x6c6c6f77,0x65642062,
+0x79206964,0x656e7420,0x6f722028,0x6964656e,0x74290000,0x63636370,0x20657272,0x6f723a20,
+0x696e7661,0x6c696420,0x73706563,0x69616c20,0x68617368,0x20747970,0x65000000,0x23696e63,
+0x6c756465,0x20657870,0x65637473,0x2022666e,0x616d6522,0x206f7220,0x3c666e61,0x6d653e00,
+0x2f000000,0x6e6f6e65,0x78697374,0x656e7420,0x66696c65,0x203c252e,0x2a733e20,0x6f6d6974,
+0x74656420,0x66726f6d,0x20646570,0x656e6465,0x6e637920,0x6f757470,0x75740000,0xa000000,
+0x20000000,0xa000000,0x20000000,0x6d616372,0x6f206f72,0x2023696e,0x636c7564,0x65207265,
+0x63757273,0x696f6e20,0x746f6f20,0x64656570,0x0,0x23646566,0x696e6520,0x68617320,
+0x6e6f2069,0x64656e74,0x69666965,0x7220286e,0x6f206d61,0x63726f20,0x6e616d65,0x20697320,
+0x70726573,0x656e7429,0x0,0x6d616372,0x6f206e61,0x6d652069,0x6e202364,0x6566696e,
+0x65207374,0x61727473,0x20776974,0x6820616e,0x20696e61,0x7070726f,0x70726961,0x74652063,
+0x68617261,0x63746572,0x0,0x64656669,0x6e650000,0x70617261,0x6d657465,0x72206e61,
+0x6d652073,0x74617274,0x73207769,0x74682061,0x20646967,0x69742069,0x6e202364,0x6566696e,
+0x65000000,0x6261646c,0x79207075,0x6e637475,0x61746564,0x20706172,0x616d6574,0x6572206c,
+0x69737420,0x696e2023,0x64656669,0x6e650000,0x756e7465,0x726d696e,0x61746564,0x20706172,
+0x616d6574,0x6572206c,0x69737420,0x696e2023,0x64656669,0x6e650000,0x6475706c,0x69636174,
+0x65206d61,0x63726f20,0x70617261,0x6d657465,0x72202825,0x73292069,0x7320696c,0x6c656761,
+0x6c202841,0x4e534920,0x332e382e,0x33290000,0x0,0x20726564,0x6566696e,0x65640000,
+0x41202323,0x20707265,0x70726f63,0x65737369,0x6e672074,0x6f6b656e,0x206d7573,0x74206e6f,
+0x74206265,0x20617420,0x74686520,0x62656769,0x6e6e696e,0x67206f66,0x20612072,0x65706c61,
+0x63656d65,0x6e74206c,0x69737420,0x28414e53,0x4920332e,0x382e332e,0x33290000,0x23206f70,
+0x65726174,0x6f722073,0x686f756c,0x64206265,0x20666f6c,0x6c6f7765,0x64206279,0x2061206d,
+0x6163726f,0x20617267,0x756d656e,0x74206e61,0x6d650a00,0x23206f70,0x65726174,0x6f722073,
+0x686f756c,0x64206265,0x20666f6c,0x6c6f7765,0x64206279,0x2061206d,0x6163726f,0x20617267,
+0x756d656e,0x74206e61,0x6d650a00,0x41202323,0x20707265,0x70726f63,0x65737369,0x6e672074,
+0x6f6b656e,0x206d7573,0x74206e6f,0x74206265,0x20617420,0x74686520,0x656e6420,0x6f662061,
+0x20726570,0x6c616365,0x6d656e74,0x206c6973,0x74202841,0x4e534920,0x332e382e,0x332e3329,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x23756e64,0x65662068,0x6173206e,0x6f206964,0x656e7469,0x66696572,0x20286e6f,
+0x206d6163,0x726f206e,0x616d6520,0x69732070,0x72657365,0x6e742900,0x6d616372,0x6f206e61,
+0x6d652069,0x6e202375,0x6e646566,0x20737461,0x72747320,0x77697468,0x20616e20,0x696e6170,
+0x70726f70,0x72696174,0x65206368,0x61726163,0x74657200,0x756e6465,0x66696e69,0x6e672060,
+0x25732700,0x756e6465,0x66000000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x756e6465,
+0x66206964,0x656e7469,0x66696572,0x20207669,0x6f6c6174,0x65732041,0x4e534920,0x7374616e,
+0x64617264,0x0,0x23657272,0x6f722025,0x73000000,0x6f6e6365,0x0,0x414e5349,
+0x20432064,0x6f657320,0x6e6f7420,0x616c6c6f,0x77202369,0x64656e74,0x3b202369,0x64656e74,
+0x2069676e,0x6f726564,0x20000000,0x414e5349,0x20432064,0x6f657320,0x6e6f7420,0x616c6c6f,
+0x77202373,0x63637300,0x23656c69,0x66206e6f,0x74207769,0x7468696e,0x20612063,0x6f6e6469,
+0x74696f6e,0x616c0000,0x23656c69,0x66206166,0x74657220,0x23656c73,0x65000000,0x20286d61,
+0x74636865,0x73206c69,0x6e652025,0x64000000,0x2c206669,0x6c652025,0x73000000,0x290a0000,
+0x64656669,0x6e656400,0x23257320,0x77697468,0x206e6f20,0x61726775,0x6d656e74,0x0,
+0x23257320,0x61726775,0x6d656e74,0x20737461,0x72747320,0x77697468,0x2070756e,0x63747561,
+0x74696f6e,0x0,0x23257320,0x61726775,0x6d656e74,0x20737461,0x72747320,0x77697468,
+0x20612064,0x69676974,0x0,0x67617262,0x61676520,0x61742065,0x6e64206f,0x66202325,
+0x73206172,0x67756d65,0x6e740000,0x23257320,0x6e6f7420,0x77697468,0x696e2061,0x20636f6e,
+0x64697469,0x6f6e616c,0x0,0x23656c73,0x65206f72,0x2023656c,0x69662061,0x66746572,
+0x2023656c,0x73650000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x656c7365,0x2076696f,
+0x6c617465,0x7320414e,0x53492073,0x74616e64,0x61726400,0x23656c73,0x65206e6f,0x74207769,
+0x7468696e,0x20612063,0x6f6e6469,0x74696f6e,0x616c0000,0x23656c73,0x65206166,0x74657220,
+0x23656c73,0x65000000,0x20286d61,0x74636865,0x73206c69,0x6e652025,0x64000000,0x2c206669,
+0x6c652025,0x73000000,0x290a0000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x656e6469,
+0x66207669,0x6f6c6174,0x65732041,0x4e534920,0x7374616e,0x64617264,0x0,0x756e6261,
+0x6c616e63,0x65642023,0x656e6469,0x66000000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,
+0x656c7365,0x206f7220,0x23656e64,0x69662076,0x696f6c61,0x74657320,0x414e5349,0x20737461,
+0x6e646172,0x64000000,0x756e7465,0x726d696e,0x61746564,0x20737472,0x696e6720,0x6f722063,
+0x68617261,0x63746572,0x20636f6e,0x7374616e,0x74000000,0x23202564,0x20222573,0x22000000,
+0x6d616372,0x6f206f72,0x2023696e,0x636c7564,0x65207265,0x63757273,0x696f6e20,0x746f6f20,
+0x64656570,0x0,0x0,0x61726775,0x6d656e74,0x73206769,0x76656e20,0x746f206d,
+0x6163726f,0x20602573,0x27000000,0x6f6e6c79,0x20256420,0x61726773,0x20746f20,0x6d616372,
+0x6f206025,0x73270000,0x746f6f20,0x6d616e79,0x20282564,0x29206172,0x67732074,0x6f206d61,
+0x63726f20,0x60257327,0x0,0x5c253033,0x6f000000,0x756e7465,0x726d696e,0x61746564,
+0x206d6163,0x726f2063,0x616c6c00,0x25733a25,0x643a2000,0xa000000,0x25733a25,0x643a2000,
+0x25733a20,0x546f6f20,0x6d616e79,0x206f7065,0x6e206669,0x6c657320,0x28256c64,0x2066696c,
+0x65732069,0x7320746f,0x6f206d61,0x6e792e20,0x20446f65,0x7320736f,0x6d652023,0x696e636c,
+0x75646520,0x696e636c,0x75646520,0x69747365,0x6c662028,0x64697265,0x63746c79,0x206f7220,
+0x696e6469,0x72656374,0x6c79293f,0x290a0000,0x25733a20,0x25730a00,0x25733a20,0x756e646f,
+0x63756d65,0x6e746564,0x20492f4f,0x20657272,0x6f720a00,0x25733a25,0x643a2000,0x7761726e,
+0x696e673a,0x20000000,0xa000000,0x25733a25,0x643a2000,0xa000000,0x23646566,0x696e6520,
+0x25730000,0x28000000,0x2c200000,0x29000000,0x20000000,0x20230000,0x20232320,0x0,
+0x20232320,0x0,0xa000000,0x5f5f4c49,0x4e455f5f,0x0,0x5f5f4441,0x54455f5f,
+0x0,0x5f5f4649,0x4c455f5f,0x0,0x5f5f4241,0x53455f46,0x494c455f,0x5f000000,
+0x5f5f494e,0x434c5544,0x455f4c45,0x56454c5f,0x5f000000,0x5f5f5645,0x5253494f,0x4e5f5f00,
+0x5f5f5449,0x4d455f5f,0x0,0x5f5f414e,0x53495f43,0x50505f5f,0x0,0x20310000,
+0x2a496e69,0x7469616c,0x697a6174,0x696f6e2a,0x0,0x2a756e64,0x65662a00,0x25733a20,
+0x0,0xa000000,0x25733a20,0x0,0x25733a20,0x25730a00,0x25733a20,0x756e646f,
+0x63756d65,0x6e746564,0x20492f4f,0x20657272,0x6f720a00,0x4d656d6f,0x72792065,0x78686175,
+0x73746564,0x2e000000,0xf03f8f5c,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,
+0xf03f91d0,0xf03f8c80,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,
+0xf03f8c80,0xf03f8f44,0xf03f8eb8,0xf03f91ec,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f8f68,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f8d48,0xf03f91d0,0xf03f91d0,0xf03f8f50,0xf03f91d0,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f8f14,0xf03f91d0,0xf03f8c8c,0xf03f91d0,0xf03f91d0,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,
+0xf03f91d0,0xf03f91d0,0xf03f8e74,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f8b74,
+0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f91d0,0xf03f915c,0xf03f8ba4,0xf03f8c00,0xf03f91d0,
+0xf03f91d0,0xf03f9114,0xf03f8c1c,0xf03f9190,0xf03f8e8c,0xf03f9108,0xf03fa1b4,0xf03fa218,
+0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa1a4,0xf03fa18c,0xf03fa19c,0xf03fa218,
+0xf03fa218,0xf03fa218,0xf03fa1c4,0xf03fa218,0xf03fa194,0xf03fa218,0xf03fa218,0xf03fa218,
+0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,0xf03fa218,
+0xf03fa218,0xf03fa1ac,0xf03fa184,0xf03fa1bc,0xf03fa1cc,0xf03fb2f0,0xf03fb478,0xf03fb478,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb138,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fa9fc,
+0xf03fa6b0,0xf03fb044,0xf03fb478,0xf03fb478,0xf03fa9fc,0xf03fb478,0xf03fb478,0xf03fb478,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03facd4,0xf03fb064,0xf03fb064,0xf03fb064,
+0xf03fb064,0xf03fb064,0xf03fb064,0xf03fb064,0xf03fb064,0xf03fb064,0xf03fb064,0xf03fb478,
+0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb478,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb478,0xf03fa654,0xf03fb478,0xf03fb478,0xf03fb120,0xf03fb478,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,0xf03fb120,
+0xf03fb9b4,0xf03fb9c8,0xf03fb9a0,0xf03fb9dc,0xf03fba00,0xf03fb9f0,0xf03fc17c,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fbffc,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fbffc,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc0b0,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,
+0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,0xf03fc18c,
+0xf03fc068,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,
+0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,
+0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,
+0xf03fc4ec,0xf03fc3bc,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc3bc,0xf03fc4ec,
+0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc464,0xf03fc4ec,
+0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,
+0xf03fc4ec,0xf03fc4ec,0xf03fc4ec,0xf03fc240,0xf03fc9a8,0xf03fc9e8,0xf03fc7fc,0xf03fc7fc,
+0xf03fc894,0xf03fc90c,0xf03fc9e8,0xf03fc968,0xf03fcca0,0xf03fcca0,0xf03fcaec,0xf0400334,
+0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,
+0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,
+0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf04002bc,
+0xf0400354,0xf04007f0,0xf04007f0,0xf04007f0,0xf04002bc,0xf04007f0,0xf04007f0,0xf04007f0,
+0xf04007f0,0xf04007f0,0xf04007f0,0xf04007f0,0xf0400230,0xf0400664,0xf0400664,0xf0400664,
+0xf04006c4,0xf04007f0,0xf040070c,0xf04007f0,0xf04007f0,0xf04007f0,0xf04006c4,0xf04028e4,
+0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,
+0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,
+0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402a64,
+0xf0402b60,0xf0402b60,0xf0402b60,0xf0402b60,0xf0402a64,0xf0402890,0xf04028ac,0xf0402b60,
+0xf0402b60,0xf0402b40,0xf0402b60,0xf0402b60,0xf04028f8,0x0,0x0,0x0,
+0x312e3335,0x2e393578,0x0,0x0,0x666c6f61,0x74696e67,0x20706f69,0x6e74206e,
+0x756d6265,0x7273206e,0x6f742061,0x6c6c6f77,0x65642069,0x6e202369,0x66206578,0x70726573,
+0x73696f6e,0x73000000,0x30780000,0x30580000,0x496e7661,0x6c696420,0x6e756d62,0x65722069,
+0x6e202369,0x66206578,0x70726573,0x73696f6e,0x0,0x26260000,0x7c7c0000,0x3c3c0000,
+0x3e3e0000,0x3d3d0000,0x213d0000,0x3c3d0000,0x3e3d0000,0x5f5f4348,0x41525f55,0x4e534947,
+0x4e45445f,0x5f000000,0x496e7661,0x6c696420,0x63686172,0x61637465,0x7220636f,0x6e737461,
+0x6e742069,0x6e202369,0x66000000,0x646f7562,0x6c652071,0x756f7465,0x64207374,0x72696e67,
+0x73206e6f,0x7420616c,0x6c6f7765,0x6420696e,0x20236966,0x20657870,0x72657373,0x696f6e73,
+0x0,0x496e7661,0x6c696420,0x746f6b65,0x6e20696e,0x20657870,0x72657373,0x696f6e00,
+0x6f637461,0x6c206368,0x61726163,0x74657220,0x636f6e73,0x74616e74,0x20646f65,0x73206e6f,
+0x74206669,0x7420696e,0x20612062,0x79746500,0x68657820,0x63686172,0x61637465,0x7220636f,
+0x6e737461,0x6e742064,0x6f657320,0x6e6f7420,0x66697420,0x696e2061,0x20627974,0x65000000,
+0x656d7074,0x79202369,0x66206578,0x70726573,0x73696f6e,0x0,0x4a756e6b,0x20616674,
+0x65722065,0x6e64206f,0x66206578,0x70726573,0x73696f6e,0x2e000000,0x75786c69,0x62633a38,
+0x30000000,0x59616363,0x20737461,0x636b206f,0x76657266,0x6c6f7700,0x75786c69,0x62633a38,
+0x31000000,0x53796e74,0x61782065,0x72726f72,0x0,0x64697669,0x73696f6e,0x20627920,
+0x7a65726f,0x20696e20,0x23696600,0x64697669,0x73696f6e,0x20627920,0x7a65726f,0x20696e20,
+0x23696600,0xf0404cb4,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404cbc,0xf0404cbc,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404cbc,0xf0404df4,0xf0404e04,0xf0404e24,0xf0404e24,0xf0404df4,0xf0404df4,
+0xf0404d28,0xf0404df4,0xf0404df4,0xf0404df4,0xf0404df4,0xf0404df4,0xf0404df4,0xf0404df4,
+0xf0404df4,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404df4,0xf0404e24,0xf0404df4,0xf0404df4,0xf0404df4,
+0xf0404df4,0xf0404df4,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404cd0,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,
+0xf0404e24,0xf0404e24,0xf0404e24,0xf0404e24,0xf0404df4,0xf0404e24,0xf0404df4,0xf0404df4,
+0xf0405044,0xf04051e0,0xf04051e0,0xf0404fe8,0xf0404ff0,0xf04051e0,0xf04051e0,0xf0404ff8,
+0xf0405000,0xf04051e0,0xf04051e0,0xf04051e0,0xf04051e0,0xf04051e0,0xf04051e0,0xf04051e0,
+0xf0405008,0xf04051e0,0xf04051e0,0xf04051e0,0xf0405010,0xf04051e0,0xf0405018,0xf04051e0,
+0xf0405020,0xf04051e0,0xf0405128,0xf0405094,0xf0405094,0xf0405094,0xf0405094,0xf0405094,
+0xf0405094,0xf0405094,0xf0405094,0xf0405b44,0xf0406314,0xf0405b54,0xf0405b70,0xf0405b90,
+0xf0405bac,0xf0405bcc,0xf0405be8,0xf0405c68,0xf0405d4c,0xf0405e30,0xf0405e74,0xf0405eb8,
+0xf0405f08,0xf0405f58,0xf0405f7c,0xf0405fa0,0xf0406004,0xf0406068,0xf04060c4,0xf0406120,
+0xf0406164,0xf04061a8,0xf04061ec,0xf0406228,0xf0406264,0xf04062c4,0xf04062e0,0xf04062fc,
+0x53747269,0x6e672074,0x61626c65,0x206f7665,0x72666c6f,0x7720696e,0x204d4475,0x70646174,
+0x650a0000,0x63616e27,0x74207265,0x616c6c6f,0x63617465,0x206d656d,0x6f727920,0x666f7220,
+0x25732075,0x70646174,0x65000000,0x63616e27,0x7420616c,0x6c6f6361,0x7465206d,0x656d6f72,
+0x7920666f,0x72202573,0x20757064,0x61746500,0x25733a20,0x25730000,0x25733a20,0x25730000,
+0x25733a20,0x25730000,0x233a252e,0x34730000,0x25733a20,0x25730000,0x25733a20,0x6572726f,
+0x72206475,0x72696e67,0x20757064,0x61746520,0x2d2d2066,0x696c6520,0x25732069,0x7320636f,
+0x72727570,0x74656420,0x2d2d2075,0x6e657870,0x65637465,0x64206e75,0x6c6c2061,0x74206f66,
+0x66736574,0x2025642e,0xa000000,0x25733a20,0x25730000,0x61000000,0x63616e27,0x74206f70,
+0x656e2025,0x7320746f,0x20617070,0x656e6420,0x25732773,0x20646570,0x656e6465,0x6e636965,
+0x73000000,0x25733a00,0x25733a20,0x25730000,0x20257300,0x2025730a,0x0,0x25733a20,
+0x25730000,0x25733a20,0x25730000,0x25733a20,0x25730000,0x0,0x0,0x0,
+0x40282329,0x24486561,0x6465723a,0x20495249,0x5820352e,0x333a3130,0x32313537,0x32303333,
+0x20627569,0x6c742031,0x312f3033,0x2f393420,0x61742070,0x69676865,0x6172743a,0x2f6a6f69,
+0x73742f35,0x2e334d52,0x2f726f6f,0x74202400,};
+static const uint32_t data[] = {
+0x40282329,0x616c6c6f,0x63612e63,0x9312e31,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xffffffff,0x0,0x10000040,0x10000b80,
+0x10000048,0x10000b94,0x0,0x10000ba4,0x10000058,0x10000bb8,0x10000060,0x10000bd0,
+0x0,0x10000be4,0x0,0x0,0x0,0x0,0x0,0x10000bf4,
+0x6,0x408244,0x10000c04,0x1,0x10000,0x2,0x40a284,0x10000c0c,
+0x5,0x0,0x5,0x40a604,0x10000c10,0x3,0x0,0x6,
+0x40a604,0x10000c18,0x4,0x0,0x5,0x40b2f4,0x10000c20,0xc,
+0x0,0x4,0x40b060,0x10000c28,0x6,0x0,0x4,0x40a2fc,
+0x10000c30,0x8,0x0,0x4,0x409848,0x10000c38,0xa,0x0,
+0x7,0x40758c,0x10000c40,0x2,0x1000000,0x5,0x409cf8,0x10000c48,
+0x9,0x0,0x5,0x409f8c,0x10000c50,0xb,0x0,0x4,
+0x40a234,0x10000c58,0xd,0x0,0x5,0x40a1c8,0x10000c60,0xe,
+0x0,0x6,0x40a134,0x10000c68,0x7,0x100,0xffffffff,0x0,
+0x10000c70,0x1a,0x0,0x0,0x0,0x0,0x10001028,0x1000102c,
+0x10001030,0x10001034,0x10001038,0x1000103c,0x10001040,0x10001044,0x10001048,0x1000104c,
+0x10001050,0x10001054,0x0,0x0,0x100021e0,0x0,0x0,0x0,
+0x100063c0,0x10006620,0x96,0x10002254,0x106,0x10002258,0x105,0x1000225c,
+0x10b,0x10002260,0x10c,0x10002264,0x107,0x10002268,0x108,0x1000226c,
+0x109,0x10002270,0x10a,0x0,0x104,0xffffffff,0x1,0x0,
+0xffffffff,0xfffffffe,0x0,0xe,0x19,0xb,0x2,0xe,
+0xc,0xf,0x1,0x10,0xc,0xd,0x22,0xe,
+0x19,0xd,0x0,0x0,0xc,0xf,0x0,0x10,
+0x38,0xd,0x17,0xe,0x18,0x1e,0x0,0x0,
+0xc,0xf,0x0,0x10,0x37,0xd,0x17,0xb,
+0x18,0x1e,0xe,0x19,0x0,0x0,0x0,0xc,
+0xf,0x0,0x10,0x0,0xd,0xe,0x19,0x0,
+0x0,0x0,0xc,0xf,0x1a,0x10,0x0,0xd,
+0x0,0x17,0x0,0x18,0x0,0xe,0x19,0x0,
+0x1a,0x0,0xc,0xf,0x17,0x10,0x18,0xd,
+0x0,0xe,0x19,0x0,0x0,0x0,0xc,0xf,
+0x0,0x10,0x1b,0xd,0x17,0x0,0x18,0xe,
+0x0,0x0,0x0,0x1a,0xc,0xf,0x1b,0x10,
+0x17,0xd,0x18,0xe,0x0,0x0,0x1a,0x0,
+0xc,0xf,0x0,0x10,0x5,0xd,0x17,0x0,
+0x18,0x0,0x0,0x7,0x0,0x0,0x1a,0x0,
+0x4,0x1b,0x17,0x3,0x18,0x0,0x0,0x0,
+0x1f,0x20,0x21,0x0,0x1b,0x0,0x0,0x23,
+0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,
+0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,
+0x34,0x35,0x36,0xe,0x0,0x0,0x0,0x0,
+0xc,0xf,0x0,0x10,0x0,0xd,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x39,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1d,0x1c,0x13,0x14,0x15,
+0x16,0x11,0x12,0x0,0x0,0x0,0x0,0x1d,
+0x1c,0x13,0x14,0x15,0x16,0x11,0x12,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x11,0x12,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1c,0x13,0x14,0x15,0x16,
+0x11,0x12,0x0,0x0,0x0,0x0,0x0,0x13,
+0x14,0x15,0x16,0x11,0x12,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,
+0x14,0x15,0x16,0x11,0x12,0x0,0x0,0x0,
+0x0,0x0,0x0,0x13,0x14,0x15,0x16,0x11,
+0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x13,0x14,0x15,0x16,0x11,0x12,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,
+0x16,0x11,0x12,0x0,0x8,0x9,0xa,0x50,
+0xff676980,0xffffffd6,0xffffffe7,0x50,0x50,0x50,0x50,0xff676980,
+0xff676980,0xff676980,0x50,0x50,0x50,0x50,0x50,0x50,
+0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+0x50,0x50,0x50,0x50,0x50,0x50,0xff676980,0xff676980,
+0xff676980,0xfffffff8,0xffffffe7,0xff676980,0xff676980,0xff676980,0xffffffdf,0xffffffdf,
+0x7b,0x7b,0x43,0x43,0xfffffff3,0xfffffff3,0xfffffff3,0xfffffff3,
+0x37,0x29,0x1d,0xd,0x2,0xffffffdb,0xff676980,0x50,
+0xffffffe7,0x0,0x80,0x3,0x7,0x0,0x3,0x2,
+0x2,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x0,0x3,0x2,0x7,0x5,
+0x5,0x5,0x7,0x7,0x7,0x7,0x7,0x7,
+0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,
+0x7,0x7,0x7,0x7,0x7,0xb,0x3,0x3,
+0x3,0xff676980,0xfffffffd,0xfffffffe,0xffffffff,0x2d,0x21,0x7e,
+0x28,0x101,0x102,0x103,0x2c,0x2a,0x2f,0x25,
+0x2b,0x2d,0x10b,0x10c,0x107,0x108,0x109,0x10a,
+0x3c,0x3e,0x26,0x5e,0x7c,0x106,0x105,0x3f,
+0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0x29,0x3a,0xffffffff,0x0,0xfffffffe,0x1,0x2,0x0,
+0x0,0x0,0x0,0x1b,0x1c,0x1d,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x4,0x5,0x6,0x0,0x3,0x8,
+0x9,0xa,0xb,0xc,0xd,0xe,0xf,0x10,
+0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,
+0x19,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,
+};
+static void func_402e20(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloca(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_402fe4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_make_deps_target(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_404734(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_trigraph_pcp(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_name_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_rescan(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_expand_to_temp_buffer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_handle_directive(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_special_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_do_include(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_finclude(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_do_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_compare_defs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_comp_def_part(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_collect_expansion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_undef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_do_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_once(uint8_t *mem, uint32_t sp, uint32_t v0);
+static uint64_t f_do_pragma(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_do_ident(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_sccs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_if(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_elif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_eval_if_expression(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_do_xifdef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_conditional_skip(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_skip_if_group(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1);
+static uint64_t f_do_else(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_endif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_validate_else(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_skip_to_end_of_comment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_skip_quoted_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_output_line_command(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_macroexpand(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_macarg(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_macarg1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_discard_comments(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_error_from_errno(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_error_with_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_line_for_error(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_grow_outbuf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_install(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_lookup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_delete_macro(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_hashf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_dump_all_macros(uint8_t *mem, uint32_t sp);
+static void f_dump_defn_1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_dump_arg_n(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_initialize_char_syntax(uint8_t *mem, uint32_t sp);
+static void f_initialize_builtins(uint8_t *mem, uint32_t sp);
+static void f_make_definition(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_undef(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_deps_output(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_bzero(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_bcopy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_bcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_perror_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_pfatal_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_memory_full(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_xcalloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_savestring(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_file_size_and_mode(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_parse_number(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_yylex(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_parse_escape(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_yyerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_parse_c_expression(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_yyparse(uint8_t *mem, uint32_t sp);
+static void f_MDnewstab(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_MDstrcpy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_410cb4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_410d90(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_410e70(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_MDopen(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_MDupdate(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_MDclose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+uint64_t trampoline(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t fp_dest) {
+switch (fp_dest) {
+case 0x402fe4: func_402fe4(mem, sp, a0, a1, a2, a3); return 0;
+case 0x40758c: return f_do_include(mem, sp, a0, a1, a2, a3);
+case 0x408244: return f_do_define(mem, sp, a0, a1, a2, a3);
+case 0x409848: return f_do_line(mem, sp, a0, a1, a2, a3);
+case 0x409cf8: return f_do_undef(mem, sp, a0, a1, a2, a3);
+case 0x409f8c: f_do_error(mem, sp, a0, a1, a2, a3); return 0;
+case 0x40a134: return f_do_pragma(mem, sp, a0, a1);
+case 0x40a1c8: return (uint64_t)f_do_ident(mem, sp, a0, a1, a2, a3) << 32;
+case 0x40a234: return f_do_sccs(mem, sp, a0, a1, a2, a3);
+case 0x40a284: return f_do_if(mem, sp, a0, a1, a2, a3);
+case 0x40a2fc: return f_do_elif(mem, sp, a0, a1, a2, a3);
+case 0x40a604: return f_do_xifdef(mem, sp, a0, a1, a2, a3);
+case 0x40b060: return f_do_else(mem, sp, a0, a1, a2, a3);
+case 0x40b2f4: return f_do_endif(mem, sp, a0, a1, a2, a3);
+case 0x40ecbc: f_fatal(mem, sp, a0, a1, a2, a3); return 0;
+default: abort();}
+}
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10010000);
+memcpy(mem + 0x10000b80, rodata, 0x1cb0);
+memcpy(mem + 0x10000000, data, 0xb80);
+MEM_S32(0x10002d00) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x10002d04) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0, argc, arg_addr);
+return ret;
+}
+
+static void func_402e20(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L402e20:
+//nop;
+//nop;
+//nop;
+v0 = 0x10000014;
+sp = sp + 0xffffffd8;
+v0 = MEM_U32(v0 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if (v0 != 0) goto L402e68;
+//nop;
+at = 0x10000014;
+v0 = sp + 0x27;
+// fdead 400001ef t9 = t9;
+MEM_U32(at + 0) = v0;
+func_402e20(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L402e94;
+L402e68:
+t6 = sp + 0x27;
+t7 = 0x1;
+if (v0 >= t6) goto L402e84;
+at = 0x10002bd0;
+MEM_U32(at + 0) = t7;
+goto L402e90;
+L402e84:
+at = 0x10002bd0;
+t8 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+L402e90:
+// bdead 1 ra = MEM_U32(sp + 28);
+L402e94:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f_alloca(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, t8 = 0, t9 = 0;
+L402ea0:
+//alloca:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+s3 = 0x10002bd0;
+// fdead 401001eb MEM_U32(sp + 44) = ra;
+s3 = s3;
+t6 = MEM_U32(s3 + 0);
+// fdead 401081eb MEM_U32(sp + 40) = gp;
+// fdead 401081eb MEM_U32(sp + 32) = s2;
+// fdead 401081eb MEM_U32(sp + 28) = s1;
+// fdead 401081eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 72) = a0;
+if (t6 != 0) goto L402ef8;
+//nop;
+//nop;
+// fdead 401081eb t9 = t9;
+//nop;
+func_402e20(mem, sp);
+// bdead 40100003 gp = MEM_U32(sp + 40);
+//nop;
+L402ef8:
+s0 = 0x10000018;
+s2 = sp + 0x47;
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L402f6c;
+L402f10:
+v0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if ((int)v0 <= 0) goto L402f34;
+t7 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s2 < t7) goto L402f50;
+L402f34:
+//nop;
+if ((int)v0 >= 0) goto L402f6c;
+t8 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (t8 >= s2) goto L402f6c;
+L402f50:
+//nop;
+s1 = MEM_U32(s0 + 0);
+a0 = s0;
+wrapper_free(mem, a0);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+s0 = s1;
+if (s1 != 0) goto L402f10;
+L402f6c:
+at = 0x10000018;
+t9 = MEM_U32(sp + 72);
+s2 = sp + 0x47;
+MEM_U32(at + 0) = s0;
+if (t9 != 0) goto L402f88;
+v0 = zero;
+goto L402fc0;
+L402f88:
+a0 = MEM_U32(sp + 72);
+//nop;
+a0 = a0 + 0x8;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 80009 gp = MEM_U32(sp + 40);
+//nop;
+t0 = 0x10000018;
+at = 0x10000018;
+t0 = MEM_U32(t0 + 0);
+MEM_U32(v0 + 4) = s2;
+MEM_U32(v0 + 0) = t0;
+MEM_U32(at + 0) = v0;
+v0 = v0 + 0x8;
+L402fc0:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x48;
+return v0;
+//nop;
+//nop;
+}
+
+static void func_402fe4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+//nop;
+//nop;
+//nop;
+a0 = 0x10000c74;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_make_deps_target(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+s0 = 0, t8 = 0, t9 = 0;
+L40301c:
+//make_deps_target:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+t6 = MEM_U8(a0 + 0);
+a1 = a0;
+v0 = a0;
+if (t6 == 0) goto L40307c;
+v1 = MEM_U8(a0 + 0);
+a0 = 0x2f;
+L403050:
+//nop;
+if (a0 != v1) goto L40306c;
+t7 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (t7 == 0) goto L40306c;
+a1 = v0 + 0x1;
+L40306c:
+v1 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L403050;
+L40307c:
+//nop;
+v1 = v0 - a1;
+a0 = v1 + 0x10;
+MEM_U32(sp + 32) = v1;
+MEM_U32(sp + 56) = a1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 56);
+//nop;
+s0 = v0;
+a0 = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = s0;
+//nop;
+a1 = 0x2e;
+//nop;
+v0 = wrapper_strrchr(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a0 = s0;
+//nop;
+a1 = 0x2f;
+MEM_U32(sp + 44) = v0;
+v0 = wrapper_strrchr(mem, a0, a1);
+v1 = MEM_U32(sp + 44);
+// bdead 4002001b gp = MEM_U32(sp + 24);
+//nop;
+if (v1 == 0) goto L403124;
+at = v0 < v1;
+if (v0 == 0) goto L4030fc;
+//nop;
+if (v0 >= v1) goto L403124;
+L4030fc:
+t8 = MEM_U32(sp + 32);
+t1 = 0x6f;
+t9 = s0 + t8;
+t0 = t9 + 0xfffffffe;
+//nop;
+if (t0 < v1) goto L403124;
+MEM_U8(v1 + 1) = (uint8_t)t1;
+MEM_U8(v1 + 2) = (uint8_t)zero;
+goto L403140;
+L403124:
+a1 = 0x10000c90;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 24);
+//nop;
+L403140:
+// bdead 20001 ra = MEM_U32(sp + 28);
+v0 = s0;
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L403154:
+//main:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff30;
+//nop;
+// fdead 40000063 MEM_U32(sp + 40) = s4;
+// fdead 40000063 MEM_U32(sp + 24) = s0;
+s4 = a0;
+// fdead 40200063 MEM_U32(sp + 52) = ra;
+s0 = a0 << 2;
+// fdead 40220063 MEM_U32(sp + 48) = gp;
+// fdead 40220063 MEM_U32(sp + 44) = s5;
+// fdead 40220063 MEM_U32(sp + 36) = s3;
+// fdead 40220063 MEM_U32(sp + 32) = s2;
+// fdead 40220063 MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 212) = a1;
+a0 = s0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 176) = v0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 172) = v0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 212);
+MEM_U32(sp + 168) = v0;
+MEM_U32(sp + 164) = zero;
+MEM_U32(sp + 160) = zero;
+MEM_U32(sp + 156) = zero;
+MEM_U32(sp + 152) = zero;
+MEM_U32(sp + 148) = zero;
+MEM_U32(sp + 144) = zero;
+at = 0x10002d0c;
+t7 = MEM_U32(t6 + 0);
+//nop;
+MEM_U32(at + 0) = t7;
+at = 0x100001b0;
+s2 = 0x1;
+MEM_U32(sp + 196) = zero;
+s5 = zero;
+MEM_U32(at + 0) = s2;
+f_initialize_char_syntax(mem, sp);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = 0xd;
+at = 0x100001b0;
+a1 = 0x402fe4; // function pointer
+MEM_U32(at + 0) = zero;
+at = 0x10002d20;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x10000028;
+a1 = a1;
+MEM_U32(at + 0) = s2;
+at = 0x10002d24;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x10002d40;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x10002d10;
+MEM_U32(at + 0) = zero;
+v0 = wrapper_signal(mem, a0, trampoline, a1, sp);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+t8 = 0x16;
+at = 0x10002d14;
+//nop;
+a0 = MEM_U32(sp + 176);
+a1 = s0;
+MEM_U32(at + 0) = t8;
+wrapper_bzero(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 172);
+//nop;
+a1 = s0;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 168);
+//nop;
+a1 = s0;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+s0 = s2;
+if ((int)s4 < (int)0x2) goto L403a24;
+v0 = MEM_U32(sp + 212);
+t9 = s4 << 2;
+t1 = t9 + v0;
+MEM_U32(sp + 60) = t1;
+s1 = 0x4;
+s3 = 0x20;
+s0 = v0 + 0x4;
+L4032e4:
+a2 = MEM_U32(s0 + 0);
+at = 0x2d;
+t2 = MEM_U8(a2 + 0);
+//nop;
+//nop;
+if (t2 == at) goto L403348;
+t4 = MEM_U32(sp + 196);
+if (s5 == 0) goto L40332c;
+t3 = MEM_U32(sp + 212);
+a0 = 0x10000c94;
+//nop;
+a1 = MEM_U32(t3 + 0);
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 60);
+goto L403a10;
+// fdead 0 t4 = MEM_U32(sp + 196);
+L40332c:
+//nop;
+//nop;
+if (t4 == 0) goto L403340;
+s5 = a2;
+goto L403a0c;
+L403340:
+MEM_U32(sp + 196) = a2;
+goto L403a0c;
+L403348:
+t0 = MEM_U8(a2 + 1);
+//nop;
+t5 = t0 + 0xffffffdc;
+if (t0 == 0) goto L403384;
+//nop;
+if (t5 >= 0x54) goto L4039f0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L40377c;
+case 1: goto L4039f0;
+case 2: goto L4039f0;
+case 3: goto L4039f0;
+case 4: goto L4039f0;
+case 5: goto L4039f0;
+case 6: goto L4039f0;
+case 7: goto L4034a0;
+case 8: goto L4039f0;
+case 9: goto L4039f0;
+case 10: goto L4039f0;
+case 11: goto L4039f0;
+case 12: goto L4039f0;
+case 13: goto L4039f0;
+case 14: goto L4039f0;
+case 15: goto L4039f0;
+case 16: goto L4039f0;
+case 17: goto L4039f0;
+case 18: goto L4039f0;
+case 19: goto L4039f0;
+case 20: goto L4039f0;
+case 21: goto L4039f0;
+case 22: goto L4039f0;
+case 23: goto L4039f0;
+case 24: goto L4039f0;
+case 25: goto L4039f0;
+case 26: goto L4039f0;
+case 27: goto L4039f0;
+case 28: goto L4039f0;
+case 29: goto L4039f0;
+case 30: goto L4034a0;
+case 31: goto L403764;
+case 32: goto L4036d8;
+case 33: goto L403a0c;
+case 34: goto L4039f0;
+case 35: goto L4039f0;
+case 36: goto L4039f0;
+case 37: goto L403788;
+case 38: goto L4039f0;
+case 39: goto L4039f0;
+case 40: goto L4039f0;
+case 41: goto L403568;
+case 42: goto L4039f0;
+case 43: goto L4039f0;
+case 44: goto L403770;
+case 45: goto L4039f0;
+case 46: goto L4039f0;
+case 47: goto L4039f0;
+case 48: goto L4039f0;
+case 49: goto L403734;
+case 50: goto L4039f0;
+case 51: goto L4034ac;
+case 52: goto L4039f0;
+case 53: goto L4039f0;
+case 54: goto L4039f0;
+case 55: goto L4039f0;
+case 56: goto L4039f0;
+case 57: goto L4039f0;
+case 58: goto L4039f0;
+case 59: goto L4039f0;
+case 60: goto L4039f0;
+case 61: goto L4039f0;
+case 62: goto L4039f0;
+case 63: goto L4039f0;
+case 64: goto L403694;
+case 65: goto L4039f0;
+case 66: goto L4039f0;
+case 67: goto L4039f0;
+case 68: goto L4039f0;
+case 69: goto L403394;
+case 70: goto L4039f0;
+case 71: goto L4039f0;
+case 72: goto L4039f0;
+case 73: goto L4039f0;
+case 74: goto L40397c;
+case 75: goto L4033c4;
+case 76: goto L403420;
+case 77: goto L4039f0;
+case 78: goto L4039f0;
+case 79: goto L403934;
+case 80: goto L40343c;
+case 81: goto L4039b0;
+case 82: goto L4036ac;
+case 83: goto L403928;
+}
+L403384:
+t8 = MEM_U32(sp + 196);
+if (t0 == 0) goto L4039bc;
+//nop;
+goto L4039f0;
+L403394:
+t6 = MEM_U32(sp + 176);
+t7 = MEM_U8(a2 + 2);
+t8 = a2 + 0x2;
+v1 = t6 + s1;
+if (t7 == 0) goto L4033b0;
+MEM_U32(v1 + 0) = t8;
+goto L403a0c;
+L4033b0:
+t9 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v1 + 0) = t9;
+goto L403a0c;
+L4033c4:
+//nop;
+if (s5 == 0) goto L4033e8;
+a0 = 0x10000cb8;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 403e0003 gp = MEM_U32(sp + 48);
+//nop;
+L4033e8:
+s5 = MEM_U32(s0 + 4);
+a1 = 0x10000cdc;
+//nop;
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+a0 = s5;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 60);
+if (v0 != 0) goto L403a10;
+s5 = 0x10000ce0;
+s5 = s5;
+goto L403a0c;
+L403420:
+v0 = 0x10002d28;
+//nop;
+t1 = MEM_U32(v0 + 0);
+//nop;
+t2 = t1 + 0x1;
+MEM_U32(v0 + 0) = t2;
+goto L403a0c;
+L40343c:
+a1 = 0x10000ce4;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L403474;
+at = 0x10002d3c;
+//nop;
+MEM_U32(at + 0) = s2;
+at = 0x100001b0;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403474:
+a1 = 0x10000cf4;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 60);
+if (v0 != 0) goto L403a10;
+at = 0x10000028;
+MEM_U32(at + 0) = zero;
+goto L403a0c;
+L4034a0:
+at = 0x10002d10;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L4034ac:
+a1 = 0x10000d00;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L4034d8;
+at = 0x10002d38;
+//nop;
+MEM_U32(at + 0) = s2;
+L4034d8:
+a1 = 0x10000d0c;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L403504;
+at = 0x10002d34;
+//nop;
+MEM_U32(at + 0) = s2;
+L403504:
+a1 = 0x10000d18;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L403530;
+at = 0x10002d34;
+//nop;
+MEM_U32(at + 0) = s2;
+L403530:
+a1 = 0x10000d24;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 60);
+if (v0 != 0) goto L403a10;
+at = 0x10002d38;
+//nop;
+MEM_U32(at + 0) = s2;
+at = 0x10002d34;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403568:
+t3 = MEM_U8(a2 + 2);
+at = 0x44;
+//nop;
+if (t3 != at) goto L403624;
+a1 = 0x10000d2c;
+//nop;
+a0 = a2 + 0x3;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+v1 = sp + 0x94;
+if (v0 != 0) goto L4035a8;
+t5 = MEM_U32(sp + 212);
+t4 = s4 << 2;
+v0 = t4 + t5;
+goto L4035e8;
+L4035a8:
+a0 = MEM_U32(s0 + 0);
+a1 = 0x10000d34;
+//nop;
+a0 = a0 + 0x3;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+v1 = sp + 0x90;
+if (v0 != 0) goto L4035dc;
+t7 = MEM_U32(sp + 212);
+t6 = s4 << 2;
+v0 = t6 + t7;
+goto L4035e8;
+L4035dc:
+a2 = MEM_U32(s0 + 0);
+//nop;
+goto L4039f0;
+L4035e8:
+s0 = s0 + 0x4;
+s1 = s1 + 0x4;
+if (s0 != v0) goto L403618;
+a0 = 0x10000d3c;
+//nop;
+a1 = MEM_U32(s0 + -4);
+MEM_U32(sp + 140) = v1;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 140);
+//nop;
+L403618:
+t8 = MEM_U32(s0 + 0);
+MEM_U32(v1 + 0) = t8;
+goto L403a0c;
+L403624:
+a1 = 0x10000d5c;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t9 = 0x2;
+if (v0 != 0) goto L403658;
+at = 0x1000002c;
+t1 = 0x1;
+MEM_U32(sp + 156) = t1;
+MEM_U32(at + 0) = t9;
+goto L403a0c;
+L403658:
+a1 = 0x10000d60;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t2 = 0x1;
+if (v0 != 0) goto L403688;
+at = 0x1000002c;
+MEM_U32(sp + 156) = t2;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403688:
+a2 = MEM_U32(s0 + 0);
+//nop;
+goto L4039f0;
+L403694:
+at = 0x10002d24;
+//nop;
+MEM_U32(at + 0) = s2;
+at = 0x10002d40;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L4036ac:
+a2 = 0x100001f0;
+a0 = 0xfb528e4;
+a1 = 0x10000d64;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 60);
+goto L403a10;
+L4036d8:
+t3 = MEM_U32(sp + 172);
+t4 = MEM_U8(a2 + 2);
+a1 = 0x3d;
+v1 = t3 + s1;
+if (t4 == 0) goto L4036f4;
+a0 = a2 + 0x2;
+goto L403704;
+L4036f4:
+a0 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+v1 = v1 + 0x4;
+L403704:
+//nop;
+MEM_U32(sp + 64) = v1;
+MEM_U32(sp + 136) = a0;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+a0 = MEM_U32(sp + 136);
+//nop;
+if (v0 == 0) goto L40372c;
+MEM_U8(v0 + 0) = (uint8_t)s3;
+L40372c:
+MEM_U32(v1 + 0) = a0;
+goto L403a0c;
+L403734:
+t5 = MEM_U32(sp + 168);
+t6 = MEM_U8(a2 + 2);
+t7 = a2 + 0x2;
+v1 = t5 + s1;
+if (t6 == 0) goto L403750;
+MEM_U32(v1 + 0) = t7;
+goto L403a0c;
+L403750:
+t8 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v1 + 0) = t8;
+goto L403a0c;
+L403764:
+at = 0x10000020;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403770:
+at = 0x10002d20;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L40377c:
+at = 0x100001b0;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403788:
+t9 = MEM_U8(a2 + 2);
+//nop;
+//nop;
+if (t9 != 0) goto L4037b8;
+t1 = MEM_U32(s0 + 4);
+at = 0x2d;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != at) goto L4037b8;
+MEM_U32(sp + 160) = s2;
+goto L403a0c;
+L4037b8:
+t3 = 0x100063a0;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L4037fc;
+a1 = 0x10000d78;
+//nop;
+a0 = a2 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L4037fc;
+at = 0x100063a0;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L4037fc:
+//nop;
+a0 = 0x8;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 128) = v0;
+t4 = 0x10000068;
+MEM_U32(v0 + 0) = zero;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L403838;
+at = 0x10000068;
+MEM_U32(at + 0) = v0;
+goto L40384c;
+L403838:
+t5 = 0x10000070;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+MEM_U32(t5 + 0) = v0;
+L40384c:
+at = 0x10000070;
+//nop;
+MEM_U32(at + 0) = v0;
+a2 = MEM_U32(s0 + 0);
+//nop;
+t6 = MEM_U8(a2 + 2);
+t7 = a2 + 0x2;
+//nop;
+if (t6 == 0) goto L403878;
+MEM_U32(v0 + 4) = t7;
+goto L403888;
+L403878:
+t8 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v0 + 4) = t8;
+L403888:
+t9 = MEM_U32(sp + 128);
+//nop;
+a0 = MEM_U32(t9 + 4);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t2 = MEM_U32(sp + 128);
+t1 = 0x10002d14;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 >= v0) goto L4038ec;
+//nop;
+a0 = MEM_U32(t2 + 4);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+//nop;
+at = 0x10002d14;
+//nop;
+MEM_U32(at + 0) = v0;
+L4038ec:
+t3 = 0x100063a0;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+t1 = MEM_U32(sp + 60);
+if (t3 == 0) goto L403a10;
+t4 = 0x1000006c;
+t5 = MEM_U32(sp + 128);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t1 = MEM_U32(sp + 60);
+if (t4 != 0) goto L403a10;
+at = 0x1000006c;
+MEM_U32(at + 0) = t5;
+goto L403a0c;
+L403928:
+at = 0x10002d2c;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L403934:
+a1 = 0x10000d7c;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L403970;
+v0 = 0x10002d30;
+//nop;
+t6 = MEM_U32(v0 + 0);
+//nop;
+t7 = t6 + 0x1;
+MEM_U32(v0 + 0) = t7;
+goto L403a0c;
+L403970:
+a2 = MEM_U32(s0 + 0);
+//nop;
+goto L4039f0;
+L40397c:
+a1 = 0x10000d8c;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L4039a8;
+at = 0x10000024;
+MEM_U32(at + 0) = s2;
+goto L403a0c;
+L4039a8:
+MEM_U32(sp + 160) = s2;
+goto L403a0c;
+L4039b0:
+MEM_U32(sp + 164) = s2;
+goto L403a0c;
+// fdead 0 t8 = MEM_U32(sp + 196);
+L4039bc:
+//nop;
+//nop;
+if (t8 != 0) goto L4039dc;
+t9 = 0x10000d98;
+//nop;
+t9 = t9;
+MEM_U32(sp + 196) = t9;
+goto L403a0c;
+L4039dc:
+//nop;
+if (s5 != 0) goto L4039f0;
+s5 = 0x10000d9c;
+s5 = s5;
+goto L403a0c;
+L4039f0:
+a0 = 0x10000da0;
+//nop;
+a1 = a2;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+//nop;
+L403a0c:
+t1 = MEM_U32(sp + 60);
+L403a10:
+s0 = s0 + 0x4;
+s1 = s1 + 0x4;
+if (s0 < t1) goto L4032e4;
+s0 = 0x1;
+L403a24:
+//nop;
+s3 = 0x20;
+//nop;
+f_initialize_char_syntax(mem, sp);
+// bdead 407a0003 gp = MEM_U32(sp + 48);
+a0 = 0xa;
+//nop;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 407a000b gp = MEM_U32(sp + 48);
+t3 = 0xa;
+v1 = 0x10004970;
+//nop;
+MEM_U32(v1 + 16) = v0;
+MEM_U32(v1 + 20) = v0;
+MEM_U32(v1 + 8) = t3;
+//nop;
+//nop;
+//nop;
+f_initialize_builtins(mem, sp);
+t4 = MEM_U32(sp + 164);
+// bdead 407a2143 gp = MEM_U32(sp + 48);
+at = (int)s4 < (int)0x2;
+if (t4 != 0) goto L403b80;
+s1 = 0x1000007c;
+//nop;
+a0 = MEM_U32(s1 + 0);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+a1 = MEM_U32(s1 + 0);
+//nop;
+a0 = v0;
+MEM_U32(sp + 124) = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+a2 = MEM_U32(sp + 124);
+// bdead 407a01c3 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+//nop;
+at = 0x2d;
+if (v1 == 0) goto L403b7c;
+L403ae4:
+s1 = a2 + 0x2;
+if (v1 != at) goto L403afc;
+t5 = MEM_U8(a2 + 1);
+at = 0x44;
+//nop;
+if (t5 == at) goto L403b1c;
+L403afc:
+//nop;
+MEM_U32(sp + 124) = a2;
+//nop;
+wrapper_abort(mem);
+a2 = MEM_U32(sp + 124);
+// bdead 407e0083 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+//nop;
+L403b1c:
+//nop;
+if (v1 == 0) goto L403b44;
+//nop;
+if (s3 == v1) goto L403b44;
+L403b2c:
+v1 = MEM_U8(a2 + 1);
+a2 = a2 + 0x1;
+//nop;
+if (v1 == 0) goto L403b44;
+//nop;
+if (s3 != v1) goto L403b2c;
+L403b44:
+//nop;
+if (v1 == 0) goto L403b54;
+MEM_U8(a2 + 0) = (uint8_t)zero;
+a2 = a2 + 0x1;
+L403b54:
+//nop;
+a0 = s1;
+MEM_U32(sp + 124) = a2;
+f_make_definition(mem, sp, a0);
+a2 = MEM_U32(sp + 124);
+// bdead 407a01c3 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+//nop;
+at = 0x2d;
+if (v1 != 0) goto L403ae4;
+L403b7c:
+at = (int)s4 < (int)0x2;
+L403b80:
+if (at != 0) {
+at = (int)s4 < (int)0x2;
+goto L403bd4;}
+at = (int)s4 < (int)0x2;
+v1 = MEM_U32(sp + 172);
+//nop;
+v1 = v1 + 0x4;
+L403b94:
+a0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (a0 == 0) goto L403bc0;
+//nop;
+MEM_U32(sp + 64) = v1;
+//nop;
+f_make_definition(mem, sp, a0);
+// bdead 407a0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+//nop;
+L403bc0:
+s0 = s0 + 0x1;
+v1 = v1 + 0x4;
+if (s0 != s4) goto L403b94;
+s0 = 0x1;
+at = (int)s4 < (int)0x2;
+L403bd4:
+t6 = MEM_U32(sp + 160);
+if (at != 0) goto L403c28;
+v1 = MEM_U32(sp + 168);
+//nop;
+v1 = v1 + 0x4;
+L403be8:
+a0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (a0 == 0) goto L403c14;
+//nop;
+MEM_U32(sp + 64) = v1;
+//nop;
+f_make_undef(mem, sp, a0);
+// bdead 407a0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+//nop;
+L403c14:
+s0 = s0 + 0x1;
+v1 = v1 + 0x4;
+if (s0 != s4) goto L403be8;
+s0 = 0x1;
+t6 = MEM_U32(sp + 160);
+L403c28:
+//nop;
+//nop;
+if (t6 != 0) goto L403d1c;
+v0 = 0x10000068;
+//nop;
+t7 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L403c7c;
+t8 = 0x10002d10;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L403c70;
+t9 = 0x10000050;
+MEM_U32(v0 + 0) = t9;
+goto L403cbc;
+L403c70:
+t1 = 0x10000038;
+MEM_U32(v0 + 0) = t1;
+goto L403cbc;
+L403c7c:
+t2 = 0x10002d10;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L403ca8;
+t4 = 0x10000070;
+t3 = 0x10000050;
+t4 = MEM_U32(t4 + 0);
+MEM_U32(t4 + 0) = t3;
+goto L403cbc;
+L403ca8:
+t6 = 0x10000070;
+t5 = 0x10000038;
+t6 = MEM_U32(t6 + 0);
+//nop;
+MEM_U32(t6 + 0) = t5;
+L403cbc:
+t7 = 0x100063a0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L403d1c;
+v0 = 0x1000006c;
+//nop;
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L403d1c;
+t9 = 0x10002d10;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L403d10;
+t1 = 0x10000050;
+MEM_U32(v0 + 0) = t1;
+goto L403d1c;
+L403d10:
+t2 = 0x10000038;
+//nop;
+MEM_U32(v0 + 0) = t2;
+L403d1c:
+t3 = 0x10002d40;
+at = 0x10002d40;
+t3 = MEM_U32(t3 + 0);
+//nop;
+t4 = t3 + 0x1;
+MEM_U32(at + 0) = t4;
+//nop;
+if ((int)s4 < (int)0x2) goto L403dc4;
+v1 = MEM_U32(sp + 176);
+//nop;
+v1 = v1 + 0x4;
+L403d4c:
+a0 = MEM_U32(v1 + 0);
+a1 = zero;
+//nop;
+if (a0 == 0) goto L403db8;
+//nop;
+a2 = 0x1b6;
+MEM_U32(sp + 64) = v1;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 407a010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+a0 = v0;
+if ((int)v0 >= 0) goto L403d98;
+//nop;
+a0 = MEM_U32(v1 + 0);
+//nop;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+v0 = 0x21;
+goto L404710;
+L403d98:
+//nop;
+a1 = MEM_U32(v1 + 0);
+a2 = 0x10004970;
+MEM_U32(sp + 64) = v1;
+f_finclude(mem, sp, a0, a1, a2);
+// bdead 407a0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+//nop;
+L403db8:
+s0 = s0 + 0x1;
+v1 = v1 + 0x4;
+if (s0 != s4) goto L403d4c;
+L403dc4:
+t5 = 0x10002d40;
+at = 0x10002d40;
+t5 = MEM_U32(t5 + 0);
+v0 = 0x10000030;
+t6 = t5 + 0xffffffff;
+MEM_U32(at + 0) = t6;
+t0 = MEM_U32(v0 + 0);
+t7 = MEM_U32(sp + 196);
+t0 = t0 + 0x1;
+MEM_U32(v0 + 0) = t0;
+if (t7 == 0) goto L403e00;
+t8 = MEM_U8(t7 + 0);
+a0 = MEM_U32(sp + 196);
+a1 = zero;
+if (t8 != 0) goto L403e14;
+L403e00:
+t9 = 0x10000db8;
+s4 = zero;
+t9 = t9;
+MEM_U32(sp + 196) = t9;
+goto L403e34;
+L403e14:
+//nop;
+a2 = 0x1b6;
+MEM_U32(sp + 80) = t0;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4058014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+s4 = v0;
+if ((int)v0 < 0) goto L4046f8;
+L403e34:
+t1 = 0x1000002c;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L403fd8;
+a0 = 0x10000dbc;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+//nop;
+if (v0 != 0) goto L403e94;
+a0 = 0x10000dd0;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+//nop;
+if (v0 == 0) goto L403fd8;
+L403e94:
+a0 = 0x10000de4;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+a3 = v0;
+if (v0 != 0) goto L403ee8;
+a0 = 0x10000df8;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+at = 0x1000002c;
+t2 = 0x2;
+a3 = v0;
+MEM_U32(at + 0) = t2;
+goto L403ef4;
+L403ee8:
+at = 0x1000002c;
+//nop;
+MEM_U32(at + 0) = s2;
+L403ef4:
+v1 = MEM_U8(v0 + 0);
+a1 = v0;
+s1 = v0;
+if (v1 == 0) goto L403f24;
+//nop;
+if (s3 == v1) goto L403f24;
+L403f0c:
+v1 = MEM_U8(a1 + 1);
+a1 = a1 + 0x1;
+//nop;
+if (v1 == 0) goto L403f24;
+//nop;
+if (s3 != v1) goto L403f0c;
+L403f24:
+t3 = MEM_U8(a1 + 0);
+a2 = a1 + 0x1;
+s0 = a1 - a3;
+if (t3 == 0) goto L403f7c;
+//nop;
+a0 = s0 + 0x1;
+MEM_U32(sp + 148) = a2;
+MEM_U32(sp + 112) = a3;
+MEM_U32(sp + 80) = t0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 406a000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+//nop;
+s1 = v0;
+a1 = v0;
+a2 = s0;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+t4 = s1 + s0;
+MEM_U8(t4 + 0) = (uint8_t)zero;
+goto L403f80;
+L403f7c:
+MEM_U32(sp + 148) = zero;
+L403f80:
+a1 = 0x10000e0c;
+//nop;
+a0 = s1;
+MEM_U32(sp + 80) = t0;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 406c014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+MEM_U32(sp + 152) = v0;
+if (v0 != 0) goto L403fc4;
+//nop;
+a0 = s1;
+MEM_U32(sp + 80) = t0;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+//nop;
+L403fc4:
+v0 = 0x1000002c;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+goto L404000;
+L403fd8:
+v0 = 0x1000002c;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L404000;
+t5 = 0xfb528e4;
+//nop;
+t5 = t5 + 0x10;
+MEM_U32(sp + 152) = t5;
+L404000:
+t2 = MEM_U32(sp + 144);
+if (v0 == 0) goto L40415c;
+v0 = 0x10006394;
+a0 = 0xc8;
+MEM_U32(v0 + 0) = a0;
+//nop;
+MEM_U32(sp + 80) = t0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+s3 = 0x10006390;
+at = 0x10006398;
+MEM_U32(s3 + 0) = v0;
+MEM_U8(v0 + 0) = (uint8_t)zero;
+MEM_U32(at + 0) = zero;
+t8 = MEM_U32(sp + 148);
+at = 0x1000639c;
+MEM_U32(at + 0) = zero;
+if (t8 == 0) goto L404090;
+//nop;
+a0 = t8;
+a1 = zero;
+MEM_U32(sp + 80) = t0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a1 = zero;
+a0 = 0x10000e10;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+t2 = MEM_U32(sp + 144);
+goto L40415c;
+L404090:
+t9 = MEM_U32(sp + 196);
+a1 = zero;
+t1 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L4040cc;
+a0 = 0x10000e14;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+t2 = MEM_U32(sp + 144);
+goto L40415c;
+L4040cc:
+//nop;
+a0 = MEM_U32(sp + 196);
+MEM_U32(sp + 80) = t0;
+v0 = f_make_deps_target(mem, sp, a0);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+a0 = v0;
+s0 = 0x10002d18;
+a1 = 0x10000e18;
+MEM_U32(s0 + 0) = v0;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s0 + 0);
+//nop;
+a1 = zero;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 196);
+//nop;
+a1 = zero;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a1 = zero;
+a0 = 0x10000e1c;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+//nop;
+t2 = MEM_U32(sp + 144);
+L40415c:
+s3 = 0x10006390;
+//nop;
+if (t2 == 0) goto L404200;
+t3 = MEM_U32(sp + 196);
+//nop;
+t4 = MEM_U8(t3 + 0);
+//nop;
+a2 = MEM_U32(sp + 148);
+if (t4 != 0) goto L4041a4;
+a0 = 0x10000e20;
+//nop;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+//nop;
+a2 = MEM_U32(sp + 148);
+L4041a4:
+//nop;
+//nop;
+if (a2 != 0) goto L4041cc;
+//nop;
+a0 = MEM_U32(sp + 196);
+MEM_U32(sp + 80) = t0;
+v0 = f_make_deps_target(mem, sp, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+a2 = v0;
+L4041cc:
+a0 = 0x10000e54;
+//nop;
+a1 = MEM_U32(sp + 144);
+a3 = 0x40ecbc; // function pointer
+MEM_U32(sp + 148) = a2;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = f_MDopen(mem, sp, a0, a1, a2, a3);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+at = 0x10002d1c;
+//nop;
+MEM_U32(at + 0) = v0;
+L404200:
+//nop;
+a0 = s4;
+a1 = sp + 0xcc;
+a2 = sp + 0xc8;
+MEM_U32(sp + 80) = t0;
+v0 = f_file_size_and_mode(mem, sp, a0, a1, a2);
+t0 = MEM_U32(sp + 80);
+// bdead 40780203 gp = MEM_U32(sp + 48);
+t5 = t0 << 3;
+t6 = 0x10002d50;
+t5 = t5 + t0;
+t5 = t5 << 2;
+t7 = MEM_U32(sp + 196);
+s0 = t5 + t6;
+MEM_U32(s0 + 4) = s2;
+MEM_U32(s0 + 0) = t7;
+t8 = MEM_U32(sp + 204);
+at = 0x8000;
+t9 = t8 & 0xf000;
+v1 = 0x7d0;
+if (t9 == at) goto L404300;
+//nop;
+a0 = 0x7d2;
+MEM_U32(sp + 96) = v1;
+MEM_U32(sp + 100) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+a3 = MEM_U32(sp + 100);
+MEM_U32(s0 + 16) = v0;
+a1 = v0;
+L40427c:
+//nop;
+a0 = s4;
+a2 = v1 - a3;
+MEM_U32(sp + 96) = v1;
+MEM_U32(sp + 88) = a1;
+MEM_U32(sp + 100) = a3;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 88);
+a3 = MEM_U32(sp + 100);
+//nop;
+if ((int)v0 < 0) goto L4046f8;
+//nop;
+if (v0 != 0) goto L4042c0;
+MEM_U32(s0 + 8) = a3;
+goto L404388;
+L4042c0:
+a3 = a3 + v0;
+a1 = a1 + v0;
+if (v1 != a3) goto L40427c;
+//nop;
+a0 = MEM_U32(s0 + 16);
+t1 = v1 << 1;
+a1 = t1 + 0x2;
+MEM_U32(sp + 96) = t1;
+MEM_U32(sp + 100) = a3;
+v0 = f_xrealloc(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 100);
+// bdead 4072010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+MEM_U32(s0 + 16) = v0;
+a1 = v0 + a3;
+goto L40427c;
+L404300:
+MEM_U32(s0 + 8) = zero;
+//nop;
+a0 = MEM_U32(sp + 200);
+a0 = a0 + 0x2;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 16) = v0;
+t2 = MEM_U32(sp + 200);
+//nop;
+//nop;
+if ((int)t2 <= 0) goto L404388;
+L40432c:
+t3 = MEM_U32(s0 + 16);
+t4 = MEM_U32(s0 + 8);
+//nop;
+a2 = MEM_U32(sp + 200);
+a0 = s4;
+a1 = t3 + t4;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4072010b gp = MEM_U32(sp + 48);
+//nop;
+if ((int)v0 > 0) goto L404364;
+//nop;
+if (v0 != 0) goto L4046f8;
+v1 = MEM_U32(s0 + 16);
+goto L40438c;
+L404364:
+t5 = MEM_U32(s0 + 8);
+//nop;
+t6 = t5 + v0;
+MEM_U32(s0 + 8) = t6;
+t7 = MEM_U32(sp + 200);
+//nop;
+t8 = t7 - v0;
+MEM_U32(sp + 200) = t8;
+if ((int)t8 > 0) goto L40432c;
+L404388:
+v1 = MEM_U32(s0 + 16);
+L40438c:
+t9 = 0x100001b4;
+MEM_U32(s0 + 20) = v1;
+t9 = MEM_U32(t9 + 0);
+t1 = 0x10000028;
+MEM_U32(s0 + 28) = t9;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L4043cc;
+//nop;
+a0 = s0;
+//nop;
+f_trigraph_pcp(mem, sp, a0);
+// bdead 40520003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 16);
+//nop;
+L4043cc:
+v0 = MEM_U32(s0 + 8);
+//nop;
+a0 = v1 + v0;
+if ((int)v0 <= 0) goto L404400;
+t2 = MEM_U8(a0 + -1);
+s2 = 0xa;
+t5 = v1 + v0;
+if (s2 == t2) goto L404404;
+MEM_U8(a0 + 0) = (uint8_t)s2;
+t3 = MEM_U32(s0 + 8);
+v1 = MEM_U32(s0 + 16);
+v0 = t3 + 0x1;
+MEM_U32(s0 + 8) = v0;
+L404400:
+t5 = v1 + v0;
+L404404:
+s2 = 0xa;
+MEM_U8(t5 + 0) = (uint8_t)zero;
+if (s5 == 0) goto L40446c;
+a1 = 0x10000e58;
+//nop;
+a0 = s5;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 405a000b gp = MEM_U32(sp + 48);
+a0 = s5;
+if (v0 == 0) goto L40446c;
+a1 = 0x10000e64;
+a2 = 0xfb528e4;
+//nop;
+a1 = a1;
+a2 = a2 + 0x10;
+v0 = wrapper_freopen(mem, a0, a1, a2);
+// bdead 405a010b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L40446c;
+//nop;
+a0 = s5;
+//nop;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 401a0003 gp = MEM_U32(sp + 48);
+//nop;
+L40446c:
+//nop;
+a1 = 0x10004970;
+a0 = s0;
+a2 = zero;
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40180183 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x10004970;
+//nop;
+f_rescan(mem, sp, a0, a1);
+// bdead 40180183 gp = MEM_U32(sp + 48);
+t7 = MEM_U32(sp + 156);
+t6 = 0x10002d24;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L4044d8;
+//nop;
+//nop;
+//nop;
+f_dump_all_macros(mem, sp);
+// bdead 40180103 gp = MEM_U32(sp + 48);
+//nop;
+goto L40453c;
+L4044d8:
+//nop;
+if (t7 != 0) goto L40453c;
+s1 = 0xfb528e4;
+t8 = MEM_U32(sp + 152);
+t9 = s1 + 0x10;
+//nop;
+if (t8 == t9) goto L40453c;
+a1 = 0x10004970;
+t1 = 0x10004970;
+//nop;
+a1 = MEM_U32(a1 + 16);
+t1 = MEM_U32(t1 + 20);
+a0 = MEM_U8(s1 + 29);
+a2 = t1 - a1;
+v0 = wrapper_write(mem, a0, a1, a2);
+// bdead 4018014b gp = MEM_U32(sp + 48);
+//nop;
+if ((int)v0 >= 0) goto L40453c;
+a0 = 0x10000e68;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40180103 gp = MEM_U32(sp + 48);
+//nop;
+L40453c:
+t2 = 0x1000002c;
+s1 = 0xfb528e4;
+t2 = MEM_U32(t2 + 0);
+a1 = MEM_U32(sp + 152);
+//nop;
+if (t2 == 0) goto L404650;
+//nop;
+a0 = MEM_U32(s3 + 0);
+s0 = a1 + 0xfffffff0;
+v0 = wrapper_fputs(mem, a0, a1);
+// bdead 400e0143 gp = MEM_U32(sp + 48);
+t4 = MEM_U32(sp + 152);
+t3 = 0xfb51f00;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L4045a0;
+//nop;
+a1 = MEM_U32(sp + 152);
+a0 = 0xa;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40060143 gp = MEM_U32(sp + 48);
+//nop;
+goto L404600;
+L4045a0:
+t5 = MEM_U32(t4 + 0);
+//nop;
+t6 = t5 + 0xffffffff;
+MEM_U32(t4 + 0) = t6;
+t7 = MEM_U32(sp + 152);
+t9 = MEM_U32(sp + 152);
+t8 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if ((int)t8 >= 0) goto L4045e4;
+//nop;
+a0 = 0xa;
+a1 = t7;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40060143 gp = MEM_U32(sp + 48);
+//nop;
+goto L404600;
+L4045e4:
+t1 = MEM_U32(t9 + 4);
+//nop;
+MEM_U8(t1 + 0) = (uint8_t)s2;
+t2 = MEM_U32(t9 + 4);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(t9 + 4) = t3;
+L404600:
+//nop;
+if (s0 == s1) goto L404650;
+//nop;
+a0 = MEM_U32(sp + 152);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+t5 = MEM_U32(sp + 152);
+// bdead 40044143 gp = MEM_U32(sp + 48);
+t6 = MEM_U8(t5 + 12);
+//nop;
+t4 = t6 & 0x20;
+//nop;
+if (t4 == 0) goto L404650;
+a0 = 0x10000e7c;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40040143 gp = MEM_U32(sp + 48);
+//nop;
+L404650:
+a0 = 0x10002d1c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (a0 == 0) goto L404680;
+//nop;
+a1 = MEM_U32(sp + 148);
+//nop;
+f_MDclose(mem, sp, a0, a1);
+// bdead 40040143 gp = MEM_U32(sp + 48);
+//nop;
+L404680:
+t8 = MEM_U8(s1 + 28);
+//nop;
+t7 = t8 & 0x20;
+//nop;
+if (t7 == 0) goto L4046b0;
+a0 = 0x10000e90;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+//nop;
+L4046b0:
+t1 = 0x100001ac;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L4046e0;
+//nop;
+a0 = 0x21;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+//nop;
+L4046e0:
+//nop;
+a0 = zero;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 48);
+//nop;
+L4046f8:
+//nop;
+a0 = MEM_U32(sp + 196);
+//nop;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+L404710:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0xd0;
+return v0;
+}
+
+static void func_404734(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L404734:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+sp = sp + 0xffffffb8;
+t6 = MEM_U32(t6 + 0);
+t8 = 0x10002d50;
+t7 = t6 << 3;
+t7 = t7 + t6;
+// fdead 420181eb MEM_U32(sp + 32) = s0;
+t7 = t7 << 2;
+s0 = a0;
+// fdead 420381eb MEM_U32(sp + 44) = ra;
+// fdead 420381eb MEM_U32(sp + 40) = gp;
+// fdead 420381eb MEM_U32(sp + 36) = s1;
+MEM_U32(sp + 76) = a1;
+MEM_U32(sp + 80) = a2;
+MEM_U32(sp + 84) = a3;
+v0 = t7 + t8;
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 52) = v0;
+MEM_U32(sp + 56) = a0;
+v0 = wrapper_strlen(mem, a0);
+t9 = MEM_U32(sp + 84);
+// bdead 4402000b gp = MEM_U32(sp + 40);
+a0 = t9 + v0;
+//nop;
+MEM_U32(sp + 60) = v0;
+a0 = a0 + 0x64;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 84);
+t1 = MEM_U32(sp + 60);
+//nop;
+a0 = t0 + t1;
+s1 = v0;
+a0 = a0 + 0x64;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 80);
+//nop;
+a2 = MEM_U32(sp + 84);
+MEM_U32(sp + 64) = v0;
+a0 = v0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 64);
+t2 = MEM_U32(sp + 84);
+// bdead 40060903 gp = MEM_U32(sp + 40);
+t3 = a3 + t2;
+MEM_U8(t3 + 0) = (uint8_t)zero;
+t4 = MEM_U32(sp + 52);
+t6 = MEM_U32(sp + 56);
+//nop;
+a1 = 0x10000ea4;
+t5 = MEM_U32(t4 + 4);
+a2 = MEM_U32(sp + 76);
+a0 = s1;
+MEM_U32(sp + 20) = t6;
+a1 = a1;
+MEM_U32(sp + 16) = t5;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40060001 gp = MEM_U32(sp + 40);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40060009 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 48) = v0;
+if (s0 != 0) goto L404858;
+s0 = 0x10004970;
+//nop;
+L404858:
+a1 = MEM_U32(s0 + 20);
+t8 = MEM_U32(s0 + 16);
+t7 = MEM_U32(s0 + 8);
+t9 = a1 - t8;
+t1 = v0 + 0x1;
+t0 = t7 - t9;
+//nop;
+if ((int)t1 < (int)t0) goto L40489c;
+a1 = MEM_U32(sp + 48);
+//nop;
+a0 = s0;
+a1 = a1 + 0x1;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s0 + 20);
+//nop;
+L40489c:
+//nop;
+a2 = MEM_U32(sp + 48);
+a0 = s1;
+wrapper_bcopy(mem, a0, a1, a2);
+t2 = MEM_U32(s0 + 20);
+t3 = MEM_U32(sp + 48);
+// bdead 40061801 gp = MEM_U32(sp + 40);
+t4 = t2 + t3;
+MEM_U32(s0 + 20) = t4;
+//nop;
+a0 = s1;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 44);
+// bdead 19 gp = MEM_U32(sp + 40);
+// bdead 19 s0 = MEM_U32(sp + 32);
+// bdead 19 s1 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x48;
+return;
+}
+
+static void f_trigraph_pcp(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+L404900:
+//trigraph_pcp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000016b MEM_U32(sp + 52) = ra;
+// fdead 4000016b MEM_U32(sp + 48) = gp;
+// fdead 4000016b MEM_U32(sp + 44) = s5;
+// fdead 4000016b MEM_U32(sp + 40) = s4;
+// fdead 4000016b MEM_U32(sp + 36) = s3;
+// fdead 4000016b MEM_U32(sp + 32) = s2;
+// fdead 4000016b MEM_U32(sp + 28) = s1;
+// fdead 4000016b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 56) = a0;
+s4 = MEM_U32(a0 + 16);
+//nop;
+a1 = 0x3f;
+s2 = s4;
+a0 = s4;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 4028000b gp = MEM_U32(sp + 48);
+s5 = 0x3f;
+if (v0 == 0) goto L404a54;
+s1 = v0 + 0x1;
+L40495c:
+t7 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s5 != t7) goto L404a38;
+t8 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t9 = t8 + 0xffffffdf;
+//nop;
+if (t9 >= 0x1f) goto L404a38;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L4049d4;
+case 1: goto L404a38;
+case 2: goto L404a38;
+case 3: goto L404a38;
+case 4: goto L404a38;
+case 5: goto L404a38;
+case 6: goto L4049c4;
+case 7: goto L4049ac;
+case 8: goto L4049bc;
+case 9: goto L404a38;
+case 10: goto L404a38;
+case 11: goto L404a38;
+case 12: goto L4049e4;
+case 13: goto L404a38;
+case 14: goto L4049b4;
+case 15: goto L404a38;
+case 16: goto L404a38;
+case 17: goto L404a38;
+case 18: goto L404a38;
+case 19: goto L404a38;
+case 20: goto L404a38;
+case 21: goto L404a38;
+case 22: goto L404a38;
+case 23: goto L404a38;
+case 24: goto L404a38;
+case 25: goto L404a38;
+case 26: goto L404a38;
+case 27: goto L4049cc;
+case 28: goto L4049a4;
+case 29: goto L4049dc;
+case 30: goto L4049ec;
+}
+L4049a4:
+s0 = 0x23;
+goto L4049f4;
+L4049ac:
+s0 = 0x5b;
+goto L4049f4;
+L4049b4:
+s0 = 0x5c;
+goto L4049f4;
+L4049bc:
+s0 = 0x5d;
+goto L4049f4;
+L4049c4:
+s0 = 0x5e;
+goto L4049f4;
+L4049cc:
+s0 = 0x7b;
+goto L4049f4;
+L4049d4:
+s0 = 0x7c;
+goto L4049f4;
+L4049dc:
+s0 = 0x7d;
+goto L4049f4;
+L4049e4:
+s0 = 0x7e;
+goto L4049f4;
+L4049ec:
+s1 = s1 + 0xffffffff;
+goto L404a38;
+L4049f4:
+a2 = s1 - s4;
+a2 = a2 + 0xfffffffe;
+s3 = a2;
+if (s2 == s4) goto L404a24;
+//nop;
+if ((int)a2 <= 0) goto L404a24;
+//nop;
+a0 = s4;
+a1 = s2;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 405e0003 gp = MEM_U32(sp + 48);
+//nop;
+L404a24:
+s2 = s2 + s3;
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)s0;
+s4 = s1;
+L404a38:
+//nop;
+a0 = s1;
+a1 = 0x3f;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+s1 = v0 + 0x1;
+if (v0 != 0) goto L40495c;
+L404a54:
+a3 = MEM_U32(sp + 56);
+//nop;
+v0 = MEM_U32(a3 + 16);
+v1 = MEM_U32(a3 + 8);
+t0 = s4 - v0;
+s3 = v1 - t0;
+if (s2 == s4) goto L404a9c;
+a0 = s4;
+if ((int)s3 <= 0) goto L404a9c;
+//nop;
+a1 = s2;
+a2 = s3;
+wrapper_bcopy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 56);
+// bdead 40280103 gp = MEM_U32(sp + 48);
+v0 = MEM_U32(a3 + 16);
+v1 = MEM_U32(a3 + 8);
+//nop;
+L404a9c:
+a2 = s4 - s2;
+t2 = v1 - a2;
+t5 = 0x10002d38;
+MEM_U32(a3 + 8) = t2;
+t4 = v0 + t2;
+MEM_U8(t4 + 0) = (uint8_t)zero;
+t5 = MEM_U32(t5 + 0);
+//nop;
+// bdead 40280181 ra = MEM_U32(sp + 52);
+if (t5 == 0) goto L404b14;
+// bdead 40000181 ra = MEM_U32(sp + 52);
+if (s4 == s2) goto L404b14;
+t6 = 0x10002d2c;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+// bdead 40000181 ra = MEM_U32(sp + 52);
+if (t6 != 0) goto L404b14;
+a0 = 0x10000eb8;
+//nop;
+a0 = a0;
+a1 = (int)a2 >> 1;
+if ((int)a2 >= 0) goto L404b00;
+at = a2 + 0x1;
+a1 = (int)at >> 1;
+L404b00:
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 52);
+L404b14:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static uint64_t f_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404b34:
+//newline_fix:
+t6 = MEM_U8(a0 + 0);
+t0 = 0x5c;
+v0 = zero;
+if (t0 != t6) goto L404b74;
+t7 = MEM_U8(a0 + 1);
+t1 = 0xa;
+a1 = a0 + 0x2;
+if (t1 != t7) goto L404b74;
+L404b54:
+t8 = MEM_U8(a1 + 0);
+v0 = v0 + 0x1;
+a1 = a1 + 0x1;
+if (t0 != t8) goto L404b74;
+t9 = MEM_U8(a1 + 0);
+a1 = a1 + 0x1;
+//nop;
+if (t1 == t9) goto L404b54;
+L404b74:
+a2 = v0 << 1;
+v1 = a2 + a0;
+t1 = 0xa;
+a1 = v1;
+if (v0 == 0) goto L404bf8;
+a3 = MEM_U8(v1 + 0);
+t2 = 0x2f;
+v1 = 0x2a;
+if (t2 == a3) goto L404ba0;
+//nop;
+if (v1 != a3) goto L404bf8;
+L404ba0:
+v0 = MEM_U8(a1 + 0);
+v1 = 0x2a;
+//nop;
+if (v1 == v0) goto L404bb8;
+//nop;
+if (t2 != a3) goto L404bd4;
+L404bb8:
+MEM_U8(a0 + 0) = (uint8_t)v0;
+v0 = MEM_U8(a1 + 1);
+a0 = a0 + 0x1;
+a1 = a1 + 0x1;
+if (v1 == v0) goto L404bb8;
+//nop;
+if (t2 == v0) goto L404bb8;
+L404bd4:
+v1 = (int)a2 < (int)0x2;
+a2 = a2 + 0xfffffffe;
+if (v1 != 0) goto L404bf8;
+L404be0:
+v1 = (int)a2 < (int)0x2;
+MEM_U8(a0 + 0) = (uint8_t)t0;
+a2 = a2 + 0xfffffffe;
+MEM_U8(a0 + 1) = (uint8_t)t1;
+a0 = a0 + 0x2;
+if (v1 == 0) goto L404be0;
+L404bf8:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_name_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404c00:
+//name_newline_fix:
+//nop;
+//nop;
+//nop;
+t6 = MEM_U8(a0 + 0);
+a3 = 0x5c;
+v0 = zero;
+if (a3 != t6) goto L404c4c;
+t7 = MEM_U8(a0 + 1);
+t0 = 0xa;
+a1 = a0 + 0x2;
+if (t0 != t7) goto L404c4c;
+L404c2c:
+t8 = MEM_U8(a1 + 0);
+v0 = v0 + 0x1;
+a1 = a1 + 0x1;
+if (a3 != t8) goto L404c4c;
+t9 = MEM_U8(a1 + 0);
+a1 = a1 + 0x1;
+//nop;
+if (t0 == t9) goto L404c2c;
+L404c4c:
+a2 = v0 << 1;
+v1 = a2 + a0;
+t0 = 0xa;
+a1 = v1;
+if (v0 == 0) goto L404cd4;
+t1 = 0x10005f90;
+t2 = MEM_U8(v1 + 0);
+//nop;
+t3 = t1 + t2;
+v0 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L404cd4;
+//nop;
+if (v0 == 0) goto L404cb0;
+v0 = MEM_U8(v1 + 0);
+//nop;
+L404c90:
+MEM_U8(a0 + 0) = (uint8_t)v0;
+v0 = MEM_U8(a1 + 1);
+a0 = a0 + 0x1;
+t4 = t1 + v0;
+t5 = MEM_U8(t4 + 0);
+a1 = a1 + 0x1;
+//nop;
+if (t5 != 0) goto L404c90;
+L404cb0:
+if ((int)a2 < (int)0x2) {
+a2 = a2 + 0xfffffffe;
+goto L404cd4;}
+a2 = a2 + 0xfffffffe;
+L404cbc:
+v1 = (int)a2 < (int)0x2;
+MEM_U8(a0 + 0) = (uint8_t)a3;
+a2 = a2 + 0xfffffffe;
+MEM_U8(a0 + 1) = (uint8_t)t0;
+a0 = a0 + 0x2;
+if (v1 == 0) goto L404cbc;
+L404cd4:
+//nop;
+return v0;
+}
+
+static void f_rescan(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+uint64_t temp64;
+L404cdc:
+//rescan:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff60;
+t6 = 0x10002d40;
+// fdead 4000806b MEM_U32(sp + 56) = fp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 44) = s6;
+s6 = a0;
+// fdead 4080806b MEM_U32(sp + 60) = ra;
+// fdead 4080806b MEM_U32(sp + 52) = gp;
+// fdead 4080806b MEM_U32(sp + 48) = s7;
+// fdead 4080806b MEM_U32(sp + 40) = s5;
+// fdead 4080806b MEM_U32(sp + 36) = s4;
+// fdead 4080806b MEM_U32(sp + 32) = s3;
+// fdead 4080806b MEM_U32(sp + 28) = s2;
+// fdead 4080806b MEM_U32(sp + 24) = s1;
+// fdead 4080806b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 164) = a1;
+fp = zero;
+MEM_U32(sp + 148) = zero;
+MEM_U32(sp + 128) = zero;
+if (t6 == 0) goto L404d80;
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a0 = t8 + t9;
+t4 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L404d80;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0800183 gp = MEM_U32(sp + 52);
+//nop;
+L404d80:
+t5 = 0x10000030;
+t7 = 0x10002d50;
+t5 = MEM_U32(t5 + 0);
+s1 = MEM_U32(s6 + 20);
+t6 = t5 << 3;
+t6 = t6 + t5;
+t6 = t6 << 2;
+s4 = t6 + t7;
+t8 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t4 = MEM_U32(s6 + 8);
+t2 = t8 + t9;
+t6 = s1 - t5;
+s2 = t2 - s0;
+t7 = t4 - t6;
+at = (int)s2 < (int)t7;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L404df0;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0aa0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+//nop;
+L404df0:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+t8 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L404e24;
+//nop;
+MEM_U32(sp + 136) = t2;
+//nop;
+wrapper_abort(mem);
+// bdead c0ae0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+//nop;
+L404e24:
+v1 = MEM_U8(s0 + 0);
+s5 = 0xa;
+t3 = 0x5c;
+t1 = 0x2a;
+t0 = 0x2f;
+s3 = v1 & 0xff;
+L404e3c:
+at = s3 < 0x7b;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U8(s1 + 0) = (uint8_t)s3;
+s1 = s1 + 0x1;
+if (at == 0) goto L405c98;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (s3) {
+case 0: goto L405b10;
+case 1: goto L405c98;
+case 2: goto L405c98;
+case 3: goto L405c98;
+case 4: goto L405c98;
+case 5: goto L405c98;
+case 6: goto L405c98;
+case 7: goto L405c98;
+case 8: goto L405c98;
+case 9: goto L405c98;
+case 10: goto L405958;
+case 11: goto L405c98;
+case 12: goto L405c98;
+case 13: goto L405c98;
+case 14: goto L405c98;
+case 15: goto L405c98;
+case 16: goto L405c98;
+case 17: goto L405c98;
+case 18: goto L405c98;
+case 19: goto L405c98;
+case 20: goto L405c98;
+case 21: goto L405c98;
+case 22: goto L405c98;
+case 23: goto L405c98;
+case 24: goto L405c98;
+case 25: goto L405c98;
+case 26: goto L405c98;
+case 27: goto L405c98;
+case 28: goto L405c98;
+case 29: goto L405c98;
+case 30: goto L405c98;
+case 31: goto L405c98;
+case 32: goto L405c98;
+case 33: goto L405c98;
+case 34: goto L40521c;
+case 35: goto L404ed0;
+case 36: goto L405864;
+case 37: goto L405c98;
+case 38: goto L405c98;
+case 39: goto L40521c;
+case 40: goto L405c98;
+case 41: goto L405c98;
+case 42: goto L405c98;
+case 43: goto L405c98;
+case 44: goto L405c98;
+case 45: goto L405c98;
+case 46: goto L405c98;
+case 47: goto L4054f4;
+case 48: goto L405884;
+case 49: goto L405884;
+case 50: goto L405884;
+case 51: goto L405884;
+case 52: goto L405884;
+case 53: goto L405884;
+case 54: goto L405884;
+case 55: goto L405884;
+case 56: goto L405884;
+case 57: goto L405884;
+case 58: goto L405c98;
+case 59: goto L405c98;
+case 60: goto L405c98;
+case 61: goto L405c98;
+case 62: goto L405c98;
+case 63: goto L405c98;
+case 64: goto L405c98;
+case 65: goto L405940;
+case 66: goto L405940;
+case 67: goto L405940;
+case 68: goto L405940;
+case 69: goto L405940;
+case 70: goto L405940;
+case 71: goto L405940;
+case 72: goto L405940;
+case 73: goto L405940;
+case 74: goto L405940;
+case 75: goto L405940;
+case 76: goto L405940;
+case 77: goto L405940;
+case 78: goto L405940;
+case 79: goto L405940;
+case 80: goto L405940;
+case 81: goto L405940;
+case 82: goto L405940;
+case 83: goto L405940;
+case 84: goto L405940;
+case 85: goto L405940;
+case 86: goto L405940;
+case 87: goto L405940;
+case 88: goto L405940;
+case 89: goto L405940;
+case 90: goto L405940;
+case 91: goto L405c98;
+case 92: goto L404e74;
+case 93: goto L405c98;
+case 94: goto L405c98;
+case 95: goto L405940;
+case 96: goto L405c98;
+case 97: goto L405940;
+case 98: goto L405940;
+case 99: goto L405940;
+case 100: goto L405940;
+case 101: goto L405940;
+case 102: goto L405940;
+case 103: goto L405940;
+case 104: goto L405940;
+case 105: goto L405940;
+case 106: goto L405940;
+case 107: goto L405940;
+case 108: goto L405940;
+case 109: goto L405940;
+case 110: goto L405940;
+case 111: goto L405940;
+case 112: goto L405940;
+case 113: goto L405940;
+case 114: goto L405940;
+case 115: goto L405940;
+case 116: goto L405940;
+case 117: goto L405940;
+case 118: goto L405940;
+case 119: goto L405940;
+case 120: goto L405940;
+case 121: goto L405940;
+case 122: goto L405940;
+}
+L404e74:
+//nop;
+if (s0 >= t2) goto L406164;
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s5 != v1) goto L404eac;
+t5 = MEM_U32(s4 + 4);
+s0 = s0 + 0x1;
+t4 = t5 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U32(s4 + 4) = t4;
+s1 = s1 + 0xffffffff;
+goto L406164;
+L404eac:
+t6 = 0x1;
+if ((int)fp <= 0) goto L404ebc;
+MEM_U32(sp + 128) = t6;
+goto L405c8c;
+L404ebc:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L406164;
+L404ed0:
+t7 = MEM_U32(s4 + 24);
+//nop;
+//nop;
+if (t7 != 0) goto L405c98;
+t8 = 0x1;
+if (fp == 0) goto L404ef0;
+MEM_U32(sp + 128) = t8;
+goto L405c8c;
+L404ef0:
+t9 = MEM_U32(sp + 116);
+//nop;
+//nop;
+if (t9 == 0) goto L405c98;
+a0 = 0x10002d10;
+v0 = MEM_U32(sp + 116);
+a0 = MEM_U32(a0 + 0);
+a1 = s6;
+L404f10:
+v1 = MEM_U8(v0 + 0);
+L404f14:
+t5 = 0x10006190;
+//nop;
+t4 = v1 + t5;
+t6 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L404f38;
+v0 = v0 + 0x1;
+goto L404f10;
+L404f38:
+//nop;
+if (t3 != v1) goto L404f58;
+t7 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (s5 != t7) goto L404f58;
+v0 = v0 + 0x2;
+goto L404f10;
+L404f58:
+//nop;
+if (t0 != v1) goto L404fb8;
+t8 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (t1 != t8) goto L404fb8;
+t9 = MEM_U8(v0 + 2);
+v0 = v0 + 0x2;
+//nop;
+if (t1 != t9) goto L404f90;
+t5 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (t0 == t5) goto L404fb0;
+L404f90:
+t4 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+//nop;
+if (t1 != t4) goto L404f90;
+t6 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (t0 != t6) goto L404f90;
+L404fb0:
+v0 = v0 + 0x2;
+goto L404f10;
+L404fb8:
+t5 = v0 + 0x1;
+if (a0 == 0) goto L405004;
+t5 = v0 + 0x1;
+if (t0 != v1) goto L405004;
+t7 = MEM_U8(v0 + 1);
+//nop;
+t5 = v0 + 0x1;
+if (t0 != t7) goto L405004;
+t8 = MEM_U8(v0 + 2);
+v0 = v0 + 0x3;
+//nop;
+if (s5 == t8) goto L404f10;
+L404fe8:
+t9 = MEM_U8(v0 + 0);
+v0 = v0 + 0x1;
+//nop;
+if (s5 != t9) goto L404fe8;
+v1 = MEM_U8(v0 + 0);
+goto L404f14;
+// fdead 0 t5 = v0 + 0x1;
+L405004:
+//nop;
+if (t5 != s0) goto L405c98;
+s1 = s1 + 0xffffffff;
+MEM_U32(s4 + 20) = s0;
+MEM_U32(s6 + 20) = s1;
+//nop;
+MEM_U32(sp + 136) = t2;
+a0 = s4;
+v0 = f_handle_directive(mem, sp, a0, a1, a2, a3);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+if (v0 != 0) goto L405130;
+t4 = 0x10002d40;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L405128;
+t6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+a0 = t7 + t8;
+t9 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L405128;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0c40183 gp = MEM_U32(sp + 52);
+t9 = MEM_U32(s6 + 8);
+t5 = 0x10000030;
+t6 = 0x10002d50;
+t5 = MEM_U32(t5 + 0);
+t0 = 0x2f;
+t4 = t5 << 3;
+t4 = t4 + t5;
+t4 = t4 << 2;
+s4 = t4 + t6;
+t7 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t7 + t8;
+t4 = s1 - t5;
+t6 = t9 - t4;
+s2 = t2 - s0;
+at = (int)s2 < (int)t6;
+t1 = 0x2a;
+t3 = 0x5c;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L40511c;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L40511c:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+goto L406164;
+L405128:
+s1 = s1 + 0x1;
+goto L405c98;
+L405130:
+t7 = 0x10002d40;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L405198;
+t8 = 0x10000030;
+t9 = 0x10002d50;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t5 = t8 << 3;
+t5 = t5 + t8;
+t5 = t5 << 2;
+a0 = t5 + t9;
+t4 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L405198;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0c00183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405198:
+t6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(t6 + 0);
+s1 = MEM_U32(s6 + 20);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+s4 = t7 + t8;
+t5 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+t6 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t4 = MEM_U32(s6 + 8);
+t2 = t5 + t9;
+t7 = s1 - t6;
+s2 = t2 - s0;
+t8 = t4 - t7;
+at = (int)s2 < (int)t8;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405210;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405210:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+goto L406164;
+L40521c:
+t5 = 0x1;
+if (fp == 0) goto L40522c;
+MEM_U32(sp + 128) = t5;
+goto L405c8c;
+L40522c:
+t9 = MEM_U32(s4 + 4);
+//nop;
+MEM_U32(sp + 120) = t9;
+L405238:
+at = s0 < t2;
+L40523c:
+t4 = 0x17;
+if (at != 0) goto L405378;
+t6 = 0x10002d3c;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L405334;
+v0 = MEM_U32(s4 + 24);
+//nop;
+//nop;
+if (v0 == 0) goto L406164;
+MEM_U32(sp + 116) = zero;
+MEM_U32(v0 + 12) = t4;
+a0 = MEM_U32(s4 + 32);
+//nop;
+//nop;
+if (a0 == 0) goto L4052a4;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c0d40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L4052a4:
+v0 = 0x10000030;
+t5 = 0x10000030;
+t7 = MEM_U32(v0 + 0);
+t6 = 0x10002d50;
+t8 = t7 + 0xffffffff;
+MEM_U32(v0 + 0) = t8;
+t5 = MEM_U32(t5 + 0);
+t8 = MEM_U32(s6 + 8);
+t9 = t5 << 3;
+t9 = t9 + t5;
+t9 = t9 << 2;
+s4 = t9 + t6;
+t4 = MEM_U32(s4 + 16);
+t7 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t4 + t7;
+t9 = s1 - t5;
+t6 = t8 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t6;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405328;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0fa0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405328:
+s1 = MEM_U32(s6 + 20);
+at = s0 < t2;
+goto L40523c;
+L405334:
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10000ed4;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+goto L406164;
+L405378:
+t4 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+MEM_U8(s1 + -1) = (uint8_t)t4;
+a1 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (a1 == s5) goto L4053b8;
+at = 0x22;
+if (a1 == at) {
+at = 0x27;
+goto L4054dc;}
+at = 0x27;
+//nop;
+if (a1 == at) goto L4054dc;
+at = s0 < t2;
+if (a1 == t3) goto L40544c;
+at = s0 < t2;
+goto L40523c;
+L4053b8:
+t7 = MEM_U32(s4 + 4);
+t6 = 0x10002d3c;
+t5 = t7 + 0x1;
+MEM_U32(s4 + 4) = t5;
+t8 = MEM_U32(s6 + 4);
+at = 0x27;
+t9 = t8 + 0x1;
+MEM_U32(s6 + 4) = t9;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L406164;
+t4 = 0x10002d28;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L405408;
+if (s3 != at) {
+at = s0 < t2;
+goto L40523c;}
+at = s0 < t2;
+L405408:
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10000f00;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+goto L406164;
+L40544c:
+if (at == 0) {
+at = s0 < t2;
+goto L40523c;}
+at = s0 < t2;
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s5 != v1) goto L405480;
+t7 = MEM_U32(s4 + 4);
+s1 = s1 + 0xffffffff;
+t5 = t7 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U32(s4 + 4) = t5;
+goto L405238;
+L405480:
+//nop;
+if (t3 != v1) goto L4054c8;
+t8 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s5 != t8) goto L4054c8;
+L405498:
+t9 = MEM_U32(s4 + 4);
+s0 = s0 + 0x2;
+t6 = t9 + 0x1;
+MEM_U32(s4 + 4) = t6;
+v1 = MEM_U8(s0 + 0);
+s2 = s2 + 0xfffffffe;
+//nop;
+if (t3 != v1) goto L4054c8;
+t4 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s5 == t4) goto L405498;
+L4054c8:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L405238;
+L4054dc:
+t7 = MEM_U8(s0 + -1);
+//nop;
+at = s0 < t2;
+if (s3 != t7) goto L40523c;
+v1 = MEM_U8(s0 + 0);
+goto L406168;
+L4054f4:
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (t3 != v1) goto L40553c;
+t5 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s5 != t5) goto L40553c;
+//nop;
+a0 = s0;
+MEM_U32(sp + 136) = t2;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+v1 = MEM_U8(s0 + 0);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L40553c:
+t8 = 0x10002d10;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L405608;
+//nop;
+if (t0 != v1) goto L405608;
+t9 = 0x10000020;
+s0 = s0 + 0xffffffff;
+t9 = MEM_U32(t9 + 0);
+s2 = s2 + 0x1;
+s1 = s1 + 0xffffffff;
+if (t9 != 0) goto L405584;
+t6 = 0x20;
+MEM_U8(s1 + 0) = (uint8_t)t6;
+s1 = s1 + 0x1;
+goto L405590;
+L405584:
+MEM_U8(s1 + 0) = (uint8_t)t0;
+MEM_U8(s1 + 1) = (uint8_t)t0;
+s1 = s1 + 0x2;
+L405590:
+a0 = s0 + 0x2;
+if (s0 >= t2) goto L406164;
+L40559c:
+t4 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s5 != t4) goto L4055f4;
+t7 = 0x10000020;
+s0 = s0 + 0xffffffff;
+t7 = MEM_U32(t7 + 0);
+s2 = s2 + 0x1;
+a1 = s1;
+if (t7 == 0) goto L406164;
+//nop;
+s3 = s0 - a0;
+a2 = s3;
+MEM_U32(sp + 136) = t2;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c0fe0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+s1 = s1 + s3;
+goto L406164;
+L4055f4:
+//nop;
+if (s0 < t2) goto L40559c;
+v1 = MEM_U8(s0 + 0);
+goto L406168;
+L405608:
+//nop;
+if (t1 != v1) goto L405c98;
+t5 = MEM_U32(s4 + 24);
+//nop;
+//nop;
+if (t5 != 0) goto L405c98;
+t8 = 0x1;
+if (fp == 0) goto L405630;
+MEM_U32(sp + 128) = t8;
+goto L405c8c;
+L405630:
+t6 = 0x10000020;
+t9 = MEM_U32(s4 + 4);
+t6 = MEM_U32(t6 + 0);
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U32(sp + 120) = t9;
+if (t6 != 0) goto L405674;
+t4 = 0x10002d3c;
+t7 = 0x20;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40566c;
+s1 = s1 + 0xffffffff;
+goto L40567c;
+L40566c:
+MEM_U8(s1 + -1) = (uint8_t)t7;
+goto L40567c;
+L405674:
+MEM_U8(s1 + 0) = (uint8_t)t1;
+s1 = s1 + 0x1;
+L40567c:
+s7 = s0;
+if (s0 >= t2) goto L4057c8;
+L405688:
+a1 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (a1 == s5) goto L405784;
+//nop;
+if (a1 == t1) goto L40571c;
+at = s0 < t2;
+if (a1 != t0) goto L4057c0;
+t5 = 0x10002d34;
+at = s0 < t2;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L4057bc;
+if (at == 0) {
+at = s0 < t2;
+goto L4057c0;}
+at = s0 < t2;
+t8 = MEM_U8(s0 + 0);
+//nop;
+at = s0 < t2;
+if (t1 != t8) goto L4057c0;
+t9 = 0x10002d2c;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+at = s0 < t2;
+if (t9 != 0) goto L4057c0;
+a0 = 0x10000f2c;
+//nop;
+MEM_U32(sp + 136) = t2;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+goto L4057bc;
+L40571c:
+t6 = MEM_U8(s0 + 0);
+//nop;
+at = s0 < t2;
+if (t3 != t6) goto L405764;
+t4 = MEM_U8(s0 + 1);
+//nop;
+at = s0 < t2;
+if (s5 != t4) goto L405764;
+//nop;
+a0 = s0;
+MEM_U32(sp + 136) = t2;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+at = s0 < t2;
+L405764:
+if (at == 0) {
+at = s0 < t2;
+goto L4057cc;}
+at = s0 < t2;
+t7 = MEM_U8(s0 + 0);
+//nop;
+at = s0 < t2;
+if (t0 != t7) goto L4057c0;
+at = s0 < t2;
+goto L4057cc;
+L405784:
+t5 = MEM_U32(s4 + 4);
+t9 = 0x10000020;
+t8 = t5 + 0x1;
+MEM_U32(s4 + 4) = t8;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L4057ac;
+MEM_U8(s1 + 0) = (uint8_t)s5;
+s1 = s1 + 0x1;
+L4057ac:
+t6 = MEM_U32(s6 + 4);
+//nop;
+t4 = t6 + 0x1;
+MEM_U32(s6 + 4) = t4;
+L4057bc:
+at = s0 < t2;
+L4057c0:
+//nop;
+if (at != 0) goto L405688;
+L4057c8:
+at = s0 < t2;
+L4057cc:
+//nop;
+if (at != 0) goto L405818;
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10000f40;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+goto L406164;
+L405818:
+t7 = 0x10000020;
+s0 = s0 + 0x1;
+t7 = MEM_U32(t7 + 0);
+s2 = s2 + 0xffffffff;
+a0 = s7;
+if (t7 == 0) goto L406164;
+//nop;
+s3 = s0 - s7;
+a2 = s3;
+a1 = s1;
+MEM_U32(sp + 136) = t2;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c0fe0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+s1 = s1 + s3;
+goto L406164;
+L405864:
+t5 = 0x100001b0;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+if (t5 != 0) {
+t5 = MEM_U32(sp + 148);
+goto L405944;}
+t5 = MEM_U32(sp + 148);
+//nop;
+goto L405c98;
+L405884:
+at = s0 < t2;
+if (fp != 0) goto L405940;
+//nop;
+if (s0 >= t2) goto L406164;
+L405894:
+s3 = MEM_U8(s0 + 0);
+t8 = 0xfb504f0;
+s0 = s0 + 0x1;
+v0 = s3 + t8;
+t9 = MEM_U8(v0 + 1);
+s2 = s2 + 0xffffffff;
+t6 = t9 & 0x7;
+at = 0x2e;
+if (t6 != 0) goto L4058d4;
+if (s3 == at) {
+at = 0x5f;
+goto L4058d4;}
+at = 0x5f;
+//nop;
+if (s3 == at) goto L4058d4;
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+goto L406164;
+L4058d4:
+t4 = 0xfb504f0;
+MEM_U8(s1 + 0) = (uint8_t)s3;
+t4 = t4 + 0x65;
+s1 = s1 + 0x1;
+if (v0 == t4) goto L4058f8;
+t7 = 0xfb504f0;
+//nop;
+t7 = t7 + 0x45;
+if (v0 != t7) {
+at = s0 < t2;
+goto L40592c;}
+L4058f8:
+if (s0 >= t2) {
+at = s0 < t2;
+goto L405930;}
+at = s0 < t2;
+v1 = MEM_U8(s0 + 0);
+at = 0x2b;
+if (v1 == at) {
+at = 0x2d;
+goto L40591c;}
+at = 0x2d;
+if (v1 != at) {
+at = s0 < t2;
+goto L405930;}
+at = s0 < t2;
+L40591c:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+L40592c:
+at = s0 < t2;
+L405930:
+//nop;
+if (at != 0) goto L405894;
+v1 = MEM_U8(s0 + 0);
+goto L406168;
+L405940:
+t5 = MEM_U32(sp + 148);
+L405944:
+fp = fp + 0x1;
+t8 = t5 << 2;
+t9 = t8 + s3;
+MEM_U32(sp + 148) = t9;
+goto L406164;
+L405958:
+t6 = MEM_U32(s4 + 24);
+//nop;
+//nop;
+if (t6 == 0) goto L405a44;
+v1 = MEM_U8(s0 + 0);
+at = 0x2d;
+//nop;
+if (v1 != at) goto L4059a8;
+t4 = MEM_U32(sp + 164);
+fp = zero;
+MEM_U32(sp + 148) = zero;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (t4 != 0) goto L405998;
+s1 = s1 + 0xffffffff;
+goto L406164;
+L405998:
+t7 = 0x2d;
+MEM_U8(s1 + 0) = (uint8_t)t7;
+s1 = s1 + 0x1;
+goto L406164;
+L4059a8:
+t5 = 0x10006290;
+//nop;
+t8 = v1 + t5;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L405a1c;
+t6 = 0x1;
+if ((int)fp <= 0) goto L4059d4;
+MEM_U32(sp + 128) = t6;
+goto L405c8c;
+L4059d4:
+t4 = MEM_U32(sp + 164);
+t7 = v1 & 0xff;
+//nop;
+if (t4 != 0) goto L405a08;
+MEM_U8(s1 + -1) = (uint8_t)v1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s5 != t7) goto L406164;
+t5 = MEM_U32(s6 + 4);
+//nop;
+t8 = t5 + 0x1;
+MEM_U32(s6 + 4) = t8;
+goto L406164;
+L405a08:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L406164;
+L405a1c:
+//nop;
+MEM_U32(sp + 136) = t2;
+//nop;
+wrapper_abort(mem);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+goto L406164;
+L405a44:
+t9 = 0x1;
+if ((int)fp <= 0) goto L405a54;
+MEM_U32(sp + 128) = t9;
+goto L405c8c;
+L405a54:
+MEM_U32(sp + 116) = s0;
+t6 = MEM_U32(s4 + 4);
+a0 = s4;
+t4 = t6 + 0x1;
+MEM_U32(s4 + 4) = t4;
+t7 = MEM_U32(s6 + 4);
+a1 = s6;
+t5 = t7 + 0x1;
+MEM_U32(s6 + 4) = t5;
+t9 = MEM_U32(s4 + 4);
+a2 = 0x1;
+//nop;
+if (t5 == t9) goto L406164;
+MEM_U32(s6 + 20) = s1;
+//nop;
+MEM_U32(sp + 136) = t2;
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U32(s4 + 20);
+t4 = MEM_U32(s4 + 16);
+v1 = MEM_U32(s6 + 20);
+t9 = MEM_U32(s6 + 16);
+t7 = t6 - t4;
+t5 = MEM_U32(s4 + 8);
+t8 = MEM_U32(s6 + 8);
+t6 = v1 - t9;
+a1 = t5 - t7;
+t4 = t8 - t6;
+// bdead c0ea21d3 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+at = (int)a1 < (int)t4;
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+if (at != 0) goto L405b08;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+v1 = MEM_U32(s6 + 20);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405b08:
+s1 = v1;
+goto L406164;
+L405b10:
+//nop;
+if (t2 >= s0) goto L405c98;
+v0 = MEM_U32(s4 + 24);
+//nop;
+//nop;
+if (v0 == 0) goto L405c68;
+t5 = 0x10002d3c;
+s1 = s1 + 0xffffffff;
+t5 = MEM_U32(t5 + 0);
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+if (t5 == 0) goto L405b98;
+//nop;
+if (fp == 0) goto L405b98;
+t7 = 0x10000030;
+t8 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t9 = t7 << 3;
+t9 = t9 + t7;
+t9 = t9 << 2;
+t6 = t9 + t8;
+t4 = MEM_U32(t6 + -16);
+t7 = 0x10005f90;
+t5 = MEM_U8(t4 + 0);
+t6 = 0x1;
+t9 = t5 + t7;
+t8 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L405b98;
+MEM_U32(sp + 128) = t6;
+goto L405c98;
+L405b98:
+MEM_U32(sp + 116) = zero;
+t4 = 0x17;
+MEM_U32(v0 + 12) = t4;
+a0 = MEM_U32(s4 + 32);
+//nop;
+//nop;
+if (a0 == 0) goto L405bd4;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c0c40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405bd4:
+t5 = 0x10000030;
+at = 0x10000030;
+t5 = MEM_U32(t5 + 0);
+t9 = 0x10000030;
+t7 = t5 + 0xffffffff;
+MEM_U32(at + 0) = t7;
+t9 = MEM_U32(t9 + 0);
+t6 = 0x10002d50;
+t8 = t9 << 3;
+t8 = t8 + t9;
+t8 = t8 << 2;
+s4 = t8 + t6;
+t4 = MEM_U32(s4 + 16);
+t5 = MEM_U32(s4 + 8);
+t9 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t7 = MEM_U32(s6 + 8);
+t2 = t4 + t5;
+t8 = s1 - t9;
+s2 = t2 - s0;
+t6 = t7 - t8;
+at = (int)s2 < (int)t6;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405c5c;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405c5c:
+s1 = MEM_U32(s6 + 20);
+v1 = MEM_U8(s0 + 0);
+goto L406168;
+L405c68:
+t4 = 0x1;
+if (fp != 0) goto L405c88;
+s1 = s1 + 0xffffffff;
+s0 = s0 + 0xffffffff;
+MEM_U32(s6 + 20) = s1;
+MEM_U32(s4 + 20) = s0;
+goto L406170;
+t4 = 0x1;
+L405c88:
+MEM_U32(sp + 128) = t4;
+L405c8c:
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+s1 = s1 + 0xffffffff;
+L405c98:
+at = 0x7fff0000;
+if ((int)fp <= 0) goto L406164;
+t5 = MEM_U32(sp + 148);
+at = at | 0xffff;
+t9 = t5 & at;
+at = 0x57b;
+lo = (int)t9 / (int)at; hi = (int)t9 % (int)at;
+t6 = 0x100049a0;
+t7 = hi;
+t8 = t7 << 2;
+t4 = t8 + t6;
+s7 = MEM_U32(t4 + 0);
+MEM_U32(sp + 148) = zero;
+//nop;
+if (s7 == 0) goto L40615c;
+L405cd4:
+t5 = MEM_U32(s7 + 16);
+v1 = fp;
+a3 = s1 - fp;
+if (fp != t5) goto L40614c;
+t9 = MEM_U32(sp + 128);
+a0 = MEM_U32(s7 + 20);
+a2 = a3;
+v0 = a3;
+if (t9 != 0) goto L405cfc;
+v0 = a2 + 0xffffffff;
+L405cfc:
+t7 = MEM_U8(a0 + 0);
+t8 = MEM_U8(v0 + 0);
+a0 = a0 + 0x1;
+v0 = v0 + 0x1;
+if (t7 != t8) goto L40614c;
+v1 = v1 + 0xffffffff;
+//nop;
+if (v1 != 0) goto L405cfc;
+t6 = MEM_U32(sp + 128);
+at = 0x17;
+//nop;
+if (t6 != 0) goto L405d3c;
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+s1 = s1 + 0xffffffff;
+a2 = a3 + 0xffffffff;
+L405d3c:
+t4 = MEM_U32(s6 + 4);
+t5 = MEM_U32(sp + 164);
+MEM_U32(sp + 92) = t4;
+v1 = MEM_U32(s7 + 12);
+fp = a2;
+a0 = v1 ^ 0x18;
+a0 = a0 < 0x1;
+// bdead c1ee5fb7 v0 = a0;
+if (a0 == 0) goto L405dc0;
+a1 = s2 + 0x2;
+if (t5 == 0) goto L40615c;
+t9 = MEM_U32(s6 + 20);
+t7 = MEM_U32(s6 + 16);
+t6 = MEM_U32(s6 + 8);
+t8 = t9 - t7;
+t4 = t6 - t8;
+t5 = 0x2d;
+if ((int)a1 < (int)t4) goto L405db0;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40ee0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+t5 = 0x2d;
+L405db0:
+MEM_U8(s1 + 0) = (uint8_t)s5;
+MEM_U8(s1 + 1) = (uint8_t)t5;
+s1 = s1 + 0x2;
+goto L40615c;
+L405dc0:
+//nop;
+if (v1 == at) goto L405dd0;
+t5 = MEM_U32(sp + 92);
+if (a0 == 0) goto L406098;
+L405dd0:
+t9 = MEM_U32(s7 + 24);
+//nop;
+t7 = MEM_U32(t9 + 0);
+//nop;
+t5 = MEM_U32(sp + 92);
+if ((int)t7 < 0) goto L406098;
+L405de8:
+//nop;
+if (s0 != t2) goto L405ed8;
+L405df0:
+v0 = MEM_U32(s4 + 24);
+t6 = 0x17;
+//nop;
+if (v0 == 0) goto L405ed8;
+MEM_U32(sp + 116) = zero;
+MEM_U32(v0 + 12) = t6;
+a0 = MEM_U32(s4 + 32);
+s3 = s1;
+//nop;
+if (a0 == 0) goto L405e38;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c1d40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405e38:
+v0 = 0x10000030;
+t5 = 0x10000030;
+t8 = MEM_U32(v0 + 0);
+t7 = 0x10002d50;
+t4 = t8 + 0xffffffff;
+MEM_U32(v0 + 0) = t4;
+t5 = MEM_U32(t5 + 0);
+t4 = MEM_U32(s6 + 8);
+t9 = t5 << 3;
+t9 = t9 + t5;
+t9 = t9 << 2;
+s4 = t9 + t7;
+t6 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t6 + t8;
+t9 = s1 - t5;
+t7 = t4 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t7;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405ebc;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405ebc:
+s1 = MEM_U32(s6 + 20);
+//nop;
+//nop;
+if (s1 == s3) goto L405de8;
+fp = fp - s3;
+fp = fp + s1;
+if (s0 == t2) goto L405df0;
+L405ed8:
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (t0 != v1) goto L405fb4;
+v0 = t2 + 0xffffffff;
+//nop;
+if (s0 == v0) goto L405fb4;
+t6 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (t1 != t6) goto L405fb4;
+s0 = s0 + 0x2;
+MEM_U8(s1 + 0) = (uint8_t)t0;
+MEM_U8(s1 + 1) = (uint8_t)t1;
+s1 = s1 + 0x2;
+s2 = s2 + 0xfffffffe;
+if (s0 == v0) goto L405f9c;
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (t1 != v1) goto L405f3c;
+t8 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (t0 == t8) goto L405f9c;
+L405f3c:
+s2 = s2 + 0xffffffff;
+if (s5 != v1) goto L405f6c;
+t5 = MEM_U32(s4 + 4);
+//nop;
+t4 = t5 + 0x1;
+MEM_U32(s4 + 4) = t4;
+t9 = MEM_U32(s6 + 4);
+//nop;
+t7 = t9 + 0x1;
+MEM_U32(s6 + 4) = t7;
+v1 = MEM_U8(s0 + 0);
+//nop;
+L405f6c:
+s0 = s0 + 0x1;
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+if (s0 == v0) goto L405f9c;
+v1 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (t1 != v1) goto L405f3c;
+t6 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (t0 != t6) goto L405f3c;
+L405f9c:
+s0 = s0 + 0x2;
+s2 = s2 + 0xfffffffe;
+MEM_U8(s1 + 0) = (uint8_t)t1;
+MEM_U8(s1 + 1) = (uint8_t)t0;
+s1 = s1 + 0x2;
+goto L405de8;
+L405fb4:
+t8 = 0x10006290;
+//nop;
+t5 = v1 + t8;
+t4 = MEM_U8(t5 + 0);
+//nop;
+at = 0x28;
+if (t4 == 0) goto L40608c;
+MEM_U8(s1 + 0) = (uint8_t)v1;
+t9 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s5 != t9) goto L405de8;
+t7 = MEM_U32(s4 + 24);
+t9 = MEM_U32(sp + 164);
+//nop;
+if (t7 != 0) goto L40601c;
+t6 = MEM_U32(s4 + 4);
+//nop;
+t8 = t6 + 0x1;
+MEM_U32(s4 + 4) = t8;
+t5 = MEM_U32(s6 + 4);
+//nop;
+t4 = t5 + 0x1;
+MEM_U32(s6 + 4) = t4;
+goto L405de8;
+L40601c:
+//nop;
+if (t9 != 0) goto L406070;
+v1 = MEM_U8(s0 + 0);
+at = 0x2d;
+s1 = s1 + 0xffffffff;
+if (v1 != at) goto L406040;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L405de8;
+L406040:
+s2 = s2 + 0xffffffff;
+if (s5 != v1) goto L406060;
+t7 = MEM_U32(s6 + 4);
+//nop;
+t6 = t7 + 0x1;
+MEM_U32(s6 + 4) = t6;
+v1 = MEM_U8(s0 + 0);
+//nop;
+L406060:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+goto L405de8;
+L406070:
+t8 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U8(s1 + -1) = (uint8_t)t8;
+goto L405de8;
+at = 0x28;
+L40608c:
+//nop;
+if (v1 != at) goto L40615c;
+t5 = MEM_U32(sp + 92);
+L406098:
+a0 = s7;
+MEM_U32(s6 + 4) = t5;
+MEM_U32(s4 + 20) = s0;
+MEM_U32(s6 + 20) = fp;
+//nop;
+MEM_U32(sp + 116) = zero;
+a1 = s6;
+f_macroexpand(mem, sp, a0, a1);
+// bdead 40c00183 gp = MEM_U32(sp + 52);
+s1 = MEM_U32(s6 + 20);
+t4 = 0x10000030;
+t7 = 0x10002d50;
+t4 = MEM_U32(t4 + 0);
+t5 = MEM_U32(s6 + 8);
+t9 = t4 << 3;
+t9 = t9 + t4;
+t9 = t9 << 2;
+s4 = t9 + t7;
+t6 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t4 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t6 + t8;
+t9 = s1 - t4;
+t7 = t5 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t7;
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L406140;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40ea0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L406140:
+s1 = MEM_U32(s6 + 20);
+fp = zero;
+goto L406160;
+L40614c:
+s7 = MEM_U32(s7 + 0);
+//nop;
+//nop;
+if (s7 != 0) goto L405cd4;
+L40615c:
+fp = zero;
+L406160:
+MEM_U32(sp + 128) = zero;
+L406164:
+v1 = MEM_U8(s0 + 0);
+L406168:
+s3 = v1 & 0xff;
+goto L404e3c;
+L406170:
+s0 = 0x100001b4;
+v1 = MEM_U32(s4 + 28);
+v0 = MEM_U32(s0 + 0);
+//nop;
+// bdead 40220019 ra = MEM_U32(sp + 60);
+if (v0 == v1) goto L40625c;
+t6 = MEM_U32(v0 + 16);
+//nop;
+t8 = t6 + 0xfffffffd;
+//nop;
+if (t8 >= 0x6) goto L406220;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L4061d4;
+case 1: goto L4061e8;
+case 2: goto L4061c0;
+case 3: goto L4061fc;
+case 4: goto L406220;
+case 5: goto L406210;
+}
+L4061c0:
+t4 = 0x10000f58;
+//nop;
+t4 = t4;
+MEM_U32(sp + 68) = t4;
+goto L406220;
+L4061d4:
+t5 = 0x10000f5c;
+//nop;
+t5 = t5;
+MEM_U32(sp + 68) = t5;
+goto L406220;
+L4061e8:
+t9 = 0x10000f64;
+//nop;
+t9 = t9;
+MEM_U32(sp + 68) = t9;
+goto L406220;
+L4061fc:
+t7 = 0x10000f6c;
+//nop;
+t7 = t7;
+MEM_U32(sp + 68) = t7;
+goto L406220;
+L406210:
+t6 = 0x10000f74;
+//nop;
+t6 = t6;
+MEM_U32(sp + 68) = t6;
+L406220:
+//nop;
+a0 = MEM_U32(v0 + 8);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40220109 gp = MEM_U32(sp + 52);
+a2 = MEM_U32(sp + 68);
+a1 = 0x10000f7c;
+//nop;
+a0 = v0;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 220001 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s4 + 28);
+//nop;
+// bdead 20011 ra = MEM_U32(sp + 60);
+L40625c:
+MEM_U32(s0 + 0) = v1;
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0xa0;
+return;
+}
+
+static void f_expand_to_temp_buffer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40628c:
+//expand_to_temp_buffer:
+//nop;
+//nop;
+//nop;
+t3 = 0x10000030;
+sp = sp + 0xffffff90;
+t6 = MEM_U32(t3 + 0);
+t1 = a2 - a1;
+// fdead 400095eb MEM_U32(sp + 28) = ra;
+// fdead 400095eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 112) = a0;
+MEM_U32(sp + 124) = a3;
+t0 = t1;
+MEM_U32(sp + 60) = t6;
+if ((int)t1 >= 0) goto L4062f4;
+//nop;
+MEM_U32(sp + 116) = a1;
+MEM_U32(sp + 120) = a2;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+wrapper_abort(mem);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 116);
+a2 = MEM_U32(sp + 120);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+//nop;
+L4062f4:
+//nop;
+a0 = t0 + 0x1;
+MEM_U32(sp + 116) = a1;
+MEM_U32(sp + 120) = a2;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+v0 = f_alloca(mem, sp, a0);
+a1 = MEM_U32(sp + 116);
+a2 = MEM_U32(sp + 120);
+// bdead 400000cb gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = v0;
+v1 = v0;
+a0 = a1;
+if (a1 == a2) goto L40638c;
+a3 = t1 & 0x3;
+v0 = a3 + a1;
+if (a3 == 0) goto L40635c;
+L406340:
+t7 = MEM_U8(a0 + 0);
+a0 = a0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t7;
+if (v0 != a0) goto L406340;
+t6 = t2 + t0;
+if (a0 == a2) goto L406390;
+L40635c:
+t8 = MEM_U8(a0 + 0);
+a0 = a0 + 0x4;
+MEM_U8(v1 + 0) = (uint8_t)t8;
+t9 = MEM_U8(a0 + -3);
+v1 = v1 + 0x4;
+MEM_U8(v1 + -3) = (uint8_t)t9;
+t4 = MEM_U8(a0 + -2);
+//nop;
+MEM_U8(v1 + -2) = (uint8_t)t4;
+t5 = MEM_U8(a0 + -1);
+MEM_U8(v1 + -1) = (uint8_t)t5;
+if (a0 != a2) goto L40635c;
+L40638c:
+t6 = t2 + t0;
+L406390:
+MEM_U8(t6 + 0) = (uint8_t)zero;
+//nop;
+t7 = t0 << 1;
+a0 = t7 + 0x64;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = t2;
+MEM_U32(sp + 36) = t0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 36);
+t3 = 0x10000030;
+t2 = MEM_U32(sp + 64);
+v1 = MEM_U32(t3 + 0);
+MEM_U32(sp + 88) = v0;
+at = (int)v1 < (int)0xc7;
+MEM_U32(sp + 92) = v0;
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 96) = zero;
+MEM_U32(sp + 104) = zero;
+if (at != 0) goto L406460;
+t9 = v1 << 3;
+t4 = 0x10002d50;
+t9 = t9 + v1;
+t9 = t9 << 2;
+t5 = t9 + t4;
+//nop;
+a0 = MEM_U32(t5 + 4);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+a0 = v0;
+a1 = 0x10000f9c;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 112);
+t6 = sp + 0x48;
+// bdead 8011 gp = MEM_U32(sp + 24);
+t8 = t6 + 0x24;
+t9 = v1;
+L406434:
+at = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+MEM_U32(t9 + 0) = at;
+at = MEM_U32(t6 + -8);
+t9 = t9 + 0xc;
+MEM_U32(t9 + -8) = at;
+at = MEM_U32(t6 + -4);
+MEM_U32(t9 + -4) = at;
+if (t6 != t8) goto L406434;
+// bdead 1 v0 = v1;
+goto L406548;
+L406460:
+t4 = v1 + 0x1;
+t7 = t4 << 3;
+t8 = 0x10002d50;
+t7 = t7 + t4;
+t7 = t7 << 2;
+MEM_U32(t3 + 0) = t4;
+v0 = t7 + t8;
+t6 = 0x100001b4;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 24) = zero;
+MEM_U32(v0 + 32) = zero;
+MEM_U32(v0 + 8) = t0;
+MEM_U32(v0 + 20) = t2;
+MEM_U32(v0 + 16) = t2;
+t6 = MEM_U32(t6 + 0);
+t9 = 0x1;
+MEM_U32(v0 + 28) = t6;
+MEM_U32(sp + 76) = t9;
+t4 = 0x1;
+MEM_U32(v0 + 4) = t4;
+//nop;
+a1 = MEM_U32(sp + 124);
+a0 = sp + 0x48;
+f_rescan(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 60);
+t3 = 0x10000030;
+//nop;
+t5 = MEM_U32(t3 + 0);
+//nop;
+t7 = t5 + 0xffffffff;
+MEM_U32(t3 + 0) = t7;
+if (t8 == t7) goto L406500;
+//nop;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L406500:
+t9 = MEM_U32(sp + 92);
+t4 = MEM_U32(sp + 88);
+t8 = sp + 0x48;
+t5 = t9 - t4;
+t7 = MEM_U32(sp + 112);
+MEM_U32(sp + 80) = t5;
+t4 = t8 + 0x24;
+L40651c:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t7 + 0) = at;
+at = MEM_U32(t8 + -8);
+t7 = t7 + 0xc;
+MEM_U32(t7 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t7 + -4) = at;
+if (t8 != t4) goto L40651c;
+// bdead 1 v0 = MEM_U32(sp + 112);
+//nop;
+L406548:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x70;
+//nop;
+return;
+}
+
+static uint32_t f_handle_directive(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0, fp_dest;
+uint64_t temp64;
+L406558:
+//handle_directive:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff60;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 164) = a1;
+MEM_U32(sp + 136) = zero;
+s1 = MEM_U32(a0 + 20);
+s3 = 0x10006190;
+s4 = a0;
+s6 = 0xa;
+L4065ac:
+v1 = MEM_U8(s1 + 0);
+L4065b0:
+at = 0x2f;
+t6 = s3 + v1;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L4065d0;
+s1 = s1 + 0x1;
+goto L4065ac;
+L4065d0:
+if (v1 != at) {
+at = 0x5c;
+goto L406610;}
+at = 0x5c;
+t8 = MEM_U8(s1 + 1);
+at = 0x2a;
+if (t8 != at) {
+at = 0x5c;
+goto L406610;}
+at = 0x5c;
+MEM_U32(s4 + 20) = s1;
+//nop;
+a0 = s4;
+a1 = s4 + 0x4;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40b00143 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(s4 + 20);
+v1 = MEM_U8(s1 + 0);
+goto L4065b0;
+at = 0x5c;
+L406610:
+//nop;
+if (v1 != at) goto L40663c;
+t9 = MEM_U8(s1 + 1);
+//nop;
+//nop;
+if (s6 != t9) goto L40663c;
+t1 = MEM_U32(s4 + 4);
+s1 = s1 + 0x2;
+t2 = t1 + 0x1;
+MEM_U32(s4 + 4) = t2;
+goto L4065ac;
+L40663c:
+s2 = 0x10005f90;
+s0 = s1;
+L406644:
+a0 = MEM_U8(s0 + 0);
+at = 0x5c;
+t3 = s2 + a0;
+v1 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L406668;
+s0 = s0 + 0x1;
+goto L406644;
+L406668:
+//nop;
+if (a0 != at) goto L4066a4;
+t4 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s6 != t4) goto L4066a4;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_name_newline_fix(mem, sp, a0);
+a0 = MEM_U8(s0 + 0);
+// bdead 40be0163 gp = MEM_U32(sp + 60);
+t5 = s2 + a0;
+v1 = MEM_U8(t5 + 0);
+//nop;
+L4066a4:
+//nop;
+if (v1 == 0) goto L4066b4;
+s0 = s0 + 0x1;
+goto L406644;
+L4066b4:
+t6 = 0x10002d3c;
+a2 = s0 - s1;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L4066e4;
+//nop;
+if (s0 != s1) goto L4066e4;
+v0 = 0x1;
+if (s6 != a0) goto L4066e4;
+MEM_U32(s4 + 20) = s0;
+goto L406f10;
+L4066e4:
+//nop;
+if (a2 != 0) goto L4066fc;
+v0 = 0x1;
+if (s6 != a0) goto L4066fc;
+MEM_U32(s4 + 20) = s0;
+goto L406f10;
+L4066fc:
+v0 = 0x10000080;
+//nop;
+t8 = MEM_U32(v0 + 0);
+s7 = v0;
+//nop;
+if ((int)t8 <= 0) goto L406ec0;
+// bdead 43b60183 t9 = v0;
+v0 = t8;
+L40671c:
+a1 = s1;
+if (a2 != v0) goto L406eb0;
+//nop;
+a0 = MEM_U32(s7 + 8);
+MEM_U32(sp + 72) = a2;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 60041b6014b gp = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 72);
+//nop;
+if (v0 != 0) goto L406eb0;
+v0 = 0x10002d3c;
+t1 = MEM_U32(s4 + 16);
+v0 = MEM_U32(v0 + 0);
+t2 = MEM_U32(s4 + 8);
+t3 = zero < v0;
+MEM_U32(sp + 116) = zero;
+v0 = t3;
+fp = t1 + t2;
+if (t3 == 0) goto L406778;
+v0 = MEM_U8(s7 + 17);
+//nop;
+t4 = zero < v0;
+v0 = t4;
+L406778:
+at = s0 < fp;
+MEM_U32(sp + 112) = v0;
+s1 = s0;
+s5 = s0;
+if (at == 0) goto L4069b8;
+s2 = 0x3e;
+L406790:
+v0 = MEM_U8(s1 + 0);
+s1 = s1 + 0x1;
+t5 = v0 + 0xfffffff6;
+if (v0 < 0x3d) goto L4067b8;
+at = 0x5c;
+if (v0 == at) {
+at = s1 < fp;
+goto L4067e8;}
+at = s1 < fp;
+at = s1 < fp;
+goto L4069b0;
+L4067b8:
+if (t5 >= 0x33) {
+at = s1 < fp;
+goto L4069b0;}
+at = s1 < fp;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L40699c;
+case 1: goto L4069ac;
+case 2: goto L4069ac;
+case 3: goto L4069ac;
+case 4: goto L4069ac;
+case 5: goto L4069ac;
+case 6: goto L4069ac;
+case 7: goto L4069ac;
+case 8: goto L4069ac;
+case 9: goto L4069ac;
+case 10: goto L4069ac;
+case 11: goto L4069ac;
+case 12: goto L4069ac;
+case 13: goto L4069ac;
+case 14: goto L4069ac;
+case 15: goto L4069ac;
+case 16: goto L4069ac;
+case 17: goto L4069ac;
+case 18: goto L4069ac;
+case 19: goto L4069ac;
+case 20: goto L4069ac;
+case 21: goto L4069ac;
+case 22: goto L4069ac;
+case 23: goto L4069ac;
+case 24: goto L40681c;
+case 25: goto L4069ac;
+case 26: goto L4069ac;
+case 27: goto L4069ac;
+case 28: goto L4069ac;
+case 29: goto L40681c;
+case 30: goto L4069ac;
+case 31: goto L4069ac;
+case 32: goto L4069ac;
+case 33: goto L4069ac;
+case 34: goto L4069ac;
+case 35: goto L4069ac;
+case 36: goto L4069ac;
+case 37: goto L4068d0;
+case 38: goto L4069ac;
+case 39: goto L4069ac;
+case 40: goto L4069ac;
+case 41: goto L4069ac;
+case 42: goto L4069ac;
+case 43: goto L4069ac;
+case 44: goto L4069ac;
+case 45: goto L4069ac;
+case 46: goto L4069ac;
+case 47: goto L4069ac;
+case 48: goto L4069ac;
+case 49: goto L4069ac;
+case 50: goto L406888;
+}
+// fdead 0 at = s1 < fp;
+L4067e8:
+if (at == 0) {
+at = s1 < fp;
+goto L4069b0;}
+at = s1 < fp;
+t6 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s6 != t6) goto L406814;
+t7 = MEM_U32(s4 + 4);
+t9 = 0x1;
+t8 = t7 + 0x1;
+MEM_U32(s4 + 4) = t8;
+MEM_U32(sp + 136) = t9;
+L406814:
+s1 = s1 + 0x1;
+goto L4069ac;
+L40681c:
+//nop;
+a2 = MEM_U32(s4 + 4);
+t1 = sp + 0x88;
+t2 = sp + 0x74;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a0 = s1 + 0xffffffff;
+a1 = fp;
+a3 = s4 + 0x4;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U32(sp + 116);
+// bdead 600c1fa100b gp = MEM_U32(sp + 60);
+s1 = v0;
+if (t3 == 0) goto L4069ac;
+t4 = 0x10002d3c;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40687c;
+s1 = v0 + 0xffffffff;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+goto L4069c4;
+L40687c:
+MEM_U32(s4 + 20) = s1;
+v0 = 0x1;
+goto L406f10;
+L406888:
+t5 = MEM_U8(s7 + 16);
+//nop;
+at = s1 < fp;
+if (t5 == 0) goto L4069b0;
+v1 = MEM_U8(s1 + 0);
+//nop;
+at = s1 < fp;
+if (v1 == 0) goto L4069b0;
+at = s1 < fp;
+if (s2 == v1) goto L4069b0;
+L4068b0:
+v1 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+at = s1 < fp;
+if (v1 == 0) goto L4069b0;
+//nop;
+if (s2 != v1) goto L4068b0;
+at = s1 < fp;
+goto L4069b0;
+L4068d0:
+v1 = MEM_U8(s1 + 0);
+at = 0x5c;
+if (v1 != at) {
+at = 0x2a;
+goto L406910;}
+at = 0x2a;
+t6 = MEM_U8(s1 + 1);
+//nop;
+at = 0x2a;
+if (s6 != t6) goto L406910;
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600c1fe0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s1 + 0);
+//nop;
+at = 0x2a;
+L406910:
+t8 = s1 + 0xffffffff;
+if (v1 == at) goto L406938;
+t7 = 0x10002d10;
+at = 0x2f;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L4069ac;
+if (v1 != at) {
+at = s1 < fp;
+goto L4069b0;}
+at = s1 < fp;
+L406938:
+MEM_U32(sp + 104) = t8;
+t9 = s1 + 0x1;
+MEM_U32(s4 + 20) = t9;
+//nop;
+a0 = s4;
+a1 = s4 + 0x4;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(s4 + 20);
+// bdead 600c1fa0013 gp = MEM_U32(sp + 60);
+s1 = v1;
+if (v1 == fp) goto L406974;
+t1 = MEM_U8(s1 + 0);
+t2 = MEM_U32(sp + 112);
+//nop;
+if (s6 != t1) goto L406980;
+L406974:
+s1 = MEM_U32(sp + 104);
+t5 = MEM_U32(sp + 136);
+goto L4069c8;
+L406980:
+at = s1 < fp;
+if (t2 != 0) goto L4069b0;
+t3 = MEM_U32(sp + 136);
+//nop;
+t4 = t3 + 0x1;
+MEM_U32(sp + 136) = t4;
+goto L4069ac;
+L40699c:
+s1 = s1 + 0xffffffff;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+goto L4069c4;
+L4069ac:
+at = s1 < fp;
+L4069b0:
+//nop;
+if (at != 0) goto L406790;
+L4069b8:
+s2 = 0x3e;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+L4069c4:
+t5 = MEM_U32(sp + 136);
+L4069c8:
+MEM_U32(sp + 140) = v1;
+a0 = s1 - s0;
+if (t5 == 0) goto L406d20;
+//nop;
+a0 = a0 + 0x5;
+MEM_U32(sp + 100) = s0;
+v0 = f_alloca(mem, sp, a0);
+v1 = MEM_U32(sp + 100);
+// bdead 600c1bc001b gp = MEM_U32(sp + 60);
+at = v1 < s1;
+s0 = v0;
+s5 = v0;
+if (at == 0) goto L406d18;
+t0 = 0x10006290;
+//nop;
+L406a04:
+v0 = MEM_U8(v1 + 0);
+v1 = v1 + 0x1;
+at = v0 < 0x3d;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+if (at != 0) goto L406a30;
+at = 0x5c;
+//nop;
+if (v0 == at) goto L406aa8;
+at = v1 < s1;
+goto L406d10;
+L406a30:
+t6 = v0 + 0xfffffff6;
+a0 = v0;
+if (t6 >= 0x33) goto L406d0c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L406d0c;
+case 1: goto L406d0c;
+case 2: goto L406d0c;
+case 3: goto L406d0c;
+case 4: goto L406d0c;
+case 5: goto L406d0c;
+case 6: goto L406d0c;
+case 7: goto L406d0c;
+case 8: goto L406d0c;
+case 9: goto L406d0c;
+case 10: goto L406d0c;
+case 11: goto L406d0c;
+case 12: goto L406d0c;
+case 13: goto L406d0c;
+case 14: goto L406d0c;
+case 15: goto L406d0c;
+case 16: goto L406d0c;
+case 17: goto L406d0c;
+case 18: goto L406d0c;
+case 19: goto L406d0c;
+case 20: goto L406d0c;
+case 21: goto L406d0c;
+case 22: goto L406d0c;
+case 23: goto L406d0c;
+case 24: goto L406bdc;
+case 25: goto L406d0c;
+case 26: goto L406d0c;
+case 27: goto L406d0c;
+case 28: goto L406d0c;
+case 29: goto L406bdc;
+case 30: goto L406d0c;
+case 31: goto L406d0c;
+case 32: goto L406d0c;
+case 33: goto L406d0c;
+case 34: goto L406d0c;
+case 35: goto L406d0c;
+case 36: goto L406d0c;
+case 37: goto L406c84;
+case 38: goto L406d0c;
+case 39: goto L406d0c;
+case 40: goto L406d0c;
+case 41: goto L406d0c;
+case 42: goto L406d0c;
+case 43: goto L406d0c;
+case 44: goto L406d0c;
+case 45: goto L406d0c;
+case 46: goto L406d0c;
+case 47: goto L406d0c;
+case 48: goto L406d0c;
+case 49: goto L406d0c;
+case 50: goto L406a60;
+}
+L406a60:
+t7 = MEM_U8(s7 + 16);
+at = v1 < s1;
+//nop;
+if (t7 == 0) goto L406d0c;
+if (at == 0) {
+at = 0x3e;
+goto L406d0c;}
+at = 0x3e;
+if (a0 == at) {
+at = v1 < s1;
+goto L406d10;}
+at = v1 < s1;
+L406a80:
+v0 = MEM_U8(v1 + 0);
+v1 = v1 + 0x1;
+at = v1 < s1;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+if (at == 0) goto L406d0c;
+//nop;
+if (v0 != s2) goto L406a80;
+at = v1 < s1;
+goto L406d10;
+L406aa8:
+t8 = MEM_U8(v1 + 0);
+//nop;
+at = v1 < s1;
+if (s6 != t8) goto L406d10;
+t9 = 0x10000024;
+v1 = v1 + 0x1;
+t9 = MEM_U32(t9 + 0);
+s0 = s0 + 0xffffffff;
+//nop;
+if (t9 == 0) goto L406ae0;
+MEM_U8(s0 + 0) = (uint8_t)s6;
+MEM_U8(s0 + 1) = (uint8_t)s6;
+s0 = s0 + 0x2;
+goto L406d0c;
+L406ae0:
+//nop;
+if (s0 == s5) goto L406b7c;
+t1 = MEM_U8(s0 + -1);
+//nop;
+t2 = t0 + t1;
+v0 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L406b7c;
+//nop;
+if (s0 == s5) goto L406b3c;
+//nop;
+if (v0 == 0) goto L406b3c;
+L406b14:
+s0 = s0 + 0xffffffff;
+//nop;
+if (s0 == s5) goto L406b3c;
+t3 = MEM_U8(s0 + -1);
+//nop;
+t4 = t0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L406b14;
+L406b3c:
+t6 = MEM_U8(v1 + 0);
+s0 = s0 + 0x1;
+t7 = s3 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+at = v1 < s1;
+if (t8 == 0) goto L406d10;
+L406b58:
+t9 = MEM_U8(v1 + 1);
+v1 = v1 + 0x1;
+t1 = s3 + t9;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L406b58;
+at = v1 < s1;
+goto L406d10;
+L406b7c:
+v0 = MEM_U8(v1 + 0);
+//nop;
+t3 = t0 + v0;
+t4 = MEM_U8(t3 + 0);
+//nop;
+at = v1 < s1;
+if (t4 == 0) goto L406d10;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+t5 = MEM_U8(v1 + 1);
+s0 = s0 + 0x1;
+t6 = s3 + t5;
+t7 = MEM_U8(t6 + 0);
+v1 = v1 + 0x1;
+at = v1 < s1;
+if (t7 == 0) goto L406d10;
+L406bb8:
+t8 = MEM_U8(v1 + 1);
+v1 = v1 + 0x1;
+t9 = s3 + t8;
+t1 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L406bb8;
+at = v1 < s1;
+goto L406d10;
+L406bdc:
+t2 = 0x10002d3c;
+a0 = v1 + 0xffffffff;
+t2 = MEM_U32(t2 + 0);
+a1 = fp;
+a3 = zero;
+if (t2 != 0) goto L406d0c;
+a2 = MEM_U32(s4 + 4);
+//nop;
+MEM_U32(sp + 100) = v1;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = zero;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600c1fe000b gp = MEM_U32(sp + 60);
+v1 = MEM_U32(sp + 100);
+t0 = 0x10006290;
+a1 = v0;
+if (v1 == v0) goto L406d0c;
+a2 = v0 - v1;
+t3 = a2 & 0x3;
+a0 = t3 + v1;
+if (t3 == 0) goto L406c4c;
+L406c30:
+t4 = MEM_U8(v1 + 0);
+v1 = v1 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)t4;
+if (a0 != v1) goto L406c30;
+at = v1 < s1;
+if (v1 == v0) goto L406d10;
+L406c4c:
+t5 = MEM_U8(v1 + 0);
+v1 = v1 + 0x4;
+MEM_U8(s0 + 0) = (uint8_t)t5;
+t6 = MEM_U8(v1 + -3);
+s0 = s0 + 0x4;
+MEM_U8(s0 + -3) = (uint8_t)t6;
+t7 = MEM_U8(v1 + -2);
+//nop;
+MEM_U8(s0 + -2) = (uint8_t)t7;
+t8 = MEM_U8(v1 + -1);
+MEM_U8(s0 + -1) = (uint8_t)t8;
+if (v1 != a1) goto L406c4c;
+at = v1 < s1;
+goto L406d10;
+L406c84:
+t9 = MEM_U32(sp + 112);
+//nop;
+at = v1 < s1;
+if (t9 != 0) goto L406d10;
+v0 = MEM_U8(v1 + 0);
+at = 0x2a;
+t4 = v1 + 0x1;
+if (v0 == at) goto L406cc4;
+t1 = 0x10002d10;
+at = 0x2f;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L406d0c;
+if (v0 != at) {
+at = v1 < s1;
+goto L406d10;}
+at = v1 < s1;
+L406cc4:
+t2 = 0x10002d3c;
+t3 = 0x20;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L406ce4;
+s0 = s0 + 0xffffffff;
+goto L406ce8;
+L406ce4:
+MEM_U8(s0 + -1) = (uint8_t)t3;
+L406ce8:
+MEM_U32(s4 + 20) = t4;
+//nop;
+a0 = s4;
+a1 = zero;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600c1fe0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s4 + 20);
+t0 = 0x10006290;
+//nop;
+L406d0c:
+at = v1 < s1;
+L406d10:
+//nop;
+if (at != 0) goto L406a04;
+L406d18:
+MEM_U8(s0 + 0) = (uint8_t)zero;
+goto L406d24;
+L406d20:
+s0 = s1;
+L406d24:
+t5 = MEM_U32(sp + 140);
+//nop;
+MEM_U32(s4 + 20) = t5;
+t6 = MEM_U8(s7 + 18);
+t7 = MEM_U32(sp + 164);
+//nop;
+if (t6 == 0) goto L406e3c;
+s1 = MEM_U32(t7 + 20);
+t9 = MEM_U32(t7 + 16);
+a1 = MEM_U32(s7 + 0);
+t8 = MEM_U32(t7 + 8);
+t1 = s1 - t9;
+a1 = a1 + 0x1;
+t2 = t8 - t1;
+t4 = 0x23;
+if ((int)a1 < (int)t2) goto L406d8c;
+//nop;
+a0 = t7;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U32(sp + 164);
+// bdead 41621001 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(t3 + 20);
+//nop;
+t4 = 0x23;
+L406d8c:
+MEM_U8(s1 + 0) = (uint8_t)t4;
+t5 = MEM_U32(sp + 164);
+//nop;
+t6 = MEM_U32(t5 + 20);
+//nop;
+a1 = t6 + 0x1;
+MEM_U32(t5 + 20) = a1;
+//nop;
+a2 = MEM_U32(s7 + 0);
+a0 = MEM_U32(s7 + 8);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t8 = MEM_U32(sp + 164);
+t2 = MEM_U32(s7 + 0);
+t1 = MEM_U32(t8 + 20);
+t4 = MEM_U32(t8 + 16);
+t3 = MEM_U32(t8 + 8);
+s1 = t1 + t2;
+t6 = s1 - t4;
+s2 = s0 - s5;
+t9 = t3 - t6;
+// bdead 476e0001 gp = MEM_U32(sp + 60);
+MEM_U32(t8 + 20) = s1;
+if ((int)s2 < (int)t9) goto L406e10;
+//nop;
+a0 = t8;
+a1 = s2;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U32(sp + 164);
+// bdead 416a4001 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(t5 + 20);
+//nop;
+L406e10:
+//nop;
+a0 = s5;
+a1 = s1;
+a2 = s2;
+wrapper_bcopy(mem, a0, a1, a2);
+t1 = MEM_U32(sp + 164);
+// bdead 600416a0401 gp = MEM_U32(sp + 60);
+t2 = MEM_U32(t1 + 20);
+//nop;
+t7 = t2 + s2;
+MEM_U32(t1 + 20) = t7;
+L406e3c:
+t9 = MEM_U32(s7 + 4);
+a2 = MEM_U32(sp + 164);
+a0 = s5;
+a1 = s0;
+fp_dest = t9;
+a3 = s7;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U32(sp + 164);
+t4 = MEM_U32(s4 + 20);
+t3 = MEM_U32(s4 + 16);
+t2 = MEM_U32(t5 + 20);
+t7 = MEM_U32(t5 + 16);
+t8 = MEM_U32(s4 + 8);
+t9 = MEM_U32(t5 + 8);
+t6 = t4 - t3;
+t1 = t2 - t7;
+a1 = t8 - t6;
+t4 = t9 - t1;
+// bdead 40006041 gp = MEM_U32(sp + 60);
+//nop;
+if ((int)a1 < (int)t4) goto L406ea8;
+//nop;
+a0 = t5;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 60);
+//nop;
+L406ea8:
+v0 = 0x1;
+goto L406f10;
+L406eb0:
+v0 = MEM_U32(s7 + 20);
+s7 = s7 + 0x14;
+//nop;
+if ((int)v0 > 0) goto L40671c;
+L406ec0:
+t3 = 0x10002d28;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+v0 = zero;
+if (t3 == 0) goto L406f10;
+t8 = 0x10002d2c;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+v0 = zero;
+if (t8 != 0) goto L406f10;
+a0 = 0x10000fc4;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 60);
+//nop;
+v0 = zero;
+L406f10:
+// bdead 9 ra = MEM_U32(sp + 68);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 32);
+// bdead 9 s2 = MEM_U32(sp + 36);
+// bdead 9 s3 = MEM_U32(sp + 40);
+// bdead 9 s4 = MEM_U32(sp + 44);
+// bdead 9 s5 = MEM_U32(sp + 48);
+// bdead 9 s6 = MEM_U32(sp + 52);
+// bdead 9 s7 = MEM_U32(sp + 56);
+// bdead 9 fp = MEM_U32(sp + 64);
+// bdead 9 sp = sp + 0xa0;
+return v0;
+}
+
+static void f_special_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L406f40:
+//special_symbol:
+//nop;
+//nop;
+//nop;
+a3 = 0x10000030;
+sp = sp + 0xffffffa8;
+a3 = MEM_U32(a3 + 0);
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 88) = a0;
+MEM_U32(sp + 92) = a1;
+v1 = zero;
+t0 = zero;
+a2 = a3;
+if ((int)a3 < 0) goto L406fb4;
+t6 = a2 << 3;
+a0 = 0x10002d50;
+t6 = t6 + a2;
+t6 = t6 << 2;
+v0 = t6 + a0;
+L406f8c:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L406fa4;
+v1 = v0;
+goto L406fb4;
+L406fa4:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= a0) goto L406f8c;
+L406fb4:
+t9 = MEM_U32(sp + 88);
+if (v1 != 0) goto L406fe0;
+a0 = 0x10001058;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L407580;
+// fdead 0 t9 = MEM_U32(sp + 88);
+L406fe0:
+//nop;
+v0 = MEM_U32(t9 + 12);
+//nop;
+t1 = v0 + 0xfffffff1;
+//nop;
+if (t1 >= 0xb) goto L4074c0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L4071c8;
+case 1: goto L407208;
+case 2: goto L40701c;
+case 3: goto L40701c;
+case 4: goto L4070b4;
+case 5: goto L40712c;
+case 6: goto L407208;
+case 7: goto L407188;
+case 8: goto L4074c0;
+case 9: goto L4074c0;
+case 10: goto L40730c;
+}
+L40701c:
+at = 0x11;
+//nop;
+if (v0 != at) goto L407034;
+a2 = MEM_U32(v1 + 0);
+//nop;
+goto L407044;
+L407034:
+a2 = 0x10002d50;
+//nop;
+a2 = MEM_U32(a2 + 0);
+//nop;
+L407044:
+//nop;
+if (a2 == 0) goto L4070a0;
+//nop;
+a0 = a2;
+MEM_U32(sp + 56) = a2;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = v0 + 0x3;
+//nop;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 56);
+a1 = 0x10001078;
+//nop;
+MEM_U32(sp + 84) = v0;
+a0 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L4070a0:
+t2 = 0x10001080;
+//nop;
+t2 = t2;
+MEM_U32(sp + 84) = t2;
+goto L4074f4;
+L4070b4:
+v1 = zero;
+if ((int)a3 < 0) goto L4070ec;
+t3 = a3 << 3;
+a0 = 0x10002d50;
+t3 = t3 + a3;
+t3 = t3 << 2;
+v0 = t3 + a0;
+L4070d0:
+t5 = MEM_U32(v0 + 0);
+v0 = v0 + 0xffffffdc;
+at = v0 < a0;
+if (t5 == 0) goto L4070e4;
+v1 = v1 + 0x1;
+L4070e4:
+//nop;
+if (at == 0) goto L4070d0;
+L4070ec:
+//nop;
+a0 = 0x8;
+MEM_U32(sp + 68) = v1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 68);
+a1 = 0x10001084;
+//nop;
+MEM_U32(sp + 84) = v0;
+a0 = v0;
+a2 = v1 + 0xffffffff;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L40712c:
+a0 = 0x100001f0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = v0 + 0x3;
+//nop;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 84) = v0;
+a2 = 0x100001f0;
+a1 = 0x10001088;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L407188:
+//nop;
+a0 = 0x10;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 88);
+a1 = 0x10001090;
+//nop;
+MEM_U32(sp + 84) = v0;
+a2 = MEM_U32(t6 + 24);
+a0 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L4071c8:
+//nop;
+a0 = 0xa;
+MEM_U32(sp + 64) = v1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 64);
+a1 = 0x10001094;
+//nop;
+MEM_U32(sp + 84) = v0;
+a2 = MEM_U32(v1 + 4);
+a0 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L407208:
+v1 = 0x100001e8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40725c;
+//nop;
+a0 = zero;
+//nop;
+v0 = wrapper_time(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 80) = v0;
+//nop;
+a0 = sp + 0x50;
+//nop;
+v0 = wrapper_localtime(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+//nop;
+at = 0x100001e8;
+//nop;
+MEM_U32(at + 0) = v0;
+L40725c:
+//nop;
+a0 = 0x14;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+t7 = MEM_U32(sp + 88);
+MEM_U32(sp + 84) = v0;
+t8 = MEM_U32(t7 + 12);
+// bdead 42000009 gp = MEM_U32(sp + 32);
+at = 0x10;
+a0 = v0;
+if (t8 != at) goto L4072d4;
+v1 = 0x100001e8;
+t2 = 0x100001b8;
+v1 = MEM_U32(v1 + 0);
+t2 = t2;
+t9 = MEM_U32(v1 + 16);
+t4 = MEM_U32(v1 + 20);
+t1 = t9 << 2;
+//nop;
+a1 = 0x10001098;
+t3 = t1 + t2;
+a2 = MEM_U32(t3 + 0);
+a3 = MEM_U32(v1 + 12);
+t5 = t4 + 0x76c;
+MEM_U32(sp + 16) = t5;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L4072d4:
+v1 = 0x100001e8;
+a1 = 0x100010a8;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 0);
+a0 = MEM_U32(sp + 84);
+a2 = MEM_U32(v1 + 8);
+a3 = MEM_U32(v1 + 4);
+a1 = a1;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L40730c:
+t7 = 0x100010bc;
+t8 = a3 << 3;
+t9 = 0x10002d50;
+t8 = t8 + a3;
+t8 = t8 << 2;
+t7 = t7;
+MEM_U32(sp + 84) = t7;
+v1 = t8 + t9;
+a0 = MEM_U32(v1 + 20);
+a3 = 0x10006190;
+v0 = MEM_U8(a0 + 0);
+at = 0x28;
+t1 = a3 + v0;
+t2 = MEM_U8(t1 + 0);
+a1 = 0xffffffff;
+a2 = 0xffffffff;
+if (t2 == 0) goto L407374;
+t3 = a0 + 0x1;
+L407354:
+MEM_U32(v1 + 20) = t3;
+v0 = MEM_U8(t3 + 0);
+a0 = t3;
+t4 = a3 + v0;
+t5 = MEM_U8(t4 + 0);
+//nop;
+t3 = a0 + 0x1;
+if (t5 != 0) goto L407354;
+L407374:
+t6 = a0 + 0x1;
+if (v0 != at) goto L4073bc;
+MEM_U32(v1 + 20) = t6;
+v0 = MEM_U8(t6 + 0);
+t0 = 0x1;
+t7 = a3 + v0;
+t8 = MEM_U8(t7 + 0);
+a0 = t6;
+t9 = a0 + 0x1;
+if (t8 == 0) goto L4073bc;
+L40739c:
+MEM_U32(v1 + 20) = t9;
+v0 = MEM_U8(t9 + 0);
+a0 = t9;
+t1 = a3 + v0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+t9 = a0 + 0x1;
+if (t2 != 0) goto L40739c;
+L4073bc:
+t3 = 0x10006090;
+//nop;
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L4074a0;
+//nop;
+MEM_U32(sp + 64) = v1;
+MEM_U32(sp + 60) = t0;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000089 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 64);
+t0 = MEM_U32(sp + 60);
+a3 = 0x10006190;
+at = 0x29;
+if (v0 == 0) goto L407410;
+t6 = 0x100010c0;
+//nop;
+t6 = t6;
+MEM_U32(sp + 84) = t6;
+L407410:
+a0 = MEM_U32(v1 + 20);
+a1 = 0x10005f90;
+v0 = MEM_U8(a0 + 0);
+//nop;
+t7 = a1 + v0;
+t8 = MEM_U8(t7 + 0);
+//nop;
+t9 = a0 + 0x1;
+if (t8 == 0) goto L407454;
+L407434:
+MEM_U32(v1 + 20) = t9;
+v0 = MEM_U8(t9 + 0);
+a0 = t9;
+t1 = a1 + v0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+t9 = a0 + 0x1;
+if (t2 != 0) goto L407434;
+L407454:
+t3 = a3 + v0;
+t4 = MEM_U8(t3 + 0);
+//nop;
+t5 = a0 + 0x1;
+if (t4 == 0) goto L407488;
+L407468:
+MEM_U32(v1 + 20) = t5;
+v0 = MEM_U8(t5 + 0);
+a0 = t5;
+t6 = a3 + v0;
+t7 = MEM_U8(t6 + 0);
+//nop;
+t5 = a0 + 0x1;
+if (t7 != 0) goto L407468;
+L407488:
+//nop;
+if (t0 == 0) goto L4074f4;
+t8 = a0 + 0x1;
+if (v0 != at) goto L4074a0;
+MEM_U32(v1 + 20) = t8;
+goto L4074f4;
+L4074a0:
+a0 = 0x100010c4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4074f4;
+L4074c0:
+a0 = 0x100010f4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L4074f4:
+//nop;
+a0 = MEM_U32(sp + 84);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t9 = MEM_U32(sp + 92);
+MEM_U32(sp + 72) = v0;
+t2 = MEM_U32(t9 + 16);
+a1 = MEM_U32(t9 + 20);
+t1 = MEM_U32(t9 + 8);
+t3 = a1 - t2;
+t4 = t1 - t3;
+// bdead 44002049 gp = MEM_U32(sp + 32);
+a0 = t9;
+if ((int)v0 < (int)t4) goto L407550;
+//nop;
+a1 = v0;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U32(sp + 92);
+// bdead 40004001 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(t5 + 20);
+//nop;
+L407550:
+//nop;
+a0 = MEM_U32(sp + 84);
+a2 = MEM_U32(sp + 72);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t6 = MEM_U32(sp + 92);
+t8 = MEM_U32(sp + 72);
+t7 = MEM_U32(t6 + 20);
+// bdead 2018001 gp = MEM_U32(sp + 32);
+t2 = t7 + t8;
+MEM_U32(t6 + 20) = t2;
+// bdead 1 ra = MEM_U32(sp + 36);
+L407580:
+// bdead 1 sp = sp + 0x58;
+//nop;
+return;
+}
+
+static uint64_t f_do_include(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40758c:
+//do_include:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff58;
+// fdead 400001e3 MEM_U32(sp + 44) = s6;
+s6 = 0x10000068;
+// fdead 408001e3 MEM_U32(sp + 28) = s2;
+// fdead 408001e3 MEM_U32(sp + 40) = s5;
+// fdead 408001e3 MEM_U32(sp + 36) = s4;
+// fdead 408001e3 MEM_U32(sp + 32) = s3;
+// fdead 408001e3 MEM_U32(sp + 20) = s0;
+t6 = 0xffffffff;
+s2 = 0x10006190;
+s6 = MEM_U32(s6 + 0);
+s0 = a1;
+s5 = a0;
+// fdead 40ca81e3 MEM_U32(sp + 52) = ra;
+// fdead 40ca81e3 MEM_U32(sp + 48) = gp;
+// fdead 40ca81e3 MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 176) = a2;
+MEM_U32(sp + 180) = a3;
+MEM_U32(sp + 132) = zero;
+MEM_U32(sp + 92) = zero;
+MEM_U32(sp + 136) = t6;
+s3 = 0x22;
+s4 = 0x3e;
+L4075f4:
+t7 = MEM_U8(s5 + 0);
+s1 = s5;
+t8 = s2 + t7;
+t9 = MEM_U8(t8 + 0);
+at = 0x3c;
+a0 = sp + 0x60;
+if (t9 == 0) goto L40762c;
+L407610:
+t0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t1 = s2 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L407610;
+L40762c:
+v0 = MEM_U8(s1 + 0);
+a1 = s5;
+if (s0 == s1) goto L40767c;
+t3 = MEM_U8(s0 + -1);
+//nop;
+t4 = s2 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L40767c;
+L407654:
+s0 = s0 + 0xffffffff;
+//nop;
+if (s0 == s1) goto L40767c;
+t6 = MEM_U8(s0 + -1);
+//nop;
+t7 = s2 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L407654;
+L40767c:
+s1 = s1 + 0x1;
+if (v0 == s3) goto L407694;
+//nop;
+if (v0 == at) goto L4077f8;
+t4 = MEM_U32(sp + 132);
+goto L407878;
+L407694:
+v1 = s1;
+if (s1 == s0) goto L4076c8;
+t9 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s3 == t9) goto L4076c8;
+L4076ac:
+v1 = v1 + 0x1;
+//nop;
+if (v1 == s0) goto L4076c8;
+t0 = MEM_U8(v1 + 0);
+//nop;
+//nop;
+if (s3 != t0) goto L4076ac;
+L4076c8:
+t1 = MEM_U8(v1 + 0);
+t2 = v1 + 0x1;
+t4 = MEM_U32(sp + 132);
+if (s3 != t1) goto L407878;
+t4 = MEM_U32(sp + 132);
+if (t2 != s0) goto L407878;
+t3 = 0x100063a0;
+a1 = 0x2f;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L40770c;
+v0 = 0x10002d14;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+goto L407920;
+L40770c:
+t4 = 0x10000030;
+a0 = 0x10002d50;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = t4 << 3;
+t5 = t5 + t4;
+t5 = t5 << 2;
+v0 = a0 + t5;
+//nop;
+if (v0 < a0) goto L4077e4;
+L407738:
+s0 = MEM_U32(v0 + 0);
+v0 = v0 + 0xffffffdc;
+at = v0 < a0;
+if (s0 == 0) goto L4077dc;
+//nop;
+MEM_U32(sp + 144) = s6;
+s6 = sp + 0x90;
+a0 = s0;
+MEM_U32(sp + 156) = v1;
+v0 = wrapper_strrchr(mem, a0, a1);
+// bdead 4086000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 156);
+s2 = v0 - s0;
+if (v0 == 0) goto L4077d4;
+//nop;
+a0 = s2 + 0x1;
+MEM_U32(sp + 156) = v1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 408e000b gp = MEM_U32(sp + 48);
+a0 = v0;
+//nop;
+a1 = s0;
+a2 = s2;
+MEM_U32(sp + 148) = v0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 408c0003 gp = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 148);
+t8 = 0x10002d14;
+v1 = MEM_U32(sp + 156);
+t7 = t6 + s2;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if ((int)t8 >= (int)s2) goto L4077e4;
+at = 0x10002d14;
+MEM_U32(at + 0) = s2;
+goto L4077e4;
+L4077d4:
+MEM_U32(sp + 148) = zero;
+goto L4077e4;
+L4077dc:
+//nop;
+if (at == 0) goto L407738;
+L4077e4:
+v0 = 0x10002d14;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+goto L407920;
+L4077f8:
+v1 = s1;
+if (s1 == s0) goto L40782c;
+t9 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s4 == t9) goto L40782c;
+L407810:
+v1 = v1 + 0x1;
+//nop;
+if (v1 == s0) goto L40782c;
+t0 = MEM_U8(v1 + 0);
+//nop;
+//nop;
+if (s4 != t0) goto L407810;
+L40782c:
+t1 = MEM_U8(v1 + 0);
+t2 = v1 + 0x1;
+t4 = MEM_U32(sp + 132);
+if (s4 != t1) goto L407878;
+t4 = MEM_U32(sp + 132);
+if (t2 != s0) goto L407878;
+v0 = 0x1000006c;
+t3 = 0x1;
+v0 = MEM_U32(v0 + 0);
+MEM_U32(sp + 92) = t3;
+//nop;
+if (v0 == 0) goto L407860;
+s6 = v0;
+L407860:
+v0 = 0x10002d14;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+goto L407920;
+// fdead 0 t4 = MEM_U32(sp + 132);
+L407878:
+//nop;
+//nop;
+if (t4 == 0) goto L4078a4;
+a0 = 0x1000111c;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 48);
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L407e24;
+L4078a4:
+//nop;
+a2 = s0;
+a3 = zero;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40b80003 gp = MEM_U32(sp + 48);
+s1 = MEM_U32(sp + 112);
+t5 = MEM_U32(sp + 116);
+//nop;
+a0 = t5 - s1;
+a0 = a0 + 0x1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40b8000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+t6 = MEM_U32(sp + 116);
+//nop;
+s5 = v0;
+a1 = v0;
+a2 = t6 - a0;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 40f80003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+t7 = MEM_U32(sp + 116);
+//nop;
+t8 = t7 - a0;
+s0 = t8 + s5;
+wrapper_free(mem, a0);
+t9 = MEM_U32(sp + 132);
+// bdead 44fa0183 gp = MEM_U32(sp + 48);
+t0 = t9 + 0x1;
+MEM_U32(sp + 132) = t0;
+goto L4075f4;
+L407920:
+//nop;
+s0 = v1 - s1;
+a0 = v0 + s0;
+a0 = a0 + 0x2;
+v0 = f_alloca(mem, sp, a0);
+t1 = MEM_U8(s1 + 0);
+// bdead 4086040b gp = MEM_U32(sp + 48);
+at = 0x2f;
+s2 = v0;
+if (t1 != at) goto L407988;
+//nop;
+a0 = v0;
+a1 = s1;
+a2 = s0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 400e0003 gp = MEM_U32(sp + 48);
+t2 = s2 + s0;
+MEM_U8(t2 + 0) = (uint8_t)zero;
+//nop;
+a0 = s2;
+a1 = zero;
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 400e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 136) = v0;
+goto L407a4c;
+L407988:
+t5 = MEM_U32(sp + 136);
+if (s6 == 0) goto L407a50;
+s3 = 0x10001140;
+//nop;
+s3 = s3;
+L40799c:
+a1 = MEM_U32(s6 + 4);
+//nop;
+//nop;
+if (a1 == 0) goto L407a00;
+//nop;
+a0 = s2;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+//nop;
+a1 = s3;
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t3 = s2 + v0;
+t4 = t3 + s0;
+// bdead 409e2003 gp = MEM_U32(sp + 48);
+MEM_U8(t4 + 0) = (uint8_t)zero;
+goto L407a04;
+L407a00:
+MEM_U8(s2 + 0) = (uint8_t)zero;
+L407a04:
+//nop;
+a0 = s2;
+a1 = s1;
+a2 = s0;
+v0 = wrapper_strncat(mem, a0, a1, a2);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+//nop;
+a1 = zero;
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 409e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 136) = v0;
+if ((int)v0 >= 0) goto L407a4c;
+s6 = MEM_U32(s6 + 0);
+//nop;
+//nop;
+if (s6 != 0) goto L40799c;
+L407a4c:
+t5 = MEM_U32(sp + 136);
+L407a50:
+a0 = s2;
+a1 = s1;
+if ((int)t5 >= 0) goto L407ba8;
+//nop;
+a2 = s0;
+s3 = s2 + s0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 401e0103 gp = MEM_U32(sp + 48);
+MEM_U8(s3 + 0) = (uint8_t)zero;
+//nop;
+a0 = s2;
+//nop;
+v0 = f_error_from_errno(mem, sp, a0);
+s3 = MEM_U32(sp + 92);
+// bdead 4016010b gp = MEM_U32(sp + 48);
+v1 = zero < s3;
+s3 = v1;
+if (v1 != 0) goto L407ab0;
+s4 = 0x10000034;
+//nop;
+v1 = MEM_U32(s4 + 0);
+//nop;
+t7 = (int)zero < (int)v1;
+v1 = t7;
+L407ab0:
+t8 = 0x1000002c;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// bdead 4016011b ra = MEM_U32(sp + 52);
+if ((int)v1 >= (int)t8) goto L407e24;
+//nop;
+if (s3 == 0) goto L407b0c;
+t9 = 0x10002d2c;
+a1 = s0;
+t9 = MEM_U32(t9 + 0);
+//nop;
+// bdead 40040159 ra = MEM_U32(sp + 52);
+if (t9 != 0) goto L407e24;
+a0 = 0x10001144;
+//nop;
+a2 = s1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 48);
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L407e24;
+L407b0c:
+s3 = 0x10002d18;
+//nop;
+t0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if (t0 == 0) goto L407b70;
+a0 = 0x1000117c;
+//nop;
+a1 = 0x1;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40160003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4016000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = v0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40060003 gp = MEM_U32(sp + 48);
+//nop;
+L407b70:
+//nop;
+a0 = s1;
+a1 = s0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+a1 = zero;
+a0 = 0x10001180;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 19 gp = MEM_U32(sp + 48);
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L407e24;
+L407ba8:
+s0 = 0x10000074;
+//nop;
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L407c08;
+L407bc0:
+//nop;
+a0 = MEM_U32(s0 + 4);
+a1 = s2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400a000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != 0) goto L407bf8;
+//nop;
+a0 = MEM_U32(sp + 136);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 19 gp = MEM_U32(sp + 48);
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L407e24;
+L407bf8:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L407bc0;
+L407c08:
+s1 = 0x10000078;
+//nop;
+s0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L407c4c;
+L407c20:
+//nop;
+a0 = MEM_U32(s0 + 4);
+a1 = s2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400e000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L407c4c;
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L407c20;
+L407c4c:
+s3 = MEM_U32(sp + 92);
+if (s0 != 0) goto L407db8;
+//nop;
+a0 = 0x8;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+t1 = MEM_U32(s1 + 0);
+// bdead 400c040b gp = MEM_U32(sp + 48);
+MEM_U32(v0 + 0) = t1;
+MEM_U32(s1 + 0) = v0;
+//nop;
+s0 = v0;
+a0 = s2;
+v0 = f_savestring(mem, sp, a0);
+// bdead 400a000b gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 4) = v0;
+s3 = MEM_U32(sp + 92);
+//nop;
+v1 = zero < s3;
+//nop;
+if (v1 != 0) goto L407cb8;
+s4 = 0x10000034;
+//nop;
+v1 = MEM_U32(s4 + 0);
+//nop;
+t3 = (int)zero < (int)v1;
+v1 = t3;
+L407cb8:
+t4 = 0x1000002c;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if ((int)v1 >= (int)t4) goto L407d84;
+s3 = 0x10002d18;
+//nop;
+t5 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L407d38;
+a0 = 0x10001184;
+//nop;
+a1 = 0x1;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 401a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 401a000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = v0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+//nop;
+L407d38:
+//nop;
+a0 = s2;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 400a000b gp = MEM_U32(sp + 48);
+a0 = s2;
+//nop;
+a1 = v0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+a1 = zero;
+a0 = 0x10001188;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+//nop;
+L407d84:
+a0 = 0x10002d1c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+s3 = MEM_U32(sp + 92);
+if (a0 == 0) goto L407db8;
+//nop;
+a1 = MEM_U32(s0 + 4);
+//nop;
+f_MDupdate(mem, sp, a0, a1);
+// bdead 40080003 gp = MEM_U32(sp + 48);
+//nop;
+s3 = MEM_U32(sp + 92);
+L407db8:
+s4 = 0x10000034;
+t6 = zero < s3;
+s3 = t6;
+if (t6 == 0) goto L407dd8;
+t7 = MEM_U32(s4 + 0);
+//nop;
+t8 = t7 + 0x1;
+MEM_U32(s4 + 0) = t8;
+L407dd8:
+//nop;
+a0 = MEM_U32(sp + 136);
+a2 = MEM_U32(sp + 176);
+a1 = s2;
+f_finclude(mem, sp, a0, a1, a2);
+// bdead 40300001 gp = MEM_U32(sp + 48);
+//nop;
+if (s3 == 0) goto L407e08;
+t9 = MEM_U32(s4 + 0);
+//nop;
+t0 = t9 + 0xffffffff;
+MEM_U32(s4 + 0) = t0;
+L407e08:
+//nop;
+a0 = MEM_U32(sp + 136);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 19 gp = MEM_U32(sp + 48);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 52);
+L407e24:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 s3 = MEM_U32(sp + 32);
+// bdead 19 s4 = MEM_U32(sp + 36);
+// bdead 19 s5 = MEM_U32(sp + 40);
+// bdead 19 s6 = MEM_U32(sp + 44);
+// bdead 19 sp = sp + 0xa8;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_finclude(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L407e48:
+//finclude:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+v0 = 0x10000030;
+// fdead 400000eb MEM_U32(sp + 36) = s4;
+v0 = MEM_U32(v0 + 0);
+s4 = a0;
+at = (int)v0 < (int)0xc7;
+// fdead 402000ef MEM_U32(sp + 44) = ra;
+// fdead 402000ef MEM_U32(sp + 40) = gp;
+// fdead 402000ef MEM_U32(sp + 32) = s3;
+// fdead 402000ef MEM_U32(sp + 28) = s2;
+// fdead 402000ef MEM_U32(sp + 24) = s1;
+// fdead 402000ef MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 100) = a1;
+MEM_U32(sp + 104) = a2;
+MEM_U32(sp + 76) = zero;
+if (at != 0) goto L407ee0;
+t6 = v0 << 3;
+t7 = 0x10002d50;
+t6 = t6 + v0;
+t6 = t6 << 2;
+//nop;
+t8 = t6 + t7;
+a0 = MEM_U32(t8 + 4);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 40);
+a0 = v0;
+a1 = 0x1000118c;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408228;
+L407ee0:
+//nop;
+a0 = s4;
+a1 = sp + 0x5c;
+a2 = sp + 0x58;
+v0 = f_file_size_and_mode(mem, sp, a0, a1, a2);
+// bdead 4020010b gp = MEM_U32(sp + 40);
+t1 = MEM_U32(sp + 76);
+if ((int)v0 < 0) goto L4081e8;
+t9 = 0x10000030;
+t2 = 0x10002d50;
+t9 = MEM_U32(t9 + 0);
+a1 = 0x24;
+t0 = t9 << 3;
+t0 = t0 + t9;
+t0 = t0 << 2;
+//nop;
+t1 = t0 + 0x24;
+s2 = t1 + t2;
+a0 = s2;
+wrapper_bzero(mem, a0, a1);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 100);
+t5 = 0x100001b4;
+t4 = 0x1;
+MEM_U32(s2 + 8) = zero;
+MEM_U32(s2 + 4) = t4;
+MEM_U32(s2 + 0) = t3;
+t5 = MEM_U32(t5 + 0);
+s0 = 0x7d0;
+MEM_U32(s2 + 28) = t5;
+t6 = MEM_U32(sp + 92);
+v1 = MEM_U32(sp + 88);
+t7 = t6 & 0x8000;
+//nop;
+if (t7 == 0) goto L408000;
+//nop;
+a0 = v1 + 0x2;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4028000b gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 16) = v0;
+MEM_U32(s2 + 20) = v0;
+t8 = MEM_U32(sp + 88);
+//nop;
+//nop;
+if ((int)t8 <= 0) goto L4080e0;
+L407f98:
+t9 = MEM_U32(s2 + 16);
+t0 = MEM_U32(s2 + 8);
+a2 = MEM_U32(sp + 88);
+a1 = t9 + t0;
+//nop;
+a0 = s4;
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4028010b gp = MEM_U32(sp + 40);
+//nop;
+if ((int)v0 > 0) goto L407fd4;
+t1 = MEM_U32(sp + 76);
+if (v0 != 0) goto L4081e8;
+//nop;
+goto L4080e0;
+L407fd4:
+t1 = MEM_U32(s2 + 8);
+//nop;
+t2 = t1 + v0;
+MEM_U32(s2 + 8) = t2;
+t3 = MEM_U32(sp + 88);
+//nop;
+t4 = t3 - v0;
+MEM_U32(sp + 88) = t4;
+if ((int)t4 > 0) goto L407f98;
+//nop;
+goto L4080e0;
+L408000:
+//nop;
+a0 = 0x7d2;
+MEM_U32(sp + 88) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 402a000b gp = MEM_U32(sp + 40);
+s3 = v0;
+s1 = v0;
+L40801c:
+v1 = MEM_U32(sp + 88);
+//nop;
+a0 = s4;
+a1 = s1;
+a2 = s0 - v1;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 403e010b gp = MEM_U32(sp + 40);
+t5 = s0 << 1;
+if ((int)v0 < 0) goto L4081e4;
+a0 = s3;
+if (v0 == 0) goto L408084;
+v1 = MEM_U32(sp + 88);
+s1 = s1 + v0;
+v1 = v1 + v0;
+a1 = t5 + 0x2;
+if (s0 != v1) goto L40807c;
+//nop;
+MEM_U32(sp + 88) = v1;
+s0 = t5;
+v0 = f_xrealloc(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 88);
+// bdead 402a001b gp = MEM_U32(sp + 40);
+s3 = v0;
+s1 = v0 + v1;
+L40807c:
+MEM_U32(sp + 88) = v1;
+goto L40801c;
+L408084:
+v1 = MEM_U32(sp + 88);
+//nop;
+a0 = v1 + 0x2;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4038000b gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 16) = v0;
+MEM_U32(s2 + 20) = v0;
+//nop;
+a2 = MEM_U32(sp + 88);
+a0 = s3;
+a1 = v0;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 40380003 gp = MEM_U32(sp + 40);
+t6 = MEM_U32(sp + 88);
+a0 = s3;
+MEM_U32(s2 + 8) = t6;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+//nop;
+L4080e0:
+t7 = 0x10000028;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L408110;
+//nop;
+a0 = s2;
+//nop;
+f_trigraph_pcp(mem, sp, a0);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+//nop;
+L408110:
+v0 = MEM_U32(s2 + 8);
+t4 = 0x1;
+a2 = zero;
+if ((int)v0 <= 0) goto L408150;
+t8 = MEM_U32(s2 + 16);
+a0 = 0xa;
+v1 = t8 + v0;
+t9 = MEM_U8(v1 + -1);
+//nop;
+//nop;
+if (a0 == t9) goto L408150;
+MEM_U8(v1 + 0) = (uint8_t)a0;
+t0 = MEM_U32(s2 + 8);
+//nop;
+v0 = t0 + 0x1;
+MEM_U32(s2 + 8) = v0;
+L408150:
+t2 = MEM_U32(s2 + 16);
+v1 = 0x10000030;
+t3 = t2 + v0;
+MEM_U8(t3 + 0) = (uint8_t)zero;
+t5 = MEM_U32(v1 + 0);
+a1 = MEM_U32(sp + 104);
+t6 = t5 + 0x1;
+MEM_U32(v1 + 0) = t6;
+//nop;
+MEM_U32(sp + 76) = t4;
+a0 = s2;
+a3 = 0x1;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40200183 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(sp + 104);
+//nop;
+a1 = zero;
+//nop;
+f_rescan(mem, sp, a0, a1);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 104);
+t7 = 0x10000030;
+t0 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+at = 0x10000030;
+t8 = t7 + 0xffffffff;
+t9 = t8 << 3;
+t9 = t9 + t8;
+t9 = t9 << 2;
+a0 = t9 + t0;
+//nop;
+a2 = zero;
+a3 = 0x2;
+MEM_U32(at + 0) = t8;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40200101 gp = MEM_U32(sp + 40);
+//nop;
+L4081e4:
+t1 = MEM_U32(sp + 76);
+L4081e8:
+//nop;
+//nop;
+if (t1 != 0) goto L40820c;
+//nop;
+a0 = MEM_U32(sp + 100);
+//nop;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40200001 gp = MEM_U32(sp + 40);
+//nop;
+L40820c:
+//nop;
+a0 = s4;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 44);
+L408228:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static uint64_t f_do_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L408244:
+//do_define:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 116) = a3;
+MEM_U32(sp + 84) = zero;
+s4 = 0x10006190;
+t6 = MEM_U8(a0 + 0);
+s0 = a1;
+t7 = s4 + t6;
+t8 = MEM_U8(t7 + 0);
+s1 = a2;
+s2 = a0;
+if (t8 == 0) goto L4082c4;
+L4082a8:
+t9 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t0 = s4 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L4082a8;
+L4082c4:
+v1 = MEM_U8(s2 + 0);
+t2 = 0x10006090;
+//nop;
+t3 = v1 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L408358;
+at = 0xa;
+if (v1 == 0) goto L4082f4;
+//nop;
+if (v1 != at) goto L40831c;
+L4082f4:
+a0 = 0x100011b4;
+//nop;
+MEM_U32(sp + 108) = s0;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 402c0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+//nop;
+goto L408358;
+L40831c:
+fp = 0x10002d2c;
+//nop;
+t5 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L408358;
+a0 = 0x100011ec;
+//nop;
+MEM_U32(sp + 108) = s0;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 402c0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+//nop;
+L408358:
+s7 = 0x10005f90;
+fp = 0x10002d2c;
+t6 = s7 + v1;
+t7 = MEM_U8(t6 + 0);
+MEM_U32(sp + 96) = s2;
+at = s2 < s0;
+if (t7 == 0) goto L4083a0;
+//nop;
+if (s2 >= s0) goto L4083a0;
+L40837c:
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t8 = s7 + v1;
+t9 = MEM_U8(t8 + 0);
+at = s2 < s0;
+//nop;
+if (t9 == 0) goto L4083a0;
+//nop;
+if (at != 0) goto L40837c;
+L4083a0:
+t1 = 0x10002d30;
+t0 = MEM_U32(sp + 96);
+t1 = MEM_U32(t1 + 0);
+a3 = s2 - t0;
+MEM_U32(sp + 92) = a3;
+if (t1 == 0) goto L4083e8;
+//nop;
+a1 = 0x1000122c;
+// bdead c12e0343 t9 = t9;
+a0 = s1;
+a2 = t0;
+MEM_U32(sp + 108) = s0;
+a1 = a1;
+func_404734(mem, sp, a0, a1, a2, a3);
+// bdead c1280003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+//nop;
+L4083e8:
+at = 0x28;
+t1 = s4 + v1;
+if (v1 != at) goto L408800;
+MEM_U32(sp + 72) = zero;
+v1 = MEM_U8(s2 + 1);
+s3 = zero;
+t2 = s4 + v1;
+t3 = MEM_U8(t2 + 0);
+s2 = s2 + 0x1;
+at = 0x29;
+if (t3 == 0) goto L408430;
+L408414:
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t4 = s4 + v1;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L408414;
+L408430:
+s6 = 0x1;
+if (v1 == at) goto L408720;
+s5 = 0x100012b8;
+MEM_U32(sp + 108) = s0;
+s5 = s5;
+L408444:
+//nop;
+a0 = 0x14;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead c1f801cb gp = MEM_U32(sp + 60);
+MEM_U32(v0 + 4) = s2;
+MEM_U32(v0 + 0) = s3;
+t6 = MEM_U32(sp + 72);
+t9 = 0x10006090;
+MEM_U32(v0 + 12) = t6;
+t7 = MEM_U32(sp + 72);
+s0 = v0;
+t8 = t7 + 0x1;
+MEM_U32(sp + 72) = t8;
+MEM_U32(v0 + 16) = zero;
+v1 = MEM_U8(s2 + 0);
+s3 = v0;
+t1 = v1 + t9;
+t0 = MEM_U8(t1 + 0);
+//nop;
+t3 = s7 + v1;
+if (t0 != 0) goto L4084d0;
+t2 = MEM_U32(fp + 0);
+//nop;
+t3 = s7 + v1;
+if (t2 != 0) goto L4084d0;
+a0 = 0x10001234;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1fa01c3 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+//nop;
+t3 = s7 + v1;
+L4084d0:
+t4 = MEM_U8(t3 + 0);
+at = 0x2c;
+//nop;
+if (t4 == 0) goto L4084fc;
+L4084e0:
+t5 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t6 = s7 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L4084e0;
+L4084fc:
+t8 = MEM_U32(s0 + 4);
+//nop;
+v0 = s2 - t8;
+MEM_U32(s0 + 8) = v0;
+t9 = MEM_U32(sp + 84);
+//nop;
+t1 = t9 + v0;
+t0 = t1 + 0x2;
+MEM_U32(sp + 84) = t0;
+v1 = MEM_U8(s2 + 0);
+t0 = MEM_U32(sp + 108);
+t2 = s4 + v1;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L408558;
+L40853c:
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t4 = s4 + v1;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40853c;
+L408558:
+t6 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+if (t6 == 0) goto L408578;
+if (v1 == at) {
+at = 0x29;
+goto L408598;}
+at = 0x29;
+if (v1 == at) {
+at = 0x2c;
+goto L40859c;}
+at = 0x2c;
+L408578:
+a0 = 0x10001264;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 60);
+v0 = 0x1;
+goto L40899c;
+L408598:
+at = 0x2c;
+L40859c:
+if (v1 != at) {
+at = s2 < t0;
+goto L4085e0;}
+at = s2 < t0;
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t7 = s4 + v1;
+t8 = MEM_U8(t7 + 0);
+//nop;
+at = s2 < t0;
+if (t8 == 0) goto L4085e0;
+L4085c0:
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t9 = s4 + v1;
+t1 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L4085c0;
+at = s2 < t0;
+L4085e0:
+//nop;
+if (at != 0) goto L408608;
+a0 = 0x10001290;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 60);
+v0 = 0x1;
+goto L40899c;
+L408608:
+t2 = 0x10002d28;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+at = 0x29;
+if (t2 == 0) goto L408710;
+s0 = MEM_U32(s3 + 0);
+//nop;
+at = 0x29;
+if (s0 == 0) goto L408710;
+L408630:
+v0 = MEM_U32(s0 + 8);
+t3 = MEM_U32(s3 + 8);
+t5 = MEM_U32(s0 + 16);
+t4 = v0 ^ t3;
+t4 = t4 < 0x1;
+t6 = t5 < 0x1;
+t7 = t4 & t6;
+//nop;
+if (t7 == 0) goto L4086f4;
+//nop;
+a0 = MEM_U32(s3 + 4);
+a1 = MEM_U32(s0 + 4);
+a2 = v0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fa000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L4086f4;
+a0 = MEM_U32(s0 + 8);
+//nop;
+a0 = a0 + 0x1;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c1fa000b gp = MEM_U32(sp + 60);
+a1 = MEM_U32(s0 + 4);
+//nop;
+a2 = MEM_U32(s0 + 8);
+s1 = v0;
+a0 = v0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+t8 = MEM_U32(s0 + 8);
+// bdead c3fe0183 gp = MEM_U32(sp + 60);
+t9 = s1 + t8;
+MEM_U8(t9 + 0) = (uint8_t)zero;
+t1 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L4086dc;
+//nop;
+a0 = s5;
+a1 = s1;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L4086dc:
+//nop;
+a0 = s1;
+//nop;
+wrapper_free(mem, a0);
+// bdead c1fa0003 gp = MEM_U32(sp + 60);
+MEM_U32(s0 + 16) = s6;
+L4086f4:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L408630;
+v1 = MEM_U8(s2 + 0);
+//nop;
+at = 0x29;
+L408710:
+//nop;
+if (v1 != at) goto L408444;
+s0 = MEM_U32(sp + 108);
+//nop;
+L408720:
+s2 = s2 + 0x1;
+a1 = s0;
+if (s2 >= s0) goto L40874c;
+v1 = MEM_U8(s2 + 0);
+s4 = 0x20;
+at = 0x9;
+if (s4 == v1) goto L408748;
+//nop;
+if (v1 != at) goto L40874c;
+L408748:
+s2 = s2 + 0x1;
+L40874c:
+//nop;
+a2 = MEM_U32(sp + 72);
+s4 = 0x20;
+a0 = s2;
+a3 = s3;
+v0 = f_collect_expansion(mem, sp, a0, a1, a2, a3);
+// bdead c030000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 84);
+//nop;
+s2 = v0;
+a0 = a0 + 0x1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c038000b gp = MEM_U32(sp + 60);
+MEM_U32(s2 + 16) = v0;
+s0 = zero;
+s1 = s3;
+if (s3 == 0) goto L4087ec;
+L408790:
+t0 = MEM_U32(s2 + 16);
+//nop;
+a0 = MEM_U32(s1 + 4);
+a2 = MEM_U32(s1 + 8);
+a1 = t0 + s0;
+wrapper_bcopy(mem, a0, a1, a2);
+t2 = MEM_U32(s1 + 8);
+v0 = MEM_U32(s1 + 0);
+// bdead c02e080b gp = MEM_U32(sp + 60);
+s0 = s0 + t2;
+if (v0 == 0) goto L4087e4;
+t5 = MEM_U32(s2 + 16);
+t3 = 0x2c;
+t4 = t5 + s0;
+MEM_U8(t4 + 0) = (uint8_t)t3;
+t6 = MEM_U32(s2 + 16);
+s0 = s0 + 0x1;
+t7 = t6 + s0;
+MEM_U8(t7 + 0) = (uint8_t)s4;
+v0 = MEM_U32(s1 + 0);
+s0 = s0 + 0x1;
+L4087e4:
+s1 = v0;
+if (v0 != 0) goto L408790;
+L4087ec:
+t8 = MEM_U32(s2 + 16);
+//nop;
+t9 = t8 + s0;
+MEM_U8(t9 + 0) = (uint8_t)zero;
+goto L40883c;
+L408800:
+t0 = MEM_U8(t1 + 0);
+a1 = s0;
+a2 = 0xffffffff;
+if (t0 == 0) goto L408814;
+s2 = s2 + 0x1;
+L408814:
+//nop;
+a0 = s2;
+a3 = zero;
+v0 = f_collect_expansion(mem, sp, a0, a1, a2, a3);
+// bdead c000000b gp = MEM_U32(sp + 60);
+s2 = v0;
+t2 = 0x100012f0;
+//nop;
+t2 = t2;
+MEM_U32(v0 + 16) = t2;
+L40883c:
+//nop;
+a0 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 92);
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c008000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 96);
+//nop;
+a1 = MEM_U32(sp + 92);
+s0 = v0;
+a2 = v0;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c00a000b gp = MEM_U32(sp + 60);
+s1 = v0;
+if (v0 == 0) goto L40896c;
+t5 = MEM_U32(v0 + 12);
+s3 = 0x17;
+a0 = MEM_U32(sp + 92);
+if (s3 != t5) goto L4088a8;
+//nop;
+a1 = MEM_U32(v0 + 24);
+a0 = s2;
+temp64 = f_compare_defs(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c01c001b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L40895c;
+a0 = MEM_U32(sp + 92);
+L4088a8:
+//nop;
+a0 = a0 + 0x14;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead c01c000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 96);
+//nop;
+a2 = MEM_U32(sp + 92);
+s0 = v0;
+a1 = v0;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c01e01d3 gp = MEM_U32(sp + 60);
+t3 = MEM_U32(sp + 92);
+t6 = 0x100012f4;
+t4 = s0 + t3;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+//nop;
+STORE_U32_UNALIGNED(t4 + 0, at);
+//swr $at, 3($t4)
+t8 = MEM_U32_UNALIGNED(t6 + 4);
+//lwr $t8, 7($t6)
+//nop;
+STORE_U32_UNALIGNED(t4 + 4, t8);
+//swr $t8, 7($t4)
+at = MEM_U8(t6 + 8);
+//nop;
+MEM_U8(t4 + 8) = (uint8_t)at;
+t8 = MEM_U8(t6 + 9);
+//nop;
+MEM_U8(t4 + 9) = (uint8_t)t8;
+at = MEM_U8(t6 + 10);
+//nop;
+MEM_U8(t4 + 10) = (uint8_t)at;
+t9 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L40895c;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1c0013 gp = MEM_U32(sp + 60);
+//nop;
+L40895c:
+MEM_U32(s1 + 12) = s3;
+MEM_U32(s1 + 24) = s2;
+v0 = zero;
+goto L40899c;
+L40896c:
+//nop;
+a0 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 92);
+a2 = 0x17;
+a3 = s2;
+MEM_U32(sp + 16) = s0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 13 gp = MEM_U32(sp + 60);
+//nop;
+v0 = zero;
+goto L40899c;
+v0 = 0x1;
+L40899c:
+// bdead 19 ra = MEM_U32(sp + 68);
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0x68;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_compare_defs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4089cc:
+//compare_defs:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000006b MEM_U32(sp + 60) = ra;
+// fdead 4000006b MEM_U32(sp + 56) = gp;
+// fdead 4000006b MEM_U32(sp + 52) = s5;
+// fdead 4000006b MEM_U32(sp + 48) = s4;
+// fdead 4000006b MEM_U32(sp + 44) = s3;
+// fdead 4000006b MEM_U32(sp + 40) = s2;
+// fdead 4000006b MEM_U32(sp + 36) = s1;
+// fdead 4000006b MEM_U32(sp + 32) = s0;
+t7 = MEM_U32(a0 + 0);
+t6 = MEM_U32(a1 + 0);
+s3 = MEM_U32(a0 + 8);
+s4 = MEM_U32(a1 + 8);
+a2 = a0;
+a3 = a1;
+s5 = 0x1;
+if (t6 == t7) goto L408a24;
+v0 = 0x1;
+goto L408bc0;
+L408a24:
+//nop;
+a0 = MEM_U32(a2 + 16);
+a1 = MEM_U32(a3 + 16);
+MEM_U32(sp + 68) = a3;
+MEM_U32(sp + 64) = a2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4070001b gp = MEM_U32(sp + 56);
+t8 = MEM_U32(sp + 64);
+if (v0 == 0) goto L408a54;
+v0 = 0x1;
+goto L408bc0;
+// fdead 0 t8 = MEM_U32(sp + 64);
+L408a54:
+t9 = MEM_U32(sp + 68);
+s1 = MEM_U32(t8 + 12);
+s2 = MEM_U32(t9 + 12);
+//nop;
+if (s1 == 0) goto L408b54;
+//nop;
+if (s2 == 0) goto L408b54;
+L408a70:
+v0 = MEM_U32(s2 + 8);
+s0 = MEM_U32(s1 + 8);
+a0 = s3;
+//nop;
+if (v0 != s0) goto L408aac;
+//nop;
+a1 = s4;
+a2 = s0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 407c001b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L408ad8;
+v0 = MEM_U32(s2 + 8);
+s0 = MEM_U32(s1 + 8);
+//nop;
+L408aac:
+//nop;
+a0 = s5;
+a1 = s3;
+a2 = s0;
+a3 = s4;
+MEM_U32(sp + 16) = v0;
+MEM_U32(sp + 20) = zero;
+temp64 = f_comp_def_part(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403c001b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L408b28;
+L408ad8:
+t0 = MEM_U32(s2 + 12);
+t1 = MEM_U32(s1 + 12);
+s5 = zero;
+//nop;
+if (t0 != t1) goto L408b28;
+t2 = MEM_U8(s2 + 4);
+t3 = MEM_U8(s1 + 4);
+//nop;
+//nop;
+if (t2 != t3) goto L408b28;
+t4 = MEM_U8(s2 + 5);
+t5 = MEM_U8(s1 + 5);
+//nop;
+//nop;
+if (t4 != t5) goto L408b28;
+t6 = MEM_U8(s2 + 6);
+t7 = MEM_U8(s1 + 6);
+//nop;
+//nop;
+if (t6 == t7) goto L408b30;
+L408b28:
+v0 = 0x1;
+goto L408bc0;
+L408b30:
+t8 = MEM_U32(s1 + 8);
+t9 = MEM_U32(s2 + 8);
+s1 = MEM_U32(s1 + 0);
+s2 = MEM_U32(s2 + 0);
+s3 = s3 + t8;
+s4 = s4 + t9;
+if (s1 == 0) goto L408b54;
+//nop;
+if (s2 != 0) goto L408a70;
+L408b54:
+a0 = s5;
+if (s1 == s2) goto L408b64;
+v0 = 0x1;
+goto L408bc0;
+L408b64:
+t0 = MEM_U32(sp + 64);
+t4 = MEM_U32(sp + 68);
+t1 = MEM_U32(t0 + 4);
+t6 = MEM_U32(t4 + 8);
+t2 = MEM_U32(t0 + 8);
+t5 = MEM_U32(t4 + 4);
+t9 = 0x1;
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = s4 - t6;
+t3 = s3 - t2;
+t8 = t5 - t7;
+MEM_U32(sp + 16) = t8;
+a1 = s3;
+a3 = s4;
+a2 = t1 - t3;
+temp64 = f_comp_def_part(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1b gp = MEM_U32(sp + 56);
+if (v0 == 0) {
+v0 = zero;
+goto L408bc0;}
+v0 = zero;
+v0 = 0x1;
+goto L408bc0;
+// fdead 0 v0 = zero;
+L408bc0:
+// bdead 19 ra = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 32);
+// bdead 19 s1 = MEM_U32(sp + 36);
+// bdead 19 s2 = MEM_U32(sp + 40);
+// bdead 19 s3 = MEM_U32(sp + 44);
+// bdead 19 s4 = MEM_U32(sp + 48);
+// bdead 19 s5 = MEM_U32(sp + 52);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_comp_def_part(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408be4:
+//comp_def_part:
+//nop;
+//nop;
+//nop;
+t6 = MEM_U32(sp + 16);
+v1 = a1 + a2;
+t1 = a3 + t6;
+v0 = v1;
+t0 = t1;
+if (a0 == 0) goto L408ca8;
+//nop;
+if (a1 == v1) goto L408c58;
+t4 = 0x10006290;
+t7 = MEM_U8(a1 + 0);
+//nop;
+t8 = t4 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L408c58;
+L408c30:
+a1 = a1 + 0x1;
+//nop;
+if (a1 == v0) goto L408c58;
+t5 = MEM_U8(a1 + 0);
+//nop;
+t6 = t4 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L408c30;
+L408c58:
+t4 = 0x10006290;
+t9 = MEM_U32(sp + 20);
+if (a3 == t1) goto L408cac;
+t8 = MEM_U8(a3 + 0);
+//nop;
+t9 = t4 + t8;
+t5 = MEM_U8(t9 + 0);
+//nop;
+t9 = MEM_U32(sp + 20);
+if (t5 == 0) goto L408cac;
+L408c80:
+a3 = a3 + 0x1;
+t9 = MEM_U32(sp + 20);
+if (a3 == t0) goto L408cac;
+t6 = MEM_U8(a3 + 0);
+//nop;
+t7 = t4 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L408c80;
+L408ca8:
+t9 = MEM_U32(sp + 20);
+L408cac:
+t4 = 0x10006290;
+v1 = a1 ^ v0;
+v1 = zero < v1;
+if (t9 == 0) goto L408d60;
+t1 = a3 ^ t0;
+t1 = zero < t1;
+if (v1 == 0) goto L408d14;
+t5 = MEM_U8(v0 + -1);
+//nop;
+t6 = t4 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L408d14;
+L408ce4:
+v0 = v0 + 0xffffffff;
+v1 = a1 ^ v0;
+v1 = zero < v1;
+//nop;
+if (v1 == 0) goto L408d14;
+t8 = MEM_U8(v0 + -1);
+//nop;
+t9 = t4 + t8;
+t5 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L408ce4;
+L408d14:
+//nop;
+if (t1 == 0) goto L408d60;
+t6 = MEM_U8(t0 + -1);
+//nop;
+t7 = t4 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L408d60;
+L408d38:
+t0 = t0 + 0xffffffff;
+//nop;
+if (a3 == t0) goto L408d60;
+t9 = MEM_U8(t0 + -1);
+//nop;
+t5 = t4 + t9;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L408d38;
+L408d60:
+t1 = a3 ^ t0;
+if (v1 == 0) goto L408e48;
+t1 = zero < t1;
+//nop;
+if (t1 == 0) goto L408e48;
+L408d74:
+a0 = MEM_U8(a1 + 0);
+t2 = MEM_U8(a3 + 0);
+t7 = t4 + a0;
+a2 = MEM_U8(t7 + 0);
+t8 = t4 + t2;
+//nop;
+if (a2 == 0) goto L408e20;
+t3 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L408e20;
+//nop;
+if (v1 == 0) goto L408de0;
+//nop;
+if (a2 == 0) goto L408de0;
+L408db0:
+a1 = a1 + 0x1;
+v1 = a1 ^ v0;
+v1 = zero < v1;
+//nop;
+if (v1 == 0) goto L408de0;
+t9 = MEM_U8(a1 + 0);
+//nop;
+t5 = t4 + t9;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L408db0;
+L408de0:
+//nop;
+if (t1 == 0) goto L408e34;
+//nop;
+if (t3 == 0) goto L408e34;
+L408df0:
+a3 = a3 + 0x1;
+//nop;
+if (a3 == t0) goto L408e34;
+t7 = MEM_U8(a3 + 0);
+//nop;
+t8 = t4 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L408df0;
+//nop;
+goto L408e34;
+L408e20:
+a1 = a1 + 0x1;
+if (a0 != t2) goto L408e48;
+v1 = a1 ^ v0;
+v1 = zero < v1;
+a3 = a3 + 0x1;
+L408e34:
+t1 = a3 ^ t0;
+if (v1 == 0) goto L408e48;
+t1 = zero < t1;
+//nop;
+if (t1 != 0) goto L408d74;
+L408e48:
+v0 = v1;
+if (v1 != 0) goto L408e58;
+v0 = a3 ^ t0;
+v0 = zero < v0;
+L408e58:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_collect_expansion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L408e60:
+//collect_expansion:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = a1 < a0;
+s0 = a0;
+s2 = a1;
+// fdead 400a01ef MEM_U32(sp + 60) = ra;
+// fdead 400a01ef MEM_U32(sp + 56) = fp;
+// fdead 400a01ef MEM_U32(sp + 52) = gp;
+// fdead 400a01ef MEM_U32(sp + 48) = s7;
+// fdead 400a01ef MEM_U32(sp + 44) = s6;
+// fdead 400a01ef MEM_U32(sp + 40) = s5;
+// fdead 400a01ef MEM_U32(sp + 36) = s4;
+// fdead 400a01ef MEM_U32(sp + 32) = s3;
+// fdead 400a01ef MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 128) = a2;
+MEM_U32(sp + 132) = a3;
+MEM_U32(sp + 96) = zero;
+MEM_U32(sp + 92) = zero;
+MEM_U32(sp + 88) = zero;
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 72) = zero;
+if (at == 0) goto L408ee8;
+//nop;
+MEM_U32(sp + 124) = a1;
+//nop;
+wrapper_abort(mem);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+s2 = MEM_U32(sp + 124);
+//nop;
+L408ee8:
+at = s0 < s2;
+s6 = s2;
+s1 = s0;
+if (at == 0) goto L408f44;
+v0 = 0x10006290;
+t6 = MEM_U8(s2 + -1);
+//nop;
+t7 = v0 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L408f44;
+L408f18:
+s6 = s6 + 0xffffffff;
+//nop;
+if (s0 >= s6) goto L408f44;
+t9 = MEM_U8(s6 + -1);
+//nop;
+t0 = v0 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L408f18;
+L408f44:
+v0 = 0x10006290;
+t8 = s2 - s6;
+if (s0 >= s6) goto L408f9c;
+t2 = MEM_U8(s0 + 0);
+//nop;
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+t0 = s1 - s0;
+if (t4 == 0) goto L408fa0;
+L408f70:
+s1 = s1 + 0x1;
+t0 = s1 - s0;
+if (s1 >= s6) goto L408fa0;
+t5 = MEM_U8(s1 + 0);
+//nop;
+t6 = v0 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L408f70;
+L408f9c:
+t0 = s1 - s0;
+L408fa0:
+t1 = t0 << 1;
+t9 = t8 << 1;
+t2 = t9 + t1;
+t3 = s6 - s1;
+//nop;
+a1 = t2 + t3;
+a1 = a1 + 0x17;
+MEM_U32(sp + 84) = a1;
+s1 = s0;
+a0 = 0x1;
+MEM_U32(sp + 124) = s2;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U32(sp + 128);
+// bdead 408621cb gp = MEM_U32(sp + 52);
+MEM_U32(sp + 116) = v0;
+s7 = v0 + 0x14;
+at = s0 < s6;
+MEM_U32(v0 + 8) = s7;
+s2 = s7;
+MEM_U32(v0 + 0) = t4;
+if (at == 0) goto L409050;
+t5 = MEM_U8(s0 + 0);
+t6 = 0x10006290;
+//nop;
+t7 = t5 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+t0 = 0xa;
+if (t8 == 0) goto L409050;
+L409014:
+MEM_U8(s2 + 0) = (uint8_t)t0;
+t9 = MEM_U8(s1 + 0);
+s1 = s1 + 0x1;
+at = s1 < s6;
+s2 = s2 + 0x2;
+MEM_U8(s2 + -1) = (uint8_t)t9;
+if (at == 0) goto L409050;
+t1 = MEM_U8(s1 + 0);
+t2 = 0x10006290;
+//nop;
+t3 = t1 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+t0 = 0xa;
+if (t4 != 0) goto L409014;
+L409050:
+t3 = MEM_U32(sp + 72);
+if (s1 >= s6) goto L4096d0;
+s5 = 0x10006190;
+fp = 0x5c;
+L409064:
+MEM_U32(sp + 68) = zero;
+s4 = MEM_U8(s1 + 0);
+t5 = MEM_U32(sp + 76);
+t7 = 0x10002d3c;
+t6 = t5 + 0x1;
+MEM_U32(sp + 76) = t6;
+MEM_U32(sp + 72) = zero;
+MEM_U8(s2 + 0) = (uint8_t)s4;
+t7 = MEM_U32(t7 + 0);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+if (t7 != 0) goto L409314;
+at = 0x22;
+if (s4 == at) {
+at = 0x23;
+goto L4090c0;}
+at = 0x23;
+if (s4 == at) {
+at = 0x27;
+goto L40917c;}
+at = 0x27;
+if (s4 == at) {
+at = s1 < s6;
+goto L4090c4;}
+at = s1 < s6;
+at = s1 < s6;
+if (s4 == fp) goto L409134;
+//nop;
+goto L40942c;
+L4090c0:
+at = s1 < s6;
+L4090c4:
+//nop;
+if (at == 0) goto L409120;
+v0 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s4 == v0) goto L409120;
+L4090dc:
+MEM_U8(s2 + 0) = (uint8_t)v0;
+t8 = MEM_U8(s1 + 0);
+s2 = s2 + 0x1;
+//nop;
+if (fp != t8) goto L409100;
+t0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t0;
+L409100:
+s1 = s1 + 0x1;
+//nop;
+if (s1 >= s6) goto L409120;
+v0 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (s4 != v0) goto L4090dc;
+L409120:
+t9 = MEM_U8(s1 + 0);
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t9;
+goto L40942c;
+L409134:
+if (at == 0) {
+at = s1 < s6;
+goto L409160;}
+at = s1 < s6;
+v0 = MEM_U8(s1 + 0);
+at = 0x23;
+if (v0 != at) {
+at = s1 < s6;
+goto L409160;}
+at = s1 < s6;
+MEM_U8(s2 + -1) = (uint8_t)v0;
+s2 = s2 + 0x0;
+s1 = s1 + 0x1;
+goto L40942c;
+// fdead 0 at = s1 < s6;
+L409160:
+//nop;
+if (at == 0) goto L40942c;
+t1 = MEM_U8(s1 + 0);
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t1;
+goto L40942c;
+L40917c:
+//nop;
+if (s1 >= s6) goto L409288;
+t2 = MEM_U8(s1 + 0);
+at = 0x23;
+//nop;
+if (t2 != at) goto L409288;
+s2 = s2 + 0xffffffff;
+//nop;
+if (s7 >= s2) goto L4091f0;
+t3 = MEM_U8(s2 + -1);
+//nop;
+t4 = s5 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L4091f0;
+L4091c4:
+s2 = s2 + 0xffffffff;
+//nop;
+if (s7 >= s2) goto L4091f0;
+t6 = MEM_U8(s2 + -1);
+//nop;
+t7 = s5 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L4091c4;
+L4091f0:
+t0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t9 = s5 + t0;
+t1 = MEM_U8(t9 + 0);
+t5 = 0x1;
+at = 0x1;
+if (t1 == 0) goto L409228;
+L40920c:
+t2 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t3 = s5 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L40920c;
+L409228:
+t6 = MEM_U32(sp + 76);
+MEM_U32(sp + 92) = s1;
+MEM_U32(sp + 72) = t5;
+if (t6 != at) goto L40942c;
+t7 = 0x10002d28;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40942c;
+t8 = 0x10002d2c;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L40942c;
+a0 = 0x10001300;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1ec01c3 gp = MEM_U32(sp + 52);
+//nop;
+goto L40942c;
+L409288:
+v0 = MEM_U8(s1 + 0);
+s2 = s2 + 0xffffffff;
+t0 = s5 + v0;
+t9 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L4092c0;
+L4092a4:
+v0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t1 = s5 + v0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L4092a4;
+L4092c0:
+//nop;
+if (s1 == s6) goto L4092ec;
+t3 = 0x10006090;
+t6 = MEM_U32(sp + 128);
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L4092ec;
+//nop;
+if ((int)t6 > 0) goto L40930c;
+L4092ec:
+a0 = 0x1000135c;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ec01c3 gp = MEM_U32(sp + 52);
+//nop;
+goto L40942c;
+L40930c:
+MEM_U32(sp + 88) = s1;
+goto L40942c;
+L409314:
+at = 0x22;
+if (s4 == at) {
+at = 0x27;
+goto L409340;}
+at = 0x27;
+if (s4 == at) {
+at = 0x2f;
+goto L409340;}
+at = 0x2f;
+t1 = MEM_U32(sp + 80);
+if (s4 == at) goto L4093ac;
+t0 = MEM_U32(sp + 80);
+if (s4 == fp) goto L40936c;
+//nop;
+goto L40942c;
+L409340:
+t7 = MEM_U32(sp + 80);
+//nop;
+//nop;
+if (t7 == 0) goto L409360;
+//nop;
+if (s4 != t7) goto L40942c;
+MEM_U32(sp + 80) = zero;
+goto L40942c;
+L409360:
+MEM_U32(sp + 80) = s4;
+goto L40942c;
+// fdead 0 t0 = MEM_U32(sp + 80);
+L40936c:
+at = s1 < s6;
+//nop;
+if (t0 == 0) goto L40942c;
+//nop;
+if (at == 0) goto L40942c;
+v0 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (t0 == v0) goto L409398;
+//nop;
+if (fp != v0) goto L40942c;
+L409398:
+MEM_U8(s2 + 0) = (uint8_t)v0;
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+goto L4096c0;
+// fdead 0 t1 = MEM_U32(sp + 80);
+L4093ac:
+//nop;
+//nop;
+if (t1 != 0) goto L40942c;
+t2 = MEM_U8(s1 + 0);
+at = 0x2a;
+//nop;
+if (t2 != at) goto L40942c;
+s1 = s1 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s1 >= s6) goto L409428;
+t3 = MEM_U8(s1 + -2);
+at = 0x2a;
+//nop;
+if (t3 != at) goto L4093f8;
+t4 = MEM_U8(s1 + -1);
+at = 0x2f;
+//nop;
+if (t4 == at) goto L409428;
+L4093f8:
+s1 = s1 + 0x1;
+//nop;
+if (s1 >= s6) goto L409428;
+t5 = MEM_U8(s1 + -2);
+at = 0x2a;
+//nop;
+if (t5 != at) goto L4093f8;
+t6 = MEM_U8(s1 + -1);
+at = 0x2f;
+//nop;
+if (t6 != at) goto L4093f8;
+L409428:
+MEM_U32(sp + 92) = s1;
+L40942c:
+t7 = 0x10005f90;
+t9 = MEM_U32(sp + 128);
+t8 = s4 + t7;
+t0 = MEM_U8(t8 + 0);
+//nop;
+at = s1 < s6;
+if (t0 == 0) goto L4096c4;
+s3 = s1 + 0xffffffff;
+if ((int)t9 <= 0) goto L4096c0;
+s2 = s2 + 0xffffffff;
+if (s1 == s6) goto L4094a0;
+t1 = MEM_U8(s1 + 0);
+//nop;
+t2 = t1 + t7;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L4094a0;
+L409474:
+s1 = s1 + 0x1;
+//nop;
+if (s1 == s6) goto L4094a0;
+t4 = MEM_U8(s1 + 0);
+t5 = 0x10005f90;
+//nop;
+t6 = t4 + t5;
+t8 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L409474;
+L4094a0:
+t0 = 0x10006090;
+s0 = MEM_U32(sp + 132);
+t9 = s4 + t0;
+t1 = MEM_U8(t9 + 0);
+//nop;
+t5 = MEM_U32(sp + 68);
+if (t1 == 0) goto L409624;
+t5 = MEM_U32(sp + 68);
+if (s0 == 0) goto L409624;
+L4094c4:
+a0 = MEM_U32(s0 + 4);
+//nop;
+t2 = MEM_U8(a0 + 0);
+//nop;
+//nop;
+if (s4 != t2) goto L409610;
+t3 = MEM_U32(s0 + 8);
+a2 = s1 - s3;
+//nop;
+if (a2 != t3) goto L409610;
+//nop;
+a1 = s3;
+//nop;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fe018b gp = MEM_U32(sp + 52);
+//nop;
+if (v0 != 0) goto L409610;
+//nop;
+a0 = 0x10;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c1de018b gp = MEM_U32(sp + 52);
+MEM_U32(v0 + 0) = zero;
+t4 = MEM_U32(sp + 92);
+t6 = 0x10002d3c;
+t5 = t4 ^ s3;
+t5 = t5 < 0x1;
+MEM_U8(v0 + 5) = (uint8_t)t5;
+MEM_U8(v0 + 6) = (uint8_t)zero;
+t6 = MEM_U32(t6 + 0);
+t3 = s2 - s7;
+s7 = s2;
+if (t6 == 0) goto L40955c;
+t8 = MEM_U32(sp + 80);
+//nop;
+t0 = zero < t8;
+MEM_U8(v0 + 4) = (uint8_t)t0;
+goto L409570;
+L40955c:
+t9 = MEM_U32(sp + 88);
+//nop;
+t1 = t9 ^ s3;
+t1 = t1 < 0x1;
+MEM_U8(v0 + 4) = (uint8_t)t1;
+L409570:
+v1 = MEM_U32(sp + 96);
+t7 = MEM_U32(sp + 116);
+//nop;
+if (v1 != 0) goto L409588;
+MEM_U32(t7 + 12) = v0;
+goto L40958c;
+L409588:
+MEM_U32(v1 + 0) = v0;
+L40958c:
+MEM_U32(sp + 96) = v0;
+t2 = MEM_U32(s0 + 12);
+MEM_U32(v0 + 8) = t3;
+MEM_U32(v0 + 12) = t2;
+t4 = MEM_U8(s1 + 0);
+v1 = s1;
+t5 = s5 + t4;
+t6 = MEM_U8(t5 + 0);
+t4 = 0x1;
+t1 = v1 + 0x2;
+if (t6 == 0) goto L4095d8;
+L4095b8:
+t8 = MEM_U8(v1 + 1);
+v1 = v1 + 0x1;
+t0 = s5 + t8;
+t9 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L4095b8;
+t1 = v1 + 0x2;
+L4095d8:
+//nop;
+if (s6 < t1) goto L409608;
+t7 = MEM_U8(v1 + 0);
+at = 0x23;
+//nop;
+if (t7 != at) goto L409608;
+t2 = MEM_U8(v1 + 1);
+at = 0x23;
+t3 = 0x1;
+if (t2 != at) goto L409608;
+MEM_U8(v0 + 6) = (uint8_t)t3;
+L409608:
+MEM_U32(sp + 68) = t4;
+goto L409620;
+L409610:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L4094c4;
+L409620:
+t5 = MEM_U32(sp + 68);
+L409624:
+t6 = MEM_U32(sp + 88);
+a1 = t6 ^ s3;
+if (t5 != 0) goto L4096c0;
+v1 = s1;
+a1 = a1 < 0x1;
+if (s3 == s1) {
+s1 = s3;
+goto L40969c;}
+s1 = s3;
+a0 = v1 - s3;
+t8 = a0 & 0x3;
+v0 = t8 + s3;
+if (t8 == 0) goto L40966c;
+L409650:
+t0 = MEM_U8(s1 + 0);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t0;
+if (v0 != s1) goto L409650;
+//nop;
+if (s1 == v1) goto L40969c;
+L40966c:
+t9 = MEM_U8(s1 + 0);
+s1 = s1 + 0x4;
+MEM_U8(s2 + 0) = (uint8_t)t9;
+t1 = MEM_U8(s1 + -3);
+s2 = s2 + 0x4;
+MEM_U8(s2 + -3) = (uint8_t)t1;
+t7 = MEM_U8(s1 + -2);
+//nop;
+MEM_U8(s2 + -2) = (uint8_t)t7;
+t2 = MEM_U8(s1 + -1);
+MEM_U8(s2 + -1) = (uint8_t)t2;
+if (s1 != v1) goto L40966c;
+L40969c:
+at = s1 < s6;
+if (a1 == 0) goto L4096c4;
+a0 = 0x10001394;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1cc01c3 gp = MEM_U32(sp + 52);
+//nop;
+L4096c0:
+at = s1 < s6;
+L4096c4:
+//nop;
+if (at != 0) goto L409064;
+t3 = MEM_U32(sp + 72);
+L4096d0:
+//nop;
+v0 = MEM_U32(sp + 124);
+if (t3 == 0) goto L40972c;
+t4 = 0x10002d28;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+v0 = MEM_U32(sp + 124);
+if (t4 == 0) goto L40972c;
+t5 = 0x10002d2c;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+v0 = MEM_U32(sp + 124);
+if (t5 != 0) goto L40972c;
+a0 = 0x100013cc;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40880003 gp = MEM_U32(sp + 52);
+//nop;
+v0 = MEM_U32(sp + 124);
+L40972c:
+//nop;
+if (s6 >= v0) {
+at = s6 < v0;
+goto L4097a8;}
+//nop;
+if (s6 >= v0) goto L4097cc;
+t6 = MEM_U8(s6 + 0);
+t8 = 0x10006290;
+//nop;
+t0 = t6 + t8;
+t9 = MEM_U8(t0 + 0);
+//nop;
+t1 = 0xa;
+if (t9 == 0) goto L4097cc;
+L409764:
+MEM_U8(s2 + 0) = (uint8_t)t1;
+t7 = MEM_U8(s6 + 0);
+s6 = s6 + 0x1;
+at = s6 < v0;
+s2 = s2 + 0x2;
+MEM_U8(s2 + -1) = (uint8_t)t7;
+if (at == 0) goto L4097cc;
+t2 = MEM_U8(s6 + 0);
+t3 = 0x10006290;
+//nop;
+t4 = t2 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+t1 = 0xa;
+if (t5 != 0) goto L409764;
+MEM_U8(s2 + 0) = (uint8_t)zero;
+goto L4097d0;
+L4097a8:
+t6 = 0x10002d3c;
+t8 = 0xa;
+t6 = MEM_U32(t6 + 0);
+t0 = 0x20;
+//nop;
+if (t6 != 0) goto L4097cc;
+MEM_U8(s2 + 0) = (uint8_t)t8;
+MEM_U8(s2 + 1) = (uint8_t)t0;
+s2 = s2 + 0x2;
+L4097cc:
+MEM_U8(s2 + 0) = (uint8_t)zero;
+L4097d0:
+t9 = MEM_U32(sp + 116);
+//nop;
+t1 = MEM_U32(t9 + 8);
+//nop;
+v0 = s2 - t1;
+MEM_U32(t9 + 4) = v0;
+t7 = MEM_U32(sp + 84);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 60);
+if ((int)v0 < (int)t7) goto L409818;
+//nop;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 60);
+L409818:
+v0 = MEM_U32(sp + 116);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x78;
+return v0;
+}
+
+static uint64_t f_do_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L409848:
+//do_line:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+sp = sp + 0xffffff88;
+t6 = MEM_U32(t6 + 0);
+t8 = 0x10002d50;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+MEM_U32(sp + 124) = a1;
+MEM_U32(sp + 112) = t9;
+//nop;
+MEM_U32(sp + 128) = a2;
+a2 = MEM_U32(sp + 124);
+a1 = a0;
+// fdead 460181e3 MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 120) = a0;
+MEM_U32(sp + 132) = a3;
+// fdead 460181e3 MEM_U32(sp + 32) = gp;
+// fdead 460181e3 MEM_U32(sp + 28) = s1;
+// fdead 460181e3 MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 68) = zero;
+a3 = zero;
+a0 = sp + 0x4c;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(sp + 92);
+a2 = 0x10006190;
+t1 = MEM_U8(s0 + 0);
+//nop;
+t2 = a2 + t1;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L4098f8;
+L4098dc:
+t4 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t5 = a2 + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L4098dc;
+L4098f8:
+v1 = MEM_U8(s0 + 0);
+a1 = 0xfb504f0;
+//nop;
+t7 = v1 + a1;
+t8 = MEM_U8(t7 + 1);
+//nop;
+t9 = t8 & 0x4;
+//nop;
+if (t9 != 0) goto L40993c;
+a0 = 0x10001424;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+L40993c:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_atoi(mem, a0);
+// bdead 4002010b gp = MEM_U32(sp + 32);
+t0 = v0 + 0xffffffff;
+MEM_U32(sp + 72) = t0;
+v1 = MEM_U8(s0 + 0);
+a1 = 0xfb504f0;
+a2 = 0x10006190;
+t1 = v1 + a1;
+t2 = MEM_U8(t1 + 1);
+v0 = 0x22;
+t3 = t2 & 0x4;
+//nop;
+if (t3 == 0) goto L40999c;
+L40997c:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t4 = v1 + a1;
+t5 = MEM_U8(t4 + 1);
+//nop;
+t6 = t5 & 0x4;
+//nop;
+if (t6 != 0) goto L40997c;
+L40999c:
+t0 = a2 + v1;
+if (v1 == 0) goto L4099e0;
+t7 = 0x10006290;
+//nop;
+t8 = v1 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L4099e0;
+a0 = 0x10001444;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+L4099e0:
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L409a0c;
+L4099f0:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t2 = a2 + v1;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L4099f0;
+L409a0c:
+//nop;
+if (v0 != v1) goto L409c40;
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+a0 = s0;
+if (v1 == 0) goto L409a44;
+//nop;
+if (v0 == v1) goto L409a44;
+L409a2c:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (v1 == 0) goto L409a44;
+//nop;
+if (v0 != v1) goto L409a2c;
+L409a44:
+//nop;
+if (v0 == v1) goto L409a6c;
+a0 = 0x10001464;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+L409a6c:
+v1 = MEM_U8(s0 + 1);
+s1 = s0 - a0;
+t4 = a2 + v1;
+t5 = MEM_U8(t4 + 0);
+s0 = s0 + 0x1;
+at = 0x31;
+if (t5 == 0) goto L409aa4;
+L409a88:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t6 = a2 + v1;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L409a88;
+L409aa4:
+a1 = s1;
+if (v1 == 0) goto L409b50;
+t8 = 0x1;
+if (v1 != at) goto L409abc;
+MEM_U32(sp + 68) = t8;
+goto L409af0;
+L409abc:
+at = 0x32;
+t9 = 0x2;
+if (v1 != at) goto L409ad0;
+MEM_U32(sp + 68) = t9;
+goto L409af0;
+L409ad0:
+a0 = 0x10001484;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+L409af0:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t0 = a2 + v1;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L409b28;
+L409b0c:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t2 = a2 + v1;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L409b0c;
+L409b28:
+//nop;
+if (v1 == 0) goto L409b50;
+a0 = 0x100014a4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+L409b50:
+//nop;
+a2 = 0x25;
+MEM_U32(sp + 56) = a0;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t4 = v0 << 2;
+t5 = 0x10002be0;
+//nop;
+t5 = t5;
+v1 = t4 + t5;
+s0 = MEM_U32(v1 + 0);
+MEM_U32(sp + 60) = v1;
+//nop;
+if (s0 == 0) goto L409bd4;
+L409b88:
+t6 = MEM_U32(s0 + 16);
+a1 = MEM_U32(sp + 56);
+//nop;
+if (s1 != t6) goto L409bc4;
+//nop;
+a0 = MEM_U32(s0 + 24);
+a2 = s1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L409bc4;
+t7 = MEM_U32(s0 + 24);
+t8 = MEM_U32(sp + 112);
+MEM_U32(t8 + 0) = t7;
+goto L409bd4;
+L409bc4:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L409b88;
+L409bd4:
+t3 = MEM_U32(sp + 72);
+if (s0 != 0) goto L409c6c;
+//nop;
+a0 = 0x1;
+a1 = s1 + 0x1d;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U32(sp + 60);
+// bdead 4404000b gp = MEM_U32(sp + 32);
+t0 = MEM_U32(t9 + 0);
+v1 = v0 + 0x1c;
+MEM_U32(v0 + 0) = t0;
+t1 = MEM_U32(sp + 60);
+a2 = s1;
+MEM_U32(t1 + 0) = v0;
+MEM_U32(v0 + 16) = s1;
+MEM_U32(v0 + 24) = v1;
+t2 = MEM_U32(sp + 112);
+//nop;
+MEM_U32(t2 + 0) = v1;
+//nop;
+a1 = MEM_U32(v0 + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+t3 = MEM_U32(sp + 72);
+goto L409c6c;
+L409c40:
+t3 = MEM_U32(sp + 72);
+if (v1 == 0) goto L409c6c;
+a0 = 0x100014c4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409ce8;
+// fdead 0 t3 = MEM_U32(sp + 72);
+L409c6c:
+a0 = MEM_U32(sp + 112);
+a2 = zero;
+MEM_U32(a0 + 4) = t3;
+//nop;
+a3 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 128);
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a0 = MEM_U32(sp + 128);
+t5 = MEM_U32(sp + 112);
+t0 = MEM_U32(a0 + 20);
+t1 = MEM_U32(a0 + 16);
+t6 = MEM_U32(t5 + 20);
+t7 = MEM_U32(t5 + 16);
+t3 = MEM_U32(a0 + 8);
+t9 = MEM_U32(t5 + 8);
+t2 = t0 - t1;
+t8 = t6 - t7;
+t4 = t3 - t2;
+a1 = t9 - t8;
+// bdead 40002079 gp = MEM_U32(sp + 32);
+// bdead 40000079 ra = MEM_U32(sp + 36);
+if ((int)a1 < (int)t4) goto L409ce8;
+//nop;
+//nop;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 36);
+L409ce8:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x78;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_undef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L409cf8:
+//do_undef:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = MEM_U8(a0 + 0);
+s2 = 0x10006190;
+s1 = a0;
+t6 = s2 + v0;
+t7 = MEM_U8(t6 + 0);
+s3 = a1;
+//nop;
+if (t7 == 0) goto L409d64;
+L409d48:
+v0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t8 = s2 + v0;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L409d48;
+L409d64:
+t0 = 0x10006090;
+//nop;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L409de4;
+at = 0xa;
+if (v0 == 0) goto L409d90;
+//nop;
+if (v0 != at) goto L409db0;
+L409d90:
+a0 = 0x100014e4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+//nop;
+goto L409de4;
+L409db0:
+t3 = 0x10002d2c;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L409de4;
+a0 = 0x10001518;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+//nop;
+L409de4:
+//nop;
+a0 = s1;
+a1 = 0xffffffff;
+a2 = 0xffffffff;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c01d9 gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 == 0) goto L409e64;
+L409e04:
+t4 = MEM_U32(v0 + 12);
+at = 0x17;
+//nop;
+if (t4 == at) goto L409e30;
+a0 = 0x10001554;
+//nop;
+a1 = MEM_U32(s0 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+//nop;
+L409e30:
+//nop;
+a0 = s0;
+//nop;
+f_delete_macro(mem, sp, a0);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = s1;
+//nop;
+a1 = 0xffffffff;
+a2 = 0xffffffff;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c01d9 gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 != 0) goto L409e04;
+L409e64:
+v0 = 0x10005f90;
+t5 = MEM_U8(s1 + 0);
+a0 = MEM_U32(sp + 56);
+t6 = v0 + t5;
+t7 = MEM_U8(t6 + 0);
+a2 = s1;
+at = s1 < s3;
+if (t7 == 0) goto L409eb0;
+//nop;
+if (s1 >= s3) goto L409eb0;
+L409e8c:
+t8 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t9 = v0 + t8;
+t0 = MEM_U8(t9 + 0);
+at = s1 < s3;
+//nop;
+if (t0 == 0) goto L409eb0;
+//nop;
+if (at != 0) goto L409e8c;
+L409eb0:
+t1 = 0x10002d30;
+a3 = s1 - a2;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L409ee4;
+//nop;
+a1 = 0x10001564;
+// bdead 401c01e1 t9 = t9;
+a1 = a1;
+func_404734(mem, sp, a0, a1, a2, a3);
+// bdead 401c01d9 gp = MEM_U32(sp + 40);
+//nop;
+L409ee4:
+t2 = 0x10002d28;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+// bdead 401c01d9 ra = MEM_U32(sp + 44);
+if (t2 == 0) goto L409f74;
+v0 = MEM_U8(s1 + 0);
+//nop;
+t3 = s2 + v0;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L409f34;
+L409f18:
+t5 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t6 = s2 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L409f18;
+L409f34:
+// bdead 400001d9 ra = MEM_U32(sp + 44);
+if (s1 == s3) goto L409f74;
+t8 = 0x10002d2c;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// bdead 400001d9 ra = MEM_U32(sp + 44);
+if (t8 != 0) goto L409f74;
+a0 = 0x1000156c;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 40);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 44);
+L409f74:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_do_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L409f8c:
+//do_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 48) = a0;
+v0 = a1 - a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+a0 = v0 + 0x1;
+MEM_U32(sp + 36) = v0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+//nop;
+a2 = MEM_U32(sp + 36);
+a1 = v0;
+MEM_U32(sp + 40) = v0;
+wrapper_bcopy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 40);
+t7 = MEM_U32(sp + 36);
+// bdead 40010183 gp = MEM_U32(sp + 24);
+t8 = a3 + t7;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+t9 = MEM_U8(a3 + 0);
+v0 = 0x10006190;
+//nop;
+t0 = v0 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L40a030;
+L40a014:
+t2 = MEM_U8(a3 + 1);
+a3 = a3 + 0x1;
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L40a014;
+L40a030:
+a0 = 0x100015a8;
+//nop;
+a1 = a3;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x30;
+return;
+}
+
+static uint64_t f_do_once(uint8_t *mem, uint32_t sp, uint32_t v0) {
+const uint32_t zero = 0;
+uint32_t v1 = 0, a0 = 0, a1 = 0, t0 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40a06c:
+//do_once:
+//nop;
+//nop;
+//nop;
+v1 = 0x10000030;
+sp = sp + 0xffffffd0;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000001b MEM_U32(sp + 28) = ra;
+// fdead 4000001b MEM_U32(sp + 24) = gp;
+a1 = zero;
+if ((int)v1 < 0) goto L40a0d0;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10002d50;
+t6 = t6 << 2;
+v0 = t6 + v1;
+L40a0a8:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40a0c0;
+a1 = v0;
+goto L40a0d0;
+L40a0c0:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= v1) goto L40a0a8;
+L40a0d0:
+// bdead 40000059 ra = MEM_U32(sp + 28);
+if (a1 == 0) goto L40a128;
+//nop;
+a0 = 0x8;
+MEM_U32(sp + 40) = a1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+v1 = 0x10000074;
+MEM_U32(sp + 36) = v0;
+t9 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 0) = t9;
+MEM_U32(v1 + 0) = v0;
+//nop;
+a0 = MEM_U32(a1 + 0);
+//nop;
+v0 = f_savestring(mem, sp, a0);
+t0 = MEM_U32(sp + 36);
+// bdead 219 gp = MEM_U32(sp + 24);
+MEM_U32(t0 + 4) = v0;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40a128:
+// bdead 19 sp = sp + 0x30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_pragma(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0;
+uint64_t temp64;
+L40a134:
+//do_pragma:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+v0 = MEM_U8(a0 + 0);
+v1 = 0x20;
+a1 = 0x9;
+if (v1 == v0) goto L40a168;
+//nop;
+if (a1 != v0) goto L40a180;
+L40a168:
+v0 = MEM_U8(a0 + 1);
+a1 = 0x9;
+a0 = a0 + 0x1;
+if (v1 == v0) goto L40a168;
+//nop;
+if (a1 == v0) goto L40a168;
+L40a180:
+a1 = 0x100015b4;
+//nop;
+a2 = 0x4;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+// bdead 40000019 ra = MEM_U32(sp + 28);
+if (v0 != 0) goto L40a1bc;
+//nop;
+//nop;
+//nop;
+temp64 = f_do_once(mem, sp, v0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40a1bc:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_do_ident(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L40a1c8:
+//do_ident:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002d28;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+// fdead 400081e7 MEM_U32(sp + 24) = gp;
+if ((int)t6 < (int)0x2) goto L40a224;
+t7 = 0x10002d2c;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+// bdead 400001d9 ra = MEM_U32(sp + 28);
+if (t7 != 0) goto L40a228;
+a0 = 0x100015bc;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L40a224:
+// bdead 19 ra = MEM_U32(sp + 28);
+L40a228:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t f_do_sccs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0;
+uint64_t temp64;
+L40a234:
+//do_sccs:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002d28;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+// fdead 400081e3 MEM_U32(sp + 24) = gp;
+if (t6 == 0) goto L40a274;
+a0 = 0x100015ec;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L40a274:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_if(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a284:
+//do_if:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffd8;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+MEM_U32(sp + 32) = t9;
+//nop;
+// fdead 460181e3 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 44) = a1;
+// fdead 460181e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1 - a0;
+v0 = f_eval_if_expression(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+//nop;
+a1 = v0 < 0x1;
+a2 = 0x5;
+temp64 = f_conditional_skip(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_elif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a2fc:
+//do_elif:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+t8 = 0x10002d50;
+t7 = t6 << 3;
+t7 = t7 + t6;
+v1 = 0x100001b4;
+t7 = t7 << 2;
+v0 = t7 + t8;
+t9 = MEM_U32(v0 + 28);
+v1 = MEM_U32(v1 + 0);
+// fdead 460181fb MEM_U32(sp + 28) = ra;
+// fdead 460181fb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+MEM_U32(sp + 32) = v0;
+if (v1 != t9) goto L40a374;
+a0 = 0x10001608;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40a534;
+L40a374:
+v0 = MEM_U32(v1 + 16);
+at = 0x5;
+if (v0 == at) {
+at = 0x8;
+goto L40a47c;}
+at = 0x8;
+//nop;
+if (v0 == at) goto L40a47c;
+a0 = 0x10001628;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x100001b4;
+a0 = 0xfb528e4;
+t0 = MEM_U32(t0 + 0);
+a1 = 0x1000163c;
+//nop;
+a2 = MEM_U32(t0 + 8);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+t2 = MEM_U32(sp + 32);
+t1 = 0x100001b4;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+a0 = MEM_U32(t1 + 4);
+//nop;
+//nop;
+if (a0 == 0) goto L40a44c;
+a1 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (a1 == 0) goto L40a44c;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40a44c;
+t3 = 0x100001b4;
+a0 = 0xfb528e4;
+t3 = MEM_U32(t3 + 0);
+a1 = 0x10001650;
+//nop;
+a2 = MEM_U32(t3 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+//nop;
+L40a44c:
+a0 = 0xfb528e4;
+a1 = 0x1000165c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100001b4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40a47c:
+t5 = 0x100001b4;
+t4 = 0x8;
+MEM_U32(v1 + 16) = t4;
+t5 = MEM_U32(t5 + 0);
+t8 = MEM_U32(sp + 44);
+t6 = MEM_U32(t5 + 12);
+a0 = MEM_U32(sp + 40);
+//nop;
+if (t6 == 0) goto L40a4bc;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = zero;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40a534;
+L40a4bc:
+//nop;
+a1 = t8 - a0;
+//nop;
+v0 = f_eval_if_expression(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L40a4f4;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = zero;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40a534;
+L40a4f4:
+v1 = 0x100001b4;
+a2 = 0x1;
+v1 = MEM_U32(v1 + 0);
+a3 = zero;
+t9 = MEM_U32(v1 + 12);
+//nop;
+t0 = t9 + 0x1;
+MEM_U32(v1 + 12) = t0;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 32);
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40a534:
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_eval_if_expression(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+uint64_t temp64;
+L40a540:
+//eval_if_expression:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+MEM_U32(sp + 88) = a0;
+a0 = 0x10001660;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 92) = a1;
+t6 = 0xffffffff;
+// fdead 400081eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = 0xffffffff;
+a2 = 0x19;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 88);
+t7 = MEM_U32(sp + 92);
+//nop;
+MEM_U32(sp + 48) = v0;
+a0 = sp + 0x34;
+a3 = zero;
+a2 = a1 + t7;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 48);
+//nop;
+//nop;
+//nop;
+f_delete_macro(mem, sp, a0);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+//nop;
+v0 = f_parse_c_expression(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+MEM_U32(sp + 44) = v0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000001 ra = MEM_U32(sp + 36);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static uint64_t f_do_xifdef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a604:
+//do_xifdef:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+sp = sp + 0xffffffd0;
+t6 = MEM_U32(t6 + 0);
+t8 = 0x10002d50;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+// fdead 420181e3 MEM_U32(sp + 20) = s0;
+t9 = t7 + t8;
+s0 = a0;
+// fdead 460381e3 MEM_U32(sp + 28) = ra;
+// fdead 460381e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+MEM_U32(sp + 40) = t9;
+a0 = MEM_U8(a0 + 0);
+v0 = 0x10006190;
+//nop;
+t0 = v0 + a0;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L40a688;
+L40a66c:
+a0 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t2 = v0 + a0;
+t3 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L40a66c;
+L40a688:
+//nop;
+if (a1 == s0) goto L40a6d4;
+t4 = MEM_U8(a1 + -1);
+//nop;
+t5 = v0 + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40a6d4;
+L40a6ac:
+a1 = a1 + 0xffffffff;
+//nop;
+if (a1 == s0) goto L40a6d4;
+t7 = MEM_U8(a1 + -1);
+//nop;
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L40a6ac;
+L40a6d4:
+v0 = 0x10005f90;
+t5 = MEM_U32(sp + 60);
+t0 = v0 + a0;
+t1 = MEM_U8(t0 + 0);
+v1 = s0;
+//nop;
+if (t1 == 0) goto L40a70c;
+L40a6f0:
+t2 = MEM_U8(v1 + 1);
+v1 = v1 + 0x1;
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L40a6f0;
+L40a70c:
+//nop;
+if (v1 != s0) goto L40a784;
+t7 = 0x10002d3c;
+s0 = MEM_U32(t5 + 12);
+t7 = MEM_U32(t7 + 0);
+t6 = s0 ^ 0x3;
+s0 = t6 < 0x1;
+if (t7 != 0) goto L40a878;
+t8 = 0x10002d2c;
+t9 = MEM_U32(sp + 60);
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L40a878;
+//nop;
+if (v1 != a1) goto L40a758;
+a0 = 0x10001668;
+a0 = a0;
+goto L40a764;
+L40a758:
+a0 = 0x10001680;
+//nop;
+a0 = a0;
+L40a764:
+a1 = MEM_U32(t9 + 8);
+//nop;
+//nop;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+//nop;
+goto L40a878;
+L40a784:
+t0 = 0x10002d28;
+at = a0 < 0x30;
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (t0 == 0) goto L40a7ec;
+if (at != 0) {
+at = a0 < 0x3a;
+goto L40a7ec;}
+//nop;
+if (a0 >= 0x3a) goto L40a7ec;
+t1 = 0x10002d2c;
+t2 = MEM_U32(sp + 60);
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L40a848;
+a0 = 0x100016a8;
+//nop;
+a1 = MEM_U32(t2 + 8);
+MEM_U32(sp + 36) = v1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+//nop;
+goto L40a848;
+L40a7ec:
+//nop;
+if (v1 == a1) goto L40a848;
+t3 = 0x10002d3c;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L40a848;
+t4 = 0x10002d2c;
+t5 = MEM_U32(sp + 60);
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L40a848;
+a0 = 0x100016cc;
+//nop;
+a1 = MEM_U32(t5 + 8);
+MEM_U32(sp + 36) = v1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+//nop;
+L40a848:
+//nop;
+a0 = s0;
+a1 = v1 - s0;
+a2 = 0xffffffff;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U32(sp + 60);
+t6 = v0 < 0x1;
+t8 = MEM_U32(t7 + 12);
+// bdead 42008001 gp = MEM_U32(sp + 24);
+t9 = t8 ^ 0x4;
+t9 = t9 < 0x1;
+s0 = t6 ^ t9;
+L40a878:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = s0;
+a2 = 0x5;
+temp64 = f_conditional_skip(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_conditional_skip(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a8a0:
+//conditional_skip:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+a1 = 0x14;
+a0 = 0x1;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a0 = MEM_U32(sp + 32);
+// bdead 4000002b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(a0 + 0);
+v1 = 0x100001b4;
+MEM_U32(v0 + 4) = t6;
+t7 = MEM_U32(a0 + 4);
+//nop;
+MEM_U32(v0 + 8) = t7;
+t8 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(sp + 40);
+MEM_U32(v1 + 0) = v0;
+MEM_U32(v0 + 16) = t9;
+t1 = MEM_U32(sp + 36);
+//nop;
+//nop;
+if (t1 == 0) goto L40a938;
+//nop;
+a1 = zero;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40a96c;
+L40a938:
+v0 = MEM_U32(v1 + 0);
+a1 = 0x10004970;
+t2 = MEM_U32(v0 + 12);
+a2 = 0x1;
+t3 = t2 + 0x1;
+MEM_U32(v0 + 12) = t3;
+//nop;
+a3 = zero;
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40a96c:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_skip_if_group(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40a978:
+//skip_if_group:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 100) = a1;
+s0 = MEM_U32(a0 + 20);
+t8 = MEM_U32(a0 + 8);
+t7 = MEM_U32(a0 + 16);
+t0 = 0x100001b4;
+t9 = t7 + t8;
+t0 = MEM_U32(t0 + 0);
+at = s0 < t9;
+MEM_U32(sp + 84) = t9;
+MEM_U32(sp + 72) = s0;
+MEM_U32(sp + 76) = t0;
+if (at == 0) goto L40b024;
+fp = 0x10005f90;
+s7 = 0x10006190;
+s6 = 0x5c;
+s4 = 0xa;
+s2 = 0x2a;
+s1 = 0x2f;
+L40aa00:
+v0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+t1 = v0 + 0xfffffff6;
+if (v0 < 0x30) goto L40aa24;
+t5 = MEM_U32(sp + 84);
+if (v0 == s6) goto L40ab1c;
+t8 = MEM_U32(sp + 84);
+goto L40b014;
+L40aa24:
+t8 = MEM_U32(sp + 84);
+if (t1 >= 0x26) goto L40b014;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40ab54;
+case 1: goto L40b010;
+case 2: goto L40b010;
+case 3: goto L40b010;
+case 4: goto L40b010;
+case 5: goto L40b010;
+case 6: goto L40b010;
+case 7: goto L40b010;
+case 8: goto L40b010;
+case 9: goto L40b010;
+case 10: goto L40b010;
+case 11: goto L40b010;
+case 12: goto L40b010;
+case 13: goto L40b010;
+case 14: goto L40b010;
+case 15: goto L40b010;
+case 16: goto L40b010;
+case 17: goto L40b010;
+case 18: goto L40b010;
+case 19: goto L40b010;
+case 20: goto L40b010;
+case 21: goto L40b010;
+case 22: goto L40b010;
+case 23: goto L40b010;
+case 24: goto L40aadc;
+case 25: goto L40ab74;
+case 26: goto L40b010;
+case 27: goto L40b010;
+case 28: goto L40b010;
+case 29: goto L40aadc;
+case 30: goto L40b010;
+case 31: goto L40b010;
+case 32: goto L40b010;
+case 33: goto L40b010;
+case 34: goto L40b010;
+case 35: goto L40b010;
+case 36: goto L40b010;
+case 37: goto L40aa50;
+}
+L40aa50:
+a0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s6 != a0) goto L40aa8c;
+t2 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s4 != t2) goto L40aa8c;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+a0 = MEM_U8(s0 + 0);
+//nop;
+L40aa8c:
+//nop;
+if (s2 == a0) goto L40aab4;
+t3 = 0x10002d10;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+t8 = MEM_U32(sp + 84);
+if (t3 == 0) goto L40b014;
+t8 = MEM_U32(sp + 84);
+if (s1 != a0) goto L40b014;
+L40aab4:
+a0 = MEM_U32(sp + 96);
+s0 = s0 + 0x1;
+MEM_U32(a0 + 20) = s0;
+//nop;
+a1 = a0 + 0x4;
+//nop;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ac001b gp = MEM_U32(sp + 60);
+s0 = v0;
+goto L40b010;
+L40aadc:
+t4 = 0x10002d3c;
+v0 = MEM_U32(sp + 96);
+t4 = MEM_U32(t4 + 0);
+a1 = MEM_U32(sp + 84);
+a0 = s0 + 0xffffffff;
+if (t4 != 0) goto L40b010;
+//nop;
+a2 = MEM_U32(v0 + 4);
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = zero;
+a3 = v0 + 0x4;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ac001b gp = MEM_U32(sp + 60);
+s0 = v0;
+goto L40b010;
+// fdead 0 t5 = MEM_U32(sp + 84);
+L40ab1c:
+//nop;
+t8 = MEM_U32(sp + 84);
+if (s0 >= t5) goto L40b014;
+t6 = MEM_U8(s0 + 0);
+t7 = MEM_U32(sp + 96);
+//nop;
+if (s4 != t6) goto L40ab4c;
+t8 = MEM_U32(t7 + 4);
+//nop;
+t0 = t8 + 0x1;
+MEM_U32(t7 + 4) = t0;
+L40ab4c:
+s0 = s0 + 0x1;
+goto L40b010;
+L40ab54:
+t9 = MEM_U32(sp + 96);
+//nop;
+t1 = MEM_U32(t9 + 4);
+//nop;
+t2 = t1 + 0x1;
+MEM_U32(t9 + 4) = t2;
+MEM_U32(sp + 72) = s0;
+goto L40b010;
+L40ab74:
+t4 = MEM_U32(sp + 96);
+t3 = s0 + 0xffffffff;
+MEM_U32(t4 + 20) = t3;
+t5 = MEM_U32(sp + 72);
+//nop;
+t8 = MEM_U32(sp + 84);
+if (t5 == 0) goto L40b014;
+v1 = 0x10002d10;
+s0 = MEM_U32(sp + 72);
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40aba0:
+a0 = MEM_U8(s0 + 0);
+L40aba4:
+//nop;
+t6 = s7 + a0;
+t8 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40abc4;
+s0 = s0 + 0x1;
+goto L40aba0;
+L40abc4:
+//nop;
+if (s6 != a0) goto L40abe4;
+t0 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s4 != t0) goto L40abe4;
+s0 = s0 + 0x2;
+goto L40aba0;
+L40abe4:
+//nop;
+if (s1 != a0) goto L40ac44;
+t7 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != t7) goto L40ac44;
+t1 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (s2 != t1) goto L40ac1c;
+t2 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s1 == t2) goto L40ac3c;
+L40ac1c:
+t9 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (s2 != t9) goto L40ac1c;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s1 != t3) goto L40ac1c;
+L40ac3c:
+s0 = s0 + 0x2;
+goto L40aba0;
+L40ac44:
+t8 = MEM_U32(sp + 96);
+if (v1 == 0) goto L40ac90;
+t8 = MEM_U32(sp + 96);
+if (s1 != a0) goto L40ac90;
+t4 = MEM_U8(s0 + 1);
+//nop;
+t8 = MEM_U32(sp + 96);
+if (s1 != t4) goto L40ac90;
+t5 = MEM_U8(s0 + 2);
+s0 = s0 + 0x3;
+//nop;
+if (s4 == t5) goto L40aba0;
+L40ac74:
+t6 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+//nop;
+if (s4 != t6) goto L40ac74;
+a0 = MEM_U8(s0 + 0);
+goto L40aba4;
+// fdead 0 t8 = MEM_U32(sp + 96);
+L40ac90:
+//nop;
+v0 = MEM_U32(t8 + 20);
+//nop;
+//nop;
+if (s0 == v0) goto L40acac;
+s0 = v0 + 0x1;
+goto L40b010;
+L40acac:
+s5 = 0x10000080;
+s0 = v0 + 0x1;
+L40acb4:
+a0 = MEM_U8(s0 + 0);
+//nop;
+t0 = s7 + a0;
+t7 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40acd8;
+s0 = s0 + 0x1;
+goto L40acb4;
+L40acd8:
+//nop;
+if (s6 != a0) goto L40acf8;
+t1 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s4 != t1) goto L40acf8;
+s0 = s0 + 0x2;
+goto L40acb4;
+L40acf8:
+s3 = s0;
+if (s1 != a0) goto L40ad5c;
+t2 = MEM_U8(s0 + 1);
+//nop;
+s3 = s0;
+if (s2 != t2) goto L40ad5c;
+t9 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (s2 != t9) goto L40ad30;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s1 == t3) goto L40ad50;
+L40ad30:
+t4 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (s2 != t4) goto L40ad30;
+t5 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s1 != t5) goto L40ad30;
+L40ad50:
+s0 = s0 + 0x2;
+goto L40acb4;
+// fdead 0 s3 = s0;
+L40ad5c:
+t6 = fp + a0;
+L40ad60:
+v1 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L40ad78;
+s0 = s0 + 0x1;
+goto L40adc0;
+L40ad78:
+//nop;
+if (s6 != a0) goto L40adb4;
+t8 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s4 != t8) goto L40adb4;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_name_newline_fix(mem, sp, a0);
+t0 = MEM_U8(s0 + 0);
+// bdead c1fe020b gp = MEM_U32(sp + 60);
+t7 = fp + t0;
+v1 = MEM_U8(t7 + 0);
+//nop;
+L40adb4:
+//nop;
+if (v1 == 0) goto L40adcc;
+s0 = s0 + 0x1;
+L40adc0:
+a0 = MEM_U8(s0 + 0);
+t6 = fp + a0;
+goto L40ad60;
+L40adcc:
+t1 = 0x10000080;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+t8 = MEM_U32(sp + 84);
+if ((int)t1 < 0) goto L40b014;
+t2 = 0x10000080;
+//nop;
+v0 = MEM_U32(t2 + 0);
+//nop;
+L40adf4:
+//nop;
+a1 = MEM_U32(s5 + 8);
+a0 = s3;
+a2 = v0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fe01db gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L40b000;
+t9 = MEM_U32(s5 + 0);
+//nop;
+t3 = t9 + s3;
+t4 = MEM_U8(t3 + 0);
+//nop;
+t5 = fp + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40b000;
+t8 = MEM_U32(sp + 100);
+//nop;
+// bdead c1ee01db ra = MEM_U32(sp + 68);
+if (t8 != 0) goto L40b034;
+t0 = MEM_U32(s5 + 12);
+//nop;
+t7 = t0 + 0xfffffffd;
+t8 = MEM_U32(sp + 84);
+if (t7 >= 0xa) goto L40b014;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40ae84;
+case 1: goto L40ae84;
+case 2: goto L40ae84;
+case 3: goto L40aee4;
+case 4: goto L40b010;
+case 5: goto L40af2c;
+case 6: goto L40b010;
+case 7: goto L40b010;
+case 8: goto L40b010;
+case 9: goto L40aee4;
+}
+L40ae84:
+//nop;
+a0 = 0x1;
+a1 = 0x14;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee001b gp = MEM_U32(sp + 60);
+//nop;
+t1 = 0x100001b4;
+at = 0x100001b4;
+t1 = MEM_U32(t1 + 0);
+//nop;
+MEM_U32(v0 + 0) = t1;
+t2 = MEM_U32(sp + 96);
+MEM_U32(at + 0) = v0;
+t9 = MEM_U32(t2 + 4);
+//nop;
+MEM_U32(v0 + 8) = t9;
+t3 = MEM_U32(sp + 96);
+//nop;
+t4 = MEM_U32(t3 + 0);
+//nop;
+MEM_U32(v0 + 4) = t4;
+t5 = MEM_U32(s5 + 12);
+MEM_U32(v0 + 16) = t5;
+goto L40b010;
+L40aee4:
+t6 = 0x10002d28;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40af2c;
+t0 = 0x100001b4;
+t8 = MEM_U32(sp + 76);
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (t8 == t0) goto L40af2c;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_validate_else(mem, sp, a0);
+// bdead c1ee01cb gp = MEM_U32(sp + 60);
+//nop;
+L40af2c:
+t7 = 0x10000030;
+t2 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+v1 = 0x100001b4;
+t1 = t7 << 3;
+t1 = t1 + t7;
+t1 = t1 << 2;
+t9 = t1 + t2;
+t3 = MEM_U32(t9 + 28);
+v1 = MEM_U32(v1 + 0);
+t4 = MEM_U32(sp + 76);
+//nop;
+if (v1 != t3) goto L40af80;
+a0 = 0x100016ec;
+//nop;
+a1 = MEM_U32(s5 + 8);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+t8 = MEM_U32(sp + 84);
+goto L40b014;
+L40af80:
+// bdead c1ee01db ra = MEM_U32(sp + 68);
+if (t4 == v1) goto L40b034;
+a0 = MEM_U32(s5 + 12);
+at = 0xc;
+//nop;
+if (a0 == at) goto L40afdc;
+t5 = MEM_U32(v1 + 16);
+at = 0x6;
+//nop;
+if (t5 != at) goto L40afd4;
+a0 = 0x1000170c;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s5 + 12);
+v1 = 0x100001b4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40afd4:
+MEM_U32(v1 + 16) = a0;
+goto L40b010;
+L40afdc:
+t6 = MEM_U32(v1 + 0);
+at = 0x100001b4;
+//nop;
+a0 = v1;
+MEM_U32(at + 0) = t6;
+wrapper_free(mem, a0);
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+t8 = MEM_U32(sp + 84);
+goto L40b014;
+L40b000:
+v0 = MEM_U32(s5 + 20);
+s5 = s5 + 0x14;
+//nop;
+if ((int)v0 >= 0) goto L40adf4;
+L40b010:
+t8 = MEM_U32(sp + 84);
+L40b014:
+//nop;
+//nop;
+if (s0 < t8) goto L40aa00;
+L40b024:
+t0 = MEM_U32(sp + 96);
+//nop;
+MEM_U32(t0 + 20) = s0;
+// bdead 19 ra = MEM_U32(sp + 68);
+L40b034:
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0x60;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_else(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40b060:
+//do_else:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000030;
+t9 = 0x10002d28;
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffd8;
+t7 = t6 << 3;
+t8 = 0x10002d50;
+t7 = t7 + t6;
+t9 = MEM_U32(t9 + 0);
+MEM_U32(sp + 52) = a3;
+t7 = t7 << 2;
+a3 = t7 + t8;
+// fdead 460181e3 MEM_U32(sp + 28) = ra;
+// fdead 460181e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 36) = a3;
+if (t9 == 0) goto L40b164;
+v0 = 0x10006190;
+t0 = MEM_U8(a0 + 0);
+//nop;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L40b0e8;
+L40b0cc:
+t3 = MEM_U8(a0 + 1);
+a0 = a0 + 0x1;
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40b0cc;
+L40b0e8:
+//nop;
+if (a0 == a1) goto L40b164;
+t6 = 0x10002d2c;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40b164;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t0 = v1 + 0x1;
+if (v1 != 0) goto L40b160;
+a0 = 0x10001728;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 400000c3 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a3 = t8 + t9;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t0 = v1 + 0x1;
+L40b160:
+MEM_U32(a3 + 12) = t0;
+L40b164:
+v1 = 0x100001b4;
+t1 = MEM_U32(a3 + 28);
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != t1) goto L40b19c;
+a0 = 0x10001754;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40b2e8;
+L40b19c:
+v0 = MEM_U32(v1 + 16);
+at = 0x5;
+if (v0 == at) {
+at = 0x8;
+goto L40b280;}
+at = 0x8;
+t6 = 0x6;
+if (v0 == at) goto L40b284;
+a0 = 0x10001774;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x100001b4;
+a0 = 0xfb528e4;
+t2 = MEM_U32(t2 + 0);
+a1 = 0x10001788;
+//nop;
+a2 = MEM_U32(t2 + 8);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t4 = MEM_U32(sp + 36);
+t3 = 0x100001b4;
+//nop;
+t3 = MEM_U32(t3 + 0);
+a1 = MEM_U32(t4 + 0);
+a0 = MEM_U32(t3 + 4);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40b250;
+t5 = 0x100001b4;
+a0 = 0xfb528e4;
+t5 = MEM_U32(t5 + 0);
+a1 = 0x1000179c;
+//nop;
+a2 = MEM_U32(t5 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+//nop;
+L40b250:
+a0 = 0xfb528e4;
+a1 = 0x100017a8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100001b4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40b280:
+t6 = 0x6;
+L40b284:
+MEM_U32(v1 + 16) = t6;
+v1 = 0x100001b4;
+a2 = 0x1;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 12);
+//nop;
+t7 = v0 + 0x1;
+if (v0 == 0) goto L40b2c4;
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = zero;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40b2e8;
+L40b2c4:
+MEM_U32(v1 + 12) = t7;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 36);
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40b2e8:
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_endif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40b2f4:
+//do_endif:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002d28;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+// fdead 400081e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 44) = a3;
+if (t6 == 0) goto L40b3f8;
+v0 = 0x10006190;
+t7 = MEM_U8(a0 + 0);
+//nop;
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40b35c;
+L40b340:
+t0 = MEM_U8(a0 + 1);
+a0 = a0 + 0x1;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L40b340;
+L40b35c:
+//nop;
+if (a0 == a1) goto L40b3f8;
+t3 = 0x10002d2c;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L40b3f8;
+t4 = 0x10000030;
+t6 = 0x10002d50;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = t4 << 3;
+t5 = t5 + t4;
+t5 = t5 << 2;
+v0 = t5 + t6;
+v1 = MEM_U32(v0 + 12);
+//nop;
+t0 = v1 + 0x1;
+if (v1 != 0) goto L40b3f4;
+a0 = 0x100017ac;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 12);
+//nop;
+t0 = v1 + 0x1;
+L40b3f4:
+MEM_U32(v0 + 12) = t0;
+L40b3f8:
+t1 = 0x10000030;
+t3 = 0x10002d50;
+t1 = MEM_U32(t1 + 0);
+v1 = 0x100001b4;
+t2 = t1 << 3;
+t2 = t2 + t1;
+t2 = t2 << 2;
+t4 = t2 + t3;
+t5 = MEM_U32(t4 + 28);
+v0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v0 != t5) goto L40b44c;
+a0 = 0x100017dc;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40b4ac;
+L40b44c:
+t6 = MEM_U32(v0 + 0);
+a0 = v0;
+MEM_U32(v1 + 0) = t6;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+a2 = 0x1;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a0 = t8 + t9;
+//nop;
+a3 = zero;
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40b4ac:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_validate_else(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40b4b8:
+//validate_else:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000002b MEM_U32(sp + 44) = ra;
+// fdead 4000002b MEM_U32(sp + 40) = gp;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+// fdead 4000002b MEM_U32(sp + 32) = s3;
+// fdead 4000002b MEM_U32(sp + 28) = s2;
+// fdead 4000002b MEM_U32(sp + 24) = s1;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+v0 = MEM_U8(a0 + 0);
+s0 = a0;
+s1 = 0xa;
+s2 = 0x5c;
+s3 = 0x2f;
+s4 = 0x2a;
+L40b4fc:
+//nop;
+if (s2 != v0) goto L40b51c;
+t6 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s1 != t6) goto L40b51c;
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+L40b51c:
+t7 = 0x10006190;
+//nop;
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40b544;
+v0 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+goto L40b4fc;
+L40b544:
+//nop;
+if (s3 != v0) goto L40b678;
+v0 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != v0) goto L40b588;
+t0 = MEM_U8(s0 + 2);
+//nop;
+//nop;
+if (s1 != t0) goto L40b588;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403e01c1 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s0 + 1);
+//nop;
+L40b588:
+//nop;
+if (s4 != v0) goto L40b618;
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (v0 == 0) goto L40b4fc;
+L40b5a0:
+t1 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != t1) goto L40b5dc;
+t2 = MEM_U8(s0 + 2);
+//nop;
+//nop;
+if (s1 != t2) goto L40b5dc;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403e01c1 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40b5dc:
+//nop;
+if (s4 != v0) goto L40b600;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s3 != t3) goto L40b600;
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+goto L40b4fc;
+L40b600:
+v0 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (v0 != 0) goto L40b5a0;
+//nop;
+goto L40b4fc;
+L40b618:
+t4 = 0x10002d10;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40b670;
+//nop;
+if (s3 != v0) goto L40b670;
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (v0 == 0) goto L40b4fc;
+//nop;
+if (s1 == v0) goto L40b4fc;
+L40b650:
+v0 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (v0 == 0) goto L40b4fc;
+//nop;
+if (s1 != v0) goto L40b650;
+//nop;
+goto L40b4fc;
+L40b670:
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40b678:
+// bdead 400401c9 ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L40b720;
+// bdead 400001c9 ra = MEM_U32(sp + 44);
+if (s1 == v0) goto L40b720;
+t5 = 0x10002d2c;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+// bdead 400001c9 ra = MEM_U32(sp + 44);
+if (t5 != 0) goto L40b720;
+t6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+v0 = t7 + t8;
+v1 = MEM_U32(v0 + 12);
+//nop;
+t2 = v1 + 0x1;
+if (v1 != 0) goto L40b718;
+a0 = 0x100017f0;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+t9 = 0x10000030;
+t1 = 0x10002d50;
+t9 = MEM_U32(t9 + 0);
+//nop;
+t0 = t9 << 3;
+t0 = t0 + t9;
+t0 = t0 << 2;
+v0 = t0 + t1;
+v1 = MEM_U32(v0 + 12);
+//nop;
+t2 = v1 + 0x1;
+L40b718:
+MEM_U32(v0 + 12) = t2;
+// bdead 9 ra = MEM_U32(sp + 44);
+L40b720:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint64_t f_skip_to_end_of_comment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40b73c:
+//skip_to_end_of_comment:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+v1 = 0x10000020;
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+// fdead 400001fb MEM_U32(sp + 24) = gp;
+// fdead 400001fb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 48) = a0;
+v1 = MEM_U32(v1 + 0);
+t8 = MEM_U32(a0 + 8);
+t7 = MEM_U32(a0 + 16);
+s0 = MEM_U32(a0 + 20);
+t9 = zero < v1;
+a2 = a1;
+v1 = t9;
+a3 = t7 + t8;
+if (t9 == 0) goto L40b788;
+v1 = a1 < 0x1;
+L40b788:
+t0 = v1;
+if (v1 == 0) goto L40b7d0;
+t2 = 0x10004970;
+t3 = 0x10004970;
+t2 = MEM_U32(t2 + 20);
+t1 = 0x2f;
+MEM_U8(t2 + 0) = (uint8_t)t1;
+t3 = MEM_U32(t3 + 20);
+at = 0x10004970;
+t4 = t3 + 0x1;
+t7 = 0x10004970;
+t5 = 0x2a;
+MEM_U32(at + 20) = t4;
+MEM_U8(t4 + 0) = (uint8_t)t5;
+t7 = MEM_U32(t7 + 20);
+at = 0x10004970;
+t8 = t7 + 0x1;
+MEM_U32(at + 20) = t8;
+L40b7d0:
+t6 = 0x10002d10;
+t1 = 0x2f;
+t6 = MEM_U32(t6 + 0);
+at = s0 < a3;
+//nop;
+if (t6 == 0) goto L40b8d4;
+t9 = MEM_U8(s0 + -1);
+//nop;
+//nop;
+if (t1 != t9) goto L40b8d4;
+at = s0 < a3;
+if (v1 == 0) goto L40b89c;
+t4 = 0x2a;
+if (s0 >= a3) goto L40b850;
+a1 = 0xa;
+L40b810:
+t2 = 0x10004970;
+v0 = MEM_U8(s0 + 0);
+t2 = MEM_U32(t2 + 20);
+t3 = 0x10004970;
+MEM_U8(t2 + 0) = (uint8_t)v0;
+t3 = MEM_U32(t3 + 20);
+at = 0x10004970;
+t5 = t3 + 0x1;
+s0 = s0 + 0x1;
+MEM_U32(at + 20) = t5;
+if (v0 != a1) goto L40b844;
+s0 = s0 + 0xffffffff;
+goto L40b850;
+L40b844:
+//nop;
+if (s0 < a3) goto L40b810;
+L40b850:
+t7 = 0x10004970;
+t8 = 0x10004970;
+t7 = MEM_U32(t7 + 20);
+t6 = 0x10004970;
+MEM_U8(t7 + -1) = (uint8_t)t4;
+t8 = MEM_U32(t8 + 20);
+at = 0x10004970;
+MEM_U8(t8 + 0) = (uint8_t)t1;
+t6 = MEM_U32(t6 + 20);
+t2 = 0x10004970;
+t9 = t6 + 0x1;
+a1 = 0xa;
+MEM_U32(at + 20) = t9;
+MEM_U8(t9 + 0) = (uint8_t)a1;
+t2 = MEM_U32(t2 + 20);
+at = 0x10004970;
+t3 = t2 + 0x1;
+MEM_U32(at + 20) = t3;
+goto L40b8c4;
+L40b89c:
+a1 = 0xa;
+if (at == 0) goto L40b8c4;
+L40b8a4:
+t5 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < a3;
+if (a1 != t5) goto L40b8bc;
+s0 = s0 + 0xffffffff;
+goto L40b8c4;
+L40b8bc:
+//nop;
+if (at != 0) goto L40b8a4;
+L40b8c4:
+t4 = MEM_U32(sp + 48);
+v0 = s0;
+MEM_U32(t4 + 20) = s0;
+goto L40ba14;
+L40b8d4:
+a1 = 0xa;
+if (at == 0) goto L40ba08;
+L40b8dc:
+v0 = MEM_U8(s0 + 0);
+//nop;
+if (t0 == 0) goto L40b914;
+t7 = 0x10004970;
+t8 = 0x10004970;
+t7 = MEM_U32(t7 + 20);
+at = 0x10004970;
+MEM_U8(t7 + 0) = (uint8_t)v0;
+t8 = MEM_U32(t8 + 20);
+//nop;
+t6 = t8 + 0x1;
+MEM_U32(at + 20) = t6;
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40b914:
+s0 = s0 + 0x1;
+if (v0 == a1) goto L40b930;
+at = 0x2a;
+//nop;
+if (v0 == at) goto L40b96c;
+at = s0 < a3;
+goto L40ba00;
+L40b930:
+//nop;
+if (a2 == 0) goto L40b948;
+t9 = MEM_U32(a2 + 0);
+//nop;
+t2 = t9 + 0x1;
+MEM_U32(a2 + 0) = t2;
+L40b948:
+at = s0 < a3;
+if (t0 == 0) goto L40ba00;
+t3 = 0x10004970;
+at = 0x10004970;
+t3 = MEM_U32(t3 + 4);
+//nop;
+t5 = t3 + 0x1;
+MEM_U32(at + 4) = t5;
+goto L40b9fc;
+L40b96c:
+v0 = MEM_U8(s0 + 0);
+at = 0x5c;
+//nop;
+if (v0 != at) goto L40b9bc;
+t4 = MEM_U8(s0 + 1);
+a0 = s0;
+//nop;
+if (a1 != t4) goto L40b9bc;
+//nop;
+MEM_U32(sp + 52) = a2;
+MEM_U32(sp + 44) = a3;
+MEM_U32(sp + 32) = t0;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40020011 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 52);
+a3 = MEM_U32(sp + 44);
+t0 = MEM_U32(sp + 32);
+v0 = MEM_U8(s0 + 0);
+a1 = 0xa;
+t1 = 0x2f;
+L40b9bc:
+at = s0 < a3;
+if (t1 != v0) goto L40ba00;
+v0 = s0 + 0x1;
+if (t0 == 0) goto L40b9f0;
+t7 = 0x10004970;
+t8 = 0x10004970;
+t7 = MEM_U32(t7 + 20);
+at = 0x10004970;
+MEM_U8(t7 + 0) = (uint8_t)t1;
+t8 = MEM_U32(t8 + 20);
+//nop;
+t6 = t8 + 0x1;
+MEM_U32(at + 20) = t6;
+L40b9f0:
+t9 = MEM_U32(sp + 48);
+MEM_U32(t9 + 20) = v0;
+goto L40ba14;
+L40b9fc:
+at = s0 < a3;
+L40ba00:
+//nop;
+if (at != 0) goto L40b8dc;
+L40ba08:
+t2 = MEM_U32(sp + 48);
+v0 = s0;
+MEM_U32(t2 + 20) = s0;
+L40ba14:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_skip_quoted_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40ba24:
+//skip_quoted_string:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+t0 = MEM_U8(a0 + 0);
+s0 = a0 + 0x1;
+v1 = MEM_U32(sp + 48);
+t2 = 0x10002d3c;
+a0 = 0xa;
+a2 = 0x1;
+a1 = 0x5c;
+t1 = 0x27;
+L40ba68:
+t6 = MEM_U32(sp + 36);
+L40ba6c:
+//nop;
+//nop;
+if (s0 < t6) goto L40bac0;
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40020189 gp = MEM_U32(sp + 24);
+a0 = v0;
+a1 = 0x10001828;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 52);
+// bdead 20011 gp = MEM_U32(sp + 24);
+a2 = 0x1;
+if (v1 == 0) goto L40bbdc;
+MEM_U32(v1 + 0) = a2;
+goto L40bbdc;
+L40bac0:
+v0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+//nop;
+if (v0 != a1) goto L40bb68;
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (a1 != v0) goto L40bb34;
+t7 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (a0 != t7) goto L40bb34;
+L40baf0:
+//nop;
+if (v1 == 0) goto L40bafc;
+MEM_U32(v1 + 0) = a2;
+L40bafc:
+//nop;
+if (a3 == 0) goto L40bb14;
+t8 = MEM_U32(a3 + 0);
+//nop;
+t9 = t8 + 0x1;
+MEM_U32(a3 + 0) = t9;
+L40bb14:
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (a1 != v0) goto L40bb34;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (a0 == t3) goto L40baf0;
+L40bb34:
+//nop;
+if (a0 != v0) goto L40bb60;
+//nop;
+if (a3 == 0) goto L40bb60;
+//nop;
+if (v1 == 0) goto L40bb50;
+MEM_U32(v1 + 0) = a2;
+L40bb50:
+t4 = MEM_U32(a3 + 0);
+//nop;
+t5 = t4 + 0x1;
+MEM_U32(a3 + 0) = t5;
+L40bb60:
+s0 = s0 + 0x1;
+goto L40ba68;
+L40bb68:
+//nop;
+if (v0 != a0) goto L40bbd4;
+//nop;
+if (t0 != t1) goto L40bb90;
+v1 = MEM_U32(sp + 52);
+s0 = s0 + 0xffffffff;
+// bdead 20091 ra = MEM_U32(sp + 28);
+if (v1 == 0) goto L40bbe0;
+MEM_U32(v1 + 0) = a2;
+goto L40bbdc;
+L40bb90:
+t6 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40bbb8;
+v1 = MEM_U32(sp + 52);
+//nop;
+// bdead 20091 ra = MEM_U32(sp + 28);
+if (v1 == 0) goto L40bbe0;
+MEM_U32(v1 + 0) = a2;
+goto L40bbdc;
+L40bbb8:
+t6 = MEM_U32(sp + 36);
+if (a3 == 0) goto L40ba6c;
+t7 = MEM_U32(a3 + 0);
+//nop;
+t8 = t7 + 0x1;
+MEM_U32(a3 + 0) = t8;
+goto L40ba68;
+L40bbd4:
+t6 = MEM_U32(sp + 36);
+if (v0 != t0) goto L40ba6c;
+L40bbdc:
+// bdead 20011 ra = MEM_U32(sp + 28);
+L40bbe0:
+v0 = s0;
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x20;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_output_line_command(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40bbf0:
+//output_line_command:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002d20;
+sp = sp + 0xfffffdd0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = s1;
+// fdead 400081eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a0;
+// fdead 400681eb MEM_U32(sp + 36) = ra;
+// fdead 400681eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 572) = a3;
+if (t6 != 0) goto L40bc50;
+a3 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (a3 == 0) goto L40bc50;
+t7 = 0x10002d40;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40bc5c;
+L40bc50:
+t8 = MEM_U32(s1 + 4);
+MEM_U32(s0 + 4) = t8;
+goto L40be08;
+L40bc5c:
+//nop;
+if (a2 == 0) goto L40bd18;
+a0 = MEM_U32(s0 + 4);
+v1 = MEM_U32(s1 + 4);
+//nop;
+at = (int)a0 < (int)v1;
+if (a0 == v1) goto L40be08;
+t9 = a0 + 0x8;
+if ((int)a0 >= (int)v1) goto L40bd18;
+//nop;
+if ((int)v1 >= (int)t9) goto L40bd18;
+t0 = MEM_U32(s0 + 20);
+t1 = MEM_U32(s0 + 16);
+t3 = MEM_U32(s0 + 8);
+t2 = t0 - t1;
+t4 = t3 - t2;
+if ((int)t4 >= (int)0xb) {
+at = (int)a0 < (int)v1;
+goto L40bcd0;}
+at = (int)a0 < (int)v1;
+//nop;
+a0 = s0;
+a1 = 0xa;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 60009 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(s1 + 4);
+a0 = MEM_U32(s0 + 4);
+//nop;
+at = (int)a0 < (int)v1;
+L40bcd0:
+v1 = 0xa;
+if (at == 0) goto L40be08;
+L40bcd8:
+t5 = MEM_U32(s0 + 20);
+//nop;
+MEM_U8(t5 + 0) = (uint8_t)v1;
+t6 = MEM_U32(s0 + 20);
+t8 = MEM_U32(s0 + 4);
+t7 = t6 + 0x1;
+t9 = t8 + 0x1;
+MEM_U32(s0 + 20) = t7;
+MEM_U32(s0 + 4) = t9;
+t1 = MEM_U32(s1 + 4);
+//nop;
+//nop;
+if ((int)t9 < (int)t1) goto L40bcd8;
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L40be0c;
+L40bd18:
+a1 = 0x10001854;
+//nop;
+a2 = MEM_U32(s1 + 4);
+a0 = sp + 0x38;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = sp + 0x38;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t3 = sp + 0x38;
+// bdead 40061009 gp = MEM_U32(sp + 32);
+v1 = 0xa;
+t2 = v0 + t3;
+MEM_U8(t2 + 0) = (uint8_t)v1;
+t4 = v0 + 0x1;
+MEM_U32(sp + 556) = t4;
+a0 = MEM_U32(s0 + 16);
+a1 = MEM_U32(s0 + 20);
+t5 = MEM_U32(s0 + 8);
+t6 = a1 - a0;
+t8 = v0 + 0x2;
+t7 = t5 - t6;
+if ((int)t8 < (int)t7) {
+at = a0 < a1;
+goto L40bdac;}
+at = a0 < a1;
+//nop;
+a0 = s0;
+a1 = t4 + 0x1;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(s0 + 20);
+a0 = MEM_U32(s0 + 16);
+v1 = 0xa;
+at = a0 < a1;
+L40bdac:
+//nop;
+if (at == 0) goto L40bdd8;
+t9 = MEM_U8(a1 + -1);
+//nop;
+//nop;
+if (v1 == t9) goto L40bdd8;
+MEM_U8(a1 + 0) = (uint8_t)v1;
+t0 = MEM_U32(s0 + 20);
+//nop;
+a1 = t0 + 0x1;
+MEM_U32(s0 + 20) = a1;
+L40bdd8:
+//nop;
+a2 = MEM_U32(sp + 556);
+a0 = sp + 0x38;
+wrapper_bcopy(mem, a0, a1, a2);
+t3 = MEM_U32(s0 + 20);
+t2 = MEM_U32(sp + 556);
+// bdead 61819 gp = MEM_U32(sp + 32);
+t4 = t3 + t2;
+MEM_U32(s0 + 20) = t4;
+t5 = MEM_U32(s1 + 4);
+//nop;
+MEM_U32(s0 + 4) = t5;
+L40be08:
+// bdead 19 ra = MEM_U32(sp + 36);
+L40be0c:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x230;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_macroexpand(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40be1c:
+//macroexpand:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff50;
+v1 = 0x10000030;
+t7 = 0x10002d50;
+v1 = MEM_U32(v1 + 0);
+// fdead 400101fb MEM_U32(sp + 60) = ra;
+t6 = v1 << 3;
+t6 = t6 + v1;
+t6 = t6 << 2;
+// fdead 400181fb MEM_U32(sp + 56) = fp;
+// fdead 400181fb MEM_U32(sp + 52) = gp;
+// fdead 400181fb MEM_U32(sp + 48) = s7;
+// fdead 400181fb MEM_U32(sp + 44) = s6;
+// fdead 400181fb MEM_U32(sp + 40) = s5;
+// fdead 400181fb MEM_U32(sp + 36) = s4;
+// fdead 400181fb MEM_U32(sp + 32) = s3;
+// fdead 400181fb MEM_U32(sp + 28) = s2;
+// fdead 400181fb MEM_U32(sp + 24) = s1;
+// fdead 400181fb MEM_U32(sp + 20) = s0;
+t8 = t6 + t7;
+a2 = MEM_U32(t8 + 4);
+v0 = MEM_U32(a0 + 24);
+at = (int)v1 < (int)0xc7;
+a3 = a0;
+s3 = a2;
+if (at != 0) goto L40bec4;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10001860;
+//nop;
+a1 = a1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 52);
+// bdead 1 ra = MEM_U32(sp + 60);
+goto L40ca38;
+L40bec4:
+t9 = MEM_U32(a3 + 12);
+at = 0x17;
+//nop;
+if (t9 == at) goto L40bef0;
+//nop;
+a0 = a3;
+//nop;
+f_special_symbol(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 52);
+// bdead 1 ra = MEM_U32(sp + 60);
+goto L40ca38;
+L40bef0:
+a1 = MEM_U32(v0 + 0);
+//nop;
+a0 = a1 << 5;
+if ((int)a1 < 0) goto L40c9b4;
+//nop;
+a0 = a0 + 0x20;
+MEM_U32(sp + 168) = v0;
+MEM_U32(sp + 172) = a1;
+MEM_U32(sp + 176) = a3;
+v0 = f_alloca(mem, sp, a0);
+a2 = MEM_U32(sp + 172);
+// bdead 4010008b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 148) = v0;
+s0 = zero;
+if ((int)a2 <= 0) goto L40c00c;
+a0 = a2 & 0x3;
+a1 = a0;
+if (a0 == 0) goto L40bf78;
+a0 = 0x10001888;
+t4 = zero << 5;
+v1 = v0 + t4;
+a0 = a0;
+L40bf48:
+s0 = s0 + 0x1;
+MEM_U32(v1 + 4) = a0;
+MEM_U32(v1 + 0) = a0;
+MEM_U32(v1 + 16) = zero;
+MEM_U32(v1 + 12) = zero;
+MEM_U32(v1 + 8) = zero;
+MEM_U32(v1 + 24) = zero;
+MEM_U32(v1 + 20) = zero;
+v1 = v1 + 0x20;
+if (a1 != s0) goto L40bf48;
+//nop;
+if (s0 == a2) goto L40c008;
+L40bf78:
+a0 = 0x10001888;
+t5 = a2 << 5;
+t6 = s0 << 5;
+v1 = v0 + t6;
+a1 = t5 + v0;
+a0 = a0;
+L40bf90:
+v1 = v1 + 0x80;
+MEM_U32(v1 + -92) = a0;
+MEM_U32(v1 + -96) = a0;
+MEM_U32(v1 + -80) = zero;
+MEM_U32(v1 + -84) = zero;
+MEM_U32(v1 + -88) = zero;
+MEM_U32(v1 + -72) = zero;
+MEM_U32(v1 + -76) = zero;
+MEM_U32(v1 + -60) = a0;
+MEM_U32(v1 + -64) = a0;
+MEM_U32(v1 + -48) = zero;
+MEM_U32(v1 + -52) = zero;
+MEM_U32(v1 + -56) = zero;
+MEM_U32(v1 + -40) = zero;
+MEM_U32(v1 + -44) = zero;
+MEM_U32(v1 + -28) = a0;
+MEM_U32(v1 + -32) = a0;
+MEM_U32(v1 + -16) = zero;
+MEM_U32(v1 + -20) = zero;
+MEM_U32(v1 + -24) = zero;
+MEM_U32(v1 + -8) = zero;
+MEM_U32(v1 + -12) = zero;
+MEM_U32(v1 + -124) = a0;
+MEM_U32(v1 + -128) = a0;
+MEM_U32(v1 + -112) = zero;
+MEM_U32(v1 + -116) = zero;
+MEM_U32(v1 + -120) = zero;
+MEM_U32(v1 + -104) = zero;
+MEM_U32(v1 + -108) = zero;
+if (v1 != a1) goto L40bf90;
+L40c008:
+s0 = zero;
+L40c00c:
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+s2 = 0x29;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 20);
+//nop;
+a2 = MEM_U32(sp + 172);
+L40c038:
+t4 = v1 + 0x1;
+MEM_U32(v0 + 20) = t4;
+if ((int)s0 < (int)a2) goto L40c058;
+a0 = zero;
+if (a2 != 0) goto L40c068;
+//nop;
+if (s0 != 0) goto L40c068;
+L40c058:
+t6 = MEM_U32(sp + 148);
+t5 = s0 << 5;
+a0 = t5 + t6;
+goto L40c068;
+L40c068:
+//nop;
+//nop;
+//nop;
+v0 = f_macarg(mem, sp, a0);
+// bdead 401a010b gp = MEM_U32(sp + 52);
+s1 = v0;
+if (v0 == 0) goto L40c0b8;
+//nop;
+a0 = s3;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 4006018b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = s1;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 52);
+t5 = MEM_U32(sp + 172);
+goto L40c0f4;
+L40c0b8:
+t7 = 0x10000030;
+t9 = 0x10002d50;
+t7 = MEM_U32(t7 + 0);
+s0 = s0 + 0x1;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 20);
+//nop;
+t4 = MEM_U8(v1 + 0);
+//nop;
+a2 = MEM_U32(sp + 172);
+if (s2 != t4) goto L40c038;
+t5 = MEM_U32(sp + 172);
+L40c0f4:
+at = 0x1;
+t8 = MEM_U32(sp + 172);
+if (t5 != 0) goto L40c1a0;
+t8 = MEM_U32(sp + 172);
+if (s0 != at) goto L40c1a0;
+a2 = MEM_U32(sp + 148);
+//nop;
+v0 = MEM_U32(a2 + 0);
+t6 = MEM_U32(a2 + 8);
+//nop;
+v1 = t6 + v0;
+//nop;
+if (v0 == v1) goto L40c170;
+s4 = 0x10006290;
+t7 = MEM_U8(v0 + 0);
+//nop;
+t8 = s4 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40c170;
+L40c148:
+v0 = v0 + 0x1;
+//nop;
+if (v0 == v1) goto L40c170;
+t4 = MEM_U8(v0 + 0);
+//nop;
+t5 = s4 + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40c148;
+L40c170:
+//nop;
+if (v0 == v1) goto L40c208;
+t7 = MEM_U32(sp + 176);
+a0 = 0x1000188c;
+//nop;
+a1 = MEM_U32(t7 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+//nop;
+goto L40c208;
+// fdead 0 t8 = MEM_U32(sp + 172);
+L40c1a0:
+//nop;
+t4 = MEM_U32(sp + 172);
+if ((int)s0 >= (int)t8) goto L40c1dc;
+t9 = MEM_U32(sp + 176);
+a0 = 0x100018ac;
+a2 = MEM_U32(t9 + 20);
+//nop;
+a1 = s0;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+//nop;
+goto L40c208;
+// fdead 0 t4 = MEM_U32(sp + 172);
+L40c1dc:
+t5 = MEM_U32(sp + 176);
+a1 = s0;
+if ((int)t4 >= (int)s0) goto L40c208;
+a0 = 0x100018c8;
+//nop;
+a2 = MEM_U32(t5 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+//nop;
+L40c208:
+t6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(t6 + 0);
+t5 = MEM_U32(sp + 172);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+v0 = t7 + t8;
+t9 = MEM_U32(v0 + 20);
+a2 = MEM_U32(sp + 148);
+s4 = 0x10006290;
+t4 = t9 + 0x1;
+MEM_U32(v0 + 20) = t4;
+if (t5 != 0) goto L40c258;
+v0 = MEM_U32(sp + 168);
+//nop;
+a2 = MEM_U32(v0 + 8);
+s2 = MEM_U32(v0 + 4);
+MEM_U32(sp + 164) = a2;
+goto L40c998;
+L40c258:
+v0 = MEM_U32(sp + 168);
+//nop;
+t6 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(sp + 132) = t6;
+t0 = MEM_U32(v0 + 12);
+s2 = MEM_U32(v0 + 4);
+//nop;
+if (t0 == 0) goto L40c310;
+L40c27c:
+t7 = MEM_U8(t0 + 4);
+//nop;
+//nop;
+if (t7 == 0) goto L40c2a8;
+t8 = MEM_U32(t0 + 12);
+//nop;
+t9 = t8 << 5;
+t4 = a2 + t9;
+t5 = MEM_U32(t4 + 16);
+s2 = s2 + t5;
+goto L40c300;
+L40c2a8:
+t6 = MEM_U8(t0 + 5);
+//nop;
+//nop;
+if (t6 != 0) goto L40c2c8;
+t7 = MEM_U8(t0 + 6);
+//nop;
+//nop;
+if (t7 == 0) goto L40c2e4;
+L40c2c8:
+t8 = MEM_U32(t0 + 12);
+//nop;
+t9 = t8 << 5;
+t4 = a2 + t9;
+t5 = MEM_U32(t4 + 8);
+s2 = s2 + t5;
+goto L40c300;
+L40c2e4:
+t6 = MEM_U32(t0 + 12);
+//nop;
+t7 = t6 << 5;
+t8 = a2 + t7;
+t9 = MEM_U32(t8 + 12);
+//nop;
+s2 = s2 + t9;
+L40c300:
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (t0 != 0) goto L40c27c;
+L40c310:
+//nop;
+a0 = s2 + 0x1;
+MEM_U32(sp + 68) = a0;
+v0 = f_xmalloc(mem, sp, a0);
+a0 = MEM_U32(sp + 168);
+MEM_U32(sp + 164) = v0;
+t0 = MEM_U32(a0 + 12);
+// bdead 40200323 gp = MEM_U32(sp + 52);
+s5 = zero;
+t1 = zero;
+if (t0 == 0) goto L40c8d4;
+s2 = 0xa;
+s1 = 0xa;
+t3 = 0x5c;
+t2 = 0x22;
+L40c34c:
+t4 = MEM_U32(t0 + 12);
+t6 = MEM_U32(sp + 148);
+t7 = MEM_U32(t0 + 8);
+t5 = t4 << 5;
+s0 = zero;
+v1 = t5 + t6;
+if ((int)t7 <= 0) goto L40c3a0;
+t8 = MEM_U32(sp + 164);
+t9 = MEM_U32(sp + 132);
+s3 = t8 + s5;
+v0 = t1 + t9;
+L40c378:
+t4 = MEM_U8(v0 + 0);
+s0 = s0 + 0x1;
+MEM_U8(s3 + 0) = (uint8_t)t4;
+t5 = MEM_U32(t0 + 8);
+s5 = s5 + 0x1;
+at = (int)s0 < (int)t5;
+s3 = s3 + 0x1;
+t1 = t1 + 0x1;
+v0 = v0 + 0x1;
+if (at != 0) goto L40c378;
+L40c3a0:
+t6 = MEM_U8(t0 + 4);
+s6 = zero;
+s0 = zero;
+if (t6 == 0) goto L40c678;
+a0 = 0x10002d3c;
+s7 = MEM_U32(v1 + 8);
+a0 = MEM_U32(a0 + 0);
+fp = zero;
+if ((int)s7 <= 0) goto L40c414;
+v0 = MEM_U32(v1 + 0);
+//nop;
+a2 = MEM_U8(v0 + 0);
+//nop;
+t7 = s4 + a2;
+t8 = MEM_U8(t7 + 0);
+//nop;
+at = (int)s0 < (int)s7;
+if (t8 == 0) goto L40c418;
+L40c3e8:
+s0 = s0 + 0x1;
+t9 = v0 + s0;
+if ((int)s0 >= (int)s7) goto L40c414;
+a2 = MEM_U8(t9 + 0);
+//nop;
+t4 = s4 + a2;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40c3e8;
+L40c414:
+at = (int)s0 < (int)s7;
+L40c418:
+//nop;
+if (at == 0) goto L40c474;
+t6 = MEM_U32(v1 + 0);
+//nop;
+v0 = t6 + s7;
+a2 = MEM_U8(v0 + -1);
+//nop;
+t7 = s4 + a2;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40c474;
+L40c448:
+s7 = s7 + 0xffffffff;
+v0 = v0 + 0xffffffff;
+if ((int)s0 >= (int)s7) goto L40c474;
+a2 = MEM_U8(v0 + -1);
+//nop;
+t9 = s4 + a2;
+t4 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t4 != 0) goto L40c448;
+L40c474:
+at = (int)s0 < (int)s7;
+if (a0 != 0) goto L40c490;
+t6 = MEM_U32(sp + 164);
+t5 = 0x22;
+t7 = t6 + s5;
+MEM_U8(t7 + 0) = (uint8_t)t5;
+s5 = s5 + 0x1;
+L40c490:
+//nop;
+if (at == 0) goto L40c650;
+L40c498:
+t8 = MEM_U32(v1 + 0);
+t4 = MEM_U32(sp + 164);
+v0 = t8 + s0;
+a2 = MEM_U8(v0 + 0);
+//nop;
+//nop;
+if (a2 != s2) goto L40c4cc;
+t9 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (s1 == t9) goto L40c4cc;
+s0 = s0 + 0x1;
+goto L40c640;
+L40c4cc:
+s3 = t4 + s5;
+if (s6 == 0) goto L40c4f0;
+t6 = 0x10006190;
+//nop;
+t5 = a2 + t6;
+t7 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L40c570;
+L40c4f0:
+t9 = s4 + a2;
+if (a2 != s2) goto L40c50c;
+t8 = MEM_U8(v0 + 1);
+//nop;
+a0 = s1 ^ t8;
+a0 = a0 < 0x1;
+goto L40c514;
+L40c50c:
+a0 = MEM_U8(t9 + 0);
+//nop;
+L40c514:
+//nop;
+if (a0 == 0) goto L40c570;
+L40c51c:
+t6 = s4 + a2;
+if (a2 != s2) goto L40c540;
+t4 = MEM_U8(v0 + 1);
+//nop;
+//nop;
+if (s1 != t4) goto L40c540;
+s0 = s0 + 0x2;
+v0 = v0 + 0x2;
+goto L40c55c;
+L40c540:
+v0 = v0 + 0x1;
+if (a2 == s2) goto L40c568;
+t5 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L40c568;
+s0 = s0 + 0x1;
+L40c55c:
+a2 = MEM_U8(v0 + 0);
+//nop;
+goto L40c51c;
+L40c568:
+s0 = s0 + 0xffffffff;
+a2 = 0x20;
+L40c570:
+t7 = 0x5c;
+if (fp == 0) goto L40c580;
+fp = zero;
+goto L40c5b8;
+L40c580:
+//nop;
+if (a2 != t3) goto L40c58c;
+fp = 0x1;
+L40c58c:
+//nop;
+if (s6 == 0) goto L40c5a4;
+//nop;
+if (a2 != s6) goto L40c5a4;
+s6 = zero;
+goto L40c5b8;
+L40c5a4:
+at = 0x27;
+if (a2 == t2) goto L40c5b4;
+//nop;
+if (a2 != at) goto L40c5b8;
+L40c5b4:
+s6 = a2;
+L40c5b8:
+//nop;
+if (a2 == t2) goto L40c5d0;
+//nop;
+if (s6 == 0) goto L40c5dc;
+//nop;
+if (a2 != t3) goto L40c5dc;
+L40c5d0:
+MEM_U8(s3 + 0) = (uint8_t)t7;
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+L40c5dc:
+t8 = 0xfb504f0;
+a0 = s3;
+t9 = a2 + t8;
+t4 = MEM_U8(t9 + 1);
+//nop;
+t6 = t4 & 0x57;
+//nop;
+if (t6 == 0) goto L40c608;
+MEM_U8(s3 + 0) = (uint8_t)a2;
+s5 = s5 + 0x1;
+goto L40c640;
+L40c608:
+a1 = 0x100018ec;
+//nop;
+MEM_U32(sp + 116) = v1;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead c1ee0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(sp + 116);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+s5 = s5 + 0x4;
+L40c640:
+s0 = s0 + 0x1;
+//nop;
+if ((int)s0 < (int)s7) goto L40c498;
+L40c650:
+t5 = 0x10002d3c;
+t8 = MEM_U32(sp + 164);
+t5 = MEM_U32(t5 + 0);
+t9 = t8 + s5;
+t7 = 0x22;
+if (t5 != 0) goto L40c670;
+MEM_U8(t9 + 0) = (uint8_t)t7;
+s5 = s5 + 0x1;
+L40c670:
+v0 = s5 + 0x1;
+goto L40c884;
+L40c678:
+v0 = MEM_U8(t0 + 5);
+t4 = MEM_U32(sp + 164);
+s3 = t4 + s5;
+if (v0 != 0) goto L40c698;
+t6 = MEM_U8(t0 + 6);
+a1 = s3;
+//nop;
+if (t6 == 0) goto L40c844;
+L40c698:
+a0 = MEM_U32(v1 + 0);
+t5 = MEM_U32(v1 + 8);
+a3 = t5 + a0;
+if (v0 == 0) goto L40c774;
+//nop;
+if (a0 == a3) goto L40c6f4;
+t8 = MEM_U8(a0 + 0);
+//nop;
+t7 = s4 + t8;
+t9 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40c6f4;
+L40c6cc:
+a0 = a0 + 0x1;
+//nop;
+if (a0 == a3) goto L40c6f4;
+t4 = MEM_U8(a0 + 0);
+//nop;
+t6 = s4 + t4;
+t5 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40c6cc;
+L40c6f4:
+//nop;
+if (a0 == a3) goto L40c750;
+v0 = MEM_U8(a0 + 0);
+t8 = 0x10005f90;
+//nop;
+t7 = v0 + t8;
+t9 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40c750;
+L40c71c:
+a0 = a0 + 0x1;
+MEM_U8(s3 + 0) = (uint8_t)v0;
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+if (a0 == a3) goto L40c750;
+v0 = MEM_U8(a0 + 0);
+t4 = 0x10005f90;
+//nop;
+t6 = v0 + t4;
+t5 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40c71c;
+L40c750:
+t8 = MEM_U8(a0 + 0);
+//nop;
+//nop;
+if (s1 != t8) goto L40c774;
+t7 = MEM_U8(a0 + 1);
+at = 0x2d;
+//nop;
+if (t7 != at) goto L40c774;
+a0 = a0 + 0x2;
+L40c774:
+t9 = MEM_U8(t0 + 6);
+a1 = s3;
+//nop;
+if (t9 == 0) goto L40c80c;
+//nop;
+if (a0 == a3) goto L40c80c;
+L40c78c:
+v0 = MEM_U8(a3 + -1);
+at = 0x2d;
+t4 = s4 + v0;
+t6 = MEM_U8(t4 + 0);
+v1 = a3 + 0xffffffff;
+t5 = a0 + 0x1;
+if (t6 == 0) goto L40c7b0;
+a3 = a3 + 0xffffffff;
+goto L40c804;
+L40c7b0:
+//nop;
+if (v0 != at) goto L40c80c;
+v0 = v1;
+if (a3 == t5) goto L40c7ec;
+t8 = MEM_U8(v1 + -1);
+//nop;
+t9 = a3 - v0;
+if (s1 != t8) goto L40c7f0;
+L40c7d0:
+v0 = v0 + 0xffffffff;
+t9 = a3 - v0;
+if (v0 == a0) goto L40c7f0;
+t7 = MEM_U8(v0 + -1);
+//nop;
+//nop;
+if (s1 == t7) goto L40c7d0;
+L40c7ec:
+t9 = a3 - v0;
+L40c7f0:
+t4 = t9 + 0xffffffff;
+t6 = t4 & 0x1;
+//nop;
+if (t6 == 0) goto L40c80c;
+a3 = a3 + 0xfffffffe;
+L40c804:
+//nop;
+if (a0 != a3) goto L40c78c;
+L40c80c:
+//nop;
+s0 = a3 - a0;
+a2 = s0;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 406e0103 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+s5 = s5 + s0;
+t2 = 0x22;
+t3 = 0x5c;
+v0 = s5 + 0x1;
+goto L40c884;
+L40c844:
+a0 = MEM_U32(v1 + 4);
+a2 = MEM_U32(v1 + 12);
+//nop;
+MEM_U32(sp + 128) = t1;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 116) = v1;
+wrapper_bcopy(mem, a0, a1, a2);
+v1 = MEM_U32(sp + 116);
+// bdead 406c0113 gp = MEM_U32(sp + 52);
+t5 = MEM_U32(v1 + 12);
+t0 = MEM_U32(sp + 120);
+s5 = s5 + t5;
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+v0 = s5 + 0x1;
+L40c884:
+t8 = MEM_U32(sp + 68);
+//nop;
+//nop;
+if ((int)t8 >= (int)v0) goto L40c8bc;
+//nop;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+wrapper_abort(mem);
+// bdead 406c0103 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+L40c8bc:
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (t0 != 0) goto L40c34c;
+a0 = MEM_U32(sp + 168);
+//nop;
+L40c8d4:
+t9 = MEM_U32(a0 + 4);
+t7 = MEM_U32(sp + 164);
+at = (int)t1 < (int)t9;
+s0 = t1;
+s3 = t7 + s5;
+if (at == 0) goto L40c91c;
+t4 = MEM_U32(sp + 132);
+//nop;
+v0 = t4 + t1;
+L40c8f8:
+t6 = MEM_U8(v0 + 0);
+s0 = s0 + 0x1;
+MEM_U8(s3 + 0) = (uint8_t)t6;
+t5 = MEM_U32(a0 + 4);
+v0 = v0 + 0x1;
+at = (int)s0 < (int)t5;
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+if (at != 0) goto L40c8f8;
+L40c91c:
+MEM_U8(s3 + 0) = (uint8_t)zero;
+t8 = MEM_U32(sp + 172);
+s2 = s5;
+s0 = zero;
+if ((int)t8 <= 0) goto L40c998;
+s1 = MEM_U32(sp + 148);
+//nop;
+L40c938:
+a0 = MEM_U32(s1 + 20);
+//nop;
+//nop;
+if (a0 == 0) goto L40c960;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 400e0003 gp = MEM_U32(sp + 52);
+//nop;
+L40c960:
+a0 = MEM_U32(s1 + 24);
+//nop;
+t7 = MEM_U32(sp + 172);
+if (a0 == 0) goto L40c98c;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 400e0003 gp = MEM_U32(sp + 52);
+//nop;
+t7 = MEM_U32(sp + 172);
+L40c98c:
+s0 = s0 + 0x1;
+s1 = s1 + 0x20;
+if (s0 != t7) goto L40c938;
+L40c998:
+v1 = 0x10000030;
+a2 = MEM_U32(sp + 164);
+a3 = MEM_U32(sp + 176);
+a1 = MEM_U32(sp + 172);
+v1 = MEM_U32(v1 + 0);
+a0 = v1 + 0x1;
+goto L40c9cc;
+L40c9b4:
+t9 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(sp + 164) = t9;
+s2 = MEM_U32(v0 + 4);
+a2 = t9;
+a0 = v1 + 0x1;
+L40c9cc:
+t4 = a0 << 3;
+at = 0x10000030;
+t6 = 0x10002d50;
+t4 = t4 + a0;
+t4 = t4 << 2;
+MEM_U32(at + 0) = a0;
+v0 = t4 + t6;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 16) = a2;
+MEM_U32(v0 + 8) = s2;
+MEM_U32(v0 + 20) = a2;
+if ((int)a1 <= 0) goto L40ca08;
+MEM_U32(v0 + 32) = a2;
+goto L40ca0c;
+L40ca08:
+MEM_U32(v0 + 32) = zero;
+L40ca0c:
+t5 = 0x100001b4;
+MEM_U32(v0 + 24) = a3;
+t5 = MEM_U32(t5 + 0);
+t8 = 0x10002d3c;
+MEM_U32(v0 + 28) = t5;
+t8 = MEM_U32(t8 + 0);
+t7 = 0x18;
+// bdead 10101 ra = MEM_U32(sp + 60);
+if (t8 != 0) goto L40ca38;
+MEM_U32(a3 + 12) = t7;
+// bdead 1 ra = MEM_U32(sp + 60);
+L40ca38:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0xb0;
+return;
+}
+
+static uint32_t f_macarg(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40ca64:
+//macarg:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff48;
+// fdead 400000eb MEM_U32(sp + 56) = s6;
+s6 = 0x10000030;
+t8 = 0x10002d50;
+t6 = MEM_U32(s6 + 0);
+// fdead 428080eb MEM_U32(sp + 48) = s4;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+// fdead 428180eb MEM_U32(sp + 68) = ra;
+// fdead 428180eb MEM_U32(sp + 64) = gp;
+// fdead 428180eb MEM_U32(sp + 60) = s7;
+// fdead 428180eb MEM_U32(sp + 52) = s5;
+// fdead 428180eb MEM_U32(sp + 44) = s3;
+// fdead 428180eb MEM_U32(sp + 40) = s2;
+// fdead 428180eb MEM_U32(sp + 36) = s1;
+// fdead 428180eb MEM_U32(sp + 32) = s0;
+MEM_U32(sp + 176) = zero;
+MEM_U32(sp + 172) = zero;
+MEM_U32(sp + 168) = zero;
+s4 = t7 + t8;
+t9 = MEM_U32(s4 + 16);
+t3 = MEM_U32(s4 + 8);
+s7 = a0;
+a1 = t9 + t3;
+//nop;
+a0 = MEM_U32(s4 + 20);
+t4 = sp + 0xa8;
+MEM_U32(sp + 16) = t4;
+a2 = sp + 0xb0;
+a3 = sp + 0xac;
+v0 = f_macarg1(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(s4 + 0);
+// bdead 41a0400b gp = MEM_U32(sp + 64);
+s2 = v0;
+if (t5 == 0) goto L40cb18;
+t6 = MEM_U32(sp + 172);
+t7 = MEM_U32(sp + 168);
+//nop;
+if (t6 != 0) goto L40cb5c;
+//nop;
+if (t7 != 0) goto L40cb5c;
+L40cb18:
+t8 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+//nop;
+t3 = t8 + t9;
+//nop;
+if (v0 == t3) goto L40cb5c;
+//nop;
+if (s7 == 0) goto L40cb54;
+t4 = MEM_U32(s4 + 20);
+//nop;
+MEM_U32(s7 + 0) = t4;
+t5 = MEM_U32(s4 + 20);
+//nop;
+t6 = v0 - t5;
+MEM_U32(s7 + 8) = t6;
+L40cb54:
+MEM_U32(s4 + 20) = v0;
+goto L40cdc0;
+L40cb5c:
+t7 = MEM_U32(s4 + 20);
+s3 = MEM_U32(sp + 172);
+//nop;
+s1 = s2 - t7;
+a0 = s1 + s3;
+a0 = a0 + 0x1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 41bc000b gp = MEM_U32(sp + 64);
+MEM_U32(sp + 148) = zero;
+//nop;
+a0 = MEM_U32(s4 + 20);
+s5 = v0;
+a1 = v0;
+a2 = s1;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 41fc0003 gp = MEM_U32(sp + 64);
+MEM_U32(s4 + 20) = s2;
+t3 = MEM_U32(sp + 172);
+t9 = MEM_U32(s4 + 4);
+t5 = MEM_U32(s4 + 16);
+t6 = MEM_U32(s4 + 8);
+t4 = t9 + t3;
+t7 = t5 + t6;
+MEM_U32(s4 + 4) = t4;
+if (s2 != t7) goto L40cd00;
+L40cbc0:
+t8 = MEM_U32(s6 + 0);
+t3 = 0x10002d50;
+t9 = t8 << 3;
+t9 = t9 + t8;
+t9 = t9 << 2;
+t4 = t9 + t3;
+t5 = MEM_U32(t4 + 24);
+//nop;
+//nop;
+if (t5 != 0) goto L40cc0c;
+//nop;
+a0 = s5;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+//nop;
+v0 = 0x100018f4;
+v0 = v0;
+goto L40cfc8;
+L40cc0c:
+t7 = MEM_U32(s4 + 24);
+t6 = 0x17;
+MEM_U32(t7 + 12) = t6;
+//nop;
+a0 = MEM_U32(s4 + 16);
+//nop;
+wrapper_free(mem, a0);
+v1 = MEM_U32(s6 + 0);
+// bdead 41d40013 gp = MEM_U32(sp + 64);
+v1 = v1 + 0xffffffff;
+t8 = v1 << 3;
+t9 = 0x10002d50;
+t8 = t8 + v1;
+t8 = t8 << 2;
+s0 = t8 + t9;
+MEM_U32(s6 + 0) = v1;
+t3 = MEM_U32(s0 + 16);
+t4 = MEM_U32(s0 + 8);
+//nop;
+a0 = MEM_U32(s0 + 20);
+t5 = sp + 0xa8;
+s4 = s0;
+MEM_U32(sp + 172) = zero;
+MEM_U32(sp + 168) = zero;
+MEM_U32(sp + 16) = t5;
+a2 = sp + 0xb0;
+a3 = sp + 0xac;
+a1 = t3 + t4;
+v0 = f_macarg1(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s0 + 20);
+// bdead 41f6800b gp = MEM_U32(sp + 64);
+t8 = MEM_U32(sp + 172);
+MEM_U32(sp + 148) = s1;
+t7 = v0 - t6;
+//nop;
+s1 = s1 + t7;
+s3 = s3 + t8;
+a1 = s1 + s3;
+s2 = v0;
+a1 = a1 + 0x1;
+a0 = s5;
+v0 = f_xrealloc(mem, sp, a0, a1);
+a0 = MEM_U32(s0 + 20);
+// bdead 41be002b gp = MEM_U32(sp + 64);
+t9 = v0 + s1;
+a2 = s2 - a0;
+a1 = t9 - a2;
+//nop;
+s5 = v0;
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t3 = MEM_U32(s0 + 4);
+t4 = MEM_U32(sp + 172);
+t6 = MEM_U32(s0 + 16);
+t7 = MEM_U32(s0 + 8);
+// bdead 41ffb003 gp = MEM_U32(sp + 64);
+t5 = t3 + t4;
+t8 = t6 + t7;
+MEM_U32(s0 + 20) = s2;
+MEM_U32(s0 + 4) = t5;
+if (s2 == t8) goto L40cbc0;
+L40cd00:
+//nop;
+if (s7 == 0) goto L40cdc0;
+MEM_U32(s7 + 0) = s5;
+MEM_U32(s7 + 8) = s1;
+MEM_U32(s7 + 20) = s5;
+t9 = MEM_U32(sp + 172);
+s0 = s1 + s3;
+MEM_U8(s7 + 28) = (uint8_t)t9;
+t3 = MEM_U32(sp + 168);
+//nop;
+MEM_U8(s7 + 29) = (uint8_t)t3;
+t4 = MEM_U32(sp + 172);
+t5 = MEM_U32(sp + 168);
+//nop;
+if (t4 != 0) goto L40cd44;
+//nop;
+if (t5 == 0) goto L40cd80;
+L40cd44:
+t6 = MEM_U32(s4 + 0);
+t8 = MEM_U32(sp + 148);
+//nop;
+if (t6 == 0) goto L40cd80;
+t9 = MEM_U32(s7 + 8);
+t7 = MEM_U32(s7 + 0);
+a1 = t9 - t8;
+//nop;
+a2 = MEM_U32(sp + 172);
+a0 = t7 + t8;
+v0 = f_discard_comments(mem, sp, a0, a1, a2);
+t4 = MEM_U32(sp + 148);
+// bdead 4102200b gp = MEM_U32(sp + 64);
+t5 = v0 + t4;
+MEM_U32(s7 + 8) = t5;
+L40cd80:
+t6 = MEM_U32(s7 + 0);
+t7 = MEM_U32(s7 + 8);
+//nop;
+t8 = t6 + t7;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+t9 = MEM_U32(s7 + 8);
+//nop;
+//nop;
+if ((int)s0 >= (int)t9) goto L40cdc0;
+//nop;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 41000003 gp = MEM_U32(sp + 64);
+//nop;
+L40cdc0:
+s1 = zero;
+if (s7 == 0) goto L40cfc4;
+a1 = MEM_U32(s7 + 0);
+t3 = MEM_U32(s7 + 8);
+//nop;
+s0 = zero;
+a0 = sp + 0x70;
+a3 = 0x1;
+a2 = a1 + t3;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(sp + 128);
+// bdead 41062003 gp = MEM_U32(sp + 64);
+MEM_U32(s7 + 4) = t4;
+t5 = MEM_U32(sp + 120);
+v1 = MEM_U32(s7 + 0);
+t7 = MEM_U32(s7 + 8);
+MEM_U32(s7 + 12) = t5;
+t6 = MEM_U32(sp + 128);
+a2 = t7 + v1;
+MEM_U32(s7 + 24) = t6;
+if (v1 == a2) goto L40ce5c;
+a0 = 0x10006290;
+t8 = MEM_U8(v1 + 0);
+//nop;
+t9 = a0 + t8;
+t3 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L40ce5c;
+L40ce34:
+v1 = v1 + 0x1;
+//nop;
+if (v1 == a2) goto L40ce5c;
+t4 = MEM_U8(v1 + 0);
+//nop;
+t5 = a0 + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40ce34;
+L40ce5c:
+a0 = 0x10006290;
+a1 = 0x2;
+if (v1 == a2) goto L40ceac;
+t7 = MEM_U8(a2 + -1);
+//nop;
+t8 = a0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40ceac;
+L40ce84:
+a2 = a2 + 0xffffffff;
+//nop;
+if (v1 == a2) goto L40ceac;
+t3 = MEM_U8(a2 + -1);
+//nop;
+t4 = a0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L40ce84;
+L40ceac:
+t6 = 0x10002d3c;
+t2 = 0x27;
+t6 = MEM_U32(t6 + 0);
+t0 = 0x5c;
+//nop;
+if (t6 == 0) goto L40cecc;
+a1 = zero;
+goto L40cecc;
+L40cecc:
+//nop;
+if (v1 == a2) goto L40cfc0;
+t1 = 0xfb504f0;
+a3 = 0x22;
+L40cedc:
+v0 = MEM_U8(v1 + 0);
+v1 = v1 + 0x1;
+a1 = a1 + 0x1;
+if (s1 == 0) goto L40cef4;
+s1 = zero;
+goto L40cf2c;
+L40cef4:
+//nop;
+if (v0 != t0) goto L40cf00;
+s1 = 0x1;
+L40cf00:
+//nop;
+if (s0 == 0) goto L40cf18;
+//nop;
+if (v0 != s0) goto L40cf18;
+s0 = zero;
+goto L40cf2c;
+L40cf18:
+//nop;
+if (v0 == a3) goto L40cf28;
+t7 = a0 + v0;
+if (v0 != t2) goto L40cf30;
+L40cf28:
+s0 = v0;
+L40cf2c:
+t7 = a0 + v0;
+L40cf30:
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40cf88;
+//nop;
+if (s0 != 0) goto L40cf88;
+t9 = MEM_U8(v1 + 0);
+//nop;
+t3 = a0 + t9;
+t4 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40cfb8;
+L40cf64:
+t5 = MEM_U8(v1 + 1);
+v1 = v1 + 0x1;
+t6 = a0 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L40cf64;
+//nop;
+goto L40cfb8;
+L40cf88:
+//nop;
+if (v0 == a3) goto L40cf98;
+t8 = t1 + v0;
+if (v0 != t0) goto L40cfa0;
+L40cf98:
+a1 = a1 + 0x1;
+goto L40cfb8;
+L40cfa0:
+t9 = MEM_U8(t8 + 1);
+//nop;
+t3 = t9 & 0x57;
+//nop;
+if (t3 != 0) goto L40cfb8;
+a1 = a1 + 0x3;
+L40cfb8:
+//nop;
+if (v1 != a2) goto L40cedc;
+L40cfc0:
+MEM_U32(s7 + 16) = a1;
+L40cfc4:
+v0 = zero;
+L40cfc8:
+// bdead 9 ra = MEM_U32(sp + 68);
+// bdead 9 s0 = MEM_U32(sp + 32);
+// bdead 9 s1 = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 40);
+// bdead 9 s3 = MEM_U32(sp + 44);
+// bdead 9 s4 = MEM_U32(sp + 48);
+// bdead 9 s5 = MEM_U32(sp + 52);
+// bdead 9 s6 = MEM_U32(sp + 56);
+// bdead 9 s7 = MEM_U32(sp + 60);
+// bdead 9 sp = sp + 0xb8;
+return v0;
+}
+
+static uint32_t f_macarg1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40cff4:
+//macarg1:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 40) = s5;
+// fdead 400001eb MEM_U32(sp + 36) = s4;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = a0 < a1;
+s4 = a3;
+s5 = a1;
+// fdead 406001ef MEM_U32(sp + 60) = ra;
+// fdead 406001ef MEM_U32(sp + 56) = fp;
+// fdead 406001ef MEM_U32(sp + 52) = gp;
+// fdead 406001ef MEM_U32(sp + 48) = s7;
+// fdead 406001ef MEM_U32(sp + 44) = s6;
+// fdead 406001ef MEM_U32(sp + 32) = s3;
+// fdead 406001ef MEM_U32(sp + 28) = s2;
+// fdead 406001ef MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 72) = a2;
+s0 = a0;
+if (at == 0) goto L40d390;
+fp = 0x27;
+s7 = 0x2f;
+s6 = 0x2a;
+s3 = 0x5c;
+s2 = 0xa;
+L40d05c:
+v0 = MEM_U8(s0 + 0);
+//nop;
+v1 = v0;
+if (v0 < 0x30) goto L40d080;
+s1 = s0 + 0x1;
+if (v1 == s3) goto L40d0f0;
+s0 = s0 + 0x1;
+goto L40d384;
+L40d080:
+t6 = v1 + 0xfffffff6;
+//nop;
+if (t6 >= 0x26) goto L40d380;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L40d104;
+case 1: goto L40d380;
+case 2: goto L40d380;
+case 3: goto L40d380;
+case 4: goto L40d380;
+case 5: goto L40d380;
+case 6: goto L40d380;
+case 7: goto L40d380;
+case 8: goto L40d380;
+case 9: goto L40d380;
+case 10: goto L40d380;
+case 11: goto L40d380;
+case 12: goto L40d380;
+case 13: goto L40d380;
+case 14: goto L40d380;
+case 15: goto L40d380;
+case 16: goto L40d380;
+case 17: goto L40d380;
+case 18: goto L40d380;
+case 19: goto L40d380;
+case 20: goto L40d380;
+case 21: goto L40d380;
+case 22: goto L40d380;
+case 23: goto L40d380;
+case 24: goto L40d284;
+case 25: goto L40d380;
+case 26: goto L40d380;
+case 27: goto L40d380;
+case 28: goto L40d380;
+case 29: goto L40d284;
+case 30: goto L40d0b0;
+case 31: goto L40d0cc;
+case 32: goto L40d380;
+case 33: goto L40d380;
+case 34: goto L40d360;
+case 35: goto L40d380;
+case 36: goto L40d380;
+case 37: goto L40d118;
+}
+L40d0b0:
+t7 = MEM_U32(sp + 72);
+//nop;
+t8 = MEM_U32(t7 + 0);
+//nop;
+t9 = t8 + 0x1;
+MEM_U32(t7 + 0) = t9;
+goto L40d380;
+L40d0cc:
+t0 = MEM_U32(sp + 72);
+//nop;
+t1 = MEM_U32(t0 + 0);
+//nop;
+t2 = t1 + 0xffffffff;
+MEM_U32(t0 + 0) = t2;
+if ((int)t2 >= 0) goto L40d380;
+v0 = s0;
+goto L40d394;
+L40d0f0:
+s0 = s0 + 0x1;
+if (s1 >= s5) goto L40d384;
+s0 = s1;
+goto L40d380;
+L40d104:
+t3 = MEM_U32(s4 + 0);
+//nop;
+t4 = t3 + 0x1;
+MEM_U32(s4 + 0) = t4;
+goto L40d380;
+L40d118:
+v0 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s3 != v0) goto L40d154;
+t5 = MEM_U8(s0 + 2);
+//nop;
+//nop;
+if (s2 != t5) goto L40d154;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0001 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 1);
+//nop;
+L40d154:
+t6 = 0x10002d10;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40d1c4;
+t8 = 0x1;
+if (s7 != v0) goto L40d1c4;
+t9 = MEM_U32(sp + 80);
+s0 = s0 + 0x2;
+MEM_U32(t9 + 0) = t8;
+if (s0 >= s5) goto L40d1b0;
+t7 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < s5;
+if (s2 == t7) goto L40d1b0;
+L40d198:
+//nop;
+if (at == 0) goto L40d1b0;
+t1 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < s5;
+if (s2 != t1) goto L40d198;
+L40d1b0:
+t0 = MEM_U32(s4 + 0);
+//nop;
+t2 = t0 + 0x1;
+MEM_U32(s4 + 0) = t2;
+goto L40d380;
+L40d1c4:
+t3 = s0 + 0x1;
+if (s6 != v0) goto L40d380;
+t4 = 0x1;
+if (t3 >= s5) goto L40d380;
+s0 = s0 + 0x2;
+t5 = MEM_U32(sp + 80);
+s1 = s0 + 0x1;
+MEM_U32(t5 + 0) = t4;
+if (s1 >= s5) goto L40d380;
+L40d1f0:
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s6 != v0) goto L40d23c;
+t6 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s3 != t6) goto L40d23c;
+t8 = MEM_U8(s0 + 2);
+//nop;
+//nop;
+if (s2 != t8) goto L40d23c;
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40d23c:
+//nop;
+if (s6 != v0) goto L40d254;
+t9 = MEM_U8(s0 + 1);
+//nop;
+s0 = s0 + 0x1;
+if (s7 == t9) goto L40d384;
+L40d254:
+s0 = s1;
+if (s2 != v0) goto L40d26c;
+t7 = MEM_U32(s4 + 0);
+//nop;
+t1 = t7 + 0x1;
+MEM_U32(s4 + 0) = t1;
+L40d26c:
+s1 = s1 + 0x1;
+//nop;
+if (s1 < s5) goto L40d1f0;
+s0 = s0 + 0x1;
+goto L40d384;
+L40d284:
+s0 = s0 + 0x1;
+s1 = s0 + 0x1;
+v1 = v0;
+if (s1 >= s5) goto L40d380;
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (v1 == v0) goto L40d380;
+L40d2a8:
+//nop;
+if (s3 != v0) goto L40d318;
+v0 = MEM_U8(s1 + 0);
+s0 = s1;
+//nop;
+if (s2 != v0) goto L40d2d8;
+t0 = MEM_U32(s4 + 0);
+//nop;
+t2 = t0 + 0x1;
+MEM_U32(s4 + 0) = t2;
+v0 = MEM_U8(s1 + 0);
+//nop;
+L40d2d8:
+//nop;
+if (s3 != v0) goto L40d310;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != t3) goto L40d310;
+L40d2f0:
+t4 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (s3 != t4) goto L40d310;
+t5 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 == t5) goto L40d2f0;
+L40d310:
+s1 = s0 + 0x1;
+goto L40d334;
+L40d318:
+//nop;
+if (s2 != v0) goto L40d334;
+t6 = MEM_U32(s4 + 0);
+//nop;
+t8 = t6 + 0x1;
+MEM_U32(s4 + 0) = t8;
+if (v1 == fp) goto L40d380;
+L40d334:
+s0 = s1;
+s1 = s1 + 0x1;
+//nop;
+if (s1 >= s5) goto L40d380;
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (v1 != v0) goto L40d2a8;
+s0 = s0 + 0x1;
+goto L40d384;
+L40d360:
+t9 = MEM_U32(sp + 72);
+//nop;
+t7 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L40d380;
+v0 = s0;
+goto L40d394;
+L40d380:
+s0 = s0 + 0x1;
+L40d384:
+//nop;
+if (s0 < s5) goto L40d05c;
+L40d390:
+v0 = s0;
+L40d394:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint32_t f_discard_comments(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40d3c4:
+//discard_comments:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 60) = ra;
+// fdead 400000eb MEM_U32(sp + 56) = fp;
+// fdead 400000eb MEM_U32(sp + 52) = gp;
+// fdead 400000eb MEM_U32(sp + 48) = s7;
+// fdead 400000eb MEM_U32(sp + 44) = s6;
+// fdead 400000eb MEM_U32(sp + 40) = s5;
+// fdead 400000eb MEM_U32(sp + 36) = s4;
+// fdead 400000eb MEM_U32(sp + 32) = s3;
+// fdead 400000eb MEM_U32(sp + 28) = s2;
+// fdead 400000eb MEM_U32(sp + 24) = s1;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 64) = a0;
+if ((int)a2 <= 0) goto L40d484;
+v1 = a0 + a1;
+s0 = v1;
+s4 = v1 + a2;
+s7 = a0;
+if (a0 == v1) goto L40d484;
+a0 = v1 - a0;
+t7 = a0 & 0x3;
+a0 = -t7;
+v0 = a0 + v1;
+if (a0 == 0) goto L40d454;
+L40d430:
+t8 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffff;
+s4 = s4 + 0xffffffff;
+MEM_U8(s4 + 0) = (uint8_t)t8;
+if (v0 != s0) goto L40d430;
+t9 = MEM_U32(sp + 64);
+//nop;
+//nop;
+if (t9 == s0) goto L40d484;
+L40d454:
+t0 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffffc;
+MEM_U8(s4 + -1) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 2);
+s4 = s4 + 0xfffffffc;
+MEM_U8(s4 + 2) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 1);
+//nop;
+MEM_U8(s4 + 1) = (uint8_t)t2;
+t3 = MEM_U8(s0 + 0);
+MEM_U8(s4 + 0) = (uint8_t)t3;
+if (s7 != s0) goto L40d454;
+L40d484:
+s4 = MEM_U32(sp + 64);
+fp = 0xa;
+t5 = s4 + a1;
+s5 = t5 + a2;
+s0 = s4 + a2;
+s7 = s5;
+if (s0 >= s5) goto L40d6dc;
+s6 = 0x2a;
+s3 = 0x5c;
+s2 = 0xa;
+L40d4b0:
+v0 = MEM_U8(s0 + 0);
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s4 + -1) = (uint8_t)v0;
+if (v0 == fp) goto L40d4e8;
+at = 0x22;
+if (v0 == at) {
+at = 0x27;
+goto L40d638;}
+at = 0x27;
+if (v0 == at) {
+at = 0x2f;
+goto L40d638;}
+at = 0x2f;
+//nop;
+if (v0 == at) goto L40d4f4;
+at = s0 < s7;
+goto L40d6d4;
+L40d4e8:
+MEM_U8(s4 + 0) = (uint8_t)s2;
+s4 = s4 + 0x1;
+goto L40d6d0;
+L40d4f4:
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s3 != v0) goto L40d530;
+t6 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != t6) goto L40d530;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0001 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40d530:
+t7 = 0x10002d10;
+at = 0x2f;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40d590;
+//nop;
+if (v0 != at) goto L40d590;
+s0 = s0 + 0x1;
+s4 = s4 + 0xffffffff;
+if (s0 >= s5) goto L40d6d0;
+t8 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < s5;
+if (s2 == t8) goto L40d6d0;
+L40d570:
+if (at == 0) {
+at = s0 < s7;
+goto L40d6d4;}
+at = s0 < s7;
+t9 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < s5;
+if (s2 != t9) goto L40d570;
+at = s0 < s7;
+goto L40d6d4;
+L40d590:
+s1 = s0 + 0x1;
+if (s6 != v0) goto L40d6d0;
+if (s1 >= s5) {
+at = s0 < s7;
+goto L40d6d4;}
+at = s0 < s7;
+s0 = s1;
+s1 = s1 + 0x1;
+s4 = s4 + 0xffffffff;
+if (s1 >= s5) goto L40d630;
+L40d5b8:
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s6 != v0) goto L40d604;
+t0 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s3 != t0) goto L40d604;
+t1 = MEM_U8(s0 + 2);
+//nop;
+//nop;
+if (s2 != t1) goto L40d604;
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+//nop;
+L40d604:
+//nop;
+if (s6 != v0) goto L40d61c;
+t2 = MEM_U8(s0 + 1);
+at = 0x2f;
+//nop;
+if (t2 == at) goto L40d630;
+L40d61c:
+s0 = s1;
+s1 = s1 + 0x1;
+//nop;
+if (s1 < s7) goto L40d5b8;
+L40d630:
+s0 = s0 + 0x2;
+goto L40d6d0;
+L40d638:
+v1 = v0;
+if (s0 >= s5) goto L40d6d0;
+L40d644:
+v0 = MEM_U8(s0 + 0);
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s4 + -1) = (uint8_t)v0;
+if (v0 == v1) goto L40d6d0;
+at = 0x27;
+if (v0 != fp) goto L40d664;
+if (v1 == at) {
+at = 0x5c;
+goto L40d6d0;}
+L40d664:
+at = 0x5c;
+if (v0 != at) {
+at = s0 < s5;
+goto L40d6c4;}
+if (s0 >= s5) {
+at = s0 < s7;
+goto L40d6c8;}
+at = s0 < s7;
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s3 != v0) goto L40d6b8;
+t3 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 != t3) goto L40d6b8;
+L40d698:
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (s3 != v0) goto L40d6b8;
+t5 = MEM_U8(s0 + 1);
+//nop;
+//nop;
+if (s2 == t5) goto L40d698;
+L40d6b8:
+MEM_U8(s4 + 0) = (uint8_t)v0;
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+L40d6c4:
+at = s0 < s7;
+L40d6c8:
+//nop;
+if (at != 0) goto L40d644;
+L40d6d0:
+at = s0 < s7;
+L40d6d4:
+//nop;
+if (at != 0) goto L40d4b0;
+L40d6dc:
+t4 = MEM_U32(sp + 64);
+// bdead 202001 ra = MEM_U32(sp + 60);
+v0 = s4 - t4;
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint64_t f_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40d714:
+//error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+v1 = 0x10000030;
+// fdead 400001fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40d788;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10002d50;
+t6 = t6 << 2;
+v0 = t6 + v1;
+L40d760:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40d778;
+t0 = v0;
+goto L40d788;
+L40d778:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= v1) goto L40d760;
+L40d788:
+t9 = MEM_U32(sp + 52);
+if (t0 == 0) goto L40d7bc;
+a0 = 0xfb528e4;
+a1 = 0x1000190c;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+t9 = MEM_U32(sp + 52);
+L40d7bc:
+a0 = 0xfb528e4;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10001914;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 32);
+// bdead 3 ra = MEM_U32(sp + 36);
+v1 = 0x100001ac;
+v0 = zero;
+t1 = MEM_U32(v1 + 0);
+// bdead 419 sp = sp + 0x28;
+t2 = t1 + 0x1;
+MEM_U32(v1 + 0) = t2;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_error_from_errno(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40d820:
+//error_from_errno:
+//nop;
+//nop;
+//nop;
+v1 = 0x10000030;
+sp = sp + 0xffffffe0;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000003b MEM_U32(sp + 28) = ra;
+// fdead 4000003b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t0 = zero;
+if ((int)v1 < 0) goto L40d888;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10002d50;
+t6 = t6 << 2;
+v0 = t6 + v1;
+L40d860:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40d878;
+t0 = v0;
+goto L40d888;
+L40d878:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= v1) goto L40d860;
+L40d888:
+//nop;
+if (t0 == 0) goto L40d8b8;
+a0 = 0xfb528e4;
+a1 = 0x10001918;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40d8b8:
+v0 = 0xfb52720;
+t9 = 0xfb50300;
+v0 = MEM_U32(v0 + 0);
+t9 = MEM_U32(t9 + 0);
+a0 = 0xfb528e4;
+a0 = a0 + 0x20;
+if ((int)v0 >= (int)t9) goto L40d94c;
+at = 0x18;
+t1 = v0 << 2;
+if (v0 != at) goto L40d920;
+a3 = 0x10000030;
+//nop;
+a3 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if ((int)a3 < (int)0xb) goto L40d920;
+a1 = 0x10001920;
+//nop;
+a2 = MEM_U32(sp + 32);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+//nop;
+goto L40d968;
+L40d920:
+t2 = 0xfb500a0;
+a1 = 0x10001990;
+//nop;
+t3 = t1 + t2;
+a3 = MEM_U32(t3 + 0);
+a2 = MEM_U32(sp + 32);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+//nop;
+goto L40d968;
+L40d94c:
+a1 = 0x10001998;
+//nop;
+a2 = MEM_U32(sp + 32);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L40d968:
+v1 = 0x100001ac;
+// bdead 13 ra = MEM_U32(sp + 28);
+t4 = MEM_U32(v1 + 0);
+// bdead 2013 sp = sp + 0x20;
+t5 = t4 + 0x1;
+v0 = zero;
+MEM_U32(v1 + 0) = t5;
+return v0;
+}
+
+static uint32_t f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40d988:
+//warning:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+v1 = 0x10000030;
+// fdead 400001fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40d9fc;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10002d50;
+t6 = t6 << 2;
+v0 = t6 + v1;
+L40d9d4:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40d9ec;
+t0 = v0;
+goto L40d9fc;
+L40d9ec:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= v1) goto L40d9d4;
+L40d9fc:
+//nop;
+if (t0 == 0) goto L40da2c;
+a0 = 0xfb528e4;
+a1 = 0x100019b4;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+L40da2c:
+a0 = 0xfb528e4;
+a1 = 0x100019bc;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(sp + 52);
+a0 = 0xfb528e4;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100019c8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 13 ra = MEM_U32(sp + 36);
+// bdead 13 gp = MEM_U32(sp + 32);
+// bdead 13 sp = sp + 0x28;
+v0 = zero;
+return v0;
+}
+
+static void f_error_with_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t8 = 0,
+t9 = 0;
+L40daa0:
+//error_with_line:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+v1 = 0x10000030;
+// fdead 400000fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400000fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+// fdead 400000fb MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40db14;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10002d50;
+t6 = t6 << 2;
+v0 = t6 + v1;
+L40daec:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40db04;
+t0 = v0;
+goto L40db14;
+L40db04:
+v0 = v0 + 0xffffffdc;
+//nop;
+if (v0 >= v1) goto L40daec;
+L40db14:
+t9 = MEM_U32(sp + 56);
+if (t0 == 0) goto L40db48;
+a0 = 0xfb528e4;
+a1 = 0x100019cc;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(sp + 40);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+t9 = MEM_U32(sp + 56);
+L40db48:
+a0 = 0xfb528e4;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a2 = MEM_U32(sp + 48);
+a3 = MEM_U32(sp + 52);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100019d4;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+v1 = 0x100001ac;
+// bdead 11 v0 = zero;
+t1 = MEM_U32(v1 + 0);
+// bdead 411 sp = sp + 0x28;
+t2 = t1 + 0x1;
+MEM_U32(v1 + 0) = t2;
+return;
+}
+
+static uint32_t f_line_for_error(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t6 = 0, t9 = 0;
+L40dbac:
+//line_for_error:
+//nop;
+//nop;
+//nop;
+v0 = 0x10000030;
+v1 = a0;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t6 = v0 << 3;
+if ((int)v0 < 0) goto L40dc1c;
+t6 = t6 + v0;
+v0 = 0x10002d50;
+t6 = t6 << 2;
+a0 = t6 + v0;
+a1 = v0;
+L40dbe4:
+t9 = MEM_U32(a0 + 0);
+a0 = a0 + 0xffffffdc;
+at = a0 < v0;
+if (t9 == 0) goto L40dbfc;
+v0 = v1;
+return v0;
+L40dbfc:
+if (at == 0) {
+at = a0 < a1;
+goto L40dc10;}
+at = a0 < a1;
+v0 = zero;
+return v0;
+// fdead 0 at = a0 < a1;
+L40dc10:
+v1 = MEM_U32(a0 + 4);
+//nop;
+if (at == 0) goto L40dbe4;
+L40dc1c:
+//nop;
+return v0;
+}
+
+static uint64_t f_grow_outbuf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t9 = 0;
+L40dc24:
+//grow_outbuf:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+t6 = MEM_U32(a0 + 16);
+a3 = MEM_U32(a0 + 8);
+MEM_U32(sp + 32) = t6;
+t7 = MEM_U32(a0 + 20);
+a2 = a0;
+v0 = t7 - t6;
+t9 = a3 - v0;
+t0 = a3 << 1;
+if ((int)a1 < (int)t9) goto L40dd00;
+t1 = a1 << 2;
+t1 = t1 - a1;
+MEM_U32(a0 + 8) = t0;
+t2 = (int)t1 >> 1;
+if ((int)t1 >= 0) goto L40dc80;
+at = t1 + 0x1;
+t2 = (int)at >> 1;
+L40dc80:
+a3 = MEM_U32(a2 + 8);
+v1 = t2 + v0;
+//nop;
+if ((int)a3 >= (int)v1) goto L40dca4;
+t3 = MEM_U32(a2 + 16);
+MEM_U32(a2 + 8) = v1;
+a3 = v1;
+MEM_U32(sp + 32) = t3;
+L40dca4:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a3;
+MEM_U32(sp + 48) = a2;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 48);
+v1 = v0;
+if (v0 != 0) goto L40dce8;
+//nop;
+MEM_U32(sp + 44) = v1;
+MEM_U32(sp + 48) = a2;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 44);
+a2 = MEM_U32(sp + 48);
+//nop;
+L40dce8:
+t4 = MEM_U32(a2 + 20);
+t5 = MEM_U32(a2 + 16);
+MEM_U32(a2 + 16) = v1;
+t6 = t4 - t5;
+t7 = t6 + v1;
+MEM_U32(a2 + 20) = t7;
+L40dd00:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_install(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40dd10:
+//install:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = a1;
+// fdead 400201eb MEM_U32(sp + 28) = ra;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 44) = a3;
+if ((int)a1 >= 0) goto L40dd80;
+v0 = 0x10005f90;
+t7 = MEM_U8(a0 + 0);
+t3 = MEM_U32(sp + 32);
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+s0 = a0 - t3;
+if (t9 == 0) goto L40dd80;
+L40dd60:
+t0 = MEM_U8(a0 + 1);
+a0 = a0 + 0x1;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L40dd60;
+s0 = a0 - t3;
+L40dd80:
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 32);
+//nop;
+if ((int)a1 >= 0) goto L40dda8;
+//nop;
+a1 = s0;
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a1 = v0;
+L40dda8:
+//nop;
+a0 = s0 + 0x1d;
+MEM_U32(sp + 48) = a1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 48);
+t5 = 0x100049a0;
+t4 = a1 << 2;
+v1 = t4 + t5;
+MEM_U32(v0 + 8) = v1;
+t6 = MEM_U32(v1 + 0);
+a3 = v0;
+MEM_U32(v0 + 0) = t6;
+MEM_U32(v1 + 0) = v0;
+a0 = MEM_U32(v0 + 0);
+MEM_U32(v0 + 4) = zero;
+a2 = s0 & 0x3;
+if (a0 == 0) goto L40ddf4;
+MEM_U32(a0 + 4) = v0;
+L40ddf4:
+t7 = MEM_U32(sp + 40);
+MEM_U32(v0 + 16) = s0;
+MEM_U32(v0 + 12) = t7;
+t8 = MEM_U32(sp + 44);
+a0 = v0 + 0x1c;
+MEM_U32(v0 + 20) = a0;
+MEM_U32(v0 + 24) = t8;
+v1 = MEM_U32(sp + 32);
+a1 = zero;
+if ((int)s0 <= 0) goto L40de74;
+v0 = a2;
+if (a2 == 0) goto L40de44;
+L40de24:
+t9 = MEM_U8(v1 + 0);
+a1 = a1 + 0x1;
+a0 = a0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(a0 + -1) = (uint8_t)t9;
+if (v0 != a1) goto L40de24;
+//nop;
+if (a1 == s0) goto L40de74;
+L40de44:
+t0 = MEM_U8(v1 + 0);
+a1 = a1 + 0x4;
+MEM_U8(a0 + 0) = (uint8_t)t0;
+t1 = MEM_U8(v1 + 1);
+a0 = a0 + 0x4;
+MEM_U8(a0 + -3) = (uint8_t)t1;
+t2 = MEM_U8(v1 + 2);
+v1 = v1 + 0x4;
+MEM_U8(a0 + -2) = (uint8_t)t2;
+t3 = MEM_U8(v1 + -1);
+MEM_U8(a0 + -1) = (uint8_t)t3;
+if (a1 != s0) goto L40de44;
+L40de74:
+t4 = MEM_U32(a3 + 20);
+v0 = a3;
+t5 = t4 + s0;
+MEM_U8(t5 + 0) = (uint8_t)zero;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x20;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_lookup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40de94:
+//lookup:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+s1 = a1;
+s2 = a0;
+// fdead 400c01eb MEM_U32(sp + 36) = ra;
+// fdead 400c01eb MEM_U32(sp + 32) = gp;
+// fdead 400c01eb MEM_U32(sp + 20) = s0;
+if ((int)a1 >= 0) goto L40df04;
+v1 = 0x10005f90;
+t6 = MEM_U8(a0 + 0);
+v0 = a0;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+s1 = v0 - s2;
+if (t8 == 0) goto L40df04;
+L40dee4:
+t9 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L40dee4;
+s1 = v0 - s2;
+L40df04:
+a0 = s2;
+if ((int)a2 >= 0) goto L40df24;
+//nop;
+a1 = s1;
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c001b gp = MEM_U32(sp + 32);
+a2 = v0;
+L40df24:
+t3 = 0x100049a0;
+t2 = a2 << 2;
+t4 = t2 + t3;
+s0 = MEM_U32(t4 + 0);
+//nop;
+v0 = zero;
+if (s0 == 0) goto L40df88;
+L40df40:
+t5 = MEM_U32(s0 + 16);
+a1 = s2;
+//nop;
+if (s1 != t5) goto L40df74;
+//nop;
+a0 = MEM_U32(s0 + 20);
+a2 = s1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400e001b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L40df74;
+v0 = s0;
+goto L40df88;
+L40df74:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L40df40;
+v0 = zero;
+L40df88:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_delete_macro(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40dfa0:
+//delete_macro:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = MEM_U32(a0 + 4);
+//nop;
+//nop;
+if (v0 == 0) goto L40dfd4;
+t6 = MEM_U32(a0 + 0);
+//nop;
+MEM_U32(v0 + 0) = t6;
+L40dfd4:
+v0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L40dff0;
+t7 = MEM_U32(a0 + 4);
+//nop;
+MEM_U32(v0 + 4) = t7;
+L40dff0:
+v0 = MEM_U32(a0 + 8);
+//nop;
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (a0 != t8) goto L40e014;
+t9 = MEM_U32(a0 + 0);
+//nop;
+MEM_U32(v0 + 0) = t9;
+L40e014:
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static uint64_t f_hashf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, lo = 0, hi = 0;
+L40e034:
+//hashf:
+// bdead e3 v0 = a1;
+v1 = zero;
+if (a1 == 0) {
+a1 = a1 + 0xffffffff;
+goto L40e060;}
+a1 = a1 + 0xffffffff;
+L40e044:
+t6 = MEM_U8(a0 + 0);
+// bdead 80f1 v0 = a1;
+t7 = v1 << 2;
+a0 = a0 + 0x1;
+v1 = t6 + t7;
+if (a1 != 0) {
+a1 = a1 + 0xffffffff;
+goto L40e044;}
+a1 = a1 + 0xffffffff;
+L40e060:
+at = 0x7fff0000;
+at = at | 0xffff;
+t8 = v1 & at;
+lo = (int)t8 / (int)a2; hi = (int)t8 % (int)a2;
+//nop;
+if (a2 != 0) goto L40e07c;
+abort();
+L40e07c:
+at = 0xffffffff;
+if (a2 != at) {
+at = 0x80000000;
+goto L40e094;}
+at = 0x80000000;
+//nop;
+if (t8 != at) goto L40e094;
+abort();
+L40e094:
+v0 = hi;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_dump_all_macros(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L40e0a0:
+//dump_all_macros:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+// fdead 4000000b MEM_U32(sp + 56) = fp;
+// fdead 4000000b MEM_U32(sp + 48) = s7;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+s5 = 0x100019e8;
+s6 = 0x100019f4;
+s7 = 0x100019f8;
+fp = 0x10001a00;
+t6 = 0x100049a0;
+// fdead c1c0800b MEM_U32(sp + 60) = ra;
+// fdead c1c0800b MEM_U32(sp + 52) = gp;
+// fdead c1c0800b MEM_U32(sp + 36) = s4;
+// fdead c1c0800b MEM_U32(sp + 32) = s3;
+// fdead c1c0800b MEM_U32(sp + 28) = s2;
+// fdead c1c0800b MEM_U32(sp + 24) = s1;
+// fdead c1c0800b MEM_U32(sp + 20) = s0;
+s5 = s5;
+s6 = s6;
+s7 = s7;
+fp = fp;
+MEM_U32(sp + 64) = t6;
+L40e104:
+t7 = MEM_U32(sp + 64);
+//nop;
+v0 = MEM_U32(t7 + 0);
+//nop;
+t5 = MEM_U32(sp + 64);
+if (v0 == 0) goto L40e330;
+L40e11c:
+t8 = MEM_U32(v0 + 12);
+at = 0x17;
+s4 = zero;
+if (t8 != at) goto L40e31c;
+a0 = 0x100019d8;
+//nop;
+s2 = MEM_U32(v0 + 24);
+a1 = MEM_U32(v0 + 20);
+MEM_U32(sp + 88) = v0;
+s3 = zero;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+t9 = MEM_U32(s2 + 0);
+// bdead c5f801c3 gp = MEM_U32(sp + 52);
+//nop;
+if ((int)t9 < 0) goto L40e1ec;
+a0 = 0x100019e4;
+//nop;
+s1 = zero;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+t0 = MEM_U32(s2 + 0);
+// bdead c1fc03c3 gp = MEM_U32(sp + 52);
+//nop;
+if ((int)t0 <= 0) goto L40e1d0;
+L40e180:
+//nop;
+a0 = s2;
+a1 = s1;
+f_dump_arg_n(mem, sp, a0, a1);
+v0 = MEM_U32(s2 + 0);
+s0 = s1 + 0x1;
+// bdead c1fa01cb gp = MEM_U32(sp + 52);
+if ((int)s0 >= (int)v0) {
+at = (int)s0 < (int)v0;
+goto L40e1c8;}
+at = (int)s0 < (int)v0;
+//nop;
+a0 = s5;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1fa01c3 gp = MEM_U32(sp + 52);
+v0 = MEM_U32(s2 + 0);
+//nop;
+at = (int)s0 < (int)v0;
+L40e1c8:
+s1 = s0;
+if (at != 0) goto L40e180;
+L40e1d0:
+a0 = 0x100019ec;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1f801c3 gp = MEM_U32(sp + 52);
+//nop;
+L40e1ec:
+a0 = 0x100019f0;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+s0 = MEM_U32(s2 + 12);
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+//nop;
+if (s0 == 0) goto L40e2dc;
+L40e210:
+//nop;
+a0 = MEM_U32(s2 + 8);
+a2 = MEM_U32(s0 + 8);
+a1 = s4;
+f_dump_defn_1(mem, sp, a0, a1, a2);
+v0 = MEM_U32(s0 + 8);
+// bdead c1fa01cb gp = MEM_U32(sp + 52);
+//nop;
+if (v0 == 0) goto L40e238;
+s3 = zero;
+L40e238:
+t1 = MEM_U8(s0 + 4);
+s4 = s4 + v0;
+//nop;
+if (t1 == 0) goto L40e260;
+//nop;
+a0 = s6;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1fa01c3 gp = MEM_U32(sp + 52);
+//nop;
+L40e260:
+t2 = MEM_U8(s0 + 5);
+//nop;
+//nop;
+if (t2 == 0) goto L40e290;
+//nop;
+if (s3 != 0) goto L40e290;
+//nop;
+a0 = s7;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1ea0003 gp = MEM_U32(sp + 52);
+//nop;
+L40e290:
+//nop;
+a1 = MEM_U32(s0 + 12);
+s3 = zero;
+a0 = s2;
+f_dump_arg_n(mem, sp, a0, a1);
+t3 = MEM_U8(s0 + 6);
+// bdead c1fa11c3 gp = MEM_U32(sp + 52);
+//nop;
+if (t3 == 0) goto L40e2cc;
+//nop;
+a0 = fp;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1ea0003 gp = MEM_U32(sp + 52);
+s3 = 0x1;
+L40e2cc:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L40e210;
+L40e2dc:
+t4 = MEM_U32(s2 + 4);
+//nop;
+a0 = MEM_U32(s2 + 8);
+a1 = s4;
+a2 = t4 - s4;
+f_dump_defn_1(mem, sp, a0, a1, a2);
+// bdead c1c001c3 gp = MEM_U32(sp + 52);
+//nop;
+a0 = 0x10001a08;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1c00183 gp = MEM_U32(sp + 52);
+v0 = MEM_U32(sp + 88);
+//nop;
+L40e31c:
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 != 0) goto L40e11c;
+t5 = MEM_U32(sp + 64);
+L40e330:
+t7 = 0x100049a0;
+t6 = t5 + 0x4;
+t7 = t7 + 0x15ec;
+MEM_U32(sp + 64) = t6;
+if (t6 != t7) goto L40e104;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static void f_dump_defn_1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40e374:
+//dump_defn_1:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400000eb MEM_U32(sp + 44) = s4;
+v0 = a0 + a1;
+s4 = v0 + a2;
+// fdead 402000eb MEM_U32(sp + 28) = s0;
+at = v0 < s4;
+// fdead 402000ef MEM_U32(sp + 68) = ra;
+// fdead 402000ef MEM_U32(sp + 64) = fp;
+// fdead 402000ef MEM_U32(sp + 60) = gp;
+// fdead 402000ef MEM_U32(sp + 56) = s7;
+// fdead 402000ef MEM_U32(sp + 52) = s6;
+// fdead 402000ef MEM_U32(sp + 48) = s5;
+// fdead 402000ef MEM_U32(sp + 40) = s3;
+// fdead 402000ef MEM_U32(sp + 36) = s2;
+// fdead 402000ef MEM_U32(sp + 32) = s1;
+s0 = v0;
+MEM_U32(sp + 72) = s4;
+if (at == 0) goto L40e4dc;
+s3 = 0xfb528e4;
+s6 = 0xfb51f00;
+s1 = 0xfb528e4;
+fp = 0x27;
+s7 = 0x22;
+s5 = 0xa;
+s3 = s3 + 0x10;
+L40e3e4:
+v0 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s5 == v0) goto L40e474;
+t6 = MEM_U32(s6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40e420;
+//nop;
+a0 = v0;
+a1 = s3;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead c1f60003 gp = MEM_U32(sp + 60);
+t4 = MEM_U32(sp + 72);
+goto L40e4cc;
+L40e420:
+t7 = MEM_U32(s1 + 16);
+//nop;
+t9 = t7 + 0xffffffff;
+MEM_U32(s1 + 16) = t9;
+if ((int)t9 >= 0) goto L40e450;
+//nop;
+a0 = MEM_U8(s0 + 0);
+a1 = s3;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead c1f60003 gp = MEM_U32(sp + 60);
+t4 = MEM_U32(sp + 72);
+goto L40e4cc;
+L40e450:
+t0 = MEM_U8(s0 + 0);
+t1 = MEM_U32(s1 + 20);
+//nop;
+MEM_U8(t1 + 0) = (uint8_t)t0;
+t2 = MEM_U32(s1 + 20);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(s1 + 20) = t3;
+goto L40e4c8;
+L40e474:
+a0 = s0;
+if (s7 == v0) goto L40e484;
+t4 = MEM_U32(sp + 72);
+if (fp != v0) goto L40e4cc;
+L40e484:
+//nop;
+a1 = s4;
+a2 = zero;
+a3 = zero;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 20) = zero;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1f6000b gp = MEM_U32(sp + 60);
+s2 = v0;
+//nop;
+a0 = s0;
+a1 = v0 - s0;
+a2 = 0x1;
+a3 = s3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead c1fc0003 gp = MEM_U32(sp + 60);
+s0 = s2 + 0xffffffff;
+L40e4c8:
+t4 = MEM_U32(sp + 72);
+L40e4cc:
+s0 = s0 + 0x1;
+//nop;
+if (s0 < t4) goto L40e3e4;
+L40e4dc:
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 s1 = MEM_U32(sp + 32);
+// bdead 1 s2 = MEM_U32(sp + 36);
+// bdead 1 s3 = MEM_U32(sp + 40);
+// bdead 1 s4 = MEM_U32(sp + 44);
+// bdead 1 s5 = MEM_U32(sp + 48);
+// bdead 1 s6 = MEM_U32(sp + 52);
+// bdead 1 s7 = MEM_U32(sp + 56);
+// bdead 1 fp = MEM_U32(sp + 64);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void f_dump_arg_n(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L40e50c:
+//dump_arg_n:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+t6 = MEM_U32(a0 + 0);
+s0 = a1 + 0x1;
+s1 = MEM_U32(a0 + 16);
+s2 = a0;
+if ((int)s0 >= (int)t6) goto L40e578;
+L40e550:
+//nop;
+a0 = s1;
+a1 = 0x20;
+v0 = wrapper_strchr(mem, a0, a1);
+t7 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+// bdead 400b0009 gp = MEM_U32(sp + 40);
+s1 = v0 + 0x1;
+if ((int)s0 < (int)t7) goto L40e550;
+L40e578:
+v0 = MEM_U8(s1 + 0);
+s4 = 0x2c;
+// bdead 40240009 ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L40e638;
+// bdead 40240009 ra = MEM_U32(sp + 44);
+if (s4 == v0) goto L40e638;
+s2 = 0xfb528e4;
+s3 = 0xfb51f00;
+s0 = 0xfb528e4;
+s2 = s2 + 0x10;
+L40e5a0:
+t8 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40e5cc;
+//nop;
+a0 = v0;
+a1 = s2;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 403e0001 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s1 + 1);
+goto L40e620;
+L40e5cc:
+t9 = MEM_U32(s0 + 16);
+//nop;
+t0 = t9 + 0xffffffff;
+MEM_U32(s0 + 16) = t0;
+if ((int)t0 >= 0) goto L40e5fc;
+//nop;
+a0 = MEM_U8(s1 + 0);
+a1 = s2;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 403e0001 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s1 + 1);
+goto L40e620;
+L40e5fc:
+t2 = MEM_U8(s1 + 0);
+t3 = MEM_U32(s0 + 20);
+//nop;
+MEM_U8(t3 + 0) = (uint8_t)t2;
+t4 = MEM_U32(s0 + 20);
+//nop;
+t5 = t4 + 0x1;
+MEM_U32(s0 + 20) = t5;
+v0 = MEM_U8(s1 + 1);
+L40e620:
+s1 = s1 + 0x1;
+// bdead 403e0009 ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L40e638;
+//nop;
+if (s4 != v0) goto L40e5a0;
+// bdead 1 ra = MEM_U32(sp + 44);
+L40e638:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void f_initialize_char_syntax(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L40e654:
+//initialize_char_syntax:
+//nop;
+//nop;
+//nop;
+v1 = 0x10005f90;
+a0 = 0x10006090;
+v0 = 0x10006090;
+a1 = 0x1;
+v1 = v1 + 0x61;
+a0 = a0 + 0x61;
+v0 = v0 + 0x7b;
+L40e67c:
+a0 = a0 + 0x1;
+at = a0 < v0;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -33) = (uint8_t)a1;
+MEM_U8(v1 + -1) = (uint8_t)a1;
+MEM_U8(a0 + -33) = (uint8_t)a1;
+MEM_U8(a0 + -1) = (uint8_t)a1;
+if (at != 0) goto L40e67c;
+at = 0x10005f90;
+v1 = 0x10005f90;
+MEM_U8(at + 48) = (uint8_t)a1;
+at = 0x10005f90;
+v0 = 0x10005f90;
+v1 = v1 + 0x32;
+MEM_U8(at + 49) = (uint8_t)a1;
+v0 = v0 + 0x3a;
+L40e6bc:
+v1 = v1 + 0x4;
+MEM_U8(v1 + -3) = (uint8_t)a1;
+MEM_U8(v1 + -2) = (uint8_t)a1;
+MEM_U8(v1 + -1) = (uint8_t)a1;
+MEM_U8(v1 + -4) = (uint8_t)a1;
+if (v1 != v0) goto L40e6bc;
+v1 = 0x10005f90;
+a0 = 0x10006090;
+v0 = 0x100001b0;
+MEM_U8(v1 + 95) = (uint8_t)a1;
+MEM_U8(a0 + 95) = (uint8_t)a1;
+v0 = MEM_U32(v0 + 0);
+a3 = 0x10006290;
+a2 = 0x10006190;
+MEM_U8(v1 + 36) = (uint8_t)v0;
+MEM_U8(a0 + 36) = (uint8_t)v0;
+MEM_U8(a3 + 32) = (uint8_t)a1;
+MEM_U8(a3 + 9) = (uint8_t)a1;
+MEM_U8(a3 + 11) = (uint8_t)a1;
+MEM_U8(a3 + 12) = (uint8_t)a1;
+MEM_U8(a3 + 10) = (uint8_t)a1;
+MEM_U8(a2 + 32) = (uint8_t)a1;
+MEM_U8(a2 + 9) = (uint8_t)a1;
+MEM_U8(a2 + 11) = (uint8_t)a1;
+MEM_U8(a2 + 12) = (uint8_t)a1;
+return;
+}
+
+static void f_initialize_builtins(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40e724:
+//initialize_builtins:
+//nop;
+//nop;
+//nop;
+a0 = 0x10001a0c;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+t6 = 0xffffffff;
+// fdead 4000802b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = 0xffffffff;
+a2 = 0xf;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t7 = 0xffffffff;
+a0 = 0x10001a18;
+//nop;
+MEM_U32(sp + 16) = t7;
+a1 = 0xffffffff;
+a2 = 0x10;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t8 = 0xffffffff;
+a0 = 0x10001a24;
+//nop;
+MEM_U32(sp + 16) = t8;
+a1 = 0xffffffff;
+a2 = 0x11;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t9 = 0xffffffff;
+MEM_U32(sp + 16) = t9;
+//nop;
+a0 = 0x10001a30;
+a1 = 0xffffffff;
+a2 = 0x12;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t0 = 0xffffffff;
+a0 = 0x10001a40;
+//nop;
+MEM_U32(sp + 16) = t0;
+a1 = 0xffffffff;
+a2 = 0x13;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t1 = 0xffffffff;
+a0 = 0x10001a54;
+//nop;
+MEM_U32(sp + 16) = t1;
+a1 = 0xffffffff;
+a2 = 0x14;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t2 = 0xffffffff;
+a0 = 0x10001a60;
+//nop;
+MEM_U32(sp + 16) = t2;
+a1 = 0xffffffff;
+a2 = 0x15;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t3 = 0xffffffff;
+a0 = 0x10001a6c;
+//nop;
+MEM_U32(sp + 16) = t3;
+a1 = 0xffffffff;
+a2 = 0x16;
+a3 = 0x1;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_make_definition(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40e888:
+//make_definition:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+// fdead 400000ab MEM_U32(sp + 20) = s0;
+v1 = 0x10005f90;
+t6 = MEM_U8(a0 + 0);
+a1 = a0;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+s0 = a0;
+v0 = a0;
+if (t8 == 0) goto L40e8e0;
+L40e8c4:
+t9 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L40e8c4;
+L40e8e0:
+t2 = MEM_U8(v0 + 0);
+a0 = v0 - a1;
+//nop;
+if (t2 != 0) goto L40e93c;
+//nop;
+a0 = a0 + 0x4;
+MEM_U32(sp + 56) = a1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 56);
+//nop;
+s0 = v0;
+a0 = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = s0;
+a1 = 0x10001a7c;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+//nop;
+L40e93c:
+v1 = 0x10000030;
+t4 = 0x10002d50;
+v0 = MEM_U32(v1 + 0);
+t5 = 0x10001a80;
+v0 = v0 + 0x1;
+t3 = v0 << 3;
+t3 = t3 + v0;
+t3 = t3 << 2;
+a1 = t3 + t4;
+t5 = t5;
+MEM_U32(a1 + 0) = t5;
+MEM_U32(a1 + 20) = s0;
+MEM_U32(a1 + 16) = s0;
+MEM_U32(v1 + 0) = v0;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = s0;
+v0 = wrapper_strlen(mem, a0);
+a1 = MEM_U32(sp + 32);
+// bdead 4002004b gp = MEM_U32(sp + 24);
+v1 = 0x1;
+t6 = 0x100001b4;
+MEM_U32(a1 + 8) = v0;
+MEM_U32(a1 + 4) = v1;
+MEM_U32(a1 + 24) = zero;
+MEM_U32(a1 + 32) = zero;
+t6 = MEM_U32(t6 + 0);
+a3 = 0x10000080;
+MEM_U32(a1 + 28) = t6;
+t7 = MEM_U32(a3 + 12);
+//nop;
+//nop;
+if (v1 == t7) goto L40e9d0;
+L40e9c0:
+t8 = MEM_U32(a3 + 32);
+a3 = a3 + 0x14;
+//nop;
+if (v1 != t8) goto L40e9c0;
+L40e9d0:
+//nop;
+a0 = s0;
+MEM_U32(sp + 48) = a3;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+//nop;
+a0 = s0;
+a1 = v0 + s0;
+a2 = zero;
+temp64 = f_do_define(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+v1 = 0x10000030;
+// bdead 11 s0 = MEM_U32(sp + 20);
+t9 = MEM_U32(v1 + 0);
+// bdead 4000011 sp = sp + 0x38;
+t0 = t9 + 0xffffffff;
+MEM_U32(v1 + 0) = t0;
+return;
+}
+
+static void f_make_undef(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40ea20:
+//make_undef:
+//nop;
+//nop;
+//nop;
+v1 = 0x10000030;
+t7 = 0x10002d50;
+v0 = MEM_U32(v1 + 0);
+t8 = 0x10001a94;
+v0 = v0 + 0x1;
+t6 = v0 << 3;
+t6 = t6 + v0;
+t6 = t6 << 2;
+a1 = t6 + t7;
+t8 = t8;
+sp = sp + 0xffffffd0;
+MEM_U32(a1 + 0) = t8;
+MEM_U32(a1 + 20) = a0;
+MEM_U32(a1 + 16) = a0;
+MEM_U32(v1 + 0) = v0;
+//nop;
+// fdead 420180fb MEM_U32(sp + 28) = ra;
+// fdead 420180fb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 32) = a1;
+v0 = wrapper_strlen(mem, a0);
+a1 = MEM_U32(sp + 32);
+// bdead 4000004b gp = MEM_U32(sp + 24);
+t9 = 0x1;
+t0 = 0x100001b4;
+MEM_U32(a1 + 8) = v0;
+MEM_U32(a1 + 4) = t9;
+MEM_U32(a1 + 24) = zero;
+MEM_U32(a1 + 32) = zero;
+t0 = MEM_U32(t0 + 0);
+a3 = 0x10000080;
+MEM_U32(a1 + 28) = t0;
+t1 = MEM_U32(a3 + 12);
+v1 = 0x9;
+a0 = MEM_U32(sp + 48);
+//nop;
+if (v1 == t1) goto L40ead0;
+L40eac0:
+t2 = MEM_U32(a3 + 32);
+a3 = a3 + 0x14;
+//nop;
+if (v1 != t2) goto L40eac0;
+L40ead0:
+//nop;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 40) = a3;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+//nop;
+a3 = MEM_U32(sp + 40);
+a1 = v0 + a0;
+a1 = a1 + 0xffffffff;
+a2 = zero;
+temp64 = f_do_undef(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+v1 = 0x10000030;
+//nop;
+t3 = MEM_U32(v1 + 0);
+// bdead 1011 sp = sp + 0x30;
+t4 = t3 + 0xffffffff;
+MEM_U32(v1 + 0) = t4;
+return;
+}
+
+static uint32_t f_deps_output(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40eb24:
+//deps_output:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+a2 = a1;
+if (a1 != 0) goto L40eb60;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = v0;
+L40eb60:
+t0 = 0x10006398;
+v0 = 0x10006394;
+v1 = MEM_U32(t0 + 0);
+t6 = MEM_U32(v0 + 0);
+a3 = v1 + a2;
+t7 = a3 + 0x32;
+if ((int)a3 < (int)t6) goto L40ebbc;
+MEM_U32(v0 + 0) = t7;
+a1 = t7 << 1;
+a0 = 0x10006390;
+MEM_U32(v0 + 0) = a1;
+//nop;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(sp + 36) = a2;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+at = 0x10006390;
+t0 = 0x10006398;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(t0 + 0);
+//nop;
+L40ebbc:
+t1 = 0x10006390;
+//nop;
+t1 = MEM_U32(t1 + 0);
+a0 = MEM_U32(sp + 32);
+MEM_U32(sp + 36) = a2;
+a1 = t1 + v1;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 40000013 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+v0 = 0x1000639c;
+t0 = 0x10006398;
+t4 = MEM_U32(v0 + 0);
+t2 = MEM_U32(t0 + 0);
+t6 = 0x10006390;
+t5 = t4 + a2;
+t3 = t2 + a2;
+MEM_U32(v0 + 0) = t5;
+MEM_U32(t0 + 0) = t3;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t8 = t6 + t3;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_bzero(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L40ec24:
+if ((int)zero >= (int)a1) {
+a1 = a1 + 0xffffffff;
+goto L40ec44;}
+a1 = a1 + 0xffffffff;
+L40ec30:
+v0 = (int)zero < (int)a1;
+a1 = a1 + 0xffffffff;
+MEM_U8(a0 + 0) = (uint8_t)zero;
+a0 = a0 + 0x1;
+if (v0 != 0) goto L40ec30;
+L40ec44:
+//nop;
+return;
+}
+
+static uint32_t f_bcopy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0;
+L40ec4c:
+//bcopy:
+v0 = (int)zero < (int)a2;
+a2 = a2 + 0xffffffff;
+if (v0 == 0) goto L40ec74;
+L40ec58:
+t6 = MEM_U8(a0 + 0);
+v0 = (int)zero < (int)a2;
+a2 = a2 + 0xffffffff;
+a1 = a1 + 0x1;
+a0 = a0 + 0x1;
+MEM_U8(a1 + -1) = (uint8_t)t6;
+if (v0 != 0) goto L40ec58;
+L40ec74:
+//nop;
+return v0;
+}
+
+static uint32_t f_bcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L40ec7c:
+if ((int)zero >= (int)a2) {
+a2 = a2 + 0xffffffff;
+goto L40ecb0;}
+a2 = a2 + 0xffffffff;
+L40ec88:
+t6 = MEM_U8(a0 + 0);
+t7 = MEM_U8(a1 + 0);
+a0 = a0 + 0x1;
+a1 = a1 + 0x1;
+if (t6 == t7) goto L40eca4;
+v0 = 0x1;
+return v0;
+L40eca4:
+if ((int)zero < (int)a2) {
+a2 = a2 + 0xffffffff;
+goto L40ec88;}
+a2 = a2 + 0xffffffff;
+L40ecb0:
+v0 = zero;
+//nop;
+return v0;
+}
+
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L40ecbc:
+//fatal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+a2 = 0x10002d0c;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+a1 = 0x10001a9c;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+a0 = 0xfb528e4;
+//nop;
+a2 = MEM_U32(sp + 36);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10001aa4;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+return;
+}
+
+static void f_perror_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40ed60:
+//perror_with_name:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+a2 = 0x10002d0c;
+MEM_U32(sp + 32) = a0;
+a0 = 0xfb528e4;
+a1 = 0x10001aa8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+v0 = 0xfb52720;
+t6 = 0xfb50300;
+v0 = MEM_U32(v0 + 0);
+t6 = MEM_U32(t6 + 0);
+a0 = 0xfb528e4;
+a0 = a0 + 0x20;
+if ((int)v0 >= (int)t6) goto L40edf0;
+t8 = 0xfb500a0;
+t7 = v0 << 2;
+t9 = t7 + t8;
+a3 = MEM_U32(t9 + 0);
+//nop;
+a1 = 0x10001ab0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+goto L40ee0c;
+L40edf0:
+a1 = 0x10001ab8;
+//nop;
+a1 = a1;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40ee0c:
+v0 = 0x100001ac;
+// bdead 9 ra = MEM_U32(sp + 28);
+t0 = MEM_U32(v0 + 0);
+// bdead 209 sp = sp + 0x20;
+t1 = t0 + 0x1;
+MEM_U32(v0 + 0) = t1;
+return;
+}
+
+static void f_pfatal_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L40ee28:
+//pfatal_with_name:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000016b MEM_U32(sp + 28) = ra;
+// fdead 4000016b MEM_U32(sp + 24) = gp;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_memory_full(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L40ee70:
+//memory_full:
+//nop;
+//nop;
+//nop;
+a0 = 0x10001ad4;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001ab MEM_U32(sp + 28) = ra;
+// fdead 400001ab MEM_U32(sp + 24) = gp;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L40eea8:
+//xmalloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40eedc;
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40eef8;
+L40eedc:
+//nop;
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 9 ra = MEM_U32(sp + 28);
+L40eef8:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L40ef04:
+//xrealloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40ef38;
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40ef54;
+L40ef38:
+//nop;
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 9 ra = MEM_U32(sp + 28);
+L40ef54:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t f_xcalloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, s0 = 0, lo = 0,
+hi = 0;
+L40ef60:
+//xcalloc:
+//nop;
+//nop;
+//nop;
+lo = a0 * a1;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a1 >> 32);
+sp = sp + 0xffffffd8;
+// fdead 6400001eb MEM_U32(sp + 20) = s0;
+//nop;
+// fdead 6400001eb MEM_U32(sp + 28) = ra;
+// fdead 6400001eb MEM_U32(sp + 24) = gp;
+s0 = lo;
+a0 = s0;
+MEM_U32(sp + 36) = s0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002004b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+MEM_U32(sp + 32) = v0;
+if (v0 == 0) goto L40f02c;
+v1 = v0;
+if ((int)s0 < (int)0x65) goto L40efcc;
+//nop;
+a0 = v0;
+a1 = s0;
+wrapper_bzero(mem, a0, a1);
+// bdead 40000011 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 32);
+goto L40f024;
+L40efcc:
+a2 = v0 + s0;
+a1 = a2 + 0xfffffffc;
+t0 = s0 + 0xfffffffc;
+a0 = t0;
+if (v0 >= a1) goto L40eff4;
+L40efe4:
+v1 = v1 + 0x4;
+MEM_U32(v1 + -4) = zero;
+if (v1 < a1) goto L40efe4;
+L40eff4:
+at = (int)a0 < (int)s0;
+if ((int)t0 >= 0) goto L40f004;
+a0 = zero;
+at = (int)a0 < (int)s0;
+L40f004:
+v1 = v0 + a0;
+if (at == 0) goto L40f020;
+L40f00c:
+a0 = a0 + 0x1;
+at = (int)a0 < (int)a3;
+MEM_U8(v1 + 0) = (uint8_t)zero;
+v1 = v1 + 0x1;
+if (at != 0) goto L40f00c;
+L40f020:
+v0 = MEM_U32(sp + 32);
+L40f024:
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L40f048;
+L40f02c:
+//nop;
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 19 ra = MEM_U32(sp + 28);
+L40f048:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_savestring(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L40f054:
+//savestring:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(sp + 32) = v0;
+a0 = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000011 ra = MEM_U32(sp + 28);
+// bdead 40000011 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 32);
+// bdead 19 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_file_size_and_mode(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L40f0bc:
+//file_size_and_mode:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff58;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 172) = a1;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 176) = a2;
+a1 = sp + 0x20;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 172);
+a0 = MEM_U32(sp + 176);
+//nop;
+if ((int)v0 >= 0) goto L40f104;
+v0 = 0xffffffff;
+goto L40f12c;
+L40f104:
+v0 = zero;
+if (v1 == 0) goto L40f118;
+t6 = MEM_U32(sp + 52);
+//nop;
+MEM_U32(v1 + 0) = t6;
+L40f118:
+//nop;
+if (a0 == 0) goto L40f12c;
+t7 = MEM_U32(sp + 80);
+//nop;
+MEM_U32(a0 + 0) = t7;
+L40f12c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0xa8;
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_parse_number(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0,
+s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40f148:
+//parse_number:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10002cf0;
+// fdead 400201eb MEM_U32(sp + 28) = ra;
+s0 = MEM_U32(s0 + 0);
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+a3 = zero;
+t1 = 0xa;
+t0 = a0;
+v0 = zero;
+if ((int)a0 <= 0) goto L40f1c4;
+v1 = s0;
+a0 = 0x2e;
+L40f18c:
+t7 = MEM_U8(v1 + 0);
+v0 = v0 + 0x1;
+at = (int)v0 < (int)t0;
+if (a0 != t7) goto L40f1bc;
+a0 = 0x100021f0;
+//nop;
+a0 = a0;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40f398;
+L40f1bc:
+v1 = v1 + 0x1;
+if (at != 0) goto L40f18c;
+L40f1c4:
+t8 = MEM_U32(sp + 56);
+t2 = 0x100063a8;
+MEM_U32(t2 + 4) = zero;
+if ((int)t8 < (int)0x3) goto L40f268;
+a1 = 0x10002228;
+//nop;
+a0 = s0;
+a2 = 0x2;
+MEM_U32(sp + 48) = a3;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400200c9 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = 0x100063a8;
+a0 = s0;
+if (v0 == 0) goto L40f254;
+a1 = 0x1000222c;
+//nop;
+a2 = 0x2;
+MEM_U32(sp + 48) = a3;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400200c9 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = 0x100063a8;
+//nop;
+if (v0 != 0) goto L40f268;
+L40f254:
+t0 = MEM_U32(sp + 56);
+s0 = s0 + 0x2;
+t1 = 0x10;
+t0 = t0 + 0xfffffffe;
+goto L40f27c;
+L40f268:
+t9 = MEM_U8(s0 + 0);
+at = 0x30;
+//nop;
+if (t9 != at) goto L40f27c;
+t1 = 0x8;
+L40f27c:
+v1 = 0x10;
+if ((int)t0 <= 0) goto L40f354;
+L40f284:
+v0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+t0 = t0 + 0xffffffff;
+if ((int)v0 < (int)0x41) goto L40f2a8;
+if ((int)v0 >= (int)0x5b) {
+at = (int)v0 < (int)0x30;
+goto L40f2ac;}
+at = (int)v0 < (int)0x30;
+v0 = v0 + 0x20;
+L40f2a8:
+at = (int)v0 < (int)0x30;
+L40f2ac:
+if (at != 0) {
+at = (int)v0 < (int)0x3a;
+goto L40f2d0;}
+//nop;
+if ((int)v0 >= (int)0x3a) goto L40f2d0;
+lo = a3 * t1;
+hi = (uint32_t)((uint64_t)a3 * (uint64_t)t1 >> 32);
+a3 = lo;
+a3 = a3 + v0;
+a3 = a3 + 0xffffffd0;
+goto L40f34c;
+L40f2d0:
+at = (int)v0 < (int)0x61;
+if (t1 != v1) goto L40f2fc;
+if ((int)v0 < (int)0x61) {
+at = (int)v0 < (int)0x67;
+goto L40f2fc;}
+//nop;
+if ((int)v0 >= (int)0x67) goto L40f2fc;
+lo = a3 * t1;
+hi = (uint32_t)((uint64_t)a3 * (uint64_t)t1 >> 32);
+a3 = lo;
+a3 = a3 + v0;
+a3 = a3 + 0xffffffa9;
+goto L40f34c;
+L40f2fc:
+t1 = 0x1;
+a2 = 0x55;
+a1 = 0x75;
+a0 = 0x4c;
+v1 = 0x6c;
+L40f310:
+//nop;
+if (v0 == v1) goto L40f334;
+//nop;
+if (v0 == a0) goto L40f334;
+//nop;
+if (v0 == a1) goto L40f330;
+//nop;
+if (v0 != a2) goto L40f354;
+L40f330:
+MEM_U32(t2 + 4) = t1;
+L40f334:
+//nop;
+if (t0 == 0) goto L40f354;
+v0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+t0 = t0 + 0xffffffff;
+goto L40f310;
+L40f34c:
+//nop;
+if ((int)t0 > 0) goto L40f284;
+L40f354:
+t1 = 0x1;
+if (t0 == 0) goto L40f37c;
+a0 = 0x10002230;
+//nop;
+a0 = a0;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40f398;
+L40f37c:
+//nop;
+if ((int)a3 >= 0) goto L40f388;
+MEM_U32(t2 + 4) = t1;
+L40f388:
+at = 0x10002cf0;
+v0 = 0x101;
+MEM_U32(at + 0) = s0;
+MEM_U32(t2 + 0) = a3;
+L40f398:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint32_t f_yylex(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40f3a8:
+//yylex:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+a0 = 0x1000020c;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10002cf0;
+v1 = 0x1000020c;
+a0 = MEM_U32(a0 + 0);
+// fdead 400201fb MEM_U32(sp + 28) = ra;
+// fdead 400201fb MEM_U32(sp + 24) = gp;
+s0 = s0;
+v1 = v1;
+L40f3dc:
+t1 = MEM_U32(s0 + 0);
+//nop;
+t2 = MEM_U8(t1 + 0);
+a1 = t1;
+a3 = t2;
+if (a0 == 0) goto L40f44c;
+t6 = 0x1000020c;
+//nop;
+t6 = t6;
+v0 = MEM_U32(t6 + 0);
+//nop;
+L40f408:
+t7 = MEM_U8(v0 + 0);
+//nop;
+//nop;
+if (a3 != t7) goto L40f43c;
+t8 = MEM_U8(a1 + 1);
+t9 = MEM_U8(v0 + 1);
+//nop;
+t3 = t1 + 0x2;
+if (t8 != t9) goto L40f43c;
+MEM_U32(s0 + 0) = t3;
+v0 = MEM_U32(v1 + 4);
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40f748;
+L40f43c:
+v0 = MEM_U32(v1 + 8);
+v1 = v1 + 0x8;
+//nop;
+if (v0 != 0) goto L40f408;
+L40f44c:
+if ((int)a3 < (int)0x7d) {
+at = 0x7d;
+goto L40f470;}
+at = 0x7d;
+if (a3 == at) {
+at = 0x7e;
+goto L40f614;}
+at = 0x7e;
+t3 = t1 + 0x1;
+if (a3 == at) goto L40f618;
+at = (int)a3 < (int)0x30;
+goto L40f648;
+L40f470:
+if ((int)a3 < (int)0x7c) {
+at = 0x7c;
+goto L40f48c;}
+at = 0x7c;
+t3 = t1 + 0x1;
+if (a3 == at) goto L40f618;
+at = (int)a3 < (int)0x30;
+goto L40f648;
+L40f48c:
+if ((int)a3 < (int)0x5f) {
+at = 0x7b;
+goto L40f4a8;}
+at = 0x7b;
+t3 = t1 + 0x1;
+if (a3 == at) goto L40f618;
+at = (int)a3 < (int)0x30;
+goto L40f648;
+L40f4a8:
+if (a3 >= 0x5f) {
+at = (int)a3 < (int)0x30;
+goto L40f648;}
+at = (int)a3 < (int)0x30;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (a3) {
+case 0: goto L40f4d4;
+case 1: goto L40f644;
+case 2: goto L40f644;
+case 3: goto L40f644;
+case 4: goto L40f644;
+case 5: goto L40f644;
+case 6: goto L40f644;
+case 7: goto L40f644;
+case 8: goto L40f644;
+case 9: goto L40f4dc;
+case 10: goto L40f4dc;
+case 11: goto L40f644;
+case 12: goto L40f644;
+case 13: goto L40f644;
+case 14: goto L40f644;
+case 15: goto L40f644;
+case 16: goto L40f644;
+case 17: goto L40f644;
+case 18: goto L40f644;
+case 19: goto L40f644;
+case 20: goto L40f644;
+case 21: goto L40f644;
+case 22: goto L40f644;
+case 23: goto L40f644;
+case 24: goto L40f644;
+case 25: goto L40f644;
+case 26: goto L40f644;
+case 27: goto L40f644;
+case 28: goto L40f644;
+case 29: goto L40f644;
+case 30: goto L40f644;
+case 31: goto L40f644;
+case 32: goto L40f4dc;
+case 33: goto L40f614;
+case 34: goto L40f624;
+case 35: goto L40f644;
+case 36: goto L40f644;
+case 37: goto L40f614;
+case 38: goto L40f614;
+case 39: goto L40f548;
+case 40: goto L40f614;
+case 41: goto L40f614;
+case 42: goto L40f614;
+case 43: goto L40f614;
+case 44: goto L40f614;
+case 45: goto L40f614;
+case 46: goto L40f614;
+case 47: goto L40f614;
+case 48: goto L40f644;
+case 49: goto L40f644;
+case 50: goto L40f644;
+case 51: goto L40f644;
+case 52: goto L40f644;
+case 53: goto L40f644;
+case 54: goto L40f644;
+case 55: goto L40f644;
+case 56: goto L40f644;
+case 57: goto L40f644;
+case 58: goto L40f614;
+case 59: goto L40f644;
+case 60: goto L40f614;
+case 61: goto L40f614;
+case 62: goto L40f614;
+case 63: goto L40f614;
+case 64: goto L40f614;
+case 65: goto L40f644;
+case 66: goto L40f644;
+case 67: goto L40f644;
+case 68: goto L40f644;
+case 69: goto L40f644;
+case 70: goto L40f644;
+case 71: goto L40f644;
+case 72: goto L40f644;
+case 73: goto L40f644;
+case 74: goto L40f644;
+case 75: goto L40f644;
+case 76: goto L40f4f0;
+case 77: goto L40f644;
+case 78: goto L40f644;
+case 79: goto L40f644;
+case 80: goto L40f644;
+case 81: goto L40f644;
+case 82: goto L40f644;
+case 83: goto L40f644;
+case 84: goto L40f644;
+case 85: goto L40f644;
+case 86: goto L40f644;
+case 87: goto L40f644;
+case 88: goto L40f644;
+case 89: goto L40f644;
+case 90: goto L40f644;
+case 91: goto L40f614;
+case 92: goto L40f644;
+case 93: goto L40f614;
+case 94: goto L40f614;
+}
+L40f4d4:
+v0 = zero;
+goto L40f744;
+L40f4dc:
+v1 = 0x1000020c;
+t5 = t1 + 0x1;
+MEM_U32(s0 + 0) = t5;
+v1 = v1;
+goto L40f3dc;
+L40f4f0:
+t0 = 0x10006190;
+v1 = MEM_U8(t1 + 1);
+a2 = 0x1;
+v0 = t0 + v1;
+t6 = MEM_U8(v0 + 0);
+a0 = t1 + 0x1;
+//nop;
+if (t6 == 0) goto L40f52c;
+L40f510:
+v1 = MEM_U8(a0 + 1);
+a2 = a2 + 0x1;
+v0 = t0 + v1;
+t7 = MEM_U8(v0 + 0);
+a0 = a0 + 0x1;
+//nop;
+if (t7 != 0) goto L40f510;
+L40f52c:
+t8 = 0x10006190;
+t9 = t1 + a2;
+t8 = t8 + 0x27;
+at = (int)a3 < (int)0x30;
+if (v0 != t8) goto L40f648;
+MEM_U32(s0 + 0) = t9;
+t1 = t9;
+L40f548:
+t3 = t1 + 0x1;
+MEM_U32(s0 + 0) = t3;
+a3 = MEM_U8(t3 + 0);
+t4 = t3 + 0x1;
+at = 0x5c;
+MEM_U32(s0 + 0) = t4;
+if (a3 != at) goto L40f57c;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_parse_escape(mem, sp, a0, a1, a2, a3);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = v0;
+L40f57c:
+a0 = 0x10002274;
+//nop;
+a1 = 0x11;
+a2 = 0xffffffff;
+MEM_U32(sp + 36) = a3;
+a0 = a0;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a3 = MEM_U32(sp + 36);
+// bdead 400201cb gp = MEM_U32(sp + 24);
+t5 = (int)a3 >> 7;
+if (v0 != 0) goto L40f5b4;
+t6 = t5 & 0x1;
+at = 0xffffff00;
+if (t6 != 0) goto L40f5c4;
+L40f5b4:
+v0 = 0x100063a8;
+t7 = a3 & 0xff;
+MEM_U32(v0 + 0) = t7;
+goto L40f5d0;
+L40f5c4:
+v0 = 0x100063a8;
+t8 = a3 | at;
+MEM_U32(v0 + 0) = t8;
+L40f5d0:
+t1 = MEM_U32(s0 + 0);
+MEM_U32(v0 + 4) = zero;
+a3 = MEM_U8(t1 + 0);
+at = 0x27;
+t9 = t1 + 0x1;
+MEM_U32(s0 + 0) = t9;
+if (a3 == at) goto L40f60c;
+a0 = 0x10002288;
+//nop;
+a0 = a0;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40f744;
+L40f60c:
+v0 = 0x102;
+goto L40f744;
+L40f614:
+t3 = t1 + 0x1;
+L40f618:
+MEM_U32(s0 + 0) = t3;
+v0 = a3;
+goto L40f744;
+L40f624:
+a0 = 0x100022ac;
+//nop;
+a0 = a0;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40f744;
+L40f644:
+at = (int)a3 < (int)0x30;
+L40f648:
+if (at != 0) {
+at = (int)a3 < (int)0x3a;
+goto L40f6c4;}
+//nop;
+if ((int)a3 >= (int)0x3a) goto L40f6c4;
+v1 = 0x10005f90;
+a0 = zero;
+v0 = v1 + a3;
+t4 = MEM_U8(v0 + 0);
+t5 = v1 + 0x2e;
+//nop;
+if (t4 != 0) goto L40f67c;
+//nop;
+if (v0 != t5) goto L40f6a8;
+L40f67c:
+a0 = a0 + 0x1;
+t6 = a1 + a0;
+a3 = MEM_U8(t6 + 0);
+a2 = 0x10005f90;
+v0 = v1 + a3;
+t7 = MEM_U8(v0 + 0);
+a2 = a2 + 0x2e;
+//nop;
+if (t7 != 0) goto L40f67c;
+//nop;
+if (v0 == a2) goto L40f67c;
+L40f6a8:
+//nop;
+//nop;
+//nop;
+v0 = f_parse_number(mem, sp, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40f748;
+L40f6c4:
+t8 = 0x10006090;
+//nop;
+t9 = a3 + t8;
+t3 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t3 != 0) goto L40f700;
+a0 = 0x100022e4;
+//nop;
+a0 = a0;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40f744;
+L40f700:
+v1 = 0x10005f90;
+a0 = zero;
+t4 = v1 + t2;
+t5 = MEM_U8(t4 + 0);
+v0 = a1;
+t9 = t1 + a0;
+if (t5 == 0) goto L40f73c;
+L40f71c:
+t6 = MEM_U8(v0 + 1);
+a0 = a0 + 0x1;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+v0 = v0 + 0x1;
+//nop;
+if (t8 != 0) goto L40f71c;
+t9 = t1 + a0;
+L40f73c:
+MEM_U32(s0 + 0) = t9;
+v0 = 0x103;
+L40f744:
+// bdead 9 ra = MEM_U32(sp + 28);
+L40f748:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_parse_escape(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40f754:
+//parse_escape:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = MEM_U32(a0 + 0);
+a2 = a0;
+v1 = MEM_U8(v0 + 0);
+t6 = v0 + 0x1;
+MEM_U32(a0 + 0) = t6;
+if ((int)v1 < (int)0xb) goto L40f7f0;
+t8 = v1 + 0xffffffd0;
+if ((int)v1 < (int)0x38) goto L40f7c4;
+t7 = v1 + 0xffffffa2;
+v0 = v1;
+if (t7 >= 0x1b) goto L40fa04;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40f864;
+case 1: goto L40fa00;
+case 2: goto L40fa00;
+case 3: goto L40f808;
+case 4: goto L40f810;
+case 5: goto L40fa00;
+case 6: goto L40fa00;
+case 7: goto L40f818;
+case 8: goto L40f820;
+case 9: goto L40fa00;
+case 10: goto L40fa00;
+case 11: goto L40fa00;
+case 12: goto L40fa00;
+case 13: goto L40fa00;
+case 14: goto L40fa00;
+case 15: goto L40fa00;
+case 16: goto L40f828;
+case 17: goto L40fa00;
+case 18: goto L40fa00;
+case 19: goto L40fa00;
+case 20: goto L40f830;
+case 21: goto L40fa00;
+case 22: goto L40f838;
+case 23: goto L40fa00;
+case 24: goto L40f840;
+case 25: goto L40fa00;
+case 26: goto L40f948;
+}
+L40f7c4:
+v0 = v1;
+if (t8 >= 0x8) goto L40fa04;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L40f8b4;
+case 1: goto L40f8b4;
+case 2: goto L40f8b4;
+case 3: goto L40f8b4;
+case 4: goto L40f8b4;
+case 5: goto L40f8b4;
+case 6: goto L40f8b4;
+case 7: goto L40f8b4;
+}
+L40f7f0:
+at = 0xa;
+if (v1 == 0) goto L40f850;
+//nop;
+if (v1 == at) goto L40f848;
+v0 = v1;
+goto L40fa04;
+L40f808:
+v0 = 0x7;
+goto L40fa04;
+L40f810:
+v0 = 0x8;
+goto L40fa04;
+L40f818:
+v0 = 0x1b;
+goto L40fa04;
+L40f820:
+v0 = 0xc;
+goto L40fa04;
+L40f828:
+v0 = 0xa;
+goto L40fa04;
+L40f830:
+v0 = 0xd;
+goto L40fa04;
+L40f838:
+v0 = 0x9;
+goto L40fa04;
+L40f840:
+v0 = 0xb;
+goto L40fa04;
+L40f848:
+v0 = 0xfffffffe;
+goto L40fa04;
+L40f850:
+t9 = MEM_U32(a2 + 0);
+v0 = zero;
+t0 = t9 + 0xffffffff;
+MEM_U32(a2 + 0) = t0;
+goto L40fa04;
+L40f864:
+v0 = MEM_U32(a2 + 0);
+at = 0x5c;
+v1 = MEM_U8(v0 + 0);
+t1 = v0 + 0x1;
+MEM_U32(a2 + 0) = t1;
+if (v1 != at) goto L40f894;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_parse_escape(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = v0;
+L40f894:
+at = 0x3f;
+t2 = v1 & 0x80;
+if (v1 != at) goto L40f8a8;
+v0 = 0x7f;
+goto L40fa04;
+L40f8a8:
+t3 = v1 & 0x1f;
+v0 = t2 | t3;
+goto L40fa04;
+L40f8b4:
+a1 = v1 + 0xffffffd0;
+a0 = 0x1;
+a3 = 0x3;
+L40f8c0:
+v0 = MEM_U32(a2 + 0);
+t5 = a1 << 3;
+v1 = MEM_U8(v0 + 0);
+t4 = v0 + 0x1;
+MEM_U32(a2 + 0) = t4;
+if ((int)v1 < (int)0x30) goto L40f8f4;
+a0 = a0 + 0x1;
+if ((int)v1 >= (int)0x38) goto L40f8f4;
+a1 = t5 + v1;
+a1 = a1 + 0xffffffd0;
+goto L40f908;
+L40f8f4:
+t6 = MEM_U32(a2 + 0);
+//nop;
+t7 = t6 + 0xffffffff;
+MEM_U32(a2 + 0) = t7;
+goto L40f910;
+L40f908:
+//nop;
+if (a0 != a3) goto L40f8c0;
+L40f910:
+t8 = a1 >> 8;
+//nop;
+if (t8 == 0) goto L40f940;
+t9 = a1 & 0xff;
+MEM_U32(sp + 40) = t9;
+//nop;
+a0 = 0x10002300;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+//nop;
+L40f940:
+v0 = a1;
+goto L40fa04;
+L40f948:
+a1 = zero;
+L40f94c:
+v0 = MEM_U32(a2 + 0);
+t3 = a1 << 4;
+v1 = MEM_U8(v0 + 0);
+t0 = v0 + 0x1;
+MEM_U32(a2 + 0) = t0;
+if ((int)v1 < (int)0x30) goto L40f980;
+t1 = a1 << 4;
+if ((int)v1 >= (int)0x3a) goto L40f980;
+a1 = t1 + v1;
+a1 = a1 + 0xffffffd0;
+goto L40f94c;
+L40f980:
+if ((int)v1 < (int)0x61) {
+at = (int)v1 < (int)0x67;
+goto L40f9a0;}
+t2 = a1 << 4;
+if ((int)v1 >= (int)0x67) goto L40f9a0;
+a1 = t2 + v1;
+a1 = a1 + 0xffffffa9;
+goto L40f94c;
+L40f9a0:
+if ((int)v1 < (int)0x41) {
+at = (int)v1 < (int)0x47;
+goto L40f9c0;}
+//nop;
+if ((int)v1 >= (int)0x47) goto L40f9c0;
+a1 = t3 + v1;
+a1 = a1 + 0xffffffc9;
+goto L40f94c;
+L40f9c0:
+t4 = MEM_U32(a2 + 0);
+t6 = a1 >> 8;
+t5 = t4 + 0xffffffff;
+MEM_U32(a2 + 0) = t5;
+if (t6 == 0) goto L40f9f8;
+a0 = 0x10002330;
+//nop;
+t7 = a1 & 0xff;
+MEM_U32(sp + 32) = t7;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+L40f9f8:
+v0 = a1;
+goto L40fa04;
+L40fa00:
+v0 = v1;
+L40fa04:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void f_yyerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0;
+uint64_t temp64;
+L40fa14:
+//yyerror:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = 0x1;
+a0 = 0x10002c80;
+//nop;
+a0 = a0;
+//nop;
+wrapper_longjmp(mem, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_parse_c_expression(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0;
+uint64_t temp64;
+L40fa60:
+//parse_c_expression:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffe0;
+v1 = v1;
+// fdead 40000033 MEM_U32(sp + 28) = ra;
+// fdead 40000033 MEM_U32(sp + 24) = gp;
+MEM_U32(v1 + 0) = a0;
+if (a0 == 0) goto L40fa98;
+t6 = MEM_U8(a0 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40fab8;
+L40fa98:
+a0 = 0x10002360;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40fb50;
+L40fab8:
+a0 = 0x10002c80;
+//nop;
+a0 = a0;
+//nop;
+v0 = wrapper_setjmp(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40fae0;
+v0 = zero;
+goto L40fb50;
+L40fae0:
+//nop;
+//nop;
+//nop;
+v0 = f_yyparse(mem, sp);
+// bdead 400001cb gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40fb04;
+v0 = zero;
+goto L40fb50;
+L40fb04:
+t7 = 0x10002cf0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40fb40;
+a0 = 0x10002378;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40fb40:
+v0 = 0x100063a4;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+L40fb50:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_yyparse(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0, lo = 0, hi = 0;
+uint64_t temp64;
+L40fb60:
+//yyparse:
+//nop;
+//nop;
+//nop;
+a1 = 0x10000204;
+a2 = 0x10006ad4;
+t6 = MEM_U32(a1 + 0);
+a0 = 0x10000200;
+t7 = t6 + 0xfffffff8;
+sp = sp + 0xffffff90;
+MEM_U32(a2 + 0) = t7;
+a0 = MEM_U32(a0 + 0);
+v0 = 0x10006ad8;
+a3 = 0x10006adc;
+at = 0x10006ae0;
+t8 = a0 + 0xfffffffc;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(a3 + 0) = zero;
+MEM_U32(at + 0) = zero;
+at = 0x10006ae4;
+// fdead 420181ef MEM_U32(sp + 40) = s5;
+MEM_U32(at + 0) = zero;
+at = 0x10006ae8;
+s5 = 0x10006aec;
+// fdead 424181ef MEM_U32(sp + 56) = fp;
+// fdead 424181ef MEM_U32(sp + 36) = s4;
+s4 = 0xffffffff;
+MEM_U32(at + 0) = zero;
+fp = MEM_U32(sp + 108);
+// fdead c26181ef MEM_U32(sp + 60) = ra;
+// fdead c26181ef MEM_U32(sp + 52) = gp;
+// fdead c26181ef MEM_U32(sp + 48) = s7;
+// fdead c26181ef MEM_U32(sp + 44) = s6;
+// fdead c26181ef MEM_U32(sp + 32) = s3;
+// fdead c26181ef MEM_U32(sp + 28) = s2;
+// fdead c26181ef MEM_U32(sp + 24) = s1;
+// fdead c26181ef MEM_U32(sp + 20) = s0;
+MEM_U32(s5 + 0) = s4;
+s6 = MEM_U32(a2 + 0);
+L40fbf8:
+s3 = MEM_U32(v0 + 0);
+s1 = MEM_U32(a3 + 0);
+//nop;
+L40fc04:
+v1 = 0x10000208;
+s3 = s3 + 0x4;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t9 = v1 << 2;
+t0 = a0 + t9;
+s0 = v1 << 1;
+if (s3 < t0) goto L40fe20;
+v0 = MEM_U32(a1 + 0);
+t5 = MEM_U32(a2 + 0);
+t1 = fp - v0;
+t3 = s6 - v0;
+t6 = t5 - v0;
+t2 = (int)t1 >> 3;
+t4 = (int)t3 >> 3;
+t7 = (int)t6 >> 3;
+at = 0x96;
+MEM_U32(sp + 80) = t2;
+MEM_U32(sp + 76) = t4;
+MEM_U32(sp + 72) = t7;
+MEM_U32(sp + 68) = a0;
+if (v1 != at) goto L40fcf0;
+//nop;
+s2 = s0 << 2;
+a0 = s2;
+v0 = wrapper_malloc(mem, a0);
+// bdead 407e000b gp = MEM_U32(sp + 52);
+s7 = s0 << 3;
+//nop;
+s6 = v0;
+a0 = s7;
+v0 = wrapper_malloc(mem, a0);
+// bdead 41fe018b gp = MEM_U32(sp + 52);
+fp = v0;
+if (s6 == 0) goto L40fce8;
+a0 = s6;
+if (v0 == 0) goto L40fce8;
+a1 = 0x10000200;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a2 = s2;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead c176000b gp = MEM_U32(sp + 52);
+a0 = fp;
+a1 = 0x10000204;
+at = 0x10000200;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a2 = s7;
+MEM_U32(at + 0) = v0;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 4076018b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10000204;
+MEM_U32(at + 0) = v0;
+goto L40fd5c;
+L40fce8:
+s0 = zero;
+goto L40fd5c;
+L40fcf0:
+//nop;
+a1 = s0 << 2;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 4076000b gp = MEM_U32(sp + 52);
+a1 = s0 << 3;
+a0 = 0x10000204;
+at = 0x10000200;
+//nop;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(at + 0) = v0;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 4076018b gp = MEM_U32(sp + 52);
+//nop;
+t8 = 0x10000200;
+at = 0x10000204;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(at + 0) = v0;
+//nop;
+if (t8 == 0) goto L40fd58;
+t9 = 0x10000204;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L40fd5c;
+L40fd58:
+s0 = zero;
+L40fd5c:
+t0 = 0x10000208;
+//nop;
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if ((int)t0 < (int)s0) goto L40fdb4;
+a0 = 0x10002398;
+a1 = 0x100023a4;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_gettxt(mem, a0, a1);
+// bdead 400001c9 gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 52);
+v0 = 0x1;
+goto L410b54;
+L40fdb4:
+t1 = 0x10000200;
+t2 = MEM_U32(sp + 68);
+t1 = MEM_U32(t1 + 0);
+at = 0x10000208;
+t4 = 0x10006ad8;
+a0 = t1 - t2;
+v0 = 0x10000204;
+t4 = MEM_U32(t4 + 0);
+t3 = (int)a0 >> 2;
+MEM_U32(at + 0) = s0;
+at = 0x10006ad8;
+v1 = t3 << 2;
+t0 = MEM_U32(sp + 72);
+v0 = MEM_U32(v0 + 0);
+t5 = v1 + t4;
+t6 = MEM_U32(sp + 80);
+t8 = MEM_U32(sp + 76);
+MEM_U32(at + 0) = t5;
+at = 0x10006ad4;
+t1 = t0 << 3;
+t2 = t1 + v0;
+t7 = t6 << 3;
+t9 = t8 << 3;
+s3 = v1 + s3;
+fp = t7 + v0;
+s6 = t9 + v0;
+MEM_U32(at + 0) = t2;
+L40fe20:
+t3 = 0x100063b0;
+MEM_U32(s3 + 0) = s1;
+at = MEM_U32(t3 + 0);
+t6 = 0x100007bc;
+MEM_U32(s6 + 8) = at;
+t5 = MEM_U32(t3 + 4);
+s2 = s1 << 2;
+s7 = s2 + t6;
+MEM_U32(s6 + 12) = t5;
+v0 = MEM_U32(s7 + 0);
+s6 = s6 + 0x8;
+L40fe4c:
+at = 0xff670000;
+at = at | 0x6981;
+s0 = v0;
+if ((int)v0 >= (int)at) goto L40fe78;
+t7 = 0x10000a8c;
+//nop;
+t8 = s2 + t7;
+v0 = MEM_U32(t8 + 0);
+at = 0xfffffffe;
+goto L40ff78;
+L40fe78:
+a0 = MEM_U32(s5 + 0);
+//nop;
+//nop;
+if ((int)a0 >= 0) goto L40feb0;
+//nop;
+//nop;
+//nop;
+v0 = f_yylex(mem, sp, a0, a1, a2);
+// bdead c1fe018b gp = MEM_U32(sp + 52);
+MEM_U32(s5 + 0) = v0;
+a0 = v0;
+if ((int)v0 >= 0) goto L40feb0;
+MEM_U32(s5 + 0) = zero;
+a0 = zero;
+L40feb0:
+s0 = s0 + a0;
+at = (int)s0 < (int)0x154;
+if ((int)s0 < 0) goto L40fec4;
+//nop;
+if ((int)s0 < (int)0x154) goto L40fedc;
+L40fec4:
+t9 = 0x10000a8c;
+//nop;
+t0 = s2 + t9;
+v0 = MEM_U32(t0 + 0);
+at = 0xfffffffe;
+goto L40ff78;
+L40fedc:
+t2 = 0x1000026c;
+t1 = s0 << 2;
+t4 = t1 + t2;
+s0 = MEM_U32(t4 + 0);
+t5 = 0x100009a4;
+t3 = s0 << 2;
+t6 = t3 + t5;
+t7 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (a0 != t7) goto L40ff60;
+t9 = 0x100063a8;
+MEM_U32(s5 + 0) = s4;
+t8 = 0x100063b0;
+t1 = MEM_U32(t9 + 4);
+at = MEM_U32(t9 + 0);
+v0 = 0x10006ae8;
+MEM_U32(t8 + 4) = t1;
+MEM_U32(t8 + 0) = at;
+v0 = MEM_U32(v0 + 0);
+s1 = s0;
+//nop;
+if ((int)v0 <= 0) goto L40ff44;
+at = 0x10006ae8;
+t2 = v0 + 0xffffffff;
+MEM_U32(at + 0) = t2;
+L40ff44:
+a0 = 0x10000200;
+a3 = 0x10006adc;
+a2 = 0x10006ad4;
+a1 = 0x10000204;
+a0 = MEM_U32(a0 + 0);
+//nop;
+goto L40fc04;
+L40ff60:
+t4 = 0x10000a8c;
+//nop;
+t3 = s2 + t4;
+v0 = MEM_U32(t3 + 0);
+//nop;
+at = 0xfffffffe;
+L40ff78:
+s0 = v0;
+if (v0 != at) goto L410048;
+t5 = MEM_U32(s5 + 0);
+//nop;
+//nop;
+if ((int)t5 >= 0) goto L40ffb0;
+//nop;
+//nop;
+//nop;
+v0 = f_yylex(mem, sp, a0, a1, a2);
+// bdead c1fc018b gp = MEM_U32(sp + 52);
+MEM_U32(s5 + 0) = v0;
+if ((int)v0 >= 0) goto L40ffb0;
+MEM_U32(s5 + 0) = zero;
+L40ffb0:
+v1 = 0x10000254;
+//nop;
+t7 = MEM_U32(v1 + 0);
+v0 = v1;
+//nop;
+if (s4 != t7) goto L40ffd8;
+t0 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if (s1 == t0) goto L40fff8;
+L40ffd8:
+t8 = MEM_U32(v0 + 8);
+v0 = v0 + 0x8;
+//nop;
+if (s4 != t8) goto L40ffd8;
+t9 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (s1 != t9) goto L40ffd8;
+L40fff8:
+v1 = MEM_U32(v0 + 8);
+v0 = v0 + 0x8;
+//nop;
+if ((int)v1 < 0) goto L410030;
+a0 = MEM_U32(s5 + 0);
+//nop;
+//nop;
+if (a0 == v1) goto L410030;
+L410018:
+v1 = MEM_U32(v0 + 8);
+v0 = v0 + 0x8;
+//nop;
+if ((int)v1 < 0) goto L410030;
+//nop;
+if (a0 != v1) goto L410018;
+L410030:
+s0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if ((int)s0 >= 0) goto L410048;
+v0 = zero;
+goto L410b54;
+L410048:
+at = 0x1;
+if (s0 != 0) goto L410190;
+v0 = 0x10006ae8;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L410088;
+if (v0 == at) {
+at = 0x2;
+goto L4100c0;}
+at = 0x2;
+if (v0 == at) {
+at = 0x3;
+goto L4100c0;}
+at = 0x3;
+//nop;
+if (v0 == at) goto L41016c;
+//nop;
+goto L410190;
+L410088:
+a0 = 0x100023b8;
+a1 = 0x100023c4;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_gettxt(mem, a0, a1);
+// bdead c0f001cb gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead c0f00003 gp = MEM_U32(sp + 52);
+//nop;
+L4100c0:
+a0 = 0x10000200;
+at = 0x10006ae8;
+a0 = MEM_U32(a0 + 0);
+t1 = 0x3;
+MEM_U32(at + 0) = t1;
+//nop;
+if (s3 < a0) goto L410164;
+v1 = 0x100007bc;
+a1 = 0x100;
+L4100e8:
+t2 = MEM_U32(s3 + 0);
+//nop;
+t4 = t2 << 2;
+t3 = v1 + t4;
+s0 = MEM_U32(t3 + 0);
+//nop;
+s0 = s0 + 0x100;
+at = (int)s0 < (int)0x154;
+if ((int)s0 < 0) goto L410154;
+//nop;
+if ((int)s0 >= (int)0x154) goto L410154;
+t6 = 0x1000026c;
+t5 = s0 << 2;
+t7 = t5 + t6;
+v0 = MEM_U32(t7 + 0);
+t8 = 0x100009a4;
+t0 = v0 << 2;
+t9 = t0 + t8;
+t1 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (a1 != t1) goto L410154;
+a3 = 0x10006adc;
+a2 = 0x10006ad4;
+a1 = 0x10000204;
+s1 = v0;
+goto L40fc04;
+L410154:
+s3 = s3 + 0xfffffffc;
+s6 = s6 + 0xfffffff8;
+if (s3 >= a0) goto L4100e8;
+L410164:
+v0 = 0x1;
+goto L410b54;
+L41016c:
+t2 = MEM_U32(s5 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L410184;
+v0 = 0x1;
+goto L410b54;
+L410184:
+v0 = MEM_U32(s7 + 0);
+MEM_U32(s5 + 0) = s4;
+goto L40fe4c;
+L410190:
+at = 0x10006ae0;
+t4 = 0x1000092c;
+a0 = s0 << 2;
+MEM_U32(at + 0) = s0;
+t3 = a0 + t4;
+v1 = MEM_U32(t3 + 0);
+fp = s6;
+t5 = v1 & 0x1;
+t0 = (int)v1 >> 1;
+if (t5 != 0) goto L410274;
+t6 = (int)v1 >> 1;
+t7 = t6 << 3;
+s6 = s6 - t7;
+at = MEM_U32(s6 + 8);
+t0 = 0x100063b0;
+t2 = 0x100008b4;
+MEM_U32(t0 + 0) = at;
+t1 = MEM_U32(s6 + 12);
+t4 = a0 + t2;
+MEM_U32(t0 + 4) = t1;
+v0 = MEM_U32(t4 + 0);
+t3 = t6 << 2;
+t6 = 0x100008a4;
+t5 = v0 << 2;
+s3 = s3 - t3;
+t7 = t5 + t6;
+a1 = MEM_U32(t7 + 0);
+t9 = MEM_U32(s3 + 0);
+//nop;
+s1 = t9 + a1;
+s1 = s1 + 0x1;
+//nop;
+if ((int)s1 >= (int)0x154) goto L410244;
+t0 = 0x1000026c;
+t8 = s1 << 2;
+t1 = t8 + t0;
+s1 = MEM_U32(t1 + 0);
+t3 = 0x100009a4;
+t4 = s1 << 2;
+t5 = t4 + t3;
+t6 = MEM_U32(t5 + 0);
+t2 = -v0;
+//nop;
+if (t2 == t6) goto L410258;
+L410244:
+t9 = 0x1000026c;
+t7 = a1 << 2;
+t8 = t7 + t9;
+s1 = MEM_U32(t8 + 0);
+//nop;
+L410258:
+a0 = 0x10000200;
+a3 = 0x10006adc;
+a2 = 0x10006ad4;
+a1 = 0x10000204;
+a0 = MEM_U32(a0 + 0);
+//nop;
+goto L40fc04;
+L410274:
+t1 = t0 << 3;
+s6 = s6 - t1;
+at = MEM_U32(s6 + 8);
+t4 = 0x100063b0;
+t2 = 0x100008b4;
+MEM_U32(t4 + 0) = at;
+t5 = MEM_U32(s6 + 12);
+t6 = a0 + t2;
+MEM_U32(t4 + 4) = t5;
+v0 = MEM_U32(t6 + 0);
+t8 = 0x100008a4;
+t7 = t0 << 2;
+// bdead c2f1018b v1 = t0;
+t9 = v0 << 2;
+s3 = s3 - t7;
+t0 = t9 + t8;
+a1 = MEM_U32(t0 + 0);
+t1 = MEM_U32(s3 + 0);
+//nop;
+s1 = t1 + a1;
+s1 = s1 + 0x1;
+//nop;
+if ((int)s1 >= (int)0x154) goto L410300;
+t4 = 0x1000026c;
+t3 = s1 << 2;
+t5 = t3 + t4;
+s1 = MEM_U32(t5 + 0);
+t7 = 0x100009a4;
+t6 = s1 << 2;
+t9 = t6 + t7;
+t8 = MEM_U32(t9 + 0);
+t2 = -v0;
+//nop;
+if (t2 == t8) goto L410314;
+L410300:
+t1 = 0x1000026c;
+t0 = a1 << 2;
+t3 = t0 + t1;
+s1 = MEM_U32(t3 + 0);
+//nop;
+L410314:
+at = 0x10006adc;
+t4 = 0x10006ae0;
+MEM_U32(at + 0) = s1;
+at = 0x10006ad8;
+t4 = MEM_U32(t4 + 0);
+MEM_U32(at + 0) = s3;
+at = 0x10006ad4;
+t5 = t4 + 0xffffffff;
+MEM_U32(at + 0) = s6;
+//nop;
+if (t5 >= 0x1d) goto L410b34;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L410364;
+case 1: goto L410b34;
+case 2: goto L410374;
+case 3: goto L410390;
+case 4: goto L4103b0;
+case 5: goto L4103cc;
+case 6: goto L4103ec;
+case 7: goto L410408;
+case 8: goto L410488;
+case 9: goto L41056c;
+case 10: goto L410650;
+case 11: goto L410694;
+case 12: goto L4106d8;
+case 13: goto L410728;
+case 14: goto L410778;
+case 15: goto L41079c;
+case 16: goto L4107c0;
+case 17: goto L410824;
+case 18: goto L410888;
+case 19: goto L4108e4;
+case 20: goto L410940;
+case 21: goto L410984;
+case 22: goto L4109c8;
+case 23: goto L410a0c;
+case 24: goto L410a48;
+case 25: goto L410a84;
+case 26: goto L410ae4;
+case 27: goto L410b00;
+case 28: goto L410b1c;
+}
+L410364:
+t6 = MEM_U32(fp + 0);
+at = 0x100063a4;
+MEM_U32(at + 0) = t6;
+goto L410b34;
+L410374:
+t7 = 0x100063b0;
+at = MEM_U32(fp + 0);
+//nop;
+MEM_U32(t7 + 0) = at;
+t8 = MEM_U32(fp + 4);
+MEM_U32(t7 + 4) = t8;
+goto L410b34;
+L410390:
+t0 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t1 = -t0;
+MEM_U32(at + 0) = t1;
+t3 = MEM_U32(fp + 4);
+at = 0x100063b0;
+MEM_U32(at + 4) = t3;
+goto L410b34;
+L4103b0:
+v0 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t4 = v0 < 0x1;
+MEM_U32(at + 0) = t4;
+at = 0x100063b0;
+MEM_U32(at + 4) = zero;
+goto L410b34;
+L4103cc:
+t5 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t6 = ~t5;
+MEM_U32(at + 0) = t6;
+t2 = MEM_U32(fp + 4);
+at = 0x100063b0;
+MEM_U32(at + 4) = t2;
+goto L410b34;
+L4103ec:
+t9 = 0x100063b0;
+at = MEM_U32(fp + -8);
+//nop;
+MEM_U32(t9 + 0) = at;
+t0 = MEM_U32(fp + -4);
+MEM_U32(t9 + 4) = t0;
+goto L410b34;
+L410408:
+v0 = MEM_U32(fp + -12);
+//nop;
+t1 = zero < v0;
+v0 = t1;
+if (t1 != 0) goto L41042c;
+v0 = MEM_U32(fp + 4);
+//nop;
+t3 = zero < v0;
+v0 = t3;
+L41042c:
+at = 0x100063b0;
+t4 = 0x100063b0;
+MEM_U32(at + 4) = v0;
+t4 = MEM_U32(t4 + 4);
+//nop;
+//nop;
+if (t4 == 0) goto L410468;
+t5 = MEM_U32(fp + 0);
+t6 = MEM_U32(fp + -16);
+at = 0x100063b0;
+lo = t5 * t6;
+hi = (uint32_t)((uint64_t)t5 * (uint64_t)t6 >> 32);
+t2 = lo;
+MEM_U32(at + 0) = t2;
+//nop;
+goto L410b34;
+L410468:
+t8 = MEM_U32(fp + 0);
+t7 = MEM_U32(fp + -16);
+at = 0x100063b0;
+lo = t8 * t7;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t7 >> 32);
+t9 = lo;
+MEM_U32(at + 0) = t9;
+//nop;
+goto L410b34;
+L410488:
+t0 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t0 != 0) goto L4104b8;
+a0 = 0x100023d4;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0600003 gp = MEM_U32(sp + 52);
+t1 = 0x1;
+MEM_U32(fp + 0) = t1;
+L4104b8:
+v0 = MEM_U32(fp + -12);
+//nop;
+t3 = zero < v0;
+v0 = t3;
+if (t3 != 0) goto L4104dc;
+v0 = MEM_U32(fp + 4);
+//nop;
+t4 = zero < v0;
+v0 = t4;
+L4104dc:
+at = 0x100063b0;
+t5 = 0x100063b0;
+MEM_U32(at + 4) = v0;
+t5 = MEM_U32(t5 + 4);
+//nop;
+//nop;
+if (t5 == 0) goto L410524;
+t6 = MEM_U32(fp + -16);
+t2 = MEM_U32(fp + 0);
+at = 0x100063b0;
+lo = t6 / t2; hi = t6 % t2;
+//nop;
+if (t2 != 0) goto L410514;
+abort();
+L410514:
+t8 = lo;
+MEM_U32(at + 0) = t8;
+//nop;
+goto L410b34;
+L410524:
+t7 = MEM_U32(fp + -16);
+t9 = MEM_U32(fp + 0);
+//nop;
+lo = (int)t7 / (int)t9; hi = (int)t7 % (int)t9;
+//nop;
+if (t9 != 0) goto L410540;
+abort();
+L410540:
+at = 0xffffffff;
+if (t9 != at) {
+at = 0x80000000;
+goto L410558;}
+at = 0x80000000;
+//nop;
+if (t7 != at) goto L410558;
+abort();
+L410558:
+at = 0x100063b0;
+t0 = lo;
+MEM_U32(at + 0) = t0;
+//nop;
+goto L410b34;
+L41056c:
+t1 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L41059c;
+a0 = 0x100023ec;
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0600003 gp = MEM_U32(sp + 52);
+t3 = 0x1;
+MEM_U32(fp + 0) = t3;
+L41059c:
+v0 = MEM_U32(fp + -12);
+//nop;
+t4 = zero < v0;
+v0 = t4;
+if (t4 != 0) goto L4105c0;
+v0 = MEM_U32(fp + 4);
+//nop;
+t5 = zero < v0;
+v0 = t5;
+L4105c0:
+at = 0x100063b0;
+t6 = 0x100063b0;
+MEM_U32(at + 4) = v0;
+t6 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t6 == 0) goto L410608;
+t2 = MEM_U32(fp + -16);
+t8 = MEM_U32(fp + 0);
+at = 0x100063b0;
+lo = t2 / t8; hi = t2 % t8;
+//nop;
+if (t8 != 0) goto L4105f8;
+abort();
+L4105f8:
+t7 = hi;
+MEM_U32(at + 0) = t7;
+//nop;
+goto L410b34;
+L410608:
+t9 = MEM_U32(fp + -16);
+t0 = MEM_U32(fp + 0);
+//nop;
+lo = (int)t9 / (int)t0; hi = (int)t9 % (int)t0;
+//nop;
+if (t0 != 0) goto L410624;
+abort();
+L410624:
+at = 0xffffffff;
+if (t0 != at) {
+at = 0x80000000;
+goto L41063c;}
+at = 0x80000000;
+//nop;
+if (t9 != at) goto L41063c;
+abort();
+L41063c:
+at = 0x100063b0;
+t1 = hi;
+MEM_U32(at + 0) = t1;
+//nop;
+goto L410b34;
+L410650:
+t3 = MEM_U32(fp + 0);
+t4 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t5 = t3 + t4;
+MEM_U32(at + 0) = t5;
+v0 = MEM_U32(fp + -12);
+//nop;
+t6 = zero < v0;
+v0 = t6;
+if (t6 != 0) goto L410688;
+v0 = MEM_U32(fp + 4);
+//nop;
+t2 = zero < v0;
+v0 = t2;
+L410688:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L410694:
+t8 = MEM_U32(fp + -16);
+t7 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t9 = t8 - t7;
+MEM_U32(at + 0) = t9;
+v0 = MEM_U32(fp + -12);
+//nop;
+t0 = zero < v0;
+v0 = t0;
+if (t0 != 0) goto L4106cc;
+v0 = MEM_U32(fp + 4);
+//nop;
+t1 = zero < v0;
+v0 = t1;
+L4106cc:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L4106d8:
+t3 = MEM_U32(fp + -12);
+at = 0x100063b0;
+t4 = 0x100063b0;
+MEM_U32(at + 4) = t3;
+t4 = MEM_U32(t4 + 4);
+//nop;
+//nop;
+if (t4 == 0) goto L410710;
+t5 = MEM_U32(fp + -16);
+t6 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t2 = t5 << (t6 & 0x1f);
+MEM_U32(at + 0) = t2;
+goto L410b34;
+L410710:
+t8 = MEM_U32(fp + -16);
+t7 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t9 = t8 << (t7 & 0x1f);
+MEM_U32(at + 0) = t9;
+goto L410b34;
+L410728:
+t0 = MEM_U32(fp + -12);
+at = 0x100063b0;
+t1 = 0x100063b0;
+MEM_U32(at + 4) = t0;
+t1 = MEM_U32(t1 + 4);
+//nop;
+//nop;
+if (t1 == 0) goto L410760;
+t3 = MEM_U32(fp + -16);
+t4 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t5 = t3 >> (t4 & 0x1f);
+MEM_U32(at + 0) = t5;
+goto L410b34;
+L410760:
+t6 = MEM_U32(fp + -16);
+t2 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t8 = (int)t6 >> (t2 & 0x1f);
+MEM_U32(at + 0) = t8;
+goto L410b34;
+L410778:
+t7 = MEM_U32(fp + -16);
+t9 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t0 = t7 ^ t9;
+t0 = t0 < 0x1;
+MEM_U32(at + 0) = t0;
+at = 0x100063b0;
+MEM_U32(at + 4) = zero;
+goto L410b34;
+L41079c:
+t1 = MEM_U32(fp + -16);
+t3 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t4 = t1 ^ t3;
+t4 = zero < t4;
+MEM_U32(at + 0) = t4;
+at = 0x100063b0;
+MEM_U32(at + 4) = zero;
+goto L410b34;
+L4107c0:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 4) = zero;
+t5 = MEM_U32(fp + -12);
+//nop;
+//nop;
+if (t5 != 0) goto L4107ec;
+t6 = MEM_U32(fp + 4);
+//nop;
+//nop;
+if (t6 == 0) goto L410808;
+L4107ec:
+t2 = MEM_U32(fp + 0);
+t8 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t7 = t2 < t8;
+t7 = t7 ^ 0x1;
+MEM_U32(at + 0) = t7;
+goto L410b34;
+L410808:
+t9 = MEM_U32(fp + 0);
+t0 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t1 = (int)t9 < (int)t0;
+t1 = t1 ^ 0x1;
+MEM_U32(at + 0) = t1;
+goto L410b34;
+L410824:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 4) = zero;
+t3 = MEM_U32(fp + -12);
+//nop;
+//nop;
+if (t3 != 0) goto L410850;
+t4 = MEM_U32(fp + 4);
+//nop;
+//nop;
+if (t4 == 0) goto L41086c;
+L410850:
+t5 = MEM_U32(fp + -16);
+t6 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t2 = t5 < t6;
+t2 = t2 ^ 0x1;
+MEM_U32(at + 0) = t2;
+goto L410b34;
+L41086c:
+t8 = MEM_U32(fp + -16);
+t7 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t9 = (int)t8 < (int)t7;
+t9 = t9 ^ 0x1;
+MEM_U32(at + 0) = t9;
+goto L410b34;
+L410888:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 4) = zero;
+t0 = MEM_U32(fp + -12);
+//nop;
+//nop;
+if (t0 != 0) goto L4108b4;
+t1 = MEM_U32(fp + 4);
+//nop;
+//nop;
+if (t1 == 0) goto L4108cc;
+L4108b4:
+t3 = MEM_U32(fp + -16);
+t4 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t5 = t3 < t4;
+MEM_U32(at + 0) = t5;
+goto L410b34;
+L4108cc:
+t6 = MEM_U32(fp + -16);
+t2 = MEM_U32(fp + 0);
+at = 0x100063b0;
+t8 = (int)t6 < (int)t2;
+MEM_U32(at + 0) = t8;
+goto L410b34;
+L4108e4:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 4) = zero;
+t7 = MEM_U32(fp + -12);
+//nop;
+//nop;
+if (t7 != 0) goto L410910;
+t9 = MEM_U32(fp + 4);
+//nop;
+//nop;
+if (t9 == 0) goto L410928;
+L410910:
+t0 = MEM_U32(fp + 0);
+t1 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t3 = t0 < t1;
+MEM_U32(at + 0) = t3;
+goto L410b34;
+L410928:
+t4 = MEM_U32(fp + 0);
+t5 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t6 = (int)t4 < (int)t5;
+MEM_U32(at + 0) = t6;
+goto L410b34;
+L410940:
+t2 = MEM_U32(fp + 0);
+t8 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t7 = t2 & t8;
+MEM_U32(at + 0) = t7;
+v0 = MEM_U32(fp + -12);
+//nop;
+t9 = zero < v0;
+v0 = t9;
+if (t9 != 0) goto L410978;
+v0 = MEM_U32(fp + 4);
+//nop;
+t0 = zero < v0;
+v0 = t0;
+L410978:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L410984:
+t1 = MEM_U32(fp + 0);
+t3 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t4 = t1 ^ t3;
+MEM_U32(at + 0) = t4;
+v0 = MEM_U32(fp + -12);
+//nop;
+t5 = zero < v0;
+v0 = t5;
+if (t5 != 0) goto L4109bc;
+v0 = MEM_U32(fp + 4);
+//nop;
+t6 = zero < v0;
+v0 = t6;
+L4109bc:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L4109c8:
+t2 = MEM_U32(fp + 0);
+t8 = MEM_U32(fp + -16);
+at = 0x100063b0;
+t7 = t2 | t8;
+MEM_U32(at + 0) = t7;
+v0 = MEM_U32(fp + -12);
+//nop;
+t9 = zero < v0;
+v0 = t9;
+if (t9 != 0) goto L410a00;
+v0 = MEM_U32(fp + 4);
+//nop;
+t0 = zero < v0;
+v0 = t0;
+L410a00:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L410a0c:
+v0 = MEM_U32(fp + -16);
+//nop;
+t1 = zero < v0;
+v0 = t1;
+if (t1 == 0) goto L410a30;
+v0 = MEM_U32(fp + 0);
+//nop;
+t3 = zero < v0;
+v0 = t3;
+L410a30:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 0) = v0;
+at = 0x100063b0;
+MEM_U32(at + 4) = zero;
+goto L410b34;
+L410a48:
+v0 = MEM_U32(fp + -16);
+//nop;
+t4 = zero < v0;
+v0 = t4;
+if (t4 != 0) goto L410a6c;
+v0 = MEM_U32(fp + 0);
+//nop;
+t5 = zero < v0;
+v0 = t5;
+L410a6c:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 0) = v0;
+at = 0x100063b0;
+MEM_U32(at + 4) = zero;
+goto L410b34;
+L410a84:
+t6 = MEM_U32(fp + -32);
+//nop;
+//nop;
+if (t6 == 0) goto L410aa4;
+t2 = MEM_U32(fp + -16);
+at = 0x100063b0;
+MEM_U32(at + 0) = t2;
+goto L410ab4;
+L410aa4:
+t8 = MEM_U32(fp + 0);
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 0) = t8;
+L410ab4:
+v0 = MEM_U32(fp + -12);
+//nop;
+t7 = zero < v0;
+v0 = t7;
+if (t7 != 0) goto L410ad8;
+v0 = MEM_U32(fp + 4);
+//nop;
+t9 = zero < v0;
+v0 = t9;
+L410ad8:
+at = 0x100063b0;
+MEM_U32(at + 4) = v0;
+goto L410b34;
+L410ae4:
+t1 = 0x100063a8;
+t0 = 0x100063b0;
+at = MEM_U32(t1 + 0);
+t5 = MEM_U32(t1 + 4);
+MEM_U32(t0 + 0) = at;
+MEM_U32(t0 + 4) = t5;
+goto L410b34;
+L410b00:
+t2 = 0x100063a8;
+t6 = 0x100063b0;
+at = MEM_U32(t2 + 0);
+t9 = MEM_U32(t2 + 4);
+MEM_U32(t6 + 0) = at;
+MEM_U32(t6 + 4) = t9;
+goto L410b34;
+L410b1c:
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x100063b0;
+//nop;
+MEM_U32(at + 4) = zero;
+L410b34:
+a0 = 0x10000200;
+a3 = 0x10006adc;
+a2 = 0x10006ad4;
+a1 = 0x10000204;
+v0 = 0x10006ad8;
+a0 = MEM_U32(a0 + 0);
+s6 = MEM_U32(a2 + 0);
+goto L40fbf8;
+L410b54:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x70;
+return v0;
+//nop;
+}
+
+static void f_MDnewstab(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, t6 = 0;
+L410b88:
+//MDnewstab:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000016b MEM_U32(sp + 28) = ra;
+a1 = a0;
+// fdead 4000016b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a1;
+a0 = 0x40000;
+v0 = wrapper_malloc(mem, a0);
+a1 = MEM_U32(sp + 32);
+// bdead 49 gp = MEM_U32(sp + 24);
+at = 0x40000;
+t6 = v0 + at;
+MEM_U32(a1 + 32) = v0;
+MEM_U32(a1 + 36) = v0;
+MEM_U32(a1 + 40) = t6;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_MDstrcpy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, s0 = 0, t9 = 0,
+fp_dest;
+uint64_t temp64;
+L410be0:
+//MDstrcpy:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+if (a1 != 0) goto L410c0c;
+v0 = zero;
+goto L410ca4;
+L410c0c:
+a0 = MEM_U32(s0 + 36);
+t6 = MEM_U32(s0 + 40);
+//nop;
+a3 = t6 - a0;
+//nop;
+if ((int)a3 >= (int)0x100) goto L410c4c;
+//nop;
+a0 = s0;
+MEM_U32(sp + 44) = a1;
+f_MDnewstab(mem, sp, a0);
+a0 = MEM_U32(s0 + 36);
+t7 = MEM_U32(s0 + 40);
+// bdead 40030023 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+a3 = t7 - a0;
+L410c4c:
+//nop;
+MEM_U32(sp + 36) = a0;
+a2 = zero;
+v0 = wrapper_memccpy(mem, a0, a1, a2, a3);
+// bdead 60040020189 gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 36) = v0;
+if (v0 != 0) goto L410c9c;
+a0 = 0x10002680;
+t9 = MEM_U32(s0 + 12);
+a1 = MEM_U32(s0 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L410c9c:
+v0 = MEM_U32(sp + 36);
+//nop;
+L410ca4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t func_410cb4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L410cb4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a0 = a1;
+MEM_U32(sp + 36) = a1;
+v0 = wrapper_strlen(mem, a0);
+a1 = MEM_U32(sp + 36);
+// bdead 4000004b gp = MEM_U32(sp + 24);
+v1 = a1 + v0;
+a2 = MEM_U32(sp + 32);
+v1 = v1 + 0xfffffffe;
+a0 = v1;
+if ((int)v0 < (int)0x3) goto L410d38;
+t6 = MEM_U8(v1 + 0);
+at = 0x2e;
+//nop;
+if (t6 != at) goto L410d38;
+v0 = MEM_U8(v1 + 1);
+at = 0x68;
+if (v0 == at) {
+at = 0x61;
+goto L410d30;}
+at = 0x61;
+if (v0 == at) {
+at = 0x6f;
+goto L410d30;}
+at = 0x6f;
+//nop;
+if (v0 != at) goto L410d38;
+L410d30:
+MEM_U8(v1 + 0) = (uint8_t)zero;
+goto L410d3c;
+L410d38:
+a0 = zero;
+L410d3c:
+v0 = MEM_U8(a1 + 0);
+v1 = zero;
+if (v0 == 0) {
+t7 = v1 << 1;
+goto L410d60;}
+L410d48:
+t7 = v1 << 1;
+t8 = t7 ^ v0;
+v0 = MEM_U8(a1 + 1);
+a1 = a1 + 0x1;
+v1 = v1 + t8;
+if (v0 != 0) goto L410d48;
+L410d60:
+//nop;
+if (a0 == 0) goto L410d70;
+t9 = 0x2e;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+L410d70:
+t1 = MEM_U32(a2 + 24);
+t0 = MEM_U32(a2 + 28);
+// bdead 611 ra = MEM_U32(sp + 28);
+t2 = v1 & t1;
+t3 = t2 << 3;
+// bdead 1201 sp = sp + 0x20;
+v0 = t0 + t3;
+return v0;
+}
+
+static uint32_t func_410d90(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L410d90:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b t9 = t9;
+s1 = a1;
+// fdead 4004006b MEM_U32(sp + 32) = gp;
+// fdead 4004006b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 40) = a0;
+v0 = func_410cb4(mem, sp, a0, a1);
+t6 = MEM_U32(v0 + 0);
+// bdead 40048009 gp = MEM_U32(sp + 32);
+s0 = v0;
+if (t6 == 0) goto L410e58;
+a0 = t6;
+L410dd8:
+//nop;
+a1 = s1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+// bdead 40060001 ra = MEM_U32(sp + 36);
+if (v0 == 0) goto L410e5c;
+v0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L410e48;
+a1 = MEM_U32(sp + 40);
+a0 = s0;
+t7 = MEM_U32(a1 + 24);
+v0 = MEM_U32(a1 + 28);
+t8 = t7 << 3;
+v1 = v0 + t8;
+L410e1c:
+s0 = s0 + 0x8;
+//nop;
+if (v1 >= s0) goto L410e30;
+s0 = v0;
+L410e30:
+t9 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L410e1c;
+MEM_U32(a0 + 4) = s0;
+goto L410e58;
+L410e48:
+a0 = MEM_U32(v0 + 0);
+s0 = v0;
+//nop;
+if (a0 != 0) goto L410dd8;
+L410e58:
+// bdead 20001 ra = MEM_U32(sp + 36);
+L410e5c:
+v0 = s0;
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void func_410e70(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L410e70:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+// fdead 4000002b MEM_U32(sp + 28) = s2;
+// fdead 4000002b MEM_U32(sp + 24) = s1;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+v1 = MEM_U32(a0 + 24);
+//nop;
+v1 = v1 + 0x1;
+s2 = a0;
+s1 = v1 << 1;
+MEM_U32(sp + 48) = s1;
+a0 = s1;
+MEM_U32(sp + 52) = v1;
+a1 = 0x8;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 600400c0189 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 52);
+MEM_U32(sp + 44) = v0;
+if (v0 != 0) goto L410f08;
+a1 = MEM_U32(s2 + 4);
+MEM_U32(sp + 52) = v1;
+t9 = MEM_U32(s2 + 12);
+a0 = 0x100026a4;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 400c0001 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 52);
+//nop;
+L410f08:
+t6 = MEM_U32(s2 + 20);
+t7 = (int)v1 >> 2;
+if ((int)v1 >= 0) goto L410f1c;
+at = v1 + 0x3;
+t7 = (int)at >> 2;
+L410f1c:
+t8 = v1 - t7;
+t0 = t6 + t8;
+MEM_U32(s2 + 20) = t0;
+t1 = MEM_U32(sp + 48);
+t3 = MEM_U32(s2 + 28);
+t2 = t1 + 0xffffffff;
+MEM_U32(s2 + 24) = t2;
+t4 = MEM_U32(sp + 44);
+MEM_U32(sp + 40) = t3;
+MEM_U32(s2 + 28) = t4;
+s0 = MEM_U32(sp + 40);
+s1 = s1 + 0xfffffffe;
+//nop;
+if ((int)s1 < 0) goto L410f90;
+L410f54:
+a1 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (a1 == 0) goto L410f84;
+//nop;
+a0 = s2;
+// fdead 620ffe7f t9 = t9;
+//nop;
+v0 = func_410d90(mem, sp, a0, a1);
+t5 = MEM_U32(s0 + 0);
+// bdead 400e4009 gp = MEM_U32(sp + 32);
+MEM_U32(v0 + 0) = t5;
+L410f84:
+s1 = s1 + 0xfffffffe;
+s0 = s0 + 0x8;
+if ((int)s1 >= 0) goto L410f54;
+L410f90:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static uint32_t f_MDopen(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+fp_dest;
+uint64_t temp64;
+L410fbc:
+//MDopen:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a0 = 0x2c;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+s0 = v0;
+//nop;
+a0 = v0;
+//nop;
+f_MDnewstab(mem, sp, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x100;
+//nop;
+a1 = 0x8;
+//nop;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 6004002018b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+if (s0 == 0) goto L411038;
+//nop;
+if (v0 != 0) goto L4110a0;
+L411038:
+a0 = 0x100026cc;
+t9 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 44);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+if (s0 == 0) goto L411074;
+//nop;
+a0 = s0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = MEM_U32(sp + 32);
+L411074:
+//nop;
+//nop;
+if (a0 == 0) goto L411098;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L411098:
+v0 = zero;
+goto L411110;
+L4110a0:
+//nop;
+a1 = MEM_U32(sp + 40);
+a0 = s0;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 0) = v0;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = s0;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 4) = v0;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = s0;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 8) = v0;
+t6 = MEM_U32(sp + 52);
+t7 = 0xc0;
+t8 = 0xff;
+MEM_U32(s0 + 16) = zero;
+MEM_U32(s0 + 20) = t7;
+MEM_U32(s0 + 24) = t8;
+MEM_U32(s0 + 12) = t6;
+t0 = MEM_U32(sp + 32);
+v0 = s0;
+MEM_U32(s0 + 28) = t0;
+L411110:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_MDupdate(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L411120:
+//MDupdate:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+if (a0 == 0) goto L4111ec;
+//nop;
+//nop;
+// fdead 4002006b t9 = t9;
+//nop;
+v0 = func_410d90(mem, sp, a0, a1);
+t6 = MEM_U32(v0 + 0);
+// bdead 40028009 gp = MEM_U32(sp + 24);
+v1 = v0;
+if (t6 != 0) goto L4111ec;
+t7 = MEM_U32(s0 + 20);
+//nop;
+//nop;
+if (t7 != 0) goto L4111b4;
+//nop;
+a0 = s0;
+// fdead 6003803b t9 = t9;
+//nop;
+func_410e70(mem, sp, a0);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+//nop;
+a0 = s0;
+// fdead 60020063 t9 = t9;
+//nop;
+v0 = func_410d90(mem, sp, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+v1 = v0;
+L4111b4:
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = s0;
+MEM_U32(sp + 36) = v1;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 36);
+// bdead 20019 gp = MEM_U32(sp + 24);
+MEM_U32(v1 + 0) = v0;
+t8 = MEM_U32(s0 + 20);
+t0 = MEM_U32(s0 + 16);
+t9 = t8 + 0xffffffff;
+t1 = t0 + 0x1;
+MEM_U32(s0 + 20) = t9;
+MEM_U32(s0 + 16) = t1;
+L4111ec:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_MDclose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L4111fc:
+//MDclose:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffed0;
+// fdead 4000006b MEM_U32(sp + 52) = s5;
+s5 = a0;
+// fdead 4040006b MEM_U32(sp + 60) = ra;
+// fdead 4040006b MEM_U32(sp + 56) = gp;
+// fdead 4040006b MEM_U32(sp + 48) = s4;
+// fdead 4040006b MEM_U32(sp + 44) = s3;
+// fdead 4040006b MEM_U32(sp + 40) = s2;
+// fdead 4040006b MEM_U32(sp + 36) = s1;
+// fdead 4040006b MEM_U32(sp + 32) = s0;
+MEM_U32(sp + 308) = a1;
+if (a0 == 0) goto L411900;
+t6 = MEM_U32(a0 + 16);
+a1 = 0x102;
+//nop;
+if (t6 == 0) goto L4118b8;
+//nop;
+a0 = MEM_U32(a0 + 4);
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4040010b gp = MEM_U32(sp + 56);
+t7 = 0x2;
+MEM_U32(sp + 300) = v0;
+MEM_U16(sp + 256) = (uint16_t)t7;
+MEM_U16(sp + 258) = (uint16_t)zero;
+MEM_U32(sp + 264) = zero;
+MEM_U32(sp + 260) = zero;
+if ((int)v0 < 0) goto L4112b4;
+//nop;
+a0 = v0;
+a1 = 0x7;
+a2 = sp + 0x100;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fcntl(mem, a0, a1, sp);
+// bdead 4040000b gp = MEM_U32(sp + 56);
+//nop;
+if ((int)v0 < 0) goto L4112b4;
+//nop;
+a0 = MEM_U32(sp + 300);
+a1 = sp + 0x78;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4040000b gp = MEM_U32(sp + 56);
+s0 = MEM_U32(sp + 168);
+if ((int)v0 >= 0) goto L411350;
+L4112b4:
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100026f0;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a0 = MEM_U32(sp + 300);
+// bdead 40400021 gp = MEM_U32(sp + 56);
+// bdead 40400021 ra = MEM_U32(sp + 60);
+if ((int)a0 < 0) goto L411904;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40400009 gp = MEM_U32(sp + 56);
+// bdead 40400001 ra = MEM_U32(sp + 60);
+if (v0 == 0) goto L411904;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60000400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100026f8;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 56);
+// bdead 1 ra = MEM_U32(sp + 60);
+goto L411904;
+// fdead 0 s0 = MEM_U32(sp + 168);
+L411350:
+a0 = zero;
+a1 = s0;
+if (s0 != 0) goto L411368;
+s4 = zero;
+MEM_U32(sp + 112) = zero;
+goto L411404;
+L411368:
+t8 = MEM_U32(sp + 300);
+//nop;
+a2 = 0x3;
+a3 = 0x1;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = t8;
+v0 = wrapper_mmap(mem, a0, a1, a2, a3, MEM_S32(sp + 16), MEM_S32(sp + 20));
+// bdead 4042000b gp = MEM_U32(sp + 56);
+MEM_U32(sp + 112) = v0;
+if ((int)v0 >= 0) goto L4113e4;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x10002700;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(sp + 300);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 56);
+// bdead 1 ra = MEM_U32(sp + 60);
+goto L411904;
+L4113e4:
+v1 = v0 + s0;
+s4 = v1;
+if ((int)s0 <= 0) goto L411404;
+t0 = MEM_U8(v1 + -1);
+at = 0xa;
+t1 = MEM_U32(sp + 308);
+if (t0 == at) goto L411408;
+s4 = v0;
+L411404:
+t1 = MEM_U32(sp + 308);
+L411408:
+//nop;
+//nop;
+if (t1 != 0) goto L411420;
+t2 = MEM_U32(s5 + 8);
+//nop;
+MEM_U32(sp + 308) = t2;
+L411420:
+//nop;
+a0 = MEM_U32(sp + 308);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4060010b gp = MEM_U32(sp + 56);
+MEM_U32(sp + 296) = v0;
+a1 = 0x10002708;
+//nop;
+a2 = MEM_U32(s5 + 0);
+a0 = sp + 0x54;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 4060000b gp = MEM_U32(sp + 56);
+MEM_U32(sp + 292) = v0;
+if ((int)v0 >= 0) goto L411494;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 6004060010b gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x10002710;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40600003 gp = MEM_U32(sp + 56);
+//nop;
+L411494:
+s0 = MEM_U32(sp + 112);
+//nop;
+t0 = MEM_U32(sp + 112);
+if (s0 >= s4) goto L411618;
+s2 = 0xfb504f0;
+//nop;
+L4114b0:
+//nop;
+a0 = s0;
+a1 = 0xa;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 406a000b gp = MEM_U32(sp + 56);
+s1 = v0;
+if (v0 != 0) goto L411518;
+t4 = MEM_U32(sp + 112);
+a0 = 0xfb528e4;
+a1 = 0x10002718;
+//nop;
+a2 = MEM_U32(s5 + 0);
+a3 = MEM_U32(s5 + 4);
+t5 = s0 - t4;
+MEM_U32(sp + 16) = t5;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 406e0003 gp = MEM_U32(sp + 56);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 406e0003 gp = MEM_U32(sp + 56);
+//nop;
+L411518:
+MEM_U8(s1 + 0) = (uint8_t)zero;
+//nop;
+s3 = s0;
+a0 = s0;
+a1 = 0x3a;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 407c000b gp = MEM_U32(sp + 56);
+t6 = 0xa;
+s0 = v0;
+MEM_U8(s1 + 0) = (uint8_t)t6;
+s1 = s1 + 0x1;
+if (v0 == 0) goto L411608;
+t7 = MEM_U8(v0 + -1);
+t5 = MEM_U32(sp + 296);
+t8 = t7 + s2;
+t0 = MEM_U8(t8 + 1);
+a0 = s3;
+t1 = t0 & 0x8;
+t6 = s0 - s3;
+if (t1 == 0) goto L41158c;
+L411568:
+t2 = MEM_U8(s0 + -2);
+s0 = s0 + 0xffffffff;
+t9 = t2 + s2;
+t3 = MEM_U8(t9 + 1);
+//nop;
+t4 = t3 & 0x8;
+//nop;
+if (t4 != 0) goto L411568;
+t6 = s0 - s3;
+L41158c:
+at = s1 < s4;
+if (t5 != t6) goto L41160c;
+//nop;
+a1 = MEM_U32(sp + 308);
+a2 = t5;
+v0 = wrapper_bcmp(mem, a0, a1, a2);
+// bdead 407e000b gp = MEM_U32(sp + 56);
+at = s1 < s4;
+if (v0 != 0) goto L41160c;
+t7 = MEM_U32(sp + 292);
+//nop;
+a0 = s1 - t7;
+a0 = a0 + 0xffffffff;
+if (s0 >= a0) {
+at = s1 < s4;
+goto L41160c;}
+at = s1 < s4;
+//nop;
+a1 = sp + 0x54;
+a2 = t7;
+v0 = wrapper_bcmp(mem, a0, a1, a2);
+// bdead 407c000b gp = MEM_U32(sp + 56);
+a0 = s1;
+if (v0 != 0) goto L411608;
+//nop;
+a1 = s3;
+a2 = s4 - s1;
+wrapper_bcopy(mem, a0, a1, a2);
+t8 = s1 - s3;
+// bdead 42780003 gp = MEM_U32(sp + 56);
+s4 = s4 - t8;
+s1 = s3;
+L411608:
+at = s1 < s4;
+L41160c:
+s0 = s1;
+if (at != 0) goto L4114b0;
+t0 = MEM_U32(sp + 112);
+L411618:
+a2 = MEM_U32(sp + 168);
+a1 = s4 - t0;
+//nop;
+if ((int)a1 >= (int)a2) goto L411680;
+//nop;
+a0 = MEM_U32(sp + 300);
+//nop;
+v0 = wrapper_ftruncate(mem, a0, a1);
+// bdead 40400009 gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L411680;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x1000276c;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40400001 gp = MEM_U32(sp + 56);
+//nop;
+L411680:
+a1 = 0x10002774;
+//nop;
+a0 = MEM_U32(sp + 300);
+a1 = a1;
+v0 = wrapper_fdopen(mem, a0, a1);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+s2 = v0;
+if (v0 != 0) goto L4116dc;
+a0 = 0x10002778;
+t9 = MEM_U32(s5 + 12);
+a1 = MEM_U32(s5 + 4);
+a2 = MEM_U32(sp + 308);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40400001 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(sp + 300);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 56);
+t5 = MEM_U32(sp + 112);
+goto L411858;
+L4116dc:
+a1 = 0x100027a4;
+//nop;
+a2 = MEM_U32(sp + 308);
+a0 = s2;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40480109 gp = MEM_U32(sp + 56);
+//nop;
+if ((int)v0 >= 0) goto L411738;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040480109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100027a8;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40480101 gp = MEM_U32(sp + 56);
+//nop;
+L411738:
+t1 = MEM_U32(s5 + 24);
+s0 = MEM_U32(s5 + 28);
+t2 = t1 << 3;
+v1 = s0 + t2;
+//nop;
+if (v1 < s0) goto L4117a4;
+s1 = 0x100027b0;
+//nop;
+s1 = s1;
+L411760:
+a2 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (a2 == 0) goto L411794;
+//nop;
+a0 = s2;
+a1 = s1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+t4 = MEM_U32(s5 + 24);
+t3 = MEM_U32(s5 + 28);
+t6 = t4 << 3;
+// bdead 404e9101 gp = MEM_U32(sp + 56);
+v1 = t3 + t6;
+L411794:
+s0 = s0 + 0x8;
+//nop;
+if (v1 >= s0) goto L411760;
+L4117a4:
+a1 = 0x100027b4;
+//nop;
+a0 = s2;
+a2 = sp + 0x54;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40480009 gp = MEM_U32(sp + 56);
+//nop;
+if ((int)v0 >= 0) goto L411800;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040480109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100027bc;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40480001 gp = MEM_U32(sp + 56);
+//nop;
+L411800:
+//nop;
+a0 = s2;
+//nop;
+v0 = wrapper_fclose(mem, a0);
+// bdead 40400009 gp = MEM_U32(sp + 56);
+t5 = MEM_U32(sp + 112);
+if (v0 == 0) goto L411858;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100027c4;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40400001 gp = MEM_U32(sp + 56);
+//nop;
+t5 = MEM_U32(sp + 112);
+L411858:
+//nop;
+//nop;
+if (t5 == 0) goto L4118b8;
+//nop;
+a1 = MEM_U32(sp + 168);
+a0 = t5;
+v0 = wrapper_munmap(mem, a0, a1);
+// bdead 40400009 gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L4118b8;
+a0 = 0xfb52720;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strerror(mem, a0);
+// bdead 60040400109 gp = MEM_U32(sp + 56);
+t9 = MEM_U32(s5 + 12);
+a0 = 0x100027cc;
+a1 = MEM_U32(s5 + 4);
+a2 = v0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40400001 gp = MEM_U32(sp + 56);
+//nop;
+L4118b8:
+//nop;
+a0 = MEM_U32(s5 + 28);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s5 + 32);
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 56);
+a0 = s5;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 56);
+//nop;
+L411900:
+// bdead 1 ra = MEM_U32(sp + 60);
+L411904:
+// bdead 1 s0 = MEM_U32(sp + 32);
+// bdead 1 s1 = MEM_U32(sp + 36);
+// bdead 1 s2 = MEM_U32(sp + 40);
+// bdead 1 s3 = MEM_U32(sp + 44);
+// bdead 1 s4 = MEM_U32(sp + 48);
+// bdead 1 s5 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x130;
+return;
+//nop;
+//nop;
+//nop;
+}
@@ -0,0 +1,27851 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x62696e61,0x736d0000,0x6173303a,0x20000000,0x556e6b6e,0x6f776e20,0x6f707469,0x6f6e0000,
+0x45787472,0x61206669,0x6c656e61,0x6d65206f,0x6e20636f,0x6d6d616e,0x64206c69,0x6e650000,
+0x77000000,0x77000000,0x72000000,0x24617400,0x246b7430,0x0,0x246b7431,0x0,
+0x24677000,0x24737000,0x24667000,0xa000000,0xf03f39c4,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f39c4,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f38f0,0xf03f38e0,0xf03f38e8,0xf03f38f0,0xf03f38fc,0xf03f3a98,
+0xf03f39cc,0xf03f3918,0xf03f3908,0xf03f3910,0xf03f3918,0xf03f3920,0xf03f3a98,0xf03f3994,
+0xf03f394c,0xf03f3928,0xf03f3928,0xf03f3934,0xf03f3940,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a10,0xf03f3a1c,0xf03f3a28,0xf03f3a34,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f39e0,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f39c4,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f39c4,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a4c,0xf03f3a40,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f39a8,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f39c4,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f3a98,
+0xf03f3a98,0xf03f3a98,0xf03f3a98,0xf03f39ec,0x0,0x6f706572,0x616e6420,0x31000000,
+0x6f706572,0x616e6420,0x32000000,0x6f706572,0x616e6420,0x33000000,0x55736564,0x20246174,
+0x20776974,0x686f7574,0x202e7365,0x74206e6f,0x61740000,0x53686f75,0x6c642062,0x65206770,
+0x20726567,0x69737465,0x72000000,0x53686f75,0x6c642062,0x65206576,0x656e2067,0x70207265,
+0x67697374,0x65720000,0x53686f75,0x6c642062,0x65206770,0x20726567,0x69737465,0x72000000,
+0x55736564,0x20246174,0x20776974,0x686f7574,0x202e7365,0x74206e6f,0x61740000,0x53686f75,
+0x6c642062,0x6520636f,0x70726f63,0x6573736f,0x72207265,0x67697374,0x65720000,0x53686f75,
+0x6c642062,0x65206576,0x656e2063,0x6f70726f,0x63657373,0x6f722072,0x65676973,0x74657200,
+0x53686f75,0x6c642062,0x6520666c,0x6f617469,0x6e672070,0x6f696e74,0x20726567,0x69737465,
+0x72000000,0x53686f75,0x6c642062,0x65206576,0x656e2066,0x6c6f6174,0x696e6720,0x706f696e,
+0x74207265,0x67697374,0x65720000,0x53686f75,0x6c642062,0x65206576,0x656e2066,0x6c6f6174,
+0x696e6720,0x706f696e,0x74207265,0x67697374,0x65720000,0x53686f75,0x6c642062,0x65206d75,
+0x6c746970,0x6c652d6f,0x662d3420,0x666c6f61,0x74696e67,0x20706f69,0x6e742072,0x65676973,
+0x74657200,0x53686f75,0x6c642062,0x65206670,0x20646f75,0x626c6520,0x6f722067,0x70207369,
+0x6e676c65,0x20726567,0x69737465,0x72000000,0x53686f75,0x6c642062,0x65206d75,0x6c746970,
+0x6c652d6f,0x662d3220,0x72656769,0x73746572,0x0,0x53686f75,0x6c642062,0x65206d75,
+0x6c746970,0x6c652d6f,0x662d3220,0x72656769,0x73746572,0x0,0x53686f75,0x6c642062,
+0x65206d75,0x6c746970,0x6c652d6f,0x662d3420,0x72656769,0x73746572,0x0,0x53686f75,
+0x6c642062,0x6520666c,0x6f617469,0x6e672070,0x6f696e74,0x20636f6e,0x64697469,0x6f6e2063,
+0x6f646520,0x72656769,0x73746572,0x0,0x66616c73,0x65000000,0x61733070,0x61727365,
+0x2e630000,0x25316420,0x25316400,0x2025730a,0x0,0x0,0x63616e20,0x6e6f7420,
+0x72656465,0x66696e65,0x2073796d,0x626f6c00,0x62726561,0x6b206f70,0x6572616e,0x64206f75,
+0x74206f66,0x2072616e,0x67650000,0x696c6c2d,0x666f726d,0x65642073,0x796d626f,0x6c696320,
+0x65787072,0x65737369,0x6f6e0000,0x696c6c2d,0x666f726d,0x65642073,0x796d626f,0x6c696320,
+0x65787072,0x65737369,0x6f6e0000,0x42616420,0x69642069,0x6e206578,0x70726573,0x73696f6e,
+0x0,0x68690000,0x6c6f0000,0x67707265,0x6c000000,0x68616c66,0x0,0x25206e6f,
+0x7420666f,0x6c6c6f77,0x65642062,0x79206869,0x2f6c6f2f,0x67707265,0x6c000000,0x2568692f,
+0x256c6f2f,0x25677072,0x656c206e,0x6f742066,0x6f6c6c6f,0x77656420,0x62792028,0x0,
+0x4c6f6164,0x2f53746f,0x7265206f,0x6620756e,0x64656669,0x6e656420,0x73796d62,0x6f6c0000,
+0x696e7661,0x6c696420,0x65787072,0x65737369,0x6f6e2077,0x69746820,0x2568692f,0x256c6f00,
+0x27292720,0x65787065,0x63746564,0x0,0x696e7661,0x6c696420,0x6d656d6f,0x72792074,
+0x61670000,0x4c6f6164,0x2f73746f,0x7265206f,0x6620616e,0x20756e64,0x6566696e,0x65642073,
+0x796d626f,0x6c000000,0x696e7661,0x6c696420,0x65787465,0x726e616c,0x20657870,0x72657373,
+0x696f6e00,0x27292720,0x65787065,0x63746564,0x0,0x43616368,0x652f5072,0x65662069,
+0x6e737472,0x75637469,0x6f6e2068,0x61732069,0x6e76616c,0x69642076,0x616c7565,0x0,
+0x4c6f6164,0x2f73746f,0x7265206f,0x6620616e,0x20756e64,0x6566696e,0x65642073,0x796d626f,
+0x6c000000,0x696e7661,0x6c696420,0x65787465,0x726e616c,0x20657870,0x72657373,0x696f6e00,
+0x27292720,0x65787065,0x63746564,0x0,0x4c6f6164,0x2f73746f,0x7265206f,0x6620616e,
+0x20756e64,0x6566696e,0x65642073,0x796d626f,0x6c000000,0x696e7661,0x6c696420,0x65787465,
+0x726e616c,0x20657870,0x72657373,0x696f6e00,0x27292720,0x65787065,0x63746564,0x0,
+0x666c6f61,0x74696e67,0x20706f69,0x6e742063,0x6f6e7374,0x616e7420,0x65787065,0x63746564,
+0x0,0x6c756920,0x65787072,0x65737369,0x6f6e206e,0x6f742069,0x6e20302e,0x2e363535,
+0x33350000,0x6661736d,0x203d3d20,0x7a6c6900,0x61733070,0x61727365,0x2e630000,0x6c756920,
+0x65787072,0x65737369,0x6f6e206e,0x6f742069,0x6e20302e,0x2e363535,0x33350000,0x696e7661,
+0x6c696420,0x73796e74,0x61782069,0x6e207374,0x6174656d,0x656e7400,0x696e7661,0x6c696420,
+0x73796e74,0x61782069,0x6e207374,0x6174656d,0x656e7400,0x73686966,0x7420616d,0x6f756e74,
+0x206e6f74,0x20302e2e,0x33310000,0x73686966,0x7420616d,0x6f756e74,0x206e6f74,0x20302e2e,
+0x36330000,0x73686966,0x7420616d,0x6f756e74,0x206e6f74,0x20302e2e,0x33310000,0x6f706572,
+0x6174696f,0x6e206e65,0x65647320,0x696d6d65,0x64206f70,0x6572616e,0x64000000,0x696d6d65,
+0x64206f70,0x6572616e,0x64206e6f,0x74202d30,0x2e2e3635,0x35333500,0x696d6d65,0x64206f70,
+0x6572616e,0x64206e6f,0x74202d33,0x32373638,0x2e2e3332,0x37363700,0x696d6d65,0x64206f70,
+0x6572616e,0x64206e6f,0x7420616c,0x6c6f7765,0x64206f6e,0x20667020,0x0,0x496d6d65,
+0x64696174,0x65207661,0x6c756520,0x6f757420,0x6f662072,0x616e6765,0x0,0x6d616372,
+0x6f206578,0x70616e73,0x696f6e20,0x6e656564,0x73206174,0x20726567,0x69737465,0x72206166,
+0x74657220,0x2e736574,0x206e6f61,0x74000000,0x68696e74,0x20666965,0x6c64206e,0x6f742069,
+0x6e207261,0x6e676520,0x302e2e33,0x31000000,0x65787065,0x6374696e,0x67202728,0x27206265,
+0x666f7265,0x20626173,0x65207265,0x67697374,0x65720000,0x65787065,0x6374696e,0x67202729,
+0x27206166,0x74657220,0x62617365,0x20726567,0x69737465,0x72000000,0x636f6465,0x20666965,
+0x6c642069,0x6e207472,0x61702069,0x6e737472,0x75637469,0x6f6e206e,0x6f742069,0x6e20302e,
+0x2e313032,0x33000000,0x6d616372,0x6f206578,0x70616e73,0x696f6e20,0x6e656564,0x73206174,
+0x20726567,0x69737465,0x72206166,0x74657220,0x2e736574,0x206e6f61,0x74000000,0x696e7661,
+0x6c696420,0x73796e74,0x61782069,0x6e207374,0x6174656d,0x656e7400,0x696e7661,0x6c696420,
+0x65787465,0x726e616c,0x20657870,0x72657373,0x696f6e00,0x73746d74,0x20657874,0x656e6473,
+0x20706173,0x74206c6f,0x67696361,0x6c20656e,0x64000000,0x4a414c20,0x73686f75,0x6c64206e,
+0x6f742075,0x73652073,0x616d6520,0x72656769,0x73746572,0x20747769,0x63650000,0x696e7661,
+0x6c696420,0x73796d62,0x6f6c2066,0x6f722061,0x64647265,0x73730000,0x2b2f2d20,0x65787065,
+0x63746564,0x20616674,0x6572202e,0x0,0x6272616e,0x6368206f,0x66667365,0x74206e6f,
+0x74207370,0x65636966,0x69656400,0x72656c61,0x74697665,0x206f6666,0x73657420,0x6e6f7420,
+0x6d756c74,0x69706c65,0x206f6620,0x34000000,0x72656c61,0x74697665,0x206f6666,0x73657420,
+0x6265796f,0x6e642033,0x32373638,0x0,0x696e7661,0x6c696420,0x73796e74,0x61782069,
+0x6e207374,0x6174656d,0x656e7400,0x6c616265,0x6c206578,0x70656374,0x65640000,0x73796d62,
+0x6f6c2069,0x73206e6f,0x74206120,0x6c616265,0x6c000000,0x6d616372,0x6f206578,0x70616e73,
+0x696f6e20,0x6e656564,0x73206174,0x20726567,0x69737465,0x72206166,0x74657220,0x2e736574,
+0x206e6f61,0x74000000,0x24333120,0x6e6f7420,0x616c6c6f,0x77656420,0x696e2063,0x6f6e6469,
+0x74696f6e,0x616c2062,0x72616e63,0x6820616e,0x64206c69,0x6e6b0000,0x6c616265,0x6c206578,
+0x70656374,0x65640000,0x73796d62,0x6f6c2069,0x73206e6f,0x74206120,0x6c616265,0x6c000000,
+0x636f6e64,0x6974696f,0x6e20636f,0x6465206f,0x72206c61,0x62656c20,0x65787065,0x63746564,
+0x0,0x6c616265,0x6c206578,0x70656374,0x65640000,0x73796d62,0x6f6c2069,0x73206e6f,
+0x74206120,0x6c616265,0x6c000000,0x65787072,0x65737369,0x6f6e2072,0x65717569,0x72656400,
+0x636f7072,0x6f636573,0x736f7220,0x6f706572,0x6174696f,0x6e203e20,0x32352062,0x69747300,
+0x4f666673,0x65742066,0x6f722063,0x70726573,0x746f7265,0x206d7573,0x74206265,0x20706f73,
+0x69746976,0x6520616e,0x64206469,0x76697369,0x626c6520,0x62792034,0x0,0x2e637061,
+0x6c696173,0x20726571,0x75697265,0x73206120,0x72656769,0x73746572,0x20617267,0x756d656e,
+0x74000000,0x76657273,0x696f6e20,0x7374616d,0x7020646f,0x6573206e,0x6f74206d,0x61746368,
+0x0,0x65787072,0x65737369,0x6f6e2072,0x65717569,0x72656400,0x63616e20,0x6e6f7420,
+0x66696e64,0x2073796d,0x626f6c00,0x63616e20,0x6e6f7420,0x66696e64,0x2073796d,0x626f6c00,
+0x2e736869,0x66745f61,0x64647220,0x65787072,0x65737369,0x6f6e206e,0x6f742031,0x0,
+0x616c6967,0x6e206578,0x70726573,0x73696f6e,0x206e6f74,0x20302e2e,0x31320000,0x73747269,
+0x6e67206c,0x69746572,0x616c2065,0x78706563,0x74656400,0x76616c75,0x65206d75,0x73742062,
+0x65202d31,0x32382e2e,0x32353500,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,
+0x6f707469,0x6f6e616c,0x20617267,0x756d656e,0x74206e6f,0x7420532c,0x2069676e,0x6f726564,
+0x2e000000,0x696e7661,0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x636f6d6d,0x2f2e6c63,
+0x6f6d6d2f,0x2e657874,0x65726e20,0x0,0x66616c73,0x65000000,0x61733070,0x61727365,
+0x2e630000,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,0x2e73796d,0x20646972,
+0x65637469,0x7665206e,0x6f742069,0x6d706c65,0x6d656e74,0x65640000,0x696f7020,0x3d3d2069,
+0x72646174,0x61000000,0x61733070,0x61727365,0x2e630000,0x73747269,0x6e67206c,0x69746572,
+0x616c2065,0x78706563,0x74656400,0x2e656e64,0x20776974,0x686f7574,0x202e656e,0x74000000,
+0x6d697373,0x696e6720,0x2e656e64,0x20617420,0x656e6420,0x6f662061,0x7373656d,0x626c7900,
+0x2e656e74,0x2f2e656e,0x6420626c,0x6f636b20,0x6e657665,0x72206465,0x66696e65,0x64207468,
+0x65207072,0x6f636564,0x75726520,0x6e616d65,0x0,0x6964656e,0x74696665,0x72206578,
+0x70656374,0x65640000,0x25732000,0x6d697373,0x696e6720,0x2e656e64,0x20707265,0x63656469,
+0x6e672074,0x68697320,0x2e656e74,0x0,0x2e61656e,0x74206d75,0x73742062,0x6520696e,
+0x73696465,0x202e656e,0x742f2e65,0x6e642062,0x6c6f636b,0x0,0x696e7661,0x6c696420,
+0x73796d62,0x6f6c2066,0x6f72202e,0x5b615d65,0x6e742000,0x6964656e,0x74696665,0x72206578,
+0x70656374,0x65640000,0x696e7661,0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x676c6f62,
+0x6c200000,0x62616420,0x73656374,0x696f6e20,0x6e616d65,0x0,0x62616420,0x73656374,
+0x696f6e20,0x6e616d65,0x0,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,
+0x696e7661,0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x676c6f62,0x6c200000,0x42616420,
+0x69642069,0x6e206578,0x70726573,0x73696f6e,0x0,0x76616c75,0x65206d75,0x73742062,
+0x65202d33,0x32373638,0x2e2e3635,0x35333500,0x2e726570,0x65617420,0x6e6f7420,0x616c6c6f,
+0x77656420,0x696e2073,0x74727563,0x74000000,0x2e726570,0x65617420,0x6d617920,0x6e6f7420,
+0x6e657374,0x0,0x2e656e64,0x72207769,0x74686f75,0x74207072,0x65636564,0x696e6720,
+0x2e726570,0x65617400,0x6964656e,0x74696669,0x65722065,0x78706563,0x74656400,0x2e6f7074,
+0x696f6e20,0x6e616d65,0x20657870,0x65637465,0x64000000,0x556e6b6e,0x6f776e20,0x6e616d65,
+0x20696e20,0x2e6f7074,0x696f6e00,0x2e736574,0x206f7074,0x696f6e20,0x65787065,0x63746564,
+0x0,0x756e6b6e,0x6f776e20,0x6f707469,0x6f6e2069,0x6e202e73,0x65740000,0x52657365,
+0x72766564,0x206e616d,0x65207573,0x65642061,0x73206c61,0x62656c00,0x636f6c6f,0x6e206d75,
+0x73742066,0x6f6c6c6f,0x77206120,0x6c6f6361,0x6c206c61,0x62656c00,0x6d616c66,0x6f726d65,
+0x64207374,0x6174656d,0x656e7400,0x6d616c66,0x6f726d65,0x64207374,0x6174656d,0x656e7400,
+0x756e6465,0x66696e65,0x64206173,0x73656d62,0x6c657220,0x6f706572,0x6174696f,0x6e000000,
+0x2e657272,0x20646972,0x65637469,0x76652065,0x6e636f75,0x6e746572,0x65640000,0x66616c73,
+0x65000000,0x61733070,0x61727365,0x2e630000,0x66616c73,0x65000000,0x61733070,0x61727365,
+0x2e630000,0x66616c73,0x65000000,0x61733070,0x61727365,0x2e630000,0x73746d74,0x20657874,
+0x656e6473,0x20706173,0x74206c6f,0x67696361,0x6c20656e,0x64000000,0x66616c73,0x65000000,
+0x61733070,0x61727365,0x2e630000,0x73746d74,0x20657874,0x656e6473,0x20706173,0x74206c6f,
+0x67696361,0x6c20656e,0x64000000,0x61737365,0x6d626c65,0x72206f70,0x2f646972,0x65637469,
+0x76652065,0x78706563,0x74656400,0xf03f46a8,0xf03f4180,0xf03f4214,0xf03f427c,0xf03f43c0,
+0xf03f4408,0xf03f4470,0xf03f4314,0xf03f4358,0xf03f4528,0xf03f4584,0xf03f45d8,0xf03f4664,
+0xf03f48f8,0xf03f48f8,0xf03f4884,0xf03f4800,0xf03f48f8,0xf03f4994,0xf03f487c,0xf03f4970,
+0xf03f4994,0xf03f4970,0xf03f4a04,0xf03f4a04,0xf03f4944,0xf03f49d8,0xf03f48c0,0xf03f47bc,
+0xf03f730c,0xf03f730c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,
+0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,
+0xf03f738c,0xf03f738c,0xf03f738c,0xf03f738c,0xf03f730c,0xf03f730c,0xf03f730c,0xf03f730c,
+0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,
+0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f738c,
+0xf03f738c,0xf03f738c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,0xf03f734c,
+0xf03f734c,0xf03f734c,0xf03f734c,0xf03f765c,0xf03f765c,0xf03f77ac,0xf03f77ac,0xf03f77ac,
+0xf03f77ac,0xf03f7580,0xf03f7580,0xf03f7580,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f77ac,
+0xf03f77ac,0xf03f77ac,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f765c,0xf03f765c,0xf03f765c,
+0xf03f765c,0xf03f765c,0xf03f765c,0xf03f765c,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,
+0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,
+0xf03f77ac,0xf03f77ac,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,
+0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,
+0xf03f777c,0xf03f777c,0xf03f777c,0xf03f777c,0xf03f7530,0xf03f7530,0xf03f77ac,0xf03f77ac,
+0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f7530,
+0xf03f77ac,0xf03f77ac,0xf03f77ac,0xf03f7530,0xf03f7530,0xf03f7820,0xf03f7820,0xf03f7840,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7820,0xf03f7820,0xf03f7820,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7820,0xf03f7820,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,
+0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,0xf03f7840,
+0xf03f7840,0xf03f7840,0xf03f7820,0xf03f7820,0xf03fc0ec,0xf03fc104,0xf03fc120,0xf03fc15c,
+0xf03fc15c,0xf03fc15c,0xf03fc098,0xf03fc064,0xf03fc07c,0xf03fc098,0xf03fc0b4,0xf03fc0d0,
+0xf03fcfd8,0xf03fcd9c,0xf03fd288,0xf03fcc9c,0xf03fccbc,0xf03fccdc,0xf03fccfc,0xf03fcd1c,
+0xf03fcdfc,0xf03fcc7c,0xf03fcd5c,0xf03fd098,0xf03fcd3c,0xf03fcddc,0xf03fd2a8,0xf03fd2e8,
+0xf03fd2c8,0xf03fcdbc,0xf03fd0f8,0xf03fce7c,0xf03fcc7c,0xf03fce9c,0xf03fd328,0xf03fcedc,
+0xf03fcc7c,0xf03fcc7c,0xf03fcedc,0xf03fcf1c,0xf03fcefc,0xf03fcefc,0xf03fd328,0xf03fce5c,
+0xf03fd308,0xf03fcf5c,0xf03fcf94,0xf03fcefc,0xf03fcf3c,0xf03fcff8,0xf03fd018,0xf03fcfb4,
+0xf03fd328,0xf03fd078,0xf03fd058,0xf03fcd7c,0xf03fce1c,0xf03fcedc,0xf03fce3c,0xf03fd118,
+0xf03fd138,0xf03fd0b8,0xf03fd0d8,0xf03fd038,0xf03fd158,0xf03fd158,0xf03fd158,0xf03fd158,
+0xf03fd178,0xf03fd1d4,0xf03fcebc,0xf03fd248,0xf03fd268,0xf03fd3e4,0xf03fd484,0xf03fd4c4,
+0xf03fd464,0xf03fd444,0xf03fd404,0xf03fd544,0xf03fd524,0xf03fd504,0xf03fd564,0xf03fd424,
+0xf03fd4e4,0xf03fd4a4,0xf03fd584,0xf03fd5c4,0xf03fd5a4,0xf03fd5e4,0xf03fd604,0x0,
+0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2063,0x68616e67,0x655f676c,0x6f62616c,
+0x28290000,0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2064,0x6174615f,0x6c6f6361,
+0x6c697a65,0x0,0x45787065,0x63746564,0x206e6f6e,0x2d50726f,0x6320696e,0x20646174,
+0x615f6c6f,0x63616c69,0x7a650000,0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2074,
+0x6578745f,0x6c6f6361,0x6c697a65,0x0,0x63686563,0x6b5f6d61,0x6c6c6f63,0x0,
+0x2e540000,0x53796d62,0x6f6c2025,0x73206e65,0x76657220,0x64656669,0x6e656400,0x436f6e66,
+0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,0x6d626f6c,0x20257300,
+0x436f6e66,0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,0x6d626f6c,
+0x20257300,0x436f6e66,0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,
+0x6d626f6c,0x20257300,0x43616e6e,0x6f742075,0x7365202e,0x636f6d6d,0x206f6e20,0x70726576,
+0x696f7573,0x6c792064,0x6566696e,0x65642073,0x796d626f,0x6c202573,0x0,0x43616e6e,
+0x6f742075,0x7365202e,0x6c636f6d,0x6d206f6e,0x20707265,0x76696f75,0x736c7920,0x64656669,
+0x6e656420,0x73796d62,0x6f6c2025,0x73000000,0x2e676c6f,0x626c206d,0x75737420,0x70726563,
+0x65646520,0x74686520,0x64656669,0x6e697469,0x6f6e206f,0x66207468,0x65207379,0x6d626f6c,
+0x20257300,0x2e656e74,0x206d7573,0x74207072,0x65636564,0x65207468,0x65206465,0x66696e69,
+0x74696f6e,0x206f6620,0x74686520,0x73796d62,0x6f6c2025,0x73000000,0x73634e69,0x6c20746f,
+0x2073634e,0x696c0000,0x496e7465,0x726e616c,0x3a206261,0x64206163,0x74696f6e,0x20696e20,
+0x73796d5f,0x64656669,0x6e650000,0x25640000,0xf03fe64c,0xf03fe0f4,0xf03fe26c,0xf03fe68c,
+0xf03fe68c,0xf03fe054,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,
+0xf03fe68c,0xf03fe26c,0xf03fe68c,0xf03fe26c,0xf03fe68c,0xf03fe338,0xf03fe68c,0xf03fe68c,
+0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,
+0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe68c,0xf03fe414,0xf03fe4ec,0xf03fe5ac,
+0x4c6f6361,0x6c206c61,0x62656c20,0x6e756d62,0x65722069,0x73206f75,0x74206f66,0x2072616e,
+0x67650000,0x4e6f2073,0x75636820,0x6c616265,0x6c000000,0x546f6f20,0x6d616e79,0x206c6f63,
+0x616c206c,0x6162656c,0x73000000,0x4f766572,0x666c6f77,0x0,0x4c617267,0x65206465,
+0x63696d61,0x6c207365,0x74207369,0x676e2062,0x69740000,0x4e756d62,0x6572206f,0x7574206f,
+0x66207261,0x6e676500,0x69203e20,0x30000000,0x61733075,0x74696c2e,0x63000000,0x4261646c,
+0x79206465,0x6c696d69,0x74656420,0x6e756d65,0x72696320,0x6c697465,0x72616c00,0x48657820,
+0x64696769,0x7420696e,0x20646563,0x696d616c,0x206c6974,0x6572616c,0x0,0x4261646c,
+0x79206465,0x6c696d69,0x74656420,0x68657861,0x64656369,0x6d616c20,0x6c697465,0x72616c00,
+0x48657820,0x666c6f61,0x74696e67,0x20706f69,0x6e74206c,0x69746572,0x616c2074,0x6f6f206c,
+0x6f6e6700,0x5472756e,0x63617469,0x6e672074,0x6f6b656e,0x0,0x4d697373,0x696e6720,
+0x6578706f,0x6e656e74,0x20696e20,0x666c6f61,0x74696e67,0x2d706f69,0x6e74206c,0x69746572,
+0x616c0000,0x7a65726f,0x206c656e,0x67746820,0x73747269,0x6e670000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x206e756d,0x62657220,
+0x696e2073,0x7472696e,0x6720746f,0x6f206269,0x67000000,0x6c697465,0x72616c20,0x73747269,
+0x6e672074,0x6f6f206c,0x6f6e6700,0x4d697373,0x696e6720,0x22206174,0x20656e64,0x206f6620,
+0x73747269,0x6e670000,0x45787065,0x63746564,0x20637070,0x2d67656e,0x65726174,0x6564206c,
+0x696e6520,0x6e756d62,0x65720000,0x45787065,0x63746564,0x20637070,0x2d67656e,0x65726174,
+0x6564206c,0x696e6520,0x6e756d62,0x65720000,0x45787065,0x63746564,0x20637070,0x2d67656e,
+0x65726174,0x65642066,0x696c6520,0x6e616d65,0x0,0x5472756e,0x63617469,0x6e672063,
+0x70702d67,0x656e6572,0x61746564,0x2066696c,0x656e616d,0x65000000,0x4c696e65,0x20746f6f,
+0x206c6f6e,0x67000000,0x41646472,0x65737320,0x73796d62,0x6f6c2065,0x78706563,0x74656400,
+0x72656769,0x73746572,0x20657870,0x65637465,0x64000000,0x556e6465,0x66696e65,0x64207379,
+0x6d626f6c,0x0,0x52656769,0x73746572,0x20657870,0x65637465,0x64000000,0x52696768,
+0x74207061,0x72656e20,0x65787065,0x63746564,0x0,0x756e6465,0x66696e65,0x64207379,
+0x6d626f6c,0x20696e20,0x65787072,0x65737369,0x6f6e0000,0x53796d62,0x6f6c206d,0x75737420,
+0x68617665,0x20616273,0x6f6c7574,0x65207661,0x6c756500,0x53747269,0x6e672077,0x69746869,
+0x6e206578,0x70726573,0x73696f6e,0x206d6179,0x20686176,0x65206f6e,0x6c79206f,0x6e652063,
+0x68617261,0x63746572,0x0,0x496e7661,0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,
+0x70726573,0x73696f6e,0x0,0x52696768,0x74207061,0x72656e20,0x65787065,0x63746564,
+0x0,0x756e6465,0x66696e65,0x64207379,0x6d626f6c,0x20696e20,0x65787072,0x65737369,
+0x6f6e0000,0x53796d62,0x6f6c206d,0x75737420,0x68617665,0x20616273,0x6f6c7574,0x65207661,
+0x6c756500,0x53747269,0x6e672077,0x69746869,0x6e206578,0x70726573,0x73696f6e,0x206d6179,
+0x20686176,0x65206f6e,0x6c79206f,0x6e652063,0x68617261,0x63746572,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x45787065,
+0x63746564,0x20222922,0x20616674,0x65722062,0x61736520,0x72656769,0x73746572,0x0,
+0xf03fff70,0xf03ffaa8,0xf03ffaa8,0xf03ffa4c,0xf03ffa4c,0xf03ffaa8,0xf03ffa4c,0xf03ffa4c,
+0xf03ffa4c,0xf03ffa4c,0xf03ffa4c,0xf03ffa4c,0xf03ffaa8,0xf03ffa4c,0xf03ffaa8,0xf03ffaa8,
+0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,0xf03ffaa8,
+0xf03ffa4c,0xf03ffa4c,0xf03ffa4c,0xf03ffa4c,0xf03ffa4c,0xf0400260,0xf04000b4,0xf04000b4,
+0xf04000b4,0xf04000b4,0xf040007c,0xf0400084,0xf04000b4,0xf04000b4,0xf04000b4,0xf040008c,
+0xf04000b4,0xf04000b4,0xf04000b4,0xf04000b4,0xf04000b4,0xf04000b4,0xf04000b4,0xf0400094,
+0xf04000b4,0xf04000b4,0xf04000b4,0xf040009c,0xf04000b4,0xf04000a4,0xf04000b4,0xf04000ac,
+0xf040159c,0xf04015e8,0xf04015f4,0xf04015f4,0xf04015f4,0xf0401558,0xf04015f4,0xf04015f4,
+0xf04015f4,0xf04015f4,0xf0401568,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,
+0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015f4,0xf04015d0,
+0xf04015f4,0xf04015d8,0xf0401834,0xf04018d4,0xf0401908,0xf0401908,0xf0401908,0xf04017dc,
+0xf0401908,0xf0401908,0xf0401908,0xf0401908,0xf0401808,0xf0401908,0xf0401908,0xf0401908,
+0xf0401908,0xf0401908,0xf0401908,0xf0401908,0xf0401908,0xf0401908,0xf0401908,0xf0401908,
+0xf0401908,0xf0401860,0xf0401908,0xf040188c,0x6c616265,0x6c000000,0x2e73796d,0x0,
+0x2e676c6f,0x626c0000,0x2e63706c,0x6f616400,0x2e616c69,0x676e0000,0x2e617363,0x69690000,
+0x2e617363,0x69697a00,0x2e627974,0x65000000,0x2e636f6d,0x6d000000,0x2e6c636f,0x6d6d0000,
+0x2e646174,0x61000000,0x2e646f75,0x626c6500,0x2e66696c,0x65000000,0x2e666c6f,0x61740000,
+0x2e68616c,0x66000000,0x2e637072,0x6573746f,0x72650000,0x2e677077,0x6f726400,0x2e637061,
+0x64640000,0x2e776561,0x6b657874,0x0,0x2e6c6f6f,0x706e6f00,0x2e737061,0x63650000,
+0x2e746578,0x74000000,0x2e776f72,0x64000000,0x6f636f64,0x65000000,0x2e656e64,0x0,
+0x2e736461,0x74610000,0x2e726461,0x74610000,0x2e656e74,0x0,0x2e6c6f63,0x0,
+0x2e62676e,0x62000000,0x2e656e64,0x62000000,0x2e61736d,0x30000000,0x2e736574,0x0,
+0x2e637061,0x6c696173,0x0,0x2e726570,0x65617400,0x2e656e64,0x72000000,0x2e6c6162,
+0x0,0x2e767265,0x67000000,0x2e6d6173,0x6b000000,0x2e666d61,0x736b0000,0x2e657272,
+0x0,0x676c6f62,0x61627300,0x2e766572,0x7374616d,0x70000000,0x2e667261,0x6d650000,
+0x2e657874,0x656e6465,0x64000000,0x2e657874,0x65726e00,0x2e61656e,0x74000000,0x2e6f7074,
+0x696f6e00,0x2e6e6f61,0x6c696173,0x0,0x2e616c69,0x61730000,0x2e6d7461,0x67000000,
+0x2e6d616c,0x69617300,0x2e737472,0x75637400,0x2e6c6976,0x65726567,0x0,0x2e676a61,
+0x6c646566,0x0,0x2e676a61,0x6c6c6976,0x65000000,0x2e676a72,0x6c697665,0x0,
+0x2e697368,0x6966745f,0x61646472,0x0,0x2e697265,0x73746578,0x74000000,0x2e64776f,
+0x72640000,0x2e70726f,0x6c6f6775,0x65000000,0x2e656461,0x74610000,0x2e616c6c,0x6f630000,
+0x24300000,0x24310000,0x24320000,0x24330000,0x24340000,0x24350000,0x24360000,0x24370000,
+0x24380000,0x24390000,0x24313000,0x24313100,0x24313200,0x24313300,0x24313400,0x24313500,
+0x24313600,0x24313700,0x24313800,0x24313900,0x24323000,0x24323100,0x24323200,0x24323300,
+0x24323400,0x24323500,0x24323600,0x24323700,0x24323800,0x24323900,0x24333000,0x24333100,
+0x24663000,0x24663100,0x24663200,0x24663300,0x24663400,0x24663500,0x24663600,0x24663700,
+0x24663800,0x24663900,0x24663130,0x0,0x24663131,0x0,0x24663132,0x0,
+0x24663133,0x0,0x24663134,0x0,0x24663135,0x0,0x24663136,0x0,
+0x24663137,0x0,0x24663138,0x0,0x24663139,0x0,0x24663230,0x0,
+0x24663231,0x0,0x24663232,0x0,0x24663233,0x0,0x24663234,0x0,
+0x24663235,0x0,0x24663236,0x0,0x24663237,0x0,0x24663238,0x0,
+0x24663239,0x0,0x24663330,0x0,0x24663331,0x0,0x24666363,0x30000000,
+0x24666363,0x31000000,0x24666363,0x32000000,0x24666363,0x33000000,0x24666363,0x34000000,
+0x24666363,0x35000000,0x24666363,0x36000000,0x24666363,0x37000000,0x20202000,0x66726f62,
+0x0,0x66726100,0x66726900,0x66727272,0x0,0x66727269,0x0,0x66727200,
+0x66610000,0x66720000,0x6672726c,0x0,0x66726c00,0x666c0000,0x666f7272,0x72000000,
+0x6672696c,0x0,0x66690000,0x666f6100,0x66727272,0x72000000,0x6e6f6e65,0x0,
+0x6f707469,0x6d697a65,0x0,0x70696300,0x0,0x72656f72,0x64657200,0x6e6f7265,
+0x6f726465,0x72000000,0x6d616372,0x6f000000,0x6e6f6d61,0x63726f00,0x61740000,0x6e6f6174,
+0x0,0x6d6f7665,0x0,0x6e6f6d6f,0x76650000,0x626f7074,0x0,0x6e6f626f,
+0x70740000,0x766f6c61,0x74696c65,0x0,0x6e6f766f,0x6c617469,0x6c650000,0x7472616e,
+0x73666f72,0x6d000000,0x6e6f7472,0x616e7366,0x6f726d00,0x7265706f,0x73697469,0x6f6e0000,
+0x6e6f7265,0x706f7369,0x74696f6e,0x0,0x6672616e,0x6f6e6500,0x66726168,0x69000000,
+0x6672616c,0x6f000000,0x66726172,0x656c3100,0x66726172,0x656c3200,0x24667261,0x6d657265,
+0x67000000,0x24667261,0x6d657369,0x7a650000,0x61627300,0x61646400,0x61646475,0x0,
+0x616e6400,0x62000000,0x62633066,0x0,0x62633074,0x0,0x62633166,0x0,
+0x62633174,0x0,0x62633266,0x0,0x62633274,0x0,0x0,0x0,
+0x62657100,0x62676500,0x62676575,0x0,0x6267657a,0x0,0x62677400,0x62677475,
+0x0,0x6267747a,0x0,0x626c6500,0x626c6575,0x0,0x626c657a,0x0,
+0x626c7400,0x626c7475,0x0,0x626c747a,0x0,0x626e6500,0x62726561,0x6b000000,
+0x63300000,0x63310000,0x63320000,0x0,0x64697600,0x64697675,0x0,0x6a000000,
+0x6a616c00,0x6c610000,0x6c620000,0x6c627500,0x6c680000,0x6c687500,0x6c690000,0x6c770000,
+0x6a720000,0x6c776331,0x0,0x6c776332,0x0,0x70726566,0x0,0x6d666869,
+0x0,0x6d666c6f,0x0,0x6d6f7665,0x0,0x6a616c72,0x0,0x73776331,
+0x0,0x73776332,0x0,0x0,0x6d746869,0x0,0x6d746c6f,0x0,
+0x6d756c00,0x6d756c6f,0x0,0x6d756c6f,0x75000000,0x6d756c74,0x0,0x6d756c74,
+0x75000000,0x6e656700,0x6e6f7000,0x6e6f7200,0x6f720000,0x72656d00,0x72656d75,0x0,
+0x72666500,0x726f6c00,0x726f7200,0x73620000,0x73657100,0x73676500,0x73676575,0x0,
+0x73677400,0x73677475,0x0,0x73680000,0x736c6500,0x736c6575,0x0,0x736c6c00,
+0x736c7400,0x736c7475,0x0,0x736e6500,0x73726100,0x73726c00,0x73756200,0x73756275,
+0x0,0x73770000,0x73797363,0x616c6c00,0x786f7200,0x6e6f7400,0x6c776c00,0x6c777200,
+0x73776c00,0x73777200,0x0,0x6d666330,0x0,0x6d666331,0x0,0x6d666332,
+0x0,0x0,0x6d746330,0x0,0x6d746331,0x0,0x6d746332,0x0,
+0x73796e63,0x0,0x746c6272,0x0,0x746c6277,0x69000000,0x746c6277,0x72000000,
+0x746c6270,0x0,0x6c640000,0x73640000,0x0,0x6c646331,0x0,0x6c646332,
+0x0,0x746c6272,0x31000000,0x746c6270,0x31000000,0x73646331,0x0,0x73646332,
+0x0,0x0,0x6c2e7300,0x6c2e6400,0x6c2e6500,0x732e7300,0x732e6400,0x732e6500,
+0x6164642e,0x73000000,0x6164642e,0x64000000,0x6164642e,0x65000000,0x7375622e,0x73000000,
+0x7375622e,0x64000000,0x7375622e,0x65000000,0x6d756c2e,0x73000000,0x6d756c2e,0x64000000,
+0x6d756c2e,0x65000000,0x6469762e,0x73000000,0x6469762e,0x64000000,0x6469762e,0x65000000,
+0x73717274,0x2e730000,0x73717274,0x2e640000,0x73717274,0x2e650000,0x6d6f762e,0x73000000,
+0x6d6f762e,0x64000000,0x6d6f762e,0x65000000,0x6162732e,0x73000000,0x6162732e,0x64000000,
+0x6162732e,0x65000000,0x6376742e,0x732e6400,0x6376742e,0x732e6500,0x6376742e,0x732e7700,
+0x6376742e,0x642e7300,0x6376742e,0x642e6500,0x6376742e,0x642e7700,0x6376742e,0x652e7300,
+0x6376742e,0x652e6400,0x6376742e,0x652e7700,0x6376742e,0x772e7300,0x6376742e,0x772e6400,
+0x6376742e,0x772e6500,0x632e662e,0x73000000,0x632e662e,0x64000000,0x632e662e,0x65000000,
+0x632e756e,0x2e730000,0x632e756e,0x2e640000,0x632e756e,0x2e650000,0x632e6571,0x2e730000,
+0x632e6571,0x2e640000,0x632e6571,0x2e650000,0x632e7565,0x712e7300,0x632e7565,0x712e6400,
+0x632e7565,0x712e6500,0x632e6f6c,0x742e7300,0x632e6f6c,0x742e6400,0x632e6f6c,0x742e6500,
+0x632e756c,0x742e7300,0x632e756c,0x742e6400,0x632e756c,0x742e6500,0x632e6f6c,0x652e7300,
+0x632e6f6c,0x652e6400,0x632e6f6c,0x652e6500,0x632e756c,0x652e7300,0x632e756c,0x652e6400,
+0x632e756c,0x652e6500,0x632e7366,0x2e730000,0x632e7366,0x2e640000,0x632e7366,0x2e650000,
+0x632e6e67,0x6c652e73,0x0,0x632e6e67,0x6c652e64,0x0,0x632e6e67,0x6c652e65,
+0x0,0x632e7365,0x712e7300,0x632e7365,0x712e6400,0x632e7365,0x712e6500,0x632e6e67,
+0x6c2e7300,0x632e6e67,0x6c2e6400,0x632e6e67,0x6c2e6500,0x632e6c74,0x2e730000,0x632e6c74,
+0x2e640000,0x632e6c74,0x2e650000,0x632e6e67,0x652e7300,0x632e6e67,0x652e6400,0x632e6e67,
+0x652e6500,0x632e6c65,0x2e730000,0x632e6c65,0x2e640000,0x632e6c65,0x2e650000,0x632e6e67,
+0x742e7300,0x632e6e67,0x742e6400,0x632e6e67,0x742e6500,0x6c756900,0x756c7700,0x756c6800,
+0x756c6875,0x0,0x75737700,0x75736800,0x61646469,0x0,0x61646469,0x75000000,
+0x736c7469,0x0,0x736c7469,0x75000000,0x616e6469,0x0,0x6f726900,0x786f7269,
+0x0,0x0,0x6e656775,0x0,0x6265717a,0x0,0x626e657a,0x0,
+0x6e65672e,0x73000000,0x6e65672e,0x64000000,0x6e65672e,0x65000000,0x63666331,0x0,
+0x63746331,0x0,0x62616c00,0x6267657a,0x616c0000,0x626c747a,0x616c0000,0x6d746331,
+0x2e640000,0x6d666331,0x2e640000,0x7472756e,0x632e772e,0x73000000,0x7472756e,0x632e772e,
+0x64000000,0x7472756e,0x632e772e,0x65000000,0x726f756e,0x642e772e,0x73000000,0x726f756e,
+0x642e772e,0x64000000,0x726f756e,0x642e772e,0x65000000,0x6164646f,0x75000000,0x7375626f,
+0x75000000,0x7472756e,0x63752e77,0x2e730000,0x7472756e,0x63752e77,0x2e640000,0x7472756e,
+0x63752e77,0x2e650000,0x726f756e,0x64752e77,0x2e730000,0x726f756e,0x64752e77,0x2e640000,
+0x726f756e,0x64752e77,0x2e650000,0x63666330,0x0,0x63666332,0x0,0x0,
+0x63746330,0x0,0x63746332,0x0,0x0,0x6c692e73,0x0,0x6c692e64,
+0x0,0x6c692e65,0x0,0x746c7400,0x746c7475,0x0,0x74676500,0x74676575,
+0x0,0x74657100,0x746e6500,0x6c6c0000,0x73630000,0x6365696c,0x2e772e73,0x0,
+0x6365696c,0x2e772e64,0x0,0x6365696c,0x2e772e65,0x0,0x6365696c,0x752e772e,
+0x73000000,0x6365696c,0x752e772e,0x64000000,0x6365696c,0x752e772e,0x65000000,0x666c6f6f,
+0x722e772e,0x73000000,0x666c6f6f,0x722e772e,0x64000000,0x666c6f6f,0x722e772e,0x65000000,
+0x666c6f6f,0x72752e77,0x2e730000,0x666c6f6f,0x72752e77,0x2e640000,0x666c6f6f,0x72752e77,
+0x2e650000,0x6265716c,0x0,0x6265717a,0x6c000000,0x626e656c,0x0,0x626e657a,
+0x6c000000,0x626c656c,0x0,0x626c6575,0x6c000000,0x626c657a,0x6c000000,0x6267746c,
+0x0,0x62677475,0x6c000000,0x6267747a,0x6c000000,0x626c746c,0x0,0x626c7475,
+0x6c000000,0x626c747a,0x6c000000,0x626c747a,0x616c6c00,0x6267656c,0x0,0x62676575,
+0x6c000000,0x6267657a,0x6c000000,0x6267657a,0x616c6c00,0x62633066,0x6c000000,0x62633074,
+0x6c000000,0x62633166,0x6c000000,0x62633174,0x6c000000,0x62633266,0x6c000000,0x62633274,
+0x6c000000,0x0,0x0,0x6c646c00,0x6c647200,0x6c6c6400,0x6c777500,0x73646c00,
+0x73647200,0x73636400,0x64616464,0x69000000,0x64616464,0x69750000,0x64616464,0x0,
+0x64616464,0x75000000,0x64737562,0x0,0x64737562,0x75000000,0x64736c6c,0x0,
+0x6473726c,0x0,0x64737261,0x0,0x64736c6c,0x76000000,0x6473726c,0x76000000,
+0x64737261,0x76000000,0x646d756c,0x74000000,0x646d756c,0x74750000,0x64646976,0x0,
+0x64646976,0x75000000,0x0,0x0,0x646d7463,0x31000000,0x646d6663,0x31000000,
+0x646d7463,0x30000000,0x646d6663,0x30000000,0x646d7463,0x32000000,0x646d6663,0x32000000,
+0x646c6900,0x646c6100,0x65726574,0x0,0x7472756e,0x632e6c2e,0x73000000,0x726f756e,
+0x642e6c2e,0x73000000,0x6365696c,0x2e6c2e73,0x0,0x666c6f6f,0x722e6c2e,0x73000000,
+0x7472756e,0x632e6c2e,0x64000000,0x726f756e,0x642e6c2e,0x64000000,0x6365696c,0x2e6c2e64,
+0x0,0x666c6f6f,0x722e6c2e,0x64000000,0x7472756e,0x632e6c2e,0x65000000,0x726f756e,
+0x642e6c2e,0x65000000,0x6365696c,0x2e6c2e65,0x0,0x666c6f6f,0x722e6c2e,0x65000000,
+0x6376742e,0x6c2e7300,0x6376742e,0x6c2e6400,0x6376742e,0x6c2e6500,0x6376742e,0x6c2e7700,
+0x6376742e,0x732e6c00,0x6376742e,0x642e6c00,0x6376742e,0x652e6c00,0x6376742e,0x772e6c00,
+0x63616368,0x65000000,0x63696100,0x756c6400,0x75736400,0x64616273,0x0,0x646e6567,
+0x0,0x646e6567,0x75000000,0x646d756c,0x0,0x646d756c,0x6f000000,0x646d756c,
+0x6f750000,0x6472656d,0x0,0x6472656d,0x75000000,0x64726f6c,0x0,0x64726f72,
+0x0,0x64616464,0x6f750000,0x64737562,0x6f750000,0x756c7775,0x0,0x6d6f7674,
+0x0,0x6d6f7666,0x0,0x6d6f766e,0x0,0x6d6f767a,0x0,0x6d616464,
+0x2e730000,0x6d616464,0x2e640000,0x6d616464,0x2e650000,0x6d737562,0x2e730000,0x6d737562,
+0x2e640000,0x6d737562,0x2e650000,0x6e6d6164,0x642e7300,0x6e6d6164,0x642e6400,0x6e6d6164,
+0x642e6500,0x6e6d7375,0x622e7300,0x6e6d7375,0x622e6400,0x6e6d7375,0x622e6500,0x72656369,
+0x702e7300,0x72656369,0x702e6400,0x72737172,0x742e7300,0x72737172,0x742e6400,0x6d6f7674,
+0x2e730000,0x6d6f7674,0x2e640000,0x6d6f7666,0x2e730000,0x6d6f7666,0x2e640000,0x6d6f766e,
+0x2e730000,0x6d6f766e,0x2e640000,0x6d6f767a,0x2e730000,0x6d6f767a,0x2e640000,0x6c777863,
+0x31000000,0x6c647863,0x31000000,0x73777863,0x31000000,0x73647863,0x31000000,0x70726566,
+0x78000000,0x64637472,0x0,0x64637477,0x0,0x746c6277,0x0,0x6e616461,
+0x0,0x73736e6f,0x70000000,0x64736c6c,0x33320000,0x6473726c,0x33320000,0x64737261,
+0x33320000,0x62633366,0x0,0x62633374,0x0,0x63330000,0x6c776333,0x0,
+0x73776333,0x0,0x6d666333,0x0,0x6d746333,0x0,0x63666333,0x0,
+0x63746333,0x0,0x736c6c76,0x0,0x73726c76,0x0,0x73726176,0x0,
+0x6d667063,0x0,0x6d747063,0x0,0x6d667073,0x0,0x6d747073,0x0,
+0x0,0x0,0x0,0x0,0x25640000,0x6c69626d,0x6c642d2d,0x0,
+0xa000000,0xa6c6962,0x6d6c642d,0x2d000000,0xa000000,0x6c69626d,0x6c642d2d,0x0,
+0xa000000,0x0,0x0,0x0,0x496e7465,0x726e616c,0x0,0x4572726f,
+0x72000000,0x5761726e,0x696e6700,0x496e666f,0x0,0x0,0xa000000,0x25730000,
+0x6173303a,0x20000000,0x25733a20,0x0,0x25730000,0x2c206c69,0x6e652025,0x31643a00,
+0x25730000,0x3a202573,0xa000000,0xa000000,0x20202020,0x2025730a,0x0,0x25730a00,
+0x25732c20,0x6c696e65,0x20253164,0x3a0a0000,0x20202020,0x61737365,0x7274696f,0x6e202825,
+0x73292066,0x61696c65,0x640a0000,0x2d454200,0x2d454c00,0x2d470000,0x2d4b0000,0x2d4d0000,
+0x2d4e5200,0x2d4f0000,0x2d4f3000,0x2d4f3100,0x2d4f3200,0x2d4f3300,0x2d4f3400,0x2d4f6c69,
+0x6d697400,0x2d520000,0x2d524400,0x2d540000,0x2d650000,0x2d666c69,0x0,0x2d660000,
+0x2d663000,0x2d663100,0x2d663200,0x2d663300,0x2d663400,0x2d670000,0x2d673000,0x2d673100,
+0x2d673200,0x2d673300,0x2d6c0000,0x2d6f0000,0x2d700000,0x2d703000,0x2d703100,0x2d703200,
+0x2d703300,0x2d720000,0x2d740000,0x2d760000,0x2d770000,0x2d773100,0x2d773200,0x2d773300,
+0x2d6e6f5f,0x636f6e73,0x745f6f70,0x74730000,0x2d6e6f5f,0x6c75695f,0x6f707473,0x0,
+0x2d6e6f5f,0x6469765f,0x72656d5f,0x6f707473,0x0,0x2d6e6f5f,0x61745f63,0x6f6d7072,
+0x65737369,0x6f6e0000,0x2d6e6f5f,0x6272616e,0x63685f74,0x61726765,0x74000000,0x2d6d6970,
+0x73310000,0x2d6d6970,0x73320000,0x2d6d6970,0x73330000,0x2d6d6970,0x73340000,0x2d6e6f70,
+0x6f6f6c00,0x2d616c69,0x676e3800,0x2d616c69,0x676e3136,0x0,0x2d616c69,0x676e3332,
+0x0,0x2d616c69,0x676e3634,0x0,0x2d616c69,0x676e5f63,0x6f6d6d6f,0x6e000000,
+0x2d67705f,0x7761726e,0x0,0x2d6e6f6e,0x5f706963,0x0,0x2d723330,0x30300000,
+0x2d723430,0x30300000,0x2d723630,0x30300000,0x2d723630,0x30304c48,0x55000000,0x2d723630,
+0x30304c57,0x4c000000,0x2d747261,0x70757600,0x2d6e6f70,0x65657000,0x2d706565,0x70646267,
+0x0,0x2d6e6f73,0x77706970,0x65000000,0x2d737770,0x64626700,0x2d6e6f73,0x796d7265,
+0x67730000,0x2d6e6f78,0x62620000,0x2d616767,0x725f7862,0x62000000,0x2d786262,0x64626700,
+0x2d6e6577,0x68696c6f,0x0,0x2d646f6d,0x74616700,0x2d667073,0x74616c6c,0x5f6e6f70,
+0x0,0x2d6e6f67,0x6c6f6261,0x6c000000,0x2d6e6f62,0x6f707400,0x2d647761,0x6c69676e,
+0x0,0x2d657863,0x70740000,0x2d646961,0x67000000,0x2d6d6564,0x6e617400,0x2d64776f,
+0x70636f64,0x65000000,0x2d363462,0x69740000,0x2d667033,0x32726567,0x0,0x2d657874,
+0x73796d73,0x0,0x2d706963,0x30000000,0x2d706963,0x31000000,0x2d706963,0x32000000,
+0x2d626967,0x5f676f74,0x0,0x2d636f66,0x66000000,0x2d656c66,0x0,0x2d6d7363,
+0x6f666600,0x2d6d7363,0x6f666631,0x0,0x2d6d756c,0x74695f69,0x73737565,0x0,
+0x2d6e6f6e,0x7a65726f,0x5f73636e,0x62617365,0x0,0x2d6e6577,0x5f6d6465,0x62756700,
+0x2d616269,0x0,0x2d746670,0x72657631,0x30000000,0x2d666f72,0x63655f62,0x72616e63,
+0x685f6669,0x78757000,0x2d723432,0x30300000,0x2d723436,0x30300000,0x2d746670,0x0,
+0x2d723433,0x30305f6d,0x756c0000,0x0,0x73745f63,0x75696e69,0x743a2063,0x616e6e6f,
+0x7420616c,0x6c6f6361,0x74652063,0x75727265,0x6e742063,0x6864720a,0x0,0x73745f65,
+0x78746164,0x643a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,0x6578745f,0x69657874,
+0x3a20696e,0x64657820,0x6f757420,0x6f662072,0x616e6765,0x20282564,0x290a0000,0x73745f69,
+0x646e5f69,0x6e646578,0x5f666578,0x743a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,
+0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,
+0x646e5f69,0x646e3a20,0x69646e20,0x28256429,0x206c6573,0x73207468,0x616e2030,0x206f7220,
+0x67726561,0x74657220,0x7468616e,0x206d6178,0x20282564,0x290a0000,0x0,0x0,
+0x73745f70,0x6366645f,0x6966643a,0x20696664,0x20282564,0x29206f75,0x74206f66,0x2072616e,
+0x67650a00,0x73745f70,0x73796d5f,0x6966645f,0x6973796d,0x3a206966,0x64202825,0x6429206f,
+0x72206973,0x796d2028,0x25642920,0x6f757420,0x6f662072,0x616e6765,0xa000000,0x73745f70,
+0x6175785f,0x69617578,0x3a206961,0x75782028,0x25642920,0x6f757420,0x6f662072,0x616e6765,
+0xa000000,0x0,0x0,0x0,0x25733a20,0x496e7465,0x726e616c,0x3a200000,
+0xa000000,0x25733a20,0x4572726f,0x723a2000,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662031,0x20627974,
+0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662025,0x6c642062,
+0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,0x5f6d645f,0x73745f6d,
+0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,0x6c642062,
+0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,0x0,
+0x73745f66,0x696c6562,0x6567696e,0x3a207472,0x69656420,0x746f2065,0x6e642074,0x6f6f206d,
+0x616e7920,0x66696c65,0x73202825,0x73290a00,0x73745f74,0x65787462,0x6c6f636b,0x3a20626c,
+0x6f636b20,0x70656e64,0x696e6720,0x73657420,0x696e2069,0x6c6c6567,0x616c2063,0x6173650a,
+0x0,0x73745f66,0x696c655f,0x69646e3a,0x20697374,0x61636b20,0x756e6465,0x72666c6f,
+0x77202825,0x73290a00,0x0,0x0,0x74726965,0x6420746f,0x20726570,0x6c616365,
+0x20726e64,0x78206175,0x78202825,0x64292074,0x68617420,0x66697473,0x20696e74,0x6f206f6e,
+0x6520776f,0x72642028,0x25642c20,0x25642920,0x77697468,0x206f6e65,0x20746861,0x74206361,
+0x6e277420,0x2825642c,0x2564290a,0x0,0x73745f66,0x64616464,0x3a206e75,0x6d626572,
+0x206f6620,0x66696c65,0x73202825,0x64292065,0x78636565,0x6473206d,0x61782028,0x2564290a,
+0x0,0x73745f66,0x64616464,0x3a20616c,0x6c6f6361,0x74696f6e,0x20626f74,0x63682028,
+0x25642066,0x64732061,0x6e642025,0x64206366,0x64732920,0x696e2025,0x730a0000,0x0,
+0x3c2f3444,0x65627567,0x2f3e0000,0x3a000000,0x3a000000,0x73745f66,0x64616464,0x3a20636f,
+0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,0x6e616d65,0x21212025,0x640a0000,
+0x73745f66,0x64616464,0x3a20636f,0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,
+0x6e616d65,0x21202564,0xa000000,0x43616e6e,0x6f742073,0x745f6664,0x6164643a,0x2063616e,
+0x6e6f7420,0x6d616c6c,0x6f632025,0x64206279,0x74657320,0x746f2068,0x6f6c6420,0x66696c65,
+0x206e616d,0x650a0000,0x2f000000,0x256c7500,0x2d310000,0x256c7500,0x73745f73,0x74726164,
+0x643a2061,0x7267756d,0x656e7420,0x6973206e,0x696c0a00,0x73745f70,0x6175785f,0x6966645f,
+0x69617578,0x3a206966,0x64202825,0x6429206f,0x72206961,0x75782028,0x25642920,0x6f757420,
+0x6f662072,0x616e6765,0xa000000,0x73745f70,0x6175785f,0x6966645f,0x69617578,0x3a206966,
+0x64202825,0x6429206f,0x7220696c,0x696e6520,0x28256429,0x206f7574,0x206f6620,0x72616e67,
+0x650a0000,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,
+0x74656d20,0x6f662031,0x20627974,0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,
+0x6f662025,0x6c642062,0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,
+0x6c642062,0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,
+0x73745f65,0x78747374,0x72616464,0x3a20796f,0x75206469,0x646e2774,0x20696e69,0x7469616c,
+0x697a6520,0x77697468,0x20637569,0x6e697420,0x6f722072,0x65616473,0x740a0000,0x73745f65,
+0x78747374,0x72616464,0x3a206172,0x67756d65,0x6e742069,0x73206e69,0x6c0a0000,0x73745f69,
+0x646e5f64,0x6e3a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f69,0x646e5f72,0x6e64783a,
+0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x6375696e,
+0x6974206f,0x72207265,0x61647374,0xa000000,0x73745f72,0x6e64785f,0x69646e3a,0x2069646e,
+0x20282564,0x29206772,0x65617465,0x72207468,0x616e206d,0x61782028,0x2564290a,0x0,
+0x73745f72,0x6e64785f,0x69646e3a,0x206f6c64,0x20696e74,0x65726661,0x63652063,0x616e2774,
+0x20707574,0x20726664,0x28256429,0x20696e74,0x6f20726e,0x64782c20,0x75736520,0x73745f70,
+0x646e5f69,0x646e2069,0x6e737465,0x61640a00,0x73745f73,0x65746964,0x6e3a2069,0x646e7372,
+0x63202825,0x6429206f,0x72206964,0x6e646573,0x74202825,0x6429206f,0x7574206f,0x66207261,
+0x6e67650a,0x0,0x73745f70,0x6578745f,0x646e3a20,0x72666420,0x6669656c,0x64202825,
+0x64292069,0x736e2774,0x20657175,0x616c2074,0x6f205354,0x5f455854,0x49464428,0x2564290a,
+0x0,0x73745f70,0x6578745f,0x646e3a20,0x696e6465,0x78206f75,0x74206f66,0x2072616e,
+0x67652028,0x2564290a,0x0,0x6c69626d,0x6c640000,0x6c69626d,0x6c643a20,0x496e7465,
+0x726e616c,0x3a206361,0x6e6e6f74,0x20616c6c,0x6f636174,0x6520746f,0x20696e69,0x7469616c,
+0x697a6520,0x636f6d70,0x6f6e656e,0x74206e61,0x6d652066,0x6f72206c,0x69626d6c,0x64206572,
+0x726f7273,0xa000000,0x0,0x0,0x62616420,0x6d616769,0x6320696e,0x20686472,
+0x2e206578,0x70656374,0x65642030,0x7825782c,0x20676f74,0x20307825,0x780a0000,0x73745f72,
+0x65616473,0x743a2064,0x656e7365,0x206e756d,0x62657220,0x696e636f,0x6d706174,0x69626c65,
+0x2066726f,0x6d207665,0x7273696f,0x6e73206c,0x65737320,0x7468616e,0x20312e33,0x302c2070,
+0x6c656173,0x65207265,0x636f6d70,0x696c6520,0x66726f6d,0x20736372,0x61746368,0x20616e64,
+0x20757365,0x20636f6d,0x70617469,0x626c6520,0x636f6d70,0x6f6e656e,0x74730a00,0x73745f72,
+0x6561643a,0x20657272,0x6f722073,0x65656b69,0x6e670a00,0x73745f72,0x6561643a,0x20657272,
+0x6f722072,0x65616469,0x6e670a00,0x63616e6e,0x6f74206f,0x70656e20,0x73796d62,0x6f6c2074,
+0x61626c65,0x2066696c,0x65202573,0xa000000,0x77000000,0x73745f77,0x72697465,0x73743a20,
+0x63616e6e,0x6f742077,0x72697465,0x20746f20,0x66696c65,0x206e756d,0x62657220,0x25640a00,
+0x63616e6e,0x6f742077,0x72697465,0x20726f75,0x6e642062,0x79746573,0x20666f72,0x206c696e,
+0x65730a00,0x63616e6e,0x6f742077,0x72697465,0x20726f75,0x6e642062,0x79746573,0x20666f72,
+0x20737472,0x696e6773,0xa000000,0x63616e6e,0x6f742077,0x72697465,0x20726f75,0x6e642062,
+0x79746573,0x20666f72,0x20737472,0x696e6773,0xa000000,0x63616e6e,0x6f742077,0x72697465,
+0x2073796d,0x626f6c20,0x68656164,0x65720a00,0x73776170,0x206f6620,0x61757873,0x206e6f74,
+0x20737570,0x706f7274,0x65642077,0x68656e20,0x64657374,0x73657820,0x213d2068,0x6f737473,
+0x65780a00,0xf040c608,0xf040c724,0xf040c79c,0xf040c79c,0xf040c79c,0xf040c79c,0xf040c79c,
+0x40282329,0x24486561,0x6465723a,0x20495249,0x5820352e,0x333a3130,0x32323637,0x30383230,
+0x20627569,0x6c742030,0x312f3138,0x2f393620,0x61742070,0x69676865,0x6172743a,0x2f676972,
+0x6465722f,0x70617463,0x6865732f,0x31313138,0x2f726f6f,0x74202400,0x0,0x0,
+};
+static const uint32_t data[] = {
+0x0,0x10004c80,0x10004c84,0x10004c90,0x10004c9c,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x10006a40,0x10006a48,0x10006a50,0x10006a58,
+0x10006a60,0x10006a68,0x10006a70,0x10006a78,0x10006a80,0x10006a88,0x10006a90,0x10006a98,
+0x10006aa0,0x10006aa8,0x10006ab0,0x10006ab8,0x10006ac4,0x10006acc,0x10006ad4,0x10006ae0,
+0x10006ae8,0x10006af0,0x10006af8,0x10006b00,0x10006b08,0x10006b10,0x10006b18,0x10006b20,
+0x10006b28,0x10006b30,0x10006b38,0x10006b40,0x10006b48,0x10006b50,0x10006b5c,0x10006b64,
+0x10006b6c,0x10006b74,0x10006b7c,0x10006b84,0x10006b8c,0x10006b94,0x10006b9c,0x10006ba8,
+0x10006bb0,0x10006bbc,0x10006bc4,0x10006bcc,0x10006bd4,0x10006be0,0x10006be8,0x10006bf0,
+0x10006bf8,0x10006c00,0x10006c0c,0x10006c18,0x10006c24,0x10006c30,0x10006c40,0x10006c4c,
+0x10006c54,0x10006c60,0x10006c68,0x10006c70,0x10006c74,0x10006c78,0x10006c7c,0x10006c80,
+0x10006c84,0x10006c88,0x10006c8c,0x10006c90,0x10006c94,0x10006c98,0x10006c9c,0x10006ca0,
+0x10006ca4,0x10006ca8,0x10006cac,0x10006cb0,0x10006cb4,0x10006cb8,0x10006cbc,0x10006cc0,
+0x10006cc4,0x10006cc8,0x10006ccc,0x10006cd0,0x10006cd4,0x10006cd8,0x10006cdc,0x10006ce0,
+0x10006ce4,0x10006ce8,0x10006cec,0x10006cf0,0x10006cf4,0x10006cf8,0x10006cfc,0x10006d00,
+0x10006d04,0x10006d08,0x10006d0c,0x10006d10,0x10006d14,0x10006d18,0x10006d20,0x10006d28,
+0x10006d30,0x10006d38,0x10006d40,0x10006d48,0x10006d50,0x10006d58,0x10006d60,0x10006d68,
+0x10006d70,0x10006d78,0x10006d80,0x10006d88,0x10006d90,0x10006d98,0x10006da0,0x10006da8,
+0x10006db0,0x10006db8,0x10006dc0,0x10006dc8,0x10006dd0,0x10006dd8,0x10006de0,0x10006de8,
+0x10006df0,0x10006df8,0x10006e00,0x10006e08,0x10006e0c,0x10006e14,0x10006e18,0x10006e1c,
+0x10006e24,0x10006e2c,0x10006e30,0x10006e34,0x10006e38,0x10006e40,0x10006e44,0x10006e48,
+0x10006e50,0x10006e58,0x10006e5c,0x10006e60,0x10006e68,0x10006e70,0x10006e7c,0x10006e80,
+0x10006e84,0x10006e8c,0x10006e98,0x10006ea0,0x10006ea8,0x10006eac,0x10006eb4,0x10006ebc,
+0x10006ec4,0x10006ecc,0x10006ed4,0x10006ee0,0x10006eec,0x10006ef8,0x10006f04,0x10006f10,
+0x10006f20,0x10006f28,0x10006f30,0x10006f38,0x10006f40,0x0,0x0,0x10006f48,
+0x10006f54,0x10006f60,0x8000420,0x10006f64,0x60a0421,0x10006f68,0x60a8421,0x10006f70,
+0x60c0421,0x10006f74,0x10000000,0x10006f78,0x101c8000,0x10006f80,0x101d0000,0x10006f88,
+0x101db000,0x10006f90,0x101e3000,0x10006f98,0x101e8000,0x10006fa0,0x101f0000,0x10006fa8,
+0x0,0x10006fac,0x0,0x10006fb0,0xc258420,0x10006fb4,0xc000420,0x10006fb8,
+0xc000420,0x10006fc0,0xe1b0400,0x10006fc8,0xc000420,0x10006fcc,0xc000420,0x10006fd4,
+0xe270400,0x10006fdc,0xc000420,0x10006fe0,0xc000420,0x10006fe8,0xe268400,0x10006ff0,
+0xc000420,0x10006ff4,0xc000420,0x10006ffc,0xe1a8400,0x10007004,0xc260420,0x10007008,
+0x58000,0x10007010,0x12318000,0x10007014,0x12320000,0x10007018,0x12328000,0x1000701c,
+0x0,0x10007020,0x6090421,0x10007024,0x6098421,0x1000702c,0xa248400,0x10007030,
+0xa250400,0x10007034,0x2000400,0x10007038,0x2330460,0x1000703c,0x2350460,0x10007040,
+0x2338460,0x10007044,0x2358460,0x10007048,0x4000400,0x1000704c,0x2348460,0x10007050,
+0xa040400,0x10007054,0x2399060,0x1000705c,0x23a0460,0x10007064,0x1e9e0460,0x1000706c,
+0x14060400,0x10007074,0x14070400,0x1000707c,0x8000420,0x10007084,0xa048400,0x1000708c,
+0x23b1060,0x10007094,0x23b8460,0x1000709c,0x0,0x100070a0,0x14068400,0x100070a8,
+0x14078400,0x100070b0,0x6000421,0x100070b4,0x6000421,0x100070bc,0x6000421,0x100070c4,
+0x8080420,0x100070cc,0x8088420,0x100070d4,0x8000420,0x100070d8,0x8000,0x100070dc,
+0x60d8421,0x100070e0,0x60c8421,0x100070e4,0x6090421,0x100070e8,0x6098421,0x100070f0,
+0x498000,0x100070f4,0x6000421,0x100070f8,0x6000421,0x100070fc,0x2368460,0x10007100,
+0x6000421,0x10007104,0x6000421,0x10007108,0x6000421,0x10007110,0x6000421,0x10007114,
+0x6000421,0x1000711c,0x2370460,0x10007120,0x6000421,0x10007124,0x6000421,0x1000712c,
+0x6010421,0x10007130,0x6000421,0x10007134,0x6000421,0x1000713c,0x6000421,0x10007140,
+0x6020421,0x10007144,0x6018421,0x10007148,0x60b0421,0x1000714c,0x60b8421,0x10007154,
+0x2380460,0x10007158,0x50000,0x10007160,0x60d0421,0x10007164,0x8000420,0x10007168,
+0x2340460,0x1000716c,0x2360460,0x10007170,0x2378460,0x10007174,0x2388460,0x10007178,
+0x0,0x1000717c,0x84584e0,0x10007184,0x8460480,0x1000718c,0x84684e0,0x10007194,
+0x0,0x10007198,0x84784e0,0x100071a0,0x8480480,0x100071a8,0x84884e0,0x100071b0,
+0x4c0000,0x100071b8,0x4a0000,0x100071c0,0x4a8000,0x100071c8,0x4b0000,0x100071d0,
+0x4b8000,0x100071d8,0x23c8860,0x100071dc,0x23d0860,0x100071e0,0x0,0x100071e4,
+0x23d9460,0x100071ec,0x23e2060,0x100071f4,0x9e8000,0x100071fc,0x9f0000,0x10007204,
+0x23e9460,0x1000720c,0x23f2060,0x10007214,0x0,0x10007218,0x2001460,0x1000721c,
+0x2001460,0x10007220,0x2001860,0x10007224,0x2001460,0x10007228,0x2001460,0x1000722c,
+0x2001860,0x10007230,0x65014a5,0x10007238,0x65094a5,0x10007240,0x65118c6,0x10007248,
+0x65194a5,0x10007250,0x65214a5,0x10007258,0x65298c6,0x10007260,0x65314a5,0x10007268,
+0x65394a5,0x10007270,0x65418c6,0x10007278,0x65494a5,0x10007280,0x65514a5,0x10007288,
+0x65598c6,0x10007290,0x80014a0,0x10007298,0x80014a0,0x100072a0,0x80018c0,0x100072a8,
+0x80014a0,0x100072b0,0x80014a0,0x100072b8,0x80018c0,0x100072c0,0x80014a0,0x100072c8,
+0x80014a0,0x100072d0,0x80018c0,0x100072d8,0x80014a0,0x100072e0,0x80014c0,0x100072e8,
+0x80014a0,0x100072f0,0x80014a0,0x100072f8,0x80014c0,0x10007300,0x80014a0,0x10007308,
+0x80018a0,0x10007310,0x80018a0,0x10007318,0x80018a0,0x10007320,0x80014a0,0x10007328,
+0x80014a0,0x10007330,0x80014c0,0x10007338,0x80030a5,0x10007340,0x80030a5,0x10007348,
+0x80030c6,0x10007350,0x80030a5,0x10007358,0x80030a5,0x10007360,0x80030c6,0x10007368,
+0x80030a5,0x10007370,0x80030a5,0x10007378,0x80030c6,0x10007380,0x80030a5,0x10007388,
+0x80030a5,0x10007390,0x80030c6,0x10007398,0x80030a5,0x100073a0,0x80030a5,0x100073a8,
+0x80030c6,0x100073b0,0x80030a5,0x100073b8,0x80030a5,0x100073c0,0x80030c6,0x100073c8,
+0x80030a5,0x100073d0,0x80030a5,0x100073d8,0x80030c6,0x100073e0,0x80030a5,0x100073e8,
+0x80030a5,0x100073f0,0x80030c6,0x100073f8,0x80030a5,0x10007400,0x80030a5,0x10007408,
+0x80030c6,0x10007410,0x80030a5,0x1000741c,0x80030a5,0x10007428,0x80030c6,0x10007434,
+0x80030a5,0x1000743c,0x80030a5,0x10007444,0x80030c6,0x1000744c,0x80030a5,0x10007454,
+0x80030a5,0x1000745c,0x80030c6,0x10007464,0x80030a5,0x1000746c,0x80030a5,0x10007474,
+0x80030c6,0x1000747c,0x80030a5,0x10007484,0x80030a5,0x1000748c,0x80030c6,0x10007494,
+0x80030a5,0x1000749c,0x80030a5,0x100074a4,0x80030c6,0x100074ac,0x80030a5,0x100074b4,
+0x80030a5,0x100074bc,0x80030c6,0x100074c4,0x42d0400,0x100074c8,0x2000460,0x100074cc,
+0x2000460,0x100074d0,0x2000460,0x100074d8,0x2000460,0x100074dc,0x2000460,0x100074e0,
+0x6298420,0x100074e8,0x62a0420,0x100074f0,0x62a8420,0x100074f8,0x62b0420,0x10007500,
+0x62b8420,0x10007508,0x62c0420,0x1000750c,0x62c8420,0x10007514,0x0,0x10007518,
+0x8000420,0x10007520,0xe258400,0x10007528,0xe260400,0x10007530,0x80014a0,0x10007538,
+0x80014a0,0x10007540,0x80018c0,0x10007548,0x84704e0,0x10007550,0x84904e0,0x10007558,
+0xe1c0000,0x1000755c,0xe1c0400,0x10007564,0xe1b8400,0x1000756c,0x84808a0,0x10007574,
+0x84608a0,0x1000757c,0x60014a1,0x10007588,0x60014a1,0x10007594,0x60018c1,0x100075a0,
+0x60014a1,0x100075ac,0x60014a1,0x100075b8,0x60018c1,0x100075c4,0x60a8421,0x100075cc,
+0x60b8421,0x100075d4,0x60014a1,0x100075e0,0x60014a1,0x100075ec,0x60018c1,0x100075f8,
+0x60014a1,0x10007604,0x60014a1,0x10007610,0x60018c1,0x1000761c,0x87a04e0,0x10007624,
+0x87a84e0,0x1000762c,0x0,0x10007630,0x87b04e0,0x10007638,0x87b84e0,0x10007640,
+0x0,0x10007644,0x167c2400,0x1000764c,0x167ca800,0x10007654,0x167d2c00,0x1000765c,
+0x1a0f0420,0x10007660,0x1a0f8420,0x10007668,0x1a100420,0x1000766c,0x1a108420,0x10007674,
+0x1a110420,0x10007678,0x1a118420,0x1000767c,0x2390460,0x10007680,0x23a8460,0x10007684,
+0x60014a1,0x10007690,0x60014a1,0x1000769c,0x60018c1,0x100076a8,0x60014a1,0x100076b4,
+0x60014a1,0x100076c0,0x60018c1,0x100076cc,0x60014a1,0x100076d8,0x60014a1,0x100076e4,
+0x60018c1,0x100076f0,0x60014a1,0x100076fc,0x60014a1,0x10007708,0x60018c1,0x10007714,
+0xc278420,0x1000771c,0xe278400,0x10007724,0xc280420,0x1000772c,0xe280400,0x10007734,
+0xc000420,0x1000773c,0xc000420,0x10007744,0xe288400,0x1000774c,0xc000420,0x10007754,
+0xc000420,0x1000775c,0xe290400,0x10007764,0xc000420,0x1000776c,0xc000420,0x10007774,
+0xe1f8400,0x1000777c,0xe208400,0x10007784,0xc000420,0x1000778c,0xc000420,0x10007794,
+0xe200400,0x1000779c,0xe210400,0x100077a4,0x10218000,0x100077ac,0x10220000,0x100077b4,
+0x1022b000,0x100077bc,0x10233000,0x100077c4,0x10238000,0x100077cc,0x10240000,0x100077d4,
+0x0,0x100077d8,0x0,0x100077dc,0x23f8460,0x100077e0,0x2400460,0x100077e4,
+0x2408460,0x100077e8,0x23c0460,0x100077ec,0x2410460,0x100077f0,0x2418460,0x100077f4,
+0x2420460,0x100077f8,0x6308420,0x10007800,0x6310420,0x10007808,0x6120421,0x10007810,
+0x6128421,0x10007818,0x6130421,0x10007820,0x6138421,0x10007828,0x6140421,0x10007830,
+0x6148421,0x10007838,0x6150421,0x10007840,0x6170421,0x10007848,0x6178421,0x10007850,
+0x6180421,0x10007858,0x8188420,0x10007860,0x8190420,0x10007868,0x6000421,0x10007870,
+0x6000421,0x10007878,0x0,0x1000787c,0x0,0x10007880,0x84c8480,0x10007888,
+0x84d0480,0x10007890,0x84d84e0,0x10007898,0x84e04e0,0x100078a0,0x84e84e0,0x100078a8,
+0x84f04e0,0x100078b0,0x1c000400,0x100078b4,0x2000400,0x100078b8,0x8d8000,0x100078c0,
+0x6001081,0x100078cc,0x6001081,0x100078d8,0x6001081,0x100078e4,0x6001081,0x100078f0,
+0x6001081,0x100078fc,0x6001081,0x10007908,0x6001081,0x10007914,0x6001081,0x10007920,
+0x60010a1,0x1000792c,0x60010a1,0x10007938,0x60010a1,0x10007944,0x60010a1,0x10007950,
+0x8001080,0x10007958,0x8001080,0x10007960,0x80010a0,0x10007968,0x8001080,0x10007970,
+0x8001080,0x10007978,0x8001080,0x10007980,0x8001480,0x10007988,0x8001080,0x10007990,
+0x1e4f8460,0x10007998,0x4000000,0x1000799c,0x2000460,0x100079a0,0x2000460,0x100079a4,
+0x8000420,0x100079ac,0x8000420,0x100079b4,0x8000420,0x100079bc,0x6000421,0x100079c4,
+0x6000421,0x100079cc,0x6000421,0x100079d4,0x6000421,0x100079dc,0x6000421,0x100079e4,
+0x6000421,0x100079ec,0x6000421,0x100079f4,0x6128421,0x100079fc,0x6138421,0x10007a04,
+0x2000460,0x10007a0c,0x600042c,0x10007a14,0x600042c,0x10007a1c,0x6000421,0x10007a24,
+0x6000421,0x10007a2c,0x20001084,0x10007a34,0x20001084,0x10007a3c,0x200018c6,0x10007a44,
+0x20001084,0x10007a4c,0x20001084,0x10007a54,0x200018c6,0x10007a5c,0x20001084,0x10007a64,
+0x20001084,0x10007a6c,0x200018c6,0x10007a74,0x20001084,0x10007a7c,0x20001084,0x10007a84,
+0x200018c6,0x10007a8c,0x8001080,0x10007a94,0x8001080,0x10007a9c,0x8001080,0x10007aa4,
+0x8001080,0x10007aac,0x600108c,0x10007ab4,0x600108c,0x10007abc,0x600108c,0x10007ac4,
+0x600108c,0x10007acc,0x6001081,0x10007ad4,0x6001081,0x10007adc,0x6001081,0x10007ae4,
+0x6001081,0x10007aec,0x22001021,0x10007af4,0x22001021,0x10007afc,0x22001021,0x10007b04,
+0x22001021,0x10007b0c,0x22000421,0x10007b14,0x0,0x10007b1c,0x0,0x10007b24,
+0x0,0x10007b2c,0x0,0x10007b34,0x0,0x10007b3c,0x6140421,0x10007b44,
+0x6148421,0x10007b4c,0x6150421,0x10007b54,0x109f8000,0x10007b5c,0x10a00000,0x10007b64,
+0x12a08000,0x10007b68,0x2a10460,0x10007b70,0x2a18460,0x10007b78,0x8a204e0,0x10007b80,
+0x8a284e0,0x10007b88,0x8a304e0,0x10007b90,0x8a384e0,0x10007b98,0x6028421,0x10007ba0,
+0x6030421,0x10007ba8,0x6038421,0x10007bb0,0x8a404e0,0x10007bb8,0x8a404e0,0x10007bc0,
+0x8a404e0,0x10007bc8,0x8a404e0,0x10007bd0,0x0,0x0,0x0,0x0,
+0x2,0x1,0x0,0x3,0x0,0x0,0x10007c20,0x10007c2c,
+0x10007c34,0x10007c3c,0x10007c44,0x10007cbc,0x10007cc0,0x10007cc4,0x10007cc8,0x10007ccc,
+0x10007cd0,0x10007cd4,0x10007cd8,0x10007cdc,0x10007ce0,0x10007ce4,0x10007ce8,0x10007cec,
+0x10007cf4,0x10007cf8,0x10007cfc,0x10007d00,0x10007d04,0x10007d0c,0x10007d10,0x10007d14,
+0x10007d18,0x10007d1c,0x10007d20,0x10007d24,0x10007d28,0x10007d2c,0x10007d30,0x10007d34,
+0x10007d38,0x10007d3c,0x10007d40,0x10007d44,0x10007d48,0x10007d4c,0x10007d50,0x10007d54,
+0x10007d58,0x10007d5c,0x10007d60,0x10007d64,0x10007d68,0x10007d6c,0x10007d70,0x10007d80,
+0x10007d90,0x10007da4,0x10007db8,0x10007dcc,0x10007dd4,0x10007ddc,0x10007de4,0x10007dec,
+0x10007df4,0x10007dfc,0x10007e08,0x10007e14,0x10007e20,0x10007e30,0x10007e3c,0x10007e48,
+0x10007e50,0x10007e58,0x10007e60,0x10007e6c,0x10007e78,0x10007e80,0x10007e88,0x10007e94,
+0x10007ea0,0x10007ea8,0x10007eb4,0x10007ebc,0x10007ec8,0x10007ed0,0x10007edc,0x10007ee4,
+0x10007ef4,0x10007f00,0x10007f08,0x10007f14,0x10007f1c,0x10007f24,0x10007f2c,0x10007f38,
+0x10007f40,0x10007f4c,0x10007f58,0x10007f60,0x10007f68,0x10007f70,0x10007f7c,0x10007f84,
+0x10007f8c,0x10007f94,0x10007fa0,0x10007fb0,0x10007fc4,0x10007fd0,0x10007fd8,0x10007fe4,
+0x10007ff8,0x10008000,0x10008008,0x10008010,0x1000801c,0x0,0x0,0x0,
+0x726f7574,0x696e653a,0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,
+0x69746820,0x73745f63,0x75696e69,0x74206f72,0x2073745f,0x72656164,0x73740a00,0x726f7574,
+0x696e653a,0x206e6f20,0x63757272,0x656e7420,0x726f7574,0x696e652c,0x20736565,0x20666461,
+0x6464206f,0x72207365,0x7466640a,0x0,0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,
+0x61646420,0x746f2074,0x68697320,0x656e7472,0x79206974,0x20776173,0x20726561,0x64696e20,
+0x66726f6d,0x20646973,0x6b0a0000,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x0,0x0,0x0,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,0x61646420,0x746f2074,0x68697320,0x656e7472,
+0x79206974,0x20776173,0x20726561,0x64696e20,0x66726f6d,0x20646973,0x6b0a0000,0x0,
+0x0,0x0,0x0,0x0,0x100087fc,0x0,0x0,0x0,
+0x70090000,0x63616e6e,0x6f742077,0x72697465,0x20706669,0x656c6400,0x63616e6e,0x6f742077,
+0x72697465,0x20637572,0x20746162,0x6c650a00,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x403df0,0x0,0x0,0x0,0x0,0x18,
+0x1d0000,0x20,0x0,0x0,0x403ef8,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x3e,0x0,0x0,0x403f10,0x907f0000,
+0xfffffffc,0x0,0x0,0x38,0x1d001f,0x0,0x0,0x0,
+0x404008,0xd0ff0000,0xfffffffc,0x0,0x0,0x40,0x1d001f,0x0,
+0x0,0x0,0x404108,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x0,0x0,0x0,0x4041a8,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x0,0x0,0x0,0x404234,0x90ff0000,
+0xffffffdc,0x0,0x0,0x60,0x1d001f,0x0,0x0,0x0,
+0x404a0c,0x90010000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x39,
+0x0,0x0,0x404b80,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x0,0x0,0x0,0x405178,0x90010000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x4054e8,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x405574,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x0,
+0x0,0x0,0x4055d4,0x90000000,0xffffffec,0x0,0x0,0x30,
+0x1d001f,0x0,0x0,0x0,0x4056dc,0x90000000,0xffffffec,0x0,
+0x0,0x30,0x1d001f,0x0,0x0,0x0,0x405884,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x4058f0,0x90000000,0xfffffff4,0x0,0x0,0x38,0x1d001f,0x0,
+0x0,0x0,0x405a80,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x0,0x0,0x0,0x405b54,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x405c28,0x900f0000,
+0xffffffd4,0x0,0x0,0x58,0x1d001f,0x0,0x0,0x0,
+0x405de4,0x90000000,0xffffffec,0x0,0x0,0x30,0x1d001f,0x0,
+0x0,0x0,0x406034,0xd0ff0000,0xffffffe4,0x0,0x0,0x58,
+0x1d001f,0x0,0x0,0x0,0x4061f8,0x90000000,0xffffffec,0x0,
+0x0,0x40,0x1d001f,0x0,0x0,0x0,0x406340,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x406684,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x406728,0x90000000,0xffffffd4,0x0,0x0,0x58,
+0x1d001f,0x0,0x0,0x0,0x406c48,0x90000000,0xffffffdc,0x0,
+0x0,0x50,0x1d001f,0x0,0x0,0x0,0x406fe8,0x90000000,
+0xffffffec,0x0,0x0,0x40,0x1d001f,0x0,0x0,0x0,
+0x407334,0x907f0000,0xfffffbe4,0x0,0x0,0x460,0x1d001f,0x0,
+0x0,0x0,0x4075cc,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x0,0x0,0x0,0x4076a0,0x90000000,0xffffffdc,0x0,
+0x0,0x50,0x1d001f,0x0,0x0,0x0,0x407a20,0x90000000,
+0xffffffcc,0x0,0x0,0x60,0x1d001f,0x0,0x0,0x0,
+0x40848c,0x90000000,0xffffffec,0x0,0x0,0x40,0x1d001f,0x0,
+0x0,0x0,0x4085d8,0x90000000,0xffffffec,0x0,0x0,0x40,
+0x1d001f,0x0,0x0,0x0,0x4086ec,0x90000000,0xffffffe4,0x0,
+0x0,0x48,0x1d001f,0x0,0x0,0x0,0x4088b8,0x90000000,
+0xffffffdc,0x0,0x0,0x50,0x1d001f,0x0,0x0,0x0,
+0x408c80,0x90010000,0xffffffd4,0x0,0x0,0x58,0x1d001f,0x0,
+0x0,0x0,0x409118,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x0,0x0,0x0,0x4092fc,0x90000000,0xffffffcc,0x0,
+0x0,0x60,0x1d001f,0x0,0x0,0x0,0x409850,0x90000000,
+0xffffffec,0x0,0x0,0x40,0x1d001f,0x0,0x0,0x0,
+0x409b10,0x90000000,0xffffffdc,0x0,0x0,0x50,0x1d001f,0x0,
+0x0,0x0,0x409ecc,0x90000000,0xfffffff4,0x0,0x0,0x38,
+0x1d001f,0x0,0x0,0x0,0x409fd0,0x90000000,0xfffffffc,0x0,
+0x0,0x30,0x1d001f,0x0,0x0,0x0,0x40a044,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x40a0d4,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40a160,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x0,0x0,0x0,0x40a208,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x0,0x0,0x0,0x40a280,0x90000000,
+0xffffffe4,0x0,0x0,0x38,0x1d001f,0x0,0x0,0x0,
+0x40a4b0,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40a530,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x0,0x0,0x0,0x40a5d4,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40a6b8,0x900f0000,
+0xfffffffc,0x0,0x0,0x30,0x1d001f,0x0,0x0,0x0,
+0x40a79c,0x90ff0000,0xfffffffc,0x0,0x0,0x40,0x1d001f,0x0,
+0x0,0x0,0x40a958,0x90ff0000,0xffffffec,0x0,0x0,0x50,
+0x1d001f,0x0,0x0,0x0,0x40aad4,0x90000000,0xffffffe4,0x0,
+0x0,0x38,0x1d001f,0x0,0x0,0x0,0x40adfc,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x40af00,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40b0f4,0xd0ff0000,0xfffffffc,0x0,0x0,0x40,
+0x1d001f,0x0,0x0,0x0,0x40b340,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40b3dc,0x900f0000,
+0xfffffffc,0x0,0x0,0x30,0x1d001f,0xd1,0x0,0x0,
+0x40b554,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,
+0x0,0x0,0x40b5f0,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x0,0x0,0x0,0x40b984,0x901f0000,0xffffffec,0x0,
+0x0,0x40,0x1d001f,0x0,0x0,0x0,0x40bc84,0xd0ff0000,
+0xffffffec,0x0,0x0,0x50,0x1d001f,0x0,0x0,0x0,
+0x40bebc,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,
+0x0,0x0,0x40c048,0xd0ff0000,0xffffffe4,0x0,0x0,0x58,
+0x1d001f,0x0,0x0,0x0,0x40c218,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40c2e0,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x40c360,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40c3e0,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x0,0x0,0x0,0x40c460,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40c4cc,0x90010000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,0x0,0x0,
+0x40c5e8,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40c66c,0x903f0000,0xfffffffc,0x0,0x0,0x38,
+0x1d001f,0x0,0x0,0x0,0x40c830,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40c928,0x90010000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,0x0,0x0,
+0x40c9d0,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,
+0x0,0x0,0x40cc44,0x900f0000,0xfffffffc,0x0,0x0,0x30,
+0x1d001f,0x0,0x0,0x0,0x40cccc,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40cde4,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,0x0,0x0,
+0x40ceb4,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x40cf9c,0x90ff0000,0xffffffe4,0x0,0x0,0x58,
+0x1d001f,0x0,0x0,0x0,0x40d110,0x90ff0000,0xffffffe4,0x0,
+0x0,0x58,0x1d001f,0x0,0x0,0x0,0x40d284,0x90010000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x0,0x0,0x0,
+0x40d3ec,0x90000000,0xfffffbe4,0x0,0x0,0x438,0x1d001f,0xc7,
+0x0,0x0,0x40e180,0x90000000,0xfffffefc,0x0,0x0,0x120,
+0x1d001f,0x0,0x0,0x0,0x40e1e0,0x90000000,0xffffffec,0x0,
+0x0,0x38,0x1d001f,0x198,0x0,0x0,0x40e230,0x90000000,
+0xffffffec,0x0,0x0,0x30,0x1d001f,0x0,0x0,0x0,
+0x40e3f0,0x90010000,0xfffffff4,0x0,0x0,0x30,0x1d001f,0x0,
+0x0,0x0,0x40e554,0x90010000,0xffffffdc,0x0,0x0,0x48,
+0x1d001f,0x0,0x0,0x0,0x40e760,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x0,0x0,0x0,0x40e7d0,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x9d,0x0,0x0,
+0x40e814,0x90ff0000,0xffffffdc,0x0,0x0,0x68,0x1d001f,0xdc,
+0x0,0x0,0x40ea24,0x90000000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x110,0x0,0x0,0x40ea98,0x90000000,0xffffffe4,0x0,
+0x0,0x40,0x1d001f,0x12c,0x0,0x0,0x40f180,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x2fd,0x0,0x0,
+0x40f188,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x307,
+0x0,0x0,0x40f1d0,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x14a,0x0,0x0,0x40f234,0x90010000,0xffffffec,0x0,
+0x0,0x30,0x1d001f,0x1e3,0x0,0x0,0x40f514,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x31e,0x0,0x0,
+0x40f580,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0xac,
+0x0,0x0,0x40f5d8,0x903f0000,0xfffffffc,0x0,0x0,0x38,
+0x1d001f,0x0,0x0,0x0,0x40f77c,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x0,0x0,0x0,0x40f868,0x90010000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x46,0x0,0x0,
+0x40f9cc,0x90030000,0xfffffffc,0x0,0x0,0x28,0x1d001f,0xf8,
+0x0,0x0,0x40fa7c,0x90030000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x1da,0x0,0x0,0x40fb2c,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x0,0x0,0x0,0x40fbbc,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x343,0x0,0x0,
+0x40fc20,0xd0ff0000,0xfffffff4,0x0,0x0,0x48,0x1d001f,0x0,
+0x0,0x0,0x40fd98,0x90000000,0xffffffec,0x0,0x0,0x30,
+0x1d001f,0x0,0x0,0x0,0x4100c8,0x90070000,0xfffffffc,0x0,
+0x0,0x28,0x1d001f,0x0,0x0,0x0,0x4101ac,0x90070000,
+0xfffffffc,0x0,0x0,0x28,0x1d001f,0x0,0x0,0x0,
+0x410270,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x4102f4,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x34b,0x0,0x0,0x410380,0x903f0000,0xffffffcc,0x0,
+0x0,0x68,0x1d001f,0x11a,0x0,0x0,0x410e80,0x907f0000,
+0xfffffbe4,0x0,0x0,0x450,0x1d001f,0x0,0x0,0x0,
+0x41125c,0x900f0000,0xfffffbbc,0x0,0x0,0x470,0x1d001f,0xbc,
+0x0,0x0,0x411530,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x4b,0x0,0x0,0x4115a8,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0xff,0x0,0x0,0x411630,0x90000000,
+0xffffffec,0x0,0x0,0x30,0x1d001f,0x155,0x0,0x0,
+0x411778,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x170,
+0x0,0x0,0x411898,0x90000000,0xffffffdc,0x0,0x0,0x40,
+0x1d001f,0x0,0x0,0x0,0x411b84,0x90000000,0xffffffd4,0x0,
+0x0,0x48,0x1d001f,0x0,0x0,0x0,0x411ecc,0xd0ff0000,
+0xfffffffc,0x0,0x0,0x40,0x1d001f,0x0,0x0,0x0,
+0x41213c,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x0,
+0x0,0x0,0x412144,0x90070000,0xffffffe4,0x0,0x0,0x40,
+0x1d001f,0x0,0x0,0x0,0x41244c,0x903f0000,0xfffffffc,0x0,
+0x0,0x38,0x1d001f,0x0,0x0,0x0,0x412548,0x900f0000,
+0xffffffec,0x0,0x0,0x40,0x1d001f,0x0,0x0,0x0,
+0x412698,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x124,
+0x0,0x0,0x412794,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x165,0x0,0x0,0x412904,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x183,0x0,0x0,0x412a54,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x137,0x0,0x0,
+0x412af0,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x13f,
+0x0,0x0,0x412b84,0x90000000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x8e,0x0,0x0,0x412cb0,0x90000000,0xffffff6c,0x0,
+0x0,0xb0,0x1d001f,0x3a8,0x0,0x0,0x412d18,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x319,0x0,0x0,
+0x412d58,0x90000000,0xfffffffc,0x0,0x0,0x28,0x1d001f,0x3b7,
+0x0,0x0,0x412e28,0x90000000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x3c0,0x0,0x0,0x412ee0,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x3cb,0x0,0x0,0x412f24,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x3d7,0x0,0x0,
+0x412f70,0x90000000,0xfffffffc,0x0,0x0,0x28,0x1d001f,0x3e3,
+0x0,0x0,0x413040,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x3ef,0x0,0x0,0x413048,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x3f6,0x0,0x0,0x413050,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x3fd,0x0,0x0,
+0x413060,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x413224,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x0,0x0,0x0,0x4132c8,0x90000000,0xfffffbfc,0x0,
+0x0,0x420,0x1d001f,0x1c7,0x0,0x0,0x413320,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x82,0x0,0x0,
+0x413388,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x1bd,
+0x0,0x0,0x4133dc,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x72,0x0,0x0,0x413548,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x1fc,0x0,0x0,0x4135b0,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0xe7,0x0,0x0,
+0x413670,0x900f0000,0xfffffffc,0x0,0x0,0x30,0x1d001f,0x59,
+0x0,0x0,0x4136f8,0x90010000,0xffffffec,0x0,0x0,0x30,
+0x1d001f,0x396,0x0,0x0,0x413870,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x27b,0x0,0x0,0x4138f0,0x90010000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x2cc,0x0,0x0,
+0x413b00,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x21d,
+0x0,0x0,0x413b88,0x90000000,0xffffffe4,0x0,0x0,0x38,
+0x1d001f,0x2ba,0x0,0x0,0x413cf8,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x212,0x0,0x0,0x413d90,0x90010000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x252,0x0,0x0,
+0x413fdc,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x476,
+0x0,0x0,0x414088,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x464,0x0,0x0,0x414148,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x482,0x0,0x0,0x41428c,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x493,0x0,0x0,
+0x414394,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x4a0,
+0x0,0x0,0x414468,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x4c1,0x0,0x0,0x414540,0x90000000,0xfffffffc,0x0,
+0x0,0x28,0x1d001f,0x434,0x0,0x0,0x414600,0x90000000,
+0xfffffffc,0x0,0x0,0x28,0x1d001f,0x427,0x0,0x0,
+0x4146c0,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x4af,
+0x0,0x0,0x41470c,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x4d1,0x0,0x0,0x4147e4,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x4e0,0x0,0x0,0x41480c,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x452,0x0,0x0,
+0x414860,0x90030000,0xfffffffc,0x0,0x0,0x28,0x1d001f,0x444,
+0x0,0x0,0x4149c0,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x4f7,0x0,0x0,0x4149e8,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x505,0x0,0x0,0x414a74,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x512,0x0,0x0,
+0x414ab8,0x90070000,0xfffffffc,0x0,0x0,0x30,0x1d001f,0x325,
+0x0,0x0,0x414da4,0x901f0000,0xffffffec,0x0,0x0,0x48,
+0x1d001f,0x29c,0x0,0x0,0x414f80,0x90000000,0xffffffd4,0x0,
+0x0,0x50,0x1d001f,0x551,0x0,0x0,0x415130,0x90000000,
+0xffffffec,0x0,0x0,0x38,0x1d001f,0x566,0x0,0x0,
+0x41523c,0x90000000,0xffffffec,0x0,0x0,0x38,0x1d001f,0x573,
+0x0,0x0,0x415394,0x90000000,0xffffffec,0x0,0x0,0x38,
+0x1d001f,0x586,0x0,0x0,0x4154e4,0x90000000,0xffffffe4,0x0,
+0x0,0x40,0x1d001f,0x594,0x0,0x0,0x4156a0,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x5a0,0x0,0x0,
+0x4156cc,0x90010000,0xffffffcc,0x0,0x0,0x58,0x1d001f,0x1a6,
+0x0,0x0,0x415948,0x90010000,0xffffffe4,0x0,0x0,0x40,
+0x1d001f,0x2e3,0x0,0x0,0x415b78,0x90000000,0xffffffec,0x0,
+0x0,0x30,0x1d001f,0x207,0x0,0x0,0x415c64,0x90000000,
+0xffffffec,0x0,0x0,0x30,0x1d001f,0x404,0x0,0x0,
+0x415cfc,0x90000000,0xffffffec,0x0,0x0,0x30,0x1d001f,0x5c5,
+0x0,0x0,0x415da8,0xd0ff0000,0xffffffd4,0x0,0x0,0x68,
+0x1d001f,0x5d4,0x0,0x0,0x415fe4,0x90000000,0xffffffec,0x0,
+0x0,0x30,0x1d001f,0x5f8,0x0,0x0,0x4160a4,0x90000000,
+0xffffffec,0x0,0x0,0x30,0x1d001f,0x607,0x0,0x0,
+0x416124,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x2f0,
+0x0,0x0,0x4161b0,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x61c,0x0,0x0,0x416240,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x626,0x0,0x0,0x416290,0x900f0000,
+0xfffffffc,0x0,0x0,0x30,0x1d001f,0x632,0x0,0x0,
+0x416444,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x63e,
+0x0,0x0,0x416564,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x64d,0x0,0x0,0x416620,0x90070000,0xffffffec,0x0,
+0x0,0x38,0x1d001f,0x5b6,0x0,0x0,0x416948,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x662,0x0,0x0,
+0x41698c,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x66f,
+0x0,0x0,0x416a98,0x90000000,0xffffffec,0x0,0x0,0x38,
+0x1d001f,0x678,0x0,0x0,0x416ba0,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x246,0x0,0x0,0x416c10,0x90000000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x22a,0x0,0x0,
+0x416c48,0x90000000,0xffffffec,0x0,0x0,0x30,0x1d001f,0x689,
+0x0,0x0,0x416cdc,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x697,0x0,0x0,0x416d30,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x6a4,0x0,0x0,0x416d78,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x6b6,0x0,0x0,
+0x416dc4,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x238,
+0x0,0x0,0x416e18,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x52b,0x0,0x0,0x416e40,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x535,0x0,0x0,0x416ec8,0x90000000,
+0xffffff2c,0x0,0x0,0xf0,0x1d001f,0x53e,0x0,0x0,
+0x4175d4,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x658,
+0x0,0x0,0x417754,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x613,0x0,0x0,0x417934,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x6f7,0x0,0x0,0x417ab0,0x90070000,
+0xfffffffc,0x0,0x0,0x28,0x1d001f,0x25c,0x0,0x0,
+0x417c70,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x702,
+0x0,0x0,0x417c98,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x70c,0x0,0x0,0x417cb0,0x90000000,0xfffffff4,0x0,
+0x0,0x28,0x1d001f,0x5e7,0x0,0x0,0x417dbc,0x90000000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x71a,0x0,0x0,
+0x417ec8,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x72d,
+0x0,0x0,0x417fa0,0x90030000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x547,0x0,0x0,0x418104,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x738,0x0,0x0,0x41811c,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x28c,0x0,0x0,
+0x41813c,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x743,
+0x0,0x0,0x4184e8,0x90070000,0xfffffffc,0x0,0x0,0x28,
+0x1d001f,0x2d6,0x0,0x0,0x41861c,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x266,0x0,0x0,0x418668,0x90000000,
+0xfffffff4,0x0,0x0,0x28,0x1d001f,0x55c,0x0,0x0,
+0x4187a8,0x90000000,0xfffffff4,0x0,0x0,0x28,0x1d001f,0x74b,
+0x0,0x0,0x4188f0,0x90000000,0xffffffec,0x0,0x0,0x30,
+0x1d001f,0x757,0x0,0x0,0x418a1c,0x90000000,0xfffffffc,0x0,
+0x0,0x20,0x1d001f,0x5ac,0x0,0x0,0x418ad8,0x90000000,
+0xfffffffc,0x0,0x0,0x20,0x1d001f,0x763,0x0,0x0,
+0x418ba0,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x76e,
+0x0,0x0,0x418bc8,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x779,0x0,0x0,0x418c84,0x90000000,0xfffffff4,0x0,
+0x0,0x30,0x1d001f,0x787,0x0,0x0,0x418d18,0x900f0000,
+0xffffff14,0x0,0x0,0x120,0x1d001f,0x79a,0x0,0x0,
+0x419e30,0x90000000,0xfffffffc,0x0,0x0,0x20,0x1d001f,0x0,
+0x0,0x0,0x419f0c,0x90000000,0xfffffff4,0x0,0x0,0x28,
+0x1d001f,0x2ab,0x0,0x0,0x419fa0,0xd0ff0000,0xfffffe64,0x0,
+0x0,0x1d8,0x1d001f,0x805,0x0,0x0,0x41afa4,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x822,0x0,0x0,
+0x41afc4,0x0,0x0,0x0,0x0,0x8,0x1d001f,0x6c6,
+0x0,0x0,0x41aff4,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x830,0x0,0x0,0x41b0d8,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x83d,0x0,0x0,0x41b350,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x84a,0x0,0x0,
+0x41b4b8,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x856,
+0x0,0x0,0x41b624,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x7b5,0x0,0x0,0x41ba54,0x903f0000,0xffffffa4,0x0,
+0x0,0x90,0x1d001f,0x7e4,0x0,0x0,0x41c050,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x7ec,0x0,0x0,
+0x41c184,0x90030000,0xffffffe4,0x0,0x0,0x40,0x1d001f,0x7d2,
+0x0,0x0,0x41c41c,0x90030000,0xffffffdc,0x0,0x0,0x48,
+0x1d001f,0x7f4,0x0,0x0,0x41c830,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x7ca,0x0,0x0,0x41ca9c,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x7fd,0x0,0x0,
+0x41cbe8,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x862,
+0x0,0x0,0x41cda0,0x90030000,0xffffffe4,0x0,0x0,0x40,
+0x1d001f,0x7db,0x0,0x0,0x41d030,0x90000000,0xffffffec,0x0,
+0x0,0x30,0x1d001f,0x86b,0x0,0x0,0x41d29c,0x90030000,
+0xffffffe4,0x0,0x0,0x40,0x1d001f,0x874,0x0,0x0,
+0x41d4c0,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x87f,
+0x0,0x0,0x41d53c,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x88b,0x0,0x0,0x41d5bc,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x894,0x0,0x0,0x41d64c,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x8a1,0x0,0x0,
+0x41d6b0,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x8ae,
+0x0,0x0,0x41d7c8,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x8bb,0x0,0x0,0x41d86c,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x8c7,0x0,0x0,0x41d8a4,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x8d5,0x0,0x0,
+0x41d8dc,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x8de,
+0x0,0x0,0x41d9c4,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x8eb,0x0,0x0,0x41da28,0x0,0x0,0x0,
+0x0,0x0,0x1d001f,0x8f5,0x0,0x0,0x41dbb0,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x8ff,0x0,0x0,
+0x41dd18,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x909,
+0x0,0x0,0x41dee4,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x7be,0x0,0x0,0x41e2a4,0x0,0x0,0x0,
+0x0,0x28,0x1d001f,0x417,0x0,0x0,0x41e2d8,0x0,
+0x0,0x0,0x0,0x0,0x1d001f,0x920,0x0,0x0,
+0x41e2ec,0x0,0x0,0x0,0x0,0x0,0x0,0x926,
+0x0,0x0,0x41e5cc,0x0,0x0,0x0,0x0,0x0,
+0x1d001f,0x40f,0x0,0x0,0x41e5e8,0x0,0x0,0x0,
+0x0,0x0,0x0,0x934,0x0,0x0,0x41e764,0x90000000,
+0xffffffec,0x0,0x0,0x30,0x1d001f,0x96b,0x0,0x0,
+0x41e81c,0x0,0x0,0x0,0x0,0x0,0x1d001f,0x976,
+0x0,0x0,0x41e850,0x90000000,0xfffffffc,0x0,0x0,0x20,
+0x1d001f,0x981,0x0,0x0,0x41e8e8,0x90000000,0xffffffdc,0x0,
+0x0,0x40,0x1d001f,0x94d,0x0,0x0,0x41e9fc,0x90030000,
+0xfffffffc,0x0,0x0,0x28,0x1d001f,0x958,0x0,0x0,
+0x41ead4,0x90000000,0xffffffe4,0x0,0x0,0x38,0x1d001f,0x93e,
+0x0,0x0,0x41ebc8,0x90010000,0xffffffec,0x0,0x0,0x30,
+0x1d001f,0x913,0x0,0x0,0xffffffff,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x73746174,0x69632070,0x726f6365,0x64757265,0x20286e6f,0x206e616d,0x65290065,0x78697400,
+0x5f5f7374,0x61727400,0x5f5f7265,0x6164656e,0x765f7369,0x67667065,0x6d6169,0x6e005f6d,
+0x636f756e,0x74006861,0x73680061,0x6c6c6f63,0x5f6e6577,0x5f73796d,0x776869,0x63685f6f,
+0x70740066,0x7072696e,0x74660066,0x666c7573,0x6800706f,0x73746572,0x726f7200,0x666f7065,
+0x6e006361,0x6c6c5f70,0x6572726f,0x72007075,0x745f6269,0x6e61736d,0x66796c65,0x73796d,
+0x5f696e69,0x74006667,0x65746300,0x6d616b65,0x5f66696c,0x65006673,0x65656b00,0x72656164,
+0x696e6c69,0x6e650050,0x61727365,0x73746d74,0x646f5f,0x646f745f,0x656e6400,0x73796d5f,
+0x66696e69,0x73680061,0x73736572,0x74696f6e,0x5f666169,0x6c656400,0x4c6f6f6b,0x55700061,
+0x6c6c6f63,0x5f6e6577,0x5f737472,0x696e6700,0x73796d5f,0x656e7465,0x72006e65,0x7874746f,
+0x6b656e00,0x47657445,0x78707200,0x73796d5f,0x64656669,0x6e650047,0x65744974,0x656d0064,
+0x775f4765,0x74497465,0x6d006865,0x785f746f,0x5f6e756d,0x456e74,0x65725379,0x6d007374,
+0x726c656e,0x64775f,0x47657445,0x78707200,0x47657452,0x65676973,0x74657200,0x73747263,
+0x6d700047,0x65744261,0x73654f72,0x45787072,0x737472,0x63707900,0x73796d5f,0x756e6465,
+0x66696e65,0x64007374,0x5f70726f,0x63656e64,0x667265,0x65006d61,0x6c6c6f63,0x6e6577,
+0x5f657272,0x6f720063,0x616c6c5f,0x6e616d65,0x5f616e64,0x5f6c696e,0x65006f70,0x4c6f6f6b,
+0x5570006d,0x616b655f,0x6c6f6361,0x6c5f6c61,0x62656c00,0x73707269,0x6e746600,0x706f7374,
+0x63657272,0x6f720073,0x745f7379,0x6d5f6964,0x6e007374,0x5f70646e,0x5f69646e,0x73745f,
+0x70657874,0x5f696578,0x74007374,0x5f617578,0x6973796d,0x61646400,0x73745f63,0x75727265,
+0x6e746966,0x64007374,0x5f617578,0x62746164,0x64007374,0x5f73796d,0x61646400,0x73745f73,
+0x74726164,0x64007374,0x5f737472,0x5f657874,0x69737300,0x70657272,0x6f720073,0x745f6375,
+0x696e6974,0x737472,0x63617400,0x73745f63,0x75727265,0x6e747063,0x68647200,0x73745f65,
+0x6e64616c,0x6c66696c,0x65730073,0x745f7772,0x69746562,0x696e6172,0x79007374,0x5f69646e,
+0x5f696e64,0x65785f66,0x65787400,0x73745f65,0x78746164,0x64007374,0x5f657874,0x73747261,
+0x64640073,0x745f7072,0x6f636265,0x67696e00,0x73745f70,0x64616464,0x5f69646e,0x73745f,
+0x6665696e,0x69740069,0x746f6100,0x746f6c6f,0x77657200,0x61746f6c,0x6c746f,0x6100756e,
+0x7363616e,0x73745f,0x66696c65,0x62656769,0x6e007374,0x72746f75,0x6c6c0073,0x7472746f,
+0x6c6c0063,0x6f6e7375,0x6d650064,0x6f745f73,0x6f6f6e00,0x6d656d63,0x7079006d,0x656d7365,
+0x74005f5f,0x6c6c5f6d,0x756c005f,0x5f6c6c5f,0x64697600,0x5f5f6c6c,0x5f72656d,0x5f5f6c,
+0x6c5f6c73,0x68696674,0x5f5f75,0x6c6c5f72,0x73686966,0x74006772,0x6f775f61,0x72726179,
+0x667772,0x69746500,0x66696c65,0x73697a65,0x667374,0x61740073,0x745f6572,0x726f7200,
+0x73745f77,0x61726e69,0x6e670073,0x745f7072,0x696e7466,0x5f320073,0x745f7072,0x696e7466,
+0x5f330073,0x745f696e,0x7465726e,0x616c006c,0x5f616464,0x7200655f,0x61646472,0x735f61,
+0x64647200,0x73745f73,0x74725f69,0x646e0078,0x6d616c6c,0x6f630078,0x7265616c,0x6c6f6300,
+0x63616c6c,0x6f63005f,0x6d645f73,0x745f6572,0x726f7200,0x5f6d645f,0x73745f69,0x6e746572,
+0x6e616c00,0x5f6d645f,0x73745f6d,0x616c6c6f,0x63005f6d,0x645f7374,0x5f637572,0x72656e74,
+0x69666400,0x73745f70,0x6366645f,0x69666400,0x627a6572,0x6f007374,0x5f696664,0x5f706366,
+0x64007374,0x5f707379,0x6d5f6966,0x645f6973,0x796d0073,0x745f7061,0x75785f69,0x61757800,
+0x73745f73,0x74725f69,0x66645f69,0x7373005f,0x6d645f73,0x745f7374,0x725f6578,0x74697373,
+0x73745f,0x7070645f,0x6966645f,0x6973796d,0x5f6d64,0x5f73745f,0x7374725f,0x69737300,
+0x5f6d645f,0x73745f69,0x6578746d,0x61780072,0x65616c6c,0x6f63005f,0x6d645f73,0x745f6966,
+0x646d6178,0x5f6d64,0x5f73745f,0x73657466,0x64005f5f,0x7367695f,0x6d6c645f,0x73745f63,
+0x6f6d6d6f,0x6e626567,0x696e0073,0x745f6966,0x646d6178,0x73745f,0x73657466,0x64007374,
+0x5f666461,0x64640073,0x745f6d61,0x6c6c6f63,0x73745f,0x66696c65,0x656e6400,0x73745f69,
+0x646e5f64,0x6e007374,0x5f746578,0x74626c6f,0x636b005f,0x7367695f,0x73745f62,0x6c6f636b,
+0x62656769,0x6e007374,0x5f626c6f,0x636b6265,0x67696e00,0x73745f62,0x6c6f636b,0x656e6400,
+0x73745f62,0x6c6f636b,0x706f7000,0x73745f73,0x65746964,0x6e007374,0x5f696175,0x785f636f,
+0x70797479,0x73745f,0x66676c6f,0x62616c5f,0x69646e00,0x73745f70,0x73796d5f,0x69646e5f,
+0x6f666673,0x65740073,0x745f7061,0x75785f69,0x66645f69,0x61757800,0x73745f66,0x69786578,
+0x74696e64,0x65780073,0x745f6669,0x78657874,0x73630073,0x745f7064,0x61646400,0x73745f66,
+0x69786973,0x73007374,0x5f636861,0x6e676564,0x6e007374,0x5f66696c,0x655f6964,0x6e007374,
+0x5f747168,0x6967685f,0x69617578,0x73745f,0x73686966,0x74747100,0x73745f61,0x75786164,
+0x64007374,0x5f636861,0x6e676561,0x75780073,0x745f6164,0x64747100,0x73745f63,0x68616e67,
+0x65617578,0x726e6478,0x73745f,0x61757872,0x6e647861,0x64640073,0x745f6175,0x78627473,
+0x697a6500,0x73745f61,0x7578726e,0x64786164,0x645f6964,0x6e007374,0x5f616464,0x636f6e74,
+0x696e7565,0x64006765,0x74686f73,0x74736578,0x676574,0x686f7374,0x6e616d65,0x706174,
+0x68636f6e,0x66006765,0x74637764,0x74696d,0x65007374,0x61740073,0x745f6c69,0x6e656164,
+0x64007374,0x5f6e6f6e,0x5f677000,0x73745f73,0x65745f6e,0x6f6e5f67,0x70007374,0x5f706c69,
+0x6e655f69,0x66645f69,0x6c696e65,0x73745f,0x7374725f,0x69737300,0x73745f73,0x65746368,
+0x64720073,0x745f6672,0x65650073,0x745f6964,0x6e5f726e,0x64780073,0x745f726e,0x64785f69,
+0x646e0073,0x745f7065,0x78745f64,0x6e007374,0x5f696578,0x746d6178,0x73745f,0x7365746d,
+0x73676e61,0x6d650073,0x745f7265,0x61646269,0x6e617279,0x6f7065,0x6e007374,0x5f726561,
+0x64737400,0x636c6f73,0x65006c73,0x65656b00,0x72656164,0x737761,0x705f6864,0x72006c64,
+0x6673796d,0x6f726465,0x72007377,0x61705f70,0x64007377,0x61705f73,0x796d0073,0x7761705f,
+0x6f707400,0x73776170,0x5f666400,0x73776170,0x5f666900,0x73776170,0x5f657874,0x737761,
+0x705f646e,0x73745f,0x77726974,0x65737400,0x66646f70,0x656e0064,0x75700066,0x636c6f73,
+0x65007374,0x5f736574,0x73746d61,0x67696300,0x73776170,0x5f66696c,0x65686472,0x737761,
+0x705f616f,0x75746864,0x72007377,0x61705f73,0x636e6864,0x72007377,0x61705f6c,0x69627363,
+0x6e007377,0x61705f72,0x70640073,0x7761705f,0x61757800,0x73776170,0x5f72656c,0x6f630073,
+0x7761705f,0x72616e6c,0x69620073,0x7761705f,0x67707400,0x73776170,0x5f64796e,0x616d6963,
+0x737761,0x705f7265,0x6c5f6479,0x6e007377,0x61705f72,0x6567696e,0x666f0073,0x7761705f,
+0x64796e73,0x796d0073,0x7761705f,0x636f6e66,0x6c696374,0x737761,0x705f676f,0x74007377,
+0x61705f6c,0x69626c69,0x73740073,0x7761705f,0x6d73796d,0x737761,0x705f6568,0x64720073,
+0x7761705f,0x70686472,0x737761,0x705f7368,0x64720061,0x6c6c6f63,0x5f726573,0x697a6500,
+0x78667265,0x6500616c,0x6c6f635f,0x64697370,0x6f736500,0x616c6c6f,0x635f6e65,0x7700616c,
+0x6c6f635f,0x6e657874,0x5f736362,0x616c6c,0x6f635f6d,0x61726b00,0x616c6c6f,0x635f7265,
+0x6c656173,0x65007362,0x726b0061,0x6c6c6f63,0x5f706167,0x6500616c,0x6c6f635f,0x66726565,
+0x616c6c,0x6f635f73,0x63620000,0x0,};
+static void func_403f10(uint8_t *mem, uint32_t sp);
+static void func_404008(uint8_t *mem, uint32_t sp);
+static uint32_t func_404108(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_4041a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_404234(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_404b80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_405178(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_4054e8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_405574(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4055d4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4056dc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_405884(uint8_t *mem, uint32_t sp);
+static void func_4058f0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_405a80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_405b54(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_405c28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_405de4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_406034(uint8_t *mem, uint32_t sp);
+static void func_4061f8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_406684(uint8_t *mem, uint32_t sp);
+static void func_406728(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406c48(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406fe8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_407334(uint8_t *mem, uint32_t sp);
+static void func_4075cc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4076a0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_407a20(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40848c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4085d8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4086ec(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4088b8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_408c80(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_409118(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4092fc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409850(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409b10(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409ecc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409fd0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a044(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a0d4(uint8_t *mem, uint32_t sp);
+static void func_40a160(uint8_t *mem, uint32_t sp);
+static void func_40a208(uint8_t *mem, uint32_t sp);
+static void func_40a280(uint8_t *mem, uint32_t sp);
+static void func_40a4b0(uint8_t *mem, uint32_t sp);
+static void func_40a530(uint8_t *mem, uint32_t sp);
+static void func_40a5d4(uint8_t *mem, uint32_t sp);
+static void func_40a6b8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a79c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a958(uint8_t *mem, uint32_t sp);
+static void func_40aad4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40adfc(uint8_t *mem, uint32_t sp);
+static void func_40af00(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b0f4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b340(uint8_t *mem, uint32_t sp);
+static void f_do_dot_end(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b554(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b5f0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b984(uint8_t *mem, uint32_t sp);
+static void func_40bc84(uint8_t *mem, uint32_t sp);
+static uint32_t func_40bebc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_40c048(uint8_t *mem, uint32_t sp);
+static void func_40c218(uint8_t *mem, uint32_t sp);
+static void func_40c2e0(uint8_t *mem, uint32_t sp);
+static void func_40c360(uint8_t *mem, uint32_t sp);
+static void func_40c3e0(uint8_t *mem, uint32_t sp);
+static void func_40c460(uint8_t *mem, uint32_t sp);
+static void func_40c4cc(uint8_t *mem, uint32_t sp);
+static void func_40c5e8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40c66c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_40c830(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40c928(uint8_t *mem, uint32_t sp);
+static void func_40c9d0(uint8_t *mem, uint32_t sp);
+static uint32_t func_40cc44(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40cccc(uint8_t *mem, uint32_t sp);
+static void func_40cde4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40ceb4(uint8_t *mem, uint32_t sp);
+static void func_40cf9c(uint8_t *mem, uint32_t sp);
+static void func_40d110(uint8_t *mem, uint32_t sp);
+static void func_40d284(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_Parsestmt(uint8_t *mem, uint32_t sp);
+static void func_40e180(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_sym_undefined(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40e230(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40e3f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40e554(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_40e760(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_sym_init(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_sym_finish(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_sym_enter(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_sym_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_feinit(uint8_t *mem, uint32_t sp);
+static uint32_t f_hex_to_num(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_local_label(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_unscan(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_file(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_40f5d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t func_40f77c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_hash(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_LookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_opLookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_40fb2c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_consume(uint8_t *mem, uint32_t sp);
+static uint32_t func_40fc20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40fd98(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_4100c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_4101ac(uint8_t *mem, uint32_t sp);
+static void func_410270(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_dot_soon(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_nexttoken(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_410e80(uint8_t *mem, uint32_t sp);
+static void f_readinline(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloc_new_sym(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloc_new_string(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_EnterSym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_GetRegister(uint8_t *mem, uint32_t sp);
+static uint32_t func_411898(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t func_411b84(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_411ecc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_41213c(uint8_t *mem, uint32_t sp);
+static uint64_t func_412144(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_41244c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t func_412548(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_dw_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_GetBaseOrExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_dw_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_put_binasmfyle(uint8_t *mem, uint32_t sp);
+static void f_ltoa(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_413060(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_413224(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_call_name_and_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_call_perror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_new_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_posterror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_postcerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_assertion_failed(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_which_opt(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_grow_array(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_cuinit(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_extadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_filebegin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_endallfiles(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_procend(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_procbegin(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_sym_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_pdadd_idn(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_auxbtadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_auxisymadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp);
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_fdadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_extstradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_419e30(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_writebinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_writest(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp);
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp);
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10010000);
+memcpy(mem + 0x10004a70, rodata, 0x4060);
+memcpy(mem + 0x10000000, data, 0x4a70);
+MEM_S32(0x1000a9a0) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x1000a9a4) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0, argc, arg_addr);
+return ret;
+}
+
+static void func_403f10(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, t8 = 0, t9 = 0;
+L403f10:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000000b MEM_U32(sp + 36) = s4;
+// fdead 4000000b MEM_U32(sp + 28) = s2;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+// fdead 4000000b MEM_U32(sp + 24) = s1;
+s2 = 0x10000304;
+s4 = 0x1000a1c0;
+// fdead 4028000b MEM_U32(sp + 52) = ra;
+// fdead 4028000b MEM_U32(sp + 48) = gp;
+// fdead 4028000b MEM_U32(sp + 32) = s3;
+// fdead 4028000b MEM_U32(sp + 20) = s0;
+s1 = zero;
+s5 = 0x1;
+s6 = 0x1ae;
+L403f58:
+s0 = MEM_U32(s2 + 0);
+//nop;
+t6 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L403fd4;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 40ee000b gp = MEM_U32(sp + 48);
+s3 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+t7 = s3 << 2;
+v1 = s4 + t7;
+t8 = MEM_U32(v1 + 0);
+// bdead 42ee001b gp = MEM_U32(sp + 48);
+MEM_U32(v0 + 4) = s0;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 8) = zero;
+MEM_U32(v0 + 16) = s5;
+MEM_U32(v0 + 20) = s1;
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(s2 + 4);
+//nop;
+t0 = t9 >> 25;
+MEM_U32(v0 + 24) = t0;
+MEM_U32(v1 + 0) = v0;
+L403fd4:
+s1 = s1 + 0x1;
+s2 = s2 + 0x8;
+if (s1 != s6) goto L403f58;
+// bdead 1 ra = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static void func_404008(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, fp = 0;
+L404008:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+// fdead 4000000b MEM_U32(sp + 28) = s2;
+// fdead 4000000b MEM_U32(sp + 56) = fp;
+// fdead 4000000b MEM_U32(sp + 48) = s7;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 36) = s4;
+// fdead 4000000b MEM_U32(sp + 24) = s1;
+s2 = 0x10000030;
+s5 = 0x1000a1c0;
+// fdead 4048000b MEM_U32(sp + 60) = ra;
+// fdead 4048000b MEM_U32(sp + 52) = gp;
+// fdead 4048000b MEM_U32(sp + 32) = s3;
+// fdead 4048000b MEM_U32(sp + 20) = s0;
+s1 = zero;
+s4 = 0x2e;
+s6 = 0xffffffff;
+s7 = 0x2;
+fp = 0x3f;
+L404060:
+v0 = MEM_U32(s2 + 0);
+//nop;
+t6 = MEM_U8(v0 + 0);
+//nop;
+//nop;
+if (s4 != t6) goto L4040cc;
+//nop;
+s0 = v0;
+a0 = v0;
+v0 = f_hash(mem, sp, a0);
+// bdead c1ee000b gp = MEM_U32(sp + 52);
+s3 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+t7 = s3 << 2;
+v1 = s5 + t7;
+t8 = MEM_U32(v1 + 0);
+// bdead c3ee001b gp = MEM_U32(sp + 52);
+MEM_U32(v0 + 4) = s0;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 8) = s6;
+MEM_U32(v0 + 16) = s7;
+MEM_U32(v0 + 20) = s1;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(v1 + 0) = v0;
+L4040cc:
+s1 = s1 + 0x1;
+s2 = s2 + 0x4;
+if (s1 != fp) goto L404060;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static uint32_t func_404108(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L404108:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+a0 = a1;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+t8 = 0x10009fb8;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 0) = t9;
+t0 = MEM_U32(sp + 44);
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 16) = zero;
+MEM_U32(v0 + 4) = t0;
+t1 = MEM_U32(sp + 48);
+//nop;
+MEM_U32(v0 + 8) = t1;
+t2 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(v0 + 20) = t2;
+// bdead 19 ra = MEM_U32(sp + 28);
+MEM_U32(v1 + 0) = v0;
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void func_4041a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L4041a8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+t8 = 0x10009fb8;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+t1 = 0x4;
+MEM_U32(v0 + 0) = t9;
+t0 = MEM_U32(sp + 40);
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 16) = t1;
+MEM_U32(v0 + 4) = t0;
+t2 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(v0 + 8) = t2;
+// bdead 19 ra = MEM_U32(sp + 28);
+MEM_U32(v1 + 0) = v0;
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_404234(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L404234:
+//nop;
+//nop;
+//nop;
+at = 0x1000a7ec;
+t6 = 0x10004a70;
+MEM_U32(at + 0) = zero;
+at = 0x1000a7f0;
+t6 = t6;
+MEM_U32(at + 0) = t6;
+at = 0x1000a7f4;
+sp = sp + 0xffffffa0;
+MEM_U32(at + 0) = zero;
+at = 0x1000a7f8;
+// fdead 40008067 MEM_U32(sp + 32) = s2;
+MEM_U32(at + 0) = zero;
+at = 0x1000a7e8;
+s2 = 0x1;
+MEM_U32(at + 0) = zero;
+at = 0x10008eb0;
+t7 = 0xffffffff;
+MEM_U32(at + 0) = s2;
+at = 0x10009314;
+t8 = 0x4;
+MEM_U32(at + 0) = zero;
+at = 0x10009310;
+// fdead 42098067 MEM_U32(sp + 52) = s7;
+MEM_U32(at + 0) = t7;
+at = 0x10008ee8;
+s7 = 0x10008eb8;
+MEM_U32(at + 0) = zero;
+at = 0x10009f34;
+// fdead 43098067 MEM_U32(sp + 36) = s3;
+MEM_U32(at + 0) = t8;
+at = 0x10008eb4;
+// fdead 43098067 MEM_U32(sp + 60) = ra;
+MEM_U32(at + 0) = zero;
+at = 0x10008ebc;
+// fdead 43098067 MEM_U32(sp + 56) = gp;
+MEM_U32(at + 0) = s2;
+at = 0x10008ec0;
+MEM_U32(s7 + 0) = zero;
+MEM_U32(at + 0) = zero;
+at = 0x10008ec8;
+// fdead 43098067 MEM_U32(sp + 48) = s6;
+MEM_U32(at + 0) = zero;
+at = 0x10008ecc;
+// fdead 43098067 MEM_U32(sp + 44) = s5;
+MEM_U32(at + 0) = zero;
+at = 0x10008ee0;
+// fdead 43098067 MEM_U32(sp + 40) = s4;
+MEM_U32(at + 0) = s2;
+at = 0x10008ee4;
+// fdead 43098067 MEM_U32(sp + 28) = s1;
+MEM_U32(at + 0) = zero;
+at = 0x1000a7d8;
+// fdead 43098067 MEM_U32(sp + 24) = s0;
+MEM_U32(at + 0) = zero;
+s3 = s2;
+if ((int)a0 < (int)0x2) goto L40456c;
+t9 = a0 << 2;
+t0 = t9 + a1;
+s6 = 0x10008ea8;
+s5 = 0x10008ea4;
+s4 = 0x10008eac;
+MEM_U32(sp + 64) = t0;
+s1 = a1 + 0x4;
+MEM_U32(sp + 96) = a0;
+L404344:
+a1 = MEM_U32(s1 + 0);
+at = 0x2d;
+t1 = MEM_U8(a1 + 0);
+s0 = a1;
+//nop;
+if (t1 != at) goto L404518;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_which_opt(mem, sp, a0);
+t2 = v0 + 0xfffffffe;
+at = t2 < 0x68;
+// bdead 41fe0987 gp = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 64);
+if (at == 0) goto L40455c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L404484;
+case 1: goto L404558;
+case 2: goto L404558;
+case 3: goto L404558;
+case 4: goto L404558;
+case 5: goto L404558;
+case 6: goto L404558;
+case 7: goto L404558;
+case 8: goto L404558;
+case 9: goto L404558;
+case 10: goto L404484;
+case 11: goto L404558;
+case 12: goto L404558;
+case 13: goto L404558;
+case 14: goto L404558;
+case 15: goto L404558;
+case 16: goto L404558;
+case 17: goto L404558;
+case 18: goto L404558;
+case 19: goto L404558;
+case 20: goto L404558;
+case 21: goto L404558;
+case 22: goto L4043b0;
+case 23: goto L4043a0;
+case 24: goto L4043a8;
+case 25: goto L4043b0;
+case 26: goto L4043bc;
+case 27: goto L404558;
+case 28: goto L40448c;
+case 29: goto L4043d8;
+case 30: goto L4043c8;
+case 31: goto L4043d0;
+case 32: goto L4043d8;
+case 33: goto L4043e0;
+case 34: goto L404558;
+case 35: goto L404454;
+case 36: goto L40440c;
+case 37: goto L4043e8;
+case 38: goto L4043e8;
+case 39: goto L4043f4;
+case 40: goto L404400;
+case 41: goto L404558;
+case 42: goto L404558;
+case 43: goto L404558;
+case 44: goto L404558;
+case 45: goto L404558;
+case 46: goto L4044d0;
+case 47: goto L4044dc;
+case 48: goto L4044e8;
+case 49: goto L4044f4;
+case 50: goto L404558;
+case 51: goto L404558;
+case 52: goto L404558;
+case 53: goto L404558;
+case 54: goto L404558;
+case 55: goto L404558;
+case 56: goto L4044a0;
+case 57: goto L404558;
+case 58: goto L404558;
+case 59: goto L404558;
+case 60: goto L404558;
+case 61: goto L404558;
+case 62: goto L404558;
+case 63: goto L404558;
+case 64: goto L404558;
+case 65: goto L404558;
+case 66: goto L404558;
+case 67: goto L404484;
+case 68: goto L404558;
+case 69: goto L404558;
+case 70: goto L404558;
+case 71: goto L404484;
+case 72: goto L404558;
+case 73: goto L404558;
+case 74: goto L404558;
+case 75: goto L404558;
+case 76: goto L404558;
+case 77: goto L404558;
+case 78: goto L404558;
+case 79: goto L40450c;
+case 80: goto L404500;
+case 81: goto L404558;
+case 82: goto L404558;
+case 83: goto L404558;
+case 84: goto L404468;
+case 85: goto L404558;
+case 86: goto L404558;
+case 87: goto L404558;
+case 88: goto L404558;
+case 89: goto L404558;
+case 90: goto L404558;
+case 91: goto L404558;
+case 92: goto L404558;
+case 93: goto L404484;
+case 94: goto L404558;
+case 95: goto L404558;
+case 96: goto L404558;
+case 97: goto L404558;
+case 98: goto L404558;
+case 99: goto L404558;
+case 100: goto L404558;
+case 101: goto L404558;
+case 102: goto L404558;
+case 103: goto L4044ac;
+}
+L4043a0:
+MEM_U32(s7 + 0) = zero;
+goto L404558;
+L4043a8:
+MEM_U32(s7 + 0) = s2;
+goto L404558;
+L4043b0:
+t3 = 0x2;
+MEM_U32(s7 + 0) = t3;
+goto L404558;
+L4043bc:
+t4 = 0x3;
+MEM_U32(s7 + 0) = t4;
+goto L404558;
+L4043c8:
+s3 = zero;
+goto L404558;
+L4043d0:
+s3 = s2;
+goto L404558;
+L4043d8:
+s3 = 0x2;
+goto L404558;
+L4043e0:
+s3 = 0x3;
+goto L404558;
+L4043e8:
+MEM_U32(s5 + 0) = s2;
+MEM_U32(s6 + 0) = zero;
+goto L404558;
+L4043f4:
+MEM_U32(s5 + 0) = zero;
+MEM_U32(s6 + 0) = s2;
+goto L404558;
+L404400:
+MEM_U32(s5 + 0) = s2;
+MEM_U32(s6 + 0) = s2;
+goto L404558;
+L40440c:
+at = 0x10008eb4;
+a0 = 0xfb528e4;
+a1 = 0x10004a78;
+//nop;
+MEM_U32(at + 0) = s2;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41fc0003 gp = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb528e4;
+//nop;
+a0 = a0 + 0x20;
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 64);
+goto L40455c;
+L404454:
+t5 = MEM_U32(s1 + 4);
+at = 0x1000a7f4;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t5;
+goto L404558;
+L404468:
+t6 = MEM_U32(s1 + 4);
+at = 0x1000a7f8;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t6;
+at = 0x1000a7e8;
+MEM_U32(at + 0) = s2;
+goto L404558;
+L404484:
+s1 = s1 + 0x4;
+goto L404558;
+L40448c:
+t7 = MEM_U32(s1 + 4);
+at = 0x1000a7f0;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t7;
+goto L404558;
+L4044a0:
+at = 0x10008ee4;
+MEM_U32(at + 0) = s2;
+goto L404558;
+L4044ac:
+a0 = 0x10004a80;
+//nop;
+a1 = s0;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 64);
+goto L40455c;
+L4044d0:
+t8 = 0x1;
+MEM_U8(s4 + 0) = (uint8_t)t8;
+goto L404558;
+L4044dc:
+t9 = 0x2;
+MEM_U8(s4 + 0) = (uint8_t)t9;
+goto L404558;
+L4044e8:
+t0 = 0x3;
+MEM_U8(s4 + 0) = (uint8_t)t0;
+goto L404558;
+L4044f4:
+t1 = 0x4;
+MEM_U8(s4 + 0) = (uint8_t)t1;
+goto L404558;
+L404500:
+at = 0x1000a7d8;
+MEM_U32(at + 0) = s2;
+goto L404558;
+L40450c:
+at = 0x1000a7dc;
+MEM_U32(at + 0) = s2;
+goto L404558;
+L404518:
+t2 = 0x1000a7ec;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L40453c;
+at = 0x1000a7ec;
+MEM_U32(at + 0) = a1;
+goto L404558;
+L40453c:
+a0 = 0x10004a90;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+//nop;
+L404558:
+t3 = MEM_U32(sp + 64);
+L40455c:
+s1 = s1 + 0x4;
+//nop;
+if (s1 < t3) goto L404344;
+L40456c:
+s4 = 0x10008eac;
+at = (int)s3 < (int)0x2;
+t4 = MEM_U8(s4 + 0);
+//nop;
+t5 = 0x1;
+if (t4 != 0) goto L404588;
+MEM_U8(s4 + 0) = (uint8_t)t5;
+L404588:
+t6 = 0x2;
+if (at != 0) goto L404594;
+MEM_U32(s7 + 0) = t6;
+L404594:
+a0 = 0x1000a7f0;
+a1 = 0x10004ab0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4108010b gp = MEM_U32(sp + 56);
+//nop;
+v1 = 0x1000a7d0;
+MEM_U32(v1 + 0) = v0;
+if (v0 != 0) goto L4045f4;
+a1 = 0x1000a7f0;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = s2;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 41080003 gp = MEM_U32(sp + 56);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41080103 gp = MEM_U32(sp + 56);
+//nop;
+L4045f4:
+t8 = 0x1000a7e8;
+at = 0x10008ea0;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(at + 0) = s2;
+//nop;
+if (t8 == 0) goto L40468c;
+a2 = 0x1000a7f8;
+//nop;
+a2 = MEM_U32(a2 + 0);
+//nop;
+//nop;
+if (a2 == 0) goto L40465c;
+a1 = 0x10004ab4;
+//nop;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4100010b gp = MEM_U32(sp + 56);
+//nop;
+v1 = 0x1000a7e4;
+MEM_U32(v1 + 0) = v0;
+if (v0 != 0) goto L40468c;
+a2 = 0x1000a7f8;
+//nop;
+a2 = MEM_U32(a2 + 0);
+//nop;
+L40465c:
+//nop;
+a0 = 0x1;
+a1 = a2;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+//nop;
+L40468c:
+v0 = 0x1000a7c0;
+t3 = 0x3;
+t0 = MEM_U8(v0 + 5);
+t4 = 0x13;
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x2a;
+MEM_U8(v0 + 5) = (uint8_t)t2;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 8) = t3;
+MEM_U32(v0 + 12) = t4;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s7 + 0);
+//nop;
+//nop;
+//nop;
+f_sym_init(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+//nop;
+a0 = 0x1000a7ec;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (a0 == 0) goto L404760;
+a1 = 0x10004ab8;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 56);
+a0 = v0;
+s0 = 0x1000a7d4;
+MEM_U32(s0 + 0) = v0;
+if (v0 != 0) goto L404770;
+a1 = 0x1000a7ec;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = 0x1;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s0 + 0);
+//nop;
+goto L404770;
+L404760:
+s0 = 0x1000a7d4;
+a0 = 0xfb528e4;
+//nop;
+MEM_U32(s0 + 0) = a0;
+L404770:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 56);
+at = 0x23;
+//nop;
+if (v0 == at) goto L4047ac;
+a0 = 0x1000a7ec;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_make_file(mem, sp, a0);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+//nop;
+L4047ac:
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = zero;
+a2 = zero;
+v0 = wrapper_fseek(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+s0 = zero;
+s1 = 0x1000012c;
+v1 = 0x10009f38;
+//nop;
+L4047d4:
+//nop;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe005f t9 = t9;
+a0 = s0;
+a2 = s0;
+MEM_U32(sp + 68) = v1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 68);
+s0 = s0 + 0x1;
+at = (int)s0 < (int)0x20;
+// bdead 4006001f gp = MEM_U32(sp + 56);
+s1 = s1 + 0x4;
+v1 = v1 + 0x4;
+MEM_U32(v1 + -4) = v0;
+if (at != 0) goto L4047d4;
+s1 = 0x1000012c;
+s0 = 0x20;
+s1 = s1 + 0x80;
+L40481c:
+//nop;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe005f t9 = t9;
+a0 = s0;
+a2 = s0 + 0xffffffe0;
+v0 = func_404108(mem, sp, a0, a1, a2);
+s0 = s0 + 0x1;
+at = (int)s0 < (int)0x40;
+// bdead 40060007 gp = MEM_U32(sp + 56);
+s1 = s1 + 0x4;
+if (at != 0) goto L40481c;
+s1 = 0x1000012c;
+s0 = 0x40;
+s2 = 0x48;
+s1 = s1 + 0x100;
+L404858:
+//nop;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe005f t9 = t9;
+a0 = s0;
+a2 = s0 + 0xffffffc0;
+v0 = func_404108(mem, sp, a0, a1, a2);
+s0 = s0 + 0x1;
+// bdead 400e0003 gp = MEM_U32(sp + 56);
+s1 = s1 + 0x4;
+if (s0 != s2) goto L404858;
+//nop;
+a1 = 0x10004abc;
+// fdead 61fe005f t9 = t9;
+a0 = 0x1;
+a2 = 0x1;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1a;
+//nop;
+a1 = 0x10004ac0;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1b;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1b;
+//nop;
+a1 = 0x10004ac8;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1c;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1c;
+//nop;
+a1 = 0x10004ad0;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1d;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1d;
+//nop;
+a1 = 0x10004ad4;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1e;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1e;
+//nop;
+a1 = 0x10004ad8;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1f;
+a1 = a1;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1d;
+a1 = 0x100002fc;
+//nop;
+a1 = MEM_U32(a1 + 0);
+// fdead 61fe007f t9 = t9;
+a2 = 0x1d;
+v0 = func_404108(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a1 = zero;
+a0 = 0x10000300;
+//nop;
+a0 = MEM_U32(a0 + 0);
+// fdead 61fe007f t9 = t9;
+//nop;
+func_4041a8(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+//nop;
+//nop;
+//nop;
+// fdead 61fe001f t9 = t9;
+//nop;
+func_404008(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+//nop;
+//nop;
+//nop;
+// fdead 61fe001f t9 = t9;
+//nop;
+func_403f10(mem, sp);
+// bdead 3 gp = MEM_U32(sp + 56);
+//nop;
+v0 = 0x1000a3c0;
+//nop;
+v1 = v0 + 0x400;
+L4049c8:
+v0 = v0 + 0x10;
+MEM_U32(v0 + -16) = zero;
+MEM_U32(v0 + -12) = zero;
+MEM_U32(v0 + -8) = zero;
+MEM_U32(v0 + -4) = zero;
+if (v0 != v1) goto L4049c8;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L404a0c:
+//main:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 40000063 MEM_U32(sp + 28) = ra;
+// fdead 40000063 t9 = t9;
+// fdead 40000063 MEM_U32(sp + 24) = gp;
+// fdead 40000063 MEM_U32(sp + 20) = s0;
+func_404234(mem, sp, a0, a1);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+//nop;
+s0 = 0x1000a7d4;
+//nop;
+t6 = MEM_U32(s0 + 0);
+//nop;
+t7 = MEM_U8(t6 + 12);
+//nop;
+t8 = t7 & 0x10;
+//nop;
+if (t8 != 0) goto L404aa4;
+L404a60:
+//nop;
+//nop;
+//nop;
+f_readinline(mem, sp);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_Parsestmt(mem, sp);
+t9 = MEM_U32(s0 + 0);
+// bdead 44020183 gp = MEM_U32(sp + 24);
+t0 = MEM_U8(t9 + 12);
+//nop;
+t1 = t0 & 0x10;
+//nop;
+if (t1 == 0) goto L404a60;
+L404aa4:
+t2 = 0x10008eb4;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L404adc;
+a0 = 0xfb528e4;
+a1 = 0x10004adc;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L404adc:
+v0 = 0x10009f34;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if ((int)v0 < (int)0x2) goto L404b18;
+t3 = 0x10008ea8;
+at = (int)v0 < (int)0x3;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L404b30;
+//nop;
+if (at == 0) goto L404b30;
+L404b18:
+//nop;
+a0 = 0x1;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L404b30:
+//nop;
+a0 = 0x1;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1000a7f0;
+a1 = 0x1000a7f4;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+f_sym_finish(mem, sp, a0, a1);
+// bdead 3 ra = MEM_U32(sp + 28);
+// bdead 3 gp = MEM_U32(sp + 24);
+// bdead 3 s0 = MEM_U32(sp + 20);
+// bdead 3 sp = sp + 0x20;
+v0 = zero;
+return v0;
+//nop;
+}
+
+static void func_404b80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404b80:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+v1 = 0x1;
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+// fdead 400001fb MEM_U32(sp + 24) = gp;
+a3 = a0;
+if (a0 == v1) goto L404bb8;
+at = 0x2;
+if (a0 == at) {
+at = 0x3;
+goto L404bd8;}
+at = 0x3;
+//nop;
+if (a0 == at) goto L404bf8;
+L404bb8:
+t7 = 0x10000304;
+t6 = a2 << 3;
+t8 = t6 + t7;
+v0 = MEM_U32(t8 + 4);
+//nop;
+t9 = v0 << 17;
+v0 = t9 >> 27;
+goto L404c14;
+L404bd8:
+t2 = 0x10000304;
+t1 = a2 << 3;
+t3 = t1 + t2;
+v0 = MEM_U32(t3 + 4);
+//nop;
+t4 = v0 << 22;
+v0 = t4 >> 27;
+goto L404c14;
+L404bf8:
+t7 = 0x10000304;
+t6 = a2 << 3;
+t8 = t6 + t7;
+v0 = MEM_U32(t8 + 4);
+//nop;
+t9 = v0 & 0x1f;
+v0 = t9;
+L404c14:
+// bdead 40000159 ra = MEM_U32(sp + 28);
+if (v0 >= 0xd) goto L40516c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (v0) {
+case 0: goto L405168;
+case 1: goto L404c40;
+case 2: goto L404cd4;
+case 3: goto L404d3c;
+case 4: goto L404e80;
+case 5: goto L404ec8;
+case 6: goto L404f30;
+case 7: goto L404dd4;
+case 8: goto L404e18;
+case 9: goto L404fe8;
+case 10: goto L405044;
+case 11: goto L405098;
+case 12: goto L405124;
+}
+L404c40:
+t1 = 0x10008ebc;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L404c90;
+t2 = a3 << 2;
+if (a1 != v1) goto L404c90;
+t3 = 0x10000004;
+a0 = 0x10004ca8;
+t3 = t3;
+//nop;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404c90:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404ca0;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if ((int)a1 < (int)0x20) goto L40516c;
+L404ca0:
+t6 = 0x10000004;
+t5 = a3 << 2;
+t6 = t6;
+a0 = 0x10004cc4;
+//nop;
+t7 = t5 + t6;
+a1 = MEM_U32(t7 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404cd4:
+t8 = 0x10008eac;
+//nop;
+t8 = MEM_U8(t8 + 0);
+//nop;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if ((int)t8 >= (int)0x3) goto L40516c;
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404d08;
+t9 = a1 & 0x1;
+if ((int)a1 >= (int)0x20) goto L404d08;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t9 == 0) goto L40516c;
+L404d08:
+t1 = 0x10000004;
+t0 = a3 << 2;
+t1 = t1;
+a0 = 0x10004cdc;
+//nop;
+t2 = t0 + t1;
+a1 = MEM_U32(t2 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404d3c:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404d48;
+if ((int)a1 < (int)0x20) {
+at = 0x48;
+goto L404d84;}
+L404d48:
+at = 0x48;
+t3 = a3 << 2;
+if (a1 == at) goto L404d84;
+t4 = 0x10000004;
+a0 = 0x10004cf8;
+t4 = t4;
+//nop;
+t5 = t3 + t4;
+a1 = MEM_U32(t5 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404d84:
+t6 = 0x10008ebc;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+// bdead 40000151 ra = MEM_U32(sp + 28);
+if (t6 == 0) goto L40516c;
+t7 = a3 << 2;
+if (a1 != v1) goto L405168;
+t8 = 0x10000004;
+a0 = 0x10004d10;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404dd4:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404de4;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if ((int)a1 < (int)0x20) goto L40516c;
+L404de4:
+t1 = 0x10000004;
+t0 = a3 << 2;
+t1 = t1;
+a0 = 0x10004d2c;
+//nop;
+t2 = t0 + t1;
+a1 = MEM_U32(t2 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404e18:
+t3 = 0x10008eac;
+//nop;
+t3 = MEM_U8(t3 + 0);
+//nop;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if ((int)t3 >= (int)0x3) goto L40516c;
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404e4c;
+t4 = a1 & 0x1;
+if ((int)a1 >= (int)0x20) goto L404e4c;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t4 == 0) goto L40516c;
+L404e4c:
+t6 = 0x10000004;
+t5 = a3 << 2;
+t6 = t6;
+a0 = 0x10004d4c;
+//nop;
+t7 = t5 + t6;
+a1 = MEM_U32(t7 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404e80:
+t8 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404e98;
+// bdead 42000101 ra = MEM_U32(sp + 28);
+if ((int)a1 < (int)0x40) goto L40516c;
+L404e98:
+t9 = 0x10000004;
+a0 = 0x10004d70;
+t9 = t9;
+t0 = t8 + t9;
+//nop;
+a1 = MEM_U32(t0 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404ec8:
+t1 = 0x10008eac;
+//nop;
+t1 = MEM_U8(t1 + 0);
+//nop;
+if ((int)t1 >= (int)0x3) {
+at = (int)a1 < (int)0x20;
+goto L405168;}
+t3 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404f00;
+t2 = a1 & 0x1;
+if ((int)a1 >= (int)0x40) goto L404f00;
+// bdead 40001101 ra = MEM_U32(sp + 28);
+if (t2 == 0) goto L40516c;
+L404f00:
+t4 = 0x10000004;
+a0 = 0x10004d94;
+t4 = t4;
+//nop;
+t5 = t3 + t4;
+a1 = MEM_U32(t5 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404f30:
+t6 = 0x10008eac;
+//nop;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if ((int)t6 < (int)0x3) {
+at = (int)a1 < (int)0x20;
+goto L404f98;}
+t8 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404f68;
+t7 = a1 & 0x1;
+if ((int)a1 >= (int)0x40) goto L404f68;
+// bdead 42000101 ra = MEM_U32(sp + 28);
+if (t7 == 0) goto L40516c;
+L404f68:
+t9 = 0x10000004;
+a0 = 0x10004dbc;
+t9 = t9;
+t0 = t8 + t9;
+//nop;
+a1 = MEM_U32(t0 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404f98:
+t2 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404fb8;
+t1 = a1 & 0x3;
+if ((int)a1 >= (int)0x40) goto L404fb8;
+// bdead 40000901 ra = MEM_U32(sp + 28);
+if (t1 == 0) goto L40516c;
+L404fb8:
+t3 = 0x10000004;
+a0 = 0x10004de4;
+t3 = t3;
+//nop;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L404fe8:
+t5 = 0x10008eac;
+//nop;
+t5 = MEM_U8(t5 + 0);
+//nop;
+if ((int)t5 >= (int)0x3) {
+at = (int)a1 < (int)0x20;
+goto L405168;}
+t6 = a1 & 0x1;
+if ((int)a1 < (int)0x20) goto L405168;
+t7 = a3 << 2;
+if (t6 == 0) goto L405168;
+t8 = 0x10000004;
+a0 = 0x10004e14;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L405044:
+t0 = 0x10008eac;
+t1 = a1 & 0x1;
+t0 = MEM_U8(t0 + 0);
+//nop;
+// bdead 40000501 ra = MEM_U32(sp + 28);
+if ((int)t0 >= (int)0x3) goto L40516c;
+t2 = a3 << 2;
+if (t1 == 0) goto L405168;
+t3 = 0x10000004;
+a0 = 0x10004e40;
+t3 = t3;
+//nop;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L405098:
+t5 = 0x10008eac;
+t6 = a1 & 0x1;
+t5 = MEM_U8(t5 + 0);
+t0 = a1 & 0x3;
+//nop;
+if ((int)t5 < (int)0x3) goto L4050ec;
+t7 = a3 << 2;
+if (t6 == 0) goto L405168;
+t8 = 0x10000004;
+a0 = 0x10004e64;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L4050ec:
+t1 = a3 << 2;
+if (t0 == 0) goto L405168;
+t2 = 0x10000004;
+a0 = 0x10004e88;
+t2 = t2;
+//nop;
+t3 = t1 + t2;
+a1 = MEM_U32(t3 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40516c;
+L405124:
+t4 = a3 << 2;
+if ((int)a1 < (int)0x40) goto L40513c;
+// bdead 40002101 ra = MEM_U32(sp + 28);
+if ((int)a1 < (int)0x48) goto L40516c;
+L40513c:
+t5 = 0x10000004;
+a0 = 0x10004eac;
+t5 = t5;
+//nop;
+t6 = t4 + t5;
+a1 = MEM_U32(t6 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L405168:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40516c:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405178(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L405178:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+t1 = a1 << 1;
+t3 = MEM_U16(v0 + 6);
+t2 = t1 & 0x3fe;
+t1 = MEM_U8(v0 + 8);
+t4 = t3 & 0xfc01;
+t6 = MEM_U8(v0 + 5);
+t5 = t2 | t4;
+t9 = a2 << 1;
+t3 = t1 & 0xff01;
+t2 = t9 | t3;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x17;
+MEM_U8(v0 + 8) = (uint8_t)t2;
+t7 = MEM_U16(v0 + 8);
+MEM_U16(v0 + 6) = (uint16_t)t5;
+t5 = a3 << 2;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+t6 = t5 & 0x1fc;
+t8 = t7 & 0xfe03;
+t1 = t6 | t8;
+MEM_U16(v0 + 8) = (uint16_t)t1;
+v1 = MEM_U32(v0 + 8);
+sp = sp + 0xffffffe0;
+t3 = MEM_U32(sp + 48);
+t2 = v1 >> 14;
+t4 = t3 ^ t2;
+t5 = t4 << 28;
+t7 = t5 >> 14;
+t0 = 0x10000000;
+t6 = t7 ^ v1;
+MEM_U32(v0 + 0) = a0;
+MEM_U32(v0 + 8) = t6;
+t8 = MEM_U32(t0 + 0);
+t3 = MEM_U16(v0 + 4);
+t1 = t8 << 6;
+t9 = t1 & 0x1c0;
+t2 = t3 & 0xfe3f;
+// fdead 4601fffb MEM_U32(sp + 20) = s0;
+t4 = t9 | t2;
+s0 = a1;
+// fdead 4603fffb MEM_U32(sp + 28) = ra;
+// fdead 4603fffb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+MEM_U16(v0 + 4) = (uint16_t)t4;
+if (t8 == 0) goto L405248;
+v1 = MEM_U32(sp + 56);
+//nop;
+MEM_U32(v0 + 12) = v1;
+L405248:
+t5 = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 56);
+//nop;
+if (t5 >= 0x10) goto L4054a0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L4053b8;
+case 1: goto L4053b8;
+case 2: goto L405344;
+case 3: goto L4052c0;
+case 4: goto L4053b8;
+case 5: goto L405454;
+case 6: goto L40533c;
+case 7: goto L405430;
+case 8: goto L405454;
+case 9: goto L405430;
+case 10: goto L4054c4;
+case 11: goto L4054c4;
+case 12: goto L405404;
+case 13: goto L405498;
+case 14: goto L405380;
+case 15: goto L40527c;
+}
+L40527c:
+a1 = 0x1000a800;
+t8 = MEM_U8(v0 + 11);
+a1 = MEM_U32(a1 + 0);
+//nop;
+t1 = t8 & 0xff80;
+t6 = a1 & 0x7f;
+t3 = t6 | t1;
+// bdead 40021149 t9 = t9;
+MEM_U8(v0 + 11) = (uint8_t)t3;
+a0 = 0x3;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 44);
+v0 = 0x1000a7c0;
+//nop;
+L4052c0:
+t2 = MEM_U32(sp + 52);
+t7 = MEM_U16(v0 + 10);
+//nop;
+t4 = t2 << 7;
+t5 = t4 & 0x3f80;
+t8 = t7 & 0xc07f;
+t6 = t5 | t8;
+a1 = MEM_U32(sp + 40);
+// bdead 40028149 t9 = t9;
+MEM_U16(v0 + 10) = (uint16_t)t6;
+a0 = 0x1;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+//nop;
+a0 = 0x2;
+// fdead 6002007f t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 52);
+//nop;
+a0 = 0x3;
+// fdead 6002007f t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L4054c4;
+L40533c:
+MEM_U32(v0 + 12) = v1;
+goto L4054c4;
+L405344:
+t1 = MEM_U32(sp + 40);
+at = 0x48;
+a0 = 0x1;
+if (t1 == at) goto L405378;
+//nop;
+a1 = t1;
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 56);
+v0 = 0x1000a7c0;
+//nop;
+L405378:
+MEM_U32(v0 + 12) = v1;
+goto L4054c4;
+L405380:
+at = 0x48;
+a0 = 0x2;
+if (a3 == at) goto L4053b0;
+//nop;
+a1 = a3;
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 56);
+v0 = 0x1000a7c0;
+//nop;
+L4053b0:
+MEM_U32(v0 + 12) = v1;
+goto L4054c4;
+L4053b8:
+//nop;
+a1 = MEM_U32(sp + 40);
+// bdead 40020141 t9 = t9;
+a0 = 0x1;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+//nop;
+a0 = 0x2;
+// fdead 6002007f t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t3 = MEM_U32(sp + 56);
+v0 = 0x1000a7c0;
+MEM_U32(v0 + 12) = t3;
+goto L4054c4;
+L405404:
+//nop;
+a1 = MEM_U32(sp + 40);
+// bdead 40020041 t9 = t9;
+a0 = 0x1;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 56);
+v0 = 0x1000a7c0;
+MEM_U32(v0 + 12) = t9;
+goto L4054c4;
+L405430:
+//nop;
+a1 = MEM_U32(sp + 40);
+// bdead 40020041 t9 = t9;
+a0 = 0x1;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L4054c4;
+L405454:
+//nop;
+a1 = MEM_U32(sp + 40);
+// bdead 40020141 t9 = t9;
+a0 = 0x1;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+//nop;
+a0 = 0x2;
+// fdead 6002007f t9 = t9;
+a2 = s0;
+func_404b80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L4054c4;
+L405498:
+MEM_U32(v0 + 12) = v1;
+goto L4054c4;
+L4054a0:
+a0 = 0x10004ee0;
+a1 = 0x10004ee8;
+//nop;
+a2 = 0xed;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L4054c4:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_4054e8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L4054e8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+a3 = a0;
+a0 = 0x1000a7e4;
+a2 = 0x10008ea0;
+MEM_U32(sp + 36) = a1;
+a1 = 0x10004ef4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a0 = MEM_U32(a0 + 0);
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+v0 = MEM_U32(sp + 36);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L405540;
+a2 = v0;
+goto L40554c;
+L405540:
+a2 = 0x10004f04;
+//nop;
+a2 = a2;
+L40554c:
+a0 = 0x1000a7e4;
+a1 = 0x10004efc;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_405574(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L405574:
+//nop;
+//nop;
+//nop;
+v1 = 0x10008ec4;
+t7 = 0x1;
+t6 = MEM_U32(v1 + 0);
+t8 = t7 << (a0 & 0x1f);
+a1 = 0x10008ec8;
+t9 = t6 + t8;
+t0 = t9 + 0xffffffff;
+v0 = MEM_U32(a1 + 0);
+t1 = (int)t0 >> (a0 & 0x1f);
+t2 = t1 << (a0 & 0x1f);
+MEM_U32(v1 + 0) = t2;
+if (v0 == 0) goto L4055cc;
+L4055b0:
+t3 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 8) = t3;
+v0 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if (v0 != 0) goto L4055b0;
+L4055cc:
+MEM_U32(a1 + 0) = zero;
+return;
+}
+
+static void func_4055d4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4055d4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a2 = 0x2;
+if (v0 == 0) goto L405628;
+a0 = 0x10004f08;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L4056d0;
+L405628:
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+t8 = 0x10009fb8;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(sp + 44) = v0;
+MEM_U32(v0 + 0) = t9;
+//nop;
+a0 = MEM_U32(sp + 48);
+MEM_U32(sp + 36) = v1;
+v0 = f_alloc_new_string(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 44);
+v1 = MEM_U32(sp + 36);
+a0 = 0x10008ec8;
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+t1 = MEM_U32(a0 + 0);
+t4 = 0x4;
+MEM_U32(t2 + 12) = t1;
+t3 = MEM_U32(sp + 44);
+t5 = MEM_U32(sp + 44);
+MEM_U32(a0 + 0) = t3;
+MEM_U32(t5 + 16) = t4;
+t6 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t6 + 8) = zero;
+t7 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(v1 + 0) = t7;
+// bdead 1 ra = MEM_U32(sp + 28);
+L4056d0:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_4056dc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4056dc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L4057b8;
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+t8 = 0x10009fb8;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(sp + 44) = v0;
+MEM_U32(v0 + 0) = t9;
+//nop;
+a0 = MEM_U32(sp + 48);
+MEM_U32(sp + 32) = v1;
+v0 = f_alloc_new_string(mem, sp, a0);
+t0 = MEM_U32(sp + 44);
+// bdead 4000038b gp = MEM_U32(sp + 24);
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+t1 = 0x4;
+MEM_U32(t2 + 16) = t1;
+t4 = MEM_U32(sp + 44);
+t3 = 0x1;
+MEM_U32(t4 + 20) = t3;
+//nop;
+a0 = MEM_U32(sp + 48);
+a1 = zero;
+v0 = f_sym_enter(mem, sp, a0, a1);
+t5 = MEM_U32(sp + 44);
+// bdead 4000410b gp = MEM_U32(sp + 24);
+MEM_U32(t5 + 24) = v0;
+t7 = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t7 + 0) = t6;
+L4057b8:
+t8 = MEM_U32(sp + 44);
+t9 = 0x4;
+MEM_U32(t8 + 12) = zero;
+t0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t0 + 16) = t9;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t1 = MEM_U32(sp + 44);
+// bdead 40000409 gp = MEM_U32(sp + 24);
+MEM_U32(t1 + 8) = v0;
+t2 = MEM_U32(sp + 44);
+//nop;
+a0 = MEM_U32(t2 + 24);
+a2 = MEM_U32(t2 + 8);
+a1 = 0x5;
+f_sym_define(mem, sp, a0, a1, a2);
+t3 = MEM_U32(sp + 36);
+// bdead 40001001 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+if (t3 == 0) goto L405878;
+v0 = 0x1000a7c0;
+t4 = MEM_U32(sp + 44);
+t6 = MEM_U8(v0 + 5);
+t5 = MEM_U32(t4 + 24);
+t7 = t6 & 0xffc0;
+t9 = MEM_U32(sp + 44);
+t8 = t7 | 0x29;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+MEM_U32(v0 + 0) = t5;
+t0 = MEM_U32(t9 + 8);
+//nop;
+MEM_U32(v0 + 8) = t0;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L405878:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static uint32_t func_405884(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L405884:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 < 0) goto L4058bc;
+if ((int)v0 < (int)0x400) {
+v0 = v1;
+goto L4058e0;}
+v0 = v1;
+L4058bc:
+a0 = 0x10004f20;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L4058e0;
+L4058e0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void func_4058f0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4058f0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+at = 0x1b;
+// fdead 400000ef MEM_U32(sp + 44) = ra;
+// fdead 400000ef MEM_U32(sp + 40) = gp;
+a1 = a0;
+if (a0 == at) goto L4059d4;
+at = 0x198;
+a2 = zero;
+if (a0 != at) goto L405954;
+//nop;
+t6 = 0x3;
+// fdead 400080ef t9 = t9;
+MEM_U32(sp + 16) = t6;
+a0 = zero;
+a1 = 0x2;
+a3 = zero;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L405a74;
+L405954:
+at = 0x199;
+a0 = zero;
+if (a1 != at) goto L4059a0;
+t9 = 0x1;
+MEM_U32(sp + 24) = t9;
+//nop;
+t7 = 0x4;
+t8 = 0x48;
+// bdead 42010003 t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = 0x4f;
+a2 = zero;
+a3 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L405a74;
+L4059a0:
+//nop;
+t1 = 0x2;
+t2 = 0x48;
+// fdead 40000cef t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L405a74;
+L4059d4:
+//nop;
+MEM_U32(sp + 56) = a1;
+// fdead 400000ef t9 = t9;
+//nop;
+v0 = func_405884(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 56);
+t3 = 0x10009720;
+at = 0x23;
+t3 = MEM_U8(t3 + 0);
+t0 = v0;
+//nop;
+if (t3 != at) goto L405a10;
+v1 = zero;
+goto L405a34;
+L405a10:
+//nop;
+MEM_U32(sp + 56) = a1;
+// fdead 6000125f t9 = t9;
+MEM_U32(sp + 52) = t0;
+v0 = func_405884(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 56);
+t0 = MEM_U32(sp + 52);
+v1 = v0;
+L405a34:
+//nop;
+t6 = v1 << 10;
+t7 = t6 + t0;
+t4 = 0xd;
+t5 = 0x48;
+// fdead 6001f25f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = t7;
+a0 = zero;
+a2 = 0x48;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 44);
+L405a74:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_405a80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t6 = 0;
+L405a80:
+//nop;
+//nop;
+//nop;
+v0 = 0x10009720;
+sp = sp + 0xffffffe0;
+v0 = MEM_U8(v0 + 0);
+at = 0x3a;
+// fdead 4000006f MEM_U32(sp + 28) = ra;
+// fdead 4000006f MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+if (v0 != at) goto L405ae4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 36);
+// bdead 8009 gp = MEM_U32(sp + 24);
+MEM_U32(t6 + 0) = v0;
+goto L405b44;
+L405ae4:
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L405af8;}
+at = 0x2d;
+if (v0 != at) {
+at = 0x23;
+goto L405b18;}
+at = 0x23;
+L405af8:
+//nop;
+a1 = MEM_U32(sp + 36);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405b48;
+at = 0x23;
+L405b18:
+if (v0 == at) {
+at = 0x2c;
+goto L405b44;}
+at = 0x2c;
+a1 = zero;
+if (v0 == at) goto L405b44;
+a0 = 0x10004f3c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L405b44:
+// bdead 1 ra = MEM_U32(sp + 28);
+L405b48:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405b54(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t6 = 0;
+L405b54:
+//nop;
+//nop;
+//nop;
+v0 = 0x10009720;
+sp = sp + 0xffffffe0;
+v0 = MEM_U8(v0 + 0);
+at = 0x3a;
+// fdead 400000ef MEM_U32(sp + 28) = ra;
+// fdead 400000ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+if (v0 != at) goto L405bb8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 40);
+// bdead 8009 gp = MEM_U32(sp + 24);
+MEM_U32(t6 + 0) = v0;
+goto L405c18;
+L405bb8:
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L405bcc;}
+at = 0x2d;
+if (v0 != at) {
+at = 0x23;
+goto L405bec;}
+at = 0x23;
+L405bcc:
+//nop;
+a2 = MEM_U32(sp + 40);
+//nop;
+f_dw_GetItem(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405c1c;
+at = 0x23;
+L405bec:
+if (v0 == at) {
+at = 0x2c;
+goto L405c18;}
+at = 0x2c;
+a1 = zero;
+if (v0 == at) goto L405c18;
+a0 = 0x10004f5c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L405c18:
+// bdead 1 ra = MEM_U32(sp + 28);
+L405c1c:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405c28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+L405c28:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+at = (int)a1 < (int)0x11;
+s0 = a1;
+s1 = a0;
+s2 = a2;
+s3 = a3;
+// fdead 401e01ef MEM_U32(sp + 44) = ra;
+// fdead 401e01ef MEM_U32(sp + 40) = gp;
+if (at != 0) goto L405c6c;
+s0 = 0x10;
+L405c6c:
+a0 = zero;
+if ((int)s0 <= 0) goto L405cf4;
+a2 = s0 & 0x3;
+a1 = a2;
+if (a2 == 0) goto L405cac;
+t6 = -s0;
+t8 = sp + 0x48;
+v0 = t6 + t8;
+v1 = s1;
+L405c90:
+t9 = MEM_U8(v1 + 0);
+a0 = a0 + 0x1;
+v0 = v0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(v0 + 15) = (uint8_t)t9;
+if (a1 != a0) goto L405c90;
+if (a0 == s0) {
+t0 = -s0;
+goto L405cf0;}
+L405cac:
+t0 = -s0;
+t1 = a0 + t0;
+t2 = sp + 0x48;
+v0 = t1 + t2;
+v1 = s1 + a0;
+L405cc0:
+t3 = MEM_U8(v1 + 0);
+a0 = a0 + 0x4;
+MEM_U8(v0 + 16) = (uint8_t)t3;
+t4 = MEM_U8(v1 + 1);
+v0 = v0 + 0x4;
+MEM_U8(v0 + 13) = (uint8_t)t4;
+t5 = MEM_U8(v1 + 2);
+v1 = v1 + 0x4;
+MEM_U8(v0 + 14) = (uint8_t)t5;
+t6 = MEM_U8(v1 + -1);
+MEM_U8(v0 + 15) = (uint8_t)t6;
+if (a0 != s0) goto L405cc0;
+L405cf0:
+a0 = zero;
+L405cf4:
+t7 = 0x10;
+a1 = t7 - s0;
+s1 = sp + 0x50;
+if ((int)a1 <= 0) goto L405d58;
+v0 = a1 & 0x3;
+v1 = v0;
+if (v0 == 0) goto L405d30;
+t8 = sp + 0x48;
+s0 = a0 + t8;
+v0 = 0x30;
+L405d1c:
+a0 = a0 + 0x1;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+s0 = s0 + 0x1;
+if (v1 != a0) goto L405d1c;
+if (a0 == a1) {
+t9 = sp + 0x48;
+goto L405d58;}
+L405d30:
+t9 = sp + 0x48;
+s0 = a0 + t9;
+v1 = a1 + t9;
+v0 = 0x30;
+L405d40:
+s0 = s0 + 0x4;
+MEM_U8(s0 + -3) = (uint8_t)v0;
+MEM_U8(s0 + -2) = (uint8_t)v0;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+MEM_U8(s0 + -4) = (uint8_t)v0;
+if (s0 != v1) goto L405d40;
+L405d58:
+MEM_U32(s2 + 0) = zero;
+MEM_U32(s3 + 0) = zero;
+s0 = sp + 0x48;
+L405d64:
+//nop;
+a0 = MEM_U8(s0 + 0);
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t0 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+t1 = t0 << 4;
+at = s0 < s1;
+t2 = v0 + t1;
+// bdead 401e0805 gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 0) = t2;
+if (at != 0) goto L405d64;
+s0 = sp + 0x50;
+s1 = sp + 0x58;
+L405d9c:
+//nop;
+a0 = MEM_U8(s0 + 0);
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t3 = MEM_U32(s3 + 0);
+s0 = s0 + 0x1;
+t4 = t3 << 4;
+t5 = v0 + t4;
+// bdead 40164001 gp = MEM_U32(sp + 40);
+MEM_U32(s3 + 0) = t5;
+if (s0 != s1) goto L405d9c;
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static uint32_t func_405de4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L405de4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+// fdead 400001ef MEM_U32(sp + 28) = ra;
+// fdead 400001ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+if (v0 != at) goto L405f1c;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x2c;
+if (v0 != 0) goto L405e50;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L405e50:
+t6 = MEM_U32(sp + 44);
+at = 0x4;
+v0 = MEM_U32(t6 + 16);
+a0 = MEM_U32(sp + 52);
+if (v0 != at) {
+at = 0x3;
+goto L405e8c;}
+at = 0x3;
+//nop;
+a1 = MEM_U32(sp + 56);
+a2 = MEM_U32(sp + 60);
+//nop;
+f_dw_GetItem(mem, sp, a0, a1, a2);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L405ff0;
+at = 0x3;
+L405e8c:
+a1 = zero;
+if (v0 != at) goto L405ee4;
+t7 = MEM_U32(sp + 44);
+t9 = MEM_U32(sp + 48);
+t8 = MEM_U32(t7 + 24);
+//nop;
+MEM_U32(t9 + 0) = t8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 52);
+//nop;
+a1 = MEM_U32(sp + 56);
+a2 = MEM_U32(sp + 60);
+// fdead 600000ff t9 = t9;
+//nop;
+func_405b54(mem, sp, a0, a1, a2);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L405ff0;
+L405ee4:
+a0 = 0x10004f7c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L406024;
+L405f1c:
+at = 0x22;
+//nop;
+if (v0 != at) goto L405f7c;
+//nop;
+a0 = 0x10009728;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 52);
+//nop;
+a3 = MEM_U32(sp + 56);
+a0 = 0x10009728;
+// fdead 600001af t9 = t9;
+a1 = v0;
+func_405c28(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L405f98;
+L405f7c:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L405f98:
+t0 = 0x10009720;
+at = 0x3a;
+t0 = MEM_U8(t0 + 0);
+t3 = MEM_U32(sp + 60);
+t2 = 0x1;
+if (t0 != at) goto L405fec;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t1 = MEM_U32(sp + 60);
+// bdead 40000509 gp = MEM_U32(sp + 24);
+MEM_U32(t1 + 0) = v0;
+goto L405ff0;
+t2 = 0x1;
+L405fec:
+MEM_U32(t3 + 0) = t2;
+L405ff0:
+t4 = 0x10009720;
+at = 0x2c;
+t4 = MEM_U8(t4 + 0);
+//nop;
+v0 = 0x1;
+if (t4 != at) goto L406024;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+v0 = 0x1;
+L406024:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void func_406034(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L406034:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 56) = fp;
+// fdead 4000806b MEM_U32(sp + 52) = gp;
+// fdead 4000806b MEM_U32(sp + 48) = s7;
+// fdead 4000806b MEM_U32(sp + 44) = s6;
+// fdead 4000806b MEM_U32(sp + 40) = s5;
+// fdead 4000806b MEM_U32(sp + 36) = s4;
+// fdead 4000806b MEM_U32(sp + 32) = s3;
+// fdead 4000806b MEM_U32(sp + 28) = s2;
+// fdead 4000806b MEM_U32(sp + 24) = s1;
+// fdead 4000806b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L406098;
+//nop;
+a0 = 0x2;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+//nop;
+L406098:
+fp = 0x10009720;
+s6 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+s7 = 0x23;
+s5 = sp + 0x50;
+s4 = sp + 0x48;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+L4060bc:
+//nop;
+t7 = 0x1;
+// bdead c1ff0003 t9 = t9;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+a3 = s5;
+v0 = func_405de4(mem, sp, a0, a1, a2, a3);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+// bdead c1fe0003 ra = MEM_U32(sp + 60);
+if (v0 == 0) goto L4061cc;
+t8 = MEM_U32(s6 + 0);
+t2 = MEM_U32(sp + 84);
+//nop;
+if (t8 == 0) goto L406140;
+v0 = MEM_U32(sp + 80);
+//nop;
+t9 = v0 << 2;
+v0 = t9;
+if ((int)t9 >= (int)0x4) goto L406128;
+v1 = 0x4;
+goto L40612c;
+L406128:
+v1 = v0;
+L40612c:
+t0 = MEM_U32(s1 + 0);
+//nop;
+t1 = v1 + t0;
+MEM_U32(s1 + 0) = t1;
+goto L4061b8;
+L406140:
+t3 = MEM_U8(s0 + 5);
+t6 = MEM_U32(sp + 76);
+t7 = MEM_U32(sp + 80);
+t4 = t3 & 0xffc0;
+t5 = t4 | 0x3b;
+MEM_U32(s0 + 0) = t2;
+MEM_U8(s0 + 5) = (uint8_t)t5;
+MEM_U32(s0 + 8) = t6;
+MEM_U32(s0 + 12) = t7;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t9 = MEM_U8(s0 + 5);
+t8 = MEM_U32(sp + 84);
+t2 = MEM_U32(sp + 72);
+t3 = MEM_U32(sp + 80);
+t0 = t9 & 0xffc0;
+// bdead c3fe1a03 gp = MEM_U32(sp + 52);
+t1 = t0 | 0x3b;
+MEM_U8(s0 + 5) = (uint8_t)t1;
+MEM_U32(s0 + 0) = t8;
+MEM_U32(s0 + 8) = t2;
+MEM_U32(s0 + 12) = t3;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+//nop;
+L4061b8:
+t4 = MEM_U8(fp + 0);
+//nop;
+//nop;
+if (s7 != t4) goto L4060bc;
+// bdead 1 ra = MEM_U32(sp + 60);
+L4061cc:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_4061f8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4061f8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+MEM_U32(sp + 56) = zero;
+MEM_U32(sp + 52) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L406330;
+t6 = 0x10009720;
+at = 0x22;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 != at) goto L406284;
+//nop;
+a0 = 0x10009728;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = v0;
+//nop;
+a0 = 0x10009728;
+// fdead 6000006f t9 = t9;
+a2 = sp + 0x38;
+a3 = sp + 0x34;
+func_405c28(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t7 = MEM_U32(sp + 60);
+goto L4062a0;
+L406284:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+t7 = MEM_U32(sp + 60);
+L4062a0:
+t9 = 0x48;
+a2 = MEM_U32(t7 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 64);
+t8 = 0x2;
+// bdead 420002c3 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a3 = 0x48;
+MEM_U32(sp + 24) = t0;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t1 = MEM_U32(sp + 60);
+//nop;
+a2 = MEM_U32(t1 + 20);
+t4 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 64);
+t2 = 0x2;
+t3 = 0x48;
+// fdead 60003cdf t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t2;
+a0 = zero;
+a3 = 0x48;
+MEM_U32(sp + 24) = t4;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L406330:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_406340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406340:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(a0 + 0) = zero;
+t7 = MEM_U32(sp + 36);
+//nop;
+MEM_U32(t7 + 0) = zero;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x10004f94;
+//nop;
+a0 = 0x10009728;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t8 = 0x1;
+if (v0 != 0) goto L4063b4;
+at = 0x10000000;
+MEM_U32(at + 0) = t8;
+goto L40645c;
+L4063b4:
+a1 = 0x10004f98;
+//nop;
+a0 = 0x10009728;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t9 = 0x2;
+if (v0 != 0) goto L4063e0;
+at = 0x10000000;
+MEM_U32(at + 0) = t9;
+goto L40645c;
+L4063e0:
+a1 = 0x10004f9c;
+//nop;
+a0 = 0x10009728;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t0 = 0x5;
+if (v0 != 0) goto L40640c;
+at = 0x10000000;
+MEM_U32(at + 0) = t0;
+goto L40645c;
+L40640c:
+a1 = 0x10004fa4;
+//nop;
+a0 = 0x10009728;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = zero;
+if (v0 != 0) goto L40643c;
+at = 0x10000000;
+t1 = 0x6;
+MEM_U32(at + 0) = t1;
+goto L40645c;
+L40643c:
+a0 = 0x10004fac;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L406678;
+L40645c:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x28;
+t2 = 0x10009720;
+a1 = zero;
+t2 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t2 == at) goto L4064ac;
+a0 = 0x10004fcc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L406678;
+L4064ac:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x69;
+t3 = 0x10009720;
+a1 = MEM_U32(sp + 32);
+t3 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t3 != at) goto L4065e0;
+//nop;
+a0 = 0x10009728;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t7 = MEM_U32(sp + 32);
+if (v0 != 0) goto L406550;
+//nop;
+a0 = 0x10009728;
+a1 = MEM_U32(sp + 32);
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 32);
+t4 = 0x10008ee4;
+a2 = 0x2;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t7 = MEM_U32(sp + 32);
+if (t4 == 0) goto L406550;
+t6 = MEM_U32(t5 + 0);
+a0 = 0x10004ff0;
+//nop;
+a1 = MEM_U32(t6 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+t7 = MEM_U32(sp + 32);
+L406550:
+at = 0x4;
+t8 = MEM_U32(t7 + 0);
+//nop;
+v0 = MEM_U32(t8 + 16);
+//nop;
+if (v0 != at) {
+at = 0x3;
+goto L406578;}
+at = 0x3;
+MEM_U32(t7 + 0) = zero;
+goto L4065e0;
+at = 0x3;
+L406578:
+//nop;
+if (v0 != at) goto L4065e0;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2b;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 == at) {
+at = 0x2d;
+goto L4065e0;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x29;
+goto L4065e0;}
+at = 0x29;
+a2 = 0x1;
+if (v1 == at) goto L4065e0;
+a0 = 0x10005010;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L406678;
+L4065e0:
+v1 = 0x10009720;
+at = 0x2b;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 == at) {
+at = 0x2d;
+goto L406608;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x69;
+goto L406608;}
+at = 0x69;
+if (v1 != at) {
+at = 0x29;
+goto L406634;}
+at = 0x29;
+L406608:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 36);
+v1 = 0x10009720;
+MEM_U32(t9 + 0) = v0;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x29;
+L406634:
+a2 = 0x1;
+if (v1 == at) goto L40665c;
+a0 = 0x10005030;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L406678;
+L40665c:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L406678:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_406684(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t6 = 0, t8 = 0, t9 = 0;
+L406684:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x64;
+t6 = 0x10009720;
+a1 = zero;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 == at) goto L4066e4;
+a0 = 0x10005040;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40671c;
+L4066e4:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+t8 = v0 & 0x3fff;
+v1 = 0x1000a7c0;
+//nop;
+t9 = MEM_U16(v1 + 10);
+//nop;
+t0 = t9 & 0xc000;
+t1 = t8 | t0;
+MEM_U16(v1 + 10) = (uint16_t)t1;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40671c:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_406728(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406728:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 88) = a0;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+at = 0x22;
+if (v0 == 0) goto L406c38;
+v1 = 0x10009720;
+t6 = MEM_U32(v0 + 20);
+v1 = MEM_U8(v1 + 0);
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 64) = t6;
+if (v1 != at) goto L40683c;
+//nop;
+a0 = 0x10009728;
+MEM_U32(sp + 72) = zero;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = v0;
+//nop;
+a0 = 0x10009728;
+// fdead 6000006f t9 = t9;
+a2 = sp + 0x4c;
+a3 = sp + 0x48;
+func_405c28(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 76);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 24) = t9;
+//nop;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+t7 = 0x2;
+t8 = 0x48;
+// bdead 420100c3 t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 72);
+//nop;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+t0 = 0x2;
+t1 = 0x48;
+// fdead 60000edf t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+a0 = zero;
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406c3c;
+L40683c:
+at = 0x69;
+//nop;
+if (v1 != at) goto L40697c;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x44;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = sp + 0x44;
+if (v0 != 0) goto L4068b0;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 68);
+t3 = 0x10008ee4;
+a2 = 0x2;
+t3 = MEM_U32(t3 + 0);
+//nop;
+t5 = MEM_U32(sp + 68);
+if (t3 == 0) goto L4068b4;
+a0 = 0x10005054;
+//nop;
+a1 = MEM_U32(t4 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L4068b0:
+t5 = MEM_U32(sp + 68);
+L4068b4:
+at = 0x4;
+v0 = MEM_U32(t5 + 16);
+//nop;
+if (v0 != at) {
+at = 0x3;
+goto L4068d4;}
+at = 0x3;
+MEM_U32(sp + 68) = zero;
+goto L40697c;
+at = 0x3;
+L4068d4:
+//nop;
+if (v0 != at) goto L40697c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 != at) {
+at = 0x2b;
+goto L40693c;}
+at = 0x2b;
+//nop;
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+func_406684(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x2b;
+L40693c:
+if (v1 == at) {
+at = 0x2d;
+goto L40697c;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x28;
+goto L40697c;}
+at = 0x28;
+if (v1 == at) {
+at = 0x23;
+goto L40697c;}
+at = 0x23;
+a1 = zero;
+if (v1 == at) goto L40697c;
+a0 = 0x10005078;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406c3c;
+L40697c:
+v1 = 0x10009720;
+at = 0x25;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 != at) {
+at = 0x69;
+goto L4069c4;}
+at = 0x69;
+//nop;
+a0 = sp + 0x44;
+// fdead 6000f0ff t9 = t9;
+a1 = sp + 0x4c;
+func_406340(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x69;
+L4069c4:
+if (v1 == at) {
+at = 0x64;
+goto L406a04;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L406a04;}
+at = 0x68;
+if (v1 == at) {
+at = 0x2b;
+goto L406a04;}
+at = 0x2b;
+if (v1 == at) {
+at = 0x2d;
+goto L406a04;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x7e;
+goto L406a04;}
+at = 0x7e;
+if (v1 == at) {
+at = 0x22;
+goto L406a04;}
+at = 0x22;
+if (v1 == at) {
+at = 0x28;
+goto L406a04;}
+at = 0x28;
+t0 = MEM_U32(sp + 68);
+if (v1 != at) goto L406af8;
+L406a04:
+//nop;
+a0 = sp + 0x50;
+a1 = sp + 0x4c;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t6 = MEM_U32(sp + 80);
+// bdead 40008103 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 68);
+if (t6 != 0) goto L406af8;
+t7 = 0x10009720;
+at = 0x28;
+t7 = MEM_U8(t7 + 0);
+//nop;
+t0 = MEM_U32(sp + 68);
+if (t7 != at) goto L406af8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 80) = v0;
+if (v0 == 0) goto L406c38;
+t8 = 0x10009720;
+at = 0x29;
+t8 = MEM_U8(t8 + 0);
+a2 = 0x1;
+//nop;
+if (t8 == at) goto L406aa8;
+a0 = 0x10005094;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406c3c;
+L406aa8:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x10009720;
+//nop;
+t9 = MEM_U8(t9 + 0);
+//nop;
+t0 = MEM_U32(sp + 68);
+if (t9 != at) goto L406af8;
+//nop;
+//nop;
+// bdead 40000103 t9 = t9;
+//nop;
+func_406684(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+t0 = MEM_U32(sp + 68);
+L406af8:
+t1 = MEM_U32(sp + 80);
+a0 = zero;
+if (t0 != 0) goto L406b20;
+t3 = MEM_U32(sp + 68);
+if (t1 != 0) goto L406b24;
+t2 = 0x10009f38;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(sp + 80) = t2;
+L406b20:
+t3 = MEM_U32(sp + 68);
+L406b24:
+a1 = MEM_U32(sp + 88);
+t6 = 0x48;
+if (t3 == 0) goto L406bfc;
+t4 = 0x1000a7e8;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(sp + 80);
+if (t4 == 0) goto L406b6c;
+//nop;
+a0 = MEM_U32(t3 + 24);
+a1 = 0x10009728;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+t5 = MEM_U32(sp + 80);
+L406b6c:
+t0 = MEM_U32(sp + 68);
+t2 = 0x1;
+if (t5 != 0) goto L406bbc;
+t6 = MEM_U32(sp + 68);
+t9 = MEM_U32(sp + 76);
+a0 = MEM_U32(t6 + 24);
+MEM_U32(sp + 24) = t9;
+//nop;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+t7 = 0x1;
+t8 = 0x48;
+// bdead 420100e3 t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+goto L406c2c;
+L406bbc:
+t1 = MEM_U32(sp + 80);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a3 = MEM_U32(t1 + 20);
+t3 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+t4 = 0x48;
+// bdead 400039e3 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t2;
+MEM_U32(sp + 24) = t3;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+goto L406c2c;
+L406bfc:
+t5 = MEM_U32(sp + 80);
+//nop;
+a3 = MEM_U32(t5 + 20);
+t7 = MEM_U32(sp + 76);
+a2 = MEM_U32(sp + 64);
+// bdead 400181e3 t9 = t9;
+MEM_U32(sp + 20) = t6;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 24) = t7;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+L406c2c:
+at = 0x10000000;
+//nop;
+MEM_U32(at + 0) = zero;
+L406c38:
+// bdead 1 ra = MEM_U32(sp + 44);
+L406c3c:
+// bdead 1 sp = sp + 0x58;
+//nop;
+return;
+}
+
+static void func_406c48(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406c48:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = zero;
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 60) = zero;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 68) = v0;
+if ((int)v0 < 0) goto L406c90;
+//nop;
+if ((int)v0 < (int)0x20) goto L406cb0;
+L406c90:
+a0 = 0x100050a4;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L406cb0:
+t6 = 0x10009720;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 != at) goto L406dc4;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x3c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = sp + 0x3c;
+if (v0 != 0) goto L406d30;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 60);
+t7 = 0x10008ee4;
+a2 = 0x2;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t9 = MEM_U32(sp + 60);
+if (t7 == 0) goto L406d34;
+a0 = 0x100050d0;
+//nop;
+a1 = MEM_U32(t8 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L406d30:
+t9 = MEM_U32(sp + 60);
+L406d34:
+at = 0x4;
+v0 = MEM_U32(t9 + 16);
+//nop;
+if (v0 != at) {
+at = 0x3;
+goto L406d54;}
+at = 0x3;
+MEM_U32(sp + 60) = zero;
+goto L406dc4;
+at = 0x3;
+L406d54:
+//nop;
+if (v0 != at) goto L406dc4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x2d;
+goto L406dc4;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x28;
+goto L406dc4;}
+at = 0x28;
+if (v0 == at) {
+at = 0x23;
+goto L406dc4;}
+at = 0x23;
+a1 = zero;
+if (v0 == at) goto L406dc4;
+a0 = 0x100050f4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406fdc;
+L406dc4:
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x64;
+goto L406e14;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L406e14;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L406e14;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L406e14;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L406e14;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L406e14;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L406e14;}
+at = 0x28;
+t3 = MEM_U32(sp + 60);
+if (v0 != at) goto L406ed4;
+L406e14:
+//nop;
+a0 = sp + 0x48;
+a1 = sp + 0x40;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t0 = MEM_U32(sp + 72);
+// bdead 40000303 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 60);
+if (t0 != 0) goto L406ed4;
+t1 = 0x10009720;
+at = 0x28;
+t1 = MEM_U8(t1 + 0);
+//nop;
+t3 = MEM_U32(sp + 60);
+if (t1 != at) goto L406ed4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 72) = v0;
+if (v0 == 0) goto L406fd8;
+t2 = 0x10009720;
+at = 0x29;
+t2 = MEM_U8(t2 + 0);
+a2 = 0x1;
+//nop;
+if (t2 == at) goto L406eb8;
+a0 = 0x10005110;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406fdc;
+L406eb8:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+t3 = MEM_U32(sp + 60);
+L406ed4:
+t4 = MEM_U32(sp + 72);
+a0 = zero;
+if (t3 != 0) goto L406efc;
+t6 = MEM_U32(sp + 64);
+if (t4 != 0) goto L406f00;
+t5 = 0x10009f38;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+MEM_U32(sp + 72) = t5;
+L406efc:
+t6 = MEM_U32(sp + 64);
+L406f00:
+t8 = MEM_U32(sp + 60);
+t7 = t6 & 0xffff;
+MEM_U32(sp + 64) = t7;
+if (t8 == 0) goto L406f9c;
+t9 = MEM_U32(sp + 72);
+t2 = MEM_U32(sp + 60);
+t4 = 0xe;
+if (t9 != 0) goto L406f5c;
+//nop;
+a0 = MEM_U32(t8 + 24);
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 68);
+t0 = 0xe;
+t1 = 0x48;
+// bdead 400106e1 t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+MEM_U32(sp + 24) = t7;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406fdc;
+L406f5c:
+t3 = MEM_U32(sp + 72);
+//nop;
+a0 = MEM_U32(t2 + 24);
+a3 = MEM_U32(t3 + 20);
+t6 = MEM_U32(sp + 64);
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 68);
+t5 = 0x48;
+// bdead 4000e1e1 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = t6;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L406fdc;
+L406f9c:
+t9 = MEM_U32(sp + 72);
+t1 = MEM_U32(sp + 64);
+a3 = MEM_U32(t9 + 20);
+//nop;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 68);
+t8 = 0xe;
+t0 = 0x48;
+// bdead 420007e1 t9 = t9;
+MEM_U32(sp + 20) = t0;
+MEM_U32(sp + 16) = t8;
+MEM_U32(sp + 24) = t1;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L406fd8:
+// bdead 1 ra = MEM_U32(sp + 44);
+L406fdc:
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_406fe8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406fe8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+t6 = 0x10009720;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 400080ef MEM_U32(sp + 44) = ra;
+// fdead 400080ef MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+MEM_U32(sp + 56) = zero;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 52) = zero;
+if (t6 != at) goto L40711c;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x34;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = sp + 0x34;
+if (v0 != 0) goto L407088;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 52);
+t7 = 0x10008ee4;
+a2 = 0x2;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t9 = MEM_U32(sp + 52);
+if (t7 == 0) goto L40708c;
+a0 = 0x10005120;
+//nop;
+a1 = MEM_U32(t8 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L407088:
+t9 = MEM_U32(sp + 52);
+L40708c:
+at = 0x4;
+v0 = MEM_U32(t9 + 16);
+//nop;
+if (v0 != at) {
+at = 0x3;
+goto L4070ac;}
+at = 0x3;
+MEM_U32(sp + 52) = zero;
+goto L40711c;
+at = 0x3;
+L4070ac:
+//nop;
+if (v0 != at) goto L40711c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x2d;
+goto L40711c;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x28;
+goto L40711c;}
+at = 0x28;
+if (v0 == at) {
+at = 0x23;
+goto L40711c;}
+at = 0x23;
+a1 = zero;
+if (v0 == at) goto L40711c;
+a0 = 0x10005144;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L407328;
+L40711c:
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x64;
+goto L407228;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L407228;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L407228;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L407228;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L407228;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L407228;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L407228;}
+at = 0x28;
+t3 = MEM_U32(sp + 52);
+if (v0 == at) goto L40722c;
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x38;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t0 = MEM_U32(sp + 60);
+// bdead 40000303 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 52);
+if (t0 != 0) goto L40722c;
+t1 = 0x10009720;
+at = 0x28;
+t1 = MEM_U8(t1 + 0);
+//nop;
+t3 = MEM_U32(sp + 52);
+if (t1 != at) goto L40722c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L407324;
+t2 = 0x10009720;
+at = 0x29;
+t2 = MEM_U8(t2 + 0);
+a2 = 0x1;
+//nop;
+if (t2 == at) goto L407210;
+a0 = 0x10005160;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L407328;
+L407210:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L407228:
+t3 = MEM_U32(sp + 52);
+L40722c:
+t4 = MEM_U32(sp + 60);
+a0 = zero;
+if (t3 != 0) goto L407254;
+t6 = MEM_U32(sp + 52);
+if (t4 != 0) goto L407258;
+t5 = 0x10009f38;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+MEM_U32(sp + 60) = t5;
+L407254:
+t6 = MEM_U32(sp + 52);
+L407258:
+a1 = MEM_U32(sp + 64);
+a2 = 0x48;
+if (t6 == 0) goto L4072f4;
+t7 = MEM_U32(sp + 60);
+t1 = MEM_U32(sp + 52);
+a2 = 0x48;
+if (t7 != 0) goto L4072b4;
+a0 = MEM_U32(t6 + 24);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 64);
+t8 = 0x1;
+// bdead 42000261 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t0;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L407328;
+L4072b4:
+t2 = MEM_U32(sp + 60);
+//nop;
+a0 = MEM_U32(t1 + 24);
+a3 = MEM_U32(t2 + 20);
+t5 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 64);
+t3 = 0x1;
+t4 = 0x48;
+// bdead 400071e1 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = t5;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L407328;
+L4072f4:
+t7 = MEM_U32(sp + 60);
+//nop;
+a3 = MEM_U32(t7 + 20);
+t8 = MEM_U32(sp + 56);
+t6 = 0x48;
+// bdead 420081e3 t9 = t9;
+MEM_U32(sp + 20) = t6;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 24) = t8;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L407324:
+// bdead 1 ra = MEM_U32(sp + 44);
+L407328:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_407334(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, t8 = 0, t9 = 0;
+L407334:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffba0;
+// fdead 4000006b MEM_U32(sp + 36) = s0;
+s0 = 0x10009720;
+// fdead 4002006b MEM_U32(sp + 56) = s5;
+v0 = MEM_U8(s0 + 0);
+at = 0x2d;
+// fdead 4002006f MEM_U32(sp + 68) = ra;
+// fdead 4002006f MEM_U32(sp + 64) = gp;
+// fdead 4002006f MEM_U32(sp + 60) = s6;
+// fdead 4002006f MEM_U32(sp + 52) = s4;
+// fdead 4002006f MEM_U32(sp + 48) = s3;
+// fdead 4002006f MEM_U32(sp + 44) = s2;
+// fdead 4002006f MEM_U32(sp + 40) = s1;
+s5 = zero;
+if (v0 != at) goto L40739c;
+//nop;
+s5 = 0x1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40420103 gp = MEM_U32(sp + 64);
+v0 = MEM_U8(s0 + 0);
+at = 0x66;
+goto L4073c8;
+L40739c:
+at = 0x2b;
+if (v0 != at) {
+at = 0x66;
+goto L4073c8;}
+at = 0x66;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40420103 gp = MEM_U32(sp + 64);
+v0 = MEM_U8(s0 + 0);
+//nop;
+at = 0x66;
+L4073c8:
+a1 = zero;
+if (v0 == at) goto L407414;
+a0 = 0x10005170;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U8(s0 + 0);
+// bdead 40008101 gp = MEM_U32(sp + 64);
+at = 0x23;
+// bdead 40000101 ra = MEM_U32(sp + 68);
+if (t6 == at) goto L4075a8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L4075a8;
+L407414:
+s6 = 0x10009b28;
+//nop;
+a1 = 0x10009728;
+s6 = MEM_U32(s6 + 0);
+a0 = sp + 0x50;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40c20103 gp = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40c20003 gp = MEM_U32(sp + 64);
+at = 0x17;
+s2 = 0x1000a7c0;
+a0 = zero;
+t7 = MEM_U16(s2 + 4);
+a3 = 0x48;
+t8 = t7 & 0x3f;
+t2 = 0x2;
+if (t8 != at) goto L4074ac;
+a1 = MEM_U32(s2 + 4);
+a2 = MEM_U32(s2 + 8);
+t9 = a1 << 22;
+a1 = t9 >> 23;
+//nop;
+t3 = 0x48;
+t4 = s5 + s6;
+t1 = a2 >> 25;
+// bdead 40c83d63 t9 = t9;
+a2 = t1;
+MEM_U32(sp + 24) = t4;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40c80003 gp = MEM_U32(sp + 64);
+v0 = 0x10;
+goto L40751c;
+L4074ac:
+at = 0x1000a7c0;
+t5 = s5 + s6;
+MEM_U32(at + 8) = t5;
+t6 = MEM_U8(s0 + 0);
+at = 0x3a;
+t7 = 0x1;
+if (t6 != at) goto L4074fc;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40c80103 gp = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40c8000b gp = MEM_U32(sp + 64);
+MEM_U32(s2 + 12) = v0;
+goto L407500;
+L4074fc:
+MEM_U32(s2 + 12) = t7;
+L407500:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40c80003 gp = MEM_U32(sp + 64);
+//nop;
+v0 = 0x10;
+L40751c:
+s1 = zero;
+if (s6 == 0) goto L40758c;
+s0 = sp + 0x50;
+s4 = 0x2d;
+s3 = 0x10;
+L407530:
+//nop;
+if (v0 != s3) goto L407570;
+//nop;
+if (s1 == 0) goto L407558;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40fe0003 gp = MEM_U32(sp + 64);
+//nop;
+L407558:
+v0 = zero;
+if (s5 == 0) goto L407570;
+MEM_U8(s2 + 0) = (uint8_t)s4;
+s5 = zero;
+v0 = 0x1;
+goto L407570;
+L407570:
+t8 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+t9 = s2 + v0;
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(t9 + 0) = (uint8_t)t8;
+if (s1 != s6) goto L407530;
+L40758c:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 68);
+L4075a8:
+// bdead 1 s0 = MEM_U32(sp + 36);
+// bdead 1 s1 = MEM_U32(sp + 40);
+// bdead 1 s2 = MEM_U32(sp + 44);
+// bdead 1 s3 = MEM_U32(sp + 48);
+// bdead 1 s4 = MEM_U32(sp + 52);
+// bdead 1 s5 = MEM_U32(sp + 56);
+// bdead 1 s6 = MEM_U32(sp + 60);
+// bdead 1 sp = sp + 0x460;
+return;
+}
+
+static void func_4075cc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4075cc:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a7c0;
+t9 = a0;
+t6 = MEM_U8(v1 + 5);
+t2 = MEM_U16(v1 + 6);
+t0 = t9 << 1;
+t1 = t0 & 0x3fe;
+t7 = t6 & 0xffc0;
+t3 = t2 & 0xfc01;
+t8 = t7 | 0x17;
+t4 = t1 | t3;
+MEM_U32(v1 + 0) = zero;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+MEM_U16(v1 + 6) = (uint16_t)t4;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601befb MEM_U32(sp + 28) = ra;
+// fdead 4601befb MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+//nop;
+if (v0 == 0) goto L40764c;
+t6 = MEM_U32(v0 + 20);
+t9 = MEM_U8(v1 + 8);
+t8 = t6 << 1;
+t0 = t9 & 0xff01;
+t2 = t8 | t0;
+MEM_U8(v1 + 8) = (uint8_t)t2;
+L40764c:
+t1 = MEM_U16(v1 + 8);
+//nop;
+t3 = t1 & 0xfe03;
+t4 = t3 | 0x120;
+MEM_U16(v1 + 8) = (uint16_t)t4;
+v0 = MEM_U32(v1 + 8);
+//nop;
+t5 = v0 >> 14;
+t6 = t5 ^ 0x2;
+t7 = t6 << 28;
+t9 = t7 >> 14;
+t8 = t9 ^ v0;
+//nop;
+MEM_U32(v1 + 8) = t8;
+// bdead 40000101 t9 = t9;
+//nop;
+func_407334(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_4076a0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4076a0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = zero;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 48) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+// bdead 4000010b ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L407a14;
+t7 = 0x1000a7dc;
+t6 = MEM_U32(v0 + 20);
+t7 = MEM_U32(t7 + 0);
+t8 = MEM_U32(sp + 80);
+MEM_U32(sp + 72) = t6;
+if (t7 == 0) goto L4077a4;
+at = 0xcd;
+//nop;
+if (t8 != at) goto L4077a4;
+t9 = 0x10009720;
+at = 0x69;
+t9 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t9 != at) goto L4077a4;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x30;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L4077a0;
+t0 = MEM_U32(sp + 48);
+//nop;
+t1 = MEM_U32(t0 + 16);
+//nop;
+//nop;
+if (t1 != 0) goto L407798;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t2 = 0x10009720;
+//nop;
+t2 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t2 != at) goto L4077a4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+goto L4077a4;
+L407798:
+MEM_U32(sp + 48) = zero;
+goto L4077a4;
+L4077a0:
+MEM_U32(sp + 48) = zero;
+L4077a4:
+t3 = 0x10009720;
+at = 0x25;
+t3 = MEM_U8(t3 + 0);
+//nop;
+//nop;
+if (t3 != at) goto L4077dc;
+//nop;
+a0 = sp + 0x44;
+// bdead 40000123 t9 = t9;
+a1 = sp + 0x40;
+func_406340(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 80);
+goto L407914;
+L4077dc:
+t4 = 0x10008eac;
+//nop;
+t4 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if ((int)t4 >= (int)0x3) goto L407814;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+goto L407910;
+L407814:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 52);
+if (v0 == 0) goto L407908;
+t5 = MEM_U32(sp + 80);
+at = 0xcd;
+a1 = zero;
+if (t5 != at) goto L40785c;
+a0 = 0x10005194;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L40785c:
+t6 = MEM_U32(sp + 80);
+at = 0x29;
+a2 = 0x446;
+if (t6 == at) goto L40788c;
+a0 = 0x100051b4;
+a1 = 0x100051c0;
+//nop;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L40788c:
+t9 = MEM_U32(sp + 56);
+a2 = MEM_U32(sp + 72);
+MEM_U32(sp + 24) = t9;
+//nop;
+t7 = 0x2;
+t8 = 0x48;
+// bdead 42010083 t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = 0x14c;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 52);
+//nop;
+a2 = MEM_U32(sp + 72);
+t0 = 0x2;
+t1 = 0x48;
+// fdead 160000e9f t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+a0 = zero;
+a1 = 0x14c;
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L407a14;
+// fdead 0 t3 = MEM_U32(sp + 52);
+L407908:
+//nop;
+MEM_U32(sp + 64) = t3;
+L407910:
+t4 = MEM_U32(sp + 80);
+L407914:
+at = 0xcd;
+t0 = MEM_U32(sp + 68);
+if (t4 != at) goto L407968;
+t5 = MEM_U32(sp + 68);
+t6 = MEM_U32(sp + 64);
+t7 = t6 >> 16;
+if (t5 != 0) goto L407964;
+a1 = zero;
+if (t7 == 0) goto L407954;
+a0 = 0x100051cc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L407954:
+t8 = MEM_U32(sp + 64);
+//nop;
+t9 = t8 << 16;
+MEM_U32(sp + 64) = t9;
+L407964:
+t0 = MEM_U32(sp + 68);
+L407968:
+t1 = MEM_U32(sp + 80);
+at = 0xcd;
+if (t0 == 0) goto L407980;
+a0 = MEM_U32(t0 + 24);
+//nop;
+goto L407984;
+L407980:
+a0 = zero;
+L407984:
+a3 = 0x48;
+if (t1 != at) goto L4079d0;
+t2 = MEM_U32(sp + 48);
+a2 = MEM_U32(sp + 72);
+a1 = t1;
+if (t2 == 0) goto L4079d0;
+//nop;
+a3 = MEM_U32(t2 + 20);
+t5 = MEM_U32(sp + 64);
+t3 = 0x4;
+t4 = 0x48;
+// bdead 400071e3 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = t5;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+goto L407a04;
+L4079d0:
+//nop;
+t8 = MEM_U32(sp + 64);
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 72);
+t6 = 0x2;
+t7 = 0x48;
+// bdead 420181e3 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = t8;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+L407a04:
+at = 0x10000000;
+//nop;
+MEM_U32(at + 0) = zero;
+// bdead 1 ra = MEM_U32(sp + 44);
+L407a14:
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_407a20(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L407a20:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 84) = zero;
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 60) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 92) = v0;
+if (v0 == 0) goto L40847c;
+t6 = 0x10009720;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+//nop;
+t1 = MEM_U32(sp + 80);
+if (t6 != at) goto L407b64;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x58;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t1 = MEM_U32(sp + 80);
+if (v0 == 0) goto L407b64;
+t7 = MEM_U32(sp + 88);
+//nop;
+t8 = MEM_U32(t7 + 16);
+//nop;
+t1 = MEM_U32(sp + 80);
+if (t8 != 0) goto L407b64;
+//nop;
+MEM_U32(sp + 84) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 != at) {
+at = 0x69;
+goto L407b08;}
+at = 0x69;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+at = 0x69;
+L407b08:
+t1 = MEM_U32(sp + 80);
+if (v0 != at) goto L407b64;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x58;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t1 = MEM_U32(sp + 80);
+if (v0 == 0) goto L407b64;
+t9 = MEM_U32(sp + 88);
+//nop;
+t0 = MEM_U32(t9 + 16);
+//nop;
+t1 = MEM_U32(sp + 80);
+if (t0 != 0) goto L407b64;
+MEM_U32(sp + 80) = t9;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+t1 = MEM_U32(sp + 80);
+L407b64:
+a3 = zero;
+t8 = MEM_U32(sp + 84);
+if (t1 != 0) goto L407e60;
+v0 = 0x10009720;
+at = 0x25;
+v0 = MEM_U8(v0 + 0);
+t2 = MEM_U32(sp + 84);
+if (v0 != at) {
+at = 0x69;
+goto L407c30;}
+at = 0x69;
+a1 = zero;
+if (t2 != 0) goto L407bb0;
+a0 = 0x100051ec;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L407bb0:
+//nop;
+a0 = sp + 0x4c;
+// bdead 40000123 t9 = t9;
+a1 = sp + 0x44;
+func_406340(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 76);
+// bdead 40001003 gp = MEM_U32(sp + 40);
+t6 = 0x4;
+if (t3 == 0) goto L407be0;
+a0 = MEM_U32(t3 + 24);
+t4 = MEM_U32(sp + 92);
+goto L407be8;
+L407be0:
+a0 = zero;
+t4 = MEM_U32(sp + 92);
+L407be8:
+t5 = MEM_U32(sp + 84);
+//nop;
+a2 = MEM_U32(t4 + 20);
+a3 = MEM_U32(t5 + 20);
+t7 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 96);
+t8 = 0x48;
+// fdead 6201f1ff t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = t7;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+at = 0x10000000;
+MEM_U32(at + 0) = zero;
+goto L40847c;
+at = 0x69;
+L407c30:
+if (v0 == at) {
+at = 0x64;
+goto L407c70;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L407c70;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L407c70;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L407c70;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L407c70;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L407c70;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L407c70;}
+at = 0x28;
+//nop;
+if (v0 != at) goto L407cdc;
+L407c70:
+t0 = 0x10008eac;
+//nop;
+t0 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if ((int)t0 >= (int)0x3) goto L407ca8;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 68) = v0;
+goto L407cc0;
+L407ca8:
+//nop;
+a0 = sp + 0x40;
+a1 = sp + 0x44;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+L407cc0:
+t9 = MEM_U32(sp + 84);
+t1 = MEM_U32(sp + 92);
+//nop;
+if (t9 != 0) goto L407cd4;
+MEM_U32(sp + 84) = t1;
+L407cd4:
+a3 = 0x1;
+goto L407e5c;
+L407cdc:
+t2 = 0x10008eac;
+a1 = MEM_U32(sp + 96);
+t2 = MEM_U8(t2 + 0);
+//nop;
+if ((int)t2 < (int)0x2) {
+at = (int)a1 < (int)0x110;
+goto L407e4c;}
+if ((int)a1 < (int)0x110) {
+at = (int)a1 < (int)0x15b;
+goto L407d64;}
+t4 = a1 + 0xfffffeb1;
+if ((int)a1 < (int)0x15b) goto L407d38;
+t3 = a1 + 0xfffffe8c;
+t5 = MEM_U32(sp + 84);
+if (t3 >= 0x18) goto L407e50;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L407dcc;
+case 1: goto L407dcc;
+case 2: goto L407e4c;
+case 3: goto L407e4c;
+case 4: goto L407e4c;
+case 5: goto L407e4c;
+case 6: goto L407e4c;
+case 7: goto L407e4c;
+case 8: goto L407e4c;
+case 9: goto L407e4c;
+case 10: goto L407e4c;
+case 11: goto L407e4c;
+case 12: goto L407e4c;
+case 13: goto L407e4c;
+case 14: goto L407e4c;
+case 15: goto L407e4c;
+case 16: goto L407e4c;
+case 17: goto L407e4c;
+case 18: goto L407e4c;
+case 19: goto L407e4c;
+case 20: goto L407dcc;
+case 21: goto L407dcc;
+case 22: goto L407dcc;
+case 23: goto L407dcc;
+}
+L407d38:
+t5 = MEM_U32(sp + 84);
+if (t4 >= 0xc) goto L407e50;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L407e0c;
+case 1: goto L407e0c;
+case 2: goto L407e0c;
+case 3: goto L407e0c;
+case 4: goto L407e0c;
+case 5: goto L407e0c;
+case 6: goto L407e0c;
+case 7: goto L407e0c;
+case 8: goto L407e0c;
+case 9: goto L407e0c;
+case 10: goto L407e0c;
+case 11: goto L407e0c;
+}
+L407d64:
+t6 = a1 + 0xffffff18;
+if ((int)a1 < (int)0xee) goto L407da0;
+t5 = a1 + 0xfffffef9;
+//nop;
+if (t5 >= 0x9) goto L407e4c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L407e0c;
+case 1: goto L407e0c;
+case 2: goto L407e0c;
+case 3: goto L407e4c;
+case 4: goto L407e4c;
+case 5: goto L407e4c;
+case 6: goto L407e0c;
+case 7: goto L407e0c;
+case 8: goto L407e0c;
+}
+L407da0:
+t5 = MEM_U32(sp + 84);
+if (t6 >= 0x6) goto L407e50;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L407e0c;
+case 1: goto L407e0c;
+case 2: goto L407e0c;
+case 3: goto L407e0c;
+case 4: goto L407e0c;
+case 5: goto L407e0c;
+}
+L407dcc:
+t8 = MEM_U32(sp + 92);
+t7 = MEM_U32(sp + 84);
+t9 = 0x40;
+a2 = MEM_U32(t8 + 20);
+a3 = MEM_U32(t7 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t0 = 0x3;
+// bdead 400003c3 t9 = t9;
+MEM_U32(sp + 16) = t0;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L407e0c:
+t1 = MEM_U32(sp + 92);
+t2 = MEM_U32(sp + 84);
+//nop;
+a2 = MEM_U32(t1 + 20);
+a3 = MEM_U32(t2 + 20);
+t3 = 0x5;
+t4 = 0x48;
+// bdead 400031c3 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L407e4c:
+t5 = MEM_U32(sp + 84);
+L407e50:
+t6 = MEM_U32(sp + 92);
+MEM_U32(sp + 80) = t5;
+MEM_U32(sp + 84) = t6;
+L407e5c:
+t8 = MEM_U32(sp + 84);
+L407e60:
+// bdead 42000103 a1 = MEM_U32(sp + 96);
+a2 = 0x1;
+if (t8 == 0) goto L407e84;
+t7 = MEM_U32(sp + 80);
+v1 = MEM_U32(sp + 96);
+at = (int)v1 < (int)0x13d;
+if (t7 != 0) goto L407ea4;
+//nop;
+if (a3 != 0) goto L407ea4;
+L407e84:
+a0 = 0x10005208;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L407ea4:
+if (at != 0) {
+at = 0x16f;
+goto L407edc;}
+at = 0x16f;
+if (v1 == at) {
+at = 0x170;
+goto L408040;}
+at = 0x170;
+v0 = 0x19a;
+if (v1 == at) goto L408040;
+at = 0x19b;
+if (v1 == v0) goto L408090;
+if (v1 == at) {
+at = 0x19c;
+goto L408090;}
+at = 0x19c;
+//nop;
+if (v1 == at) goto L408090;
+//nop;
+goto L40826c;
+L407edc:
+v0 = v1;
+if ((int)v1 < (int)0xee) goto L407f50;
+t9 = v0 + 0xfffffef9;
+if ((int)v1 < (int)0x110) goto L407f24;
+t0 = v0 + 0xfffffecc;
+//nop;
+if (t0 >= 0x9) goto L40826c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t0) {
+case 0: goto L40811c;
+case 1: goto L40811c;
+case 2: goto L40826c;
+case 3: goto L40826c;
+case 4: goto L40826c;
+case 5: goto L40826c;
+case 6: goto L408040;
+case 7: goto L408040;
+case 8: goto L408040;
+}
+L407f24:
+//nop;
+if (t9 >= 0x9) goto L40826c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L40823c;
+case 1: goto L40823c;
+case 2: goto L40823c;
+case 3: goto L40826c;
+case 4: goto L40826c;
+case 5: goto L40826c;
+case 6: goto L40823c;
+case 7: goto L40823c;
+case 8: goto L40823c;
+}
+L407f50:
+t1 = v0 + 0xffffff2d;
+if ((int)v1 < (int)0x88) goto L407f88;
+//nop;
+if (t1 >= 0x1b) goto L40826c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40811c;
+case 1: goto L40811c;
+case 2: goto L40811c;
+case 3: goto L40811c;
+case 4: goto L40811c;
+case 5: goto L40811c;
+case 6: goto L40811c;
+case 7: goto L40826c;
+case 8: goto L40826c;
+case 9: goto L40826c;
+case 10: goto L40826c;
+case 11: goto L40826c;
+case 12: goto L40826c;
+case 13: goto L40826c;
+case 14: goto L40826c;
+case 15: goto L40826c;
+case 16: goto L40826c;
+case 17: goto L40826c;
+case 18: goto L40826c;
+case 19: goto L40826c;
+case 20: goto L40826c;
+case 21: goto L40823c;
+case 22: goto L40823c;
+case 23: goto L40823c;
+case 24: goto L40823c;
+case 25: goto L40823c;
+case 26: goto L40823c;
+}
+L407f88:
+t3 = v0 + 0xffffffbc;
+if ((int)v1 < (int)0x55) goto L407fc4;
+t2 = v0 + 0xffffff84;
+//nop;
+if (t2 >= 0xc) goto L40826c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L40823c;
+case 1: goto L40823c;
+case 2: goto L40823c;
+case 3: goto L40823c;
+case 4: goto L40823c;
+case 5: goto L40823c;
+case 6: goto L40823c;
+case 7: goto L40823c;
+case 8: goto L40823c;
+case 9: goto L40823c;
+case 10: goto L40823c;
+case 11: goto L40823c;
+}
+L407fc4:
+//nop;
+if (t3 >= 0x11) goto L40826c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L407ff0;
+case 1: goto L407ff0;
+case 2: goto L40826c;
+case 3: goto L40826c;
+case 4: goto L40826c;
+case 5: goto L40826c;
+case 6: goto L40826c;
+case 7: goto L40826c;
+case 8: goto L40826c;
+case 9: goto L40826c;
+case 10: goto L40826c;
+case 11: goto L407ff0;
+case 12: goto L40826c;
+case 13: goto L40826c;
+case 14: goto L40826c;
+case 15: goto L407ff0;
+case 16: goto L407ff0;
+}
+L407ff0:
+//nop;
+if (a3 == 0) goto L40826c;
+t4 = MEM_U32(sp + 68);
+a2 = 0x1;
+at = (int)t4 < (int)0x20;
+if ((int)t4 < 0) goto L408020;
+//nop;
+if ((int)t4 >= (int)0x20) goto L408020;
+t5 = MEM_U32(sp + 60);
+//nop;
+//nop;
+if (t5 == 0) goto L40826c;
+L408020:
+a0 = 0x10005224;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L408040:
+//nop;
+if (a3 == 0) goto L40826c;
+t6 = MEM_U32(sp + 68);
+a2 = 0x1;
+at = (int)t6 < (int)0x40;
+if ((int)t6 < 0) goto L408070;
+//nop;
+if ((int)t6 >= (int)0x40) goto L408070;
+t8 = MEM_U32(sp + 60);
+//nop;
+//nop;
+if (t8 == 0) goto L40826c;
+L408070:
+a0 = 0x1000523c;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L408090:
+t9 = MEM_U32(sp + 68);
+if (a3 == 0) goto L4080e4;
+t7 = MEM_U32(sp + 68);
+a2 = 0x1;
+at = (int)t7 < (int)0x20;
+if ((int)t7 < 0) goto L4080c0;
+//nop;
+if ((int)t7 >= (int)0x20) goto L4080c0;
+t0 = MEM_U32(sp + 60);
+//nop;
+t9 = MEM_U32(sp + 68);
+if (t0 == 0) goto L4080e4;
+L4080c0:
+a0 = 0x10005254;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+// fdead 0 t9 = MEM_U32(sp + 68);
+L4080e4:
+at = 0x19b;
+t1 = t9 + 0x20;
+MEM_U32(sp + 68) = t1;
+if (v1 != v0) goto L408100;
+t2 = 0x13a;
+MEM_U32(sp + 96) = t2;
+goto L40826c;
+L408100:
+t4 = 0x13c;
+if (v1 != at) goto L408114;
+t3 = 0x13b;
+MEM_U32(sp + 96) = t3;
+goto L40826c;
+L408114:
+MEM_U32(sp + 96) = t4;
+goto L40826c;
+L40811c:
+at = 0xd7;
+if (a3 != 0) goto L408148;
+a0 = 0x1000526c;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+L408148:
+if (v1 == at) {
+at = 0xd8;
+goto L408160;}
+at = 0xd8;
+if (v1 == at) {
+at = 0xd9;
+goto L408160;}
+at = 0xd9;
+t8 = MEM_U32(sp + 68);
+if (v1 != at) goto L4081bc;
+L408160:
+t5 = MEM_U32(sp + 68);
+at = 0x10000;
+a2 = 0x1;
+if ((int)t5 >= (int)at) goto L40818c;
+//nop;
+if ((int)t5 < 0) goto L40818c;
+t6 = MEM_U32(sp + 60);
+//nop;
+//nop;
+if (t6 == 0) goto L40826c;
+L40818c:
+a0 = 0x1000528c;
+//nop;
+a1 = zero;
+MEM_U32(sp + 72) = a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 72);
+// bdead 40000103 v1 = MEM_U32(sp + 96);
+//nop;
+goto L40826c;
+// fdead 0 t8 = MEM_U32(sp + 68);
+L4081bc:
+at = 0x10000;
+a2 = 0x1;
+if ((int)t8 >= (int)at) goto L4081e4;
+at = 0x8000;
+if ((int)t8 < (int)at) {
+at = 0xffff0000;
+goto L4081e4;}
+at = 0xffff0000;
+t7 = t8 + at;
+MEM_U32(sp + 68) = t7;
+L4081e4:
+t0 = MEM_U32(sp + 68);
+at = 0x8000;
+if ((int)t0 >= (int)at) {
+at = (int)t0 < (int)0xffff8000;
+goto L408210;}
+//nop;
+if ((int)t0 < (int)0xffff8000) goto L408210;
+t9 = MEM_U32(sp + 60);
+//nop;
+//nop;
+if (t9 == 0) goto L40826c;
+L408210:
+a0 = 0x100052a8;
+//nop;
+a1 = zero;
+MEM_U32(sp + 72) = a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 72);
+// bdead 40000103 v1 = MEM_U32(sp + 96);
+//nop;
+goto L40826c;
+L40823c:
+a2 = 0x1;
+if (a3 == 0) goto L40826c;
+a0 = 0x100052c8;
+//nop;
+a1 = zero;
+MEM_U32(sp + 72) = a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 72);
+// bdead 40000103 v1 = MEM_U32(sp + 96);
+//nop;
+L40826c:
+t3 = MEM_U32(sp + 92);
+if (a3 == 0) goto L40843c;
+t1 = 0x10008ebc;
+t2 = MEM_U32(sp + 60);
+t1 = MEM_U32(t1 + 0);
+MEM_U32(sp + 56) = t1;
+if (t2 == 0) goto L4083f0;
+t3 = MEM_U32(sp + 96);
+//nop;
+t4 = t3 + 0xffffffe0;
+if ((int)t3 < (int)0x3) goto L4082c8;
+t6 = MEM_U32(sp + 56);
+if (t4 >= 0x37) goto L408304;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L4082e0;
+case 1: goto L4082e0;
+case 2: goto L408300;
+case 3: goto L408300;
+case 4: goto L408300;
+case 5: goto L408300;
+case 6: goto L408300;
+case 7: goto L408300;
+case 8: goto L408300;
+case 9: goto L408300;
+case 10: goto L408300;
+case 11: goto L408300;
+case 12: goto L408300;
+case 13: goto L408300;
+case 14: goto L408300;
+case 15: goto L408300;
+case 16: goto L408300;
+case 17: goto L408300;
+case 18: goto L408300;
+case 19: goto L408300;
+case 20: goto L408300;
+case 21: goto L408300;
+case 22: goto L408300;
+case 23: goto L408300;
+case 24: goto L4082e0;
+case 25: goto L4082e0;
+case 26: goto L4082e0;
+case 27: goto L408300;
+case 28: goto L408300;
+case 29: goto L408300;
+case 30: goto L408300;
+case 31: goto L408300;
+case 32: goto L408300;
+case 33: goto L4082e0;
+case 34: goto L4082e0;
+case 35: goto L408300;
+case 36: goto L408300;
+case 37: goto L408300;
+case 38: goto L408300;
+case 39: goto L408300;
+case 40: goto L408300;
+case 41: goto L408300;
+case 42: goto L408300;
+case 43: goto L408300;
+case 44: goto L408300;
+case 45: goto L408300;
+case 46: goto L408300;
+case 47: goto L408300;
+case 48: goto L408300;
+case 49: goto L408300;
+case 50: goto L408300;
+case 51: goto L408300;
+case 52: goto L408300;
+case 53: goto L4082e0;
+case 54: goto L4082e0;
+}
+L4082c8:
+t5 = MEM_U32(sp + 96);
+at = 0x1;
+if (t5 == at) {
+at = 0x2;
+goto L4082e0;}
+at = 0x2;
+t6 = MEM_U32(sp + 56);
+if (t5 != at) goto L408304;
+L4082e0:
+a0 = 0x100052ec;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L408300:
+t6 = MEM_U32(sp + 56);
+L408304:
+a1 = zero;
+//nop;
+if (t6 != 0) goto L40832c;
+a0 = 0x1000530c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L40832c:
+//nop;
+at = 0x10008ebc;
+t0 = MEM_U32(sp + 64);
+t8 = 0x2;
+t7 = 0x48;
+// bdead 42010207 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+MEM_U32(sp + 24) = t0;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t9 = 0x2;
+MEM_U32(sp + 16) = t9;
+//nop;
+t2 = MEM_U32(sp + 68);
+t1 = 0x48;
+// bdead 40000c03 t9 = t9;
+MEM_U32(sp + 20) = t1;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 92);
+t4 = MEM_U32(sp + 84);
+//nop;
+a2 = MEM_U32(t3 + 20);
+a3 = MEM_U32(t4 + 20);
+a1 = MEM_U32(sp + 96);
+t5 = 0x3;
+t6 = 0x1;
+// fdead 6000f1df t9 = t9;
+MEM_U32(sp + 20) = t6;
+MEM_U32(sp + 16) = t5;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 56);
+at = 0x10008ebc;
+MEM_U32(at + 0) = t8;
+goto L40847c;
+L4083f0:
+t7 = MEM_U32(sp + 92);
+t0 = MEM_U32(sp + 84);
+t9 = 0x4;
+a2 = MEM_U32(t7 + 20);
+a3 = MEM_U32(t0 + 20);
+MEM_U32(sp + 16) = t9;
+//nop;
+t2 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 96);
+t1 = 0x48;
+// bdead 40000dc3 t9 = t9;
+MEM_U32(sp + 20) = t1;
+a0 = zero;
+MEM_U32(sp + 24) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408480;
+// fdead 0 t3 = MEM_U32(sp + 92);
+L40843c:
+t4 = MEM_U32(sp + 84);
+t6 = MEM_U32(sp + 80);
+t5 = 0x3;
+a2 = MEM_U32(t3 + 20);
+a3 = MEM_U32(t4 + 20);
+//nop;
+MEM_U32(sp + 16) = t5;
+t8 = MEM_U32(t6 + 20);
+a1 = MEM_U32(sp + 96);
+// bdead 420001c3 t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+MEM_U32(sp + 20) = t8;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L40847c:
+// bdead 1 ra = MEM_U32(sp + 44);
+L408480:
+// bdead 1 sp = sp + 0x60;
+//nop;
+return;
+}
+
+static void func_40848c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40848c:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+t0 = v0;
+if (v0 == 0) goto L4085c8;
+t6 = 0x10009720;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+v1 = v0;
+//nop;
+if (t6 == at) goto L408504;
+//nop;
+MEM_U32(sp + 60) = t0;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+t0 = MEM_U32(sp + 60);
+v1 = v0;
+if (v0 != 0) goto L408504;
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4085cc;
+L408504:
+a0 = zero;
+if ((int)a1 < (int)0x9d) goto L408598;
+//nop;
+if ((int)a1 >= (int)0xcd) goto L408598;
+t7 = 0x10009720;
+at = 0x23;
+t7 = MEM_U8(t7 + 0);
+a2 = 0x40;
+//nop;
+if (t7 == at) goto L408560;
+a2 = MEM_U32(t0 + 20);
+//nop;
+MEM_U32(sp + 60) = v1;
+MEM_U32(sp + 48) = a2;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+a2 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 60);
+v1 = v0;
+if (v0 == 0) goto L4085c8;
+L408560:
+a3 = MEM_U32(t0 + 20);
+t8 = 0x3;
+MEM_U32(sp + 16) = t8;
+t9 = MEM_U32(v1 + 20);
+MEM_U32(sp + 24) = zero;
+MEM_U32(sp + 20) = t9;
+//nop;
+a0 = zero;
+// bdead 400001e1 t9 = t9;
+//nop;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4085cc;
+L408598:
+//nop;
+a2 = MEM_U32(t0 + 20);
+a3 = MEM_U32(v1 + 20);
+t1 = 0x5;
+t2 = 0x48;
+// fdead 60008fff t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L4085c8:
+// bdead 1 ra = MEM_U32(sp + 44);
+L4085cc:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_4085d8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4085d8:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L4086dc;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+// bdead 4000010b ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L4086e0;
+//nop;
+MEM_U32(sp + 56) = v0;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+t1 = v0;
+if (v0 == 0) goto L4086dc;
+t6 = 0x10009720;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 == at) goto L408688;
+//nop;
+MEM_U32(sp + 56) = t0;
+MEM_U32(sp + 52) = t1;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+t1 = MEM_U32(sp + 52);
+v1 = v0;
+if (v0 != 0) goto L408694;
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4086e0;
+L408688:
+t1 = t0;
+t0 = MEM_U32(sp + 60);
+v1 = v0;
+L408694:
+t7 = MEM_U32(v1 + 20);
+at = 0x1000a800;
+t8 = MEM_U32(sp + 60);
+MEM_U32(at + 0) = t7;
+a3 = MEM_U32(t0 + 20);
+t9 = 0xf;
+a2 = MEM_U32(t8 + 20);
+MEM_U32(sp + 16) = t9;
+//nop;
+t2 = MEM_U32(t1 + 20);
+a1 = MEM_U32(sp + 64);
+// bdead 400009c3 t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+MEM_U32(sp + 20) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L4086dc:
+// bdead 1 ra = MEM_U32(sp + 44);
+L4086e0:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_4086ec(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4086ec:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+at = 0x194;
+// fdead 400000ef MEM_U32(sp + 44) = ra;
+// fdead 400000ef MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 72) = a0;
+if (a0 != at) goto L40876c;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+if ((int)v0 < 0) goto L408738;
+t7 = v1 & 0x1f;
+if ((int)v0 < (int)0x20) goto L408764;
+L408738:
+a0 = 0x10005340;
+//nop;
+a1 = zero;
+a2 = 0x2;
+MEM_U32(sp + 56) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+//nop;
+t7 = v1 & 0x1f;
+L408764:
+MEM_U32(sp + 52) = t7;
+goto L408794;
+L40876c:
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+// bdead 4000010b ra = MEM_U32(sp + 44);
+if (v0 == 0) goto L4088ac;
+t8 = MEM_U32(v0 + 20);
+//nop;
+MEM_U32(sp + 52) = t8;
+L408794:
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+if (v0 == 0) goto L4088a8;
+t9 = 0x10009720;
+at = 0x28;
+t9 = MEM_U8(t9 + 0);
+a1 = zero;
+//nop;
+if (t9 == at) goto L4087e8;
+a0 = 0x10005360;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4088ac;
+L4087e8:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+if (v0 == 0) goto L4088a8;
+t0 = 0x10009720;
+at = 0x29;
+t0 = MEM_U8(t0 + 0);
+a1 = zero;
+//nop;
+if (t0 == at) goto L408854;
+a0 = 0x10005384;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4088ac;
+L408854:
+//nop;
+MEM_U32(sp + 60) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(sp + 60);
+// bdead 40000013 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 64);
+t1 = 0x3;
+a3 = MEM_U32(v1 + 20);
+//nop;
+MEM_U32(sp + 16) = t1;
+t3 = MEM_U32(t2 + 20);
+a1 = MEM_U32(sp + 72);
+a2 = MEM_U32(sp + 52);
+// fdead 160001ddf t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+MEM_U32(sp + 20) = t3;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L4088a8:
+// bdead 1 ra = MEM_U32(sp + 44);
+L4088ac:
+// bdead 1 sp = sp + 0x48;
+//nop;
+return;
+}
+
+static void func_4088b8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4088b8:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+if (v0 == 0) goto L408c70;
+t6 = 0x10009720;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+MEM_U32(sp + 72) = zero;
+//nop;
+if (t6 != at) goto L40897c;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x44;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L40897c;
+t7 = MEM_U32(sp + 68);
+//nop;
+t8 = MEM_U32(t7 + 16);
+//nop;
+//nop;
+if (t8 != 0) goto L40897c;
+//nop;
+MEM_U32(sp + 72) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x10009720;
+//nop;
+t9 = MEM_U8(t9 + 0);
+//nop;
+//nop;
+if (t9 != at) goto L40897c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L40897c:
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x64;
+goto L4089cc;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L4089cc;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L4089cc;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L4089cc;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L4089cc;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L4089cc;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L4089cc;}
+at = 0x28;
+t4 = MEM_U32(sp + 72);
+if (v0 != at) goto L408c04;
+L4089cc:
+t0 = 0x10008eac;
+//nop;
+t0 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if ((int)t0 >= (int)0x3) goto L408a08;
+//nop;
+MEM_U32(sp + 56) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+MEM_U32(sp + 64) = v0;
+goto L408a20;
+L408a08:
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x40;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+L408a20:
+t1 = MEM_U32(sp + 72);
+t2 = MEM_U32(sp + 64);
+//nop;
+if (t1 == 0) goto L408a70;
+at = (int)t2 < (int)0x401;
+if ((int)t2 < 0) goto L408a48;
+//nop;
+if ((int)t2 >= (int)0x401) goto L408a48;
+//nop;
+if (v1 == 0) goto L408a70;
+L408a48:
+a0 = 0x100053a8;
+//nop;
+a1 = zero;
+a2 = 0x2;
+MEM_U32(sp + 56) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+//nop;
+L408a70:
+t5 = MEM_U32(sp + 72);
+if (v1 == 0) goto L408b74;
+t3 = 0x10008ebc;
+a1 = zero;
+t3 = MEM_U32(t3 + 0);
+//nop;
+MEM_U32(sp + 52) = t3;
+if (t3 != 0) goto L408aac;
+a0 = 0x100053d8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L408aac:
+//nop;
+at = 0x10008ebc;
+t6 = MEM_U32(sp + 60);
+t4 = 0x2;
+t5 = 0x48;
+// fdead 6000fc5f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+MEM_U32(sp + 24) = t6;
+func_405178(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 64);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x2;
+t7 = 0x48;
+// bdead 42010003 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 76);
+//nop;
+a2 = MEM_U32(t0 + 20);
+a1 = MEM_U32(sp + 80);
+t1 = 0x4;
+t2 = 0x48;
+t3 = 0x8;
+// fdead 60001edf t9 = t9;
+MEM_U32(sp + 24) = t3;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a0 = zero;
+a3 = 0x1;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 52);
+at = 0x10008ebc;
+MEM_U32(at + 0) = t4;
+goto L408c70;
+// fdead 0 t5 = MEM_U32(sp + 72);
+L408b74:
+a1 = MEM_U32(sp + 80);
+a0 = zero;
+if (t5 == 0) goto L408bc4;
+t6 = MEM_U32(sp + 76);
+t9 = MEM_U32(sp + 64);
+a3 = MEM_U32(t5 + 20);
+a2 = MEM_U32(t6 + 20);
+MEM_U32(sp + 24) = t9;
+//nop;
+a1 = MEM_U32(sp + 80);
+t8 = 0x4;
+t7 = 0x48;
+// bdead 420101c3 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408c74;
+L408bc4:
+t0 = MEM_U32(sp + 76);
+//nop;
+a2 = MEM_U32(t0 + 20);
+t3 = MEM_U32(sp + 64);
+t1 = 0x2;
+t2 = 0x48;
+// fdead 60005eff t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a3 = 0x48;
+MEM_U32(sp + 24) = t3;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408c74;
+// fdead 0 t4 = MEM_U32(sp + 72);
+L408c04:
+a1 = MEM_U32(sp + 80);
+a0 = zero;
+if (t4 != 0) goto L408c34;
+a0 = 0x1000540c;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408c74;
+L408c34:
+t6 = MEM_U32(sp + 76);
+t5 = MEM_U32(sp + 72);
+t9 = 0x8;
+a2 = MEM_U32(t6 + 20);
+a3 = MEM_U32(t5 + 20);
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x4;
+t7 = 0x48;
+// bdead 420101e1 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L408c70:
+// bdead 1 ra = MEM_U32(sp + 44);
+L408c74:
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_408c80(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L408c80:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+at = 0x2b;
+// fdead 400000ef MEM_U32(sp + 44) = ra;
+// fdead 400000ef MEM_U32(sp + 40) = gp;
+// fdead 400000ef MEM_U32(sp + 36) = s0;
+a2 = a0;
+if (a0 != at) goto L408cb0;
+a2 = 0x22;
+goto L408cc0;
+L408cb0:
+at = 0x32;
+//nop;
+if (a2 != at) goto L408cc0;
+a2 = 0x23;
+L408cc0:
+t7 = 0x10009720;
+t6 = 0x48;
+t7 = MEM_U8(t7 + 0);
+at = 0x69;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 84) = zero;
+MEM_U32(sp + 72) = t6;
+MEM_U32(sp + 80) = zero;
+if (t7 != at) goto L409028;
+//nop;
+s0 = sp + 0x50;
+a0 = 0x10009728;
+a1 = s0;
+MEM_U32(sp + 88) = a2;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4002010b gp = MEM_U32(sp + 40);
+a1 = s0;
+if (v0 != 0) goto L408d20;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L408d20:
+t8 = MEM_U32(sp + 80);
+at = 0x3;
+v0 = MEM_U32(t8 + 16);
+//nop;
+//nop;
+if (v0 != at) goto L408ee8;
+t9 = 0x1000a7e8;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L408d70;
+//nop;
+a0 = MEM_U32(t8 + 24);
+a1 = 0x10009728;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L408d70:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+v1 = 0x10009720;
+MEM_U32(sp + 60) = zero;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 == at) {
+at = 0x2d;
+goto L408dd8;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x23;
+goto L408dd8;}
+at = 0x23;
+s0 = 0x2c;
+if (v1 == at) goto L408dd8;
+a1 = zero;
+if (s0 == v1) goto L408dd8;
+a0 = 0x10005428;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L408dd8:
+at = 0x23;
+s0 = 0x2c;
+if (v1 == at) goto L409040;
+at = 0x23;
+if (s0 == v1) goto L408e18;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4002010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x23;
+L408e18:
+t3 = MEM_U32(sp + 84);
+if (v1 == at) goto L409044;
+//nop;
+if (s0 != v1) goto L408e40;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L408e40:
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L408e74;
+t0 = 0x10009720;
+at = 0x23;
+t0 = MEM_U8(t0 + 0);
+//nop;
+//nop;
+if (t0 != at) goto L408eac;
+L408e74:
+t1 = 0x10009720;
+at = 0x23;
+t1 = MEM_U8(t1 + 0);
+a1 = zero;
+// bdead 40000141 ra = MEM_U32(sp + 44);
+if (t1 != at) goto L40910c;
+a0 = 0x10005444;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L408eac:
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+if (v0 == 0) goto L409108;
+t2 = 0x10009720;
+at = 0x23;
+t2 = MEM_U8(t2 + 0);
+//nop;
+t3 = MEM_U32(sp + 84);
+if (t2 == at) goto L409044;
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L408ee8:
+at = 0x4;
+if (v0 != 0) goto L408fe4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 80);
+t4 = MEM_U32(sp + 88);
+// bdead 40003103 gp = MEM_U32(sp + 40);
+v0 = 0x23;
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 84) = t3;
+if (t4 != v0) goto L409040;
+v1 = 0x10009720;
+s0 = 0x2c;
+v1 = MEM_U8(v1 + 0);
+//nop;
+t3 = MEM_U32(sp + 84);
+if (v0 == v1) goto L409044;
+// bdead 40000103 ra = MEM_U32(sp + 44);
+if (s0 != v1) goto L40910c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+s0 = sp + 0x38;
+L408f54:
+//nop;
+s0 = s0 + 0x4;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4002010b gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 0) = v0;
+if (v0 == 0) goto L409108;
+t5 = sp + 0x44;
+t7 = sp + 0x40;
+if (s0 == t5) goto L408f98;
+t6 = 0x10009720;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 != at) goto L408f54;
+t7 = sp + 0x40;
+L408f98:
+t3 = MEM_U32(sp + 84);
+if (s0 == t7) goto L409044;
+t9 = MEM_U32(sp + 84);
+t0 = MEM_U32(sp + 60);
+t8 = MEM_U32(t9 + 20);
+MEM_U32(sp + 84) = t0;
+MEM_U32(sp + 72) = t8;
+t2 = MEM_U32(t0 + 20);
+a2 = 0x2;
+t3 = MEM_U32(sp + 84);
+if (t8 != t2) goto L409044;
+a0 = 0x10005464;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 84);
+goto L409044;
+L408fe4:
+a2 = 0x1;
+if (v0 != at) goto L409008;
+//nop;
+MEM_U32(sp + 80) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+goto L409040;
+L409008:
+a0 = 0x1000548c;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L409028:
+//nop;
+MEM_U32(sp + 88) = a2;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+L409040:
+t3 = MEM_U32(sp + 84);
+L409044:
+t6 = MEM_U32(sp + 80);
+a0 = zero;
+if (t3 == 0) goto L409088;
+//nop;
+a2 = MEM_U32(t3 + 20);
+a1 = MEM_U32(sp + 88);
+a3 = MEM_U32(sp + 72);
+t4 = 0x7;
+t5 = 0x48;
+// bdead 400061e3 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L409088:
+a0 = zero;
+if (t6 == 0) goto L4090d0;
+a0 = MEM_U32(t6 + 24);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t8 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 88);
+t7 = 0x6;
+// bdead 42010061 t9 = t9;
+MEM_U32(sp + 16) = t7;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t8;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40910c;
+L4090d0:
+//nop;
+t2 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 88);
+t0 = 0x6;
+t1 = 0x48;
+// bdead 40000e61 t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L409108:
+// bdead 1 ra = MEM_U32(sp + 44);
+L40910c:
+// bdead 1 s0 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static uint32_t func_409118(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L409118:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009b28;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+at = 0x1;
+// fdead 400080ef MEM_U32(sp + 28) = ra;
+// fdead 400080ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+if (t6 != at) goto L40915c;
+t7 = 0x10009728;
+at = 0x2e;
+t7 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t7 == at) goto L409164;
+L40915c:
+v0 = zero;
+goto L4092ec;
+L409164:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2d;
+v0 = 0x10009720;
+v1 = zero;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 != at) {
+at = 0x2b;
+goto L4091a0;}
+at = 0x2b;
+v1 = 0x1;
+goto L4091c8;
+at = 0x2b;
+L4091a0:
+a1 = zero;
+if (v0 == at) goto L4091c8;
+a0 = 0x100054a8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L4092ec;
+L4091c8:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+t8 = 0x10009720;
+at = 0x64;
+t8 = MEM_U8(t8 + 0);
+a1 = zero;
+//nop;
+if (t8 == at) goto L409218;
+a0 = 0x100054c0;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L4092ec;
+L409218:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+t9 = v0 & 0x3;
+at = 0x8001;
+if (t9 == 0) goto L409260;
+a0 = 0x100054dc;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L4092ec;
+L409260:
+a1 = zero;
+if ((int)v0 < (int)at) goto L40928c;
+a0 = 0x10005500;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L4092ec;
+L40928c:
+//nop;
+if (v1 != 0) goto L40929c;
+t1 = 0x3;
+if (v0 != 0) goto L4092c0;
+L40929c:
+at = 0x10000000;
+t0 = 0x4;
+MEM_U32(at + 0) = t0;
+v1 = (int)v0 >> 2;
+if ((int)v0 >= 0) goto L4092b8;
+at = v0 + 0x3;
+v1 = (int)at >> 2;
+L4092b8:
+t3 = MEM_U32(sp + 40);
+goto L4092e4;
+L4092c0:
+at = 0x10000000;
+v1 = v0 + 0xfffffffc;
+MEM_U32(at + 0) = t1;
+t2 = (int)v1 >> 2;
+if ((int)v1 >= 0) goto L4092dc;
+at = v1 + 0x3;
+t2 = (int)at >> 2;
+L4092dc:
+v1 = t2;
+t3 = MEM_U32(sp + 40);
+L4092e4:
+v0 = 0x1;
+MEM_U32(t3 + 0) = v1;
+L4092ec:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_4092fc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4092fc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 88) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 92) = v0;
+if (v0 == 0) goto L409840;
+t6 = 0x10009720;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+//nop;
+t0 = MEM_U32(sp + 88);
+if (t6 != at) goto L4093cc;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x50;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 88);
+if (v0 == 0) goto L4093cc;
+t7 = MEM_U32(sp + 80);
+//nop;
+t8 = MEM_U32(t7 + 16);
+//nop;
+t0 = MEM_U32(sp + 88);
+if (t8 != 0) goto L4093cc;
+//nop;
+MEM_U32(sp + 88) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x10009720;
+//nop;
+t9 = MEM_U8(t9 + 0);
+//nop;
+t0 = MEM_U32(sp + 88);
+if (t9 != at) goto L4093cc;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+t0 = MEM_U32(sp + 88);
+L4093cc:
+//nop;
+t3 = MEM_U32(sp + 88);
+if (t0 != 0) goto L40946c;
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x64;
+goto L409410;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L409410;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L409410;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L409410;}
+at = 0x2d;
+t3 = MEM_U32(sp + 88);
+if (v0 != at) goto L40946c;
+L409410:
+t1 = 0x10008eac;
+//nop;
+t1 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if ((int)t1 >= (int)0x3) goto L409448;
+//nop;
+MEM_U32(sp + 64) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 72) = v0;
+goto L409460;
+L409448:
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x48;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+L409460:
+t2 = 0x1;
+MEM_U32(sp + 76) = t2;
+t3 = MEM_U32(sp + 88);
+L40946c:
+t4 = MEM_U32(sp + 76);
+//nop;
+if (t3 != 0) goto L4094a0;
+a1 = zero;
+if (t4 != 0) goto L4094a0;
+a0 = 0x10005520;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409844;
+L4094a0:
+t5 = 0x10009720;
+at = 0x69;
+t5 = MEM_U8(t5 + 0);
+a1 = zero;
+//nop;
+if (t5 == at) goto L4094d8;
+a0 = 0x1000553c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409844;
+L4094d8:
+//nop;
+a0 = sp + 0x44;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_409118(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L4095ac;
+v0 = 0x1000a7c0;
+t8 = MEM_U32(sp + 68);
+t9 = MEM_U16(v0 + 10);
+t2 = MEM_U32(sp + 76);
+t7 = t8 & 0x3fff;
+t0 = t9 & 0xc000;
+t1 = t7 | t0;
+MEM_U16(v0 + 10) = (uint16_t)t1;
+if (t2 == 0) goto L409560;
+t3 = MEM_U32(sp + 92);
+//nop;
+a2 = MEM_U32(t3 + 20);
+t6 = MEM_U32(sp + 72);
+a1 = MEM_U32(sp + 96);
+t4 = 0xc;
+t5 = 0x48;
+// bdead 4000e0c3 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a3 = 0x48;
+MEM_U32(sp + 24) = t6;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+goto L4095a0;
+L409560:
+t9 = MEM_U32(sp + 88);
+t8 = MEM_U32(sp + 92);
+a3 = MEM_U32(t9 + 20);
+//nop;
+a2 = MEM_U32(t8 + 20);
+a1 = MEM_U32(sp + 96);
+t7 = 0x8;
+t0 = 0x48;
+// bdead 400103c3 t9 = t9;
+MEM_U32(sp + 20) = t0;
+MEM_U32(sp + 16) = t7;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+L4095a0:
+at = 0x10000000;
+MEM_U32(at + 0) = zero;
+goto L409840;
+L4095ac:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x50;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = sp + 0x54;
+if (v0 == 0) goto L409608;
+t1 = MEM_U32(sp + 80);
+at = 0x3;
+t2 = MEM_U32(t1 + 16);
+a2 = 0x1;
+//nop;
+if (t2 != at) goto L4095e8;
+MEM_U32(sp + 84) = t1;
+goto L409620;
+L4095e8:
+a0 = 0x1000554c;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409844;
+L409608:
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L409620:
+t3 = 0x1000a7e8;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L40969c;
+a1 = 0x10009728;
+t5 = 0xfb504f0;
+t4 = MEM_U8(a1 + 0);
+t7 = MEM_U32(sp + 84);
+t6 = t4 + t5;
+t8 = MEM_U8(t6 + 1);
+t0 = MEM_U32(sp + 84);
+t9 = t8 & 0x4;
+//nop;
+if (t9 == 0) goto L409680;
+//nop;
+a0 = MEM_U32(t7 + 24);
+// bdead 40000023 t9 = t9;
+a1 = zero;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40969c;
+L409680:
+//nop;
+a0 = MEM_U32(t0 + 24);
+// bdead 40000063 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L40969c:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t2 = MEM_U32(sp + 76);
+// bdead 40000903 gp = MEM_U32(sp + 40);
+t1 = 0x8;
+if (t2 == 0) goto L409800;
+t1 = 0x10008ebc;
+t3 = MEM_U32(sp + 64);
+t1 = MEM_U32(t1 + 0);
+MEM_U32(sp + 56) = t1;
+if (t3 == 0) goto L4097b8;
+a1 = zero;
+if (t1 != 0) goto L4096f4;
+a0 = 0x10005564;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+L4096f4:
+//nop;
+at = 0x10008ebc;
+t6 = MEM_U32(sp + 60);
+t4 = 0x2;
+t5 = 0x48;
+// fdead 6000fc5f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+MEM_U32(sp + 24) = t6;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = MEM_U32(sp + 72);
+t8 = 0x2;
+// bdead 42010003 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(sp + 24) = t7;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 84);
+t2 = MEM_U32(sp + 92);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a2 = MEM_U32(t2 + 20);
+a1 = MEM_U32(sp + 96);
+t3 = 0x8;
+t1 = 0x48;
+// fdead 60001eff t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = zero;
+a3 = 0x1;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 56);
+at = 0x10008ebc;
+MEM_U32(at + 0) = t4;
+goto L409840;
+L4097b8:
+t5 = MEM_U32(sp + 84);
+t6 = MEM_U32(sp + 92);
+t9 = 0x48;
+a0 = MEM_U32(t5 + 24);
+a2 = MEM_U32(t6 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = MEM_U32(sp + 72);
+a1 = MEM_U32(sp + 96);
+t8 = 0xc;
+// bdead 420100e1 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a3 = 0x48;
+MEM_U32(sp + 24) = t7;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409844;
+L409800:
+t0 = MEM_U32(sp + 84);
+t2 = MEM_U32(sp + 92);
+t3 = MEM_U32(sp + 88);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a2 = MEM_U32(t2 + 20);
+a3 = MEM_U32(t3 + 20);
+a1 = MEM_U32(sp + 96);
+t4 = 0x48;
+// fdead 60003fff t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 24) = zero;
+MEM_U32(sp + 16) = t1;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L409840:
+// bdead 1 ra = MEM_U32(sp + 44);
+L409844:
+// bdead 1 sp = sp + 0x60;
+//nop;
+return;
+}
+
+static void func_409850(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L409850:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+at = 0xe3;
+// fdead 400000ef MEM_U32(sp + 44) = ra;
+// fdead 400000ef MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+if (a0 != at) goto L409888;
+t7 = 0x10009f38;
+//nop;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(sp + 60) = t7;
+goto L409900;
+L409888:
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L409b00;
+v1 = MEM_U32(sp + 64);
+at = 0xe5;
+if (v1 == at) {
+at = 0x120;
+goto L4098cc;}
+at = 0x120;
+if (v1 == at) {
+at = 0xe4;
+goto L4098cc;}
+at = 0xe4;
+if (v1 == at) {
+at = 0x124;
+goto L4098cc;}
+at = 0x124;
+//nop;
+if (v1 != at) goto L409900;
+L4098cc:
+t8 = 0x10009f38;
+a1 = zero;
+t8 = MEM_U32(t8 + 124);
+//nop;
+//nop;
+if (v0 != t8) goto L409900;
+a0 = 0x10005598;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L409900:
+t9 = 0x10009720;
+at = 0x69;
+t9 = MEM_U8(t9 + 0);
+a1 = zero;
+//nop;
+if (t9 == at) goto L409938;
+a0 = 0x100055c8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409b04;
+L409938:
+//nop;
+a0 = sp + 0x30;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_409118(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a0 = zero;
+if (v0 == 0) goto L4099b8;
+v0 = 0x1000a7c0;
+t1 = MEM_U32(sp + 48);
+t3 = MEM_U16(v0 + 10);
+t2 = t1 & 0x3fff;
+t4 = t3 & 0xc000;
+t6 = MEM_U32(sp + 60);
+t5 = t2 | t4;
+MEM_U16(v0 + 10) = (uint16_t)t5;
+//nop;
+a2 = MEM_U32(t6 + 20);
+a1 = MEM_U32(sp + 64);
+t7 = 0x9;
+t8 = 0x48;
+// fdead 6201fcff t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+MEM_U32(sp + 24) = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+at = 0x10000000;
+MEM_U32(at + 0) = zero;
+goto L409b00;
+L4099b8:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x34;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+t9 = MEM_U32(sp + 52);
+a3 = 0x10009728;
+a0 = a3;
+if (v0 == 0) goto L409a14;
+t0 = MEM_U32(t9 + 16);
+at = 0x3;
+a1 = a3;
+if (t0 != at) goto L4099f4;
+MEM_U32(sp + 56) = t9;
+goto L409a34;
+L4099f4:
+a0 = 0x100055d8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409b04;
+L409a14:
+//nop;
+a1 = sp + 0x38;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+a3 = 0x10009728;
+//nop;
+L409a34:
+t1 = 0x1000a7e8;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L409aac;
+t3 = MEM_U8(a3 + 0);
+t2 = 0xfb504f0;
+t7 = MEM_U32(sp + 56);
+t4 = t3 + t2;
+t5 = MEM_U8(t4 + 1);
+t8 = MEM_U32(sp + 56);
+t6 = t5 & 0x4;
+//nop;
+if (t6 == 0) goto L409a90;
+//nop;
+a0 = MEM_U32(t7 + 24);
+// bdead 40000023 t9 = t9;
+a1 = zero;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+goto L409aac;
+L409a90:
+//nop;
+a0 = MEM_U32(t8 + 24);
+// bdead 40000123 t9 = t9;
+a1 = a3;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L409aac:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 60);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+a2 = MEM_U32(t9 + 20);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a1 = MEM_U32(sp + 64);
+t1 = 0x9;
+t3 = 0x48;
+// bdead 400014e3 t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L409b00:
+// bdead 1 ra = MEM_U32(sp + 44);
+L409b04:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_409b10(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L409b10:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffb0;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 400080ef MEM_U32(sp + 44) = ra;
+// fdead 400080ef MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+if (t6 == at) goto L409b60;
+a0 = 0x100055f0;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409ec0;
+L409b60:
+t7 = MEM_U32(sp + 80);
+t8 = 0x40;
+v0 = t7 ^ 0x8;
+v1 = v0 < 0x1;
+v0 = t7 ^ 0x7;
+if (v1 != 0) goto L409b98;
+v1 = v0 < 0x1;
+v0 = t7 ^ 0x128;
+if (v1 != 0) goto L409b98;
+v1 = v0 < 0x1;
+//nop;
+if (v1 != 0) goto L409b98;
+v1 = t7 ^ 0x127;
+v1 = v1 < 0x1;
+L409b98:
+MEM_U32(sp + 52) = v1;
+if (v1 == 0) goto L409c38;
+//nop;
+a0 = 0x10009728;
+MEM_U32(sp + 60) = t8;
+a1 = sp + 0x44;
+MEM_U32(sp + 52) = v1;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L409c38;
+t9 = MEM_U32(sp + 68);
+//nop;
+t0 = MEM_U32(t9 + 16);
+//nop;
+//nop;
+if (t0 != 0) goto L409c38;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t1 = 0x10009720;
+//nop;
+t1 = MEM_U8(t1 + 0);
+//nop;
+t2 = MEM_U32(sp + 68);
+if (t1 != at) goto L409c28;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+t2 = MEM_U32(sp + 68);
+L409c28:
+//nop;
+t3 = MEM_U32(t2 + 20);
+//nop;
+MEM_U32(sp + 60) = t3;
+L409c38:
+t4 = 0x10009720;
+v1 = MEM_U32(sp + 52);
+t4 = MEM_U8(t4 + 0);
+at = 0x69;
+a1 = zero;
+if (t4 == at) goto L409c70;
+a0 = 0x10005614;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409ec0;
+L409c70:
+//nop;
+a0 = sp + 0x38;
+// bdead 40000133 t9 = t9;
+MEM_U32(sp + 52) = v1;
+v0 = func_409118(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L409d34;
+v0 = 0x1000a7c0;
+t6 = MEM_U32(sp + 56);
+t8 = MEM_U16(v0 + 10);
+t1 = MEM_U32(sp + 52);
+t7 = t6 & 0x3fff;
+t9 = t8 & 0xc000;
+t0 = t7 | t9;
+MEM_U16(v0 + 10) = (uint16_t)t0;
+if (t1 == 0) goto L409cf0;
+//nop;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 60);
+t2 = 0x9;
+t3 = 0x48;
+// bdead 400018c3 t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t2;
+a0 = zero;
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+goto L409d28;
+L409cf0:
+//nop;
+a1 = MEM_U32(sp + 80);
+t4 = 0xa;
+t5 = 0x48;
+// bdead 40006043 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+L409d28:
+at = 0x10000000;
+MEM_U32(at + 0) = zero;
+goto L409ebc;
+L409d34:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x48;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = sp + 0x4c;
+if (v0 == 0) goto L409d90;
+t6 = MEM_U32(sp + 72);
+at = 0x3;
+t8 = MEM_U32(t6 + 16);
+a2 = 0x1;
+//nop;
+if (t8 != at) goto L409d70;
+MEM_U32(sp + 76) = t6;
+goto L409da8;
+L409d70:
+a0 = 0x10005624;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409ec0;
+L409d90:
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L409da8:
+t7 = 0x1000a7e8;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L409e24;
+a1 = 0x10009728;
+t0 = 0xfb504f0;
+t9 = MEM_U8(a1 + 0);
+t4 = MEM_U32(sp + 76);
+t1 = t9 + t0;
+t2 = MEM_U8(t1 + 1);
+t5 = MEM_U32(sp + 76);
+t3 = t2 & 0x4;
+//nop;
+if (t3 == 0) goto L409e08;
+//nop;
+a0 = MEM_U32(t4 + 24);
+// bdead 40000023 t9 = t9;
+a1 = zero;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+goto L409e24;
+L409e08:
+//nop;
+a0 = MEM_U32(t5 + 24);
+// bdead 40000063 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+L409e24:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 52);
+// bdead 42000003 gp = MEM_U32(sp + 40);
+a2 = 0x48;
+if (t8 == 0) goto L409e84;
+t6 = MEM_U32(sp + 76);
+t9 = 0x48;
+a0 = MEM_U32(t6 + 24);
+MEM_U32(sp + 20) = t9;
+//nop;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 60);
+t7 = 0x9;
+// bdead 400100e3 t9 = t9;
+MEM_U32(sp + 16) = t7;
+MEM_U32(sp + 24) = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409ec0;
+L409e84:
+t0 = MEM_U32(sp + 76);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a1 = MEM_U32(sp + 80);
+t1 = 0xa;
+t2 = 0x48;
+// fdead 62000eff t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L409ebc:
+// bdead 1 ra = MEM_U32(sp + 44);
+L409ec0:
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_409ecc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L409ecc:
+//nop;
+//nop;
+//nop;
+v0 = 0x10009720;
+sp = sp + 0xffffffc8;
+v0 = MEM_U8(v0 + 0);
+at = 0x69;
+// fdead 400000ef MEM_U32(sp + 44) = ra;
+// fdead 400000ef MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 56) = a0;
+if (v0 == at) goto L409f1c;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L409f1c;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L409f1c;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L409f1c;}
+at = 0x2d;
+a1 = zero;
+if (v0 != at) goto L409f38;
+L409f1c:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+goto L409f58;
+L409f38:
+a0 = 0x1000563c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L409fc4;
+L409f58:
+t6 = v0 >> 25;
+a1 = zero;
+if (t6 == 0) goto L409f88;
+a0 = 0x10005650;
+//nop;
+a2 = 0x1;
+MEM_U32(sp + 52) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 52);
+//nop;
+L409f88:
+//nop;
+a1 = MEM_U32(sp + 56);
+t7 = 0x2;
+t8 = 0x48;
+// fdead 6201805f t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = v1;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 44);
+L409fc4:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_409fd0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L409fd0:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400000eb MEM_U32(sp + 44) = ra;
+// fdead 400000eb MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 48) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a0 = zero;
+if (v0 == 0) goto L40a034;
+//nop;
+a2 = MEM_U32(v0 + 20);
+a1 = MEM_U32(sp + 48);
+t6 = 0x7;
+t7 = 0x48;
+// fdead 600180fb t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = zero;
+a3 = 0x48;
+func_405178(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+//nop;
+L40a034:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40a044(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t2 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40a044:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a7c0;
+t7 = a0 & 0x3f;
+t8 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v1 + 5) = (uint8_t)t0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601027b MEM_U32(sp + 28) = ra;
+// fdead 4601027b MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+// bdead 40000019 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L40a0c8;
+t2 = MEM_U32(v0 + 20);
+t5 = MEM_U8(v1 + 8);
+t4 = t2 << 1;
+t6 = t5 & 0xff01;
+t8 = t4 | t6;
+MEM_U8(v1 + 8) = (uint8_t)t8;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40a0c8:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40a0d4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40a0d4:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a7c0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0xf;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201807b MEM_U32(sp + 28) = ra;
+// fdead 4201807b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t9 = v0 & 0x3;
+v1 = 0x1000a7c0;
+MEM_U32(v1 + 8) = v0;
+if (t9 == 0) goto L40a140;
+a0 = 0x10005670;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40a140:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40a160(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40a160:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(v0 + 5);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x21;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201806b MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if (v0 != 0) goto L40a1cc;
+a0 = 0x100056ac;
+//nop;
+a1 = zero;
+a2 = 0x1;
+MEM_U32(sp + 36) = v0;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+//nop;
+L40a1cc:
+v0 = 0x1000a7c0;
+t0 = MEM_U32(v1 + 20);
+t3 = MEM_U8(v0 + 8);
+t2 = t0 << 1;
+t4 = t3 & 0xff01;
+t5 = t2 | t4;
+MEM_U8(v0 + 8) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40a208(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40a208:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 36);
+// bdead 40008103 gp = MEM_U32(sp + 24);
+at = 0x3;
+a1 = zero;
+if (t6 == at) goto L40a270;
+a0 = 0x100056d4;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40a270:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40a280(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a280:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 52) = v0;
+if (v0 == 0) goto L40a4a0;
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x64;
+goto L40a2f4;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L40a2f4;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L40a2f4;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L40a2f4;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L40a2f4;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L40a2f4;}
+at = 0x28;
+a1 = zero;
+if (v0 != at) goto L40a310;
+L40a2f4:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 44) = v0;
+goto L40a330;
+L40a310:
+a0 = 0x100056f4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40a4a4;
+L40a330:
+t6 = 0x10009720;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 == at) goto L40a36c;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 48) = v0;
+if (v0 != 0) goto L40a380;
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40a4a4;
+L40a36c:
+t7 = 0x10009f38;
+//nop;
+t7 = MEM_U32(t7 + 124);
+//nop;
+MEM_U32(sp + 48) = t7;
+L40a380:
+a0 = 0x100002fc;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = sp + 0x28;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a2 = 0x1;
+if (v0 != 0) goto L40a3c0;
+a1 = 0x100002fc;
+a0 = 0x10005708;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L40a3c0:
+v0 = MEM_U32(sp + 52);
+t9 = MEM_U32(sp + 40);
+t8 = MEM_U32(v0 + 8);
+a0 = 0x10000300;
+MEM_U32(t9 + 8) = t8;
+t1 = MEM_U32(sp + 40);
+t0 = MEM_U32(v0 + 20);
+a1 = sp + 0x28;
+MEM_U32(t1 + 20) = t0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a2 = 0x1;
+if (v0 != 0) goto L40a420;
+a1 = 0x10000300;
+a0 = 0x1000571c;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L40a420:
+t2 = MEM_U32(sp + 44);
+t3 = MEM_U32(sp + 40);
+v0 = 0x1000a7c0;
+MEM_U32(t3 + 8) = t2;
+t4 = MEM_U8(v0 + 5);
+t7 = MEM_U32(sp + 52);
+t5 = t4 & 0xffc0;
+t6 = t5 | 0x2b;
+MEM_U32(v0 + 0) = zero;
+MEM_U8(v0 + 5) = (uint8_t)t6;
+t2 = MEM_U8(v0 + 12);
+t9 = MEM_U32(t7 + 20);
+t5 = MEM_U32(sp + 44);
+t3 = t2 & 0xff01;
+t1 = t9 << 1;
+t6 = MEM_U32(sp + 48);
+t4 = t1 | t3;
+MEM_U8(v0 + 12) = (uint8_t)t4;
+MEM_U32(v0 + 8) = t5;
+t8 = MEM_U32(t6 + 20);
+t2 = MEM_U16(v0 + 12);
+t9 = t8 << 2;
+t0 = t9 & 0x1fc;
+t1 = t2 & 0xfe03;
+t3 = t0 | t1;
+MEM_U16(v0 + 12) = (uint16_t)t3;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40a4a0:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40a4a4:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_40a4b0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L40a4b0:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ec8;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+if (t6 == 0) goto L40a4f0;
+//nop;
+a0 = zero;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40a4f0:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead b gp = MEM_U32(sp + 24);
+t7 = 0x1;
+at = 0x10008ec4;
+// bdead 1000f ra = MEM_U32(sp + 28);
+MEM_U32(at + 0) = v0;
+at = 0x10008ec0;
+//nop;
+MEM_U32(at + 0) = t7;
+at = 0x10008ec8;
+// bdead 7 sp = sp + 0x20;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static void func_40a530(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40a530:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x1;
+v1 = v0;
+if (v0 == at) goto L40a588;
+a0 = 0x10005730;
+//nop;
+a1 = zero;
+a2 = 0x1;
+MEM_U32(sp + 36) = v0;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+//nop;
+L40a588:
+v0 = 0x1000a7c0;
+//nop;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x39;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+MEM_U32(v0 + 8) = v1;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+at = 0x1000a7e0;
+t9 = 0x1;
+// bdead 4000005 sp = sp + 0x28;
+MEM_U32(at + 0) = t9;
+return;
+}
+
+static void func_40a5d4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40a5d4:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 < 0) goto L40a60c;
+//nop;
+if ((int)v0 < (int)0xd) goto L40a630;
+L40a60c:
+a0 = 0x10005750;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40a6ac;
+L40a630:
+t6 = 0x10008ec0;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40a670;
+t7 = 0x10008ec4;
+t8 = v0 << (v0 & 0x1f);
+t7 = MEM_U32(t7 + 0);
+at = 0x10008ec4;
+t9 = t7 + t8;
+t0 = t9 + 0xffffffff;
+t1 = (int)t0 >> (v0 & 0x1f);
+t2 = t1 << (v0 & 0x1f);
+MEM_U32(at + 0) = t2;
+goto L40a6a8;
+L40a670:
+v0 = 0x1000a7c0;
+//nop;
+t3 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t4 = t3 & 0xffc0;
+t5 = t4 | 0x4;
+MEM_U8(v0 + 5) = (uint8_t)t5;
+MEM_U32(v0 + 8) = v1;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40a6a8:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40a6ac:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40a6b8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L40a6b8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+s3 = 0x1000a7c0;
+t7 = a0 & 0x3f;
+t8 = MEM_U8(s3 + 5);
+v1 = 0x10009b28;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U32(s3 + 0) = zero;
+MEM_U8(s3 + 5) = (uint8_t)t0;
+v1 = MEM_U32(v1 + 0);
+// fdead 4611027b MEM_U32(sp + 28) = s1;
+// fdead 4611027b MEM_U32(sp + 44) = ra;
+// fdead 4611027b MEM_U32(sp + 40) = gp;
+// fdead 4611027b MEM_U32(sp + 32) = s2;
+// fdead 4611027b MEM_U32(sp + 24) = s0;
+v0 = 0x10;
+s1 = zero;
+MEM_U32(s3 + 8) = v1;
+if ((int)v1 <= 0) goto L40a76c;
+s0 = 0x10009728;
+s2 = 0x10;
+L40a71c:
+//nop;
+if (v0 != s2) goto L40a74c;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 401e0003 gp = MEM_U32(sp + 40);
+v0 = zero;
+v1 = 0x10009b28;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40a74c:
+t1 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+at = (int)s1 < (int)v1;
+t2 = s3 + v0;
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(t2 + 0) = (uint8_t)t1;
+if (at != 0) goto L40a71c;
+L40a76c:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40a79c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0,
+t8 = 0, t9 = 0;
+L40a79c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+t6 = MEM_U32(t6 + 0);
+s1 = a0;
+// fdead 4004806b MEM_U32(sp + 60) = ra;
+// fdead 4004806b MEM_U32(sp + 56) = gp;
+// fdead 4004806b MEM_U32(sp + 52) = s7;
+// fdead 4004806b MEM_U32(sp + 48) = s6;
+// fdead 4004806b MEM_U32(sp + 44) = s5;
+// fdead 4004806b MEM_U32(sp + 40) = s4;
+// fdead 4004806b MEM_U32(sp + 36) = s3;
+// fdead 4004806b MEM_U32(sp + 32) = s2;
+// fdead 4004806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40a800;
+//nop;
+a0 = zero;
+// fdead 4004806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40040103 gp = MEM_U32(sp + 56);
+//nop;
+L40a800:
+v0 = 0x10009720;
+s3 = 0x1000576c;
+s7 = 0x10009b28;
+s6 = 0x10008ec0;
+s0 = 0x10008ec4;
+v0 = MEM_U8(v0 + 0);
+s5 = 0x2c;
+s4 = 0x23;
+s2 = 0x22;
+s3 = s3;
+L40a828:
+a0 = s3;
+if (s2 == v0) goto L40a85c;
+//nop;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+goto L40a8f4;
+L40a85c:
+t7 = MEM_U32(s6 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40a890;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(s7 + 0);
+//nop;
+t0 = t8 + t9;
+MEM_U32(s0 + 0) = t0;
+if (s1 == 0) goto L40a8f4;
+t2 = t0 + 0x1;
+MEM_U32(s0 + 0) = t2;
+goto L40a8f4;
+L40a890:
+//nop;
+if (s1 == 0) goto L40a8c8;
+//nop;
+a0 = 0x6;
+// bdead 41fe0023 t9 = t9;
+//nop;
+func_40a6b8(mem, sp, a0);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+goto L40a8f4;
+L40a8c8:
+//nop;
+a0 = 0x5;
+// bdead 41fe0023 t9 = t9;
+//nop;
+func_40a6b8(mem, sp, a0);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+L40a8f4:
+//nop;
+if (s4 == v0) goto L40a924;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+L40a924:
+//nop;
+if (s5 == v0) goto L40a828;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40a958(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40a958:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 56) = gp;
+// fdead 4000806b MEM_U32(sp + 52) = s7;
+// fdead 4000806b MEM_U32(sp + 48) = s6;
+// fdead 4000806b MEM_U32(sp + 44) = s5;
+// fdead 4000806b MEM_U32(sp + 40) = s4;
+// fdead 4000806b MEM_U32(sp + 36) = s3;
+// fdead 4000806b MEM_U32(sp + 32) = s2;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+// fdead 4000806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40a9b8;
+//nop;
+a0 = zero;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+//nop;
+L40a9b8:
+s7 = 0x10005784;
+s6 = 0x10009720;
+s4 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+s5 = 0x23;
+s3 = sp + 0x4c;
+s2 = sp + 0x48;
+s7 = s7;
+L40a9dc:
+//nop;
+a0 = s2;
+a1 = s3;
+f_GetItem(mem, sp, a0, a1);
+t7 = MEM_U32(s4 + 0);
+// bdead 41ff0103 gp = MEM_U32(sp + 56);
+v0 = MEM_U32(sp + 72);
+if (t7 == 0) goto L40aa2c;
+v1 = MEM_U32(sp + 76);
+//nop;
+v0 = v1;
+if ((int)v1 > 0) goto L40aa14;
+v0 = 0x1;
+goto L40aa14;
+L40aa14:
+t8 = MEM_U32(s1 + 0);
+//nop;
+t9 = v0 + t8;
+MEM_U32(s1 + 0) = t9;
+goto L40aa98;
+// fdead 0 v0 = MEM_U32(sp + 72);
+L40aa2c:
+a0 = s7;
+if ((int)v0 < (int)0xffffff80) {
+at = (int)v0 < (int)0x100;
+goto L40aa48;}
+//nop;
+if ((int)v0 < (int)0x100) goto L40aa60;
+MEM_U32(sp + 72) = v0;
+L40aa48:
+//nop;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0003 gp = MEM_U32(sp + 56);
+v0 = zero;
+L40aa60:
+t0 = MEM_U8(s0 + 5);
+v1 = MEM_U32(sp + 76);
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x7;
+MEM_U32(s0 + 0) = zero;
+MEM_U8(s0 + 5) = (uint8_t)t2;
+MEM_U32(s0 + 8) = v0;
+MEM_U32(s0 + 12) = v1;
+//nop;
+MEM_U32(sp + 72) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+L40aa98:
+t3 = MEM_U8(s6 + 0);
+//nop;
+//nop;
+if (s5 != t3) goto L40a9dc;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void func_40aad4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40aad4:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffc8;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 4000806f MEM_U32(sp + 28) = ra;
+// fdead 4000806f MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+if (t6 == at) goto L40ab54;
+a0 = 0x1000579c;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x23;
+t7 = 0x10009720;
+//nop;
+t7 = MEM_U8(t7 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t7 == at) goto L40adf0;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40adf0;
+L40ab54:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x34;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x34;
+if (v0 != 0) goto L40ab90;
+a2 = MEM_U32(sp + 56);
+//nop;
+a0 = 0x10009728;
+t8 = a2 ^ 0x9;
+a2 = zero < t8;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40ab90:
+t9 = 0x1000a7e8;
+t0 = MEM_U32(sp + 52);
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40abc8;
+//nop;
+a0 = MEM_U32(t0 + 24);
+a1 = 0x10009728;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40abc8:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t1 = 0x10009720;
+//nop;
+t1 = MEM_U8(t1 + 0);
+//nop;
+t2 = MEM_U32(sp + 56);
+if (t1 != at) goto L40ac14;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+t2 = MEM_U32(sp + 56);
+L40ac14:
+at = 0x2d;
+MEM_U32(sp + 40) = zero;
+if (t2 != at) goto L40ac40;
+v1 = 0x10009720;
+at = 0x23;
+v1 = MEM_U8(v1 + 0);
+//nop;
+//nop;
+if (v1 != at) goto L40ac40;
+MEM_U32(sp + 44) = zero;
+goto L40ac68;
+L40ac40:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 44) = v0;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+L40ac68:
+at = 0x69;
+t6 = MEM_U32(sp + 52);
+if (v1 != at) goto L40ace4;
+t3 = 0x10009728;
+at = 0x53;
+t3 = MEM_U8(t3 + 0);
+a1 = zero;
+//nop;
+if (t3 != at) goto L40acac;
+t4 = 0x10009728;
+t5 = 0x1;
+t4 = MEM_U8(t4 + 1);
+//nop;
+//nop;
+if (t4 != 0) goto L40acac;
+MEM_U32(sp + 40) = t5;
+goto L40acc8;
+L40acac:
+a0 = 0x100057b0;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L40acc8:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+t6 = MEM_U32(sp + 52);
+L40ace4:
+at = 0x3;
+t7 = MEM_U32(t6 + 16);
+t8 = MEM_U32(sp + 52);
+a2 = 0x1;
+if (t7 == at) goto L40ad18;
+a0 = 0x100057d4;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40adf0;
+L40ad18:
+v0 = 0x1000a7c0;
+t9 = MEM_U32(t8 + 24);
+t1 = MEM_U32(sp + 56);
+t3 = MEM_U8(v0 + 5);
+t6 = MEM_U32(sp + 44);
+t7 = MEM_U32(sp + 40);
+t2 = t1 & 0x3f;
+t4 = t3 & 0xffc0;
+t5 = t2 | t4;
+MEM_U8(v0 + 5) = (uint8_t)t5;
+MEM_U32(v0 + 0) = t9;
+MEM_U32(v0 + 8) = t6;
+MEM_U32(v0 + 12) = t7;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t8 = MEM_U32(sp + 56);
+// bdead 42000101 gp = MEM_U32(sp + 24);
+at = 0x8;
+t9 = 0x11;
+if (t8 == at) goto L40ad90;
+at = 0x9;
+t0 = 0x21;
+if (t8 == at) goto L40ad98;
+at = 0x2d;
+t1 = 0x22;
+if (t8 == at) goto L40ada0;
+a2 = 0xa08;
+goto L40ada8;
+L40ad90:
+MEM_U32(sp + 48) = t9;
+goto L40adc8;
+L40ad98:
+MEM_U32(sp + 48) = t0;
+goto L40adc8;
+L40ada0:
+MEM_U32(sp + 48) = t1;
+goto L40adc8;
+L40ada8:
+a0 = 0x10005800;
+a1 = 0x10005808;
+//nop;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40adc8:
+t3 = MEM_U32(sp + 52);
+//nop;
+a1 = MEM_U32(sp + 48);
+a2 = MEM_U32(sp + 44);
+a0 = MEM_U32(t3 + 24);
+//nop;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40adf0:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_40adfc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40adfc:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 4000806f MEM_U32(sp + 28) = ra;
+// fdead 4000806f MEM_U32(sp + 24) = gp;
+if (t6 == at) goto L40ae48;
+a0 = 0x10005814;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40aea8;
+L40ae48:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t7 = 0x10009720;
+//nop;
+t7 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (t7 != at) goto L40ae90;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40ae90:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40aea8:
+t8 = 0x10009720;
+at = 0x23;
+t8 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t8 == at) goto L40aed8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40aed8:
+a0 = 0x10005828;
+//nop;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40af00(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40af00:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ec8;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+a2 = a0;
+if (t6 == 0) goto L40af48;
+//nop;
+a0 = zero;
+// fdead 400080eb t9 = t9;
+MEM_U32(sp + 32) = a2;
+func_405574(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+//nop;
+L40af48:
+at = 0x10008ec0;
+v0 = 0x1000a7c0;
+MEM_U32(at + 0) = zero;
+t9 = MEM_U8(v0 + 5);
+t8 = a2 & 0x3f;
+t0 = t9 & 0xffc0;
+t1 = t8 | t0;
+at = 0x15;
+MEM_U32(v0 + 0) = zero;
+MEM_U8(v0 + 5) = (uint8_t)t1;
+if (a2 != at) goto L40afa4;
+t2 = 0x10009720;
+at = 0x23;
+t2 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t2 == at) goto L40afa0;
+t3 = 0x10009b28;
+//nop;
+t3 = MEM_U32(t3 + 0);
+MEM_U32(v0 + 8) = t3;
+goto L40afa4;
+L40afa0:
+MEM_U32(v0 + 8) = zero;
+L40afa4:
+at = 0x15;
+//nop;
+if (a2 != at) goto L40b038;
+t4 = 0x10009720;
+at = 0x23;
+t4 = MEM_U8(t4 + 0);
+//nop;
+//nop;
+if (t4 == at) goto L40b038;
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+a1 = 0x10009b28;
+//nop;
+a1 = MEM_U32(a1 + 0);
+//nop;
+//nop;
+if ((int)a1 <= 0) goto L40b01c;
+v0 = 0x10009728;
+v1 = 0x1000a7c0;
+a0 = a1 + v0;
+L40b004:
+t6 = MEM_U8(v0 + 0);
+v0 = v0 + 0x1;
+at = v0 < a0;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t6;
+if (at != 0) goto L40b004;
+L40b01c:
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+//nop;
+L40b038:
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_put_binasmfyle(mem, sp);
+a2 = MEM_U32(sp + 32);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+at = 0xa;
+if (a2 == at) {
+at = 0x15;
+goto L40b090;}
+at = 0x15;
+t7 = 0x1;
+if (a2 == at) goto L40b084;
+at = 0x19;
+t8 = 0xd;
+if (a2 == at) goto L40b0a0;
+v0 = 0x1a;
+t0 = 0xf;
+if (a2 == v0) goto L40b0ac;
+//nop;
+goto L40b0b8;
+L40b084:
+at = 0x10008eb0;
+MEM_U32(at + 0) = t7;
+goto L40b0e4;
+L40b090:
+at = 0x10008eb0;
+t9 = 0x2;
+MEM_U32(at + 0) = t9;
+goto L40b0e4;
+L40b0a0:
+at = 0x10008eb0;
+MEM_U32(at + 0) = t8;
+goto L40b0e4;
+L40b0ac:
+at = 0x10008eb0;
+MEM_U32(at + 0) = t0;
+goto L40b0e4;
+L40b0b8:
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (a2 == v0) goto L40b0e8;
+a0 = 0x10005848;
+a1 = 0x10005858;
+//nop;
+a2 = 0xa43;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40b0e4:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40b0e8:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40b0f4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40b0f4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 28) = s2;
+t6 = MEM_U32(t6 + 0);
+s2 = a0;
+// fdead 4008806b MEM_U32(sp + 60) = ra;
+// fdead 4008806b MEM_U32(sp + 56) = fp;
+// fdead 4008806b MEM_U32(sp + 52) = gp;
+// fdead 4008806b MEM_U32(sp + 48) = s7;
+// fdead 4008806b MEM_U32(sp + 44) = s6;
+// fdead 4008806b MEM_U32(sp + 40) = s5;
+// fdead 4008806b MEM_U32(sp + 36) = s4;
+// fdead 4008806b MEM_U32(sp + 32) = s3;
+// fdead 4008806b MEM_U32(sp + 24) = s1;
+// fdead 4008806b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L40b198;
+s4 = 0x2;
+s3 = 0x4;
+if (a0 == s4) goto L40b154;
+at = 0x1;
+if (a0 != s3) goto L40b174;
+L40b154:
+//nop;
+a0 = 0x3;
+// fdead 4038806f t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40080103 gp = MEM_U32(sp + 52);
+//nop;
+goto L40b198;
+L40b174:
+//nop;
+if (s2 != at) goto L40b198;
+//nop;
+a0 = s4;
+// fdead 4038806f t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40080103 gp = MEM_U32(sp + 52);
+//nop;
+L40b198:
+s5 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+s3 = 0x4;
+s4 = 0x2;
+fp = 0x2c;
+s7 = 0x2b;
+s6 = 0x2d;
+L40b1b8:
+t7 = MEM_U32(s5 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40b24c;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (s2 == s3) goto L40b1e4;
+//nop;
+if (s2 != s4) goto L40b1f8;
+L40b1e4:
+t8 = MEM_U32(s1 + 0);
+//nop;
+t9 = t8 + 0x8;
+MEM_U32(s1 + 0) = t9;
+goto L40b208;
+L40b1f8:
+t0 = MEM_U32(s1 + 0);
+//nop;
+t1 = t0 + 0x4;
+MEM_U32(s1 + 0) = t1;
+L40b208:
+//nop;
+if (s6 == v0) goto L40b218;
+//nop;
+if (s7 != v0) goto L40b230;
+L40b218:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+L40b230:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+goto L40b2c4;
+L40b24c:
+MEM_U32(s0 + 0) = zero;
+if (s2 != s3) goto L40b26c;
+t2 = MEM_U8(s0 + 5);
+//nop;
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x2c;
+MEM_U8(s0 + 5) = (uint8_t)t4;
+goto L40b2a8;
+L40b26c:
+at = 0x1;
+if (s2 != s4) goto L40b28c;
+t5 = MEM_U8(s0 + 5);
+//nop;
+t6 = t5 & 0xffc0;
+t7 = t6 | 0xb;
+MEM_U8(s0 + 5) = (uint8_t)t7;
+goto L40b2a8;
+L40b28c:
+//nop;
+if (s2 != at) goto L40b2a8;
+t8 = MEM_U8(s0 + 5);
+//nop;
+t9 = t8 & 0xffc0;
+t0 = t9 | 0xd;
+MEM_U8(s0 + 5) = (uint8_t)t0;
+L40b2a8:
+//nop;
+//nop;
+// bdead c1fe0103 t9 = t9;
+//nop;
+func_407334(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+L40b2c4:
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+at = 0x23;
+if (fp != v0) goto L40b308;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+at = 0x23;
+L40b308:
+//nop;
+if (v0 != at) goto L40b1b8;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40b340(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40b340:
+//nop;
+//nop;
+//nop;
+at = 0x10008ee0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006f MEM_U32(sp + 28) = ra;
+// fdead 4000006f MEM_U32(sp + 24) = gp;
+MEM_U32(at + 0) = zero;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x22;
+t6 = 0x10009720;
+a1 = zero;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 == at) goto L40b3a4;
+a0 = 0x10005864;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40b3a4:
+//nop;
+a0 = 0x10009728;
+//nop;
+f_make_file(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_do_dot_end(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L40b3dc:
+//do_dot_end:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+if (a0 != 0) goto L40b444;
+s2 = 0x10000014;
+a1 = zero;
+s2 = s2;
+t6 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L40b444;
+a0 = 0x1000587c;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40b53c;
+L40b444:
+s2 = 0x10000014;
+//nop;
+s2 = s2;
+a1 = MEM_U32(s2 + 0);
+//nop;
+if (a0 == 0) goto L40b484;
+a2 = 0x2;
+if (a1 == 0) goto L40b484;
+a0 = 0x10005890;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40080003 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s2 + 0);
+//nop;
+L40b484:
+// bdead 40080043 ra = MEM_U32(sp + 44);
+if (a1 == 0) goto L40b53c;
+s3 = 0x100058b0;
+s1 = 0x1000a7c0;
+s3 = s3;
+L40b498:
+//nop;
+a0 = MEM_U32(a1 + 0);
+//nop;
+v0 = f_sym_undefined(mem, sp, a0);
+// bdead 401c010b gp = MEM_U32(sp + 40);
+a0 = s3;
+if (v0 == 0) goto L40b4d0;
+//nop;
+a1 = zero;
+a2 = 0x2;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+goto L40b4f0;
+L40b4d0:
+t7 = MEM_U32(s2 + 0);
+//nop;
+a0 = MEM_U32(t7 + 0);
+//nop;
+v0 = f_st_procend(mem, sp, a0);
+// bdead 401c000b gp = MEM_U32(sp + 40);
+MEM_U32(s1 + 0) = v0;
+a0 = MEM_U32(s2 + 0);
+L40b4f0:
+//nop;
+s0 = MEM_U32(a0 + 4);
+//nop;
+wrapper_free(mem, a0);
+t8 = MEM_U8(s1 + 5);
+// bdead 421e0003 gp = MEM_U32(sp + 40);
+t9 = t8 & 0xffc0;
+t0 = t9 | 0x18;
+MEM_U32(s2 + 0) = s0;
+MEM_U8(s1 + 5) = (uint8_t)t0;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+a1 = MEM_U32(s2 + 0);
+// bdead 401c0043 gp = MEM_U32(sp + 40);
+//nop;
+if (a1 != 0) goto L40b498;
+// bdead 1 ra = MEM_U32(sp + 44);
+L40b53c:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40b554(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40b554:
+//nop;
+//nop;
+//nop;
+a1 = 0x10000014;
+sp = sp + 0xffffffd8;
+a1 = a1;
+t6 = MEM_U32(a1 + 0);
+//nop;
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+a0 = 0x8;
+MEM_U32(sp + 36) = t6;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+v1 = v0;
+a1 = 0x10000014;
+//nop;
+a1 = a1;
+MEM_U32(a1 + 0) = v0;
+if (v0 != 0) goto L40b5c4;
+//nop;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40b5e4;
+L40b5c4:
+t7 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(v1 + 0) = t7;
+t9 = MEM_U32(a1 + 0);
+t8 = MEM_U32(sp + 36);
+//nop;
+MEM_U32(t9 + 4) = t8;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40b5e4:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40b5f0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40b5f0:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ec8;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+if (t6 == 0) goto L40b634;
+//nop;
+a0 = zero;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40b634:
+at = 0x10008ec0;
+v1 = 0x10009720;
+MEM_U32(at + 0) = zero;
+v1 = MEM_U8(v1 + 0);
+at = 0x69;
+t8 = MEM_U32(sp + 40);
+if (v1 == at) goto L40b684;
+t7 = MEM_U32(sp + 40);
+at = 0x18;
+a1 = zero;
+if (t7 == at) goto L40b680;
+a0 = 0x100058e4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40b978;
+L40b680:
+t8 = MEM_U32(sp + 40);
+L40b684:
+at = 0x1b;
+if (t8 == at) {
+at = 0x2e;
+goto L40b698;}
+at = 0x2e;
+t6 = MEM_U32(sp + 40);
+if (t8 != at) goto L40b91c;
+L40b698:
+t9 = 0x10008eb4;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L40b708;
+//nop;
+a0 = 0x3;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100058f8;
+//nop;
+a2 = 0x10009728;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb528e4;
+//nop;
+a0 = a0 + 0x20;
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40b708:
+at = 0x1000a7c0;
+t0 = MEM_U32(sp + 40);
+MEM_U32(at + 8) = zero;
+at = 0x1b;
+//nop;
+if (t0 != at) goto L40b770;
+t1 = 0x10000014;
+a2 = 0x2;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L40b7a8;
+a0 = 0x100058fc;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+//nop;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+goto L40b7a8;
+L40b770:
+t2 = 0x10000014;
+a2 = 0x2;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L40b7a8;
+a0 = 0x10005920;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+t3 = 0x1b;
+// bdead 40001003 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = t3;
+L40b7a8:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+if (v0 != 0) goto L40b7dc;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40b7dc:
+t4 = MEM_U32(sp + 36);
+at = 0x3;
+t5 = MEM_U32(t4 + 16);
+a2 = 0x1;
+//nop;
+if (t5 == at) goto L40b810;
+a0 = 0x10005948;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40b810:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 != at) {
+at = 0x64;
+goto L40b86c;}
+at = 0x64;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x64;
+L40b86c:
+t6 = MEM_U32(sp + 36);
+if (v1 != at) goto L40b890;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+t6 = MEM_U32(sp + 36);
+L40b890:
+//nop;
+a0 = MEM_U32(t6 + 24);
+a1 = 0x23;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t7 = MEM_U32(sp + 36);
+//nop;
+a0 = MEM_U32(t7 + 24);
+// fdead 6001003f t9 = t9;
+//nop;
+func_40b554(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 36);
+at = 0x1000a7c0;
+t9 = MEM_U32(t8 + 24);
+t3 = 0x1000a7c0;
+MEM_U32(at + 0) = t9;
+t1 = MEM_U32(sp + 40);
+t3 = MEM_U8(t3 + 5);
+at = 0x1000a7c0;
+//nop;
+t2 = t1 & 0x3f;
+t4 = t3 & 0xffc0;
+t5 = t2 | t4;
+MEM_U8(at + 5) = (uint8_t)t5;
+f_put_binasmfyle(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+at = 0x69;
+goto L40b954;
+// fdead 0 t6 = MEM_U32(sp + 40);
+L40b91c:
+at = 0x18;
+if (t6 != at) {
+at = 0x69;
+goto L40b954;}
+at = 0x69;
+//nop;
+a0 = zero;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x69;
+L40b954:
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (v1 != at) goto L40b978;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40b978:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40b984(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L40b984:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+v0 = 0x10009720;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+s0 = 0x10009728;
+s1 = MEM_U32(sp + 56);
+s3 = 0x1000a7c0;
+v0 = MEM_U8(v0 + 0);
+// fdead 4016006b MEM_U32(sp + 44) = ra;
+// fdead 4016006b MEM_U32(sp + 40) = gp;
+s2 = sp + 0x3c;
+s4 = 0x69;
+L40b9cc:
+a1 = zero;
+if (s4 == v0) goto L40b9f4;
+a0 = 0x10005964;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40bae8;
+L40b9f4:
+//nop;
+a0 = s0;
+a1 = s2;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 403e000b gp = MEM_U32(sp + 40);
+a0 = s0;
+if (v0 != 0) goto L40ba28;
+//nop;
+a1 = s2;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+//nop;
+L40ba28:
+t6 = MEM_U32(sp + 60);
+//nop;
+a0 = MEM_U32(t6 + 24);
+a1 = 0x22;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+t7 = MEM_U32(sp + 60);
+// bdead 403f0103 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(t7 + 16);
+at = 0x3;
+a1 = s0;
+if (t8 != at) goto L40bacc;
+t9 = 0x1000a7e8;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+t0 = MEM_U32(sp + 60);
+if (t9 == 0) goto L40ba90;
+//nop;
+a0 = MEM_U32(t7 + 24);
+// bdead 403a0023 t9 = t9;
+a1 = s0;
+func_4054e8(mem, sp, a0, a1);
+// bdead 403a0003 gp = MEM_U32(sp + 40);
+//nop;
+t0 = MEM_U32(sp + 60);
+L40ba90:
+t2 = MEM_U8(s3 + 5);
+t1 = MEM_U32(t0 + 24);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x2;
+MEM_U8(s3 + 5) = (uint8_t)t4;
+MEM_U32(s3 + 0) = t1;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t5 = MEM_U32(sp + 60);
+// bdead 403a4103 gp = MEM_U32(sp + 40);
+s1 = MEM_U32(t5 + 24);
+//nop;
+goto L40bae8;
+L40bacc:
+a0 = 0x10005978;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+L40bae8:
+v0 = 0x10009720;
+at = 0x23;
+v0 = MEM_U8(v0 + 0);
+//nop;
+//nop;
+if (v0 == at) goto L40bb28;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+L40bb28:
+at = 0x2c;
+if (s4 != v0) goto L40bc58;
+//nop;
+a0 = s0;
+a1 = s2;
+v0 = f_opLookUp(mem, sp, a0, a1);
+// bdead 403e010b gp = MEM_U32(sp + 40);
+a1 = zero;
+if (v0 != 0) goto L40bb6c;
+a0 = 0x10005994;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40bc2c;
+L40bb6c:
+t6 = MEM_U32(sp + 60);
+at = 0x2;
+t8 = MEM_U32(t6 + 16);
+//nop;
+//nop;
+if (t8 != at) goto L40bc2c;
+v0 = MEM_U32(t6 + 20);
+at = 0xa;
+a0 = s1;
+if (v0 == at) goto L40bbdc;
+at = 0x15;
+a0 = s1;
+if (v0 == at) goto L40bbc0;
+at = 0x19;
+a0 = s1;
+if (v0 == at) goto L40bbf8;
+at = 0x1a;
+a0 = s1;
+if (v0 == at) goto L40bc14;
+//nop;
+goto L40bc2c;
+L40bbc0:
+//nop;
+a1 = 0x23;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40bc2c;
+L40bbdc:
+//nop;
+a1 = 0x2;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40bc2c;
+L40bbf8:
+//nop;
+a1 = 0xd;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+goto L40bc2c;
+L40bc14:
+//nop;
+a1 = 0xf;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+L40bc2c:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+//nop;
+v0 = 0x10009720;
+//nop;
+v0 = MEM_U8(v0 + 0);
+//nop;
+at = 0x2c;
+L40bc58:
+//nop;
+if (v0 == at) goto L40b9cc;
+// bdead 40040001 ra = MEM_U32(sp + 44);
+MEM_U32(sp + 56) = s1;
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40bc84(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L40bc84:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+v0 = 0x10009720;
+// fdead 4000006b MEM_U32(sp + 48) = s7;
+s7 = 0x100059bc;
+// fdead 4100006b MEM_U32(sp + 28) = s2;
+// fdead 4100006b MEM_U32(sp + 24) = s1;
+// fdead 4100006b MEM_U32(sp + 20) = s0;
+// fdead 4100006b MEM_U32(sp + 56) = fp;
+// fdead 4100006b MEM_U32(sp + 44) = s6;
+// fdead 4100006b MEM_U32(sp + 40) = s5;
+// fdead 4100006b MEM_U32(sp + 36) = s4;
+// fdead 4100006b MEM_U32(sp + 32) = s3;
+s0 = 0x10009728;
+s1 = 0x1000a7c0;
+s2 = 0x10009720;
+v0 = MEM_U8(v0 + 0);
+// fdead 410e006b MEM_U32(sp + 60) = ra;
+// fdead 410e006b MEM_U32(sp + 52) = gp;
+s3 = 0x2c;
+s4 = sp + 0x4c;
+s5 = sp + 0x48;
+s6 = 0x69;
+fp = 0x23;
+s7 = s7;
+L40bcf0:
+a0 = s7;
+if (s6 == v0) goto L40bd14;
+//nop;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s2 + 0);
+goto L40be5c;
+L40bd14:
+//nop;
+a0 = s0;
+a1 = s4;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+a0 = s0;
+if (v0 != 0) goto L40bd48;
+//nop;
+a1 = s4;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+//nop;
+L40bd48:
+t6 = MEM_U32(sp + 76);
+//nop;
+a0 = MEM_U32(t6 + 24);
+a1 = 0x22;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+t7 = MEM_U32(sp + 76);
+// bdead c1ff0103 gp = MEM_U32(sp + 52);
+t8 = MEM_U32(t7 + 16);
+at = 0x3;
+a1 = s0;
+if (t8 != at) goto L40be3c;
+t0 = MEM_U8(s1 + 5);
+t9 = MEM_U32(t7 + 24);
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x12;
+MEM_U8(s1 + 5) = (uint8_t)t2;
+MEM_U32(s1 + 0) = t9;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U8(s2 + 0);
+// bdead c1fe1103 gp = MEM_U32(sp + 52);
+//nop;
+if (s3 != t3) goto L40bdc8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+//nop;
+L40bdc8:
+//nop;
+a0 = s0;
+a1 = s5;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+a0 = s0;
+if (v0 != 0) goto L40bdfc;
+//nop;
+a1 = s5;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+//nop;
+L40bdfc:
+t4 = MEM_U32(sp + 72);
+t5 = MEM_U32(sp + 76);
+//nop;
+//nop;
+if (t4 == t5) goto L40be1c;
+t6 = MEM_U32(t4 + 24);
+MEM_U32(s1 + 8) = t6;
+goto L40be20;
+L40be1c:
+MEM_U32(s1 + 8) = zero;
+L40be20:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s2 + 0);
+goto L40be5c;
+L40be3c:
+a0 = 0x100059d0;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+v0 = MEM_U8(s2 + 0);
+L40be5c:
+//nop;
+//nop;
+if (fp == v0) goto L40be84;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s2 + 0);
+//nop;
+L40be84:
+//nop;
+if (s3 == v0) goto L40bcf0;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static uint32_t func_40bebc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40bebc:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 400080ef MEM_U32(sp + 28) = ra;
+// fdead 400080ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+if (t6 != at) goto L40c018;
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+if (v0 != 0) goto L40bf24;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40bf24:
+t7 = MEM_U32(sp + 36);
+at = 0x4;
+v0 = MEM_U32(t7 + 16);
+a0 = MEM_U32(sp + 44);
+if (v0 != at) {
+at = 0x3;
+goto L40bf5c;}
+at = 0x3;
+//nop;
+a1 = MEM_U32(sp + 48);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L40c038;
+at = 0x3;
+L40bf5c:
+a2 = 0x1;
+if (v0 != at) goto L40bfe0;
+t8 = MEM_U32(sp + 36);
+t0 = MEM_U32(sp + 40);
+t9 = MEM_U32(t8 + 24);
+//nop;
+MEM_U32(t0 + 0) = t9;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 44);
+//nop;
+a1 = MEM_U32(sp + 48);
+// fdead 6000007f t9 = t9;
+//nop;
+func_405a80(mem, sp, a0, a1);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t1 = 0x10009720;
+//nop;
+t1 = MEM_U8(t1 + 0);
+//nop;
+v0 = 0x1;
+if (t1 != at) goto L40c038;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L40c038;
+L40bfe0:
+a0 = 0x100059ec;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40c038;
+L40c018:
+//nop;
+a0 = MEM_U32(sp + 44);
+a1 = MEM_U32(sp + 48);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+v0 = 0x1;
+L40c038:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_40c048(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L40c048:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 56) = fp;
+// fdead 4000806b MEM_U32(sp + 52) = gp;
+// fdead 4000806b MEM_U32(sp + 48) = s7;
+// fdead 4000806b MEM_U32(sp + 44) = s6;
+// fdead 4000806b MEM_U32(sp + 40) = s5;
+// fdead 4000806b MEM_U32(sp + 36) = s4;
+// fdead 4000806b MEM_U32(sp + 32) = s3;
+// fdead 4000806b MEM_U32(sp + 28) = s2;
+// fdead 4000806b MEM_U32(sp + 24) = s1;
+// fdead 4000806b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L40c0ac;
+//nop;
+a0 = 0x1;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 52);
+//nop;
+L40c0ac:
+s7 = 0x10009720;
+s5 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+fp = 0x1;
+s6 = 0x23;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+L40c0d0:
+//nop;
+MEM_U32(sp + 76) = zero;
+// bdead c1fe0103 t9 = t9;
+MEM_U32(sp + 80) = fp;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40bebc(mem, sp, a0, a1, a2);
+// bdead c1fe010b gp = MEM_U32(sp + 52);
+// bdead c1fe0103 ra = MEM_U32(sp + 60);
+if (v0 == 0) goto L40c1ec;
+t7 = MEM_U32(s5 + 0);
+v0 = MEM_U32(sp + 80);
+t8 = v0 << 1;
+if (t7 == 0) goto L40c13c;
+v0 = t8;
+if ((int)t8 >= (int)0x2) goto L40c124;
+v1 = 0x2;
+goto L40c128;
+L40c124:
+v1 = v0;
+L40c128:
+t9 = MEM_U32(s1 + 0);
+//nop;
+t0 = v1 + t9;
+MEM_U32(s1 + 0) = t0;
+goto L40c1cc;
+L40c13c:
+t2 = 0x1000a7e0;
+t1 = MEM_U32(sp + 76);
+t2 = MEM_U32(t2 + 0);
+a1 = zero;
+v0 = t1;
+if (fp != t2) goto L40c158;
+v0 = (int)t1 >> 1;
+L40c158:
+if ((int)v0 < (int)0xffff8000) {
+at = 0x10000;
+goto L40c170;}
+at = 0x10000;
+//nop;
+if ((int)v0 < (int)at) goto L40c18c;
+L40c170:
+a0 = 0x10005a04;
+//nop;
+a2 = fp;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+MEM_U32(sp + 76) = zero;
+L40c18c:
+t4 = MEM_U8(s0 + 5);
+t3 = MEM_U32(sp + 84);
+t7 = MEM_U32(sp + 76);
+t8 = MEM_U32(sp + 80);
+t5 = t4 & 0xffc0;
+t6 = t5 | 0xe;
+MEM_U8(s0 + 5) = (uint8_t)t6;
+MEM_U32(s0 + 0) = t3;
+MEM_U32(s0 + 8) = t7;
+MEM_U32(s0 + 12) = t8;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+//nop;
+L40c1cc:
+t9 = MEM_U8(s7 + 0);
+//nop;
+//nop;
+if (s6 != t9) goto L40c0d0;
+at = 0x1000a7e0;
+//nop;
+MEM_U32(at + 0) = zero;
+// bdead 1 ra = MEM_U32(sp + 60);
+L40c1ec:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40c218(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c218:
+//nop;
+//nop;
+//nop;
+at = 0x10008ee0;
+v0 = 0x1000a7c0;
+MEM_U32(at + 0) = zero;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x1c;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4201806f MEM_U32(sp + 28) = ra;
+// fdead 4201806f MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+t9 = 0x10009310;
+at = 0x1000a7c0;
+t0 = 0x10009720;
+t9 = MEM_U32(t9 + 0);
+t0 = MEM_U8(t0 + 0);
+MEM_U32(at + 8) = t9;
+at = 0x3a;
+//nop;
+if (t0 != at) goto L40c29c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L40c29c:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009314;
+at = 0x1000a7c0;
+MEM_U32(v1 + 0) = v0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c2e0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40c2e0:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x13;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201806b MEM_U32(sp + 28) = ra;
+// fdead 4201806b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 8) = v0;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c360(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40c360:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x32;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201806b MEM_U32(sp + 28) = ra;
+// fdead 4201806b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 8) = v0;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c3e0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40c3e0:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x33;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201806b MEM_U32(sp + 28) = ra;
+// fdead 4201806b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 8) = v0;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c460(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40c460:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a7c0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x3c;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201807b MEM_U32(sp + 28) = ra;
+// fdead 4201807b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+//nop;
+MEM_U32(v1 + 8) = v0;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c4cc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0;
+L40c4cc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = 0x1000a7c0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(s0 + 5);
+MEM_U32(s0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x3d;
+MEM_U8(s0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4203806b MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 8) = v0;
+if (v0 == 0) goto L40c5c4;
+//nop;
+a0 = 0x10009728;
+MEM_U32(sp + 36) = zero;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4002010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+if (v0 != 0) goto L40c550;
+//nop;
+a0 = 0x10009728;
+a2 = zero;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+//nop;
+L40c550:
+t0 = MEM_U32(sp + 36);
+//nop;
+t1 = MEM_U32(t0 + 24);
+MEM_U32(sp + 36) = zero;
+MEM_U32(s0 + 0) = t1;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+//nop;
+a0 = 0x10009728;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+if (v0 != 0) goto L40c5b0;
+//nop;
+a0 = 0x10009728;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+//nop;
+L40c5b0:
+t2 = MEM_U32(sp + 36);
+//nop;
+t3 = MEM_U32(t2 + 24);
+//nop;
+MEM_U32(s0 + 12) = t3;
+L40c5c4:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40c5e8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40c5e8:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a7c0;
+t7 = a0 & 0x3f;
+t8 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v0 + 5) = (uint8_t)t0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601026b MEM_U32(sp + 28) = ra;
+// fdead 4601026b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 8) = v0;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x1000a7c0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40c66c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t3 = 0, t6 = 0,
+t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, t8 = 0,
+t9 = 0;
+L40c66c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+t6 = 0x10008ec0;
+// fdead 4000806b MEM_U32(sp + 52) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 48) = gp;
+// fdead 4000806b MEM_U32(sp + 44) = s5;
+// fdead 4000806b MEM_U32(sp + 40) = s4;
+// fdead 4000806b MEM_U32(sp + 36) = s3;
+// fdead 4000806b MEM_U32(sp + 32) = s2;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+// fdead 4000806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40c6cc;
+a0 = 0x10005a20;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L40c810;
+L40c6cc:
+//nop;
+if (a0 == 0) goto L40c724;
+v0 = 0x10008ecc;
+a2 = 0x1;
+t7 = MEM_U32(v0 + 0);
+t8 = 0x1;
+//nop;
+if (t7 == 0) goto L40c70c;
+a0 = 0x10005a40;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L40c810;
+L40c70c:
+at = 0x10008ed0;
+s2 = 0x10008ed4;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(at + 0) = a1;
+MEM_U32(s2 + 0) = zero;
+goto L40c80c;
+L40c724:
+v0 = 0x10008ecc;
+//nop;
+t9 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L40c760;
+a0 = 0x10005a58;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L40c810;
+L40c760:
+s5 = 0x10008ed0;
+MEM_U32(v0 + 0) = zero;
+s5 = MEM_U32(s5 + 0);
+//nop;
+// bdead 40400003 ra = MEM_U32(sp + 52);
+if (s5 == 0) goto L40c810;
+v0 = 0x10008ed4;
+s4 = 0x10008ed8;
+s3 = 0x1000a7c0;
+s2 = 0x10008ed4;
+v0 = MEM_U32(v0 + 0);
+//nop;
+L40c790:
+s0 = zero;
+if (v0 == 0) goto L40c800;
+s1 = zero;
+L40c79c:
+t0 = MEM_U32(s4 + 0);
+//nop;
+t1 = t0 + s1;
+at = MEM_U32(t1 + 0);
+//nop;
+MEM_U32(s3 + 0) = at;
+t3 = MEM_U32(t1 + 4);
+//nop;
+MEM_U32(s3 + 4) = t3;
+at = MEM_U32(t1 + 8);
+//nop;
+MEM_U32(s3 + 8) = at;
+t3 = MEM_U32(t1 + 12);
+//nop;
+MEM_U32(s3 + 12) = t3;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+v0 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+// bdead 407e000b gp = MEM_U32(sp + 48);
+s1 = s1 + 0x10;
+if (s0 < v0) goto L40c79c;
+L40c800:
+s5 = s5 + 0xffffffff;
+//nop;
+if (s5 != 0) goto L40c790;
+L40c80c:
+// bdead 1 ra = MEM_U32(sp + 52);
+L40c810:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static void func_40c830(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40c830:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ec8;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+a1 = a0;
+if (t6 == 0) goto L40c878;
+//nop;
+a0 = zero;
+// fdead 4000806b t9 = t9;
+MEM_U32(sp + 32) = a1;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+L40c878:
+at = 0x10008ec0;
+v1 = 0x1000a7c0;
+MEM_U32(at + 0) = zero;
+t9 = MEM_U8(v1 + 5);
+t8 = a1 & 0x3f;
+t0 = t9 & 0xffc0;
+t1 = t8 | t0;
+at = 0x24;
+MEM_U8(v1 + 5) = (uint8_t)t1;
+if (a1 != at) goto L40c8f4;
+t2 = 0x10009720;
+at = 0x69;
+t2 = MEM_U8(t2 + 0);
+a1 = zero;
+//nop;
+if (t2 != at) goto L40c8d4;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40c91c;
+L40c8d4:
+a0 = 0x10005a78;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40c91c;
+L40c8f4:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+//nop;
+MEM_U32(v1 + 0) = v0;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40c91c:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40c928(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t1 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40c928:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = 0x1000a7c0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(s0 + 5);
+// fdead 4002806b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x25;
+MEM_U8(s0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40020109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 == 0) goto L40c9c0;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40020109 gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 12) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 36);
+MEM_U32(s0 + 0) = v0;
+t4 = MEM_U8(s0 + 8);
+t1 = MEM_U32(t9 + 20);
+t5 = t4 & 0xff01;
+t3 = t1 << 1;
+t6 = t3 | t5;
+// bdead 28001 gp = MEM_U32(sp + 24);
+MEM_U8(s0 + 8) = (uint8_t)t6;
+L40c9c0:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40c9d0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40c9d0:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 4000806f MEM_U32(sp + 28) = ra;
+// fdead 4000806f MEM_U32(sp + 24) = gp;
+if (t6 == at) goto L40ca1c;
+a0 = 0x10005a8c;
+//nop;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40cc38;
+L40ca1c:
+v1 = 0x1000a7c0;
+a0 = 0x10009b28;
+t7 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x2f;
+MEM_U8(v1 + 5) = (uint8_t)t9;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a0 = a0 + 0x2;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+t0 = 0x2d;
+MEM_U8(v0 + 0) = (uint8_t)t0;
+//nop;
+a1 = 0x10009728;
+a0 = v0 + 0x1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+v0 = f_which_opt(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+//nop;
+MEM_U32(sp + 36) = v0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+v1 = 0x1000a7c0;
+t2 = a1 + 0xfffffffa;
+if ((int)a1 < (int)0xc) goto L40caf8;
+t1 = a1 + 0xffffffa9;
+//nop;
+if (t1 >= 0x6) goto L40cbfc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40cbac;
+case 1: goto L40cbc4;
+case 2: goto L40cbe0;
+case 3: goto L40cc1c;
+case 4: goto L40cc1c;
+case 5: goto L40cc1c;
+}
+L40caf8:
+//nop;
+if (t2 >= 0x6) goto L40cbfc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L40cb58;
+case 1: goto L40cb24;
+case 2: goto L40cb3c;
+case 3: goto L40cb58;
+case 4: goto L40cb74;
+case 5: goto L40cb90;
+}
+L40cb24:
+t3 = MEM_U8(v1 + 6);
+MEM_U32(v1 + 12) = zero;
+t4 = t3 & 0xff3f;
+t5 = t4 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t5;
+goto L40cc1c;
+L40cb3c:
+t6 = MEM_U8(v1 + 6);
+t9 = 0x1;
+t7 = t6 & 0xff3f;
+t8 = t7 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t8;
+MEM_U32(v1 + 12) = t9;
+goto L40cc1c;
+L40cb58:
+t0 = MEM_U8(v1 + 6);
+t3 = 0x2;
+t1 = t0 & 0xff3f;
+t2 = t1 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t2;
+MEM_U32(v1 + 12) = t3;
+goto L40cc1c;
+L40cb74:
+t4 = MEM_U8(v1 + 6);
+t7 = 0x3;
+t5 = t4 & 0xff3f;
+t6 = t5 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t6;
+MEM_U32(v1 + 12) = t7;
+goto L40cc1c;
+L40cb90:
+t8 = MEM_U8(v1 + 6);
+t1 = 0x4;
+t9 = t8 & 0xff3f;
+t0 = t9 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t0;
+MEM_U32(v1 + 12) = t1;
+goto L40cc1c;
+L40cbac:
+t2 = MEM_U8(v1 + 6);
+MEM_U32(v1 + 12) = zero;
+t3 = t2 & 0xff3f;
+t4 = t3 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t4;
+goto L40cc1c;
+L40cbc4:
+t5 = MEM_U8(v1 + 6);
+t8 = 0x1;
+t6 = t5 & 0xff3f;
+t7 = t6 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t7;
+MEM_U32(v1 + 12) = t8;
+goto L40cc1c;
+L40cbe0:
+t9 = MEM_U8(v1 + 6);
+t2 = 0x2;
+t0 = t9 & 0xff3f;
+t1 = t0 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t1;
+MEM_U32(v1 + 12) = t2;
+goto L40cc1c;
+L40cbfc:
+a0 = 0x10005aa4;
+//nop;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40cc1c:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40cc38:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t func_40cc44(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+L40cc44:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s1 = 0x1000029c;
+s2 = a0;
+// fdead 400c006b MEM_U32(sp + 44) = ra;
+// fdead 400c006b MEM_U32(sp + 40) = gp;
+s0 = zero;
+s3 = 0x11;
+L40cc7c:
+//nop;
+a1 = MEM_U32(s1 + 0);
+a0 = s2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 401e000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L40cca0;
+v0 = s0;
+goto L40ccb0;
+L40cca0:
+s0 = s0 + 0x1;
+s1 = s1 + 0x4;
+if (s0 != s3) goto L40cc7c;
+v0 = zero;
+L40ccb0:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void func_40cccc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40cccc:
+//nop;
+//nop;
+//nop;
+a1 = 0x1000a7c0;
+t9 = 0x10009720;
+t6 = MEM_U8(a1 + 5);
+MEM_U32(a1 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x20;
+MEM_U8(a1 + 5) = (uint8_t)t8;
+t9 = MEM_U8(t9 + 0);
+sp = sp + 0xffffffe0;
+at = 0x69;
+// fdead 4601806f MEM_U32(sp + 28) = ra;
+// fdead 4601806f MEM_U32(sp + 24) = gp;
+if (t9 == at) goto L40cd30;
+a0 = 0x10005abc;
+//nop;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L40cdc4;
+L40cd30:
+//nop;
+a0 = 0x10009728;
+// bdead 40000023 t9 = t9;
+//nop;
+v0 = func_40cc44(mem, sp, a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a2 = 0x2;
+a1 = 0x1000a7c0;
+MEM_U32(a1 + 8) = v0;
+if (v0 == 0) goto L40cd90;
+at = 0x5;
+t0 = 0x1;
+if (v0 == at) goto L40cd78;
+at = 0x6;
+//nop;
+if (v0 == at) goto L40cd84;
+//nop;
+goto L40cdac;
+L40cd78:
+at = 0x10008ebc;
+MEM_U32(at + 0) = t0;
+goto L40cdac;
+L40cd84:
+at = 0x10008ebc;
+MEM_U32(at + 0) = zero;
+goto L40cdac;
+L40cd90:
+a0 = 0x10005ad4;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L40cdac:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40cdc4:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_40cde4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40cde4:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a7c0;
+t7 = a0 & 0x3f;
+t8 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v1 + 5) = (uint8_t)t0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601027b MEM_U32(sp + 28) = ra;
+// fdead 4601027b MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+// bdead 40000119 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L40cea8;
+t2 = MEM_U32(v0 + 20);
+t5 = MEM_U8(v1 + 6);
+t4 = t2 << 1;
+t6 = t5 & 0xff01;
+t8 = t4 | t6;
+MEM_U8(v1 + 6) = (uint8_t)t8;
+//nop;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a7c0;
+// bdead 40000019 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L40cea8;
+t9 = MEM_U32(v0 + 20);
+t2 = MEM_U16(v1 + 6);
+t0 = t9 << 2;
+t1 = t0 & 0x1fc;
+t3 = t2 & 0xfe03;
+t5 = t1 | t3;
+MEM_U16(v1 + 6) = (uint16_t)t5;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40cea8:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40ceb4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40ceb4:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ec8;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+if (t6 == 0) goto L40cef4;
+//nop;
+a0 = zero;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40cef4:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = v0;
+t7 = 0x10008ec0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40cf50;
+v1 = v0;
+if ((int)v0 >= 0) goto L40cf34;
+v1 = zero;
+goto L40cf34;
+L40cf34:
+v0 = 0x10008ec4;
+//nop;
+t8 = MEM_U32(v0 + 0);
+//nop;
+t9 = v1 + t8;
+MEM_U32(v0 + 0) = t9;
+goto L40cf8c;
+L40cf50:
+v0 = 0x1000a7c0;
+//nop;
+t0 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x14;
+MEM_U8(v0 + 5) = (uint8_t)t2;
+MEM_U32(v0 + 8) = v1;
+MEM_U32(v0 + 12) = zero;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40cf8c:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40cf9c(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40cf9c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 56) = gp;
+// fdead 4000806b MEM_U32(sp + 52) = s7;
+// fdead 4000806b MEM_U32(sp + 48) = s6;
+// fdead 4000806b MEM_U32(sp + 44) = s5;
+// fdead 4000806b MEM_U32(sp + 40) = s4;
+// fdead 4000806b MEM_U32(sp + 36) = s3;
+// fdead 4000806b MEM_U32(sp + 32) = s2;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+// fdead 4000806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40cffc;
+//nop;
+a0 = 0x2;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+//nop;
+L40cffc:
+s7 = 0x10009720;
+s5 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+s6 = 0x23;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+L40d01c:
+//nop;
+t7 = 0x1;
+// bdead 41ff0103 t9 = t9;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40bebc(mem, sp, a0, a1, a2);
+// bdead 41fe010b gp = MEM_U32(sp + 56);
+// bdead 41fe0103 ra = MEM_U32(sp + 60);
+if (v0 == 0) goto L40d0e8;
+t8 = MEM_U32(s5 + 0);
+t2 = MEM_U32(sp + 84);
+//nop;
+if (t8 == 0) goto L40d098;
+v0 = MEM_U32(sp + 80);
+//nop;
+t9 = v0 << 2;
+v0 = t9;
+if ((int)t9 >= (int)0x4) goto L40d080;
+v1 = 0x4;
+goto L40d084;
+L40d080:
+v1 = v0;
+L40d084:
+t0 = MEM_U32(s1 + 0);
+//nop;
+t1 = v1 + t0;
+MEM_U32(s1 + 0) = t1;
+goto L40d0d4;
+L40d098:
+t3 = MEM_U8(s0 + 5);
+t6 = MEM_U32(sp + 76);
+t7 = MEM_U32(sp + 80);
+t4 = t3 & 0xffc0;
+t5 = t4 | 0x16;
+MEM_U32(s0 + 0) = t2;
+MEM_U8(s0 + 5) = (uint8_t)t5;
+MEM_U32(s0 + 8) = t6;
+MEM_U32(s0 + 12) = t7;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+L40d0d4:
+t8 = MEM_U8(s7 + 0);
+//nop;
+//nop;
+if (s6 != t8) goto L40d01c;
+// bdead 1 ra = MEM_U32(sp + 60);
+L40d0e8:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40d110(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40d110:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10008ec8;
+// fdead 4000806b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 56) = gp;
+// fdead 4000806b MEM_U32(sp + 52) = s7;
+// fdead 4000806b MEM_U32(sp + 48) = s6;
+// fdead 4000806b MEM_U32(sp + 44) = s5;
+// fdead 4000806b MEM_U32(sp + 40) = s4;
+// fdead 4000806b MEM_U32(sp + 36) = s3;
+// fdead 4000806b MEM_U32(sp + 32) = s2;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+// fdead 4000806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40d170;
+//nop;
+a0 = 0x2;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405574(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+//nop;
+L40d170:
+s7 = 0x10009720;
+s5 = 0x10008ec0;
+s1 = 0x10008ec4;
+s0 = 0x1000a7c0;
+s6 = 0x23;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+L40d190:
+//nop;
+t7 = 0x1;
+// bdead 41ff0103 t9 = t9;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40bebc(mem, sp, a0, a1, a2);
+// bdead 41fe010b gp = MEM_U32(sp + 56);
+// bdead 41fe0103 ra = MEM_U32(sp + 60);
+if (v0 == 0) goto L40d25c;
+t8 = MEM_U32(s5 + 0);
+t2 = MEM_U32(sp + 84);
+//nop;
+if (t8 == 0) goto L40d20c;
+v0 = MEM_U32(sp + 80);
+//nop;
+t9 = v0 << 2;
+v0 = t9;
+if ((int)t9 >= (int)0x4) goto L40d1f4;
+v1 = 0x4;
+goto L40d1f8;
+L40d1f4:
+v1 = v0;
+L40d1f8:
+t0 = MEM_U32(s1 + 0);
+//nop;
+t1 = t0 + v1;
+MEM_U32(s1 + 0) = t1;
+goto L40d248;
+L40d20c:
+t3 = MEM_U8(s0 + 5);
+t6 = MEM_U32(sp + 76);
+t7 = MEM_U32(sp + 80);
+t4 = t3 & 0xffc0;
+t5 = t4 | 0x10;
+MEM_U32(s0 + 0) = t2;
+MEM_U8(s0 + 5) = (uint8_t)t5;
+MEM_U32(s0 + 8) = t6;
+MEM_U32(s0 + 12) = t7;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+//nop;
+L40d248:
+t8 = MEM_U8(s7 + 0);
+//nop;
+//nop;
+if (s6 != t8) goto L40d190;
+// bdead 1 ra = MEM_U32(sp + 60);
+L40d25c:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40d284(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L40d284:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4002010b gp = MEM_U32(sp + 24);
+a0 = s0;
+if (v0 != 0) goto L40d2d4;
+//nop;
+a1 = sp + 0x24;
+a2 = zero;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+//nop;
+L40d2d4:
+t6 = MEM_U32(sp + 36);
+at = 0x3;
+v0 = MEM_U32(t6 + 16);
+t7 = MEM_U32(sp + 36);
+if (v0 == at) {
+at = 0x4;
+goto L40d314;}
+at = 0x4;
+a1 = s0;
+if (v0 == at) goto L40d314;
+a0 = 0x10005aec;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d3e0;
+L40d314:
+a1 = 0x10008eb0;
+//nop;
+a0 = MEM_U32(t7 + 24);
+a1 = MEM_U32(a1 + 0);
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 36);
+v1 = 0x1000a7c0;
+t9 = MEM_U32(t8 + 24);
+t0 = MEM_U8(v1 + 5);
+t2 = 0x1000a7e8;
+t1 = t0 & 0xffc0;
+MEM_U8(v1 + 5) = (uint8_t)t1;
+MEM_U32(v1 + 0) = t9;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L40d3c4;
+t3 = MEM_U8(s0 + 0);
+t4 = 0xfb504f0;
+t8 = MEM_U32(sp + 36);
+t5 = t3 + t4;
+t6 = MEM_U8(t5 + 1);
+t9 = MEM_U32(sp + 36);
+t7 = t6 & 0x4;
+//nop;
+if (t7 == 0) goto L40d3a4;
+//nop;
+a0 = MEM_U32(t8 + 24);
+// bdead 40000023 t9 = t9;
+a1 = zero;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L40d3c4;
+L40d3a4:
+a0 = MEM_U32(t9 + 24);
+//nop;
+a1 = s0;
+// bdead 40000061 t9 = t9;
+//nop;
+func_4054e8(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40d3c4:
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40d3e0:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_Parsestmt(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40d3ec:
+//Parsestmt:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbc8;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = sp + 0x38;
+//nop;
+a1 = 0x10009728;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x23;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+// bdead 40000113 ra = MEM_U32(sp + 28);
+if (v1 == at) goto L40e174;
+t6 = 0x10008ee0;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+at = 0x64;
+if (t6 == 0) goto L40d4bc;
+v0 = 0x1000a7c0;
+t0 = 0x10009310;
+t7 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x1c;
+MEM_U8(v0 + 5) = (uint8_t)t9;
+t0 = MEM_U32(t0 + 0);
+t1 = 0x10009314;
+MEM_U32(v0 + 8) = t0;
+t1 = MEM_U32(t1 + 0);
+//nop;
+MEM_U32(v0 + 12) = t1;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x64;
+L40d4bc:
+if (v1 != at) {
+at = 0x69;
+goto L40d54c;}
+at = 0x69;
+//nop;
+a0 = 0x10009728;
+a1 = 0x10009b28;
+//nop;
+f_make_local_label(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = sp + 0x38;
+//nop;
+a1 = 0x10009728;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x3a;
+v1 = 0x10009720;
+a1 = zero;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 == at) {
+at = 0x3d;
+goto L40d5a0;}
+at = 0x3d;
+a0 = 0x10005b08;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+at = 0x69;
+L40d54c:
+a1 = zero;
+if (v1 == at) goto L40d574;
+a0 = 0x10005b28;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+L40d574:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x3d;
+L40d5a0:
+if (v1 != at) {
+at = 0x3a;
+goto L40d5cc;}
+at = 0x3a;
+//nop;
+a0 = sp + 0x38;
+// fdead 16000007f t9 = t9;
+//nop;
+func_4056dc(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+at = 0x3a;
+L40d5cc:
+//nop;
+if (v1 != at) goto L40d6b0;
+t2 = 0x10008ec0;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L40d60c;
+//nop;
+a0 = sp + 0x38;
+// fdead 16000087f t9 = t9;
+//nop;
+func_4055d4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40d628;
+L40d60c:
+//nop;
+a0 = sp + 0x38;
+// fdead 16000087f t9 = t9;
+//nop;
+func_40d284(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40d628:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x23;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 == at) {
+at = 0x69;
+goto L40e170;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L40d680;
+a0 = 0x10005b3c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+L40d680:
+//nop;
+a1 = 0x10009728;
+a0 = sp + 0x38;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L40d6b0:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+v0 = f_opLookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = sp + 0x38;
+if (v0 != 0) goto L40d6ec;
+a0 = 0x10005b50;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+L40d6ec:
+t3 = MEM_U32(sp + 52);
+at = 0x2;
+v0 = MEM_U32(t3 + 16);
+//nop;
+if (v0 != at) {
+at = 0x1;
+goto L40de60;}
+at = 0x1;
+a0 = MEM_U32(t3 + 20);
+//nop;
+t4 = a0 + 0xffffffff;
+//nop;
+if (t4 >= 0x3d) goto L40dde8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L40da98;
+case 1: goto L40d85c;
+case 2: goto L40dd48;
+case 3: goto L40d75c;
+case 4: goto L40d77c;
+case 5: goto L40d79c;
+case 6: goto L40d7bc;
+case 7: goto L40d7dc;
+case 8: goto L40d8bc;
+case 9: goto L40d73c;
+case 10: goto L40d81c;
+case 11: goto L40db58;
+case 12: goto L40d7fc;
+case 13: goto L40d89c;
+case 14: goto L40dd68;
+case 15: goto L40dda8;
+case 16: goto L40dd88;
+case 17: goto L40d87c;
+case 18: goto L40dbb8;
+case 19: goto L40d93c;
+case 20: goto L40d73c;
+case 21: goto L40d95c;
+case 22: goto L40dde8;
+case 23: goto L40d99c;
+case 24: goto L40d73c;
+case 25: goto L40d73c;
+case 26: goto L40d99c;
+case 27: goto L40d9dc;
+case 28: goto L40d9bc;
+case 29: goto L40d9bc;
+case 30: goto L40dde8;
+case 31: goto L40d91c;
+case 32: goto L40ddc8;
+case 33: goto L40da1c;
+case 34: goto L40da54;
+case 35: goto L40d9bc;
+case 36: goto L40d9fc;
+case 37: goto L40dab8;
+case 38: goto L40dad8;
+case 39: goto L40da74;
+case 40: goto L40dde8;
+case 41: goto L40db38;
+case 42: goto L40db18;
+case 43: goto L40d83c;
+case 44: goto L40d8dc;
+case 45: goto L40d99c;
+case 46: goto L40d8fc;
+case 47: goto L40dbd8;
+case 48: goto L40dbf8;
+case 49: goto L40db78;
+case 50: goto L40db98;
+case 51: goto L40daf8;
+case 52: goto L40dc18;
+case 53: goto L40dc18;
+case 54: goto L40dc18;
+case 55: goto L40dc18;
+case 56: goto L40dc38;
+case 57: goto L40dc94;
+case 58: goto L40d97c;
+case 59: goto L40dd08;
+case 60: goto L40dd28;
+}
+L40d73c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40af00(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d75c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a5d4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d77c:
+//nop;
+a0 = zero;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a79c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d79c:
+//nop;
+a0 = 0x1;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a79c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d7bc:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a958(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d7dc:
+//nop;
+a0 = 0x8;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40aad4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d7fc:
+//nop;
+a0 = 0x1;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b0f4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d81c:
+//nop;
+a0 = 0x2;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b0f4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d83c:
+//nop;
+a0 = 0x4;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b0f4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d85c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b984(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d87c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40bc84(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d89c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c048(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d8bc:
+//nop;
+a0 = 0x9;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40aad4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d8dc:
+//nop;
+a0 = 0x2d;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40aad4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d8fc:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c9d0(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d91c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40cccc(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d93c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40ceb4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d95c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40cf9c(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d97c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_406034(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d99c:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b5f0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d9bc:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c830(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d9dc:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c218(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40d9fc:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c928(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40da1c:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+a1 = v0;
+// fdead 16000007f t9 = t9;
+//nop;
+func_40c66c(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40da54:
+//nop;
+a0 = zero;
+// fdead 16000307f t9 = t9;
+a1 = zero;
+func_40c66c(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40da74:
+a0 = 0x10005b70;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40da98:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40adfc(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dab8:
+//nop;
+a0 = 0x26;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c5e8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dad8:
+//nop;
+a0 = 0x27;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c5e8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40daf8:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a4b0(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40db18:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a280(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40db38:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a208(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40db58:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40b340(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40db78:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c360(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40db98:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c3e0(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dbb8:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c2e0(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dbd8:
+//nop;
+a0 = 0x30;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40cde4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dbf8:
+//nop;
+a0 = 0x31;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40cde4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dc18:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c5e8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dc38:
+t5 = 0x1000a7d8;
+a2 = 0xdd1;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L40dc70;
+//nop;
+//nop;
+// fdead 1600070ff t9 = t9;
+//nop;
+func_40a530(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dc70:
+a0 = 0x10005b8c;
+a1 = 0x10005b94;
+//nop;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dc94:
+t6 = 0x1000a7d8;
+a2 = 0xdd9;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40dce4;
+t7 = 0x1000a7c0;
+at = 0x1000a7c0;
+t7 = MEM_U8(t7 + 5);
+//nop;
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x3a;
+MEM_U8(at + 5) = (uint8_t)t9;
+//nop;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dce4:
+a0 = 0x10005ba0;
+a1 = 0x10005ba8;
+//nop;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dd08:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c460(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dd28:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40c4cc(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dd48:
+//nop;
+a0 = 0x3;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a044(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dd68:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a0d4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dd88:
+//nop;
+a0 = 0x11;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a044(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dda8:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40d110(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40ddc8:
+//nop;
+//nop;
+// fdead 16000307f t9 = t9;
+//nop;
+func_40a160(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40de0c;
+L40dde8:
+a0 = 0x10005bb4;
+a1 = 0x10005bbc;
+//nop;
+a2 = 0xdf1;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40de0c:
+t0 = 0x10009f30;
+//nop;
+t0 = MEM_U32(t0 + 0);
+//nop;
+// bdead 40000103 ra = MEM_U32(sp + 28);
+if (t0 != 0) goto L40e174;
+t1 = 0x10009720;
+at = 0x23;
+t1 = MEM_U8(t1 + 0);
+a1 = zero;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if (t1 == at) goto L40e174;
+a0 = 0x10005bc8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+at = 0x1;
+L40de60:
+a1 = sp + 0x38;
+if (v0 != at) goto L40e154;
+t2 = MEM_U32(sp + 52);
+a2 = 0xe30;
+t3 = MEM_U32(t2 + 24);
+a0 = MEM_U32(t2 + 20);
+//nop;
+if (t3 >= 0x12) goto L40e0e4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L40dea4;
+case 1: goto L40df44;
+case 2: goto L40df84;
+case 3: goto L40df24;
+case 4: goto L40df04;
+case 5: goto L40dec4;
+case 6: goto L40e004;
+case 7: goto L40dfe4;
+case 8: goto L40dfc4;
+case 9: goto L40e024;
+case 10: goto L40dee4;
+case 11: goto L40dfa4;
+case 12: goto L40df64;
+case 13: goto L40e044;
+case 14: goto L40e084;
+case 15: goto L40e064;
+case 16: goto L40e0a4;
+case 17: goto L40e0c4;
+}
+L40dea4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4058f0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40dec4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_408c80(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40dee4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_409fd0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40df04:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_40848c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40df24:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_407a20(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40df44:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_406728(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40df64:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_406fe8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40df84:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4076a0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40dfa4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4075cc(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40dfc4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_409b10(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40dfe4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_409850(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e004:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4092fc(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e024:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_409ecc(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e044:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4088b8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e064:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_406c48(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e084:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4061f8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e0a4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4085d8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e0c4:
+//nop;
+//nop;
+// fdead 1600018ff t9 = t9;
+//nop;
+func_4086ec(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L40e104;
+L40e0e4:
+a0 = 0x10005be8;
+a1 = 0x10005bf0;
+//nop;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40e104:
+t4 = 0x10009f30;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+// bdead 40000103 ra = MEM_U32(sp + 28);
+if (t4 != 0) goto L40e174;
+t5 = 0x10009720;
+at = 0x23;
+t5 = MEM_U8(t5 + 0);
+a1 = zero;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if (t5 == at) goto L40e174;
+a0 = 0x10005bfc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e174;
+L40e154:
+a0 = 0x10005c1c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40e170:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40e174:
+// bdead 1 sp = sp + 0x438;
+//nop;
+return;
+}
+
+static void func_40e180(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L40e180:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffee0;
+MEM_U32(sp + 292) = a1;
+//nop;
+MEM_U32(sp + 296) = a2;
+a2 = MEM_U32(sp + 292);
+a1 = a0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 288) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 296);
+//nop;
+a0 = sp + 0x20;
+//nop;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x120;
+return;
+}
+
+static uint32_t f_sym_undefined(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L40e1e0:
+//sym_undefined:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+t6 = sp + 0x28;
+// fdead 400080eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = sp + 0x30;
+a2 = sp + 0x2c;
+a3 = sp + 0x34;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+v0 = MEM_U32(sp + 48);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+t7 = v0 < 0x1;
+v0 = t7;
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static void func_40e230(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e230:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+// bdead 4000808f gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 52);
+at = at | 0xffff;
+v1 = v0;
+if (t6 != at) goto L40e3c4;
+at = 0xe;
+v0 = a3 ^ 0x6;
+if (a3 == at) goto L40e290;
+a1 = v0 < 0x1;
+//nop;
+if (a1 == 0) goto L40e2a0;
+L40e290:
+a1 = MEM_U32(sp + 64);
+//nop;
+t7 = zero < a1;
+a1 = t7;
+L40e2a0:
+//nop;
+a0 = MEM_U32(v1 + 4);
+MEM_U32(sp + 32) = a1;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 52);
+t2 = MEM_U8(v0 + 12);
+t1 = t8 << 2;
+t3 = t2 & 0xff03;
+// bdead 4000150b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+t0 = MEM_U32(sp + 60);
+t4 = t1 | t3;
+MEM_U8(v0 + 12) = (uint8_t)t4;
+t6 = MEM_U32(sp + 56);
+t9 = MEM_U16(v0 + 12);
+t7 = t6 << 5;
+t8 = t7 & 0x3e0;
+t2 = t9 & 0xfc1f;
+t3 = 0x10000020;
+t1 = t8 | t2;
+MEM_U16(v0 + 12) = (uint16_t)t1;
+t3 = MEM_U32(t3 + 0);
+a2 = v0;
+a0 = 0xffffffff;
+if (t3 == 0) goto L40e320;
+t4 = MEM_U32(v0 + 8);
+//nop;
+//nop;
+if ((int)t4 >= (int)t0) goto L40e324;
+MEM_U32(v0 + 8) = t0;
+goto L40e324;
+L40e320:
+MEM_U32(v0 + 8) = t0;
+L40e324:
+at = 0xf0000;
+if (a1 == 0) goto L40e364;
+//nop;
+MEM_U32(sp + 32) = a1;
+MEM_U32(sp + 44) = a2;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+a2 = MEM_U32(sp + 44);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(a2 + 12);
+a1 = MEM_U32(sp + 32);
+t5 = v0 ^ v1;
+t6 = t5 << 12;
+t7 = t6 >> 12;
+t9 = t7 ^ v1;
+MEM_U32(a2 + 12) = t9;
+goto L40e380;
+L40e364:
+v1 = MEM_U32(v0 + 12);
+at = at | 0xffff;
+t8 = v1 ^ at;
+t2 = t8 << 12;
+t1 = t2 >> 12;
+t3 = t1 ^ v1;
+MEM_U32(v0 + 12) = t3;
+L40e380:
+// bdead 400001c3 ra = MEM_U32(sp + 28);
+if (a1 == 0) goto L40e3e4;
+//nop;
+MEM_U32(sp + 44) = a2;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a0 = zero;
+MEM_U16(a2 + 2) = (uint16_t)v0;
+//nop;
+//nop;
+//nop;
+f_st_auxbtadd(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e3e4;
+L40e3c4:
+a0 = 0x100060f0;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40e3e4:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40e3f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40e3f0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+MEM_U32(sp + 44) = v0;
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+// bdead 40008187 gp = MEM_U32(sp + 32);
+at = at | 0xffff;
+t7 = MEM_U32(sp + 44);
+if (t6 == at) goto L40e45c;
+a0 = 0x10006114;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+t7 = MEM_U32(sp + 44);
+L40e45c:
+//nop;
+a0 = MEM_U32(t7 + 4);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 52);
+// bdead 4200010b gp = MEM_U32(sp + 32);
+at = 0xe;
+s0 = v0;
+if (t8 == at) goto L40e48c;
+at = 0x6;
+//nop;
+if (t8 != at) goto L40e4a8;
+L40e48c:
+a0 = 0x10006138;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+L40e4a8:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201c9 gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+t9 = 0xf0000;
+// bdead 44020009 gp = MEM_U32(sp + 32);
+t9 = t9 | 0xffff;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 52);
+a3 = MEM_U32(sp + 56);
+a0 = v0;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 400201c9 gp = MEM_U32(sp + 32);
+t0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t0 + 4) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t1 = MEM_U32(sp + 44);
+// bdead 20409 gp = MEM_U32(sp + 32);
+MEM_U32(t1 + 0) = v0;
+t2 = MEM_U8(s0 + 12);
+//nop;
+t3 = t2 & 0xff03;
+MEM_U8(s0 + 12) = (uint8_t)t3;
+t4 = MEM_U16(s0 + 12);
+//nop;
+t5 = t4 & 0xfc1f;
+MEM_U16(s0 + 12) = (uint16_t)t5;
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40e554(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40e554:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 76) = a1;
+MEM_U32(sp + 80) = a2;
+MEM_U32(sp + 84) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+MEM_U32(sp + 68) = v0;
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+// bdead 40008187 gp = MEM_U32(sp + 32);
+at = at | 0xffff;
+t7 = MEM_U32(sp + 68);
+if (t6 == at) goto L40e5c0;
+a0 = 0x1000615c;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+t7 = MEM_U32(sp + 68);
+L40e5c0:
+//nop;
+a0 = MEM_U32(t7 + 4);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 76);
+// bdead 4000008b gp = MEM_U32(sp + 32);
+a1 = a2 ^ 0xe;
+a1 = a1 < 0x1;
+s0 = v0;
+if (a1 != 0) goto L40e5f8;
+a0 = a2 ^ 0x6;
+v1 = a0 < 0x1;
+//nop;
+if (v1 == 0) goto L40e628;
+L40e5f8:
+v1 = MEM_U32(v0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t8 = v1 & at;
+t9 = t8 ^ at;
+v1 = t9 < 0x1;
+//nop;
+if (v1 == 0) goto L40e628;
+v1 = MEM_U32(sp + 88);
+//nop;
+t0 = zero < v1;
+v1 = t0;
+L40e628:
+MEM_U32(sp + 60) = v1;
+//nop;
+a0 = MEM_U32(s0 + 4);
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 56) = v1;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 56);
+// bdead 400201db gp = MEM_U32(sp + 32);
+MEM_U32(sp + 52) = v0;
+if (v1 == 0) goto L40e684;
+//nop;
+a0 = 0xffffffff;
+//nop;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = v0;
+goto L40e698;
+L40e684:
+v1 = MEM_U32(s0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t1 = v1 & at;
+v1 = t1;
+L40e698:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 84);
+a2 = MEM_U32(sp + 76);
+a3 = MEM_U32(sp + 80);
+MEM_U32(sp + 16) = v1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+t2 = MEM_U32(sp + 68);
+// bdead 400209cb gp = MEM_U32(sp + 32);
+MEM_U32(t2 + 4) = v0;
+t3 = MEM_U32(sp + 60);
+//nop;
+//nop;
+if (t3 == 0) goto L40e6e8;
+//nop;
+a0 = zero;
+//nop;
+f_st_auxbtadd(mem, sp, a0);
+// bdead 400201c1 gp = MEM_U32(sp + 32);
+//nop;
+L40e6e8:
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t4 = MEM_U32(sp + 68);
+// bdead 40022009 gp = MEM_U32(sp + 32);
+MEM_U32(t4 + 0) = v0;
+t5 = MEM_U8(s0 + 12);
+at = 0xf0000;
+t6 = t5 & 0xff03;
+MEM_U8(s0 + 12) = (uint8_t)t6;
+t7 = MEM_U16(s0 + 12);
+//nop;
+t8 = t7 & 0xfc1f;
+MEM_U16(s0 + 12) = (uint16_t)t8;
+t9 = MEM_U32(sp + 44);
+//nop;
+// bdead 20005 ra = MEM_U32(sp + 36);
+if (t9 == 0) goto L40e754;
+v0 = MEM_U32(s0 + 12);
+at = at | 0xffff;
+t0 = v0 ^ at;
+t1 = t0 << 12;
+t2 = t1 >> 12;
+t3 = t2 ^ v0;
+MEM_U32(s0 + 12) = t3;
+// bdead 1 ra = MEM_U32(sp + 36);
+L40e754:
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x48;
+return;
+}
+
+static uint32_t func_40e760(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L40e760:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L40e7c0;
+a0 = 0x10006180;
+//nop;
+a0 = a0;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L40e7c0:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_sym_init(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, t6 = 0, t7 = 0;
+L40e7d0:
+//sym_init:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+f_st_cuinit(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+// bdead 8003 ra = MEM_U32(sp + 28);
+at = 0x10000024;
+t7 = zero < t6;
+// bdead 10005 sp = sp + 0x20;
+MEM_U32(at + 0) = t7;
+return;
+}
+
+static void f_sym_finish(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0,
+t8 = 0, t9 = 0;
+L40e814:
+//sym_finish:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 4000006b MEM_U32(sp + 32) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 68) = ra;
+// fdead 4002006b MEM_U32(sp + 64) = gp;
+// fdead 4002006b MEM_U32(sp + 60) = s7;
+// fdead 4002006b MEM_U32(sp + 56) = s6;
+// fdead 4002006b MEM_U32(sp + 52) = s5;
+// fdead 4002006b MEM_U32(sp + 48) = s4;
+// fdead 4002006b MEM_U32(sp + 44) = s3;
+// fdead 4002006b MEM_U32(sp + 40) = s2;
+// fdead 4002006b MEM_U32(sp + 36) = s1;
+MEM_U32(sp + 108) = a1;
+if (a1 != 0) goto L40e8e0;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40020009 gp = MEM_U32(sp + 64);
+s1 = v0;
+//nop;
+a0 = v0;
+// fdead 6006002b t9 = t9;
+//nop;
+v0 = func_40e760(mem, sp, a0);
+// bdead 40060009 gp = MEM_U32(sp + 64);
+a0 = v0 + 0x3;
+//nop;
+a1 = s0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+MEM_U32(sp + 108) = v0;
+t7 = s1 + s0;
+t8 = MEM_U8(t7 + -1);
+// bdead 42040009 gp = MEM_U32(sp + 64);
+at = 0x47;
+t9 = 0x54;
+if (t8 != at) goto L40e8c4;
+t0 = v0 + s1;
+MEM_U8(t0 + -1) = (uint8_t)t9;
+goto L40e8e0;
+L40e8c4:
+a1 = 0x10006190;
+//nop;
+a0 = MEM_U32(sp + 108);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+//nop;
+L40e8e0:
+//nop;
+s0 = 0x2;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t1 = MEM_U32(v0 + 60);
+// bdead 400205c1 gp = MEM_U32(sp + 64);
+s6 = 0x6;
+if ((int)t1 < (int)0x3) goto L40e9cc;
+s7 = 0x10006194;
+s5 = 0x1;
+s4 = sp + 0x54;
+s3 = sp + 0x60;
+s2 = sp + 0x58;
+s1 = sp + 0x5c;
+s7 = s7;
+L40e920:
+//nop;
+a0 = s0;
+a1 = s1;
+a2 = s2;
+a3 = s3;
+MEM_U32(sp + 16) = s4;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 92);
+// bdead 41fe0089 gp = MEM_U32(sp + 64);
+a1 = v0;
+if (a2 != 0) goto L40e9a8;
+v0 = MEM_U32(sp + 88);
+a3 = MEM_U32(sp + 96);
+a0 = s0;
+if (v0 != 0) goto L40e97c;
+//nop;
+a1 = s5;
+// fdead 61fe01ff t9 = t9;
+MEM_U32(sp + 16) = s5;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0001 gp = MEM_U32(sp + 64);
+//nop;
+goto L40e9a8;
+L40e97c:
+//nop;
+if (v0 == s5) goto L40e9a8;
+//nop;
+if (v0 == s6) goto L40e9a8;
+//nop;
+a0 = s7;
+// fdead 61fe01ff t9 = t9;
+a2 = s5;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0001 gp = MEM_U32(sp + 64);
+//nop;
+L40e9a8:
+//nop;
+s0 = s0 + 0x1;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t2 = MEM_U32(v0 + 60);
+// bdead 41fe09c1 gp = MEM_U32(sp + 64);
+//nop;
+if ((int)s0 < (int)t2) goto L40e920;
+L40e9cc:
+//nop;
+//nop;
+//nop;
+f_st_endallfiles(mem, sp);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = MEM_U32(sp + 108);
+//nop;
+a1 = 0xffffffff;
+//nop;
+f_st_writebinary(mem, sp, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 s0 = MEM_U32(sp + 32);
+// bdead 1 s1 = MEM_U32(sp + 36);
+// bdead 1 s2 = MEM_U32(sp + 40);
+// bdead 1 s3 = MEM_U32(sp + 44);
+// bdead 1 s4 = MEM_U32(sp + 48);
+// bdead 1 s5 = MEM_U32(sp + 52);
+// bdead 1 s6 = MEM_U32(sp + 56);
+// bdead 1 s7 = MEM_U32(sp + 60);
+// bdead 1 sp = sp + 0x68;
+return;
+}
+
+static uint32_t f_sym_enter(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40ea24:
+//sym_enter:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 44) = a1;
+v0 = f_st_extstradd(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+t6 = 0xf0000;
+//nop;
+t6 = t6 | 0xffff;
+MEM_U32(sp + 16) = t6;
+a0 = v0;
+a1 = zero;
+a2 = zero;
+a3 = zero;
+v0 = f_st_extadd(mem, sp, a0, a1, a2, a3);
+// bdead 40000189 gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+a1 = 0x1;
+//nop;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_sym_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40ea98:
+//sym_define:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 68) = a1;
+MEM_U32(sp + 72) = a2;
+t6 = sp + 0x30;
+// fdead 400080eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a2 = sp + 0x34;
+a1 = sp + 0x38;
+a3 = sp + 0x3c;
+MEM_U32(sp + 64) = a0;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 68);
+// bdead 4000008b gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+a3 = MEM_U32(sp + 72);
+MEM_U32(sp + 44) = v0;
+if (a2 >= 0x24) goto L40f14c;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (a2) {
+case 0: goto L40f10c;
+case 1: goto L40ebb4;
+case 2: goto L40ed2c;
+case 3: goto L40f14c;
+case 4: goto L40f14c;
+case 5: goto L40eb14;
+case 6: goto L40f14c;
+case 7: goto L40f14c;
+case 8: goto L40f14c;
+case 9: goto L40f14c;
+case 10: goto L40f14c;
+case 11: goto L40f14c;
+case 12: goto L40f14c;
+case 13: goto L40ed2c;
+case 14: goto L40f14c;
+case 15: goto L40ed2c;
+case 16: goto L40f14c;
+case 17: goto L40edf8;
+case 18: goto L40f14c;
+case 19: goto L40f14c;
+case 20: goto L40f14c;
+case 21: goto L40f14c;
+case 22: goto L40f14c;
+case 23: goto L40f14c;
+case 24: goto L40f14c;
+case 25: goto L40f14c;
+case 26: goto L40f14c;
+case 27: goto L40f14c;
+case 28: goto L40f14c;
+case 29: goto L40f14c;
+case 30: goto L40f14c;
+case 31: goto L40f14c;
+case 32: goto L40f14c;
+case 33: goto L40eed4;
+case 34: goto L40efac;
+case 35: goto L40f06c;
+}
+L40eb14:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40eb54;
+a2 = 0x5;
+if (a1 != 0) goto L40eb54;
+//nop;
+a3 = MEM_U32(sp + 60);
+t8 = 0x1;
+// fdead 620001ff t9 = t9;
+MEM_U32(sp + 16) = t8;
+a1 = 0x2;
+func_40e554(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40eb54:
+a1 = MEM_U32(sp + 56);
+a2 = 0x1;
+if (v0 != v1) goto L40eb90;
+t9 = 0x1;
+if (a1 != 0) goto L40eb90;
+MEM_U32(sp + 16) = t9;
+//nop;
+a3 = MEM_U32(sp + 60);
+// bdead 40000121 t9 = t9;
+a1 = 0x1;
+a2 = 0x5;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40eb90:
+//nop;
+a0 = 0x100061ac;
+a1 = MEM_U32(sp + 44);
+// bdead 400001e1 t9 = t9;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40ebb4:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+at = 0xe;
+if (v0 != 0) goto L40ebf0;
+a2 = 0x1;
+if (a1 != 0) goto L40ebf0;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+a1 = 0x5;
+MEM_U32(sp + 16) = zero;
+func_40e554(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ebf0:
+a1 = MEM_U32(sp + 56);
+if (v0 != at) {
+at = 0x6;
+goto L40ec64;}
+at = 0x6;
+a2 = 0x1;
+if (a1 != 0) goto L40ec60;
+//nop;
+a3 = MEM_U32(sp + 60);
+t0 = 0x1;
+// fdead 600003ff t9 = t9;
+MEM_U32(sp + 16) = t0;
+a1 = 0xe;
+MEM_U32(sp + 64) = a0;
+func_40e554(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+f_st_procbegin(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+f_st_pdadd_idn(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ec60:
+at = 0x6;
+L40ec64:
+v1 = 0x1;
+if (v0 != at) goto L40ecd0;
+a2 = zero;
+if (a1 != 0) goto L40ecd0;
+//nop;
+a3 = MEM_U32(sp + 60);
+t1 = 0x1;
+// fdead 600005ff t9 = t9;
+MEM_U32(sp + 16) = t1;
+a1 = 0x6;
+MEM_U32(sp + 64) = a0;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+f_st_procbegin(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+//nop;
+f_st_pdadd_idn(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ecd0:
+a2 = 0x1;
+if (v0 != v1) goto L40ed08;
+//nop;
+if (a1 != 0) goto L40ed08;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+a1 = 0x5;
+a2 = 0x1;
+MEM_U32(sp + 16) = zero;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ed08:
+//nop;
+a0 = 0x100061d0;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40ed2c:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40ed64;
+if (a1 != 0) {
+a1 = MEM_U32(sp + 56);
+goto L40ed68;}
+a1 = MEM_U32(sp + 56);
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+a1 = 0x2;
+func_40e3f0(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ed64:
+a1 = MEM_U32(sp + 56);
+L40ed68:
+//nop;
+if (v0 != v1) goto L40ed9c;
+t2 = 0x1;
+if (a1 != 0) goto L40ed9c;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600009ff t9 = t9;
+a1 = 0x1;
+MEM_U32(sp + 16) = t2;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ed9c:
+at = 0x11;
+if (v0 != v1) goto L40edd0;
+t3 = 0x1;
+if (a1 != at) goto L40edd0;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600019ff t9 = t9;
+a1 = 0x1;
+MEM_U32(sp + 16) = t3;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40edd0:
+//nop;
+a0 = 0x100061f4;
+a1 = MEM_U32(sp + 44);
+// fdead 600019ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40edf8:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40ee34;
+a2 = 0x11;
+if (a1 != 0) goto L40ee34;
+//nop;
+t4 = 0x1;
+// fdead 600021ff t9 = t9;
+MEM_U32(sp + 16) = t4;
+a1 = 0x1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ee34:
+a1 = MEM_U32(sp + 56);
+//nop;
+if (v0 != v1) goto L40ee6c;
+a2 = 0x11;
+if (a1 != 0) goto L40ee6c;
+//nop;
+t5 = 0x1;
+// fdead 600041ff t9 = t9;
+MEM_U32(sp + 16) = t5;
+a1 = 0x1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ee6c:
+at = 0x11;
+if (v0 != v1) goto L40eeac;
+a2 = 0x11;
+if (a1 != at) goto L40eeac;
+//nop;
+at = 0x10000020;
+// fdead 600001ff t9 = t9;
+a1 = v1;
+MEM_U32(sp + 16) = v1;
+MEM_U32(at + 0) = v1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 32);
+//nop;
+at = 0x10000020;
+MEM_U32(at + 0) = zero;
+goto L40f16c;
+L40eeac:
+//nop;
+a0 = 0x10006218;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40eed4:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40ef0c;
+if (a1 != 0) {
+a1 = MEM_U32(sp + 56);
+goto L40ef10;}
+a1 = MEM_U32(sp + 56);
+//nop;
+a1 = 0x2;
+// fdead 600001ff t9 = t9;
+a2 = 0x11;
+func_40e3f0(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ef0c:
+a1 = MEM_U32(sp + 56);
+L40ef10:
+//nop;
+if (v0 != v1) goto L40ef44;
+a2 = 0x3;
+if (a1 != 0) goto L40ef44;
+//nop;
+t6 = 0x1;
+// fdead 600081ff t9 = t9;
+MEM_U32(sp + 16) = t6;
+a1 = 0x1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40ef44:
+at = 0x3;
+if (v0 != v1) goto L40ef84;
+a2 = 0x3;
+if (a1 != at) goto L40ef84;
+//nop;
+at = 0x10000020;
+// fdead 600001ff t9 = t9;
+a1 = v1;
+MEM_U32(sp + 16) = v1;
+MEM_U32(at + 0) = v1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 32);
+//nop;
+at = 0x10000020;
+MEM_U32(at + 0) = zero;
+goto L40f16c;
+L40ef84:
+//nop;
+a0 = 0x1000624c;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40efac:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40efec;
+a2 = zero;
+if (a1 != 0) goto L40efec;
+//nop;
+a3 = MEM_U32(sp + 60);
+t7 = 0x1;
+// fdead 600101ff t9 = t9;
+MEM_U32(sp + 16) = t7;
+a1 = 0x1;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40efec:
+a1 = MEM_U32(sp + 56);
+//nop;
+if (v0 != v1) goto L40f000;
+//nop;
+if (a1 == 0) goto L40f16c;
+L40f000:
+at = 0x11;
+if (v0 != v1) goto L40f00c;
+if (a1 == at) {
+at = 0xe;
+goto L40f16c;}
+L40f00c:
+at = 0xe;
+a2 = 0x1;
+if (v0 != at) goto L40f048;
+t8 = 0x1;
+if (a1 != 0) goto L40f048;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 620001ff t9 = t9;
+a1 = 0x6;
+a2 = zero;
+MEM_U32(sp + 16) = t8;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40f048:
+//nop;
+a0 = 0x10006280;
+a1 = MEM_U32(sp + 44);
+// fdead 620001ff t9 = t9;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40f06c:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+if (v0 != 0) goto L40f0ac;
+a2 = zero;
+if (a1 != 0) goto L40f0ac;
+t9 = 0x1;
+MEM_U32(sp + 16) = t9;
+//nop;
+a3 = MEM_U32(sp + 60);
+// bdead 400001a1 t9 = t9;
+a1 = 0xe;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40f0ac:
+a1 = MEM_U32(sp + 56);
+a2 = 0x1;
+if (v0 != v1) goto L40f0e8;
+t0 = 0x1;
+if (a1 != 0) goto L40f0e8;
+//nop;
+a3 = MEM_U32(sp + 60);
+// fdead 600003ff t9 = t9;
+a1 = 0x6;
+a2 = zero;
+MEM_U32(sp + 16) = t0;
+func_40e230(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40f0e8:
+//nop;
+a0 = 0x100062b4;
+a1 = MEM_U32(sp + 44);
+// fdead 600003ff t9 = t9;
+a0 = a0;
+func_40e180(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40f10c:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L40f12c;
+//nop;
+if (a1 != 0) goto L40f12c;
+// bdead 1 v0 = 0x1;
+goto L40f170;
+L40f12c:
+a0 = 0x100062e8;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40f14c:
+a0 = 0x100062f8;
+//nop;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40f170;
+L40f16c:
+// bdead 1 v0 = 0x1;
+L40f170:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void f_st_feinit(uint8_t *mem, uint32_t sp) {
+L40f180:
+//st_feinit:
+//nop;
+return;
+}
+
+static uint32_t f_hex_to_num(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40f1d0:
+//hex_to_num:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a0 = MEM_U8(sp + 35);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_tolower(a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t6 = MEM_U8(sp + 35);
+t7 = 0xfb504f0;
+// bdead 18009 ra = MEM_U32(sp + 28);
+t8 = t6 + t7;
+t9 = MEM_U8(t8 + 1);
+// bdead 4000009 sp = sp + 0x20;
+t0 = t9 & 0x4;
+a0 = v0;
+if (t0 == 0) goto L40f228;
+v1 = 0x30;
+goto L40f22c;
+L40f228:
+v1 = 0x57;
+L40f22c:
+v0 = a0 - v1;
+return v0;
+}
+
+static void f_make_local_label(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L40f234:
+//make_local_label:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 52) = a1;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 48);
+s0 = 0x10009b30;
+//nop;
+MEM_U32(sp + 36) = v0;
+a0 = s0;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40f2a0;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = s0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+//nop;
+L40f2a0:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_atol(mem, a0);
+t6 = MEM_U32(sp + 36);
+// bdead 4002810b gp = MEM_U32(sp + 24);
+t7 = s0 + t6;
+t8 = MEM_U8(t7 + -1);
+at = v0 < 0x100;
+a2 = v0;
+MEM_U8(sp + 35) = (uint8_t)t8;
+if (at != 0) goto L40f2f0;
+a0 = 0x100063b0;
+//nop;
+a1 = s0;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+a2 = zero;
+L40f2f0:
+//nop;
+a0 = a2;
+a1 = s0;
+MEM_U32(sp + 44) = a2;
+f_ltoa(mem, sp, a0, a1);
+v0 = MEM_U8(sp + 35);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+at = 0x62;
+if (v0 != at) {
+at = 0x66;
+goto L40f338;}
+at = 0x66;
+t1 = 0x1000a3c0;
+t9 = a2 << 2;
+t2 = t9 + t1;
+a3 = MEM_U32(t2 + 0);
+a3 = a3 + 0xffffffff;
+goto L40f3ac;
+at = 0x66;
+L40f338:
+t6 = a2 << 2;
+if (v0 != at) goto L40f358;
+t4 = 0x1000a3c0;
+t3 = a2 << 2;
+t5 = t3 + t4;
+a3 = MEM_U32(t5 + 0);
+//nop;
+goto L40f3ac;
+L40f358:
+t7 = 0x1000a3c0;
+at = 0x7fff0000;
+v1 = t6 + t7;
+v0 = MEM_U32(v1 + 0);
+at = at | 0xffff;
+a3 = v0;
+if ((int)v0 < (int)at) goto L40f3a4;
+a0 = 0x100063e4;
+//nop;
+a1 = s0;
+a2 = 0x1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+//nop;
+goto L40f3ac;
+L40f3a4:
+t8 = v0 + 0x1;
+MEM_U32(v1 + 0) = t8;
+L40f3ac:
+//nop;
+a0 = s0;
+MEM_U32(sp + 40) = a3;
+v0 = wrapper_strlen(mem, a0);
+t9 = 0x24;
+t1 = s0 + v0;
+MEM_U8(t1 + 0) = (uint8_t)t9;
+t2 = MEM_U32(sp + 52);
+v1 = v0 + 0xb;
+a3 = MEM_U32(sp + 40);
+// bdead 4002091b gp = MEM_U32(sp + 24);
+t3 = s0 + v1;
+MEM_U32(t2 + 0) = v1;
+v1 = 0xa;
+lo = a3 / v1; hi = a3 % v1;
+a1 = s0 + v0;
+a1 = a1 + 0x1;
+MEM_U8(t3 + 0) = (uint8_t)zero;
+t0 = a1 + 0x9;
+a2 = 0x8;
+a0 = a1 + a2;
+a0 = a0 + 0xffffffff;
+//nop;
+if (v1 != 0) goto L40f410;
+abort();
+L40f410:
+t4 = hi;
+a3 = lo;
+t5 = t4 + 0x30;
+MEM_U8(t0 + 0) = (uint8_t)t5;
+lo = a3 / v1; hi = a3 % v1;
+//nop;
+if (v1 != 0) goto L40f430;
+abort();
+L40f430:
+t6 = hi;
+a3 = lo;
+t7 = t6 + 0x30;
+MEM_U8(t0 + -1) = (uint8_t)t7;
+L40f440:
+lo = a3 / v1; hi = a3 % v1;
+a2 = a2 + 0xfffffffc;
+//nop;
+if (v1 != 0) goto L40f454;
+abort();
+L40f454:
+a0 = a0 + 0xfffffffc;
+t8 = hi;
+a3 = lo;
+t9 = t8 + 0x30;
+MEM_U8(a0 + 4) = (uint8_t)t9;
+lo = a3 / v1; hi = a3 % v1;
+//nop;
+if (v1 != 0) goto L40f478;
+abort();
+L40f478:
+t1 = hi;
+a3 = lo;
+t2 = t1 + 0x30;
+MEM_U8(a0 + 3) = (uint8_t)t2;
+lo = a3 / v1; hi = a3 % v1;
+//nop;
+if (v1 != 0) goto L40f498;
+abort();
+L40f498:
+t3 = hi;
+a3 = lo;
+t4 = t3 + 0x30;
+MEM_U8(a0 + 2) = (uint8_t)t4;
+lo = a3 / v1; hi = a3 % v1;
+//nop;
+if (v1 != 0) goto L40f4b8;
+abort();
+L40f4b8:
+t5 = hi;
+t6 = t5 + 0x30;
+a3 = lo;
+MEM_U8(a0 + 1) = (uint8_t)t6;
+//nop;
+if (a2 != 0) goto L40f440;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = s0;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+// bdead 40020001 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L40f508;
+//nop;
+a0 = MEM_U32(sp + 48);
+a1 = s0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40f508:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void f_unscan(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40f514:
+//unscan:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffe0;
+MEM_U32(sp + 32) = a0;
+at = 0x10009318;
+a0 = 0x10009318;
+//nop;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000806f MEM_U32(sp + 28) = ra;
+a1 = 0x10009728;
+// fdead 4000806f MEM_U32(sp + 24) = gp;
+a0 = a0 + 0x1;
+MEM_U8(at + 0) = (uint8_t)t6;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U8(sp + 35);
+t7 = 0x10009b28;
+at = 0x10009318;
+t7 = MEM_U32(t7 + 0);
+// bdead 2010005 ra = MEM_U32(sp + 28);
+MEM_U32(at + 1028) = t7;
+at = 0x10009720;
+// bdead 2000005 sp = sp + 0x20;
+MEM_U8(at + 0) = (uint8_t)t8;
+return;
+}
+
+static void f_make_file(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40f580:
+//make_file:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008eb8;
+t8 = 0x10001080;
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffe0;
+t7 = t6 << 2;
+// fdead 4201806b MEM_U32(sp + 28) = ra;
+// fdead 4201806b MEM_U32(sp + 24) = gp;
+t9 = t7 + t8;
+a3 = MEM_U32(t9 + 0);
+//nop;
+a1 = 0x3;
+a2 = 0x1;
+v0 = f_st_filebegin(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+at = 0x10009310;
+// bdead d sp = sp + 0x20;
+MEM_U32(at + 0) = v0;
+return;
+}
+
+static uint32_t func_40f5d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t6 = 0,
+t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, t8 = 0,
+t9 = 0, lo = 0, hi = 0;
+L40f5d8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001eb MEM_U32(sp + 52) = ra;
+// fdead 400001eb MEM_U32(sp + 48) = gp;
+// fdead 400001eb MEM_U32(sp + 44) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s4;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 60) = a1;
+t6 = MEM_U8(a0 + 0);
+at = 0x30;
+a3 = a0;
+s2 = zero;
+if (t6 != at) goto L40f64c;
+v0 = MEM_U8(a0 + 1);
+at = 0x78;
+s5 = 0x10;
+if (v0 == at) goto L40f63c;
+at = 0x58;
+s4 = 0x1;
+if (v0 != at) goto L40f644;
+L40f63c:
+s4 = 0x2;
+goto L40f654;
+L40f644:
+s5 = 0x8;
+goto L40f654;
+L40f64c:
+s5 = 0xa;
+s4 = zero;
+L40f654:
+s0 = a3 + s4;
+a0 = MEM_U8(s0 + 0);
+t7 = 0x7fff0000;
+t7 = t7 | 0xffff;
+if (a0 == 0) goto L40f700;
+lo = t7 / s5; hi = t7 % s5;
+MEM_U32(sp + 56) = a3;
+//nop;
+if (s5 != 0) goto L40f67c;
+abort();
+L40f67c:
+s3 = 0xffffffff;
+s1 = lo;
+t8 = s1 << 1;
+s1 = t8 + 0x1;
+L40f68c:
+//nop;
+//nop;
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+// bdead 407e0109 gp = MEM_U32(sp + 48);
+s0 = s0 + 0x1;
+if (s1 < s2) goto L40f6c4;
+lo = s2 * s5;
+hi = (uint32_t)((uint64_t)s2 * (uint64_t)s5 >> 32);
+v1 = lo;
+t9 = s3 - v1;
+//nop;
+if (t9 >= v0) goto L40f6e8;
+L40f6c4:
+a0 = 0x100063fc;
+//nop;
+a1 = MEM_U32(sp + 56);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 200001 gp = MEM_U32(sp + 48);
+v0 = s4;
+goto L40f758;
+L40f6e8:
+a0 = MEM_U8(s0 + 0);
+s2 = v1 + v0;
+s4 = s4 + 0x1;
+if (a0 != 0) goto L40f68c;
+a3 = MEM_U32(sp + 56);
+//nop;
+L40f700:
+at = 0xa;
+t0 = s2 << 0;
+if (s5 != at) goto L40f738;
+s0 = 0x80000000;
+if ((int)t0 >= 0) goto L40f738;
+a1 = a3;
+if (s2 == s0) goto L40f738;
+a0 = 0x10006408;
+//nop;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40080001 gp = MEM_U32(sp + 48);
+//nop;
+L40f738:
+t1 = MEM_U32(sp + 60);
+s0 = 0x80000000;
+s4 = s2;
+if (t1 == 0) goto L40f754;
+v0 = s4;
+if (s2 == s0) goto L40f758;
+s4 = -s2;
+L40f754:
+v0 = s4;
+L40f758:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint64_t func_40f77c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, t8 = 0;
+uint64_t temp64;
+L40f77c:
+//nop;
+//nop;
+//nop;
+at = 0xfb52720;
+t6 = 0x10009720;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(t6 + 0);
+MEM_U32(at + 0) = zero;
+at = 0x68;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+if (t6 != at) goto L40f7d4;
+//nop;
+a1 = zero;
+a2 = 0x10;
+temp64 = wrapper_strtoull(mem, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+MEM_U32(sp + 36) = v1;
+goto L40f7f4;
+L40f7d4:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = zero;
+a2 = zero;
+temp64 = wrapper_strtoll(mem, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+MEM_U32(sp + 36) = v1;
+L40f7f4:
+t7 = 0xfb52720;
+at = 0x22;
+t7 = MEM_U32(t7 + 0);
+a1 = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 44);
+if (t7 != at) goto L40f82c;
+a0 = 0x10006424;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+t8 = MEM_U32(sp + 44);
+L40f82c:
+t0 = MEM_U32(sp + 32);
+// bdead 40000201 ra = MEM_U32(sp + 28);
+if (t8 == 0) goto L40f858;
+t1 = MEM_U32(sp + 36);
+t2 = ~t0;
+at = t1 < 0x1;
+t2 = t2 + at;
+t3 = -t1;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 32) = t2;
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L40f858:
+v0 = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_hash(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40f868:
+//hash:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a3 = v0;
+if ((int)v0 > 0) goto L40f8c8;
+a0 = 0x10006438;
+a1 = 0x10006440;
+//nop;
+a2 = 0xe5;
+MEM_U32(sp + 32) = v0;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 32);
+//nop;
+L40f8c8:
+v0 = a3 + 0xffffffff;
+t6 = s0 + a3;
+if ((int)v0 < (int)0x2) goto L40f8e0;
+t0 = v0;
+goto L40f8e4;
+L40f8e0:
+t0 = 0x1;
+L40f8e4:
+v0 = a3 + 0xfffffffe;
+a1 = 0x1;
+if ((int)v0 < (int)0x2) goto L40f8fc;
+a1 = v0;
+goto L40f8fc;
+L40f8fc:
+a2 = a3;
+if ((int)a3 < (int)0x4) goto L40f910;
+a2 = 0x3;
+goto L40f910;
+L40f910:
+a0 = a3;
+if ((int)a3 < (int)0x3) goto L40f924;
+a0 = 0x2;
+goto L40f924;
+L40f924:
+t7 = MEM_U8(t6 + 0);
+t9 = MEM_U8(s0 + 1);
+t8 = t7 << 2;
+t8 = t8 + t7;
+t1 = t9 << 2;
+t8 = t8 << 2;
+t1 = t1 - t9;
+t1 = t1 << 2;
+t8 = t8 - t7;
+t7 = s0 + a2;
+t3 = s0 + a0;
+t1 = t1 + t9;
+t9 = MEM_U8(t7 + 0);
+t4 = MEM_U8(t3 + 0);
+t2 = t8 + t1;
+t8 = t9 << 2;
+t5 = t4 << 4;
+t8 = t8 - t9;
+t5 = t5 + t4;
+t8 = t8 << 2;
+t3 = s0 + a1;
+t4 = MEM_U8(t3 + 0);
+t6 = t2 + t5;
+t7 = s0 + t0;
+t8 = t8 - t9;
+t9 = MEM_U8(t7 + 0);
+t1 = t6 + t8;
+t2 = t4 << 2;
+t2 = t2 - t4;
+t6 = t9 << 3;
+t5 = t1 + t2;
+t6 = t6 - t9;
+v1 = t5 + t6;
+// bdead 11 ra = MEM_U32(sp + 28);
+v0 = v1 & 0x7f;
+if ((int)v1 >= 0) goto L40f9c0;
+//nop;
+if (v0 == 0) goto L40f9c0;
+v0 = v0 + 0xffffff80;
+L40f9c0:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_LookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40f9cc:
+//LookUp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(a1 + 0) = zero;
+//nop;
+s1 = a0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t7 = v0 << 2;
+t8 = 0x10009fb8;
+//nop;
+t9 = t7 + t8;
+s0 = MEM_U32(t9 + 0);
+//nop;
+v0 = zero;
+if (s0 == 0) goto L40fa68;
+L40fa28:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L40fa54;
+t0 = MEM_U32(sp + 44);
+v0 = 0x1;
+MEM_U32(t0 + 0) = s0;
+goto L40fa68;
+L40fa54:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L40fa28;
+v0 = zero;
+L40fa68:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_opLookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40fa7c:
+//opLookUp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(a1 + 0) = zero;
+//nop;
+s1 = a0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t7 = v0 << 2;
+t8 = 0x1000a1c0;
+//nop;
+t9 = t7 + t8;
+s0 = MEM_U32(t9 + 0);
+//nop;
+v0 = zero;
+if (s0 == 0) goto L40fb18;
+L40fad8:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L40fb04;
+t0 = MEM_U32(sp + 44);
+v0 = 0x1;
+MEM_U32(t0 + 0) = s0;
+goto L40fb18;
+L40fb04:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L40fad8;
+v0 = zero;
+L40fb18:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void func_40fb2c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40fb2c:
+//nop;
+//nop;
+//nop;
+v0 = 0x10008eec;
+t6 = 0x10008ee8;
+v0 = MEM_U32(v0 + 0);
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffe0;
+at = (int)t6 < (int)v0;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+if (at != 0) goto L40fbac;
+t7 = 0x10008ef0;
+t9 = 0xfb504f0;
+t8 = v0 + t7;
+v1 = MEM_U8(t8 + 0);
+at = 0x39;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 1);
+a1 = zero;
+t2 = t1 & 0x3;
+//nop;
+if (t2 != 0) goto L40fb90;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if (v1 != at) goto L40fbb0;
+L40fb90:
+a0 = 0x1000644c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40fbac:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40fbb0:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_consume(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40fbbc:
+//consume:
+//nop;
+//nop;
+//nop;
+v1 = 0x10009b28;
+//nop;
+v0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if ((int)v0 >= (int)0x3ff) goto L40fc04;
+a0 = 0x10008eec;
+t7 = 0x10008ef0;
+t6 = MEM_U32(a0 + 0);
+t0 = 0x10009b30;
+t8 = t6 + t7;
+t9 = MEM_U8(t8 + 0);
+t1 = v0 + t0;
+MEM_U8(t1 + 0) = (uint8_t)t9;
+L40fc04:
+a0 = 0x10008eec;
+t2 = v0 + 0x1;
+t3 = MEM_U32(a0 + 0);
+MEM_U32(v1 + 0) = t2;
+t4 = t3 + 0x1;
+MEM_U32(a0 + 0) = t4;
+return;
+}
+
+static uint32_t func_40fc20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40fc20:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 400001eb MEM_U32(sp + 56) = fp;
+// fdead 400001eb MEM_U32(sp + 48) = s7;
+s7 = 0x10008eec;
+fp = 0x10008ee8;
+v1 = MEM_U32(s7 + 0);
+t6 = MEM_U32(fp + 0);
+// fdead c10081fb MEM_U32(sp + 44) = s6;
+// fdead c10081fb MEM_U32(sp + 28) = s2;
+at = (int)t6 < (int)v1;
+s6 = a0;
+// fdead c18081ff MEM_U32(sp + 60) = ra;
+// fdead c18081ff MEM_U32(sp + 52) = gp;
+// fdead c18081ff MEM_U32(sp + 40) = s5;
+// fdead c18081ff MEM_U32(sp + 36) = s4;
+// fdead c18081ff MEM_U32(sp + 32) = s3;
+// fdead c18081ff MEM_U32(sp + 24) = s1;
+// fdead c18081ff MEM_U32(sp + 20) = s0;
+s2 = 0x1;
+MEM_U32(sp + 64) = v1;
+if (at != 0) goto L40fd60;
+s5 = 0x1000646c;
+s3 = 0xfb504f0;
+s1 = 0x10008ef0;
+s4 = 0xa;
+s5 = s5;
+t7 = s1 + v1;
+L40fc98:
+s0 = MEM_U8(t7 + 0);
+//nop;
+t8 = s3 + s0;
+v0 = MEM_U8(t8 + 1);
+//nop;
+t9 = v0 & 0x4;
+t0 = v0 & 0x80;
+if (t9 == 0) goto L40fcd8;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead c1fc0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s7 + 0);
+//nop;
+goto L40fd44;
+L40fcd8:
+//nop;
+if (t0 == 0) goto L40fd40;
+a0 = s5;
+if (s6 != s4) goto L40fd00;
+//nop;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+//nop;
+L40fd00:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_tolower(a0);
+t1 = MEM_U32(s7 + 0);
+// bdead c1fc040b gp = MEM_U32(sp + 52);
+t2 = s1 + t1;
+MEM_U8(t2 + 0) = (uint8_t)v0;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead c1fc0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s7 + 0);
+//nop;
+goto L40fd44;
+L40fd40:
+s2 = zero;
+L40fd44:
+t4 = MEM_U32(sp + 64);
+if (s2 == 0) goto L40fd64;
+t3 = MEM_U32(fp + 0);
+//nop;
+t7 = s1 + v1;
+if ((int)t3 >= (int)v1) goto L40fc98;
+L40fd60:
+t4 = MEM_U32(sp + 64);
+L40fd64:
+// bdead 2011 ra = MEM_U32(sp + 60);
+// bdead 2011 s0 = MEM_U32(sp + 20);
+// bdead 2011 s1 = MEM_U32(sp + 24);
+// bdead 2011 s2 = MEM_U32(sp + 28);
+// bdead 2011 s3 = MEM_U32(sp + 32);
+// bdead 2011 s4 = MEM_U32(sp + 36);
+// bdead 2011 s5 = MEM_U32(sp + 40);
+// bdead 2011 s6 = MEM_U32(sp + 44);
+// bdead 2011 s7 = MEM_U32(sp + 48);
+// bdead 2011 fp = MEM_U32(sp + 56);
+// bdead 2011 sp = sp + 0x48;
+v0 = (int)t4 < (int)v1;
+return v0;
+}
+
+static void func_40fd98(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40fd98:
+//nop;
+//nop;
+//nop;
+at = 0x10009720;
+t6 = 0x68;
+MEM_U8(at + 0) = (uint8_t)t6;
+at = 0x10009b30;
+t7 = 0x78;
+MEM_U8(at + 1) = (uint8_t)t7;
+at = 0x10009b28;
+v0 = 0x10008eec;
+t8 = 0x2;
+MEM_U32(at + 0) = t8;
+t9 = MEM_U32(v0 + 0);
+sp = sp + 0xffffffd0;
+t0 = t9 + 0x1;
+//nop;
+// fdead 460183ef MEM_U32(sp + 28) = ra;
+// bdead 6000030b t9 = t9;
+// fdead 460183ef MEM_U32(sp + 24) = gp;
+a0 = 0x10;
+MEM_U32(v0 + 0) = t0;
+v0 = func_40fc20(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = v0;
+v1 = 0x10008eec;
+t1 = 0x10008ee8;
+v1 = MEM_U32(v1 + 0);
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if ((int)t1 < (int)v1) goto L40fe74;
+t2 = 0x10008ef0;
+at = 0x2e;
+t3 = v1 + t2;
+t4 = MEM_U8(t3 + 0);
+t5 = 0x66;
+//nop;
+if (t4 != at) goto L40fe74;
+at = 0x10009720;
+//nop;
+MEM_U32(sp + 44) = v0;
+MEM_U8(at + 0) = (uint8_t)t5;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a0 = 0x10;
+//nop;
+//nop;
+// fdead 6000003f t9 = t9;
+//nop;
+v0 = func_40fc20(mem, sp, a0, a1, a2, a3);
+a1 = MEM_U32(sp + 44);
+// bdead 4000014b gp = MEM_U32(sp + 24);
+a1 = a1 | v0;
+L40fe74:
+//nop;
+if (a1 == 0) goto L410018;
+v1 = 0x10008eec;
+t6 = 0x10008ee8;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if ((int)t6 < (int)v1) goto L410018;
+t7 = 0x10008ef0;
+//nop;
+t8 = v1 + t7;
+a0 = MEM_U8(t8 + 0);
+MEM_U32(sp + 44) = a1;
+v0 = wrapper_tolower(a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+t9 = 0x10008eec;
+t0 = 0x10008ef0;
+t9 = MEM_U32(t9 + 0);
+t1 = v0 & 0xff;
+at = 0x68;
+v1 = t9 + t0;
+MEM_U8(v1 + 0) = (uint8_t)v0;
+if (t1 != at) goto L410018;
+at = 0x10009720;
+//nop;
+t2 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t2;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t3 = 0xa;
+v0 = 0x10008ee8;
+v1 = 0x10008eec;
+v0 = MEM_U32(v0 + 0);
+v1 = MEM_U32(v1 + 0);
+//nop;
+if ((int)v0 >= (int)v1) {
+at = (int)v1 < (int)v0;
+goto L40ff24;}
+at = (int)v1 < (int)v0;
+a1 = zero;
+goto L410018;
+// fdead 0 at = (int)v1 < (int)v0;
+L40ff24:
+MEM_U32(sp + 36) = t3;
+if (at == 0) goto L40ffa8;
+t4 = 0x10008ef0;
+//nop;
+t5 = v1 + t4;
+a0 = MEM_U8(t5 + 1);
+//nop;
+v0 = wrapper_tolower(a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x30;
+t6 = 0x10008eec;
+t7 = 0x10008ef0;
+t6 = MEM_U32(t6 + 0);
+t9 = v0 & 0xff;
+v1 = t6 + t7;
+t8 = MEM_U8(v1 + 0);
+MEM_U8(v1 + 1) = (uint8_t)v0;
+if (t8 != at) {
+at = 0x78;
+goto L40ffa8;}
+at = 0x78;
+t1 = MEM_U32(sp + 36);
+if (t9 != at) goto L40ffac;
+//nop;
+t0 = 0x10;
+MEM_U32(sp + 36) = t0;
+f_consume(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40ffa8:
+t1 = MEM_U32(sp + 36);
+L40ffac:
+at = 0xa;
+//nop;
+if (t1 != at) goto L40fffc;
+t2 = 0x10008eec;
+t3 = 0x10008ef0;
+t2 = MEM_U32(t2 + 0);
+at = 0x2b;
+t4 = t2 + t3;
+v0 = MEM_U8(t4 + 0);
+//nop;
+if (v0 == at) {
+at = 0x2d;
+goto L40ffe4;}
+at = 0x2d;
+//nop;
+if (v0 != at) goto L40fffc;
+L40ffe4:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L40fffc:
+//nop;
+a0 = MEM_U32(sp + 36);
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_40fc20(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = v0;
+L410018:
+a2 = 0x1;
+if (a1 != 0) goto L410040;
+a0 = 0x1000648c;
+//nop;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+goto L41005c;
+L410040:
+//nop;
+//nop;
+// bdead 40000103 t9 = t9;
+//nop;
+func_40fb2c(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+L41005c:
+t5 = 0x10009720;
+at = 0x66;
+t5 = MEM_U8(t5 + 0);
+//nop;
+// bdead 40000103 ra = MEM_U32(sp + 28);
+if (t5 != at) goto L4100bc;
+t6 = 0x10009b28;
+a1 = zero;
+t6 = MEM_U32(t6 + 0);
+//nop;
+// bdead 40000141 ra = MEM_U32(sp + 28);
+if ((int)t6 < (int)0x400) goto L4100bc;
+a0 = 0x100064b0;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+t7 = 0x3ff;
+at = 0x10009b28;
+//nop;
+MEM_U32(at + 0) = t7;
+// bdead 1 ra = MEM_U32(sp + 28);
+L4100bc:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_4100c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, t8 = 0, t9 = 0;
+L4100c8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+at = 0x10009720;
+// fdead 400001ef MEM_U32(sp + 24) = s1;
+// fdead 400001ef MEM_U32(sp + 20) = s0;
+t6 = 0x64;
+s0 = 0x10008eec;
+s1 = 0x10008ee8;
+MEM_U8(at + 0) = (uint8_t)t6;
+v0 = MEM_U32(s0 + 0);
+t7 = MEM_U32(s1 + 0);
+// fdead 400781ef MEM_U32(sp + 36) = ra;
+at = (int)v0 < (int)t7;
+// fdead 400781ef MEM_U32(sp + 32) = gp;
+// fdead 400781ef MEM_U32(sp + 28) = s2;
+if (at == 0) goto L41017c;
+s2 = 0x10008ef0;
+//nop;
+t8 = s2 + v0;
+v1 = MEM_U8(t8 + 0);
+//nop;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x39;
+goto L41017c;}
+//nop;
+if ((int)v1 >= (int)0x39) goto L41017c;
+L410138:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+v0 = MEM_U32(s0 + 0);
+t9 = MEM_U32(s1 + 0);
+// bdead 440e0109 gp = MEM_U32(sp + 32);
+t0 = s2 + v0;
+if ((int)v0 >= (int)t9) goto L41017c;
+v1 = MEM_U8(t0 + 0);
+//nop;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x39;
+goto L41017c;}
+//nop;
+if ((int)v1 < (int)0x39) goto L410138;
+L41017c:
+//nop;
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_40fb2c(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_4101ac(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+L4101ac:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10008eec;
+s1 = 0x10008ee8;
+v0 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s1 + 0);
+// fdead 400681eb MEM_U32(sp + 36) = ra;
+at = (int)v0 < (int)t6;
+// fdead 400681ef MEM_U32(sp + 32) = gp;
+// fdead 400681ef MEM_U32(sp + 28) = s2;
+if (at == 0) goto L410258;
+s2 = 0x10008ef0;
+//nop;
+t7 = s2 + v0;
+v1 = MEM_U8(t7 + 0);
+//nop;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x3a;
+goto L410258;}
+// bdead e0001 ra = MEM_U32(sp + 36);
+if ((int)v1 >= (int)0x3a) goto L41025c;
+L410210:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+v0 = MEM_U32(s0 + 0);
+t8 = MEM_U32(s1 + 0);
+// bdead 20e0009 gp = MEM_U32(sp + 32);
+// bdead e0009 ra = MEM_U32(sp + 36);
+if ((int)v0 >= (int)t8) goto L41025c;
+t9 = s2 + v0;
+v1 = MEM_U8(t9 + 0);
+//nop;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x3a;
+goto L410258;}
+//nop;
+if ((int)v1 < (int)0x3a) goto L410210;
+L410258:
+// bdead 1 ra = MEM_U32(sp + 36);
+L41025c:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_410270(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L410270:
+//nop;
+//nop;
+//nop;
+v1 = 0x10009b28;
+sp = sp + 0xffffffe0;
+v0 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+at = (int)v0 < (int)0x400;
+// fdead 400001ff MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+if (at != 0) goto L4102d4;
+t6 = 0x3ff;
+MEM_U32(v1 + 0) = t6;
+//nop;
+a0 = 0x100064d4;
+a1 = MEM_U32(sp + 32);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+v0 = 0x10009b28;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+L4102d4:
+t7 = MEM_U32(sp + 32);
+//nop;
+t8 = t7 + v0;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_dot_soon(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4102f4:
+//dot_soon:
+//nop;
+//nop;
+//nop;
+v0 = 0x10008ee8;
+t1 = 0x45;
+v0 = MEM_U32(v0 + 0);
+t0 = 0x65;
+a3 = 0x2e;
+if ((int)a0 >= (int)v0) goto L410374;
+t6 = 0x10008ef0;
+t2 = 0xfb504f0;
+a1 = a0 + t6;
+L410328:
+v1 = MEM_U8(a1 + 0);
+a0 = a0 + 0x1;
+t7 = t2 + v1;
+if (a3 == v1) goto L410348;
+at = (int)a0 < (int)v0;
+if (t0 == v1) goto L410348;
+//nop;
+if (t1 != v1) goto L410350;
+L410348:
+v0 = 0x1;
+return v0;
+L410350:
+t8 = MEM_U8(t7 + 1);
+//nop;
+t9 = t8 & 0x4;
+//nop;
+if (t9 != 0) goto L41036c;
+v0 = zero;
+return v0;
+L41036c:
+a1 = a1 + 0x1;
+if (at != 0) goto L410328;
+L410374:
+v0 = zero;
+//nop;
+return v0;
+}
+
+static void f_nexttoken(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, t8 = 0, t9 = 0;
+L410380:
+//nexttoken:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+s0 = 0x10009318;
+// fdead 400201eb MEM_U32(sp + 52) = ra;
+v0 = MEM_U8(s0 + 0);
+// fdead 400201eb MEM_U32(sp + 48) = gp;
+// fdead 400201eb MEM_U32(sp + 44) = s5;
+// fdead 400201eb MEM_U32(sp + 40) = s4;
+// fdead 400201eb MEM_U32(sp + 36) = s3;
+// fdead 400201eb MEM_U32(sp + 32) = s2;
+// fdead 400201eb MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 76) = zero;
+if (v0 == 0) goto L4103f4;
+at = 0x10009720;
+a1 = 0x10009318;
+MEM_U8(at + 0) = (uint8_t)v0;
+MEM_U8(s0 + 0) = (uint8_t)zero;
+//nop;
+a0 = 0x10009728;
+a1 = a1 + 0x1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 48);
+t6 = MEM_U32(s0 + 1028);
+at = 0x10009b28;
+MEM_U32(at + 0) = t6;
+goto L410e5c;
+L4103f4:
+s2 = 0x10008eec;
+s5 = 0x10008ee8;
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+t0 = 0x10009b28;
+MEM_U32(t0 + 0) = zero;
+if ((int)a0 >= (int)a2) goto L410458;
+s3 = 0x10008ef0;
+v0 = 0x20;
+t7 = s3 + a0;
+t8 = MEM_U8(t7 + 0);
+//nop;
+//nop;
+if (v0 != t8) goto L410458;
+L410430:
+t9 = a0 + 0x1;
+at = (int)t9 < (int)a2;
+MEM_U32(s2 + 0) = t9;
+a0 = t9;
+if (at == 0) goto L410458;
+t1 = s3 + a0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+//nop;
+if (v0 == t2) goto L410430;
+L410458:
+s3 = 0x10008ef0;
+t4 = s3 + a0;
+if ((int)a0 < (int)a2) goto L41047c;
+at = 0x10009720;
+t3 = 0x23;
+MEM_U8(at + 0) = (uint8_t)t3;
+goto L410dbc;
+// fdead 0 t4 = s3 + a0;
+L41047c:
+a1 = MEM_U8(t4 + 0);
+at = 0x10009b30;
+t5 = 0x1;
+MEM_U32(t0 + 0) = t5;
+MEM_U8(at + 0) = (uint8_t)a1;
+t6 = a0 + 0x1;
+at = (int)a1 < (int)0x5f;
+MEM_U32(s2 + 0) = t6;
+v1 = a1;
+if (at != 0) goto L4104c0;
+at = 0x7c;
+if (v1 == at) {
+at = 0x7e;
+goto L41050c;}
+at = 0x7e;
+v0 = 0x3c;
+if (v1 == at) goto L410510;
+at = (int)v1 < (int)0x31;
+goto L41056c;
+L4104c0:
+t7 = v1 + 0xffffffde;
+if ((int)v1 < (int)0x3f) goto L4104e0;
+at = 0x5e;
+v0 = 0x3c;
+if (v1 == at) goto L410510;
+at = (int)v1 < (int)0x31;
+goto L41056c;
+L4104e0:
+if (t7 >= 0x1d) {
+at = (int)v1 < (int)0x31;
+goto L41056c;}
+at = (int)v1 < (int)0x31;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L410a30;
+case 1: goto L410568;
+case 2: goto L410568;
+case 3: goto L41050c;
+case 4: goto L41050c;
+case 5: goto L410568;
+case 6: goto L41050c;
+case 7: goto L41050c;
+case 8: goto L41050c;
+case 9: goto L41050c;
+case 10: goto L41050c;
+case 11: goto L41050c;
+case 12: goto L410568;
+case 13: goto L41050c;
+case 14: goto L410568;
+case 15: goto L410568;
+case 16: goto L410568;
+case 17: goto L410568;
+case 18: goto L410568;
+case 19: goto L410568;
+case 20: goto L410568;
+case 21: goto L410568;
+case 22: goto L410568;
+case 23: goto L410568;
+case 24: goto L41050c;
+case 25: goto L41050c;
+case 26: goto L41050c;
+case 27: goto L41050c;
+case 28: goto L41050c;
+}
+L41050c:
+v0 = 0x3c;
+L410510:
+//nop;
+if (v0 != v1) goto L410530;
+a0 = MEM_U32(s2 + 0);
+//nop;
+t8 = s3 + a0;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (v0 == t9) {
+v0 = 0x3e;
+goto L410554;}
+L410530:
+v0 = 0x3e;
+//nop;
+if (v0 != v1) goto L41055c;
+a0 = MEM_U32(s2 + 0);
+//nop;
+t1 = s3 + a0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+if (v0 != t2) {
+t3 = a0 + 0x1;
+goto L41055c;}
+L410554:
+t3 = a0 + 0x1;
+MEM_U32(s2 + 0) = t3;
+L41055c:
+at = 0x10009720;
+MEM_U8(at + 0) = (uint8_t)a1;
+goto L410dbc;
+L410568:
+at = (int)v1 < (int)0x31;
+L41056c:
+if (at != 0) {
+at = (int)v1 < (int)0x3a;
+goto L41057c;}
+v0 = 0x2e;
+if ((int)v1 < (int)0x3a) goto L4105e8;
+L41057c:
+a0 = MEM_U32(s2 + 0);
+v0 = 0x2e;
+//nop;
+if ((int)a0 >= (int)a2) goto L4108cc;
+t4 = s3 + a0;
+if (v0 != v1) goto L4105b8;
+s4 = 0xfb504f0;
+t5 = MEM_U8(t4 + 0);
+//nop;
+t6 = t5 + s4;
+t7 = MEM_U8(t6 + 1);
+//nop;
+t8 = t7 & 0x4;
+if (t8 != 0) {
+at = 0x30;
+goto L4105e4;}
+L4105b8:
+at = 0x30;
+//nop;
+if (v1 != at) goto L4108cc;
+//nop;
+MEM_U32(sp + 60) = v1;
+MEM_U8(sp + 95) = (uint8_t)a1;
+v0 = f_dot_soon(mem, sp, a0);
+// bdead 4058010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 60);
+a1 = MEM_U8(sp + 95);
+if (v0 == 0) {
+v0 = 0x2e;
+goto L4108cc;}
+L4105e4:
+v0 = 0x2e;
+L4105e8:
+s4 = 0xfb504f0;
+t1 = 0x64;
+if (v0 != v1) goto L410640;
+at = 0x10009720;
+t9 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t9;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+//nop;
+//nop;
+//nop;
+// fdead 607a001f t9 = t9;
+//nop;
+func_4101ac(mem, sp);
+// bdead 40780103 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+at = (int)a0 < (int)a2;
+goto L410794;
+L410640:
+//nop;
+at = 0x10009720;
+// bdead 40780407 t9 = t9;
+MEM_U8(at + 0) = (uint8_t)t1;
+func_4101ac(mem, sp);
+a2 = MEM_U32(s5 + 0);
+a0 = MEM_U32(s2 + 0);
+// bdead 407801a3 gp = MEM_U32(sp + 48);
+t2 = s3 + a0;
+if ((int)a2 >= (int)a0) goto L410674;
+//nop;
+goto L410dbc;
+L410674:
+v0 = MEM_U8(t2 + 0);
+at = 0x62;
+if (v0 == at) {
+at = 0x66;
+goto L41068c;}
+at = 0x66;
+if (v0 != at) {
+at = 0x2e;
+goto L410704;}
+at = 0x2e;
+L41068c:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+t3 = 0x69;
+//nop;
+at = 0x10009720;
+a0 = 0x10009b30;
+// fdead 607a103f t9 = t9;
+MEM_U8(at + 0) = (uint8_t)t3;
+func_410270(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 48);
+//nop;
+//nop;
+a0 = 0x10009b30;
+a1 = 0x10009b28;
+//nop;
+f_make_local_label(mem, sp, a0, a1);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+//nop;
+//nop;
+// fdead 607a000f t9 = t9;
+//nop;
+func_40fb2c(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+at = 0x2e;
+L410704:
+if (v0 == at) {
+at = 0x65;
+goto L41073c;}
+at = 0x65;
+if (v0 == at) {
+at = 0x45;
+goto L41073c;}
+at = 0x45;
+//nop;
+if (v0 == at) goto L41073c;
+//nop;
+//nop;
+// fdead 607a08bf t9 = t9;
+//nop;
+func_40fb2c(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L41073c:
+at = 0x10009720;
+t4 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t4;
+at = 0x2e;
+if (v0 != at) {
+at = (int)a0 < (int)a2;
+goto L410794;}
+at = (int)a0 < (int)a2;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+//nop;
+//nop;
+//nop;
+// fdead 607a001f t9 = t9;
+//nop;
+func_4101ac(mem, sp);
+// bdead 40780103 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+//nop;
+at = (int)a0 < (int)a2;
+L410794:
+v1 = s3 + a0;
+if (at == 0) goto L4108ac;
+v0 = MEM_U8(v1 + 0);
+at = 0x65;
+t5 = 0x65;
+if (v0 == at) goto L4107b8;
+at = 0x45;
+//nop;
+if (v0 != at) goto L4108ac;
+L4107b8:
+MEM_U8(v1 + 0) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+// bdead 403001a3 gp = MEM_U32(sp + 48);
+t6 = s3 + a0;
+if ((int)a0 >= (int)a2) goto L410828;
+v0 = MEM_U8(t6 + 0);
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L4107fc;}
+at = 0x2d;
+if (v0 != at) {
+at = (int)a0 < (int)a2;
+goto L41082c;}
+at = (int)a0 < (int)a2;
+L4107fc:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40300103 gp = MEM_U32(sp + 48);
+//nop;
+a0 = 0x10008eec;
+a2 = 0x10008ee8;
+a0 = MEM_U32(a0 + 0);
+a2 = MEM_U32(a2 + 0);
+//nop;
+L410828:
+at = (int)a0 < (int)a2;
+L41082c:
+t7 = s3 + a0;
+if (at == 0) goto L410854;
+t8 = MEM_U8(t7 + 0);
+//nop;
+t9 = t8 + s4;
+t1 = MEM_U8(t9 + 1);
+//nop;
+t2 = t1 & 0x4;
+//nop;
+if (t2 != 0) goto L410890;
+L410854:
+a0 = 0x100064e8;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+t3 = 0x10009b28;
+at = 0x10009b28;
+t3 = MEM_U32(t3 + 0);
+//nop;
+t4 = t3 + 0xffffffff;
+MEM_U32(at + 0) = t4;
+goto L410dbc;
+L410890:
+//nop;
+//nop;
+// bdead 40000001 t9 = t9;
+//nop;
+func_4101ac(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+L4108ac:
+//nop;
+//nop;
+// fdead 607a68bf t9 = t9;
+//nop;
+func_40fb2c(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L4108cc:
+s4 = 0xfb504f0;
+at = 0x30;
+v0 = 0x2e;
+if (v1 != at) goto L410954;
+a0 = MEM_U32(s2 + 0);
+t6 = MEM_U32(s5 + 0);
+t5 = 0x1;
+MEM_U32(sp + 76) = t5;
+if ((int)a0 >= (int)t6) goto L410930;
+t7 = s3 + a0;
+v0 = MEM_U8(t7 + 0);
+at = 0x78;
+if (v0 == at) {
+at = 0x58;
+goto L410910;}
+at = 0x58;
+//nop;
+if (v0 != at) goto L410930;
+L410910:
+//nop;
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_40fd98(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L41094c;
+L410930:
+//nop;
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_4100c8(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+L41094c:
+//nop;
+goto L410dbc;
+L410954:
+t8 = s4 + a1;
+t9 = MEM_U8(t8 + 1);
+//nop;
+t1 = t9 & 0x3;
+//nop;
+if (t1 != 0) goto L410984;
+s0 = 0x5f;
+if (v0 == v1) goto L410984;
+s1 = 0x24;
+if (s0 == v1) goto L410984;
+//nop;
+if (s1 != v1) goto L410a28;
+L410984:
+at = 0x10009720;
+t2 = 0x69;
+MEM_U8(at + 0) = (uint8_t)t2;
+t3 = MEM_U32(s5 + 0);
+a0 = MEM_U32(s2 + 0);
+s0 = 0x5f;
+s1 = 0x24;
+if ((int)a0 >= (int)t3) goto L410a20;
+t4 = s3 + a0;
+L4109ac:
+a1 = MEM_U8(t4 + 0);
+v0 = 0x2e;
+t5 = s4 + a1;
+t6 = MEM_U8(t5 + 1);
+//nop;
+t7 = t6 & 0x7;
+//nop;
+if (t7 != 0) goto L4109e4;
+//nop;
+if (v0 == a1) goto L4109e4;
+//nop;
+if (s0 == a1) goto L4109e4;
+//nop;
+if (s1 != a1) goto L410a00;
+L4109e4:
+//nop;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 407e0101 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s2 + 0);
+goto L410a0c;
+L410a00:
+//nop;
+goto L410dbc;
+// fdead 0 a0 = MEM_U32(s2 + 0);
+L410a0c:
+t8 = MEM_U32(s5 + 0);
+//nop;
+t4 = s3 + a0;
+if ((int)a0 < (int)t8) goto L4109ac;
+L410a20:
+//nop;
+goto L410dbc;
+L410a28:
+//nop;
+goto L410dbc;
+L410a30:
+at = 0x10009720;
+t9 = 0x22;
+MEM_U8(at + 0) = (uint8_t)t9;
+a0 = MEM_U32(s2 + 0);
+MEM_U32(t0 + 0) = zero;
+//nop;
+if ((int)a0 >= (int)a2) goto L410d58;
+s4 = 0xfb504f0;
+a3 = 0x22;
+L410a58:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+at = 0x5c;
+v1 = a1;
+if (a3 != a1) goto L410aa0;
+t3 = MEM_U32(t0 + 0);
+t2 = a0 + 0x1;
+MEM_U32(s2 + 0) = t2;
+if (t3 != 0) goto L410dbc;
+a0 = 0x10006514;
+//nop;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L410aa0:
+t4 = a0 + 0x1;
+if (v1 != at) goto L410d20;
+at = (int)t4 < (int)a2;
+MEM_U32(s2 + 0) = t4;
+a0 = t4;
+if (at != 0) goto L410adc;
+a0 = 0x10006528;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L410adc:
+t5 = s3 + a0;
+a1 = MEM_U8(t5 + 0);
+//nop;
+v1 = a1;
+if ((int)a1 < (int)0x28) goto L410b24;
+t6 = v1 + 0xffffffa4;
+if (t6 >= 0x1b) {
+at = (int)v1 < (int)0x30;
+goto L410b78;}
+at = (int)v1 < (int)0x30;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L410d20;
+case 1: goto L410b74;
+case 2: goto L410b74;
+case 3: goto L410b74;
+case 4: goto L410b74;
+case 5: goto L410b3c;
+case 6: goto L410b44;
+case 7: goto L410b74;
+case 8: goto L410b74;
+case 9: goto L410b74;
+case 10: goto L410b4c;
+case 11: goto L410b74;
+case 12: goto L410b74;
+case 13: goto L410b74;
+case 14: goto L410b74;
+case 15: goto L410b74;
+case 16: goto L410b74;
+case 17: goto L410b74;
+case 18: goto L410b54;
+case 19: goto L410b74;
+case 20: goto L410b74;
+case 21: goto L410b74;
+case 22: goto L410b5c;
+case 23: goto L410b74;
+case 24: goto L410b64;
+case 25: goto L410b74;
+case 26: goto L410b6c;
+}
+L410b24:
+at = 0x27;
+if (v1 == a3) goto L410d20;
+//nop;
+if (v1 == at) goto L410d20;
+at = (int)v1 < (int)0x30;
+goto L410b78;
+L410b3c:
+a1 = 0x7;
+goto L410d20;
+L410b44:
+a1 = 0x8;
+goto L410d20;
+L410b4c:
+a1 = 0xc;
+goto L410d20;
+L410b54:
+a1 = 0xa;
+goto L410d20;
+L410b5c:
+a1 = 0xd;
+goto L410d20;
+L410b64:
+a1 = 0x9;
+goto L410d20;
+L410b6c:
+a1 = 0xb;
+goto L410d20;
+L410b74:
+at = (int)v1 < (int)0x30;
+L410b78:
+if (at != 0) {
+at = (int)v1 < (int)0x38;
+goto L410b84;}
+if ((int)v1 < (int)0x38) {
+at = 0x78;
+goto L410b94;}
+L410b84:
+at = 0x78;
+if (v1 == at) {
+at = 0x58;
+goto L410b94;}
+at = 0x58;
+if (v1 != at) {
+t7 = 0x1;
+goto L410d20;}
+L410b94:
+t7 = 0x1;
+at = (int)v1 < (int)0x30;
+MEM_U32(sp + 76) = t7;
+s1 = zero;
+if (at != 0) goto L410c2c;
+s0 = 0x3;
+if ((int)v1 >= (int)0x38) goto L410c2c;
+t8 = s1 << 3;
+L410bb8:
+t9 = a0 + 0x1;
+s1 = t8 + v1;
+at = (int)t9 < (int)a2;
+s1 = s1 + 0xffffffd0;
+MEM_U32(s2 + 0) = t9;
+a0 = t9;
+if (at != 0) goto L410bf8;
+a0 = 0x10006548;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L410bf8:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+s0 = s0 + 0xffffffff;
+v1 = a1;
+if ((int)a1 < (int)0x30) goto L410cd8;
+t5 = a0 + 0xffffffff;
+if ((int)a1 >= (int)0x38) goto L410cdc;
+t8 = s1 << 3;
+if (s0 != 0) goto L410bb8;
+t5 = a0 + 0xffffffff;
+goto L410cdc;
+L410c2c:
+t2 = a0 + 0x1;
+t3 = s3 + t2;
+a1 = MEM_U8(t3 + 0);
+MEM_U32(s2 + 0) = t2;
+t4 = s4 + a1;
+t5 = MEM_U8(t4 + 1);
+a0 = t2;
+t6 = t5 & 0x80;
+s0 = 0x2;
+if (t6 == 0) goto L410cd8;
+L410c54:
+//nop;
+a0 = a1 & 0xff;
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t8 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+a0 = t8 + 0x1;
+// bdead 407e01ab gp = MEM_U32(sp + 48);
+t7 = s1 << 4;
+at = (int)a0 < (int)a2;
+s1 = v0 + t7;
+MEM_U32(s2 + 0) = a0;
+if (at != 0) goto L410cac;
+a0 = 0x10006568;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L410cac:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+s0 = s0 + 0xffffffff;
+t2 = s4 + a1;
+t3 = MEM_U8(t2 + 1);
+//nop;
+t4 = t3 & 0x80;
+t5 = a0 + 0xffffffff;
+if (t4 == 0) goto L410cdc;
+//nop;
+if (s0 != 0) goto L410c54;
+L410cd8:
+t5 = a0 + 0xffffffff;
+L410cdc:
+at = (int)s1 < (int)0x100;
+a3 = 0x22;
+MEM_U32(s2 + 0) = t5;
+if (at == 0) goto L410cfc;
+t0 = 0x10009b28;
+a1 = s1 & 0xff;
+a0 = t5;
+goto L410d20;
+L410cfc:
+a0 = 0x10006588;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+goto L410dbc;
+L410d20:
+v0 = MEM_U32(t0 + 0);
+t9 = a0 + 0x1;
+t8 = v0 + 0x1;
+if ((int)v0 >= (int)0x3ff) goto L410d44;
+t6 = 0x10009b30;
+//nop;
+t7 = v0 + t6;
+MEM_U8(t7 + 0) = (uint8_t)a1;
+L410d44:
+at = (int)t9 < (int)a2;
+MEM_U32(t0 + 0) = t8;
+MEM_U32(s2 + 0) = t9;
+a0 = t9;
+if (at != 0) goto L410a58;
+L410d58:
+t1 = MEM_U32(t0 + 0);
+a1 = zero;
+if ((int)t1 < (int)0x400) {
+at = (int)a0 < (int)a2;
+goto L410d98;}
+at = (int)a0 < (int)a2;
+a0 = 0x100065a4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+t2 = 0x3ff;
+at = 0x10009b28;
+MEM_U32(at + 0) = t2;
+goto L410dbc;
+// fdead 0 at = (int)a0 < (int)a2;
+L410d98:
+a1 = zero;
+if (at != 0) goto L410dbc;
+a0 = 0x100065bc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+L410dbc:
+v0 = 0x10009720;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) {
+at = 0x68;
+goto L410df4;}
+at = 0x68;
+if (v0 == at) {
+at = 0x64;
+goto L410df4;}
+at = 0x64;
+if (v0 == at) {
+at = 0x66;
+goto L410df4;}
+at = 0x66;
+if (v0 == at) {
+at = 0x22;
+goto L410df4;}
+at = 0x22;
+// bdead 40000101 ra = MEM_U32(sp + 52);
+if (v0 != at) goto L410e60;
+L410df4:
+//nop;
+a0 = 0x10009b30;
+// bdead 40000121 t9 = t9;
+//nop;
+func_410270(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 76);
+// bdead 40001001 gp = MEM_U32(sp + 48);
+//nop;
+if (t3 == 0) goto L410e40;
+a2 = 0x10009b28;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = 0x10009728;
+a1 = 0x10009b30;
+a2 = a2 + 0x1;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 48);
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L410e60;
+L410e40:
+//nop;
+a0 = 0x10009728;
+a1 = 0x10009b30;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 48);
+//nop;
+L410e5c:
+// bdead 1 ra = MEM_U32(sp + 52);
+L410e60:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x68;
+return;
+}
+
+static uint32_t func_410e80(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L410e80:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbb0;
+// fdead 400001cb MEM_U32(sp + 28) = s2;
+s2 = 0x1000a7d4;
+//nop;
+// fdead 400801cb MEM_U32(sp + 52) = ra;
+a0 = MEM_U32(s2 + 0);
+// fdead 400801eb MEM_U32(sp + 48) = gp;
+// fdead 400801eb MEM_U32(sp + 44) = s6;
+// fdead 400801eb MEM_U32(sp + 40) = s5;
+// fdead 400801eb MEM_U32(sp + 36) = s4;
+// fdead 400801eb MEM_U32(sp + 32) = s3;
+// fdead 400801eb MEM_U32(sp + 24) = s1;
+// fdead 400801eb MEM_U32(sp + 20) = s0;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4008010b gp = MEM_U32(sp + 48);
+s5 = 0x20;
+a0 = v0 & 0xff;
+v1 = a0;
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410ee8;
+s4 = 0x9;
+at = 0x6c;
+if (s4 != a0) goto L410f18;
+L410ee8:
+//nop;
+a0 = MEM_U32(s2 + 0);
+s4 = 0x9;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+a0 = v0 & 0xff;
+v1 = a0;
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410ee8;
+//nop;
+if (s4 == s0) goto L410ee8;
+at = 0x6c;
+L410f18:
+//nop;
+if (v1 != at) goto L411014;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+t6 = v0 & 0xff;
+at = 0x69;
+//nop;
+if (t6 != at) goto L410f8c;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+t7 = v0 & 0xff;
+at = 0x6e;
+//nop;
+if (t7 != at) goto L410f8c;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+t8 = v0 & 0xff;
+at = 0x65;
+//nop;
+if (t8 == at) goto L410fc4;
+L410f8c:
+a0 = 0x100065d8;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+//nop;
+L410fc4:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+a0 = v0 & 0xff;
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410fec;
+//nop;
+if (s4 != a0) goto L411014;
+L410fec:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 4068010b gp = MEM_U32(sp + 48);
+a0 = v0 & 0xff;
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410fec;
+//nop;
+if (s4 == s0) goto L410fec;
+L411014:
+s1 = 0xfb504f0;
+a1 = zero;
+t9 = s1 + a0;
+t0 = MEM_U8(t9 + 1);
+//nop;
+t1 = t0 & 0x4;
+s6 = zero;
+if (t1 != 0) goto L41106c;
+a0 = 0x100065fc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+//nop;
+s6 = zero;
+L41106c:
+s3 = 0xa;
+L411070:
+lo = s6 * s3;
+hi = (uint32_t)((uint64_t)s6 * (uint64_t)s3 >> 32);
+//nop;
+a0 = MEM_U32(s2 + 0);
+t2 = lo;
+s6 = t2 + s0;
+s6 = s6 + 0xffffffd0;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+t3 = s1 + a0;
+t4 = MEM_U8(t3 + 1);
+// bdead 40fc212b gp = MEM_U32(sp + 48);
+t5 = t4 & 0x4;
+s0 = v0 & 0xff;
+if (t5 != 0) goto L411070;
+//nop;
+if (s5 == s0) goto L4110b8;
+v1 = a0;
+if (s4 != a0) goto L4110e0;
+L4110b8:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 40f8010b gp = MEM_U32(sp + 48);
+v1 = v0 & 0xff;
+s0 = v0 & 0xff;
+if (s5 == v1) goto L4110b8;
+//nop;
+if (s4 == s0) goto L4110b8;
+L4110e0:
+at = 0x22;
+a1 = zero;
+if (v1 == at) goto L41110c;
+a0 = 0x10006620;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 48);
+v0 = s0;
+goto L411234;
+L41110c:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 40d8010b gp = MEM_U32(sp + 48);
+a0 = v0 & 0xff;
+at = 0x22;
+s0 = v0 & 0xff;
+s1 = zero;
+if (a0 == at) goto L411198;
+at = (int)s1 < (int)0x400;
+if (s5 == a0) goto L41119c;
+at = 0xff;
+if (s3 == a0) goto L411198;
+s4 = sp + 0x44;
+if (a0 == at) goto L411198;
+at = (int)s1 < (int)0x3ff;
+L411150:
+t6 = s4 + s1;
+if (at == 0) goto L41115c;
+MEM_U8(t6 + 0) = (uint8_t)a0;
+L41115c:
+//nop;
+a0 = MEM_U32(s2 + 0);
+s1 = s1 + 0x1;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 40fc010b gp = MEM_U32(sp + 48);
+a0 = v0 & 0xff;
+at = 0x22;
+s0 = v0 & 0xff;
+if (a0 == at) goto L411198;
+at = 0xff;
+if (s5 == a0) goto L411198;
+//nop;
+if (s3 == a0) goto L411198;
+if (s0 != at) {
+at = (int)s1 < (int)0x3ff;
+goto L411150;}
+at = (int)s1 < (int)0x3ff;
+L411198:
+at = (int)s1 < (int)0x400;
+L41119c:
+s4 = sp + 0x44;
+s3 = s0;
+if (at != 0) goto L4111d0;
+a0 = 0x10006644;
+//nop;
+MEM_U8(sp + 1091) = (uint8_t)zero;
+a1 = s4;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40b80001 gp = MEM_U32(sp + 48);
+//nop;
+goto L4111d8;
+L4111d0:
+t7 = s4 + s1;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+L4111d8:
+t9 = 0x10008ee0;
+at = 0x10009314;
+t9 = MEM_U32(t9 + 0);
+t8 = s6 + 0xfffffffe;
+MEM_U32(at + 0) = t8;
+if (t9 == 0) goto L411208;
+//nop;
+a0 = s4;
+//nop;
+f_make_file(mem, sp, a0);
+// bdead 40180001 gp = MEM_U32(sp + 48);
+//nop;
+L411208:
+at = 0x22;
+v1 = s3;
+if (s3 != at) goto L411230;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 9 gp = MEM_U32(sp + 48);
+v1 = v0;
+goto L411230;
+L411230:
+v0 = v1 & 0xff;
+L411234:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x450;
+return v0;
+}
+
+static void f_readinline(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L41125c:
+//readinline:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffb90;
+at = 0x10009f30;
+// fdead 4000010f MEM_U32(sp + 32) = s2;
+// fdead 4000010f MEM_U32(sp + 36) = s3;
+// fdead 4000010f MEM_U32(sp + 28) = s1;
+// fdead 4000010f MEM_U32(sp + 24) = s0;
+s2 = 0x1000a7d4;
+// fdead 4008010f MEM_U32(sp + 44) = ra;
+// fdead 4008010f MEM_U32(sp + 40) = gp;
+s0 = zero;
+a2 = 0x20;
+t0 = 0x1;
+a1 = zero;
+s1 = 0xa;
+s3 = 0xff;
+MEM_U32(at + 0) = zero;
+L4112a8:
+//nop;
+a0 = MEM_U32(s2 + 0);
+MEM_U32(sp + 1128) = a1;
+MEM_U8(sp + 1134) = (uint8_t)a2;
+MEM_U32(sp + 60) = t0;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 401e000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 1128);
+a2 = MEM_U8(sp + 1134);
+t0 = MEM_U32(sp + 60);
+v1 = v0 & 0xff;
+at = 0x9;
+a3 = v0 & 0xff;
+if (v1 == at) goto L4112ec;
+at = 0xc;
+if (v1 != at) {
+at = 0x22;
+goto L4112f8;}
+at = 0x22;
+L4112ec:
+a3 = 0x20;
+goto L411344;
+at = 0x22;
+L4112f8:
+if (v1 != at) {
+at = 0x5c;
+goto L411310;}
+at = 0x5c;
+t6 = t0 < 0x1;
+if (a2 == at) goto L411310;
+t0 = t6;
+goto L411344;
+L411310:
+//nop;
+if (s1 == v1) goto L411320;
+//nop;
+if (s3 != v1) goto L411328;
+L411320:
+a1 = 0x1;
+goto L411344;
+L411328:
+at = 0x3b;
+if (t0 == 0) goto L411344;
+if (v1 == at) {
+at = 0x23;
+goto L411340;}
+at = 0x23;
+//nop;
+if (v1 != at) goto L411344;
+L411340:
+a1 = 0x1;
+L411344:
+a2 = a3 & 0xff;
+if (a1 != 0) goto L411364;
+t7 = sp + 0x40;
+if ((int)s0 >= (int)0x41f) goto L411360;
+t8 = s0 + t7;
+MEM_U8(t8 + 0) = (uint8_t)a3;
+L411360:
+s0 = s0 + 0x1;
+L411364:
+//nop;
+if (a1 == 0) goto L4112a8;
+at = 0x23;
+v1 = a3;
+if (a3 != at) goto L4113a0;
+at = 0x3b;
+if (s0 != 0) goto L4113a4;
+//nop;
+//nop;
+// fdead 621f83df t9 = t9;
+//nop;
+v0 = func_410e80(mem, sp);
+a3 = v0 & 0xff;
+// bdead 401e0103 gp = MEM_U32(sp + 40);
+v1 = a3;
+L4113a0:
+at = 0x3b;
+L4113a4:
+t3 = 0x1;
+if (v1 == at) goto L4113b4;
+//nop;
+if (s3 != v1) goto L4113f0;
+L4113b4:
+v1 = 0x1000a810;
+//nop;
+v1 = v1;
+t9 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (t9 != 0) goto L4113e8;
+v0 = 0x10009314;
+//nop;
+t1 = MEM_U32(v0 + 0);
+//nop;
+t2 = t1 + 0x1;
+MEM_U32(v0 + 0) = t2;
+L4113e8:
+MEM_U32(v1 + 0) = t3;
+goto L411484;
+L4113f0:
+//nop;
+if (s1 == v1) goto L411428;
+//nop;
+if (s3 == v1) goto L411428;
+L411400:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 401e000b gp = MEM_U32(sp + 40);
+t4 = v0 & 0xff;
+a3 = v0 & 0xff;
+if (s1 == t4) goto L411428;
+//nop;
+if (s3 != a3) goto L411400;
+L411428:
+t5 = 0x10008ee0;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L411474;
+v1 = 0x1000a810;
+//nop;
+v1 = v1;
+t6 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L411474;
+v0 = 0x10009314;
+//nop;
+t7 = MEM_U32(v0 + 0);
+//nop;
+t8 = t7 + 0x1;
+MEM_U32(v0 + 0) = t8;
+L411474:
+v1 = 0x1000a810;
+//nop;
+v1 = v1;
+MEM_U32(v1 + 0) = zero;
+L411484:
+a1 = zero;
+if ((int)s0 < (int)0x420) goto L4114b8;
+a0 = 0x10006668;
+//nop;
+s0 = 0x41f;
+a2 = 0x2;
+MEM_U8(sp + 1135) = (uint8_t)a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40120003 gp = MEM_U32(sp + 40);
+a3 = MEM_U8(sp + 1135);
+//nop;
+L4114b8:
+t9 = sp + 0x40;
+t1 = s0 + t9;
+MEM_U8(t1 + 0) = (uint8_t)zero;
+//nop;
+a0 = 0x10008ef0;
+MEM_U8(sp + 1135) = (uint8_t)a3;
+a1 = sp + 0x40;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40120003 gp = MEM_U32(sp + 40);
+a3 = MEM_U8(sp + 1135);
+v1 = 0x10008ee8;
+MEM_U32(v1 + 0) = s0;
+if (s0 != 0) goto L41150c;
+//nop;
+if (s3 == a3) goto L41150c;
+//nop;
+//nop;
+//nop;
+f_readinline(mem, sp);
+// bdead 3 gp = MEM_U32(sp + 40);
+//nop;
+L41150c:
+at = 0x10008eec;
+// bdead 7 ra = MEM_U32(sp + 44);
+// bdead 7 s0 = MEM_U32(sp + 24);
+// bdead 7 s1 = MEM_U32(sp + 28);
+// bdead 7 s2 = MEM_U32(sp + 32);
+// bdead 7 s3 = MEM_U32(sp + 36);
+// bdead 7 sp = sp + 0x470;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static uint32_t f_alloc_new_sym(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L411530:
+//alloc_new_sym:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+a0 = 0x1c;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L41157c;
+//nop;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+goto L41159c;
+L41157c:
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = zero;
+a2 = 0x1c;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L41159c:
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_alloc_new_string(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L4115a8:
+//alloc_new_string:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+if (v0 != 0) goto L411608;
+//nop;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L411608:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_EnterSym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L411630:
+//EnterSym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 52) = a1;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 56) = a2;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 44);
+if (v0 != 0) goto L411728;
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+t8 = 0x10009fb8;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(sp + 44) = v0;
+MEM_U32(v0 + 0) = t9;
+//nop;
+a0 = MEM_U32(sp + 48);
+MEM_U32(sp + 36) = v1;
+v0 = f_alloc_new_string(mem, sp, a0);
+t0 = MEM_U32(sp + 44);
+// bdead 4000038b gp = MEM_U32(sp + 24);
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+t1 = 0x3;
+MEM_U32(t2 + 16) = t1;
+t3 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t3 + 8) = zero;
+t4 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t4 + 20) = zero;
+//nop;
+a1 = MEM_U32(sp + 56);
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_sym_enter(mem, sp, a0, a1);
+t5 = MEM_U32(sp + 44);
+// bdead 40004109 gp = MEM_U32(sp + 24);
+MEM_U32(t5 + 24) = v0;
+t7 = MEM_U32(sp + 36);
+t6 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(t7 + 0) = t6;
+t8 = MEM_U32(sp + 44);
+L411728:
+at = 0x3;
+t9 = MEM_U32(t8 + 16);
+a2 = 0x1;
+t0 = MEM_U32(sp + 44);
+if (t9 == at) goto L41175c;
+a0 = 0x10006678;
+//nop;
+a1 = 0x10009728;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+t0 = MEM_U32(sp + 44);
+L41175c:
+t1 = MEM_U32(sp + 52);
+//nop;
+MEM_U32(t1 + 0) = t0;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static uint32_t f_GetRegister(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L411778:
+//GetRegister:
+//nop;
+//nop;
+//nop;
+t6 = 0x10009720;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(t6 + 0);
+at = 0x69;
+// fdead 400080ef MEM_U32(sp + 28) = ra;
+// fdead 400080ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = zero;
+if (t6 == at) goto L4117c8;
+a0 = 0x10006690;
+//nop;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L411840;
+L4117c8:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+t7 = MEM_U32(sp + 36);
+a1 = 0x10009728;
+//nop;
+if (v0 != 0) goto L41180c;
+a0 = 0x100066a4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L411840;
+L41180c:
+t8 = MEM_U32(t7 + 16);
+t9 = MEM_U32(sp + 36);
+//nop;
+if (t8 == 0) goto L41183c;
+a0 = 0x100066b8;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L411840;
+L41183c:
+MEM_U32(sp + 32) = t9;
+L411840:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t0 = 0x10009720;
+//nop;
+t0 = MEM_U8(t0 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t0 != at) goto L41188c;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L41188c:
+v0 = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t func_411898(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L411898:
+//nop;
+//nop;
+//nop;
+v1 = 0x10009720;
+sp = sp + 0xffffffc0;
+v1 = MEM_U8(v1 + 0);
+at = 0x2d;
+// fdead 400001ff MEM_U32(sp + 28) = ra;
+// fdead 400001ff MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = zero;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 56) = zero;
+if (v1 != at) goto L4118f8;
+//nop;
+t6 = 0x1;
+MEM_U32(sp + 60) = t6;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+at = 0x22;
+goto L411968;
+L4118f8:
+at = 0x2b;
+if (v1 != at) {
+at = 0x7e;
+goto L411934;}
+at = 0x7e;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+at = 0x22;
+goto L411968;
+at = 0x7e;
+L411934:
+if (v1 != at) {
+at = 0x22;
+goto L411968;}
+at = 0x22;
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 56) = t7;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+at = 0x22;
+L411968:
+if (v1 == at) {
+at = 0x28;
+goto L411ab0;}
+at = 0x28;
+if (v1 == at) {
+at = 0x64;
+goto L411998;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L411a8c;}
+at = 0x68;
+if (v1 == at) {
+at = 0x69;
+goto L411a8c;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L411a04;
+//nop;
+goto L411af4;
+L411998:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+v0 = func_41244c(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x29;
+t8 = 0x10009720;
+MEM_U32(sp + 52) = v0;
+t8 = MEM_U8(t8 + 0);
+a1 = zero;
+t5 = MEM_U32(sp + 60);
+if (t8 == at) goto L411b2c;
+a0 = 0x100066cc;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 60);
+goto L411b2c;
+L411a04:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x30;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 48);
+a3 = 0x10009728;
+a1 = zero;
+if (v0 != 0) goto L411a48;
+a0 = 0x100066e4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 60);
+goto L411b2c;
+L411a48:
+t0 = MEM_U32(t9 + 16);
+at = 0x4;
+a1 = a3;
+if (t0 == at) goto L411a78;
+a0 = 0x10006704;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 60);
+goto L411b2c;
+L411a78:
+t1 = MEM_U32(sp + 48);
+//nop;
+t2 = MEM_U32(t1 + 8);
+MEM_U32(sp + 52) = t2;
+goto L411b28;
+L411a8c:
+//nop;
+a0 = 0x10009728;
+a1 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+MEM_U32(sp + 60) = zero;
+v0 = func_40f5d8(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 52) = v0;
+goto L411b28;
+L411ab0:
+t4 = 0x10009b28;
+a3 = 0x10009728;
+t4 = MEM_U32(t4 + 0);
+t3 = MEM_U8(a3 + 0);
+at = (int)t4 < (int)0x2;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 52) = t3;
+if (at != 0) goto L411b28;
+a0 = 0x10006724;
+//nop;
+a1 = a3;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 60);
+goto L411b2c;
+L411af4:
+a0 = 0x1000675c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L411b28:
+t5 = MEM_U32(sp + 60);
+L411b2c:
+t6 = MEM_U32(sp + 56);
+//nop;
+if (t5 == 0) goto L411b44;
+v1 = MEM_U32(sp + 52);
+v1 = -v1;
+goto L411b60;
+L411b44:
+v1 = MEM_U32(sp + 52);
+if (t6 == 0) goto L411b5c;
+v1 = MEM_U32(sp + 52);
+v1 = ~v1;
+goto L411b60;
+// fdead 0 v1 = MEM_U32(sp + 52);
+L411b5c:
+//nop;
+L411b60:
+//nop;
+MEM_U32(sp + 44) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint64_t func_411b84(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L411b84:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+v1 = 0x10009720;
+t6 = 0x0;
+v1 = MEM_U8(v1 + 0);
+t7 = 0x0;
+at = 0x2d;
+// fdead 400181ff MEM_U32(sp + 28) = ra;
+// fdead 400181ff MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 60) = t7;
+MEM_U32(sp + 56) = t6;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 64) = zero;
+if (v1 != at) goto L411bf0;
+//nop;
+t8 = 0x1;
+MEM_U32(sp + 68) = t8;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+at = 0x22;
+goto L411c64;
+L411bf0:
+at = 0x2b;
+if (v1 != at) {
+at = 0x7e;
+goto L411c2c;}
+at = 0x7e;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+at = 0x22;
+goto L411c64;
+at = 0x7e;
+L411c2c:
+t9 = 0x1;
+if (v1 != at) goto L411c60;
+MEM_U32(sp + 64) = t9;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10009720;
+//nop;
+v1 = MEM_U8(v1 + 0);
+//nop;
+L411c60:
+at = 0x22;
+L411c64:
+t8 = 0x0;
+if (v1 == at) goto L411dc0;
+at = 0x28;
+if (v1 == at) {
+at = 0x64;
+goto L411c98;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L411d98;}
+at = 0x68;
+if (v1 == at) {
+at = 0x69;
+goto L411d98;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L411d04;
+//nop;
+goto L411e08;
+L411c98:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+temp64 = func_412548(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000011b gp = MEM_U32(sp + 24);
+at = 0x29;
+t0 = 0x10009720;
+MEM_U32(sp + 56) = v0;
+t0 = MEM_U8(t0 + 0);
+MEM_U32(sp + 60) = v1;
+a1 = zero;
+if (t0 == at) goto L411e3c;
+a0 = 0x1000677c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 68);
+goto L411e40;
+L411d04:
+//nop;
+a0 = 0x10009728;
+a1 = sp + 0x34;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 52);
+a3 = 0x10009728;
+a1 = zero;
+if (v0 != 0) goto L411d48;
+a0 = 0x10006794;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 68);
+goto L411e40;
+L411d48:
+t2 = MEM_U32(t1 + 16);
+at = 0x4;
+a1 = a3;
+if (t2 == at) goto L411d78;
+a0 = 0x100067b4;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 68);
+goto L411e40;
+L411d78:
+t3 = MEM_U32(sp + 52);
+//nop;
+t4 = MEM_U32(t3 + 8);
+//nop;
+t6 = (int)t4 >> 31;
+MEM_U32(sp + 56) = t6;
+MEM_U32(sp + 60) = t4;
+goto L411e3c;
+L411d98:
+//nop;
+a0 = 0x10009728;
+a1 = MEM_U32(sp + 68);
+// bdead 40000063 t9 = t9;
+MEM_U32(sp + 68) = zero;
+temp64 = func_40f77c(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L411e3c;
+L411dc0:
+t0 = 0x10009b28;
+a3 = 0x10009728;
+t0 = MEM_U32(t0 + 0);
+t5 = MEM_U8(a3 + 0);
+at = (int)t0 < (int)0x2;
+MEM_U32(sp + 56) = t8;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 60) = t5;
+if (at != 0) goto L411e3c;
+a0 = 0x100067d4;
+//nop;
+a1 = a3;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 68);
+goto L411e40;
+L411e08:
+a0 = 0x1000680c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L411e3c:
+t1 = MEM_U32(sp + 68);
+L411e40:
+t6 = MEM_U32(sp + 64);
+//nop;
+if (t1 == 0) goto L411e70;
+t2 = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 60);
+t4 = ~t2;
+at = t3 < 0x1;
+t4 = t4 + at;
+t5 = -t3;
+MEM_U32(sp + 44) = t5;
+MEM_U32(sp + 40) = t4;
+goto L411ea4;
+L411e70:
+t2 = MEM_U32(sp + 56);
+if (t6 == 0) goto L411e98;
+t8 = MEM_U32(sp + 56);
+t9 = MEM_U32(sp + 60);
+t0 = ~t8;
+t1 = ~t9;
+MEM_U32(sp + 44) = t1;
+MEM_U32(sp + 40) = t0;
+goto L411ea4;
+// fdead 0 t2 = MEM_U32(sp + 56);
+L411e98:
+t3 = MEM_U32(sp + 60);
+MEM_U32(sp + 40) = t2;
+MEM_U32(sp + 44) = t3;
+L411ea4:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 44);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_411ecc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, fp = 0, lo = 0, hi = 0;
+L411ecc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 60) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 56) = fp;
+// fdead 400001eb MEM_U32(sp + 52) = gp;
+// fdead 400001eb MEM_U32(sp + 48) = s7;
+// fdead 400001eb MEM_U32(sp + 44) = s6;
+// fdead 400001eb MEM_U32(sp + 40) = s5;
+// fdead 400001eb MEM_U32(sp + 36) = s4;
+// fdead 400001eb MEM_U32(sp + 32) = s3;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+v0 = func_411898(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 52);
+at = 0x2a;
+a0 = 0x10009720;
+s2 = v0;
+a0 = MEM_U8(a0 + 0);
+s6 = 0x2f;
+v1 = a0;
+if (a0 == at) goto L411f6c;
+s7 = 0x25;
+if (s6 == v1) goto L411f6c;
+fp = 0x3c;
+if (s7 == v1) goto L411f6c;
+at = 0x3e;
+if (fp == v1) goto L411f6c;
+s3 = 0x5e;
+if (v1 == at) goto L411f6c;
+s5 = 0x26;
+if (s3 == v1) goto L411f6c;
+s4 = 0x7c;
+if (s5 == v1) goto L411f6c;
+// bdead 40080121 ra = MEM_U32(sp + 60);
+if (s4 != v1) goto L41210c;
+L411f6c:
+//nop;
+s3 = 0x5e;
+s4 = 0x7c;
+s5 = 0x26;
+s6 = 0x2f;
+s7 = 0x25;
+fp = 0x3c;
+s0 = s2;
+s1 = a0 & 0xff;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0101 gp = MEM_U32(sp + 52);
+//nop;
+//nop;
+//nop;
+// fdead 7e1fe001f t9 = t9;
+//nop;
+v0 = func_411898(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0109 gp = MEM_U32(sp + 52);
+v1 = s1;
+if ((int)s1 < (int)0x5f) goto L411fd0;
+//nop;
+if (v1 == s4) goto L4120b0;
+//nop;
+goto L4120b4;
+L411fd0:
+t6 = v1 + 0xffffffdb;
+if ((int)v1 < (int)0x3f) goto L411fec;
+//nop;
+if (v1 == s3) goto L4120a0;
+//nop;
+goto L4120b4;
+L411fec:
+//nop;
+if (t6 >= 0x1a) goto L4120b4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L41205c;
+case 1: goto L4120a8;
+case 2: goto L4120b4;
+case 3: goto L4120b4;
+case 4: goto L4120b4;
+case 5: goto L412018;
+case 6: goto L4120b4;
+case 7: goto L4120b4;
+case 8: goto L4120b4;
+case 9: goto L4120b4;
+case 10: goto L412028;
+case 11: goto L4120b4;
+case 12: goto L4120b4;
+case 13: goto L4120b4;
+case 14: goto L4120b4;
+case 15: goto L4120b4;
+case 16: goto L4120b4;
+case 17: goto L4120b4;
+case 18: goto L4120b4;
+case 19: goto L4120b4;
+case 20: goto L4120b4;
+case 21: goto L4120b4;
+case 22: goto L4120b4;
+case 23: goto L412090;
+case 24: goto L4120b4;
+case 25: goto L412098;
+}
+L412018:
+lo = s0 * v0;
+hi = (uint32_t)((uint64_t)s0 * (uint64_t)v0 >> 32);
+s2 = lo;
+//nop;
+goto L4120b4;
+L412028:
+lo = (int)s0 / (int)v0; hi = (int)s0 % (int)v0;
+//nop;
+if (v0 != 0) goto L412038;
+abort();
+L412038:
+at = 0xffffffff;
+if (v0 != at) {
+at = 0x80000000;
+goto L412050;}
+at = 0x80000000;
+//nop;
+if (s0 != at) goto L412050;
+abort();
+L412050:
+s2 = lo;
+//nop;
+goto L4120b4;
+L41205c:
+lo = (int)s0 / (int)v0; hi = (int)s0 % (int)v0;
+//nop;
+if (v0 != 0) goto L41206c;
+abort();
+L41206c:
+at = 0xffffffff;
+if (v0 != at) {
+at = 0x80000000;
+goto L412084;}
+at = 0x80000000;
+//nop;
+if (s0 != at) goto L412084;
+abort();
+L412084:
+s2 = hi;
+//nop;
+goto L4120b4;
+L412090:
+s2 = s0 << (v0 & 0x1f);
+goto L4120b4;
+L412098:
+s2 = s0 >> (v0 & 0x1f);
+goto L4120b4;
+L4120a0:
+s2 = s0 ^ v0;
+goto L4120b4;
+L4120a8:
+s2 = s0 & v0;
+goto L4120b4;
+L4120b0:
+s2 = s0 | v0;
+L4120b4:
+a0 = 0x10009720;
+at = 0x2a;
+a0 = MEM_U8(a0 + 0);
+//nop;
+v1 = a0;
+if (a0 == at) goto L411f6c;
+//nop;
+if (s6 == v1) goto L411f6c;
+//nop;
+if (s7 == v1) goto L411f6c;
+//nop;
+if (fp == v1) goto L411f6c;
+at = 0x3e;
+//nop;
+if (v1 == at) goto L411f6c;
+//nop;
+if (s3 == v1) goto L411f6c;
+//nop;
+if (s5 == v1) goto L411f6c;
+//nop;
+if (s4 == v1) goto L411f6c;
+// bdead 80001 ra = MEM_U32(sp + 60);
+L41210c:
+v0 = s2;
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static void func_41213c(uint8_t *mem, uint32_t sp) {
+L41213c:
+//nop;
+return;
+}
+
+static uint64_t func_412144(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L412144:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+temp64 = func_411b84(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+//nop;
+MEM_U32(sp + 60) = v1;
+// fdead 6000001b t9 = t9;
+//nop;
+func_41213c(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+at = 0x2a;
+a1 = 0x10009720;
+//nop;
+a1 = MEM_U8(a1 + 0);
+//nop;
+a0 = a1;
+if (a1 == at) goto L4121ec;
+at = 0x2f;
+if (a0 == at) {
+at = 0x25;
+goto L4121ec;}
+at = 0x25;
+if (a0 == at) {
+at = 0x3c;
+goto L4121ec;}
+at = 0x3c;
+if (a0 == at) {
+at = 0x3e;
+goto L4121ec;}
+at = 0x3e;
+s2 = 0x5e;
+if (a0 == at) goto L4121ec;
+at = 0x26;
+if (s2 == a0) goto L4121ec;
+s1 = 0x7c;
+if (a0 == at) goto L4121ec;
+// bdead 40000141 ra = MEM_U32(sp + 36);
+if (s1 != a0) goto L412430;
+L4121ec:
+t6 = MEM_U32(sp + 56);
+L4121f0:
+t7 = MEM_U32(sp + 60);
+//nop;
+s1 = 0x7c;
+s2 = 0x5e;
+s0 = a1 & 0xff;
+MEM_U32(sp + 48) = t6;
+MEM_U32(sp + 52) = t7;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 400e0101 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+// fdead 1600e001f t9 = t9;
+//nop;
+temp64 = func_411b84(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0119 gp = MEM_U32(sp + 32);
+at = (int)s0 < (int)0x5f;
+MEM_U32(sp + 40) = v0;
+MEM_U32(sp + 44) = v1;
+a0 = s0;
+if (at != 0) goto L412254;
+t8 = MEM_U32(sp + 48);
+if (s0 == s1) goto L4123b4;
+//nop;
+goto L4123c8;
+L412254:
+t8 = a0 + 0xffffffdb;
+if ((int)a0 < (int)0x3f) goto L412270;
+t0 = MEM_U32(sp + 48);
+if (a0 == s2) goto L41237c;
+//nop;
+goto L4123c8;
+L412270:
+//nop;
+if (t8 >= 0x1a) goto L4123c8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L4122f4;
+case 1: goto L412394;
+case 2: goto L4123c8;
+case 3: goto L4123c8;
+case 4: goto L4123c8;
+case 5: goto L41229c;
+case 6: goto L4123c8;
+case 7: goto L4123c8;
+case 8: goto L4123c8;
+case 9: goto L4123c8;
+case 10: goto L4122c8;
+case 11: goto L4123c8;
+case 12: goto L4123c8;
+case 13: goto L4123c8;
+case 14: goto L4123c8;
+case 15: goto L4123c8;
+case 16: goto L4123c8;
+case 17: goto L4123c8;
+case 18: goto L4123c8;
+case 19: goto L4123c8;
+case 20: goto L4123c8;
+case 21: goto L4123c8;
+case 22: goto L4123c8;
+case 23: goto L412320;
+case 24: goto L4123c8;
+case 25: goto L41234c;
+}
+L41229c:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+//nop;
+temp64 = wrapper___ll_mul((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4123c8;
+L4122c8:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+//nop;
+temp64 = wrapper___ll_div((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4123c8;
+L4122f4:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+//nop;
+temp64 = wrapper___ll_rem((((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4123c8;
+L412320:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+//nop;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4123c8;
+L41234c:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4123c8;
+// fdead 0 t0 = MEM_U32(sp + 48);
+L41237c:
+t1 = MEM_U32(sp + 52);
+t2 = t0 ^ v0;
+t3 = t1 ^ v1;
+MEM_U32(sp + 60) = t3;
+MEM_U32(sp + 56) = t2;
+goto L4123c8;
+L412394:
+t4 = MEM_U32(sp + 48);
+t5 = MEM_U32(sp + 52);
+t6 = t4 & v0;
+t7 = t5 & v1;
+MEM_U32(sp + 60) = t7;
+MEM_U32(sp + 56) = t6;
+goto L4123c8;
+// fdead 0 t8 = MEM_U32(sp + 48);
+L4123b4:
+t9 = MEM_U32(sp + 52);
+t0 = t8 | v0;
+t1 = t9 | v1;
+MEM_U32(sp + 60) = t1;
+MEM_U32(sp + 56) = t0;
+L4123c8:
+a1 = 0x10009720;
+at = 0x2a;
+a1 = MEM_U8(a1 + 0);
+//nop;
+a0 = a1;
+if (a1 == at) goto L4121ec;
+at = 0x2f;
+t6 = MEM_U32(sp + 56);
+if (a0 == at) goto L4121f0;
+at = 0x25;
+t6 = MEM_U32(sp + 56);
+if (a0 == at) goto L4121f0;
+at = 0x3c;
+t6 = MEM_U32(sp + 56);
+if (a0 == at) goto L4121f0;
+at = 0x3e;
+t6 = MEM_U32(sp + 56);
+if (a0 == at) goto L4121f0;
+t6 = MEM_U32(sp + 56);
+if (s2 == a0) goto L4121f0;
+at = 0x26;
+t6 = MEM_U32(sp + 56);
+if (a0 == at) goto L4121f0;
+t6 = MEM_U32(sp + 56);
+if (s1 == a0) goto L4121f0;
+// bdead 40000001 ra = MEM_U32(sp + 36);
+L412430:
+v0 = MEM_U32(sp + 56);
+v1 = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_41244c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+L41244c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 52) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 48) = gp;
+// fdead 400001eb MEM_U32(sp + 44) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s4;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+v0 = func_411ecc(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 48);
+s3 = 0x2b;
+s5 = 0x10009720;
+s2 = v0;
+a0 = MEM_U8(s5 + 0);
+s4 = 0x2d;
+v1 = a0;
+if (s3 == a0) goto L4124b0;
+// bdead 40580121 ra = MEM_U32(sp + 52);
+if (s4 != v1) goto L412524;
+L4124b0:
+//nop;
+s4 = 0x2d;
+s0 = s2;
+s1 = a0 & 0xff;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 407e0101 gp = MEM_U32(sp + 48);
+//nop;
+//nop;
+//nop;
+// fdead 1607e001b t9 = t9;
+//nop;
+v0 = func_411ecc(mem, sp, a0, a1, a2, a3);
+// bdead 407e0109 gp = MEM_U32(sp + 48);
+//nop;
+if (s3 == s1) goto L4124fc;
+//nop;
+if (s1 == s4) goto L412504;
+a0 = MEM_U8(s5 + 0);
+goto L41250c;
+L4124fc:
+s2 = s0 + v0;
+goto L412508;
+L412504:
+s2 = s0 - v0;
+L412508:
+a0 = MEM_U8(s5 + 0);
+L41250c:
+//nop;
+v1 = a0;
+if (s3 == a0) goto L4124b0;
+//nop;
+if (s4 == v1) goto L4124b0;
+// bdead 80001 ra = MEM_U32(sp + 52);
+L412524:
+v0 = s2;
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint64_t func_412548(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L412548:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+temp64 = func_412144(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 56) = v0;
+//nop;
+MEM_U32(sp + 60) = v1;
+// fdead 6000001b t9 = t9;
+//nop;
+func_41213c(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+s1 = 0x2b;
+s3 = 0x10009720;
+s2 = 0x2d;
+a1 = MEM_U8(s3 + 0);
+//nop;
+a0 = a1;
+if (s1 == a1) goto L4125c0;
+// bdead 40140141 ra = MEM_U32(sp + 44);
+if (s2 != a0) goto L412678;
+L4125c0:
+t6 = MEM_U32(sp + 56);
+L4125c4:
+t7 = MEM_U32(sp + 60);
+//nop;
+s2 = 0x2d;
+s0 = a1 & 0xff;
+MEM_U32(sp + 48) = t6;
+MEM_U32(sp + 52) = t7;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 401e0101 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+// fdead 1601e001f t9 = t9;
+//nop;
+temp64 = func_412144(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401e0119 gp = MEM_U32(sp + 40);
+//nop;
+if (s1 == s0) goto L412618;
+t2 = MEM_U32(sp + 48);
+if (s0 == s2) goto L412640;
+a1 = MEM_U8(s3 + 0);
+goto L412660;
+L412618:
+t9 = MEM_U32(sp + 52);
+t8 = MEM_U32(sp + 48);
+t1 = t9 + v1;
+at = t1 < v1;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(sp + 56) = t0;
+MEM_U32(sp + 60) = t1;
+goto L41265c;
+// fdead 0 t2 = MEM_U32(sp + 48);
+L412640:
+t3 = MEM_U32(sp + 52);
+t4 = t2 - v0;
+at = t3 < v1;
+t4 = t4 - at;
+t5 = t3 - v1;
+MEM_U32(sp + 60) = t5;
+MEM_U32(sp + 56) = t4;
+L41265c:
+a1 = MEM_U8(s3 + 0);
+L412660:
+//nop;
+a0 = a1;
+if (s1 == a1) goto L4125c0;
+t6 = MEM_U32(sp + 56);
+if (s2 == a0) goto L4125c4;
+// bdead 40000001 ra = MEM_U32(sp + 44);
+L412678:
+v0 = MEM_U32(sp + 56);
+v1 = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0;
+L412698:
+//GetExpr:
+//nop;
+//nop;
+//nop;
+v0 = 0x10009720;
+sp = sp + 0xffffffd8;
+v0 = MEM_U8(v0 + 0);
+at = 0x69;
+// fdead 400001ef MEM_U32(sp + 28) = ra;
+// fdead 400001ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = zero;
+if (v0 == at) goto L412700;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L412700;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L412700;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L412700;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L412700;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L412700;}
+at = 0x28;
+if (v0 == at) {
+at = 0x22;
+goto L412700;}
+at = 0x22;
+a1 = zero;
+if (v0 != at) goto L412750;
+L412700:
+//nop;
+//nop;
+// fdead 400001ef t9 = t9;
+//nop;
+v0 = func_41244c(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t6 = 0x10009720;
+MEM_U32(sp + 36) = v0;
+t6 = MEM_U8(t6 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t6 != at) goto L412788;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+goto L412788;
+L412750:
+a0 = 0x1000682c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L412788:
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_dw_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0, t8 = 0;
+uint64_t temp64;
+L412794:
+//dw_GetExpr:
+//nop;
+//nop;
+//nop;
+v0 = 0x10009720;
+sp = sp + 0xffffffd8;
+v0 = MEM_U8(v0 + 0);
+at = 0x69;
+// fdead 400001ef MEM_U32(sp + 28) = ra;
+// fdead 400001ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+if (v0 == at) goto L412800;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L412800;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L412800;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L412800;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L412800;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L412800;}
+at = 0x28;
+if (v0 == at) {
+at = 0x22;
+goto L412800;}
+at = 0x22;
+a1 = zero;
+if (v0 != at) goto L41286c;
+L412800:
+//nop;
+//nop;
+// fdead 400001ef t9 = t9;
+//nop;
+temp64 = func_412548(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000001b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+MEM_U32(sp + 36) = v1;
+// fdead 6000001f t9 = t9;
+//nop;
+func_41213c(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t6 = 0x10009720;
+//nop;
+t6 = MEM_U8(t6 + 0);
+//nop;
+//nop;
+if (t6 != at) goto L4128a0;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+goto L4128a0;
+L41286c:
+a0 = 0x1000684c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L4128a0:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U32(sp + 40);
+// bdead 42000013 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 0) = v1;
+t2 = MEM_U32(sp + 44);
+t1 = MEM_U32(sp + 36);
+//nop;
+MEM_U32(t2 + 0) = t1;
+a0 = MEM_U32(t8 + 0);
+// bdead 423 ra = MEM_U32(sp + 28);
+v0 = zero < a0;
+// bdead 42b t9 = t1;
+if (v0 == 0) goto L4128fc;
+v0 = a0 + 0x1;
+v0 = zero < v0;
+t3 = (int)t1 < (int)0x0;
+if (v0 != 0) goto L4128fc;
+v0 = t3 ^ 0x1;
+L4128fc:
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_GetBaseOrExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L412904:
+//GetBaseOrExpr:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+t7 = 0x10009720;
+// fdead 400100eb MEM_U32(sp + 28) = ra;
+// fdead 400100eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(a0 + 0) = zero;
+t7 = MEM_U8(t7 + 0);
+at = 0x28;
+//nop;
+if (t7 != at) goto L412a28;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+at = 0x69;
+t8 = 0x10009720;
+a1 = MEM_U32(sp + 32);
+t8 = MEM_U8(t8 + 0);
+//nop;
+//nop;
+if (t8 != at) goto L412a10;
+//nop;
+a0 = 0x10009728;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L412a10;
+t9 = MEM_U32(sp + 32);
+//nop;
+t0 = MEM_U32(t9 + 0);
+//nop;
+t1 = MEM_U32(t0 + 16);
+//nop;
+//nop;
+if (t1 != 0) goto L412a10;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x29;
+t2 = 0x10009720;
+a1 = zero;
+t2 = MEM_U8(t2 + 0);
+//nop;
+//nop;
+if (t2 == at) goto L4129f4;
+a0 = 0x1000686c;
+//nop;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L4129f4:
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412a48;
+L412a10:
+//nop;
+a0 = 0x28;
+//nop;
+f_unscan(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L412a28:
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 36);
+// bdead 1009 gp = MEM_U32(sp + 24);
+MEM_U32(t3 + 0) = v0;
+// bdead 1 ra = MEM_U32(sp + 28);
+L412a48:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L412a54:
+//GetItem:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+t7 = 0x10009720;
+MEM_U32(t6 + 0) = v0;
+t7 = MEM_U8(t7 + 0);
+at = 0x3a;
+t0 = MEM_U32(sp + 36);
+if (t7 != at) goto L412ad8;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 36);
+// bdead 2000009 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 0) = v0;
+goto L412ae0;
+// fdead 0 t0 = MEM_U32(sp + 36);
+L412ad8:
+t9 = 0x1;
+MEM_U32(t0 + 0) = t9;
+L412ae0:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_dw_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412af0:
+//dw_GetItem:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x3a;
+t6 = 0x10009720;
+t9 = MEM_U32(sp + 40);
+t6 = MEM_U8(t6 + 0);
+//nop;
+t8 = 0x1;
+if (t6 != at) goto L412b70;
+//nop;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(sp + 40);
+// bdead 10009 gp = MEM_U32(sp + 24);
+MEM_U32(t7 + 0) = v0;
+goto L412b74;
+t8 = 0x1;
+L412b70:
+MEM_U32(t9 + 0) = t8;
+L412b74:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_put_binasmfyle(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412b84:
+//put_binasmfyle:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ecc;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 36) = ra;
+// fdead 400081eb MEM_U32(sp + 32) = gp;
+if (t6 == 0) goto L412c48;
+t0 = 0x10008ed8;
+t1 = 0x10008ed4;
+t7 = MEM_U32(t0 + 4);
+v1 = MEM_U32(t1 + 0);
+a2 = 0x10;
+a1 = v1;
+if (v1 < t7) goto L412bf8;
+a0 = 0x10008ed8;
+//nop;
+a3 = MEM_U32(t0 + 0);
+MEM_U32(sp + 16) = zero;
+a0 = a0 + 0x4;
+v0 = f_grow_array(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 32);
+//nop;
+t1 = 0x10008ed4;
+t0 = 0x10008ed8;
+v1 = MEM_U32(t1 + 0);
+MEM_U32(t0 + 0) = v0;
+L412bf8:
+t3 = 0x1000a7c0;
+t8 = MEM_U32(t0 + 0);
+at = MEM_U32(t3 + 0);
+t9 = v1 << 4;
+t2 = t8 + t9;
+MEM_U32(t2 + 0) = at;
+t5 = MEM_U32(t3 + 4);
+//nop;
+MEM_U32(t2 + 4) = t5;
+at = MEM_U32(t3 + 8);
+//nop;
+MEM_U32(t2 + 8) = at;
+t5 = MEM_U32(t3 + 12);
+//nop;
+MEM_U32(t2 + 12) = t5;
+t6 = MEM_U32(t1 + 0);
+//nop;
+t7 = t6 + 0x1;
+MEM_U32(t1 + 0) = t7;
+goto L412c9c;
+L412c48:
+a3 = 0x1000a7d0;
+//nop;
+a0 = 0x1000a7c0;
+a3 = MEM_U32(a3 + 0);
+a1 = 0x10;
+a2 = 0x1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a1 = zero;
+//nop;
+a0 = 0x1000a7c0;
+a2 = 0x10;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+//nop;
+v1 = 0x10008ea0;
+//nop;
+t8 = MEM_U32(v1 + 0);
+//nop;
+t9 = t8 + 0x1;
+MEM_U32(v1 + 0) = t9;
+L412c9c:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+//nop;
+}
+
+static void f_ltoa(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L412d18:
+//ltoa:
+//nop;
+//nop;
+//nop;
+a2 = a0;
+a0 = a1;
+a1 = 0x10007be0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L412d58:
+//st_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10007be4;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10007bf0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L412e28:
+//st_warning:
+//nop;
+//nop;
+//nop;
+// fdead 2b sp = sp + 0xffffffd8;
+// fdead 2b MEM_U32(sp + 40) = a0;
+// fdead 2b MEM_U32(sp + 44) = a1;
+a1 = 0x10007bf4;
+a0 = 0xfb528e4;
+//nop;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 48) = a2;
+// fdead 6b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x2;
+//nop;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// fdead 1b gp = MEM_U32(sp + 32);
+// fdead 1b t6 = MEM_U32(sp + 52);
+// fdead 1b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 3b a1 = MEM_U32(sp + 40);
+// fdead 3b a2 = MEM_U32(sp + 44);
+// fdead 3b a3 = MEM_U32(sp + 48);
+// fdead 3b MEM_U32(sp + 16) = t6;
+// fdead 3b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10007c00;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b ra = MEM_U32(sp + 36);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b sp = sp + 0x28;
+return;
+}
+
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L412f70:
+//st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10007c04;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 32);
+a0 = zero;
+//nop;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10007c10;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_413060(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413060:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008eb4;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+a3 = a1;
+if (t6 == 0) goto L4130f8;
+at = 0x3;
+//nop;
+if (a1 == at) goto L4130e0;
+t7 = 0x10001094;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L4130f8;
+a0 = 0xfb528e4;
+a1 = 0x10007c48;
+//nop;
+MEM_U32(sp + 36) = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+at = 0x10001094;
+MEM_U32(at + 0) = zero;
+goto L4130f8;
+L4130e0:
+t8 = 0x10001094;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// bdead 40000103 ra = MEM_U32(sp + 28);
+if (t8 != 0) goto L413218;
+L4130f8:
+v1 = 0x10009f34;
+//nop;
+v0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if ((int)v0 >= (int)a3) goto L41311c;
+MEM_U32(v1 + 0) = v0;
+goto L413120;
+L41311c:
+MEM_U32(v1 + 0) = a3;
+L413120:
+at = 0x3;
+v0 = 0x1;
+if (a3 == at) goto L413160;
+a0 = 0xfb528e4;
+a1 = 0x10007c4c;
+a2 = 0x10007c50;
+//nop;
+MEM_U32(sp + 36) = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = a2;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+//nop;
+v0 = 0x1;
+L413160:
+at = 0x3;
+if (a3 != v0) goto L413174;
+at = 0x10008eb8;
+MEM_U32(at + 0) = zero;
+goto L413188;
+L413174:
+//nop;
+if (a3 != at) goto L413188;
+at = 0x10001094;
+MEM_U32(at + 0) = v0;
+goto L413214;
+L413188:
+t0 = 0x10001098;
+t9 = a3 << 2;
+t0 = t0;
+t1 = t9 + t0;
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10007c58;
+a2 = MEM_U32(t1 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+t2 = MEM_U32(sp + 32);
+// bdead 40000901 gp = MEM_U32(sp + 24);
+t3 = MEM_U8(t2 + 0);
+a2 = t2;
+//nop;
+if (t3 == 0) goto L4131ec;
+a0 = 0xfb528e4;
+a1 = 0x10007c60;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L4131ec:
+a2 = 0x10009314;
+a0 = 0xfb528e4;
+a1 = 0x10007c64;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L413214:
+// bdead 1 ra = MEM_U32(sp + 28);
+L413218:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_413224(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L413224:
+//nop;
+//nop;
+//nop;
+v0 = 0x10001090;
+sp = sp + 0xffffffe0;
+v0 = v0;
+t6 = MEM_U32(v0 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+a2 = a0;
+if (t6 == 0) goto L413258;
+MEM_U8(a0 + 0) = (uint8_t)zero;
+goto L4132b8;
+L413258:
+a0 = 0x10009310;
+t7 = 0x1;
+MEM_U32(v0 + 0) = t7;
+a0 = MEM_U32(a0 + 0);
+at = 0xffffffff;
+//nop;
+if (a0 == at) goto L4132b0;
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+v0 = f_st_str_idn(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+//nop;
+a1 = v0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v0 = 0x10001090;
+v0 = v0;
+goto L4132b4;
+L4132b0:
+MEM_U8(a2 + 0) = (uint8_t)zero;
+L4132b4:
+MEM_U32(v0 + 0) = zero;
+L4132b8:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_call_name_and_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L4132c8:
+//call_name_and_line:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 1056) = a0;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x20;
+func_413224(mem, sp, a0, a1, a2, a3);
+// bdead 40000081 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 1056);
+//nop;
+a0 = sp + 0x20;
+// fdead 6000006b t9 = t9;
+//nop;
+func_413060(mem, sp, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x420;
+return;
+}
+
+static void f_call_perror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L413320:
+//call_perror:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+//nop;
+//nop;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb528e4;
+//nop;
+a0 = a0 + 0x20;
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_new_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L413388:
+//new_error:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000014b MEM_U32(sp + 28) = ra;
+// fdead 4000014b MEM_U32(sp + 24) = gp;
+a0 = 0x1;
+a1 = zero;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb528e4;
+//nop;
+a0 = a0 + 0x20;
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_posterror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4133dc:
+//posterror:
+//nop;
+//nop;
+//nop;
+t6 = 0x10008ea8;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+if (t6 == 0) goto L413430;
+v1 = 0x10009f34;
+//nop;
+v0 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if ((int)v0 >= (int)a2) goto L41342c;
+MEM_U32(v1 + 0) = v0;
+goto L413430;
+L41342c:
+MEM_U32(v1 + 0) = a2;
+L413430:
+//nop;
+if ((int)a2 < (int)0x2) goto L413454;
+t7 = 0x10008ea4;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+// bdead 40000181 ra = MEM_U32(sp + 28);
+if (t7 != 0) goto L41353c;
+L413454:
+//nop;
+a0 = a2;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+a0 = 0xfb528e4;
+a1 = 0x10007c70;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+a2 = MEM_U32(sp + 36);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+if (a2 == 0) goto L4134b8;
+a0 = 0xfb528e4;
+a1 = 0x10007c74;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+goto L4134d8;
+L4134b8:
+a0 = 0xfb528e4;
+a1 = 0x10007c7c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+L4134d8:
+t8 = 0x10009f30;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if (t8 != 0) goto L41353c;
+t9 = 0x10008ee8;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 28);
+if ((int)t9 <= 0) goto L41353c;
+a0 = 0xfb528e4;
+a1 = 0x10007c80;
+//nop;
+a2 = 0x10008ef0;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+t0 = 0x1;
+at = 0x10009f30;
+//nop;
+MEM_U32(at + 0) = t0;
+// bdead 1 ra = MEM_U32(sp + 28);
+L41353c:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_postcerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L413548:
+//postcerror:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a1;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 32);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+// bdead 40000181 ra = MEM_U32(sp + 28);
+if (a2 == 0) goto L4135a4;
+a0 = 0xfb528e4;
+a1 = 0x10007c8c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L4135a4:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_assertion_failed(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L4135b0:
+//assertion_failed:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+a0 = zero;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a0 = 0xfb528e4;
+a1 = 0x10007c90;
+//nop;
+a3 = MEM_U32(sp + 40);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+a2 = MEM_U32(sp + 32);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+if (a2 == 0) goto L413634;
+a0 = 0xfb528e4;
+a1 = 0x10007ca0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L413634:
+a0 = 0xfb528e4;
+//nop;
+a0 = a0 + 0x20;
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_which_opt(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+L413670:
+//which_opt:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s1 = 0x100010ac;
+s2 = a0;
+// fdead 400c006b MEM_U32(sp + 44) = ra;
+// fdead 400c006b MEM_U32(sp + 40) = gp;
+s0 = zero;
+s3 = 0x6a;
+L4136a8:
+//nop;
+a1 = MEM_U32(s1 + 0);
+a0 = s2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 401e0009 gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L4136cc;
+v0 = s0;
+goto L4136dc;
+L4136cc:
+s0 = s0 + 0x1;
+s1 = s1 + 0x4;
+if (s0 != s3) goto L4136a8;
+v0 = 0x69;
+L4136dc:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t f_grow_array(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t2 = 0, t6 = 0, t7 = 0, s0 = 0,
+t8 = 0, t9 = 0, lo = 0, hi = 0;
+L4136f8:
+//grow_array:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 60) = a3;
+v0 = MEM_U32(a0 + 0);
+s0 = a0;
+at = a1 < 0x400;
+if (v0 != 0) goto L4137b4;
+t7 = 0x400;
+if (a1 < 0x400) goto L41373c;
+t6 = a1 + 0x1;
+MEM_U32(a0 + 0) = t6;
+goto L413740;
+L41373c:
+MEM_U32(s0 + 0) = t7;
+L413740:
+t8 = MEM_U32(s0 + 0);
+//nop;
+lo = t8 * a2;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)a2 >> 32);
+a0 = lo;
+MEM_U32(sp + 36) = a0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+s0 = v0;
+if (v0 != 0) goto L413788;
+//nop;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 24);
+// bdead 20001 ra = MEM_U32(sp + 28);
+goto L413858;
+L413788:
+t9 = MEM_U32(sp + 64);
+a0 = s0;
+// bdead 40020123 ra = MEM_U32(sp + 28);
+if (t9 == 0) goto L413858;
+//nop;
+a1 = zero;
+a2 = a3;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 24);
+s0 = v0;
+goto L413854;
+L4137b4:
+lo = v0 * a2;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+t0 = v0 << 1;
+at = a1 < t0;
+MEM_U32(s0 + 0) = t0;
+v0 = t0;
+v1 = lo;
+//nop;
+if (at != 0) goto L4137dc;
+v0 = a1 + 0x1;
+MEM_U32(s0 + 0) = v0;
+L4137dc:
+lo = v0 * a2;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+//nop;
+a0 = MEM_U32(sp + 60);
+MEM_U32(sp + 40) = v1;
+a1 = lo;
+MEM_U32(sp + 36) = a1;
+//nop;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 36);
+s0 = v0;
+if (v0 != 0) goto L41382c;
+//nop;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 24);
+// bdead 20001 ra = MEM_U32(sp + 28);
+goto L413858;
+L41382c:
+t2 = MEM_U32(sp + 64);
+a0 = s0 + v1;
+// bdead 40020133 ra = MEM_U32(sp + 28);
+if (t2 == 0) goto L413858;
+//nop;
+a1 = zero;
+a2 = a3 - v1;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 20001 gp = MEM_U32(sp + 24);
+//nop;
+L413854:
+// bdead 20001 ra = MEM_U32(sp + 28);
+L413858:
+v0 = s0;
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+//nop;
+//nop;
+}
+
+static void f_st_cuinit(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, t6 = 0;
+L413870:
+//st_cuinit:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+a0 = 0xbc;
+a1 = 0x1;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+v1 = v0;
+a1 = 0x1000a9ac;
+MEM_U32(a1 + 0) = v0;
+if (v0 != 0) goto L4138d8;
+a0 = 0x10008020;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(a1 + 0);
+//nop;
+L4138d8:
+t6 = 0x2;
+MEM_U32(v1 + 60) = t6;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 v0 = MEM_U32(a1 + 0);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_st_extadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L4138f0:
+//st_extadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+t0 = 0x1000a9ac;
+// fdead 400003eb MEM_U32(sp + 20) = s0;
+t0 = MEM_U32(t0 + 0);
+s0 = a3;
+// fdead 400203eb MEM_U32(sp + 28) = ra;
+// fdead 400203eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+if (t0 != 0) goto L413954;
+a0 = 0x1000804c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40020101 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x1000a9ac;
+//nop;
+t0 = MEM_U32(t0 + 0);
+//nop;
+L413954:
+a0 = MEM_U32(t0 + 28);
+t6 = MEM_U32(t0 + 32);
+a1 = t0 + 0x20;
+a2 = 0x10;
+if ((int)a0 < (int)t6) goto L4139a8;
+//nop;
+a0 = MEM_U32(t0 + 24);
+a3 = 0x20;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400201c9 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x1000a9ac;
+t0 = 0x1000a9ac;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 24) = v0;
+t0 = MEM_U32(t0 + 0);
+//nop;
+a0 = MEM_U32(t0 + 28);
+//nop;
+L4139a8:
+t8 = MEM_U32(t0 + 24);
+t9 = a0 << 4;
+v1 = t8 + t9;
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(sp + 36);
+// bdead 40020199 gp = MEM_U32(sp + 24);
+t1 = MEM_U8(v1 + 0);
+MEM_U16(v1 + 2) = (uint16_t)v0;
+t3 = t1 & 0xff7f;
+t5 = t3 & 0xbf;
+t7 = t5 & 0xdf;
+MEM_U8(v1 + 0) = (uint8_t)t3;
+t9 = t7 & 0xef;
+MEM_U8(v1 + 0) = (uint8_t)t5;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t1 = t9 & 0xf7;
+MEM_U8(v1 + 0) = (uint8_t)t9;
+MEM_U8(v1 + 0) = (uint8_t)t1;
+t2 = MEM_U16(v1 + 0);
+t1 = MEM_U8(v1 + 12);
+t3 = t2 & 0xf800;
+MEM_U16(v1 + 0) = (uint16_t)t3;
+t4 = MEM_U32(sp + 40);
+t2 = t1 & 0xff03;
+MEM_U32(v1 + 4) = t4;
+t5 = MEM_U32(sp + 44);
+at = 0xf0000;
+MEM_U32(v1 + 8) = t5;
+t7 = MEM_U32(sp + 48);
+t5 = s0 << 5;
+t9 = t7 << 2;
+t3 = t9 | t2;
+MEM_U8(v1 + 12) = (uint8_t)t3;
+t7 = MEM_U16(v1 + 12);
+t6 = t5 & 0x3e0;
+t8 = t7 & 0xfc1f;
+t1 = t6 | t8;
+MEM_U16(v1 + 12) = (uint16_t)t1;
+t9 = MEM_U8(v1 + 13);
+at = at | 0xffff;
+t2 = t9 & 0xffef;
+MEM_U8(v1 + 13) = (uint8_t)t2;
+t3 = MEM_U32(sp + 56);
+v0 = MEM_U32(v1 + 12);
+t4 = t3 & at;
+t5 = t4 ^ v0;
+t7 = t5 << 12;
+t6 = t7 >> 12;
+at = 0x12;
+t8 = t6 ^ v0;
+MEM_U32(v1 + 12) = t8;
+if (s0 == at) goto L413ad0;
+at = 0x11;
+//nop;
+if (s0 == at) goto L413ad0;
+at = 0x6;
+if (s0 == 0) goto L413ad0;
+if (s0 == at) {
+at = 0x15;
+goto L413ad0;}
+at = 0x15;
+//nop;
+if (s0 == at) goto L413ad0;
+//nop;
+a0 = MEM_S16(v1 + 2);
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 0);
+// bdead 11 gp = MEM_U32(sp + 24);
+t1 = MEM_U8(v1 + 60);
+//nop;
+t9 = t1 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t9;
+L413ad0:
+t0 = 0x1000a9ac;
+//nop;
+t0 = MEM_U32(t0 + 0);
+//nop;
+v0 = MEM_U32(t0 + 28);
+//nop;
+t2 = v0 + 0x1;
+MEM_U32(t0 + 28) = t2;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L413b00:
+//st_pext_iext:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L413b44;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 28);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L413b70;
+L413b44:
+a0 = 0x10008084;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413b70:
+t7 = MEM_U32(v1 + 24);
+// bdead 10041 ra = MEM_U32(sp + 28);
+t8 = a1 << 4;
+// bdead 2010001 sp = sp + 0x20;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413b88:
+//st_idn_index_fext:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a9ac;
+sp = sp + 0xffffffc8;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000007b MEM_U32(sp + 28) = ra;
+// fdead 4000007b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+MEM_U32(sp + 60) = a1;
+if (v1 != 0) goto L413be0;
+a0 = 0x100080ac;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413be0:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L413c2c;
+//nop;
+a0 = MEM_U32(v1 + 56);
+MEM_U32(sp + 44) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400001c9 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 44);
+t7 = 0x1000a9ac;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+L413c2c:
+t9 = MEM_U32(sp + 56);
+if (t0 != 0) goto L413c5c;
+t8 = 0x1000a9ac;
+//nop;
+t8 = MEM_U32(t8 + 0);
+a1 = 0x10;
+a0 = MEM_U32(t8 + 56);
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+t9 = MEM_U32(sp + 56);
+L413c5c:
+t1 = MEM_U32(sp + 60);
+t2 = 0x7fff0000;
+MEM_U32(sp + 52) = t9;
+if (t1 == 0) goto L413c80;
+v1 = 0x1000a9ac;
+t2 = t2 | 0xffff;
+v1 = MEM_U32(v1 + 0);
+MEM_U32(sp + 48) = t2;
+goto L413ca8;
+L413c80:
+//nop;
+//nop;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 48) = v0;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413ca8:
+t4 = MEM_U32(v1 + 60);
+t3 = MEM_U32(v1 + 56);
+t7 = sp + 0x30;
+at = MEM_U32(t7 + 0);
+t5 = t4 << 3;
+t6 = t3 + t5;
+MEM_U32(t6 + 0) = at;
+t1 = MEM_U32(t7 + 4);
+v1 = 0x1000a9ac;
+MEM_U32(t6 + 4) = t1;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t2 = v0 + 0x1;
+MEM_U32(v1 + 60) = t2;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413cf8:
+//st_pdn_idn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L413d3c;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 60);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L413d74;
+L413d3c:
+t7 = 0x1000a9ac;
+a0 = 0x100080ec;
+t7 = MEM_U32(t7 + 0);
+//nop;
+a2 = MEM_U32(t7 + 60);
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413d74:
+t8 = MEM_U32(v1 + 56);
+// bdead 2000041 ra = MEM_U32(sp + 28);
+t9 = a1 << 3;
+// bdead 6000001 sp = sp + 0x20;
+v0 = t8 + t9;
+return v0;
+//nop;
+}
+
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L413d90:
+//st_symadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+t6 = 0x1000a9ac;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+// fdead 400081eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 44) = a3;
+t7 = MEM_U32(t6 + 4);
+s0 = a2;
+//nop;
+if (t7 != 0) goto L413dec;
+a0 = 0x10001260;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400201c1 gp = MEM_U32(sp + 24);
+//nop;
+L413dec:
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L413e30;
+a0 = 0x1000129c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400201c1 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413e30:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x2;
+//nop;
+if (t9 == 0) goto L413e70;
+a0 = 0x100012d0;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L413e70:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 8);
+a0 = MEM_U32(t0 + 20);
+a1 = v1 + 0x8;
+a2 = 0xc;
+if ((int)a0 < (int)t1) goto L413ed0;
+//nop;
+a0 = MEM_U32(v1 + 4);
+a3 = 0x40;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x1000a9b0;
+v1 = 0x1000a9b0;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 4) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U32(t3 + 20);
+//nop;
+L413ed0:
+t5 = a0 << 2;
+t4 = MEM_U32(v1 + 4);
+t5 = t5 - a0;
+t5 = t5 << 2;
+t6 = MEM_U32(sp + 32);
+v0 = t4 + t5;
+t1 = MEM_U8(v0 + 8);
+MEM_U32(v0 + 0) = t6;
+t7 = MEM_U32(sp + 36);
+t0 = s0 << 2;
+t2 = t1 & 0xff03;
+t3 = t0 | t2;
+MEM_U8(v0 + 8) = (uint8_t)t3;
+MEM_U32(v0 + 4) = t7;
+t5 = MEM_U32(sp + 44);
+t8 = MEM_U16(v0 + 8);
+t6 = t5 << 5;
+t7 = t6 & 0x3e0;
+t9 = t8 & 0xfc1f;
+t1 = t7 | t9;
+MEM_U16(v0 + 8) = (uint16_t)t1;
+t0 = MEM_U8(v0 + 9);
+at = 0xf0000;
+t2 = t0 & 0xffef;
+MEM_U8(v0 + 9) = (uint8_t)t2;
+t3 = MEM_U32(sp + 48);
+a1 = MEM_U32(v0 + 8);
+at = at | 0xffff;
+t4 = t3 & at;
+t5 = t4 ^ a1;
+t6 = t5 << 12;
+t8 = t6 >> 12;
+at = 0xe;
+t7 = t8 ^ a1;
+MEM_U32(v0 + 8) = t7;
+if (s0 == at) goto L413f7c;
+at = 0x2;
+if (s0 == at) {
+at = 0x5;
+goto L413f7c;}
+at = 0x5;
+if (s0 == at) {
+at = 0x6;
+goto L413f7c;}
+at = 0x6;
+//nop;
+if (s0 != at) goto L413fa4;
+L413f7c:
+t9 = 0x1000a9b0;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+v1 = MEM_U32(t9 + 0);
+//nop;
+t1 = MEM_U8(v1 + 60);
+//nop;
+t0 = t1 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t0;
+L413fa4:
+t2 = 0x1000a9b0;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+v1 = MEM_U32(t2 + 0);
+//nop;
+v0 = MEM_U32(v1 + 20);
+//nop;
+t3 = v0 + 0x1;
+MEM_U32(v1 + 20) = t3;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413fdc:
+//st_ifd_pcfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41402c;
+a0 = 0x10001260;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+L41402c:
+t8 = 0x1000a9b0;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L414060;
+a0 = 0x1000129c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L414060:
+t0 = 0x1000a9ac;
+t9 = MEM_U32(sp + 32);
+t0 = MEM_U32(t0 + 0);
+// bdead 4000201 ra = MEM_U32(sp + 28);
+t1 = MEM_U32(t0 + 4);
+// bdead 4000401 sp = sp + 0x20;
+v0 = t9 - t1;
+t2 = (int)v0 >> 6;
+v0 = t2;
+return v0;
+}
+
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L414088:
+//st_pcfd_ifd:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a1 = a0;
+//nop;
+if (t7 != 0) goto L4140d8;
+a0 = 0x10001260;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+L4140d8:
+//nop;
+if ((int)a1 < 0) goto L414104;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t8 = MEM_U32(v1 + 12);
+//nop;
+//nop;
+if ((int)a1 < (int)t8) goto L414130;
+L414104:
+a0 = 0x10008130;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L414130:
+t9 = MEM_U32(v1 + 4);
+// bdead 4000041 ra = MEM_U32(sp + 28);
+t0 = a1 << 6;
+// bdead 4000201 sp = sp + 0x20;
+v0 = t9 + t0;
+return v0;
+}
+
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L414148:
+//st_psym_ifd_isym:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 28) = ra;
+// fdead 400080eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L4141a0;
+a0 = 0x10001260;
+//nop;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+//nop;
+L4141a0:
+at = 0x7fff0000;
+at = at | 0xffff;
+//nop;
+if (a3 != at) goto L4141cc;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+v0 = v0 + 0x4;
+goto L41427c;
+L4141cc:
+a1 = a3;
+if ((int)a3 < 0) goto L414228;
+//nop;
+if ((int)a2 < 0) goto L414228;
+v0 = 0x1000a9ac;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L414228;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 20);
+//nop;
+t8 = a2 << 2;
+if ((int)a2 < (int)t2) goto L41426c;
+L414228:
+a0 = 0x10008154;
+//nop;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+t4 = 0x1000a9ac;
+a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+v1 = t5 + t6;
+t8 = a2 << 2;
+L41426c:
+t7 = MEM_U32(v1 + 4);
+t8 = t8 - a2;
+t8 = t8 << 2;
+v0 = t7 + t8;
+L41427c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41428c:
+//st_paux_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L4142dc;
+a0 = 0x10001260;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+L4142dc:
+t8 = 0x1000a9b0;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t9 = MEM_U32(sp + 32);
+if (t8 != 0) goto L414314;
+a0 = 0x1000129c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+t9 = MEM_U32(sp + 32);
+L414314:
+//nop;
+//nop;
+if ((int)t9 < 0) goto L41434c;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t0 = MEM_U32(v1 + 0);
+//nop;
+t1 = MEM_U32(t0 + 48);
+//nop;
+t3 = MEM_U32(sp + 32);
+if ((int)t9 < (int)t1) goto L41437c;
+L41434c:
+a0 = 0x1000818c;
+//nop;
+a1 = MEM_U32(sp + 32);
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(sp + 32);
+L41437c:
+t2 = MEM_U32(v1 + 12);
+// bdead 1801 ra = MEM_U32(sp + 28);
+t4 = t3 << 2;
+// bdead 2801 sp = sp + 0x20;
+v0 = t2 + t4;
+return v0;
+}
+
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L414394:
+//st_str_ifd_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a2 = a0;
+at = 0x7fff0000;
+if (t7 != 0) goto L4143f0;
+a0 = 0x10001260;
+//nop;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 32) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 32);
+//nop;
+at = 0x7fff0000;
+L4143f0:
+at = at | 0xffff;
+//nop;
+if (a2 != at) goto L414418;
+//nop;
+a0 = a1;
+//nop;
+v0 = f__md_st_str_extiss(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L41445c;
+L414418:
+//nop;
+a0 = a2;
+MEM_U32(sp + 36) = a1;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+a1 = MEM_U32(sp + 36);
+v1 = MEM_U32(t8 + 12);
+// bdead 5b gp = MEM_U32(sp + 24);
+at = (int)a1 < (int)v1;
+if (v1 == 0) goto L414454;
+//nop;
+if ((int)a1 >= (int)v1) goto L414454;
+t9 = MEM_U32(v0 + 20);
+v0 = t9 + a1;
+goto L414458;
+L414454:
+v0 = zero;
+L414458:
+// bdead 9 ra = MEM_U32(sp + 28);
+L41445c:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L414540:
+//_md_st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 48) = a2;
+a2 = 0x10001450;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x100081c0;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100081d0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L414600:
+//_md_st_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+a2 = 0x10001450;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x100081d4;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400000eb MEM_U32(sp + 32) = gp;
+// fdead 400000eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100081e0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L4146c0:
+//_md_st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L414704;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L414704;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L414704:
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L41480c:
+//_md_st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x1000a9b0;
+sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L414838;
+v0 = 0xffffffff;
+goto L414850;
+L414838:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L414850:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L414860:
+//_md_st_malloc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L4148a4;
+at = 0xffffffff;
+if (a0 == 0) goto L4148a4;
+t0 = v0 << 1;
+if (a0 != at) goto L414950;
+L4148a4:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L4148ec;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4148e4;
+a0 = 0x100081e4;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L4148e4:
+v0 = s1;
+goto L4149ac;
+L4148ec:
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U32(sp + 48);
+//nop;
+lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4149a8;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(sp + 48);
+//nop;
+lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L4149ac;
+a0 = 0x10008224;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L4149ac;
+L414950:
+MEM_U32(s0 + 0) = t0;
+t2 = MEM_U32(sp + 48);
+//nop;
+lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4149a8;
+t3 = MEM_U32(s0 + 0);
+t4 = MEM_U32(sp + 48);
+a0 = 0x10008268;
+lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+a1 = lo;
+//nop;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L4149a8:
+v0 = s1;
+L4149ac:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_filebegin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+L414ab8:
+//st_filebegin:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+s2 = a0;
+// fdead 400801eb MEM_U32(sp + 40) = gp;
+// fdead 400801eb MEM_U32(sp + 32) = s1;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+s0 = zero;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400a010b gp = MEM_U32(sp + 40);
+//nop;
+if ((int)v0 <= 0) goto L414c5c;
+s1 = 0x1000a830;
+//nop;
+s1 = s1;
+L414b10:
+//nop;
+a0 = s0;
+a1 = 0x1;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 400e000b gp = MEM_U32(sp + 40);
+a0 = s2;
+//nop;
+a1 = v0;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400e01cb gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L414c3c;
+a0 = MEM_U32(s1 + 0);
+//nop;
+v1 = a0 + 0xffffffff;
+//nop;
+if ((int)v1 < 0) goto L414b88;
+t6 = 0x1000a82c;
+t7 = v1 << 3;
+t6 = MEM_U32(t6 + 0);
+//nop;
+v0 = t6 + t7;
+L414b6c:
+t8 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (s0 == t8) goto L414b88;
+v1 = v1 + 0xffffffff;
+v0 = v0 + 0xfffffff8;
+if ((int)v1 >= 0) goto L414b6c;
+L414b88:
+//nop;
+if ((int)v1 < 0) goto L414c3c;
+v1 = 0x1000a82c;
+t9 = a0 << 3;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t0 = v1 + t9;
+t1 = MEM_U32(t0 + -8);
+//nop;
+t2 = a0 + 0xffffffff;
+if (s0 == t1) goto L414c04;
+L414bb4:
+MEM_U32(s1 + 0) = t2;
+a0 = t2;
+if ((int)t2 >= 0) goto L414bec;
+a0 = 0x100082b0;
+//nop;
+a1 = s2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400e01c1 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s1 + 0);
+v1 = 0x1000a82c;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L414bec:
+t3 = a0 << 3;
+t4 = v1 + t3;
+t5 = MEM_U32(t4 + -8);
+//nop;
+t2 = a0 + 0xffffffff;
+if (s0 != t5) goto L414bb4;
+L414c04:
+//nop;
+a0 = s0;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 40);
+t7 = MEM_U32(s1 + 0);
+t6 = 0x1000a82c;
+t8 = t7 << 3;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t9 = t6 + t8;
+v0 = MEM_U32(t9 + -4);
+// bdead 9 ra = MEM_U32(sp + 44);
+goto L414d90;
+L414c3c:
+//nop;
+s0 = s0 + 0x1;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400e010b gp = MEM_U32(sp + 40);
+//nop;
+if ((int)s0 < (int)v0) goto L414b10;
+L414c5c:
+s1 = 0x1000a830;
+//nop;
+a1 = MEM_U32(sp + 52);
+a2 = MEM_U32(sp + 56);
+a3 = MEM_U32(sp + 60);
+a0 = s2;
+s1 = s1;
+f_st_fdadd(mem, sp, a0, a1, a2, a3);
+// bdead 40040003 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+//nop;
+//nop;
+f_st_feinit(mem, sp);
+// bdead 40040103 gp = MEM_U32(sp + 40);
+t1 = MEM_U32(s1 + 0);
+a1 = 0x1000a834;
+a2 = 0x8;
+a1 = a1;
+t0 = MEM_U32(a1 + 0);
+//nop;
+//nop;
+if ((int)t1 < (int)t0) goto L414ce4;
+a0 = 0x1000a82c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x19;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 40);
+//nop;
+at = 0x1000a82c;
+//nop;
+MEM_U32(at + 0) = v0;
+L414ce4:
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4004000b gp = MEM_U32(sp + 40);
+t3 = MEM_U32(s1 + 0);
+t2 = 0x1000a82c;
+t4 = t3 << 3;
+t2 = MEM_U32(t2 + 0);
+t7 = 0xf0000;
+t5 = t2 + t4;
+MEM_U32(t5 + 0) = v0;
+//nop;
+t7 = t7 | 0xffff;
+MEM_U32(sp + 16) = t7;
+a0 = 0x1;
+a1 = zero;
+a2 = 0xb;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 4004018b gp = MEM_U32(sp + 40);
+a0 = v0;
+//nop;
+a1 = zero;
+//nop;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 40009 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(s1 + 0);
+a1 = 0x1000a82c;
+t9 = t8 << 3;
+a1 = a1;
+t6 = MEM_U32(a1 + 0);
+//nop;
+t0 = t6 + t9;
+MEM_U32(t0 + 4) = v0;
+a0 = MEM_U32(s1 + 0);
+t1 = MEM_U32(a1 + 0);
+t3 = a0 << 3;
+t2 = t1 + t3;
+v0 = MEM_U32(t2 + 4);
+t4 = a0 + 0x1;
+MEM_U32(s1 + 0) = t4;
+// bdead 9 ra = MEM_U32(sp + 44);
+L414d90:
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 32);
+// bdead 9 s2 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void f_st_endallfiles(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L414da4:
+//st_endallfiles:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 4000000b MEM_U32(sp + 52) = ra;
+// fdead 4000000b MEM_U32(sp + 48) = gp;
+// fdead 4000000b MEM_U32(sp + 44) = s4;
+// fdead 4000000b MEM_U32(sp + 40) = s3;
+// fdead 4000000b MEM_U32(sp + 36) = s2;
+// fdead 4000000b MEM_U32(sp + 32) = s1;
+// fdead 4000000b MEM_U32(sp + 28) = s0;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 56) = v0;
+//nop;
+s1 = zero;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400401cb gp = MEM_U32(sp + 48);
+s4 = 0xc;
+if ((int)v0 <= 0) goto L414f18;
+s3 = 0x8;
+s2 = 0xffffffff;
+L414e04:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 4);
+// bdead 403c01db gp = MEM_U32(sp + 48);
+//nop;
+if (v1 == 0) goto L414e6c;
+//nop;
+if (s2 == v1) goto L414e6c;
+t6 = MEM_U32(v0 + 0);
+//nop;
+a0 = MEM_U32(t6 + 20);
+//nop;
+//nop;
+if ((int)a0 <= 0) goto L414e6c;
+lo = a0 * s4;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)s4 >> 32);
+t7 = lo;
+t8 = v1 + t7;
+a1 = MEM_U32(t8 + -4);
+//nop;
+t9 = a1 >> 26;
+t0 = a1 << 12;
+if (s3 != t9) goto L414e6c;
+//nop;
+if (t0 == 0) goto L414ef8;
+L414e6c:
+//nop;
+a0 = s1;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 403c0003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = zero;
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 403c000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 16) = zero;
+a1 = zero;
+a2 = 0x8;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 403c000b gp = MEM_U32(sp + 48);
+s0 = v0;
+//nop;
+a0 = s1;
+a1 = zero;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+at = 0xf0000;
+v1 = MEM_U32(v0 + 8);
+at = at | 0xffff;
+s0 = s0 + 0x1;
+t1 = s0 & at;
+t2 = t1 ^ v1;
+t3 = t2 << 12;
+t4 = t3 >> 12;
+// bdead 403c201b gp = MEM_U32(sp + 48);
+t5 = t4 ^ v1;
+MEM_U32(v0 + 8) = t5;
+L414ef8:
+//nop;
+s1 = s1 + 0x1;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 403c01cb gp = MEM_U32(sp + 48);
+//nop;
+if ((int)s1 < (int)v0) goto L414e04;
+L414f18:
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+//nop;
+s0 = 0x1000a82c;
+//nop;
+s0 = s0;
+a0 = MEM_U32(s0 + 0);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 0) = zero;
+at = 0x1000a830;
+// bdead 7 ra = MEM_U32(sp + 52);
+MEM_U32(at + 0) = zero;
+at = 0x1000a834;
+// bdead 7 s0 = MEM_U32(sp + 28);
+// bdead 7 s1 = MEM_U32(sp + 32);
+// bdead 7 s2 = MEM_U32(sp + 36);
+// bdead 7 s3 = MEM_U32(sp + 40);
+// bdead 7 s4 = MEM_U32(sp + 44);
+// bdead 7 sp = sp + 0x48;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static uint32_t f_st_procend(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L4156cc:
+//st_procend:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+//nop;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+// fdead 4000002b MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 88) = a0;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+at = MEM_U32(v0 + 0);
+// bdead 4000018f gp = MEM_U32(sp + 32);
+t6 = sp + 0x44;
+MEM_U32(t6 + 0) = at;
+t9 = MEM_U32(v0 + 4);
+at = 0x7fff0000;
+MEM_U32(t6 + 4) = t9;
+t0 = MEM_U32(sp + 68);
+at = at | 0xffff;
+//nop;
+if (t0 != at) goto L41578c;
+//nop;
+t1 = 0x1;
+a0 = MEM_U32(sp + 72);
+MEM_U32(sp + 60) = t1;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 84) = v0;
+a1 = MEM_U32(v0 + 12);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+a0 = MEM_S16(v0 + 2);
+t2 = a1 & at;
+a1 = t2;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t3 = MEM_U32(sp + 84);
+MEM_U32(sp + 80) = v0;
+t4 = MEM_S16(t3 + 2);
+at = 0xf0000;
+MEM_U32(sp + 68) = t4;
+s0 = MEM_U32(t3 + 12);
+at = at | 0xffff;
+// bdead 400201c7 gp = MEM_U32(sp + 32);
+t5 = s0 & at;
+s0 = t5;
+MEM_U32(sp + 72) = t5;
+goto L4157ac;
+L41578c:
+//nop;
+a0 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 72);
+MEM_U32(sp + 60) = zero;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 400001cb gp = MEM_U32(sp + 32);
+s0 = MEM_U32(sp + 72);
+MEM_U32(sp + 80) = v0;
+L4157ac:
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+MEM_U32(sp + 56) = v0;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 32);
+t8 = MEM_U32(sp + 80);
+//nop;
+a0 = MEM_U32(t8 + 0);
+MEM_U32(sp + 16) = s0;
+a1 = zero;
+a2 = 0x8;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+a1 = MEM_U32(sp + 72);
+s0 = v0;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+MEM_U32(sp + 80) = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(sp + 80);
+t9 = MEM_U32(v0 + 0);
+a0 = MEM_U32(t7 + 8);
+at = 0xf0000;
+t0 = MEM_U32(t9 + 48);
+at = at | 0xffff;
+t6 = a0 & at;
+// bdead 400283c3 gp = MEM_U32(sp + 32);
+a0 = t6;
+if (t0 < t6) goto L415898;
+at = 0xf0000;
+at = at | 0xffff;
+t2 = MEM_U32(sp + 60);
+if (t6 == at) goto L41589c;
+//nop;
+//nop;
+//nop;
+v0 = f_st_paux_iaux(mem, sp, a0);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+t1 = s0 + 0x1;
+MEM_U32(v0 + 0) = t1;
+L415898:
+t2 = MEM_U32(sp + 60);
+L41589c:
+at = 0x1;
+//nop;
+if (t2 != at) goto L415908;
+t4 = MEM_U32(sp + 84);
+at = 0xe;
+v0 = MEM_U32(t4 + 12);
+a1 = zero;
+t3 = v0 >> 26;
+//nop;
+if (t3 != at) goto L415908;
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+a0 = v0 & at;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 4002010b gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 88);
+//nop;
+a1 = v0;
+//nop;
+f_st_setidn(mem, sp, a0, a1);
+t5 = MEM_U32(sp + 84);
+// bdead 40024183 gp = MEM_U32(sp + 32);
+t8 = MEM_U16(t5 + 12);
+//nop;
+t7 = t8 & 0xfc1f;
+MEM_U16(t5 + 12) = (uint16_t)t7;
+L415908:
+//nop;
+a0 = s0;
+a1 = zero;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 56);
+//nop;
+MEM_U32(sp + 88) = v0;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40000001 ra = MEM_U32(sp + 36);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(sp + 88);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static void f_st_procbegin(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L415948:
+//st_procbegin:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+// fdead 4000002b MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 64) = a0;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+at = MEM_U32(v0 + 0);
+// bdead 4000018f gp = MEM_U32(sp + 32);
+t6 = sp + 0x30;
+MEM_U32(t6 + 0) = at;
+t9 = MEM_U32(v0 + 4);
+at = 0x7fff0000;
+MEM_U32(t6 + 4) = t9;
+t0 = MEM_U32(sp + 48);
+at = at | 0xffff;
+//nop;
+if (t0 == at) goto L4159a8;
+// bdead 1 v0 = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L415b6c;
+L4159a8:
+//nop;
+a0 = MEM_U32(sp + 52);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t1 = MEM_U32(v0 + 12);
+// bdead 400005cb gp = MEM_U32(sp + 32);
+t2 = t1 << 6;
+t3 = t2 >> 27;
+at = 0x1;
+s0 = v0;
+if (t3 != at) goto L4159e0;
+// bdead 1 v0 = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L415b6c;
+L4159e0:
+t4 = MEM_U16(s0 + 12);
+//nop;
+t5 = t4 & 0xfc1f;
+t8 = t5 | 0x20;
+MEM_U16(s0 + 12) = (uint16_t)t8;
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t7 = MEM_S16(s0 + 2);
+// bdead 400301cb gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == t7) goto L415ab8;
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+// bdead 400281c3 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(t6 + 48);
+at = 0xf0000;
+//nop;
+if ((int)t9 <= 0) goto L415aa0;
+t0 = MEM_U32(s0 + 12);
+at = at | 0xffff;
+t1 = t0 & at;
+//nop;
+if (t1 == at) goto L415aa0;
+//nop;
+a0 = MEM_S16(s0 + 2);
+a1 = s0 + 0x4;
+v0 = f_st_iaux_copyty(mem, sp, a0, a1);
+at = 0xf0000;
+v1 = MEM_U32(s0 + 12);
+at = at | 0xffff;
+t2 = v0 & at;
+t3 = t2 ^ v1;
+t4 = t3 << 12;
+t5 = t4 >> 12;
+// bdead 400241d3 gp = MEM_U32(sp + 32);
+t8 = t5 ^ v1;
+MEM_U32(s0 + 12) = t8;
+L415aa0:
+//nop;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U16(s0 + 2) = (uint16_t)v0;
+L415ab8:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(s0 + 12);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t7 = v1 & at;
+MEM_U32(sp + 16) = t7;
+a0 = v0;
+a1 = zero;
+a3 = 0x1;
+a2 = v1 >> 26;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+at = 0xf0000;
+v1 = MEM_U32(s0 + 12);
+at = at | 0xffff;
+t6 = v0 & at;
+t9 = t6 ^ v1;
+t0 = t9 << 12;
+// bdead 40020391 gp = MEM_U32(sp + 32);
+t1 = t0 >> 12;
+t2 = t1 ^ v1;
+MEM_U32(s0 + 12) = t2;
+//nop;
+a0 = MEM_S16(s0 + 2);
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 0);
+// bdead 11 gp = MEM_U32(sp + 32);
+t3 = MEM_U8(v1 + 60);
+//nop;
+t4 = t3 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t4;
+// bdead 1 v0 = MEM_U32(sp + 64);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 36);
+L415b6c:
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static uint32_t f_st_sym_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L415b78:
+//st_sym_idn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+at = MEM_U32(v0 + 0);
+// bdead 4000000d gp = MEM_U32(sp + 24);
+t6 = sp + 0x28;
+MEM_U32(t6 + 0) = at;
+t9 = MEM_U32(v0 + 4);
+at = 0xf0000;
+MEM_U32(t6 + 4) = t9;
+t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+//nop;
+if (t0 != at) goto L415bd8;
+v0 = 0xffffffff;
+goto L415c54;
+L415bd8:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t1 = MEM_U32(v0 + 8);
+t4 = MEM_U32(sp + 52);
+t2 = t1 << 6;
+// bdead 40002909 gp = MEM_U32(sp + 24);
+t3 = t2 >> 27;
+MEM_U32(t4 + 0) = t3;
+t5 = MEM_U32(v0 + 8);
+t7 = MEM_U32(sp + 56);
+t8 = t5 >> 26;
+MEM_U32(t7 + 0) = t8;
+t9 = MEM_U32(sp + 60);
+t6 = MEM_U32(v0 + 4);
+at = 0xf0000;
+MEM_U32(t9 + 0) = t6;
+t0 = MEM_U32(v0 + 8);
+t2 = MEM_U32(sp + 64);
+at = at | 0xffff;
+t1 = t0 & at;
+MEM_U32(t2 + 0) = t1;
+//nop;
+a1 = MEM_U32(v0 + 0);
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L415c54:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t6 = 0, t9 = 0;
+L415c64:
+//st_str_idn:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+at = MEM_U32(v0 + 0);
+// bdead 4000000d gp = MEM_U32(sp + 24);
+t6 = sp + 0x28;
+MEM_U32(t6 + 0) = at;
+t9 = MEM_U32(v0 + 4);
+at = 0xf0000;
+MEM_U32(t6 + 4) = t9;
+t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+//nop;
+if (t0 != at) goto L415cb8;
+v0 = 0xffffffff;
+goto L415cec;
+L415cb8:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+//nop;
+a1 = MEM_U32(v0 + 0);
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L415cec:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd_idn(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L416124:
+//st_pdadd_idn:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+// bdead 400081cd gp = MEM_U32(sp + 24);
+at = at | 0xffff;
+v1 = v0;
+if (t6 != at) goto L416188;
+//nop;
+a0 = MEM_U32(v1 + 4);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+a0 = MEM_U32(v0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+// bdead 400001e5 gp = MEM_U32(sp + 24);
+t7 = a0 & at;
+a0 = t7;
+goto L416190;
+L416188:
+a0 = MEM_U32(v0 + 4);
+//nop;
+L416190:
+//nop;
+//nop;
+//nop;
+f_st_pdadd(mem, sp, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+L416620:
+//st_iaux_copyty:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 60) = a1;
+a1 = MEM_U32(a1 + 8);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t7 = a1 & at;
+s2 = a0;
+s1 = zero;
+a1 = t7;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+a2 = MEM_U32(sp + 60);
+// bdead 400c008b gp = MEM_U32(sp + 32);
+t8 = MEM_U32(a2 + 8);
+at = 0x6;
+t9 = t8 >> 26;
+t0 = s1 << 2;
+if (t9 != at) goto L416690;
+s1 = 0x1;
+t0 = s1 << 2;
+L416690:
+a1 = t0 + v0;
+v1 = MEM_U8(a1 + 0);
+at = 0x25;
+t1 = v1 & 0x3f;
+s1 = s1 + 0x1;
+v1 = t1;
+if (t1 != at) goto L4166d4;
+t2 = s1 << 2;
+t3 = v0 + t2;
+t4 = MEM_U32(t3 + 0);
+a3 = 0xfff;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L4166cc;
+s1 = s1 + 0x1;
+L4166cc:
+s1 = s1 + 0x1;
+goto L416758;
+L4166d4:
+at = 0x11;
+t6 = s1 << 2;
+if (v1 == at) goto L416708;
+at = 0x14;
+if (v1 == at) {
+at = 0xc;
+goto L416708;}
+at = 0xc;
+if (v1 == at) {
+at = 0xd;
+goto L416708;}
+at = 0xd;
+if (v1 == at) {
+at = 0xf;
+goto L416708;}
+at = 0xf;
+if (v1 == at) {
+at = 0xe;
+goto L416708;}
+at = 0xe;
+if (v1 != at) {
+t7 = v0 + t6;
+goto L41672c;}
+L416708:
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+a3 = 0xfff;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L416724;
+s1 = s1 + 0x1;
+L416724:
+s1 = s1 + 0x1;
+goto L416758;
+L41672c:
+at = 0x10;
+t0 = s1 << 2;
+if (v1 != at) goto L416758;
+t1 = v0 + t0;
+t2 = MEM_U32(t1 + 0);
+a3 = 0xfff;
+t3 = t2 >> 20;
+//nop;
+if (a3 != t3) goto L416754;
+s1 = s1 + 0x1;
+L416754:
+s1 = s1 + 0x3;
+L416758:
+t4 = MEM_U16(a1 + 2);
+v1 = 0x3;
+t5 = t4 >> 12;
+a3 = 0xfff;
+if (v1 != t5) goto L416790;
+t6 = s1 << 2;
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+//nop;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L41678c;
+s1 = s1 + 0x1;
+L41678c:
+s1 = s1 + 0x4;
+L416790:
+t0 = MEM_U8(a1 + 2);
+t2 = s1 << 2;
+t1 = t0 & 0xf;
+t3 = v0 + t2;
+if (v1 != t1) goto L4167c0;
+t4 = MEM_U32(t3 + 0);
+//nop;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L4167bc;
+s1 = s1 + 0x1;
+L4167bc:
+s1 = s1 + 0x4;
+L4167c0:
+t6 = MEM_U8(a1 + 3);
+t8 = s1 << 2;
+t7 = t6 >> 4;
+t9 = v0 + t8;
+if (v1 != t7) goto L4167f0;
+t0 = MEM_U32(t9 + 0);
+//nop;
+t1 = t0 >> 20;
+//nop;
+if (a3 != t1) goto L4167ec;
+s1 = s1 + 0x1;
+L4167ec:
+s1 = s1 + 0x4;
+L4167f0:
+a0 = MEM_U32(a1 + 0);
+t3 = s1 << 2;
+t2 = a0 & 0xf;
+t4 = v0 + t3;
+if (v1 != t2) goto L416820;
+t5 = MEM_U32(t4 + 0);
+//nop;
+t6 = t5 >> 20;
+//nop;
+if (a3 != t6) goto L41681c;
+s1 = s1 + 0x1;
+L41681c:
+s1 = s1 + 0x4;
+L416820:
+t7 = MEM_U8(a1 + 1);
+t9 = s1 << 2;
+t8 = t7 >> 4;
+t0 = v0 + t9;
+if (v1 != t8) goto L416850;
+t1 = MEM_U32(t0 + 0);
+//nop;
+t2 = t1 >> 20;
+//nop;
+if (a3 != t2) goto L41684c;
+s1 = s1 + 0x1;
+L41684c:
+s1 = s1 + 0x4;
+L416850:
+t3 = MEM_U16(a1 + 0);
+t5 = s1 << 2;
+t4 = t3 & 0xf;
+t9 = a0 >> 31;
+if (v1 != t4) goto L416884;
+t6 = v0 + t5;
+t7 = MEM_U32(t6 + 0);
+//nop;
+t8 = t7 >> 20;
+//nop;
+if (a3 != t8) goto L416880;
+s1 = s1 + 0x1;
+L416880:
+s1 = s1 + 0x4;
+L416884:
+//nop;
+if (t9 == 0) goto L416890;
+s1 = s1 + 0x1;
+L416890:
+s0 = zero;
+if ((int)s1 <= 0) goto L41692c;
+a2 = MEM_U32(sp + 60);
+L41689c:
+a0 = s2;
+v0 = MEM_U32(a2 + 8);
+at = 0xf0000;
+if (s0 != 0) goto L4168ec;
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t0 = v0 & at;
+a1 = t0 + s0;
+a0 = s2;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// bdead 400e01c9 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 400e0009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+goto L416920;
+L4168ec:
+//nop;
+at = at | 0xffff;
+t3 = v0 & at;
+a1 = t3 + s0;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// bdead 400e01c9 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+//nop;
+L416920:
+s0 = s0 + 0x1;
+a2 = MEM_U32(sp + 60);
+if (s0 != s1) goto L41689c;
+L41692c:
+// bdead 40000001 ra = MEM_U32(sp + 36);
+v0 = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static void f_st_auxbtadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416ba0:
+//st_auxbtadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+a0 = sp + 0x24;
+a1 = zero;
+a2 = 0x4;
+v0 = wrapper_memset(mem, a0, a1, a2);
+t7 = MEM_U32(sp + 40);
+t9 = MEM_U8(sp + 36);
+t8 = t7 & 0x3f;
+t0 = t9 & 0xffc0;
+// bdead 420003c1 gp = MEM_U32(sp + 24);
+t1 = t8 | t0;
+MEM_U8(sp + 36) = (uint8_t)t1;
+a0 = MEM_U32(sp + 36);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f_st_auxisymadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L416c10:
+//st_auxisymadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a0;
+MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, t9 = 0;
+L416c48:
+//st_auxrndxadd:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffd0;
+// fdead 6b t7 = MEM_U16(sp + 44);
+at = 0xf0000;
+// fdead 6f t8 = t7 | 0xfff0;
+// fdead 6f MEM_U16(sp + 44) = (uint16_t)t8;
+// fdead 6f t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+t9 = a1 & at;
+// fdead 400006f t1 = t9 ^ t0;
+// fdead 400006f t2 = t1 << 12;
+// fdead 400006f t3 = t2 >> 12;
+// fdead 400006f t4 = t3 ^ t0;
+// fdead 400006f MEM_U32(sp + 28) = ra;
+// fdead 400006f MEM_U32(sp + 24) = gp;
+// fdead 400006f MEM_U32(sp + 48) = a0;
+// fdead 400006f MEM_U32(sp + 44) = t4;
+// fdead 400006f t5 = sp + 0x2c;
+// fdead 400006f a0 = MEM_U32(t5 + 0);
+//nop;
+// fdead 400006f v0 = sp + 0x28;
+MEM_U32(v0 + 0) = a0;
+// fdead 400006f MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f a0 = MEM_U32(sp + 48);
+//nop;
+// fdead 1f MEM_U32(sp + 36) = v0;
+//nop;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+// fdead 1f ra = MEM_U32(sp + 28);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f v0 = MEM_U32(sp + 36);
+// fdead 1f sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0;
+L416dc4:
+//st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x1000a9b0;
+sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L416df0;
+v0 = 0xffffffff;
+goto L416e08;
+L416df0:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L416e08:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t6 = 0;
+L416e18:
+//st_ifdmax:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+v0 = MEM_U32(t6 + 12);
+//nop;
+return v0;
+}
+
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L416e40:
+//st_setfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+v0 = MEM_U32(t6 + 4);
+//nop;
+t8 = MEM_U32(sp + 32);
+if (v0 != 0) goto L416eac;
+a0 = 0x10001390;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x1000a9ac;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+v0 = MEM_U32(t7 + 4);
+//nop;
+t8 = MEM_U32(sp + 32);
+L416eac:
+at = 0x1000a9b0;
+// bdead 200000d ra = MEM_U32(sp + 28);
+t9 = t8 << 6;
+t0 = v0 + t9;
+// bdead 205 sp = sp + 0x20;
+MEM_U32(at + 0) = t0;
+return;
+}
+
+static void f_st_fdadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416ec8:
+//st_fdadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff10;
+t2 = 0x1000a9ac;
+// fdead 400009eb MEM_U32(sp + 28) = ra;
+t0 = MEM_U32(t2 + 0);
+// fdead 40000beb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 240) = a0;
+MEM_U32(sp + 244) = a1;
+MEM_U32(sp + 248) = a2;
+MEM_U32(sp + 252) = a3;
+t6 = MEM_U32(t0 + 12);
+at = 0x7fff0000;
+at = at | 0xffff;
+MEM_U32(sp + 40) = t6;
+if ((int)t6 < (int)at) goto L416f50;
+a0 = 0x100083a0;
+//nop;
+a2 = 0x7fff0000;
+a2 = a2 | 0xffff;
+a1 = t6;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x1000a9ac;
+//nop;
+t0 = MEM_U32(t2 + 0);
+//nop;
+t8 = MEM_U32(t0 + 12);
+//nop;
+MEM_U32(sp + 40) = t8;
+L416f50:
+v0 = MEM_U32(t0 + 16);
+t9 = MEM_U32(sp + 40);
+a1 = t0 + 0x10;
+a2 = 0x40;
+if ((int)t9 < (int)v0) goto L417050;
+//nop;
+MEM_U32(sp + 236) = v0;
+a0 = MEM_U32(t0 + 4);
+MEM_U32(sp + 232) = v0;
+a3 = 0x19;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = sp + 0xec;
+t2 = 0x1000a9ac;
+a2 = 0x48;
+t3 = MEM_U32(t2 + 0);
+a3 = 0x19;
+MEM_U32(t3 + 4) = v0;
+t4 = MEM_U32(t2 + 0);
+//nop;
+a0 = MEM_U32(t4 + 8);
+//nop;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 232);
+t2 = 0x1000a9ac;
+//nop;
+t5 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t5 + 8) = v0;
+t6 = MEM_U32(t2 + 0);
+t7 = MEM_U32(sp + 236);
+a2 = MEM_U32(t6 + 16);
+a3 = MEM_U32(sp + 240);
+a1 = t7;
+if (t7 == a2) goto L417008;
+a0 = 0x100083d4;
+//nop;
+MEM_U32(sp + 232) = t1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 232);
+t2 = 0x1000a9ac;
+//nop;
+L417008:
+// bdead 40000c03 a0 = t1;
+if (t1 == 0) {
+t1 = t1 + 0xffffffff;
+goto L417050;}
+t1 = t1 + 0xffffffff;
+v1 = t1 << 3;
+v1 = v1 + t1;
+v1 = v1 << 3;
+v0 = t1 << 6;
+L417024:
+t0 = MEM_U32(t2 + 0);
+// bdead 40000e1b a0 = t1;
+t8 = MEM_U32(t0 + 8);
+t3 = MEM_U32(t0 + 4);
+t9 = t8 + v1;
+t4 = t3 + v0;
+MEM_U32(t4 + 0) = t9;
+v0 = v0 + 0xffffffc0;
+v1 = v1 + 0xffffffb8;
+if (t1 != 0) {
+t1 = t1 + 0xffffffff;
+goto L417024;}
+t1 = t1 + 0xffffffff;
+L417050:
+t0 = MEM_U32(t2 + 0);
+t9 = 0x1000a888;
+t6 = MEM_U32(t0 + 12);
+t5 = MEM_U32(t0 + 4);
+a1 = 0x1000a9b0;
+t7 = t6 << 6;
+t9 = t9;
+t3 = t5 + t7;
+t6 = t9 + 0x3c;
+MEM_U32(a1 + 0) = t3;
+L417078:
+at = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+MEM_U32(t3 + 0) = at;
+at = MEM_U32(t9 + -8);
+t3 = t3 + 0xc;
+MEM_U32(t3 + -8) = at;
+at = MEM_U32(t9 + -4);
+MEM_U32(t3 + -4) = at;
+if (t9 != t6) goto L417078;
+at = MEM_U32(t9 + 0);
+//nop;
+MEM_U32(t3 + 0) = at;
+t0 = MEM_U32(t2 + 0);
+t6 = MEM_U32(a1 + 0);
+t5 = MEM_U32(t0 + 12);
+t8 = MEM_U32(t0 + 8);
+t7 = t5 << 3;
+t7 = t7 + t5;
+t7 = t7 << 3;
+t4 = t7 + t8;
+MEM_U32(t6 + 0) = t4;
+t0 = MEM_U32(t2 + 0);
+t8 = 0x1000a840;
+t9 = MEM_U32(t0 + 12);
+t8 = t8;
+t3 = t9 + 0x1;
+MEM_U32(t0 + 12) = t3;
+t5 = MEM_U32(a1 + 0);
+t6 = t8 + 0x48;
+t7 = MEM_U32(t5 + 0);
+//nop;
+L4170f4:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t7 + 0) = at;
+at = MEM_U32(t8 + -8);
+t7 = t7 + 0xc;
+MEM_U32(t7 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t7 + -4) = at;
+if (t8 != t6) goto L4170f4;
+t9 = MEM_U32(a1 + 0);
+t5 = MEM_U32(sp + 244);
+v1 = MEM_U32(t9 + 0);
+t6 = t5 << 3;
+t8 = MEM_U8(v1 + 60);
+//nop;
+t7 = t8 & 0xff07;
+t9 = t6 | t7;
+MEM_U8(v1 + 60) = (uint8_t)t9;
+t3 = MEM_U32(a1 + 0);
+t4 = MEM_U32(sp + 248);
+v1 = MEM_U32(t3 + 0);
+t8 = t4 << 2;
+t7 = MEM_U8(v1 + 60);
+t6 = t8 & 0x4;
+t9 = t7 & 0xfffb;
+t3 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t3;
+t5 = MEM_U32(a1 + 0);
+t8 = MEM_U32(sp + 252);
+v1 = MEM_U32(t5 + 0);
+t6 = t8 << 6;
+t9 = MEM_U8(v1 + 61);
+//nop;
+t3 = t9 & 0xff3f;
+t5 = t6 | t3;
+MEM_U8(v1 + 61) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+t7 = v0 < 0x1;
+a1 = 0x1000a9b0;
+t9 = t7 & 0x1;
+t4 = MEM_U32(a1 + 0);
+a0 = 0x1000840c;
+v1 = MEM_U32(t4 + 0);
+a0 = a0;
+t6 = MEM_U8(v1 + 60);
+//nop;
+t3 = t6 & 0xfffe;
+t5 = t9 | t3;
+MEM_U8(v1 + 60) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 240);
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x1000a9b0;
+t7 = 0x10001380;
+t4 = MEM_U32(a1 + 0);
+//nop;
+t8 = MEM_U32(t4 + 0);
+//nop;
+MEM_U32(t8 + 4) = v0;
+t7 = MEM_U32(t7 + 0);
+t6 = MEM_U32(sp + 252);
+// bdead 400081c3 ra = MEM_U32(sp + 28);
+if (t7 != 0) goto L4175c8;
+at = (int)t6 < (int)0x3;
+if (t6 == 0) goto L417234;
+// bdead 400001c3 ra = MEM_U32(sp + 28);
+if ((int)t6 < (int)0x3) goto L4175c8;
+L417234:
+a0 = 0x10008410;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t3 = 0x1;
+t9 = 0x1000143c;
+a1 = 0x40;
+t9 = MEM_S8(t9 + 0);
+//nop;
+t4 = MEM_U32(sp + 240);
+if (t9 != 0) goto L4173e8;
+at = 0x1000143c;
+a0 = 0x1000a8c8;
+//nop;
+MEM_U8(at + 0) = (uint8_t)t3;
+a0 = a0;
+v0 = wrapper_gethostname(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v0 >= 0) goto L4172b0;
+a0 = 0x1000a8c8;
+a1 = 0x1000841c;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+goto L4172d0;
+L4172b0:
+a0 = 0x1000a8c8;
+a1 = 0x10008420;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L4172d0:
+//nop;
+a0 = MEM_U32(sp + 240);
+a1 = 0x5;
+v0 = wrapper_pathconf(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 >= (int)0x5) goto L4172f4;
+v1 = 0x5;
+L4172f4:
+t5 = v1 << 2;
+v0 = t5 << 2;
+//nop;
+v0 = v0 - t5;
+v0 = v0 + 0xa;
+a0 = v0;
+MEM_U32(sp + 44) = v0;
+MEM_U32(sp + 228) = t5;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+at = 0x1000a910;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L417350;
+a0 = 0x10008424;
+//nop;
+a1 = MEM_U32(sp + 44);
+MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+//nop;
+L417350:
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = zero;
+MEM_U32(sp + 228) = v1;
+v0 = wrapper_getcwd(mem, a0, a1);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+at = 0x1000a914;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L41739c;
+a0 = 0x10008450;
+//nop;
+a1 = MEM_U32(sp + 44);
+MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+//nop;
+L41739c:
+//nop;
+a1 = v1 << 2;
+a1 = a1 + 0xa;
+a0 = a1;
+MEM_U32(sp + 44) = a1;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+at = 0x1000a90c;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L4173e4;
+a0 = 0x1000847c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L4173e4:
+t4 = MEM_U32(sp + 240);
+L4173e8:
+at = 0x2f;
+t8 = MEM_S8(t4 + 0);
+a1 = MEM_U32(sp + 240);
+//nop;
+if (t8 == at) goto L417460;
+a0 = 0x1000a910;
+a1 = 0x1000a914;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1000a910;
+a1 = 0x100084b8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 240);
+a0 = 0x1000a910;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+goto L41747c;
+L417460:
+a0 = 0x1000a910;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+L41747c:
+a0 = 0x1000a90c;
+a1 = 0x1000a8c8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1000a90c;
+a1 = 0x1000a910;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1000a90c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+t6 = 0x1;
+t7 = 0x10001440;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L417538;
+at = 0x10001440;
+//nop;
+a0 = zero;
+MEM_U32(at + 0) = t6;
+v0 = wrapper_time(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a2 = v0;
+at = 0x1000a938;
+a0 = 0x1000a918;
+a1 = 0x100084bc;
+//nop;
+MEM_U32(at + 0) = v0;
+a0 = a0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+L417538:
+a0 = 0x1000a918;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 240);
+//nop;
+a1 = sp + 0x38;
+//nop;
+v0 = wrapper_stat(mem, a0, a1);
+// bdead 400001c9 gp = MEM_U32(sp + 24);
+a0 = sp + 0xc0;
+if ((int)v0 >= 0) goto L417590;
+a0 = 0x100084c0;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L4175c8;
+L417590:
+a1 = 0x100084c4;
+//nop;
+a2 = MEM_U32(sp + 104);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = sp + 0xc0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L4175c8:
+// bdead 1 sp = sp + 0xf0;
+//nop;
+return;
+}
+
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4175d4:
+//st_auxadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 28) = ra;
+// fdead 400080eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L417624;
+a0 = 0x10001390;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+L417624:
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L417668;
+a0 = 0x100013cc;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417668:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x400;
+//nop;
+if (t9 == 0) goto L4176a8;
+a0 = 0x10001400;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4176a8:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 16);
+a0 = MEM_U32(t0 + 48);
+a1 = v1 + 0x10;
+a2 = 0x4;
+if ((int)a0 < (int)t1) goto L417708;
+//nop;
+a0 = MEM_U32(v1 + 12);
+a3 = 0x40;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x1000a9b0;
+v1 = 0x1000a9b0;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 12) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U32(t3 + 48);
+//nop;
+L417708:
+t4 = MEM_U32(v1 + 12);
+t7 = sp + 0x20;
+at = MEM_U32(t7 + 0);
+t5 = a0 << 2;
+t0 = 0x1000a9b0;
+t6 = t4 + t5;
+MEM_U32(t6 + 0) = at;
+t0 = MEM_U32(t0 + 0);
+//nop;
+a1 = MEM_U32(t0 + 0);
+//nop;
+v0 = MEM_U32(a1 + 48);
+//nop;
+t1 = v0 + 0x1;
+MEM_U32(a1 + 48) = t1;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L417754:
+//st_pdadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L4177a4;
+a0 = 0x10001390;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+L4177a4:
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L4177e8;
+a0 = 0x100013cc;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4177e8:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x100;
+//nop;
+if (t9 == 0) goto L417828;
+a0 = 0x10001400;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9b0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417828:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 56);
+a0 = MEM_U16(t0 + 42);
+a1 = v1 + 0x38;
+a2 = 0x34;
+if (a0 < t1) goto L417888;
+//nop;
+a0 = MEM_U32(v1 + 52);
+a3 = 0x20;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x1000a9b0;
+v1 = 0x1000a9b0;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 52) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U16(t3 + 42);
+//nop;
+L417888:
+a3 = 0x34;
+lo = a0 * a3;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a3 >> 32);
+t7 = 0x1000a940;
+t4 = MEM_U32(v1 + 52);
+t7 = t7;
+t9 = t7 + 0x30;
+t5 = lo;
+t6 = t4 + t5;
+//nop;
+L4178ac:
+at = MEM_U32(t7 + 0);
+t7 = t7 + 0xc;
+MEM_U32(t6 + 0) = at;
+at = MEM_U32(t7 + -8);
+t6 = t6 + 0xc;
+MEM_U32(t6 + -8) = at;
+at = MEM_U32(t7 + -4);
+MEM_U32(t6 + -4) = at;
+if (t7 != t9) goto L4178ac;
+at = MEM_U32(t7 + 0);
+v1 = 0x1000a9b0;
+MEM_U32(t6 + 0) = at;
+v1 = MEM_U32(v1 + 0);
+t0 = MEM_U32(sp + 32);
+t2 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 52);
+t3 = MEM_U16(t2 + 42);
+t8 = 0x1000a9b0;
+lo = t3 * a3;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)a3 >> 32);
+t4 = lo;
+t5 = t1 + t4;
+MEM_U32(t5 + 4) = t0;
+t8 = MEM_U32(t8 + 0);
+//nop;
+a1 = MEM_U32(t8 + 0);
+//nop;
+v0 = MEM_U16(a1 + 42);
+//nop;
+t9 = v0 + 0x1;
+MEM_U16(a1 + 42) = (uint16_t)t9;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L417ab0:
+//st_stradd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 40) = a0;
+if (a0 != 0) goto L417af8;
+a0 = 0x100084c8;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L417af8:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s2 = v0 + 0x1;
+t7 = 0x1000a9ac;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = MEM_U32(t7 + 4);
+//nop;
+//nop;
+if (t8 != 0) goto L417b4c;
+a0 = 0x10001390;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400801c1 gp = MEM_U32(sp + 32);
+//nop;
+L417b4c:
+s1 = 0x1000a9b0;
+//nop;
+s0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L417b84;
+a0 = 0x100013cc;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400c01c1 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L417b84:
+t9 = MEM_U32(s0 + 60);
+//nop;
+t0 = t9 & 0x80;
+//nop;
+if (t0 == 0) goto L417bb8;
+a0 = 0x10001400;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400c0001 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L417bb8:
+t1 = MEM_U32(s0 + 0);
+t2 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t1 + 12);
+//nop;
+t3 = v1 + s2;
+//nop;
+if ((int)t2 >= (int)t3) goto L417c24;
+L417bd8:
+//nop;
+a0 = MEM_U32(s0 + 20);
+a1 = s0 + 0x18;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(s1 + 0);
+// bdead 400c2009 gp = MEM_U32(sp + 32);
+MEM_U32(t4 + 20) = v0;
+s0 = MEM_U32(s1 + 0);
+//nop;
+t5 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t5 + 12);
+//nop;
+t7 = v1 + s2;
+//nop;
+if ((int)t6 < (int)t7) goto L417bd8;
+L417c24:
+t8 = MEM_U32(s0 + 20);
+//nop;
+a1 = MEM_U32(sp + 40);
+a0 = t8 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+t9 = MEM_U32(s1 + 0);
+// bdead 4080001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(t9 + 0);
+//nop;
+v0 = MEM_U32(a0 + 12);
+//nop;
+t0 = v0 + s2;
+MEM_U32(a0 + 12) = t0;
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L417cb0:
+//st_paux_ifd_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x1000a9ac;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L417d08;
+a0 = 0x10001390;
+//nop;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+//nop;
+L417d08:
+a1 = a3;
+if ((int)a3 < 0) goto L417d64;
+//nop;
+if ((int)a2 < 0) goto L417d64;
+v0 = 0x1000a9ac;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L417d64;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 48);
+//nop;
+//nop;
+if ((int)a2 < (int)t2) goto L417da4;
+L417d64:
+a0 = 0x100084e4;
+//nop;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+t4 = 0x1000a9ac;
+a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+v1 = t5 + t6;
+L417da4:
+t7 = MEM_U32(v1 + 12);
+// bdead 10081 ra = MEM_U32(sp + 28);
+t8 = a2 << 2;
+// bdead 2010001 sp = sp + 0x28;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L417fa0:
+//st_malloc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L417fe4;
+at = 0xffffffff;
+if (a0 == 0) goto L417fe4;
+t0 = v0 << 1;
+if (a0 != at) goto L418090;
+L417fe4:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41802c;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L418024;
+a0 = 0x10008554;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L418024:
+v0 = s1;
+goto L4180ec;
+L41802c:
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U32(sp + 48);
+//nop;
+lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4180e8;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(sp + 48);
+//nop;
+lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L4180ec;
+a0 = 0x10008590;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L4180ec;
+L418090:
+MEM_U32(s0 + 0) = t0;
+t2 = MEM_U32(sp + 48);
+//nop;
+lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4180e8;
+t3 = MEM_U32(s0 + 0);
+t4 = MEM_U32(sp + 48);
+a0 = 0x100085d0;
+lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+a1 = lo;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L4180e8:
+v0 = s1;
+L4180ec:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+//nop;
+}
+
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L41811c:
+//st_currentpchdr:
+//nop;
+//nop;
+//nop;
+v0 = 0x1000a9ac;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+return v0;
+}
+
+static uint32_t f_st_extstradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+L4184e8:
+//st_extstradd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+s1 = 0x1000a9ac;
+// fdead 4004006b MEM_U32(sp + 36) = ra;
+t6 = MEM_U32(s1 + 0);
+// fdead 4004806b MEM_U32(sp + 32) = gp;
+// fdead 4004806b MEM_U32(sp + 28) = s2;
+// fdead 4004806b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 40) = a0;
+if (t6 != 0) goto L418538;
+a0 = 0x10008610;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400401c1 gp = MEM_U32(sp + 32);
+//nop;
+L418538:
+t7 = MEM_U32(sp + 40);
+//nop;
+//nop;
+if (t7 != 0) goto L418564;
+a0 = 0x1000864c;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40040001 gp = MEM_U32(sp + 32);
+//nop;
+L418564:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+s0 = MEM_U32(s1 + 0);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(s0 + 40);
+t8 = MEM_U32(s0 + 44);
+t9 = v1 + v0;
+s2 = v0 + 0x1;
+if ((int)t9 < (int)t8) goto L4185d8;
+L418594:
+//nop;
+a0 = MEM_U32(s0 + 36);
+a1 = s0 + 0x2c;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t0 = MEM_U32(s1 + 0);
+// bdead 400c0209 gp = MEM_U32(sp + 32);
+MEM_U32(t0 + 36) = v0;
+s0 = MEM_U32(s1 + 0);
+//nop;
+v1 = MEM_U32(s0 + 40);
+t1 = MEM_U32(s0 + 44);
+t2 = v1 + s2;
+//nop;
+if ((int)t1 < (int)t2) goto L418594;
+L4185d8:
+t3 = MEM_U32(s0 + 36);
+//nop;
+a1 = MEM_U32(sp + 40);
+a0 = t3 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+s0 = MEM_U32(s1 + 0);
+// bdead a0001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(s0 + 40);
+//nop;
+t4 = v0 + s2;
+MEM_U32(s0 + 40) = t4;
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L41861c:
+//st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L418660;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L418660;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L418660:
+//nop;
+return v0;
+}
+
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t5 = 0, t6 = 0, t7 = 0, t9 = 0;
+L418668:
+//st_idn_dn:
+//nop;
+//nop;
+//nop;
+v1 = 0x1000a9ac;
+// fdead 7b sp = sp + 0xffffffd8;
+v1 = MEM_U32(v1 + 0);
+// fdead 7b MEM_U32(sp + 28) = ra;
+// fdead 7b MEM_U32(sp + 24) = gp;
+// fdead 7b MEM_U32(sp + 40) = a0;
+// fdead 7b MEM_U32(sp + 44) = a1;
+if (v1 != 0) goto L4186c0;
+a0 = 0x1000866c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4186c0:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L418714;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 827f MEM_U32(sp + 36) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 36);
+t7 = 0x1000a9ac;
+v1 = 0x1000a9ac;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418714:
+//nop;
+if (t0 != 0) goto L418744;
+//nop;
+a0 = MEM_U32(v1 + 56);
+a1 = 0x10;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418744:
+t1 = MEM_U32(v1 + 60);
+t9 = MEM_U32(v1 + 56);
+// fdead 401867f t8 = MEM_U32(sp + 40);
+t2 = t1 << 3;
+v1 = 0x1000a9ac;
+t3 = t9 + t2;
+// fdead 4019e7f MEM_U32(t3 + 0) = t8;
+v1 = MEM_U32(v1 + 0);
+// fdead 4019e7f t4 = MEM_U32(sp + 44);
+t6 = MEM_U32(v1 + 60);
+t5 = MEM_U32(v1 + 56);
+t7 = t6 << 3;
+v1 = 0x1000a9ac;
+t1 = t5 + t7;
+// fdead 401de7f MEM_U32(t1 + 4) = t4;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t9 = v0 + 0x1;
+MEM_U32(v1 + 60) = t9;
+// fdead 401de7f ra = MEM_U32(sp + 28);
+// fdead 401de7f sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L418a1c:
+//st_setidn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a2 = a0;
+if ((int)a0 < 0) goto L418a70;
+//nop;
+if ((int)a1 < 0) goto L418a70;
+v1 = 0x1000a9ac;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+if ((int)a0 >= (int)v0) {
+at = (int)a1 < (int)v0;
+goto L418a70;}
+//nop;
+if ((int)a1 < (int)v0) goto L418aa0;
+L418a70:
+a0 = 0x10008760;
+//nop;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 32) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+v1 = 0x1000a9ac;
+a2 = MEM_U32(sp + 32);
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418aa0:
+v0 = MEM_U32(v1 + 56);
+t8 = a1 << 3;
+t9 = v0 + t8;
+at = MEM_U32(t9 + 0);
+t6 = a2 << 3;
+t7 = v0 + t6;
+MEM_U32(t7 + 0) = at;
+t2 = MEM_U32(t9 + 4);
+//nop;
+MEM_U32(t7 + 4) = t2;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t func_419e30(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L419e30:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffe0;
+// fdead 1eb t6 = MEM_U32(sp + 48);
+// fdead 1eb MEM_U32(sp + 28) = ra;
+// fdead 1eb MEM_U32(sp + 24) = gp;
+// fdead 1eb MEM_U32(sp + 32) = a0;
+// fdead 1eb MEM_U32(sp + 40) = a2;
+// fdead 1eb MEM_U32(sp + 44) = a3;
+if (t6 != 0) goto L419e64;
+v0 = zero;
+goto L419efc;
+L419e64:
+//nop;
+if (a1 != 0) goto L419eb0;
+//nop;
+// fdead 1eb a0 = MEM_U32(sp + 32);
+// fdead 1eb a1 = MEM_U32(sp + 40);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// fdead b t7 = MEM_U32(sp + 40);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == t7) goto L419eb0;
+a0 = 0x1000890c;
+//nop;
+a0 = a0;
+//nop;
+f_st_warning(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+v0 = 0xfffffffb;
+goto L419efc;
+L419eb0:
+//nop;
+// fdead 1eb a0 = MEM_U32(sp + 32);
+// fdead 1eb a1 = MEM_U32(sp + 44);
+// fdead 1eb a2 = MEM_U32(sp + 48);
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+// fdead b t8 = MEM_U32(sp + 48);
+// fdead b gp = MEM_U32(sp + 24);
+if (v0 == t8) {
+v0 = zero;
+goto L419efc;}
+v0 = zero;
+a0 = 0x10008924;
+//nop;
+a0 = a0;
+//nop;
+f_st_warning(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+v0 = 0xfffffffa;
+goto L419efc;
+// fdead 0 v0 = zero;
+L419efc:
+// fdead 1eb ra = MEM_U32(sp + 28);
+// fdead 1eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_writebinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L419f0c:
+//st_writebinary:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 40000063 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 44) = a1;
+// fdead 40000063 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+a1 = 0x102;
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if ((int)v0 >= 0) goto L419f64;
+a0 = 0x1000893c;
+//nop;
+a1 = MEM_U32(sp + 40);
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L419f64:
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = MEM_U32(sp + 44);
+//nop;
+f_st_writest(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_st_writest(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+L419fa0:
+//st_writest:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffe28;
+//nop;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 60) = ra;
+MEM_U32(sp + 476) = a1;
+// fdead 4002006b MEM_U32(sp + 56) = fp;
+// fdead 4002006b MEM_U32(sp + 52) = gp;
+// fdead 4002006b MEM_U32(sp + 48) = s7;
+// fdead 4002006b MEM_U32(sp + 44) = s6;
+// fdead 4002006b MEM_U32(sp + 40) = s5;
+// fdead 4002006b MEM_U32(sp + 36) = s4;
+// fdead 4002006b MEM_U32(sp + 32) = s3;
+// fdead 4002006b MEM_U32(sp + 28) = s2;
+// fdead 4002006b MEM_U32(sp + 24) = s1;
+a1 = 0x48;
+a0 = sp + 0x18c;
+MEM_U32(sp + 288) = zero;
+wrapper_bzero(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+a0 = sp + 0x128;
+//nop;
+a1 = 0x60;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 276) = v0;
+//nop;
+a0 = s0;
+a1 = zero;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 272) = v0;
+//nop;
+a0 = s0;
+a1 = 0x60;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+t6 = MEM_U32(sp + 276);
+t7 = 0x1000a9ac;
+MEM_U32(sp + 284) = v0;
+t7 = MEM_U32(t7 + 0);
+a0 = s0;
+MEM_U32(t7 + 12) = t6;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_dup(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10008960;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_fdopen(mem, a0, a1);
+// bdead 4002018b gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+MEM_U32(sp + 268) = v0;
+if (v0 != 0) goto L41a0dc;
+a0 = 0x10008964;
+//nop;
+a1 = s0;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41a0dc:
+t8 = MEM_U32(sp + 476);
+//nop;
+t9 = t8 & 0x4;
+t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L41a480;
+t4 = MEM_U32(sp + 276);
+s6 = 0xffffffff;
+t9 = MEM_U32(sp + 300);
+if ((int)t4 <= 0) goto L41a3fc;
+MEM_U32(sp + 280) = zero;
+fp = sp + 0x68;
+L41a108:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 292) = zero;
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(v0 + 0);
+// bdead c080418b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t5;
+v1 = MEM_U32(t5 + 28);
+t2 = MEM_U32(sp + 292);
+t3 = MEM_U32(sp + 288);
+t1 = v0;
+if (v1 == 0) goto L41a3e4;
+t7 = MEM_U32(v0 + 36);
+t8 = MEM_U32(sp + 300);
+t4 = t8 + v1;
+if (t7 == 0) goto L41a3e4;
+MEM_U32(t5 + 24) = t8;
+MEM_U32(sp + 300) = t4;
+MEM_U32(t5 + 64) = t3;
+MEM_U32(sp + 264) = zero;
+s1 = MEM_U16(t5 + 42);
+//nop;
+t8 = MEM_U32(sp + 392);
+if (s1 == 0) goto L41a3dc;
+MEM_U32(sp + 88) = zero;
+L41a170:
+t5 = MEM_U32(t1 + 52);
+t6 = MEM_U32(sp + 88);
+//nop;
+t0 = t5 + t6;
+t7 = MEM_U32(t0 + 8);
+//nop;
+t4 = MEM_U32(sp + 264);
+if (s6 == t7) goto L41a3bc;
+t8 = MEM_U32(t0 + 40);
+//nop;
+t4 = MEM_U32(sp + 264);
+if (s6 == t8) goto L41a3bc;
+t4 = MEM_U32(t0 + 44);
+t9 = MEM_U32(sp + 392);
+if (s6 == t4) {
+t4 = MEM_U32(sp + 264);
+goto L41a3bc;}
+t4 = MEM_U32(sp + 264);
+t5 = MEM_U32(t9 + 64);
+a0 = zero;
+t6 = t3 - t5;
+MEM_U32(t0 + 48) = t6;
+t7 = MEM_U32(sp + 392);
+//nop;
+s1 = MEM_U16(t7 + 42);
+a1 = MEM_U32(t7 + 28);
+//nop;
+if (s1 == 0) goto L41a230;
+a2 = MEM_U32(t0 + 8);
+v1 = MEM_U32(t1 + 52);
+//nop;
+L41a1e4:
+v0 = MEM_U32(v1 + 8);
+a0 = a0 + 0x1;
+if ((int)a2 >= (int)v0) {
+at = a0 < s1;
+goto L41a228;}
+at = a0 < s1;
+t8 = MEM_U32(v1 + 40);
+//nop;
+at = a0 < s1;
+if (s6 == t8) goto L41a228;
+t4 = MEM_U32(v1 + 44);
+at = (int)v0 < (int)a1;
+//nop;
+if (s6 == t4) goto L41a224;
+if (at == 0) {
+at = a0 < s1;
+goto L41a228;}
+at = a0 < s1;
+a1 = v0;
+L41a224:
+at = a0 < s1;
+L41a228:
+v1 = v1 + 0x34;
+if (at != 0) goto L41a1e4;
+L41a230:
+t4 = MEM_U32(sp + 264);
+if ((int)a1 <= 0) goto L41a3bc;
+a2 = MEM_U32(t0 + 8);
+s2 = s6;
+t9 = a2 << 2;
+if ((int)a2 < 0) goto L41a3b8;
+v0 = MEM_U32(t1 + 36);
+s7 = a1 << 2;
+s3 = v0 + t9;
+v1 = v0 + s7;
+s5 = MEM_U32(t0 + 40);
+at = v1 < s3;
+s4 = zero;
+s0 = fp;
+if (at != 0) goto L41a3b8;
+L41a26c:
+at = 0x8;
+if (s3 != v1) goto L41a27c;
+v1 = 0x1;
+goto L41a2a4;
+L41a27c:
+v0 = MEM_U32(s3 + 0);
+//nop;
+a0 = v0;
+if (v0 != 0) goto L41a298;
+a0 = MEM_U32(t0 + 40);
+v1 = a0 - s5;
+goto L41a29c;
+L41a298:
+v1 = a0 - s5;
+L41a29c:
+t5 = v1 << 16;
+v1 = (int)t5 >> 16;
+L41a2a4:
+a0 = fp;
+if (v1 != 0) goto L41a2b4;
+v0 = s0 + 0x3;
+if (s2 != at) goto L41a31c;
+L41a2b4:
+s5 = s5 + v1;
+if (s2 == s6) goto L41a2e0;
+if ((int)s4 < (int)0xfffffff9) {
+at = (int)s4 < (int)0x8;
+goto L41a2e0;}
+t4 = s4 << 4;
+if ((int)s4 >= (int)0x8) goto L41a2e0;
+t9 = t4 | s2;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+s0 = s0 + 0x1;
+goto L41a304;
+L41a2e0:
+t7 = (int)s4 >> 8;
+if (s2 == s6) goto L41a304;
+MEM_U8(s0 + 0) = (uint8_t)s2;
+t5 = MEM_S8(s0 + 0);
+MEM_U8(s0 + 1) = (uint8_t)t7;
+t6 = t5 | 0x80;
+MEM_U8(s0 + 0) = (uint8_t)t6;
+MEM_U8(s0 + 2) = (uint8_t)s4;
+s0 = s0 + 0x3;
+L41a304:
+s4 = v1 << 16;
+t4 = (int)s4 >> 16;
+s2 = zero;
+s4 = t4;
+v0 = s0 + 0x3;
+goto L41a320;
+L41a31c:
+s2 = s2 + 0x1;
+L41a320:
+t9 = sp + 0xe8;
+s1 = s0 - fp;
+if (v0 >= t9) goto L41a34c;
+t5 = MEM_U32(t1 + 36);
+t6 = s0 - fp;
+v1 = t5 + s7;
+//nop;
+if (s3 != v1) goto L41a398;
+//nop;
+if ((int)t6 <= 0) goto L41a398;
+L41a34c:
+//nop;
+a3 = MEM_U32(sp + 268);
+a1 = s1;
+a2 = 0x1;
+MEM_U32(sp + 252) = t0;
+MEM_U32(sp + 468) = t1;
+MEM_U32(sp + 292) = t2;
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t1 = MEM_U32(sp + 468);
+t2 = MEM_U32(sp + 292);
+t3 = MEM_U32(sp + 288);
+t7 = MEM_U32(t1 + 36);
+// bdead c1fd1d83 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 252);
+s0 = fp;
+t2 = t2 + s1;
+t3 = t3 + s1;
+v1 = t7 + s7;
+L41a398:
+s3 = s3 + 0x4;
+//nop;
+if (v1 >= s3) goto L41a26c;
+t8 = MEM_U32(sp + 392);
+//nop;
+s1 = MEM_U16(t8 + 42);
+//nop;
+L41a3b8:
+t4 = MEM_U32(sp + 264);
+L41a3bc:
+t5 = MEM_U32(sp + 88);
+t9 = t4 + 0x1;
+at = t9 < s1;
+t6 = t5 + 0x34;
+MEM_U32(sp + 88) = t6;
+MEM_U32(sp + 264) = t9;
+if (at != 0) goto L41a170;
+t8 = MEM_U32(sp + 392);
+L41a3dc:
+//nop;
+MEM_U32(t8 + 68) = t2;
+L41a3e4:
+v0 = MEM_U32(sp + 280);
+t4 = MEM_U32(sp + 276);
+v0 = v0 + 0x1;
+MEM_U32(sp + 280) = v0;
+if (v0 != t4) goto L41a108;
+t9 = MEM_U32(sp + 300);
+L41a3fc:
+s0 = -t3;
+t5 = s0 & 0x3;
+if (t9 == 0) goto L41a47c;
+s0 = t5;
+if (t5 == 0) goto L41a470;
+a0 = 0x1000a980;
+//nop;
+a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+a2 = t5;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400201cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L41a460;
+a0 = 0x10008990;
+//nop;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41a460:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t6 = t3 & at;
+t3 = t6;
+L41a470:
+t7 = MEM_U32(sp + 284);
+MEM_U32(sp + 304) = t3;
+MEM_U32(sp + 308) = t7;
+L41a47c:
+t8 = MEM_U32(sp + 476);
+L41a480:
+//nop;
+t4 = t8 & 0x100;
+t5 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41a5a0;
+t9 = MEM_U32(sp + 284);
+t6 = MEM_U32(sp + 276);
+t5 = t9 + t3;
+MEM_U32(sp + 284) = t5;
+t3 = zero;
+if ((int)t6 <= 0) goto L41a588;
+s2 = 0x10001464;
+MEM_U32(sp + 280) = zero;
+s0 = 0x34;
+L41a4b4:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(v0 + 0);
+t8 = MEM_U16(sp + 436);
+MEM_U32(sp + 392) = t7;
+s1 = MEM_U16(t7 + 42);
+t4 = MEM_U16(sp + 438);
+lo = s1 * s0;
+hi = (uint32_t)((uint64_t)s1 * (uint64_t)s0 >> 32);
+t3 = MEM_U32(sp + 288);
+// bdead 4420f300b gp = MEM_U32(sp + 52);
+t9 = t8 + t4;
+MEM_U16(t7 + 40) = (uint16_t)t9;
+a3 = MEM_U32(sp + 268);
+a1 = s0;
+a2 = s1;
+a0 = lo;
+t3 = t3 + a0;
+t8 = MEM_U16(sp + 436);
+if (s1 == 0) goto L41a550;
+//nop;
+a0 = MEM_U32(v0 + 52);
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 392);
+// bdead 400a81cb gp = MEM_U32(sp + 52);
+t7 = MEM_U16(t6 + 42);
+t3 = MEM_U32(sp + 288);
+t8 = MEM_U16(sp + 436);
+if (v0 == t7) goto L41a550;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+t8 = MEM_U16(sp + 436);
+L41a550:
+t4 = MEM_U16(sp + 438);
+t5 = MEM_U32(sp + 392);
+t9 = t8 + t4;
+MEM_U16(sp + 436) = (uint16_t)t9;
+v0 = MEM_U16(t5 + 42);
+v1 = MEM_U32(sp + 280);
+t6 = MEM_U32(sp + 320);
+t8 = MEM_U32(sp + 276);
+v1 = v1 + 0x1;
+t7 = t6 + v0;
+MEM_U32(sp + 320) = t7;
+MEM_U32(sp + 280) = v1;
+MEM_U16(sp + 438) = (uint16_t)v0;
+if (v1 != t8) goto L41a4b4;
+L41a588:
+t4 = MEM_U32(sp + 320);
+t9 = MEM_U32(sp + 284);
+t5 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41a5a0;
+MEM_U32(sp + 324) = t9;
+t5 = MEM_U32(sp + 476);
+L41a5a0:
+s2 = 0x10001464;
+t6 = t5 & 0x2;
+t9 = MEM_U32(sp + 476);
+if (t6 == 0) goto L41a6b8;
+t7 = MEM_U32(sp + 284);
+t4 = MEM_U32(sp + 276);
+t8 = t7 + t3;
+MEM_U32(sp + 284) = t8;
+t3 = zero;
+if ((int)t4 <= 0) goto L41a6a0;
+MEM_U32(sp + 280) = zero;
+s0 = 0xc;
+L41a5d0:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+t5 = MEM_U32(sp + 412);
+MEM_U32(sp + 392) = t9;
+a2 = MEM_U32(t9 + 20);
+t6 = MEM_U32(sp + 416);
+lo = a2 * s0;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+t3 = MEM_U32(sp + 288);
+// bdead 4440ad08b gp = MEM_U32(sp + 52);
+t7 = t5 + t6;
+MEM_U32(t9 + 16) = t7;
+a3 = MEM_U32(sp + 268);
+a1 = s0;
+a0 = lo;
+t3 = t3 + a0;
+t5 = MEM_U32(sp + 412);
+if (a2 == 0) goto L41a668;
+//nop;
+a0 = MEM_U32(v0 + 4);
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t4 = MEM_U32(sp + 392);
+// bdead 400a21cb gp = MEM_U32(sp + 52);
+t9 = MEM_U32(t4 + 20);
+t3 = MEM_U32(sp + 288);
+t5 = MEM_U32(sp + 412);
+if (v0 == t9) goto L41a668;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+t5 = MEM_U32(sp + 412);
+L41a668:
+t6 = MEM_U32(sp + 416);
+t8 = MEM_U32(sp + 392);
+t7 = t5 + t6;
+MEM_U32(sp + 412) = t7;
+a0 = MEM_U32(t8 + 20);
+t5 = MEM_U32(sp + 280);
+t4 = MEM_U32(sp + 328);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + 0x1;
+t9 = t4 + a0;
+MEM_U32(sp + 328) = t9;
+MEM_U32(sp + 280) = t6;
+MEM_U32(sp + 416) = a0;
+if (t6 != t7) goto L41a5d0;
+L41a6a0:
+t8 = MEM_U32(sp + 328);
+t4 = MEM_U32(sp + 284);
+t9 = MEM_U32(sp + 476);
+if (t8 == 0) goto L41a6b8;
+MEM_U32(sp + 332) = t4;
+t9 = MEM_U32(sp + 476);
+L41a6b8:
+s0 = 0xc;
+t5 = t9 & 0x20;
+t4 = MEM_U32(sp + 476);
+if (t5 == 0) goto L41a7cc;
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 276);
+t7 = t6 + t3;
+MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L41a7b4;
+MEM_U32(sp + 280) = zero;
+L41a6e4:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(v0 + 0);
+t9 = MEM_U32(sp + 428);
+MEM_U32(sp + 392) = t4;
+a2 = MEM_U32(t4 + 36);
+t5 = MEM_U32(sp + 432);
+lo = a2 * s0;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+t3 = MEM_U32(sp + 288);
+// bdead 4440a708b gp = MEM_U32(sp + 52);
+t6 = t9 + t5;
+MEM_U32(t4 + 32) = t6;
+a3 = MEM_U32(sp + 268);
+a1 = s0;
+a0 = lo;
+t3 = t3 + a0;
+t9 = MEM_U32(sp + 428);
+if (a2 == 0) goto L41a77c;
+//nop;
+a0 = MEM_U32(v0 + 28);
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 392);
+// bdead 420a01cb gp = MEM_U32(sp + 52);
+t4 = MEM_U32(t8 + 36);
+t3 = MEM_U32(sp + 288);
+t9 = MEM_U32(sp + 428);
+if (v0 == t4) goto L41a77c;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+t9 = MEM_U32(sp + 428);
+L41a77c:
+t5 = MEM_U32(sp + 432);
+t7 = MEM_U32(sp + 392);
+t6 = t9 + t5;
+MEM_U32(sp + 428) = t6;
+a0 = MEM_U32(t7 + 36);
+t9 = MEM_U32(sp + 280);
+t8 = MEM_U32(sp + 336);
+t6 = MEM_U32(sp + 276);
+t5 = t9 + 0x1;
+t4 = t8 + a0;
+MEM_U32(sp + 336) = t4;
+MEM_U32(sp + 280) = t5;
+MEM_U32(sp + 432) = a0;
+if (t5 != t6) goto L41a6e4;
+L41a7b4:
+t7 = MEM_U32(sp + 336);
+t8 = MEM_U32(sp + 284);
+t4 = MEM_U32(sp + 476);
+if (t7 == 0) goto L41a7cc;
+MEM_U32(sp + 340) = t8;
+t4 = MEM_U32(sp + 476);
+L41a7cc:
+//nop;
+t9 = t4 & 0x400;
+t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L41a8d8;
+t5 = MEM_U32(sp + 284);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + t3;
+MEM_U32(sp + 284) = t6;
+t3 = zero;
+if ((int)t7 <= 0) goto L41a8c0;
+MEM_U32(sp + 280) = zero;
+L41a7f8:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 440);
+MEM_U32(sp + 392) = t8;
+t9 = MEM_U32(sp + 444);
+a2 = MEM_U32(t8 + 48);
+t3 = MEM_U32(sp + 288);
+// bdead 4608318b gp = MEM_U32(sp + 52);
+t5 = t4 + t9;
+a0 = a2 << 2;
+MEM_U32(t8 + 44) = t5;
+t3 = t3 + a0;
+if (a2 == 0) goto L41a884;
+//nop;
+a0 = MEM_U32(v0 + 12);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a1 = 0x4;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t7 = MEM_U32(sp + 392);
+// bdead 400901cb gp = MEM_U32(sp + 52);
+t8 = MEM_U32(t7 + 48);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(sp + 440);
+if (v0 == t8) goto L41a888;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41a884:
+t4 = MEM_U32(sp + 440);
+L41a888:
+t9 = MEM_U32(sp + 444);
+t6 = MEM_U32(sp + 392);
+t5 = t4 + t9;
+MEM_U32(sp + 440) = t5;
+a0 = MEM_U32(t6 + 48);
+t4 = MEM_U32(sp + 280);
+t7 = MEM_U32(sp + 344);
+t5 = MEM_U32(sp + 276);
+t9 = t4 + 0x1;
+t8 = t7 + a0;
+MEM_U32(sp + 344) = t8;
+MEM_U32(sp + 280) = t9;
+MEM_U32(sp + 444) = a0;
+if (t9 != t5) goto L41a7f8;
+L41a8c0:
+t6 = MEM_U32(sp + 344);
+t7 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 476);
+if (t6 == 0) goto L41a8d8;
+MEM_U32(sp + 348) = t7;
+t8 = MEM_U32(sp + 476);
+L41a8d8:
+//nop;
+t4 = t8 & 0x80;
+t8 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41aa50;
+t9 = MEM_U32(sp + 284);
+t6 = MEM_U32(sp + 276);
+t5 = t9 + t3;
+MEM_U32(sp + 284) = t5;
+t3 = zero;
+if ((int)t6 <= 0) goto L41a9c8;
+MEM_U32(sp + 280) = zero;
+L41a904:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(v0 + 0);
+t8 = MEM_U32(sp + 404);
+t4 = MEM_U32(sp + 408);
+MEM_U32(sp + 392) = t7;
+t3 = MEM_U32(sp + 288);
+a2 = MEM_U32(t7 + 12);
+// bdead 4209318b gp = MEM_U32(sp + 52);
+t9 = t8 + t4;
+MEM_U32(t7 + 8) = t9;
+t3 = t3 + a2;
+if (a2 == 0) goto L41a98c;
+//nop;
+a0 = MEM_U32(v0 + 20);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a1 = 0x1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 392);
+// bdead 400881cb gp = MEM_U32(sp + 52);
+t7 = MEM_U32(t6 + 12);
+t3 = MEM_U32(sp + 288);
+t8 = MEM_U32(sp + 404);
+if (v0 == t7) goto L41a990;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41a98c:
+t8 = MEM_U32(sp + 404);
+L41a990:
+t4 = MEM_U32(sp + 408);
+t5 = MEM_U32(sp + 392);
+t9 = t8 + t4;
+MEM_U32(sp + 404) = t9;
+a0 = MEM_U32(t5 + 12);
+t8 = MEM_U32(sp + 280);
+t6 = MEM_U32(sp + 352);
+t9 = MEM_U32(sp + 276);
+t4 = t8 + 0x1;
+t7 = t6 + a0;
+MEM_U32(sp + 352) = t7;
+MEM_U32(sp + 280) = t4;
+MEM_U32(sp + 408) = a0;
+if (t4 != t9) goto L41a904;
+L41a9c8:
+s0 = -t3;
+t5 = s0 & 0x3;
+s0 = t5;
+if (t5 == 0) goto L41aa38;
+a0 = 0x1000a980;
+//nop;
+a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+a2 = t5;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L41aa28;
+a0 = 0x100089b4;
+//nop;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41aa28:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t6 = t3 & at;
+t3 = t6;
+L41aa38:
+MEM_U32(sp + 352) = t3;
+if (t3 == 0) goto L41aa4c;
+t7 = MEM_U32(sp + 284);
+//nop;
+MEM_U32(sp + 356) = t7;
+L41aa4c:
+t8 = MEM_U32(sp + 476);
+L41aa50:
+//nop;
+t4 = t8 & 0x800;
+t7 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41ab6c;
+t0 = 0x1000a9ac;
+t5 = MEM_U32(sp + 284);
+v0 = MEM_U32(t0 + 0);
+t6 = t5 + t3;
+t9 = MEM_U32(v0 + 40);
+MEM_U32(sp + 284) = t6;
+t3 = zero;
+MEM_U32(sp + 360) = t9;
+if (t9 == 0) goto L41aaf4;
+t3 = MEM_U32(v0 + 40);
+MEM_U32(sp + 364) = t6;
+v1 = MEM_U32(v0 + 40);
+a1 = 0x1;
+a2 = v1;
+if (v1 == 0) goto L41aaf4;
+//nop;
+a0 = MEM_U32(v0 + 36);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400801cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t8 = 0x1000a9ac;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t4 = MEM_U32(t8 + 40);
+//nop;
+s0 = -t3;
+if (v0 == t4) goto L41aaf8;
+//nop;
+a0 = 0x10001478;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41aaf4:
+s0 = -t3;
+L41aaf8:
+t9 = s0 & 0x3;
+s0 = t9;
+if (t9 == 0) goto L41ab64;
+a2 = t9;
+//nop;
+a0 = 0x1000a980;
+a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L41ab54;
+a0 = 0x100089dc;
+//nop;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41ab54:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t5 = t3 & at;
+t3 = t5;
+L41ab64:
+MEM_U32(sp + 360) = t3;
+t7 = MEM_U32(sp + 476);
+L41ab6c:
+t0 = 0x1000a9ac;
+s1 = 0x10001478;
+t6 = t7 & 0x200;
+t4 = MEM_U32(sp + 476);
+if (t6 == 0) goto L41ac2c;
+v0 = MEM_U32(t0 + 0);
+t4 = MEM_U32(sp + 284);
+t8 = MEM_U32(v0 + 12);
+t9 = t4 + t3;
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+MEM_U32(sp + 368) = t8;
+if (t8 == 0) goto L41ac20;
+t3 = MEM_U32(v0 + 12);
+MEM_U32(sp + 372) = t9;
+t7 = t3 << 3;
+v1 = MEM_U32(v0 + 12);
+t7 = t7 + t3;
+t7 = t7 << 3;
+t3 = t7;
+if (v1 == 0) goto L41ac20;
+//nop;
+a0 = MEM_U32(v0 + 8);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t7;
+a1 = 0x48;
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400c01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t6 = 0x1000a9ac;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t8 = MEM_U32(t6 + 12);
+//nop;
+//nop;
+if (v0 == t8) goto L41ac20;
+//nop;
+a0 = s1;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400c0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41ac20:
+t0 = 0x1000a9ac;
+//nop;
+t4 = MEM_U32(sp + 476);
+L41ac2c:
+t7 = MEM_U32(sp + 284);
+t5 = t4 & 0x40;
+t9 = t7 + t3;
+if (t5 == 0) goto L41ad34;
+t6 = MEM_U32(sp + 276);
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+if ((int)t6 <= 0) goto L41ad20;
+MEM_U32(sp + 280) = zero;
+L41ac50:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 448);
+MEM_U32(sp + 392) = t8;
+t5 = MEM_U32(sp + 452);
+a2 = MEM_U32(t8 + 56);
+t3 = MEM_U32(sp + 288);
+// bdead 420c718b gp = MEM_U32(sp + 52);
+t7 = t4 + t5;
+a0 = a2 << 2;
+MEM_U32(t8 + 52) = t7;
+t3 = t3 + a0;
+if (a2 == 0) goto L41acdc;
+//nop;
+a0 = MEM_U32(v0 + 44);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a1 = 0x4;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 392);
+// bdead 400c81cb gp = MEM_U32(sp + 52);
+t8 = MEM_U32(t6 + 56);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(sp + 448);
+if (v0 == t8) goto L41ace0;
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400c0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41acdc:
+t4 = MEM_U32(sp + 448);
+L41ace0:
+t5 = MEM_U32(sp + 452);
+t9 = MEM_U32(sp + 392);
+t7 = t4 + t5;
+MEM_U32(sp + 448) = t7;
+a0 = MEM_U32(t9 + 56);
+t4 = MEM_U32(sp + 280);
+t6 = MEM_U32(sp + 376);
+t7 = MEM_U32(sp + 276);
+t5 = t4 + 0x1;
+t8 = t6 + a0;
+MEM_U32(sp + 376) = t8;
+MEM_U32(sp + 280) = t5;
+MEM_U32(sp + 452) = a0;
+if (t5 != t7) goto L41ac50;
+t0 = 0x1000a9ac;
+//nop;
+L41ad20:
+t9 = MEM_U32(sp + 376);
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L41ad38;
+MEM_U32(sp + 380) = t6;
+L41ad34:
+t8 = MEM_U32(sp + 476);
+L41ad38:
+//nop;
+t4 = t8 & 0x1;
+t7 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41adec;
+v0 = MEM_U32(t0 + 0);
+t7 = MEM_U32(sp + 284);
+t5 = MEM_U32(v0 + 28);
+t9 = t7 + t3;
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+MEM_U32(sp + 384) = t5;
+if (t5 == 0) goto L41ade0;
+t3 = MEM_U32(v0 + 28);
+MEM_U32(sp + 388) = t9;
+v1 = MEM_U32(v0 + 28);
+t8 = t3 << 4;
+t3 = t8;
+if (v1 == 0) goto L41ade0;
+//nop;
+a0 = MEM_U32(v0 + 24);
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t8;
+a1 = 0x10;
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t4 = 0x1000a9ac;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 28);
+//nop;
+//nop;
+if (v0 == t5) goto L41ade0;
+//nop;
+a0 = s1;
+MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40040003 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+//nop;
+L41ade0:
+t0 = 0x1000a9ac;
+//nop;
+t7 = MEM_U32(sp + 476);
+L41adec:
+//nop;
+t6 = t7 & 0x10;
+//nop;
+if (t6 == 0) goto L41aedc;
+v0 = MEM_U32(t0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 60);
+//nop;
+//nop;
+if (t8 == 0) goto L41aedc;
+t9 = MEM_U32(v0 + 56);
+//nop;
+MEM_U32(t9 + 0) = zero;
+t4 = MEM_U32(t0 + 0);
+//nop;
+t5 = MEM_U32(t4 + 56);
+//nop;
+MEM_U32(t5 + 4) = zero;
+t7 = MEM_U32(t0 + 0);
+//nop;
+t6 = MEM_U32(t7 + 56);
+//nop;
+MEM_U32(t6 + 8) = zero;
+t8 = MEM_U32(t0 + 0);
+//nop;
+t9 = MEM_U32(t8 + 56);
+//nop;
+MEM_U32(t9 + 12) = zero;
+v0 = MEM_U32(t0 + 0);
+t5 = MEM_U32(sp + 284);
+t4 = MEM_U32(v0 + 60);
+t7 = t5 + t3;
+MEM_U32(sp + 284) = t7;
+MEM_U32(sp + 312) = t4;
+if (t4 == 0) goto L41aedc;
+MEM_U32(sp + 316) = t7;
+v1 = MEM_U32(v0 + 60);
+a3 = MEM_U32(sp + 268);
+a1 = 0x8;
+if (v1 == 0) goto L41aedc;
+//nop;
+a0 = MEM_U32(v0 + 56);
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 52);
+//nop;
+t8 = 0x1000a9ac;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t9 = MEM_U32(t8 + 60);
+//nop;
+//nop;
+if (v0 == t9) goto L41aedc;
+//nop;
+a0 = s1;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+//nop;
+L41aedc:
+//nop;
+a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 268);
+//nop;
+a1 = MEM_U32(sp + 272);
+a2 = zero;
+v0 = wrapper_fseek(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+t4 = 0x313;
+t5 = 0x10001460;
+//nop;
+t5 = MEM_S16(t5 + 0);
+a3 = MEM_U32(sp + 268);
+MEM_U16(sp + 298) = (uint16_t)t4;
+a0 = sp + 0x128;
+a1 = 0x1;
+a2 = 0x60;
+MEM_U16(sp + 296) = (uint16_t)t5;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400001c9 gp = MEM_U32(sp + 52);
+at = 0x60;
+//nop;
+if (v0 == at) goto L41af60;
+a0 = 0x10008a04;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+//nop;
+L41af60:
+//nop;
+a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 gp = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x1d8;
+return;
+}
+
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L41afc4:
+//gethostsex:
+sp = sp + 0xfffffff8;
+t6 = 0x1;
+MEM_U32(sp + 4) = t6;
+t7 = MEM_S8(sp + 4);
+at = 0x1;
+v0 = zero;
+if (t7 != at) goto L41afe8;
+v0 = 0x1;
+goto L41afe8;
+L41afe8:
+// bdead 9 sp = sp + 0x8;
+return v0;
+//nop;
+}
+
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L41b624:
+//swap_hdr:
+// fdead 4b MEM_U32(sp + 4) = a1;
+// fdead 4b v1 = MEM_S16(a0 + 0);
+// fdead 4b a1 = MEM_S16(a0 + 2);
+// fdead 4b t8 = v1 & 0xffff;
+// fdead 4b t9 = t8 >> 8;
+// fdead 4b t7 = v1 << 8;
+// fdead 4b a2 = MEM_U32(a0 + 4);
+// fdead 4b t1 = t7 | t9;
+t4 = a1 & 0xffff;
+v0 = 0xff0000;
+t5 = t4 >> 8;
+t3 = a1 << 8;
+// fdead 704b t7 = a2 << 8;
+// fdead 704b MEM_U16(a0 + 0) = (uint16_t)t1;
+t6 = t3 | t5;
+// fdead f04b t9 = t7 & v0;
+// fdead f04b t8 = a2 << 24;
+// fdead f04b a3 = MEM_U32(a0 + 8);
+// fdead f04b t1 = t8 | t9;
+// fdead f04b t2 = (int)a2 >> 8;
+// fdead f04b t4 = t2 & 0xff00;
+// fdead f04b MEM_U16(a0 + 2) = (uint16_t)t6;
+// fdead f04b t3 = t1 | t4;
+// fdead f04b t5 = a2 >> 24;
+// fdead f04b t8 = a3 << 8;
+t6 = t3 | t5;
+// fdead f04b t9 = t8 & v0;
+// fdead f04b t7 = a3 << 24;
+// fdead f04b t0 = MEM_U32(a0 + 12);
+// fdead f04b t2 = t7 | t9;
+// fdead f04b t1 = (int)a3 >> 8;
+// fdead f04b t4 = t1 & 0xff00;
+// fdead f04b MEM_U32(a0 + 4) = t6;
+// fdead f04b t3 = t2 | t4;
+// fdead f04b t5 = a3 >> 24;
+// fdead f04b t7 = t0 << 8;
+t6 = t3 | t5;
+// fdead f04b t9 = t7 & v0;
+// fdead f04b t8 = t0 << 24;
+// fdead f04b v1 = MEM_U32(a0 + 16);
+// fdead f04b t1 = t8 | t9;
+// fdead f04b t2 = (int)t0 >> 8;
+// fdead f04b t4 = t2 & 0xff00;
+// fdead f04b MEM_U32(a0 + 8) = t6;
+// fdead f04b t3 = t1 | t4;
+// fdead f04b t5 = t0 >> 24;
+// fdead f04b t8 = v1 << 8;
+t6 = t3 | t5;
+// fdead f04b t9 = t8 & v0;
+// fdead f04b t7 = v1 << 24;
+// fdead f04b a1 = MEM_U32(a0 + 20);
+// fdead f04b t2 = t7 | t9;
+// fdead f04b t1 = (int)v1 >> 8;
+// fdead f04b t4 = t1 & 0xff00;
+// fdead f04b MEM_U32(a0 + 12) = t6;
+// fdead f04b t3 = t2 | t4;
+// fdead f04b t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+// fdead 601f04b a2 = MEM_U32(a0 + 24);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 16) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+// fdead 601fc4b a3 = MEM_U32(a0 + 28);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 20) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+// fdead 601fc4b v1 = MEM_U32(a0 + 32);
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 24) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+// fdead 601fc4b a1 = MEM_U32(a0 + 36);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 28) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+// fdead 601fc4b a2 = MEM_U32(a0 + 40);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 32) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+// fdead 601fc4b a3 = MEM_U32(a0 + 44);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 36) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+// fdead 601fc4b v1 = MEM_U32(a0 + 48);
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 40) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+// fdead 601fc4b a1 = MEM_U32(a0 + 52);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 44) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+// fdead 601fc4b a2 = MEM_U32(a0 + 56);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 48) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+// fdead 601fc4b a3 = MEM_U32(a0 + 60);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 52) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+// fdead 601fc4b v1 = MEM_U32(a0 + 64);
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 56) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+// fdead 601fc4b a1 = MEM_U32(a0 + 68);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 60) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+// fdead 601fc4b a2 = MEM_U32(a0 + 72);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 64) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+// fdead 601fc4b a3 = MEM_U32(a0 + 76);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 68) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+// fdead 601fc4b v1 = MEM_U32(a0 + 80);
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 72) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+// fdead 601fc4b a1 = MEM_U32(a0 + 84);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 76) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+// fdead 601fc4b a2 = MEM_U32(a0 + 88);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 80) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+// fdead 601fc4b a3 = MEM_U32(a0 + 92);
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 84) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+t6 = t3 | t5;
+// fdead 601fc4b t7 = a3 << 8;
+t9 = t7 & v0;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 88) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+t6 = t3 | t5;
+// fdead 601fc4b MEM_U32(a0 + 92) = t6;
+return;
+}
+
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, t8 = 0;
+L41ba54:
+//swap_fd:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffff70;
+//nop;
+// fdead 8b MEM_U32(sp + 52) = ra;
+// fdead 8b MEM_U32(sp + 44) = s5;
+// fdead 8b MEM_U32(sp + 40) = s4;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a0;
+// fdead 8b s4 = a1;
+s5 = a2;
+// fdead 40008b MEM_U32(sp + 48) = gp;
+// fdead 40008b MEM_U32(sp + 36) = s3;
+// fdead 40008b MEM_U32(sp + 32) = s2;
+// fdead 40008b MEM_U32(sp + 28) = s1;
+v0 = f_gethostsex(mem, sp);
+// fdead 40000b gp = MEM_U32(sp + 48);
+s3 = zero;
+if ((int)s4 <= 0) goto L41c02c;
+// fdead 50000b v1 = s0;
+s2 = 0xff0000;
+// fdead 58000b s1 = sp + 0x40;
+a0 = 0xff0000;
+L41bab4:
+// fdead 58002b t8 = v1;
+// fdead 58002b t9 = s1;
+// fdead 58002b t7 = v1 + 0x48;
+L41bac0:
+// fdead 58002b at = MEM_U32(t8 + 0);
+// fdead 58002b t8 = t8 + 0xc;
+// fdead 58002b MEM_U32(t9 + 0) = at;
+// fdead 58002b at = MEM_U32(t8 + -8);
+// fdead 58002b t9 = t9 + 0xc;
+// fdead 58002b MEM_U32(t9 + -8) = at;
+// fdead 58002b at = MEM_U32(t8 + -4);
+// fdead 58002b MEM_U32(t9 + -4) = at;
+if (t8 != t7) goto L41bac0;
+// fdead 58002b t6 = MEM_U32(sp + 64);
+// fdead 58002b a1 = MEM_U32(sp + 84);
+// fdead 58002b t8 = t6 << 8;
+// fdead 58002b t9 = t8 & s2;
+// fdead 58002b t7 = t6 << 24;
+// fdead 58002b t8 = t7 | t9;
+// fdead 58002b t7 = t6 >> 8;
+// fdead 58002b t9 = t7 & 0xff00;
+// fdead 58002b t7 = t8 | t9;
+// fdead 58002b t8 = t6 >> 24;
+// fdead 58002b t9 = t7 | t8;
+// fdead 58002b t6 = MEM_U32(sp + 68);
+// fdead 58002b MEM_U32(sp + 64) = t9;
+// fdead 58002b t8 = t6 << 8;
+// fdead 58002b t9 = t8 & a0;
+// fdead 58002b t7 = t6 << 24;
+// fdead 58002b t8 = t7 | t9;
+// fdead 58002b t7 = (int)t6 >> 8;
+// fdead 58002b t9 = t7 & 0xff00;
+// fdead 58002b t7 = MEM_U32(sp + 68);
+// fdead 58002b t6 = t8 | t9;
+// fdead 58002b t8 = t7 >> 24;
+// fdead 58002b t9 = t6 | t8;
+// fdead 58002b t7 = MEM_U32(sp + 72);
+// fdead 58002b MEM_U32(sp + 68) = t9;
+// fdead 58002b t8 = t7 << 8;
+// fdead 58002b t9 = t8 & a0;
+// fdead 58002b t6 = t7 << 24;
+// fdead 58002b t8 = t6 | t9;
+// fdead 58002b t6 = (int)t7 >> 8;
+// fdead 58002b t9 = t6 & 0xff00;
+// fdead 58002b t6 = MEM_U32(sp + 72);
+// fdead 58002b t7 = t8 | t9;
+// fdead 58002b t8 = t6 >> 24;
+// fdead 58002b t9 = t7 | t8;
+// fdead 58002b t6 = MEM_U32(sp + 76);
+// fdead 58002b MEM_U32(sp + 72) = t9;
+// fdead 58002b t8 = t6 << 8;
+// fdead 58002b t9 = t8 & a0;
+// fdead 58002b t7 = t6 << 24;
+// fdead 58002b t8 = t7 | t9;
+// fdead 58002b t7 = (int)t6 >> 8;
+// fdead 58002b t9 = t7 & 0xff00;
+// fdead 58002b t7 = MEM_U32(sp + 76);
+// fdead 58002b t6 = t8 | t9;
+// fdead 58002b t8 = t7 >> 24;
+// fdead 58002b t9 = t6 | t8;
+// fdead 58002b t7 = MEM_U32(sp + 80);
+// fdead 58002b MEM_U32(sp + 76) = t9;
+// fdead 58002b t8 = t7 << 8;
+// fdead 58002b t9 = t8 & a0;
+// fdead 58002b t6 = t7 << 24;
+// fdead 58002b t8 = t6 | t9;
+// fdead 58002b t6 = (int)t7 >> 8;
+// fdead 58002b t9 = t6 & 0xff00;
+// fdead 58002b t6 = MEM_U32(sp + 80);
+// fdead 58002b t7 = t8 | t9;
+// fdead 58002b t8 = t6 >> 24;
+// fdead 58002b t9 = t7 | t8;
+// fdead 58002b t7 = a1 << 8;
+// fdead 58002b t8 = t7 & a0;
+// fdead 58002b MEM_U32(sp + 80) = t9;
+// fdead 58002b t6 = a1 << 24;
+// fdead 58002b t9 = t6 | t8;
+// fdead 58002b t7 = (int)a1 >> 8;
+// fdead 58002b t6 = t7 & 0xff00;
+// fdead 58002b a2 = MEM_U32(sp + 88);
+// fdead 58002b t8 = t9 | t6;
+// fdead 58002b t7 = a1 >> 24;
+// fdead 58002b a1 = t8 | t7;
+// fdead 58002b t6 = a2 << 8;
+// fdead 58002b t8 = t6 & a0;
+// fdead 58002b t9 = a2 << 24;
+// fdead 58002b t7 = t9 | t8;
+// fdead 58002b t6 = (int)a2 >> 8;
+// fdead 58002b t9 = t6 & 0xff00;
+// fdead 58002b a3 = MEM_U32(sp + 92);
+// fdead 58002b t8 = t7 | t9;
+// fdead 58002b t6 = a2 >> 24;
+// fdead 58002b a2 = t8 | t6;
+// fdead 58002b t9 = a3 << 8;
+// fdead 58002b t8 = t9 & a0;
+// fdead 58002b t7 = a3 << 24;
+// fdead 58002b t6 = t7 | t8;
+// fdead 58002b t9 = (int)a3 >> 8;
+// fdead 58002b t7 = t9 & 0xff00;
+// fdead 58002b t0 = MEM_U32(sp + 96);
+// fdead 58002b t8 = t6 | t7;
+// fdead 58002b t9 = a3 >> 24;
+// fdead 58002b a3 = t8 | t9;
+// fdead 58002b t7 = t0 << 8;
+// fdead 58002b t8 = t7 & a0;
+// fdead 58002b t6 = t0 << 24;
+// fdead 58002b t9 = t6 | t8;
+// fdead 58002b t7 = (int)t0 >> 8;
+// fdead 58002b t6 = t7 & 0xff00;
+// fdead 58002b t1 = MEM_U32(sp + 100);
+// fdead 58002b t8 = t9 | t6;
+// fdead 58002b t7 = t0 >> 24;
+// fdead 58002b t0 = t8 | t7;
+// fdead 58002b t6 = t1 << 8;
+// fdead 58002b t8 = t6 & a0;
+// fdead 58002b t9 = t1 << 24;
+// fdead 58002b t7 = t9 | t8;
+// fdead 58002b t6 = (int)t1 >> 8;
+// fdead 58002b t9 = t6 & 0xff00;
+// fdead 58002b t8 = t7 | t9;
+// fdead 58002b t6 = t1 >> 24;
+// fdead 58002b t1 = t8 | t6;
+// fdead 58002b t6 = MEM_U16(sp + 104);
+// fdead 58002b t9 = MEM_S16(sp + 104);
+// fdead 58002b t7 = t6 >> 8;
+// fdead 58002b t8 = t9 << 8;
+// fdead 58002b t9 = t8 | t7;
+// fdead 58002b MEM_U16(sp + 104) = (uint16_t)t9;
+// fdead 58002b t9 = MEM_U16(sp + 106);
+// fdead 58002b t8 = MEM_S16(sp + 106);
+// fdead 58002b t2 = MEM_U32(sp + 108);
+// fdead 58002b t6 = t9 >> 8;
+// fdead 58002b t7 = t8 << 8;
+// fdead 58002b t8 = t7 | t6;
+// fdead 58002b t7 = t2 << 8;
+// fdead 58002b t6 = t7 & a0;
+// fdead 58002b MEM_U16(sp + 106) = (uint16_t)t8;
+// fdead 58002b t9 = t2 << 24;
+// fdead 58002b t8 = t9 | t6;
+// fdead 58002b t7 = (int)t2 >> 8;
+// fdead 58002b t9 = t7 & 0xff00;
+// fdead 58002b t3 = MEM_U32(sp + 112);
+// fdead 58002b t6 = t8 | t9;
+// fdead 58002b t7 = t2 >> 24;
+// fdead 58002b t2 = t6 | t7;
+// fdead 58002b t9 = t3 << 8;
+// fdead 58002b t6 = t9 & a0;
+// fdead 58002b t8 = t3 << 24;
+// fdead 58002b t7 = t8 | t6;
+// fdead 58002b t9 = (int)t3 >> 8;
+// fdead 58002b t8 = t9 & 0xff00;
+// fdead 58002b t4 = MEM_U32(sp + 116);
+// fdead 58002b t6 = t7 | t8;
+// fdead 58002b t9 = t3 >> 24;
+// fdead 58002b t3 = t6 | t9;
+// fdead 58002b t8 = t4 << 8;
+// fdead 58002b t6 = t8 & a0;
+// fdead 58002b t7 = t4 << 24;
+// fdead 58002b t9 = t7 | t6;
+// fdead 58002b t8 = (int)t4 >> 8;
+// fdead 58002b t7 = t8 & 0xff00;
+// fdead 58002b t5 = MEM_U32(sp + 120);
+// fdead 58002b t6 = t9 | t7;
+// fdead 58002b t8 = t4 >> 24;
+// fdead 58002b t4 = t6 | t8;
+// fdead 58002b t7 = t5 << 8;
+// fdead 58002b t6 = t7 & a0;
+// fdead 58002b t9 = t5 << 24;
+// fdead 58002b t8 = t9 | t6;
+// fdead 58002b t7 = (int)t5 >> 8;
+// fdead 58002b t9 = t7 & 0xff00;
+// fdead 58002b ra = MEM_U32(sp + 128);
+// fdead 58002b t6 = t8 | t9;
+// fdead 58002b t7 = t5 >> 24;
+// fdead 58002b t5 = t6 | t7;
+// fdead 58002b t9 = ra << 8;
+// fdead 58002b t6 = t9 & a0;
+// fdead 58002b t8 = ra << 24;
+// fdead 58002b t7 = t8 | t6;
+// fdead 58002b t9 = (int)ra >> 8;
+// fdead 58002b t8 = t9 & 0xff00;
+// fdead 58002b s0 = MEM_U32(sp + 132);
+// fdead 58002b t6 = t7 | t8;
+// fdead 58002b t9 = ra >> 24;
+// fdead 58002b ra = t6 | t9;
+// fdead 58002b t8 = s0 << 8;
+// fdead 58002b t6 = t8 & a0;
+// fdead 58002b t7 = s0 << 24;
+// fdead 58002b t9 = t7 | t6;
+// fdead 58002b t8 = (int)s0 >> 8;
+// fdead 58002b t7 = t8 & 0xff00;
+// fdead 58002b t6 = t9 | t7;
+// fdead 58002b t8 = s0 >> 24;
+// fdead 58002b s0 = t6 | t8;
+// fdead 58002b MEM_U32(sp + 132) = s0;
+// fdead 58002b MEM_U32(sp + 128) = ra;
+// fdead 58002b MEM_U32(sp + 120) = t5;
+// fdead 58002b MEM_U32(sp + 116) = t4;
+// fdead 58002b MEM_U32(sp + 112) = t3;
+// fdead 58002b MEM_U32(sp + 108) = t2;
+// fdead 58002b MEM_U32(sp + 100) = t1;
+// fdead 58002b MEM_U32(sp + 96) = t0;
+// fdead 58002b MEM_U32(sp + 92) = a3;
+// fdead 58002b MEM_U32(sp + 88) = a2;
+// fdead 58002b MEM_U32(sp + 84) = a1;
+if (s5 != v0) goto L41bf04;
+// fdead 58002b t6 = s1;
+// fdead 58002b t8 = v1;
+// fdead 58002b t7 = s1 + 0x48;
+L41bdf4:
+// fdead 58002b at = MEM_U32(t6 + 0);
+// fdead 58002b t6 = t6 + 0xc;
+// fdead 58002b MEM_U32(t8 + 0) = at;
+// fdead 58002b at = MEM_U32(t6 + -8);
+// fdead 58002b t8 = t8 + 0xc;
+// fdead 58002b MEM_U32(t8 + -8) = at;
+// fdead 58002b at = MEM_U32(t6 + -4);
+// fdead 58002b MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L41bdf4;
+// fdead 58002b t9 = MEM_U32(sp + 124);
+//nop;
+// fdead 58002b t6 = t9 << 8;
+// fdead 58002b t8 = t6 & s2;
+// fdead 58002b t7 = t9 << 24;
+// fdead 58002b t6 = t7 | t8;
+// fdead 58002b t7 = t9 >> 8;
+// fdead 58002b t8 = t7 & 0xff00;
+// fdead 58002b t7 = t6 | t8;
+// fdead 58002b t6 = t9 >> 24;
+// fdead 58002b t9 = t7 | t6;
+// fdead 58002b MEM_U32(sp + 124) = t9;
+// fdead 58002b t8 = MEM_U8(v1 + 60);
+// fdead 58002b t6 = t9 << 3;
+// fdead 58002b t9 = t8 & 0xff07;
+// fdead 58002b t7 = t6 | t9;
+// fdead 58002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 58002b t8 = MEM_U32(sp + 124);
+//nop;
+// fdead 58002b t6 = t8 << 26;
+// fdead 58002b t9 = t6 >> 31;
+// fdead 58002b t6 = MEM_U8(v1 + 60);
+// fdead 58002b t7 = t9 << 2;
+// fdead 58002b t8 = t7 & 0x4;
+// fdead 58002b t9 = t6 & 0xfffb;
+// fdead 58002b t7 = t8 | t9;
+// fdead 58002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 58002b t6 = MEM_U32(sp + 124);
+//nop;
+// fdead 58002b t8 = t6 << 25;
+// fdead 58002b t9 = t8 >> 31;
+// fdead 58002b t8 = MEM_U8(v1 + 60);
+// fdead 58002b t7 = t9 << 1;
+// fdead 58002b t6 = t7 & 0x2;
+// fdead 58002b t9 = t8 & 0xfffd;
+// fdead 58002b t7 = t6 | t9;
+// fdead 58002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 58002b t8 = MEM_U8(sp + 127);
+//nop;
+// fdead 58002b t6 = t8 >> 7;
+// fdead 58002b t9 = t6 & 0x1;
+// fdead 58002b t8 = t7 & 0xfe;
+// fdead 58002b t6 = t9 | t8;
+// fdead 58002b MEM_U8(v1 + 60) = (uint8_t)t6;
+// fdead 58002b t9 = MEM_U8(sp + 126);
+// fdead 58002b t7 = MEM_U8(v1 + 61);
+// fdead 58002b t6 = t9 << 6;
+// fdead 58002b t9 = t7 & 0xff3f;
+// fdead 58002b t8 = t6 | t9;
+// fdead 58002b MEM_U8(v1 + 61) = (uint8_t)t8;
+// fdead 58002b t7 = MEM_U32(sp + 124);
+//nop;
+// fdead 58002b t9 = t7 >> 10;
+// fdead 58002b t7 = MEM_U16(v1 + 62);
+// fdead 58002b t8 = t9 & 0x1fff;
+// fdead 58002b t6 = t7 & 0xe000;
+// fdead 58002b t9 = t8 | t6;
+// fdead 58002b MEM_U16(v1 + 62) = (uint16_t)t9;
+goto L41c020;
+L41bf04:
+// fdead 58002b t7 = MEM_U32(v1 + 60);
+// fdead 58002b t9 = MEM_U8(sp + 127);
+// fdead 58002b t8 = t7 >> 27;
+// fdead 58002b t6 = t8 & 0x1f;
+// fdead 58002b t7 = t9 & 0xffe0;
+// fdead 58002b t8 = t6 | t7;
+// fdead 58002b MEM_U8(sp + 127) = (uint8_t)t8;
+// fdead 58002b t9 = MEM_U32(v1 + 60);
+//nop;
+// fdead 58002b t6 = t9 << 5;
+// fdead 58002b t7 = t6 >> 31;
+// fdead 58002b t9 = t7 << 5;
+// fdead 58002b t6 = t9 & 0x20;
+// fdead 58002b t7 = t8;
+// fdead 58002b t9 = t7 & 0xdf;
+// fdead 58002b t8 = t6 | t9;
+// fdead 58002b MEM_U8(sp + 127) = (uint8_t)t8;
+// fdead 58002b t7 = MEM_U32(v1 + 60);
+//nop;
+// fdead 58002b t6 = t7 << 6;
+// fdead 58002b t9 = t6 >> 31;
+// fdead 58002b t7 = t9 << 6;
+// fdead 58002b t6 = t7 & 0x40;
+// fdead 58002b t9 = t8;
+// fdead 58002b t7 = t9 & 0xbf;
+// fdead 58002b t8 = t6 | t7;
+// fdead 58002b MEM_U8(sp + 127) = (uint8_t)t8;
+// fdead 58002b t6 = MEM_U8(v1 + 60);
+//nop;
+// fdead 58002b t9 = t6 << 7;
+// fdead 58002b t6 = t8;
+// fdead 58002b t7 = t6 & 0x7f;
+// fdead 58002b t8 = t9 | t7;
+// fdead 58002b MEM_U8(sp + 127) = (uint8_t)t8;
+// fdead 58002b t6 = MEM_U8(v1 + 61);
+// fdead 58002b t8 = MEM_U8(sp + 126);
+// fdead 58002b t9 = t6 >> 6;
+// fdead 58002b t7 = t9 & 0x3;
+// fdead 58002b t6 = t8 & 0xfffc;
+// fdead 58002b t9 = t7 | t6;
+// fdead 58002b MEM_U8(sp + 126) = (uint8_t)t9;
+// fdead 58002b t6 = MEM_U32(sp + 124);
+// fdead 58002b t8 = MEM_U32(v1 + 60);
+// fdead 58002b t9 = t6 >> 10;
+// fdead 58002b t7 = t8 & 0x1fff;
+// fdead 58002b t8 = t7 ^ t9;
+// fdead 58002b t7 = t8 << 10;
+// fdead 58002b t9 = t7 ^ t6;
+// fdead 58002b t7 = t9 << 8;
+// fdead 58002b t6 = t7 & s2;
+// fdead 58002b t8 = t9 << 24;
+// fdead 58002b t7 = t8 | t6;
+// fdead 58002b t8 = t9 >> 8;
+// fdead 58002b t6 = t8 & 0xff00;
+// fdead 58002b t8 = t7 | t6;
+// fdead 58002b t7 = t9 >> 24;
+// fdead 58002b t6 = t8 | t7;
+// fdead 58002b MEM_U32(sp + 124) = t9;
+// fdead 58002b MEM_U32(sp + 124) = t6;
+// fdead 58002b t6 = s1;
+// fdead 58002b t7 = s1 + 0x48;
+// fdead 58002b t8 = v1;
+L41bffc:
+// fdead 58002b at = MEM_U32(t6 + 0);
+// fdead 58002b t6 = t6 + 0xc;
+// fdead 58002b MEM_U32(t8 + 0) = at;
+// fdead 58002b at = MEM_U32(t6 + -8);
+// fdead 58002b t8 = t8 + 0xc;
+// fdead 58002b MEM_U32(t8 + -8) = at;
+// fdead 58002b at = MEM_U32(t6 + -4);
+// fdead 58002b MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L41bffc;
+L41c020:
+s3 = s3 + 0x1;
+// fdead 58002b v1 = v1 + 0x48;
+if (s3 != s4) goto L41bab4;
+L41c02c:
+// fdead 58002b ra = MEM_U32(sp + 52);
+// fdead 58002b s0 = MEM_U32(sp + 24);
+// fdead 58002b s1 = MEM_U32(sp + 28);
+// fdead 58002b s2 = MEM_U32(sp + 32);
+// fdead 58002b s3 = MEM_U32(sp + 36);
+// fdead 58002b s4 = MEM_U32(sp + 40);
+// fdead 58002b s5 = MEM_U32(sp + 44);
+// fdead 58002b sp = sp + 0x90;
+return;
+}
+
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41c050:
+//swap_fi:
+// fdead 8b MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41c17c;
+// fdead 8b a2 = a1 & 0x3;
+a3 = a2;
+if (a2 == 0) goto L41c0b0;
+t6 = zero << 2;
+// fdead 818b v1 = a0 + t6;
+t1 = 0xff0000;
+L41c074:
+// fdead 601fd8b a2 = MEM_U32(v1 + 0);
+v0 = v0 + 0x1;
+t8 = a2 << 8;
+t9 = t8 & t1;
+t7 = a2 << 24;
+t3 = (int)a2 >> 8;
+t4 = t3 & 0xff00;
+t2 = t7 | t9;
+t5 = t2 | t4;
+t6 = a2 >> 24;
+t8 = t6 | t5;
+// fdead 601fd8b MEM_U32(v1 + 0) = t8;
+// fdead 601fd8b v1 = v1 + 0x4;
+if (a3 != v0) goto L41c074;
+if (v0 == a1) {
+t7 = v0 << 2;
+goto L41c17c;}
+L41c0b0:
+t7 = v0 << 2;
+// fdead 601fd8b t9 = a1 << 2;
+// fdead 601fd8b t0 = t9 + a0;
+// fdead 601fd8b v1 = a0 + t7;
+t1 = 0xff0000;
+L41c0c4:
+// fdead 601fd8b a2 = MEM_U32(v1 + 0);
+// fdead 601fd8b v0 = MEM_U32(v1 + 4);
+t2 = a2 << 8;
+t4 = t2 & t1;
+t3 = a2 << 24;
+t5 = (int)a2 >> 8;
+t8 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = t6 | t8;
+t9 = a2 >> 24;
+t2 = t9 | t7;
+t4 = v0 << 8;
+t5 = t4 & t1;
+t8 = (int)v0 >> 8;
+t3 = v0 << 24;
+// fdead 601fd8b a0 = MEM_U32(v1 + 8);
+t6 = t3 | t5;
+t9 = t8 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 0) = t2;
+t7 = t6 | t9;
+t2 = v0 >> 24;
+t4 = t2 | t7;
+// fdead 601fd8b t5 = a0 << 8;
+t8 = t5 & t1;
+// fdead 601fd8b t9 = (int)a0 >> 8;
+// fdead 601fd8b t3 = a0 << 24;
+// fdead 601fd8b a3 = MEM_U32(v1 + 12);
+t6 = t3 | t8;
+t2 = t9 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 4) = t4;
+t7 = t6 | t2;
+// fdead 601fd8b t4 = a0 >> 24;
+t5 = t4 | t7;
+t8 = a3 << 8;
+t9 = t8 & t1;
+t2 = (int)a3 >> 8;
+t3 = a3 << 24;
+t6 = t3 | t9;
+t4 = t2 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 8) = t5;
+t7 = t6 | t4;
+t5 = a3 >> 24;
+t8 = t5 | t7;
+// fdead 601fd8b v1 = v1 + 0x10;
+// fdead 601fd8b MEM_U32(v1 + -4) = t8;
+if (v1 != t0) goto L41c0c4;
+L41c17c:
+//nop;
+return;
+}
+
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41c184:
+//swap_sym:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffc0;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+a2 = zero;
+if ((int)s0 <= 0) goto L41c408;
+// fdead 4008b v1 = MEM_U32(sp + 64);
+t0 = 0xff0000;
+a3 = 0xff0000;
+// fdead 4038b a1 = sp + 0x2c;
+L41c1d4:
+// fdead 4038f at = MEM_U32(v1 + 0);
+a2 = a2 + 0x1;
+// fdead 4038f MEM_U32(a1 + 0) = at;
+// fdead 4038f t7 = MEM_U32(v1 + 4);
+//nop;
+// fdead 4038f MEM_U32(a1 + 4) = t7;
+// fdead 4038f at = MEM_U32(v1 + 8);
+//nop;
+// fdead 4038f MEM_U32(a1 + 8) = at;
+// fdead 4038f t8 = MEM_U32(sp + 44);
+at = 0xf0000;
+// fdead 4038f t1 = t8 << 8;
+// fdead 4038f t2 = t1 & a3;
+// fdead 4038f t9 = t8 << 24;
+// fdead 4038f t3 = t9 | t2;
+// fdead 4038f t4 = (int)t8 >> 8;
+// fdead 4038f t2 = MEM_U32(sp + 48);
+// fdead 4038f t5 = t4 & 0xff00;
+// fdead 4038f t6 = t3 | t5;
+// fdead 4038f t1 = t8 >> 24;
+// fdead 4038f t4 = t2 << 8;
+// fdead 4038f t9 = t6 | t1;
+// fdead 4038f t3 = t4 & a3;
+// fdead 4038f t8 = t2 << 24;
+// fdead 4038f t7 = (int)t2 >> 8;
+// fdead 4038f t6 = t7 & 0xff00;
+// fdead 4038f t5 = t8 | t3;
+// fdead 4038f t1 = t5 | t6;
+// fdead 4038f t4 = t2 >> 24;
+// fdead 4038f t8 = t1 | t4;
+// fdead 4038f MEM_U32(sp + 44) = t9;
+// fdead 4038f MEM_U32(sp + 48) = t8;
+if (s1 != v0) goto L41c32c;
+// fdead 4038f at = MEM_U32(a1 + 0);
+//nop;
+// fdead 4038f MEM_U32(v1 + 0) = at;
+// fdead 4038f t2 = MEM_U32(a1 + 4);
+//nop;
+// fdead 4038f MEM_U32(v1 + 4) = t2;
+// fdead 4038f at = MEM_U32(a1 + 8);
+//nop;
+// fdead 4038f MEM_U32(v1 + 8) = at;
+// fdead 4038f t7 = MEM_U32(sp + 52);
+//nop;
+// fdead 4038f t6 = t7 << 8;
+// fdead 4038f t9 = t6 & t0;
+// fdead 4038f t5 = t7 << 24;
+// fdead 4038f t4 = t7 >> 8;
+// fdead 4038f t8 = t4 & 0xff00;
+// fdead 4038f t1 = t5 | t9;
+// fdead 4038f t3 = t1 | t8;
+// fdead 4038f t2 = t7 >> 24;
+// fdead 4038f t5 = t3 | t2;
+// fdead 4038f MEM_U32(sp + 52) = t5;
+// fdead 4038f t1 = MEM_U8(v1 + 8);
+// fdead 4038f t4 = t5 << 2;
+// fdead 4038f t8 = t1 & 0xff03;
+// fdead 4038f t7 = t4 | t8;
+// fdead 4038f MEM_U8(v1 + 8) = (uint8_t)t7;
+// fdead 4038f t3 = MEM_U32(sp + 52);
+// fdead 4038f t1 = MEM_U16(v1 + 8);
+// fdead 4038f t2 = t3 << 21;
+// fdead 4038f t6 = t2 >> 27;
+// fdead 4038f t5 = t6 << 5;
+// fdead 4038f t9 = t5 & 0x3e0;
+// fdead 4038f t4 = t1 & 0xfc1f;
+// fdead 4038f t8 = t9 | t4;
+// fdead 4038f MEM_U16(v1 + 8) = (uint16_t)t8;
+// fdead 4038f t7 = MEM_U32(sp + 52);
+// fdead 4038f t1 = MEM_U8(v1 + 9);
+// fdead 4038f t3 = t7 << 20;
+// fdead 4038f t2 = t3 >> 31;
+// fdead 4038f t6 = t2 << 4;
+// fdead 4038f t5 = t6 & 0x10;
+// fdead 4038f t9 = t1 & 0xffef;
+// fdead 4038f t4 = t5 | t9;
+// fdead 4038f MEM_U8(v1 + 9) = (uint8_t)t4;
+// fdead 4038f t8 = MEM_U32(sp + 52);
+// fdead 4038f a0 = MEM_U32(v1 + 8);
+// fdead 4038f t7 = t8 >> 12;
+// fdead 4038f t3 = t7 ^ a0;
+// fdead 4038f t2 = t3 << 12;
+// fdead 4038f t6 = t2 >> 12;
+// fdead 4038f t1 = t6 ^ a0;
+// fdead 4038f MEM_U32(v1 + 8) = t1;
+goto L41c400;
+L41c32c:
+// fdead 4038f t5 = MEM_U32(v1 + 8);
+// fdead 4038f t8 = MEM_U8(sp + 55);
+// fdead 4038f t9 = t5 >> 26;
+// fdead 4038f t4 = t9 & 0x3f;
+// fdead 4038f t7 = t8 & 0xffc0;
+// fdead 4038f t3 = t4 | t7;
+// fdead 4038f MEM_U8(sp + 55) = (uint8_t)t3;
+// fdead 4038f t2 = MEM_U32(v1 + 8);
+// fdead 4038f t8 = MEM_U16(sp + 54);
+// fdead 4038f t6 = t2 << 6;
+// fdead 4038f t1 = t6 >> 27;
+// fdead 4038f t5 = t1 << 6;
+// fdead 4038f t9 = t5 & 0x7c0;
+// fdead 4038f t4 = t8 & 0xf83f;
+// fdead 4038f t7 = t9 | t4;
+// fdead 4038f MEM_U16(sp + 54) = (uint16_t)t7;
+// fdead 4038f t3 = MEM_U32(v1 + 8);
+// fdead 4038f t8 = MEM_U8(sp + 54);
+// fdead 4038f t2 = t3 << 11;
+// fdead 4038f t6 = t2 >> 31;
+// fdead 4038f t1 = t6 << 3;
+// fdead 4038f t5 = t1 & 0x8;
+// fdead 4038f t9 = t8 & 0xfff7;
+// fdead 4038f t4 = t5 | t9;
+// fdead 4038f MEM_U8(sp + 54) = (uint8_t)t4;
+// fdead 4038f t7 = MEM_U32(v1 + 8);
+// fdead 4038f t2 = MEM_U32(sp + 52);
+at = at | 0xffff;
+// fdead 4038f t3 = t7 & at;
+// fdead 4038f t6 = t2 >> 12;
+// fdead 4038f t1 = t3 ^ t6;
+// fdead 4038f t8 = t1 << 12;
+// fdead 4038f t5 = t8 ^ t2;
+// fdead 4038f t4 = t5 << 8;
+// fdead 4038f t7 = t4 & t0;
+// fdead 4038f t9 = t5 << 24;
+// fdead 4038f t6 = t5 >> 8;
+// fdead 4038f t1 = t6 & 0xff00;
+// fdead 4038f t3 = t9 | t7;
+// fdead 4038f t8 = t3 | t1;
+// fdead 4038f t2 = t5 >> 24;
+// fdead 4038f MEM_U32(sp + 52) = t5;
+// fdead 4038f t4 = t8 | t2;
+// fdead 4038f MEM_U32(sp + 52) = t4;
+// fdead 4038f at = MEM_U32(a1 + 0);
+//nop;
+// fdead 4038f MEM_U32(v1 + 0) = at;
+// fdead 4038f t6 = MEM_U32(a1 + 4);
+//nop;
+// fdead 4038f MEM_U32(v1 + 4) = t6;
+// fdead 4038f at = MEM_U32(a1 + 8);
+//nop;
+// fdead 4038f MEM_U32(v1 + 8) = at;
+L41c400:
+// fdead 4038f v1 = v1 + 0xc;
+if (a2 != s0) goto L41c1d4;
+L41c408:
+// fdead 4038f ra = MEM_U32(sp + 36);
+// fdead 4038f s0 = MEM_U32(sp + 24);
+// fdead 4038f s1 = MEM_U32(sp + 28);
+// fdead 4038f sp = sp + 0x40;
+return;
+}
+
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41c41c:
+//swap_ext:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffb8;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+a3 = zero;
+if ((int)s0 <= 0) goto L41c81c;
+// fdead 4010b v1 = MEM_U32(sp + 72);
+t0 = 0xff0000;
+// fdead 4030b a2 = sp + 0x30;
+a1 = 0xff0000;
+L41c46c:
+// fdead 4034f at = MEM_U32(v1 + 0);
+a3 = a3 + 0x1;
+// fdead 4034f MEM_U32(a2 + 0) = at;
+// fdead 4034f t7 = MEM_U32(v1 + 4);
+//nop;
+// fdead 4034f MEM_U32(a2 + 4) = t7;
+// fdead 4034f at = MEM_U32(v1 + 8);
+//nop;
+// fdead 4034f MEM_U32(a2 + 8) = at;
+// fdead 4034f t7 = MEM_U32(v1 + 12);
+at = 0xf0000;
+// fdead 4034f MEM_U32(a2 + 12) = t7;
+// fdead 4034f t8 = MEM_U32(sp + 52);
+at = at | 0xffff;
+// fdead 4034f t1 = t8 << 8;
+// fdead 4034f t2 = t1 & t0;
+// fdead 4034f t9 = t8 << 24;
+// fdead 4034f t3 = t9 | t2;
+// fdead 4034f t4 = (int)t8 >> 8;
+// fdead 4034f t2 = MEM_U32(sp + 56);
+// fdead 4034f t5 = t4 & 0xff00;
+// fdead 4034f t6 = t3 | t5;
+// fdead 4034f t1 = t8 >> 24;
+// fdead 4034f t4 = t2 << 8;
+// fdead 4034f t9 = t6 | t1;
+// fdead 4034f t3 = t4 & t0;
+// fdead 4034f t8 = t2 << 24;
+// fdead 4034f t7 = (int)t2 >> 8;
+// fdead 4034f t6 = t7 & 0xff00;
+// fdead 4034f t5 = t8 | t3;
+// fdead 4034f t1 = t5 | t6;
+// fdead 4034f t4 = t2 >> 24;
+// fdead 4034f t8 = t1 | t4;
+// fdead 4034f MEM_U32(sp + 52) = t9;
+// fdead 4034f MEM_U32(sp + 56) = t8;
+if (s1 != v0) goto L41c688;
+// fdead 4034f at = MEM_U32(a2 + 0);
+//nop;
+// fdead 4034f MEM_U32(v1 + 0) = at;
+// fdead 4034f t2 = MEM_U32(a2 + 4);
+//nop;
+// fdead 4034f MEM_U32(v1 + 4) = t2;
+// fdead 4034f at = MEM_U32(a2 + 8);
+//nop;
+// fdead 4034f MEM_U32(v1 + 8) = at;
+// fdead 4034f t2 = MEM_U32(a2 + 12);
+//nop;
+// fdead 4034f MEM_U32(v1 + 12) = t2;
+// fdead 4034f t7 = MEM_U32(sp + 60);
+//nop;
+// fdead 4034f t6 = t7 << 8;
+// fdead 4034f t9 = t6 & a1;
+// fdead 4034f t5 = t7 << 24;
+// fdead 4034f t4 = t7 >> 8;
+// fdead 4034f t8 = t4 & 0xff00;
+// fdead 4034f t1 = t5 | t9;
+// fdead 4034f t3 = t1 | t8;
+// fdead 4034f t2 = t7 >> 24;
+// fdead 4034f t5 = t3 | t2;
+// fdead 4034f MEM_U32(sp + 60) = t5;
+// fdead 4034f t1 = MEM_U8(v1 + 12);
+// fdead 4034f t4 = t5 << 2;
+// fdead 4034f t8 = t1 & 0xff03;
+// fdead 4034f t7 = t4 | t8;
+// fdead 4034f MEM_U8(v1 + 12) = (uint8_t)t7;
+// fdead 4034f t3 = MEM_U32(sp + 60);
+// fdead 4034f t1 = MEM_U16(v1 + 12);
+// fdead 4034f t2 = t3 << 21;
+// fdead 4034f t6 = t2 >> 27;
+// fdead 4034f t5 = t6 << 5;
+// fdead 4034f t9 = t5 & 0x3e0;
+// fdead 4034f t4 = t1 & 0xfc1f;
+// fdead 4034f t8 = t9 | t4;
+// fdead 4034f MEM_U16(v1 + 12) = (uint16_t)t8;
+// fdead 4034f t7 = MEM_U32(sp + 60);
+// fdead 4034f t1 = MEM_U8(v1 + 13);
+// fdead 4034f t3 = t7 << 20;
+// fdead 4034f t2 = t3 >> 31;
+// fdead 4034f t6 = t2 << 4;
+// fdead 4034f t5 = t6 & 0x10;
+// fdead 4034f t9 = t1 & 0xffef;
+// fdead 4034f t4 = t5 | t9;
+// fdead 4034f MEM_U8(v1 + 13) = (uint8_t)t4;
+// fdead 4034f t8 = MEM_U32(sp + 60);
+// fdead 4034f a0 = MEM_U32(v1 + 12);
+// fdead 4034f t7 = t8 >> 12;
+// fdead 4034f t3 = t7 ^ a0;
+// fdead 4034f t2 = t3 << 12;
+// fdead 4034f t6 = t2 >> 12;
+// fdead 4034f t1 = t6 ^ a0;
+// fdead 4034f MEM_U32(v1 + 12) = t1;
+// fdead 4034f t5 = MEM_U32(sp + 48);
+//nop;
+// fdead 4034f t4 = t5 << 8;
+// fdead 4034f t8 = t4 & a1;
+// fdead 4034f t9 = t5 << 24;
+// fdead 4034f t3 = t5 >> 8;
+// fdead 4034f t2 = t3 & 0xff00;
+// fdead 4034f t7 = t9 | t8;
+// fdead 4034f t6 = t7 | t2;
+// fdead 4034f t1 = t5 >> 24;
+// fdead 4034f t4 = t6 | t1;
+// fdead 4034f MEM_U32(sp + 48) = t4;
+// fdead 4034f t9 = MEM_S16(sp + 48);
+// fdead 4034f t5 = MEM_U16(v1 + 0);
+// fdead 4034f MEM_U16(v1 + 2) = (uint16_t)t9;
+// fdead 4034f t8 = MEM_U16(sp + 50);
+// fdead 4034f t6 = t5 & 0xf800;
+// fdead 4034f t7 = t8 >> 3;
+// fdead 4034f t2 = t7 & 0x7ff;
+// fdead 4034f t1 = t2 | t6;
+// fdead 4034f MEM_U16(v1 + 0) = (uint16_t)t1;
+// fdead 4034f t7 = MEM_U8(v1 + 0);
+// fdead 4034f t9 = MEM_U32(sp + 48);
+// fdead 4034f t5 = t7 & 0xff7f;
+// fdead 4034f t3 = t9 << 7;
+// fdead 4034f t7 = t3 | t5;
+// fdead 4034f MEM_U8(v1 + 0) = (uint8_t)t7;
+// fdead 4034f t6 = MEM_U32(sp + 48);
+// fdead 4034f t3 = t7 & 0xbf;
+// fdead 4034f t1 = t6 << 30;
+// fdead 4034f t4 = t1 >> 31;
+// fdead 4034f t9 = t4 << 6;
+// fdead 4034f t8 = t9 & 0x40;
+// fdead 4034f t7 = t8 | t3;
+// fdead 4034f MEM_U8(v1 + 0) = (uint8_t)t7;
+// fdead 4034f t2 = MEM_U32(sp + 48);
+// fdead 4034f t8 = t7 & 0xdf;
+// fdead 4034f t6 = t2 << 29;
+// fdead 4034f t1 = t6 >> 31;
+// fdead 4034f t4 = t1 << 5;
+// fdead 4034f t9 = t4 & 0x20;
+// fdead 4034f t3 = t9 | t8;
+// fdead 4034f MEM_U8(v1 + 0) = (uint8_t)t3;
+goto L41c814;
+L41c688:
+// fdead 4034f t5 = MEM_U32(v1 + 12);
+// fdead 4034f t1 = MEM_U8(sp + 63);
+// fdead 4034f t2 = t5 >> 26;
+// fdead 4034f t6 = t2 & 0x3f;
+// fdead 4034f t4 = t1 & 0xffc0;
+// fdead 4034f t7 = t6 | t4;
+// fdead 4034f MEM_U8(sp + 63) = (uint8_t)t7;
+// fdead 4034f t9 = MEM_U32(v1 + 12);
+// fdead 4034f t1 = MEM_U16(sp + 62);
+// fdead 4034f t8 = t9 << 6;
+// fdead 4034f t3 = t8 >> 27;
+// fdead 4034f t5 = t3 << 6;
+// fdead 4034f t2 = t5 & 0x7c0;
+// fdead 4034f t6 = t1 & 0xf83f;
+// fdead 4034f t4 = t2 | t6;
+// fdead 4034f MEM_U16(sp + 62) = (uint16_t)t4;
+// fdead 4034f t7 = MEM_U32(v1 + 12);
+// fdead 4034f t1 = MEM_U8(sp + 62);
+// fdead 4034f t9 = t7 << 11;
+// fdead 4034f t8 = t9 >> 31;
+// fdead 4034f t3 = t8 << 3;
+// fdead 4034f t5 = t3 & 0x8;
+// fdead 4034f t2 = t1 & 0xfff7;
+// fdead 4034f t6 = t5 | t2;
+// fdead 4034f MEM_U8(sp + 62) = (uint8_t)t6;
+// fdead 4034f t4 = MEM_U32(v1 + 12);
+// fdead 4034f t9 = MEM_U32(sp + 60);
+// fdead 4034f t7 = t4 & at;
+// fdead 4034f t8 = t9 >> 12;
+// fdead 4034f t3 = t7 ^ t8;
+// fdead 4034f t1 = t3 << 12;
+// fdead 4034f t5 = t1 ^ t9;
+// fdead 4034f t6 = t5 << 8;
+// fdead 4034f t4 = t6 & a1;
+// fdead 4034f t2 = t5 << 24;
+// fdead 4034f t8 = t5 >> 8;
+// fdead 4034f t3 = t8 & 0xff00;
+// fdead 4034f t7 = t2 | t4;
+// fdead 4034f t1 = t7 | t3;
+// fdead 4034f t9 = t5 >> 24;
+// fdead 4034f MEM_U32(sp + 60) = t5;
+// fdead 4034f t6 = t1 | t9;
+// fdead 4034f MEM_U32(sp + 60) = t6;
+// fdead 4034f t2 = MEM_S16(v1 + 2);
+// fdead 4034f t5 = MEM_U16(sp + 50);
+// fdead 4034f MEM_U16(sp + 48) = (uint16_t)t2;
+// fdead 4034f t4 = MEM_U16(v1 + 0);
+// fdead 4034f t1 = t5 & 0x7;
+// fdead 4034f t8 = t4 & 0x7ff;
+// fdead 4034f t3 = t8 << 3;
+// fdead 4034f t9 = t3 | t1;
+// fdead 4034f MEM_U16(sp + 50) = (uint16_t)t9;
+// fdead 4034f t6 = MEM_U32(v1 + 0);
+// fdead 4034f t5 = MEM_U8(sp + 51);
+// fdead 4034f t2 = t6 << 2;
+// fdead 4034f t4 = t2 >> 31;
+// fdead 4034f t8 = t4 << 2;
+// fdead 4034f t7 = t8 & 0x4;
+// fdead 4034f t3 = t5 & 0xfffb;
+// fdead 4034f t5 = t7 | t3;
+// fdead 4034f MEM_U8(sp + 51) = (uint8_t)t5;
+// fdead 4034f t9 = MEM_U32(v1 + 0);
+// fdead 4034f t7 = t5 & 0xfd;
+// fdead 4034f t6 = t9 << 1;
+// fdead 4034f t2 = t6 >> 31;
+// fdead 4034f t4 = t2 << 1;
+// fdead 4034f t8 = t4 & 0x2;
+// fdead 4034f t4 = t8 | t7;
+// fdead 4034f MEM_U8(sp + 51) = (uint8_t)t4;
+// fdead 4034f t9 = MEM_U32(v1 + 0);
+// fdead 4034f t1 = t4 & 0xfe;
+// fdead 4034f t6 = t9 >> 31;
+// fdead 4034f t2 = t6 & 0x1;
+// fdead 4034f t5 = t2 | t1;
+// fdead 4034f MEM_U8(sp + 51) = (uint8_t)t5;
+// fdead 4034f t8 = MEM_U32(sp + 48);
+//nop;
+// fdead 4034f t9 = t8 << 8;
+// fdead 4034f t6 = t9 & a1;
+// fdead 4034f t7 = t8 << 24;
+// fdead 4034f t4 = t8 >> 8;
+// fdead 4034f t2 = t4 & 0xff00;
+// fdead 4034f t3 = t7 | t6;
+// fdead 4034f t1 = t3 | t2;
+// fdead 4034f t5 = t8 >> 24;
+// fdead 4034f t9 = t1 | t5;
+// fdead 4034f MEM_U32(sp + 48) = t9;
+// fdead 4034f at = MEM_U32(a2 + 0);
+//nop;
+// fdead 4034f MEM_U32(v1 + 0) = at;
+// fdead 4034f t4 = MEM_U32(a2 + 4);
+//nop;
+// fdead 4034f MEM_U32(v1 + 4) = t4;
+// fdead 4034f at = MEM_U32(a2 + 8);
+//nop;
+// fdead 4034f MEM_U32(v1 + 8) = at;
+// fdead 4034f t4 = MEM_U32(a2 + 12);
+//nop;
+// fdead 4034f MEM_U32(v1 + 12) = t4;
+L41c814:
+// fdead 4034f v1 = v1 + 0x10;
+if (a3 != s0) goto L41c46c;
+L41c81c:
+// fdead 4034f ra = MEM_U32(sp + 36);
+// fdead 4034f s0 = MEM_U32(sp + 24);
+// fdead 4034f s1 = MEM_U32(sp + 28);
+// fdead 4034f sp = sp + 0x48;
+return;
+}
+
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L41c830:
+//swap_pd:
+// fdead 8b MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41ca94;
+// fdead 8b v1 = a0;
+t1 = 0xff0000;
+t0 = 0xff0000;
+L41c848:
+// fdead 601fe8b a0 = MEM_U32(v1 + 0);
+// fdead 601fe8b a2 = MEM_U32(v1 + 4);
+// fdead 601fe8b t6 = a0 >> 24;
+// fdead 601fe8b t7 = a0 << 24;
+// fdead 601fe8b t9 = a0 << 8;
+t2 = t9 & t0;
+t8 = t6 | t7;
+// fdead 601fe8b t4 = a0 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+t9 = a2 << 8;
+t8 = t9 & t1;
+t4 = (int)a2 >> 8;
+t7 = a2 << 24;
+// fdead 601fe8b a0 = MEM_U32(v1 + 8);
+// fdead 601fe8b MEM_U32(v1 + 0) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+t6 = a2 >> 24;
+t9 = t6 | t5;
+// fdead 601fe8b t8 = a0 << 8;
+t4 = t8 & t1;
+// fdead 601fe8b t3 = (int)a0 >> 8;
+// fdead 601fe8b t7 = a0 << 24;
+// fdead 601fe8b a2 = MEM_U32(v1 + 12);
+// fdead 601fe8b MEM_U32(v1 + 4) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+// fdead 601fe8b t9 = a0 >> 24;
+t8 = t9 | t5;
+t4 = a2 << 8;
+t3 = t4 & t1;
+t6 = (int)a2 >> 8;
+t7 = a2 << 24;
+// fdead 601fe8b a0 = MEM_U32(v1 + 16);
+// fdead 601fe8b MEM_U32(v1 + 8) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+t8 = a2 >> 24;
+t4 = t8 | t5;
+// fdead 601fe8b t3 = a0 << 8;
+t6 = t3 & t1;
+// fdead 601fe8b t9 = (int)a0 >> 8;
+// fdead 601fe8b t7 = a0 << 24;
+// fdead 601fe8b a2 = MEM_U32(v1 + 20);
+// fdead 601fe8b MEM_U32(v1 + 12) = t4;
+t2 = t7 | t6;
+t8 = t9 & 0xff00;
+t5 = t2 | t8;
+// fdead 601fe8b t4 = a0 >> 24;
+t3 = t4 | t5;
+t6 = a2 << 8;
+t9 = t6 & t1;
+t8 = (int)a2 >> 8;
+t7 = a2 << 24;
+// fdead 601fe8b a0 = MEM_U32(v1 + 24);
+// fdead 601fe8b MEM_U32(v1 + 16) = t3;
+t2 = t7 | t9;
+t4 = t8 & 0xff00;
+t5 = t2 | t4;
+t3 = a2 >> 24;
+t6 = t3 | t5;
+// fdead 601fe8b t9 = a0 << 8;
+t8 = t9 & t1;
+// fdead 601fe8b t4 = (int)a0 >> 8;
+// fdead 601fe8b t7 = a0 << 24;
+// fdead 601fe8b a2 = MEM_U32(v1 + 28);
+// fdead 601fe8b MEM_U32(v1 + 20) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+// fdead 601fe8b t6 = a0 >> 24;
+t9 = t6 | t5;
+t8 = a2 << 8;
+t4 = t8 & t1;
+t3 = (int)a2 >> 8;
+t7 = a2 << 24;
+// fdead 601fe8b a0 = MEM_U32(v1 + 32);
+// fdead 601fe8b MEM_U32(v1 + 24) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+t9 = a2 >> 24;
+t8 = t9 | t5;
+// fdead 601fe8b t4 = a0 << 8;
+t3 = t4 & t1;
+// fdead 601fe8b t6 = (int)a0 >> 8;
+// fdead 601fe8b t7 = a0 << 24;
+// fdead 601fe8b MEM_U32(v1 + 28) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+// fdead 601fe8b t8 = a0 >> 24;
+// fdead 601fe8b t6 = MEM_S16(v1 + 36);
+t4 = t8 | t5;
+// fdead 601fe8b MEM_U32(v1 + 32) = t4;
+// fdead 601fe8b t4 = MEM_S16(v1 + 38);
+t7 = t6 & 0xffff;
+t3 = t7 >> 8;
+t2 = t6 << 8;
+// fdead 601fe8b a0 = MEM_U32(v1 + 40);
+t9 = t3 | t2;
+t8 = t4 & 0xffff;
+t5 = t8 >> 8;
+t7 = t4 << 8;
+t6 = t5 | t7;
+// fdead 601fe8b MEM_U16(v1 + 36) = (uint16_t)t9;
+// fdead 601fe8b t2 = a0 << 8;
+t9 = t2 & t1;
+// fdead 601fe8b t4 = (int)a0 >> 8;
+// fdead 601fe8b t3 = a0 << 24;
+// fdead 601fe8b a2 = MEM_U32(v1 + 44);
+// fdead 601fe8b MEM_U16(v1 + 38) = (uint16_t)t6;
+t8 = t3 | t9;
+t5 = t4 & 0xff00;
+t7 = t8 | t5;
+// fdead 601fe8b t6 = a0 >> 24;
+t2 = t6 | t7;
+t9 = a2 << 8;
+t4 = t9 & t1;
+t5 = (int)a2 >> 8;
+t3 = a2 << 24;
+// fdead 601fe8b a0 = MEM_U32(v1 + 48);
+// fdead 601fe8b MEM_U32(v1 + 40) = t2;
+t8 = t3 | t4;
+t6 = t5 & 0xff00;
+t7 = t8 | t6;
+t2 = a2 >> 24;
+t9 = t2 | t7;
+// fdead 601fe8b t4 = a0 << 8;
+t5 = t4 & t1;
+// fdead 601fe8b t6 = (int)a0 >> 8;
+// fdead 601fe8b t3 = a0 << 24;
+// fdead 601fe8b MEM_U32(v1 + 44) = t9;
+t8 = t3 | t5;
+t2 = t6 & 0xff00;
+t7 = t8 | t2;
+// fdead 601fe8b t9 = a0 >> 24;
+v0 = v0 + 0x1;
+t4 = t9 | t7;
+// fdead 601fe8b v1 = v1 + 0x34;
+// fdead 601fe8b MEM_U32(v1 + -4) = t4;
+if (v0 != a1) goto L41c848;
+L41ca94:
+//nop;
+return;
+}
+
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41ca9c:
+//swap_dn:
+// fdead 8b MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41cbe0;
+// fdead 8b v1 = a1 & 0x1;
+t1 = 0xff0000;
+if (v1 == 0) goto L41cb14;
+// fdead 48b a2 = MEM_U32(a0 + 0);
+// fdead 48b a3 = MEM_U32(a0 + 4);
+t6 = a2 >> 24;
+t7 = a2 << 24;
+t9 = a2 << 8;
+t2 = t9 & t1;
+t8 = t6 | t7;
+t4 = a2 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+// fdead 601fc8b t2 = a3 << 8;
+// fdead 601fc8b t7 = a3 >> 24;
+// fdead 601fc8b t9 = a3 << 24;
+t8 = t7 | t9;
+t4 = t2 & t1;
+// fdead 601fc8b MEM_U32(a0 + 0) = t6;
+// fdead 601fc8b t5 = a3 >> 8;
+t6 = t5 & 0xff00;
+t3 = t8 | t4;
+t7 = t3 | t6;
+v0 = 0x1;
+// fdead 601fc8b MEM_U32(a0 + 4) = t7;
+if (v0 == a1) goto L41cbe0;
+L41cb14:
+t9 = v0 << 3;
+// fdead 601fc8b t2 = a1 << 3;
+// fdead 601fc8b t0 = t2 + a0;
+// fdead 601fc8b v1 = a0 + t9;
+t1 = 0xff0000;
+L41cb28:
+// fdead 601fc8b v0 = MEM_U32(v1 + 0);
+// fdead 601fc8b a0 = MEM_U32(v1 + 4);
+t8 = v0 >> 24;
+t4 = v0 << 24;
+t3 = v0 << 8;
+t6 = t3 & t1;
+t5 = t8 | t4;
+t9 = v0 >> 8;
+t2 = t9 & 0xff00;
+t7 = t5 | t6;
+t8 = t7 | t2;
+// fdead 601fc8b t6 = a0 << 8;
+// fdead 601fc8b t4 = a0 >> 24;
+// fdead 601fc8b t3 = a0 << 24;
+// fdead 601fc8b a2 = MEM_U32(v1 + 8);
+// fdead 601fc8b MEM_U32(v1 + 0) = t8;
+t5 = t4 | t3;
+t9 = t6 & t1;
+// fdead 601fc8b t2 = a0 >> 8;
+t8 = t2 & 0xff00;
+t7 = t5 | t9;
+t4 = t7 | t8;
+t9 = a2 << 8;
+t6 = a2 << 24;
+t3 = a2 >> 24;
+// fdead 601fc8b a3 = MEM_U32(v1 + 12);
+t5 = t3 | t6;
+t2 = t9 & t1;
+// fdead 601fc8b MEM_U32(v1 + 4) = t4;
+t8 = a2 >> 8;
+t4 = t8 & 0xff00;
+t7 = t5 | t2;
+t3 = t7 | t4;
+// fdead 601fc8b t2 = a3 << 8;
+// fdead 601fc8b t9 = a3 << 24;
+// fdead 601fc8b t6 = a3 >> 24;
+t5 = t6 | t9;
+t8 = t2 & t1;
+// fdead 601fc8b MEM_U32(v1 + 8) = t3;
+// fdead 601fc8b t4 = a3 >> 8;
+t3 = t4 & 0xff00;
+t7 = t5 | t8;
+t6 = t7 | t3;
+// fdead 601fc8b v1 = v1 + 0x10;
+// fdead 601fc8b MEM_U32(v1 + -4) = t6;
+if (v1 != t0) goto L41cb28;
+L41cbe0:
+//nop;
+return;
+}
+
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41cda0:
+//swap_opt:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffc0;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+t0 = zero;
+if ((int)s0 <= 0) goto L41d01c;
+// fdead 4020b v1 = MEM_U32(sp + 64);
+// fdead 4020b a3 = sp + 0x2c;
+a2 = 0xff0000;
+L41cdec:
+// fdead 4028f at = MEM_U32(v1 + 0);
+t0 = t0 + 0x1;
+// fdead 4028f MEM_U32(a3 + 0) = at;
+// fdead 4028f t7 = MEM_U32(v1 + 4);
+//nop;
+// fdead 4028f MEM_U32(a3 + 4) = t7;
+// fdead 4028f at = MEM_U32(v1 + 8);
+//nop;
+// fdead 4028f MEM_U32(a3 + 8) = at;
+// fdead 4028f t8 = MEM_U32(sp + 52);
+at = 0xff0000;
+// fdead 4028f t1 = t8 << 8;
+// fdead 4028f t2 = t1 & a2;
+// fdead 4028f t9 = t8 << 24;
+// fdead 4028f t4 = t8 >> 8;
+// fdead 4028f t5 = t4 & 0xff00;
+// fdead 4028f t3 = t9 | t2;
+// fdead 4028f t6 = t3 | t5;
+// fdead 4028f t7 = t8 >> 24;
+// fdead 4028f t1 = t6 | t7;
+// fdead 4028f MEM_U32(sp + 52) = t1;
+if (s1 != v0) goto L41cf2c;
+// fdead 4028f at = MEM_U32(a3 + 0);
+//nop;
+// fdead 4028f MEM_U32(v1 + 0) = at;
+// fdead 4028f t2 = MEM_U32(a3 + 4);
+//nop;
+// fdead 4028f MEM_U32(v1 + 4) = t2;
+// fdead 4028f at = MEM_U32(a3 + 8);
+//nop;
+// fdead 4028f MEM_U32(v1 + 8) = at;
+// fdead 4028f t4 = MEM_U32(sp + 44);
+at = 0xff0000;
+// fdead 4028f t5 = t4 << 8;
+// fdead 4028f t8 = t5 & a2;
+// fdead 4028f t3 = t4 << 24;
+// fdead 4028f t6 = t3 | t8;
+// fdead 4028f t7 = t4 >> 8;
+// fdead 4028f t3 = MEM_U32(sp + 48);
+// fdead 4028f t1 = t7 & 0xff00;
+// fdead 4028f t9 = t6 | t1;
+// fdead 4028f t2 = t4 >> 24;
+// fdead 4028f t5 = t9 | t2;
+// fdead 4028f t7 = t3 << 8;
+// fdead 4028f t6 = t7 & a2;
+// fdead 4028f t4 = t3 >> 8;
+// fdead 4028f t8 = t3 << 24;
+// fdead 4028f MEM_U32(sp + 44) = t5;
+// fdead 4028f t1 = t8 | t6;
+// fdead 4028f t9 = t4 & 0xff00;
+// fdead 4028f t2 = t1 | t9;
+// fdead 4028f t5 = t3 >> 24;
+// fdead 4028f t8 = MEM_U8(sp + 44);
+// fdead 4028f t7 = t2 | t5;
+// fdead 4028f MEM_U32(sp + 48) = t7;
+// fdead 4028f MEM_U8(v1 + 0) = (uint8_t)t8;
+// fdead 4028f t6 = MEM_U32(sp + 44);
+// fdead 4028f a0 = MEM_U32(v1 + 0);
+at = at | 0xffff;
+// fdead 4028f t4 = t6 & at;
+// fdead 4028f t1 = t4 ^ a0;
+// fdead 4028f t9 = t1 << 8;
+// fdead 4028f t3 = t9 >> 8;
+// fdead 4028f t2 = t3 ^ a0;
+// fdead 4028f MEM_U32(v1 + 0) = t2;
+// fdead 4028f t5 = MEM_U32(sp + 48);
+// fdead 4028f a1 = MEM_U32(v1 + 4);
+// fdead 4028f t7 = t5 >> 12;
+// fdead 4028f t8 = t7 ^ a1;
+// fdead 4028f t6 = t8 << 12;
+// fdead 4028f t4 = t6 >> 12;
+// fdead 4028f t1 = t4 ^ a1;
+// fdead 4028f MEM_U32(v1 + 4) = t1;
+// fdead 4028f t7 = MEM_U16(v1 + 4);
+// fdead 4028f t9 = MEM_U32(sp + 48);
+// fdead 4028f t8 = t7 & 0xf;
+// fdead 4028f t5 = t9 << 4;
+// fdead 4028f t6 = t5 | t8;
+// fdead 4028f MEM_U16(v1 + 4) = (uint16_t)t6;
+goto L41d014;
+L41cf2c:
+// fdead 4028f t4 = MEM_U8(v1 + 0);
+at = at | 0xffff;
+// fdead 4028f MEM_U8(sp + 44) = (uint8_t)t4;
+// fdead 4028f t1 = MEM_U32(v1 + 0);
+// fdead 4028f t3 = MEM_U32(sp + 44);
+// fdead 4028f t9 = t1 & at;
+// fdead 4028f t2 = t9 ^ t3;
+// fdead 4028f t7 = t2 << 8;
+// fdead 4028f t5 = t7 >> 8;
+// fdead 4028f t8 = t5 ^ t3;
+// fdead 4028f MEM_U32(sp + 44) = t8;
+// fdead 4028f t6 = MEM_U32(v1 + 4);
+// fdead 4028f t1 = MEM_U32(sp + 48);
+at = 0xf0000;
+at = at | 0xffff;
+// fdead 4028f t4 = t6 & at;
+// fdead 4028f t9 = t1 >> 12;
+// fdead 4028f t2 = t4 ^ t9;
+// fdead 4028f t7 = t2 << 12;
+// fdead 4028f t5 = t7 ^ t1;
+// fdead 4028f MEM_U32(sp + 48) = t5;
+// fdead 4028f t3 = MEM_U32(v1 + 4);
+// fdead 4028f t9 = MEM_U16(sp + 50);
+// fdead 4028f t6 = t3 >> 20;
+// fdead 4028f t4 = t6 & 0xfff;
+// fdead 4028f t2 = t9 & 0xf000;
+// fdead 4028f t7 = t4 | t2;
+// fdead 4028f t5 = t8 << 8;
+// fdead 4028f t3 = t5 & a2;
+// fdead 4028f t1 = t8 << 24;
+// fdead 4028f MEM_U16(sp + 50) = (uint16_t)t7;
+// fdead 4028f t6 = t1 | t3;
+// fdead 4028f t9 = t8 >> 8;
+// fdead 4028f t1 = MEM_U32(sp + 48);
+// fdead 4028f t4 = t9 & 0xff00;
+// fdead 4028f t2 = t6 | t4;
+// fdead 4028f t7 = t8 >> 24;
+// fdead 4028f t5 = t2 | t7;
+// fdead 4028f t9 = t1 << 8;
+// fdead 4028f t6 = t9 & a2;
+// fdead 4028f t8 = t1 >> 8;
+// fdead 4028f t3 = t1 << 24;
+// fdead 4028f MEM_U32(sp + 44) = t5;
+// fdead 4028f t4 = t3 | t6;
+// fdead 4028f t2 = t8 & 0xff00;
+// fdead 4028f t7 = t4 | t2;
+// fdead 4028f t5 = t1 >> 24;
+// fdead 4028f t9 = t7 | t5;
+// fdead 4028f MEM_U32(sp + 48) = t9;
+// fdead 4028f at = MEM_U32(a3 + 0);
+//nop;
+// fdead 4028f MEM_U32(v1 + 0) = at;
+// fdead 4028f t8 = MEM_U32(a3 + 4);
+//nop;
+// fdead 4028f MEM_U32(v1 + 4) = t8;
+// fdead 4028f at = MEM_U32(a3 + 8);
+//nop;
+// fdead 4028f MEM_U32(v1 + 8) = at;
+L41d014:
+// fdead 4028f v1 = v1 + 0xc;
+if (t0 != s0) goto L41cdec;
+L41d01c:
+// fdead 4028f ra = MEM_U32(sp + 36);
+// fdead 4028f s0 = MEM_U32(sp + 24);
+// fdead 4028f s1 = MEM_U32(sp + 28);
+// fdead 4028f sp = sp + 0x40;
+return;
+}
+
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, hi = 0;
+L41dee4:
+//ldfsymorder:
+// fdead b a2 = MEM_U32(a0 + 12);
+// fdead b v0 = a1 + 0x60;
+//nop;
+if (a2 == 0) goto L41df14;
+// fdead b t6 = MEM_U32(a0 + 8);
+//nop;
+//nop;
+if (t6 == 0) goto L41df14;
+//nop;
+if (v0 == a2) goto L41df14;
+v0 = zero;
+return v0;
+L41df14:
+// fdead b v1 = MEM_U32(a0 + 8);
+//nop;
+// fdead b t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41df30;
+v0 = zero;
+return v0;
+L41df30:
+// fdead b a1 = MEM_U32(a0 + 28);
+//nop;
+//nop;
+if (a1 == 0) goto L41df64;
+// fdead b t8 = MEM_U32(a0 + 24);
+//nop;
+//nop;
+if (t8 == 0) goto L41df64;
+// fdead b t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41df64;
+v0 = zero;
+return v0;
+L41df64:
+// fdead b t0 = MEM_U32(a0 + 24);
+//nop;
+// fdead b t1 = t0 << 2;
+// fdead b t1 = t1 - t0;
+// fdead b t1 = t1 << 2;
+// fdead b t1 = t1 + t0;
+// fdead b t1 = t1 << 2;
+// fdead b v1 = v1 + t1;
+// fdead b t2 = v1 & 0x3;
+//nop;
+if (t2 == 0) goto L41df98;
+v0 = zero;
+return v0;
+L41df98:
+// fdead b a1 = MEM_U32(a0 + 36);
+//nop;
+//nop;
+if (a1 == 0) goto L41dfc8;
+// fdead b t3 = MEM_U32(a0 + 32);
+// fdead b t4 = v0 + v1;
+//nop;
+if (t3 == 0) goto L41dfc8;
+//nop;
+if (t4 == a1) goto L41dfc8;
+v0 = zero;
+return v0;
+L41dfc8:
+// fdead b t5 = MEM_U32(a0 + 32);
+a2 = 0xc;
+// fdead 8b lo = t5 * a2;
+hi = (uint32_t)((uint64_t)t5 * (uint64_t)a2 >> 32);
+// fdead 8b t6 = lo;
+// fdead 8b v1 = v1 + t6;
+// fdead 8b t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41dff0;
+v0 = zero;
+return v0;
+L41dff0:
+// fdead 8b a1 = MEM_U32(a0 + 44);
+//nop;
+//nop;
+if (a1 == 0) goto L41e024;
+// fdead 8b t8 = MEM_U32(a0 + 40);
+//nop;
+//nop;
+if (t8 == 0) goto L41e024;
+// fdead 8b t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41e024;
+v0 = zero;
+return v0;
+L41e024:
+// fdead 8b t0 = MEM_U32(a0 + 40);
+//nop;
+// fdead 8b lo = t0 * a2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)a2 >> 32);
+// fdead 8b t1 = lo;
+// fdead 8b v1 = v1 + t1;
+// fdead 8b t2 = v1 & 0x3;
+//nop;
+if (t2 == 0) goto L41e04c;
+v0 = zero;
+return v0;
+L41e04c:
+// fdead 8b a1 = MEM_U32(a0 + 52);
+//nop;
+//nop;
+if (a1 == 0) goto L41e07c;
+// fdead 8b t3 = MEM_U32(a0 + 48);
+// fdead 8b t4 = v0 + v1;
+//nop;
+if (t3 == 0) goto L41e07c;
+//nop;
+if (t4 == a1) goto L41e07c;
+v0 = zero;
+return v0;
+L41e07c:
+// fdead 8b t5 = MEM_U32(a0 + 48);
+//nop;
+// fdead 8b t6 = t5 << 2;
+// fdead 8b v1 = v1 + t6;
+// fdead 8b t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41e0a0;
+v0 = zero;
+return v0;
+L41e0a0:
+// fdead 8b a1 = MEM_U32(a0 + 60);
+//nop;
+//nop;
+if (a1 == 0) goto L41e0d4;
+// fdead 8b t8 = MEM_U32(a0 + 56);
+//nop;
+//nop;
+if (t8 == 0) goto L41e0d4;
+// fdead 8b t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41e0d4;
+v0 = zero;
+return v0;
+L41e0d4:
+// fdead 8b t0 = MEM_U32(a0 + 56);
+//nop;
+// fdead 8b v1 = v1 + t0;
+// fdead 8b t1 = v1 & 0x3;
+//nop;
+if (t1 == 0) goto L41e0f4;
+v0 = zero;
+return v0;
+L41e0f4:
+// fdead 8b a1 = MEM_U32(a0 + 68);
+//nop;
+//nop;
+if (a1 == 0) goto L41e124;
+// fdead 8b t2 = MEM_U32(a0 + 64);
+// fdead 8b t3 = v0 + v1;
+//nop;
+if (t2 == 0) goto L41e124;
+//nop;
+if (t3 == a1) goto L41e124;
+v0 = zero;
+return v0;
+L41e124:
+// fdead 8b t4 = MEM_U32(a0 + 64);
+//nop;
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+//nop;
+if (t5 == 0) goto L41e144;
+v0 = zero;
+return v0;
+L41e144:
+// fdead 8b a1 = MEM_U32(a0 + 76);
+//nop;
+//nop;
+if (a1 == 0) goto L41e174;
+// fdead 8b t6 = MEM_U32(a0 + 72);
+// fdead 8b t7 = v0 + v1;
+//nop;
+if (t6 == 0) goto L41e174;
+//nop;
+if (t7 == a1) goto L41e174;
+v0 = zero;
+return v0;
+L41e174:
+// fdead 8b t8 = MEM_U32(a0 + 72);
+//nop;
+// fdead 8b t9 = t8 << 3;
+// fdead 8b t9 = t9 + t8;
+// fdead 8b t9 = t9 << 3;
+// fdead 8b v1 = v1 + t9;
+// fdead 8b t0 = v1 & 0x3;
+//nop;
+if (t0 == 0) goto L41e1a0;
+v0 = zero;
+return v0;
+L41e1a0:
+// fdead 8b a1 = MEM_U32(a0 + 84);
+//nop;
+//nop;
+if (a1 == 0) goto L41e1d0;
+// fdead 8b t1 = MEM_U32(a0 + 80);
+// fdead 8b t2 = v0 + v1;
+//nop;
+if (t1 == 0) goto L41e1d0;
+//nop;
+if (t2 == a1) goto L41e1d0;
+v0 = zero;
+return v0;
+L41e1d0:
+// fdead 8b t3 = MEM_U32(a0 + 80);
+//nop;
+// fdead 8b t4 = t3 << 2;
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+//nop;
+if (t5 == 0) goto L41e1f4;
+v0 = zero;
+return v0;
+L41e1f4:
+// fdead 8b a1 = MEM_U32(a0 + 92);
+//nop;
+//nop;
+if (a1 == 0) goto L41e224;
+// fdead 8b t6 = MEM_U32(a0 + 88);
+// fdead 8b t7 = v0 + v1;
+//nop;
+if (t6 == 0) goto L41e224;
+//nop;
+if (t7 == a1) goto L41e224;
+v0 = zero;
+return v0;
+L41e224:
+// fdead 8b t8 = MEM_U32(a0 + 88);
+//nop;
+// fdead 8b t9 = t8 << 4;
+// fdead 8b v1 = v1 + t9;
+// fdead 8b t0 = v1 & 0x3;
+//nop;
+if (t0 == 0) goto L41e248;
+v0 = zero;
+return v0;
+L41e248:
+// fdead 8b a1 = MEM_U32(a0 + 20);
+//nop;
+//nop;
+if (a1 == 0) goto L41e278;
+// fdead 8b t1 = MEM_U32(a0 + 16);
+// fdead 8b t2 = v0 + v1;
+//nop;
+if (t1 == 0) goto L41e278;
+//nop;
+if (t2 == a1) goto L41e278;
+v0 = zero;
+return v0;
+L41e278:
+// fdead 8b t3 = MEM_U32(a0 + 16);
+//nop;
+// fdead 8b t4 = t3 << 3;
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+// fdead 8b v0 = v1;
+if (t5 == 0) goto L41e29c;
+v0 = zero;
+return v0;
+L41e29c:
+//nop;
+return v0;
+}
+
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0;
+L41e2a4:
+//xrealloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a2 = 0x1000a9e0;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+v0 = f_alloc_resize(mem, sp, a0, a1, a2);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41e2ec:
+//alloc_dispose:
+t0 = MEM_U32(a1 + 0);
+a2 = a0 + 0xfffffff8;
+v0 = MEM_U32(t0 + 0);
+a3 = t0;
+//nop;
+if (v0 == 0) goto L41e420;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41e374;
+//nop;
+if ((int)a2 < (int)a3) goto L41e338;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t8 = v1;
+if ((int)v1 >= 0) goto L41e328;
+t8 = -v1;
+L41e328:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L41e374;
+L41e338:
+a3 = MEM_U32(a3 + 4);
+//nop;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41e374;
+//nop;
+if ((int)a2 < (int)a3) goto L41e338;
+t6 = MEM_U32(a3 + 12);
+//nop;
+t7 = t6;
+if ((int)t6 >= 0) goto L41e364;
+t7 = -t6;
+L41e364:
+v0 = a3 + t7;
+//nop;
+if ((int)v0 < (int)a2) goto L41e338;
+L41e374:
+//nop;
+if (a3 != 0) goto L41e3f8;
+a3 = t0;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41e3f0;
+//nop;
+if ((int)a2 < (int)a3) goto L41e3b4;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t8 = v1;
+if ((int)v1 >= 0) goto L41e3a4;
+t8 = -v1;
+L41e3a4:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L41e3f0;
+L41e3b4:
+a3 = MEM_U32(a3 + 0);
+//nop;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41e3f0;
+//nop;
+if ((int)a2 < (int)a3) goto L41e3b4;
+t6 = MEM_U32(a3 + 12);
+//nop;
+t7 = t6;
+if ((int)t6 >= 0) goto L41e3e0;
+t7 = -t6;
+L41e3e0:
+v0 = a3 + t7;
+//nop;
+if ((int)v0 < (int)a2) goto L41e3b4;
+L41e3f0:
+//nop;
+if (a3 == 0) goto L41e5c4;
+L41e3f8:
+v1 = MEM_U32(a3 + 12);
+//nop;
+//nop;
+if ((int)v1 >= 0) goto L41e420;
+L41e408:
+a3 = MEM_U32(a3 + 0);
+//nop;
+t8 = MEM_U32(a3 + 12);
+//nop;
+//nop;
+if ((int)t8 < 0) goto L41e408;
+L41e420:
+a0 = MEM_U32(a2 + 4);
+t4 = 0xfffffffc;
+a1 = a0 & t4;
+t1 = a2 + a1;
+t0 = t1;
+t2 = MEM_U32(t0 + 4);
+t9 = a0 & 0x2;
+t3 = t2 & t4;
+if (t9 != 0) goto L41e514;
+t1 = MEM_U32(a2 + 0);
+t6 = t2 & 0x1;
+a0 = t1;
+t4 = a2 - a0;
+if (t6 != 0) goto L41e4c4;
+t7 = a0 + a1;
+a0 = t7 + t3;
+t2 = MEM_U32(a3 + 8);
+if ((int)a0 < (int)0x100) {
+at = (int)t1 < (int)0x100;
+goto L41e48c;}
+v0 = a0 + 0x2;
+if ((int)t1 >= (int)0x100) goto L41e490;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L41e48c:
+v0 = a0 + 0x2;
+L41e490:
+MEM_U32(t4 + 4) = v0;
+a1 = t4 + a0;
+MEM_U32(a1 + 0) = a0;
+if ((int)t3 < (int)0x100) goto L41e5c4;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+//nop;
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L41e5c4;
+MEM_U32(a3 + 8) = t5;
+goto L41e5c4;
+L41e4c4:
+a0 = a0 + a1;
+if ((int)a0 < (int)0x100) {
+at = (int)t1 < (int)0x100;
+goto L41e4f8;}
+v1 = a0 + 0x2;
+if ((int)t1 >= (int)0x100) goto L41e4fc;
+t2 = MEM_U32(a3 + 8);
+//nop;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L41e4f8:
+v1 = a0 + 0x2;
+L41e4fc:
+MEM_U32(t4 + 4) = v1;
+t8 = t3 + 0x1;
+MEM_U32(t0 + 4) = t8;
+t0 = t4 + a0;
+MEM_U32(t0 + 0) = a0;
+goto L41e5c4;
+L41e514:
+t9 = t2 & 0x1;
+at = (int)a1 < (int)0x100;
+if (t9 != 0) goto L41e584;
+a1 = a1 + t3;
+t2 = MEM_U32(a3 + 8);
+t4 = a2 + a1;
+if ((int)a1 < (int)0x100) goto L41e54c;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+t4 = a2 + a1;
+L41e54c:
+MEM_U32(t4 + 0) = a1;
+t6 = a1 + 0x2;
+MEM_U32(a2 + 4) = t6;
+if ((int)t3 < (int)0x100) goto L41e5c4;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+//nop;
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L41e5c4;
+MEM_U32(a3 + 8) = t5;
+goto L41e5c4;
+// fdead 0 at = (int)a1 < (int)0x100;
+L41e584:
+t4 = t1;
+if (at != 0) goto L41e5ac;
+t2 = MEM_U32(a3 + 8);
+//nop;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+t4 = t1;
+L41e5ac:
+MEM_U32(t4 + 0) = a1;
+t7 = a1 + 0x2;
+MEM_U32(a2 + 4) = t7;
+v0 = t3 + 0x1;
+MEM_U32(t0 + 4) = v0;
+return;
+L41e5c4:
+//nop;
+return;
+}
+
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L41e5cc:
+//xmalloc:
+a1 = 0x1000a9e0;
+v0 = f_alloc_new(mem, sp, a0, a1);
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0;
+L41e5e8:
+//alloc_new:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 32) = ra;
+L41e5fc:
+// fdead 400001eb MEM_U32(sp + 28) = gp;
+t0 = MEM_U32(a1 + 0);
+a0 = a0 + 0xf;
+t5 = 0xfffffff8;
+if (t0 == 0) goto L41e718;
+L41e610:
+t1 = MEM_U32(t0 + 8);
+a0 = a0 & t5;
+t2 = MEM_U32(t1 + 4);
+//nop;
+if ((int)a0 >= (int)0x10) goto L41e62c;
+a0 = 0x10;
+L41e62c:
+if ((int)t2 >= (int)a0) {
+t2 = t2 & t5;
+goto L41e658;}
+t2 = t2 & t5;
+t3 = t1;
+L41e63c:
+t1 = MEM_U32(t1 + 12);
+//nop;
+t2 = MEM_U32(t1 + 4);
+t4 = (int)t2 < (int)a0;
+if (t1 == t3) goto L41e6d4;
+if ((int)t2 < (int)a0) {
+t2 = t2 & t5;
+goto L41e63c;}
+t2 = t2 & t5;
+L41e658:
+t3 = t2 + 0xffffff00;
+if ((int)a0 >= (int)t3) {
+t3 = t1 + t2;
+goto L41e69c;}
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t3 + 0) = a0;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+t3 = t3 - a0;
+t4 = a0 | 0x1;
+MEM_U32(t3 + 4) = t4;
+t2 = t2 - a0;
+MEM_U32(t3 + 0) = t2;
+t2 = t2 | 0x2;
+MEM_U32(t1 + 4) = t2;
+v0 = t3 + 0x8;
+goto L41e74c;
+L41e69c:
+t3 = MEM_U32(t1 + 8);
+t4 = MEM_U32(t1 + 12);
+t5 = MEM_U32(t1 + 4);
+MEM_U32(t3 + 12) = t4;
+MEM_U32(t4 + 8) = t3;
+MEM_U32(t0 + 8) = t3;
+t5 = t5 | 0x1;
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t1 + 4) = t5;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+v0 = t1 + 0x8;
+goto L41e74c;
+L41e6d4:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 36) = t0;
+//nop;
+//nop;
+a0 = a0 + 0xfffffffc;
+v0 = f_alloc_next_scb(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+t0 = MEM_U32(sp + 36);
+a0 = MEM_U32(sp + 40);
+if (v0 == 0) goto L41e710;
+t1 = MEM_U32(t0 + 8);
+t5 = 0xfffffff8;
+t2 = MEM_U32(t1 + 4);
+t2 = t2 & t5;
+goto L41e658;
+L41e710:
+//nop;
+goto L41e74c;
+L41e718:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+//nop;
+//nop;
+a0 = a1;
+v0 = f_alloc_mark(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+t0 = MEM_U32(a1 + 0);
+if (v0 == 0) goto L41e710;
+t5 = 0xfffffff8;
+goto L41e610;
+L41e74c:
+// bdead 9 ra = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L41e764:
+//alloc_page:
+//nop;
+//nop;
+//nop;
+a1 = 0x10001490;
+sp = sp + 0xffffffd0;
+v0 = MEM_U32(a1 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if (v0 == 0) goto L41e79c;
+t6 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L41e800;
+L41e79c:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_sbrk(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+v1 = v0;
+if (v0 != at) goto L41e7c4;
+v1 = zero;
+goto L41e80c;
+L41e7c4:
+a1 = 0xfffff000;
+t7 = v0 & a1;
+t8 = v1 + 0xfff;
+if (v0 == t7) goto L41e80c;
+t9 = t8 & a1;
+a0 = t9 - v1;
+//nop;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = v1;
+v0 = wrapper_sbrk(mem, a0);
+v1 = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 32);
+// bdead 211 gp = MEM_U32(sp + 24);
+v1 = v1 + t0;
+goto L41e80c;
+L41e800:
+t1 = MEM_U32(v0 + 4);
+v1 = v0;
+MEM_U32(a1 + 0) = t1;
+L41e80c:
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x30;
+v0 = v1;
+return v0;
+}
+
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41e850:
+//alloc_scb:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a1;
+MEM_U32(sp + 36) = a1;
+v0 = f_alloc_page(mem, sp, a0);
+t6 = MEM_U32(sp + 32);
+// bdead 4000800b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+MEM_U32(t6 + 0) = v0;
+if (v0 == 0) goto L41e8d8;
+a0 = v0 + a2;
+a0 = a0 + 0xfffffff8;
+a1 = a0 - v0;
+t7 = -a2;
+t8 = a1 + 0xfffffff2;
+MEM_U32(v0 + 12) = t7;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 16) = zero;
+MEM_U32(v0 + 20) = t8;
+t9 = a1 + 0xfffffff0;
+t0 = 0x1;
+MEM_U32(a0 + 0) = t9;
+MEM_U32(a0 + 4) = t0;
+v1 = v0 + 0x10;
+MEM_U32(v0 + 24) = v1;
+MEM_U32(v0 + 28) = v1;
+MEM_U32(v0 + 8) = v1;
+L41e8d8:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41e8e8:
+//alloc_mark:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 64) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x34;
+a1 = 0x10000;
+f_alloc_scb(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 52);
+// bdead 40000023 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 64);
+at = 0xfffffffc;
+if (a0 != 0) goto L41e930;
+v0 = zero;
+goto L41e9ec;
+L41e930:
+t6 = MEM_U32(sp + 52);
+v1 = MEM_U32(t1 + 0);
+t0 = t6;
+t7 = MEM_U32(sp + 52);
+if (v1 == 0) goto L41e974;
+v0 = MEM_U32(v1 + 4);
+a0 = t6;
+//nop;
+if (v0 == 0) goto L41e968;
+L41e954:
+v1 = v0;
+v0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L41e954;
+L41e968:
+MEM_U32(v1 + 4) = a0;
+MEM_U32(a0 + 0) = v1;
+t7 = MEM_U32(sp + 52);
+L41e974:
+//nop;
+MEM_U32(t1 + 0) = t7;
+t8 = MEM_U32(sp + 52);
+//nop;
+t9 = MEM_U32(t8 + 12);
+//nop;
+t2 = t9;
+if ((int)t9 >= 0) goto L41e998;
+t2 = -t9;
+L41e998:
+MEM_U32(t8 + 12) = t2;
+t3 = MEM_U32(sp + 52);
+t7 = 0x2;
+v1 = MEM_U32(t3 + 8);
+v0 = t0;
+a3 = MEM_U32(v1 + 4);
+a0 = v1 + 0x10;
+t4 = a3 & at;
+a1 = v1 + t4;
+a2 = a1 - v1;
+t5 = a2 + 0xfffffff0;
+MEM_U32(v1 + 12) = a0;
+MEM_U32(v1 + 8) = a0;
+MEM_U32(v1 + 28) = v1;
+MEM_U32(v1 + 24) = v1;
+MEM_U32(a1 + 0) = t5;
+t9 = MEM_U32(sp + 52);
+t6 = a2 + 0xfffffff2;
+MEM_U32(v1 + 20) = t6;
+MEM_U32(v1 + 4) = t7;
+MEM_U32(t9 + 8) = a0;
+L41e9ec:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x40;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t8 = 0, t9 = 0;
+L41ead4:
+//alloc_next_scb:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+a2 = a0;
+at = 0x7fff0000;
+MEM_U32(sp + 60) = a1;
+at = at | 0xf000;
+t6 = a2 + 0x1017;
+a1 = t6 & at;
+at = 0x10000;
+at = (int)a1 < (int)at;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+a0 = sp + 0x2c;
+if (at == 0) goto L41eb18;
+a1 = 0x10000;
+L41eb18:
+//nop;
+//nop;
+//nop;
+f_alloc_scb(mem, sp, a0, a1);
+t8 = MEM_U32(sp + 44);
+// bdead 42000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 60);
+//nop;
+if (t8 != 0) goto L41eb44;
+v0 = zero;
+goto L41ebb8;
+L41eb44:
+v1 = MEM_U32(a1 + 0);
+t9 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 4);
+//nop;
+t0 = MEM_U32(sp + 44);
+if (v0 == 0) goto L41eb74;
+L41eb5c:
+v1 = v0;
+v0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L41eb5c;
+t0 = MEM_U32(sp + 44);
+L41eb74:
+MEM_U32(v1 + 4) = t9;
+MEM_U32(t0 + 0) = v1;
+v1 = MEM_U32(a1 + 0);
+t1 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 8);
+a0 = MEM_U32(t1 + 8);
+//nop;
+if (v0 == 0) goto L41ebb0;
+t2 = MEM_U32(v0 + 8);
+MEM_U32(a0 + 12) = v0;
+MEM_U32(a0 + 8) = t2;
+t3 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(t3 + 12) = a0;
+MEM_U32(v0 + 8) = a0;
+L41ebb0:
+MEM_U32(v1 + 8) = a0;
+v0 = 0x1;
+L41ebb8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0,
+t8 = 0, t9 = 0;
+L41ebc8:
+//alloc_resize:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+a3 = a0;
+if (a0 == 0) goto L41eca0;
+t6 = MEM_U32(a0 + -4);
+s0 = a0 + 0xfffffff8;
+t7 = t6 & 0x1;
+at = 0xfffffffc;
+if (t7 != 0) goto L41ec10;
+v0 = zero;
+goto L41ecc0;
+L41ec10:
+a2 = MEM_U32(s0 + 4);
+t9 = MEM_U32(sp + 52);
+t8 = a2 & at;
+t0 = t9 + 0x4;
+a2 = t8;
+if ((int)t8 < (int)t0) goto L41ec34;
+v0 = a3;
+goto L41ecc0;
+L41ec34:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 48) = a3;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a3 = MEM_U32(sp + 48);
+s0 = v0;
+if (v0 != 0) goto L41ec68;
+v0 = zero;
+goto L41ecc0;
+L41ec68:
+//nop;
+a0 = s0;
+a1 = a3;
+MEM_U32(sp + 48) = a3;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+//nop;
+a1 = MEM_U32(sp + 56);
+//nop;
+f_alloc_dispose(mem, sp, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 24);
+v1 = s0;
+goto L41ecbc;
+L41eca0:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = v0;
+L41ecbc:
+v0 = v1;
+L41ecc0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+//nop;
+//nop;
+//nop;
+//nop;
+}
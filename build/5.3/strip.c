@@ -0,0 +1,38070 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x4e6f206f,0x75747075,0x74206669,0x6c65206e,0x616d652e,0xa000000,0x25733a20,0x496e666f,
+0x3a204d69,0x70733a20,0x76657273,0x696f6e20,0x25642e25,0x640a0000,0x25733a20,0x496e666f,
+0x3a20756e,0x6b6e6f77,0x6e20666c,0x61672028,0x25632920,0x69676e6f,0x7265640a,0x0,
+0x55736167,0x653a2025,0x73202d5b,0x666c6167,0x735d2066,0x696c656e,0x616d652e,0x2e2e0a00,
+0x25733a20,0x456c6620,0x68656164,0x65722062,0x61643a20,0x25730a00,0x73747269,0x70000000,
+0x25733a20,0x4572726f,0x7220696e,0x20726561,0x64696e67,0x206f626a,0x65637420,0x25730a00,
+0x73747269,0x70000000,0x25733a20,0x466f7220,0x36342d62,0x6974206f,0x626a6563,0x74202573,
+0x2c207573,0x65207634,0x2e303020,0x746f6f6c,0x730a0000,0x73747269,0x70000000,0x73747269,
+0x703a2045,0x72726f72,0x3a202573,0x20697320,0x6e6f7420,0x616e206f,0x626a6563,0x74206669,
+0x6c652d2d,0x2063616e,0x27742072,0x65616420,0x68656164,0x65720a00,0x73747269,0x703a2049,
+0x6e666f3a,0x20736861,0x72656420,0x6f626a65,0x63742069,0x73206e6f,0x74207374,0x72697070,
+0x65640a00,0x544d5044,0x49520000,0x2f757372,0x2f746d70,0x0,0x73747269,0x703a2045,
+0x72726f72,0x3a202573,0x20697320,0x6e6f7420,0x616e2045,0x4c46206f,0x626a6563,0x74206669,
+0x6c650a00,0x73747269,0x703a2049,0x6e666f3a,0x20736861,0x72656420,0x6f626a65,0x63742069,
+0x73206e6f,0x74207374,0x72697070,0x65640a00,0x72616e20,0x6f757420,0x6f66206d,0x656d6f72,
+0x79000000,0x2e737472,0x74616200,0x2e73796d,0x74616200,0x2e6d6465,0x62756700,0x2e636f6d,
+0x70616374,0x5f72656c,0x0,0x2e736873,0x74727461,0x62000000,0x73747269,0x703a2049,
+0x6e666f3a,0x20257320,0x616c7265,0x61647920,0x73747269,0x70706564,0xa000000,0x73747269,
+0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,0x20737461,0x74202573,0xa000000,0x25732f5f,
+0x5f5f7374,0x72697025,0x64000000,0x77726974,0x696e6720,0x73656374,0x696f6e73,0x20707269,
+0x6f722074,0x6f207374,0x72697070,0x65642073,0x65637469,0x6f6e730a,0x0,0x73747269,
+0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,0x20777269,0x74652074,0x6f207465,0x6d702066,
+0x696c650a,0x0,0x77726974,0x696e6720,0x52505420,0x61667465,0x72207374,0x72697070,
+0x65642073,0x65637469,0x6f6e730a,0x0,0x73747269,0x703a2045,0x72726f72,0x3a206361,
+0x6e6e6f74,0x20777269,0x74652074,0x6f207465,0x6d702066,0x696c650a,0x0,0x77726974,
+0x696e6720,0x73656374,0x696f6e73,0x20616674,0x65722073,0x74726970,0x70656420,0x73656374,
+0x696f6e73,0xa000000,0x73747269,0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,0x20777269,
+0x74652074,0x6f207465,0x6d702066,0x696c650a,0x0,0x77726974,0x696e6720,0x73656374,
+0x696f6e73,0x20616674,0x65722073,0x74726970,0x70656420,0x73656374,0x696f6e73,0xa000000,
+0x73747269,0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,0x20777269,0x74652074,0x6f207465,
+0x6d702066,0x696c650a,0x0,0x73747269,0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,
+0x2072656c,0x696e6b20,0x25732074,0x6f202573,0xa000000,0x73747269,0x703a2045,0x72726f72,
+0x3a206361,0x6e6e6f74,0x2072656c,0x696e6b20,0x25732074,0x6f202573,0xa000000,0x544d5044,
+0x49520000,0x2f757372,0x2f746d70,0x0,0x73747269,0x703a2049,0x6e666f3a,0x20257320,
+0x616c7265,0x61647920,0x73747269,0x70706564,0xa000000,0x73747269,0x703a2049,0x6e666f3a,
+0x202d7820,0x616e6420,0x2d6c206f,0x7074696f,0x6e732073,0x7570706f,0x72746564,0x206f6e6c,
+0x7920666f,0x7220454c,0x4620666f,0x726d6174,0x2c206e6f,0x7420434f,0x46460a00,0x73747269,
+0x703a2045,0x72726f72,0x3a200000,0x20636f6e,0x7461696e,0x73207265,0x6c6f6361,0x74696f6e,
+0x20656e74,0x72696573,0x2d2d206e,0x6f742073,0x74726970,0x7065640a,0x0,0x73747269,
+0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,0x20737461,0x74202573,0xa000000,0x25732f5f,
+0x5f5f7374,0x72697025,0x64000000,0x73747269,0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,
+0x20737472,0x69702025,0x730a0000,0x73747269,0x703a2045,0x72726f72,0x3a206361,0x6e6e6f74,
+0x2072656c,0x696e6b20,0x25732074,0x6f202573,0xa000000,0xf03fced8,0xf03fcf60,0xf03fcf60,
+0xf03fcef4,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,
+0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fce3c,0xf03fcf60,0xf03fcf60,0xf03fcf60,
+0xf03fcf44,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fcf60,0xf03fce44,0xf03fcf60,
+0xf03fcf60,0xf03fce60,0xf03fcf60,0xf03fcf60,0xf03fceb4,0xf03fcf60,0xf03fcf60,0xf03fcf60,
+0xf03fcf60,0xf03fcf60,0xf03fcebc,0x0,0x73776170,0x206f6620,0x61757873,0x206e6f74,
+0x20737570,0x706f7274,0x65642077,0x68656e20,0x64657374,0x73657820,0x213d2068,0x6f737473,
+0x65780a00,0xf0401084,0xf04011a0,0xf0401218,0xf0401218,0xf0401218,0xf0401218,0xf0401218,
+0x4d41494e,0x5f5f0000,0x6f626a5f,0x77726974,0x65206661,0x696c6564,0x0,0x6f626a5f,
+0x696e6974,0x3a206f62,0x6a202573,0xa000000,0x6f626a5f,0x696e6974,0x3a206765,0x74686f73,
+0x74736578,0x2025640a,0x0,0x6f626a5f,0x696e6974,0x3a206f62,0x6a2d3e6f,0x5f6d6f64,
+0x65202564,0xa000000,0x6f626a5f,0x696e6974,0x3a20456c,0x66206f62,0x6a656374,0xa000000,
+0x6f626a5f,0x696e6974,0x3a20436f,0x6666206f,0x626a6563,0x740a0000,0x4572726f,0x723a2063,
+0x624c696e,0x654f6666,0x73657420,0x67726561,0x74657220,0x7468616e,0x2066696c,0x65207369,
+0x7a652e0a,0x0,0x4572726f,0x723a2063,0x62417578,0x4f666673,0x65742067,0x72656174,
+0x65722074,0x68616e20,0x66696c65,0x2073697a,0x652e0a00,0x4572726f,0x723a2063,0x62526664,
+0x4f666673,0x65742067,0x72656174,0x65722074,0x68616e20,0x66696c65,0x2073697a,0x652e0a00,
+0x4572726f,0x723a2063,0x6250644f,0x66667365,0x74206772,0x65617465,0x72207468,0x616e2066,
+0x696c6520,0x73697a65,0x2e0a0000,0x4572726f,0x723a2063,0x6246644f,0x66667365,0x74206772,
+0x65617465,0x72207468,0x616e2066,0x696c6520,0x73697a65,0x2e0a0000,0x4572726f,0x723a2063,
+0x6253796d,0x4f666673,0x65742067,0x72656174,0x65722074,0x68616e20,0x66696c65,0x2073697a,
+0x652e0a00,0x4572726f,0x723a2063,0x62457874,0x4f666673,0x65742067,0x72656174,0x65722074,
+0x68616e20,0x66696c65,0x2073697a,0x652e0a00,0x4572726f,0x723a2063,0x62537345,0x78744f66,
+0x66736574,0x20677265,0x61746572,0x20746861,0x6e206669,0x6c652073,0x697a652e,0xa000000,
+0x4572726f,0x723a2063,0x6253734f,0x66667365,0x74206772,0x65617465,0x72207468,0x616e2066,
+0x696c6520,0x73697a65,0x2e0a0000,0x53796d62,0x6f6c2074,0x61626c65,0x20686561,0x64657220,
+0x6d616769,0x63206973,0x20307825,0x780a0000,0x6f626a5f,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x20666169,0x6c65640a,0x0,0x61646469,0x6e67206f,0x626a2074,0x6f206f62,
+0x6a6c6973,0x74000000,0x61646469,0x6e67206f,0x626a2074,0x6f206f62,0x6a6c6973,0x74000000,
+0x61646469,0x6e67206f,0x626a2074,0x6f206f62,0x6a6c6973,0x74000000,0x6f626a5f,0x77726974,
+0x65206661,0x696c6564,0x0,0x6f626a5f,0x77726974,0x65206661,0x696c6564,0x0,
+0x2e64796e,0x616d6963,0x0,0x6f626a5f,0x64796e61,0x6d69633a,0x42616420,0x6f626a20,
+0x74797065,0x2025640a,0x0,0x30000000,0x6f626a2e,0x63000000,0x6765745f,0x64796e61,
+0x6d69635f,0x696e666f,0x3a206479,0x6e616464,0x72203078,0x25782c20,0x6f626a20,0x30782578,
+0x2c206f66,0x66736574,0x20307825,0x782c3078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a206f62,0x6a203078,0x25782c20,0x6e616d65,0x2025732c,0x2064796e,0x20307825,
+0x782c6f66,0x66736574,0x20307825,0x782c3078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a206261,0x73652061,0x64647220,0x30782578,0xa000000,0x6765745f,0x64796e61,
+0x6d69635f,0x696e666f,0x3a20696e,0x69742061,0x64647220,0x30782578,0xa000000,0x6765745f,
+0x64796e61,0x6d69635f,0x696e666f,0x3a207069,0x78696520,0x696e6974,0x20616464,0x72203078,
+0x25780a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206669,0x6e692061,0x64647220,
+0x30782578,0xa000000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206861,0x73682061,
+0x64647220,0x30782578,0xa000000,0x6f626a5f,0x6e627563,0x6b657428,0x6f29203e,0x20300000,
+0x6f626a2e,0x63000000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207374,0x72746162,
+0x20616464,0x72203078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206479,
+0x6e73796d,0x20616464,0x72203078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a206d73,0x796d2061,0x64647220,0x30782578,0xa000000,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a20676f,0x74206164,0x64722030,0x7825780a,0x0,0x6765745f,0x64796e61,
+0x6d69635f,0x696e666f,0x3a207265,0x6c6f6320,0x61646472,0x20307825,0x780a0000,0x6765745f,
+0x64796e61,0x6d69635f,0x696e666f,0x3a206c69,0x626c6973,0x74206164,0x64722030,0x7825780a,
+0x0,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a20636f,0x6e666c69,0x63742061,
+0x64647220,0x30782578,0xa000000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206c6f,
+0x6320676f,0x74202320,0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a20696e,
+0x64657820,0x6f662066,0x69727374,0x20756e72,0x65666572,0x656e6365,0x64206578,0x7465726e,
+0x616c2073,0x796d626f,0x6c202320,0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a206669,0x72737420,0x73796d62,0x6f6c2074,0x68617420,0x68617320,0x6120676f,0x74202320,
+0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207473,0x74616d70,0x20307825,
+0x780a0000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206963,0x686b7375,0x6d203078,
+0x25780a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206976,0x65727369,0x6f6e2030,
+0x7825780a,0x0,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206d69,0x70732066,
+0x6c616773,0x20307825,0x780a0000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207265,
+0x6c6f6320,0x23202564,0xa000000,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207265,
+0x6c6f6320,0x656e7472,0x79203078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a207379,0x6d207461,0x62202320,0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a207379,0x6d20656e,0x74727920,0x30782578,0xa000000,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a207374,0x72202320,0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a206c69,0x626c6973,0x74202320,0x25640a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a20636f,0x6e666c69,0x63742023,0x2025640a,0x0,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a20726c,0x645f6d61,0x70203078,0x25780a00,0x6765745f,0x64796e61,0x6d69635f,
+0x696e666f,0x3a204454,0x5f53594d,0x424f4c49,0x43206973,0x20707265,0x73656e74,0xa000000,
+0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207374,0x6f726564,0x205f726c,0x645f7465,
+0x78745f72,0x65736f6c,0x76652061,0x64647220,0x30782578,0xa000000,0x6765745f,0x64796e61,
+0x6d69635f,0x696e666f,0x3a20756e,0x6b6e6f77,0x6e204454,0x203a2030,0x7825780a,0x0,
+0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206578,0x7465726e,0x616c2067,0x6f742030,
+0x7825780a,0x0,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a207270,0x61746820,
+0x25730a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a20736f,0x6e616d65,0x2025730a,
+0x0,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,0x3a206f62,0x6a656374,0x2773206c,
+0x69626c69,0x73742069,0x73206e75,0x6c6c0a00,0x6765745f,0x64796e61,0x6d69635f,0x696e666f,
+0x3a206c69,0x62726172,0x79202573,0x20697320,0x61646465,0x6420746f,0x206c6962,0x6c697374,
+0xa000000,0x30000000,0x6f626a2e,0x63000000,0x30000000,0x6f626a2e,0x63000000,0x6f626a5f,
+0x6e657773,0x74723a20,0x756e6162,0x6c652074,0x6f206d61,0x6c6c6f63,0x20666f72,0x206e6577,
+0x200a0000,0x73706c69,0x743a2025,0x730a0000,0x6d617463,0x685f7374,0x72696e67,0x3a20756e,
+0x61626c65,0x20746f20,0x6d616c6c,0x6f632066,0x6f72204e,0x414d4520,0x6c697374,0xa000000,
+0x6d617463,0x685f7374,0x72696e67,0x3a20756e,0x61626c65,0x20746f20,0x6d616c6c,0x6f632066,
+0x6f72204e,0x414d4520,0x6c697374,0xa000000,0x2e000000,0x6d617463,0x685f7374,0x72696e67,
+0x3a20756e,0x61626c65,0x20746f20,0x6d616c6c,0x6f632066,0x6f72204e,0x414d4520,0x6c697374,
+0xa000000,0x6f2d3e6f,0x5f746172,0x6765745f,0x73776170,0x70656420,0x3d202563,0xa000000,
+0x6f2d3e6f,0x5f747970,0x65203d20,0x25640a00,0x6f2d3e6f,0x5f706669,0x6c656864,0x72203d20,
+0x30782578,0xa000000,0x6f2d3e6f,0x5f70616f,0x75746864,0x72203d20,0x30782578,0xa000000,
+0x6f2d3e6f,0x5f707363,0x6e686472,0x203d2030,0x7825780a,0x0,0x6f2d3e6f,0x5f706864,
+0x7272203d,0x20307825,0x780a0000,0x6f2d3e6f,0x5f707261,0x77203d20,0x30782578,0xa000000,
+0x6f2d3e6f,0x5f6e616d,0x65202830,0x78257829,0x203d2025,0x730a0000,0x6f2d3e6f,0x5f70656c,
+0x66646872,0x203d2030,0x7825780a,0x0,0x6f2d3e6f,0x5f707072,0x6f676864,0x72203d20,
+0x30782578,0xa000000,0x6f2d3e6f,0x5f707365,0x63746864,0x72203d20,0x30782578,0xa000000,
+0x6f2d3e6f,0x5f706174,0x68203d20,0x25730a00,0x6f2d3e6f,0x5f736f6e,0x616d6520,0x3d202573,
+0xa000000,0x6f2d3e6f,0x5f626173,0x655f6164,0x64726573,0x73203d20,0x30782578,0xa000000,
+0x6f2d3e6f,0x5f746578,0x745f7374,0x61727420,0x3d203078,0x25780a00,0x6f2d3e6f,0x5f746578,
+0x745f7369,0x7a65203d,0x2025640a,0x0,0x6f2d3e6f,0x5f646174,0x615f7374,0x61727420,
+0x3d203078,0x25780a00,0x6f2d3e6f,0x5f627373,0x5f737461,0x7274203d,0x20307825,0x780a0000,
+0x6f2d3e6f,0x5f627373,0x5f73697a,0x65203d20,0x25640a00,0x6f2d3e6f,0x5f656e74,0x7279203d,
+0x20307825,0x780a0000,0x6f2d3e6f,0x5f626173,0x65203d20,0x30782578,0xa000000,0x6f2d3e6f,
+0x5f686173,0x68203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f737472,0x203d2030,0x7825780a,
+0x0,0x6f2d3e6f,0x5f647379,0x6d203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f6d7379,
+0x6d203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f676f74,0x203d2030,0x7825780a,0x0,
+0x6f2d3e6f,0x5f657874,0x676f7420,0x3d203078,0x25780a00,0x6f2d3e6f,0x5f72656c,0x203d2030,
+0x7825780a,0x0,0x6f2d3e6f,0x5f6c6962,0x6c203d20,0x30782578,0xa000000,0x6f2d3e6f,
+0x5f636f6e,0x66203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f647966,0x6c616773,0x203d2030,
+0x7825780a,0x0,0x6f2d3e6f,0x5f6c6f63,0x676f746e,0x6f203d20,0x25640a00,0x6f2d3e6f,
+0x5f727061,0x7468203d,0x2025730a,0x0,0x6f2d3e6f,0x5f726c64,0x76657220,0x3d202564,
+0xa000000,0x6f2d3e6f,0x5f747374,0x616d7020,0x3d202564,0xa000000,0x6f2d3e6f,0x5f696368,
+0x6b73756d,0x203d2030,0x7825780a,0x0,0x6f2d3e6f,0x5f697665,0x7273696f,0x6e203d20,
+0x25640a00,0x6f2d3e6f,0x5f73796d,0x636f756e,0x74203d20,0x25640a00,0x6f2d3e6f,0x5f737965,
+0x6e74203d,0x2025640a,0x0,0x6f2d3e6f,0x5f737473,0x697a6520,0x3d202564,0xa000000,
+0x6f2d3e6f,0x5f726c73,0x697a6520,0x3d202564,0xa000000,0x6f2d3e6f,0x5f726c65,0x6e74203d,
+0x2025640a,0x0,0x6f2d3e6f,0x5f6c6c63,0x6f756e74,0x203d2025,0x640a0000,0x6f2d3e6f,
+0x5f687473,0x697a6520,0x3d202564,0xa000000,0x6f2d3e6f,0x5f636663,0x6f756e74,0x203d2025,
+0x640a0000,0x6f2d3e6f,0x5f726c64,0x666c6167,0x203d2025,0x640a0000,0x6f2d3e6f,0x5f666c61,
+0x67203d20,0x25640a00,0x6f2d3e6f,0x5f6d6f64,0x65203d20,0x25640a00,0x6f2d3e6f,0x5f696e69,
+0x74203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f706978,0x69655f69,0x6e697420,0x3d203078,
+0x25780a00,0x6f2d3e6f,0x5f66696e,0x69203d20,0x30782578,0xa000000,0x6f2d3e6f,0x5f756e72,
+0x65666578,0x746e6f20,0x3d202564,0xa000000,0x6f2d3e6f,0x5f676f74,0x73796d20,0x3d202564,
+0xa000000,0x6f2d3e6f,0x5f726c64,0x5f6d6170,0x203d2030,0x7825780a,0x0,0x5f70726f,
+0x63656475,0x72655f74,0x61626c65,0x0,0x5f70726f,0x63656475,0x72655f74,0x61626c65,
+0x5f73697a,0x65000000,0x5f70726f,0x63656475,0x72655f74,0x61626c65,0x0,0x5f70726f,
+0x63656475,0x72655f74,0x61626c65,0x0,0x43616e6e,0x6f74206f,0x70656e20,0x25730a00,
+0x43616e6e,0x6f74206d,0x6d617020,0x74686520,0x72756e74,0x696d6520,0x70726f63,0x20746162,
+0x6c65206f,0x66202573,0xa000000,0x5f70726f,0x63656475,0x72655f73,0x7472696e,0x675f7461,
+0x626c6500,0x5f70726f,0x63656475,0x72655f73,0x7472696e,0x675f7461,0x626c6500,0x5f70726f,
+0x63656475,0x72655f74,0x61626c65,0x5f73697a,0x65000000,0xf0402c0c,0xf0402b68,0xf0402c00,
+0xf0402c0c,0xf0402c0c,0xf0402c0c,0xf0402c0c,0xf04047b8,0xf04047d4,0xf04047f0,0xf040480c,
+0xf0404828,0xf0404520,0xf04046b0,0xf0404738,0xf0404710,0xf0404764,0xf04048ec,0xf0404ad8,
+0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf04048d0,0xf040487c,0xf0404780,0xf040479c,0xf0404ad8,
+0xf0404ad8,0xf0404914,0xf040496c,0xf040498c,0xf04049a8,0xf04049c8,0xf04049e4,0xf0404a04,
+0xf0404a20,0xf0404a40,0xf0404ad8,0xf0404a5c,0xf0404a7c,0xf0404a98,0xf0404584,0xf0404ab4,
+0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf0404ad8,0xf0404ad8,
+0xf0404950,0xf04044d8,0xf0404ad8,0xf04046d0,0xf0404614,0xf0404670,0xf0404690,0xf0404ad8,
+0xf0404ad8,0xf0404ad8,0xf04048b4,0xf0404898,0xf040453c,0xf04045cc,0xf0404758,0xf0404908,
+0xf0404934,0xf04046f0,0xf0404844,0xf0404860,0x4e2f4100,0x0,0x0,0x0,
+0x5f626c6f,0x636b2578,0x0,0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f66206d,
+0x656d6f72,0x79207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f662074,
+0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,
+0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,
+0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,
+0x696e6720,0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,
+0x72756e6e,0x696e6720,0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,
+0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,
+0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f662074,0x79706520,0x7461626c,
+0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f662074,0x79706520,
+0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,0x6f662074,
+0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,0x6f757420,
+0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,0x696e6720,
+0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0x64627820,0x72756e6e,
+0x696e6720,0x6f757420,0x6f662074,0x79706520,0x7461626c,0x65207370,0x61636500,0xf040902c,
+0xf040902c,0xf0409044,0xf0409044,0xf040902c,0xf040902c,0xf0409044,0xf0409044,0xf0409044,
+0xf0409044,0xf0409044,0xf0409044,0xf0409044,0xf040902c,0x0,0x0,0x0,
+0x44542830,0x78257829,0x206e6f74,0x2068616e,0x646c6564,0xa000000,0x2e696e69,0x7420756e,
+0x646f6e65,0xa000000,0x2e66696e,0x6920756e,0x646f6e65,0xa000000,0x2e64796e,0x616d6963,
+0x0,0x6f626a5f,0x72657772,0x6974653a,0x77726974,0x655f7365,0x6374696f,0x6e3a7772,
+0x69746520,0x6661696c,0x65640000,0x73686e61,0x6d657374,0x72000000,0x6f626a5f,0x72657772,
+0x6974652e,0x63000000,0x2e64796e,0x616d6963,0x0,0x6f626a5f,0x72657772,0x6974653a,
+0x77726974,0x655f7365,0x6374696f,0x6e3a7772,0x69746520,0x6661696c,0x65640000,0x30000000,
+0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x30000000,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x30000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x30000000,0x6f626a5f,
+0x72657772,0x6974652e,0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7066,0x696c6568,0x64720000,
+0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7061,0x6f757468,
+0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x70746d70,0x5f6e6577,0x73636e68,
+0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7061,
+0x6f757468,0x64722d3e,0x74657874,0x5f737461,0x72740000,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7061,0x6f757468,0x64722d3e,0x64617461,0x5f737461,
+0x72740000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7065,
+0x6c666864,0x72000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6e65776f,0x626a2d3e,
+0x6f5f7070,0x726f6768,0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6e65776f,
+0x626a2d3e,0x6f5f7073,0x65637468,0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7068,0x64727200,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7066,0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7070,0x64720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7073,0x796d7200,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7065,0x78747200,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6e65776f,0x626a2d3e,0x6f5f7073,0x73657874,0x0,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7073,0x73000000,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x6e65776f,0x626a2d3e,0x6f5f7061,0x75787500,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x6e65776f,0x626a2d3e,0x6f5f706c,0x696e6500,0x6f626a5f,0x72657772,0x6974652e,
+0x63000000,0x30000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x6f626a5f,0x6765745f,
+0x64796e61,0x6d69635f,0x696e666f,0x20666169,0x6c656400,0x30000000,0x6f626a5f,0x72657772,
+0x6974652e,0x63000000,0x30000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x216f626a,
+0x5f736861,0x72656428,0x6f626a29,0x207c7c20,0x28286f62,0x6a5f7465,0x78745f73,0x697a6528,
+0x6f626a29,0x202b2069,0x6e637229,0x203c3d20,0x4d415854,0x535a2900,0x6f626a5f,0x72657772,
+0x6974652e,0x63000000,0x70746d70,0x5f616f68,0x64722d3e,0x74657874,0x5f737461,0x72740000,
+0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x70746d70,0x5f706864,0x725b695d,0x2e705f70,
+0x61646472,0x0,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x30000000,0x6f626a5f,
+0x72657772,0x6974652e,0x63000000,0x216f626a,0x5f736861,0x72656428,0x6f626a29,0x7c7c2828,
+0x6f626a5f,0x64617461,0x5f73697a,0x65286f62,0x6a292b6f,0x626a5f62,0x73735f73,0x697a6528,
+0x6f626a29,0x2b696e63,0x7229203c,0x3d204d41,0x5844535a,0x29000000,0x6f626a5f,0x72657772,
+0x6974652e,0x63000000,0x2e627373,0x0,0x2e736273,0x73000000,0x30000000,0x6f626a5f,
+0x72657772,0x6974652e,0x63000000,0x30000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x42616420,0x636f6e74,0x656e7473,0x20666f72,0x2072656c,0x6f636174,0x696f6e20,0x61742030,
+0x7825780a,0x0,0x6f626a5f,0x6d61705f,0x64796e61,0x6d69633a,0x20446f6e,0x2774206b,
+0x6e6f7720,0x77686174,0x20746f20,0x646f2077,0x69746820,0x456c6620,0x72656c6f,0x63617469,
+0x6f6e2074,0x79706520,0x25640a00,0x30000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x6f626a2d,0x3e6f5f70,0x73736578,0x74000000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,
+0x70746d70,0x5f706578,0x74720000,0x6f626a5f,0x72657772,0x6974652e,0x63000000,0x656e6400,
+0xf040a6a4,0xf040a75c,0xf040a778,0xf040a874,0xf040a794,0xf040a874,0xf040a874,0xf040a874,
+0xf040a874,0xf040a740,0xf040a820,0xf040a858,0xf040a858,0xf040a858,0xf040a858,0xf040a804,
+0xf040a7cc,0xf040a6dc,0xf040a6c0,0xf040a874,0xf040a858,0xf040a83c,0xf040a874,0xf040a858,
+0xf040a874,0xf040a874,0xf040a874,0xf040a874,0xf040a858,0xf040a858,0xf040a858,0xf040a7e8,
+0xf040a874,0xf040a6f8,0xf040a71c,0xf040a874,0xf040a874,0xf040a858,0xf040a874,0xf040a7b0,
+0xf040a874,0x0,0x0,0x0,0x25733a20,0x4572726f,0x723a2000,0xa000000,
+0x2e746578,0x74000000,0x2e646174,0x61000000,0x2e627373,0x0,0x2e726f64,0x61746100,
+0x2e736461,0x74610000,0x2e736273,0x73000000,0x2e6c6974,0x38000000,0x2e6c6974,0x34000000,
+0x2e696e69,0x74000000,0x66696e64,0x5f736563,0x74696f6e,0x5f62796e,0x616d653a,0x4f4d5f45,
+0x58454355,0x5445206e,0x6f742073,0x7570706f,0x72746564,0xa000000,0x0,0x0,
+0x5761726e,0x696e673a,0x20000000,0x0,0x46617461,0x6c3a2000,0x0,0x0,
+0xf040ed5c,0xf040edcc,0xf040ee1c,0xf040ee74,0xf040eed4,0x0,0x0,0x0,
+0x5f626c6f,0x636b2578,0x0,0x6f626a5f,0x6c6f6f6b,0x75703a20,0x64627820,0x72756e6e,
+0x696e6720,0x6f757420,0x6f66206d,0x656d6f72,0x79207370,0x61636500,0x0,0x0,
+0xf0410e58,0xf0410e58,0xf0410e58,0xf0410e58,0xf0410ec8,0xf0410ea4,0xf0410f70,0xf0410f70,
+0xf0410e80,0xf0411338,0xf0411400,0xf0411400,0xf04110e8,0xf0411400,0xf0411400,0x0,
+0x496e7465,0x726e616c,0x3a200000,0x0,0x25733a20,0x496e7465,0x726e616c,0x3a200000,
+0xa000000,0x25733a20,0x4572726f,0x723a2000,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662031,0x20627974,
+0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662025,0x6c642062,
+0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,0x5f6d645f,0x73745f6d,
+0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,0x6c642062,
+0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,0x0,
+0x4572726f,0x723a2000,0x0,0x0,0x73745f63,0x75696e69,0x743a2063,0x616e6e6f,
+0x7420616c,0x6c6f6361,0x74652063,0x75727265,0x6e742063,0x6864720a,0x0,0x73745f65,
+0x78746164,0x643a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,0x6578745f,0x69657874,
+0x3a20696e,0x64657820,0x6f757420,0x6f662072,0x616e6765,0x20282564,0x290a0000,0x73745f69,
+0x646e5f69,0x6e646578,0x5f666578,0x743a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,
+0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,
+0x646e5f69,0x646e3a20,0x69646e20,0x28256429,0x206c6573,0x73207468,0x616e2030,0x206f7220,
+0x67726561,0x74657220,0x7468616e,0x206d6178,0x20282564,0x290a0000,0x0,0x0,
+0x73745f70,0x6366645f,0x6966643a,0x20696664,0x20282564,0x29206f75,0x74206f66,0x2072616e,
+0x67650a00,0x73745f70,0x73796d5f,0x6966645f,0x6973796d,0x3a206966,0x64202825,0x6429206f,
+0x72206973,0x796d2028,0x25642920,0x6f757420,0x6f662072,0x616e6765,0xa000000,0x73745f70,
+0x6175785f,0x69617578,0x3a206961,0x75782028,0x25642920,0x6f757420,0x6f662072,0x616e6765,
+0xa000000,0x0,0x0,0x0,0x73745f66,0x64616464,0x3a206e75,0x6d626572,
+0x206f6620,0x66696c65,0x73202825,0x64292065,0x78636565,0x6473206d,0x61782028,0x2564290a,
+0x0,0x73745f66,0x64616464,0x3a20616c,0x6c6f6361,0x74696f6e,0x20626f74,0x63682028,
+0x25642066,0x64732061,0x6e642025,0x64206366,0x64732920,0x696e2025,0x730a0000,0x0,
+0x3c2f3444,0x65627567,0x2f3e0000,0x3a000000,0x3a000000,0x73745f66,0x64616464,0x3a20636f,
+0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,0x6e616d65,0x21212025,0x640a0000,
+0x73745f66,0x64616464,0x3a20636f,0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,
+0x6e616d65,0x21202564,0xa000000,0x43616e6e,0x6f742073,0x745f6664,0x6164643a,0x2063616e,
+0x6e6f7420,0x6d616c6c,0x6f632025,0x64206279,0x74657320,0x746f2068,0x6f6c6420,0x66696c65,
+0x206e616d,0x650a0000,0x2f000000,0x256c7500,0x2d310000,0x256c7500,0x73745f73,0x74726164,
+0x643a2061,0x7267756d,0x656e7420,0x6973206e,0x696c0a00,0x73745f70,0x6175785f,0x6966645f,
+0x69617578,0x3a206966,0x64202825,0x6429206f,0x72206961,0x75782028,0x25642920,0x6f757420,
+0x6f662072,0x616e6765,0xa000000,0x73745f70,0x6175785f,0x6966645f,0x69617578,0x3a206966,
+0x64202825,0x6429206f,0x7220696c,0x696e6520,0x28256429,0x206f7574,0x206f6620,0x72616e67,
+0x650a0000,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,
+0x74656d20,0x6f662031,0x20627974,0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,
+0x6f662025,0x6c642062,0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,
+0x6c642062,0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,
+0x25733a20,0x496e7465,0x726e616c,0x3a200000,0xa000000,0x0,0x0,0x0,
+0x73745f66,0x696c6562,0x6567696e,0x3a207472,0x69656420,0x746f2065,0x6e642074,0x6f6f206d,
+0x616e7920,0x66696c65,0x73202825,0x73290a00,0x73745f74,0x65787462,0x6c6f636b,0x3a20626c,
+0x6f636b20,0x70656e64,0x696e6720,0x73657420,0x696e2069,0x6c6c6567,0x616c2063,0x6173650a,
+0x0,0x73745f66,0x696c655f,0x69646e3a,0x20697374,0x61636b20,0x756e6465,0x72666c6f,
+0x77202825,0x73290a00,0x0,0x0,0x73745f65,0x78747374,0x72616464,0x3a20796f,
+0x75206469,0x646e2774,0x20696e69,0x7469616c,0x697a6520,0x77697468,0x20637569,0x6e697420,
+0x6f722072,0x65616473,0x740a0000,0x73745f65,0x78747374,0x72616464,0x3a206172,0x67756d65,
+0x6e742069,0x73206e69,0x6c0a0000,0x73745f69,0x646e5f64,0x6e3a2079,0x6f752064,0x69646e27,
+0x7420696e,0x69746961,0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,
+0x73740a00,0x73745f69,0x646e5f72,0x6e64783a,0x20796f75,0x20646964,0x6e277420,0x696e6974,
+0x69616c69,0x7a652077,0x69746820,0x6375696e,0x6974206f,0x72207265,0x61647374,0xa000000,
+0x73745f72,0x6e64785f,0x69646e3a,0x2069646e,0x20282564,0x29206772,0x65617465,0x72207468,
+0x616e206d,0x61782028,0x2564290a,0x0,0x73745f72,0x6e64785f,0x69646e3a,0x206f6c64,
+0x20696e74,0x65726661,0x63652063,0x616e2774,0x20707574,0x20726664,0x28256429,0x20696e74,
+0x6f20726e,0x64782c20,0x75736520,0x73745f70,0x646e5f69,0x646e2069,0x6e737465,0x61640a00,
+0x73745f73,0x65746964,0x6e3a2069,0x646e7372,0x63202825,0x6429206f,0x72206964,0x6e646573,
+0x74202825,0x6429206f,0x7574206f,0x66207261,0x6e67650a,0x0,0x73745f70,0x6578745f,
+0x646e3a20,0x72666420,0x6669656c,0x64202825,0x64292069,0x736e2774,0x20657175,0x616c2074,
+0x6f205354,0x5f455854,0x49464428,0x2564290a,0x0,0x73745f70,0x6578745f,0x646e3a20,
+0x696e6465,0x78206f75,0x74206f66,0x2072616e,0x67652028,0x2564290a,0x0,0x6c69626d,
+0x6c640000,0x6c69626d,0x6c643a20,0x496e7465,0x726e616c,0x3a206361,0x6e6e6f74,0x20616c6c,
+0x6f636174,0x6520746f,0x20696e69,0x7469616c,0x697a6520,0x636f6d70,0x6f6e656e,0x74206e61,
+0x6d652066,0x6f72206c,0x69626d6c,0x64206572,0x726f7273,0xa000000,0x0,0x0,
+0x74726965,0x6420746f,0x20726570,0x6c616365,0x20726e64,0x78206175,0x78202825,0x64292074,
+0x68617420,0x66697473,0x20696e74,0x6f206f6e,0x6520776f,0x72642028,0x25642c20,0x25642920,
+0x77697468,0x206f6e65,0x20746861,0x74206361,0x6e277420,0x2825642c,0x2564290a,0x0,
+0x1,0x1,0x8,0x8,0x10,0x10,0x40,0x40,
+0x2,0x2,0x8,0x8,0x38,0x38,0x18,0x18,
+0x10,0x10,0x40,0x40,0x4,0x4,0x8,0x8,
+0x18,0x18,0x4,0x4,0x8,0x8,0x0,0x0,
+0xc,0x0,0x7,0xd,0x2,0x0,0x0,0x8,
+0x0,0xc,0x0,0x0,0x213c6172,0x63683e0a,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x600a0000,0x0,0x0,0x0,0xf042344c,0xf04234bc,0xf04234ac,0xf042349c,
+0xf042348c,0xf042347c,0xf042346c,0xf042345c,0x1,0x1,0x4,0x4,
+0x8,0x8,0x34,0x34,0x2,0x2,0x4,0x4,
+0x20,0x20,0xc,0xc,0x8,0x8,0x28,0x28,
+0x4,0x4,0x0,0x0,0x10,0x10,0x4,0x4,
+0x0,0x0,0x0,0x0,0xc,0x0,0x7,0xd,
+0x2,0x0,0x0,0x8,0x0,0xc,0x0,0x0,
+0x40282329,0x24486561,0x6465723a,0x20495249,0x5820352e,0x333a3130,0x32313537,0x32303333,
+0x20627569,0x6c742031,0x312f3033,0x2f393420,0x61742070,0x69676865,0x6172743a,0x2f6a6f69,
+0x73742f35,0x2e334d52,0x2f726f6f,0x74202400,};
+static const uint32_t data[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x10004e40,0x0,
+0x0,0x0,0x0,0x0,0xfffffffe,0x0,0x0,0x0,
+0xfffffffe,0xfffffffe,0x0,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,
+0x69746820,0x73745f63,0x75696e69,0x74206f72,0x2073745f,0x72656164,0x73740a00,0x726f7574,
+0x696e653a,0x206e6f20,0x63757272,0x656e7420,0x726f7574,0x696e652c,0x20736565,0x20666461,
+0x6464206f,0x72207365,0x7466640a,0x0,0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,
+0x61646420,0x746f2074,0x68697320,0x656e7472,0x79206974,0x20776173,0x20726561,0x64696e20,
+0x66726f6d,0x20646973,0x6b0a0000,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,0x61646420,0x746f2074,0x68697320,0x656e7472,
+0x79206974,0x20776173,0x20726561,0x64696e20,0x66726f6d,0x20646973,0x6b0a0000,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x10002dbc,0x0,0x0,0x0,0x4225ac,0x4225ac,0x422304,0x426210,
+0x4225f0,0x426570,0x4228d0,0x426b58,0x423130,0x4275f8,0x423190,0x427690,
+0x423438,0x4279f0,0x424420,0x428dc8,0x4240f8,0x4289c8,0x424958,0x429460,
+0x425690,0x42a5c8,0x425710,0x42a690,0x4259b8,0x42a9f0,0x425ee8,0x42b080,
+0x425f68,0x42b148,0x4225ac,0x4225ac,0x422458,0x4263c0,0x422760,0x426864,
+0x422d00,0x4270a8,0x423160,0x427644,0x4232e4,0x427840,0x423a98,0x4281dc,
+0x4246bc,0x429114,0x42428c,0x428bc8,0x424ff4,0x429d14,0x4256d0,0x42a62c,
+0x425864,0x42a840,0x425c50,0x42ad38,0x425f28,0x42b0e4,0x4260bc,0x42b2f8,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x42eb14,0x42eb14,0x42ea94,0x42fa38,
+0x42eb58,0x42fb00,0x42ec18,0x42fc20,0x42efc0,0x430048,0x42f020,0x4300e0,
+0x42f0a0,0x4301a8,0x42f3c8,0x4305f8,0x42f308,0x4304d8,0x42f4d8,0x430778,
+0x42f7e0,0x430b60,0x0,0x0,0x42f860,0x430c28,0x42f9b8,0x430de8,
+0x0,0x0,0x42eb14,0x42eb14,0x42ead4,0x42fa9c,0x42ebb8,0x42fb90,
+0x42edec,0x42fe34,0x42eff0,0x430094,0x42f060,0x430144,0x42f1d4,0x430340,
+0x42f450,0x4306b8,0x42f368,0x430568,0x42f65c,0x43096c,0x42f820,0x430bc4,
+0x0,0x0,0x42f90c,0x430d08,0x42f9f8,0x430e4c,0x0,0x0,
+};
+static uint32_t f_elfCheckShoff(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_get_elf_class(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_process(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_forward(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_408864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_process_coff(uint8_t *mem, uint32_t sp);
+static void f_swap_filehdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_aouthdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_scnhdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_aux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_reloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_dynamic(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_rel_dyn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_reginfo(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_dynsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_conflict(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_liblist(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_ehdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_swap_phdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_swap_shdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp);
+static uint32_t func_40cfb4(uint8_t *mem, uint32_t sp);
+static void f_change_fortran_names(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_init(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_40e8cc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_40e9bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_40eaa8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_40eb94(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_obj_read_from_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_40f27c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_get_dynamic_info(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_elfhash(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_shared(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_newstr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_split(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_get_dynsym_hash_value(uint8_t *mem, uint32_t sp);
+static void f_dumpobj_struct(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_search_symbol_using_hash(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_obj_find_symbol_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f__create_rt_proc_table(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_obj_otype(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_pfilehdr(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_paouthdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_pscnhdr(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_phdrr(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_pextr(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_base_address(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_base_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_map_address(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_map_diff(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_hash_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynstr(uint8_t *mem, uint32_t sp);
+static void f_obj_set_dynstr_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynsym(uint8_t *mem, uint32_t sp);
+static void f_obj_set_dynsym_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_msym_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_got(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_got_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynrel(uint8_t *mem, uint32_t sp);
+static void f_obj_set_dynrel_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_liblist(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_liblist_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_conflict_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_locgotcount(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_locgotcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_unrefextno(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_unrefextno(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_gotsym(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_gotsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_timestamp(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_timestamp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_ichecksum(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_ichecksum(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_iversion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynflags(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_dynflags(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynrelsz(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_dynrelsz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynrelent(uint8_t *mem, uint32_t sp);
+static void f_obj_set_dynrelent(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynsymcount(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_dynsymcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_dynsyment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynstrsz(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_dynstrsz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_liblistcount(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_liblistcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_conflictcount(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_conflictcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_extgot(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_rpath(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_rpath(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_soname(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_soname(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_rldversion(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_rldversion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_text_start(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_text_size(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_text_size(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_data_start(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_bss_start(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_data_size(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_bss_size(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_bss_size(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_name(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_path(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_init_address(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_init_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_pixie_init_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_fini_address(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_fini_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_entry_address(uint8_t *mem, uint32_t sp);
+static void f_obj_set_rldflag(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_cxx_flags(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynstrtab(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_dynstring(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynsym_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_sym_shndx(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynsym_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_msym_exists(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_dynsym_hash_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_nbucket(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_hash_bucket(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_hash_chain(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_dynsym_got(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_dynsym_got(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_obj_set_msym_ms_hash_value(uint8_t *mem, uint32_t sp);
+static uint32_t f_obj_pelfhdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_pproghdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_psecthdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_obj_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_obj_shstrndx(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_obj_section_index_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_section_vaddr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_section_size(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_obj_section_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_rld_map(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_rld_map(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_hdr_symptr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_obj_set_delta_class(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_class_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_instance(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_instance_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_reloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_reloc_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_sym_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_classsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_delta_classsym_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_symlib(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_set_rld_text_resolve_addr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_procedure_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_procedure_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_address_to_procedure(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_symbol_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_type_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_procedure_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_file_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_file_lang(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_file_symbol_count(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_file_type_base(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_file_string_base(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_foreach_rfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_file_name(uint8_t *mem, uint32_t sp);
+static uint64_t f_symbol_class(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_symbol_type(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_symbol_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_symbol_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_file_symbol_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_symbol_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_file_symbol_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_file_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_procedure_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_file_procedure_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4149dc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_symbol_to_outer_scope_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_symbol_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_user_type_alloc(uint8_t *mem, uint32_t sp);
+static uint32_t f_find_user_symbol(uint8_t *mem, uint32_t sp);
+static uint32_t func_415648(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_obj_update_dynamic(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t func_4159c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_obj_vtofo(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_obj_vtop(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t func_41710c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4172b4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_foreach_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t func_419310(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_address_to_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_section_type(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_find_section_byname(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_find_section_bytype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_419ab0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_objList_add(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_list_last(uint8_t *mem, uint32_t sp);
+static uint32_t func_41a2a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_41a40c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_scope_name_search(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t func_41a8c0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_file_scope_name_search(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_case_strcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_case_streq(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_41b3ac(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_search_externals(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_41b7e8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_aux_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_file_aux_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_41b948(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t func_41ba08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_41be28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_next_tq(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_type_deref(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_panic(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_error(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp);
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_fdadd(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_str_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_feinit(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_auxisymadd(uint8_t *mem, uint32_t sp);
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp);
+static uint32_t f__elf64_fsize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__elf64_msize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f__elf64_mtype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_elf_version(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_421fbc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f__elf64_xlatetom(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_422304(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_422458(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_4225ac(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4225f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_422760(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4228d0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_422d00(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_423130(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_423160(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_423190(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4232e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_423438(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_423a98(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4240f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42428c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_424420(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4246bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_424958(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_424ff4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4256d0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425710(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4259b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425c50(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425ee8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425f28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_425f68(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4260bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_426210(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4263c0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_426570(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_426864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_426b58(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4270a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4275f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_427644(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_427690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_427840(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4279f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4281dc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4289c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_428bc8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_428dc8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_429114(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_429460(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_429d14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42a5c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42a62c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42a690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42a840(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42a9f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42ad38(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42b080(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42b0e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42b148(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42b2f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_elf_begin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_42b860(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_42bae0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_elf32_getehdr(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f__elf_end(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__elf_vm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__elf_inmap(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f__elf_unmap(uint8_t *mem, uint32_t sp);
+static uint32_t func_42c580(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_42c65c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42c6d4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__elf_armem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f__elf_arinit(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f__elf_cook(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__elf_cookscn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42d6a4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42d84c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42d9f4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42dc44(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42df14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42e154(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42e41c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f__elf32_fsize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__elf32_msize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f__elf32_mtype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_42e74c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f__elf32_xlatetom(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42ea94(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42ead4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t func_42eb14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42eb58(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42ebb8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42ec18(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42edec(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42efc0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42eff0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f020(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f060(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f0a0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f1d4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f308(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f368(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f3c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f450(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f4d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f65c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f7e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f820(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f860(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f90c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f9b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42f9f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fa38(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fa9c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fb00(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fb90(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fc20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_42fe34(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430048(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430094(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4300e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430144(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4301a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4304d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430568(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4305f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_4306b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430778(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_43096c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430b60(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430bc4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430c28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430d08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430de8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t func_430e4c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+uint64_t trampoline(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t fp_dest) {
+switch (fp_dest) {
+case 0x40e8cc: return (uint64_t)func_40e8cc(mem, sp, a0, a1, a2) << 32;
+case 0x40e9bc: return func_40e9bc(mem, sp, a0, a1, a2);
+case 0x40eaa8: return func_40eaa8(mem, sp, a0, a1, a2);
+case 0x40eb94: return (uint64_t)func_40eb94(mem, sp, a0, a1, a2) << 32;
+case 0x4149dc: return func_4149dc(mem, sp, a0, a1, a2, a3);
+case 0x4159c8: return func_4159c8(mem, sp, a0, a1, a2);
+case 0x41710c: return func_41710c(mem, sp, a0, a1, a2);
+case 0x4172b4: return func_4172b4(mem, sp, a0, a1);
+case 0x419310: return func_419310(mem, sp, a0, a1, a2);
+case 0x419864: return (uint64_t)f_find_section_byname(mem, sp, a0, a1, a2) << 32;
+case 0x4199fc: return f_find_section_bytype(mem, sp, a0, a1, a2);
+case 0x419ab0: return func_419ab0(mem, sp, a0, a1, a2, a3);
+case 0x41ac5c: return f_file_scope_name_search(mem, sp, a0, a1, a2, a3);
+case 0x422304: return func_422304(mem, sp, a0, a1, a2);
+case 0x422458: return func_422458(mem, sp, a0, a1, a2);
+case 0x4225ac: return (uint64_t)func_4225ac(mem, sp, a0, a1, a2) << 32;
+case 0x4225f0: return func_4225f0(mem, sp, a0, a1, a2);
+case 0x422760: return func_422760(mem, sp, a0, a1, a2);
+case 0x4228d0: return func_4228d0(mem, sp, a0, a1, a2);
+case 0x422d00: return func_422d00(mem, sp, a0, a1, a2);
+case 0x423130: return func_423130(mem, sp, a0, a1, a2);
+case 0x423160: return func_423160(mem, sp, a0, a1, a2);
+case 0x423190: return func_423190(mem, sp, a0, a1, a2);
+case 0x4232e4: return func_4232e4(mem, sp, a0, a1, a2);
+case 0x423438: return func_423438(mem, sp, a0, a1, a2);
+case 0x423a98: return func_423a98(mem, sp, a0, a1, a2);
+case 0x4240f8: return func_4240f8(mem, sp, a0, a1, a2);
+case 0x42428c: return func_42428c(mem, sp, a0, a1, a2);
+case 0x424420: return func_424420(mem, sp, a0, a1, a2);
+case 0x4246bc: return func_4246bc(mem, sp, a0, a1, a2);
+case 0x424958: return func_424958(mem, sp, a0, a1, a2);
+case 0x424ff4: return func_424ff4(mem, sp, a0, a1, a2);
+case 0x425690: return func_425690(mem, sp, a0, a1, a2);
+case 0x4256d0: return func_4256d0(mem, sp, a0, a1, a2);
+case 0x425710: return func_425710(mem, sp, a0, a1, a2);
+case 0x425864: return func_425864(mem, sp, a0, a1, a2);
+case 0x4259b8: return func_4259b8(mem, sp, a0, a1, a2);
+case 0x425c50: return func_425c50(mem, sp, a0, a1, a2);
+case 0x425ee8: return func_425ee8(mem, sp, a0, a1, a2);
+case 0x425f28: return func_425f28(mem, sp, a0, a1, a2);
+case 0x425f68: return func_425f68(mem, sp, a0, a1, a2);
+case 0x4260bc: return func_4260bc(mem, sp, a0, a1, a2);
+case 0x426210: return func_426210(mem, sp, a0, a1, a2);
+case 0x4263c0: return func_4263c0(mem, sp, a0, a1, a2);
+case 0x426570: return func_426570(mem, sp, a0, a1, a2);
+case 0x426864: return func_426864(mem, sp, a0, a1, a2);
+case 0x426b58: return func_426b58(mem, sp, a0, a1, a2);
+case 0x4270a8: return func_4270a8(mem, sp, a0, a1, a2);
+case 0x4275f8: return func_4275f8(mem, sp, a0, a1, a2);
+case 0x427644: return func_427644(mem, sp, a0, a1, a2);
+case 0x427690: return func_427690(mem, sp, a0, a1, a2);
+case 0x427840: return func_427840(mem, sp, a0, a1, a2);
+case 0x4279f0: return func_4279f0(mem, sp, a0, a1, a2);
+case 0x4281dc: return func_4281dc(mem, sp, a0, a1, a2);
+case 0x4289c8: return func_4289c8(mem, sp, a0, a1, a2);
+case 0x428bc8: return func_428bc8(mem, sp, a0, a1, a2);
+case 0x428dc8: return func_428dc8(mem, sp, a0, a1, a2);
+case 0x429114: return func_429114(mem, sp, a0, a1, a2);
+case 0x429460: return func_429460(mem, sp, a0, a1, a2);
+case 0x429d14: return func_429d14(mem, sp, a0, a1, a2);
+case 0x42a5c8: return func_42a5c8(mem, sp, a0, a1, a2);
+case 0x42a62c: return func_42a62c(mem, sp, a0, a1, a2);
+case 0x42a690: return func_42a690(mem, sp, a0, a1, a2);
+case 0x42a840: return func_42a840(mem, sp, a0, a1, a2);
+case 0x42a9f0: return func_42a9f0(mem, sp, a0, a1, a2);
+case 0x42ad38: return func_42ad38(mem, sp, a0, a1, a2);
+case 0x42b080: return func_42b080(mem, sp, a0, a1, a2);
+case 0x42b0e4: return func_42b0e4(mem, sp, a0, a1, a2);
+case 0x42b148: return func_42b148(mem, sp, a0, a1, a2);
+case 0x42b2f8: return func_42b2f8(mem, sp, a0, a1, a2);
+case 0x42ea94: return func_42ea94(mem, sp, a0, a1, a2);
+case 0x42ead4: return func_42ead4(mem, sp, a0, a1, a2);
+case 0x42eb14: return (uint64_t)func_42eb14(mem, sp, a0, a1, a2) << 32;
+case 0x42eb58: return func_42eb58(mem, sp, a0, a1, a2);
+case 0x42ebb8: return func_42ebb8(mem, sp, a0, a1, a2);
+case 0x42ec18: return func_42ec18(mem, sp, a0, a1, a2);
+case 0x42edec: return func_42edec(mem, sp, a0, a1, a2);
+case 0x42efc0: return func_42efc0(mem, sp, a0, a1, a2);
+case 0x42eff0: return func_42eff0(mem, sp, a0, a1, a2);
+case 0x42f020: return func_42f020(mem, sp, a0, a1, a2);
+case 0x42f060: return func_42f060(mem, sp, a0, a1, a2);
+case 0x42f0a0: return func_42f0a0(mem, sp, a0, a1, a2);
+case 0x42f1d4: return func_42f1d4(mem, sp, a0, a1, a2);
+case 0x42f308: return func_42f308(mem, sp, a0, a1, a2);
+case 0x42f368: return func_42f368(mem, sp, a0, a1, a2);
+case 0x42f3c8: return func_42f3c8(mem, sp, a0, a1, a2);
+case 0x42f450: return func_42f450(mem, sp, a0, a1, a2);
+case 0x42f4d8: return func_42f4d8(mem, sp, a0, a1, a2);
+case 0x42f65c: return func_42f65c(mem, sp, a0, a1, a2);
+case 0x42f7e0: return func_42f7e0(mem, sp, a0, a1, a2);
+case 0x42f820: return func_42f820(mem, sp, a0, a1, a2);
+case 0x42f860: return func_42f860(mem, sp, a0, a1, a2);
+case 0x42f90c: return func_42f90c(mem, sp, a0, a1, a2);
+case 0x42f9b8: return func_42f9b8(mem, sp, a0, a1, a2);
+case 0x42f9f8: return func_42f9f8(mem, sp, a0, a1, a2);
+case 0x42fa38: return func_42fa38(mem, sp, a0, a1, a2);
+case 0x42fa9c: return func_42fa9c(mem, sp, a0, a1, a2);
+case 0x42fb00: return func_42fb00(mem, sp, a0, a1, a2);
+case 0x42fb90: return func_42fb90(mem, sp, a0, a1, a2);
+case 0x42fc20: return func_42fc20(mem, sp, a0, a1, a2);
+case 0x42fe34: return func_42fe34(mem, sp, a0, a1, a2);
+case 0x430048: return func_430048(mem, sp, a0, a1, a2);
+case 0x430094: return func_430094(mem, sp, a0, a1, a2);
+case 0x4300e0: return func_4300e0(mem, sp, a0, a1, a2);
+case 0x430144: return func_430144(mem, sp, a0, a1, a2);
+case 0x4301a8: return func_4301a8(mem, sp, a0, a1, a2);
+case 0x430340: return func_430340(mem, sp, a0, a1, a2);
+case 0x4304d8: return func_4304d8(mem, sp, a0, a1, a2);
+case 0x430568: return func_430568(mem, sp, a0, a1, a2);
+case 0x4305f8: return func_4305f8(mem, sp, a0, a1, a2);
+case 0x4306b8: return func_4306b8(mem, sp, a0, a1, a2);
+case 0x430778: return func_430778(mem, sp, a0, a1, a2);
+case 0x43096c: return func_43096c(mem, sp, a0, a1, a2);
+case 0x430b60: return func_430b60(mem, sp, a0, a1, a2);
+case 0x430bc4: return func_430bc4(mem, sp, a0, a1, a2);
+case 0x430c28: return func_430c28(mem, sp, a0, a1, a2);
+case 0x430d08: return func_430d08(mem, sp, a0, a1, a2);
+case 0x430de8: return func_430de8(mem, sp, a0, a1, a2);
+case 0x430e4c: return func_430e4c(mem, sp, a0, a1, a2);
+default: abort();}
+}
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10010000);
+memcpy(mem + 0x100005a0, rodata, 0x2b50);
+memcpy(mem + 0x10000000, data, 0x5a0);
+MEM_S32(0x10004de0) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x10004de4) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0, argc, arg_addr);
+return ret;
+}
+
+static uint32_t f_elfCheckShoff(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+t8 = 0;
+L407bd0:
+//elfCheckShoff:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff38;
+//nop;
+// fdead 4000016b MEM_U32(sp + 36) = ra;
+// fdead 4000016b MEM_U32(sp + 24) = s0;
+t6 = 0x1;
+// fdead 4000816b MEM_U32(sp + 32) = gp;
+// fdead 4000816b MEM_U32(sp + 28) = s1;
+s0 = zero;
+MEM_U32(sp + 188) = t6;
+a1 = zero;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+at = 0xffffffff;
+s1 = v0;
+if (v0 == at) goto L407ca4;
+//nop;
+a0 = v0;
+a1 = sp + 0x2c;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+at = 0xffffffff;
+//nop;
+if (v0 == at) goto L407ca4;
+//nop;
+a0 = 0x1;
+//nop;
+f_elf_version(mem, sp, a0);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+a0 = s1;
+//nop;
+a1 = 0x1;
+a2 = zero;
+v0 = f_elf_begin(mem, sp, a0, a1, a2);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+s0 = v0;
+if (v0 == 0) goto L407ca4;
+//nop;
+a0 = v0;
+//nop;
+v0 = f_elf32_getehdr(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == 0) goto L407ca4;
+t7 = MEM_U32(v0 + 32);
+t8 = MEM_U32(sp + 92);
+//nop;
+//nop;
+if (t7 < t8) goto L407ca4;
+MEM_U32(sp + 188) = zero;
+L407ca4:
+at = 0xffffffff;
+if (s0 == 0) goto L407cc8;
+//nop;
+a0 = s0;
+//nop;
+f__elf_end(mem, sp, a0);
+// bdead 40040001 gp = MEM_U32(sp + 32);
+//nop;
+at = 0xffffffff;
+L407cc8:
+// bdead 40040001 ra = MEM_U32(sp + 36);
+if (s1 == at) goto L407cec;
+//nop;
+a0 = s1;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+// bdead 40000001 ra = MEM_U32(sp + 36);
+L407cec:
+v0 = MEM_U32(sp + 188);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0xc8;
+return v0;
+}
+
+static uint32_t f_get_elf_class(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, t0 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L407d00:
+//get_elf_class:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+a1 = zero;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+a0 = v0;
+if (v0 != at) goto L407d3c;
+v0 = 0xffffffff;
+goto L407e18;
+L407d3c:
+//nop;
+a1 = zero;
+a2 = zero;
+MEM_U32(sp + 36) = a0;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+a1 = sp + 0x2c;
+if (v0 != at) goto L407d68;
+v0 = 0xffffffff;
+goto L407e18;
+L407d68:
+//nop;
+a0 = MEM_U32(sp + 36);
+a2 = 0x34;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+t6 = MEM_U8(sp + 44);
+if (v0 != at) goto L407d94;
+v0 = 0xffffffff;
+goto L407e18;
+// fdead 0 t6 = MEM_U8(sp + 44);
+L407d94:
+at = 0x7f;
+v1 = zero;
+if (t6 != at) goto L407de8;
+t7 = MEM_U8(sp + 45);
+at = 0x45;
+//nop;
+if (t7 != at) goto L407de8;
+t8 = MEM_U8(sp + 46);
+at = 0x4c;
+//nop;
+if (t8 != at) goto L407de8;
+t9 = MEM_U8(sp + 47);
+at = 0x46;
+//nop;
+if (t9 != at) goto L407de8;
+t0 = MEM_U8(sp + 48);
+at = 0x2;
+//nop;
+if (t0 != at) goto L407de8;
+v1 = 0x2;
+goto L407de8;
+L407de8:
+//nop;
+a0 = MEM_U32(sp + 36);
+MEM_U32(sp + 40) = v1;
+v0 = wrapper_close(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 40);
+at = 0xffffffff;
+if (v0 != at) {
+v0 = v1;
+goto L407e18;}
+v0 = v1;
+v0 = 0xffffffff;
+goto L407e18;
+// fdead 0 v0 = v1;
+L407e18:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x60;
+//nop;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L407e30:
+//main:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 40000063 MEM_U32(sp + 64) = fp;
+// fdead 40000063 MEM_U32(sp + 68) = ra;
+// fdead 40000063 MEM_U32(sp + 60) = gp;
+// fdead 40000063 MEM_U32(sp + 56) = s7;
+// fdead 40000063 MEM_U32(sp + 52) = s6;
+// fdead 40000063 MEM_U32(sp + 48) = s5;
+// fdead 40000063 MEM_U32(sp + 44) = s4;
+// fdead 40000063 MEM_U32(sp + 40) = s3;
+// fdead 40000063 MEM_U32(sp + 36) = s2;
+// fdead 40000063 MEM_U32(sp + 32) = s1;
+// fdead 40000063 MEM_U32(sp + 28) = s0;
+fp = 0x10004dfc;
+t6 = MEM_U32(a1 + 0);
+at = 0x10004dec;
+MEM_U32(fp + 0) = t6;
+s1 = a1 + 0x4;
+MEM_U32(at + 0) = zero;
+v0 = MEM_U32(s1 + 0);
+s0 = 0x1;
+s2 = a0 + 0xffffffff;
+if (v0 == 0) goto L408098;
+t7 = MEM_U8(v0 + 0);
+at = 0x2d;
+//nop;
+if (t7 != at) goto L408098;
+s4 = 0xfb528e4;
+s7 = 0x10000008;
+s6 = 0x10000000;
+s5 = 0x10000004;
+s3 = 0x10004df4;
+s4 = s4 + 0x20;
+t8 = v0 + s0;
+L407ec0:
+a3 = MEM_U8(t8 + 0);
+//nop;
+a0 = a3;
+if (a3 == 0) goto L407f00;
+t9 = a0 + 0xffffffad;
+//nop;
+if (t9 >= 0x26) goto L408040;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L407fb8;
+case 1: goto L408040;
+case 2: goto L408040;
+case 3: goto L407fd4;
+case 4: goto L408040;
+case 5: goto L408040;
+case 6: goto L408040;
+case 7: goto L408040;
+case 8: goto L408040;
+case 9: goto L408040;
+case 10: goto L408040;
+case 11: goto L408040;
+case 12: goto L408040;
+case 13: goto L408040;
+case 14: goto L408040;
+case 15: goto L407f1c;
+case 16: goto L408040;
+case 17: goto L408040;
+case 18: goto L408040;
+case 19: goto L408024;
+case 20: goto L408040;
+case 21: goto L408040;
+case 22: goto L408040;
+case 23: goto L408040;
+case 24: goto L408040;
+case 25: goto L407f24;
+case 26: goto L408040;
+case 27: goto L408040;
+case 28: goto L407f40;
+case 29: goto L408040;
+case 30: goto L408040;
+case 31: goto L407f94;
+case 32: goto L408040;
+case 33: goto L408040;
+case 34: goto L408040;
+case 35: goto L408040;
+case 36: goto L408040;
+case 37: goto L407f9c;
+}
+L407f00:
+//nop;
+if (a0 != 0) goto L408040;
+v0 = MEM_U32(s1 + 4);
+s0 = 0x1;
+s1 = s1 + 0x4;
+s2 = s2 + 0xffffffff;
+goto L408080;
+L407f1c:
+s0 = s0 + 0x1;
+goto L408080;
+L407f24:
+t0 = MEM_U32(s6 + 0);
+s0 = s0 + 0x1;
+t1 = t0 + 0x1;
+MEM_U32(s6 + 0) = t1;
+v0 = MEM_U32(s1 + 0);
+//nop;
+goto L408080;
+L407f40:
+t2 = 0x10004dec;
+at = 0x10004dec;
+t2 = MEM_U32(t2 + 0);
+s2 = s2 + 0xffffffff;
+t3 = t2 + 0x1;
+MEM_U32(at + 0) = t3;
+if ((int)s2 > 0) goto L407f78;
+a1 = 0x100005a0;
+//nop;
+a0 = s4;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1fe0183 gp = MEM_U32(sp + 60);
+//nop;
+L407f78:
+t4 = MEM_U32(s1 + 4);
+at = 0x10004df0;
+s1 = s1 + 0x8;
+MEM_U32(at + 0) = t4;
+v0 = MEM_U32(s1 + 0);
+s2 = s2 + 0xffffffff;
+goto L408080;
+L407f94:
+s0 = s0 + 0x1;
+goto L408080;
+L407f9c:
+t5 = MEM_U32(s5 + 0);
+s0 = s0 + 0x1;
+t6 = t5 + 0x1;
+MEM_U32(s5 + 0) = t6;
+v0 = MEM_U32(s1 + 0);
+//nop;
+goto L408080;
+L407fb8:
+t7 = MEM_U32(s3 + 0);
+s0 = s0 + 0x1;
+t8 = t7 + 0x1;
+MEM_U32(s3 + 0) = t8;
+v0 = MEM_U32(s1 + 0);
+//nop;
+goto L408080;
+L407fd4:
+t9 = MEM_U32(s3 + 0);
+a0 = s4;
+a3 = 0x3;
+if (t9 == 0) goto L407ff4;
+at = 0x10000014;
+t0 = 0x1;
+MEM_U32(at + 0) = t0;
+goto L408018;
+L407ff4:
+a1 = 0x100005b8;
+//nop;
+a2 = MEM_U32(fp + 0);
+t1 = 0x13;
+MEM_U32(sp + 16) = t1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1fe0183 gp = MEM_U32(sp + 60);
+//nop;
+L408018:
+v0 = MEM_U32(s1 + 0);
+s0 = s0 + 0x1;
+goto L408080;
+L408024:
+t2 = MEM_U32(s7 + 0);
+s0 = s0 + 0x1;
+t3 = t2 + 0x1;
+MEM_U32(s7 + 0) = t3;
+v0 = MEM_U32(s1 + 0);
+//nop;
+goto L408080;
+L408040:
+t4 = MEM_U32(s3 + 0);
+t5 = 0x1;
+a0 = s4;
+if (t4 == 0) goto L40805c;
+at = 0x10000014;
+MEM_U32(at + 0) = t5;
+goto L408078;
+L40805c:
+a1 = 0x100005d8;
+//nop;
+a2 = MEM_U32(fp + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1fe0183 gp = MEM_U32(sp + 60);
+//nop;
+L408078:
+v0 = MEM_U32(s1 + 0);
+s0 = s0 + 0x1;
+L408080:
+//nop;
+if (v0 == 0) goto L408098;
+t6 = MEM_U8(v0 + 0);
+at = 0x2d;
+t8 = v0 + s0;
+if (t6 == at) goto L407ec0;
+L408098:
+s4 = 0xfb528e4;
+s3 = 0x10004df4;
+s4 = s4 + 0x20;
+if ((int)s2 > 0) goto L4080f8;
+t7 = MEM_U32(s3 + 0);
+t8 = 0x1;
+a0 = s4;
+if (t7 == 0) goto L4080c4;
+at = 0x10000014;
+MEM_U32(at + 0) = t8;
+goto L4080e0;
+L4080c4:
+a1 = 0x10000600;
+//nop;
+a2 = MEM_U32(fp + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 401c0003 gp = MEM_U32(sp + 60);
+//nop;
+L4080e0:
+//nop;
+a0 = 0x1;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 401c0083 gp = MEM_U32(sp + 60);
+//nop;
+L4080f8:
+// bdead 401c0083 a0 = s2;
+if (s2 == 0) {
+s2 = s2 + 0xffffffff;
+goto L408138;}
+s2 = s2 + 0xffffffff;
+s0 = 0x10004df8;
+//nop;
+L40810c:
+a0 = MEM_U32(s1 + 0);
+s1 = s1 + 0x4;
+MEM_U32(s0 + 0) = a0;
+//nop;
+//nop;
+//nop;
+f_process(mem, sp, a0);
+// bdead 401e0083 a0 = s2;
+// bdead 401e0083 gp = MEM_U32(sp + 60);
+if (s2 != 0) {
+s2 = s2 + 0xffffffff;
+goto L40810c;}
+s2 = s2 + 0xffffffff;
+L408138:
+t0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if (t0 == 0) goto L408194;
+t1 = 0x10000010;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L408194;
+t2 = 0x10000014;
+at = 0x1;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 != at) goto L408194;
+//nop;
+a0 = 0xfffffffe;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 60);
+// bdead 3 ra = MEM_U32(sp + 68);
+goto L4081f4;
+L408194:
+t3 = 0x10004dec;
+v0 = 0x10000010;
+t3 = MEM_U32(t3 + 0);
+v0 = MEM_U32(v0 + 0);
+at = 0x1;
+if (t3 == 0) goto L4081d8;
+a0 = zero;
+if (v0 != at) goto L4081bc;
+a0 = 0xffffffff;
+goto L4081bc;
+L4081bc:
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 60);
+// bdead 3 ra = MEM_U32(sp + 68);
+goto L4081f4;
+L4081d8:
+//nop;
+a0 = (int)zero < (int)v0;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 60);
+//nop;
+// bdead 3 ra = MEM_U32(sp + 68);
+L4081f4:
+// bdead 3 s0 = MEM_U32(sp + 28);
+// bdead 3 s1 = MEM_U32(sp + 32);
+// bdead 3 s2 = MEM_U32(sp + 36);
+// bdead 3 s3 = MEM_U32(sp + 40);
+// bdead 3 s4 = MEM_U32(sp + 44);
+// bdead 3 s5 = MEM_U32(sp + 48);
+// bdead 3 s6 = MEM_U32(sp + 52);
+// bdead 3 s7 = MEM_U32(sp + 56);
+// bdead 3 fp = MEM_U32(sp + 64);
+// bdead 3 sp = sp + 0x48;
+v0 = zero;
+return v0;
+}
+
+static void f_process(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408224:
+//process:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000016b MEM_U32(sp + 28) = ra;
+// fdead 4000016b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+v0 = f_elfCheckShoff(mem, sp, a0);
+// bdead 4000008b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L40828c;
+a0 = 0xfb528e4;
+a1 = 0x10000620;
+a2 = 0x10000638;
+//nop;
+a3 = MEM_U32(sp + 32);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = a2;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+t6 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t6;
+goto L4086c8;
+L40828c:
+//nop;
+a0 = MEM_U32(sp + 32);
+//nop;
+v0 = f_get_elf_class(mem, sp, a0);
+// bdead 4000008b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+if (v0 != at) {
+at = 0x2;
+goto L4082e8;}
+at = 0x2;
+a0 = 0xfb528e4;
+a1 = 0x10000640;
+a2 = 0x10000660;
+//nop;
+a3 = MEM_U32(sp + 32);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = a2;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+t7 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t7;
+goto L4086c8;
+at = 0x2;
+L4082e8:
+//nop;
+if (v0 != at) goto L408328;
+a0 = 0xfb528e4;
+a1 = 0x10000668;
+a2 = 0x10000694;
+//nop;
+a3 = MEM_U32(sp + 32);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = a2;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+t8 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t8;
+goto L4086c8;
+L408328:
+t9 = 0x10004dec;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L408364;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = zero;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10004e00;
+MEM_U32(at + 0) = v0;
+goto L408388;
+L408364:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = 0x2;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10004e00;
+//nop;
+MEM_U32(at + 0) = v0;
+L408388:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if ((int)a0 >= 0) goto L4083c4;
+//nop;
+a0 = MEM_U32(sp + 32);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+t0 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t0;
+goto L4086c8;
+L4083c4:
+//nop;
+a1 = 0x10004e20;
+a2 = 0x14;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+at = 0x14;
+a0 = 0x10004e04;
+MEM_U32(a0 + 0) = v0;
+if (v0 == at) goto L408478;
+//nop;
+if ((int)v0 >= 0) goto L40840c;
+//nop;
+a0 = MEM_U32(sp + 32);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L408450;
+L40840c:
+t1 = 0x10004df4;
+a2 = MEM_U32(sp + 32);
+t1 = MEM_U32(t1 + 0);
+t2 = 0x1;
+//nop;
+if (t1 == 0) goto L408430;
+at = 0x10000014;
+MEM_U32(at + 0) = t2;
+goto L408450;
+L408430:
+a0 = 0xfb528e4;
+a1 = 0x1000069c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L408450:
+a0 = 0x10004e00;
+at = 0x10000010;
+//nop;
+t3 = 0x1;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(at + 0) = t3;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L4086cc;
+L408478:
+v0 = 0x10004e20;
+//nop;
+v0 = MEM_U16(v0 + 0);
+//nop;
+if (v0 < 0x181) {
+at = 0x182;
+goto L4084d4;}
+at = 0x182;
+if (v0 == at) {
+at = 0x4001;
+goto L40854c;}
+at = 0x4001;
+if (v0 == at) {
+at = 0x4201;
+goto L408518;}
+at = 0x4201;
+if (v0 == at) {
+at = 0x6001;
+goto L408518;}
+at = 0x6001;
+if (v0 == at) {
+at = 0x6201;
+goto L408518;}
+at = 0x6201;
+if (v0 == at) {
+at = 0x6301;
+goto L408518;}
+at = 0x6301;
+if (v0 == at) {
+at = 0x6601;
+goto L408518;}
+at = 0x6601;
+//nop;
+if (v0 == at) goto L408518;
+//nop;
+goto L4085f0;
+L4084d4:
+at = 0x140;
+if (v0 == at) {
+at = 0x142;
+goto L40854c;}
+at = 0x142;
+if (v0 == at) {
+at = 0x160;
+goto L40854c;}
+at = 0x160;
+if (v0 == at) {
+at = 0x162;
+goto L40854c;}
+at = 0x162;
+if (v0 == at) {
+at = 0x163;
+goto L40854c;}
+at = 0x163;
+if (v0 == at) {
+at = 0x166;
+goto L40854c;}
+at = 0x166;
+if (v0 == at) {
+at = 0x180;
+goto L40854c;}
+at = 0x180;
+//nop;
+if (v0 == at) goto L40854c;
+//nop;
+goto L4085f0;
+L408518:
+at = 0x1000000c;
+//nop;
+t4 = 0x1;
+MEM_U32(at + 0) = t4;
+v0 = f_gethostsex(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = v0;
+//nop;
+a0 = 0x10004e20;
+//nop;
+f_swap_filehdr(mem, sp, a0, a1);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+L40854c:
+v0 = 0x10004e20;
+at = 0x2000;
+v0 = MEM_U16(v0 + 18);
+//nop;
+t5 = v0 & 0xf000;
+t6 = t5 ^ 0x3000;
+if (t5 != at) goto L408694;
+t6 = t6 < 0x1;
+t7 = ~t6;
+//nop;
+if (t7 == 0) goto L408694;
+t8 = 0x10000008;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L408694;
+t9 = 0x10004df4;
+t0 = 0x1;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L4085b4;
+at = 0x10000014;
+MEM_U32(at + 0) = t0;
+goto L408694;
+L4085b4:
+a0 = 0xfb528e4;
+a1 = 0x100006d8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0xffffffff;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L408694;
+L4085f0:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a1 = zero;
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x2;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a3 = v0;
+a0 = 0x10000018;
+a1 = 0x10004e00;
+a2 = 0x10004e0c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a2 = MEM_U32(a2 + 0);
+//nop;
+v0 = f_obj_read_from_fd(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+a0 = v0;
+// fdead 6000007f t9 = t9;
+//nop;
+func_408864(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L4086cc;
+L408694:
+//nop;
+//nop;
+//nop;
+f_process_coff(mem, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L4086c8:
+// bdead 1 ra = MEM_U32(sp + 28);
+L4086cc:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_forward(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0;
+L4086d8:
+//forward:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffefa8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+s1 = a2;
+s3 = a1;
+// fdead 401401eb MEM_U32(sp + 52) = ra;
+// fdead 401401eb MEM_U32(sp + 44) = s5;
+// fdead 401401eb MEM_U32(sp + 40) = s4;
+s5 = a0;
+// fdead 405401eb MEM_U32(sp + 48) = gp;
+// fdead 405401eb MEM_U32(sp + 32) = s2;
+// fdead 405401eb MEM_U32(sp + 24) = s0;
+s4 = zero;
+a1 = a3;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40740003 gp = MEM_U32(sp + 48);
+a0 = s3;
+//nop;
+a1 = zero;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 4200);
+// bdead 4074010b gp = MEM_U32(sp + 48);
+s0 = a3 - v0;
+if ((int)v0 >= (int)a3) goto L4087a0;
+//nop;
+if ((int)s0 <= 0) goto L4087a0;
+s2 = 0x10004ff0;
+//nop;
+at = (int)s0 < (int)0x1000;
+L408768:
+a2 = 0x1000;
+if (at == 0) goto L408778;
+a2 = s0;
+goto L408778;
+L408778:
+//nop;
+a0 = s3;
+a1 = s2;
+v0 = wrapper_write(mem, a0, a1, a2);
+s0 = s0 + 0xfffff000;
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+at = (int)s0 < (int)0x1000;
+if ((int)s0 > 0) goto L408768;
+a3 = MEM_U32(sp + 4200);
+//nop;
+L4087a0:
+//nop;
+a0 = s3;
+a1 = a3;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40740001 gp = MEM_U32(sp + 48);
+s2 = sp + 0x58;
+if ((int)s1 <= 0) goto L40883c;
+L4087c0:
+a0 = s5;
+if ((int)s1 < (int)0x1001) goto L4087d4;
+s0 = 0x1000;
+goto L4087d8;
+L4087d4:
+s0 = s1;
+L4087d8:
+//nop;
+a1 = s2;
+a2 = s0;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 407c0009 gp = MEM_U32(sp + 48);
+s0 = v0;
+if ((int)v0 >= 0) goto L4087fc;
+v0 = s0;
+goto L408840;
+L4087fc:
+a0 = s3;
+if (v0 != 0) goto L40880c;
+v0 = s4;
+goto L408840;
+L40880c:
+//nop;
+a1 = s2;
+a2 = s0;
+v0 = wrapper_write(mem, a0, a1, a2);
+// bdead 407e0009 gp = MEM_U32(sp + 48);
+v1 = v0;
+if (v0 == s0) goto L408830;
+v0 = v1;
+goto L408840;
+L408830:
+s1 = s1 - v0;
+s4 = s4 + v0;
+if ((int)s1 > 0) goto L4087c0;
+L40883c:
+v0 = s4;
+L408840:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x1058;
+return v0;
+}
+
+static void func_408864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0;
+L408864:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffdda8;
+// fdead 4000006b MEM_U32(sp + 52) = s5;
+s5 = a0;
+a0 = 0x10000704;
+//nop;
+// fdead 4040006b MEM_U32(sp + 68) = ra;
+// fdead 4040006b MEM_U32(sp + 40) = s2;
+// fdead 4040006b MEM_U32(sp + 64) = gp;
+// fdead 4040006b MEM_U32(sp + 60) = s7;
+// fdead 4040006b MEM_U32(sp + 56) = s6;
+// fdead 4040006b MEM_U32(sp + 48) = s4;
+// fdead 4040006b MEM_U32(sp + 44) = s3;
+// fdead 4040006b MEM_U32(sp + 36) = s1;
+// fdead 4040006b MEM_U32(sp + 32) = s0;
+MEM_U32(sp + 8796) = a1;
+MEM_U32(sp + 8772) = zero;
+MEM_U32(sp + 156) = zero;
+MEM_U32(sp + 152) = zero;
+MEM_U32(sp + 148) = zero;
+MEM_U32(sp + 144) = zero;
+s2 = zero;
+MEM_U32(sp + 136) = zero;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4048010b gp = MEM_U32(sp + 64);
+MEM_U32(sp + 176) = v0;
+if (v0 == 0) goto L4088f8;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4048010b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 != 0) goto L408908;
+L4088f8:
+t6 = 0x1000070c;
+//nop;
+t6 = t6;
+MEM_U32(sp + 176) = t6;
+L408908:
+//nop;
+if (s5 == 0) goto L408920;
+t7 = MEM_U32(s5 + 140);
+at = 0x3;
+//nop;
+if (t7 == at) goto L408970;
+L408920:
+t8 = 0x10004df4;
+a2 = MEM_U32(sp + 8796);
+t8 = MEM_U32(t8 + 0);
+t9 = 0x1;
+//nop;
+if (t8 == 0) goto L408944;
+at = 0x10000014;
+MEM_U32(at + 0) = t9;
+goto L409a48;
+L408944:
+a0 = 0xfb528e4;
+a1 = 0x10000718;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t0 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t0;
+goto L409a48;
+L408970:
+//nop;
+a0 = s5;
+//nop;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+// bdead 4048000b gp = MEM_U32(sp + 64);
+s7 = v0;
+//nop;
+a0 = s5;
+//nop;
+v0 = f_obj_pproghdr(mem, sp, a0);
+// bdead 4148000b gp = MEM_U32(sp + 64);
+MEM_U32(sp + 8784) = v0;
+//nop;
+a0 = s5;
+//nop;
+v0 = f_obj_psecthdr(mem, sp, a0);
+MEM_U32(sp + 8780) = v0;
+v1 = MEM_U32(s7 + 36);
+// bdead 41480193 gp = MEM_U32(sp + 64);
+t1 = v1 & 0x2;
+t2 = v1 & 0x4;
+if (t1 == 0) goto L408a48;
+t3 = ~t2;
+s3 = sp + 0xa0;
+if (t3 == 0) goto L408a4c;
+t4 = 0x10000008;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+s3 = sp + 0xa0;
+if (t4 != 0) goto L408a4c;
+t5 = 0x10004df4;
+t6 = 0x1;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L408a10;
+at = 0x10000014;
+MEM_U32(at + 0) = t6;
+goto L408a48;
+L408a10:
+a0 = 0xfb528e4;
+a1 = 0x10000744;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41480003 gp = MEM_U32(sp + 64);
+a0 = 0xffffffff;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41480003 gp = MEM_U32(sp + 64);
+//nop;
+L408a48:
+s3 = sp + 0xa0;
+L408a4c:
+v0 = sp + 0xb0;
+L408a50:
+t7 = MEM_U16(s7 + 48);
+s3 = s3 + 0x4;
+MEM_U32(s3 + -4) = t7;
+if (s3 < v0) goto L408a50;
+//nop;
+a0 = MEM_U16(s7 + 48);
+a1 = 0x28;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 4148018b gp = MEM_U32(sp + 64);
+MEM_U32(sp + 8776) = v0;
+if (v0 != 0) goto L408aa0;
+a0 = 0xfb528e4;
+a1 = 0x10000770;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41480103 gp = MEM_U32(sp + 64);
+//nop;
+L408aa0:
+t8 = MEM_U16(s7 + 48);
+t0 = MEM_U32(sp + 136);
+s4 = zero;
+if (t8 == 0) goto L408e38;
+t9 = MEM_U32(sp + 8784);
+t1 = t0 << 5;
+s3 = 0x70000000;
+s0 = MEM_U32(sp + 8780);
+s6 = 0x10004e00;
+s3 = s3 | 0x1;
+s1 = t9 + t1;
+L408acc:
+t2 = MEM_U32(s1 + 4);
+t3 = MEM_U32(s0 + 16);
+t4 = MEM_U32(sp + 136);
+t5 = t4 + 0x1;
+if (t2 != t3) goto L408ae8;
+MEM_U32(sp + 136) = t5;
+s1 = s1 + 0x20;
+L408ae8:
+v0 = 0x10000004;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 != 0) goto L408b48;
+//nop;
+a0 = s5;
+a1 = s4;
+v0 = f_obj_section_index_name(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 64);
+a0 = v0;
+a1 = 0x10000784;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 41fe010b gp = MEM_U32(sp + 64);
+t6 = MEM_U32(sp + 156);
+if (v0 == 0) goto L408bfc;
+v0 = 0x10000004;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+L408b48:
+//nop;
+if (v0 != 0) goto L408b88;
+//nop;
+a0 = s5;
+a1 = s4;
+v0 = f_obj_section_index_name(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 64);
+a0 = v0;
+a1 = 0x1000078c;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 41fe010b gp = MEM_U32(sp + 64);
+t6 = MEM_U32(sp + 156);
+if (v0 == 0) goto L408bfc;
+L408b88:
+//nop;
+a0 = s5;
+a1 = s4;
+v0 = f_obj_section_index_name(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 64);
+a0 = v0;
+a1 = 0x10000794;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 41fe010b gp = MEM_U32(sp + 64);
+t6 = MEM_U32(sp + 156);
+if (v0 == 0) goto L408bfc;
+//nop;
+a0 = s5;
+a1 = s4;
+v0 = f_obj_section_index_name(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 64);
+a0 = v0;
+a1 = 0x1000079c;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 41fe010b gp = MEM_U32(sp + 64);
+t2 = MEM_U32(sp + 152);
+if (v0 != 0) goto L408c24;
+t6 = MEM_U32(sp + 156);
+L408bfc:
+t8 = sp + 0xa0;
+t7 = t6 << 2;
+t0 = t7 + t8;
+MEM_U32(t0 + 0) = s4;
+t9 = t6 + 0x1;
+MEM_U32(sp + 156) = t9;
+v1 = MEM_U16(s7 + 48);
+s4 = s4 + 0x1;
+goto L408e2c;
+// fdead 0 t2 = MEM_U32(sp + 152);
+L408c24:
+t1 = MEM_U32(sp + 8776);
+t3 = t2 << 2;
+t4 = MEM_U16(s7 + 48);
+t5 = MEM_U32(sp + 160);
+t3 = t3 + t2;
+t3 = t3 << 3;
+a2 = t1 + t3;
+if (t4 != t5) goto L408c50;
+s2 = MEM_U32(s0 + 16);
+t0 = MEM_U32(s0 + 4);
+goto L408c6c;
+L408c50:
+v0 = MEM_U32(s0 + 32);
+//nop;
+v0 = v0 + 0xffffffff;
+t7 = ~v0;
+t8 = s2 + v0;
+s2 = t7 & t8;
+t0 = MEM_U32(s0 + 4);
+L408c6c:
+MEM_U32(a2 + 4) = t0;
+if (s4 == 0) goto L408d0c;
+a0 = MEM_U32(s1 + 4);
+t6 = MEM_U32(s0 + 16);
+//nop;
+t1 = MEM_U32(sp + 152);
+if (a0 >= t6) goto L408d10;
+t9 = MEM_U32(s0 + -24);
+t2 = MEM_U32(sp + 136);
+t1 = MEM_U32(sp + 152);
+if (t9 >= a0) goto L408d10;
+t1 = MEM_U16(s7 + 44);
+//nop;
+if (t2 >= t1) {
+t1 = MEM_U32(sp + 152);
+goto L408d10;}
+t1 = MEM_U32(sp + 152);
+t3 = MEM_U32(s1 + 0);
+//nop;
+t1 = MEM_U32(sp + 152);
+if (s3 != t3) goto L408d10;
+MEM_U32(sp + 8772) = a0;
+v1 = MEM_U32(s1 + 28);
+t8 = MEM_U32(s1 + 16);
+v1 = v1 + 0xffffffff;
+t4 = ~v1;
+t5 = s2 + v1;
+t7 = t4 & t5;
+MEM_U32(s1 + 4) = t7;
+v0 = MEM_U32(s0 + 32);
+t9 = MEM_U32(sp + 136);
+v0 = v0 + 0xffffffff;
+s2 = s2 + t8;
+t6 = s2 + v0;
+t0 = ~v0;
+t2 = t9 + 0x1;
+s2 = t0 & t6;
+MEM_U32(sp + 136) = t2;
+s1 = s1 + 0x20;
+L408d0c:
+t1 = MEM_U32(sp + 152);
+L408d10:
+//nop;
+//nop;
+if (t1 != s4) goto L408d28;
+t3 = MEM_U32(s0 + 16);
+MEM_U32(a2 + 16) = t3;
+goto L408d2c;
+L408d28:
+MEM_U32(a2 + 16) = s2;
+L408d2c:
+t4 = MEM_U32(s0 + 20);
+a0 = s5;
+MEM_U32(a2 + 20) = t4;
+t5 = MEM_U32(s0 + 0);
+a1 = s4;
+MEM_U32(a2 + 0) = t5;
+t7 = MEM_U32(s0 + 8);
+//nop;
+MEM_U32(a2 + 8) = t7;
+t8 = MEM_U32(s0 + 12);
+//nop;
+MEM_U32(a2 + 12) = t8;
+t0 = MEM_U32(s0 + 24);
+//nop;
+MEM_U32(a2 + 24) = t0;
+t6 = MEM_U32(s0 + 28);
+//nop;
+MEM_U32(a2 + 28) = t6;
+t9 = MEM_U32(s0 + 32);
+//nop;
+MEM_U32(a2 + 32) = t9;
+t2 = MEM_U32(s0 + 36);
+//nop;
+MEM_U32(a2 + 36) = t2;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_section_index_name(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 64);
+a0 = v0;
+a1 = 0x100007ac;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 41fe010b gp = MEM_U32(sp + 64);
+t3 = 0x1;
+if (v0 != 0) goto L408dd0;
+t1 = MEM_U32(sp + 152);
+MEM_U32(sp + 144) = t3;
+MEM_U32(sp + 148) = t1;
+L408dd0:
+v1 = MEM_U16(s7 + 48);
+t4 = s4 + 0x1;
+a1 = zero;
+if (t4 != v1) goto L408e08;
+//nop;
+a0 = MEM_U32(s6 + 0);
+a2 = 0x2;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+t7 = MEM_U32(s0 + 16);
+// bdead 41ff010b gp = MEM_U32(sp + 64);
+t5 = s2 + v0;
+v1 = MEM_U16(s7 + 48);
+s2 = t5 - t7;
+goto L408e18;
+L408e08:
+t8 = MEM_U32(s0 + 56);
+t6 = MEM_U32(s0 + 16);
+t0 = s2 + t8;
+s2 = t0 - t6;
+L408e18:
+t9 = MEM_U32(sp + 152);
+//nop;
+t2 = t9 + 0x1;
+MEM_U32(sp + 152) = t2;
+s4 = s4 + 0x1;
+L408e2c:
+s0 = s0 + 0x28;
+if (s4 < v1) goto L408acc;
+L408e38:
+t1 = s2 + 0xf;
+at = 0xfffffff0;
+t3 = t1 & at;
+MEM_U32(s7 + 32) = t3;
+t4 = MEM_U32(sp + 144);
+s3 = 0x70000000;
+s6 = 0x10004e00;
+s3 = s3 | 0x1;
+if (t4 == 0) goto L408e68;
+t5 = MEM_U32(sp + 148);
+MEM_U16(s7 + 50) = (uint16_t)t5;
+goto L408e74;
+L408e68:
+t7 = MEM_U16(s7 + 50);
+//nop;
+MEM_U16(s7 + 50) = (uint16_t)t7;
+L408e74:
+t8 = MEM_U16(s7 + 48);
+t0 = MEM_U32(sp + 160);
+a1 = zero;
+//nop;
+if (t8 != t0) goto L408ee8;
+t6 = 0x10000000;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+// bdead 40000101 ra = MEM_U32(sp + 68);
+if (t6 != 0) goto L409a4c;
+t9 = 0x10004df4;
+a2 = MEM_U32(sp + 8796);
+t9 = MEM_U32(t9 + 0);
+t2 = 0x1;
+//nop;
+if (t9 == 0) goto L408ec4;
+at = 0x10000014;
+MEM_U32(at + 0) = t2;
+goto L409a48;
+L408ec4:
+a0 = 0xfb528e4;
+a1 = 0x100007b8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L408ee8:
+//nop;
+a0 = MEM_U32(s6 + 0);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4190000b gp = MEM_U32(sp + 64);
+//nop;
+if ((int)v0 >= 0) goto L408f28;
+//nop;
+a0 = MEM_U32(sp + 8796);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+t1 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t1;
+goto L409a48;
+L408f28:
+//nop;
+a0 = MEM_U32(s6 + 0);
+a1 = sp + 0x21b8;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4190010b gp = MEM_U32(sp + 64);
+//nop;
+if ((int)v0 >= 0) goto L408f74;
+a0 = 0xfb528e4;
+a1 = 0x100007dc;
+//nop;
+a2 = MEM_U32(sp + 8796);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t3 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t3;
+goto L409a48;
+L408f74:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_getpid();
+// bdead 4190000b gp = MEM_U32(sp + 64);
+a2 = MEM_U32(sp + 176);
+a1 = 0x100007fc;
+//nop;
+a0 = sp + 0x20b8;
+a3 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 41900003 gp = MEM_U32(sp + 64);
+a1 = 0x302;
+t4 = 0x10004dec;
+a0 = sp + 0x20b8;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L408fe0;
+//nop;
+a0 = sp + 0x20b8;
+a2 = 0x1a4;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4190000b gp = MEM_U32(sp + 64);
+s5 = v0;
+goto L408ff8;
+L408fe0:
+//nop;
+a2 = MEM_U32(sp + 8652);
+a1 = 0x102;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4190000b gp = MEM_U32(sp + 64);
+s5 = v0;
+L408ff8:
+//nop;
+if ((int)v0 >= 0) goto L409024;
+//nop;
+a0 = sp + 0x20b8;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+t5 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t5;
+goto L409a48;
+L409024:
+//nop;
+a1 = MEM_U32(sp + 8660);
+a2 = MEM_U32(sp + 8664);
+a0 = s5;
+v0 = wrapper_fchown(mem, a0, a1, a2);
+t8 = MEM_U32(sp + 160);
+s0 = 0x28;
+lo = t8 * s0;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)s0 >> 32);
+// bdead 441d20003 gp = MEM_U32(sp + 64);
+t7 = MEM_U32(sp + 8780);
+//nop;
+a0 = MEM_U32(s6 + 0);
+a1 = s5;
+a3 = zero;
+t0 = lo;
+t6 = t7 + t0;
+a2 = MEM_U32(t6 + 16);
+MEM_U32(sp + 16) = zero;
+v0 = f_forward(mem, sp, a0, a1, a2, a3);
+t2 = MEM_U32(sp + 160);
+t9 = MEM_U32(sp + 8780);
+lo = t2 * s0;
+hi = (uint32_t)((uint64_t)t2 * (uint64_t)s0 >> 32);
+// bdead 445d0018b gp = MEM_U32(sp + 64);
+t1 = lo;
+t3 = t9 + t1;
+t4 = MEM_U32(t3 + 16);
+//nop;
+//nop;
+if (v0 == t4) goto L4090e4;
+a0 = 0xfb528e4;
+a1 = 0x1000080c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 64);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x1000083c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t5 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t5;
+goto L409a48;
+L4090e4:
+t8 = MEM_U16(s7 + 44);
+s0 = MEM_U32(sp + 8784);
+s2 = zero;
+if (t8 == 0) goto L4091a0;
+a3 = MEM_U32(sp + 8772);
+//nop;
+L4090fc:
+t7 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s3 != t7) goto L409188;
+a1 = s5;
+if (a3 == 0) goto L409188;
+t0 = MEM_U32(s0 + 4);
+//nop;
+a0 = MEM_U32(s6 + 0);
+a2 = MEM_U32(s0 + 16);
+MEM_U32(sp + 16) = t0;
+v0 = f_forward(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s0 + 16);
+// bdead 41da818b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 == t6) goto L409188;
+a0 = 0xfb528e4;
+a1 = 0x10000868;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 64);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10000890;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t2 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t2;
+goto L409a48;
+L409188:
+t9 = MEM_U16(s7 + 44);
+s2 = s2 + 0x1;
+a3 = MEM_U32(sp + 8772);
+s0 = s0 + 0x20;
+if (s2 < t9) goto L4090fc;
+L4091a0:
+v1 = MEM_U16(s7 + 48);
+s4 = zero;
+s3 = sp + 0xa0;
+L4091ac:
+v0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+if (v1 == v0) goto L4092ac;
+a0 = MEM_U32(s3 + 4);
+a1 = v0 + 0x1;
+if ((int)a1 >= (int)a0) {
+at = (int)a1 < (int)a0;
+goto L4092ac;}
+s2 = a1;
+if ((int)a1 >= (int)a0) goto L4092ac;
+t5 = a1 << 2;
+t7 = s4 << 2;
+t4 = MEM_U32(sp + 8776);
+t7 = t7 + s4;
+t5 = t5 + a1;
+t3 = a1 << 2;
+t1 = MEM_U32(sp + 8780);
+t3 = t3 + a1;
+t5 = t5 << 3;
+t7 = t7 << 3;
+t0 = -t7;
+t3 = t3 << 3;
+t8 = t4 + t5;
+s1 = t8 + t0;
+s0 = t1 + t3;
+L409214:
+t6 = MEM_U32(s1 + -24);
+//nop;
+a0 = MEM_U32(s6 + 0);
+a2 = MEM_U32(s0 + 20);
+a3 = MEM_U32(s0 + 16);
+a1 = s5;
+MEM_U32(sp + 16) = t6;
+v0 = f_forward(mem, sp, a0, a1, a2, a3);
+t2 = MEM_U32(s0 + 20);
+// bdead 41fe098b gp = MEM_U32(sp + 64);
+s2 = s2 + 0x1;
+if (v0 == t2) goto L409290;
+a0 = 0xfb528e4;
+a1 = 0x100008bc;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 64);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100008e8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t9 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t9;
+goto L409a48;
+L409290:
+t1 = MEM_U32(s3 + 4);
+s0 = s0 + 0x28;
+s1 = s1 + 0x28;
+if ((int)s2 < (int)t1) goto L409214;
+v1 = MEM_U16(s7 + 48);
+//nop;
+L4092ac:
+s4 = s4 + 0x1;
+s3 = s3 + 0x4;
+if ((int)s4 < (int)0x3) goto L4091ac;
+v0 = MEM_U32(s3 + 0);
+//nop;
+t3 = v0 + 0x1;
+s2 = v0 + 0x1;
+if (v1 == t3) goto L4093a4;
+t5 = s2 << 2;
+if (s2 >= v1) goto L4093a4;
+t8 = s2 << 2;
+t6 = s4 << 2;
+t7 = MEM_U32(sp + 8776);
+t6 = t6 + s4;
+t8 = t8 + s2;
+t4 = MEM_U32(sp + 8780);
+t8 = t8 << 3;
+t6 = t6 << 3;
+t5 = t5 + s2;
+t5 = t5 << 3;
+t2 = -t6;
+t0 = t7 + t8;
+s1 = t0 + t2;
+s0 = t4 + t5;
+L409314:
+t9 = MEM_U32(s1 + -24);
+a2 = MEM_U32(s0 + 20);
+a3 = MEM_U32(s0 + 16);
+MEM_U32(sp + 16) = t9;
+//nop;
+a0 = MEM_U32(s6 + 0);
+a1 = s5;
+v0 = f_forward(mem, sp, a0, a1, a2, a3);
+t1 = MEM_U32(s0 + 20);
+// bdead 41ce058b gp = MEM_U32(sp + 64);
+s2 = s2 + 0x1;
+if (v0 == t1) goto L409390;
+a0 = 0xfb528e4;
+a1 = 0x10000914;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 64);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10000940;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 64);
+t3 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t3;
+goto L409a48;
+L409390:
+t4 = MEM_U16(s7 + 48);
+s0 = s0 + 0x28;
+s1 = s1 + 0x28;
+if (s2 < t4) goto L409314;
+L4093a4:
+t5 = MEM_U32(sp + 152);
+a0 = s5;
+MEM_U16(s7 + 48) = (uint16_t)t5;
+//nop;
+a1 = zero;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+a1 = MEM_U32(s7 + 32);
+// bdead 41c0004b gp = MEM_U32(sp + 64);
+s4 = a1 - v0;
+if (v0 >= a1) goto L409420;
+//nop;
+if ((int)s4 <= 0) goto L409420;
+s0 = 0x10004ff0;
+//nop;
+at = (int)s4 < (int)0x1000;
+L4093e8:
+a2 = 0x1000;
+if (at == 0) goto L4093f8;
+a2 = s4;
+goto L4093f8;
+L4093f8:
+//nop;
+a0 = s5;
+a1 = s0;
+v0 = wrapper_write(mem, a0, a1, a2);
+s4 = s4 + 0xfffff000;
+// bdead 41e20003 gp = MEM_U32(sp + 64);
+at = (int)s4 < (int)0x1000;
+if ((int)s4 > 0) goto L4093e8;
+a1 = MEM_U32(s7 + 32);
+//nop;
+L409420:
+//nop;
+a0 = s5;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+t7 = MEM_U16(s7 + 48);
+t8 = MEM_U16(s7 + 46);
+// bdead 43c10003 gp = MEM_U32(sp + 64);
+lo = t7 * t8;
+hi = (uint32_t)((uint64_t)t7 * (uint64_t)t8 >> 32);
+//nop;
+a1 = MEM_U32(sp + 8776);
+a0 = s5;
+a2 = lo;
+//nop;
+v0 = wrapper_write(mem, a0, a1, a2);
+t6 = MEM_U16(s7 + 48);
+t0 = MEM_U16(s7 + 46);
+// bdead 41c0820b gp = MEM_U32(sp + 64);
+lo = t6 * t0;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t0 >> 32);
+a0 = s5;
+t2 = lo;
+//nop;
+if (v0 == t2) goto L4094d0;
+//nop;
+a0 = s5;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t9 = 0x1;
+at = 0x10000010;
+a0 = s5;
+MEM_U32(at + 0) = t9;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L4094d0:
+//nop;
+a1 = MEM_U32(s7 + 28);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 41c0000b gp = MEM_U32(sp + 64);
+//nop;
+if ((int)v0 < 0) goto L409530;
+t1 = MEM_U16(s7 + 44);
+t3 = MEM_U16(s7 + 42);
+//nop;
+lo = t1 * t3;
+hi = (uint32_t)((uint64_t)t1 * (uint64_t)t3 >> 32);
+a1 = MEM_U32(sp + 8784);
+a0 = s5;
+a2 = lo;
+//nop;
+v0 = wrapper_write(mem, a0, a1, a2);
+t4 = MEM_U16(s7 + 44);
+t5 = MEM_U16(s7 + 42);
+// bdead 41c0600b gp = MEM_U32(sp + 64);
+lo = t4 * t5;
+hi = (uint32_t)((uint64_t)t4 * (uint64_t)t5 >> 32);
+a0 = s5;
+t7 = lo;
+//nop;
+if (v0 == t7) goto L409584;
+L409530:
+//nop;
+a0 = s5;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+a0 = s5;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+t8 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t8;
+goto L409a48;
+L409584:
+//nop;
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 41c0000b gp = MEM_U32(sp + 64);
+a0 = s5;
+if ((int)v0 < 0) goto L4095c0;
+//nop;
+a2 = MEM_U16(s7 + 40);
+a1 = s7;
+v0 = wrapper_write(mem, a0, a1, a2);
+t6 = MEM_U16(s7 + 40);
+// bdead 40c0800b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 == t6) goto L409614;
+L4095c0:
+a0 = 0x10004df0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t0 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t0;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L409614:
+t2 = 0x10004dec;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L4096b8;
+//nop;
+a0 = MEM_U32(s6 + 0);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40c00001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+a1 = 0x10004df0;
+//nop;
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_rename(mem, a0, a1);
+// bdead 40c00009 gp = MEM_U32(sp + 64);
+a2 = sp + 0x20b8;
+if ((int)v0 >= 0) goto L4096b0;
+a0 = 0xfb528e4;
+a1 = 0x1000096c;
+//nop;
+a3 = MEM_U32(sp + 8796);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t9 = 0x1;
+at = 0x10000010;
+a0 = s5;
+MEM_U32(at + 0) = t9;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L4096b0:
+MEM_U32(s6 + 0) = s5;
+goto L409a48;
+L4096b8:
+s1 = 0x10004dfc;
+a1 = MEM_U32(sp + 8796);
+a2 = MEM_U32(s1 + 0);
+s0 = a1;
+t1 = MEM_U8(a2 + 0);
+v0 = a2;
+v1 = t1 & 0xff;
+if (t1 == 0) goto L4096f8;
+a0 = 0x2f;
+L4096dc:
+//nop;
+if (a0 != v1) goto L4096e8;
+a2 = v0 + 0x1;
+L4096e8:
+v1 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L4096dc;
+L4096f8:
+t3 = MEM_U8(a1 + 0);
+a0 = 0x2f;
+v0 = a1;
+if (t3 == 0) goto L40972c;
+v1 = MEM_U8(v0 + 0);
+//nop;
+L409710:
+//nop;
+if (a0 != v1) goto L40971c;
+s0 = v0 + 0x1;
+L40971c:
+v1 = MEM_U8(v0 + 1);
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L409710;
+L40972c:
+//nop;
+a0 = a2;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40c6000b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 == 0) goto L409764;
+//nop;
+a0 = MEM_U32(s1 + 0);
+a1 = s0;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40c0000b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 != 0) goto L4097cc;
+L409764:
+//nop;
+a1 = MEM_U32(sp + 8796);
+a0 = sp + 0x20b8;
+v0 = wrapper_rename(mem, a0, a1);
+// bdead 40c0000b gp = MEM_U32(sp + 64);
+a2 = sp + 0x20b8;
+if ((int)v0 >= 0) goto L4097c4;
+a0 = 0xfb528e4;
+a1 = 0x10000994;
+//nop;
+a3 = MEM_U32(sp + 8796);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t4 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t4;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L4097c4:
+s1 = 0xffffffff;
+goto L40983c;
+L4097cc:
+//nop;
+a0 = MEM_U32(sp + 8796);
+a1 = zero;
+v0 = wrapper_truncate(mem, a0, a1);
+// bdead 40c0000b gp = MEM_U32(sp + 64);
+s1 = 0xffffffff;
+//nop;
+if (v0 != s1) goto L40983c;
+//nop;
+a0 = MEM_U32(sp + 8796);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t5 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t5;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L40983c:
+//nop;
+a0 = MEM_U32(s6 + 0);
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40c4000b gp = MEM_U32(sp + 64);
+a0 = s5;
+if (v0 != s1) goto L4098ac;
+//nop;
+a0 = MEM_U32(sp + 8796);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t7 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t7;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L4098ac:
+//nop;
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40c40009 gp = MEM_U32(sp + 64);
+s0 = sp + 0xb8;
+if (v0 != s1) goto L409918;
+//nop;
+a0 = sp + 0x20b8;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t8 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t8;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L409918:
+//nop;
+a0 = s5;
+a1 = s0;
+a2 = 0x1000;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 40c60009 gp = MEM_U32(sp + 64);
+a2 = v0;
+if ((int)v0 <= 0) goto L4099c0;
+L409938:
+//nop;
+a0 = MEM_U32(s6 + 0);
+a1 = s0;
+v0 = wrapper_write(mem, a0, a1, a2);
+// bdead 40c60009 gp = MEM_U32(sp + 64);
+a0 = s5;
+if (v0 != s1) goto L4099a4;
+//nop;
+a0 = MEM_U32(sp + 8796);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t6 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t6;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L4099a4:
+//nop;
+a1 = s0;
+a2 = 0x1000;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 40c60009 gp = MEM_U32(sp + 64);
+a2 = v0;
+if ((int)v0 > 0) goto L409938;
+L4099c0:
+//nop;
+if (v0 != s1) goto L409a18;
+//nop;
+a0 = sp + 0x20b8;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40400001 gp = MEM_U32(sp + 64);
+t0 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = s5;
+MEM_U32(at + 0) = t0;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 ra = MEM_U32(sp + 68);
+goto L409a4c;
+L409a18:
+//nop;
+a0 = s5;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = sp + 0x20b8;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+//nop;
+L409a48:
+// bdead 1 ra = MEM_U32(sp + 68);
+L409a4c:
+// bdead 1 s0 = MEM_U32(sp + 32);
+// bdead 1 s1 = MEM_U32(sp + 36);
+// bdead 1 s2 = MEM_U32(sp + 40);
+// bdead 1 s3 = MEM_U32(sp + 44);
+// bdead 1 s4 = MEM_U32(sp + 48);
+// bdead 1 s5 = MEM_U32(sp + 52);
+// bdead 1 s6 = MEM_U32(sp + 56);
+// bdead 1 s7 = MEM_U32(sp + 60);
+// bdead 1 sp = sp + 0x2258;
+return;
+}
+
+static void f_process_coff(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L409a74:
+//process_coff:
+//nop;
+//nop;
+//nop;
+a0 = 0x100009bc;
+//nop;
+sp = sp + 0xfffffb40;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 1208) = v0;
+if (v0 == 0) goto L409ac4;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L409ad4;
+L409ac4:
+t6 = 0x100009c4;
+//nop;
+t6 = t6;
+MEM_U32(sp + 1208) = t6;
+L409ad4:
+v0 = 0x10004e20;
+//nop;
+t7 = MEM_U32(v0 + 8);
+//nop;
+//nop;
+if (t7 == 0) goto L409afc;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if (t8 != 0) goto L409b4c;
+L409afc:
+t9 = 0x10004df4;
+t0 = 0x1;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L409b20;
+at = 0x10000014;
+MEM_U32(at + 0) = t0;
+goto L40a078;
+L409b20:
+a2 = 0x10004df8;
+a0 = 0xfb528e4;
+a1 = 0x100009d0;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40a07c;
+L409b4c:
+t1 = 0x10000000;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L409b7c;
+t2 = 0x10000004;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L409bc4;
+L409b7c:
+t3 = 0x10004df4;
+t4 = 0x1;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L409ba0;
+at = 0x10000014;
+MEM_U32(at + 0) = t4;
+goto L40a078;
+L409ba0:
+a0 = 0xfb528e4;
+a1 = 0x100009f4;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40a07c;
+L409bc4:
+t5 = MEM_U16(v0 + 18);
+//nop;
+t6 = t5 & 0x2;
+//nop;
+if (t6 != 0) goto L409c70;
+t7 = 0x10000008;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L409c70;
+a0 = 0x10000a3c;
+a1 = 0xfb528e4;
+//nop;
+a0 = a0;
+a1 = a1 + 0x20;
+v0 = wrapper_fputs(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0x10004df8;
+a1 = 0xfb528e4;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1 + 0x20;
+v0 = wrapper_fputs(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0x10000a4c;
+a1 = 0xfb528e4;
+//nop;
+a0 = a0;
+a1 = a1 + 0x20;
+v0 = wrapper_fputs(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+v0 = 0x10004e20;
+//nop;
+L409c70:
+t8 = 0x10004dec;
+a1 = zero;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L409cd4;
+a0 = 0x10004e00;
+//nop;
+a1 = MEM_U32(v0 + 8);
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_ftruncate(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L409f7c;
+a0 = 0x10004df8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+t9 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t9;
+goto L40a078;
+L409cd4:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L409d1c;
+a0 = 0x10004df8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+t0 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t0;
+goto L40a078;
+L409d1c:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = sp + 0x42c;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L409d70;
+a2 = 0x10004df8;
+a0 = 0xfb528e4;
+a1 = 0x10000a7c;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+t1 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t1;
+goto L40a078;
+L409d70:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_getpid();
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 1208);
+a1 = 0x10000a9c;
+//nop;
+a0 = sp + 0x2c;
+a3 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a0 = sp + 0x2c;
+t2 = 0x10004dec;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L409df8;
+a1 = 0x10004df0;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = sp + 0x2c;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a0 = sp + 0x2c;
+//nop;
+a1 = 0x301;
+a2 = 0x1a4;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 1204) = v0;
+goto L409e10;
+L409df8:
+//nop;
+a2 = MEM_U32(sp + 1088);
+a1 = 0x501;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 1204) = v0;
+L409e10:
+//nop;
+if ((int)v0 >= 0) goto L409e3c;
+//nop;
+a0 = sp + 0x2c;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+t3 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t3;
+goto L40a078;
+L409e3c:
+//nop;
+a0 = MEM_U32(sp + 1204);
+a1 = MEM_U32(sp + 1096);
+a2 = MEM_U32(sp + 1100);
+//nop;
+v0 = wrapper_fchown(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 1204);
+a0 = 0x10004e00;
+a2 = 0x10004e20;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = MEM_U32(a2 + 8);
+a3 = zero;
+MEM_U32(sp + 16) = zero;
+v0 = f_forward(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 32);
+//nop;
+t4 = 0x10004e20;
+//nop;
+t4 = MEM_U32(t4 + 8);
+//nop;
+//nop;
+if (v0 == t4) goto L409ed0;
+a2 = 0x10004df8;
+a0 = 0xfb528e4;
+a1 = 0x10000aac;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+t5 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t5;
+goto L40a078;
+L409ed0:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+t6 = 0x10004dec;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t8 = MEM_U32(sp + 1204);
+if (t6 != 0) goto L409f70;
+a1 = 0x10004df8;
+//nop;
+a1 = MEM_U32(a1 + 0);
+a0 = sp + 0x2c;
+v0 = wrapper_rename(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a2 = sp + 0x2c;
+if ((int)v0 >= 0) goto L409f6c;
+a3 = 0x10004df8;
+a0 = 0xfb528e4;
+a1 = 0x10000acc;
+//nop;
+a3 = MEM_U32(a3 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t7 = 0x1;
+at = 0x10000010;
+//nop;
+a0 = MEM_U32(sp + 1204);
+MEM_U32(at + 0) = t7;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40a07c;
+L409f6c:
+t8 = MEM_U32(sp + 1204);
+L409f70:
+at = 0x10004e00;
+//nop;
+MEM_U32(at + 0) = t8;
+L409f7c:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L409fc8;
+a0 = 0x10004df8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+t9 = 0x1;
+at = 0x10000010;
+MEM_U32(at + 0) = t9;
+goto L40a078;
+L409fc8:
+a1 = 0x10004e20;
+t1 = 0x1000000c;
+MEM_U32(a1 + 12) = zero;
+MEM_U32(a1 + 8) = zero;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L40a02c;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a1 = zero;
+if (v0 != 0) goto L40a00c;
+a1 = 0x1;
+goto L40a00c;
+L40a00c:
+//nop;
+a0 = 0x10004e20;
+//nop;
+f_swap_filehdr(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+a1 = 0x10004e20;
+//nop;
+L40a02c:
+a0 = 0x10004e00;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x14;
+v0 = wrapper_write(mem, a0, a1, a2);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+at = 0x14;
+// bdead 40000001 ra = MEM_U32(sp + 36);
+if (v0 == at) goto L40a07c;
+a0 = 0x10004df8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+wrapper_perror(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+t2 = 0x1;
+at = 0x10000010;
+//nop;
+MEM_U32(at + 0) = t2;
+L40a078:
+// bdead 1 ra = MEM_U32(sp + 36);
+L40a07c:
+// bdead 1 sp = sp + 0x4c0;
+//nop;
+return;
+//nop;
+//nop;
+}
+
+static void f_swap_filehdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a090:
+//swap_filehdr:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U16(a0 + 0);
+a1 = MEM_U32(a0 + 4);
+t7 = v0 << 8;
+t8 = v0 >> 8;
+t9 = t7 | t8;
+v1 = MEM_U16(a0 + 2);
+t0 = 0xff0000;
+t6 = a1 << 8;
+MEM_U16(a0 + 0) = (uint16_t)t9;
+t7 = t6 & t0;
+t5 = a1 << 24;
+a2 = MEM_U32(a0 + 8);
+t8 = t5 | t7;
+t9 = (int)a1 >> 8;
+t2 = v1 << 8;
+t3 = v1 >> 8;
+t4 = t2 | t3;
+t1 = t9 & 0xff00;
+t2 = t8 | t1;
+t5 = a2 << 8;
+t7 = t5 & t0;
+t6 = a2 << 24;
+a3 = MEM_U32(a0 + 12);
+MEM_U16(a0 + 2) = (uint16_t)t4;
+t9 = t6 | t7;
+t3 = a1 >> 24;
+t8 = (int)a2 >> 8;
+t4 = t2 | t3;
+t1 = t8 & 0xff00;
+t2 = t9 | t1;
+t6 = a3 << 8;
+MEM_U32(a0 + 4) = t4;
+t7 = t6 & t0;
+t3 = a2 >> 24;
+t9 = (int)a3 >> 8;
+t5 = a3 << 24;
+t4 = t2 | t3;
+t8 = t5 | t7;
+t1 = t9 & 0xff00;
+t2 = t8 | t1;
+v0 = MEM_U16(a0 + 16);
+t8 = MEM_U16(a0 + 18);
+MEM_U32(a0 + 8) = t4;
+t3 = a3 >> 24;
+t4 = t2 | t3;
+t6 = v0 & 0xff;
+t5 = t6 << 8;
+t7 = v0 >> 8;
+t2 = t8 >> 8;
+t1 = t8 << 8;
+t9 = t5 | t7;
+t3 = t1 | t2;
+MEM_U32(a0 + 12) = t4;
+MEM_U16(a0 + 16) = (uint16_t)t9;
+MEM_U16(a0 + 18) = (uint16_t)t3;
+return;
+}
+
+static void f_swap_aouthdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a174:
+//swap_aouthdr:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_S16(a0 + 0);
+v1 = MEM_S16(a0 + 2);
+t8 = v0 & 0xffff;
+t9 = t8 >> 8;
+t7 = v0 << 8;
+a1 = MEM_U32(a0 + 4);
+t1 = t7 | t9;
+t4 = v1 & 0xffff;
+t0 = 0xff0000;
+t5 = t4 >> 8;
+t3 = v1 << 8;
+t7 = a1 << 8;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 8);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U16(a0 + 2) = (uint16_t)t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & t0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 12);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 4) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = a3 << 24;
+v0 = MEM_U32(a0 + 16);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 8) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v0 << 8;
+t6 = t3 | t5;
+t9 = t8 & t0;
+t7 = v0 << 24;
+v1 = MEM_U32(a0 + 20);
+t2 = t7 | t9;
+t1 = (int)v0 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 12) = t6;
+t3 = t2 | t4;
+t5 = v0 >> 24;
+t7 = v1 << 8;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = v1 << 24;
+a1 = MEM_U32(a0 + 24);
+t1 = t8 | t9;
+t2 = (int)v1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 16) = t6;
+t3 = t1 | t4;
+t5 = v1 >> 24;
+t8 = a1 << 8;
+t6 = t3 | t5;
+t9 = t8 & t0;
+t7 = a1 << 24;
+a2 = MEM_U32(a0 + 28);
+t2 = t7 | t9;
+t1 = (int)a1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 20) = t6;
+t3 = t2 | t4;
+t5 = a1 >> 24;
+t7 = a2 << 8;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = a2 << 24;
+v0 = MEM_U32(a0 + 32);
+t1 = t8 | t9;
+t2 = (int)a2 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 24) = t6;
+t3 = t1 | t4;
+t5 = a2 >> 24;
+t8 = v0 << 8;
+t6 = t3 | t5;
+t9 = t8 & t0;
+t7 = v0 << 24;
+v1 = MEM_U32(a0 + 36);
+t2 = t7 | t9;
+t1 = (int)v0 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 28) = t6;
+t3 = t2 | t4;
+t5 = v0 >> 24;
+t7 = v1 << 8;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = v1 << 24;
+a1 = MEM_U32(a0 + 40);
+t1 = t8 | t9;
+t2 = (int)v1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 32) = t6;
+t3 = t1 | t4;
+t5 = v1 >> 24;
+t8 = a1 << 8;
+t6 = t5 | t3;
+t9 = t8 & t0;
+t7 = a1 << 24;
+a2 = MEM_U32(a0 + 44);
+t2 = t7 | t9;
+t1 = (int)a1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 36) = t6;
+t5 = t2 | t4;
+t3 = a1 >> 24;
+t7 = a2 << 8;
+t6 = t3 | t5;
+t9 = t7 & t0;
+t8 = a2 << 24;
+v0 = MEM_U32(a0 + 48);
+t1 = t8 | t9;
+t2 = (int)a2 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 40) = t6;
+t3 = t1 | t4;
+t5 = a2 >> 24;
+t8 = v0 << 8;
+t6 = t5 | t3;
+t9 = t8 & t0;
+t7 = v0 << 24;
+v1 = MEM_U32(a0 + 52);
+t2 = t7 | t9;
+t1 = (int)v0 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 44) = t6;
+t5 = t2 | t4;
+t3 = v0 >> 24;
+t6 = t3 | t5;
+t7 = v1 << 8;
+t9 = t7 & t0;
+t2 = (int)v1 >> 8;
+t8 = v1 << 24;
+t1 = t8 | t9;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 48) = t6;
+t3 = t1 | t4;
+t5 = v1 >> 24;
+t6 = t3 | t5;
+MEM_U32(a0 + 52) = t6;
+return;
+}
+
+static void f_swap_scnhdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a3ec:
+//swap_scnhdr:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 8);
+t0 = 0xff0000;
+t7 = v0 << 8;
+t8 = t7 & t0;
+t6 = v0 << 24;
+v1 = MEM_U32(a0 + 12);
+t9 = t6 | t8;
+t1 = (int)v0 >> 8;
+t2 = t1 & 0xff00;
+t3 = t9 | t2;
+t4 = v0 >> 24;
+t6 = v1 << 8;
+t5 = t3 | t4;
+t8 = t6 & t0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 16);
+t1 = t7 | t8;
+t9 = (int)v1 >> 8;
+t2 = t9 & 0xff00;
+MEM_U32(a0 + 8) = t5;
+t3 = t1 | t2;
+t4 = v1 >> 24;
+t7 = a1 << 8;
+t5 = t3 | t4;
+t8 = t7 & t0;
+t6 = a1 << 24;
+a2 = MEM_U32(a0 + 20);
+t9 = t6 | t8;
+t1 = (int)a1 >> 8;
+t2 = t1 & 0xff00;
+MEM_U32(a0 + 12) = t5;
+t3 = t9 | t2;
+t4 = a1 >> 24;
+t6 = a2 << 8;
+t5 = t3 | t4;
+t8 = t6 & t0;
+t7 = a2 << 24;
+v0 = MEM_U32(a0 + 24);
+t1 = t7 | t8;
+t9 = (int)a2 >> 8;
+t2 = t9 & 0xff00;
+MEM_U32(a0 + 16) = t5;
+t3 = t1 | t2;
+t4 = a2 >> 24;
+t7 = v0 << 8;
+t5 = t3 | t4;
+t8 = t7 & t0;
+t6 = v0 << 24;
+v1 = MEM_U32(a0 + 28);
+t9 = t6 | t8;
+t1 = (int)v0 >> 8;
+t2 = t1 & 0xff00;
+MEM_U32(a0 + 20) = t5;
+t3 = t9 | t2;
+t4 = v0 >> 24;
+t6 = v1 << 8;
+t5 = t3 | t4;
+t8 = t6 & t0;
+t7 = v1 << 24;
+a1 = MEM_U16(a0 + 32);
+t1 = t7 | t8;
+t9 = (int)v1 >> 8;
+t2 = t9 & 0xff00;
+a2 = MEM_U16(a0 + 34);
+MEM_U32(a0 + 24) = t5;
+t3 = t1 | t2;
+t4 = v1 >> 24;
+a3 = MEM_U32(a0 + 36);
+t5 = t3 | t4;
+t8 = a1 >> 8;
+t7 = a1 << 8;
+t9 = t7 | t8;
+t3 = a2 >> 8;
+t2 = a2 << 8;
+MEM_U32(a0 + 28) = t5;
+MEM_U16(a0 + 32) = (uint16_t)t9;
+t4 = t2 | t3;
+t6 = a3 << 8;
+t7 = t6 & t0;
+t9 = (int)a3 >> 8;
+t5 = a3 << 24;
+t8 = t5 | t7;
+t1 = t9 & 0xff00;
+MEM_U16(a0 + 34) = (uint16_t)t4;
+t2 = t8 | t1;
+t3 = a3 >> 24;
+t4 = t2 | t3;
+MEM_U32(a0 + 36) = t4;
+return;
+}
+
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a6c0:
+//swap_hdr:
+MEM_U32(sp + 4) = a1;
+v1 = MEM_S16(a0 + 0);
+a1 = MEM_S16(a0 + 2);
+t8 = v1 & 0xffff;
+t9 = t8 >> 8;
+t7 = v1 << 8;
+a2 = MEM_U32(a0 + 4);
+t1 = t7 | t9;
+t4 = a1 & 0xffff;
+v0 = 0xff0000;
+t5 = t4 >> 8;
+t3 = a1 << 8;
+t7 = a2 << 8;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a2 << 24;
+a3 = MEM_U32(a0 + 8);
+t1 = t8 | t9;
+t2 = (int)a2 >> 8;
+t4 = t2 & 0xff00;
+MEM_U16(a0 + 2) = (uint16_t)t6;
+t3 = t1 | t4;
+t5 = a2 >> 24;
+t8 = a3 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a3 << 24;
+t0 = MEM_U32(a0 + 12);
+t2 = t7 | t9;
+t1 = (int)a3 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 4) = t6;
+t3 = t2 | t4;
+t5 = a3 >> 24;
+t7 = t0 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = t0 << 24;
+v1 = MEM_U32(a0 + 16);
+t1 = t8 | t9;
+t2 = (int)t0 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 8) = t6;
+t3 = t1 | t4;
+t5 = t0 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 20);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 12) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 24);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 16) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 28);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 20) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 32);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 24) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 36);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 28) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 40);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 32) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 44);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 36) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 48);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 40) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 52);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 44) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 56);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 48) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 60);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 52) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 64);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 56) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 68);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 60) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 72);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 64) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 76);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 68) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 80);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 72) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 84);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 76) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 88);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 80) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 92);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 84) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t6 = t3 | t5;
+t7 = a3 << 8;
+t9 = t7 & v0;
+t2 = (int)a3 >> 8;
+t8 = a3 << 24;
+t1 = t8 | t9;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 88) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t6 = t3 | t5;
+MEM_U32(a0 + 92) = t6;
+return;
+}
+
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0, ra = 0;
+L40aaf0:
+//swap_fd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff70;
+//nop;
+// fdead 400000eb MEM_U32(sp + 52) = ra;
+// fdead 400000eb MEM_U32(sp + 44) = s5;
+// fdead 400000eb MEM_U32(sp + 40) = s4;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s4 = a1;
+s5 = a2;
+// fdead 406200eb MEM_U32(sp + 48) = gp;
+// fdead 406200eb MEM_U32(sp + 36) = s3;
+// fdead 406200eb MEM_U32(sp + 32) = s2;
+// fdead 406200eb MEM_U32(sp + 28) = s1;
+v0 = f_gethostsex(mem, sp);
+// bdead 4062000b gp = MEM_U32(sp + 48);
+s3 = zero;
+if ((int)s4 <= 0) goto L40b0c8;
+v1 = s0;
+s2 = 0xff0000;
+s1 = sp + 0x40;
+a0 = 0xff0000;
+L40ab50:
+t8 = v1;
+t9 = s1;
+t7 = v1 + 0x48;
+L40ab5c:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t9 + 0) = at;
+at = MEM_U32(t8 + -8);
+t9 = t9 + 0xc;
+MEM_U32(t9 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t9 + -4) = at;
+if (t8 != t7) goto L40ab5c;
+t6 = MEM_U32(sp + 64);
+a1 = MEM_U32(sp + 84);
+t8 = t6 << 8;
+t9 = t8 & s2;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t6 = MEM_U32(sp + 68);
+MEM_U32(sp + 64) = t9;
+t8 = t6 << 8;
+t9 = t8 & a0;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = (int)t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = MEM_U32(sp + 68);
+t6 = t8 | t9;
+t8 = t7 >> 24;
+t9 = t6 | t8;
+t7 = MEM_U32(sp + 72);
+MEM_U32(sp + 68) = t9;
+t8 = t7 << 8;
+t9 = t8 & a0;
+t6 = t7 << 24;
+t8 = t6 | t9;
+t6 = (int)t7 >> 8;
+t9 = t6 & 0xff00;
+t6 = MEM_U32(sp + 72);
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t6 = MEM_U32(sp + 76);
+MEM_U32(sp + 72) = t9;
+t8 = t6 << 8;
+t9 = t8 & a0;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = (int)t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = MEM_U32(sp + 76);
+t6 = t8 | t9;
+t8 = t7 >> 24;
+t9 = t6 | t8;
+t7 = MEM_U32(sp + 80);
+MEM_U32(sp + 76) = t9;
+t8 = t7 << 8;
+t9 = t8 & a0;
+t6 = t7 << 24;
+t8 = t6 | t9;
+t6 = (int)t7 >> 8;
+t9 = t6 & 0xff00;
+t6 = MEM_U32(sp + 80);
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t7 = a1 << 8;
+t8 = t7 & a0;
+MEM_U32(sp + 80) = t9;
+t6 = a1 << 24;
+t9 = t6 | t8;
+t7 = (int)a1 >> 8;
+t6 = t7 & 0xff00;
+a2 = MEM_U32(sp + 88);
+t8 = t9 | t6;
+t7 = a1 >> 24;
+a1 = t8 | t7;
+t6 = a2 << 8;
+t8 = t6 & a0;
+t9 = a2 << 24;
+t7 = t9 | t8;
+t6 = (int)a2 >> 8;
+t9 = t6 & 0xff00;
+a3 = MEM_U32(sp + 92);
+t8 = t7 | t9;
+t6 = a2 >> 24;
+a2 = t8 | t6;
+t9 = a3 << 8;
+t8 = t9 & a0;
+t7 = a3 << 24;
+t6 = t7 | t8;
+t9 = (int)a3 >> 8;
+t7 = t9 & 0xff00;
+t0 = MEM_U32(sp + 96);
+t8 = t6 | t7;
+t9 = a3 >> 24;
+a3 = t8 | t9;
+t7 = t0 << 8;
+t8 = t7 & a0;
+t6 = t0 << 24;
+t9 = t6 | t8;
+t7 = (int)t0 >> 8;
+t6 = t7 & 0xff00;
+t1 = MEM_U32(sp + 100);
+t8 = t9 | t6;
+t7 = t0 >> 24;
+t0 = t8 | t7;
+t6 = t1 << 8;
+t8 = t6 & a0;
+t9 = t1 << 24;
+t7 = t9 | t8;
+t6 = (int)t1 >> 8;
+t9 = t6 & 0xff00;
+t8 = t7 | t9;
+t6 = t1 >> 24;
+t1 = t8 | t6;
+t6 = MEM_U16(sp + 104);
+t9 = MEM_S16(sp + 104);
+t7 = t6 >> 8;
+t8 = t9 << 8;
+t9 = t8 | t7;
+MEM_U16(sp + 104) = (uint16_t)t9;
+t9 = MEM_U16(sp + 106);
+t8 = MEM_S16(sp + 106);
+t2 = MEM_U32(sp + 108);
+t6 = t9 >> 8;
+t7 = t8 << 8;
+t8 = t7 | t6;
+t7 = t2 << 8;
+t6 = t7 & a0;
+MEM_U16(sp + 106) = (uint16_t)t8;
+t9 = t2 << 24;
+t8 = t9 | t6;
+t7 = (int)t2 >> 8;
+t9 = t7 & 0xff00;
+t3 = MEM_U32(sp + 112);
+t6 = t8 | t9;
+t7 = t2 >> 24;
+t2 = t6 | t7;
+t9 = t3 << 8;
+t6 = t9 & a0;
+t8 = t3 << 24;
+t7 = t8 | t6;
+t9 = (int)t3 >> 8;
+t8 = t9 & 0xff00;
+t4 = MEM_U32(sp + 116);
+t6 = t7 | t8;
+t9 = t3 >> 24;
+t3 = t6 | t9;
+t8 = t4 << 8;
+t6 = t8 & a0;
+t7 = t4 << 24;
+t9 = t7 | t6;
+t8 = (int)t4 >> 8;
+t7 = t8 & 0xff00;
+t5 = MEM_U32(sp + 120);
+t6 = t9 | t7;
+t8 = t4 >> 24;
+t4 = t6 | t8;
+t7 = t5 << 8;
+t6 = t7 & a0;
+t9 = t5 << 24;
+t8 = t9 | t6;
+t7 = (int)t5 >> 8;
+t9 = t7 & 0xff00;
+ra = MEM_U32(sp + 128);
+t6 = t8 | t9;
+t7 = t5 >> 24;
+t5 = t6 | t7;
+t9 = ra << 8;
+t6 = t9 & a0;
+t8 = ra << 24;
+t7 = t8 | t6;
+t9 = (int)ra >> 8;
+t8 = t9 & 0xff00;
+s0 = MEM_U32(sp + 132);
+t6 = t7 | t8;
+t9 = ra >> 24;
+ra = t6 | t9;
+t8 = s0 << 8;
+t6 = t8 & a0;
+t7 = s0 << 24;
+t9 = t7 | t6;
+t8 = (int)s0 >> 8;
+t7 = t8 & 0xff00;
+t6 = t9 | t7;
+t8 = s0 >> 24;
+s0 = t6 | t8;
+MEM_U32(sp + 132) = s0;
+MEM_U32(sp + 128) = ra;
+MEM_U32(sp + 120) = t5;
+MEM_U32(sp + 116) = t4;
+MEM_U32(sp + 112) = t3;
+MEM_U32(sp + 108) = t2;
+MEM_U32(sp + 100) = t1;
+MEM_U32(sp + 96) = t0;
+MEM_U32(sp + 92) = a3;
+MEM_U32(sp + 88) = a2;
+MEM_U32(sp + 84) = a1;
+if (s5 != v0) goto L40afa0;
+t6 = s1;
+t8 = v1;
+t7 = s1 + 0x48;
+L40ae90:
+at = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+MEM_U32(t8 + 0) = at;
+at = MEM_U32(t6 + -8);
+t8 = t8 + 0xc;
+MEM_U32(t8 + -8) = at;
+at = MEM_U32(t6 + -4);
+MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L40ae90;
+t9 = MEM_U32(sp + 124);
+//nop;
+t6 = t9 << 8;
+t8 = t6 & s2;
+t7 = t9 << 24;
+t6 = t7 | t8;
+t7 = t9 >> 8;
+t8 = t7 & 0xff00;
+t7 = t6 | t8;
+t6 = t9 >> 24;
+t9 = t7 | t6;
+MEM_U32(sp + 124) = t9;
+t8 = MEM_U8(v1 + 60);
+t6 = t9 << 3;
+t9 = t8 & 0xff07;
+t7 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t8 = MEM_U32(sp + 124);
+//nop;
+t6 = t8 << 26;
+t9 = t6 >> 31;
+t6 = MEM_U8(v1 + 60);
+t7 = t9 << 2;
+t8 = t7 & 0x4;
+t9 = t6 & 0xfffb;
+t7 = t8 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t6 = MEM_U32(sp + 124);
+//nop;
+t8 = t6 << 25;
+t9 = t8 >> 31;
+t8 = MEM_U8(v1 + 60);
+t7 = t9 << 1;
+t6 = t7 & 0x2;
+t9 = t8 & 0xfffd;
+t7 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t8 = MEM_U8(sp + 127);
+//nop;
+t6 = t8 >> 7;
+t9 = t6 & 0x1;
+t8 = t7 & 0xfe;
+t6 = t9 | t8;
+MEM_U8(v1 + 60) = (uint8_t)t6;
+t9 = MEM_U8(sp + 126);
+t7 = MEM_U8(v1 + 61);
+t6 = t9 << 6;
+t9 = t7 & 0xff3f;
+t8 = t6 | t9;
+MEM_U8(v1 + 61) = (uint8_t)t8;
+t7 = MEM_U32(sp + 124);
+//nop;
+t9 = t7 >> 10;
+t7 = MEM_U16(v1 + 62);
+t8 = t9 & 0x1fff;
+t6 = t7 & 0xe000;
+t9 = t8 | t6;
+MEM_U16(v1 + 62) = (uint16_t)t9;
+goto L40b0bc;
+L40afa0:
+t7 = MEM_U32(v1 + 60);
+t9 = MEM_U8(sp + 127);
+t8 = t7 >> 27;
+t6 = t8 & 0x1f;
+t7 = t9 & 0xffe0;
+t8 = t6 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t9 = MEM_U32(v1 + 60);
+//nop;
+t6 = t9 << 5;
+t7 = t6 >> 31;
+t9 = t7 << 5;
+t6 = t9 & 0x20;
+t7 = t8;
+t9 = t7 & 0xdf;
+t8 = t6 | t9;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t7 = MEM_U32(v1 + 60);
+//nop;
+t6 = t7 << 6;
+t9 = t6 >> 31;
+t7 = t9 << 6;
+t6 = t7 & 0x40;
+t9 = t8;
+t7 = t9 & 0xbf;
+t8 = t6 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t6 = MEM_U8(v1 + 60);
+//nop;
+t9 = t6 << 7;
+t6 = t8;
+t7 = t6 & 0x7f;
+t8 = t9 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t6 = MEM_U8(v1 + 61);
+t8 = MEM_U8(sp + 126);
+t9 = t6 >> 6;
+t7 = t9 & 0x3;
+t6 = t8 & 0xfffc;
+t9 = t7 | t6;
+MEM_U8(sp + 126) = (uint8_t)t9;
+t6 = MEM_U32(sp + 124);
+t8 = MEM_U32(v1 + 60);
+t9 = t6 >> 10;
+t7 = t8 & 0x1fff;
+t8 = t7 ^ t9;
+t7 = t8 << 10;
+t9 = t7 ^ t6;
+t7 = t9 << 8;
+t6 = t7 & s2;
+t8 = t9 << 24;
+t7 = t8 | t6;
+t8 = t9 >> 8;
+t6 = t8 & 0xff00;
+t8 = t7 | t6;
+t7 = t9 >> 24;
+t6 = t8 | t7;
+MEM_U32(sp + 124) = t9;
+MEM_U32(sp + 124) = t6;
+t6 = s1;
+t7 = s1 + 0x48;
+t8 = v1;
+L40b098:
+at = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+MEM_U32(t8 + 0) = at;
+at = MEM_U32(t6 + -8);
+t8 = t8 + 0xc;
+MEM_U32(t8 + -8) = at;
+at = MEM_U32(t6 + -4);
+MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L40b098;
+L40b0bc:
+s3 = s3 + 0x1;
+v1 = v1 + 0x48;
+if (s3 != s4) goto L40ab50;
+L40b0c8:
+// bdead 1 ra = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x90;
+return;
+}
+
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40b0ec:
+//swap_fi:
+MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L40b218;
+a2 = a1 & 0x3;
+a3 = a2;
+if (a2 == 0) goto L40b14c;
+t6 = zero << 2;
+v1 = a0 + t6;
+t1 = 0xff0000;
+L40b110:
+a2 = MEM_U32(v1 + 0);
+v0 = v0 + 0x1;
+t8 = a2 << 8;
+t9 = t8 & t1;
+t7 = a2 << 24;
+t3 = (int)a2 >> 8;
+t4 = t3 & 0xff00;
+t2 = t7 | t9;
+t5 = t2 | t4;
+t6 = a2 >> 24;
+t8 = t6 | t5;
+MEM_U32(v1 + 0) = t8;
+v1 = v1 + 0x4;
+if (a3 != v0) goto L40b110;
+if (v0 == a1) {
+t7 = v0 << 2;
+goto L40b218;}
+L40b14c:
+t7 = v0 << 2;
+t9 = a1 << 2;
+t0 = t9 + a0;
+v1 = a0 + t7;
+t1 = 0xff0000;
+L40b160:
+a2 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 4);
+t2 = a2 << 8;
+t4 = t2 & t1;
+t3 = a2 << 24;
+t5 = (int)a2 >> 8;
+t8 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = t6 | t8;
+t9 = a2 >> 24;
+t2 = t9 | t7;
+t4 = v0 << 8;
+t5 = t4 & t1;
+t8 = (int)v0 >> 8;
+t3 = v0 << 24;
+a0 = MEM_U32(v1 + 8);
+t6 = t3 | t5;
+t9 = t8 & 0xff00;
+MEM_U32(v1 + 0) = t2;
+t7 = t6 | t9;
+t2 = v0 >> 24;
+t4 = t2 | t7;
+t5 = a0 << 8;
+t8 = t5 & t1;
+t9 = (int)a0 >> 8;
+t3 = a0 << 24;
+a3 = MEM_U32(v1 + 12);
+t6 = t3 | t8;
+t2 = t9 & 0xff00;
+MEM_U32(v1 + 4) = t4;
+t7 = t6 | t2;
+t4 = a0 >> 24;
+t5 = t4 | t7;
+t8 = a3 << 8;
+t9 = t8 & t1;
+t2 = (int)a3 >> 8;
+t3 = a3 << 24;
+t6 = t3 | t9;
+t4 = t2 & 0xff00;
+MEM_U32(v1 + 8) = t5;
+t7 = t6 | t4;
+t5 = a3 >> 24;
+t8 = t5 | t7;
+v1 = v1 + 0x10;
+MEM_U32(v1 + -4) = t8;
+if (v1 != t0) goto L40b160;
+L40b218:
+//nop;
+return;
+}
+
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40b220:
+//swap_sym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a2 = zero;
+if ((int)s0 <= 0) goto L40b4a4;
+v1 = MEM_U32(sp + 64);
+t0 = 0xff0000;
+a3 = 0xff0000;
+a1 = sp + 0x2c;
+L40b270:
+at = MEM_U32(v1 + 0);
+a2 = a2 + 0x1;
+MEM_U32(a1 + 0) = at;
+t7 = MEM_U32(v1 + 4);
+//nop;
+MEM_U32(a1 + 4) = t7;
+at = MEM_U32(v1 + 8);
+//nop;
+MEM_U32(a1 + 8) = at;
+t8 = MEM_U32(sp + 44);
+at = 0xf0000;
+t1 = t8 << 8;
+t2 = t1 & a3;
+t9 = t8 << 24;
+t3 = t9 | t2;
+t4 = (int)t8 >> 8;
+t2 = MEM_U32(sp + 48);
+t5 = t4 & 0xff00;
+t6 = t3 | t5;
+t1 = t8 >> 24;
+t4 = t2 << 8;
+t9 = t6 | t1;
+t3 = t4 & a3;
+t8 = t2 << 24;
+t7 = (int)t2 >> 8;
+t6 = t7 & 0xff00;
+t5 = t8 | t3;
+t1 = t5 | t6;
+t4 = t2 >> 24;
+t8 = t1 | t4;
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 48) = t8;
+if (s1 != v0) goto L40b3c8;
+at = MEM_U32(a1 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t2 = MEM_U32(a1 + 4);
+//nop;
+MEM_U32(v1 + 4) = t2;
+at = MEM_U32(a1 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t7 = MEM_U32(sp + 52);
+//nop;
+t6 = t7 << 8;
+t9 = t6 & t0;
+t5 = t7 << 24;
+t4 = t7 >> 8;
+t8 = t4 & 0xff00;
+t1 = t5 | t9;
+t3 = t1 | t8;
+t2 = t7 >> 24;
+t5 = t3 | t2;
+MEM_U32(sp + 52) = t5;
+t1 = MEM_U8(v1 + 8);
+t4 = t5 << 2;
+t8 = t1 & 0xff03;
+t7 = t4 | t8;
+MEM_U8(v1 + 8) = (uint8_t)t7;
+t3 = MEM_U32(sp + 52);
+t1 = MEM_U16(v1 + 8);
+t2 = t3 << 21;
+t6 = t2 >> 27;
+t5 = t6 << 5;
+t9 = t5 & 0x3e0;
+t4 = t1 & 0xfc1f;
+t8 = t9 | t4;
+MEM_U16(v1 + 8) = (uint16_t)t8;
+t7 = MEM_U32(sp + 52);
+t1 = MEM_U8(v1 + 9);
+t3 = t7 << 20;
+t2 = t3 >> 31;
+t6 = t2 << 4;
+t5 = t6 & 0x10;
+t9 = t1 & 0xffef;
+t4 = t5 | t9;
+MEM_U8(v1 + 9) = (uint8_t)t4;
+t8 = MEM_U32(sp + 52);
+a0 = MEM_U32(v1 + 8);
+t7 = t8 >> 12;
+t3 = t7 ^ a0;
+t2 = t3 << 12;
+t6 = t2 >> 12;
+t1 = t6 ^ a0;
+MEM_U32(v1 + 8) = t1;
+goto L40b49c;
+L40b3c8:
+t5 = MEM_U32(v1 + 8);
+t8 = MEM_U8(sp + 55);
+t9 = t5 >> 26;
+t4 = t9 & 0x3f;
+t7 = t8 & 0xffc0;
+t3 = t4 | t7;
+MEM_U8(sp + 55) = (uint8_t)t3;
+t2 = MEM_U32(v1 + 8);
+t8 = MEM_U16(sp + 54);
+t6 = t2 << 6;
+t1 = t6 >> 27;
+t5 = t1 << 6;
+t9 = t5 & 0x7c0;
+t4 = t8 & 0xf83f;
+t7 = t9 | t4;
+MEM_U16(sp + 54) = (uint16_t)t7;
+t3 = MEM_U32(v1 + 8);
+t8 = MEM_U8(sp + 54);
+t2 = t3 << 11;
+t6 = t2 >> 31;
+t1 = t6 << 3;
+t5 = t1 & 0x8;
+t9 = t8 & 0xfff7;
+t4 = t5 | t9;
+MEM_U8(sp + 54) = (uint8_t)t4;
+t7 = MEM_U32(v1 + 8);
+t2 = MEM_U32(sp + 52);
+at = at | 0xffff;
+t3 = t7 & at;
+t6 = t2 >> 12;
+t1 = t3 ^ t6;
+t8 = t1 << 12;
+t5 = t8 ^ t2;
+t4 = t5 << 8;
+t7 = t4 & t0;
+t9 = t5 << 24;
+t6 = t5 >> 8;
+t1 = t6 & 0xff00;
+t3 = t9 | t7;
+t8 = t3 | t1;
+t2 = t5 >> 24;
+MEM_U32(sp + 52) = t5;
+t4 = t8 | t2;
+MEM_U32(sp + 52) = t4;
+at = MEM_U32(a1 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t6 = MEM_U32(a1 + 4);
+//nop;
+MEM_U32(v1 + 4) = t6;
+at = MEM_U32(a1 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+L40b49c:
+v1 = v1 + 0xc;
+if (a2 != s0) goto L40b270;
+L40b4a4:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40b4b8:
+//swap_ext:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a3 = zero;
+if ((int)s0 <= 0) goto L40b8b8;
+v1 = MEM_U32(sp + 72);
+t0 = 0xff0000;
+a2 = sp + 0x30;
+a1 = 0xff0000;
+L40b508:
+at = MEM_U32(v1 + 0);
+a3 = a3 + 0x1;
+MEM_U32(a2 + 0) = at;
+t7 = MEM_U32(v1 + 4);
+//nop;
+MEM_U32(a2 + 4) = t7;
+at = MEM_U32(v1 + 8);
+//nop;
+MEM_U32(a2 + 8) = at;
+t7 = MEM_U32(v1 + 12);
+at = 0xf0000;
+MEM_U32(a2 + 12) = t7;
+t8 = MEM_U32(sp + 52);
+at = at | 0xffff;
+t1 = t8 << 8;
+t2 = t1 & t0;
+t9 = t8 << 24;
+t3 = t9 | t2;
+t4 = (int)t8 >> 8;
+t2 = MEM_U32(sp + 56);
+t5 = t4 & 0xff00;
+t6 = t3 | t5;
+t1 = t8 >> 24;
+t4 = t2 << 8;
+t9 = t6 | t1;
+t3 = t4 & t0;
+t8 = t2 << 24;
+t7 = (int)t2 >> 8;
+t6 = t7 & 0xff00;
+t5 = t8 | t3;
+t1 = t5 | t6;
+t4 = t2 >> 24;
+t8 = t1 | t4;
+MEM_U32(sp + 52) = t9;
+MEM_U32(sp + 56) = t8;
+if (s1 != v0) goto L40b724;
+at = MEM_U32(a2 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t2 = MEM_U32(a2 + 4);
+//nop;
+MEM_U32(v1 + 4) = t2;
+at = MEM_U32(a2 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t2 = MEM_U32(a2 + 12);
+//nop;
+MEM_U32(v1 + 12) = t2;
+t7 = MEM_U32(sp + 60);
+//nop;
+t6 = t7 << 8;
+t9 = t6 & a1;
+t5 = t7 << 24;
+t4 = t7 >> 8;
+t8 = t4 & 0xff00;
+t1 = t5 | t9;
+t3 = t1 | t8;
+t2 = t7 >> 24;
+t5 = t3 | t2;
+MEM_U32(sp + 60) = t5;
+t1 = MEM_U8(v1 + 12);
+t4 = t5 << 2;
+t8 = t1 & 0xff03;
+t7 = t4 | t8;
+MEM_U8(v1 + 12) = (uint8_t)t7;
+t3 = MEM_U32(sp + 60);
+t1 = MEM_U16(v1 + 12);
+t2 = t3 << 21;
+t6 = t2 >> 27;
+t5 = t6 << 5;
+t9 = t5 & 0x3e0;
+t4 = t1 & 0xfc1f;
+t8 = t9 | t4;
+MEM_U16(v1 + 12) = (uint16_t)t8;
+t7 = MEM_U32(sp + 60);
+t1 = MEM_U8(v1 + 13);
+t3 = t7 << 20;
+t2 = t3 >> 31;
+t6 = t2 << 4;
+t5 = t6 & 0x10;
+t9 = t1 & 0xffef;
+t4 = t5 | t9;
+MEM_U8(v1 + 13) = (uint8_t)t4;
+t8 = MEM_U32(sp + 60);
+a0 = MEM_U32(v1 + 12);
+t7 = t8 >> 12;
+t3 = t7 ^ a0;
+t2 = t3 << 12;
+t6 = t2 >> 12;
+t1 = t6 ^ a0;
+MEM_U32(v1 + 12) = t1;
+t5 = MEM_U32(sp + 48);
+//nop;
+t4 = t5 << 8;
+t8 = t4 & a1;
+t9 = t5 << 24;
+t3 = t5 >> 8;
+t2 = t3 & 0xff00;
+t7 = t9 | t8;
+t6 = t7 | t2;
+t1 = t5 >> 24;
+t4 = t6 | t1;
+MEM_U32(sp + 48) = t4;
+t9 = MEM_S16(sp + 48);
+t5 = MEM_U16(v1 + 0);
+MEM_U16(v1 + 2) = (uint16_t)t9;
+t8 = MEM_U16(sp + 50);
+t6 = t5 & 0xf800;
+t7 = t8 >> 3;
+t2 = t7 & 0x7ff;
+t1 = t2 | t6;
+MEM_U16(v1 + 0) = (uint16_t)t1;
+t7 = MEM_U8(v1 + 0);
+t9 = MEM_U32(sp + 48);
+t5 = t7 & 0xff7f;
+t3 = t9 << 7;
+t7 = t3 | t5;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t6 = MEM_U32(sp + 48);
+t3 = t7 & 0xbf;
+t1 = t6 << 30;
+t4 = t1 >> 31;
+t9 = t4 << 6;
+t8 = t9 & 0x40;
+t7 = t8 | t3;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t2 = MEM_U32(sp + 48);
+t8 = t7 & 0xdf;
+t6 = t2 << 29;
+t1 = t6 >> 31;
+t4 = t1 << 5;
+t9 = t4 & 0x20;
+t3 = t9 | t8;
+MEM_U8(v1 + 0) = (uint8_t)t3;
+goto L40b8b0;
+L40b724:
+t5 = MEM_U32(v1 + 12);
+t1 = MEM_U8(sp + 63);
+t2 = t5 >> 26;
+t6 = t2 & 0x3f;
+t4 = t1 & 0xffc0;
+t7 = t6 | t4;
+MEM_U8(sp + 63) = (uint8_t)t7;
+t9 = MEM_U32(v1 + 12);
+t1 = MEM_U16(sp + 62);
+t8 = t9 << 6;
+t3 = t8 >> 27;
+t5 = t3 << 6;
+t2 = t5 & 0x7c0;
+t6 = t1 & 0xf83f;
+t4 = t2 | t6;
+MEM_U16(sp + 62) = (uint16_t)t4;
+t7 = MEM_U32(v1 + 12);
+t1 = MEM_U8(sp + 62);
+t9 = t7 << 11;
+t8 = t9 >> 31;
+t3 = t8 << 3;
+t5 = t3 & 0x8;
+t2 = t1 & 0xfff7;
+t6 = t5 | t2;
+MEM_U8(sp + 62) = (uint8_t)t6;
+t4 = MEM_U32(v1 + 12);
+t9 = MEM_U32(sp + 60);
+t7 = t4 & at;
+t8 = t9 >> 12;
+t3 = t7 ^ t8;
+t1 = t3 << 12;
+t5 = t1 ^ t9;
+t6 = t5 << 8;
+t4 = t6 & a1;
+t2 = t5 << 24;
+t8 = t5 >> 8;
+t3 = t8 & 0xff00;
+t7 = t2 | t4;
+t1 = t7 | t3;
+t9 = t5 >> 24;
+MEM_U32(sp + 60) = t5;
+t6 = t1 | t9;
+MEM_U32(sp + 60) = t6;
+t2 = MEM_S16(v1 + 2);
+t5 = MEM_U16(sp + 50);
+MEM_U16(sp + 48) = (uint16_t)t2;
+t4 = MEM_U16(v1 + 0);
+t1 = t5 & 0x7;
+t8 = t4 & 0x7ff;
+t3 = t8 << 3;
+t9 = t3 | t1;
+MEM_U16(sp + 50) = (uint16_t)t9;
+t6 = MEM_U32(v1 + 0);
+t5 = MEM_U8(sp + 51);
+t2 = t6 << 2;
+t4 = t2 >> 31;
+t8 = t4 << 2;
+t7 = t8 & 0x4;
+t3 = t5 & 0xfffb;
+t5 = t7 | t3;
+MEM_U8(sp + 51) = (uint8_t)t5;
+t9 = MEM_U32(v1 + 0);
+t7 = t5 & 0xfd;
+t6 = t9 << 1;
+t2 = t6 >> 31;
+t4 = t2 << 1;
+t8 = t4 & 0x2;
+t4 = t8 | t7;
+MEM_U8(sp + 51) = (uint8_t)t4;
+t9 = MEM_U32(v1 + 0);
+t1 = t4 & 0xfe;
+t6 = t9 >> 31;
+t2 = t6 & 0x1;
+t5 = t2 | t1;
+MEM_U8(sp + 51) = (uint8_t)t5;
+t8 = MEM_U32(sp + 48);
+//nop;
+t9 = t8 << 8;
+t6 = t9 & a1;
+t7 = t8 << 24;
+t4 = t8 >> 8;
+t2 = t4 & 0xff00;
+t3 = t7 | t6;
+t1 = t3 | t2;
+t5 = t8 >> 24;
+t9 = t1 | t5;
+MEM_U32(sp + 48) = t9;
+at = MEM_U32(a2 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t4 = MEM_U32(a2 + 4);
+//nop;
+MEM_U32(v1 + 4) = t4;
+at = MEM_U32(a2 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t4 = MEM_U32(a2 + 12);
+//nop;
+MEM_U32(v1 + 12) = t4;
+L40b8b0:
+v1 = v1 + 0x10;
+if (a3 != s0) goto L40b508;
+L40b8b8:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x48;
+return;
+}
+
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40b8cc:
+//swap_pd:
+MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L40bb30;
+v1 = a0;
+t1 = 0xff0000;
+t0 = 0xff0000;
+L40b8e4:
+a0 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v1 + 4);
+t6 = a0 >> 24;
+t7 = a0 << 24;
+t9 = a0 << 8;
+t2 = t9 & t0;
+t8 = t6 | t7;
+t4 = a0 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+t9 = a2 << 8;
+t8 = t9 & t1;
+t4 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 8);
+MEM_U32(v1 + 0) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+t6 = a2 >> 24;
+t9 = t6 | t5;
+t8 = a0 << 8;
+t4 = t8 & t1;
+t3 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 12);
+MEM_U32(v1 + 4) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+t9 = a0 >> 24;
+t8 = t9 | t5;
+t4 = a2 << 8;
+t3 = t4 & t1;
+t6 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 16);
+MEM_U32(v1 + 8) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+t8 = a2 >> 24;
+t4 = t8 | t5;
+t3 = a0 << 8;
+t6 = t3 & t1;
+t9 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 20);
+MEM_U32(v1 + 12) = t4;
+t2 = t7 | t6;
+t8 = t9 & 0xff00;
+t5 = t2 | t8;
+t4 = a0 >> 24;
+t3 = t4 | t5;
+t6 = a2 << 8;
+t9 = t6 & t1;
+t8 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 24);
+MEM_U32(v1 + 16) = t3;
+t2 = t7 | t9;
+t4 = t8 & 0xff00;
+t5 = t2 | t4;
+t3 = a2 >> 24;
+t6 = t3 | t5;
+t9 = a0 << 8;
+t8 = t9 & t1;
+t4 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 28);
+MEM_U32(v1 + 20) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+t6 = a0 >> 24;
+t9 = t6 | t5;
+t8 = a2 << 8;
+t4 = t8 & t1;
+t3 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 32);
+MEM_U32(v1 + 24) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+t9 = a2 >> 24;
+t8 = t9 | t5;
+t4 = a0 << 8;
+t3 = t4 & t1;
+t6 = (int)a0 >> 8;
+t7 = a0 << 24;
+MEM_U32(v1 + 28) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+t8 = a0 >> 24;
+t6 = MEM_S16(v1 + 36);
+t4 = t8 | t5;
+MEM_U32(v1 + 32) = t4;
+t4 = MEM_S16(v1 + 38);
+t7 = t6 & 0xffff;
+t3 = t7 >> 8;
+t2 = t6 << 8;
+a0 = MEM_U32(v1 + 40);
+t9 = t3 | t2;
+t8 = t4 & 0xffff;
+t5 = t8 >> 8;
+t7 = t4 << 8;
+t6 = t5 | t7;
+MEM_U16(v1 + 36) = (uint16_t)t9;
+t2 = a0 << 8;
+t9 = t2 & t1;
+t4 = (int)a0 >> 8;
+t3 = a0 << 24;
+a2 = MEM_U32(v1 + 44);
+MEM_U16(v1 + 38) = (uint16_t)t6;
+t8 = t3 | t9;
+t5 = t4 & 0xff00;
+t7 = t8 | t5;
+t6 = a0 >> 24;
+t2 = t6 | t7;
+t9 = a2 << 8;
+t4 = t9 & t1;
+t5 = (int)a2 >> 8;
+t3 = a2 << 24;
+a0 = MEM_U32(v1 + 48);
+MEM_U32(v1 + 40) = t2;
+t8 = t3 | t4;
+t6 = t5 & 0xff00;
+t7 = t8 | t6;
+t2 = a2 >> 24;
+t9 = t2 | t7;
+t4 = a0 << 8;
+t5 = t4 & t1;
+t6 = (int)a0 >> 8;
+t3 = a0 << 24;
+MEM_U32(v1 + 44) = t9;
+t8 = t3 | t5;
+t2 = t6 & 0xff00;
+t7 = t8 | t2;
+t9 = a0 >> 24;
+v0 = v0 + 0x1;
+t4 = t9 | t7;
+v1 = v1 + 0x34;
+MEM_U32(v1 + -4) = t4;
+if (v0 != a1) goto L40b8e4;
+L40bb30:
+//nop;
+return;
+}
+
+static void f_swap_aux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c0cc:
+//swap_aux:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 48) = a0;
+v0 = f_gethostsex(mem, sp);
+t6 = MEM_U32(sp + 56);
+// bdead 40008199 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+t7 = MEM_U32(sp + 52);
+if (t6 == v0) goto L40c134;
+a0 = 0xfb528e4;
+a1 = 0x10000b90;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 11 gp = MEM_U32(sp + 24);
+// bdead 11 ra = MEM_U32(sp + 28);
+goto L40c32c;
+// fdead 0 t7 = MEM_U32(sp + 52);
+L40c134:
+//nop;
+//nop;
+if (t7 >= 0x7) goto L40c2f8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40c164;
+case 1: goto L40c280;
+case 2: goto L40c2f8;
+case 3: goto L40c2f8;
+case 4: goto L40c2f8;
+case 5: goto L40c2f8;
+case 6: goto L40c2f8;
+}
+L40c164:
+at = MEM_U32(a0 + 0);
+t8 = sp + 0x2c;
+MEM_U32(t8 + 0) = at;
+t2 = MEM_U32(sp + 44);
+at = 0xff0000;
+t4 = t2 << 8;
+t5 = t4 & at;
+t3 = t2 << 24;
+t7 = t2 >> 8;
+t0 = t7 & 0xff00;
+t6 = t3 | t5;
+t9 = t6 | t0;
+t8 = t2 >> 24;
+t1 = t9 | t8;
+MEM_U32(sp + 44) = t1;
+t5 = MEM_U8(a0 + 3);
+t4 = t1 >> 28;
+t3 = t4 & 0xf;
+t7 = t5 & 0xfff0;
+t1 = t3 | t7;
+MEM_U8(a0 + 3) = (uint8_t)t1;
+t2 = MEM_U8(sp + 44);
+t4 = t1 & 0xf;
+t8 = t2 << 4;
+t5 = t8 | t4;
+MEM_U8(a0 + 3) = (uint8_t)t5;
+t3 = MEM_U8(sp + 45);
+t0 = MEM_U8(a0 + 2);
+t7 = t3 >> 4;
+t6 = t7 & 0xf;
+t2 = t0 & 0xfff0;
+t3 = t6 | t2;
+MEM_U8(a0 + 2) = (uint8_t)t3;
+t8 = MEM_U16(sp + 44);
+t7 = t3 & 0xf;
+t5 = t8 << 4;
+t0 = t5 | t7;
+MEM_U8(a0 + 2) = (uint8_t)t0;
+t6 = MEM_U16(sp + 46);
+t1 = MEM_U8(a0 + 1);
+t2 = t6 >> 12;
+t9 = t2 & 0xf;
+t8 = t1 & 0xfff0;
+t6 = t9 | t8;
+MEM_U8(a0 + 1) = (uint8_t)t6;
+t5 = MEM_U8(sp + 46);
+t2 = t6 & 0xf;
+t0 = t5 << 4;
+t1 = t0 | t2;
+MEM_U8(a0 + 1) = (uint8_t)t1;
+t9 = MEM_U8(sp + 47);
+t3 = MEM_U8(a0 + 0);
+t8 = t9 >> 2;
+t4 = t8 & 0x3f;
+t5 = t3 & 0xffc0;
+t8 = t4 | t5;
+MEM_U8(a0 + 0) = (uint8_t)t8;
+t6 = MEM_U32(sp + 44);
+t3 = t8 & 0xbf;
+t0 = t6 << 30;
+t2 = t0 >> 31;
+t1 = t2 << 6;
+t9 = t1 & 0x40;
+t2 = t9 | t3;
+MEM_U8(a0 + 0) = (uint8_t)t2;
+t7 = MEM_U32(sp + 44);
+t1 = t2 & 0x7f;
+t0 = t7 << 7;
+t8 = t0 | t1;
+MEM_U8(a0 + 0) = (uint8_t)t8;
+goto L40c328;
+L40c280:
+at = MEM_U32(a0 + 0);
+t9 = sp + 0x24;
+MEM_U32(t9 + 0) = at;
+t5 = MEM_U32(sp + 36);
+at = 0xff0000;
+t6 = t5 << 8;
+t2 = t6 & at;
+t7 = t5 << 24;
+t1 = t5 >> 8;
+t8 = t1 & 0xff00;
+t0 = t7 | t2;
+t3 = t0 | t8;
+t9 = t5 >> 24;
+t4 = t3 | t9;
+MEM_U32(sp + 36) = t4;
+v0 = MEM_U32(a0 + 0);
+t6 = t4 >> 12;
+t7 = t6 ^ v0;
+t2 = t7 << 12;
+t1 = t2 >> 12;
+t0 = t1 ^ v0;
+MEM_U32(a0 + 0) = t0;
+t5 = MEM_U32(sp + 36);
+t4 = MEM_U16(a0 + 0);
+t3 = t5 << 4;
+t9 = t3 & 0xfff0;
+t6 = t4 & 0xf;
+t7 = t9 | t6;
+MEM_U16(a0 + 0) = (uint16_t)t7;
+goto L40c328;
+L40c2f8:
+v0 = MEM_U32(a0 + 0);
+at = 0xff0000;
+t1 = v0 << 8;
+t0 = t1 & at;
+t2 = v0 << 24;
+t5 = (int)v0 >> 8;
+t3 = t5 & 0xff00;
+t8 = t2 | t0;
+t4 = t8 | t3;
+t9 = v0 >> 24;
+t6 = t4 | t9;
+MEM_U32(a0 + 0) = t6;
+L40c328:
+// bdead 11 ra = MEM_U32(sp + 28);
+L40c32c:
+// bdead 11 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void f_swap_reloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, s0 = 0, s1 = 0;
+L40c338:
+//swap_reloc:
+//nop;
+//nop;
+//nop;
+// fdead cb sp = sp + 0xffffffc0;
+//nop;
+// fdead cb MEM_U32(sp + 36) = ra;
+// fdead cb MEM_U32(sp + 28) = s1;
+// fdead cb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 600cb MEM_U32(sp + 32) = gp;
+// fdead 600cb MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 6000b gp = MEM_U32(sp + 32);
+a2 = zero;
+if ((int)s0 <= 0) goto L40c548;
+// fdead 6008b v1 = MEM_U32(sp + 64);
+t0 = 0xff0000;
+a3 = 0xff0000;
+// fdead 6038b a1 = sp + 0x30;
+L40c388:
+// fdead 6038f at = MEM_U32(v1 + 0);
+a2 = a2 + 0x1;
+// fdead 6038f MEM_U32(a1 + 0) = at;
+// fdead 6038f t7 = MEM_U32(v1 + 4);
+//nop;
+// fdead 6038f MEM_U32(a1 + 4) = t7;
+// fdead 6038f t8 = MEM_U32(sp + 48);
+//nop;
+// fdead 6038f t1 = t8 << 8;
+// fdead 6038f t2 = t1 & t0;
+// fdead 6038f t9 = t8 << 24;
+// fdead 6038f t4 = (int)t8 >> 8;
+// fdead 6038f t5 = t4 & 0xff00;
+// fdead 6038f t3 = t9 | t2;
+// fdead 6038f t6 = t3 | t5;
+// fdead 6038f t1 = t8 >> 24;
+// fdead 6038f t9 = t6 | t1;
+// fdead 6038f MEM_U32(sp + 48) = t9;
+if (s1 != v0) goto L40c48c;
+// fdead 6038f at = MEM_U32(a1 + 0);
+//nop;
+// fdead 6038f MEM_U32(v1 + 0) = at;
+// fdead 6038f t8 = MEM_U32(a1 + 4);
+at = 0xff0000;
+// fdead 6038f MEM_U32(v1 + 4) = t8;
+// fdead 6038f t4 = MEM_U32(sp + 52);
+at = at | 0xffff;
+// fdead 6038f t5 = t4 << 8;
+// fdead 6038f t7 = t5 & a3;
+// fdead 6038f t3 = t4 << 24;
+// fdead 6038f t1 = t4 >> 8;
+// fdead 6038f t9 = t1 & 0xff00;
+// fdead 6038f t6 = t3 | t7;
+// fdead 6038f t2 = t6 | t9;
+// fdead 6038f t8 = t4 >> 24;
+// fdead 6038f t5 = t2 | t8;
+// fdead 6038f MEM_U32(sp + 52) = t5;
+// fdead 6038f t1 = MEM_U8(v1 + 7);
+// fdead 6038f t3 = t5 >> 31;
+// fdead 6038f t7 = t3 & 0x1;
+// fdead 6038f t6 = t1 & 0xfffe;
+// fdead 6038f t1 = t7 | t6;
+// fdead 6038f MEM_U8(v1 + 7) = (uint8_t)t1;
+// fdead 6038f t4 = MEM_U32(sp + 52);
+// fdead 6038f t7 = t1 & 0xc1;
+// fdead 6038f t2 = t4 << 1;
+// fdead 6038f t8 = t2 >> 28;
+// fdead 6038f t5 = t8 << 1;
+// fdead 6038f t3 = t5 & 0x3e;
+// fdead 6038f t1 = t3 | t7;
+// fdead 6038f MEM_U8(v1 + 7) = (uint8_t)t1;
+// fdead 6038f t2 = MEM_U8(sp + 52);
+// fdead 6038f t3 = t1 & 0x3f;
+// fdead 6038f t5 = t2 << 6;
+// fdead 6038f t7 = t5 | t3;
+// fdead 6038f MEM_U8(v1 + 7) = (uint8_t)t7;
+// fdead 6038f a0 = MEM_U32(v1 + 4);
+// fdead 6038f t6 = MEM_U32(sp + 52);
+// fdead 6038f t4 = a0 >> 8;
+// fdead 6038f t9 = t6 & at;
+// fdead 6038f t2 = t9 ^ t4;
+// fdead 6038f t8 = t2 << 8;
+// fdead 6038f t1 = t8 ^ a0;
+// fdead 6038f MEM_U32(v1 + 4) = t1;
+goto L40c540;
+L40c48c:
+// fdead 6038f t3 = MEM_U32(v1 + 4);
+// fdead 6038f t9 = MEM_U8(sp + 52);
+// fdead 6038f t6 = t3 << 7;
+// fdead 6038f t4 = t9 & 0xff7f;
+// fdead 6038f t2 = t6 | t4;
+// fdead 6038f MEM_U8(sp + 52) = (uint8_t)t2;
+// fdead 6038f t8 = MEM_U32(v1 + 4);
+// fdead 6038f t6 = t2;
+// fdead 6038f t1 = t8 << 26;
+// fdead 6038f t3 = t1 >> 27;
+// fdead 6038f t7 = t3 << 3;
+// fdead 6038f t9 = t7 & 0x78;
+// fdead 6038f t4 = t6 & 0x87;
+// fdead 6038f t7 = t9 | t4;
+// fdead 6038f MEM_U8(sp + 52) = (uint8_t)t7;
+// fdead 6038f t1 = MEM_U8(v1 + 7);
+// fdead 6038f t2 = t7 & 0xf8;
+// fdead 6038f t5 = t1 >> 6;
+// fdead 6038f t3 = t5 & 0x7;
+// fdead 6038f t6 = t3 | t2;
+// fdead 6038f MEM_U8(sp + 52) = (uint8_t)t6;
+// fdead 6038f t9 = MEM_U32(v1 + 4);
+// fdead 6038f t1 = MEM_U32(sp + 52);
+// fdead 6038f t4 = t9 >> 8;
+// fdead 6038f t5 = t4 ^ t1;
+// fdead 6038f t8 = t5 << 8;
+// fdead 6038f t7 = t8 >> 8;
+// fdead 6038f t3 = t7 ^ t1;
+// fdead 6038f t6 = t3 << 8;
+// fdead 6038f t9 = t6 & a3;
+// fdead 6038f t2 = t3 << 24;
+// fdead 6038f t5 = t3 >> 8;
+// fdead 6038f t8 = t5 & 0xff00;
+// fdead 6038f t4 = t2 | t9;
+// fdead 6038f t7 = t4 | t8;
+// fdead 6038f t1 = t3 >> 24;
+// fdead 6038f MEM_U32(sp + 52) = t3;
+// fdead 6038f t6 = t7 | t1;
+// fdead 6038f MEM_U32(sp + 52) = t6;
+// fdead 6038f at = MEM_U32(a1 + 0);
+//nop;
+// fdead 6038f MEM_U32(v1 + 0) = at;
+// fdead 6038f t5 = MEM_U32(a1 + 4);
+//nop;
+// fdead 6038f MEM_U32(v1 + 4) = t5;
+L40c540:
+// fdead 6038f v1 = v1 + 0x8;
+if (a2 != s0) goto L40c388;
+L40c548:
+// fdead 6038f ra = MEM_U32(sp + 36);
+// fdead 6038f s0 = MEM_U32(sp + 24);
+// fdead 6038f s1 = MEM_U32(sp + 28);
+// fdead 6038f sp = sp + 0x40;
+return;
+}
+
+static void f_swap_dynamic(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c658:
+//swap_dynamic:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+at = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & at;
+t6 = v0 << 24;
+t0 = (int)v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+a1 = 0xff0000;
+t7 = v1 << 8;
+t6 = t7 & a1;
+t3 = v0 >> 24;
+t0 = v1 >> 8;
+t5 = v1 << 24;
+t4 = t2 | t3;
+t8 = t5 | t6;
+t9 = t0 & 0xff00;
+t1 = t8 | t9;
+t2 = v1 >> 24;
+t3 = t1 | t2;
+MEM_U32(a0 + 0) = t4;
+t7 = t3 << 8;
+t5 = t7 & a1;
+t4 = t3 << 24;
+t0 = t3 >> 8;
+t8 = t0 & 0xff00;
+t6 = t4 | t5;
+t9 = t6 | t8;
+t1 = t3 >> 24;
+MEM_U32(a0 + 4) = t3;
+t2 = t9 | t1;
+MEM_U32(a0 + 4) = t2;
+return;
+}
+
+static void f_swap_rel_dyn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c6e8:
+//swap_rel_dyn:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+a1 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a1;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+t7 = v1 << 8;
+t6 = t7 & a1;
+t3 = v0 >> 24;
+t0 = v1 >> 8;
+t5 = v1 << 24;
+t4 = t2 | t3;
+t8 = t5 | t6;
+t9 = t0 & 0xff00;
+t1 = t8 | t9;
+t2 = v1 >> 24;
+t3 = t1 | t2;
+MEM_U32(a0 + 0) = t4;
+MEM_U32(a0 + 4) = t3;
+return;
+}
+
+static void f_swap_reginfo(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c74c:
+//swap_reginfo:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+a3 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a3;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+t3 = v0 >> 24;
+t4 = t2 | t3;
+a1 = MEM_U32(a0 + 8);
+t8 = v1 << 8;
+t7 = v1 << 24;
+t5 = v1 >> 24;
+t6 = t5 | t7;
+t0 = t8 & a3;
+t1 = v1 >> 8;
+MEM_U32(a0 + 0) = t4;
+t2 = t1 & 0xff00;
+t9 = t6 | t0;
+a2 = MEM_U32(a0 + 12);
+t3 = t9 | t2;
+t4 = a1 >> 24;
+t5 = a1 << 24;
+t7 = t4 | t5;
+t8 = a1 << 8;
+MEM_U32(a0 + 4) = t3;
+t6 = t8 & a3;
+t1 = a1 >> 8;
+v0 = MEM_U32(a0 + 16);
+t9 = t1 & 0xff00;
+t0 = t7 | t6;
+t3 = a2 >> 24;
+t4 = a2 << 24;
+t2 = t0 | t9;
+t5 = t3 | t4;
+t8 = a2 << 8;
+MEM_U32(a0 + 8) = t2;
+t7 = t8 & a3;
+t6 = t5 | t7;
+t1 = a2 >> 8;
+t2 = v0 >> 24;
+t3 = v0 << 24;
+v1 = MEM_U32(a0 + 20);
+t0 = t1 & 0xff00;
+t4 = t2 | t3;
+t8 = v0 << 8;
+t9 = t6 | t0;
+t5 = t8 & a3;
+t7 = t4 | t5;
+MEM_U32(a0 + 12) = t9;
+at = 0xff0000;
+t1 = v0 >> 8;
+t2 = v1 << 8;
+t6 = t1 & 0xff00;
+t3 = t2 & at;
+t9 = v1 << 24;
+t4 = (int)v1 >> 8;
+t0 = t7 | t6;
+t5 = t4 & 0xff00;
+t8 = t9 | t3;
+t1 = t8 | t5;
+t7 = v1 >> 24;
+t6 = t1 | t7;
+MEM_U32(a0 + 16) = t0;
+MEM_U32(a0 + 20) = t6;
+return;
+}
+
+static void f_swap_dynsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c864:
+//swap_dynsym:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+a3 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a3;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+t7 = v1 << 8;
+t6 = t7 & a3;
+t3 = v0 >> 24;
+t0 = v1 >> 8;
+t5 = v1 << 24;
+t4 = t2 | t3;
+t8 = t5 | t6;
+t9 = t0 & 0xff00;
+a1 = MEM_U32(a0 + 8);
+t1 = t8 | t9;
+t2 = v1 >> 24;
+t3 = t1 | t2;
+MEM_U32(a0 + 0) = t4;
+MEM_U32(a0 + 4) = t3;
+t7 = a1 << 8;
+t3 = MEM_U16(a0 + 14);
+t5 = t7 & a3;
+t4 = a1 << 24;
+t6 = t4 | t5;
+t0 = a1 >> 8;
+t8 = t0 & 0xff00;
+t9 = t6 | t8;
+t1 = a1 >> 24;
+t4 = t3 >> 8;
+t7 = t3 << 8;
+t2 = t9 | t1;
+t5 = t7 | t4;
+MEM_U32(a0 + 8) = t2;
+MEM_U16(a0 + 14) = (uint16_t)t5;
+return;
+}
+
+static void f_swap_conflict(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40c908:
+//swap_conflict:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+at = 0xff0000;
+t6 = v0 >> 24;
+t7 = v0 << 24;
+t9 = v0 << 8;
+t0 = t9 & at;
+t8 = t6 | t7;
+t2 = v0 >> 8;
+t3 = t2 & 0xff00;
+t1 = t8 | t0;
+t4 = t1 | t3;
+MEM_U32(a0 + 0) = t4;
+return;
+}
+
+static void f_swap_liblist(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c978:
+//swap_liblist:
+MEM_U32(sp + 4) = a1;
+v0 = MEM_U32(a0 + 0);
+a3 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a3;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+t3 = v0 >> 24;
+t7 = v1 << 8;
+a1 = MEM_U32(a0 + 8);
+t4 = t2 | t3;
+t6 = t7 & a3;
+t5 = v1 << 24;
+t8 = t5 | t6;
+t0 = v1 >> 8;
+MEM_U32(a0 + 0) = t4;
+t9 = t0 & 0xff00;
+t7 = a1 << 8;
+a2 = MEM_U32(a0 + 12);
+t1 = t8 | t9;
+t5 = t7 & a3;
+t2 = v1 >> 24;
+t4 = a1 << 24;
+t3 = t1 | t2;
+t6 = t4 | t5;
+t0 = a1 >> 8;
+t8 = t0 & 0xff00;
+MEM_U32(a0 + 4) = t3;
+t9 = t6 | t8;
+t7 = a2 << 8;
+v0 = MEM_U32(a0 + 16);
+t4 = t7 & a3;
+t1 = a1 >> 24;
+t3 = a2 << 24;
+t0 = a2 >> 8;
+t2 = t9 | t1;
+t6 = t0 & 0xff00;
+t5 = t3 | t4;
+t8 = t5 | t6;
+MEM_U32(a0 + 8) = t2;
+t7 = v0 << 8;
+t3 = t7 & a3;
+t9 = a2 >> 24;
+t2 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t8 | t9;
+t5 = t0 & 0xff00;
+t4 = t2 | t3;
+t6 = t4 | t5;
+t8 = v0 >> 24;
+t9 = t6 | t8;
+MEM_U32(a0 + 12) = t1;
+MEM_U32(a0 + 16) = t9;
+return;
+}
+
+static void f_swap_ehdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40cac4:
+//swap_ehdr:
+v0 = MEM_U16(a0 + 16);
+v1 = MEM_U16(a0 + 18);
+a1 = MEM_U32(a0 + 20);
+t7 = v0 << 8;
+t8 = v0 >> 8;
+t9 = t7 | t8;
+t3 = v1 << 8;
+t4 = v1 >> 8;
+t5 = t3 | t4;
+t1 = 0xff0000;
+t7 = a1 << 8;
+MEM_U16(a0 + 16) = (uint16_t)t9;
+t8 = t7 & t1;
+t6 = a1 << 24;
+t2 = a1 >> 8;
+a2 = MEM_U32(a0 + 24);
+MEM_U16(a0 + 18) = (uint16_t)t5;
+t3 = t2 & 0xff00;
+t9 = t6 | t8;
+t4 = t9 | t3;
+t5 = a1 >> 24;
+t7 = t4 | t5;
+t8 = a2 << 8;
+t2 = t8 & t1;
+t3 = a2 >> 8;
+t6 = a2 << 24;
+a3 = MEM_U32(a0 + 28);
+MEM_U32(a0 + 20) = t7;
+t9 = t6 | t2;
+t4 = t3 & 0xff00;
+t5 = t9 | t4;
+t7 = a2 >> 24;
+t8 = t5 | t7;
+t2 = a3 << 8;
+t3 = t2 & t1;
+t4 = a3 >> 8;
+t6 = a3 << 24;
+v0 = MEM_U32(a0 + 32);
+MEM_U32(a0 + 24) = t8;
+t9 = t6 | t3;
+t5 = t4 & 0xff00;
+t7 = t9 | t5;
+t8 = a3 >> 24;
+t2 = t7 | t8;
+t3 = v0 << 8;
+t4 = t3 & t1;
+t5 = v0 >> 8;
+t6 = v0 << 24;
+v1 = MEM_U32(a0 + 36);
+MEM_U32(a0 + 28) = t2;
+t9 = t6 | t4;
+t7 = t5 & 0xff00;
+t8 = t9 | t7;
+t2 = v0 >> 24;
+t3 = t8 | t2;
+t4 = v1 << 8;
+t5 = t4 & t1;
+t7 = v1 >> 8;
+t6 = v1 << 24;
+MEM_U32(a0 + 32) = t3;
+t9 = t6 | t5;
+t8 = t7 & 0xff00;
+t2 = t9 | t8;
+t3 = v1 >> 24;
+a1 = MEM_U16(a0 + 40);
+a2 = MEM_U16(a0 + 42);
+t4 = t2 | t3;
+MEM_U32(a0 + 36) = t4;
+t5 = a1 << 8;
+t7 = a1 >> 8;
+t3 = a2 >> 8;
+t2 = a2 << 8;
+a3 = MEM_U16(a0 + 44);
+t0 = MEM_U16(a0 + 46);
+t9 = t5 | t7;
+t4 = t2 | t3;
+MEM_U16(a0 + 40) = (uint16_t)t9;
+MEM_U16(a0 + 42) = (uint16_t)t4;
+t7 = a3 >> 8;
+t5 = a3 << 8;
+t3 = t0 >> 8;
+t2 = t0 << 8;
+v0 = MEM_U16(a0 + 48);
+t8 = MEM_U16(a0 + 50);
+t9 = t5 | t7;
+t4 = t2 | t3;
+t6 = v0 & 0xff;
+MEM_U16(a0 + 44) = (uint16_t)t9;
+MEM_U16(a0 + 46) = (uint16_t)t4;
+t5 = t6 << 8;
+t7 = v0 >> 8;
+t3 = t8 >> 8;
+t2 = t8 << 8;
+t9 = t5 | t7;
+t4 = t2 | t3;
+MEM_U16(a0 + 48) = (uint16_t)t9;
+MEM_U16(a0 + 50) = (uint16_t)t4;
+return;
+}
+
+static void f_swap_phdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40cc4c:
+//swap_phdr:
+v0 = MEM_U32(a0 + 0);
+a3 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a3;
+t6 = v0 << 24;
+t9 = t6 | t8;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t2 = t9 | t1;
+t3 = v0 >> 24;
+t7 = v1 << 8;
+a1 = MEM_U32(a0 + 8);
+t4 = t2 | t3;
+t6 = t7 & a3;
+t0 = v1 >> 8;
+t5 = v1 << 24;
+t8 = t5 | t6;
+t9 = t0 & 0xff00;
+t1 = t8 | t9;
+MEM_U32(a0 + 0) = t4;
+t2 = v1 >> 24;
+t7 = a1 << 8;
+a2 = MEM_U32(a0 + 12);
+t3 = t1 | t2;
+t5 = t7 & a3;
+t4 = a1 << 24;
+t0 = a1 >> 8;
+t8 = t0 & 0xff00;
+t6 = t4 | t5;
+t9 = t6 | t8;
+t1 = a1 >> 24;
+MEM_U32(a0 + 4) = t3;
+t2 = t9 | t1;
+t7 = a2 << 8;
+v0 = MEM_U32(a0 + 16);
+t4 = t7 & a3;
+t3 = a2 << 24;
+t0 = a2 >> 8;
+t6 = t0 & 0xff00;
+t5 = t3 | t4;
+MEM_U32(a0 + 8) = t2;
+t8 = t5 | t6;
+t9 = a2 >> 24;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 20);
+t1 = t8 | t9;
+t3 = t7 & a3;
+t2 = v0 << 24;
+t4 = t2 | t3;
+t0 = v0 >> 8;
+MEM_U32(a0 + 12) = t1;
+t5 = t0 & 0xff00;
+t7 = v1 << 8;
+a1 = MEM_U32(a0 + 24);
+t6 = t4 | t5;
+t2 = t7 & a3;
+t8 = v0 >> 24;
+t1 = v1 << 24;
+t9 = t6 | t8;
+t3 = t1 | t2;
+t0 = v1 >> 8;
+t4 = t0 & 0xff00;
+MEM_U32(a0 + 16) = t9;
+t5 = t3 | t4;
+t7 = a1 << 8;
+a2 = MEM_U32(a0 + 28);
+t1 = t7 & a3;
+t6 = v1 >> 24;
+t9 = a1 << 24;
+t0 = a1 >> 8;
+t8 = t5 | t6;
+t3 = t0 & 0xff00;
+t2 = t9 | t1;
+t4 = t2 | t3;
+MEM_U32(a0 + 20) = t8;
+t7 = a2 << 8;
+t9 = t7 & a3;
+t5 = a1 >> 24;
+t8 = a2 << 24;
+t0 = a2 >> 8;
+t6 = t4 | t5;
+t2 = t0 & 0xff00;
+t1 = t8 | t9;
+t3 = t1 | t2;
+t4 = a2 >> 24;
+t5 = t3 | t4;
+MEM_U32(a0 + 24) = t6;
+MEM_U32(a0 + 28) = t5;
+return;
+}
+
+static void f_swap_shdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40cdb4:
+//swap_shdr:
+v0 = MEM_U32(a0 + 0);
+a3 = 0xff0000;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 4);
+t8 = t7 & a3;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+t3 = v0 >> 24;
+t4 = t2 | t3;
+t7 = v1 << 8;
+a1 = MEM_U32(a0 + 8);
+t6 = t7 & a3;
+t0 = v1 >> 8;
+t5 = v1 << 24;
+t8 = t5 | t6;
+t9 = t0 & 0xff00;
+MEM_U32(a0 + 0) = t4;
+t1 = t8 | t9;
+t2 = v1 >> 24;
+t7 = a1 << 8;
+a2 = MEM_U32(a0 + 12);
+t3 = t1 | t2;
+t5 = t7 & a3;
+t4 = a1 << 24;
+t6 = t4 | t5;
+t0 = a1 >> 8;
+t8 = t0 & 0xff00;
+MEM_U32(a0 + 4) = t3;
+t9 = t6 | t8;
+t1 = a1 >> 24;
+t7 = a2 << 8;
+v0 = MEM_U32(a0 + 16);
+t2 = t9 | t1;
+t4 = t7 & a3;
+t3 = a2 << 24;
+t0 = a2 >> 8;
+t6 = t0 & 0xff00;
+t5 = t3 | t4;
+t8 = t5 | t6;
+MEM_U32(a0 + 8) = t2;
+t9 = a2 >> 24;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 20);
+t1 = t8 | t9;
+t3 = t7 & a3;
+t2 = v0 << 24;
+t0 = v0 >> 8;
+t5 = t0 & 0xff00;
+t4 = t2 | t3;
+t6 = t4 | t5;
+t8 = v0 >> 24;
+MEM_U32(a0 + 12) = t1;
+t9 = t6 | t8;
+t7 = v1 << 8;
+a1 = MEM_U32(a0 + 24);
+t2 = t7 & a3;
+t1 = v1 << 24;
+t0 = v1 >> 8;
+t4 = t0 & 0xff00;
+t3 = t1 | t2;
+MEM_U32(a0 + 16) = t9;
+t5 = t3 | t4;
+t6 = v1 >> 24;
+t7 = a1 << 8;
+a2 = MEM_U32(a0 + 28);
+t8 = t5 | t6;
+t1 = t7 & a3;
+t9 = a1 << 24;
+t2 = t9 | t1;
+t0 = a1 >> 8;
+MEM_U32(a0 + 20) = t8;
+t3 = t0 & 0xff00;
+t7 = a2 << 8;
+v0 = MEM_U32(a0 + 32);
+t4 = t2 | t3;
+t9 = t7 & a3;
+t5 = a1 >> 24;
+t8 = a2 << 24;
+t6 = t4 | t5;
+t1 = t8 | t9;
+t0 = a2 >> 8;
+t2 = t0 & 0xff00;
+MEM_U32(a0 + 24) = t6;
+t3 = t1 | t2;
+t7 = v0 << 8;
+v1 = MEM_U32(a0 + 36);
+t8 = t7 & a3;
+t4 = a2 >> 24;
+t6 = v0 << 24;
+t0 = v0 >> 8;
+t5 = t3 | t4;
+t1 = t0 & 0xff00;
+t9 = t6 | t8;
+t2 = t9 | t1;
+MEM_U32(a0 + 28) = t5;
+t7 = v1 << 8;
+t6 = t7 & a3;
+t3 = v0 >> 24;
+t5 = v1 << 24;
+t0 = v1 >> 8;
+t4 = t2 | t3;
+t9 = t0 & 0xff00;
+t8 = t5 | t6;
+t1 = t8 | t9;
+t2 = v1 >> 24;
+t3 = t1 | t2;
+MEM_U32(a0 + 32) = t4;
+MEM_U32(a0 + 36) = t3;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L40cf80:
+//gethostsex:
+sp = sp + 0xfffffff8;
+t6 = 0x1;
+MEM_U32(sp + 4) = t6;
+t7 = MEM_S8(sp + 4);
+at = 0x1;
+v0 = zero;
+if (t7 != at) goto L40cfa4;
+v0 = 0x1;
+goto L40cfa4;
+L40cfa4:
+// bdead 19 sp = sp + 0x8;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t func_40cfb4(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0;
+L40cfb4:
+//nop;
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffd8;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// fdead b gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b a1 = MEM_U32(sp + 40);
+//nop;
+// fdead b MEM_U32(sp + 36) = v0;
+a0 = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b v0 = MEM_U32(sp + 36);
+// fdead b sp = sp + 0x28;
+return v0;
+// fdead 0 v1 = MEM_U32(a0 + 4);
+// fdead 0 a2 = MEM_U32(a1 + 4);
+//nop;
+// fdead 0 at = v1 < a2;
+// fdead 0 v0 = a2 ^ v1;
+if (at == 0) goto L40d03c;
+v0 = 0xffffffff;
+return v0;
+L40d03c:
+// fdead 0 v0 = zero < v0;
+//nop;
+return v0;
+//nop;
+return v0;
+}
+
+static void f_change_fortran_names(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, t1 = 0, t2 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, t9 = 0,
+hi = 0;
+L40d050:
+//change_fortran_names:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffc8;
+// fdead b MEM_U32(sp + 52) = ra;
+// fdead b MEM_U32(sp + 48) = gp;
+// fdead b MEM_U32(sp + 44) = s6;
+// fdead b MEM_U32(sp + 40) = s5;
+// fdead b MEM_U32(sp + 36) = s4;
+// fdead b MEM_U32(sp + 32) = s3;
+// fdead b MEM_U32(sp + 28) = s2;
+// fdead b MEM_U32(sp + 24) = s1;
+// fdead b MEM_U32(sp + 20) = s0;
+// fdead b v0 = MEM_U32(a0 + 156);
+// fdead b s2 = a0;
+s4 = zero;
+if (v0 == 0) goto L40d294;
+// fdead 20000b s1 = MEM_U32(a0 + 208);
+t6 = MEM_U32(v0 + 72);
+s6 = 0x2;
+// fdead a0800b t7 = s1 + t6;
+// fdead a0800b at = s1 < t7;
+s5 = 0x48;
+if (at == 0) goto L40d1a4;
+s3 = 0x5f;
+L40d0b4:
+//nop;
+// fdead f0c01b a0 = s2;
+// fdead f0c01b a1 = s1;
+v0 = f_file_lang(mem, sp, a0, a1);
+// fdead f0000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != s6) goto L40d184;
+//nop;
+// fdead f0000b a0 = s2;
+// fdead f0000b a1 = s1;
+v0 = f_file_string_base(mem, sp, a0, a1);
+// fdead f0000b t1 = MEM_U32(s2 + 208);
+// fdead f0000b t9 = s1 << 3;
+// fdead f0000b lo = t1 * s5;
+hi = (uint32_t)((uint64_t)t1 * (uint64_t)s5 >> 32);
+// fdead f0000b t8 = MEM_U32(s2 + 160);
+// fdead f0000b t9 = t9 + s1;
+// fdead f0000b t9 = t9 << 3;
+// fdead f0000b t0 = t8 + t9;
+// fdead f0000b gp = MEM_U32(sp + 48);
+v1 = v0;
+v0 = v0 - v0;
+s4 = s4 + 0x1;
+// fdead f0001b t2 = lo;
+// fdead f0001b t3 = -t2;
+// fdead f0001b t4 = t0 + t3;
+// fdead f0001b a0 = MEM_U32(t4 + 12);
+//nop;
+//nop;
+if ((int)a0 <= 0) goto L40d184;
+L40d128:
+t5 = MEM_S8(v1 + 0);
+v0 = v0 + 0x1;
+// fdead f0c01b at = (int)v0 < (int)a0;
+if (s3 != t5) goto L40d17c;
+t6 = MEM_S8(v1 + 1);
+// fdead f0c01b t8 = s1 << 3;
+// fdead f0c01b t8 = t8 + s1;
+if (t6 != 0) goto L40d178;
+MEM_U8(v1 + 0) = (uint8_t)zero;
+// fdead f0c01b t1 = MEM_U32(s2 + 208);
+// fdead f0c01b t7 = MEM_U32(s2 + 160);
+// fdead f0c01b t2 = t1 << 3;
+// fdead f0c01b t2 = t2 + t1;
+// fdead f0c01b t2 = t2 << 3;
+// fdead f0c01b t8 = t8 << 3;
+// fdead f0c01b t0 = -t2;
+// fdead f0c01b t9 = t7 + t8;
+// fdead f0c01b t3 = t9 + t0;
+// fdead f0c01b a0 = MEM_U32(t3 + 12);
+//nop;
+L40d178:
+// fdead f0c01b at = (int)v0 < (int)a0;
+L40d17c:
+v1 = v1 + 0x1;
+if (at != 0) goto L40d128;
+L40d184:
+// fdead f0c01b v0 = MEM_U32(s2 + 156);
+// fdead f0c01b t4 = MEM_U32(s2 + 208);
+t5 = MEM_U32(v0 + 72);
+// fdead f0c01b s1 = s1 + 0x1;
+// fdead f0c01b t6 = t4 + t5;
+// fdead f0c01b at = s1 < t6;
+//nop;
+if (at != 0) goto L40d0b4;
+L40d1a4:
+s3 = 0x5f;
+s6 = 0x2;
+if (s4 == 0) goto L40d294;
+// fdead f0c01b s1 = MEM_U32(s2 + 216);
+t7 = MEM_U32(v0 + 88);
+//nop;
+// fdead f1c01b t8 = s1 + t7;
+// fdead f1c01b at = s1 < t8;
+// fdead f1c01b ra = MEM_U32(sp + 52);
+if (at == 0) goto L40d298;
+s4 = 0x10000be0;
+//nop;
+s4 = s4;
+L40d1d8:
+//nop;
+// fdead 4f3cc1b a0 = s2;
+// fdead 4f3cc1b a1 = s1;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+// fdead f2001b gp = MEM_U32(sp + 48);
+// fdead f2001b a0 = s2;
+//nop;
+a1 = v0;
+//nop;
+v0 = f_file_lang(mem, sp, a0, a1);
+// fdead f2000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 != s6) goto L40d274;
+//nop;
+// fdead f2000b a0 = s2;
+// fdead f2000b a1 = s1;
+v0 = f_symbol_name(mem, sp, a0, a1);
+// fdead f2001b gp = MEM_U32(sp + 48);
+s0 = v0;
+//nop;
+a0 = v0;
+a1 = s4;
+v0 = wrapper_strcmp(mem, a0, a1);
+// fdead f2000b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L40d274;
+t1 = MEM_S8(s0 + 0);
+//nop;
+//nop;
+if (t1 == 0) goto L40d260;
+L40d250:
+t2 = MEM_S8(s0 + 1);
+s0 = s0 + 0x1;
+//nop;
+if (t2 != 0) goto L40d250;
+L40d260:
+t9 = MEM_S8(s0 + -1);
+s0 = s0 + 0xffffffff;
+//nop;
+if (s3 != t9) goto L40d274;
+MEM_U8(s0 + 0) = (uint8_t)zero;
+L40d274:
+// fdead 4f20c0b t3 = MEM_U32(s2 + 156);
+// fdead 4f20c0b t0 = MEM_U32(s2 + 216);
+// fdead 4f20c0b t4 = MEM_U32(t3 + 88);
+// fdead 4f20c0b s1 = s1 + 0x1;
+// fdead 4f20c0b t5 = t0 + t4;
+// fdead 4f20c0b at = s1 < t5;
+//nop;
+if (at != 0) goto L40d1d8;
+L40d294:
+// fdead 4f2cc1b ra = MEM_U32(sp + 52);
+L40d298:
+// fdead 4f3cc1b s0 = MEM_U32(sp + 20);
+// fdead 4f3cc1b s1 = MEM_U32(sp + 24);
+// fdead 4f3cc1b s2 = MEM_U32(sp + 28);
+// fdead 4f3cc1b s3 = MEM_U32(sp + 32);
+// fdead 4f3cc1b s4 = MEM_U32(sp + 36);
+// fdead 4f3cc1b s5 = MEM_U32(sp + 40);
+// fdead 4f3cc1b s6 = MEM_U32(sp + 44);
+// fdead 4f3cc1b sp = sp + 0x38;
+return;
+}
+
+static uint32_t f_obj_init(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+uint64_t temp64;
+L40d754:
+//obj_init:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff60;
+// fdead 4000006b MEM_U32(sp + 52) = ra;
+// fdead 4000006b MEM_U32(sp + 48) = gp;
+// fdead 4000006b MEM_U32(sp + 44) = s5;
+// fdead 4000006b MEM_U32(sp + 40) = s4;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 128) = zero;
+t6 = 0x1;
+MEM_U32(a0 + 472) = t6;
+//nop;
+s0 = a1;
+s4 = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+MEM_U32(s4 + 384) = s0;
+//nop;
+s3 = v0;
+a0 = s4;
+f_dumpobj_struct(mem, sp, a0);
+s2 = MEM_U32(s4 + 196);
+// bdead 60040380013 gp = MEM_U32(sp + 48);
+t7 = MEM_U8(s2 + 0);
+at = 0x7f;
+t9 = 0x2;
+if (t7 != at) goto L40dd3c;
+t8 = MEM_U8(s2 + 1);
+at = 0x45;
+t9 = 0x2;
+if (t8 != at) goto L40dd3c;
+t9 = MEM_U8(s2 + 2);
+at = 0x4c;
+//nop;
+if (t9 != at) goto L40dd38;
+t1 = MEM_U8(s2 + 3);
+at = 0x46;
+t2 = 0x3;
+if (t1 != at) goto L40dd38;
+MEM_U32(s4 + 140) = t2;
+a0 = MEM_S8(s2 + 5);
+v0 = a0 ^ 0x2;
+if (s3 != 0) goto L40d81c;
+v0 = v0 < 0x1;
+v1 = v0 < 0x1;
+if (v1 == 0) {
+v0 = s3 ^ 0x1;
+goto L40d83c;}
+L40d81c:
+v0 = s3 ^ 0x1;
+v0 = v0 < 0x1;
+v1 = v0 < 0x1;
+//nop;
+if (v1 != 0) goto L40d83c;
+v1 = a0 ^ 0x1;
+v1 = v1 < 0x1;
+v1 = v1 < 0x1;
+L40d83c:
+s0 = v1;
+if (v1 == 0) goto L40d860;
+//nop;
+a0 = s2;
+//nop;
+f_swap_ehdr(mem, sp, a0);
+// bdead 60040320003 gp = MEM_U32(sp + 48);
+s2 = MEM_U32(s4 + 196);
+//nop;
+L40d860:
+MEM_U32(s4 + 224) = s2;
+t3 = MEM_U8(s2 + 4);
+at = 0x1;
+v1 = s2;
+a3 = s2;
+if (t3 == at) goto L40d880;
+v0 = zero;
+goto L40e414;
+L40d880:
+MEM_U32(sp + 80) = a3;
+if (s0 == 0) goto L40d8bc;
+MEM_U32(sp + 80) = a3;
+t4 = MEM_U32(v1 + 28);
+//nop;
+//nop;
+if (t4 == 0) goto L40d8bc;
+t5 = MEM_U32(s2 + 28);
+//nop;
+MEM_U32(sp + 80) = a3;
+a0 = t5 + s2;
+f_swap_phdr(mem, sp, a0);
+// bdead 60040320003 gp = MEM_U32(sp + 48);
+s2 = MEM_U32(s4 + 196);
+//nop;
+L40d8bc:
+t6 = MEM_U32(s2 + 28);
+a3 = MEM_U32(sp + 80);
+v1 = t6 + s2;
+MEM_U32(s4 + 228) = v1;
+MEM_U32(sp + 84) = v1;
+if (s0 == 0) goto L40db5c;
+MEM_U32(sp + 80) = a3;
+t7 = MEM_U32(a3 + 32);
+//nop;
+//nop;
+if (t7 == 0) goto L40db5c;
+MEM_U32(sp + 80) = a3;
+t8 = MEM_U16(a3 + 48);
+s5 = zero;
+//nop;
+if (t8 == 0) goto L40db5c;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 80) = a3;
+a3 = MEM_U32(sp + 80);
+L40d908:
+t9 = MEM_U32(s4 + 196);
+t1 = MEM_U32(a3 + 32);
+v0 = MEM_U32(sp + 60);
+t2 = t9 + t1;
+//nop;
+a0 = t2 + v0;
+MEM_U32(sp + 112) = a0;
+f_swap_shdr(mem, sp, a0);
+a0 = MEM_U32(sp + 112);
+// bdead 60040700023 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(a0 + 4);
+at = 0x9;
+s0 = zero;
+if (v1 != at) goto L40d984;
+s2 = MEM_U32(a0 + 20);
+t3 = MEM_U32(s4 + 196);
+t4 = MEM_U32(a0 + 16);
+t5 = s2 >> 3;
+s2 = t5;
+s1 = t3 + t4;
+if ((int)t5 <= 0) goto L40db38;
+L40d95c:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_rel_dyn(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x8;
+if (s0 != s2) goto L40d95c;
+t3 = MEM_U32(sp + 60);
+goto L40db3c;
+L40d984:
+at = 0x2;
+s0 = zero;
+if (v1 == at) goto L40d99c;
+at = 0xb;
+if (v1 != at) {
+at = 0x70000000;
+goto L40d9e4;}
+at = 0x70000000;
+L40d99c:
+s2 = MEM_U32(a0 + 20);
+t6 = MEM_U32(s4 + 196);
+t7 = MEM_U32(a0 + 16);
+t8 = s2 >> 4;
+s2 = t8;
+s1 = t6 + t7;
+if ((int)t8 <= 0) goto L40db38;
+L40d9b8:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_dynsym(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x10;
+if (s0 != s2) goto L40d9b8;
+t3 = MEM_U32(sp + 60);
+goto L40db3c;
+at = 0x70000000;
+L40d9e4:
+at = at | 0x6;
+if (v1 != at) {
+at = 0x6;
+goto L40da44;}
+at = 0x6;
+s2 = MEM_U32(a0 + 20);
+at = 0x18;
+lo = s2 / at; hi = s2 % at;
+t9 = MEM_U32(s4 + 196);
+t1 = MEM_U32(a0 + 16);
+s0 = zero;
+s1 = t9 + t1;
+s2 = lo;
+t3 = MEM_U32(sp + 60);
+if ((int)s2 <= 0) goto L40db3c;
+L40da18:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_reginfo(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x18;
+if (s0 != s2) goto L40da18;
+t3 = MEM_U32(sp + 60);
+goto L40db3c;
+at = 0x6;
+L40da44:
+s0 = zero;
+if (v1 != at) goto L40da90;
+s2 = MEM_U32(a0 + 20);
+t3 = MEM_U32(s4 + 196);
+t4 = MEM_U32(a0 + 16);
+t5 = s2 >> 3;
+s2 = t5;
+s1 = t3 + t4;
+if ((int)t5 <= 0) goto L40db38;
+L40da68:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_dynamic(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x8;
+if (s0 != s2) goto L40da68;
+t3 = MEM_U32(sp + 60);
+goto L40db3c;
+L40da90:
+at = 0x70000000;
+if (v1 != at) {
+at = 0x70000000;
+goto L40daf0;}
+at = 0x70000000;
+s2 = MEM_U32(a0 + 20);
+at = 0x14;
+lo = s2 / at; hi = s2 % at;
+t6 = MEM_U32(s4 + 196);
+t7 = MEM_U32(a0 + 16);
+s0 = zero;
+s1 = t6 + t7;
+s2 = lo;
+t3 = MEM_U32(sp + 60);
+if ((int)s2 <= 0) goto L40db3c;
+L40dac4:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_liblist(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x14;
+if (s0 != s2) goto L40dac4;
+t3 = MEM_U32(sp + 60);
+goto L40db3c;
+at = 0x70000000;
+L40daf0:
+at = at | 0x2;
+s0 = zero;
+if (v1 != at) goto L40db38;
+s2 = MEM_U32(a0 + 20);
+t9 = MEM_U32(s4 + 196);
+t1 = MEM_U32(a0 + 16);
+t2 = s2 >> 2;
+s2 = t2;
+s1 = t9 + t1;
+if ((int)t2 <= 0) goto L40db38;
+L40db18:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_conflict(mem, sp, a0, a1);
+s0 = s0 + 0x1;
+// bdead 600407e0003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x4;
+if (s0 != s2) goto L40db18;
+L40db38:
+t3 = MEM_U32(sp + 60);
+L40db3c:
+t5 = MEM_U32(sp + 80);
+t4 = t3 + 0x28;
+MEM_U32(sp + 60) = t4;
+t6 = MEM_U16(t5 + 48);
+s5 = s5 + 0x1;
+a3 = MEM_U32(sp + 80);
+if (s5 < t6) goto L40d908;
+L40db5c:
+t7 = MEM_U32(s4 + 384);
+a3 = MEM_U32(sp + 80);
+at = 0x1;
+s5 = zero;
+if (t7 != at) goto L40dbd8;
+s2 = MEM_U32(s4 + 196);
+a1 = 0x4199fc; // function pointer
+t8 = MEM_U32(s2 + 32);
+a2 = 0x70000000;
+t9 = t8 + s2;
+MEM_U32(s4 + 232) = t9;
+//nop;
+MEM_U32(sp + 80) = a3;
+a2 = a2 | 0x5;
+a0 = s4;
+temp64 = f_foreach_section(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4070000b gp = MEM_U32(sp + 48);
+at = 0xffffffff;
+//nop;
+if (v0 == at) goto L40dbcc;
+t1 = MEM_U32(s4 + 196);
+t2 = MEM_U32(v0 + 16);
+//nop;
+t3 = t1 + t2;
+MEM_U32(s4 + 156) = t3;
+a3 = MEM_U32(sp + 80);
+t4 = MEM_U32(a3 + 24);
+goto L40dbdc;
+L40dbcc:
+MEM_U32(s4 + 156) = zero;
+a3 = MEM_U32(sp + 80);
+//nop;
+L40dbd8:
+t4 = MEM_U32(a3 + 24);
+L40dbdc:
+t0 = 0x6;
+MEM_U32(s4 + 272) = t4;
+a0 = MEM_U16(a3 + 44);
+v0 = MEM_U32(sp + 84);
+a2 = 0x70000000;
+if (a0 == 0) goto L40dcfc;
+a1 = 0x4;
+L40dbf8:
+v1 = MEM_U32(v0 + 0);
+//nop;
+if (v1 < 0x7) {
+at = v1 < 0x7;
+goto L40dc20;}
+at = v1 < 0x7;
+//nop;
+if (v1 == a2) goto L40dcec;
+s5 = s5 + 0x1;
+goto L40dcf0;
+// fdead 0 at = v1 < 0x7;
+L40dc20:
+//nop;
+if (at == 0) goto L40dcec;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (v1) {
+case 0: goto L40dcec;
+case 1: goto L40dc48;
+case 2: goto L40dce0;
+case 3: goto L40dcec;
+case 4: goto L40dcec;
+case 5: goto L40dcec;
+case 6: goto L40dcec;
+}
+L40dc48:
+v1 = MEM_U32(v0 + 24);
+//nop;
+t6 = v1 & 0x6;
+//nop;
+if (t6 == a1) goto L40dc6c;
+//nop;
+if (t6 == t0) goto L40dca4;
+s5 = s5 + 0x1;
+goto L40dcf0;
+L40dc6c:
+t7 = MEM_U32(v0 + 8);
+t8 = MEM_U32(v0 + 4);
+//nop;
+t9 = t7 - t8;
+MEM_U32(s4 + 252) = t9;
+MEM_U32(s4 + 248) = t9;
+t3 = MEM_U32(v0 + 16);
+t2 = MEM_U32(v0 + 4);
+//nop;
+t4 = t2 + t3;
+MEM_U32(s4 + 256) = t4;
+a0 = MEM_U16(a3 + 44);
+s5 = s5 + 0x1;
+goto L40dcf0;
+L40dca4:
+t5 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(s4 + 260) = t5;
+t6 = MEM_U32(v0 + 16);
+//nop;
+t8 = t6 + t5;
+MEM_U32(s4 + 264) = t8;
+t1 = MEM_U32(v0 + 16);
+t9 = MEM_U32(v0 + 20);
+//nop;
+t2 = t9 - t1;
+MEM_U32(s4 + 268) = t2;
+a0 = MEM_U16(a3 + 44);
+s5 = s5 + 0x1;
+goto L40dcf0;
+L40dce0:
+t3 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(sp + 128) = t3;
+L40dcec:
+s5 = s5 + 0x1;
+L40dcf0:
+v0 = v0 + 0x20;
+if (s5 < a0) goto L40dbf8;
+L40dcfc:
+t5 = MEM_U32(s4 + 224);
+t4 = 0x62;
+MEM_U8(s4 + 1) = (uint8_t)t4;
+s5 = MEM_U32(t5 + 36);
+at = 0xf0000000;
+t6 = s5 & at;
+at = 0x10000000;
+if (t6 == 0) goto L40dfe4;
+t8 = 0x42;
+if (t6 != at) goto L40dd30;
+t7 = 0x66;
+MEM_U8(s4 + 1) = (uint8_t)t7;
+goto L40dfe4;
+L40dd30:
+MEM_U8(s4 + 1) = (uint8_t)t8;
+goto L40dfe4;
+L40dd38:
+t9 = 0x2;
+L40dd3c:
+MEM_U32(s4 + 140) = t9;
+v0 = MEM_U16(s2 + 0);
+at = 0x160;
+if (v0 == at) {
+at = 0x163;
+goto L40dd60;}
+at = 0x163;
+if (v0 == at) {
+at = 0x140;
+goto L40dd60;}
+at = 0x140;
+if (v0 != at) {
+at = 0x162;
+goto L40dd6c;}
+at = 0x162;
+L40dd60:
+v1 = v0 & 0xff;
+goto L40de10;
+at = 0x162;
+L40dd6c:
+if (v0 == at) {
+at = 0x166;
+goto L40dd84;}
+at = 0x166;
+if (v0 == at) {
+at = 0x142;
+goto L40dd84;}
+at = 0x142;
+if (v0 != at) {
+at = 0x6001;
+goto L40dd90;}
+at = 0x6001;
+L40dd84:
+v1 = v0 & 0xff;
+goto L40de10;
+at = 0x6001;
+L40dd90:
+v1 = v0 & 0xff00;
+if (v0 == at) goto L40dda8;
+at = 0x6301;
+if (v0 == at) {
+at = 0x4001;
+goto L40dda8;}
+at = 0x4001;
+if (v0 != at) {
+t1 = v1 >> 8;
+goto L40ddcc;}
+L40dda8:
+t1 = v1 >> 8;
+at = 0x1;
+v1 = t1;
+if (s3 != at) goto L40de10;
+t3 = MEM_S8(s4 + 0);
+//nop;
+t4 = t3 | 0x80;
+MEM_U8(s4 + 0) = (uint8_t)t4;
+goto L40de10;
+L40ddcc:
+at = 0x6201;
+v1 = v0 & 0xff00;
+if (v0 == at) goto L40dde8;
+at = 0x6601;
+if (v0 == at) {
+at = 0x4201;
+goto L40dde8;}
+at = 0x4201;
+if (v0 != at) {
+t5 = v1 >> 8;
+goto L40de08;}
+L40dde8:
+t5 = v1 >> 8;
+v1 = t5;
+if (s3 != 0) goto L40de10;
+t7 = MEM_S8(s4 + 0);
+//nop;
+t8 = t7 | 0x80;
+MEM_U8(s4 + 0) = (uint8_t)t8;
+goto L40de10;
+L40de08:
+v0 = zero;
+goto L40e414;
+L40de10:
+t9 = 0x62;
+if ((int)v1 >= (int)0x63) goto L40de24;
+MEM_U8(s4 + 1) = (uint8_t)t9;
+goto L40de3c;
+L40de24:
+if ((int)v1 >= (int)0x67) {
+v1 = 0x42;
+goto L40de38;}
+v1 = 0x42;
+v1 = 0x66;
+goto L40de38;
+L40de38:
+MEM_U8(s4 + 1) = (uint8_t)v1;
+L40de3c:
+v0 = MEM_U32(s4 + 0);
+//nop;
+t1 = (int)v0 >> 31;
+v0 = t1;
+if (t1 == 0) goto L40de70;
+//nop;
+a0 = MEM_U32(s4 + 196);
+a1 = s3;
+f_swap_filehdr(mem, sp, a0, a1);
+v0 = MEM_U32(s4 + 0);
+// bdead 4030000b gp = MEM_U32(sp + 48);
+t2 = (int)v0 >> 31;
+v0 = t2;
+L40de70:
+s2 = MEM_U32(s4 + 196);
+//nop;
+MEM_U32(s4 + 144) = s2;
+MEM_U32(s4 + 248) = s2;
+t3 = MEM_U16(s2 + 16);
+//nop;
+t4 = t3 + s2;
+t5 = t4 + 0x14;
+MEM_U32(s4 + 152) = t5;
+if (v0 == 0) goto L40dedc;
+t7 = MEM_U16(s2 + 2);
+s0 = zero;
+s1 = t5;
+if (t7 == 0) goto L40dedc;
+L40dea8:
+//nop;
+a0 = s1;
+a1 = s3;
+f_swap_scnhdr(mem, sp, a0, a1);
+t8 = MEM_U32(s4 + 144);
+s0 = s0 + 0x1;
+t9 = MEM_U16(t8 + 2);
+// bdead 44360003 gp = MEM_U32(sp + 48);
+s1 = s1 + 0x28;
+if (s0 < t9) goto L40dea8;
+s2 = MEM_U32(s4 + 196);
+//nop;
+L40dedc:
+t1 = MEM_U16(s2 + 16);
+//nop;
+//nop;
+if (t1 == 0) goto L40df6c;
+t2 = MEM_U32(s4 + 0);
+//nop;
+t3 = (int)t2 >> 31;
+v0 = s2 + 0x14;
+if (t3 == 0) goto L40df20;
+//nop;
+a0 = s2 + 0x14;
+a1 = s3;
+f_swap_aouthdr(mem, sp, a0, a1);
+// bdead 40300003 gp = MEM_U32(sp + 48);
+s2 = MEM_U32(s4 + 196);
+//nop;
+v0 = s2 + 0x14;
+L40df20:
+MEM_U32(s4 + 148) = v0;
+t4 = MEM_U32(v0 + 20);
+//nop;
+MEM_U32(s4 + 252) = t4;
+t5 = MEM_U32(v0 + 4);
+//nop;
+MEM_U32(s4 + 256) = t5;
+t6 = MEM_U32(v0 + 24);
+//nop;
+MEM_U32(s4 + 260) = t6;
+t7 = MEM_U32(v0 + 28);
+//nop;
+MEM_U32(s4 + 264) = t7;
+t8 = MEM_U32(v0 + 12);
+//nop;
+MEM_U32(s4 + 268) = t8;
+t9 = MEM_U32(v0 + 16);
+//nop;
+MEM_U32(s4 + 272) = t9;
+L40df6c:
+//nop;
+a0 = s4;
+//nop;
+v0 = f_obj_map_address(mem, sp, a0);
+// bdead 4030000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s4 + 144);
+//nop;
+a1 = v0;
+// fdead 603e006f t9 = t9;
+//nop;
+v0 = func_40f27c(mem, sp, a0, a1);
+// bdead 4030000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 128) = v0;
+//nop;
+a0 = s4;
+//nop;
+v0 = f_hdr_symptr(mem, sp, a0);
+// bdead 4030018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L40dfe4;
+t1 = MEM_U32(s4 + 384);
+at = 0x1;
+//nop;
+if (t1 != at) goto L40dfe4;
+s2 = MEM_U32(s4 + 196);
+//nop;
+t2 = MEM_U32(s2 + 8);
+//nop;
+t3 = t2 + s2;
+MEM_U32(s4 + 156) = t3;
+L40dfe4:
+s0 = MEM_U32(s4 + 156);
+//nop;
+//nop;
+if (s0 == 0) goto L40e338;
+t4 = MEM_U32(s4 + 0);
+//nop;
+t5 = (int)t4 >> 31;
+//nop;
+if (t5 == 0) goto L40e024;
+//nop;
+a0 = s0;
+a1 = s3;
+f_swap_hdr(mem, sp, a0, a1);
+// bdead 40300183 gp = MEM_U32(sp + 48);
+s0 = MEM_U32(s4 + 156);
+//nop;
+L40e024:
+a1 = MEM_S16(s0 + 0);
+at = 0x7009;
+//nop;
+if (a1 != at) goto L40e31c;
+v0 = MEM_U32(s0 + 12);
+t6 = MEM_U32(s4 + 52);
+//nop;
+//nop;
+if ((int)t6 >= (int)v0) goto L40e070;
+a0 = 0xfb528e4;
+a1 = 0x10000c78;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e070:
+s2 = MEM_U32(s4 + 196);
+t8 = MEM_U32(s4 + 52);
+t7 = s2 + v0;
+MEM_U32(s4 + 184) = t7;
+v0 = MEM_U32(s0 + 52);
+//nop;
+t9 = s2 + v0;
+if ((int)t8 >= (int)v0) goto L40e0b8;
+a0 = 0xfb528e4;
+a1 = 0x10000ca8;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e0b8:
+MEM_U32(s4 + 192) = t9;
+v0 = MEM_U32(s0 + 84);
+t1 = MEM_U32(s4 + 52);
+t2 = s2 + v0;
+//nop;
+if ((int)t1 >= (int)v0) goto L40e0f8;
+a0 = 0xfb528e4;
+a1 = 0x10000cd4;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e0f8:
+MEM_U32(s4 + 188) = t2;
+v1 = MEM_U32(s0 + 28);
+v0 = MEM_U32(s4 + 52);
+t3 = s2 + v1;
+//nop;
+if ((int)v0 >= (int)v1) goto L40e138;
+a0 = 0xfb528e4;
+a1 = 0x10000d00;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e138:
+MEM_U32(s4 + 164) = t3;
+a0 = MEM_U32(s0 + 76);
+//nop;
+t4 = s2 + a0;
+if ((int)v0 >= (int)a0) goto L40e174;
+a0 = 0xfb528e4;
+a1 = 0x10000d2c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e174:
+MEM_U32(s4 + 160) = t4;
+v0 = MEM_U32(s0 + 36);
+t5 = MEM_U32(s4 + 52);
+t6 = s2 + v0;
+//nop;
+if ((int)t5 >= (int)v0) goto L40e1b4;
+a0 = 0xfb528e4;
+a1 = 0x10000d58;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e1b4:
+MEM_U32(s4 + 168) = t6;
+v0 = MEM_U32(s0 + 92);
+t7 = MEM_U32(s4 + 52);
+t8 = s2 + v0;
+//nop;
+if ((int)t7 >= (int)v0) goto L40e1f4;
+a0 = 0xfb528e4;
+a1 = 0x10000d84;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e1f4:
+MEM_U32(s4 + 172) = t8;
+v0 = MEM_U32(s0 + 68);
+t9 = MEM_U32(s4 + 52);
+t1 = s2 + v0;
+//nop;
+if ((int)t9 >= (int)v0) goto L40e234;
+a0 = 0xfb528e4;
+a1 = 0x10000db0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e234:
+MEM_U32(s4 + 176) = t1;
+v0 = MEM_U32(s0 + 60);
+t2 = MEM_U32(s4 + 52);
+t3 = s2 + v0;
+//nop;
+if ((int)t2 >= (int)v0) goto L40e274;
+a0 = 0xfb528e4;
+a1 = 0x10000de0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+goto L40e414;
+L40e274:
+t5 = MEM_U32(s4 + 0);
+MEM_U32(s4 + 180) = t3;
+t4 = MEM_U32(s0 + 32);
+t6 = (int)t5 >> 31;
+MEM_U32(s4 + 216) = t4;
+if (t6 == 0) goto L40e338;
+//nop;
+a0 = MEM_U32(s4 + 188);
+a1 = MEM_U32(s0 + 80);
+a2 = s3;
+f_swap_fi(mem, sp, a0, a1, a2);
+// bdead 40300003 gp = MEM_U32(sp + 48);
+t7 = MEM_U32(s4 + 156);
+//nop;
+a0 = MEM_U32(s4 + 164);
+a1 = MEM_U32(t7 + 24);
+a2 = s3;
+f_swap_pd(mem, sp, a0, a1, a2);
+// bdead 40300003 gp = MEM_U32(sp + 48);
+t8 = MEM_U32(s4 + 156);
+//nop;
+a0 = MEM_U32(s4 + 160);
+a1 = MEM_U32(t8 + 72);
+a2 = s3;
+f_swap_fd(mem, sp, a0, a1, a2);
+t9 = MEM_U32(s4 + 156);
+// bdead 44300003 gp = MEM_U32(sp + 48);
+a1 = MEM_U32(t9 + 32);
+//nop;
+a0 = MEM_U32(s4 + 168);
+a2 = s3;
+f_swap_sym(mem, sp, a0, a1, a2);
+// bdead 40300003 gp = MEM_U32(sp + 48);
+t1 = MEM_U32(s4 + 156);
+//nop;
+a0 = MEM_U32(s4 + 172);
+a1 = MEM_U32(t1 + 88);
+a2 = s3;
+f_swap_ext(mem, sp, a0, a1, a2);
+// bdead 40200003 gp = MEM_U32(sp + 48);
+//nop;
+goto L40e338;
+L40e31c:
+a0 = 0x10000e0c;
+//nop;
+a0 = a0;
+//nop;
+f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40200003 gp = MEM_U32(sp + 48);
+//nop;
+L40e338:
+//nop;
+a1 = MEM_U32(s4 + 252);
+a0 = s4;
+f_obj_set_base_address(mem, sp, a0, a1);
+// bdead 40200003 gp = MEM_U32(sp + 48);
+a0 = s4;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_map_diff(mem, sp, a0);
+t2 = MEM_U32(s4 + 384);
+// bdead 4020080b gp = MEM_U32(sp + 48);
+at = 0x2;
+a2 = v0;
+if (t2 != at) goto L40e3ac;
+t3 = MEM_U32(s4 + 252);
+t5 = MEM_U32(s4 + 260);
+t7 = MEM_U32(s4 + 264);
+t9 = MEM_U32(s4 + 272);
+t4 = t3 - v0;
+t6 = t5 - v0;
+t8 = t7 - v0;
+t1 = t9 - v0;
+MEM_U32(s4 + 252) = t4;
+MEM_U32(s4 + 260) = t6;
+MEM_U32(s4 + 264) = t8;
+MEM_U32(s4 + 272) = t1;
+a3 = v0;
+goto L40e3c4;
+L40e3ac:
+t2 = MEM_U32(s4 + 260);
+t3 = MEM_U32(s4 + 252);
+t5 = MEM_U32(s4 + 256);
+t4 = t2 - t3;
+t6 = t4 - t5;
+a3 = t6 + v0;
+L40e3c4:
+MEM_U32(s4 + 408) = zero;
+t7 = MEM_U32(sp + 128);
+//nop;
+a0 = t7 - a2;
+if (t7 == 0) goto L40e410;
+//nop;
+MEM_U32(sp + 128) = a0;
+a1 = s4;
+v0 = f_obj_get_dynamic_info(mem, sp, a0, a1, a2, a3);
+// bdead 402001c9 gp = MEM_U32(sp + 48);
+if (v0 != 0) {
+v0 = s4;
+goto L40e414;}
+v0 = s4;
+a0 = 0x10000e30;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0);
+// bdead 200001 gp = MEM_U32(sp + 48);
+//nop;
+L40e410:
+v0 = s4;
+L40e414:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0xa0;
+return v0;
+//nop;
+return v0;
+}
+
+static uint32_t func_40e8cc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+MEM_U32(sp + 8) = a2;
+v0 = MEM_U32(a0 + 156);
+//nop;
+//nop;
+if (v0 != 0) goto L40e8e8;
+v0 = 0xffffffff;
+return v0;
+L40e8e8:
+t6 = MEM_U32(a0 + 204);
+//nop;
+//nop;
+if (a1 < t6) goto L40e920;
+t7 = MEM_U32(a0 + 216);
+t8 = MEM_U32(v0 + 88);
+//nop;
+t9 = t7 + t8;
+v0 = 0xffffffff;
+if (a1 >= t9) goto L40e924;
+v0 = a0;
+return v0;
+L40e920:
+v0 = 0xffffffff;
+L40e924:
+//nop;
+return v0;
+}
+
+static uint64_t func_40e9bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+MEM_U32(sp + 8) = a2;
+v0 = MEM_U32(a0 + 156);
+//nop;
+//nop;
+if (v0 != 0) goto L40e9d8;
+v0 = 0xffffffff;
+return ((uint64_t)v0 << 32) | v1;
+L40e9d8:
+v1 = MEM_U32(a0 + 212);
+//nop;
+//nop;
+if (a1 < v1) goto L40ea0c;
+t6 = MEM_U32(v0 + 24);
+//nop;
+t7 = v1 + t6;
+v0 = 0xffffffff;
+if (a1 >= t7) goto L40ea10;
+v0 = a0;
+return ((uint64_t)v0 << 32) | v1;
+L40ea0c:
+v0 = 0xffffffff;
+L40ea10:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_40eaa8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+MEM_U32(sp + 8) = a2;
+v0 = MEM_U32(a0 + 156);
+//nop;
+//nop;
+if (v0 != 0) goto L40eac4;
+v0 = 0xffffffff;
+return ((uint64_t)v0 << 32) | v1;
+L40eac4:
+v1 = MEM_U32(a0 + 208);
+//nop;
+//nop;
+if (a1 < v1) goto L40eaf8;
+t6 = MEM_U32(v0 + 72);
+//nop;
+t7 = v1 + t6;
+v0 = 0xffffffff;
+if (a1 >= t7) goto L40eafc;
+v0 = a0;
+return ((uint64_t)v0 << 32) | v1;
+L40eaf8:
+v0 = 0xffffffff;
+L40eafc:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_40eb94(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+MEM_U32(sp + 8) = a2;
+v0 = MEM_U32(a0 + 252);
+//nop;
+//nop;
+if (a1 < v0) goto L40ebc4;
+t6 = MEM_U32(a0 + 256);
+//nop;
+t7 = v0 + t6;
+//nop;
+if (a1 < t7) goto L40ebf4;
+L40ebc4:
+t8 = MEM_U32(a0 + 260);
+v0 = 0xffffffff;
+//nop;
+if (a1 < t8) goto L40ebfc;
+t9 = MEM_U32(a0 + 264);
+t0 = MEM_U32(a0 + 268);
+//nop;
+t1 = t9 + t0;
+//nop;
+if (a1 >= t1) goto L40ebfc;
+L40ebf4:
+v0 = a0;
+return v0;
+L40ebfc:
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_read_from_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40ec94:
+//obj_read_from_fd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+s0 = a0;
+// fdead 400201eb MEM_U32(sp + 36) = ra;
+// fdead 400201eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 68) = a1;
+MEM_U32(sp + 72) = a2;
+MEM_U32(sp + 76) = a3;
+if (a0 != 0) goto L40ecdc;
+//nop;
+a0 = 0x1;
+a1 = 0x1dc;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+s0 = v0;
+L40ecdc:
+//nop;
+if (s0 != 0) goto L40ecec;
+v0 = zero;
+goto L40ef3c;
+L40ecec:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_getpagesize(mem);
+a2 = MEM_U32(s0 + 196);
+// bdead 4002008b gp = MEM_U32(sp + 32);
+t0 = v0;
+if (a2 == 0) goto L40edfc;
+t8 = MEM_U32(sp + 72);
+t6 = v0 + 0xffffffff;
+t7 = ~t6;
+t9 = t8 & 0x3;
+a0 = a2 & t7;
+if (t9 != 0) goto L40ee88;
+t1 = MEM_U32(s0 + 52);
+//nop;
+t2 = a2 - a0;
+MEM_U32(sp + 60) = v0;
+a1 = t1 + t2;
+v0 = wrapper_munmap(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+t0 = MEM_U32(sp + 60);
+at = 0xffffffff;
+a0 = zero;
+if (v0 != at) goto L40ed5c;
+a2 = MEM_U32(s0 + 196);
+a1 = MEM_U32(sp + 76);
+goto L40ee8c;
+L40ed5c:
+t3 = MEM_U32(sp + 76);
+v0 = MEM_U32(sp + 72);
+MEM_U32(s0 + 52) = t3;
+t4 = t0 + 0xffffffff;
+t5 = ~t4;
+//nop;
+t8 = MEM_U32(sp + 68);
+t7 = MEM_U32(sp + 76);
+v1 = v0 & t5;
+t6 = v0 - v1;
+MEM_U32(sp + 20) = v1;
+MEM_U32(sp + 40) = v1;
+a2 = 0x2;
+a3 = 0x2;
+MEM_U32(sp + 16) = t8;
+a1 = t6 + t7;
+v0 = wrapper_mmap(mem, a0, a1, a2, a3, MEM_S32(sp + 16), MEM_S32(sp + 20));
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 40);
+at = 0xffffffff;
+t4 = 0x1;
+if (v0 != at) goto L40ede0;
+t9 = 0xfb52720;
+at = 0x13;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 != at) goto L40edd4;
+v0 = zero;
+goto L40ef3c;
+L40edd4:
+a2 = MEM_U32(s0 + 196);
+a1 = MEM_U32(sp + 76);
+goto L40ee8c;
+L40ede0:
+t1 = MEM_U32(sp + 72);
+at = 0x10000020;
+t2 = v0 + t1;
+t3 = t2 - v1;
+MEM_U32(s0 + 196) = t3;
+MEM_U32(at + 0) = t4;
+goto L40ef24;
+L40edfc:
+t5 = MEM_U32(sp + 76);
+t8 = t0 + 0xffffffff;
+MEM_U32(s0 + 52) = t5;
+t6 = MEM_U32(sp + 72);
+t9 = ~t8;
+t7 = t6 & 0x3;
+a0 = zero;
+if (t7 != 0) goto L40ee80;
+v1 = t6 & t9;
+//nop;
+t2 = MEM_U32(sp + 76);
+t3 = MEM_U32(sp + 68);
+t1 = t6 - v1;
+MEM_U32(sp + 20) = v1;
+MEM_U32(sp + 40) = v1;
+a2 = 0x2;
+a3 = 0x2;
+a1 = t1 + t2;
+MEM_U32(sp + 16) = t3;
+v0 = wrapper_mmap(mem, a0, a1, a2, a3, MEM_S32(sp + 16), MEM_S32(sp + 20));
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 40);
+at = 0xffffffff;
+MEM_U32(s0 + 196) = v0;
+if (v0 == at) goto L40ee80;
+t5 = MEM_U32(sp + 72);
+at = 0x10000020;
+t7 = v0 + t5;
+t8 = t7 - v1;
+MEM_U32(s0 + 196) = t8;
+t9 = 0x1;
+MEM_U32(at + 0) = t9;
+goto L40ef24;
+L40ee80:
+MEM_U32(s0 + 196) = zero;
+a2 = zero;
+L40ee88:
+a1 = MEM_U32(sp + 76);
+L40ee8c:
+MEM_U32(s0 + 52) = a1;
+if (a2 == 0) goto L40eeb0;
+//nop;
+a0 = a2;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 196) = v0;
+goto L40eec8;
+L40eeb0:
+//nop;
+a0 = a1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 196) = v0;
+L40eec8:
+t6 = MEM_U32(s0 + 196);
+a0 = MEM_U32(sp + 68);
+//nop;
+if (t6 != 0) goto L40eee0;
+v0 = zero;
+goto L40ef3c;
+L40eee0:
+//nop;
+a1 = MEM_U32(sp + 72);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40020003 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+a1 = MEM_U32(s0 + 196);
+a2 = MEM_U32(sp + 76);
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+t1 = MEM_U32(sp + 76);
+// bdead 4002040b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == t1) goto L40ef24;
+v0 = zero;
+goto L40ef3c;
+L40ef24:
+//nop;
+a0 = s0;
+a1 = 0x1;
+v0 = f_obj_init(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 32);
+//nop;
+L40ef3c:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint32_t func_40f27c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, t8 = 0;
+L40f27c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+t6 = MEM_U16(a0 + 16);
+t7 = MEM_U16(a0 + 2);
+v0 = t6 + a1;
+s3 = a0;
+v0 = v0 + 0x14;
+s0 = zero;
+if (t7 == 0) goto L40f314;
+s4 = 0x10000ec0;
+s1 = v0;
+s4 = s4;
+L40f2d0:
+//nop;
+s2 = s1;
+a0 = s1;
+a1 = s4;
+a2 = 0x8;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 403e000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L40f300;
+v0 = MEM_U32(s2 + 12);
+// bdead 9 ra = MEM_U32(sp + 44);
+goto L40f31c;
+L40f300:
+t8 = MEM_U16(s3 + 2);
+s0 = s0 + 0x1;
+s1 = s1 + 0x1;
+if (s0 < t8) goto L40f2d0;
+L40f314:
+v0 = zero;
+// bdead 9 ra = MEM_U32(sp + 44);
+L40f31c:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t f_obj_get_dynamic_info(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, t8 = 0, t9 = 0;
+L40f484:
+//obj_get_dynamic_info:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+// fdead 400001eb MEM_U32(sp + 52) = ra;
+// fdead 400001eb MEM_U32(sp + 44) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s4;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 96) = a0;
+s0 = a0;
+s1 = a1;
+s2 = a2;
+s5 = a3;
+// fdead 404e01eb MEM_U32(sp + 48) = gp;
+s3 = zero;
+s4 = 0xa;
+a0 = 0x28;
+v0 = wrapper_malloc(mem, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 88) = v0;
+//nop;
+a0 = s1;
+a1 = 0xffffffff;
+f_obj_set_conflictcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = 0xffffffff;
+//nop;
+f_obj_set_liblistcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = zero;
+//nop;
+f_obj_set_msym_address(mem, sp, a0, a1);
+t6 = MEM_U32(sp + 96);
+// bdead 407e8003 gp = MEM_U32(sp + 48);
+t7 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L40fbc8;
+v1 = MEM_U32(s0 + 0);
+//nop;
+at = (int)v1 < (int)0x14;
+L40f548:
+v0 = v1;
+if (at != 0) goto L40f588;
+at = 0x8fff0000;
+at = at | 0xffff;
+t8 = v1 + at;
+//nop;
+if (t8 >= 0x2d) goto L40fbb8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L40f898;
+case 1: goto L40f8b4;
+case 2: goto L40f8d0;
+case 3: goto L40f8ec;
+case 4: goto L40f908;
+case 5: goto L40f600;
+case 6: goto L40f790;
+case 7: goto L40f818;
+case 8: goto L40f7f0;
+case 9: goto L40f844;
+case 10: goto L40f9cc;
+case 11: goto L40fbb8;
+case 12: goto L40fbb8;
+case 13: goto L40fbb8;
+case 14: goto L40fbb8;
+case 15: goto L40f9b0;
+case 16: goto L40f95c;
+case 17: goto L40f860;
+case 18: goto L40f87c;
+case 19: goto L40fbb8;
+case 20: goto L40fbb8;
+case 21: goto L40f9f4;
+case 22: goto L40fa4c;
+case 23: goto L40fa6c;
+case 24: goto L40fa88;
+case 25: goto L40faa8;
+case 26: goto L40fac4;
+case 27: goto L40fae4;
+case 28: goto L40fb00;
+case 29: goto L40fb20;
+case 30: goto L40fbb8;
+case 31: goto L40fb3c;
+case 32: goto L40fb5c;
+case 33: goto L40fb78;
+case 34: goto L40f664;
+case 35: goto L40fb94;
+case 36: goto L40fbb8;
+case 37: goto L40fbb8;
+case 38: goto L40fbb8;
+case 39: goto L40fbb8;
+case 40: goto L40fbb8;
+case 41: goto L40fbb8;
+case 42: goto L40fbb8;
+case 43: goto L40fbb8;
+case 44: goto L40fa30;
+}
+L40f588:
+t9 = v0 + 0xffffffff;
+//nop;
+if (t9 >= 0x13) goto L40fbb8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L40f5b8;
+case 1: goto L40fbb8;
+case 2: goto L40f7b0;
+case 3: goto L40f6f4;
+case 4: goto L40f750;
+case 5: goto L40f770;
+case 6: goto L40fbb8;
+case 7: goto L40fbb8;
+case 8: goto L40fbb8;
+case 9: goto L40f994;
+case 10: goto L40f978;
+case 11: goto L40f61c;
+case 12: goto L40f6ac;
+case 13: goto L40f838;
+case 14: goto L40f9e8;
+case 15: goto L40fa14;
+case 16: goto L40f7d0;
+case 17: goto L40f924;
+case 18: goto L40f940;
+}
+L40f5b8:
+v1 = s3 << 2;
+if ((int)s3 < (int)s4) goto L40f5e8;
+//nop;
+s4 = s4 + 0xa;
+a0 = MEM_U32(sp + 88);
+a1 = s4 << 2;
+MEM_U32(sp + 56) = v1;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 56);
+MEM_U32(sp + 88) = v0;
+L40f5e8:
+t1 = MEM_U32(sp + 88);
+t0 = MEM_U32(s0 + 4);
+t2 = t1 + v1;
+s3 = s3 + 0x1;
+MEM_U32(t2 + 0) = t0;
+goto L40fbb8;
+L40f600:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_base_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f61c:
+v0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (v0 == 0) goto L40f648;
+//nop;
+a0 = s1;
+a1 = v0 - s2;
+f_obj_set_init_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f648:
+//nop;
+a0 = s1;
+a1 = zero;
+f_obj_set_init_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f664:
+v0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (v0 == 0) goto L40f690;
+//nop;
+a0 = s1;
+a1 = v0 - s2;
+f_obj_set_pixie_init_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f690:
+//nop;
+a0 = s1;
+a1 = zero;
+f_obj_set_pixie_init_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f6ac:
+v0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (v0 == 0) goto L40f6d8;
+//nop;
+a0 = s1;
+a1 = v0 - s2;
+f_obj_set_fini_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f6d8:
+//nop;
+a0 = s1;
+a1 = zero;
+f_obj_set_fini_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f6f4:
+t3 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t3 - s2;
+f_obj_set_hash_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_nbucket(mem, sp, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+a2 = 0x51d;
+if (v0 != 0) goto L40fbb8;
+a0 = 0x1000102c;
+a1 = 0x10001040;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f750:
+t4 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t4 - s2;
+f_obj_set_dynstr_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f770:
+t5 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t5 - s2;
+f_obj_set_dynsym_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f790:
+t6 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t6 - s2;
+f_obj_set_msym_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f7b0:
+t7 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t7 - s5;
+f_obj_set_got_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f7d0:
+t8 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t8 - s2;
+f_obj_set_dynrel_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f7f0:
+t9 = MEM_U32(s0 + 4);
+a0 = s1;
+a1 = t9 - s2;
+//nop;
+//nop;
+//nop;
+f_obj_set_liblist_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f818:
+t1 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t1 - s2;
+f_obj_set_conflict_address(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f838:
+t0 = MEM_U32(s0 + 4);
+MEM_U32(s1 + 240) = t0;
+goto L40fbb8;
+L40f844:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_locgotcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f860:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_unrefextno(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f87c:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_gotsym(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f898:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_rldversion(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f8b4:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_timestamp(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f8d0:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_ichecksum(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f8ec:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_iversion(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f908:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynflags(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f924:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynrelsz(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f940:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynrelent(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f95c:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynsymcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f978:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynsyment(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f994:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_dynstrsz(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f9b0:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_liblistcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f9cc:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_conflictcount(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40f9e8:
+t2 = MEM_U32(s0 + 4);
+MEM_U32(s1 + 324) = t2;
+goto L40fbb8;
+L40f9f4:
+t3 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t3 - s5;
+f_obj_set_rld_map(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fa14:
+//nop;
+a0 = s1;
+a1 = 0x200;
+f_obj_set_rldflag(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fa30:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_rld_text_resolve_addr(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fa4c:
+t4 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t4 - s2;
+f_obj_set_delta_class(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fa6c:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_delta_class_no(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fa88:
+t5 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t5 - s2;
+f_obj_set_delta_instance(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40faa8:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_delta_instance_no(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fac4:
+t6 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t6 - s2;
+f_obj_set_delta_reloc(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fae4:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_delta_reloc_no(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb00:
+t7 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t7 - s2;
+f_obj_set_delta_sym(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb20:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_delta_sym_no(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb3c:
+t8 = MEM_U32(s0 + 4);
+//nop;
+a0 = s1;
+a1 = t8 - s5;
+f_obj_set_delta_classsym(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb5c:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_delta_classsym_no(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb78:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s1;
+f_obj_set_cxx_flags(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 8);
+goto L40fbbc;
+L40fb94:
+t9 = MEM_U32(s0 + 4);
+a0 = s1;
+a1 = t9 - s5;
+//nop;
+//nop;
+//nop;
+f_obj_set_symlib(mem, sp, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+//nop;
+L40fbb8:
+v1 = MEM_U32(s0 + 8);
+L40fbbc:
+s0 = s0 + 0x8;
+at = (int)v1 < (int)0x14;
+if (v1 != 0) goto L40f548;
+L40fbc8:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_got(mem, sp, a0);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+s0 = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_locgotcount(mem, sp, a0);
+// bdead 4016000b gp = MEM_U32(sp + 48);
+t1 = v0 << 2;
+//nop;
+a1 = t1 + s0;
+a0 = s1;
+f_obj_set_extgot(mem, sp, a0, a1);
+// bdead 40140003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_rpath(mem, sp, a0);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = v0;
+//nop;
+v0 = f_obj_dynstring(mem, sp, a0, a1);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = v0;
+//nop;
+f_obj_set_rpath(mem, sp, a0, a1);
+// bdead 40140003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_soname(mem, sp, a0);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = v0;
+//nop;
+v0 = f_obj_dynstring(mem, sp, a0, a1);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+a1 = v0;
+//nop;
+f_obj_set_soname(mem, sp, a0, a1);
+// bdead 40140003 gp = MEM_U32(sp + 48);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_liblist(mem, sp, a0);
+// bdead 4014000b gp = MEM_U32(sp + 48);
+// bdead 40140003 ra = MEM_U32(sp + 52);
+if (v0 != 0) goto L40fdac;
+s0 = s3 << 2;
+if (s3 == 0) goto L40fda8;
+//nop;
+s0 = s0 + s3;
+s0 = s0 << 2;
+a0 = s0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4016000b gp = MEM_U32(sp + 48);
+s2 = v0;
+//nop;
+a0 = v0;
+a1 = zero;
+a2 = s0;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 401c0003 gp = MEM_U32(sp + 48);
+a0 = zero;
+if ((int)s3 <= 0) goto L40fd88;
+a2 = s3 & 0x3;
+a1 = a2;
+if (a2 == 0) goto L40fd3c;
+t2 = MEM_U32(sp + 88);
+t0 = zero << 4;
+t3 = zero << 2;
+v0 = s2 + t0;
+v1 = t2 + t3;
+L40fd20:
+t4 = MEM_U32(v1 + 0);
+a0 = a0 + 0x1;
+v0 = v0 + 0x14;
+v1 = v1 + 0x4;
+MEM_U32(v0 + -20) = t4;
+if (a1 != a0) goto L40fd20;
+if (a0 == s3) {
+t5 = a0 << 2;
+goto L40fd88;}
+L40fd3c:
+t5 = a0 << 2;
+t6 = MEM_U32(sp + 88);
+t5 = t5 + a0;
+t5 = t5 << 2;
+t7 = a0 << 2;
+v0 = s2 + t5;
+v1 = t6 + t7;
+L40fd58:
+t8 = MEM_U32(v1 + 0);
+a0 = a0 + 0x4;
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(v1 + 4);
+v0 = v0 + 0x50;
+MEM_U32(v0 + -60) = t9;
+t1 = MEM_U32(v1 + 8);
+v1 = v1 + 0x10;
+MEM_U32(v0 + -40) = t1;
+t0 = MEM_U32(v1 + -4);
+MEM_U32(v0 + -20) = t0;
+if (a0 != s3) goto L40fd58;
+L40fd88:
+MEM_U32(s1 + 308) = s2;
+MEM_U32(s1 + 364) = s3;
+//nop;
+a0 = MEM_U32(sp + 88);
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 48);
+//nop;
+L40fda8:
+// bdead 1 ra = MEM_U32(sp + 52);
+L40fdac:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x60;
+v0 = 0x1;
+return v0;
+}
+
+static uint32_t f_elfhash(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40fdd0:
+//elfhash:
+v0 = MEM_S8(a0 + 0);
+v1 = zero;
+a3 = 0xf0000000;
+if (v0 == 0) goto L40fe10;
+L40fde0:
+t6 = v1 << 4;
+v1 = v0 + t6;
+a2 = v1 & a3;
+a0 = a0 + 0x1;
+a1 = a2;
+if (a2 == 0) goto L40fe00;
+t7 = a2 >> 24;
+v1 = v1 ^ t7;
+L40fe00:
+v0 = MEM_S8(a0 + 0);
+t8 = ~a1;
+v1 = v1 & t8;
+if (v0 != 0) goto L40fde0;
+L40fe10:
+v0 = v1;
+return v0;
+}
+
+static uint32_t f_obj_shared(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, t2 = 0, t8 = 0, t9 = 0;
+L40fe18:
+//obj_shared:
+//nop;
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffe0;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 32) = a0;
+v0 = f_obj_otype(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+at = 0x2;
+//nop;
+if (v0 != at) goto L40fe78;
+// fdead f t6 = MEM_U32(sp + 32);
+//nop;
+// fdead f t7 = MEM_U32(t6 + 144);
+//nop;
+// fdead f v0 = MEM_U16(t7 + 18);
+//nop;
+t8 = v0 & 0x3000;
+t9 = t8 ^ 0x2000;
+t9 = t9 < 0x1;
+v0 = t9;
+goto L40fedc;
+L40fe78:
+//nop;
+// fdead f a0 = MEM_U32(sp + 32);
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// fdead f gp = MEM_U32(sp + 24);
+at = 0x3;
+a2 = 0x631;
+if (v0 != at) goto L40febc;
+// fdead 8f t0 = MEM_U32(sp + 32);
+//nop;
+// fdead 8f t1 = MEM_U32(t0 + 224);
+//nop;
+// fdead 8f v0 = MEM_U32(t1 + 36);
+//nop;
+t2 = v0 & 0x2;
+v0 = t2;
+goto L40fedc;
+L40febc:
+a0 = 0x100014c4;
+a1 = 0x100014c8;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+L40fedc:
+// fdead 600088f ra = MEM_U32(sp + 28);
+// fdead 600088f sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_newstr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L40ffc0:
+//obj_newstr:
+//nop;
+//nop;
+//nop;
+//nop;
+// fdead 12b sp = sp + 0xffffffd8;
+// fdead 12b MEM_U32(sp + 28) = ra;
+// fdead 12b MEM_U32(sp + 24) = gp;
+// fdead 12b MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// fdead b gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b MEM_U32(sp + 36) = v0;
+if (v0 == 0) goto L410024;
+//nop;
+// fdead b a1 = MEM_U32(sp + 40);
+a0 = v0;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b ra = MEM_U32(sp + 28);
+goto L410044;
+L410024:
+a0 = 0x100014dc;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 3 ra = MEM_U32(sp + 28);
+L410044:
+// fdead b v0 = MEM_U32(sp + 36);
+// fdead b sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_split(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, s1 = 0;
+L410050:
+//split:
+//nop;
+//nop;
+//nop;
+// fdead 10b sp = sp + 0xffffffd8;
+//nop;
+// fdead 10b MEM_U32(sp + 36) = ra;
+// fdead 10b MEM_U32(sp + 28) = s2;
+// fdead 10b MEM_U32(sp + 24) = s1;
+// fdead 10b MEM_U32(sp + 20) = s0;
+// fdead 10b s0 = a1;
+// fdead 10b s2 = a2;
+// fdead 10b MEM_U32(sp + 32) = gp;
+// fdead 10b MEM_U32(sp + 52) = a3;
+s1 = zero;
+v0 = f_obj_newstr(mem, sp, a0);
+// fdead 4000b t6 = MEM_U32(sp + 52);
+// fdead 4000b gp = MEM_U32(sp + 32);
+at = 0x1;
+a0 = v0;
+if (t6 != at) goto L4100ac;
+// fdead 4002f MEM_U32(s0 + 0) = zero;
+// fdead 4002f s0 = s0 + 0x4;
+s1 = 0x1;
+L4100ac:
+//nop;
+// fdead 4002f a1 = s2;
+//nop;
+v0 = wrapper_strtok(mem, a0, a1);
+// fdead 4000f gp = MEM_U32(sp + 32);
+// fdead 4000f MEM_U32(s0 + 0) = v0;
+// fdead 4000f s0 = s0 + 0x4;
+if (v0 == 0) goto L410114;
+//nop;
+s1 = s1 + 0x1;
+a0 = zero;
+// fdead 4002f a1 = s2;
+v0 = wrapper_strtok(mem, a0, a1);
+// fdead 4000f gp = MEM_U32(sp + 32);
+// fdead 4000f MEM_U32(s0 + 0) = v0;
+// fdead 4000f s0 = s0 + 0x4;
+if (v0 == 0) goto L410114;
+L4100f0:
+//nop;
+s1 = s1 + 0x1;
+a0 = zero;
+// fdead 4002f a1 = s2;
+v0 = wrapper_strtok(mem, a0, a1);
+// fdead 4000f gp = MEM_U32(sp + 32);
+// fdead 4000f MEM_U32(s0 + 0) = v0;
+// fdead 4000f s0 = s0 + 0x4;
+if (v0 != 0) goto L4100f0;
+L410114:
+// fdead 4000f ra = MEM_U32(sp + 36);
+v0 = s1;
+// fdead 4000f s1 = MEM_U32(sp + 24);
+// fdead 4000f s0 = MEM_U32(sp + 20);
+// fdead 4000f s2 = MEM_U32(sp + 28);
+// fdead 4000f sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_get_dynsym_hash_value(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0;
+L410940:
+//get_dynsym_hash_value:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffd8;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 40) = a0;
+if (a1 != 0) goto L410968;
+v0 = zero;
+goto L4109dc;
+L410968:
+//nop;
+// fdead b a0 = MEM_U32(sp + 40);
+// fdead b MEM_U32(sp + 44) = a1;
+v0 = f_obj_dynsym_name(mem, sp, a0, a1);
+// fdead b gp = MEM_U32(sp + 24);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+v0 = f_elfhash(mem, sp, a0);
+// fdead 1b gp = MEM_U32(sp + 24);
+// fdead 1b a0 = MEM_U32(sp + 40);
+//nop;
+// fdead 1b MEM_U32(sp + 36) = v0;
+//nop;
+v0 = f_obj_msym_exists(mem, sp);
+// fdead b gp = MEM_U32(sp + 24);
+if (v0 == 0) {
+// fdead b v0 = MEM_U32(sp + 36);
+goto L4109d8;}
+// fdead b v0 = MEM_U32(sp + 36);
+//nop;
+// fdead b a0 = MEM_U32(sp + 40);
+// fdead b a1 = MEM_U32(sp + 44);
+// fdead b a2 = MEM_U32(sp + 36);
+//nop;
+f_obj_set_msym_ms_hash_value(mem, sp);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+// fdead b v0 = MEM_U32(sp + 36);
+L4109d8:
+//nop;
+L4109dc:
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_dumpobj_struct(uint8_t *mem, uint32_t sp, uint32_t a0) {
+L410bd0:
+//dumpobj_struct:
+MEM_U32(sp + 0) = a0;
+return;
+}
+
+static uint32_t f_search_symbol_using_hash(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, t6 = 0, t7 = 0, s0 = 0, s2 = 0, s3 = 0, lo = 0, hi = 0;
+L410cf0:
+//search_symbol_using_hash:
+//nop;
+//nop;
+//nop;
+// fdead cb sp = sp + 0xffffffd0;
+//nop;
+// fdead cb MEM_U32(sp + 44) = ra;
+// fdead cb MEM_U32(sp + 36) = s3;
+// fdead cb MEM_U32(sp + 32) = s2;
+// fdead cb MEM_U32(sp + 28) = s1;
+// fdead cb s1 = a0;
+s2 = a2;
+s3 = a1;
+// fdead 1800cb MEM_U32(sp + 40) = gp;
+// fdead 1800cb MEM_U32(sp + 24) = s0;
+v0 = f_obj_dynflags(mem, sp, a0);
+// fdead 18000b gp = MEM_U32(sp + 40);
+t6 = v0 & 0x2;
+//nop;
+if (t6 != 0) goto L410d70;
+//nop;
+// fdead 18800b a0 = s1;
+//nop;
+v0 = f_obj_nbucket(mem, sp, a0);
+// fdead 18000b gp = MEM_U32(sp + 40);
+t7 = v0 + 0xffffffff;
+//nop;
+a1 = t7 & s2;
+// fdead 19004b a0 = s1;
+v0 = f_obj_hash_bucket(mem, sp, a0, a1);
+// fdead 18000b gp = MEM_U32(sp + 40);
+s0 = v0;
+goto L410db0;
+L410d70:
+//nop;
+// fdead 18800b a0 = s1;
+//nop;
+v0 = f_obj_nbucket(mem, sp, a0);
+lo = s2 / v0; hi = s2 % v0;
+// fdead 60018000b gp = MEM_U32(sp + 40);
+// fdead 60018000b a0 = s1;
+//nop;
+//nop;
+if (v0 != 0) goto L410d9c;
+abort();
+L410d9c:
+a1 = hi;
+//nop;
+v0 = f_obj_hash_bucket(mem, sp, a0, a1);
+// fdead 60018000b gp = MEM_U32(sp + 40);
+s0 = v0;
+L410db0:
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_dynsym_hash_value(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != s2) goto L410e00;
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_dynsym_name(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+a0 = v0;
+//nop;
+a1 = s3;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+if (v0 == 0) {
+v0 = s0;
+goto L410e94;}
+v0 = s0;
+L410e00:
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_hash_chain(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 == 0) goto L410e88;
+L410e1c:
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_dynsym_hash_value(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+//nop;
+if (v0 != s2) goto L410e6c;
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_dynsym_name(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+a0 = v0;
+//nop;
+a1 = s3;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+if (v0 == 0) {
+v0 = s0;
+goto L410e94;}
+v0 = s0;
+L410e6c:
+//nop;
+// fdead 6001a000b a0 = s1;
+a1 = s0;
+v0 = f_obj_hash_chain(mem, sp, a0, a1);
+// fdead 6001a000b gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 != 0) goto L410e1c;
+L410e88:
+v0 = 0xffffffff;
+goto L410e94;
+// fdead 0 v0 = s0;
+L410e94:
+// fdead 6001a000b ra = MEM_U32(sp + 44);
+// fdead 6001a000b s0 = MEM_U32(sp + 24);
+// fdead 6001a000b s1 = MEM_U32(sp + 28);
+// fdead 6001a000b s2 = MEM_U32(sp + 32);
+// fdead 6001a000b s3 = MEM_U32(sp + 36);
+// fdead 6001a000b sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t f_obj_find_symbol_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0;
+L410eb0:
+//obj_find_symbol_value:
+//nop;
+//nop;
+//nop;
+// fdead cb sp = sp + 0xffffffd8;
+//nop;
+// fdead cb MEM_U32(sp + 20) = s0;
+// fdead cb s0 = a0;
+// fdead cb MEM_U32(sp + 28) = ra;
+// fdead cb MEM_U32(sp + 24) = gp;
+// fdead cb MEM_U32(sp + 44) = a1;
+// fdead cb MEM_U32(sp + 48) = a2;
+a0 = a1;
+v0 = f_elfhash(mem, sp, a0);
+// fdead 1b gp = MEM_U32(sp + 24);
+// fdead 1b a1 = MEM_U32(sp + 44);
+//nop;
+// fdead 1b a0 = s0;
+a2 = v0;
+v0 = f_search_symbol_using_hash(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+a1 = v0;
+if (v0 != at) goto L410f14;
+v0 = zero;
+goto L410fb0;
+L410f14:
+//nop;
+// fdead 4f a0 = s0;
+// fdead 4f MEM_U32(sp + 36) = a1;
+v0 = f_obj_sym_shndx(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = MEM_U32(sp + 36);
+at = 0xfff1;
+//nop;
+if (v0 != at) goto L410f54;
+//nop;
+// fdead f a0 = s0;
+//nop;
+v0 = f_obj_dynsym_value(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f ra = MEM_U32(sp + 28);
+goto L410fb4;
+L410f54:
+//nop;
+// fdead f a0 = s0;
+// fdead f MEM_U32(sp + 36) = a1;
+v0 = f_obj_gotsym(mem, sp, a0);
+// fdead f a1 = MEM_U32(sp + 36);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f at = a1 < v0;
+//nop;
+if (at == 0) goto L410f98;
+//nop;
+// fdead f a0 = s0;
+//nop;
+v0 = f_obj_dynsym_value(mem, sp, a0, a1);
+// fdead f t6 = MEM_U32(sp + 48);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f v0 = v0 - t6;
+goto L410fb0;
+L410f98:
+//nop;
+// fdead f a0 = s0;
+//nop;
+v0 = f_obj_dynsym_got(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L410fb0:
+// fdead 4f ra = MEM_U32(sp + 28);
+L410fb4:
+// fdead 4f s0 = MEM_U32(sp + 20);
+// fdead 4f sp = sp + 0x28;
+return v0;
+}
+
+static void f__create_rt_proc_table(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t7 = 0, s0 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L4110e8:
+//_create_rt_proc_table:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffa0;
+// fdead 8b MEM_U32(sp + 36) = s1;
+// fdead 8b s1 = a0;
+a0 = 0x10001a5c;
+//nop;
+// fdead ab MEM_U32(sp + 68) = ra;
+// fdead ab MEM_U32(sp + 60) = s7;
+// fdead ab s7 = a1;
+// fdead ab MEM_U32(sp + 64) = gp;
+// fdead ab MEM_U32(sp + 56) = s6;
+// fdead ab MEM_U32(sp + 52) = s5;
+// fdead ab MEM_U32(sp + 48) = s4;
+// fdead ab MEM_U32(sp + 44) = s3;
+// fdead ab MEM_U32(sp + 40) = s2;
+// fdead ab MEM_U32(sp + 32) = s0;
+// fdead ab MEM_U32(sp + 104) = a2;
+a0 = a0;
+v0 = f_elfhash(mem, sp, a0);
+// fdead 1b gp = MEM_U32(sp + 64);
+// fdead 1b a0 = s1;
+a1 = 0x10001a48;
+//nop;
+a2 = v0;
+a1 = a1;
+v0 = f_search_symbol_using_hash(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 64);
+s4 = v0;
+if ((int)v0 > 0) goto L41116c;
+// bdead 1 v0 = 0xffffffff;
+goto L41145c;
+L41116c:
+//nop;
+// fdead 20000b a0 = s1;
+a1 = s4;
+v0 = f_obj_dynsym_value(mem, sp, a0, a1);
+// fdead 20000b gp = MEM_U32(sp + 64);
+//nop;
+if (v0 == 0) goto L4111f4;
+//nop;
+// fdead 20000b a0 = s1;
+a1 = s4;
+v0 = f_obj_dynsym_value(mem, sp, a0, a1);
+// fdead 20000b gp = MEM_U32(sp + 64);
+s0 = v0;
+//nop;
+// fdead 22000b a0 = s1;
+//nop;
+v0 = f_obj_map_diff(mem, sp, a0);
+// fdead 22000b gp = MEM_U32(sp + 64);
+// fdead 22000b a0 = s1;
+//nop;
+a1 = s4;
+a2 = s0 - v0;
+f_obj_set_dynsym_got(mem, sp, a0, a1, a2);
+// fdead 22000b gp = MEM_U32(sp + 64);
+//nop;
+if (s7 == 0) goto L4111ec;
+//nop;
+// fdead 22000b a0 = s1;
+a1 = s4;
+v0 = f_obj_dynsym_got(mem, sp, a0, a1);
+// fdead 22000b gp = MEM_U32(sp + 64);
+// fdead 22000b MEM_U32(s7 + 0) = v0;
+L4111ec:
+// bdead 1 v0 = 0xffffffff;
+goto L41145c;
+L4111f4:
+//nop;
+// fdead 20000b a0 = s1;
+//nop;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+// fdead 20000b gp = MEM_U32(sp + 64);
+// fdead 20000b MEM_U32(sp + 72) = v0;
+//nop;
+// fdead 20000b a0 = s1;
+//nop;
+v0 = f_obj_pproghdr(mem, sp, a0);
+// fdead 20000b t6 = MEM_U32(sp + 72);
+// fdead 20000b gp = MEM_U32(sp + 64);
+// fdead 20000b v1 = MEM_U16(t6 + 44);
+s5 = zero;
+//nop;
+if (v1 == 0) goto L411458;
+s6 = 0xfb528e4;
+s2 = v0;
+s6 = s6 + 0x20;
+L411240:
+t7 = MEM_U32(s2 + 0);
+at = 0x70000000;
+at = at | 0x1;
+//nop;
+if (t7 != at) goto L411448;
+//nop;
+// fdead fb000f a0 = s1;
+//nop;
+v0 = f_obj_path(mem, sp);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a0 = v0;
+//nop;
+a1 = zero;
+//nop;
+v0 = wrapper_open(mem, a0, a1, a2);
+// fdead fa000f gp = MEM_U32(sp + 64);
+s0 = v0;
+if ((int)v0 >= 0) goto L4112d4;
+//nop;
+// fdead fa000f a0 = s1;
+//nop;
+v0 = f_obj_path(mem, sp);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a0 = s6;
+a1 = 0x10001a70;
+//nop;
+a2 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead fa0007 gp = MEM_U32(sp + 64);
+//nop;
+L4112d4:
+//nop;
+a0 = s0;
+a1 = zero;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a1 = MEM_U32(s2 + 16);
+// fdead fa004f MEM_U32(sp + 16) = s0;
+t8 = MEM_U32(s2 + 4);
+//nop;
+a0 = zero;
+a2 = 0x1;
+a3 = 0x1;
+// fdead 2fa01ef MEM_U32(sp + 20) = t8;
+v0 = wrapper_mmap(mem, a0, a1, a2, a3, MEM_S32(sp + 16), MEM_S32(sp + 20));
+// fdead fa000f gp = MEM_U32(sp + 64);
+at = 0xffffffff;
+s3 = v0;
+if (v0 != at) goto L41136c;
+//nop;
+// fdead fa000f a0 = s1;
+//nop;
+v0 = f_obj_path(mem, sp);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a0 = s6;
+a1 = 0x10001a80;
+//nop;
+a2 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead fa000f gp = MEM_U32(sp + 64);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead fa0007 gp = MEM_U32(sp + 64);
+//nop;
+L41136c:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_close(mem, a0);
+// fdead fa000f gp = MEM_U32(sp + 64);
+// fdead fa000f a0 = s1;
+//nop;
+a1 = s4;
+a2 = s3;
+f_obj_set_dynsym_got(mem, sp, a0, a1, a2);
+// fdead fa000f gp = MEM_U32(sp + 64);
+//nop;
+if (s7 == 0) goto L4113b8;
+//nop;
+// fdead fa000f a0 = s1;
+a1 = s4;
+v0 = f_obj_dynsym_got(mem, sp, a0, a1);
+// fdead fa000f gp = MEM_U32(sp + 64);
+// fdead fa000f MEM_U32(s7 + 0) = v0;
+L4113b8:
+a0 = 0x10001ac4;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_elfhash(mem, sp, a0);
+// fdead fa001f gp = MEM_U32(sp + 64);
+// fdead fa001f a0 = s1;
+a1 = 0x10001aac;
+//nop;
+a2 = v0;
+a1 = a1;
+v0 = f_search_symbol_using_hash(mem, sp, a0, a1, a2);
+// fdead fa000f gp = MEM_U32(sp + 64);
+s4 = v0;
+if ((int)v0 > 0) goto L4113fc;
+// bdead 1 v0 = 0xffffffff;
+goto L41145c;
+L4113fc:
+a1 = 0x10001adc;
+//nop;
+// fdead fa004f a0 = s1;
+a2 = zero;
+a1 = a1;
+v0 = f_obj_find_symbol_value(mem, sp, a0, a1, a2);
+t9 = v0 << 2;
+t9 = t9 + v0;
+// fdead 4fa000f gp = MEM_U32(sp + 64);
+t9 = t9 << 3;
+a2 = t9 + s3;
+//nop;
+// fdead 4fa008f a0 = s1;
+a1 = s4;
+f_obj_set_dynsym_got(mem, sp, a0, a1, a2);
+// fdead fa000f t0 = MEM_U32(sp + 72);
+// fdead fa000f gp = MEM_U32(sp + 64);
+// fdead fa000f v1 = MEM_U16(t0 + 44);
+//nop;
+L411448:
+s5 = s5 + 0x1;
+// fdead fb000f at = s5 < v1;
+s2 = s2 + 0x20;
+if (at != 0) goto L411240;
+L411458:
+// bdead 1 v0 = 0xffffffff;
+L41145c:
+// fdead fb000f ra = MEM_U32(sp + 68);
+// fdead fb000f s0 = MEM_U32(sp + 32);
+// fdead fb000f s1 = MEM_U32(sp + 36);
+// fdead fb000f s2 = MEM_U32(sp + 40);
+// fdead fb000f s3 = MEM_U32(sp + 44);
+// fdead fb000f s4 = MEM_U32(sp + 48);
+// fdead fb000f s5 = MEM_U32(sp + 52);
+// fdead fb000f s6 = MEM_U32(sp + 56);
+// fdead fb000f s7 = MEM_U32(sp + 60);
+// fdead fb000f sp = sp + 0x60;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_obj_otype(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411494:
+//obj_otype:
+v0 = MEM_U32(a0 + 140);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_pfilehdr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4114a0:
+//obj_pfilehdr:
+// fdead b v0 = MEM_U32(a0 + 144);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_paouthdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4114ac:
+//obj_paouthdr:
+v0 = MEM_U32(a0 + 148);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_pscnhdr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4114b8:
+//obj_pscnhdr:
+// fdead b v0 = MEM_U32(a0 + 152);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_phdrr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4114c4:
+//obj_phdrr:
+// fdead b v0 = MEM_U32(a0 + 156);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_pextr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4114dc:
+//obj_pextr:
+// fdead b v0 = MEM_U32(a0 + 172);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_base_address(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411518:
+//obj_base_address:
+v0 = MEM_U32(a0 + 248);
+//nop;
+return v0;
+}
+
+static void f_obj_set_base_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411524:
+//obj_set_base_address:
+MEM_U32(a0 + 248) = a1;
+return;
+}
+
+static uint32_t f_obj_map_address(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41152c:
+//obj_map_address:
+v0 = MEM_U32(a0 + 196);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_map_diff(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0;
+L411540:
+//obj_map_diff:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = f_obj_base_address(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(sp + 36) = v0;
+//nop;
+v0 = f_obj_map_address(mem, sp, a0);
+t6 = MEM_U32(sp + 36);
+// bdead 8009 ra = MEM_U32(sp + 28);
+// bdead 8009 gp = MEM_U32(sp + 24);
+// bdead 8009 sp = sp + 0x28;
+v0 = t6 - v0;
+return v0;
+}
+
+static void f_obj_set_hash_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411614:
+//obj_set_hash_address:
+MEM_U32(a0 + 280) = a1;
+return;
+}
+
+static uint32_t f_obj_dynstr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L41161c:
+//obj_dynstr:
+// fdead b v0 = MEM_U32(a0 + 284);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynstr_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411628:
+//obj_set_dynstr_address:
+MEM_U32(a0 + 284) = a1;
+return;
+}
+
+static uint32_t f_obj_dynsym(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L411630:
+//obj_dynsym:
+// fdead b v0 = MEM_U32(a0 + 288);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynsym_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L41163c:
+//obj_set_dynsym_address:
+MEM_U32(a0 + 288) = a1;
+return;
+}
+
+static void f_obj_set_msym_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411650:
+//obj_set_msym_address:
+MEM_U32(a0 + 292) = a1;
+return;
+}
+
+static uint32_t f_obj_got(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411658:
+//obj_got:
+v0 = MEM_U32(a0 + 296);
+//nop;
+return v0;
+}
+
+static void f_obj_set_got_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411664:
+//obj_set_got_address:
+MEM_U32(a0 + 296) = a1;
+return;
+}
+
+static uint32_t f_obj_dynrel(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L41166c:
+//obj_dynrel:
+// fdead b v0 = MEM_U32(a0 + 304);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynrel_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411678:
+//obj_set_dynrel_address:
+MEM_U32(a0 + 304) = a1;
+return;
+}
+
+static uint32_t f_obj_liblist(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411680:
+//obj_liblist:
+v0 = MEM_U32(a0 + 308);
+//nop;
+return v0;
+}
+
+static void f_obj_set_liblist_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411720:
+//obj_set_liblist_address:
+MEM_U32(a0 + 308) = a1;
+return;
+}
+
+static void f_obj_set_conflict_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411734:
+//obj_set_conflict_address:
+MEM_U32(a0 + 312) = a1;
+return;
+}
+
+static uint32_t f_obj_locgotcount(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41173c:
+//obj_locgotcount:
+v0 = MEM_U32(a0 + 320);
+//nop;
+return v0;
+}
+
+static void f_obj_set_locgotcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411748:
+//obj_set_locgotcount:
+MEM_U32(a0 + 320) = a1;
+return;
+}
+
+static uint32_t f_obj_unrefextno(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411750:
+//obj_unrefextno:
+v0 = MEM_U32(a0 + 396);
+//nop;
+return v0;
+}
+
+static void f_obj_set_unrefextno(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L41175c:
+//obj_set_unrefextno:
+MEM_U32(a0 + 396) = a1;
+return;
+}
+
+static uint32_t f_obj_gotsym(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411764:
+//obj_gotsym:
+v0 = MEM_U32(a0 + 400);
+//nop;
+return v0;
+}
+
+static void f_obj_set_gotsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411770:
+//obj_set_gotsym:
+MEM_U32(a0 + 400) = a1;
+return;
+}
+
+static uint32_t f_obj_timestamp(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411778:
+//obj_timestamp:
+v0 = MEM_U32(a0 + 332);
+//nop;
+return v0;
+}
+
+static void f_obj_set_timestamp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411784:
+//obj_set_timestamp:
+MEM_U32(a0 + 332) = a1;
+return;
+}
+
+static uint32_t f_obj_ichecksum(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41178c:
+//obj_ichecksum:
+v0 = MEM_U32(a0 + 336);
+//nop;
+return v0;
+}
+
+static void f_obj_set_ichecksum(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411798:
+//obj_set_ichecksum:
+MEM_U32(a0 + 336) = a1;
+return;
+}
+
+static void f_obj_set_iversion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4117ac:
+//obj_set_iversion:
+MEM_U32(a0 + 340) = a1;
+return;
+}
+
+static uint32_t f_obj_dynflags(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4117b4:
+//obj_dynflags:
+v0 = MEM_U32(a0 + 316);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynflags(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4117c0:
+//obj_set_dynflags:
+MEM_U32(a0 + 316) = a1;
+return;
+}
+
+static uint32_t f_obj_dynrelsz(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4117c8:
+//obj_dynrelsz:
+v0 = MEM_U32(a0 + 356);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynrelsz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4117d4:
+//obj_set_dynrelsz:
+MEM_U32(a0 + 356) = a1;
+return;
+}
+
+static uint32_t f_obj_dynrelent(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4117dc:
+//obj_dynrelent:
+// fdead b v0 = MEM_U32(a0 + 360);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynrelent(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4117e8:
+//obj_set_dynrelent:
+MEM_U32(a0 + 360) = a1;
+return;
+}
+
+static uint32_t f_obj_dynsymcount(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4117f0:
+//obj_dynsymcount:
+v0 = MEM_U32(a0 + 344);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynsymcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4117fc:
+//obj_set_dynsymcount:
+MEM_U32(a0 + 344) = a1;
+return;
+}
+
+static void f_obj_set_dynsyment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411810:
+//obj_set_dynsyment:
+MEM_U32(a0 + 348) = a1;
+return;
+}
+
+static uint32_t f_obj_dynstrsz(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411818:
+//obj_dynstrsz:
+v0 = MEM_U32(a0 + 352);
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynstrsz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411824:
+//obj_set_dynstrsz:
+MEM_U32(a0 + 352) = a1;
+return;
+}
+
+static uint32_t f_obj_liblistcount(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41182c:
+//obj_liblistcount:
+v0 = MEM_U32(a0 + 364);
+//nop;
+return v0;
+}
+
+static void f_obj_set_liblistcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411838:
+//obj_set_liblistcount:
+MEM_U32(a0 + 364) = a1;
+return;
+}
+
+static uint32_t f_obj_conflictcount(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411840:
+//obj_conflictcount:
+v0 = MEM_U32(a0 + 372);
+//nop;
+return v0;
+}
+
+static void f_obj_set_conflictcount(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L41184c:
+//obj_set_conflictcount:
+MEM_U32(a0 + 372) = a1;
+return;
+}
+
+static void f_obj_set_extgot(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411860:
+//obj_set_extgot:
+MEM_U32(a0 + 300) = a1;
+return;
+}
+
+static uint32_t f_obj_rpath(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411868:
+//obj_rpath:
+v0 = MEM_U32(a0 + 324);
+//nop;
+return v0;
+}
+
+static void f_obj_set_rpath(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411874:
+//obj_set_rpath:
+MEM_U32(a0 + 324) = a1;
+return;
+}
+
+static uint32_t f_obj_soname(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41187c:
+//obj_soname:
+v0 = MEM_U32(a0 + 240);
+//nop;
+return v0;
+}
+
+static void f_obj_set_soname(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L411888:
+//obj_set_soname:
+MEM_U32(a0 + 240) = a1;
+return;
+}
+
+static uint32_t f_obj_rldversion(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411890:
+//obj_rldversion:
+v0 = MEM_U32(a0 + 328);
+//nop;
+return v0;
+}
+
+static void f_obj_set_rldversion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4118d4:
+//obj_set_rldversion:
+MEM_U32(a0 + 328) = a1;
+return;
+}
+
+static uint32_t f_obj_text_start(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4118dc:
+//obj_text_start:
+v0 = MEM_U32(a0 + 252);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_text_size(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4118f0:
+//obj_text_size:
+v0 = MEM_U32(a0 + 256);
+//nop;
+return v0;
+}
+
+static void f_obj_set_text_size(uint8_t *mem, uint32_t sp) {
+L4118fc:
+//obj_set_text_size:
+// fdead b MEM_U32(a0 + 256) = a1;
+return;
+}
+
+static uint32_t f_obj_data_start(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411904:
+//obj_data_start:
+v0 = MEM_U32(a0 + 260);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_bss_start(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411918:
+//obj_bss_start:
+v0 = MEM_U32(a0 + 264);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_data_size(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, a0 = 0;
+L41192c:
+//obj_data_size:
+//nop;
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffd8;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 40) = a0;
+v0 = f_obj_bss_start(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b a0 = MEM_U32(sp + 40);
+//nop;
+// fdead b MEM_U32(sp + 36) = v0;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+// fdead b t6 = MEM_U32(sp + 36);
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b sp = sp + 0x28;
+// fdead b v0 = t6 - v0;
+return v0;
+}
+
+static uint32_t f_obj_bss_size(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411980:
+//obj_bss_size:
+v0 = MEM_U32(a0 + 268);
+//nop;
+return v0;
+}
+
+static void f_obj_set_bss_size(uint8_t *mem, uint32_t sp) {
+L41198c:
+//obj_set_bss_size:
+// fdead b MEM_U32(a0 + 268) = a1;
+return;
+}
+
+static uint32_t f_obj_name(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L411994:
+//obj_name:
+// fdead b v0 = MEM_U32(a0 + 220);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_path(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4119a8:
+//obj_path:
+// fdead b v0 = MEM_U32(a0 + 236);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_init_address(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4119bc:
+//obj_init_address:
+v0 = MEM_U32(a0 + 388);
+//nop;
+return v0;
+}
+
+static void f_obj_set_init_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4119c8:
+//obj_set_init_address:
+MEM_U32(a0 + 388) = a1;
+return;
+}
+
+static void f_obj_set_pixie_init_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4119dc:
+//obj_set_pixie_init_address:
+MEM_U32(a0 + 464) = a1;
+return;
+}
+
+static uint32_t f_obj_fini_address(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4119e4:
+//obj_fini_address:
+v0 = MEM_U32(a0 + 392);
+//nop;
+return v0;
+}
+
+static void f_obj_set_fini_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4119f0:
+//obj_set_fini_address:
+MEM_U32(a0 + 392) = a1;
+return;
+}
+
+static uint32_t f_obj_entry_address(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L4119f8:
+//obj_entry_address:
+// fdead b v0 = MEM_U32(a0 + 272);
+//nop;
+return v0;
+}
+
+static void f_obj_set_rldflag(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t t6 = 0, t7 = 0;
+L411a18:
+//obj_set_rldflag:
+t6 = MEM_U32(a0 + 376);
+//nop;
+t7 = t6 | a1;
+MEM_U32(a0 + 376) = t7;
+return;
+}
+
+static void f_obj_set_cxx_flags(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t t6 = 0, t7 = 0;
+L411acc:
+//obj_set_cxx_flags:
+t6 = MEM_U32(a0 + 456);
+//nop;
+t7 = t6 | a1;
+MEM_U32(a0 + 456) = t7;
+return;
+}
+
+static uint32_t f_obj_dynstrtab(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L411bc8:
+//obj_dynstrtab:
+v0 = MEM_U32(a0 + 284);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_dynstring(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t6 = 0;
+L411bd4:
+//obj_dynstring:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+v0 = f_obj_dynstrtab(mem, sp, a0);
+t6 = MEM_U32(sp + 36);
+// bdead 8009 ra = MEM_U32(sp + 28);
+// bdead 8009 gp = MEM_U32(sp + 24);
+// bdead 8009 sp = sp + 0x20;
+v0 = v0 + t6;
+return v0;
+}
+
+static uint32_t f_obj_dynsym_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t7 = 0;
+L411c88:
+//obj_dynsym_value:
+// fdead 4b t6 = MEM_U32(a0 + 288);
+t7 = a1 << 4;
+// fdead 1004b t8 = t6 + t7;
+// fdead 1004b v0 = MEM_U32(t8 + 4);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_sym_shndx(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t7 = 0;
+L411cf8:
+//obj_sym_shndx:
+// fdead 4b t6 = MEM_U32(a0 + 288);
+t7 = a1 << 4;
+// fdead 1004b t8 = t6 + t7;
+// fdead 1004b v0 = MEM_U16(t8 + 14);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_dynsym_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t7 = 0;
+L411d10:
+//obj_dynsym_name:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b t6 = MEM_U32(a0 + 288);
+t7 = a1 << 4;
+//nop;
+// fdead 1004b t8 = t6 + t7;
+// fdead 1004b a1 = MEM_U32(t8 + 0);
+//nop;
+v0 = f_obj_dynstring(mem, sp, a0, a1);
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_obj_msym_exists(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0;
+L411d6c:
+//obj_msym_exists:
+// fdead 4b v0 = MEM_U32(a0 + 292);
+//nop;
+t6 = zero < v0;
+v0 = t6;
+return v0;
+}
+
+static uint32_t f_obj_dynsym_hash_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0;
+L411d94:
+//obj_dynsym_hash_value:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+//nop;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b MEM_U32(sp + 36) = a1;
+// fdead 4b MEM_U32(sp + 32) = a0;
+v0 = f_obj_msym_exists(mem, sp);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b a0 = MEM_U32(sp + 32);
+// fdead b a1 = MEM_U32(sp + 36);
+//nop;
+if (v0 == 0) goto L411df4;
+// fdead b t6 = MEM_U32(a0 + 292);
+// fdead b t7 = a1 << 3;
+// fdead b t8 = t6 + t7;
+// fdead b v1 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L411df4;
+// fdead b v0 = v1;
+goto L411e0c;
+L411df4:
+//nop;
+//nop;
+//nop;
+v0 = f_get_dynsym_hash_value(mem, sp);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+L411e0c:
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_nbucket(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0;
+L411e1c:
+//obj_nbucket:
+t6 = MEM_U32(a0 + 280);
+//nop;
+v0 = MEM_U32(t6 + 0);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_hash_bucket(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t7 = 0;
+L411e44:
+//obj_hash_bucket:
+// fdead 4b t6 = MEM_U32(a0 + 280);
+t7 = a1 << 2;
+// fdead 1004b t8 = t6 + t7;
+// fdead 1004b v0 = MEM_U32(t8 + 8);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_hash_chain(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t8 = 0;
+L411e5c:
+//obj_hash_chain:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+//nop;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b MEM_U32(sp + 32) = a0;
+// fdead 4b MEM_U32(sp + 36) = a1;
+v0 = f_obj_nbucket(mem, sp, a0);
+// fdead b t6 = MEM_U32(sp + 32);
+// fdead b t0 = MEM_U32(sp + 36);
+// fdead b t7 = MEM_U32(t6 + 280);
+t8 = v0 << 2;
+// fdead 200000b t1 = t0 << 2;
+// fdead 200000b t9 = t7 + t8;
+// fdead 200000b ra = MEM_U32(sp + 28);
+// fdead 200000b t2 = t9 + t1;
+// fdead 200000b v0 = MEM_U32(t2 + 8);
+// fdead 200000b gp = MEM_U32(sp + 24);
+// fdead 200000b sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_obj_dynsym_got(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0;
+L411eb4:
+//obj_dynsym_got:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+//nop;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b MEM_U32(sp + 32) = a0;
+// fdead 4b MEM_U32(sp + 36) = a1;
+v0 = f_obj_gotsym(mem, sp, a0);
+// fdead b a1 = MEM_U32(sp + 36);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b at = a1 < v0;
+//nop;
+if (at == 0) goto L411f0c;
+//nop;
+// fdead b a0 = MEM_U32(sp + 32);
+//nop;
+v0 = f_obj_dynsym_value(mem, sp, a0, a1);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b ra = MEM_U32(sp + 28);
+goto L411f4c;
+L411f0c:
+//nop;
+// fdead b a0 = MEM_U32(sp + 32);
+//nop;
+v0 = f_obj_gotsym(mem, sp, a0);
+// fdead b t6 = MEM_U32(sp + 32);
+// fdead b a1 = MEM_U32(sp + 36);
+// fdead b t7 = MEM_U32(t6 + 300);
+t0 = v0 << 2;
+// fdead 20b t8 = a1 << 2;
+t1 = -t0;
+// fdead 60b t9 = t7 + t8;
+// fdead 60b t2 = t9 + t1;
+// fdead 60b v0 = MEM_U32(t2 + 0);
+// fdead 60b gp = MEM_U32(sp + 24);
+//nop;
+// fdead 60b ra = MEM_U32(sp + 28);
+L411f4c:
+// fdead 60b sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_obj_set_dynsym_got(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, t3 = 0, t4 = 0;
+L411f58:
+//obj_set_dynsym_got:
+//nop;
+//nop;
+//nop;
+// fdead cb sp = sp + 0xffffffe0;
+//nop;
+// fdead cb MEM_U32(sp + 28) = ra;
+// fdead cb MEM_U32(sp + 24) = gp;
+// fdead cb MEM_U32(sp + 32) = a0;
+// fdead cb MEM_U32(sp + 36) = a1;
+// fdead cb MEM_U32(sp + 40) = a2;
+v0 = f_obj_gotsym(mem, sp, a0);
+// fdead b t6 = MEM_U32(sp + 36);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b at = t6 < v0;
+// fdead b ra = MEM_U32(sp + 28);
+if (at != 0) goto L411fd8;
+//nop;
+// fdead b a0 = MEM_U32(sp + 32);
+//nop;
+v0 = f_obj_gotsym(mem, sp, a0);
+// fdead b t8 = MEM_U32(sp + 32);
+// fdead b t0 = MEM_U32(sp + 36);
+// fdead b t9 = MEM_U32(t8 + 300);
+t3 = v0 << 2;
+// fdead 100b t1 = t0 << 2;
+// fdead 100b t7 = MEM_U32(sp + 40);
+t4 = -t3;
+// fdead 300b t2 = t9 + t1;
+// fdead 300b t5 = t2 + t4;
+// fdead 300b gp = MEM_U32(sp + 24);
+// fdead 300b MEM_U32(t5 + 0) = t7;
+// fdead 300b ra = MEM_U32(sp + 28);
+L411fd8:
+// fdead 300b sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_obj_set_msym_ms_hash_value(uint8_t *mem, uint32_t sp) {
+L412074:
+//obj_set_msym_ms_hash_value:
+// fdead b t6 = MEM_U32(a0 + 292);
+// fdead b t7 = a1 << 3;
+// fdead b t8 = t6 + t7;
+// fdead b MEM_U32(t8 + 0) = a2;
+return;
+}
+
+static uint32_t f_obj_pelfhdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L41237c:
+//obj_pelfhdr:
+v0 = MEM_U32(a0 + 224);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_pproghdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L412388:
+//obj_pproghdr:
+v0 = MEM_U32(a0 + 228);
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_psecthdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L412394:
+//obj_psecthdr:
+v0 = MEM_U32(a0 + 232);
+//nop;
+return v0;
+}
+
+static uint64_t f_obj_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0;
+L4123a0:
+//obj_section:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+a0 = a1;
+v0 = f_obj_psecthdr(mem, sp, a0);
+t6 = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 32);
+t7 = t6 << 2;
+t7 = t7 + t6;
+t7 = t7 << 3;
+t8 = v0 + t7;
+// bdead 2000011 gp = MEM_U32(sp + 24);
+t1 = t8 + 0x24;
+t2 = v1;
+L4123f0:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t2 + 0) = at;
+at = MEM_U32(t8 + -8);
+t2 = t2 + 0xc;
+MEM_U32(t2 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t2 + -4) = at;
+if (t8 != t1) goto L4123f0;
+at = MEM_U32(t8 + 0);
+// bdead 815 v0 = v1;
+MEM_U32(t2 + 0) = at;
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_obj_shstrndx(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L412430:
+//obj_shstrndx:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 gp = MEM_U32(sp + 24);
+v0 = MEM_U16(v0 + 50);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_obj_section_index_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L412464:
+//obj_section_index_name:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400200eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 124) = a1;
+v0 = f_obj_shstrndx(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L4124f8;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_shstrndx(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a0 = sp + 0x24;
+//nop;
+a1 = s0;
+a2 = v0;
+temp64 = f_obj_section(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 124);
+//nop;
+a0 = sp + 0x4c;
+a1 = s0;
+temp64 = f_obj_section(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U32(sp + 76);
+t7 = MEM_U32(s0 + 196);
+t9 = MEM_U32(sp + 52);
+// bdead 4018001 gp = MEM_U32(sp + 24);
+t8 = t6 + t7;
+v1 = t8 + t9;
+goto L412504;
+L4124f8:
+v1 = 0x10001c10;
+//nop;
+v1 = v1;
+L412504:
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 s0 = MEM_U32(sp + 20);
+// bdead 11 sp = sp + 0x78;
+v0 = v1;
+return v0;
+}
+
+static uint32_t f_obj_section_vaddr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0;
+L412578:
+//obj_section_vaddr:
+v0 = MEM_U32(a0 + 140);
+at = 0x2;
+if (v0 != at) {
+at = 0x3;
+goto L412598;}
+at = 0x3;
+v0 = MEM_U32(a1 + 12);
+//nop;
+return v0;
+at = 0x3;
+L412598:
+if (v0 != at) {
+v0 = zero;
+goto L4125b0;}
+v0 = zero;
+v0 = MEM_U32(a1 + 12);
+//nop;
+return v0;
+// fdead 0 v0 = zero;
+L4125b0:
+//nop;
+return v0;
+}
+
+static uint32_t f_obj_section_size(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0;
+L4125b8:
+//obj_section_size:
+v0 = MEM_U32(a0 + 140);
+at = 0x2;
+if (v0 != at) {
+at = 0x3;
+goto L4125d8;}
+at = 0x3;
+v0 = MEM_U32(a1 + 16);
+//nop;
+return v0;
+at = 0x3;
+L4125d8:
+if (v0 != at) {
+v0 = zero;
+goto L4125f0;}
+v0 = zero;
+v0 = MEM_U32(a1 + 20);
+//nop;
+return v0;
+// fdead 0 v0 = zero;
+L4125f0:
+//nop;
+return v0;
+}
+
+static uint64_t f_obj_section_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L412638:
+//obj_section_name:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 84) = a1;
+v0 = MEM_U32(a0 + 140);
+at = 0x2;
+if (v0 != at) {
+at = 0x3;
+goto L412670;}
+at = 0x3;
+v0 = a1;
+goto L4126c8;
+at = 0x3;
+L412670:
+if (v0 != at) {
+v0 = zero;
+goto L4126c8;}
+v0 = zero;
+//nop;
+MEM_U32(sp + 80) = a0;
+//nop;
+v0 = f_obj_shstrndx(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 80);
+//nop;
+a0 = sp + 0x28;
+a2 = v0;
+temp64 = f_obj_section(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U32(sp + 80);
+t0 = MEM_U32(sp + 84);
+t6 = MEM_U32(sp + 56);
+t8 = MEM_U32(t7 + 196);
+t1 = MEM_U32(t0 + 0);
+// bdead 2008411 gp = MEM_U32(sp + 24);
+t9 = t6 + t8;
+v0 = t9 + t1;
+goto L4126c8;
+// fdead 0 v0 = zero;
+L4126c8:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x50;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_obj_rld_map(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L4126d8:
+//obj_rld_map:
+v0 = MEM_U32(a0 + 404);
+//nop;
+return v0;
+}
+
+static void f_obj_set_rld_map(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4126e4:
+//obj_set_rld_map:
+MEM_U32(a0 + 404) = a1;
+return;
+}
+
+static uint32_t f_hdr_symptr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0;
+L412700:
+//hdr_symptr:
+t6 = MEM_U32(a0 + 144);
+//nop;
+v0 = MEM_U32(t6 + 8);
+//nop;
+return v0;
+}
+
+static void f_obj_set_delta_class(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4127a4:
+//obj_set_delta_class:
+MEM_U32(a0 + 416) = a1;
+return;
+}
+
+static void f_obj_set_delta_class_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4127b8:
+//obj_set_delta_class_no:
+MEM_U32(a0 + 420) = a1;
+return;
+}
+
+static void f_obj_set_delta_instance(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4127cc:
+//obj_set_delta_instance:
+MEM_U32(a0 + 424) = a1;
+return;
+}
+
+static void f_obj_set_delta_instance_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4127e0:
+//obj_set_delta_instance_no:
+MEM_U32(a0 + 428) = a1;
+return;
+}
+
+static void f_obj_set_delta_reloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4127f4:
+//obj_set_delta_reloc:
+MEM_U32(a0 + 432) = a1;
+return;
+}
+
+static void f_obj_set_delta_reloc_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L412808:
+//obj_set_delta_reloc_no:
+MEM_U32(a0 + 436) = a1;
+return;
+}
+
+static void f_obj_set_delta_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L41284c:
+//obj_set_delta_sym:
+MEM_U32(a0 + 440) = a1;
+return;
+}
+
+static void f_obj_set_delta_sym_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L412860:
+//obj_set_delta_sym_no:
+MEM_U32(a0 + 444) = a1;
+return;
+}
+
+static void f_obj_set_delta_classsym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L412874:
+//obj_set_delta_classsym:
+MEM_U32(a0 + 448) = a1;
+return;
+}
+
+static void f_obj_set_delta_classsym_no(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L412888:
+//obj_set_delta_classsym_no:
+MEM_U32(a0 + 452) = a1;
+return;
+}
+
+static void f_obj_set_symlib(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L412890:
+//obj_set_symlib:
+MEM_U32(a0 + 468) = a1;
+return;
+}
+
+static void f_obj_set_rld_text_resolve_addr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+L4128f0:
+//obj_set_rld_text_resolve_addr:
+MEM_U32(a0 + 472) = a1;
+return;
+//nop;
+//nop;
+//nop;
+//nop;
+}
+
+static uint64_t f_procedure_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L412908:
+//procedure_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if ((int)a1 >= 0) goto L41295c;
+v1 = -a1;
+t6 = v1 << 2;
+if ((int)v1 >= (int)0x10) goto L41295c;
+t6 = t6 - v1;
+t7 = 0x10003830;
+t6 = t6 << 2;
+t6 = t6 + v1;
+t6 = t6 << 2;
+t7 = t7;
+t8 = t6 + t7;
+v0 = MEM_U32(t8 + 4);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L412a44;
+L41295c:
+v0 = MEM_U32(a0 + 156);
+//nop;
+//nop;
+if (v0 == 0) goto L412984;
+a2 = MEM_U32(a0 + 212);
+t0 = MEM_U32(v0 + 24);
+t9 = a1 - a2;
+t2 = a1 << 2;
+if (t9 < t0) goto L41298c;
+L412984:
+v0 = 0xffffffff;
+goto L412a40;
+L41298c:
+t4 = a2 << 2;
+t4 = t4 - a2;
+t2 = t2 - a1;
+t2 = t2 << 2;
+t4 = t4 << 2;
+t1 = MEM_U32(a0 + 164);
+t4 = t4 + a2;
+t2 = t2 + a1;
+t2 = t2 << 2;
+t4 = t4 << 2;
+t5 = -t4;
+t3 = t1 + t2;
+t6 = t3 + t5;
+v1 = MEM_U32(t6 + 4);
+at = 0xffffffff;
+//nop;
+if (v1 != at) goto L4129d8;
+v0 = 0xffffffff;
+goto L412a40;
+L4129d8:
+//nop;
+MEM_U32(sp + 36) = v1;
+MEM_U32(sp + 40) = a0;
+v0 = f_procedure_to_file(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(sp + 32) = v0;
+a1 = v0;
+v0 = f_file_symbol_count(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+a0 = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L412a20;
+t7 = MEM_U32(a0 + 216);
+v1 = v1 + t7;
+goto L412a3c;
+L412a20:
+//nop;
+a1 = MEM_U32(sp + 32);
+MEM_U32(sp + 36) = v1;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+L412a3c:
+v0 = v1;
+L412a40:
+// bdead 19 ra = MEM_U32(sp + 28);
+L412a44:
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_procedure_address(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L412ae0:
+//procedure_address:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if ((int)a1 >= 0) goto L412b14;
+t6 = -a1;
+//nop;
+if ((int)t6 < (int)0x10) goto L412b4c;
+v0 = 0xffffffff;
+goto L412c08;
+L412b14:
+//nop;
+if (a0 == 0) goto L412b44;
+v0 = MEM_U32(a0 + 156);
+//nop;
+//nop;
+if (v0 == 0) goto L412b44;
+t7 = MEM_U32(a0 + 212);
+t9 = MEM_U32(v0 + 24);
+t8 = a1 - t7;
+//nop;
+if (t8 < t9) goto L412b4c;
+L412b44:
+v0 = 0xffffffff;
+goto L412c08;
+L412b4c:
+//nop;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+temp64 = f_procedure_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+at = 0xffffffff;
+a2 = v0;
+if (v0 != at) goto L412bf0;
+t5 = a1 << 2;
+if ((int)a1 >= 0) goto L412bac;
+t0 = -a1;
+t1 = t0 << 2;
+t1 = t1 - t0;
+t2 = 0x10003830;
+t1 = t1 << 2;
+t1 = t1 + t0;
+t1 = t1 << 2;
+t2 = t2;
+t3 = t1 + t2;
+v0 = MEM_U32(t3 + 0);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L412c0c;
+L412bac:
+t7 = MEM_U32(a0 + 212);
+t5 = t5 - a1;
+t8 = t7 << 2;
+t8 = t8 - t7;
+t8 = t8 << 2;
+t5 = t5 << 2;
+t4 = MEM_U32(a0 + 164);
+t5 = t5 + a1;
+t8 = t8 + t7;
+t8 = t8 << 2;
+t5 = t5 << 2;
+t9 = -t8;
+t6 = t4 + t5;
+t0 = t6 + t9;
+v0 = MEM_U32(t0 + 0);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L412c0c;
+L412bf0:
+//nop;
+a1 = a2;
+//nop;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L412c08:
+// bdead 19 ra = MEM_U32(sp + 28);
+L412c0c:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_address_to_procedure(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0,
+s7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L412f98:
+//address_to_procedure:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 60) = ra;
+// fdead 400001e3 MEM_U32(sp + 52) = s7;
+// fdead 400001e3 MEM_U32(sp + 48) = s6;
+s6 = a1;
+s7 = a0;
+// fdead 418001e3 MEM_U32(sp + 56) = gp;
+// fdead 418001e3 MEM_U32(sp + 44) = s5;
+// fdead 418001e3 MEM_U32(sp + 40) = s4;
+// fdead 418001e3 MEM_U32(sp + 36) = s3;
+// fdead 418001e3 MEM_U32(sp + 32) = s2;
+// fdead 418001e3 MEM_U32(sp + 28) = s1;
+// fdead 418001e3 MEM_U32(sp + 24) = s0;
+temp64 = f_address_to_section(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4180001b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L412ff4;
+v0 = 0xffffffff;
+goto L413250;
+L412ff4:
+a3 = MEM_U32(s7 + 212);
+v0 = MEM_U32(s7 + 156);
+s2 = a3;
+//nop;
+if (v0 != 0) goto L413010;
+v0 = 0xffffffff;
+goto L413250;
+L413010:
+v1 = MEM_U32(v0 + 24);
+a2 = MEM_U32(s7 + 408);
+s3 = s2;
+a0 = v1 + s2;
+if (a2 == 0) goto L413118;
+a0 = v1 + 0xffffffff;
+a1 = a2;
+s2 = zero;
+s3 = zero;
+s1 = a0;
+if ((int)a0 <= 0) goto L4130bc;
+s0 = s2 + s1;
+L413040:
+t6 = (int)s0 >> 1;
+if ((int)s0 >= 0) goto L413050;
+at = s0 + 0x1;
+t6 = (int)at >> 1;
+L413050:
+t7 = t6 << 3;
+v1 = a1 + t7;
+v0 = MEM_U32(v1 + 4);
+s0 = t6;
+at = s6 < v0;
+s3 = t6;
+s4 = s2;
+s5 = s1;
+if (at == 0) goto L41307c;
+s1 = t6;
+goto L4130a4;
+L41307c:
+//nop;
+if (s6 < v0) goto L4130a4;
+s2 = s3;
+if (s0 == s1) goto L4130bc;
+t8 = MEM_U32(v1 + 12);
+//nop;
+if (s6 < t8) {
+at = (int)s3 < (int)a0;
+goto L4130c0;}
+at = (int)s3 < (int)a0;
+L4130a4:
+at = (int)s2 < (int)s1;
+if (s2 != s4) goto L4130b4;
+//nop;
+if (s1 == s5) goto L4130bc;
+L4130b4:
+s0 = s2 + s1;
+if (at != 0) goto L413040;
+L4130bc:
+at = (int)s3 < (int)a0;
+L4130c0:
+t9 = s3 << 3;
+if (at == 0) goto L413104;
+v0 = a1 + t9;
+t0 = MEM_U32(v0 + 12);
+//nop;
+t2 = s3 << 3;
+if (s6 < t0) goto L413108;
+L4130e0:
+s3 = s3 + 0x1;
+v0 = v0 + 0x8;
+if ((int)s3 >= (int)a0) goto L413104;
+t1 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if (s6 >= t1) goto L4130e0;
+L413104:
+t2 = s3 << 3;
+L413108:
+t3 = a1 + t2;
+s3 = MEM_U32(t3 + 0);
+s3 = s3 + a3;
+goto L413228;
+L413118:
+s1 = a0 + 0xffffffff;
+MEM_U32(sp + 68) = s1;
+if ((int)s2 >= (int)s1) goto L4131c0;
+s0 = s2 + s1;
+L41312c:
+t6 = (int)s0 >> 1;
+if ((int)s0 >= 0) goto L41313c;
+at = s0 + 0x1;
+t6 = (int)at >> 1;
+L41313c:
+//nop;
+s0 = t6;
+s3 = t6;
+s4 = s2;
+s5 = s1;
+a1 = t6;
+a0 = s7;
+temp64 = f_procedure_address(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 41fe0009 gp = MEM_U32(sp + 56);
+if (s6 >= v0) {
+at = s6 < v0;
+goto L413178;}
+at = s6 < v0;
+s1 = s3;
+goto L4131a8;
+// fdead 0 at = s6 < v0;
+L413178:
+//nop;
+if (at != 0) goto L4131a8;
+t7 = MEM_U32(sp + 68);
+if (s0 == s1) goto L4131c4;
+//nop;
+a0 = s7;
+a1 = s0 + 0x1;
+temp64 = f_procedure_address(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 41f40009 gp = MEM_U32(sp + 56);
+s2 = s3;
+if (s6 < v0) goto L4131c0;
+L4131a8:
+at = (int)s2 < (int)s1;
+if (s2 != s4) goto L4131b8;
+t7 = MEM_U32(sp + 68);
+if (s1 == s5) goto L4131c4;
+L4131b8:
+s0 = s2 + s1;
+if (at != 0) goto L41312c;
+L4131c0:
+t7 = MEM_U32(sp + 68);
+L4131c4:
+a0 = s7;
+//nop;
+if ((int)s3 >= (int)t7) goto L413228;
+//nop;
+s0 = s3 + 0x1;
+a1 = s0;
+temp64 = f_procedure_address(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 41920009 gp = MEM_U32(sp + 56);
+//nop;
+if (s6 < v0) goto L413228;
+t8 = MEM_U32(sp + 68);
+L4131f8:
+s3 = s0;
+a0 = s7;
+if ((int)s0 >= (int)t8) goto L413228;
+//nop;
+s0 = s0 + 0x1;
+a1 = s0;
+temp64 = f_procedure_address(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 41920009 gp = MEM_U32(sp + 56);
+t8 = MEM_U32(sp + 68);
+if (s6 >= v0) goto L4131f8;
+L413228:
+//nop;
+a0 = s7;
+a1 = s3;
+temp64 = f_procedure_address(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 900019 gp = MEM_U32(sp + 56);
+if (s6 >= v0) {
+v0 = s3;
+goto L413250;}
+v0 = s3;
+v0 = 0xffffffff;
+goto L413250;
+L413250:
+// bdead 19 ra = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 s4 = MEM_U32(sp + 40);
+// bdead 19 s5 = MEM_U32(sp + 44);
+// bdead 19 s6 = MEM_U32(sp + 48);
+// bdead 19 s7 = MEM_U32(sp + 52);
+// bdead 19 sp = sp + 0x78;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_symbol_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4134e8:
+//symbol_to_file:
+//nop;
+//nop;
+//nop;
+v1 = MEM_U32(a0 + 216);
+t7 = a1 << 4;
+//nop;
+if (a1 < v1) goto L41352c;
+t6 = MEM_U32(a0 + 172);
+t9 = v1 << 4;
+t1 = -t9;
+t8 = t6 + t7;
+t2 = t8 + t1;
+t3 = MEM_S16(t2 + 2);
+t4 = MEM_U32(a0 + 208);
+v0 = t3 + t4;
+return v0;
+L41352c:
+v1 = 0x10003b70;
+v0 = MEM_U32(a0 + 156);
+v1 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v0 + 72);
+t5 = MEM_U32(a0 + 204);
+a1 = a1 - t5;
+if ((int)v1 >= (int)a2) goto L413598;
+t7 = v1 << 3;
+t6 = MEM_U32(a0 + 160);
+t7 = t7 + v1;
+t7 = t7 << 3;
+a3 = t6 + t7;
+t0 = MEM_U32(a3 + 16);
+//nop;
+//nop;
+if (a1 < t0) goto L413598;
+t9 = MEM_U32(a3 + 20);
+//nop;
+t8 = t9 + t0;
+//nop;
+if (a1 >= t8) goto L413598;
+t1 = MEM_U32(a0 + 208);
+v0 = v1 + t1;
+return v0;
+L413598:
+t2 = MEM_U32(v0 + 32);
+v1 = zero;
+//nop;
+if (a1 < t2) goto L4135b4;
+v0 = 0xffffffff;
+return v0;
+L4135b4:
+at = 0x10003b70;
+MEM_U32(at + 0) = zero;
+if ((int)a2 <= 0) goto L413624;
+a3 = MEM_U32(a0 + 160);
+//nop;
+L4135c8:
+t0 = MEM_U32(a3 + 16);
+//nop;
+//nop;
+if (a1 < t0) goto L413608;
+t3 = MEM_U32(a3 + 20);
+//nop;
+t4 = t3 + t0;
+//nop;
+if (a1 >= t4) goto L413608;
+t5 = MEM_U32(a0 + 208);
+at = 0x10003b70;
+v0 = v1 + t5;
+MEM_U32(at + 0) = v1;
+return v0;
+L413608:
+v1 = v1 + 0x1;
+a3 = a3 + 0x48;
+if ((int)v1 < (int)a2) goto L4135c8;
+at = 0x10003b70;
+//nop;
+MEM_U32(at + 0) = v1;
+L413624:
+v0 = 0xffffffff;
+//nop;
+return v0;
+}
+
+static uint32_t f_type_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413630:
+//type_to_file:
+//nop;
+//nop;
+//nop;
+v1 = 0x10003b74;
+v0 = MEM_U32(a0 + 156);
+v1 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v0 + 72);
+t6 = MEM_U32(a0 + 200);
+a1 = a1 - t6;
+if ((int)v1 >= (int)a2) goto L4136a8;
+t8 = v1 << 3;
+t7 = MEM_U32(a0 + 160);
+t8 = t8 + v1;
+t8 = t8 << 3;
+a3 = t7 + t8;
+t0 = MEM_U32(a3 + 44);
+//nop;
+//nop;
+if (a1 < t0) goto L4136a8;
+t9 = MEM_U32(a3 + 48);
+//nop;
+t1 = t9 + t0;
+//nop;
+if (a1 >= t1) goto L4136a8;
+t2 = MEM_U32(a0 + 208);
+v0 = v1 + t2;
+return v0;
+L4136a8:
+t3 = MEM_U32(v0 + 48);
+v1 = zero;
+//nop;
+if (a1 < t3) goto L4136c4;
+v0 = 0xffffffff;
+return v0;
+L4136c4:
+at = 0x10003b74;
+MEM_U32(at + 0) = zero;
+if ((int)a2 <= 0) goto L413734;
+a3 = MEM_U32(a0 + 160);
+//nop;
+L4136d8:
+t0 = MEM_U32(a3 + 44);
+//nop;
+//nop;
+if (a1 < t0) goto L413718;
+t4 = MEM_U32(a3 + 48);
+//nop;
+t5 = t4 + t0;
+//nop;
+if (a1 >= t5) goto L413718;
+t6 = MEM_U32(a0 + 208);
+at = 0x10003b74;
+v0 = v1 + t6;
+MEM_U32(at + 0) = v1;
+return v0;
+L413718:
+v1 = v1 + 0x1;
+a3 = a3 + 0x48;
+if ((int)v1 < (int)a2) goto L4136d8;
+at = 0x10003b74;
+//nop;
+MEM_U32(at + 0) = v1;
+L413734:
+v0 = 0xffffffff;
+//nop;
+return v0;
+}
+
+static uint32_t f_procedure_to_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413740:
+//procedure_to_file:
+//nop;
+//nop;
+//nop;
+v1 = 0x10003b78;
+v0 = MEM_U32(a0 + 156);
+v1 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v0 + 72);
+t6 = MEM_U32(a0 + 212);
+a1 = a1 - t6;
+if ((int)v1 >= (int)a2) goto L4137b8;
+t8 = v1 << 3;
+t7 = MEM_U32(a0 + 160);
+t8 = t8 + v1;
+t8 = t8 << 3;
+a3 = t7 + t8;
+t0 = MEM_U16(a3 + 40);
+//nop;
+//nop;
+if (a1 < t0) goto L4137b8;
+t9 = MEM_U16(a3 + 42);
+//nop;
+t1 = t9 + t0;
+//nop;
+if (a1 >= t1) goto L4137b8;
+t2 = MEM_U32(a0 + 208);
+v0 = v1 + t2;
+return v0;
+L4137b8:
+t3 = MEM_U32(v0 + 24);
+v1 = zero;
+//nop;
+if (a1 < t3) goto L4137d4;
+v0 = 0xffffffff;
+return v0;
+L4137d4:
+at = 0x10003b78;
+MEM_U32(at + 0) = zero;
+if ((int)a2 <= 0) goto L413844;
+a3 = MEM_U32(a0 + 160);
+//nop;
+L4137e8:
+t0 = MEM_U16(a3 + 40);
+//nop;
+//nop;
+if (a1 < t0) goto L413828;
+t4 = MEM_U16(a3 + 42);
+//nop;
+t5 = t4 + t0;
+//nop;
+if (a1 >= t5) goto L413828;
+t6 = MEM_U32(a0 + 208);
+at = 0x10003b78;
+v0 = v1 + t6;
+MEM_U32(at + 0) = v1;
+return v0;
+L413828:
+v1 = v1 + 0x1;
+a3 = a3 + 0x48;
+if ((int)v1 < (int)a2) goto L4137e8;
+at = 0x10003b78;
+//nop;
+MEM_U32(at + 0) = v1;
+L413844:
+v0 = 0xffffffff;
+//nop;
+return v0;
+}
+
+static uint64_t f_file_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L413870:
+//file_symbol:
+t9 = MEM_U32(a0 + 208);
+t7 = a1 << 3;
+t0 = t9 << 3;
+t6 = MEM_U32(a0 + 160);
+t7 = t7 + a1;
+t0 = t0 + t9;
+t0 = t0 << 3;
+t7 = t7 << 3;
+t1 = -t0;
+t8 = t6 + t7;
+v1 = t8 + t1;
+t2 = MEM_U32(v1 + 20);
+//nop;
+//nop;
+if (t2 != 0) goto L4138b4;
+v0 = 0xffffffff;
+return ((uint64_t)v0 << 32) | v1;
+L4138b4:
+t3 = MEM_U32(v1 + 16);
+t4 = MEM_U32(a0 + 204);
+//nop;
+v0 = t3 + t4;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_file_lang(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t3 = 0, t7 = 0;
+L413990:
+//file_lang:
+// fdead 4b t9 = MEM_U32(a0 + 208);
+t7 = a1 << 3;
+// fdead 1004b t0 = t9 << 3;
+// fdead 1004b t6 = MEM_U32(a0 + 160);
+t7 = t7 + a1;
+// fdead 1004b t0 = t0 + t9;
+// fdead 1004b t0 = t0 << 3;
+t7 = t7 << 3;
+// fdead 1004b t1 = -t0;
+// fdead 1004b t8 = t6 + t7;
+// fdead 1004b t2 = t8 + t1;
+// fdead 1004b v0 = MEM_U32(t2 + 60);
+//nop;
+t3 = v0 >> 27;
+v0 = t3;
+return v0;
+}
+
+static uint32_t f_file_symbol_count(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413a10:
+//file_symbol_count:
+t9 = MEM_U32(a0 + 208);
+t7 = a1 << 3;
+t0 = t9 << 3;
+t6 = MEM_U32(a0 + 160);
+t7 = t7 + a1;
+t0 = t0 + t9;
+t0 = t0 << 3;
+t7 = t7 << 3;
+t1 = -t0;
+t8 = t6 + t7;
+t2 = t8 + t1;
+v0 = MEM_U32(t2 + 20);
+//nop;
+return v0;
+}
+
+static uint32_t f_file_type_base(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L413a48:
+//file_type_base:
+t9 = MEM_U32(a0 + 208);
+t7 = a1 << 3;
+t0 = t9 << 3;
+t6 = MEM_U32(a0 + 160);
+t7 = t7 + a1;
+t0 = t0 + t9;
+t0 = t0 << 3;
+t7 = t7 << 3;
+t1 = -t0;
+t8 = t6 + t7;
+t2 = t8 + t1;
+t3 = MEM_U32(t2 + 44);
+t4 = MEM_U32(a0 + 200);
+v0 = t3 + t4;
+return v0;
+}
+
+static uint32_t f_file_string_base(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L413a84:
+//file_string_base:
+t9 = MEM_U32(a0 + 208);
+t7 = a1 << 3;
+t0 = t9 << 3;
+t6 = MEM_U32(a0 + 160);
+t7 = t7 + a1;
+t0 = t0 + t9;
+t0 = t0 << 3;
+t7 = t7 << 3;
+t1 = -t0;
+t8 = t6 + t7;
+t2 = t8 + t1;
+t3 = MEM_U32(t2 + 8);
+t4 = MEM_U32(a0 + 180);
+v0 = t3 + t4;
+return v0;
+}
+
+static uint32_t f_foreach_rfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t1 = 0, t2 = 0, t4 = 0, t5 = 0,
+t7 = 0, s0 = 0, s5 = 0, s7 = 0, fp_dest;
+uint64_t temp64;
+L413ac0:
+//foreach_rfd:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffb8;
+// fdead 8b MEM_U32(sp + 68) = ra;
+// fdead 8b MEM_U32(sp + 64) = fp;
+// fdead 8b MEM_U32(sp + 60) = gp;
+// fdead 8b MEM_U32(sp + 56) = s7;
+// fdead 8b MEM_U32(sp + 52) = s6;
+// fdead 8b MEM_U32(sp + 48) = s5;
+// fdead 8b MEM_U32(sp + 44) = s4;
+// fdead 8b MEM_U32(sp + 40) = s3;
+// fdead 8b MEM_U32(sp + 36) = s2;
+// fdead 8b MEM_U32(sp + 32) = s1;
+// fdead 8b MEM_U32(sp + 28) = s0;
+// fdead 8b MEM_U32(sp + 76) = a1;
+// fdead 8b v1 = MEM_U32(a0 + 208);
+// fdead 8b t8 = a1 << 3;
+// fdead 8b t2 = v1 << 3;
+// fdead 8b t6 = MEM_U32(a0 + 160);
+// fdead 8b t8 = t8 + a1;
+// fdead 8b t2 = t2 + v1;
+// fdead 8b t2 = t2 << 3;
+// fdead 8b t8 = t8 << 3;
+// fdead 8b t3 = -t2;
+// fdead 8b t9 = t6 + t8;
+// fdead 8b v0 = t9 + t3;
+t4 = MEM_U32(v0 + 52);
+// fdead 208b t7 = MEM_U32(a0 + 188);
+t1 = MEM_U32(v0 + 56);
+t5 = t4 << 2;
+// fdead 648b s2 = a0;
+// fdead 648b s6 = a3;
+s7 = a2;
+// fdead 100648b t0 = t5 + t7;
+if (t1 != 0) goto L413bcc;
+// fdead 100648b t6 = MEM_U32(a0 + 156);
+// fdead 100648b s4 = MEM_U32(sp + 92);
+// fdead 100648b t8 = MEM_U32(t6 + 72);
+// fdead 100648b s3 = MEM_U32(sp + 88);
+// fdead 100648b t2 = v1 + t8;
+// fdead 100648b at = v1 < t2;
+// fdead 100648b s0 = v1;
+if (at == 0) goto L413c40;
+s5 = 0xffffffff;
+// fdead 140648b a0 = s2;
+L413b78:
+// fdead 80140649b a1 = s0;
+// fdead 80140649b a2 = s6;
+// fdead 80140649b a3 = s3;
+// fdead 80140649b MEM_U32(sp + 16) = s4;
+fp_dest = s7;
+// bdead 60041fa01e1 t9 = s7;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// fdead 80140001b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == s5) goto L413ba4;
+// fdead 80140001b ra = MEM_U32(sp + 68);
+goto L413c48;
+L413ba4:
+// fdead 80140001b t3 = MEM_U32(s2 + 156);
+// fdead 80140001b t9 = MEM_U32(s2 + 208);
+// fdead 80140001b t4 = MEM_U32(t3 + 72);
+// fdead 80140001b s0 = s0 + 0x1;
+// fdead 80140001b t5 = t9 + t4;
+// fdead 80140001b at = s0 < t5;
+// fdead 80140001b a0 = s2;
+if (at != 0) goto L413b78;
+v0 = 0xffffffff;
+goto L413c44;
+L413bcc:
+t7 = t1 << 2;
+// fdead 101648b fp = t7 + t0;
+// fdead 101648b at = t0 < fp;
+// fdead 101648b s1 = t0;
+if (at == 0) goto L413c40;
+// fdead 101648b s4 = MEM_U32(sp + 92);
+// fdead 101648b s3 = MEM_U32(sp + 88);
+s5 = 0xffffffff;
+L413bec:
+// fdead 80141649b t6 = MEM_U32(s1 + 0);
+// fdead 80141649b t8 = MEM_U32(s2 + 208);
+// fdead 80141649b t2 = MEM_U32(sp + 76);
+// fdead 80141649b s0 = t6 + t8;
+// fdead 80141649b a0 = s2;
+if (s0 == t2) goto L413c30;
+// fdead 80141649b a1 = s0;
+// fdead 80141649b a2 = s6;
+// fdead 80141649b a3 = s3;
+// fdead 80141649b MEM_U32(sp + 16) = s4;
+fp_dest = s7;
+// bdead 600c1fc01e1 t9 = s7;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// fdead 80140001b gp = MEM_U32(sp + 60);
+// fdead 80140001b s1 = s1 + 0x4;
+if (v0 == s5) goto L413c34;
+// fdead 80140001b ra = MEM_U32(sp + 68);
+goto L413c48;
+L413c30:
+// fdead 80141649b s1 = s1 + 0x4;
+L413c34:
+// fdead 80141649b at = s1 < fp;
+//nop;
+if (at != 0) goto L413bec;
+L413c40:
+v0 = 0xffffffff;
+L413c44:
+// fdead 80141649b ra = MEM_U32(sp + 68);
+L413c48:
+// fdead 80141649b s0 = MEM_U32(sp + 28);
+// fdead 80141649b s1 = MEM_U32(sp + 32);
+// fdead 80141649b s2 = MEM_U32(sp + 36);
+// fdead 80141649b s3 = MEM_U32(sp + 40);
+// fdead 80141649b s4 = MEM_U32(sp + 44);
+// fdead 80141649b s5 = MEM_U32(sp + 48);
+// fdead 80141649b s6 = MEM_U32(sp + 52);
+// fdead 80141649b s7 = MEM_U32(sp + 56);
+// fdead 80141649b fp = MEM_U32(sp + 64);
+// fdead 80141649b sp = sp + 0x48;
+return v0;
+}
+
+static uint32_t f_st_file_name(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0, t3 = 0;
+L413c74:
+//st_file_name:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffe0;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b t9 = MEM_U32(a0 + 208);
+// fdead b t7 = a1 << 3;
+// fdead b t0 = t9 << 3;
+// fdead b t6 = MEM_U32(a0 + 160);
+// fdead b t7 = t7 + a1;
+// fdead b t0 = t0 + t9;
+// fdead b t0 = t0 << 3;
+// fdead b t7 = t7 << 3;
+// fdead b t1 = -t0;
+// fdead b t8 = t6 + t7;
+// fdead b t2 = t8 + t1;
+// fdead b t3 = MEM_U32(t2 + 12);
+//nop;
+//nop;
+if (t3 != 0) goto L413cd0;
+v0 = zero;
+goto L413d20;
+L413cd0:
+//nop;
+// fdead b MEM_U32(sp + 32) = a0;
+// fdead b MEM_U32(sp + 36) = a1;
+v0 = f_file_string_base(mem, sp, a0, a1);
+// fdead b a0 = MEM_U32(sp + 32);
+// fdead b a1 = MEM_U32(sp + 36);
+// fdead b t7 = MEM_U32(a0 + 208);
+// fdead b t5 = a1 << 3;
+// fdead b t9 = t7 << 3;
+// fdead b t4 = MEM_U32(a0 + 160);
+// fdead b t5 = t5 + a1;
+// fdead b t9 = t9 + t7;
+// fdead b t9 = t9 << 3;
+// fdead b t5 = t5 << 3;
+// fdead b t0 = -t9;
+// fdead b t6 = t4 + t5;
+// fdead b t8 = t6 + t0;
+// fdead b t1 = MEM_U32(t8 + 4);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b v0 = t1 + v0;
+L413d20:
+// fdead b ra = MEM_U32(sp + 28);
+// fdead b sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t f_symbol_class(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413d98:
+//symbol_class:
+//nop;
+//nop;
+//nop;
+t6 = -a1;
+if ((int)a1 >= 0) goto L413dd4;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v0 = MEM_U32(t9 + 8);
+//nop;
+t0 = v0 << 6;
+v0 = t0 >> 27;
+return ((uint64_t)v0 << 32) | v1;
+L413dd4:
+v1 = MEM_U32(a0 + 216);
+t1 = a1 << 2;
+t1 = t1 - a1;
+if (a1 < v1) goto L413e18;
+t2 = MEM_U32(a0 + 172);
+t3 = a1 << 4;
+t5 = v1 << 4;
+t6 = -t5;
+t4 = t2 + t3;
+t7 = t4 + t6;
+v0 = MEM_U32(t7 + 12);
+//nop;
+t8 = v0 << 6;
+t9 = t8 >> 27;
+v0 = t9;
+return ((uint64_t)v0 << 32) | v1;
+L413e18:
+t3 = MEM_U32(a0 + 204);
+t0 = MEM_U32(a0 + 168);
+t5 = t3 << 2;
+t5 = t5 - t3;
+t5 = t5 << 2;
+t1 = t1 << 2;
+t4 = -t5;
+t2 = t0 + t1;
+t6 = t2 + t4;
+v0 = MEM_U32(t6 + 8);
+//nop;
+t7 = v0 << 6;
+v0 = t7 >> 27;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_symbol_type(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L413e54:
+//symbol_type:
+//nop;
+//nop;
+//nop;
+t6 = -a1;
+if ((int)a1 >= 0) goto L413e90;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v0 = MEM_U32(t9 + 8);
+//nop;
+t0 = v0 >> 26;
+v0 = t0;
+return ((uint64_t)v0 << 32) | v1;
+L413e90:
+v1 = MEM_U32(a0 + 216);
+t2 = a1 << 4;
+t4 = v1 << 4;
+if (a1 < v1) goto L413ec8;
+t1 = MEM_U32(a0 + 172);
+t5 = -t4;
+t3 = t1 + t2;
+t6 = t3 + t5;
+v0 = MEM_U32(t6 + 12);
+//nop;
+t7 = v0 >> 26;
+v0 = t7;
+return ((uint64_t)v0 << 32) | v1;
+L413ec8:
+t1 = MEM_U32(a0 + 204);
+t9 = a1 << 2;
+t2 = t1 << 2;
+t8 = MEM_U32(a0 + 168);
+t9 = t9 - a1;
+t2 = t2 - t1;
+t2 = t2 << 2;
+t9 = t9 << 2;
+t4 = -t2;
+t0 = t8 + t9;
+t3 = t0 + t4;
+v0 = MEM_U32(t3 + 8);
+//nop;
+t5 = v0 >> 26;
+v0 = t5;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_symbol_value(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L413f0c:
+//symbol_value:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s1 = a1;
+// fdead 400600eb MEM_U32(sp + 36) = ra;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+if ((int)a1 >= 0) goto L413f5c;
+t6 = -a1;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v0 = MEM_U32(t9 + 4);
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L414130;
+L413f5c:
+v1 = MEM_U32(s0 + 216);
+t1 = s1 << 4;
+t3 = v1 << 4;
+if (s1 < v1) goto L413f98;
+t0 = MEM_U32(s0 + 172);
+t4 = -t3;
+t2 = t0 + t1;
+t5 = t2 + t4;
+t6 = MEM_U32(t5 + 8);
+t7 = MEM_U32(s0 + 252);
+t9 = MEM_U32(s0 + 248);
+t8 = t6 - t7;
+v0 = t8 + t9;
+goto L41412c;
+L413f98:
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x9;
+//nop;
+if (v0 != at) goto L4140a4;
+//nop;
+a0 = s0;
+a1 = s1;
+v0 = f_symbol_to_outer_scope_symbol(mem, sp, a0, a1);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s0;
+a1 = v0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x7;
+//nop;
+if (v0 != at) goto L4140a4;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = s0;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x11;
+//nop;
+if (v0 != at) goto L4140a4;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = s0;
+v0 = f_symbol_name(mem, sp, a0, a1);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+a0 = s0;
+//nop;
+a1 = v0;
+a2 = 0x1;
+v0 = f_search_externals(mem, sp, a0, a1, a2);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0xffffffff;
+a1 = v0;
+if (v0 == at) goto L4140a4;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U32(s0 + 204);
+t1 = s1 << 2;
+t4 = t2 << 2;
+t0 = MEM_U32(s0 + 168);
+t1 = t1 - s1;
+t4 = t4 - t2;
+t4 = t4 << 2;
+t1 = t1 << 2;
+t5 = -t4;
+t3 = t0 + t1;
+t6 = t3 + t5;
+t7 = MEM_U32(t6 + 4);
+// bdead 10019 gp = MEM_U32(sp + 32);
+t8 = (int)t7 >> 3;
+if ((int)t7 >= 0) goto L41409c;
+at = t7 + 0x7;
+t8 = (int)at >> 3;
+L41409c:
+v0 = t8 + v0;
+goto L41412c;
+L4140a4:
+t2 = MEM_U32(s0 + 204);
+t0 = s1 << 2;
+t4 = t2 << 2;
+t9 = MEM_U32(s0 + 168);
+t0 = t0 - s1;
+t4 = t4 - t2;
+t4 = t4 << 2;
+t0 = t0 << 2;
+t3 = -t4;
+t1 = t9 + t0;
+v1 = t1 + t3;
+t5 = MEM_U32(v1 + 8);
+//nop;
+t6 = t5 >> 26;
+t7 = t6 + 0xffffffff;
+//nop;
+if (t7 >= 0xe) goto L414124;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L41410c;
+case 1: goto L41410c;
+case 2: goto L414124;
+case 3: goto L414124;
+case 4: goto L41410c;
+case 5: goto L41410c;
+case 6: goto L414124;
+case 7: goto L414124;
+case 8: goto L414124;
+case 9: goto L414124;
+case 10: goto L414124;
+case 11: goto L414124;
+case 12: goto L414124;
+case 13: goto L41410c;
+}
+L41410c:
+t8 = MEM_U32(v1 + 4);
+t9 = MEM_U32(s0 + 252);
+t2 = MEM_U32(s0 + 248);
+t0 = t8 - t9;
+v0 = t0 + t2;
+goto L41412c;
+L414124:
+v0 = MEM_U32(v1 + 4);
+//nop;
+L41412c:
+// bdead 19 ra = MEM_U32(sp + 36);
+L414130:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_symbol_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L414140:
+//symbol_iaux:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+if ((int)a1 >= 0) goto L414194;
+at = 0xf0000;
+at = at | 0xffff;
+t6 = -a1;
+if (a1 == at) goto L414194;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v1 = MEM_U32(t9 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+v0 = v1 & at;
+goto L414274;
+L414194:
+a2 = MEM_U32(a0 + 216);
+t2 = a1 << 4;
+t4 = a2 << 4;
+if (a1 < a2) goto L4141dc;
+t1 = MEM_U32(a0 + 172);
+t5 = -t4;
+t3 = t1 + t2;
+v0 = t3 + t5;
+v1 = MEM_U32(v0 + 12);
+at = 0xf0000;
+t7 = MEM_S16(v0 + 2);
+t8 = MEM_U32(a0 + 208);
+at = at | 0xffff;
+t6 = v1 & at;
+v1 = t6;
+a3 = t7 + t8;
+goto L41423c;
+L4141dc:
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+t2 = MEM_U32(a0 + 204);
+t0 = a1 << 2;
+t4 = t2 << 2;
+t9 = MEM_U32(a0 + 168);
+t0 = t0 - a1;
+t4 = t4 - t2;
+t4 = t4 << 2;
+t0 = t0 << 2;
+t3 = -t4;
+t1 = t9 + t0;
+t5 = t1 + t3;
+v1 = MEM_U32(t5 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+t6 = v1 & at;
+// bdead 40008029 gp = MEM_U32(sp + 24);
+a3 = v0;
+v1 = t6;
+L41423c:
+at = 0xf0000;
+at = at | 0xffff;
+v0 = 0xf0000;
+if (v1 != at) goto L414254;
+v0 = v0 | 0xffff;
+goto L414274;
+L414254:
+//nop;
+a1 = a3;
+MEM_U32(sp + 36) = v1;
+v0 = f_file_type_base(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L414274:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_file_symbol_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L414284:
+//file_symbol_iaux:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+if ((int)a2 >= 0) goto L4142d8;
+a3 = 0xf0000;
+a3 = a3 | 0xffff;
+t6 = -a2;
+if (a2 == a3) goto L4142d8;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v1 = MEM_U32(t9 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+v0 = v1 & at;
+goto L41438c;
+L4142d8:
+v0 = MEM_U32(a0 + 216);
+a3 = 0xf0000;
+a3 = a3 | 0xffff;
+if (a2 < v0) goto L41431c;
+t1 = MEM_U32(a0 + 172);
+t2 = a2 << 4;
+t4 = v0 << 4;
+t5 = -t4;
+t3 = t1 + t2;
+t6 = t3 + t5;
+v1 = MEM_U32(t6 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t7 = v1 & at;
+v1 = t7;
+goto L41435c;
+L41431c:
+t1 = MEM_U32(a0 + 204);
+t9 = a2 << 2;
+t2 = t1 << 2;
+t8 = MEM_U32(a0 + 168);
+t9 = t9 - a2;
+t2 = t2 - t1;
+t2 = t2 << 2;
+t9 = t9 << 2;
+t4 = -t2;
+t0 = t8 + t9;
+t3 = t0 + t4;
+v1 = MEM_U32(t3 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+t5 = v1 & at;
+v1 = t5;
+L41435c:
+//nop;
+if (v1 != a3) goto L41436c;
+v0 = a3;
+goto L41438c;
+L41436c:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+v0 = f_file_type_base(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L41438c:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_symbol_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L41439c:
+//symbol_isym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+if ((int)a1 >= 0) goto L4143f0;
+at = 0xf0000;
+at = at | 0xffff;
+t6 = -a1;
+if (a1 == at) goto L4143f0;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v1 = MEM_U32(t9 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+v0 = v1 & at;
+goto L4144d0;
+L4143f0:
+a2 = MEM_U32(a0 + 216);
+t2 = a1 << 4;
+t4 = a2 << 4;
+if (a1 < a2) goto L414438;
+t1 = MEM_U32(a0 + 172);
+t5 = -t4;
+t3 = t1 + t2;
+v0 = t3 + t5;
+v1 = MEM_U32(v0 + 12);
+at = 0xf0000;
+t7 = MEM_S16(v0 + 2);
+t8 = MEM_U32(a0 + 208);
+at = at | 0xffff;
+t6 = v1 & at;
+v1 = t6;
+a3 = t7 + t8;
+goto L414498;
+L414438:
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+t2 = MEM_U32(a0 + 204);
+t0 = a1 << 2;
+t4 = t2 << 2;
+t9 = MEM_U32(a0 + 168);
+t0 = t0 - a1;
+t4 = t4 - t2;
+t4 = t4 << 2;
+t0 = t0 << 2;
+t3 = -t4;
+t1 = t9 + t0;
+t5 = t1 + t3;
+v1 = MEM_U32(t5 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+t6 = v1 & at;
+// bdead 40008029 gp = MEM_U32(sp + 24);
+a3 = v0;
+v1 = t6;
+L414498:
+at = 0xf0000;
+at = at | 0xffff;
+v0 = 0xf0000;
+if (v1 != at) goto L4144b0;
+v0 = v0 | 0xffff;
+goto L4144d0;
+L4144b0:
+//nop;
+a1 = a3;
+MEM_U32(sp + 36) = v1;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L4144d0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_file_symbol_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4144e0:
+//file_symbol_isym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+if ((int)a2 >= 0) goto L414534;
+a3 = 0xf0000;
+a3 = a3 | 0xffff;
+t6 = -a2;
+if (a2 == a3) goto L414534;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v1 = MEM_U32(t9 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+v0 = v1 & at;
+goto L4145e8;
+L414534:
+v0 = MEM_U32(a0 + 216);
+a3 = 0xf0000;
+a3 = a3 | 0xffff;
+if (a2 < v0) goto L414578;
+t1 = MEM_U32(a0 + 172);
+t2 = a2 << 4;
+t4 = v0 << 4;
+t5 = -t4;
+t3 = t1 + t2;
+t6 = t3 + t5;
+v1 = MEM_U32(t6 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t7 = v1 & at;
+v1 = t7;
+goto L4145b8;
+L414578:
+t1 = MEM_U32(a0 + 204);
+t9 = a2 << 2;
+t2 = t1 << 2;
+t8 = MEM_U32(a0 + 168);
+t9 = t9 - a2;
+t2 = t2 - t1;
+t2 = t2 << 2;
+t9 = t9 << 2;
+t4 = -t2;
+t0 = t8 + t9;
+t3 = t0 + t4;
+v1 = MEM_U32(t3 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+t5 = v1 & at;
+v1 = t5;
+L4145b8:
+//nop;
+if (v1 != a3) goto L4145c8;
+v0 = a3;
+goto L4145e8;
+L4145c8:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L4145e8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint64_t f_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+L414768:
+//end_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+at = 0x6;
+if (v0 == at) {
+at = 0xe;
+goto L4147b0;}
+at = 0xe;
+if (v0 != at) {
+at = 0x7;
+goto L4147d0;}
+at = 0x7;
+L4147b0:
+//nop;
+//nop;
+//nop;
+temp64 = f_procedure_end_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L41481c;
+at = 0x7;
+L4147d0:
+if (v0 == at) {
+at = 0xb;
+goto L4147e8;}
+at = 0xb;
+//nop;
+if (v0 == at) goto L4147e8;
+v0 = 0xffffffff;
+goto L414818;
+L4147e8:
+//nop;
+//nop;
+//nop;
+v0 = f_symbol_isym(mem, sp, a0, a1);
+at = 0xf0000;
+// bdead d gp = MEM_U32(sp + 24);
+at = at | 0xffff;
+v1 = v0;
+if (v0 != at) goto L414814;
+v0 = 0xffffffff;
+goto L414818;
+L414814:
+v0 = v1 + 0xffffffff;
+L414818:
+// bdead 19 ra = MEM_U32(sp + 28);
+L41481c:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_file_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+L414828:
+//file_end_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 36) = a1;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+a1 = a2;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 40);
+at = 0x6;
+if (v0 == at) {
+at = 0xe;
+goto L41487c;}
+at = 0xe;
+if (v0 != at) {
+at = 0x7;
+goto L41489c;}
+at = 0x7;
+L41487c:
+//nop;
+//nop;
+//nop;
+temp64 = f_file_procedure_end_symbol(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L4148e8;
+at = 0x7;
+L41489c:
+if (v0 == at) {
+at = 0xb;
+goto L4148b4;}
+at = 0xb;
+//nop;
+if (v0 == at) goto L4148b4;
+v0 = 0xffffffff;
+goto L4148e4;
+L4148b4:
+//nop;
+//nop;
+//nop;
+v0 = f_file_symbol_isym(mem, sp, a0, a1, a2);
+at = 0xf0000;
+// bdead d gp = MEM_U32(sp + 24);
+at = at | 0xffff;
+v1 = v0;
+if (v0 != at) goto L4148e0;
+v0 = 0xffffffff;
+goto L4148e4;
+L4148e0:
+v0 = v1 + 0xffffffff;
+L4148e4:
+// bdead 19 ra = MEM_U32(sp + 28);
+L4148e8:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_procedure_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+L4148f4:
+//procedure_end_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+temp64 = f_symbol_iaux(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+at = 0xf0000;
+// bdead 4000001d gp = MEM_U32(sp + 24);
+at = at | 0xffff;
+a1 = v0;
+if (v0 != at) goto L41493c;
+v0 = MEM_U32(sp + 36);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L414958;
+L41493c:
+//nop;
+a0 = MEM_U32(sp + 32);
+//nop;
+temp64 = f_aux_isym(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+v0 = v0 + 0xffffffff;
+// bdead 19 ra = MEM_U32(sp + 28);
+L414958:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_file_procedure_end_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+L414964:
+//file_procedure_end_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+temp64 = f_file_symbol_iaux(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+at = 0xf0000;
+// bdead 4000001d gp = MEM_U32(sp + 24);
+at = at | 0xffff;
+a2 = v0;
+if (v0 != at) goto L4149b0;
+v0 = MEM_U32(sp + 40);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L4149d0;
+L4149b0:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+//nop;
+temp64 = f_file_aux_isym(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+v0 = v0 + 0xffffffff;
+// bdead 19 ra = MEM_U32(sp + 28);
+L4149d0:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4149dc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, fp = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 60) = ra;
+// fdead 400001e3 MEM_U32(sp + 56) = fp;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+s1 = a0;
+fp = a1;
+// fdead c00401e3 MEM_U32(sp + 52) = gp;
+// fdead c00401e3 MEM_U32(sp + 48) = s7;
+// fdead c00401e3 MEM_U32(sp + 44) = s6;
+// fdead c00401e3 MEM_U32(sp + 40) = s5;
+// fdead c00401e3 MEM_U32(sp + 36) = s4;
+// fdead c00401e3 MEM_U32(sp + 32) = s3;
+// fdead c00401e3 MEM_U32(sp + 28) = s2;
+// fdead c00401e3 MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 72) = a2;
+temp64 = f_address_to_procedure(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c004001b gp = MEM_U32(sp + 52);
+at = 0xffffffff;
+a1 = v0;
+if (v0 != at) goto L414a44;
+v0 = 0xffffffff;
+goto L414b64;
+L414a44:
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_procedure_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c004001b gp = MEM_U32(sp + 52);
+at = 0xffffffff;
+s0 = v0;
+if (v0 != at) goto L414a6c;
+v0 = 0xffffffff;
+goto L414b64;
+L414a6c:
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_procedure_end_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c006000b gp = MEM_U32(sp + 52);
+s5 = v0;
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s3 = s0;
+// bdead c056001b gp = MEM_U32(sp + 52);
+s0 = s0 + 0x1;
+s4 = v0;
+s2 = 0x1;
+if (s0 == s5) goto L414b60;
+s7 = 0x1;
+s6 = 0x7;
+L414ab4:
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe001b gp = MEM_U32(sp + 52);
+//nop;
+if (v0 != s6) goto L414b54;
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+//nop;
+if (v0 == s7) goto L414b14;
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_end_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fc001b gp = MEM_U32(sp + 52);
+at = 0xffffffff;
+s0 = v0;
+if (v0 != at) goto L414b54;
+v0 = s3;
+goto L414b64;
+L414b14:
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = v0 + s4;
+at = fp < t6;
+// bdead c1fe0017 gp = MEM_U32(sp + 52);
+//nop;
+if (at == 0) goto L414b40;
+v0 = s3;
+goto L414b64;
+L414b40:
+//nop;
+if (s2 != 0) goto L414b50;
+s3 = s0;
+goto L414b54;
+L414b50:
+s2 = zero;
+L414b54:
+s0 = s0 + 0x1;
+//nop;
+if (s0 != s5) goto L414ab4;
+L414b60:
+v0 = s3;
+L414b64:
+// bdead 19 ra = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 s3 = MEM_U32(sp + 32);
+// bdead 19 s4 = MEM_U32(sp + 36);
+// bdead 19 s5 = MEM_U32(sp + 40);
+// bdead 19 s6 = MEM_U32(sp + 44);
+// bdead 19 s7 = MEM_U32(sp + 48);
+// bdead 19 fp = MEM_U32(sp + 56);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_symbol_to_outer_scope_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0;
+uint64_t temp64;
+L414bd0:
+//symbol_to_outer_scope_symbol:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000006b MEM_U32(sp + 60) = ra;
+// fdead 4000006b MEM_U32(sp + 56) = gp;
+// fdead 4000006b MEM_U32(sp + 52) = s7;
+// fdead 4000006b MEM_U32(sp + 48) = s6;
+// fdead 4000006b MEM_U32(sp + 44) = s5;
+// fdead 4000006b MEM_U32(sp + 40) = s4;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+t6 = MEM_U32(a0 + 216);
+s0 = a1;
+s1 = a0;
+if (a1 < t6) goto L414c24;
+v0 = 0xffffffff;
+goto L414d8c;
+L414c24:
+//nop;
+a0 = s1;
+a1 = s0;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 56);
+a0 = s1;
+//nop;
+a1 = v0;
+//nop;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s0 = s0 + 0xffffffff;
+// bdead 4006000b gp = MEM_U32(sp + 56);
+s3 = v0;
+if (v0 >= s0) goto L414ce4;
+s6 = 0xe;
+s5 = 0x7;
+s4 = 0x6;
+s2 = 0x8;
+L414c70:
+//nop;
+a0 = s1;
+a1 = s0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40fe000b gp = MEM_U32(sp + 56);
+s7 = v0;
+if (v0 == s4) goto L414c94;
+//nop;
+if (v0 != s6) goto L414c9c;
+L414c94:
+v0 = s0;
+goto L414d8c;
+L414c9c:
+//nop;
+if (v0 != s2) goto L414cc0;
+//nop;
+a0 = s1;
+a1 = s0;
+v0 = f_symbol_isym(mem, sp, a0, a1);
+// bdead 41fc000b gp = MEM_U32(sp + 56);
+s0 = v0;
+goto L414cd0;
+L414cc0:
+//nop;
+if (v0 != s5) goto L414cd0;
+MEM_U32(sp + 64) = s7;
+goto L414ce4;
+L414cd0:
+s0 = s0 + 0xffffffff;
+//nop;
+if (s3 < s0) goto L414c70;
+MEM_U32(sp + 64) = s7;
+L414ce4:
+s7 = MEM_U32(sp + 64);
+at = s0 < s3;
+s4 = 0x6;
+s5 = 0x7;
+s6 = 0xe;
+if (at == 0) goto L414d04;
+v0 = 0xffffffff;
+goto L414d8c;
+L414d04:
+t7 = 0x10003b80;
+t8 = 0x1;
+t7 = MEM_S8(t7 + 0);
+a0 = s1;
+//nop;
+if (t7 == 0) goto L414d24;
+v0 = s0;
+goto L414d8c;
+L414d24:
+at = 0x10003b80;
+//nop;
+a1 = s0;
+MEM_U8(at + 0) = (uint8_t)t8;
+v0 = f_symbol_to_outer_scope_symbol(mem, sp, a0, a1);
+// bdead 1e6000b gp = MEM_U32(sp + 56);
+s2 = v0;
+at = 0x10003b80;
+//nop;
+a0 = s1;
+a1 = v0;
+MEM_U8(at + 0) = (uint8_t)zero;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1ea0009 gp = MEM_U32(sp + 56);
+at = 0xffffffff;
+//nop;
+if (s2 == at) goto L414d80;
+//nop;
+if (s7 != s5) goto L414d80;
+//nop;
+if (v0 == s4) goto L414d88;
+if (v0 == s6) {
+v0 = s2;
+goto L414d8c;}
+v0 = s2;
+L414d80:
+v0 = s0;
+goto L414d8c;
+L414d88:
+v0 = s2;
+L414d8c:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 s6 = MEM_U32(sp + 48);
+// bdead 9 s7 = MEM_U32(sp + 52);
+// bdead 9 sp = sp + 0x50;
+return v0;
+}
+
+static uint32_t f_symbol_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L414db8:
+//symbol_name:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s0 = a0;
+s1 = a1;
+// fdead 4006006b MEM_U32(sp + 36) = ra;
+// fdead 4006006b MEM_U32(sp + 32) = gp;
+if ((int)a1 >= 0) goto L414e08;
+t6 = -a1;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v0 = MEM_U32(t9 + 0);
+// bdead 9 ra = MEM_U32(sp + 36);
+goto L414f20;
+L414e08:
+v1 = MEM_U32(s0 + 216);
+t1 = s1 << 4;
+t3 = v1 << 4;
+if (s1 < v1) goto L414e3c;
+t0 = MEM_U32(s0 + 172);
+t4 = -t3;
+t2 = t0 + t1;
+t5 = t2 + t4;
+t6 = MEM_U32(t5 + 4);
+t7 = MEM_U32(s0 + 176);
+v0 = t6 + t7;
+goto L414f1c;
+L414e3c:
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x7;
+//nop;
+if (v0 != at) goto L414ebc;
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x1;
+//nop;
+if (v0 != at) goto L414ebc;
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000109 gp = MEM_U32(sp + 32);
+a2 = v0;
+s0 = 0x10003b88;
+a1 = 0x10001c20;
+//nop;
+s0 = s0;
+a0 = s0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 20001 gp = MEM_U32(sp + 32);
+v0 = s0;
+goto L414f1c;
+L414ebc:
+//nop;
+a0 = s0;
+a1 = s1;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+// bdead 60009 gp = MEM_U32(sp + 32);
+a0 = s0;
+//nop;
+a1 = v0;
+//nop;
+v0 = f_file_string_base(mem, sp, a0, a1);
+t1 = MEM_U32(s0 + 204);
+t9 = s1 << 2;
+t3 = t1 << 2;
+t8 = MEM_U32(s0 + 168);
+t9 = t9 - s1;
+t3 = t3 - t1;
+t3 = t3 << 2;
+t9 = t9 << 2;
+t2 = -t3;
+t0 = t8 + t9;
+t4 = t0 + t2;
+t5 = MEM_U32(t4 + 0);
+// bdead 4009 gp = MEM_U32(sp + 32);
+v0 = t5 + v0;
+L414f1c:
+// bdead 9 ra = MEM_U32(sp + 36);
+L414f20:
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_user_type_alloc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L414fac:
+//user_type_alloc:
+//nop;
+//nop;
+//nop;
+a1 = 0x10000044;
+//nop;
+v1 = MEM_U32(a1 + 0);
+//nop;
+t6 = -v1;
+t7 = v1 + 0xffffffff;
+if ((int)t6 < (int)0x200) goto L414fe0;
+v0 = zero;
+return v0;
+L414fe0:
+t0 = 0x100077f0;
+t8 = -v1;
+t9 = t8 << 2;
+MEM_U32(a1 + 0) = t7;
+v0 = t9 + t0;
+//nop;
+return v0;
+}
+
+static uint32_t f_find_user_symbol(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s4 = 0;
+L415584:
+//find_user_symbol:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffd0;
+// fdead 8b MEM_U32(sp + 36) = s4;
+s4 = 0x10000040;
+// fdead 20008b MEM_U32(sp + 32) = s3;
+t6 = MEM_U32(s4 + 0);
+// fdead 20808b MEM_U32(sp + 28) = s2;
+// fdead 20808b MEM_U32(sp + 24) = s1;
+at = (int)t6 < (int)0xfffffffe;
+// fdead 20808f s2 = a0;
+// fdead 20808f s3 = a1;
+// fdead 20808f MEM_U32(sp + 44) = ra;
+// fdead 20808f MEM_U32(sp + 40) = gp;
+// fdead 20808f MEM_U32(sp + 20) = s0;
+s1 = 0xfffffffe;
+if (at == 0) goto L415620;
+s0 = 0x10005ff0;
+//nop;
+s0 = s0 + 0x18;
+L4155d8:
+v0 = MEM_U32(s0 + 0);
+// fdead 27808f a0 = s2;
+//nop;
+if (v0 == 0) goto L41560c;
+//nop;
+a1 = v0;
+// fdead 2780cf a2 = s3;
+v0 = f_case_streq(mem, sp, a0, a1, a2);
+// fdead 26000f gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L41560c;
+v0 = s1;
+goto L415628;
+L41560c:
+t7 = MEM_U32(s4 + 0);
+s1 = s1 + 0xffffffff;
+s0 = s0 + 0xc;
+if ((int)t7 < (int)s1) goto L4155d8;
+L415620:
+v0 = 0xf0000;
+v0 = v0 | 0xffff;
+L415628:
+// fdead 27808f ra = MEM_U32(sp + 44);
+// fdead 27808f s0 = MEM_U32(sp + 20);
+// fdead 27808f s1 = MEM_U32(sp + 24);
+// fdead 27808f s2 = MEM_U32(sp + 28);
+// fdead 27808f s3 = MEM_U32(sp + 32);
+// fdead 27808f s4 = MEM_U32(sp + 36);
+// fdead 27808f sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t func_415648(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0, lo = 0, hi = 0;
+L415648:
+t6 = a0 + a1;
+t7 = t6 + 0xffffffff;
+lo = (int)t7 / (int)a1; hi = (int)t7 % (int)a1;
+//nop;
+if (a1 != 0) goto L415660;
+abort();
+L415660:
+at = 0xffffffff;
+if (a1 != at) {
+at = 0x80000000;
+goto L415678;}
+at = 0x80000000;
+//nop;
+if (t7 != at) goto L415678;
+abort();
+L415678:
+t8 = lo;
+//nop;
+//nop;
+lo = t8 * a1;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)a1 >> 32);
+v0 = lo;
+//nop;
+return v0;
+}
+
+static void f_obj_update_dynamic(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0;
+L415694:
+//obj_update_dynamic:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a0;
+// fdead 4006006b MEM_U32(sp + 40) = gp;
+s2 = zero;
+s3 = zero;
+v0 = f_obj_init_address(mem, sp, a0);
+// bdead 401e0009 gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L4156e4;
+s2 = 0x1;
+L4156e4:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_fini_address(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+//nop;
+if (v0 == 0) goto L415704;
+s3 = 0x1;
+L415704:
+a1 = MEM_U32(s0 + 0);
+//nop;
+at = (int)a1 < (int)0x14;
+if (a1 == 0) goto L415964;
+L415714:
+v0 = a1;
+if (at != 0) goto L415754;
+at = 0x8fff0000;
+at = at | 0xffff;
+t6 = v0 + at;
+//nop;
+if (t6 >= 0x16) goto L415938;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L415784;
+case 1: goto L41583c;
+case 2: goto L415858;
+case 3: goto L415954;
+case 4: goto L415874;
+case 5: goto L415954;
+case 6: goto L415954;
+case 7: goto L415954;
+case 8: goto L415954;
+case 9: goto L415820;
+case 10: goto L415900;
+case 11: goto L415938;
+case 12: goto L415938;
+case 13: goto L415938;
+case 14: goto L415938;
+case 15: goto L4158e4;
+case 16: goto L4158ac;
+case 17: goto L4157bc;
+case 18: goto L4157a0;
+case 19: goto L415954;
+case 20: goto L415938;
+case 21: goto L41591c;
+}
+L415754:
+t7 = v0 + 0xffffffff;
+//nop;
+if (t7 >= 0x13) goto L415938;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L415954;
+case 1: goto L415938;
+case 2: goto L415954;
+case 3: goto L415954;
+case 4: goto L415954;
+case 5: goto L415954;
+case 6: goto L415938;
+case 7: goto L415938;
+case 8: goto L415938;
+case 9: goto L4158c8;
+case 10: goto L415954;
+case 11: goto L4157d8;
+case 12: goto L4157fc;
+case 13: goto L415954;
+case 14: goto L415954;
+case 15: goto L415938;
+case 16: goto L415954;
+case 17: goto L415890;
+case 18: goto L415954;
+}
+L415784:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_rldversion(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4157a0:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_gotsym(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4157bc:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_unrefextno(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4157d8:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_init_address(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+if (s2 == 0) goto L415954;
+s2 = s2 + 0xffffffff;
+goto L415954;
+L4157fc:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_fini_address(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+if (s3 == 0) goto L415954;
+s3 = s3 + 0xffffffff;
+goto L415954;
+L415820:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_locgotcount(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L41583c:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_timestamp(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L415858:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_ichecksum(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L415874:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_dynflags(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L415890:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_dynrelsz(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4158ac:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_dynsymcount(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4158c8:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_dynstrsz(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L4158e4:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_liblistcount(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L415900:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_conflictcount(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L41591c:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_rld_map(mem, sp, a0);
+// bdead 401e0199 gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 4) = v0;
+goto L415954;
+L415938:
+a0 = 0x10001e40;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead 401e0191 gp = MEM_U32(sp + 40);
+//nop;
+L415954:
+a1 = MEM_U32(s0 + 8);
+s0 = s0 + 0x8;
+at = (int)a1 < (int)0x14;
+if (a1 != 0) goto L415714;
+L415964:
+//nop;
+if (s2 == 0) goto L415988;
+a0 = 0x10001e58;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead 401001d1 gp = MEM_U32(sp + 40);
+//nop;
+L415988:
+// bdead 400001d1 ra = MEM_U32(sp + 44);
+if (s3 == 0) goto L4159b0;
+a0 = 0x10001e68;
+//nop;
+a0 = a0;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead 11 gp = MEM_U32(sp + 40);
+//nop;
+// bdead 11 ra = MEM_U32(sp + 44);
+L4159b0:
+// bdead 11 s0 = MEM_U32(sp + 24);
+// bdead 11 s1 = MEM_U32(sp + 28);
+// bdead 11 s2 = MEM_U32(sp + 32);
+// bdead 11 s3 = MEM_U32(sp + 36);
+// bdead 11 sp = sp + 0x30;
+return;
+}
+
+static uint64_t func_4159c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+s0 = a1;
+// fdead 400201e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+MEM_U32(sp + 64) = a2;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+at = 0x2;
+a0 = s0;
+if (v0 != at) goto L415b2c;
+a1 = 0x10001e78;
+//nop;
+a2 = 0x8;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 4002001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L415a5c;
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtop(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+a1 = v0;
+//nop;
+f_obj_update_dynamic(mem, sp, a0, a1);
+// bdead 40020013 gp = MEM_U32(sp + 24);
+//nop;
+L415a5c:
+t6 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if (t6 == 0) goto L415b24;
+t7 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+if (t7 == 0) goto L415b24;
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+t8 = MEM_U32(s0 + 12);
+t9 = MEM_U32(s0 + 16);
+// bdead 4602001b gp = MEM_U32(sp + 24);
+t0 = t8 + t9;
+//nop;
+if (t0 >= v0) goto L415b24;
+a1 = MEM_U32(s0 + 20);
+//nop;
+//nop;
+if (a1 == 0) goto L415b24;
+//nop;
+a0 = MEM_U32(sp + 64);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtop(mem, sp, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 64);
+//nop;
+a2 = MEM_U32(s0 + 16);
+a1 = v0;
+v0 = wrapper_write(mem, a0, a1, a2);
+t1 = MEM_U32(s0 + 16);
+// bdead 400005d9 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == t1) goto L415b24;
+a0 = 0x10001e84;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0);
+// bdead 11 gp = MEM_U32(sp + 24);
+//nop;
+L415b24:
+v0 = 0xffffffff;
+goto L415d10;
+L415b2c:
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 4002001b gp = MEM_U32(sp + 24);
+at = 0x3;
+// bdead 4002001b ra = MEM_U32(sp + 28);
+if (v0 != at) goto L415d14;
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+MEM_U32(sp + 44) = v0;
+//nop;
+v0 = f_obj_psecthdr(mem, sp, a0);
+t2 = MEM_U32(sp + 44);
+t6 = MEM_U32(s0 + 8);
+t3 = MEM_U16(t2 + 50);
+// bdead 4002900b gp = MEM_U32(sp + 24);
+t4 = t3 << 2;
+t4 = t4 + t3;
+t4 = t4 << 3;
+t5 = v0 + t4;
+v1 = MEM_U32(t5 + 12);
+t7 = t6 & 0x2;
+//nop;
+if (t7 != 0) goto L415bac;
+v0 = 0xffffffff;
+goto L415d10;
+L415bac:
+a2 = 0x9a;
+if (v1 != 0) goto L415bdc;
+a0 = 0x10001eac;
+a1 = 0x10001eb8;
+//nop;
+MEM_U32(sp + 32) = v1;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 32);
+//nop;
+L415bdc:
+t8 = MEM_U32(s0 + 0);
+a1 = 0x10001ec8;
+//nop;
+a0 = t8 + v1;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L415c34;
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtop(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+a1 = v0;
+//nop;
+f_obj_update_dynamic(mem, sp, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+//nop;
+L415c34:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtofo(mem, sp, a0, a1);
+MEM_U32(sp + 52) = v0;
+t9 = MEM_U32(s0 + 12);
+// bdead 44020013 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 52);
+if (t9 == 0) goto L415d08;
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+t0 = MEM_U32(s0 + 12);
+t1 = MEM_U32(s0 + 20);
+// bdead 4002061b gp = MEM_U32(sp + 24);
+t2 = t0 + t1;
+t5 = MEM_U32(sp + 52);
+if (t2 >= v0) goto L415d08;
+t3 = MEM_U32(s0 + 16);
+a0 = MEM_U32(sp + 64);
+t5 = MEM_U32(sp + 52);
+if (t3 == 0) goto L415d08;
+//nop;
+a1 = MEM_U32(sp + 52);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtop(mem, sp, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 64);
+//nop;
+a2 = MEM_U32(s0 + 20);
+a1 = v0;
+v0 = wrapper_write(mem, a0, a1, a2);
+t4 = MEM_U32(s0 + 20);
+// bdead 400221d9 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 52);
+if (v0 == t4) goto L415d08;
+a0 = 0x10001ed4;
+//nop;
+a0 = a0;
+//nop;
+f_fatal(mem, sp, a0);
+// bdead 40020011 gp = MEM_U32(sp + 24);
+//nop;
+t5 = MEM_U32(sp + 52);
+L415d08:
+v0 = 0xffffffff;
+MEM_U32(s0 + 16) = t5;
+L415d10:
+// bdead 19 ra = MEM_U32(sp + 28);
+L415d14:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_obj_vtofo(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L415d20:
+//obj_vtofo:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+at = 0x2;
+//nop;
+if (v0 == at) goto L415d7c;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40020019 gp = MEM_U32(sp + 24);
+at = 0x3;
+// bdead 40020019 ra = MEM_U32(sp + 28);
+if (v0 != at) goto L415f18;
+L415d7c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+t6 = MEM_U32(sp + 44);
+// bdead 40028009 gp = MEM_U32(sp + 24);
+a2 = 0xc0;
+if (t6 < v0) goto L415ef4;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_text_size(mem, sp, a0);
+t8 = MEM_U32(sp + 36);
+t7 = MEM_U32(sp + 44);
+t9 = v0 + t8;
+// bdead 44030001 gp = MEM_U32(sp + 24);
+//nop;
+if (t7 >= t9) goto L415e04;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+t0 = MEM_U32(sp + 44);
+// bdead 219 gp = MEM_U32(sp + 24);
+v0 = t0 - v0;
+goto L415f14;
+L415e04:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+t1 = MEM_U32(sp + 44);
+// bdead 40020409 gp = MEM_U32(sp + 24);
+a2 = 0xbd;
+if (t1 < v0) goto L415ed0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_bss_size(mem, sp, a0);
+t3 = MEM_U32(sp + 36);
+t2 = MEM_U32(sp + 44);
+t4 = v0 + t3;
+// bdead 40022801 gp = MEM_U32(sp + 24);
+a2 = 0xbb;
+if (t2 >= t4) goto L415eac;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_text_size(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+t5 = MEM_U32(sp + 36);
+t6 = MEM_U32(sp + 44);
+// bdead c019 gp = MEM_U32(sp + 24);
+t8 = t5 + t6;
+v0 = t8 - v0;
+goto L415f14;
+L415eac:
+a0 = 0x10001efc;
+a1 = 0x10001f00;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L415f18;
+L415ed0:
+a0 = 0x10001f10;
+a1 = 0x10001f14;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L415f18;
+L415ef4:
+a0 = 0x10001f24;
+a1 = 0x10001f28;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L415f14:
+// bdead 19 ra = MEM_U32(sp + 28);
+L415f18:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_obj_vtop(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0,
+t9 = 0;
+L415f24:
+//obj_vtop:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 32) = gp;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+v0 = MEM_U32(a0 + 384);
+at = 0x3;
+s0 = a1;
+s1 = a0;
+if (v0 != at) goto L4161a4;
+//nop;
+//nop;
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+at = 0x2;
+//nop;
+if (v0 != at) goto L4160a8;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_paouthdr(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 < v0) goto L416018;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_size(mem, sp, a0);
+t6 = MEM_U32(sp + 44);
+// bdead 4006800b gp = MEM_U32(sp + 32);
+t7 = v0 + t6;
+//nop;
+if (s0 >= t7) goto L416018;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+t9 = MEM_U32(sp + 56);
+// bdead 4020009 gp = MEM_U32(sp + 32);
+t2 = MEM_U32(t9 + 20);
+t8 = s0 - v0;
+v0 = t8 + t2;
+goto L4162d4;
+L416018:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 < v0) goto L4160a0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_bss_size(mem, sp, a0);
+t3 = MEM_U32(sp + 44);
+// bdead 4006100b gp = MEM_U32(sp + 32);
+t4 = v0 + t3;
+//nop;
+if (s0 >= t4) goto L4160a0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+t6 = MEM_U32(sp + 56);
+// bdead 28009 gp = MEM_U32(sp + 32);
+t7 = MEM_U32(t6 + 24);
+t5 = s0 - v0;
+v0 = t5 + t7;
+goto L4162d4;
+L4160a0:
+v0 = zero;
+goto L4162d4;
+L4160a8:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+at = 0x3;
+a2 = 0xe7;
+if (v0 != at) goto L416180;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 52) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_pproghdr(mem, sp, a0);
+t9 = MEM_U32(sp + 52);
+// bdead 402000b gp = MEM_U32(sp + 32);
+t0 = MEM_U16(t9 + 44);
+t1 = v0;
+a1 = zero;
+if (t0 == 0) goto L416178;
+a2 = zero;
+v1 = v0;
+a3 = 0x1;
+L416114:
+t8 = MEM_U32(v1 + 0);
+a1 = a1 + 0x1;
+at = a1 < t0;
+if (a3 != t8) goto L41616c;
+a0 = MEM_U32(v1 + 8);
+//nop;
+if (s0 < a0) {
+at = a1 < t0;
+goto L41616c;}
+at = a1 < t0;
+t2 = MEM_U32(v1 + 16);
+//nop;
+t3 = t2 + a0;
+if (s0 >= t3) {
+at = a1 < t0;
+goto L41616c;}
+at = a1 < t0;
+v1 = t1 + a2;
+t4 = MEM_U32(v1 + 8);
+t5 = MEM_U32(v1 + 12);
+t6 = s0 - t4;
+v0 = t6 + t5;
+goto L4162d4;
+// fdead 0 at = a1 < t0;
+L41616c:
+a2 = a2 + 0x20;
+v1 = v1 + 0x20;
+if (at != 0) goto L416114;
+L416178:
+v0 = zero;
+goto L4162d4;
+L416180:
+a0 = 0x10001f38;
+a1 = 0x10001f3c;
+//nop;
+a0 = a0;
+a1 = a1;
+wrapper___assert(mem, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 ra = MEM_U32(sp + 36);
+goto L4162d8;
+L4161a4:
+a3 = 0x1;
+if (a3 != v0) {
+v0 = s0;
+goto L4162d4;}
+v0 = s0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 < v0) goto L41622c;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 >= v0) goto L41622c;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_base_address(mem, sp, a0);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_map_address(mem, sp, a0);
+t9 = MEM_U32(sp + 44);
+// bdead 4020009 gp = MEM_U32(sp + 32);
+t7 = v0 + s0;
+v0 = t7 - t9;
+goto L4162d4;
+L41622c:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 < v0) goto L4162c8;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (s0 >= v0) goto L4162c8;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_map_address(mem, sp, a0);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 40) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_size(mem, sp, a0);
+t2 = MEM_U32(sp + 44);
+t4 = MEM_U32(sp + 40);
+t8 = v0 + s0;
+// bdead 2002801 gp = MEM_U32(sp + 32);
+t3 = t8 - t2;
+v0 = t3 + t4;
+goto L4162d4;
+L4162c8:
+v0 = zero;
+goto L4162d4;
+// fdead 0 v0 = s0;
+L4162d4:
+// bdead 9 ra = MEM_U32(sp + 36);
+L4162d8:
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint64_t func_41710c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 36) = ra;
+// fdead 400001e3 MEM_U32(sp + 28) = s1;
+// fdead 400001e3 MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400601e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40060019 gp = MEM_U32(sp + 32);
+at = 0x2;
+//nop;
+if (v0 != at) goto L417210;
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_obj_data_start(mem, sp, a0);
+t6 = MEM_U32(s0 + 12);
+// bdead 40068009 gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != t6) goto L4171a0;
+a0 = MEM_U32(s1 + 0);
+//nop;
+t7 = a0 & 0xfff;
+//nop;
+if (t7 == 0) goto L4171a0;
+//nop;
+a1 = 0x1000;
+// fdead 6007806f t9 = t9;
+//nop;
+v0 = func_415648(mem, sp, a0, a1);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+MEM_U32(s1 + 0) = v0;
+L4171a0:
+t8 = MEM_U32(s0 + 20);
+//nop;
+//nop;
+if (t8 == 0) goto L4171cc;
+t9 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+if (t9 == 0) goto L4171cc;
+t0 = MEM_U32(s1 + 0);
+//nop;
+MEM_U32(s0 + 20) = t0;
+L4171cc:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+v1 = MEM_U32(s0 + 16);
+t1 = MEM_U32(s0 + 12);
+// bdead 40419 gp = MEM_U32(sp + 32);
+t2 = t1 + v1;
+//nop;
+if (t2 >= v0) goto L417208;
+t3 = MEM_U32(s1 + 0);
+//nop;
+t4 = t3 + v1;
+MEM_U32(s1 + 0) = t4;
+L417208:
+v0 = 0xffffffff;
+goto L4172a0;
+L417210:
+t5 = MEM_U32(s0 + 8);
+a0 = MEM_U32(sp + 40);
+t6 = t5 & 0x2;
+//nop;
+if (t6 != 0) goto L41722c;
+v0 = 0xffffffff;
+goto L4172a0;
+L41722c:
+//nop;
+a1 = MEM_U32(s0 + 12);
+//nop;
+v0 = f_obj_vtofo(mem, sp, a0, a1);
+// bdead 40060019 gp = MEM_U32(sp + 32);
+MEM_U32(s1 + 0) = v0;
+t7 = MEM_U32(s0 + 12);
+//nop;
+v0 = 0xffffffff;
+if (t7 == 0) goto L4172a0;
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_obj_bss_start(mem, sp, a0);
+t8 = MEM_U32(s0 + 12);
+t9 = MEM_U32(s0 + 20);
+// bdead 6060019 gp = MEM_U32(sp + 32);
+t0 = t8 + t9;
+if (t0 >= v0) {
+v0 = 0xffffffff;
+goto L4172a0;}
+v0 = 0xffffffff;
+t1 = MEM_U32(s0 + 16);
+//nop;
+v0 = 0xffffffff;
+if (t1 == 0) goto L4172a0;
+t2 = MEM_U32(s1 + 0);
+//nop;
+MEM_U32(s0 + 16) = t2;
+v0 = 0xffffffff;
+L4172a0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4172b4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0;
+v1 = MEM_U32(a0 + 12);
+//nop;
+//nop;
+if (v1 != 0) goto L4172cc;
+v0 = 0x1;
+return ((uint64_t)v0 << 32) | v1;
+L4172cc:
+a0 = MEM_U32(a1 + 12);
+//nop;
+at = (int)v1 < (int)a0;
+if (a0 != 0) goto L4172e4;
+v0 = 0xffffffff;
+return ((uint64_t)v0 << 32) | v1;
+L4172e4:
+v0 = a0 ^ v1;
+if (at == 0) goto L4172f4;
+v0 = 0xffffffff;
+return ((uint64_t)v0 << 32) | v1;
+L4172f4:
+v0 = zero < v0;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0;
+L419118:
+//st_error:
+//nop;
+//nop;
+//nop;
+// fdead eb sp = sp + 0xffffffd8;
+// fdead eb MEM_U32(sp + 48) = a2;
+a2 = 0x10000240;
+// fdead eb MEM_U32(sp + 40) = a0;
+// fdead eb MEM_U32(sp + 44) = a1;
+a1 = 0x100024b0;
+a0 = 0xfb528e4;
+//nop;
+// fdead eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead eb MEM_U32(sp + 32) = gp;
+// fdead eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b t6 = MEM_U32(sp + 52);
+// fdead b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 2b a1 = MEM_U32(sp + 40);
+// fdead 2b a2 = MEM_U32(sp + 44);
+// fdead 2b a3 = MEM_U32(sp + 48);
+// fdead 2b MEM_U32(sp + 16) = t6;
+// fdead 2b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x100024bc;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 36);
+// fdead 3 gp = MEM_U32(sp + 32);
+// fdead 3 sp = sp + 0x28;
+return;
+}
+
+static uint64_t f_foreach_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L4191d8:
+//foreach_section:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001eb MEM_U32(sp + 52) = ra;
+// fdead 400001eb MEM_U32(sp + 48) = gp;
+// fdead 400001eb MEM_U32(sp + 44) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s4;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+t6 = MEM_U32(a0 + 140);
+at = 0x2;
+s1 = a0;
+s4 = a2;
+s5 = a1;
+if (t6 != at) goto L419288;
+t7 = MEM_U32(a0 + 144);
+s2 = zero;
+t8 = MEM_U16(t7 + 2);
+s0 = zero;
+s3 = 0xffffffff;
+if (t8 == 0) goto L419280;
+L419238:
+t9 = MEM_U32(s1 + 152);
+a0 = s1;
+a1 = t9 + s0;
+// bdead 600007e0161 t9 = s5;
+fp_dest = s5;
+a2 = s4;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600007e0119 gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == s3) goto L419264;
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L4192f0;
+L419264:
+t0 = MEM_U32(s1 + 144);
+s2 = s2 + 0x1;
+t1 = MEM_U16(t0 + 2);
+s0 = s0 + 0x28;
+//nop;
+if (s2 < t1) goto L419238;
+L419280:
+v0 = 0xffffffff;
+goto L4192ec;
+L419288:
+t2 = MEM_U32(s1 + 224);
+s2 = zero;
+t3 = MEM_U16(t2 + 48);
+s0 = zero;
+s3 = 0xffffffff;
+if (t3 == 0) goto L4192e8;
+L4192a0:
+t4 = MEM_U32(s1 + 232);
+a0 = s1;
+a2 = s4;
+// bdead 600007e21a1 t9 = s5;
+fp_dest = s5;
+a1 = t4 + s0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600007e0119 gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == s3) goto L4192cc;
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L4192f0;
+L4192cc:
+t5 = MEM_U32(s1 + 224);
+s2 = s2 + 0x1;
+t6 = MEM_U16(t5 + 48);
+s0 = s0 + 0x28;
+//nop;
+if (s2 < t6) goto L4192a0;
+L4192e8:
+v0 = 0xffffffff;
+L4192ec:
+// bdead 19 ra = MEM_U32(sp + 52);
+L4192f0:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 s4 = MEM_U32(sp + 40);
+// bdead 19 s5 = MEM_U32(sp + 44);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_419310(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 36) = ra;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+s1 = a0;
+s2 = a1;
+// fdead 400c01e3 MEM_U32(sp + 32) = gp;
+// fdead 400c01e3 MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 64) = a2;
+v0 = f_obj_section_vaddr(mem, sp, a0, a1);
+// bdead 400c0009 gp = MEM_U32(sp + 32);
+s0 = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_text_start(mem, sp, a0);
+// bdead 400e0009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_obj_base_address(mem, sp, a0);
+// bdead 400e0009 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 44);
+//nop;
+t7 = s0 + t6;
+s0 = t7 - v0;
+a0 = s1;
+a1 = s2;
+v0 = f_obj_section_size(mem, sp, a0, a1);
+a2 = MEM_U32(sp + 64);
+// bdead 400e0089 gp = MEM_U32(sp + 32);
+v1 = v0;
+if (a2 < s0) goto L4193c4;
+t8 = s0 + v0;
+//nop;
+if (a2 >= t8) goto L4193c4;
+v0 = s2;
+goto L419408;
+L4193c4:
+//nop;
+a0 = s1;
+a1 = s2;
+MEM_U32(sp + 48) = v1;
+temp64 = f_section_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400a0009 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 48);
+at = 0x6;
+if (v0 != at) {
+v0 = 0xffffffff;
+goto L419408;}
+v0 = 0xffffffff;
+t9 = MEM_U32(sp + 64);
+t0 = s0 + v1;
+v0 = 0xffffffff;
+if (t9 != t0) goto L419408;
+v0 = s2;
+goto L419408;
+v0 = 0xffffffff;
+L419408:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_address_to_section(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+L419420:
+//address_to_section:
+//nop;
+//nop;
+//nop;
+a2 = a1;
+a1 = 0x419310; // function pointer
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+a1 = a1;
+temp64 = f_foreach_section(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+v1 = v0;
+if (v0 != at) goto L419464;
+v0 = zero;
+goto L419468;
+L419464:
+v0 = v1;
+L419468:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_section_type(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0;
+uint64_t temp64;
+L419478:
+//section_type:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+v0 = MEM_U32(a0 + 140);
+at = 0x2;
+if (v0 != at) {
+at = 0x3;
+goto L41955c;}
+at = 0x3;
+v0 = MEM_U32(a1 + 36);
+//nop;
+if ((int)v0 < (int)0x101) {
+at = 0x200;
+goto L4194dc;}
+at = 0x200;
+if (v0 == at) {
+at = 0x400;
+goto L419530;}
+at = 0x400;
+if (v0 == at) {
+at = 0x8000000;
+goto L419538;}
+at = 0x8000000;
+if (v0 == at) {
+at = 0x10000000;
+goto L419540;}
+at = 0x10000000;
+//nop;
+if (v0 == at) goto L419548;
+v0 = zero;
+goto L419714;
+L4194dc:
+at = 0x80000000;
+if (v0 == at) {
+at = 0x20;
+goto L419550;}
+at = 0x20;
+if (v0 == at) {
+at = 0x40;
+goto L419510;}
+at = 0x40;
+if (v0 == at) {
+at = 0x80;
+goto L419518;}
+at = 0x80;
+if (v0 == at) {
+at = 0x100;
+goto L419520;}
+at = 0x100;
+//nop;
+if (v0 == at) goto L419528;
+v0 = zero;
+goto L419714;
+L419510:
+v0 = 0x1;
+goto L419714;
+L419518:
+v0 = 0x3;
+goto L419714;
+L419520:
+v0 = 0x6;
+goto L419714;
+L419528:
+v0 = 0x2;
+goto L419714;
+L419530:
+v0 = 0x4;
+goto L419714;
+L419538:
+v0 = 0x5;
+goto L419714;
+L419540:
+v0 = 0x8;
+goto L419714;
+L419548:
+v0 = 0x9;
+goto L419714;
+L419550:
+v0 = 0x7;
+goto L419714;
+at = 0x3;
+L41955c:
+if (v0 != at) {
+v0 = zero;
+goto L419714;}
+v0 = zero;
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_obj_pelfhdr(mem, sp, a0);
+t6 = MEM_U32(v0 + 32);
+// bdead 40008013 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+v0 = zero;
+if (t6 == 0) goto L419714;
+//nop;
+//nop;
+//nop;
+temp64 = f_obj_section_name(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000001b gp = MEM_U32(sp + 24);
+a0 = v0;
+if (v0 == 0) goto L419710;
+a1 = 0x100024c0;
+//nop;
+MEM_U32(sp + 32) = v0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4195d0;
+v0 = 0x1;
+goto L419714;
+L4195d0:
+a1 = 0x100024c8;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4195f8;
+v0 = 0x3;
+goto L419714;
+L4195f8:
+a1 = 0x100024d0;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L419620;
+v0 = 0x6;
+goto L419714;
+L419620:
+a1 = 0x100024d8;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L419648;
+v0 = 0x2;
+goto L419714;
+L419648:
+a1 = 0x100024e0;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L419670;
+v0 = 0x4;
+goto L419714;
+L419670:
+a1 = 0x100024e8;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L419698;
+v0 = 0x5;
+goto L419714;
+L419698:
+a1 = 0x100024f0;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4196c0;
+v0 = 0x8;
+goto L419714;
+L4196c0:
+a1 = 0x100024f8;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4196e8;
+v0 = 0x9;
+goto L419714;
+L4196e8:
+a1 = 0x10002500;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 1b gp = MEM_U32(sp + 24);
+if (v0 != 0) {
+v0 = zero;
+goto L419714;}
+v0 = zero;
+v0 = 0x7;
+goto L419714;
+L419710:
+v0 = zero;
+L419714:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_find_section_byname(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L419864:
+//find_section_byname:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff78;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400201e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 140) = a1;
+MEM_U32(sp + 144) = a2;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 400201c9 gp = MEM_U32(sp + 24);
+v1 = 0x3;
+//nop;
+if (v0 != v1) goto L419994;
+v0 = MEM_U32(s0 + 384);
+at = 0x1;
+//nop;
+if (v1 != v0) goto L4198ec;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_shstrndx(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a0 = sp + 0x54;
+//nop;
+a1 = s0;
+a2 = v0;
+temp64 = f_obj_section(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 96);
+t8 = MEM_U32(sp + 140);
+goto L419954;
+L4198ec:
+//nop;
+if (v0 != at) goto L419930;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_shstrndx(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a0 = sp + 0x2c;
+//nop;
+a1 = s0;
+a2 = v0;
+temp64 = f_obj_section(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U32(s0 + 196);
+t7 = MEM_U32(sp + 60);
+// bdead 40018001 gp = MEM_U32(sp + 24);
+v1 = t6 + t7;
+goto L419950;
+L419930:
+a0 = 0x10002508;
+//nop;
+a0 = a0;
+//nop;
+f_error(mem, sp, a0);
+// bdead 11 gp = MEM_U32(sp + 24);
+v0 = 0xffffffff;
+goto L4199ec;
+L419950:
+t8 = MEM_U32(sp + 140);
+L419954:
+a0 = MEM_U32(sp + 144);
+t9 = MEM_U32(t8 + 0);
+//nop;
+a1 = t9 + v1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L41998c;
+v0 = MEM_U32(sp + 140);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L4199f0;
+L41998c:
+v0 = 0xffffffff;
+goto L4199ec;
+L419994:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+at = 0x2;
+if (v0 != at) {
+v0 = 0xffffffff;
+goto L4199ec;}
+v0 = 0xffffffff;
+//nop;
+a0 = MEM_U32(sp + 144);
+a1 = MEM_U32(sp + 140);
+a2 = 0x8;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4199e0;
+v0 = MEM_U32(sp + 140);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L4199f0;
+L4199e0:
+v0 = 0xffffffff;
+goto L4199ec;
+v0 = 0xffffffff;
+L4199ec:
+// bdead 19 ra = MEM_U32(sp + 28);
+L4199f0:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x88;
+return v0;
+}
+
+static uint64_t f_find_section_bytype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L4199fc:
+//find_section_bytype:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 36) = a1;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 36);
+at = 0x3;
+//nop;
+if (v0 != at) goto L419a58;
+t6 = MEM_U32(a1 + 4);
+//nop;
+v0 = 0xffffffff;
+if (v1 != t6) goto L419aa0;
+v0 = a1;
+goto L419aa0;
+L419a58:
+//nop;
+a0 = MEM_U32(sp + 32);
+MEM_U32(sp + 36) = a1;
+v0 = f_obj_otype(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 36);
+at = 0x2;
+if (v0 != at) {
+v0 = 0xffffffff;
+goto L419aa0;}
+v0 = 0xffffffff;
+t7 = MEM_U32(a1 + 36);
+//nop;
+t8 = t7 & v1;
+v0 = 0xffffffff;
+if (v1 != t8) goto L419aa0;
+v0 = a1;
+goto L419aa0;
+v0 = 0xffffffff;
+L419aa0:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_419ab0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+MEM_U32(sp + 40) = a2;
+a2 = a1;
+MEM_U32(sp + 36) = a1;
+a1 = 0x419310; // function pointer
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+a1 = a1;
+temp64 = f_foreach_section(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+a1 = v0;
+if (v0 == at) goto L419b14;
+//nop;
+a0 = MEM_U32(sp + 32);
+//nop;
+temp64 = f_section_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L419b1c;
+L419b14:
+v0 = 0xffffffff;
+// bdead 19 ra = MEM_U32(sp + 28);
+L419b1c:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0;
+L419b88:
+//warning:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10002540;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+//nop;
+//nop;
+}
+
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L419c08:
+//fatal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+// fdead 4000002b MEM_U32(sp + 44) = a1;
+a1 = 0x10002550;
+a0 = 0xfb528e4;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+// fdead 4000006b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 11 ra = MEM_U32(sp + 36);
+// bdead 11 gp = MEM_U32(sp + 32);
+// bdead 11 sp = sp + 0x28;
+return;
+}
+
+static void f_objList_add(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t7 = 0;
+L419c98:
+//objList_add:
+//nop;
+//nop;
+//nop;
+// fdead 18b sp = sp + 0xffffffe0;
+//nop;
+// fdead 18b MEM_U32(sp + 40) = a2;
+// fdead 18b a2 = a0;
+// fdead 18b MEM_U32(sp + 28) = ra;
+// fdead 18b MEM_U32(sp + 32) = a0;
+// fdead 18b MEM_U32(sp + 24) = gp;
+// fdead 18b MEM_U32(sp + 36) = a1;
+// fdead 18b MEM_U32(sp + 44) = a3;
+// fdead 18b MEM_U32(sp + 32) = a2;
+a0 = 0xc;
+v0 = wrapper_malloc(mem, a0);
+// fdead b gp = MEM_U32(sp + 24);
+// fdead b a2 = MEM_U32(sp + 32);
+// bdead 4000008b a0 = v0;
+if (v0 != 0) goto L419cec;
+// bdead 1 v0 = zero;
+goto L419d90;
+L419cec:
+// fdead 2b t6 = MEM_U32(sp + 36);
+//nop;
+// fdead 2b MEM_U32(v0 + 0) = t6;
+// fdead 2b t7 = MEM_U32(sp + 44);
+//nop;
+//nop;
+if (t7 == 0) goto L419d18;
+// fdead 2b v1 = MEM_U32(a2 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L419d5c;
+L419d18:
+// fdead 2b t8 = MEM_U32(a2 + 0);
+//nop;
+// fdead 2b MEM_U32(v0 + 4) = t8;
+// fdead 2b v1 = MEM_U32(a2 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L419d3c;
+MEM_U32(v0 + 8) = v0;
+goto L419d54;
+L419d3c:
+// fdead 2b t9 = MEM_U32(v1 + 8);
+//nop;
+// fdead 2b MEM_U32(v0 + 8) = t9;
+// fdead 2b t0 = MEM_U32(a2 + 0);
+//nop;
+// fdead 2b MEM_U32(t0 + 8) = v0;
+L419d54:
+// fdead 2b MEM_U32(a2 + 0) = v0;
+goto L419d8c;
+L419d5c:
+// fdead 2b t1 = MEM_U32(v1 + 8);
+//nop;
+// fdead 2b MEM_U32(t1 + 4) = v0;
+// fdead 2b t2 = MEM_U32(a2 + 0);
+//nop;
+// fdead 2b t3 = MEM_U32(t2 + 8);
+//nop;
+// fdead 2b MEM_U32(v0 + 8) = t3;
+// fdead 2b t4 = MEM_U32(a2 + 0);
+//nop;
+// fdead 2b MEM_U32(t4 + 8) = v0;
+MEM_U32(v0 + 4) = zero;
+L419d8c:
+// bdead 1 v0 = a0;
+L419d90:
+// fdead 2b ra = MEM_U32(sp + 28);
+// fdead 2b sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_list_last(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0;
+L41a1f8:
+//list_last:
+v0 = 0xffffffff;
+if (a0 == 0) goto L41a21c;
+// fdead b v1 = MEM_U32(a0 + 8);
+//nop;
+//nop;
+if (v1 == 0) goto L41a21c;
+// fdead b v0 = MEM_U32(v1 + 0);
+//nop;
+return v0;
+L41a21c:
+//nop;
+return v0;
+}
+
+static uint32_t func_41a2a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L41a2a8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 36) = ra;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 44) = a1;
+if ((int)a2 >= 0) goto L41a2fc;
+t6 = -a2;
+t7 = t6 << 2;
+t8 = 0x10005ff0;
+t7 = t7 - t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+v0 = MEM_U32(t9 + 0);
+// bdead 9 ra = MEM_U32(sp + 36);
+goto L41a3fc;
+L41a2fc:
+v1 = MEM_U32(s0 + 216);
+t1 = s1 << 4;
+t3 = v1 << 4;
+if (s1 < v1) goto L41a330;
+t0 = MEM_U32(s0 + 172);
+t4 = -t3;
+t2 = t0 + t1;
+t5 = t2 + t4;
+t6 = MEM_U32(t5 + 4);
+t7 = MEM_U32(s0 + 176);
+v0 = t6 + t7;
+goto L41a3f8;
+L41a330:
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x7;
+//nop;
+if (v0 != at) goto L41a3b0;
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060009 gp = MEM_U32(sp + 32);
+at = 0x1;
+//nop;
+if (v0 != at) goto L41a3b0;
+//nop;
+a0 = s0;
+a1 = s1;
+temp64 = f_symbol_value(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000109 gp = MEM_U32(sp + 32);
+a2 = v0;
+s0 = 0x10003c10;
+a1 = 0x10002580;
+//nop;
+s0 = s0;
+a0 = s0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 20001 gp = MEM_U32(sp + 32);
+v0 = s0;
+goto L41a3f8;
+L41a3b0:
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = s0;
+v0 = f_file_string_base(mem, sp, a0, a1);
+t1 = MEM_U32(s0 + 204);
+t9 = s1 << 2;
+t3 = t1 << 2;
+t8 = MEM_U32(s0 + 168);
+t9 = t9 - s1;
+t3 = t3 - t1;
+t3 = t3 << 2;
+t9 = t9 << 2;
+t2 = -t3;
+t0 = t8 + t9;
+t4 = t0 + t2;
+t5 = MEM_U32(t4 + 0);
+// bdead 4009 gp = MEM_U32(sp + 32);
+v0 = t5 + v0;
+L41a3f8:
+// bdead 9 ra = MEM_U32(sp + 36);
+L41a3fc:
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint64_t func_41a40c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0;
+uint64_t temp64;
+L41a40c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff78;
+//nop;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s2;
+MEM_U32(sp + 140) = a1;
+s0 = a2 + 0x1;
+s2 = a0;
+// fdead 400a00eb MEM_U32(sp + 32) = gp;
+// fdead 400a00eb MEM_U32(sp + 24) = s1;
+a1 = s0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400a000b gp = MEM_U32(sp + 32);
+s1 = 0x9;
+//nop;
+if (v0 == s1) goto L41a478;
+L41a458:
+//nop;
+s0 = s0 + 0x1;
+a1 = s0;
+a0 = s2;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != s1) goto L41a458;
+L41a478:
+//nop;
+a1 = MEM_U32(sp + 140);
+a0 = s2;
+a2 = s0;
+temp64 = f_file_symbol_iaux(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+at = 0xf0000;
+// bdead 4008001f gp = MEM_U32(sp + 32);
+at = at | 0xffff;
+MEM_U32(sp + 48) = v0;
+if (v0 != at) goto L41a4a8;
+v0 = 0x1;
+goto L41a4d0;
+L41a4a8:
+//nop;
+MEM_U32(sp + 44) = zero;
+MEM_U32(sp + 40) = s2;
+a0 = s2;
+a1 = sp + 0x28;
+temp64 = f_type_deref(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v0 = MEM_U8(sp + 52);
+// bdead 19 gp = MEM_U32(sp + 32);
+t6 = v0 & 0x3f;
+v0 = t6 < 0x1;
+L41a4d0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x88;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_scope_name_search(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L41a4e8:
+//scope_name_search:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff28;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 224) = a2;
+MEM_U32(sp + 228) = a3;
+t6 = MEM_U32(a0 + 204);
+s2 = a0;
+s3 = a1;
+if (a1 < t6) goto L41a554;
+t7 = MEM_U32(a0 + 216);
+//nop;
+//nop;
+if (a1 < t7) goto L41a55c;
+L41a554:
+v0 = 0xffffffff;
+goto L41a890;
+L41a55c:
+//nop;
+a0 = s2;
+a1 = s3;
+v0 = f_symbol_to_file(mem, sp, a0, a1);
+// bdead 4018000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 212) = v0;
+//nop;
+a0 = s2;
+a1 = v0;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4018001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+MEM_U32(sp + 208) = v0;
+if (v0 != at) goto L41a59c;
+v0 = 0xffffffff;
+goto L41a890;
+L41a59c:
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4018000b gp = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 212);
+//nop;
+s6 = v0;
+a0 = s2;
+a2 = s3;
+temp64 = f_file_end_symbol(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4088001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+t8 = MEM_U32(sp + 208);
+if (v0 != at) goto L41a5e4;
+v0 = 0xffffffff;
+goto L41a890;
+// fdead 0 t8 = MEM_U32(sp + 208);
+L41a5e4:
+s3 = v0 + 0xffffffff;
+s7 = 0x7;
+if (t8 >= s3) goto L41a88c;
+fp = MEM_U32(sp + 232);
+s5 = 0xb;
+L41a5fc:
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 212);
+//nop;
+s4 = v0;
+// fdead e1fe005f t9 = t9;
+a0 = s2;
+a2 = s3;
+v0 = func_41a2a8(mem, sp, a0, a1, a2);
+// bdead c1f8000b gp = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 224);
+//nop;
+a2 = MEM_U32(sp + 228);
+a0 = v0;
+v0 = f_case_streq(mem, sp, a0, a1, a2);
+// bdead c1f8001b gp = MEM_U32(sp + 60);
+at = 0x8;
+if (v0 == 0) goto L41a700;
+at = 0x8;
+if (s4 != 0) goto L41a674;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1f8001b gp = MEM_U32(sp + 60);
+at = 0x8;
+if (v0 == 0) goto L41a878;
+L41a674:
+s1 = s3;
+if (s4 != at) goto L41a698;
+//nop;
+a0 = s2;
+a1 = s3;
+v0 = f_symbol_isym(mem, sp, a0, a1);
+// bdead c1f8000b gp = MEM_U32(sp + 60);
+s1 = v0;
+goto L41a698;
+L41a698:
+//nop;
+a0 = s2;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+s0 = v0;
+//nop;
+a0 = s2;
+a1 = s1;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe001b gp = MEM_U32(sp + 60);
+//nop;
+if (fp == 0) goto L41a6e4;
+at = 0x8;
+if (s0 != s7) goto L41a700;
+at = 0x8;
+if (v0 != s5) goto L41a700;
+v0 = s1;
+goto L41a890;
+L41a6e4:
+//nop;
+if (s0 != s7) goto L41a6f4;
+at = 0x8;
+if (v0 == s5) goto L41a700;
+L41a6f4:
+v0 = s1;
+goto L41a890;
+at = 0x8;
+L41a700:
+if (s4 != at) {
+at = 0x2;
+goto L41a7e4;}
+at = 0x2;
+//nop;
+a0 = s2;
+a1 = s3;
+v0 = f_symbol_isym(mem, sp, a0, a1);
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+s0 = v0;
+//nop;
+a0 = s2;
+a1 = v0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1da001b gp = MEM_U32(sp + 60);
+at = 0x6;
+if (v0 != s7) goto L41a7a4;
+//nop;
+a0 = s2;
+a1 = s0;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1da001b gp = MEM_U32(sp + 60);
+a0 = s2;
+if (v0 != s5) goto L41a7a0;
+//nop;
+s1 = s0 + 0x1;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1de001b gp = MEM_U32(sp + 60);
+at = 0x9;
+a0 = s2;
+if (v0 != at) goto L41a7a0;
+//nop;
+a1 = MEM_U32(sp + 212);
+// fdead e1fe007f t9 = t9;
+a2 = s0;
+temp64 = func_41a40c(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1dc001b gp = MEM_U32(sp + 60);
+t9 = MEM_U32(sp + 208);
+if (v0 != 0) goto L41a87c;
+s3 = s1;
+goto L41a878;
+L41a7a0:
+at = 0x6;
+L41a7a4:
+if (s6 == at) {
+at = 0xe;
+goto L41a7c4;}
+at = 0xe;
+//nop;
+if (s6 == at) goto L41a7c4;
+//nop;
+if (s6 == s5) goto L41a7c4;
+s3 = s0;
+goto L41a878;
+L41a7c4:
+//nop;
+a0 = s2;
+a1 = s0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c158001b gp = MEM_U32(sp + 60);
+s6 = v0;
+goto L41a878;
+at = 0x2;
+L41a7e4:
+t9 = MEM_U32(sp + 208);
+if (s4 != at) goto L41a87c;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8001b gp = MEM_U32(sp + 60);
+at = 0x11;
+t9 = MEM_U32(sp + 208);
+if (v0 != at) goto L41a87c;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_iaux(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 92) = v0;
+//nop;
+MEM_U32(sp + 88) = zero;
+a0 = s2;
+a1 = sp + 0x54;
+temp64 = f_type_deref(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a1 = MEM_U32(sp + 104);
+// bdead c1d80053 gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+a0 = s2;
+if (a1 == at) goto L41a878;
+//nop;
+a2 = MEM_U32(sp + 224);
+a3 = MEM_U32(sp + 228);
+MEM_U32(sp + 16) = fp;
+temp64 = f_scope_name_search(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+//nop;
+if (v0 == at) goto L41a878;
+// bdead 19 ra = MEM_U32(sp + 68);
+goto L41a894;
+L41a878:
+t9 = MEM_U32(sp + 208);
+L41a87c:
+s3 = s3 + 0xffffffff;
+//nop;
+if (t9 < s3) goto L41a5fc;
+L41a88c:
+v0 = 0xffffffff;
+L41a890:
+// bdead 19 ra = MEM_U32(sp + 68);
+L41a894:
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0xd8;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_41a8c0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L41a8c0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff28;
+//nop;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+s3 = a1;
+// fdead 401001eb MEM_U32(sp + 68) = ra;
+// fdead 401001eb MEM_U32(sp + 56) = s7;
+// fdead 401001eb MEM_U32(sp + 36) = s2;
+s2 = a0;
+s7 = a2;
+// fdead 411801eb MEM_U32(sp + 64) = fp;
+// fdead 411801eb MEM_U32(sp + 60) = gp;
+// fdead 411801eb MEM_U32(sp + 52) = s6;
+// fdead 411801eb MEM_U32(sp + 48) = s5;
+// fdead 411801eb MEM_U32(sp + 44) = s4;
+// fdead 411801eb MEM_U32(sp + 32) = s1;
+// fdead 411801eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 228) = a3;
+a1 = a2;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4118001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+MEM_U32(sp + 212) = v0;
+if (v0 != at) goto L41a930;
+v0 = 0xffffffff;
+goto L41ac2c;
+L41a930:
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4118000b gp = MEM_U32(sp + 60);
+s6 = v0;
+//nop;
+a0 = s2;
+a1 = s7;
+a2 = s3;
+temp64 = f_file_end_symbol(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4188001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+t6 = MEM_U32(sp + 212);
+if (v0 != at) goto L41a978;
+v0 = 0xffffffff;
+goto L41ac2c;
+// fdead 0 t6 = MEM_U32(sp + 212);
+L41a978:
+s3 = v0 + 0xffffffff;
+fp = 0x7;
+if (t6 >= s3) goto L41ac28;
+s5 = 0xb;
+L41a98c:
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+s4 = v0;
+//nop;
+a0 = s2;
+// fdead e1fe003f t9 = t9;
+a1 = s7;
+a2 = s3;
+v0 = func_41a2a8(mem, sp, a0, a1, a2);
+// bdead c1f8000b gp = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 228);
+//nop;
+a2 = MEM_U32(sp + 232);
+a0 = v0;
+v0 = f_case_streq(mem, sp, a0, a1, a2);
+// bdead c1f8001b gp = MEM_U32(sp + 60);
+at = 0x8;
+if (v0 == 0) goto L41aa98;
+at = 0x8;
+if (s4 != 0) goto L41aa04;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1f8001b gp = MEM_U32(sp + 60);
+at = 0x8;
+if (v0 == 0) goto L41ac14;
+L41aa04:
+s1 = s3;
+if (s4 != at) goto L41aa2c;
+//nop;
+a0 = s2;
+a1 = s7;
+a2 = s3;
+v0 = f_file_symbol_isym(mem, sp, a0, a1, a2);
+// bdead c1f8000b gp = MEM_U32(sp + 60);
+s1 = v0;
+goto L41aa2c;
+L41aa2c:
+//nop;
+a0 = s2;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+s0 = v0;
+//nop;
+a0 = s2;
+a1 = s1;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U32(sp + 236);
+// bdead c1ff001b gp = MEM_U32(sp + 60);
+//nop;
+if (t7 == 0) goto L41aa7c;
+at = 0x8;
+if (s0 != fp) goto L41aa98;
+at = 0x8;
+if (v0 != s5) goto L41aa98;
+v0 = s1;
+goto L41ac2c;
+L41aa7c:
+//nop;
+if (s0 != fp) goto L41aa8c;
+at = 0x8;
+if (v0 == s5) goto L41aa98;
+L41aa8c:
+v0 = s1;
+goto L41ac2c;
+at = 0x8;
+L41aa98:
+a0 = s2;
+if (s4 != at) goto L41ab78;
+//nop;
+a1 = s7;
+a2 = s3;
+v0 = f_file_symbol_isym(mem, sp, a0, a1, a2);
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+s0 = v0;
+//nop;
+a0 = s2;
+a1 = v0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1da001b gp = MEM_U32(sp + 60);
+at = 0x6;
+if (v0 != fp) goto L41ab3c;
+//nop;
+a0 = s2;
+a1 = s0;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1da001b gp = MEM_U32(sp + 60);
+a0 = s2;
+if (v0 != s5) goto L41ab38;
+//nop;
+s1 = s0 + 0x1;
+a1 = s1;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1de001b gp = MEM_U32(sp + 60);
+at = 0x9;
+a0 = s2;
+if (v0 != at) goto L41ab38;
+//nop;
+a1 = s7;
+// fdead e1fe007f t9 = t9;
+a2 = s0;
+temp64 = func_41a40c(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1dc001b gp = MEM_U32(sp + 60);
+t9 = MEM_U32(sp + 212);
+if (v0 != 0) goto L41ac18;
+s3 = s1;
+goto L41ac14;
+L41ab38:
+at = 0x6;
+L41ab3c:
+if (s6 == at) {
+at = 0xe;
+goto L41ab5c;}
+at = 0xe;
+//nop;
+if (s6 == at) goto L41ab5c;
+//nop;
+if (s6 == s5) goto L41ab5c;
+s3 = s0;
+goto L41ac14;
+L41ab5c:
+//nop;
+a0 = s2;
+a1 = s0;
+temp64 = f_symbol_type(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c158001b gp = MEM_U32(sp + 60);
+s6 = v0;
+goto L41ac14;
+L41ab78:
+at = 0x2;
+t9 = MEM_U32(sp + 212);
+if (s4 != at) goto L41ac18;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8001b gp = MEM_U32(sp + 60);
+at = 0x11;
+t9 = MEM_U32(sp + 212);
+if (v0 != at) goto L41ac18;
+//nop;
+a0 = s2;
+a1 = s3;
+temp64 = f_symbol_iaux(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 96) = v0;
+//nop;
+MEM_U32(sp + 92) = zero;
+a0 = s2;
+a1 = sp + 0x58;
+temp64 = f_type_deref(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a1 = MEM_U32(sp + 108);
+// bdead c1d80053 gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+a0 = s2;
+if (a1 == at) goto L41ac14;
+t8 = MEM_U32(sp + 236);
+//nop;
+a2 = MEM_U32(sp + 228);
+a3 = MEM_U32(sp + 232);
+MEM_U32(sp + 16) = t8;
+temp64 = f_scope_name_search(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1d8001b gp = MEM_U32(sp + 60);
+at = 0xffffffff;
+//nop;
+if (v0 == at) goto L41ac14;
+// bdead 19 ra = MEM_U32(sp + 68);
+goto L41ac30;
+L41ac14:
+t9 = MEM_U32(sp + 212);
+L41ac18:
+s3 = s3 + 0xffffffff;
+//nop;
+if (t9 < s3) goto L41a98c;
+L41ac28:
+v0 = 0xffffffff;
+L41ac2c:
+// bdead 19 ra = MEM_U32(sp + 68);
+L41ac30:
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0xd8;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_file_scope_name_search(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+uint64_t temp64;
+L41ac5c:
+//file_scope_name_search:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 36) = ra;
+// fdead 400001e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 32);
+at = 0xffffffff;
+a1 = v0;
+if (v0 != at) goto L41aca4;
+v0 = 0xffffffff;
+goto L41acd4;
+L41aca4:
+//nop;
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+// fdead 600181ff t9 = t9;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+temp64 = func_41a8c0(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+//nop;
+L41acd4:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_case_strcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41b1f8:
+//case_strcmp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffdc8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+v1 = MEM_S8(a0 + 0);
+v0 = sp + 0x138;
+a2 = a0 + 0x1;
+if (v1 == 0) goto L41b258;
+at = (int)v1 < (int)0x5b;
+L41b224:
+if (at == 0) {
+at = (int)v1 < (int)0x41;
+goto L41b240;}
+t6 = v1 + 0x20;
+if ((int)v1 < (int)0x41) goto L41b240;
+MEM_U8(v0 + 0) = (uint8_t)t6;
+v0 = v0 + 0x1;
+goto L41b248;
+L41b240:
+MEM_U8(v0 + 0) = (uint8_t)v1;
+v0 = v0 + 0x1;
+L41b248:
+v1 = MEM_S8(a2 + 0);
+a2 = a2 + 0x1;
+at = (int)v1 < (int)0x5b;
+if (v1 != 0) goto L41b224;
+L41b258:
+MEM_U8(v0 + 0) = (uint8_t)zero;
+v1 = MEM_S8(a1 + 0);
+a3 = sp + 0x38;
+v0 = a3;
+a2 = a1 + 0x1;
+if (v1 == 0) goto L41b2a8;
+at = (int)v1 < (int)0x5b;
+L41b274:
+if (at == 0) {
+at = (int)v1 < (int)0x41;
+goto L41b290;}
+t7 = v1 + 0x20;
+if ((int)v1 < (int)0x41) goto L41b290;
+MEM_U8(v0 + 0) = (uint8_t)t7;
+v0 = v0 + 0x1;
+goto L41b298;
+L41b290:
+MEM_U8(v0 + 0) = (uint8_t)v1;
+v0 = v0 + 0x1;
+L41b298:
+v1 = MEM_S8(a2 + 0);
+a2 = a2 + 0x1;
+at = (int)v1 < (int)0x5b;
+if (v1 != 0) goto L41b274;
+L41b2a8:
+MEM_U8(v0 + 0) = (uint8_t)zero;
+//nop;
+a0 = sp + 0x138;
+a1 = a3;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x238;
+return v0;
+}
+
+static uint32_t f_case_streq(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t1 = 0, t7 = 0, t9 = 0;
+L41b2cc:
+//case_streq:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+if (a0 != 0) goto L41b2f8;
+v0 = a1 < 0x1;
+goto L41b39c;
+L41b2f8:
+//nop;
+MEM_U32(sp + 40) = a0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(sp + 36) = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t7 = MEM_U32(sp + 36);
+// bdead 4001001b gp = MEM_U32(sp + 24);
+if (v0 == t7) {
+v0 = MEM_U32(sp + 48);
+goto L41b33c;}
+v0 = MEM_U32(sp + 48);
+v0 = zero;
+goto L41b39c;
+// fdead 0 v0 = MEM_U32(sp + 48);
+L41b33c:
+a0 = MEM_U32(sp + 40);
+if (zero >= v0) {
+v0 = MEM_U32(sp + 48);
+goto L41b370;}
+v0 = MEM_U32(sp + 48);
+//nop;
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+t9 = v0 < 0x1;
+v0 = t9;
+if (t9 != 0) goto L41b39c;
+v0 = MEM_U32(sp + 48);
+L41b370:
+a0 = MEM_U32(sp + 40);
+t0 = v0 < 0x1;
+v0 = t0;
+if (t0 == 0) goto L41b39c;
+//nop;
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_case_strcmp(mem, sp, a0, a1);
+t1 = v0 < 0x1;
+// bdead 411 gp = MEM_U32(sp + 24);
+v0 = t1;
+L41b39c:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_41b3ac(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0, lo = 0,
+hi = 0;
+uint64_t temp64;
+L41b3ac:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 24) = s1;
+s1 = 0x10004c5c;
+// fdead 400400eb MEM_U32(sp + 20) = s0;
+s1 = s1;
+s0 = MEM_U32(s1 + 0);
+// fdead 400600eb MEM_U32(sp + 40) = s5;
+s5 = a0;
+// fdead 404600eb MEM_U32(sp + 60) = ra;
+// fdead 404600eb MEM_U32(sp + 56) = fp;
+// fdead 404600eb MEM_U32(sp + 52) = gp;
+// fdead 404600eb MEM_U32(sp + 48) = s7;
+// fdead 404600eb MEM_U32(sp + 44) = s6;
+// fdead 404600eb MEM_U32(sp + 36) = s4;
+// fdead 404600eb MEM_U32(sp + 32) = s3;
+// fdead 404600eb MEM_U32(sp + 28) = s2;
+if (s0 == 0) goto L41b41c;
+L41b3fc:
+t6 = MEM_U32(s0 + 0);
+//nop;
+// bdead 40460003 ra = MEM_U32(sp + 60);
+if (s5 == t6) goto L41b5ac;
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L41b3fc;
+L41b41c:
+//nop;
+a0 = 0x8;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 404401cb gp = MEM_U32(sp + 52);
+s0 = v0;
+if (v0 != 0) goto L41b454;
+a0 = 0x1000258c;
+//nop;
+a0 = a0;
+//nop;
+f_panic(mem, sp, a0);
+// bdead 40460003 gp = MEM_U32(sp + 52);
+//nop;
+L41b454:
+MEM_U32(s0 + 0) = s5;
+t7 = MEM_U32(s1 + 0);
+s6 = 0x3fff0000;
+MEM_U32(s0 + 4) = t7;
+MEM_U32(s1 + 0) = s0;
+t8 = MEM_U32(s5 + 156);
+s4 = MEM_U32(s5 + 216);
+t9 = MEM_U32(t8 + 88);
+s6 = s6 | 0xffff;
+t0 = s4 + t9;
+s7 = 0x3f1;
+if (s4 >= t0) goto L41b5a8;
+fp = 0x10003c98;
+s1 = 0xfb504f0;
+s2 = 0x265;
+fp = fp;
+L41b498:
+//nop;
+a0 = 0x14;
+s0 = zero;
+v0 = wrapper_malloc(mem, a0);
+// bdead c1ee000b gp = MEM_U32(sp + 52);
+s3 = v0;
+//nop;
+a0 = s5;
+a1 = s4;
+v0 = f_symbol_name(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 4) = v0;
+//nop;
+a0 = s5;
+a1 = s4;
+temp64 = f_symbol_class(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 8) = v0;
+MEM_U32(s3 + 12) = s4;
+MEM_U32(s3 + 0) = s5;
+//nop;
+a0 = MEM_U32(s3 + 4);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+v1 = v0;
+a0 = v0;
+if ((int)v0 <= 0) goto L41b53c;
+v0 = MEM_U32(s3 + 4);
+//nop;
+L41b510:
+lo = v1 * s2;
+hi = (uint32_t)((uint64_t)v1 * (uint64_t)s2 >> 32);
+t1 = MEM_S8(v0 + 0);
+s0 = s0 + 0x1;
+t2 = t1 + s1;
+t3 = MEM_U8(t2 + 258);
+at = (int)s0 < (int)a0;
+v0 = v0 + 0x1;
+t4 = lo;
+v1 = t3 + t4;
+//nop;
+if (at != 0) goto L41b510;
+L41b53c:
+v1 = v1 & s6;
+lo = (int)v1 / (int)s7; hi = (int)v1 % (int)s7;
+s4 = s4 + 0x1;
+//nop;
+if (s7 != 0) goto L41b554;
+abort();
+L41b554:
+at = 0xffffffff;
+if (s7 != at) {
+at = 0x80000000;
+goto L41b56c;}
+at = 0x80000000;
+//nop;
+if (v1 != at) goto L41b56c;
+abort();
+L41b56c:
+v1 = hi;
+t5 = v1 << 2;
+v0 = fp + t5;
+t6 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(s3 + 16) = t6;
+MEM_U32(v0 + 0) = s3;
+t8 = MEM_U32(s5 + 156);
+t7 = MEM_U32(s5 + 216);
+t9 = MEM_U32(t8 + 88);
+//nop;
+t0 = t7 + t9;
+//nop;
+if (s4 < t0) goto L41b498;
+L41b5a8:
+// bdead 1 ra = MEM_U32(sp + 60);
+L41b5ac:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static uint32_t f_search_externals(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L41b5d8:
+//search_externals:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 60) = ra;
+// fdead 400000eb MEM_U32(sp + 52) = s7;
+// fdead 400000eb MEM_U32(sp + 48) = s6;
+// fdead 400000eb MEM_U32(sp + 44) = s5;
+// fdead 400000eb t9 = t9;
+s5 = a0;
+s6 = a1;
+s7 = a2;
+// fdead 41c000eb MEM_U32(sp + 56) = gp;
+// fdead 41c000eb MEM_U32(sp + 40) = s4;
+// fdead 41c000eb MEM_U32(sp + 36) = s3;
+// fdead 41c000eb MEM_U32(sp + 32) = s2;
+// fdead 41c000eb MEM_U32(sp + 28) = s1;
+// fdead 41c000eb MEM_U32(sp + 24) = s0;
+func_41b3ac(mem, sp, a0);
+// bdead 41c00003 gp = MEM_U32(sp + 56);
+a0 = s6;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 41c0000b gp = MEM_U32(sp + 56);
+a0 = v0;
+a3 = v0;
+v1 = zero;
+if ((int)v0 <= 0) goto L41b68c;
+a1 = 0xfb504f0;
+v0 = s6;
+a2 = 0x265;
+L41b660:
+lo = a0 * a2;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a2 >> 32);
+t6 = MEM_S8(v0 + 0);
+v1 = v1 + 0x1;
+t7 = t6 + a1;
+t8 = MEM_U8(t7 + 258);
+at = (int)v1 < (int)a3;
+v0 = v0 + 0x1;
+t9 = lo;
+a0 = t8 + t9;
+//nop;
+if (at != 0) goto L41b660;
+L41b68c:
+at = 0x3fff0000;
+at = at | 0xffff;
+t0 = a0 & at;
+at = 0x3f1;
+lo = (int)t0 / (int)at; hi = (int)t0 % (int)at;
+t3 = 0x10003c98;
+s4 = 0x6;
+t3 = t3;
+s3 = 0x12;
+s2 = 0x11;
+s1 = 0x15;
+t1 = hi;
+t2 = t1 << 2;
+t4 = t2 + t3;
+s0 = MEM_U32(t4 + 0);
+//nop;
+v0 = 0xffffffff;
+if (s0 == 0) goto L41b7b8;
+L41b6d4:
+t5 = MEM_U32(s0 + 0);
+a1 = s6;
+//nop;
+if (s5 != t5) goto L41b7a4;
+//nop;
+a0 = MEM_U32(s0 + 4);
+a2 = s7;
+v0 = f_case_streq(mem, sp, a0, a1, a2);
+// bdead 41fe0009 gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L41b7a4;
+v0 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+if (s4 == v0) goto L41b7a4;
+//nop;
+if (s1 == v0) goto L41b7a4;
+//nop;
+if (s2 == v0) goto L41b7a4;
+//nop;
+if (s3 == v0) goto L41b7a4;
+a1 = MEM_U32(s0 + 12);
+t6 = MEM_U32(s5 + 216);
+v0 = MEM_U32(s5 + 172);
+v1 = a1 - t6;
+t7 = v1 << 4;
+t8 = v0 + t7;
+a0 = MEM_S16(t8 + 2);
+t9 = v1 << 4;
+a2 = v0 + t9;
+a2 = a2 + 0x4;
+if (a0 == 0) goto L41b79c;
+v0 = MEM_U32(a2 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+v1 = v0 & at;
+t0 = v0 >> 26;
+if (v1 == at) goto L41b79c;
+t2 = a0 << 3;
+if (s4 != t0) goto L41b79c;
+t1 = MEM_U32(s5 + 160);
+t2 = t2 + a0;
+t2 = t2 << 3;
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 16);
+t5 = MEM_U32(s5 + 204);
+//nop;
+t6 = t4 + t5;
+v0 = t6 + v1;
+goto L41b7b8;
+L41b79c:
+v0 = a1;
+goto L41b7b8;
+L41b7a4:
+s0 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+if (s0 != 0) goto L41b6d4;
+v0 = 0xffffffff;
+L41b7b8:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 s6 = MEM_U32(sp + 48);
+// bdead 9 s7 = MEM_U32(sp + 52);
+// bdead 9 sp = sp + 0x40;
+return v0;
+//nop;
+}
+
+static uint32_t func_41b7e8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41b7e8:
+//nop;
+//nop;
+//nop;
+t6 = MEM_U32(a1 + 8);
+MEM_U32(a1 + 40) = a2;
+t7 = a2 << 2;
+if ((int)t6 >= 0) goto L41b810;
+t8 = 0x100077f0;
+v0 = t7 + t8;
+return v0;
+L41b810:
+t0 = MEM_U32(a0 + 200);
+t9 = MEM_U32(a0 + 192);
+t1 = a2 - t0;
+t2 = t1 << 2;
+v0 = t9 + t2;
+//nop;
+return v0;
+}
+
+static uint64_t f_aux_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L41b82c:
+//aux_isym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a0;
+v0 = f_type_to_file(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 40);
+t7 = MEM_U32(sp + 44);
+t0 = MEM_U32(a0 + 200);
+t6 = MEM_U32(a0 + 192);
+t8 = t7 << 2;
+t1 = t0 << 2;
+t2 = -t1;
+t9 = t6 + t8;
+t3 = t9 + t2;
+v1 = MEM_U32(t3 + 0);
+a2 = 0xf0000;
+a2 = a2 | 0xffff;
+// bdead 400000b9 gp = MEM_U32(sp + 24);
+a1 = v0;
+if (v1 != a2) goto L41b898;
+v0 = a2;
+goto L41b8b8;
+L41b898:
+//nop;
+MEM_U32(sp + 32) = v1;
+//nop;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 32);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L41b8b8:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_file_aux_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L41b8c8:
+//file_aux_isym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+t9 = MEM_U32(a0 + 200);
+t6 = MEM_U32(a0 + 192);
+t7 = a2 << 2;
+t0 = t9 << 2;
+t1 = -t0;
+t8 = t6 + t7;
+t2 = t8 + t1;
+v1 = MEM_U32(t2 + 0);
+a3 = 0xf0000;
+a3 = a3 | 0xffff;
+//nop;
+if (v1 != a3) goto L41b918;
+v0 = a3;
+goto L41b938;
+L41b918:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+temp64 = f_file_symbol(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 36);
+// bdead 19 gp = MEM_U32(sp + 24);
+v1 = v1 + v0;
+v0 = v1;
+L41b938:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void func_41b948(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41b948:
+//nop;
+//nop;
+//nop;
+t6 = 0x10004c64;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+if (t6 != 0) goto L41b9a4;
+at = 0x10004c64;
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 44) = a1;
+MEM_U32(at + 0) = t7;
+v0 = f_gethostsex(mem, sp);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+at = 0x10004c60;
+//nop;
+MEM_U32(at + 0) = v0;
+L41b9a4:
+t8 = sp + 0x30;
+at = MEM_U32(t8 + 0);
+a0 = sp + 0x24;
+MEM_U32(a0 + 0) = at;
+if (a1 == 0) goto L41b9e8;
+t2 = MEM_U32(a1 + 0);
+a1 = MEM_U32(sp + 52);
+t3 = (int)t2 >> 31;
+t4 = MEM_U32(sp + 40);
+if (t3 == 0) goto L41b9ec;
+a2 = 0x10004c60;
+//nop;
+a2 = MEM_U32(a2 + 0);
+//nop;
+f_swap_aux(mem, sp, a0, a1, a2);
+// bdead 40000011 gp = MEM_U32(sp + 24);
+a0 = sp + 0x24;
+L41b9e8:
+t4 = MEM_U32(sp + 40);
+L41b9ec:
+at = MEM_U32(a0 + 0);
+//nop;
+MEM_U32(t4 + 0) = at;
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 v0 = MEM_U32(sp + 40);
+// bdead 11 sp = sp + 0x28;
+return;
+}
+
+static uint64_t func_41ba08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L41ba08:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 80) = a2;
+a2 = MEM_U32(a1 + 40);
+// fdead 400001eb t9 = t9;
+s0 = a0;
+s1 = a1;
+MEM_U32(sp + 48) = a2;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(v0 + 0);
+//nop;
+t8 = v0 + 0x4;
+// fdead 6206008b t9 = t9;
+MEM_U32(sp + 68) = t8;
+a0 = sp + 0x2c;
+a1 = s0;
+a3 = 0x1;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+a0 = sp + 0x2c;
+at = MEM_U32(a0 + 0);
+// bdead 40060025 gp = MEM_U32(sp + 32);
+t9 = sp + 0x34;
+MEM_U32(t9 + 0) = at;
+v1 = MEM_U32(sp + 52);
+at = 0xfff;
+t3 = v1 >> 20;
+v1 = t3;
+if (t3 != at) goto L41bad4;
+t4 = MEM_U32(sp + 68);
+//nop;
+a2 = MEM_U32(t4 + 0);
+// bdead 400600a1 t9 = t9;
+a1 = s0;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s1 + 40);
+// bdead 40070001 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 44);
+t8 = t7 + 0x2;
+MEM_U32(s1 + 40) = t8;
+goto L41bae4;
+L41bad4:
+t1 = MEM_U32(s1 + 40);
+a2 = v1;
+t0 = t1 + 0x1;
+MEM_U32(s1 + 40) = t0;
+L41bae4:
+t9 = MEM_U32(s0 + 156);
+a1 = 0x48;
+t2 = MEM_U32(t9 + 80);
+a0 = s0;
+//nop;
+if (t2 != 0) goto L41bb08;
+v1 = MEM_U32(s0 + 160);
+a0 = a2;
+goto L41bb6c;
+L41bb08:
+//nop;
+a1 = MEM_U32(sp + 48);
+MEM_U32(sp + 64) = a2;
+v0 = f_type_to_file(mem, sp, a0, a1);
+t4 = MEM_U32(s0 + 208);
+a1 = 0x48;
+lo = t4 * a1;
+hi = (uint32_t)((uint64_t)t4 * (uint64_t)a1 >> 32);
+t3 = v0 << 3;
+v1 = MEM_U32(s0 + 160);
+t3 = t3 + v0;
+t3 = t3 << 3;
+t5 = v1 + t3;
+a2 = MEM_U32(sp + 64);
+t0 = MEM_U32(s0 + 188);
+// bdead 4400642d1 gp = MEM_U32(sp + 32);
+t6 = lo;
+t7 = -t6;
+t8 = t5 + t7;
+t1 = MEM_U32(t8 + 52);
+//nop;
+a2 = a2 + t1;
+t9 = a2 << 2;
+t2 = t0 + t9;
+a0 = MEM_U32(t2 + 0);
+//nop;
+L41bb6c:
+t3 = MEM_U32(sp + 80);
+//nop;
+//nop;
+if (t3 != 0) goto L41bbb4;
+lo = a0 * a1;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a1 >> 32);
+t7 = MEM_U32(s0 + 204);
+t1 = MEM_U32(sp + 52);
+at = 0xf0000;
+at = at | 0xffff;
+t0 = t1 & at;
+t4 = lo;
+t6 = v1 + t4;
+t5 = MEM_U32(t6 + 16);
+//nop;
+t8 = t5 + t7;
+t9 = t8 + t0;
+MEM_U32(s1 + 48) = t9;
+goto L41bbe8;
+L41bbb4:
+lo = a0 * a1;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a1 >> 32);
+t6 = MEM_U32(s0 + 200);
+t7 = MEM_U32(sp + 52);
+at = 0xf0000;
+at = at | 0xffff;
+t1 = t7 & at;
+t2 = lo;
+t3 = v1 + t2;
+t4 = MEM_U32(t3 + 44);
+//nop;
+t5 = t4 + t6;
+t8 = t5 + t1;
+MEM_U32(s1 + 24) = t8;
+L41bbe8:
+// bdead 11 ra = MEM_U32(sp + 36);
+// bdead 11 s0 = MEM_U32(sp + 24);
+// bdead 11 s1 = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_41be28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L41be28:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 4000016b MEM_U32(sp + 24) = s0;
+s0 = a1;
+// fdead 4002016b MEM_U32(sp + 36) = ra;
+// fdead 4002016b MEM_U32(sp + 32) = gp;
+// fdead 4002016b MEM_U32(sp + 28) = s1;
+a2 = MEM_U32(s0 + 40);
+// fdead 400201eb t9 = t9;
+s1 = a0;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a2 = MEM_U32(v0 + 0);
+//nop;
+a0 = sp + 0x2c;
+// fdead 600600ab t9 = t9;
+a1 = s1;
+a3 = zero;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t8 = sp + 0x2c;
+at = MEM_U32(t8 + 0);
+t2 = MEM_U32(s0 + 40);
+// bdead 40060817 gp = MEM_U32(sp + 32);
+t5 = at >> 31;
+t3 = t2 + 0x1;
+MEM_U32(s0 + 40) = t3;
+MEM_U32(s0 + 12) = at;
+if (t5 == 0) goto L41befc;
+//nop;
+a0 = s1;
+// fdead 6206582f t9 = t9;
+a1 = s0;
+a2 = t3;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a2 = MEM_U32(v0 + 0);
+//nop;
+a0 = sp + 0x2c;
+// fdead 600600af t9 = t9;
+a1 = s1;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(s0 + 40);
+t0 = MEM_U32(sp + 44);
+// bdead 44060213 gp = MEM_U32(sp + 32);
+t8 = t9 + 0x1;
+MEM_U32(s0 + 40) = t8;
+MEM_U32(s0 + 64) = t0;
+L41befc:
+t1 = MEM_U8(s0 + 12);
+//nop;
+t2 = t1 & 0x3f;
+t3 = t2 + 0xfffffff4;
+// bdead 40061013 ra = MEM_U32(sp + 36);
+if (t3 >= 0x9) goto L41c054;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L41bf38;
+case 1: goto L41bf38;
+case 2: goto L41bf38;
+case 3: goto L41bf38;
+case 4: goto L41bfa8;
+case 5: goto L41bf84;
+case 6: goto L41c050;
+case 7: goto L41c050;
+case 8: goto L41bf60;
+}
+L41bf38:
+//nop;
+a0 = s1;
+// bdead 40020023 t9 = t9;
+a1 = s0;
+a2 = zero;
+temp64 = func_41ba08(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U32(s0 + 48);
+// bdead 22011 gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 20) = t4;
+goto L41c050;
+L41bf60:
+//nop;
+a0 = s1;
+// bdead 40020021 t9 = t9;
+a1 = s0;
+a2 = 0x1;
+temp64 = func_41ba08(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 32);
+// bdead 11 ra = MEM_U32(sp + 36);
+goto L41c054;
+L41bf84:
+//nop;
+a0 = s1;
+// bdead 40020021 t9 = t9;
+a1 = s0;
+a2 = 0x1;
+temp64 = func_41ba08(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 32);
+// bdead 11 ra = MEM_U32(sp + 36);
+goto L41c054;
+L41bfa8:
+//nop;
+a0 = s1;
+// bdead 40060021 t9 = t9;
+a1 = s0;
+a2 = 0x1;
+temp64 = func_41ba08(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(s0 + 40);
+//nop;
+a0 = s1;
+// fdead 1600600bf t9 = t9;
+a1 = s0;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(v0 + 0);
+//nop;
+t7 = v0 + 0x4;
+// fdead 16007008f t9 = t9;
+MEM_U32(sp + 60) = t7;
+a0 = sp + 0x2c;
+a1 = s1;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t0 = MEM_U32(sp + 44);
+// bdead 40060201 gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 28) = t0;
+t9 = MEM_U32(sp + 60);
+a0 = sp + 0x2c;
+a2 = MEM_U32(t9 + 0);
+//nop;
+a1 = s1;
+// bdead 400200e1 t9 = t9;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(s0 + 40);
+t2 = MEM_U32(sp + 44);
+// bdead 21811 gp = MEM_U32(sp + 32);
+t4 = t3 + 0x2;
+MEM_U32(s0 + 40) = t4;
+MEM_U32(s0 + 32) = t2;
+L41c050:
+// bdead 11 ra = MEM_U32(sp + 36);
+L41c054:
+// bdead 11 s0 = MEM_U32(sp + 24);
+// bdead 11 s1 = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_next_tq(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L41c064:
+//next_tq:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+a1 = MEM_U16(a0 + 12);
+a3 = MEM_U32(a0 + 0);
+v1 = MEM_U32(a0 + 16);
+t6 = a1 & 0xf;
+s0 = a0;
+MEM_U32(a0 + 36) = zero;
+if (t6 == 0) goto L41c0b4;
+//nop;
+if ((int)v1 < 0) goto L41c0b4;
+if (v1 >= 0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c0b4;}
+v1 = v1 + 0xffffffff;
+MEM_U32(a0 + 36) = t6;
+L41c0b4:
+a0 = MEM_U8(s0 + 13);
+//nop;
+t7 = a0 >> 4;
+//nop;
+if (t7 == 0) goto L41c0e0;
+//nop;
+if ((int)v1 < 0) goto L41c0e0;
+if (v1 >= 0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c0e0;}
+v1 = v1 + 0xffffffff;
+MEM_U32(s0 + 36) = t7;
+L41c0e0:
+a0 = MEM_U32(s0 + 12);
+//nop;
+t8 = a0 & 0xf;
+//nop;
+if (t8 == 0) goto L41c10c;
+//nop;
+if ((int)v1 < 0) goto L41c10c;
+if (v1 >= 0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c10c;}
+v1 = v1 + 0xffffffff;
+MEM_U32(s0 + 36) = t8;
+L41c10c:
+a0 = MEM_U8(s0 + 15);
+//nop;
+t9 = a0 >> 4;
+a0 = t9;
+if (t9 == 0) goto L41c138;
+//nop;
+if ((int)v1 < 0) goto L41c138;
+if (v1 >= 0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c138;}
+v1 = v1 + 0xffffffff;
+MEM_U32(s0 + 36) = a0;
+L41c138:
+a0 = MEM_U8(s0 + 14);
+//nop;
+t0 = a0 & 0xf;
+//nop;
+if (t0 == 0) goto L41c164;
+//nop;
+if ((int)v1 < 0) goto L41c164;
+if (v1 >= 0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c164;}
+v1 = v1 + 0xffffffff;
+MEM_U32(s0 + 36) = t0;
+L41c164:
+a0 = MEM_U16(s0 + 14);
+//nop;
+t1 = a0 >> 12;
+//nop;
+if (t1 == 0) goto L41c190;
+//nop;
+if ((int)v1 < 0) goto L41c190;
+//nop;
+if (v1 >= 0x1) goto L41c190;
+MEM_U32(s0 + 36) = t1;
+L41c190:
+t2 = MEM_U32(s0 + 16);
+t4 = MEM_U32(s0 + 36);
+t3 = t2 + 0x1;
+MEM_U32(s0 + 16) = t3;
+if (t4 >= 0x6) goto L41c4e0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L41c418;
+case 1: goto L41c4e0;
+case 2: goto L41c4e0;
+case 3: goto L41c1c8;
+case 4: goto L41c4e0;
+case 5: goto L41c4e0;
+}
+L41c1c8:
+t5 = MEM_U32(s0 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+a2 = 0x1;
+if (t5 == at) goto L41c4e0;
+t6 = MEM_U32(s0 + 68);
+//nop;
+//nop;
+if (t6 != 0) goto L41c2f4;
+v1 = MEM_U32(s0 + 16);
+a0 = zero;
+v1 = v1 + 0xffffffff;
+if ((int)v1 >= (int)0x1) {
+v1 = v1 + 0xffffffff;
+goto L41c21c;}
+v1 = v1 + 0xffffffff;
+t7 = MEM_U16(s0 + 12);
+a1 = 0x3;
+t8 = t7 & 0xf;
+v0 = (int)v1 < (int)0x1;
+if (a1 != t8) goto L41c220;
+a0 = 0x1;
+L41c21c:
+v0 = (int)v1 < (int)0x1;
+L41c220:
+a1 = 0x3;
+v1 = v1 + 0xffffffff;
+if (v0 == 0) goto L41c244;
+t9 = MEM_U8(s0 + 13);
+//nop;
+t0 = t9 >> 4;
+v0 = (int)v1 < (int)0x1;
+if (a1 != t0) goto L41c248;
+a0 = a0 + 0x1;
+L41c244:
+v0 = (int)v1 < (int)0x1;
+L41c248:
+v1 = v1 + 0xffffffff;
+if (v0 == 0) goto L41c268;
+t1 = MEM_U32(s0 + 12);
+//nop;
+t2 = t1 & 0xf;
+v0 = (int)v1 < (int)0x1;
+if (a1 != t2) goto L41c26c;
+a0 = a0 + 0x1;
+L41c268:
+v0 = (int)v1 < (int)0x1;
+L41c26c:
+v1 = v1 + 0xffffffff;
+if (v0 == 0) goto L41c28c;
+t3 = MEM_U8(s0 + 15);
+//nop;
+t4 = t3 >> 4;
+v0 = (int)v1 < (int)0x1;
+if (a1 != t4) goto L41c290;
+a0 = a0 + 0x1;
+L41c28c:
+v0 = (int)v1 < (int)0x1;
+L41c290:
+v1 = v1 + 0xffffffff;
+if (v0 == 0) goto L41c2b0;
+t5 = MEM_U8(s0 + 14);
+//nop;
+t6 = t5 & 0xf;
+//nop;
+if (a1 != t6) goto L41c2b0;
+a0 = a0 + 0x1;
+L41c2b0:
+//nop;
+if ((int)v1 > 0) goto L41c2d0;
+t7 = MEM_U16(s0 + 14);
+//nop;
+t8 = t7 >> 12;
+//nop;
+if (a1 != t8) goto L41c2d0;
+a0 = a0 + 0x1;
+L41c2d0:
+t9 = MEM_U32(s0 + 40);
+t0 = a0 << 2;
+t0 = t0 + a0;
+t1 = t9 + t0;
+t2 = t1 + 0xfffffffb;
+MEM_U32(s0 + 72) = a0;
+MEM_U32(s0 + 68) = a0;
+MEM_U32(s0 + 40) = t2;
+goto L41c304;
+L41c2f4:
+t3 = MEM_U32(s0 + 40);
+//nop;
+t4 = t3 + 0xfffffff6;
+MEM_U32(s0 + 40) = t4;
+L41c304:
+//nop;
+a0 = a3;
+// bdead 400201a3 t9 = t9;
+a1 = s0;
+MEM_U32(sp + 68) = a3;
+temp64 = func_41ba08(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 68);
+//nop;
+a2 = MEM_U32(s0 + 40);
+// fdead 600200bf t9 = t9;
+a1 = s0;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(v0 + 0);
+//nop;
+a1 = MEM_U32(sp + 68);
+v1 = v0 + 0x4;
+// fdead 600200df t9 = t9;
+MEM_U32(sp + 64) = v1;
+a0 = sp + 0x28;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 64);
+t7 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(s0 + 52) = t7;
+a2 = MEM_U32(v1 + 0);
+a1 = MEM_U32(sp + 68);
+v1 = v1 + 0x4;
+// fdead 600300df t9 = t9;
+MEM_U32(sp + 64) = v1;
+a0 = sp + 0x28;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 64);
+t0 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(s0 + 56) = t0;
+a2 = MEM_U32(v1 + 0);
+a1 = MEM_U32(sp + 68);
+// fdead 600202df t9 = t9;
+a0 = sp + 0x28;
+a3 = 0x4;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 40);
+t4 = MEM_U32(s0 + 40);
+t6 = MEM_U32(s0 + 72);
+// bdead 2b013 gp = MEM_U32(sp + 24);
+t5 = t4 + 0x3;
+t7 = t6 + 0xffffffff;
+MEM_U32(s0 + 40) = t5;
+MEM_U32(s0 + 72) = t7;
+MEM_U32(s0 + 60) = t3;
+if (t7 != 0) goto L41c4e0;
+t0 = MEM_U32(s0 + 68);
+// bdead 24213 t9 = t5;
+t1 = t0 << 2;
+t1 = t1 + t0;
+t2 = t5 + t1;
+t3 = t2 + 0xfffffffb;
+MEM_U32(s0 + 40) = t3;
+MEM_U32(s0 + 68) = zero;
+goto L41c4e0;
+L41c418:
+t4 = MEM_U32(s0 + 12);
+a0 = a3;
+t6 = t4 << 1;
+t5 = 0xffffffff;
+if ((int)t6 >= 0) goto L41c4a4;
+//nop;
+a2 = MEM_U32(s0 + 40);
+// bdead 400201a3 t9 = t9;
+MEM_U32(sp + 68) = a3;
+a1 = s0;
+v0 = func_41b7e8(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(v0 + 0);
+//nop;
+a1 = MEM_U32(sp + 68);
+// fdead 600200cf t9 = t9;
+a0 = sp + 0x28;
+a3 = zero;
+MEM_U32(sp + 8) = a2;
+func_41b948(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+t0 = sp + 0x28;
+at = MEM_U32(t0 + 0);
+t3 = MEM_U32(s0 + 40);
+MEM_U32(s0 + 16) = zero;
+t4 = t3 + 0x1;
+MEM_U32(s0 + 40) = t4;
+MEM_U32(s0 + 12) = at;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_next_tq(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 24);
+// bdead 11 ra = MEM_U32(sp + 28);
+goto L41c4e4;
+L41c4a4:
+t6 = MEM_U8(s0 + 12);
+at = 0x14;
+t7 = t6 & 0x3f;
+MEM_U32(s0 + 40) = t5;
+if (t7 != at) goto L41c4e0;
+v0 = MEM_U32(s0 + 24);
+//nop;
+a0 = a3;
+// bdead 40020029 t9 = t9;
+a1 = s0;
+MEM_U32(s0 + 40) = v0;
+MEM_U32(s0 + 8) = v0;
+temp64 = func_41be28(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 24);
+//nop;
+L41c4e0:
+// bdead 11 ra = MEM_U32(sp + 28);
+L41c4e4:
+// bdead 11 s0 = MEM_U32(sp + 20);
+// bdead 11 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_type_deref(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+uint64_t temp64;
+L41c4f0:
+//type_deref:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+t6 = MEM_U32(a1 + 4);
+//nop;
+//nop;
+if (t6 != 0) goto L41c56c;
+v0 = MEM_U32(a1 + 8);
+//nop;
+t7 = -v0;
+if ((int)v0 < 0) goto L41c534;
+v1 = v0;
+MEM_U32(a1 + 40) = v0;
+goto L41c53c;
+L41c534:
+MEM_U32(a1 + 40) = t7;
+v1 = v0;
+L41c53c:
+//nop;
+MEM_U32(a1 + 16) = zero;
+MEM_U32(a1 + 68) = zero;
+MEM_U32(a1 + 24) = zero;
+MEM_U32(a1 + 20) = zero;
+MEM_U32(a1 + 4) = v1;
+// fdead 4001807b t9 = t9;
+MEM_U32(sp + 36) = a1;
+temp64 = func_41be28(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000011 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+//nop;
+L41c56c:
+v0 = MEM_U32(a1 + 40);
+at = 0xffffffff;
+MEM_U32(a1 + 44) = v0;
+if (v0 == at) goto L41c594;
+//nop;
+a0 = a1;
+//nop;
+temp64 = f_next_tq(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 24);
+//nop;
+L41c594:
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+//nop;
+}
+
+static void f_panic(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L41c5a8:
+//panic:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+// fdead 4000002b MEM_U32(sp + 44) = a1;
+a1 = 0x10002600;
+a0 = 0xfb528e4;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+// fdead 4000006b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L41c638:
+//_md_st_internal:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+// fdead 1eb MEM_U32(sp + 48) = a2;
+a2 = 0x10000240;
+// fdead 1eb MEM_U32(sp + 40) = a0;
+// fdead 1eb MEM_U32(sp + 44) = a1;
+a1 = 0x10002610;
+a0 = 0xfb528e4;
+//nop;
+// fdead 1eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 1eb MEM_U32(sp + 32) = gp;
+// fdead 1eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b t6 = MEM_U32(sp + 52);
+// fdead b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 2b a1 = MEM_U32(sp + 40);
+// fdead 2b a2 = MEM_U32(sp + 44);
+// fdead 2b a3 = MEM_U32(sp + 48);
+// fdead 2b MEM_U32(sp + 16) = t6;
+// fdead 2b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002620;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 36);
+// fdead 3 gp = MEM_U32(sp + 32);
+// fdead 3 sp = sp + 0x28;
+return;
+}
+
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L41c6f8:
+//_md_st_error:
+//nop;
+//nop;
+//nop;
+// fdead 2b sp = sp + 0xffffffd8;
+// fdead 2b MEM_U32(sp + 48) = a2;
+a2 = 0x10000240;
+// fdead ab MEM_U32(sp + 40) = a0;
+// fdead ab MEM_U32(sp + 44) = a1;
+a1 = 0x10002624;
+a0 = 0xfb528e4;
+//nop;
+// fdead eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead eb MEM_U32(sp + 32) = gp;
+// fdead eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b t6 = MEM_U32(sp + 52);
+// fdead b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 2b a1 = MEM_U32(sp + 40);
+// fdead 2b a2 = MEM_U32(sp + 44);
+// fdead 2b a3 = MEM_U32(sp + 48);
+// fdead 2b MEM_U32(sp + 16) = t6;
+// fdead 2b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002630;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 36);
+// fdead 3 gp = MEM_U32(sp + 32);
+// fdead 3 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L41c7b8:
+//_md_st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L41c7fc;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L41c7fc;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L41c7fc:
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L41c904:
+//_md_st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x10007ff4;
+// fdead eb sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead eb MEM_U32(sp + 28) = ra;
+// fdead eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L41c930;
+v0 = 0xffffffff;
+goto L41c948;
+L41c930:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+L41c948:
+// fdead eb ra = MEM_U32(sp + 28);
+// fdead eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, hi = 0;
+L41c958:
+//_md_st_malloc:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+// fdead 1eb MEM_U32(sp + 36) = ra;
+// fdead 1eb MEM_U32(sp + 32) = gp;
+// fdead 1eb MEM_U32(sp + 28) = s1;
+// fdead 1eb MEM_U32(sp + 24) = s0;
+// fdead 1eb MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L41c99c;
+at = 0xffffffff;
+if (a0 == 0) goto L41c99c;
+t0 = v0 << 1;
+if (a0 != at) goto L41ca48;
+L41c99c:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41c9e4;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41c9dc;
+a0 = 0x10002634;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41c9dc:
+v0 = s1;
+goto L41caa4;
+L41c9e4:
+t6 = MEM_U32(s0 + 0);
+// fdead 683ef t7 = MEM_U32(sp + 48);
+//nop;
+// fdead 683ef lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+// fdead 683ef a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41caa0;
+t8 = MEM_U32(s0 + 0);
+// fdead 206000f t9 = MEM_U32(sp + 48);
+//nop;
+// fdead 206000f lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+// fdead 206000f a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L41caa4;
+a0 = 0x10002674;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L41caa4;
+L41ca48:
+MEM_U32(s0 + 0) = t0;
+// fdead 603ef t2 = MEM_U32(sp + 48);
+//nop;
+// fdead 603ef lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+// fdead 603ef a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41caa0;
+t3 = MEM_U32(s0 + 0);
+// fdead 6100f t4 = MEM_U32(sp + 48);
+a0 = 0x100026b8;
+// fdead 6102f lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+// fdead 6102f a1 = lo;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41caa0:
+v0 = s1;
+L41caa4:
+// fdead 206000f ra = MEM_U32(sp + 36);
+// fdead 206000f s0 = MEM_U32(sp + 24);
+// fdead 206000f s1 = MEM_U32(sp + 28);
+// fdead 206000f sp = sp + 0x28;
+return v0;
+}
+
+static void f_error(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41cb68:
+//error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+// fdead 4000002b MEM_U32(sp + 44) = a1;
+a1 = 0x10002700;
+a0 = 0xfb528e4;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+// fdead 4000006b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 11 ra = MEM_U32(sp + 36);
+// bdead 11 gp = MEM_U32(sp + 32);
+// bdead 11 sp = sp + 0x28;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41ce9c:
+//st_pext_iext:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffe0;
+// fdead 1eb MEM_U32(sp + 28) = ra;
+// fdead 1eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L41cee0;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 28);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L41cf0c;
+L41cee0:
+a0 = 0x10002774;
+//nop;
+// fdead 81ff MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 a1 = MEM_U32(sp + 32);
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41cf0c:
+t7 = MEM_U32(v1 + 24);
+// fdead 181ff ra = MEM_U32(sp + 28);
+t8 = a1 << 4;
+// fdead 20181ff sp = sp + 0x20;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41cf24:
+//st_idn_index_fext:
+//nop;
+//nop;
+//nop;
+v1 = 0x10007ff0;
+// fdead 7b sp = sp + 0xffffffc8;
+v1 = MEM_U32(v1 + 0);
+// fdead 7b MEM_U32(sp + 28) = ra;
+// fdead 7b MEM_U32(sp + 24) = gp;
+// fdead 7b MEM_U32(sp + 56) = a0;
+// fdead 7b MEM_U32(sp + 60) = a1;
+if (v1 != 0) goto L41cf7c;
+a0 = 0x1000279c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41cf7c:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L41cfc8;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 827f MEM_U32(sp + 44) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 44);
+t7 = 0x10007ff0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+L41cfc8:
+// fdead 1827f t9 = MEM_U32(sp + 56);
+if (t0 != 0) goto L41cff8;
+t8 = 0x10007ff0;
+//nop;
+t8 = MEM_U32(t8 + 0);
+a1 = 0x10;
+a0 = MEM_U32(t8 + 56);
+//nop;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 7 t9 = MEM_U32(sp + 56);
+L41cff8:
+// fdead 1827f t1 = MEM_U32(sp + 60);
+t2 = 0x7fff0000;
+// fdead 18a7f MEM_U32(sp + 52) = t9;
+if (t1 == 0) goto L41d01c;
+v1 = 0x10007ff0;
+t2 = t2 | 0xffff;
+v1 = MEM_U32(v1 + 0);
+// fdead 18a7f MEM_U32(sp + 48) = t2;
+goto L41d044;
+L41d01c:
+//nop;
+//nop;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f MEM_U32(sp + 48) = v0;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41d044:
+t4 = MEM_U32(v1 + 60);
+t3 = MEM_U32(v1 + 56);
+// fdead 1ba7f t7 = sp + 0x30;
+at = MEM_U32(t7 + 0);
+t5 = t4 << 3;
+t6 = t3 + t5;
+MEM_U32(t6 + 0) = at;
+t1 = MEM_U32(t7 + 4);
+v1 = 0x10007ff0;
+MEM_U32(t6 + 4) = t1;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t2 = v0 + 0x1;
+MEM_U32(v1 + 60) = t2;
+// fdead 1fe7f ra = MEM_U32(sp + 28);
+// fdead 1fe7f sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41d12c:
+//st_symadd:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+t6 = 0x10007ff0;
+// fdead 81eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 81eb MEM_U32(sp + 24) = gp;
+// fdead 81eb MEM_U32(sp + 40) = a0;
+// fdead 81eb MEM_U32(sp + 44) = a1;
+// fdead 81eb MEM_U32(sp + 48) = a2;
+// fdead 81eb MEM_U32(sp + 52) = a3;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41d188;
+a0 = 0x100000c0;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41d188:
+t0 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L41d1cc;
+a0 = 0x100000fc;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+L41d1cc:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x2;
+//nop;
+if (t9 == 0) goto L41d20c;
+a0 = 0x10000130;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+L41d20c:
+t1 = MEM_U32(v1 + 0);
+t2 = MEM_U32(v1 + 8);
+a1 = MEM_U32(t1 + 20);
+a2 = 0xc;
+a3 = 0x40;
+if ((int)a1 < (int)t2) goto L41d26c;
+//nop;
+a0 = MEM_U32(v1 + 4);
+a1 = v1 + 0x8;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x10007ff4;
+//nop;
+t3 = MEM_U32(t0 + 0);
+//nop;
+MEM_U32(t3 + 4) = v0;
+v1 = MEM_U32(t0 + 0);
+//nop;
+t4 = MEM_U32(v1 + 0);
+//nop;
+a1 = MEM_U32(t4 + 20);
+//nop;
+L41d26c:
+t6 = a1 << 2;
+t5 = MEM_U32(v1 + 4);
+t6 = t6 - a1;
+// fdead 601ffff t7 = MEM_U32(sp + 40);
+t6 = t6 << 2;
+v0 = t5 + t6;
+MEM_U32(v0 + 0) = t7;
+// fdead 601ffff t8 = MEM_U32(sp + 44);
+t4 = MEM_U8(v0 + 8);
+MEM_U32(v0 + 4) = t8;
+// fdead 601ffff t1 = MEM_U32(sp + 48);
+t5 = t4 & 0xff03;
+t3 = t1 << 2;
+t6 = t3 | t5;
+MEM_U8(v0 + 8) = (uint8_t)t6;
+// fdead 601ffff t8 = MEM_U32(sp + 52);
+t2 = MEM_U16(v0 + 8);
+t9 = t8 << 5;
+t1 = t9 & 0x3e0;
+t4 = t2 & 0xfc1f;
+t3 = t1 | t4;
+MEM_U16(v0 + 8) = (uint16_t)t3;
+t5 = MEM_U8(v0 + 9);
+at = 0xf0000;
+t6 = t5 & 0xffef;
+MEM_U8(v0 + 9) = (uint8_t)t6;
+// fdead 601ffff t7 = MEM_U32(sp + 56);
+a2 = MEM_U32(v0 + 8);
+at = at | 0xffff;
+t8 = t7 & at;
+t9 = t8 ^ a2;
+t2 = t9 << 12;
+t1 = t2 >> 12;
+t4 = t1 ^ a2;
+MEM_U32(v0 + 8) = t4;
+//nop;
+// fdead 601ffff a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_st_str_iss(mem, sp, a0, a1, a2, a3);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f MEM_U32(sp + 32) = v0;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t5 = MEM_U32(sp + 48);
+t0 = 0x10007ff4;
+// fdead 20f t6 = MEM_U32(sp + 52);
+t3 = MEM_U32(t0 + 0);
+// fdead 120f t7 = t5 + t6;
+v1 = MEM_U32(t3 + 0);
+a2 = v0;
+t9 = MEM_U32(v1 + 60);
+t4 = MEM_U16(v1 + 62);
+// fdead 400329f t2 = t9 + t7;
+// fdead 400329f t1 = t2 & 0x1fff;
+t3 = t4 & 0xe000;
+// fdead 400329f t5 = t1 | t3;
+a0 = zero;
+// fdead 40032bf MEM_U16(v1 + 62) = (uint16_t)t5;
+if ((int)v0 <= 0) goto L41d3ac;
+// fdead 40032bf a1 = MEM_U32(sp + 32);
+//nop;
+L41d36c:
+t6 = MEM_U32(t0 + 0);
+// fdead 601febf t9 = MEM_S8(a1 + 0);
+v1 = MEM_U32(t6 + 0);
+a0 = a0 + 0x1;
+t8 = MEM_U32(v1 + 60);
+t5 = MEM_U16(v1 + 62);
+t7 = t8 << 5;
+t2 = t9 + t7;
+t1 = t2 + t8;
+t3 = t1 & 0x1fff;
+t6 = t5 & 0xe000;
+at = (int)a0 < (int)a2;
+t8 = t3 | t6;
+// fdead 601febf a1 = a1 + 0x1;
+MEM_U16(v1 + 62) = (uint16_t)t8;
+if (at != 0) goto L41d36c;
+L41d3ac:
+// fdead 601febf t9 = MEM_U32(sp + 48);
+at = 0xe;
+if (t9 == at) {
+at = 0x2;
+goto L41d3d4;}
+at = 0x2;
+if (t9 == at) {
+at = 0x5;
+goto L41d3d4;}
+at = 0x5;
+if (t9 == at) {
+at = 0x6;
+goto L41d3d4;}
+at = 0x6;
+//nop;
+if (t9 != at) goto L41d3f4;
+L41d3d4:
+t7 = MEM_U32(t0 + 0);
+//nop;
+v1 = MEM_U32(t7 + 0);
+//nop;
+t2 = MEM_U8(v1 + 60);
+//nop;
+t4 = t2 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t4;
+L41d3f4:
+t1 = MEM_U32(t0 + 0);
+//nop;
+v1 = MEM_U32(t1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 20);
+//nop;
+t5 = v0 + 0x1;
+MEM_U32(v1 + 20) = t5;
+// fdead 601febf ra = MEM_U32(sp + 28);
+// fdead 601febf sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41d424:
+//st_ifd_pcfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 80eb sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 80eb MEM_U32(sp + 28) = ra;
+// fdead 80eb MEM_U32(sp + 24) = gp;
+// fdead 80eb MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41d474;
+a0 = 0x100000c0;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41d474:
+t8 = 0x10007ff4;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L41d4a8;
+a0 = 0x100000fc;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41d4a8:
+t0 = 0x10007ff0;
+// fdead 20182eb t9 = MEM_U32(sp + 32);
+t0 = MEM_U32(t0 + 0);
+// fdead 20182eb ra = MEM_U32(sp + 28);
+t1 = MEM_U32(t0 + 4);
+// fdead 20186eb sp = sp + 0x20;
+// fdead 20186eb v0 = t9 - t1;
+t2 = (int)v0 >> 6;
+v0 = t2;
+return v0;
+}
+
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L41d4d0:
+//st_pcfd_ifd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 806b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 806b MEM_U32(sp + 28) = ra;
+// fdead 806b MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a1 = a0;
+//nop;
+if (t7 != 0) goto L41d520;
+a0 = 0x100000c0;
+//nop;
+// fdead 1806b MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+// fdead 3 a1 = MEM_U32(sp + 32);
+//nop;
+L41d520:
+//nop;
+if ((int)a1 < 0) goto L41d54c;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t8 = MEM_U32(v1 + 12);
+//nop;
+//nop;
+if ((int)a1 < (int)t8) goto L41d578;
+L41d54c:
+a0 = 0x10002820;
+//nop;
+// fdead 201807f MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 a1 = MEM_U32(sp + 32);
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41d578:
+t9 = MEM_U32(v1 + 4);
+// fdead 601807f ra = MEM_U32(sp + 28);
+t0 = a1 << 6;
+// fdead 601827f sp = sp + 0x20;
+v0 = t9 + t0;
+return v0;
+}
+
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41d590:
+//st_psym_ifd_isym:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 80eb sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 80eb MEM_U32(sp + 28) = ra;
+// fdead 80eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L41d5e8;
+a0 = 0x100000c0;
+//nop;
+// fdead 181eb MEM_U32(sp + 44) = a1;
+// fdead 181eb MEM_U32(sp + 40) = a3;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+// fdead 3 a2 = MEM_U32(sp + 44);
+// fdead 3 a3 = MEM_U32(sp + 40);
+//nop;
+L41d5e8:
+at = 0x7fff0000;
+at = at | 0xffff;
+//nop;
+if (a3 != at) goto L41d614;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// fdead 1f gp = MEM_U32(sp + 24);
+v0 = v0 + 0x4;
+goto L41d6c4;
+L41d614:
+a1 = a3;
+if ((int)a3 < 0) goto L41d670;
+//nop;
+if ((int)a2 < 0) goto L41d670;
+v0 = 0x10007ff0;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L41d670;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 20);
+//nop;
+t8 = a2 << 2;
+if ((int)a2 < (int)t2) goto L41d6b4;
+L41d670:
+a0 = 0x10002844;
+//nop;
+t3 = a3 << 6;
+// fdead 6019fff MEM_U32(sp + 36) = t3;
+// fdead 6019fff MEM_U32(sp + 44) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 t6 = MEM_U32(sp + 36);
+t4 = 0x10007ff0;
+// fdead 2007 a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+// fdead 6007 v1 = t5 + t6;
+// fdead 6007 t8 = a2 << 2;
+L41d6b4:
+t7 = MEM_U32(v1 + 4);
+t8 = t8 - a2;
+t8 = t8 << 2;
+v0 = t7 + t8;
+L41d6c4:
+// fdead 601efff ra = MEM_U32(sp + 28);
+// fdead 601efff sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41d6d4:
+//st_paux_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 800b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 800b MEM_U32(sp + 28) = ra;
+// fdead 800b MEM_U32(sp + 24) = gp;
+// fdead 800b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41d724;
+a0 = 0x100000c0;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41d724:
+t8 = 0x10007ff4;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// fdead 201800b t9 = MEM_U32(sp + 32);
+if (t8 != 0) goto L41d75c;
+a0 = 0x100000fc;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 3 t9 = MEM_U32(sp + 32);
+L41d75c:
+//nop;
+//nop;
+if ((int)t9 < 0) goto L41d794;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t0 = MEM_U32(v1 + 0);
+//nop;
+t1 = MEM_U32(t0 + 48);
+//nop;
+// fdead 201861b at = (int)t9 < (int)t1;
+// fdead 201861b t3 = MEM_U32(sp + 32);
+if (at != 0) goto L41d7c4;
+L41d794:
+a0 = 0x1000287c;
+//nop;
+// fdead 201863b a1 = MEM_U32(sp + 32);
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+// fdead 13 t3 = MEM_U32(sp + 32);
+L41d7c4:
+t2 = MEM_U32(v1 + 12);
+// fdead 2018e1b ra = MEM_U32(sp + 28);
+// fdead 2018e1b t4 = t3 << 2;
+// fdead 2018e1b sp = sp + 0x20;
+// fdead 2018e1b v0 = t2 + t4;
+return v0;
+}
+
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L41d7dc:
+//st_str_ifd_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 804b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 804b MEM_U32(sp + 28) = ra;
+// fdead 804b MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+// fdead 1804b a2 = a0;
+at = 0x7fff0000;
+if (t7 != 0) goto L41d838;
+a0 = 0x100000c0;
+//nop;
+// fdead 1806f MEM_U32(sp + 36) = a1;
+// fdead 1806f MEM_U32(sp + 32) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 a1 = MEM_U32(sp + 36);
+// fdead 7 a2 = MEM_U32(sp + 32);
+//nop;
+at = 0x7fff0000;
+L41d838:
+at = at | 0xffff;
+//nop;
+if (a2 != at) goto L41d860;
+//nop;
+a0 = a1;
+//nop;
+v0 = f__md_st_str_extiss(mem, sp, a0);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f ra = MEM_U32(sp + 28);
+goto L41d8a4;
+L41d860:
+//nop;
+// fdead 1804f a0 = a2;
+// fdead 1804f MEM_U32(sp + 36) = a1;
+v0 = f_st_pcfd_ifd(mem, sp, a0);
+t8 = MEM_U32(v0 + 0);
+// fdead 200001f a1 = MEM_U32(sp + 36);
+v1 = MEM_U32(t8 + 12);
+// fdead 200001f gp = MEM_U32(sp + 24);
+// fdead 200001f at = (int)a1 < (int)v1;
+if (v1 == 0) goto L41d89c;
+//nop;
+if (at == 0) goto L41d89c;
+t9 = MEM_U32(v0 + 20);
+// fdead 600001f v0 = t9 + a1;
+goto L41d8a0;
+L41d89c:
+v0 = zero;
+L41d8a0:
+// fdead 600001f ra = MEM_U32(sp + 28);
+L41d8a4:
+// fdead 600001f sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L41d98c:
+//st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x10007ff4;
+// fdead eb sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead eb MEM_U32(sp + 28) = ra;
+// fdead eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L41d9b8;
+v0 = 0xffffffff;
+goto L41d9d0;
+L41d9b8:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+L41d9d0:
+// fdead eb ra = MEM_U32(sp + 28);
+// fdead eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t6 = 0;
+L41d9e0:
+//st_ifdmax:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+v0 = MEM_U32(t6 + 12);
+//nop;
+return v0;
+}
+
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41da08:
+//st_setfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 806b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 806b MEM_U32(sp + 28) = ra;
+// fdead 806b MEM_U32(sp + 24) = gp;
+// fdead 806b MEM_U32(sp + 32) = a0;
+v0 = MEM_U32(t6 + 4);
+//nop;
+// fdead 806b t8 = MEM_U32(sp + 32);
+if (v0 != 0) goto L41da74;
+a0 = 0x10000170;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x10007ff0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+v0 = MEM_U32(t7 + 4);
+//nop;
+// fdead 1000b t8 = MEM_U32(sp + 32);
+L41da74:
+at = 0x10007ff4;
+// fdead 1806f ra = MEM_U32(sp + 28);
+// fdead 1806f t9 = t8 << 6;
+// fdead 1806f t0 = v0 + t9;
+// fdead 1806f sp = sp + 0x20;
+// fdead 1806f MEM_U32(at + 0) = t0;
+return;
+}
+
+static void f_st_fdadd(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L41da90:
+//st_fdadd:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffff10;
+t2 = 0x10007ff0;
+// fdead 80b MEM_U32(sp + 28) = ra;
+t0 = MEM_U32(t2 + 0);
+// fdead a0b MEM_U32(sp + 24) = gp;
+// fdead a0b MEM_U32(sp + 240) = a0;
+// fdead a0b MEM_U32(sp + 244) = a1;
+// fdead a0b MEM_U32(sp + 248) = a2;
+// fdead a0b MEM_U32(sp + 252) = a3;
+t6 = MEM_U32(t0 + 12);
+at = 0x7fff0000;
+at = at | 0xffff;
+// fdead 8a0f MEM_U32(sp + 40) = t6;
+if ((int)t6 < (int)at) goto L41db18;
+a0 = 0x100028b0;
+//nop;
+a2 = 0x7fff0000;
+a2 = a2 | 0xffff;
+a1 = t6;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x10007ff0;
+//nop;
+t0 = MEM_U32(t2 + 0);
+//nop;
+t8 = MEM_U32(t0 + 12);
+//nop;
+// fdead 2000a07 MEM_U32(sp + 40) = t8;
+L41db18:
+v0 = MEM_U32(t0 + 16);
+// fdead 2008a0f t9 = MEM_U32(sp + 40);
+a1 = t0 + 0x10;
+// fdead 2008a4f at = (int)t9 < (int)v0;
+a2 = 0x40;
+if (at != 0) goto L41dc18;
+//nop;
+// fdead 2008acf MEM_U32(sp + 236) = v0;
+a0 = MEM_U32(t0 + 4);
+// fdead 2008aef MEM_U32(sp + 232) = v0;
+a3 = 0x19;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = sp + 0xec;
+t2 = 0x10007ff0;
+a2 = 0x48;
+t3 = MEM_U32(t2 + 0);
+a3 = 0x19;
+MEM_U32(t3 + 4) = v0;
+t4 = MEM_U32(t2 + 0);
+//nop;
+a0 = MEM_U32(t4 + 8);
+//nop;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t1 = MEM_U32(sp + 232);
+t2 = 0x10007ff0;
+//nop;
+t5 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t5 + 8) = v0;
+t6 = MEM_U32(t2 + 0);
+// fdead c80f t7 = MEM_U32(sp + 236);
+a2 = MEM_U32(t6 + 16);
+// fdead c88f a3 = MEM_U32(sp + 240);
+// fdead c88f a1 = t7;
+if (t7 == a2) goto L41dbd0;
+a0 = 0x100028e4;
+//nop;
+// fdead c8af MEM_U32(sp + 232) = t1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 t1 = MEM_U32(sp + 232);
+t2 = 0x10007ff0;
+//nop;
+L41dbd0:
+// fdead c88f a0 = t1;
+if (t1 == 0) {
+// fdead c88f t1 = t1 + 0xffffffff;
+goto L41dc18;}
+// fdead c88f t1 = t1 + 0xffffffff;
+// fdead c88f v1 = t1 << 3;
+// fdead c88f v1 = v1 + t1;
+// fdead c88f v1 = v1 << 3;
+// fdead c88f v0 = t1 << 6;
+L41dbec:
+t0 = MEM_U32(t2 + 0);
+// fdead 200fa8f a0 = t1;
+t8 = MEM_U32(t0 + 8);
+t3 = MEM_U32(t0 + 4);
+// fdead 200fa8f t9 = t8 + v1;
+t4 = t3 + v0;
+// fdead 200fa8f MEM_U32(t4 + 0) = t9;
+v0 = v0 + 0xffffffc0;
+// fdead 200fa8f v1 = v1 + 0xffffffb8;
+if (t1 != 0) {
+// fdead 200fa8f t1 = t1 + 0xffffffff;
+goto L41dbec;}
+// fdead 200fa8f t1 = t1 + 0xffffffff;
+L41dc18:
+t0 = MEM_U32(t2 + 0);
+t9 = 0x10004cc8;
+t6 = MEM_U32(t0 + 12);
+t5 = MEM_U32(t0 + 4);
+a1 = 0x10007ff4;
+t7 = t6 << 6;
+t9 = t9;
+t3 = t5 + t7;
+t6 = t9 + 0x3c;
+MEM_U32(a1 + 0) = t3;
+L41dc40:
+at = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+MEM_U32(t3 + 0) = at;
+at = MEM_U32(t9 + -8);
+t3 = t3 + 0xc;
+MEM_U32(t3 + -8) = at;
+at = MEM_U32(t9 + -4);
+MEM_U32(t3 + -4) = at;
+if (t9 != t6) goto L41dc40;
+at = MEM_U32(t9 + 0);
+//nop;
+MEM_U32(t3 + 0) = at;
+t0 = MEM_U32(t2 + 0);
+t6 = MEM_U32(a1 + 0);
+t5 = MEM_U32(t0 + 12);
+t8 = MEM_U32(t0 + 8);
+t7 = t5 << 3;
+t7 = t7 + t5;
+t7 = t7 << 3;
+t4 = t7 + t8;
+MEM_U32(t6 + 0) = t4;
+t0 = MEM_U32(t2 + 0);
+t8 = 0x10004c80;
+t9 = MEM_U32(t0 + 12);
+t8 = t8;
+t3 = t9 + 0x1;
+MEM_U32(t0 + 12) = t3;
+t5 = MEM_U32(a1 + 0);
+t6 = t8 + 0x48;
+t7 = MEM_U32(t5 + 0);
+//nop;
+L41dcbc:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t7 + 0) = at;
+at = MEM_U32(t8 + -8);
+t7 = t7 + 0xc;
+MEM_U32(t7 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t7 + -4) = at;
+if (t8 != t6) goto L41dcbc;
+t9 = MEM_U32(a1 + 0);
+// fdead 601facf t5 = MEM_U32(sp + 244);
+v1 = MEM_U32(t9 + 0);
+t6 = t5 << 3;
+t8 = MEM_U8(v1 + 60);
+//nop;
+t7 = t8 & 0xff07;
+t9 = t6 | t7;
+MEM_U8(v1 + 60) = (uint8_t)t9;
+t3 = MEM_U32(a1 + 0);
+// fdead 601fadf t4 = MEM_U32(sp + 248);
+v1 = MEM_U32(t3 + 0);
+t8 = t4 << 2;
+t7 = MEM_U8(v1 + 60);
+t6 = t8 & 0x4;
+t9 = t7 & 0xfffb;
+t3 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t3;
+t5 = MEM_U32(a1 + 0);
+// fdead 601fadf t8 = MEM_U32(sp + 252);
+v1 = MEM_U32(t5 + 0);
+t6 = t8 << 6;
+t9 = MEM_U8(v1 + 61);
+//nop;
+t3 = t9 & 0xff3f;
+t5 = t6 | t3;
+MEM_U8(v1 + 61) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// fdead f gp = MEM_U32(sp + 24);
+t7 = v0 < 0x1;
+a1 = 0x10007ff4;
+t9 = t7 & 0x1;
+t4 = MEM_U32(a1 + 0);
+a0 = 0x1000291c;
+v1 = MEM_U32(t4 + 0);
+a0 = a0;
+t6 = MEM_U8(v1 + 60);
+//nop;
+t3 = t6 & 0xfffe;
+t5 = t9 | t3;
+MEM_U8(v1 + 60) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = MEM_U32(sp + 240);
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x10007ff4;
+t7 = 0x10000230;
+t4 = MEM_U32(a1 + 0);
+//nop;
+t8 = MEM_U32(t4 + 0);
+//nop;
+MEM_U32(t8 + 4) = v0;
+t7 = MEM_U32(t7 + 0);
+// fdead 201204f t6 = MEM_U32(sp + 252);
+// fdead 201204f ra = MEM_U32(sp + 28);
+if (t7 != 0) goto L41e190;
+// fdead 201204f at = (int)t6 < (int)0x3;
+if (t6 == 0) goto L41ddfc;
+// fdead 201204f ra = MEM_U32(sp + 28);
+if (at != 0) goto L41e190;
+L41ddfc:
+a0 = 0x10002920;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+t3 = 0x1;
+t9 = 0x1000021c;
+a1 = 0x40;
+t9 = MEM_S8(t9 + 0);
+//nop;
+// fdead 400104f t4 = MEM_U32(sp + 240);
+if (t9 != 0) goto L41dfb0;
+at = 0x1000021c;
+a0 = 0x10004d08;
+//nop;
+MEM_U8(at + 0) = (uint8_t)t3;
+a0 = a0;
+v0 = wrapper_gethostname(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v0 >= 0) goto L41de78;
+a0 = 0x10004d08;
+a1 = 0x1000292c;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+goto L41de98;
+L41de78:
+a0 = 0x10004d08;
+a1 = 0x10002930;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L41de98:
+//nop;
+// fdead f a0 = MEM_U32(sp + 240);
+a1 = 0x5;
+v0 = wrapper_pathconf(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 >= (int)0x5) goto L41debc;
+v1 = 0x5;
+L41debc:
+t5 = v1 << 2;
+v0 = t5 << 2;
+//nop;
+v0 = v0 - t5;
+v0 = v0 + 0xa;
+a0 = v0;
+// fdead 403f MEM_U32(sp + 44) = v0;
+// fdead 403f MEM_U32(sp + 228) = t5;
+v0 = wrapper_malloc(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f v1 = MEM_U32(sp + 228);
+at = 0x10004d50;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L41df18;
+a0 = 0x10002934;
+//nop;
+// fdead 2f a1 = MEM_U32(sp + 44);
+// fdead 2f MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 v1 = MEM_U32(sp + 228);
+//nop;
+L41df18:
+//nop;
+// fdead f a1 = MEM_U32(sp + 44);
+a0 = zero;
+// fdead 2f MEM_U32(sp + 228) = v1;
+v0 = wrapper_getcwd(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f v1 = MEM_U32(sp + 228);
+at = 0x10004d54;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L41df64;
+a0 = 0x10002960;
+//nop;
+// fdead 2f a1 = MEM_U32(sp + 44);
+// fdead 2f MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 v1 = MEM_U32(sp + 228);
+//nop;
+L41df64:
+//nop;
+// fdead f a1 = v1 << 2;
+// fdead f a1 = a1 + 0xa;
+// fdead f a0 = a1;
+// fdead f MEM_U32(sp + 44) = a1;
+v0 = wrapper_malloc(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = MEM_U32(sp + 44);
+at = 0x10004d4c;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L41dfac;
+a0 = 0x1000298c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+L41dfac:
+// fdead f t4 = MEM_U32(sp + 240);
+L41dfb0:
+at = 0x2f;
+// fdead 400104f t8 = MEM_S8(t4 + 0);
+// fdead 400104f a1 = MEM_U32(sp + 240);
+//nop;
+if (t8 == at) goto L41e028;
+a0 = 0x10004d50;
+a1 = 0x10004d54;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004d50;
+a1 = 0x100029c8;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = MEM_U32(sp + 240);
+a0 = 0x10004d50;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+goto L41e044;
+L41e028:
+a0 = 0x10004d50;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L41e044:
+a0 = 0x10004d4c;
+a1 = 0x10004d08;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004d4c;
+a1 = 0x10004d50;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004d4c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+t6 = 0x1;
+t7 = 0x10000220;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L41e100;
+at = 0x10000220;
+//nop;
+a0 = zero;
+MEM_U32(at + 0) = t6;
+v0 = wrapper_time(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+a2 = v0;
+at = 0x10004d78;
+a0 = 0x10004d58;
+a1 = 0x100029cc;
+//nop;
+MEM_U32(at + 0) = v0;
+a0 = a0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L41e100:
+a0 = 0x10004d58;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = MEM_U32(sp + 240);
+//nop;
+// fdead f a1 = sp + 0x38;
+//nop;
+v0 = wrapper_stat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = sp + 0xc0;
+if ((int)v0 >= 0) goto L41e158;
+a0 = 0x100029d0;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f ra = MEM_U32(sp + 28);
+goto L41e190;
+L41e158:
+a1 = 0x100029d4;
+//nop;
+// fdead 4f a2 = MEM_U32(sp + 104);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = sp + 0xc0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+// fdead f ra = MEM_U32(sp + 28);
+L41e190:
+// fdead 201204f sp = sp + 0xf0;
+//nop;
+return;
+}
+
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41e19c:
+//st_auxadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 802b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 802b MEM_U32(sp + 28) = ra;
+// fdead 802b MEM_U32(sp + 24) = gp;
+// fdead 802b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41e1ec;
+a0 = 0x10000170;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41e1ec:
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L41e230;
+a0 = 0x100001ac;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41e230:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x400;
+//nop;
+if (t9 == 0) goto L41e270;
+a0 = 0x100001e0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41e270:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 16);
+a0 = MEM_U32(t0 + 48);
+a1 = v1 + 0x10;
+a2 = 0x4;
+if ((int)a0 < (int)t1) goto L41e2d0;
+//nop;
+a0 = MEM_U32(v1 + 12);
+a3 = 0x40;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x10007ff4;
+v1 = 0x10007ff4;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 12) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U32(t3 + 48);
+//nop;
+L41e2d0:
+t4 = MEM_U32(v1 + 12);
+// fdead 601beff t7 = sp + 0x20;
+at = MEM_U32(t7 + 0);
+t5 = a0 << 2;
+t0 = 0x10007ff4;
+t6 = t4 + t5;
+MEM_U32(t6 + 0) = at;
+t0 = MEM_U32(t0 + 0);
+//nop;
+a1 = MEM_U32(t0 + 0);
+//nop;
+v0 = MEM_U32(a1 + 48);
+//nop;
+t1 = v0 + 0x1;
+MEM_U32(a1 + 48) = t1;
+// fdead 601feff ra = MEM_U32(sp + 28);
+// fdead 601feff sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L41e31c:
+//st_pdadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 802b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 802b MEM_U32(sp + 28) = ra;
+// fdead 802b MEM_U32(sp + 24) = gp;
+// fdead 802b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41e36c;
+a0 = 0x10000170;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41e36c:
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L41e3b0;
+a0 = 0x100001ac;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41e3b0:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x100;
+//nop;
+if (t9 == 0) goto L41e3f0;
+a0 = 0x100001e0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41e3f0:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 56);
+a0 = MEM_U16(t0 + 42);
+a1 = v1 + 0x38;
+a2 = 0x34;
+if (a0 < t1) goto L41e450;
+//nop;
+a0 = MEM_U32(v1 + 52);
+a3 = 0x20;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x10007ff4;
+v1 = 0x10007ff4;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 52) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U16(t3 + 42);
+//nop;
+L41e450:
+a3 = 0x34;
+lo = a0 * a3;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a3 >> 32);
+t7 = 0x10004d80;
+t4 = MEM_U32(v1 + 52);
+t7 = t7;
+t9 = t7 + 0x30;
+t5 = lo;
+t6 = t4 + t5;
+//nop;
+L41e474:
+at = MEM_U32(t7 + 0);
+t7 = t7 + 0xc;
+MEM_U32(t6 + 0) = at;
+at = MEM_U32(t7 + -8);
+t6 = t6 + 0xc;
+MEM_U32(t6 + -8) = at;
+at = MEM_U32(t7 + -4);
+MEM_U32(t6 + -4) = at;
+if (t7 != t9) goto L41e474;
+at = MEM_U32(t7 + 0);
+v1 = 0x10007ff4;
+MEM_U32(t6 + 0) = at;
+v1 = MEM_U32(v1 + 0);
+// fdead 60601ffff t0 = MEM_U32(sp + 32);
+t2 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 52);
+t3 = MEM_U16(t2 + 42);
+t8 = 0x10007ff4;
+lo = t3 * a3;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)a3 >> 32);
+t4 = lo;
+t5 = t1 + t4;
+MEM_U32(t5 + 4) = t0;
+t8 = MEM_U32(t8 + 0);
+//nop;
+a1 = MEM_U32(t8 + 0);
+//nop;
+v0 = MEM_U16(a1 + 42);
+//nop;
+t9 = v0 + 0x1;
+MEM_U16(a1 + 42) = (uint16_t)t9;
+// fdead 60601ffff ra = MEM_U32(sp + 28);
+// fdead 60601ffff sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L41e678:
+//st_stradd:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffd8;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 28) = s2;
+// fdead 6b MEM_U32(sp + 24) = s1;
+// fdead 6b MEM_U32(sp + 20) = s0;
+// fdead 6b MEM_U32(sp + 40) = a0;
+if (a0 != 0) goto L41e6c0;
+a0 = 0x100029d8;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 3 gp = MEM_U32(sp + 32);
+//nop;
+L41e6c0:
+//nop;
+// fdead 6b a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// fdead b gp = MEM_U32(sp + 32);
+s2 = v0 + 0x1;
+t7 = 0x10007ff0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = MEM_U32(t7 + 4);
+//nop;
+//nop;
+if (t8 != 0) goto L41e714;
+a0 = 0x10000170;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 80003 gp = MEM_U32(sp + 32);
+//nop;
+L41e714:
+s1 = 0x10007ff4;
+//nop;
+s0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L41e74c;
+a0 = 0x100001ac;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead e0003 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L41e74c:
+t9 = MEM_U32(s0 + 60);
+//nop;
+t0 = t9 & 0x80;
+//nop;
+if (t0 == 0) goto L41e780;
+a0 = 0x100001e0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead e0003 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L41e780:
+t1 = MEM_U32(s0 + 0);
+t2 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t1 + 12);
+//nop;
+t3 = v1 + s2;
+//nop;
+if ((int)t2 >= (int)t3) goto L41e7ec;
+L41e7a0:
+//nop;
+a0 = MEM_U32(s0 + 20);
+a1 = s0 + 0x18;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(s1 + 0);
+// fdead e200f gp = MEM_U32(sp + 32);
+MEM_U32(t4 + 20) = v0;
+s0 = MEM_U32(s1 + 0);
+//nop;
+t5 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t5 + 12);
+//nop;
+t7 = v1 + s2;
+//nop;
+if ((int)t6 < (int)t7) goto L41e7a0;
+L41e7ec:
+t8 = MEM_U32(s0 + 20);
+//nop;
+// fdead 60ffe1f a1 = MEM_U32(sp + 40);
+a0 = t8 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+t9 = MEM_U32(s1 + 0);
+// fdead 40e000f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(t9 + 0);
+//nop;
+v0 = MEM_U32(a0 + 12);
+//nop;
+t0 = v0 + s2;
+MEM_U32(a0 + 12) = t0;
+// fdead 40e022f ra = MEM_U32(sp + 36);
+// fdead 40e022f s2 = MEM_U32(sp + 28);
+// fdead 40e022f s1 = MEM_U32(sp + 24);
+// fdead 40e022f s0 = MEM_U32(sp + 20);
+// fdead 40e022f sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41e878:
+//st_paux_ifd_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 81eb sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 81eb MEM_U32(sp + 28) = ra;
+// fdead 81eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L41e8d0;
+a0 = 0x10000170;
+//nop;
+// fdead 181eb MEM_U32(sp + 44) = a1;
+// fdead 181eb MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+// fdead 3 a2 = MEM_U32(sp + 44);
+// fdead 3 a3 = MEM_U32(sp + 40);
+//nop;
+L41e8d0:
+a1 = a3;
+if ((int)a3 < 0) goto L41e92c;
+//nop;
+if ((int)a2 < 0) goto L41e92c;
+v0 = 0x10007ff0;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L41e92c;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 48);
+//nop;
+//nop;
+if ((int)a2 < (int)t2) goto L41e96c;
+L41e92c:
+a0 = 0x100029f4;
+//nop;
+t3 = a3 << 6;
+// fdead 6019fff MEM_U32(sp + 36) = t3;
+// fdead 6019fff MEM_U32(sp + 44) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 t6 = MEM_U32(sp + 36);
+t4 = 0x10007ff0;
+// fdead 2007 a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+// fdead 6007 v1 = t5 + t6;
+L41e96c:
+t7 = MEM_U32(v1 + 12);
+// fdead 601efff ra = MEM_U32(sp + 28);
+t8 = a2 << 2;
+// fdead 601efff sp = sp + 0x28;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_str_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41ea90:
+//st_str_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x10007ff0;
+// fdead 81eb sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 81eb MEM_U32(sp + 28) = ra;
+// fdead 81eb MEM_U32(sp + 24) = gp;
+// fdead 81eb MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L41eae0;
+a0 = 0x10000170;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L41eae0:
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L41eb24;
+a0 = 0x100001ac;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41eb24:
+t8 = MEM_U32(v1 + 0);
+// fdead 20181fb ra = MEM_U32(sp + 28);
+v0 = MEM_U32(t8 + 12);
+//nop;
+//nop;
+if (v0 == 0) goto L41eb5c;
+// fdead 20181fb t9 = MEM_U32(sp + 32);
+// fdead 20181fb t1 = MEM_U32(sp + 32);
+// fdead 20181fb at = (int)t9 < (int)v0;
+v0 = zero;
+if (at == 0) goto L41eb60;
+t0 = MEM_U32(v1 + 20);
+// fdead 20183fb v0 = t0 + t1;
+goto L41eb60;
+L41eb5c:
+v0 = zero;
+L41eb60:
+// fdead 20183fb sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, hi = 0;
+L41eb68:
+//st_malloc:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+// fdead 1eb MEM_U32(sp + 36) = ra;
+// fdead 1eb MEM_U32(sp + 32) = gp;
+// fdead 1eb MEM_U32(sp + 28) = s1;
+// fdead 1eb MEM_U32(sp + 24) = s0;
+// fdead 1eb MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L41ebac;
+at = 0xffffffff;
+if (a0 == 0) goto L41ebac;
+t0 = v0 << 1;
+if (a0 != at) goto L41ec58;
+L41ebac:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41ebf4;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41ebec;
+a0 = 0x10002a64;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41ebec:
+v0 = s1;
+goto L41ecb4;
+L41ebf4:
+t6 = MEM_U32(s0 + 0);
+// fdead 683ef t7 = MEM_U32(sp + 48);
+//nop;
+// fdead 683ef lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+// fdead 683ef a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41ecb0;
+t8 = MEM_U32(s0 + 0);
+// fdead 206000f t9 = MEM_U32(sp + 48);
+//nop;
+// fdead 206000f lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+// fdead 206000f a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L41ecb4;
+a0 = 0x10002aa0;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 60007 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L41ecb4;
+L41ec58:
+MEM_U32(s0 + 0) = t0;
+// fdead 603ef t2 = MEM_U32(sp + 48);
+//nop;
+// fdead 603ef lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+// fdead 603ef a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41ecb0;
+t3 = MEM_U32(s0 + 0);
+// fdead 6100f t4 = MEM_U32(sp + 48);
+a0 = 0x10002ae0;
+// fdead 6102f lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+// fdead 6102f a1 = lo;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41ecb0:
+v0 = s1;
+L41ecb4:
+// fdead 206000f ra = MEM_U32(sp + 36);
+// fdead 206000f s0 = MEM_U32(sp + 24);
+// fdead 206000f s1 = MEM_U32(sp + 28);
+// fdead 206000f sp = sp + 0x28;
+return v0;
+//nop;
+}
+
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L41eccc:
+//st_internal:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+// fdead 1eb MEM_U32(sp + 48) = a2;
+a2 = 0x10000240;
+// fdead 1eb MEM_U32(sp + 40) = a0;
+// fdead 1eb MEM_U32(sp + 44) = a1;
+a1 = 0x10002b20;
+a0 = 0xfb528e4;
+//nop;
+// fdead 1eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 1eb MEM_U32(sp + 32) = gp;
+// fdead 1eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b t6 = MEM_U32(sp + 52);
+// fdead b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 2b a1 = MEM_U32(sp + 40);
+// fdead 2b a2 = MEM_U32(sp + 44);
+// fdead 2b a3 = MEM_U32(sp + 48);
+// fdead 2b MEM_U32(sp + 16) = t6;
+// fdead 2b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002b30;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 36);
+// fdead 3 gp = MEM_U32(sp + 32);
+// fdead 3 sp = sp + 0x28;
+return;
+}
+
+static void f_st_feinit(uint8_t *mem, uint32_t sp) {
+L42075c:
+//st_feinit:
+//nop;
+return;
+//nop;
+//nop;
+}
+
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L420c84:
+//st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L420cc8;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L420cc8;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L420cc8:
+//nop;
+return v0;
+}
+
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t5 = 0, t6 = 0, t7 = 0, t9 = 0;
+L420cd0:
+//st_idn_dn:
+//nop;
+//nop;
+//nop;
+v1 = 0x10007ff0;
+// fdead 7b sp = sp + 0xffffffd8;
+v1 = MEM_U32(v1 + 0);
+// fdead 7b MEM_U32(sp + 28) = ra;
+// fdead 7b MEM_U32(sp + 24) = gp;
+// fdead 7b MEM_U32(sp + 40) = a0;
+// fdead 7b MEM_U32(sp + 44) = a1;
+if (v1 != 0) goto L420d28;
+a0 = 0x10002c2c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L420d28:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L420d7c;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 827f MEM_U32(sp + 36) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 36);
+t7 = 0x10007ff0;
+v1 = 0x10007ff0;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L420d7c:
+//nop;
+if (t0 != 0) goto L420dac;
+//nop;
+a0 = MEM_U32(v1 + 56);
+a1 = 0x10;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L420dac:
+t1 = MEM_U32(v1 + 60);
+t9 = MEM_U32(v1 + 56);
+// fdead 401867f t8 = MEM_U32(sp + 40);
+t2 = t1 << 3;
+v1 = 0x10007ff0;
+t3 = t9 + t2;
+// fdead 4019e7f MEM_U32(t3 + 0) = t8;
+v1 = MEM_U32(v1 + 0);
+// fdead 4019e7f t4 = MEM_U32(sp + 44);
+t6 = MEM_U32(v1 + 60);
+t5 = MEM_U32(v1 + 56);
+t7 = t6 << 3;
+v1 = 0x10007ff0;
+t1 = t5 + t7;
+// fdead 401de7f MEM_U32(t1 + 4) = t4;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t9 = v0 + 0x1;
+MEM_U32(v1 + 60) = t9;
+// fdead 401de7f ra = MEM_U32(sp + 28);
+// fdead 401de7f sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t2 = 0, t8 = 0, t9 = 0;
+L421084:
+//st_setidn:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b a2 = a0;
+if ((int)a0 < 0) goto L4210d8;
+//nop;
+if ((int)a1 < 0) goto L4210d8;
+v1 = 0x10007ff0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+// fdead 5b at = (int)a0 < (int)v0;
+if (at == 0) {
+at = (int)a1 < (int)v0;
+goto L4210d8;}
+//nop;
+if ((int)a1 < (int)v0) goto L421108;
+L4210d8:
+a0 = 0x10002d20;
+//nop;
+// fdead 7f MEM_U32(sp + 36) = a1;
+// fdead 7f MEM_U32(sp + 32) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 a1 = MEM_U32(sp + 36);
+v1 = 0x10007ff0;
+// fdead 17 a2 = MEM_U32(sp + 32);
+v1 = MEM_U32(v1 + 0);
+//nop;
+L421108:
+v0 = MEM_U32(v1 + 56);
+t8 = a1 << 3;
+t9 = v0 + t8;
+at = MEM_U32(t9 + 0);
+// fdead 600005f t6 = a2 << 3;
+// fdead 600005f t7 = v0 + t6;
+// fdead 600005f MEM_U32(t7 + 0) = at;
+t2 = MEM_U32(t9 + 4);
+//nop;
+// fdead 600085f MEM_U32(t7 + 4) = t2;
+// fdead 600085f ra = MEM_U32(sp + 28);
+// fdead 600085f sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L4214c8:
+//st_iaux_copyty:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffc8;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 28) = s2;
+// fdead 6b MEM_U32(sp + 24) = s1;
+// fdead 6b MEM_U32(sp + 20) = s0;
+// fdead 6b MEM_U32(sp + 60) = a1;
+a1 = MEM_U32(a1 + 8);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t7 = a1 & at;
+s2 = a0;
+s1 = zero;
+a1 = t7;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead c001f a2 = MEM_U32(sp + 60);
+// fdead c001f gp = MEM_U32(sp + 32);
+// fdead c001f t8 = MEM_U32(a2 + 8);
+at = 0x6;
+// fdead c001f t9 = t8 >> 26;
+t0 = s1 << 2;
+if (t9 != at) goto L421538;
+s1 = 0x1;
+t0 = s1 << 2;
+L421538:
+a1 = t0 + v0;
+v1 = MEM_U8(a1 + 0);
+at = 0x25;
+t1 = v1 & 0x3f;
+s1 = s1 + 0x1;
+v1 = t1;
+if (t1 != at) goto L42157c;
+t2 = s1 << 2;
+t3 = v0 + t2;
+t4 = MEM_U32(t3 + 0);
+a3 = 0xfff;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L421574;
+s1 = s1 + 0x1;
+L421574:
+s1 = s1 + 0x1;
+goto L421600;
+L42157c:
+at = 0x11;
+t6 = s1 << 2;
+if (v1 == at) goto L4215b0;
+at = 0x14;
+if (v1 == at) {
+at = 0xc;
+goto L4215b0;}
+at = 0xc;
+if (v1 == at) {
+at = 0xd;
+goto L4215b0;}
+at = 0xd;
+if (v1 == at) {
+at = 0xf;
+goto L4215b0;}
+at = 0xf;
+if (v1 == at) {
+at = 0xe;
+goto L4215b0;}
+at = 0xe;
+if (v1 != at) {
+t7 = v0 + t6;
+goto L4215d4;}
+L4215b0:
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+a3 = 0xfff;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L4215cc;
+s1 = s1 + 0x1;
+L4215cc:
+s1 = s1 + 0x1;
+goto L421600;
+L4215d4:
+at = 0x10;
+t0 = s1 << 2;
+if (v1 != at) goto L421600;
+t1 = v0 + t0;
+t2 = MEM_U32(t1 + 0);
+a3 = 0xfff;
+t3 = t2 >> 20;
+//nop;
+if (a3 != t3) goto L4215fc;
+s1 = s1 + 0x1;
+L4215fc:
+s1 = s1 + 0x3;
+L421600:
+t4 = MEM_U16(a1 + 2);
+v1 = 0x3;
+t5 = t4 >> 12;
+a3 = 0xfff;
+if (v1 != t5) goto L421638;
+t6 = s1 << 2;
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+//nop;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L421634;
+s1 = s1 + 0x1;
+L421634:
+s1 = s1 + 0x4;
+L421638:
+t0 = MEM_U8(a1 + 2);
+t2 = s1 << 2;
+t1 = t0 & 0xf;
+t3 = v0 + t2;
+if (v1 != t1) goto L421668;
+t4 = MEM_U32(t3 + 0);
+//nop;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L421664;
+s1 = s1 + 0x1;
+L421664:
+s1 = s1 + 0x4;
+L421668:
+t6 = MEM_U8(a1 + 3);
+t8 = s1 << 2;
+t7 = t6 >> 4;
+t9 = v0 + t8;
+if (v1 != t7) goto L421698;
+t0 = MEM_U32(t9 + 0);
+//nop;
+t1 = t0 >> 20;
+//nop;
+if (a3 != t1) goto L421694;
+s1 = s1 + 0x1;
+L421694:
+s1 = s1 + 0x4;
+L421698:
+a0 = MEM_U32(a1 + 0);
+t3 = s1 << 2;
+t2 = a0 & 0xf;
+t4 = v0 + t3;
+if (v1 != t2) goto L4216c8;
+t5 = MEM_U32(t4 + 0);
+//nop;
+t6 = t5 >> 20;
+//nop;
+if (a3 != t6) goto L4216c4;
+s1 = s1 + 0x1;
+L4216c4:
+s1 = s1 + 0x4;
+L4216c8:
+t7 = MEM_U8(a1 + 1);
+t9 = s1 << 2;
+t8 = t7 >> 4;
+t0 = v0 + t9;
+if (v1 != t8) goto L4216f8;
+t1 = MEM_U32(t0 + 0);
+//nop;
+t2 = t1 >> 20;
+//nop;
+if (a3 != t2) goto L4216f4;
+s1 = s1 + 0x1;
+L4216f4:
+s1 = s1 + 0x4;
+L4216f8:
+t3 = MEM_U16(a1 + 0);
+t5 = s1 << 2;
+t4 = t3 & 0xf;
+t9 = a0 >> 31;
+if (v1 != t4) goto L42172c;
+t6 = v0 + t5;
+t7 = MEM_U32(t6 + 0);
+//nop;
+t8 = t7 >> 20;
+//nop;
+if (a3 != t8) goto L421728;
+s1 = s1 + 0x1;
+L421728:
+s1 = s1 + 0x4;
+L42172c:
+//nop;
+if (t9 == 0) goto L421738;
+s1 = s1 + 0x1;
+L421738:
+s0 = zero;
+if ((int)s1 <= 0) goto L4217d4;
+// fdead 60fff7f a2 = MEM_U32(sp + 60);
+L421744:
+a0 = s2;
+// fdead 60fff7f v0 = MEM_U32(a2 + 8);
+at = 0xf0000;
+if (s0 != 0) goto L421794;
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t0 = v0 & at;
+a1 = t0 + s0;
+a0 = s2;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+// fdead e003f MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0);
+// fdead e001f gp = MEM_U32(sp + 32);
+// fdead e001f MEM_U32(sp + 44) = v0;
+goto L4217c8;
+L421794:
+//nop;
+at = at | 0xffff;
+t3 = v0 & at;
+a1 = t3 + s0;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+// fdead e003f MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0);
+// fdead e001f gp = MEM_U32(sp + 32);
+//nop;
+L4217c8:
+s0 = s0 + 0x1;
+// fdead e001f a2 = MEM_U32(sp + 60);
+if (s0 != s1) goto L421744;
+L4217d4:
+// fdead 60fff7f ra = MEM_U32(sp + 36);
+// fdead 60fff7f v0 = MEM_U32(sp + 44);
+// fdead 60fff7f s0 = MEM_U32(sp + 20);
+// fdead 60fff7f s1 = MEM_U32(sp + 24);
+// fdead 60fff7f s2 = MEM_U32(sp + 28);
+// fdead 60fff7f sp = sp + 0x38;
+return v0;
+}
+
+static void f_st_auxisymadd(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, a0 = 0;
+L421ab8:
+//st_auxisymadd:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffd8;
+//nop;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 36) = a0;
+// fdead b MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0);
+// fdead 1b ra = MEM_U32(sp + 28);
+// fdead 1b gp = MEM_U32(sp + 24);
+// fdead 1b sp = sp + 0x28;
+return;
+}
+
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0;
+L421af0:
+//st_auxrndxadd:
+//nop;
+//nop;
+//nop;
+// fdead 3 sp = sp + 0xffffffd0;
+// fdead 3 t7 = MEM_U16(sp + 44);
+at = 0xf0000;
+// fdead 7 t8 = t7 | 0xfff0;
+// fdead 7 MEM_U16(sp + 44) = (uint16_t)t8;
+// fdead 7 t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+// fdead 7 t9 = a1 & at;
+// fdead 7 t1 = t9 ^ t0;
+// fdead 7 t2 = t1 << 12;
+// fdead 7 t3 = t2 >> 12;
+// fdead 7 t4 = t3 ^ t0;
+// fdead 7 MEM_U32(sp + 28) = ra;
+// fdead 7 MEM_U32(sp + 24) = gp;
+// fdead 7 MEM_U32(sp + 48) = a0;
+// fdead 7 MEM_U32(sp + 44) = t4;
+// fdead 7 t5 = sp + 0x2c;
+// fdead 7 a0 = MEM_U32(t5 + 0);
+//nop;
+// fdead 7 v0 = sp + 0x28;
+// fdead 7 MEM_U32(v0 + 0) = a0;
+// fdead 7 MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f a0 = MEM_U32(sp + 48);
+//nop;
+// fdead 1f MEM_U32(sp + 36) = v0;
+//nop;
+f_st_auxisymadd(mem, sp);
+// fdead 1f ra = MEM_U32(sp + 28);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f v0 = MEM_U32(sp + 36);
+// fdead 1f sp = sp + 0x30;
+return;
+}
+
+static uint32_t f__elf64_fsize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0, lo = 0, hi = 0;
+L421ce0:
+//_elf64_fsize:
+//nop;
+//nop;
+//nop;
+a2 = a2 + 0xffffffff;
+at = a0 < 0xf;
+if (a2 == 0) goto L421d0c;
+at = 0x100003e8;
+t6 = 0x517;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+return v0;
+L421d0c:
+t8 = a2 << 4;
+if (at != 0) goto L421d28;
+at = 0x100003e8;
+t7 = 0x514;
+v0 = zero;
+MEM_U32(at + 0) = t7;
+return v0;
+L421d28:
+t1 = 0x10002e80;
+t8 = t8 - a2;
+t8 = t8 << 3;
+t9 = a0 << 3;
+t0 = t8 + t9;
+t1 = t1;
+t2 = t0 + t1;
+t3 = MEM_U32(t2 + 0);
+//nop;
+lo = t3 * a1;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)a1 >> 32);
+v0 = lo;
+//nop;
+//nop;
+//nop;
+return v0;
+}
+
+static uint32_t f__elf64_msize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L421d64:
+//_elf64_msize:
+//nop;
+//nop;
+//nop;
+t6 = a1 << 4;
+t9 = 0x10002e80;
+t6 = t6 - a1;
+t6 = t6 << 3;
+t7 = a0 << 3;
+t8 = t6 + t7;
+t9 = t9;
+t0 = t8 + t9;
+v0 = MEM_U32(t0 + -116);
+//nop;
+return v0;
+}
+
+static uint32_t f__elf64_mtype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L421d9c:
+//_elf64_mtype:
+//nop;
+//nop;
+//nop;
+t6 = a1 << 2;
+if (a0 < 0xc) goto L421dbc;
+v0 = zero;
+return v0;
+L421dbc:
+t9 = 0x10002ef8;
+t6 = t6 - a1;
+t6 = t6 << 4;
+t7 = a0 << 2;
+t8 = t6 + t7;
+t9 = t9;
+t0 = t8 + t9;
+v0 = MEM_U32(t0 + -48);
+//nop;
+//nop;
+return v0;
+}
+
+static void f_elf_version(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L421de8:
+//elf_version:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe8;
+if (a0 != 0) goto L421e04;
+// bdead 1 v0 = 0x1;
+goto L421fb4;
+L421e04:
+t6 = 0x517;
+if (a0 < 0x2) goto L421e20;
+at = 0x100003e8;
+// bdead 8005 v0 = zero;
+MEM_U32(at + 0) = t6;
+goto L421fb4;
+L421e20:
+a2 = 0x10000498;
+//nop;
+v1 = MEM_U32(a2 + 0);
+//nop;
+// bdead 400000a1 v0 = v1;
+if (v1 == 0) goto L421e40;
+MEM_U32(a2 + 0) = a0;
+goto L421fb4;
+L421e40:
+// bdead 400000a1 t7 = 0x10002e80;
+// bdead 400000a1 t8 = 0x10002e84;
+MEM_U32(a2 + 0) = a0;
+t7 = 0x1;
+t8 = 0x1;
+//nop;
+//nop;
+if (t7 == t8) goto L421e68;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421e68:
+// bdead 40000001 t9 = 0x10002e88;
+// bdead 40000001 t1 = 0x10002e8c;
+t9 = 0x8;
+t1 = 0x8;
+//nop;
+//nop;
+if (t9 == t1) goto L421e8c;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421e8c:
+// bdead 40000001 t2 = 0x10002e90;
+// bdead 40000001 t3 = 0x10002e94;
+t2 = 0x10;
+t3 = 0x10;
+//nop;
+//nop;
+if (t2 == t3) goto L421eb0;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421eb0:
+v0 = 0x10002e98;
+v1 = 0x10002ef8;
+v0 = v0;
+v1 = v1;
+L421ec0:
+t4 = MEM_U32(v0 + 0);
+t5 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (t4 == t5) goto L421edc;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421edc:
+t6 = MEM_U32(v0 + 8);
+t7 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if (t6 == t7) goto L421ef8;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421ef8:
+t8 = MEM_U32(v0 + 16);
+t9 = MEM_U32(v0 + 20);
+//nop;
+//nop;
+if (t8 == t9) goto L421f14;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421f14:
+t1 = MEM_U32(v0 + 24);
+t2 = MEM_U32(v0 + 28);
+v0 = v0 + 0x20;
+//nop;
+if (t1 == t2) goto L421f30;
+// bdead 1 v0 = a0;
+goto L421fb4;
+L421f30:
+//nop;
+if (v0 != v1) goto L421ec0;
+a3 = 0x10000;
+a3 = a3 | 0x203;
+MEM_U32(sp + 16) = a3;
+t0 = sp + 0x10;
+v1 = MEM_U8(t0 + 3);
+a1 = MEM_U8(t0 + 2);
+t3 = v1 << 8;
+a2 = MEM_U8(t0 + 1);
+t4 = t3 + a1;
+t5 = t4 << 8;
+v0 = MEM_U8(t0 + 0);
+t6 = t5 + a2;
+t7 = t6 << 8;
+t8 = v0 + t7;
+t1 = v0 << 8;
+if (a3 != t8) goto L421f88;
+at = 0x100003e4;
+t9 = 0x1;
+MEM_U32(at + 0) = t9;
+goto L421fb0;
+L421f88:
+t2 = t1 + a2;
+t3 = t2 << 8;
+t4 = t3 + a1;
+t5 = t4 << 8;
+t6 = v1 + t5;
+// bdead 1 v0 = a0;
+if (a3 != t6) goto L421fb4;
+at = 0x100003e4;
+t7 = 0x2;
+MEM_U32(at + 0) = t7;
+L421fb0:
+// bdead 1 v0 = a0;
+L421fb4:
+// bdead 1 sp = sp + 0x18;
+return;
+}
+
+static uint32_t func_421fbc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0, fp_dest;
+uint64_t temp64;
+L421fbc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s1 = a1;
+// fdead 400601eb MEM_U32(sp + 36) = ra;
+// fdead 400601eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 88) = a2;
+if (a0 == 0) goto L421ff4;
+t6 = MEM_U32(sp + 88);
+if (a1 != 0) goto L422000;
+L421ff4:
+v0 = zero;
+goto L422280;
+// fdead 0 t6 = MEM_U32(sp + 88);
+L422000:
+t8 = 0x50b;
+t7 = t6 + 0xffffffff;
+MEM_U32(sp + 88) = t7;
+if (t7 < 0x2) goto L422024;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t8;
+goto L422280;
+L422024:
+a0 = MEM_U32(s0 + 20);
+v0 = zero;
+a0 = a0 + 0xffffffff;
+//nop;
+if (a0 != 0) goto L42204c;
+v1 = MEM_U32(s1 + 20);
+//nop;
+v1 = v1 + 0xffffffff;
+//nop;
+if (v1 == 0) goto L42205c;
+L42204c:
+at = 0x100003e8;
+t9 = 0x517;
+MEM_U32(at + 0) = t9;
+goto L422280;
+L42205c:
+t0 = MEM_U32(s1 + 4);
+t3 = 0x514;
+a1 = t0;
+if (t0 < 0xf) goto L422080;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t3;
+goto L422280;
+L422080:
+v0 = a1 << 3;
+if (a3 == 0) goto L422110;
+t2 = 0x10002e80;
+t4 = a0 << 4;
+t4 = t4 - a0;
+t4 = t4 << 3;
+t2 = t2;
+t5 = t2 + t4;
+v0 = a1 << 3;
+t6 = t5 + v0;
+t7 = v1 << 4;
+a2 = MEM_U32(t6 + 0);
+t7 = t7 - v1;
+t6 = MEM_U32(sp + 88);
+t7 = t7 << 3;
+t4 = v1 << 4;
+t3 = a0 << 4;
+t8 = t2 + t7;
+t3 = t3 - a0;
+t4 = t4 - v1;
+t4 = t4 << 4;
+t3 = t3 << 4;
+t7 = t6 << 4;
+t9 = t8 + v0;
+t5 = t3 + t4;
+t7 = t7 - t6;
+t3 = 0x10000250;
+t7 = t7 << 3;
+a3 = MEM_U32(t9 + 4);
+t8 = t5 + t7;
+t9 = t8 + v0;
+t3 = t3;
+t4 = t9 + t3;
+t1 = MEM_U32(t4 + 0);
+t7 = MEM_U32(s1 + 8);
+goto L422194;
+L422110:
+t2 = 0x10002e80;
+t6 = a0 << 4;
+t6 = t6 - a0;
+t6 = t6 << 3;
+t2 = t2;
+t5 = t2 + t6;
+t7 = t5 + v0;
+t8 = v1 << 4;
+a2 = MEM_U32(t7 + 4);
+t8 = t8 - v1;
+t7 = MEM_U32(sp + 88);
+t8 = t8 << 3;
+t6 = v1 << 4;
+t4 = a0 << 4;
+t9 = t2 + t8;
+t4 = t4 - a0;
+t6 = t6 - v1;
+t6 = t6 << 4;
+t4 = t4 << 4;
+t8 = t7 << 4;
+t3 = t9 + v0;
+t5 = t4 + t6;
+t8 = t8 - t7;
+t4 = 0x10000250;
+t8 = t8 << 3;
+a3 = MEM_U32(t3 + 0);
+t9 = t5 + t8;
+t3 = t9 + v0;
+t4 = t4;
+t6 = t3 + t4;
+t1 = MEM_U32(t6 + 4);
+//nop;
+t7 = MEM_U32(s1 + 8);
+L422194:
+t3 = 0x50a;
+lo = t7 / a3; hi = t7 % a3;
+MEM_U32(sp + 44) = t7;
+v0 = zero;
+// bdead 60440061789 t5 = t7;
+//nop;
+if (a3 != 0) goto L4221b4;
+abort();
+L4221b4:
+t8 = lo;
+MEM_U32(sp + 76) = t8;
+t9 = MEM_U32(s0 + 8);
+lo = a2 * t8;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)t8 >> 32);
+v1 = lo;
+//nop;
+if (t9 >= v1) goto L4221e0;
+at = 0x100003e8;
+MEM_U32(at + 0) = t3;
+goto L422280;
+L4221e0:
+t4 = 0x100003e4;
+t6 = MEM_U32(sp + 88);
+t4 = MEM_U32(t4 + 0);
+t7 = t6 + 0x1;
+t8 = MEM_U32(sp + 76);
+if (t4 != t7) goto L422248;
+t8 = MEM_U32(sp + 76);
+if (a2 != a3) goto L422248;
+a0 = MEM_U32(s0 + 0);
+a1 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (a0 == a1) goto L422230;
+//nop;
+a2 = MEM_U32(sp + 44);
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 60001 gp = MEM_U32(sp + 32);
+t0 = MEM_U32(s1 + 4);
+//nop;
+L422230:
+MEM_U32(s0 + 4) = t0;
+t5 = MEM_U32(s1 + 8);
+v0 = s0;
+MEM_U32(s0 + 8) = t5;
+goto L422280;
+// fdead 0 t8 = MEM_U32(sp + 76);
+L422248:
+// bdead 60042060511 t9 = t1;
+a2 = t8;
+if (t8 == 0) goto L422270;
+a0 = MEM_U32(s0 + 0);
+a1 = MEM_U32(s1 + 0);
+fp_dest = t1;
+MEM_U32(sp + 40) = v1;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 40);
+//nop;
+L422270:
+MEM_U32(s0 + 8) = v1;
+t9 = MEM_U32(s1 + 4);
+v0 = s0;
+MEM_U32(s0 + 4) = t9;
+L422280:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x50;
+return v0;
+}
+
+static uint32_t f__elf64_xlatetom(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a3 = 0;
+L4222cc:
+//_elf64_xlatetom:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb t9 = t9;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+a3 = zero;
+v0 = func_421fbc(mem, sp, a0, a1, a2, a3);
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint64_t func_422304(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L422338:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L422338;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_422458(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L42248c:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 0) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L42248c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_4225ac(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+if (a0 == a1) goto L4225e0;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L4225e0:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t func_4225f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 4;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L422624:
+t9 = MEM_U32(s1 + 4);
+a2 = 0x0;
+t7 = t9 >> 8;
+t0 = t9 >> 16;
+t1 = t9 >> 24;
+MEM_U8(s0 + 3) = (uint8_t)t1;
+MEM_U8(s0 + 2) = (uint8_t)t0;
+MEM_U8(s0 + 1) = (uint8_t)t7;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+t3 = MEM_U32(s1 + 12);
+t2 = MEM_U32(s1 + 8);
+MEM_U32(sp + 44) = t3;
+MEM_U32(sp + 40) = t2;
+MEM_U8(s0 + 8) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x10;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 15) = (uint8_t)v1;
+s0 = s0 + 0x10;
+if (at != 0) goto L422624;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_422760(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 4;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L422794:
+t9 = MEM_U32(s1 + 4);
+a2 = 0x0;
+t7 = t9 >> 8;
+t0 = t9 >> 16;
+t1 = t9 >> 24;
+MEM_U8(s0 + 4) = (uint8_t)t1;
+MEM_U8(s0 + 5) = (uint8_t)t0;
+MEM_U8(s0 + 6) = (uint8_t)t7;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+t3 = MEM_U32(s1 + 12);
+t2 = MEM_U32(s1 + 8);
+MEM_U32(sp + 44) = t3;
+MEM_U32(sp + 40) = t2;
+MEM_U8(s0 + 15) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x10;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 8) = (uint8_t)v1;
+s0 = s0 + 0x10;
+if (at != 0) goto L422794;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4228d0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 6;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L422904:
+a0 = s0;
+if (s0 == s1) goto L422924;
+//nop;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+//nop;
+L422924:
+v1 = MEM_U16(s1 + 16);
+a2 = 0x0;
+t7 = (int)v1 >> 8;
+MEM_U8(s0 + 17) = (uint8_t)t7;
+MEM_U8(s0 + 16) = (uint8_t)v1;
+a0 = MEM_U16(s1 + 18);
+a3 = 0x8;
+t8 = (int)a0 >> 8;
+MEM_U8(s0 + 19) = (uint8_t)t8;
+MEM_U8(s0 + 18) = (uint8_t)a0;
+v0 = MEM_U32(s1 + 20);
+//nop;
+t9 = v0 >> 8;
+t0 = v0 >> 16;
+t1 = v0 >> 24;
+MEM_U8(s0 + 23) = (uint8_t)t1;
+MEM_U8(s0 + 22) = (uint8_t)t0;
+MEM_U8(s0 + 21) = (uint8_t)t9;
+MEM_U8(s0 + 20) = (uint8_t)v0;
+t3 = MEM_U32(s1 + 28);
+t2 = MEM_U32(s1 + 24);
+MEM_U32(sp + 60) = t3;
+MEM_U32(sp + 56) = t2;
+MEM_U8(s0 + 24) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 31) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 36);
+t4 = MEM_U32(s1 + 32);
+MEM_U32(sp + 52) = t5;
+MEM_U32(sp + 48) = t4;
+MEM_U8(s0 + 32) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 39) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 44);
+t6 = MEM_U32(s1 + 40);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 40) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 41) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 42) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 43) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 44) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 45) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 46) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 47) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 48);
+s1 = s1 + 0x40;
+t8 = a0 >> 8;
+t9 = a0 >> 16;
+t0 = a0 >> 24;
+MEM_U8(s0 + 51) = (uint8_t)t0;
+MEM_U8(s0 + 50) = (uint8_t)t9;
+MEM_U8(s0 + 49) = (uint8_t)t8;
+MEM_U8(s0 + 48) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -12);
+at = s1 < s2;
+t1 = (int)a1 >> 8;
+MEM_U8(s0 + 53) = (uint8_t)t1;
+MEM_U8(s0 + 52) = (uint8_t)a1;
+a2 = MEM_U16(s1 + -10);
+s0 = s0 + 0x40;
+t2 = (int)a2 >> 8;
+MEM_U8(s0 + -9) = (uint8_t)t2;
+MEM_U8(s0 + -10) = (uint8_t)a2;
+v0 = MEM_U16(s1 + -8);
+//nop;
+t3 = (int)v0 >> 8;
+MEM_U8(s0 + -7) = (uint8_t)t3;
+MEM_U8(s0 + -8) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -6);
+//nop;
+t4 = (int)v1 >> 8;
+MEM_U8(s0 + -5) = (uint8_t)t4;
+MEM_U8(s0 + -6) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -4);
+//nop;
+t5 = (int)a0 >> 8;
+MEM_U8(s0 + -3) = (uint8_t)t5;
+MEM_U8(s0 + -4) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -2);
+//nop;
+t6 = (int)a1 >> 8;
+MEM_U8(s0 + -1) = (uint8_t)t6;
+MEM_U8(s0 + -2) = (uint8_t)a1;
+if (at != 0) goto L422904;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x50;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_422d00(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 6;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L422d34:
+a0 = s0;
+if (s0 == s1) goto L422d54;
+//nop;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+//nop;
+L422d54:
+v1 = MEM_U16(s1 + 16);
+a2 = 0x0;
+t7 = (int)v1 >> 8;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+MEM_U8(s0 + 17) = (uint8_t)v1;
+a0 = MEM_U16(s1 + 18);
+a3 = 0x8;
+t8 = (int)a0 >> 8;
+MEM_U8(s0 + 18) = (uint8_t)t8;
+MEM_U8(s0 + 19) = (uint8_t)a0;
+v0 = MEM_U32(s1 + 20);
+//nop;
+t9 = v0 >> 8;
+t0 = v0 >> 16;
+t1 = v0 >> 24;
+MEM_U8(s0 + 20) = (uint8_t)t1;
+MEM_U8(s0 + 21) = (uint8_t)t0;
+MEM_U8(s0 + 22) = (uint8_t)t9;
+MEM_U8(s0 + 23) = (uint8_t)v0;
+t3 = MEM_U32(s1 + 28);
+t2 = MEM_U32(s1 + 24);
+MEM_U32(sp + 60) = t3;
+MEM_U32(sp + 56) = t2;
+MEM_U8(s0 + 31) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 24) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 36);
+t4 = MEM_U32(s1 + 32);
+MEM_U32(sp + 52) = t5;
+MEM_U32(sp + 48) = t4;
+MEM_U8(s0 + 39) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 32) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 44);
+t6 = MEM_U32(s1 + 40);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 47) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 46) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 45) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 44) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 43) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 42) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 41) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 40) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 48);
+s1 = s1 + 0x40;
+t8 = a0 >> 8;
+t9 = a0 >> 16;
+t0 = a0 >> 24;
+MEM_U8(s0 + 48) = (uint8_t)t0;
+MEM_U8(s0 + 49) = (uint8_t)t9;
+MEM_U8(s0 + 50) = (uint8_t)t8;
+MEM_U8(s0 + 51) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -12);
+at = s1 < s2;
+t1 = (int)a1 >> 8;
+MEM_U8(s0 + 52) = (uint8_t)t1;
+MEM_U8(s0 + 53) = (uint8_t)a1;
+a2 = MEM_U16(s1 + -10);
+s0 = s0 + 0x40;
+t2 = (int)a2 >> 8;
+MEM_U8(s0 + -10) = (uint8_t)t2;
+MEM_U8(s0 + -9) = (uint8_t)a2;
+v0 = MEM_U16(s1 + -8);
+//nop;
+t3 = (int)v0 >> 8;
+MEM_U8(s0 + -8) = (uint8_t)t3;
+MEM_U8(s0 + -7) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -6);
+//nop;
+t4 = (int)v1 >> 8;
+MEM_U8(s0 + -6) = (uint8_t)t4;
+MEM_U8(s0 + -5) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -4);
+//nop;
+t5 = (int)a0 >> 8;
+MEM_U8(s0 + -4) = (uint8_t)t5;
+MEM_U8(s0 + -3) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -2);
+//nop;
+t6 = (int)a1 >> 8;
+MEM_U8(s0 + -2) = (uint8_t)t6;
+MEM_U8(s0 + -1) = (uint8_t)a1;
+if (at != 0) goto L422d34;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x50;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_423130(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+t6 = a2 << 1;
+v0 = t6 + a1;
+L423138:
+v1 = MEM_U16(a1 + 0);
+a1 = a1 + 0x2;
+at = a1 < v0;
+t7 = (int)v1 >> 8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x2;
+MEM_U8(a0 + -2) = (uint8_t)v1;
+if (at != 0) goto L423138;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_423160(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+t6 = a2 << 1;
+v0 = t6 + a1;
+L423168:
+v1 = MEM_U16(a1 + 0);
+a1 = a1 + 0x2;
+at = a1 < v0;
+t7 = (int)v1 >> 8;
+MEM_U8(a0 + 0) = (uint8_t)t7;
+a0 = a0 + 0x2;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L423168;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_423190(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L4231c4:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L4231c4;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4232e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L423318:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 0) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L423318;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_423438(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+t6 = a2 << 3;
+t6 = t6 - a2;
+t6 = t6 << 3;
+// fdead 400081e3 MEM_U32(sp + 28) = s1;
+// fdead 400081e3 MEM_U32(sp + 24) = s0;
+t7 = t6 + a1;
+s0 = a0;
+s1 = a1;
+// fdead 400781e3 MEM_U32(sp + 36) = ra;
+// fdead 400781e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 100) = t7;
+L423474:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t8 = v0 >> 8;
+t9 = v0 >> 16;
+t0 = v0 >> 24;
+MEM_U8(s0 + 3) = (uint8_t)t0;
+MEM_U8(s0 + 2) = (uint8_t)t9;
+MEM_U8(s0 + 1) = (uint8_t)t8;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+v1 = MEM_U32(s1 + 4);
+a3 = 0x8;
+t1 = v1 >> 8;
+t2 = v1 >> 16;
+t3 = v1 >> 24;
+MEM_U8(s0 + 7) = (uint8_t)t3;
+MEM_U8(s0 + 6) = (uint8_t)t2;
+MEM_U8(s0 + 5) = (uint8_t)t1;
+MEM_U8(s0 + 4) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 84) = t5;
+MEM_U32(sp + 80) = t4;
+MEM_U8(s0 + 8) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 15) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 76) = t7;
+MEM_U32(sp + 72) = t6;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 23) = (uint8_t)v1;
+t9 = MEM_U32(s1 + 28);
+t8 = MEM_U32(s1 + 24);
+MEM_U32(sp + 68) = t9;
+MEM_U32(sp + 64) = t8;
+MEM_U8(s0 + 24) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 31) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 36);
+t0 = MEM_U32(s1 + 32);
+MEM_U32(sp + 60) = t1;
+MEM_U32(sp + 56) = t0;
+MEM_U8(s0 + 32) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 39) = (uint8_t)v1;
+t3 = MEM_U32(s1 + 44);
+t2 = MEM_U32(s1 + 40);
+MEM_U32(sp + 52) = t3;
+MEM_U32(sp + 48) = t2;
+MEM_U8(s0 + 40) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 41) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 42) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 43) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 44) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 45) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 46) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 47) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 52);
+t4 = MEM_U32(s1 + 48);
+MEM_U32(sp + 44) = t5;
+MEM_U32(sp + 40) = t4;
+MEM_U8(s0 + 48) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 49) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 50) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 51) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 52) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 53) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 54) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 55) = (uint8_t)v1;
+t6 = MEM_U32(sp + 100);
+s1 = s1 + 0x38;
+s0 = s0 + 0x38;
+if (s1 < t6) goto L423474;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x68;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_423a98(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+t6 = a2 << 3;
+t6 = t6 - a2;
+t6 = t6 << 3;
+// fdead 400081e3 MEM_U32(sp + 28) = s1;
+// fdead 400081e3 MEM_U32(sp + 24) = s0;
+t7 = t6 + a1;
+s0 = a0;
+s1 = a1;
+// fdead 400781e3 MEM_U32(sp + 36) = ra;
+// fdead 400781e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 100) = t7;
+L423ad4:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t8 = v0 >> 8;
+t9 = v0 >> 16;
+t0 = v0 >> 24;
+MEM_U8(s0 + 0) = (uint8_t)t0;
+MEM_U8(s0 + 1) = (uint8_t)t9;
+MEM_U8(s0 + 2) = (uint8_t)t8;
+MEM_U8(s0 + 3) = (uint8_t)v0;
+v1 = MEM_U32(s1 + 4);
+a3 = 0x8;
+t1 = v1 >> 8;
+t2 = v1 >> 16;
+t3 = v1 >> 24;
+MEM_U8(s0 + 4) = (uint8_t)t3;
+MEM_U8(s0 + 5) = (uint8_t)t2;
+MEM_U8(s0 + 6) = (uint8_t)t1;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 84) = t5;
+MEM_U32(sp + 80) = t4;
+MEM_U8(s0 + 15) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 8) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 76) = t7;
+MEM_U32(sp + 72) = t6;
+MEM_U8(s0 + 23) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 16) = (uint8_t)v1;
+t9 = MEM_U32(s1 + 28);
+t8 = MEM_U32(s1 + 24);
+MEM_U32(sp + 68) = t9;
+MEM_U32(sp + 64) = t8;
+MEM_U8(s0 + 31) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 24) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 36);
+t0 = MEM_U32(s1 + 32);
+MEM_U32(sp + 60) = t1;
+MEM_U32(sp + 56) = t0;
+MEM_U8(s0 + 39) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 32) = (uint8_t)v1;
+t3 = MEM_U32(s1 + 44);
+t2 = MEM_U32(s1 + 40);
+MEM_U32(sp + 52) = t3;
+MEM_U32(sp + 48) = t2;
+MEM_U8(s0 + 47) = (uint8_t)t3;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 46) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 45) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 44) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 43) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 42) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 41) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 40) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 52);
+t4 = MEM_U32(s1 + 48);
+MEM_U32(sp + 44) = t5;
+MEM_U32(sp + 40) = t4;
+MEM_U8(s0 + 55) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 54) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 53) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 52) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 51) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 50) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 49) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 48) = (uint8_t)v1;
+t6 = MEM_U32(sp + 100);
+s1 = s1 + 0x38;
+s0 = s0 + 0x38;
+if (s1 < t6) goto L423ad4;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x68;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4240f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 4;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L42412c:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 7) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 8);
+s1 = s1 + 0x10;
+t0 = a0 >> 8;
+t1 = a0 >> 16;
+t7 = a0 >> 24;
+MEM_U8(s0 + 11) = (uint8_t)t7;
+MEM_U8(s0 + 10) = (uint8_t)t1;
+MEM_U8(s0 + 9) = (uint8_t)t0;
+MEM_U8(s0 + 8) = (uint8_t)a0;
+t2 = MEM_U8(s1 + -4);
+at = s1 < s2;
+MEM_U8(s0 + 12) = (uint8_t)t2;
+t3 = MEM_U8(s1 + -3);
+// bdead 400e101d t9 = v1;
+MEM_U8(s0 + 13) = (uint8_t)t3;
+t4 = MEM_U8(s1 + -2);
+s0 = s0 + 0x10;
+MEM_U8(s0 + -2) = (uint8_t)t4;
+t5 = MEM_U8(s1 + -1);
+MEM_U8(s0 + -1) = (uint8_t)t5;
+if (at != 0) goto L42412c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42428c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 4;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L4242c0:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 0) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 8);
+s1 = s1 + 0x10;
+t0 = a0 >> 8;
+t1 = a0 >> 16;
+t7 = a0 >> 24;
+MEM_U8(s0 + 8) = (uint8_t)t7;
+MEM_U8(s0 + 9) = (uint8_t)t1;
+MEM_U8(s0 + 10) = (uint8_t)t0;
+MEM_U8(s0 + 11) = (uint8_t)a0;
+t2 = MEM_U8(s1 + -4);
+at = s1 < s2;
+MEM_U8(s0 + 12) = (uint8_t)t2;
+t3 = MEM_U8(s1 + -3);
+// bdead 400e101d t9 = v1;
+MEM_U8(s0 + 13) = (uint8_t)t3;
+t4 = MEM_U8(s1 + -2);
+s0 = s0 + 0x10;
+MEM_U8(s0 + -2) = (uint8_t)t4;
+t5 = MEM_U8(s1 + -1);
+MEM_U8(s0 + -1) = (uint8_t)t5;
+if (at != 0) goto L4242c0;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_424420(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L42445c:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 60) = t9;
+MEM_U32(sp + 56) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 7) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 8);
+a2 = 0x0;
+t0 = a0 >> 8;
+t1 = a0 >> 16;
+t7 = a0 >> 24;
+MEM_U8(s0 + 11) = (uint8_t)t7;
+MEM_U8(s0 + 10) = (uint8_t)t1;
+MEM_U8(s0 + 9) = (uint8_t)t0;
+MEM_U8(s0 + 8) = (uint8_t)a0;
+t2 = MEM_U8(s1 + 12);
+a3 = 0x8;
+MEM_U8(s0 + 12) = (uint8_t)t2;
+t3 = MEM_U8(s1 + 13);
+//nop;
+MEM_U8(s0 + 13) = (uint8_t)t3;
+t4 = MEM_U8(s1 + 14);
+//nop;
+MEM_U8(s0 + 14) = (uint8_t)t4;
+t5 = MEM_U8(s1 + 15);
+//nop;
+MEM_U8(s0 + 15) = (uint8_t)t5;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x18;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 23) = (uint8_t)v1;
+s0 = s0 + 0x18;
+if (at != 0) goto L42445c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4246bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L4246f8:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 60) = t9;
+MEM_U32(sp + 56) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 56);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 0) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 8);
+a2 = 0x0;
+t0 = a0 >> 8;
+t1 = a0 >> 16;
+t7 = a0 >> 24;
+MEM_U8(s0 + 8) = (uint8_t)t7;
+MEM_U8(s0 + 9) = (uint8_t)t1;
+MEM_U8(s0 + 10) = (uint8_t)t0;
+MEM_U8(s0 + 11) = (uint8_t)a0;
+t2 = MEM_U8(s1 + 12);
+a3 = 0x8;
+MEM_U8(s0 + 12) = (uint8_t)t2;
+t3 = MEM_U8(s1 + 13);
+//nop;
+MEM_U8(s0 + 13) = (uint8_t)t3;
+t4 = MEM_U8(s1 + 14);
+//nop;
+MEM_U8(s0 + 14) = (uint8_t)t4;
+t5 = MEM_U8(s1 + 15);
+//nop;
+MEM_U8(s0 + 15) = (uint8_t)t5;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 23) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x18;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 16) = (uint8_t)v1;
+s0 = s0 + 0x18;
+if (at != 0) goto L4246f8;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_424958(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff90;
+t6 = a2 << 6;
+// fdead 400081e3 MEM_U32(sp + 28) = s1;
+// fdead 400081e3 MEM_U32(sp + 24) = s0;
+t7 = t6 + a1;
+s0 = a0;
+s1 = a1;
+// fdead 400781e3 MEM_U32(sp + 36) = ra;
+// fdead 400781e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 108) = t7;
+L42498c:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t8 = v0 >> 8;
+t9 = v0 >> 16;
+t0 = v0 >> 24;
+MEM_U8(s0 + 3) = (uint8_t)t0;
+MEM_U8(s0 + 2) = (uint8_t)t9;
+MEM_U8(s0 + 1) = (uint8_t)t8;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+v1 = MEM_U32(s1 + 4);
+a3 = 0x8;
+t1 = v1 >> 8;
+t2 = v1 >> 16;
+t3 = v1 >> 24;
+MEM_U8(s0 + 7) = (uint8_t)t3;
+MEM_U8(s0 + 6) = (uint8_t)t2;
+MEM_U8(s0 + 5) = (uint8_t)t1;
+MEM_U8(s0 + 4) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 92) = t5;
+MEM_U32(sp + 88) = t4;
+MEM_U8(s0 + 8) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 15) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 84) = t7;
+MEM_U32(sp + 80) = t6;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 23) = (uint8_t)v1;
+t9 = MEM_U32(s1 + 28);
+t8 = MEM_U32(s1 + 24);
+MEM_U32(sp + 76) = t9;
+MEM_U32(sp + 72) = t8;
+MEM_U8(s0 + 24) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 31) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 36);
+t0 = MEM_U32(s1 + 32);
+MEM_U32(sp + 68) = t1;
+MEM_U32(sp + 64) = t0;
+MEM_U8(s0 + 32) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 39) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 40);
+a2 = 0x0;
+t2 = a0 >> 8;
+t3 = a0 >> 16;
+t4 = a0 >> 24;
+MEM_U8(s0 + 43) = (uint8_t)t4;
+MEM_U8(s0 + 42) = (uint8_t)t3;
+MEM_U8(s0 + 41) = (uint8_t)t2;
+MEM_U8(s0 + 40) = (uint8_t)a0;
+a1 = MEM_U32(s1 + 44);
+a3 = 0x8;
+t5 = a1 >> 8;
+t6 = a1 >> 16;
+t7 = a1 >> 24;
+MEM_U8(s0 + 47) = (uint8_t)t7;
+MEM_U8(s0 + 46) = (uint8_t)t6;
+MEM_U8(s0 + 45) = (uint8_t)t5;
+MEM_U8(s0 + 44) = (uint8_t)a1;
+t9 = MEM_U32(s1 + 52);
+t8 = MEM_U32(s1 + 48);
+MEM_U32(sp + 52) = t9;
+MEM_U32(sp + 48) = t8;
+MEM_U8(s0 + 48) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 49) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 50) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 51) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 52) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 53) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 54) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 55) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 60);
+t0 = MEM_U32(s1 + 56);
+MEM_U32(sp + 44) = t1;
+MEM_U32(sp + 40) = t0;
+MEM_U8(s0 + 56) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 57) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 58) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 59) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 60) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 61) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 62) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 63) = (uint8_t)v1;
+t2 = MEM_U32(sp + 108);
+s1 = s1 + 0x40;
+s0 = s0 + 0x40;
+if (s1 < t2) goto L42498c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x70;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_424ff4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff90;
+t6 = a2 << 6;
+// fdead 400081e3 MEM_U32(sp + 28) = s1;
+// fdead 400081e3 MEM_U32(sp + 24) = s0;
+t7 = t6 + a1;
+s0 = a0;
+s1 = a1;
+// fdead 400781e3 MEM_U32(sp + 36) = ra;
+// fdead 400781e3 MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 108) = t7;
+L425028:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t8 = v0 >> 8;
+t9 = v0 >> 16;
+t0 = v0 >> 24;
+MEM_U8(s0 + 0) = (uint8_t)t0;
+MEM_U8(s0 + 1) = (uint8_t)t9;
+MEM_U8(s0 + 2) = (uint8_t)t8;
+MEM_U8(s0 + 3) = (uint8_t)v0;
+v1 = MEM_U32(s1 + 4);
+a3 = 0x8;
+t1 = v1 >> 8;
+t2 = v1 >> 16;
+t3 = v1 >> 24;
+MEM_U8(s0 + 4) = (uint8_t)t3;
+MEM_U8(s0 + 5) = (uint8_t)t2;
+MEM_U8(s0 + 6) = (uint8_t)t1;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 92) = t5;
+MEM_U32(sp + 88) = t4;
+MEM_U8(s0 + 15) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 92);
+a0 = MEM_U32(sp + 88);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 8) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 84) = t7;
+MEM_U32(sp + 80) = t6;
+MEM_U8(s0 + 23) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 80);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 16) = (uint8_t)v1;
+t9 = MEM_U32(s1 + 28);
+t8 = MEM_U32(s1 + 24);
+MEM_U32(sp + 76) = t9;
+MEM_U32(sp + 72) = t8;
+MEM_U8(s0 + 31) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 30) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 29) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 28) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 27) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 26) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 25) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 76);
+a0 = MEM_U32(sp + 72);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 24) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 36);
+t0 = MEM_U32(s1 + 32);
+MEM_U32(sp + 68) = t1;
+MEM_U32(sp + 64) = t0;
+MEM_U8(s0 + 39) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 38) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 37) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 36) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 35) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 34) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 33) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 64);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 32) = (uint8_t)v1;
+a0 = MEM_U32(s1 + 40);
+a2 = 0x0;
+t2 = a0 >> 8;
+t3 = a0 >> 16;
+t4 = a0 >> 24;
+MEM_U8(s0 + 40) = (uint8_t)t4;
+MEM_U8(s0 + 41) = (uint8_t)t3;
+MEM_U8(s0 + 42) = (uint8_t)t2;
+MEM_U8(s0 + 43) = (uint8_t)a0;
+a1 = MEM_U32(s1 + 44);
+a3 = 0x8;
+t5 = a1 >> 8;
+t6 = a1 >> 16;
+t7 = a1 >> 24;
+MEM_U8(s0 + 44) = (uint8_t)t7;
+MEM_U8(s0 + 45) = (uint8_t)t6;
+MEM_U8(s0 + 46) = (uint8_t)t5;
+MEM_U8(s0 + 47) = (uint8_t)a1;
+t9 = MEM_U32(s1 + 52);
+t8 = MEM_U32(s1 + 48);
+MEM_U32(sp + 52) = t9;
+MEM_U32(sp + 48) = t8;
+MEM_U8(s0 + 55) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 54) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 53) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 52) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 51) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 50) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 49) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 48) = (uint8_t)v1;
+t1 = MEM_U32(s1 + 60);
+t0 = MEM_U32(s1 + 56);
+MEM_U32(sp + 44) = t1;
+MEM_U32(sp + 40) = t0;
+MEM_U8(s0 + 63) = (uint8_t)t1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 62) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 61) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 60) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 59) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 58) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 57) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060019 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 56) = (uint8_t)v1;
+t2 = MEM_U32(sp + 108);
+s1 = s1 + 0x40;
+s0 = s0 + 0x40;
+if (s1 < t2) goto L425028;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x70;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L425698:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L425698;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4256d0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L4256d8:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L4256d8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425710(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L425744:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L425744;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L425898:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 0) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L425898;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4259b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L4259f4:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t7 = v0 >> 8;
+t8 = v0 >> 16;
+t9 = v0 >> 24;
+MEM_U8(s0 + 3) = (uint8_t)t9;
+MEM_U8(s0 + 2) = (uint8_t)t8;
+MEM_U8(s0 + 1) = (uint8_t)t7;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+t0 = MEM_U8(s1 + 4);
+a3 = 0x8;
+MEM_U8(s0 + 4) = (uint8_t)t0;
+t1 = MEM_U8(s1 + 5);
+//nop;
+MEM_U8(s0 + 5) = (uint8_t)t1;
+v1 = MEM_U16(s1 + 6);
+//nop;
+t2 = (int)v1 >> 8;
+MEM_U8(s0 + 7) = (uint8_t)t2;
+MEM_U8(s0 + 6) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 52) = t5;
+MEM_U32(sp + 48) = t4;
+MEM_U8(s0 + 8) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 15) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x18;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 23) = (uint8_t)v1;
+s0 = s0 + 0x18;
+if (at != 0) goto L4259f4;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425c50(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L425c8c:
+v0 = MEM_U32(s1 + 0);
+a2 = 0x0;
+t7 = v0 >> 8;
+t8 = v0 >> 16;
+t9 = v0 >> 24;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+MEM_U8(s0 + 1) = (uint8_t)t8;
+MEM_U8(s0 + 2) = (uint8_t)t7;
+MEM_U8(s0 + 3) = (uint8_t)v0;
+t0 = MEM_U8(s1 + 4);
+a3 = 0x8;
+MEM_U8(s0 + 4) = (uint8_t)t0;
+t1 = MEM_U8(s1 + 5);
+//nop;
+MEM_U8(s0 + 5) = (uint8_t)t1;
+v1 = MEM_U16(s1 + 6);
+//nop;
+t2 = (int)v1 >> 8;
+MEM_U8(s0 + 6) = (uint8_t)t2;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+t5 = MEM_U32(s1 + 12);
+t4 = MEM_U32(s1 + 8);
+MEM_U32(sp + 52) = t5;
+MEM_U32(sp + 48) = t4;
+MEM_U8(s0 + 15) = (uint8_t)t5;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+//nop;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 14) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 13) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 12) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 11) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 10) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 9) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 8) = (uint8_t)v1;
+t7 = MEM_U32(s1 + 20);
+t6 = MEM_U32(s1 + 16);
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = t6;
+MEM_U8(s0 + 23) = (uint8_t)t7;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 22) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 21) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 20) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 19) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 18) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 17) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x18;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 16) = (uint8_t)v1;
+s0 = s0 + 0x18;
+if (at != 0) goto L425c8c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425ee8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L425ef0:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L425ef0;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425f28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L425f30:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L425f30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_425f68(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L425f9c:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 0) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 7) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L425f9c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4260bc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001e3 MEM_U32(sp + 28) = s2;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+// fdead 400001e3 MEM_U32(sp + 20) = s0;
+t6 = a2 << 3;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L4260f0:
+t9 = MEM_U32(s1 + 4);
+t8 = MEM_U32(s1 + 0);
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 40) = t8;
+MEM_U8(s0 + 7) = (uint8_t)t9;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 6) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x10;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 5) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x18;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 4) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 3) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x28;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 2) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x30;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+MEM_U8(s0 + 1) = (uint8_t)v1;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+a2 = 0x0;
+a3 = 0x38;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+s1 = s1 + 0x8;
+// bdead 400e0019 gp = MEM_U32(sp + 32);
+at = s1 < s2;
+MEM_U8(s0 + 0) = (uint8_t)v1;
+// bdead 400e001d t9 = v1;
+s0 = s0 + 0x8;
+if (at != 0) goto L4260f0;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x38;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_426210(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L4263a8;
+L426254:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 6);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 5);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 4);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 3);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 2);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 1);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L426254;
+L4263a8:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4263c0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L426558;
+L426404:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 1);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 2);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 3);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 4);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 5);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 6);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L426404;
+L426558:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_426570(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 4;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 4;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff0;
+if (a3 == 0) goto L42684c;
+L4265b4:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 14);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 13);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 12);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 11);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 10);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 9);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 8);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+//nop;
+a1 = MEM_U8(s0 + 7);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 6);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 5);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 4);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 3);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 2);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 1);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff0;
+MEM_U32(s1 + 16) = t4;
+MEM_U32(s1 + 20) = t5;
+if (a3 != 0) goto L4265b4;
+L42684c:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_426864(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 4;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 4;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff0;
+if (a3 == 0) goto L426b40;
+L4268a8:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xfffffff0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 9);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 10);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 11);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 12);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 13);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 14);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 15);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+//nop;
+a1 = MEM_U8(s0 + 0);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 1);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 2);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 3);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 4);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 5);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 6);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff0;
+MEM_U32(s1 + 16) = t4;
+MEM_U32(s1 + 20) = t5;
+if (a3 != 0) goto L4268a8;
+L426b40:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_426b58(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 6;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 6;
+v0 = a0 < s1;
+// fdead 400581eb MEM_U32(sp + 36) = ra;
+// fdead 400581eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffc0;
+if (v0 == 0) goto L427090;
+L426b9c:
+t9 = MEM_U8(s0 + -1);
+t8 = MEM_U8(s0 + -2);
+t0 = t9 << 8;
+t1 = t8 + t0;
+MEM_U16(s1 + 62) = (uint16_t)t1;
+t3 = MEM_U8(s0 + -3);
+t2 = MEM_U8(s0 + -4);
+t4 = t3 << 8;
+t5 = t2 + t4;
+MEM_U16(s1 + 60) = (uint16_t)t5;
+t7 = MEM_U8(s0 + -5);
+t6 = MEM_U8(s0 + -6);
+t9 = t7 << 8;
+t8 = t6 + t9;
+MEM_U16(s1 + 58) = (uint16_t)t8;
+t1 = MEM_U8(s0 + -7);
+t0 = MEM_U8(s0 + -8);
+t3 = t1 << 8;
+t2 = t0 + t3;
+MEM_U16(s1 + 56) = (uint16_t)t2;
+t5 = MEM_U8(s0 + -9);
+t4 = MEM_U8(s0 + -10);
+t7 = t5 << 8;
+t6 = t4 + t7;
+MEM_U16(s1 + 54) = (uint16_t)t6;
+t8 = MEM_U8(s0 + -11);
+t9 = MEM_U8(s0 + -12);
+t1 = t8 << 8;
+t0 = t9 + t1;
+MEM_U16(s1 + 52) = (uint16_t)t0;
+t3 = MEM_U8(s0 + -13);
+t5 = MEM_U8(s0 + -14);
+t2 = t3 << 8;
+t6 = MEM_U8(s0 + -15);
+t4 = t2 + t5;
+t7 = t4 << 8;
+t1 = MEM_U8(s0 + -16);
+t8 = t7 + t6;
+t9 = t8 << 8;
+t0 = t1 + t9;
+MEM_U32(s1 + 48) = t0;
+//nop;
+a1 = MEM_U8(s0 + -17);
+s0 = s0 + 0xffffffc0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 46);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 45);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t7 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 44);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 43);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 42);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 41);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 40);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+t5 = t0 + v1;
+at = t5 < v1;
+t2 = (int)t0 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+MEM_U32(s1 + 40) = t4;
+MEM_U32(s1 + 44) = t5;
+//nop;
+a1 = MEM_U8(s0 + 39);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 38);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 37);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 36);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 35);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 34);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 33);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 32);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+t9 = t4 + v1;
+at = t9 < v1;
+t6 = (int)t4 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 32) = t8;
+MEM_U32(s1 + 36) = t9;
+//nop;
+a1 = MEM_U8(s0 + 31);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 30);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 29);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 28);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 27);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 26);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 25);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 24);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+t3 = t8 + v1;
+at = t3 < v1;
+t0 = (int)t8 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 24) = t2;
+MEM_U32(s1 + 28) = t3;
+t9 = MEM_U8(s0 + 23);
+t5 = MEM_U8(s0 + 22);
+t4 = t9 << 8;
+t8 = MEM_U8(s0 + 21);
+t6 = t4 + t5;
+t7 = t6 << 8;
+t2 = MEM_U8(s0 + 20);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(s1 + 20) = t3;
+t4 = MEM_U8(s0 + 19);
+t9 = MEM_U8(s0 + 18);
+t5 = t4 << 8;
+t6 = t9 + t5;
+MEM_U16(s1 + 18) = (uint16_t)t6;
+t8 = MEM_U8(s0 + 17);
+t7 = MEM_U8(s0 + 16);
+t0 = t8 << 8;
+t2 = t7 + t0;
+MEM_U16(s1 + 16) = (uint16_t)t2;
+if (s1 == s0) goto L427084;
+//nop;
+a0 = s1;
+a1 = s0;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+//nop;
+L427084:
+v0 = s2 < s1;
+s1 = s1 + 0xffffffc0;
+if (v0 != 0) goto L426b9c;
+L427090:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4270a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 6;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 6;
+v0 = a0 < s1;
+// fdead 400581eb MEM_U32(sp + 36) = ra;
+// fdead 400581eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffc0;
+if (v0 == 0) goto L4275e0;
+L4270ec:
+t9 = MEM_U8(s0 + -2);
+t8 = MEM_U8(s0 + -1);
+t0 = t9 << 8;
+t1 = t8 + t0;
+MEM_U16(s1 + 62) = (uint16_t)t1;
+t3 = MEM_U8(s0 + -4);
+t2 = MEM_U8(s0 + -3);
+t4 = t3 << 8;
+t5 = t2 + t4;
+MEM_U16(s1 + 60) = (uint16_t)t5;
+t7 = MEM_U8(s0 + -6);
+t6 = MEM_U8(s0 + -5);
+t9 = t7 << 8;
+t8 = t6 + t9;
+MEM_U16(s1 + 58) = (uint16_t)t8;
+t1 = MEM_U8(s0 + -8);
+t0 = MEM_U8(s0 + -7);
+t3 = t1 << 8;
+t2 = t0 + t3;
+MEM_U16(s1 + 56) = (uint16_t)t2;
+t5 = MEM_U8(s0 + -10);
+t4 = MEM_U8(s0 + -9);
+t7 = t5 << 8;
+t6 = t4 + t7;
+MEM_U16(s1 + 54) = (uint16_t)t6;
+t8 = MEM_U8(s0 + -12);
+t9 = MEM_U8(s0 + -11);
+t1 = t8 << 8;
+t0 = t9 + t1;
+MEM_U16(s1 + 52) = (uint16_t)t0;
+t3 = MEM_U8(s0 + -16);
+t5 = MEM_U8(s0 + -15);
+t2 = t3 << 8;
+t6 = MEM_U8(s0 + -14);
+t4 = t2 + t5;
+t7 = t4 << 8;
+t1 = MEM_U8(s0 + -13);
+t8 = t7 + t6;
+t9 = t8 << 8;
+t0 = t1 + t9;
+MEM_U32(s1 + 48) = t0;
+//nop;
+a1 = MEM_U8(s0 + -24);
+s0 = s0 + 0xffffffc0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 41);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 42);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t7 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 43);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 44);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 45);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 46);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 47);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+t5 = t0 + v1;
+at = t5 < v1;
+t2 = (int)t0 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+MEM_U32(s1 + 40) = t4;
+MEM_U32(s1 + 44) = t5;
+//nop;
+a1 = MEM_U8(s0 + 32);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 33);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 34);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 35);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 36);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 37);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 38);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 39);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+t9 = t4 + v1;
+at = t9 < v1;
+t6 = (int)t4 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 32) = t8;
+MEM_U32(s1 + 36) = t9;
+//nop;
+a1 = MEM_U8(s0 + 24);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 25);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 26);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 27);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 28);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 29);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 30);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 31);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+t3 = t8 + v1;
+at = t3 < v1;
+t0 = (int)t8 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 24) = t2;
+MEM_U32(s1 + 28) = t3;
+t9 = MEM_U8(s0 + 20);
+t5 = MEM_U8(s0 + 21);
+t4 = t9 << 8;
+t8 = MEM_U8(s0 + 22);
+t6 = t4 + t5;
+t7 = t6 << 8;
+t2 = MEM_U8(s0 + 23);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(s1 + 20) = t3;
+t4 = MEM_U8(s0 + 18);
+t9 = MEM_U8(s0 + 19);
+t5 = t4 << 8;
+t6 = t9 + t5;
+MEM_U16(s1 + 18) = (uint16_t)t6;
+t8 = MEM_U8(s0 + 16);
+t7 = MEM_U8(s0 + 17);
+t0 = t8 << 8;
+t2 = t7 + t0;
+MEM_U16(s1 + 16) = (uint16_t)t2;
+if (s1 == s0) goto L4275d4;
+//nop;
+a0 = s1;
+a1 = s0;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+//nop;
+L4275d4:
+v0 = s2 < s1;
+s1 = s1 + 0xffffffc0;
+if (v0 != 0) goto L4270ec;
+L4275e0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4275f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 1;
+a0 = a0 + t6;
+t7 = a2 << 1;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffe;
+if (v1 == 0) goto L42763c;
+L427618:
+t9 = MEM_U8(a1 + -1);
+t8 = MEM_U8(a1 + -2);
+t0 = t9 << 8;
+v1 = v0 < a0;
+t1 = t8 + t0;
+a1 = a1 + 0xfffffffe;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+a0 = a0 + 0xfffffffe;
+if (v1 != 0) goto L427618;
+L42763c:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_427644(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 1;
+a0 = a0 + t6;
+t7 = a2 << 1;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffe;
+if (v1 == 0) goto L427688;
+L427664:
+t9 = MEM_U8(a1 + -2);
+t8 = MEM_U8(a1 + -1);
+t0 = t9 << 8;
+v1 = v0 < a0;
+t1 = t8 + t0;
+a1 = a1 + 0xfffffffe;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+a0 = a0 + 0xfffffffe;
+if (v1 != 0) goto L427664;
+L427688:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_427690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L427828;
+L4276d4:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 6);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 5);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 4);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 3);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 2);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 1);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L4276d4;
+L427828:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_427840(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L4279d8;
+L427884:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 1);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 2);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 3);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 4);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 5);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 6);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L427884;
+L4279d8:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4279f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 5;
+t7 = a2 << 3;
+s1 = a0 + t6;
+t7 = t7 - a2;
+// fdead 400581e3 MEM_U32(sp + 28) = s2;
+// fdead 400581e3 MEM_U32(sp + 20) = s0;
+t7 = t7 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffe0;
+if (a3 == 0) goto L4281c4;
+L427a3c:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffc8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 54);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 53);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 52);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 51);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 50);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 49);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 48);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 28) = t1;
+//nop;
+a1 = MEM_U8(s0 + 47);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 46);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 45);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 44);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 43);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 42);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 41);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 40);
+// bdead 400e0811 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 20) = t7;
+//nop;
+a1 = MEM_U8(s0 + 39);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 38);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 37);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 36);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 35);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 34);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t3 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 33);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 32);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 16) = t1;
+//nop;
+a1 = MEM_U8(s0 + 31);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 30);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 29);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 28);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 27);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 26);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 25);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 24);
+// bdead 400e0811 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 12) = t7;
+//nop;
+a1 = MEM_U8(s0 + 23);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 22);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 21);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 20);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 19);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 18);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t3 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 17);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 16);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 8) = t1;
+//nop;
+a1 = MEM_U8(s0 + 15);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 14);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 13);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 12);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 11);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 10);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 9);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 8);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 4) = t7;
+t8 = MEM_U8(s0 + 7);
+t0 = MEM_U8(s0 + 6);
+t9 = t8 << 8;
+t4 = MEM_U8(s0 + 5);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t7 = MEM_U8(s0 + 4);
+t5 = t2 + t4;
+t6 = t5 << 8;
+t3 = t7 + t6;
+MEM_U32(s1 + 24) = t3;
+t8 = MEM_U8(s0 + 3);
+t0 = MEM_U8(s0 + 2);
+t9 = t8 << 8;
+t4 = MEM_U8(s0 + 1);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(s0 + 0);
+t5 = t2 + t4;
+t7 = t5 << 8;
+a3 = s2 < s1;
+t3 = t6 + t7;
+MEM_U32(s1 + 0) = t3;
+s1 = s1 + 0xffffffe0;
+if (a3 != 0) goto L427a3c;
+L4281c4:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4281dc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 5;
+t7 = a2 << 3;
+s1 = a0 + t6;
+t7 = t7 - a2;
+// fdead 400581e3 MEM_U32(sp + 28) = s2;
+// fdead 400581e3 MEM_U32(sp + 20) = s0;
+t7 = t7 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffe0;
+if (a3 == 0) goto L4289b0;
+L428228:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xffffffc8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 49);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 50);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 51);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 52);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 53);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 54);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 55);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 28) = t1;
+//nop;
+a1 = MEM_U8(s0 + 40);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 41);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 42);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 43);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 44);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 45);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 46);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 47);
+// bdead 400e0811 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 20) = t7;
+//nop;
+a1 = MEM_U8(s0 + 32);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 33);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 34);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 35);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 36);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 37);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t3 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 38);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 39);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 16) = t1;
+//nop;
+a1 = MEM_U8(s0 + 24);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 25);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 26);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 27);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 28);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 29);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 30);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 31);
+// bdead 400e0811 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 12) = t7;
+//nop;
+a1 = MEM_U8(s0 + 16);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 17);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 18);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 19);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 20);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 21);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t3 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 22);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 23);
+// bdead 400e4011 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+MEM_U32(s1 + 8) = t1;
+//nop;
+a1 = MEM_U8(s0 + 8);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 9);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 10);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 11);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 12);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 13);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 14);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 15);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+t7 = t2 + v1;
+MEM_U32(s1 + 4) = t7;
+t8 = MEM_U8(s0 + 4);
+t0 = MEM_U8(s0 + 5);
+t9 = t8 << 8;
+t4 = MEM_U8(s0 + 6);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t7 = MEM_U8(s0 + 7);
+t5 = t2 + t4;
+t6 = t5 << 8;
+t3 = t7 + t6;
+MEM_U32(s1 + 24) = t3;
+t8 = MEM_U8(s0 + 0);
+t0 = MEM_U8(s0 + 1);
+t9 = t8 << 8;
+t4 = MEM_U8(s0 + 2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(s0 + 3);
+t5 = t2 + t4;
+t7 = t5 << 8;
+a3 = s2 < s1;
+t3 = t6 + t7;
+MEM_U32(s1 + 0) = t3;
+s1 = s1 + 0xffffffe0;
+if (a3 != 0) goto L428228;
+L4289b0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4289c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 4;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 4;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff0;
+if (a3 == 0) goto L428bb0;
+L428a0c:
+t8 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff0;
+MEM_U8(s1 + 15) = (uint8_t)t8;
+t9 = MEM_U8(s0 + 14);
+a0 = 0x0;
+MEM_U8(s1 + 14) = (uint8_t)t9;
+t0 = MEM_U8(s0 + 13);
+a2 = 0x0;
+MEM_U8(s1 + 13) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 12);
+a3 = 0x8;
+MEM_U8(s1 + 12) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 11);
+t4 = MEM_U8(s0 + 10);
+t3 = t2 << 8;
+t7 = MEM_U8(s0 + 9);
+t5 = t3 + t4;
+t6 = t5 << 8;
+t0 = MEM_U8(s0 + 8);
+t8 = t6 + t7;
+t9 = t8 << 8;
+t1 = t0 + t9;
+MEM_U32(s1 + 8) = t1;
+//nop;
+a1 = MEM_U8(s0 + 7);
+//nop;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 6);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 5);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 4);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 3);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 2);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 1);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff0;
+MEM_U32(s1 + 16) = t4;
+MEM_U32(s1 + 20) = t5;
+if (a3 != 0) goto L428a0c;
+L428bb0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_428bc8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 4;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 4;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff0;
+if (a3 == 0) goto L428db0;
+L428c0c:
+t8 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff0;
+MEM_U8(s1 + 15) = (uint8_t)t8;
+t9 = MEM_U8(s0 + 14);
+a0 = 0x0;
+MEM_U8(s1 + 14) = (uint8_t)t9;
+t0 = MEM_U8(s0 + 13);
+a2 = 0x0;
+MEM_U8(s1 + 13) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 12);
+a3 = 0x8;
+MEM_U8(s1 + 12) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 8);
+t4 = MEM_U8(s0 + 9);
+t3 = t2 << 8;
+t7 = MEM_U8(s0 + 10);
+t5 = t3 + t4;
+t6 = t5 << 8;
+t0 = MEM_U8(s0 + 11);
+t8 = t6 + t7;
+t9 = t8 << 8;
+t1 = t0 + t9;
+MEM_U32(s1 + 8) = t1;
+//nop;
+a1 = MEM_U8(s0 + 0);
+//nop;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 1);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 2);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 3);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 4);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 5);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 6);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff0;
+MEM_U32(s1 + 16) = t4;
+MEM_U32(s1 + 20) = t5;
+if (a3 != 0) goto L428c0c;
+L428db0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_428dc8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+v0 = a2 << 2;
+sp = sp + 0xffffffd8;
+v0 = v0 - a2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+v0 = v0 << 3;
+s1 = a0 + v0;
+// fdead 400401eb MEM_U32(sp + 28) = s2;
+// fdead 400401eb MEM_U32(sp + 20) = s0;
+a3 = a0 < s1;
+// fdead 400401eb MEM_U32(sp + 36) = ra;
+// fdead 400401eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v0;
+s1 = s1 + 0xffffffe8;
+if (a3 == 0) goto L4290fc;
+L428e10:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffe8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 22);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 21);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 20);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 19);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 18);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 17);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 16);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 16) = t8;
+MEM_U32(s1 + 20) = t9;
+t0 = MEM_U8(s0 + 15);
+a0 = 0x0;
+MEM_U8(s1 + 15) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 14);
+a2 = 0x0;
+MEM_U8(s1 + 14) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 13);
+a3 = 0x8;
+MEM_U8(s1 + 13) = (uint8_t)t2;
+t4 = MEM_U8(s0 + 12);
+//nop;
+MEM_U8(s1 + 12) = (uint8_t)t4;
+t5 = MEM_U8(s0 + 11);
+t6 = MEM_U8(s0 + 10);
+t3 = t5 << 8;
+t9 = MEM_U8(s0 + 9);
+t7 = t3 + t6;
+t8 = t7 << 8;
+t2 = MEM_U8(s0 + 8);
+t0 = t8 + t9;
+t1 = t0 << 8;
+t4 = t2 + t1;
+MEM_U32(s1 + 8) = t4;
+//nop;
+a1 = MEM_U8(s0 + 7);
+//nop;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 6);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 5);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 4);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 3);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 2);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 1);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 0);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+t7 = t1 + v1;
+at = t7 < v1;
+t4 = (int)t1 >> 31;
+t6 = at + t4;
+t6 = t6 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xffffffe8;
+MEM_U32(s1 + 24) = t6;
+MEM_U32(s1 + 28) = t7;
+if (a3 != 0) goto L428e10;
+L4290fc:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_429114(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+v0 = a2 << 2;
+sp = sp + 0xffffffd8;
+v0 = v0 - a2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+v0 = v0 << 3;
+s1 = a0 + v0;
+// fdead 400401eb MEM_U32(sp + 28) = s2;
+// fdead 400401eb MEM_U32(sp + 20) = s0;
+a3 = a0 < s1;
+// fdead 400401eb MEM_U32(sp + 36) = ra;
+// fdead 400401eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v0;
+s1 = s1 + 0xffffffe8;
+if (a3 == 0) goto L429448;
+L42915c:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xffffffe8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 17);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 18);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 19);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 20);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 21);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 22);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 23);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 16) = t8;
+MEM_U32(s1 + 20) = t9;
+t0 = MEM_U8(s0 + 15);
+a0 = 0x0;
+MEM_U8(s1 + 15) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 14);
+a2 = 0x0;
+MEM_U8(s1 + 14) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 13);
+a3 = 0x8;
+MEM_U8(s1 + 13) = (uint8_t)t2;
+t4 = MEM_U8(s0 + 12);
+//nop;
+MEM_U8(s1 + 12) = (uint8_t)t4;
+t5 = MEM_U8(s0 + 8);
+t6 = MEM_U8(s0 + 9);
+t3 = t5 << 8;
+t9 = MEM_U8(s0 + 10);
+t7 = t3 + t6;
+t8 = t7 << 8;
+t2 = MEM_U8(s0 + 11);
+t0 = t8 + t9;
+t1 = t0 << 8;
+t4 = t2 + t1;
+MEM_U32(s1 + 8) = t4;
+//nop;
+a1 = MEM_U8(s0 + 0);
+//nop;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 1);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 2);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 3);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 4);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 5);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 6);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 7);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+t7 = t1 + v1;
+at = t7 < v1;
+t4 = (int)t1 >> 31;
+t6 = at + t4;
+t6 = t6 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xffffffe8;
+MEM_U32(s1 + 24) = t6;
+MEM_U32(s1 + 28) = t7;
+if (a3 != 0) goto L42915c;
+L429448:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_429460(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 6;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 6;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffc0;
+if (a3 == 0) goto L429cfc;
+L4294a4:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffc0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 62);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 61);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 60);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 59);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 58);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 57);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 56);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 56) = t0;
+MEM_U32(s1 + 60) = t1;
+//nop;
+a1 = MEM_U8(s0 + 55);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 54);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 53);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 52);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 51);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 50);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 49);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 48);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+MEM_U32(s1 + 48) = t4;
+MEM_U32(s1 + 52) = t5;
+t6 = MEM_U8(s0 + 47);
+t8 = MEM_U8(s0 + 46);
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 45);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t4 = MEM_U8(s0 + 44);
+t2 = t1 + t9;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(s1 + 44) = t5;
+t6 = MEM_U8(s0 + 43);
+t8 = MEM_U8(s0 + 42);
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 41);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t3 = MEM_U8(s0 + 40);
+t2 = t1 + t9;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(s1 + 40) = t5;
+//nop;
+a1 = MEM_U8(s0 + 39);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 38);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 37);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 36);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 35);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 34);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 33);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 32);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 32) = t8;
+MEM_U32(s1 + 36) = t9;
+//nop;
+a1 = MEM_U8(s0 + 31);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 30);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t1 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 29);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 28);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 27);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 26);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 25);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 24);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+t3 = t7 + v1;
+at = t3 < v1;
+t0 = (int)t7 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 24) = t2;
+MEM_U32(s1 + 28) = t3;
+//nop;
+a1 = MEM_U8(s0 + 23);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 22);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t5 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 21);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 20);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 19);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 18);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 17);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 16);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+t7 = t1 + v1;
+at = t7 < v1;
+t4 = (int)t1 >> 31;
+t6 = at + t4;
+t6 = t6 + v0;
+MEM_U32(s1 + 16) = t6;
+MEM_U32(s1 + 20) = t7;
+//nop;
+a1 = MEM_U8(s0 + 15);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 14);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 13);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 12);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 11);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 10);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 9);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 8);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+t2 = MEM_U8(s0 + 7);
+t4 = MEM_U8(s0 + 6);
+t3 = t2 << 8;
+t5 = MEM_U8(s0 + 5);
+t6 = t3 + t4;
+t7 = t6 << 8;
+t0 = MEM_U8(s0 + 4);
+t8 = t7 + t5;
+t9 = t8 << 8;
+t1 = t0 + t9;
+MEM_U32(s1 + 4) = t1;
+t2 = MEM_U8(s0 + 3);
+t4 = MEM_U8(s0 + 2);
+t3 = t2 << 8;
+t5 = MEM_U8(s0 + 1);
+t6 = t3 + t4;
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 0);
+t8 = t7 + t5;
+t0 = t8 << 8;
+a3 = s2 < s1;
+t1 = t9 + t0;
+MEM_U32(s1 + 0) = t1;
+s1 = s1 + 0xffffffc0;
+if (a3 != 0) goto L4294a4;
+L429cfc:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_429d14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 6;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 6;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xffffffc0;
+if (a3 == 0) goto L42a5b0;
+L429d58:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xffffffc0;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 57);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 58);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 59);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 60);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 61);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 62);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 63);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 56) = t0;
+MEM_U32(s1 + 60) = t1;
+//nop;
+a1 = MEM_U8(s0 + 48);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 49);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t3 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 50);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 51);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 52);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 53);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 54);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 55);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t5 = t9 + v1;
+at = t5 < v1;
+t2 = (int)t9 >> 31;
+t4 = at + t2;
+t4 = t4 + v0;
+MEM_U32(s1 + 48) = t4;
+MEM_U32(s1 + 52) = t5;
+t6 = MEM_U8(s0 + 44);
+t8 = MEM_U8(s0 + 45);
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 46);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t4 = MEM_U8(s0 + 47);
+t2 = t1 + t9;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(s1 + 44) = t5;
+t6 = MEM_U8(s0 + 40);
+t8 = MEM_U8(s0 + 41);
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 42);
+t0 = t7 + t8;
+t1 = t0 << 8;
+t3 = MEM_U8(s0 + 43);
+t2 = t1 + t9;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(s1 + 40) = t5;
+//nop;
+a1 = MEM_U8(s0 + 32);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 33);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 34);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 35);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 36);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 37);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 38);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 39);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 32) = t8;
+MEM_U32(s1 + 36) = t9;
+//nop;
+a1 = MEM_U8(s0 + 24);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 25);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t1 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 26);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 27);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 28);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 29);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 30);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 31);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+t3 = t7 + v1;
+at = t3 < v1;
+t0 = (int)t7 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 24) = t2;
+MEM_U32(s1 + 28) = t3;
+//nop;
+a1 = MEM_U8(s0 + 16);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 17);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t5 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 18);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 19);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 20);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 21);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 22);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 23);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+t7 = t1 + v1;
+at = t7 < v1;
+t4 = (int)t1 >> 31;
+t6 = at + t4;
+t6 = t6 + v0;
+MEM_U32(s1 + 16) = t6;
+MEM_U32(s1 + 20) = t7;
+//nop;
+a1 = MEM_U8(s0 + 8);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 9);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 10);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 11);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 12);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 13);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 14);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 15);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+t1 = t5 + v1;
+at = t1 < v1;
+t8 = (int)t5 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+t2 = MEM_U8(s0 + 4);
+t4 = MEM_U8(s0 + 5);
+t3 = t2 << 8;
+t5 = MEM_U8(s0 + 6);
+t6 = t3 + t4;
+t7 = t6 << 8;
+t0 = MEM_U8(s0 + 7);
+t8 = t7 + t5;
+t9 = t8 << 8;
+t1 = t0 + t9;
+MEM_U32(s1 + 4) = t1;
+t2 = MEM_U8(s0 + 0);
+t4 = MEM_U8(s0 + 1);
+t3 = t2 << 8;
+t5 = MEM_U8(s0 + 2);
+t6 = t3 + t4;
+t7 = t6 << 8;
+t9 = MEM_U8(s0 + 3);
+t8 = t7 + t5;
+t0 = t8 << 8;
+a3 = s2 < s1;
+t1 = t9 + t0;
+MEM_U32(s1 + 0) = t1;
+s1 = s1 + 0xffffffc0;
+if (a3 != 0) goto L429d58;
+L42a5b0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42a5c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42a624;
+L42a5e8:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42a5e8;
+L42a624:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42a62c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42a688;
+L42a64c:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42a64c;
+L42a688:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42a690(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+v0 = a0 < s1;
+// fdead 400581eb MEM_U32(sp + 36) = ra;
+// fdead 400581eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (v0 == 0) goto L42a828;
+L42a6d4:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 6);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 5);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 4);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 3);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 2);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 1);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+v0 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (v0 != 0) goto L42a6d4;
+L42a828:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42a840(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+v0 = a0 < s1;
+// fdead 400581eb MEM_U32(sp + 36) = ra;
+// fdead 400581eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (v0 == 0) goto L42a9d8;
+L42a884:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 1);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 2);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 3);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 4);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 5);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 6);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+v0 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (v0 != 0) goto L42a884;
+L42a9d8:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42a9f0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+v0 = a2 << 2;
+sp = sp + 0xffffffd8;
+v0 = v0 - a2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+v0 = v0 << 3;
+s1 = a0 + v0;
+// fdead 400401eb MEM_U32(sp + 28) = s2;
+// fdead 400401eb MEM_U32(sp + 20) = s0;
+a3 = a0 < s1;
+// fdead 400401eb MEM_U32(sp + 36) = ra;
+// fdead 400401eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v0;
+s1 = s1 + 0xffffffe8;
+if (a3 == 0) goto L42ad20;
+L42aa38:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffe8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 22);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 21);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 20);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 19);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 18);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 17);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 16);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 16) = t8;
+MEM_U32(s1 + 20) = t9;
+//nop;
+a1 = MEM_U8(s0 + 15);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 14);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t1 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 13);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 12);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 11);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 10);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 9);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 8);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+t3 = t7 + v1;
+at = t3 < v1;
+t0 = (int)t7 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 8) = t2;
+MEM_U32(s1 + 12) = t3;
+t5 = MEM_U8(s0 + 7);
+t4 = MEM_U8(s0 + 6);
+t6 = t5 << 8;
+t8 = t4 + t6;
+MEM_U16(s1 + 6) = (uint16_t)t8;
+t9 = MEM_U8(s0 + 5);
+a3 = s2 < s1;
+MEM_U8(s1 + 5) = (uint8_t)t9;
+t7 = MEM_U8(s0 + 4);
+s1 = s1 + 0xffffffe8;
+MEM_U8(s1 + 28) = (uint8_t)t7;
+t0 = MEM_U8(s0 + 3);
+t2 = MEM_U8(s0 + 2);
+t1 = t0 << 8;
+t4 = MEM_U8(s0 + 1);
+t3 = t1 + t2;
+t5 = t3 << 8;
+t9 = MEM_U8(s0 + 0);
+t6 = t5 + t4;
+t8 = t6 << 8;
+t7 = t9 + t8;
+MEM_U32(s1 + 24) = t7;
+if (a3 != 0) goto L42aa38;
+L42ad20:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42ad38(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+v0 = a2 << 2;
+sp = sp + 0xffffffd8;
+v0 = v0 - a2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+v0 = v0 << 3;
+s1 = a0 + v0;
+// fdead 400401eb MEM_U32(sp + 28) = s2;
+// fdead 400401eb MEM_U32(sp + 20) = s0;
+a3 = a0 < s1;
+// fdead 400401eb MEM_U32(sp + 36) = ra;
+// fdead 400401eb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v0;
+s1 = s1 + 0xffffffe8;
+if (a3 == 0) goto L42b068;
+L42ad80:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xffffffe8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 17);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t7 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 18);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 19);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 20);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 21);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+a1 = t7 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t7 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 22);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 23);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+t9 = t3 + v1;
+at = t9 < v1;
+t6 = (int)t3 >> 31;
+t8 = at + t6;
+t8 = t8 + v0;
+MEM_U32(s1 + 16) = t8;
+MEM_U32(s1 + 20) = t9;
+//nop;
+a1 = MEM_U8(s0 + 8);
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 9);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t1 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 10);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U8(s0 + 11);
+// bdead 400e4019 gp = MEM_U32(sp + 32);
+a1 = t5 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t5 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t0 = MEM_U8(s0 + 12);
+// bdead 400e0219 gp = MEM_U32(sp + 32);
+a1 = t0 + v1;
+//nop;
+at = a1 < v1;
+t2 = (int)t0 >> 31;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U8(s0 + 13);
+// bdead 400e0419 gp = MEM_U32(sp + 32);
+a1 = t1 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t1 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U8(s0 + 14);
+// bdead 400e8019 gp = MEM_U32(sp + 32);
+a1 = t6 + v1;
+//nop;
+at = a1 < v1;
+t8 = (int)t6 >> 31;
+a0 = at + t8;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t7 = MEM_U8(s0 + 15);
+// bdead 400f0019 gp = MEM_U32(sp + 32);
+t3 = t7 + v1;
+at = t3 < v1;
+t0 = (int)t7 >> 31;
+t2 = at + t0;
+t2 = t2 + v0;
+MEM_U32(s1 + 8) = t2;
+MEM_U32(s1 + 12) = t3;
+t5 = MEM_U8(s0 + 6);
+t4 = MEM_U8(s0 + 7);
+t6 = t5 << 8;
+t8 = t4 + t6;
+MEM_U16(s1 + 6) = (uint16_t)t8;
+t9 = MEM_U8(s0 + 5);
+a3 = s2 < s1;
+MEM_U8(s1 + 5) = (uint8_t)t9;
+t7 = MEM_U8(s0 + 4);
+s1 = s1 + 0xffffffe8;
+MEM_U8(s1 + 28) = (uint8_t)t7;
+t0 = MEM_U8(s0 + 0);
+t2 = MEM_U8(s0 + 1);
+t1 = t0 << 8;
+t4 = MEM_U8(s0 + 2);
+t3 = t1 + t2;
+t5 = t3 << 8;
+t9 = MEM_U8(s0 + 3);
+t6 = t5 + t4;
+t8 = t6 << 8;
+t7 = t9 + t8;
+MEM_U32(s1 + 24) = t7;
+if (a3 != 0) goto L42ad80;
+L42b068:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42b080(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42b0dc;
+L42b0a0:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42b0a0;
+L42b0dc:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42b0e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42b140;
+L42b104:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42b104;
+L42b140:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42b148(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L42b2e0;
+L42b18c:
+//nop;
+a1 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 6);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 5);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 4);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 3);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 2);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 1);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 0);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L42b18c;
+L42b2e0:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42b2f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001e3 MEM_U32(sp + 24) = s1;
+t6 = a2 << 3;
+s1 = a0 + t6;
+// fdead 400481e3 MEM_U32(sp + 28) = s2;
+// fdead 400481e3 MEM_U32(sp + 20) = s0;
+t7 = a2 << 3;
+a3 = a0 < s1;
+// fdead 400581e3 MEM_U32(sp + 36) = ra;
+// fdead 400581e3 MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + t7;
+s1 = s1 + 0xfffffff8;
+if (a3 == 0) goto L42b490;
+L42b33c:
+//nop;
+a1 = MEM_U8(s0 + -8);
+s0 = s0 + 0xfffffff8;
+a0 = 0x0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 1);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t0 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U8(s0 + 2);
+// bdead 400e0819 gp = MEM_U32(sp + 32);
+a1 = t2 + v1;
+//nop;
+at = a1 < v1;
+t4 = (int)t2 >> 31;
+a0 = at + t4;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U8(s0 + 3);
+// bdead 400e1019 gp = MEM_U32(sp + 32);
+a1 = t3 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t3 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U8(s0 + 4);
+// bdead 420e0019 gp = MEM_U32(sp + 32);
+a1 = t8 + v1;
+//nop;
+at = a1 < v1;
+t0 = (int)t8 >> 31;
+a0 = at + t0;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 5);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+a1 = t9 + v1;
+t2 = (int)t9 >> 31;
+//nop;
+at = a1 < v1;
+a0 = at + t2;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U8(s0 + 6);
+// bdead 400e2019 gp = MEM_U32(sp + 32);
+a1 = t4 + v1;
+//nop;
+at = a1 < v1;
+t6 = (int)t4 >> 31;
+a0 = at + t6;
+a0 = a0 + v0;
+a2 = 0x0;
+a3 = 0x8;
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U8(s0 + 7);
+// bdead 440e0019 gp = MEM_U32(sp + 32);
+t1 = t9 + v1;
+at = t1 < v1;
+t8 = (int)t9 >> 31;
+t0 = at + t8;
+t0 = t0 + v0;
+a3 = s2 < s1;
+s1 = s1 + 0xfffffff8;
+MEM_U32(s1 + 8) = t0;
+MEM_U32(s1 + 12) = t1;
+if (a3 != 0) goto L42b33c;
+L42b490:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+//nop;
+}
+
+static uint32_t f_elf_begin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L42b4ac:
+//elf_begin:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000498;
+sp = sp + 0xffffffd0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400280eb MEM_U32(sp + 28) = ra;
+// fdead 400280eb MEM_U32(sp + 24) = gp;
+a3 = a2;
+if (t6 != 0) goto L42b4f0;
+at = 0x100003e8;
+t7 = 0x602;
+v0 = zero;
+MEM_U32(at + 0) = t7;
+goto L42b850;
+L42b4f0:
+v0 = 0x1;
+if (a1 == 0) goto L42b524;
+a2 = 0x40;
+if (a1 == v0) goto L42b5cc;
+at = 0x2;
+if (a1 == at) {
+at = 0x7;
+goto L42b52c;}
+at = 0x7;
+t8 = 0x504;
+if (a1 == at) goto L42b5c4;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t8;
+goto L42b850;
+L42b524:
+v0 = zero;
+goto L42b850;
+L42b52c:
+//nop;
+a0 = 0x98;
+MEM_U32(sp + 48) = s0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+s0 = v0;
+if (v0 != 0) goto L42b55c;
+at = 0x100003e8;
+t9 = 0x40d;
+v0 = zero;
+MEM_U32(at + 0) = t9;
+goto L42b850;
+L42b55c:
+t0 = 0x10000340;
+t4 = s0;
+t0 = t0;
+t3 = t0 + 0x90;
+L42b56c:
+at = MEM_U32(t0 + 0);
+t0 = t0 + 0xc;
+MEM_U32(t4 + 0) = at;
+at = MEM_U32(t0 + -8);
+t4 = t4 + 0xc;
+MEM_U32(t4 + -8) = at;
+at = MEM_U32(t0 + -4);
+MEM_U32(t4 + -4) = at;
+if (t0 != t3) goto L42b56c;
+at = MEM_U32(t0 + 0);
+t6 = 0x1;
+MEM_U32(t4 + 0) = at;
+t3 = MEM_U32(t0 + 4);
+v0 = s0;
+MEM_U32(t4 + 4) = t3;
+t5 = MEM_U32(sp + 48);
+t7 = MEM_U32(s0 + 136);
+MEM_U32(s0 + 4) = t6;
+t8 = t7 | 0x80;
+MEM_U32(s0 + 136) = t8;
+MEM_U32(s0 + 8) = t5;
+goto L42b850;
+L42b5c4:
+a2 = 0xc0;
+goto L42b5cc;
+L42b5cc:
+//nop;
+if (a3 != 0) goto L42b5fc;
+//nop;
+a0 = s0;
+// fdead 420281ef t9 = t9;
+a1 = a2;
+v0 = func_42bae0(mem, sp, a0, a1);
+// bdead 6004000008b gp = MEM_U32(sp + 24);
+s0 = v0;
+if (v0 != 0) goto L42b66c;
+v0 = zero;
+goto L42b850;
+L42b5fc:
+t9 = MEM_U32(a3 + 136);
+t1 = 0x510;
+t2 = t9 & a2;
+//nop;
+if (a2 == t2) goto L42b620;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t1;
+goto L42b850;
+L42b620:
+t3 = MEM_U32(a3 + 76);
+//nop;
+//nop;
+if (v0 == t3) goto L42b644;
+t0 = MEM_U32(a3 + 4);
+v0 = a3;
+t4 = t0 + 0x1;
+MEM_U32(a3 + 4) = t4;
+goto L42b850;
+L42b644:
+//nop;
+a0 = s0;
+// bdead 400001a3 t9 = t9;
+a1 = a3;
+v0 = func_42b860(mem, sp, a0, a1, a2);
+// bdead 6004000008b gp = MEM_U32(sp + 24);
+s0 = v0;
+if (v0 != 0) goto L42b66c;
+v0 = zero;
+goto L42b850;
+L42b66c:
+t6 = MEM_U32(v0 + 52);
+t5 = 0x1;
+a3 = MEM_U32(v0 + 40);
+MEM_U32(v0 + 4) = t5;
+if (t6 < 0x10) goto L42b728;
+//nop;
+a0 = s0;
+a1 = zero;
+a2 = 0x10;
+MEM_U32(sp + 40) = a3;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002008b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+//nop;
+if (v0 != 0) goto L42b728;
+t7 = MEM_S8(a3 + 0);
+at = 0x7f;
+//nop;
+if (t7 != at) goto L42b728;
+t8 = MEM_S8(a3 + 1);
+at = 0x45;
+//nop;
+if (t8 != at) goto L42b728;
+t9 = MEM_S8(a3 + 2);
+at = 0x4c;
+//nop;
+if (t9 != at) goto L42b728;
+t2 = MEM_S8(a3 + 3);
+at = 0x46;
+t1 = 0x3;
+if (t2 != at) goto L42b728;
+MEM_U32(s0 + 76) = t1;
+t3 = MEM_S8(a3 + 4);
+t4 = 0x1;
+MEM_U32(s0 + 72) = t3;
+t0 = MEM_S8(a3 + 5);
+t5 = 0x10;
+MEM_U32(s0 + 64) = t0;
+v0 = MEM_S8(a3 + 6);
+//nop;
+MEM_U32(s0 + 68) = v0;
+if (v0 != 0) goto L42b71c;
+MEM_U32(s0 + 68) = t4;
+L42b71c:
+MEM_U32(s0 + 44) = t5;
+v0 = s0;
+goto L42b850;
+L42b728:
+t6 = MEM_U32(s0 + 52);
+a0 = s0;
+a1 = zero;
+if (t6 < 0x8) goto L42b7a8;
+//nop;
+a2 = 0x8;
+MEM_U32(sp + 40) = a3;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+a3 = MEM_U32(sp + 40);
+// bdead 600400201cb gp = MEM_U32(sp + 24);
+a0 = a3;
+if (v0 != 0) goto L42b7a8;
+a1 = 0x10002f30;
+//nop;
+a2 = 0x8;
+a1 = a1;
+v0 = wrapper_memcmp(mem, a0, a1, a2);
+// bdead 600400201cb gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42b7a8;
+//nop;
+a0 = s0;
+//nop;
+f__elf_arinit(mem, sp, a0);
+// bdead 20001 gp = MEM_U32(sp + 24);
+t7 = 0x1;
+t8 = 0x8;
+MEM_U32(s0 + 76) = t7;
+MEM_U32(s0 + 44) = t8;
+v0 = s0;
+goto L42b850;
+L42b7a8:
+v1 = 0x100004a0;
+//nop;
+t9 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L42b830;
+t2 = 0x100004a0;
+//nop;
+v0 = MEM_U32(t2 + 0);
+//nop;
+a0 = s0;
+L42b7d4:
+MEM_U32(sp + 36) = v1;
+fp_dest = v0;
+// bdead 600400201e3 t9 = v0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600400201cb gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+a0 = v0;
+if ((int)v0 <= 0) goto L42b7fc;
+MEM_U32(s0 + 76) = a0;
+v0 = s0;
+goto L42b850;
+L42b7fc:
+//nop;
+if (v0 == 0) goto L42b820;
+//nop;
+a0 = s0;
+//nop;
+f__elf_end(mem, sp, a0);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L42b850;
+L42b820:
+v0 = MEM_U32(v1 + 4);
+v1 = v1 + 0x4;
+a0 = s0;
+if (v0 != 0) goto L42b7d4;
+L42b830:
+v0 = MEM_U32(s0 + 52);
+MEM_U32(s0 + 76) = zero;
+MEM_U32(s0 + 44) = v0;
+if (v0 < 0x201) goto L42b84c;
+t1 = 0x200;
+MEM_U32(s0 + 44) = t1;
+L42b84c:
+v0 = s0;
+L42b850:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t func_42b860(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L42b860:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 56) = a2;
+t6 = MEM_U32(a1 + 28);
+a3 = a1;
+MEM_U32(sp + 32) = t6;
+t8 = MEM_U32(a1 + 52);
+//nop;
+//nop;
+if (t6 < t8) goto L42b8a8;
+v0 = zero;
+goto L42bad0;
+L42b8a8:
+v0 = MEM_U32(a3 + 8);
+at = 0xffffffff;
+t2 = 0x503;
+if (v0 != at) goto L42b8c0;
+t9 = 0xffffffff;
+MEM_U32(sp + 48) = t9;
+L42b8c0:
+t0 = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 48);
+t1 = t0 & 0x80;
+//nop;
+if (t1 == 0) goto L42b8e4;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t2;
+goto L42bad0;
+L42b8e4:
+a0 = a3;
+if (t3 == v0) goto L42b900;
+at = 0x100003e8;
+t4 = 0x502;
+v0 = zero;
+MEM_U32(at + 0) = t4;
+goto L42bad0;
+L42b900:
+//nop;
+a1 = MEM_U32(sp + 32);
+a2 = 0x3c;
+MEM_U32(sp + 52) = a3;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+a3 = MEM_U32(sp + 52);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a0 = a3;
+if (v0 != 0) goto L42b950;
+t5 = MEM_U32(a3 + 40);
+t6 = MEM_U32(a3 + 28);
+//nop;
+a2 = MEM_U32(a3 + 52);
+MEM_U32(sp + 52) = a3;
+a1 = t5 + t6;
+v0 = f__elf_armem(mem, sp, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 52);
+a1 = v0;
+if (v0 != 0) goto L42b958;
+L42b950:
+v0 = zero;
+goto L42bad0;
+L42b958:
+v1 = MEM_U32(a3 + 28);
+t7 = MEM_U32(a3 + 52);
+t9 = MEM_U32(v0 + 20);
+v1 = v1 + 0x3c;
+t8 = t7 - v1;
+a0 = 0x98;
+if (t8 >= t9) goto L42b98c;
+at = 0x100003e8;
+t0 = 0x204;
+v0 = zero;
+MEM_U32(at + 0) = t0;
+goto L42bad0;
+L42b98c:
+//nop;
+MEM_U32(sp + 36) = v1;
+MEM_U32(sp + 40) = a1;
+MEM_U32(sp + 52) = a3;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+a1 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 52);
+a2 = v0;
+if (v0 != 0) goto L42b9cc;
+at = 0x100003e8;
+t1 = 0x40d;
+v0 = zero;
+MEM_U32(at + 0) = t1;
+goto L42bad0;
+L42b9cc:
+t2 = 0x10000340;
+t6 = v0;
+t2 = t2;
+t5 = t2 + 0x90;
+L42b9dc:
+at = MEM_U32(t2 + 0);
+t2 = t2 + 0xc;
+MEM_U32(t6 + 0) = at;
+at = MEM_U32(t2 + -8);
+t6 = t6 + 0xc;
+MEM_U32(t6 + -8) = at;
+at = MEM_U32(t2 + -4);
+MEM_U32(t6 + -4) = at;
+if (t2 != t5) goto L42b9dc;
+at = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t6 + 0) = at;
+t5 = MEM_U32(t2 + 4);
+//nop;
+MEM_U32(t6 + 4) = t5;
+t7 = MEM_U32(a3 + 4);
+//nop;
+t8 = t7 + 0x1;
+MEM_U32(a3 + 4) = t8;
+MEM_U32(v0 + 0) = a3;
+t9 = MEM_U32(sp + 48);
+t0 = MEM_U32(v0 + 136);
+MEM_U32(v0 + 8) = t9;
+t1 = MEM_U32(sp + 56);
+MEM_U32(v0 + 108) = a1;
+t4 = t0 | t1;
+MEM_U32(v0 + 136) = t4;
+t3 = MEM_U32(a1 + 20);
+t8 = 0x1;
+MEM_U32(v0 + 52) = t3;
+t5 = MEM_U32(a3 + 16);
+t6 = t3 + v1;
+t7 = t3 & 0x1;
+t9 = t6 + t7;
+t2 = t5 + v1;
+MEM_U32(v0 + 16) = t2;
+MEM_U32(v0 + 20) = v1;
+MEM_U32(v0 + 24) = t9;
+t0 = MEM_U32(a3 + 32);
+MEM_U32(a3 + 28) = t9;
+MEM_U32(v0 + 32) = t0;
+t1 = MEM_U32(a3 + 36);
+//nop;
+MEM_U32(v0 + 36) = t1;
+t4 = MEM_U32(a3 + 56);
+//nop;
+MEM_U32(v0 + 56) = t4;
+t3 = MEM_U32(a3 + 60);
+//nop;
+MEM_U32(v0 + 60) = t3;
+t5 = MEM_U32(a3 + 40);
+//nop;
+t2 = t5 + v1;
+MEM_U32(v0 + 40) = t2;
+t7 = MEM_U32(a3 + 132);
+t6 = MEM_U32(a3 + 28);
+//nop;
+//nop;
+if (t6 != t7) goto L42bacc;
+MEM_U32(v0 + 12) = t8;
+L42bacc:
+v0 = a2;
+L42bad0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static uint32_t func_42bae0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0;
+L42bae0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+a0 = 0x98;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = v0;
+if (v0 != 0) goto L42bb2c;
+at = 0x100003e8;
+t6 = 0x40d;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+goto L42bbd4;
+L42bb2c:
+t7 = 0x10000340;
+t1 = a0;
+t7 = t7;
+t0 = t7 + 0x90;
+L42bb3c:
+at = MEM_U32(t7 + 0);
+t7 = t7 + 0xc;
+MEM_U32(t1 + 0) = at;
+at = MEM_U32(t7 + -8);
+t1 = t1 + 0xc;
+MEM_U32(t1 + -8) = at;
+at = MEM_U32(t7 + -4);
+MEM_U32(t1 + -4) = at;
+if (t7 != t0) goto L42bb3c;
+at = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t1 + 0) = at;
+t0 = MEM_U32(t7 + 4);
+//nop;
+MEM_U32(t1 + 4) = t0;
+t2 = MEM_U32(sp + 40);
+t3 = MEM_U32(a0 + 136);
+MEM_U32(a0 + 8) = t2;
+t4 = MEM_U32(sp + 44);
+//nop;
+t5 = t3 | t4;
+MEM_U32(a0 + 136) = t5;
+//nop;
+MEM_U32(sp + 36) = a0;
+//nop;
+v0 = f__elf_inmap(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+if (v0 == 0) {
+v0 = a0;
+goto L42bbd4;}
+v0 = a0;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L42bbd4;
+// fdead 0 v0 = a0;
+L42bbd4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t f_elf32_getehdr(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0;
+L42bbec:
+//elf32_getehdr:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L42bc10;
+v0 = zero;
+goto L42bc74;
+L42bc10:
+v0 = MEM_U32(a0 + 72);
+v1 = 0x1;
+//nop;
+if (v1 == v0) goto L42bc40;
+t6 = 0x505;
+if (v0 != 0) goto L42bc30;
+MEM_U32(a0 + 72) = v1;
+goto L42bc40;
+L42bc30:
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+goto L42bc74;
+L42bc40:
+v1 = MEM_U32(a0 + 80);
+//nop;
+v0 = v1;
+if (v1 != 0) goto L42bc74;
+//nop;
+MEM_U32(sp + 32) = a0;
+//nop;
+f__elf_cook(mem, sp, a0);
+a0 = MEM_U32(sp + 32);
+// bdead 21 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(a0 + 80);
+//nop;
+v0 = v1;
+L42bc74:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f__elf_end(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0,
+t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L42bd20:
+//_elf_end:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+// fdead 4000002b MEM_U32(sp + 32) = s3;
+s4 = a0;
+// fdead 4020002b MEM_U32(sp + 44) = ra;
+// fdead 4020002b MEM_U32(sp + 40) = gp;
+// fdead 4020002b MEM_U32(sp + 28) = s2;
+// fdead 4020002b MEM_U32(sp + 24) = s1;
+// fdead 4020002b MEM_U32(sp + 20) = s0;
+s3 = zero;
+if (a0 != 0) goto L42bd60;
+// bdead 1 v0 = zero;
+goto L42c0e4;
+L42bd60:
+t6 = MEM_U32(s4 + 4);
+//nop;
+t7 = t6 + 0xffffffff;
+MEM_U32(s4 + 4) = t7;
+if (t7 == 0) goto L42bd7c;
+// bdead 1 v0 = t7;
+goto L42c0e4;
+L42bd7c:
+v0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+if (v0 == 0) goto L42bd9c;
+t8 = MEM_U32(v0 + 4);
+//nop;
+t9 = t8 + 0xffffffff;
+MEM_U32(v0 + 4) = t9;
+L42bd9c:
+s2 = MEM_U32(s4 + 96);
+//nop;
+//nop;
+if (s2 == 0) goto L42bec4;
+L42bdac:
+s1 = MEM_U32(s2 + 8);
+//nop;
+//nop;
+if (s1 == 0) goto L42be7c;
+L42bdbc:
+a0 = MEM_U32(s1 + 52);
+//nop;
+//nop;
+if (a0 == 0) goto L42bde4;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 403c0003 gp = MEM_U32(sp + 40);
+//nop;
+L42bde4:
+s0 = MEM_U32(s1 + 32);
+//nop;
+//nop;
+if (s0 == 0) goto L42be48;
+a0 = MEM_U32(s0 + 52);
+//nop;
+//nop;
+if (a0 == 0) goto L42be1c;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+//nop;
+L42be1c:
+t0 = MEM_U32(s0 + 60);
+//nop;
+t1 = t0 & 0x1;
+//nop;
+if (t1 == 0) goto L42be48;
+//nop;
+a0 = s0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 403c0003 gp = MEM_U32(sp + 40);
+//nop;
+L42be48:
+t2 = MEM_U32(s1 + 60);
+s0 = MEM_U32(s1 + 28);
+t3 = t2 & 0x1;
+//nop;
+if (t3 == 0) goto L42be74;
+//nop;
+a0 = s1;
+//nop;
+wrapper_free(mem, a0);
+// bdead 403a0003 gp = MEM_U32(sp + 40);
+//nop;
+L42be74:
+s1 = s0;
+if (s0 != 0) goto L42bdbc;
+L42be7c:
+t4 = MEM_U32(s2 + 36);
+//nop;
+t5 = t4 & 0x1;
+//nop;
+if (t5 == 0) goto L42beb4;
+//nop;
+if (s3 == 0) goto L42beb0;
+//nop;
+a0 = s3;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+//nop;
+L42beb0:
+s3 = s2;
+L42beb4:
+s2 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+if (s2 != 0) goto L42bdac;
+L42bec4:
+//nop;
+if (s3 == 0) goto L42bee4;
+//nop;
+a0 = s3;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+//nop;
+L42bee4:
+s0 = MEM_U32(s4 + 104);
+//nop;
+//nop;
+if (s0 == 0) goto L42bf10;
+L42bef4:
+//nop;
+s3 = MEM_U32(s0 + 28);
+a0 = s0;
+wrapper_free(mem, a0);
+// bdead 40300003 gp = MEM_U32(sp + 40);
+s0 = s3;
+if (s3 != 0) goto L42bef4;
+L42bf10:
+v0 = MEM_U32(s4 + 136);
+//nop;
+t6 = v0 & 0x2;
+t9 = v0 & 0x4;
+if (t6 == 0) goto L42bf48;
+a0 = MEM_U32(s4 + 80);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s4 + 136);
+//nop;
+t9 = v0 & 0x4;
+L42bf48:
+t2 = v0 & 0x8;
+if (t9 == 0) goto L42bf74;
+a0 = MEM_U32(s4 + 84);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s4 + 136);
+//nop;
+t2 = v0 & 0x8;
+L42bf74:
+t5 = v0 & 0x20;
+if (t2 == 0) goto L42bfa0;
+a0 = MEM_U32(s4 + 92);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s4 + 136);
+//nop;
+t5 = v0 & 0x20;
+L42bfa0:
+t6 = v0 & 0x1;
+if (t5 == 0) goto L42bfc8;
+//nop;
+a0 = MEM_U32(s4 + 48);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s4 + 136);
+//nop;
+t6 = v0 & 0x1;
+L42bfc8:
+//nop;
+if (t6 == 0) goto L42bfe8;
+//nop;
+a0 = MEM_U32(s4 + 112);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+//nop;
+L42bfe8:
+t7 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L42c0b0;
+a0 = MEM_U32(s4 + 56);
+//nop;
+//nop;
+if (a0 == 0) goto L42c020;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+//nop;
+L42c020:
+a0 = MEM_U32(s4 + 40);
+//nop;
+//nop;
+if (a0 == 0) goto L42c048;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+//nop;
+L42c048:
+t8 = MEM_U32(s4 + 56);
+//nop;
+//nop;
+if (t8 == 0) goto L42c06c;
+v0 = MEM_U32(s4 + 136);
+//nop;
+t9 = v0 << 0;
+t0 = v0 << 2;
+if ((int)t9 >= 0) goto L42c090;
+L42c06c:
+//nop;
+// bdead 40200003 a0 = MEM_U32(s4 + 32);
+// bdead 40200003 a1 = MEM_U32(s4 + 36);
+//nop;
+f__elf_unmap(mem, sp);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s4 + 136);
+//nop;
+t0 = v0 << 2;
+L42c090:
+//nop;
+if ((int)t0 >= 0) goto L42c0b0;
+//nop;
+a0 = MEM_U32(s4 + 32);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+//nop;
+L42c0b0:
+//nop;
+a0 = s4;
+s4 = MEM_U32(s4 + 0);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+s3 = zero;
+if (s4 == 0) goto L42c0e0;
+t1 = MEM_U32(s4 + 4);
+//nop;
+//nop;
+if (t1 == 0) goto L42bd7c;
+L42c0e0:
+// bdead 1 v0 = zero;
+L42c0e4:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f__elf_vm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, t8 = 0, t9 = 0;
+L42c110:
+//_elf_vm:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb MEM_U32(sp + 36) = s4;
+// fdead 400001eb MEM_U32(sp + 32) = s3;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+v0 = MEM_U32(a0 + 52);
+s2 = a2;
+s4 = a0;
+if (a1 >= v0) goto L42c160;
+t6 = v0 - a1;
+//nop;
+if (t6 >= a2) goto L42c174;
+L42c160:
+at = 0x100003e8;
+t7 = 0x213;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t7;
+goto L42c3d0;
+L42c174:
+v1 = MEM_U32(s4 + 56);
+//nop;
+//nop;
+if (v1 != 0) goto L42c198;
+t8 = MEM_U32(s4 + 136);
+at = 0x80000000;
+t9 = t8 | at;
+//nop;
+if (t9 != 0) goto L42c1a0;
+L42c198:
+at = 0x20000;
+if (s2 != 0) goto L42c1a8;
+L42c1a0:
+v0 = zero;
+goto L42c3d0;
+L42c1a8:
+v0 = MEM_U32(s4 + 0);
+at = at + 0xffffffff;
+t5 = 0x1;
+if (v0 == 0) goto L42c1d0;
+t0 = MEM_U32(v0 + 8);
+a0 = 0xffffffff;
+//nop;
+if (a0 != t0) goto L42c1d0;
+v1 = MEM_U32(s4 + 56);
+MEM_U32(s4 + 8) = a0;
+L42c1d0:
+t1 = MEM_U32(s4 + 16);
+t8 = 0x1;
+a1 = a1 + t1;
+t3 = a1 & at;
+v0 = a1 + s2;
+t2 = a1 & 0xfff;
+v0 = v0 + 0xfff;
+at = 0x20000;
+s1 = a1 - t2;
+t4 = t3 >> 12;
+at = at + 0xffffffff;
+t6 = v0 & at;
+t0 = a1 >> 17;
+t2 = v0 >> 17;
+a0 = t5 << (t4 & 0x1f);
+t7 = t6 >> 12;
+t1 = t0 << 2;
+t3 = t2 << 2;
+t9 = t8 << (t7 & 0x1f);
+s3 = v1 + t1;
+t5 = v1 + t3;
+s0 = a0;
+MEM_U32(sp + 64) = t9;
+MEM_U32(sp + 68) = t5;
+s2 = zero;
+if (s3 != t5) goto L42c240;
+//nop;
+if (a0 == t9) goto L42c338;
+L42c240:
+v0 = MEM_U32(s3 + 0);
+//nop;
+t6 = v0 & s0;
+t3 = v0 | s0;
+if (t6 == 0) goto L42c2d8;
+a1 = s1;
+if (s2 == 0) goto L42c2d0;
+t7 = MEM_U32(s4 + 36);
+t8 = MEM_U32(s4 + 32);
+v0 = t7 - s1;
+a3 = t8 + s1;
+if (v0 >= s2) goto L42c278;
+s2 = v0;
+L42c278:
+//nop;
+a0 = MEM_U32(s4 + 8);
+MEM_U32(sp + 52) = a3;
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 52);
+// bdead 403e010b gp = MEM_U32(sp + 40);
+a1 = a3;
+if (v0 != s1) goto L42c2b8;
+//nop;
+a0 = MEM_U32(s4 + 8);
+a2 = s2;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 403e000b gp = MEM_U32(sp + 40);
+s1 = s1 + s2;
+if (v0 == s2) goto L42c2cc;
+L42c2b8:
+at = 0x100003e8;
+t0 = 0x306;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t0;
+goto L42c3d0;
+L42c2cc:
+s2 = zero;
+L42c2d0:
+s1 = s1 + 0x1000;
+goto L42c300;
+L42c2d8:
+t1 = MEM_U32(s4 + 8);
+s2 = s2 + 0x1000;
+//nop;
+if ((int)t1 >= 0) goto L42c2fc;
+at = 0x100003e8;
+t2 = 0x50e;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42c3d0;
+L42c2fc:
+MEM_U32(s3 + 0) = t3;
+L42c300:
+at = 0x80000000;
+t4 = MEM_U32(sp + 68);
+t5 = s0 << 1;
+if (s0 != at) goto L42c31c;
+s0 = 0x1;
+s3 = s3 + 0x4;
+goto L42c320;
+L42c31c:
+s0 = t5;
+L42c320:
+//nop;
+if (s3 != t4) goto L42c240;
+t9 = MEM_U32(sp + 64);
+//nop;
+//nop;
+if (s0 != t9) goto L42c240;
+L42c338:
+v0 = zero;
+if (s2 == 0) goto L42c3d0;
+a0 = MEM_U32(s4 + 8);
+t6 = 0x50e;
+a1 = s1;
+if ((int)a0 >= 0) goto L42c360;
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t6;
+goto L42c3d0;
+L42c360:
+t7 = MEM_U32(s4 + 36);
+t8 = MEM_U32(s4 + 32);
+v0 = t7 - s1;
+a3 = t8 + s1;
+if (v0 >= s2) goto L42c37c;
+s2 = v0;
+L42c37c:
+//nop;
+a2 = zero;
+MEM_U32(sp + 52) = a3;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 52);
+// bdead 402c010b gp = MEM_U32(sp + 40);
+a1 = a3;
+if (v0 != s1) goto L42c3b8;
+//nop;
+a0 = MEM_U32(s4 + 8);
+a2 = s2;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 8000b gp = MEM_U32(sp + 40);
+if (v0 == s2) {
+v0 = zero;
+goto L42c3d0;}
+v0 = zero;
+L42c3b8:
+at = 0x100003e8;
+t0 = 0x306;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t0;
+goto L42c3d0;
+// fdead 0 v0 = zero;
+L42c3d0:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x50;
+return v0;
+}
+
+static uint32_t f__elf_inmap(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L42c3f0:
+//_elf_inmap:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+//nop;
+s0 = a0;
+// fdead 4002002b MEM_U32(sp + 28) = ra;
+// fdead 4002002b MEM_U32(sp + 24) = gp;
+a0 = MEM_U32(a0 + 8);
+a1 = zero;
+a2 = 0x2;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = v0;
+if (v0 != 0) goto L42c438;
+v0 = zero;
+goto L42c564;
+L42c438:
+at = 0xffffffff;
+v1 = v0 >> 17;
+if (v0 != at) goto L42c458;
+at = 0x100003e8;
+t6 = 0x302;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t6;
+goto L42c564;
+L42c458:
+t7 = v1 << 2;
+v1 = t7 + 0x4;
+a0 = v1 & 0x7;
+a2 = v1;
+if (a0 == 0) goto L42c474;
+a2 = v1 - a0;
+a2 = a2 + 0x8;
+L42c474:
+//nop;
+a0 = a2;
+MEM_U32(sp + 32) = a2;
+MEM_U32(sp + 36) = a3;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+a3 = MEM_U32(sp + 36);
+MEM_U32(s0 + 56) = v0;
+if (v0 != 0) goto L42c4b0;
+at = 0x100003e8;
+t8 = 0x413;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42c564;
+L42c4b0:
+//nop;
+a0 = MEM_U32(s0 + 56);
+MEM_U32(sp + 36) = a3;
+MEM_U32(sp + 32) = a2;
+a1 = zero;
+v0 = wrapper_memset(mem, a0, a1, a2);
+a2 = MEM_U32(sp + 32);
+t0 = MEM_U32(s0 + 136);
+// bdead 40020283 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+t9 = a2 >> 2;
+t1 = t0 << 0;
+MEM_U32(s0 + 60) = t9;
+if ((int)t1 >= 0) goto L42c4f0;
+v0 = zero;
+goto L42c564;
+L42c4f0:
+//nop;
+a0 = a3;
+MEM_U32(sp + 36) = a3;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+MEM_U32(s0 + 40) = v0;
+if (v0 != 0) goto L42c524;
+at = 0x100003e8;
+t2 = 0x413;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42c564;
+L42c524:
+t4 = MEM_U32(s0 + 136);
+t3 = MEM_U32(s0 + 40);
+at = 0x20000000;
+t5 = t4 | at;
+MEM_U32(s0 + 44) = a3;
+MEM_U32(s0 + 52) = a3;
+MEM_U32(s0 + 36) = a3;
+MEM_U32(s0 + 136) = t5;
+MEM_U32(s0 + 32) = t3;
+//nop;
+a0 = s0;
+a1 = zero;
+a2 = 0x1;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L42c564:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void f__elf_unmap(uint8_t *mem, uint32_t sp) {
+L42c574:
+//_elf_unmap:
+//nop;
+return;
+//nop;
+}
+
+static uint32_t func_42c580(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L42c580:
+//nop;
+//nop;
+//nop;
+t6 = MEM_S8(a1 + 0);
+at = 0x2f;
+//nop;
+if (t6 != at) goto L42c5ac;
+t7 = MEM_S8(a1 + 1);
+at = 0x7f;
+//nop;
+if (t7 == at) goto L42c5b4;
+L42c5ac:
+v0 = zero;
+return v0;
+L42c5b4:
+v0 = MEM_U32(a0 + 72);
+at = 0x2;
+if (v0 != at) {
+at = 0x1;
+goto L42c604;}
+at = 0x1;
+t8 = MEM_U32(a0 + 32);
+t1 = 0x201;
+v0 = a1 - t8;
+t9 = v0 & 0x7;
+v1 = a1 - t9;
+t0 = MEM_U32(v1 + 8);
+v1 = v1 + 0x8;
+v0 = zero;
+if (a0 == t0) goto L42c5f4;
+at = 0x100003e8;
+MEM_U32(at + 0) = t1;
+return v0;
+L42c5f4:
+v0 = MEM_U32(v1 + 8);
+//nop;
+return v0;
+at = 0x1;
+L42c604:
+t6 = 0x505;
+if (v0 != at) goto L42c648;
+t2 = MEM_U32(a0 + 32);
+t5 = 0x201;
+v0 = a1 - t2;
+t3 = v0 & 0x3;
+v1 = a1 - t3;
+t4 = MEM_U32(v1 + 4);
+v1 = v1 + 0x4;
+v0 = zero;
+if (a0 == t4) goto L42c63c;
+at = 0x100003e8;
+MEM_U32(at + 0) = t5;
+return v0;
+L42c63c:
+v0 = MEM_U32(v1 + 4);
+//nop;
+return v0;
+L42c648:
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+//nop;
+return v0;
+}
+
+static void func_42c65c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L42c65c:
+t6 = 0x2f;
+t7 = 0x7f;
+MEM_U8(a1 + 0) = (uint8_t)t6;
+MEM_U8(a1 + 1) = (uint8_t)t7;
+v0 = MEM_U32(a0 + 72);
+at = 0x2;
+if (v0 != at) {
+at = 0x1;
+goto L42c6a4;}
+at = 0x1;
+t8 = MEM_U32(a0 + 32);
+//nop;
+v0 = a1 - t8;
+t9 = v0 & 0x7;
+v1 = a1 - t9;
+v1 = v1 + 0x8;
+MEM_U32(v1 + 0) = a0;
+MEM_U32(v1 + 8) = a2;
+return;
+at = 0x1;
+L42c6a4:
+//nop;
+if (v0 != at) goto L42c6cc;
+t0 = MEM_U32(a0 + 32);
+//nop;
+v0 = a1 - t0;
+t1 = v0 & 0x3;
+v1 = a1 - t1;
+v1 = v1 + 0x4;
+MEM_U32(v1 + 0) = a0;
+MEM_U32(v1 + 4) = a2;
+L42c6cc:
+//nop;
+return;
+}
+
+static uint64_t func_42c6d4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0;
+uint64_t temp64;
+L42c6d4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+t6 = 0x0;
+t7 = 0x0;
+at = a0 < a1;
+s0 = a0;
+s2 = a2;
+s3 = a1;
+// fdead 401b81ef MEM_U32(sp + 44) = ra;
+// fdead 401b81ef MEM_U32(sp + 40) = gp;
+// fdead 401b81ef MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 52) = t7;
+MEM_U32(sp + 48) = t6;
+if (at == 0) goto L42c7b8;
+L42c720:
+v1 = MEM_S8(s0 + 0);
+a0 = MEM_U32(sp + 48);
+s1 = v1 + 0xffffffd0;
+a3 = s2;
+if (s1 < s2) goto L42c77c;
+a0 = 0x20;
+s0 = s0 + 0x1;
+if (a0 != v1) goto L42c770;
+at = s0 < s3;
+L42c748:
+//nop;
+if (at != 0) goto L42c760;
+v0 = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 52);
+// bdead 19 ra = MEM_U32(sp + 44);
+goto L42c7c8;
+L42c760:
+t8 = MEM_S8(s0 + 0);
+s0 = s0 + 0x1;
+at = s0 < s3;
+if (a0 == t8) goto L42c748;
+L42c770:
+v0 = 0x0;
+v1 = 0x0;
+goto L42c7c4;
+L42c77c:
+//nop;
+a1 = MEM_U32(sp + 52);
+a2 = (int)s2 >> 31;
+temp64 = wrapper___ll_mul((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = s1 + v1;
+at = t3 < v1;
+t0 = 0x0;
+t2 = at + t0;
+s0 = s0 + 0x1;
+// bdead 401a1809 gp = MEM_U32(sp + 40);
+t2 = t2 + v0;
+at = s0 < s3;
+MEM_U32(sp + 48) = t2;
+MEM_U32(sp + 52) = t3;
+if (at != 0) goto L42c720;
+L42c7b8:
+v0 = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 52);
+//nop;
+L42c7c4:
+// bdead 19 ra = MEM_U32(sp + 44);
+L42c7c8:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f__elf_armem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L42c7e0:
+//_elf_armem:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+at = a2 < 0x3c;
+s1 = a1;
+// fdead 400401ef MEM_U32(sp + 36) = ra;
+// fdead 400401ef MEM_U32(sp + 32) = gp;
+// fdead 400401ef MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 72) = a0;
+if (at == 0) goto L42c824;
+at = 0x100003e8;
+t6 = 0x203;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+goto L42cc44;
+L42c824:
+//nop;
+a0 = MEM_U32(sp + 72);
+// fdead 400401ef t9 = t9;
+a1 = s1;
+v0 = func_42c580(mem, sp, a0, a1);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == 0) goto L42c84c;
+// bdead 9 ra = MEM_U32(sp + 36);
+goto L42cc48;
+L42c84c:
+v0 = 0x10002fc0;
+t7 = MEM_S8(s1 + 58);
+v0 = v0;
+t8 = MEM_S8(v0 + 0);
+t1 = 0x202;
+//nop;
+if (t7 != t8) goto L42c87c;
+t9 = MEM_S8(s1 + 59);
+t0 = MEM_S8(v0 + 1);
+//nop;
+//nop;
+if (t9 == t0) goto L42c88c;
+L42c87c:
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t1;
+goto L42cc44;
+L42c88c:
+//nop;
+a0 = 0x48;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+s0 = v0;
+if (v0 != 0) goto L42c8bc;
+at = 0x100003e8;
+t2 = 0x401;
+v0 = zero;
+MEM_U32(at + 0) = t2;
+goto L42cc44;
+L42c8bc:
+v0 = MEM_U32(sp + 72);
+a3 = s0 + 0x35;
+t3 = MEM_U32(v0 + 104);
+a0 = a3;
+MEM_U32(s0 + 28) = t3;
+MEM_U32(v0 + 104) = s0;
+MEM_U32(s0 + 32) = zero;
+//nop;
+MEM_U32(sp + 44) = a3;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+a3 = MEM_U32(sp + 44);
+MEM_U8(s0 + 69) = (uint8_t)zero;
+MEM_U32(s0 + 0) = a3;
+//nop;
+a0 = s0 + 0x24;
+MEM_U32(sp + 40) = a0;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+a3 = MEM_U32(sp + 44);
+MEM_U8(s0 + 52) = (uint8_t)zero;
+t4 = MEM_U32(sp + 40);
+a0 = 0x2f;
+MEM_U32(s0 + 24) = t4;
+t5 = MEM_S8(s1 + 0);
+t8 = s0 + 0x35;
+//nop;
+if (a0 == t5) goto L42c99c;
+t6 = MEM_S8(s0 + 69);
+v0 = s0 + 0x45;
+at = a3 < v0;
+if (a0 == t6) goto L42c964;
+L42c94c:
+//nop;
+if (at == 0) goto L42c964;
+t7 = MEM_S8(v0 + -1);
+v0 = v0 + 0xffffffff;
+at = a3 < v0;
+if (a0 != t7) goto L42c94c;
+L42c964:
+a3 = s1 + 0x10;
+if (t8 != v0) goto L42c994;
+t9 = MEM_S8(v0 + 0);
+v1 = 0x20;
+t0 = s0 + 0x46;
+if (v1 == t9) goto L42c994;
+L42c97c:
+//nop;
+if (t0 == v0) goto L42c994;
+t1 = MEM_S8(v0 + 1);
+v0 = v0 + 0x1;
+t0 = s0 + 0x46;
+if (v1 != t1) goto L42c97c;
+L42c994:
+MEM_U8(v0 + 0) = (uint8_t)zero;
+goto L42cb6c;
+L42c99c:
+a1 = MEM_S8(s1 + 1);
+v1 = 0x20;
+if ((int)a1 < (int)0x30) {
+at = (int)a1 < (int)0x3a;
+goto L42ca28;}
+a3 = s1 + 0x10;
+if ((int)a1 >= (int)0x3a) goto L42ca28;
+//nop;
+a0 = s1 + 0x1;
+// fdead 6206617f t9 = t9;
+a1 = a3;
+a2 = 0xa;
+MEM_U32(sp + 44) = a3;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t2 = MEM_U32(sp + 72);
+t4 = 0x0;
+// bdead 4006281b gp = MEM_U32(sp + 32);
+a3 = MEM_U32(sp + 44);
+at = t4 < v0;
+t3 = MEM_U32(t2 + 128);
+t9 = 0x205;
+if (at != 0) goto L42ca1c;
+if (v0 < t4) {
+at = v1 < t3;
+goto L42ca08;}
+//nop;
+if (v1 >= t3) goto L42ca1c;
+L42ca08:
+t6 = MEM_U32(t2 + 124);
+//nop;
+t8 = t6 + v1;
+MEM_U32(s0 + 0) = t8;
+goto L42cb6c;
+L42ca1c:
+MEM_U32(s0 + 0) = zero;
+MEM_U32(s0 + 32) = t9;
+goto L42cb6c;
+L42ca28:
+a3 = s1 + 0x10;
+if (v1 != a1) goto L42ca38;
+MEM_U8(s0 + 54) = (uint8_t)zero;
+goto L42cb6c;
+L42ca38:
+a2 = MEM_S8(s0 + 53);
+//nop;
+//nop;
+if (a0 != a2) goto L42cac8;
+t0 = MEM_S8(s0 + 54);
+at = 0x53;
+//nop;
+if (t0 != at) goto L42cac8;
+t1 = MEM_S8(s0 + 55);
+at = 0x59;
+//nop;
+if (t1 != at) goto L42cac8;
+t3 = MEM_S8(s0 + 56);
+at = 0x4d;
+//nop;
+if (t3 != at) goto L42cac8;
+t4 = MEM_S8(s0 + 57);
+at = 0x36;
+//nop;
+if (t4 != at) goto L42cac8;
+t5 = MEM_S8(s0 + 58);
+at = 0x34;
+//nop;
+if (t5 != at) goto L42cac8;
+t2 = MEM_S8(s0 + 59);
+//nop;
+//nop;
+if (a0 != t2) goto L42cac8;
+v0 = MEM_S8(s0 + 60);
+a3 = s1 + 0x10;
+//nop;
+if (v1 == v0) goto L42cac0;
+//nop;
+if (v0 != 0) goto L42cac8;
+L42cac0:
+MEM_U8(s0 + 60) = (uint8_t)zero;
+goto L42cb6c;
+L42cac8:
+//nop;
+if (a0 != a2) goto L42cb40;
+t6 = MEM_S8(s0 + 54);
+v0 = 0x48;
+//nop;
+if (v0 != t6) goto L42cb40;
+t7 = MEM_S8(s0 + 55);
+at = 0x41;
+//nop;
+if (t7 != at) goto L42cb40;
+t8 = MEM_S8(s0 + 56);
+at = 0x53;
+//nop;
+if (t8 != at) goto L42cb40;
+t9 = MEM_S8(s0 + 57);
+//nop;
+//nop;
+if (v0 != t9) goto L42cb40;
+t0 = MEM_S8(s0 + 58);
+//nop;
+//nop;
+if (a0 != t0) goto L42cb40;
+v0 = MEM_S8(s0 + 59);
+a3 = s1 + 0x10;
+//nop;
+if (v1 == v0) goto L42cb38;
+//nop;
+if (v0 != 0) goto L42cb40;
+L42cb38:
+MEM_U8(s0 + 59) = (uint8_t)zero;
+goto L42cb6c;
+L42cb40:
+t3 = 0x209;
+if (a0 != a1) goto L42cb60;
+t1 = MEM_S8(s1 + 2);
+a3 = s1 + 0x10;
+//nop;
+if (v1 != t1) goto L42cb60;
+MEM_U8(s0 + 55) = (uint8_t)zero;
+goto L42cb6c;
+L42cb60:
+MEM_U32(s0 + 0) = zero;
+MEM_U32(s0 + 32) = t3;
+a3 = s1 + 0x10;
+L42cb6c:
+//nop;
+a1 = s1 + 0x1c;
+// bdead 40060141 t9 = t9;
+MEM_U32(sp + 40) = a1;
+a0 = a3;
+a2 = 0xa;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 4) = v1;
+//nop;
+a0 = MEM_U32(sp + 40);
+a3 = s1 + 0x22;
+// fdead 6006013f t9 = t9;
+a1 = a3;
+MEM_U32(sp + 44) = a3;
+a2 = 0xa;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(s0 + 8) = v1;
+a1 = s1 + 0x28;
+// fdead 6006007f t9 = t9;
+MEM_U32(sp + 40) = a1;
+a2 = 0xa;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 12) = v1;
+//nop;
+a0 = MEM_U32(sp + 40);
+a3 = s1 + 0x30;
+// fdead 6006013f t9 = t9;
+a1 = a3;
+MEM_U32(sp + 44) = a3;
+a2 = 0x8;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(s0 + 16) = v1;
+// fdead 6006003f t9 = t9;
+a1 = s1 + 0x3a;
+a2 = 0xa;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060011 gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 20) = v1;
+//nop;
+a0 = MEM_U32(sp + 72);
+// fdead 6006003f t9 = t9;
+a1 = s1;
+a2 = s0;
+func_42c65c(mem, sp, a0, a1, a2);
+// bdead 20001 gp = MEM_U32(sp + 32);
+v0 = s0;
+L42cc44:
+// bdead 9 ra = MEM_U32(sp + 36);
+L42cc48:
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x48;
+return v0;
+}
+
+static void f__elf_arinit(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+uint64_t temp64;
+L42cc58:
+//_elf_arinit:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 4000002b MEM_U32(sp + 60) = ra;
+// fdead 4000002b MEM_U32(sp + 56) = fp;
+// fdead 4000002b MEM_U32(sp + 52) = gp;
+// fdead 4000002b MEM_U32(sp + 48) = s7;
+// fdead 4000002b MEM_U32(sp + 44) = s6;
+// fdead 4000002b MEM_U32(sp + 40) = s5;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+// fdead 4000002b MEM_U32(sp + 32) = s3;
+// fdead 4000002b MEM_U32(sp + 28) = s2;
+// fdead 4000002b MEM_U32(sp + 24) = s1;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+s7 = MEM_U32(a0 + 40);
+t6 = MEM_U32(a0 + 52);
+t8 = 0x1;
+t7 = t6 + s7;
+MEM_U32(sp + 96) = t7;
+t9 = 0x8;
+s5 = a0;
+MEM_U32(a0 + 12) = t8;
+MEM_U32(a0 + 28) = t9;
+s4 = 0x2f;
+s6 = 0x20;
+fp = zero;
+s3 = s7 + 0x8;
+L42ccc8:
+t0 = MEM_U32(sp + 96);
+a0 = s5;
+t1 = t0 - s3;
+// bdead c1f00023 ra = MEM_U32(sp + 60);
+if (t1 < 0x3c) goto L42cf48;
+t2 = MEM_U32(s5 + 40);
+//nop;
+a2 = 0x3c;
+a1 = s3 - t2;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead c1f0000b gp = MEM_U32(sp + 52);
+s1 = s3;
+if (v0 != 0) goto L42cf44;
+//nop;
+s2 = s3 + 0x3c;
+// fdead 1e1fe001f t9 = t9;
+s0 = s2;
+a0 = s3 + 0x30;
+a1 = s3 + 0x3a;
+a2 = 0xa;
+temp64 = func_42c6d4(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U32(sp + 96);
+// bdead c1fe101b gp = MEM_U32(sp + 52);
+t4 = t3 - s2;
+t6 = (int)t4 >> 31;
+at = t6 < v0;
+MEM_U32(sp + 64) = v0;
+MEM_U32(sp + 68) = v1;
+if (at != 0) goto L42cf44;
+a1 = v1;
+if (v0 < t6) goto L42cd58;
+// bdead c1f6005b ra = MEM_U32(sp + 60);
+if (t4 < v1) goto L42cf48;
+L42cd58:
+t5 = MEM_S8(s3 + 0);
+t8 = 0x0;
+// bdead c3e6005b ra = MEM_U32(sp + 60);
+if (s4 != t5) goto L42cf48;
+// bdead c1e60053 t9 = v1;
+if (v0 != t8) goto L42cf44;
+t0 = s1 - s7;
+if (v1 != v1) goto L42cf44;
+a2 = MEM_S8(s1 + 1);
+s3 = s0 + v1;
+t1 = 0x1;
+if (s6 != a2) goto L42cda4;
+MEM_U32(s5 + 112) = s0;
+MEM_U32(s5 + 116) = v1;
+MEM_U32(s5 + 120) = t0;
+MEM_U32(s5 + 72) = t1;
+s2 = MEM_U32(sp + 68);
+fp = fp + 0x1;
+goto L42cf34;
+L42cda4:
+a3 = MEM_S8(s1 + 0);
+at = 0x53;
+//nop;
+if (s4 != a3) goto L42ce44;
+//nop;
+if (a2 != at) goto L42ce44;
+t4 = MEM_S8(s1 + 2);
+at = 0x59;
+//nop;
+if (t4 != at) goto L42ce44;
+t6 = MEM_S8(s1 + 3);
+at = 0x4d;
+//nop;
+if (t6 != at) goto L42ce44;
+t7 = MEM_S8(s1 + 4);
+at = 0x36;
+//nop;
+if (t7 != at) goto L42ce44;
+t5 = MEM_S8(s1 + 5);
+at = 0x34;
+//nop;
+if (t5 != at) goto L42ce44;
+t8 = MEM_S8(s1 + 6);
+//nop;
+//nop;
+if (s4 != t8) goto L42ce44;
+a0 = MEM_S8(s1 + 7);
+t0 = 0x2;
+//nop;
+if (s6 == a0) goto L42ce24;
+//nop;
+if (a0 != 0) goto L42ce44;
+L42ce24:
+t9 = s1 - s7;
+MEM_U32(s5 + 112) = s0;
+MEM_U32(s5 + 116) = a1;
+MEM_U32(s5 + 120) = t9;
+MEM_U32(s5 + 72) = t0;
+s2 = MEM_U32(sp + 68);
+fp = fp + 0x1;
+goto L42cf34;
+L42ce44:
+at = 0x48;
+if (s4 != a3) goto L42ceb8;
+//nop;
+if (a2 != at) goto L42ceb8;
+t1 = MEM_S8(s1 + 2);
+at = 0x41;
+//nop;
+if (t1 != at) goto L42ceb8;
+t4 = MEM_S8(s1 + 3);
+at = 0x53;
+//nop;
+if (t4 != at) goto L42ceb8;
+t6 = MEM_S8(s1 + 4);
+at = 0x48;
+//nop;
+if (t6 != at) goto L42ceb8;
+t7 = MEM_S8(s1 + 5);
+//nop;
+//nop;
+if (s4 != t7) goto L42ceb8;
+v0 = MEM_S8(s1 + 6);
+//nop;
+//nop;
+if (s6 == v0) goto L42ceac;
+//nop;
+if (v0 != 0) goto L42ceb8;
+L42ceac:
+t9 = MEM_U32(sp + 68);
+s2 = t9;
+goto L42cf30;
+L42ceb8:
+a0 = s5;
+if (s4 != a2) goto L42cf44;
+t5 = MEM_S8(s1 + 2);
+a2 = MEM_U32(sp + 68);
+// bdead c1f600a3 ra = MEM_U32(sp + 60);
+if (s6 != t5) goto L42cf48;
+t0 = MEM_U32(s5 + 40);
+//nop;
+s2 = a2;
+a1 = s0 - t0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+t1 = s1 - s7;
+if (v0 != 0) goto L42cf44;
+t4 = s0 + s2;
+at = s0 < t4;
+MEM_U32(s5 + 124) = s0;
+MEM_U32(s5 + 128) = s2;
+MEM_U32(s5 + 132) = t1;
+if (at == 0) goto L42cf2c;
+L42cf08:
+t6 = MEM_S8(s0 + 0);
+//nop;
+//nop;
+if (s4 != t6) goto L42cf1c;
+MEM_U8(s0 + 0) = (uint8_t)zero;
+L42cf1c:
+s0 = s0 + 0x1;
+//nop;
+if (s0 < s3) goto L42cf08;
+L42cf2c:
+MEM_U8(s0 + -1) = (uint8_t)zero;
+L42cf30:
+fp = fp + 0x1;
+L42cf34:
+at = 0x3;
+t7 = s2 & 0x1;
+s3 = s3 + t7;
+if (fp != at) goto L42ccc8;
+L42cf44:
+// bdead 1 ra = MEM_U32(sp + 60);
+L42cf48:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x68;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static void f__elf_cook(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L42cf80:
+//_elf_cook:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+a1 = 0x1;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 36) = a1;
+v1 = MEM_U32(a0 + 12);
+s0 = a0;
+//nop;
+if (a1 == v1) goto L42cfd8;
+t6 = MEM_U32(a0 + 136);
+//nop;
+t7 = t6 & 0x40;
+//nop;
+if (t7 == 0) goto L42cfd8;
+t8 = MEM_U32(a0 + 76);
+at = 0x3;
+//nop;
+if (t8 == at) goto L42cfe0;
+L42cfd8:
+// bdead 1 v0 = zero;
+goto L42d1b4;
+L42cfe0:
+v0 = MEM_U32(s0 + 72);
+at = 0x2;
+//nop;
+if (v0 != at) goto L42cff8;
+a1 = 0x1;
+goto L42d018;
+L42cff8:
+t9 = 0x505;
+if (a1 != v0) goto L42d008;
+a1 = zero;
+goto L42d018;
+L42d008:
+at = 0x100003e8;
+// bdead 4000005 v0 = 0xffffffff;
+MEM_U32(at + 0) = t9;
+goto L42d1b4;
+L42d018:
+//nop;
+if (v1 != 0) goto L42d04c;
+//nop;
+a0 = s0;
+// bdead 40020063 t9 = t9;
+MEM_U32(sp + 32) = a1;
+v0 = func_42e41c(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+if (v0 == 0) goto L42d04c;
+// bdead 1 v0 = 0xffffffff;
+goto L42d1b4;
+L42d04c:
+t0 = MEM_U32(s0 + 12);
+at = 0x2;
+//nop;
+if (t0 != at) goto L42d060;
+MEM_U32(sp + 36) = zero;
+L42d060:
+//nop;
+if (a1 == 0) goto L42d0d8;
+//nop;
+a1 = MEM_U32(sp + 36);
+// bdead 40020043 t9 = t9;
+a0 = s0;
+v0 = func_42d84c(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L42d090;
+// bdead 1 v0 = 0xffffffff;
+goto L42d1b4;
+L42d090:
+//nop;
+a1 = MEM_U32(sp + 36);
+// fdead 86002005f t9 = t9;
+a0 = s0;
+v0 = func_42dc44(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42d17c;
+//nop;
+a1 = MEM_U32(sp + 36);
+// fdead 86002005f t9 = t9;
+a0 = s0;
+v0 = func_42e154(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L42d140;
+v0 = MEM_U32(s0 + 136);
+goto L42d14c;
+L42d0d8:
+//nop;
+a1 = MEM_U32(sp + 36);
+// bdead 40020043 t9 = t9;
+a0 = s0;
+v0 = func_42d6a4(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L42d100;
+// bdead 1 v0 = 0xffffffff;
+goto L42d1b4;
+L42d100:
+//nop;
+a1 = MEM_U32(sp + 36);
+// fdead 86002005f t9 = t9;
+a0 = s0;
+v0 = func_42d9f4(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42d17c;
+//nop;
+a1 = MEM_U32(sp + 36);
+// fdead 86002005f t9 = t9;
+a0 = s0;
+v0 = func_42df14(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42d148;
+L42d140:
+// bdead 1 v0 = zero;
+goto L42d1b4;
+L42d148:
+v0 = MEM_U32(s0 + 136);
+L42d14c:
+at = 0xfffffffb;
+t1 = v0 & 0x4;
+t2 = v0 & at;
+if (t1 == 0) goto L42d178;
+MEM_U32(s0 + 136) = t2;
+//nop;
+a0 = MEM_U32(s0 + 84);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+//nop;
+L42d178:
+MEM_U32(s0 + 84) = zero;
+L42d17c:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffffd;
+t3 = v0 & 0x2;
+t4 = v0 & at;
+if (t3 == 0) goto L42d1ac;
+MEM_U32(s0 + 136) = t4;
+//nop;
+a0 = MEM_U32(s0 + 80);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42d1ac:
+MEM_U32(s0 + 80) = zero;
+// bdead 1 v0 = 0xffffffff;
+L42d1b4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f__elf_cookscn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+uint64_t temp64;
+L42d1c4:
+//_elf_cookscn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 4000016b MEM_U32(sp + 44) = s6;
+s6 = a0;
+// fdead 4080016b MEM_U32(sp + 60) = ra;
+// fdead 4080016b MEM_U32(sp + 56) = fp;
+// fdead 4080016b MEM_U32(sp + 52) = gp;
+// fdead 4080016b MEM_U32(sp + 48) = s7;
+// fdead 4080016b MEM_U32(sp + 40) = s5;
+// fdead 4080016b MEM_U32(sp + 36) = s4;
+// fdead 4080016b MEM_U32(sp + 32) = s3;
+// fdead 4080016b MEM_U32(sp + 28) = s2;
+// fdead 4080016b MEM_U32(sp + 24) = s1;
+// fdead 4080016b MEM_U32(sp + 20) = s0;
+if (a1 != 0) goto L42d210;
+v0 = zero;
+goto L42d540;
+L42d210:
+s0 = a1 << 2;
+s0 = s0 - a1;
+s0 = s0 << 2;
+//nop;
+s0 = s0 + a1;
+s0 = s0 << 3;
+a0 = s0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4082000b gp = MEM_U32(sp + 52);
+s2 = v0;
+if (v0 != 0) goto L42d250;
+at = 0x100003e8;
+t6 = 0x410;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t6;
+goto L42d540;
+L42d250:
+a0 = MEM_U32(s6 + 72);
+at = 0x2;
+t7 = 0x1;
+if (a0 != at) goto L42d268;
+MEM_U32(sp + 68) = t7;
+goto L42d28c;
+L42d268:
+at = 0x1;
+t8 = 0x505;
+if (a0 != at) goto L42d27c;
+MEM_U32(sp + 68) = zero;
+goto L42d28c;
+L42d27c:
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42d540;
+L42d28c:
+t9 = s0 + v0;
+MEM_U32(sp + 80) = t9;
+MEM_U32(s6 + 96) = v0;
+t0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+if (t0 == 0) goto L42d2b4;
+s3 = MEM_U32(s6 + 92);
+s4 = zero;
+goto L42d2bc;
+L42d2b4:
+s4 = MEM_U32(s6 + 92);
+s3 = zero;
+L42d2bc:
+s7 = 0x10000498;
+fp = 0x8;
+L42d2c4:
+t1 = 0x100003f0;
+t4 = s2;
+t3 = t1 + 0x60;
+L42d2d0:
+at = MEM_U32(t1 + 0);
+t1 = t1 + 0xc;
+MEM_U32(t4 + 0) = at;
+at = MEM_U32(t1 + -8);
+t4 = t4 + 0xc;
+MEM_U32(t4 + -8) = at;
+at = MEM_U32(t1 + -4);
+MEM_U32(t4 + -4) = at;
+if (t1 != t3) goto L42d2d0;
+at = MEM_U32(t1 + 0);
+//nop;
+MEM_U32(t4 + 0) = at;
+t3 = MEM_U32(t1 + 4);
+//nop;
+MEM_U32(t4 + 4) = t3;
+MEM_U32(s2 + 4) = s6;
+t5 = MEM_U32(sp + 68);
+//nop;
+//nop;
+if (t5 == 0) goto L42d328;
+MEM_U32(s2 + 16) = s3;
+goto L42d32c;
+L42d328:
+MEM_U32(s2 + 16) = s4;
+L42d32c:
+t6 = MEM_U32(s6 + 96);
+at = 0x68;
+t7 = s2 - t6;
+lo = (int)t7 / (int)at; hi = (int)t7 % (int)at;
+s0 = s2 + 0x28;
+MEM_U32(s2 + 12) = s0;
+MEM_U32(s2 + 8) = s0;
+t8 = lo;
+MEM_U32(s2 + 20) = t8;
+MEM_U32(s0 + 24) = s2;
+t9 = MEM_U32(s6 + 68);
+//nop;
+MEM_U32(s0 + 20) = t9;
+t0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+if (t0 == 0) goto L42d444;
+t3 = MEM_U32(s3 + 52);
+//nop;
+MEM_U32(s0 + 16) = t3;
+t5 = MEM_U32(s3 + 28);
+//nop;
+MEM_U32(s0 + 36) = t5;
+//nop;
+a1 = MEM_U32(s7 + 0);
+a0 = MEM_U32(s3 + 4);
+//nop;
+v0 = f__elf64_mtype(mem, sp, a0, a1);
+// bdead c1ba000b gp = MEM_U32(sp + 52);
+MEM_U32(s0 + 4) = v0;
+//nop;
+a2 = MEM_U32(s6 + 68);
+a0 = v0;
+a1 = 0x1;
+v0 = f__elf64_fsize(mem, sp, a0, a1, a2);
+// bdead c1ba000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s0 + 4);
+//nop;
+a1 = MEM_U32(s6 + 68);
+s1 = v0;
+v0 = f__elf64_msize(mem, sp, a0, a1);
+// bdead c1be000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 32);
+//nop;
+a1 = MEM_U32(s3 + 36);
+s5 = v0;
+a3 = s1;
+a2 = 0x0;
+temp64 = wrapper___ull_div((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa001b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = v1;
+a3 = s5;
+a2 = 0x0;
+temp64 = wrapper___ll_mul((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ba0013 gp = MEM_U32(sp + 52);
+MEM_U32(s0 + 8) = v1;
+t9 = MEM_U32(s3 + 36);
+//nop;
+MEM_U32(s0 + 44) = t9;
+t2 = MEM_U32(s3 + 4);
+//nop;
+//nop;
+if (fp == t2) goto L42d43c;
+t5 = MEM_U32(s3 + 36);
+//nop;
+MEM_U32(s0 + 40) = t5;
+L42d43c:
+s3 = s3 + 0x40;
+goto L42d500;
+L42d444:
+t1 = MEM_U32(s4 + 32);
+//nop;
+MEM_U32(s0 + 16) = t1;
+t6 = MEM_U32(s4 + 16);
+//nop;
+MEM_U32(s0 + 36) = t6;
+//nop;
+a1 = MEM_U32(s7 + 0);
+a0 = MEM_U32(s4 + 4);
+//nop;
+v0 = f__elf32_mtype(mem, sp, a0, a1);
+// bdead c1ba000b gp = MEM_U32(sp + 52);
+MEM_U32(s0 + 4) = v0;
+//nop;
+a2 = MEM_U32(s6 + 68);
+a0 = v0;
+a1 = 0x1;
+v0 = f__elf32_fsize(mem, sp, a0, a1, a2);
+// bdead c1ba000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s0 + 4);
+//nop;
+a1 = MEM_U32(s6 + 68);
+s1 = v0;
+v0 = f__elf32_msize(mem, sp, a0, a1);
+t7 = MEM_U32(s4 + 20);
+// bdead c1bf000b gp = MEM_U32(sp + 52);
+lo = t7 / s1; hi = t7 % s1;
+//nop;
+if (s1 != 0) goto L42d4bc;
+abort();
+L42d4bc:
+t8 = lo;
+//nop;
+//nop;
+lo = t8 * v0;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)v0 >> 32);
+t9 = lo;
+MEM_U32(s0 + 8) = t9;
+t0 = MEM_U32(s4 + 20);
+//nop;
+MEM_U32(s0 + 44) = t0;
+t2 = MEM_U32(s4 + 4);
+//nop;
+//nop;
+if (fp == t2) goto L42d4fc;
+t4 = MEM_U32(s4 + 20);
+//nop;
+MEM_U32(s0 + 40) = t4;
+L42d4fc:
+s4 = s4 + 0x28;
+L42d500:
+v0 = s2 + 0x68;
+MEM_U32(s2 + 0) = v0;
+t5 = MEM_U32(sp + 80);
+s2 = v0;
+//nop;
+if (v0 < t5) goto L42d2c4;
+s2 = v0 + 0xffffff98;
+MEM_U32(s6 + 100) = s2;
+MEM_U32(s2 + 0) = zero;
+s2 = MEM_U32(s6 + 96);
+t3 = 0x1;
+v0 = zero;
+MEM_U32(s2 + 36) = t3;
+MEM_U32(s2 + 8) = zero;
+MEM_U32(s2 + 12) = zero;
+L42d540:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static uint32_t func_42d6a4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L42d6a4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+//nop;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 92) = a1;
+a2 = MEM_U32(s0 + 68);
+a1 = 0x1;
+a0 = 0x3;
+v0 = f__elf32_fsize(mem, sp, a0, a1, a2);
+t6 = MEM_U32(s0 + 52);
+// bdead 4002800b gp = MEM_U32(sp + 24);
+a2 = v0;
+if (t6 >= v0) goto L42d704;
+at = 0x100003e8;
+t7 = 0x20b;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t7;
+goto L42d83c;
+L42d704:
+t8 = MEM_U32(sp + 92);
+at = v0 < 0x34;
+//nop;
+if (t8 == 0) goto L42d72c;
+t9 = 0x1;
+if (at != 0) goto L42d72c;
+v0 = MEM_U32(s0 + 40);
+MEM_U32(s0 + 12) = t9;
+MEM_U32(s0 + 80) = v0;
+goto L42d770;
+L42d72c:
+//nop;
+a0 = 0x34;
+MEM_U32(sp + 84) = a2;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 84);
+MEM_U32(s0 + 80) = v0;
+if (v0 != 0) goto L42d760;
+at = 0x100003e8;
+t0 = 0x40c;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t0;
+goto L42d83c;
+L42d760:
+t1 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t2 = t1 | 0x2;
+MEM_U32(s0 + 136) = t2;
+L42d770:
+t3 = 0x3;
+MEM_U32(sp + 36) = v0;
+MEM_U32(sp + 40) = t3;
+MEM_U32(sp + 44) = a2;
+t4 = MEM_U32(s0 + 68);
+//nop;
+MEM_U32(sp + 56) = t4;
+t5 = MEM_U32(s0 + 80);
+t6 = 0x34;
+t7 = 0x1;
+MEM_U32(sp + 68) = t6;
+MEM_U32(sp + 80) = t7;
+a0 = s0;
+a1 = zero;
+MEM_U32(sp + 60) = t5;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+a0 = sp + 0x3c;
+if (v0 != 0) goto L42d7d8;
+//nop;
+a2 = MEM_U32(s0 + 64);
+a1 = sp + 0x24;
+v0 = f__elf32_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42d818;
+L42d7d8:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffffd;
+t8 = v0 & 0x2;
+//nop;
+if (t8 == 0) goto L42d80c;
+t9 = v0 & at;
+MEM_U32(s0 + 136) = t9;
+//nop;
+a0 = MEM_U32(s0 + 80);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42d80c:
+MEM_U32(s0 + 80) = zero;
+v0 = 0xffffffff;
+goto L42d83c;
+L42d818:
+t1 = MEM_U32(s0 + 80);
+t0 = MEM_U32(s0 + 68);
+t2 = MEM_U32(t1 + 20);
+t3 = 0x212;
+v0 = zero;
+if (t0 == t2) goto L42d83c;
+at = 0x100003e8;
+MEM_U32(at + 0) = t3;
+goto L42d7d8;
+L42d83c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static uint32_t func_42d84c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L42d84c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+//nop;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 28) = ra;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 92) = a1;
+a2 = MEM_U32(s0 + 68);
+a1 = 0x1;
+a0 = 0x3;
+v0 = f__elf64_fsize(mem, sp, a0, a1, a2);
+t6 = MEM_U32(s0 + 52);
+// bdead 4002800b gp = MEM_U32(sp + 24);
+a2 = v0;
+if (t6 >= v0) goto L42d8ac;
+at = 0x100003e8;
+t7 = 0x20b;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t7;
+goto L42d9e4;
+L42d8ac:
+t8 = MEM_U32(sp + 92);
+at = v0 < 0x40;
+//nop;
+if (t8 == 0) goto L42d8d4;
+t9 = 0x1;
+if (at != 0) goto L42d8d4;
+v0 = MEM_U32(s0 + 40);
+MEM_U32(s0 + 12) = t9;
+MEM_U32(s0 + 80) = v0;
+goto L42d918;
+L42d8d4:
+//nop;
+a0 = 0x40;
+MEM_U32(sp + 84) = a2;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 84);
+MEM_U32(s0 + 80) = v0;
+if (v0 != 0) goto L42d908;
+at = 0x100003e8;
+t0 = 0x40c;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t0;
+goto L42d9e4;
+L42d908:
+t1 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t2 = t1 | 0x2;
+MEM_U32(s0 + 136) = t2;
+L42d918:
+t3 = 0x3;
+MEM_U32(sp + 36) = v0;
+MEM_U32(sp + 40) = t3;
+MEM_U32(sp + 44) = a2;
+t4 = MEM_U32(s0 + 68);
+//nop;
+MEM_U32(sp + 56) = t4;
+t5 = MEM_U32(s0 + 80);
+t6 = 0x40;
+t7 = 0x1;
+MEM_U32(sp + 68) = t6;
+MEM_U32(sp + 80) = t7;
+a0 = s0;
+a1 = zero;
+MEM_U32(sp + 60) = t5;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+a0 = sp + 0x3c;
+if (v0 != 0) goto L42d980;
+//nop;
+a2 = MEM_U32(s0 + 64);
+a1 = sp + 0x24;
+v0 = f__elf64_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L42d9c0;
+L42d980:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffffd;
+t8 = v0 & 0x2;
+//nop;
+if (t8 == 0) goto L42d9b4;
+t9 = v0 & at;
+MEM_U32(s0 + 136) = t9;
+//nop;
+a0 = MEM_U32(s0 + 80);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42d9b4:
+MEM_U32(s0 + 80) = zero;
+v0 = 0xffffffff;
+goto L42d9e4;
+L42d9c0:
+t1 = MEM_U32(s0 + 80);
+t0 = MEM_U32(s0 + 68);
+t2 = MEM_U32(t1 + 20);
+t3 = 0x212;
+v0 = zero;
+if (t0 == t2) goto L42d9e4;
+at = 0x100003e8;
+MEM_U32(at + 0) = t3;
+goto L42d980;
+L42d9e4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static uint32_t func_42d9f4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L42d9f4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 108) = a1;
+a3 = MEM_U32(a0 + 80);
+s0 = a0;
+t6 = MEM_U16(a3 + 44);
+a0 = 0x6;
+a1 = 0x1;
+if (t6 != 0) goto L42da34;
+v0 = zero;
+goto L42dc34;
+L42da34:
+//nop;
+a2 = MEM_U32(s0 + 68);
+MEM_U32(sp + 44) = a3;
+v0 = f__elf32_fsize(mem, sp, a0, a1, a2);
+a3 = MEM_U32(sp + 44);
+// bdead 4002010b gp = MEM_U32(sp + 24);
+t7 = MEM_U16(a3 + 42);
+a2 = v0;
+t8 = 0x20d;
+if (v0 == t7) goto L42da6c;
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42dc34;
+L42da6c:
+t9 = MEM_U16(a3 + 44);
+a1 = 0x10000498;
+lo = a2 * t9;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)t9 >> 32);
+//nop;
+a1 = MEM_U32(a1 + 0);
+MEM_U32(sp + 44) = a3;
+a0 = 0x6;
+a2 = lo;
+MEM_U32(sp + 100) = a2;
+//nop;
+v0 = f__elf32_msize(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 44);
+// bdead 4002010b gp = MEM_U32(sp + 24);
+t0 = MEM_U16(a3 + 44);
+a2 = MEM_U32(sp + 100);
+lo = v0 * t0;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)t0 >> 32);
+t3 = 0x20e;
+t1 = lo;
+MEM_U32(sp + 96) = t1;
+v1 = MEM_U32(a3 + 28);
+//nop;
+//nop;
+if (v1 == 0) goto L42dae8;
+v0 = MEM_U32(s0 + 52);
+//nop;
+t2 = v0 - v1;
+if (v1 >= v0) goto L42dae8;
+t4 = MEM_U32(sp + 108);
+if (t2 >= a2) goto L42dafc;
+L42dae8:
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t3;
+goto L42dc34;
+// fdead 0 t4 = MEM_U32(sp + 108);
+L42dafc:
+t5 = MEM_U32(sp + 96);
+at = a2 < t5;
+if (t4 == 0) goto L42db2c;
+t6 = v1 & 0x3;
+if (a2 < t5) goto L42db2c;
+t8 = 0x1;
+if (t6 != 0) goto L42db2c;
+v0 = MEM_U32(s0 + 40);
+MEM_U32(s0 + 12) = t8;
+t7 = v0 + v1;
+MEM_U32(s0 + 84) = t7;
+goto L42db78;
+L42db2c:
+//nop;
+a0 = MEM_U32(sp + 96);
+MEM_U32(sp + 100) = a2;
+MEM_U32(sp + 44) = a3;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 100);
+a3 = MEM_U32(sp + 44);
+MEM_U32(s0 + 84) = v0;
+if (v0 != 0) goto L42db68;
+at = 0x100003e8;
+t9 = 0x40f;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t9;
+goto L42dc34;
+L42db68:
+t0 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t1 = t0 | 0x4;
+MEM_U32(s0 + 136) = t1;
+L42db78:
+t2 = MEM_U32(a3 + 28);
+t4 = 0x6;
+t3 = v0 + t2;
+MEM_U32(sp + 48) = t3;
+MEM_U32(sp + 52) = t4;
+MEM_U32(sp + 56) = a2;
+t5 = MEM_U32(s0 + 68);
+t8 = 0x10000498;
+MEM_U32(sp + 68) = t5;
+t6 = MEM_U32(s0 + 84);
+t7 = MEM_U32(sp + 96);
+t8 = MEM_U32(t8 + 0);
+//nop;
+MEM_U32(sp + 72) = t6;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 92) = t8;
+a1 = MEM_U32(a3 + 28);
+a0 = s0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+a0 = sp + 0x48;
+if (v0 != 0) goto L42dbec;
+//nop;
+a2 = MEM_U32(s0 + 64);
+a1 = sp + 0x30;
+v0 = f__elf32_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 96);
+if (v0 != 0) goto L42dc2c;
+L42dbec:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffffb;
+t9 = v0 & 0x4;
+t0 = v0 & at;
+if (t9 == 0) goto L42dc1c;
+MEM_U32(s0 + 136) = t0;
+//nop;
+a0 = MEM_U32(s0 + 84);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42dc1c:
+MEM_U32(s0 + 84) = zero;
+v0 = 0xffffffff;
+goto L42dc34;
+// fdead 0 t1 = MEM_U32(sp + 96);
+L42dc2c:
+v0 = zero;
+MEM_U32(s0 + 88) = t1;
+L42dc34:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x68;
+return v0;
+}
+
+static uint32_t func_42dc44(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+uint64_t temp64;
+L42dc44:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 124) = a1;
+t0 = MEM_U32(a0 + 80);
+s0 = a0;
+t6 = MEM_U16(t0 + 56);
+a0 = 0x6;
+a1 = 0x1;
+if (t6 != 0) goto L42dc84;
+v0 = zero;
+goto L42df04;
+L42dc84:
+//nop;
+a2 = MEM_U32(s0 + 68);
+MEM_U32(sp + 60) = t0;
+v0 = f__elf64_fsize(mem, sp, a0, a1, a2);
+t0 = MEM_U32(sp + 60);
+// bdead 4002020b gp = MEM_U32(sp + 24);
+t7 = MEM_U16(t0 + 54);
+a2 = v0;
+t8 = 0x20d;
+if (v0 == t7) goto L42dcbc;
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42df04;
+L42dcbc:
+t9 = MEM_U16(t0 + 56);
+a1 = 0x10000498;
+lo = a2 * t9;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)t9 >> 32);
+//nop;
+a1 = MEM_U32(a1 + 0);
+MEM_U32(sp + 60) = t0;
+a0 = 0x6;
+a2 = lo;
+MEM_U32(sp + 116) = a2;
+//nop;
+v0 = f__elf64_msize(mem, sp, a0, a1);
+t0 = MEM_U32(sp + 60);
+// bdead 4002020b gp = MEM_U32(sp + 24);
+t1 = MEM_U16(t0 + 56);
+t8 = 0x0;
+lo = v0 * t1;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)t1 >> 32);
+t2 = lo;
+MEM_U32(sp + 112) = t2;
+t7 = MEM_U32(t0 + 36);
+t6 = MEM_U32(t0 + 32);
+MEM_U32(sp + 52) = t7;
+MEM_U32(sp + 48) = t6;
+t2 = t8;
+if (t6 != 0) goto L42dd24;
+//nop;
+if (t7 == 0) goto L42dd84;
+L42dd24:
+t3 = MEM_U32(s0 + 52);
+at = t8 < t6;
+MEM_U32(sp + 40) = t8;
+// bdead 42039a07 t9 = t3;
+MEM_U32(sp + 44) = t3;
+if (at != 0) goto L42dd84;
+t5 = t3 - t7;
+if (t6 < t8) goto L42dd50;
+if (t7 >= t3) {
+at = t3 < t7;
+goto L42dd84;}
+L42dd50:
+at = t3 < t7;
+t4 = t2 - t6;
+t1 = MEM_U32(sp + 116);
+t4 = t4 - at;
+t8 = 0x0;
+// bdead 42026603 t9 = t1;
+if (t8 < t4) goto L42dd98;
+if (t4 < t8) {
+at = t5 < t1;
+goto L42dd84;}
+t3 = MEM_U32(sp + 124);
+if (t5 >= t1) goto L42dd9c;
+L42dd84:
+at = 0x100003e8;
+t2 = 0x20e;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42df04;
+L42dd98:
+t3 = MEM_U32(sp + 124);
+L42dd9c:
+t6 = MEM_U32(sp + 116);
+//nop;
+if (t3 == 0) goto L42de00;
+t7 = MEM_U32(sp + 112);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+if (t6 < t7) goto L42de00;
+//nop;
+a1 = MEM_U32(sp + 52);
+a3 = 0x8;
+MEM_U32(sp + 60) = t0;
+temp64 = wrapper___ull_rem((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4002001b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L42de00;
+t9 = 0x1;
+if (v1 != 0) goto L42de00;
+v0 = MEM_U32(s0 + 40);
+t5 = MEM_U32(t0 + 36);
+MEM_U32(s0 + 12) = t9;
+t8 = v0 + t5;
+MEM_U32(s0 + 84) = t8;
+goto L42de44;
+L42de00:
+//nop;
+a0 = MEM_U32(sp + 112);
+MEM_U32(sp + 60) = t0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+MEM_U32(s0 + 84) = v0;
+if (v0 != 0) goto L42de34;
+at = 0x100003e8;
+t2 = 0x40f;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42df04;
+L42de34:
+t3 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t6 = t3 | 0x4;
+MEM_U32(s0 + 136) = t6;
+L42de44:
+t5 = MEM_U32(t0 + 36);
+a2 = MEM_U32(sp + 116);
+t8 = 0x6;
+t1 = v0 + t5;
+MEM_U32(sp + 64) = t1;
+MEM_U32(sp + 68) = t8;
+MEM_U32(sp + 72) = a2;
+t2 = MEM_U32(s0 + 68);
+t4 = 0x10000498;
+MEM_U32(sp + 84) = t2;
+t3 = MEM_U32(s0 + 84);
+t6 = MEM_U32(sp + 112);
+t4 = MEM_U32(t4 + 0);
+//nop;
+MEM_U32(sp + 88) = t3;
+MEM_U32(sp + 96) = t6;
+MEM_U32(sp + 108) = t4;
+a1 = MEM_U32(t0 + 36);
+a0 = s0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+a0 = sp + 0x58;
+if (v0 != 0) goto L42debc;
+//nop;
+a2 = MEM_U32(s0 + 64);
+a1 = sp + 0x40;
+v0 = f__elf64_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+t2 = MEM_U32(sp + 112);
+if (v0 != 0) goto L42defc;
+L42debc:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffffb;
+t7 = v0 & 0x4;
+t1 = v0 & at;
+if (t7 == 0) goto L42deec;
+MEM_U32(s0 + 136) = t1;
+//nop;
+a0 = MEM_U32(s0 + 84);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42deec:
+MEM_U32(s0 + 84) = zero;
+v0 = 0xffffffff;
+goto L42df04;
+// fdead 0 t2 = MEM_U32(sp + 112);
+L42defc:
+v0 = zero;
+MEM_U32(s0 + 88) = t2;
+L42df04:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x78;
+return v0;
+}
+
+static uint32_t func_42df14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L42df14:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 108) = a1;
+a3 = MEM_U32(a0 + 80);
+s0 = a0;
+t6 = MEM_U16(a3 + 48);
+a0 = 0x9;
+a1 = 0x1;
+if (t6 != 0) goto L42df54;
+v0 = zero;
+goto L42e144;
+L42df54:
+//nop;
+a2 = MEM_U32(s0 + 68);
+MEM_U32(sp + 44) = a3;
+v0 = f__elf32_fsize(mem, sp, a0, a1, a2);
+a3 = MEM_U32(sp + 44);
+// bdead 4002010b gp = MEM_U32(sp + 24);
+t7 = MEM_U16(a3 + 46);
+t8 = 0x210;
+//nop;
+if (v0 == t7) goto L42df8c;
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42e144;
+L42df8c:
+v1 = MEM_U16(a3 + 48);
+t1 = 0x211;
+lo = v0 * v1;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)v1 >> 32);
+t9 = v1 << 2;
+t9 = t9 + v1;
+t9 = t9 << 3;
+MEM_U32(sp + 96) = t9;
+a0 = MEM_U32(a3 + 32);
+a2 = lo;
+//nop;
+if (a0 == 0) goto L42dfd8;
+v0 = MEM_U32(s0 + 52);
+//nop;
+t0 = v0 - a0;
+if (a0 >= v0) goto L42dfd8;
+t2 = MEM_U32(sp + 108);
+if (t0 >= a2) goto L42dfec;
+L42dfd8:
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t1;
+goto L42e144;
+// fdead 0 t2 = MEM_U32(sp + 108);
+L42dfec:
+t3 = MEM_U32(sp + 96);
+at = a2 < t3;
+if (t2 == 0) goto L42e01c;
+t4 = a0 & 0x3;
+if (a2 < t3) goto L42e01c;
+t6 = 0x1;
+if (t4 != 0) goto L42e01c;
+v0 = MEM_U32(s0 + 40);
+MEM_U32(s0 + 12) = t6;
+t5 = v0 + a0;
+MEM_U32(s0 + 92) = t5;
+goto L42e068;
+L42e01c:
+//nop;
+a0 = MEM_U32(sp + 96);
+MEM_U32(sp + 100) = a2;
+MEM_U32(sp + 44) = a3;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 100);
+a3 = MEM_U32(sp + 44);
+MEM_U32(s0 + 92) = v0;
+if (v0 != 0) goto L42e058;
+at = 0x100003e8;
+t7 = 0x411;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t7;
+goto L42e144;
+L42e058:
+t8 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t9 = t8 | 0x8;
+MEM_U32(s0 + 136) = t9;
+L42e068:
+t0 = MEM_U32(a3 + 32);
+t2 = 0x9;
+t1 = v0 + t0;
+MEM_U32(sp + 48) = t1;
+MEM_U32(sp + 52) = t2;
+MEM_U32(sp + 56) = a2;
+t3 = MEM_U32(s0 + 68);
+t5 = MEM_U32(sp + 96);
+MEM_U32(sp + 68) = t3;
+t4 = MEM_U32(s0 + 92);
+t6 = 0x1;
+//nop;
+MEM_U32(sp + 92) = t6;
+MEM_U32(sp + 80) = t5;
+MEM_U32(sp + 72) = t4;
+a1 = MEM_U32(a3 + 32);
+MEM_U32(sp + 44) = a3;
+a0 = s0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 44);
+a0 = sp + 0x48;
+if (v0 != 0) goto L42e104;
+//nop;
+a2 = MEM_U32(s0 + 64);
+MEM_U32(sp + 44) = a3;
+a1 = sp + 0x30;
+v0 = f__elf32_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 44);
+//nop;
+if (v0 == 0) goto L42e104;
+//nop;
+a1 = MEM_U16(a3 + 48);
+a0 = s0;
+v0 = f__elf_cookscn(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+if (v0 == 0) {
+v0 = zero;
+goto L42e144;}
+v0 = zero;
+L42e104:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffff7;
+t7 = v0 & 0x8;
+t8 = v0 & at;
+if (t7 == 0) goto L42e134;
+MEM_U32(s0 + 136) = t8;
+//nop;
+a0 = MEM_U32(s0 + 92);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42e134:
+MEM_U32(s0 + 92) = zero;
+v0 = 0xffffffff;
+goto L42e144;
+// fdead 0 v0 = zero;
+L42e144:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x68;
+return v0;
+}
+
+static uint32_t func_42e154(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+uint64_t temp64;
+L42e154:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 124) = a1;
+t0 = MEM_U32(a0 + 80);
+s0 = a0;
+t6 = MEM_U16(t0 + 60);
+a0 = 0x9;
+a1 = 0x1;
+if (t6 != 0) goto L42e194;
+v0 = zero;
+goto L42e40c;
+L42e194:
+//nop;
+a2 = MEM_U32(s0 + 68);
+MEM_U32(sp + 60) = t0;
+v0 = f__elf64_fsize(mem, sp, a0, a1, a2);
+t0 = MEM_U32(sp + 60);
+// bdead 4002020b gp = MEM_U32(sp + 24);
+t7 = MEM_U16(t0 + 58);
+t8 = 0x210;
+//nop;
+if (v0 == t7) goto L42e1cc;
+at = 0x100003e8;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+goto L42e40c;
+L42e1cc:
+a0 = MEM_U16(t0 + 60);
+t8 = 0x0;
+lo = v0 * a0;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)a0 >> 32);
+t1 = a0 << 6;
+MEM_U32(sp + 112) = t1;
+t2 = t8;
+t9 = lo;
+MEM_U32(sp + 116) = t9;
+t5 = MEM_U32(t0 + 44);
+t4 = MEM_U32(t0 + 40);
+MEM_U32(sp + 52) = t5;
+MEM_U32(sp + 48) = t4;
+at = t8 < t4;
+if (t4 != 0) goto L42e20c;
+//nop;
+if (t5 == 0) goto L42e26c;
+L42e20c:
+t6 = MEM_U32(s0 + 52);
+MEM_U32(sp + 40) = t8;
+// bdead 4202ea07 t9 = t6;
+MEM_U32(sp + 44) = t6;
+t3 = t6;
+if (at != 0) goto L42e26c;
+t7 = t3 - t5;
+if (t4 < t8) goto L42e238;
+if (t5 >= t6) {
+at = t3 < t5;
+goto L42e26c;}
+L42e238:
+at = t3 < t5;
+t6 = t2 - t4;
+t1 = MEM_U32(sp + 116);
+t6 = t6 - at;
+t8 = 0x0;
+// bdead 42038603 t9 = t1;
+if (t8 < t6) goto L42e280;
+if (t6 < t8) {
+at = t7 < t1;
+goto L42e26c;}
+t3 = MEM_U32(sp + 124);
+if (t7 >= t1) goto L42e284;
+L42e26c:
+at = 0x100003e8;
+t2 = 0x211;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42e40c;
+L42e280:
+t3 = MEM_U32(sp + 124);
+L42e284:
+t4 = MEM_U32(sp + 116);
+//nop;
+if (t3 == 0) goto L42e2e8;
+t5 = MEM_U32(sp + 112);
+a0 = MEM_U32(sp + 48);
+a2 = 0x0;
+if (t4 < t5) goto L42e2e8;
+//nop;
+a1 = MEM_U32(sp + 52);
+a3 = 0x8;
+MEM_U32(sp + 60) = t0;
+temp64 = wrapper___ull_rem((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4002001b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L42e2e8;
+t9 = 0x1;
+if (v1 != 0) goto L42e2e8;
+v0 = MEM_U32(s0 + 40);
+t7 = MEM_U32(t0 + 44);
+MEM_U32(s0 + 12) = t9;
+t8 = v0 + t7;
+MEM_U32(s0 + 92) = t8;
+goto L42e32c;
+L42e2e8:
+//nop;
+a0 = MEM_U32(sp + 112);
+MEM_U32(sp + 60) = t0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+MEM_U32(s0 + 92) = v0;
+if (v0 != 0) goto L42e31c;
+at = 0x100003e8;
+t2 = 0x411;
+v0 = 0xffffffff;
+MEM_U32(at + 0) = t2;
+goto L42e40c;
+L42e31c:
+t3 = MEM_U32(s0 + 136);
+v0 = MEM_U32(s0 + 40);
+t4 = t3 | 0x8;
+MEM_U32(s0 + 136) = t4;
+L42e32c:
+t7 = MEM_U32(t0 + 44);
+a2 = MEM_U32(sp + 116);
+t8 = 0x9;
+t1 = v0 + t7;
+MEM_U32(sp + 64) = t1;
+MEM_U32(sp + 68) = t8;
+MEM_U32(sp + 72) = a2;
+t2 = MEM_U32(s0 + 68);
+t4 = MEM_U32(sp + 112);
+MEM_U32(sp + 84) = t2;
+t3 = MEM_U32(s0 + 92);
+t6 = 0x1;
+//nop;
+MEM_U32(sp + 108) = t6;
+MEM_U32(sp + 96) = t4;
+MEM_U32(sp + 88) = t3;
+a1 = MEM_U32(t0 + 44);
+MEM_U32(sp + 60) = t0;
+a0 = s0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 6004002000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+a0 = sp + 0x58;
+if (v0 != 0) goto L42e3cc;
+//nop;
+a2 = MEM_U32(s0 + 64);
+MEM_U32(sp + 60) = t0;
+a1 = sp + 0x40;
+v0 = f__elf64_xlatetom(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L42e3cc;
+//nop;
+a1 = MEM_U16(t0 + 60);
+a0 = s0;
+v0 = f__elf_cookscn(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+if (v0 == 0) {
+v0 = zero;
+goto L42e40c;}
+v0 = zero;
+L42e3cc:
+v0 = MEM_U32(s0 + 136);
+at = 0xfffffff7;
+t5 = v0 & 0x8;
+t1 = v0 & at;
+if (t5 == 0) goto L42e3fc;
+MEM_U32(s0 + 136) = t1;
+//nop;
+a0 = MEM_U32(s0 + 92);
+//nop;
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 24);
+//nop;
+L42e3fc:
+MEM_U32(s0 + 92) = zero;
+v0 = 0xffffffff;
+goto L42e40c;
+// fdead 0 v0 = zero;
+L42e40c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x78;
+return v0;
+}
+
+static uint32_t func_42e41c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L42e41c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+t6 = MEM_U32(a0 + 0);
+s0 = a0;
+MEM_U32(sp + 52) = t6;
+a3 = MEM_U32(a0 + 40);
+t1 = MEM_U32(a0 + 52);
+t2 = t1 + a3;
+if (t6 == 0) goto L42e464;
+t8 = MEM_U32(t6 + 76);
+at = 0x1;
+//nop;
+if (t8 == at) goto L42e46c;
+L42e464:
+v0 = zero;
+goto L42e5b8;
+L42e46c:
+//nop;
+if (a1 == 0) goto L42e494;
+t9 = MEM_U32(s0 + 32);
+//nop;
+v0 = a3 - t9;
+t3 = v0 & 0x7;
+v0 = t3;
+if (t3 != 0) goto L42e4b4;
+v0 = zero;
+goto L42e5b8;
+L42e494:
+t4 = MEM_U32(s0 + 32);
+//nop;
+v0 = a3 - t4;
+t5 = v0 & 0x3;
+v0 = t5;
+if (t5 != 0) goto L42e4b4;
+v0 = zero;
+goto L42e5b8;
+L42e4b4:
+t6 = MEM_U32(s0 + 20);
+t0 = a3 - v0;
+a1 = t6 - v0;
+MEM_U32(s0 + 40) = t0;
+MEM_U32(s0 + 20) = a1;
+//nop;
+a0 = MEM_U32(sp + 52);
+MEM_U32(sp + 36) = t2;
+MEM_U32(sp + 40) = a3;
+MEM_U32(sp + 44) = t0;
+a2 = t1 + v0;
+v0 = f__elf_vm(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 36);
+//nop;
+if (v0 == 0) goto L42e504;
+v0 = 0xffffffff;
+goto L42e5b8;
+L42e504:
+t8 = MEM_U32(s0 + 52);
+// bdead 2000913 at = 0x10002fd0;
+t9 = t8 & 0x7;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L42e52c;
+case 1: goto L42e59c;
+case 2: goto L42e58c;
+case 3: goto L42e57c;
+case 4: goto L42e56c;
+case 5: goto L42e55c;
+case 6: goto L42e54c;
+case 7: goto L42e53c;
+}
+L42e52c:
+t3 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t3;
+L42e53c:
+t4 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t4;
+L42e54c:
+t5 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t5;
+L42e55c:
+t6 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t6;
+L42e56c:
+t7 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t7;
+L42e57c:
+t8 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t8;
+L42e58c:
+t9 = MEM_S8(a3 + 0);
+v1 = v1 + 0x1;
+a3 = a3 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t9;
+L42e59c:
+t3 = MEM_S8(a3 + 0);
+a3 = a3 + 0x1;
+at = a3 < t2;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t3;
+if (at != 0) goto L42e52c;
+v0 = zero;
+L42e5b8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x38;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t f__elf32_fsize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0, lo = 0, hi = 0;
+L42e644:
+//_elf32_fsize:
+//nop;
+//nop;
+//nop;
+a2 = a2 + 0xffffffff;
+at = a0 < 0xf;
+if (a2 == 0) goto L42e670;
+at = 0x100003e8;
+t6 = 0x517;
+v0 = zero;
+MEM_U32(at + 0) = t6;
+return v0;
+L42e670:
+t8 = a2 << 4;
+if (at != 0) goto L42e68c;
+at = 0x100003e8;
+t7 = 0x514;
+v0 = zero;
+MEM_U32(at + 0) = t7;
+return v0;
+L42e68c:
+t1 = 0x10002ff0;
+t8 = t8 - a2;
+t8 = t8 << 3;
+t9 = a0 << 3;
+t0 = t8 + t9;
+t1 = t1;
+t2 = t0 + t1;
+t3 = MEM_U32(t2 + 0);
+//nop;
+lo = t3 * a1;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)a1 >> 32);
+v0 = lo;
+//nop;
+//nop;
+//nop;
+return v0;
+}
+
+static uint32_t f__elf32_msize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L42e6c8:
+//_elf32_msize:
+//nop;
+//nop;
+//nop;
+t6 = a1 << 4;
+t9 = 0x10002ff0;
+t6 = t6 - a1;
+t6 = t6 << 3;
+t7 = a0 << 3;
+t8 = t6 + t7;
+t9 = t9;
+t0 = t8 + t9;
+v0 = MEM_U32(t0 + -116);
+//nop;
+return v0;
+}
+
+static uint32_t f__elf32_mtype(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L42e700:
+//_elf32_mtype:
+//nop;
+//nop;
+//nop;
+t6 = a1 << 2;
+if (a0 < 0xc) goto L42e720;
+v0 = zero;
+return v0;
+L42e720:
+t9 = 0x10003068;
+t6 = t6 - a1;
+t6 = t6 << 4;
+t7 = a0 << 2;
+t8 = t6 + t7;
+t9 = t9;
+t0 = t8 + t9;
+v0 = MEM_U32(t0 + -48);
+//nop;
+//nop;
+return v0;
+}
+
+static uint32_t func_42e74c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0, fp_dest;
+uint64_t temp64;
+L42e74c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s1 = a1;
+// fdead 400601eb MEM_U32(sp + 36) = ra;
+// fdead 400601eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 88) = a2;
+if (a0 == 0) goto L42e784;
+t6 = MEM_U32(sp + 88);
+if (a1 != 0) goto L42e790;
+L42e784:
+v0 = zero;
+goto L42ea10;
+// fdead 0 t6 = MEM_U32(sp + 88);
+L42e790:
+t8 = 0x50b;
+t7 = t6 + 0xffffffff;
+MEM_U32(sp + 88) = t7;
+if (t7 < 0x2) goto L42e7b4;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t8;
+goto L42ea10;
+L42e7b4:
+a0 = MEM_U32(s0 + 20);
+v0 = zero;
+a0 = a0 + 0xffffffff;
+//nop;
+if (a0 != 0) goto L42e7dc;
+v1 = MEM_U32(s1 + 20);
+//nop;
+v1 = v1 + 0xffffffff;
+//nop;
+if (v1 == 0) goto L42e7ec;
+L42e7dc:
+at = 0x100003e8;
+t9 = 0x517;
+MEM_U32(at + 0) = t9;
+goto L42ea10;
+L42e7ec:
+t0 = MEM_U32(s1 + 4);
+t3 = 0x514;
+a1 = t0;
+if (t0 < 0xf) goto L42e810;
+at = 0x100003e8;
+v0 = zero;
+MEM_U32(at + 0) = t3;
+goto L42ea10;
+L42e810:
+v0 = a1 << 3;
+if (a3 == 0) goto L42e8a0;
+t2 = 0x10002ff0;
+t4 = a0 << 4;
+t4 = t4 - a0;
+t4 = t4 << 3;
+t2 = t2;
+t5 = t2 + t4;
+v0 = a1 << 3;
+t6 = t5 + v0;
+t7 = v1 << 4;
+a2 = MEM_U32(t6 + 0);
+t7 = t7 - v1;
+t6 = MEM_U32(sp + 88);
+t7 = t7 << 3;
+t4 = v1 << 4;
+t3 = a0 << 4;
+t8 = t2 + t7;
+t3 = t3 - a0;
+t4 = t4 - v1;
+t4 = t4 << 4;
+t3 = t3 << 4;
+t7 = t6 << 4;
+t9 = t8 + v0;
+t5 = t3 + t4;
+t7 = t7 - t6;
+t3 = 0x100004b0;
+t7 = t7 << 3;
+a3 = MEM_U32(t9 + 4);
+t8 = t5 + t7;
+t9 = t8 + v0;
+t3 = t3;
+t4 = t9 + t3;
+t1 = MEM_U32(t4 + 0);
+t7 = MEM_U32(s1 + 8);
+goto L42e924;
+L42e8a0:
+t2 = 0x10002ff0;
+t6 = a0 << 4;
+t6 = t6 - a0;
+t6 = t6 << 3;
+t2 = t2;
+t5 = t2 + t6;
+t7 = t5 + v0;
+t8 = v1 << 4;
+a2 = MEM_U32(t7 + 4);
+t8 = t8 - v1;
+t7 = MEM_U32(sp + 88);
+t8 = t8 << 3;
+t6 = v1 << 4;
+t4 = a0 << 4;
+t9 = t2 + t8;
+t4 = t4 - a0;
+t6 = t6 - v1;
+t6 = t6 << 4;
+t4 = t4 << 4;
+t8 = t7 << 4;
+t3 = t9 + v0;
+t5 = t4 + t6;
+t8 = t8 - t7;
+t4 = 0x100004b0;
+t8 = t8 << 3;
+a3 = MEM_U32(t3 + 0);
+t9 = t5 + t8;
+t3 = t9 + v0;
+t4 = t4;
+t6 = t3 + t4;
+t1 = MEM_U32(t6 + 4);
+//nop;
+t7 = MEM_U32(s1 + 8);
+L42e924:
+t3 = 0x50a;
+lo = t7 / a3; hi = t7 % a3;
+MEM_U32(sp + 44) = t7;
+v0 = zero;
+// bdead 60440061789 t5 = t7;
+//nop;
+if (a3 != 0) goto L42e944;
+abort();
+L42e944:
+t8 = lo;
+MEM_U32(sp + 76) = t8;
+t9 = MEM_U32(s0 + 8);
+lo = a2 * t8;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)t8 >> 32);
+v1 = lo;
+//nop;
+if (t9 >= v1) goto L42e970;
+at = 0x100003e8;
+MEM_U32(at + 0) = t3;
+goto L42ea10;
+L42e970:
+t4 = 0x100003e4;
+t6 = MEM_U32(sp + 88);
+t4 = MEM_U32(t4 + 0);
+t7 = t6 + 0x1;
+t8 = MEM_U32(sp + 76);
+if (t4 != t7) goto L42e9d8;
+t8 = MEM_U32(sp + 76);
+if (a2 != a3) goto L42e9d8;
+a0 = MEM_U32(s0 + 0);
+a1 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (a0 == a1) goto L42e9c0;
+//nop;
+a2 = MEM_U32(sp + 44);
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 60001 gp = MEM_U32(sp + 32);
+t0 = MEM_U32(s1 + 4);
+//nop;
+L42e9c0:
+MEM_U32(s0 + 4) = t0;
+t5 = MEM_U32(s1 + 8);
+v0 = s0;
+MEM_U32(s0 + 8) = t5;
+goto L42ea10;
+// fdead 0 t8 = MEM_U32(sp + 76);
+L42e9d8:
+// bdead 60042060511 t9 = t1;
+a2 = t8;
+if (t8 == 0) goto L42ea00;
+a0 = MEM_U32(s0 + 0);
+a1 = MEM_U32(s1 + 0);
+fp_dest = t1;
+MEM_U32(sp + 40) = v1;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 40);
+//nop;
+L42ea00:
+MEM_U32(s0 + 8) = v1;
+t9 = MEM_U32(s1 + 4);
+v0 = s0;
+MEM_U32(s0 + 4) = t9;
+L42ea10:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x50;
+return v0;
+}
+
+static uint32_t f__elf32_xlatetom(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a3 = 0;
+L42ea5c:
+//_elf32_xlatetom:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a3 = zero;
+v0 = func_42e74c(mem, sp, a0, a1, a2, a3);
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint64_t func_42ea94(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42ea9c:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42ea9c;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42ead4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42eadc:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42eadc;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_42eb14(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+if (a0 == a1) goto L42eb48;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 19 gp = MEM_U32(sp + 24);
+//nop;
+L42eb48:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t func_42eb58(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+t6 = a2 << 3;
+v0 = t6 + a1;
+L42eb60:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x8;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -4);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+a0 = a0 + 0x8;
+MEM_U8(a0 + -4) = (uint8_t)a2;
+if (at != 0) goto L42eb60;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42ebb8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+t6 = a2 << 3;
+v0 = t6 + a1;
+L42ebc0:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x8;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -4);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+a0 = a0 + 0x8;
+MEM_U8(a0 + -1) = (uint8_t)a2;
+if (at != 0) goto L42ebc0;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42ec18(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+t6 = t6 << 2;
+t6 = t6 + a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 2;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L42ec5c:
+a0 = s0;
+if (s0 == s1) goto L42ec7c;
+//nop;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+//nop;
+L42ec7c:
+v1 = MEM_U16(s1 + 16);
+s1 = s1 + 0x34;
+t7 = (int)v1 >> 8;
+MEM_U8(s0 + 17) = (uint8_t)t7;
+MEM_U8(s0 + 16) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -34);
+at = s1 < s2;
+t8 = (int)a0 >> 8;
+MEM_U8(s0 + 19) = (uint8_t)t8;
+MEM_U8(s0 + 18) = (uint8_t)a0;
+v0 = MEM_U32(s1 + -32);
+s0 = s0 + 0x34;
+t9 = v0 >> 8;
+t0 = v0 >> 16;
+t1 = v0 >> 24;
+MEM_U8(s0 + -29) = (uint8_t)t1;
+MEM_U8(s0 + -30) = (uint8_t)t0;
+MEM_U8(s0 + -31) = (uint8_t)t9;
+MEM_U8(s0 + -32) = (uint8_t)v0;
+a1 = MEM_U32(s1 + -28);
+//nop;
+t2 = a1 >> 8;
+t3 = a1 >> 16;
+t4 = a1 >> 24;
+MEM_U8(s0 + -25) = (uint8_t)t4;
+MEM_U8(s0 + -26) = (uint8_t)t3;
+MEM_U8(s0 + -27) = (uint8_t)t2;
+MEM_U8(s0 + -28) = (uint8_t)a1;
+v0 = MEM_U32(s1 + -24);
+//nop;
+t5 = v0 >> 8;
+t6 = v0 >> 16;
+t7 = v0 >> 24;
+MEM_U8(s0 + -21) = (uint8_t)t7;
+MEM_U8(s0 + -22) = (uint8_t)t6;
+MEM_U8(s0 + -23) = (uint8_t)t5;
+MEM_U8(s0 + -24) = (uint8_t)v0;
+a0 = MEM_U32(s1 + -20);
+//nop;
+t8 = a0 >> 8;
+t9 = a0 >> 16;
+t0 = a0 >> 24;
+MEM_U8(s0 + -17) = (uint8_t)t0;
+MEM_U8(s0 + -18) = (uint8_t)t9;
+MEM_U8(s0 + -19) = (uint8_t)t8;
+MEM_U8(s0 + -20) = (uint8_t)a0;
+v0 = MEM_U32(s1 + -16);
+//nop;
+t1 = v0 >> 8;
+t2 = v0 >> 16;
+t3 = v0 >> 24;
+MEM_U8(s0 + -13) = (uint8_t)t3;
+MEM_U8(s0 + -14) = (uint8_t)t2;
+MEM_U8(s0 + -15) = (uint8_t)t1;
+MEM_U8(s0 + -16) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -12);
+//nop;
+t4 = (int)v1 >> 8;
+MEM_U8(s0 + -11) = (uint8_t)t4;
+MEM_U8(s0 + -12) = (uint8_t)v1;
+v0 = MEM_U16(s1 + -10);
+//nop;
+t5 = (int)v0 >> 8;
+MEM_U8(s0 + -9) = (uint8_t)t5;
+MEM_U8(s0 + -10) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -8);
+//nop;
+t6 = (int)v1 >> 8;
+MEM_U8(s0 + -7) = (uint8_t)t6;
+MEM_U8(s0 + -8) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -6);
+//nop;
+t7 = (int)a0 >> 8;
+MEM_U8(s0 + -5) = (uint8_t)t7;
+MEM_U8(s0 + -6) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -4);
+//nop;
+t8 = (int)a1 >> 8;
+MEM_U8(s0 + -3) = (uint8_t)t8;
+MEM_U8(s0 + -4) = (uint8_t)a1;
+v0 = MEM_U16(s1 + -2);
+//nop;
+t9 = (int)v0 >> 8;
+MEM_U8(s0 + -1) = (uint8_t)t9;
+MEM_U8(s0 + -2) = (uint8_t)v0;
+if (at != 0) goto L42ec5c;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42edec(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+t6 = a2 << 2;
+t6 = t6 - a2;
+t6 = t6 << 2;
+t6 = t6 + a2;
+// fdead 400081e3 MEM_U32(sp + 28) = s2;
+// fdead 400081e3 MEM_U32(sp + 24) = s1;
+// fdead 400081e3 MEM_U32(sp + 20) = s0;
+t6 = t6 << 2;
+s0 = a0;
+s1 = a1;
+// fdead 400681e3 MEM_U32(sp + 36) = ra;
+// fdead 400681e3 MEM_U32(sp + 32) = gp;
+s2 = t6 + a1;
+L42ee30:
+a0 = s0;
+if (s0 == s1) goto L42ee50;
+//nop;
+a1 = s1;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+//nop;
+L42ee50:
+v1 = MEM_U16(s1 + 16);
+s1 = s1 + 0x34;
+t7 = (int)v1 >> 8;
+MEM_U8(s0 + 16) = (uint8_t)t7;
+MEM_U8(s0 + 17) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -34);
+at = s1 < s2;
+t8 = (int)a0 >> 8;
+MEM_U8(s0 + 18) = (uint8_t)t8;
+MEM_U8(s0 + 19) = (uint8_t)a0;
+v0 = MEM_U32(s1 + -32);
+s0 = s0 + 0x34;
+t9 = v0 >> 8;
+t0 = v0 >> 16;
+t1 = v0 >> 24;
+MEM_U8(s0 + -32) = (uint8_t)t1;
+MEM_U8(s0 + -31) = (uint8_t)t0;
+MEM_U8(s0 + -30) = (uint8_t)t9;
+MEM_U8(s0 + -29) = (uint8_t)v0;
+a1 = MEM_U32(s1 + -28);
+//nop;
+t2 = a1 >> 8;
+t3 = a1 >> 16;
+t4 = a1 >> 24;
+MEM_U8(s0 + -28) = (uint8_t)t4;
+MEM_U8(s0 + -27) = (uint8_t)t3;
+MEM_U8(s0 + -26) = (uint8_t)t2;
+MEM_U8(s0 + -25) = (uint8_t)a1;
+v0 = MEM_U32(s1 + -24);
+//nop;
+t5 = v0 >> 8;
+t6 = v0 >> 16;
+t7 = v0 >> 24;
+MEM_U8(s0 + -24) = (uint8_t)t7;
+MEM_U8(s0 + -23) = (uint8_t)t6;
+MEM_U8(s0 + -22) = (uint8_t)t5;
+MEM_U8(s0 + -21) = (uint8_t)v0;
+a0 = MEM_U32(s1 + -20);
+//nop;
+t8 = a0 >> 8;
+t9 = a0 >> 16;
+t0 = a0 >> 24;
+MEM_U8(s0 + -20) = (uint8_t)t0;
+MEM_U8(s0 + -19) = (uint8_t)t9;
+MEM_U8(s0 + -18) = (uint8_t)t8;
+MEM_U8(s0 + -17) = (uint8_t)a0;
+v0 = MEM_U32(s1 + -16);
+//nop;
+t1 = v0 >> 8;
+t2 = v0 >> 16;
+t3 = v0 >> 24;
+MEM_U8(s0 + -16) = (uint8_t)t3;
+MEM_U8(s0 + -15) = (uint8_t)t2;
+MEM_U8(s0 + -14) = (uint8_t)t1;
+MEM_U8(s0 + -13) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -12);
+//nop;
+t4 = (int)v1 >> 8;
+MEM_U8(s0 + -12) = (uint8_t)t4;
+MEM_U8(s0 + -11) = (uint8_t)v1;
+v0 = MEM_U16(s1 + -10);
+//nop;
+t5 = (int)v0 >> 8;
+MEM_U8(s0 + -10) = (uint8_t)t5;
+MEM_U8(s0 + -9) = (uint8_t)v0;
+v1 = MEM_U16(s1 + -8);
+//nop;
+t6 = (int)v1 >> 8;
+MEM_U8(s0 + -8) = (uint8_t)t6;
+MEM_U8(s0 + -7) = (uint8_t)v1;
+a0 = MEM_U16(s1 + -6);
+//nop;
+t7 = (int)a0 >> 8;
+MEM_U8(s0 + -6) = (uint8_t)t7;
+MEM_U8(s0 + -5) = (uint8_t)a0;
+a1 = MEM_U16(s1 + -4);
+//nop;
+t8 = (int)a1 >> 8;
+MEM_U8(s0 + -4) = (uint8_t)t8;
+MEM_U8(s0 + -3) = (uint8_t)a1;
+v0 = MEM_U16(s1 + -2);
+//nop;
+t9 = (int)v0 >> 8;
+MEM_U8(s0 + -2) = (uint8_t)t9;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+if (at != 0) goto L42ee30;
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42efc0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+t6 = a2 << 1;
+v0 = t6 + a1;
+L42efc8:
+v1 = MEM_U16(a1 + 0);
+a1 = a1 + 0x2;
+at = a1 < v0;
+t7 = (int)v1 >> 8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x2;
+MEM_U8(a0 + -2) = (uint8_t)v1;
+if (at != 0) goto L42efc8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42eff0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+t6 = a2 << 1;
+v0 = t6 + a1;
+L42eff8:
+v1 = MEM_U16(a1 + 0);
+a1 = a1 + 0x2;
+at = a1 < v0;
+t7 = (int)v1 >> 8;
+MEM_U8(a0 + 0) = (uint8_t)t7;
+a0 = a0 + 0x2;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42eff8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f020(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42f028:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f028;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f060(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42f068:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f068;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f0a0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 5;
+v0 = t6 + a1;
+L42f0a8:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x20;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -28);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+MEM_U8(a0 + 4) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -24);
+a0 = a0 + 0x20;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -21) = (uint8_t)t5;
+MEM_U8(a0 + -22) = (uint8_t)t4;
+MEM_U8(a0 + -23) = (uint8_t)t3;
+MEM_U8(a0 + -24) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -20);
+//nop;
+t6 = v1 >> 8;
+t7 = v1 >> 16;
+t8 = v1 >> 24;
+MEM_U8(a0 + -17) = (uint8_t)t8;
+MEM_U8(a0 + -18) = (uint8_t)t7;
+MEM_U8(a0 + -19) = (uint8_t)t6;
+MEM_U8(a0 + -20) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -16);
+//nop;
+t9 = a2 >> 8;
+t0 = a2 >> 16;
+t1 = a2 >> 24;
+MEM_U8(a0 + -13) = (uint8_t)t1;
+MEM_U8(a0 + -14) = (uint8_t)t0;
+MEM_U8(a0 + -15) = (uint8_t)t9;
+MEM_U8(a0 + -16) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -12);
+//nop;
+t2 = v1 >> 8;
+t3 = v1 >> 16;
+t4 = v1 >> 24;
+MEM_U8(a0 + -9) = (uint8_t)t4;
+MEM_U8(a0 + -10) = (uint8_t)t3;
+MEM_U8(a0 + -11) = (uint8_t)t2;
+MEM_U8(a0 + -12) = (uint8_t)v1;
+a3 = MEM_U32(a1 + -8);
+//nop;
+t5 = a3 >> 8;
+t6 = a3 >> 16;
+t7 = a3 >> 24;
+MEM_U8(a0 + -5) = (uint8_t)t7;
+MEM_U8(a0 + -6) = (uint8_t)t6;
+MEM_U8(a0 + -7) = (uint8_t)t5;
+MEM_U8(a0 + -8) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -4);
+//nop;
+t8 = v1 >> 8;
+t9 = v1 >> 16;
+t0 = v1 >> 24;
+MEM_U8(a0 + -1) = (uint8_t)t0;
+MEM_U8(a0 + -2) = (uint8_t)t9;
+MEM_U8(a0 + -3) = (uint8_t)t8;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f0a8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f1d4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 5;
+v0 = t6 + a1;
+L42f1dc:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x20;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -28);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+MEM_U8(a0 + 7) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -24);
+a0 = a0 + 0x20;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -24) = (uint8_t)t5;
+MEM_U8(a0 + -23) = (uint8_t)t4;
+MEM_U8(a0 + -22) = (uint8_t)t3;
+MEM_U8(a0 + -21) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -20);
+//nop;
+t6 = v1 >> 8;
+t7 = v1 >> 16;
+t8 = v1 >> 24;
+MEM_U8(a0 + -20) = (uint8_t)t8;
+MEM_U8(a0 + -19) = (uint8_t)t7;
+MEM_U8(a0 + -18) = (uint8_t)t6;
+MEM_U8(a0 + -17) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -16);
+//nop;
+t9 = a2 >> 8;
+t0 = a2 >> 16;
+t1 = a2 >> 24;
+MEM_U8(a0 + -16) = (uint8_t)t1;
+MEM_U8(a0 + -15) = (uint8_t)t0;
+MEM_U8(a0 + -14) = (uint8_t)t9;
+MEM_U8(a0 + -13) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -12);
+//nop;
+t2 = v1 >> 8;
+t3 = v1 >> 16;
+t4 = v1 >> 24;
+MEM_U8(a0 + -12) = (uint8_t)t4;
+MEM_U8(a0 + -11) = (uint8_t)t3;
+MEM_U8(a0 + -10) = (uint8_t)t2;
+MEM_U8(a0 + -9) = (uint8_t)v1;
+a3 = MEM_U32(a1 + -8);
+//nop;
+t5 = a3 >> 8;
+t6 = a3 >> 16;
+t7 = a3 >> 24;
+MEM_U8(a0 + -8) = (uint8_t)t7;
+MEM_U8(a0 + -7) = (uint8_t)t6;
+MEM_U8(a0 + -6) = (uint8_t)t5;
+MEM_U8(a0 + -5) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -4);
+//nop;
+t8 = v1 >> 8;
+t9 = v1 >> 16;
+t0 = v1 >> 24;
+MEM_U8(a0 + -4) = (uint8_t)t0;
+MEM_U8(a0 + -3) = (uint8_t)t9;
+MEM_U8(a0 + -2) = (uint8_t)t8;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f1dc;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f308(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+t6 = a2 << 3;
+v0 = t6 + a1;
+L42f310:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x8;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -4);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+a0 = a0 + 0x8;
+MEM_U8(a0 + -4) = (uint8_t)a2;
+if (at != 0) goto L42f310;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f368(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+t6 = a2 << 3;
+v0 = t6 + a1;
+L42f370:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x8;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -4);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+a0 = a0 + 0x8;
+MEM_U8(a0 + -1) = (uint8_t)a2;
+if (at != 0) goto L42f370;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f3c8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+t6 = t6 - a2;
+t6 = t6 << 2;
+v0 = t6 + a1;
+L42f3d8:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0xc;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -8);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+MEM_U8(a0 + 4) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -4);
+a0 = a0 + 0xc;
+t3 = v1 >> 8;
+t4 = v1 >> 16;
+t5 = v1 >> 24;
+MEM_U8(a0 + -1) = (uint8_t)t5;
+MEM_U8(a0 + -2) = (uint8_t)t4;
+MEM_U8(a0 + -3) = (uint8_t)t3;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f3d8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f450(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+t6 = t6 - a2;
+t6 = t6 << 2;
+v0 = t6 + a1;
+L42f460:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0xc;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -8);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+MEM_U8(a0 + 7) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -4);
+a0 = a0 + 0xc;
+t3 = v1 >> 8;
+t4 = v1 >> 16;
+t5 = v1 >> 24;
+MEM_U8(a0 + -4) = (uint8_t)t5;
+MEM_U8(a0 + -3) = (uint8_t)t4;
+MEM_U8(a0 + -2) = (uint8_t)t3;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f460;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f4d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+t6 = t6 + a2;
+t6 = t6 << 3;
+v0 = t6 + a1;
+L42f4e8:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x28;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -36);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+MEM_U8(a0 + 4) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -32);
+a0 = a0 + 0x28;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -29) = (uint8_t)t5;
+MEM_U8(a0 + -30) = (uint8_t)t4;
+MEM_U8(a0 + -31) = (uint8_t)t3;
+MEM_U8(a0 + -32) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -28);
+//nop;
+t6 = v1 >> 8;
+t7 = v1 >> 16;
+t8 = v1 >> 24;
+MEM_U8(a0 + -25) = (uint8_t)t8;
+MEM_U8(a0 + -26) = (uint8_t)t7;
+MEM_U8(a0 + -27) = (uint8_t)t6;
+MEM_U8(a0 + -28) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -24);
+//nop;
+t9 = a2 >> 8;
+t0 = a2 >> 16;
+t1 = a2 >> 24;
+MEM_U8(a0 + -21) = (uint8_t)t1;
+MEM_U8(a0 + -22) = (uint8_t)t0;
+MEM_U8(a0 + -23) = (uint8_t)t9;
+MEM_U8(a0 + -24) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -20);
+//nop;
+t2 = v1 >> 8;
+t3 = v1 >> 16;
+t4 = v1 >> 24;
+MEM_U8(a0 + -17) = (uint8_t)t4;
+MEM_U8(a0 + -18) = (uint8_t)t3;
+MEM_U8(a0 + -19) = (uint8_t)t2;
+MEM_U8(a0 + -20) = (uint8_t)v1;
+a3 = MEM_U32(a1 + -16);
+//nop;
+t5 = a3 >> 8;
+t6 = a3 >> 16;
+t7 = a3 >> 24;
+MEM_U8(a0 + -13) = (uint8_t)t7;
+MEM_U8(a0 + -14) = (uint8_t)t6;
+MEM_U8(a0 + -15) = (uint8_t)t5;
+MEM_U8(a0 + -16) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -12);
+//nop;
+t8 = v1 >> 8;
+t9 = v1 >> 16;
+t0 = v1 >> 24;
+MEM_U8(a0 + -9) = (uint8_t)t0;
+MEM_U8(a0 + -10) = (uint8_t)t9;
+MEM_U8(a0 + -11) = (uint8_t)t8;
+MEM_U8(a0 + -12) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -8);
+//nop;
+t1 = a2 >> 8;
+t2 = a2 >> 16;
+t3 = a2 >> 24;
+MEM_U8(a0 + -5) = (uint8_t)t3;
+MEM_U8(a0 + -6) = (uint8_t)t2;
+MEM_U8(a0 + -7) = (uint8_t)t1;
+MEM_U8(a0 + -8) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -4);
+//nop;
+t4 = v1 >> 8;
+t5 = v1 >> 16;
+t6 = v1 >> 24;
+MEM_U8(a0 + -1) = (uint8_t)t6;
+MEM_U8(a0 + -2) = (uint8_t)t5;
+MEM_U8(a0 + -3) = (uint8_t)t4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f4e8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f65c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+t6 = t6 + a2;
+t6 = t6 << 3;
+v0 = t6 + a1;
+L42f66c:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x28;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -36);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+MEM_U8(a0 + 7) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -32);
+a0 = a0 + 0x28;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -32) = (uint8_t)t5;
+MEM_U8(a0 + -31) = (uint8_t)t4;
+MEM_U8(a0 + -30) = (uint8_t)t3;
+MEM_U8(a0 + -29) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -28);
+//nop;
+t6 = v1 >> 8;
+t7 = v1 >> 16;
+t8 = v1 >> 24;
+MEM_U8(a0 + -28) = (uint8_t)t8;
+MEM_U8(a0 + -27) = (uint8_t)t7;
+MEM_U8(a0 + -26) = (uint8_t)t6;
+MEM_U8(a0 + -25) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -24);
+//nop;
+t9 = a2 >> 8;
+t0 = a2 >> 16;
+t1 = a2 >> 24;
+MEM_U8(a0 + -24) = (uint8_t)t1;
+MEM_U8(a0 + -23) = (uint8_t)t0;
+MEM_U8(a0 + -22) = (uint8_t)t9;
+MEM_U8(a0 + -21) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -20);
+//nop;
+t2 = v1 >> 8;
+t3 = v1 >> 16;
+t4 = v1 >> 24;
+MEM_U8(a0 + -20) = (uint8_t)t4;
+MEM_U8(a0 + -19) = (uint8_t)t3;
+MEM_U8(a0 + -18) = (uint8_t)t2;
+MEM_U8(a0 + -17) = (uint8_t)v1;
+a3 = MEM_U32(a1 + -16);
+//nop;
+t5 = a3 >> 8;
+t6 = a3 >> 16;
+t7 = a3 >> 24;
+MEM_U8(a0 + -16) = (uint8_t)t7;
+MEM_U8(a0 + -15) = (uint8_t)t6;
+MEM_U8(a0 + -14) = (uint8_t)t5;
+MEM_U8(a0 + -13) = (uint8_t)a3;
+v1 = MEM_U32(a1 + -12);
+//nop;
+t8 = v1 >> 8;
+t9 = v1 >> 16;
+t0 = v1 >> 24;
+MEM_U8(a0 + -12) = (uint8_t)t0;
+MEM_U8(a0 + -11) = (uint8_t)t9;
+MEM_U8(a0 + -10) = (uint8_t)t8;
+MEM_U8(a0 + -9) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -8);
+//nop;
+t1 = a2 >> 8;
+t2 = a2 >> 16;
+t3 = a2 >> 24;
+MEM_U8(a0 + -8) = (uint8_t)t3;
+MEM_U8(a0 + -7) = (uint8_t)t2;
+MEM_U8(a0 + -6) = (uint8_t)t1;
+MEM_U8(a0 + -5) = (uint8_t)a2;
+v1 = MEM_U32(a1 + -4);
+//nop;
+t4 = v1 >> 8;
+t5 = v1 >> 16;
+t6 = v1 >> 24;
+MEM_U8(a0 + -4) = (uint8_t)t6;
+MEM_U8(a0 + -3) = (uint8_t)t5;
+MEM_U8(a0 + -2) = (uint8_t)t4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f66c;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f7e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42f7e8:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f7e8;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f820(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42f828:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f828;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f860(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 4;
+v0 = t6 + a1;
+L42f868:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x10;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+MEM_U8(a0 + 0) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -12);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 7) = (uint8_t)t2;
+MEM_U8(a0 + 6) = (uint8_t)t1;
+MEM_U8(a0 + 5) = (uint8_t)t0;
+MEM_U8(a0 + 4) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -8);
+a0 = a0 + 0x10;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -5) = (uint8_t)t5;
+MEM_U8(a0 + -6) = (uint8_t)t4;
+MEM_U8(a0 + -7) = (uint8_t)t3;
+MEM_U8(a0 + -8) = (uint8_t)a3;
+t6 = MEM_U8(a1 + -4);
+//nop;
+MEM_U8(a0 + -4) = (uint8_t)t6;
+t7 = MEM_U8(a1 + -3);
+//nop;
+MEM_U8(a0 + -3) = (uint8_t)t7;
+v1 = MEM_U16(a1 + -2);
+//nop;
+t8 = (int)v1 >> 8;
+MEM_U8(a0 + -1) = (uint8_t)t8;
+MEM_U8(a0 + -2) = (uint8_t)v1;
+if (at != 0) goto L42f868;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f90c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 4;
+v0 = t6 + a1;
+L42f914:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x10;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+MEM_U8(a0 + 3) = (uint8_t)v1;
+a2 = MEM_U32(a1 + -12);
+at = a1 < v0;
+t0 = a2 >> 8;
+t1 = a2 >> 16;
+t2 = a2 >> 24;
+MEM_U8(a0 + 4) = (uint8_t)t2;
+MEM_U8(a0 + 5) = (uint8_t)t1;
+MEM_U8(a0 + 6) = (uint8_t)t0;
+MEM_U8(a0 + 7) = (uint8_t)a2;
+a3 = MEM_U32(a1 + -8);
+a0 = a0 + 0x10;
+t3 = a3 >> 8;
+t4 = a3 >> 16;
+t5 = a3 >> 24;
+MEM_U8(a0 + -8) = (uint8_t)t5;
+MEM_U8(a0 + -7) = (uint8_t)t4;
+MEM_U8(a0 + -6) = (uint8_t)t3;
+MEM_U8(a0 + -5) = (uint8_t)a3;
+t6 = MEM_U8(a1 + -4);
+//nop;
+MEM_U8(a0 + -4) = (uint8_t)t6;
+t7 = MEM_U8(a1 + -3);
+//nop;
+MEM_U8(a0 + -3) = (uint8_t)t7;
+v1 = MEM_U16(a1 + -2);
+//nop;
+t8 = (int)v1 >> 8;
+MEM_U8(a0 + -2) = (uint8_t)t8;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42f914;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f9b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42f9c0:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 3) = (uint8_t)t9;
+MEM_U8(a0 + 2) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)v1;
+if (at != 0) goto L42f9c0;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42f9f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+t6 = a2 << 2;
+v0 = t6 + a1;
+L42fa00:
+v1 = MEM_U32(a1 + 0);
+a1 = a1 + 0x4;
+at = a1 < v0;
+t7 = v1 >> 8;
+t8 = v1 >> 16;
+t9 = v1 >> 24;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+MEM_U8(a0 + 1) = (uint8_t)t8;
+MEM_U8(a0 + 2) = (uint8_t)t7;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -1) = (uint8_t)v1;
+if (at != 0) goto L42fa00;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fa38(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42fa94;
+L42fa58:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42fa58;
+L42fa94:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fa9c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L42faf8;
+L42fabc:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L42fabc;
+L42faf8:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fb00(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 3;
+a0 = a0 + t6;
+t7 = a2 << 3;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff8;
+if (v1 == 0) goto L42fb88;
+L42fb20:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -5);
+t0 = MEM_U8(a1 + -6);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -7);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -8);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xfffffff8;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffff8;
+if (v1 != 0) goto L42fb20;
+L42fb88:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fb90(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 3;
+a0 = a0 + t6;
+t7 = a2 << 3;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff8;
+if (v1 == 0) goto L42fc18;
+L42fbb0:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -8);
+t0 = MEM_U8(a1 + -7);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -6);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -5);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xfffffff8;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffff8;
+if (v1 != 0) goto L42fbb0;
+L42fc18:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fc20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+v1 = a2 << 2;
+v1 = v1 - a2;
+v1 = v1 << 2;
+sp = sp + 0xffffffd8;
+v1 = v1 + a2;
+// fdead 400001f3 MEM_U32(sp + 24) = s1;
+v1 = v1 << 2;
+s1 = a0 + v1;
+// fdead 400401f3 MEM_U32(sp + 28) = s2;
+// fdead 400401f3 MEM_U32(sp + 20) = s0;
+v0 = a0 < s1;
+// fdead 400401fb MEM_U32(sp + 36) = ra;
+// fdead 400401fb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v1;
+s1 = s1 + 0xffffffcc;
+if (v0 == 0) goto L42fe1c;
+L42fc70:
+t7 = MEM_U8(s0 + -1);
+t6 = MEM_U8(s0 + -2);
+t8 = t7 << 8;
+t9 = t6 + t8;
+MEM_U16(s1 + 50) = (uint16_t)t9;
+t1 = MEM_U8(s0 + -3);
+t0 = MEM_U8(s0 + -4);
+t2 = t1 << 8;
+t3 = t0 + t2;
+MEM_U16(s1 + 48) = (uint16_t)t3;
+t5 = MEM_U8(s0 + -5);
+t4 = MEM_U8(s0 + -6);
+t7 = t5 << 8;
+t6 = t4 + t7;
+MEM_U16(s1 + 46) = (uint16_t)t6;
+t9 = MEM_U8(s0 + -7);
+t8 = MEM_U8(s0 + -8);
+t1 = t9 << 8;
+t0 = t8 + t1;
+MEM_U16(s1 + 44) = (uint16_t)t0;
+t3 = MEM_U8(s0 + -9);
+t2 = MEM_U8(s0 + -10);
+t5 = t3 << 8;
+t4 = t2 + t5;
+MEM_U16(s1 + 42) = (uint16_t)t4;
+t6 = MEM_U8(s0 + -11);
+t7 = MEM_U8(s0 + -12);
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U16(s1 + 40) = (uint16_t)t8;
+t1 = MEM_U8(s0 + -13);
+t3 = MEM_U8(s0 + -14);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -15);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -16);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 36) = t8;
+t1 = MEM_U8(s0 + -17);
+t3 = MEM_U8(s0 + -18);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -19);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t7 = MEM_U8(s0 + -20);
+t6 = t5 + t4;
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U32(s1 + 32) = t8;
+t1 = MEM_U8(s0 + -21);
+t3 = MEM_U8(s0 + -22);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -23);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -24);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 28) = t8;
+t1 = MEM_U8(s0 + -25);
+t3 = MEM_U8(s0 + -26);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -27);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t7 = MEM_U8(s0 + -28);
+t6 = t5 + t4;
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U32(s1 + 24) = t8;
+t1 = MEM_U8(s0 + -29);
+t3 = MEM_U8(s0 + -30);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -31);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -32);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 20) = t8;
+t0 = MEM_U8(s0 + -33);
+t1 = MEM_U8(s0 + -34);
+t3 = t0 << 8;
+t2 = t1 + t3;
+MEM_U16(s1 + 18) = (uint16_t)t2;
+t4 = MEM_U8(s0 + -35);
+t5 = MEM_U8(s0 + -36);
+t6 = t4 << 8;
+s0 = s0 + 0xffffffcc;
+t9 = t5 + t6;
+MEM_U16(s1 + 16) = (uint16_t)t9;
+if (s1 == s0) goto L42fe10;
+//nop;
+a0 = s1;
+a1 = s0;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+//nop;
+L42fe10:
+v0 = s2 < s1;
+s1 = s1 + 0xffffffcc;
+if (v0 != 0) goto L42fc70;
+L42fe1c:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_42fe34(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+//nop;
+//nop;
+//nop;
+v1 = a2 << 2;
+v1 = v1 - a2;
+v1 = v1 << 2;
+sp = sp + 0xffffffd8;
+v1 = v1 + a2;
+// fdead 400001f3 MEM_U32(sp + 24) = s1;
+v1 = v1 << 2;
+s1 = a0 + v1;
+// fdead 400401f3 MEM_U32(sp + 28) = s2;
+// fdead 400401f3 MEM_U32(sp + 20) = s0;
+v0 = a0 < s1;
+// fdead 400401fb MEM_U32(sp + 36) = ra;
+// fdead 400401fb MEM_U32(sp + 32) = gp;
+s2 = a0;
+s0 = a1 + v1;
+s1 = s1 + 0xffffffcc;
+if (v0 == 0) goto L430030;
+L42fe84:
+t7 = MEM_U8(s0 + -2);
+t6 = MEM_U8(s0 + -1);
+t8 = t7 << 8;
+t9 = t6 + t8;
+MEM_U16(s1 + 50) = (uint16_t)t9;
+t1 = MEM_U8(s0 + -4);
+t0 = MEM_U8(s0 + -3);
+t2 = t1 << 8;
+t3 = t0 + t2;
+MEM_U16(s1 + 48) = (uint16_t)t3;
+t5 = MEM_U8(s0 + -6);
+t4 = MEM_U8(s0 + -5);
+t7 = t5 << 8;
+t6 = t4 + t7;
+MEM_U16(s1 + 46) = (uint16_t)t6;
+t9 = MEM_U8(s0 + -8);
+t8 = MEM_U8(s0 + -7);
+t1 = t9 << 8;
+t0 = t8 + t1;
+MEM_U16(s1 + 44) = (uint16_t)t0;
+t3 = MEM_U8(s0 + -10);
+t2 = MEM_U8(s0 + -9);
+t5 = t3 << 8;
+t4 = t2 + t5;
+MEM_U16(s1 + 42) = (uint16_t)t4;
+t6 = MEM_U8(s0 + -12);
+t7 = MEM_U8(s0 + -11);
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U16(s1 + 40) = (uint16_t)t8;
+t1 = MEM_U8(s0 + -16);
+t3 = MEM_U8(s0 + -15);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -14);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -13);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 36) = t8;
+t1 = MEM_U8(s0 + -20);
+t3 = MEM_U8(s0 + -19);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -18);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t7 = MEM_U8(s0 + -17);
+t6 = t5 + t4;
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U32(s1 + 32) = t8;
+t1 = MEM_U8(s0 + -24);
+t3 = MEM_U8(s0 + -23);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -22);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -21);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 28) = t8;
+t1 = MEM_U8(s0 + -28);
+t3 = MEM_U8(s0 + -27);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -26);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t7 = MEM_U8(s0 + -25);
+t6 = t5 + t4;
+t9 = t6 << 8;
+t8 = t7 + t9;
+MEM_U32(s1 + 24) = t8;
+t1 = MEM_U8(s0 + -32);
+t3 = MEM_U8(s0 + -31);
+t0 = t1 << 8;
+t4 = MEM_U8(s0 + -30);
+t2 = t0 + t3;
+t5 = t2 << 8;
+t9 = MEM_U8(s0 + -29);
+t6 = t5 + t4;
+t7 = t6 << 8;
+t8 = t9 + t7;
+MEM_U32(s1 + 20) = t8;
+t0 = MEM_U8(s0 + -34);
+t1 = MEM_U8(s0 + -33);
+t3 = t0 << 8;
+t2 = t1 + t3;
+MEM_U16(s1 + 18) = (uint16_t)t2;
+t4 = MEM_U8(s0 + -36);
+t5 = MEM_U8(s0 + -35);
+t6 = t4 << 8;
+s0 = s0 + 0xffffffcc;
+t9 = t5 + t6;
+MEM_U16(s1 + 16) = (uint16_t)t9;
+if (s1 == s0) goto L430024;
+//nop;
+a0 = s1;
+a1 = s0;
+a2 = 0x10;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 400e0011 gp = MEM_U32(sp + 32);
+//nop;
+L430024:
+v0 = s2 < s1;
+s1 = s1 + 0xffffffcc;
+if (v0 != 0) goto L42fe84;
+L430030:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430048(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 1;
+a0 = a0 + t6;
+t7 = a2 << 1;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffe;
+if (v1 == 0) goto L43008c;
+L430068:
+t9 = MEM_U8(a1 + -1);
+t8 = MEM_U8(a1 + -2);
+t0 = t9 << 8;
+v1 = v0 < a0;
+t1 = t8 + t0;
+a1 = a1 + 0xfffffffe;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+a0 = a0 + 0xfffffffe;
+if (v1 != 0) goto L430068;
+L43008c:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430094(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 1;
+a0 = a0 + t6;
+t7 = a2 << 1;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffe;
+if (v1 == 0) goto L4300d8;
+L4300b4:
+t9 = MEM_U8(a1 + -2);
+t8 = MEM_U8(a1 + -1);
+t0 = t9 << 8;
+v1 = v0 < a0;
+t1 = t8 + t0;
+a1 = a1 + 0xfffffffe;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+a0 = a0 + 0xfffffffe;
+if (v1 != 0) goto L4300b4;
+L4300d8:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4300e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L43013c;
+L430100:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430100;
+L43013c:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430144(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L4301a0;
+L430164:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430164;
+L4301a0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4301a8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 5;
+a0 = a0 + t6;
+t7 = a2 << 5;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xffffffe0;
+if (v1 == 0) goto L430338;
+L4301c8:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 28) = t7;
+t8 = MEM_U8(a1 + -5);
+t0 = MEM_U8(a1 + -6);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -7);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -8);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 24) = t7;
+t8 = MEM_U8(a1 + -9);
+t0 = MEM_U8(a1 + -10);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -11);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -12);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 20) = t7;
+t8 = MEM_U8(a1 + -13);
+t0 = MEM_U8(a1 + -14);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -15);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -16);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 16) = t7;
+t8 = MEM_U8(a1 + -17);
+t0 = MEM_U8(a1 + -18);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -19);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -20);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 12) = t7;
+t8 = MEM_U8(a1 + -21);
+t0 = MEM_U8(a1 + -22);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -23);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -24);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 8) = t7;
+t8 = MEM_U8(a1 + -25);
+t0 = MEM_U8(a1 + -26);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -27);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -28);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -29);
+t0 = MEM_U8(a1 + -30);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -31);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -32);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xffffffe0;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xffffffe0;
+if (v1 != 0) goto L4301c8;
+L430338:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 5;
+a0 = a0 + t6;
+t7 = a2 << 5;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xffffffe0;
+if (v1 == 0) goto L4304d0;
+L430360:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 28) = t7;
+t8 = MEM_U8(a1 + -8);
+t0 = MEM_U8(a1 + -7);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -6);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -5);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 24) = t7;
+t8 = MEM_U8(a1 + -12);
+t0 = MEM_U8(a1 + -11);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -10);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -9);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 20) = t7;
+t8 = MEM_U8(a1 + -16);
+t0 = MEM_U8(a1 + -15);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -14);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -13);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 16) = t7;
+t8 = MEM_U8(a1 + -20);
+t0 = MEM_U8(a1 + -19);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -18);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -17);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 12) = t7;
+t8 = MEM_U8(a1 + -24);
+t0 = MEM_U8(a1 + -23);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -22);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -21);
+t4 = t2 + t3;
+t6 = t4 << 8;
+t7 = t5 + t6;
+MEM_U32(a0 + 8) = t7;
+t8 = MEM_U8(a1 + -28);
+t0 = MEM_U8(a1 + -27);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -26);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -25);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -32);
+t0 = MEM_U8(a1 + -31);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -30);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -29);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xffffffe0;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xffffffe0;
+if (v1 != 0) goto L430360;
+L4304d0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4304d8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 3;
+a0 = a0 + t6;
+t7 = a2 << 3;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff8;
+if (v1 == 0) goto L430560;
+L4304f8:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -5);
+t0 = MEM_U8(a1 + -6);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -7);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -8);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xfffffff8;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffff8;
+if (v1 != 0) goto L4304f8;
+L430560:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430568(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 3;
+a0 = a0 + t6;
+t7 = a2 << 3;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff8;
+if (v1 == 0) goto L4305f0;
+L430588:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+t7 = t6 + t5;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U8(a1 + -8);
+t0 = MEM_U8(a1 + -7);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -6);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t5 = MEM_U8(a1 + -5);
+t4 = t2 + t3;
+t6 = t4 << 8;
+v1 = v0 < a0;
+t7 = t5 + t6;
+a1 = a1 + 0xfffffff8;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffff8;
+if (v1 != 0) goto L430588;
+L4305f0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4305f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v1 = a2 << 2;
+v1 = v1 - a2;
+v0 = a0;
+v1 = v1 << 2;
+a0 = a0 + v1;
+a3 = v0 < a0;
+a1 = a1 + v1;
+a0 = a0 + 0xfffffff4;
+if (a3 == 0) goto L4306b0;
+L43061c:
+t6 = MEM_U8(a1 + -1);
+t8 = MEM_U8(a1 + -2);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -3);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -4);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 8) = t5;
+t6 = MEM_U8(a1 + -5);
+t8 = MEM_U8(a1 + -6);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -7);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -8);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 4) = t5;
+t6 = MEM_U8(a1 + -9);
+t8 = MEM_U8(a1 + -10);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -11);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -12);
+t2 = t0 + t1;
+t3 = t2 << 8;
+a3 = v0 < a0;
+t5 = t4 + t3;
+a1 = a1 + 0xfffffff4;
+MEM_U32(a0 + 0) = t5;
+a0 = a0 + 0xfffffff4;
+if (a3 != 0) goto L43061c;
+L4306b0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_4306b8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v1 = a2 << 2;
+v1 = v1 - a2;
+v0 = a0;
+v1 = v1 << 2;
+a0 = a0 + v1;
+a3 = v0 < a0;
+a1 = a1 + v1;
+a0 = a0 + 0xfffffff4;
+if (a3 == 0) goto L430770;
+L4306dc:
+t6 = MEM_U8(a1 + -4);
+t8 = MEM_U8(a1 + -3);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -2);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -1);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 8) = t5;
+t6 = MEM_U8(a1 + -8);
+t8 = MEM_U8(a1 + -7);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -6);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -5);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 4) = t5;
+t6 = MEM_U8(a1 + -12);
+t8 = MEM_U8(a1 + -11);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -10);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -9);
+t2 = t0 + t1;
+t3 = t2 << 8;
+a3 = v0 < a0;
+t5 = t4 + t3;
+a1 = a1 + 0xfffffff4;
+MEM_U32(a0 + 0) = t5;
+a0 = a0 + 0xfffffff4;
+if (a3 != 0) goto L4306dc;
+L430770:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430778(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v1 = a2 << 2;
+v1 = v1 + a2;
+v0 = a0;
+v1 = v1 << 3;
+a0 = a0 + v1;
+a3 = v0 < a0;
+a1 = a1 + v1;
+a0 = a0 + 0xffffffd8;
+if (a3 == 0) goto L430964;
+L43079c:
+t6 = MEM_U8(a1 + -1);
+t8 = MEM_U8(a1 + -2);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -3);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -4);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 36) = t5;
+t6 = MEM_U8(a1 + -5);
+t8 = MEM_U8(a1 + -6);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -7);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -8);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 32) = t5;
+t6 = MEM_U8(a1 + -9);
+t8 = MEM_U8(a1 + -10);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -11);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -12);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 28) = t5;
+t6 = MEM_U8(a1 + -13);
+t8 = MEM_U8(a1 + -14);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -15);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -16);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 24) = t5;
+t6 = MEM_U8(a1 + -17);
+t8 = MEM_U8(a1 + -18);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -19);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -20);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 20) = t5;
+t6 = MEM_U8(a1 + -21);
+t8 = MEM_U8(a1 + -22);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -23);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -24);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 16) = t5;
+t6 = MEM_U8(a1 + -25);
+t8 = MEM_U8(a1 + -26);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -27);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -28);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 12) = t5;
+t6 = MEM_U8(a1 + -29);
+t8 = MEM_U8(a1 + -30);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -31);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -32);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 8) = t5;
+t6 = MEM_U8(a1 + -33);
+t8 = MEM_U8(a1 + -34);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -35);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -36);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 4) = t5;
+t6 = MEM_U8(a1 + -37);
+t8 = MEM_U8(a1 + -38);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -39);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -40);
+t2 = t0 + t1;
+t4 = t2 << 8;
+a3 = v0 < a0;
+t5 = t3 + t4;
+a1 = a1 + 0xffffffd8;
+MEM_U32(a0 + 0) = t5;
+a0 = a0 + 0xffffffd8;
+if (a3 != 0) goto L43079c;
+L430964:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_43096c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v1 = a2 << 2;
+v1 = v1 + a2;
+v0 = a0;
+v1 = v1 << 3;
+a0 = a0 + v1;
+a3 = v0 < a0;
+a1 = a1 + v1;
+a0 = a0 + 0xffffffd8;
+if (a3 == 0) goto L430b58;
+L430990:
+t6 = MEM_U8(a1 + -4);
+t8 = MEM_U8(a1 + -3);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -2);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -1);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 36) = t5;
+t6 = MEM_U8(a1 + -8);
+t8 = MEM_U8(a1 + -7);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -6);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -5);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 32) = t5;
+t6 = MEM_U8(a1 + -12);
+t8 = MEM_U8(a1 + -11);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -10);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -9);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 28) = t5;
+t6 = MEM_U8(a1 + -16);
+t8 = MEM_U8(a1 + -15);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -14);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -13);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 24) = t5;
+t6 = MEM_U8(a1 + -20);
+t8 = MEM_U8(a1 + -19);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -18);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -17);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 20) = t5;
+t6 = MEM_U8(a1 + -24);
+t8 = MEM_U8(a1 + -23);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -22);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -21);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 16) = t5;
+t6 = MEM_U8(a1 + -28);
+t8 = MEM_U8(a1 + -27);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -26);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -25);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 12) = t5;
+t6 = MEM_U8(a1 + -32);
+t8 = MEM_U8(a1 + -31);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -30);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -29);
+t2 = t0 + t1;
+t4 = t2 << 8;
+t5 = t3 + t4;
+MEM_U32(a0 + 8) = t5;
+t6 = MEM_U8(a1 + -36);
+t8 = MEM_U8(a1 + -35);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -34);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t4 = MEM_U8(a1 + -33);
+t2 = t0 + t1;
+t3 = t2 << 8;
+t5 = t4 + t3;
+MEM_U32(a0 + 4) = t5;
+t6 = MEM_U8(a1 + -40);
+t8 = MEM_U8(a1 + -39);
+t7 = t6 << 8;
+t1 = MEM_U8(a1 + -38);
+t9 = t7 + t8;
+t0 = t9 << 8;
+t3 = MEM_U8(a1 + -37);
+t2 = t0 + t1;
+t4 = t2 << 8;
+a3 = v0 < a0;
+t5 = t3 + t4;
+a1 = a1 + 0xffffffd8;
+MEM_U32(a0 + 0) = t5;
+a0 = a0 + 0xffffffd8;
+if (a3 != 0) goto L430990;
+L430b58:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430b60(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L430bbc;
+L430b80:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430b80;
+L430bbc:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430bc4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L430c20;
+L430be4:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430be4;
+L430c20:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430c28(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 4;
+a0 = a0 + t6;
+t7 = a2 << 4;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff0;
+if (v1 == 0) goto L430d00;
+L430c48:
+t9 = MEM_U8(a1 + -1);
+t8 = MEM_U8(a1 + -2);
+t0 = t9 << 8;
+t1 = t8 + t0;
+MEM_U16(a0 + 14) = (uint16_t)t1;
+t2 = MEM_U8(a1 + -3);
+v1 = v0 < a0;
+MEM_U8(a0 + 13) = (uint8_t)t2;
+t3 = MEM_U8(a1 + -4);
+a1 = a1 + 0xfffffff0;
+MEM_U8(a0 + 12) = (uint8_t)t3;
+t4 = MEM_U8(a1 + 11);
+t6 = MEM_U8(a1 + 10);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 9);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t2 = MEM_U8(a1 + 8);
+t0 = t9 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(a0 + 8) = t3;
+t4 = MEM_U8(a1 + 7);
+t6 = MEM_U8(a1 + 6);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 5);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t1 = MEM_U8(a1 + 4);
+t0 = t9 + t8;
+t2 = t0 << 8;
+t3 = t1 + t2;
+MEM_U32(a0 + 4) = t3;
+t4 = MEM_U8(a1 + 3);
+t6 = MEM_U8(a1 + 2);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 1);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t2 = MEM_U8(a1 + 0);
+t0 = t9 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(a0 + 0) = t3;
+a0 = a0 + 0xfffffff0;
+if (v1 != 0) goto L430c48;
+L430d00:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430d08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 4;
+a0 = a0 + t6;
+t7 = a2 << 4;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffff0;
+if (v1 == 0) goto L430de0;
+L430d28:
+t9 = MEM_U8(a1 + -2);
+t8 = MEM_U8(a1 + -1);
+t0 = t9 << 8;
+t1 = t8 + t0;
+MEM_U16(a0 + 14) = (uint16_t)t1;
+t2 = MEM_U8(a1 + -3);
+v1 = v0 < a0;
+MEM_U8(a0 + 13) = (uint8_t)t2;
+t3 = MEM_U8(a1 + -4);
+a1 = a1 + 0xfffffff0;
+MEM_U8(a0 + 12) = (uint8_t)t3;
+t4 = MEM_U8(a1 + 8);
+t6 = MEM_U8(a1 + 9);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 10);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t2 = MEM_U8(a1 + 11);
+t0 = t9 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(a0 + 8) = t3;
+t4 = MEM_U8(a1 + 4);
+t6 = MEM_U8(a1 + 5);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 6);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t1 = MEM_U8(a1 + 7);
+t0 = t9 + t8;
+t2 = t0 << 8;
+t3 = t1 + t2;
+MEM_U32(a0 + 4) = t3;
+t4 = MEM_U8(a1 + 0);
+t6 = MEM_U8(a1 + 1);
+t5 = t4 << 8;
+t8 = MEM_U8(a1 + 2);
+t7 = t5 + t6;
+t9 = t7 << 8;
+t2 = MEM_U8(a1 + 3);
+t0 = t9 + t8;
+t1 = t0 << 8;
+t3 = t2 + t1;
+MEM_U32(a0 + 0) = t3;
+a0 = a0 + 0xfffffff0;
+if (v1 != 0) goto L430d28;
+L430de0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430de8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L430e44;
+L430e08:
+t8 = MEM_U8(a1 + -1);
+t0 = MEM_U8(a1 + -2);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -3);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -4);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430e08;
+L430e44:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t func_430e4c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+v0 = a0;
+t6 = a2 << 2;
+a0 = a0 + t6;
+t7 = a2 << 2;
+v1 = v0 < a0;
+a1 = a1 + t7;
+a0 = a0 + 0xfffffffc;
+if (v1 == 0) goto L430ea8;
+L430e6c:
+t8 = MEM_U8(a1 + -4);
+t0 = MEM_U8(a1 + -3);
+t9 = t8 << 8;
+t3 = MEM_U8(a1 + -2);
+t1 = t9 + t0;
+t2 = t1 << 8;
+t6 = MEM_U8(a1 + -1);
+t4 = t2 + t3;
+t5 = t4 << 8;
+v1 = v0 < a0;
+t7 = t6 + t5;
+a1 = a1 + 0xfffffffc;
+MEM_U32(a0 + 0) = t7;
+a0 = a0 + 0xfffffffc;
+if (v1 != 0) goto L430e6c;
+L430ea8:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
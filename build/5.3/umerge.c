@@ -0,0 +1,28019 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x25733a20,0x25732c20,0x0,0x25733a20,0x6572726f,0x72202564,0x20286572,0x726f7220,
+0x636f6465,0x20756e6b,0x6e6f776e,0x292c2000,0x5f696e6c,0x696e6500,0x726f7774,0x685f6c69,
+0x6d697400,0x25733a20,0x6e6f2076,0x616c7565,0x20666f72,0x2025732e,0xa000000,0x42000000,
+0x4c000000,0x25733a20,0x6e6f2076,0x616c7565,0x20666f72,0x2025732e,0xa000000,0x6c696d69,
+0x74000000,0x25733a20,0x6e6f2066,0x696c656e,0x616d6520,0x666f7220,0x25732e0a,0x0,
+0x25733a20,0x752d636f,0x6465206f,0x75747075,0x74206669,0x6c652025,0x7320616c,0x72656164,
+0x79207370,0x65636966,0x6965643b,0x20257320,0x69676e6f,0x7265642e,0xa000000,0x74726170,
+0x75760000,0x25733a20,0x73796d62,0x6f6c2074,0x61626c65,0x2066696c,0x65202573,0x20616c72,
+0x65616479,0x20737065,0x63696669,0x65643b20,0x25732069,0x676e6f72,0x65642e0a,0x0,
+0x25733a20,0x66656564,0x6261636b,0x2066696c,0x65202573,0x20616c72,0x65616479,0x20737065,
+0x63696669,0x65643b20,0x25732069,0x676e6f72,0x65642e0a,0x0,0x776f7063,0x6f646500,
+0x65627567,0x0,0x6f5f696e,0x69745f74,0x6f5f6173,0x73000000,0x6f5f7072,0x6f6d6f74,
+0x696f6e00,0x6f696e6c,0x696e6500,0x6e6c696e,0x655f616c,0x6c000000,0x6e6c696e,0x655f746f,
+0x0,0x626d6178,0x0,0x25733a20,0x6e6f2076,0x616c7565,0x20666f72,0x2025732e,
+0xa000000,0x70616365,0x5f74696d,0x65000000,0x25733a20,0x6e6f2076,0x616c7565,0x20666f72,
+0x2025732e,0xa000000,0x69707332,0x0,0x25733a20,0x25732069,0x73206e6f,0x74206120,
+0x7265636f,0x676e697a,0x6564206f,0x7074696f,0x6e2e0a00,0x25733a20,0x752d636f,0x64652069,
+0x6e707574,0x2066696c,0x65202573,0x20616c72,0x65616479,0x20737065,0x63696669,0x65643b20,
+0x25732069,0x676e6f72,0x65642e0a,0x0,0x25733a20,0x752d636f,0x64652069,0x6e707574,
+0x2066696c,0x65206e6f,0x74207370,0x65636966,0x6965642e,0xa000000,0x25733a20,0x752d636f,
+0x6465206f,0x75747075,0x74206669,0x6c65206e,0x6f742073,0x70656369,0x66696564,0x2e0a0000,
+0x25733a20,0x73796d62,0x6f6c2074,0x61626c65,0x2066696c,0x65206e6f,0x74207370,0x65636966,
+0x6965642e,0xa000000,0x55736167,0x65206973,0x3a202573,0x20696e66,0x696c6520,0x5b2d6620,
+0x66656564,0x6261636b,0x66696c65,0x202d7420,0x73796d66,0x696c655d,0x202d6f20,0x6f757466,
+0x696c6520,0x5b6f7074,0x696f6e73,0x2e2e2e5d,0xa6f7074,0x696f6e73,0x20617265,0x3a0a092d,
+0x47206e0a,0x92d454c,0xa092d45,0x420a092d,0x673c302d,0x333e0a09,0x2d4f3c30,0x2d343e0a,
+0x92d6465,0x6275670a,0x92d760a,0x92d6920,0x66696c65,0xa092d69,0x6e6c696e,0x655f616c,
+0x6c0a092d,0x6e6f696e,0x6c696e65,0xa092d6e,0x6f5f696e,0x69745f74,0x6f5f6173,0x730a092d,
+0x6e6f5f70,0x726f6d6f,0x74696f6e,0xa092d73,0x70616365,0x5f74696d,0x6520780a,0x92d696e,
+0x6c696e65,0x5f746f20,0x6e0a0000,0x6f70656e,0x696e6720,0x752d636f,0x64652069,0x6e707574,
+0x2025732e,0x0,0x67657474,0x696e6720,0x73746174,0x7573206f,0x6e202573,0x2e000000,
+0x25733a20,0x756e6162,0x6c652074,0x6f20616c,0x6c6f6361,0x74652025,0x64206279,0x74652075,
+0x2d636f64,0x65206172,0x7261792e,0xa000000,0x72656164,0x696e6720,0x752d636f,0x64652069,
+0x6e707574,0x2025732e,0x0,0x25733a20,0x73745f72,0x65616462,0x696e6172,0x79206661,
+0x696c6564,0x206f6e20,0x25732e0a,0x0,0x6f70656e,0x696e6720,0x752d636f,0x6465206f,
+0x75747075,0x74202573,0x2e000000,0x77726974,0x696e6720,0x752d636f,0x6465206f,0x75747075,
+0x74202573,0x2e000000,0x6f70656e,0x696e6720,0x66656564,0x6261636b,0x20696e70,0x75742025,
+0x732e0000,0x67657474,0x696e6720,0x73746174,0x7573206f,0x6e202573,0x2e000000,0x25733a20,
+0x756e6162,0x6c652074,0x6f20616c,0x6c6f6361,0x74652025,0x64206279,0x74652066,0x65656462,
+0x61636b20,0x62756666,0x65722e0a,0x0,0x72656164,0x696e6720,0x66656564,0x6261636b,
+0x2066696c,0x65202573,0x2e000000,0x25733a20,0x66656564,0x6261636b,0x2066696c,0x65207374,
+0x616d7020,0x3d202578,0x2c206e6f,0x74202578,0x2e0a0000,0x72000000,0x25733a20,0x4572726f,
+0x723a2063,0x616e6e6f,0x74206f70,0x656e2066,0x6f726365,0x66696c65,0x2025730a,0x0,
+0x25733a20,0x4572726f,0x723a2069,0x6c6c6567,0x616c206c,0x696e6520,0x696e2066,0x6f726365,
+0x66696c65,0x2025730a,0x9272573,0x27000000,0x25733a20,0x4572726f,0x723a2063,0x616e6e6f,
+0x74206d61,0x6c6c6f63,0x20666f72,0x206e616d,0x656c6973,0x740a0000,0x73745f66,0x65696e69,
+0x74206361,0x6c6c6564,0x210a0000,0x6e616d65,0x2f6c656e,0x67746820,0x696e636f,0x6e736973,
+0x74656e63,0x7920696e,0x20666565,0x64626163,0x6b206669,0x6c652e0a,0x0,0x73796d62,
+0x6f6c2074,0x61626c65,0x20616e6f,0x6d616c79,0x20697379,0x6d202825,0x6429206e,0x6f742072,
+0x65666572,0x72656420,0x746f2062,0x79206578,0x7465726e,0x616c0a00,0xf03fa3f8,0xf03fab54,
+0xf03fa478,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,
+0xf03fa4f4,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,
+0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab54,
+0xf03fab54,0xf03fab54,0xf03fab54,0xf03fa9cc,0xf03fa2cc,0xf03fa76c,0xf03fab54,0xf03fa6f8,
+0xf03fa310,0xf03fab54,0xf03fa898,0xf03fab54,0xf03fab54,0xf03fab54,0xf03fab1c,0xf03fa7e0,
+0xf03fa580,0xf03fab54,0xf03fab54,0xf03fab54,0xf03faa74,0xf03fa620,0xf03fab54,0xf03fa9b0,
+0x496e7465,0x726e616c,0x20657272,0x6f723a20,0x616c6c20,0x65646765,0x73206e6f,0x7420656e,
+0x74657265,0x6420696e,0x20617272,0x6179496e,0x7465726e,0x616c2065,0x72726f72,0x3a207072,
+0x6f636564,0x75726520,0x636f756e,0x74206e6f,0x74207a65,0x726f2061,0x66746572,0x20706f73,
+0x746f7264,0x65722077,0x616c6b20,0x696e7374,0x72756374,0x696f6e73,0x20637963,0x6c65732c,
+0x202c2020,0x6174206c,0x696e6520,0x20696e20,0x696e6c69,0x6e652045,0x7374696d,0x61746564,
+0x2073697a,0x65207265,0x6c617469,0x76652074,0x6f206f72,0x6967696e,0x616c3a20,0x45737469,
+0x6d617465,0x64207275,0x6e74696d,0x65207265,0x6c617469,0x76652074,0x6f206f72,0x6967696e,
+0x616c3a20,0x0,0x0,0x0,0xf03fd340,0xf03fd47c,0xf03fd47c,0xf03fd340,
+0xf03fd47c,0xf03fd47c,0xf03fd340,0xf03fd340,0xf03fd250,0xf03fd47c,0xf03fd47c,0xf03fd340,
+0xf03fd0f0,0xf03fd340,0x27206967,0x6e6f7265,0x642e756d,0x65726765,0x3a205761,0x726e696e,
+0x673a2065,0x78747261,0x20706172,0x616d6574,0x65722873,0x2920746f,0x20272720,0x69676e6f,
+0x7265642e,0x756d6572,0x67653a20,0x5761726e,0x696e673a,0x20657874,0x72612070,0x6172616d,
+0x65746572,0x28732920,0x746f2027,0x20202020,0x696e6c69,0x6e696e67,0x20000000,0xf03fe268,
+0xf03fe874,0xf03fe874,0xf03fe6e8,0xf03fe3c8,0xf03fe6e8,0xf03fe874,0xf03fe874,0xf03fe874,
+0xf03fe890,0xf03fe874,0xf03fe874,0xf03fe874,0xf03fe874,0xf03fe6e8,0xf03fe874,0xf03fe268,
+0xf03fe6e8,0xf03fe874,0xf03fe874,0xf03fe6e8,0xf03fe6e8,0xf03fe6e8,0xf03fe874,0xf03fe874,
+0xf03fe874,0xf03fe304,0xf03fe378,0xf03fe874,0xf03fe874,0xf03fe874,0xf03fe268,0xf03fe874,
+0xf03fe874,0xf03fe874,0xf03fe874,0xf03fe3c8,0xf03fe874,0xf03fe874,0xf03fe268,0xf03fe874,
+0xf03fe874,0xf03fe874,0xf03fe874,0xf03fe6e8,0xf03fe874,0xf03fe690,0xf03fe3c8,0xf03fe6e8,
+0xf03fe5e8,0xf03fe874,0xf03fe874,0xf03fe3c8,0xf03fe874,0xf03fe874,0xf03fe3c8,0xf03fe6e8,
+0xf03fe268,0xf03fe874,0xf03fe874,0xf03fe3c8,0xf03fe2b4,0x206f7574,0x206f6620,0x41637475,
+0x616c2072,0x65666572,0x656e6365,0x20706172,0x616d6574,0x65727320,0x70726f6d,0x6f746564,
+0x3a20206f,0x7574206f,0x6620466f,0x726d616c,0x20726566,0x6572656e,0x63652070,0x6172616d,
+0x65746572,0x73207072,0x6f6d6f74,0x65643a20,0x27206967,0x6e6f7265,0x642e756d,0x65726765,
+0x3a205761,0x726e696e,0x673a2065,0x78747261,0x20706172,0x616d6574,0x65722873,0x2920746f,
+0x20272720,0x6e6f7420,0x70657266,0x6f726d65,0x64206265,0x63617573,0x65206974,0x20697320,
+0x72656375,0x72736976,0x652e756d,0x65726765,0x3a205761,0x726e696e,0x673a2075,0x7365722d,
+0x73706563,0x69666965,0x6420696e,0x6c696e69,0x6e672066,0x6f722063,0x616c6c20,0x746f2027,
+0x2020496e,0x6c696e65,0x20706173,0x733a0000,0xf03ff3d4,0xf03ff964,0xf03ff964,0xf03ff964,
+0xf03ff058,0xf03ff964,0xf03ff964,0xf03ff964,0xf03ffa1c,0xf03ff3e0,0xf03ff8d0,0x0,
+0x756d6572,0x67653a20,0x4572726f,0x723a2049,0x6c6c6567,0x616c2072,0x65646566,0x696e6974,
+0x696f6e20,0x6f662073,0x796d626f,0x6c20756d,0x65726765,0x2e70756d,0x65726765,0x3a204572,
+0x726f723a,0x20696e63,0x6f6e7369,0x7374656e,0x74206172,0x65612073,0x70656369,0x66696361,
+0x74696f6e,0x20696e20,0x73796d20,0xf0400588,0xf0400768,0xf0400768,0xf04007d4,0xf0400768,
+0xf0400768,0xf04006e4,0xf04007d4,0x756d6572,0x67653a20,0x4572726f,0x723a2075,0x2d636f64,
+0x65207265,0x66657265,0x6e636520,0x746f2075,0x6e646566,0x696e6564,0x2073796d,0x626f6c20,
+0x4e6f2045,0x4e442066,0x6f722070,0x726f6365,0x64757265,0x456e6420,0x6f662066,0x696c6520,
+0x696e2075,0x2d636f64,0x6520696e,0x70757420,0x6265666f,0x72652053,0x54504e6f,0x20454e44,
+0x20666f72,0x2070726f,0x63656475,0x72650000,0xf0401404,0xf0401990,0xf040142c,0xf04014b4,
+0xf0401990,0xf0401ae0,0xf0400ef0,0xf0401ae0,0xf0401ae0,0xf0401460,0xf0401ae0,0xf0401ae0,
+0xf0401318,0xf0401990,0xf0401990,0xf0401990,0xf0401144,0xf0401990,0xf0401990,0xf0401990,
+0xf04010bc,0xf0401ae0,0xf0400f38,0xf0401990,0xf0401990,0xf0401460,0xf0401990,0xf0401438,
+0xf0401460,0xf0401990,0xf0401990,0xf0401460,0xf0401460,0xf0401240,0xf0401988,0xf0400ef0,
+0xf0401ae0,0xf0401950,0xf0401ae0,0xf0401990,0xf0401864,0xf0401990,0xf040117c,0xf0400ef0,
+0xf0401990,0xf040196c,0xf0401990,0xf0401990,0xf0401108,0xf0401990,0xf0400e9c,0xf0401744,
+0xf0401460,0xf0401ae0,0xf04018e8,0xf0401990,0xf0401990,0xf0400e58,0xf0401990,0xf0401924,
+0xf0401444,0xf0401ae0,0xf0401b78,0xf04017dc,0xf0401990,0xf0401990,0xf0401990,0xf0401438,
+0xf0401e74,0xf0402118,0xf0402118,0xf0401e74,0xf0402118,0xf0402118,0xf0401e74,0x41737365,
+0x7274696f,0x6e206572,0x726f7249,0x6e746572,0x6e616c20,0x6572726f,0x723a2066,0x65656462,
+0x61636b20,0x66696c65,0x206c656e,0x67746820,0x646f6573,0x6e277420,0x6d617463,0x68206974,
+0x73207374,0x72756374,0x7572652e,0x20746f20,0x2c206c69,0x6e652046,0x65656462,0x61636b20,
+0x63616c6c,0x206e6f74,0x20666f75,0x6e643a20,0x20476f74,0x3a202020,0x20202020,0x20202020,
+0x20202020,0x20204578,0x70656374,0x65643a20,0x496e7465,0x726e616c,0x20657272,0x6f723a20,
+0x63616c6c,0x65722072,0x65636f72,0x64206d61,0x67696320,0x6e756d62,0x6572206d,0x69736d61,
+0x74636820,0x696e2066,0x65656462,0x61636b20,0x66696c65,0x2e206967,0x6e6f7265,0x642e4665,
+0x65646261,0x636b2066,0x6f722020,0x476f743a,0x20202020,0x20202020,0x20202020,0x20202020,
+0x20457870,0x65637465,0x643a2049,0x6e746572,0x6e616c20,0x6572726f,0x723a2063,0x616c6c65,
+0x65207265,0x636f7264,0x206d6167,0x6963206e,0x756d6265,0x72206d69,0x736d6174,0x63682069,
+0x6e206665,0x65646261,0x636b2066,0x696c652e,0x756d6572,0x67653a20,0x4572726f,0x723a2075,
+0x6e61626c,0x6520746f,0x20616c6c,0x6f636174,0x65206964,0x6d617021,0x552d636f,0x64652066,
+0x696c6520,0x646f6573,0x206e6f74,0x20626567,0x696e2077,0x69746820,0x42474e2e,0x0,
+0xf0403250,0xf0403258,0xf0403260,0xf0403268,0xf0403270,0xf0403278,0xf0403284,0xf0403290,
+0xf040329c,0xf04032a8,0x2028293a,0x20204f55,0x5428293a,0x2020494e,0x282c2063,0x616c6c65,
+0x645f696e,0x64697265,0x63746c79,0x2c207265,0x63757273,0x69766520,0x72656773,0x20736176,
+0x65642c20,0x20696e73,0x74727563,0x74696f6e,0x732c202c,0x20657874,0x65726e61,0x6c2c2061,
+0x74206c69,0x6e65202c,0x20706f73,0x746f7264,0x65722023,0x20282a69,0x6e646972,0x65637420,
+0x63616c6c,0x2a292028,0x2a657874,0x65726e61,0x6c2a2920,0x28000000,0x0,0x0,
+0x4f53594d,0x4b53594d,0x4d53594d,0x52435546,0x4c445243,0x49525354,0x49524c44,0x49535449,
+0x494c4449,0x5349474e,0x5353594d,0x4c454e44,0x4c54524d,0x4c424459,0x4c42474e,0x55424420,
+0x54504c45,0x54504745,0x54504754,0x54504c54,0x54504e45,0x54504551,0x43473220,0x43473120,
+0x494a5020,0x56524547,0x554e414c,0x4d504d56,0x504d4f56,0x49535354,0x49534c44,0x49435546,
+0x4c4e4f54,0x53485220,0x53484c20,0x4c53594d,0x4753594d,0x4653594d,0x4553594d,0x4353594d,
+0x584f5220,0x584a5020,0x554e4920,0x554a5020,0x54595020,0x544a5020,0x53575020,0x53554220,
+0x53545350,0x53545220,0x53545020,0x53544550,0x53515254,0x53515220,0x53475320,0x4853594d,
+0x4153594d,0x53444546,0x52535452,0x52504152,0x524e4420,0x524c4f44,0x524c4443,0x524c4441,
+0x52455420,0x52454753,0x504f5020,0x50444546,0x50415220,0x4f50544e,0x58504152,0x4f444420,
+0x4e4f5420,0x4e4f5020,0x4e455120,0x4e454720,0x4d555320,0x4d544147,0x4d535420,0x4d505920,
+0x4d4f5620,0x52454d20,0x4d4f4420,0x4d415820,0x4d494e20,0x4c4f4420,0x4c4f4320,0x4c455820,
+0x4c455320,0x4c455120,0x4c444150,0x4c445350,0x4c444320,0x4c444120,0x494c4441,0x4c434120,
+0x4c424420,0x4c444546,0x4c414220,0x49584120,0x49535452,0x494f5220,0x494e5420,0x494e4e20,
+0x494e4954,0x494e4320,0x494e4551,0x494c4f44,0x494c4553,0x494c4551,0x49475254,0x49474551,
+0x49455155,0x49445820,0x46494c4c,0x47525420,0x47455120,0x464a5020,0x45515520,0x41454e54,
+0x454e5420,0x454e4442,0x454e4420,0x44555020,0x44495620,0x44494620,0x44454620,0x44454320,
+0x4356544c,0x43565420,0x43555020,0x434f4d4d,0x4354524c,0x43554244,0x434c4244,0x434c4142,
+0x43494120,0x43484b4e,0x43484b4c,0x43484b48,0x43484b54,0x42535542,0x42474e42,0x42474e20,
+0x414f5320,0x414e4420,0x414c4941,0x41444a20,0x41444420,0x41425320,0x0,0x0,
+0x62616420,0x6d616769,0x6320696e,0x20686472,0x2e206578,0x70656374,0x65642030,0x7825782c,
+0x20676f74,0x20307825,0x780a0000,0x73745f72,0x65616473,0x743a2064,0x656e7365,0x206e756d,
+0x62657220,0x696e636f,0x6d706174,0x69626c65,0x2066726f,0x6d207665,0x7273696f,0x6e73206c,
+0x65737320,0x7468616e,0x20312e33,0x302c2070,0x6c656173,0x65207265,0x636f6d70,0x696c6520,
+0x66726f6d,0x20736372,0x61746368,0x20616e64,0x20757365,0x20636f6d,0x70617469,0x626c6520,
+0x636f6d70,0x6f6e656e,0x74730a00,0x73745f72,0x6561643a,0x20657272,0x6f722073,0x65656b69,
+0x6e670a00,0x73745f72,0x6561643a,0x20657272,0x6f722072,0x65616469,0x6e670a00,0x63616e6e,
+0x6f74206f,0x70656e20,0x73796d62,0x6f6c2074,0x61626c65,0x2066696c,0x65202573,0xa000000,
+0x77000000,0x73745f77,0x72697465,0x73743a20,0x63616e6e,0x6f742077,0x72697465,0x20746f20,
+0x66696c65,0x206e756d,0x62657220,0x25640a00,0x63616e6e,0x6f742077,0x72697465,0x20726f75,
+0x6e642062,0x79746573,0x20666f72,0x206c696e,0x65730a00,0x63616e6e,0x6f742077,0x72697465,
+0x20726f75,0x6e642062,0x79746573,0x20666f72,0x20737472,0x696e6773,0xa000000,0x63616e6e,
+0x6f742077,0x72697465,0x20726f75,0x6e642062,0x79746573,0x20666f72,0x20737472,0x696e6773,
+0xa000000,0x63616e6e,0x6f742077,0x72697465,0x2073796d,0x626f6c20,0x68656164,0x65720a00,
+0x73745f70,0x6366645f,0x6966643a,0x20696664,0x20282564,0x29206f75,0x74206f66,0x2072616e,
+0x67650a00,0x73745f70,0x73796d5f,0x6966645f,0x6973796d,0x3a206966,0x64202825,0x6429206f,
+0x72206973,0x796d2028,0x25642920,0x6f757420,0x6f662072,0x616e6765,0xa000000,0x73745f70,
+0x6175785f,0x69617578,0x3a206961,0x75782028,0x25642920,0x6f757420,0x6f662072,0x616e6765,
+0xa000000,0x0,0x0,0x0,0x73745f66,0x64616464,0x3a206e75,0x6d626572,
+0x206f6620,0x66696c65,0x73202825,0x64292065,0x78636565,0x6473206d,0x61782028,0x2564290a,
+0x0,0x73745f66,0x64616464,0x3a20616c,0x6c6f6361,0x74696f6e,0x20626f74,0x63682028,
+0x25642066,0x64732061,0x6e642025,0x64206366,0x64732920,0x696e2025,0x730a0000,0x0,
+0x3c2f3444,0x65627567,0x2f3e0000,0x3a000000,0x3a000000,0x73745f66,0x64616464,0x3a20636f,
+0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,0x6e616d65,0x21212025,0x640a0000,
+0x73745f66,0x64616464,0x3a20636f,0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,
+0x6e616d65,0x21202564,0xa000000,0x43616e6e,0x6f742073,0x745f6664,0x6164643a,0x2063616e,
+0x6e6f7420,0x6d616c6c,0x6f632025,0x64206279,0x74657320,0x746f2068,0x6f6c6420,0x66696c65,
+0x206e616d,0x650a0000,0x2f000000,0x256c7500,0x2d310000,0x256c7500,0x73745f73,0x74726164,
+0x643a2061,0x7267756d,0x656e7420,0x6973206e,0x696c0a00,0x73745f70,0x6175785f,0x6966645f,
+0x69617578,0x3a206966,0x64202825,0x6429206f,0x72206961,0x75782028,0x25642920,0x6f757420,
+0x6f662072,0x616e6765,0xa000000,0x73745f70,0x6175785f,0x6966645f,0x69617578,0x3a206966,
+0x64202825,0x6429206f,0x7220696c,0x696e6520,0x28256429,0x206f7574,0x206f6620,0x72616e67,
+0x650a0000,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,
+0x74656d20,0x6f662031,0x20627974,0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,
+0x6f662025,0x6c642062,0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,
+0x6c642062,0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,
+0x73745f65,0x78747374,0x72616464,0x3a20796f,0x75206469,0x646e2774,0x20696e69,0x7469616c,
+0x697a6520,0x77697468,0x20637569,0x6e697420,0x6f722072,0x65616473,0x740a0000,0x73745f65,
+0x78747374,0x72616464,0x3a206172,0x67756d65,0x6e742069,0x73206e69,0x6c0a0000,0x73745f69,
+0x646e5f64,0x6e3a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f69,0x646e5f72,0x6e64783a,
+0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x6375696e,
+0x6974206f,0x72207265,0x61647374,0xa000000,0x73745f72,0x6e64785f,0x69646e3a,0x2069646e,
+0x20282564,0x29206772,0x65617465,0x72207468,0x616e206d,0x61782028,0x2564290a,0x0,
+0x73745f72,0x6e64785f,0x69646e3a,0x206f6c64,0x20696e74,0x65726661,0x63652063,0x616e2774,
+0x20707574,0x20726664,0x28256429,0x20696e74,0x6f20726e,0x64782c20,0x75736520,0x73745f70,
+0x646e5f69,0x646e2069,0x6e737465,0x61640a00,0x73745f73,0x65746964,0x6e3a2069,0x646e7372,
+0x63202825,0x6429206f,0x72206964,0x6e646573,0x74202825,0x6429206f,0x7574206f,0x66207261,
+0x6e67650a,0x0,0x73745f70,0x6578745f,0x646e3a20,0x72666420,0x6669656c,0x64202825,
+0x64292069,0x736e2774,0x20657175,0x616c2074,0x6f205354,0x5f455854,0x49464428,0x2564290a,
+0x0,0x73745f70,0x6578745f,0x646e3a20,0x696e6465,0x78206f75,0x74206f66,0x2072616e,
+0x67652028,0x2564290a,0x0,0x6c69626d,0x6c640000,0x6c69626d,0x6c643a20,0x496e7465,
+0x726e616c,0x3a206361,0x6e6e6f74,0x20616c6c,0x6f636174,0x6520746f,0x20696e69,0x7469616c,
+0x697a6520,0x636f6d70,0x6f6e656e,0x74206e61,0x6d652066,0x6f72206c,0x69626d6c,0x64206572,
+0x726f7273,0xa000000,0x0,0x0,0x73745f63,0x75696e69,0x743a2063,0x616e6e6f,
+0x7420616c,0x6c6f6361,0x74652063,0x75727265,0x6e742063,0x6864720a,0x0,0x73745f65,
+0x78746164,0x643a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,0x6578745f,0x69657874,
+0x3a20696e,0x64657820,0x6f757420,0x6f662072,0x616e6765,0x20282564,0x290a0000,0x73745f69,
+0x646e5f69,0x6e646578,0x5f666578,0x743a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,
+0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,
+0x646e5f69,0x646e3a20,0x69646e20,0x28256429,0x206c6573,0x73207468,0x616e2030,0x206f7220,
+0x67726561,0x74657220,0x7468616e,0x206d6178,0x20282564,0x290a0000,0x0,0x0,
+0x73745f66,0x696c6562,0x6567696e,0x3a207472,0x69656420,0x746f2065,0x6e642074,0x6f6f206d,
+0x616e7920,0x66696c65,0x73202825,0x73290a00,0x73745f74,0x65787462,0x6c6f636b,0x3a20626c,
+0x6f636b20,0x70656e64,0x696e6720,0x73657420,0x696e2069,0x6c6c6567,0x616c2063,0x6173650a,
+0x0,0x73745f66,0x696c655f,0x69646e3a,0x20697374,0x61636b20,0x756e6465,0x72666c6f,
+0x77202825,0x73290a00,0x0,0x0,0x73776170,0x206f6620,0x61757873,0x206e6f74,
+0x20737570,0x706f7274,0x65642077,0x68656e20,0x64657374,0x73657820,0x213d2068,0x6f737473,
+0x65780a00,0xf04126e8,0xf0412804,0xf041287c,0xf041287c,0xf041287c,0xf041287c,0xf041287c,
+0x25733a20,0x4572726f,0x723a2000,0xa000000,0x25733a20,0x496e7465,0x726e616c,0x3a200000,
+0xa000000,0x0,0x0,0x0,0xa000000,0x25733a20,0x5761726e,0x696e673a,
+0x20000000,0xa000000,0x0,0x0,0x25733a20,0x496e7465,0x726e616c,0x3a200000,
+0xa000000,0x25733a20,0x4572726f,0x723a2000,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662031,0x20627974,
+0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,
+0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662025,0x6c642062,
+0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,0x5f6d645f,0x73745f6d,
+0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,0x6c642062,
+0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,0x0,
+0x74726965,0x6420746f,0x20726570,0x6c616365,0x20726e64,0x78206175,0x78202825,0x64292074,
+0x68617420,0x66697473,0x20696e74,0x6f206f6e,0x6520776f,0x72642028,0x25642c20,0x25642920,
+0x77697468,0x206f6e65,0x20746861,0x74206361,0x6e277420,0x2825642c,0x2564290a,0x0,
+0x2f746d70,0x2f706173,0x25642e25,0x64000000,0x77726974,0x656c6e20,0x63616c6c,0x6564206f,
+0x6e206669,0x6c65206e,0x6f74206f,0x70656e20,0x666f7220,0x77726974,0x696e672e,0xa000000,
+0x456e756d,0x65726174,0x65642076,0x616c7565,0x20272564,0x27206e6f,0x74207769,0x7468696e,
+0x20747970,0x652e0a00,0x696c6c65,0x67616c20,0x72616469,0x78207370,0x65636966,0x69656420,
+0x666f7220,0x696e7465,0x67657220,0x77726974,0x653a2025,0x640a0000,0x696c6c65,0x67616c20,
+0x72616469,0x78207370,0x65636966,0x69656420,0x666f7220,0x63617264,0x696e616c,0x20777269,
+0x74653a20,0x25640a00,0x20302e00,0x652b3030,0x30000000,0x20302e00,0x652b3030,0x30000000,
+0x74727565,0x0,0x66616c73,0x65000000,0x696c6c65,0x67616c20,0x72616469,0x78207370,
+0x65636966,0x69656420,0x666f7220,0x63617264,0x696e616c,0x36342077,0x72697465,0x3a202564,
+0xa000000,0x696c6c65,0x67616c20,0x72616469,0x78207370,0x65636966,0x69656420,0x666f7220,
+0x696e7465,0x67657236,0x34207772,0x6974653a,0x2025640a,0x0,0x0,0x0,
+0x4e6f2063,0x61736520,0x6d617463,0x68657320,0x76616c75,0x6520696e,0x20636173,0x65207374,
+0x6174656d,0x656e7420,0x6f6e2070,0x61676520,0x2564206c,0x696e6520,0x25642066,0x696c6520,
+0x25732e0a,0x0,0x61737365,0x7274696f,0x6e206661,0x696c6564,0x20257320,0xa000000,
+0x40282329,0x24486561,0x6465723a,0x20495249,0x5820352e,0x333a3130,0x32313537,0x32303333,
+0x20627569,0x6c742031,0x312f3033,0x2f393420,0x61742070,0x69676865,0x6172743a,0x2f6a6f69,
+0x73742f35,0x2e334d52,0x2f726f6f,0x74202400,};
+static const uint32_t data[] = {
+0x1,0x1,0x1,0x0,0x0,0x0,0x1,0x0,
+0x1,0x1,0x1f4,0x8,0x0,0x3f866666,0x40400000,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x8000,0x80000,0x8100,0x80000,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x800,0x8300000,0x1000,0x800,
+0x8100000,0x1000,0x800,0x8100000,0x2000000,0x1000000,0x800,0x200000,
+0x8000,0x80000,0x8100,0x80000,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x70090000,0x63616e6e,0x6f742077,0x72697465,
+0x20706669,0x656c6400,0x63616e6e,0x6f742077,0x72697465,0x20637572,0x20746162,0x6c650a00,
+0x726f7574,0x696e653a,0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,
+0x69746820,0x73745f63,0x75696e69,0x74206f72,0x2073745f,0x72656164,0x73740a00,0x726f7574,
+0x696e653a,0x206e6f20,0x63757272,0x656e7420,0x726f7574,0x696e652c,0x20736565,0x20666461,
+0x6464206f,0x72207365,0x7466640a,0x0,0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,
+0x61646420,0x746f2074,0x68697320,0x656e7472,0x79206974,0x20776173,0x20726561,0x64696e20,
+0x66726f6d,0x20646973,0x6b0a0000,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,0x61646420,0x746f2074,0x68697320,0x656e7472,
+0x79206974,0x20776173,0x20726561,0x64696e20,0x66726f6d,0x20646973,0x6b0a0000,0x0,
+0x0,0x0,0x0,0x0,0x100023bc,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x30313233,0x34353637,0x38396162,0x63646566,0x6768696a,0x6b6c6d6e,0x6f707172,0x73747576,
+0x7778797a,0x0,0x0,0x0,0xfb52904,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,};
+static void func_404a34(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_get_command_line(uint8_t *mem, uint32_t sp);
+static void f_get_ufile(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_put_ufile(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_get_feedback_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_read_inlinefile(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_dont_inline(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_force_inline(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_feinit(uint8_t *mem, uint32_t sp);
+static uint32_t func_406010(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_path_blockno(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_postorder_walk(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_build_postorder(uint8_t *mem, uint32_t sp);
+static void f_estimate_inline(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_is_leaf(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_become_leaf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_multiple_callers(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_set_inline(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_threshold(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_pack_knapsack(uint8_t *mem, uint32_t sp);
+static uint32_t f_roundup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_rounddown(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_fix_parm_offsets(uint8_t *mem, uint32_t sp);
+static uint32_t f_map_lab(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_one_instruction(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_put_comm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_align_to_double(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_has_readonly_init(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_inline_procedure(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_gen_pdefs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_gen_stores_from_fsym_init(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_inline_pass(uint8_t *mem, uint32_t sp);
+static void f_init_output(uint8_t *mem, uint32_t sp);
+static void f_grow_ubuffer_sym_update(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_grow_ubuffer(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_copy_to(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_inline_copy_to(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_modify(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_uoutput(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_check_for_more_space(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_change_to_nops(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_def_sym(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_find_sym(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_find_sym1(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_enter_readonly_init(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_add_to_parmlist(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_no_promotion(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_build_call_graph(uint8_t *mem, uint32_t sp);
+static void f_process_parm_parm_tab(uint8_t *mem, uint32_t sp);
+static void f_delete_syms(uint8_t *mem, uint32_t sp);
+static uint32_t f_bitcount(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_add_feedback(uint8_t *mem, uint32_t sp);
+static void f_rescan_for_ldas(uint8_t *mem, uint32_t sp);
+static void f_check_readonly_init(uint8_t *mem, uint32_t sp);
+static uint32_t f_main(uint8_t *mem, uint32_t sp);
+static uint32_t f_ulen(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_next_u(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_powerten(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_add_edge(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_search_procedure(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_find_procedure(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_find_parm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_write_asciz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_write_procedure(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_debug_dump(uint8_t *mem, uint32_t sp);
+static void func_40e874(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1);
+static void func_40e8c4(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0);
+static void f_uini(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_readbinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_readst(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_415820(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_writest(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp);
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_fdadd(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_str_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_iextmax(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp);
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_auxisymadd(uint8_t *mem, uint32_t sp);
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_exit(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_41f4e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_41f674(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_writeln(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_write_char(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_write_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_write_integer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_write_cardinal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_write_real(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_caseerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_xfree(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_free(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_release(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10010000);
+memcpy(mem + 0x10000b50, rodata, 0x1e70);
+memcpy(mem + 0x10000000, data, 0xb50);
+MEM_S32(0x10003070) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x10003074) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0);
+return ret;
+}
+
+static void func_404a34(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404a34:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+t6 = 0xfb52720;
+t7 = 0xfb50300;
+t6 = MEM_U32(t6 + 0);
+t7 = MEM_U32(t7 + 0);
+// fdead 400180eb MEM_U32(sp + 28) = ra;
+at = t6 < t7;
+// fdead 400180ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+// fdead 400180ef MEM_U32(sp + 52) = a3;
+MEM_U32(sp + 32) = t6;
+if (at == 0) goto L404ab8;
+t8 = 0x10003074;
+t0 = 0xfb500a0;
+t9 = t6 << 2;
+t8 = MEM_U32(t8 + 0);
+t1 = t9 + t0;
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10000b50;
+a3 = MEM_U32(t1 + 0);
+a2 = MEM_U32(t8 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+goto L404ae8;
+L404ab8:
+t2 = 0x10003074;
+a0 = 0xfb528e4;
+t2 = MEM_U32(t2 + 0);
+a1 = 0x10000b5c;
+//nop;
+a3 = MEM_U32(sp + 32);
+a2 = MEM_U32(t2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L404ae8:
+a2 = 0xfb528e4;
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = sp + 0x2c;
+a2 = a2 + 0x20;
+v0 = wrapper__doprnt(mem, a0, a1, a2);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+t3 = 0xfb51f00;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L404b40;
+a1 = 0xfb528e4;
+//nop;
+a0 = 0xa;
+a1 = a1 + 0x20;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+goto L404b98;
+L404b40:
+v0 = 0xfb528e4;
+//nop;
+t4 = MEM_U32(v0 + 32);
+//nop;
+t5 = t4 + 0xffffffff;
+MEM_U32(v0 + 32) = t5;
+if ((int)t5 >= 0) goto L404b7c;
+a1 = 0xfb528e4;
+//nop;
+a0 = 0xa;
+a1 = a1 + 0x20;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+//nop;
+goto L404b98;
+L404b7c:
+t6 = MEM_U32(v0 + 36);
+t8 = 0xa;
+MEM_U8(t6 + 0) = (uint8_t)t8;
+t9 = MEM_U32(v0 + 36);
+//nop;
+t0 = t9 + 0x1;
+MEM_U32(v0 + 36) = t0;
+L404b98:
+//nop;
+a0 = 0x1;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_get_command_line(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+double tempf64;
+union FloatReg f0 = {{0, 0}}, f4 = {{0, 0}}, f6 = {{0, 0}};
+L404bb8:
+//get_command_line:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 40000063 MEM_U32(sp + 56) = s7;
+s7 = 0x10003070;
+// fdead 41000063 MEM_U32(sp + 44) = s4;
+v1 = MEM_U32(s7 + 0);
+// fdead 41000073 MEM_U32(sp + 36) = s2;
+at = v1 < 0x2;
+// fdead 41000077 MEM_U32(sp + 68) = ra;
+// fdead 41000077 MEM_U32(sp + 64) = fp;
+// fdead 41000077 MEM_U32(sp + 60) = gp;
+// fdead 41000077 MEM_U32(sp + 52) = s6;
+// fdead 41000077 MEM_U32(sp + 48) = s5;
+// fdead 41000077 MEM_U32(sp + 40) = s3;
+// fdead 41000077 MEM_U32(sp + 32) = s1;
+// fdead 41000077 MEM_U32(sp + 28) = s0;
+s4 = zero;
+s2 = 0x1;
+if (at != 0) goto L40558c;
+s6 = 0xfb528e4;
+s5 = 0x10003074;
+s3 = 0x4;
+fp = 0x1;
+s6 = s6 + 0x20;
+L404c20:
+t0 = MEM_U32(s5 + 0);
+at = 0x2d;
+v0 = t0 + s3;
+s1 = MEM_U32(v0 + 0);
+//nop;
+t6 = MEM_U8(s1 + 0);
+//nop;
+//nop;
+if (t6 != at) goto L405530;
+t7 = MEM_U8(s1 + 1);
+//nop;
+t8 = t7 + 0xffffffbb;
+//nop;
+if (t8 >= 0x32) goto L405504;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L404da8;
+case 1: goto L405504;
+case 2: goto L404e28;
+case 3: goto L405504;
+case 4: goto L405504;
+case 5: goto L405504;
+case 6: goto L405504;
+case 7: goto L405504;
+case 8: goto L405504;
+case 9: goto L405504;
+case 10: goto L404ea4;
+case 11: goto L405504;
+case 12: goto L405504;
+case 13: goto L405504;
+case 14: goto L405504;
+case 15: goto L405504;
+case 16: goto L405504;
+case 17: goto L405504;
+case 18: goto L405504;
+case 19: goto L405504;
+case 20: goto L405504;
+case 21: goto L405504;
+case 22: goto L405504;
+case 23: goto L405504;
+case 24: goto L405504;
+case 25: goto L405504;
+case 26: goto L405504;
+case 27: goto L405504;
+case 28: goto L405504;
+case 29: goto L40537c;
+case 30: goto L404c7c;
+case 31: goto L40511c;
+case 32: goto L405504;
+case 33: goto L4050a8;
+case 34: goto L404cc0;
+case 35: goto L405504;
+case 36: goto L405248;
+case 37: goto L405504;
+case 38: goto L405504;
+case 39: goto L405504;
+case 40: goto L4054cc;
+case 41: goto L405190;
+case 42: goto L404f30;
+case 43: goto L405504;
+case 44: goto L405504;
+case 45: goto L405504;
+case 46: goto L405424;
+case 47: goto L404fd0;
+case 48: goto L405504;
+case 49: goto L405360;
+}
+L404c7c:
+a1 = 0x10000b80;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L404ca8;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L404ca8:
+at = 0x100030a0;
+//nop;
+MEM_U32(at + 0) = fp;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404cc0:
+a1 = 0x10000b88;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L404d5c;
+t9 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < t9) goto L404d24;
+t1 = MEM_U32(s5 + 0);
+a1 = 0x10000b94;
+//nop;
+a2 = MEM_U32(t1 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L404d24:
+t2 = MEM_U32(s5 + 0);
+//nop;
+t3 = t2 + s3;
+a0 = MEM_U32(t3 + 0);
+//nop;
+tempf64 = wrapper_atof(mem, a0);
+f0 = FloatReg_from_double(tempf64);
+// bdead 28c1f80103 gp = MEM_U32(sp + 60);
+f4.f[0] = double_from_FloatReg(f0);
+at = 0x10000034;
+//nop;
+MEM_U32(at + 0) = f4.w[0];
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404d5c:
+v0 = MEM_U8(s1 + 2);
+//nop;
+v0 = v0 + 0xffffffd0;
+//nop;
+if (v0 >= 0x4) goto L404d84;
+t4 = MEM_U8(s1 + 3);
+//nop;
+//nop;
+if (t4 == 0) goto L404d90;
+L404d84:
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L404d90:
+at = 0x10000020;
+//nop;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404da8:
+a1 = 0x10000bac;
+//nop;
+s0 = s1 + 0x2;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L404de4;
+at = 0x10000018;
+//nop;
+MEM_U32(at + 0) = fp;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404de4:
+a1 = 0x10000bb0;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L404e10;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L404e10:
+at = 0x10000018;
+//nop;
+MEM_U32(at + 0) = zero;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404e28:
+t5 = MEM_U8(s1 + 2);
+v0 = v0 + 0x4;
+//nop;
+if (t5 != 0) goto L405504;
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < v1) goto L404e74;
+L404e48:
+a1 = 0x10000bb4;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L404e74:
+//nop;
+a0 = MEM_U32(v0 + 0);
+//nop;
+v0 = wrapper_atoi(mem, a0);
+// bdead c1f8010b gp = MEM_U32(sp + 60);
+//nop;
+at = 0x1000002c;
+//nop;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404ea4:
+a1 = 0x10000bcc;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L404ee4;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < v1) goto L40557c;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L404e48;
+L404ee4:
+v0 = MEM_U8(s1 + 2);
+//nop;
+v0 = v0 + 0xffffffd0;
+//nop;
+if (v0 >= 0x5) goto L404f0c;
+t6 = MEM_U8(s1 + 3);
+//nop;
+//nop;
+if (t6 == 0) goto L404f18;
+L404f0c:
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L404f18:
+at = 0x10000024;
+//nop;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L404f30:
+t7 = MEM_U8(s1 + 2);
+v0 = v0 + 0x4;
+//nop;
+if (t7 != 0) goto L405504;
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < v1) goto L404f7c;
+L404f50:
+a1 = 0x10000bd4;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L404f7c:
+a3 = 0x10000040;
+a0 = s6;
+a3 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if (a3 == 0) goto L404fc0;
+a1 = 0x10000bf0;
+t8 = MEM_U32(v0 + 0);
+//nop;
+a2 = MEM_U32(t0 + 0);
+a1 = a1;
+MEM_U32(sp + 16) = t8;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L404fc0:
+t9 = MEM_U32(v0 + 0);
+at = 0x10000040;
+MEM_U32(at + 0) = t9;
+goto L40557c;
+L404fd0:
+a1 = 0x10000c2c;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L405008;
+at = 0x1000001c;
+//nop;
+MEM_U32(at + 0) = fp;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405008:
+t1 = MEM_U8(s1 + 2);
+//nop;
+//nop;
+if (t1 == 0) goto L405024;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L405024:
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < v1) goto L405044;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L404f50;
+L405044:
+a3 = 0x10000044;
+a0 = s6;
+a3 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if (a3 == 0) goto L405090;
+t0 = MEM_U32(s5 + 0);
+a1 = 0x10000c34;
+t2 = t0 + s3;
+t3 = MEM_U32(t2 + 0);
+//nop;
+a2 = MEM_U32(t0 + 0);
+a1 = a1;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L405090:
+t4 = MEM_U32(s5 + 0);
+at = 0x10000044;
+t5 = t4 + s3;
+t6 = MEM_U32(t5 + 0);
+MEM_U32(at + 0) = t6;
+goto L40557c;
+L4050a8:
+t7 = MEM_U8(s1 + 2);
+v0 = v0 + 0x4;
+//nop;
+if (t7 != 0) goto L405504;
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 >= v1) goto L404f50;
+a3 = 0x10000048;
+a0 = s6;
+a3 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if (a3 == 0) goto L40510c;
+a1 = 0x10000c70;
+t8 = MEM_U32(v0 + 0);
+//nop;
+a2 = MEM_U32(t0 + 0);
+a1 = a1;
+MEM_U32(sp + 16) = t8;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L40510c:
+t9 = MEM_U32(v0 + 0);
+at = 0x10000048;
+MEM_U32(at + 0) = t9;
+goto L40557c;
+L40511c:
+a1 = 0x10000ca8;
+//nop;
+s0 = s1 + 0x2;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L40514c;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L40514c:
+a1 = 0x10000cb0;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L405178;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L405178:
+at = 0x10000010;
+//nop;
+MEM_U32(at + 0) = fp;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405190:
+a1 = 0x10000cb8;
+//nop;
+s0 = s1 + 0x2;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L4051cc;
+at = 0x10000004;
+//nop;
+MEM_U32(at + 0) = zero;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L4051cc:
+a1 = 0x10000cc8;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L405204;
+at = 0x10000008;
+//nop;
+MEM_U32(at + 0) = zero;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405204:
+a1 = 0x10000cd4;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L405230;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L405230:
+at = 0x10000000;
+//nop;
+MEM_U32(at + 0) = zero;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405248:
+a1 = 0x10000cdc;
+//nop;
+s0 = s1 + 0x2;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L405284;
+at = 0x1000000c;
+//nop;
+MEM_U32(at + 0) = fp;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405284:
+a1 = 0x10000ce8;
+//nop;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != 0) goto L4052fc;
+t1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < t1) goto L4052c4;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L404e48;
+L4052c4:
+t2 = MEM_U32(s5 + 0);
+//nop;
+t3 = t2 + s3;
+a0 = MEM_U32(t3 + 0);
+//nop;
+v0 = wrapper_atoi(mem, a0);
+// bdead c1f8010b gp = MEM_U32(sp + 60);
+//nop;
+at = 0x10000030;
+//nop;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L4052fc:
+t4 = MEM_U8(s1 + 2);
+//nop;
+//nop;
+if (t4 == 0) goto L405318;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L405318:
+t5 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < t5) goto L405338;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L404f50;
+L405338:
+t6 = MEM_U32(s5 + 0);
+//nop;
+t7 = t6 + s3;
+a0 = MEM_U32(t7 + 0);
+//nop;
+f_read_inlinefile(mem, sp, a0);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405360:
+t8 = MEM_U8(s1 + 2);
+//nop;
+//nop;
+if (t8 != 0) goto L405504;
+at = 0x10000014;
+MEM_U32(at + 0) = fp;
+goto L40557c;
+L40537c:
+a1 = 0x10000cf4;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L4053a8;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L4053a8:
+t9 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < t9) goto L4053ec;
+t1 = MEM_U32(s5 + 0);
+a1 = 0x10000cfc;
+//nop;
+a2 = MEM_U32(t1 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L4053ec:
+t2 = MEM_U32(s5 + 0);
+//nop;
+t3 = t2 + s3;
+a0 = MEM_U32(t3 + 0);
+//nop;
+v0 = wrapper_atoi(mem, a0);
+// bdead c1f8010b gp = MEM_U32(sp + 60);
+//nop;
+at = 0x10000028;
+//nop;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405424:
+a1 = 0x10000d14;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L405450;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L405450:
+t4 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+s3 = s3 + 0x4;
+if (s2 < t4) goto L405494;
+t5 = MEM_U32(s5 + 0);
+a1 = 0x10000d20;
+//nop;
+a2 = MEM_U32(t5 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L405494:
+t6 = MEM_U32(s5 + 0);
+//nop;
+t7 = t6 + s3;
+a0 = MEM_U32(t7 + 0);
+//nop;
+tempf64 = wrapper_atof(mem, a0);
+f0 = FloatReg_from_double(tempf64);
+// bdead 48c1f80103 gp = MEM_U32(sp + 60);
+f6.f[0] = double_from_FloatReg(f0);
+at = 0x10000038;
+//nop;
+MEM_U32(at + 0) = f6.w[0];
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L4054cc:
+a1 = 0x10000d38;
+//nop;
+a0 = s1 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fc010b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L4054f8;
+t0 = MEM_U32(s5 + 0);
+//nop;
+goto L405504;
+L4054f8:
+v1 = MEM_U32(s7 + 0);
+s2 = s2 + 0x1;
+goto L405580;
+L405504:
+a1 = 0x10000d40;
+//nop;
+a2 = MEM_U32(t0 + 0);
+a0 = s6;
+a3 = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L405530:
+a3 = 0x1000003c;
+a0 = s6;
+a3 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if (a3 == 0) goto L405570;
+a1 = 0x10000d64;
+//nop;
+a2 = MEM_U32(t0 + 0);
+MEM_U32(sp + 16) = s1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1f80103 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s7 + 0);
+s4 = s4 + 0x1;
+goto L40557c;
+L405570:
+at = 0x1000003c;
+//nop;
+MEM_U32(at + 0) = s1;
+L40557c:
+s2 = s2 + 0x1;
+L405580:
+s3 = s3 + 0x4;
+if (s2 < v1) goto L404c20;
+L40558c:
+t8 = 0x1000003c;
+s6 = 0xfb528e4;
+t8 = MEM_U32(t8 + 0);
+s5 = 0x10003074;
+s6 = s6 + 0x20;
+if (t8 != 0) goto L4055d8;
+//nop;
+if (v1 < 0x2) goto L4055d4;
+t9 = MEM_U32(s5 + 0);
+a1 = 0x10000da0;
+a2 = MEM_U32(t9 + 0);
+//nop;
+a0 = s6;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41e00101 gp = MEM_U32(sp + 60);
+//nop;
+L4055d4:
+s4 = s4 + 0x1;
+L4055d8:
+t1 = 0x10000040;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != 0) goto L405628;
+t2 = MEM_U32(s7 + 0);
+a0 = s6;
+//nop;
+if (t2 < 0x2) goto L405624;
+t3 = MEM_U32(s5 + 0);
+a1 = 0x10000dc8;
+//nop;
+a2 = MEM_U32(t3 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41e00101 gp = MEM_U32(sp + 60);
+//nop;
+L405624:
+s4 = s4 + 0x1;
+L405628:
+t4 = 0x10000048;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L405690;
+t5 = 0x10000044;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 != 0) goto L405690;
+t6 = MEM_U32(s7 + 0);
+a0 = s6;
+//nop;
+if (t6 < 0x2) goto L40568c;
+t7 = MEM_U32(s5 + 0);
+a1 = 0x10000df0;
+//nop;
+a2 = MEM_U32(t7 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40e00101 gp = MEM_U32(sp + 60);
+//nop;
+L40568c:
+s4 = s4 + 0x1;
+L405690:
+a0 = s6;
+if (s4 == 0) goto L4056d0;
+t8 = MEM_U32(s5 + 0);
+a1 = 0x10000e18;
+//nop;
+a2 = MEM_U32(t8 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 60);
+//nop;
+L4056d0:
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 s1 = MEM_U32(sp + 32);
+// bdead 1 s2 = MEM_U32(sp + 36);
+// bdead 1 s3 = MEM_U32(sp + 40);
+// bdead 1 s4 = MEM_U32(sp + 44);
+// bdead 1 s5 = MEM_U32(sp + 48);
+// bdead 1 s6 = MEM_U32(sp + 52);
+// bdead 1 s7 = MEM_U32(sp + 56);
+// bdead 1 fp = MEM_U32(sp + 64);
+// bdead 1 sp = sp + 0x48;
+return;
+}
+
+static void f_get_ufile(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L405700:
+//get_ufile:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff48;
+MEM_U32(sp + 184) = a0;
+a0 = 0x1000003c;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 188) = a1;
+a0 = MEM_U32(a0 + 0);
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a1 = zero;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 180) = v0;
+if ((int)v0 >= 0) goto L405764;
+a1 = 0x1000003c;
+//nop;
+a0 = 0x10000efc;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L405764:
+//nop;
+a0 = MEM_U32(sp + 180);
+a1 = sp + 0x2c;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v0 >= 0) goto L4057a4;
+a1 = 0x1000003c;
+//nop;
+a0 = 0x10000f18;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L4057a4:
+//nop;
+a0 = MEM_U32(sp + 92);
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+if (v0 != 0) goto L405808;
+t6 = 0x10003074;
+a0 = 0xfb528e4;
+t6 = MEM_U32(t6 + 0);
+a1 = 0x10000f30;
+//nop;
+a3 = MEM_U32(sp + 92);
+a2 = MEM_U32(t6 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L405808:
+//nop;
+a0 = MEM_U32(sp + 180);
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 92);
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v0 >= 0) goto L405850;
+a1 = 0x1000003c;
+//nop;
+a0 = 0x10000f60;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L405850:
+//nop;
+a0 = MEM_U32(sp + 180);
+//nop;
+v0 = wrapper_close(mem, a0);
+t7 = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 184);
+// bdead 42010001 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 0) = t7;
+t9 = MEM_U32(sp + 92);
+t1 = MEM_U32(sp + 188);
+a0 = 0x10000044;
+t0 = t7 + t9;
+MEM_U32(t1 + 0) = t0;
+a0 = MEM_U32(a0 + 0);
+//nop;
+// bdead 40000021 ra = MEM_U32(sp + 28);
+if (a0 == 0) goto L405900;
+//nop;
+a1 = 0x72;
+//nop;
+v0 = f_st_readbinary(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+if ((int)v0 >= 0) goto L405900;
+t2 = 0x10003074;
+a3 = 0x10000044;
+t2 = MEM_U32(t2 + 0);
+a0 = 0xfb528e4;
+a1 = 0x10000f7c;
+//nop;
+a3 = MEM_U32(a3 + 0);
+a2 = MEM_U32(t2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 28);
+L405900:
+// bdead 1 sp = sp + 0xb8;
+//nop;
+return;
+}
+
+static void f_put_ufile(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, t6 = 0;
+L40590c:
+//put_ufile:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff48;
+MEM_U32(sp + 184) = a0;
+a0 = 0x10000040;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 188) = a1;
+a0 = MEM_U32(a0 + 0);
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a1 = 0x1b6;
+v0 = wrapper_creat(mem, a0, a1);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 180) = v0;
+if ((int)v0 >= 0) goto L405970;
+a1 = 0x10000040;
+//nop;
+a0 = 0x10000fa0;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L405970:
+a1 = MEM_U32(sp + 184);
+t6 = MEM_U32(sp + 188);
+//nop;
+a0 = MEM_U32(sp + 180);
+a2 = t6 - a1;
+MEM_U32(sp + 36) = a2;
+v0 = wrapper_write(mem, a0, a1, a2);
+a2 = MEM_U32(sp + 36);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == a2) goto L4059c0;
+a1 = 0x10000040;
+//nop;
+a0 = 0x10000fbc;
+a1 = MEM_U32(a1 + 0);
+// fdead 600000eb t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L4059c0:
+//nop;
+a0 = MEM_U32(sp + 180);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0xb8;
+return;
+}
+
+static void f_get_feedback_file(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4059e0:
+//get_feedback_file:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000000;
+sp = sp + 0xffffff40;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 36) = ra;
+// fdead 4000806b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 192) = a0;
+MEM_U32(sp + 196) = a1;
+if (t6 == 0) goto L405a24;
+a0 = 0x10000048;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (a0 != 0) goto L405a3c;
+L405a24:
+t7 = MEM_U32(sp + 192);
+//nop;
+MEM_U32(t7 + 0) = zero;
+t8 = MEM_U32(sp + 196);
+MEM_U32(t8 + 0) = zero;
+goto L405bfc;
+L405a3c:
+//nop;
+a1 = zero;
+//nop;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 188) = v0;
+if ((int)v0 >= 0) goto L405a7c;
+a1 = 0x10000048;
+//nop;
+a0 = 0x10000fd8;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L405a7c:
+//nop;
+a0 = MEM_U32(sp + 188);
+a1 = sp + 0x34;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 40000189 gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L405abc;
+a1 = 0x10000048;
+//nop;
+a0 = 0x10000ff4;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L405abc:
+//nop;
+a0 = MEM_U32(sp + 100);
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 48) = v0;
+if (v0 != 0) goto L405b20;
+t9 = 0x10003074;
+a0 = 0xfb528e4;
+t9 = MEM_U32(t9 + 0);
+a1 = 0x1000100c;
+a2 = MEM_U32(t9 + 0);
+//nop;
+a3 = MEM_U32(sp + 100);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L405b20:
+//nop;
+a0 = MEM_U32(sp + 188);
+a1 = MEM_U32(sp + 48);
+a2 = MEM_U32(sp + 100);
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= 0) goto L405b68;
+a1 = 0x10000048;
+//nop;
+a0 = 0x10001040;
+a1 = MEM_U32(a1 + 0);
+// fdead 6000006b t9 = t9;
+a0 = a0;
+func_404a34(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L405b68:
+//nop;
+a0 = MEM_U32(sp + 188);
+//nop;
+v0 = wrapper_close(mem, a0);
+t0 = MEM_U32(sp + 48);
+v1 = 0x64650000;
+a3 = MEM_U32(t0 + 0);
+v1 = v1 | 0x6566;
+// bdead 40000311 gp = MEM_U32(sp + 32);
+t2 = MEM_U32(sp + 192);
+if (v1 == a3) goto L405be4;
+t1 = 0x10003074;
+a0 = 0xfb528e4;
+t1 = MEM_U32(t1 + 0);
+a1 = 0x1000105c;
+//nop;
+a2 = MEM_U32(t1 + 0);
+MEM_U32(sp + 16) = v1;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t0 = MEM_U32(sp + 48);
+//nop;
+t2 = MEM_U32(sp + 192);
+L405be4:
+//nop;
+MEM_U32(t2 + 0) = t0;
+t3 = MEM_U32(sp + 100);
+t5 = MEM_U32(sp + 196);
+t4 = t0 + t3;
+MEM_U32(t5 + 0) = t4;
+L405bfc:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0xc0;
+//nop;
+return;
+}
+
+static void f_read_inlinefile(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L405c0c:
+//read_inlinefile:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffea8;
+a1 = 0x10001084;
+//nop;
+// fdead 4000006b MEM_U32(sp + 68) = ra;
+// fdead 4000006b MEM_U32(sp + 64) = fp;
+// fdead 4000006b MEM_U32(sp + 60) = gp;
+// fdead 4000006b MEM_U32(sp + 56) = s7;
+// fdead 4000006b MEM_U32(sp + 52) = s6;
+// fdead 4000006b MEM_U32(sp + 48) = s5;
+// fdead 4000006b MEM_U32(sp + 44) = s4;
+// fdead 4000006b MEM_U32(sp + 40) = s3;
+// fdead 4000006b MEM_U32(sp + 36) = s2;
+// fdead 4000006b MEM_U32(sp + 32) = s1;
+// fdead 4000006b MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 344) = a0;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 336) = v0;
+if (v0 != 0) goto L405cb0;
+t6 = 0x10003074;
+s5 = 0xfb528e4;
+t6 = MEM_U32(t6 + 0);
+a1 = 0x10001088;
+//nop;
+a3 = MEM_U32(sp + 344);
+a2 = MEM_U32(t6 + 0);
+a0 = s5 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c3 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 60);
+//nop;
+L405cb0:
+s5 = 0xfb528e4;
+//nop;
+s1 = sp + 0x50;
+a2 = MEM_U32(sp + 336);
+a0 = s1;
+a1 = 0x100;
+s5 = s5 + 0x20;
+v0 = wrapper_fgets(mem, a0, a1, a2);
+// bdead 4044000b gp = MEM_U32(sp + 60);
+s7 = 0xa;
+if (v0 != s1) goto L405e40;
+fp = 0x100010b0;
+s4 = 0x100030a8;
+s3 = 0x100030a4;
+s6 = 0x2d;
+s2 = 0x2b;
+fp = fp;
+v1 = MEM_U8(sp + 80);
+L405cf8:
+//nop;
+//nop;
+if (s2 == v1) goto L405d0c;
+//nop;
+if (s6 != v1) goto L405d30;
+L405d0c:
+//nop;
+a0 = s1;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t7 = s1 + v0;
+t8 = MEM_U8(t7 + -1);
+// bdead c3fc0003 gp = MEM_U32(sp + 60);
+//nop;
+if (s7 == t8) goto L405d74;
+L405d30:
+t9 = 0x10003074;
+a3 = MEM_U32(sp + 344);
+t9 = MEM_U32(t9 + 0);
+a0 = s5;
+a2 = MEM_U32(t9 + 0);
+//nop;
+MEM_U32(sp + 16) = s1;
+a1 = fp;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1fc01c3 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 60);
+//nop;
+L405d74:
+//nop;
+a0 = s1;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+t0 = s1 + v0;
+MEM_U8(t0 + -1) = (uint8_t)zero;
+//nop;
+a0 = 0x104;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c1fc018b gp = MEM_U32(sp + 60);
+s0 = v0;
+if (v0 != 0) goto L405de0;
+a1 = 0x100010e0;
+//nop;
+a0 = s5;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c1fe01c3 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L405de0:
+//nop;
+a0 = s0;
+a1 = sp + 0x51;
+v0 = wrapper_strcpy(mem, a0, a1);
+v1 = MEM_U8(sp + 80);
+// bdead c1fe0013 gp = MEM_U32(sp + 60);
+a0 = s1;
+if (s2 != v1) goto L405e14;
+t1 = MEM_U32(s3 + 0);
+//nop;
+MEM_U32(s0 + 256) = t1;
+MEM_U32(s3 + 0) = s0;
+goto L405e24;
+L405e14:
+t2 = MEM_U32(s4 + 0);
+//nop;
+MEM_U32(s0 + 256) = t2;
+MEM_U32(s4 + 0) = s0;
+L405e24:
+//nop;
+a2 = MEM_U32(sp + 336);
+a1 = 0x100;
+v0 = wrapper_fgets(mem, a0, a1, a2);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+v1 = MEM_U8(sp + 80);
+if (v0 == s1) goto L405cf8;
+L405e40:
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 s1 = MEM_U32(sp + 32);
+// bdead 1 s2 = MEM_U32(sp + 36);
+// bdead 1 s3 = MEM_U32(sp + 40);
+// bdead 1 s4 = MEM_U32(sp + 44);
+// bdead 1 s5 = MEM_U32(sp + 48);
+// bdead 1 s6 = MEM_U32(sp + 52);
+// bdead 1 s7 = MEM_U32(sp + 56);
+// bdead 1 fp = MEM_U32(sp + 64);
+// bdead 1 sp = sp + 0x158;
+return;
+}
+
+static uint32_t f_dont_inline(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, t6 = 0, s0 = 0, s1 = 0;
+L405e70:
+//dont_inline:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000ab MEM_U32(sp + 28) = s1;
+s1 = a0;
+// fdead 400400ab MEM_U32(sp + 36) = ra;
+// fdead 400400ab MEM_U32(sp + 32) = gp;
+// fdead 400400ab MEM_U32(sp + 24) = s0;
+if (a0 == 0) goto L405ea8;
+t6 = MEM_U8(a0 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L405eb0;
+L405ea8:
+v0 = zero;
+goto L405f00;
+L405eb0:
+s0 = 0x100030a8;
+//nop;
+s0 = MEM_U32(s0 + 0);
+//nop;
+v0 = zero;
+if (s0 == 0) goto L405f00;
+L405ec8:
+//nop;
+a0 = s0;
+a1 = s1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L405eec;
+v0 = 0x1;
+goto L405f00;
+L405eec:
+s0 = MEM_U32(s0 + 256);
+//nop;
+//nop;
+if (s0 != 0) goto L405ec8;
+v0 = zero;
+L405f00:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_force_inline(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, t6 = 0, s0 = 0, s1 = 0;
+L405f14:
+//force_inline:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = s1;
+s1 = a0;
+// fdead 4004002b MEM_U32(sp + 36) = ra;
+// fdead 4004002b MEM_U32(sp + 32) = gp;
+// fdead 4004002b MEM_U32(sp + 24) = s0;
+if (a0 == 0) goto L405f4c;
+t6 = MEM_U8(a0 + 0);
+//nop;
+//nop;
+if (t6 != 0) goto L405f54;
+L405f4c:
+v0 = zero;
+goto L405fa4;
+L405f54:
+s0 = 0x100030a4;
+//nop;
+s0 = MEM_U32(s0 + 0);
+//nop;
+v0 = zero;
+if (s0 == 0) goto L405fa4;
+L405f6c:
+//nop;
+a0 = s0;
+a1 = s1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L405f90;
+v0 = 0x1;
+goto L405fa4;
+L405f90:
+s0 = MEM_U32(s0 + 256);
+//nop;
+//nop;
+if (s0 != 0) goto L405f6c;
+v0 = zero;
+L405fa4:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_st_feinit(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L405fb8:
+//st_feinit:
+//nop;
+//nop;
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10001108;
+//nop;
+// fdead 6b sp = sp + 0xffffffe0;
+// fdead 6b MEM_U32(sp + 28) = ra;
+// fdead 6b MEM_U32(sp + 24) = gp;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 28);
+// fdead 3 gp = MEM_U32(sp + 24);
+// fdead 3 sp = sp + 0x20;
+return;
+}
+
+static uint32_t func_406010(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t2 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L406010:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+s0 = a1;
+// fdead 400200eb MEM_U32(sp + 60) = ra;
+// fdead 400200eb MEM_U32(sp + 36) = s4;
+// fdead 400200eb MEM_U32(sp + 28) = s2;
+s2 = a0;
+s4 = a2;
+// fdead 402a00eb MEM_U32(sp + 56) = fp;
+// fdead 402a00eb MEM_U32(sp + 52) = gp;
+// fdead 402a00eb MEM_U32(sp + 48) = s7;
+// fdead 402a00eb MEM_U32(sp + 44) = s6;
+// fdead 402a00eb MEM_U32(sp + 40) = s5;
+// fdead 402a00eb MEM_U32(sp + 32) = s3;
+// fdead 402a00eb MEM_U32(sp + 24) = s1;
+s0 = s0 + 0x1;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t6 = MEM_U32(v0 + 8);
+s7 = 0xf0000;
+s7 = s7 | 0xffff;
+// bdead 412a8009 gp = MEM_U32(sp + 52);
+t7 = t6 & s7;
+s1 = v0;
+if (s7 != t7) goto L406088;
+v0 = 0xffffffff;
+goto L4061ac;
+L406088:
+a1 = MEM_U32(s1 + 8);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t8 = a1 & at;
+a1 = t8;
+a0 = s2;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+v1 = MEM_U32(v0 + 0);
+// bdead 412a0011 gp = MEM_U32(sp + 52);
+fp = 0xffffffff;
+s6 = v1;
+if (fp != v1) goto L4060c4;
+v0 = 0xffffffff;
+goto L4061ac;
+L4060c4:
+s5 = 0xe;
+L4060c8:
+//nop;
+a0 = s2;
+a1 = s0;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+v1 = MEM_U32(v0 + 8);
+// bdead c1ea0019 gp = MEM_U32(sp + 52);
+t9 = v1 >> 26;
+s1 = v0;
+if (s5 != t9) goto L406198;
+at = 0xf0000;
+at = at | 0xffff;
+t0 = v1 & at;
+a0 = s2;
+if (s7 == t0) goto L406198;
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+a1 = v1 & at;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// bdead c1ee0109 gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s1 + 0);
+//nop;
+s3 = v0;
+a0 = s2;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead c1fa0009 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+//nop;
+a1 = v0;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fa0009 gp = MEM_U32(sp + 52);
+a0 = s2;
+if (v0 != 0) goto L406198;
+t2 = MEM_U32(s4 + 4);
+//nop;
+//nop;
+if (t2 != 0) goto L406168;
+v0 = s0;
+goto L4061ac;
+L406168:
+//nop;
+a1 = s0;
+// fdead e1fe086f t9 = t9;
+a2 = s4 + 0x4;
+v0 = func_406010(mem, sp, a0, a1, a2);
+// bdead c1f80009 gp = MEM_U32(sp + 52);
+//nop;
+if (v0 == fp) goto L406190;
+// bdead 9 ra = MEM_U32(sp + 60);
+goto L4061b0;
+L406190:
+s0 = MEM_U32(s3 + 0);
+//nop;
+L406198:
+s0 = s0 + 0x1;
+//nop;
+if ((int)s0 < (int)s6) goto L4060c8;
+v0 = 0xffffffff;
+L4061ac:
+// bdead 9 ra = MEM_U32(sp + 60);
+L4061b0:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint32_t f_path_blockno(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+L4061dc:
+//path_blockno:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffef8;
+// fdead 4000006b MEM_U32(sp + 60) = ra;
+// fdead 4000006b MEM_U32(sp + 56) = fp;
+// fdead 4000006b MEM_U32(sp + 52) = gp;
+// fdead 4000006b MEM_U32(sp + 48) = s7;
+// fdead 4000006b MEM_U32(sp + 44) = s6;
+// fdead 4000006b MEM_U32(sp + 40) = s5;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 104) = a0;
+v1 = MEM_U8(a0 + 0);
+a2 = a0;
+a3 = a1;
+v0 = a0 + 0x1;
+if (v1 == 0) goto L406240;
+L406230:
+v1 = MEM_U8(v0 + 0);
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L406230;
+L406240:
+MEM_U32(sp + 108) = v0;
+v1 = MEM_U8(v0 + 0);
+fp = sp + 0x70;
+s0 = fp;
+v0 = v0 + 0x1;
+if (v1 == 0) goto L406288;
+a1 = sp + 0x68;
+a0 = 0x2e;
+L406260:
+t6 = a1 + 0x7c;
+if (v1 != a0) goto L406278;
+MEM_U8(v0 + -1) = (uint8_t)zero;
+if (s0 == t6) goto L406278;
+MEM_U32(s0 + 0) = v0;
+s0 = s0 + 0x4;
+L406278:
+v1 = MEM_U8(v0 + 0);
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L406260;
+L406288:
+t7 = a2 + a3;
+t8 = t7 + 0x1;
+//nop;
+if (v0 == t8) goto L4062d0;
+a0 = 0xfb528e4;
+a1 = 0x1000111c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead c00201c3 gp = MEM_U32(sp + 52);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead c0020003 gp = MEM_U32(sp + 52);
+//nop;
+L4062d0:
+MEM_U32(s0 + 0) = zero;
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead c000018b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 256) = v0;
+s7 = 0xffffffff;
+s3 = zero;
+if ((int)v0 <= 0) goto L406460;
+s5 = 0xf0000;
+s5 = s5 | 0xffff;
+s6 = 0xffffffff;
+s4 = 0x34;
+L406308:
+//nop;
+a0 = s3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+// bdead c5f0010b gp = MEM_U32(sp + 52);
+a1 = MEM_U32(t9 + 4);
+//nop;
+s2 = v0;
+a0 = s3;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 104);
+//nop;
+a1 = v0;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1f8018b gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 256);
+if (v0 != 0) goto L406450;
+t0 = MEM_U32(s2 + 0);
+s0 = MEM_U32(s2 + 52);
+t1 = MEM_U16(t0 + 42);
+//nop;
+lo = t1 * s4;
+hi = (uint32_t)((uint64_t)t1 * (uint64_t)s4 >> 32);
+t2 = lo;
+t3 = s0 + t2;
+//nop;
+if (s0 >= t3) goto L406444;
+L406380:
+//nop;
+a1 = MEM_U32(s0 + 4);
+a0 = s3;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead c1fa010b gp = MEM_U32(sp + 52);
+a1 = MEM_U32(v0 + 0);
+//nop;
+s1 = v0;
+a0 = s3;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 108);
+//nop;
+a1 = v0;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead c1fe018b gp = MEM_U32(sp + 52);
+at = 0xf0000;
+if (v0 != 0) goto L40641c;
+t4 = MEM_U32(sp + 112);
+a0 = s3;
+//nop;
+if (t4 != 0) goto L4063e8;
+s7 = MEM_U32(s0 + 4);
+//nop;
+goto L406444;
+L4063e8:
+t5 = MEM_U32(s1 + 8);
+at = at | 0xffff;
+t6 = t5 & at;
+//nop;
+if (s5 == t6) goto L406444;
+//nop;
+a1 = MEM_U32(s0 + 4);
+// fdead 6e1fee06f t9 = t9;
+a2 = fp;
+v0 = func_406010(mem, sp, a0, a1, a2);
+// bdead c0fa018b gp = MEM_U32(sp + 52);
+s7 = v0;
+if (v0 != s6) goto L406444;
+L40641c:
+t8 = MEM_U32(s2 + 0);
+t7 = MEM_U32(s2 + 52);
+t9 = MEM_U16(t8 + 42);
+s0 = s0 + 0x34;
+lo = t9 * s4;
+hi = (uint32_t)((uint64_t)t9 * (uint64_t)s4 >> 32);
+t0 = lo;
+t1 = t7 + t0;
+//nop;
+if (s0 < t1) goto L406380;
+L406444:
+//nop;
+if (s7 != s6) goto L406460;
+t2 = MEM_U32(sp + 256);
+L406450:
+s3 = s3 + 0x1;
+//nop;
+if ((int)s3 < (int)t2) goto L406308;
+L406460:
+s6 = 0xffffffff;
+//nop;
+if (s7 != s6) goto L406474;
+v0 = 0xffffffff;
+goto L4065e0;
+L406474:
+//nop;
+a0 = s3;
+a1 = s7;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t3 = MEM_U32(v0 + 8);
+// bdead 41101003 gp = MEM_U32(sp + 52);
+s5 = 0x6;
+t4 = t3 >> 26;
+//nop;
+if (s5 != t4) goto L406560;
+//nop;
+//nop;
+//nop;
+v0 = f_st_iextmax(mem, sp);
+// bdead 4150018b gp = MEM_U32(sp + 52);
+s4 = v0;
+s0 = zero;
+if ((int)v0 <= 0) goto L406528;
+s2 = 0x1;
+s1 = 0xe;
+L4064c4:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+a0 = MEM_U32(v0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+// bdead 417e01ad gp = MEM_U32(sp + 52);
+t5 = a0 & at;
+//nop;
+if (s7 != t5) goto L406518;
+t6 = MEM_S16(v0 + 2);
+v1 = a0 >> 26;
+//nop;
+if (s3 != t6) goto L406518;
+t8 = a0 << 6;
+if (s5 == v1) goto L40650c;
+if (s1 != v1) {
+t9 = t8 >> 27;
+goto L406518;}
+L40650c:
+t9 = t8 >> 27;
+//nop;
+if (s2 == t9) goto L406528;
+L406518:
+s0 = s0 + 0x1;
+//nop;
+if ((int)s0 < (int)s4) goto L4064c4;
+L406528:
+s3 = 0x7fff0000;
+if (s0 != s4) goto L406558;
+a0 = 0xfb528e4;
+a1 = 0x1000114c;
+//nop;
+a2 = s7;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 52);
+v0 = 0xffffffff;
+goto L4065e0;
+L406558:
+s7 = s0;
+s3 = s3 | 0xffff;
+L406560:
+//nop;
+s0 = 0x1;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t7 = MEM_U32(v0 + 60);
+// bdead 41130101 gp = MEM_U32(sp + 52);
+at = 0x1;
+v0 = 0xffffffff;
+if (t7 == at) goto L4065e0;
+L406584:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_st_pdn_idn(mem, sp, a0);
+t0 = MEM_U32(v0 + 0);
+// bdead 41120209 gp = MEM_U32(sp + 52);
+//nop;
+if (s3 != t0) goto L4065bc;
+t1 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (s7 != t1) goto L4065bc;
+v0 = s0;
+goto L4065e0;
+L4065bc:
+//nop;
+s0 = s0 + 0x1;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t2 = MEM_U32(v0 + 60);
+// bdead 41120901 gp = MEM_U32(sp + 52);
+//nop;
+if (s0 != t2) goto L406584;
+v0 = 0xffffffff;
+L4065e0:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x108;
+return v0;
+//nop;
+}
+
+static void f_postorder_walk(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t6 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L406614:
+//postorder_walk:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = MEM_U32(a0 + 84);
+s2 = 0x7fff0000;
+s2 = s2 | 0xffff;
+s4 = a0;
+MEM_U32(a0 + 76) = s2;
+if (s0 == 0) goto L4066dc;
+s1 = 0x10002e98;
+s3 = 0x1;
+L406660:
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = MEM_U32(a0 + 76);
+//nop;
+//nop;
+if (v0 != 0) goto L4066a4;
+//nop;
+//nop;
+//nop;
+f_postorder_walk(mem, sp, a0);
+// bdead 403e0001 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(s1 + 0);
+a1 = 0x10002e9c;
+//nop;
+a1 = MEM_U32(a1 + 0);
+t6 = v1 + 0x1;
+goto L4066c0;
+L4066a4:
+a1 = 0x10002e9c;
+v1 = MEM_U32(s1 + 0);
+a1 = MEM_U32(a1 + 0);
+t6 = v1 + 0x1;
+if (s2 != v0) goto L4066c0;
+MEM_U8(a0 + 122) = (uint8_t)s3;
+t6 = v1 + 0x1;
+L4066c0:
+t8 = t6 << 2;
+t9 = a1 + t8;
+MEM_U32(t9 + 0) = s0;
+s0 = MEM_U32(s0 + 4);
+MEM_U32(s1 + 0) = t6;
+//nop;
+if (s0 != 0) goto L406660;
+L4066dc:
+a0 = 0x10003c94;
+//nop;
+v0 = MEM_U32(a0 + 0);
+//nop;
+//nop;
+if (v0 != 0) goto L406700;
+at = 0x10003c70;
+MEM_U32(at + 0) = s4;
+goto L406704;
+L406700:
+MEM_U32(v0 + 60) = s4;
+L406704:
+v1 = 0x10002e94;
+// bdead 200031 ra = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 0);
+MEM_U32(a0 + 0) = s4;
+MEM_U32(s4 + 76) = v0;
+// bdead 19 s4 = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 s3 = MEM_U32(sp + 32);
+t0 = v0 + 0xffffffff;
+// bdead 211 sp = sp + 0x30;
+MEM_U32(v1 + 0) = t0;
+return;
+}
+
+static void f_build_postorder(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40673c:
+//build_postorder:
+//nop;
+//nop;
+//nop;
+a0 = 0x10003c88;
+at = 0x10002e98;
+a0 = MEM_U32(a0 + 0);
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002f MEM_U32(sp + 28) = ra;
+t6 = a0 << 2;
+// fdead 4000802f MEM_U32(sp + 24) = gp;
+// fdead 4000802f MEM_U32(sp + 20) = s0;
+a0 = t6;
+MEM_U32(at + 0) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10002e9c;
+t7 = 0x10003c84;
+MEM_U32(at + 0) = v0;
+at = 0x10003c70;
+a0 = 0x10003c8c;
+MEM_U32(at + 0) = zero;
+at = 0x10003c94;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x10002e94;
+t7 = MEM_U32(t7 + 0);
+a0 = MEM_U32(a0 + 0);
+MEM_U32(at + 0) = t7;
+f_postorder_walk(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+s0 = 0x10003c98;
+//nop;
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L406810;
+L4067d8:
+t8 = MEM_U32(s0 + 76);
+//nop;
+//nop;
+if (t8 != 0) goto L406800;
+//nop;
+a0 = s0;
+//nop;
+f_postorder_walk(mem, sp, a0);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+//nop;
+L406800:
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L4067d8;
+L406810:
+t9 = 0x10002e94;
+a2 = 0x3d;
+t9 = MEM_U32(t9 + 0);
+a3 = 0x3d;
+//nop;
+if (t9 == 0) goto L406878;
+s0 = 0x10000b30;
+a1 = 0x1000127e;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020181 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+L406878:
+t0 = 0x10003c88;
+t1 = 0x10002e98;
+t0 = MEM_U32(t0 + 0);
+t1 = MEM_U32(t1 + 0);
+s0 = 0x10000b30;
+a2 = 0x2e;
+if (t0 == t1) goto L4068e4;
+a1 = 0x10001250;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a3 = 0x2e;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020181 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L4068e4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_estimate_inline(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L4068f4:
+//estimate_inline:
+a2 = MEM_U32(a0 + 16);
+v1 = MEM_U32(a0 + 20);
+a3 = MEM_U32(a2 + 48);
+a1 = MEM_U32(a2 + 32);
+t8 = MEM_U32(a2 + 84);
+v0 = v1 << 2;
+t0 = v1;
+a1 = a1 + 0xfffffffc;
+t6 = (int)a3 >> 2;
+if ((int)a3 >= 0) goto L406924;
+at = a3 + 0x3;
+t6 = (int)at >> 2;
+L406924:
+lo = t6 * v1;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)v1 >> 32);
+t7 = lo;
+v0 = v0 + t7;
+//nop;
+if (t8 == 0) goto L406958;
+a3 = MEM_U32(a2 + 44);
+a1 = a1 - t6;
+v1 = a3 << 1;
+lo = v1 * t0;
+hi = (uint32_t)((uint64_t)v1 * (uint64_t)t0 >> 32);
+a1 = a1 - v1;
+t9 = lo;
+v0 = v0 + t9;
+//nop;
+L406958:
+MEM_U32(a0 + 24) = v0;
+MEM_U32(a0 + 28) = a1;
+return;
+}
+
+static uint32_t f_is_leaf(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, s0 = 0;
+L406964:
+//is_leaf:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+s0 = MEM_U32(a0 + 84);
+// fdead 400200eb MEM_U32(sp + 28) = ra;
+// fdead 400200eb MEM_U32(sp + 24) = gp;
+if (s0 == 0) goto L4069cc;
+L406988:
+t6 = MEM_U8(s0 + 36);
+//nop;
+//nop;
+if (t6 == 0) goto L4069b4;
+//nop;
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = f_is_leaf(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 != 0) goto L4069bc;
+L4069b4:
+v0 = zero;
+goto L4069d0;
+L4069bc:
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L406988;
+L4069cc:
+v0 = 0x1;
+L4069d0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_become_leaf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, s0 = 0, s1 = 0;
+L4069e0:
+//become_leaf:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s0 = MEM_U32(a0 + 84);
+// fdead 4002006b MEM_U32(sp + 28) = s1;
+s1 = a1;
+// fdead 4006006b MEM_U32(sp + 36) = ra;
+// fdead 4006006b MEM_U32(sp + 32) = gp;
+if (s0 == 0) goto L406a58;
+L406a0c:
+//nop;
+if (s0 == s1) goto L406a48;
+t6 = MEM_U8(s0 + 36);
+//nop;
+//nop;
+if (t6 == 0) goto L406a40;
+//nop;
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = f_is_leaf(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 != 0) goto L406a48;
+L406a40:
+v0 = zero;
+goto L406a5c;
+L406a48:
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L406a0c;
+L406a58:
+v0 = 0x1;
+L406a5c:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_multiple_callers(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L406a70:
+//multiple_callers:
+v0 = MEM_U32(a0 + 80);
+//nop;
+t6 = MEM_U32(v0 + 8);
+v0 = MEM_U32(v0 + 0);
+v1 = MEM_U32(t6 + 8);
+//nop;
+if (v0 == 0) goto L406abc;
+L406a8c:
+t7 = MEM_U32(v0 + 8);
+//nop;
+t8 = MEM_U32(t7 + 8);
+//nop;
+//nop;
+if (v1 == t8) goto L406aac;
+v0 = 0x1;
+return v0;
+L406aac:
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 != 0) goto L406a8c;
+L406abc:
+v0 = zero;
+//nop;
+return v0;
+}
+
+static void f_set_inline(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0,
+t9 = 0;
+L406ac8:
+//set_inline:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000ab MEM_U32(sp + 36) = ra;
+// fdead 400000ab MEM_U32(sp + 32) = gp;
+// fdead 400000ab MEM_U32(sp + 28) = s1;
+// fdead 400000ab MEM_U32(sp + 24) = s0;
+v1 = MEM_U32(a0 + 16);
+t6 = 0x1;
+MEM_U8(a0 + 36) = (uint8_t)t6;
+t7 = MEM_U32(v1 + 96);
+t5 = 0x10000010;
+t8 = t7 + 0x1;
+MEM_U32(v1 + 96) = t8;
+v0 = MEM_U32(a0 + 8);
+s0 = a0;
+t9 = MEM_U32(v0 + 100);
+a2 = 0x7;
+t0 = t9 + 0x1;
+MEM_U32(v0 + 100) = t0;
+t2 = MEM_U32(a0 + 16);
+v0 = MEM_U32(a0 + 8);
+t3 = MEM_U32(t2 + 28);
+t1 = MEM_U32(v0 + 28);
+a3 = 0x7;
+t4 = t1 + t3;
+MEM_U32(v0 + 28) = t4;
+t5 = MEM_U32(t5 + 0);
+//nop;
+// bdead 40020181 ra = MEM_U32(sp + 36);
+if (t5 == 0) goto L406cac;
+s1 = 0x10000b30;
+a1 = 0x100012e0;
+//nop;
+a0 = MEM_U32(s1 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+a1 = 0x100012dc;
+//nop;
+a2 = 0x4;
+a3 = 0x4;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+a1 = 0x100012d3;
+//nop;
+a2 = 0x9;
+a3 = 0x9;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+//nop;
+a1 = MEM_U32(s0 + 12);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+a1 = 0x100012d1;
+//nop;
+a2 = 0x2;
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(s0 + 24);
+//nop;
+a0 = MEM_U32(s1 + 0);
+a2 = 0x1;
+a3 = 0xa;
+a1 = -a1;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+a1 = 0x100012c8;
+//nop;
+a2 = 0x9;
+a3 = 0x9;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+//nop;
+a1 = MEM_U32(s0 + 28);
+a2 = 0x1;
+a3 = 0xa;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead 40040001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+a1 = 0x100012bb;
+//nop;
+a2 = 0xd;
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40040181 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 36);
+L406cac:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f_threshold(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+double tempf64;
+union FloatReg f0 = {{0, 0}}, f4 = {{0, 0}}, f6 = {{0, 0}}, f8 = {{0, 0}}, f10 = {{0, 0}}, f12 = {{0, 0}}, f16 = {{0, 0}}, f18 = {{0, 0}};
+L406cbc:
+//threshold:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+at = a0 < a1;
+// fdead 400000ef MEM_U32(sp + 28) = ra;
+// fdead 400000ef MEM_U32(sp + 24) = gp;
+if (at == 0) goto L406d1c;
+f4.w[0] = a0;
+f6.f[0] = (int)f4.w[0];
+if ((int)a0 >= 0) goto L406cf8;
+at = 0x4f800000;
+f8.w[0] = at;
+//nop;
+f6.f[0] = f6.f[0] + f8.f[0];
+L406cf8:
+f10.w[0] = a1;
+f16.f[0] = (int)f10.w[0];
+if ((int)a1 >= 0) goto L406d14;
+at = 0x4f800000;
+f18.w[0] = at;
+//nop;
+f16.f[0] = f16.f[0] + f18.f[0];
+L406d14:
+f0.f[0] = f6.f[0] / f16.f[0];
+goto L406d5c;
+L406d1c:
+f4.w[0] = a1;
+f8.f[0] = (int)f4.w[0];
+if ((int)a1 >= 0) goto L406d38;
+at = 0x4f800000;
+f10.w[0] = at;
+//nop;
+f8.f[0] = f8.f[0] + f10.f[0];
+L406d38:
+f18.w[0] = a0;
+f6.f[0] = (int)f18.w[0];
+if ((int)a0 >= 0) goto L406d54;
+at = 0x4f800000;
+f16.w[0] = at;
+//nop;
+f6.f[0] = f6.f[0] + f16.f[0];
+L406d54:
+//nop;
+f0.f[0] = f8.f[0] / f6.f[0];
+L406d5c:
+//nop;
+f12 = FloatReg_from_double(f0.f[0]);
+//nop;
+tempf64 = wrapper_sqrt(double_from_FloatReg(f12));
+f0 = FloatReg_from_double(tempf64);
+// bdead 19e800000001 gp = MEM_U32(sp + 24);
+// bdead 19e800000001 ra = MEM_U32(sp + 28);
+a0 = 0x10000028;
+f16.f[0] = double_from_FloatReg(f0);
+a0 = MEM_U32(a0 + 0);
+// bdead 19e000000021 sp = sp + 0x20;
+t6 = a0 >> 3;
+f4.w[0] = t6;
+f10.f[0] = (int)f4.w[0];
+if ((int)t6 >= 0) goto L406da4;
+at = 0x4f800000;
+f18.w[0] = at;
+//nop;
+f10.f[0] = f10.f[0] + f18.f[0];
+L406da4:
+//nop;
+f8.f[0] = f10.f[0] / f16.f[0];
+t7 = fcsr;
+//nop;
+at = t7 | 0x3;
+at = at ^ 0x2;
+fcsr = at;
+//nop;
+f6.w[0] = cvt_w_s(f8.f[0]);
+v1 = f6.w[0];
+fcsr = t7;
+//nop;
+if (a0 >= v1) goto L406de0;
+v1 = a0;
+L406de0:
+v0 = v1;
+return v0;
+}
+
+static void f_pack_knapsack(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, lo = 0, hi = 0;
+int cf = 0;
+union FloatReg f4 = {{0, 0}}, f6 = {{0, 0}}, f8 = {{0, 0}}, f10 = {{0, 0}}, f16 = {{0, 0}}, f18 = {{0, 0}};
+L406de8:
+//pack_knapsack:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff80;
+// fdead 4000000b MEM_U32(sp + 52) = s7;
+s7 = 0x10003c88;
+// fdead 4100000b MEM_U32(sp + 28) = s1;
+s7 = MEM_U32(s7 + 0);
+// fdead 4100000b MEM_U32(sp + 60) = ra;
+// fdead 4100000b MEM_U32(sp + 56) = gp;
+// fdead 4100000b MEM_U32(sp + 48) = s6;
+// fdead 4100000b MEM_U32(sp + 44) = s5;
+// fdead 4100000b MEM_U32(sp + 40) = s4;
+// fdead 4100000b MEM_U32(sp + 36) = s3;
+// fdead 4100000b MEM_U32(sp + 32) = s2;
+// fdead 4100000b MEM_U32(sp + 24) = s0;
+s1 = zero;
+if (s7 == 0) goto L4070e4;
+s7 = s7 + 0x1;
+s6 = 0x10002e9c;
+s2 = s7 << 2;
+s3 = 0x4;
+s5 = 0x3e8;
+s4 = 0x1;
+L406e48:
+t6 = MEM_U32(s6 + 0);
+//nop;
+t7 = t6 + s3;
+s0 = MEM_U32(t7 + 0);
+//nop;
+a2 = MEM_U32(s0 + 16);
+//nop;
+t8 = MEM_U32(a2 + 20);
+//nop;
+//nop;
+if (t8 == 0) goto L4070d8;
+v1 = MEM_U32(s0 + 8);
+//nop;
+t9 = MEM_U32(v1 + 20);
+//nop;
+//nop;
+if (t9 == 0) goto L4070d8;
+//nop;
+if (v1 == a2) goto L4070d8;
+t0 = MEM_U32(v1 + 104);
+t1 = MEM_U32(a2 + 104);
+//nop;
+//nop;
+if (t0 != t1) goto L4070d8;
+t2 = MEM_U32(a2 + 64);
+//nop;
+//nop;
+if (t2 != 0) goto L4070d8;
+t3 = MEM_U32(v1 + 64);
+//nop;
+//nop;
+if (t3 == 0) goto L406eec;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_is_leaf(mem, sp, a0);
+// bdead 40fe000b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L4070d8;
+a2 = MEM_U32(s0 + 16);
+//nop;
+L406eec:
+t4 = MEM_U8(s0 + 37);
+t5 = MEM_U8(s0 + 38);
+//nop;
+//nop;
+if (t4 < t5) goto L406f14;
+t6 = MEM_U32(a2 + 72);
+//nop;
+//nop;
+if (t6 != 0) goto L4070d8;
+L406f14:
+t7 = MEM_U8(a2 + 122);
+//nop;
+//nop;
+if (t7 != 0) goto L4070d8;
+t8 = MEM_U8(a2 + 124);
+//nop;
+//nop;
+if (t8 == 0) goto L406f50;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_multiple_callers(mem, sp, a0);
+// bdead 40fe000b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L4070d8;
+L406f50:
+t9 = MEM_U32(s0 + 16);
+//nop;
+t0 = MEM_U8(t9 + 120);
+//nop;
+//nop;
+if (t0 != 0) goto L4070d8;
+//nop;
+a0 = s0;
+//nop;
+f_estimate_inline(mem, sp, a0);
+a2 = MEM_U32(s0 + 16);
+// bdead 40fe0083 gp = MEM_U32(sp + 56);
+t1 = MEM_U8(a2 + 121);
+//nop;
+//nop;
+if (t1 == 0) goto L406fac;
+//nop;
+a0 = s0;
+//nop;
+f_set_inline(mem, sp, a0);
+// bdead 40fc0003 gp = MEM_U32(sp + 56);
+s3 = s3 + 0x4;
+goto L4070dc;
+L406fac:
+t2 = MEM_U32(s0 + 24);
+//nop;
+//nop;
+if ((int)t2 < 0) goto L4070d8;
+t3 = MEM_U32(s0 + 8);
+//nop;
+a1 = MEM_U32(a2 + 28);
+a0 = MEM_U32(t3 + 28);
+//nop;
+v0 = f_threshold(mem, sp, a0, a1);
+t4 = MEM_U32(s0 + 8);
+a2 = MEM_U32(s0 + 16);
+a0 = MEM_U32(t4 + 28);
+t5 = MEM_U32(a2 + 28);
+// bdead 19e040fe40ab gp = MEM_U32(sp + 56);
+t6 = a0 + t5;
+//nop;
+if (v0 < t6) goto L4070d8;
+v0 = MEM_U32(s0 + 28);
+//nop;
+//nop;
+if ((int)v0 > 0) goto L407024;
+//nop;
+a0 = s0;
+//nop;
+f_set_inline(mem, sp, a0);
+// bdead 40fc0003 gp = MEM_U32(sp + 56);
+s3 = s3 + 0x4;
+goto L4070dc;
+L407024:
+t7 = MEM_U32(a2 + 88);
+//nop;
+//nop;
+if (s4 != t7) goto L407060;
+t8 = MEM_U8(a2 + 122);
+//nop;
+//nop;
+if (t8 != 0) goto L407060;
+//nop;
+a0 = s0;
+//nop;
+f_set_inline(mem, sp, a0);
+// bdead 40fc0003 gp = MEM_U32(sp + 56);
+s3 = s3 + 0x4;
+goto L4070dc;
+L407060:
+v1 = s1 << 2;
+if (v0 != 0) goto L40708c;
+t9 = MEM_U32(s0 + 24);
+//nop;
+lo = t9 * s5;
+hi = (uint32_t)((uint64_t)t9 * (uint64_t)s5 >> 32);
+t0 = lo;
+f4.w[0] = t0;
+//nop;
+f6.f[0] = (int)f4.w[0];
+MEM_U32(s0 + 32) = f6.w[0];
+goto L4070c4;
+L40708c:
+t1 = MEM_U32(s0 + 24);
+t2 = a0 >> 6;
+f8.w[0] = t1;
+f10.f[0] = (int)f8.w[0];
+if (t2 != 0) goto L4070a4;
+t2 = 0x1;
+L4070a4:
+lo = v0 * t2;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)t2 >> 32);
+t3 = lo;
+f16.w[0] = t3;
+//nop;
+f18.f[0] = (int)f16.w[0];
+//nop;
+f4.f[0] = f10.f[0] / f18.f[0];
+MEM_U32(s0 + 32) = f4.w[0];
+L4070c4:
+t4 = MEM_U32(s6 + 0);
+v1 = v1 + 0x4;
+t5 = t4 + v1;
+s1 = s1 + 0x1;
+MEM_U32(t5 + 0) = s0;
+L4070d8:
+s3 = s3 + 0x4;
+L4070dc:
+//nop;
+if (s3 != s2) goto L406e48;
+L4070e4:
+s6 = 0x10002e9c;
+s5 = zero;
+s4 = zero;
+MEM_U32(sp + 104) = zero;
+if (s1 == 0) goto L407380;
+s7 = s1 + 0x1;
+t6 = s7 << 2;
+MEM_U32(sp + 68) = t6;
+s3 = 0x4;
+L407108:
+t7 = MEM_U32(s6 + 0);
+//nop;
+t8 = t7 + s3;
+s0 = MEM_U32(t8 + 0);
+//nop;
+t9 = MEM_U8(s0 + 36);
+//nop;
+t4 = MEM_U32(sp + 68);
+if (t9 != 0) goto L407374;
+t0 = MEM_U32(s0 + 8);
+t1 = MEM_U32(s0 + 16);
+//nop;
+a0 = MEM_U32(t0 + 28);
+a1 = MEM_U32(t1 + 28);
+//nop;
+v0 = f_threshold(mem, sp, a0, a1);
+v1 = MEM_U32(s0 + 8);
+a2 = MEM_U32(s0 + 16);
+t2 = MEM_U32(v1 + 28);
+t3 = MEM_U32(a2 + 28);
+// bdead 19e040f21899 gp = MEM_U32(sp + 56);
+t4 = t2 + t3;
+if (v0 < t4) {
+t4 = MEM_U32(sp + 68);
+goto L407374;}
+t4 = MEM_U32(sp + 68);
+v0 = MEM_U32(v1 + 96);
+s2 = MEM_U32(s0 + 24);
+s1 = MEM_U32(s0 + 28);
+//nop;
+if (v0 == 0) goto L4071a4;
+t5 = MEM_U32(v1 + 88);
+//nop;
+//nop;
+if (v0 == t5) goto L407194;
+v0 = v0 + 0x1;
+L407194:
+lo = s1 * v0;
+hi = (uint32_t)((uint64_t)s1 * (uint64_t)v0 >> 32);
+s1 = lo;
+//nop;
+//nop;
+L4071a4:
+t7 = MEM_U32(v1 + 100);
+t6 = MEM_U32(v1 + 92);
+t8 = t7 + 0x1;
+//nop;
+if (t6 != t8) goto L407234;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_is_leaf(mem, sp, a0);
+// bdead 19e040fe0009 gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L407234;
+//nop;
+a0 = MEM_U32(s0 + 8);
+a1 = s0;
+v0 = f_become_leaf(mem, sp, a0, a1);
+// bdead 19e040fe0009 gp = MEM_U32(sp + 56);
+//nop;
+if (v0 == 0) goto L407234;
+v1 = MEM_U32(s0 + 8);
+//nop;
+t9 = MEM_U32(v1 + 44);
+t1 = MEM_U32(v1 + 48);
+t0 = t9 << 1;
+t2 = (int)t1 >> 2;
+if ((int)t1 >= 0) goto L407214;
+at = t1 + 0x3;
+t2 = (int)at >> 2;
+L407214:
+t3 = MEM_U32(v1 + 36);
+v0 = t0 + t2;
+v0 = v0 + 0x2;
+lo = v0 * t3;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)t3 >> 32);
+s1 = s1 - v0;
+t4 = lo;
+s2 = s2 + t4;
+//nop;
+L407234:
+t5 = MEM_U32(s0 + 8);
+at = 0x10000038;
+t7 = MEM_U32(t5 + 28);
+f6.w[0] = MEM_U32(at + 0);
+t6 = t7 >> 7;
+//nop;
+if (t6 != 0) goto L407254;
+t6 = 0x1;
+L407254:
+lo = s1 * t6;
+hi = (uint32_t)((uint64_t)s1 * (uint64_t)t6 >> 32);
+f10.w[0] = s2;
+t9 = MEM_U32(sp + 104);
+f18.f[0] = (int)f10.w[0];
+t8 = lo;
+f8.w[0] = t8;
+//nop;
+f16.f[0] = (int)f8.w[0];
+//nop;
+f4.f[0] = f16.f[0] / f18.f[0];
+cf = f6.f[0] < f4.f[0];
+//nop;
+//nop;
+if (cf == 0) goto L40729c;
+t4 = MEM_U32(sp + 68);
+if (t9 != 0) goto L407374;
+MEM_U32(sp + 104) = s0;
+goto L407370;
+L40729c:
+//nop;
+a0 = s0;
+//nop;
+f_set_inline(mem, sp, a0);
+a2 = MEM_U32(s0 + 16);
+// bdead 40fc0081 gp = MEM_U32(sp + 56);
+t0 = MEM_U32(a2 + 96);
+t1 = MEM_U32(a2 + 88);
+t2 = t0 + 0x1;
+s5 = s5 + s1;
+s4 = s4 + s2;
+if (t1 != t2) goto L407370;
+t3 = MEM_U8(a2 + 120);
+//nop;
+t4 = MEM_U32(sp + 68);
+if (t3 != 0) goto L407374;
+s0 = MEM_U32(a2 + 80);
+//nop;
+t4 = MEM_U8(s0 + 36);
+//nop;
+//nop;
+if (t4 == 0) goto L407318;
+L4072f4:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L407308;
+abort();
+L407308:
+t5 = MEM_U8(s0 + 36);
+//nop;
+//nop;
+if (t5 != 0) goto L4072f4;
+L407318:
+t7 = MEM_U32(s0 + 8);
+//nop;
+t6 = MEM_U32(t7 + 20);
+//nop;
+t4 = MEM_U32(sp + 68);
+if (t6 == 0) goto L407374;
+t8 = MEM_U32(s0 + 24);
+//nop;
+t4 = MEM_U32(sp + 68);
+if ((int)t8 < 0) goto L407374;
+//nop;
+a0 = s0;
+//nop;
+f_set_inline(mem, sp, a0);
+t1 = MEM_U32(s0 + 16);
+t9 = MEM_U32(s0 + 28);
+t3 = MEM_U32(s0 + 24);
+t2 = MEM_U32(t1 + 32);
+t0 = s5 + t9;
+// bdead 40b01a01 gp = MEM_U32(sp + 56);
+s4 = s4 + t3;
+s5 = t0 - t2;
+L407370:
+t4 = MEM_U32(sp + 68);
+L407374:
+s3 = s3 + 0x4;
+//nop;
+if (s3 != t4) goto L407108;
+L407380:
+t5 = 0x10000010;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+// bdead 40600001 ra = MEM_U32(sp + 60);
+if (t5 == 0) goto L407508;
+s1 = 0x10004ca8;
+a2 = 0x28;
+t7 = MEM_U32(s1 + 0);
+a3 = 0x28;
+//nop;
+if (t7 == 0) goto L407450;
+s0 = 0x10000b30;
+a1 = 0x1000130c;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+v0 = MEM_U32(s1 + 0);
+// bdead 19e040620009 gp = MEM_U32(sp + 56);
+t6 = v0 - s4;
+f8.w[0] = t6;
+a0 = MEM_U32(s0 + 0);
+f10.f[0] = (int)f8.w[0];
+if ((int)t6 >= 0) goto L4073f4;
+at = 0x4f800000;
+f16.w[0] = at;
+//nop;
+f10.f[0] = f10.f[0] + f16.f[0];
+L4073f4:
+f18.w[0] = v0;
+f6.f[0] = (int)f18.w[0];
+if ((int)v0 >= 0) goto L407410;
+at = 0x4f800000;
+f4.w[0] = at;
+//nop;
+f6.f[0] = f6.f[0] + f4.f[0];
+L407410:
+//nop;
+f8.f[0] = f10.f[0] / f6.f[0];
+//nop;
+a2 = 0x1;
+a3 = 0x2;
+a1 = f8.w[0];
+//nop;
+f_write_real(mem, sp, a0, a1, a2, a3);
+// bdead 40420181 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40400001 gp = MEM_U32(sp + 56);
+//nop;
+L407450:
+s1 = 0x10004ca4;
+s0 = 0x10000b30;
+t8 = MEM_U32(s1 + 0);
+a2 = 0x25;
+a3 = 0x25;
+if (t8 == 0) goto L407504;
+a1 = 0x100012e7;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+v0 = MEM_U32(s1 + 0);
+// bdead 19e040420009 gp = MEM_U32(sp + 56);
+t9 = v0 + s5;
+f16.w[0] = t9;
+a0 = MEM_U32(s0 + 0);
+f18.f[0] = (int)f16.w[0];
+if ((int)t9 >= 0) goto L4074a8;
+at = 0x4f800000;
+f4.w[0] = at;
+//nop;
+f18.f[0] = f18.f[0] + f4.f[0];
+L4074a8:
+f10.w[0] = v0;
+f6.f[0] = (int)f10.w[0];
+if ((int)v0 >= 0) goto L4074c4;
+at = 0x4f800000;
+f8.w[0] = at;
+//nop;
+f6.f[0] = f6.f[0] + f8.f[0];
+L4074c4:
+//nop;
+f16.f[0] = f18.f[0] / f6.f[0];
+//nop;
+a2 = 0x1;
+a3 = 0x2;
+a1 = f16.w[0];
+//nop;
+f_write_real(mem, sp, a0, a1, a2, a3);
+// bdead 40020181 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 56);
+//nop;
+L407504:
+// bdead 1 ra = MEM_U32(sp + 60);
+L407508:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x80;
+return;
+//nop;
+}
+
+static uint32_t f_roundup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0, lo = 0, hi = 0;
+L407534:
+//roundup:
+lo = (int)a0 / (int)a1; hi = (int)a0 % (int)a1;
+//nop;
+if (a1 != 0) goto L407544;
+abort();
+L407544:
+at = 0xffffffff;
+if (a1 != at) {
+at = 0x80000000;
+goto L40755c;}
+at = 0x80000000;
+//nop;
+if (a0 != at) goto L40755c;
+abort();
+L40755c:
+t6 = hi;
+//nop;
+if (t6 == 0) goto L4075ac;
+lo = (int)a0 / (int)a1; hi = (int)a0 % (int)a1;
+//nop;
+if (a1 != 0) goto L407578;
+abort();
+L407578:
+at = 0xffffffff;
+if (a1 != at) {
+at = 0x80000000;
+goto L407590;}
+at = 0x80000000;
+//nop;
+if (a0 != at) goto L407590;
+abort();
+L407590:
+t7 = lo;
+t8 = t7 + 0x1;
+//nop;
+lo = t8 * a1;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)a1 >> 32);
+a0 = lo;
+//nop;
+//nop;
+L4075ac:
+v0 = a0;
+return v0;
+}
+
+static uint32_t f_rounddown(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0, lo = 0, hi = 0;
+L4075b4:
+//rounddown:
+lo = (int)a0 / (int)a1; hi = (int)a0 % (int)a1;
+//nop;
+if (a1 != 0) goto L4075c4;
+abort();
+L4075c4:
+at = 0xffffffff;
+if (a1 != at) {
+at = 0x80000000;
+goto L4075dc;}
+at = 0x80000000;
+//nop;
+if (a0 != at) goto L4075dc;
+abort();
+L4075dc:
+t6 = hi;
+//nop;
+if (t6 == 0) goto L40762c;
+lo = (int)a0 / (int)a1; hi = (int)a0 % (int)a1;
+//nop;
+if (a1 != 0) goto L4075f8;
+abort();
+L4075f8:
+at = 0xffffffff;
+if (a1 != at) {
+at = 0x80000000;
+goto L407610;}
+at = 0x80000000;
+//nop;
+if (a0 != at) goto L407610;
+abort();
+L407610:
+t7 = lo;
+t8 = t7 + 0xffffffff;
+//nop;
+lo = t8 * a1;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)a1 >> 32);
+a0 = lo;
+//nop;
+//nop;
+L40762c:
+v0 = a0;
+return v0;
+}
+
+static void f_fix_parm_offsets(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L407634:
+//fix_parm_offsets:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+t6 = 0x10003c70;
+// fdead 4000800b MEM_U32(sp + 60) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000800b MEM_U32(sp + 56) = fp;
+// fdead 4000800b MEM_U32(sp + 52) = gp;
+// fdead 4000800b MEM_U32(sp + 48) = s7;
+// fdead 4000800b MEM_U32(sp + 44) = s6;
+// fdead 4000800b MEM_U32(sp + 40) = s5;
+// fdead 4000800b MEM_U32(sp + 36) = s4;
+// fdead 4000800b MEM_U32(sp + 32) = s3;
+// fdead 4000800b MEM_U32(sp + 28) = s2;
+// fdead 4000800b MEM_U32(sp + 24) = s1;
+// fdead 4000800b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 68) = t6;
+if (t6 == 0) goto L407890;
+s4 = 0x10003c80;
+s3 = 0x10000054;
+s2 = 0x1000005c;
+fp = 0x9;
+s7 = 0x4;
+s6 = 0x6;
+s5 = 0x11;
+L40769c:
+t7 = MEM_U32(sp + 68);
+s1 = zero;
+s0 = MEM_U32(t7 + 52);
+//nop;
+//nop;
+if (s0 == 0) goto L407810;
+L4076b4:
+t8 = MEM_U32(s2 + 0);
+t0 = MEM_U8(s0 + 25);
+t9 = t8 + 0x1;
+MEM_U32(s2 + 0) = t9;
+if (t0 == 0) goto L4076fc;
+t1 = MEM_U8(s0 + 26);
+//nop;
+v0 = t1 & 0xff;
+MEM_U8(s0 + 0) = (uint8_t)t1;
+if (s5 != v0) goto L4076e8;
+MEM_U8(s0 + 0) = (uint8_t)s6;
+MEM_U32(s0 + 20) = s7;
+v0 = s6 & 0xff;
+L4076e8:
+t2 = MEM_U32(s3 + 0);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(s3 + 0) = t3;
+goto L407708;
+L4076fc:
+t4 = MEM_U32(s0 + 8);
+v0 = MEM_U8(s0 + 0);
+MEM_U32(s0 + 20) = t4;
+L407708:
+t5 = MEM_U8(s4 + 0);
+t4 = v0 < 0x20;
+at = 0x5080000;
+if (t5 != 0) goto L4077b0;
+t6 = v0 < 0x20;
+t7 = -t6;
+at = 0x5080000;
+t8 = t7 & at;
+t9 = t8 << (v0 & 0x1f);
+//nop;
+if ((int)t9 >= 0) goto L407750;
+//nop;
+a0 = s1;
+a1 = 0x8;
+v0 = f_roundup(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+t2 = MEM_U32(s0 + 20);
+goto L4077a4;
+L407750:
+//nop;
+if (fp != v0) goto L407788;
+t0 = MEM_U32(s0 + 4);
+//nop;
+t1 = t0 & 0x7;
+//nop;
+if (t1 != 0) goto L407788;
+//nop;
+a0 = s1;
+a1 = 0x8;
+v0 = f_roundup(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+t2 = MEM_U32(s0 + 20);
+goto L4077a4;
+L407788:
+//nop;
+a0 = s1;
+a1 = 0x4;
+v0 = f_roundup(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+//nop;
+t2 = MEM_U32(s0 + 20);
+L4077a4:
+MEM_U32(s0 + 16) = v0;
+s1 = v0 + t2;
+goto L407800;
+L4077b0:
+t5 = -t4;
+t3 = MEM_U32(s0 + 20);
+t6 = t5 & at;
+t7 = t6 << (v0 & 0x1f);
+s1 = s1 - t3;
+if ((int)t7 >= 0) goto L4077e4;
+//nop;
+a0 = s1;
+a1 = 0x8;
+v0 = f_rounddown(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+s1 = v0;
+goto L4077fc;
+L4077e4:
+//nop;
+a0 = s1;
+a1 = 0x4;
+v0 = f_rounddown(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+s1 = v0;
+L4077fc:
+MEM_U32(s0 + 16) = v0;
+L407800:
+s0 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if (s0 != 0) goto L4076b4;
+L407810:
+t8 = MEM_U8(s4 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L40783c;
+//nop;
+a0 = s1;
+a1 = 0x4;
+v0 = f_roundup(mem, sp, a0, a1);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+t9 = MEM_U32(sp + 68);
+goto L407858;
+L40783c:
+//nop;
+a0 = s1;
+a1 = 0x4;
+v0 = f_rounddown(mem, sp, a0, a1);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+//nop;
+t9 = MEM_U32(sp + 68);
+L407858:
+t1 = 0x1;
+t0 = MEM_U32(t9 + 48);
+//nop;
+t2 = MEM_U32(sp + 68);
+if ((int)t0 >= (int)v0) goto L40787c;
+MEM_U32(t9 + 48) = v0;
+MEM_U8(t9 + 126) = (uint8_t)t1;
+t2 = MEM_U32(sp + 68);
+L40787c:
+//nop;
+t3 = MEM_U32(t2 + 60);
+//nop;
+MEM_U32(sp + 68) = t3;
+if (t3 != 0) goto L40769c;
+L407890:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x48;
+return;
+}
+
+static uint32_t f_map_lab(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0;
+L4078c0:
+//map_lab:
+//nop;
+//nop;
+//nop;
+at = 0x9ed60000;
+at = at | 0xab3;
+lo = a0 * at;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)at >> 32);
+t0 = 0x10004cc0;
+sp = sp + 0xffffffd0;
+// fdead 64000022f MEM_U32(sp + 28) = ra;
+// fdead 64000022f MEM_U32(sp + 24) = gp;
+a2 = a0;
+t6 = lo;
+t7 = t6 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+a3 = t9 + t0;
+v1 = MEM_U32(a3 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L407930;
+L407910:
+t1 = MEM_U32(v1 + 4);
+//nop;
+// bdead 40000191 ra = MEM_U32(sp + 28);
+if (a2 == t1) goto L407984;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L407910;
+L407930:
+//nop;
+a1 = 0x100054c0;
+a0 = 0xc;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 32) = a3;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 48);
+a3 = MEM_U32(sp + 32);
+a0 = 0x10003c44;
+MEM_U32(v0 + 4) = a2;
+t2 = MEM_U32(a0 + 0);
+v1 = v0;
+t3 = t2 + 0x1;
+MEM_U32(a0 + 0) = t3;
+MEM_U32(v0 + 8) = t3;
+t5 = MEM_U32(a3 + 0);
+//nop;
+MEM_U32(v0 + 0) = t5;
+MEM_U32(a3 + 0) = v0;
+// bdead 11 ra = MEM_U32(sp + 28);
+L407984:
+v0 = MEM_U32(v1 + 8);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void f_one_instruction(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L407990:
+//one_instruction:
+//nop;
+//nop;
+//nop;
+a3 = 0x10004cac;
+sp = sp + 0xffffffe0;
+a2 = MEM_U32(a3 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+v0 = MEM_U8(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+goto L407d30;
+L4079bc:
+t6 = MEM_U8(a2 + 1);
+at = 0x2;
+t7 = t6 << 24;
+t8 = t7 >> 29;
+// bdead 40000081 ra = MEM_U32(sp + 28);
+if (t8 != at) goto L407e30;
+t9 = MEM_U32(sp + 32);
+a0 = MEM_U32(a2 + 12);
+a1 = MEM_U32(t9 + 52);
+//nop;
+//nop;
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+a3 = 0x10004cac;
+// bdead 109 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L407e30;
+a2 = MEM_U32(a3 + 0);
+t1 = MEM_U32(v0 + 16);
+t0 = MEM_U32(a2 + 12);
+t3 = MEM_U32(v0 + 4);
+t2 = t0 + t1;
+t4 = t2 - t3;
+MEM_U32(a2 + 12) = t4;
+goto L407e2c;
+L407a24:
+t5 = MEM_U8(a2 + 1);
+at = 0x2;
+t6 = t5 << 24;
+t7 = t6 >> 29;
+// bdead 40000081 ra = MEM_U32(sp + 28);
+if (t7 != at) goto L407e30;
+t8 = MEM_U32(sp + 32);
+//nop;
+a0 = MEM_U32(a2 + 16);
+a1 = MEM_U32(t8 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+a3 = 0x10004cac;
+// bdead 109 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L407e30;
+a2 = MEM_U32(a3 + 0);
+t0 = MEM_U32(v0 + 16);
+t9 = MEM_U32(a2 + 12);
+t2 = MEM_U32(v0 + 4);
+t1 = t9 + t0;
+t3 = t1 - t2;
+MEM_U32(a2 + 12) = t3;
+t5 = MEM_U32(v0 + 16);
+t4 = MEM_U32(a2 + 16);
+t7 = MEM_U32(v0 + 4);
+t6 = t4 + t5;
+t8 = t6 - t7;
+MEM_U32(a2 + 16) = t8;
+goto L407e2c;
+L407aa0:
+v0 = MEM_U8(a2 + 1);
+at = 0x2;
+t9 = v0 << 24;
+v0 = t9 >> 29;
+if (v0 != at) {
+at = 0x5;
+goto L407b60;}
+at = 0x5;
+t1 = MEM_U32(sp + 32);
+//nop;
+a0 = MEM_U32(a2 + 12);
+a1 = MEM_U32(t1 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10004cb0;
+a3 = 0x10004cac;
+MEM_U32(a0 + 0) = v0;
+if (v0 == 0) goto L407e2c;
+a2 = MEM_U32(a3 + 0);
+t3 = MEM_U32(v0 + 16);
+t2 = MEM_U32(a2 + 12);
+t5 = MEM_U32(v0 + 4);
+t4 = t2 + t3;
+t6 = t4 - t5;
+MEM_U32(a2 + 12) = t6;
+t7 = MEM_U8(v0 + 25);
+//nop;
+//nop;
+if (t7 == 0) goto L407b54;
+//nop;
+a0 = a2;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+a3 = 0x10004cac;
+//nop;
+a0 = MEM_U32(a3 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10003c60;
+MEM_U32(at + 0) = v0;
+goto L407e2c;
+L407b54:
+MEM_U32(a0 + 0) = zero;
+goto L407e2c;
+at = 0x5;
+L407b60:
+// bdead 40000081 ra = MEM_U32(sp + 28);
+if (v0 != at) goto L407e30;
+v0 = 0x10004cb4;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+// bdead 40000089 ra = MEM_U32(sp + 28);
+if (v0 == 0) goto L407e30;
+//nop;
+a0 = MEM_U32(a2 + 12);
+a1 = MEM_U32(v0 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+a3 = 0x10004cac;
+//nop;
+if (v0 == 0) goto L407bd0;
+a2 = MEM_U32(a3 + 0);
+t9 = MEM_U32(v0 + 16);
+t3 = 0x10004cb8;
+t8 = MEM_U32(a2 + 12);
+t1 = MEM_U32(v0 + 4);
+t3 = MEM_U32(t3 + 0);
+t0 = t8 + t9;
+t2 = t0 - t1;
+t4 = t2 + t3;
+MEM_U32(a2 + 12) = t4;
+L407bd0:
+v0 = MEM_U32(a3 + 0);
+//nop;
+t5 = MEM_U8(v0 + 1);
+//nop;
+t6 = t5 & 0xff1f;
+t7 = t6 | 0x20;
+MEM_U8(v0 + 1) = (uint8_t)t7;
+t8 = MEM_U32(sp + 32);
+t0 = MEM_U32(a3 + 0);
+t9 = MEM_U32(t8 + 8);
+MEM_U32(t0 + 4) = t9;
+goto L407e2c;
+L407c00:
+t1 = 0x10004cb0;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+// bdead 40000003 ra = MEM_U32(sp + 28);
+if (t1 == 0) goto L407e30;
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t2 = 0x52;
+a0 = 0x10003c5c;
+a3 = 0x10004cac;
+a0 = MEM_U32(a0 + 0);
+a2 = MEM_U32(a3 + 0);
+v0 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)t2;
+t4 = MEM_U8(a2 + 1);
+t5 = v0 << 27;
+t6 = t5 >> 27;
+t7 = t4 ^ t6;
+t8 = t7 & 0x1f;
+t0 = t8 ^ v0;
+t1 = t0 & 0xff1f;
+t3 = MEM_U32(sp + 32);
+t2 = t1 | 0x40;
+MEM_U8(a0 + 1) = (uint8_t)t0;
+MEM_U8(a0 + 1) = (uint8_t)t2;
+t5 = MEM_U32(t3 + 8);
+t4 = 0x10004cb0;
+MEM_U32(a0 + 4) = t5;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t6 = MEM_U32(t4 + 16);
+//nop;
+MEM_U32(a0 + 12) = t6;
+t7 = MEM_U32(a2 + 8);
+//nop;
+MEM_U32(a0 + 8) = t7;
+t8 = MEM_U16(a2 + 2);
+MEM_U16(a0 + 2) = (uint16_t)t8;
+v0 = f_next_u(mem, sp, a0);
+// bdead b gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10003c5c;
+a3 = 0x10004cac;
+//nop;
+MEM_U32(at + 0) = v0;
+a0 = MEM_U32(a3 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead b gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10003c60;
+//nop;
+MEM_U32(at + 0) = v0;
+at = 0x10004cb0;
+MEM_U32(at + 0) = zero;
+goto L407e2c;
+L407cf0:
+//nop;
+a0 = a2;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+a3 = 0x10004cac;
+//nop;
+a0 = MEM_U32(a3 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10003c60;
+MEM_U32(at + 0) = v0;
+goto L407e2c;
+L407d30:
+if (v0 < 0x3a) {
+at = v0 < 0x54;
+goto L407d9c;}
+if (v0 < 0x54) {
+at = 0x71;
+goto L407d60;}
+at = 0x71;
+//nop;
+if (v0 == at) goto L407cf0;
+at = 0x7b;
+//nop;
+if (v0 == at) goto L4079bc;
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L407e30;
+L407d60:
+at = 0x47;
+//nop;
+if (v0 == at) goto L407a24;
+t9 = v0 + 0xffffffae;
+// bdead 44000083 ra = MEM_U32(sp + 28);
+if (t9 >= 0x2) goto L407e30;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L407aa0;
+case 1: goto L407cf0;
+}
+L407d9c:
+if (v0 < 0x15) {
+at = v0 < 0x2c;
+goto L407de0;}
+t1 = v0 + 0xffffffca;
+if (v0 >= 0x2c) goto L407e00;
+t0 = v0 + 0xffffffdc;
+// bdead 40000281 ra = MEM_U32(sp + 28);
+if (t0 >= 0x8) goto L407e30;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t0) {
+case 0: goto L407cf0;
+case 1: goto L407e2c;
+case 2: goto L407e2c;
+case 3: goto L407cf0;
+case 4: goto L407e2c;
+case 5: goto L407e2c;
+case 6: goto L407cf0;
+case 7: goto L407cf0;
+}
+L407de0:
+at = 0x6;
+//nop;
+if (v0 == at) goto L407cf0;
+at = 0x14;
+//nop;
+if (v0 == at) goto L407cf0;
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L407e30;
+L407e00:
+// bdead 40000483 ra = MEM_U32(sp + 28);
+if (t1 >= 0x4) goto L407e30;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L407c00;
+case 1: goto L407e2c;
+case 2: goto L407e2c;
+case 3: goto L407cf0;
+}
+L407e2c:
+// bdead 1 ra = MEM_U32(sp + 28);
+L407e30:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_put_comm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L407e3c:
+//put_comm:
+//nop;
+//nop;
+//nop;
+t6 = 0x13;
+MEM_U8(a0 + 0) = (uint8_t)t6;
+t7 = MEM_U8(a1 + 0);
+sp = sp + 0xfffffbd8;
+v0 = 0x1;
+if (t7 == 0) goto L407e84;
+a2 = a1 + 0x1;
+a3 = MEM_U8(a2 + -1);
+v1 = sp + 0x28;
+L407e6c:
+MEM_U8(v1 + 0) = (uint8_t)a3;
+a3 = MEM_U8(a2 + 0);
+v0 = v0 + 0x1;
+v1 = v1 + 0x1;
+a2 = a2 + 0x1;
+if (a3 != 0) goto L407e6c;
+L407e84:
+v1 = 0x100030b0;
+v0 = v0 + 0xffffffff;
+v1 = MEM_U8(v1 + 377);
+a1 = v0 + 0x3;
+t8 = v1 << 2;
+t9 = a0 + t8;
+MEM_U32(t9 + 0) = v0;
+t3 = (int)a1 >> 2;
+if ((int)a1 >= 0) goto L407eb0;
+at = a1 + 0x3;
+t3 = (int)at >> 2;
+L407eb0:
+a2 = t3 + 0x1;
+if (t3 == 0) goto L407f4c;
+t2 = a2 + 0xffffffff;
+t4 = t2 & 0x3;
+v0 = 0x1;
+if (t4 == 0) goto L407f00;
+a1 = v0 << 2;
+t5 = v1 << 2;
+t6 = a0 + t5;
+t7 = sp + 0x24;
+t0 = a1 + t7;
+a3 = t6 + a1;
+t1 = t4 + 0x1;
+L407ee4:
+t8 = MEM_U32(t0 + 0);
+v0 = v0 + 0x1;
+a3 = a3 + 0x4;
+t0 = t0 + 0x4;
+MEM_U32(a3 + 0) = t8;
+if (t1 != v0) goto L407ee4;
+if (v0 == a2) {
+a1 = v0 << 2;
+goto L407f4c;}
+L407f00:
+a1 = v0 << 2;
+t9 = v1 << 2;
+t4 = sp + 0x24;
+t3 = a0 + t9;
+t5 = a2 << 2;
+t1 = t5 + t4;
+a3 = t3 + a1;
+t0 = a1 + t4;
+L407f20:
+t6 = MEM_U32(t0 + 0);
+t7 = MEM_U32(t0 + 4);
+t8 = MEM_U32(t0 + 8);
+t9 = MEM_U32(t0 + 12);
+t0 = t0 + 0x10;
+a3 = a3 + 0x10;
+MEM_U32(a3 + -12) = t6;
+MEM_U32(a3 + -8) = t7;
+MEM_U32(a3 + -4) = t8;
+MEM_U32(a3 + 0) = t9;
+if (t0 != t1) goto L407f20;
+L407f4c:
+// bdead 1 sp = sp + 0x428;
+return;
+}
+
+static uint32_t f_align_to_double(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L407f54:
+//align_to_double:
+t6 = a0 & 0x7;
+v0 = a0;
+if (t6 == 0) goto L407f70;
+v0 = a0 >> 3;
+t7 = v0 << 3;
+v0 = t7 + 0x8;
+return v0;
+L407f70:
+//nop;
+return v0;
+}
+
+static uint32_t f_has_readonly_init(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L407f78:
+//has_readonly_init:
+//nop;
+//nop;
+//nop;
+v1 = MEM_U32(a0 + 4);
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = v1 * at;
+hi = (uint32_t)((uint64_t)v1 * (uint64_t)at >> 32);
+t9 = 0x100044a0;
+sp = sp + 0xfffffff8;
+// fdead 6440001ff MEM_U32(sp + 4) = s0;
+MEM_U32(sp + 12) = a1;
+s0 = a1 & 0xff;
+v0 = lo;
+t6 = v0 >> 23;
+t7 = t6 & 0xffff;
+t8 = t7 << 2;
+t1 = t8 + t9;
+t0 = MEM_U32(t1 + 0);
+//nop;
+v0 = zero;
+if (t0 == 0) goto L408040;
+L407fcc:
+a1 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (a1 == 0) goto L40802c;
+t2 = MEM_U32(a1 + 4);
+//nop;
+//nop;
+if (v1 != t2) goto L40802c;
+t3 = MEM_U32(a0 + 12);
+t4 = MEM_U32(a1 + 12);
+//nop;
+//nop;
+if (t3 != t4) goto L40802c;
+t5 = MEM_U8(a1 + 1);
+//nop;
+t6 = t5 & 0x1f;
+//nop;
+if (s0 != t6) goto L40802c;
+t7 = MEM_U32(a1 + 8);
+v0 = 0x1;
+//nop;
+if (a2 != t7) goto L40802c;
+MEM_U32(a3 + 0) = a1;
+goto L408040;
+L40802c:
+t0 = MEM_U32(t0 + 4);
+//nop;
+//nop;
+if (t0 != 0) goto L407fcc;
+v0 = zero;
+L408040:
+// bdead 9 s0 = MEM_U32(sp + 4);
+// bdead 9 sp = sp + 0x8;
+return v0;
+}
+
+static void f_inline_procedure(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40804c:
+//inline_procedure:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff68;
+t6 = 0x10000010;
+// fdead 400081eb MEM_U32(sp + 48) = s7;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 40) = s5;
+// fdead 400081eb MEM_U32(sp + 20) = s0;
+s0 = a1;
+s5 = a0;
+s7 = a3;
+// fdead 414281eb MEM_U32(sp + 60) = ra;
+// fdead 414281eb MEM_U32(sp + 56) = fp;
+// fdead 414281eb MEM_U32(sp + 52) = gp;
+// fdead 414281eb MEM_U32(sp + 44) = s6;
+// fdead 414281eb MEM_U32(sp + 36) = s4;
+// fdead 414281eb MEM_U32(sp + 32) = s3;
+// fdead 414281eb MEM_U32(sp + 28) = s2;
+// fdead 414281eb MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 160) = a2;
+if (t6 != 0) goto L4080bc;
+t7 = 0x10000014;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L408114;
+L4080bc:
+s4 = 0x10000b30;
+a1 = 0x100013dc;
+//nop;
+a0 = MEM_U32(s4 + 0);
+a2 = 0xd;
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41620003 gp = MEM_U32(sp + 52);
+a0 = s7;
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead 41620183 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 41420003 gp = MEM_U32(sp + 52);
+//nop;
+L408114:
+t8 = 0x10003c54;
+v0 = MEM_U32(s7 + 20);
+t8 = MEM_U32(t8 + 0);
+s4 = 0x10000b30;
+//nop;
+if ((int)v0 >= (int)t8) goto L408134;
+abort();
+L408134:
+t9 = 0x10003c58;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if ((int)v0 < (int)t9) goto L408154;
+abort();
+L408154:
+t0 = MEM_U32(s5 + 56);
+t1 = MEM_U32(s7 + 48);
+//nop;
+a0 = t0 + t1;
+//nop;
+v0 = f_align_to_double(mem, sp, a0);
+// bdead 4162000b gp = MEM_U32(sp + 52);
+s6 = -v0;
+at = 0x10004cb8;
+//nop;
+MEM_U32(at + 0) = s6;
+t2 = MEM_U32(s7 + 56);
+MEM_U8(sp + 127) = (uint8_t)zero;
+t3 = t2 - s6;
+MEM_U32(s5 + 56) = t3;
+a0 = s0;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41e0000b gp = MEM_U32(sp + 52);
+t4 = MEM_U32(sp + 160);
+s2 = 0x10004cac;
+at = 0x10003c60;
+MEM_U32(s2 + 0) = v0;
+a1 = v0;
+MEM_U32(at + 0) = v0;
+if (t4 == v0) goto L408a18;
+s3 = 0x10003c5c;
+s0 = MEM_U32(sp + 108);
+fp = 0x7b;
+L4081c4:
+v1 = MEM_U8(a1 + 0);
+at = 0x64;
+if (v1 != at) {
+at = 0x66;
+goto L40868c;}
+at = 0x66;
+//nop;
+a0 = a1;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+t5 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s7 + 52);
+a0 = MEM_U32(t5 + 12);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1fa000b gp = MEM_U32(sp + 52);
+s1 = v0;
+if (v0 != 0) goto L408354;
+a1 = MEM_U32(s2 + 0);
+t6 = MEM_U32(s7 + 48);
+t7 = MEM_U32(a1 + 12);
+t8 = MEM_U32(a1 + 8);
+a2 = 0x28;
+t9 = t7 + t8;
+a3 = 0x28;
+if ((int)t6 < (int)t9) goto L408258;
+t0 = MEM_U8(s7 + 126);
+//nop;
+//nop;
+if (t0 == 0) goto L4082f4;
+L408258:
+a1 = 0x100013b4;
+//nop;
+a0 = MEM_U32(s4 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s7 + 16);
+//nop;
+a0 = s4;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+a1 = 0x100013aa;
+//nop;
+a2 = 0xa;
+a3 = 0xa;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1f80183 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+s0 = MEM_U32(s3 + 0);
+t2 = MEM_U32(s2 + 0);
+v1 = MEM_U8(s0 + 1);
+t1 = 0x67;
+MEM_U8(s0 + 0) = (uint8_t)t1;
+t4 = MEM_U8(t2 + 1);
+t5 = v1 << 27;
+t7 = t5 >> 27;
+t8 = t4 ^ t7;
+t6 = t8 & 0x1f;
+// bdead c1fa8013 gp = MEM_U32(sp + 52);
+t9 = t6 ^ v1;
+MEM_U8(s0 + 1) = (uint8_t)t9;
+goto L40864c;
+L4082f4:
+s0 = MEM_U32(s3 + 0);
+//nop;
+MEM_U8(s0 + 0) = (uint8_t)fp;
+t0 = MEM_U32(s5 + 8);
+v1 = MEM_U8(s0 + 1);
+MEM_U32(s0 + 4) = t0;
+t2 = MEM_U8(a1 + 1);
+t3 = v1 << 27;
+t5 = t3 >> 27;
+t4 = t2 ^ t5;
+t7 = t4 & 0x1f;
+t6 = t7 ^ v1;
+t9 = t6 & 0xff1f;
+t0 = t9 | 0x20;
+MEM_U8(s0 + 1) = (uint8_t)t6;
+MEM_U8(s0 + 1) = (uint8_t)t0;
+t1 = MEM_U32(a1 + 12);
+//nop;
+t3 = t1 + s6;
+MEM_U32(s0 + 12) = t3;
+t2 = MEM_U32(a1 + 8);
+MEM_U16(s0 + 2) = (uint16_t)zero;
+MEM_U32(s0 + 8) = t2;
+goto L40864c;
+L408354:
+t5 = MEM_U8(v0 + 25);
+//nop;
+//nop;
+if (t5 != 0) goto L4083f8;
+s0 = MEM_U32(s3 + 0);
+a1 = MEM_U32(s2 + 0);
+MEM_U8(s0 + 0) = (uint8_t)fp;
+t4 = MEM_U32(s5 + 8);
+v1 = MEM_U8(s0 + 1);
+MEM_U32(s0 + 4) = t4;
+t8 = MEM_U8(a1 + 1);
+t6 = v1 << 27;
+t9 = t6 >> 27;
+t0 = t8 ^ t9;
+t1 = t0 & 0x1f;
+t2 = t1 ^ v1;
+t5 = t2 & 0xff1f;
+t7 = 0x10000018;
+t4 = t5 | 0x20;
+MEM_U8(s0 + 1) = (uint8_t)t2;
+MEM_U8(s0 + 1) = (uint8_t)t4;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L4083d8;
+t6 = MEM_U32(v0 + 16);
+t9 = MEM_U32(v0 + 20);
+t1 = MEM_U32(a1 + 8);
+t8 = t6 + s6;
+t0 = t8 + t9;
+t3 = t0 - t1;
+MEM_U32(s0 + 12) = t3;
+goto L4083e8;
+L4083d8:
+t2 = MEM_U32(v0 + 16);
+//nop;
+t5 = t2 + s6;
+MEM_U32(s0 + 12) = t5;
+L4083e8:
+t4 = MEM_U32(a1 + 8);
+MEM_U16(s0 + 2) = (uint16_t)zero;
+MEM_U32(s0 + 8) = t4;
+goto L40864c;
+L4083f8:
+v0 = 0x10004cb0;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 != 0) goto L40857c;
+t7 = MEM_U8(s0 + 0);
+at = 0x47;
+//nop;
+if (t7 != at) goto L408520;
+t6 = MEM_U8(s0 + 1);
+at = 0x4;
+t8 = t6 << 24;
+t9 = t8 >> 29;
+a0 = s0;
+if (t9 != at) goto L408520;
+//nop;
+a1 = MEM_U8(s1 + 0);
+a2 = MEM_U32(s1 + 20);
+a3 = sp + 0x68;
+v0 = f_has_readonly_init(mem, sp, a0, a1, a2, a3);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+//nop;
+if (v0 == 0) goto L408520;
+a0 = MEM_U32(s3 + 0);
+t0 = 0x67;
+t1 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)t0;
+t3 = t1 & 0xffe0;
+MEM_U8(a0 + 1) = (uint8_t)t3;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+v1 = 0x100030b0;
+//nop;
+t2 = MEM_U8(v1 + 1099);
+t5 = MEM_U8(v1 + 1403);
+a0 = MEM_U32(sp + 104);
+s0 = t2 - t5;
+t4 = s0 << 2;
+s0 = t4;
+v0 = f_ulen(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 104);
+//nop;
+a0 = MEM_U32(s3 + 0);
+a2 = v0 - s0;
+a1 = t7 + s0;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+a0 = MEM_U32(s3 + 0);
+// bdead c1fc0023 gp = MEM_U32(sp + 52);
+v1 = MEM_U8(a0 + 1);
+t6 = 0x49;
+MEM_U8(a0 + 0) = (uint8_t)t6;
+t8 = MEM_U8(s1 + 0);
+t9 = v1 << 27;
+t0 = t9 >> 27;
+t1 = t8 ^ t0;
+t3 = t1 & 0x1f;
+t2 = t3 ^ v1;
+MEM_U8(a0 + 1) = (uint8_t)t2;
+t5 = MEM_U32(s1 + 20);
+//nop;
+MEM_U32(a0 + 8) = t5;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+goto L4085f0;
+L408520:
+a0 = MEM_U32(s3 + 0);
+t4 = 0x36;
+v1 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)t4;
+t7 = MEM_U8(s1 + 0);
+t6 = v1 << 27;
+t9 = t6 >> 27;
+t8 = t7 ^ t9;
+t0 = t8 & 0x1f;
+t1 = t0 ^ v1;
+MEM_U8(a0 + 1) = (uint8_t)t1;
+MEM_U32(a0 + 4) = zero;
+t3 = MEM_U32(s1 + 20);
+MEM_U16(a0 + 2) = (uint16_t)zero;
+MEM_U32(a0 + 12) = zero;
+MEM_U32(a0 + 8) = t3;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+goto L4085f0;
+L40857c:
+a0 = MEM_U32(s3 + 0);
+t2 = 0x52;
+v1 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)t2;
+t5 = MEM_U8(v0 + 0);
+t4 = v1 << 27;
+t6 = t4 >> 27;
+t7 = t5 ^ t6;
+t9 = t7 & 0x1f;
+t0 = t9 ^ v1;
+t1 = t0 & 0xff1f;
+t3 = t1 | 0x40;
+MEM_U8(a0 + 1) = (uint8_t)t0;
+MEM_U8(a0 + 1) = (uint8_t)t3;
+t2 = MEM_U32(s5 + 8);
+at = 0x10004cb0;
+MEM_U32(a0 + 4) = t2;
+t4 = MEM_U32(v0 + 16);
+//nop;
+MEM_U32(a0 + 12) = t4;
+t5 = MEM_U32(v0 + 20);
+MEM_U16(a0 + 2) = (uint16_t)zero;
+MEM_U32(a0 + 8) = t5;
+//nop;
+MEM_U32(at + 0) = zero;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+L4085f0:
+s0 = MEM_U32(s3 + 0);
+//nop;
+MEM_U8(s0 + 0) = (uint8_t)fp;
+t6 = MEM_U32(s5 + 8);
+v1 = MEM_U8(s0 + 1);
+MEM_U32(s0 + 4) = t6;
+t7 = MEM_U8(s1 + 0);
+t9 = v1 << 27;
+t8 = t9 >> 27;
+t0 = t7 ^ t8;
+t1 = t0 & 0x1f;
+t2 = t1 ^ v1;
+t4 = t2 & 0xff1f;
+t5 = t4 | 0x20;
+MEM_U8(s0 + 1) = (uint8_t)t2;
+MEM_U8(s0 + 1) = (uint8_t)t5;
+t6 = MEM_U32(s1 + 16);
+//nop;
+t9 = t6 + s6;
+MEM_U32(s0 + 12) = t9;
+t7 = MEM_U32(s1 + 20);
+MEM_U16(s0 + 2) = (uint16_t)zero;
+MEM_U32(s0 + 8) = t7;
+L40864c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+MEM_U32(at + 0) = v0;
+goto L4089ec;
+at = 0x66;
+L40868c:
+t9 = MEM_U32(sp + 168);
+if (v1 != at) goto L40898c;
+//nop;
+a0 = s2;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+t8 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s7 + 52);
+a0 = MEM_U32(t8 + 12);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+s1 = v0;
+if (v0 != 0) goto L40887c;
+a1 = MEM_U32(s2 + 0);
+t0 = MEM_U32(s7 + 48);
+t1 = MEM_U32(a1 + 12);
+t3 = MEM_U32(a1 + 8);
+a2 = 0x28;
+t2 = t1 + t3;
+a3 = 0x28;
+if ((int)t0 < (int)t2) goto L408718;
+t4 = MEM_U8(s7 + 126);
+//nop;
+//nop;
+if (t4 == 0) goto L4087b4;
+L408718:
+a1 = 0x10001382;
+//nop;
+a0 = MEM_U32(s4 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s7 + 16);
+//nop;
+a0 = s4;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+a1 = 0x10001378;
+//nop;
+a2 = 0xa;
+a3 = 0xa;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1f80183 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+s0 = MEM_U32(s3 + 0);
+t6 = MEM_U32(s2 + 0);
+v1 = MEM_U8(s0 + 1);
+t5 = 0x67;
+MEM_U8(s0 + 0) = (uint8_t)t5;
+t7 = MEM_U8(t6 + 1);
+t8 = v1 << 27;
+t1 = t8 >> 27;
+t3 = t7 ^ t1;
+t0 = t3 & 0x1f;
+// bdead c1fa0213 gp = MEM_U32(sp + 52);
+t2 = t0 ^ v1;
+MEM_U8(s0 + 1) = (uint8_t)t2;
+goto L40894c;
+L4087b4:
+a0 = MEM_U32(s3 + 0);
+t4 = 0x47;
+MEM_U8(a0 + 0) = (uint8_t)t4;
+t5 = MEM_U32(s5 + 8);
+t3 = MEM_U8(a0 + 1);
+MEM_U32(a0 + 4) = t5;
+t6 = MEM_U32(a1 + 12);
+t0 = t3 & 0xff1f;
+t9 = t6 + s6;
+MEM_U32(a0 + 12) = t9;
+t8 = MEM_U32(a1 + 12);
+t2 = t0 | 0x20;
+t7 = t8 + s6;
+MEM_U32(a0 + 16) = t7;
+t1 = MEM_U32(a1 + 8);
+MEM_U8(a0 + 1) = (uint8_t)t2;
+MEM_U32(a0 + 8) = t1;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+t5 = MEM_U8(v0 + 1);
+t4 = 0x7e;
+t6 = t5 & 0xffe0;
+MEM_U8(v0 + 0) = (uint8_t)t4;
+MEM_U8(v0 + 1) = (uint8_t)t6;
+MEM_U8(v0 + 8) = (uint8_t)zero;
+//nop;
+a0 = v0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s3 + 0) = v0;
+t8 = MEM_U8(v0 + 1);
+// bdead c3f8000b gp = MEM_U32(sp + 52);
+t7 = t8 & 0xffe0;
+t9 = 0x58;
+t1 = t7 | 0x9;
+MEM_U8(v0 + 0) = (uint8_t)t9;
+MEM_U8(v0 + 1) = (uint8_t)t1;
+a1 = MEM_U32(s2 + 0);
+t0 = 0x20;
+t3 = MEM_U32(a1 + 8);
+MEM_U16(v0 + 2) = (uint16_t)t0;
+MEM_U32(v0 + 8) = t3;
+t2 = MEM_U16(a1 + 2);
+s0 = v0;
+MEM_U32(v0 + 4) = t2;
+goto L40894c;
+L40887c:
+a0 = MEM_U32(s3 + 0);
+t4 = 0x47;
+MEM_U8(a0 + 0) = (uint8_t)t4;
+t5 = MEM_U32(s5 + 8);
+t4 = MEM_U8(a0 + 1);
+MEM_U32(a0 + 4) = t5;
+a1 = MEM_U32(s2 + 0);
+t9 = MEM_U32(s1 + 16);
+t6 = MEM_U32(a1 + 12);
+t7 = MEM_U32(s1 + 4);
+t8 = t6 + t9;
+t1 = t8 - t7;
+t3 = t1 + s6;
+MEM_U32(a0 + 12) = t3;
+MEM_U32(a0 + 16) = t3;
+t2 = MEM_U32(a1 + 8);
+t5 = t4 & 0xff1f;
+t6 = t5 | 0x20;
+MEM_U8(a0 + 1) = (uint8_t)t6;
+MEM_U32(a0 + 8) = t2;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+t8 = MEM_U8(v0 + 1);
+t9 = 0x7e;
+t7 = t8 & 0xffe0;
+MEM_U8(v0 + 0) = (uint8_t)t9;
+MEM_U8(v0 + 1) = (uint8_t)t7;
+MEM_U8(v0 + 8) = (uint8_t)zero;
+//nop;
+a0 = v0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s3 + 0) = v0;
+t3 = MEM_U8(v0 + 1);
+// bdead c1f8100b gp = MEM_U32(sp + 52);
+t0 = t3 & 0xffe0;
+t1 = 0x58;
+t2 = t0 | 0x9;
+MEM_U8(v0 + 0) = (uint8_t)t1;
+MEM_U8(v0 + 1) = (uint8_t)t2;
+a1 = MEM_U32(s2 + 0);
+t5 = 0x20;
+t4 = MEM_U32(a1 + 8);
+MEM_U16(v0 + 2) = (uint16_t)t5;
+MEM_U32(v0 + 8) = t4;
+t6 = MEM_U16(a1 + 2);
+s0 = v0;
+MEM_U32(v0 + 4) = t6;
+L40894c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+MEM_U32(at + 0) = v0;
+goto L4089ec;
+// fdead 0 t9 = MEM_U32(sp + 168);
+L40898c:
+t8 = MEM_U32(sp + 172);
+//nop;
+//nop;
+if (t9 >= t8) goto L4089d4;
+//nop;
+if (fp != v1) goto L4089d4;
+t7 = MEM_U8(a1 + 1);
+at = 0x3;
+t1 = t7 << 24;
+t3 = t1 >> 29;
+//nop;
+if (t3 != at) goto L4089d4;
+t0 = MEM_U32(a1 + 12);
+at = 0x2;
+t2 = 0x1;
+if (t0 != at) goto L4089d4;
+MEM_U8(sp + 127) = (uint8_t)t2;
+L4089d4:
+//nop;
+a0 = s5;
+//nop;
+f_one_instruction(mem, sp, a0);
+// bdead c1f80003 gp = MEM_U32(sp + 52);
+//nop;
+L4089ec:
+a0 = MEM_U32(s2 + 0);
+//nop;
+s0 = a0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+t4 = MEM_U32(sp + 160);
+// bdead c1fa200b gp = MEM_U32(sp + 52);
+MEM_U32(s2 + 0) = v0;
+a1 = v0;
+if (t4 != v0) goto L4081c4;
+MEM_U32(sp + 108) = s0;
+L408a18:
+//nop;
+s3 = 0x10003c5c;
+fp = 0x7b;
+a0 = a1;
+f_copy_to(mem, sp, a0);
+t5 = MEM_U32(s7 + 20);
+// bdead c1d84003 gp = MEM_U32(sp + 52);
+MEM_U32(s2 + 0) = t5;
+v1 = MEM_U8(t5 + 0);
+at = 0x51;
+a1 = t5;
+if (v1 != at) goto L408a68;
+//nop;
+a0 = a1;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s2 + 0) = v0;
+v1 = MEM_U8(v0 + 0);
+// bdead c1d8001b gp = MEM_U32(sp + 52);
+a1 = v0;
+L408a68:
+t6 = 0x21;
+//nop;
+if (v1 == t6) goto L408a78;
+abort();
+L408a78:
+//nop;
+a0 = a1;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1d8000b gp = MEM_U32(sp + 52);
+MEM_U32(s2 + 0) = v0;
+at = 0x10003c60;
+t7 = 0x10003c78;
+MEM_U32(at + 0) = v0;
+t8 = MEM_U32(s7 + 108);
+t7 = MEM_U32(t7 + 0);
+//nop;
+a1 = 0x200;
+if (t8 == t7) goto L408b60;
+t1 = 0x10000044;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+a1 = 0x200;
+if (t1 == 0) goto L408b60;
+//nop;
+a0 = s2;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+s0 = MEM_U32(s3 + 0);
+// bdead c1da0003 gp = MEM_U32(sp + 52);
+t3 = 0x63;
+MEM_U8(s0 + 0) = (uint8_t)t3;
+MEM_U32(s0 + 4) = zero;
+t0 = MEM_U32(s7 + 104);
+//nop;
+a0 = s0;
+MEM_U32(s0 + 8) = t0;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1d8010b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s7 + 108);
+v1 = 0x10003c78;
+MEM_U32(s3 + 0) = v0;
+MEM_U32(v1 + 0) = a0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_str_idn(mem, sp, a0);
+// bdead c1d8000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = v0;
+//nop;
+f_put_comm(mem, sp, a0, a1);
+// bdead c1d80003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1d8000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+a1 = 0x200;
+L408b60:
+a2 = a1 & 0x3;
+v1 = zero;
+if (a2 == 0) goto L408b94;
+t5 = 0x10004cc0;
+t4 = v1 << 2;
+a0 = a2;
+v0 = t4 + t5;
+L408b7c:
+v1 = v1 + 0x1;
+MEM_U32(v0 + 0) = zero;
+v0 = v0 + 0x4;
+if (a0 != v1) goto L408b7c;
+//nop;
+if (v1 == a1) goto L408bc0;
+L408b94:
+t9 = 0x10004cc0;
+t6 = v1 << 2;
+t8 = a1 << 2;
+a0 = t8 + t9;
+v0 = t6 + t9;
+L408ba8:
+v0 = v0 + 0x10;
+MEM_U32(v0 + -16) = zero;
+MEM_U32(v0 + -12) = zero;
+MEM_U32(v0 + -8) = zero;
+MEM_U32(v0 + -4) = zero;
+if (v0 != a0) goto L408ba8;
+L408bc0:
+a0 = 0x100054c0;
+//nop;
+MEM_U32(a0 + 0) = zero;
+//nop;
+//nop;
+//nop;
+v0 = f_alloc_mark(mem, sp, a0);
+// bdead c1d8000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 112) = v0;
+v1 = 0x10003c44;
+MEM_U32(sp + 136) = zero;
+t7 = MEM_U32(v1 + 0);
+s4 = 0x2;
+t1 = t7 + 0x1;
+MEM_U32(sp + 144) = t1;
+s1 = 0x1;
+MEM_U32(v1 + 0) = t1;
+L408c04:
+a1 = MEM_U32(s2 + 0);
+//nop;
+v1 = MEM_U8(a1 + 0);
+v0 = v1;
+goto L4090e0;
+L408c18:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_modify(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(v0 + 4);
+//nop;
+s0 = v0;
+//nop;
+v0 = f_map_lab(mem, sp, a0);
+a1 = MEM_U32(s2 + 0);
+MEM_U32(s0 + 4) = v0;
+t0 = MEM_U8(a1 + 0);
+// bdead c1fe0243 gp = MEM_U32(sp + 52);
+at = 0x42;
+//nop;
+if (t0 != at) goto L409224;
+MEM_U32(s0 + 8) = zero;
+goto L409224;
+L408c64:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_modify(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(v0 + 4);
+//nop;
+s0 = v0;
+//nop;
+v0 = f_map_lab(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s0 + 8);
+//nop;
+MEM_U32(s0 + 4) = v0;
+//nop;
+v0 = f_map_lab(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s2 + 0);
+MEM_U32(s0 + 8) = v0;
+goto L409224;
+L408cb4:
+t2 = MEM_U32(s5 + 8);
+t4 = MEM_U32(a1 + 4);
+//nop;
+//nop;
+if (t2 != t4) goto L409224;
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+v0 = f_modify(mem, sp, a0);
+t5 = MEM_U8(v0 + 0);
+// bdead c1fc400b gp = MEM_U32(sp + 52);
+at = 0x3d;
+t8 = 0x47;
+if (t5 != at) goto L408d18;
+t6 = 0x52;
+MEM_U8(v0 + 0) = (uint8_t)t6;
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L408d18:
+MEM_U8(v0 + 0) = (uint8_t)t8;
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L408d28:
+t9 = MEM_U32(s5 + 8);
+t7 = MEM_U32(a1 + 4);
+//nop;
+//nop;
+if (t9 != t7) goto L409224;
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+v0 = f_modify(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U8(v0 + 0) = (uint8_t)fp;
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L408d78:
+at = 0x52;
+L408d7c:
+//nop;
+if (v1 != at) goto L408e68;
+t1 = MEM_U8(sp + 127);
+//nop;
+//nop;
+if (t1 != s4) goto L408e68;
+t3 = MEM_U8(a1 + 1);
+t4 = MEM_U32(sp + 120);
+t0 = t3 << 24;
+t2 = t0 >> 29;
+//nop;
+if (s1 != t2) goto L408e68;
+t5 = MEM_U32(a1 + 12);
+//nop;
+//nop;
+if (t4 != t5) goto L408e68;
+//nop;
+a0 = a1;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+v1 = MEM_U8(v0 + 0);
+// bdead c1fc0013 gp = MEM_U32(sp + 52);
+at = 0x64;
+if (fp == v1) goto L408e20;
+//nop;
+if (v1 == at) goto L408e20;
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+MEM_U32(at + 0) = v0;
+goto L408e5c;
+L408e20:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_modify(mem, sp, a0);
+t9 = MEM_U8(v0 + 1);
+t6 = MEM_U32(v0 + 12);
+// bdead c5fc800b gp = MEM_U32(sp + 52);
+t7 = t9 & 0xff1f;
+t1 = t7 | 0x20;
+t8 = t6 + s6;
+MEM_U32(v0 + 12) = t8;
+MEM_U8(v0 + 1) = (uint8_t)t1;
+t3 = MEM_U32(s5 + 8);
+//nop;
+MEM_U32(v0 + 4) = t3;
+L408e5c:
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L408e68:
+v0 = MEM_U8(a1 + 1);
+//nop;
+t0 = v0 << 24;
+t2 = t0 >> 29;
+v0 = t2;
+if (s1 == t2) goto L408e88;
+at = 0x52;
+if (s4 != t2) goto L408f34;
+L408e88:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_modify(mem, sp, a0);
+t4 = MEM_U8(v0 + 0);
+// bdead c1fc200b gp = MEM_U32(sp + 52);
+at = 0x8b;
+//nop;
+if (t4 != at) goto L408ee0;
+t5 = MEM_U8(v0 + 1);
+//nop;
+t6 = t5 << 24;
+t8 = t6 >> 29;
+//nop;
+if (s4 != t8) goto L408ee0;
+t9 = MEM_U32(v0 + 8);
+//nop;
+//nop;
+if ((int)t9 >= (int)0x4) goto L408edc;
+t9 = 0x4;
+L408edc:
+MEM_U32(v0 + 8) = t9;
+L408ee0:
+t3 = MEM_U8(v0 + 1);
+t7 = MEM_U32(v0 + 12);
+t0 = t3 & 0xff1f;
+t2 = t0 | 0x20;
+t1 = t7 + s6;
+MEM_U32(v0 + 12) = t1;
+MEM_U8(v0 + 1) = (uint8_t)t2;
+t4 = MEM_U32(s5 + 8);
+at = 0x47;
+MEM_U32(v0 + 4) = t4;
+a1 = MEM_U32(s2 + 0);
+//nop;
+t5 = MEM_U8(a1 + 0);
+//nop;
+//nop;
+if (t5 != at) goto L409224;
+t6 = MEM_U32(v0 + 16);
+//nop;
+t8 = t6 + s6;
+MEM_U32(v0 + 16) = t8;
+goto L409224;
+L408f34:
+if (v1 != at) {
+at = 0x3;
+goto L409224;}
+at = 0x3;
+//nop;
+if (v0 != at) goto L409224;
+t9 = MEM_U32(a1 + 12);
+at = 0x2;
+//nop;
+if (t9 != at) goto L409224;
+t7 = MEM_U8(sp + 127);
+a0 = a1;
+//nop;
+if (t7 != s1) goto L409224;
+//nop;
+t1 = 0x2;
+MEM_U8(sp + 127) = (uint8_t)t1;
+v0 = f_next_u(mem, sp, a0);
+t3 = MEM_U8(v0 + 0);
+// bdead c1fc100b gp = MEM_U32(sp + 52);
+//nop;
+if (fp == t3) goto L408f88;
+abort();
+L408f88:
+t0 = MEM_U32(v0 + 12);
+a1 = MEM_U32(s2 + 0);
+MEM_U32(sp + 120) = t0;
+goto L409224;
+L408f98:
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+t2 = 0x10003c60;
+MEM_U32(at + 0) = v0;
+t2 = MEM_U32(t2 + 0);
+at = 0x1b;
+v1 = MEM_U8(t2 + 0);
+//nop;
+if (v1 == at) {
+at = 0x1f;
+goto L409034;}
+at = 0x1f;
+//nop;
+if (v1 == at) goto L409034;
+t4 = MEM_U32(sp + 144);
+//nop;
+a0 = s2;
+MEM_U32(sp + 136) = t4;
+f_check_for_more_space(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+s0 = MEM_U32(s3 + 0);
+t6 = MEM_U32(sp + 144);
+//nop;
+t5 = 0x88;
+MEM_U8(s0 + 0) = (uint8_t)t5;
+a0 = s0;
+MEM_U32(s0 + 4) = t6;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+L409034:
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L409040:
+t8 = MEM_U32(s7 + 88);
+//nop;
+//nop;
+if (s1 == t8) goto L409224;
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+//nop;
+MEM_U32(at + 0) = v0;
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L409098:
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+// bdead c1fc0003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s2 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+//nop;
+at = 0x10003c60;
+//nop;
+MEM_U32(at + 0) = v0;
+a1 = MEM_U32(s2 + 0);
+//nop;
+goto L409224;
+L4090e0:
+if (v0 < 0x54) {
+at = v0 < 0x7c;
+goto L40916c;}
+if (v0 < 0x7c) {
+at = 0x7f;
+goto L409128;}
+at = 0x7f;
+t9 = v0 + 0xffffff78;
+if (v0 == at) goto L408c18;
+//nop;
+if (t9 >= 0x5) goto L409224;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L408c18;
+case 1: goto L409224;
+case 2: goto L409224;
+case 3: goto L408d78;
+case 4: goto L408c64;
+}
+L409128:
+at = 0x65;
+//nop;
+if (v0 == at) goto L409098;
+t7 = v0 + 0xffffff96;
+if (v0 >= 0x72) goto L40921c;
+//nop;
+if (t7 >= 0x8) goto L409224;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L408f98;
+case 1: goto L409224;
+case 2: goto L409224;
+case 3: goto L408d78;
+case 4: goto L409224;
+case 5: goto L409224;
+case 6: goto L408d78;
+case 7: goto L409098;
+}
+L40916c:
+if (v0 < 0x16) {
+at = v0 < 0x2c;
+goto L4091b8;}
+t0 = v0 + 0xffffffe5;
+if (v0 < 0x2c) goto L4091f0;
+at = 0x32;
+t1 = v0 + 0xffffffc7;
+if (v0 == at) goto L408cb4;
+//nop;
+if (t1 >= 0x1b) goto L409224;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L409098;
+case 1: goto L409224;
+case 2: goto L409224;
+case 3: goto L409224;
+case 4: goto L408cb4;
+case 5: goto L408d28;
+case 6: goto L409224;
+case 7: goto L409224;
+case 8: goto L409224;
+case 9: goto L408c18;
+case 10: goto L409224;
+case 11: goto L409224;
+case 12: goto L409224;
+case 13: goto L409224;
+case 14: goto L408d78;
+case 15: goto L409224;
+case 16: goto L409224;
+case 17: goto L408c18;
+case 18: goto L409224;
+case 19: goto L409224;
+case 20: goto L409224;
+case 21: goto L409224;
+case 22: goto L409098;
+case 23: goto L409224;
+case 24: goto L409040;
+case 25: goto L408d78;
+case 26: goto L409098;
+}
+L4091b8:
+at = 0x6;
+t3 = v0 + 0xffffffef;
+if (v0 == at) goto L409098;
+//nop;
+if (t3 >= 0x5) goto L409224;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L408c18;
+case 1: goto L409224;
+case 2: goto L409224;
+case 3: goto L409098;
+case 4: goto L408d78;
+}
+L4091f0:
+//nop;
+if (t0 >= 0x11) goto L409224;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t0) {
+case 0: goto L409098;
+case 1: goto L409224;
+case 2: goto L409224;
+case 3: goto L409224;
+case 4: goto L409240;
+case 5: goto L409224;
+case 6: goto L409224;
+case 7: goto L409224;
+case 8: goto L409224;
+case 9: goto L409098;
+case 10: goto L409224;
+case 11: goto L408c18;
+case 12: goto L409098;
+case 13: goto L409224;
+case 14: goto L409224;
+case 15: goto L409098;
+case 16: goto L409098;
+}
+L40921c:
+at = 0x52;
+if (v0 == fp) goto L408d7c;
+L409224:
+//nop;
+a0 = a1;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 52);
+MEM_U32(s2 + 0) = v0;
+goto L408c04;
+L409240:
+//nop;
+a0 = s2;
+//nop;
+f_inline_copy_to(mem, sp, a0);
+t2 = MEM_U32(sp + 136);
+// bdead 40580803 gp = MEM_U32(sp + 52);
+//nop;
+if (t2 == 0) goto L4092a8;
+//nop;
+a0 = s2;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s3 + 0);
+// bdead 40580023 gp = MEM_U32(sp + 52);
+t4 = 0x42;
+MEM_U8(a0 + 0) = (uint8_t)t4;
+t5 = MEM_U32(sp + 136);
+MEM_U16(a0 + 2) = (uint16_t)zero;
+MEM_U32(a0 + 8) = zero;
+MEM_U32(a0 + 4) = t5;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 4058000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+L4092a8:
+t8 = 0x10003c78;
+t6 = MEM_U32(s5 + 108);
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t6 == t8) goto L409378;
+t9 = 0x10000044;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L409378;
+//nop;
+a0 = s2;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s3 + 0);
+// bdead 40500023 gp = MEM_U32(sp + 52);
+t7 = 0x63;
+MEM_U8(a0 + 0) = (uint8_t)t7;
+MEM_U32(a0 + 4) = zero;
+t1 = MEM_U32(s5 + 104);
+//nop;
+MEM_U32(a0 + 8) = t1;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 40500109 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(s5 + 108);
+at = 0x10003c78;
+MEM_U32(s3 + 0) = v0;
+a0 = 0x10003c78;
+//nop;
+MEM_U32(at + 0) = t3;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_st_str_idn(mem, sp, a0);
+// bdead 40100009 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = v0;
+//nop;
+f_put_comm(mem, sp, a0, a1);
+// bdead 40100001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 40100009 gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+L409378:
+//nop;
+a0 = 0x100054c0;
+a1 = MEM_U32(sp + 112);
+//nop;
+f_alloc_release(mem, sp, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 gp = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x98;
+return;
+}
+
+static void f_gen_pdefs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+L4093c0:
+//gen_pdefs:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s0 = a0;
+s2 = a1;
+// fdead 400a006b MEM_U32(sp + 52) = ra;
+// fdead 400a006b MEM_U32(sp + 48) = gp;
+// fdead 400a006b MEM_U32(sp + 44) = s5;
+// fdead 400a006b MEM_U32(sp + 40) = s4;
+// fdead 400a006b MEM_U32(sp + 36) = s3;
+// fdead 400a006b MEM_U32(sp + 28) = s1;
+if (a0 == 0) goto L40948c;
+s3 = 0x10000060;
+s1 = 0x10003c5c;
+s5 = 0xffffff1f;
+s4 = 0x65;
+L40940c:
+//nop;
+a0 = s3;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s1 + 0);
+// bdead 407e0021 gp = MEM_U32(sp + 48);
+v0 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)s4;
+t6 = MEM_U8(s0 + 0);
+t7 = v0 << 27;
+t8 = t7 >> 27;
+t9 = t6 ^ t8;
+t0 = t9 & 0x1f;
+t2 = t0 ^ v0;
+t3 = t2 & s5;
+t4 = t3 | 0x40;
+MEM_U8(a0 + 1) = (uint8_t)t2;
+MEM_U8(a0 + 1) = (uint8_t)t4;
+MEM_U32(a0 + 4) = s2;
+t5 = MEM_U32(s0 + 16);
+//nop;
+MEM_U32(a0 + 12) = t5;
+t7 = MEM_U32(s0 + 20);
+//nop;
+MEM_U32(a0 + 8) = t7;
+t6 = MEM_U8(s0 + 24);
+MEM_U16(a0 + 2) = (uint16_t)t6;
+v0 = f_next_u(mem, sp, a0);
+s0 = MEM_U32(s0 + 12);
+// bdead 407e0009 gp = MEM_U32(sp + 48);
+MEM_U32(s1 + 0) = v0;
+if (s0 != 0) goto L40940c;
+L40948c:
+// bdead 1 ra = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static void f_gen_stores_from_fsym_init(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L4094b0:
+//gen_stores_from_fsym_init:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+v0 = 0x100030b0;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+t6 = MEM_U8(v0 + 1099);
+t7 = MEM_U8(v0 + 1403);
+// fdead 4001802b MEM_U32(sp + 40) = s5;
+// fdead 4001802b MEM_U32(sp + 32) = s3;
+s4 = t6 - t7;
+// fdead 4021802b MEM_U32(sp + 56) = fp;
+// fdead 4021802b MEM_U32(sp + 48) = s7;
+// fdead 4021802b MEM_U32(sp + 44) = s6;
+// fdead 4021802b MEM_U32(sp + 24) = s1;
+t8 = s4 << 2;
+s3 = 0x10003c5c;
+s5 = 0x10000060;
+s1 = a0;
+// fdead 4275802b MEM_U32(sp + 60) = ra;
+// fdead 4275802b MEM_U32(sp + 52) = gp;
+// fdead 4275802b MEM_U32(sp + 28) = s2;
+// fdead 4275802b MEM_U32(sp + 20) = s0;
+s4 = t8;
+s6 = 0x49;
+s7 = 0x7b;
+fp = 0xffffff1f;
+L40951c:
+//nop;
+a0 = s5;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+// bdead c1f40003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_ulen(mem, sp, a0);
+t9 = MEM_U32(s1 + 0);
+// bdead c5f4000b gp = MEM_U32(sp + 52);
+a1 = t9 + s4;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a2 = v0 - s4;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+a0 = MEM_U32(s3 + 0);
+// bdead c1f40023 gp = MEM_U32(sp + 52);
+MEM_U8(a0 + 0) = (uint8_t)s6;
+t0 = MEM_U32(s1 + 0);
+s2 = MEM_U8(a0 + 1);
+t2 = MEM_U8(t0 + 1);
+t3 = s2 << 27;
+t4 = t3 >> 27;
+t5 = t2 ^ t4;
+t6 = t5 & 0x1f;
+t7 = t6 ^ s2;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+t8 = MEM_U32(s1 + 0);
+//nop;
+t9 = MEM_U32(t8 + 8);
+//nop;
+MEM_U32(a0 + 8) = t9;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f4000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+MEM_U8(v0 + 0) = (uint8_t)s7;
+t0 = MEM_U32(s1 + 0);
+s2 = MEM_U8(v0 + 1);
+t3 = MEM_U8(t0 + 1);
+t2 = s2 << 27;
+t4 = t2 >> 27;
+t5 = t3 ^ t4;
+t6 = t5 & 0x1f;
+t8 = t6 ^ s2;
+t9 = t8 & fp;
+MEM_U8(v0 + 1) = (uint8_t)t8;
+t0 = t9 | 0x80;
+MEM_U8(v0 + 1) = (uint8_t)t0;
+t1 = MEM_U32(s1 + 0);
+a0 = v0;
+t2 = MEM_U32(t1 + 4);
+//nop;
+MEM_U32(v0 + 4) = t2;
+t3 = MEM_U32(s1 + 0);
+//nop;
+t4 = MEM_U32(t3 + 8);
+//nop;
+MEM_U32(v0 + 8) = t4;
+t5 = MEM_U32(s1 + 0);
+//nop;
+t6 = MEM_U32(t5 + 12);
+MEM_U16(v0 + 2) = (uint16_t)zero;
+MEM_U32(v0 + 12) = t6;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1f4000b gp = MEM_U32(sp + 52);
+MEM_U32(s3 + 0) = v0;
+//nop;
+a0 = MEM_U32(s1 + 0);
+//nop;
+v0 = f_change_to_nops(mem, sp, a0);
+s1 = MEM_U32(s1 + 4);
+// bdead c1f40003 gp = MEM_U32(sp + 52);
+//nop;
+if (s1 != 0) goto L40951c;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void f_inline_pass(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L409694:
+//inline_pass:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff68;
+v1 = 0x10000010;
+// fdead 4000001b MEM_U32(sp + 68) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000001b MEM_U32(sp + 64) = fp;
+// fdead 4000001b MEM_U32(sp + 60) = gp;
+// fdead 4000001b MEM_U32(sp + 56) = s7;
+// fdead 4000001b MEM_U32(sp + 52) = s6;
+// fdead 4000001b MEM_U32(sp + 48) = s5;
+// fdead 4000001b MEM_U32(sp + 44) = s4;
+// fdead 4000001b MEM_U32(sp + 40) = s3;
+// fdead 4000001b MEM_U32(sp + 36) = s2;
+// fdead 4000001b MEM_U32(sp + 32) = s1;
+// fdead 4000001b MEM_U32(sp + 28) = s0;
+if (v1 == 0) goto L409730;
+a0 = 0x10000b30;
+a1 = 0x100015d2;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0xc;
+a3 = 0xc;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 60);
+//nop;
+v1 = 0x10000010;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L409730:
+s5 = 0x10003c70;
+at = 0x10003c78;
+s5 = MEM_U32(s5 + 0);
+t6 = 0xffffffff;
+MEM_U32(at + 0) = t6;
+if (s5 == 0) goto L40a4c4;
+fp = MEM_U32(sp + 108);
+s7 = 0x10003c7c;
+s6 = 0x10003c5c;
+s4 = 0x10004cac;
+//nop;
+L40975c:
+v0 = 0x10003c60;
+t7 = MEM_U32(s5 + 20);
+//nop;
+MEM_U32(v0 + 0) = t7;
+if (t7 == 0) goto L40a4b0;
+MEM_U8(sp + 131) = (uint8_t)zero;
+MEM_U8(sp + 115) = (uint8_t)zero;
+if (v1 != 0) goto L409794;
+t9 = 0x10000014;
+//nop;
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if (t9 == 0) goto L4097f0;
+L409794:
+a0 = 0x10000b30;
+a1 = 0x100015d0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x2;
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+a0 = s5;
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead c1e00183 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+//nop;
+L4097f0:
+t1 = 0x10003c78;
+t0 = MEM_U32(s5 + 108);
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t0 == t1) goto L4098bc;
+t2 = 0x10000044;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L4098bc;
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s6 + 0);
+// bdead c1e00023 gp = MEM_U32(sp + 60);
+t3 = 0x63;
+MEM_U8(a0 + 0) = (uint8_t)t3;
+MEM_U32(a0 + 4) = zero;
+t4 = MEM_U32(s5 + 104);
+//nop;
+MEM_U32(a0 + 8) = t4;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0010b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s5 + 108);
+v1 = 0x10003c78;
+MEM_U32(s6 + 0) = v0;
+MEM_U32(v1 + 0) = a0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_str_idn(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s6 + 0);
+//nop;
+a1 = v0;
+//nop;
+f_put_comm(mem, sp, a0, a1);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s6 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+MEM_U32(s6 + 0) = v0;
+L4098bc:
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s6 + 0);
+// bdead c1e00023 gp = MEM_U32(sp + 60);
+t6 = 0x51;
+MEM_U8(a0 + 0) = (uint8_t)t6;
+t7 = MEM_U32(s5 + 12);
+//nop;
+MEM_U32(a0 + 4) = t7;
+t8 = MEM_U32(s5 + 12);
+t9 = MEM_U32(s5 + 108);
+MEM_U32(s7 + 0) = t8;
+MEM_U16(a0 + 2) = (uint16_t)t9;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+MEM_U32(s6 + 0) = v0;
+at = 0x10003c6c;
+t1 = 0x10003c60;
+MEM_U32(at + 0) = v0;
+at = 0x10004cb0;
+s0 = MEM_U32(t1 + 0);
+MEM_U32(at + 0) = zero;
+t2 = MEM_U8(s0 + 0);
+at = 0x21;
+MEM_U32(s4 + 0) = s0;
+if (t2 == at) goto L409960;
+s1 = 0x21;
+L40993c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s4 + 0) = v0;
+t3 = MEM_U8(v0 + 0);
+// bdead c1e4100b gp = MEM_U32(sp + 60);
+s0 = v0;
+if (s1 != t3) goto L40993c;
+L409960:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s4 + 0) = v0;
+t4 = MEM_U8(v0 + 0);
+// bdead c1e0200b gp = MEM_U32(sp + 60);
+at = 0x13;
+s0 = v0;
+if (t4 != at) goto L4099a4;
+//nop;
+a0 = v0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+MEM_U32(s4 + 0) = v0;
+s0 = v0;
+L4099a4:
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s5 + 52);
+//nop;
+a1 = MEM_U32(s5 + 8);
+//nop;
+f_gen_pdefs(mem, sp, a0, a1);
+a0 = MEM_U32(s5 + 112);
+// bdead c1e00023 gp = MEM_U32(sp + 60);
+//nop;
+if (a0 == 0) goto L4099f4;
+//nop;
+//nop;
+//nop;
+f_gen_stores_from_fsym_init(mem, sp, a0);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+//nop;
+L4099f4:
+s0 = MEM_U32(s4 + 0);
+//nop;
+v0 = MEM_U8(s0 + 0);
+at = v0 < 0x52;
+goto L40a334;
+L409a08:
+v0 = MEM_U8(s0 + 1);
+at = 0x2;
+t5 = v0 << 24;
+v0 = t5 >> 29;
+if (v0 != at) {
+at = 0x1;
+goto L409a30;}
+at = 0x1;
+t7 = MEM_U32(s5 + 48);
+MEM_U32(s0 + 8) = t7;
+goto L409a44;
+at = 0x1;
+L409a30:
+t9 = 0x1;
+if (v0 != at) goto L409a44;
+t8 = MEM_U32(s5 + 56);
+MEM_U8(sp + 131) = (uint8_t)t9;
+MEM_U32(s0 + 8) = t8;
+L409a44:
+//nop;
+fp = s0;
+a0 = s0;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+MEM_U32(s4 + 0) = v0;
+goto L4099f4;
+L409a60:
+t0 = MEM_U16(s0 + 2);
+at = 0x10003c78;
+//nop;
+MEM_U32(at + 0) = t0;
+t1 = MEM_U32(s0 + 4);
+MEM_U32(s7 + 0) = t1;
+goto L409a44;
+L409a7c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s4 + 0) = v0;
+v1 = MEM_U8(v0 + 0);
+// bdead 41e8001b gp = MEM_U32(sp + 60);
+t2 = v1 < 0x40;
+s0 = v0;
+if (t2 == 0) goto L409ac8;
+t5 = 0x1000006c;
+t3 = (int)v1 >> 5;
+t4 = t3 << 2;
+t5 = t5;
+t6 = t5 + t4;
+t7 = MEM_U32(t6 + 0);
+//nop;
+t8 = t7 << (v1 & 0x1f);
+t2 = (int)t8 < (int)0x0;
+L409ac8:
+//nop;
+if (t2 == 0) goto L409a7c;
+t0 = v1 < 0x40;
+t1 = (int)v1 >> 5;
+if (t0 == 0) goto L409afc;
+t5 = 0x10000064;
+t3 = t1 << 2;
+t5 = t5;
+t4 = t5 + t3;
+t6 = MEM_U32(t4 + 0);
+//nop;
+t7 = t6 << (v1 & 0x1f);
+t0 = (int)t7 < (int)0x0;
+L409afc:
+t9 = 0x7fff0000;
+if (t0 == 0) goto L409b18;
+t9 = t9 | 0xffff;
+MEM_U32(s4 + 0) = s2;
+MEM_U32(sp + 116) = zero;
+MEM_U32(s5 + 116) = t9;
+goto L409d78;
+L409b18:
+//nop;
+a0 = MEM_U32(s0 + 4);
+s3 = s0;
+v0 = f_find_procedure(mem, sp, a0);
+t2 = MEM_U32(v0 + 52);
+// bdead 41f8080b gp = MEM_U32(sp + 60);
+s1 = v0;
+MEM_U32(sp + 116) = t2;
+if (v0 == s5) goto L409d68;
+t1 = MEM_U32(v0 + 20);
+//nop;
+t5 = 0x7fff0000;
+if (t1 == 0) goto L409d6c;
+s0 = MEM_U32(s5 + 84);
+//nop;
+t5 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+if (v0 != t5) goto L409b78;
+t3 = MEM_U32(s7 + 0);
+t4 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if (t3 == t4) goto L409bb0;
+L409b78:
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L409b8c;
+abort();
+L409b8c:
+t6 = MEM_U32(s0 + 16);
+//nop;
+//nop;
+if (s1 != t6) goto L409b78;
+t7 = MEM_U32(s7 + 0);
+t8 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if (t7 != t8) goto L409b78;
+L409bb0:
+v1 = MEM_U8(v0 + 122);
+//nop;
+//nop;
+if (v1 != 0) goto L409bdc;
+t9 = 0x10000030;
+t0 = MEM_U32(v0 + 116);
+t9 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+if ((int)t0 < (int)t9) goto L409c20;
+L409bdc:
+t2 = 0x10000000;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L409c04;
+t1 = MEM_U8(s0 + 36);
+//nop;
+//nop;
+if (t1 != 0) goto L409c20;
+L409c04:
+t5 = MEM_U32(s3 + 12);
+t9 = 0x7fff0000;
+t3 = t5 & 0x40;
+t9 = t9 | 0xffff;
+if (t3 == 0) goto L409cd0;
+//nop;
+if (v1 != 0) goto L409cd0;
+L409c20:
+//nop;
+a0 = s2;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 41fe0003 gp = MEM_U32(sp + 60);
+t4 = MEM_U8(s0 + 37);
+t6 = MEM_U8(s0 + 38);
+//nop;
+a0 = s5;
+a1 = s2;
+a2 = s3;
+a3 = s1;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 20) = t6;
+f_inline_procedure(mem, sp, a0, a1, a2, a3);
+// bdead 41f40003 gp = MEM_U32(sp + 60);
+a0 = s3;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41f4000b gp = MEM_U32(sp + 60);
+t7 = 0x7fff0000;
+at = 0x10003c60;
+t7 = t7 | 0xffff;
+MEM_U32(at + 0) = v0;
+at = 0x10004cb4;
+MEM_U32(s4 + 0) = s3;
+MEM_U32(at + 0) = s1;
+v1 = MEM_U32(s1 + 116);
+at = 0x7fff0000;
+at = at | 0xffff;
+//nop;
+if (v1 != at) goto L409cb0;
+MEM_U32(s5 + 116) = t7;
+goto L409d78;
+L409cb0:
+t0 = MEM_U32(s5 + 116);
+t8 = v1 + 0x1;
+//nop;
+if ((int)t0 >= (int)t8) goto L409cc8;
+t0 = t8;
+L409cc8:
+MEM_U32(s5 + 116) = t0;
+goto L409d78;
+L409cd0:
+MEM_U32(s5 + 116) = t9;
+t2 = MEM_U32(s3 + 12);
+MEM_U32(s4 + 0) = s2;
+t1 = t2 & 0x40;
+a2 = 0x36;
+if (t1 == 0) goto L409d78;
+a0 = 0x10000b30;
+a1 = 0x1000159a;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x36;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41e40003 gp = MEM_U32(sp + 60);
+a1 = MEM_U32(s1 + 16);
+//nop;
+a0 = 0x10000b30;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+a2 = 0x28;
+a0 = 0x10000b30;
+a1 = 0x10001572;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x28;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41e00183 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s4 + 0);
+goto L409d7c;
+L409d68:
+t5 = 0x7fff0000;
+L409d6c:
+t5 = t5 | 0xffff;
+MEM_U32(s5 + 116) = t5;
+MEM_U32(s4 + 0) = s2;
+L409d78:
+s0 = MEM_U32(s4 + 0);
+L409d7c:
+//nop;
+goto L409a44;
+L409d84:
+at = 0x10004cb4;
+MEM_U32(at + 0) = zero;
+goto L409a44;
+L409d90:
+//nop;
+a0 = MEM_U32(s0 + 12);
+a1 = MEM_U32(sp + 116);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+s3 = MEM_U32(s4 + 0);
+v1 = 0x10000058;
+a0 = MEM_U32(s3 + 4);
+t3 = MEM_U32(v1 + 0);
+s2 = v0;
+t4 = t3 + 0x1;
+MEM_U32(v1 + 0) = t4;
+//nop;
+//nop;
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1f8000b gp = MEM_U32(sp + 60);
+s1 = v0;
+if (s2 == 0) goto L40a13c;
+t6 = MEM_U8(s2 + 25);
+//nop;
+//nop;
+if (t6 == 0) goto L40a12c;
+t7 = 0x10004cb0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L409f6c;
+//nop;
+a0 = MEM_U32(s4 + 0);
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1e80003 gp = MEM_U32(sp + 60);
+//nop;
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+t8 = MEM_U8(fp + 0);
+// bdead c3e80003 gp = MEM_U32(sp + 60);
+at = 0x47;
+//nop;
+if (t8 != at) goto L409f28;
+t0 = MEM_U8(fp + 1);
+at = 0x4;
+t9 = t0 << 24;
+t2 = t9 >> 29;
+a0 = fp;
+if (t2 != at) goto L409f28;
+//nop;
+a1 = MEM_U8(s2 + 0);
+a2 = MEM_U32(s2 + 20);
+a3 = sp + 0x68;
+v0 = f_has_readonly_init(mem, sp, a0, a1, a2, a3);
+// bdead 41e8000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L409f28;
+a0 = MEM_U32(s6 + 0);
+t1 = 0x67;
+t5 = MEM_U8(a0 + 1);
+MEM_U8(a0 + 0) = (uint8_t)t1;
+t3 = t5 & 0xffe0;
+MEM_U8(a0 + 1) = (uint8_t)t3;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41e8000b gp = MEM_U32(sp + 60);
+MEM_U32(s6 + 0) = v0;
+v1 = 0x100030b0;
+s1 = MEM_U32(sp + 104);
+t4 = MEM_U8(v1 + 1099);
+t6 = MEM_U8(v1 + 1403);
+//nop;
+s0 = t4 - t6;
+t7 = s0 << 2;
+s0 = t7;
+a0 = s1;
+v0 = f_ulen(mem, sp, a0);
+// bdead 41ee000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s6 + 0);
+//nop;
+a1 = s1 + s0;
+a2 = v0 - s0;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+s0 = MEM_U32(s6 + 0);
+t8 = 0x49;
+v1 = MEM_U8(s0 + 1);
+MEM_U8(s0 + 0) = (uint8_t)t8;
+t0 = MEM_U8(s2 + 0);
+t9 = v1 << 27;
+t2 = t9 >> 27;
+t1 = t0 ^ t2;
+t5 = t1 & 0x1f;
+t3 = t5 ^ v1;
+MEM_U8(s0 + 1) = (uint8_t)t3;
+t4 = MEM_U32(s2 + 20);
+// bdead 41ea2003 gp = MEM_U32(sp + 60);
+MEM_U32(s0 + 8) = t4;
+goto L40a0d0;
+L409f28:
+s0 = MEM_U32(s6 + 0);
+t6 = 0x36;
+v1 = MEM_U8(s0 + 1);
+MEM_U8(s0 + 0) = (uint8_t)t6;
+t7 = MEM_U8(s2 + 0);
+t8 = v1 << 27;
+t9 = t8 >> 27;
+t0 = t7 ^ t9;
+t2 = t0 & 0x1f;
+t1 = t2 ^ v1;
+MEM_U8(s0 + 1) = (uint8_t)t1;
+MEM_U32(s0 + 4) = zero;
+t5 = MEM_U32(s2 + 20);
+MEM_U16(s0 + 2) = (uint16_t)zero;
+MEM_U32(s0 + 12) = zero;
+MEM_U32(s0 + 8) = t5;
+goto L40a0d0;
+L409f6c:
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+// bdead 41e80003 gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s6 + 0);
+v0 = 0x10004cb0;
+t3 = 0x52;
+MEM_U8(s0 + 0) = (uint8_t)t3;
+v1 = MEM_U8(s0 + 1);
+v0 = MEM_U32(v0 + 0);
+t6 = v1 << 27;
+t4 = MEM_U8(v0 + 0);
+t8 = t6 >> 27;
+t7 = t4 ^ t8;
+t9 = t7 & 0x1f;
+t2 = t9 ^ v1;
+t1 = t2 & 0xff1f;
+t5 = t1 | 0x40;
+MEM_U8(s0 + 1) = (uint8_t)t2;
+MEM_U8(s0 + 1) = (uint8_t)t5;
+t3 = MEM_U32(s5 + 8);
+//nop;
+MEM_U32(s0 + 4) = t3;
+t6 = MEM_U32(v0 + 16);
+//nop;
+MEM_U32(s0 + 12) = t6;
+t4 = MEM_U32(v0 + 20);
+MEM_U16(s0 + 2) = (uint16_t)zero;
+MEM_U32(s0 + 8) = t4;
+t8 = MEM_U32(s2 + 20);
+t7 = MEM_U32(v0 + 20);
+//nop;
+//nop;
+if (t8 != t7) goto L40a06c;
+v1 = MEM_U8(v0 + 0);
+at = 0xc0000;
+t9 = v1 < 0x20;
+t0 = -t9;
+t2 = t0 & at;
+t1 = t2 << (v1 & 0x1f);
+t7 = v1 < 0x20;
+if ((int)t1 >= 0) goto L40a034;
+t5 = MEM_U8(s2 + 0);
+at = 0xc0000;
+t3 = t5 < 0x20;
+t6 = -t3;
+t4 = t6 & at;
+t8 = t4 << (t5 & 0x1f);
+if ((int)t8 >= 0) {
+t9 = -t7;
+goto L40a06c;}
+L40a034:
+t9 = -t7;
+at = 0xc0000;
+t0 = t9 & at;
+t2 = t0 << (v1 & 0x1f);
+//nop;
+if ((int)t2 < 0) goto L40a0c4;
+t1 = MEM_U8(s2 + 0);
+at = 0xc0000;
+t3 = t1 < 0x20;
+t6 = -t3;
+t4 = t6 & at;
+t5 = t4 << (t1 & 0x1f);
+//nop;
+if ((int)t5 >= 0) goto L40a0c4;
+L40a06c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+MEM_U32(s6 + 0) = v0;
+// bdead 41e8000b gp = MEM_U32(sp + 60);
+v1 = MEM_U8(v0 + 1);
+t8 = 0x18;
+MEM_U8(v0 + 0) = (uint8_t)t8;
+t7 = MEM_U8(s2 + 0);
+t9 = v1 << 27;
+t0 = t9 >> 27;
+t2 = t7 ^ t0;
+t3 = t2 & 0x1f;
+t4 = 0x10004cb0;
+t6 = t3 ^ v1;
+MEM_U8(v0 + 1) = (uint8_t)t6;
+t4 = MEM_U32(t4 + 0);
+s0 = v0;
+t1 = MEM_U8(t4 + 0);
+//nop;
+MEM_U8(v0 + 8) = (uint8_t)t1;
+L40a0c4:
+at = 0x10004cb0;
+//nop;
+MEM_U32(at + 0) = zero;
+L40a0d0:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+v1 = MEM_U32(s4 + 0);
+MEM_U32(s6 + 0) = v0;
+a0 = MEM_U8(v1 + 1);
+t5 = MEM_U8(s2 + 0);
+t8 = a0 << 27;
+t9 = t8 >> 27;
+t7 = t5 ^ t9;
+t0 = t7 & 0x1f;
+// bdead 41e80233 gp = MEM_U32(sp + 60);
+t2 = t0 ^ a0;
+MEM_U8(v1 + 1) = (uint8_t)t2;
+t6 = MEM_U32(s4 + 0);
+t3 = MEM_U32(s2 + 20);
+a1 = 0x10000050;
+MEM_U32(t6 + 8) = t3;
+t4 = MEM_U32(a1 + 0);
+//nop;
+t1 = t4 + 0x1;
+MEM_U32(a1 + 0) = t1;
+L40a12c:
+t8 = MEM_U32(s2 + 16);
+t5 = MEM_U32(s4 + 0);
+MEM_U32(t5 + 12) = t8;
+goto L40a274;
+L40a13c:
+//nop;
+if (v0 == 0) goto L40a274;
+t9 = MEM_U8(v0 + 126);
+a2 = 0x28;
+a3 = 0x28;
+if (t9 == 0) goto L40a274;
+a0 = 0x10000b30;
+a1 = 0x1000154a;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41f40003 gp = MEM_U32(sp + 60);
+a1 = MEM_U32(s1 + 16);
+//nop;
+a0 = 0x10000b30;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead 41f00003 gp = MEM_U32(sp + 60);
+a2 = 0xa;
+a0 = 0x10000b30;
+a1 = 0x10001540;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0xa;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41f00183 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 41f00003 gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 41f00003 gp = MEM_U32(sp + 60);
+//nop;
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s6 + 0);
+// bdead 41f00023 gp = MEM_U32(sp + 60);
+t7 = 0x67;
+MEM_U8(a0 + 0) = (uint8_t)t7;
+t0 = MEM_U32(s4 + 0);
+v1 = MEM_U8(a0 + 1);
+t3 = MEM_U8(t0 + 1);
+t6 = v1 << 27;
+t4 = t6 >> 27;
+t1 = t3 ^ t4;
+t8 = t1 & 0x1f;
+t5 = t8 ^ v1;
+MEM_U8(a0 + 1) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41f0000b gp = MEM_U32(sp + 60);
+MEM_U32(s6 + 0) = v0;
+//nop;
+a0 = MEM_U32(s4 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41f0000b gp = MEM_U32(sp + 60);
+//nop;
+at = 0x10003c60;
+//nop;
+MEM_U32(at + 0) = v0;
+t9 = MEM_U8(s3 + 8);
+//nop;
+t7 = t9 + 0xffffffff;
+MEM_U8(s3 + 8) = (uint8_t)t7;
+L40a274:
+s0 = MEM_U32(s4 + 0);
+//nop;
+goto L409a44;
+L40a280:
+t0 = MEM_U8(sp + 115);
+//nop;
+//nop;
+if (t0 == 0) goto L40a2ac;
+//nop;
+a0 = s5;
+//nop;
+f_one_instruction(mem, sp, a0);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s4 + 0);
+goto L40a2ec;
+L40a2ac:
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s4 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 41e0000b gp = MEM_U32(sp + 60);
+//nop;
+at = 0x10003c60;
+//nop;
+MEM_U32(at + 0) = v0;
+s0 = MEM_U32(s4 + 0);
+L40a2ec:
+//nop;
+goto L409a44;
+L40a2f4:
+//nop;
+MEM_U8(sp + 115) = (uint8_t)t2;
+a0 = s5;
+f_one_instruction(mem, sp, a0);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s4 + 0);
+//nop;
+goto L409a44;
+L40a314:
+//nop;
+a0 = s5;
+//nop;
+f_one_instruction(mem, sp, a0);
+// bdead 41e00003 gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s4 + 0);
+//nop;
+goto L409a44;
+L40a334:
+if (at != 0) {
+at = 0x5c;
+goto L40a374;}
+at = 0x5c;
+s2 = s0;
+if (v0 == at) goto L409a7c;
+t6 = v0 + 0xffffff9c;
+//nop;
+if (t6 >= 0x2) goto L40a314;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L409d90;
+case 1: goto L40a280;
+}
+L40a374:
+at = 0x3;
+t2 = 0x1;
+if (v0 == at) goto L40a2f4;
+t3 = v0 + 0xffffffe9;
+if (v0 >= 0x20) goto L40a3b8;
+//nop;
+if (t3 >= 0x9) goto L40a314;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L409d84;
+case 1: goto L40a314;
+case 2: goto L40a314;
+case 3: goto L40a314;
+case 4: goto L409a08;
+case 5: goto L40a314;
+case 6: goto L40a314;
+case 7: goto L40a314;
+case 8: goto L40a3cc;
+}
+L40a3b8:
+at = 0x51;
+//nop;
+if (v0 == at) goto L409a60;
+//nop;
+goto L40a314;
+L40a3cc:
+t4 = MEM_U8(sp + 131);
+//nop;
+//nop;
+if (t4 != 0) goto L40a45c;
+t1 = MEM_U32(s5 + 56);
+//nop;
+//nop;
+if (t1 == 0) goto L40a45c;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+//nop;
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s6 + 0);
+// bdead c1e00023 gp = MEM_U32(sp + 60);
+t5 = MEM_U8(a0 + 1);
+t8 = 0x1b;
+t9 = t5 & 0xff1f;
+t7 = t9 | 0x20;
+MEM_U8(a0 + 0) = (uint8_t)t8;
+MEM_U8(a0 + 1) = (uint8_t)t7;
+t0 = MEM_U32(s5 + 56);
+//nop;
+MEM_U32(a0 + 8) = t0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+s0 = MEM_U32(s4 + 0);
+MEM_U32(s6 + 0) = v0;
+L40a45c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1e0000b gp = MEM_U32(sp + 60);
+MEM_U32(s4 + 0) = v0;
+//nop;
+a0 = v0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1e00003 gp = MEM_U32(sp + 60);
+t2 = MEM_U32(s6 + 0);
+v0 = 0x10003c6c;
+v1 = 0x10000010;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t6 = t2 - v0;
+MEM_U32(s5 + 24) = t6;
+MEM_U32(s5 + 20) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L40a4b0:
+s5 = MEM_U32(s5 + 60);
+//nop;
+//nop;
+if (s5 != 0) goto L40975c;
+MEM_U32(sp + 108) = fp;
+L40a4c4:
+// bdead 40000001 ra = MEM_U32(sp + 68);
+if (v1 == 0) goto L40a62c;
+a0 = 0x10000b30;
+a1 = 0x1000151a;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x26;
+a3 = 0x26;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0xc;
+a0 = 0x10000b30;
+a1 = 0x10000054;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0x8;
+a0 = 0x10000b30;
+a1 = 0x10001512;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x8;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0xc;
+a0 = 0x10000b30;
+a1 = 0x1000005c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0x26;
+a0 = 0x10000b30;
+a1 = 0x100014ec;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x26;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0xc;
+a0 = 0x10000b30;
+a1 = 0x10000050;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0x8;
+a0 = 0x10000b30;
+a1 = 0x100014e4;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x8;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 60);
+a2 = 0xc;
+a0 = 0x10000b30;
+a1 = 0x10000058;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 60);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 68);
+L40a62c:
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 s1 = MEM_U32(sp + 32);
+// bdead 1 s2 = MEM_U32(sp + 36);
+// bdead 1 s3 = MEM_U32(sp + 40);
+// bdead 1 s4 = MEM_U32(sp + 44);
+// bdead 1 s5 = MEM_U32(sp + 48);
+// bdead 1 s6 = MEM_U32(sp + 52);
+// bdead 1 s7 = MEM_U32(sp + 56);
+// bdead 1 fp = MEM_U32(sp + 64);
+// bdead 1 sp = sp + 0x98;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static void f_init_output(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40a664:
+//init_output:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003c4c;
+t7 = 0x10003c48;
+t6 = MEM_U32(t6 + 0);
+t7 = MEM_U32(t7 + 0);
+a1 = 0x10003c50;
+t8 = t6 - t7;
+t9 = t8 >> 1;
+a0 = t8 + t9;
+MEM_U32(a1 + 0) = t8;
+MEM_U32(a1 + 0) = a0;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601806b MEM_U32(sp + 28) = ra;
+// fdead 4601806b MEM_U32(sp + 24) = gp;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+a1 = 0x10003c50;
+a0 = 0x10003c54;
+t1 = MEM_U32(a1 + 0);
+at = 0x10003c58;
+t2 = v0 + t1;
+t3 = t2 + 0xffffffc0;
+MEM_U32(a0 + 0) = v0;
+MEM_U32(at + 0) = t3;
+at = 0x10003c5c;
+// bdead d sp = sp + 0x20;
+MEM_U32(at + 0) = v0;
+return;
+}
+
+static void f_grow_ubuffer_sym_update(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v1 = 0, a1 = 0, a2 = 0, t7 = 0, t8 = 0;
+L40a6e4:
+//grow_ubuffer_sym_update:
+//nop;
+//nop;
+//nop;
+a1 = a0;
+a0 = 0x10003ca0;
+//nop;
+a2 = a0 + 0x800;
+L40a700:
+v1 = MEM_U32(a0 + 0);
+a0 = a0 + 0x4;
+//nop;
+if (v1 == 0) goto L40a730;
+L40a710:
+t7 = MEM_U32(v1 + 8);
+//nop;
+t8 = t7 + a1;
+MEM_U32(v1 + 8) = t8;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40a710;
+L40a730:
+//nop;
+if (a0 != a2) goto L40a700;
+//nop;
+return;
+}
+
+static void f_grow_ubuffer(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a740:
+//grow_ubuffer:
+//nop;
+//nop;
+//nop;
+t0 = 0x10003c50;
+sp = sp + 0xffffffd0;
+v0 = MEM_U32(t0 + 0);
+MEM_U32(sp + 48) = a0;
+a0 = 0x10003c54;
+a3 = 0x10003c58;
+t6 = 0x10003c5c;
+t8 = v0 >> 1;
+a0 = MEM_U32(a0 + 0);
+a3 = MEM_U32(a3 + 0);
+t6 = MEM_U32(t6 + 0);
+a1 = v0 + t8;
+MEM_U32(t0 + 0) = a1;
+//nop;
+// fdead 420083eb MEM_U32(sp + 28) = ra;
+t7 = t6 - a0;
+// fdead 420183eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = t7;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 36) = a3;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t4 = MEM_U32(sp + 44);
+t0 = 0x10003c50;
+t1 = 0x10003c54;
+t2 = MEM_U32(t0 + 0);
+at = 0x10003c58;
+MEM_U32(t1 + 0) = v0;
+t3 = v0 + t2;
+MEM_U32(at + 0) = t3;
+at = 0x10003c5c;
+a0 = 0x10003c6c;
+t5 = v0 + t4;
+MEM_U32(at + 0) = t5;
+a2 = MEM_U32(sp + 40);
+v1 = MEM_U32(a0 + 0);
+a3 = MEM_U32(sp + 36);
+a1 = v0;
+if ((int)v1 < (int)a2) goto L40a800;
+t6 = v1 + v0;
+if ((int)v1 >= (int)a3) goto L40a800;
+t7 = t6 - a2;
+MEM_U32(a0 + 0) = t7;
+L40a800:
+v1 = 0x10003c70;
+a0 = a1 - a2;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L40a84c;
+L40a818:
+v0 = MEM_U32(v1 + 20);
+//nop;
+if ((int)v0 < (int)a2) {
+at = (int)v0 < (int)a3;
+goto L40a83c;}
+t8 = v0 + a1;
+if ((int)v0 >= (int)a3) goto L40a83c;
+t9 = t8 - a2;
+MEM_U32(v1 + 20) = t9;
+L40a83c:
+v1 = MEM_U32(v1 + 60);
+//nop;
+//nop;
+if (v1 != 0) goto L40a818;
+L40a84c:
+//nop;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 36) = a3;
+f_grow_ubuffer_sym_update(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+t2 = 0x10000080;
+a2 = MEM_U32(sp + 40);
+v1 = MEM_U32(a0 + 0);
+t2 = MEM_U32(t2 + 0);
+a3 = MEM_U32(sp + 36);
+t1 = 0x10003c54;
+at = (int)v1 < (int)a2;
+if (t2 == v1) goto L40a8a8;
+if ((int)v1 < (int)a2) {
+at = (int)v1 < (int)a3;
+goto L40a8a8;}
+// bdead 4b1 ra = MEM_U32(sp + 28);
+if ((int)v1 >= (int)a3) goto L40a8ac;
+t3 = MEM_U32(t1 + 0);
+//nop;
+t4 = v1 + t3;
+t5 = t4 - a2;
+MEM_U32(a0 + 0) = t5;
+L40a8a8:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40a8ac:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void f_copy_to(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40a8b8:
+//copy_to:
+//nop;
+//nop;
+//nop;
+a1 = 0x10003c60;
+sp = sp + 0xffffffd8;
+a1 = MEM_U32(a1 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a2 = a0 - a1;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+if (a2 == 0) goto L40a96c;
+a0 = 0x10003c5c;
+t7 = 0x10003c58;
+a0 = MEM_U32(a0 + 0);
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = t7 - a0;
+//nop;
+if ((int)t8 >= (int)a2) goto L40a934;
+//nop;
+a0 = 0x10000080;
+MEM_U32(sp + 36) = a2;
+f_grow_ubuffer(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a1 = 0x10003c60;
+a0 = 0x10003c5c;
+a1 = MEM_U32(a1 + 0);
+a0 = MEM_U32(a0 + 0);
+//nop;
+L40a934:
+//nop;
+MEM_U32(sp + 36) = a2;
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 40);
+at = 0x10003c60;
+t0 = 0x10003c5c;
+a2 = MEM_U32(sp + 36);
+t0 = MEM_U32(t0 + 0);
+MEM_U32(at + 0) = t9;
+at = 0x10003c5c;
+t1 = t0 + a2;
+MEM_U32(at + 0) = t1;
+L40a96c:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_inline_copy_to(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a97c:
+//inline_copy_to:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+a1 = 0x10003c60;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+t6 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+a3 = a0;
+a2 = t6 - a1;
+// bdead 400001c1 ra = MEM_U32(sp + 28);
+if (a2 == 0) goto L40aa58;
+a0 = 0x10003c5c;
+t7 = 0x10003c58;
+a0 = MEM_U32(a0 + 0);
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = t7 - a0;
+//nop;
+if ((int)t8 >= (int)a2) goto L40aa18;
+//nop;
+a0 = a3;
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 40) = a3;
+f_grow_ubuffer(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 36);
+t9 = MEM_U32(a3 + 0);
+at = 0x10003c60;
+a1 = 0x10003c60;
+a0 = 0x10003c5c;
+t0 = t9 - a2;
+MEM_U32(at + 0) = t0;
+a1 = MEM_U32(a1 + 0);
+a0 = MEM_U32(a0 + 0);
+//nop;
+L40aa18:
+//nop;
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 40) = a3;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+at = 0x10003c60;
+t2 = 0x10003c5c;
+t1 = MEM_U32(a3 + 0);
+a2 = MEM_U32(sp + 36);
+t2 = MEM_U32(t2 + 0);
+MEM_U32(at + 0) = t1;
+at = 0x10003c5c;
+t3 = t2 + a2;
+MEM_U32(at + 0) = t3;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40aa58:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f_modify(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40aa64:
+//modify:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a3 = v0;
+a1 = 0x10003c60;
+a0 = 0x10003c5c;
+t7 = 0x10003c58;
+a1 = MEM_U32(a1 + 0);
+a0 = MEM_U32(a0 + 0);
+t7 = MEM_U32(t7 + 0);
+a2 = v0 - a1;
+t8 = t7 - a0;
+//nop;
+if ((int)t8 >= (int)a2) goto L40ab18;
+//nop;
+a0 = MEM_U32(sp + 48);
+MEM_U32(sp + 36) = a2;
+f_grow_ubuffer(mem, sp, a0);
+t9 = MEM_U32(sp + 48);
+// bdead 44000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(t9 + 0);
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+at = 0x10003c60;
+a1 = 0x10003c60;
+a0 = 0x10003c5c;
+t0 = v0 - a2;
+MEM_U32(at + 0) = t0;
+a1 = MEM_U32(a1 + 0);
+a0 = MEM_U32(a0 + 0);
+a3 = v0;
+L40ab18:
+//nop;
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 40) = a3;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 48);
+v1 = 0x10003c5c;
+t4 = 0x10003c60;
+a3 = MEM_U32(sp + 40);
+at = 0x10003c60;
+t2 = MEM_U32(t1 + 0);
+v1 = MEM_U32(v1 + 0);
+t4 = MEM_U32(t4 + 0);
+a2 = MEM_U32(sp + 36);
+MEM_U32(at + 0) = a3;
+// bdead 2891 ra = MEM_U32(sp + 28);
+at = 0x10003c5c;
+t3 = v1 + t2;
+t5 = v1 + a2;
+// bdead 7005 sp = sp + 0x30;
+v0 = t3 - t4;
+MEM_U32(at + 0) = t5;
+return v0;
+}
+
+static uint32_t f_uoutput(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40ab74:
+//uoutput:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = f_ulen(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+a0 = 0x10003c5c;
+t6 = 0x10003c58;
+a0 = MEM_U32(a0 + 0);
+t6 = MEM_U32(t6 + 0);
+//nop;
+t7 = t6 - a0;
+//nop;
+if ((int)t7 >= (int)v0) goto L40abec;
+//nop;
+a0 = 0x10000080;
+//nop;
+f_grow_ubuffer(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10003c5c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+L40abec:
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 32);
+//nop;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 32);
+a0 = 0x10003c5c;
+// bdead 2000021 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(a0 + 0);
+at = 0x10003c5c;
+t9 = v0 + t8;
+// bdead 400000d sp = sp + 0x28;
+MEM_U32(at + 0) = t9;
+return v0;
+}
+
+static void f_check_for_more_space(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40ac28:
+//check_for_more_space:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003c58;
+t7 = 0x10003c5c;
+t6 = MEM_U32(t6 + 0);
+t7 = MEM_U32(t7 + 0);
+sp = sp + 0xffffffd8;
+t8 = t6 - t7;
+at = (int)t8 < (int)0x140;
+// fdead 420181ef MEM_U32(sp + 28) = ra;
+// fdead 420181ef MEM_U32(sp + 24) = gp;
+if (at == 0) goto L40ac9c;
+t0 = 0x10003c60;
+t9 = MEM_U32(a0 + 0);
+t0 = MEM_U32(t0 + 0);
+MEM_U32(sp + 40) = a0;
+t1 = t9 - t0;
+//nop;
+MEM_U32(sp + 36) = t1;
+//nop;
+f_grow_ubuffer(mem, sp, a0);
+a0 = MEM_U32(sp + 40);
+// bdead 40000021 gp = MEM_U32(sp + 24);
+t3 = MEM_U32(sp + 36);
+t2 = MEM_U32(a0 + 0);
+at = 0x10003c60;
+t4 = t2 - t3;
+MEM_U32(at + 0) = t4;
+L40ac9c:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f_change_to_nops(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, s0 = 0, s1 = 0, s2 = 0;
+L40acac:
+//change_to_nops:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400000ab MEM_U32(sp + 36) = ra;
+// fdead 400000ab MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400200ab MEM_U32(sp + 32) = gp;
+// fdead 400200ab MEM_U32(sp + 28) = s2;
+// fdead 400200ab MEM_U32(sp + 24) = s1;
+v0 = f_next_u(mem, sp, a0);
+// bdead 20009 gp = MEM_U32(sp + 32);
+s1 = v0;
+s2 = 0x60;
+L40ace8:
+//nop;
+MEM_U8(s0 + 0) = (uint8_t)s2;
+a0 = s0;
+v0 = f_next_u(mem, sp, a0);
+// bdead c0009 gp = MEM_U32(sp + 32);
+s0 = v0;
+if (v0 != s1) goto L40ace8;
+// bdead 40001 ra = MEM_U32(sp + 36);
+v0 = s1;
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+//nop;
+}
+
+static void f_def_sym(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L40ad24:
+//def_sym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 72) = a0;
+v0 = MEM_U32(a0 + 4);
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = v0 * at;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)at >> 32);
+t1 = 0x10003ca0;
+a1 = lo;
+t7 = a1 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+a2 = t9 + t1;
+a3 = MEM_U32(a2 + 0);
+//nop;
+v1 = a3;
+if (a3 == 0) goto L40ad98;
+L40ad78:
+t2 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if (v0 == t2) goto L40ae08;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40ad78;
+L40ad98:
+//nop;
+a0 = 0x14;
+a1 = zero;
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 32) = a3;
+v0 = f_new(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 32);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(v0 + 0) = a3;
+t3 = MEM_U32(sp + 72);
+//nop;
+t4 = MEM_U32(t3 + 4);
+//nop;
+MEM_U32(v0 + 4) = t4;
+//nop;
+a0 = MEM_U32(sp + 72);
+MEM_U32(sp + 64) = v0;
+v0 = f_uoutput(mem, sp, a0);
+v1 = MEM_U32(sp + 64);
+a2 = MEM_U32(sp + 36);
+// bdead 9b gp = MEM_U32(sp + 24);
+MEM_U32(v1 + 8) = v0;
+MEM_U8(v1 + 16) = (uint8_t)zero;
+MEM_U8(v1 + 17) = (uint8_t)zero;
+MEM_U8(v1 + 18) = (uint8_t)zero;
+MEM_U8(v1 + 19) = (uint8_t)zero;
+MEM_U32(a2 + 0) = v1;
+goto L40b1f0;
+L40ae08:
+v0 = MEM_U32(v1 + 8);
+//nop;
+t5 = MEM_U32(sp + 72);
+if (v0 != 0) goto L40ae3c;
+//nop;
+a0 = MEM_U32(sp + 72);
+MEM_U32(sp + 64) = v1;
+v0 = f_uoutput(mem, sp, a0);
+v1 = MEM_U32(sp + 64);
+// bdead 19 gp = MEM_U32(sp + 24);
+MEM_U32(v1 + 8) = v0;
+goto L40b1f0;
+// fdead 0 t5 = MEM_U32(sp + 72);
+L40ae3c:
+t6 = MEM_U32(v0 + 8);
+v1 = MEM_U32(t5 + 8);
+t0 = v0;
+a2 = 0xffffff0f;
+if ((int)t6 >= (int)v1) goto L40ae58;
+MEM_U32(v0 + 8) = v1;
+L40ae58:
+t7 = MEM_U32(sp + 72);
+v1 = MEM_U16(t0 + 2);
+a1 = MEM_U16(t7 + 2);
+v0 = v1 & a2;
+a0 = a1 & a2;
+t8 = v1 - v0;
+if (v0 >= a0) goto L40ae8c;
+t1 = MEM_U32(sp + 72);
+t9 = t8 + a0;
+MEM_U16(t0 + 2) = (uint16_t)t9;
+a1 = MEM_U16(t1 + 2);
+//nop;
+L40ae8c:
+a0 = a1 >> 4;
+//nop;
+if (a0 == 0) goto L40af2c;
+v1 = MEM_U16(t0 + 2);
+t3 = a1 & 0xf0;
+v0 = v1 >> 4;
+t2 = v1 & a2;
+if (v0 != 0) goto L40aeb8;
+t4 = t2 | t3;
+MEM_U16(t0 + 2) = (uint16_t)t4;
+goto L40af2c;
+L40aeb8:
+a2 = 0x36;
+if (a0 == v0) goto L40af2c;
+a0 = 0x10000b30;
+a1 = 0x10001646;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x36;
+MEM_U32(sp + 60) = t0;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+a0 = 0x10000b30;
+//nop;
+a1 = MEM_U32(t0 + 4);
+a0 = MEM_U32(a0 + 0);
+a2 = 0x1;
+a3 = 0xa;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+//nop;
+L40af2c:
+v0 = MEM_U8(t0 + 0);
+at = v0 < 0x15;
+goto L40b0e0;
+L40af38:
+t5 = MEM_U32(sp + 72);
+at = 0x8100000;
+v0 = MEM_U8(t5 + 0);
+//nop;
+t6 = v0 + 0xffffffe0;
+t7 = t6 < 0x20;
+t8 = -t7;
+t9 = t8 & at;
+t1 = t9 << (t6 & 0x1f);
+t2 = v0 < 0x40;
+if ((int)t1 < 0) goto L40b1f0;
+t3 = (int)v0 >> 5;
+if (t2 == 0) goto L40af8c;
+t5 = 0x100000b0;
+t4 = t3 << 2;
+t5 = t5;
+t7 = t5 + t4;
+t8 = MEM_U32(t7 + 0);
+//nop;
+t9 = t8 << (v0 & 0x1f);
+t2 = (int)t9 < (int)0x0;
+L40af8c:
+//nop;
+if (t2 == 0) goto L40b17c;
+//nop;
+goto L40b184;
+// fdead 0 t1 = MEM_U32(sp + 72);
+L40afa0:
+//nop;
+v0 = MEM_U8(t1 + 0);
+//nop;
+t3 = v0 < 0x40;
+t5 = (int)v0 >> 5;
+if (t3 == 0) goto L40afd8;
+t7 = 0x100000a8;
+t4 = t5 << 2;
+t7 = t7;
+t8 = t7 + t4;
+t9 = MEM_U32(t8 + 0);
+//nop;
+t6 = t9 << (v0 & 0x1f);
+t3 = (int)t6 < (int)0x0;
+L40afd8:
+t1 = v0 < 0x40;
+if (t3 != 0) goto L40b1f0;
+t5 = (int)v0 >> 5;
+if (t1 == 0) goto L40b008;
+t4 = 0x100000b0;
+t7 = t5 << 2;
+t4 = t4;
+t8 = t4 + t7;
+t9 = MEM_U32(t8 + 0);
+//nop;
+t6 = t9 << (v0 & 0x1f);
+t1 = (int)t6 < (int)0x0;
+L40b008:
+//nop;
+if (t1 == 0) goto L40b17c;
+//nop;
+goto L40b184;
+// fdead 0 t3 = MEM_U32(sp + 72);
+L40b01c:
+//nop;
+v0 = MEM_U8(t3 + 0);
+//nop;
+t5 = v0 < 0x60;
+t4 = (int)v0 >> 5;
+if (t5 == 0) goto L40b054;
+t8 = 0x1000009c;
+t7 = t4 << 2;
+t8 = t8;
+t9 = t8 + t7;
+t6 = MEM_U32(t9 + 0);
+//nop;
+t2 = t6 << (v0 & 0x1f);
+t5 = (int)t2 < (int)0x0;
+L40b054:
+t3 = v0 < 0x40;
+if (t5 != 0) goto L40b1f0;
+t4 = (int)v0 >> 5;
+if (t3 == 0) goto L40b084;
+t7 = 0x100000b0;
+t8 = t4 << 2;
+t7 = t7;
+t9 = t7 + t8;
+t6 = MEM_U32(t9 + 0);
+//nop;
+t2 = t6 << (v0 & 0x1f);
+t3 = (int)t2 < (int)0x0;
+L40b084:
+//nop;
+if (t3 == 0) goto L40b17c;
+//nop;
+goto L40b184;
+L40b094:
+t5 = MEM_U32(sp + 72);
+//nop;
+t4 = MEM_U8(t5 + 0);
+//nop;
+t7 = t4 < 0x60;
+t8 = (int)t4 >> 5;
+if (t7 == 0) goto L40b0d0;
+t6 = 0x10000090;
+t9 = t8 << 2;
+t6 = t6;
+t2 = t6 + t9;
+t1 = MEM_U32(t2 + 0);
+//nop;
+t3 = t1 << (t4 & 0x1f);
+t7 = (int)t3 < (int)0x0;
+L40b0d0:
+//nop;
+if (t7 == 0) goto L40b184;
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40b1f4;
+L40b0e0:
+if (at != 0) {
+at = v0 < 0x2c;
+goto L40b104;}
+t6 = v0 + 0xffffffdc;
+if (v0 < 0x2c) goto L40b150;
+at = 0x53;
+t3 = MEM_U32(sp + 72);
+if (v0 == at) goto L40b01c;
+//nop;
+goto L40b118;
+L40b104:
+at = 0x6;
+if (v0 == at) {
+at = 0x14;
+goto L40b184;}
+at = 0x14;
+t1 = MEM_U32(sp + 72);
+if (v0 == at) goto L40afa0;
+L40b118:
+a2 = 0x1000163e;
+//nop;
+a0 = 0x2;
+a1 = 0xbc;
+a3 = 0x8;
+MEM_U32(sp + 60) = t0;
+a2 = a2;
+f_caseerror(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 72);
+// bdead 42000001 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+v0 = MEM_U8(t8 + 0);
+//nop;
+goto L40b17c;
+L40b150:
+//nop;
+if (t6 >= 0x8) goto L40b118;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L40af38;
+case 1: goto L40b118;
+case 2: goto L40b118;
+case 3: goto L40b184;
+case 4: goto L40b118;
+case 5: goto L40b118;
+case 6: goto L40b094;
+case 7: goto L40b184;
+}
+L40b17c:
+MEM_U8(t0 + 0) = (uint8_t)v0;
+goto L40b1f0;
+L40b184:
+a0 = 0x10000b30;
+a1 = 0x10001610;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x2e;
+a3 = 0x2e;
+MEM_U32(sp + 60) = t0;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 60);
+a0 = 0x10000b30;
+//nop;
+a1 = MEM_U32(t0 + 4);
+a0 = MEM_U32(a0 + 0);
+a2 = 0x1;
+a3 = 0xa;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40b1f0:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40b1f4:
+// bdead 1 sp = sp + 0x48;
+//nop;
+return;
+}
+
+static uint32_t f_find_sym(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40b200:
+//find_sym:
+//nop;
+//nop;
+//nop;
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = a0 * at;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)at >> 32);
+sp = sp + 0xffffffe0;
+t0 = 0x10003ca0;
+// fdead 64000022f MEM_U32(sp + 28) = ra;
+// fdead 64000022f MEM_U32(sp + 24) = gp;
+// fdead 64000022f MEM_U32(sp + 20) = s0;
+s0 = a0;
+t6 = lo;
+t7 = t6 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+t1 = t9 + t0;
+v1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (v1 == 0) goto L40b27c;
+L40b254:
+t2 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if (s0 != t2) goto L40b26c;
+v0 = v1;
+goto L40b2e0;
+L40b26c:
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40b254;
+L40b27c:
+a0 = 0x10000b30;
+a1 = 0x1000169c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x34;
+a3 = 0x34;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a1 = s0;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+L40b2e0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_find_sym1(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40b2f0:
+//find_sym1:
+//nop;
+//nop;
+//nop;
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = a0 * at;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)at >> 32);
+t1 = 0x10003ca0;
+sp = sp + 0xffffffc8;
+// fdead 64000042f MEM_U32(sp + 28) = ra;
+// fdead 64000042f MEM_U32(sp + 24) = gp;
+a2 = a0;
+t6 = lo;
+t7 = t6 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+a3 = t9 + t1;
+t0 = MEM_U32(a3 + 0);
+//nop;
+v1 = t0;
+if (t0 == 0) goto L40b368;
+L40b340:
+t2 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if (a2 != t2) goto L40b358;
+v0 = v1;
+goto L40b3b4;
+L40b358:
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40b340;
+L40b368:
+//nop;
+a0 = 0x14;
+a1 = zero;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 40) = a3;
+MEM_U32(sp + 36) = t0;
+v0 = f_new(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 56);
+t0 = MEM_U32(sp + 36);
+// bdead 38b gp = MEM_U32(sp + 24);
+MEM_U32(v0 + 8) = zero;
+MEM_U8(v0 + 16) = (uint8_t)zero;
+MEM_U8(v0 + 17) = (uint8_t)zero;
+MEM_U8(v0 + 18) = (uint8_t)zero;
+MEM_U8(v0 + 19) = (uint8_t)zero;
+MEM_U32(v0 + 4) = a2;
+MEM_U32(v0 + 0) = t0;
+MEM_U32(a3 + 0) = v0;
+L40b3b4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static void f_enter_readonly_init(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40b3c4:
+//enter_readonly_init:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+t7 = MEM_U32(a0 + 4);
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = t7 * at;
+hi = (uint32_t)((uint64_t)t7 * (uint64_t)at >> 32);
+a0 = 0x8;
+a1 = zero;
+t8 = lo;
+t9 = t8 >> 23;
+MEM_U16(sp + 36) = (uint16_t)t9;
+//nop;
+//nop;
+//nop;
+v0 = f_new(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t0 = MEM_U16(sp + 36);
+t2 = 0x100044a0;
+t1 = t0 << 2;
+v1 = t1 + t2;
+t3 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 4) = t3;
+t4 = MEM_U32(sp + 40);
+//nop;
+MEM_U32(v0 + 0) = t4;
+// bdead 19 ra = MEM_U32(sp + 28);
+MEM_U32(v1 + 0) = v0;
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_add_to_parmlist(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40b450:
+//add_to_parmlist:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 36) = a1;
+a3 = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 32) = a3;
+a0 = 0x1c;
+a1 = 0x1;
+v0 = f_new(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 36);
+// bdead 4000001b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(v1 + 0);
+a3 = MEM_U32(sp + 32);
+t5 = 0x11;
+if (a1 != 0) goto L40b4a8;
+MEM_U32(v1 + 0) = v0;
+goto L40b4d0;
+L40b4a8:
+v1 = MEM_U32(a1 + 12);
+a0 = a1;
+//nop;
+if (v1 == 0) goto L40b4cc;
+L40b4b8:
+a0 = v1;
+v1 = MEM_U32(v1 + 12);
+//nop;
+//nop;
+if (v1 != 0) goto L40b4b8;
+L40b4cc:
+MEM_U32(a0 + 12) = v0;
+L40b4d0:
+MEM_U32(v0 + 12) = zero;
+t6 = MEM_U8(a3 + 1);
+v1 = 0x10000008;
+t7 = t6 & 0x1f;
+MEM_U8(v0 + 0) = (uint8_t)t7;
+t8 = MEM_U32(a3 + 12);
+//nop;
+MEM_U32(v0 + 4) = t8;
+t9 = MEM_U32(a3 + 8);
+//nop;
+MEM_U32(v0 + 8) = t9;
+t0 = MEM_U16(a3 + 2);
+//nop;
+MEM_U8(v0 + 24) = (uint8_t)t0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t1 = zero < v1;
+v1 = t1;
+if (t1 == 0) goto L40b564;
+v1 = 0x10003c74;
+a0 = MEM_S8(sp + 43);
+v1 = MEM_U32(v1 + 0);
+//nop;
+t2 = v1 ^ 0x2;
+v1 = t2 < 0x1;
+//nop;
+if (v1 == 0) goto L40b564;
+v1 = a0 < 0x1;
+//nop;
+if (v1 == 0) goto L40b564;
+v1 = t7 & 0xff;
+t3 = v1 < 0x1;
+v1 = t3;
+if (t3 == 0) goto L40b564;
+v1 = t0 & 0xff;
+t4 = v1 ^ 0x1;
+v1 = t4 < 0x1;
+L40b564:
+MEM_U8(v0 + 25) = (uint8_t)v1;
+MEM_U8(v0 + 26) = (uint8_t)t5;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_no_promotion(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+L40b57c:
+//no_promotion:
+//nop;
+if (a0 == 0) goto L40b598;
+L40b584:
+MEM_U8(a0 + 25) = (uint8_t)zero;
+a0 = MEM_U32(a0 + 12);
+//nop;
+//nop;
+if (a0 != 0) goto L40b584;
+L40b598:
+//nop;
+return;
+}
+
+static void f_build_call_graph(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L40b5a0:
+//build_call_graph:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff68;
+at = 0x10003c88;
+//nop;
+// fdead 400001ef MEM_U32(sp + 68) = ra;
+// fdead 400001ef MEM_U32(sp + 64) = fp;
+// fdead 400001ef MEM_U32(sp + 60) = gp;
+// fdead 400001ef MEM_U32(sp + 56) = s7;
+// fdead 400001ef MEM_U32(sp + 52) = s6;
+// fdead 400001ef MEM_U32(sp + 48) = s5;
+// fdead 400001ef MEM_U32(sp + 44) = s4;
+// fdead 400001ef MEM_U32(sp + 40) = s3;
+// fdead 400001ef MEM_U32(sp + 36) = s2;
+// fdead 400001ef MEM_U32(sp + 32) = s1;
+// fdead 400001ef MEM_U32(sp + 28) = s0;
+a0 = zero;
+MEM_U32(at + 0) = zero;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 140) = zero;
+at = 0x10003c8c;
+fp = 0x10003c90;
+MEM_U32(at + 0) = v0;
+at = 0x10003c98;
+MEM_U32(fp + 0) = zero;
+MEM_U32(at + 0) = zero;
+at = 0x10003c7c;
+//nop;
+MEM_U32(at + 0) = zero;
+at = 0x10003c9c;
+s1 = zero;
+MEM_U32(sp + 144) = zero;
+a0 = 0x500;
+MEM_U32(at + 0) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c004000b gp = MEM_U32(sp + 60);
+t6 = 0x40;
+at = 0x100054c8;
+s0 = 0x10003c48;
+MEM_U32(at + 0) = v0;
+at = 0x100054cc;
+s7 = 0x10003c60;
+MEM_U32(at + 0) = t6;
+at = 0x100054d0;
+s0 = MEM_U32(s0 + 0);
+t7 = 0xffffffff;
+t8 = 0x10003c4c;
+MEM_U32(at + 0) = t7;
+MEM_U32(s7 + 0) = s0;
+t8 = MEM_U32(t8 + 0);
+s6 = MEM_U32(sp + 124);
+s4 = zero;
+if ((int)s0 >= (int)t8) goto L40c4cc;
+s2 = MEM_U32(sp + 128);
+s5 = 0x1;
+s3 = 0x1;
+L40b68c:
+//nop;
+if (s4 == 0) goto L40b7f8;
+v1 = MEM_U8(s0 + 0);
+at = 0x64;
+if (v1 != at) {
+at = 0x36;
+goto L40b774;}
+at = 0x36;
+t9 = MEM_U8(s0 + 1);
+//nop;
+t0 = t9 & 0x1f;
+at = 0x36;
+if (t0 != 0) goto L40b774;
+t1 = 0x100030a0;
+//nop;
+t1 = MEM_U32(t1 + 0);
+//nop;
+at = 0x36;
+if (t1 != 0) goto L40b774;
+a0 = 0x100054d0;
+v0 = 0x100054cc;
+t2 = MEM_U32(a0 + 0);
+//nop;
+v1 = t2 + 0x1;
+MEM_U32(a0 + 0) = v1;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t4 = v0 + 0x40;
+if (v0 != v1) goto L40b73c;
+at = 0x100054cc;
+a1 = 0x100054cc;
+MEM_U32(at + 0) = t4;
+a1 = MEM_U32(a1 + 0);
+a0 = 0x100054c8;
+//nop;
+t5 = a1 << 2;
+t5 = t5 + a1;
+a0 = MEM_U32(a0 + 0);
+a1 = t5 << 2;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+//nop;
+v1 = 0x100054d0;
+at = 0x100054c8;
+v1 = MEM_U32(v1 + 0);
+MEM_U32(at + 0) = v0;
+L40b73c:
+t6 = 0x100054c8;
+t7 = v1 << 2;
+t6 = MEM_U32(t6 + 0);
+t7 = t7 + v1;
+t7 = t7 << 2;
+v0 = t6 + t7;
+MEM_U32(v0 + 0) = s4;
+MEM_U32(v0 + 4) = zero;
+t8 = MEM_U32(s0 + 12);
+MEM_U32(v0 + 12) = zero;
+MEM_U8(v0 + 16) = (uint8_t)zero;
+MEM_U32(v0 + 8) = t8;
+goto L40b7f8;
+at = 0x36;
+L40b774:
+//nop;
+if (v1 != at) goto L40b7b0;
+t9 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (t9 != 0) goto L40b7b0;
+t0 = MEM_U16(s0 + 2);
+//nop;
+//nop;
+if (t0 != 0) goto L40b7b0;
+v0 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+if ((int)v0 >= (int)0x4) goto L40b7b8;
+L40b7b0:
+MEM_U8(s4 + 25) = (uint8_t)zero;
+goto L40b7f8;
+L40b7b8:
+t1 = MEM_U8(s4 + 26);
+at = 0x11;
+//nop;
+if (t1 != at) goto L40b7e4;
+t2 = MEM_U8(s0 + 1);
+//nop;
+t3 = t2 & 0x1f;
+MEM_U8(s4 + 26) = (uint8_t)t3;
+t4 = MEM_U32(s0 + 8);
+MEM_U32(s4 + 20) = t4;
+goto L40b7f8;
+L40b7e4:
+t5 = MEM_U32(s4 + 20);
+//nop;
+//nop;
+if (v0 == t5) goto L40b7f8;
+MEM_U8(s4 + 25) = (uint8_t)zero;
+L40b7f8:
+v1 = MEM_U8(s0 + 0);
+s4 = zero;
+v0 = v1;
+goto L40c348;
+L40b808:
+v0 = MEM_U32(s0 + 4);
+at = 0x4;
+//nop;
+if (v0 != 0) goto L40b828;
+t6 = MEM_U32(s0 + 8);
+at = 0x10003c74;
+MEM_U32(at + 0) = t6;
+goto L40c490;
+L40b828:
+//nop;
+if (v0 != at) goto L40b83c;
+at = 0x10003c80;
+MEM_U8(at + 0) = (uint8_t)s3;
+goto L40c490;
+L40b83c:
+//nop;
+if (s5 != v0) goto L40c490;
+MEM_U8(s1 + 120) = (uint8_t)s3;
+goto L40c490;
+L40b84c:
+t7 = MEM_U32(s0 + 4);
+at = 0x10003c7c;
+MEM_U32(at + 0) = t7;
+if (s1 != 0) goto L40c490;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+t8 = MEM_U16(s0 + 2);
+at = 0x10003c78;
+MEM_U32(s7 + 0) = v0;
+MEM_U32(sp + 144) = s0;
+MEM_U32(at + 0) = t8;
+goto L40c490;
+L40b8a0:
+v0 = 0x10003c44;
+t9 = MEM_U32(s0 + 4);
+t0 = MEM_U32(v0 + 0);
+//nop;
+if ((int)t0 >= (int)t9) {
+at = 0x42;
+goto L40b8c4;}
+at = 0x42;
+t0 = t9;
+at = 0x42;
+L40b8c4:
+MEM_U32(v0 + 0) = t0;
+if (v1 != at) goto L40c490;
+t1 = MEM_U16(s0 + 2);
+s6 = s6 + 0x1;
+t2 = t1 & 0x1f;
+//nop;
+if (t2 == 0) goto L40c490;
+MEM_U8(s1 + 120) = (uint8_t)s3;
+goto L40c490;
+L40b8e8:
+//nop;
+a0 = s0;
+MEM_U8(sp + 102) = (uint8_t)zero;
+s2 = zero;
+s6 = 0x1;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a2 = 0x14;
+if (s1 == 0) goto L40b94c;
+a0 = 0x10000b30;
+a1 = 0x1000170a;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x14;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fa0183 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1fa0003 gp = MEM_U32(sp + 60);
+//nop;
+L40b94c:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fa000b gp = MEM_U32(sp + 60);
+s1 = v0;
+t3 = 0x10003c74;
+t4 = 0x10003c78;
+t3 = MEM_U32(t3 + 0);
+//nop;
+MEM_U32(v0 + 104) = t3;
+t4 = MEM_U32(t4 + 0);
+MEM_U32(v0 + 20) = s0;
+MEM_U32(v0 + 108) = t4;
+t5 = MEM_U32(sp + 144);
+//nop;
+//nop;
+if (t5 == 0) goto L40b9bc;
+//nop;
+a0 = t5;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 != s0) goto L40b9bc;
+t6 = MEM_U32(sp + 144);
+//nop;
+MEM_U32(s1 + 20) = t6;
+L40b9bc:
+t7 = 0x10003c7c;
+a1 = zero;
+t7 = MEM_U32(t7 + 0);
+a2 = s1;
+MEM_U32(s1 + 12) = t7;
+v0 = MEM_U32(s0 + 12);
+a3 = zero;
+t8 = v0 & 0x1;
+v0 = zero < t8;
+t0 = v0 & 0xff;
+if (v0 != 0) goto L40b9f4;
+v0 = MEM_U8(s1 + 123);
+//nop;
+t0 = v0 & 0xff;
+L40b9f4:
+MEM_U8(sp + 103) = (uint8_t)v0;
+if (t0 == 0) goto L40ba1c;
+a0 = 0x10003c8c;
+t1 = MEM_U16(s0 + 2);
+//nop;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(sp + 16) = t1;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L40ba1c:
+t2 = MEM_U32(sp + 140);
+t3 = MEM_U32(sp + 140);
+//nop;
+if (t2 != 0) goto L40ba44;
+at = 0x10003c98;
+//nop;
+MEM_U32(at + 0) = s1;
+v0 = MEM_U32(s0 + 12);
+t4 = MEM_U16(s0 + 2);
+goto L40ba54;
+L40ba44:
+MEM_U32(t3 + 4) = s1;
+v0 = MEM_U32(s0 + 12);
+//nop;
+t4 = MEM_U16(s0 + 2);
+L40ba54:
+t5 = v0 & 0x3e;
+MEM_U32(sp + 140) = s1;
+MEM_U32(sp + 120) = t4;
+if (t5 == 0) goto L40c490;
+MEM_U8(s1 + 120) = (uint8_t)s3;
+goto L40c490;
+L40ba6c:
+t6 = s2 >> 5;
+a0 = s0;
+if (t6 >= s6) goto L40ba80;
+t6 = s6;
+L40ba80:
+//nop;
+MEM_U32(sp + 76) = t6;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+t8 = MEM_U32(s1 + 20);
+t0 = MEM_U32(sp + 76);
+t9 = v0 - t8;
+// bdead c5fe020b gp = MEM_U32(sp + 60);
+MEM_U32(s1 + 24) = t9;
+MEM_U32(s1 + 32) = s2;
+MEM_U32(s1 + 28) = t0;
+MEM_U32(s7 + 0) = v0;
+s1 = zero;
+goto L40c490;
+L40bab8:
+t2 = MEM_U16(s0 + 2);
+t1 = MEM_U32(sp + 120);
+t3 = t2 + 0x1;
+//nop;
+if (t1 != t3) goto L40c490;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+t4 = MEM_U32(v0 + 64);
+// bdead c1fe200b gp = MEM_U32(sp + 60);
+MEM_U32(s1 + 68) = t4;
+MEM_U32(v0 + 64) = s1;
+MEM_U32(s1 + 72) = v0;
+goto L40c490;
+L40baf4:
+v0 = MEM_U8(s0 + 1);
+at = 0x2;
+t5 = v0 << 24;
+v0 = t5 >> 29;
+//nop;
+if (v0 != at) goto L40bb18;
+t7 = MEM_U32(s0 + 8);
+MEM_U32(s1 + 48) = t7;
+goto L40c490;
+L40bb18:
+//nop;
+if (s3 != v0) goto L40c490;
+t8 = MEM_U32(s0 + 8);
+MEM_U32(s1 + 56) = t8;
+goto L40c490;
+L40bb2c:
+t9 = MEM_U8(s0 + 1);
+at = 0x2;
+t0 = t9 & 0x1f;
+//nop;
+if (t0 != at) goto L40bbe8;
+t2 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t2 != 0) goto L40bb90;
+//nop;
+a0 = s3;
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(fp + 0) = v0;
+a0 = 0x10003c8c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = zero;
+a2 = v0;
+a3 = zero;
+MEM_U32(sp + 16) = zero;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L40bb90:
+//nop;
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(sp + 132) = v0;
+MEM_U8(v0 + 123) = (uint8_t)s3;
+//nop;
+a0 = MEM_U32(v0 + 52);
+//nop;
+f_no_promotion(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+t1 = MEM_U32(sp + 120);
+//nop;
+a0 = MEM_U32(fp + 0);
+a2 = MEM_U32(sp + 132);
+a1 = zero;
+a3 = zero;
+MEM_U32(sp + 16) = t1;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L40bbe8:
+s2 = s2 + 0x1;
+goto L40c490;
+L40bbf0:
+a2 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (a2 != 0) goto L40bc44;
+//nop;
+a0 = s3;
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(fp + 0) = v0;
+a0 = 0x10003c8c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = zero;
+a2 = v0;
+a3 = zero;
+MEM_U32(sp + 16) = zero;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a2 = MEM_U32(fp + 0);
+//nop;
+L40bc44:
+a1 = 0x10003c7c;
+//nop;
+a3 = MEM_U32(sp + 120);
+a1 = MEM_U32(a1 + 0);
+a0 = s1;
+MEM_U32(sp + 16) = zero;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+s2 = s2 + 0x1;
+v1 = 0x100054d0;
+s6 = s6 + 0x1;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t4 = v1 << 2;
+if ((int)v1 < 0) goto L40c490;
+t3 = 0x100054c8;
+t4 = t4 + v1;
+t3 = MEM_U32(t3 + 0);
+t4 = t4 << 2;
+v0 = t3 + t4;
+t5 = MEM_U32(v0 + 4);
+//nop;
+v1 = v1 + 0xffffffff;
+if (t5 != 0) goto L40c490;
+L40bca4:
+MEM_U32(v0 + 4) = s5;
+v0 = v0 + 0xffffffec;
+if ((int)v1 < 0) goto L40c490;
+t6 = MEM_U32(v0 + 4);
+//nop;
+v1 = v1 + 0xffffffff;
+if (t6 == 0) goto L40bca4;
+//nop;
+goto L40c490;
+L40bcc8:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+t7 = MEM_U16(s0 + 2);
+a1 = 0x10003c7c;
+//nop;
+a3 = MEM_U32(sp + 120);
+a1 = MEM_U32(a1 + 0);
+a0 = s1;
+a2 = v0;
+MEM_U32(sp + 16) = t7;
+f_add_edge(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 120);
+t9 = MEM_U16(s0 + 2);
+// bdead c7fe0003 gp = MEM_U32(sp + 60);
+at = t8 < t9;
+s2 = s2 + 0x1;
+s6 = s6 + 0x1;
+if (at == 0) goto L40bd34;
+//nop;
+a0 = MEM_U32(s1 + 52);
+//nop;
+f_no_promotion(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L40bd34:
+t0 = MEM_U32(s0 + 12);
+//nop;
+t2 = t0 & 0x10;
+//nop;
+if (t2 == 0) goto L40bd4c;
+MEM_U8(s1 + 120) = (uint8_t)s3;
+L40bd4c:
+v1 = 0x100054d0;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = v1 << 2;
+if ((int)v1 < 0) goto L40c490;
+t1 = 0x100054c8;
+t3 = t3 + v1;
+t1 = MEM_U32(t1 + 0);
+t3 = t3 << 2;
+v0 = t1 + t3;
+t4 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (t4 != 0) goto L40c490;
+L40bd88:
+t5 = MEM_U32(s0 + 4);
+v1 = v1 + 0xffffffff;
+v0 = v0 + 0xffffffec;
+MEM_U32(v0 + 24) = t5;
+if ((int)v1 < 0) goto L40c490;
+t6 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (t6 == 0) goto L40bd88;
+//nop;
+goto L40c490;
+L40bdb4:
+//nop;
+a0 = MEM_U32(s1 + 52);
+t7 = 0x1;
+MEM_U8(s1 + 125) = (uint8_t)s3;
+MEM_U8(s1 + 120) = (uint8_t)s3;
+MEM_U8(sp + 102) = (uint8_t)t7;
+f_no_promotion(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+goto L40c490;
+L40bddc:
+MEM_U8(s1 + 120) = (uint8_t)s3;
+s2 = s2 + 0x1;
+goto L40c490;
+L40bde8:
+s2 = s2 + 0x1;
+s6 = s6 + 0x1;
+goto L40c490;
+L40bdf4:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 120) = (uint8_t)s3;
+goto L40c490;
+L40be10:
+//nop;
+if (s1 != 0) goto L40be48;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(s7 + 0) = v0;
+L40be48:
+//nop;
+a0 = s0;
+//nop;
+f_def_sym(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+goto L40c490;
+L40be64:
+//nop;
+if (s1 != 0) goto L40be9c;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(s7 + 0) = v0;
+L40be9c:
+//nop;
+a0 = MEM_U32(s0 + 8);
+//nop;
+v0 = f_find_sym1(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 19) = (uint8_t)s3;
+//nop;
+a0 = 0x10;
+a1 = s3;
+v0 = f_new(mem, sp, a0, a1);
+t8 = MEM_U32(s0 + 4);
+// bdead c3fe000b gp = MEM_U32(sp + 60);
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(s0 + 8);
+v1 = 0x10004ca0;
+MEM_U32(v0 + 4) = t9;
+t0 = MEM_U16(s0 + 2);
+//nop;
+MEM_U16(v0 + 8) = (uint16_t)t0;
+t2 = MEM_U32(v1 + 0);
+//nop;
+MEM_U32(v0 + 12) = t2;
+MEM_U32(v1 + 0) = v0;
+goto L40c490;
+L40befc:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L40bf60;
+t1 = MEM_U32(v0 + 8);
+MEM_U8(v0 + 16) = (uint8_t)s3;
+t3 = MEM_U8(t1 + 0);
+//nop;
+t4 = t3 < 0x40;
+t5 = (int)t3 >> 5;
+if (t4 == 0) goto L40bf54;
+t7 = 0x100000b8;
+t6 = t5 << 2;
+t7 = t7;
+t8 = t7 + t6;
+t9 = MEM_U32(t8 + 0);
+//nop;
+t0 = t9 << (t3 & 0x1f);
+t4 = (int)t0 < (int)0x0;
+L40bf54:
+//nop;
+if (t4 == 0) goto L40bf60;
+MEM_U8(v0 + 18) = (uint8_t)s3;
+L40bf60:
+t1 = 0x10003c74;
+at = 0x2;
+t1 = MEM_U32(t1 + 0);
+//nop;
+//nop;
+if (t1 != at) goto L40c004;
+//nop;
+if (v0 == 0) goto L40c004;
+t5 = MEM_U8(s0 + 1);
+at = 0x9;
+t7 = t5 & 0x1f;
+//nop;
+if (t7 == at) goto L40c004;
+v1 = MEM_U32(v0 + 8);
+//nop;
+t6 = MEM_U16(v1 + 2);
+//nop;
+t8 = t6 >> 4;
+//nop;
+if (s3 == t8) goto L40bfec;
+t9 = MEM_U8(v1 + 0);
+//nop;
+t3 = t9 < 0x40;
+t0 = (int)t9 >> 5;
+if (t3 == 0) goto L40bfe4;
+t4 = 0x100000b8;
+t2 = t0 << 2;
+t4 = t4;
+t1 = t4 + t2;
+t5 = MEM_U32(t1 + 0);
+//nop;
+t7 = t5 << (t9 & 0x1f);
+t3 = (int)t7 < (int)0x0;
+L40bfe4:
+//nop;
+if (t3 != 0) goto L40c004;
+L40bfec:
+//nop;
+a0 = s0;
+//nop;
+f_enter_readonly_init(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+L40c004:
+v0 = MEM_U8(s0 + 1);
+at = 0x2;
+t8 = v0 & 0x1f;
+if (t8 == at) {
+at = 0xa;
+goto L40c020;}
+at = 0xa;
+//nop;
+if (t8 != at) goto L40c038;
+L40c020:
+//nop;
+a0 = MEM_U32(s0 + 24);
+//nop;
+v0 = f_find_sym1(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 19) = (uint8_t)s3;
+L40c038:
+//nop;
+if (s1 == 0) goto L40c490;
+MEM_U32(s7 + 0) = s0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+a0 = v0;
+//nop;
+//nop;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+goto L40c490;
+L40c078:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L40c0b8;
+v1 = MEM_U32(v0 + 8);
+t0 = MEM_U32(s0 + 8);
+t4 = MEM_U32(v1 + 8);
+//nop;
+//nop;
+if ((int)t4 >= (int)t0) goto L40c0b4;
+t4 = t0;
+L40c0b4:
+MEM_U32(v1 + 8) = t4;
+L40c0b8:
+//nop;
+if (s1 != 0) goto L40c490;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(s7 + 0) = v0;
+goto L40c490;
+L40c0f4:
+v0 = MEM_U8(s0 + 1);
+at = 0x4;
+t2 = v0 << 24;
+v0 = t2 >> 29;
+s2 = s2 + 0x1;
+if (v0 != at) goto L40c148;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym1(mem, sp, a0);
+v1 = MEM_U32(v0 + 8);
+// bdead c1fe001b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 17) = (uint8_t)s3;
+MEM_U32(v0 + 12) = s1;
+if (v1 == 0) goto L40c490;
+t5 = MEM_U8(v1 + 0);
+at = 0x27;
+//nop;
+if (t5 != at) goto L40c490;
+MEM_U8(s1 + 124) = (uint8_t)s3;
+goto L40c490;
+L40c148:
+at = 0x2;
+//nop;
+if (v0 != at) goto L40c490;
+//nop;
+a0 = MEM_U32(s0 + 12);
+a1 = MEM_U32(s1 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1de000b gp = MEM_U32(sp + 60);
+s4 = v0;
+if (v0 == 0) goto L40c490;
+t9 = MEM_U8(v0 + 25);
+//nop;
+//nop;
+if (t9 != 0) goto L40c490;
+s4 = zero;
+goto L40c490;
+L40c18c:
+v0 = MEM_U8(s0 + 1);
+at = 0x4;
+t7 = v0 << 24;
+v0 = t7 >> 29;
+s2 = s2 + 0x1;
+if (v0 != at) goto L40c1dc;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym1(mem, sp, a0);
+v1 = MEM_U32(v0 + 8);
+// bdead c1fe001b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 18) = (uint8_t)s3;
+if (v1 == 0) goto L40c490;
+t3 = MEM_U8(v1 + 0);
+at = 0x27;
+//nop;
+if (t3 != at) goto L40c490;
+MEM_U8(s1 + 124) = (uint8_t)s3;
+goto L40c490;
+L40c1dc:
+at = 0x2;
+//nop;
+if (v0 != at) goto L40c490;
+//nop;
+a0 = MEM_U32(s0 + 12);
+a1 = MEM_U32(s1 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1de000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L40c20c;
+MEM_U8(v0 + 25) = (uint8_t)zero;
+L40c20c:
+s4 = zero;
+goto L40c490;
+L40c214:
+v0 = MEM_U8(s0 + 1);
+at = 0x4;
+t8 = v0 << 24;
+v0 = t8 >> 29;
+s2 = s2 + 0x1;
+if (v0 != at) goto L40c264;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym1(mem, sp, a0);
+v1 = MEM_U32(v0 + 8);
+// bdead c1fe001b gp = MEM_U32(sp + 60);
+MEM_U8(v0 + 19) = (uint8_t)s3;
+if (v1 == 0) goto L40c490;
+t4 = MEM_U8(v1 + 0);
+at = 0x27;
+//nop;
+if (t4 != at) goto L40c490;
+MEM_U8(s1 + 124) = (uint8_t)s3;
+goto L40c490;
+L40c264:
+at = 0x2;
+//nop;
+if (v0 != at) goto L40c490;
+//nop;
+a0 = MEM_U32(s0 + 16);
+a1 = MEM_U32(s1 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+//nop;
+if (v0 == 0) goto L40c490;
+MEM_U8(v0 + 25) = (uint8_t)zero;
+goto L40c490;
+L40c298:
+//nop;
+if (s1 != 0) goto L40c490;
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fe000b gp = MEM_U32(sp + 60);
+MEM_U32(s7 + 0) = v0;
+goto L40c490;
+L40c2d4:
+t2 = MEM_U8(sp + 102);
+a0 = s0;
+//nop;
+if (t2 != 0) goto L40c490;
+//nop;
+a2 = MEM_U8(sp + 103);
+a1 = s1 + 0x34;
+f_add_to_parmlist(mem, sp, a0, a1, a2);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+//nop;
+goto L40c490;
+L40c300:
+t1 = 0x10003c9c;
+at = 0x10003c9c;
+t1 = MEM_U32(t1 + 0);
+//nop;
+t5 = t1 + 0x1;
+MEM_U32(at + 0) = t5;
+goto L40c490;
+L40c31c:
+v0 = 0x10003c9c;
+//nop;
+t9 = MEM_U32(v0 + 0);
+//nop;
+t7 = t9 + 0xffffffff;
+MEM_U32(v0 + 0) = t7;
+goto L40c490;
+L40c338:
+s2 = s2 + 0x2;
+goto L40c490;
+L40c340:
+s2 = s2 + 0x1;
+goto L40c490;
+L40c348:
+if (v0 < 0x66) {
+at = v0 < 0x80;
+goto L40c3ac;}
+if (v0 < 0x80) {
+at = 0x87;
+goto L40c374;}
+at = 0x87;
+if (v0 == at) {
+at = 0x8c;
+goto L40c490;}
+at = 0x8c;
+//nop;
+if (v0 == at) goto L40bde8;
+s2 = s2 + 0x1;
+goto L40c490;
+L40c374:
+at = 0x71;
+t6 = v0 + 0xffffff88;
+if (v0 == at) goto L40c078;
+//nop;
+if (t6 >= 0x8) goto L40c340;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L40bdf4;
+case 1: goto L40c490;
+case 2: goto L40c528;
+case 3: goto L40c18c;
+case 4: goto L40c340;
+case 5: goto L40c340;
+case 6: goto L40c340;
+case 7: goto L40bde8;
+}
+L40c3ac:
+if (v0 < 0x2e) {
+at = 0x39;
+goto L40c3fc;}
+at = 0x39;
+//nop;
+if (v0 == at) goto L40befc;
+t4 = v0 + 0xffffffa0;
+if (v0 >= 0x55) goto L40c464;
+t3 = v0 + 0xffffffbe;
+//nop;
+if (t3 >= 0x13) goto L40c340;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L40b8a0;
+case 1: goto L40c490;
+case 2: goto L40c300;
+case 3: goto L40c490;
+case 4: goto L40c340;
+case 5: goto L40c214;
+case 6: goto L40c340;
+case 7: goto L40bb2c;
+case 8: goto L40b8a0;
+case 9: goto L40c340;
+case 10: goto L40c31c;
+case 11: goto L40c340;
+case 12: goto L40c340;
+case 13: goto L40bab8;
+case 14: goto L40c340;
+case 15: goto L40b84c;
+case 16: goto L40c0f4;
+case 17: goto L40be10;
+case 18: goto L40c490;
+}
+L40c3fc:
+t0 = v0 + 0xffffffef;
+if (v0 >= 0x9) goto L40c438;
+t8 = v0 + 0xfffffffd;
+//nop;
+if (t8 >= 0x6) goto L40c340;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L40bdb4;
+case 1: goto L40c340;
+case 2: goto L40bddc;
+case 3: goto L40be64;
+case 4: goto L40c340;
+case 5: goto L40c490;
+}
+L40c438:
+//nop;
+if (t0 >= 0x1d) goto L40c340;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t0) {
+case 0: goto L40b8a0;
+case 1: goto L40c490;
+case 2: goto L40c490;
+case 3: goto L40be10;
+case 4: goto L40c490;
+case 5: goto L40c490;
+case 6: goto L40bcc8;
+case 7: goto L40c340;
+case 8: goto L40c340;
+case 9: goto L40c340;
+case 10: goto L40baf4;
+case 11: goto L40c340;
+case 12: goto L40c340;
+case 13: goto L40c340;
+case 14: goto L40ba6c;
+case 15: goto L40c490;
+case 16: goto L40b8e8;
+case 17: goto L40c340;
+case 18: goto L40c340;
+case 19: goto L40be10;
+case 20: goto L40c340;
+case 21: goto L40bde8;
+case 22: goto L40be10;
+case 23: goto L40c340;
+case 24: goto L40c340;
+case 25: goto L40be10;
+case 26: goto L40be10;
+case 27: goto L40bbf0;
+case 28: goto L40c338;
+}
+L40c464:
+//nop;
+if (t4 >= 0x6) goto L40c340;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L40c298;
+case 1: goto L40c340;
+case 2: goto L40c340;
+case 3: goto L40b808;
+case 4: goto L40c340;
+case 5: goto L40c2d4;
+}
+L40c490:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead c1fc000b gp = MEM_U32(sp + 60);
+s0 = v0;
+t2 = 0x10003c4c;
+//nop;
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if ((int)v0 < (int)t2) goto L40b68c;
+MEM_U32(sp + 124) = s6;
+MEM_U32(sp + 128) = s2;
+L40c4cc:
+a0 = 0x10000b30;
+a1 = 0x100016e4;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x26;
+a3 = 0x26;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40060181 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400601c1 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40060001 gp = MEM_U32(sp + 60);
+//nop;
+L40c528:
+a2 = 0x14;
+if (s1 == 0) goto L40c588;
+a0 = 0x10000b30;
+a1 = 0x100016d0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x14;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020181 gp = MEM_U32(sp + 60);
+//nop;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400201c1 gp = MEM_U32(sp + 60);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40020001 gp = MEM_U32(sp + 60);
+//nop;
+L40c588:
+//nop;
+a0 = s0;
+//nop;
+f_copy_to(mem, sp, a0);
+// bdead 20001 gp = MEM_U32(sp + 60);
+t1 = MEM_U32(s0 + 4);
+// bdead 401 ra = MEM_U32(sp + 68);
+at = 0x100054c4;
+// bdead 405 s0 = MEM_U32(sp + 28);
+// bdead 405 s1 = MEM_U32(sp + 32);
+// bdead 405 s2 = MEM_U32(sp + 36);
+// bdead 405 s3 = MEM_U32(sp + 40);
+// bdead 405 s4 = MEM_U32(sp + 44);
+// bdead 405 s5 = MEM_U32(sp + 48);
+// bdead 405 s6 = MEM_U32(sp + 52);
+// bdead 405 s7 = MEM_U32(sp + 56);
+// bdead 405 fp = MEM_U32(sp + 64);
+// bdead 405 sp = sp + 0x98;
+MEM_U32(at + 0) = t1;
+return;
+}
+
+static void f_process_parm_parm_tab(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40c5d8:
+//process_parm_parm_tab:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+a1 = 0x100054c8;
+// fdead 4000004b MEM_U32(sp + 52) = s7;
+// fdead 4000004b MEM_U32(sp + 40) = s4;
+// fdead 4000004b MEM_U32(sp + 32) = s2;
+s7 = 0x100054d0;
+a1 = MEM_U32(a1 + 0);
+// fdead 4100004b MEM_U32(sp + 60) = ra;
+// fdead 4100004b MEM_U32(sp + 56) = gp;
+// fdead 4100004b MEM_U32(sp + 48) = s6;
+// fdead 4100004b MEM_U32(sp + 44) = s5;
+// fdead 4100004b MEM_U32(sp + 36) = s3;
+// fdead 4100004b MEM_U32(sp + 28) = s1;
+// fdead 4100004b MEM_U32(sp + 24) = s0;
+s2 = 0x1;
+s4 = 0x11;
+L40c624:
+s5 = MEM_U32(s7 + 0);
+s3 = zero;
+s1 = zero;
+if ((int)s5 < 0) goto L40c798;
+s5 = s5 + 0x1;
+s6 = s5 << 2;
+s6 = s6 + s5;
+s6 = s6 << 2;
+s0 = a1 + s1;
+L40c648:
+t6 = MEM_U8(s0 + 16);
+//nop;
+//nop;
+if (t6 != 0) goto L40c78c;
+v1 = MEM_U32(s0 + 0);
+//nop;
+t7 = MEM_U8(v1 + 25);
+//nop;
+//nop;
+if (t7 != 0) goto L40c678;
+MEM_U8(s0 + 16) = (uint8_t)s2;
+goto L40c78c;
+L40c678:
+v0 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if (v0 != 0) goto L40c700;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+t8 = MEM_U32(v0 + 20);
+// bdead 43be000b gp = MEM_U32(sp + 56);
+v1 = v0;
+if (t8 != 0) goto L40c6b0;
+a0 = s2 & 0xff;
+goto L40c6ec;
+L40c6b0:
+//nop;
+a0 = MEM_U32(s0 + 8);
+a1 = MEM_U32(v1 + 52);
+//nop;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead 41be000b gp = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L40c6d8;
+a0 = s2 & 0xff;
+goto L40c6ec;
+L40c6d8:
+a0 = MEM_U8(v0 + 25);
+MEM_U32(s0 + 12) = v0;
+a0 = a0 < 0x1;
+t9 = a0 & 0xff;
+a0 = t9;
+L40c6ec:
+a1 = 0x100054c8;
+v1 = MEM_U32(s0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+goto L40c714;
+L40c700:
+a0 = MEM_U8(v0 + 25);
+//nop;
+a0 = a0 < 0x1;
+t0 = a0 & 0xff;
+a0 = t0;
+L40c714:
+//nop;
+if (a0 == 0) goto L40c72c;
+MEM_U8(v1 + 25) = (uint8_t)zero;
+MEM_U8(s0 + 16) = (uint8_t)s2;
+s3 = s2 & 0xff;
+goto L40c78c;
+L40c72c:
+t1 = MEM_U8(v1 + 26);
+v0 = MEM_U32(s0 + 12);
+//nop;
+if (s4 != t1) goto L40c75c;
+t2 = MEM_U8(v0 + 26);
+//nop;
+MEM_U8(v1 + 26) = (uint8_t)t2;
+t3 = MEM_U32(s0 + 12);
+t5 = MEM_U32(s0 + 0);
+t4 = MEM_U32(t3 + 20);
+MEM_U32(t5 + 20) = t4;
+goto L40c78c;
+L40c75c:
+t6 = MEM_U8(v0 + 26);
+//nop;
+//nop;
+if (s4 == t6) goto L40c78c;
+t7 = MEM_U32(v0 + 20);
+t8 = MEM_U32(v1 + 20);
+//nop;
+//nop;
+if (t7 == t8) goto L40c78c;
+MEM_U8(v1 + 25) = (uint8_t)zero;
+MEM_U8(s0 + 16) = (uint8_t)s2;
+s3 = s2 & 0xff;
+L40c78c:
+s1 = s1 + 0x14;
+s0 = a1 + s1;
+if (s1 != s6) goto L40c648;
+L40c798:
+//nop;
+if (s3 != 0) goto L40c624;
+//nop;
+a0 = a1;
+//nop;
+f_xfree(mem, sp, a0);
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 gp = MEM_U32(sp + 56);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void f_delete_syms(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+t8 = 0, t9 = 0;
+L40c7e0:
+//delete_syms:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000000b MEM_U32(sp + 24) = s0;
+s0 = 0x10003c54;
+t6 = 0x10003c5c;
+s0 = MEM_U32(s0 + 0);
+t6 = MEM_U32(t6 + 0);
+// fdead 4002800b MEM_U32(sp + 36) = ra;
+// fdead 4002800b MEM_U32(sp + 32) = gp;
+// fdead 4002800b MEM_U32(sp + 28) = s1;
+if (s0 == t6) goto L40caf8;
+s1 = 0xffffff0f;
+L40c818:
+v0 = MEM_U8(s0 + 0);
+at = v0 < 0x2b;
+goto L40ca6c;
+L40c824:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == 0) goto L40cac8;
+t7 = MEM_U32(v0 + 8);
+//nop;
+//nop;
+if (s0 == t7) goto L40c854;
+abort();
+L40c854:
+t8 = MEM_U8(v0 + 17);
+//nop;
+//nop;
+if (t8 != 0) goto L40c8a0;
+t9 = MEM_U8(v0 + 18);
+//nop;
+//nop;
+if (t9 != 0) goto L40c8a0;
+t0 = MEM_U8(v0 + 19);
+//nop;
+//nop;
+if (t0 != 0) goto L40c8a0;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_change_to_nops(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+s0 = v0;
+goto L40cae0;
+L40c8a0:
+t1 = MEM_U8(v0 + 18);
+//nop;
+//nop;
+if (t1 != 0) goto L40c8f4;
+t2 = MEM_U8(v0 + 19);
+//nop;
+//nop;
+if (t2 != 0) goto L40c8f4;
+v0 = MEM_U16(s0 + 2);
+//nop;
+t3 = v0 >> 4;
+//nop;
+if (t3 != 0) goto L40c8f4;
+t4 = 0x1000002c;
+t5 = MEM_U32(s0 + 8);
+t4 = MEM_U32(t4 + 0);
+t6 = v0 & s1;
+t7 = t6 | 0x10;
+if ((int)t4 >= (int)t5) goto L40c8f4;
+MEM_U16(s0 + 2) = (uint16_t)t7;
+L40c8f4:
+t8 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+if ((int)t8 < (int)0x8) goto L40cac8;
+t9 = MEM_U16(s0 + 2);
+//nop;
+v0 = t9 & s1;
+t0 = v0 | 0x2;
+if (v0 >= 0x2) goto L40cac8;
+MEM_U16(s0 + 2) = (uint16_t)t0;
+goto L40cac8;
+L40c928:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a2 = v0;
+if (v0 == 0) goto L40cac8;
+t1 = MEM_U8(v0 + 17);
+//nop;
+//nop;
+if (t1 != 0) goto L40c990;
+t2 = MEM_U8(v0 + 18);
+//nop;
+//nop;
+if (t2 != 0) goto L40c990;
+t3 = MEM_U8(v0 + 19);
+//nop;
+//nop;
+if (t3 != 0) goto L40c990;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_change_to_nops(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+s0 = v0;
+goto L40cae0;
+L40c990:
+t4 = 0x10000004;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40cac8;
+v1 = MEM_U32(v0 + 8);
+at = 0x27;
+t5 = MEM_U8(v1 + 0);
+//nop;
+//nop;
+if (t5 != at) goto L40cac8;
+t6 = MEM_U16(v1 + 2);
+at = 0x1;
+t7 = t6 >> 4;
+//nop;
+if (t7 == at) goto L40cac8;
+t8 = MEM_U8(v0 + 18);
+//nop;
+//nop;
+if (t8 != 0) goto L40cac8;
+t9 = MEM_U8(v0 + 19);
+//nop;
+//nop;
+if (t9 != 0) goto L40cac8;
+t0 = MEM_U8(s0 + 1);
+at = 0x30620000;
+t1 = t0 & 0x1f;
+t2 = t1 < 0x20;
+t3 = -t2;
+t4 = t3 & at;
+t5 = t4 << (t1 & 0x1f);
+//nop;
+if ((int)t5 < 0) goto L40cac8;
+t6 = MEM_U32(v0 + 12);
+a0 = 0x8;
+t7 = MEM_U8(t6 + 125);
+//nop;
+//nop;
+if (t7 != 0) goto L40cac8;
+//nop;
+a1 = zero;
+MEM_U32(sp + 40) = a2;
+v0 = f_new(mem, sp, a0, a1);
+a2 = MEM_U32(sp + 40);
+// bdead 4006008b gp = MEM_U32(sp + 32);
+MEM_U32(v0 + 0) = s0;
+t8 = MEM_U32(a2 + 12);
+//nop;
+t9 = MEM_U32(t8 + 112);
+//nop;
+MEM_U32(v0 + 4) = t9;
+t0 = MEM_U32(a2 + 12);
+MEM_U32(t0 + 112) = v0;
+goto L40cac8;
+L40ca6c:
+if (at != 0) {
+at = 0x39;
+goto L40ca90;}
+at = 0x39;
+//nop;
+if (v0 == at) goto L40c928;
+at = 0x53;
+//nop;
+if (v0 == at) goto L40c824;
+//nop;
+goto L40cac8;
+L40ca90:
+at = 0x14;
+t2 = v0 + 0xffffffdc;
+if (v0 == at) goto L40c824;
+//nop;
+if (t2 >= 0x7) goto L40cac8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L40c824;
+case 1: goto L40cac8;
+case 2: goto L40cac8;
+case 3: goto L40c824;
+case 4: goto L40cac8;
+case 5: goto L40cac8;
+case 6: goto L40c824;
+}
+L40cac8:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+s0 = v0;
+L40cae0:
+t3 = 0x10003c5c;
+//nop;
+t3 = MEM_U32(t3 + 0);
+//nop;
+//nop;
+if (s0 != t3) goto L40c818;
+L40caf8:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_bitcount(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0;
+L40cb8c:
+//bitcount:
+v1 = zero;
+if (a0 == 0) goto L40cba4;
+L40cb94:
+t6 = a0 + 0xffffffff;
+a0 = a0 & t6;
+v1 = v1 + 0x1;
+if (a0 != 0) goto L40cb94;
+L40cba4:
+v0 = v1;
+return v0;
+}
+
+static void f_add_feedback(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L40cbac:
+//add_feedback:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff90;
+at = 0x10004ca4;
+// fdead 4000000f MEM_U32(sp + 48) = s7;
+s7 = 0x10003c64;
+MEM_U32(at + 0) = zero;
+at = 0x10004ca8;
+s7 = MEM_U32(s7 + 0);
+MEM_U32(at + 0) = zero;
+v1 = MEM_U32(s7 + 28);
+// fdead 4100001f MEM_U32(sp + 20) = s0;
+// fdead 4100001f MEM_U32(sp + 60) = ra;
+// fdead 4100001f MEM_U32(sp + 56) = fp;
+// fdead 4100001f MEM_U32(sp + 52) = gp;
+// fdead 4100001f MEM_U32(sp + 44) = s6;
+// fdead 4100001f MEM_U32(sp + 40) = s5;
+// fdead 4100001f MEM_U32(sp + 36) = s4;
+// fdead 4100001f MEM_U32(sp + 32) = s3;
+// fdead 4100001f MEM_U32(sp + 28) = s2;
+// fdead 4100001f MEM_U32(sp + 24) = s1;
+s0 = s7 + 0x60;
+if (v1 == 0) goto L40cc8c;
+a1 = v1 & 0x3;
+a1 = -a1;
+a0 = v1;
+if (a1 == 0) goto L40cc40;
+v0 = a1 + v1;
+s4 = 0xfffffffc;
+L40cc24:
+t6 = MEM_U32(s0 + 0);
+a0 = a0 + 0xffffffff;
+t7 = t6 & s4;
+s0 = s0 + t7;
+s0 = s0 + 0x8;
+if (v0 != a0) goto L40cc24;
+if (a0 == 0) {
+s4 = 0xfffffffc;
+goto L40cc8c;}
+L40cc40:
+s4 = 0xfffffffc;
+L40cc44:
+t8 = MEM_U32(s0 + 0);
+a0 = a0 + 0xfffffffc;
+t9 = t8 & s4;
+s0 = s0 + t9;
+t0 = MEM_U32(s0 + 8);
+s0 = s0 + 0x8;
+t1 = t0 & s4;
+s0 = s0 + t1;
+t2 = MEM_U32(s0 + 8);
+s0 = s0 + 0x8;
+t3 = t2 & s4;
+s0 = s0 + t3;
+t4 = MEM_U32(s0 + 8);
+s0 = s0 + 0x8;
+t5 = t4 & s4;
+s0 = s0 + t5;
+s0 = s0 + 0x8;
+if (a0 != 0) goto L40cc44;
+L40cc8c:
+a0 = MEM_U32(s7 + 8);
+//nop;
+t6 = a0 << 2;
+s4 = 0xfffffffc;
+a0 = t6;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4122000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 68) = v0;
+if (v0 != 0) goto L40cd08;
+s3 = 0x10000b30;
+a1 = 0x100019a0;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a2 = 0x28;
+a3 = 0x28;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 41320183 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 412201c3 gp = MEM_U32(sp + 52);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41220003 gp = MEM_U32(sp + 52);
+//nop;
+L40cd08:
+v1 = MEM_U32(s7 + 8);
+s3 = 0x10000b30;
+v1 = v1 + 0x0;
+s1 = MEM_U32(sp + 68);
+s6 = v1 << 2;
+s2 = zero;
+s5 = 0xffffffff;
+L40cd24:
+//nop;
+MEM_U32(s1 + 0) = zero;
+a1 = MEM_U32(s0 + 0);
+MEM_U32(sp + 64) = v1;
+a0 = s0 + 0x4;
+v0 = f_path_blockno(mem, sp, a0, a1);
+// bdead 41fe000b gp = MEM_U32(sp + 52);
+v1 = MEM_U32(sp + 64);
+a0 = v0;
+if (v0 == s5) goto L40cd68;
+//nop;
+MEM_U32(sp + 64) = v1;
+//nop;
+v0 = f_search_procedure(mem, sp, a0);
+// bdead 41fe000b gp = MEM_U32(sp + 52);
+v1 = MEM_U32(sp + 64);
+MEM_U32(s1 + 0) = v0;
+L40cd68:
+t7 = MEM_U32(s0 + 0);
+s2 = s2 + 0x4;
+t8 = t7 & s4;
+s0 = s0 + t8;
+s0 = s0 + 0x8;
+s1 = s1 + 0x4;
+if (s2 != s6) goto L40cd24;
+v1 = MEM_U32(s7 + 4);
+s5 = s0;
+s7 = 0x6c6c0000;
+if (v1 == 0) goto L40d2f8;
+s7 = s7 | 0x6163;
+fp = 0x10000010;
+s6 = s7;
+MEM_U32(sp + 76) = v1;
+L40cda4:
+t9 = MEM_U32(s5 + 0);
+at = 0x636f0000;
+at = at | 0x7270;
+a2 = 0x45;
+if (t9 == at) goto L40ce9c;
+a1 = 0x1000195b;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a3 = 0x45;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1d00181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1d00001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x10001941;
+//nop;
+a2 = 0x1a;
+a3 = 0x1a;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1d00001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = 0x636f0000;
+a1 = a1 | 0x7270;
+a2 = 0x1;
+a3 = 0x10;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead c1d00001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x1000193b;
+//nop;
+a2 = 0x6;
+a3 = 0x6;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1d00001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(s5 + 0);
+a2 = 0x1;
+a3 = 0x10;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead c1d00181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1d001c1 gp = MEM_U32(sp + 52);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead c1d00001 gp = MEM_U32(sp + 52);
+//nop;
+L40ce9c:
+t1 = MEM_U32(s5 + 4);
+t0 = MEM_U32(sp + 68);
+t2 = t1 << 2;
+t3 = t0 + t2;
+s2 = MEM_U32(t3 + 0);
+v0 = MEM_U32(fp + 0);
+//nop;
+if (s2 == 0) goto L40cfb4;
+//nop;
+if (v0 == 0) goto L40cf30;
+//nop;
+a0 = s2;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead c1d80001 gp = MEM_U32(sp + 52);
+s0 = MEM_U32(s3 + 0);
+//nop;
+a1 = 0x20;
+a2 = 0x1;
+// bdead c1da00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead c1da0001 gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s5 + 36);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0x10;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead c1d80181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1d80001 gp = MEM_U32(sp + 52);
+//nop;
+L40cf30:
+t4 = MEM_U32(s5 + 24);
+//nop;
+MEM_U32(s2 + 32) = t4;
+t5 = MEM_U32(s5 + 16);
+//nop;
+MEM_U32(s2 + 40) = t5;
+a0 = MEM_U32(s5 + 36);
+//nop;
+v0 = f_bitcount(mem, sp, a0);
+// bdead c1d80009 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s5 + 40);
+//nop;
+s0 = v0;
+//nop;
+v0 = f_bitcount(mem, sp, a0);
+t7 = MEM_U32(s2 + 20);
+// bdead c1db0009 gp = MEM_U32(sp + 52);
+t6 = s0 + v0;
+MEM_U32(s2 + 44) = t6;
+if (t7 == 0) goto L40d030;
+t8 = 0x10004ca4;
+t9 = MEM_U32(s2 + 32);
+t8 = MEM_U32(t8 + 0);
+at = 0x10004ca4;
+t0 = 0x10004ca8;
+t1 = t8 + t9;
+MEM_U32(at + 0) = t1;
+t2 = MEM_U32(s2 + 40);
+t0 = MEM_U32(t0 + 0);
+at = 0x10004ca8;
+t3 = t0 + t2;
+MEM_U32(at + 0) = t3;
+goto L40d030;
+L40cfb4:
+a2 = 0xd;
+if (v0 == 0) goto L40d030;
+a1 = 0x1000192e;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1d80001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(s5 + 4);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead c1d80001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x10001925;
+//nop;
+a2 = 0x9;
+a3 = 0x9;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1d80181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1d80001 gp = MEM_U32(sp + 52);
+//nop;
+L40d030:
+v0 = MEM_U32(s5 + 28);
+s1 = s5 + 0x38;
+s4 = v0;
+if (v0 == 0) goto L40d2d4;
+L40d040:
+t4 = MEM_U32(s1 + 0);
+a2 = 0x45;
+a3 = 0x45;
+if (s6 == t4) goto L40d12c;
+a1 = 0x100018e0;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x100018c6;
+//nop;
+a2 = 0x1a;
+a3 = 0x1a;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = s7;
+a2 = 0x1;
+a3 = 0x10;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x100018c0;
+//nop;
+a2 = 0x6;
+a3 = 0x6;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(s1 + 0);
+a2 = 0x1;
+a3 = 0x10;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1fc01c1 gp = MEM_U32(sp + 52);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+//nop;
+L40d12c:
+t6 = MEM_U32(s1 + 4);
+t5 = MEM_U32(sp + 68);
+t7 = t6 << 2;
+t8 = t5 + t7;
+s0 = MEM_U32(t8 + 0);
+//nop;
+if (s2 == 0) goto L40d2c8;
+//nop;
+if (s0 == 0) goto L40d2c8;
+v0 = MEM_U32(s0 + 84);
+a2 = 0x19;
+a3 = 0x19;
+if (v0 == 0) goto L40d1bc;
+L40d160:
+t9 = MEM_U32(v0 + 16);
+//nop;
+//nop;
+if (s2 != t9) goto L40d1ac;
+t1 = MEM_U32(s0 + 12);
+t0 = MEM_U32(s1 + 8);
+t3 = MEM_U32(v0 + 12);
+t2 = t1 + t0;
+//nop;
+if (t2 != t3) goto L40d1ac;
+t4 = MEM_U32(s1 + 12);
+//nop;
+MEM_U32(v0 + 20) = t4;
+t6 = MEM_U32(s2 + 36);
+t5 = MEM_U32(s1 + 12);
+//nop;
+t7 = t6 + t5;
+MEM_U32(s2 + 36) = t7;
+goto L40d2c8;
+L40d1ac:
+v0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L40d160;
+L40d1bc:
+t8 = MEM_U32(fp + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L40d2c8;
+a1 = 0x100018a7;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+a0 = s0;
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x100018a0;
+//nop;
+a2 = 0x7;
+a3 = 0x7;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(s0 + 12);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+s0 = MEM_U32(s3 + 0);
+//nop;
+a1 = 0x2b;
+a2 = 0x1;
+// bdead c1fe00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead c1fe0001 gp = MEM_U32(sp + 52);
+a1 = MEM_U32(s1 + 8);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_integer(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+a1 = 0x1000189c;
+//nop;
+a2 = 0x4;
+a3 = 0x4;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+a0 = s2;
+//nop;
+//nop;
+//nop;
+f_write_procedure(mem, sp, a0);
+// bdead c1fc0181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead c1fc0001 gp = MEM_U32(sp + 52);
+//nop;
+L40d2c8:
+s4 = s4 + 0xffffffff;
+s1 = s1 + 0x10;
+if (s4 != 0) goto L40d040;
+L40d2d4:
+t9 = MEM_U32(s5 + 32);
+t0 = MEM_U32(sp + 76);
+t1 = t9 << 2;
+t1 = t1 - t9;
+t1 = t1 << 2;
+t2 = t0 + 0xffffffff;
+MEM_U32(sp + 76) = t2;
+s5 = s1 + t1;
+if (t2 != 0) goto L40cda4;
+L40d2f8:
+t3 = 0x10003c68;
+a2 = 0x41;
+t3 = MEM_U32(t3 + 0);
+a3 = 0x41;
+// bdead 40100181 ra = MEM_U32(sp + 60);
+if (s5 == t3) goto L40d360;
+a1 = 0x1000185b;
+//nop;
+a0 = MEM_U32(s3 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40100181 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 52);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 52);
+//nop;
+// bdead 1 ra = MEM_U32(sp + 60);
+L40d360:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x70;
+return;
+}
+
+static void f_rescan_for_ldas(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40d38c:
+//rescan_for_ldas:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000000b MEM_U32(sp + 20) = s0;
+s0 = 0x10003c48;
+//nop;
+s0 = MEM_U32(s0 + 0);
+// fdead 4002000b MEM_U32(sp + 60) = ra;
+// fdead 4002000b MEM_U32(sp + 56) = fp;
+// fdead 4002000b MEM_U32(sp + 52) = gp;
+// fdead 4002000b MEM_U32(sp + 48) = s7;
+// fdead 4002000b MEM_U32(sp + 44) = s6;
+// fdead 4002000b MEM_U32(sp + 40) = s5;
+// fdead 4002000b MEM_U32(sp + 36) = s4;
+// fdead 4002000b MEM_U32(sp + 32) = s3;
+// fdead 4002000b MEM_U32(sp + 28) = s2;
+// fdead 4002000b MEM_U32(sp + 24) = s1;
+a0 = s0;
+v0 = f_next_u(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+s1 = v0;
+s4 = 0x10003c4c;
+fp = 0x4;
+t6 = MEM_U32(s4 + 0);
+s7 = 0x47;
+s6 = 0x64;
+if ((int)v0 >= (int)t6) goto L40d5ec;
+s2 = MEM_U32(sp + 64);
+s5 = 0x5c;
+s3 = 0x1;
+L40d40c:
+v1 = MEM_U8(v0 + 0);
+//nop;
+//nop;
+if (s5 != v1) goto L40d518;
+//nop;
+a0 = s1;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+v1 = MEM_U8(v0 + 0);
+// bdead c1f4001b gp = MEM_U32(sp + 52);
+t7 = v1 < 0x40;
+s0 = v0;
+if (t7 == 0) goto L40d464;
+t0 = 0x100000c8;
+t8 = (int)v1 >> 5;
+t9 = t8 << 2;
+t0 = t0;
+t1 = t0 + t9;
+t2 = MEM_U32(t1 + 0);
+//nop;
+t3 = t2 << (v1 & 0x1f);
+t7 = (int)t3 < (int)0x0;
+L40d464:
+t4 = v1 < 0x40;
+if (t7 != 0) goto L40d4c0;
+L40d46c:
+//nop;
+a0 = s0;
+//nop;
+v0 = f_next_u(mem, sp, a0);
+v1 = MEM_U8(v0 + 0);
+// bdead c1f4001b gp = MEM_U32(sp + 52);
+t5 = v1 < 0x40;
+s0 = v0;
+if (t5 == 0) goto L40d4b4;
+t0 = 0x100000c8;
+t6 = (int)v1 >> 5;
+t8 = t6 << 2;
+t0 = t0;
+t9 = t0 + t8;
+t1 = MEM_U32(t9 + 0);
+//nop;
+t2 = t1 << (v1 & 0x1f);
+t5 = (int)t2 < (int)0x0;
+L40d4b4:
+//nop;
+if (t5 == 0) goto L40d46c;
+t4 = v1 < 0x40;
+L40d4c0:
+t7 = (int)v1 >> 5;
+if (t4 == 0) goto L40d4e8;
+t0 = 0x100000c0;
+t6 = t7 << 2;
+t0 = t0;
+t8 = t0 + t6;
+t9 = MEM_U32(t8 + 0);
+//nop;
+t1 = t9 << (v1 & 0x1f);
+t4 = (int)t1 < (int)0x0;
+L40d4e8:
+//nop;
+if (t4 == 0) goto L40d4f8;
+s2 = zero;
+goto L40d5c4;
+L40d4f8:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_procedure(mem, sp, a0);
+// bdead c1f4000b gp = MEM_U32(sp + 52);
+s2 = MEM_U32(v0 + 52);
+//nop;
+goto L40d5c4;
+L40d518:
+//nop;
+if (s6 != v1) goto L40d5c4;
+t3 = MEM_U8(s0 + 0);
+//nop;
+//nop;
+if (s7 != t3) goto L40d5c4;
+t5 = MEM_U8(s0 + 1);
+//nop;
+t7 = t5 << 24;
+t0 = t7 >> 29;
+//nop;
+if (fp != t0) goto L40d5c4;
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+t6 = MEM_U8(v0 + 18);
+// bdead c1fc800b gp = MEM_U32(sp + 52);
+s0 = v0;
+if (t6 != 0) goto L40d5c4;
+t8 = MEM_U8(v0 + 16);
+//nop;
+//nop;
+if (t8 == 0) goto L40d5c4;
+t9 = MEM_U32(v0 + 8);
+//nop;
+t1 = MEM_U16(t9 + 2);
+//nop;
+t2 = t1 >> 4;
+//nop;
+if (s3 == t2) goto L40d5c4;
+//nop;
+a0 = MEM_U32(s1 + 12);
+a1 = s2;
+v0 = f_find_parm(mem, sp, a0, a1);
+// bdead c1fe000b gp = MEM_U32(sp + 52);
+//nop;
+if (v0 == 0) goto L40d5c0;
+t4 = MEM_U8(v0 + 25);
+//nop;
+//nop;
+if (t4 != 0) goto L40d5c4;
+L40d5c0:
+MEM_U8(s0 + 18) = (uint8_t)s3;
+L40d5c4:
+//nop;
+s0 = s1;
+a0 = s1;
+v0 = f_next_u(mem, sp, a0);
+t3 = MEM_U32(s4 + 0);
+// bdead c1fa100b gp = MEM_U32(sp + 52);
+s1 = v0;
+if ((int)v0 < (int)t3) goto L40d40c;
+MEM_U32(sp + 64) = s2;
+L40d5ec:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void f_check_readonly_init(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, t7 = 0, s0 = 0, s1 = 0, s3 = 0, t8 = 0;
+L40d61c:
+//check_readonly_init:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000000b MEM_U32(sp + 44) = ra;
+// fdead 4000000b MEM_U32(sp + 40) = gp;
+// fdead 4000000b MEM_U32(sp + 36) = s3;
+// fdead 4000000b MEM_U32(sp + 32) = s2;
+// fdead 4000000b MEM_U32(sp + 28) = s1;
+// fdead 4000000b MEM_U32(sp + 24) = s0;
+f_rescan_for_ldas(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+//nop;
+s1 = 0x100044a0;
+//nop;
+s3 = s1 + 0x800;
+L40d660:
+s0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L40d6a8;
+L40d670:
+t7 = MEM_U32(s0 + 0);
+//nop;
+a0 = MEM_U32(t7 + 4);
+//nop;
+v0 = f_find_sym(mem, sp, a0);
+t8 = MEM_U8(v0 + 18);
+// bdead 42160003 gp = MEM_U32(sp + 40);
+//nop;
+if (t8 == 0) goto L40d698;
+MEM_U32(s0 + 0) = zero;
+L40d698:
+s0 = MEM_U32(s0 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L40d670;
+L40d6a8:
+s1 = s1 + 0x4;
+//nop;
+if (s1 != s3) goto L40d660;
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, t8 = 0, t9 = 0;
+L40d6d0:
+//main:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 40000063 MEM_U32(sp + 36) = ra;
+// fdead 40000063 MEM_U32(sp + 32) = gp;
+// fdead 40000063 MEM_U32(sp + 28) = s1;
+// fdead 40000063 MEM_U32(sp + 24) = s0;
+f_get_command_line(mem, sp);
+// bdead 40000083 gp = MEM_U32(sp + 32);
+//nop;
+s0 = 0x10003c48;
+//nop;
+a1 = 0x10003c4c;
+a0 = s0;
+f_get_ufile(mem, sp, a0, a1);
+v0 = MEM_U32(s0 + 0);
+// bdead 4000008b gp = MEM_U32(sp + 32);
+t6 = MEM_U8(v0 + 0);
+at = 0x7;
+//nop;
+if (t6 == at) goto L40d784;
+s0 = 0x10000b30;
+a1 = 0x100019c8;
+//nop;
+a0 = MEM_U32(s0 + 0);
+a2 = 0x24;
+a3 = 0x24;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020183 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000083 gp = MEM_U32(sp + 32);
+//nop;
+L40d784:
+//nop;
+a0 = 0x10003c64;
+a1 = 0x10003c68;
+//nop;
+f_get_feedback_file(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_uini(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_init_output(mem, sp);
+a2 = 0x200;
+// bdead 40000083 gp = MEM_U32(sp + 32);
+t0 = a2 & 0x3;
+a0 = zero;
+if (t0 == 0) goto L40d814;
+t7 = 0x10003ca0;
+t8 = 0x100044a0;
+a3 = zero << 2;
+a1 = t0;
+v1 = a3 + t7;
+v0 = a3 + t8;
+L40d7f4:
+a0 = a0 + 0x1;
+MEM_U32(v1 + 0) = zero;
+MEM_U32(v0 + 0) = zero;
+v1 = v1 + 0x4;
+v0 = v0 + 0x4;
+if (a1 != a0) goto L40d7f4;
+//nop;
+if (a0 == a2) goto L40d85c;
+L40d814:
+t1 = 0x100044a0;
+t9 = 0x10003ca0;
+a3 = a0 << 2;
+t2 = a2 << 2;
+a1 = t2 + t1;
+v0 = a3 + t1;
+v1 = a3 + t9;
+L40d830:
+v0 = v0 + 0x10;
+MEM_U32(v1 + 0) = zero;
+MEM_U32(v0 + -16) = zero;
+MEM_U32(v1 + 4) = zero;
+MEM_U32(v0 + -12) = zero;
+MEM_U32(v1 + 8) = zero;
+MEM_U32(v0 + -8) = zero;
+MEM_U32(v1 + 12) = zero;
+MEM_U32(v0 + -4) = zero;
+v1 = v1 + 0x10;
+if (v0 != a1) goto L40d830;
+L40d85c:
+s1 = 0x10004ca0;
+//nop;
+MEM_U32(s1 + 0) = zero;
+//nop;
+//nop;
+//nop;
+f_build_call_graph(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_process_parm_parm_tab(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_delete_syms(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_check_readonly_init(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+s0 = 0x10000000;
+//nop;
+t3 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (t3 == 0) goto L40d910;
+t4 = 0x10003c64;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L40d910;
+//nop;
+//nop;
+//nop;
+f_add_feedback(mem, sp);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+//nop;
+L40d910:
+//nop;
+//nop;
+//nop;
+f_build_postorder(mem, sp);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+//nop;
+t5 = 0x10000010;
+//nop;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L40d958;
+//nop;
+//nop;
+//nop;
+f_debug_dump(mem, sp);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+//nop;
+L40d958:
+t6 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L40d998;
+t7 = 0x100030a0;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L40d998;
+//nop;
+//nop;
+//nop;
+f_pack_knapsack(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+L40d998:
+//nop;
+//nop;
+//nop;
+f_fix_parm_offsets(mem, sp);
+// bdead 40040003 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+//nop;
+//nop;
+f_inline_pass(mem, sp);
+t8 = MEM_U32(s1 + 0);
+// bdead 42040003 gp = MEM_U32(sp + 32);
+//nop;
+if (t8 == 0) goto L40da34;
+s0 = 0x10003c5c;
+//nop;
+L40d9d8:
+//nop;
+a0 = 0x10000060;
+//nop;
+f_check_for_more_space(mem, sp, a0);
+a0 = MEM_U32(s0 + 0);
+v0 = MEM_U32(s1 + 0);
+t9 = 0x6;
+MEM_U8(a0 + 0) = (uint8_t)t9;
+t2 = MEM_U32(v0 + 0);
+// bdead 4006082b gp = MEM_U32(sp + 32);
+MEM_U32(a0 + 4) = t2;
+t1 = MEM_U32(v0 + 4);
+//nop;
+MEM_U32(a0 + 8) = t1;
+t3 = MEM_U16(v0 + 8);
+MEM_U16(a0 + 2) = (uint16_t)t3;
+v0 = f_next_u(mem, sp, a0);
+t4 = MEM_U32(s1 + 0);
+MEM_U32(s0 + 0) = v0;
+t5 = MEM_U32(t4 + 12);
+// bdead 40064003 gp = MEM_U32(sp + 32);
+MEM_U32(s1 + 0) = t5;
+if (t5 != 0) goto L40d9d8;
+L40da34:
+s0 = 0x10003c5c;
+t8 = 0x100054c4;
+a0 = MEM_U32(s0 + 0);
+t7 = 0x7a;
+MEM_U8(a0 + 0) = (uint8_t)t7;
+//nop;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(a0 + 4) = t8;
+v0 = f_next_u(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U32(s0 + 0) = v0;
+a0 = 0x10003c54;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = v0;
+f_put_ufile(mem, sp, a0, a1);
+// bdead 3 ra = MEM_U32(sp + 36);
+// bdead 3 gp = MEM_U32(sp + 32);
+// bdead 3 s0 = MEM_U32(sp + 24);
+// bdead 3 s1 = MEM_U32(sp + 28);
+// bdead 3 sp = sp + 0x28;
+v0 = zero;
+return v0;
+//nop;
+}
+
+static uint32_t f_ulen(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0;
+L40da94:
+//ulen:
+//nop;
+//nop;
+//nop;
+v0 = MEM_U8(a0 + 0);
+a2 = 0x13;
+lo = v0 * a2;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+t7 = 0x100030b0;
+at = 0x4e0000;
+t6 = lo;
+a1 = t6 + t7;
+t8 = MEM_U8(a1 + 15);
+v1 = MEM_U8(a1 + 16);
+//nop;
+if (t8 == 0) goto L40db1c;
+t9 = MEM_U8(a0 + 1);
+at = at | 0x8000;
+t0 = t9 & 0x1f;
+t1 = t0 < 0x20;
+t2 = -t1;
+t3 = t2 & at;
+t4 = t3 << (t0 & 0x1f);
+v1 = v1 + 0x2;
+if ((int)t4 < 0) goto L40daf4;
+if (a2 != v0) {
+t5 = v1 << 2;
+goto L40db1c;}
+L40daf4:
+t5 = v1 << 2;
+t6 = a0 + t5;
+t7 = MEM_U32(t6 + -8);
+//nop;
+t8 = t7 + 0x3;
+t9 = (int)t8 >> 2;
+if ((int)t8 >= 0) goto L40db18;
+at = t8 + 0x3;
+t9 = (int)at >> 2;
+L40db18:
+v1 = v1 + t9;
+L40db1c:
+v0 = v1 << 2;
+return v0;
+}
+
+static uint32_t f_next_u(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0;
+L40db24:
+//next_u:
+//nop;
+//nop;
+//nop;
+v0 = MEM_U8(a0 + 0);
+a2 = 0x13;
+lo = v0 * a2;
+hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+t7 = 0x100030b0;
+at = 0x4e0000;
+t6 = lo;
+a1 = t6 + t7;
+t8 = MEM_U8(a1 + 15);
+v1 = MEM_U8(a1 + 16);
+t2 = v1 << 2;
+if (t8 == 0) goto L40dbc0;
+t9 = MEM_U8(a0 + 1);
+at = at | 0x8000;
+t0 = t9 & 0x1f;
+t1 = t0 < 0x20;
+t2 = -t1;
+t3 = t2 & at;
+t4 = t3 << (t0 & 0x1f);
+v1 = v1 + 0x2;
+if ((int)t4 < 0) goto L40db84;
+if (a2 != v0) {
+t5 = v1 << 2;
+goto L40dbbc;}
+L40db84:
+t5 = v1 << 2;
+t6 = a0 + t5;
+t7 = MEM_U32(t6 + -8);
+//nop;
+t8 = t7 + 0x3;
+t9 = (int)t8 >> 2;
+if ((int)t8 >= 0) goto L40dba8;
+at = t8 + 0x3;
+t9 = (int)at >> 2;
+L40dba8:
+v1 = v1 + t9;
+t1 = v1 & 0x1;
+t2 = v1 << 2;
+if (t1 == 0) goto L40dbc0;
+v1 = v1 + 0x1;
+L40dbbc:
+t2 = v1 << 2;
+L40dbc0:
+v0 = a0 + t2;
+return v0;
+}
+
+static uint32_t f_powerten(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0;
+L40dbc8:
+//powerten:
+//nop;
+//nop;
+//nop;
+v0 = a0;
+if (a0 >= 0xa) goto L40dc64;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (v0) {
+case 0: goto L40dc00;
+case 1: goto L40dc08;
+case 2: goto L40dc10;
+case 3: goto L40dc18;
+case 4: goto L40dc20;
+case 5: goto L40dc28;
+case 6: goto L40dc34;
+case 7: goto L40dc40;
+case 8: goto L40dc4c;
+case 9: goto L40dc58;
+}
+L40dc00:
+v0 = 0x1;
+return v0;
+L40dc08:
+v0 = 0xa;
+return v0;
+L40dc10:
+v0 = 0x64;
+return v0;
+L40dc18:
+v0 = 0x3e8;
+return v0;
+L40dc20:
+v0 = 0x2710;
+return v0;
+L40dc28:
+v0 = 0x10000;
+v0 = v0 | 0x86a0;
+return v0;
+L40dc34:
+v0 = 0xf0000;
+v0 = v0 | 0x4240;
+return v0;
+L40dc40:
+v0 = 0x980000;
+v0 = v0 | 0x9680;
+return v0;
+L40dc4c:
+v0 = 0x5f50000;
+v0 = v0 | 0xe100;
+return v0;
+L40dc58:
+v0 = 0x3b9a0000;
+v0 = v0 | 0xca00;
+return v0;
+L40dc64:
+v0 = a0 << 2;
+v0 = v0 - a0;
+v0 = v0 << 3;
+v0 = v0 + a0;
+at = 0x3b9a0000;
+at = at | 0xca00;
+v0 = v0 << 2;
+v0 = v0 + at;
+return v0;
+//nop;
+return v0;
+}
+
+static void f_add_edge(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+union FloatReg f4 = {{0, 0}};
+L40dc90:
+//add_edge:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 60) = a3;
+v1 = MEM_U32(a0 + 84);
+s0 = a1;
+s1 = a0;
+if (v1 == 0) goto L40dcf4;
+L40dcc4:
+t6 = MEM_U32(v1 + 12);
+//nop;
+//nop;
+if (s0 != t6) goto L40dce4;
+t7 = MEM_U32(v1 + 16);
+//nop;
+// bdead 40060093 ra = MEM_U32(sp + 36);
+if (a2 == t7) goto L40ddd0;
+L40dce4:
+v1 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if (v1 != 0) goto L40dcc4;
+L40dcf4:
+v0 = 0x10003c88;
+t8 = MEM_U32(a2 + 88);
+t2 = MEM_U32(v0 + 0);
+t9 = t8 + 0x1;
+MEM_U32(a2 + 88) = t9;
+t3 = t2 + 0x1;
+t0 = MEM_U32(s1 + 92);
+MEM_U32(v0 + 0) = t3;
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(s1 + 92) = t1;
+a0 = 0x28;
+a1 = zero;
+MEM_U32(sp + 56) = a2;
+v0 = f_new(mem, sp, a0, a1);
+// bdead 204006000b gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 56);
+t4 = 0x10003c64;
+MEM_U32(v0 + 8) = s1;
+MEM_U32(v0 + 12) = s0;
+MEM_U32(v0 + 16) = a2;
+t4 = MEM_U32(t4 + 0);
+v1 = v0;
+//nop;
+if (t4 == 0) goto L40dd60;
+MEM_U32(v0 + 20) = zero;
+goto L40dd88;
+L40dd60:
+a0 = 0x10003c9c;
+//nop;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(sp + 44) = v1;
+MEM_U32(sp + 56) = a2;
+v0 = f_powerten(mem, sp, a0);
+v1 = MEM_U32(sp + 44);
+// bdead 204004001b gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 56);
+MEM_U32(v1 + 20) = v0;
+L40dd88:
+f4.w[0] = zero;
+t5 = MEM_U32(sp + 60);
+t6 = MEM_U32(sp + 64);
+MEM_U32(v1 + 24) = zero;
+MEM_U32(v1 + 28) = zero;
+MEM_U8(v1 + 36) = (uint8_t)zero;
+MEM_U32(v1 + 32) = f4.w[0];
+MEM_U8(v1 + 37) = (uint8_t)t5;
+MEM_U8(v1 + 38) = (uint8_t)t6;
+t7 = MEM_U32(a2 + 80);
+//nop;
+MEM_U32(v1 + 0) = t7;
+t8 = MEM_U32(s1 + 84);
+//nop;
+MEM_U32(v1 + 4) = t8;
+MEM_U32(s1 + 84) = v1;
+MEM_U32(a2 + 80) = v1;
+// bdead 1 ra = MEM_U32(sp + 36);
+L40ddd0:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_search_procedure(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40dde0:
+//search_procedure:
+//nop;
+//nop;
+//nop;
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = a0 * at;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)at >> 32);
+t0 = 0x100000d0;
+t6 = lo;
+t7 = t6 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+t1 = t9 + t0;
+v1 = MEM_U32(t1 + 0);
+//nop;
+v0 = zero;
+if (v1 == 0) goto L40de4c;
+L40de20:
+t2 = MEM_U32(v1 + 8);
+//nop;
+//nop;
+if (a0 != t2) goto L40de38;
+v0 = v1;
+return v0;
+L40de38:
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L40de20;
+v0 = zero;
+L40de4c:
+//nop;
+return v0;
+}
+
+static uint32_t f_find_procedure(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L40de54:
+//find_procedure:
+//nop;
+//nop;
+//nop;
+at = 0x9dd60000;
+at = at | 0x8ab5;
+lo = a0 * at;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)at >> 32);
+t0 = 0x100000d0;
+sp = sp + 0xffffffc0;
+// fdead 6400003ef MEM_U32(sp + 20) = s0;
+// fdead 6400003ef MEM_U32(sp + 28) = ra;
+// fdead 6400003ef MEM_U32(sp + 24) = gp;
+a2 = a0;
+t6 = lo;
+t7 = t6 >> 23;
+t8 = t7 & 0xffff;
+t9 = t8 << 2;
+v0 = t9 + t0;
+s0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L40ded0;
+L40dea8:
+t1 = MEM_U32(s0 + 8);
+//nop;
+//nop;
+if (a2 != t1) goto L40dec0;
+v0 = s0;
+goto L40e028;
+L40dec0:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L40dea8;
+L40ded0:
+//nop;
+a0 = 0x80;
+a1 = zero;
+MEM_U32(sp + 36) = v0;
+MEM_U32(sp + 64) = a2;
+v0 = f_new(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 64);
+t2 = 0x10000044;
+MEM_U32(v0 + 20) = zero;
+MEM_U32(v0 + 24) = zero;
+MEM_U32(v0 + 28) = zero;
+MEM_U32(v0 + 32) = zero;
+MEM_U32(v0 + 36) = zero;
+MEM_U32(v0 + 40) = zero;
+MEM_U32(v0 + 44) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 48) = zero;
+MEM_U8(v0 + 126) = (uint8_t)zero;
+MEM_U32(v0 + 52) = zero;
+MEM_U32(v0 + 56) = zero;
+MEM_U32(v0 + 88) = zero;
+MEM_U32(v0 + 92) = zero;
+MEM_U32(v0 + 96) = zero;
+MEM_U32(v0 + 100) = zero;
+MEM_U32(v0 + 80) = zero;
+MEM_U32(v0 + 84) = zero;
+MEM_U32(v0 + 60) = zero;
+MEM_U32(v0 + 64) = zero;
+MEM_U32(v0 + 68) = zero;
+MEM_U32(v0 + 72) = zero;
+MEM_U32(v0 + 76) = zero;
+MEM_U8(v0 + 122) = (uint8_t)zero;
+MEM_U8(v0 + 123) = (uint8_t)zero;
+MEM_U8(v0 + 124) = (uint8_t)zero;
+MEM_U8(v0 + 125) = (uint8_t)zero;
+MEM_U32(v0 + 112) = zero;
+MEM_U32(v0 + 116) = zero;
+MEM_U32(v0 + 8) = a2;
+t2 = MEM_U32(t2 + 0);
+s0 = v0;
+at = a2 < 0x2;
+if (t2 == 0) goto L40df88;
+//nop;
+if (a2 >= 0x2) goto L40df90;
+L40df88:
+MEM_U32(v0 + 16) = zero;
+goto L40dfb4;
+L40df90:
+//nop;
+a0 = a2;
+//nop;
+v0 = f_st_str_idn(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+MEM_U32(s0 + 16) = v0;
+if (v0 != at) goto L40dfb4;
+MEM_U32(s0 + 16) = zero;
+L40dfb4:
+//nop;
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = f_dont_inline(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U8(s0 + 120) = (uint8_t)v0;
+v1 = 0x1000000c;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = zero < v1;
+v1 = t3;
+if (t3 != 0) goto L40e000;
+//nop;
+a0 = MEM_U32(s0 + 16);
+//nop;
+v0 = f_force_inline(mem, sp, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+v1 = v0;
+L40e000:
+a0 = 0x10003c84;
+a1 = MEM_U32(sp + 36);
+t5 = MEM_U32(a0 + 0);
+t4 = MEM_U32(a1 + 0);
+t6 = t5 + 0x1;
+MEM_U8(s0 + 121) = (uint8_t)v1;
+v0 = s0;
+MEM_U32(a0 + 0) = t6;
+MEM_U32(a1 + 0) = s0;
+MEM_U32(s0 + 0) = t4;
+L40e028:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint32_t f_find_parm(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L40e038:
+//find_parm:
+v1 = a1;
+v0 = zero;
+if (a1 == 0) goto L40e08c;
+L40e044:
+a1 = MEM_U32(v1 + 4);
+//nop;
+//nop;
+if ((int)a0 < (int)a1) goto L40e074;
+t7 = MEM_U32(v1 + 8);
+t6 = a0 - a1;
+//nop;
+if ((int)t6 >= (int)t7) goto L40e074;
+v0 = 0x1;
+goto L40e07c;
+L40e074:
+v1 = MEM_U32(v1 + 12);
+//nop;
+L40e07c:
+//nop;
+if (v1 == 0) goto L40e08c;
+//nop;
+if (v0 == 0) goto L40e044;
+L40e08c:
+//nop;
+if (v0 != 0) goto L40e098;
+v1 = zero;
+L40e098:
+v0 = v1;
+return v0;
+}
+
+static void f_write_asciz(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t a2 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0;
+L40e0a0:
+//write_asciz:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+s2 = a0;
+// fdead 400801eb MEM_U32(sp + 36) = ra;
+// fdead 400801eb MEM_U32(sp + 32) = gp;
+// fdead 400801eb MEM_U32(sp + 24) = s1;
+// fdead 400801eb MEM_U32(sp + 20) = s0;
+if (a1 == 0) goto L40e10c;
+t6 = MEM_U8(a1 + 0);
+s0 = a1 + 0x1;
+// bdead 400a0001 ra = MEM_U32(sp + 36);
+if (t6 == 0) goto L40e110;
+s1 = MEM_U8(s0 + -1);
+//nop;
+L40e0e4:
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = s1;
+a2 = 0x1;
+// bdead 400a00e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+s1 = MEM_U8(s0 + 0);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+s0 = s0 + 0x1;
+if (s1 != 0) goto L40e0e4;
+L40e10c:
+// bdead 1 ra = MEM_U32(sp + 36);
+L40e110:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_write_procedure(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, s0 = 0;
+L40e124:
+//write_procedure:
+//nop;
+//nop;
+//nop;
+t6 = 0x10000010;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081ab MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400281ab MEM_U32(sp + 28) = ra;
+// fdead 400281ab MEM_U32(sp + 24) = gp;
+if (t6 != 0) goto L40e1a0;
+a1 = MEM_U32(a0 + 16);
+a2 = 0x1;
+//nop;
+if (a1 == 0) goto L40e17c;
+//nop;
+a0 = 0x10000b30;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e22c;
+L40e17c:
+a0 = 0x10000b30;
+//nop;
+a1 = MEM_U32(s0 + 8);
+a0 = MEM_U32(a0 + 0);
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40e22c;
+L40e1a0:
+a0 = 0x10000b30;
+//nop;
+a1 = MEM_U32(s0 + 8);
+a0 = MEM_U32(a0 + 0);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s0 + 16);
+// bdead 40030001 gp = MEM_U32(sp + 24);
+a2 = 0x2;
+if (t7 == 0) goto L40e228;
+a0 = 0x10000b30;
+a1 = 0x10001a18;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(s0 + 16);
+//nop;
+a0 = 0x10000b30;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = 0x29;
+a0 = 0x10000b30;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a2 = 0x1;
+// bdead 400000e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L40e228:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40e22c:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_debug_dump(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L40e238:
+//debug_dump:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000000b MEM_U32(sp + 36) = s3;
+s3 = 0x10003c70;
+// fdead 4010000b MEM_U32(sp + 44) = ra;
+s3 = MEM_U32(s3 + 0);
+// fdead 4010000b MEM_U32(sp + 40) = gp;
+// fdead 4010000b MEM_U32(sp + 32) = s2;
+// fdead 4010000b MEM_U32(sp + 28) = s1;
+// fdead 4010000b MEM_U32(sp + 24) = s0;
+if (s3 == 0) goto L40e858;
+s2 = 0x10000b30;
+//nop;
+L40e274:
+s0 = MEM_U32(s2 + 0);
+//nop;
+a1 = 0x23;
+a2 = 0x1;
+// bdead 401a00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401a0001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s3 + 8);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s3 + 16);
+// bdead 40188001 gp = MEM_U32(sp + 40);
+a2 = 0x2;
+if (t6 == 0) goto L40e314;
+a1 = 0x10001aa3;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s3 + 16);
+//nop;
+a0 = s2;
+//nop;
+f_write_asciz(mem, sp, a0, a1);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = 0x29;
+a2 = 0x1;
+// bdead 401800e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+goto L40e370;
+L40e314:
+v0 = MEM_U32(s3 + 8);
+a2 = 0xd;
+at = 0x1;
+if (v0 != 0) goto L40e348;
+a1 = 0x10001a96;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+goto L40e370;
+L40e348:
+a2 = 0x12;
+if (v0 != at) goto L40e370;
+a1 = 0x10001a84;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a3 = 0x12;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e370:
+a1 = 0x10001a77;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a2 = 0xd;
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 76);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 12);
+// bdead 40190001 gp = MEM_U32(sp + 40);
+a2 = 0xa;
+if (t7 == 0) goto L40e3f4;
+a1 = 0x10001a6d;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a3 = 0xa;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 12);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e3f4:
+t8 = MEM_U32(s3 + 20);
+a2 = 0xa;
+a3 = 0xa;
+if (t8 != 0) goto L40e420;
+a1 = 0x10001a63;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e420:
+t9 = MEM_U32(s3 + 32);
+a2 = 0x2;
+a3 = 0x2;
+if (t9 == 0) goto L40e4e4;
+a1 = 0x10001a61;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 32);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+a1 = 0x10001a54;
+//nop;
+a2 = 0xd;
+a3 = 0xd;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+a1 = 0x10001a52;
+//nop;
+a2 = 0x2;
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 44);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+a1 = 0x10001a47;
+//nop;
+a2 = 0xb;
+a3 = 0xb;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e4e4:
+t0 = MEM_U8(s3 + 122);
+a2 = 0xb;
+a3 = 0xb;
+if (t0 == 0) goto L40e510;
+a1 = 0x10001a3c;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e510:
+t1 = MEM_U8(s3 + 123);
+a2 = 0x13;
+a3 = 0x13;
+if (t1 == 0) goto L40e53c;
+a1 = 0x10001a29;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 40180181 gp = MEM_U32(sp + 40);
+//nop;
+L40e53c:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+s1 = MEM_U32(s3 + 80);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a2 = 0x5;
+if (s1 == 0) goto L40e6cc;
+a1 = 0x10001a24;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a3 = 0x5;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 88);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+a1 = 0x10001a22;
+//nop;
+a2 = 0x2;
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+s0 = MEM_U32(s2 + 0);
+//nop;
+L40e5bc:
+//nop;
+a0 = s0;
+a1 = 0x20;
+a2 = 0x1;
+// bdead 401e00e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(s1 + 8);
+//nop;
+a1 = MEM_U32(t2 + 8);
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(s1 + 12);
+// bdead 401c1101 gp = MEM_U32(sp + 40);
+a1 = 0x2f;
+if (t3 == 0) goto L40e640;
+s0 = MEM_U32(s2 + 0);
+//nop;
+a2 = 0x1;
+// bdead 401e00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s1 + 12);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0101 gp = MEM_U32(sp + 40);
+//nop;
+L40e640:
+t4 = MEM_U32(s1 + 20);
+a1 = 0x28;
+a2 = 0x1;
+if (t4 == 0) goto L40e6a4;
+s0 = MEM_U32(s2 + 0);
+//nop;
+// bdead 401e00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s1 + 20);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = 0x29;
+a2 = 0x1;
+// bdead 401c00e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401c0181 gp = MEM_U32(sp + 40);
+//nop;
+L40e6a4:
+s1 = MEM_U32(s1 + 0);
+s0 = MEM_U32(s2 + 0);
+//nop;
+if (s1 != 0) goto L40e5bc;
+//nop;
+a0 = s0;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e6cc:
+s1 = MEM_U32(s3 + 84);
+a2 = 0x6;
+a3 = 0x6;
+if (s1 == 0) goto L40e848;
+a1 = 0x10001a1c;
+//nop;
+a0 = MEM_U32(s2 + 0);
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = MEM_U32(s3 + 92);
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+a1 = 0x10001a1a;
+//nop;
+a2 = 0x2;
+a3 = 0x2;
+a1 = a1;
+f_write_string(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+s0 = MEM_U32(s2 + 0);
+//nop;
+L40e738:
+//nop;
+a0 = s0;
+a1 = 0x20;
+a2 = 0x1;
+// bdead 401e00e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+t5 = MEM_U32(s1 + 16);
+//nop;
+a1 = MEM_U32(t5 + 8);
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s1 + 12);
+// bdead 401c8101 gp = MEM_U32(sp + 40);
+a1 = 0x2f;
+if (t6 == 0) goto L40e7bc;
+s0 = MEM_U32(s2 + 0);
+//nop;
+a2 = 0x1;
+// bdead 401e00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s1 + 12);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0101 gp = MEM_U32(sp + 40);
+//nop;
+L40e7bc:
+t7 = MEM_U32(s1 + 20);
+a1 = 0x28;
+a2 = 0x1;
+if (t7 == 0) goto L40e820;
+s0 = MEM_U32(s2 + 0);
+//nop;
+// bdead 401e00c1 a3 = 0xa;
+a0 = s0;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s1 + 20);
+//nop;
+a0 = s0;
+a2 = 0x1;
+a3 = 0xa;
+f_write_cardinal(mem, sp, a0, a1, a2, a3);
+// bdead 401c0001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s2 + 0);
+//nop;
+a1 = 0x29;
+a2 = 0x1;
+// bdead 401c00e1 a3 = 0xa;
+f_write_char(mem, sp, a0, a1, a2);
+// bdead 401c0181 gp = MEM_U32(sp + 40);
+//nop;
+L40e820:
+s1 = MEM_U32(s1 + 4);
+s0 = MEM_U32(s2 + 0);
+//nop;
+if (s1 != 0) goto L40e738;
+//nop;
+a0 = s0;
+//nop;
+f_writeln(mem, sp, a0, a1, a2, a3);
+// bdead 40180001 gp = MEM_U32(sp + 40);
+//nop;
+L40e848:
+s3 = MEM_U32(s3 + 60);
+//nop;
+//nop;
+if (s3 != 0) goto L40e274;
+L40e858:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40e874(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e874:
+//nop;
+//nop;
+//nop;
+t6 = a0 << 2;
+t6 = t6 + a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+t6 = t6 << 2;
+t0 = sp + 0x4;
+t8 = 0x100030b0;
+at = MEM_U32_UNALIGNED(t0 + 0);
+t6 = t6 - a0;
+//lwr $at, 3($t0)
+t7 = t6 + 0xa;
+t9 = t7 + t8;
+STORE_U32_UNALIGNED(t9 + 0, at);
+//swr $at, 3($t9)
+MEM_U32(v0 + -4) = zero;
+MEM_U8(v0 + -5) = (uint8_t)a0;
+return;
+}
+
+static void func_40e8c4(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0) {
+uint32_t t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e8c4:
+//nop;
+//nop;
+//nop;
+MEM_U32(sp + 0) = a0;
+t8 = MEM_U8(v0 + -5);
+t6 = MEM_U32(v0 + -4);
+t9 = t8 << 2;
+t9 = t9 + t8;
+t9 = t9 << 2;
+t1 = 0x100030b0;
+t9 = t9 - t8;
+t7 = t6 + 0x1;
+t0 = t9 + t7;
+MEM_U32(v0 + -4) = t7;
+t2 = t0 + t1;
+MEM_U8(t2 + -1) = (uint8_t)a0;
+return;
+}
+
+static void f_uini(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t1 = 0,
+t2 = 0, t4 = 0, t5 = 0, t6 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40e908:
+//uini:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+t6 = 0x10001d04;
+// fdead 4000800b MEM_U32(sp + 28) = ra;
+// fdead 4000800b MEM_U32(sp + 24) = gp;
+// fdead 4000800b MEM_U32(sp + 20) = s0;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+s0 = sp + 0x30;
+a1 = MEM_U32(sp + 4);
+// fdead 4002804f t9 = t9;
+v0 = s0;
+a0 = zero;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+t9 = 0x10001d00;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+t2 = 0x10001cfc;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x90;
+t5 = 0x10001cf8;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4;
+t8 = 0x10001cf4;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+t1 = 0x10001cf0;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+t4 = 0x10001cec;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+t6 = 0x10001ce8;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+t9 = 0x10001ce4;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xf;
+t2 = 0x10001ce0;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xc;
+t5 = 0x10001cdc;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+t8 = 0x10001cd8;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+t1 = 0x10001cd4;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x10;
+t4 = 0x10001cd0;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x11;
+t6 = 0x10001ccc;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x12;
+t9 = 0x10001cc8;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+t2 = 0x10001cc4;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x15;
+t5 = 0x10001cc0;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x13;
+t8 = 0x10001cbc;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xc;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x17;
+t1 = 0x10001cb8;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x18;
+t4 = 0x10001cb4;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x19;
+t6 = 0x10001cb0;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1a;
+t9 = 0x10001cac;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1b;
+t2 = 0x10001ca8;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1c;
+t5 = 0x10001ca4;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1d;
+t8 = 0x10001ca0;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1e;
+t1 = 0x10001c9c;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1f;
+t4 = 0x10001c98;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x20;
+t6 = 0x10001c94;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+t9 = 0x10001c90;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3;
+t2 = 0x10001c8c;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x23;
+t5 = 0x10001c88;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x26;
+t8 = 0x10001c84;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x28;
+t1 = 0x10001c80;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x29;
+t4 = 0x10001c7c;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x25;
+t6 = 0x10001c78;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2d;
+t9 = 0x10001c74;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2e;
+t2 = 0x10001c70;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2f;
+t5 = 0x10001c6c;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x30;
+t8 = 0x10001c68;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x34;
+t1 = 0x10001c64;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x35;
+t4 = 0x10001c60;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x36;
+t6 = 0x10001c5c;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x38;
+t9 = 0x10001c58;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x37;
+t2 = 0x10001c54;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x39;
+t5 = 0x10001c50;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xf;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x12;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x10;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3a;
+t8 = 0x10001c4c;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3b;
+t1 = 0x10001c48;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3c;
+t4 = 0x10001c44;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3f;
+t6 = 0x10001c40;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x41;
+t9 = 0x10001c3c;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x42;
+t2 = 0x10001c38;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4a;
+t5 = 0x10001c34;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x43;
+t8 = 0x10001c30;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x46;
+t1 = 0x10001c2c;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x32;
+t4 = 0x10001c28;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xf;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x47;
+t6 = 0x10001c24;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xf;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x49;
+t9 = 0x10001c20;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4b;
+t2 = 0x10001c1c;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x48;
+t5 = 0x10001c18;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4d;
+t8 = 0x10001c14;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4e;
+t1 = 0x10001c10;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4f;
+t4 = 0x10001c0c;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x51;
+t6 = 0x10001c08;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x52;
+t9 = 0x10001c04;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x56;
+t2 = 0x10001c00;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x55;
+t5 = 0x10001bfc;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x57;
+t8 = 0x10001bf8;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x69;
+t1 = 0x10001bf4;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x58;
+t4 = 0x10001bf0;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5b;
+t6 = 0x10001bec;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5c;
+t9 = 0x10001be8;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8f;
+t2 = 0x10001be4;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5d;
+t5 = 0x10001be0;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5e;
+t8 = 0x10001bdc;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5f;
+t1 = 0x10001bd8;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x60;
+t4 = 0x10001bd4;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x61;
+t6 = 0x10001bd0;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x62;
+t9 = 0x10001bcc;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8e;
+t2 = 0x10001bc8;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x63;
+t5 = 0x10001bc4;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x64;
+t8 = 0x10001bc0;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x65;
+t1 = 0x10001bbc;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x67;
+t4 = 0x10001bb8;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x68;
+t6 = 0x10001bb4;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6a;
+t9 = 0x10001bb0;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6b;
+t2 = 0x10001bac;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6c;
+t5 = 0x10001ba8;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6d;
+t8 = 0x10001ba4;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6e;
+t1 = 0x10001ba0;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6f;
+t4 = 0x10001b9c;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x70;
+t6 = 0x10001b98;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x71;
+t9 = 0x10001b94;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6;
+t2 = 0x10001b90;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2b;
+t5 = 0x10001b8c;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x72;
+t8 = 0x10001b88;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x76;
+t1 = 0x10001b84;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x77;
+t4 = 0x10001b80;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x79;
+t6 = 0x10001b7c;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7a;
+t9 = 0x10001b78;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7b;
+t2 = 0x10001b74;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7c;
+t5 = 0x10001b70;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7d;
+t8 = 0x10001b6c;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7e;
+t1 = 0x10001b68;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7f;
+t4 = 0x10001b64;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x86;
+t6 = 0x10001b60;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x6;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x88;
+t9 = 0x10001b5c;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8a;
+t2 = 0x10001b58;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8c;
+t5 = 0x10001b54;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x11;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x14;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x15;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8d;
+t8 = 0x10001b50;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x14;
+t1 = 0x10001b4c;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x24;
+t4 = 0x10001b48;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x27;
+t6 = 0x10001b44;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2a;
+t9 = 0x10001b40;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x53;
+t2 = 0x10001b3c;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x73;
+t5 = 0x10001b38;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x74;
+t8 = 0x10001b34;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x50;
+t1 = 0x10001b30;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2c;
+t4 = 0x10001b2c;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3d;
+t6 = 0x10001b28;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x3e;
+t9 = 0x10001b24;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x66;
+t2 = 0x10001b20;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5a;
+t5 = 0x10001b1c;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x89;
+t8 = 0x10001b18;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x13;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8b;
+t1 = 0x10001b14;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x31;
+t4 = 0x10001b10;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+t6 = 0x10001b0c;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+t9 = 0x10001b08;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x80;
+t2 = 0x10001b04;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x85;
+t5 = 0x10001b00;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x84;
+t8 = 0x10001afc;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x82;
+t1 = 0x10001af8;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x81;
+t4 = 0x10001af4;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x83;
+t6 = 0x10001af0;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x87;
+t9 = 0x10001aec;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x45;
+t2 = 0x10001ae8;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xe;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x44;
+t5 = 0x10001ae4;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x54;
+t8 = 0x10001ae0;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x4c;
+t1 = 0x10001adc;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x78;
+t4 = 0x10001ad8;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xb;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x75;
+t6 = 0x10001ad4;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x91;
+t9 = 0x10001ad0;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x92;
+t2 = 0x10001acc;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x93;
+t5 = 0x10001ac8;
+//nop;
+t5 = t5;
+at = MEM_U32_UNALIGNED(t5 + 0);
+//lwr $at, 3($t5)
+// fdead 6002402f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x94;
+t8 = 0x10001ac4;
+//nop;
+t8 = t8;
+at = MEM_U32_UNALIGNED(t8 + 0);
+//lwr $at, 3($t8)
+// fdead 6202002f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x95;
+t1 = 0x10001ac0;
+//nop;
+t1 = t1;
+at = MEM_U32_UNALIGNED(t1 + 0);
+//lwr $at, 3($t1)
+// fdead 6002042f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x97;
+t4 = 0x10001abc;
+//nop;
+t4 = t4;
+at = MEM_U32_UNALIGNED(t4 + 0);
+//lwr $at, 3($t4)
+// fdead 6002202f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x7;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x8;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x9;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x96;
+t6 = 0x10001ab8;
+//nop;
+t6 = t6;
+at = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $at, 3($t6)
+// fdead 6002802f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x98;
+t9 = 0x10001ab4;
+v0 = s0;
+t9 = t9;
+at = MEM_U32_UNALIGNED(t9 + 0);
+//lwr $at, 3($t9)
+//nop;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+// bdead 4002006b t9 = t9;
+//nop;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xa;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x99;
+t2 = 0x10001ab0;
+//nop;
+t2 = t2;
+at = MEM_U32_UNALIGNED(t2 + 0);
+//lwr $at, 3($t2)
+// fdead 6002082f t9 = t9;
+STORE_U32_UNALIGNED(sp + 4, at);
+//swr $at, 7($sp)
+a1 = MEM_U32(sp + 4);
+v0 = s0;
+func_40e874(mem, sp, v0, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x5;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0xd;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = 0x16;
+//nop;
+v0 = s0;
+// fdead 6002002f t9 = t9;
+//nop;
+func_40e8c4(mem, sp, v0, a0);
+// bdead 3 gp = MEM_U32(sp + 24);
+a1 = 0x2;
+v0 = 0x100030b0;
+//nop;
+v1 = v0 + 0xb94;
+L414040:
+v0 = v0 + 0x4c;
+MEM_U8(v0 + -62) = (uint8_t)zero;
+MEM_U8(v0 + -61) = (uint8_t)zero;
+MEM_U8(v0 + -60) = (uint8_t)a1;
+MEM_U8(v0 + -59) = (uint8_t)zero;
+MEM_U8(v0 + -58) = (uint8_t)zero;
+MEM_U8(v0 + -43) = (uint8_t)zero;
+MEM_U8(v0 + -42) = (uint8_t)zero;
+MEM_U8(v0 + -41) = (uint8_t)a1;
+MEM_U8(v0 + -40) = (uint8_t)zero;
+MEM_U8(v0 + -39) = (uint8_t)zero;
+MEM_U8(v0 + -24) = (uint8_t)zero;
+MEM_U8(v0 + -23) = (uint8_t)zero;
+MEM_U8(v0 + -22) = (uint8_t)a1;
+MEM_U8(v0 + -21) = (uint8_t)zero;
+MEM_U8(v0 + -20) = (uint8_t)zero;
+MEM_U8(v0 + -5) = (uint8_t)zero;
+MEM_U8(v0 + -4) = (uint8_t)zero;
+MEM_U8(v0 + -3) = (uint8_t)a1;
+MEM_U8(v0 + -2) = (uint8_t)zero;
+MEM_U8(v0 + -1) = (uint8_t)zero;
+if (v0 != v1) goto L414040;
+v0 = 0x100030b0;
+v1 = 0x1;
+a0 = 0x4;
+a2 = 0x6;
+a3 = 0x3;
+t5 = 0x8;
+MEM_U8(v0 + 1572) = (uint8_t)v1;
+MEM_U8(v0 + 2351) = (uint8_t)v1;
+MEM_U8(v0 + 1040) = (uint8_t)v1;
+MEM_U8(v0 + 1211) = (uint8_t)v1;
+MEM_U8(v0 + 2769) = (uint8_t)v1;
+MEM_U8(v0 + 2788) = (uint8_t)v1;
+MEM_U8(v0 + 2807) = (uint8_t)v1;
+MEM_U8(v0 + 2826) = (uint8_t)v1;
+MEM_U8(v0 + 1686) = (uint8_t)v1;
+MEM_U8(v0 + 14) = (uint8_t)v1;
+MEM_U8(v0 + 1800) = (uint8_t)v1;
+MEM_U8(v0 + 2256) = (uint8_t)v1;
+MEM_U8(v0 + 280) = (uint8_t)v1;
+MEM_U8(v0 + 299) = (uint8_t)v1;
+MEM_U8(v0 + 1534) = (uint8_t)v1;
+MEM_U8(v0 + 1857) = (uint8_t)v1;
+MEM_U8(v0 + 1876) = (uint8_t)v1;
+MEM_U8(v0 + 2275) = (uint8_t)v1;
+MEM_U8(v0 + 489) = (uint8_t)v1;
+MEM_U8(v0 + 508) = (uint8_t)v1;
+MEM_U8(v0 + 1059) = (uint8_t)v1;
+MEM_U8(v0 + 242) = (uint8_t)v1;
+MEM_U8(v0 + 261) = (uint8_t)v1;
+MEM_U8(v0 + 2180) = (uint8_t)v1;
+MEM_U8(v0 + 470) = (uint8_t)v1;
+MEM_U8(v0 + 2104) = (uint8_t)v1;
+MEM_U8(v0 + 52) = (uint8_t)v1;
+MEM_U8(v0 + 33) = (uint8_t)v1;
+MEM_U8(v0 + 565) = (uint8_t)v1;
+MEM_U8(v0 + 1667) = (uint8_t)v1;
+MEM_U8(v0 + 1743) = (uint8_t)v1;
+MEM_U8(v0 + 2389) = (uint8_t)v1;
+MEM_U8(v0 + 2009) = (uint8_t)v1;
+MEM_U8(v0 + 90) = (uint8_t)v1;
+MEM_U8(v0 + 679) = (uint8_t)v1;
+MEM_U8(v0 + 774) = (uint8_t)v1;
+MEM_U8(v0 + 793) = (uint8_t)v1;
+MEM_U8(v0 + 1154) = (uint8_t)v1;
+MEM_U8(v0 + 1477) = (uint8_t)v1;
+MEM_U8(v0 + 1496) = (uint8_t)v1;
+MEM_U8(v0 + 1629) = (uint8_t)v1;
+MEM_U8(v0 + 1648) = (uint8_t)v1;
+MEM_U8(v0 + 1819) = (uint8_t)v1;
+MEM_U8(v0 + 2199) = (uint8_t)v1;
+MEM_U8(v0 + 2218) = (uint8_t)v1;
+MEM_U8(v0 + 2693) = (uint8_t)v1;
+MEM_U8(v0 + 1249) = (uint8_t)v1;
+MEM_U8(v0 + 1135) = (uint8_t)v1;
+MEM_U8(v0 + 546) = (uint8_t)v1;
+MEM_U8(v0 + 1781) = (uint8_t)v1;
+MEM_U8(v0 + 2636) = (uint8_t)v1;
+MEM_U8(v0 + 1116) = (uint8_t)v1;
+MEM_U8(v0 + 888) = (uint8_t)v1;
+MEM_U8(v0 + 926) = (uint8_t)v1;
+MEM_U8(v0 + 907) = (uint8_t)v1;
+MEM_U8(v0 + 1002) = (uint8_t)v1;
+MEM_U8(v0 + 1021) = (uint8_t)v1;
+MEM_U8(v0 + 1078) = (uint8_t)v1;
+MEM_U8(v0 + 2237) = (uint8_t)v1;
+MEM_U8(v0 + 1173) = (uint8_t)v1;
+MEM_U8(v0 + 1192) = (uint8_t)v1;
+MEM_U8(v0 + 319) = (uint8_t)v1;
+MEM_U8(v0 + 376) = (uint8_t)v1;
+MEM_U8(v0 + 1098) = (uint8_t)v1;
+MEM_U8(v0 + 1345) = (uint8_t)v1;
+MEM_U8(v0 + 1402) = (uint8_t)v1;
+MEM_U8(v0 + 2067) = (uint8_t)v1;
+MEM_U8(v0 + 2295) = (uint8_t)v1;
+MEM_U8(v0 + 54) = (uint8_t)a0;
+MEM_U8(v0 + 149) = (uint8_t)a0;
+MEM_U8(v0 + 168) = (uint8_t)a1;
+MEM_U8(v0 + 244) = (uint8_t)a1;
+MEM_U8(v0 + 263) = (uint8_t)a1;
+MEM_U8(v0 + 320) = (uint8_t)a0;
+MEM_U8(v0 + 339) = (uint8_t)a0;
+MEM_U8(v0 + 358) = (uint8_t)a1;
+MEM_U8(v0 + 434) = (uint8_t)a1;
+MEM_U8(v0 + 415) = (uint8_t)a0;
+MEM_U8(v0 + 377) = (uint8_t)a0;
+MEM_U8(v0 + 453) = (uint8_t)a0;
+MEM_U8(v0 + 472) = (uint8_t)a0;
+MEM_U8(v0 + 491) = (uint8_t)a1;
+MEM_U8(v0 + 510) = (uint8_t)a1;
+MEM_U8(v0 + 1061) = (uint8_t)a1;
+MEM_U8(v0 + 529) = (uint8_t)a0;
+MEM_U8(v0 + 548) = (uint8_t)a0;
+MEM_U8(v0 + 1137) = (uint8_t)a0;
+MEM_U8(v0 + 2638) = (uint8_t)a0;
+MEM_U8(v0 + 605) = (uint8_t)a1;
+MEM_U8(v0 + 624) = (uint8_t)a1;
+MEM_U8(v0 + 643) = (uint8_t)a0;
+MEM_U8(v0 + 73) = (uint8_t)a0;
+MEM_U8(v0 + 890) = (uint8_t)a0;
+MEM_U8(v0 + 909) = (uint8_t)a0;
+MEM_U8(v0 + 928) = (uint8_t)a0;
+MEM_U8(v0 + 1004) = (uint8_t)a0;
+MEM_U8(v0 + 1023) = (uint8_t)a0;
+MEM_U8(v0 + 1080) = (uint8_t)a0;
+MEM_U8(v0 + 738) = (uint8_t)a1;
+MEM_U8(v0 + 2429) = (uint8_t)a1;
+MEM_U8(v0 + 2600) = (uint8_t)a1;
+MEM_U8(v0 + 719) = (uint8_t)a0;
+MEM_U8(v0 + 985) = (uint8_t)a0;
+MEM_U8(v0 + 1042) = (uint8_t)a0;
+MEM_U8(v0 + 1099) = (uint8_t)a2;
+MEM_U8(v0 + 1118) = (uint8_t)a0;
+MEM_U8(v0 + 1232) = (uint8_t)a0;
+MEM_U8(v0 + 1213) = (uint8_t)a0;
+MEM_U8(v0 + 1251) = (uint8_t)a1;
+MEM_U8(v0 + 1270) = (uint8_t)a0;
+MEM_U8(v0 + 1422) = (uint8_t)a0;
+MEM_U8(v0 + 1346) = (uint8_t)a0;
+MEM_U8(v0 + 966) = (uint8_t)a2;
+MEM_U8(v0 + 1327) = (uint8_t)a1;
+MEM_U8(v0 + 1365) = (uint8_t)a2;
+MEM_U8(v0 + 1403) = (uint8_t)a0;
+MEM_U8(v0 + 1517) = (uint8_t)a1;
+MEM_U8(v0 + 1555) = (uint8_t)a1;
+MEM_U8(v0 + 1574) = (uint8_t)a0;
+MEM_U8(v0 + 1688) = (uint8_t)a0;
+MEM_U8(v0 + 1783) = (uint8_t)a0;
+MEM_U8(v0 + 1897) = (uint8_t)a0;
+MEM_U8(v0 + 1916) = (uint8_t)a0;
+MEM_U8(v0 + 1935) = (uint8_t)a0;
+MEM_U8(v0 + 1992) = (uint8_t)a0;
+MEM_U8(v0 + 2049) = (uint8_t)a0;
+MEM_U8(v0 + 2068) = (uint8_t)a0;
+MEM_U8(v0 + 2087) = (uint8_t)a0;
+MEM_U8(v0 + 2106) = (uint8_t)a0;
+MEM_U8(v0 + 2125) = (uint8_t)a0;
+MEM_U8(v0 + 2144) = (uint8_t)a0;
+MEM_U8(v0 + 2163) = (uint8_t)a0;
+MEM_U8(v0 + 130) = (uint8_t)a0;
+MEM_U8(v0 + 833) = (uint8_t)a0;
+MEM_U8(v0 + 2182) = (uint8_t)a0;
+MEM_U8(v0 + 2315) = (uint8_t)a1;
+MEM_U8(v0 + 2334) = (uint8_t)a1;
+MEM_U8(v0 + 2353) = (uint8_t)a0;
+MEM_U8(v0 + 2410) = (uint8_t)a0;
+MEM_U8(v0 + 2676) = (uint8_t)t5;
+MEM_U8(v0 + 396) = (uint8_t)a0;
+MEM_U8(v0 + 700) = (uint8_t)a0;
+MEM_U8(v0 + 757) = (uint8_t)a0;
+MEM_U8(v0 + 814) = (uint8_t)a0;
+MEM_U8(v0 + 1593) = (uint8_t)a0;
+MEM_U8(v0 + 852) = (uint8_t)a0;
+MEM_U8(v0 + 1175) = (uint8_t)a0;
+MEM_U8(v0 + 1194) = (uint8_t)a0;
+MEM_U8(v0 + 1954) = (uint8_t)a0;
+MEM_U8(v0 + 1726) = (uint8_t)a0;
+MEM_U8(v0 + 2619) = (uint8_t)a1;
+MEM_U8(v0 + 2657) = (uint8_t)a0;
+MEM_U8(v0 + 2448) = (uint8_t)a1;
+MEM_U8(v0 + 2543) = (uint8_t)a1;
+MEM_U8(v0 + 2524) = (uint8_t)a1;
+MEM_U8(v0 + 2486) = (uint8_t)a1;
+MEM_U8(v0 + 2467) = (uint8_t)a1;
+MEM_U8(v0 + 2505) = (uint8_t)a1;
+MEM_U8(v0 + 2562) = (uint8_t)a0;
+MEM_U8(v0 + 2296) = (uint8_t)a0;
+MEM_U8(v0 + 2885) = (uint8_t)a0;
+MEM_U8(v0 + 2847) = (uint8_t)a0;
+MEM_U8(v0 + 2866) = (uint8_t)a0;
+MEM_U8(v0 + 2904) = (uint8_t)a0;
+MEM_U8(v0 + 2923) = (uint8_t)a0;
+MEM_U8(v0 + 2771) = (uint8_t)a0;
+MEM_U8(v0 + 2790) = (uint8_t)a0;
+MEM_U8(v0 + 2809) = (uint8_t)a0;
+MEM_U8(v0 + 2828) = (uint8_t)a0;
+MEM_U8(v0 + 2354) = (uint8_t)v1;
+MEM_U8(v0 + 283) = (uint8_t)v1;
+MEM_U8(v0 + 302) = (uint8_t)v1;
+MEM_U8(v0 + 17) = (uint8_t)v1;
+MEM_U8(v0 + 188) = (uint8_t)a1;
+MEM_U8(v0 + 1803) = (uint8_t)v1;
+MEM_U8(v0 + 2259) = (uint8_t)v1;
+MEM_U8(v0 + 1537) = (uint8_t)v1;
+MEM_U8(v0 + 1860) = (uint8_t)v1;
+MEM_U8(v0 + 1879) = (uint8_t)v1;
+MEM_U8(v0 + 2278) = (uint8_t)v1;
+MEM_U8(v0 + 492) = (uint8_t)v1;
+MEM_U8(v0 + 511) = (uint8_t)v1;
+MEM_U8(v0 + 1062) = (uint8_t)v1;
+MEM_U8(v0 + 245) = (uint8_t)v1;
+MEM_U8(v0 + 264) = (uint8_t)v1;
+MEM_U8(v0 + 2183) = (uint8_t)v1;
+MEM_U8(v0 + 473) = (uint8_t)v1;
+MEM_U8(v0 + 2563) = (uint8_t)v1;
+MEM_U8(v0 + 2107) = (uint8_t)v1;
+MEM_U8(v0 + 55) = (uint8_t)v1;
+MEM_U8(v0 + 967) = (uint8_t)v1;
+MEM_U8(v0 + 1290) = (uint8_t)v1;
+MEM_U8(v0 + 2582) = (uint8_t)v1;
+MEM_U8(v0 + 36) = (uint8_t)a1;
+MEM_U8(v0 + 568) = (uint8_t)a1;
+MEM_U8(v0 + 1670) = (uint8_t)a1;
+MEM_U8(v0 + 1746) = (uint8_t)a1;
+MEM_U8(v0 + 2392) = (uint8_t)a1;
+MEM_U8(v0 + 2012) = (uint8_t)a1;
+MEM_U8(v0 + 93) = (uint8_t)a1;
+MEM_U8(v0 + 682) = (uint8_t)a1;
+MEM_U8(v0 + 777) = (uint8_t)a1;
+MEM_U8(v0 + 796) = (uint8_t)a1;
+MEM_U8(v0 + 1157) = (uint8_t)a1;
+MEM_U8(v0 + 1480) = (uint8_t)a1;
+MEM_U8(v0 + 1499) = (uint8_t)a1;
+MEM_U8(v0 + 1632) = (uint8_t)a1;
+MEM_U8(v0 + 1651) = (uint8_t)a1;
+MEM_U8(v0 + 1822) = (uint8_t)a1;
+MEM_U8(v0 + 2202) = (uint8_t)a1;
+MEM_U8(v0 + 2221) = (uint8_t)a1;
+MEM_U8(v0 + 2696) = (uint8_t)a1;
+MEM_U8(v0 + 1252) = (uint8_t)a1;
+MEM_U8(v0 + 872) = (uint8_t)a3;
+MEM_U8(v0 + 1138) = (uint8_t)a1;
+MEM_U8(v0 + 549) = (uint8_t)a1;
+MEM_U8(v0 + 1784) = (uint8_t)a1;
+MEM_U8(v0 + 2639) = (uint8_t)a1;
+MEM_U8(v0 + 1119) = (uint8_t)a1;
+MEM_U8(v0 + 1043) = (uint8_t)v1;
+MEM_U8(v0 + 1214) = (uint8_t)a1;
+MEM_U8(v0 + 2772) = (uint8_t)a1;
+MEM_U8(v0 + 2791) = (uint8_t)a3;
+MEM_U8(v0 + 2810) = (uint8_t)v1;
+MEM_U8(v0 + 2829) = (uint8_t)a1;
+MEM_U8(v0 + 1176) = (uint8_t)v1;
+MEM_U8(v0 + 1195) = (uint8_t)a1;
+MEM_U8(v0 + 1689) = (uint8_t)a1;
+MEM_U8(v0 + 720) = (uint8_t)a1;
+MEM_U8(v0 + 891) = (uint8_t)a1;
+MEM_U8(v0 + 910) = (uint8_t)a1;
+MEM_U8(v0 + 929) = (uint8_t)a1;
+MEM_U8(v0 + 1005) = (uint8_t)a1;
+MEM_U8(v0 + 1024) = (uint8_t)a1;
+MEM_U8(v0 + 1081) = (uint8_t)a1;
+MEM_U8(v0 + 739) = (uint8_t)v1;
+MEM_U8(v0 + 2430) = (uint8_t)v1;
+MEM_U8(v0 + 948) = (uint8_t)v1;
+MEM_U8(v0 + 2677) = (uint8_t)v1;
+MEM_U8(v0 + 853) = (uint8_t)v1;
+MEM_U8(v0 + 1917) = (uint8_t)v1;
+MEM_U8(v0 + 2715) = (uint8_t)v1;
+MEM_U8(v0 + 1955) = (uint8_t)v1;
+MEM_U8(v0 + 1727) = (uint8_t)v1;
+MEM_U8(v0 + 2449) = (uint8_t)a1;
+MEM_U8(v0 + 2468) = (uint8_t)a1;
+MEM_U8(v0 + 2487) = (uint8_t)a1;
+MEM_U8(v0 + 2506) = (uint8_t)a1;
+MEM_U8(v0 + 2525) = (uint8_t)a1;
+MEM_U8(v0 + 2544) = (uint8_t)a1;
+MEM_U8(v0 + 1974) = (uint8_t)v1;
+MEM_U8(v0 + 2411) = (uint8_t)v1;
+MEM_U8(v0 + 112) = (uint8_t)v1;
+MEM_U8(v0 + 2373) = (uint8_t)v1;
+MEM_U8(v0 + 2240) = (uint8_t)a1;
+MEM_U8(v0 + 1576) = (uint8_t)v1;
+MEM_U8(v0 + 1405) = (uint8_t)v1;
+MEM_U8(v0 + 2849) = (uint8_t)v1;
+MEM_U8(v0 + 1348) = (uint8_t)v1;
+MEM_U8(v0 + 1367) = (uint8_t)v1;
+MEM_U8(v0 + 284) = (uint8_t)v1;
+MEM_U8(v0 + 18) = (uint8_t)v1;
+MEM_U8(v0 + 189) = (uint8_t)v1;
+MEM_U8(v0 + 1804) = (uint8_t)v1;
+MEM_U8(v0 + 2260) = (uint8_t)v1;
+MEM_U8(v0 + 1538) = (uint8_t)v1;
+MEM_U8(v0 + 1861) = (uint8_t)v1;
+MEM_U8(v0 + 1880) = (uint8_t)v1;
+MEM_U8(v0 + 2279) = (uint8_t)v1;
+MEM_U8(v0 + 493) = (uint8_t)v1;
+MEM_U8(v0 + 512) = (uint8_t)v1;
+MEM_U8(v0 + 1063) = (uint8_t)v1;
+MEM_U8(v0 + 246) = (uint8_t)v1;
+MEM_U8(v0 + 265) = (uint8_t)v1;
+MEM_U8(v0 + 2184) = (uint8_t)v1;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+MEM_U8(v0 + 474) = (uint8_t)v1;
+MEM_U8(v0 + 2564) = (uint8_t)v1;
+MEM_U8(v0 + 2108) = (uint8_t)v1;
+MEM_U8(v0 + 56) = (uint8_t)v1;
+MEM_U8(v0 + 968) = (uint8_t)v1;
+MEM_U8(v0 + 1291) = (uint8_t)v1;
+MEM_U8(v0 + 2583) = (uint8_t)v1;
+MEM_U8(v0 + 37) = (uint8_t)v1;
+MEM_U8(v0 + 569) = (uint8_t)v1;
+MEM_U8(v0 + 1671) = (uint8_t)v1;
+MEM_U8(v0 + 1747) = (uint8_t)v1;
+MEM_U8(v0 + 2393) = (uint8_t)v1;
+MEM_U8(v0 + 2013) = (uint8_t)v1;
+MEM_U8(v0 + 94) = (uint8_t)v1;
+MEM_U8(v0 + 683) = (uint8_t)v1;
+MEM_U8(v0 + 778) = (uint8_t)v1;
+MEM_U8(v0 + 797) = (uint8_t)v1;
+MEM_U8(v0 + 1158) = (uint8_t)v1;
+MEM_U8(v0 + 1481) = (uint8_t)v1;
+MEM_U8(v0 + 1500) = (uint8_t)v1;
+MEM_U8(v0 + 1633) = (uint8_t)v1;
+MEM_U8(v0 + 1652) = (uint8_t)v1;
+MEM_U8(v0 + 1823) = (uint8_t)v1;
+MEM_U8(v0 + 2203) = (uint8_t)v1;
+MEM_U8(v0 + 2222) = (uint8_t)v1;
+MEM_U8(v0 + 2697) = (uint8_t)v1;
+MEM_U8(v0 + 1253) = (uint8_t)v1;
+MEM_U8(v0 + 873) = (uint8_t)v1;
+MEM_U8(v0 + 1139) = (uint8_t)v1;
+MEM_U8(v0 + 550) = (uint8_t)v1;
+MEM_U8(v0 + 1785) = (uint8_t)v1;
+MEM_U8(v0 + 2640) = (uint8_t)v1;
+MEM_U8(v0 + 1120) = (uint8_t)v1;
+MEM_U8(v0 + 1044) = (uint8_t)v1;
+MEM_U8(v0 + 2773) = (uint8_t)v1;
+MEM_U8(v0 + 2811) = (uint8_t)v1;
+MEM_U8(v0 + 1177) = (uint8_t)v1;
+MEM_U8(v0 + 892) = (uint8_t)v1;
+MEM_U8(v0 + 911) = (uint8_t)v1;
+MEM_U8(v0 + 930) = (uint8_t)v1;
+MEM_U8(v0 + 1006) = (uint8_t)v1;
+MEM_U8(v0 + 1025) = (uint8_t)v1;
+MEM_U8(v0 + 1082) = (uint8_t)v1;
+MEM_U8(v0 + 588) = (uint8_t)v1;
+MEM_U8(v0 + 2412) = (uint8_t)v1;
+MEM_U8(v0 + 1443) = (uint8_t)v1;
+MEM_U8(v0 + 1386) = (uint8_t)v1;
+MEM_U8(v0 + 2241) = (uint8_t)v1;
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_st_readbinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, a3 = 0, t6 = 0;
+L414674:
+//st_readbinary:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 52) = a1;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+a1 = zero;
+a2 = zero;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a0 = v0;
+if ((int)v0 >= 0) goto L4146b4;
+v0 = 0xfffffffe;
+goto L4146f8;
+L4146b4:
+//nop;
+a1 = MEM_S8(sp + 55);
+t6 = 0xffffffff;
+MEM_U32(sp + 16) = t6;
+a2 = zero;
+a3 = zero;
+MEM_U32(sp + 44) = a0;
+v0 = f_st_readst(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 44);
+//nop;
+MEM_U32(sp + 40) = v0;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(sp + 40);
+//nop;
+L4146f8:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_readst(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0, ra = 0;
+L414708:
+//st_readst:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffee0;
+t6 = a1 << 24;
+t7 = (int)t6 >> 24;
+// fdead 400181eb MEM_U32(sp + 32) = s0;
+at = 0x72;
+s0 = a3;
+// fdead 400381ef MEM_U32(sp + 52) = ra;
+// fdead 400381ef MEM_U32(sp + 48) = gp;
+// fdead 400381ef MEM_U32(sp + 44) = s3;
+// fdead 400381ef MEM_U32(sp + 40) = s2;
+// fdead 400381ef MEM_U32(sp + 36) = s1;
+MEM_U32(sp + 288) = a0;
+MEM_U32(sp + 292) = a1;
+MEM_U32(sp + 296) = a2;
+MEM_U32(sp + 156) = zero;
+if (t7 != at) goto L41475c;
+v0 = zero;
+goto L414760;
+L41475c:
+v0 = 0x1;
+L414760:
+t8 = 0xffffffff;
+if (v0 == 0) goto L41476c;
+MEM_U32(sp + 304) = t8;
+L41476c:
+//nop;
+if (s0 != 0) goto L414798;
+//nop;
+a0 = 0xbc;
+a1 = 0x1;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 4002018b gp = MEM_U32(sp + 48);
+//nop;
+s3 = 0x100054d4;
+MEM_U32(s3 + 0) = v0;
+goto L4147a4;
+L414798:
+s3 = 0x100054d4;
+//nop;
+MEM_U32(s3 + 0) = s0;
+L4147a4:
+v0 = MEM_U32(s3 + 0);
+t7 = MEM_U32(sp + 304);
+t9 = MEM_U32(v0 + 84);
+a0 = MEM_U32(sp + 288);
+t6 = ~t9;
+t8 = t6 & t7;
+MEM_U32(sp + 304) = t8;
+if (s0 == 0) goto L4147d0;
+t9 = t8 & 0x8;
+t6 = sp + 0xc0;
+if (t9 == 0) goto L414944;
+L4147d0:
+//nop;
+a1 = zero;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(sp + 304);
+t6 = MEM_U32(sp + 296);
+//nop;
+s0 = sp + 0xc0;
+a0 = MEM_U32(sp + 288);
+t8 = t7 | 0x208;
+MEM_U32(sp + 304) = t8;
+a1 = s0;
+a2 = 0x60;
+s1 = v0 - t6;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4016014b gp = MEM_U32(sp + 48);
+at = 0x60;
+a2 = MEM_S16(sp + 192);
+if (v0 == at) goto L41482c;
+v0 = 0xfffffffd;
+goto L415804;
+// fdead 0 a2 = MEM_S16(sp + 192);
+L41482c:
+at = 0x7009;
+if (a2 == at) {
+at = 0x7109;
+goto L4148a8;}
+at = 0x7109;
+if (a2 == at) {
+at = 0x970;
+goto L4148a8;}
+at = 0x970;
+if (a2 == at) {
+at = 0x971;
+goto L414850;}
+at = 0x971;
+//nop;
+if (a2 != at) goto L41488c;
+L414850:
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4016000b gp = MEM_U32(sp + 48);
+a0 = s0;
+//nop;
+a1 = v0;
+//nop;
+f_swap_hdr(mem, sp, a0, a1);
+t6 = MEM_U32(s3 + 0);
+// bdead 401681c3 gp = MEM_U32(sp + 48);
+t9 = 0x1;
+MEM_U32(t6 + 88) = t9;
+goto L4148a8;
+L41488c:
+a0 = 0x10001d10;
+//nop;
+a1 = 0x7009;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// bdead 401601c3 gp = MEM_U32(sp + 48);
+//nop;
+L4148a8:
+t7 = MEM_S16(sp + 194);
+t8 = MEM_U32(sp + 208);
+t9 = MEM_U32(sp + 304);
+if ((int)t7 >= (int)0x11e) goto L4148e4;
+t9 = MEM_U32(sp + 304);
+if (t8 == 0) goto L4148e4;
+a0 = 0x10001d3c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40160183 gp = MEM_U32(sp + 48);
+//nop;
+t9 = MEM_U32(sp + 304);
+L4148e4:
+t5 = 0xffffffff;
+s2 = zero;
+if (t9 != t5) goto L41490c;
+//nop;
+a0 = s0;
+a1 = s1;
+v0 = f_ldfsymorder(mem, sp, a0, a1);
+// bdead 4012018b gp = MEM_U32(sp + 48);
+s2 = v0;
+goto L41490c;
+L41490c:
+t6 = MEM_U32(s3 + 0);
+t9 = s0;
+t8 = s0 + 0x60;
+L414918:
+at = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+MEM_U32(t6 + 92) = at;
+at = MEM_U32(t9 + -8);
+t6 = t6 + 0xc;
+MEM_U32(t6 + 84) = at;
+at = MEM_U32(t9 + -4);
+MEM_U32(t6 + 88) = at;
+if (t9 != t8) goto L414918;
+t7 = MEM_U32(sp + 304);
+goto L414978;
+L414944:
+s2 = zero;
+t9 = v0;
+t8 = v0 + 0x60;
+L414950:
+at = MEM_U32(t9 + 92);
+t9 = t9 + 0xc;
+MEM_U32(t6 + 0) = at;
+at = MEM_U32(t9 + 84);
+t6 = t6 + 0xc;
+MEM_U32(t6 + -8) = at;
+at = MEM_U32(t9 + 88);
+MEM_U32(t6 + -4) = at;
+if (t9 != t8) goto L414950;
+t7 = MEM_U32(sp + 304);
+L414978:
+//nop;
+t8 = t7 & 0x2;
+MEM_U32(sp + 104) = t8;
+if (t8 == 0) goto L4149bc;
+t9 = MEM_U32(s3 + 0);
+a1 = sp + 0xa0;
+a0 = MEM_U32(t9 + 20);
+//nop;
+t7 = MEM_U32(sp + 304);
+if (a0 != 0) goto L4149c0;
+//nop;
+a3 = MEM_U32(sp + 224);
+a2 = 0xc;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s3 + 0);
+// bdead 4018818b gp = MEM_U32(sp + 48);
+MEM_U32(t6 + 20) = v0;
+L4149bc:
+t7 = MEM_U32(sp + 304);
+L4149c0:
+s1 = sp + 0xa0;
+t8 = t7 & 0x400;
+MEM_U32(sp + 100) = t8;
+if (t8 == 0) goto L414a04;
+t9 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t9 + 48);
+//nop;
+t7 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414a08;
+//nop;
+a3 = MEM_U32(sp + 240);
+a2 = 0x4;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s3 + 0);
+// bdead 401c818b gp = MEM_U32(sp + 48);
+MEM_U32(t6 + 48) = v0;
+L414a04:
+t7 = MEM_U32(sp + 304);
+L414a08:
+//nop;
+t8 = t7 & 0x80;
+MEM_U32(sp + 96) = t8;
+if (t8 == 0) goto L414a4c;
+t9 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t9 + 52);
+//nop;
+t7 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414a50;
+//nop;
+a3 = MEM_U32(sp + 248);
+a2 = 0x1;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(s3 + 0);
+// bdead 401c818b gp = MEM_U32(sp + 48);
+MEM_U32(t6 + 52) = v0;
+L414a4c:
+t7 = MEM_U32(sp + 304);
+L414a50:
+//nop;
+t8 = t7 & 0x4;
+MEM_U32(sp + 92) = t8;
+if (t8 == 0) goto L414a80;
+//nop;
+a3 = MEM_U32(sp + 200);
+a0 = zero;
+a1 = s1;
+a2 = 0x1;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 401c018b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 156) = v0;
+L414a80:
+t9 = MEM_U32(sp + 92);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (t9 == 0) goto L414ac8;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 72);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414ac8;
+//nop;
+a3 = MEM_U32(sp + 196);
+a2 = 0x4;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 72) = v0;
+t8 = MEM_U32(sp + 304);
+L414ac8:
+//nop;
+t9 = t8 & 0x20;
+MEM_U32(sp + 88) = t9;
+if (t9 == 0) goto L414b0c;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 68);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414b10;
+//nop;
+a3 = MEM_U32(sp + 232);
+a2 = 0xc;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 68) = v0;
+L414b0c:
+t8 = MEM_U32(sp + 304);
+L414b10:
+//nop;
+t9 = t8 & 0x40;
+MEM_U32(sp + 84) = t9;
+if (t9 == 0) goto L414b54;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 76);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414b58;
+//nop;
+a3 = MEM_U32(sp + 272);
+a2 = 0x4;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 76) = v0;
+L414b54:
+t8 = MEM_U32(sp + 304);
+L414b58:
+//nop;
+t9 = t8 & 0x100;
+MEM_U32(sp + 80) = t9;
+if (t9 == 0) goto L414b9c;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 80);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414ba0;
+//nop;
+a3 = MEM_U32(sp + 216);
+a2 = 0x34;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 80) = v0;
+L414b9c:
+t8 = MEM_U32(sp + 304);
+L414ba0:
+//nop;
+t9 = t8 & 0x1;
+MEM_U32(sp + 76) = t9;
+if (t9 == 0) goto L414be4;
+t6 = MEM_U32(s3 + 0);
+a3 = MEM_U32(sp + 280);
+a0 = MEM_U32(t6 + 24);
+a1 = s1;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414be8;
+//nop;
+a2 = 0x10;
+a3 = a3 + 0x1;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 24) = v0;
+L414be4:
+t8 = MEM_U32(sp + 304);
+L414be8:
+//nop;
+t9 = t8 & 0x800;
+MEM_U32(sp + 72) = t9;
+if (t9 == 0) goto L414c2c;
+t6 = MEM_U32(s3 + 0);
+a3 = MEM_U32(sp + 256);
+a0 = MEM_U32(t6 + 36);
+a1 = s1;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414c30;
+//nop;
+a2 = 0x1;
+a3 = a3 + 0x8;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 36) = v0;
+L414c2c:
+t8 = MEM_U32(sp + 304);
+L414c30:
+//nop;
+t9 = t8 & 0x10;
+MEM_U32(sp + 68) = t9;
+if (t9 == 0) goto L414c74;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 56);
+//nop;
+t8 = MEM_U32(sp + 304);
+if (a0 != 0) goto L414c78;
+//nop;
+a3 = MEM_U32(sp + 208);
+a2 = 0x8;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 56) = v0;
+L414c74:
+t8 = MEM_U32(sp + 304);
+L414c78:
+//nop;
+t9 = t8 & 0x200;
+MEM_U32(sp + 64) = t9;
+if (t9 == 0) goto L414cbc;
+t6 = MEM_U32(s3 + 0);
+a1 = s1;
+a0 = MEM_U32(t6 + 8);
+//nop;
+t8 = MEM_U32(sp + 64);
+if (a0 != 0) goto L414cc0;
+//nop;
+a3 = MEM_U32(sp + 264);
+a2 = 0x48;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 401d018b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 8) = v0;
+L414cbc:
+t8 = MEM_U32(sp + 64);
+L414cc0:
+//nop;
+t9 = zero < t8;
+//nop;
+if (t9 == 0) goto L414d48;
+t6 = MEM_U32(s3 + 0);
+//nop;
+s0 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (s0 != 0) goto L414d48;
+a1 = MEM_U32(sp + 264);
+if (t9 == 0) goto L414d2c;
+a0 = s0;
+if (s0 != 0) goto L414d28;
+//nop;
+a3 = MEM_U32(sp + 264);
+a1 = s1;
+a2 = 0x40;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(s3 + 0);
+// bdead 4019000b gp = MEM_U32(sp + 48);
+MEM_U32(t7 + 4) = v0;
+t8 = MEM_U32(s3 + 0);
+//nop;
+s0 = MEM_U32(t8 + 4);
+//nop;
+L414d28:
+a1 = MEM_U32(sp + 264);
+L414d2c:
+//nop;
+t6 = a1 << 6;
+a1 = t6;
+a0 = s0;
+wrapper_bzero(mem, a0, a1);
+// bdead 40180183 gp = MEM_U32(sp + 48);
+//nop;
+L414d48:
+t9 = MEM_U32(sp + 76);
+t7 = MEM_U32(sp + 280);
+a1 = s2;
+if (t9 == 0) goto L414d78;
+t8 = MEM_U32(s3 + 0);
+//nop;
+MEM_U32(t8 + 32) = t7;
+v0 = MEM_U32(s3 + 0);
+//nop;
+t6 = MEM_U32(v0 + 32);
+//nop;
+MEM_U32(v0 + 28) = t6;
+L414d78:
+t9 = MEM_U32(sp + 72);
+t7 = MEM_U32(sp + 256);
+if (t9 == 0) {
+t9 = MEM_U32(sp + 68);
+goto L414dac;}
+t9 = MEM_U32(sp + 68);
+t8 = MEM_U32(s3 + 0);
+//nop;
+MEM_U32(t8 + 44) = t7;
+v0 = MEM_U32(s3 + 0);
+//nop;
+t6 = MEM_U32(v0 + 44);
+//nop;
+MEM_U32(v0 + 40) = t6;
+t9 = MEM_U32(sp + 68);
+L414dac:
+t7 = MEM_U32(sp + 208);
+if (t9 == 0) {
+t9 = MEM_U32(sp + 64);
+goto L414ddc;}
+t9 = MEM_U32(sp + 64);
+t8 = MEM_U32(s3 + 0);
+//nop;
+MEM_U32(t8 + 64) = t7;
+v0 = MEM_U32(s3 + 0);
+//nop;
+t6 = MEM_U32(v0 + 64);
+//nop;
+MEM_U32(v0 + 60) = t6;
+t9 = MEM_U32(sp + 64);
+L414ddc:
+t7 = MEM_U32(sp + 264);
+if (t9 == 0) {
+t9 = MEM_U32(sp + 92);
+goto L414e0c;}
+t9 = MEM_U32(sp + 92);
+t8 = MEM_U32(s3 + 0);
+//nop;
+MEM_U32(t8 + 16) = t7;
+v0 = MEM_U32(s3 + 0);
+//nop;
+t6 = MEM_U32(v0 + 16);
+//nop;
+MEM_U32(v0 + 12) = t6;
+t9 = MEM_U32(sp + 92);
+L414e0c:
+a0 = MEM_U32(sp + 288);
+if (t9 == 0) {
+t9 = MEM_U32(sp + 80);
+goto L414e54;}
+t9 = MEM_U32(sp + 80);
+//nop;
+t7 = MEM_U32(sp + 204);
+t8 = MEM_U32(sp + 296);
+t6 = MEM_U32(sp + 200);
+a3 = MEM_U32(sp + 156);
+// bdead 42198163 t9 = t9;
+a2 = t7 + t8;
+MEM_U32(sp + 16) = t6;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L414e50;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414e50:
+t9 = MEM_U32(sp + 80);
+L414e54:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t9 == 0) goto L414eb0;
+t7 = MEM_U32(sp + 220);
+t8 = MEM_U32(sp + 296);
+t9 = MEM_U32(sp + 216);
+a2 = t7 + t8;
+t7 = t9 << 2;
+t7 = t7 - t9;
+t7 = t7 << 2;
+t7 = t7 + t9;
+//nop;
+t6 = MEM_U32(s3 + 0);
+t7 = t7 << 2;
+// bdead 401980e3 t9 = t9;
+a3 = MEM_U32(t6 + 80);
+MEM_U32(sp + 16) = t7;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+t8 = MEM_U32(sp + 104);
+if (v0 == 0) goto L414eb4;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414eb0:
+t8 = MEM_U32(sp + 104);
+L414eb4:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t8 == 0) goto L414f08;
+t6 = MEM_U32(sp + 228);
+t9 = MEM_U32(sp + 296);
+t8 = MEM_U32(sp + 224);
+a2 = t6 + t9;
+//nop;
+t7 = MEM_U32(s3 + 0);
+t6 = t8 << 2;
+t6 = t6 - t8;
+t6 = t6 << 2;
+// bdead 401980e3 t9 = t9;
+a3 = MEM_U32(t7 + 20);
+MEM_U32(sp + 16) = t6;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L414f08;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414f08:
+t9 = MEM_U32(sp + 88);
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t9 == 0) goto L414f60;
+t7 = MEM_U32(sp + 236);
+t8 = MEM_U32(sp + 296);
+t9 = MEM_U32(sp + 232);
+a2 = t7 + t8;
+t7 = t9 << 2;
+t7 = t7 - t9;
+//nop;
+t6 = MEM_U32(s3 + 0);
+t7 = t7 << 2;
+// bdead 401980e3 t9 = t9;
+a3 = MEM_U32(t6 + 68);
+MEM_U32(sp + 16) = t7;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+t8 = MEM_U32(sp + 100);
+if (v0 == 0) goto L414f64;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414f60:
+t8 = MEM_U32(sp + 100);
+L414f64:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t8 == 0) goto L414fb0;
+t6 = MEM_U32(sp + 244);
+t9 = MEM_U32(sp + 296);
+t7 = MEM_U32(s3 + 0);
+a2 = t6 + t9;
+//nop;
+t8 = MEM_U32(sp + 240);
+a3 = MEM_U32(t7 + 48);
+// bdead 421801e3 t9 = t9;
+t6 = t8 << 2;
+MEM_U32(sp + 16) = t6;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L414fb0;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414fb0:
+t9 = MEM_U32(sp + 96);
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t9 == 0) goto L414ffc;
+t6 = MEM_U32(s3 + 0);
+t9 = MEM_U32(sp + 248);
+a3 = MEM_U32(t6 + 52);
+MEM_U32(sp + 16) = t9;
+//nop;
+t7 = MEM_U32(sp + 252);
+t8 = MEM_U32(sp + 296);
+// bdead 42190163 t9 = t9;
+a2 = t7 + t8;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(sp + 72);
+if (v0 == 0) goto L415000;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L414ffc:
+t7 = MEM_U32(sp + 72);
+L415000:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t7 == 0) goto L415048;
+t9 = MEM_U32(s3 + 0);
+t8 = MEM_U32(sp + 260);
+a3 = MEM_U32(t9 + 36);
+//nop;
+t6 = MEM_U32(sp + 296);
+t7 = MEM_U32(sp + 256);
+// bdead 42198163 t9 = t9;
+a2 = t8 + t6;
+MEM_U32(sp + 16) = t7;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+t8 = MEM_U32(sp + 64);
+if (v0 == 0) goto L41504c;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L415048:
+t8 = MEM_U32(sp + 64);
+L41504c:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t8 == 0) goto L4150a0;
+t6 = MEM_U32(sp + 268);
+t9 = MEM_U32(sp + 296);
+t8 = MEM_U32(sp + 264);
+a2 = t6 + t9;
+//nop;
+t7 = MEM_U32(s3 + 0);
+t6 = t8 << 3;
+t6 = t6 + t8;
+t6 = t6 << 3;
+// bdead 401980e3 t9 = t9;
+a3 = MEM_U32(t7 + 8);
+MEM_U32(sp + 16) = t6;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L4150a0;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L4150a0:
+t9 = MEM_U32(sp + 84);
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t9 == 0) goto L4150f0;
+t7 = MEM_U32(sp + 276);
+t8 = MEM_U32(sp + 296);
+t9 = MEM_U32(sp + 272);
+a2 = t7 + t8;
+t7 = t9 << 2;
+//nop;
+t6 = MEM_U32(s3 + 0);
+// bdead 401980e3 t9 = t9;
+a3 = MEM_U32(t6 + 76);
+MEM_U32(sp + 16) = t7;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+t8 = MEM_U32(sp + 76);
+if (v0 == 0) goto L4150f4;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L4150f0:
+t8 = MEM_U32(sp + 76);
+L4150f4:
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t8 == 0) goto L415140;
+t6 = MEM_U32(sp + 284);
+t9 = MEM_U32(sp + 296);
+t7 = MEM_U32(s3 + 0);
+a2 = t6 + t9;
+//nop;
+t8 = MEM_U32(sp + 280);
+a3 = MEM_U32(t7 + 24);
+// bdead 421801e3 t9 = t9;
+t6 = t8 << 4;
+MEM_U32(sp + 16) = t6;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4018018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L415140;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L415140:
+t9 = MEM_U32(sp + 68);
+a0 = MEM_U32(sp + 288);
+a1 = s2;
+if (t9 == 0) goto L415190;
+t7 = MEM_U32(sp + 212);
+t8 = MEM_U32(sp + 296);
+t9 = MEM_U32(sp + 208);
+a2 = t7 + t8;
+t7 = t9 << 3;
+//nop;
+t6 = MEM_U32(s3 + 0);
+// bdead 401180e3 t9 = t9;
+a3 = MEM_U32(t6 + 56);
+MEM_U32(sp + 16) = t7;
+v0 = func_415820(mem, sp, a0, a1, a2, a3);
+// bdead 4010018b gp = MEM_U32(sp + 48);
+//nop;
+if (v0 == 0) goto L415190;
+// bdead 9 ra = MEM_U32(sp + 52);
+goto L415808;
+L415190:
+t8 = MEM_U32(s3 + 0);
+t9 = MEM_U32(sp + 80);
+t6 = MEM_U32(t8 + 88);
+//nop;
+v1 = MEM_U32(sp + 264);
+if (t6 == 0) goto L415380;
+t8 = MEM_U32(sp + 104);
+if (t9 == 0) goto L4151e8;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 216);
+a0 = MEM_U32(t7 + 80);
+a2 = v0;
+f_swap_pd(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t8 = MEM_U32(sp + 104);
+L4151e8:
+//nop;
+t9 = MEM_U32(sp + 88);
+if (t8 == 0) goto L41522c;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 224);
+a0 = MEM_U32(t6 + 20);
+a2 = v0;
+f_swap_sym(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t9 = MEM_U32(sp + 88);
+L41522c:
+//nop;
+t8 = MEM_U32(sp + 64);
+if (t9 == 0) goto L415270;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 232);
+a0 = MEM_U32(t7 + 68);
+a2 = v0;
+f_swap_opt(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t8 = MEM_U32(sp + 64);
+L415270:
+//nop;
+t9 = MEM_U32(sp + 84);
+if (t8 == 0) goto L4152b4;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 264);
+a0 = MEM_U32(t6 + 8);
+a2 = v0;
+f_swap_fd(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t9 = MEM_U32(sp + 84);
+L4152b4:
+//nop;
+t8 = MEM_U32(sp + 76);
+if (t9 == 0) goto L4152f8;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 272);
+a0 = MEM_U32(t7 + 76);
+a2 = v0;
+f_swap_fi(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t8 = MEM_U32(sp + 76);
+L4152f8:
+//nop;
+t9 = MEM_U32(sp + 68);
+if (t8 == 0) goto L41533c;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 280);
+a0 = MEM_U32(t6 + 24);
+a2 = v0;
+f_swap_ext(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+t9 = MEM_U32(sp + 68);
+L41533c:
+//nop;
+v1 = MEM_U32(sp + 264);
+if (t9 == 0) goto L415380;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4010000b gp = MEM_U32(sp + 48);
+t7 = MEM_U32(s3 + 0);
+//nop;
+a1 = MEM_U32(sp + 208);
+a0 = MEM_U32(t7 + 56);
+a2 = v0;
+f_swap_dn(mem, sp, a0, a1, a2);
+// bdead 40100183 gp = MEM_U32(sp + 48);
+//nop;
+v1 = MEM_U32(sp + 264);
+L415380:
+s0 = zero;
+s2 = zero;
+if ((int)v1 <= 0) goto L4155ec;
+s1 = zero;
+L415390:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(s3 + 0);
+// bdead 421e018b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(t8 + 8);
+//nop;
+t9 = t6 + s1;
+MEM_U32(v0 + 0) = t9;
+t7 = MEM_U32(sp + 104);
+//nop;
+t8 = MEM_U32(sp + 100);
+if (t7 == 0) goto L415408;
+t8 = MEM_U32(t9 + 20);
+v1 = t9;
+if ((int)t8 <= 0) {
+t8 = MEM_U32(sp + 100);
+goto L415408;}
+t8 = MEM_U32(sp + 100);
+t7 = MEM_U32(v1 + 16);
+t6 = MEM_U32(s3 + 0);
+t8 = t7 << 2;
+t8 = t8 - t7;
+t9 = MEM_U32(t6 + 20);
+t7 = MEM_U32(v0 + 60);
+t8 = t8 << 2;
+t6 = t9 + t8;
+t9 = t7 | 0x2;
+MEM_U32(v0 + 4) = t6;
+MEM_U32(v0 + 60) = t9;
+t8 = MEM_U32(sp + 100);
+L415408:
+//nop;
+t6 = MEM_U32(sp + 88);
+if (t8 == 0) goto L415454;
+v1 = MEM_U32(v0 + 0);
+//nop;
+t6 = MEM_U32(v1 + 48);
+//nop;
+if ((int)t6 <= 0) {
+t6 = MEM_U32(sp + 88);
+goto L415454;}
+t6 = MEM_U32(sp + 88);
+t7 = MEM_U32(s3 + 0);
+t8 = MEM_U32(v1 + 44);
+t9 = MEM_U32(t7 + 48);
+t6 = t8 << 2;
+t8 = MEM_U32(v0 + 60);
+t7 = t9 + t6;
+t9 = t8 | 0x400;
+MEM_U32(v0 + 12) = t7;
+MEM_U32(v0 + 60) = t9;
+t6 = MEM_U32(sp + 88);
+L415454:
+//nop;
+t7 = MEM_U32(sp + 84);
+if (t6 == 0) goto L4154a8;
+v1 = MEM_U32(v0 + 0);
+//nop;
+t7 = MEM_U32(v1 + 36);
+//nop;
+if ((int)t7 <= 0) {
+t7 = MEM_U32(sp + 84);
+goto L4154a8;}
+t7 = MEM_U32(sp + 84);
+t6 = MEM_U32(v1 + 32);
+t8 = MEM_U32(s3 + 0);
+t7 = t6 << 2;
+t7 = t7 - t6;
+t9 = MEM_U32(t8 + 68);
+t6 = MEM_U32(v0 + 60);
+t7 = t7 << 2;
+t8 = t9 + t7;
+t9 = t6 | 0x20;
+MEM_U32(v0 + 28) = t8;
+MEM_U32(v0 + 60) = t9;
+t7 = MEM_U32(sp + 84);
+L4154a8:
+//nop;
+t8 = MEM_U32(sp + 96);
+if (t7 == 0) goto L4154f4;
+v1 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v1 + 56);
+//nop;
+if ((int)t8 <= 0) {
+t8 = MEM_U32(sp + 96);
+goto L4154f4;}
+t8 = MEM_U32(sp + 96);
+t6 = MEM_U32(s3 + 0);
+t7 = MEM_U32(v1 + 52);
+t9 = MEM_U32(t6 + 76);
+t8 = t7 << 2;
+t7 = MEM_U32(v0 + 60);
+t6 = t9 + t8;
+t9 = t7 | 0x40;
+MEM_U32(v0 + 44) = t6;
+MEM_U32(v0 + 60) = t9;
+t8 = MEM_U32(sp + 96);
+L4154f4:
+//nop;
+if (t8 == 0) {
+t8 = MEM_U32(sp + 80);
+goto L41553c;}
+t8 = MEM_U32(sp + 80);
+v1 = MEM_U32(v0 + 0);
+//nop;
+t6 = MEM_U32(v1 + 12);
+//nop;
+t8 = MEM_U32(sp + 80);
+if ((int)t6 <= 0) goto L41553c;
+t7 = MEM_U32(s3 + 0);
+t8 = MEM_U32(v1 + 8);
+t9 = MEM_U32(t7 + 52);
+t7 = MEM_U32(v0 + 60);
+t6 = t9 + t8;
+t9 = t7 | 0x80;
+MEM_U32(v0 + 20) = t6;
+MEM_U32(v0 + 60) = t9;
+t8 = MEM_U32(sp + 80);
+L41553c:
+//nop;
+t6 = MEM_U32(sp + 92);
+if (t8 == 0) goto L415590;
+v1 = MEM_U32(v0 + 0);
+t8 = s0 << 2;
+t6 = MEM_U16(v1 + 42);
+t8 = t8 - s0;
+t8 = t8 << 2;
+if (t6 == 0) goto L41558c;
+t7 = MEM_U32(s3 + 0);
+t8 = t8 + s0;
+t9 = MEM_U32(t7 + 80);
+t8 = t8 << 2;
+t6 = t9 + t8;
+t9 = MEM_U32(v0 + 60);
+MEM_U32(v0 + 52) = t6;
+t7 = MEM_U16(v1 + 42);
+t8 = t9 | 0x100;
+MEM_U32(v0 + 60) = t8;
+s0 = s0 + t7;
+L41558c:
+t6 = MEM_U32(sp + 92);
+L415590:
+//nop;
+v1 = MEM_U32(sp + 264);
+if (t6 == 0) goto L4155dc;
+v1 = MEM_U32(v0 + 0);
+//nop;
+t7 = MEM_U32(v1 + 28);
+//nop;
+//nop;
+if ((int)t7 <= 0) goto L4155d8;
+t9 = MEM_U32(s3 + 0);
+t6 = MEM_U32(v1 + 24);
+t8 = MEM_U32(t9 + 72);
+t7 = t6 << 2;
+t6 = MEM_U32(v0 + 60);
+t9 = t8 + t7;
+t8 = t6 | 0x4;
+MEM_U32(v0 + 36) = t9;
+MEM_U32(v0 + 60) = t8;
+L4155d8:
+v1 = MEM_U32(sp + 264);
+L4155dc:
+s2 = s2 + 0x1;
+s1 = s1 + 0x48;
+if ((int)s2 < (int)v1) goto L415390;
+L4155ec:
+t7 = MEM_U32(sp + 92);
+s2 = v1 + 0xffffffff;
+//nop;
+if (t7 == 0) goto L4157c0;
+//nop;
+if ((int)s2 < 0) goto L4157c0;
+L415604:
+//nop;
+a0 = s2;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 0);
+// bdead 4018019b gp = MEM_U32(sp + 48);
+t9 = MEM_U32(v1 + 28);
+t3 = 0xfffffff8;
+t5 = 0xffffffff;
+s1 = v0;
+if (t9 == 0) goto L4157b4;
+t6 = MEM_U32(v1 + 64);
+t8 = MEM_U32(sp + 156);
+t7 = MEM_U16(v1 + 42);
+ra = zero;
+t0 = t6 + t8;
+if (t7 == 0) goto L4157b4;
+s0 = zero;
+L41564c:
+t2 = MEM_U32(v0 + 52);
+ra = ra + 0x1;
+v1 = t2 + s0;
+a3 = MEM_U32(v1 + 8);
+//nop;
+//nop;
+if (t5 == a3) goto L415688;
+t4 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if (t5 == t4) goto L415688;
+t9 = MEM_U32(v1 + 44);
+//nop;
+//nop;
+if (t5 != t9) goto L41569c;
+L415688:
+t6 = MEM_U32(s1 + 0);
+//nop;
+a2 = MEM_U16(t6 + 42);
+at = ra < a2;
+goto L4157ac;
+L41569c:
+v1 = MEM_U32(v0 + 0);
+a1 = zero;
+t8 = MEM_U16(v1 + 42);
+t1 = MEM_U32(v1 + 28);
+at = (int)a3 < (int)t1;
+if (t8 == 0) goto L415714;
+t7 = MEM_U32(s1 + 0);
+a0 = t2;
+a2 = MEM_U16(t7 + 42);
+//nop;
+L4156c4:
+v1 = MEM_U32(a0 + 8);
+a1 = a1 + 0x1;
+if ((int)a3 >= (int)v1) {
+at = a1 < a2;
+goto L415708;}
+at = a1 < a2;
+t9 = MEM_U32(a0 + 40);
+//nop;
+at = a1 < a2;
+if (t5 == t9) goto L415708;
+t6 = MEM_U32(a0 + 44);
+at = (int)v1 < (int)t1;
+//nop;
+if (t5 == t6) goto L415704;
+if (at == 0) {
+at = a1 < a2;
+goto L415708;}
+at = a1 < a2;
+t1 = v1;
+L415704:
+at = a1 < a2;
+L415708:
+a0 = a0 + 0x34;
+if (at != 0) goto L4156c4;
+at = (int)a3 < (int)t1;
+L415714:
+a2 = t4;
+a1 = a3;
+if (at == 0) goto L415798;
+L415720:
+v1 = MEM_S8(t0 + 0);
+t0 = t0 + 0x1;
+a3 = (int)v1 >> 4;
+t8 = a3 << 24;
+a3 = (int)t8 >> 24;
+a0 = v1 & 0xf;
+if (a3 != t3) goto L415764;
+t9 = MEM_S8(t0 + 1);
+t8 = MEM_S8(t0 + 0);
+t6 = t9 & 0xff;
+t7 = t8 << 8;
+v1 = t6 | t7;
+t9 = v1 << 16;
+t8 = (int)t9 >> 16;
+t0 = t0 + 0x2;
+a2 = a2 + t8;
+goto L415768;
+L415764:
+a2 = a2 + a3;
+L415768:
+v1 = a1 << 2;
+if ((int)a0 < 0) goto L41578c;
+L415770:
+t6 = MEM_U32(v0 + 36);
+a0 = a0 + 0xffffffff;
+t7 = t6 + v1;
+MEM_U32(t7 + 0) = a2;
+v1 = v1 + 0x4;
+a1 = a1 + 0x1;
+if ((int)a0 >= 0) goto L415770;
+L41578c:
+//nop;
+if ((int)a1 < (int)t1) goto L415720;
+L415798:
+t9 = MEM_U32(s1 + 0);
+//nop;
+a2 = MEM_U16(t9 + 42);
+//nop;
+at = ra < a2;
+L4157ac:
+s0 = s0 + 0x34;
+if (at != 0) goto L41564c;
+L4157b4:
+s2 = s2 + 0xffffffff;
+//nop;
+if ((int)s2 >= 0) goto L415604;
+L4157c0:
+v0 = MEM_U32(s3 + 0);
+t6 = MEM_U32(sp + 304);
+t8 = MEM_U32(v0 + 84);
+//nop;
+t7 = t8 | t6;
+MEM_U32(v0 + 84) = t7;
+t9 = MEM_U32(sp + 156);
+//nop;
+a0 = t9;
+if (t9 == 0) goto L415800;
+//nop;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 48);
+//nop;
+L415800:
+v0 = zero;
+L415804:
+// bdead 9 ra = MEM_U32(sp + 52);
+L415808:
+// bdead 9 s0 = MEM_U32(sp + 32);
+// bdead 9 s1 = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 40);
+// bdead 9 s3 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x120;
+return v0;
+}
+
+static uint32_t func_415820(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L415820:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(sp + 48);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 44) = a3;
+if (t6 != 0) goto L415854;
+v0 = zero;
+goto L4158ec;
+L415854:
+//nop;
+if (a1 != 0) goto L4158a0;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 40);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+t7 = MEM_U32(sp + 40);
+// bdead 400101cb gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == t7) goto L4158a0;
+a0 = 0x10001dbc;
+//nop;
+a0 = a0;
+//nop;
+f_st_warning(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0xfffffffb;
+goto L4158ec;
+L4158a0:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 44);
+a2 = MEM_U32(sp + 48);
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+t8 = MEM_U32(sp + 48);
+// bdead 420001cb gp = MEM_U32(sp + 24);
+if (v0 == t8) {
+v0 = zero;
+goto L4158ec;}
+v0 = zero;
+a0 = 0x10001dd4;
+//nop;
+a0 = a0;
+//nop;
+f_st_warning(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0xfffffffa;
+goto L4158ec;
+// fdead 0 v0 = zero;
+L4158ec:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_writest(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L415990:
+//st_writest:
+//nop;
+//nop;
+//nop;
+// fdead 3 sp = sp + 0xfffffe28;
+//nop;
+// fdead 3 MEM_U32(sp + 20) = s0;
+// fdead 3 s0 = a0;
+// fdead 3 MEM_U32(sp + 60) = ra;
+// fdead 3 MEM_U32(sp + 476) = a1;
+// fdead 3 MEM_U32(sp + 56) = fp;
+// fdead 3 MEM_U32(sp + 52) = gp;
+// fdead 3 MEM_U32(sp + 48) = s7;
+// fdead 3 MEM_U32(sp + 44) = s6;
+// fdead 3 MEM_U32(sp + 40) = s5;
+// fdead 3 MEM_U32(sp + 36) = s4;
+// fdead 3 MEM_U32(sp + 32) = s3;
+// fdead 3 MEM_U32(sp + 28) = s2;
+// fdead 3 MEM_U32(sp + 24) = s1;
+a1 = 0x48;
+// fdead 43 a0 = sp + 0x18c;
+// fdead 43 MEM_U32(sp + 288) = zero;
+wrapper_bzero(mem, a0, a1);
+// fdead 3 gp = MEM_U32(sp + 52);
+// fdead 3 a0 = sp + 0x128;
+//nop;
+a1 = 0x60;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// fdead 3 gp = MEM_U32(sp + 52);
+//nop;
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// fdead b gp = MEM_U32(sp + 52);
+// fdead b MEM_U32(sp + 276) = v0;
+//nop;
+// fdead b a0 = s0;
+a1 = zero;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 52);
+// fdead b MEM_U32(sp + 272) = v0;
+//nop;
+// fdead b a0 = s0;
+a1 = 0x60;
+a2 = 0x1;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 52);
+// fdead b t6 = MEM_U32(sp + 276);
+t7 = 0x100054d4;
+// fdead 1000b MEM_U32(sp + 284) = v0;
+t7 = MEM_U32(t7 + 0);
+// fdead 1000b a0 = s0;
+// fdead 1000b MEM_U32(t7 + 12) = t6;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_dup(mem, a0);
+// fdead b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = 0x10001e10;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_fdopen(mem, a0, a1);
+// fdead b gp = MEM_U32(sp + 52);
+// fdead b t3 = MEM_U32(sp + 288);
+// fdead b MEM_U32(sp + 268) = v0;
+if (v0 != 0) goto L415acc;
+a0 = 0x10001e14;
+//nop;
+// fdead 2b a1 = s0;
+// fdead 2b MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 3 gp = MEM_U32(sp + 52);
+// fdead 3 t3 = MEM_U32(sp + 288);
+//nop;
+L415acc:
+// fdead b t8 = MEM_U32(sp + 476);
+//nop;
+// fdead b t9 = t8 & 0x4;
+// fdead b t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L415e70;
+// fdead b t4 = MEM_U32(sp + 276);
+s6 = 0xffffffff;
+// fdead 80000b t9 = MEM_U32(sp + 300);
+if ((int)t4 <= 0) goto L415dec;
+// fdead 80000b MEM_U32(sp + 280) = zero;
+// fdead 80000b fp = sp + 0x68;
+L415af8:
+//nop;
+// fdead 7fde6ff a0 = MEM_U32(sp + 280);
+// fdead 7fde6ff MEM_U32(sp + 292) = zero;
+// fdead 7fde6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(v0 + 0);
+// fdead 1fc401f gp = MEM_U32(sp + 52);
+// fdead 1fc401f MEM_U32(sp + 392) = t5;
+v1 = MEM_U32(t5 + 28);
+// fdead 1fc401f t2 = MEM_U32(sp + 292);
+// fdead 1fc401f t3 = MEM_U32(sp + 288);
+t1 = v0;
+if (v1 == 0) goto L415dd4;
+t7 = MEM_U32(v0 + 36);
+// fdead 1fd441f t8 = MEM_U32(sp + 300);
+// fdead 1fd441f t4 = t8 + v1;
+if (t7 == 0) goto L415dd4;
+// fdead 1fd441f MEM_U32(t5 + 24) = t8;
+// fdead 1fd441f MEM_U32(sp + 300) = t4;
+// fdead 1fd441f MEM_U32(t5 + 64) = t3;
+// fdead 1fd441f MEM_U32(sp + 264) = zero;
+s1 = MEM_U16(t5 + 42);
+//nop;
+// fdead 1fd441f t8 = MEM_U32(sp + 392);
+if (s1 == 0) goto L415dcc;
+// fdead 1fd441f MEM_U32(sp + 88) = zero;
+L415b60:
+t5 = MEM_U32(t1 + 52);
+// fdead 7fde6ff t6 = MEM_U32(sp + 88);
+//nop;
+t0 = t5 + t6;
+t7 = MEM_U32(t0 + 8);
+//nop;
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+if (s6 == t7) goto L415dac;
+t8 = MEM_U32(t0 + 40);
+//nop;
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+if (s6 == t8) goto L415dac;
+t4 = MEM_U32(t0 + 44);
+// fdead 7fde6ff t9 = MEM_U32(sp + 392);
+if (s6 == t4) {
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+goto L415dac;}
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+t5 = MEM_U32(t9 + 64);
+a0 = zero;
+// fdead 7fde6ff t6 = t3 - t5;
+MEM_U32(t0 + 48) = t6;
+// fdead 7fde6ff t7 = MEM_U32(sp + 392);
+//nop;
+s1 = MEM_U16(t7 + 42);
+a1 = MEM_U32(t7 + 28);
+//nop;
+if (s1 == 0) goto L415c20;
+a2 = MEM_U32(t0 + 8);
+v1 = MEM_U32(t1 + 52);
+//nop;
+L415bd4:
+v0 = MEM_U32(v1 + 8);
+a0 = a0 + 0x1;
+if ((int)a2 >= (int)v0) {
+at = a0 < s1;
+goto L415c18;}
+at = a0 < s1;
+t8 = MEM_U32(v1 + 40);
+//nop;
+at = a0 < s1;
+if (s6 == t8) goto L415c18;
+t4 = MEM_U32(v1 + 44);
+at = (int)v0 < (int)a1;
+//nop;
+if (s6 == t4) goto L415c14;
+if (at == 0) {
+at = a0 < s1;
+goto L415c18;}
+at = a0 < s1;
+a1 = v0;
+L415c14:
+at = a0 < s1;
+L415c18:
+v1 = v1 + 0x34;
+if (at != 0) goto L415bd4;
+L415c20:
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+if ((int)a1 <= 0) goto L415dac;
+a2 = MEM_U32(t0 + 8);
+s2 = s6;
+t9 = a2 << 2;
+if ((int)a2 < 0) goto L415da8;
+v0 = MEM_U32(t1 + 36);
+s7 = a1 << 2;
+s3 = v0 + t9;
+v1 = v0 + s7;
+s5 = MEM_U32(t0 + 40);
+at = v1 < s3;
+s4 = zero;
+// fdead 7fde6ff s0 = fp;
+if (at != 0) goto L415da8;
+L415c5c:
+at = 0x8;
+if (s3 != v1) goto L415c6c;
+v1 = 0x1;
+goto L415c94;
+L415c6c:
+v0 = MEM_U32(s3 + 0);
+//nop;
+a0 = v0;
+if (v0 != 0) goto L415c88;
+a0 = MEM_U32(t0 + 40);
+v1 = a0 - s5;
+goto L415c8c;
+L415c88:
+v1 = a0 - s5;
+L415c8c:
+t5 = v1 << 16;
+v1 = (int)t5 >> 16;
+L415c94:
+// fdead 7fde6ff a0 = fp;
+if (v1 != 0) goto L415ca4;
+// fdead 7fde6ff v0 = s0 + 0x3;
+if (s2 != at) goto L415d0c;
+L415ca4:
+s5 = s5 + v1;
+if (s2 == s6) goto L415cd0;
+if ((int)s4 < (int)0xfffffff9) {
+at = (int)s4 < (int)0x8;
+goto L415cd0;}
+t4 = s4 << 4;
+if ((int)s4 >= (int)0x8) goto L415cd0;
+t9 = t4 | s2;
+// fdead 7fde6ff MEM_U8(s0 + 0) = (uint8_t)t9;
+// fdead 7fde6ff s0 = s0 + 0x1;
+goto L415cf4;
+L415cd0:
+t7 = (int)s4 >> 8;
+if (s2 == s6) goto L415cf4;
+// fdead 7fde6ff MEM_U8(s0 + 0) = (uint8_t)s2;
+// fdead 7fde6ff t5 = MEM_S8(s0 + 0);
+// fdead 7fde6ff MEM_U8(s0 + 1) = (uint8_t)t7;
+t6 = t5 | 0x80;
+// fdead 7fde6ff MEM_U8(s0 + 0) = (uint8_t)t6;
+// fdead 7fde6ff MEM_U8(s0 + 2) = (uint8_t)s4;
+// fdead 7fde6ff s0 = s0 + 0x3;
+L415cf4:
+s4 = v1 << 16;
+t4 = (int)s4 >> 16;
+s2 = zero;
+s4 = t4;
+// fdead 7fde6ff v0 = s0 + 0x3;
+goto L415d10;
+L415d0c:
+s2 = s2 + 0x1;
+L415d10:
+// fdead 7fde6ff t9 = sp + 0xe8;
+// fdead 7fde6ff s1 = s0 - fp;
+if (v0 >= t9) goto L415d3c;
+t5 = MEM_U32(t1 + 36);
+// fdead 7fde6ff t6 = s0 - fp;
+v1 = t5 + s7;
+//nop;
+if (s3 != v1) goto L415d88;
+//nop;
+if ((int)t6 <= 0) goto L415d88;
+L415d3c:
+//nop;
+// fdead 7fde6ff a3 = MEM_U32(sp + 268);
+a1 = s1;
+a2 = 0x1;
+// fdead 7fde6ff MEM_U32(sp + 252) = t0;
+// fdead 7fde6ff MEM_U32(sp + 468) = t1;
+// fdead 7fde6ff MEM_U32(sp + 292) = t2;
+// fdead 7fde6ff MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 1fc000f t1 = MEM_U32(sp + 468);
+// fdead 1fc000f t2 = MEM_U32(sp + 292);
+// fdead 1fc000f t3 = MEM_U32(sp + 288);
+// fdead 1fc000f t7 = MEM_U32(t1 + 36);
+// fdead 1fc000f gp = MEM_U32(sp + 52);
+// fdead 1fc000f t0 = MEM_U32(sp + 252);
+// fdead 1fc000f s0 = fp;
+// fdead 1fc000f t2 = t2 + s1;
+// fdead 1fc000f t3 = t3 + s1;
+// fdead 1fc000f v1 = t7 + s7;
+L415d88:
+s3 = s3 + 0x4;
+//nop;
+if (v1 >= s3) goto L415c5c;
+// fdead 7fde6ff t8 = MEM_U32(sp + 392);
+//nop;
+s1 = MEM_U16(t8 + 42);
+//nop;
+L415da8:
+// fdead 7fde6ff t4 = MEM_U32(sp + 264);
+L415dac:
+// fdead 7fde6ff t5 = MEM_U32(sp + 88);
+t9 = t4 + 0x1;
+at = t9 < s1;
+t6 = t5 + 0x34;
+// fdead 7fde6ff MEM_U32(sp + 88) = t6;
+// fdead 7fde6ff MEM_U32(sp + 264) = t9;
+if (at != 0) goto L415b60;
+// fdead 7fde6ff t8 = MEM_U32(sp + 392);
+L415dcc:
+//nop;
+// fdead 7fde6ff MEM_U32(t8 + 68) = t2;
+L415dd4:
+// fdead 7fde6ff v0 = MEM_U32(sp + 280);
+// fdead 7fde6ff t4 = MEM_U32(sp + 276);
+v0 = v0 + 0x1;
+// fdead 7fde6ff MEM_U32(sp + 280) = v0;
+if (v0 != t4) goto L415af8;
+// fdead 7fde6ff t9 = MEM_U32(sp + 300);
+L415dec:
+// fdead 7fde6ff s0 = -t3;
+// fdead 7fde6ff t5 = s0 & 0x3;
+if (t9 == 0) goto L415e6c;
+s0 = t5;
+if (t5 == 0) goto L415e60;
+a0 = 0x10002ef0;
+//nop;
+// fdead 7ffe6ff a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+a2 = t5;
+// fdead 7ffe6ff MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 1fe000f gp = MEM_U32(sp + 52);
+// fdead 1fe000f t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L415e50;
+a0 = 0x10001e40;
+//nop;
+// fdead 1fe002f MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 1fe0007 gp = MEM_U32(sp + 52);
+// fdead 1fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L415e50:
+// fdead 1fe000f t3 = t3 + 0x3;
+at = 0xfffffffc;
+// fdead 1fe000f t6 = t3 & at;
+// fdead 1fe000f t3 = t6;
+L415e60:
+// fdead 7ffe6ff t7 = MEM_U32(sp + 284);
+// fdead 7ffe6ff MEM_U32(sp + 304) = t3;
+// fdead 7ffe6ff MEM_U32(sp + 308) = t7;
+L415e6c:
+// fdead 7ffe6ff t8 = MEM_U32(sp + 476);
+L415e70:
+//nop;
+t4 = t8 & 0x100;
+// fdead 7ffe6ff t5 = MEM_U32(sp + 476);
+if (t4 == 0) goto L415f90;
+// fdead 7ffe6ff t9 = MEM_U32(sp + 284);
+// fdead 7ffe6ff t6 = MEM_U32(sp + 276);
+// fdead 7ffe6ff t5 = t9 + t3;
+// fdead 7ffe6ff MEM_U32(sp + 284) = t5;
+t3 = zero;
+if ((int)t6 <= 0) goto L415f78;
+s2 = 0x100008d4;
+// fdead 7fff6ff MEM_U32(sp + 280) = zero;
+s0 = 0x34;
+L415ea4:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(v0 + 0);
+// fdead 601ff001f t8 = MEM_U16(sp + 436);
+// fdead 601ff001f MEM_U32(sp + 392) = t7;
+s1 = MEM_U16(t7 + 42);
+// fdead 601ff001f t4 = MEM_U16(sp + 438);
+lo = s1 * s0;
+hi = (uint32_t)((uint64_t)s1 * (uint64_t)s0 >> 32);
+// fdead 601ff001f t3 = MEM_U32(sp + 288);
+// fdead 601ff001f gp = MEM_U32(sp + 52);
+// fdead 601ff001f t9 = t8 + t4;
+// fdead 601ff001f MEM_U16(t7 + 40) = (uint16_t)t9;
+// fdead 601ff001f a3 = MEM_U32(sp + 268);
+a1 = s0;
+a2 = s1;
+a0 = lo;
+// fdead 601ff00ff t3 = t3 + a0;
+// fdead 601ff00ff t8 = MEM_U16(sp + 436);
+if (s1 == 0) goto L415f40;
+//nop;
+a0 = MEM_U32(v0 + 52);
+// fdead 601ff00ff MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t6 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t7 = MEM_U16(t6 + 42);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t8 = MEM_U16(sp + 436);
+if (v0 == t7) goto L415f40;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+// fdead 601fe0007 t8 = MEM_U16(sp + 436);
+L415f40:
+// fdead 601ff00ff t4 = MEM_U16(sp + 438);
+// fdead 601ff00ff t5 = MEM_U32(sp + 392);
+// fdead 601ff00ff t9 = t8 + t4;
+// fdead 601ff00ff MEM_U16(sp + 436) = (uint16_t)t9;
+// fdead 601ff00ff v0 = MEM_U16(t5 + 42);
+// fdead 601ff00ff v1 = MEM_U32(sp + 280);
+// fdead 601ff00ff t6 = MEM_U32(sp + 320);
+// fdead 601ff00ff t8 = MEM_U32(sp + 276);
+v1 = v1 + 0x1;
+// fdead 601ff00ff t7 = t6 + v0;
+// fdead 601ff00ff MEM_U32(sp + 320) = t7;
+// fdead 601ff00ff MEM_U32(sp + 280) = v1;
+// fdead 601ff00ff MEM_U16(sp + 438) = (uint16_t)v0;
+if (v1 != t8) goto L415ea4;
+L415f78:
+// fdead 607fff6ff t4 = MEM_U32(sp + 320);
+// fdead 607fff6ff t9 = MEM_U32(sp + 284);
+// fdead 607fff6ff t5 = MEM_U32(sp + 476);
+if (t4 == 0) goto L415f90;
+// fdead 607fff6ff MEM_U32(sp + 324) = t9;
+// fdead 607fff6ff t5 = MEM_U32(sp + 476);
+L415f90:
+s2 = 0x100008d4;
+t6 = t5 & 0x2;
+// fdead 607fff6ff t9 = MEM_U32(sp + 476);
+if (t6 == 0) goto L4160a8;
+// fdead 607fff6ff t7 = MEM_U32(sp + 284);
+// fdead 607fff6ff t4 = MEM_U32(sp + 276);
+t8 = t7 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t8;
+t3 = zero;
+if ((int)t4 <= 0) goto L416090;
+// fdead 607fff6ff MEM_U32(sp + 280) = zero;
+s0 = 0xc;
+L415fc0:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+// fdead 605fe001f t5 = MEM_U32(sp + 412);
+// fdead 605fe001f MEM_U32(sp + 392) = t9;
+a2 = MEM_U32(t9 + 20);
+// fdead 605fe009f t6 = MEM_U32(sp + 416);
+lo = a2 * s0;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+// fdead 605fe009f t3 = MEM_U32(sp + 288);
+// fdead 605fe009f gp = MEM_U32(sp + 52);
+// fdead 605fe009f t7 = t5 + t6;
+// fdead 605fe009f MEM_U32(t9 + 16) = t7;
+// fdead 605fe009f a3 = MEM_U32(sp + 268);
+a1 = s0;
+a0 = lo;
+// fdead 605fe00ff t3 = t3 + a0;
+// fdead 605fe00ff t5 = MEM_U32(sp + 412);
+if (a2 == 0) goto L416058;
+//nop;
+a0 = MEM_U32(v0 + 4);
+// fdead 605fe00ff MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t4 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t9 = MEM_U32(t4 + 20);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t5 = MEM_U32(sp + 412);
+if (v0 == t9) goto L416058;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+// fdead 601fe0007 t5 = MEM_U32(sp + 412);
+L416058:
+// fdead 605fe00ff t6 = MEM_U32(sp + 416);
+// fdead 605fe00ff t8 = MEM_U32(sp + 392);
+// fdead 605fe00ff t7 = t5 + t6;
+// fdead 605fe00ff MEM_U32(sp + 412) = t7;
+// fdead 605fe00ff a0 = MEM_U32(t8 + 20);
+// fdead 605fe00ff t5 = MEM_U32(sp + 280);
+// fdead 605fe00ff t4 = MEM_U32(sp + 328);
+// fdead 605fe00ff t7 = MEM_U32(sp + 276);
+// fdead 605fe00ff t6 = t5 + 0x1;
+// fdead 605fe00ff t9 = t4 + a0;
+// fdead 605fe00ff MEM_U32(sp + 328) = t9;
+// fdead 605fe00ff MEM_U32(sp + 280) = t6;
+// fdead 605fe00ff MEM_U32(sp + 416) = a0;
+if (t6 != t7) goto L415fc0;
+L416090:
+// fdead 607fff6ff t8 = MEM_U32(sp + 328);
+// fdead 607fff6ff t4 = MEM_U32(sp + 284);
+// fdead 607fff6ff t9 = MEM_U32(sp + 476);
+if (t8 == 0) goto L4160a8;
+// fdead 607fff6ff MEM_U32(sp + 332) = t4;
+// fdead 607fff6ff t9 = MEM_U32(sp + 476);
+L4160a8:
+s0 = 0xc;
+t5 = t9 & 0x20;
+// fdead 607fff6ff t4 = MEM_U32(sp + 476);
+if (t5 == 0) goto L4161bc;
+// fdead 607fff6ff t6 = MEM_U32(sp + 284);
+// fdead 607fff6ff t8 = MEM_U32(sp + 276);
+t7 = t6 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L4161a4;
+// fdead 607fff6ff MEM_U32(sp + 280) = zero;
+L4160d4:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(v0 + 0);
+// fdead 601fe201f t9 = MEM_U32(sp + 428);
+// fdead 601fe201f MEM_U32(sp + 392) = t4;
+a2 = MEM_U32(t4 + 36);
+// fdead 601fe209f t5 = MEM_U32(sp + 432);
+lo = a2 * s0;
+hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+// fdead 601fe209f t3 = MEM_U32(sp + 288);
+// fdead 601fe209f gp = MEM_U32(sp + 52);
+// fdead 601fe209f t6 = t9 + t5;
+// fdead 601fe209f MEM_U32(t4 + 32) = t6;
+// fdead 601fe209f a3 = MEM_U32(sp + 268);
+a1 = s0;
+a0 = lo;
+// fdead 601fe20ff t3 = t3 + a0;
+// fdead 601fe20ff t9 = MEM_U32(sp + 428);
+if (a2 == 0) goto L41616c;
+//nop;
+a0 = MEM_U32(v0 + 28);
+// fdead 601fe20ff MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t8 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t4 = MEM_U32(t8 + 36);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t9 = MEM_U32(sp + 428);
+if (v0 == t4) goto L41616c;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+// fdead 601fe0007 t9 = MEM_U32(sp + 428);
+L41616c:
+// fdead 601fe20ff t5 = MEM_U32(sp + 432);
+// fdead 601fe20ff t7 = MEM_U32(sp + 392);
+// fdead 601fe20ff t6 = t9 + t5;
+// fdead 601fe20ff MEM_U32(sp + 428) = t6;
+// fdead 601fe20ff a0 = MEM_U32(t7 + 36);
+// fdead 601fe20ff t9 = MEM_U32(sp + 280);
+// fdead 601fe20ff t8 = MEM_U32(sp + 336);
+// fdead 601fe20ff t6 = MEM_U32(sp + 276);
+// fdead 601fe20ff t5 = t9 + 0x1;
+// fdead 601fe20ff t4 = t8 + a0;
+// fdead 601fe20ff MEM_U32(sp + 336) = t4;
+// fdead 601fe20ff MEM_U32(sp + 280) = t5;
+// fdead 601fe20ff MEM_U32(sp + 432) = a0;
+if (t5 != t6) goto L4160d4;
+L4161a4:
+// fdead 607fff6ff t7 = MEM_U32(sp + 336);
+// fdead 607fff6ff t8 = MEM_U32(sp + 284);
+// fdead 607fff6ff t4 = MEM_U32(sp + 476);
+if (t7 == 0) goto L4161bc;
+// fdead 607fff6ff MEM_U32(sp + 340) = t8;
+// fdead 607fff6ff t4 = MEM_U32(sp + 476);
+L4161bc:
+//nop;
+t9 = t4 & 0x400;
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L4162c8;
+// fdead 607fff6ff t5 = MEM_U32(sp + 284);
+// fdead 607fff6ff t7 = MEM_U32(sp + 276);
+t6 = t5 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t6;
+t3 = zero;
+if ((int)t7 <= 0) goto L4162b0;
+// fdead 607fff6ff MEM_U32(sp + 280) = zero;
+L4161e8:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// fdead 603fe001f t4 = MEM_U32(sp + 440);
+// fdead 603fe001f MEM_U32(sp + 392) = t8;
+// fdead 603fe001f t9 = MEM_U32(sp + 444);
+a2 = MEM_U32(t8 + 48);
+// fdead 603fe009f t3 = MEM_U32(sp + 288);
+// fdead 603fe009f gp = MEM_U32(sp + 52);
+// fdead 603fe009f t5 = t4 + t9;
+a0 = a2 << 2;
+// fdead 603fe00bf MEM_U32(t8 + 44) = t5;
+// fdead 603fe00bf t3 = t3 + a0;
+if (a2 == 0) goto L416274;
+//nop;
+a0 = MEM_U32(v0 + 12);
+// fdead 603fe00bf a3 = MEM_U32(sp + 268);
+// fdead 603fe00bf MEM_U32(sp + 288) = t3;
+a1 = 0x4;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t7 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t8 = MEM_U32(t7 + 48);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t4 = MEM_U32(sp + 440);
+if (v0 == t8) goto L416278;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L416274:
+// fdead 603fe00bf t4 = MEM_U32(sp + 440);
+L416278:
+// fdead 603fe00bf t9 = MEM_U32(sp + 444);
+// fdead 603fe00bf t6 = MEM_U32(sp + 392);
+// fdead 603fe00bf t5 = t4 + t9;
+// fdead 603fe00bf MEM_U32(sp + 440) = t5;
+// fdead 603fe00bf a0 = MEM_U32(t6 + 48);
+// fdead 603fe00bf t4 = MEM_U32(sp + 280);
+// fdead 603fe00bf t7 = MEM_U32(sp + 344);
+// fdead 603fe00bf t5 = MEM_U32(sp + 276);
+// fdead 603fe00bf t9 = t4 + 0x1;
+// fdead 603fe00bf t8 = t7 + a0;
+// fdead 603fe00bf MEM_U32(sp + 344) = t8;
+// fdead 603fe00bf MEM_U32(sp + 280) = t9;
+// fdead 603fe00bf MEM_U32(sp + 444) = a0;
+if (t9 != t5) goto L4161e8;
+L4162b0:
+// fdead 607fff6ff t6 = MEM_U32(sp + 344);
+// fdead 607fff6ff t7 = MEM_U32(sp + 284);
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+if (t6 == 0) goto L4162c8;
+// fdead 607fff6ff MEM_U32(sp + 348) = t7;
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+L4162c8:
+//nop;
+t4 = t8 & 0x80;
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+if (t4 == 0) goto L416440;
+// fdead 607fff6ff t9 = MEM_U32(sp + 284);
+// fdead 607fff6ff t6 = MEM_U32(sp + 276);
+t5 = t9 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t5;
+t3 = zero;
+if ((int)t6 <= 0) goto L4163b8;
+// fdead 607fff6ff MEM_U32(sp + 280) = zero;
+L4162f4:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(v0 + 0);
+// fdead 601ff001f t8 = MEM_U32(sp + 404);
+// fdead 601ff001f t4 = MEM_U32(sp + 408);
+// fdead 601ff001f MEM_U32(sp + 392) = t7;
+// fdead 601ff001f t3 = MEM_U32(sp + 288);
+a2 = MEM_U32(t7 + 12);
+// fdead 601ff009f gp = MEM_U32(sp + 52);
+// fdead 601ff009f t9 = t8 + t4;
+// fdead 601ff009f MEM_U32(t7 + 8) = t9;
+// fdead 601ff009f t3 = t3 + a2;
+if (a2 == 0) goto L41637c;
+//nop;
+a0 = MEM_U32(v0 + 20);
+// fdead 601ff00bf a3 = MEM_U32(sp + 268);
+// fdead 601ff00bf MEM_U32(sp + 288) = t3;
+a1 = 0x1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t6 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t7 = MEM_U32(t6 + 12);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t8 = MEM_U32(sp + 404);
+if (v0 == t7) goto L416380;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L41637c:
+// fdead 601ff009f t8 = MEM_U32(sp + 404);
+L416380:
+// fdead 601ff009f t4 = MEM_U32(sp + 408);
+// fdead 601ff009f t5 = MEM_U32(sp + 392);
+// fdead 601ff009f t9 = t8 + t4;
+// fdead 601ff009f MEM_U32(sp + 404) = t9;
+// fdead 601ff009f a0 = MEM_U32(t5 + 12);
+// fdead 601ff009f t8 = MEM_U32(sp + 280);
+// fdead 601ff009f t6 = MEM_U32(sp + 352);
+// fdead 601ff009f t9 = MEM_U32(sp + 276);
+// fdead 601ff009f t4 = t8 + 0x1;
+// fdead 601ff009f t7 = t6 + a0;
+// fdead 601ff009f MEM_U32(sp + 352) = t7;
+// fdead 601ff009f MEM_U32(sp + 280) = t4;
+// fdead 601ff009f MEM_U32(sp + 408) = a0;
+if (t4 != t9) goto L4162f4;
+L4163b8:
+s0 = -t3;
+t5 = s0 & 0x3;
+s0 = t5;
+if (t5 == 0) goto L416428;
+a0 = 0x10002ef0;
+//nop;
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+a2 = t5;
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L416418;
+a0 = 0x10001e64;
+//nop;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L416418:
+// fdead 601fe000f t3 = t3 + 0x3;
+at = 0xfffffffc;
+// fdead 601fe000f t6 = t3 & at;
+// fdead 601fe000f t3 = t6;
+L416428:
+// fdead 607fff6ff MEM_U32(sp + 352) = t3;
+if (t3 == 0) goto L41643c;
+// fdead 607fff6ff t7 = MEM_U32(sp + 284);
+//nop;
+// fdead 607fff6ff MEM_U32(sp + 356) = t7;
+L41643c:
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+L416440:
+//nop;
+t4 = t8 & 0x800;
+// fdead 607fff6ff t7 = MEM_U32(sp + 476);
+if (t4 == 0) goto L41655c;
+t0 = 0x100054d4;
+// fdead 607fff6ff t5 = MEM_U32(sp + 284);
+v0 = MEM_U32(t0 + 0);
+t6 = t5 + t3;
+t9 = MEM_U32(v0 + 40);
+// fdead 607fff6ff MEM_U32(sp + 284) = t6;
+t3 = zero;
+// fdead 607fff6ff MEM_U32(sp + 360) = t9;
+if (t9 == 0) goto L4164e4;
+t3 = MEM_U32(v0 + 40);
+// fdead 607fff6ff MEM_U32(sp + 364) = t6;
+v1 = MEM_U32(v0 + 40);
+a1 = 0x1;
+a2 = v1;
+if (v1 == 0) goto L4164e4;
+//nop;
+a0 = MEM_U32(v0 + 36);
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+t8 = 0x100054d4;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t4 = MEM_U32(t8 + 40);
+//nop;
+// fdead 603fe200f s0 = -t3;
+if (v0 == t4) goto L4164e8;
+//nop;
+a0 = 0x100008e8;
+// fdead 603fe202f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L4164e4:
+s0 = -t3;
+L4164e8:
+t9 = s0 & 0x3;
+s0 = t9;
+if (t9 == 0) goto L416554;
+a2 = t9;
+//nop;
+a0 = 0x10002ef0;
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+a1 = 0x1;
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+//nop;
+if (v0 == s0) goto L416544;
+a0 = 0x10001e8c;
+//nop;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L416544:
+// fdead 601fe000f t3 = t3 + 0x3;
+at = 0xfffffffc;
+// fdead 601fe000f t5 = t3 & at;
+// fdead 601fe000f t3 = t5;
+L416554:
+// fdead 607fff6ff MEM_U32(sp + 360) = t3;
+// fdead 607fff6ff t7 = MEM_U32(sp + 476);
+L41655c:
+t0 = 0x100054d4;
+s1 = 0x100008e8;
+t6 = t7 & 0x200;
+// fdead 607fff6ff t4 = MEM_U32(sp + 476);
+if (t6 == 0) goto L41661c;
+v0 = MEM_U32(t0 + 0);
+// fdead 607fff6ff t4 = MEM_U32(sp + 284);
+t8 = MEM_U32(v0 + 12);
+t9 = t4 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t9;
+t3 = zero;
+// fdead 607fff6ff MEM_U32(sp + 368) = t8;
+if (t8 == 0) goto L416610;
+t3 = MEM_U32(v0 + 12);
+// fdead 607fff6ff MEM_U32(sp + 372) = t9;
+t7 = t3 << 3;
+v1 = MEM_U32(v0 + 12);
+t7 = t7 + t3;
+t7 = t7 << 3;
+t3 = t7;
+if (v1 == 0) goto L416610;
+//nop;
+a0 = MEM_U32(v0 + 8);
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+// fdead 607fff6ff MEM_U32(sp + 288) = t7;
+a1 = 0x48;
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+t6 = 0x100054d4;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+t8 = MEM_U32(t6 + 12);
+//nop;
+//nop;
+if (v0 == t8) goto L416610;
+//nop;
+a0 = s1;
+// fdead 603fe802f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L416610:
+t0 = 0x100054d4;
+//nop;
+// fdead 607fff6ff t4 = MEM_U32(sp + 476);
+L41661c:
+// fdead 607fff6ff t7 = MEM_U32(sp + 284);
+t5 = t4 & 0x40;
+t9 = t7 + t3;
+if (t5 == 0) goto L416724;
+// fdead 607fff6ff t6 = MEM_U32(sp + 276);
+// fdead 607fff6ff MEM_U32(sp + 284) = t9;
+t3 = zero;
+if ((int)t6 <= 0) goto L416710;
+// fdead 607fff6ff MEM_U32(sp + 280) = zero;
+L416640:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 280);
+// fdead 607fff6ff MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// fdead 603fe001f t4 = MEM_U32(sp + 448);
+// fdead 603fe001f MEM_U32(sp + 392) = t8;
+// fdead 603fe001f t5 = MEM_U32(sp + 452);
+a2 = MEM_U32(t8 + 56);
+// fdead 603fe009f t3 = MEM_U32(sp + 288);
+// fdead 603fe009f gp = MEM_U32(sp + 52);
+// fdead 603fe009f t7 = t4 + t5;
+a0 = a2 << 2;
+// fdead 603fe00bf MEM_U32(t8 + 52) = t7;
+// fdead 603fe00bf t3 = t3 + a0;
+if (a2 == 0) goto L4166cc;
+//nop;
+a0 = MEM_U32(v0 + 44);
+// fdead 603fe00bf a3 = MEM_U32(sp + 268);
+// fdead 603fe00bf MEM_U32(sp + 288) = t3;
+a1 = 0x4;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f t6 = MEM_U32(sp + 392);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t8 = MEM_U32(t6 + 56);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+// fdead 601fe000f t4 = MEM_U32(sp + 448);
+if (v0 == t8) goto L4166d0;
+//nop;
+a0 = s2;
+// fdead 601fe002f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L4166cc:
+// fdead 603fe00bf t4 = MEM_U32(sp + 448);
+L4166d0:
+// fdead 603fe00bf t5 = MEM_U32(sp + 452);
+// fdead 603fe00bf t9 = MEM_U32(sp + 392);
+// fdead 603fe00bf t7 = t4 + t5;
+// fdead 603fe00bf MEM_U32(sp + 448) = t7;
+// fdead 603fe00bf a0 = MEM_U32(t9 + 56);
+// fdead 603fe00bf t4 = MEM_U32(sp + 280);
+// fdead 603fe00bf t6 = MEM_U32(sp + 376);
+// fdead 603fe00bf t7 = MEM_U32(sp + 276);
+// fdead 603fe00bf t5 = t4 + 0x1;
+// fdead 603fe00bf t8 = t6 + a0;
+// fdead 603fe00bf MEM_U32(sp + 376) = t8;
+// fdead 603fe00bf MEM_U32(sp + 280) = t5;
+// fdead 603fe00bf MEM_U32(sp + 452) = a0;
+if (t5 != t7) goto L416640;
+t0 = 0x100054d4;
+//nop;
+L416710:
+// fdead 607fff6ff t9 = MEM_U32(sp + 376);
+// fdead 607fff6ff t6 = MEM_U32(sp + 284);
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+if (t9 == 0) goto L416728;
+// fdead 607fff6ff MEM_U32(sp + 380) = t6;
+L416724:
+// fdead 607fff6ff t8 = MEM_U32(sp + 476);
+L416728:
+//nop;
+t4 = t8 & 0x1;
+// fdead 607fff6ff t7 = MEM_U32(sp + 476);
+if (t4 == 0) goto L4167dc;
+v0 = MEM_U32(t0 + 0);
+// fdead 607fff6ff t7 = MEM_U32(sp + 284);
+t5 = MEM_U32(v0 + 28);
+t9 = t7 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t9;
+t3 = zero;
+// fdead 607fff6ff MEM_U32(sp + 384) = t5;
+if (t5 == 0) goto L4167d0;
+t3 = MEM_U32(v0 + 28);
+// fdead 607fff6ff MEM_U32(sp + 388) = t9;
+v1 = MEM_U32(v0 + 28);
+t8 = t3 << 4;
+t3 = t8;
+if (v1 == 0) goto L4167d0;
+//nop;
+a0 = MEM_U32(v0 + 24);
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+// fdead 607fff6ff MEM_U32(sp + 288) = t8;
+a1 = 0x10;
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f t3 = MEM_U32(sp + 288);
+t4 = 0x100054d4;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 28);
+//nop;
+//nop;
+if (v0 == t5) goto L4167d0;
+//nop;
+a0 = s1;
+// fdead 601fe602f MEM_U32(sp + 288) = t3;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+// fdead 601fe0007 t3 = MEM_U32(sp + 288);
+//nop;
+L4167d0:
+t0 = 0x100054d4;
+//nop;
+// fdead 607fff6ff t7 = MEM_U32(sp + 476);
+L4167dc:
+//nop;
+t6 = t7 & 0x10;
+//nop;
+if (t6 == 0) goto L4168cc;
+v0 = MEM_U32(t0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 60);
+//nop;
+//nop;
+if (t8 == 0) goto L4168cc;
+t9 = MEM_U32(v0 + 56);
+//nop;
+MEM_U32(t9 + 0) = zero;
+t4 = MEM_U32(t0 + 0);
+//nop;
+t5 = MEM_U32(t4 + 56);
+//nop;
+MEM_U32(t5 + 4) = zero;
+t7 = MEM_U32(t0 + 0);
+//nop;
+t6 = MEM_U32(t7 + 56);
+//nop;
+MEM_U32(t6 + 8) = zero;
+t8 = MEM_U32(t0 + 0);
+//nop;
+t9 = MEM_U32(t8 + 56);
+//nop;
+MEM_U32(t9 + 12) = zero;
+v0 = MEM_U32(t0 + 0);
+// fdead 607fff6ff t5 = MEM_U32(sp + 284);
+t4 = MEM_U32(v0 + 60);
+t7 = t5 + t3;
+// fdead 607fff6ff MEM_U32(sp + 284) = t7;
+// fdead 607fff6ff MEM_U32(sp + 312) = t4;
+if (t4 == 0) goto L4168cc;
+// fdead 607fff6ff MEM_U32(sp + 316) = t7;
+v1 = MEM_U32(v0 + 60);
+// fdead 607fff6ff a3 = MEM_U32(sp + 268);
+a1 = 0x8;
+if (v1 == 0) goto L4168cc;
+//nop;
+a0 = MEM_U32(v0 + 56);
+a2 = v1;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+//nop;
+t8 = 0x100054d4;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+t9 = MEM_U32(t8 + 60);
+//nop;
+//nop;
+if (v0 == t9) goto L4168cc;
+//nop;
+a0 = s1;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+//nop;
+L4168cc:
+//nop;
+// fdead 607fff6ff a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f a0 = MEM_U32(sp + 268);
+//nop;
+// fdead 601fe000f a1 = MEM_U32(sp + 272);
+a2 = zero;
+v0 = wrapper_fseek(mem, a0, a1, a2);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+t4 = 0x313;
+t5 = 0x100008d0;
+//nop;
+t5 = MEM_S16(t5 + 0);
+// fdead 601fe600f a3 = MEM_U32(sp + 268);
+// fdead 601fe600f MEM_U16(sp + 298) = (uint16_t)t4;
+// fdead 601fe600f a0 = sp + 0x128;
+a1 = 0x1;
+a2 = 0x60;
+// fdead 601fe60cf MEM_U16(sp + 296) = (uint16_t)t5;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+at = 0x60;
+//nop;
+if (v0 == at) goto L416950;
+a0 = 0x10001eb4;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 601fe0007 gp = MEM_U32(sp + 52);
+//nop;
+L416950:
+//nop;
+// fdead 601fe000f a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+// fdead 601fe000f ra = MEM_U32(sp + 60);
+// fdead 601fe000f gp = MEM_U32(sp + 52);
+// fdead 601fe000f s0 = MEM_U32(sp + 20);
+// fdead 601fe000f s1 = MEM_U32(sp + 24);
+// fdead 601fe000f s2 = MEM_U32(sp + 28);
+// fdead 601fe000f s3 = MEM_U32(sp + 32);
+// fdead 601fe000f s4 = MEM_U32(sp + 36);
+// fdead 601fe000f s5 = MEM_U32(sp + 40);
+// fdead 601fe000f s6 = MEM_U32(sp + 44);
+// fdead 601fe000f s7 = MEM_U32(sp + 48);
+// fdead 601fe000f fp = MEM_U32(sp + 56);
+// fdead 601fe000f sp = sp + 0x1d8;
+return;
+}
+
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4169b4:
+//st_symadd:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+t6 = 0x100054d4;
+// fdead 81eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 81eb MEM_U32(sp + 24) = gp;
+// fdead 81eb MEM_U32(sp + 40) = a0;
+// fdead 81eb MEM_U32(sp + 44) = a1;
+// fdead 81eb MEM_U32(sp + 48) = a2;
+// fdead 81eb MEM_U32(sp + 52) = a3;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L416a10;
+a0 = 0x10000900;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L416a10:
+t0 = 0x100054d8;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L416a54;
+a0 = 0x1000093c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x100054d8;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+L416a54:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x2;
+//nop;
+if (t9 == 0) goto L416a94;
+a0 = 0x10000970;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x100054d8;
+//nop;
+v1 = MEM_U32(t0 + 0);
+//nop;
+L416a94:
+t1 = MEM_U32(v1 + 0);
+t2 = MEM_U32(v1 + 8);
+a1 = MEM_U32(t1 + 20);
+a2 = 0xc;
+a3 = 0x40;
+if ((int)a1 < (int)t2) goto L416af4;
+//nop;
+a0 = MEM_U32(v1 + 4);
+a1 = v1 + 0x8;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t0 = 0x100054d8;
+//nop;
+t3 = MEM_U32(t0 + 0);
+//nop;
+MEM_U32(t3 + 4) = v0;
+v1 = MEM_U32(t0 + 0);
+//nop;
+t4 = MEM_U32(v1 + 0);
+//nop;
+a1 = MEM_U32(t4 + 20);
+//nop;
+L416af4:
+t6 = a1 << 2;
+t5 = MEM_U32(v1 + 4);
+t6 = t6 - a1;
+// fdead 601ffff t7 = MEM_U32(sp + 40);
+t6 = t6 << 2;
+v0 = t5 + t6;
+MEM_U32(v0 + 0) = t7;
+// fdead 601ffff t8 = MEM_U32(sp + 44);
+t4 = MEM_U8(v0 + 8);
+MEM_U32(v0 + 4) = t8;
+// fdead 601ffff t1 = MEM_U32(sp + 48);
+t5 = t4 & 0xff03;
+t3 = t1 << 2;
+t6 = t3 | t5;
+MEM_U8(v0 + 8) = (uint8_t)t6;
+// fdead 601ffff t8 = MEM_U32(sp + 52);
+t2 = MEM_U16(v0 + 8);
+t9 = t8 << 5;
+t1 = t9 & 0x3e0;
+t4 = t2 & 0xfc1f;
+t3 = t1 | t4;
+MEM_U16(v0 + 8) = (uint16_t)t3;
+t5 = MEM_U8(v0 + 9);
+at = 0xf0000;
+t6 = t5 & 0xffef;
+MEM_U8(v0 + 9) = (uint8_t)t6;
+// fdead 601ffff t7 = MEM_U32(sp + 56);
+a2 = MEM_U32(v0 + 8);
+at = at | 0xffff;
+t8 = t7 & at;
+t9 = t8 ^ a2;
+t2 = t9 << 12;
+t1 = t2 >> 12;
+t4 = t1 ^ a2;
+MEM_U32(v0 + 8) = t4;
+//nop;
+// fdead 601ffff a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_st_str_iss(mem, sp, a0, a1, a2, a3);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f MEM_U32(sp + 32) = v0;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t5 = MEM_U32(sp + 48);
+t0 = 0x100054d8;
+// fdead 20f t6 = MEM_U32(sp + 52);
+t3 = MEM_U32(t0 + 0);
+// fdead 120f t7 = t5 + t6;
+v1 = MEM_U32(t3 + 0);
+a2 = v0;
+t9 = MEM_U32(v1 + 60);
+t4 = MEM_U16(v1 + 62);
+// fdead 400329f t2 = t9 + t7;
+// fdead 400329f t1 = t2 & 0x1fff;
+t3 = t4 & 0xe000;
+// fdead 400329f t5 = t1 | t3;
+a0 = zero;
+// fdead 40032bf MEM_U16(v1 + 62) = (uint16_t)t5;
+if ((int)v0 <= 0) goto L416c34;
+// fdead 40032bf a1 = MEM_U32(sp + 32);
+//nop;
+L416bf4:
+t6 = MEM_U32(t0 + 0);
+// fdead 601febf t9 = MEM_S8(a1 + 0);
+v1 = MEM_U32(t6 + 0);
+a0 = a0 + 0x1;
+t8 = MEM_U32(v1 + 60);
+t5 = MEM_U16(v1 + 62);
+t7 = t8 << 5;
+t2 = t9 + t7;
+t1 = t2 + t8;
+t3 = t1 & 0x1fff;
+t6 = t5 & 0xe000;
+at = (int)a0 < (int)a2;
+t8 = t3 | t6;
+// fdead 601febf a1 = a1 + 0x1;
+MEM_U16(v1 + 62) = (uint16_t)t8;
+if (at != 0) goto L416bf4;
+L416c34:
+// fdead 601febf t9 = MEM_U32(sp + 48);
+at = 0xe;
+if (t9 == at) {
+at = 0x2;
+goto L416c5c;}
+at = 0x2;
+if (t9 == at) {
+at = 0x5;
+goto L416c5c;}
+at = 0x5;
+if (t9 == at) {
+at = 0x6;
+goto L416c5c;}
+at = 0x6;
+//nop;
+if (t9 != at) goto L416c7c;
+L416c5c:
+t7 = MEM_U32(t0 + 0);
+//nop;
+v1 = MEM_U32(t7 + 0);
+//nop;
+t2 = MEM_U8(v1 + 60);
+//nop;
+t4 = t2 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t4;
+L416c7c:
+t1 = MEM_U32(t0 + 0);
+//nop;
+v1 = MEM_U32(t1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 20);
+//nop;
+t5 = v0 + 0x1;
+MEM_U32(v1 + 20) = t5;
+// fdead 601febf ra = MEM_U32(sp + 28);
+// fdead 601febf sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0;
+L416cac:
+//st_ifd_pcfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 80eb sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 80eb MEM_U32(sp + 28) = ra;
+// fdead 80eb MEM_U32(sp + 24) = gp;
+// fdead 80eb MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L416cfc;
+a0 = 0x10000900;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L416cfc:
+t8 = 0x100054d8;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 != 0) goto L416d30;
+a0 = 0x1000093c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L416d30:
+t0 = 0x100054d4;
+// fdead 20182eb t9 = MEM_U32(sp + 32);
+t0 = MEM_U32(t0 + 0);
+// fdead 20182eb ra = MEM_U32(sp + 28);
+t1 = MEM_U32(t0 + 4);
+// fdead 20186eb sp = sp + 0x20;
+// fdead 20186eb v0 = t9 - t1;
+t2 = (int)v0 >> 6;
+v0 = t2;
+return v0;
+}
+
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416d58:
+//st_pcfd_ifd:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a1 = a0;
+//nop;
+if (t7 != 0) goto L416da8;
+a0 = 0x10000900;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+//nop;
+L416da8:
+//nop;
+if ((int)a1 < 0) goto L416dd4;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t8 = MEM_U32(v1 + 12);
+//nop;
+//nop;
+if ((int)a1 < (int)t8) goto L416e00;
+L416dd4:
+a0 = 0x10001ed0;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L416e00:
+t9 = MEM_U32(v1 + 4);
+// bdead 4000041 ra = MEM_U32(sp + 28);
+t0 = a1 << 6;
+// bdead 4000201 sp = sp + 0x20;
+v0 = t9 + t0;
+return v0;
+}
+
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416e18:
+//st_psym_ifd_isym:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 28) = ra;
+// fdead 400080eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L416e70;
+a0 = 0x10000900;
+//nop;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+//nop;
+L416e70:
+at = 0x7fff0000;
+at = at | 0xffff;
+//nop;
+if (a3 != at) goto L416e9c;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+v0 = v0 + 0x4;
+goto L416f4c;
+L416e9c:
+a1 = a3;
+if ((int)a3 < 0) goto L416ef8;
+//nop;
+if ((int)a2 < 0) goto L416ef8;
+v0 = 0x100054d4;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L416ef8;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 20);
+//nop;
+t8 = a2 << 2;
+if ((int)a2 < (int)t2) goto L416f3c;
+L416ef8:
+a0 = 0x10001ef4;
+//nop;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+t4 = 0x100054d4;
+a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+v1 = t5 + t6;
+t8 = a2 << 2;
+L416f3c:
+t7 = MEM_U32(v1 + 4);
+t8 = t8 - a2;
+t8 = t8 << 2;
+v0 = t7 + t8;
+L416f4c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416f5c:
+//st_paux_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 800b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 800b MEM_U32(sp + 28) = ra;
+// fdead 800b MEM_U32(sp + 24) = gp;
+// fdead 800b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L416fac;
+a0 = 0x10000900;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L416fac:
+t8 = 0x100054d8;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+// fdead 201800b t9 = MEM_U32(sp + 32);
+if (t8 != 0) goto L416fe4;
+a0 = 0x1000093c;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 3 t9 = MEM_U32(sp + 32);
+L416fe4:
+//nop;
+//nop;
+if ((int)t9 < 0) goto L41701c;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t0 = MEM_U32(v1 + 0);
+//nop;
+t1 = MEM_U32(t0 + 48);
+//nop;
+// fdead 201861b at = (int)t9 < (int)t1;
+// fdead 201861b t3 = MEM_U32(sp + 32);
+if (at != 0) goto L41704c;
+L41701c:
+a0 = 0x10001f2c;
+//nop;
+// fdead 201863b a1 = MEM_U32(sp + 32);
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+// fdead 13 t3 = MEM_U32(sp + 32);
+L41704c:
+t2 = MEM_U32(v1 + 12);
+// fdead 2018e1b ra = MEM_U32(sp + 28);
+// fdead 2018e1b t4 = t3 << 2;
+// fdead 2018e1b sp = sp + 0x20;
+// fdead 2018e1b v0 = t2 + t4;
+return v0;
+}
+
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L417064:
+//st_str_ifd_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a2 = a0;
+at = 0x7fff0000;
+if (t7 != 0) goto L4170c0;
+a0 = 0x10000900;
+//nop;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 32) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 32);
+//nop;
+at = 0x7fff0000;
+L4170c0:
+at = at | 0xffff;
+//nop;
+if (a2 != at) goto L4170e8;
+//nop;
+a0 = a1;
+//nop;
+v0 = f__md_st_str_extiss(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L41712c;
+L4170e8:
+//nop;
+a0 = a2;
+MEM_U32(sp + 36) = a1;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+a1 = MEM_U32(sp + 36);
+v1 = MEM_U32(t8 + 12);
+// bdead 5b gp = MEM_U32(sp + 24);
+at = (int)a1 < (int)v1;
+if (v1 == 0) goto L417124;
+//nop;
+if ((int)a1 >= (int)v1) goto L417124;
+t9 = MEM_U32(v0 + 20);
+v0 = t9 + a1;
+goto L417128;
+L417124:
+v0 = zero;
+L417128:
+// bdead 9 ra = MEM_U32(sp + 28);
+L41712c:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L417214:
+//st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x100054d8;
+// fdead eb sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead eb MEM_U32(sp + 28) = ra;
+// fdead eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L417240;
+v0 = 0xffffffff;
+goto L417258;
+L417240:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+L417258:
+// fdead eb ra = MEM_U32(sp + 28);
+// fdead eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t6 = 0;
+L417268:
+//st_ifdmax:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+v0 = MEM_U32(t6 + 12);
+//nop;
+return v0;
+}
+
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L417290:
+//st_setfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 806b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 806b MEM_U32(sp + 28) = ra;
+// fdead 806b MEM_U32(sp + 24) = gp;
+// fdead 806b MEM_U32(sp + 32) = a0;
+v0 = MEM_U32(t6 + 4);
+//nop;
+// fdead 806b t8 = MEM_U32(sp + 32);
+if (v0 != 0) goto L4172fc;
+a0 = 0x100009b0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+t7 = 0x100054d4;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+v0 = MEM_U32(t7 + 4);
+//nop;
+// fdead 1000b t8 = MEM_U32(sp + 32);
+L4172fc:
+at = 0x100054d8;
+// fdead 1806f ra = MEM_U32(sp + 28);
+// fdead 1806f t9 = t8 << 6;
+// fdead 1806f t0 = v0 + t9;
+// fdead 1806f sp = sp + 0x20;
+// fdead 1806f MEM_U32(at + 0) = t0;
+return;
+}
+
+static void f_st_fdadd(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L417318:
+//st_fdadd:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffff10;
+t2 = 0x100054d4;
+// fdead 80b MEM_U32(sp + 28) = ra;
+t0 = MEM_U32(t2 + 0);
+// fdead a0b MEM_U32(sp + 24) = gp;
+// fdead a0b MEM_U32(sp + 240) = a0;
+// fdead a0b MEM_U32(sp + 244) = a1;
+// fdead a0b MEM_U32(sp + 248) = a2;
+// fdead a0b MEM_U32(sp + 252) = a3;
+t6 = MEM_U32(t0 + 12);
+at = 0x7fff0000;
+at = at | 0xffff;
+// fdead 8a0f MEM_U32(sp + 40) = t6;
+if ((int)t6 < (int)at) goto L4173a0;
+a0 = 0x10001f60;
+//nop;
+a2 = 0x7fff0000;
+a2 = a2 | 0xffff;
+a1 = t6;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x100054d4;
+//nop;
+t0 = MEM_U32(t2 + 0);
+//nop;
+t8 = MEM_U32(t0 + 12);
+//nop;
+// fdead 2000a07 MEM_U32(sp + 40) = t8;
+L4173a0:
+v0 = MEM_U32(t0 + 16);
+// fdead 2008a0f t9 = MEM_U32(sp + 40);
+a1 = t0 + 0x10;
+// fdead 2008a4f at = (int)t9 < (int)v0;
+a2 = 0x40;
+if (at != 0) goto L4174a0;
+//nop;
+// fdead 2008acf MEM_U32(sp + 236) = v0;
+a0 = MEM_U32(t0 + 4);
+// fdead 2008aef MEM_U32(sp + 232) = v0;
+a3 = 0x19;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = sp + 0xec;
+t2 = 0x100054d4;
+a2 = 0x48;
+t3 = MEM_U32(t2 + 0);
+a3 = 0x19;
+MEM_U32(t3 + 4) = v0;
+t4 = MEM_U32(t2 + 0);
+//nop;
+a0 = MEM_U32(t4 + 8);
+//nop;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t1 = MEM_U32(sp + 232);
+t2 = 0x100054d4;
+//nop;
+t5 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t5 + 8) = v0;
+t6 = MEM_U32(t2 + 0);
+// fdead c80f t7 = MEM_U32(sp + 236);
+a2 = MEM_U32(t6 + 16);
+// fdead c88f a3 = MEM_U32(sp + 240);
+// fdead c88f a1 = t7;
+if (t7 == a2) goto L417458;
+a0 = 0x10001f94;
+//nop;
+// fdead c8af MEM_U32(sp + 232) = t1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 t1 = MEM_U32(sp + 232);
+t2 = 0x100054d4;
+//nop;
+L417458:
+// fdead c88f a0 = t1;
+if (t1 == 0) {
+// fdead c88f t1 = t1 + 0xffffffff;
+goto L4174a0;}
+// fdead c88f t1 = t1 + 0xffffffff;
+// fdead c88f v1 = t1 << 3;
+// fdead c88f v1 = v1 + t1;
+// fdead c88f v1 = v1 << 3;
+// fdead c88f v0 = t1 << 6;
+L417474:
+t0 = MEM_U32(t2 + 0);
+// fdead 200fa8f a0 = t1;
+t8 = MEM_U32(t0 + 8);
+t3 = MEM_U32(t0 + 4);
+// fdead 200fa8f t9 = t8 + v1;
+t4 = t3 + v0;
+// fdead 200fa8f MEM_U32(t4 + 0) = t9;
+v0 = v0 + 0xffffffc0;
+// fdead 200fa8f v1 = v1 + 0xffffffb8;
+if (t1 != 0) {
+// fdead 200fa8f t1 = t1 + 0xffffffff;
+goto L417474;}
+// fdead 200fa8f t1 = t1 + 0xffffffff;
+L4174a0:
+t0 = MEM_U32(t2 + 0);
+t9 = 0x10002f48;
+t6 = MEM_U32(t0 + 12);
+t5 = MEM_U32(t0 + 4);
+a1 = 0x100054d8;
+t7 = t6 << 6;
+t9 = t9;
+t3 = t5 + t7;
+t6 = t9 + 0x3c;
+MEM_U32(a1 + 0) = t3;
+L4174c8:
+at = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+MEM_U32(t3 + 0) = at;
+at = MEM_U32(t9 + -8);
+t3 = t3 + 0xc;
+MEM_U32(t3 + -8) = at;
+at = MEM_U32(t9 + -4);
+MEM_U32(t3 + -4) = at;
+if (t9 != t6) goto L4174c8;
+at = MEM_U32(t9 + 0);
+//nop;
+MEM_U32(t3 + 0) = at;
+t0 = MEM_U32(t2 + 0);
+t6 = MEM_U32(a1 + 0);
+t5 = MEM_U32(t0 + 12);
+t8 = MEM_U32(t0 + 8);
+t7 = t5 << 3;
+t7 = t7 + t5;
+t7 = t7 << 3;
+t4 = t7 + t8;
+MEM_U32(t6 + 0) = t4;
+t0 = MEM_U32(t2 + 0);
+t8 = 0x10002f00;
+t9 = MEM_U32(t0 + 12);
+t8 = t8;
+t3 = t9 + 0x1;
+MEM_U32(t0 + 12) = t3;
+t5 = MEM_U32(a1 + 0);
+t6 = t8 + 0x48;
+t7 = MEM_U32(t5 + 0);
+//nop;
+L417544:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t7 + 0) = at;
+at = MEM_U32(t8 + -8);
+t7 = t7 + 0xc;
+MEM_U32(t7 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t7 + -4) = at;
+if (t8 != t6) goto L417544;
+t9 = MEM_U32(a1 + 0);
+// fdead 601facf t5 = MEM_U32(sp + 244);
+v1 = MEM_U32(t9 + 0);
+t6 = t5 << 3;
+t8 = MEM_U8(v1 + 60);
+//nop;
+t7 = t8 & 0xff07;
+t9 = t6 | t7;
+MEM_U8(v1 + 60) = (uint8_t)t9;
+t3 = MEM_U32(a1 + 0);
+// fdead 601fadf t4 = MEM_U32(sp + 248);
+v1 = MEM_U32(t3 + 0);
+t8 = t4 << 2;
+t7 = MEM_U8(v1 + 60);
+t6 = t8 & 0x4;
+t9 = t7 & 0xfffb;
+t3 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t3;
+t5 = MEM_U32(a1 + 0);
+// fdead 601fadf t8 = MEM_U32(sp + 252);
+v1 = MEM_U32(t5 + 0);
+t6 = t8 << 6;
+t9 = MEM_U8(v1 + 61);
+//nop;
+t3 = t9 & 0xff3f;
+t5 = t6 | t3;
+MEM_U8(v1 + 61) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// fdead f gp = MEM_U32(sp + 24);
+t7 = v0 < 0x1;
+a1 = 0x100054d8;
+t9 = t7 & 0x1;
+t4 = MEM_U32(a1 + 0);
+a0 = 0x10001fcc;
+v1 = MEM_U32(t4 + 0);
+a0 = a0;
+t6 = MEM_U8(v1 + 60);
+//nop;
+t3 = t6 & 0xfffe;
+t5 = t9 | t3;
+MEM_U8(v1 + 60) = (uint8_t)t5;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = MEM_U32(sp + 240);
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x100054d8;
+t7 = 0x10000a80;
+t4 = MEM_U32(a1 + 0);
+//nop;
+t8 = MEM_U32(t4 + 0);
+//nop;
+MEM_U32(t8 + 4) = v0;
+t7 = MEM_U32(t7 + 0);
+// fdead 201204f t6 = MEM_U32(sp + 252);
+// fdead 201204f ra = MEM_U32(sp + 28);
+if (t7 != 0) goto L417a18;
+// fdead 201204f at = (int)t6 < (int)0x3;
+if (t6 == 0) goto L417684;
+// fdead 201204f ra = MEM_U32(sp + 28);
+if (at != 0) goto L417a18;
+L417684:
+a0 = 0x10001fd0;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+t3 = 0x1;
+t9 = 0x10000a5c;
+a1 = 0x40;
+t9 = MEM_S8(t9 + 0);
+//nop;
+// fdead 400104f t4 = MEM_U32(sp + 240);
+if (t9 != 0) goto L417838;
+at = 0x10000a5c;
+a0 = 0x10002f88;
+//nop;
+MEM_U8(at + 0) = (uint8_t)t3;
+a0 = a0;
+v0 = wrapper_gethostname(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v0 >= 0) goto L417700;
+a0 = 0x10002f88;
+a1 = 0x10001fdc;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+goto L417720;
+L417700:
+a0 = 0x10002f88;
+a1 = 0x10001fe0;
+//nop;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L417720:
+//nop;
+// fdead f a0 = MEM_U32(sp + 240);
+a1 = 0x5;
+v0 = wrapper_pathconf(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 >= (int)0x5) goto L417744;
+v1 = 0x5;
+L417744:
+t5 = v1 << 2;
+v0 = t5 << 2;
+//nop;
+v0 = v0 - t5;
+v0 = v0 + 0xa;
+a0 = v0;
+// fdead 403f MEM_U32(sp + 44) = v0;
+// fdead 403f MEM_U32(sp + 228) = t5;
+v0 = wrapper_malloc(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f v1 = MEM_U32(sp + 228);
+at = 0x10002fd0;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L4177a0;
+a0 = 0x10001fe4;
+//nop;
+// fdead 2f a1 = MEM_U32(sp + 44);
+// fdead 2f MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 v1 = MEM_U32(sp + 228);
+//nop;
+L4177a0:
+//nop;
+// fdead f a1 = MEM_U32(sp + 44);
+a0 = zero;
+// fdead 2f MEM_U32(sp + 228) = v1;
+v0 = wrapper_getcwd(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f v1 = MEM_U32(sp + 228);
+at = 0x10002fd4;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L4177ec;
+a0 = 0x10002010;
+//nop;
+// fdead 2f a1 = MEM_U32(sp + 44);
+// fdead 2f MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 v1 = MEM_U32(sp + 228);
+//nop;
+L4177ec:
+//nop;
+// fdead f a1 = v1 << 2;
+// fdead f a1 = a1 + 0xa;
+// fdead f a0 = a1;
+// fdead f MEM_U32(sp + 44) = a1;
+v0 = wrapper_malloc(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = MEM_U32(sp + 44);
+at = 0x10002fcc;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L417834;
+a0 = 0x1000203c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+L417834:
+// fdead f t4 = MEM_U32(sp + 240);
+L417838:
+at = 0x2f;
+// fdead 400104f t8 = MEM_S8(t4 + 0);
+// fdead 400104f a1 = MEM_U32(sp + 240);
+//nop;
+if (t8 == at) goto L4178b0;
+a0 = 0x10002fd0;
+a1 = 0x10002fd4;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10002fd0;
+a1 = 0x10002078;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a1 = MEM_U32(sp + 240);
+a0 = 0x10002fd0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+goto L4178cc;
+L4178b0:
+a0 = 0x10002fd0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L4178cc:
+a0 = 0x10002fcc;
+a1 = 0x10002f88;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10002fcc;
+a1 = 0x10002fd0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10002fcc;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+t6 = 0x1;
+t7 = 0x10000a60;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 != 0) goto L417988;
+at = 0x10000a60;
+//nop;
+a0 = zero;
+MEM_U32(at + 0) = t6;
+v0 = wrapper_time(mem, a0);
+// fdead f gp = MEM_U32(sp + 24);
+a2 = v0;
+at = 0x10002ff8;
+a0 = 0x10002fd8;
+a1 = 0x1000207c;
+//nop;
+MEM_U32(at + 0) = v0;
+a0 = a0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+L417988:
+a0 = 0x10002fd8;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = MEM_U32(sp + 240);
+//nop;
+// fdead f a1 = sp + 0x38;
+//nop;
+v0 = wrapper_stat(mem, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = sp + 0xc0;
+if ((int)v0 >= 0) goto L4179e0;
+a0 = 0x10002080;
+//nop;
+a0 = a0;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f ra = MEM_U32(sp + 28);
+goto L417a18;
+L4179e0:
+a1 = 0x10002084;
+//nop;
+// fdead 4f a2 = MEM_U32(sp + 104);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f a0 = sp + 0xc0;
+//nop;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+// fdead f ra = MEM_U32(sp + 28);
+L417a18:
+// fdead 201204f sp = sp + 0xf0;
+//nop;
+return;
+}
+
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L417a24:
+//st_auxadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 806b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 806b MEM_U32(sp + 28) = ra;
+// fdead 806b MEM_U32(sp + 24) = gp;
+// fdead 806b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L417a74;
+a0 = 0x100009b0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L417a74:
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L417ab8;
+a0 = 0x100009ec;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417ab8:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x400;
+//nop;
+if (t9 == 0) goto L417af8;
+a0 = 0x10000a20;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417af8:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 16);
+a0 = MEM_U32(t0 + 48);
+a1 = v1 + 0x10;
+a2 = 0x4;
+if ((int)a0 < (int)t1) goto L417b58;
+//nop;
+a0 = MEM_U32(v1 + 12);
+a3 = 0x40;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x100054d8;
+v1 = 0x100054d8;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 12) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U32(t3 + 48);
+//nop;
+L417b58:
+t4 = MEM_U32(v1 + 12);
+// fdead 601beff t7 = sp + 0x20;
+at = MEM_U32(t7 + 0);
+t5 = a0 << 2;
+t0 = 0x100054d8;
+t6 = t4 + t5;
+MEM_U32(t6 + 0) = at;
+t0 = MEM_U32(t0 + 0);
+//nop;
+a1 = MEM_U32(t0 + 0);
+//nop;
+v0 = MEM_U32(a1 + 48);
+//nop;
+t1 = v0 + 0x1;
+MEM_U32(a1 + 48) = t1;
+// fdead 601feff ra = MEM_U32(sp + 28);
+// fdead 601feff sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L417ba4:
+//st_pdadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 802b sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 802b MEM_U32(sp + 28) = ra;
+// fdead 802b MEM_U32(sp + 24) = gp;
+// fdead 802b MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L417bf4;
+a0 = 0x100009b0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L417bf4:
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L417c38;
+a0 = 0x100009ec;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417c38:
+t8 = MEM_U32(v1 + 60);
+//nop;
+t9 = t8 & 0x100;
+//nop;
+if (t9 == 0) goto L417c78;
+a0 = 0x10000a20;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L417c78:
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 56);
+a0 = MEM_U16(t0 + 42);
+a1 = v1 + 0x38;
+a2 = 0x34;
+if (a0 < t1) goto L417cd8;
+//nop;
+a0 = MEM_U32(v1 + 52);
+a3 = 0x20;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+//nop;
+t2 = 0x100054d8;
+v1 = 0x100054d8;
+t2 = MEM_U32(t2 + 0);
+//nop;
+MEM_U32(t2 + 52) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t3 = MEM_U32(v1 + 0);
+//nop;
+a0 = MEM_U16(t3 + 42);
+//nop;
+L417cd8:
+a3 = 0x34;
+lo = a0 * a3;
+hi = (uint32_t)((uint64_t)a0 * (uint64_t)a3 >> 32);
+t7 = 0x10003000;
+t4 = MEM_U32(v1 + 52);
+t7 = t7;
+t9 = t7 + 0x30;
+t5 = lo;
+t6 = t4 + t5;
+//nop;
+L417cfc:
+at = MEM_U32(t7 + 0);
+t7 = t7 + 0xc;
+MEM_U32(t6 + 0) = at;
+at = MEM_U32(t7 + -8);
+t6 = t6 + 0xc;
+MEM_U32(t6 + -8) = at;
+at = MEM_U32(t7 + -4);
+MEM_U32(t6 + -4) = at;
+if (t7 != t9) goto L417cfc;
+at = MEM_U32(t7 + 0);
+v1 = 0x100054d8;
+MEM_U32(t6 + 0) = at;
+v1 = MEM_U32(v1 + 0);
+// fdead 60601ffff t0 = MEM_U32(sp + 32);
+t2 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 52);
+t3 = MEM_U16(t2 + 42);
+t8 = 0x100054d8;
+lo = t3 * a3;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)a3 >> 32);
+t4 = lo;
+t5 = t1 + t4;
+MEM_U32(t5 + 4) = t0;
+t8 = MEM_U32(t8 + 0);
+//nop;
+a1 = MEM_U32(t8 + 0);
+//nop;
+v0 = MEM_U16(a1 + 42);
+//nop;
+t9 = v0 + 0x1;
+MEM_U16(a1 + 42) = (uint16_t)t9;
+// fdead 60601ffff ra = MEM_U32(sp + 28);
+// fdead 60601ffff sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L417f00:
+//st_stradd:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffd8;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 28) = s2;
+// fdead 6b MEM_U32(sp + 24) = s1;
+// fdead 6b MEM_U32(sp + 20) = s0;
+// fdead 6b MEM_U32(sp + 40) = a0;
+if (a0 != 0) goto L417f48;
+a0 = 0x10002088;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// fdead 3 gp = MEM_U32(sp + 32);
+//nop;
+L417f48:
+//nop;
+// fdead 6b a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// fdead b gp = MEM_U32(sp + 32);
+s2 = v0 + 0x1;
+t7 = 0x100054d4;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+t8 = MEM_U32(t7 + 4);
+//nop;
+//nop;
+if (t8 != 0) goto L417f9c;
+a0 = 0x100009b0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 80003 gp = MEM_U32(sp + 32);
+//nop;
+L417f9c:
+s1 = 0x100054d8;
+//nop;
+s0 = MEM_U32(s1 + 0);
+//nop;
+//nop;
+if (s0 != 0) goto L417fd4;
+a0 = 0x100009ec;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead e0003 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L417fd4:
+t9 = MEM_U32(s0 + 60);
+//nop;
+t0 = t9 & 0x80;
+//nop;
+if (t0 == 0) goto L418008;
+a0 = 0x10000a20;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead e0003 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+//nop;
+L418008:
+t1 = MEM_U32(s0 + 0);
+t2 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t1 + 12);
+//nop;
+t3 = v1 + s2;
+//nop;
+if ((int)t2 >= (int)t3) goto L418074;
+L418028:
+//nop;
+a0 = MEM_U32(s0 + 20);
+a1 = s0 + 0x18;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(s1 + 0);
+// fdead e200f gp = MEM_U32(sp + 32);
+MEM_U32(t4 + 20) = v0;
+s0 = MEM_U32(s1 + 0);
+//nop;
+t5 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t5 + 12);
+//nop;
+t7 = v1 + s2;
+//nop;
+if ((int)t6 < (int)t7) goto L418028;
+L418074:
+t8 = MEM_U32(s0 + 20);
+//nop;
+// fdead 60ffe1f a1 = MEM_U32(sp + 40);
+a0 = t8 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+t9 = MEM_U32(s1 + 0);
+// fdead 40e000f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(t9 + 0);
+//nop;
+v0 = MEM_U32(a0 + 12);
+//nop;
+t0 = v0 + s2;
+MEM_U32(a0 + 12) = t0;
+// fdead 40e022f ra = MEM_U32(sp + 36);
+// fdead 40e022f s2 = MEM_U32(sp + 28);
+// fdead 40e022f s1 = MEM_U32(sp + 24);
+// fdead 40e022f s0 = MEM_U32(sp + 20);
+// fdead 40e022f sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L418100:
+//st_paux_ifd_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 4);
+a3 = a0;
+a2 = a1;
+if (t7 != 0) goto L418158;
+a0 = 0x100009b0;
+//nop;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+//nop;
+L418158:
+a1 = a3;
+if ((int)a3 < 0) goto L4181b4;
+//nop;
+if ((int)a2 < 0) goto L4181b4;
+v0 = 0x100054d4;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+t8 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)a3 >= (int)t8) goto L4181b4;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+//nop;
+t2 = MEM_U32(t1 + 48);
+//nop;
+//nop;
+if ((int)a2 < (int)t2) goto L4181f4;
+L4181b4:
+a0 = 0x100020a4;
+//nop;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+t4 = 0x100054d4;
+a2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t4 + 0);
+//nop;
+t5 = MEM_U32(t4 + 4);
+//nop;
+v1 = t5 + t6;
+L4181f4:
+t7 = MEM_U32(v1 + 12);
+// bdead 10081 ra = MEM_U32(sp + 28);
+t8 = a2 << 2;
+// bdead 2010001 sp = sp + 0x28;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_str_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L418318:
+//st_str_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+// fdead 81eb sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 81eb MEM_U32(sp + 28) = ra;
+// fdead 81eb MEM_U32(sp + 24) = gp;
+// fdead 81eb MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+//nop;
+if (t7 != 0) goto L418368;
+a0 = 0x100009b0;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+L418368:
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+//nop;
+if (v1 != 0) goto L4183ac;
+a0 = 0x100009ec;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d8;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4183ac:
+t8 = MEM_U32(v1 + 0);
+// fdead 20181fb ra = MEM_U32(sp + 28);
+v0 = MEM_U32(t8 + 12);
+//nop;
+//nop;
+if (v0 == 0) goto L4183e4;
+// fdead 20181fb t9 = MEM_U32(sp + 32);
+// fdead 20181fb t1 = MEM_U32(sp + 32);
+// fdead 20181fb at = (int)t9 < (int)v0;
+v0 = zero;
+if (at == 0) goto L4183e8;
+t0 = MEM_U32(v1 + 20);
+// fdead 20183fb v0 = t0 + t1;
+goto L4183e8;
+L4183e4:
+v0 = zero;
+L4183e8:
+// fdead 20183fb sp = sp + 0x20;
+return v0;
+}
+
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L4183f0:
+//st_malloc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L418434;
+at = 0xffffffff;
+if (a0 == 0) goto L418434;
+t0 = v0 << 1;
+if (a0 != at) goto L4184e0;
+L418434:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41847c;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L418474;
+a0 = 0x10002114;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L418474:
+v0 = s1;
+goto L41853c;
+L41847c:
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U32(sp + 48);
+//nop;
+lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L418538;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(sp + 48);
+//nop;
+lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L41853c;
+a0 = 0x10002150;
+//nop;
+a0 = a0;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// bdead 40001 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L41853c;
+L4184e0:
+MEM_U32(s0 + 0) = t0;
+t2 = MEM_U32(sp + 48);
+//nop;
+lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L418538;
+t3 = MEM_U32(s0 + 0);
+t4 = MEM_U32(sp + 48);
+a0 = 0x10002190;
+lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+a1 = lo;
+//nop;
+f_st_error(mem, sp, a0, a1, a2);
+// bdead 40001 gp = MEM_U32(sp + 32);
+//nop;
+L418538:
+v0 = s1;
+L41853c:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+//nop;
+}
+
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L41856c:
+//st_currentpchdr:
+//nop;
+//nop;
+//nop;
+v0 = 0x100054d4;
+//nop;
+v0 = MEM_U32(v0 + 0);
+//nop;
+return v0;
+}
+
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L418a6c:
+//st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L418ab0;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L418ab0;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L418ab0:
+//nop;
+return v0;
+}
+
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t5 = 0, t6 = 0, t7 = 0, t9 = 0;
+L418ab8:
+//st_idn_dn:
+//nop;
+//nop;
+//nop;
+v1 = 0x100054d4;
+// fdead 7b sp = sp + 0xffffffd8;
+v1 = MEM_U32(v1 + 0);
+// fdead 7b MEM_U32(sp + 28) = ra;
+// fdead 7b MEM_U32(sp + 24) = gp;
+// fdead 7b MEM_U32(sp + 40) = a0;
+// fdead 7b MEM_U32(sp + 44) = a1;
+if (v1 != 0) goto L418b10;
+a0 = 0x1000222c;
+//nop;
+a0 = a0;
+//nop;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418b10:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L418b64;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 827f MEM_U32(sp + 36) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 36);
+t7 = 0x100054d4;
+v1 = 0x100054d4;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418b64:
+//nop;
+if (t0 != 0) goto L418b94;
+//nop;
+a0 = MEM_U32(v1 + 56);
+a1 = 0x10;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418b94:
+t1 = MEM_U32(v1 + 60);
+t9 = MEM_U32(v1 + 56);
+// fdead 401867f t8 = MEM_U32(sp + 40);
+t2 = t1 << 3;
+v1 = 0x100054d4;
+t3 = t9 + t2;
+// fdead 4019e7f MEM_U32(t3 + 0) = t8;
+v1 = MEM_U32(v1 + 0);
+// fdead 4019e7f t4 = MEM_U32(sp + 44);
+t6 = MEM_U32(v1 + 60);
+t5 = MEM_U32(v1 + 56);
+t7 = t6 << 3;
+v1 = 0x100054d4;
+t1 = t5 + t7;
+// fdead 401de7f MEM_U32(t1 + 4) = t4;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t9 = v0 + 0x1;
+MEM_U32(v1 + 60) = t9;
+// fdead 401de7f ra = MEM_U32(sp + 28);
+// fdead 401de7f sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t2 = 0, t8 = 0, t9 = 0;
+L418e6c:
+//st_setidn:
+//nop;
+//nop;
+//nop;
+// fdead 4b sp = sp + 0xffffffe0;
+// fdead 4b MEM_U32(sp + 28) = ra;
+// fdead 4b MEM_U32(sp + 24) = gp;
+// fdead 4b a2 = a0;
+if ((int)a0 < 0) goto L418ec0;
+//nop;
+if ((int)a1 < 0) goto L418ec0;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+// fdead 5b at = (int)a0 < (int)v0;
+if (at == 0) {
+at = (int)a1 < (int)v0;
+goto L418ec0;}
+//nop;
+if ((int)a1 < (int)v0) goto L418ef0;
+L418ec0:
+a0 = 0x10002320;
+//nop;
+// fdead 7f MEM_U32(sp + 36) = a1;
+// fdead 7f MEM_U32(sp + 32) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 7 gp = MEM_U32(sp + 24);
+// fdead 7 a1 = MEM_U32(sp + 36);
+v1 = 0x100054d4;
+// fdead 17 a2 = MEM_U32(sp + 32);
+v1 = MEM_U32(v1 + 0);
+//nop;
+L418ef0:
+v0 = MEM_U32(v1 + 56);
+t8 = a1 << 3;
+t9 = v0 + t8;
+at = MEM_U32(t9 + 0);
+// fdead 600005f t6 = a2 << 3;
+// fdead 600005f t7 = v0 + t6;
+// fdead 600005f MEM_U32(t7 + 0) = at;
+t2 = MEM_U32(t9 + 4);
+//nop;
+// fdead 600085f MEM_U32(t7 + 4) = t2;
+// fdead 600085f ra = MEM_U32(sp + 28);
+// fdead 600085f sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_iextmax(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t6 = 0;
+L418ff0:
+//st_iextmax:
+//nop;
+//nop;
+//nop;
+t6 = 0x100054d4;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+v0 = MEM_U32(t6 + 28);
+//nop;
+return v0;
+}
+
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L419364:
+//st_pext_iext:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L4193a8;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 28);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L4193d4;
+L4193a8:
+a0 = 0x10002484;
+//nop;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4193d4:
+t7 = MEM_U32(v1 + 24);
+// bdead 10041 ra = MEM_U32(sp + 28);
+t8 = a1 << 4;
+// bdead 2010001 sp = sp + 0x20;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L4193ec:
+//st_idn_index_fext:
+//nop;
+//nop;
+//nop;
+v1 = 0x100054d4;
+// fdead 7b sp = sp + 0xffffffc8;
+v1 = MEM_U32(v1 + 0);
+// fdead 7b MEM_U32(sp + 28) = ra;
+// fdead 7b MEM_U32(sp + 24) = gp;
+// fdead 7b MEM_U32(sp + 56) = a0;
+// fdead 7b MEM_U32(sp + 60) = a1;
+if (v1 != 0) goto L419444;
+a0 = 0x100024ac;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+//nop;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L419444:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L419490;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 827f MEM_U32(sp + 44) = v0;
+a2 = 0x8;
+a3 = 0x80;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 44);
+t7 = 0x100054d4;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+MEM_U32(t7 + 56) = v0;
+L419490:
+// fdead 1827f t9 = MEM_U32(sp + 56);
+if (t0 != 0) goto L4194c0;
+t8 = 0x100054d4;
+//nop;
+t8 = MEM_U32(t8 + 0);
+a1 = 0x10;
+a0 = MEM_U32(t8 + 56);
+//nop;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 7 t9 = MEM_U32(sp + 56);
+L4194c0:
+// fdead 1827f t1 = MEM_U32(sp + 60);
+t2 = 0x7fff0000;
+// fdead 18a7f MEM_U32(sp + 52) = t9;
+if (t1 == 0) goto L4194e4;
+v1 = 0x100054d4;
+t2 = t2 | 0xffff;
+v1 = MEM_U32(v1 + 0);
+// fdead 18a7f MEM_U32(sp + 48) = t2;
+goto L41950c;
+L4194e4:
+//nop;
+//nop;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f MEM_U32(sp + 48) = v0;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L41950c:
+t4 = MEM_U32(v1 + 60);
+t3 = MEM_U32(v1 + 56);
+// fdead 1ba7f t7 = sp + 0x30;
+at = MEM_U32(t7 + 0);
+t5 = t4 << 3;
+t6 = t3 + t5;
+MEM_U32(t6 + 0) = at;
+t1 = MEM_U32(t7 + 4);
+v1 = 0x100054d4;
+MEM_U32(t6 + 4) = t1;
+v1 = MEM_U32(v1 + 0);
+//nop;
+v0 = MEM_U32(v1 + 60);
+//nop;
+t2 = v0 + 0x1;
+MEM_U32(v1 + 60) = t2;
+// fdead 1fe7f ra = MEM_U32(sp + 28);
+// fdead 1fe7f sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L41955c:
+//st_pdn_idn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L4195a0;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 60);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L4195d8;
+L4195a0:
+t7 = 0x100054d4;
+a0 = 0x100024ec;
+t7 = MEM_U32(t7 + 0);
+//nop;
+a2 = MEM_U32(t7 + 60);
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+L4195d8:
+t8 = MEM_U32(v1 + 56);
+// bdead 2000041 ra = MEM_U32(sp + 28);
+t9 = a1 << 3;
+// bdead 6000001 sp = sp + 0x20;
+v0 = t8 + t9;
+return v0;
+//nop;
+}
+
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, t0 = 0, t6 = 0, t9 = 0;
+L41a7e4:
+//st_str_idn:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+v0 = f_st_pdn_idn(mem, sp, a0);
+at = MEM_U32(v0 + 0);
+// bdead 4000000d gp = MEM_U32(sp + 24);
+t6 = sp + 0x28;
+MEM_U32(t6 + 0) = at;
+t9 = MEM_U32(v0 + 4);
+at = 0xf0000;
+MEM_U32(t6 + 4) = t9;
+t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+//nop;
+if (t0 != at) goto L41a838;
+v0 = 0xffffffff;
+goto L41a86c;
+L41a838:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+//nop;
+a1 = MEM_U32(v0 + 0);
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+//nop;
+L41a86c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41b5f4:
+//swap_hdr:
+MEM_U32(sp + 4) = a1;
+v1 = MEM_S16(a0 + 0);
+a1 = MEM_S16(a0 + 2);
+t8 = v1 & 0xffff;
+t9 = t8 >> 8;
+t7 = v1 << 8;
+a2 = MEM_U32(a0 + 4);
+t1 = t7 | t9;
+t4 = a1 & 0xffff;
+v0 = 0xff0000;
+t5 = t4 >> 8;
+t3 = a1 << 8;
+t7 = a2 << 8;
+MEM_U16(a0 + 0) = (uint16_t)t1;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a2 << 24;
+a3 = MEM_U32(a0 + 8);
+t1 = t8 | t9;
+t2 = (int)a2 >> 8;
+t4 = t2 & 0xff00;
+MEM_U16(a0 + 2) = (uint16_t)t6;
+t3 = t1 | t4;
+t5 = a2 >> 24;
+t8 = a3 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a3 << 24;
+t0 = MEM_U32(a0 + 12);
+t2 = t7 | t9;
+t1 = (int)a3 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 4) = t6;
+t3 = t2 | t4;
+t5 = a3 >> 24;
+t7 = t0 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = t0 << 24;
+v1 = MEM_U32(a0 + 16);
+t1 = t8 | t9;
+t2 = (int)t0 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 8) = t6;
+t3 = t1 | t4;
+t5 = t0 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 20);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 12) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 24);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 16) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 28);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 20) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 32);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 24) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 36);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 28) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 40);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 32) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 44);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 36) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 48);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 40) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 52);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 44) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 56);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 48) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 60);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 52) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 64);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 56) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 68);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 60) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 72);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 64) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 76);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 68) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t7 = a3 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a3 << 24;
+v1 = MEM_U32(a0 + 80);
+t1 = t8 | t9;
+t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 72) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t8 = v1 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = v1 << 24;
+a1 = MEM_U32(a0 + 84);
+t2 = t7 | t9;
+t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 76) = t6;
+t3 = t2 | t4;
+t5 = v1 >> 24;
+t7 = a1 << 8;
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+a2 = MEM_U32(a0 + 88);
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 80) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+t8 = a2 << 8;
+t6 = t3 | t5;
+t9 = t8 & v0;
+t7 = a2 << 24;
+a3 = MEM_U32(a0 + 92);
+t2 = t7 | t9;
+t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+MEM_U32(a0 + 84) = t6;
+t3 = t2 | t4;
+t5 = a2 >> 24;
+t6 = t3 | t5;
+t7 = a3 << 8;
+t9 = t7 & v0;
+t2 = (int)a3 >> 8;
+t8 = a3 << 24;
+t1 = t8 | t9;
+t4 = t2 & 0xff00;
+MEM_U32(a0 + 88) = t6;
+t3 = t1 | t4;
+t5 = a3 >> 24;
+t6 = t3 | t5;
+MEM_U32(a0 + 92) = t6;
+return;
+}
+
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0, ra = 0;
+L41ba24:
+//swap_fd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff70;
+//nop;
+// fdead 400000eb MEM_U32(sp + 52) = ra;
+// fdead 400000eb MEM_U32(sp + 44) = s5;
+// fdead 400000eb MEM_U32(sp + 40) = s4;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a0;
+s4 = a1;
+s5 = a2;
+// fdead 406200eb MEM_U32(sp + 48) = gp;
+// fdead 406200eb MEM_U32(sp + 36) = s3;
+// fdead 406200eb MEM_U32(sp + 32) = s2;
+// fdead 406200eb MEM_U32(sp + 28) = s1;
+v0 = f_gethostsex(mem, sp);
+// bdead 4062000b gp = MEM_U32(sp + 48);
+s3 = zero;
+if ((int)s4 <= 0) goto L41bffc;
+v1 = s0;
+s2 = 0xff0000;
+s1 = sp + 0x40;
+a0 = 0xff0000;
+L41ba84:
+t8 = v1;
+t9 = s1;
+t7 = v1 + 0x48;
+L41ba90:
+at = MEM_U32(t8 + 0);
+t8 = t8 + 0xc;
+MEM_U32(t9 + 0) = at;
+at = MEM_U32(t8 + -8);
+t9 = t9 + 0xc;
+MEM_U32(t9 + -8) = at;
+at = MEM_U32(t8 + -4);
+MEM_U32(t9 + -4) = at;
+if (t8 != t7) goto L41ba90;
+t6 = MEM_U32(sp + 64);
+a1 = MEM_U32(sp + 84);
+t8 = t6 << 8;
+t9 = t8 & s2;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t6 = MEM_U32(sp + 68);
+MEM_U32(sp + 64) = t9;
+t8 = t6 << 8;
+t9 = t8 & a0;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = (int)t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = MEM_U32(sp + 68);
+t6 = t8 | t9;
+t8 = t7 >> 24;
+t9 = t6 | t8;
+t7 = MEM_U32(sp + 72);
+MEM_U32(sp + 68) = t9;
+t8 = t7 << 8;
+t9 = t8 & a0;
+t6 = t7 << 24;
+t8 = t6 | t9;
+t6 = (int)t7 >> 8;
+t9 = t6 & 0xff00;
+t6 = MEM_U32(sp + 72);
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t6 = MEM_U32(sp + 76);
+MEM_U32(sp + 72) = t9;
+t8 = t6 << 8;
+t9 = t8 & a0;
+t7 = t6 << 24;
+t8 = t7 | t9;
+t7 = (int)t6 >> 8;
+t9 = t7 & 0xff00;
+t7 = MEM_U32(sp + 76);
+t6 = t8 | t9;
+t8 = t7 >> 24;
+t9 = t6 | t8;
+t7 = MEM_U32(sp + 80);
+MEM_U32(sp + 76) = t9;
+t8 = t7 << 8;
+t9 = t8 & a0;
+t6 = t7 << 24;
+t8 = t6 | t9;
+t6 = (int)t7 >> 8;
+t9 = t6 & 0xff00;
+t6 = MEM_U32(sp + 80);
+t7 = t8 | t9;
+t8 = t6 >> 24;
+t9 = t7 | t8;
+t7 = a1 << 8;
+t8 = t7 & a0;
+MEM_U32(sp + 80) = t9;
+t6 = a1 << 24;
+t9 = t6 | t8;
+t7 = (int)a1 >> 8;
+t6 = t7 & 0xff00;
+a2 = MEM_U32(sp + 88);
+t8 = t9 | t6;
+t7 = a1 >> 24;
+a1 = t8 | t7;
+t6 = a2 << 8;
+t8 = t6 & a0;
+t9 = a2 << 24;
+t7 = t9 | t8;
+t6 = (int)a2 >> 8;
+t9 = t6 & 0xff00;
+a3 = MEM_U32(sp + 92);
+t8 = t7 | t9;
+t6 = a2 >> 24;
+a2 = t8 | t6;
+t9 = a3 << 8;
+t8 = t9 & a0;
+t7 = a3 << 24;
+t6 = t7 | t8;
+t9 = (int)a3 >> 8;
+t7 = t9 & 0xff00;
+t0 = MEM_U32(sp + 96);
+t8 = t6 | t7;
+t9 = a3 >> 24;
+a3 = t8 | t9;
+t7 = t0 << 8;
+t8 = t7 & a0;
+t6 = t0 << 24;
+t9 = t6 | t8;
+t7 = (int)t0 >> 8;
+t6 = t7 & 0xff00;
+t1 = MEM_U32(sp + 100);
+t8 = t9 | t6;
+t7 = t0 >> 24;
+t0 = t8 | t7;
+t6 = t1 << 8;
+t8 = t6 & a0;
+t9 = t1 << 24;
+t7 = t9 | t8;
+t6 = (int)t1 >> 8;
+t9 = t6 & 0xff00;
+t8 = t7 | t9;
+t6 = t1 >> 24;
+t1 = t8 | t6;
+t6 = MEM_U16(sp + 104);
+t9 = MEM_S16(sp + 104);
+t7 = t6 >> 8;
+t8 = t9 << 8;
+t9 = t8 | t7;
+MEM_U16(sp + 104) = (uint16_t)t9;
+t9 = MEM_U16(sp + 106);
+t8 = MEM_S16(sp + 106);
+t2 = MEM_U32(sp + 108);
+t6 = t9 >> 8;
+t7 = t8 << 8;
+t8 = t7 | t6;
+t7 = t2 << 8;
+t6 = t7 & a0;
+MEM_U16(sp + 106) = (uint16_t)t8;
+t9 = t2 << 24;
+t8 = t9 | t6;
+t7 = (int)t2 >> 8;
+t9 = t7 & 0xff00;
+t3 = MEM_U32(sp + 112);
+t6 = t8 | t9;
+t7 = t2 >> 24;
+t2 = t6 | t7;
+t9 = t3 << 8;
+t6 = t9 & a0;
+t8 = t3 << 24;
+t7 = t8 | t6;
+t9 = (int)t3 >> 8;
+t8 = t9 & 0xff00;
+t4 = MEM_U32(sp + 116);
+t6 = t7 | t8;
+t9 = t3 >> 24;
+t3 = t6 | t9;
+t8 = t4 << 8;
+t6 = t8 & a0;
+t7 = t4 << 24;
+t9 = t7 | t6;
+t8 = (int)t4 >> 8;
+t7 = t8 & 0xff00;
+t5 = MEM_U32(sp + 120);
+t6 = t9 | t7;
+t8 = t4 >> 24;
+t4 = t6 | t8;
+t7 = t5 << 8;
+t6 = t7 & a0;
+t9 = t5 << 24;
+t8 = t9 | t6;
+t7 = (int)t5 >> 8;
+t9 = t7 & 0xff00;
+ra = MEM_U32(sp + 128);
+t6 = t8 | t9;
+t7 = t5 >> 24;
+t5 = t6 | t7;
+t9 = ra << 8;
+t6 = t9 & a0;
+t8 = ra << 24;
+t7 = t8 | t6;
+t9 = (int)ra >> 8;
+t8 = t9 & 0xff00;
+s0 = MEM_U32(sp + 132);
+t6 = t7 | t8;
+t9 = ra >> 24;
+ra = t6 | t9;
+t8 = s0 << 8;
+t6 = t8 & a0;
+t7 = s0 << 24;
+t9 = t7 | t6;
+t8 = (int)s0 >> 8;
+t7 = t8 & 0xff00;
+t6 = t9 | t7;
+t8 = s0 >> 24;
+s0 = t6 | t8;
+MEM_U32(sp + 132) = s0;
+MEM_U32(sp + 128) = ra;
+MEM_U32(sp + 120) = t5;
+MEM_U32(sp + 116) = t4;
+MEM_U32(sp + 112) = t3;
+MEM_U32(sp + 108) = t2;
+MEM_U32(sp + 100) = t1;
+MEM_U32(sp + 96) = t0;
+MEM_U32(sp + 92) = a3;
+MEM_U32(sp + 88) = a2;
+MEM_U32(sp + 84) = a1;
+if (s5 != v0) goto L41bed4;
+t6 = s1;
+t8 = v1;
+t7 = s1 + 0x48;
+L41bdc4:
+at = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+MEM_U32(t8 + 0) = at;
+at = MEM_U32(t6 + -8);
+t8 = t8 + 0xc;
+MEM_U32(t8 + -8) = at;
+at = MEM_U32(t6 + -4);
+MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L41bdc4;
+t9 = MEM_U32(sp + 124);
+//nop;
+t6 = t9 << 8;
+t8 = t6 & s2;
+t7 = t9 << 24;
+t6 = t7 | t8;
+t7 = t9 >> 8;
+t8 = t7 & 0xff00;
+t7 = t6 | t8;
+t6 = t9 >> 24;
+t9 = t7 | t6;
+MEM_U32(sp + 124) = t9;
+t8 = MEM_U8(v1 + 60);
+t6 = t9 << 3;
+t9 = t8 & 0xff07;
+t7 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t8 = MEM_U32(sp + 124);
+//nop;
+t6 = t8 << 26;
+t9 = t6 >> 31;
+t6 = MEM_U8(v1 + 60);
+t7 = t9 << 2;
+t8 = t7 & 0x4;
+t9 = t6 & 0xfffb;
+t7 = t8 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t6 = MEM_U32(sp + 124);
+//nop;
+t8 = t6 << 25;
+t9 = t8 >> 31;
+t8 = MEM_U8(v1 + 60);
+t7 = t9 << 1;
+t6 = t7 & 0x2;
+t9 = t8 & 0xfffd;
+t7 = t6 | t9;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t8 = MEM_U8(sp + 127);
+//nop;
+t6 = t8 >> 7;
+t9 = t6 & 0x1;
+t8 = t7 & 0xfe;
+t6 = t9 | t8;
+MEM_U8(v1 + 60) = (uint8_t)t6;
+t9 = MEM_U8(sp + 126);
+t7 = MEM_U8(v1 + 61);
+t6 = t9 << 6;
+t9 = t7 & 0xff3f;
+t8 = t6 | t9;
+MEM_U8(v1 + 61) = (uint8_t)t8;
+t7 = MEM_U32(sp + 124);
+//nop;
+t9 = t7 >> 10;
+t7 = MEM_U16(v1 + 62);
+t8 = t9 & 0x1fff;
+t6 = t7 & 0xe000;
+t9 = t8 | t6;
+MEM_U16(v1 + 62) = (uint16_t)t9;
+goto L41bff0;
+L41bed4:
+t7 = MEM_U32(v1 + 60);
+t9 = MEM_U8(sp + 127);
+t8 = t7 >> 27;
+t6 = t8 & 0x1f;
+t7 = t9 & 0xffe0;
+t8 = t6 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t9 = MEM_U32(v1 + 60);
+//nop;
+t6 = t9 << 5;
+t7 = t6 >> 31;
+t9 = t7 << 5;
+t6 = t9 & 0x20;
+t7 = t8;
+t9 = t7 & 0xdf;
+t8 = t6 | t9;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t7 = MEM_U32(v1 + 60);
+//nop;
+t6 = t7 << 6;
+t9 = t6 >> 31;
+t7 = t9 << 6;
+t6 = t7 & 0x40;
+t9 = t8;
+t7 = t9 & 0xbf;
+t8 = t6 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t6 = MEM_U8(v1 + 60);
+//nop;
+t9 = t6 << 7;
+t6 = t8;
+t7 = t6 & 0x7f;
+t8 = t9 | t7;
+MEM_U8(sp + 127) = (uint8_t)t8;
+t6 = MEM_U8(v1 + 61);
+t8 = MEM_U8(sp + 126);
+t9 = t6 >> 6;
+t7 = t9 & 0x3;
+t6 = t8 & 0xfffc;
+t9 = t7 | t6;
+MEM_U8(sp + 126) = (uint8_t)t9;
+t6 = MEM_U32(sp + 124);
+t8 = MEM_U32(v1 + 60);
+t9 = t6 >> 10;
+t7 = t8 & 0x1fff;
+t8 = t7 ^ t9;
+t7 = t8 << 10;
+t9 = t7 ^ t6;
+t7 = t9 << 8;
+t6 = t7 & s2;
+t8 = t9 << 24;
+t7 = t8 | t6;
+t8 = t9 >> 8;
+t6 = t8 & 0xff00;
+t8 = t7 | t6;
+t7 = t9 >> 24;
+t6 = t8 | t7;
+MEM_U32(sp + 124) = t9;
+MEM_U32(sp + 124) = t6;
+t6 = s1;
+t7 = s1 + 0x48;
+t8 = v1;
+L41bfcc:
+at = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+MEM_U32(t8 + 0) = at;
+at = MEM_U32(t6 + -8);
+t8 = t8 + 0xc;
+MEM_U32(t8 + -8) = at;
+at = MEM_U32(t6 + -4);
+MEM_U32(t8 + -4) = at;
+if (t6 != t7) goto L41bfcc;
+L41bff0:
+s3 = s3 + 0x1;
+v1 = v1 + 0x48;
+if (s3 != s4) goto L41ba84;
+L41bffc:
+// bdead 1 ra = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x90;
+return;
+}
+
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41c020:
+//swap_fi:
+MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41c14c;
+a2 = a1 & 0x3;
+a3 = a2;
+if (a2 == 0) goto L41c080;
+t6 = zero << 2;
+v1 = a0 + t6;
+t1 = 0xff0000;
+L41c044:
+a2 = MEM_U32(v1 + 0);
+v0 = v0 + 0x1;
+t8 = a2 << 8;
+t9 = t8 & t1;
+t7 = a2 << 24;
+t3 = (int)a2 >> 8;
+t4 = t3 & 0xff00;
+t2 = t7 | t9;
+t5 = t2 | t4;
+t6 = a2 >> 24;
+t8 = t6 | t5;
+MEM_U32(v1 + 0) = t8;
+v1 = v1 + 0x4;
+if (a3 != v0) goto L41c044;
+if (v0 == a1) {
+t7 = v0 << 2;
+goto L41c14c;}
+L41c080:
+t7 = v0 << 2;
+t9 = a1 << 2;
+t0 = t9 + a0;
+v1 = a0 + t7;
+t1 = 0xff0000;
+L41c094:
+a2 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 4);
+t2 = a2 << 8;
+t4 = t2 & t1;
+t3 = a2 << 24;
+t5 = (int)a2 >> 8;
+t8 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = t6 | t8;
+t9 = a2 >> 24;
+t2 = t9 | t7;
+t4 = v0 << 8;
+t5 = t4 & t1;
+t8 = (int)v0 >> 8;
+t3 = v0 << 24;
+a0 = MEM_U32(v1 + 8);
+t6 = t3 | t5;
+t9 = t8 & 0xff00;
+MEM_U32(v1 + 0) = t2;
+t7 = t6 | t9;
+t2 = v0 >> 24;
+t4 = t2 | t7;
+t5 = a0 << 8;
+t8 = t5 & t1;
+t9 = (int)a0 >> 8;
+t3 = a0 << 24;
+a3 = MEM_U32(v1 + 12);
+t6 = t3 | t8;
+t2 = t9 & 0xff00;
+MEM_U32(v1 + 4) = t4;
+t7 = t6 | t2;
+t4 = a0 >> 24;
+t5 = t4 | t7;
+t8 = a3 << 8;
+t9 = t8 & t1;
+t2 = (int)a3 >> 8;
+t3 = a3 << 24;
+t6 = t3 | t9;
+t4 = t2 & 0xff00;
+MEM_U32(v1 + 8) = t5;
+t7 = t6 | t4;
+t5 = a3 >> 24;
+t8 = t5 | t7;
+v1 = v1 + 0x10;
+MEM_U32(v1 + -4) = t8;
+if (v1 != t0) goto L41c094;
+L41c14c:
+//nop;
+return;
+}
+
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L41c154:
+//swap_sym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a2 = zero;
+if ((int)s0 <= 0) goto L41c3d8;
+v1 = MEM_U32(sp + 64);
+t0 = 0xff0000;
+a3 = 0xff0000;
+a1 = sp + 0x2c;
+L41c1a4:
+at = MEM_U32(v1 + 0);
+a2 = a2 + 0x1;
+MEM_U32(a1 + 0) = at;
+t7 = MEM_U32(v1 + 4);
+//nop;
+MEM_U32(a1 + 4) = t7;
+at = MEM_U32(v1 + 8);
+//nop;
+MEM_U32(a1 + 8) = at;
+t8 = MEM_U32(sp + 44);
+at = 0xf0000;
+t1 = t8 << 8;
+t2 = t1 & a3;
+t9 = t8 << 24;
+t3 = t9 | t2;
+t4 = (int)t8 >> 8;
+t2 = MEM_U32(sp + 48);
+t5 = t4 & 0xff00;
+t6 = t3 | t5;
+t1 = t8 >> 24;
+t4 = t2 << 8;
+t9 = t6 | t1;
+t3 = t4 & a3;
+t8 = t2 << 24;
+t7 = (int)t2 >> 8;
+t6 = t7 & 0xff00;
+t5 = t8 | t3;
+t1 = t5 | t6;
+t4 = t2 >> 24;
+t8 = t1 | t4;
+MEM_U32(sp + 44) = t9;
+MEM_U32(sp + 48) = t8;
+if (s1 != v0) goto L41c2fc;
+at = MEM_U32(a1 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t2 = MEM_U32(a1 + 4);
+//nop;
+MEM_U32(v1 + 4) = t2;
+at = MEM_U32(a1 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t7 = MEM_U32(sp + 52);
+//nop;
+t6 = t7 << 8;
+t9 = t6 & t0;
+t5 = t7 << 24;
+t4 = t7 >> 8;
+t8 = t4 & 0xff00;
+t1 = t5 | t9;
+t3 = t1 | t8;
+t2 = t7 >> 24;
+t5 = t3 | t2;
+MEM_U32(sp + 52) = t5;
+t1 = MEM_U8(v1 + 8);
+t4 = t5 << 2;
+t8 = t1 & 0xff03;
+t7 = t4 | t8;
+MEM_U8(v1 + 8) = (uint8_t)t7;
+t3 = MEM_U32(sp + 52);
+t1 = MEM_U16(v1 + 8);
+t2 = t3 << 21;
+t6 = t2 >> 27;
+t5 = t6 << 5;
+t9 = t5 & 0x3e0;
+t4 = t1 & 0xfc1f;
+t8 = t9 | t4;
+MEM_U16(v1 + 8) = (uint16_t)t8;
+t7 = MEM_U32(sp + 52);
+t1 = MEM_U8(v1 + 9);
+t3 = t7 << 20;
+t2 = t3 >> 31;
+t6 = t2 << 4;
+t5 = t6 & 0x10;
+t9 = t1 & 0xffef;
+t4 = t5 | t9;
+MEM_U8(v1 + 9) = (uint8_t)t4;
+t8 = MEM_U32(sp + 52);
+a0 = MEM_U32(v1 + 8);
+t7 = t8 >> 12;
+t3 = t7 ^ a0;
+t2 = t3 << 12;
+t6 = t2 >> 12;
+t1 = t6 ^ a0;
+MEM_U32(v1 + 8) = t1;
+goto L41c3d0;
+L41c2fc:
+t5 = MEM_U32(v1 + 8);
+t8 = MEM_U8(sp + 55);
+t9 = t5 >> 26;
+t4 = t9 & 0x3f;
+t7 = t8 & 0xffc0;
+t3 = t4 | t7;
+MEM_U8(sp + 55) = (uint8_t)t3;
+t2 = MEM_U32(v1 + 8);
+t8 = MEM_U16(sp + 54);
+t6 = t2 << 6;
+t1 = t6 >> 27;
+t5 = t1 << 6;
+t9 = t5 & 0x7c0;
+t4 = t8 & 0xf83f;
+t7 = t9 | t4;
+MEM_U16(sp + 54) = (uint16_t)t7;
+t3 = MEM_U32(v1 + 8);
+t8 = MEM_U8(sp + 54);
+t2 = t3 << 11;
+t6 = t2 >> 31;
+t1 = t6 << 3;
+t5 = t1 & 0x8;
+t9 = t8 & 0xfff7;
+t4 = t5 | t9;
+MEM_U8(sp + 54) = (uint8_t)t4;
+t7 = MEM_U32(v1 + 8);
+t2 = MEM_U32(sp + 52);
+at = at | 0xffff;
+t3 = t7 & at;
+t6 = t2 >> 12;
+t1 = t3 ^ t6;
+t8 = t1 << 12;
+t5 = t8 ^ t2;
+t4 = t5 << 8;
+t7 = t4 & t0;
+t9 = t5 << 24;
+t6 = t5 >> 8;
+t1 = t6 & 0xff00;
+t3 = t9 | t7;
+t8 = t3 | t1;
+t2 = t5 >> 24;
+MEM_U32(sp + 52) = t5;
+t4 = t8 | t2;
+MEM_U32(sp + 52) = t4;
+at = MEM_U32(a1 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t6 = MEM_U32(a1 + 4);
+//nop;
+MEM_U32(v1 + 4) = t6;
+at = MEM_U32(a1 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+L41c3d0:
+v1 = v1 + 0xc;
+if (a2 != s0) goto L41c1a4;
+L41c3d8:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L41c3ec:
+//swap_ext:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+a3 = zero;
+if ((int)s0 <= 0) goto L41c7ec;
+v1 = MEM_U32(sp + 72);
+t0 = 0xff0000;
+a2 = sp + 0x30;
+a1 = 0xff0000;
+L41c43c:
+at = MEM_U32(v1 + 0);
+a3 = a3 + 0x1;
+MEM_U32(a2 + 0) = at;
+t7 = MEM_U32(v1 + 4);
+//nop;
+MEM_U32(a2 + 4) = t7;
+at = MEM_U32(v1 + 8);
+//nop;
+MEM_U32(a2 + 8) = at;
+t7 = MEM_U32(v1 + 12);
+at = 0xf0000;
+MEM_U32(a2 + 12) = t7;
+t8 = MEM_U32(sp + 52);
+at = at | 0xffff;
+t1 = t8 << 8;
+t2 = t1 & t0;
+t9 = t8 << 24;
+t3 = t9 | t2;
+t4 = (int)t8 >> 8;
+t2 = MEM_U32(sp + 56);
+t5 = t4 & 0xff00;
+t6 = t3 | t5;
+t1 = t8 >> 24;
+t4 = t2 << 8;
+t9 = t6 | t1;
+t3 = t4 & t0;
+t8 = t2 << 24;
+t7 = (int)t2 >> 8;
+t6 = t7 & 0xff00;
+t5 = t8 | t3;
+t1 = t5 | t6;
+t4 = t2 >> 24;
+t8 = t1 | t4;
+MEM_U32(sp + 52) = t9;
+MEM_U32(sp + 56) = t8;
+if (s1 != v0) goto L41c658;
+at = MEM_U32(a2 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t2 = MEM_U32(a2 + 4);
+//nop;
+MEM_U32(v1 + 4) = t2;
+at = MEM_U32(a2 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t2 = MEM_U32(a2 + 12);
+//nop;
+MEM_U32(v1 + 12) = t2;
+t7 = MEM_U32(sp + 60);
+//nop;
+t6 = t7 << 8;
+t9 = t6 & a1;
+t5 = t7 << 24;
+t4 = t7 >> 8;
+t8 = t4 & 0xff00;
+t1 = t5 | t9;
+t3 = t1 | t8;
+t2 = t7 >> 24;
+t5 = t3 | t2;
+MEM_U32(sp + 60) = t5;
+t1 = MEM_U8(v1 + 12);
+t4 = t5 << 2;
+t8 = t1 & 0xff03;
+t7 = t4 | t8;
+MEM_U8(v1 + 12) = (uint8_t)t7;
+t3 = MEM_U32(sp + 60);
+t1 = MEM_U16(v1 + 12);
+t2 = t3 << 21;
+t6 = t2 >> 27;
+t5 = t6 << 5;
+t9 = t5 & 0x3e0;
+t4 = t1 & 0xfc1f;
+t8 = t9 | t4;
+MEM_U16(v1 + 12) = (uint16_t)t8;
+t7 = MEM_U32(sp + 60);
+t1 = MEM_U8(v1 + 13);
+t3 = t7 << 20;
+t2 = t3 >> 31;
+t6 = t2 << 4;
+t5 = t6 & 0x10;
+t9 = t1 & 0xffef;
+t4 = t5 | t9;
+MEM_U8(v1 + 13) = (uint8_t)t4;
+t8 = MEM_U32(sp + 60);
+a0 = MEM_U32(v1 + 12);
+t7 = t8 >> 12;
+t3 = t7 ^ a0;
+t2 = t3 << 12;
+t6 = t2 >> 12;
+t1 = t6 ^ a0;
+MEM_U32(v1 + 12) = t1;
+t5 = MEM_U32(sp + 48);
+//nop;
+t4 = t5 << 8;
+t8 = t4 & a1;
+t9 = t5 << 24;
+t3 = t5 >> 8;
+t2 = t3 & 0xff00;
+t7 = t9 | t8;
+t6 = t7 | t2;
+t1 = t5 >> 24;
+t4 = t6 | t1;
+MEM_U32(sp + 48) = t4;
+t9 = MEM_S16(sp + 48);
+t5 = MEM_U16(v1 + 0);
+MEM_U16(v1 + 2) = (uint16_t)t9;
+t8 = MEM_U16(sp + 50);
+t6 = t5 & 0xf800;
+t7 = t8 >> 3;
+t2 = t7 & 0x7ff;
+t1 = t2 | t6;
+MEM_U16(v1 + 0) = (uint16_t)t1;
+t7 = MEM_U8(v1 + 0);
+t9 = MEM_U32(sp + 48);
+t5 = t7 & 0xff7f;
+t3 = t9 << 7;
+t7 = t3 | t5;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t6 = MEM_U32(sp + 48);
+t3 = t7 & 0xbf;
+t1 = t6 << 30;
+t4 = t1 >> 31;
+t9 = t4 << 6;
+t8 = t9 & 0x40;
+t7 = t8 | t3;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t2 = MEM_U32(sp + 48);
+t8 = t7 & 0xdf;
+t6 = t2 << 29;
+t1 = t6 >> 31;
+t4 = t1 << 5;
+t9 = t4 & 0x20;
+t3 = t9 | t8;
+MEM_U8(v1 + 0) = (uint8_t)t3;
+goto L41c7e4;
+L41c658:
+t5 = MEM_U32(v1 + 12);
+t1 = MEM_U8(sp + 63);
+t2 = t5 >> 26;
+t6 = t2 & 0x3f;
+t4 = t1 & 0xffc0;
+t7 = t6 | t4;
+MEM_U8(sp + 63) = (uint8_t)t7;
+t9 = MEM_U32(v1 + 12);
+t1 = MEM_U16(sp + 62);
+t8 = t9 << 6;
+t3 = t8 >> 27;
+t5 = t3 << 6;
+t2 = t5 & 0x7c0;
+t6 = t1 & 0xf83f;
+t4 = t2 | t6;
+MEM_U16(sp + 62) = (uint16_t)t4;
+t7 = MEM_U32(v1 + 12);
+t1 = MEM_U8(sp + 62);
+t9 = t7 << 11;
+t8 = t9 >> 31;
+t3 = t8 << 3;
+t5 = t3 & 0x8;
+t2 = t1 & 0xfff7;
+t6 = t5 | t2;
+MEM_U8(sp + 62) = (uint8_t)t6;
+t4 = MEM_U32(v1 + 12);
+t9 = MEM_U32(sp + 60);
+t7 = t4 & at;
+t8 = t9 >> 12;
+t3 = t7 ^ t8;
+t1 = t3 << 12;
+t5 = t1 ^ t9;
+t6 = t5 << 8;
+t4 = t6 & a1;
+t2 = t5 << 24;
+t8 = t5 >> 8;
+t3 = t8 & 0xff00;
+t7 = t2 | t4;
+t1 = t7 | t3;
+t9 = t5 >> 24;
+MEM_U32(sp + 60) = t5;
+t6 = t1 | t9;
+MEM_U32(sp + 60) = t6;
+t2 = MEM_S16(v1 + 2);
+t5 = MEM_U16(sp + 50);
+MEM_U16(sp + 48) = (uint16_t)t2;
+t4 = MEM_U16(v1 + 0);
+t1 = t5 & 0x7;
+t8 = t4 & 0x7ff;
+t3 = t8 << 3;
+t9 = t3 | t1;
+MEM_U16(sp + 50) = (uint16_t)t9;
+t6 = MEM_U32(v1 + 0);
+t5 = MEM_U8(sp + 51);
+t2 = t6 << 2;
+t4 = t2 >> 31;
+t8 = t4 << 2;
+t7 = t8 & 0x4;
+t3 = t5 & 0xfffb;
+t5 = t7 | t3;
+MEM_U8(sp + 51) = (uint8_t)t5;
+t9 = MEM_U32(v1 + 0);
+t7 = t5 & 0xfd;
+t6 = t9 << 1;
+t2 = t6 >> 31;
+t4 = t2 << 1;
+t8 = t4 & 0x2;
+t4 = t8 | t7;
+MEM_U8(sp + 51) = (uint8_t)t4;
+t9 = MEM_U32(v1 + 0);
+t1 = t4 & 0xfe;
+t6 = t9 >> 31;
+t2 = t6 & 0x1;
+t5 = t2 | t1;
+MEM_U8(sp + 51) = (uint8_t)t5;
+t8 = MEM_U32(sp + 48);
+//nop;
+t9 = t8 << 8;
+t6 = t9 & a1;
+t7 = t8 << 24;
+t4 = t8 >> 8;
+t2 = t4 & 0xff00;
+t3 = t7 | t6;
+t1 = t3 | t2;
+t5 = t8 >> 24;
+t9 = t1 | t5;
+MEM_U32(sp + 48) = t9;
+at = MEM_U32(a2 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t4 = MEM_U32(a2 + 4);
+//nop;
+MEM_U32(v1 + 4) = t4;
+at = MEM_U32(a2 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t4 = MEM_U32(a2 + 12);
+//nop;
+MEM_U32(v1 + 12) = t4;
+L41c7e4:
+v1 = v1 + 0x10;
+if (a3 != s0) goto L41c43c;
+L41c7ec:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x48;
+return;
+}
+
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41c800:
+//swap_pd:
+MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41ca64;
+v1 = a0;
+t1 = 0xff0000;
+t0 = 0xff0000;
+L41c818:
+a0 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v1 + 4);
+t6 = a0 >> 24;
+t7 = a0 << 24;
+t9 = a0 << 8;
+t2 = t9 & t0;
+t8 = t6 | t7;
+t4 = a0 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+t9 = a2 << 8;
+t8 = t9 & t1;
+t4 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 8);
+MEM_U32(v1 + 0) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+t6 = a2 >> 24;
+t9 = t6 | t5;
+t8 = a0 << 8;
+t4 = t8 & t1;
+t3 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 12);
+MEM_U32(v1 + 4) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+t9 = a0 >> 24;
+t8 = t9 | t5;
+t4 = a2 << 8;
+t3 = t4 & t1;
+t6 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 16);
+MEM_U32(v1 + 8) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+t8 = a2 >> 24;
+t4 = t8 | t5;
+t3 = a0 << 8;
+t6 = t3 & t1;
+t9 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 20);
+MEM_U32(v1 + 12) = t4;
+t2 = t7 | t6;
+t8 = t9 & 0xff00;
+t5 = t2 | t8;
+t4 = a0 >> 24;
+t3 = t4 | t5;
+t6 = a2 << 8;
+t9 = t6 & t1;
+t8 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 24);
+MEM_U32(v1 + 16) = t3;
+t2 = t7 | t9;
+t4 = t8 & 0xff00;
+t5 = t2 | t4;
+t3 = a2 >> 24;
+t6 = t3 | t5;
+t9 = a0 << 8;
+t8 = t9 & t1;
+t4 = (int)a0 >> 8;
+t7 = a0 << 24;
+a2 = MEM_U32(v1 + 28);
+MEM_U32(v1 + 20) = t6;
+t2 = t7 | t8;
+t3 = t4 & 0xff00;
+t5 = t2 | t3;
+t6 = a0 >> 24;
+t9 = t6 | t5;
+t8 = a2 << 8;
+t4 = t8 & t1;
+t3 = (int)a2 >> 8;
+t7 = a2 << 24;
+a0 = MEM_U32(v1 + 32);
+MEM_U32(v1 + 24) = t9;
+t2 = t7 | t4;
+t6 = t3 & 0xff00;
+t5 = t2 | t6;
+t9 = a2 >> 24;
+t8 = t9 | t5;
+t4 = a0 << 8;
+t3 = t4 & t1;
+t6 = (int)a0 >> 8;
+t7 = a0 << 24;
+MEM_U32(v1 + 28) = t8;
+t2 = t7 | t3;
+t9 = t6 & 0xff00;
+t5 = t2 | t9;
+t8 = a0 >> 24;
+t6 = MEM_S16(v1 + 36);
+t4 = t8 | t5;
+MEM_U32(v1 + 32) = t4;
+t4 = MEM_S16(v1 + 38);
+t7 = t6 & 0xffff;
+t3 = t7 >> 8;
+t2 = t6 << 8;
+a0 = MEM_U32(v1 + 40);
+t9 = t3 | t2;
+t8 = t4 & 0xffff;
+t5 = t8 >> 8;
+t7 = t4 << 8;
+t6 = t5 | t7;
+MEM_U16(v1 + 36) = (uint16_t)t9;
+t2 = a0 << 8;
+t9 = t2 & t1;
+t4 = (int)a0 >> 8;
+t3 = a0 << 24;
+a2 = MEM_U32(v1 + 44);
+MEM_U16(v1 + 38) = (uint16_t)t6;
+t8 = t3 | t9;
+t5 = t4 & 0xff00;
+t7 = t8 | t5;
+t6 = a0 >> 24;
+t2 = t6 | t7;
+t9 = a2 << 8;
+t4 = t9 & t1;
+t5 = (int)a2 >> 8;
+t3 = a2 << 24;
+a0 = MEM_U32(v1 + 48);
+MEM_U32(v1 + 40) = t2;
+t8 = t3 | t4;
+t6 = t5 & 0xff00;
+t7 = t8 | t6;
+t2 = a2 >> 24;
+t9 = t2 | t7;
+t4 = a0 << 8;
+t5 = t4 & t1;
+t6 = (int)a0 >> 8;
+t3 = a0 << 24;
+MEM_U32(v1 + 44) = t9;
+t8 = t3 | t5;
+t2 = t6 & 0xff00;
+t7 = t8 | t2;
+t9 = a0 >> 24;
+v0 = v0 + 0x1;
+t4 = t9 | t7;
+v1 = v1 + 0x34;
+MEM_U32(v1 + -4) = t4;
+if (v0 != a1) goto L41c818;
+L41ca64:
+//nop;
+return;
+}
+
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41ca6c:
+//swap_dn:
+MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41cbb0;
+v1 = a1 & 0x1;
+t1 = 0xff0000;
+if (v1 == 0) goto L41cae4;
+a2 = MEM_U32(a0 + 0);
+a3 = MEM_U32(a0 + 4);
+t6 = a2 >> 24;
+t7 = a2 << 24;
+t9 = a2 << 8;
+t2 = t9 & t1;
+t8 = t6 | t7;
+t4 = a2 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+t2 = a3 << 8;
+t7 = a3 >> 24;
+t9 = a3 << 24;
+t8 = t7 | t9;
+t4 = t2 & t1;
+MEM_U32(a0 + 0) = t6;
+t5 = a3 >> 8;
+t6 = t5 & 0xff00;
+t3 = t8 | t4;
+t7 = t3 | t6;
+v0 = 0x1;
+MEM_U32(a0 + 4) = t7;
+if (v0 == a1) goto L41cbb0;
+L41cae4:
+t9 = v0 << 3;
+t2 = a1 << 3;
+t0 = t2 + a0;
+v1 = a0 + t9;
+t1 = 0xff0000;
+L41caf8:
+v0 = MEM_U32(v1 + 0);
+a0 = MEM_U32(v1 + 4);
+t8 = v0 >> 24;
+t4 = v0 << 24;
+t3 = v0 << 8;
+t6 = t3 & t1;
+t5 = t8 | t4;
+t9 = v0 >> 8;
+t2 = t9 & 0xff00;
+t7 = t5 | t6;
+t8 = t7 | t2;
+t6 = a0 << 8;
+t4 = a0 >> 24;
+t3 = a0 << 24;
+a2 = MEM_U32(v1 + 8);
+MEM_U32(v1 + 0) = t8;
+t5 = t4 | t3;
+t9 = t6 & t1;
+t2 = a0 >> 8;
+t8 = t2 & 0xff00;
+t7 = t5 | t9;
+t4 = t7 | t8;
+t9 = a2 << 8;
+t6 = a2 << 24;
+t3 = a2 >> 24;
+a3 = MEM_U32(v1 + 12);
+t5 = t3 | t6;
+t2 = t9 & t1;
+MEM_U32(v1 + 4) = t4;
+t8 = a2 >> 8;
+t4 = t8 & 0xff00;
+t7 = t5 | t2;
+t3 = t7 | t4;
+t2 = a3 << 8;
+t9 = a3 << 24;
+t6 = a3 >> 24;
+t5 = t6 | t9;
+t8 = t2 & t1;
+MEM_U32(v1 + 8) = t3;
+t4 = a3 >> 8;
+t3 = t4 & 0xff00;
+t7 = t5 | t8;
+t6 = t7 | t3;
+v1 = v1 + 0x10;
+MEM_U32(v1 + -4) = t6;
+if (v1 != t0) goto L41caf8;
+L41cbb0:
+//nop;
+return;
+}
+
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L41cd70:
+//swap_opt:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a2;
+// fdead 400600eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_gethostsex(mem, sp);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+t0 = zero;
+if ((int)s0 <= 0) goto L41cfec;
+v1 = MEM_U32(sp + 64);
+a3 = sp + 0x2c;
+a2 = 0xff0000;
+L41cdbc:
+at = MEM_U32(v1 + 0);
+t0 = t0 + 0x1;
+MEM_U32(a3 + 0) = at;
+t7 = MEM_U32(v1 + 4);
+//nop;
+MEM_U32(a3 + 4) = t7;
+at = MEM_U32(v1 + 8);
+//nop;
+MEM_U32(a3 + 8) = at;
+t8 = MEM_U32(sp + 52);
+at = 0xff0000;
+t1 = t8 << 8;
+t2 = t1 & a2;
+t9 = t8 << 24;
+t4 = t8 >> 8;
+t5 = t4 & 0xff00;
+t3 = t9 | t2;
+t6 = t3 | t5;
+t7 = t8 >> 24;
+t1 = t6 | t7;
+MEM_U32(sp + 52) = t1;
+if (s1 != v0) goto L41cefc;
+at = MEM_U32(a3 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t2 = MEM_U32(a3 + 4);
+//nop;
+MEM_U32(v1 + 4) = t2;
+at = MEM_U32(a3 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+t4 = MEM_U32(sp + 44);
+at = 0xff0000;
+t5 = t4 << 8;
+t8 = t5 & a2;
+t3 = t4 << 24;
+t6 = t3 | t8;
+t7 = t4 >> 8;
+t3 = MEM_U32(sp + 48);
+t1 = t7 & 0xff00;
+t9 = t6 | t1;
+t2 = t4 >> 24;
+t5 = t9 | t2;
+t7 = t3 << 8;
+t6 = t7 & a2;
+t4 = t3 >> 8;
+t8 = t3 << 24;
+MEM_U32(sp + 44) = t5;
+t1 = t8 | t6;
+t9 = t4 & 0xff00;
+t2 = t1 | t9;
+t5 = t3 >> 24;
+t8 = MEM_U8(sp + 44);
+t7 = t2 | t5;
+MEM_U32(sp + 48) = t7;
+MEM_U8(v1 + 0) = (uint8_t)t8;
+t6 = MEM_U32(sp + 44);
+a0 = MEM_U32(v1 + 0);
+at = at | 0xffff;
+t4 = t6 & at;
+t1 = t4 ^ a0;
+t9 = t1 << 8;
+t3 = t9 >> 8;
+t2 = t3 ^ a0;
+MEM_U32(v1 + 0) = t2;
+t5 = MEM_U32(sp + 48);
+a1 = MEM_U32(v1 + 4);
+t7 = t5 >> 12;
+t8 = t7 ^ a1;
+t6 = t8 << 12;
+t4 = t6 >> 12;
+t1 = t4 ^ a1;
+MEM_U32(v1 + 4) = t1;
+t7 = MEM_U16(v1 + 4);
+t9 = MEM_U32(sp + 48);
+t8 = t7 & 0xf;
+t5 = t9 << 4;
+t6 = t5 | t8;
+MEM_U16(v1 + 4) = (uint16_t)t6;
+goto L41cfe4;
+L41cefc:
+t4 = MEM_U8(v1 + 0);
+at = at | 0xffff;
+MEM_U8(sp + 44) = (uint8_t)t4;
+t1 = MEM_U32(v1 + 0);
+t3 = MEM_U32(sp + 44);
+t9 = t1 & at;
+t2 = t9 ^ t3;
+t7 = t2 << 8;
+t5 = t7 >> 8;
+t8 = t5 ^ t3;
+MEM_U32(sp + 44) = t8;
+t6 = MEM_U32(v1 + 4);
+t1 = MEM_U32(sp + 48);
+at = 0xf0000;
+at = at | 0xffff;
+t4 = t6 & at;
+t9 = t1 >> 12;
+t2 = t4 ^ t9;
+t7 = t2 << 12;
+t5 = t7 ^ t1;
+MEM_U32(sp + 48) = t5;
+t3 = MEM_U32(v1 + 4);
+t9 = MEM_U16(sp + 50);
+t6 = t3 >> 20;
+t4 = t6 & 0xfff;
+t2 = t9 & 0xf000;
+t7 = t4 | t2;
+t5 = t8 << 8;
+t3 = t5 & a2;
+t1 = t8 << 24;
+MEM_U16(sp + 50) = (uint16_t)t7;
+t6 = t1 | t3;
+t9 = t8 >> 8;
+t1 = MEM_U32(sp + 48);
+t4 = t9 & 0xff00;
+t2 = t6 | t4;
+t7 = t8 >> 24;
+t5 = t2 | t7;
+t9 = t1 << 8;
+t6 = t9 & a2;
+t8 = t1 >> 8;
+t3 = t1 << 24;
+MEM_U32(sp + 44) = t5;
+t4 = t3 | t6;
+t2 = t8 & 0xff00;
+t7 = t4 | t2;
+t5 = t1 >> 24;
+t9 = t7 | t5;
+MEM_U32(sp + 48) = t9;
+at = MEM_U32(a3 + 0);
+//nop;
+MEM_U32(v1 + 0) = at;
+t8 = MEM_U32(a3 + 4);
+//nop;
+MEM_U32(v1 + 4) = t8;
+at = MEM_U32(a3 + 8);
+//nop;
+MEM_U32(v1 + 8) = at;
+L41cfe4:
+v1 = v1 + 0xc;
+if (t0 != s0) goto L41cdbc;
+L41cfec:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L41deb4:
+//gethostsex:
+sp = sp + 0xfffffff8;
+t6 = 0x1;
+MEM_U32(sp + 4) = t6;
+t7 = MEM_S8(sp + 4);
+at = 0x1;
+v0 = zero;
+if (t7 != at) goto L41ded8;
+v0 = 0x1;
+goto L41ded8;
+L41ded8:
+// bdead 9 sp = sp + 0x8;
+return v0;
+//nop;
+}
+
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41dee4:
+//st_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 48) = a2;
+a2 = 0x10000a70;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10002610;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400000eb MEM_U32(sp + 32) = gp;
+// fdead 400000eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x1000261c;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L41dfa4:
+//st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 48) = a2;
+a2 = 0x10000a70;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10002620;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002630;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L41e064:
+//ldfsymorder:
+a2 = MEM_U32(a0 + 12);
+v0 = a1 + 0x60;
+//nop;
+if (a2 == 0) goto L41e094;
+t6 = MEM_U32(a0 + 8);
+//nop;
+//nop;
+if (t6 == 0) goto L41e094;
+//nop;
+if (v0 == a2) goto L41e094;
+v0 = zero;
+return v0;
+L41e094:
+v1 = MEM_U32(a0 + 8);
+//nop;
+t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41e0b0;
+v0 = zero;
+return v0;
+L41e0b0:
+a1 = MEM_U32(a0 + 28);
+//nop;
+//nop;
+if (a1 == 0) goto L41e0e4;
+t8 = MEM_U32(a0 + 24);
+//nop;
+//nop;
+if (t8 == 0) goto L41e0e4;
+t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41e0e4;
+v0 = zero;
+return v0;
+L41e0e4:
+t0 = MEM_U32(a0 + 24);
+//nop;
+t1 = t0 << 2;
+t1 = t1 - t0;
+t1 = t1 << 2;
+t1 = t1 + t0;
+t1 = t1 << 2;
+v1 = v1 + t1;
+t2 = v1 & 0x3;
+//nop;
+if (t2 == 0) goto L41e118;
+v0 = zero;
+return v0;
+L41e118:
+a1 = MEM_U32(a0 + 36);
+//nop;
+//nop;
+if (a1 == 0) goto L41e148;
+t3 = MEM_U32(a0 + 32);
+t4 = v0 + v1;
+//nop;
+if (t3 == 0) goto L41e148;
+//nop;
+if (t4 == a1) goto L41e148;
+v0 = zero;
+return v0;
+L41e148:
+t5 = MEM_U32(a0 + 32);
+a2 = 0xc;
+lo = t5 * a2;
+hi = (uint32_t)((uint64_t)t5 * (uint64_t)a2 >> 32);
+t6 = lo;
+v1 = v1 + t6;
+t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41e170;
+v0 = zero;
+return v0;
+L41e170:
+a1 = MEM_U32(a0 + 44);
+//nop;
+//nop;
+if (a1 == 0) goto L41e1a4;
+t8 = MEM_U32(a0 + 40);
+//nop;
+//nop;
+if (t8 == 0) goto L41e1a4;
+t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41e1a4;
+v0 = zero;
+return v0;
+L41e1a4:
+t0 = MEM_U32(a0 + 40);
+//nop;
+lo = t0 * a2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)a2 >> 32);
+t1 = lo;
+v1 = v1 + t1;
+t2 = v1 & 0x3;
+//nop;
+if (t2 == 0) goto L41e1cc;
+v0 = zero;
+return v0;
+L41e1cc:
+a1 = MEM_U32(a0 + 52);
+//nop;
+//nop;
+if (a1 == 0) goto L41e1fc;
+t3 = MEM_U32(a0 + 48);
+t4 = v0 + v1;
+//nop;
+if (t3 == 0) goto L41e1fc;
+//nop;
+if (t4 == a1) goto L41e1fc;
+v0 = zero;
+return v0;
+L41e1fc:
+t5 = MEM_U32(a0 + 48);
+//nop;
+t6 = t5 << 2;
+v1 = v1 + t6;
+t7 = v1 & 0x3;
+//nop;
+if (t7 == 0) goto L41e220;
+v0 = zero;
+return v0;
+L41e220:
+a1 = MEM_U32(a0 + 60);
+//nop;
+//nop;
+if (a1 == 0) goto L41e254;
+t8 = MEM_U32(a0 + 56);
+//nop;
+//nop;
+if (t8 == 0) goto L41e254;
+t9 = v0 + v1;
+//nop;
+if (t9 == a1) goto L41e254;
+v0 = zero;
+return v0;
+L41e254:
+t0 = MEM_U32(a0 + 56);
+//nop;
+v1 = v1 + t0;
+t1 = v1 & 0x3;
+//nop;
+if (t1 == 0) goto L41e274;
+v0 = zero;
+return v0;
+L41e274:
+a1 = MEM_U32(a0 + 68);
+//nop;
+//nop;
+if (a1 == 0) goto L41e2a4;
+t2 = MEM_U32(a0 + 64);
+t3 = v0 + v1;
+//nop;
+if (t2 == 0) goto L41e2a4;
+//nop;
+if (t3 == a1) goto L41e2a4;
+v0 = zero;
+return v0;
+L41e2a4:
+t4 = MEM_U32(a0 + 64);
+//nop;
+v1 = v1 + t4;
+t5 = v1 & 0x3;
+//nop;
+if (t5 == 0) goto L41e2c4;
+v0 = zero;
+return v0;
+L41e2c4:
+a1 = MEM_U32(a0 + 76);
+//nop;
+//nop;
+if (a1 == 0) goto L41e2f4;
+t6 = MEM_U32(a0 + 72);
+t7 = v0 + v1;
+//nop;
+if (t6 == 0) goto L41e2f4;
+//nop;
+if (t7 == a1) goto L41e2f4;
+v0 = zero;
+return v0;
+L41e2f4:
+t8 = MEM_U32(a0 + 72);
+//nop;
+t9 = t8 << 3;
+t9 = t9 + t8;
+t9 = t9 << 3;
+v1 = v1 + t9;
+t0 = v1 & 0x3;
+//nop;
+if (t0 == 0) goto L41e320;
+v0 = zero;
+return v0;
+L41e320:
+a1 = MEM_U32(a0 + 84);
+//nop;
+//nop;
+if (a1 == 0) goto L41e350;
+t1 = MEM_U32(a0 + 80);
+t2 = v0 + v1;
+//nop;
+if (t1 == 0) goto L41e350;
+//nop;
+if (t2 == a1) goto L41e350;
+v0 = zero;
+return v0;
+L41e350:
+t3 = MEM_U32(a0 + 80);
+//nop;
+t4 = t3 << 2;
+v1 = v1 + t4;
+t5 = v1 & 0x3;
+//nop;
+if (t5 == 0) goto L41e374;
+v0 = zero;
+return v0;
+L41e374:
+a1 = MEM_U32(a0 + 92);
+//nop;
+//nop;
+if (a1 == 0) goto L41e3a4;
+t6 = MEM_U32(a0 + 88);
+t7 = v0 + v1;
+//nop;
+if (t6 == 0) goto L41e3a4;
+//nop;
+if (t7 == a1) goto L41e3a4;
+v0 = zero;
+return v0;
+L41e3a4:
+t8 = MEM_U32(a0 + 88);
+//nop;
+t9 = t8 << 4;
+v1 = v1 + t9;
+t0 = v1 & 0x3;
+//nop;
+if (t0 == 0) goto L41e3c8;
+v0 = zero;
+return v0;
+L41e3c8:
+a1 = MEM_U32(a0 + 20);
+//nop;
+//nop;
+if (a1 == 0) goto L41e3f8;
+t1 = MEM_U32(a0 + 16);
+t2 = v0 + v1;
+//nop;
+if (t1 == 0) goto L41e3f8;
+//nop;
+if (t2 == a1) goto L41e3f8;
+v0 = zero;
+return v0;
+L41e3f8:
+t3 = MEM_U32(a0 + 16);
+//nop;
+t4 = t3 << 3;
+v1 = v1 + t4;
+t5 = v1 & 0x3;
+v0 = v1;
+if (t5 == 0) goto L41e41c;
+v0 = zero;
+return v0;
+L41e41c:
+//nop;
+return v0;
+}
+
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41e424:
+//st_warning:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+// fdead 4000002b MEM_U32(sp + 44) = a1;
+a1 = 0x10002640;
+a0 = 0xfb528e4;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+// fdead 4000006b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+//nop;
+a2 = 0x10000a70;
+a0 = 0xfb528e4;
+a1 = 0x10002644;
+//nop;
+a2 = MEM_U32(a2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002654;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+//nop;
+//nop;
+}
+
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L41e4f4:
+//_md_st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 48) = a2;
+a2 = 0x10000a70;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10002660;
+a0 = 0xfb528e4;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002670;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L41e5b4:
+//_md_st_error:
+//nop;
+//nop;
+//nop;
+// fdead 2b sp = sp + 0xffffffd8;
+// fdead 2b MEM_U32(sp + 48) = a2;
+a2 = 0x10000a70;
+// fdead ab MEM_U32(sp + 40) = a0;
+// fdead ab MEM_U32(sp + 44) = a1;
+a1 = 0x10002674;
+a0 = 0xfb528e4;
+//nop;
+// fdead eb MEM_U32(sp + 36) = ra;
+a2 = MEM_U32(a2 + 0);
+// fdead eb MEM_U32(sp + 32) = gp;
+// fdead eb MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b t6 = MEM_U32(sp + 52);
+// fdead b t7 = MEM_U32(sp + 56);
+a0 = 0xfb528e4;
+//nop;
+// fdead 2b a1 = MEM_U32(sp + 40);
+// fdead 2b a2 = MEM_U32(sp + 44);
+// fdead 2b a3 = MEM_U32(sp + 48);
+// fdead 2b MEM_U32(sp + 16) = t6;
+// fdead 2b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb528e4;
+a1 = 0x10002680;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// fdead 3 ra = MEM_U32(sp + 36);
+// fdead 3 gp = MEM_U32(sp + 32);
+// fdead 3 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L41e674:
+//_md_st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L41e6b8;
+v1 = 0x100054d4;
+//nop;
+v1 = MEM_U32(v1 + 0);
+//nop;
+t6 = MEM_U32(v1 + 40);
+//nop;
+//nop;
+if ((int)a0 >= (int)t6) goto L41e6b8;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L41e6b8:
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L41e7c0:
+//_md_st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x100054d8;
+// fdead eb sp = sp + 0xffffffe0;
+a0 = MEM_U32(a0 + 0);
+// fdead eb MEM_U32(sp + 28) = ra;
+// fdead eb MEM_U32(sp + 24) = gp;
+if (a0 != 0) goto L41e7ec;
+v0 = 0xffffffff;
+goto L41e804;
+L41e7ec:
+//nop;
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+L41e804:
+// fdead eb ra = MEM_U32(sp + 28);
+// fdead eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, hi = 0;
+L41e814:
+//_md_st_malloc:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffd8;
+// fdead 1eb MEM_U32(sp + 36) = ra;
+// fdead 1eb MEM_U32(sp + 32) = gp;
+// fdead 1eb MEM_U32(sp + 28) = s1;
+// fdead 1eb MEM_U32(sp + 24) = s0;
+// fdead 1eb MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+if (v0 == 0) goto L41e858;
+at = 0xffffffff;
+if (a0 == 0) goto L41e858;
+t0 = v0 << 1;
+if (a0 != at) goto L41e904;
+L41e858:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41e8a0;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41e898;
+a0 = 0x10002684;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41e898:
+v0 = s1;
+goto L41e960;
+L41e8a0:
+t6 = MEM_U32(s0 + 0);
+// fdead 683ef t7 = MEM_U32(sp + 48);
+//nop;
+// fdead 683ef lo = t6 * t7;
+hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+// fdead 683ef a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41e95c;
+t8 = MEM_U32(s0 + 0);
+// fdead 206000f t9 = MEM_U32(sp + 48);
+//nop;
+// fdead 206000f lo = t8 * t9;
+hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+// fdead 206000f a1 = lo;
+v0 = s1;
+if (a1 == 0) goto L41e960;
+a0 = 0x100026c4;
+//nop;
+a0 = a0;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+v0 = s1;
+goto L41e960;
+L41e904:
+MEM_U32(s0 + 0) = t0;
+// fdead 603ef t2 = MEM_U32(sp + 48);
+//nop;
+// fdead 603ef lo = t0 * t2;
+hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a0 = s1;
+// fdead 603ef a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// fdead 6000f gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L41e95c;
+t3 = MEM_U32(s0 + 0);
+// fdead 6100f t4 = MEM_U32(sp + 48);
+a0 = 0x10002708;
+// fdead 6102f lo = t3 * t4;
+hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+//nop;
+a0 = a0;
+// fdead 6102f a1 = lo;
+//nop;
+f__md_st_error(mem, sp, a0);
+// fdead 60007 gp = MEM_U32(sp + 32);
+//nop;
+L41e95c:
+v0 = s1;
+L41e960:
+// fdead 206000f ra = MEM_U32(sp + 36);
+// fdead 206000f s0 = MEM_U32(sp + 24);
+// fdead 206000f s1 = MEM_U32(sp + 28);
+// fdead 206000f sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L41ec00:
+//st_iaux_copyty:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffc8;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 28) = s2;
+// fdead 6b MEM_U32(sp + 24) = s1;
+// fdead 6b MEM_U32(sp + 20) = s0;
+// fdead 6b MEM_U32(sp + 60) = a1;
+a1 = MEM_U32(a1 + 8);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t7 = a1 & at;
+s2 = a0;
+s1 = zero;
+a1 = t7;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead c001f a2 = MEM_U32(sp + 60);
+// fdead c001f gp = MEM_U32(sp + 32);
+// fdead c001f t8 = MEM_U32(a2 + 8);
+at = 0x6;
+// fdead c001f t9 = t8 >> 26;
+t0 = s1 << 2;
+if (t9 != at) goto L41ec70;
+s1 = 0x1;
+t0 = s1 << 2;
+L41ec70:
+a1 = t0 + v0;
+v1 = MEM_U8(a1 + 0);
+at = 0x25;
+t1 = v1 & 0x3f;
+s1 = s1 + 0x1;
+v1 = t1;
+if (t1 != at) goto L41ecb4;
+t2 = s1 << 2;
+t3 = v0 + t2;
+t4 = MEM_U32(t3 + 0);
+a3 = 0xfff;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L41ecac;
+s1 = s1 + 0x1;
+L41ecac:
+s1 = s1 + 0x1;
+goto L41ed38;
+L41ecb4:
+at = 0x11;
+t6 = s1 << 2;
+if (v1 == at) goto L41ece8;
+at = 0x14;
+if (v1 == at) {
+at = 0xc;
+goto L41ece8;}
+at = 0xc;
+if (v1 == at) {
+at = 0xd;
+goto L41ece8;}
+at = 0xd;
+if (v1 == at) {
+at = 0xf;
+goto L41ece8;}
+at = 0xf;
+if (v1 == at) {
+at = 0xe;
+goto L41ece8;}
+at = 0xe;
+if (v1 != at) {
+t7 = v0 + t6;
+goto L41ed0c;}
+L41ece8:
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+a3 = 0xfff;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L41ed04;
+s1 = s1 + 0x1;
+L41ed04:
+s1 = s1 + 0x1;
+goto L41ed38;
+L41ed0c:
+at = 0x10;
+t0 = s1 << 2;
+if (v1 != at) goto L41ed38;
+t1 = v0 + t0;
+t2 = MEM_U32(t1 + 0);
+a3 = 0xfff;
+t3 = t2 >> 20;
+//nop;
+if (a3 != t3) goto L41ed34;
+s1 = s1 + 0x1;
+L41ed34:
+s1 = s1 + 0x3;
+L41ed38:
+t4 = MEM_U16(a1 + 2);
+v1 = 0x3;
+t5 = t4 >> 12;
+a3 = 0xfff;
+if (v1 != t5) goto L41ed70;
+t6 = s1 << 2;
+t7 = v0 + t6;
+t8 = MEM_U32(t7 + 0);
+//nop;
+t9 = t8 >> 20;
+//nop;
+if (a3 != t9) goto L41ed6c;
+s1 = s1 + 0x1;
+L41ed6c:
+s1 = s1 + 0x4;
+L41ed70:
+t0 = MEM_U8(a1 + 2);
+t2 = s1 << 2;
+t1 = t0 & 0xf;
+t3 = v0 + t2;
+if (v1 != t1) goto L41eda0;
+t4 = MEM_U32(t3 + 0);
+//nop;
+t5 = t4 >> 20;
+//nop;
+if (a3 != t5) goto L41ed9c;
+s1 = s1 + 0x1;
+L41ed9c:
+s1 = s1 + 0x4;
+L41eda0:
+t6 = MEM_U8(a1 + 3);
+t8 = s1 << 2;
+t7 = t6 >> 4;
+t9 = v0 + t8;
+if (v1 != t7) goto L41edd0;
+t0 = MEM_U32(t9 + 0);
+//nop;
+t1 = t0 >> 20;
+//nop;
+if (a3 != t1) goto L41edcc;
+s1 = s1 + 0x1;
+L41edcc:
+s1 = s1 + 0x4;
+L41edd0:
+a0 = MEM_U32(a1 + 0);
+t3 = s1 << 2;
+t2 = a0 & 0xf;
+t4 = v0 + t3;
+if (v1 != t2) goto L41ee00;
+t5 = MEM_U32(t4 + 0);
+//nop;
+t6 = t5 >> 20;
+//nop;
+if (a3 != t6) goto L41edfc;
+s1 = s1 + 0x1;
+L41edfc:
+s1 = s1 + 0x4;
+L41ee00:
+t7 = MEM_U8(a1 + 1);
+t9 = s1 << 2;
+t8 = t7 >> 4;
+t0 = v0 + t9;
+if (v1 != t8) goto L41ee30;
+t1 = MEM_U32(t0 + 0);
+//nop;
+t2 = t1 >> 20;
+//nop;
+if (a3 != t2) goto L41ee2c;
+s1 = s1 + 0x1;
+L41ee2c:
+s1 = s1 + 0x4;
+L41ee30:
+t3 = MEM_U16(a1 + 0);
+t5 = s1 << 2;
+t4 = t3 & 0xf;
+t9 = a0 >> 31;
+if (v1 != t4) goto L41ee64;
+t6 = v0 + t5;
+t7 = MEM_U32(t6 + 0);
+//nop;
+t8 = t7 >> 20;
+//nop;
+if (a3 != t8) goto L41ee60;
+s1 = s1 + 0x1;
+L41ee60:
+s1 = s1 + 0x4;
+L41ee64:
+//nop;
+if (t9 == 0) goto L41ee70;
+s1 = s1 + 0x1;
+L41ee70:
+s0 = zero;
+if ((int)s1 <= 0) goto L41ef0c;
+// fdead 60fff7f a2 = MEM_U32(sp + 60);
+L41ee7c:
+a0 = s2;
+// fdead 60fff7f v0 = MEM_U32(a2 + 8);
+at = 0xf0000;
+if (s0 != 0) goto L41eecc;
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t0 = v0 & at;
+a1 = t0 + s0;
+a0 = s2;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+// fdead e003f MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+// fdead e001f MEM_U32(sp + 44) = v0;
+goto L41ef00;
+L41eecc:
+//nop;
+at = at | 0xffff;
+t3 = v0 & at;
+a1 = t3 + s0;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+// fdead e003f MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1);
+// fdead e001f gp = MEM_U32(sp + 32);
+//nop;
+L41ef00:
+s0 = s0 + 0x1;
+// fdead e001f a2 = MEM_U32(sp + 60);
+if (s0 != s1) goto L41ee7c;
+L41ef0c:
+// fdead 60fff7f ra = MEM_U32(sp + 36);
+// fdead 60fff7f v0 = MEM_U32(sp + 44);
+// fdead 60fff7f s0 = MEM_U32(sp + 20);
+// fdead 60fff7f s1 = MEM_U32(sp + 24);
+// fdead 60fff7f s2 = MEM_U32(sp + 28);
+// fdead 60fff7f sp = sp + 0x38;
+return v0;
+}
+
+static void f_st_auxisymadd(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, a0 = 0, a1 = 0;
+L41f1f0:
+//st_auxisymadd:
+//nop;
+//nop;
+//nop;
+// fdead b sp = sp + 0xffffffd8;
+//nop;
+// fdead b MEM_U32(sp + 28) = ra;
+// fdead b MEM_U32(sp + 24) = gp;
+// fdead b MEM_U32(sp + 36) = a0;
+// fdead b MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1);
+// fdead 1b ra = MEM_U32(sp + 28);
+// fdead 1b gp = MEM_U32(sp + 24);
+// fdead 1b sp = sp + 0x28;
+return;
+}
+
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, t9 = 0;
+L41f228:
+//st_auxrndxadd:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffd0;
+// fdead 6b t7 = MEM_U16(sp + 44);
+at = 0xf0000;
+// fdead 6f t8 = t7 | 0xfff0;
+// fdead 6f MEM_U16(sp + 44) = (uint16_t)t8;
+// fdead 6f t0 = MEM_U32(sp + 44);
+at = at | 0xffff;
+t9 = a1 & at;
+// fdead 400006f t1 = t9 ^ t0;
+// fdead 400006f t2 = t1 << 12;
+// fdead 400006f t3 = t2 >> 12;
+// fdead 400006f t4 = t3 ^ t0;
+// fdead 400006f MEM_U32(sp + 28) = ra;
+// fdead 400006f MEM_U32(sp + 24) = gp;
+// fdead 400006f MEM_U32(sp + 48) = a0;
+// fdead 400006f MEM_U32(sp + 44) = t4;
+// fdead 400006f t5 = sp + 0x2c;
+// fdead 400006f a0 = MEM_U32(t5 + 0);
+//nop;
+// fdead 400006f v0 = sp + 0x28;
+MEM_U32(v0 + 0) = a0;
+// fdead 400006f MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f a0 = MEM_U32(sp + 48);
+//nop;
+// fdead 1f MEM_U32(sp + 36) = v0;
+//nop;
+f_st_auxisymadd(mem, sp);
+// fdead 1f ra = MEM_U32(sp + 28);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f v0 = MEM_U32(sp + 36);
+// fdead 1f sp = sp + 0x30;
+return;
+}
+
+static void f_exit(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, s0 = 0, s1 = 0, s2 = 0;
+L41f3a4:
+//exit:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+s0 = 0x100054dc;
+// fdead 4002002b MEM_U32(sp + 36) = ra;
+s0 = MEM_U32(s0 + 0);
+// fdead 4002002b MEM_U32(sp + 32) = gp;
+// fdead 4002002b MEM_U32(sp + 28) = s2;
+// fdead 4002002b MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 80) = a0;
+if (s0 == 0) goto L41f438;
+s2 = 0x100027b0;
+s1 = sp + 0x34;
+s2 = s2;
+L41f3e4:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_getpid();
+// bdead 400e000b gp = MEM_U32(sp + 32);
+a0 = s1;
+//nop;
+a1 = s2;
+a2 = s0;
+a3 = v0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 400e0003 gp = MEM_U32(sp + 32);
+a0 = s1;
+//nop;
+//nop;
+//nop;
+v0 = wrapper_unlink(mem, a0);
+s0 = s0 + 0xffffffff;
+// bdead 400e01c3 gp = MEM_U32(sp + 32);
+//nop;
+if (s0 != 0) goto L41f3e4;
+L41f438:
+//nop;
+a0 = 0xe;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper__prctl(mem, a0, sp);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+//nop;
+if ((int)v0 >= (int)0x2) goto L41f498;
+//nop;
+//nop;
+//nop;
+wrapper__exithandle(mem);
+// bdead 400001c3 gp = MEM_U32(sp + 32);
+//nop;
+t6 = 0x1;
+//nop;
+//nop;
+if (t6 == 0) goto L41f498;
+//nop;
+a0 = zero;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper__rld_new_interface(mem, a0, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+L41f498:
+//nop;
+//nop;
+//nop;
+wrapper__cleanup(mem);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 80);
+//nop;
+//nop;
+//nop;
+wrapper__exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x50;
+return;
+//nop;
+//nop;
+}
+
+static void func_41f4e4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L41f4e4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 200400001eb MEM_U32(sp + 44) = ra;
+// fdead 200400001eb MEM_U32(sp + 40) = gp;
+// fdead 200400001eb MEM_U32(sp + 36) = s3;
+// fdead 200400001eb MEM_U32(sp + 32) = s2;
+// fdead 200400001eb MEM_U32(sp + 28) = s1;
+// fdead 200400001eb MEM_U32(sp + 24) = s0;
+t6 = MEM_U8(a0 + 12);
+s0 = a1;
+t7 = t6 & 0x2;
+s1 = a0;
+s2 = a2;
+if (t7 == 0) goto L41f658;
+t8 = MEM_U32(a0 + 0);
+s3 = 0xffffffff;
+v1 = t8 - a2;
+MEM_U32(a0 + 0) = v1;
+if ((int)v1 >= 0) goto L41f5ec;
+L41f538:
+t0 = v1 + s2;
+MEM_U32(s1 + 0) = t0;
+if ((int)t0 <= 0) goto L41f5b0;
+a0 = t0 + s0;
+a1 = a0 - s0;
+v0 = MEM_U32(s1 + 4);
+t1 = a1 & 0x3;
+s2 = s2 - t0;
+if (t1 == 0) goto L41f57c;
+v1 = t1 + s0;
+L41f560:
+t2 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(v0 + -1) = (uint8_t)t2;
+if (v1 != s0) goto L41f560;
+//nop;
+if (s0 == a0) goto L41f5ac;
+L41f57c:
+t3 = MEM_U8(s0 + 0);
+s0 = s0 + 0x4;
+MEM_U8(v0 + 0) = (uint8_t)t3;
+t4 = MEM_U8(s0 + -3);
+v0 = v0 + 0x4;
+MEM_U8(v0 + -3) = (uint8_t)t4;
+t5 = MEM_U8(s0 + -2);
+//nop;
+MEM_U8(v0 + -2) = (uint8_t)t5;
+t6 = MEM_U8(s0 + -1);
+MEM_U8(v0 + -1) = (uint8_t)t6;
+if (s0 != a0) goto L41f57c;
+L41f5ac:
+MEM_U32(s1 + 4) = v0;
+L41f5b0:
+MEM_U32(s1 + 0) = s3;
+//nop;
+a0 = MEM_U8(s0 + 0);
+a1 = s1;
+s0 = s0 + 0x1;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+s2 = s2 + 0xffffffff;
+// bdead 401e0001 ra = MEM_U32(sp + 44);
+if (s2 == 0) goto L41f65c;
+t7 = MEM_U32(s1 + 0);
+//nop;
+v1 = t7 - s2;
+MEM_U32(s1 + 0) = v1;
+if ((int)v1 < 0) goto L41f538;
+L41f5ec:
+a0 = s0 + s2;
+a2 = a0 - s0;
+v0 = MEM_U32(s1 + 4);
+t9 = a2 & 0x3;
+a2 = t9;
+if (t9 == 0) goto L41f624;
+v1 = a2 + s0;
+L41f608:
+t0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(v0 + -1) = (uint8_t)t0;
+if (v1 != s0) goto L41f608;
+//nop;
+if (s0 == a0) goto L41f654;
+L41f624:
+t1 = MEM_U8(s0 + 0);
+s0 = s0 + 0x4;
+MEM_U8(v0 + 0) = (uint8_t)t1;
+t2 = MEM_U8(s0 + -3);
+v0 = v0 + 0x4;
+MEM_U8(v0 + -3) = (uint8_t)t2;
+t3 = MEM_U8(s0 + -2);
+//nop;
+MEM_U8(v0 + -2) = (uint8_t)t3;
+t4 = MEM_U8(s0 + -1);
+MEM_U8(v0 + -1) = (uint8_t)t4;
+if (s0 != a0) goto L41f624;
+L41f654:
+MEM_U32(s1 + 4) = v0;
+L41f658:
+// bdead 1 ra = MEM_U32(sp + 44);
+L41f65c:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_41f674(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L41f674:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+t6 = MEM_U8(a0 + 12);
+s0 = a1;
+t7 = t6 & 0x2;
+s1 = a2;
+s2 = a0;
+if (t7 == 0) goto L41f7b0;
+// bdead 400e00a1 ra = MEM_U32(sp + 44);
+if ((int)a2 <= 0) goto L41f7b4;
+t8 = MEM_U32(a0 + 0);
+s3 = 0xffffffff;
+t9 = t8 - a2;
+MEM_U32(a0 + 0) = t9;
+v1 = t9;
+if ((int)t9 >= 0) goto L41f764;
+L41f6d4:
+t0 = v1 + s1;
+MEM_U32(s2 + 0) = t0;
+if ((int)t0 <= 0) goto L41f72c;
+v0 = MEM_U32(s2 + 4);
+s1 = s1 - t0;
+a0 = t0 + v0;
+a1 = a0 - v0;
+t1 = a1 & 0x3;
+v1 = t1 + v0;
+if (t1 == 0) goto L41f710;
+L41f6fc:
+v0 = v0 + 0x1;
+MEM_U8(v0 + -1) = (uint8_t)s0;
+if (v1 != v0) goto L41f6fc;
+//nop;
+if (v0 == a0) goto L41f728;
+L41f710:
+v0 = v0 + 0x4;
+MEM_U8(v0 + -4) = (uint8_t)s0;
+MEM_U8(v0 + -3) = (uint8_t)s0;
+MEM_U8(v0 + -2) = (uint8_t)s0;
+MEM_U8(v0 + -1) = (uint8_t)s0;
+if (v0 != a0) goto L41f710;
+L41f728:
+MEM_U32(s2 + 4) = v0;
+L41f72c:
+MEM_U32(s2 + 0) = s3;
+//nop;
+a0 = s0;
+a1 = s2;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+s1 = s1 + 0xffffffff;
+// bdead 401e0001 ra = MEM_U32(sp + 44);
+if (s1 == 0) goto L41f7b4;
+t2 = MEM_U32(s2 + 0);
+//nop;
+v1 = t2 - s1;
+MEM_U32(s2 + 0) = v1;
+if ((int)v1 < 0) goto L41f6d4;
+L41f764:
+v0 = MEM_U32(s2 + 4);
+//nop;
+a0 = v0 + s1;
+a2 = a0 - v0;
+t4 = a2 & 0x3;
+v1 = t4 + v0;
+if (t4 == 0) goto L41f794;
+L41f780:
+v0 = v0 + 0x1;
+MEM_U8(v0 + -1) = (uint8_t)s0;
+if (v1 != v0) goto L41f780;
+//nop;
+if (v0 == a0) goto L41f7ac;
+L41f794:
+v0 = v0 + 0x4;
+MEM_U8(v0 + -4) = (uint8_t)s0;
+MEM_U8(v0 + -3) = (uint8_t)s0;
+MEM_U8(v0 + -2) = (uint8_t)s0;
+MEM_U8(v0 + -1) = (uint8_t)s0;
+if (v0 != a0) goto L41f794;
+L41f7ac:
+MEM_U32(s2 + 4) = v0;
+L41f7b0:
+// bdead 1 ra = MEM_U32(sp + 44);
+L41f7b4:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void f_writeln(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L41f7cc:
+//writeln:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+t6 = MEM_U8(a0 + 12);
+a1 = a0;
+t7 = t6 & 0x2;
+//nop;
+if (t7 != 0) goto L41f81c;
+a0 = 0xfb528e4;
+a1 = 0x100027c0;
+//nop;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41f8a0;
+L41f81c:
+t8 = 0xfb51f00;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L41f850;
+//nop;
+a0 = 0xa;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41f8a0;
+L41f850:
+t9 = MEM_U32(a1 + 0);
+//nop;
+t0 = t9 + 0xffffffff;
+MEM_U32(a1 + 0) = t0;
+if ((int)t0 >= 0) goto L41f880;
+//nop;
+a0 = 0xa;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41f8a0;
+L41f880:
+t3 = MEM_U32(a1 + 4);
+t2 = 0xa;
+MEM_U8(t3 + 0) = (uint8_t)t2;
+t4 = MEM_U32(a1 + 4);
+//nop;
+t5 = t4 + 0x1;
+MEM_U32(a1 + 4) = t5;
+// bdead 1 ra = MEM_U32(sp + 28);
+L41f8a0:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_write_char(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L41f94c:
+//write_char:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = (int)a2 < (int)0x2;
+s0 = a1 & 0xff;
+// fdead 400201ef MEM_U32(sp + 28) = ra;
+// fdead 400201ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+a3 = a0;
+if (at != 0) goto L41fa24;
+//nop;
+a1 = 0x20;
+// fdead 400201ef t9 = t9;
+a2 = a2 + 0xffffffff;
+MEM_U32(sp + 32) = a3;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 32);
+t7 = 0xfb51f00;
+//nop;
+t7 = MEM_U32(t7 + 0);
+//nop;
+//nop;
+if (t7 == 0) goto L41f9d4;
+//nop;
+a0 = s0;
+a1 = a3;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fb70;
+L41f9d4:
+t8 = MEM_U32(a3 + 0);
+//nop;
+t9 = t8 + 0xffffffff;
+MEM_U32(a3 + 0) = t9;
+if ((int)t9 >= 0) goto L41fa04;
+//nop;
+a0 = s0;
+a1 = a3;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fb70;
+L41fa04:
+t1 = MEM_U32(a3 + 4);
+//nop;
+MEM_U8(t1 + 0) = (uint8_t)s0;
+t2 = MEM_U32(a3 + 4);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(a3 + 4) = t3;
+goto L41fb6c;
+L41fa24:
+t4 = MEM_U32(sp + 40);
+//nop;
+//nop;
+if ((int)t4 >= (int)0xffffffff) goto L41faec;
+t5 = 0xfb51f00;
+a0 = s0;
+t5 = MEM_U32(t5 + 0);
+//nop;
+//nop;
+if (t5 == 0) goto L41fa70;
+//nop;
+a1 = a3;
+MEM_U32(sp + 32) = a3;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 32);
+//nop;
+goto L41fac0;
+L41fa70:
+t6 = MEM_U32(a3 + 0);
+a0 = s0;
+t7 = t6 + 0xffffffff;
+MEM_U32(a3 + 0) = t7;
+if ((int)t7 >= 0) goto L41faa4;
+//nop;
+a1 = a3;
+MEM_U32(sp + 32) = a3;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 32);
+//nop;
+goto L41fac0;
+L41faa4:
+t9 = MEM_U32(a3 + 4);
+//nop;
+MEM_U8(t9 + 0) = (uint8_t)s0;
+t0 = MEM_U32(a3 + 4);
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(a3 + 4) = t1;
+L41fac0:
+//nop;
+t2 = MEM_U32(sp + 40);
+t3 = 0xffffffff;
+// bdead 40001901 t9 = t9;
+a0 = a3;
+a1 = 0x20;
+a2 = t3 - t2;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fb70;
+L41faec:
+t4 = 0xfb51f00;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L41fb20;
+//nop;
+a0 = s0;
+a1 = a3;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fb70;
+L41fb20:
+t5 = MEM_U32(a3 + 0);
+//nop;
+t6 = t5 + 0xffffffff;
+MEM_U32(a3 + 0) = t6;
+if ((int)t6 >= 0) goto L41fb50;
+//nop;
+a0 = s0;
+a1 = a3;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fb70;
+L41fb50:
+t8 = MEM_U32(a3 + 4);
+//nop;
+MEM_U8(t8 + 0) = (uint8_t)s0;
+t9 = MEM_U32(a3 + 4);
+//nop;
+t0 = t9 + 0x1;
+MEM_U32(a3 + 4) = t0;
+L41fb6c:
+// bdead 1 ra = MEM_U32(sp + 28);
+L41fb70:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_write_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L41fb7c:
+//write_string:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = a1;
+// fdead 400201eb MEM_U32(sp + 28) = ra;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+if (a3 != 0) goto L41fbe8;
+a0 = a1 + a2;
+v0 = a0;
+if (a1 == a0) goto L41fbe0;
+t7 = MEM_U8(a0 + -1);
+v1 = 0x20;
+//nop;
+if (v1 != t7) goto L41fbe0;
+L41fbc4:
+v0 = v0 + 0xffffffff;
+//nop;
+if (v0 == s0) goto L41fbe0;
+t8 = MEM_U8(v0 + -1);
+//nop;
+//nop;
+if (v1 == t8) goto L41fbc4;
+L41fbe0:
+a3 = v0 - s0;
+goto L41fc1c;
+L41fbe8:
+t9 = MEM_U32(sp + 40);
+//nop;
+a2 = a3 - t9;
+if (t9 >= a3) goto L41fc1c;
+//nop;
+a0 = MEM_U32(sp + 32);
+// bdead 400200a1 t9 = t9;
+a1 = 0x20;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+//nop;
+L41fc1c:
+a1 = s0;
+if ((int)a3 <= 0) goto L41fc40;
+//nop;
+a0 = MEM_U32(sp + 32);
+// bdead 40000161 t9 = t9;
+a2 = a3;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L41fc40:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void f_write_integer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L41fd60:
+//write_integer:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = a3 < 0x2;
+s0 = a3;
+// fdead 400201ef MEM_U32(sp + 28) = ra;
+// fdead 400201ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 88) = a0;
+MEM_U32(sp + 96) = a2;
+if (at == 0) goto L41fdb8;
+a0 = 0xfb528e4;
+a1 = 0x10002818;
+//nop;
+a2 = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41fea8;
+L41fdb8:
+t0 = sp + 0x34;
+if ((int)a1 >= 0) goto L41fdc8;
+v0 = -a1;
+goto L41fdcc;
+L41fdc8:
+v0 = a1;
+L41fdcc:
+v1 = 0x10000b00;
+a3 = sp + 0x55;
+v1 = v1;
+L41fdd8:
+lo = v0 / s0; hi = v0 % s0;
+a3 = a3 + 0xffffffff;
+//nop;
+if (s0 != 0) goto L41fdec;
+abort();
+L41fdec:
+t6 = hi;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+v0 = lo;
+MEM_U8(a3 + 0) = (uint8_t)t8;
+//nop;
+if (v0 != 0) goto L41fdd8;
+t9 = 0x2d;
+if ((int)a1 >= 0) goto L41fe18;
+a3 = a3 + 0xffffffff;
+MEM_U8(a3 + 0) = (uint8_t)t9;
+L41fe18:
+t1 = MEM_U32(sp + 96);
+s0 = t0 - a3;
+s0 = s0 + 0x21;
+a1 = 0x20;
+if ((int)s0 >= (int)t1) goto L41fe58;
+//nop;
+t2 = MEM_U32(sp + 96);
+a0 = MEM_U32(sp + 88);
+// bdead 40020961 t9 = t9;
+MEM_U32(sp + 48) = a3;
+a2 = t2 - s0;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+//nop;
+L41fe58:
+//nop;
+a0 = MEM_U32(sp + 88);
+// bdead 40020121 t9 = t9;
+a1 = a3;
+a2 = s0;
+func_41f4e4(mem, sp, a0, a1, a2);
+v0 = MEM_U32(sp + 96);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+v0 = -v0;
+a1 = 0x20;
+if ((int)s0 >= (int)v0) goto L41fea4;
+//nop;
+a0 = MEM_U32(sp + 88);
+// fdead 66002007f t9 = t9;
+a2 = v0 - s0;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L41fea4:
+// bdead 1 ra = MEM_U32(sp + 28);
+L41fea8:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void f_write_cardinal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L41feb4:
+//write_cardinal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 88) = a2;
+if (a3 != 0) goto L41ff04;
+a0 = 0xfb528e4;
+a1 = 0x10002848;
+//nop;
+a2 = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L41ffdc;
+L41ff04:
+v0 = 0x10000b00;
+s0 = sp + 0x50;
+v0 = v0;
+L41ff10:
+lo = a1 / a3; hi = a1 % a3;
+s0 = s0 + 0xffffffff;
+//nop;
+if (a3 != 0) goto L41ff24;
+abort();
+L41ff24:
+t6 = hi;
+t7 = v0 + t6;
+t8 = MEM_U8(t7 + 0);
+a1 = lo;
+MEM_U8(s0 + 0) = (uint8_t)t8;
+//nop;
+if (a1 != 0) goto L41ff10;
+t9 = sp + 0x30;
+t0 = MEM_U32(sp + 88);
+a3 = t9 - s0;
+a3 = a3 + 0x20;
+a1 = 0x20;
+if ((int)a3 >= (int)t0) goto L41ff84;
+//nop;
+t1 = MEM_U32(sp + 88);
+a0 = MEM_U32(sp + 80);
+// bdead 40020561 t9 = t9;
+MEM_U32(sp + 40) = a3;
+a2 = t1 - a3;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+//nop;
+L41ff84:
+//nop;
+a0 = MEM_U32(sp + 80);
+// bdead 40020121 t9 = t9;
+a1 = s0;
+a2 = a3;
+MEM_U32(sp + 40) = a3;
+func_41f4e4(mem, sp, a0, a1, a2);
+v0 = MEM_U32(sp + 88);
+a3 = MEM_U32(sp + 40);
+v0 = -v0;
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a1 = 0x20;
+if ((int)a3 >= (int)v0) goto L41ffd8;
+//nop;
+a0 = MEM_U32(sp + 80);
+// fdead 66002017f t9 = t9;
+a2 = v0 - a3;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+//nop;
+L41ffd8:
+// bdead 1 ra = MEM_U32(sp + 28);
+L41ffdc:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void f_write_real(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+int cf = 0;
+union FloatReg f4 = {{0, 0}}, f6 = {{0, 0}}, f8 = {{0, 0}}, f12 = {{0, 0}};
+L41ffe8:
+//write_real:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 92) = a1;
+a1 = a3;
+s0 = a0;
+// fdead 400201eb MEM_U32(sp + 36) = ra;
+// fdead 400201eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 96) = a2;
+if ((int)a3 > 0) goto L420624;
+v0 = a2 + 0xfffffffa;
+t6 = 0x2;
+if ((int)v0 < (int)0x3) goto L420030;
+MEM_U32(sp + 76) = v0;
+goto L420034;
+L420030:
+MEM_U32(sp + 76) = t6;
+L420034:
+f4.w[0] = MEM_U32(sp + 92);
+f6.w[1] = zero;
+f6.w[0] = zero;
+f12 = FloatReg_from_double(f4.f[0]);
+cf = double_from_FloatReg(f6) == double_from_FloatReg(f12);
+a2 = MEM_U32(sp + 76);
+a3 = sp + 0x54;
+if (cf == 0) goto L4200bc;
+//nop;
+a1 = 0x10002878;
+// fdead 260400281ef t9 = t9;
+a0 = s0;
+a2 = 0x3;
+a1 = a1;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 76);
+//nop;
+a0 = s0;
+// fdead 600200bf t9 = t9;
+a1 = 0x30;
+a2 = a2 + 0xffffffff;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+a0 = s0;
+//nop;
+a1 = 0x1000287c;
+// fdead 6002007f t9 = t9;
+a2 = 0x4;
+a1 = a1;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L420c58;
+L4200bc:
+//nop;
+t7 = sp + 0x50;
+MEM_U32(sp + 16) = t7;
+v0 = wrapper_ecvt(mem, double_from_FloatReg(f12), a2, a3, MEM_U32(sp + 16));
+MEM_U32(sp + 72) = v0;
+v1 = MEM_U8(v0 + 0);
+// bdead 40020011 gp = MEM_U32(sp + 32);
+at = 0x49;
+if (v1 == at) {
+at = 0x4e;
+goto L4200fc;}
+at = 0x4e;
+if (v1 == at) {
+at = 0x69;
+goto L4200fc;}
+at = 0x69;
+if (v1 == at) {
+at = 0x6e;
+goto L4200fc;}
+at = 0x6e;
+//nop;
+if (v1 != at) goto L420158;
+L4200fc:
+//nop;
+a0 = MEM_U32(sp + 72);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40020009 gp = MEM_U32(sp + 32);
+t8 = MEM_U32(sp + 96);
+//nop;
+MEM_U32(sp + 76) = v0;
+// fdead 6202000f t9 = t9;
+a0 = s0;
+a1 = 0x20;
+a2 = t8 - v0;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 72);
+//nop;
+a2 = MEM_U32(sp + 76);
+// fdead 600200df t9 = t9;
+a0 = s0;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L420c58;
+L420158:
+t1 = 0xfb51f00;
+t9 = MEM_U32(sp + 84);
+t1 = MEM_U32(t1 + 0);
+t0 = t9 + 0xffffffff;
+MEM_U32(sp + 84) = t0;
+if (t1 == 0) goto L4201a4;
+v1 = MEM_U32(sp + 80);
+a0 = 0x20;
+//nop;
+if (v1 == 0) goto L420188;
+a0 = 0x2d;
+goto L420188;
+L420188:
+//nop;
+a1 = s0;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420224;
+L4201a4:
+t2 = MEM_U32(s0 + 0);
+//nop;
+t3 = t2 + 0xffffffff;
+MEM_U32(s0 + 0) = t3;
+if ((int)t3 >= 0) goto L4201ec;
+v1 = MEM_U32(sp + 80);
+a0 = 0x20;
+//nop;
+if (v1 == 0) goto L4201d0;
+a0 = 0x2d;
+goto L4201d0;
+L4201d0:
+//nop;
+a1 = s0;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420224;
+L4201ec:
+v1 = MEM_U32(sp + 80);
+t5 = 0x2d;
+//nop;
+if (v1 == 0) goto L420208;
+t6 = MEM_U32(s0 + 4);
+MEM_U8(t6 + 0) = (uint8_t)t5;
+goto L420214;
+L420208:
+t8 = MEM_U32(s0 + 4);
+t7 = 0x20;
+MEM_U8(t8 + 0) = (uint8_t)t7;
+L420214:
+t9 = MEM_U32(s0 + 4);
+//nop;
+t0 = t9 + 0x1;
+MEM_U32(s0 + 4) = t0;
+L420224:
+t1 = 0xfb51f00;
+t2 = MEM_U32(sp + 72);
+t1 = MEM_U32(t1 + 0);
+a1 = s0;
+t3 = t2 + 0x1;
+if (t1 == 0) goto L420258;
+//nop;
+a0 = MEM_U8(t2 + 0);
+MEM_U32(sp + 72) = t3;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4202c4;
+L420258:
+t4 = MEM_U32(s0 + 0);
+a1 = s0;
+t5 = t4 + 0xffffffff;
+MEM_U32(s0 + 0) = t5;
+if ((int)t5 >= 0) goto L420290;
+t7 = MEM_U32(sp + 72);
+//nop;
+a0 = MEM_U8(t7 + 0);
+t8 = t7 + 0x1;
+MEM_U32(sp + 72) = t8;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4202c4;
+L420290:
+t9 = MEM_U32(sp + 72);
+t1 = MEM_U32(s0 + 4);
+t0 = MEM_U8(t9 + 0);
+//nop;
+MEM_U8(t1 + 0) = (uint8_t)t0;
+t2 = MEM_U32(s0 + 4);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(s0 + 4) = t3;
+t4 = MEM_U32(sp + 72);
+//nop;
+t5 = t4 + 0x1;
+MEM_U32(sp + 72) = t5;
+L4202c4:
+t6 = 0xfb51f00;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L4202f8;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420344;
+L4202f8:
+t7 = MEM_U32(s0 + 0);
+//nop;
+t8 = t7 + 0xffffffff;
+MEM_U32(s0 + 0) = t8;
+if ((int)t8 >= 0) goto L420328;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420344;
+L420328:
+t1 = MEM_U32(s0 + 4);
+t0 = 0x2e;
+MEM_U8(t1 + 0) = (uint8_t)t0;
+t2 = MEM_U32(s0 + 4);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(s0 + 4) = t3;
+L420344:
+//nop;
+a2 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 72);
+// bdead 400200c1 t9 = t9;
+a0 = s0;
+a2 = a2 + 0xffffffff;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+t4 = 0xfb51f00;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L42039c;
+//nop;
+a0 = 0x65;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4203e8;
+L42039c:
+t5 = MEM_U32(s0 + 0);
+//nop;
+t6 = t5 + 0xffffffff;
+MEM_U32(s0 + 0) = t6;
+if ((int)t6 >= 0) goto L4203cc;
+//nop;
+a0 = 0x65;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4203e8;
+L4203cc:
+t9 = MEM_U32(s0 + 4);
+t8 = 0x65;
+MEM_U8(t9 + 0) = (uint8_t)t8;
+t0 = MEM_U32(s0 + 4);
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(s0 + 4) = t1;
+L4203e8:
+t2 = 0xfb51f00;
+t3 = MEM_U32(sp + 84);
+t2 = MEM_U32(t2 + 0);
+//nop;
+//nop;
+if (t2 == 0) goto L420434;
+a0 = 0x2b;
+if ((int)t3 >= 0) goto L420418;
+t4 = -t3;
+MEM_U32(sp + 84) = t4;
+a0 = 0x2d;
+goto L420418;
+L420418:
+//nop;
+a1 = s0;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4204bc;
+L420434:
+t5 = MEM_U32(s0 + 0);
+//nop;
+t6 = t5 + 0xffffffff;
+MEM_U32(s0 + 0) = t6;
+if ((int)t6 >= 0) goto L420480;
+t8 = MEM_U32(sp + 84);
+a0 = 0x2b;
+t9 = -t8;
+if ((int)t8 >= 0) goto L420464;
+MEM_U32(sp + 84) = t9;
+a0 = 0x2d;
+goto L420464;
+L420464:
+//nop;
+a1 = s0;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4204bc;
+L420480:
+t0 = MEM_U32(sp + 84);
+t2 = 0x2d;
+t1 = -t0;
+if ((int)t0 >= 0) goto L4204a0;
+MEM_U32(sp + 84) = t1;
+t3 = MEM_U32(s0 + 4);
+MEM_U8(t3 + 0) = (uint8_t)t2;
+goto L4204ac;
+L4204a0:
+t5 = MEM_U32(s0 + 4);
+t4 = 0x2b;
+MEM_U8(t5 + 0) = (uint8_t)t4;
+L4204ac:
+t6 = MEM_U32(s0 + 4);
+//nop;
+t7 = t6 + 0x1;
+MEM_U32(s0 + 4) = t7;
+L4204bc:
+t8 = 0xfb51f00;
+a0 = MEM_U32(sp + 84);
+t8 = MEM_U32(t8 + 0);
+at = 0xa;
+//nop;
+if (t8 == 0) goto L420500;
+lo = (int)a0 / (int)at; hi = (int)a0 % (int)at;
+a1 = s0;
+t9 = lo;
+a0 = t9 + 0x30;
+//nop;
+//nop;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420570;
+L420500:
+t0 = MEM_U32(s0 + 0);
+//nop;
+t1 = t0 + 0xffffffff;
+MEM_U32(s0 + 0) = t1;
+if ((int)t1 >= 0) goto L420544;
+a0 = MEM_U32(sp + 84);
+at = 0xa;
+lo = (int)a0 / (int)at; hi = (int)a0 % (int)at;
+//nop;
+a1 = s0;
+t3 = lo;
+a0 = t3 + 0x30;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420570;
+L420544:
+t4 = MEM_U32(sp + 84);
+at = 0xa;
+lo = (int)t4 / (int)at; hi = (int)t4 % (int)at;
+t7 = MEM_U32(s0 + 4);
+t5 = lo;
+t6 = t5 + 0x30;
+MEM_U8(t7 + 0) = (uint8_t)t6;
+t8 = MEM_U32(s0 + 4);
+//nop;
+t9 = t8 + 0x1;
+MEM_U32(s0 + 4) = t9;
+L420570:
+t0 = 0xfb51f00;
+a0 = MEM_U32(sp + 84);
+t0 = MEM_U32(t0 + 0);
+at = 0xa;
+//nop;
+if (t0 == 0) goto L4205b0;
+lo = (int)a0 / (int)at; hi = (int)a0 % (int)at;
+//nop;
+a1 = s0;
+t1 = hi;
+a0 = t1 + 0x30;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L420c58;
+L4205b0:
+t2 = MEM_U32(s0 + 0);
+//nop;
+t3 = t2 + 0xffffffff;
+MEM_U32(s0 + 0) = t3;
+if ((int)t3 >= 0) goto L4205f4;
+a0 = MEM_U32(sp + 84);
+at = 0xa;
+lo = (int)a0 / (int)at; hi = (int)a0 % (int)at;
+//nop;
+a1 = s0;
+t5 = hi;
+a0 = t5 + 0x30;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L420c58;
+L4205f4:
+t6 = MEM_U32(sp + 84);
+at = 0xa;
+lo = (int)t6 / (int)at; hi = (int)t6 % (int)at;
+t9 = MEM_U32(s0 + 4);
+t7 = hi;
+t8 = t7 + 0x30;
+MEM_U8(t9 + 0) = (uint8_t)t8;
+t0 = MEM_U32(s0 + 4);
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(s0 + 4) = t1;
+goto L420c54;
+L420624:
+f8.w[0] = MEM_U32(sp + 92);
+//nop;
+t2 = sp + 0x50;
+MEM_U32(sp + 16) = t2;
+a2 = a1;
+a3 = sp + 0x54;
+MEM_U32(sp + 100) = a1;
+f12 = FloatReg_from_double(f8.f[0]);
+v0 = wrapper_fcvt(mem, double_from_FloatReg(f12), a2, a3, MEM_U32(sp + 16));
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 72) = v0;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+v1 = MEM_U32(sp + 80);
+t4 = MEM_U32(sp + 84);
+// bdead 4002201b gp = MEM_U32(sp + 32);
+t3 = zero < v1;
+MEM_U32(sp + 76) = v0;
+v1 = t3;
+if ((int)t4 > 0) goto L420920;
+t5 = MEM_U32(sp + 96);
+t7 = MEM_U32(sp + 100);
+t6 = t5 - t3;
+a2 = t6 - t7;
+a2 = a2 + 0xfffffffe;
+MEM_U32(sp + 80) = t3;
+if ((int)a2 <= 0) goto L4206b4;
+//nop;
+a0 = s0;
+// fdead 6003f0bb t9 = t9;
+a1 = 0x20;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+L4206b4:
+v1 = MEM_U32(sp + 80);
+//nop;
+//nop;
+if (v1 == 0) goto L420744;
+t8 = 0xfb51f00;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L4206f8;
+//nop;
+a0 = 0x2d;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420744;
+L4206f8:
+t9 = MEM_U32(s0 + 0);
+//nop;
+t0 = t9 + 0xffffffff;
+MEM_U32(s0 + 0) = t0;
+if ((int)t0 >= 0) goto L420728;
+//nop;
+a0 = 0x2d;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420744;
+L420728:
+t3 = MEM_U32(s0 + 4);
+t2 = 0x2d;
+MEM_U8(t3 + 0) = (uint8_t)t2;
+t4 = MEM_U32(s0 + 4);
+//nop;
+t5 = t4 + 0x1;
+MEM_U32(s0 + 4) = t5;
+L420744:
+t6 = 0xfb51f00;
+//nop;
+t6 = MEM_U32(t6 + 0);
+//nop;
+//nop;
+if (t6 == 0) goto L420778;
+//nop;
+a0 = 0x30;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4207c4;
+L420778:
+t7 = MEM_U32(s0 + 0);
+//nop;
+t8 = t7 + 0xffffffff;
+MEM_U32(s0 + 0) = t8;
+if ((int)t8 >= 0) goto L4207a8;
+//nop;
+a0 = 0x30;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L4207c4;
+L4207a8:
+t1 = MEM_U32(s0 + 4);
+t0 = 0x30;
+MEM_U8(t1 + 0) = (uint8_t)t0;
+t2 = MEM_U32(s0 + 4);
+//nop;
+t3 = t2 + 0x1;
+MEM_U32(s0 + 4) = t3;
+L4207c4:
+t4 = 0xfb51f00;
+//nop;
+t4 = MEM_U32(t4 + 0);
+//nop;
+//nop;
+if (t4 == 0) goto L4207f8;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t2 = MEM_U32(sp + 84);
+goto L420848;
+L4207f8:
+t5 = MEM_U32(s0 + 0);
+//nop;
+t6 = t5 + 0xffffffff;
+MEM_U32(s0 + 0) = t6;
+if ((int)t6 >= 0) goto L420828;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t2 = MEM_U32(sp + 84);
+goto L420848;
+L420828:
+t9 = MEM_U32(s0 + 4);
+t8 = 0x2e;
+MEM_U8(t9 + 0) = (uint8_t)t8;
+t0 = MEM_U32(s0 + 4);
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(s0 + 4) = t1;
+t2 = MEM_U32(sp + 84);
+L420848:
+a3 = MEM_U32(sp + 100);
+t3 = -t2;
+MEM_U32(sp + 84) = t3;
+if ((int)t3 >= (int)a3) goto L4208c0;
+//nop;
+a0 = s0;
+// bdead 40021021 t9 = t9;
+a1 = 0x30;
+a2 = t3;
+func_41f674(mem, sp, a0, a1, a2);
+t5 = MEM_U32(sp + 100);
+t6 = MEM_U32(sp + 84);
+t7 = MEM_U32(sp + 76);
+a3 = t5 - t6;
+// bdead 40030101 gp = MEM_U32(sp + 32);
+a0 = s0;
+if (a3 >= t7) goto L420898;
+MEM_U32(sp + 76) = a3;
+L420898:
+//nop;
+a1 = MEM_U32(sp + 72);
+a2 = MEM_U32(sp + 76);
+// fdead 6003c1ff t9 = t9;
+MEM_U32(sp + 64) = a3;
+func_41f4e4(mem, sp, a0, a1, a2);
+a3 = MEM_U32(sp + 64);
+t8 = MEM_U32(sp + 76);
+// bdead 42020101 gp = MEM_U32(sp + 32);
+a3 = a3 - t8;
+L4208c0:
+//nop;
+a0 = s0;
+// bdead 40020121 t9 = t9;
+a1 = 0x30;
+a2 = a3;
+func_41f674(mem, sp, a0, a1, a2);
+t9 = MEM_U32(sp + 96);
+v1 = MEM_U32(sp + 80);
+t2 = MEM_U32(sp + 100);
+t0 = -t9;
+t1 = t0 - v1;
+a2 = t1 - t2;
+// bdead 40020081 gp = MEM_U32(sp + 32);
+a2 = a2 + 0xfffffffe;
+// bdead 40020081 ra = MEM_U32(sp + 36);
+if ((int)a2 <= 0) goto L420c58;
+//nop;
+a0 = s0;
+// bdead 400000a1 t9 = t9;
+a1 = 0x20;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L420c58;
+L420920:
+t4 = MEM_U32(sp + 96);
+t5 = MEM_U32(sp + 84);
+t7 = MEM_U32(sp + 100);
+t3 = t4 - v1;
+t6 = t3 - t5;
+a2 = t6 - t7;
+a2 = a2 + 0xffffffff;
+MEM_U32(sp + 80) = v1;
+if ((int)a2 <= 0) goto L420960;
+//nop;
+a0 = s0;
+// fdead 6003f0bb t9 = t9;
+a1 = 0x20;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+L420960:
+v1 = MEM_U32(sp + 80);
+//nop;
+t6 = MEM_U32(sp + 84);
+if (v1 == 0) goto L4209f4;
+t8 = 0xfb51f00;
+//nop;
+t8 = MEM_U32(t8 + 0);
+//nop;
+//nop;
+if (t8 == 0) goto L4209a4;
+//nop;
+a0 = 0x2d;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 84);
+goto L4209f4;
+L4209a4:
+t9 = MEM_U32(s0 + 0);
+//nop;
+t0 = t9 + 0xffffffff;
+MEM_U32(s0 + 0) = t0;
+if ((int)t0 >= 0) goto L4209d4;
+//nop;
+a0 = 0x2d;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 84);
+goto L4209f4;
+L4209d4:
+t4 = MEM_U32(s0 + 4);
+t2 = 0x2d;
+MEM_U8(t4 + 0) = (uint8_t)t2;
+t3 = MEM_U32(s0 + 4);
+//nop;
+t5 = t3 + 0x1;
+MEM_U32(s0 + 4) = t5;
+t6 = MEM_U32(sp + 84);
+L4209f4:
+t7 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 72);
+a0 = s0;
+if ((int)t6 < (int)t7) goto L420aec;
+//nop;
+a1 = MEM_U32(sp + 72);
+// bdead 40030061 t9 = t9;
+a2 = t7;
+func_41f4e4(mem, sp, a0, a1, a2);
+t8 = MEM_U32(sp + 84);
+t9 = MEM_U32(sp + 76);
+// bdead 46020001 gp = MEM_U32(sp + 32);
+a2 = t8 - t9;
+//nop;
+a0 = s0;
+// bdead 400200a1 t9 = t9;
+a1 = 0x30;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+t0 = 0xfb51f00;
+//nop;
+t0 = MEM_U32(t0 + 0);
+//nop;
+//nop;
+if (t0 == 0) goto L420a7c;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420ac8;
+L420a7c:
+t1 = MEM_U32(s0 + 0);
+//nop;
+t2 = t1 + 0xffffffff;
+MEM_U32(s0 + 0) = t2;
+if ((int)t2 >= 0) goto L420aac;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+goto L420ac8;
+L420aac:
+t5 = MEM_U32(s0 + 4);
+t3 = 0x2e;
+MEM_U8(t5 + 0) = (uint8_t)t3;
+t6 = MEM_U32(s0 + 4);
+//nop;
+t7 = t6 + 0x1;
+MEM_U32(s0 + 4) = t7;
+L420ac8:
+//nop;
+a2 = MEM_U32(sp + 100);
+// fdead 6003de9f t9 = t9;
+a0 = s0;
+a1 = 0x30;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t5 = MEM_U32(sp + 96);
+goto L420c10;
+L420aec:
+//nop;
+a2 = MEM_U32(sp + 84);
+// bdead 400200c1 t9 = t9;
+a0 = s0;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(sp + 84);
+t4 = 0xfb51f00;
+t8 = MEM_U32(sp + 72);
+t1 = MEM_U32(sp + 76);
+t4 = MEM_U32(t4 + 0);
+t0 = t8 + t9;
+t2 = t1 - t9;
+MEM_U32(sp + 72) = t0;
+MEM_U32(sp + 76) = t2;
+if (t4 == 0) goto L420b48;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(sp + 76);
+goto L420b98;
+L420b48:
+t3 = MEM_U32(s0 + 0);
+//nop;
+t5 = t3 + 0xffffffff;
+MEM_U32(s0 + 0) = t5;
+if ((int)t5 >= 0) goto L420b78;
+//nop;
+a0 = 0x2e;
+a1 = s0;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(sp + 76);
+goto L420b98;
+L420b78:
+t8 = MEM_U32(s0 + 4);
+t7 = 0x2e;
+MEM_U8(t8 + 0) = (uint8_t)t7;
+t0 = MEM_U32(s0 + 4);
+//nop;
+t1 = t0 + 0x1;
+MEM_U32(s0 + 4) = t1;
+t9 = MEM_U32(sp + 76);
+L420b98:
+t2 = MEM_U32(sp + 100);
+a1 = MEM_U32(sp + 72);
+a0 = s0;
+if ((int)t9 < (int)t2) goto L420bcc;
+//nop;
+a1 = MEM_U32(sp + 72);
+// bdead 40020861 t9 = t9;
+a2 = t2;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t5 = MEM_U32(sp + 96);
+goto L420c10;
+L420bcc:
+//nop;
+a2 = MEM_U32(sp + 76);
+// bdead 400200c1 t9 = t9;
+a0 = s0;
+func_41f4e4(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+t4 = MEM_U32(sp + 100);
+//nop;
+t3 = MEM_U32(sp + 76);
+// fdead 6002301f t9 = t9;
+a0 = s0;
+a1 = 0x30;
+a2 = t4 - t3;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+//nop;
+t5 = MEM_U32(sp + 96);
+L420c10:
+v1 = MEM_U32(sp + 80);
+t8 = MEM_U32(sp + 84);
+t6 = -t5;
+t1 = MEM_U32(sp + 100);
+t7 = t6 - v1;
+t0 = t7 - t8;
+a2 = t0 - t1;
+a2 = a2 + 0xffffffff;
+// bdead 40020081 ra = MEM_U32(sp + 36);
+if ((int)a2 <= 0) goto L420c58;
+//nop;
+a0 = s0;
+// fdead 16203c6bf t9 = t9;
+a1 = 0x20;
+func_41f674(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+//nop;
+L420c54:
+// bdead 1 ra = MEM_U32(sp + 36);
+L420c58:
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static uint32_t f_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, t6 = 0;
+L421e84:
+//new:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_xmalloc(mem, sp, a0);
+t6 = MEM_U32(sp + 44);
+// bdead 4000800b gp = MEM_U32(sp + 24);
+a0 = v0;
+if (t6 == 0) goto L421ee0;
+a1 = zero;
+if (v0 == 0) goto L421ee0;
+//nop;
+a2 = MEM_U32(sp + 40);
+MEM_U32(sp + 36) = v0;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+//nop;
+L421ee0:
+// bdead 21 ra = MEM_U32(sp + 28);
+// bdead 21 sp = sp + 0x28;
+v0 = a0;
+return v0;
+}
+
+static void f_caseerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L421f28:
+//caseerror:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 48) = a0;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+a0 = a3 + 0x1;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 56);
+//nop;
+a2 = MEM_U32(sp + 60);
+a0 = v0;
+MEM_U32(sp + 44) = v0;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 44);
+t6 = MEM_U32(sp + 60);
+a0 = 0xfb528e4;
+t7 = v1 + t6;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+//nop;
+a1 = 0x10002910;
+a3 = MEM_U32(sp + 52);
+a2 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = v1;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0;
+L422068:
+//xrealloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a2 = 0x100054e4;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+v0 = f_alloc_resize(mem, sp, a0, a1, a2);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_xfree(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t a1 = 0;
+L42209c:
+//xfree:
+a1 = 0x100054e4;
+f_alloc_dispose(mem, sp, a0, a1);
+//nop;
+return;
+//nop;
+}
+
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4220b0:
+//alloc_dispose:
+t0 = MEM_U32(a1 + 0);
+a2 = a0 + 0xfffffff8;
+v0 = MEM_U32(t0 + 0);
+a3 = t0;
+//nop;
+if (v0 == 0) goto L4221e4;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L422138;
+//nop;
+if ((int)a2 < (int)a3) goto L4220fc;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t8 = v1;
+if ((int)v1 >= 0) goto L4220ec;
+t8 = -v1;
+L4220ec:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L422138;
+L4220fc:
+a3 = MEM_U32(a3 + 4);
+//nop;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L422138;
+//nop;
+if ((int)a2 < (int)a3) goto L4220fc;
+t6 = MEM_U32(a3 + 12);
+//nop;
+t7 = t6;
+if ((int)t6 >= 0) goto L422128;
+t7 = -t6;
+L422128:
+v0 = a3 + t7;
+//nop;
+if ((int)v0 < (int)a2) goto L4220fc;
+L422138:
+//nop;
+if (a3 != 0) goto L4221bc;
+a3 = t0;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L4221b4;
+//nop;
+if ((int)a2 < (int)a3) goto L422178;
+v1 = MEM_U32(a3 + 12);
+//nop;
+t8 = v1;
+if ((int)v1 >= 0) goto L422168;
+t8 = -v1;
+L422168:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L4221b4;
+L422178:
+a3 = MEM_U32(a3 + 0);
+//nop;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L4221b4;
+//nop;
+if ((int)a2 < (int)a3) goto L422178;
+t6 = MEM_U32(a3 + 12);
+//nop;
+t7 = t6;
+if ((int)t6 >= 0) goto L4221a4;
+t7 = -t6;
+L4221a4:
+v0 = a3 + t7;
+//nop;
+if ((int)v0 < (int)a2) goto L422178;
+L4221b4:
+//nop;
+if (a3 == 0) goto L422388;
+L4221bc:
+v1 = MEM_U32(a3 + 12);
+//nop;
+//nop;
+if ((int)v1 >= 0) goto L4221e4;
+L4221cc:
+a3 = MEM_U32(a3 + 0);
+//nop;
+t8 = MEM_U32(a3 + 12);
+//nop;
+//nop;
+if ((int)t8 < 0) goto L4221cc;
+L4221e4:
+a0 = MEM_U32(a2 + 4);
+t4 = 0xfffffffc;
+a1 = a0 & t4;
+t1 = a2 + a1;
+t0 = t1;
+t2 = MEM_U32(t0 + 4);
+t9 = a0 & 0x2;
+t3 = t2 & t4;
+if (t9 != 0) goto L4222d8;
+t1 = MEM_U32(a2 + 0);
+t6 = t2 & 0x1;
+a0 = t1;
+t4 = a2 - a0;
+if (t6 != 0) goto L422288;
+t7 = a0 + a1;
+a0 = t7 + t3;
+t2 = MEM_U32(a3 + 8);
+if ((int)a0 < (int)0x100) {
+at = (int)t1 < (int)0x100;
+goto L422250;}
+v0 = a0 + 0x2;
+if ((int)t1 >= (int)0x100) goto L422254;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L422250:
+v0 = a0 + 0x2;
+L422254:
+MEM_U32(t4 + 4) = v0;
+a1 = t4 + a0;
+MEM_U32(a1 + 0) = a0;
+if ((int)t3 < (int)0x100) goto L422388;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+//nop;
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L422388;
+MEM_U32(a3 + 8) = t5;
+goto L422388;
+L422288:
+a0 = a0 + a1;
+if ((int)a0 < (int)0x100) {
+at = (int)t1 < (int)0x100;
+goto L4222bc;}
+v1 = a0 + 0x2;
+if ((int)t1 >= (int)0x100) goto L4222c0;
+t2 = MEM_U32(a3 + 8);
+//nop;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L4222bc:
+v1 = a0 + 0x2;
+L4222c0:
+MEM_U32(t4 + 4) = v1;
+t8 = t3 + 0x1;
+MEM_U32(t0 + 4) = t8;
+t0 = t4 + a0;
+MEM_U32(t0 + 0) = a0;
+goto L422388;
+L4222d8:
+t9 = t2 & 0x1;
+at = (int)a1 < (int)0x100;
+if (t9 != 0) goto L422348;
+a1 = a1 + t3;
+t2 = MEM_U32(a3 + 8);
+t4 = a2 + a1;
+if ((int)a1 < (int)0x100) goto L422310;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+t4 = a2 + a1;
+L422310:
+MEM_U32(t4 + 0) = a1;
+t6 = a1 + 0x2;
+MEM_U32(a2 + 4) = t6;
+if ((int)t3 < (int)0x100) goto L422388;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+//nop;
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L422388;
+MEM_U32(a3 + 8) = t5;
+goto L422388;
+// fdead 0 at = (int)a1 < (int)0x100;
+L422348:
+t4 = t1;
+if (at != 0) goto L422370;
+t2 = MEM_U32(a3 + 8);
+//nop;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+t4 = t1;
+L422370:
+MEM_U32(t4 + 0) = a1;
+t7 = a1 + 0x2;
+MEM_U32(a2 + 4) = t7;
+v0 = t3 + 0x1;
+MEM_U32(t0 + 4) = v0;
+return;
+L422388:
+//nop;
+return;
+}
+
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L422390:
+//xmalloc:
+a1 = 0x100054e4;
+v0 = f_alloc_new(mem, sp, a0, a1);
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0;
+L4223ac:
+//alloc_new:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 32) = ra;
+L4223c0:
+// fdead 400001eb MEM_U32(sp + 28) = gp;
+t0 = MEM_U32(a1 + 0);
+a0 = a0 + 0xf;
+t5 = 0xfffffff8;
+if (t0 == 0) goto L4224dc;
+L4223d4:
+t1 = MEM_U32(t0 + 8);
+a0 = a0 & t5;
+t2 = MEM_U32(t1 + 4);
+//nop;
+if ((int)a0 >= (int)0x10) goto L4223f0;
+a0 = 0x10;
+L4223f0:
+if ((int)t2 >= (int)a0) {
+t2 = t2 & t5;
+goto L42241c;}
+t2 = t2 & t5;
+t3 = t1;
+L422400:
+t1 = MEM_U32(t1 + 12);
+//nop;
+t2 = MEM_U32(t1 + 4);
+t4 = (int)t2 < (int)a0;
+if (t1 == t3) goto L422498;
+if ((int)t2 < (int)a0) {
+t2 = t2 & t5;
+goto L422400;}
+t2 = t2 & t5;
+L42241c:
+t3 = t2 + 0xffffff00;
+if ((int)a0 >= (int)t3) {
+t3 = t1 + t2;
+goto L422460;}
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t3 + 0) = a0;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+t3 = t3 - a0;
+t4 = a0 | 0x1;
+MEM_U32(t3 + 4) = t4;
+t2 = t2 - a0;
+MEM_U32(t3 + 0) = t2;
+t2 = t2 | 0x2;
+MEM_U32(t1 + 4) = t2;
+v0 = t3 + 0x8;
+goto L422510;
+L422460:
+t3 = MEM_U32(t1 + 8);
+t4 = MEM_U32(t1 + 12);
+t5 = MEM_U32(t1 + 4);
+MEM_U32(t3 + 12) = t4;
+MEM_U32(t4 + 8) = t3;
+MEM_U32(t0 + 8) = t3;
+t5 = t5 | 0x1;
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t1 + 4) = t5;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+v0 = t1 + 0x8;
+goto L422510;
+L422498:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 36) = t0;
+//nop;
+//nop;
+a0 = a0 + 0xfffffffc;
+v0 = f_alloc_next_scb(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+t0 = MEM_U32(sp + 36);
+a0 = MEM_U32(sp + 40);
+if (v0 == 0) goto L4224d4;
+t1 = MEM_U32(t0 + 8);
+t5 = 0xfffffff8;
+t2 = MEM_U32(t1 + 4);
+t2 = t2 & t5;
+goto L42241c;
+L4224d4:
+//nop;
+goto L422510;
+L4224dc:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+//nop;
+//nop;
+a0 = a1;
+v0 = f_alloc_mark(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+t0 = MEM_U32(a1 + 0);
+if (v0 == 0) goto L4224d4;
+t5 = 0xfffffff8;
+goto L4223d4;
+L422510:
+// bdead 9 ra = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+//nop;
+//nop;
+}
+
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L422528:
+//alloc_page:
+//nop;
+//nop;
+//nop;
+a1 = 0x10000b40;
+sp = sp + 0xffffffd0;
+v0 = MEM_U32(a1 + 0);
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+if (v0 == 0) goto L422560;
+t6 = MEM_U32(v0 + 12);
+//nop;
+//nop;
+if ((int)t6 >= (int)a0) goto L4225c4;
+L422560:
+//nop;
+//nop;
+//nop;
+v0 = wrapper_sbrk(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+at = 0xffffffff;
+v1 = v0;
+if (v0 != at) goto L422588;
+v1 = zero;
+goto L4225d0;
+L422588:
+a1 = 0xfffff000;
+t7 = v0 & a1;
+t8 = v1 + 0xfff;
+if (v0 == t7) goto L4225d0;
+t9 = t8 & a1;
+a0 = t9 - v1;
+//nop;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = v1;
+v0 = wrapper_sbrk(mem, a0);
+v1 = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 32);
+// bdead 211 gp = MEM_U32(sp + 24);
+v1 = v1 + t0;
+goto L4225d0;
+L4225c4:
+t1 = MEM_U32(v0 + 4);
+v1 = v0;
+MEM_U32(a1 + 0) = t1;
+L4225d0:
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x30;
+v0 = v1;
+return v0;
+}
+
+static void f_alloc_free(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L4225e0:
+//alloc_free:
+//nop;
+//nop;
+//nop;
+v0 = 0x10000b40;
+t7 = MEM_U32(a0 + 12);
+t6 = MEM_U32(v0 + 0);
+MEM_U32(v0 + 0) = a0;
+t8 = t7;
+MEM_U32(a0 + 4) = t6;
+if ((int)t7 >= 0) goto L42260c;
+t8 = -t7;
+L42260c:
+MEM_U32(a0 + 12) = t8;
+return;
+}
+
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L422614:
+//alloc_scb:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a1;
+MEM_U32(sp + 36) = a1;
+v0 = f_alloc_page(mem, sp, a0);
+t6 = MEM_U32(sp + 32);
+// bdead 4000800b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+MEM_U32(t6 + 0) = v0;
+if (v0 == 0) goto L42269c;
+a0 = v0 + a2;
+a0 = a0 + 0xfffffff8;
+a1 = a0 - v0;
+t7 = -a2;
+t8 = a1 + 0xfffffff2;
+MEM_U32(v0 + 12) = t7;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 16) = zero;
+MEM_U32(v0 + 20) = t8;
+t9 = a1 + 0xfffffff0;
+t0 = 0x1;
+MEM_U32(a0 + 0) = t9;
+MEM_U32(a0 + 4) = t0;
+v1 = v0 + 0x10;
+MEM_U32(v0 + 24) = v1;
+MEM_U32(v0 + 28) = v1;
+MEM_U32(v0 + 8) = v1;
+L42269c:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4226ac:
+//alloc_mark:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 64) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x34;
+a1 = 0x10000;
+f_alloc_scb(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 52);
+// bdead 40000023 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 64);
+at = 0xfffffffc;
+if (a0 != 0) goto L4226f4;
+v0 = zero;
+goto L4227b0;
+L4226f4:
+t6 = MEM_U32(sp + 52);
+v1 = MEM_U32(t1 + 0);
+t0 = t6;
+t7 = MEM_U32(sp + 52);
+if (v1 == 0) goto L422738;
+v0 = MEM_U32(v1 + 4);
+a0 = t6;
+//nop;
+if (v0 == 0) goto L42272c;
+L422718:
+v1 = v0;
+v0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L422718;
+L42272c:
+MEM_U32(v1 + 4) = a0;
+MEM_U32(a0 + 0) = v1;
+t7 = MEM_U32(sp + 52);
+L422738:
+//nop;
+MEM_U32(t1 + 0) = t7;
+t8 = MEM_U32(sp + 52);
+//nop;
+t9 = MEM_U32(t8 + 12);
+//nop;
+t2 = t9;
+if ((int)t9 >= 0) goto L42275c;
+t2 = -t9;
+L42275c:
+MEM_U32(t8 + 12) = t2;
+t3 = MEM_U32(sp + 52);
+t7 = 0x2;
+v1 = MEM_U32(t3 + 8);
+v0 = t0;
+a3 = MEM_U32(v1 + 4);
+a0 = v1 + 0x10;
+t4 = a3 & at;
+a1 = v1 + t4;
+a2 = a1 - v1;
+t5 = a2 + 0xfffffff0;
+MEM_U32(v1 + 12) = a0;
+MEM_U32(v1 + 8) = a0;
+MEM_U32(v1 + 28) = v1;
+MEM_U32(v1 + 24) = v1;
+MEM_U32(a1 + 0) = t5;
+t9 = MEM_U32(sp + 52);
+t6 = a2 + 0xfffffff2;
+MEM_U32(v1 + 20) = t6;
+MEM_U32(v1 + 4) = t7;
+MEM_U32(t9 + 8) = a0;
+L4227b0:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x40;
+//nop;
+return v0;
+}
+
+static void f_alloc_release(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0;
+L4227c0:
+//alloc_release:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+v0 = MEM_U32(a0 + 0);
+s1 = a1;
+//nop;
+if (v0 == a1) goto L422810;
+//nop;
+if (v0 == 0) goto L422810;
+L4227f8:
+v0 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+if (v0 == a1) goto L422810;
+//nop;
+if (v0 != 0) goto L4227f8;
+L422810:
+// bdead 40063 ra = MEM_U32(sp + 36);
+if (v0 == 0) goto L422888;
+s0 = MEM_U32(a1 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L42282c;
+MEM_U32(s0 + 4) = zero;
+L42282c:
+//nop;
+if (s0 == 0) goto L422864;
+t6 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if ((int)t6 >= 0) goto L422864;
+L422844:
+s0 = MEM_U32(s0 + 0);
+//nop;
+//nop;
+if (s0 == 0) goto L422864;
+t7 = MEM_U32(s0 + 12);
+//nop;
+//nop;
+if ((int)t7 < 0) goto L422844;
+L422864:
+MEM_U32(a0 + 0) = s0;
+L422868:
+//nop;
+s0 = MEM_U32(s1 + 4);
+a0 = s1;
+f_alloc_free(mem, sp, a0);
+// bdead 20001 gp = MEM_U32(sp + 32);
+s1 = s0;
+if (s0 != 0) goto L422868;
+// bdead 1 ra = MEM_U32(sp + 36);
+L422888:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t8 = 0, t9 = 0;
+L422898:
+//alloc_next_scb:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+a2 = a0;
+at = 0x7fff0000;
+MEM_U32(sp + 60) = a1;
+at = at | 0xf000;
+t6 = a2 + 0x1017;
+a1 = t6 & at;
+at = 0x10000;
+at = (int)a1 < (int)at;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+a0 = sp + 0x2c;
+if (at == 0) goto L4228dc;
+a1 = 0x10000;
+L4228dc:
+//nop;
+//nop;
+//nop;
+f_alloc_scb(mem, sp, a0, a1);
+t8 = MEM_U32(sp + 44);
+// bdead 42000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 60);
+//nop;
+if (t8 != 0) goto L422908;
+v0 = zero;
+goto L42297c;
+L422908:
+v1 = MEM_U32(a1 + 0);
+t9 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 4);
+//nop;
+t0 = MEM_U32(sp + 44);
+if (v0 == 0) goto L422938;
+L422920:
+v1 = v0;
+v0 = MEM_U32(v0 + 4);
+//nop;
+//nop;
+if (v0 != 0) goto L422920;
+t0 = MEM_U32(sp + 44);
+L422938:
+MEM_U32(v1 + 4) = t9;
+MEM_U32(t0 + 0) = v1;
+v1 = MEM_U32(a1 + 0);
+t1 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 8);
+a0 = MEM_U32(t1 + 8);
+//nop;
+if (v0 == 0) goto L422974;
+t2 = MEM_U32(v0 + 8);
+MEM_U32(a0 + 12) = v0;
+MEM_U32(a0 + 8) = t2;
+t3 = MEM_U32(v0 + 8);
+//nop;
+MEM_U32(t3 + 12) = a0;
+MEM_U32(v0 + 8) = a0;
+L422974:
+MEM_U32(v1 + 8) = a0;
+v0 = 0x1;
+L42297c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0,
+t8 = 0, t9 = 0;
+L42298c:
+//alloc_resize:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+a3 = a0;
+if (a0 == 0) goto L422a64;
+t6 = MEM_U32(a0 + -4);
+s0 = a0 + 0xfffffff8;
+t7 = t6 & 0x1;
+at = 0xfffffffc;
+if (t7 != 0) goto L4229d4;
+v0 = zero;
+goto L422a84;
+L4229d4:
+a2 = MEM_U32(s0 + 4);
+t9 = MEM_U32(sp + 52);
+t8 = a2 & at;
+t0 = t9 + 0x4;
+a2 = t8;
+if ((int)t8 < (int)t0) goto L4229f8;
+v0 = a3;
+goto L422a84;
+L4229f8:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 48) = a3;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a3 = MEM_U32(sp + 48);
+s0 = v0;
+if (v0 != 0) goto L422a2c;
+v0 = zero;
+goto L422a84;
+L422a2c:
+//nop;
+a0 = s0;
+a1 = a3;
+MEM_U32(sp + 48) = a3;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+//nop;
+a1 = MEM_U32(sp + 56);
+//nop;
+f_alloc_dispose(mem, sp, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 24);
+v1 = s0;
+goto L422a80;
+L422a64:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = v0;
+L422a80:
+v0 = v1;
+L422a84:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+//nop;
+//nop;
+//nop;
+}
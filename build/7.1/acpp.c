@@ -0,0 +1,18090 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,0x64650000,0x2f757372,0x2f696e63,0x6c756465,
+0x0,0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,0x64650000,0x2f757372,0x2f6c6f63,
+0x616c2f69,0x6e636c75,0x64652f43,0x43000000,0x2f757372,0x2f6c6f63,0x616c2f69,0x6e636c75,
+0x64650000,0x2f757372,0x2f696e63,0x6c756465,0x0,0x2d446d69,0x7073202d,0x44756e69,
+0x78000000,0x64656669,0x6e650000,0x69660000,0x69666465,0x66000000,0x69666e64,0x65660000,
+0x656e6469,0x66000000,0x656c7365,0x0,0x656c6966,0x0,0x6c696e65,0x0,
+0x696e636c,0x75646500,0x756e6465,0x66000000,0x6572726f,0x72000000,0x73636373,0x0,
+0x6964656e,0x74000000,0x70726167,0x6d610000,0x0,0x6f757470,0x75742070,0x69706520,
+0x68617320,0x6265656e,0x20636c6f,0x73656400,0x2e6f0000,0x55736167,0x653a2025,0x73205b73,
+0x77697463,0x6865735d,0x20696e70,0x7574206f,0x75747075,0x740a0000,0x4f757470,0x75742066,
+0x696c656e,0x616d6520,0x73706563,0x69666965,0x64207477,0x6963650a,0x0,0x2d000000,
+0x0,0x2d747261,0x64697469,0x6f6e616c,0x0,0x2d747269,0x67726170,0x68730000,
+0x2d577472,0x69677261,0x70687300,0x2d57636f,0x6d6d656e,0x74730000,0x2d57636f,0x6d6d656e,
+0x74000000,0x2d57616c,0x6c000000,0x74617267,0x65740000,0x75706461,0x74650000,0x2573206f,
+0x7074696f,0x6e207265,0x71756972,0x65732061,0x6e206172,0x67756d65,0x6e740000,0x2d4d0000,
+0x2d4d4d00,0x474e5520,0x43505020,0x76657273,0x696f6e20,0x25730a00,0x2d000000,0x2d73686f,
+0x77646566,0x696e6573,0x0,0x2d6e6f73,0x706c6963,0x65000000,0x0,0x0,
+0x496e7661,0x6c696420,0x6f707469,0x6f6e2060,0x2573270a,0x0,0x0,0x53554e50,
+0x524f5f44,0x4550454e,0x44454e43,0x49455300,0x44455045,0x4e44454e,0x43494553,0x5f4f5554,
+0x50555400,0x44455045,0x4e44454e,0x43494553,0x5f4f5554,0x50555400,0x53554e50,0x524f5f44,
+0x4550454e,0x44454e43,0x49455300,0x61000000,0x3a000000,0x2d3a2000,0x3a200000,0x20000000,
+0x4e6f2069,0x6e707574,0x2066696c,0x656e616d,0x65207370,0x65636966,0x69656420,0x77697468,
+0x202d4d44,0x75706461,0x7465206f,0x7074696f,0x6e000000,0x63707000,0x0,0x7374646f,
+0x75740000,0x77000000,0x492f4f20,0x6572726f,0x72206f6e,0x206f7574,0x70757400,0x492f4f20,
+0x6572726f,0x72206f6e,0x206f7574,0x70757400,0x492f4f20,0x6572726f,0x72206f6e,0x206f7574,
+0x70757400,0x23257320,0x25732023,0x6c696e65,0x20256420,0x25730a00,0x25642074,0x72696772,
+0x61706828,0x73292065,0x6e636f75,0x6e746572,0x65640000,0x756e7465,0x726d696e,0x61746564,
+0x20737472,0x696e6720,0x6f722063,0x68617261,0x63746572,0x20636f6e,0x7374616e,0x74000000,
+0x756e7465,0x726d696e,0x61746564,0x20737472,0x696e6720,0x6f722063,0x68617261,0x63746572,
+0x20636f6e,0x7374616e,0x74000000,0x602f2a27,0x20776974,0x68696e20,0x636f6d6d,0x656e7400,
+0x756e7465,0x726d696e,0x61746564,0x20636f6d,0x6d656e74,0x0,0x69660000,0x69666465,
+0x66000000,0x69666e64,0x65660000,0x656c7365,0x0,0x656c6966,0x0,0x756e7465,
+0x726d696e,0x61746564,0x20232573,0x20636f6e,0x64697469,0x6f6e616c,0x0,0x6d616372,
+0x6f206f72,0x2023696e,0x636c7564,0x65207265,0x63757273,0x696f6e20,0x746f6f20,0x64656570,
+0x0,0x4e6f7420,0x61206c65,0x67616c20,0x70726570,0x726f6365,0x7373696e,0x67206469,
+0x72656374,0x6976653b,0x20696e61,0x7070726f,0x70726961,0x7465206e,0x6f6e2d77,0x68697465,
+0x73706163,0x65206368,0x61726163,0x74657273,0x20617265,0x20707265,0x73656e74,0x2028414e,
+0x53492033,0x2e382900,0x4a616e00,0x46656200,0x4d617200,0x41707200,0x4d617900,0x4a756e00,
+0x4a756c00,0x41756700,0x53657000,0x4f637400,0x4e6f7600,0x44656300,0x63636370,0x20657272,
+0x6f723a20,0x6e6f7420,0x696e2061,0x6e792066,0x696c653f,0x21000000,0x22257322,0x0,
+0x22220000,0x25640000,0x22257322,0x0,0x25640000,0x25640000,0x22257320,0x25326420,
+0x25346422,0x0,0x22253032,0x643a2530,0x32643a25,0x30326422,0x0,0x20302000,
+0x20312000,0x60646566,0x696e6564,0x27206d75,0x73742062,0x6520666f,0x6c6c6f77,0x65642062,
+0x79206964,0x656e7420,0x6f722028,0x6964656e,0x74290000,0x63636370,0x20657272,0x6f723a20,
+0x696e7661,0x6c696420,0x73706563,0x69616c20,0x68617368,0x20747970,0x65000000,0x23696e63,
+0x6c756465,0x20657870,0x65637473,0x2022666e,0x616d6522,0x206f7220,0x3c666e61,0x6d653e00,
+0x2f000000,0x6e6f6e65,0x78697374,0x656e7420,0x66696c65,0x203c252e,0x2a733e20,0x6f6d6974,
+0x74656420,0x66726f6d,0x20646570,0x656e6465,0x6e637920,0x6f757470,0x75740000,0xa000000,
+0x20000000,0xa000000,0x20000000,0x6d616372,0x6f206f72,0x2023696e,0x636c7564,0x65207265,
+0x63757273,0x696f6e20,0x746f6f20,0x64656570,0x0,0x23646566,0x696e6520,0x68617320,
+0x6e6f2069,0x64656e74,0x69666965,0x7220286e,0x6f206d61,0x63726f20,0x6e616d65,0x20697320,
+0x70726573,0x656e7429,0x0,0x6d616372,0x6f206e61,0x6d652069,0x6e202364,0x6566696e,
+0x65207374,0x61727473,0x20776974,0x6820616e,0x20696e61,0x7070726f,0x70726961,0x74652063,
+0x68617261,0x63746572,0x0,0x64656669,0x6e650000,0x70617261,0x6d657465,0x72206e61,
+0x6d652073,0x74617274,0x73207769,0x74682061,0x20646967,0x69742069,0x6e202364,0x6566696e,
+0x65000000,0x6261646c,0x79207075,0x6e637475,0x61746564,0x20706172,0x616d6574,0x6572206c,
+0x69737420,0x696e2023,0x64656669,0x6e650000,0x756e7465,0x726d696e,0x61746564,0x20706172,
+0x616d6574,0x6572206c,0x69737420,0x696e2023,0x64656669,0x6e650000,0x6475706c,0x69636174,
+0x65206d61,0x63726f20,0x70617261,0x6d657465,0x72202825,0x73292069,0x7320696c,0x6c656761,
+0x6c202841,0x4e534920,0x332e382e,0x33290000,0x0,0x20726564,0x6566696e,0x65640000,
+0x41202323,0x20707265,0x70726f63,0x65737369,0x6e672074,0x6f6b656e,0x206d7573,0x74206e6f,
+0x74206265,0x20617420,0x74686520,0x62656769,0x6e6e696e,0x67206f66,0x20612072,0x65706c61,
+0x63656d65,0x6e74206c,0x69737420,0x28414e53,0x4920332e,0x382e332e,0x33290000,0x23206f70,
+0x65726174,0x6f722073,0x686f756c,0x64206265,0x20666f6c,0x6c6f7765,0x64206279,0x2061206d,
+0x6163726f,0x20617267,0x756d656e,0x74206e61,0x6d650a00,0x23206f70,0x65726174,0x6f722073,
+0x686f756c,0x64206265,0x20666f6c,0x6c6f7765,0x64206279,0x2061206d,0x6163726f,0x20617267,
+0x756d656e,0x74206e61,0x6d650a00,0x41202323,0x20707265,0x70726f63,0x65737369,0x6e672074,
+0x6f6b656e,0x206d7573,0x74206e6f,0x74206265,0x20617420,0x74686520,0x656e6420,0x6f662061,
+0x20726570,0x6c616365,0x6d656e74,0x206c6973,0x74202841,0x4e534920,0x332e382e,0x332e3329,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x696e7661,0x6c696420,0x666f726d,0x61742023,0x6c696e65,0x20636f6d,0x6d616e64,
+0x0,0x23756e64,0x65662068,0x6173206e,0x6f206964,0x656e7469,0x66696572,0x20286e6f,
+0x206d6163,0x726f206e,0x616d6520,0x69732070,0x72657365,0x6e742900,0x6d616372,0x6f206e61,
+0x6d652069,0x6e202375,0x6e646566,0x20737461,0x72747320,0x77697468,0x20616e20,0x696e6170,
+0x70726f70,0x72696174,0x65206368,0x61726163,0x74657200,0x756e6465,0x66696e69,0x6e672060,
+0x25732700,0x756e6465,0x66000000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x756e6465,
+0x66206964,0x656e7469,0x66696572,0x20207669,0x6f6c6174,0x65732041,0x4e534920,0x7374616e,
+0x64617264,0x0,0x23657272,0x6f722025,0x73000000,0x6f6e6365,0x0,0x414e5349,
+0x20432064,0x6f657320,0x6e6f7420,0x616c6c6f,0x77202369,0x64656e74,0x3b202369,0x64656e74,
+0x2069676e,0x6f726564,0x20000000,0x414e5349,0x20432064,0x6f657320,0x6e6f7420,0x616c6c6f,
+0x77202373,0x63637300,0x23656c69,0x66206e6f,0x74207769,0x7468696e,0x20612063,0x6f6e6469,
+0x74696f6e,0x616c0000,0x23656c69,0x66206166,0x74657220,0x23656c73,0x65000000,0x20286d61,
+0x74636865,0x73206c69,0x6e652025,0x64000000,0x2c206669,0x6c652025,0x73000000,0x290a0000,
+0x64656669,0x6e656400,0x23257320,0x77697468,0x206e6f20,0x61726775,0x6d656e74,0x0,
+0x23257320,0x61726775,0x6d656e74,0x20737461,0x72747320,0x77697468,0x2070756e,0x63747561,
+0x74696f6e,0x0,0x23257320,0x61726775,0x6d656e74,0x20737461,0x72747320,0x77697468,
+0x20612064,0x69676974,0x0,0x67617262,0x61676520,0x61742065,0x6e64206f,0x66202325,
+0x73206172,0x67756d65,0x6e740000,0x23257320,0x6e6f7420,0x77697468,0x696e2061,0x20636f6e,
+0x64697469,0x6f6e616c,0x0,0x23656c73,0x65206f72,0x2023656c,0x69662061,0x66746572,
+0x2023656c,0x73650000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x656c7365,0x2076696f,
+0x6c617465,0x7320414e,0x53492073,0x74616e64,0x61726400,0x23656c73,0x65206e6f,0x74207769,
+0x7468696e,0x20612063,0x6f6e6469,0x74696f6e,0x616c0000,0x23656c73,0x65206166,0x74657220,
+0x23656c73,0x65000000,0x20286d61,0x74636865,0x73206c69,0x6e652025,0x64000000,0x2c206669,
+0x6c652025,0x73000000,0x290a0000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,0x656e6469,
+0x66207669,0x6f6c6174,0x65732041,0x4e534920,0x7374616e,0x64617264,0x0,0x756e6261,
+0x6c616e63,0x65642023,0x656e6469,0x66000000,0x74657874,0x20666f6c,0x6c6f7769,0x6e672023,
+0x656c7365,0x206f7220,0x23656e64,0x69662076,0x696f6c61,0x74657320,0x414e5349,0x20737461,
+0x6e646172,0x64000000,0x756e7465,0x726d696e,0x61746564,0x20737472,0x696e6720,0x6f722063,
+0x68617261,0x63746572,0x20636f6e,0x7374616e,0x74000000,0x23202564,0x20222573,0x22000000,
+0x6d616372,0x6f206f72,0x2023696e,0x636c7564,0x65207265,0x63757273,0x696f6e20,0x746f6f20,
+0x64656570,0x0,0x0,0x61726775,0x6d656e74,0x73206769,0x76656e20,0x746f206d,
+0x6163726f,0x20602573,0x27000000,0x6f6e6c79,0x20256420,0x61726773,0x20746f20,0x6d616372,
+0x6f206025,0x73270000,0x746f6f20,0x6d616e79,0x20282564,0x29206172,0x67732074,0x6f206d61,
+0x63726f20,0x60257327,0x0,0x5c253033,0x6f000000,0x756e7465,0x726d696e,0x61746564,
+0x206d6163,0x726f2063,0x616c6c00,0x25733a25,0x643a2000,0xa000000,0x25733a25,0x643a2000,
+0x25733a20,0x546f6f20,0x6d616e79,0x206f7065,0x6e206669,0x6c657320,0x28256c64,0x2066696c,
+0x65732069,0x7320746f,0x6f206d61,0x6e792e20,0x20446f65,0x7320736f,0x6d652023,0x696e636c,
+0x75646520,0x696e636c,0x75646520,0x69747365,0x6c662028,0x64697265,0x63746c79,0x206f7220,
+0x696e6469,0x72656374,0x6c79293f,0x290a0000,0x25733a20,0x25730a00,0x25733a20,0x756e646f,
+0x63756d65,0x6e746564,0x20492f4f,0x20657272,0x6f720a00,0x25733a25,0x643a2000,0x7761726e,
+0x696e673a,0x20000000,0xa000000,0x25733a25,0x643a2000,0xa000000,0x23646566,0x696e6520,
+0x25730000,0x28000000,0x2c200000,0x29000000,0x20000000,0x20230000,0x20232320,0x0,
+0x20232320,0x0,0xa000000,0x5f5f4c49,0x4e455f5f,0x0,0x5f5f4441,0x54455f5f,
+0x0,0x5f5f4649,0x4c455f5f,0x0,0x5f5f4241,0x53455f46,0x494c455f,0x5f000000,
+0x5f5f494e,0x434c5544,0x455f4c45,0x56454c5f,0x5f000000,0x5f5f5645,0x5253494f,0x4e5f5f00,
+0x5f5f5449,0x4d455f5f,0x0,0x5f5f414e,0x53495f43,0x50505f5f,0x0,0x20310000,
+0x2a496e69,0x7469616c,0x697a6174,0x696f6e2a,0x0,0x2a756e64,0x65662a00,0x25733a20,
+0x0,0xa000000,0x25733a20,0x0,0x25733a20,0x25730a00,0x25733a20,0x756e646f,
+0x63756d65,0x6e746564,0x20492f4f,0x20657272,0x6f720a00,0x4d656d6f,0x72792065,0x78686175,
+0x73746564,0x2e000000,0xf03f7f78,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,
+0xf03f817c,0xf03f7cd4,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,
+0xf03f7cd4,0xf03f7f60,0xf03f7ed8,0xf03f8194,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f7f84,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f7d7c,0xf03f817c,0xf03f817c,0xf03f7f6c,0xf03f817c,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f7f30,0xf03f817c,0xf03f7ce0,0xf03f817c,0xf03f817c,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,
+0xf03f817c,0xf03f817c,0xf03f7e9c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f7be8,
+0xf03f817c,0xf03f817c,0xf03f817c,0xf03f817c,0xf03f8118,0xf03f7c18,0xf03f7c68,0xf03f817c,
+0xf03f817c,0xf03f80e0,0xf03f7c7c,0xf03f8148,0xf03f7eb0,0xf03f80d4,0xf03f9028,0xf03f908c,
+0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,0xf03f9018,0xf03f9000,0xf03f9010,0xf03f908c,
+0xf03f908c,0xf03f908c,0xf03f9038,0xf03f908c,0xf03f9008,0xf03f908c,0xf03f908c,0xf03f908c,
+0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,0xf03f908c,
+0xf03f908c,0xf03f9020,0xf03f8ff8,0xf03f9030,0xf03f9040,0xf03fa108,0xf03fa280,0xf03fa280,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03f9f60,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03f9878,
+0xf03f9558,0xf03f9e70,0xf03fa280,0xf03fa280,0xf03f9878,0xf03fa280,0xf03fa280,0xf03fa280,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03f9b20,0xf03f9e88,0xf03f9e88,0xf03f9e88,
+0xf03f9e88,0xf03f9e88,0xf03f9e88,0xf03f9e88,0xf03f9e88,0xf03f9e88,0xf03f9e88,0xf03fa280,
+0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03fa280,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03fa280,0xf03f9500,0xf03fa280,0xf03fa280,0xf03f9f48,0xf03fa280,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,0xf03f9f48,
+0xf03fa774,0xf03fa784,0xf03fa764,0xf03fa794,0xf03fa7b0,0xf03fa7a4,0xf03faebc,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03fad5c,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03fad5c,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03fae04,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,
+0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,0xf03faecc,
+0xf03fadc4,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,
+0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,
+0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,
+0xf03fb1f8,0xf03fb0d0,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb0d0,0xf03fb1f8,
+0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb178,0xf03fb1f8,
+0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,
+0xf03fb1f8,0xf03fb1f8,0xf03fb1f8,0xf03faf7c,0xf03fb654,0xf03fb694,0xf03fb4c8,0xf03fb4c8,
+0xf03fb54c,0xf03fb5c8,0xf03fb694,0xf03fb618,0xf03fb908,0xf03fb908,0xf03fb784,0xf03feaa0,
+0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,
+0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,
+0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03fea30,
+0xf03feab8,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03fea30,0xf03feeb0,0xf03feeb0,0xf03feeb0,
+0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03fe9b8,0xf03fed58,0xf03fed58,0xf03fed58,
+0xf03feda8,0xf03feeb0,0xf03fede0,0xf03feeb0,0xf03feeb0,0xf03feeb0,0xf03feda8,0xf0400cd8,
+0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,
+0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,
+0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400e34,
+0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400f0c,0xf0400e34,0xf0400c88,0xf0400c9c,0xf0400f0c,
+0xf0400f0c,0xf0400ef4,0xf0400f0c,0xf0400f0c,0xf0400ce8,0x0,0x0,0x0,
+0x312e3335,0x2e393578,0x0,0x0,0x666c6f61,0x74696e67,0x20706f69,0x6e74206e,
+0x756d6265,0x7273206e,0x6f742061,0x6c6c6f77,0x65642069,0x6e202369,0x66206578,0x70726573,
+0x73696f6e,0x73000000,0x30780000,0x30580000,0x496e7661,0x6c696420,0x6e756d62,0x65722069,
+0x6e202369,0x66206578,0x70726573,0x73696f6e,0x0,0x26260000,0x7c7c0000,0x3c3c0000,
+0x3e3e0000,0x3d3d0000,0x213d0000,0x3c3d0000,0x3e3d0000,0x5f5f4348,0x41525f55,0x4e534947,
+0x4e45445f,0x5f000000,0x496e7661,0x6c696420,0x63686172,0x61637465,0x7220636f,0x6e737461,
+0x6e742069,0x6e202369,0x66000000,0x646f7562,0x6c652071,0x756f7465,0x64207374,0x72696e67,
+0x73206e6f,0x7420616c,0x6c6f7765,0x6420696e,0x20236966,0x20657870,0x72657373,0x696f6e73,
+0x0,0x496e7661,0x6c696420,0x746f6b65,0x6e20696e,0x20657870,0x72657373,0x696f6e00,
+0x6f637461,0x6c206368,0x61726163,0x74657220,0x636f6e73,0x74616e74,0x20646f65,0x73206e6f,
+0x74206669,0x7420696e,0x20612062,0x79746500,0x68657820,0x63686172,0x61637465,0x7220636f,
+0x6e737461,0x6e742064,0x6f657320,0x6e6f7420,0x66697420,0x696e2061,0x20627974,0x65000000,
+0x656d7074,0x79202369,0x66206578,0x70726573,0x73696f6e,0x0,0x4a756e6b,0x20616674,
+0x65722065,0x6e64206f,0x66206578,0x70726573,0x73696f6e,0x2e000000,0x75786c69,0x62633a38,
+0x30000000,0x59616363,0x20737461,0x636b206f,0x76657266,0x6c6f7700,0x75786c69,0x62633a38,
+0x31000000,0x53796e74,0x61782065,0x72726f72,0x0,0x64697669,0x73696f6e,0x20627920,
+0x7a65726f,0x20696e20,0x23696600,0x64697669,0x73696f6e,0x20627920,0x7a65726f,0x20696e20,
+0x23696600,0xf0402f2c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf0402f34,0xf0402f34,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf0402f34,0xf0403070,0xf0403080,0xf040309c,0xf040309c,0xf0403070,0xf0403070,
+0xf0402fa0,0xf0403070,0xf0403070,0xf0403070,0xf0403070,0xf0403070,0xf0403070,0xf0403070,
+0xf0403070,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf0403070,0xf040309c,0xf0403070,0xf0403070,0xf0403070,
+0xf0403070,0xf0403070,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf0402f48,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf040309c,
+0xf040309c,0xf040309c,0xf040309c,0xf040309c,0xf0403070,0xf040309c,0xf0403070,0xf0403070,
+0xf04032a4,0xf040343c,0xf040343c,0xf0403248,0xf0403250,0xf040343c,0xf040343c,0xf0403258,
+0xf0403260,0xf040343c,0xf040343c,0xf040343c,0xf040343c,0xf040343c,0xf040343c,0xf040343c,
+0xf0403268,0xf040343c,0xf040343c,0xf040343c,0xf0403270,0xf040343c,0xf0403278,0xf040343c,
+0xf0403280,0xf040343c,0xf0403388,0xf04032f8,0xf04032f8,0xf04032f8,0xf04032f8,0xf04032f8,
+0xf04032f8,0xf04032f8,0xf04032f8,0xf0403cd0,0xf0404398,0xf0403ce0,0xf0403cf8,0xf0403d18,
+0xf0403d34,0xf0403d54,0xf0403d6c,0xf0403ddc,0xf0403ea0,0xf0403f64,0xf0403f9c,0xf0403fd4,
+0xf0404020,0xf040406c,0xf0404090,0xf04040b4,0xf040410c,0xf0404164,0xf04041b4,0xf0404204,
+0xf040423c,0xf0404274,0xf04042ac,0xf04042d8,0xf0404304,0xf0404350,0xf040436c,0xf0404388,
+0x53747269,0x6e672074,0x61626c65,0x206f7665,0x72666c6f,0x7720696e,0x204d4475,0x70646174,
+0x650a0000,0x63616e27,0x74207265,0x616c6c6f,0x63617465,0x206d656d,0x6f727920,0x666f7220,
+0x25732075,0x70646174,0x65000000,0x63616e27,0x7420616c,0x6c6f6361,0x7465206d,0x656d6f72,
+0x7920666f,0x72202573,0x20757064,0x61746500,0x25733a20,0x25730000,0x25733a20,0x25730000,
+0x25733a20,0x25730000,0x233a252e,0x34730000,0x25733a20,0x25730000,0x25733a20,0x6572726f,
+0x72206475,0x72696e67,0x20757064,0x61746520,0x2d2d2066,0x696c6520,0x25732069,0x7320636f,
+0x72727570,0x74656420,0x2d2d2075,0x6e657870,0x65637465,0x64206e75,0x6c6c2061,0x74206f66,
+0x66736574,0x2025642e,0xa000000,0x25733a20,0x25730000,0x61000000,0x63616e27,0x74206f70,
+0x656e2025,0x7320746f,0x20617070,0x656e6420,0x25732773,0x20646570,0x656e6465,0x6e636965,
+0x73000000,0x25733a00,0x25733a20,0x25730000,0x20257300,0x2025730a,0x0,0x25733a20,
+0x25730000,0x25733a20,0x25730000,0x25733a20,0x25730000,0x0,0x0,0x0,
+0x40282329,0x24486561,0x6465723a,0x20495249,0x5820362e,0x343a3132,0x36333337,0x30353333,
+0x20627569,0x6c742031,0x312f3132,0x2f393620,0x61742073,0x6c617965,0x723a2f73,0x6c617965,
+0x725f786c,0x76302f66,0x69637573,0x73672d6e,0x6f763035,0x2f726f6f,0x74202400,0x0,
+};
+static const uint32_t data[] = {
+0x40282329,0x616c6c6f,0x63612e63,0x9312e31,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xffffffff,0x0,0x10002d00,0x10001000,
+0x10002d08,0x10001014,0x0,0x10001024,0x10002d18,0x10001038,0x10002d20,0x10001050,
+0x0,0x10001064,0x0,0x0,0x0,0x0,0x0,0x10001074,
+0x6,0x407d78,0x10001084,0x1,0x10000,0x2,0x409ac8,0x1000108c,
+0x5,0x0,0x5,0x409e00,0x10001090,0x3,0x0,0x6,
+0x409e00,0x10001098,0x4,0x0,0x5,0x40a95c,0x100010a0,0xc,
+0x0,0x4,0x40a728,0x100010a8,0x6,0x0,0x4,0x409b48,
+0x100010b0,0x8,0x0,0x4,0x409168,0x100010b8,0xa,0x0,
+0x7,0x4071f4,0x100010c0,0x2,0x1000000,0x5,0x4095a8,0x100010c8,
+0x9,0x0,0x5,0x4097f0,0x100010d0,0xb,0x0,0x4,
+0x409a7c,0x100010d8,0xd,0x0,0x5,0x409a1c,0x100010e0,0xe,
+0x0,0x6,0x40998c,0x100010e8,0x7,0x100,0xffffffff,0x0,
+0x100010f0,0x1a,0x0,0x0,0x0,0x0,0x100014a8,0x100014ac,
+0x100014b0,0x100014b4,0x100014b8,0x100014bc,0x100014c0,0x100014c4,0x100014c8,0x100014cc,
+0x100014d0,0x100014d4,0x0,0x0,0x10002660,0x0,0x0,0x0,
+0x100041c8,0x10004420,0x96,0x100026d4,0x106,0x100026d8,0x105,0x100026dc,
+0x10b,0x100026e0,0x10c,0x100026e4,0x107,0x100026e8,0x108,0x100026ec,
+0x109,0x100026f0,0x10a,0x0,0x104,0xffffffff,0x1,0x0,
+0xffffffff,0xfffffffe,0x0,0xe,0x19,0xb,0x2,0xe,
+0xc,0xf,0x1,0x10,0xc,0xd,0x22,0xe,
+0x19,0xd,0x0,0x0,0xc,0xf,0x0,0x10,
+0x38,0xd,0x17,0xe,0x18,0x1e,0x0,0x0,
+0xc,0xf,0x0,0x10,0x37,0xd,0x17,0xb,
+0x18,0x1e,0xe,0x19,0x0,0x0,0x0,0xc,
+0xf,0x0,0x10,0x0,0xd,0xe,0x19,0x0,
+0x0,0x0,0xc,0xf,0x1a,0x10,0x0,0xd,
+0x0,0x17,0x0,0x18,0x0,0xe,0x19,0x0,
+0x1a,0x0,0xc,0xf,0x17,0x10,0x18,0xd,
+0x0,0xe,0x19,0x0,0x0,0x0,0xc,0xf,
+0x0,0x10,0x1b,0xd,0x17,0x0,0x18,0xe,
+0x0,0x0,0x0,0x1a,0xc,0xf,0x1b,0x10,
+0x17,0xd,0x18,0xe,0x0,0x0,0x1a,0x0,
+0xc,0xf,0x0,0x10,0x5,0xd,0x17,0x0,
+0x18,0x0,0x0,0x7,0x0,0x0,0x1a,0x0,
+0x4,0x1b,0x17,0x3,0x18,0x0,0x0,0x0,
+0x1f,0x20,0x21,0x0,0x1b,0x0,0x0,0x23,
+0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,
+0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,
+0x34,0x35,0x36,0xe,0x0,0x0,0x0,0x0,
+0xc,0xf,0x0,0x10,0x0,0xd,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x39,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1d,0x1c,0x13,0x14,0x15,
+0x16,0x11,0x12,0x0,0x0,0x0,0x0,0x1d,
+0x1c,0x13,0x14,0x15,0x16,0x11,0x12,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x11,0x12,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1c,0x13,0x14,0x15,0x16,
+0x11,0x12,0x0,0x0,0x0,0x0,0x0,0x13,
+0x14,0x15,0x16,0x11,0x12,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,
+0x14,0x15,0x16,0x11,0x12,0x0,0x0,0x0,
+0x0,0x0,0x0,0x13,0x14,0x15,0x16,0x11,
+0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x13,0x14,0x15,0x16,0x11,0x12,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,
+0x16,0x11,0x12,0x0,0x8,0x9,0xa,0x50,
+0xff676980,0xffffffd6,0xffffffe7,0x50,0x50,0x50,0x50,0xff676980,
+0xff676980,0xff676980,0x50,0x50,0x50,0x50,0x50,0x50,
+0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+0x50,0x50,0x50,0x50,0x50,0x50,0xff676980,0xff676980,
+0xff676980,0xfffffff8,0xffffffe7,0xff676980,0xff676980,0xff676980,0xffffffdf,0xffffffdf,
+0x7b,0x7b,0x43,0x43,0xfffffff3,0xfffffff3,0xfffffff3,0xfffffff3,
+0x37,0x29,0x1d,0xd,0x2,0xffffffdb,0xff676980,0x50,
+0xffffffe7,0x0,0x80,0x3,0x7,0x0,0x3,0x2,
+0x2,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+0x1,0x1,0x1,0x0,0x3,0x2,0x7,0x5,
+0x5,0x5,0x7,0x7,0x7,0x7,0x7,0x7,
+0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,
+0x7,0x7,0x7,0x7,0x7,0xb,0x3,0x3,
+0x3,0xff676980,0xfffffffd,0xfffffffe,0xffffffff,0x2d,0x21,0x7e,
+0x28,0x101,0x102,0x103,0x2c,0x2a,0x2f,0x25,
+0x2b,0x2d,0x10b,0x10c,0x107,0x108,0x109,0x10a,
+0x3c,0x3e,0x26,0x5e,0x7c,0x106,0x105,0x3f,
+0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+0x29,0x3a,0xffffffff,0x0,0xfffffffe,0x1,0x2,0x0,
+0x0,0x0,0x0,0x1b,0x1c,0x1d,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x4,0x5,0x6,0x0,0x3,0x8,
+0x9,0xa,0xb,0xc,0xd,0xe,0xf,0x10,
+0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,
+0x19,0x0,0x7,0x0,0x1a,0x0,0x0,0x0,
+};
+static void func_402ee0(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloca(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_403080(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_make_deps_target(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_4045c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_trigraph_pcp(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_name_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_rescan(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_expand_to_temp_buffer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_handle_directive(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_special_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_do_include(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_finclude(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_do_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_compare_defs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_comp_def_part(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_collect_expansion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_undef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_do_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_once(uint8_t *mem, uint32_t sp, uint32_t v0);
+static uint64_t f_do_pragma(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_do_ident(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_sccs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_if(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_elif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_eval_if_expression(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_do_xifdef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_conditional_skip(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_skip_if_group(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1);
+static uint64_t f_do_else(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_do_endif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_validate_else(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_skip_to_end_of_comment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_skip_quoted_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_output_line_command(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_macroexpand(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_macarg(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_macarg1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_discard_comments(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint64_t f_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_error_from_errno(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_error_with_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_line_for_error(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_grow_outbuf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_install(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint64_t f_lookup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_delete_macro(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint64_t f_hashf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_dump_all_macros(uint8_t *mem, uint32_t sp);
+static void f_dump_defn_1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_dump_arg_n(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_initialize_char_syntax(uint8_t *mem, uint32_t sp);
+static void f_initialize_builtins(uint8_t *mem, uint32_t sp);
+static void f_make_definition(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_undef(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_deps_output(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_bzero(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_bcopy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_bcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_perror_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_pfatal_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_memory_full(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t f_xcalloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_savestring(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_file_size_and_mode(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_parse_number(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_yylex(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_parse_escape(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_yyerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_parse_c_expression(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_yyparse(uint8_t *mem, uint32_t sp);
+static void f_MDnewstab(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_MDstrcpy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_40fd78(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_40fe88(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_40ff80(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_MDopen(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_MDupdate(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_MDclose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+uint64_t trampoline(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t fp_dest) {
+switch (fp_dest) {
+case 0x403080: func_403080(mem, sp, a0, a1, a2, a3); return 0;
+case 0x4071f4: return f_do_include(mem, sp, a0, a1, a2, a3);
+case 0x407d78: return f_do_define(mem, sp, a0, a1, a2, a3);
+case 0x409168: return f_do_line(mem, sp, a0, a1, a2, a3);
+case 0x4095a8: return f_do_undef(mem, sp, a0, a1, a2, a3);
+case 0x4097f0: f_do_error(mem, sp, a0, a1, a2, a3); return 0;
+case 0x40998c: return f_do_pragma(mem, sp, a0, a1);
+case 0x409a1c: return (uint64_t)f_do_ident(mem, sp, a0, a1, a2, a3) << 32;
+case 0x409a7c: return f_do_sccs(mem, sp, a0, a1, a2, a3);
+case 0x409ac8: return f_do_if(mem, sp, a0, a1, a2, a3);
+case 0x409b48: return f_do_elif(mem, sp, a0, a1, a2, a3);
+case 0x409e00: return f_do_xifdef(mem, sp, a0, a1, a2, a3);
+case 0x40a728: return f_do_else(mem, sp, a0, a1, a2, a3);
+case 0x40a95c: return f_do_endif(mem, sp, a0, a1, a2, a3);
+case 0x40df98: f_fatal(mem, sp, a0, a1, a2, a3); return 0;
+default: abort();}
+}
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10010000);
+memcpy(mem + 0x10001000, rodata, 0x1cc0);
+memcpy(mem + 0x10002cc0, data, 0xb80);
+MEM_S32(0x10003d18) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x10003d10) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0, argc, arg_addr);
+return ret;
+}
+
+static void func_402ee0(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L402ee0:
+//nop;
+//nop;
+//nop;
+v0 = 0x10002cd4;
+sp = sp + 0xffffffd8;
+t6 = sp + 0x27;
+v0 = MEM_U32(v0 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+at = v0 < t6;
+if (v0 != 0) goto L402f2c;
+//nop;
+at = 0x10002cd4;
+v0 = sp + 0x27;
+// fdead 400081ef t9 = t9;
+MEM_U32(at + 0) = v0;
+func_402ee0(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L402f50;
+L402f2c:
+//nop;
+if (at == 0) goto L402f44;
+at = 0x10003b90;
+t7 = 0x1;
+MEM_U32(at + 0) = t7;
+goto L402f50;
+L402f44:
+at = 0x10003b90;
+t8 = 0xffffffff;
+MEM_U32(at + 0) = t8;
+L402f50:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f_alloca(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, t8 = 0, t9 = 0;
+L402f60:
+//alloca:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+s3 = 0x10003b90;
+// fdead 401001eb MEM_U32(sp + 44) = ra;
+// fdead 401001eb MEM_U32(sp + 40) = gp;
+s3 = s3;
+t6 = MEM_U32(s3 + 0);
+// fdead 401081eb MEM_U32(sp + 32) = s2;
+// fdead 401081eb MEM_U32(sp + 28) = s1;
+// fdead 401081eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 72) = a0;
+if (t6 != 0) goto L402fb0;
+//nop;
+// fdead 401081eb t9 = t9;
+//nop;
+func_402ee0(mem, sp);
+// bdead 40100003 gp = MEM_U32(sp + 40);
+L402fb0:
+s0 = 0x10002cd8;
+s2 = sp + 0x47;
+s0 = MEM_U32(s0 + 0);
+if (s0 == zero) {
+t9 = MEM_U32(sp + 72);
+goto L40301c;}
+L402fc4:
+v0 = MEM_U32(s3 + 0);
+//nop;
+if ((int)v0 <= 0) goto L402fe0;
+t7 = MEM_U32(s0 + 4);
+//nop;
+if (s2 < t7) goto L402ff8;
+L402fe0:
+if ((int)v0 >= 0) {
+t9 = MEM_U32(sp + 72);
+goto L40301c;}
+t8 = MEM_U32(s0 + 4);
+if (t8 >= s2) {
+t9 = MEM_U32(sp + 72);
+goto L40301c;}
+L402ff8:
+//nop;
+s1 = MEM_U32(s0 + 0);
+a0 = s0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+s0 = s1;
+if (s1 != 0) goto L402fc4;
+t9 = MEM_U32(sp + 72);
+L40301c:
+at = 0x10002cd8;
+s2 = sp + 0x47;
+MEM_U32(at + 0) = s0;
+if (t9 != 0) goto L403034;
+v0 = zero;
+goto L403064;
+L403034:
+//nop;
+a0 = MEM_U32(sp + 72);
+a0 = a0 + 0x8;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 80009 gp = MEM_U32(sp + 40);
+t0 = 0x10002cd8;
+at = 0x10002cd8;
+t0 = MEM_U32(t0 + 0);
+MEM_U32(v0 + 4) = s2;
+MEM_U32(v0 + 0) = t0;
+MEM_U32(at + 0) = v0;
+v0 = v0 + 0x8;
+L403064:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x48;
+return v0;
+}
+
+static void func_403080(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+//nop;
+//nop;
+//nop;
+//nop;
+a0 = 0x100010f4;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_make_deps_target(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+s0 = 0, t8 = 0, t9 = 0;
+L4030bc:
+//make_deps_target:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+t6 = MEM_U8(a0 + 0);
+a1 = a0;
+v0 = a0;
+//nop;
+if (t6 == 0) goto L40311c;
+v1 = MEM_U8(a0 + 0);
+a0 = 0x2f;
+L4030f4:
+if (a0 != v1) {
+v1 = MEM_U8(v0 + 1);
+goto L403110;}
+t7 = MEM_U8(v0 + 1);
+if (t7 == zero) {
+v1 = MEM_U8(v0 + 1);
+goto L403110;}
+a1 = v0 + 0x1;
+v1 = MEM_U8(v0 + 1);
+L403110:
+v0 = v0 + 0x1;
+//nop;
+if (v1 != 0) goto L4030f4;
+L40311c:
+//nop;
+v1 = v0 - a1;
+a0 = v1 + 0x10;
+MEM_U32(sp + 32) = v1;
+MEM_U32(sp + 56) = a1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 56);
+s0 = v0;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = s0;
+a1 = 0x2e;
+//nop;
+//nop;
+v0 = wrapper_strrchr(mem, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a0 = s0;
+a1 = 0x2f;
+//nop;
+MEM_U32(sp + 44) = v0;
+//nop;
+v0 = wrapper_strrchr(mem, a0, a1);
+v1 = MEM_U32(sp + 44);
+// bdead 4002001b gp = MEM_U32(sp + 24);
+//nop;
+if (v1 == 0) goto L4031cc;
+at = v0 < v1;
+if (v0 == 0) goto L4031a4;
+//nop;
+if (v0 >= v1) goto L4031cc;
+L4031a4:
+t8 = MEM_U32(sp + 32);
+t1 = 0x6f;
+t9 = s0 + t8;
+t0 = t9 + 0xfffffffe;
+//nop;
+if (t0 < v1) goto L4031cc;
+MEM_U8(v1 + 1) = (uint8_t)t1;
+MEM_U8(v1 + 2) = (uint8_t)zero;
+goto L4031e4;
+L4031cc:
+//nop;
+a1 = 0x10001110;
+a0 = s0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 24);
+L4031e4:
+// bdead 20001 ra = MEM_U32(sp + 28);
+v0 = s0;
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4031f8:
+//main:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff30;
+//nop;
+// fdead 40000063 MEM_U32(sp + 40) = s4;
+// fdead 40000063 MEM_U32(sp + 24) = s0;
+s4 = a0;
+// fdead 40200063 MEM_U32(sp + 52) = ra;
+s0 = a0 << 2;
+// fdead 40220063 MEM_U32(sp + 48) = gp;
+// fdead 40220063 MEM_U32(sp + 44) = s5;
+// fdead 40220063 MEM_U32(sp + 36) = s3;
+// fdead 40220063 MEM_U32(sp + 32) = s2;
+// fdead 40220063 MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 212) = a1;
+a0 = s0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 176) = v0;
+a0 = s0;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 172) = v0;
+a0 = s0;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4022000b gp = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 212);
+MEM_U32(sp + 168) = v0;
+MEM_U32(sp + 164) = zero;
+MEM_U32(sp + 160) = zero;
+MEM_U32(sp + 156) = zero;
+MEM_U32(sp + 152) = zero;
+MEM_U32(sp + 148) = zero;
+MEM_U32(sp + 144) = zero;
+at = 0x10003d1c;
+t7 = MEM_U32(t6 + 0);
+//nop;
+s2 = 0x1;
+MEM_U32(at + 0) = t7;
+at = 0x10002e70;
+MEM_U32(sp + 196) = zero;
+s5 = zero;
+MEM_U32(at + 0) = s2;
+f_initialize_char_syntax(mem, sp);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = 0xd;
+at = 0x10002e70;
+//nop;
+a1 = 0x403080; // function pointer
+MEM_U32(at + 0) = zero;
+at = 0x10003d30;
+a1 = a1;
+MEM_U32(at + 0) = zero;
+at = 0x10002ce8;
+MEM_U32(at + 0) = s2;
+at = 0x10003d34;
+MEM_U32(at + 0) = zero;
+at = 0x10003d50;
+MEM_U32(at + 0) = zero;
+at = 0x10003d20;
+MEM_U32(at + 0) = zero;
+v0 = wrapper_signal(mem, a0, trampoline, a1, sp);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+t8 = 0x16;
+a0 = MEM_U32(sp + 176);
+//nop;
+at = 0x10003d24;
+a1 = s0;
+MEM_U32(at + 0) = t8;
+wrapper_bzero(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 172);
+a1 = s0;
+//nop;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 168);
+a1 = s0;
+//nop;
+//nop;
+wrapper_bzero(mem, a0, a1);
+at = (int)s4 < (int)0x2;
+// bdead 40680147 gp = MEM_U32(sp + 48);
+s1 = s2;
+if (at != 0) goto L4039e0;
+v0 = MEM_U32(sp + 212);
+t9 = s4 << 2;
+s1 = 0x4;
+t1 = t9 + v0;
+MEM_U32(sp + 60) = t1;
+s3 = 0x20;
+s0 = v0 + 0x4;
+a2 = MEM_U32(s0 + 0);
+L403384:
+at = 0x2d;
+t2 = MEM_U8(a2 + 0);
+if (t2 == at) {
+t0 = MEM_U8(a2 + 1);
+goto L4033d8;}
+t4 = MEM_U32(sp + 196);
+if (s5 == 0) goto L4033bc;
+//nop;
+a0 = 0x10001114;
+t3 = MEM_U32(sp + 212);
+a0 = a0;
+a1 = MEM_U32(t3 + 0);
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+goto L4039c4;
+L4033bc:
+//nop;
+if (t4 == 0) goto L4033cc;
+s5 = a2;
+goto L4039c4;
+L4033cc:
+MEM_U32(sp + 196) = a2;
+goto L4039c4;
+// fdead 0 t0 = MEM_U8(a2 + 1);
+L4033d8:
+t5 = t0 + 0xffffffdc;
+if (t0 == 0) goto L403408;
+//nop;
+if (t5 >= 0x54) goto L4039ac;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L4037a8;
+case 1: goto L4039ac;
+case 2: goto L4039ac;
+case 3: goto L4039ac;
+case 4: goto L4039ac;
+case 5: goto L4039ac;
+case 6: goto L4039ac;
+case 7: goto L403504;
+case 8: goto L4039ac;
+case 9: goto L4039ac;
+case 10: goto L4039ac;
+case 11: goto L4039ac;
+case 12: goto L4039ac;
+case 13: goto L4039ac;
+case 14: goto L4039ac;
+case 15: goto L4039ac;
+case 16: goto L4039ac;
+case 17: goto L4039ac;
+case 18: goto L4039ac;
+case 19: goto L4039ac;
+case 20: goto L4039ac;
+case 21: goto L4039ac;
+case 22: goto L4039ac;
+case 23: goto L4039ac;
+case 24: goto L4039ac;
+case 25: goto L4039ac;
+case 26: goto L4039ac;
+case 27: goto L4039ac;
+case 28: goto L4039ac;
+case 29: goto L4039ac;
+case 30: goto L403504;
+case 31: goto L403790;
+case 32: goto L403708;
+case 33: goto L4039c4;
+case 34: goto L4039ac;
+case 35: goto L4039ac;
+case 36: goto L4039ac;
+case 37: goto L4037b4;
+case 38: goto L4039ac;
+case 39: goto L4039ac;
+case 40: goto L4039ac;
+case 41: goto L4035ac;
+case 42: goto L4039ac;
+case 43: goto L4039ac;
+case 44: goto L40379c;
+case 45: goto L4039ac;
+case 46: goto L4039ac;
+case 47: goto L4039ac;
+case 48: goto L4039ac;
+case 49: goto L403760;
+case 50: goto L4039ac;
+case 51: goto L403510;
+case 52: goto L4039ac;
+case 53: goto L4039ac;
+case 54: goto L4039ac;
+case 55: goto L4039ac;
+case 56: goto L4039ac;
+case 57: goto L4039ac;
+case 58: goto L4039ac;
+case 59: goto L4039ac;
+case 60: goto L4039ac;
+case 61: goto L4039ac;
+case 62: goto L4039ac;
+case 63: goto L4039ac;
+case 64: goto L4036cc;
+case 65: goto L4039ac;
+case 66: goto L4039ac;
+case 67: goto L4039ac;
+case 68: goto L4039ac;
+case 69: goto L403418;
+case 70: goto L4039ac;
+case 71: goto L4039ac;
+case 72: goto L4039ac;
+case 73: goto L4039ac;
+case 74: goto L403948;
+case 75: goto L403448;
+case 76: goto L403498;
+case 77: goto L4039ac;
+case 78: goto L4039ac;
+case 79: goto L403910;
+case 80: goto L4034ac;
+case 81: goto L403978;
+case 82: goto L4036e0;
+case 83: goto L403904;
+}
+L403408:
+t8 = MEM_U32(sp + 196);
+if (t0 == 0) goto L403980;
+//nop;
+goto L4039ac;
+L403418:
+t7 = MEM_U8(a2 + 2);
+t6 = MEM_U32(sp + 176);
+t8 = a2 + 0x2;
+v1 = t6 + s1;
+if (t7 == 0) goto L403434;
+MEM_U32(v1 + 0) = t8;
+goto L4039c4;
+L403434:
+t9 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v1 + 0) = t9;
+goto L4039c4;
+L403448:
+//nop;
+if (s5 == 0) goto L403464;
+//nop;
+a0 = 0x10001138;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 403e0003 gp = MEM_U32(sp + 48);
+L403464:
+//nop;
+s5 = MEM_U32(s0 + 4);
+a1 = 0x1000115c;
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+a0 = s5;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4039c4;
+s5 = 0x10001160;
+s5 = s5;
+goto L4039c4;
+L403498:
+v0 = 0x10003d38;
+t1 = MEM_U32(v0 + 0);
+t2 = t1 + 0x1;
+MEM_U32(v0 + 0) = t2;
+goto L4039c4;
+L4034ac:
+//nop;
+a1 = 0x10001164;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4034dc;
+at = 0x10003d4c;
+MEM_U32(at + 0) = s2;
+at = 0x10002e70;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4034dc:
+//nop;
+a1 = 0x10001174;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4039c4;
+at = 0x10002ce8;
+MEM_U32(at + 0) = zero;
+goto L4039c4;
+L403504:
+at = 0x10003d20;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L403510:
+//nop;
+a1 = 0x10001180;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403534;
+at = 0x10003d48;
+MEM_U32(at + 0) = s2;
+L403534:
+//nop;
+a1 = 0x1000118c;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403558;
+at = 0x10003d44;
+MEM_U32(at + 0) = s2;
+L403558:
+//nop;
+a1 = 0x10001198;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0003 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L40357c;
+at = 0x10003d44;
+MEM_U32(at + 0) = s2;
+L40357c:
+//nop;
+a1 = 0x100011a4;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4039c4;
+at = 0x10003d48;
+MEM_U32(at + 0) = s2;
+at = 0x10003d44;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4035ac:
+t3 = MEM_U8(a2 + 2);
+at = 0x44;
+//nop;
+if (t3 != at) goto L403660;
+//nop;
+a1 = 0x100011ac;
+a0 = a2 + 0x3;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4035ec;
+t5 = MEM_U32(sp + 212);
+t4 = s4 << 2;
+v1 = sp + 0x94;
+v0 = t4 + t5;
+goto L403628;
+L4035ec:
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = 0x100011b4;
+a0 = a0 + 0x3;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403620;
+t7 = MEM_U32(sp + 212);
+t6 = s4 << 2;
+v1 = sp + 0x90;
+v0 = t6 + t7;
+goto L403628;
+L403620:
+a2 = MEM_U32(s0 + 0);
+goto L4039ac;
+L403628:
+s0 = s0 + 0x4;
+s1 = s1 + 0x4;
+if (s0 != v0) goto L403654;
+//nop;
+a0 = 0x100011bc;
+a1 = MEM_U32(s0 + -4);
+MEM_U32(sp + 140) = v1;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 140);
+L403654:
+t8 = MEM_U32(s0 + 0);
+MEM_U32(v1 + 0) = t8;
+goto L4039c4;
+L403660:
+//nop;
+a1 = 0x100011dc;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403694;
+at = 0x10002cec;
+t9 = 0x2;
+t1 = 0x1;
+MEM_U32(sp + 156) = t1;
+MEM_U32(at + 0) = t9;
+goto L4039c4;
+L403694:
+//nop;
+a1 = 0x100011e0;
+a0 = MEM_U32(s0 + 0);
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4036c4;
+at = 0x10002cec;
+t2 = 0x1;
+MEM_U32(sp + 156) = t2;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4036c4:
+a2 = MEM_U32(s0 + 0);
+goto L4039ac;
+L4036cc:
+at = 0x10003d34;
+MEM_U32(at + 0) = s2;
+at = 0x10003d50;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4036e0:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x100011e4;
+a2 = 0x10002eb0;
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+goto L4039c4;
+L403708:
+t4 = MEM_U8(a2 + 2);
+t3 = MEM_U32(sp + 172);
+v1 = t3 + s1;
+if (t4 == 0) goto L403720;
+a0 = a2 + 0x2;
+goto L403730;
+L403720:
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+v1 = v1 + 0x4;
+a0 = MEM_U32(s0 + 0);
+L403730:
+//nop;
+a1 = 0x3d;
+MEM_U32(sp + 64) = v1;
+MEM_U32(sp + 136) = a0;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+a0 = MEM_U32(sp + 136);
+if (v0 == 0) goto L403758;
+MEM_U8(v0 + 0) = (uint8_t)s3;
+L403758:
+MEM_U32(v1 + 0) = a0;
+goto L4039c4;
+L403760:
+t6 = MEM_U8(a2 + 2);
+t5 = MEM_U32(sp + 168);
+t7 = a2 + 0x2;
+v1 = t5 + s1;
+if (t6 == 0) goto L40377c;
+MEM_U32(v1 + 0) = t7;
+goto L4039c4;
+L40377c:
+t8 = MEM_U32(s0 + 4);
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v1 + 0) = t8;
+goto L4039c4;
+L403790:
+at = 0x10002ce0;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L40379c:
+at = 0x10003d30;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4037a8:
+at = 0x10002e70;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L4037b4:
+t9 = MEM_U8(a2 + 2);
+//nop;
+if (t9 != 0) goto L4037dc;
+t1 = MEM_U32(s0 + 4);
+at = 0x2d;
+t2 = MEM_U8(t1 + 0);
+//nop;
+if (t2 != at) goto L4037dc;
+MEM_U32(sp + 160) = s2;
+goto L4039c4;
+L4037dc:
+t3 = 0x10003d68;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 != 0) goto L403814;
+//nop;
+a1 = 0x100011f8;
+a0 = a2 + 0x2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403814;
+at = 0x10003d68;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L403814:
+//nop;
+a0 = 0x8;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 128) = v0;
+MEM_U32(v0 + 0) = zero;
+t4 = 0x10002d28;
+t4 = MEM_U32(t4 + 0);
+//nop;
+if (t4 != 0) goto L40384c;
+at = 0x10002d28;
+MEM_U32(at + 0) = v0;
+goto L403858;
+L40384c:
+t5 = 0x10002d30;
+t5 = MEM_U32(t5 + 0);
+MEM_U32(t5 + 0) = v0;
+L403858:
+at = 0x10002d30;
+MEM_U32(at + 0) = v0;
+a2 = MEM_U32(s0 + 0);
+t6 = MEM_U8(a2 + 2);
+t7 = a2 + 0x2;
+if (t6 == zero) {
+t8 = MEM_U32(s0 + 4);
+goto L403880;}
+MEM_U32(v0 + 4) = t7;
+goto L40388c;
+// fdead 0 t8 = MEM_U32(s0 + 4);
+L403880:
+s1 = s1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U32(v0 + 4) = t8;
+L40388c:
+t9 = MEM_U32(sp + 128);
+a0 = MEM_U32(t9 + 4);
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+t1 = 0x10003d24;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 >= v0) goto L4038d4;
+//nop;
+t2 = MEM_U32(sp + 128);
+a0 = MEM_U32(t2 + 4);
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e014b gp = MEM_U32(sp + 48);
+at = 0x10003d24;
+MEM_U32(at + 0) = v0;
+L4038d4:
+t3 = 0x10003d68;
+t3 = MEM_U32(t3 + 0);
+if (t3 == zero) {
+t1 = MEM_U32(sp + 60);
+goto L4039c8;}
+t4 = 0x10002d2c;
+t5 = MEM_U32(sp + 128);
+t4 = MEM_U32(t4 + 0);
+if (t4 != zero) {
+t1 = MEM_U32(sp + 60);
+goto L4039c8;}
+at = 0x10002d2c;
+MEM_U32(at + 0) = t5;
+goto L4039c4;
+L403904:
+at = 0x10003d3c;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L403910:
+//nop;
+a1 = 0x100011fc;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403940;
+v0 = 0x10003d40;
+t6 = MEM_U32(v0 + 0);
+t7 = t6 + 0x1;
+MEM_U32(v0 + 0) = t7;
+goto L4039c4;
+L403940:
+a2 = MEM_U32(s0 + 0);
+goto L4039ac;
+L403948:
+//nop;
+a1 = 0x1000120c;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L403970;
+at = 0x10002ce4;
+MEM_U32(at + 0) = s2;
+goto L4039c4;
+L403970:
+MEM_U32(sp + 160) = s2;
+goto L4039c4;
+L403978:
+MEM_U32(sp + 164) = s2;
+goto L4039c4;
+L403980:
+//nop;
+if (t8 != 0) goto L403998;
+t9 = 0x10001218;
+t9 = t9;
+MEM_U32(sp + 196) = t9;
+goto L4039c4;
+L403998:
+//nop;
+if (s5 != 0) goto L4039ac;
+s5 = 0x1000121c;
+s5 = s5;
+goto L4039c4;
+L4039ac:
+//nop;
+a0 = 0x10001220;
+a1 = a2;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+L4039c4:
+t1 = MEM_U32(sp + 60);
+L4039c8:
+s0 = s0 + 0x4;
+s1 = s1 + 0x4;
+if (s0 < t1) {
+a2 = MEM_U32(s0 + 0);
+goto L403384;}
+s1 = 0x1;
+L4039e0:
+//nop;
+s3 = 0x20;
+//nop;
+f_initialize_char_syntax(mem, sp);
+// bdead 407c0003 gp = MEM_U32(sp + 48);
+a0 = 0xa;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 407c000b gp = MEM_U32(sp + 48);
+t3 = 0xa;
+v1 = 0x10003da0;
+MEM_U32(v1 + 16) = v0;
+MEM_U32(v1 + 20) = v0;
+MEM_U32(v1 + 8) = t3;
+//nop;
+//nop;
+f_initialize_builtins(mem, sp);
+t4 = MEM_U32(sp + 164);
+// bdead 407c2143 gp = MEM_U32(sp + 48);
+if (t4 != zero) {
+at = (int)s4 < (int)0x2;
+goto L403b24;}
+//nop;
+s0 = 0x10002d3c;
+a0 = MEM_U32(s0 + 0);
+v0 = wrapper_strlen(mem, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 407e000b gp = MEM_U32(sp + 48);
+a0 = v0;
+a1 = MEM_U32(s0 + 0);
+//nop;
+MEM_U32(sp + 124) = v0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+a2 = MEM_U32(sp + 124);
+// bdead 407c01c3 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+at = 0x2d;
+if (v1 == 0) goto L403b20;
+L403a8c:
+s0 = a2 + 0x2;
+if (v1 != at) goto L403aa4;
+t5 = MEM_U8(a2 + 1);
+at = 0x44;
+//nop;
+if (t5 == at) goto L403ac0;
+L403aa4:
+//nop;
+MEM_U32(sp + 124) = a2;
+//nop;
+wrapper_abort(mem);
+a2 = MEM_U32(sp + 124);
+// bdead 407e0083 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+L403ac0:
+//nop;
+if (v1 == 0) goto L403ae8;
+//nop;
+if (s3 == v1) goto L403ae8;
+v1 = MEM_U8(a2 + 1);
+L403ad4:
+a2 = a2 + 0x1;
+//nop;
+if (v1 == 0) goto L403ae8;
+if (s3 != v1) {
+v1 = MEM_U8(a2 + 1);
+goto L403ad4;}
+L403ae8:
+//nop;
+if (v1 == 0) goto L403af8;
+MEM_U8(a2 + 0) = (uint8_t)zero;
+a2 = a2 + 0x1;
+L403af8:
+//nop;
+a0 = s0;
+MEM_U32(sp + 124) = a2;
+//nop;
+f_make_definition(mem, sp, a0);
+a2 = MEM_U32(sp + 124);
+// bdead 407c01c3 gp = MEM_U32(sp + 48);
+v1 = MEM_U8(a2 + 0);
+if (v1 != zero) {
+at = 0x2d;
+goto L403a8c;}
+L403b20:
+at = (int)s4 < (int)0x2;
+L403b24:
+if (at != zero) {
+at = (int)s4 < (int)0x2;
+goto L403b74;}
+v1 = MEM_U32(sp + 172);
+s1 = 0x4;
+s0 = s4 << 2;
+v1 = v1 + 0x4;
+L403b3c:
+a0 = MEM_U32(v1 + 0);
+if (a0 == zero) {
+s1 = s1 + 0x4;
+goto L403b64;}
+//nop;
+MEM_U32(sp + 64) = v1;
+//nop;
+f_make_definition(mem, sp, a0);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+s1 = s1 + 0x4;
+L403b64:
+v1 = v1 + 0x4;
+if (s1 != s0) goto L403b3c;
+s1 = 0x1;
+at = (int)s4 < (int)0x2;
+L403b74:
+if (at != zero) {
+t6 = MEM_U32(sp + 160);
+goto L403bc4;}
+v1 = MEM_U32(sp + 168);
+s1 = 0x4;
+s0 = s4 << 2;
+v1 = v1 + 0x4;
+L403b8c:
+a0 = MEM_U32(v1 + 0);
+if (a0 == zero) {
+s1 = s1 + 0x4;
+goto L403bb4;}
+//nop;
+MEM_U32(sp + 64) = v1;
+//nop;
+f_make_undef(mem, sp, a0);
+// bdead 407e0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+s1 = s1 + 0x4;
+L403bb4:
+v1 = v1 + 0x4;
+if (s1 != s0) goto L403b8c;
+s1 = 0x1;
+t6 = MEM_U32(sp + 160);
+L403bc4:
+//nop;
+if (t6 != 0) goto L403c7c;
+v0 = 0x10002d28;
+t7 = MEM_U32(v0 + 0);
+//nop;
+if (t7 != 0) goto L403c04;
+t8 = 0x10003d20;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 == 0) goto L403bf8;
+t9 = 0x10002d10;
+MEM_U32(v0 + 0) = t9;
+goto L403c38;
+L403bf8:
+t1 = 0x10002cf8;
+MEM_U32(v0 + 0) = t1;
+goto L403c38;
+L403c04:
+t2 = 0x10003d20;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 == 0) goto L403c28;
+t4 = 0x10002d30;
+t3 = 0x10002d10;
+t4 = MEM_U32(t4 + 0);
+MEM_U32(t4 + 0) = t3;
+goto L403c38;
+L403c28:
+t6 = 0x10002d30;
+t5 = 0x10002cf8;
+t6 = MEM_U32(t6 + 0);
+MEM_U32(t6 + 0) = t5;
+L403c38:
+t7 = 0x10003d68;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L403c7c;
+v0 = 0x10002d2c;
+t8 = MEM_U32(v0 + 0);
+//nop;
+if (t8 != 0) goto L403c7c;
+t9 = 0x10003d20;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L403c74;
+t1 = 0x10002d10;
+MEM_U32(v0 + 0) = t1;
+goto L403c7c;
+L403c74:
+t2 = 0x10002cf8;
+MEM_U32(v0 + 0) = t2;
+L403c7c:
+t3 = 0x10003d50;
+at = 0x10003d50;
+t3 = MEM_U32(t3 + 0);
+t4 = t3 + 0x1;
+MEM_U32(at + 0) = t4;
+//nop;
+if ((int)s4 < (int)0x2) goto L403d18;
+v1 = MEM_U32(sp + 176);
+v1 = v1 + 0x4;
+L403ca4:
+a0 = MEM_U32(v1 + 0);
+if (a0 == zero) {
+s1 = s1 + 0x1;
+goto L403d10;}
+//nop;
+a1 = zero;
+a2 = 0x1b6;
+MEM_U32(sp + 64) = v1;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 407c010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+a0 = v0;
+if ((int)v0 >= 0) goto L403cf0;
+//nop;
+a0 = MEM_U32(v1 + 0);
+//nop;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+v0 = 0x21;
+goto L4045a0;
+L403cf0:
+//nop;
+a1 = MEM_U32(v1 + 0);
+MEM_U32(sp + 64) = v1;
+a2 = 0x10003da0;
+f_finclude(mem, sp, a0, a1, a2);
+// bdead 407c0143 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 64);
+s1 = s1 + 0x1;
+L403d10:
+v1 = v1 + 0x4;
+if (s1 != s4) goto L403ca4;
+L403d18:
+t5 = 0x10003d50;
+at = 0x10003d50;
+v0 = 0x10002cf0;
+t5 = MEM_U32(t5 + 0);
+t7 = MEM_U32(sp + 196);
+t6 = t5 + 0xffffffff;
+MEM_U32(at + 0) = t6;
+t0 = MEM_U32(v0 + 0);
+t0 = t0 + 0x1;
+MEM_U32(v0 + 0) = t0;
+if (t7 == 0) goto L403d54;
+t8 = MEM_U8(t7 + 0);
+a0 = MEM_U32(sp + 196);
+//nop;
+if (t8 != 0) goto L403d68;
+L403d54:
+t9 = 0x10001238;
+s4 = zero;
+t9 = t9;
+MEM_U32(sp + 196) = t9;
+goto L403d8c;
+L403d68:
+//nop;
+a1 = zero;
+a2 = 0x1b6;
+MEM_U32(sp + 80) = t0;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 4058014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+s4 = v0;
+if ((int)v0 < 0) goto L404588;
+L403d8c:
+t1 = 0x10002cec;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 != 0) goto L403f1c;
+//nop;
+a0 = 0x1000123c;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+if (v0 != 0) goto L403ddc;
+//nop;
+a0 = 0x10001250;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+if (v0 == 0) goto L403f1c;
+L403ddc:
+//nop;
+a0 = 0x10001264;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+a3 = v0;
+if (v0 != 0) goto L403e30;
+//nop;
+a0 = 0x10001278;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t2 = 0x2;
+t0 = MEM_U32(sp + 80);
+at = 0x10002cec;
+a3 = v0;
+MEM_U32(at + 0) = t2;
+goto L403e38;
+L403e30:
+at = 0x10002cec;
+MEM_U32(at + 0) = s2;
+L403e38:
+v1 = MEM_U8(v0 + 0);
+a1 = v0;
+s1 = v0;
+if (v1 == zero) {
+t3 = MEM_U8(a1 + 0);
+goto L403e70;}
+if (s3 == v1) {
+t3 = MEM_U8(a1 + 0);
+goto L403e70;}
+v1 = MEM_U8(a1 + 1);
+L403e58:
+a1 = a1 + 0x1;
+if (v1 == zero) {
+t3 = MEM_U8(a1 + 0);
+goto L403e70;}
+if (s3 != v1) {
+v1 = MEM_U8(a1 + 1);
+goto L403e58;}
+t3 = MEM_U8(a1 + 0);
+L403e70:
+s0 = a1 - a3;
+a2 = a1 + 0x1;
+a0 = s0 + 0x1;
+if (t3 == 0) goto L403ec8;
+//nop;
+MEM_U32(sp + 148) = a2;
+MEM_U32(sp + 112) = a3;
+MEM_U32(sp + 80) = t0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 406a000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+s1 = v0;
+//nop;
+a1 = v0;
+a2 = s0;
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+t4 = s1 + s0;
+MEM_U8(t4 + 0) = (uint8_t)zero;
+goto L403ecc;
+L403ec8:
+MEM_U32(sp + 148) = zero;
+L403ecc:
+//nop;
+a1 = 0x1000128c;
+a0 = s1;
+MEM_U32(sp + 80) = t0;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 406c014b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+MEM_U32(sp + 152) = v0;
+if (v0 != 0) goto L403f10;
+//nop;
+a0 = s1;
+MEM_U32(sp + 80) = t0;
+//nop;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+L403f10:
+v0 = 0x10002cec;
+v0 = MEM_U32(v0 + 0);
+goto L403f38;
+L403f1c:
+v0 = 0x10002cec;
+v0 = MEM_U32(v0 + 0);
+//nop;
+if (v0 == 0) goto L403f38;
+t5 = 0xfb4ee44;
+t5 = t5 + 0x10;
+MEM_U32(sp + 152) = t5;
+L403f38:
+if (v0 == zero) {
+t2 = MEM_U32(sp + 144);
+goto L404080;}
+v0 = 0x10003d5c;
+a0 = 0xc8;
+MEM_U32(sp + 80) = t0;
+MEM_U32(v0 + 0) = a0;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+s3 = 0x10003d58;
+at = 0x10003d60;
+MEM_U32(s3 + 0) = v0;
+MEM_U8(v0 + 0) = (uint8_t)zero;
+t8 = MEM_U32(sp + 148);
+MEM_U32(at + 0) = zero;
+at = 0x10003d64;
+t9 = MEM_U32(sp + 196);
+MEM_U32(at + 0) = zero;
+if (t8 == 0) goto L403fc4;
+//nop;
+a0 = t8;
+a1 = zero;
+MEM_U32(sp + 80) = t0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x10001290;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+goto L40407c;
+L403fc4:
+t1 = MEM_U8(t9 + 0);
+a1 = zero;
+//nop;
+if (t1 != 0) goto L403ff4;
+//nop;
+a0 = 0x10001294;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+goto L40407c;
+L403ff4:
+//nop;
+a0 = MEM_U32(sp + 196);
+MEM_U32(sp + 80) = t0;
+//nop;
+v0 = f_make_deps_target(mem, sp, a0);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+a0 = v0;
+s0 = 0x10003d28;
+a1 = 0x10001298;
+MEM_U32(s0 + 0) = v0;
+//nop;
+a1 = a1;
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 406a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s0 + 0);
+a1 = zero;
+//nop;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 196);
+a1 = zero;
+//nop;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x1000129c;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40680143 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+L40407c:
+t2 = MEM_U32(sp + 144);
+L404080:
+s3 = 0x10003d58;
+t3 = MEM_U32(sp + 196);
+//nop;
+if (t2 == 0) goto L404114;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+a2 = MEM_U32(sp + 148);
+goto L4040bc;}
+//nop;
+a0 = 0x100012a0;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 148);
+L4040bc:
+//nop;
+if (a2 != 0) goto L4040e4;
+//nop;
+a0 = MEM_U32(sp + 196);
+MEM_U32(sp + 80) = t0;
+//nop;
+v0 = f_make_deps_target(mem, sp, a0);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+a2 = v0;
+L4040e4:
+//nop;
+a0 = 0x100012d4;
+a1 = MEM_U32(sp + 144);
+a3 = 0x40df98; // function pointer
+MEM_U32(sp + 148) = a2;
+MEM_U32(sp + 80) = t0;
+a0 = a0;
+v0 = f_MDopen(mem, sp, a0, a1, a2, a3);
+// bdead 4078000b gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+at = 0x10003d2c;
+MEM_U32(at + 0) = v0;
+L404114:
+//nop;
+a0 = s4;
+a1 = sp + 0xcc;
+a2 = sp + 0xc8;
+MEM_U32(sp + 80) = t0;
+v0 = f_file_size_and_mode(mem, sp, a0, a1, a2);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 80);
+t7 = MEM_U32(sp + 196);
+t6 = 0x10005ec0;
+t5 = t0 << 3;
+t5 = t5 + t0;
+t5 = t5 << 2;
+s0 = t5 + t6;
+MEM_U32(s0 + 4) = s2;
+MEM_U32(s0 + 0) = t7;
+t8 = MEM_U32(sp + 204);
+at = 0x8000;
+v1 = 0x7d0;
+t9 = t8 & 0xf000;
+if (t9 == at) {
+MEM_U32(s0 + 8) = zero;
+goto L404218;}
+//nop;
+a0 = 0x7d2;
+MEM_U32(sp + 96) = v1;
+MEM_U32(sp + 100) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+a3 = MEM_U32(sp + 100);
+MEM_U32(s0 + 16) = v0;
+a1 = v0;
+L404194:
+//nop;
+a0 = s4;
+a2 = v1 - a3;
+MEM_U32(sp + 96) = v1;
+MEM_U32(sp + 88) = a1;
+MEM_U32(sp + 100) = a3;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 88);
+a3 = MEM_U32(sp + 100);
+if ((int)v0 < 0) goto L404588;
+if (v0 != zero) {
+a3 = a3 + v0;
+goto L4041d8;}
+MEM_U32(s0 + 8) = a3;
+goto L40428c;
+// fdead 0 a3 = a3 + v0;
+L4041d8:
+a1 = a1 + v0;
+if (v1 != a3) goto L404194;
+//nop;
+v1 = v1 << 1;
+a0 = MEM_U32(s0 + 16);
+MEM_U32(sp + 100) = a3;
+MEM_U32(sp + 96) = v1;
+a1 = v1 + 0x2;
+v0 = f_xrealloc(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 100);
+// bdead 4072010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 96);
+MEM_U32(s0 + 16) = v0;
+a1 = v0 + a3;
+goto L404194;
+// fdead 0 MEM_U32(s0 + 8) = zero;
+L404218:
+//nop;
+a0 = MEM_U32(sp + 200);
+a0 = a0 + 0x2;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4072000b gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 16) = v0;
+t1 = MEM_U32(sp + 200);
+if ((int)t1 <= 0) {
+v1 = MEM_U32(s0 + 16);
+goto L404290;}
+L40423c:
+//nop;
+t2 = MEM_U32(s0 + 16);
+t3 = MEM_U32(s0 + 8);
+a0 = s4;
+a2 = MEM_U32(sp + 200);
+a1 = t2 + t3;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4072010b gp = MEM_U32(sp + 48);
+if ((int)v0 > 0) goto L404270;
+//nop;
+if (v0 != 0) goto L404588;
+v1 = MEM_U32(s0 + 16);
+goto L404290;
+L404270:
+t4 = MEM_U32(s0 + 8);
+t5 = t4 + v0;
+MEM_U32(s0 + 8) = t5;
+t6 = MEM_U32(sp + 200);
+t7 = t6 - v0;
+MEM_U32(sp + 200) = t7;
+if ((int)t7 > 0) goto L40423c;
+L40428c:
+v1 = MEM_U32(s0 + 16);
+L404290:
+t8 = 0x10002e74;
+t9 = 0x10002ce8;
+MEM_U32(s0 + 20) = v1;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(s0 + 28) = t8;
+t9 = MEM_U32(t9 + 0);
+if (t9 != zero) {
+v0 = MEM_U32(s0 + 8);
+goto L4042cc;}
+//nop;
+a0 = s0;
+//nop;
+f_trigraph_pcp(mem, sp, a0);
+// bdead 40520003 gp = MEM_U32(sp + 48);
+v1 = MEM_U32(s0 + 16);
+v0 = MEM_U32(s0 + 8);
+L4042cc:
+a0 = v1 + v0;
+if ((int)v0 <= 0) goto L4042f8;
+t1 = MEM_U8(a0 + -1);
+s2 = 0xa;
+if (s2 == t1) {
+t4 = v1 + v0;
+goto L4042fc;}
+MEM_U8(a0 + 0) = (uint8_t)s2;
+t2 = MEM_U32(s0 + 8);
+v1 = MEM_U32(s0 + 16);
+v0 = t2 + 0x1;
+MEM_U32(s0 + 8) = v0;
+L4042f8:
+t4 = v1 + v0;
+L4042fc:
+s2 = 0xa;
+MEM_U8(t4 + 0) = (uint8_t)zero;
+if (s5 == 0) goto L40435c;
+//nop;
+a1 = 0x100012d8;
+a0 = s5;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 405a0003 gp = MEM_U32(sp + 48);
+if (v0 == 0) goto L40435c;
+//nop;
+a1 = 0x100012e4;
+a2 = 0xfb4ee44;
+a0 = s5;
+a1 = a1;
+a2 = a2 + 0x10;
+v0 = wrapper_freopen(mem, a0, a1, a2);
+// bdead 405a0103 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L40435c;
+//nop;
+a0 = s5;
+//nop;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 401a0003 gp = MEM_U32(sp + 48);
+L40435c:
+//nop;
+a0 = s0;
+a1 = 0x10003da0;
+a2 = zero;
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40180183 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x10003da0;
+//nop;
+f_rescan(mem, sp, a0, a1);
+// bdead 401801c3 gp = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 156);
+t5 = 0x10003d34;
+t5 = MEM_U32(t5 + 0);
+//nop;
+if (t5 == 0) goto L4043b8;
+//nop;
+//nop;
+f_dump_all_macros(mem, sp);
+// bdead 40180143 gp = MEM_U32(sp + 48);
+goto L404414;
+L4043b8:
+//nop;
+if (t6 != 0) goto L404414;
+s1 = 0xfb4ee44;
+t7 = MEM_U32(sp + 152);
+t8 = s1 + 0x10;
+//nop;
+if (t7 == t8) goto L404414;
+a1 = 0x10003da0;
+t9 = 0x10003da0;
+a0 = MEM_U8(s1 + 29);
+a1 = MEM_U32(a1 + 16);
+t9 = MEM_U32(t9 + 20);
+a2 = t9 - a1;
+//nop;
+//nop;
+v0 = wrapper_write(mem, a0, a1, a2);
+// bdead 40180143 gp = MEM_U32(sp + 48);
+if ((int)v0 >= 0) goto L404414;
+//nop;
+a0 = 0x100012e8;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40180143 gp = MEM_U32(sp + 48);
+L404414:
+t1 = 0x10002cec;
+s1 = 0xfb4ee44;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 == 0) goto L404508;
+//nop;
+a1 = MEM_U32(sp + 152);
+a0 = MEM_U32(s3 + 0);
+s0 = a1 + 0xfffffff0;
+v0 = wrapper_fputs(mem, a0, a1);
+// bdead 400e0143 gp = MEM_U32(sp + 48);
+t3 = MEM_U32(sp + 152);
+t2 = 0xfb4e580;
+t2 = MEM_U32(t2 + 0);
+if (t2 == zero) {
+t4 = MEM_U32(t3 + 0);
+goto L404474;}
+//nop;
+a0 = 0xa;
+a1 = MEM_U32(sp + 152);
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 40060143 gp = MEM_U32(sp + 48);
+goto L4044c4;
+// fdead 0 t4 = MEM_U32(t3 + 0);
+L404474:
+t5 = t4 + 0xffffffff;
+MEM_U32(t3 + 0) = t5;
+t6 = MEM_U32(sp + 152);
+t8 = MEM_U32(sp + 152);
+t7 = MEM_U32(t6 + 0);
+if ((int)t7 >= 0) {
+t9 = MEM_U32(t8 + 4);
+goto L4044b0;}
+//nop;
+a0 = 0xa;
+a1 = t6;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 40060143 gp = MEM_U32(sp + 48);
+goto L4044c4;
+// fdead 0 t9 = MEM_U32(t8 + 4);
+L4044b0:
+MEM_U8(t9 + 0) = (uint8_t)s2;
+t1 = MEM_U32(sp + 152);
+t2 = MEM_U32(t1 + 4);
+t4 = t2 + 0x1;
+MEM_U32(t1 + 4) = t4;
+L4044c4:
+//nop;
+if (s0 == s1) goto L404508;
+//nop;
+a0 = MEM_U32(sp + 152);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+t5 = MEM_U32(sp + 152);
+// bdead 40044143 gp = MEM_U32(sp + 48);
+t3 = MEM_U8(t5 + 12);
+t7 = t3 & 0x20;
+//nop;
+if (t7 == 0) goto L404508;
+//nop;
+a0 = 0x100012fc;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40040143 gp = MEM_U32(sp + 48);
+L404508:
+a0 = 0x10003d2c;
+a0 = MEM_U32(a0 + 0);
+if (a0 == zero) {
+t6 = MEM_U8(s1 + 28);
+goto L404530;}
+//nop;
+a1 = MEM_U32(sp + 148);
+//nop;
+f_MDclose(mem, sp, a0, a1);
+// bdead 40040143 gp = MEM_U32(sp + 48);
+t6 = MEM_U8(s1 + 28);
+L404530:
+t8 = t6 & 0x20;
+//nop;
+if (t8 == 0) goto L404550;
+//nop;
+a0 = 0x10001310;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+L404550:
+t9 = 0x10002e6c;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L404574;
+//nop;
+a0 = 0x21;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+L404574:
+//nop;
+a0 = zero;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 48);
+L404588:
+//nop;
+a0 = MEM_U32(sp + 196);
+//nop;
+f_pfatal_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 48);
+v0 = zero;
+L4045a0:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0xd0;
+return v0;
+}
+
+static void func_4045c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4045c4:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+sp = sp + 0xffffffb8;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+// fdead 420081eb MEM_U32(sp + 32) = s0;
+//nop;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+s0 = a0;
+// fdead 420381eb MEM_U32(sp + 44) = ra;
+// fdead 420381eb MEM_U32(sp + 40) = gp;
+// fdead 420381eb MEM_U32(sp + 36) = s1;
+MEM_U32(sp + 76) = a1;
+MEM_U32(sp + 80) = a2;
+MEM_U32(sp + 84) = a3;
+v0 = t7 + t8;
+a0 = MEM_U32(v0 + 0);
+MEM_U32(sp + 52) = v0;
+MEM_U32(sp + 56) = a0;
+v0 = wrapper_strlen(mem, a0);
+t9 = MEM_U32(sp + 84);
+// bdead 4402000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+a0 = t9 + v0;
+//nop;
+a0 = a0 + 0x64;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 84);
+t1 = MEM_U32(sp + 60);
+//nop;
+s1 = v0;
+a0 = t0 + t1;
+a0 = a0 + 0x64;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4006000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+a0 = v0;
+//nop;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 84);
+//nop;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 64);
+t2 = MEM_U32(sp + 84);
+// bdead 40060903 gp = MEM_U32(sp + 40);
+a0 = s1;
+t3 = a3 + t2;
+MEM_U8(t3 + 0) = (uint8_t)zero;
+t4 = MEM_U32(sp + 52);
+//nop;
+t6 = MEM_U32(sp + 56);
+a1 = 0x10001324;
+t5 = MEM_U32(t4 + 4);
+a2 = MEM_U32(sp + 76);
+MEM_U32(sp + 20) = t6;
+a1 = a1;
+MEM_U32(sp + 16) = t5;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40060001 gp = MEM_U32(sp + 40);
+a0 = s1;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40060009 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 48) = v0;
+if (s0 != 0) goto L4046e8;
+s0 = 0x10003da0;
+L4046e8:
+a1 = MEM_U32(s0 + 20);
+t8 = MEM_U32(s0 + 16);
+t7 = MEM_U32(s0 + 8);
+t1 = v0 + 0x1;
+t9 = a1 - t8;
+t0 = t7 - t9;
+//nop;
+if ((int)t1 < (int)t0) goto L404728;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = s0;
+a1 = a1 + 0x1;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s0 + 20);
+L404728:
+//nop;
+a0 = s1;
+a2 = MEM_U32(sp + 48);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t2 = MEM_U32(s0 + 20);
+t3 = MEM_U32(sp + 48);
+// bdead 40061801 gp = MEM_U32(sp + 40);
+a0 = s1;
+t4 = t2 + t3;
+MEM_U32(s0 + 20) = t4;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 44);
+// bdead 19 gp = MEM_U32(sp + 40);
+// bdead 19 s0 = MEM_U32(sp + 32);
+// bdead 19 s1 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x48;
+return;
+}
+
+static void f_trigraph_pcp(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+L40478c:
+//trigraph_pcp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000016b MEM_U32(sp + 52) = ra;
+// fdead 4000016b MEM_U32(sp + 48) = gp;
+// fdead 4000016b MEM_U32(sp + 44) = s5;
+// fdead 4000016b MEM_U32(sp + 40) = s4;
+// fdead 4000016b MEM_U32(sp + 36) = s3;
+// fdead 4000016b MEM_U32(sp + 32) = s2;
+// fdead 4000016b MEM_U32(sp + 28) = s1;
+// fdead 4000016b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 56) = a0;
+s4 = MEM_U32(a0 + 16);
+//nop;
+a1 = 0x3f;
+s2 = s4;
+a0 = s4;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 4028000b gp = MEM_U32(sp + 48);
+if (v0 == 0) goto L4048d8;
+s5 = 0x3f;
+L4047e4:
+s1 = v0 + 0x1;
+t7 = MEM_U8(s1 + 0);
+//nop;
+if (s5 != t7) goto L4048bc;
+t8 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+t9 = t8 + 0xffffffdf;
+//nop;
+if (t9 >= 0x1f) goto L4048bc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L404858;
+case 1: goto L4048bc;
+case 2: goto L4048bc;
+case 3: goto L4048bc;
+case 4: goto L4048bc;
+case 5: goto L4048bc;
+case 6: goto L404848;
+case 7: goto L404830;
+case 8: goto L404840;
+case 9: goto L4048bc;
+case 10: goto L4048bc;
+case 11: goto L4048bc;
+case 12: goto L404868;
+case 13: goto L4048bc;
+case 14: goto L404838;
+case 15: goto L4048bc;
+case 16: goto L4048bc;
+case 17: goto L4048bc;
+case 18: goto L4048bc;
+case 19: goto L4048bc;
+case 20: goto L4048bc;
+case 21: goto L4048bc;
+case 22: goto L4048bc;
+case 23: goto L4048bc;
+case 24: goto L4048bc;
+case 25: goto L4048bc;
+case 26: goto L4048bc;
+case 27: goto L404850;
+case 28: goto L404828;
+case 29: goto L404860;
+case 30: goto L404870;
+}
+L404828:
+s0 = 0x23;
+goto L404878;
+L404830:
+s0 = 0x5b;
+goto L404878;
+L404838:
+s0 = 0x5c;
+goto L404878;
+L404840:
+s0 = 0x5d;
+goto L404878;
+L404848:
+s0 = 0x5e;
+goto L404878;
+L404850:
+s0 = 0x7b;
+goto L404878;
+L404858:
+s0 = 0x7c;
+goto L404878;
+L404860:
+s0 = 0x7d;
+goto L404878;
+L404868:
+s0 = 0x7e;
+goto L404878;
+L404870:
+s1 = s1 + 0xffffffff;
+goto L4048bc;
+L404878:
+a2 = s1 - s4;
+a2 = a2 + 0xfffffffe;
+s3 = a2;
+if (s2 == s4) goto L4048a8;
+if ((int)a2 <= 0) {
+s2 = s2 + s3;
+goto L4048ac;}
+//nop;
+a0 = s4;
+a1 = s2;
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 405e0003 gp = MEM_U32(sp + 48);
+L4048a8:
+s2 = s2 + s3;
+L4048ac:
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)s0;
+s4 = s1;
+L4048bc:
+//nop;
+a0 = s1;
+a1 = 0x3f;
+//nop;
+v0 = wrapper_strchr(mem, a0, a1);
+// bdead 4068000b gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4047e4;
+L4048d8:
+a3 = MEM_U32(sp + 56);
+v0 = MEM_U32(a3 + 16);
+v1 = MEM_U32(a3 + 8);
+t0 = s4 - v0;
+s3 = v1 - t0;
+if (s2 == s4) goto L40491c;
+if ((int)s3 <= 0) {
+a2 = s4 - s2;
+goto L404920;}
+//nop;
+a0 = s4;
+a1 = s2;
+a2 = s3;
+wrapper_bcopy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 56);
+// bdead 40280103 gp = MEM_U32(sp + 48);
+v0 = MEM_U32(a3 + 16);
+v1 = MEM_U32(a3 + 8);
+L40491c:
+a2 = s4 - s2;
+L404920:
+t2 = v1 - a2;
+t5 = 0x10003d48;
+MEM_U32(a3 + 8) = t2;
+t4 = v0 + t2;
+MEM_U8(t4 + 0) = (uint8_t)zero;
+t5 = MEM_U32(t5 + 0);
+if (t5 == zero) {
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L404984;}
+if (s4 == s2) {
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L404984;}
+t6 = 0x10003d3c;
+t6 = MEM_U32(t6 + 0);
+if (t6 != zero) {
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L404984;}
+//nop;
+a0 = 0x10001338;
+a0 = a0;
+a1 = (int)a2 >> 1;
+if ((int)a2 >= 0) goto L404974;
+at = a2 + 0x1;
+a1 = (int)at >> 1;
+L404974:
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+// bdead 1 ra = MEM_U32(sp + 52);
+L404984:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static uint64_t f_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4049a4:
+//newline_fix:
+t6 = MEM_U8(a0 + 0);
+t0 = 0x5c;
+v0 = zero;
+v1 = t0 ^ t6;
+if (v1 >= 0x1) {
+a2 = v0 << 1;
+goto L404a14;}
+t7 = MEM_U8(a0 + 1);
+t1 = 0xa;
+a1 = a0 + 0x2;
+a2 = t1 ^ t7;
+if (a2 >= 0x1) {
+a2 = v0 << 1;
+goto L404a14;}
+t8 = MEM_U8(a1 + 0);
+L4049e0:
+a1 = a1 + 0x1;
+v0 = v0 + 0x1;
+v1 = t0 ^ t8;
+if (v1 >= 0x1) {
+a2 = v0 << 1;
+goto L404a14;}
+t9 = MEM_U8(a1 + 0);
+a1 = a1 + 0x1;
+a2 = t1 ^ t9;
+if (a2 < 0x1) {
+t8 = MEM_U8(a1 + 0);
+goto L4049e0;}
+a2 = v0 << 1;
+L404a14:
+v1 = a2 + a0;
+t1 = 0xa;
+a1 = v1;
+if (v0 == 0) goto L404aa4;
+a3 = MEM_U8(v1 + 0);
+t2 = 0x2f;
+v1 = 0x2a;
+if (t2 == a3) {
+v0 = MEM_U8(a1 + 0);
+goto L404a44;}
+//nop;
+if (v1 != a3) goto L404aa4;
+v0 = MEM_U8(a1 + 0);
+L404a44:
+v1 = 0x2a;
+if (v1 == v0) {
+MEM_U8(a0 + 0) = (uint8_t)v0;
+goto L404a5c;}
+if (t2 != a3) {
+v1 = (int)a2 < (int)0x2;
+goto L404a7c;}
+MEM_U8(a0 + 0) = (uint8_t)v0;
+L404a5c:
+v0 = MEM_U8(a1 + 1);
+a0 = a0 + 0x1;
+a1 = a1 + 0x1;
+if (v1 == v0) {
+MEM_U8(a0 + 0) = (uint8_t)v0;
+goto L404a5c;}
+if (t2 == v0) {
+MEM_U8(a0 + 0) = (uint8_t)v0;
+goto L404a5c;}
+v1 = (int)a2 < (int)0x2;
+L404a7c:
+v1 = v1 ^ 0x1;
+a2 = a2 + 0xfffffffe;
+if (v1 == 0) goto L404aa4;
+L404a88:
+v1 = (int)a2 < (int)0x2;
+v1 = v1 ^ 0x1;
+a2 = a2 + 0xfffffffe;
+MEM_U8(a0 + 0) = (uint8_t)t0;
+MEM_U8(a0 + 1) = (uint8_t)t1;
+a0 = a0 + 0x2;
+if (v1 != 0) goto L404a88;
+L404aa4:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_name_newline_fix(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404aac:
+//name_newline_fix:
+//nop;
+//nop;
+//nop;
+t6 = MEM_U8(a0 + 0);
+a3 = 0x5c;
+v0 = zero;
+v1 = a3 ^ t6;
+if (v1 >= 0x1) {
+a2 = v0 << 1;
+goto L404b28;}
+t7 = MEM_U8(a0 + 1);
+t0 = 0xa;
+a1 = a0 + 0x2;
+a2 = t0 ^ t7;
+if (a2 >= 0x1) {
+a2 = v0 << 1;
+goto L404b28;}
+t8 = MEM_U8(a1 + 0);
+L404af4:
+a1 = a1 + 0x1;
+v0 = v0 + 0x1;
+v1 = a3 ^ t8;
+if (v1 >= 0x1) {
+a2 = v0 << 1;
+goto L404b28;}
+t9 = MEM_U8(a1 + 0);
+a1 = a1 + 0x1;
+a2 = t0 ^ t9;
+if (a2 < 0x1) {
+t8 = MEM_U8(a1 + 0);
+goto L404af4;}
+a2 = v0 << 1;
+L404b28:
+v1 = a2 + a0;
+t0 = 0xa;
+a1 = v1;
+if (v0 == 0) goto L404ba8;
+t1 = 0x10003dc8;
+t2 = MEM_U8(v1 + 0);
+t3 = t1 + t2;
+v0 = MEM_U8(t3 + 0);
+//nop;
+if (v0 == 0) goto L404ba8;
+if (v0 == zero) {
+v1 = (int)a2 < (int)0x2;
+goto L404b80;}
+v0 = MEM_U8(v1 + 0);
+MEM_U8(a0 + 0) = (uint8_t)v0;
+L404b60:
+v0 = MEM_U8(a1 + 1);
+a0 = a0 + 0x1;
+a1 = a1 + 0x1;
+t4 = t1 + v0;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+MEM_U8(a0 + 0) = (uint8_t)v0;
+goto L404b60;}
+v1 = (int)a2 < (int)0x2;
+L404b80:
+v1 = v1 ^ 0x1;
+a2 = a2 + 0xfffffffe;
+if (v1 == 0) goto L404ba8;
+L404b8c:
+v1 = (int)a2 < (int)0x2;
+v1 = v1 ^ 0x1;
+a2 = a2 + 0xfffffffe;
+MEM_U8(a0 + 0) = (uint8_t)a3;
+MEM_U8(a0 + 1) = (uint8_t)t0;
+a0 = a0 + 0x2;
+if (v1 != 0) goto L404b8c;
+L404ba8:
+//nop;
+return v0;
+}
+
+static void f_rescan(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+uint64_t temp64;
+L404bb0:
+//rescan:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff60;
+t6 = 0x10003d50;
+// fdead 4000806b MEM_U32(sp + 56) = fp;
+// fdead 4000806b MEM_U32(sp + 44) = s6;
+t6 = MEM_U32(t6 + 0);
+s6 = a0;
+// fdead 4080806b MEM_U32(sp + 60) = ra;
+// fdead 4080806b MEM_U32(sp + 52) = gp;
+// fdead 4080806b MEM_U32(sp + 48) = s7;
+// fdead 4080806b MEM_U32(sp + 40) = s5;
+// fdead 4080806b MEM_U32(sp + 36) = s4;
+// fdead 4080806b MEM_U32(sp + 32) = s3;
+// fdead 4080806b MEM_U32(sp + 28) = s2;
+// fdead 4080806b MEM_U32(sp + 24) = s1;
+// fdead 4080806b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 164) = a1;
+fp = zero;
+MEM_U32(sp + 148) = zero;
+MEM_U32(sp + 128) = zero;
+if (t6 == 0) goto L404c48;
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a0 = t8 + t9;
+t4 = MEM_U32(a0 + 0);
+//nop;
+if (t4 == 0) goto L404c48;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0800183 gp = MEM_U32(sp + 52);
+L404c48:
+t5 = 0x10002cf0;
+t7 = 0x10005ec0;
+s1 = MEM_U32(s6 + 20);
+t5 = MEM_U32(t5 + 0);
+t4 = MEM_U32(s6 + 8);
+t6 = t5 << 3;
+t6 = t6 + t5;
+t6 = t6 << 2;
+s4 = t6 + t7;
+t8 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t8 + t9;
+t6 = s1 - t5;
+t7 = t4 - t6;
+s2 = t2 - s0;
+at = (int)s2 < (int)t7;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L404cb8;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0aa0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+L404cb8:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+t8 = MEM_U8(t2 + 0);
+if (t8 == zero) {
+v1 = MEM_U8(s0 + 0);
+goto L404ce8;}
+//nop;
+MEM_U32(sp + 136) = t2;
+//nop;
+wrapper_abort(mem);
+// bdead c0ae0183 gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 136);
+v1 = MEM_U8(s0 + 0);
+L404ce8:
+s5 = 0xa;
+t3 = 0x5c;
+t1 = 0x2a;
+t0 = 0x2f;
+L404cf8:
+s3 = v1 & 0xff;
+at = s3 < 0x7b;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U8(s1 + 0) = (uint8_t)s3;
+s1 = s1 + 0x1;
+if (at == 0) goto L405ab0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (s3) {
+case 0: goto L405938;
+case 1: goto L405ab0;
+case 2: goto L405ab0;
+case 3: goto L405ab0;
+case 4: goto L405ab0;
+case 5: goto L405ab0;
+case 6: goto L405ab0;
+case 7: goto L405ab0;
+case 8: goto L405ab0;
+case 9: goto L405ab0;
+case 10: goto L405790;
+case 11: goto L405ab0;
+case 12: goto L405ab0;
+case 13: goto L405ab0;
+case 14: goto L405ab0;
+case 15: goto L405ab0;
+case 16: goto L405ab0;
+case 17: goto L405ab0;
+case 18: goto L405ab0;
+case 19: goto L405ab0;
+case 20: goto L405ab0;
+case 21: goto L405ab0;
+case 22: goto L405ab0;
+case 23: goto L405ab0;
+case 24: goto L405ab0;
+case 25: goto L405ab0;
+case 26: goto L405ab0;
+case 27: goto L405ab0;
+case 28: goto L405ab0;
+case 29: goto L405ab0;
+case 30: goto L405ab0;
+case 31: goto L405ab0;
+case 32: goto L405ab0;
+case 33: goto L405ab0;
+case 34: goto L4050a8;
+case 35: goto L404d88;
+case 36: goto L4056a0;
+case 37: goto L405ab0;
+case 38: goto L405ab0;
+case 39: goto L4050a8;
+case 40: goto L405ab0;
+case 41: goto L405ab0;
+case 42: goto L405ab0;
+case 43: goto L405ab0;
+case 44: goto L405ab0;
+case 45: goto L405ab0;
+case 46: goto L405ab0;
+case 47: goto L405350;
+case 48: goto L4056b8;
+case 49: goto L4056b8;
+case 50: goto L4056b8;
+case 51: goto L4056b8;
+case 52: goto L4056b8;
+case 53: goto L4056b8;
+case 54: goto L4056b8;
+case 55: goto L4056b8;
+case 56: goto L4056b8;
+case 57: goto L4056b8;
+case 58: goto L405ab0;
+case 59: goto L405ab0;
+case 60: goto L405ab0;
+case 61: goto L405ab0;
+case 62: goto L405ab0;
+case 63: goto L405ab0;
+case 64: goto L405ab0;
+case 65: goto L405778;
+case 66: goto L405778;
+case 67: goto L405778;
+case 68: goto L405778;
+case 69: goto L405778;
+case 70: goto L405778;
+case 71: goto L405778;
+case 72: goto L405778;
+case 73: goto L405778;
+case 74: goto L405778;
+case 75: goto L405778;
+case 76: goto L405778;
+case 77: goto L405778;
+case 78: goto L405778;
+case 79: goto L405778;
+case 80: goto L405778;
+case 81: goto L405778;
+case 82: goto L405778;
+case 83: goto L405778;
+case 84: goto L405778;
+case 85: goto L405778;
+case 86: goto L405778;
+case 87: goto L405778;
+case 88: goto L405778;
+case 89: goto L405778;
+case 90: goto L405778;
+case 91: goto L405ab0;
+case 92: goto L404d30;
+case 93: goto L405ab0;
+case 94: goto L405ab0;
+case 95: goto L405778;
+case 96: goto L405ab0;
+case 97: goto L405778;
+case 98: goto L405778;
+case 99: goto L405778;
+case 100: goto L405778;
+case 101: goto L405778;
+case 102: goto L405778;
+case 103: goto L405778;
+case 104: goto L405778;
+case 105: goto L405778;
+case 106: goto L405778;
+case 107: goto L405778;
+case 108: goto L405778;
+case 109: goto L405778;
+case 110: goto L405778;
+case 111: goto L405778;
+case 112: goto L405778;
+case 113: goto L405778;
+case 114: goto L405778;
+case 115: goto L405778;
+case 116: goto L405778;
+case 117: goto L405778;
+case 118: goto L405778;
+case 119: goto L405778;
+case 120: goto L405778;
+case 121: goto L405778;
+case 122: goto L405778;
+}
+L404d30:
+//nop;
+if (s0 >= t2) goto L405f48;
+v1 = MEM_U8(s0 + 0);
+//nop;
+if (s5 != v1) goto L404d64;
+t5 = MEM_U32(s4 + 4);
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+t4 = t5 + 0x1;
+MEM_U32(s4 + 4) = t4;
+s1 = s1 + 0xffffffff;
+goto L405f48;
+L404d64:
+t6 = 0x1;
+if ((int)fp <= 0) goto L404d74;
+MEM_U32(sp + 128) = t6;
+goto L405aa4;
+L404d74:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L405f48;
+L404d88:
+t7 = MEM_U32(s4 + 24);
+//nop;
+if (t7 != 0) goto L405ab0;
+t9 = MEM_U32(sp + 116);
+if (fp == 0) goto L404da8;
+t8 = 0x1;
+MEM_U32(sp + 128) = t8;
+goto L405aa4;
+L404da8:
+//nop;
+if (t9 == 0) goto L405ab0;
+a0 = 0x10003d20;
+v0 = MEM_U32(sp + 116);
+a0 = MEM_U32(a0 + 0);
+L404dbc:
+v1 = MEM_U8(v0 + 0);
+L404dc0:
+t5 = 0x10003fc8;
+t4 = v1 + t5;
+t6 = MEM_U8(t4 + 0);
+//nop;
+if (t6 == 0) goto L404ddc;
+v0 = v0 + 0x1;
+goto L404dbc;
+L404ddc:
+//nop;
+if (t3 != v1) goto L404df8;
+t7 = MEM_U8(v0 + 1);
+//nop;
+if (s5 != t7) goto L404df8;
+v0 = v0 + 0x2;
+goto L404dbc;
+L404df8:
+//nop;
+if (t0 != v1) goto L404e4c;
+t8 = MEM_U8(v0 + 1);
+//nop;
+if (t1 != t8) goto L404e4c;
+t9 = MEM_U8(v0 + 2);
+v0 = v0 + 0x2;
+if (t1 != t9) {
+t4 = MEM_U8(v0 + 1);
+goto L404e2c;}
+t5 = MEM_U8(v0 + 1);
+//nop;
+if (t0 == t5) goto L404e44;
+t4 = MEM_U8(v0 + 1);
+L404e2c:
+v0 = v0 + 0x1;
+if (t1 != t4) {
+t4 = MEM_U8(v0 + 1);
+goto L404e2c;}
+t6 = MEM_U8(v0 + 1);
+if (t0 != t6) {
+t4 = MEM_U8(v0 + 1);
+goto L404e2c;}
+L404e44:
+v0 = v0 + 0x2;
+goto L404dbc;
+L404e4c:
+if (a0 == zero) {
+t5 = v0 + 0x1;
+goto L404ea4;}
+if (t0 != v1) {
+t5 = v0 + 0x1;
+goto L404ea4;}
+t7 = MEM_U8(v0 + 1);
+if (t0 != t7) {
+t5 = v0 + 0x1;
+goto L404ea4;}
+t8 = MEM_U8(v0 + 2);
+v0 = v0 + 0x3;
+a1 = s5 ^ t8;
+if (zero >= a1) {
+v1 = MEM_U8(v0 + 0);
+goto L404dc0;}
+t9 = MEM_U8(v0 + 0);
+L404e84:
+v0 = v0 + 0x1;
+a1 = s5 ^ t9;
+if (zero < a1) {
+t9 = MEM_U8(v0 + 0);
+goto L404e84;}
+v1 = MEM_U8(v0 + 0);
+goto L404dc0;
+// fdead 0 t5 = v0 + 0x1;
+L404ea4:
+//nop;
+if (t5 != s0) goto L405ab0;
+s1 = s1 + 0xffffffff;
+MEM_U32(s4 + 20) = s0;
+MEM_U32(s6 + 20) = s1;
+//nop;
+MEM_U32(sp + 136) = t2;
+a0 = s4;
+a1 = s6;
+v0 = f_handle_directive(mem, sp, a0, a1, a2, a3);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+if (v0 != 0) goto L404fc8;
+t4 = 0x10003d50;
+t4 = MEM_U32(t4 + 0);
+//nop;
+if (t4 == 0) goto L404fc0;
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+a0 = t7 + t8;
+t9 = MEM_U32(a0 + 0);
+//nop;
+if (t9 == 0) goto L404fc0;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0c40183 gp = MEM_U32(sp + 52);
+t9 = MEM_U32(s6 + 8);
+t0 = 0x2f;
+t5 = 0x10002cf0;
+t6 = 0x10005ec0;
+t1 = 0x2a;
+t5 = MEM_U32(t5 + 0);
+t3 = 0x5c;
+t4 = t5 << 3;
+t4 = t4 + t5;
+t4 = t4 << 2;
+s4 = t4 + t6;
+t7 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t7 + t8;
+t4 = s1 - t5;
+t6 = t9 - t4;
+s2 = t2 - s0;
+at = (int)s2 < (int)t6;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L404fb4;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L404fb4:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+goto L405f48;
+L404fc0:
+s1 = s1 + 0x1;
+goto L405ab0;
+L404fc8:
+t7 = 0x10003d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L405020;
+t8 = 0x10002cf0;
+t9 = 0x10005ec0;
+t8 = MEM_U32(t8 + 0);
+t5 = t8 << 3;
+t5 = t5 + t8;
+t5 = t5 << 2;
+a0 = t5 + t9;
+t4 = MEM_U32(a0 + 0);
+//nop;
+if (t4 == 0) goto L405020;
+//nop;
+a1 = 0x1;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0c00183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405020:
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+s1 = MEM_U32(s6 + 20);
+t6 = MEM_U32(t6 + 0);
+t4 = MEM_U32(s6 + 8);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+s4 = t7 + t8;
+t5 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+t6 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t5 + t9;
+t7 = s1 - t6;
+t8 = t4 - t7;
+s2 = t2 - s0;
+at = (int)s2 < (int)t8;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L40509c;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L40509c:
+s1 = MEM_U32(s6 + 20);
+MEM_U32(sp + 116) = s0;
+goto L405f48;
+L4050a8:
+t5 = 0x1;
+if (fp == 0) goto L4050b8;
+MEM_U32(sp + 128) = t5;
+goto L405aa4;
+L4050b8:
+t9 = MEM_U32(s4 + 4);
+MEM_U32(sp + 120) = t9;
+L4050c0:
+at = s0 < t2;
+L4050c4:
+t4 = 0x17;
+if (at != 0) goto L4051ec;
+t6 = 0x10003d4c;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L4051a8;
+v0 = MEM_U32(s4 + 24);
+//nop;
+if (v0 == 0) goto L405f48;
+MEM_U32(sp + 116) = zero;
+MEM_U32(v0 + 12) = t4;
+a0 = MEM_U32(s4 + 32);
+//nop;
+if (a0 == 0) goto L405118;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c0d40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405118:
+v0 = 0x10002cf0;
+t5 = 0x10002cf0;
+t6 = 0x10005ec0;
+t7 = MEM_U32(v0 + 0);
+t8 = t7 + 0xffffffff;
+MEM_U32(v0 + 0) = t8;
+t5 = MEM_U32(t5 + 0);
+t8 = MEM_U32(s6 + 8);
+t9 = t5 << 3;
+t9 = t9 + t5;
+t9 = t9 << 2;
+s4 = t9 + t6;
+t4 = MEM_U32(s4 + 16);
+t7 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t4 + t7;
+t9 = s1 - t5;
+t6 = t8 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t6;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L4051a0;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0fa0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L4051a0:
+s1 = MEM_U32(s6 + 20);
+goto L4050c0;
+L4051a8:
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = 0x10001354;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+goto L405f48;
+L4051ec:
+t4 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s1 + -1) = (uint8_t)t4;
+a1 = MEM_U8(s0 + -1);
+s2 = s2 + 0xffffffff;
+at = 0x22;
+if (a1 == s5) {
+t7 = MEM_U32(s4 + 4);
+goto L405234;}
+if (a1 == at) {
+at = 0x27;
+goto L40533c;}
+at = 0x27;
+if (a1 == at) {
+t7 = MEM_U8(s0 + -1);
+goto L405340;}
+at = s0 < t2;
+if (a1 == t3) goto L4052b8;
+at = s0 < t2;
+goto L4050c4;
+// fdead 0 t7 = MEM_U32(s4 + 4);
+L405234:
+t6 = 0x10003d4c;
+at = 0x27;
+t5 = t7 + 0x1;
+MEM_U32(s4 + 4) = t5;
+t8 = MEM_U32(s6 + 4);
+t9 = t8 + 0x1;
+MEM_U32(s6 + 4) = t9;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 != 0) goto L405f48;
+t4 = 0x10003d38;
+t4 = MEM_U32(t4 + 0);
+//nop;
+if (t4 != 0) goto L405274;
+if (s3 != at) {
+at = s0 < t2;
+goto L4050c4;}
+L405274:
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = 0x10001380;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+goto L405f48;
+L4052b8:
+if (at == zero) {
+at = s0 < t2;
+goto L4050c4;}
+v1 = MEM_U8(s0 + 0);
+//nop;
+if (s5 != v1) goto L4052e8;
+t7 = MEM_U32(s4 + 4);
+s1 = s1 + 0xffffffff;
+s0 = s0 + 0x1;
+t5 = t7 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U32(s4 + 4) = t5;
+goto L4050c0;
+L4052e8:
+if (t3 != v1) {
+MEM_U8(s1 + 0) = (uint8_t)v1;
+goto L40532c;}
+t8 = MEM_U8(s0 + 1);
+if (s5 != t8) {
+MEM_U8(s1 + 0) = (uint8_t)v1;
+goto L40532c;}
+t9 = MEM_U32(s4 + 4);
+L405300:
+s0 = s0 + 0x2;
+s2 = s2 + 0xfffffffe;
+t6 = t9 + 0x1;
+MEM_U32(s4 + 4) = t6;
+v1 = MEM_U8(s0 + 0);
+if (t3 != v1) {
+MEM_U8(s1 + 0) = (uint8_t)v1;
+goto L40532c;}
+t4 = MEM_U8(s0 + 1);
+if (s5 == t4) {
+t9 = MEM_U32(s4 + 4);
+goto L405300;}
+MEM_U8(s1 + 0) = (uint8_t)v1;
+L40532c:
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L4050c0;
+L40533c:
+t7 = MEM_U8(s0 + -1);
+L405340:
+if (s3 != t7) {
+at = s0 < t2;
+goto L4050c4;}
+//nop;
+goto L405f48;
+L405350:
+v1 = MEM_U8(s0 + 0);
+//nop;
+if (t3 != v1) goto L405394;
+t5 = MEM_U8(s0 + 1);
+//nop;
+if (s5 != t5) goto L405394;
+//nop;
+a0 = s0;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+v1 = MEM_U8(s0 + 0);
+L405394:
+t8 = 0x10003d20;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 == 0) goto L405464;
+//nop;
+if (t0 != v1) goto L405464;
+t9 = 0x10002ce0;
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+t9 = MEM_U32(t9 + 0);
+s1 = s1 + 0xffffffff;
+t6 = 0x20;
+at = s0 < t2;
+if (t9 != 0) goto L4053d8;
+MEM_U8(s1 + 0) = (uint8_t)t6;
+s1 = s1 + 0x1;
+goto L4053e4;
+L4053d8:
+MEM_U8(s1 + 0) = (uint8_t)t0;
+MEM_U8(s1 + 1) = (uint8_t)t0;
+s1 = s1 + 0x2;
+L4053e4:
+a0 = s0 + 0x2;
+if (at == 0) goto L405f48;
+t4 = MEM_U8(s0 + 0);
+L4053f0:
+s0 = s0 + 0x1;
+at = s0 < t2;
+a1 = s5 ^ t4;
+s2 = s2 + 0xffffffff;
+if (a1 >= 0x1) goto L405454;
+t7 = 0x10002ce0;
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+t7 = MEM_U32(t7 + 0);
+a1 = s1;
+//nop;
+if (t7 == 0) goto L405f48;
+//nop;
+s3 = s0 - a0;
+a2 = s3;
+MEM_U32(sp + 136) = t2;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c0fe0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+s1 = s1 + s3;
+goto L405f48;
+L405454:
+if (at != zero) {
+t4 = MEM_U8(s0 + 0);
+goto L4053f0;}
+//nop;
+goto L405f48;
+L405464:
+//nop;
+if (t1 != v1) goto L405ab0;
+t5 = MEM_U32(s4 + 24);
+//nop;
+if (t5 != 0) goto L405ab0;
+t8 = 0x1;
+if (fp == 0) goto L405488;
+MEM_U32(sp + 128) = t8;
+goto L405aa4;
+L405488:
+t6 = 0x10002ce0;
+t9 = MEM_U32(s4 + 4);
+s0 = s0 + 0x1;
+t6 = MEM_U32(t6 + 0);
+s2 = s2 + 0xffffffff;
+at = s0 < t2;
+MEM_U32(sp + 120) = t9;
+if (t6 != 0) goto L4054cc;
+t4 = 0x10003d4c;
+t7 = 0x20;
+t4 = MEM_U32(t4 + 0);
+//nop;
+if (t4 == 0) goto L4054c4;
+s1 = s1 + 0xffffffff;
+goto L4054d4;
+L4054c4:
+MEM_U8(s1 + -1) = (uint8_t)t7;
+goto L4054d4;
+L4054cc:
+MEM_U8(s1 + 0) = (uint8_t)t1;
+s1 = s1 + 0x1;
+L4054d4:
+s7 = s0;
+if (at == 0) goto L405600;
+a1 = MEM_U8(s0 + 0);
+L4054e0:
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (a1 == s5) {
+t5 = MEM_U32(s4 + 4);
+goto L4055c8;}
+if (a1 == t1) {
+t6 = MEM_U8(s0 + 0);
+goto L405568;}
+if (a1 != t0) {
+at = s0 < t2;
+goto L4055f8;}
+t5 = 0x10003d44;
+at = s0 < t2;
+t5 = MEM_U32(t5 + 0);
+if (t5 == zero) {
+at = s0 < t2;
+goto L4055f8;}
+if (at == zero) {
+at = s0 < t2;
+goto L4055f8;}
+t8 = MEM_U8(s0 + 0);
+if (t1 != t8) {
+at = s0 < t2;
+goto L4055f8;}
+t9 = 0x10003d3c;
+t9 = MEM_U32(t9 + 0);
+if (t9 != zero) {
+at = s0 < t2;
+goto L4055f8;}
+//nop;
+a0 = 0x100013ac;
+MEM_U32(sp + 136) = t2;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+goto L4055f4;
+// fdead 0 t6 = MEM_U8(s0 + 0);
+L405568:
+if (t3 != t6) {
+at = s0 < t2;
+goto L4055a8;}
+t4 = MEM_U8(s0 + 1);
+if (s5 != t4) {
+at = s0 < t2;
+goto L4055a8;}
+//nop;
+a0 = s0;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+at = s0 < t2;
+L4055a8:
+if (at == zero) {
+at = s0 < t2;
+goto L405604;}
+t7 = MEM_U8(s0 + 0);
+if (t0 != t7) {
+at = s0 < t2;
+goto L4055f8;}
+at = s0 < t2;
+goto L405604;
+// fdead 0 t5 = MEM_U32(s4 + 4);
+L4055c8:
+t9 = 0x10002ce0;
+t8 = t5 + 0x1;
+MEM_U32(s4 + 4) = t8;
+t9 = MEM_U32(t9 + 0);
+if (t9 != zero) {
+t6 = MEM_U32(s6 + 4);
+goto L4055ec;}
+MEM_U8(s1 + 0) = (uint8_t)s5;
+s1 = s1 + 0x1;
+t6 = MEM_U32(s6 + 4);
+L4055ec:
+t4 = t6 + 0x1;
+MEM_U32(s6 + 4) = t4;
+L4055f4:
+at = s0 < t2;
+L4055f8:
+if (at != zero) {
+a1 = MEM_U8(s0 + 0);
+goto L4054e0;}
+L405600:
+at = s0 < t2;
+L405604:
+//nop;
+if (at != 0) goto L405650;
+//nop;
+a0 = MEM_U32(sp + 120);
+MEM_U32(sp + 136) = t2;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead c0ee018b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = 0x100013c0;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+goto L405f48;
+L405650:
+t7 = 0x10002ce0;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+t7 = MEM_U32(t7 + 0);
+a0 = s7;
+a1 = s1;
+//nop;
+if (t7 == 0) goto L405f48;
+//nop;
+s3 = s0 - s7;
+a2 = s3;
+MEM_U32(sp + 136) = t2;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c0fe0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+s1 = s1 + s3;
+goto L405f48;
+L4056a0:
+t5 = 0x10002e70;
+t5 = MEM_U32(t5 + 0);
+if (t5 != zero) {
+t5 = MEM_U32(sp + 148);
+goto L40577c;}
+//nop;
+goto L405ab0;
+L4056b8:
+at = s0 < t2;
+if (fp != 0) goto L405778;
+//nop;
+if (s0 >= t2) goto L405f48;
+s3 = MEM_U8(s0 + 0);
+L4056cc:
+t8 = 0xfb4cba0;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+v0 = s3 + t8;
+t9 = MEM_U8(v0 + 1);
+at = 0x2e;
+t6 = t9 & 0x7;
+//nop;
+if (t6 != 0) goto L40570c;
+if (s3 == at) {
+at = 0x5f;
+goto L40570c;}
+at = 0x5f;
+//nop;
+if (s3 == at) goto L40570c;
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+goto L405f48;
+L40570c:
+t4 = 0xfb4cba0;
+MEM_U8(s1 + 0) = (uint8_t)s3;
+s1 = s1 + 0x1;
+t4 = t4 + 0x65;
+at = s0 < t2;
+if (v0 == t4) goto L405734;
+t7 = 0xfb4cba0;
+t7 = t7 + 0x45;
+if (v0 != t7) {
+at = s0 < t2;
+goto L405768;}
+L405734:
+if (at == zero) {
+at = s0 < t2;
+goto L405768;}
+v1 = MEM_U8(s0 + 0);
+at = 0x2b;
+if (v1 == at) {
+at = 0x2d;
+goto L405754;}
+at = 0x2d;
+if (v1 != at) {
+at = s0 < t2;
+goto L405768;}
+L405754:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+at = s0 < t2;
+L405768:
+if (at != zero) {
+s3 = MEM_U8(s0 + 0);
+goto L4056cc;}
+//nop;
+goto L405f48;
+L405778:
+t5 = MEM_U32(sp + 148);
+L40577c:
+fp = fp + 0x1;
+t8 = t5 << 2;
+t9 = t8 + s3;
+MEM_U32(sp + 148) = t9;
+goto L405f48;
+L405790:
+t6 = MEM_U32(s4 + 24);
+//nop;
+if (t6 == 0) goto L405868;
+v1 = MEM_U8(s0 + 0);
+at = 0x2d;
+//nop;
+if (v1 != at) goto L4057dc;
+t4 = MEM_U32(sp + 164);
+fp = zero;
+MEM_U32(sp + 148) = zero;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (t4 != 0) goto L4057cc;
+s1 = s1 + 0xffffffff;
+goto L405f48;
+L4057cc:
+t7 = 0x2d;
+MEM_U8(s1 + 0) = (uint8_t)t7;
+s1 = s1 + 0x1;
+goto L405f48;
+L4057dc:
+t5 = 0x100040c8;
+t8 = v1 + t5;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L405840;
+t4 = MEM_U32(sp + 164);
+if ((int)fp <= 0) goto L405804;
+t6 = 0x1;
+MEM_U32(sp + 128) = t6;
+goto L405aa4;
+L405804:
+t7 = v1 & 0xff;
+if (t4 != 0) goto L40582c;
+MEM_U8(s1 + -1) = (uint8_t)v1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s5 != t7) goto L405f48;
+t5 = MEM_U32(s6 + 4);
+t8 = t5 + 0x1;
+MEM_U32(s6 + 4) = t8;
+goto L405f48;
+L40582c:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L405f48;
+L405840:
+//nop;
+MEM_U32(sp + 136) = t2;
+//nop;
+wrapper_abort(mem);
+// bdead c0ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+goto L405f48;
+L405868:
+t9 = 0x1;
+if ((int)fp <= 0) goto L405878;
+MEM_U32(sp + 128) = t9;
+goto L405aa4;
+L405878:
+MEM_U32(sp + 116) = s0;
+t6 = MEM_U32(s4 + 4);
+a0 = s4;
+a1 = s6;
+t4 = t6 + 0x1;
+MEM_U32(s4 + 4) = t4;
+t7 = MEM_U32(s6 + 4);
+t5 = t7 + 0x1;
+MEM_U32(s6 + 4) = t5;
+t9 = MEM_U32(s4 + 4);
+//nop;
+if (t5 == t9) goto L405f48;
+MEM_U32(s6 + 20) = s1;
+//nop;
+MEM_U32(sp + 136) = t2;
+a2 = 0x1;
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U32(s4 + 20);
+t4 = MEM_U32(s4 + 16);
+v1 = MEM_U32(s6 + 20);
+t9 = MEM_U32(s6 + 16);
+t5 = MEM_U32(s4 + 8);
+t8 = MEM_U32(s6 + 8);
+t7 = t6 - t4;
+t6 = v1 - t9;
+a1 = t5 - t7;
+t4 = t8 - t6;
+at = (int)a1 < (int)t4;
+// bdead c0ea01d7 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+if (at != 0) goto L405930;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+v1 = MEM_U32(s6 + 20);
+L405930:
+s1 = v1;
+goto L405f48;
+L405938:
+//nop;
+if (t2 >= s0) goto L405ab0;
+v0 = MEM_U32(s4 + 24);
+//nop;
+if (v0 == 0) goto L405a80;
+t5 = 0x10003d4c;
+s1 = s1 + 0xffffffff;
+s0 = s0 + 0xffffffff;
+t5 = MEM_U32(t5 + 0);
+s2 = s2 + 0x1;
+if (t5 == zero) {
+MEM_U32(sp + 116) = zero;
+goto L4059bc;}
+if (fp == zero) {
+MEM_U32(sp + 116) = zero;
+goto L4059bc;}
+t7 = 0x10002cf0;
+t8 = 0x10005ec0;
+t7 = MEM_U32(t7 + 0);
+t9 = t7 << 3;
+t9 = t9 + t7;
+t9 = t9 << 2;
+t6 = t9 + t8;
+t4 = MEM_U32(t6 + -16);
+t7 = 0x10003dc8;
+t6 = 0x1;
+t5 = MEM_U8(t4 + 0);
+t9 = t5 + t7;
+t8 = MEM_U8(t9 + 0);
+if (t8 != zero) {
+MEM_U32(sp + 116) = zero;
+goto L4059bc;}
+MEM_U32(sp + 128) = t6;
+goto L405ab0;
+// fdead 0 MEM_U32(sp + 116) = zero;
+L4059bc:
+t4 = 0x17;
+MEM_U32(v0 + 12) = t4;
+a0 = MEM_U32(s4 + 32);
+//nop;
+if (a0 == 0) goto L4059ec;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c0c40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L4059ec:
+t5 = 0x10002cf0;
+at = 0x10002cf0;
+t9 = 0x10002cf0;
+t5 = MEM_U32(t5 + 0);
+t6 = 0x10005ec0;
+t7 = t5 + 0xffffffff;
+MEM_U32(at + 0) = t7;
+t9 = MEM_U32(t9 + 0);
+t7 = MEM_U32(s6 + 8);
+t8 = t9 << 3;
+t8 = t8 + t9;
+t8 = t8 << 2;
+s4 = t8 + t6;
+t4 = MEM_U32(s4 + 16);
+t5 = MEM_U32(s4 + 8);
+t9 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t4 + t5;
+t8 = s1 - t9;
+t6 = t7 - t8;
+s2 = t2 - s0;
+at = (int)s2 < (int)t6;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405a78;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0ea0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L405a78:
+s1 = MEM_U32(s6 + 20);
+goto L405f48;
+L405a80:
+if (fp != zero) {
+t4 = 0x1;
+goto L405aa0;}
+s1 = s1 + 0xffffffff;
+s0 = s0 + 0xffffffff;
+MEM_U32(s6 + 20) = s1;
+MEM_U32(s4 + 20) = s0;
+goto L405f50;
+t4 = 0x1;
+L405aa0:
+MEM_U32(sp + 128) = t4;
+L405aa4:
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+s1 = s1 + 0xffffffff;
+L405ab0:
+t5 = MEM_U32(sp + 148);
+if ((int)fp <= 0) goto L405f48;
+at = 0x7fff0000;
+at = at | 0xffff;
+t9 = t5 & at;
+at = 0x57b;
+lo = (int)t9 / (int)at; hi = (int)t9 % (int)at;
+t6 = 0x100048d0;
+t7 = hi;
+t8 = t7 << 2;
+t4 = t8 + t6;
+s7 = MEM_U32(t4 + 0);
+MEM_U32(sp + 148) = zero;
+if (s7 == zero) {
+fp = zero;
+goto L405f44;}
+t5 = MEM_U32(s7 + 16);
+L405af0:
+v1 = fp;
+a3 = s1 - fp;
+t9 = MEM_U32(sp + 128);
+if (fp != t5) goto L405f34;
+a0 = MEM_U32(s7 + 20);
+a2 = a3;
+v0 = a3;
+if (t9 != 0) goto L405b14;
+v0 = a2 + 0xffffffff;
+L405b14:
+t7 = MEM_U8(a0 + 0);
+L405b18:
+t8 = MEM_U8(v0 + 0);
+a0 = a0 + 0x1;
+v0 = v0 + 0x1;
+a1 = t7 ^ t8;
+v1 = v1 + 0xffffffff;
+if (zero < a1) goto L405f34;
+if (v1 != zero) {
+t7 = MEM_U8(a0 + 0);
+goto L405b18;}
+t6 = MEM_U32(sp + 128);
+at = 0x17;
+if (t6 != zero) {
+t4 = MEM_U32(s6 + 4);
+goto L405b60;}
+s0 = s0 + 0xffffffff;
+s2 = s2 + 0x1;
+s1 = s1 + 0xffffffff;
+a2 = a3 + 0xffffffff;
+t4 = MEM_U32(s6 + 4);
+L405b60:
+fp = a2;
+t5 = MEM_U32(sp + 164);
+MEM_U32(sp + 92) = t4;
+v1 = MEM_U32(s7 + 12);
+a0 = v1 ^ 0x18;
+a0 = a0 < 0x1;
+// bdead c1ee5fb7 v0 = a0;
+if (a0 == 0) goto L405be8;
+if (t5 == zero) {
+fp = zero;
+goto L405f44;}
+t9 = MEM_U32(s6 + 20);
+t7 = MEM_U32(s6 + 16);
+t6 = MEM_U32(s6 + 8);
+a1 = s2 + 0x2;
+t8 = t9 - t7;
+t4 = t6 - t8;
+if ((int)a1 < (int)t4) {
+t5 = 0x2d;
+goto L405bd8;}
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40ee0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+t5 = 0x2d;
+L405bd8:
+MEM_U8(s1 + 0) = (uint8_t)s5;
+MEM_U8(s1 + 1) = (uint8_t)t5;
+s1 = s1 + 0x2;
+goto L405f40;
+L405be8:
+if (v1 == at) {
+t9 = MEM_U32(s7 + 24);
+goto L405bfc;}
+if (a0 == zero) {
+t5 = MEM_U32(sp + 92);
+goto L405e7c;}
+t9 = MEM_U32(s7 + 24);
+L405bfc:
+t7 = MEM_U32(t9 + 0);
+if ((int)t7 < 0) {
+t5 = MEM_U32(sp + 92);
+goto L405e7c;}
+L405c08:
+if (s0 != t2) {
+v1 = MEM_U8(s0 + 0);
+goto L405cf8;}
+L405c10:
+v0 = MEM_U32(s4 + 24);
+t6 = 0x17;
+if (v0 == zero) {
+v1 = MEM_U8(s0 + 0);
+goto L405cf8;}
+MEM_U32(sp + 116) = zero;
+MEM_U32(v0 + 12) = t6;
+a0 = MEM_U32(s4 + 32);
+s3 = s1;
+//nop;
+if (a0 == 0) goto L405c54;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead c1d40183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t3 = 0x5c;
+L405c54:
+v0 = 0x10002cf0;
+t5 = 0x10002cf0;
+t7 = 0x10005ec0;
+t8 = MEM_U32(v0 + 0);
+t4 = t8 + 0xffffffff;
+MEM_U32(v0 + 0) = t4;
+t5 = MEM_U32(t5 + 0);
+t4 = MEM_U32(s6 + 8);
+t9 = t5 << 3;
+t9 = t9 + t5;
+t9 = t9 << 2;
+s4 = t9 + t7;
+t6 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t5 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t6 + t8;
+t9 = s1 - t5;
+t7 = t4 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t7;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405cdc;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L405cdc:
+s1 = MEM_U32(s6 + 20);
+//nop;
+if (s1 == s3) goto L405c08;
+fp = fp - s3;
+fp = fp + s1;
+if (s0 == t2) goto L405c10;
+v1 = MEM_U8(s0 + 0);
+L405cf8:
+//nop;
+if (t0 != v1) goto L405dac;
+v0 = t2 + 0xffffffff;
+//nop;
+if (s0 == v0) goto L405dac;
+t6 = MEM_U8(s0 + 1);
+//nop;
+if (t1 != t6) goto L405dac;
+s0 = s0 + 0x2;
+MEM_U8(s1 + 0) = (uint8_t)t0;
+MEM_U8(s1 + 1) = (uint8_t)t1;
+s1 = s1 + 0x2;
+s2 = s2 + 0xfffffffe;
+if (s0 == v0) goto L405d94;
+v1 = MEM_U8(s0 + 0);
+//nop;
+if (t1 != v1) goto L405d48;
+t8 = MEM_U8(s0 + 1);
+if (t0 == t8) {
+s0 = s0 + 0x2;
+goto L405d98;}
+L405d48:
+s2 = s2 + 0xffffffff;
+if (s5 != v1) goto L405d6c;
+t5 = MEM_U32(s4 + 4);
+t4 = t5 + 0x1;
+MEM_U32(s4 + 4) = t4;
+t9 = MEM_U32(s6 + 4);
+t7 = t9 + 0x1;
+MEM_U32(s6 + 4) = t7;
+v1 = MEM_U8(s0 + 0);
+L405d6c:
+s0 = s0 + 0x1;
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+if (s0 == v0) goto L405d94;
+v1 = MEM_U8(s0 + 0);
+//nop;
+if (t1 != v1) goto L405d48;
+t6 = MEM_U8(s0 + 1);
+//nop;
+if (t0 != t6) goto L405d48;
+L405d94:
+s0 = s0 + 0x2;
+L405d98:
+s2 = s2 + 0xfffffffe;
+MEM_U8(s1 + 0) = (uint8_t)t1;
+MEM_U8(s1 + 1) = (uint8_t)t0;
+s1 = s1 + 0x2;
+goto L405c08;
+L405dac:
+t8 = 0x100040c8;
+t5 = v1 + t8;
+t4 = MEM_U8(t5 + 0);
+if (t4 == zero) {
+at = 0x28;
+goto L405e70;}
+MEM_U8(s1 + 0) = (uint8_t)v1;
+t9 = MEM_U8(s0 + 0);
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s5 != t9) goto L405c08;
+t7 = MEM_U32(s4 + 24);
+t9 = MEM_U32(sp + 164);
+//nop;
+if (t7 != 0) goto L405e04;
+t6 = MEM_U32(s4 + 4);
+t8 = t6 + 0x1;
+MEM_U32(s4 + 4) = t8;
+t5 = MEM_U32(s6 + 4);
+t4 = t5 + 0x1;
+MEM_U32(s6 + 4) = t4;
+goto L405c08;
+L405e04:
+if (t9 != zero) {
+t8 = MEM_U8(s0 + 0);
+goto L405e58;}
+v1 = MEM_U8(s0 + 0);
+at = 0x2d;
+s1 = s1 + 0xffffffff;
+//nop;
+if (v1 != at) goto L405e2c;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+goto L405c08;
+L405e2c:
+s2 = s2 + 0xffffffff;
+if (s5 != v1) goto L405e44;
+t7 = MEM_U32(s6 + 4);
+t6 = t7 + 0x1;
+MEM_U32(s6 + 4) = t6;
+v1 = MEM_U8(s0 + 0);
+L405e44:
+MEM_U8(s1 + 0) = (uint8_t)v1;
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+goto L405c08;
+// fdead 0 t8 = MEM_U8(s0 + 0);
+L405e58:
+s1 = s1 + 0x1;
+s0 = s0 + 0x1;
+s2 = s2 + 0xffffffff;
+MEM_U8(s1 + -1) = (uint8_t)t8;
+goto L405c08;
+at = 0x28;
+L405e70:
+if (v1 != at) {
+fp = zero;
+goto L405f44;}
+t5 = MEM_U32(sp + 92);
+L405e7c:
+a0 = s7;
+a1 = s6;
+MEM_U32(s6 + 4) = t5;
+MEM_U32(s4 + 20) = s0;
+MEM_U32(s6 + 20) = fp;
+//nop;
+MEM_U32(sp + 116) = zero;
+//nop;
+f_macroexpand(mem, sp, a0, a1);
+// bdead 40c00183 gp = MEM_U32(sp + 52);
+s1 = MEM_U32(s6 + 20);
+t5 = MEM_U32(s6 + 8);
+t4 = 0x10002cf0;
+t7 = 0x10005ec0;
+t0 = 0x2f;
+t4 = MEM_U32(t4 + 0);
+t1 = 0x2a;
+t3 = 0x5c;
+t9 = t4 << 3;
+t9 = t9 + t4;
+t9 = t9 << 2;
+s4 = t9 + t7;
+t6 = MEM_U32(s4 + 16);
+t8 = MEM_U32(s4 + 8);
+t4 = MEM_U32(s6 + 16);
+s0 = MEM_U32(s4 + 20);
+t2 = t6 + t8;
+t9 = s1 - t4;
+t7 = t5 - t9;
+s2 = t2 - s0;
+at = (int)s2 < (int)t7;
+a1 = s2;
+MEM_U32(s6 + 20) = s1;
+if (at != 0) goto L405f2c;
+//nop;
+a0 = s6;
+MEM_U32(sp + 136) = t2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40ea0183 gp = MEM_U32(sp + 52);
+t0 = 0x2f;
+t1 = 0x2a;
+t2 = MEM_U32(sp + 136);
+t3 = 0x5c;
+L405f2c:
+s1 = MEM_U32(s6 + 20);
+goto L405f40;
+L405f34:
+s7 = MEM_U32(s7 + 0);
+if (s7 != zero) {
+t5 = MEM_U32(s7 + 16);
+goto L405af0;}
+L405f40:
+fp = zero;
+L405f44:
+MEM_U32(sp + 128) = zero;
+L405f48:
+v1 = MEM_U8(s0 + 0);
+goto L404cf8;
+L405f50:
+s0 = 0x10002e74;
+v1 = MEM_U32(s4 + 28);
+v0 = MEM_U32(s0 + 0);
+if (v0 == v1) {
+// bdead 20011 ra = MEM_U32(sp + 60);
+goto L406018;}
+t6 = MEM_U32(v0 + 16);
+t8 = t6 + 0xfffffffd;
+//nop;
+if (t8 >= 0x6) goto L405fe0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L405fa4;
+case 1: goto L405fb4;
+case 2: goto L405f94;
+case 3: goto L405fc4;
+case 4: goto L405fe0;
+case 5: goto L405fd4;
+}
+L405f94:
+t4 = 0x100013d8;
+t4 = t4;
+MEM_U32(sp + 68) = t4;
+goto L405fe0;
+L405fa4:
+t5 = 0x100013dc;
+t5 = t5;
+MEM_U32(sp + 68) = t5;
+goto L405fe0;
+L405fb4:
+t9 = 0x100013e4;
+t9 = t9;
+MEM_U32(sp + 68) = t9;
+goto L405fe0;
+L405fc4:
+t7 = 0x100013ec;
+t7 = t7;
+MEM_U32(sp + 68) = t7;
+goto L405fe0;
+L405fd4:
+t6 = 0x100013f4;
+t6 = t6;
+MEM_U32(sp + 68) = t6;
+L405fe0:
+//nop;
+a0 = MEM_U32(v0 + 8);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40220109 gp = MEM_U32(sp + 52);
+a0 = v0;
+a2 = MEM_U32(sp + 68);
+//nop;
+a1 = 0x100013fc;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 220001 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s4 + 28);
+// bdead 20011 ra = MEM_U32(sp + 60);
+L406018:
+MEM_U32(s0 + 0) = v1;
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0xa0;
+return;
+}
+
+static void f_expand_to_temp_buffer(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406048:
+//expand_to_temp_buffer:
+//nop;
+//nop;
+//nop;
+t3 = 0x10002cf0;
+sp = sp + 0xffffff90;
+t1 = a2 - a1;
+t6 = MEM_U32(t3 + 0);
+// fdead 400095eb MEM_U32(sp + 28) = ra;
+// fdead 400095eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 112) = a0;
+MEM_U32(sp + 124) = a3;
+t0 = t1;
+MEM_U32(sp + 60) = t6;
+if ((int)t1 >= 0) goto L4060ac;
+//nop;
+MEM_U32(sp + 116) = a1;
+MEM_U32(sp + 120) = a2;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+wrapper_abort(mem);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 116);
+a2 = MEM_U32(sp + 120);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+L4060ac:
+//nop;
+a0 = t0 + 0x1;
+MEM_U32(sp + 116) = a1;
+MEM_U32(sp + 120) = a2;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+v0 = f_alloca(mem, sp, a0);
+a1 = MEM_U32(sp + 116);
+a2 = MEM_U32(sp + 120);
+// bdead 400000cb gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = v0;
+v1 = v0;
+a0 = a1;
+if (a1 == a2) goto L406140;
+a3 = t1 & 0x3;
+v0 = a3 + a1;
+if (a3 == 0) goto L406114;
+L4060f8:
+t7 = MEM_U8(a0 + 0);
+a0 = a0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t7;
+if (v0 != a0) goto L4060f8;
+if (a0 == a2) {
+t6 = t2 + t0;
+goto L406144;}
+L406114:
+t8 = MEM_U8(a0 + 0);
+a0 = a0 + 0x4;
+v1 = v1 + 0x4;
+MEM_U8(v1 + -4) = (uint8_t)t8;
+t9 = MEM_U8(a0 + -3);
+MEM_U8(v1 + -3) = (uint8_t)t9;
+t4 = MEM_U8(a0 + -2);
+MEM_U8(v1 + -2) = (uint8_t)t4;
+t5 = MEM_U8(a0 + -1);
+MEM_U8(v1 + -1) = (uint8_t)t5;
+if (a0 != a2) goto L406114;
+L406140:
+t6 = t2 + t0;
+L406144:
+MEM_U8(t6 + 0) = (uint8_t)zero;
+//nop;
+t7 = t0 << 1;
+a0 = t7 + 0x64;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = t2;
+MEM_U32(sp + 36) = t0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 36);
+t2 = MEM_U32(sp + 64);
+t3 = 0x10002cf0;
+MEM_U32(sp + 88) = v0;
+MEM_U32(sp + 92) = v0;
+v1 = MEM_U32(t3 + 0);
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 96) = zero;
+MEM_U32(sp + 104) = zero;
+if ((int)v1 < (int)0xc7) goto L406210;
+t4 = 0x10005ec0;
+t9 = v1 << 3;
+t9 = t9 + v1;
+t9 = t9 << 2;
+t5 = t9 + t4;
+//nop;
+a0 = MEM_U32(t5 + 4);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+a0 = v0;
+//nop;
+a1 = 0x1000141c;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 112);
+t6 = sp + 0x48;
+t4 = t6 + 0x24;
+// bdead a011 gp = MEM_U32(sp + 24);
+t9 = v1;
+L4061e4:
+t8 = MEM_U32(t6 + 0);
+t6 = t6 + 0xc;
+t9 = t9 + 0xc;
+MEM_U32(t9 + -12) = t8;
+t7 = MEM_U32(t6 + -8);
+MEM_U32(t9 + -8) = t7;
+t8 = MEM_U32(t6 + -4);
+MEM_U32(t9 + -4) = t8;
+if (t6 != t4) goto L4061e4;
+// bdead 1 v0 = v1;
+goto L4062e8;
+L406210:
+t5 = v1 + 0x1;
+t9 = 0x10005ec0;
+t6 = t5 << 3;
+t6 = t6 + t5;
+t6 = t6 << 2;
+MEM_U32(t3 + 0) = t5;
+v0 = t6 + t9;
+t7 = 0x10002e74;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 24) = zero;
+MEM_U32(v0 + 32) = zero;
+MEM_U32(v0 + 8) = t0;
+MEM_U32(v0 + 20) = t2;
+MEM_U32(v0 + 16) = t2;
+t7 = MEM_U32(t7 + 0);
+t8 = 0x1;
+t5 = 0x1;
+MEM_U32(v0 + 28) = t7;
+MEM_U32(sp + 76) = t8;
+MEM_U32(v0 + 4) = t5;
+//nop;
+a1 = MEM_U32(sp + 124);
+a0 = sp + 0x48;
+//nop;
+f_rescan(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 60);
+t3 = 0x10002cf0;
+t4 = MEM_U32(t3 + 0);
+t6 = t4 + 0xffffffff;
+MEM_U32(t3 + 0) = t6;
+if (t9 == t6) goto L4062a4;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L4062a4:
+t8 = MEM_U32(sp + 92);
+t5 = MEM_U32(sp + 88);
+t9 = sp + 0x48;
+t6 = MEM_U32(sp + 112);
+t4 = t8 - t5;
+MEM_U32(sp + 80) = t4;
+t5 = t9 + 0x24;
+L4062c0:
+t8 = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+t6 = t6 + 0xc;
+MEM_U32(t6 + -12) = t8;
+t7 = MEM_U32(t9 + -8);
+MEM_U32(t6 + -8) = t7;
+t8 = MEM_U32(t9 + -4);
+MEM_U32(t6 + -4) = t8;
+if (t9 != t5) goto L4062c0;
+// bdead 1 v0 = MEM_U32(sp + 112);
+L4062e8:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x70;
+//nop;
+return;
+}
+
+static uint32_t f_handle_directive(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0, fp_dest;
+uint64_t temp64;
+L4062f8:
+//handle_directive:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff60;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 164) = a1;
+MEM_U32(sp + 136) = zero;
+s4 = a0;
+s1 = MEM_U32(a0 + 20);
+s3 = 0x10003fc8;
+s6 = 0xa;
+L40634c:
+v1 = MEM_U8(s1 + 0);
+at = 0x2f;
+t6 = s3 + v1;
+t7 = MEM_U8(t6 + 0);
+//nop;
+if (t7 == 0) goto L40636c;
+s1 = s1 + 0x1;
+goto L40634c;
+L40636c:
+if (v1 != at) {
+at = 0x5c;
+goto L4063ac;}
+t8 = MEM_U8(s1 + 1);
+at = 0x2a;
+if (t8 != at) {
+at = 0x5c;
+goto L4063ac;}
+MEM_U32(s4 + 20) = s1;
+//nop;
+a0 = s4;
+a1 = s4 + 0x4;
+//nop;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40b00143 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(s4 + 20);
+goto L40634c;
+at = 0x5c;
+L4063ac:
+if (v1 != at) {
+s0 = s1;
+goto L4063d8;}
+t9 = MEM_U8(s1 + 1);
+if (s6 != t9) {
+s0 = s1;
+goto L4063d8;}
+t1 = MEM_U32(s4 + 4);
+s1 = s1 + 0x2;
+t2 = t1 + 0x1;
+MEM_U32(s4 + 4) = t2;
+goto L40634c;
+// fdead 0 s0 = s1;
+L4063d8:
+s2 = 0x10003dc8;
+L4063dc:
+a0 = MEM_U8(s0 + 0);
+at = 0x5c;
+t3 = s2 + a0;
+v1 = MEM_U8(t3 + 0);
+//nop;
+if (v1 == 0) goto L4063fc;
+s0 = s0 + 0x1;
+goto L4063dc;
+L4063fc:
+//nop;
+if (a0 != at) goto L406430;
+t4 = MEM_U8(s0 + 1);
+//nop;
+if (s6 != t4) goto L406430;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_name_newline_fix(mem, sp, a0);
+a0 = MEM_U8(s0 + 0);
+// bdead 40be0163 gp = MEM_U32(sp + 60);
+t5 = s2 + a0;
+v1 = MEM_U8(t5 + 0);
+L406430:
+//nop;
+if (v1 == 0) goto L406440;
+s0 = s0 + 0x1;
+goto L4063dc;
+L406440:
+t6 = 0x10003d4c;
+a2 = s0 - s1;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L40646c;
+//nop;
+if (s0 != s1) goto L40646c;
+v0 = 0x1;
+if (s6 != a0) goto L40646c;
+MEM_U32(s4 + 20) = s0;
+goto L406c08;
+L40646c:
+//nop;
+if (a2 != 0) goto L406484;
+v0 = 0x1;
+if (s6 != a0) goto L406484;
+MEM_U32(s4 + 20) = s0;
+goto L406c08;
+L406484:
+v0 = 0x10002d40;
+t8 = MEM_U32(v0 + 0);
+s7 = v0;
+//nop;
+if ((int)t8 <= 0) goto L406bd0;
+// bdead 43b601c3 t9 = v0;
+v0 = t8;
+L4064a0:
+if (a2 != v0) {
+v0 = MEM_U32(s7 + 20);
+goto L406bc4;}
+//nop;
+a0 = MEM_U32(s7 + 8);
+MEM_U32(sp + 72) = a2;
+a1 = s1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 60041b6014b gp = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 72);
+if (v0 != 0) goto L406bc0;
+v0 = 0x10003d4c;
+t1 = MEM_U32(s4 + 16);
+t2 = MEM_U32(s4 + 8);
+v0 = MEM_U32(v0 + 0);
+MEM_U32(sp + 116) = zero;
+s1 = s0;
+v0 = zero < v0;
+fp = t1 + t2;
+if (v0 == 0) goto L4064f4;
+v0 = MEM_U8(s7 + 17);
+v0 = zero < v0;
+L4064f4:
+at = s0 < fp;
+MEM_U32(sp + 112) = v0;
+s5 = s0;
+if (at == 0) goto L406708;
+s2 = 0x3e;
+v0 = MEM_U8(s1 + 0);
+L40650c:
+s1 = s1 + 0x1;
+t3 = v0 + 0xfffffff6;
+if (v0 < 0x3d) goto L406530;
+at = 0x5c;
+if (v0 == at) {
+at = s1 < fp;
+goto L40655c;}
+at = s1 < fp;
+goto L406700;
+L406530:
+if (t3 >= 0x33) {
+at = s1 < fp;
+goto L406700;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L4066ec;
+case 1: goto L4066fc;
+case 2: goto L4066fc;
+case 3: goto L4066fc;
+case 4: goto L4066fc;
+case 5: goto L4066fc;
+case 6: goto L4066fc;
+case 7: goto L4066fc;
+case 8: goto L4066fc;
+case 9: goto L4066fc;
+case 10: goto L4066fc;
+case 11: goto L4066fc;
+case 12: goto L4066fc;
+case 13: goto L4066fc;
+case 14: goto L4066fc;
+case 15: goto L4066fc;
+case 16: goto L4066fc;
+case 17: goto L4066fc;
+case 18: goto L4066fc;
+case 19: goto L4066fc;
+case 20: goto L4066fc;
+case 21: goto L4066fc;
+case 22: goto L4066fc;
+case 23: goto L4066fc;
+case 24: goto L40658c;
+case 25: goto L4066fc;
+case 26: goto L4066fc;
+case 27: goto L4066fc;
+case 28: goto L4066fc;
+case 29: goto L40658c;
+case 30: goto L4066fc;
+case 31: goto L4066fc;
+case 32: goto L4066fc;
+case 33: goto L4066fc;
+case 34: goto L4066fc;
+case 35: goto L4066fc;
+case 36: goto L4066fc;
+case 37: goto L406634;
+case 38: goto L4066fc;
+case 39: goto L4066fc;
+case 40: goto L4066fc;
+case 41: goto L4066fc;
+case 42: goto L4066fc;
+case 43: goto L4066fc;
+case 44: goto L4066fc;
+case 45: goto L4066fc;
+case 46: goto L4066fc;
+case 47: goto L4066fc;
+case 48: goto L4066fc;
+case 49: goto L4066fc;
+case 50: goto L4065f4;
+}
+// fdead 0 at = s1 < fp;
+L40655c:
+if (at == zero) {
+at = s1 < fp;
+goto L406700;}
+t4 = MEM_U8(s1 + 0);
+//nop;
+if (s6 != t4) goto L406584;
+t5 = MEM_U32(s4 + 4);
+t7 = 0x1;
+t6 = t5 + 0x1;
+MEM_U32(s4 + 4) = t6;
+MEM_U32(sp + 136) = t7;
+L406584:
+s1 = s1 + 0x1;
+goto L4066fc;
+L40658c:
+a2 = MEM_U32(s4 + 4);
+t9 = sp + 0x74;
+MEM_U32(sp + 20) = t9;
+//nop;
+t8 = sp + 0x88;
+MEM_U32(sp + 16) = t8;
+a0 = s1 + 0xffffffff;
+a1 = fp;
+a3 = s4 + 0x4;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U32(sp + 116);
+// bdead 600c1fa040b gp = MEM_U32(sp + 60);
+s1 = v0;
+if (t1 == zero) {
+at = s1 < fp;
+goto L406700;}
+t2 = 0x10003d4c;
+t2 = MEM_U32(t2 + 0);
+if (t2 == zero) {
+MEM_U32(s4 + 20) = s1;
+goto L4065ec;}
+s1 = v0 + 0xffffffff;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+goto L406714;
+// fdead 0 MEM_U32(s4 + 20) = s1;
+L4065ec:
+v0 = 0x1;
+goto L406c08;
+L4065f4:
+t3 = MEM_U8(s7 + 16);
+if (t3 == zero) {
+at = s1 < fp;
+goto L406700;}
+v1 = MEM_U8(s1 + 0);
+if (v1 == zero) {
+at = s1 < fp;
+goto L406700;}
+if (s2 == v1) {
+at = s1 < fp;
+goto L406700;}
+v1 = MEM_U8(s1 + 1);
+L406618:
+s1 = s1 + 0x1;
+if (v1 == zero) {
+at = s1 < fp;
+goto L406700;}
+if (s2 != v1) {
+v1 = MEM_U8(s1 + 1);
+goto L406618;}
+at = s1 < fp;
+goto L406700;
+L406634:
+v1 = MEM_U8(s1 + 0);
+at = 0x5c;
+if (v1 != at) {
+at = 0x2a;
+goto L40666c;}
+t4 = MEM_U8(s1 + 1);
+if (s6 != t4) {
+at = 0x2a;
+goto L40666c;}
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600c1fe0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s1 + 0);
+at = 0x2a;
+L40666c:
+t6 = s1 + 0xffffffff;
+if (v1 == at) goto L406690;
+t5 = 0x10003d20;
+at = 0x2f;
+t5 = MEM_U32(t5 + 0);
+if (t5 == zero) {
+at = s1 < fp;
+goto L406700;}
+if (v1 != at) {
+at = s1 < fp;
+goto L406700;}
+L406690:
+MEM_U32(sp + 104) = t6;
+t7 = s1 + 0x1;
+MEM_U32(s4 + 20) = t7;
+//nop;
+a0 = s4;
+a1 = s4 + 0x4;
+//nop;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(s4 + 20);
+// bdead 600c1fa0013 gp = MEM_U32(sp + 60);
+s1 = v1;
+if (v1 == fp) goto L4066d0;
+t8 = MEM_U8(s1 + 0);
+t9 = MEM_U32(sp + 112);
+//nop;
+if (s6 != t8) goto L4066d8;
+L4066d0:
+s1 = MEM_U32(sp + 104);
+goto L406714;
+L4066d8:
+t1 = MEM_U32(sp + 136);
+if (t9 != 0) goto L4066fc;
+t2 = t1 + 0x1;
+MEM_U32(sp + 136) = t2;
+goto L4066fc;
+L4066ec:
+s1 = s1 + 0xffffffff;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+goto L406714;
+L4066fc:
+at = s1 < fp;
+L406700:
+if (at != zero) {
+v0 = MEM_U8(s1 + 0);
+goto L40650c;}
+L406708:
+s2 = 0x3e;
+MEM_U32(s4 + 20) = s1;
+v1 = s1;
+L406714:
+t3 = MEM_U32(sp + 136);
+MEM_U32(sp + 140) = v1;
+if (t3 == zero) {
+s0 = s1;
+goto L406a40;}
+//nop;
+a0 = s1 - s0;
+a0 = a0 + 0x5;
+MEM_U32(sp + 100) = s0;
+v0 = f_alloca(mem, sp, a0);
+v1 = MEM_U32(sp + 100);
+// bdead 600c1bc001b gp = MEM_U32(sp + 60);
+s0 = v0;
+s5 = v0;
+if (v1 >= s1) goto L406a34;
+t0 = 0x100040c8;
+v0 = MEM_U8(v1 + 0);
+L406758:
+v1 = v1 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+if (v0 < 0x3d) goto L406780;
+at = 0x5c;
+if (v0 == at) {
+t6 = MEM_U8(v1 + 0);
+goto L4067f8;}
+at = v1 < s1;
+goto L406a2c;
+L406780:
+t4 = v0 + 0xfffffff6;
+a0 = v0;
+if (t4 >= 0x33) goto L406a28;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L406a28;
+case 1: goto L406a28;
+case 2: goto L406a28;
+case 3: goto L406a28;
+case 4: goto L406a28;
+case 5: goto L406a28;
+case 6: goto L406a28;
+case 7: goto L406a28;
+case 8: goto L406a28;
+case 9: goto L406a28;
+case 10: goto L406a28;
+case 11: goto L406a28;
+case 12: goto L406a28;
+case 13: goto L406a28;
+case 14: goto L406a28;
+case 15: goto L406a28;
+case 16: goto L406a28;
+case 17: goto L406a28;
+case 18: goto L406a28;
+case 19: goto L406a28;
+case 20: goto L406a28;
+case 21: goto L406a28;
+case 22: goto L406a28;
+case 23: goto L406a28;
+case 24: goto L406900;
+case 25: goto L406a28;
+case 26: goto L406a28;
+case 27: goto L406a28;
+case 28: goto L406a28;
+case 29: goto L406900;
+case 30: goto L406a28;
+case 31: goto L406a28;
+case 32: goto L406a28;
+case 33: goto L406a28;
+case 34: goto L406a28;
+case 35: goto L406a28;
+case 36: goto L406a28;
+case 37: goto L4069a8;
+case 38: goto L406a28;
+case 39: goto L406a28;
+case 40: goto L406a28;
+case 41: goto L406a28;
+case 42: goto L406a28;
+case 43: goto L406a28;
+case 44: goto L406a28;
+case 45: goto L406a28;
+case 46: goto L406a28;
+case 47: goto L406a28;
+case 48: goto L406a28;
+case 49: goto L406a28;
+case 50: goto L4067ac;
+}
+L4067ac:
+t5 = MEM_U8(s7 + 16);
+at = v1 < s1;
+if (t5 == zero) {
+at = v1 < s1;
+goto L406a2c;}
+if (at == 0) {
+at = 0x3e;
+goto L406a28;}
+at = 0x3e;
+if (a0 == at) {
+at = v1 < s1;
+goto L406a2c;}
+v0 = MEM_U8(v1 + 0);
+L4067d0:
+v1 = v1 + 0x1;
+at = v1 < s1;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+if (at == 0) goto L406a28;
+if (v0 != s2) {
+v0 = MEM_U8(v1 + 0);
+goto L4067d0;}
+at = v1 < s1;
+goto L406a2c;
+// fdead 0 t6 = MEM_U8(v1 + 0);
+L4067f8:
+if (s6 != t6) {
+at = v1 < s1;
+goto L406a2c;}
+t7 = 0x10002ce4;
+v1 = v1 + 0x1;
+s0 = s0 + 0xffffffff;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L406828;
+MEM_U8(s0 + 0) = (uint8_t)s6;
+MEM_U8(s0 + 1) = (uint8_t)s6;
+s0 = s0 + 0x2;
+goto L406a28;
+L406828:
+if (s0 == s5) {
+v0 = MEM_U8(v1 + 0);
+goto L4068b0;}
+t8 = MEM_U8(s0 + -1);
+t9 = t0 + t8;
+v0 = MEM_U8(t9 + 0);
+if (v0 == zero) {
+v0 = MEM_U8(v1 + 0);
+goto L4068b0;}
+if (s0 == s5) {
+t4 = MEM_U8(v1 + 0);
+goto L406878;}
+if (v0 == zero) {
+t4 = MEM_U8(v1 + 0);
+goto L406878;}
+s0 = s0 + 0xffffffff;
+L406858:
+if (s0 == s5) {
+t4 = MEM_U8(v1 + 0);
+goto L406878;}
+t1 = MEM_U8(s0 + -1);
+t2 = t0 + t1;
+t3 = MEM_U8(t2 + 0);
+if (t3 != zero) {
+s0 = s0 + 0xffffffff;
+goto L406858;}
+t4 = MEM_U8(v1 + 0);
+L406878:
+s0 = s0 + 0x1;
+t5 = s3 + t4;
+t6 = MEM_U8(t5 + 0);
+if (t6 == zero) {
+at = v1 < s1;
+goto L406a2c;}
+t7 = MEM_U8(v1 + 1);
+L406890:
+v1 = v1 + 0x1;
+t8 = s3 + t7;
+t9 = MEM_U8(t8 + 0);
+if (t9 != zero) {
+t7 = MEM_U8(v1 + 1);
+goto L406890;}
+at = v1 < s1;
+goto L406a2c;
+// fdead 0 v0 = MEM_U8(v1 + 0);
+L4068b0:
+t1 = t0 + v0;
+t2 = MEM_U8(t1 + 0);
+if (t2 == zero) {
+at = v1 < s1;
+goto L406a2c;}
+MEM_U8(s0 + 0) = (uint8_t)v0;
+t3 = MEM_U8(v1 + 1);
+s0 = s0 + 0x1;
+v1 = v1 + 0x1;
+t4 = s3 + t3;
+t5 = MEM_U8(t4 + 0);
+if (t5 == zero) {
+at = v1 < s1;
+goto L406a2c;}
+t6 = MEM_U8(v1 + 1);
+L4068e4:
+v1 = v1 + 0x1;
+t7 = s3 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 != zero) {
+t6 = MEM_U8(v1 + 1);
+goto L4068e4;}
+at = v1 < s1;
+goto L406a2c;
+L406900:
+t9 = 0x10003d4c;
+a0 = v1 + 0xffffffff;
+a1 = fp;
+t9 = MEM_U32(t9 + 0);
+a3 = zero;
+if (t9 != zero) {
+at = v1 < s1;
+goto L406a2c;}
+//nop;
+a2 = MEM_U32(s4 + 4);
+MEM_U32(sp + 100) = v1;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = zero;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+v1 = MEM_U32(sp + 100);
+// bdead 600c1fe001b gp = MEM_U32(sp + 60);
+a1 = v0;
+t0 = 0x100040c8;
+if (v1 == v0) goto L406a28;
+a2 = v0 - v1;
+a2 = a2 & 0x3;
+a0 = a2 + v1;
+if (a2 == 0) goto L406974;
+L406958:
+t1 = MEM_U8(v1 + 0);
+v1 = v1 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s0 + -1) = (uint8_t)t1;
+if (a0 != v1) goto L406958;
+if (v1 == v0) {
+at = v1 < s1;
+goto L406a2c;}
+L406974:
+t2 = MEM_U8(v1 + 0);
+v1 = v1 + 0x4;
+s0 = s0 + 0x4;
+MEM_U8(s0 + -4) = (uint8_t)t2;
+t3 = MEM_U8(v1 + -3);
+MEM_U8(s0 + -3) = (uint8_t)t3;
+t4 = MEM_U8(v1 + -2);
+MEM_U8(s0 + -2) = (uint8_t)t4;
+t5 = MEM_U8(v1 + -1);
+MEM_U8(s0 + -1) = (uint8_t)t5;
+if (v1 != a1) goto L406974;
+at = v1 < s1;
+goto L406a2c;
+L4069a8:
+t6 = MEM_U32(sp + 112);
+if (t6 != zero) {
+at = v1 < s1;
+goto L406a2c;}
+v0 = MEM_U8(v1 + 0);
+at = 0x2a;
+t1 = v1 + 0x1;
+//nop;
+if (v0 == at) goto L4069e4;
+t7 = 0x10003d20;
+at = 0x2f;
+t7 = MEM_U32(t7 + 0);
+if (t7 == zero) {
+at = v1 < s1;
+goto L406a2c;}
+if (v0 != at) {
+at = v1 < s1;
+goto L406a2c;}
+L4069e4:
+t8 = 0x10003d4c;
+t9 = 0x20;
+t8 = MEM_U32(t8 + 0);
+if (t8 == zero) {
+MEM_U8(s0 + -1) = (uint8_t)t9;
+goto L406a04;}
+s0 = s0 + 0xffffffff;
+goto L406a04;
+// fdead 0 MEM_U8(s0 + -1) = (uint8_t)t9;
+L406a04:
+MEM_U32(s4 + 20) = t1;
+//nop;
+a0 = s4;
+a1 = zero;
+//nop;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 600c1fe0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U32(s4 + 20);
+t0 = 0x100040c8;
+L406a28:
+at = v1 < s1;
+L406a2c:
+if (at != zero) {
+v0 = MEM_U8(v1 + 0);
+goto L406758;}
+L406a34:
+MEM_U8(s0 + 0) = (uint8_t)zero;
+goto L406a40;
+// fdead 0 s0 = s1;
+L406a40:
+t2 = MEM_U32(sp + 140);
+MEM_U32(s4 + 20) = t2;
+t3 = MEM_U8(s7 + 18);
+t4 = MEM_U32(sp + 164);
+if (t3 == zero) {
+t9 = MEM_U32(s7 + 4);
+goto L406b58;}
+s1 = MEM_U32(t4 + 20);
+t6 = MEM_U32(t4 + 16);
+a1 = MEM_U32(s7 + 0);
+t5 = MEM_U32(t4 + 8);
+t7 = s1 - t6;
+a1 = a1 + 0x1;
+t8 = t5 - t7;
+if ((int)a1 < (int)t8) {
+t1 = 0x23;
+goto L406aa0;}
+//nop;
+a0 = t4;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U32(sp + 164);
+// bdead 45620001 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(t9 + 20);
+t1 = 0x23;
+L406aa0:
+MEM_U8(s1 + 0) = (uint8_t)t1;
+t2 = MEM_U32(sp + 164);
+t3 = MEM_U32(t2 + 20);
+t6 = t3 + 0x1;
+MEM_U32(t2 + 20) = t6;
+//nop;
+t5 = MEM_U32(sp + 164);
+a2 = MEM_U32(s7 + 0);
+a0 = MEM_U32(s7 + 8);
+a1 = MEM_U32(t5 + 20);
+wrapper_bcopy(mem, a0, a1, a2);
+t7 = MEM_U32(sp + 164);
+t4 = MEM_U32(s7 + 0);
+// bdead 41632001 gp = MEM_U32(sp + 60);
+t8 = MEM_U32(t7 + 20);
+s2 = s0 - s5;
+t9 = t8 + t4;
+MEM_U32(t7 + 20) = t9;
+t1 = MEM_U32(sp + 164);
+s1 = MEM_U32(t1 + 20);
+t6 = MEM_U32(t1 + 16);
+t3 = MEM_U32(t1 + 8);
+t2 = s1 - t6;
+t5 = t3 - t2;
+//nop;
+if ((int)s2 < (int)t5) goto L406b2c;
+//nop;
+a0 = t1;
+a1 = s2;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U32(sp + 164);
+// bdead 436a0001 gp = MEM_U32(sp + 60);
+s1 = MEM_U32(t8 + 20);
+L406b2c:
+//nop;
+a0 = s5;
+a1 = s1;
+a2 = s2;
+wrapper_bcopy(mem, a0, a1, a2);
+t4 = MEM_U32(sp + 164);
+// bdead 600416a2001 gp = MEM_U32(sp + 60);
+t9 = MEM_U32(t4 + 20);
+t7 = t9 + s2;
+MEM_U32(t4 + 20) = t7;
+t9 = MEM_U32(s7 + 4);
+L406b58:
+a0 = s5;
+a1 = s0;
+a2 = MEM_U32(sp + 164);
+fp_dest = t9;
+a3 = s7;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t1 = MEM_U32(sp + 164);
+t6 = MEM_U32(s4 + 20);
+t3 = MEM_U32(s4 + 16);
+t8 = MEM_U32(t1 + 20);
+t7 = MEM_U32(t1 + 16);
+t5 = MEM_U32(s4 + 8);
+t9 = MEM_U32(t1 + 8);
+t2 = t6 - t3;
+t4 = t8 - t7;
+a1 = t5 - t2;
+t6 = t9 - t4;
+// bdead 40000441 gp = MEM_U32(sp + 60);
+if ((int)a1 < (int)t6) goto L406bb8;
+//nop;
+a0 = t1;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 60);
+L406bb8:
+v0 = 0x1;
+goto L406c08;
+L406bc0:
+v0 = MEM_U32(s7 + 20);
+L406bc4:
+s7 = s7 + 0x14;
+//nop;
+if ((int)v0 > 0) goto L4064a0;
+L406bd0:
+t3 = 0x10003d38;
+t3 = MEM_U32(t3 + 0);
+if (t3 == zero) {
+v0 = zero;
+goto L406c08;}
+t5 = 0x10003d3c;
+t5 = MEM_U32(t5 + 0);
+if (t5 != zero) {
+v0 = zero;
+goto L406c08;}
+//nop;
+a0 = 0x10001444;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 60);
+v0 = zero;
+L406c08:
+// bdead 9 ra = MEM_U32(sp + 68);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 32);
+// bdead 9 s2 = MEM_U32(sp + 36);
+// bdead 9 s3 = MEM_U32(sp + 40);
+// bdead 9 s4 = MEM_U32(sp + 44);
+// bdead 9 s5 = MEM_U32(sp + 48);
+// bdead 9 s6 = MEM_U32(sp + 52);
+// bdead 9 s7 = MEM_U32(sp + 56);
+// bdead 9 fp = MEM_U32(sp + 64);
+// bdead 9 sp = sp + 0xa0;
+return v0;
+}
+
+static void f_special_symbol(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L406c38:
+//special_symbol:
+//nop;
+//nop;
+//nop;
+a3 = 0x10002cf0;
+sp = sp + 0xffffffa8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+a3 = MEM_U32(a3 + 0);
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 88) = a0;
+MEM_U32(sp + 92) = a1;
+v1 = zero;
+t0 = zero;
+a2 = a3;
+if ((int)a3 < 0) goto L406ca8;
+a0 = 0x10005ec0;
+t6 = a2 << 3;
+t6 = t6 + a2;
+t6 = t6 << 2;
+v0 = t6 + a0;
+t8 = MEM_U32(v0 + 0);
+L406c88:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L406c9c;}
+v1 = v0;
+goto L406ca8;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L406c9c:
+if (v0 >= a0) {
+t8 = MEM_U32(v0 + 0);
+goto L406c88;}
+L406ca8:
+t9 = MEM_U32(sp + 88);
+if (v1 != 0) goto L406cc8;
+//nop;
+a0 = 0x100014d8;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L4071e4;
+L406cc8:
+v0 = MEM_U32(t9 + 12);
+t1 = v0 + 0xfffffff1;
+//nop;
+if (t1 >= 0xb) goto L407138;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L406e84;
+case 1: goto L406ec4;
+case 2: goto L406cf8;
+case 3: goto L406cf8;
+case 4: goto L406d7c;
+case 5: goto L406df8;
+case 6: goto L406ec4;
+case 7: goto L406e48;
+case 8: goto L407138;
+case 9: goto L407138;
+case 10: goto L406fb4;
+}
+L406cf8:
+at = 0x11;
+//nop;
+if (v0 != at) goto L406d0c;
+a2 = MEM_U32(v1 + 0);
+goto L406d14;
+L406d0c:
+a2 = 0x10005ec0;
+a2 = MEM_U32(a2 + 0);
+L406d14:
+//nop;
+if (a2 == 0) goto L406d6c;
+//nop;
+a0 = a2;
+MEM_U32(sp + 56) = a2;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = v0 + 0x3;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 56);
+MEM_U32(sp + 84) = v0;
+//nop;
+a1 = 0x100014f8;
+a0 = v0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406d6c:
+t2 = 0x10001500;
+t2 = t2;
+MEM_U32(sp + 84) = t2;
+goto L40715c;
+L406d7c:
+v1 = zero;
+if ((int)a3 < 0) goto L406db8;
+a0 = 0x10005ec0;
+t3 = a3 << 3;
+t3 = t3 + a3;
+t3 = t3 << 2;
+v0 = t3 + a0;
+t5 = MEM_U32(v0 + 0);
+L406d9c:
+v0 = v0 + 0xffffffdc;
+at = v0 < a0;
+//nop;
+if (t5 == 0) goto L406db0;
+v1 = v1 + 0x1;
+L406db0:
+if (at == zero) {
+t5 = MEM_U32(v0 + 0);
+goto L406d9c;}
+L406db8:
+//nop;
+a0 = 0x8;
+MEM_U32(sp + 68) = v1;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 68);
+MEM_U32(sp + 84) = v0;
+//nop;
+a1 = 0x10001504;
+a0 = v0;
+a2 = v1 + 0xffffffff;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406df8:
+//nop;
+a0 = 0x10002eb0;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+a0 = v0 + 0x3;
+//nop;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 84) = v0;
+a0 = v0;
+//nop;
+a1 = 0x10001508;
+a2 = 0x10002eb0;
+a1 = a1;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406e48:
+//nop;
+a0 = 0x10;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 88);
+MEM_U32(sp + 84) = v0;
+//nop;
+a1 = 0x10001510;
+a0 = v0;
+a2 = MEM_U32(t6 + 24);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406e84:
+//nop;
+a0 = 0xa;
+MEM_U32(sp + 64) = v1;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40000109 gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 64);
+MEM_U32(sp + 84) = v0;
+//nop;
+a1 = 0x10001514;
+a0 = v0;
+a2 = MEM_U32(v1 + 4);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406ec4:
+v1 = 0x10002ea8;
+v1 = MEM_U32(v1 + 0);
+//nop;
+if (v1 != 0) goto L406f08;
+//nop;
+a0 = zero;
+//nop;
+v0 = wrapper_time(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 80) = v0;
+a0 = sp + 0x50;
+//nop;
+//nop;
+v0 = wrapper_localtime(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+at = 0x10002ea8;
+MEM_U32(at + 0) = v0;
+L406f08:
+//nop;
+a0 = 0x14;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+t7 = MEM_U32(sp + 88);
+MEM_U32(sp + 84) = v0;
+at = 0x10;
+t8 = MEM_U32(t7 + 12);
+// bdead 4200000d gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+if (t8 != at) goto L406f80;
+v1 = 0x10002ea8;
+t2 = 0x10002e78;
+a1 = 0x10001518;
+v1 = MEM_U32(v1 + 0);
+t2 = t2;
+a1 = a1;
+t9 = MEM_U32(v1 + 16);
+t4 = MEM_U32(v1 + 20);
+a3 = MEM_U32(v1 + 12);
+t1 = t9 << 2;
+//nop;
+t3 = t1 + t2;
+a2 = MEM_U32(t3 + 0);
+t5 = t4 + 0x76c;
+MEM_U32(sp + 16) = t5;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406f80:
+v1 = 0x10002ea8;
+//nop;
+a1 = 0x10001528;
+v1 = MEM_U32(v1 + 0);
+a0 = MEM_U32(sp + 84);
+a1 = a1;
+t6 = MEM_U32(v1 + 0);
+a2 = MEM_U32(v1 + 8);
+a3 = MEM_U32(v1 + 4);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L406fb4:
+t7 = 0x1000153c;
+t9 = 0x10005ec0;
+t8 = a3 << 3;
+t8 = t8 + a3;
+t8 = t8 << 2;
+t7 = t7;
+MEM_U32(sp + 84) = t7;
+v1 = t8 + t9;
+a0 = MEM_U32(v1 + 20);
+a3 = 0x10003fc8;
+at = 0x28;
+v0 = MEM_U8(a0 + 0);
+a1 = 0xffffffff;
+t1 = a3 + v0;
+t2 = MEM_U8(t1 + 0);
+t3 = a0 + 0x1;
+if (t2 == 0) goto L407014;
+L406ff8:
+MEM_U32(v1 + 20) = t3;
+v0 = MEM_U8(t3 + 0);
+a0 = t3;
+t4 = a3 + v0;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+t3 = a0 + 0x1;
+goto L406ff8;}
+L407014:
+t6 = a0 + 0x1;
+if (v0 != at) goto L407058;
+MEM_U32(v1 + 20) = t6;
+v0 = MEM_U8(t6 + 0);
+t0 = 0x1;
+a0 = t6;
+t7 = a3 + v0;
+t8 = MEM_U8(t7 + 0);
+t9 = a0 + 0x1;
+if (t8 == 0) goto L407058;
+L40703c:
+MEM_U32(v1 + 20) = t9;
+v0 = MEM_U8(t9 + 0);
+a0 = t9;
+t1 = a3 + v0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+t9 = a0 + 0x1;
+goto L40703c;}
+L407058:
+t3 = 0x10003ec8;
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+if (t5 == 0) goto L407120;
+//nop;
+a2 = 0xffffffff;
+MEM_U32(sp + 64) = v1;
+MEM_U32(sp + 60) = t0;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000008b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 64);
+t0 = MEM_U32(sp + 60);
+a3 = 0x10003fc8;
+if (v0 == 0) goto L4070a0;
+t6 = 0x10001540;
+t6 = t6;
+MEM_U32(sp + 84) = t6;
+L4070a0:
+a0 = MEM_U32(v1 + 20);
+a1 = 0x10003dc8;
+at = 0x29;
+v0 = MEM_U8(a0 + 0);
+t7 = a1 + v0;
+t8 = MEM_U8(t7 + 0);
+t9 = a0 + 0x1;
+if (t8 == 0) goto L4070dc;
+L4070c0:
+MEM_U32(v1 + 20) = t9;
+v0 = MEM_U8(t9 + 0);
+a0 = t9;
+t1 = a1 + v0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+t9 = a0 + 0x1;
+goto L4070c0;}
+L4070dc:
+t3 = a3 + v0;
+t4 = MEM_U8(t3 + 0);
+t5 = a0 + 0x1;
+if (t4 == 0) goto L407108;
+L4070ec:
+MEM_U32(v1 + 20) = t5;
+v0 = MEM_U8(t5 + 0);
+a0 = t5;
+t6 = a3 + v0;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+t5 = a0 + 0x1;
+goto L4070ec;}
+L407108:
+//nop;
+if (t0 == 0) goto L40715c;
+t8 = a0 + 0x1;
+if (v0 != at) goto L407120;
+MEM_U32(v1 + 20) = t8;
+goto L40715c;
+L407120:
+//nop;
+a0 = 0x10001544;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L40715c;
+L407138:
+//nop;
+a0 = 0x10001574;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L40715c:
+//nop;
+a0 = MEM_U32(sp + 84);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t9 = MEM_U32(sp + 92);
+MEM_U32(sp + 72) = v0;
+// bdead 44000009 gp = MEM_U32(sp + 32);
+t2 = MEM_U32(t9 + 16);
+a1 = MEM_U32(t9 + 20);
+t1 = MEM_U32(t9 + 8);
+a0 = t9;
+t3 = a1 - t2;
+t4 = t1 - t3;
+//nop;
+if ((int)v0 < (int)t4) goto L4071b8;
+//nop;
+a1 = v0;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t5 = MEM_U32(sp + 92);
+// bdead 40004001 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(t5 + 20);
+L4071b8:
+//nop;
+a0 = MEM_U32(sp + 84);
+a2 = MEM_U32(sp + 72);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t6 = MEM_U32(sp + 92);
+t8 = MEM_U32(sp + 72);
+// bdead 2008001 gp = MEM_U32(sp + 32);
+t7 = MEM_U32(t6 + 20);
+t2 = t7 + t8;
+MEM_U32(t6 + 20) = t2;
+L4071e4:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x58;
+//nop;
+return;
+}
+
+static uint64_t f_do_include(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4071f4:
+//do_include:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff58;
+// fdead 400001e3 MEM_U32(sp + 44) = s6;
+s6 = 0x10002d28;
+// fdead 408001e3 MEM_U32(sp + 40) = s5;
+// fdead 408001e3 MEM_U32(sp + 36) = s4;
+// fdead 408001e3 MEM_U32(sp + 32) = s3;
+// fdead 408001e3 MEM_U32(sp + 28) = s2;
+// fdead 408001e3 MEM_U32(sp + 20) = s0;
+t6 = 0xffffffff;
+s0 = a1;
+s5 = a0;
+// fdead 40c281e3 MEM_U32(sp + 52) = ra;
+// fdead 40c281e3 MEM_U32(sp + 48) = gp;
+// fdead 40c281e3 MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 176) = a2;
+MEM_U32(sp + 180) = a3;
+MEM_U32(sp + 132) = zero;
+MEM_U32(sp + 92) = zero;
+MEM_U32(sp + 136) = t6;
+s2 = 0x10003fc8;
+s3 = 0x22;
+s4 = 0x3e;
+s6 = MEM_U32(s6 + 0);
+L40725c:
+t7 = MEM_U8(s5 + 0);
+s1 = s5;
+at = 0x3c;
+t8 = s2 + t7;
+t9 = MEM_U8(t8 + 0);
+a0 = sp + 0x60;
+//nop;
+if (t9 == 0) goto L407294;
+t0 = MEM_U8(s1 + 1);
+L407280:
+s1 = s1 + 0x1;
+t1 = s2 + t0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+t0 = MEM_U8(s1 + 1);
+goto L407280;}
+L407294:
+v0 = MEM_U8(s1 + 0);
+if (s0 == s1) goto L4072d0;
+t3 = MEM_U8(s0 + -1);
+t4 = s2 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+if (t5 == 0) goto L4072d0;
+s0 = s0 + 0xffffffff;
+L4072b4:
+//nop;
+if (s0 == s1) goto L4072d0;
+t6 = MEM_U8(s0 + -1);
+t7 = s2 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 != zero) {
+s0 = s0 + 0xffffffff;
+goto L4072b4;}
+L4072d0:
+s1 = s1 + 0x1;
+if (v0 == s3) goto L4072e8;
+//nop;
+if (v0 == at) goto L407430;
+t4 = MEM_U32(sp + 132);
+goto L4074a0;
+L4072e8:
+v1 = s1;
+if (s1 == s0) goto L407314;
+t9 = MEM_U8(s1 + 0);
+if (s3 == t9) {
+t1 = MEM_U8(v1 + 0);
+goto L407318;}
+v1 = v1 + 0x1;
+L407300:
+if (v1 == s0) {
+t1 = MEM_U8(v1 + 0);
+goto L407318;}
+t0 = MEM_U8(v1 + 0);
+if (s3 != t0) {
+v1 = v1 + 0x1;
+goto L407300;}
+L407314:
+t1 = MEM_U8(v1 + 0);
+L407318:
+t2 = v1 + 0x1;
+if (s3 != t1) {
+t4 = MEM_U32(sp + 132);
+goto L4074a0;}
+if (t2 != s0) {
+t4 = MEM_U32(sp + 132);
+goto L4074a0;}
+t3 = 0x10003d68;
+a1 = 0x2f;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 == 0) goto L40734c;
+v0 = 0x10003d24;
+v0 = MEM_U32(v0 + 0);
+goto L407540;
+L40734c:
+t4 = 0x10002cf0;
+a0 = 0x10005ec0;
+t4 = MEM_U32(t4 + 0);
+t5 = t4 << 3;
+t5 = t5 + t4;
+t5 = t5 << 2;
+v0 = a0 + t5;
+//nop;
+if (v0 < a0) goto L407424;
+s0 = MEM_U32(v0 + 0);
+L407378:
+v0 = v0 + 0xffffffdc;
+at = v0 < a0;
+//nop;
+if (s0 == 0) goto L40741c;
+//nop;
+MEM_U32(sp + 144) = s6;
+s6 = sp + 0x90;
+a0 = s0;
+MEM_U32(sp + 156) = v1;
+v0 = wrapper_strrchr(mem, a0, a1);
+// bdead 4086000b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 156);
+if (v0 == 0) goto L407414;
+//nop;
+s2 = v0 - s0;
+a0 = s2 + 0x1;
+MEM_U32(sp + 156) = v1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 408e000b gp = MEM_U32(sp + 48);
+a0 = v0;
+a1 = s0;
+//nop;
+a2 = s2;
+MEM_U32(sp + 148) = v0;
+//nop;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 408c0003 gp = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 148);
+v1 = MEM_U32(sp + 156);
+t8 = 0x10003d24;
+t7 = t6 + s2;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if ((int)t8 >= (int)s2) goto L407424;
+at = 0x10003d24;
+MEM_U32(at + 0) = s2;
+goto L407424;
+L407414:
+MEM_U32(sp + 148) = zero;
+goto L407424;
+L40741c:
+if (at == zero) {
+s0 = MEM_U32(v0 + 0);
+goto L407378;}
+L407424:
+v0 = 0x10003d24;
+v0 = MEM_U32(v0 + 0);
+goto L407540;
+L407430:
+v1 = s1;
+if (s1 == s0) goto L40745c;
+t9 = MEM_U8(s1 + 0);
+if (s4 == t9) {
+t1 = MEM_U8(v1 + 0);
+goto L407460;}
+v1 = v1 + 0x1;
+L407448:
+if (v1 == s0) {
+t1 = MEM_U8(v1 + 0);
+goto L407460;}
+t0 = MEM_U8(v1 + 0);
+if (s4 != t0) {
+v1 = v1 + 0x1;
+goto L407448;}
+L40745c:
+t1 = MEM_U8(v1 + 0);
+L407460:
+t2 = v1 + 0x1;
+if (s4 != t1) {
+t4 = MEM_U32(sp + 132);
+goto L4074a0;}
+if (t2 != s0) {
+t4 = MEM_U32(sp + 132);
+goto L4074a0;}
+v0 = 0x10002d2c;
+t3 = 0x1;
+MEM_U32(sp + 92) = t3;
+v0 = MEM_U32(v0 + 0);
+//nop;
+if (v0 == 0) goto L407490;
+s6 = v0;
+L407490:
+v0 = 0x10003d24;
+v0 = MEM_U32(v0 + 0);
+goto L407540;
+// fdead 0 t4 = MEM_U32(sp + 132);
+L4074a0:
+//nop;
+if (t4 == 0) goto L4074c0;
+//nop;
+a0 = 0x1000159c;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 48);
+goto L4079a4;
+L4074c0:
+//nop;
+a1 = s5;
+a2 = s0;
+a3 = zero;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40b80003 gp = MEM_U32(sp + 48);
+s1 = MEM_U32(sp + 112);
+t5 = MEM_U32(sp + 116);
+//nop;
+a0 = t5 - s1;
+a0 = a0 + 0x1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 40b8000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+t6 = MEM_U32(sp + 116);
+//nop;
+s5 = v0;
+a1 = v0;
+a2 = t6 - a0;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 40f80003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 112);
+t7 = MEM_U32(sp + 116);
+//nop;
+t8 = t7 - a0;
+s0 = t8 + s5;
+wrapper_free(mem, a0);
+t9 = MEM_U32(sp + 132);
+// bdead 44fa01c3 gp = MEM_U32(sp + 48);
+t0 = t9 + 0x1;
+MEM_U32(sp + 132) = t0;
+goto L40725c;
+L407540:
+//nop;
+s0 = v1 - s1;
+a0 = v0 + s0;
+a0 = a0 + 0x2;
+v0 = f_alloca(mem, sp, a0);
+t1 = MEM_U8(s1 + 0);
+at = 0x2f;
+// bdead 4086040f gp = MEM_U32(sp + 48);
+s2 = v0;
+if (t1 != at) goto L4075a8;
+//nop;
+a0 = v0;
+a1 = s1;
+a2 = s0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 400e0003 gp = MEM_U32(sp + 48);
+t2 = s2 + s0;
+MEM_U8(t2 + 0) = (uint8_t)zero;
+//nop;
+a0 = s2;
+a1 = zero;
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 400e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 136) = v0;
+goto L407660;
+L4075a8:
+if (s6 == zero) {
+t5 = MEM_U32(sp + 136);
+goto L407664;}
+s3 = 0x100015c0;
+s3 = s3;
+a1 = MEM_U32(s6 + 4);
+L4075bc:
+if (a1 == zero) {
+MEM_U8(s2 + 0) = (uint8_t)zero;
+goto L407618;}
+//nop;
+a0 = s2;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+a1 = s3;
+//nop;
+//nop;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t3 = s2 + v0;
+t4 = t3 + s0;
+// bdead 409e2003 gp = MEM_U32(sp + 48);
+MEM_U8(t4 + 0) = (uint8_t)zero;
+goto L407618;
+// fdead 0 MEM_U8(s2 + 0) = (uint8_t)zero;
+L407618:
+//nop;
+a0 = s2;
+a1 = s1;
+a2 = s0;
+v0 = wrapper_strncat(mem, a0, a1, a2);
+// bdead 409e0003 gp = MEM_U32(sp + 48);
+a0 = s2;
+a1 = zero;
+//nop;
+a2 = 0x1b6;
+//nop;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 409e000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 136) = v0;
+if ((int)v0 >= 0) goto L407660;
+s6 = MEM_U32(s6 + 0);
+if (s6 != zero) {
+a1 = MEM_U32(s6 + 4);
+goto L4075bc;}
+L407660:
+t5 = MEM_U32(sp + 136);
+L407664:
+a0 = s2;
+//nop;
+if ((int)t5 >= 0) goto L407790;
+//nop;
+a1 = s1;
+a2 = s0;
+s3 = s2 + s0;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+// bdead 401e0103 gp = MEM_U32(sp + 48);
+MEM_U8(s3 + 0) = (uint8_t)zero;
+a0 = s2;
+//nop;
+//nop;
+v0 = f_error_from_errno(mem, sp, a0);
+s3 = MEM_U32(sp + 92);
+// bdead 4016010b gp = MEM_U32(sp + 48);
+s3 = zero < s3;
+v1 = s3;
+if (s3 != 0) goto L4076bc;
+s4 = 0x10002cf4;
+v1 = MEM_U32(s4 + 0);
+v1 = (int)zero < (int)v1;
+L4076bc:
+t6 = 0x10002cec;
+t6 = MEM_U32(t6 + 0);
+if ((int)v1 >= (int)t6) {
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L4079a8;}
+//nop;
+if (s3 == 0) goto L407708;
+t7 = 0x10003d3c;
+a1 = s0;
+t7 = MEM_U32(t7 + 0);
+if (t7 != zero) {
+// bdead 19 ra = MEM_U32(sp + 52);
+goto L4079a8;}
+//nop;
+a0 = 0x100015c4;
+a2 = s1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 48);
+goto L4079a4;
+L407708:
+s3 = 0x10003d28;
+t8 = MEM_U32(s3 + 0);
+//nop;
+if (t8 == 0) goto L40775c;
+//nop;
+a0 = 0x100015fc;
+a1 = 0x1;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40160003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4016000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+a1 = v0;
+//nop;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40060003 gp = MEM_U32(sp + 48);
+L40775c:
+//nop;
+a0 = s1;
+a1 = s0;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x10001600;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 19 gp = MEM_U32(sp + 48);
+goto L4079a4;
+L407790:
+s0 = 0x10002d34;
+s0 = MEM_U32(s0 + 0);
+//nop;
+if (s0 == 0) goto L4077e0;
+L4077a0:
+//nop;
+a0 = MEM_U32(s0 + 4);
+a1 = s2;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+if (v0 != 0) goto L4077d4;
+//nop;
+a0 = MEM_U32(sp + 136);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 19 gp = MEM_U32(sp + 48);
+goto L4079a4;
+L4077d4:
+s0 = MEM_U32(s0 + 0);
+//nop;
+if (s0 != 0) goto L4077a0;
+L4077e0:
+s1 = 0x10002d38;
+s0 = MEM_U32(s1 + 0);
+//nop;
+if (s0 == 0) goto L407818;
+L4077f0:
+//nop;
+a0 = MEM_U32(s0 + 4);
+a1 = s2;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400e0003 gp = MEM_U32(sp + 48);
+if (v0 == 0) goto L407818;
+s0 = MEM_U32(s0 + 0);
+//nop;
+if (s0 != 0) goto L4077f0;
+L407818:
+if (s0 != zero) {
+s3 = MEM_U32(sp + 92);
+goto L40794c;}
+//nop;
+a0 = 0x8;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+t9 = MEM_U32(s1 + 0);
+// bdead 440c000b gp = MEM_U32(sp + 48);
+s0 = v0;
+MEM_U32(v0 + 0) = t9;
+MEM_U32(s1 + 0) = v0;
+//nop;
+a0 = s2;
+//nop;
+v0 = f_savestring(mem, sp, a0);
+// bdead 400a000b gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 4) = v0;
+s3 = MEM_U32(sp + 92);
+v1 = zero < s3;
+//nop;
+if (v1 != 0) goto L407878;
+s4 = 0x10002cf4;
+v1 = MEM_U32(s4 + 0);
+v1 = (int)zero < (int)v1;
+L407878:
+t0 = 0x10002cec;
+t0 = MEM_U32(t0 + 0);
+//nop;
+if ((int)v1 >= (int)t0) goto L407924;
+s3 = 0x10003d28;
+t1 = MEM_U32(s3 + 0);
+//nop;
+if (t1 == 0) goto L4078e0;
+//nop;
+a0 = 0x10001604;
+a1 = 0x1;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 401a0003 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 401a000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s3 + 0);
+a1 = v0;
+//nop;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+L4078e0:
+//nop;
+a0 = s2;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 400a000b gp = MEM_U32(sp + 48);
+a0 = s2;
+a1 = v0;
+//nop;
+//nop;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+a1 = zero;
+//nop;
+a0 = 0x10001608;
+a0 = a0;
+v0 = f_deps_output(mem, sp, a0, a1);
+// bdead 400a0003 gp = MEM_U32(sp + 48);
+L407924:
+a0 = 0x10003d2c;
+a0 = MEM_U32(a0 + 0);
+if (a0 == zero) {
+s3 = MEM_U32(sp + 92);
+goto L40794c;}
+//nop;
+a1 = MEM_U32(s0 + 4);
+//nop;
+f_MDupdate(mem, sp, a0, a1);
+// bdead 40080003 gp = MEM_U32(sp + 48);
+s3 = MEM_U32(sp + 92);
+L40794c:
+s4 = 0x10002cf4;
+s3 = zero < s3;
+//nop;
+if (s3 == 0) goto L407968;
+t2 = MEM_U32(s4 + 0);
+t3 = t2 + 0x1;
+MEM_U32(s4 + 0) = t3;
+L407968:
+//nop;
+a0 = MEM_U32(sp + 136);
+a1 = s2;
+a2 = MEM_U32(sp + 176);
+f_finclude(mem, sp, a0, a1, a2);
+// bdead 40200001 gp = MEM_U32(sp + 48);
+if (s3 == 0) goto L407990;
+t4 = MEM_U32(s4 + 0);
+t5 = t4 + 0xffffffff;
+MEM_U32(s4 + 0) = t5;
+L407990:
+//nop;
+a0 = MEM_U32(sp + 136);
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 19 gp = MEM_U32(sp + 48);
+L4079a4:
+// bdead 19 ra = MEM_U32(sp + 52);
+L4079a8:
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 s3 = MEM_U32(sp + 32);
+// bdead 19 s4 = MEM_U32(sp + 36);
+// bdead 19 s5 = MEM_U32(sp + 40);
+// bdead 19 s6 = MEM_U32(sp + 44);
+// bdead 19 sp = sp + 0xa8;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_finclude(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L4079cc:
+//finclude:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+v0 = 0x10002cf0;
+// fdead 400000eb MEM_U32(sp + 36) = s4;
+s4 = a0;
+v0 = MEM_U32(v0 + 0);
+// fdead 402000eb MEM_U32(sp + 44) = ra;
+// fdead 402000eb MEM_U32(sp + 40) = gp;
+at = (int)v0 < (int)0xc7;
+// fdead 402000ef MEM_U32(sp + 32) = s3;
+// fdead 402000ef MEM_U32(sp + 28) = s2;
+// fdead 402000ef MEM_U32(sp + 24) = s1;
+// fdead 402000ef MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 100) = a1;
+MEM_U32(sp + 104) = a2;
+MEM_U32(sp + 76) = zero;
+if (at != 0) goto L407a58;
+t7 = 0x10005ec0;
+t6 = v0 << 3;
+//nop;
+t6 = t6 + v0;
+t6 = t6 << 2;
+t8 = t6 + t7;
+a0 = MEM_U32(t8 + 4);
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 40);
+a0 = v0;
+//nop;
+a1 = 0x1000160c;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L407d58;
+L407a58:
+//nop;
+a0 = s4;
+a1 = sp + 0x5c;
+a2 = sp + 0x58;
+v0 = f_file_size_and_mode(mem, sp, a0, a1, a2);
+// bdead 40200103 gp = MEM_U32(sp + 40);
+if ((int)v0 < 0) goto L407d24;
+t9 = 0x10002cf0;
+t2 = 0x10005ec0;
+a1 = 0x24;
+t9 = MEM_U32(t9 + 0);
+t0 = t9 << 3;
+t0 = t0 + t9;
+//nop;
+t0 = t0 << 2;
+t1 = t0 + 0x24;
+s2 = t1 + t2;
+a0 = s2;
+wrapper_bzero(mem, a0, a1);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 100);
+t4 = 0x1;
+t5 = 0x10002e74;
+MEM_U32(s2 + 8) = zero;
+MEM_U32(s2 + 4) = t4;
+MEM_U32(s2 + 0) = t3;
+t5 = MEM_U32(t5 + 0);
+MEM_U32(s2 + 28) = t5;
+t6 = MEM_U32(sp + 92);
+t7 = t6 & 0x8000;
+//nop;
+if (t7 == 0) goto L407b5c;
+//nop;
+v1 = MEM_U32(sp + 88);
+a0 = v1 + 0x2;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4028000b gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 16) = v0;
+MEM_U32(s2 + 20) = v0;
+t8 = MEM_U32(sp + 88);
+//nop;
+if ((int)t8 <= 0) goto L407c30;
+L407b00:
+t9 = MEM_U32(s2 + 16);
+t0 = MEM_U32(s2 + 8);
+a0 = s4;
+a2 = MEM_U32(sp + 88);
+a1 = t9 + t0;
+//nop;
+//nop;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 4028010b gp = MEM_U32(sp + 40);
+if ((int)v0 > 0) goto L407b38;
+if (v0 != zero) {
+t0 = MEM_U32(sp + 76);
+goto L407d28;}
+//nop;
+goto L407c30;
+L407b38:
+t1 = MEM_U32(s2 + 8);
+t2 = t1 + v0;
+MEM_U32(s2 + 8) = t2;
+t3 = MEM_U32(sp + 88);
+t4 = t3 - v0;
+MEM_U32(sp + 88) = t4;
+if ((int)t4 > 0) goto L407b00;
+//nop;
+goto L407c30;
+L407b5c:
+//nop;
+s0 = 0x7d0;
+a0 = 0x7d2;
+MEM_U32(sp + 88) = zero;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 402a000b gp = MEM_U32(sp + 40);
+s3 = v0;
+s1 = v0;
+L407b7c:
+//nop;
+v1 = MEM_U32(sp + 88);
+a0 = s4;
+a1 = s1;
+a2 = s0 - v1;
+v0 = wrapper_read(mem, a0, a1, a2);
+// bdead 403e010b gp = MEM_U32(sp + 40);
+if ((int)v0 < 0) goto L407d24;
+v1 = MEM_U32(sp + 88);
+if (v0 == 0) goto L407be0;
+v1 = v1 + v0;
+s1 = s1 + v0;
+if (s0 != v1) goto L407bd8;
+//nop;
+s0 = s0 << 1;
+MEM_U32(sp + 88) = v1;
+a1 = s0 + 0x2;
+a0 = s3;
+v0 = f_xrealloc(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 88);
+// bdead 402a001b gp = MEM_U32(sp + 40);
+s3 = v0;
+s1 = v0 + v1;
+L407bd8:
+MEM_U32(sp + 88) = v1;
+goto L407b7c;
+L407be0:
+//nop;
+v1 = MEM_U32(sp + 88);
+a0 = v1 + 0x2;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4038000b gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 16) = v0;
+MEM_U32(s2 + 20) = v0;
+//nop;
+a2 = MEM_U32(sp + 88);
+a0 = s3;
+a1 = v0;
+wrapper_bcopy(mem, a0, a1, a2);
+t5 = MEM_U32(sp + 88);
+// bdead 40384003 gp = MEM_U32(sp + 40);
+a0 = s3;
+MEM_U32(s2 + 8) = t5;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+L407c30:
+t6 = 0x10002ce8;
+t6 = MEM_U32(t6 + 0);
+if (t6 != zero) {
+v0 = MEM_U32(s2 + 8);
+goto L407c58;}
+//nop;
+a0 = s2;
+//nop;
+f_trigraph_pcp(mem, sp, a0);
+// bdead 40280003 gp = MEM_U32(sp + 40);
+v0 = MEM_U32(s2 + 8);
+L407c58:
+if ((int)v0 <= 0) {
+t1 = MEM_U32(s2 + 16);
+goto L407c8c;}
+t7 = MEM_U32(s2 + 16);
+a0 = 0xa;
+v1 = t7 + v0;
+t8 = MEM_U8(v1 + -1);
+if (a0 == t8) {
+t1 = MEM_U32(s2 + 16);
+goto L407c8c;}
+MEM_U8(v1 + 0) = (uint8_t)a0;
+t9 = MEM_U32(s2 + 8);
+v0 = t9 + 0x1;
+MEM_U32(s2 + 8) = v0;
+t1 = MEM_U32(s2 + 16);
+L407c8c:
+v1 = 0x10002cf0;
+t3 = 0x1;
+t2 = t1 + v0;
+MEM_U8(t2 + 0) = (uint8_t)zero;
+t4 = MEM_U32(v1 + 0);
+MEM_U32(sp + 76) = t3;
+a1 = MEM_U32(sp + 104);
+t5 = t4 + 0x1;
+MEM_U32(v1 + 0) = t5;
+//nop;
+a0 = s2;
+a2 = zero;
+a3 = 0x1;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40200183 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(sp + 104);
+a1 = zero;
+//nop;
+//nop;
+f_rescan(mem, sp, a0, a1);
+// bdead 40200003 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 104);
+a2 = zero;
+t6 = 0x10002cf0;
+t9 = 0x10005ec0;
+at = 0x10002cf0;
+t6 = MEM_U32(t6 + 0);
+a3 = 0x2;
+t7 = t6 + 0xffffffff;
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a0 = t8 + t9;
+//nop;
+MEM_U32(at + 0) = t7;
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40200101 gp = MEM_U32(sp + 40);
+L407d24:
+t0 = MEM_U32(sp + 76);
+L407d28:
+//nop;
+if (t0 != 0) goto L407d44;
+//nop;
+a0 = MEM_U32(sp + 100);
+//nop;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40200001 gp = MEM_U32(sp + 40);
+L407d44:
+//nop;
+a0 = s4;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 40);
+L407d58:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static uint64_t f_do_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L407d78:
+//do_define:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 116) = a3;
+MEM_U32(sp + 84) = zero;
+s4 = 0x10003fc8;
+t6 = MEM_U8(a0 + 0);
+s0 = a1;
+s1 = a2;
+t7 = s4 + t6;
+t8 = MEM_U8(t7 + 0);
+s2 = a0;
+if (t8 == zero) {
+v1 = MEM_U8(s2 + 0);
+goto L407dfc;}
+t9 = MEM_U8(s2 + 1);
+L407de4:
+s2 = s2 + 0x1;
+t0 = s4 + t9;
+t1 = MEM_U8(t0 + 0);
+if (t1 != zero) {
+t9 = MEM_U8(s2 + 1);
+goto L407de4;}
+v1 = MEM_U8(s2 + 0);
+L407dfc:
+t2 = 0x10003ec8;
+t3 = v1 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+if (t4 != 0) goto L407e74;
+at = 0xa;
+if (v1 == 0) goto L407e20;
+//nop;
+if (v1 != at) goto L407e44;
+L407e20:
+//nop;
+a0 = 0x10001634;
+MEM_U32(sp + 108) = s0;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 402c0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+goto L407e74;
+L407e44:
+fp = 0x10003d3c;
+t5 = MEM_U32(fp + 0);
+//nop;
+if (t5 != 0) goto L407e74;
+//nop;
+a0 = 0x1000166c;
+MEM_U32(sp + 108) = s0;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 402c0003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+L407e74:
+s7 = 0x10003dc8;
+fp = 0x10003d3c;
+MEM_U32(sp + 96) = s2;
+t6 = s7 + v1;
+t7 = MEM_U8(t6 + 0);
+at = s2 < s0;
+a0 = s1;
+//nop;
+if (t7 == 0) goto L407ec4;
+//nop;
+if (at == 0) goto L407ec4;
+v1 = MEM_U8(s2 + 1);
+L407ea4:
+s2 = s2 + 0x1;
+at = s2 < s0;
+t8 = s7 + v1;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L407ec4;
+if (at != zero) {
+v1 = MEM_U8(s2 + 1);
+goto L407ea4;}
+L407ec4:
+t1 = 0x10003d40;
+t0 = MEM_U32(sp + 96);
+t1 = MEM_U32(t1 + 0);
+a3 = s2 - t0;
+MEM_U32(sp + 92) = a3;
+a2 = t0;
+if (t1 == 0) goto L407f04;
+//nop;
+a1 = 0x100016ac;
+MEM_U32(sp + 108) = s0;
+// bdead c12801e3 t9 = t9;
+a1 = a1;
+func_4045c4(mem, sp, a0, a1, a2, a3);
+// bdead c1280003 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+s0 = MEM_U32(sp + 108);
+L407f04:
+at = 0x28;
+t1 = s4 + v1;
+if (v1 != at) goto L4082c4;
+MEM_U32(sp + 72) = zero;
+v1 = MEM_U8(s2 + 1);
+s3 = zero;
+s2 = s2 + 0x1;
+t2 = s4 + v1;
+t3 = MEM_U8(t2 + 0);
+at = 0x29;
+//nop;
+if (t3 == 0) goto L407f4c;
+v1 = MEM_U8(s2 + 1);
+L407f38:
+s2 = s2 + 0x1;
+t4 = s4 + v1;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+v1 = MEM_U8(s2 + 1);
+goto L407f38;}
+L407f4c:
+if (v1 == at) {
+s2 = s2 + 0x1;
+goto L4081e4;}
+s5 = 0x10001738;
+MEM_U32(sp + 108) = s0;
+s6 = 0x1;
+s5 = s5;
+L407f64:
+//nop;
+a0 = 0x14;
+//nop;
+v0 = f_alloca(mem, sp, a0);
+// bdead c1f801cb gp = MEM_U32(sp + 60);
+MEM_U32(v0 + 4) = s2;
+MEM_U32(v0 + 0) = s3;
+t6 = MEM_U32(sp + 72);
+t9 = 0x10003ec8;
+s0 = v0;
+MEM_U32(v0 + 12) = t6;
+t7 = MEM_U32(sp + 72);
+s3 = v0;
+t8 = t7 + 0x1;
+MEM_U32(sp + 72) = t8;
+MEM_U32(v0 + 16) = zero;
+v1 = MEM_U8(s2 + 0);
+t1 = v1 + t9;
+t0 = MEM_U8(t1 + 0);
+if (t0 != zero) {
+t3 = s7 + v1;
+goto L407fe0;}
+t2 = MEM_U32(fp + 0);
+if (t2 != zero) {
+t3 = s7 + v1;
+goto L407fe0;}
+//nop;
+a0 = 0x100016b4;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1fa01c3 gp = MEM_U32(sp + 60);
+v1 = MEM_U8(s2 + 0);
+t3 = s7 + v1;
+L407fe0:
+t4 = MEM_U8(t3 + 0);
+at = 0x2c;
+if (t4 == zero) {
+t8 = MEM_U32(s0 + 4);
+goto L40800c;}
+t5 = MEM_U8(s2 + 1);
+L407ff4:
+s2 = s2 + 0x1;
+t6 = s7 + t5;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+t5 = MEM_U8(s2 + 1);
+goto L407ff4;}
+t8 = MEM_U32(s0 + 4);
+L40800c:
+v0 = s2 - t8;
+MEM_U32(s0 + 8) = v0;
+t9 = MEM_U32(sp + 84);
+t1 = t9 + v0;
+t0 = t1 + 0x2;
+MEM_U32(sp + 84) = t0;
+v1 = MEM_U8(s2 + 0);
+t0 = MEM_U32(sp + 108);
+t2 = s4 + v1;
+t3 = MEM_U8(t2 + 0);
+if (t3 == zero) {
+t6 = MEM_U32(s0 + 8);
+goto L408058;}
+v1 = MEM_U8(s2 + 1);
+L408040:
+s2 = s2 + 0x1;
+t4 = s4 + v1;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+v1 = MEM_U8(s2 + 1);
+goto L408040;}
+t6 = MEM_U32(s0 + 8);
+L408058:
+//nop;
+if (t6 == 0) goto L408070;
+if (v1 == at) {
+at = 0x29;
+goto L408088;}
+at = 0x29;
+if (v1 == at) {
+at = 0x2c;
+goto L40808c;}
+L408070:
+//nop;
+a0 = 0x100016e4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 60);
+goto L408440;
+L408088:
+at = 0x2c;
+L40808c:
+if (v1 != at) {
+at = s2 < t0;
+goto L4080c8;}
+v1 = MEM_U8(s2 + 1);
+s2 = s2 + 0x1;
+t7 = s4 + v1;
+t8 = MEM_U8(t7 + 0);
+if (t8 == zero) {
+at = s2 < t0;
+goto L4080c8;}
+v1 = MEM_U8(s2 + 1);
+L4080b0:
+s2 = s2 + 0x1;
+t9 = s4 + v1;
+t1 = MEM_U8(t9 + 0);
+if (t1 != zero) {
+v1 = MEM_U8(s2 + 1);
+goto L4080b0;}
+at = s2 < t0;
+L4080c8:
+//nop;
+if (at != 0) goto L4080e8;
+//nop;
+a0 = 0x10001710;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 11 gp = MEM_U32(sp + 60);
+goto L408440;
+L4080e8:
+t2 = 0x10003d38;
+t2 = MEM_U32(t2 + 0);
+if (t2 == zero) {
+at = 0x29;
+goto L4081d4;}
+s0 = MEM_U32(s3 + 0);
+if (s0 == zero) {
+at = 0x29;
+goto L4081d4;}
+v0 = MEM_U32(s0 + 8);
+L408108:
+t3 = MEM_U32(s3 + 8);
+t5 = MEM_U32(s0 + 16);
+t4 = v0 ^ t3;
+t4 = t4 < 0x1;
+t6 = t5 < 0x1;
+t7 = t4 & t6;
+if (t7 == zero) {
+s0 = MEM_U32(s0 + 0);
+goto L4081c4;}
+//nop;
+a0 = MEM_U32(s3 + 4);
+a1 = MEM_U32(s0 + 4);
+a2 = v0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fa0003 gp = MEM_U32(sp + 60);
+if (v0 != 0) goto L4081c0;
+//nop;
+a0 = MEM_U32(s0 + 8);
+a0 = a0 + 0x1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c1fa000b gp = MEM_U32(sp + 60);
+s1 = v0;
+a0 = v0;
+//nop;
+a1 = MEM_U32(s0 + 4);
+a2 = MEM_U32(s0 + 8);
+//nop;
+v0 = wrapper_strncpy(mem, a0, a1, a2);
+t8 = MEM_U32(s0 + 8);
+// bdead c3fe0183 gp = MEM_U32(sp + 60);
+t9 = s1 + t8;
+MEM_U8(t9 + 0) = (uint8_t)zero;
+t1 = MEM_U32(fp + 0);
+//nop;
+if (t1 != 0) goto L4081a8;
+//nop;
+a0 = s5;
+a1 = s1;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 60);
+L4081a8:
+//nop;
+a0 = s1;
+//nop;
+wrapper_free(mem, a0);
+// bdead c1fa0003 gp = MEM_U32(sp + 60);
+MEM_U32(s0 + 16) = s6;
+L4081c0:
+s0 = MEM_U32(s0 + 0);
+L4081c4:
+if (s0 != zero) {
+v0 = MEM_U32(s0 + 8);
+goto L408108;}
+v1 = MEM_U8(s2 + 0);
+at = 0x29;
+L4081d4:
+//nop;
+if (v1 != at) goto L407f64;
+s0 = MEM_U32(sp + 108);
+s2 = s2 + 0x1;
+L4081e4:
+a1 = s0;
+if (s2 >= s0) goto L408210;
+v1 = MEM_U8(s2 + 0);
+s4 = 0x20;
+at = 0x9;
+if (s4 == v1) {
+s2 = s2 + 0x1;
+goto L408210;}
+//nop;
+if (v1 != at) goto L408210;
+s2 = s2 + 0x1;
+L408210:
+//nop;
+s4 = 0x20;
+a0 = s2;
+a2 = MEM_U32(sp + 72);
+a3 = s3;
+v0 = f_collect_expansion(mem, sp, a0, a1, a2, a3);
+// bdead c030000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(sp + 84);
+s2 = v0;
+//nop;
+a0 = a0 + 0x1;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c038000b gp = MEM_U32(sp + 60);
+MEM_U32(s2 + 16) = v0;
+s0 = zero;
+s1 = s3;
+if (s3 == 0) goto L4082b4;
+L408258:
+//nop;
+t0 = MEM_U32(s2 + 16);
+a0 = MEM_U32(s1 + 4);
+a2 = MEM_U32(s1 + 8);
+a1 = t0 + s0;
+wrapper_bcopy(mem, a0, a1, a2);
+v0 = MEM_U32(s1 + 0);
+t2 = MEM_U32(s1 + 8);
+// bdead c02e080b gp = MEM_U32(sp + 60);
+s0 = s0 + t2;
+if (v0 == 0) goto L4082ac;
+t5 = MEM_U32(s2 + 16);
+t3 = 0x2c;
+t4 = t5 + s0;
+MEM_U8(t4 + 0) = (uint8_t)t3;
+t6 = MEM_U32(s2 + 16);
+s0 = s0 + 0x1;
+t7 = t6 + s0;
+MEM_U8(t7 + 0) = (uint8_t)s4;
+v0 = MEM_U32(s1 + 0);
+s0 = s0 + 0x1;
+L4082ac:
+s1 = v0;
+if (v0 != 0) goto L408258;
+L4082b4:
+t8 = MEM_U32(s2 + 16);
+t9 = t8 + s0;
+MEM_U8(t9 + 0) = (uint8_t)zero;
+goto L408300;
+L4082c4:
+t0 = MEM_U8(t1 + 0);
+a1 = s0;
+//nop;
+if (t0 == 0) goto L4082d8;
+s2 = s2 + 0x1;
+L4082d8:
+//nop;
+a0 = s2;
+a2 = 0xffffffff;
+a3 = zero;
+v0 = f_collect_expansion(mem, sp, a0, a1, a2, a3);
+// bdead c000000b gp = MEM_U32(sp + 60);
+s2 = v0;
+t2 = 0x10001770;
+t2 = t2;
+MEM_U32(v0 + 16) = t2;
+L408300:
+//nop;
+a0 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 92);
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c008000b gp = MEM_U32(sp + 60);
+s0 = v0;
+a0 = MEM_U32(sp + 96);
+//nop;
+a1 = MEM_U32(sp + 92);
+a2 = v0;
+//nop;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c00a000b gp = MEM_U32(sp + 60);
+s1 = v0;
+if (v0 == 0) goto L408418;
+t5 = MEM_U32(v0 + 12);
+s3 = 0x17;
+//nop;
+if (s3 != t5) goto L40836c;
+//nop;
+a0 = s2;
+a1 = MEM_U32(v0 + 24);
+//nop;
+temp64 = f_compare_defs(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c01c0013 gp = MEM_U32(sp + 60);
+if (v0 == 0) goto L408408;
+L40836c:
+//nop;
+a0 = MEM_U32(sp + 92);
+a0 = a0 + 0x14;
+v0 = f_alloca(mem, sp, a0);
+// bdead c01c000b gp = MEM_U32(sp + 60);
+s0 = v0;
+a0 = MEM_U32(sp + 96);
+//nop;
+a1 = v0;
+a2 = MEM_U32(sp + 92);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead c01e01d3 gp = MEM_U32(sp + 60);
+t3 = MEM_U32(sp + 92);
+t6 = 0x10001774;
+t4 = s0 + t3;
+t6 = t6;
+t8 = MEM_U32_UNALIGNED(t6 + 0);
+//lwr $t8, 3($t6)
+STORE_U32_UNALIGNED(t4 + 0, t8);
+//swr $t8, 3($t4)
+t7 = MEM_U32_UNALIGNED(t6 + 4);
+//lwr $t7, 7($t6)
+STORE_U32_UNALIGNED(t4 + 4, t7);
+//swr $t7, 7($t4)
+t8 = MEM_U8(t6 + 8);
+MEM_U8(t4 + 8) = (uint8_t)t8;
+t7 = MEM_U8(t6 + 9);
+MEM_U8(t4 + 9) = (uint8_t)t7;
+t8 = MEM_U8(t6 + 10);
+MEM_U8(t4 + 10) = (uint8_t)t8;
+t9 = MEM_U32(fp + 0);
+if (t9 != zero) {
+MEM_U32(s1 + 12) = s3;
+goto L40840c;}
+//nop;
+a0 = s0;
+//nop;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1c0013 gp = MEM_U32(sp + 60);
+L408408:
+MEM_U32(s1 + 12) = s3;
+L40840c:
+MEM_U32(s1 + 24) = s2;
+v0 = zero;
+goto L408444;
+L408418:
+//nop;
+a0 = MEM_U32(sp + 96);
+a1 = MEM_U32(sp + 92);
+a2 = 0x17;
+a3 = s2;
+MEM_U32(sp + 16) = s0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 13 gp = MEM_U32(sp + 60);
+v0 = zero;
+goto L408444;
+L408440:
+v0 = 0x1;
+L408444:
+// bdead 19 ra = MEM_U32(sp + 68);
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0x68;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_compare_defs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L408474:
+//compare_defs:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000006b MEM_U32(sp + 60) = ra;
+// fdead 4000006b MEM_U32(sp + 56) = gp;
+// fdead 4000006b MEM_U32(sp + 52) = s5;
+// fdead 4000006b MEM_U32(sp + 48) = s4;
+// fdead 4000006b MEM_U32(sp + 44) = s3;
+// fdead 4000006b MEM_U32(sp + 40) = s2;
+// fdead 4000006b MEM_U32(sp + 36) = s1;
+// fdead 4000006b MEM_U32(sp + 32) = s0;
+t7 = MEM_U32(a0 + 0);
+t6 = MEM_U32(a1 + 0);
+a2 = a0;
+a3 = a1;
+s3 = MEM_U32(a0 + 8);
+s4 = MEM_U32(a1 + 8);
+s5 = 0x1;
+if (t6 == t7) goto L4084cc;
+v0 = 0x1;
+goto L408648;
+L4084cc:
+//nop;
+a0 = MEM_U32(a2 + 16);
+a1 = MEM_U32(a3 + 16);
+MEM_U32(sp + 68) = a3;
+MEM_U32(sp + 64) = a2;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40700013 gp = MEM_U32(sp + 56);
+if (v0 == 0) goto L4084f4;
+v0 = 0x1;
+goto L408648;
+L4084f4:
+t8 = MEM_U32(sp + 64);
+t9 = MEM_U32(sp + 68);
+s1 = MEM_U32(t8 + 12);
+s2 = MEM_U32(t9 + 12);
+//nop;
+if (s1 == 0) goto L4085e0;
+//nop;
+if (s2 == 0) goto L4085e0;
+v0 = MEM_U32(s2 + 8);
+L408518:
+s0 = MEM_U32(s1 + 8);
+//nop;
+if (v0 != s0) goto L408548;
+//nop;
+a0 = s3;
+a1 = s4;
+a2 = s0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 407c0013 gp = MEM_U32(sp + 56);
+if (v0 == 0) goto L408570;
+v0 = MEM_U32(s2 + 8);
+s0 = MEM_U32(s1 + 8);
+L408548:
+//nop;
+a0 = s5;
+a1 = s3;
+a2 = s0;
+a3 = s4;
+MEM_U32(sp + 16) = v0;
+MEM_U32(sp + 20) = zero;
+temp64 = f_comp_def_part(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403c0013 gp = MEM_U32(sp + 56);
+if (v0 != 0) goto L4085b4;
+L408570:
+t0 = MEM_U32(s2 + 12);
+t1 = MEM_U32(s1 + 12);
+s5 = zero;
+//nop;
+if (t0 != t1) goto L4085b4;
+t2 = MEM_U8(s2 + 4);
+t3 = MEM_U8(s1 + 4);
+//nop;
+if (t2 != t3) goto L4085b4;
+t4 = MEM_U8(s2 + 5);
+t5 = MEM_U8(s1 + 5);
+//nop;
+if (t4 != t5) goto L4085b4;
+t6 = MEM_U8(s2 + 6);
+t7 = MEM_U8(s1 + 6);
+if (t6 == t7) {
+t8 = MEM_U32(s1 + 8);
+goto L4085c0;}
+L4085b4:
+v0 = 0x1;
+goto L408648;
+// fdead 0 t8 = MEM_U32(s1 + 8);
+L4085c0:
+s1 = MEM_U32(s1 + 0);
+t9 = MEM_U32(s2 + 8);
+s2 = MEM_U32(s2 + 0);
+s3 = s3 + t8;
+s4 = s4 + t9;
+if (s1 == 0) goto L4085e0;
+if (s2 != zero) {
+v0 = MEM_U32(s2 + 8);
+goto L408518;}
+L4085e0:
+a0 = s5;
+if (s1 == s2) goto L4085f0;
+v0 = 0x1;
+goto L408648;
+L4085f0:
+t0 = MEM_U32(sp + 64);
+t4 = MEM_U32(sp + 68);
+t9 = 0x1;
+t1 = MEM_U32(t0 + 4);
+t6 = MEM_U32(t4 + 8);
+t2 = MEM_U32(t0 + 8);
+t5 = MEM_U32(t4 + 4);
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = s4 - t6;
+t3 = s3 - t2;
+t8 = t5 - t7;
+MEM_U32(sp + 16) = t8;
+a1 = s3;
+a3 = s4;
+a2 = t1 - t3;
+temp64 = f_comp_def_part(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 13 gp = MEM_U32(sp + 56);
+if (v0 == 0) goto L408644;
+v0 = 0x1;
+goto L408648;
+L408644:
+v0 = zero;
+L408648:
+// bdead 19 ra = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 32);
+// bdead 19 s1 = MEM_U32(sp + 36);
+// bdead 19 s2 = MEM_U32(sp + 40);
+// bdead 19 s3 = MEM_U32(sp + 44);
+// bdead 19 s4 = MEM_U32(sp + 48);
+// bdead 19 s5 = MEM_U32(sp + 52);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_comp_def_part(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40866c:
+//comp_def_part:
+//nop;
+//nop;
+//nop;
+t6 = MEM_U32(sp + 16);
+v1 = a1 + a2;
+v0 = v1;
+t1 = a3 + t6;
+t0 = t1;
+if (a0 == 0) goto L40870c;
+//nop;
+if (a1 == v1) goto L4086d0;
+t4 = 0x100040c8;
+t7 = MEM_U8(a1 + 0);
+t8 = t4 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L4086d0;
+a1 = a1 + 0x1;
+L4086b4:
+//nop;
+if (a1 == v0) goto L4086d0;
+t5 = MEM_U8(a1 + 0);
+t6 = t4 + t5;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+a1 = a1 + 0x1;
+goto L4086b4;}
+L4086d0:
+t4 = 0x100040c8;
+if (a3 == t1) goto L40870c;
+t8 = MEM_U8(a3 + 0);
+t9 = t4 + t8;
+t5 = MEM_U8(t9 + 0);
+if (t5 == zero) {
+t9 = MEM_U32(sp + 20);
+goto L408710;}
+a3 = a3 + 0x1;
+L4086f0:
+if (a3 == t0) {
+t9 = MEM_U32(sp + 20);
+goto L408710;}
+t6 = MEM_U8(a3 + 0);
+t7 = t4 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 != zero) {
+a3 = a3 + 0x1;
+goto L4086f0;}
+L40870c:
+t9 = MEM_U32(sp + 20);
+L408710:
+v1 = a1 ^ v0;
+t4 = 0x100040c8;
+v1 = zero < v1;
+if (t9 == 0) goto L4087a4;
+t1 = a3 ^ t0;
+t1 = zero < t1;
+if (v1 == 0) goto L408768;
+t5 = MEM_U8(v0 + -1);
+t6 = t4 + t5;
+t7 = MEM_U8(t6 + 0);
+//nop;
+if (t7 == 0) goto L408768;
+v0 = v0 + 0xffffffff;
+L408744:
+v1 = a1 ^ v0;
+v1 = zero < v1;
+//nop;
+if (v1 == 0) goto L408768;
+t8 = MEM_U8(v0 + -1);
+t9 = t4 + t8;
+t5 = MEM_U8(t9 + 0);
+if (t5 != zero) {
+v0 = v0 + 0xffffffff;
+goto L408744;}
+L408768:
+//nop;
+if (t1 == 0) goto L4087a4;
+t6 = MEM_U8(t0 + -1);
+t7 = t4 + t6;
+t8 = MEM_U8(t7 + 0);
+//nop;
+if (t8 == 0) goto L4087a4;
+t0 = t0 + 0xffffffff;
+L408788:
+//nop;
+if (a3 == t0) goto L4087a4;
+t9 = MEM_U8(t0 + -1);
+t5 = t4 + t9;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+t0 = t0 + 0xffffffff;
+goto L408788;}
+L4087a4:
+t1 = a3 ^ t0;
+if (v1 == 0) goto L408878;
+t1 = zero < t1;
+//nop;
+if (t1 == 0) goto L408878;
+a0 = MEM_U8(a1 + 0);
+L4087bc:
+t2 = MEM_U8(a3 + 0);
+t7 = t4 + a0;
+a2 = MEM_U8(t7 + 0);
+t8 = t4 + t2;
+//nop;
+if (a2 == 0) goto L408850;
+t3 = MEM_U8(t8 + 0);
+//nop;
+if (t3 == 0) goto L408850;
+//nop;
+if (v1 == 0) goto L408818;
+//nop;
+if (a2 == 0) goto L408818;
+a1 = a1 + 0x1;
+L4087f4:
+v1 = a1 ^ v0;
+v1 = zero < v1;
+//nop;
+if (v1 == 0) goto L408818;
+t9 = MEM_U8(a1 + 0);
+t5 = t4 + t9;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+a1 = a1 + 0x1;
+goto L4087f4;}
+L408818:
+//nop;
+if (t1 == 0) goto L408864;
+//nop;
+if (t3 == 0) goto L408864;
+a3 = a3 + 0x1;
+L40882c:
+//nop;
+if (a3 == t0) goto L408864;
+t7 = MEM_U8(a3 + 0);
+t8 = t4 + t7;
+t9 = MEM_U8(t8 + 0);
+if (t9 != zero) {
+a3 = a3 + 0x1;
+goto L40882c;}
+//nop;
+goto L408864;
+L408850:
+a1 = a1 + 0x1;
+if (a0 != t2) goto L408878;
+v1 = a1 ^ v0;
+v1 = zero < v1;
+a3 = a3 + 0x1;
+L408864:
+t1 = a3 ^ t0;
+if (v1 == 0) goto L408878;
+t1 = zero < t1;
+if (t1 != zero) {
+a0 = MEM_U8(a1 + 0);
+goto L4087bc;}
+L408878:
+v0 = v1;
+if (v1 != 0) goto L408888;
+v0 = a3 ^ t0;
+v0 = zero < v0;
+L408888:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_collect_expansion(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L408890:
+//collect_expansion:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff88;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = a1 < a0;
+s0 = a0;
+s2 = a1;
+// fdead 400a01ef MEM_U32(sp + 60) = ra;
+// fdead 400a01ef MEM_U32(sp + 56) = fp;
+// fdead 400a01ef MEM_U32(sp + 52) = gp;
+// fdead 400a01ef MEM_U32(sp + 48) = s7;
+// fdead 400a01ef MEM_U32(sp + 44) = s6;
+// fdead 400a01ef MEM_U32(sp + 40) = s5;
+// fdead 400a01ef MEM_U32(sp + 36) = s4;
+// fdead 400a01ef MEM_U32(sp + 32) = s3;
+// fdead 400a01ef MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 128) = a2;
+MEM_U32(sp + 132) = a3;
+MEM_U32(sp + 96) = zero;
+MEM_U32(sp + 92) = zero;
+MEM_U32(sp + 88) = zero;
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 72) = zero;
+if (at == 0) goto L408914;
+//nop;
+MEM_U32(sp + 124) = a1;
+//nop;
+wrapper_abort(mem);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+s2 = MEM_U32(sp + 124);
+L408914:
+at = s0 < s2;
+s6 = s2;
+s1 = s0;
+if (at == 0) goto L408960;
+v0 = 0x100040c8;
+t6 = MEM_U8(s2 + -1);
+t7 = v0 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 == zero) {
+at = s0 < s6;
+goto L408964;}
+s6 = s6 + 0xffffffff;
+L408940:
+if (s0 >= s6) {
+at = s0 < s6;
+goto L408964;}
+t9 = MEM_U8(s6 + -1);
+t0 = v0 + t9;
+t1 = MEM_U8(t0 + 0);
+if (t1 != zero) {
+s6 = s6 + 0xffffffff;
+goto L408940;}
+L408960:
+at = s0 < s6;
+L408964:
+v0 = 0x100040c8;
+if (at == 0) goto L4089a4;
+t2 = MEM_U8(s0 + 0);
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 == zero) {
+t8 = s2 - s6;
+goto L4089a8;}
+s1 = s1 + 0x1;
+L408984:
+if (s1 >= s6) {
+t8 = s2 - s6;
+goto L4089a8;}
+t5 = MEM_U8(s1 + 0);
+t6 = v0 + t5;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+s1 = s1 + 0x1;
+goto L408984;}
+L4089a4:
+t8 = s2 - s6;
+L4089a8:
+t0 = s1 - s0;
+t1 = t0 << 1;
+t9 = t8 << 1;
+t2 = t9 + t1;
+//nop;
+t3 = s6 - s1;
+a1 = t2 + t3;
+a1 = a1 + 0x17;
+MEM_U32(sp + 84) = a1;
+s1 = s0;
+a0 = 0x1;
+MEM_U32(sp + 124) = s2;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t4 = MEM_U32(sp + 128);
+// bdead 408621cb gp = MEM_U32(sp + 52);
+MEM_U32(sp + 116) = v0;
+s7 = v0 + 0x14;
+at = s0 < s6;
+MEM_U32(v0 + 8) = s7;
+s2 = s7;
+MEM_U32(v0 + 0) = t4;
+if (at == 0) goto L408a4c;
+t5 = MEM_U8(s0 + 0);
+t6 = 0x100040c8;
+t7 = t5 + t6;
+t8 = MEM_U8(t7 + 0);
+t0 = 0xa;
+if (t8 == 0) goto L408a4c;
+L408a18:
+MEM_U8(s2 + 0) = (uint8_t)t0;
+t9 = MEM_U8(s1 + 0);
+s1 = s1 + 0x1;
+at = s1 < s6;
+s2 = s2 + 0x2;
+MEM_U8(s2 + -1) = (uint8_t)t9;
+if (at == 0) goto L408a4c;
+t1 = MEM_U8(s1 + 0);
+t2 = 0x100040c8;
+t3 = t1 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+t0 = 0xa;
+goto L408a18;}
+L408a4c:
+if (s1 >= s6) {
+t2 = MEM_U32(sp + 72);
+goto L409034;}
+fp = 0x5c;
+s5 = 0x10003fc8;
+t5 = MEM_U32(sp + 76);
+L408a64:
+MEM_U32(sp + 68) = zero;
+s4 = MEM_U8(s1 + 0);
+t7 = 0x10003d4c;
+t6 = t5 + 0x1;
+MEM_U32(sp + 76) = t6;
+MEM_U32(sp + 72) = zero;
+MEM_U8(s2 + 0) = (uint8_t)s4;
+t7 = MEM_U32(t7 + 0);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+at = 0x22;
+if (t7 != 0) goto L408cd0;
+at = 0x22;
+if (s4 == at) {
+at = 0x23;
+goto L408ac0;}
+at = 0x23;
+if (s4 == at) {
+at = 0x27;
+goto L408b74;}
+at = 0x27;
+if (s4 == at) {
+at = s1 < s6;
+goto L408ac4;}
+at = s1 < s6;
+if (s4 == fp) goto L408b2c;
+//nop;
+goto L408dcc;
+L408ac0:
+at = s1 < s6;
+L408ac4:
+if (at == zero) {
+t9 = MEM_U8(s1 + 0);
+goto L408b1c;}
+v0 = MEM_U8(s1 + 0);
+if (s4 == v0) {
+t9 = MEM_U8(s1 + 0);
+goto L408b1c;}
+MEM_U8(s2 + 0) = (uint8_t)v0;
+L408adc:
+t8 = MEM_U8(s1 + 0);
+s2 = s2 + 0x1;
+if (fp != t8) {
+s1 = s1 + 0x1;
+goto L408b00;}
+t0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t0;
+s1 = s1 + 0x1;
+L408b00:
+if (s1 >= s6) {
+t9 = MEM_U8(s1 + 0);
+goto L408b1c;}
+v0 = MEM_U8(s1 + 0);
+if (s4 != v0) {
+MEM_U8(s2 + 0) = (uint8_t)v0;
+goto L408adc;}
+t9 = MEM_U8(s1 + 0);
+L408b1c:
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t9;
+goto L408dcc;
+L408b2c:
+if (at == zero) {
+at = s1 < s6;
+goto L408b58;}
+v0 = MEM_U8(s1 + 0);
+at = 0x23;
+if (v0 != at) {
+at = s1 < s6;
+goto L408b58;}
+MEM_U8(s2 + -1) = (uint8_t)v0;
+s2 = s2 + 0x0;
+s1 = s1 + 0x1;
+goto L408dcc;
+// fdead 0 at = s1 < s6;
+L408b58:
+//nop;
+if (at == 0) goto L408dcc;
+t1 = MEM_U8(s1 + 0);
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t1;
+goto L408dcc;
+L408b74:
+if (s1 >= s6) {
+v0 = MEM_U8(s1 + 0);
+goto L408c5c;}
+t2 = MEM_U8(s1 + 0);
+at = 0x23;
+if (t2 != at) {
+v0 = MEM_U8(s1 + 0);
+goto L408c5c;}
+s2 = s2 + 0xffffffff;
+if (s7 >= s2) {
+t0 = MEM_U8(s1 + 1);
+goto L408bdc;}
+t3 = MEM_U8(s2 + -1);
+t4 = s5 + t3;
+t5 = MEM_U8(t4 + 0);
+if (t5 == zero) {
+t0 = MEM_U8(s1 + 1);
+goto L408bdc;}
+s2 = s2 + 0xffffffff;
+L408bb8:
+if (s7 >= s2) {
+t0 = MEM_U8(s1 + 1);
+goto L408bdc;}
+t6 = MEM_U8(s2 + -1);
+t7 = s5 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 != zero) {
+s2 = s2 + 0xffffffff;
+goto L408bb8;}
+t0 = MEM_U8(s1 + 1);
+L408bdc:
+s1 = s1 + 0x1;
+t5 = 0x1;
+t9 = s5 + t0;
+t1 = MEM_U8(t9 + 0);
+if (t1 == zero) {
+t6 = MEM_U32(sp + 76);
+goto L408c10;}
+t2 = MEM_U8(s1 + 1);
+L408bf8:
+s1 = s1 + 0x1;
+t3 = s5 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+t2 = MEM_U8(s1 + 1);
+goto L408bf8;}
+t6 = MEM_U32(sp + 76);
+L408c10:
+at = 0x1;
+MEM_U32(sp + 92) = s1;
+MEM_U32(sp + 72) = t5;
+if (t6 != at) goto L408dcc;
+t7 = 0x10003d38;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L408dcc;
+t8 = 0x10003d3c;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 != 0) goto L408dcc;
+//nop;
+a0 = 0x10001780;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead c1ec01c3 gp = MEM_U32(sp + 52);
+goto L408dcc;
+// fdead 0 v0 = MEM_U8(s1 + 0);
+L408c5c:
+s2 = s2 + 0xffffffff;
+t0 = s5 + v0;
+t9 = MEM_U8(t0 + 0);
+//nop;
+if (t9 == 0) goto L408c88;
+v0 = MEM_U8(s1 + 1);
+L408c74:
+s1 = s1 + 0x1;
+t1 = s5 + v0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+v0 = MEM_U8(s1 + 1);
+goto L408c74;}
+L408c88:
+//nop;
+if (s1 == s6) goto L408cb0;
+t3 = 0x10003ec8;
+t6 = MEM_U32(sp + 128);
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+//nop;
+if (t5 == 0) goto L408cb0;
+//nop;
+if ((int)t6 > 0) goto L408cc8;
+L408cb0:
+//nop;
+a0 = 0x100017dc;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ec01c3 gp = MEM_U32(sp + 52);
+goto L408dcc;
+L408cc8:
+MEM_U32(sp + 88) = s1;
+goto L408dcc;
+L408cd0:
+t7 = MEM_U32(sp + 80);
+if (s4 == at) goto L408cfc;
+at = 0x27;
+if (s4 == at) {
+at = 0x2f;
+goto L408cfc;}
+at = 0x2f;
+t1 = MEM_U32(sp + 80);
+if (s4 == at) goto L408d50;
+t0 = MEM_U32(sp + 80);
+if (s4 == fp) goto L408d1c;
+//nop;
+goto L408dcc;
+L408cfc:
+//nop;
+if (t7 == 0) goto L408d14;
+//nop;
+if (s4 != t7) goto L408dcc;
+MEM_U32(sp + 80) = zero;
+goto L408dcc;
+L408d14:
+MEM_U32(sp + 80) = s4;
+goto L408dcc;
+L408d1c:
+at = s1 < s6;
+if (t0 == 0) goto L408dcc;
+//nop;
+if (s1 >= s6) goto L408dcc;
+v0 = MEM_U8(s1 + 0);
+if (t0 == v0) {
+MEM_U8(s2 + 0) = (uint8_t)v0;
+goto L408d44;}
+//nop;
+if (fp != v0) goto L408dcc;
+MEM_U8(s2 + 0) = (uint8_t)v0;
+L408d44:
+s2 = s2 + 0x1;
+s1 = s1 + 0x1;
+goto L409024;
+L408d50:
+//nop;
+if (t1 != 0) goto L408dcc;
+t2 = MEM_U8(s1 + 0);
+at = 0x2a;
+//nop;
+if (t2 != at) goto L408dcc;
+s1 = s1 + 0x1;
+s2 = s2 + 0xffffffff;
+if (s1 >= s6) goto L408dc8;
+t3 = MEM_U8(s1 + -2);
+at = 0x2a;
+if (t3 != at) {
+s1 = s1 + 0x1;
+goto L408d9c;}
+t4 = MEM_U8(s1 + -1);
+at = 0x2f;
+if (t4 == at) {
+MEM_U32(sp + 92) = s1;
+goto L408dcc;}
+s1 = s1 + 0x1;
+L408d9c:
+if (s1 >= s6) {
+MEM_U32(sp + 92) = s1;
+goto L408dcc;}
+t5 = MEM_U8(s1 + -2);
+at = 0x2a;
+if (t5 != at) {
+s1 = s1 + 0x1;
+goto L408d9c;}
+t6 = MEM_U8(s1 + -1);
+at = 0x2f;
+if (t6 != at) {
+s1 = s1 + 0x1;
+goto L408d9c;}
+L408dc8:
+MEM_U32(sp + 92) = s1;
+L408dcc:
+t7 = 0x10003dc8;
+t9 = MEM_U32(sp + 128);
+t8 = s4 + t7;
+t0 = MEM_U8(t8 + 0);
+if (t0 == zero) {
+at = s1 < s6;
+goto L409028;}
+s3 = s1 + 0xffffffff;
+if ((int)t9 <= 0) goto L409024;
+s2 = s2 + 0xffffffff;
+if (s1 == s6) goto L408e2c;
+t1 = MEM_U8(s1 + 0);
+t2 = t1 + t7;
+t3 = MEM_U8(t2 + 0);
+//nop;
+if (t3 == 0) goto L408e2c;
+s1 = s1 + 0x1;
+L408e0c:
+//nop;
+if (s1 == s6) goto L408e2c;
+t4 = MEM_U8(s1 + 0);
+t5 = 0x10003dc8;
+t6 = t4 + t5;
+t8 = MEM_U8(t6 + 0);
+if (t8 != zero) {
+s1 = s1 + 0x1;
+goto L408e0c;}
+L408e2c:
+t0 = 0x10003ec8;
+s0 = MEM_U32(sp + 132);
+t9 = s4 + t0;
+t1 = MEM_U8(t9 + 0);
+if (t1 == zero) {
+t5 = MEM_U32(sp + 68);
+goto L408f94;}
+if (s0 == zero) {
+t5 = MEM_U32(sp + 68);
+goto L408f94;}
+a0 = MEM_U32(s0 + 4);
+L408e50:
+t2 = MEM_U8(a0 + 0);
+if (s4 != t2) {
+s0 = MEM_U32(s0 + 0);
+goto L408f88;}
+t3 = MEM_U32(s0 + 8);
+a2 = s1 - s3;
+if (a2 != t3) {
+s0 = MEM_U32(s0 + 0);
+goto L408f88;}
+//nop;
+a1 = s3;
+//nop;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fe0183 gp = MEM_U32(sp + 52);
+if (v0 != 0) goto L408f84;
+//nop;
+a0 = 0x10;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead c1de018b gp = MEM_U32(sp + 52);
+MEM_U32(v0 + 0) = zero;
+t4 = MEM_U32(sp + 92);
+t6 = 0x10003d4c;
+MEM_U8(v0 + 6) = (uint8_t)zero;
+t5 = t4 ^ s3;
+t5 = t5 < 0x1;
+MEM_U8(v0 + 5) = (uint8_t)t5;
+t6 = MEM_U32(t6 + 0);
+t9 = MEM_U32(sp + 88);
+t8 = MEM_U32(sp + 80);
+t1 = t9 ^ s3;
+if (t6 == 0) goto L408ed4;
+t0 = zero < t8;
+MEM_U8(v0 + 4) = (uint8_t)t0;
+goto L408edc;
+L408ed4:
+t1 = t1 < 0x1;
+MEM_U8(v0 + 4) = (uint8_t)t1;
+L408edc:
+v1 = MEM_U32(sp + 96);
+t7 = MEM_U32(sp + 116);
+if (v1 != zero) {
+MEM_U32(v1 + 0) = v0;
+goto L408ef8;}
+MEM_U32(t7 + 12) = v0;
+goto L408ef8;
+// fdead 0 MEM_U32(v1 + 0) = v0;
+L408ef8:
+MEM_U32(sp + 96) = v0;
+t2 = MEM_U32(s0 + 12);
+t3 = s2 - s7;
+MEM_U32(v0 + 8) = t3;
+MEM_U32(v0 + 12) = t2;
+t4 = MEM_U8(s1 + 0);
+v1 = s1;
+s7 = s2;
+t5 = s5 + t4;
+t6 = MEM_U8(t5 + 0);
+t4 = 0x1;
+if (t6 == zero) {
+t1 = v1 + 0x2;
+goto L408f48;}
+t8 = MEM_U8(v1 + 1);
+L408f30:
+v1 = v1 + 0x1;
+t0 = s5 + t8;
+t9 = MEM_U8(t0 + 0);
+if (t9 != zero) {
+t8 = MEM_U8(v1 + 1);
+goto L408f30;}
+t1 = v1 + 0x2;
+L408f48:
+//nop;
+if (s6 < t1) goto L408f7c;
+t7 = MEM_U8(v1 + 0);
+at = 0x23;
+//nop;
+if (t7 != at) goto L408f7c;
+t2 = MEM_U8(v1 + 1);
+at = 0x23;
+t3 = 0x1;
+//nop;
+if (t2 != at) goto L408f7c;
+MEM_U8(v0 + 6) = (uint8_t)t3;
+L408f7c:
+MEM_U32(sp + 68) = t4;
+goto L408f90;
+L408f84:
+s0 = MEM_U32(s0 + 0);
+L408f88:
+if (s0 != zero) {
+a0 = MEM_U32(s0 + 4);
+goto L408e50;}
+L408f90:
+t5 = MEM_U32(sp + 68);
+L408f94:
+t6 = MEM_U32(sp + 88);
+a1 = t6 ^ s3;
+if (t5 != 0) goto L409024;
+v1 = s1;
+a1 = a1 < 0x1;
+if (s3 == s1) {
+s1 = s3;
+goto L409008;}
+s1 = s3;
+a0 = v1 - s3;
+a0 = a0 & 0x3;
+v0 = a0 + s3;
+if (a0 == 0) goto L408fdc;
+L408fc0:
+t8 = MEM_U8(s1 + 0);
+s1 = s1 + 0x1;
+s2 = s2 + 0x1;
+MEM_U8(s2 + -1) = (uint8_t)t8;
+if (v0 != s1) goto L408fc0;
+//nop;
+if (s1 == v1) goto L409008;
+L408fdc:
+t0 = MEM_U8(s1 + 0);
+s1 = s1 + 0x4;
+s2 = s2 + 0x4;
+MEM_U8(s2 + -4) = (uint8_t)t0;
+t9 = MEM_U8(s1 + -3);
+MEM_U8(s2 + -3) = (uint8_t)t9;
+t1 = MEM_U8(s1 + -2);
+MEM_U8(s2 + -2) = (uint8_t)t1;
+t7 = MEM_U8(s1 + -1);
+MEM_U8(s2 + -1) = (uint8_t)t7;
+if (s1 != v1) goto L408fdc;
+L409008:
+if (a1 == zero) {
+at = s1 < s6;
+goto L409028;}
+//nop;
+a0 = 0x10001814;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1cc01c3 gp = MEM_U32(sp + 52);
+L409024:
+at = s1 < s6;
+L409028:
+if (at != zero) {
+t5 = MEM_U32(sp + 76);
+goto L408a64;}
+t2 = MEM_U32(sp + 72);
+L409034:
+if (t2 == zero) {
+v0 = MEM_U32(sp + 124);
+goto L409074;}
+t3 = 0x10003d38;
+t3 = MEM_U32(t3 + 0);
+if (t3 == zero) {
+v0 = MEM_U32(sp + 124);
+goto L409074;}
+t4 = 0x10003d3c;
+t4 = MEM_U32(t4 + 0);
+if (t4 != zero) {
+v0 = MEM_U32(sp + 124);
+goto L409074;}
+//nop;
+a0 = 0x1000184c;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40880003 gp = MEM_U32(sp + 52);
+v0 = MEM_U32(sp + 124);
+L409074:
+if (s6 >= v0) {
+at = s6 < v0;
+goto L4090dc;}
+if (s6 >= v0) {
+MEM_U8(s2 + 0) = (uint8_t)zero;
+goto L409104;}
+t5 = MEM_U8(s6 + 0);
+t6 = 0x100040c8;
+t8 = t5 + t6;
+t0 = MEM_U8(t8 + 0);
+t9 = 0xa;
+if (t0 == 0) goto L409100;
+L4090a0:
+MEM_U8(s2 + 0) = (uint8_t)t9;
+t1 = MEM_U8(s6 + 0);
+s6 = s6 + 0x1;
+at = s6 < v0;
+s2 = s2 + 0x2;
+MEM_U8(s2 + -1) = (uint8_t)t1;
+if (at == 0) goto L409100;
+t7 = MEM_U8(s6 + 0);
+t2 = 0x100040c8;
+t3 = t7 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+t9 = 0xa;
+goto L4090a0;}
+MEM_U8(s2 + 0) = (uint8_t)zero;
+goto L409104;
+L4090dc:
+t5 = 0x10003d4c;
+t6 = 0xa;
+t8 = 0x20;
+t5 = MEM_U32(t5 + 0);
+if (t5 != zero) {
+MEM_U8(s2 + 0) = (uint8_t)zero;
+goto L409104;}
+MEM_U8(s2 + 0) = (uint8_t)t6;
+MEM_U8(s2 + 1) = (uint8_t)t8;
+s2 = s2 + 0x2;
+L409100:
+MEM_U8(s2 + 0) = (uint8_t)zero;
+L409104:
+t0 = MEM_U32(sp + 116);
+t9 = MEM_U32(t0 + 8);
+v0 = s2 - t9;
+MEM_U32(t0 + 4) = v0;
+t1 = MEM_U32(sp + 84);
+if ((int)v0 < (int)t1) {
+// bdead 40000001 ra = MEM_U32(sp + 60);
+goto L409138;}
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+// bdead 40000001 ra = MEM_U32(sp + 60);
+L409138:
+v0 = MEM_U32(sp + 116);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x78;
+return v0;
+}
+
+static uint64_t f_do_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L409168:
+//do_line:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+sp = sp + 0xffffff88;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+MEM_U32(sp + 124) = a1;
+a1 = a0;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+MEM_U32(sp + 112) = t9;
+//nop;
+// fdead 460181e3 MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 120) = a0;
+MEM_U32(sp + 128) = a2;
+MEM_U32(sp + 132) = a3;
+a2 = MEM_U32(sp + 124);
+// fdead 460181e3 MEM_U32(sp + 32) = gp;
+// fdead 460181e3 MEM_U32(sp + 28) = s1;
+// fdead 460181e3 MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 68) = zero;
+a3 = zero;
+a0 = sp + 0x4c;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(sp + 92);
+a2 = 0x10003fc8;
+t1 = MEM_U8(s0 + 0);
+t2 = a2 + t1;
+t3 = MEM_U8(t2 + 0);
+if (t3 == zero) {
+v1 = MEM_U8(s0 + 0);
+goto L409210;}
+t4 = MEM_U8(s0 + 1);
+L4091f8:
+s0 = s0 + 0x1;
+t5 = a2 + t4;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+t4 = MEM_U8(s0 + 1);
+goto L4091f8;}
+v1 = MEM_U8(s0 + 0);
+L409210:
+a1 = 0xfb4cba0;
+t7 = v1 + a1;
+t8 = MEM_U8(t7 + 1);
+t9 = t8 & 0x4;
+//nop;
+if (t9 != 0) goto L409240;
+//nop;
+a0 = 0x100018a4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+L409240:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_atoi(mem, a0);
+// bdead 4002010b gp = MEM_U32(sp + 32);
+t0 = v0 + 0xffffffff;
+MEM_U32(sp + 72) = t0;
+v1 = MEM_U8(s0 + 0);
+a1 = 0xfb4cba0;
+v0 = 0x22;
+a2 = 0x10003fc8;
+t1 = v1 + a1;
+t2 = MEM_U8(t1 + 1);
+t3 = t2 & 0x4;
+//nop;
+if (t3 == 0) goto L40929c;
+v1 = MEM_U8(s0 + 1);
+L409284:
+s0 = s0 + 0x1;
+t4 = v1 + a1;
+t5 = MEM_U8(t4 + 1);
+t6 = t5 & 0x4;
+if (t6 != zero) {
+v1 = MEM_U8(s0 + 1);
+goto L409284;}
+L40929c:
+t0 = a2 + v1;
+if (v1 == 0) goto L4092d0;
+t7 = 0x100040c8;
+t8 = v1 + t7;
+t9 = MEM_U8(t8 + 0);
+if (t9 != zero) {
+t1 = MEM_U8(t0 + 0);
+goto L4092d4;}
+//nop;
+a0 = 0x100018c4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+L4092d0:
+t1 = MEM_U8(t0 + 0);
+L4092d4:
+//nop;
+if (t1 == 0) goto L4092f4;
+v1 = MEM_U8(s0 + 1);
+L4092e0:
+s0 = s0 + 0x1;
+t2 = a2 + v1;
+t3 = MEM_U8(t2 + 0);
+if (t3 != zero) {
+v1 = MEM_U8(s0 + 1);
+goto L4092e0;}
+L4092f4:
+//nop;
+if (v0 != v1) goto L409500;
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+a0 = s0;
+//nop;
+if (v1 == 0) goto L409330;
+//nop;
+if (v0 == v1) goto L409330;
+v1 = MEM_U8(s0 + 1);
+L40931c:
+s0 = s0 + 0x1;
+//nop;
+if (v1 == 0) goto L409330;
+if (v0 != v1) {
+v1 = MEM_U8(s0 + 1);
+goto L40931c;}
+L409330:
+if (v0 == v1) {
+v1 = MEM_U8(s0 + 1);
+goto L409354;}
+//nop;
+a0 = 0x100018e4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+// fdead 0 v1 = MEM_U8(s0 + 1);
+L409354:
+s1 = s0 - a0;
+s0 = s0 + 0x1;
+t4 = a2 + v1;
+t5 = MEM_U8(t4 + 0);
+at = 0x31;
+//nop;
+if (t5 == 0) goto L409388;
+v1 = MEM_U8(s0 + 1);
+L409374:
+s0 = s0 + 0x1;
+t6 = a2 + v1;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+v1 = MEM_U8(s0 + 1);
+goto L409374;}
+L409388:
+//nop;
+if (v1 == 0) goto L40941c;
+t8 = 0x1;
+if (v1 != at) goto L4093a0;
+MEM_U32(sp + 68) = t8;
+goto L4093cc;
+L4093a0:
+at = 0x32;
+t9 = 0x2;
+if (v1 != at) goto L4093b4;
+MEM_U32(sp + 68) = t9;
+goto L4093cc;
+L4093b4:
+//nop;
+a0 = 0x10001904;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+L4093cc:
+v1 = MEM_U8(s0 + 1);
+s0 = s0 + 0x1;
+t0 = a2 + v1;
+t1 = MEM_U8(t0 + 0);
+//nop;
+if (t1 == 0) goto L4093fc;
+v1 = MEM_U8(s0 + 1);
+L4093e8:
+s0 = s0 + 0x1;
+t2 = a2 + v1;
+t3 = MEM_U8(t2 + 0);
+if (t3 != zero) {
+v1 = MEM_U8(s0 + 1);
+goto L4093e8;}
+L4093fc:
+//nop;
+if (v1 == 0) goto L40941c;
+//nop;
+a0 = 0x10001924;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+L40941c:
+//nop;
+a1 = s1;
+a2 = 0x25;
+MEM_U32(sp + 56) = a0;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t4 = v0 << 2;
+t5 = 0x10003ba0;
+t5 = t5;
+v1 = t4 + t5;
+s0 = MEM_U32(v1 + 0);
+MEM_U32(sp + 60) = v1;
+//nop;
+if (s0 == 0) goto L409498;
+t6 = MEM_U32(s0 + 16);
+L409458:
+if (s1 != t6) {
+s0 = MEM_U32(s0 + 0);
+goto L409490;}
+//nop;
+a0 = MEM_U32(s0 + 24);
+a1 = MEM_U32(sp + 56);
+a2 = s1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 4006000b gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L40948c;
+t7 = MEM_U32(s0 + 24);
+t8 = MEM_U32(sp + 112);
+MEM_U32(t8 + 0) = t7;
+goto L409498;
+L40948c:
+s0 = MEM_U32(s0 + 0);
+L409490:
+if (s0 != zero) {
+t6 = MEM_U32(s0 + 16);
+goto L409458;}
+L409498:
+if (s0 != zero) {
+t3 = MEM_U32(sp + 72);
+goto L409524;}
+//nop;
+a0 = 0x1;
+a1 = s1 + 0x1d;
+//nop;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t9 = MEM_U32(sp + 60);
+// bdead 4404000b gp = MEM_U32(sp + 32);
+v1 = v0 + 0x1c;
+t0 = MEM_U32(t9 + 0);
+a2 = s1;
+MEM_U32(v0 + 0) = t0;
+t1 = MEM_U32(sp + 60);
+MEM_U32(t1 + 0) = v0;
+MEM_U32(v0 + 16) = s1;
+MEM_U32(v0 + 24) = v1;
+t2 = MEM_U32(sp + 112);
+MEM_U32(t2 + 0) = v1;
+//nop;
+a1 = MEM_U32(v0 + 24);
+a0 = MEM_U32(sp + 56);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+goto L409520;
+L409500:
+if (v1 == zero) {
+t3 = MEM_U32(sp + 72);
+goto L409524;}
+//nop;
+a0 = 0x10001944;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+goto L409594;
+L409520:
+t3 = MEM_U32(sp + 72);
+L409524:
+t4 = MEM_U32(sp + 112);
+a2 = zero;
+MEM_U32(t4 + 4) = t3;
+//nop;
+a3 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 128);
+a0 = MEM_U32(sp + 112);
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a0 = MEM_U32(sp + 128);
+t5 = MEM_U32(sp + 112);
+// bdead 4000403b gp = MEM_U32(sp + 32);
+t0 = MEM_U32(a0 + 20);
+t1 = MEM_U32(a0 + 16);
+t6 = MEM_U32(t5 + 20);
+t7 = MEM_U32(t5 + 16);
+t3 = MEM_U32(a0 + 8);
+t9 = MEM_U32(t5 + 8);
+t2 = t0 - t1;
+t8 = t6 - t7;
+t4 = t3 - t2;
+a1 = t9 - t8;
+if ((int)a1 < (int)t4) {
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L409598;}
+//nop;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 32);
+L409594:
+// bdead 19 ra = MEM_U32(sp + 36);
+L409598:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x78;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_undef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L4095a8:
+//do_undef:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = MEM_U8(a0 + 0);
+s2 = 0x10003fc8;
+s1 = a0;
+s3 = a1;
+t6 = s2 + v0;
+t7 = MEM_U8(t6 + 0);
+//nop;
+if (t7 == 0) goto L409610;
+v0 = MEM_U8(s1 + 1);
+L4095fc:
+s1 = s1 + 0x1;
+t8 = s2 + v0;
+t9 = MEM_U8(t8 + 0);
+if (t9 != zero) {
+v0 = MEM_U8(s1 + 1);
+goto L4095fc;}
+L409610:
+t0 = 0x10003ec8;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+if (t2 != 0) goto L409670;
+at = 0xa;
+if (v0 == 0) goto L409634;
+//nop;
+if (v0 != at) goto L40964c;
+L409634:
+//nop;
+a0 = 0x10001964;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+goto L409670;
+L40964c:
+t3 = 0x10003d3c;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 != 0) goto L409670;
+//nop;
+a0 = 0x10001998;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+L409670:
+//nop;
+a0 = s1;
+a1 = 0xffffffff;
+a2 = 0xffffffff;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c01db gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 == 0) goto L4096f0;
+L409690:
+t4 = MEM_U32(v0 + 12);
+at = 0x17;
+//nop;
+if (t4 == at) goto L4096b8;
+//nop;
+a0 = 0x100019d4;
+a1 = MEM_U32(s0 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401e0003 gp = MEM_U32(sp + 40);
+L4096b8:
+//nop;
+a0 = s0;
+//nop;
+f_delete_macro(mem, sp, a0);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+a0 = s1;
+a1 = 0xffffffff;
+//nop;
+a2 = 0xffffffff;
+//nop;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401c01db gp = MEM_U32(sp + 40);
+s0 = v0;
+if (v0 != 0) goto L409690;
+L4096f0:
+v0 = 0x10003dc8;
+t5 = MEM_U8(s1 + 0);
+a2 = s1;
+at = s1 < s3;
+t6 = v0 + t5;
+t7 = MEM_U8(t6 + 0);
+a0 = MEM_U32(sp + 56);
+//nop;
+if (t7 == 0) goto L409740;
+//nop;
+if (at == 0) goto L409740;
+t8 = MEM_U8(s1 + 1);
+L409720:
+s1 = s1 + 0x1;
+at = s1 < s3;
+t9 = v0 + t8;
+t0 = MEM_U8(t9 + 0);
+//nop;
+if (t0 == 0) goto L409740;
+if (at != zero) {
+t8 = MEM_U8(s1 + 1);
+goto L409720;}
+L409740:
+t1 = 0x10003d40;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 == 0) goto L40976c;
+//nop;
+a1 = 0x100019e4;
+a3 = s1 - a2;
+// bdead 401c01e3 t9 = t9;
+a1 = a1;
+func_4045c4(mem, sp, a0, a1, a2, a3);
+// bdead 401c01db gp = MEM_U32(sp + 40);
+L40976c:
+t2 = 0x10003d38;
+t2 = MEM_U32(t2 + 0);
+if (t2 == zero) {
+// bdead 19 ra = MEM_U32(sp + 44);
+goto L4097d8;}
+v0 = MEM_U8(s1 + 0);
+t3 = s2 + v0;
+t4 = MEM_U8(t3 + 0);
+//nop;
+if (t4 == 0) goto L4097a8;
+t5 = MEM_U8(s1 + 1);
+L409794:
+s1 = s1 + 0x1;
+t6 = s2 + t5;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+t5 = MEM_U8(s1 + 1);
+goto L409794;}
+L4097a8:
+if (s1 == s3) {
+// bdead 19 ra = MEM_U32(sp + 44);
+goto L4097d8;}
+t8 = 0x10003d3c;
+t8 = MEM_U32(t8 + 0);
+if (t8 != zero) {
+// bdead 19 ra = MEM_U32(sp + 44);
+goto L4097d8;}
+//nop;
+a0 = 0x100019ec;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 40);
+// bdead 19 ra = MEM_U32(sp + 44);
+L4097d8:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_do_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L4097f0:
+//do_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 48) = a0;
+v0 = a1 - a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+a0 = v0 + 0x1;
+MEM_U32(sp + 36) = v0;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+a1 = v0;
+//nop;
+a2 = MEM_U32(sp + 36);
+MEM_U32(sp + 40) = v0;
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+a3 = MEM_U32(sp + 40);
+t7 = MEM_U32(sp + 36);
+// bdead 40010183 gp = MEM_U32(sp + 24);
+t8 = a3 + t7;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+t9 = MEM_U8(a3 + 0);
+v0 = 0x10003fc8;
+t0 = v0 + t9;
+t1 = MEM_U8(t0 + 0);
+//nop;
+if (t1 == 0) goto L40988c;
+t2 = MEM_U8(a3 + 1);
+L409878:
+a3 = a3 + 0x1;
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+t2 = MEM_U8(a3 + 1);
+goto L409878;}
+L40988c:
+//nop;
+a0 = 0x10001a28;
+a1 = a3;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static uint64_t f_do_once(uint8_t *mem, uint32_t sp, uint32_t v0) {
+const uint32_t zero = 0;
+uint32_t v1 = 0, a0 = 0, a1 = 0, t0 = 0, t6 = 0, t8 = 0, t9 = 0;
+L4098c8:
+//do_once:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffd0;
+// fdead 4000001b MEM_U32(sp + 28) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000001b MEM_U32(sp + 24) = gp;
+a1 = zero;
+t6 = v1 << 3;
+if ((int)v1 < 0) goto L409928;
+t6 = t6 + v1;
+v1 = 0x10005ec0;
+t6 = t6 << 2;
+v0 = t6 + v1;
+t8 = MEM_U32(v0 + 0);
+L409908:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L40991c;}
+a1 = v0;
+goto L409928;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L40991c:
+if (v0 >= v1) {
+t8 = MEM_U32(v0 + 0);
+goto L409908;}
+L409928:
+if (a1 == zero) {
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L409980;}
+//nop;
+a0 = 0x8;
+MEM_U32(sp + 40) = a1;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+MEM_U32(sp + 36) = v0;
+v1 = 0x10002d34;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+MEM_U32(v1 + 0) = v0;
+//nop;
+a0 = MEM_U32(a1 + 0);
+//nop;
+v0 = f_savestring(mem, sp, a0);
+t0 = MEM_U32(sp + 36);
+// bdead 219 gp = MEM_U32(sp + 24);
+MEM_U32(t0 + 4) = v0;
+// bdead 19 ra = MEM_U32(sp + 28);
+L409980:
+// bdead 19 sp = sp + 0x30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_pragma(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0;
+uint64_t temp64;
+L40998c:
+//do_pragma:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001e3 MEM_U32(sp + 28) = ra;
+// fdead 400001e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+v0 = MEM_U8(a0 + 0);
+v1 = 0x20;
+a1 = 0x9;
+if (v1 == v0) {
+v0 = MEM_U8(a0 + 1);
+goto L4099c8;}
+//nop;
+if (a1 != v0) goto L4099e0;
+v0 = MEM_U8(a0 + 1);
+L4099c8:
+a1 = 0x9;
+a0 = a0 + 0x1;
+if (v1 == v0) {
+v0 = MEM_U8(a0 + 1);
+goto L4099c8;}
+if (a1 == v0) {
+v0 = MEM_U8(a0 + 1);
+goto L4099c8;}
+L4099e0:
+//nop;
+a1 = 0x10001a34;
+a2 = 0x4;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 40000019 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L409a0c;
+//nop;
+//nop;
+temp64 = f_do_once(mem, sp, v0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+L409a0c:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_do_ident(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L409a1c:
+//do_ident:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003d38;
+sp = sp + 0xffffffe0;
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 24) = gp;
+if ((int)t6 < (int)0x2) {
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L409a70;}
+t7 = 0x10003d3c;
+t7 = MEM_U32(t7 + 0);
+if (t7 != zero) {
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L409a70;}
+//nop;
+a0 = 0x10001a3c;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+L409a70:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t f_do_sccs(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0;
+uint64_t temp64;
+L409a7c:
+//do_sccs:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003d38;
+sp = sp + 0xffffffe0;
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 24) = gp;
+if (t6 == zero) {
+// bdead 19 ra = MEM_U32(sp + 28);
+goto L409abc;}
+//nop;
+a0 = 0x10001a6c;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 ra = MEM_U32(sp + 28);
+L409abc:
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_if(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L409ac8:
+//do_if:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+sp = sp + 0xffffffd8;
+t6 = MEM_U32(t6 + 0);
+// fdead 420081e3 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 44) = a1;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+MEM_U32(sp + 32) = t9;
+//nop;
+// fdead 460181e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1 - a0;
+v0 = f_eval_if_expression(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+a1 = v0 < 0x1;
+//nop;
+a2 = 0x5;
+//nop;
+temp64 = f_conditional_skip(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_elif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L409b48:
+//do_elif:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+v1 = 0x10002e74;
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffd8;
+v1 = MEM_U32(v1 + 0);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+v0 = t7 + t8;
+t9 = MEM_U32(v0 + 28);
+// fdead 460181fb MEM_U32(sp + 28) = ra;
+// fdead 460181fb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+MEM_U32(sp + 32) = v0;
+if (v1 != t9) goto L409bb8;
+//nop;
+a0 = 0x10001a88;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L409d34;
+L409bb8:
+v0 = MEM_U32(v1 + 16);
+at = 0x5;
+if (v0 == at) {
+at = 0x8;
+goto L409c90;}
+at = 0x8;
+//nop;
+if (v0 == at) goto L409c90;
+//nop;
+a0 = 0x10001aa8;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t0 = 0x10002e74;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001abc;
+t0 = MEM_U32(t0 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(t0 + 8);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+t2 = MEM_U32(sp + 32);
+t1 = 0x10002e74;
+t1 = MEM_U32(t1 + 0);
+a0 = MEM_U32(t1 + 4);
+//nop;
+if (a0 == 0) goto L409c6c;
+a1 = MEM_U32(t2 + 0);
+//nop;
+if (a1 == 0) goto L409c6c;
+//nop;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L409c6c;
+t3 = 0x10002e74;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001ad0;
+t3 = MEM_U32(t3 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(t3 + 4);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+L409c6c:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001adc;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = 0x10002e74;
+v1 = MEM_U32(v1 + 0);
+L409c90:
+t5 = 0x10002e74;
+t4 = 0x8;
+MEM_U32(v1 + 16) = t4;
+t5 = MEM_U32(t5 + 0);
+a0 = MEM_U32(sp + 40);
+t6 = MEM_U32(t5 + 12);
+//nop;
+if (t6 == 0) goto L409ccc;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = zero;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L409d34;
+L409ccc:
+//nop;
+t8 = MEM_U32(sp + 44);
+a1 = t8 - a0;
+v0 = f_eval_if_expression(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L409d00;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = zero;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L409d34;
+L409d00:
+v1 = 0x10002e74;
+a2 = 0x1;
+a3 = zero;
+v1 = MEM_U32(v1 + 0);
+t9 = MEM_U32(v1 + 12);
+t0 = t9 + 0x1;
+MEM_U32(v1 + 12) = t0;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 32);
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+L409d34:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_eval_if_expression(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+uint64_t temp64;
+L409d44:
+//eval_if_expression:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+//nop;
+MEM_U32(sp + 88) = a0;
+a0 = 0x10001ae0;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 92) = a1;
+t6 = 0xffffffff;
+// fdead 400081eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = 0xffffffff;
+a2 = 0x19;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000000b gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 88);
+t7 = MEM_U32(sp + 92);
+//nop;
+MEM_U32(sp + 48) = v0;
+a0 = sp + 0x34;
+a3 = zero;
+a2 = a1 + t7;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 48);
+//nop;
+//nop;
+f_delete_macro(mem, sp, a0);
+// bdead 400001c1 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+v0 = f_parse_c_expression(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+a0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000001 ra = MEM_U32(sp + 36);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static uint64_t f_do_xifdef(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L409e00:
+//do_xifdef:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+sp = sp + 0xffffffd0;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+// fdead 420081e3 MEM_U32(sp + 20) = s0;
+s0 = a0;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+t9 = t7 + t8;
+// fdead 460381e3 MEM_U32(sp + 28) = ra;
+// fdead 460381e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+MEM_U32(sp + 40) = t9;
+a0 = MEM_U8(a0 + 0);
+v0 = 0x10003fc8;
+t0 = v0 + a0;
+t1 = MEM_U8(t0 + 0);
+//nop;
+if (t1 == 0) goto L409e78;
+a0 = MEM_U8(s0 + 1);
+L409e64:
+s0 = s0 + 0x1;
+t2 = v0 + a0;
+t3 = MEM_U8(t2 + 0);
+if (t3 != zero) {
+a0 = MEM_U8(s0 + 1);
+goto L409e64;}
+L409e78:
+//nop;
+if (a1 == s0) goto L409eb4;
+t4 = MEM_U8(a1 + -1);
+t5 = v0 + t4;
+t6 = MEM_U8(t5 + 0);
+//nop;
+if (t6 == 0) goto L409eb4;
+a1 = a1 + 0xffffffff;
+L409e98:
+//nop;
+if (a1 == s0) goto L409eb4;
+t7 = MEM_U8(a1 + -1);
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+if (t9 != zero) {
+a1 = a1 + 0xffffffff;
+goto L409e98;}
+L409eb4:
+v0 = 0x10003dc8;
+v1 = s0;
+t5 = MEM_U32(sp + 60);
+t0 = v0 + a0;
+t1 = MEM_U8(t0 + 0);
+//nop;
+if (t1 == 0) goto L409ee8;
+t2 = MEM_U8(v1 + 1);
+L409ed4:
+v1 = v1 + 0x1;
+t3 = v0 + t2;
+t4 = MEM_U8(t3 + 0);
+if (t4 != zero) {
+t2 = MEM_U8(v1 + 1);
+goto L409ed4;}
+L409ee8:
+//nop;
+if (v1 != s0) goto L409f50;
+t6 = 0x10003d4c;
+s0 = MEM_U32(t5 + 12);
+t6 = MEM_U32(t6 + 0);
+s0 = s0 ^ 0x3;
+s0 = s0 < 0x1;
+//nop;
+if (t6 != 0) goto L40a028;
+t7 = 0x10003d3c;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 != 0) goto L40a028;
+//nop;
+if (v1 != a1) goto L409f30;
+a0 = 0x10001ae8;
+a0 = a0;
+goto L409f38;
+L409f30:
+a0 = 0x10001b00;
+a0 = a0;
+L409f38:
+//nop;
+t8 = MEM_U32(sp + 60);
+a1 = MEM_U32(t8 + 8);
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+goto L40a028;
+L409f50:
+t9 = 0x10003d38;
+at = a0 < 0x30;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L409fac;
+if (at != 0) {
+at = a0 < 0x3a;
+goto L409fac;}
+//nop;
+if (a0 >= 0x3a) goto L409fac;
+t0 = 0x10003d3c;
+t1 = MEM_U32(sp + 60);
+t0 = MEM_U32(t0 + 0);
+//nop;
+if (t0 != 0) goto L409ff8;
+//nop;
+a0 = 0x10001b28;
+a1 = MEM_U32(t1 + 8);
+MEM_U32(sp + 36) = v1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+goto L409ff8;
+L409fac:
+//nop;
+if (v1 == a1) goto L409ff8;
+t2 = 0x10003d4c;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 != 0) goto L409ff8;
+t3 = 0x10003d3c;
+t4 = MEM_U32(sp + 60);
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 != 0) goto L409ff8;
+//nop;
+a0 = 0x10001b4c;
+a1 = MEM_U32(t4 + 8);
+MEM_U32(sp + 36) = v1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+L409ff8:
+//nop;
+a0 = s0;
+a1 = v1 - s0;
+a2 = 0xffffffff;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t6 = MEM_U32(sp + 60);
+t5 = v0 < 0x1;
+// bdead 4000c001 gp = MEM_U32(sp + 24);
+t7 = MEM_U32(t6 + 12);
+t8 = t7 ^ 0x4;
+t8 = t8 < 0x1;
+s0 = t5 ^ t8;
+L40a028:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = s0;
+a2 = 0x5;
+temp64 = f_conditional_skip(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x30;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_conditional_skip(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a050:
+//conditional_skip:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+a1 = 0x14;
+a0 = 0x1;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+a0 = MEM_U32(sp + 32);
+// bdead 4000002b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(a0 + 0);
+v1 = 0x10002e74;
+MEM_U32(v0 + 4) = t6;
+t7 = MEM_U32(a0 + 4);
+MEM_U32(v0 + 8) = t7;
+t8 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(sp + 40);
+MEM_U32(v1 + 0) = v0;
+MEM_U32(v0 + 16) = t9;
+t1 = MEM_U32(sp + 36);
+if (t1 == zero) {
+v0 = MEM_U32(v1 + 0);
+goto L40a0dc;}
+//nop;
+a1 = zero;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L40a104;
+// fdead 0 v0 = MEM_U32(v1 + 0);
+L40a0dc:
+a1 = 0x10003da0;
+a2 = 0x1;
+t2 = MEM_U32(v0 + 12);
+a3 = zero;
+t3 = t2 + 0x1;
+MEM_U32(v0 + 12) = t3;
+//nop;
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+L40a104:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_skip_if_group(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0,
+s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40a114:
+//skip_if_group:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+// fdead 400001eb MEM_U32(sp + 68) = ra;
+// fdead 400001eb MEM_U32(sp + 64) = fp;
+// fdead 400001eb MEM_U32(sp + 60) = gp;
+// fdead 400001eb MEM_U32(sp + 56) = s7;
+// fdead 400001eb MEM_U32(sp + 52) = s6;
+// fdead 400001eb MEM_U32(sp + 48) = s5;
+// fdead 400001eb MEM_U32(sp + 44) = s4;
+// fdead 400001eb MEM_U32(sp + 40) = s3;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 32) = s1;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 100) = a1;
+t8 = MEM_U32(a0 + 8);
+t7 = MEM_U32(a0 + 16);
+t0 = 0x10002e74;
+s0 = MEM_U32(a0 + 20);
+t9 = t7 + t8;
+t0 = MEM_U32(t0 + 0);
+at = s0 < t9;
+MEM_U32(sp + 84) = t9;
+MEM_U32(sp + 72) = s0;
+MEM_U32(sp + 76) = t0;
+if (at == 0) goto L40a6f0;
+fp = 0x10003dc8;
+s7 = 0x10003fc8;
+s6 = 0x5c;
+s4 = 0xa;
+s2 = 0x2a;
+s1 = 0x2f;
+v0 = MEM_U8(s0 + 0);
+L40a1a0:
+s0 = s0 + 0x1;
+t1 = v0 + 0xfffffff6;
+if (v0 < 0x30) goto L40a1c0;
+t5 = MEM_U32(sp + 84);
+if (v0 == s6) goto L40a2a0;
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;
+L40a1c0:
+if (t1 >= 0x26) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40a2d0;
+case 1: goto L40a6e0;
+case 2: goto L40a6e0;
+case 3: goto L40a6e0;
+case 4: goto L40a6e0;
+case 5: goto L40a6e0;
+case 6: goto L40a6e0;
+case 7: goto L40a6e0;
+case 8: goto L40a6e0;
+case 9: goto L40a6e0;
+case 10: goto L40a6e0;
+case 11: goto L40a6e0;
+case 12: goto L40a6e0;
+case 13: goto L40a6e0;
+case 14: goto L40a6e0;
+case 15: goto L40a6e0;
+case 16: goto L40a6e0;
+case 17: goto L40a6e0;
+case 18: goto L40a6e0;
+case 19: goto L40a6e0;
+case 20: goto L40a6e0;
+case 21: goto L40a6e0;
+case 22: goto L40a6e0;
+case 23: goto L40a6e0;
+case 24: goto L40a260;
+case 25: goto L40a2e8;
+case 26: goto L40a6e0;
+case 27: goto L40a6e0;
+case 28: goto L40a6e0;
+case 29: goto L40a260;
+case 30: goto L40a6e0;
+case 31: goto L40a6e0;
+case 32: goto L40a6e0;
+case 33: goto L40a6e0;
+case 34: goto L40a6e0;
+case 35: goto L40a6e0;
+case 36: goto L40a6e0;
+case 37: goto L40a1e8;
+}
+L40a1e8:
+a0 = MEM_U8(s0 + 0);
+//nop;
+if (s6 != a0) goto L40a218;
+t2 = MEM_U8(s0 + 1);
+//nop;
+if (s4 != t2) goto L40a218;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+a0 = MEM_U8(s0 + 0);
+L40a218:
+if (s2 == a0) {
+a0 = MEM_U32(sp + 96);
+goto L40a23c;}
+t3 = 0x10003d20;
+t3 = MEM_U32(t3 + 0);
+if (t3 == zero) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+if (s1 != a0) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+a0 = MEM_U32(sp + 96);
+L40a23c:
+s0 = s0 + 0x1;
+MEM_U32(a0 + 20) = s0;
+//nop;
+a1 = a0 + 0x4;
+//nop;
+temp64 = f_skip_to_end_of_comment(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ac001b gp = MEM_U32(sp + 60);
+s0 = v0;
+goto L40a6e0;
+L40a260:
+t4 = 0x10003d4c;
+v0 = MEM_U32(sp + 96);
+a0 = s0 + 0xffffffff;
+t4 = MEM_U32(t4 + 0);
+a1 = MEM_U32(sp + 84);
+a3 = v0 + 0x4;
+if (t4 != zero) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+//nop;
+a2 = MEM_U32(v0 + 4);
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = zero;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ac001b gp = MEM_U32(sp + 60);
+s0 = v0;
+goto L40a6e0;
+L40a2a0:
+if (s0 >= t5) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+t6 = MEM_U8(s0 + 0);
+t7 = MEM_U32(sp + 96);
+//nop;
+if (s4 != t6) goto L40a2c8;
+t8 = MEM_U32(t7 + 4);
+t0 = t8 + 0x1;
+MEM_U32(t7 + 4) = t0;
+L40a2c8:
+s0 = s0 + 0x1;
+goto L40a6e0;
+L40a2d0:
+t9 = MEM_U32(sp + 96);
+t1 = MEM_U32(t9 + 4);
+t2 = t1 + 0x1;
+MEM_U32(t9 + 4) = t2;
+MEM_U32(sp + 72) = s0;
+goto L40a6e0;
+L40a2e8:
+t4 = MEM_U32(sp + 96);
+t3 = s0 + 0xffffffff;
+MEM_U32(t4 + 20) = t3;
+t5 = MEM_U32(sp + 72);
+if (t5 == zero) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+v1 = 0x10003d20;
+s0 = MEM_U32(sp + 72);
+v1 = MEM_U32(v1 + 0);
+L40a30c:
+a0 = MEM_U8(s0 + 0);
+L40a310:
+t6 = s7 + a0;
+t8 = MEM_U8(t6 + 0);
+//nop;
+if (t8 == 0) goto L40a328;
+s0 = s0 + 0x1;
+goto L40a30c;
+L40a328:
+//nop;
+if (s6 != a0) goto L40a344;
+t0 = MEM_U8(s0 + 1);
+//nop;
+if (s4 != t0) goto L40a344;
+s0 = s0 + 0x2;
+goto L40a30c;
+L40a344:
+//nop;
+if (s1 != a0) goto L40a398;
+t7 = MEM_U8(s0 + 1);
+//nop;
+if (s2 != t7) goto L40a398;
+t1 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+if (s2 != t1) {
+t9 = MEM_U8(s0 + 1);
+goto L40a378;}
+t2 = MEM_U8(s0 + 1);
+//nop;
+if (s1 == t2) goto L40a390;
+t9 = MEM_U8(s0 + 1);
+L40a378:
+s0 = s0 + 0x1;
+if (s2 != t9) {
+t9 = MEM_U8(s0 + 1);
+goto L40a378;}
+t3 = MEM_U8(s0 + 1);
+if (s1 != t3) {
+t9 = MEM_U8(s0 + 1);
+goto L40a378;}
+L40a390:
+s0 = s0 + 0x2;
+goto L40a30c;
+L40a398:
+if (v1 == zero) {
+t8 = MEM_U32(sp + 96);
+goto L40a3f0;}
+if (s1 != a0) {
+t8 = MEM_U32(sp + 96);
+goto L40a3f0;}
+t4 = MEM_U8(s0 + 1);
+if (s1 != t4) {
+t8 = MEM_U32(sp + 96);
+goto L40a3f0;}
+t5 = MEM_U8(s0 + 2);
+s0 = s0 + 0x3;
+v0 = s4 ^ t5;
+if (zero >= v0) {
+a0 = MEM_U8(s0 + 0);
+goto L40a310;}
+t6 = MEM_U8(s0 + 0);
+L40a3d0:
+s0 = s0 + 0x1;
+v0 = s4 ^ t6;
+if (zero < v0) {
+t6 = MEM_U8(s0 + 0);
+goto L40a3d0;}
+a0 = MEM_U8(s0 + 0);
+goto L40a310;
+// fdead 0 t8 = MEM_U32(sp + 96);
+L40a3f0:
+v0 = MEM_U32(t8 + 20);
+if (s0 == v0) {
+s0 = v0 + 0x1;
+goto L40a408;}
+s0 = v0 + 0x1;
+goto L40a6e0;
+// fdead 0 s0 = v0 + 0x1;
+L40a408:
+s5 = 0x10002d40;
+L40a40c:
+a0 = MEM_U8(s0 + 0);
+t0 = s7 + a0;
+t7 = MEM_U8(t0 + 0);
+//nop;
+if (t7 == 0) goto L40a428;
+s0 = s0 + 0x1;
+goto L40a40c;
+L40a428:
+//nop;
+if (s6 != a0) goto L40a444;
+t1 = MEM_U8(s0 + 1);
+//nop;
+if (s4 != t1) goto L40a444;
+s0 = s0 + 0x2;
+goto L40a40c;
+L40a444:
+if (s1 != a0) {
+s3 = s0;
+goto L40a49c;}
+t2 = MEM_U8(s0 + 1);
+if (s2 != t2) {
+s3 = s0;
+goto L40a49c;}
+t9 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+if (s2 != t9) {
+t4 = MEM_U8(s0 + 1);
+goto L40a478;}
+t3 = MEM_U8(s0 + 1);
+//nop;
+if (s1 == t3) goto L40a490;
+t4 = MEM_U8(s0 + 1);
+L40a478:
+s0 = s0 + 0x1;
+if (s2 != t4) {
+t4 = MEM_U8(s0 + 1);
+goto L40a478;}
+t5 = MEM_U8(s0 + 1);
+if (s1 != t5) {
+t4 = MEM_U8(s0 + 1);
+goto L40a478;}
+L40a490:
+s0 = s0 + 0x2;
+goto L40a40c;
+// fdead 0 s3 = s0;
+L40a49c:
+t6 = fp + a0;
+v1 = MEM_U8(t6 + 0);
+//nop;
+if (v1 == 0) goto L40a4b4;
+s0 = s0 + 0x1;
+goto L40a4f4;
+L40a4b4:
+//nop;
+if (s6 != a0) goto L40a4e8;
+t8 = MEM_U8(s0 + 1);
+//nop;
+if (s4 != t8) goto L40a4e8;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_name_newline_fix(mem, sp, a0);
+t0 = MEM_U8(s0 + 0);
+// bdead c1fe020b gp = MEM_U32(sp + 60);
+t7 = fp + t0;
+v1 = MEM_U8(t7 + 0);
+L40a4e8:
+//nop;
+if (v1 == 0) goto L40a4fc;
+s0 = s0 + 0x1;
+L40a4f4:
+a0 = MEM_U8(s0 + 0);
+goto L40a49c;
+L40a4fc:
+t1 = 0x10002d40;
+t1 = MEM_U32(t1 + 0);
+if ((int)t1 < 0) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+t2 = 0x10002d40;
+v0 = MEM_U32(t2 + 0);
+L40a514:
+//nop;
+a0 = s3;
+a1 = MEM_U32(s5 + 8);
+a2 = v0;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead c1fe01db gp = MEM_U32(sp + 60);
+if (v0 != 0) goto L40a6d0;
+t9 = MEM_U32(s5 + 0);
+t3 = t9 + s3;
+t4 = MEM_U8(t3 + 0);
+t5 = fp + t4;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+v0 = MEM_U32(s5 + 20);
+goto L40a6d4;}
+t8 = MEM_U32(sp + 100);
+if (t8 != zero) {
+// bdead 19 ra = MEM_U32(sp + 68);
+goto L40a6fc;}
+t0 = MEM_U32(s5 + 12);
+t7 = t0 + 0xfffffffd;
+if (t7 >= 0xa) {
+t8 = MEM_U32(sp + 84);
+goto L40a6e4;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40a588;
+case 1: goto L40a588;
+case 2: goto L40a588;
+case 3: goto L40a5d8;
+case 4: goto L40a6e0;
+case 5: goto L40a610;
+case 6: goto L40a6e0;
+case 7: goto L40a6e0;
+case 8: goto L40a6e0;
+case 9: goto L40a5d8;
+}
+L40a588:
+//nop;
+a0 = 0x1;
+a1 = 0x14;
+//nop;
+temp64 = f_xcalloc(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee001b gp = MEM_U32(sp + 60);
+t1 = 0x10002e74;
+at = 0x10002e74;
+t1 = MEM_U32(t1 + 0);
+MEM_U32(v0 + 0) = t1;
+t2 = MEM_U32(sp + 96);
+MEM_U32(at + 0) = v0;
+t9 = MEM_U32(t2 + 4);
+MEM_U32(v0 + 8) = t9;
+t3 = MEM_U32(sp + 96);
+t4 = MEM_U32(t3 + 0);
+MEM_U32(v0 + 4) = t4;
+t5 = MEM_U32(s5 + 12);
+MEM_U32(v0 + 16) = t5;
+goto L40a6e0;
+L40a5d8:
+t6 = 0x10003d38;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L40a610;
+t0 = 0x10002e74;
+t8 = MEM_U32(sp + 76);
+t0 = MEM_U32(t0 + 0);
+//nop;
+if (t8 == t0) goto L40a610;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_validate_else(mem, sp, a0);
+// bdead c1ee01cb gp = MEM_U32(sp + 60);
+L40a610:
+t7 = 0x10002cf0;
+t2 = 0x10005ec0;
+v1 = 0x10002e74;
+t7 = MEM_U32(t7 + 0);
+t4 = MEM_U32(sp + 76);
+v1 = MEM_U32(v1 + 0);
+t1 = t7 << 3;
+t1 = t1 + t7;
+t1 = t1 << 2;
+t9 = t1 + t2;
+t3 = MEM_U32(t9 + 28);
+//nop;
+if (v1 != t3) goto L40a660;
+//nop;
+a0 = 0x10001b6c;
+a1 = MEM_U32(s5 + 8);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+goto L40a6e0;
+L40a660:
+if (t4 == v1) {
+// bdead 19 ra = MEM_U32(sp + 68);
+goto L40a6fc;}
+a0 = MEM_U32(s5 + 12);
+at = 0xc;
+//nop;
+if (a0 == at) goto L40a6b0;
+t5 = MEM_U32(v1 + 16);
+at = 0x6;
+//nop;
+if (t5 != at) goto L40a6a8;
+//nop;
+a0 = 0x10001b8c;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1ee000b gp = MEM_U32(sp + 60);
+a0 = MEM_U32(s5 + 12);
+v1 = 0x10002e74;
+v1 = MEM_U32(v1 + 0);
+L40a6a8:
+MEM_U32(v1 + 16) = a0;
+goto L40a6e0;
+L40a6b0:
+//nop;
+t6 = MEM_U32(v1 + 0);
+at = 0x10002e74;
+a0 = v1;
+MEM_U32(at + 0) = t6;
+wrapper_free(mem, a0);
+// bdead c1ae001b gp = MEM_U32(sp + 60);
+goto L40a6e0;
+L40a6d0:
+v0 = MEM_U32(s5 + 20);
+L40a6d4:
+s5 = s5 + 0x14;
+//nop;
+if ((int)v0 >= 0) goto L40a514;
+L40a6e0:
+t8 = MEM_U32(sp + 84);
+L40a6e4:
+if (s0 < t8) {
+v0 = MEM_U8(s0 + 0);
+goto L40a1a0;}
+L40a6f0:
+t0 = MEM_U32(sp + 96);
+MEM_U32(t0 + 20) = s0;
+// bdead 19 ra = MEM_U32(sp + 68);
+L40a6fc:
+// bdead 19 s0 = MEM_U32(sp + 28);
+// bdead 19 s1 = MEM_U32(sp + 32);
+// bdead 19 s2 = MEM_U32(sp + 36);
+// bdead 19 s3 = MEM_U32(sp + 40);
+// bdead 19 s4 = MEM_U32(sp + 44);
+// bdead 19 s5 = MEM_U32(sp + 48);
+// bdead 19 s6 = MEM_U32(sp + 52);
+// bdead 19 s7 = MEM_U32(sp + 56);
+// bdead 19 fp = MEM_U32(sp + 64);
+// bdead 19 sp = sp + 0x60;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_else(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a728:
+//do_else:
+//nop;
+//nop;
+//nop;
+t6 = 0x10002cf0;
+t9 = 0x10003d38;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+sp = sp + 0xffffffd8;
+t9 = MEM_U32(t9 + 0);
+t7 = t6 << 3;
+t7 = t7 + t6;
+MEM_U32(sp + 52) = a3;
+t7 = t7 << 2;
+a3 = t7 + t8;
+// fdead 460181e3 MEM_U32(sp + 28) = ra;
+// fdead 460181e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 36) = a3;
+if (t9 == 0) goto L40a804;
+v0 = 0x10003fc8;
+t0 = MEM_U8(a0 + 0);
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+//nop;
+if (t2 == 0) goto L40a7a4;
+t3 = MEM_U8(a0 + 1);
+L40a790:
+a0 = a0 + 0x1;
+t4 = v0 + t3;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+t3 = MEM_U8(a0 + 1);
+goto L40a790;}
+L40a7a4:
+//nop;
+if (a0 == a1) goto L40a804;
+t6 = 0x10003d3c;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 != 0) goto L40a804;
+v1 = MEM_U32(a3 + 12);
+if (v1 != zero) {
+t0 = v1 + 0x1;
+goto L40a800;}
+//nop;
+a0 = 0x10001ba8;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 400000c3 gp = MEM_U32(sp + 24);
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a3 = t8 + t9;
+v1 = MEM_U32(a3 + 12);
+t0 = v1 + 0x1;
+L40a800:
+MEM_U32(a3 + 12) = t0;
+L40a804:
+v1 = 0x10002e74;
+t1 = MEM_U32(a3 + 28);
+v1 = MEM_U32(v1 + 0);
+if (v1 != t1) {
+v0 = MEM_U32(v1 + 16);
+goto L40a834;}
+//nop;
+a0 = 0x10001bd4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L40a94c;
+// fdead 0 v0 = MEM_U32(v1 + 16);
+L40a834:
+at = 0x5;
+if (v0 == at) {
+at = 0x8;
+goto L40a8f4;}
+at = 0x8;
+if (v0 == at) {
+t6 = 0x6;
+goto L40a8f8;}
+//nop;
+a0 = 0x10001bf4;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t2 = 0x10002e74;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001c08;
+t2 = MEM_U32(t2 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(t2 + 8);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t4 = MEM_U32(sp + 36);
+t3 = 0x10002e74;
+//nop;
+a1 = MEM_U32(t4 + 0);
+t3 = MEM_U32(t3 + 0);
+a0 = MEM_U32(t3 + 4);
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40a8d0;
+t5 = 0x10002e74;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001c1c;
+t5 = MEM_U32(t5 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(t5 + 4);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+L40a8d0:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001c28;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = 0x10002e74;
+v1 = MEM_U32(v1 + 0);
+L40a8f4:
+t6 = 0x6;
+L40a8f8:
+MEM_U32(v1 + 16) = t6;
+v1 = 0x10002e74;
+a2 = 0x1;
+v1 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 12);
+t7 = v0 + 0x1;
+if (v0 == 0) goto L40a930;
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = zero;
+//nop;
+temp64 = f_skip_if_group(mem, sp, v0, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L40a94c;
+L40a930:
+MEM_U32(v1 + 12) = t7;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 36);
+a3 = zero;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+L40a94c:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_do_endif(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40a95c:
+//do_endif:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003d38;
+sp = sp + 0xffffffe0;
+// fdead 400081e3 MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081e3 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 44) = a3;
+if (t6 == 0) goto L40aa34;
+v0 = 0x10003fc8;
+t7 = MEM_U8(a0 + 0);
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L40a9b8;
+t0 = MEM_U8(a0 + 1);
+L40a9a4:
+a0 = a0 + 0x1;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+t0 = MEM_U8(a0 + 1);
+goto L40a9a4;}
+L40a9b8:
+//nop;
+if (a0 == a1) goto L40aa34;
+t3 = 0x10003d3c;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 != 0) goto L40aa34;
+t4 = 0x10002cf0;
+t6 = 0x10005ec0;
+t4 = MEM_U32(t4 + 0);
+t5 = t4 << 3;
+t5 = t5 + t4;
+t5 = t5 << 2;
+v0 = t5 + t6;
+v1 = MEM_U32(v0 + 12);
+if (v1 != zero) {
+t0 = v1 + 0x1;
+goto L40aa30;}
+//nop;
+a0 = 0x10001c2c;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 12);
+t0 = v1 + 0x1;
+L40aa30:
+MEM_U32(v0 + 12) = t0;
+L40aa34:
+t1 = 0x10002cf0;
+t3 = 0x10005ec0;
+v1 = 0x10002e74;
+t1 = MEM_U32(t1 + 0);
+v0 = MEM_U32(v1 + 0);
+t2 = t1 << 3;
+t2 = t2 + t1;
+t2 = t2 << 2;
+t4 = t2 + t3;
+t5 = MEM_U32(t4 + 28);
+if (v0 != t5) {
+t6 = MEM_U32(v0 + 0);
+goto L40aa80;}
+//nop;
+a0 = 0x10001c5c;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+goto L40aad0;
+// fdead 0 t6 = MEM_U32(v0 + 0);
+L40aa80:
+a0 = v0;
+MEM_U32(v1 + 0) = t6;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+a2 = 0x1;
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+a3 = zero;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+a0 = t8 + t9;
+//nop;
+//nop;
+temp64 = f_output_line_command(mem, sp, v0, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 19 gp = MEM_U32(sp + 24);
+L40aad0:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_validate_else(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40aae0:
+//validate_else:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+// fdead 4000002b MEM_U32(sp + 32) = s3;
+// fdead 4000002b MEM_U32(sp + 28) = s2;
+// fdead 4000002b MEM_U32(sp + 24) = s1;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+// fdead 4000002b MEM_U32(sp + 44) = ra;
+// fdead 4000002b MEM_U32(sp + 40) = gp;
+s0 = a0;
+v0 = MEM_U8(a0 + 0);
+s1 = 0xa;
+s2 = 0x5c;
+s3 = 0x2f;
+s4 = 0x2a;
+L40ab24:
+//nop;
+if (s2 != v0) goto L40ab40;
+t6 = MEM_U8(s0 + 1);
+//nop;
+if (s1 != t6) goto L40ab40;
+s0 = s0 + 0x2;
+v0 = MEM_U8(s0 + 0);
+L40ab40:
+t7 = 0x10003fc8;
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L40ab60;
+s0 = s0 + 0x1;
+v0 = MEM_U8(s0 + 0);
+goto L40ab24;
+L40ab60:
+//nop;
+if (s3 != v0) goto L40ac6c;
+v0 = MEM_U8(s0 + 1);
+//nop;
+if (s2 != v0) goto L40ab98;
+t0 = MEM_U8(s0 + 2);
+//nop;
+if (s1 != t0) goto L40ab98;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403e01c3 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s0 + 1);
+L40ab98:
+//nop;
+if (s4 != v0) goto L40ac18;
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (v0 == 0) goto L40ab24;
+t1 = MEM_U8(s0 + 1);
+L40abb4:
+//nop;
+if (s2 != t1) goto L40abe0;
+t2 = MEM_U8(s0 + 2);
+//nop;
+if (s1 != t2) goto L40abe0;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 403e01c3 gp = MEM_U32(sp + 40);
+v0 = MEM_U8(s0 + 0);
+L40abe0:
+if (s4 != v0) {
+v0 = MEM_U8(s0 + 1);
+goto L40ac04;}
+t3 = MEM_U8(s0 + 1);
+if (s3 != t3) {
+v0 = MEM_U8(s0 + 1);
+goto L40ac04;}
+s0 = s0 + 0x2;
+v0 = MEM_U8(s0 + 0);
+goto L40ab24;
+// fdead 0 v0 = MEM_U8(s0 + 1);
+L40ac04:
+s0 = s0 + 0x1;
+if (v0 != zero) {
+t1 = MEM_U8(s0 + 1);
+goto L40abb4;}
+//nop;
+goto L40ab24;
+L40ac18:
+t4 = 0x10003d20;
+t4 = MEM_U32(t4 + 0);
+if (t4 == zero) {
+v0 = MEM_U8(s0 + 0);
+goto L40ac6c;}
+if (s3 != v0) {
+v0 = MEM_U8(s0 + 0);
+goto L40ac6c;}
+v0 = MEM_U8(s0 + 2);
+s0 = s0 + 0x2;
+//nop;
+if (v0 == 0) goto L40ab24;
+//nop;
+if (s1 == v0) goto L40ab24;
+v0 = MEM_U8(s0 + 1);
+L40ac4c:
+s0 = s0 + 0x1;
+//nop;
+if (v0 == 0) goto L40ab24;
+if (s1 != v0) {
+v0 = MEM_U8(s0 + 1);
+goto L40ac4c;}
+//nop;
+goto L40ab24;
+// fdead 0 v0 = MEM_U8(s0 + 0);
+L40ac6c:
+if (v0 == zero) {
+// bdead 9 ra = MEM_U32(sp + 44);
+goto L40acf4;}
+if (s1 == v0) {
+// bdead 9 ra = MEM_U32(sp + 44);
+goto L40acf4;}
+t5 = 0x10003d3c;
+t5 = MEM_U32(t5 + 0);
+if (t5 != zero) {
+// bdead 9 ra = MEM_U32(sp + 44);
+goto L40acf4;}
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+t6 = MEM_U32(t6 + 0);
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+v0 = t7 + t8;
+v1 = MEM_U32(v0 + 12);
+if (v1 != zero) {
+t2 = v1 + 0x1;
+goto L40acec;}
+//nop;
+a0 = 0x10001c70;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+t9 = 0x10002cf0;
+t1 = 0x10005ec0;
+t9 = MEM_U32(t9 + 0);
+t0 = t9 << 3;
+t0 = t0 + t9;
+t0 = t0 << 2;
+v0 = t0 + t1;
+v1 = MEM_U32(v0 + 12);
+t2 = v1 + 0x1;
+L40acec:
+MEM_U32(v0 + 12) = t2;
+// bdead 9 ra = MEM_U32(sp + 44);
+L40acf4:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint64_t f_skip_to_end_of_comment(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40ad10:
+//skip_to_end_of_comment:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+v1 = 0x10002ce0;
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+// fdead 400001fb MEM_U32(sp + 24) = gp;
+v1 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 48) = a0;
+t8 = MEM_U32(a0 + 8);
+t7 = MEM_U32(a0 + 16);
+v1 = zero < v1;
+a2 = a1;
+s0 = MEM_U32(a0 + 20);
+a3 = t7 + t8;
+if (v1 == 0) goto L40ad58;
+v1 = a1 < 0x1;
+L40ad58:
+t0 = v1;
+if (v1 == 0) goto L40ada0;
+t9 = 0x10003da0;
+t2 = 0x10003da0;
+t1 = 0x2f;
+t9 = MEM_U32(t9 + 20);
+at = 0x10003da0;
+t5 = 0x10003da0;
+MEM_U8(t9 + 0) = (uint8_t)t1;
+t2 = MEM_U32(t2 + 20);
+t4 = 0x2a;
+t3 = t2 + 0x1;
+MEM_U32(at + 20) = t3;
+MEM_U8(t3 + 0) = (uint8_t)t4;
+t5 = MEM_U32(t5 + 20);
+at = 0x10003da0;
+t7 = t5 + 0x1;
+MEM_U32(at + 20) = t7;
+L40ada0:
+t8 = 0x10003d20;
+t1 = 0x2f;
+at = s0 < a3;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 == 0) goto L40aeac;
+t6 = MEM_U8(s0 + -1);
+//nop;
+if (t1 != t6) goto L40aeac;
+at = s0 < a3;
+if (v1 == 0) goto L40ae68;
+a1 = 0xa;
+if (s0 >= a3) goto L40ae18;
+L40add8:
+t9 = 0x10003da0;
+v0 = MEM_U8(s0 + 0);
+t2 = 0x10003da0;
+t9 = MEM_U32(t9 + 20);
+at = 0x10003da0;
+s0 = s0 + 0x1;
+MEM_U8(t9 + 0) = (uint8_t)v0;
+t2 = MEM_U32(t2 + 20);
+t4 = t2 + 0x1;
+MEM_U32(at + 20) = t4;
+if (v0 != a1) goto L40ae0c;
+s0 = s0 + 0xffffffff;
+goto L40ae18;
+L40ae0c:
+//nop;
+if (s0 < a3) goto L40add8;
+L40ae18:
+t5 = 0x10003da0;
+t7 = 0x10003da0;
+t3 = 0x2a;
+t5 = MEM_U32(t5 + 20);
+t8 = 0x10003da0;
+at = 0x10003da0;
+MEM_U8(t5 + -1) = (uint8_t)t3;
+t7 = MEM_U32(t7 + 20);
+t9 = 0x10003da0;
+a1 = 0xa;
+MEM_U8(t7 + 0) = (uint8_t)t1;
+t8 = MEM_U32(t8 + 20);
+t6 = t8 + 0x1;
+MEM_U32(at + 20) = t6;
+MEM_U8(t6 + 0) = (uint8_t)a1;
+t9 = MEM_U32(t9 + 20);
+at = 0x10003da0;
+t2 = t9 + 0x1;
+MEM_U32(at + 20) = t2;
+goto L40ae9c;
+L40ae68:
+a1 = 0xa;
+if (at == 0) goto L40ae9c;
+t4 = MEM_U8(s0 + 0);
+L40ae74:
+s0 = s0 + 0x1;
+at = s0 < a3;
+v1 = a1 ^ t4;
+v1 = v1 < 0x1;
+//nop;
+if (v1 == 0) goto L40ae94;
+s0 = s0 + 0xffffffff;
+goto L40ae9c;
+L40ae94:
+if (at != zero) {
+t4 = MEM_U8(s0 + 0);
+goto L40ae74;}
+L40ae9c:
+t3 = MEM_U32(sp + 48);
+v0 = s0;
+MEM_U32(t3 + 20) = s0;
+goto L40afd8;
+L40aeac:
+a1 = 0xa;
+if (at == 0) goto L40afcc;
+L40aeb4:
+v0 = MEM_U8(s0 + 0);
+if (t0 == 0) goto L40aee0;
+t5 = 0x10003da0;
+t7 = 0x10003da0;
+at = 0x10003da0;
+t5 = MEM_U32(t5 + 20);
+MEM_U8(t5 + 0) = (uint8_t)v0;
+t7 = MEM_U32(t7 + 20);
+t8 = t7 + 0x1;
+MEM_U32(at + 20) = t8;
+v0 = MEM_U8(s0 + 0);
+L40aee0:
+s0 = s0 + 0x1;
+if (v0 == a1) goto L40aefc;
+at = 0x2a;
+if (v0 == at) {
+v0 = MEM_U8(s0 + 0);
+goto L40af34;}
+at = s0 < a3;
+goto L40afc4;
+L40aefc:
+//nop;
+if (a2 == 0) goto L40af10;
+t6 = MEM_U32(a2 + 0);
+t9 = t6 + 0x1;
+MEM_U32(a2 + 0) = t9;
+L40af10:
+if (t0 == zero) {
+at = s0 < a3;
+goto L40afc4;}
+t2 = 0x10003da0;
+at = 0x10003da0;
+t2 = MEM_U32(t2 + 4);
+t4 = t2 + 0x1;
+MEM_U32(at + 4) = t4;
+goto L40afc0;
+// fdead 0 v0 = MEM_U8(s0 + 0);
+L40af34:
+at = 0x5c;
+//nop;
+if (v0 != at) goto L40af80;
+t3 = MEM_U8(s0 + 1);
+a0 = s0;
+//nop;
+if (a1 != t3) goto L40af80;
+//nop;
+MEM_U32(sp + 52) = a2;
+MEM_U32(sp + 44) = a3;
+MEM_U32(sp + 32) = t0;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40020013 gp = MEM_U32(sp + 24);
+a1 = 0xa;
+a2 = MEM_U32(sp + 52);
+a3 = MEM_U32(sp + 44);
+t0 = MEM_U32(sp + 32);
+t1 = 0x2f;
+v0 = MEM_U8(s0 + 0);
+L40af80:
+if (t1 != v0) {
+at = s0 < a3;
+goto L40afc4;}
+if (t0 == zero) {
+t6 = MEM_U32(sp + 48);
+goto L40afb4;}
+t5 = 0x10003da0;
+t7 = 0x10003da0;
+at = 0x10003da0;
+t5 = MEM_U32(t5 + 20);
+MEM_U8(t5 + 0) = (uint8_t)t1;
+t7 = MEM_U32(t7 + 20);
+t8 = t7 + 0x1;
+MEM_U32(at + 20) = t8;
+t6 = MEM_U32(sp + 48);
+L40afb4:
+v0 = s0 + 0x1;
+MEM_U32(t6 + 20) = v0;
+goto L40afd8;
+L40afc0:
+at = s0 < a3;
+L40afc4:
+//nop;
+if (at != 0) goto L40aeb4;
+L40afcc:
+t9 = MEM_U32(sp + 48);
+v0 = s0;
+MEM_U32(t9 + 20) = s0;
+L40afd8:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_skip_quoted_string(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40afec:
+//skip_quoted_string:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+t0 = MEM_U8(a0 + 0);
+s0 = a0 + 0x1;
+a0 = 0xa;
+a2 = 0x1;
+a1 = 0x5c;
+v1 = MEM_U32(sp + 48);
+t2 = 0x10003d4c;
+t1 = 0x27;
+L40b030:
+t6 = MEM_U32(sp + 36);
+L40b034:
+if (s0 < t6) {
+v0 = MEM_U8(s0 + 0);
+goto L40b088;}
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 4002018b gp = MEM_U32(sp + 24);
+a0 = v0;
+//nop;
+a1 = 0x10001ca8;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 52);
+// bdead 20013 gp = MEM_U32(sp + 24);
+a2 = 0x1;
+if (v1 == zero) {
+// bdead 20011 ra = MEM_U32(sp + 28);
+goto L40b184;}
+MEM_U32(v1 + 0) = a2;
+goto L40b180;
+// fdead 0 v0 = MEM_U8(s0 + 0);
+L40b088:
+s0 = s0 + 0x1;
+//nop;
+if (v0 != a1) goto L40b118;
+v0 = MEM_U8(s0 + 0);
+//nop;
+if (a1 != v0) goto L40b0e8;
+t7 = MEM_U8(s0 + 1);
+//nop;
+if (a0 != t7) goto L40b0e8;
+L40b0ac:
+//nop;
+if (v1 == 0) goto L40b0b8;
+MEM_U32(v1 + 0) = a2;
+L40b0b8:
+if (a3 == zero) {
+v0 = MEM_U8(s0 + 2);
+goto L40b0d0;}
+t8 = MEM_U32(a3 + 0);
+t9 = t8 + 0x1;
+MEM_U32(a3 + 0) = t9;
+v0 = MEM_U8(s0 + 2);
+L40b0d0:
+s0 = s0 + 0x2;
+//nop;
+if (a1 != v0) goto L40b0e8;
+t3 = MEM_U8(s0 + 1);
+//nop;
+if (a0 == t3) goto L40b0ac;
+L40b0e8:
+//nop;
+if (a0 != v0) goto L40b110;
+//nop;
+if (a3 == 0) goto L40b110;
+if (v1 == zero) {
+t4 = MEM_U32(a3 + 0);
+goto L40b108;}
+MEM_U32(v1 + 0) = a2;
+t4 = MEM_U32(a3 + 0);
+L40b108:
+t5 = t4 + 0x1;
+MEM_U32(a3 + 0) = t5;
+L40b110:
+s0 = s0 + 0x1;
+goto L40b030;
+L40b118:
+//nop;
+if (v0 != a0) goto L40b178;
+if (t0 != t1) {
+t6 = MEM_U32(t2 + 0);
+goto L40b144;}
+v1 = MEM_U32(sp + 52);
+s0 = s0 + 0xffffffff;
+if (v1 == zero) {
+// bdead 20011 ra = MEM_U32(sp + 28);
+goto L40b184;}
+MEM_U32(v1 + 0) = a2;
+goto L40b180;
+// fdead 0 t6 = MEM_U32(t2 + 0);
+L40b144:
+//nop;
+if (t6 == 0) goto L40b160;
+v1 = MEM_U32(sp + 52);
+if (v1 == zero) {
+// bdead 20011 ra = MEM_U32(sp + 28);
+goto L40b184;}
+MEM_U32(v1 + 0) = a2;
+goto L40b180;
+L40b160:
+if (a3 == zero) {
+t6 = MEM_U32(sp + 36);
+goto L40b034;}
+t7 = MEM_U32(a3 + 0);
+t8 = t7 + 0x1;
+MEM_U32(a3 + 0) = t8;
+goto L40b030;
+L40b178:
+if (v0 != t0) {
+t6 = MEM_U32(sp + 36);
+goto L40b034;}
+L40b180:
+// bdead 20011 ra = MEM_U32(sp + 28);
+L40b184:
+v0 = s0;
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x20;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_output_line_command(uint8_t *mem, uint32_t sp, uint32_t v0, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40b194:
+//output_line_command:
+//nop;
+//nop;
+//nop;
+t6 = 0x10003d30;
+sp = sp + 0xfffffdd0;
+// fdead 400081eb MEM_U32(sp + 28) = s1;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = s0;
+s0 = a1;
+s1 = a0;
+// fdead 400681eb MEM_U32(sp + 36) = ra;
+// fdead 400681eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 572) = a3;
+if (t6 != 0) goto L40b1e8;
+a3 = MEM_U32(a0 + 0);
+if (a3 == zero) {
+t8 = MEM_U32(s1 + 4);
+goto L40b1ec;}
+t7 = 0x10003d50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L40b1f4;
+L40b1e8:
+t8 = MEM_U32(s1 + 4);
+L40b1ec:
+MEM_U32(s0 + 4) = t8;
+goto L40b38c;
+L40b1f4:
+//nop;
+if (a2 == 0) goto L40b2a4;
+a0 = MEM_U32(s0 + 4);
+v1 = MEM_U32(s1 + 4);
+at = (int)a0 < (int)v1;
+if (a0 == v1) goto L40b38c;
+t9 = a0 + 0x8;
+if ((int)a0 >= (int)v1) goto L40b2a4;
+//nop;
+if ((int)v1 >= (int)t9) goto L40b2a4;
+t0 = MEM_U32(s0 + 20);
+t1 = MEM_U32(s0 + 16);
+t3 = MEM_U32(s0 + 8);
+t2 = t0 - t1;
+t4 = t3 - t2;
+if ((int)t4 >= (int)0xb) {
+at = (int)a0 < (int)v1;
+goto L40b264;}
+//nop;
+a0 = s0;
+a1 = 0xa;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 6000b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(s1 + 4);
+a0 = MEM_U32(s0 + 4);
+at = (int)a0 < (int)v1;
+L40b264:
+v1 = 0xa;
+if (at == 0) goto L40b38c;
+t5 = MEM_U32(s0 + 20);
+L40b270:
+MEM_U8(t5 + 0) = (uint8_t)v1;
+t6 = MEM_U32(s0 + 20);
+t8 = MEM_U32(s0 + 4);
+t7 = t6 + 0x1;
+t9 = t8 + 0x1;
+MEM_U32(s0 + 20) = t7;
+MEM_U32(s0 + 4) = t9;
+t1 = MEM_U32(s1 + 4);
+if ((int)t9 < (int)t1) {
+t5 = MEM_U32(s0 + 20);
+goto L40b270;}
+// bdead 19 ra = MEM_U32(sp + 36);
+goto L40b390;
+L40b2a4:
+//nop;
+a1 = 0x10001cd4;
+a0 = sp + 0x38;
+a2 = MEM_U32(s1 + 4);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+a0 = sp + 0x38;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+t3 = sp + 0x38;
+// bdead 4006100b gp = MEM_U32(sp + 32);
+v1 = 0xa;
+t2 = v0 + t3;
+MEM_U8(t2 + 0) = (uint8_t)v1;
+t4 = v0 + 0x1;
+MEM_U32(sp + 556) = t4;
+a0 = MEM_U32(s0 + 16);
+a1 = MEM_U32(s0 + 20);
+t5 = MEM_U32(s0 + 8);
+t8 = v0 + 0x2;
+t6 = a1 - a0;
+t7 = t5 - t6;
+if ((int)t8 < (int)t7) {
+at = a0 < a1;
+goto L40b338;}
+//nop;
+a0 = s0;
+a1 = t4 + 0x1;
+//nop;
+temp64 = f_grow_outbuf(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40060001 gp = MEM_U32(sp + 32);
+v1 = 0xa;
+a1 = MEM_U32(s0 + 20);
+a0 = MEM_U32(s0 + 16);
+at = a0 < a1;
+L40b338:
+//nop;
+if (at == 0) goto L40b35c;
+t9 = MEM_U8(a1 + -1);
+//nop;
+if (v1 == t9) goto L40b35c;
+MEM_U8(a1 + 0) = (uint8_t)v1;
+t0 = MEM_U32(s0 + 20);
+a1 = t0 + 0x1;
+MEM_U32(s0 + 20) = a1;
+L40b35c:
+//nop;
+a0 = sp + 0x38;
+a2 = MEM_U32(sp + 556);
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t3 = MEM_U32(s0 + 20);
+t2 = MEM_U32(sp + 556);
+// bdead 61819 gp = MEM_U32(sp + 32);
+t4 = t3 + t2;
+MEM_U32(s0 + 20) = t4;
+t5 = MEM_U32(s1 + 4);
+MEM_U32(s0 + 4) = t5;
+L40b38c:
+// bdead 19 ra = MEM_U32(sp + 36);
+L40b390:
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x230;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_macroexpand(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40b3a0:
+//macroexpand:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff50;
+v1 = 0x10002cf0;
+t7 = 0x10005ec0;
+// fdead 400101fb MEM_U32(sp + 60) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400101fb MEM_U32(sp + 56) = fp;
+// fdead 400101fb MEM_U32(sp + 52) = gp;
+t6 = v1 << 3;
+t6 = t6 + v1;
+t6 = t6 << 2;
+// fdead 400181fb MEM_U32(sp + 48) = s7;
+// fdead 400181fb MEM_U32(sp + 44) = s6;
+// fdead 400181fb MEM_U32(sp + 40) = s5;
+// fdead 400181fb MEM_U32(sp + 36) = s4;
+// fdead 400181fb MEM_U32(sp + 32) = s3;
+// fdead 400181fb MEM_U32(sp + 28) = s2;
+// fdead 400181fb MEM_U32(sp + 24) = s1;
+// fdead 400181fb MEM_U32(sp + 20) = s0;
+t8 = t6 + t7;
+a2 = MEM_U32(t8 + 4);
+at = (int)v1 < (int)0xc7;
+a3 = a0;
+v0 = MEM_U32(a0 + 24);
+s3 = a2;
+if (at != 0) goto L40b440;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 40000189 gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = 0x10001ce0;
+a1 = a1;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 52);
+goto L40be9c;
+L40b440:
+t9 = MEM_U32(a3 + 12);
+at = 0x17;
+if (t9 == at) {
+a1 = MEM_U32(v0 + 0);
+goto L40b46c;}
+//nop;
+a0 = a3;
+//nop;
+f_special_symbol(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 52);
+goto L40be9c;
+// fdead 0 a1 = MEM_U32(v0 + 0);
+L40b46c:
+a0 = a1 << 5;
+if ((int)a1 < 0) goto L40be24;
+//nop;
+a0 = a0 + 0x20;
+MEM_U32(sp + 168) = v0;
+MEM_U32(sp + 172) = a1;
+MEM_U32(sp + 176) = a3;
+v0 = f_alloca(mem, sp, a0);
+a2 = MEM_U32(sp + 172);
+// bdead 401000ab gp = MEM_U32(sp + 52);
+MEM_U32(sp + 148) = v0;
+s0 = zero;
+if ((int)a2 <= 0) goto L40b580;
+a0 = a2 & 0x3;
+a1 = a0;
+if (a0 == 0) goto L40b4ec;
+a0 = 0x10001d08;
+t4 = zero << 5;
+v1 = v0 + t4;
+a0 = a0;
+L40b4bc:
+s0 = s0 + 0x1;
+MEM_U32(v1 + 4) = a0;
+MEM_U32(v1 + 0) = a0;
+MEM_U32(v1 + 16) = zero;
+MEM_U32(v1 + 12) = zero;
+MEM_U32(v1 + 8) = zero;
+MEM_U32(v1 + 24) = zero;
+MEM_U32(v1 + 20) = zero;
+v1 = v1 + 0x20;
+if (a1 != s0) goto L40b4bc;
+if (s0 == a2) {
+s0 = zero;
+goto L40b580;}
+L40b4ec:
+a0 = 0x10001d08;
+t5 = a2 << 5;
+t6 = s0 << 5;
+v1 = v0 + t6;
+a1 = t5 + v0;
+a0 = a0;
+L40b504:
+v1 = v1 + 0x80;
+MEM_U32(v1 + -92) = a0;
+MEM_U32(v1 + -96) = a0;
+MEM_U32(v1 + -80) = zero;
+MEM_U32(v1 + -84) = zero;
+MEM_U32(v1 + -88) = zero;
+MEM_U32(v1 + -72) = zero;
+MEM_U32(v1 + -76) = zero;
+MEM_U32(v1 + -60) = a0;
+MEM_U32(v1 + -64) = a0;
+MEM_U32(v1 + -48) = zero;
+MEM_U32(v1 + -52) = zero;
+MEM_U32(v1 + -56) = zero;
+MEM_U32(v1 + -40) = zero;
+MEM_U32(v1 + -44) = zero;
+MEM_U32(v1 + -28) = a0;
+MEM_U32(v1 + -32) = a0;
+MEM_U32(v1 + -16) = zero;
+MEM_U32(v1 + -20) = zero;
+MEM_U32(v1 + -24) = zero;
+MEM_U32(v1 + -8) = zero;
+MEM_U32(v1 + -12) = zero;
+MEM_U32(v1 + -124) = a0;
+MEM_U32(v1 + -128) = a0;
+MEM_U32(v1 + -112) = zero;
+MEM_U32(v1 + -116) = zero;
+MEM_U32(v1 + -120) = zero;
+MEM_U32(v1 + -104) = zero;
+MEM_U32(v1 + -108) = zero;
+if (v1 != a1) goto L40b504;
+s0 = zero;
+L40b580:
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+s2 = 0x29;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 20);
+a2 = MEM_U32(sp + 172);
+L40b5a8:
+t4 = v1 + 0x1;
+MEM_U32(v0 + 20) = t4;
+t6 = MEM_U32(sp + 148);
+if ((int)s0 < (int)a2) goto L40b5c8;
+a0 = zero;
+if (a2 != 0) goto L40b5d4;
+if (s0 != 0) {
+t5 = s0 << 5;
+goto L40b5d4;}
+L40b5c8:
+t5 = s0 << 5;
+a0 = t5 + t6;
+goto L40b5d4;
+L40b5d4:
+//nop;
+//nop;
+v0 = f_macarg(mem, sp, a0);
+// bdead 401a012b gp = MEM_U32(sp + 52);
+s1 = v0;
+if (v0 == 0) goto L40b61c;
+//nop;
+a0 = s3;
+//nop;
+v0 = f_line_for_error(mem, sp, a0);
+// bdead 4006018b gp = MEM_U32(sp + 52);
+a0 = v0;
+a1 = s1;
+//nop;
+//nop;
+f_error_with_line(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 52);
+goto L40b64c;
+L40b61c:
+t7 = 0x10002cf0;
+t9 = 0x10005ec0;
+s0 = s0 + 0x1;
+t7 = MEM_U32(t7 + 0);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 2;
+v0 = t8 + t9;
+v1 = MEM_U32(v0 + 20);
+t4 = MEM_U8(v1 + 0);
+if (s2 != t4) {
+a2 = MEM_U32(sp + 172);
+goto L40b5a8;}
+L40b64c:
+t5 = MEM_U32(sp + 172);
+at = 0x1;
+if (t5 != zero) {
+t8 = MEM_U32(sp + 172);
+goto L40b6d8;}
+a2 = MEM_U32(sp + 148);
+if (s0 != at) goto L40b6d4;
+v0 = MEM_U32(a2 + 0);
+t6 = MEM_U32(a2 + 8);
+v1 = t6 + v0;
+//nop;
+if (v0 == v1) goto L40b6b0;
+s4 = 0x100040c8;
+t7 = MEM_U8(v0 + 0);
+t8 = s4 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L40b6b0;
+v0 = v0 + 0x1;
+L40b694:
+//nop;
+if (v0 == v1) goto L40b6b0;
+t4 = MEM_U8(v0 + 0);
+t5 = s4 + t4;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+v0 = v0 + 0x1;
+goto L40b694;}
+L40b6b0:
+t7 = MEM_U32(sp + 176);
+if (v0 == v1) goto L40b73c;
+//nop;
+a0 = 0x10001d0c;
+a1 = MEM_U32(t7 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+goto L40b73c;
+L40b6d4:
+t8 = MEM_U32(sp + 172);
+L40b6d8:
+if ((int)s0 >= (int)t8) {
+t4 = MEM_U32(sp + 172);
+goto L40b710;}
+t9 = MEM_U32(sp + 176);
+a0 = 0x10001d2c;
+a1 = s0;
+a2 = MEM_U32(t9 + 20);
+//nop;
+a0 = a0;
+//nop;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+goto L40b73c;
+// fdead 0 t4 = MEM_U32(sp + 172);
+L40b710:
+t5 = MEM_U32(sp + 176);
+//nop;
+if ((int)t4 >= (int)s0) goto L40b73c;
+//nop;
+a0 = 0x10001d48;
+a1 = s0;
+a2 = MEM_U32(t5 + 20);
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 52);
+L40b73c:
+t6 = 0x10002cf0;
+t8 = 0x10005ec0;
+t5 = MEM_U32(sp + 172);
+t6 = MEM_U32(t6 + 0);
+a2 = MEM_U32(sp + 148);
+s4 = 0x100040c8;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+v0 = t7 + t8;
+t9 = MEM_U32(v0 + 20);
+t4 = t9 + 0x1;
+MEM_U32(v0 + 20) = t4;
+if (t5 != 0) goto L40b788;
+v0 = MEM_U32(sp + 168);
+a2 = MEM_U32(v0 + 8);
+s2 = MEM_U32(v0 + 4);
+MEM_U32(sp + 164) = a2;
+goto L40be0c;
+L40b788:
+v0 = MEM_U32(sp + 168);
+t6 = MEM_U32(v0 + 8);
+MEM_U32(sp + 132) = t6;
+t0 = MEM_U32(v0 + 12);
+s2 = MEM_U32(v0 + 4);
+//nop;
+if (t0 == 0) goto L40b818;
+t7 = MEM_U8(t0 + 4);
+L40b7a8:
+if (t7 == zero) {
+t6 = MEM_U8(t0 + 5);
+goto L40b7cc;}
+t8 = MEM_U32(t0 + 12);
+t9 = t8 << 5;
+t4 = a2 + t9;
+t5 = MEM_U32(t4 + 16);
+s2 = s2 + t5;
+goto L40b80c;
+// fdead 0 t6 = MEM_U8(t0 + 5);
+L40b7cc:
+if (t6 != zero) {
+t8 = MEM_U32(t0 + 12);
+goto L40b7e4;}
+t7 = MEM_U8(t0 + 6);
+if (t7 == zero) {
+t6 = MEM_U32(t0 + 12);
+goto L40b7fc;}
+t8 = MEM_U32(t0 + 12);
+L40b7e4:
+t9 = t8 << 5;
+t4 = a2 + t9;
+t5 = MEM_U32(t4 + 8);
+s2 = s2 + t5;
+goto L40b80c;
+// fdead 0 t6 = MEM_U32(t0 + 12);
+L40b7fc:
+t7 = t6 << 5;
+t8 = a2 + t7;
+t9 = MEM_U32(t8 + 12);
+s2 = s2 + t9;
+L40b80c:
+t0 = MEM_U32(t0 + 0);
+if (t0 != zero) {
+t7 = MEM_U8(t0 + 4);
+goto L40b7a8;}
+L40b818:
+//nop;
+a0 = s2 + 0x1;
+MEM_U32(sp + 68) = a0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+a0 = MEM_U32(sp + 168);
+MEM_U32(sp + 164) = v0;
+// bdead 40200123 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(a0 + 12);
+s5 = zero;
+t1 = zero;
+s2 = 0xa;
+if (t0 == 0) goto L40bd64;
+s1 = 0xa;
+t3 = 0x5c;
+t2 = 0x22;
+t4 = MEM_U32(t0 + 12);
+L40b85c:
+t7 = MEM_U32(t0 + 8);
+t6 = MEM_U32(sp + 148);
+t5 = t4 << 5;
+s0 = zero;
+v1 = t5 + t6;
+if ((int)t7 <= 0) goto L40b8ac;
+t8 = MEM_U32(sp + 164);
+t9 = MEM_U32(sp + 132);
+s3 = t8 + s5;
+v0 = t1 + t9;
+L40b884:
+t4 = MEM_U8(v0 + 0);
+s0 = s0 + 0x1;
+s5 = s5 + 0x1;
+MEM_U8(s3 + 0) = (uint8_t)t4;
+t5 = MEM_U32(t0 + 8);
+s3 = s3 + 0x1;
+t1 = t1 + 0x1;
+v0 = v0 + 0x1;
+if ((int)s0 < (int)t5) goto L40b884;
+L40b8ac:
+t6 = MEM_U8(t0 + 4);
+s6 = zero;
+s0 = zero;
+if (t6 == zero) {
+v0 = MEM_U8(t0 + 5);
+goto L40bb3c;}
+s7 = MEM_U32(v1 + 8);
+a0 = 0x10003d4c;
+fp = zero;
+a0 = MEM_U32(a0 + 0);
+if ((int)s7 <= 0) goto L40b910;
+v0 = MEM_U32(v1 + 0);
+a2 = MEM_U8(v0 + 0);
+t7 = s4 + a2;
+t8 = MEM_U8(t7 + 0);
+if (t8 == zero) {
+at = (int)s0 < (int)s7;
+goto L40b914;}
+s0 = s0 + 0x1;
+L40b8f0:
+t9 = v0 + s0;
+if ((int)s0 >= (int)s7) goto L40b910;
+a2 = MEM_U8(t9 + 0);
+t4 = s4 + a2;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+s0 = s0 + 0x1;
+goto L40b8f0;}
+L40b910:
+at = (int)s0 < (int)s7;
+L40b914:
+//nop;
+if (at == 0) goto L40b95c;
+t6 = MEM_U32(v1 + 0);
+v0 = t6 + s7;
+a2 = MEM_U8(v0 + -1);
+t7 = s4 + a2;
+t8 = MEM_U8(t7 + 0);
+//nop;
+if (t8 == 0) goto L40b95c;
+s7 = s7 + 0xffffffff;
+L40b93c:
+v0 = v0 + 0xffffffff;
+if ((int)s0 >= (int)s7) goto L40b95c;
+a2 = MEM_U8(v0 + -1);
+t9 = s4 + a2;
+t4 = MEM_U8(t9 + 0);
+if (t4 != zero) {
+s7 = s7 + 0xffffffff;
+goto L40b93c;}
+L40b95c:
+at = (int)s0 < (int)s7;
+if (a0 != 0) goto L40b978;
+t6 = MEM_U32(sp + 164);
+t5 = 0x22;
+t7 = t6 + s5;
+MEM_U8(t7 + 0) = (uint8_t)t5;
+s5 = s5 + 0x1;
+L40b978:
+//nop;
+if (at == 0) goto L40bb10;
+t8 = MEM_U32(v1 + 0);
+L40b984:
+t4 = MEM_U32(sp + 164);
+v0 = t8 + s0;
+a2 = MEM_U8(v0 + 0);
+//nop;
+if (a2 != s2) goto L40b9ac;
+t9 = MEM_U8(v0 + 1);
+//nop;
+if (s1 == t9) goto L40b9ac;
+s0 = s0 + 0x1;
+goto L40bb00;
+L40b9ac:
+s3 = t4 + s5;
+if (s6 == 0) goto L40b9c8;
+t6 = 0x10003fc8;
+t5 = a2 + t6;
+t7 = MEM_U8(t5 + 0);
+//nop;
+if (t7 != 0) goto L40ba34;
+L40b9c8:
+t9 = s4 + a2;
+if (a2 != s2) goto L40b9e0;
+t8 = MEM_U8(v0 + 1);
+a0 = s1 ^ t8;
+a0 = a0 < 0x1;
+goto L40b9e4;
+L40b9e0:
+a0 = MEM_U8(t9 + 0);
+L40b9e4:
+//nop;
+if (a0 == 0) goto L40ba34;
+L40b9ec:
+t6 = s4 + a2;
+if (a2 != s2) goto L40ba0c;
+t4 = MEM_U8(v0 + 1);
+//nop;
+if (s1 != t4) goto L40ba0c;
+s0 = s0 + 0x2;
+v0 = v0 + 0x2;
+goto L40ba24;
+L40ba0c:
+v0 = v0 + 0x1;
+if (a2 == s2) goto L40ba2c;
+t5 = MEM_U8(t6 + 0);
+if (t5 == zero) {
+s0 = s0 + 0xffffffff;
+goto L40ba30;}
+s0 = s0 + 0x1;
+L40ba24:
+a2 = MEM_U8(v0 + 0);
+goto L40b9ec;
+L40ba2c:
+s0 = s0 + 0xffffffff;
+L40ba30:
+a2 = 0x20;
+L40ba34:
+t7 = 0x5c;
+if (fp == 0) goto L40ba44;
+fp = zero;
+goto L40ba7c;
+L40ba44:
+//nop;
+if (a2 != t3) goto L40ba50;
+fp = 0x1;
+L40ba50:
+//nop;
+if (s6 == 0) goto L40ba68;
+//nop;
+if (a2 != s6) goto L40ba68;
+s6 = zero;
+goto L40ba7c;
+L40ba68:
+at = 0x27;
+if (a2 == t2) goto L40ba78;
+//nop;
+if (a2 != at) goto L40ba7c;
+L40ba78:
+s6 = a2;
+L40ba7c:
+if (a2 == t2) {
+MEM_U8(s3 + 0) = (uint8_t)t7;
+goto L40ba98;}
+//nop;
+if (s6 == 0) goto L40baa0;
+//nop;
+if (a2 != t3) goto L40baa0;
+MEM_U8(s3 + 0) = (uint8_t)t7;
+L40ba98:
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+L40baa0:
+t8 = 0xfb4cba0;
+a0 = s3;
+t9 = a2 + t8;
+t4 = MEM_U8(t9 + 1);
+t6 = t4 & 0x57;
+//nop;
+if (t6 == 0) goto L40bac8;
+MEM_U8(s3 + 0) = (uint8_t)a2;
+s5 = s5 + 0x1;
+goto L40bb00;
+L40bac8:
+//nop;
+a1 = 0x10001d6c;
+MEM_U32(sp + 116) = v1;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead c1ee0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(sp + 116);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+s5 = s5 + 0x4;
+L40bb00:
+s0 = s0 + 0x1;
+if ((int)s0 < (int)s7) {
+t8 = MEM_U32(v1 + 0);
+goto L40b984;}
+L40bb10:
+t5 = 0x10003d4c;
+t8 = MEM_U32(sp + 164);
+t5 = MEM_U32(t5 + 0);
+t9 = t8 + s5;
+t7 = 0x22;
+if (t5 != 0) goto L40bb30;
+MEM_U8(t9 + 0) = (uint8_t)t7;
+s5 = s5 + 0x1;
+L40bb30:
+v0 = s5 + 0x1;
+goto L40bd1c;
+// fdead 0 v0 = MEM_U8(t0 + 5);
+L40bb3c:
+t4 = MEM_U32(sp + 164);
+s3 = t4 + s5;
+if (v0 != 0) goto L40bb58;
+t6 = MEM_U8(t0 + 6);
+a1 = s3;
+//nop;
+if (t6 == 0) goto L40bcdc;
+L40bb58:
+a0 = MEM_U32(v1 + 0);
+t5 = MEM_U32(v1 + 8);
+a3 = t5 + a0;
+if (v0 == 0) goto L40bc10;
+//nop;
+if (a0 == a3) goto L40bba4;
+t8 = MEM_U8(a0 + 0);
+t7 = s4 + t8;
+t9 = MEM_U8(t7 + 0);
+//nop;
+if (t9 == 0) goto L40bba4;
+a0 = a0 + 0x1;
+L40bb88:
+//nop;
+if (a0 == a3) goto L40bba4;
+t4 = MEM_U8(a0 + 0);
+t6 = s4 + t4;
+t5 = MEM_U8(t6 + 0);
+if (t5 != zero) {
+a0 = a0 + 0x1;
+goto L40bb88;}
+L40bba4:
+if (a0 == a3) {
+t8 = MEM_U8(a0 + 0);
+goto L40bbf4;}
+v0 = MEM_U8(a0 + 0);
+t8 = 0x10003dc8;
+t7 = v0 + t8;
+t9 = MEM_U8(t7 + 0);
+if (t9 == zero) {
+t8 = MEM_U8(a0 + 0);
+goto L40bbf4;}
+a0 = a0 + 0x1;
+L40bbc8:
+MEM_U8(s3 + 0) = (uint8_t)v0;
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+if (a0 == a3) goto L40bbf0;
+v0 = MEM_U8(a0 + 0);
+t4 = 0x10003dc8;
+t6 = v0 + t4;
+t5 = MEM_U8(t6 + 0);
+if (t5 != zero) {
+a0 = a0 + 0x1;
+goto L40bbc8;}
+L40bbf0:
+t8 = MEM_U8(a0 + 0);
+L40bbf4:
+if (s1 != t8) {
+t9 = MEM_U8(t0 + 6);
+goto L40bc14;}
+t7 = MEM_U8(a0 + 1);
+at = 0x2d;
+if (t7 != at) {
+t9 = MEM_U8(t0 + 6);
+goto L40bc14;}
+a0 = a0 + 0x2;
+L40bc10:
+t9 = MEM_U8(t0 + 6);
+L40bc14:
+a1 = s3;
+//nop;
+if (t9 == 0) goto L40bca4;
+//nop;
+if (a0 == a3) goto L40bca4;
+v0 = MEM_U8(a3 + -1);
+L40bc2c:
+at = 0x2d;
+v1 = a3 + 0xffffffff;
+t4 = s4 + v0;
+t6 = MEM_U8(t4 + 0);
+t5 = a0 + 0x1;
+//nop;
+if (t6 == 0) goto L40bc50;
+a3 = a3 + 0xffffffff;
+goto L40bc9c;
+L40bc50:
+//nop;
+if (v0 != at) goto L40bca4;
+v0 = v1;
+if (a3 == t5) goto L40bc84;
+t8 = MEM_U8(v1 + -1);
+if (s1 != t8) {
+t9 = a3 - v0;
+goto L40bc88;}
+v0 = v0 + 0xffffffff;
+L40bc70:
+if (v0 == a0) {
+t9 = a3 - v0;
+goto L40bc88;}
+t7 = MEM_U8(v0 + -1);
+if (s1 == t7) {
+v0 = v0 + 0xffffffff;
+goto L40bc70;}
+L40bc84:
+t9 = a3 - v0;
+L40bc88:
+t4 = t9 + 0xffffffff;
+t6 = t4 & 0x1;
+//nop;
+if (t6 == 0) goto L40bca4;
+a3 = a3 + 0xfffffffe;
+L40bc9c:
+if (a0 != a3) {
+v0 = MEM_U8(a3 + -1);
+goto L40bc2c;}
+L40bca4:
+//nop;
+s0 = a3 - a0;
+a2 = s0;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+wrapper_bcopy(mem, a0, a1, a2);
+s5 = s5 + s0;
+// bdead 406c0103 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+v0 = s5 + 0x1;
+goto L40bd1c;
+L40bcdc:
+//nop;
+a0 = MEM_U32(v1 + 4);
+a2 = MEM_U32(v1 + 12);
+MEM_U32(sp + 128) = t1;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 116) = v1;
+wrapper_bcopy(mem, a0, a1, a2);
+v1 = MEM_U32(sp + 116);
+// bdead 406c0113 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 120);
+t5 = MEM_U32(v1 + 12);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+s5 = s5 + t5;
+t3 = 0x5c;
+v0 = s5 + 0x1;
+L40bd1c:
+t8 = MEM_U32(sp + 68);
+if ((int)t8 >= (int)v0) {
+t0 = MEM_U32(t0 + 0);
+goto L40bd58;}
+//nop;
+MEM_U32(sp + 120) = t0;
+MEM_U32(sp + 128) = t1;
+//nop;
+wrapper_abort(mem);
+// bdead 406c0103 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 120);
+t1 = MEM_U32(sp + 128);
+t2 = 0x22;
+t3 = 0x5c;
+t0 = MEM_U32(t0 + 0);
+L40bd58:
+if (t0 != zero) {
+t4 = MEM_U32(t0 + 12);
+goto L40b85c;}
+a0 = MEM_U32(sp + 168);
+L40bd64:
+t9 = MEM_U32(a0 + 4);
+t7 = MEM_U32(sp + 164);
+s0 = t1;
+s3 = t7 + s5;
+if ((int)t1 >= (int)t9) goto L40bdac;
+t4 = MEM_U32(sp + 132);
+v0 = t4 + t1;
+t6 = MEM_U8(v0 + 0);
+L40bd88:
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(s3 + 0) = (uint8_t)t6;
+t5 = MEM_U32(a0 + 4);
+s5 = s5 + 0x1;
+s3 = s3 + 0x1;
+if ((int)s0 < (int)t5) {
+t6 = MEM_U8(v0 + 0);
+goto L40bd88;}
+L40bdac:
+MEM_U8(s3 + 0) = (uint8_t)zero;
+t8 = MEM_U32(sp + 172);
+s2 = s5;
+s0 = MEM_U32(sp + 148);
+s1 = zero;
+if ((int)t8 <= 0) goto L40be0c;
+s3 = t8 << 5;
+L40bdc8:
+a0 = MEM_U32(s0 + 20);
+if (a0 == zero) {
+a0 = MEM_U32(s0 + 24);
+goto L40bde8;}
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 401e0003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(s0 + 24);
+L40bde8:
+if (a0 == zero) {
+s1 = s1 + 0x20;
+goto L40be04;}
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 401e0003 gp = MEM_U32(sp + 52);
+s1 = s1 + 0x20;
+L40be04:
+s0 = s0 + 0x20;
+if (s1 != s3) goto L40bdc8;
+L40be0c:
+v1 = 0x10002cf0;
+a2 = MEM_U32(sp + 164);
+a3 = MEM_U32(sp + 176);
+a1 = MEM_U32(sp + 172);
+v1 = MEM_U32(v1 + 0);
+goto L40be30;
+L40be24:
+a2 = MEM_U32(v0 + 8);
+MEM_U32(sp + 164) = a2;
+s2 = MEM_U32(v0 + 4);
+L40be30:
+a0 = v1 + 0x1;
+at = 0x10002cf0;
+t4 = 0x10005ec0;
+t9 = a0 << 3;
+t9 = t9 + a0;
+t9 = t9 << 2;
+MEM_U32(at + 0) = a0;
+v0 = t9 + t4;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 16) = a2;
+MEM_U32(v0 + 8) = s2;
+MEM_U32(v0 + 20) = a2;
+if ((int)a1 <= 0) goto L40be70;
+MEM_U32(v0 + 32) = a2;
+goto L40be74;
+L40be70:
+MEM_U32(v0 + 32) = zero;
+L40be74:
+t6 = 0x10002e74;
+MEM_U32(v0 + 24) = a3;
+t5 = 0x10003d4c;
+t6 = MEM_U32(t6 + 0);
+t8 = 0x18;
+MEM_U32(v0 + 28) = t6;
+t5 = MEM_U32(t5 + 0);
+if (t5 != zero) {
+// bdead 1 ra = MEM_U32(sp + 60);
+goto L40bea0;}
+MEM_U32(a3 + 12) = t8;
+L40be9c:
+// bdead 1 ra = MEM_U32(sp + 60);
+L40bea0:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0xb0;
+return;
+}
+
+static uint32_t f_macarg(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40becc:
+//macarg:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff48;
+// fdead 400000eb MEM_U32(sp + 56) = s6;
+s6 = 0x10002cf0;
+t8 = 0x10005ec0;
+// fdead 428000eb MEM_U32(sp + 48) = s4;
+t6 = MEM_U32(s6 + 0);
+// fdead 428080eb MEM_U32(sp + 68) = ra;
+// fdead 428080eb MEM_U32(sp + 64) = gp;
+t7 = t6 << 3;
+t7 = t7 + t6;
+t7 = t7 << 2;
+// fdead 428180eb MEM_U32(sp + 60) = s7;
+// fdead 428180eb MEM_U32(sp + 52) = s5;
+// fdead 428180eb MEM_U32(sp + 44) = s3;
+// fdead 428180eb MEM_U32(sp + 40) = s2;
+// fdead 428180eb MEM_U32(sp + 36) = s1;
+// fdead 428180eb MEM_U32(sp + 32) = s0;
+MEM_U32(sp + 176) = zero;
+MEM_U32(sp + 172) = zero;
+MEM_U32(sp + 168) = zero;
+s4 = t7 + t8;
+t9 = MEM_U32(s4 + 16);
+t3 = MEM_U32(s4 + 8);
+s7 = a0;
+a0 = MEM_U32(s4 + 20);
+a1 = t9 + t3;
+//nop;
+t4 = sp + 0xa8;
+MEM_U32(sp + 16) = t4;
+a2 = sp + 0xb0;
+a3 = sp + 0xac;
+v0 = f_macarg1(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(s4 + 0);
+// bdead 41a0400b gp = MEM_U32(sp + 64);
+s2 = v0;
+t6 = MEM_U32(sp + 172);
+if (t5 == 0) goto L40bf7c;
+t7 = MEM_U32(sp + 168);
+if (t6 != 0) goto L40bfb4;
+if (t7 != zero) {
+t7 = MEM_U32(s4 + 20);
+goto L40bfb8;}
+L40bf7c:
+t8 = MEM_U32(s4 + 16);
+t9 = MEM_U32(s4 + 8);
+t3 = t8 + t9;
+if (v0 == t3) {
+t7 = MEM_U32(s4 + 20);
+goto L40bfb8;}
+//nop;
+if (s7 == 0) goto L40bfac;
+t4 = MEM_U32(s4 + 20);
+MEM_U32(s7 + 0) = t4;
+t5 = MEM_U32(s4 + 20);
+t6 = v0 - t5;
+MEM_U32(s7 + 8) = t6;
+L40bfac:
+MEM_U32(s4 + 20) = v0;
+goto L40c204;
+L40bfb4:
+t7 = MEM_U32(s4 + 20);
+L40bfb8:
+s3 = MEM_U32(sp + 172);
+//nop;
+s1 = s2 - t7;
+a0 = s1 + s3;
+a0 = a0 + 0x1;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 41bc000b gp = MEM_U32(sp + 64);
+MEM_U32(sp + 148) = zero;
+s5 = v0;
+//nop;
+a0 = MEM_U32(s4 + 20);
+a1 = v0;
+a2 = s1;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 41fc0003 gp = MEM_U32(sp + 64);
+MEM_U32(s4 + 20) = s2;
+t3 = MEM_U32(sp + 172);
+t9 = MEM_U32(s4 + 4);
+t5 = MEM_U32(s4 + 16);
+t6 = MEM_U32(s4 + 8);
+t4 = t9 + t3;
+MEM_U32(s4 + 4) = t4;
+t7 = t5 + t6;
+//nop;
+if (s2 != t7) goto L40c154;
+L40c01c:
+t8 = MEM_U32(s6 + 0);
+t3 = 0x10005ec0;
+t9 = t8 << 3;
+t9 = t9 + t8;
+t9 = t9 << 2;
+t4 = t9 + t3;
+t5 = MEM_U32(t4 + 24);
+if (t5 != zero) {
+t7 = MEM_U32(s4 + 24);
+goto L40c064;}
+//nop;
+a0 = s5;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 64);
+v0 = 0x10001d74;
+v0 = v0;
+goto L40c3d8;
+// fdead 0 t7 = MEM_U32(s4 + 24);
+L40c064:
+t6 = 0x17;
+MEM_U32(t7 + 12) = t6;
+//nop;
+a0 = MEM_U32(s4 + 16);
+//nop;
+wrapper_free(mem, a0);
+v1 = MEM_U32(s6 + 0);
+// bdead 41d40013 gp = MEM_U32(sp + 64);
+t5 = sp + 0xa8;
+v1 = v1 + 0xffffffff;
+t9 = 0x10005ec0;
+t8 = v1 << 3;
+t8 = t8 + v1;
+t8 = t8 << 2;
+s0 = t8 + t9;
+MEM_U32(s6 + 0) = v1;
+//nop;
+t3 = MEM_U32(s0 + 16);
+t4 = MEM_U32(s0 + 8);
+s4 = s0;
+MEM_U32(sp + 172) = zero;
+MEM_U32(sp + 168) = zero;
+a0 = MEM_U32(s0 + 20);
+MEM_U32(sp + 16) = t5;
+a2 = sp + 0xb0;
+a3 = sp + 0xac;
+a1 = t3 + t4;
+v0 = f_macarg1(mem, sp, a0, a1, a2, a3);
+// bdead 41f6000b gp = MEM_U32(sp + 64);
+t6 = MEM_U32(s0 + 20);
+t8 = MEM_U32(sp + 172);
+//nop;
+MEM_U32(sp + 148) = s1;
+t7 = v0 - t6;
+s1 = s1 + t7;
+s3 = s3 + t8;
+a1 = s1 + s3;
+s2 = v0;
+a1 = a1 + 0x1;
+a0 = s5;
+v0 = f_xrealloc(mem, sp, a0, a1);
+a0 = MEM_U32(s0 + 20);
+// bdead 41be002b gp = MEM_U32(sp + 64);
+t9 = v0 + s1;
+a2 = s2 - a0;
+a1 = t9 - a2;
+//nop;
+s5 = v0;
+//nop;
+wrapper_bcopy(mem, a0, a1, a2);
+t6 = MEM_U32(s0 + 16);
+t7 = MEM_U32(s0 + 8);
+t3 = MEM_U32(s0 + 4);
+t4 = MEM_U32(sp + 172);
+t8 = t6 + t7;
+// bdead 43fe3003 gp = MEM_U32(sp + 64);
+t5 = t3 + t4;
+MEM_U32(s0 + 20) = s2;
+MEM_U32(s0 + 4) = t5;
+if (s2 == t8) goto L40c01c;
+L40c154:
+//nop;
+if (s7 == 0) goto L40c204;
+MEM_U32(s7 + 0) = s5;
+MEM_U32(s7 + 8) = s1;
+MEM_U32(s7 + 20) = s5;
+t9 = MEM_U32(sp + 172);
+s0 = s1 + s3;
+MEM_U8(s7 + 28) = (uint8_t)t9;
+t3 = MEM_U32(sp + 168);
+MEM_U8(s7 + 29) = (uint8_t)t3;
+t4 = MEM_U32(sp + 172);
+t5 = MEM_U32(sp + 168);
+if (t4 != zero) {
+t6 = MEM_U32(s4 + 0);
+goto L40c198;}
+if (t5 == zero) {
+t6 = MEM_U32(s7 + 0);
+goto L40c1d8;}
+t6 = MEM_U32(s4 + 0);
+L40c198:
+t8 = MEM_U32(sp + 148);
+if (t6 == zero) {
+t6 = MEM_U32(s7 + 0);
+goto L40c1d8;}
+t9 = MEM_U32(s7 + 8);
+t7 = MEM_U32(s7 + 0);
+a2 = MEM_U32(sp + 172);
+a1 = t9 - t8;
+//nop;
+a0 = t7 + t8;
+//nop;
+v0 = f_discard_comments(mem, sp, a0, a1, a2);
+t4 = MEM_U32(sp + 148);
+// bdead 4102200b gp = MEM_U32(sp + 64);
+t5 = v0 + t4;
+MEM_U32(s7 + 8) = t5;
+t6 = MEM_U32(s7 + 0);
+L40c1d8:
+t7 = MEM_U32(s7 + 8);
+t8 = t6 + t7;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+t9 = MEM_U32(s7 + 8);
+//nop;
+if ((int)s0 >= (int)t9) goto L40c204;
+//nop;
+//nop;
+wrapper_abort(mem);
+// bdead 41000003 gp = MEM_U32(sp + 64);
+L40c204:
+s1 = zero;
+if (s7 == 0) goto L40c3d4;
+//nop;
+a1 = MEM_U32(s7 + 0);
+t3 = MEM_U32(s7 + 8);
+s0 = zero;
+a0 = sp + 0x70;
+a3 = 0x1;
+a2 = a1 + t3;
+f_expand_to_temp_buffer(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(sp + 128);
+// bdead 41062003 gp = MEM_U32(sp + 64);
+v1 = MEM_U32(s7 + 0);
+MEM_U32(s7 + 4) = t4;
+t5 = MEM_U32(sp + 120);
+t7 = MEM_U32(s7 + 8);
+a1 = 0x2;
+MEM_U32(s7 + 12) = t5;
+t6 = MEM_U32(sp + 128);
+a2 = t7 + v1;
+MEM_U32(s7 + 24) = t6;
+if (v1 == a2) goto L40c294;
+a0 = 0x100040c8;
+t8 = MEM_U8(v1 + 0);
+t9 = a0 + t8;
+t3 = MEM_U8(t9 + 0);
+//nop;
+if (t3 == 0) goto L40c294;
+v1 = v1 + 0x1;
+L40c278:
+//nop;
+if (v1 == a2) goto L40c294;
+t4 = MEM_U8(v1 + 0);
+t5 = a0 + t4;
+t6 = MEM_U8(t5 + 0);
+if (t6 != zero) {
+v1 = v1 + 0x1;
+goto L40c278;}
+L40c294:
+a0 = 0x100040c8;
+if (v1 == a2) goto L40c2d0;
+t7 = MEM_U8(a2 + -1);
+t8 = a0 + t7;
+t9 = MEM_U8(t8 + 0);
+//nop;
+if (t9 == 0) goto L40c2d0;
+a2 = a2 + 0xffffffff;
+L40c2b4:
+//nop;
+if (v1 == a2) goto L40c2d0;
+t3 = MEM_U8(a2 + -1);
+t4 = a0 + t3;
+t5 = MEM_U8(t4 + 0);
+if (t5 != zero) {
+a2 = a2 + 0xffffffff;
+goto L40c2b4;}
+L40c2d0:
+t6 = 0x10003d4c;
+t2 = 0x27;
+t0 = 0x5c;
+t6 = MEM_U32(t6 + 0);
+a3 = 0x22;
+//nop;
+if (t6 == 0) goto L40c2f4;
+a1 = zero;
+goto L40c2f4;
+L40c2f4:
+if (v1 == a2) {
+MEM_U32(s7 + 16) = a1;
+goto L40c3d4;}
+t1 = 0xfb4cba0;
+v0 = MEM_U8(v1 + 0);
+L40c304:
+v1 = v1 + 0x1;
+a1 = a1 + 0x1;
+if (s1 == 0) goto L40c318;
+s1 = zero;
+goto L40c350;
+L40c318:
+//nop;
+if (v0 != t0) goto L40c324;
+s1 = 0x1;
+L40c324:
+//nop;
+if (s0 == 0) goto L40c33c;
+//nop;
+if (v0 != s0) goto L40c33c;
+s0 = zero;
+goto L40c350;
+L40c33c:
+if (v0 == a3) {
+s0 = v0;
+goto L40c350;}
+if (v0 != t2) {
+t7 = a0 + v0;
+goto L40c354;}
+s0 = v0;
+L40c350:
+t7 = a0 + v0;
+L40c354:
+t8 = MEM_U8(t7 + 0);
+//nop;
+if (t8 == 0) goto L40c39c;
+//nop;
+if (s0 != 0) goto L40c39c;
+t9 = MEM_U8(v1 + 0);
+t3 = a0 + t9;
+t4 = MEM_U8(t3 + 0);
+//nop;
+if (t4 == 0) goto L40c3c8;
+t5 = MEM_U8(v1 + 1);
+L40c380:
+v1 = v1 + 0x1;
+t6 = a0 + t5;
+t7 = MEM_U8(t6 + 0);
+if (t7 != zero) {
+t5 = MEM_U8(v1 + 1);
+goto L40c380;}
+//nop;
+goto L40c3c8;
+L40c39c:
+//nop;
+if (v0 == a3) goto L40c3ac;
+t8 = t1 + v0;
+if (v0 != t0) goto L40c3b4;
+L40c3ac:
+a1 = a1 + 0x1;
+goto L40c3c8;
+L40c3b4:
+t9 = MEM_U8(t8 + 1);
+t3 = t9 & 0x57;
+//nop;
+if (t3 != 0) goto L40c3c8;
+a1 = a1 + 0x3;
+L40c3c8:
+if (v1 != a2) {
+v0 = MEM_U8(v1 + 0);
+goto L40c304;}
+MEM_U32(s7 + 16) = a1;
+L40c3d4:
+v0 = zero;
+L40c3d8:
+// bdead 9 ra = MEM_U32(sp + 68);
+// bdead 9 s0 = MEM_U32(sp + 32);
+// bdead 9 s1 = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 40);
+// bdead 9 s3 = MEM_U32(sp + 44);
+// bdead 9 s4 = MEM_U32(sp + 48);
+// bdead 9 s5 = MEM_U32(sp + 52);
+// bdead 9 s6 = MEM_U32(sp + 56);
+// bdead 9 s7 = MEM_U32(sp + 60);
+// bdead 9 sp = sp + 0xb8;
+return v0;
+}
+
+static uint32_t f_macarg1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40c404:
+//macarg1:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 40) = s5;
+// fdead 400001eb MEM_U32(sp + 36) = s4;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+at = a0 < a1;
+s4 = a3;
+s5 = a1;
+// fdead 406001ef MEM_U32(sp + 60) = ra;
+// fdead 406001ef MEM_U32(sp + 56) = fp;
+// fdead 406001ef MEM_U32(sp + 52) = gp;
+// fdead 406001ef MEM_U32(sp + 48) = s7;
+// fdead 406001ef MEM_U32(sp + 44) = s6;
+// fdead 406001ef MEM_U32(sp + 32) = s3;
+// fdead 406001ef MEM_U32(sp + 28) = s2;
+// fdead 406001ef MEM_U32(sp + 24) = s1;
+MEM_U32(sp + 72) = a2;
+s0 = a0;
+if (at == 0) goto L40c74c;
+fp = 0x27;
+s7 = 0x2f;
+s6 = 0x2a;
+s3 = 0x5c;
+s2 = 0xa;
+v0 = MEM_U8(s0 + 0);
+L40c470:
+v1 = v0;
+if (v0 < 0x30) goto L40c48c;
+s1 = s0 + 0x1;
+if (v1 == s3) goto L40c4f4;
+s0 = s0 + 0x1;
+goto L40c740;
+L40c48c:
+t6 = v1 + 0xfffffff6;
+if (t6 >= 0x26) {
+s0 = s0 + 0x1;
+goto L40c740;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L40c508;
+case 1: goto L40c73c;
+case 2: goto L40c73c;
+case 3: goto L40c73c;
+case 4: goto L40c73c;
+case 5: goto L40c73c;
+case 6: goto L40c73c;
+case 7: goto L40c73c;
+case 8: goto L40c73c;
+case 9: goto L40c73c;
+case 10: goto L40c73c;
+case 11: goto L40c73c;
+case 12: goto L40c73c;
+case 13: goto L40c73c;
+case 14: goto L40c73c;
+case 15: goto L40c73c;
+case 16: goto L40c73c;
+case 17: goto L40c73c;
+case 18: goto L40c73c;
+case 19: goto L40c73c;
+case 20: goto L40c73c;
+case 21: goto L40c73c;
+case 22: goto L40c73c;
+case 23: goto L40c73c;
+case 24: goto L40c664;
+case 25: goto L40c73c;
+case 26: goto L40c73c;
+case 27: goto L40c73c;
+case 28: goto L40c73c;
+case 29: goto L40c664;
+case 30: goto L40c4b8;
+case 31: goto L40c4cc;
+case 32: goto L40c73c;
+case 33: goto L40c73c;
+case 34: goto L40c724;
+case 35: goto L40c73c;
+case 36: goto L40c73c;
+case 37: goto L40c518;
+}
+L40c4b8:
+t7 = MEM_U32(sp + 72);
+t8 = MEM_U32(t7 + 0);
+t9 = t8 + 0x1;
+MEM_U32(t7 + 0) = t9;
+goto L40c73c;
+L40c4cc:
+t0 = MEM_U32(sp + 72);
+t1 = MEM_U32(t0 + 0);
+t2 = t1 + 0xffffffff;
+MEM_U32(t0 + 0) = t2;
+t3 = MEM_U32(sp + 72);
+t4 = MEM_U32(t3 + 0);
+if ((int)t4 >= 0) {
+s0 = s0 + 0x1;
+goto L40c740;}
+v0 = s0;
+goto L40c750;
+L40c4f4:
+if (s1 >= s5) {
+s0 = s0 + 0x1;
+goto L40c740;}
+s0 = s1;
+goto L40c73c;
+L40c508:
+t5 = MEM_U32(s4 + 0);
+t6 = t5 + 0x1;
+MEM_U32(s4 + 0) = t6;
+goto L40c73c;
+L40c518:
+v0 = MEM_U8(s0 + 1);
+//nop;
+if (s3 != v0) goto L40c548;
+t8 = MEM_U8(s0 + 2);
+//nop;
+if (s2 != t8) goto L40c548;
+//nop;
+a0 = s0 + 0x1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 1);
+L40c548:
+t9 = 0x10003d20;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L40c5bc;
+t7 = 0x1;
+if (s7 != v0) goto L40c5bc;
+t1 = MEM_U32(sp + 80);
+s0 = s0 + 0x2;
+MEM_U32(t1 + 0) = t7;
+if (s0 >= s5) goto L40c5ac;
+t2 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v1 = s2 ^ t2;
+at = s0 < s5;
+if (zero >= v1) goto L40c5ac;
+L40c58c:
+if (at == zero) {
+t3 = MEM_U32(s4 + 0);
+goto L40c5b0;}
+t0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v1 = s2 ^ t0;
+if (zero < v1) {
+at = s0 < s5;
+goto L40c58c;}
+L40c5ac:
+t3 = MEM_U32(s4 + 0);
+L40c5b0:
+t4 = t3 + 0x1;
+MEM_U32(s4 + 0) = t4;
+goto L40c73c;
+L40c5bc:
+t5 = s0 + 0x1;
+if (s6 != v0) goto L40c73c;
+t6 = 0x1;
+if (t5 >= s5) goto L40c73c;
+s0 = s0 + 0x2;
+t8 = MEM_U32(sp + 80);
+s1 = s0 + 0x1;
+MEM_U32(t8 + 0) = t6;
+if (s1 >= s5) goto L40c73c;
+v0 = MEM_U8(s0 + 0);
+L40c5ec:
+//nop;
+if (s6 != v0) goto L40c624;
+t9 = MEM_U8(s0 + 1);
+//nop;
+if (s3 != t9) goto L40c624;
+t7 = MEM_U8(s0 + 2);
+//nop;
+if (s2 != t7) goto L40c624;
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+L40c624:
+//nop;
+if (s6 != v0) goto L40c638;
+t1 = MEM_U8(s0 + 1);
+if (s7 == t1) {
+s0 = s0 + 0x1;
+goto L40c740;}
+L40c638:
+s0 = s1;
+if (s2 != v0) goto L40c64c;
+t2 = MEM_U32(s4 + 0);
+t0 = t2 + 0x1;
+MEM_U32(s4 + 0) = t0;
+L40c64c:
+s1 = s1 + 0x1;
+if (s1 < s5) {
+v0 = MEM_U8(s0 + 0);
+goto L40c5ec;}
+s0 = s0 + 0x1;
+goto L40c740;
+L40c664:
+s0 = s0 + 0x1;
+s1 = s0 + 0x1;
+v1 = v0;
+if (s1 >= s5) goto L40c73c;
+v0 = MEM_U8(s0 + 0);
+if (v1 == v0) {
+s0 = s0 + 0x1;
+goto L40c740;}
+L40c684:
+//nop;
+if (s3 != v0) goto L40c6e4;
+v0 = MEM_U8(s1 + 0);
+s0 = s1;
+//nop;
+if (s2 != v0) goto L40c6ac;
+t3 = MEM_U32(s4 + 0);
+t4 = t3 + 0x1;
+MEM_U32(s4 + 0) = t4;
+v0 = MEM_U8(s1 + 0);
+L40c6ac:
+//nop;
+if (s3 != v0) goto L40c6dc;
+t5 = MEM_U8(s0 + 1);
+//nop;
+if (s2 != t5) goto L40c6dc;
+t6 = MEM_U8(s0 + 2);
+L40c6c4:
+s0 = s0 + 0x2;
+//nop;
+if (s3 != t6) goto L40c6dc;
+t8 = MEM_U8(s0 + 1);
+if (s2 == t8) {
+t6 = MEM_U8(s0 + 2);
+goto L40c6c4;}
+L40c6dc:
+s1 = s0 + 0x1;
+goto L40c6fc;
+L40c6e4:
+if (s2 != v0) {
+s0 = s1;
+goto L40c700;}
+t9 = MEM_U32(s4 + 0);
+t7 = t9 + 0x1;
+MEM_U32(s4 + 0) = t7;
+if (v1 == fp) goto L40c73c;
+L40c6fc:
+s0 = s1;
+L40c700:
+s1 = s1 + 0x1;
+if (s1 >= s5) {
+s0 = s0 + 0x1;
+goto L40c740;}
+v0 = MEM_U8(s0 + 0);
+//nop;
+if (v1 != v0) goto L40c684;
+s0 = s0 + 0x1;
+goto L40c740;
+L40c724:
+t1 = MEM_U32(sp + 72);
+t2 = MEM_U32(t1 + 0);
+if (t2 != zero) {
+s0 = s0 + 0x1;
+goto L40c740;}
+v0 = s0;
+goto L40c750;
+L40c73c:
+s0 = s0 + 0x1;
+L40c740:
+if (s0 < s5) {
+v0 = MEM_U8(s0 + 0);
+goto L40c470;}
+L40c74c:
+v0 = s0;
+L40c750:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint32_t f_discard_comments(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40c780:
+//discard_comments:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400000eb MEM_U32(sp + 60) = ra;
+// fdead 400000eb MEM_U32(sp + 56) = fp;
+// fdead 400000eb MEM_U32(sp + 52) = gp;
+// fdead 400000eb MEM_U32(sp + 48) = s7;
+// fdead 400000eb MEM_U32(sp + 44) = s6;
+// fdead 400000eb MEM_U32(sp + 40) = s5;
+// fdead 400000eb MEM_U32(sp + 36) = s4;
+// fdead 400000eb MEM_U32(sp + 32) = s3;
+// fdead 400000eb MEM_U32(sp + 28) = s2;
+// fdead 400000eb MEM_U32(sp + 24) = s1;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 64) = a0;
+if ((int)a2 <= 0) goto L40c838;
+v1 = a0 + a1;
+s0 = v1;
+s4 = v1 + a2;
+s7 = a0;
+if (a0 == v1) goto L40c838;
+a0 = v1 - a0;
+a0 = a0 & 0x3;
+a0 = -a0;
+v0 = a0 + v1;
+if (a0 == 0) goto L40c80c;
+L40c7ec:
+t7 = MEM_U8(s0 + -1);
+s0 = s0 + 0xffffffff;
+s4 = s4 + 0xffffffff;
+MEM_U8(s4 + 0) = (uint8_t)t7;
+if (v0 != s0) goto L40c7ec;
+t8 = MEM_U32(sp + 64);
+if (t8 == s0) {
+s4 = MEM_U32(sp + 64);
+goto L40c83c;}
+L40c80c:
+t9 = MEM_U8(s0 + -1);
+s0 = s0 + 0xfffffffc;
+s4 = s4 + 0xfffffffc;
+MEM_U8(s4 + 3) = (uint8_t)t9;
+t0 = MEM_U8(s0 + 2);
+MEM_U8(s4 + 2) = (uint8_t)t0;
+t1 = MEM_U8(s0 + 1);
+MEM_U8(s4 + 1) = (uint8_t)t1;
+t2 = MEM_U8(s0 + 0);
+MEM_U8(s4 + 0) = (uint8_t)t2;
+if (s7 != s0) goto L40c80c;
+L40c838:
+s4 = MEM_U32(sp + 64);
+L40c83c:
+fp = 0xa;
+s6 = 0x2a;
+t4 = s4 + a1;
+s5 = t4 + a2;
+s0 = s4 + a2;
+s7 = s5;
+if (s0 >= s5) goto L40ca74;
+s3 = 0x5c;
+s2 = 0xa;
+v0 = MEM_U8(s0 + 0);
+L40c868:
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s4 + -1) = (uint8_t)v0;
+if (v0 == fp) goto L40c89c;
+at = 0x22;
+if (v0 == at) {
+at = 0x27;
+goto L40c9dc;}
+at = 0x27;
+if (v0 == at) {
+at = 0x2f;
+goto L40c9dc;}
+at = 0x2f;
+if (v0 == at) {
+v0 = MEM_U8(s0 + 0);
+goto L40c8ac;}
+at = s0 < s7;
+goto L40ca6c;
+L40c89c:
+MEM_U8(s4 + 0) = (uint8_t)s2;
+s4 = s4 + 0x1;
+goto L40ca68;
+// fdead 0 v0 = MEM_U8(s0 + 0);
+L40c8ac:
+//nop;
+if (s3 != v0) goto L40c8d8;
+t5 = MEM_U8(s0 + 1);
+//nop;
+if (s2 != t5) goto L40c8d8;
+//nop;
+a0 = s0;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+L40c8d8:
+t6 = 0x10003d20;
+at = 0x2f;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L40c944;
+//nop;
+if (v0 != at) goto L40c944;
+s0 = s0 + 0x1;
+s4 = s4 + 0xffffffff;
+if (s0 >= s5) goto L40ca68;
+t7 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v0 = s2 ^ t7;
+at = s0 < s5;
+if (zero >= v0) goto L40ca68;
+L40c91c:
+if (at == zero) {
+at = s0 < s7;
+goto L40ca6c;}
+t8 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+v0 = s2 ^ t8;
+if (zero < v0) {
+at = s0 < s5;
+goto L40c91c;}
+at = s0 < s7;
+goto L40ca6c;
+L40c944:
+s1 = s0 + 0x1;
+if (s6 != v0) goto L40ca68;
+if (s1 >= s5) {
+at = s0 < s7;
+goto L40ca6c;}
+s0 = s1;
+s1 = s1 + 0x1;
+s4 = s4 + 0xffffffff;
+if (s1 >= s5) goto L40c9d4;
+v0 = MEM_U8(s0 + 0);
+L40c970:
+//nop;
+if (s6 != v0) goto L40c9a8;
+t9 = MEM_U8(s0 + 1);
+//nop;
+if (s3 != t9) goto L40c9a8;
+t0 = MEM_U8(s0 + 2);
+//nop;
+if (s2 != t0) goto L40c9a8;
+//nop;
+a0 = s1;
+//nop;
+temp64 = f_newline_fix(mem, sp, a0);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s0 + 0);
+L40c9a8:
+if (s6 != v0) {
+s0 = s1;
+goto L40c9c4;}
+t1 = MEM_U8(s0 + 1);
+at = 0x2f;
+//nop;
+if (t1 == at) goto L40c9d4;
+s0 = s1;
+L40c9c4:
+s1 = s1 + 0x1;
+if (s1 < s7) {
+v0 = MEM_U8(s0 + 0);
+goto L40c970;}
+L40c9d4:
+s0 = s0 + 0x2;
+goto L40ca68;
+L40c9dc:
+v1 = v0;
+if (s0 >= s5) goto L40ca68;
+v0 = MEM_U8(s0 + 0);
+L40c9ec:
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+MEM_U8(s4 + -1) = (uint8_t)v0;
+if (v0 == v1) goto L40ca68;
+at = 0x27;
+if (v0 != fp) goto L40ca08;
+if (v1 == at) {
+at = 0x5c;
+goto L40ca68;}
+L40ca08:
+at = 0x5c;
+if (v0 != at) {
+at = s0 < s5;
+goto L40ca5c;}
+if (s0 >= s5) {
+at = s0 < s7;
+goto L40ca60;}
+v0 = MEM_U8(s0 + 0);
+if (s3 != v0) {
+MEM_U8(s4 + 0) = (uint8_t)v0;
+goto L40ca54;}
+t2 = MEM_U8(s0 + 1);
+if (s2 != t2) {
+MEM_U8(s4 + 0) = (uint8_t)v0;
+goto L40ca54;}
+v0 = MEM_U8(s0 + 2);
+L40ca38:
+s0 = s0 + 0x2;
+if (s3 != v0) {
+MEM_U8(s4 + 0) = (uint8_t)v0;
+goto L40ca54;}
+t4 = MEM_U8(s0 + 1);
+if (s2 == t4) {
+v0 = MEM_U8(s0 + 2);
+goto L40ca38;}
+MEM_U8(s4 + 0) = (uint8_t)v0;
+L40ca54:
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+L40ca5c:
+at = s0 < s7;
+L40ca60:
+if (at != zero) {
+v0 = MEM_U8(s0 + 0);
+goto L40c9ec;}
+L40ca68:
+at = s0 < s7;
+L40ca6c:
+if (at != zero) {
+v0 = MEM_U8(s0 + 0);
+goto L40c868;}
+L40ca74:
+t3 = MEM_U32(sp + 64);
+// bdead 201001 ra = MEM_U32(sp + 60);
+// bdead 201001 s0 = MEM_U32(sp + 20);
+v0 = s4 - t3;
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint64_t f_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40caac:
+//error:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffd8;
+// fdead 400001fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40cb1c;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10005ec0;
+t6 = t6 << 2;
+v0 = t6 + v1;
+t8 = MEM_U32(v0 + 0);
+L40cafc:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L40cb10;}
+t0 = v0;
+goto L40cb1c;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L40cb10:
+if (v0 >= v1) {
+t8 = MEM_U32(v0 + 0);
+goto L40cafc;}
+L40cb1c:
+if (t0 == zero) {
+t9 = MEM_U32(sp + 52);
+goto L40cb4c;}
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001d8c;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t9 = MEM_U32(sp + 52);
+L40cb4c:
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 40);
+MEM_U32(sp + 16) = t9;
+//nop;
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001d94;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 32);
+// bdead 3 ra = MEM_U32(sp + 36);
+v0 = zero;
+v1 = 0x10002e6c;
+t1 = MEM_U32(v1 + 0);
+// bdead 419 sp = sp + 0x28;
+t2 = t1 + 0x1;
+MEM_U32(v1 + 0) = t2;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_error_from_errno(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40cbac:
+//error_from_errno:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffe0;
+// fdead 4000003b MEM_U32(sp + 28) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000003b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t0 = zero;
+if ((int)v1 < 0) goto L40cc10;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10005ec0;
+t6 = t6 << 2;
+v0 = t6 + v1;
+t8 = MEM_U32(v0 + 0);
+L40cbf0:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L40cc04;}
+t0 = v0;
+goto L40cc10;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L40cc04:
+if (v0 >= v1) {
+t8 = MEM_U32(v0 + 0);
+goto L40cbf0;}
+L40cc10:
+//nop;
+if (t0 == 0) goto L40cc3c;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001d98;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40cc3c:
+v0 = 0xfb4ec80;
+t9 = 0xfb4c5b0;
+a0 = 0xfb4ee44;
+v0 = MEM_U32(v0 + 0);
+t9 = MEM_U32(t9 + 0);
+a0 = a0 + 0x20;
+if ((int)v0 >= (int)t9) {
+at = 0x18;
+goto L40ccc0;}
+at = 0x18;
+a2 = MEM_U32(sp + 32);
+if (v0 != at) goto L40cc98;
+a3 = 0x10002cf0;
+a3 = MEM_U32(a3 + 0);
+//nop;
+if ((int)a3 < (int)0xb) goto L40cc98;
+//nop;
+a1 = 0x10001da0;
+a2 = MEM_U32(sp + 32);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+goto L40ccd8;
+L40cc98:
+t2 = 0xfb4c350;
+//nop;
+a1 = 0x10001e10;
+t1 = v0 << 2;
+t3 = t1 + t2;
+a3 = MEM_U32(t3 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+goto L40ccd8;
+L40ccc0:
+//nop;
+a1 = 0x10001e18;
+a2 = MEM_U32(sp + 32);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 3 gp = MEM_U32(sp + 24);
+L40ccd8:
+v1 = 0x10002e6c;
+// bdead 13 ra = MEM_U32(sp + 28);
+v0 = zero;
+t4 = MEM_U32(v1 + 0);
+// bdead 2019 sp = sp + 0x20;
+t5 = t4 + 0x1;
+MEM_U32(v1 + 0) = t5;
+return v0;
+}
+
+static uint32_t f_warning(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40ccf8:
+//warning:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffd8;
+// fdead 400001fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40cd68;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10005ec0;
+t6 = t6 << 2;
+v0 = t6 + v1;
+t8 = MEM_U32(v0 + 0);
+L40cd48:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L40cd5c;}
+t0 = v0;
+goto L40cd68;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L40cd5c:
+if (v0 >= v1) {
+t8 = MEM_U32(v0 + 0);
+goto L40cd48;}
+L40cd68:
+//nop;
+if (t0 == 0) goto L40cd94;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001e34;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+L40cd94:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001e3c;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+t9 = MEM_U32(sp + 52);
+// bdead 44000003 gp = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 40);
+MEM_U32(sp + 16) = t9;
+//nop;
+a0 = 0xfb4ee44;
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001e48;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 13 ra = MEM_U32(sp + 36);
+// bdead 13 gp = MEM_U32(sp + 32);
+// bdead 13 sp = sp + 0x28;
+v0 = zero;
+return v0;
+}
+
+static void f_error_with_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t8 = 0,
+t9 = 0;
+L40ce04:
+//error_with_line:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+sp = sp + 0xffffffd8;
+// fdead 400000fb MEM_U32(sp + 36) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 400000fb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+// fdead 400000fb MEM_U32(sp + 52) = a3;
+t0 = zero;
+if ((int)v1 < 0) goto L40ce74;
+t6 = v1 << 3;
+t6 = t6 + v1;
+v1 = 0x10005ec0;
+t6 = t6 << 2;
+v0 = t6 + v1;
+t8 = MEM_U32(v0 + 0);
+L40ce54:
+if (t8 == zero) {
+v0 = v0 + 0xffffffdc;
+goto L40ce68;}
+t0 = v0;
+goto L40ce74;
+// fdead 0 v0 = v0 + 0xffffffdc;
+L40ce68:
+if (v0 >= v1) {
+t8 = MEM_U32(v0 + 0);
+goto L40ce54;}
+L40ce74:
+a3 = MEM_U32(sp + 40);
+if (t0 == 0) goto L40ce9c;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001e4c;
+a2 = MEM_U32(t0 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L40ce9c:
+t9 = MEM_U32(sp + 56);
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 44);
+MEM_U32(sp + 16) = t9;
+//nop;
+a2 = MEM_U32(sp + 48);
+a3 = MEM_U32(sp + 52);
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001e54;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 v0 = zero;
+v1 = 0x10002e6c;
+t1 = MEM_U32(v1 + 0);
+// bdead 411 sp = sp + 0x28;
+t2 = t1 + 0x1;
+MEM_U32(v1 + 0) = t2;
+return;
+}
+
+static uint32_t f_line_for_error(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t6 = 0, t9 = 0;
+L40cf00:
+//line_for_error:
+//nop;
+//nop;
+//nop;
+v0 = 0x10002cf0;
+v1 = a0;
+v0 = MEM_U32(v0 + 0);
+t6 = v0 << 3;
+if ((int)v0 < 0) goto L40cf6c;
+t6 = t6 + v0;
+v0 = 0x10005ec0;
+t6 = t6 << 2;
+a0 = t6 + v0;
+a1 = v0;
+L40cf34:
+t9 = MEM_U32(a0 + 0);
+a0 = a0 + 0xffffffdc;
+at = a0 < v0;
+//nop;
+if (t9 == 0) goto L40cf50;
+v0 = v1;
+return v0;
+L40cf50:
+if (at == zero) {
+at = a0 < a1;
+goto L40cf64;}
+v0 = zero;
+return v0;
+// fdead 0 at = a0 < a1;
+L40cf64:
+v1 = MEM_U32(a0 + 4);
+if (at == 0) goto L40cf34;
+L40cf6c:
+//nop;
+return v0;
+}
+
+static uint64_t f_grow_outbuf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t9 = 0;
+L40cf74:
+//grow_outbuf:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+t6 = MEM_U32(a0 + 16);
+a3 = MEM_U32(a0 + 8);
+t1 = a1 << 2;
+MEM_U32(sp + 32) = t6;
+t7 = MEM_U32(a0 + 20);
+a2 = a0;
+t1 = t1 - a1;
+v0 = t7 - t6;
+t9 = a3 - v0;
+t0 = a3 << 1;
+if ((int)a1 < (int)t9) goto L40d050;
+MEM_U32(a0 + 8) = t0;
+a3 = MEM_U32(a2 + 8);
+t2 = (int)t1 >> 1;
+if ((int)t1 >= 0) goto L40cfd4;
+at = t1 + 0x1;
+t2 = (int)at >> 1;
+L40cfd4:
+v1 = t2 + v0;
+//nop;
+if ((int)a3 >= (int)v1) goto L40cff4;
+t3 = MEM_U32(a2 + 16);
+MEM_U32(a2 + 8) = v1;
+a3 = v1;
+MEM_U32(sp + 32) = t3;
+L40cff4:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = a3;
+MEM_U32(sp + 48) = a2;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 48);
+v1 = v0;
+if (v0 != 0) goto L40d038;
+//nop;
+MEM_U32(sp + 44) = v1;
+MEM_U32(sp + 48) = a2;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 44);
+a2 = MEM_U32(sp + 48);
+L40d038:
+t4 = MEM_U32(a2 + 20);
+t5 = MEM_U32(a2 + 16);
+MEM_U32(a2 + 16) = v1;
+t6 = t4 - t5;
+t7 = t6 + v1;
+MEM_U32(a2 + 20) = t7;
+L40d050:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x30;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_install(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40d060:
+//install:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = a1;
+// fdead 400201eb MEM_U32(sp + 28) = ra;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = a2;
+MEM_U32(sp + 44) = a3;
+if ((int)a1 >= 0) goto L40d0c8;
+v0 = 0x10003dc8;
+t7 = MEM_U8(a0 + 0);
+t3 = MEM_U32(sp + 32);
+t8 = v0 + t7;
+t9 = MEM_U8(t8 + 0);
+if (t9 == zero) {
+s0 = a0 - t3;
+goto L40d0c8;}
+t0 = MEM_U8(a0 + 1);
+L40d0b0:
+a0 = a0 + 0x1;
+t1 = v0 + t0;
+t2 = MEM_U8(t1 + 0);
+if (t2 != zero) {
+t0 = MEM_U8(a0 + 1);
+goto L40d0b0;}
+s0 = a0 - t3;
+L40d0c8:
+a1 = MEM_U32(sp + 48);
+//nop;
+if ((int)a1 >= 0) goto L40d0f0;
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = s0;
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a1 = v0;
+L40d0f0:
+//nop;
+a0 = s0 + 0x1d;
+MEM_U32(sp + 48) = a1;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 48);
+a3 = v0;
+t5 = 0x100048d0;
+t4 = a1 << 2;
+a2 = s0 & 0x3;
+v1 = t4 + t5;
+MEM_U32(v0 + 8) = v1;
+t6 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t6;
+MEM_U32(v1 + 0) = v0;
+a0 = MEM_U32(v0 + 0);
+MEM_U32(v0 + 4) = zero;
+if (a0 == zero) {
+t7 = MEM_U32(sp + 40);
+goto L40d148;}
+MEM_U32(a0 + 4) = v0;
+t7 = MEM_U32(sp + 40);
+L40d148:
+MEM_U32(v0 + 16) = s0;
+a0 = v0 + 0x1c;
+MEM_U32(v0 + 12) = t7;
+t8 = MEM_U32(sp + 44);
+MEM_U32(v0 + 20) = a0;
+a1 = zero;
+MEM_U32(v0 + 24) = t8;
+v1 = MEM_U32(sp + 32);
+if ((int)s0 <= 0) goto L40d1c4;
+v0 = a2;
+if (a2 == 0) goto L40d194;
+L40d174:
+t9 = MEM_U8(v1 + 0);
+a1 = a1 + 0x1;
+a0 = a0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(a0 + -1) = (uint8_t)t9;
+if (v0 != a1) goto L40d174;
+if (a1 == s0) {
+t4 = MEM_U32(a3 + 20);
+goto L40d1c8;}
+L40d194:
+t0 = MEM_U8(v1 + 0);
+a1 = a1 + 0x4;
+a0 = a0 + 0x4;
+MEM_U8(a0 + -4) = (uint8_t)t0;
+t1 = MEM_U8(v1 + 1);
+v1 = v1 + 0x4;
+MEM_U8(a0 + -3) = (uint8_t)t1;
+t2 = MEM_U8(v1 + -2);
+MEM_U8(a0 + -2) = (uint8_t)t2;
+t3 = MEM_U8(v1 + -1);
+MEM_U8(a0 + -1) = (uint8_t)t3;
+if (a1 != s0) goto L40d194;
+L40d1c4:
+t4 = MEM_U32(a3 + 20);
+L40d1c8:
+v0 = a3;
+t5 = t4 + s0;
+MEM_U8(t5 + 0) = (uint8_t)zero;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint64_t f_lookup(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40d1e8:
+//lookup:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+s1 = a1;
+s2 = a0;
+// fdead 400c01eb MEM_U32(sp + 36) = ra;
+// fdead 400c01eb MEM_U32(sp + 32) = gp;
+// fdead 400c01eb MEM_U32(sp + 20) = s0;
+if ((int)a1 >= 0) goto L40d250;
+v1 = 0x10003dc8;
+t6 = MEM_U8(a0 + 0);
+v0 = a0;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 == zero) {
+s1 = v0 - s2;
+goto L40d250;}
+t9 = MEM_U8(v0 + 1);
+L40d238:
+v0 = v0 + 0x1;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 0);
+if (t1 != zero) {
+t9 = MEM_U8(v0 + 1);
+goto L40d238;}
+s1 = v0 - s2;
+L40d250:
+//nop;
+if ((int)a2 >= 0) goto L40d274;
+//nop;
+a0 = s2;
+a1 = s1;
+a2 = 0x57b;
+temp64 = f_hashf(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c001b gp = MEM_U32(sp + 32);
+a2 = v0;
+L40d274:
+t3 = 0x100048d0;
+t2 = a2 << 2;
+t4 = t2 + t3;
+s0 = MEM_U32(t4 + 0);
+if (s0 == zero) {
+v0 = zero;
+goto L40d2cc;}
+t5 = MEM_U32(s0 + 16);
+L40d290:
+if (s1 != t5) {
+s0 = MEM_U32(s0 + 0);
+goto L40d2c0;}
+//nop;
+a0 = MEM_U32(s0 + 20);
+a1 = s2;
+a2 = s1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400e0013 gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L40d2bc;
+v0 = s0;
+goto L40d2cc;
+L40d2bc:
+s0 = MEM_U32(s0 + 0);
+L40d2c0:
+if (s0 != zero) {
+t5 = MEM_U32(s0 + 16);
+goto L40d290;}
+v0 = zero;
+L40d2cc:
+// bdead 19 ra = MEM_U32(sp + 36);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_delete_macro(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40d2e4:
+//delete_macro:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = MEM_U32(a0 + 4);
+if (v0 == zero) {
+v0 = MEM_U32(a0 + 0);
+goto L40d314;}
+t6 = MEM_U32(a0 + 0);
+MEM_U32(v0 + 0) = t6;
+v0 = MEM_U32(a0 + 0);
+L40d314:
+if (v0 == zero) {
+v0 = MEM_U32(a0 + 8);
+goto L40d328;}
+t7 = MEM_U32(a0 + 4);
+MEM_U32(v0 + 4) = t7;
+v0 = MEM_U32(a0 + 8);
+L40d328:
+t8 = MEM_U32(v0 + 0);
+//nop;
+if (a0 != t8) goto L40d33c;
+t9 = MEM_U32(a0 + 0);
+MEM_U32(v0 + 0) = t9;
+L40d33c:
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint64_t f_hashf(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, lo = 0, hi = 0;
+L40d35c:
+//hashf:
+// bdead e3 v0 = a1;
+v1 = zero;
+if (a1 == 0) {
+a1 = a1 + 0xffffffff;
+goto L40d388;}
+a1 = a1 + 0xffffffff;
+L40d36c:
+t6 = MEM_U8(a0 + 0);
+// bdead 80f1 v0 = a1;
+t7 = v1 << 2;
+a0 = a0 + 0x1;
+v1 = t6 + t7;
+if (a1 != 0) {
+a1 = a1 + 0xffffffff;
+goto L40d36c;}
+a1 = a1 + 0xffffffff;
+L40d388:
+at = 0x7fff0000;
+at = at | 0xffff;
+t8 = v1 & at;
+lo = (int)t8 / (int)a2; hi = (int)t8 % (int)a2;
+v0 = hi;
+//nop;
+if (a2 != 0) goto L40d3a8;
+abort();
+L40d3a8:
+at = 0xffffffff;
+if (a2 != at) {
+at = 0x80000000;
+goto L40d3c0;}
+at = 0x80000000;
+//nop;
+if (t8 != at) goto L40d3c0;
+abort();
+L40d3c0:
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static void f_dump_all_macros(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L40d3c8:
+//dump_all_macros:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+// fdead 4000000b MEM_U32(sp + 56) = fp;
+// fdead 4000000b MEM_U32(sp + 48) = s7;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+s5 = 0x10001e68;
+s6 = 0x10001e74;
+s7 = 0x10001e78;
+fp = 0x10001e80;
+t6 = 0x100048d0;
+// fdead c1c0800b MEM_U32(sp + 60) = ra;
+// fdead c1c0800b MEM_U32(sp + 52) = gp;
+// fdead c1c0800b MEM_U32(sp + 36) = s4;
+// fdead c1c0800b MEM_U32(sp + 32) = s3;
+// fdead c1c0800b MEM_U32(sp + 28) = s2;
+// fdead c1c0800b MEM_U32(sp + 24) = s1;
+// fdead c1c0800b MEM_U32(sp + 20) = s0;
+s5 = s5;
+s6 = s6;
+s7 = s7;
+fp = fp;
+MEM_U32(sp + 64) = t6;
+L40d42c:
+t7 = MEM_U32(sp + 64);
+v0 = MEM_U32(t7 + 0);
+if (v0 == zero) {
+t5 = MEM_U32(sp + 64);
+goto L40d624;}
+t8 = MEM_U32(v0 + 12);
+L40d440:
+at = 0x17;
+s4 = zero;
+s3 = zero;
+if (t8 != at) goto L40d614;
+//nop;
+a0 = 0x10001e58;
+s2 = MEM_U32(v0 + 24);
+a1 = MEM_U32(v0 + 20);
+MEM_U32(sp + 88) = v0;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+t9 = MEM_U32(s2 + 0);
+// bdead c5f801c3 gp = MEM_U32(sp + 52);
+//nop;
+if ((int)t9 < 0) goto L40d504;
+//nop;
+a0 = 0x10001e64;
+s1 = zero;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+t0 = MEM_U32(s2 + 0);
+// bdead c1fc03c3 gp = MEM_U32(sp + 52);
+//nop;
+if ((int)t0 <= 0) goto L40d4f0;
+L40d4a0:
+//nop;
+a0 = s2;
+a1 = s1;
+//nop;
+f_dump_arg_n(mem, sp, a0, a1);
+v0 = MEM_U32(s2 + 0);
+s0 = s1 + 0x1;
+// bdead c1fa01cb gp = MEM_U32(sp + 52);
+if ((int)s0 >= (int)v0) {
+at = (int)s0 < (int)v0;
+goto L40d4e8;}
+//nop;
+a0 = s5;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1fa01c3 gp = MEM_U32(sp + 52);
+v0 = MEM_U32(s2 + 0);
+at = (int)s0 < (int)v0;
+L40d4e8:
+s1 = s0;
+if (at != 0) goto L40d4a0;
+L40d4f0:
+//nop;
+a0 = 0x10001e6c;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1f801c3 gp = MEM_U32(sp + 52);
+L40d504:
+//nop;
+a0 = 0x10001e70;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+s0 = MEM_U32(s2 + 12);
+// bdead c1fa0003 gp = MEM_U32(sp + 52);
+//nop;
+if (s0 == 0) goto L40d5e0;
+L40d524:
+//nop;
+a0 = MEM_U32(s2 + 8);
+a1 = s4;
+a2 = MEM_U32(s0 + 8);
+f_dump_defn_1(mem, sp, a0, a1, a2);
+v0 = MEM_U32(s0 + 8);
+// bdead c1fa01cb gp = MEM_U32(sp + 52);
+if (v0 == zero) {
+t1 = MEM_U8(s0 + 4);
+goto L40d550;}
+s3 = zero;
+t1 = MEM_U8(s0 + 4);
+L40d550:
+s4 = s4 + v0;
+if (t1 == zero) {
+t2 = MEM_U8(s0 + 5);
+goto L40d574;}
+//nop;
+a0 = s6;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1fa01c3 gp = MEM_U32(sp + 52);
+t2 = MEM_U8(s0 + 5);
+L40d574:
+//nop;
+if (t2 == 0) goto L40d598;
+//nop;
+if (s3 != 0) goto L40d598;
+//nop;
+a0 = s7;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1ea0003 gp = MEM_U32(sp + 52);
+L40d598:
+//nop;
+s3 = zero;
+a0 = s2;
+a1 = MEM_U32(s0 + 12);
+f_dump_arg_n(mem, sp, a0, a1);
+t3 = MEM_U8(s0 + 6);
+// bdead c1fa11c3 gp = MEM_U32(sp + 52);
+if (t3 == zero) {
+s0 = MEM_U32(s0 + 0);
+goto L40d5d8;}
+//nop;
+a0 = fp;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1ea0003 gp = MEM_U32(sp + 52);
+s3 = 0x1;
+s0 = MEM_U32(s0 + 0);
+L40d5d8:
+//nop;
+if (s0 != 0) goto L40d524;
+L40d5e0:
+//nop;
+t4 = MEM_U32(s2 + 4);
+a0 = MEM_U32(s2 + 8);
+a1 = s4;
+a2 = t4 - s4;
+f_dump_defn_1(mem, sp, a0, a1, a2);
+// bdead c1c001c3 gp = MEM_U32(sp + 52);
+//nop;
+a0 = 0x10001e88;
+a0 = a0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_printf(mem, a0, sp);
+// bdead c1c00183 gp = MEM_U32(sp + 52);
+v0 = MEM_U32(sp + 88);
+L40d614:
+v0 = MEM_U32(v0 + 0);
+if (v0 != zero) {
+t8 = MEM_U32(v0 + 12);
+goto L40d440;}
+t5 = MEM_U32(sp + 64);
+L40d624:
+t7 = 0x100048d0;
+t6 = t5 + 0x4;
+t7 = t7 + 0x15ec;
+MEM_U32(sp + 64) = t6;
+if (t6 != t7) goto L40d42c;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static void f_dump_defn_1(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, s6 = 0, s7 = 0, t9 = 0, fp = 0;
+uint64_t temp64;
+L40d668:
+//dump_defn_1:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 400000eb MEM_U32(sp + 44) = s4;
+v0 = a0 + a1;
+s4 = v0 + a2;
+// fdead 402000eb MEM_U32(sp + 28) = s0;
+at = v0 < s4;
+// fdead 402000ef MEM_U32(sp + 68) = ra;
+// fdead 402000ef MEM_U32(sp + 64) = fp;
+// fdead 402000ef MEM_U32(sp + 60) = gp;
+// fdead 402000ef MEM_U32(sp + 56) = s7;
+// fdead 402000ef MEM_U32(sp + 52) = s6;
+// fdead 402000ef MEM_U32(sp + 48) = s5;
+// fdead 402000ef MEM_U32(sp + 40) = s3;
+// fdead 402000ef MEM_U32(sp + 36) = s2;
+// fdead 402000ef MEM_U32(sp + 32) = s1;
+s0 = v0;
+MEM_U32(sp + 72) = s4;
+if (at == 0) goto L40d7bc;
+s3 = 0xfb4ee44;
+fp = 0x27;
+s7 = 0x22;
+s6 = 0xfb4e580;
+s5 = 0xa;
+s1 = 0xfb4ee44;
+s3 = s3 + 0x10;
+v0 = MEM_U8(s0 + 0);
+L40d6dc:
+//nop;
+if (s5 == v0) goto L40d754;
+t6 = MEM_U32(s6 + 0);
+if (t6 == zero) {
+t7 = MEM_U32(s1 + 16);
+goto L40d710;}
+//nop;
+a0 = v0;
+a1 = s3;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead c1f60003 gp = MEM_U32(sp + 60);
+goto L40d7a8;
+// fdead 0 t7 = MEM_U32(s1 + 16);
+L40d710:
+t9 = t7 + 0xffffffff;
+MEM_U32(s1 + 16) = t9;
+if ((int)t9 >= 0) goto L40d738;
+//nop;
+a0 = MEM_U8(s0 + 0);
+a1 = s3;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead c1f60003 gp = MEM_U32(sp + 60);
+goto L40d7a8;
+L40d738:
+t0 = MEM_U8(s0 + 0);
+t1 = MEM_U32(s1 + 20);
+MEM_U8(t1 + 0) = (uint8_t)t0;
+t2 = MEM_U32(s1 + 20);
+t3 = t2 + 0x1;
+MEM_U32(s1 + 20) = t3;
+goto L40d7a8;
+L40d754:
+a0 = s0;
+if (s7 == v0) goto L40d764;
+if (fp != v0) {
+t4 = MEM_U32(sp + 72);
+goto L40d7ac;}
+L40d764:
+//nop;
+a1 = s4;
+a2 = zero;
+a3 = zero;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 20) = zero;
+temp64 = f_skip_quoted_string(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c1f6000b gp = MEM_U32(sp + 60);
+s2 = v0;
+a0 = s0;
+//nop;
+a1 = v0 - s0;
+a2 = 0x1;
+a3 = s3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead c1fc0003 gp = MEM_U32(sp + 60);
+s0 = s2 + 0xffffffff;
+L40d7a8:
+t4 = MEM_U32(sp + 72);
+L40d7ac:
+s0 = s0 + 0x1;
+if (s0 < t4) {
+v0 = MEM_U8(s0 + 0);
+goto L40d6dc;}
+L40d7bc:
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 s1 = MEM_U32(sp + 32);
+// bdead 1 s2 = MEM_U32(sp + 36);
+// bdead 1 s3 = MEM_U32(sp + 40);
+// bdead 1 s4 = MEM_U32(sp + 44);
+// bdead 1 s5 = MEM_U32(sp + 48);
+// bdead 1 s6 = MEM_U32(sp + 52);
+// bdead 1 s7 = MEM_U32(sp + 56);
+// bdead 1 fp = MEM_U32(sp + 64);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void f_dump_arg_n(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L40d7ec:
+//dump_arg_n:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s4;
+// fdead 4000006b MEM_U32(sp + 32) = s3;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+t6 = MEM_U32(a0 + 0);
+s0 = a1 + 0x1;
+s2 = a0;
+s1 = MEM_U32(a0 + 16);
+if ((int)s0 >= (int)t6) goto L40d85c;
+L40d830:
+//nop;
+a0 = s1;
+a1 = 0x20;
+//nop;
+v0 = wrapper_strchr(mem, a0, a1);
+t7 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+// bdead 400b000b gp = MEM_U32(sp + 40);
+s1 = v0 + 0x1;
+if ((int)s0 < (int)t7) goto L40d830;
+L40d85c:
+v0 = MEM_U8(s1 + 0);
+s4 = 0x2c;
+if (v0 == zero) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40d90c;}
+if (s4 == v0) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40d90c;}
+s2 = 0xfb4ee44;
+s3 = 0xfb4e580;
+s0 = 0xfb4ee44;
+s2 = s2 + 0x10;
+t8 = MEM_U32(s3 + 0);
+L40d888:
+if (t8 == zero) {
+t9 = MEM_U32(s0 + 16);
+goto L40d8b0;}
+//nop;
+a0 = v0;
+a1 = s2;
+//nop;
+v0 = wrapper___semputc(mem, a0, a1);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+goto L40d8f0;
+// fdead 0 t9 = MEM_U32(s0 + 16);
+L40d8b0:
+t0 = t9 + 0xffffffff;
+MEM_U32(s0 + 16) = t0;
+if ((int)t0 >= 0) goto L40d8d8;
+//nop;
+a0 = MEM_U8(s1 + 0);
+a1 = s2;
+//nop;
+v0 = wrapper___flsbuf(mem, a0, a1);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+goto L40d8f0;
+L40d8d8:
+t2 = MEM_U8(s1 + 0);
+t3 = MEM_U32(s0 + 20);
+MEM_U8(t3 + 0) = (uint8_t)t2;
+t4 = MEM_U32(s0 + 20);
+t5 = t4 + 0x1;
+MEM_U32(s0 + 20) = t5;
+L40d8f0:
+v0 = MEM_U8(s1 + 1);
+s1 = s1 + 0x1;
+if (v0 == zero) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40d90c;}
+if (s4 != v0) {
+t8 = MEM_U32(s3 + 0);
+goto L40d888;}
+// bdead 1 ra = MEM_U32(sp + 44);
+L40d90c:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void f_initialize_char_syntax(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L40d928:
+//initialize_char_syntax:
+//nop;
+//nop;
+//nop;
+v1 = 0x10003dc8;
+a0 = 0x10003ec8;
+v0 = 0x10003ec8;
+a1 = 0x1;
+v1 = v1 + 0x61;
+a0 = a0 + 0x61;
+v0 = v0 + 0x7b;
+L40d950:
+a0 = a0 + 0x1;
+at = a0 < v0;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -33) = (uint8_t)a1;
+MEM_U8(v1 + -1) = (uint8_t)a1;
+MEM_U8(a0 + -33) = (uint8_t)a1;
+MEM_U8(a0 + -1) = (uint8_t)a1;
+if (at != 0) goto L40d950;
+at = 0x10003dc8;
+v1 = 0x10003dc8;
+v0 = 0x10003dc8;
+MEM_U8(at + 48) = (uint8_t)a1;
+at = 0x10003dc8;
+v1 = v1 + 0x32;
+v0 = v0 + 0x3a;
+MEM_U8(at + 49) = (uint8_t)a1;
+L40d990:
+v1 = v1 + 0x4;
+MEM_U8(v1 + -3) = (uint8_t)a1;
+MEM_U8(v1 + -2) = (uint8_t)a1;
+MEM_U8(v1 + -1) = (uint8_t)a1;
+MEM_U8(v1 + -4) = (uint8_t)a1;
+if (v1 != v0) goto L40d990;
+v1 = 0x10003dc8;
+a0 = 0x10003ec8;
+v0 = 0x10002e70;
+MEM_U8(v1 + 95) = (uint8_t)a1;
+MEM_U8(a0 + 95) = (uint8_t)a1;
+v0 = MEM_U32(v0 + 0);
+a3 = 0x100040c8;
+a2 = 0x10003fc8;
+MEM_U8(v1 + 36) = (uint8_t)v0;
+MEM_U8(a0 + 36) = (uint8_t)v0;
+MEM_U8(a3 + 32) = (uint8_t)a1;
+MEM_U8(a3 + 9) = (uint8_t)a1;
+MEM_U8(a3 + 11) = (uint8_t)a1;
+MEM_U8(a3 + 12) = (uint8_t)a1;
+MEM_U8(a3 + 10) = (uint8_t)a1;
+MEM_U8(a2 + 32) = (uint8_t)a1;
+MEM_U8(a2 + 9) = (uint8_t)a1;
+MEM_U8(a2 + 11) = (uint8_t)a1;
+MEM_U8(a2 + 12) = (uint8_t)a1;
+return;
+}
+
+static void f_initialize_builtins(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40d9f8:
+//initialize_builtins:
+//nop;
+//nop;
+//nop;
+//nop;
+a0 = 0x10001e8c;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+t6 = 0xffffffff;
+// fdead 4000802b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = 0xffffffff;
+a2 = 0xf;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t7 = 0xffffffff;
+MEM_U32(sp + 16) = t7;
+//nop;
+a0 = 0x10001e98;
+a1 = 0xffffffff;
+a2 = 0x10;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t8 = 0xffffffff;
+MEM_U32(sp + 16) = t8;
+//nop;
+a0 = 0x10001ea4;
+a1 = 0xffffffff;
+a2 = 0x11;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t9 = 0xffffffff;
+MEM_U32(sp + 16) = t9;
+//nop;
+a0 = 0x10001eb0;
+a1 = 0xffffffff;
+a2 = 0x12;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t0 = 0xffffffff;
+MEM_U32(sp + 16) = t0;
+//nop;
+a0 = 0x10001ec0;
+a1 = 0xffffffff;
+a2 = 0x13;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t1 = 0xffffffff;
+MEM_U32(sp + 16) = t1;
+//nop;
+a0 = 0x10001ed4;
+a1 = 0xffffffff;
+a2 = 0x14;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+t2 = 0xffffffff;
+MEM_U32(sp + 16) = t2;
+//nop;
+a0 = 0x10001ee0;
+a1 = 0xffffffff;
+a2 = 0x15;
+a3 = zero;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t3 = 0xffffffff;
+MEM_U32(sp + 16) = t3;
+//nop;
+a0 = 0x10001eec;
+a1 = 0xffffffff;
+a2 = 0x16;
+a3 = 0x1;
+a0 = a0;
+temp64 = f_install(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_make_definition(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40db60:
+//make_definition:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+// fdead 400000ab MEM_U32(sp + 20) = s0;
+v1 = 0x10003dc8;
+t6 = MEM_U8(a0 + 0);
+a1 = a0;
+s0 = a0;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+v0 = a0;
+if (t8 == zero) {
+t2 = MEM_U8(v0 + 0);
+goto L40dbbc;}
+t9 = MEM_U8(v0 + 1);
+L40dba4:
+v0 = v0 + 0x1;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 0);
+if (t1 != zero) {
+t9 = MEM_U8(v0 + 1);
+goto L40dba4;}
+t2 = MEM_U8(v0 + 0);
+L40dbbc:
+//nop;
+if (t2 != 0) goto L40dc10;
+//nop;
+a0 = v0 - a1;
+a0 = a0 + 0x4;
+MEM_U32(sp + 56) = a1;
+v0 = f_alloca(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 56);
+s0 = v0;
+//nop;
+a0 = v0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a0 = s0;
+//nop;
+a1 = 0x10001efc;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+L40dc10:
+v1 = 0x10002cf0;
+t4 = 0x10005ec0;
+t5 = 0x10001f00;
+v0 = MEM_U32(v1 + 0);
+a0 = s0;
+t5 = t5;
+v0 = v0 + 0x1;
+t3 = v0 << 3;
+t3 = t3 + v0;
+t3 = t3 << 2;
+a1 = t3 + t4;
+MEM_U32(a1 + 0) = t5;
+MEM_U32(a1 + 20) = s0;
+MEM_U32(a1 + 16) = s0;
+MEM_U32(v1 + 0) = v0;
+//nop;
+MEM_U32(sp + 32) = a1;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+a1 = MEM_U32(sp + 32);
+// bdead 4002004b gp = MEM_U32(sp + 24);
+v1 = 0x1;
+MEM_U32(a1 + 8) = v0;
+t6 = 0x10002e74;
+MEM_U32(a1 + 4) = v1;
+MEM_U32(a1 + 24) = zero;
+MEM_U32(a1 + 32) = zero;
+t6 = MEM_U32(t6 + 0);
+a3 = 0x10002d40;
+MEM_U32(a1 + 28) = t6;
+t7 = MEM_U32(a3 + 12);
+//nop;
+if (v1 == t7) goto L40dca4;
+t8 = MEM_U32(a3 + 32);
+L40dc98:
+a3 = a3 + 0x14;
+if (v1 != t8) {
+t8 = MEM_U32(a3 + 32);
+goto L40dc98;}
+L40dca4:
+//nop;
+a0 = s0;
+MEM_U32(sp + 48) = a3;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+a0 = s0;
+//nop;
+a1 = v0 + s0;
+a2 = zero;
+//nop;
+temp64 = f_do_define(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+v1 = 0x10002cf0;
+t9 = MEM_U32(v1 + 0);
+// bdead 4000011 sp = sp + 0x38;
+t0 = t9 + 0xffffffff;
+MEM_U32(v1 + 0) = t0;
+return;
+}
+
+static void f_make_undef(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40dcfc:
+//make_undef:
+//nop;
+//nop;
+//nop;
+v1 = 0x10002cf0;
+t7 = 0x10005ec0;
+t8 = 0x10001f14;
+v0 = MEM_U32(v1 + 0);
+sp = sp + 0xffffffd0;
+t8 = t8;
+v0 = v0 + 0x1;
+t6 = v0 << 3;
+t6 = t6 + v0;
+t6 = t6 << 2;
+a1 = t6 + t7;
+MEM_U32(a1 + 0) = t8;
+MEM_U32(a1 + 20) = a0;
+MEM_U32(a1 + 16) = a0;
+MEM_U32(v1 + 0) = v0;
+//nop;
+// fdead 420180fb MEM_U32(sp + 28) = ra;
+// fdead 420180fb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a1;
+MEM_U32(sp + 48) = a0;
+v0 = wrapper_strlen(mem, a0);
+a1 = MEM_U32(sp + 32);
+// bdead 4000004b gp = MEM_U32(sp + 24);
+t9 = 0x1;
+MEM_U32(a1 + 8) = v0;
+t0 = 0x10002e74;
+MEM_U32(a1 + 4) = t9;
+MEM_U32(a1 + 24) = zero;
+MEM_U32(a1 + 32) = zero;
+t0 = MEM_U32(t0 + 0);
+a3 = 0x10002d40;
+v1 = 0x9;
+MEM_U32(a1 + 28) = t0;
+t1 = MEM_U32(a3 + 12);
+a0 = MEM_U32(sp + 48);
+//nop;
+if (v1 == t1) goto L40ddac;
+t2 = MEM_U32(a3 + 32);
+L40dda0:
+a3 = a3 + 0x14;
+if (v1 != t2) {
+t2 = MEM_U32(a3 + 32);
+goto L40dda0;}
+L40ddac:
+//nop;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 40) = a3;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+a3 = MEM_U32(sp + 40);
+//nop;
+a1 = v0 + a0;
+a1 = a1 + 0xffffffff;
+a2 = zero;
+temp64 = f_do_undef(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+v1 = 0x10002cf0;
+t3 = MEM_U32(v1 + 0);
+// bdead 1011 sp = sp + 0x30;
+t4 = t3 + 0xffffffff;
+MEM_U32(v1 + 0) = t4;
+return;
+}
+
+static uint32_t f_deps_output(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40de00:
+//deps_output:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+a2 = a1;
+if (a1 != 0) goto L40de38;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = v0;
+L40de38:
+t0 = 0x10003d60;
+v0 = 0x10003d5c;
+v1 = MEM_U32(t0 + 0);
+t6 = MEM_U32(v0 + 0);
+a3 = v1 + a2;
+t7 = a3 + 0x32;
+if ((int)a3 < (int)t6) goto L40de90;
+MEM_U32(v0 + 0) = t7;
+a1 = t7 << 1;
+MEM_U32(v0 + 0) = a1;
+//nop;
+a0 = 0x10003d58;
+MEM_U32(sp + 36) = a2;
+a0 = MEM_U32(a0 + 0);
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+at = 0x10003d58;
+t0 = 0x10003d60;
+MEM_U32(at + 0) = v0;
+v1 = MEM_U32(t0 + 0);
+L40de90:
+t1 = 0x10003d58;
+//nop;
+a0 = MEM_U32(sp + 32);
+t1 = MEM_U32(t1 + 0);
+MEM_U32(sp + 36) = a2;
+a1 = t1 + v1;
+wrapper_bcopy(mem, a0, a1, a2);
+// bdead 40000013 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+v0 = 0x10003d64;
+t0 = 0x10003d60;
+t6 = 0x10003d58;
+t4 = MEM_U32(v0 + 0);
+t2 = MEM_U32(t0 + 0);
+t5 = t4 + a2;
+t3 = t2 + a2;
+MEM_U32(v0 + 0) = t5;
+MEM_U32(t0 + 0) = t3;
+t6 = MEM_U32(t6 + 0);
+t8 = t6 + t3;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_bzero(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L40def4:
+if ((int)zero >= (int)a1) {
+a1 = a1 + 0xffffffff;
+goto L40df14;}
+a1 = a1 + 0xffffffff;
+L40df00:
+v0 = (int)zero < (int)a1;
+a1 = a1 + 0xffffffff;
+MEM_U8(a0 + 0) = (uint8_t)zero;
+a0 = a0 + 0x1;
+if (v0 != 0) goto L40df00;
+L40df14:
+//nop;
+return;
+}
+
+static uint32_t f_bcopy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0;
+L40df1c:
+//bcopy:
+v0 = (int)zero < (int)a2;
+a2 = a2 + 0xffffffff;
+if (v0 == 0) goto L40df44;
+L40df28:
+t6 = MEM_U8(a0 + 0);
+v0 = (int)zero < (int)a2;
+a2 = a2 + 0xffffffff;
+a1 = a1 + 0x1;
+a0 = a0 + 0x1;
+MEM_U8(a1 + -1) = (uint8_t)t6;
+if (v0 != 0) goto L40df28;
+L40df44:
+//nop;
+return v0;
+}
+
+static uint32_t f_bcmp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L40df4c:
+if ((int)zero >= (int)a2) {
+a2 = a2 + 0xffffffff;
+goto L40df8c;}
+a2 = a2 + 0xffffffff;
+L40df58:
+t6 = MEM_U8(a0 + 0);
+t7 = MEM_U8(a1 + 0);
+a0 = a0 + 0x1;
+a1 = a1 + 0x1;
+v0 = t6 ^ t7;
+if (zero >= v0) {
+v0 = (int)zero < (int)a2;
+goto L40df84;}
+v0 = 0x1;
+return v0;
+// fdead 0 v0 = (int)zero < (int)a2;
+L40df84:
+a2 = a2 + 0xffffffff;
+if (v0 != 0) goto L40df58;
+L40df8c:
+v0 = zero;
+//nop;
+return v0;
+}
+
+static void f_fatal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L40df98:
+//fatal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+a1 = 0x10001f1c;
+a0 = 0xfb4ee44;
+a2 = 0x10003d1c;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a1;
+a0 = a0 + 0x20;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+a2 = MEM_U32(sp + 36);
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10001f24;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_perror_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e038:
+//perror_with_name:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+MEM_U32(sp + 32) = a0;
+a0 = 0xfb4ee44;
+a1 = 0x10001f28;
+a2 = 0x10003d1c;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+v0 = 0xfb4ec80;
+t6 = 0xfb4c5b0;
+a0 = 0xfb4ee44;
+v0 = MEM_U32(v0 + 0);
+t6 = MEM_U32(t6 + 0);
+a0 = a0 + 0x20;
+//nop;
+if ((int)v0 >= (int)t6) goto L40e0cc;
+t8 = 0xfb4c350;
+t7 = v0 << 2;
+a1 = 0x10001f30;
+t9 = t7 + t8;
+a3 = MEM_U32(t9 + 0);
+//nop;
+a1 = a1;
+//nop;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40e0e0;
+L40e0cc:
+//nop;
+a1 = 0x10001f38;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40e0e0:
+v0 = 0x10002e6c;
+// bdead 9 ra = MEM_U32(sp + 28);
+t0 = MEM_U32(v0 + 0);
+// bdead 209 sp = sp + 0x20;
+t1 = t0 + 0x1;
+MEM_U32(v0 + 0) = t1;
+return;
+}
+
+static void f_pfatal_with_name(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L40e0fc:
+//pfatal_with_name:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000016b MEM_U32(sp + 28) = ra;
+// fdead 4000016b MEM_U32(sp + 24) = gp;
+f_perror_with_name(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x21;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_memory_full(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L40e144:
+//memory_full:
+//nop;
+//nop;
+//nop;
+//nop;
+a0 = 0x10001f54;
+sp = sp + 0xffffffe0;
+// fdead 400001ab MEM_U32(sp + 28) = ra;
+// fdead 400001ab MEM_U32(sp + 24) = gp;
+a0 = a0;
+f_fatal(mem, sp, a0, a1, a2, a3);
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 gp = MEM_U32(sp + 24);
+// bdead 19 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L40e180:
+//xmalloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40e1b0;
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40e1c4;
+L40e1b0:
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+L40e1c4:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L40e1d0:
+//xrealloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40000149 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40e200;
+// bdead 9 ra = MEM_U32(sp + 28);
+goto L40e214;
+L40e200:
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+L40e214:
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint64_t f_xcalloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, s0 = 0, lo = 0,
+hi = 0;
+L40e220:
+//xcalloc:
+//nop;
+//nop;
+//nop;
+lo = a0 * a1; hi = (uint32_t)((uint64_t)a0 * (uint64_t)a1 >> 32);
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 6400001eb MEM_U32(sp + 20) = s0;
+// fdead 6400001eb MEM_U32(sp + 28) = ra;
+// fdead 6400001eb MEM_U32(sp + 24) = gp;
+s0 = lo;
+a0 = s0;
+MEM_U32(sp + 36) = s0;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002004b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+MEM_U32(sp + 32) = v0;
+if (v0 == 0) goto L40e2e8;
+v1 = v0;
+if ((int)s0 < (int)0x65) goto L40e28c;
+//nop;
+a0 = v0;
+a1 = s0;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 40000011 gp = MEM_U32(sp + 24);
+goto L40e2e0;
+L40e28c:
+a2 = v0 + s0;
+a1 = a2 + 0xfffffffc;
+t0 = s0 + 0xfffffffc;
+a0 = t0;
+if (v0 >= a1) goto L40e2b4;
+L40e2a4:
+v1 = v1 + 0x4;
+MEM_U32(v1 + -4) = zero;
+if (v1 < a1) goto L40e2a4;
+L40e2b4:
+if ((int)t0 >= 0) {
+at = (int)a0 < (int)s0;
+goto L40e2c4;}
+a0 = zero;
+at = (int)a0 < (int)s0;
+L40e2c4:
+v1 = v0 + a0;
+if (at == 0) goto L40e2e0;
+L40e2cc:
+a0 = a0 + 0x1;
+at = (int)a0 < (int)a3;
+MEM_U8(v1 + 0) = (uint8_t)zero;
+v1 = v1 + 0x1;
+if (at != 0) goto L40e2cc;
+L40e2e0:
+v0 = MEM_U32(sp + 32);
+goto L40e2f8;
+L40e2e8:
+//nop;
+//nop;
+f_memory_full(mem, sp, a0, a1, a2, a3);
+// bdead 19 gp = MEM_U32(sp + 24);
+L40e2f8:
+// bdead 19 ra = MEM_U32(sp + 28);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 sp = sp + 0x28;
+//nop;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_savestring(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L40e30c:
+//savestring:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+a0 = v0;
+//nop;
+a1 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000011 ra = MEM_U32(sp + 28);
+// bdead 40000011 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 32);
+// bdead 19 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_file_size_and_mode(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L40e374:
+//file_size_and_mode:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff58;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 172) = a1;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 176) = a2;
+a1 = sp + 0x20;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 172);
+a0 = MEM_U32(sp + 176);
+if ((int)v0 >= 0) goto L40e3b8;
+v0 = 0xffffffff;
+goto L40e3d4;
+L40e3b8:
+v0 = zero;
+if (v1 == 0) goto L40e3c8;
+t6 = MEM_U32(sp + 52);
+MEM_U32(v1 + 0) = t6;
+L40e3c8:
+t7 = MEM_U32(sp + 80);
+if (a0 == 0) goto L40e3d4;
+MEM_U32(a0 + 0) = t7;
+L40e3d4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0xa8;
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_parse_number(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0,
+s0 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L40e3f0:
+//parse_number:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10003cb0;
+// fdead 400201eb MEM_U32(sp + 28) = ra;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+a3 = zero;
+t1 = 0xa;
+t0 = a0;
+v0 = zero;
+s0 = MEM_U32(s0 + 0);
+if ((int)a0 <= 0) goto L40e46c;
+v1 = s0;
+a0 = 0x2e;
+L40e434:
+t7 = MEM_U8(v1 + 0);
+v0 = v0 + 0x1;
+at = (int)v0 < (int)t0;
+//nop;
+if (a0 != t7) goto L40e464;
+//nop;
+a0 = 0x10002670;
+a0 = a0;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40e638;
+L40e464:
+v1 = v1 + 0x1;
+if (at != 0) goto L40e434;
+L40e46c:
+t8 = MEM_U32(sp + 56);
+t2 = 0x10003d90;
+a0 = s0;
+MEM_U32(t2 + 4) = zero;
+if ((int)t8 < (int)0x3) goto L40e50c;
+//nop;
+a1 = 0x100026a8;
+a2 = 0x2;
+MEM_U32(sp + 48) = a3;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400200cb gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = 0x10003d90;
+if (v0 == 0) goto L40e4f8;
+//nop;
+a1 = 0x100026ac;
+a0 = s0;
+a2 = 0x2;
+MEM_U32(sp + 48) = a3;
+MEM_U32(sp + 36) = t0;
+MEM_U32(sp + 40) = t1;
+a1 = a1;
+v0 = wrapper_strncmp(mem, a0, a1, a2);
+// bdead 400200cb gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+t2 = 0x10003d90;
+if (v0 != 0) goto L40e50c;
+L40e4f8:
+t0 = MEM_U32(sp + 56);
+s0 = s0 + 0x2;
+t1 = 0x10;
+t0 = t0 + 0xfffffffe;
+goto L40e520;
+L40e50c:
+t9 = MEM_U8(s0 + 0);
+at = 0x30;
+//nop;
+if (t9 != at) goto L40e520;
+t1 = 0x8;
+L40e520:
+v1 = 0x10;
+if ((int)t0 <= 0) goto L40e5f8;
+v0 = MEM_U8(s0 + 0);
+L40e52c:
+s0 = s0 + 0x1;
+t0 = t0 + 0xffffffff;
+if ((int)v0 < (int)0x41) {
+at = (int)v0 < (int)0x5b;
+goto L40e54c;}
+if ((int)v0 >= (int)0x5b) {
+at = (int)v0 < (int)0x30;
+goto L40e550;}
+v0 = v0 + 0x20;
+L40e54c:
+at = (int)v0 < (int)0x30;
+L40e550:
+if (at != 0) {
+at = (int)v0 < (int)0x3a;
+goto L40e574;}
+//nop;
+if ((int)v0 >= (int)0x3a) goto L40e574;
+lo = a3 * t1; hi = (uint32_t)((uint64_t)a3 * (uint64_t)t1 >> 32);
+a3 = lo;
+a3 = a3 + v0;
+a3 = a3 + 0xffffffd0;
+goto L40e5f0;
+L40e574:
+at = (int)v0 < (int)0x61;
+if (t1 != v1) goto L40e5a0;
+if ((int)v0 < (int)0x61) {
+at = (int)v0 < (int)0x67;
+goto L40e5a0;}
+if ((int)v0 >= (int)0x67) {
+t1 = 0x1;
+goto L40e5a4;}
+lo = a3 * t1; hi = (uint32_t)((uint64_t)a3 * (uint64_t)t1 >> 32);
+a3 = lo;
+a3 = a3 + v0;
+a3 = a3 + 0xffffffa9;
+goto L40e5f0;
+L40e5a0:
+t1 = 0x1;
+L40e5a4:
+a2 = 0x55;
+a1 = 0x75;
+a0 = 0x4c;
+v1 = 0x6c;
+L40e5b4:
+//nop;
+if (v0 == v1) goto L40e5d8;
+//nop;
+if (v0 == a0) goto L40e5d8;
+if (v0 == a1) {
+MEM_U32(t2 + 4) = t1;
+goto L40e5d8;}
+//nop;
+if (v0 != a2) goto L40e5f8;
+MEM_U32(t2 + 4) = t1;
+L40e5d8:
+//nop;
+if (t0 == 0) goto L40e5f8;
+v0 = MEM_U8(s0 + 0);
+s0 = s0 + 0x1;
+t0 = t0 + 0xffffffff;
+goto L40e5b4;
+L40e5f0:
+if ((int)t0 > 0) {
+v0 = MEM_U8(s0 + 0);
+goto L40e52c;}
+L40e5f8:
+t1 = 0x1;
+if (t0 == 0) goto L40e61c;
+//nop;
+a0 = 0x100026b0;
+a0 = a0;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40e638;
+L40e61c:
+//nop;
+if ((int)a3 >= 0) goto L40e628;
+MEM_U32(t2 + 4) = t1;
+L40e628:
+at = 0x10003cb0;
+v0 = 0x101;
+MEM_U32(at + 0) = s0;
+MEM_U32(t2 + 0) = a3;
+L40e638:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_yylex(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L40e64c:
+//yylex:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10003cb0;
+v1 = 0x10002ecc;
+a0 = 0x10002ecc;
+// fdead 400201fb MEM_U32(sp + 28) = ra;
+// fdead 400201fb MEM_U32(sp + 24) = gp;
+s0 = s0;
+v1 = v1;
+a0 = MEM_U32(a0 + 0);
+L40e680:
+t1 = MEM_U32(s0 + 0);
+t2 = MEM_U8(t1 + 0);
+a1 = t1;
+a3 = t2;
+if (a0 == 0) goto L40e6d8;
+t6 = 0x10002ecc;
+t6 = t6;
+v0 = MEM_U32(t6 + 0);
+t7 = MEM_U8(v0 + 0);
+L40e6a4:
+if (a3 != t7) {
+v0 = MEM_U32(v1 + 8);
+goto L40e6cc;}
+t8 = MEM_U8(a1 + 1);
+t9 = MEM_U8(v0 + 1);
+t3 = t1 + 0x2;
+if (t8 != t9) goto L40e6c8;
+MEM_U32(s0 + 0) = t3;
+v0 = MEM_U32(v1 + 4);
+goto L40e9b8;
+L40e6c8:
+v0 = MEM_U32(v1 + 8);
+L40e6cc:
+v1 = v1 + 0x8;
+if (v0 != zero) {
+t7 = MEM_U8(v0 + 0);
+goto L40e6a4;}
+L40e6d8:
+if ((int)a3 < (int)0x7d) {
+at = 0x7d;
+goto L40e6fc;}
+at = 0x7d;
+if (a3 == at) {
+at = 0x7e;
+goto L40e8a0;}
+at = 0x7e;
+if (a3 == at) {
+t3 = t1 + 0x1;
+goto L40e8a4;}
+at = (int)a3 < (int)0x30;
+goto L40e8d0;
+L40e6fc:
+if ((int)a3 < (int)0x7c) {
+at = 0x7c;
+goto L40e718;}
+at = 0x7c;
+if (a3 == at) {
+t3 = t1 + 0x1;
+goto L40e8a4;}
+at = (int)a3 < (int)0x30;
+goto L40e8d0;
+L40e718:
+if ((int)a3 < (int)0x5f) {
+at = 0x7b;
+goto L40e734;}
+at = 0x7b;
+if (a3 == at) {
+t3 = t1 + 0x1;
+goto L40e8a4;}
+at = (int)a3 < (int)0x30;
+goto L40e8d0;
+L40e734:
+if (a3 >= 0x5f) {
+at = (int)a3 < (int)0x30;
+goto L40e8d0;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (a3) {
+case 0: goto L40e75c;
+case 1: goto L40e8cc;
+case 2: goto L40e8cc;
+case 3: goto L40e8cc;
+case 4: goto L40e8cc;
+case 5: goto L40e8cc;
+case 6: goto L40e8cc;
+case 7: goto L40e8cc;
+case 8: goto L40e8cc;
+case 9: goto L40e764;
+case 10: goto L40e764;
+case 11: goto L40e8cc;
+case 12: goto L40e8cc;
+case 13: goto L40e8cc;
+case 14: goto L40e8cc;
+case 15: goto L40e8cc;
+case 16: goto L40e8cc;
+case 17: goto L40e8cc;
+case 18: goto L40e8cc;
+case 19: goto L40e8cc;
+case 20: goto L40e8cc;
+case 21: goto L40e8cc;
+case 22: goto L40e8cc;
+case 23: goto L40e8cc;
+case 24: goto L40e8cc;
+case 25: goto L40e8cc;
+case 26: goto L40e8cc;
+case 27: goto L40e8cc;
+case 28: goto L40e8cc;
+case 29: goto L40e8cc;
+case 30: goto L40e8cc;
+case 31: goto L40e8cc;
+case 32: goto L40e764;
+case 33: goto L40e8a0;
+case 34: goto L40e8b0;
+case 35: goto L40e8cc;
+case 36: goto L40e8cc;
+case 37: goto L40e8a0;
+case 38: goto L40e8a0;
+case 39: goto L40e7d0;
+case 40: goto L40e8a0;
+case 41: goto L40e8a0;
+case 42: goto L40e8a0;
+case 43: goto L40e8a0;
+case 44: goto L40e8a0;
+case 45: goto L40e8a0;
+case 46: goto L40e8a0;
+case 47: goto L40e8a0;
+case 48: goto L40e8cc;
+case 49: goto L40e8cc;
+case 50: goto L40e8cc;
+case 51: goto L40e8cc;
+case 52: goto L40e8cc;
+case 53: goto L40e8cc;
+case 54: goto L40e8cc;
+case 55: goto L40e8cc;
+case 56: goto L40e8cc;
+case 57: goto L40e8cc;
+case 58: goto L40e8a0;
+case 59: goto L40e8cc;
+case 60: goto L40e8a0;
+case 61: goto L40e8a0;
+case 62: goto L40e8a0;
+case 63: goto L40e8a0;
+case 64: goto L40e8a0;
+case 65: goto L40e8cc;
+case 66: goto L40e8cc;
+case 67: goto L40e8cc;
+case 68: goto L40e8cc;
+case 69: goto L40e8cc;
+case 70: goto L40e8cc;
+case 71: goto L40e8cc;
+case 72: goto L40e8cc;
+case 73: goto L40e8cc;
+case 74: goto L40e8cc;
+case 75: goto L40e8cc;
+case 76: goto L40e778;
+case 77: goto L40e8cc;
+case 78: goto L40e8cc;
+case 79: goto L40e8cc;
+case 80: goto L40e8cc;
+case 81: goto L40e8cc;
+case 82: goto L40e8cc;
+case 83: goto L40e8cc;
+case 84: goto L40e8cc;
+case 85: goto L40e8cc;
+case 86: goto L40e8cc;
+case 87: goto L40e8cc;
+case 88: goto L40e8cc;
+case 89: goto L40e8cc;
+case 90: goto L40e8cc;
+case 91: goto L40e8a0;
+case 92: goto L40e8cc;
+case 93: goto L40e8a0;
+case 94: goto L40e8a0;
+}
+L40e75c:
+v0 = zero;
+goto L40e9b8;
+L40e764:
+v1 = 0x10002ecc;
+t5 = t1 + 0x1;
+MEM_U32(s0 + 0) = t5;
+v1 = v1;
+goto L40e680;
+L40e778:
+t0 = 0x10003fc8;
+v1 = MEM_U8(t1 + 1);
+a2 = 0x1;
+a0 = t1 + 0x1;
+v0 = t0 + v1;
+t6 = MEM_U8(v0 + 0);
+//nop;
+if (t6 == 0) goto L40e7b4;
+v1 = MEM_U8(a0 + 1);
+L40e79c:
+a2 = a2 + 0x1;
+a0 = a0 + 0x1;
+v0 = t0 + v1;
+t7 = MEM_U8(v0 + 0);
+if (t7 != zero) {
+v1 = MEM_U8(a0 + 1);
+goto L40e79c;}
+L40e7b4:
+t8 = 0x10003fc8;
+t9 = t1 + a2;
+t8 = t8 + 0x27;
+if (v0 != t8) {
+at = (int)a3 < (int)0x30;
+goto L40e8d0;}
+MEM_U32(s0 + 0) = t9;
+t1 = t9;
+L40e7d0:
+t3 = t1 + 0x1;
+MEM_U32(s0 + 0) = t3;
+a3 = MEM_U8(t3 + 0);
+t4 = t3 + 0x1;
+at = 0x5c;
+MEM_U32(s0 + 0) = t4;
+if (a3 != at) goto L40e804;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_parse_escape(mem, sp, a0, a1, a2, a3);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+a3 = v0;
+L40e804:
+//nop;
+a0 = 0x100026f4;
+a1 = 0x11;
+a2 = 0xffffffff;
+MEM_U32(sp + 36) = a3;
+a0 = a0;
+temp64 = f_lookup(mem, sp, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400200cb gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+if (v0 != 0) goto L40e83c;
+t5 = (int)a3 >> 7;
+t6 = t5 & 0x1;
+//nop;
+if (t6 != 0) goto L40e84c;
+L40e83c:
+v0 = 0x10003d90;
+t7 = a3 & 0xff;
+MEM_U32(v0 + 0) = t7;
+goto L40e85c;
+L40e84c:
+v0 = 0x10003d90;
+at = 0xffffff00;
+t8 = a3 | at;
+MEM_U32(v0 + 0) = t8;
+L40e85c:
+t1 = MEM_U32(s0 + 0);
+MEM_U32(v0 + 4) = zero;
+at = 0x27;
+a3 = MEM_U8(t1 + 0);
+t9 = t1 + 0x1;
+MEM_U32(s0 + 0) = t9;
+//nop;
+if (a3 == at) goto L40e898;
+//nop;
+a0 = 0x10002708;
+a0 = a0;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40e9b8;
+L40e898:
+v0 = 0x102;
+goto L40e9b8;
+L40e8a0:
+t3 = t1 + 0x1;
+L40e8a4:
+MEM_U32(s0 + 0) = t3;
+v0 = a3;
+goto L40e9b8;
+L40e8b0:
+//nop;
+a0 = 0x1000272c;
+a0 = a0;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40e9b8;
+L40e8cc:
+at = (int)a3 < (int)0x30;
+L40e8d0:
+if (at != 0) {
+at = (int)a3 < (int)0x3a;
+goto L40e944;}
+//nop;
+if ((int)a3 >= (int)0x3a) goto L40e944;
+v1 = 0x10003dc8;
+a0 = zero;
+v0 = v1 + a3;
+t4 = MEM_U8(v0 + 0);
+t5 = v1 + 0x2e;
+if (t4 != zero) {
+a0 = a0 + 0x1;
+goto L40e908;}
+//nop;
+if (v0 != t5) goto L40e930;
+a0 = a0 + 0x1;
+L40e908:
+t6 = a1 + a0;
+a3 = MEM_U8(t6 + 0);
+a2 = 0x10003dc8;
+v0 = v1 + a3;
+t7 = MEM_U8(v0 + 0);
+a2 = a2 + 0x2e;
+if (t7 != zero) {
+a0 = a0 + 0x1;
+goto L40e908;}
+if (v0 == a2) {
+a0 = a0 + 0x1;
+goto L40e908;}
+L40e930:
+//nop;
+//nop;
+v0 = f_parse_number(mem, sp, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 24);
+goto L40e9b8;
+L40e944:
+t8 = 0x10003ec8;
+t9 = a3 + t8;
+t3 = MEM_U8(t9 + 0);
+//nop;
+if (t3 != 0) goto L40e974;
+//nop;
+a0 = 0x10002764;
+a0 = a0;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x104;
+goto L40e9b8;
+L40e974:
+v1 = 0x10003dc8;
+a0 = zero;
+v0 = a1;
+t4 = v1 + t2;
+t5 = MEM_U8(t4 + 0);
+if (t5 == zero) {
+t9 = t1 + a0;
+goto L40e9b0;}
+t6 = MEM_U8(v0 + 1);
+L40e994:
+a0 = a0 + 0x1;
+v0 = v0 + 0x1;
+t7 = v1 + t6;
+t8 = MEM_U8(t7 + 0);
+if (t8 != zero) {
+t6 = MEM_U8(v0 + 1);
+goto L40e994;}
+t9 = t1 + a0;
+L40e9b0:
+MEM_U32(s0 + 0) = t9;
+v0 = 0x103;
+L40e9b8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_parse_escape(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e9cc:
+//parse_escape:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = MEM_U32(a0 + 0);
+a2 = a0;
+v1 = MEM_U8(v0 + 0);
+t6 = v0 + 0x1;
+MEM_U32(a0 + 0) = t6;
+if ((int)v1 < (int)0xb) {
+at = (int)v1 < (int)0x38;
+goto L40ea60;}
+t8 = v1 + 0xffffffd0;
+if ((int)v1 < (int)0x38) goto L40ea38;
+t7 = v1 + 0xffffffa2;
+if (t7 >= 0x1b) {
+v0 = v1;
+goto L40ec70;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40ead4;
+case 1: goto L40ec6c;
+case 2: goto L40ec6c;
+case 3: goto L40ea78;
+case 4: goto L40ea80;
+case 5: goto L40ec6c;
+case 6: goto L40ec6c;
+case 7: goto L40ea88;
+case 8: goto L40ea90;
+case 9: goto L40ec6c;
+case 10: goto L40ec6c;
+case 11: goto L40ec6c;
+case 12: goto L40ec6c;
+case 13: goto L40ec6c;
+case 14: goto L40ec6c;
+case 15: goto L40ec6c;
+case 16: goto L40ea98;
+case 17: goto L40ec6c;
+case 18: goto L40ec6c;
+case 19: goto L40ec6c;
+case 20: goto L40eaa0;
+case 21: goto L40ec6c;
+case 22: goto L40eaa8;
+case 23: goto L40ec6c;
+case 24: goto L40eab0;
+case 25: goto L40ec6c;
+case 26: goto L40ebb8;
+}
+L40ea38:
+if (t8 >= 0x8) {
+v0 = v1;
+goto L40ec70;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L40eb28;
+case 1: goto L40eb28;
+case 2: goto L40eb28;
+case 3: goto L40eb28;
+case 4: goto L40eb28;
+case 5: goto L40eb28;
+case 6: goto L40eb28;
+case 7: goto L40eb28;
+}
+L40ea60:
+at = 0xa;
+if (v1 == 0) goto L40eac0;
+//nop;
+if (v1 == at) goto L40eab8;
+v0 = v1;
+goto L40ec70;
+L40ea78:
+v0 = 0x7;
+goto L40ec70;
+L40ea80:
+v0 = 0x8;
+goto L40ec70;
+L40ea88:
+v0 = 0x1b;
+goto L40ec70;
+L40ea90:
+v0 = 0xc;
+goto L40ec70;
+L40ea98:
+v0 = 0xa;
+goto L40ec70;
+L40eaa0:
+v0 = 0xd;
+goto L40ec70;
+L40eaa8:
+v0 = 0x9;
+goto L40ec70;
+L40eab0:
+v0 = 0xb;
+goto L40ec70;
+L40eab8:
+v0 = 0xfffffffe;
+goto L40ec70;
+L40eac0:
+t9 = MEM_U32(a2 + 0);
+v0 = zero;
+t0 = t9 + 0xffffffff;
+MEM_U32(a2 + 0) = t0;
+goto L40ec70;
+L40ead4:
+v0 = MEM_U32(a2 + 0);
+at = 0x5c;
+v1 = MEM_U8(v0 + 0);
+t1 = v0 + 0x1;
+MEM_U32(a2 + 0) = t1;
+if (v1 != at) {
+at = 0x3f;
+goto L40eb0c;}
+//nop;
+a0 = a2;
+//nop;
+v0 = f_parse_escape(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = v0;
+at = 0x3f;
+L40eb0c:
+t2 = v1 & 0x80;
+if (v1 != at) goto L40eb1c;
+v0 = 0x7f;
+goto L40ec70;
+L40eb1c:
+t3 = v1 & 0x1f;
+v0 = t2 | t3;
+goto L40ec70;
+L40eb28:
+a1 = v1 + 0xffffffd0;
+a0 = 0x1;
+a3 = 0x3;
+v0 = MEM_U32(a2 + 0);
+L40eb38:
+a0 = a0 + 0x1;
+t5 = a1 << 3;
+v1 = MEM_U8(v0 + 0);
+t4 = v0 + 0x1;
+MEM_U32(a2 + 0) = t4;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x38;
+goto L40eb6c;}
+if ((int)v1 >= (int)0x38) {
+t6 = MEM_U32(a2 + 0);
+goto L40eb70;}
+a1 = t5 + v1;
+a1 = a1 + 0xffffffd0;
+goto L40eb7c;
+L40eb6c:
+t6 = MEM_U32(a2 + 0);
+L40eb70:
+t7 = t6 + 0xffffffff;
+MEM_U32(a2 + 0) = t7;
+goto L40eb84;
+L40eb7c:
+if (a0 != a3) {
+v0 = MEM_U32(a2 + 0);
+goto L40eb38;}
+L40eb84:
+t8 = a1 >> 8;
+//nop;
+if (t8 == 0) goto L40ebb0;
+//nop;
+a0 = 0x10002780;
+a1 = a1 & 0xff;
+MEM_U32(sp + 40) = a1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+L40ebb0:
+v0 = a1;
+goto L40ec70;
+L40ebb8:
+a1 = zero;
+L40ebbc:
+v0 = MEM_U32(a2 + 0);
+t2 = a1 << 4;
+v1 = MEM_U8(v0 + 0);
+t9 = v0 + 0x1;
+MEM_U32(a2 + 0) = t9;
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x3a;
+goto L40ebf0;}
+t0 = a1 << 4;
+if ((int)v1 >= (int)0x3a) goto L40ebf0;
+a1 = t0 + v1;
+a1 = a1 + 0xffffffd0;
+goto L40ebbc;
+L40ebf0:
+if ((int)v1 < (int)0x61) {
+at = (int)v1 < (int)0x67;
+goto L40ec10;}
+t1 = a1 << 4;
+if ((int)v1 >= (int)0x67) goto L40ec10;
+a1 = t1 + v1;
+a1 = a1 + 0xffffffa9;
+goto L40ebbc;
+L40ec10:
+if ((int)v1 < (int)0x41) {
+at = (int)v1 < (int)0x47;
+goto L40ec30;}
+if ((int)v1 >= (int)0x47) {
+t3 = MEM_U32(a2 + 0);
+goto L40ec34;}
+a1 = t2 + v1;
+a1 = a1 + 0xffffffc9;
+goto L40ebbc;
+L40ec30:
+t3 = MEM_U32(a2 + 0);
+L40ec34:
+t5 = a1 >> 8;
+t4 = t3 + 0xffffffff;
+MEM_U32(a2 + 0) = t4;
+if (t5 == 0) goto L40ec64;
+//nop;
+a0 = 0x100027b0;
+a1 = a1 & 0xff;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+v0 = f_warning(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+L40ec64:
+v0 = a1;
+goto L40ec70;
+L40ec6c:
+v0 = v1;
+L40ec70:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void f_yyerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0;
+uint64_t temp64;
+L40ec80:
+//yyerror:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = 0x1;
+//nop;
+a0 = 0x10003c40;
+a0 = a0;
+wrapper_longjmp(mem, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_parse_c_expression(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0;
+uint64_t temp64;
+L40eccc:
+//parse_c_expression:
+//nop;
+//nop;
+//nop;
+v1 = 0x10003cb0;
+sp = sp + 0xffffffe0;
+// fdead 40000033 MEM_U32(sp + 28) = ra;
+v1 = v1;
+// fdead 40000033 MEM_U32(sp + 24) = gp;
+MEM_U32(v1 + 0) = a0;
+if (a0 == 0) goto L40ed00;
+t6 = MEM_U8(a0 + 0);
+//nop;
+if (t6 != 0) goto L40ed1c;
+L40ed00:
+//nop;
+a0 = 0x100027e0;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40ed88;
+L40ed1c:
+//nop;
+a0 = 0x10003c40;
+a0 = a0;
+v0 = wrapper_setjmp(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40ed3c;
+v0 = zero;
+goto L40ed88;
+L40ed3c:
+//nop;
+//nop;
+v0 = f_yyparse(mem, sp);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40ed58;
+v0 = zero;
+goto L40ed88;
+L40ed58:
+t7 = 0x10003cb0;
+t7 = MEM_U32(t7 + 0);
+t8 = MEM_U8(t7 + 0);
+//nop;
+if (t8 == 0) goto L40ed80;
+//nop;
+a0 = 0x100027f8;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 24);
+L40ed80:
+v0 = 0x10003d6c;
+v0 = MEM_U32(v0 + 0);
+L40ed88:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_yyparse(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0, lo = 0, hi = 0;
+uint64_t temp64;
+L40ed98:
+//yyparse:
+//nop;
+//nop;
+//nop;
+a1 = 0x10002ec4;
+a2 = 0x10003d74;
+a0 = 0x10002ec0;
+t6 = MEM_U32(a1 + 0);
+v0 = 0x10003d78;
+a3 = 0x10003d7c;
+t7 = t6 + 0xfffffff8;
+MEM_U32(a2 + 0) = t7;
+a0 = MEM_U32(a0 + 0);
+at = 0x10003d80;
+sp = sp + 0xffffff90;
+t8 = a0 + 0xfffffffc;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(a3 + 0) = zero;
+MEM_U32(at + 0) = zero;
+at = 0x10003d84;
+// fdead 420181ef MEM_U32(sp + 40) = s5;
+s5 = 0x10003d8c;
+MEM_U32(at + 0) = zero;
+at = 0x10003d88;
+// fdead 424181ef MEM_U32(sp + 36) = s4;
+s4 = 0xffffffff;
+// fdead 426181ef MEM_U32(sp + 56) = fp;
+MEM_U32(at + 0) = zero;
+// fdead 426181ef MEM_U32(sp + 60) = ra;
+// fdead 426181ef MEM_U32(sp + 52) = gp;
+// fdead 426181ef MEM_U32(sp + 48) = s7;
+// fdead 426181ef MEM_U32(sp + 44) = s6;
+// fdead 426181ef MEM_U32(sp + 32) = s3;
+// fdead 426181ef MEM_U32(sp + 28) = s2;
+// fdead 426181ef MEM_U32(sp + 24) = s1;
+// fdead 426181ef MEM_U32(sp + 20) = s0;
+fp = MEM_U32(sp + 108);
+MEM_U32(s5 + 0) = s4;
+L40ee2c:
+s6 = MEM_U32(a2 + 0);
+s3 = MEM_U32(v0 + 0);
+s1 = MEM_U32(a3 + 0);
+L40ee38:
+v1 = 0x10002ec8;
+s3 = s3 + 0x4;
+v1 = MEM_U32(v1 + 0);
+t9 = v1 << 2;
+t0 = a0 + t9;
+s0 = v1 << 1;
+if (s3 < t0) goto L40f03c;
+v0 = MEM_U32(a1 + 0);
+t5 = MEM_U32(a2 + 0);
+at = 0x96;
+t1 = fp - v0;
+t3 = s6 - v0;
+t6 = t5 - v0;
+t2 = (int)t1 >> 3;
+t4 = (int)t3 >> 3;
+t7 = (int)t6 >> 3;
+MEM_U32(sp + 80) = t2;
+MEM_U32(sp + 76) = t4;
+MEM_U32(sp + 72) = t7;
+MEM_U32(sp + 68) = a0;
+if (v1 != at) goto L40ef24;
+//nop;
+s2 = s0 << 2;
+a0 = s2;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 407e000b gp = MEM_U32(sp + 52);
+s7 = s0 << 3;
+s6 = v0;
+//nop;
+a0 = s7;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 41fe018b gp = MEM_U32(sp + 52);
+fp = v0;
+if (s6 == 0) goto L40ef1c;
+a0 = s6;
+if (v0 == 0) goto L40ef1c;
+//nop;
+a1 = 0x10002ec0;
+a2 = s2;
+a1 = MEM_U32(a1 + 0);
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead c176000b gp = MEM_U32(sp + 52);
+a0 = fp;
+a2 = s7;
+//nop;
+at = 0x10002ec0;
+a1 = 0x10002ec4;
+MEM_U32(at + 0) = v0;
+a1 = MEM_U32(a1 + 0);
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 4076018b gp = MEM_U32(sp + 52);
+at = 0x10002ec4;
+MEM_U32(at + 0) = v0;
+goto L40ef84;
+L40ef1c:
+s0 = zero;
+goto L40ef84;
+L40ef24:
+//nop;
+a1 = s0 << 2;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 4076000b gp = MEM_U32(sp + 52);
+a1 = s0 << 3;
+//nop;
+at = 0x10002ec0;
+a0 = 0x10002ec4;
+MEM_U32(at + 0) = v0;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 4076018b gp = MEM_U32(sp + 52);
+t8 = 0x10002ec0;
+at = 0x10002ec4;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(at + 0) = v0;
+if (t8 == zero) {
+s0 = zero;
+goto L40ef84;}
+t9 = 0x10002ec4;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 != 0) goto L40ef84;
+s0 = zero;
+L40ef84:
+t0 = 0x10002ec8;
+t0 = MEM_U32(t0 + 0);
+//nop;
+if ((int)t0 < (int)s0) goto L40efd0;
+//nop;
+a0 = 0x10002818;
+a1 = 0x10002824;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_gettxt(mem, a0, a1);
+// bdead 400001c9 gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 52);
+v0 = 0x1;
+goto L40fbe4;
+L40efd0:
+t1 = 0x10002ec0;
+at = 0x10002ec8;
+t2 = MEM_U32(sp + 68);
+t3 = 0x10003d78;
+t1 = MEM_U32(t1 + 0);
+v0 = 0x10002ec4;
+t3 = MEM_U32(t3 + 0);
+MEM_U32(at + 0) = s0;
+a0 = t1 - t2;
+at = 0x10003d78;
+a0 = (int)a0 >> 2;
+v1 = a0 << 2;
+t9 = MEM_U32(sp + 72);
+v0 = MEM_U32(v0 + 0);
+t4 = v1 + t3;
+t5 = MEM_U32(sp + 80);
+t7 = MEM_U32(sp + 76);
+MEM_U32(at + 0) = t4;
+at = 0x10003d74;
+t0 = t9 << 3;
+t1 = t0 + v0;
+t6 = t5 << 3;
+t8 = t7 << 3;
+s3 = v1 + s3;
+fp = t6 + v0;
+s6 = t8 + v0;
+MEM_U32(at + 0) = t1;
+L40f03c:
+t2 = 0x10003d98;
+MEM_U32(s3 + 0) = s1;
+t5 = 0x1000347c;
+t4 = MEM_U32(t2 + 0);
+s2 = s1 << 2;
+s7 = s2 + t5;
+MEM_U32(s6 + 8) = t4;
+t3 = MEM_U32(t2 + 4);
+s6 = s6 + 0x8;
+MEM_U32(s6 + 4) = t3;
+v0 = MEM_U32(s7 + 0);
+L40f068:
+at = 0xff670000;
+at = at | 0x6981;
+s0 = v0;
+if ((int)v0 >= (int)at) goto L40f08c;
+t6 = 0x1000374c;
+t7 = s2 + t6;
+v0 = MEM_U32(t7 + 0);
+goto L40f168;
+L40f08c:
+a0 = MEM_U32(s5 + 0);
+if ((int)a0 >= 0) {
+s0 = s0 + a0;
+goto L40f0c0;}
+//nop;
+//nop;
+v0 = f_yylex(mem, sp, a0, a1, a2);
+// bdead c1fe018b gp = MEM_U32(sp + 52);
+MEM_U32(s5 + 0) = v0;
+a0 = v0;
+if ((int)v0 >= 0) goto L40f0bc;
+MEM_U32(s5 + 0) = zero;
+a0 = zero;
+L40f0bc:
+s0 = s0 + a0;
+L40f0c0:
+at = (int)s0 < (int)0x154;
+if ((int)s0 < 0) goto L40f0d0;
+//nop;
+if ((int)s0 < (int)0x154) goto L40f0e0;
+L40f0d0:
+t8 = 0x1000374c;
+t9 = s2 + t8;
+v0 = MEM_U32(t9 + 0);
+goto L40f168;
+L40f0e0:
+t1 = 0x10002f2c;
+t0 = s0 << 2;
+t4 = 0x10003664;
+t2 = t0 + t1;
+s0 = MEM_U32(t2 + 0);
+t3 = s0 << 2;
+t5 = t3 + t4;
+t6 = MEM_U32(t5 + 0);
+//nop;
+if (a0 != t6) goto L40f15c;
+t8 = 0x10003d90;
+MEM_U32(s5 + 0) = s4;
+t7 = 0x10003d98;
+t9 = MEM_U32(t8 + 4);
+t0 = MEM_U32(t8 + 0);
+v0 = 0x10003d88;
+MEM_U32(t7 + 4) = t9;
+MEM_U32(t7 + 0) = t0;
+v0 = MEM_U32(v0 + 0);
+s1 = s0;
+//nop;
+if ((int)v0 <= 0) goto L40f144;
+at = 0x10003d88;
+t1 = v0 + 0xffffffff;
+MEM_U32(at + 0) = t1;
+L40f144:
+a0 = 0x10002ec0;
+a3 = 0x10003d7c;
+a2 = 0x10003d74;
+a1 = 0x10002ec4;
+a0 = MEM_U32(a0 + 0);
+goto L40ee38;
+L40f15c:
+t2 = 0x1000374c;
+t3 = s2 + t2;
+v0 = MEM_U32(t3 + 0);
+L40f168:
+at = 0xfffffffe;
+s0 = v0;
+if (v0 != at) goto L40f220;
+t4 = MEM_U32(s5 + 0);
+//nop;
+if ((int)t4 >= 0) goto L40f19c;
+//nop;
+//nop;
+v0 = f_yylex(mem, sp, a0, a1, a2);
+// bdead c1fc018b gp = MEM_U32(sp + 52);
+MEM_U32(s5 + 0) = v0;
+if ((int)v0 >= 0) goto L40f19c;
+MEM_U32(s5 + 0) = zero;
+L40f19c:
+v1 = 0x10002f14;
+t6 = MEM_U32(v1 + 0);
+v0 = v1;
+if (s4 != t6) {
+t8 = MEM_U32(v0 + 8);
+goto L40f1c0;}
+t7 = MEM_U32(v1 + 4);
+if (s1 == t7) {
+v1 = MEM_U32(v0 + 8);
+goto L40f1dc;}
+t8 = MEM_U32(v0 + 8);
+L40f1c0:
+v0 = v0 + 0x8;
+if (s4 != t8) {
+t8 = MEM_U32(v0 + 8);
+goto L40f1c0;}
+t9 = MEM_U32(v0 + 4);
+if (s1 != t9) {
+t8 = MEM_U32(v0 + 8);
+goto L40f1c0;}
+v1 = MEM_U32(v0 + 8);
+L40f1dc:
+v0 = v0 + 0x8;
+if ((int)v1 < 0) {
+s0 = MEM_U32(v0 + 4);
+goto L40f210;}
+a0 = MEM_U32(s5 + 0);
+if (a0 == v1) {
+s0 = MEM_U32(v0 + 4);
+goto L40f210;}
+v1 = MEM_U32(v0 + 8);
+L40f1f8:
+v0 = v0 + 0x8;
+if ((int)v1 < 0) {
+s0 = MEM_U32(v0 + 4);
+goto L40f210;}
+if (a0 != v1) {
+v1 = MEM_U32(v0 + 8);
+goto L40f1f8;}
+s0 = MEM_U32(v0 + 4);
+L40f210:
+//nop;
+if ((int)s0 >= 0) goto L40f220;
+v0 = zero;
+goto L40fbe4;
+L40f220:
+at = 0x1;
+if (s0 != 0) goto L40f344;
+v0 = 0x10003d88;
+v0 = MEM_U32(v0 + 0);
+//nop;
+if (v0 == 0) goto L40f258;
+if (v0 == at) {
+at = 0x2;
+goto L40f288;}
+at = 0x2;
+if (v0 == at) {
+at = 0x3;
+goto L40f288;}
+at = 0x3;
+if (v0 == at) {
+t1 = MEM_U32(s5 + 0);
+goto L40f328;}
+//nop;
+goto L40f344;
+L40f258:
+//nop;
+a0 = 0x10002838;
+a1 = 0x10002844;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_gettxt(mem, a0, a1);
+// bdead c0f001cb gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+//nop;
+f_yyerror(mem, sp, a0, a1, a2, a3);
+// bdead c0f00003 gp = MEM_U32(sp + 52);
+L40f288:
+a0 = 0x10002ec0;
+at = 0x10003d88;
+t0 = 0x3;
+a0 = MEM_U32(a0 + 0);
+MEM_U32(at + 0) = t0;
+a1 = 0x100;
+//nop;
+if (s3 < a0) goto L40f31c;
+v1 = 0x1000347c;
+L40f2b0:
+t1 = MEM_U32(s3 + 0);
+t2 = t1 << 2;
+t3 = v1 + t2;
+s0 = MEM_U32(t3 + 0);
+s0 = s0 + 0x100;
+at = (int)s0 < (int)0x154;
+if ((int)s0 < 0) goto L40f30c;
+if ((int)s0 >= (int)0x154) {
+s3 = s3 + 0xfffffffc;
+goto L40f310;}
+t5 = 0x10002f2c;
+t4 = s0 << 2;
+t8 = 0x10003664;
+t6 = t4 + t5;
+v0 = MEM_U32(t6 + 0);
+t7 = v0 << 2;
+t9 = t7 + t8;
+t0 = MEM_U32(t9 + 0);
+s1 = v0;
+if (a1 != t0) goto L40f30c;
+a3 = 0x10003d7c;
+a2 = 0x10003d74;
+a1 = 0x10002ec4;
+goto L40ee38;
+L40f30c:
+s3 = s3 + 0xfffffffc;
+L40f310:
+s6 = s6 + 0xfffffff8;
+if (s3 >= a0) goto L40f2b0;
+L40f31c:
+v0 = 0x1;
+goto L40fbe4;
+// fdead 0 t1 = MEM_U32(s5 + 0);
+L40f328:
+if (t1 != zero) {
+MEM_U32(s5 + 0) = s4;
+goto L40f33c;}
+v0 = 0x1;
+goto L40fbe4;
+// fdead 0 MEM_U32(s5 + 0) = s4;
+L40f33c:
+v0 = MEM_U32(s7 + 0);
+goto L40f068;
+L40f344:
+at = 0x10003d80;
+t2 = 0x100035ec;
+a0 = s0 << 2;
+MEM_U32(at + 0) = s0;
+t3 = a0 + t2;
+v1 = MEM_U32(t3 + 0);
+fp = s6;
+t4 = v1 & 0x1;
+if (t4 != zero) {
+v1 = (int)v1 >> 1;
+goto L40f420;}
+v1 = (int)v1 >> 1;
+t5 = v1 << 3;
+s6 = s6 - t5;
+t8 = MEM_U32(s6 + 8);
+t6 = 0x10003d98;
+t9 = 0x10003574;
+t3 = 0x10003564;
+MEM_U32(t6 + 0) = t8;
+t7 = MEM_U32(s6 + 12);
+t0 = a0 + t9;
+t1 = v1 << 2;
+MEM_U32(t6 + 4) = t7;
+v0 = MEM_U32(t0 + 0);
+s3 = s3 - t1;
+t5 = MEM_U32(s3 + 0);
+t2 = v0 << 2;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+s1 = t5 + a1;
+s1 = s1 + 0x1;
+//nop;
+if ((int)s1 >= (int)0x154) goto L40f3f4;
+t7 = 0x10002f2c;
+t6 = s1 << 2;
+t1 = 0x10003664;
+t8 = t6 + t7;
+s1 = MEM_U32(t8 + 0);
+t9 = -v0;
+t0 = s1 << 2;
+t2 = t0 + t1;
+t3 = MEM_U32(t2 + 0);
+//nop;
+if (t9 == t3) goto L40f404;
+L40f3f4:
+t5 = 0x10002f2c;
+t4 = a1 << 2;
+t6 = t4 + t5;
+s1 = MEM_U32(t6 + 0);
+L40f404:
+a0 = 0x10002ec0;
+a3 = 0x10003d7c;
+a2 = 0x10003d74;
+a1 = 0x10002ec4;
+a0 = MEM_U32(a0 + 0);
+goto L40ee38;
+// fdead 0 v1 = (int)v1 >> 1;
+L40f420:
+t7 = v1 << 3;
+s6 = s6 - t7;
+t1 = MEM_U32(s6 + 8);
+t8 = 0x10003d98;
+t2 = 0x10003574;
+t5 = 0x10003564;
+MEM_U32(t8 + 0) = t1;
+t0 = MEM_U32(s6 + 12);
+t9 = a0 + t2;
+t3 = v1 << 2;
+MEM_U32(t8 + 4) = t0;
+v0 = MEM_U32(t9 + 0);
+s3 = s3 - t3;
+t7 = MEM_U32(s3 + 0);
+t4 = v0 << 2;
+t6 = t4 + t5;
+a1 = MEM_U32(t6 + 0);
+s1 = t7 + a1;
+s1 = s1 + 0x1;
+//nop;
+if ((int)s1 >= (int)0x154) goto L40f4a4;
+t0 = 0x10002f2c;
+t8 = s1 << 2;
+t3 = 0x10003664;
+t1 = t8 + t0;
+s1 = MEM_U32(t1 + 0);
+t2 = -v0;
+t9 = s1 << 2;
+t4 = t9 + t3;
+t5 = MEM_U32(t4 + 0);
+//nop;
+if (t2 == t5) goto L40f4b4;
+L40f4a4:
+t7 = 0x10002f2c;
+t6 = a1 << 2;
+t8 = t6 + t7;
+s1 = MEM_U32(t8 + 0);
+L40f4b4:
+at = 0x10003d7c;
+t0 = 0x10003d80;
+MEM_U32(at + 0) = s1;
+at = 0x10003d78;
+t0 = MEM_U32(t0 + 0);
+MEM_U32(at + 0) = s3;
+at = 0x10003d74;
+t1 = t0 + 0xffffffff;
+MEM_U32(at + 0) = s6;
+//nop;
+if (t1 >= 0x1d) goto L40fbc8;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40f500;
+case 1: goto L40fbc8;
+case 2: goto L40f510;
+case 3: goto L40f528;
+case 4: goto L40f548;
+case 5: goto L40f564;
+case 6: goto L40f584;
+case 7: goto L40f59c;
+case 8: goto L40f60c;
+case 9: goto L40f6d0;
+case 10: goto L40f794;
+case 11: goto L40f7cc;
+case 12: goto L40f804;
+case 13: goto L40f850;
+case 14: goto L40f89c;
+case 15: goto L40f8c0;
+case 16: goto L40f8e4;
+case 17: goto L40f93c;
+case 18: goto L40f994;
+case 19: goto L40f9e4;
+case 20: goto L40fa34;
+case 21: goto L40fa6c;
+case 22: goto L40faa4;
+case 23: goto L40fadc;
+case 24: goto L40fb08;
+case 25: goto L40fb34;
+case 26: goto L40fb80;
+case 27: goto L40fb9c;
+case 28: goto L40fbb8;
+}
+L40f500:
+t9 = MEM_U32(fp + 0);
+at = 0x10003d6c;
+MEM_U32(at + 0) = t9;
+goto L40fbc8;
+L40f510:
+t3 = 0x10003d98;
+t2 = MEM_U32(fp + 0);
+MEM_U32(t3 + 0) = t2;
+t4 = MEM_U32(fp + 4);
+MEM_U32(t3 + 4) = t4;
+goto L40fbc8;
+L40f528:
+t5 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t6 = -t5;
+MEM_U32(at + 0) = t6;
+t7 = MEM_U32(fp + 4);
+at = 0x10003d98;
+MEM_U32(at + 4) = t7;
+goto L40fbc8;
+L40f548:
+v0 = MEM_U32(fp + 0);
+at = 0x10003d98;
+v0 = v0 < 0x1;
+MEM_U32(at + 0) = v0;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+goto L40fbc8;
+L40f564:
+t8 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t0 = ~t8;
+MEM_U32(at + 0) = t0;
+t1 = MEM_U32(fp + 4);
+at = 0x10003d98;
+MEM_U32(at + 4) = t1;
+goto L40fbc8;
+L40f584:
+t9 = 0x10003d98;
+t4 = MEM_U32(fp + -8);
+MEM_U32(t9 + 0) = t4;
+t3 = MEM_U32(fp + -4);
+MEM_U32(t9 + 4) = t3;
+goto L40fbc8;
+L40f59c:
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40f5b4;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40f5b4:
+at = 0x10003d98;
+t2 = 0x10003d98;
+MEM_U32(at + 4) = v0;
+t2 = MEM_U32(t2 + 4);
+if (t2 == zero) {
+t8 = MEM_U32(fp + 0);
+goto L40f5f0;}
+t5 = MEM_U32(fp + 0);
+t6 = MEM_U32(fp + -16);
+at = 0x10003d98;
+lo = t5 * t6; hi = (uint32_t)((uint64_t)t5 * (uint64_t)t6 >> 32);
+t7 = lo;
+MEM_U32(at + 0) = t7;
+//nop;
+goto L40fbc8;
+// fdead 0 t8 = MEM_U32(fp + 0);
+L40f5f0:
+t0 = MEM_U32(fp + -16);
+at = 0x10003d98;
+lo = t8 * t0; hi = (uint32_t)((uint64_t)t8 * (uint64_t)t0 >> 32);
+t1 = lo;
+MEM_U32(at + 0) = t1;
+//nop;
+goto L40fbc8;
+L40f60c:
+t9 = MEM_U32(fp + 0);
+if (t9 != zero) {
+v0 = MEM_U32(fp + -12);
+goto L40f638;}
+//nop;
+a0 = 0x10002854;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0600003 gp = MEM_U32(sp + 52);
+t3 = 0x1;
+MEM_U32(fp + 0) = t3;
+v0 = MEM_U32(fp + -12);
+L40f638:
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40f64c;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40f64c:
+at = 0x10003d98;
+t4 = 0x10003d98;
+MEM_U32(at + 4) = v0;
+t4 = MEM_U32(t4 + 4);
+if (t4 == zero) {
+t7 = MEM_U32(fp + -16);
+goto L40f694;}
+t2 = MEM_U32(fp + -16);
+t5 = MEM_U32(fp + 0);
+at = 0x10003d98;
+lo = t2 / t5; hi = t2 % t5;
+t6 = lo;
+MEM_U32(at + 0) = t6;
+//nop;
+if (t5 != 0) goto L40f688;
+abort();
+L40f688:
+//nop;
+goto L40fbc8;
+// fdead 0 t7 = MEM_U32(fp + -16);
+L40f694:
+t8 = MEM_U32(fp + 0);
+lo = (int)t7 / (int)t8; hi = (int)t7 % (int)t8;
+//nop;
+if (t8 != 0) goto L40f6a8;
+abort();
+L40f6a8:
+at = 0xffffffff;
+if (t8 != at) {
+at = 0x80000000;
+goto L40f6c0;}
+at = 0x80000000;
+//nop;
+if (t7 != at) goto L40f6c0;
+abort();
+L40f6c0:
+at = 0x10003d98;
+t0 = lo;
+MEM_U32(at + 0) = t0;
+goto L40fbc8;
+L40f6d0:
+t1 = MEM_U32(fp + 0);
+if (t1 != zero) {
+v0 = MEM_U32(fp + -12);
+goto L40f6fc;}
+//nop;
+a0 = 0x1000286c;
+a0 = a0;
+temp64 = f_error(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead c0600003 gp = MEM_U32(sp + 52);
+t9 = 0x1;
+MEM_U32(fp + 0) = t9;
+v0 = MEM_U32(fp + -12);
+L40f6fc:
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40f710;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40f710:
+at = 0x10003d98;
+t3 = 0x10003d98;
+MEM_U32(at + 4) = v0;
+t3 = MEM_U32(t3 + 4);
+if (t3 == zero) {
+t6 = MEM_U32(fp + -16);
+goto L40f758;}
+t4 = MEM_U32(fp + -16);
+t2 = MEM_U32(fp + 0);
+at = 0x10003d98;
+lo = t4 / t2; hi = t4 % t2;
+t5 = hi;
+MEM_U32(at + 0) = t5;
+//nop;
+if (t2 != 0) goto L40f74c;
+abort();
+L40f74c:
+//nop;
+goto L40fbc8;
+// fdead 0 t6 = MEM_U32(fp + -16);
+L40f758:
+t7 = MEM_U32(fp + 0);
+lo = (int)t6 / (int)t7; hi = (int)t6 % (int)t7;
+//nop;
+if (t7 != 0) goto L40f76c;
+abort();
+L40f76c:
+at = 0xffffffff;
+if (t7 != at) {
+at = 0x80000000;
+goto L40f784;}
+at = 0x80000000;
+//nop;
+if (t6 != at) goto L40f784;
+abort();
+L40f784:
+at = 0x10003d98;
+t8 = hi;
+MEM_U32(at + 0) = t8;
+goto L40fbc8;
+L40f794:
+t0 = MEM_U32(fp + 0);
+t1 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t9 = t0 + t1;
+MEM_U32(at + 0) = t9;
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40f7c0;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40f7c0:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40f7cc:
+t3 = MEM_U32(fp + -16);
+t4 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t2 = t3 - t4;
+MEM_U32(at + 0) = t2;
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40f7f8;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40f7f8:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40f804:
+t5 = MEM_U32(fp + -12);
+at = 0x10003d98;
+t6 = 0x10003d98;
+MEM_U32(at + 4) = t5;
+t6 = MEM_U32(t6 + 4);
+if (t6 == zero) {
+t1 = MEM_U32(fp + -16);
+goto L40f83c;}
+t7 = MEM_U32(fp + -16);
+t8 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t0 = t7 << (t8 & 0x1f);
+MEM_U32(at + 0) = t0;
+goto L40fbc8;
+// fdead 0 t1 = MEM_U32(fp + -16);
+L40f83c:
+t9 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t3 = t1 << (t9 & 0x1f);
+MEM_U32(at + 0) = t3;
+goto L40fbc8;
+L40f850:
+t4 = MEM_U32(fp + -12);
+at = 0x10003d98;
+t2 = 0x10003d98;
+MEM_U32(at + 4) = t4;
+t2 = MEM_U32(t2 + 4);
+if (t2 == zero) {
+t8 = MEM_U32(fp + -16);
+goto L40f888;}
+t5 = MEM_U32(fp + -16);
+t6 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t7 = t5 >> (t6 & 0x1f);
+MEM_U32(at + 0) = t7;
+goto L40fbc8;
+// fdead 0 t8 = MEM_U32(fp + -16);
+L40f888:
+t0 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t1 = (int)t8 >> (t0 & 0x1f);
+MEM_U32(at + 0) = t1;
+goto L40fbc8;
+L40f89c:
+t9 = MEM_U32(fp + -16);
+t3 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t4 = t9 ^ t3;
+t4 = t4 < 0x1;
+MEM_U32(at + 0) = t4;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+goto L40fbc8;
+L40f8c0:
+t2 = MEM_U32(fp + -16);
+t5 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t6 = t2 ^ t5;
+t6 = zero < t6;
+MEM_U32(at + 0) = t6;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+goto L40fbc8;
+L40f8e4:
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+t7 = MEM_U32(fp + -12);
+if (t7 != zero) {
+t0 = MEM_U32(fp + 0);
+goto L40f908;}
+t8 = MEM_U32(fp + 4);
+if (t8 == zero) {
+t3 = MEM_U32(fp + 0);
+goto L40f924;}
+t0 = MEM_U32(fp + 0);
+L40f908:
+t1 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t9 = t0 < t1;
+t9 = t9 ^ 0x1;
+MEM_U32(at + 0) = t9;
+goto L40fbc8;
+// fdead 0 t3 = MEM_U32(fp + 0);
+L40f924:
+t4 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t2 = (int)t3 < (int)t4;
+t2 = t2 ^ 0x1;
+MEM_U32(at + 0) = t2;
+goto L40fbc8;
+L40f93c:
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+t5 = MEM_U32(fp + -12);
+if (t5 != zero) {
+t7 = MEM_U32(fp + -16);
+goto L40f960;}
+t6 = MEM_U32(fp + 4);
+if (t6 == zero) {
+t1 = MEM_U32(fp + -16);
+goto L40f97c;}
+t7 = MEM_U32(fp + -16);
+L40f960:
+t8 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t0 = t7 < t8;
+t0 = t0 ^ 0x1;
+MEM_U32(at + 0) = t0;
+goto L40fbc8;
+// fdead 0 t1 = MEM_U32(fp + -16);
+L40f97c:
+t9 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t3 = (int)t1 < (int)t9;
+t3 = t3 ^ 0x1;
+MEM_U32(at + 0) = t3;
+goto L40fbc8;
+L40f994:
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+t4 = MEM_U32(fp + -12);
+if (t4 != zero) {
+t5 = MEM_U32(fp + -16);
+goto L40f9b8;}
+t2 = MEM_U32(fp + 4);
+if (t2 == zero) {
+t8 = MEM_U32(fp + -16);
+goto L40f9d0;}
+t5 = MEM_U32(fp + -16);
+L40f9b8:
+t6 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t7 = t5 < t6;
+MEM_U32(at + 0) = t7;
+goto L40fbc8;
+// fdead 0 t8 = MEM_U32(fp + -16);
+L40f9d0:
+t0 = MEM_U32(fp + 0);
+at = 0x10003d98;
+t1 = (int)t8 < (int)t0;
+MEM_U32(at + 0) = t1;
+goto L40fbc8;
+L40f9e4:
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+t9 = MEM_U32(fp + -12);
+if (t9 != zero) {
+t4 = MEM_U32(fp + 0);
+goto L40fa08;}
+t3 = MEM_U32(fp + 4);
+if (t3 == zero) {
+t6 = MEM_U32(fp + 0);
+goto L40fa20;}
+t4 = MEM_U32(fp + 0);
+L40fa08:
+t2 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t5 = t4 < t2;
+MEM_U32(at + 0) = t5;
+goto L40fbc8;
+// fdead 0 t6 = MEM_U32(fp + 0);
+L40fa20:
+t7 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t8 = (int)t6 < (int)t7;
+MEM_U32(at + 0) = t8;
+goto L40fbc8;
+L40fa34:
+t0 = MEM_U32(fp + 0);
+t1 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t9 = t0 & t1;
+MEM_U32(at + 0) = t9;
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40fa60;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40fa60:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40fa6c:
+t3 = MEM_U32(fp + 0);
+t4 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t2 = t3 ^ t4;
+MEM_U32(at + 0) = t2;
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40fa98;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40fa98:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40faa4:
+t5 = MEM_U32(fp + 0);
+t6 = MEM_U32(fp + -16);
+at = 0x10003d98;
+t7 = t5 | t6;
+MEM_U32(at + 0) = t7;
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40fad0;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40fad0:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40fadc:
+v0 = MEM_U32(fp + -16);
+v0 = zero < v0;
+//nop;
+if (v0 == 0) goto L40faf4;
+v0 = MEM_U32(fp + 0);
+v0 = zero < v0;
+L40faf4:
+at = 0x10003d98;
+MEM_U32(at + 0) = v0;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+goto L40fbc8;
+L40fb08:
+v0 = MEM_U32(fp + -16);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40fb20;
+v0 = MEM_U32(fp + 0);
+v0 = zero < v0;
+L40fb20:
+at = 0x10003d98;
+MEM_U32(at + 0) = v0;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+goto L40fbc8;
+L40fb34:
+t8 = MEM_U32(fp + -32);
+if (t8 == zero) {
+t1 = MEM_U32(fp + 0);
+goto L40fb54;}
+t0 = MEM_U32(fp + -16);
+at = 0x10003d98;
+MEM_U32(at + 0) = t0;
+goto L40fb5c;
+// fdead 0 t1 = MEM_U32(fp + 0);
+L40fb54:
+at = 0x10003d98;
+MEM_U32(at + 0) = t1;
+L40fb5c:
+v0 = MEM_U32(fp + -12);
+v0 = zero < v0;
+//nop;
+if (v0 != 0) goto L40fb74;
+v0 = MEM_U32(fp + 4);
+v0 = zero < v0;
+L40fb74:
+at = 0x10003d98;
+MEM_U32(at + 4) = v0;
+goto L40fbc8;
+L40fb80:
+t3 = 0x10003d90;
+t9 = 0x10003d98;
+t2 = MEM_U32(t3 + 0);
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t9 + 0) = t2;
+MEM_U32(t9 + 4) = t4;
+goto L40fbc8;
+L40fb9c:
+t6 = 0x10003d90;
+t5 = 0x10003d98;
+t8 = MEM_U32(t6 + 0);
+t7 = MEM_U32(t6 + 4);
+MEM_U32(t5 + 0) = t8;
+MEM_U32(t5 + 4) = t7;
+goto L40fbc8;
+L40fbb8:
+at = 0x10003d98;
+MEM_U32(at + 0) = zero;
+at = 0x10003d98;
+MEM_U32(at + 4) = zero;
+L40fbc8:
+a0 = 0x10002ec0;
+a3 = 0x10003d7c;
+a2 = 0x10003d74;
+a1 = 0x10002ec4;
+v0 = 0x10003d78;
+a0 = MEM_U32(a0 + 0);
+goto L40ee2c;
+L40fbe4:
+// bdead 9 ra = MEM_U32(sp + 60);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x70;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static void f_MDnewstab(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40fc20:
+//MDnewstab:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a0 = 0x40000;
+v0 = wrapper_malloc(mem, a0);
+t6 = MEM_U32(sp + 32);
+// bdead 40008009 gp = MEM_U32(sp + 24);
+at = 0x40000;
+MEM_U32(t6 + 32) = v0;
+t7 = MEM_U32(sp + 32);
+t8 = MEM_U32(t7 + 32);
+MEM_U32(t7 + 36) = t8;
+t9 = MEM_U32(sp + 32);
+t0 = MEM_U32(t9 + 32);
+t1 = t0 + at;
+MEM_U32(t9 + 40) = t1;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_MDstrcpy(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L40fc84:
+//MDstrcpy:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 44) = a1;
+t6 = MEM_U32(sp + 44);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+if (t6 != 0) goto L40fcb4;
+v0 = zero;
+goto L40fd68;
+L40fcb4:
+t7 = MEM_U32(sp + 40);
+t8 = MEM_U32(t7 + 40);
+t9 = MEM_U32(t7 + 36);
+t0 = t8 - t9;
+MEM_U32(sp + 32) = t0;
+if ((int)t0 >= (int)0x100) goto L40fcf8;
+//nop;
+a0 = t7;
+//nop;
+f_MDnewstab(mem, sp, a0);
+t1 = MEM_U32(sp + 40);
+// bdead 40000403 gp = MEM_U32(sp + 24);
+t2 = MEM_U32(t1 + 40);
+t3 = MEM_U32(t1 + 36);
+t4 = t2 - t3;
+MEM_U32(sp + 32) = t4;
+L40fcf8:
+t5 = MEM_U32(sp + 40);
+//nop;
+a1 = MEM_U32(sp + 44);
+t6 = MEM_U32(t5 + 36);
+a2 = zero;
+a3 = MEM_U32(sp + 32);
+MEM_U32(sp + 36) = t6;
+a0 = MEM_U32(t5 + 36);
+v0 = wrapper_memccpy(mem, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 40);
+// bdead 60042000189 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 36) = v0;
+t9 = MEM_U32(sp + 40);
+t0 = MEM_U32(t9 + 36);
+//nop;
+if (t0 != 0) goto L40fd64;
+a1 = MEM_U32(t9 + 4);
+t9 = MEM_U32(t9 + 12);
+a0 = 0x10002b00;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40fd64:
+v0 = MEM_U32(sp + 36);
+L40fd68:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t func_40fd78(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40fd78:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 52) = a1;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a0 = MEM_U32(sp + 52);
+v0 = wrapper_strlen(mem, a0);
+MEM_U32(sp + 44) = v0;
+t7 = MEM_U32(sp + 44);
+t6 = MEM_U32(sp + 52);
+// bdead 40018003 gp = MEM_U32(sp + 24);
+at = (int)t7 < (int)0x3;
+t8 = t6 + t7;
+t9 = t8 + 0xfffffffe;
+MEM_U32(sp + 40) = t9;
+if (at != 0) goto L40fe04;
+t0 = MEM_S8(t8 + -2);
+at = 0x2e;
+//nop;
+if (t0 != at) goto L40fe04;
+t1 = MEM_S8(t8 + -1);
+at = 0x68;
+if (t1 == at) {
+at = 0x61;
+goto L40fdf8;}
+at = 0x61;
+if (t1 == at) {
+at = 0x6f;
+goto L40fdf8;}
+at = 0x6f;
+//nop;
+if (t1 != at) goto L40fe04;
+L40fdf8:
+t2 = MEM_U32(sp + 40);
+MEM_U8(t2 + 0) = (uint8_t)zero;
+goto L40fe08;
+L40fe04:
+MEM_U32(sp + 40) = zero;
+L40fe08:
+t3 = MEM_U32(sp + 52);
+MEM_U32(sp + 36) = zero;
+t4 = MEM_S8(t3 + 0);
+MEM_U32(sp + 32) = t4;
+if (t4 == 0) goto L40fe4c;
+L40fe1c:
+t5 = MEM_U32(sp + 36);
+t9 = MEM_U32(sp + 32);
+t8 = MEM_U32(sp + 52);
+t6 = t5 << 1;
+t7 = t6 ^ t9;
+t0 = t5 + t7;
+t1 = t8 + 0x1;
+MEM_U32(sp + 52) = t1;
+MEM_U32(sp + 36) = t0;
+t2 = MEM_S8(t1 + 0);
+MEM_U32(sp + 32) = t2;
+if (t2 != 0) goto L40fe1c;
+L40fe4c:
+t3 = MEM_U32(sp + 40);
+//nop;
+if (t3 == 0) goto L40fe60;
+t4 = 0x2e;
+MEM_U8(t3 + 0) = (uint8_t)t4;
+L40fe60:
+t9 = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 36);
+// bdead 4008001 ra = MEM_U32(sp + 28);
+t5 = MEM_U32(t9 + 24);
+t8 = MEM_U32(t9 + 28);
+// bdead 200c001 sp = sp + 0x30;
+t7 = t6 & t5;
+t0 = t7 << 3;
+v0 = t8 + t0;
+return v0;
+}
+
+static uint32_t func_40fe88(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40fe88:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+// fdead 4000006b t9 = t9;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 40);
+v0 = func_40fd78(mem, sp, a0, a1);
+MEM_U32(sp + 36) = v0;
+t6 = MEM_U32(sp + 36);
+// bdead 40008001 gp = MEM_U32(sp + 24);
+t7 = MEM_U32(t6 + 0);
+//nop;
+if (t7 == 0) goto L40ff6c;
+L40fed4:
+//nop;
+t8 = MEM_U32(sp + 36);
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(t8 + 0);
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40ff6c;
+t9 = MEM_U32(sp + 36);
+t0 = MEM_U32(t9 + 4);
+//nop;
+if (t0 != 0) goto L40ff54;
+MEM_U32(sp + 32) = t9;
+L40ff04:
+t1 = MEM_U32(sp + 36);
+t3 = MEM_U32(sp + 40);
+t2 = t1 + 0x8;
+MEM_U32(sp + 36) = t2;
+t5 = MEM_U32(t3 + 24);
+t4 = MEM_U32(t3 + 28);
+t6 = t5 << 3;
+t7 = t4 + t6;
+//nop;
+if (t7 >= t2) goto L40ff34;
+MEM_U32(sp + 36) = t4;
+L40ff34:
+t8 = MEM_U32(sp + 36);
+t0 = MEM_U32(t8 + 0);
+//nop;
+if (t0 != 0) goto L40ff04;
+t9 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 32);
+MEM_U32(t1 + 4) = t9;
+goto L40ff6c;
+L40ff54:
+t3 = MEM_U32(sp + 36);
+t5 = MEM_U32(t3 + 4);
+MEM_U32(sp + 36) = t5;
+t6 = MEM_U32(t5 + 0);
+//nop;
+if (t6 != 0) goto L40fed4;
+L40ff6c:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_40ff80(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0,
+fp_dest;
+uint64_t temp64;
+L40ff80:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+MEM_U32(sp + 56) = a0;
+t6 = MEM_U32(sp + 56);
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+t7 = MEM_U32(t6 + 24);
+a1 = 0x8;
+t8 = t7 + 0x1;
+t9 = t8 << 1;
+MEM_U32(sp + 48) = t9;
+a0 = t9;
+//nop;
+MEM_U32(sp + 52) = t8;
+//nop;
+v0 = wrapper_calloc(mem, a0, a1);
+MEM_U32(sp + 44) = v0;
+t0 = MEM_U32(sp + 44);
+// bdead 60040000381 gp = MEM_U32(sp + 24);
+//nop;
+if (t0 != 0) goto L410010;
+t1 = MEM_U32(sp + 56);
+a0 = 0x10002b24;
+t9 = MEM_U32(t1 + 12);
+a1 = MEM_U32(t1 + 4);
+a0 = a0;
+fp_dest = t9;
+//nop;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L410010:
+t2 = MEM_U32(sp + 52);
+t5 = MEM_U32(sp + 56);
+t3 = (int)t2 >> 2;
+if ((int)t2 >= 0) goto L410028;
+at = t2 + 0x3;
+t3 = (int)at >> 2;
+L410028:
+t6 = MEM_U32(t5 + 20);
+t4 = t2 - t3;
+t7 = t6 + t4;
+MEM_U32(t5 + 20) = t7;
+t8 = MEM_U32(sp + 48);
+t1 = MEM_U32(sp + 56);
+t0 = t8 + 0xffffffff;
+MEM_U32(t1 + 24) = t0;
+t9 = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 44);
+t2 = MEM_U32(t9 + 28);
+MEM_U32(sp + 40) = t2;
+MEM_U32(t9 + 28) = t3;
+t4 = MEM_U32(sp + 52);
+t6 = MEM_U32(sp + 40);
+t7 = t4 + 0xffffffff;
+MEM_U32(sp + 52) = t7;
+MEM_U32(sp + 36) = t6;
+if ((int)t7 < 0) goto L4100d0;
+L410074:
+t5 = MEM_U32(sp + 36);
+t8 = MEM_U32(t5 + 0);
+//nop;
+if (t8 == 0) goto L4100b4;
+//nop;
+t0 = MEM_U32(sp + 36);
+a0 = MEM_U32(sp + 56);
+// bdead 40000221 t9 = t9;
+a1 = MEM_U32(t0 + 0);
+v0 = func_40fe88(mem, sp, a0, a1);
+t1 = MEM_U32(sp + 36);
+MEM_U32(sp + 32) = v0;
+t3 = MEM_U32(sp + 32);
+t2 = MEM_U32(t1 + 0);
+// bdead 40001801 gp = MEM_U32(sp + 24);
+MEM_U32(t3 + 0) = t2;
+L4100b4:
+t9 = MEM_U32(sp + 36);
+t4 = MEM_U32(sp + 52);
+t6 = t9 + 0x8;
+t7 = t4 + 0xffffffff;
+MEM_U32(sp + 52) = t7;
+MEM_U32(sp + 36) = t6;
+if ((int)t7 >= 0) goto L410074;
+L4100d0:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static uint32_t f_MDopen(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0, fp_dest;
+uint64_t temp64;
+L4100f4:
+//MDopen:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a0 = 0x2c;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+a0 = MEM_U32(sp + 36);
+//nop;
+//nop;
+f_MDnewstab(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = 0x100;
+a1 = 0x8;
+//nop;
+//nop;
+v0 = wrapper_calloc(mem, a0, a1);
+t6 = MEM_U32(sp + 36);
+// bdead 6004000818b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+if (t6 == 0) goto L410178;
+t7 = MEM_U32(sp + 32);
+//nop;
+if (t7 != 0) goto L4101d8;
+L410178:
+t9 = MEM_U32(sp + 52);
+a0 = 0x10002b4c;
+a1 = MEM_U32(sp + 44);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U32(sp + 36);
+// bdead 42000003 gp = MEM_U32(sp + 24);
+//nop;
+if (t8 == 0) goto L4101b0;
+//nop;
+a0 = t8;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L4101b0:
+t0 = MEM_U32(sp + 32);
+//nop;
+if (t0 == 0) goto L4101d0;
+//nop;
+a0 = t0;
+//nop;
+wrapper_free(mem, a0);
+// bdead 3 gp = MEM_U32(sp + 24);
+L4101d0:
+v0 = zero;
+goto L410274;
+L4101d8:
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = MEM_U32(sp + 40);
+//nop;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+t1 = MEM_U32(sp + 36);
+// bdead 4000040b gp = MEM_U32(sp + 24);
+MEM_U32(t1 + 0) = v0;
+//nop;
+a1 = MEM_U32(sp + 44);
+a0 = MEM_U32(sp + 36);
+//nop;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+t2 = MEM_U32(sp + 36);
+// bdead 4000080b gp = MEM_U32(sp + 24);
+MEM_U32(t2 + 4) = v0;
+//nop;
+a1 = MEM_U32(sp + 48);
+a0 = MEM_U32(sp + 36);
+//nop;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+t3 = MEM_U32(sp + 36);
+// bdead 4000100b gp = MEM_U32(sp + 24);
+t7 = 0xc0;
+MEM_U32(t3 + 8) = v0;
+t5 = MEM_U32(sp + 36);
+t4 = MEM_U32(sp + 52);
+t8 = 0xff;
+MEM_U32(t5 + 12) = t4;
+t6 = MEM_U32(sp + 36);
+MEM_U32(t6 + 16) = zero;
+t9 = MEM_U32(sp + 36);
+MEM_U32(t9 + 20) = t7;
+t0 = MEM_U32(sp + 36);
+MEM_U32(t0 + 24) = t8;
+t2 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 32);
+MEM_U32(t2 + 28) = t1;
+v0 = MEM_U32(sp + 36);
+L410274:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_MDupdate(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L410284:
+//MDupdate:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+MEM_U32(sp + 40) = a0;
+t6 = MEM_U32(sp + 40);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+if (t6 == 0) goto L410364;
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+// fdead 4000806b t9 = t9;
+//nop;
+v0 = func_40fe88(mem, sp, a0, a1);
+MEM_U32(sp + 36) = v0;
+t7 = MEM_U32(sp + 36);
+// bdead 40010001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(t7 + 0);
+//nop;
+if (t8 != 0) goto L410364;
+t9 = MEM_U32(sp + 40);
+t0 = MEM_U32(t9 + 20);
+//nop;
+if (t0 != 0) goto L410324;
+a0 = t9;
+//nop;
+// bdead 40000021 t9 = t9;
+//nop;
+func_40ff80(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+// fdead 60000063 t9 = t9;
+//nop;
+v0 = func_40fe88(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+L410324:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_MDstrcpy(mem, sp, a0, a1);
+t1 = MEM_U32(sp + 36);
+// bdead 40000409 gp = MEM_U32(sp + 24);
+MEM_U32(t1 + 0) = v0;
+t2 = MEM_U32(sp + 40);
+t3 = MEM_U32(t2 + 20);
+t4 = t3 + 0xffffffff;
+MEM_U32(t2 + 20) = t4;
+t5 = MEM_U32(sp + 40);
+t6 = MEM_U32(t5 + 16);
+t7 = t6 + 0x1;
+MEM_U32(t5 + 16) = t7;
+L410364:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_MDclose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+fp_dest;
+uint64_t temp64;
+L410374:
+//MDclose:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffef0;
+MEM_U32(sp + 272) = a0;
+t6 = MEM_U32(sp + 272);
+// fdead 4000806b MEM_U32(sp + 36) = ra;
+// fdead 4000806b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 276) = a1;
+// fdead 4000806b MEM_U32(sp + 28) = s0;
+if (t6 == 0) goto L410afc;
+t7 = MEM_U32(sp + 272);
+t8 = MEM_U32(t7 + 16);
+//nop;
+if (t8 == 0) goto L410abc;
+t9 = MEM_U32(sp + 272);
+a1 = 0x102;
+a2 = 0x1b6;
+a0 = MEM_U32(t9 + 4);
+//nop;
+//nop;
+v0 = wrapper_open(mem, a0, a1, a2);
+MEM_U32(sp + 268) = v0;
+t1 = MEM_U32(sp + 268);
+t0 = 0x2;
+// bdead 40000703 gp = MEM_U32(sp + 32);
+MEM_U16(sp + 224) = (uint16_t)t0;
+MEM_U16(sp + 226) = (uint16_t)zero;
+MEM_U32(sp + 232) = zero;
+MEM_U32(sp + 228) = zero;
+if ((int)t1 < 0) goto L410428;
+//nop;
+a0 = t1;
+a1 = 0x7;
+a2 = sp + 0xe0;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fcntl(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+if ((int)v0 < 0) goto L410428;
+//nop;
+a0 = MEM_U32(sp + 268);
+a1 = sp + 0x58;
+//nop;
+v0 = wrapper_fstat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+if ((int)v0 >= 0) goto L4104c0;
+L410428:
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t2 = MEM_U32(sp + 272);
+// bdead 60040000909 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t2 + 12);
+a0 = 0x10002b70;
+a2 = s0;
+a1 = MEM_U32(t2 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t3 = MEM_U32(sp + 268);
+// bdead 40001001 gp = MEM_U32(sp + 32);
+//nop;
+if ((int)t3 < 0) goto L410afc;
+//nop;
+a0 = t3;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+if (v0 == 0) goto L410afc;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t4 = MEM_U32(sp + 272);
+// bdead 60000002109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t4 + 12);
+a0 = 0x10002b78;
+a2 = s0;
+a1 = MEM_U32(t4 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L410afc;
+L4104c0:
+t5 = MEM_U32(sp + 136);
+MEM_U32(sp + 84) = t5;
+if (t5 != 0) goto L4104d8;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = zero;
+goto L410588;
+L4104d8:
+//nop;
+t6 = MEM_U32(sp + 268);
+a0 = zero;
+a1 = MEM_U32(sp + 84);
+a2 = 0x3;
+a3 = 0x1;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 16) = t6;
+v0 = wrapper_mmap(mem, a0, a1, a2, a3, MEM_S32(sp + 16), MEM_S32(sp + 20));
+MEM_U32(sp + 80) = v0;
+t7 = MEM_U32(sp + 80);
+// bdead 40010003 gp = MEM_U32(sp + 32);
+//nop;
+if ((int)t7 >= 0) goto L410560;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t8 = MEM_U32(sp + 272);
+// bdead 60042000109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t8 + 12);
+a0 = 0x10002b80;
+a2 = s0;
+a1 = MEM_U32(t8 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 268);
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L410afc;
+L410560:
+t0 = MEM_U32(sp + 80);
+t1 = MEM_U32(sp + 84);
+t2 = t0 + t1;
+MEM_U32(sp + 76) = t2;
+if ((int)t1 <= 0) goto L410588;
+t3 = MEM_S8(t2 + -1);
+at = 0xa;
+//nop;
+if (t3 == at) goto L410588;
+MEM_U32(sp + 76) = t0;
+L410588:
+t4 = MEM_U32(sp + 276);
+//nop;
+if (t4 != 0) goto L4105a0;
+t5 = MEM_U32(sp + 272);
+t6 = MEM_U32(t5 + 8);
+MEM_U32(sp + 276) = t6;
+L4105a0:
+//nop;
+a0 = MEM_U32(sp + 276);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000010b gp = MEM_U32(sp + 32);
+t7 = MEM_U32(sp + 272);
+MEM_U32(sp + 264) = v0;
+//nop;
+a1 = 0x10002b88;
+a0 = sp + 0x34;
+a2 = MEM_U32(t7 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+MEM_U32(sp + 260) = v0;
+t8 = MEM_U32(sp + 260);
+// bdead 42000003 gp = MEM_U32(sp + 32);
+//nop;
+if ((int)t8 >= 0) goto L410620;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t9 = MEM_U32(sp + 272);
+// bdead 6004400010b gp = MEM_U32(sp + 32);
+s0 = v0;
+a1 = MEM_U32(t9 + 4);
+t9 = MEM_U32(t9 + 12);
+a0 = 0x10002b90;
+a2 = s0;
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000003 gp = MEM_U32(sp + 32);
+L410620:
+t1 = MEM_U32(sp + 80);
+t2 = MEM_U32(sp + 76);
+MEM_U32(sp + 72) = t1;
+//nop;
+if (t1 >= t2) goto L410808;
+L410638:
+//nop;
+a0 = MEM_U32(sp + 72);
+a1 = 0xa;
+//nop;
+v0 = wrapper_strchr(mem, a0, a1);
+MEM_U32(sp + 68) = v0;
+t3 = MEM_U32(sp + 68);
+// bdead 40001003 gp = MEM_U32(sp + 32);
+//nop;
+if (t3 != 0) goto L4106ac;
+t0 = MEM_U32(sp + 272);
+t4 = MEM_U32(sp + 72);
+t5 = MEM_U32(sp + 80);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10002b98;
+a2 = MEM_U32(t0 + 0);
+a3 = MEM_U32(t0 + 4);
+t6 = t4 - t5;
+MEM_U32(sp + 16) = t6;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+L4106ac:
+t7 = MEM_U32(sp + 68);
+a1 = 0x3a;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+t8 = MEM_U32(sp + 72);
+//nop;
+MEM_U32(sp + 64) = t8;
+a0 = t8;
+v0 = wrapper_strchr(mem, a0, a1);
+t1 = MEM_U32(sp + 68);
+// bdead 4000040b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 72) = v0;
+t9 = 0xa;
+MEM_U8(t1 + 0) = (uint8_t)t9;
+t2 = MEM_U32(sp + 68);
+t0 = MEM_U32(sp + 72);
+t3 = t2 + 0x1;
+MEM_U32(sp + 68) = t3;
+if (t0 == 0) goto L4107f0;
+t4 = MEM_U32(sp + 72);
+t6 = 0xfb4cba0;
+t5 = MEM_S8(t4 + -1);
+t7 = t5 + t6;
+t8 = MEM_U8(t7 + 1);
+t9 = t8 & 0x8;
+//nop;
+if (t9 == 0) goto L410740;
+L410714:
+t1 = MEM_U32(sp + 72);
+t4 = 0xfb4cba0;
+t2 = t1 + 0xffffffff;
+MEM_U32(sp + 72) = t2;
+t3 = MEM_U32(sp + 72);
+t0 = MEM_S8(t3 + -1);
+t5 = t0 + t4;
+t6 = MEM_U8(t5 + 1);
+t7 = t6 & 0x8;
+//nop;
+if (t7 != 0) goto L410714;
+L410740:
+t8 = MEM_U32(sp + 72);
+t9 = MEM_U32(sp + 64);
+t2 = MEM_U32(sp + 264);
+t1 = t8 - t9;
+//nop;
+if (t1 != t2) goto L4107f0;
+a0 = t9;
+//nop;
+a1 = MEM_U32(sp + 276);
+a2 = t2;
+//nop;
+v0 = wrapper_bcmp(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L4107f0;
+t3 = MEM_U32(sp + 68);
+t0 = MEM_U32(sp + 260);
+t6 = MEM_U32(sp + 72);
+t4 = t3 - t0;
+t5 = t4 + 0xffffffff;
+MEM_U32(sp + 60) = t5;
+if (t6 >= t5) goto L4107f0;
+//nop;
+a0 = t5;
+a1 = sp + 0x34;
+a2 = t0;
+v0 = wrapper_bcmp(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L4107f0;
+t7 = MEM_U32(sp + 68);
+//nop;
+t8 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 64);
+a0 = t7;
+a2 = t8 - t7;
+wrapper_bcopy(mem, a0, a1, a2);
+t1 = MEM_U32(sp + 68);
+t9 = MEM_U32(sp + 64);
+t3 = MEM_U32(sp + 76);
+// bdead 44001403 gp = MEM_U32(sp + 32);
+t2 = t1 - t9;
+t4 = t3 - t2;
+MEM_U32(sp + 76) = t4;
+MEM_U32(sp + 68) = t9;
+L4107f0:
+t6 = MEM_U32(sp + 68);
+t5 = MEM_U32(sp + 76);
+MEM_U32(sp + 72) = t6;
+//nop;
+if (t6 < t5) goto L410638;
+L410808:
+t0 = MEM_U32(sp + 76);
+t8 = MEM_U32(sp + 80);
+t1 = MEM_U32(sp + 136);
+t7 = t0 - t8;
+MEM_U32(sp + 84) = t7;
+if ((int)t7 >= (int)t1) goto L410878;
+//nop;
+a0 = MEM_U32(sp + 268);
+a1 = t7;
+//nop;
+v0 = wrapper_ftruncate(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+if (v0 == 0) goto L410878;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t3 = MEM_U32(sp + 272);
+// bdead 60040001109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t3 + 12);
+a0 = 0x10002bec;
+a2 = s0;
+a1 = MEM_U32(t3 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L410878:
+//nop;
+a1 = 0x10002bf4;
+a0 = MEM_U32(sp + 268);
+a1 = a1;
+v0 = wrapper_fdopen(mem, a0, a1);
+MEM_U32(sp + 48) = v0;
+t2 = MEM_U32(sp + 48);
+// bdead 60040000901 gp = MEM_U32(sp + 32);
+//nop;
+if (t2 != 0) goto L4108dc;
+t4 = MEM_U32(sp + 272);
+a0 = 0x10002bf8;
+a2 = MEM_U32(sp + 276);
+t9 = MEM_U32(t4 + 12);
+a1 = MEM_U32(t4 + 4);
+a0 = a0;
+fp_dest = t9;
+//nop;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 268);
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+goto L410a5c;
+L4108dc:
+//nop;
+a1 = 0x10002c24;
+a0 = MEM_U32(sp + 48);
+a2 = MEM_U32(sp + 276);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+if ((int)v0 >= 0) goto L410934;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t6 = MEM_U32(sp + 272);
+// bdead 60040008109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t6 + 12);
+a0 = 0x10002c28;
+a2 = s0;
+a1 = MEM_U32(t6 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000101 gp = MEM_U32(sp + 32);
+L410934:
+t5 = MEM_U32(sp + 272);
+t0 = MEM_U32(t5 + 28);
+MEM_U32(sp + 44) = t0;
+t1 = MEM_U32(t5 + 24);
+t8 = MEM_U32(t5 + 28);
+t7 = t1 << 3;
+t3 = t8 + t7;
+//nop;
+if (t3 < t0) goto L4109b4;
+L41095c:
+t2 = MEM_U32(sp + 44);
+t4 = MEM_U32(t2 + 0);
+//nop;
+if (t4 == 0) goto L410988;
+//nop;
+a1 = 0x10002c30;
+a0 = MEM_U32(sp + 48);
+a2 = t4;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+L410988:
+t6 = MEM_U32(sp + 44);
+t5 = MEM_U32(sp + 272);
+t9 = t6 + 0x8;
+MEM_U32(sp + 44) = t9;
+t8 = MEM_U32(t5 + 24);
+t1 = MEM_U32(t5 + 28);
+t7 = t8 << 3;
+t0 = t1 + t7;
+//nop;
+if (t0 >= t9) goto L41095c;
+L4109b4:
+//nop;
+a1 = 0x10002c34;
+a0 = MEM_U32(sp + 48);
+a2 = sp + 0x34;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+if ((int)v0 >= 0) goto L410a0c;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t3 = MEM_U32(sp + 272);
+// bdead 60040001109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t3 + 12);
+a0 = 0x10002c3c;
+a2 = s0;
+a1 = MEM_U32(t3 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L410a0c:
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+if (v0 == 0) goto L410a5c;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t2 = MEM_U32(sp + 272);
+// bdead 60040000909 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t2 + 12);
+a0 = 0x10002c44;
+a2 = s0;
+a1 = MEM_U32(t2 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L410a5c:
+t4 = MEM_U32(sp + 80);
+//nop;
+if (t4 == 0) goto L410abc;
+//nop;
+a0 = t4;
+a1 = MEM_U32(sp + 136);
+//nop;
+v0 = wrapper_munmap(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+if (v0 == 0) goto L410abc;
+//nop;
+a0 = 0xfb4ec80;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strerror(mem, a0);
+t6 = MEM_U32(sp + 272);
+// bdead 60040008109 gp = MEM_U32(sp + 32);
+s0 = v0;
+t9 = MEM_U32(t6 + 12);
+a0 = 0x10002c4c;
+a2 = s0;
+a1 = MEM_U32(t6 + 4);
+fp_dest = t9;
+a0 = a0;
+temp64 = trampoline(mem, sp, a0, a1, a2, a3, fp_dest);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000001 gp = MEM_U32(sp + 32);
+L410abc:
+//nop;
+t5 = MEM_U32(sp + 272);
+a0 = MEM_U32(t5 + 28);
+wrapper_free(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t8 = MEM_U32(sp + 272);
+//nop;
+a0 = MEM_U32(t8 + 32);
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 272);
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+L410afc:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x110;
+//nop;
+return;
+}
@@ -0,0 +1,26274 @@
+#include "header.h"
+static const uint32_t rodata[] = {
+0x62696e61,0x736d0000,0x6173303a,0x20000000,0x556e6b6e,0x6f776e20,0x6f707469,0x6f6e0000,
+0x45787472,0x61206669,0x6c656e61,0x6d65206f,0x6e20636f,0x6d6d616e,0x64206c69,0x6e650000,
+0x77000000,0x77000000,0x72000000,0x24617400,0x246b7430,0x0,0x246b7431,0x0,
+0x24677000,0x24737000,0x24667000,0xa000000,0xf03e8fa8,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e8fa8,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e8ee0,0xf03e8ed0,0xf03e8ed8,0xf03e8ee0,0xf03e8eec,0xf03e906c,
+0xf03e8fb0,0xf03e8f08,0xf03e8ef8,0xf03e8f00,0xf03e8f08,0xf03e8f10,0xf03e906c,0xf03e8f78,
+0xf03e8f3c,0xf03e8f18,0xf03e8f18,0xf03e8f24,0xf03e8f30,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e8ff0,0xf03e8ffc,0xf03e9008,0xf03e9014,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e8fc4,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e8fa8,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e8fa8,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e902c,0xf03e9020,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e8f8c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e8fa8,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,
+0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e906c,0xf03e8fd0,
+0x0,0x6f706572,0x616e6420,0x31000000,0x6f706572,0x616e6420,0x32000000,0x6f706572,
+0x616e6420,0x33000000,0x55736564,0x20246174,0x20776974,0x686f7574,0x202e7365,0x74206e6f,
+0x61740000,0x53686f75,0x6c642062,0x65206770,0x20726567,0x69737465,0x72000000,0x53686f75,
+0x6c642062,0x65206576,0x656e2067,0x70207265,0x67697374,0x65720000,0x53686f75,0x6c642062,
+0x65206770,0x20726567,0x69737465,0x72000000,0x55736564,0x20246174,0x20776974,0x686f7574,
+0x202e7365,0x74206e6f,0x61740000,0x53686f75,0x6c642062,0x6520636f,0x70726f63,0x6573736f,
+0x72207265,0x67697374,0x65720000,0x53686f75,0x6c642062,0x65206576,0x656e2063,0x6f70726f,
+0x63657373,0x6f722072,0x65676973,0x74657200,0x53686f75,0x6c642062,0x6520666c,0x6f617469,
+0x6e672070,0x6f696e74,0x20726567,0x69737465,0x72000000,0x53686f75,0x6c642062,0x6520666c,
+0x6f617469,0x6e672070,0x6f696e74,0x20726567,0x69737465,0x72000000,0x53686f75,0x6c642062,
+0x65206576,0x656e2066,0x6c6f6174,0x696e6720,0x706f696e,0x74207265,0x67697374,0x65720000,
+0x53686f75,0x6c642062,0x6520666c,0x6f617469,0x6e672070,0x6f696e74,0x20726567,0x69737465,
+0x72000000,0x53686f75,0x6c642062,0x65206576,0x656e2066,0x6c6f6174,0x696e6720,0x706f696e,
+0x74207265,0x67697374,0x65720000,0x53686f75,0x6c642062,0x65206d75,0x6c746970,0x6c652d6f,
+0x662d3420,0x666c6f61,0x74696e67,0x20706f69,0x6e742072,0x65676973,0x74657200,0x53686f75,
+0x6c642062,0x65206670,0x20646f75,0x626c6520,0x6f722067,0x70207369,0x6e676c65,0x20726567,
+0x69737465,0x72000000,0x53686f75,0x6c642062,0x65206d75,0x6c746970,0x6c652d6f,0x662d3220,
+0x72656769,0x73746572,0x0,0x53686f75,0x6c642062,0x65206d75,0x6c746970,0x6c652d6f,
+0x662d3220,0x72656769,0x73746572,0x0,0x53686f75,0x6c642062,0x65206d75,0x6c746970,
+0x6c652d6f,0x662d3420,0x72656769,0x73746572,0x0,0x53686f75,0x6c642062,0x6520666c,
+0x6f617469,0x6e672070,0x6f696e74,0x20636f6e,0x64697469,0x6f6e2063,0x6f646520,0x72656769,
+0x73746572,0x0,0x66616c73,0x65000000,0x61733070,0x61727365,0x2e630000,0x25316420,
+0x25316400,0x2025730a,0x0,0x0,0x63616e20,0x6e6f7420,0x72656465,0x66696e65,
+0x2073796d,0x626f6c00,0x62726561,0x6b206f70,0x6572616e,0x64206f75,0x74206f66,0x2072616e,
+0x67650000,0x696c6c2d,0x666f726d,0x65642073,0x796d626f,0x6c696320,0x65787072,0x65737369,
+0x6f6e0000,0x696c6c2d,0x666f726d,0x65642073,0x796d626f,0x6c696320,0x65787072,0x65737369,
+0x6f6e0000,0x42616420,0x69642069,0x6e206578,0x70726573,0x73696f6e,0x0,0x68690000,
+0x6c6f0000,0x67707265,0x6c000000,0x68616c66,0x0,0x25206e6f,0x7420666f,0x6c6c6f77,
+0x65642062,0x79206869,0x2f6c6f2f,0x67707265,0x6c000000,0x2568692f,0x256c6f2f,0x25677072,
+0x656c206e,0x6f742066,0x6f6c6c6f,0x77656420,0x62792028,0x0,0x4c6f6164,0x2f53746f,
+0x7265206f,0x6620756e,0x64656669,0x6e656420,0x73796d62,0x6f6c0000,0x696e7661,0x6c696420,
+0x65787072,0x65737369,0x6f6e2077,0x69746820,0x2568692f,0x256c6f00,0x27292720,0x65787065,
+0x63746564,0x0,0x696e7661,0x6c696420,0x6d656d6f,0x72792074,0x61670000,0x4c6f6164,
+0x2f73746f,0x7265206f,0x6620616e,0x20756e64,0x6566696e,0x65642073,0x796d626f,0x6c000000,
+0x696e7661,0x6c696420,0x65787465,0x726e616c,0x20657870,0x72657373,0x696f6e00,0x27292720,
+0x65787065,0x63746564,0x0,0x43616368,0x652f5072,0x65662069,0x6e737472,0x75637469,
+0x6f6e2068,0x61732069,0x6e76616c,0x69642076,0x616c7565,0x0,0x4c6f6164,0x2f73746f,
+0x7265206f,0x6620616e,0x20756e64,0x6566696e,0x65642073,0x796d626f,0x6c000000,0x696e7661,
+0x6c696420,0x65787465,0x726e616c,0x20657870,0x72657373,0x696f6e00,0x27292720,0x65787065,
+0x63746564,0x0,0x4c6f6164,0x2f73746f,0x7265206f,0x6620616e,0x20756e64,0x6566696e,
+0x65642073,0x796d626f,0x6c000000,0x696e7661,0x6c696420,0x65787465,0x726e616c,0x20657870,
+0x72657373,0x696f6e00,0x27292720,0x65787065,0x63746564,0x0,0x666c6f61,0x74696e67,
+0x20706f69,0x6e742063,0x6f6e7374,0x616e7420,0x65787065,0x63746564,0x0,0x6c756920,
+0x65787072,0x65737369,0x6f6e206e,0x6f742069,0x6e20302e,0x2e363535,0x33350000,0x6661736d,
+0x203d3d20,0x7a6c6900,0x61733070,0x61727365,0x2e630000,0x6c756920,0x65787072,0x65737369,
+0x6f6e206e,0x6f742069,0x6e20302e,0x2e363535,0x33350000,0x696e7661,0x6c696420,0x73796e74,
+0x61782069,0x6e207374,0x6174656d,0x656e7400,0x696e7661,0x6c696420,0x73796e74,0x61782069,
+0x6e207374,0x6174656d,0x656e7400,0x73686966,0x7420616d,0x6f756e74,0x206e6f74,0x20302e2e,
+0x33310000,0x73686966,0x7420616d,0x6f756e74,0x206e6f74,0x20302e2e,0x36330000,0x73686966,
+0x7420616d,0x6f756e74,0x206e6f74,0x20302e2e,0x33310000,0x6f706572,0x6174696f,0x6e206e65,
+0x65647320,0x696d6d65,0x64206f70,0x6572616e,0x64000000,0x696d6d65,0x64206f70,0x6572616e,
+0x64206e6f,0x74202d30,0x2e2e3635,0x35333500,0x696d6d65,0x64206f70,0x6572616e,0x64206e6f,
+0x74202d33,0x32373638,0x2e2e3332,0x37363700,0x696d6d65,0x64206f70,0x6572616e,0x64206e6f,
+0x7420616c,0x6c6f7765,0x64206f6e,0x20667020,0x0,0x696d6d65,0x64206f70,0x6572616e,
+0x64206e6f,0x7420616c,0x6c6f7765,0x6420666f,0x72206363,0x20000000,0x496d6d65,0x64696174,
+0x65207661,0x6c756520,0x6f757420,0x6f662072,0x616e6765,0x0,0x6d616372,0x6f206578,
+0x70616e73,0x696f6e20,0x6e656564,0x73206174,0x20726567,0x69737465,0x72206166,0x74657220,
+0x2e736574,0x206e6f61,0x74000000,0x68696e74,0x20666965,0x6c64206e,0x6f742069,0x6e207261,
+0x6e676520,0x302e2e33,0x31000000,0x65787065,0x6374696e,0x67202728,0x27206265,0x666f7265,
+0x20626173,0x65207265,0x67697374,0x65720000,0x65787065,0x6374696e,0x67202729,0x27206166,
+0x74657220,0x62617365,0x20726567,0x69737465,0x72000000,0x636f6465,0x20666965,0x6c642069,
+0x6e207472,0x61702069,0x6e737472,0x75637469,0x6f6e206e,0x6f742069,0x6e20302e,0x2e313032,
+0x33000000,0x6d616372,0x6f206578,0x70616e73,0x696f6e20,0x6e656564,0x73206174,0x20726567,
+0x69737465,0x72206166,0x74657220,0x2e736574,0x206e6f61,0x74000000,0x696e7661,0x6c696420,
+0x73796e74,0x61782069,0x6e207374,0x6174656d,0x656e7400,0x696e7661,0x6c696420,0x65787465,
+0x726e616c,0x20657870,0x72657373,0x696f6e00,0x73746d74,0x20657874,0x656e6473,0x20706173,
+0x74206c6f,0x67696361,0x6c20656e,0x64000000,0x4a414c20,0x73686f75,0x6c64206e,0x6f742075,
+0x73652073,0x616d6520,0x72656769,0x73746572,0x20747769,0x63650000,0x696e7661,0x6c696420,
+0x73796d62,0x6f6c2066,0x6f722061,0x64647265,0x73730000,0x2b2f2d20,0x65787065,0x63746564,
+0x20616674,0x6572202e,0x0,0x6272616e,0x6368206f,0x66667365,0x74206e6f,0x74207370,
+0x65636966,0x69656400,0x72656c61,0x74697665,0x206f6666,0x73657420,0x6e6f7420,0x6d756c74,
+0x69706c65,0x206f6620,0x34000000,0x72656c61,0x74697665,0x206f6666,0x73657420,0x6265796f,
+0x6e642033,0x32373638,0x0,0x696e7661,0x6c696420,0x73796e74,0x61782069,0x6e207374,
+0x6174656d,0x656e7400,0x6c616265,0x6c206578,0x70656374,0x65640000,0x73796d62,0x6f6c2069,
+0x73206e6f,0x74206120,0x6c616265,0x6c000000,0x6d616372,0x6f206578,0x70616e73,0x696f6e20,
+0x6e656564,0x73206174,0x20726567,0x69737465,0x72206166,0x74657220,0x2e736574,0x206e6f61,
+0x74000000,0x24333120,0x6e6f7420,0x616c6c6f,0x77656420,0x696e2063,0x6f6e6469,0x74696f6e,
+0x616c2062,0x72616e63,0x6820616e,0x64206c69,0x6e6b0000,0x6c616265,0x6c206578,0x70656374,
+0x65640000,0x73796d62,0x6f6c2069,0x73206e6f,0x74206120,0x6c616265,0x6c000000,0x636f6e64,
+0x6974696f,0x6e20636f,0x6465206f,0x72206c61,0x62656c20,0x65787065,0x63746564,0x0,
+0x6c616265,0x6c206578,0x70656374,0x65640000,0x73796d62,0x6f6c2069,0x73206e6f,0x74206120,
+0x6c616265,0x6c000000,0x65787072,0x65737369,0x6f6e2072,0x65717569,0x72656400,0x636f7072,
+0x6f636573,0x736f7220,0x6f706572,0x6174696f,0x6e203e20,0x32352062,0x69747300,0x4f666673,
+0x65742066,0x6f722063,0x70726573,0x746f7265,0x206d7573,0x74206265,0x20706f73,0x69746976,
+0x6520616e,0x64206469,0x76697369,0x626c6520,0x62792034,0x0,0x2e637061,0x6c696173,
+0x20726571,0x75697265,0x73206120,0x72656769,0x73746572,0x20617267,0x756d656e,0x74000000,
+0x76657273,0x696f6e20,0x7374616d,0x7020646f,0x6573206e,0x6f74206d,0x61746368,0x0,
+0x65787072,0x65737369,0x6f6e2072,0x65717569,0x72656400,0x63616e20,0x6e6f7420,0x66696e64,
+0x2073796d,0x626f6c00,0x63616e20,0x6e6f7420,0x66696e64,0x2073796d,0x626f6c00,0x2e736869,
+0x66745f61,0x64647220,0x65787072,0x65737369,0x6f6e206e,0x6f742031,0x0,0x616c6967,
+0x6e206578,0x70726573,0x73696f6e,0x206e6f74,0x20302e2e,0x31320000,0x73747269,0x6e67206c,
+0x69746572,0x616c2065,0x78706563,0x74656400,0x76616c75,0x65206d75,0x73742062,0x65202d31,
+0x32382e2e,0x32353500,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,0x6f707469,
+0x6f6e616c,0x20617267,0x756d656e,0x74206e6f,0x7420532c,0x2069676e,0x6f726564,0x2e000000,
+0x696e7661,0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x636f6d6d,0x2f2e6c63,0x6f6d6d2f,
+0x2e657874,0x65726e20,0x0,0x66616c73,0x65000000,0x61733070,0x61727365,0x2e630000,
+0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,0x2e73796d,0x20646972,0x65637469,
+0x7665206e,0x6f742069,0x6d706c65,0x6d656e74,0x65640000,0x696f7020,0x3d3d2069,0x72646174,
+0x61000000,0x61733070,0x61727365,0x2e630000,0x73747269,0x6e67206c,0x69746572,0x616c2065,
+0x78706563,0x74656400,0x2e656e64,0x20776974,0x686f7574,0x202e656e,0x74000000,0x6d697373,
+0x696e6720,0x2e656e64,0x20617420,0x656e6420,0x6f662061,0x7373656d,0x626c7900,0x2e656e74,
+0x2f2e656e,0x6420626c,0x6f636b20,0x6e657665,0x72206465,0x66696e65,0x64207468,0x65207072,
+0x6f636564,0x75726520,0x6e616d65,0x0,0x6964656e,0x74696665,0x72206578,0x70656374,
+0x65640000,0x25732000,0x6d697373,0x696e6720,0x2e656e64,0x20707265,0x63656469,0x6e672074,
+0x68697320,0x2e656e74,0x0,0x2e61656e,0x74206d75,0x73742062,0x6520696e,0x73696465,
+0x202e656e,0x742f2e65,0x6e642062,0x6c6f636b,0x0,0x696e7661,0x6c696420,0x73796d62,
+0x6f6c2066,0x6f72202e,0x5b615d65,0x6e742000,0x6964656e,0x74696665,0x72206578,0x70656374,
+0x65640000,0x696e7661,0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x676c6f62,0x6c200000,
+0x62616420,0x73656374,0x696f6e20,0x6e616d65,0x0,0x62616420,0x73656374,0x696f6e20,
+0x6e616d65,0x0,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,0x696e7661,
+0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x74797065,0x0,0x62616420,0x2e747970,
+0x65207661,0x6c756500,0x6964656e,0x74696665,0x72206578,0x70656374,0x65640000,0x696e7661,
+0x6c696420,0x73796d62,0x6f6c2066,0x6f72202e,0x676c6f62,0x6c200000,0x42616420,0x69642069,
+0x6e206578,0x70726573,0x73696f6e,0x0,0x76616c75,0x65206d75,0x73742062,0x65202d33,
+0x32373638,0x2e2e3635,0x35333500,0x2e726570,0x65617420,0x6e6f7420,0x616c6c6f,0x77656420,
+0x696e2073,0x74727563,0x74000000,0x2e726570,0x65617420,0x6d617920,0x6e6f7420,0x6e657374,
+0x0,0x2e656e64,0x72207769,0x74686f75,0x74207072,0x65636564,0x696e6720,0x2e726570,
+0x65617400,0x6964656e,0x74696669,0x65722065,0x78706563,0x74656400,0x2e6f7074,0x696f6e20,
+0x6e616d65,0x20657870,0x65637465,0x64000000,0x556e6b6e,0x6f776e20,0x6e616d65,0x20696e20,
+0x2e6f7074,0x696f6e00,0x2e736574,0x206f7074,0x696f6e20,0x65787065,0x63746564,0x0,
+0x756e6b6e,0x6f776e20,0x6f707469,0x6f6e2069,0x6e202e73,0x65740000,0x52657365,0x72766564,
+0x206e616d,0x65207573,0x65642061,0x73206c61,0x62656c00,0x636f6c6f,0x6e206d75,0x73742066,
+0x6f6c6c6f,0x77206120,0x6c6f6361,0x6c206c61,0x62656c00,0x6d616c66,0x6f726d65,0x64207374,
+0x6174656d,0x656e7400,0x6d616c66,0x6f726d65,0x64207374,0x6174656d,0x656e7400,0x2e747970,
+0x65000000,0x756e6465,0x66696e65,0x64206173,0x73656d62,0x6c657220,0x6f706572,0x6174696f,
+0x6e000000,0x2e657272,0x20646972,0x65637469,0x76652065,0x6e636f75,0x6e746572,0x65640000,
+0x66616c73,0x65000000,0x61733070,0x61727365,0x2e630000,0x66616c73,0x65000000,0x61733070,
+0x61727365,0x2e630000,0x66616c73,0x65000000,0x61733070,0x61727365,0x2e630000,0x73746d74,
+0x20657874,0x656e6473,0x20706173,0x74206c6f,0x67696361,0x6c20656e,0x64000000,0x66616c73,
+0x65000000,0x61733070,0x61727365,0x2e630000,0x73746d74,0x20657874,0x656e6473,0x20706173,
+0x74206c6f,0x67696361,0x6c20656e,0x64000000,0x61737365,0x6d626c65,0x72206f70,0x2f646972,
+0x65637469,0x76652065,0x78706563,0x74656400,0xf03e9bc4,0xf03e969c,0xf03e9728,0xf03e9784,
+0xf03e98ac,0xf03e98f0,0xf03e9980,0xf03e9810,0xf03e9850,0xf03e9a54,0xf03e9aac,0xf03e9af8,
+0xf03e9b84,0xf03e9e0c,0xf03e9e0c,0xf03e9d98,0xf03e9d10,0xf03e9e0c,0xf03e9ea8,0xf03e9d90,
+0xf03e9e88,0xf03e9ea8,0xf03e9e88,0xf03e9f14,0xf03e9f14,0xf03e9e5c,0xf03e9eec,0xf03e9dd4,
+0xf03e9cd0,0xf03ec4cc,0xf03ec4cc,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,
+0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,
+0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec4cc,0xf03ec4cc,0xf03ec4cc,
+0xf03ec4cc,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,
+0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,
+0xf03ec544,0xf03ec544,0xf03ec544,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,
+0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec508,0xf03ec708,0xf03ec708,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec8f8,0xf03ec8f8,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec8f8,0xf03ec8f8,0xf03ec8f8,
+0xf03ec8f8,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec748,
+0xf03ec748,0xf03ec748,0xf03ec7c8,0xf03ec7c8,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec708,0xf03ec708,0xf03ec708,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec7c8,0xf03ec7c8,0xf03ec7c8,0xf03ec7c8,
+0xf03ec7c8,0xf03ec7c8,0xf03ec7c8,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,
+0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,
+0xf03ec8c8,0xf03ec8c8,0xf03ec8c8,0xf03ec6c8,0xf03ec6c8,0xf03ec924,0xf03ec924,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec924,0xf03ec6c8,0xf03ec924,
+0xf03ec924,0xf03ec924,0xf03ec6c8,0xf03ec6c8,0xf03ec990,0xf03ec990,0xf03ec9ac,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec990,0xf03ec990,0xf03ec990,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec990,0xf03ec990,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,
+0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,0xf03ec9ac,
+0xf03ec9ac,0xf03ec990,0xf03ec990,0xf03f0dfc,0xf03f0e14,0xf03f0e30,0xf03f0e68,0xf03f0e68,
+0xf03f0e68,0xf03f0da8,0xf03f0d74,0xf03f0d8c,0xf03f0da8,0xf03f0dc4,0xf03f0de0,0xf03f1b44,
+0xf03f197c,0xf03f1d68,0xf03f18a4,0xf03f18bc,0xf03f18d8,0xf03f18f4,0xf03f190c,0xf03f19c4,
+0xf03f188c,0xf03f1944,0xf03f1bdc,0xf03f1928,0xf03f19ac,0xf03f1d84,0xf03f1db8,0xf03f1d9c,
+0xf03f1994,0xf03f1c24,0xf03f1a2c,0xf03f188c,0xf03f1a44,0xf03f1de8,0xf03f1a74,0xf03f188c,
+0xf03f188c,0xf03f1a74,0xf03f1aa4,0xf03f1a8c,0xf03f1a8c,0xf03f1de8,0xf03f1a14,0xf03f1dd0,
+0xf03f1ad4,0xf03f1b04,0xf03f1a8c,0xf03f1abc,0xf03f1b5c,0xf03f1b78,0xf03f1b24,0xf03f1de8,
+0xf03f1bc4,0xf03f1bac,0xf03f1960,0xf03f19e0,0xf03f1a74,0xf03f19fc,0xf03f1c3c,0xf03f1c58,
+0xf03f1bf4,0xf03f1c0c,0xf03f1b94,0xf03f1c74,0xf03f1c74,0xf03f1c74,0xf03f1c74,0xf03f1c8c,
+0xf03f1cd8,0xf03f1a5c,0xf03f1d38,0xf03f1d50,0xf03f1e8c,0xf03f1f04,0xf03f1f34,0xf03f1eec,
+0xf03f1ed4,0xf03f1ea4,0xf03f1f94,0xf03f1f7c,0xf03f1f64,0xf03f1fac,0xf03f1ebc,0xf03f1f4c,
+0xf03f1f1c,0xf03f1fc4,0xf03f1ff4,0xf03f1fdc,0xf03f200c,0xf03f2024,0x0,0x0,
+0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2063,0x68616e67,0x655f676c,0x6f62616c,
+0x28290000,0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2064,0x6174615f,0x6c6f6361,
+0x6c697a65,0x0,0x45787065,0x63746564,0x206e6f6e,0x2d50726f,0x6320696e,0x20646174,
+0x615f6c6f,0x63616c69,0x7a650000,0x45787065,0x63746564,0x20676c6f,0x62616c20,0x696e2074,
+0x6578745f,0x6c6f6361,0x6c697a65,0x0,0x63686563,0x6b5f6d61,0x6c6c6f63,0x0,
+0x2e540000,0x53796d62,0x6f6c2025,0x73206e65,0x76657220,0x64656669,0x6e656400,0x436f6e66,
+0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,0x6d626f6c,0x20257300,
+0x436f6e66,0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,0x6d626f6c,
+0x20257300,0x436f6e66,0x6c696374,0x696e6720,0x64656669,0x6e697469,0x6f6e206f,0x66207379,
+0x6d626f6c,0x20257300,0x43616e6e,0x6f742075,0x7365202e,0x636f6d6d,0x206f6e20,0x70726576,
+0x696f7573,0x6c792064,0x6566696e,0x65642073,0x796d626f,0x6c202573,0x0,0x43616e6e,
+0x6f742075,0x7365202e,0x6c636f6d,0x6d206f6e,0x20707265,0x76696f75,0x736c7920,0x64656669,
+0x6e656420,0x73796d62,0x6f6c2025,0x73000000,0x2e676c6f,0x626c206d,0x75737420,0x70726563,
+0x65646520,0x74686520,0x64656669,0x6e697469,0x6f6e206f,0x66207468,0x65207379,0x6d626f6c,
+0x20257300,0x2e656e74,0x206d7573,0x74207072,0x65636564,0x65207468,0x65206465,0x66696e69,
+0x74696f6e,0x206f6620,0x74686520,0x73796d62,0x6f6c2025,0x73000000,0x73634e69,0x6c20746f,
+0x2073634e,0x696c0000,0x496e7465,0x726e616c,0x3a206261,0x64206163,0x74696f6e,0x20696e20,
+0x73796d5f,0x64656669,0x6e650000,0x25640000,0xf03f2fa0,0xf03f2a94,0xf03f2be8,0xf03f2fe0,
+0xf03f2fe0,0xf03f29f8,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,
+0xf03f2fe0,0xf03f2be8,0xf03f2fe0,0xf03f2be8,0xf03f2fe0,0xf03f2cac,0xf03f2fe0,0xf03f2fe0,
+0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,
+0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2fe0,0xf03f2d7c,0xf03f2e4c,0xf03f2f04,
+0x4c6f6361,0x6c206c61,0x62656c20,0x6e756d62,0x65722069,0x73206f75,0x74206f66,0x2072616e,
+0x67650000,0x4e6f2073,0x75636820,0x6c616265,0x6c000000,0x546f6f20,0x6d616e79,0x206c6f63,
+0x616c206c,0x6162656c,0x73000000,0x4f766572,0x666c6f77,0x0,0x4c617267,0x65206465,
+0x63696d61,0x6c207365,0x74207369,0x676e2062,0x69740000,0x4e756d62,0x6572206f,0x7574206f,
+0x66207261,0x6e676500,0x69203e20,0x30000000,0x61733075,0x74696c2e,0x63000000,0x4261646c,
+0x79206465,0x6c696d69,0x74656420,0x6e756d65,0x72696320,0x6c697465,0x72616c00,0x48657820,
+0x64696769,0x7420696e,0x20646563,0x696d616c,0x206c6974,0x6572616c,0x0,0x4261646c,
+0x79206465,0x6c696d69,0x74656420,0x68657861,0x64656369,0x6d616c20,0x6c697465,0x72616c00,
+0x48657820,0x666c6f61,0x74696e67,0x20706f69,0x6e74206c,0x69746572,0x616c2074,0x6f6f206c,
+0x6f6e6700,0x5472756e,0x63617469,0x6e672074,0x6f6b656e,0x0,0x4d697373,0x696e6720,
+0x6578706f,0x6e656e74,0x20696e20,0x666c6f61,0x74696e67,0x2d706f69,0x6e74206c,0x69746572,
+0x616c0000,0x7a65726f,0x206c656e,0x67746820,0x73747269,0x6e670000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x6c697465,0x72616c20,
+0x73747269,0x6e67206e,0x6f742074,0x65726d69,0x6e617465,0x64000000,0x206e756d,0x62657220,
+0x696e2073,0x7472696e,0x6720746f,0x6f206269,0x67000000,0x6c697465,0x72616c20,0x73747269,
+0x6e672074,0x6f6f206c,0x6f6e6700,0x4d697373,0x696e6720,0x22206174,0x20656e64,0x206f6620,
+0x73747269,0x6e670000,0x45787065,0x63746564,0x20637070,0x2d67656e,0x65726174,0x6564206c,
+0x696e6520,0x6e756d62,0x65720000,0x45787065,0x63746564,0x20637070,0x2d67656e,0x65726174,
+0x6564206c,0x696e6520,0x6e756d62,0x65720000,0x45787065,0x63746564,0x20637070,0x2d67656e,
+0x65726174,0x65642066,0x696c6520,0x6e616d65,0x0,0x5472756e,0x63617469,0x6e672063,
+0x70702d67,0x656e6572,0x61746564,0x2066696c,0x656e616d,0x65000000,0x4c696e65,0x20746f6f,
+0x206c6f6e,0x67000000,0x41646472,0x65737320,0x73796d62,0x6f6c2065,0x78706563,0x74656400,
+0x72656769,0x73746572,0x20657870,0x65637465,0x64000000,0x556e6465,0x66696e65,0x64207379,
+0x6d626f6c,0x0,0x52656769,0x73746572,0x20657870,0x65637465,0x64000000,0x52696768,
+0x74207061,0x72656e20,0x65787065,0x63746564,0x0,0x756e6465,0x66696e65,0x64207379,
+0x6d626f6c,0x20696e20,0x65787072,0x65737369,0x6f6e0000,0x53796d62,0x6f6c206d,0x75737420,
+0x68617665,0x20616273,0x6f6c7574,0x65207661,0x6c756500,0x53747269,0x6e672077,0x69746869,
+0x6e206578,0x70726573,0x73696f6e,0x206d6179,0x20686176,0x65206f6e,0x6c79206f,0x6e652063,
+0x68617261,0x63746572,0x0,0x496e7661,0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,
+0x70726573,0x73696f6e,0x0,0x52696768,0x74207061,0x72656e20,0x65787065,0x63746564,
+0x0,0x756e6465,0x66696e65,0x64207379,0x6d626f6c,0x20696e20,0x65787072,0x65737369,
+0x6f6e0000,0x53796d62,0x6f6c206d,0x75737420,0x68617665,0x20616273,0x6f6c7574,0x65207661,
+0x6c756500,0x53747269,0x6e672077,0x69746869,0x6e206578,0x70726573,0x73696f6e,0x206d6179,
+0x20686176,0x65206f6e,0x6c79206f,0x6e652063,0x68617261,0x63746572,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x496e7661,
+0x6c696420,0x73796d62,0x6f6c2069,0x6e206578,0x70726573,0x73696f6e,0x0,0x45787065,
+0x63746564,0x20222922,0x20616674,0x65722062,0x61736520,0x72656769,0x73746572,0x0,
+0xf03f4774,0xf03f433c,0xf03f433c,0xf03f42f0,0xf03f42f0,0xf03f433c,0xf03f42f0,0xf03f42f0,
+0xf03f42f0,0xf03f42f0,0xf03f42f0,0xf03f42f0,0xf03f433c,0xf03f42f0,0xf03f433c,0xf03f433c,
+0xf03f433c,0xf03f433c,0xf03f433c,0xf03f433c,0xf03f433c,0xf03f433c,0xf03f433c,0xf03f433c,
+0xf03f42f0,0xf03f42f0,0xf03f42f0,0xf03f42f0,0xf03f42f0,0xf03f4a48,0xf03f48a8,0xf03f48a8,
+0xf03f48a8,0xf03f48a8,0xf03f4870,0xf03f4878,0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f4880,
+0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f4888,
+0xf03f48a8,0xf03f48a8,0xf03f48a8,0xf03f4890,0xf03f48a8,0xf03f4898,0xf03f48a8,0xf03f48a0,
+0xf03f5c1c,0xf03f5c68,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5bd8,0xf03f5c74,0xf03f5c74,
+0xf03f5c74,0xf03f5c74,0xf03f5be8,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,
+0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c74,0xf03f5c50,
+0xf03f5c74,0xf03f5c58,0xf03f5e94,0xf03f5f24,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5e44,
+0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5e6c,0xf03f5f54,0xf03f5f54,0xf03f5f54,
+0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,0xf03f5f54,
+0xf03f5f54,0xf03f5ebc,0xf03f5f54,0xf03f5ee4,0x6c616265,0x6c000000,0x2e73796d,0x0,
+0x2e676c6f,0x626c0000,0x2e63706c,0x6f616400,0x2e616c69,0x676e0000,0x2e617363,0x69690000,
+0x2e617363,0x69697a00,0x2e627974,0x65000000,0x2e636f6d,0x6d000000,0x2e6c636f,0x6d6d0000,
+0x2e646174,0x61000000,0x2e646f75,0x626c6500,0x2e66696c,0x65000000,0x2e666c6f,0x61740000,
+0x2e68616c,0x66000000,0x2e637072,0x6573746f,0x72650000,0x2e677077,0x6f726400,0x2e637061,
+0x64640000,0x2e776561,0x6b657874,0x0,0x2e6c6f6f,0x706e6f00,0x2e737061,0x63650000,
+0x2e746578,0x74000000,0x2e776f72,0x64000000,0x6f636f64,0x65000000,0x2e656e64,0x0,
+0x2e736461,0x74610000,0x2e726461,0x74610000,0x2e656e74,0x0,0x2e6c6f63,0x0,
+0x2e62676e,0x62000000,0x2e656e64,0x62000000,0x2e61736d,0x30000000,0x2e736574,0x0,
+0x2e637061,0x6c696173,0x0,0x2e726570,0x65617400,0x2e656e64,0x72000000,0x2e6c6162,
+0x0,0x2e767265,0x67000000,0x2e6d6173,0x6b000000,0x2e666d61,0x736b0000,0x2e657272,
+0x0,0x676c6f62,0x61627300,0x2e766572,0x7374616d,0x70000000,0x2e667261,0x6d650000,
+0x2e657874,0x656e6465,0x64000000,0x2e657874,0x65726e00,0x2e61656e,0x74000000,0x2e6f7074,
+0x696f6e00,0x2e6e6f61,0x6c696173,0x0,0x2e616c69,0x61730000,0x2e6d7461,0x67000000,
+0x2e6d616c,0x69617300,0x2e737472,0x75637400,0x2e6c6976,0x65726567,0x0,0x2e676a61,
+0x6c646566,0x0,0x2e676a61,0x6c6c6976,0x65000000,0x2e676a72,0x6c697665,0x0,
+0x2e697368,0x6966745f,0x61646472,0x0,0x2e697265,0x73746578,0x74000000,0x2e64776f,
+0x72640000,0x2e70726f,0x6c6f6775,0x65000000,0x2e656461,0x74610000,0x2e616c6c,0x6f630000,
+0x24300000,0x24310000,0x24320000,0x24330000,0x24340000,0x24350000,0x24360000,0x24370000,
+0x24380000,0x24390000,0x24313000,0x24313100,0x24313200,0x24313300,0x24313400,0x24313500,
+0x24313600,0x24313700,0x24313800,0x24313900,0x24323000,0x24323100,0x24323200,0x24323300,
+0x24323400,0x24323500,0x24323600,0x24323700,0x24323800,0x24323900,0x24333000,0x24333100,
+0x24663000,0x24663100,0x24663200,0x24663300,0x24663400,0x24663500,0x24663600,0x24663700,
+0x24663800,0x24663900,0x24663130,0x0,0x24663131,0x0,0x24663132,0x0,
+0x24663133,0x0,0x24663134,0x0,0x24663135,0x0,0x24663136,0x0,
+0x24663137,0x0,0x24663138,0x0,0x24663139,0x0,0x24663230,0x0,
+0x24663231,0x0,0x24663232,0x0,0x24663233,0x0,0x24663234,0x0,
+0x24663235,0x0,0x24663236,0x0,0x24663237,0x0,0x24663238,0x0,
+0x24663239,0x0,0x24663330,0x0,0x24663331,0x0,0x24666363,0x30000000,
+0x24666363,0x31000000,0x24666363,0x32000000,0x24666363,0x33000000,0x24666363,0x34000000,
+0x24666363,0x35000000,0x24666363,0x36000000,0x24666363,0x37000000,0x20202000,0x66726f62,
+0x0,0x66726100,0x66726900,0x66727272,0x0,0x66727269,0x0,0x66727200,
+0x66610000,0x66720000,0x6672726c,0x0,0x66726c00,0x666c0000,0x666f7272,0x72000000,
+0x6672696c,0x0,0x66690000,0x666f6100,0x66727272,0x72000000,0x6e6f6e65,0x0,
+0x6f707469,0x6d697a65,0x0,0x70696300,0x0,0x72656f72,0x64657200,0x6e6f7265,
+0x6f726465,0x72000000,0x6d616372,0x6f000000,0x6e6f6d61,0x63726f00,0x61740000,0x6e6f6174,
+0x0,0x6d6f7665,0x0,0x6e6f6d6f,0x76650000,0x626f7074,0x0,0x6e6f626f,
+0x70740000,0x766f6c61,0x74696c65,0x0,0x6e6f766f,0x6c617469,0x6c650000,0x7472616e,
+0x73666f72,0x6d000000,0x6e6f7472,0x616e7366,0x6f726d00,0x7265706f,0x73697469,0x6f6e0000,
+0x6e6f7265,0x706f7369,0x74696f6e,0x0,0x6672616e,0x6f6e6500,0x66726168,0x69000000,
+0x6672616c,0x6f000000,0x66726172,0x656c3100,0x66726172,0x656c3200,0x24667261,0x6d657265,
+0x67000000,0x24667261,0x6d657369,0x7a650000,0x61627300,0x61646400,0x61646475,0x0,
+0x616e6400,0x62000000,0x62633066,0x0,0x62633074,0x0,0x62633166,0x0,
+0x62633174,0x0,0x62633266,0x0,0x62633274,0x0,0x0,0x0,
+0x62657100,0x62676500,0x62676575,0x0,0x6267657a,0x0,0x62677400,0x62677475,
+0x0,0x6267747a,0x0,0x626c6500,0x626c6575,0x0,0x626c657a,0x0,
+0x626c7400,0x626c7475,0x0,0x626c747a,0x0,0x626e6500,0x62726561,0x6b000000,
+0x63300000,0x63310000,0x63320000,0x0,0x64697600,0x64697675,0x0,0x6a000000,
+0x6a616c00,0x6c610000,0x6c620000,0x6c627500,0x6c680000,0x6c687500,0x6c690000,0x6c770000,
+0x6a720000,0x6c776331,0x0,0x6c776332,0x0,0x70726566,0x0,0x6d666869,
+0x0,0x6d666c6f,0x0,0x6d6f7665,0x0,0x6a616c72,0x0,0x73776331,
+0x0,0x73776332,0x0,0x0,0x6d746869,0x0,0x6d746c6f,0x0,
+0x6d756c00,0x6d756c6f,0x0,0x6d756c6f,0x75000000,0x6d756c74,0x0,0x6d756c74,
+0x75000000,0x6e656700,0x6e6f7000,0x6e6f7200,0x6f720000,0x72656d00,0x72656d75,0x0,
+0x72666500,0x726f6c00,0x726f7200,0x73620000,0x73657100,0x73676500,0x73676575,0x0,
+0x73677400,0x73677475,0x0,0x73680000,0x736c6500,0x736c6575,0x0,0x736c6c00,
+0x736c7400,0x736c7475,0x0,0x736e6500,0x73726100,0x73726c00,0x73756200,0x73756275,
+0x0,0x73770000,0x73797363,0x616c6c00,0x786f7200,0x6e6f7400,0x6c776c00,0x6c777200,
+0x73776c00,0x73777200,0x0,0x6d666330,0x0,0x6d666331,0x0,0x6d666332,
+0x0,0x0,0x6d746330,0x0,0x6d746331,0x0,0x6d746332,0x0,
+0x73796e63,0x0,0x746c6272,0x0,0x746c6277,0x69000000,0x746c6277,0x72000000,
+0x746c6270,0x0,0x6c640000,0x73640000,0x0,0x6c646331,0x0,0x6c646332,
+0x0,0x746c6272,0x31000000,0x746c6270,0x31000000,0x73646331,0x0,0x73646332,
+0x0,0x0,0x6c2e7300,0x6c2e6400,0x6c2e6500,0x732e7300,0x732e6400,0x732e6500,
+0x6164642e,0x73000000,0x6164642e,0x64000000,0x6164642e,0x65000000,0x7375622e,0x73000000,
+0x7375622e,0x64000000,0x7375622e,0x65000000,0x6d756c2e,0x73000000,0x6d756c2e,0x64000000,
+0x6d756c2e,0x65000000,0x6469762e,0x73000000,0x6469762e,0x64000000,0x6469762e,0x65000000,
+0x73717274,0x2e730000,0x73717274,0x2e640000,0x73717274,0x2e650000,0x6d6f762e,0x73000000,
+0x6d6f762e,0x64000000,0x6d6f762e,0x65000000,0x6162732e,0x73000000,0x6162732e,0x64000000,
+0x6162732e,0x65000000,0x6376742e,0x732e6400,0x6376742e,0x732e6500,0x6376742e,0x732e7700,
+0x6376742e,0x642e7300,0x6376742e,0x642e6500,0x6376742e,0x642e7700,0x6376742e,0x652e7300,
+0x6376742e,0x652e6400,0x6376742e,0x652e7700,0x6376742e,0x772e7300,0x6376742e,0x772e6400,
+0x6376742e,0x772e6500,0x632e662e,0x73000000,0x632e662e,0x64000000,0x632e662e,0x65000000,
+0x632e756e,0x2e730000,0x632e756e,0x2e640000,0x632e756e,0x2e650000,0x632e6571,0x2e730000,
+0x632e6571,0x2e640000,0x632e6571,0x2e650000,0x632e7565,0x712e7300,0x632e7565,0x712e6400,
+0x632e7565,0x712e6500,0x632e6f6c,0x742e7300,0x632e6f6c,0x742e6400,0x632e6f6c,0x742e6500,
+0x632e756c,0x742e7300,0x632e756c,0x742e6400,0x632e756c,0x742e6500,0x632e6f6c,0x652e7300,
+0x632e6f6c,0x652e6400,0x632e6f6c,0x652e6500,0x632e756c,0x652e7300,0x632e756c,0x652e6400,
+0x632e756c,0x652e6500,0x632e7366,0x2e730000,0x632e7366,0x2e640000,0x632e7366,0x2e650000,
+0x632e6e67,0x6c652e73,0x0,0x632e6e67,0x6c652e64,0x0,0x632e6e67,0x6c652e65,
+0x0,0x632e7365,0x712e7300,0x632e7365,0x712e6400,0x632e7365,0x712e6500,0x632e6e67,
+0x6c2e7300,0x632e6e67,0x6c2e6400,0x632e6e67,0x6c2e6500,0x632e6c74,0x2e730000,0x632e6c74,
+0x2e640000,0x632e6c74,0x2e650000,0x632e6e67,0x652e7300,0x632e6e67,0x652e6400,0x632e6e67,
+0x652e6500,0x632e6c65,0x2e730000,0x632e6c65,0x2e640000,0x632e6c65,0x2e650000,0x632e6e67,
+0x742e7300,0x632e6e67,0x742e6400,0x632e6e67,0x742e6500,0x6c756900,0x756c7700,0x756c6800,
+0x756c6875,0x0,0x75737700,0x75736800,0x61646469,0x0,0x61646469,0x75000000,
+0x736c7469,0x0,0x736c7469,0x75000000,0x616e6469,0x0,0x6f726900,0x786f7269,
+0x0,0x0,0x6e656775,0x0,0x6265717a,0x0,0x626e657a,0x0,
+0x6e65672e,0x73000000,0x6e65672e,0x64000000,0x6e65672e,0x65000000,0x63666331,0x0,
+0x63746331,0x0,0x62616c00,0x6267657a,0x616c0000,0x626c747a,0x616c0000,0x6d746331,
+0x2e640000,0x6d666331,0x2e640000,0x7472756e,0x632e772e,0x73000000,0x7472756e,0x632e772e,
+0x64000000,0x7472756e,0x632e772e,0x65000000,0x726f756e,0x642e772e,0x73000000,0x726f756e,
+0x642e772e,0x64000000,0x726f756e,0x642e772e,0x65000000,0x6164646f,0x75000000,0x7375626f,
+0x75000000,0x7472756e,0x63752e77,0x2e730000,0x7472756e,0x63752e77,0x2e640000,0x7472756e,
+0x63752e77,0x2e650000,0x726f756e,0x64752e77,0x2e730000,0x726f756e,0x64752e77,0x2e640000,
+0x726f756e,0x64752e77,0x2e650000,0x63666330,0x0,0x63666332,0x0,0x0,
+0x63746330,0x0,0x63746332,0x0,0x0,0x6c692e73,0x0,0x6c692e64,
+0x0,0x6c692e65,0x0,0x746c7400,0x746c7475,0x0,0x74676500,0x74676575,
+0x0,0x74657100,0x746e6500,0x6c6c0000,0x73630000,0x6365696c,0x2e772e73,0x0,
+0x6365696c,0x2e772e64,0x0,0x6365696c,0x2e772e65,0x0,0x6365696c,0x752e772e,
+0x73000000,0x6365696c,0x752e772e,0x64000000,0x6365696c,0x752e772e,0x65000000,0x666c6f6f,
+0x722e772e,0x73000000,0x666c6f6f,0x722e772e,0x64000000,0x666c6f6f,0x722e772e,0x65000000,
+0x666c6f6f,0x72752e77,0x2e730000,0x666c6f6f,0x72752e77,0x2e640000,0x666c6f6f,0x72752e77,
+0x2e650000,0x6265716c,0x0,0x6265717a,0x6c000000,0x626e656c,0x0,0x626e657a,
+0x6c000000,0x626c656c,0x0,0x626c6575,0x6c000000,0x626c657a,0x6c000000,0x6267746c,
+0x0,0x62677475,0x6c000000,0x6267747a,0x6c000000,0x626c746c,0x0,0x626c7475,
+0x6c000000,0x626c747a,0x6c000000,0x626c747a,0x616c6c00,0x6267656c,0x0,0x62676575,
+0x6c000000,0x6267657a,0x6c000000,0x6267657a,0x616c6c00,0x62633066,0x6c000000,0x62633074,
+0x6c000000,0x62633166,0x6c000000,0x62633174,0x6c000000,0x62633266,0x6c000000,0x62633274,
+0x6c000000,0x0,0x0,0x6c646c00,0x6c647200,0x6c6c6400,0x6c777500,0x73646c00,
+0x73647200,0x73636400,0x64616464,0x69000000,0x64616464,0x69750000,0x64616464,0x0,
+0x64616464,0x75000000,0x64737562,0x0,0x64737562,0x75000000,0x64736c6c,0x0,
+0x6473726c,0x0,0x64737261,0x0,0x64736c6c,0x76000000,0x6473726c,0x76000000,
+0x64737261,0x76000000,0x646d756c,0x74000000,0x646d756c,0x74750000,0x64646976,0x0,
+0x64646976,0x75000000,0x0,0x0,0x646d7463,0x31000000,0x646d6663,0x31000000,
+0x646d7463,0x30000000,0x646d6663,0x30000000,0x646d7463,0x32000000,0x646d6663,0x32000000,
+0x646c6900,0x646c6100,0x65726574,0x0,0x7472756e,0x632e6c2e,0x73000000,0x726f756e,
+0x642e6c2e,0x73000000,0x6365696c,0x2e6c2e73,0x0,0x666c6f6f,0x722e6c2e,0x73000000,
+0x7472756e,0x632e6c2e,0x64000000,0x726f756e,0x642e6c2e,0x64000000,0x6365696c,0x2e6c2e64,
+0x0,0x666c6f6f,0x722e6c2e,0x64000000,0x7472756e,0x632e6c2e,0x65000000,0x726f756e,
+0x642e6c2e,0x65000000,0x6365696c,0x2e6c2e65,0x0,0x666c6f6f,0x722e6c2e,0x65000000,
+0x6376742e,0x6c2e7300,0x6376742e,0x6c2e6400,0x6376742e,0x6c2e6500,0x6376742e,0x6c2e7700,
+0x6376742e,0x732e6c00,0x6376742e,0x642e6c00,0x6376742e,0x652e6c00,0x6376742e,0x772e6c00,
+0x63616368,0x65000000,0x63696100,0x756c6400,0x75736400,0x64616273,0x0,0x646e6567,
+0x0,0x646e6567,0x75000000,0x646d756c,0x0,0x646d756c,0x6f000000,0x646d756c,
+0x6f750000,0x6472656d,0x0,0x6472656d,0x75000000,0x64726f6c,0x0,0x64726f72,
+0x0,0x64616464,0x6f750000,0x64737562,0x6f750000,0x756c7775,0x0,0x6d6f7674,
+0x0,0x6d6f7666,0x0,0x6d6f766e,0x0,0x6d6f767a,0x0,0x6d616464,
+0x2e730000,0x6d616464,0x2e640000,0x6d616464,0x2e650000,0x6d737562,0x2e730000,0x6d737562,
+0x2e640000,0x6d737562,0x2e650000,0x6e6d6164,0x642e7300,0x6e6d6164,0x642e6400,0x6e6d6164,
+0x642e6500,0x6e6d7375,0x622e7300,0x6e6d7375,0x622e6400,0x6e6d7375,0x622e6500,0x72656369,
+0x702e7300,0x72656369,0x702e6400,0x72737172,0x742e7300,0x72737172,0x742e6400,0x6d6f7674,
+0x2e730000,0x6d6f7674,0x2e640000,0x6d6f7666,0x2e730000,0x6d6f7666,0x2e640000,0x6d6f766e,
+0x2e730000,0x6d6f766e,0x2e640000,0x6d6f767a,0x2e730000,0x6d6f767a,0x2e640000,0x6c777863,
+0x31000000,0x6c647863,0x31000000,0x73777863,0x31000000,0x73647863,0x31000000,0x70726566,
+0x78000000,0x64637472,0x0,0x64637477,0x0,0x746c6277,0x0,0x6e616461,
+0x0,0x73736e6f,0x70000000,0x64736c6c,0x33320000,0x6473726c,0x33320000,0x64737261,
+0x33320000,0x62633366,0x0,0x62633374,0x0,0x63330000,0x6c776333,0x0,
+0x73776333,0x0,0x6d666333,0x0,0x6d746333,0x0,0x63666333,0x0,
+0x63746333,0x0,0x736c6c76,0x0,0x73726c76,0x0,0x73726176,0x0,
+0x6d667063,0x0,0x6d747063,0x0,0x6d667073,0x0,0x6d747073,0x0,
+0x0,0x0,0x0,0x0,0x25640000,0x6c69626d,0x6c642d2d,0x0,
+0xa000000,0xa6c6962,0x6d6c642d,0x2d000000,0xa000000,0x6c69626d,0x6c642d2d,0x0,
+0xa000000,0x0,0x0,0x0,0x496e7465,0x726e616c,0x0,0x4572726f,
+0x72000000,0x5761726e,0x696e6700,0x496e666f,0x0,0x0,0xa000000,0x25730000,
+0x6173303a,0x20000000,0x25733a20,0x0,0x25730000,0x2c206c69,0x6e652025,0x31643a00,
+0x25730000,0x3a202573,0xa000000,0xa000000,0x20202020,0x2025730a,0x0,0x25730a00,
+0x25732c20,0x6c696e65,0x20253164,0x3a0a0000,0x20202020,0x61737365,0x7274696f,0x6e202825,
+0x73292066,0x61696c65,0x640a0000,0x2d454200,0x2d454c00,0x2d470000,0x2d4b0000,0x2d4d0000,
+0x2d4e5200,0x2d4f0000,0x2d4f3000,0x2d4f3100,0x2d4f3200,0x2d4f3300,0x2d4f3400,0x2d4f6c69,
+0x6d697400,0x2d520000,0x2d524400,0x2d540000,0x2d650000,0x2d666c69,0x0,0x2d660000,
+0x2d663000,0x2d663100,0x2d663200,0x2d663300,0x2d663400,0x2d670000,0x2d673000,0x2d673100,
+0x2d673200,0x2d673300,0x2d6c0000,0x2d6f0000,0x2d700000,0x2d703000,0x2d703100,0x2d703200,
+0x2d703300,0x2d720000,0x2d740000,0x2d760000,0x2d770000,0x2d773100,0x2d773200,0x2d773300,
+0x2d6e6f5f,0x636f6e73,0x745f6f70,0x74730000,0x2d6e6f5f,0x6c75695f,0x6f707473,0x0,
+0x2d6e6f5f,0x6469765f,0x72656d5f,0x6f707473,0x0,0x2d6e6f5f,0x61745f63,0x6f6d7072,
+0x65737369,0x6f6e0000,0x2d6e6f5f,0x6272616e,0x63685f74,0x61726765,0x74000000,0x2d6d6970,
+0x73310000,0x2d6d6970,0x73320000,0x2d6d6970,0x73330000,0x2d6d6970,0x73340000,0x2d6e6f70,
+0x6f6f6c00,0x2d616c69,0x676e3800,0x2d616c69,0x676e3136,0x0,0x2d616c69,0x676e3332,
+0x0,0x2d616c69,0x676e3634,0x0,0x2d616c69,0x676e5f63,0x6f6d6d6f,0x6e000000,
+0x2d67705f,0x7761726e,0x0,0x2d6e6f6e,0x5f706963,0x0,0x2d723330,0x30300000,
+0x2d723430,0x30300000,0x2d723630,0x30300000,0x2d723630,0x30304c48,0x55000000,0x2d723630,
+0x30304c57,0x4c000000,0x2d747261,0x70757600,0x2d6e6f70,0x65657000,0x2d706565,0x70646267,
+0x0,0x2d6e6f73,0x77706970,0x65000000,0x2d737770,0x64626700,0x2d6e6f73,0x796d7265,
+0x67730000,0x2d6e6f78,0x62620000,0x2d616767,0x725f7862,0x62000000,0x2d786262,0x64626700,
+0x2d6e6577,0x68696c6f,0x0,0x2d646f6d,0x74616700,0x2d667073,0x74616c6c,0x5f6e6f70,
+0x0,0x2d6e6f67,0x6c6f6261,0x6c000000,0x2d6e6f62,0x6f707400,0x2d647761,0x6c69676e,
+0x0,0x2d657863,0x70740000,0x2d646961,0x67000000,0x2d6d6564,0x6e617400,0x2d64776f,
+0x70636f64,0x65000000,0x2d363462,0x69740000,0x2d667033,0x32726567,0x0,0x2d657874,
+0x73796d73,0x0,0x2d706963,0x30000000,0x2d706963,0x31000000,0x2d706963,0x32000000,
+0x2d626967,0x5f676f74,0x0,0x2d636f66,0x66000000,0x2d656c66,0x0,0x2d6d7363,
+0x6f666600,0x2d6d7363,0x6f666631,0x0,0x2d6d756c,0x74695f69,0x73737565,0x0,
+0x2d6e6f6e,0x7a65726f,0x5f73636e,0x62617365,0x0,0x2d6e6577,0x5f6d6465,0x62756700,
+0x2d616269,0x0,0x2d746670,0x72657631,0x30000000,0x2d666f72,0x63655f62,0x72616e63,
+0x685f6669,0x78757000,0x2d723432,0x30300000,0x2d723436,0x30300000,0x2d746670,0x0,
+0x2d74355f,0x72333100,0x2d74355f,0x6d746331,0x0,0x2d74355f,0x6d756c64,0x69760000,
+0x2d74355f,0x6c6c5f73,0x635f6275,0x67000000,0x2d723433,0x30305f6d,0x756c0000,0x0,
+0x73745f70,0x6366645f,0x6966643a,0x20696664,0x20282564,0x29206f75,0x74206f66,0x2072616e,
+0x67650a00,0x73745f70,0x73796d5f,0x6966645f,0x6973796d,0x3a206966,0x64202825,0x6429206f,
+0x72206973,0x796d2028,0x25642920,0x6f757420,0x6f662072,0x616e6765,0xa000000,0x73745f70,
+0x6175785f,0x69617578,0x3a206961,0x75782028,0x25642920,0x6f757420,0x6f662072,0x616e6765,
+0xa000000,0x0,0x0,0x0,0x73745f63,0x75696e69,0x743a2063,0x616e6e6f,
+0x7420616c,0x6c6f6361,0x74652063,0x75727265,0x6e742063,0x6864720a,0x0,0x73745f65,
+0x78746164,0x643a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,0x6c697a65,0x20776974,
+0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,0x6578745f,0x69657874,
+0x3a20696e,0x64657820,0x6f757420,0x6f662072,0x616e6765,0x20282564,0x290a0000,0x73745f69,
+0x646e5f69,0x6e646578,0x5f666578,0x743a2079,0x6f752064,0x69646e27,0x7420696e,0x69746961,
+0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,0x73740a00,0x73745f70,
+0x646e5f69,0x646e3a20,0x69646e20,0x28256429,0x206c6573,0x73207468,0x616e2030,0x206f7220,
+0x67726561,0x74657220,0x7468616e,0x206d6178,0x20282564,0x290a0000,0x0,0x0,
+0x25733a20,0x496e7465,0x726e616c,0x3a200000,0xa000000,0x25733a20,0x4572726f,0x723a2000,
+0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,
+0x74652069,0x74656d20,0x6f662031,0x20627974,0x65207769,0x7468206d,0x616c6c6f,0x63283329,
+0xa000000,0x5f6d645f,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,
+0x74652069,0x74656d20,0x6f662025,0x6c642062,0x79746573,0x20776974,0x68206d61,0x6c6c6f63,
+0x2833290a,0x0,0x5f6d645f,0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,
+0x6f772069,0x74656d20,0x746f2025,0x6c642062,0x79746573,0x20776974,0x68207265,0x616c6c6f,
+0x63283329,0xa000000,0x0,0x0,0x73745f65,0x78747374,0x72616464,0x3a20796f,
+0x75206469,0x646e2774,0x20696e69,0x7469616c,0x697a6520,0x77697468,0x20637569,0x6e697420,
+0x6f722072,0x65616473,0x740a0000,0x73745f65,0x78747374,0x72616464,0x3a206172,0x67756d65,
+0x6e742069,0x73206e69,0x6c0a0000,0x73745f69,0x646e5f64,0x6e3a2079,0x6f752064,0x69646e27,
+0x7420696e,0x69746961,0x6c697a65,0x20776974,0x68206375,0x696e6974,0x206f7220,0x72656164,
+0x73740a00,0x73745f69,0x646e5f72,0x6e64783a,0x20796f75,0x20646964,0x6e277420,0x696e6974,
+0x69616c69,0x7a652077,0x69746820,0x6375696e,0x6974206f,0x72207265,0x61647374,0xa000000,
+0x73745f72,0x6e64785f,0x69646e3a,0x2069646e,0x20282564,0x29206772,0x65617465,0x72207468,
+0x616e206d,0x61782028,0x2564290a,0x0,0x73745f72,0x6e64785f,0x69646e3a,0x206f6c64,
+0x20696e74,0x65726661,0x63652063,0x616e2774,0x20707574,0x20726664,0x28256429,0x20696e74,
+0x6f20726e,0x64782c20,0x75736520,0x73745f70,0x646e5f69,0x646e2069,0x6e737465,0x61640a00,
+0x73745f73,0x65746964,0x6e3a2069,0x646e7372,0x63202825,0x6429206f,0x72206964,0x6e646573,
+0x74202825,0x6429206f,0x7574206f,0x66207261,0x6e67650a,0x0,0x73745f70,0x6578745f,
+0x646e3a20,0x72666420,0x6669656c,0x64202825,0x64292069,0x736e2774,0x20657175,0x616c2074,
+0x6f205354,0x5f455854,0x49464428,0x2564290a,0x0,0x73745f70,0x6578745f,0x646e3a20,
+0x696e6465,0x78206f75,0x74206f66,0x2072616e,0x67652028,0x2564290a,0x0,0x6c69626d,
+0x6c640000,0x6c69626d,0x6c643a20,0x496e7465,0x726e616c,0x3a206361,0x6e6e6f74,0x20616c6c,
+0x6f636174,0x6520746f,0x20696e69,0x7469616c,0x697a6520,0x636f6d70,0x6f6e656e,0x74206e61,
+0x6d652066,0x6f72206c,0x69626d6c,0x64206572,0x726f7273,0xa000000,0x0,0x0,
+0x73745f66,0x696c6562,0x6567696e,0x3a207472,0x69656420,0x746f2065,0x6e642074,0x6f6f206d,
+0x616e7920,0x66696c65,0x73202825,0x73290a00,0x73745f74,0x65787462,0x6c6f636b,0x3a20626c,
+0x6f636b20,0x70656e64,0x696e6720,0x73657420,0x696e2069,0x6c6c6567,0x616c2063,0x6173650a,
+0x0,0x73745f66,0x696c655f,0x69646e3a,0x20697374,0x61636b20,0x756e6465,0x72666c6f,
+0x77202825,0x73290a00,0x0,0x0,0x73745f66,0x64616464,0x3a206e75,0x6d626572,
+0x206f6620,0x66696c65,0x73202825,0x64292065,0x78636565,0x6473206d,0x61782028,0x2564290a,
+0x0,0x73745f66,0x64616464,0x3a20616c,0x6c6f6361,0x74696f6e,0x20626f74,0x63682028,
+0x25642066,0x64732061,0x6e642025,0x64206366,0x64732920,0x696e2025,0x730a0000,0x0,
+0x3c2f3444,0x65627567,0x2f3e0000,0x3a000000,0x3a000000,0x73745f66,0x64616464,0x3a20636f,
+0x756c6420,0x6e6f7420,0x6d616c6c,0x6f632070,0x61746820,0x6e616d65,0x21212025,0x640a0000,
+0x50574400,0x0,0x43616e6e,0x6f742073,0x745f6664,0x6164643a,0x2063616e,0x6e6f7420,
+0x6d616c6c,0x6f632025,0x64206279,0x74657320,0x746f2068,0x6f6c6420,0x66696c65,0x206e616d,
+0x650a0000,0x2f000000,0x256c7500,0x2d310000,0x256c7500,0x73745f73,0x74726164,0x643a2061,
+0x7267756d,0x656e7420,0x6973206e,0x696c0a00,0x73745f70,0x6175785f,0x6966645f,0x69617578,
+0x3a206966,0x64202825,0x6429206f,0x72206961,0x75782028,0x25642920,0x6f757420,0x6f662072,
+0x616e6765,0xa000000,0x73745f70,0x6175785f,0x6966645f,0x69617578,0x3a206966,0x64202825,
+0x6429206f,0x7220696c,0x696e6520,0x28256429,0x206f7574,0x206f6620,0x72616e67,0x650a0000,
+0x73745f6d,0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,
+0x6f662031,0x20627974,0x65207769,0x7468206d,0x616c6c6f,0x63283329,0xa000000,0x73745f6d,
+0x616c6c6f,0x633a2063,0x616e6e6f,0x7420616c,0x6c6f6361,0x74652069,0x74656d20,0x6f662025,
+0x6c642062,0x79746573,0x20776974,0x68206d61,0x6c6c6f63,0x2833290a,0x0,0x73745f6d,
+0x616c6c6f,0x633a2063,0x616e6e6f,0x74206772,0x6f772069,0x74656d20,0x746f2025,0x6c642062,
+0x79746573,0x20776974,0x68207265,0x616c6c6f,0x63283329,0xa000000,0x0,0x0,
+0x74726965,0x6420746f,0x20726570,0x6c616365,0x20726e64,0x78206175,0x78202825,0x64292074,
+0x68617420,0x66697473,0x20696e74,0x6f206f6e,0x6520776f,0x72642028,0x25642c20,0x25642920,
+0x77697468,0x206f6e65,0x20746861,0x74206361,0x6e277420,0x2825642c,0x2564290a,0x0,
+0x62616420,0x6d616769,0x6320696e,0x20686472,0x2e206578,0x70656374,0x65642030,0x7825782c,
+0x20676f74,0x20307825,0x780a0000,0x73745f72,0x65616473,0x743a2064,0x656e7365,0x206e756d,
+0x62657220,0x696e636f,0x6d706174,0x69626c65,0x2066726f,0x6d207665,0x7273696f,0x6e73206c,
+0x65737320,0x7468616e,0x20312e33,0x302c2070,0x6c656173,0x65207265,0x636f6d70,0x696c6520,
+0x66726f6d,0x20736372,0x61746368,0x20616e64,0x20757365,0x20636f6d,0x70617469,0x626c6520,
+0x636f6d70,0x6f6e656e,0x74730a00,0x73745f72,0x6561643a,0x20657272,0x6f722073,0x65656b69,
+0x6e670a00,0x73745f72,0x6561643a,0x20657272,0x6f722072,0x65616469,0x6e670a00,0x63616e6e,
+0x6f74206f,0x70656e20,0x73796d62,0x6f6c2074,0x61626c65,0x2066696c,0x65202573,0xa000000,
+0x77000000,0x73745f77,0x72697465,0x73743a20,0x63616e6e,0x6f742077,0x72697465,0x20746f20,
+0x66696c65,0x206e756d,0x62657220,0x25640a00,0x63616e6e,0x6f742077,0x72697465,0x20726f75,
+0x6e642062,0x79746573,0x20666f72,0x206c696e,0x65730a00,0x63616e6e,0x6f742077,0x72697465,
+0x20726f75,0x6e642062,0x79746573,0x20666f72,0x20737472,0x696e6773,0xa000000,0x63616e6e,
+0x6f742077,0x72697465,0x20726f75,0x6e642062,0x79746573,0x20666f72,0x20737472,0x696e6773,
+0xa000000,0x63616e6e,0x6f742077,0x72697465,0x2073796d,0x626f6c20,0x68656164,0x65720a00,
+0x73776170,0x206f6620,0x61757873,0x206e6f74,0x20737570,0x706f7274,0x65642077,0x68656e20,
+0x64657374,0x73657820,0x213d2068,0x6f737473,0x65780a00,0xf0400158,0xf0400278,0xf04002ec,
+0xf04002ec,0xf04002ec,0xf04002ec,0xf04002ec,0x40282329,0x24486561,0x6465723a,0x20495249,
+0x5820362e,0x343a3132,0x36333337,0x30353333,0x20627569,0x6c742031,0x312f3132,0x2f393620,
+0x61742073,0x6c617965,0x723a2f73,0x6c617965,0x725f786c,0x76302f66,0x69637573,0x73672d6e,
+0x6f763035,0x2f726f6f,0x74202400,0x0,};
+static const uint32_t data[] = {
+0x0,0x1000e220,0x1000e224,0x1000e230,0x1000e23c,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x10010150,0x10010158,0x10010160,0x10010168,
+0x10010170,0x10010178,0x10010180,0x10010188,0x10010190,0x10010198,0x100101a0,0x100101a8,
+0x100101b0,0x100101b8,0x100101c0,0x100101c8,0x100101d4,0x100101dc,0x100101e4,0x100101f0,
+0x100101f8,0x10010200,0x10010208,0x10010210,0x10010218,0x10010220,0x10010228,0x10010230,
+0x10010238,0x10010240,0x10010248,0x10010250,0x10010258,0x10010260,0x1001026c,0x10010274,
+0x1001027c,0x10010284,0x1001028c,0x10010294,0x1001029c,0x100102a4,0x100102ac,0x100102b8,
+0x100102c0,0x100102cc,0x100102d4,0x100102dc,0x100102e4,0x100102f0,0x100102f8,0x10010300,
+0x10010308,0x10010310,0x1001031c,0x10010328,0x10010334,0x10010340,0x10010350,0x1001035c,
+0x10010364,0x10010370,0x10010378,0x10010380,0x10010384,0x10010388,0x1001038c,0x10010390,
+0x10010394,0x10010398,0x1001039c,0x100103a0,0x100103a4,0x100103a8,0x100103ac,0x100103b0,
+0x100103b4,0x100103b8,0x100103bc,0x100103c0,0x100103c4,0x100103c8,0x100103cc,0x100103d0,
+0x100103d4,0x100103d8,0x100103dc,0x100103e0,0x100103e4,0x100103e8,0x100103ec,0x100103f0,
+0x100103f4,0x100103f8,0x100103fc,0x10010400,0x10010404,0x10010408,0x1001040c,0x10010410,
+0x10010414,0x10010418,0x1001041c,0x10010420,0x10010424,0x10010428,0x10010430,0x10010438,
+0x10010440,0x10010448,0x10010450,0x10010458,0x10010460,0x10010468,0x10010470,0x10010478,
+0x10010480,0x10010488,0x10010490,0x10010498,0x100104a0,0x100104a8,0x100104b0,0x100104b8,
+0x100104c0,0x100104c8,0x100104d0,0x100104d8,0x100104e0,0x100104e8,0x100104f0,0x100104f8,
+0x10010500,0x10010508,0x10010510,0x10010518,0x1001051c,0x10010524,0x10010528,0x1001052c,
+0x10010534,0x1001053c,0x10010540,0x10010544,0x10010548,0x10010550,0x10010554,0x10010558,
+0x10010560,0x10010568,0x1001056c,0x10010570,0x10010578,0x10010580,0x1001058c,0x0,
+0x10010590,0x10010594,0x1001059c,0x100105a8,0x100105b0,0x100105b8,0x100105bc,0x100105c4,
+0x100105cc,0x100105d4,0x100105dc,0x100105e4,0x100105f0,0x100105fc,0x10010608,0x10010614,
+0x10010620,0x10010630,0x10010638,0x10010640,0x10010648,0x10010650,0x0,0x0,
+0x10010658,0x10010664,0x10010670,0x8000420,0x10010674,0x60a0421,0x10010678,0x60a8421,
+0x10010680,0x60c0421,0x10010684,0x10000000,0x10010688,0x101c8000,0x10010690,0x101d0000,
+0x10010698,0x101db000,0x100106a0,0x101e3000,0x100106a8,0x101e8000,0x100106b0,0x101f0000,
+0x100106b8,0x0,0x100106bc,0x0,0x100106c0,0xc258420,0x100106c4,0xc000420,
+0x100106c8,0xc000420,0x100106d0,0xe1b0400,0x100106d8,0xc000420,0x100106dc,0xc000420,
+0x100106e4,0xe270400,0x100106ec,0xc000420,0x100106f0,0xc000420,0x100106f8,0xe268400,
+0x10010700,0xc000420,0x10010704,0xc000420,0x1001070c,0xe1a8400,0x10010714,0xc260420,
+0x10010718,0x58000,0x10010720,0x12318000,0x10010724,0x12320000,0x10010728,0x12328000,
+0x1001072c,0x0,0x10010730,0x6090421,0x10010734,0x6098421,0x1001073c,0xa248400,
+0x10010740,0xa250400,0x10010744,0x2000400,0x10010748,0x2330460,0x1001074c,0x2350460,
+0x10010750,0x2338460,0x10010754,0x2358460,0x10010758,0x4000400,0x1001075c,0x2348460,
+0x10010760,0xa040400,0x10010764,0x2399060,0x1001076c,0x23a0460,0x10010774,0x1e9e0460,
+0x1001077c,0x14060400,0x10010784,0x14070400,0x1001078c,0x8000420,0x10010794,0xa048400,
+0x1001079c,0x23b1060,0x100107a4,0x23b8460,0x100107ac,0x0,0x100107b0,0x14068400,
+0x100107b8,0x14078400,0x100107c0,0x6000421,0x100107c4,0x6000421,0x100107cc,0x6000421,
+0x100107d4,0x8080420,0x100107dc,0x8088420,0x100107e4,0x8000420,0x100107e8,0x8000,
+0x100107ec,0x60d8421,0x100107f0,0x60c8421,0x100107f4,0x6090421,0x100107f8,0x6098421,
+0x10010800,0x498000,0x10010804,0x6000421,0x10010808,0x6000421,0x1001080c,0x2368460,
+0x10010810,0x6000421,0x10010814,0x6000421,0x10010818,0x6000421,0x10010820,0x6000421,
+0x10010824,0x6000421,0x1001082c,0x2370460,0x10010830,0x6000421,0x10010834,0x6000421,
+0x1001083c,0x6010421,0x10010840,0x6000421,0x10010844,0x6000421,0x1001084c,0x6000421,
+0x10010850,0x6020421,0x10010854,0x6018421,0x10010858,0x60b0421,0x1001085c,0x60b8421,
+0x10010864,0x2380460,0x10010868,0x50000,0x10010870,0x60d0421,0x10010874,0x8000420,
+0x10010878,0x2340460,0x1001087c,0x2360460,0x10010880,0x2378460,0x10010884,0x2388460,
+0x10010888,0x0,0x1001088c,0x84584e0,0x10010894,0x8460480,0x1001089c,0x84684e0,
+0x100108a4,0x0,0x100108a8,0x84784e0,0x100108b0,0x8480480,0x100108b8,0x84884e0,
+0x100108c0,0x4c0000,0x100108c8,0x4a0000,0x100108d0,0x4a8000,0x100108d8,0x4b0000,
+0x100108e0,0x4b8000,0x100108e8,0x23c8860,0x100108ec,0x23d0860,0x100108f0,0x0,
+0x100108f4,0x23d9460,0x100108fc,0x23e2060,0x10010904,0x9e8000,0x1001090c,0x9f0000,
+0x10010914,0x23e9460,0x1001091c,0x23f2060,0x10010924,0x0,0x10010928,0x2001460,
+0x1001092c,0x2001460,0x10010930,0x2001860,0x10010934,0x2001460,0x10010938,0x2001460,
+0x1001093c,0x2001860,0x10010940,0x65014a5,0x10010948,0x65094a5,0x10010950,0x65118c6,
+0x10010958,0x65194a5,0x10010960,0x65214a5,0x10010968,0x65298c6,0x10010970,0x65314a5,
+0x10010978,0x65394a5,0x10010980,0x65418c6,0x10010988,0x65494a5,0x10010990,0x65514a5,
+0x10010998,0x65598c6,0x100109a0,0x80014a0,0x100109a8,0x80014a0,0x100109b0,0x80018c0,
+0x100109b8,0x80014a0,0x100109c0,0x80014a0,0x100109c8,0x80018c0,0x100109d0,0x80014a0,
+0x100109d8,0x80014a0,0x100109e0,0x80018c0,0x100109e8,0x80014a0,0x100109f0,0x80014c0,
+0x100109f8,0x80014a0,0x10010a00,0x80014a0,0x10010a08,0x80014c0,0x10010a10,0x80014a0,
+0x10010a18,0x80018a0,0x10010a20,0x80018a0,0x10010a28,0x80018a0,0x10010a30,0x80014a0,
+0x10010a38,0x80014a0,0x10010a40,0x80014c0,0x10010a48,0x80030a5,0x10010a50,0x80030a5,
+0x10010a58,0x80030c6,0x10010a60,0x80030a5,0x10010a68,0x80030a5,0x10010a70,0x80030c6,
+0x10010a78,0x80030a5,0x10010a80,0x80030a5,0x10010a88,0x80030c6,0x10010a90,0x80030a5,
+0x10010a98,0x80030a5,0x10010aa0,0x80030c6,0x10010aa8,0x80030a5,0x10010ab0,0x80030a5,
+0x10010ab8,0x80030c6,0x10010ac0,0x80030a5,0x10010ac8,0x80030a5,0x10010ad0,0x80030c6,
+0x10010ad8,0x80030a5,0x10010ae0,0x80030a5,0x10010ae8,0x80030c6,0x10010af0,0x80030a5,
+0x10010af8,0x80030a5,0x10010b00,0x80030c6,0x10010b08,0x80030a5,0x10010b10,0x80030a5,
+0x10010b18,0x80030c6,0x10010b20,0x80030a5,0x10010b2c,0x80030a5,0x10010b38,0x80030c6,
+0x10010b44,0x80030a5,0x10010b4c,0x80030a5,0x10010b54,0x80030c6,0x10010b5c,0x80030a5,
+0x10010b64,0x80030a5,0x10010b6c,0x80030c6,0x10010b74,0x80030a5,0x10010b7c,0x80030a5,
+0x10010b84,0x80030c6,0x10010b8c,0x80030a5,0x10010b94,0x80030a5,0x10010b9c,0x80030c6,
+0x10010ba4,0x80030a5,0x10010bac,0x80030a5,0x10010bb4,0x80030c6,0x10010bbc,0x80030a5,
+0x10010bc4,0x80030a5,0x10010bcc,0x80030c6,0x10010bd4,0x42d0400,0x10010bd8,0x2000460,
+0x10010bdc,0x2000460,0x10010be0,0x2000460,0x10010be8,0x2000460,0x10010bec,0x2000460,
+0x10010bf0,0x6298420,0x10010bf8,0x62a0420,0x10010c00,0x62a8420,0x10010c08,0x62b0420,
+0x10010c10,0x62b8420,0x10010c18,0x62c0420,0x10010c1c,0x62c8420,0x10010c24,0x0,
+0x10010c28,0x8000420,0x10010c30,0xe258400,0x10010c38,0xe260400,0x10010c40,0x80014a0,
+0x10010c48,0x80014a0,0x10010c50,0x80018c0,0x10010c58,0x84704e0,0x10010c60,0x84904e0,
+0x10010c68,0xe1c0000,0x10010c6c,0xe1c0400,0x10010c74,0xe1b8400,0x10010c7c,0x84808a0,
+0x10010c84,0x84608a0,0x10010c8c,0x60014a1,0x10010c98,0x60014a1,0x10010ca4,0x60018c1,
+0x10010cb0,0x60014a1,0x10010cbc,0x60014a1,0x10010cc8,0x60018c1,0x10010cd4,0x60a8421,
+0x10010cdc,0x60b8421,0x10010ce4,0x60014a1,0x10010cf0,0x60014a1,0x10010cfc,0x60018c1,
+0x10010d08,0x60014a1,0x10010d14,0x60014a1,0x10010d20,0x60018c1,0x10010d2c,0x87a04e0,
+0x10010d34,0x87a84e0,0x10010d3c,0x0,0x10010d40,0x87b04e0,0x10010d48,0x87b84e0,
+0x10010d50,0x0,0x10010d54,0x167c2400,0x10010d5c,0x167ca800,0x10010d64,0x167d2c00,
+0x10010d6c,0x1a0f0420,0x10010d70,0x1a0f8420,0x10010d78,0x1a100420,0x10010d7c,0x1a108420,
+0x10010d84,0x1a110420,0x10010d88,0x1a118420,0x10010d8c,0x2390460,0x10010d90,0x23a8460,
+0x10010d94,0x60014a1,0x10010da0,0x60014a1,0x10010dac,0x60018c1,0x10010db8,0x60014a1,
+0x10010dc4,0x60014a1,0x10010dd0,0x60018c1,0x10010ddc,0x60014a1,0x10010de8,0x60014a1,
+0x10010df4,0x60018c1,0x10010e00,0x60014a1,0x10010e0c,0x60014a1,0x10010e18,0x60018c1,
+0x10010e24,0xc278420,0x10010e2c,0xe278400,0x10010e34,0xc280420,0x10010e3c,0xe280400,
+0x10010e44,0xc000420,0x10010e4c,0xc000420,0x10010e54,0xe288400,0x10010e5c,0xc000420,
+0x10010e64,0xc000420,0x10010e6c,0xe290400,0x10010e74,0xc000420,0x10010e7c,0xc000420,
+0x10010e84,0xe1f8400,0x10010e8c,0xe208400,0x10010e94,0xc000420,0x10010e9c,0xc000420,
+0x10010ea4,0xe200400,0x10010eac,0xe210400,0x10010eb4,0x10218000,0x10010ebc,0x10220000,
+0x10010ec4,0x1022b000,0x10010ecc,0x10233000,0x10010ed4,0x10238000,0x10010edc,0x10240000,
+0x10010ee4,0x0,0x10010ee8,0x0,0x10010eec,0x23f8460,0x10010ef0,0x2400460,
+0x10010ef4,0x2408460,0x10010ef8,0x23c0460,0x10010efc,0x2410460,0x10010f00,0x2418460,
+0x10010f04,0x2420460,0x10010f08,0x6308420,0x10010f10,0x6310420,0x10010f18,0x6120421,
+0x10010f20,0x6128421,0x10010f28,0x6130421,0x10010f30,0x6138421,0x10010f38,0x6140421,
+0x10010f40,0x6148421,0x10010f48,0x6150421,0x10010f50,0x6170421,0x10010f58,0x6178421,
+0x10010f60,0x6180421,0x10010f68,0x8188420,0x10010f70,0x8190420,0x10010f78,0x6000421,
+0x10010f80,0x6000421,0x10010f88,0x0,0x10010f8c,0x0,0x10010f90,0x84c8480,
+0x10010f98,0x84d0480,0x10010fa0,0x84d84e0,0x10010fa8,0x84e04e0,0x10010fb0,0x84e84e0,
+0x10010fb8,0x84f04e0,0x10010fc0,0x1c000400,0x10010fc4,0x2000400,0x10010fc8,0x8d8000,
+0x10010fd0,0x6001081,0x10010fdc,0x6001081,0x10010fe8,0x6001081,0x10010ff4,0x6001081,
+0x10011000,0x6001081,0x1001100c,0x6001081,0x10011018,0x6001081,0x10011024,0x6001081,
+0x10011030,0x60010a1,0x1001103c,0x60010a1,0x10011048,0x60010a1,0x10011054,0x60010a1,
+0x10011060,0x8001080,0x10011068,0x8001080,0x10011070,0x80010a0,0x10011078,0x8001080,
+0x10011080,0x8001080,0x10011088,0x8001080,0x10011090,0x8001480,0x10011098,0x8001080,
+0x100110a0,0x1e4f8460,0x100110a8,0x4000000,0x100110ac,0x2000460,0x100110b0,0x2000460,
+0x100110b4,0x8000420,0x100110bc,0x8000420,0x100110c4,0x8000420,0x100110cc,0x6000421,
+0x100110d4,0x6000421,0x100110dc,0x6000421,0x100110e4,0x6000421,0x100110ec,0x6000421,
+0x100110f4,0x6000421,0x100110fc,0x6000421,0x10011104,0x6128421,0x1001110c,0x6138421,
+0x10011114,0x2000460,0x1001111c,0x600042c,0x10011124,0x600042c,0x1001112c,0x6000421,
+0x10011134,0x6000421,0x1001113c,0x20001084,0x10011144,0x20001084,0x1001114c,0x200018c6,
+0x10011154,0x20001084,0x1001115c,0x20001084,0x10011164,0x200018c6,0x1001116c,0x20001084,
+0x10011174,0x20001084,0x1001117c,0x200018c6,0x10011184,0x20001084,0x1001118c,0x20001084,
+0x10011194,0x200018c6,0x1001119c,0x8001080,0x100111a4,0x8001080,0x100111ac,0x8001080,
+0x100111b4,0x8001080,0x100111bc,0x600108c,0x100111c4,0x600108c,0x100111cc,0x600108c,
+0x100111d4,0x600108c,0x100111dc,0x6001081,0x100111e4,0x6001081,0x100111ec,0x6001081,
+0x100111f4,0x6001081,0x100111fc,0x22001021,0x10011204,0x22001021,0x1001120c,0x22001021,
+0x10011214,0x22001021,0x1001121c,0x22000421,0x10011224,0x0,0x1001122c,0x0,
+0x10011234,0x0,0x1001123c,0x0,0x10011244,0x0,0x1001124c,0x6140421,
+0x10011254,0x6148421,0x1001125c,0x6150421,0x10011264,0x109f8000,0x1001126c,0x10a00000,
+0x10011274,0x12a08000,0x10011278,0x2a10460,0x10011280,0x2a18460,0x10011288,0x8a204e0,
+0x10011290,0x8a284e0,0x10011298,0x8a304e0,0x100112a0,0x8a384e0,0x100112a8,0x6028421,
+0x100112b0,0x6030421,0x100112b8,0x6038421,0x100112c0,0x8a404e0,0x100112c8,0x8a404e0,
+0x100112d0,0x8a404e0,0x100112d8,0x8a404e0,0x100112e0,0x0,0x0,0x0,
+0x2,0x1,0x0,0x3,0x0,0x0,0x10011330,0x1001133c,
+0x10011344,0x1001134c,0x10011354,0x100113cc,0x100113d0,0x100113d4,0x100113d8,0x100113dc,
+0x100113e0,0x100113e4,0x100113e8,0x100113ec,0x100113f0,0x100113f4,0x100113f8,0x100113fc,
+0x10011404,0x10011408,0x1001140c,0x10011410,0x10011414,0x1001141c,0x10011420,0x10011424,
+0x10011428,0x1001142c,0x10011430,0x10011434,0x10011438,0x1001143c,0x10011440,0x10011444,
+0x10011448,0x1001144c,0x10011450,0x10011454,0x10011458,0x1001145c,0x10011460,0x10011464,
+0x10011468,0x1001146c,0x10011470,0x10011474,0x10011478,0x1001147c,0x10011480,0x10011490,
+0x100114a0,0x100114b4,0x100114c8,0x100114dc,0x100114e4,0x100114ec,0x100114f4,0x100114fc,
+0x10011504,0x1001150c,0x10011518,0x10011524,0x10011530,0x10011540,0x1001154c,0x10011558,
+0x10011560,0x10011568,0x10011570,0x1001157c,0x10011588,0x10011590,0x10011598,0x100115a4,
+0x100115b0,0x100115b8,0x100115c4,0x100115cc,0x100115d8,0x100115e0,0x100115ec,0x100115f4,
+0x10011604,0x10011610,0x10011618,0x10011624,0x1001162c,0x10011634,0x1001163c,0x10011648,
+0x10011650,0x1001165c,0x10011668,0x10011670,0x10011678,0x10011680,0x1001168c,0x10011694,
+0x1001169c,0x100116a4,0x100116b0,0x100116c0,0x100116d4,0x100116e0,0x100116e8,0x100116f4,
+0x10011708,0x10011710,0x10011718,0x10011720,0x10011728,0x10011734,0x10011740,0x10011750,
+0x1001175c,0x0,0x0,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,0x61646420,0x746f2074,0x68697320,0x656e7472,
+0x79206974,0x20776173,0x20726561,0x64696e20,0x66726f6d,0x20646973,0x6b0a0000,0x0,
+0x726f7574,0x696e653a,0x20796f75,0x20646964,0x6e277420,0x696e6974,0x69616c69,0x7a652077,
+0x69746820,0x73745f63,0x75696e69,0x74206f72,0x2073745f,0x72656164,0x73740a00,0x726f7574,
+0x696e653a,0x206e6f20,0x63757272,0x656e7420,0x726f7574,0x696e652c,0x20736565,0x20666461,
+0x6464206f,0x72207365,0x7466640a,0x0,0x10011bdc,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x726f7574,0x696e653a,0x20796f75,0x20646964,
+0x6e277420,0x696e6974,0x69616c69,0x7a652077,0x69746820,0x73745f63,0x75696e69,0x74206f72,
+0x2073745f,0x72656164,0x73740a00,0x726f7574,0x696e653a,0x206e6f20,0x63757272,0x656e7420,
+0x726f7574,0x696e652c,0x20736565,0x20666461,0x6464206f,0x72207365,0x7466640a,0x0,
+0x726f7574,0x696e653a,0x2063616e,0x6e6f7420,0x61646420,0x746f2074,0x68697320,0x656e7472,
+0x79206974,0x20776173,0x20726561,0x64696e20,0x66726f6d,0x20646973,0x6b0a0000,0x0,
+0x0,0x0,0x0,0x0,0x70090000,0x63616e6e,0x6f742077,0x72697465,
+0x20706669,0x656c6400,0x63616e6e,0x6f742077,0x72697465,0x20637572,0x20746162,0x6c650a00,
+0x0,0x0,0x0,0x0,};
+static void func_404100(uint8_t *mem, uint32_t sp);
+static void func_4041e8(uint8_t *mem, uint32_t sp);
+static uint32_t func_4042e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_404374(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_4043fc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_404c80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_405264(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_4055c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_405650(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4056a8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4057a4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_405930(uint8_t *mem, uint32_t sp);
+static void func_40599c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_405b20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_405be0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_405ca0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_405e5c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40606c(uint8_t *mem, uint32_t sp);
+static void func_406208(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_406624(uint8_t *mem, uint32_t sp);
+static void func_4066b4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406b58(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_406ea8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4071b0(uint8_t *mem, uint32_t sp);
+static void func_407410(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4074d8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_407808(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4081bc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_408300(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_408408(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4085a4(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_408928(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_408d54(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_408f2c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40941c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_4096a8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409a0c(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409b00(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409b70(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_409bf4(uint8_t *mem, uint32_t sp);
+static void func_409c80(uint8_t *mem, uint32_t sp);
+static void func_409d24(uint8_t *mem, uint32_t sp);
+static void func_409d94(uint8_t *mem, uint32_t sp);
+static void func_409f98(uint8_t *mem, uint32_t sp);
+static void func_40a010(uint8_t *mem, uint32_t sp);
+static void func_40a0a8(uint8_t *mem, uint32_t sp);
+static void func_40a174(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a248(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a3c8(uint8_t *mem, uint32_t sp);
+static void func_40a530(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40a804(uint8_t *mem, uint32_t sp);
+static void func_40a8e0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40aac0(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40acb4(uint8_t *mem, uint32_t sp);
+static void f_do_dot_end(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40ae98(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40af20(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40b238(uint8_t *mem, uint32_t sp);
+static void func_40b4f0(uint8_t *mem, uint32_t sp);
+static void func_40b67c(uint8_t *mem, uint32_t sp);
+static uint32_t func_40b890(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void func_40b9f4(uint8_t *mem, uint32_t sp);
+static void func_40bba8(uint8_t *mem, uint32_t sp);
+static void func_40bc64(uint8_t *mem, uint32_t sp);
+static void func_40bcdc(uint8_t *mem, uint32_t sp);
+static void func_40bd54(uint8_t *mem, uint32_t sp);
+static void func_40bdcc(uint8_t *mem, uint32_t sp);
+static void func_40be34(uint8_t *mem, uint32_t sp);
+static void func_40bf34(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40bfb0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_40c140(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40c224(uint8_t *mem, uint32_t sp);
+static void func_40c2c4(uint8_t *mem, uint32_t sp);
+static uint32_t func_40c518(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40c5a0(uint8_t *mem, uint32_t sp);
+static void func_40c6a8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40c760(uint8_t *mem, uint32_t sp);
+static void func_40c828(uint8_t *mem, uint32_t sp);
+static void func_40c978(uint8_t *mem, uint32_t sp);
+static void func_40cac8(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_Parsestmt(uint8_t *mem, uint32_t sp);
+static void func_40d760(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_sym_undefined(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void func_40d810(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40d9c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40db08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_40dcec(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_sym_init(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_sym_finish(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_sym_enter(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_sym_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_feinit(uint8_t *mem, uint32_t sp);
+static uint32_t f_hex_to_num(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_local_label(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_unscan(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_make_file(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t func_40eafc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint64_t func_40eca0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_hash(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_LookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_opLookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_40f030(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_consume(uint8_t *mem, uint32_t sp);
+static uint32_t func_40f11c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40f278(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40f56c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_40f640(uint8_t *mem, uint32_t sp);
+static void func_40f6f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_dot_soon(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_nexttoken(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_410224(uint8_t *mem, uint32_t sp);
+static void f_readinline(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloc_new_sym(uint8_t *mem, uint32_t sp);
+static uint32_t f_alloc_new_string(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_EnterSym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_GetRegister(uint8_t *mem, uint32_t sp);
+static uint32_t func_410ba0(uint8_t *mem, uint32_t sp);
+static uint64_t func_410e3c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_411128(uint8_t *mem, uint32_t sp);
+static void func_411388(uint8_t *mem, uint32_t sp);
+static uint64_t func_411390(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t func_411664(uint8_t *mem, uint32_t sp);
+static uint64_t func_411750(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_GetExpr(uint8_t *mem, uint32_t sp);
+static uint32_t f_dw_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_GetBaseOrExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_dw_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_put_binasmfyle(uint8_t *mem, uint32_t sp);
+static void f_ltoa(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void func_4121b0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void func_412350(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_call_name_and_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_call_perror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_new_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_posterror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_postcerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_assertion_failed(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_which_opt(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_grow_array(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_cuinit(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_extadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_extstradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_filebegin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_endallfiles(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_procend(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_st_procbegin(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_sym_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_pdadd_idn(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp);
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_fdadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp);
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_auxbtadd(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_st_auxisymadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t func_418698(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void f_st_writebinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_st_writest(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp);
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0);
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0);
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1);
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2);
+int run(uint8_t *mem, int argc, char *argv[]) {
+mmap_initial_data_range(mem, 0xff00000, 0x10020000);
+memcpy(mem + 0x1000e000, rodata, 0x41f0);
+memcpy(mem + 0x100121f0, data, 0x14b0);
+MEM_S32(0x10015538) = argc;
+MEM_S32(0xffffff0) = argc;
+uint32_t al = argc * 4; for (int i = 0; i < argc; i++) al += strlen(argv[i]) + 1;
+uint32_t arg_addr = wrapper_malloc(mem, al);
+MEM_U32(0x10015530) = arg_addr;
+MEM_U32(0xffffff4) = arg_addr;
+uint32_t arg_strpos = arg_addr + argc * 4;
+for (int i = 0; i < argc; i++) {MEM_U32(arg_addr + i * 4) = arg_strpos; uint32_t p = 0; do { MEM_S8(arg_strpos) = argv[i][p]; ++arg_strpos; } while (argv[i][p++] != '\0');}
+setup_libc_data(mem);
+int ret = f_main(mem, 0xffffff0, argc, arg_addr);
+return ret;
+}
+
+static void func_404100(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, t8 = 0, t9 = 0;
+L404100:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+// fdead 4000000b MEM_U32(sp + 36) = s4;
+// fdead 4000000b MEM_U32(sp + 28) = s2;
+// fdead 4000000b MEM_U32(sp + 24) = s1;
+// fdead 4000000b MEM_U32(sp + 52) = ra;
+// fdead 4000000b MEM_U32(sp + 48) = gp;
+// fdead 4000000b MEM_U32(sp + 32) = s3;
+// fdead 4000000b MEM_U32(sp + 20) = s0;
+s1 = zero;
+s2 = 0x100124f8;
+s4 = 0x10014d50;
+s5 = 0x1;
+s6 = 0x1ae;
+L404148:
+s0 = MEM_U32(s2 + 0);
+t6 = MEM_U8(s0 + 0);
+if (t6 == zero) {
+s1 = s1 + 0x1;
+goto L4041b8;}
+//nop;
+a0 = s0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 40ee000b gp = MEM_U32(sp + 48);
+s3 = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+t7 = s3 << 2;
+v1 = s4 + t7;
+t8 = MEM_U32(v1 + 0);
+// bdead 42ee001b gp = MEM_U32(sp + 48);
+MEM_U32(v0 + 4) = s0;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 8) = zero;
+MEM_U32(v0 + 16) = s5;
+MEM_U32(v0 + 20) = s1;
+MEM_U32(v0 + 0) = t8;
+t9 = MEM_U32(s2 + 4);
+t0 = t9 >> 25;
+MEM_U32(v0 + 24) = t0;
+MEM_U32(v1 + 0) = v0;
+s1 = s1 + 0x1;
+L4041b8:
+s2 = s2 + 0x8;
+if (s1 != s6) goto L404148;
+// bdead 1 ra = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static void func_4041e8(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, fp = 0;
+L4041e8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000000b MEM_U32(sp + 56) = fp;
+// fdead 4000000b MEM_U32(sp + 48) = s7;
+// fdead 4000000b MEM_U32(sp + 44) = s6;
+// fdead 4000000b MEM_U32(sp + 40) = s5;
+// fdead 4000000b MEM_U32(sp + 36) = s4;
+// fdead 4000000b MEM_U32(sp + 28) = s2;
+// fdead 4000000b MEM_U32(sp + 24) = s1;
+// fdead 4000000b MEM_U32(sp + 60) = ra;
+// fdead 4000000b MEM_U32(sp + 52) = gp;
+// fdead 4000000b MEM_U32(sp + 32) = s3;
+// fdead 4000000b MEM_U32(sp + 20) = s0;
+s1 = zero;
+s2 = 0x10012220;
+s4 = 0x2e;
+s5 = 0x10014d50;
+s6 = 0xffffffff;
+s7 = 0x2;
+fp = 0x3f;
+L404240:
+v0 = MEM_U32(s2 + 0);
+t6 = MEM_U8(v0 + 0);
+if (s4 != t6) {
+s1 = s1 + 0x1;
+goto L4042a8;}
+//nop;
+s0 = v0;
+a0 = v0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead c1ee000b gp = MEM_U32(sp + 52);
+s3 = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+t7 = s3 << 2;
+v1 = s5 + t7;
+t8 = MEM_U32(v1 + 0);
+// bdead c3ee001b gp = MEM_U32(sp + 52);
+MEM_U32(v0 + 4) = s0;
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 8) = s6;
+MEM_U32(v0 + 16) = s7;
+MEM_U32(v0 + 20) = s1;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(v1 + 0) = v0;
+s1 = s1 + 0x1;
+L4042a8:
+s2 = s2 + 0x4;
+if (s1 != fp) goto L404240;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static uint32_t func_4042e0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L4042e0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+a0 = a1;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+t8 = 0x10014b48;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+t0 = MEM_U32(sp + 44);
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 16) = zero;
+MEM_U32(v0 + 4) = t0;
+t1 = MEM_U32(sp + 48);
+MEM_U32(v0 + 8) = t1;
+t2 = MEM_U32(sp + 40);
+MEM_U32(v0 + 20) = t2;
+// bdead 19 ra = MEM_U32(sp + 28);
+MEM_U32(v1 + 0) = v0;
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_404374(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L404374:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+t1 = 0x4;
+t8 = 0x10014b48;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+t0 = MEM_U32(sp + 40);
+MEM_U32(v0 + 12) = zero;
+MEM_U32(v0 + 16) = t1;
+MEM_U32(v0 + 4) = t0;
+t2 = MEM_U32(sp + 44);
+MEM_U32(v0 + 8) = t2;
+// bdead 19 ra = MEM_U32(sp + 28);
+MEM_U32(v1 + 0) = v0;
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_4043fc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L4043fc:
+//nop;
+//nop;
+//nop;
+at = 0x1001537c;
+t6 = 0x1000e000;
+sp = sp + 0xffffffa0;
+MEM_U32(at + 0) = zero;
+at = 0x10015380;
+t6 = t6;
+// fdead 40008067 MEM_U32(sp + 32) = s2;
+MEM_U32(at + 0) = t6;
+at = 0x10015384;
+s2 = 0x1;
+t7 = 0xffffffff;
+MEM_U32(at + 0) = zero;
+at = 0x10015388;
+t8 = 0x4;
+// fdead 42098067 MEM_U32(sp + 52) = s7;
+MEM_U32(at + 0) = zero;
+at = 0x10015378;
+s7 = 0x10013a48;
+// fdead 43098067 MEM_U32(sp + 36) = s3;
+MEM_U32(at + 0) = zero;
+at = 0x10013a40;
+// fdead 43098067 MEM_U32(sp + 60) = ra;
+// fdead 43098067 MEM_U32(sp + 56) = gp;
+MEM_U32(at + 0) = s2;
+at = 0x10013ea4;
+// fdead 43098067 MEM_U32(sp + 48) = s6;
+// fdead 43098067 MEM_U32(sp + 44) = s5;
+MEM_U32(at + 0) = zero;
+at = 0x10013ea0;
+// fdead 43098067 MEM_U32(sp + 40) = s4;
+// fdead 43098067 MEM_U32(sp + 28) = s1;
+MEM_U32(at + 0) = t7;
+at = 0x10013a78;
+// fdead 43098067 MEM_U32(sp + 24) = s0;
+s3 = s2;
+MEM_U32(at + 0) = zero;
+at = 0x10014ac4;
+MEM_U32(at + 0) = t8;
+at = 0x10013a44;
+MEM_U32(at + 0) = zero;
+at = 0x10013a4c;
+MEM_U32(at + 0) = s2;
+at = 0x10013a50;
+MEM_U32(s7 + 0) = zero;
+MEM_U32(at + 0) = zero;
+at = 0x10013a58;
+MEM_U32(at + 0) = zero;
+at = 0x10013a5c;
+MEM_U32(at + 0) = zero;
+at = 0x10013a70;
+MEM_U32(at + 0) = s2;
+at = 0x10013a74;
+MEM_U32(at + 0) = zero;
+at = 0x10015368;
+MEM_U32(at + 0) = zero;
+t9 = a0 << 2;
+if ((int)a0 < (int)0x2) goto L404710;
+t0 = t9 + a1;
+MEM_U32(sp + 64) = t0;
+s1 = a1 + 0x4;
+MEM_U32(sp + 96) = a0;
+s6 = 0x10013a38;
+s5 = 0x10013a34;
+s4 = 0x10013a3c;
+a1 = MEM_U32(s1 + 0);
+L404510:
+at = 0x2d;
+t1 = MEM_U8(a1 + 0);
+s0 = a1;
+//nop;
+if (t1 != at) goto L4046c8;
+//nop;
+a0 = s0;
+//nop;
+v0 = f_which_opt(mem, sp, a0);
+t2 = v0 + 0xfffffffe;
+// bdead 41fe0983 gp = MEM_U32(sp + 56);
+if (t2 >= 0x6c) goto L4046fc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L404638;
+case 1: goto L4046fc;
+case 2: goto L4046fc;
+case 3: goto L4046fc;
+case 4: goto L4046fc;
+case 5: goto L4046fc;
+case 6: goto L4046fc;
+case 7: goto L4046fc;
+case 8: goto L4046fc;
+case 9: goto L4046fc;
+case 10: goto L404638;
+case 11: goto L4046fc;
+case 12: goto L4046fc;
+case 13: goto L4046fc;
+case 14: goto L4046fc;
+case 15: goto L4046fc;
+case 16: goto L4046fc;
+case 17: goto L4046fc;
+case 18: goto L4046fc;
+case 19: goto L4046fc;
+case 20: goto L4046fc;
+case 21: goto L4046fc;
+case 22: goto L404570;
+case 23: goto L404560;
+case 24: goto L404568;
+case 25: goto L404570;
+case 26: goto L40457c;
+case 27: goto L4046fc;
+case 28: goto L404640;
+case 29: goto L404598;
+case 30: goto L404588;
+case 31: goto L404590;
+case 32: goto L404598;
+case 33: goto L4045a0;
+case 34: goto L4046fc;
+case 35: goto L404608;
+case 36: goto L4045cc;
+case 37: goto L4045a8;
+case 38: goto L4045a8;
+case 39: goto L4045b4;
+case 40: goto L4045c0;
+case 41: goto L4046fc;
+case 42: goto L4046fc;
+case 43: goto L4046fc;
+case 44: goto L4046fc;
+case 45: goto L4046fc;
+case 46: goto L404680;
+case 47: goto L40468c;
+case 48: goto L404698;
+case 49: goto L4046a4;
+case 50: goto L4046fc;
+case 51: goto L4046fc;
+case 52: goto L4046fc;
+case 53: goto L4046fc;
+case 54: goto L4046fc;
+case 55: goto L4046fc;
+case 56: goto L404654;
+case 57: goto L4046fc;
+case 58: goto L4046fc;
+case 59: goto L4046fc;
+case 60: goto L4046fc;
+case 61: goto L4046fc;
+case 62: goto L4046fc;
+case 63: goto L4046fc;
+case 64: goto L4046fc;
+case 65: goto L4046fc;
+case 66: goto L4046fc;
+case 67: goto L404638;
+case 68: goto L4046fc;
+case 69: goto L4046fc;
+case 70: goto L4046fc;
+case 71: goto L404638;
+case 72: goto L4046fc;
+case 73: goto L4046fc;
+case 74: goto L4046fc;
+case 75: goto L4046fc;
+case 76: goto L4046fc;
+case 77: goto L4046fc;
+case 78: goto L4046fc;
+case 79: goto L4046bc;
+case 80: goto L4046b0;
+case 81: goto L4046fc;
+case 82: goto L4046fc;
+case 83: goto L4046fc;
+case 84: goto L40461c;
+case 85: goto L4046fc;
+case 86: goto L4046fc;
+case 87: goto L4046fc;
+case 88: goto L4046fc;
+case 89: goto L4046fc;
+case 90: goto L4046fc;
+case 91: goto L4046fc;
+case 92: goto L4046fc;
+case 93: goto L404638;
+case 94: goto L4046fc;
+case 95: goto L4046fc;
+case 96: goto L4046fc;
+case 97: goto L4046fc;
+case 98: goto L4046fc;
+case 99: goto L4046fc;
+case 100: goto L4046fc;
+case 101: goto L4046fc;
+case 102: goto L4046fc;
+case 103: goto L4046fc;
+case 104: goto L4046fc;
+case 105: goto L4046fc;
+case 106: goto L4046fc;
+case 107: goto L404660;
+}
+L404560:
+MEM_U32(s7 + 0) = zero;
+goto L4046fc;
+L404568:
+MEM_U32(s7 + 0) = s2;
+goto L4046fc;
+L404570:
+t3 = 0x2;
+MEM_U32(s7 + 0) = t3;
+goto L4046fc;
+L40457c:
+t4 = 0x3;
+MEM_U32(s7 + 0) = t4;
+goto L4046fc;
+L404588:
+s3 = zero;
+goto L4046fc;
+L404590:
+s3 = s2;
+goto L4046fc;
+L404598:
+s3 = 0x2;
+goto L4046fc;
+L4045a0:
+s3 = 0x3;
+goto L4046fc;
+L4045a8:
+MEM_U32(s5 + 0) = s2;
+MEM_U32(s6 + 0) = zero;
+goto L4046fc;
+L4045b4:
+MEM_U32(s5 + 0) = zero;
+MEM_U32(s6 + 0) = s2;
+goto L4046fc;
+L4045c0:
+MEM_U32(s5 + 0) = s2;
+MEM_U32(s6 + 0) = s2;
+goto L4046fc;
+L4045cc:
+//nop;
+at = 0x10013a44;
+a0 = 0xfb4ee44;
+a1 = 0x1000e008;
+MEM_U32(at + 0) = s2;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 41fc0003 gp = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+v0 = wrapper_fflush(mem, a0);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+goto L4046fc;
+L404608:
+t5 = MEM_U32(s1 + 4);
+at = 0x10015384;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t5;
+goto L4046fc;
+L40461c:
+t6 = MEM_U32(s1 + 4);
+at = 0x10015388;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t6;
+at = 0x10015378;
+MEM_U32(at + 0) = s2;
+goto L4046fc;
+L404638:
+s1 = s1 + 0x4;
+goto L4046fc;
+L404640:
+t7 = MEM_U32(s1 + 4);
+at = 0x10015380;
+s1 = s1 + 0x4;
+MEM_U32(at + 0) = t7;
+goto L4046fc;
+L404654:
+at = 0x10013a74;
+MEM_U32(at + 0) = s2;
+goto L4046fc;
+L404660:
+//nop;
+a0 = 0x1000e010;
+a1 = s0;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+goto L4046fc;
+L404680:
+t8 = 0x1;
+MEM_U8(s4 + 0) = (uint8_t)t8;
+goto L4046fc;
+L40468c:
+t9 = 0x2;
+MEM_U8(s4 + 0) = (uint8_t)t9;
+goto L4046fc;
+L404698:
+t0 = 0x3;
+MEM_U8(s4 + 0) = (uint8_t)t0;
+goto L4046fc;
+L4046a4:
+t1 = 0x4;
+MEM_U8(s4 + 0) = (uint8_t)t1;
+goto L4046fc;
+L4046b0:
+at = 0x10015368;
+MEM_U32(at + 0) = s2;
+goto L4046fc;
+L4046bc:
+at = 0x1001536c;
+MEM_U32(at + 0) = s2;
+goto L4046fc;
+L4046c8:
+t2 = 0x1001537c;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 != 0) goto L4046e4;
+at = 0x1001537c;
+MEM_U32(at + 0) = a1;
+goto L4046fc;
+L4046e4:
+//nop;
+a0 = 0x1000e020;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fc0103 gp = MEM_U32(sp + 56);
+L4046fc:
+t3 = MEM_U32(sp + 64);
+s1 = s1 + 0x4;
+if (s1 < t3) {
+a1 = MEM_U32(s1 + 0);
+goto L404510;}
+L404710:
+s4 = 0x10013a3c;
+at = (int)s3 < (int)0x2;
+t4 = MEM_U8(s4 + 0);
+t5 = 0x1;
+if (t4 != 0) goto L404728;
+MEM_U8(s4 + 0) = (uint8_t)t5;
+L404728:
+t6 = 0x2;
+if (at != 0) goto L404734;
+MEM_U32(s7 + 0) = t6;
+L404734:
+//nop;
+a0 = 0x10015380;
+a1 = 0x1000e040;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4108010b gp = MEM_U32(sp + 56);
+v1 = 0x10015360;
+MEM_U32(v1 + 0) = v0;
+if (v0 != 0) goto L404788;
+//nop;
+a1 = 0x10015380;
+a0 = s2;
+a1 = MEM_U32(a1 + 0);
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 41080003 gp = MEM_U32(sp + 56);
+a0 = s2;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41080103 gp = MEM_U32(sp + 56);
+L404788:
+t8 = 0x10015378;
+at = 0x10013a30;
+t8 = MEM_U32(t8 + 0);
+MEM_U32(at + 0) = s2;
+//nop;
+if (t8 == 0) goto L404808;
+a2 = 0x10015388;
+a2 = MEM_U32(a2 + 0);
+//nop;
+if (a2 == 0) goto L4047dc;
+//nop;
+a1 = 0x1000e044;
+a0 = a2;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4100010b gp = MEM_U32(sp + 56);
+v1 = 0x10015374;
+MEM_U32(v1 + 0) = v0;
+if (v0 != 0) goto L404808;
+a2 = 0x10015388;
+a2 = MEM_U32(a2 + 0);
+L4047dc:
+//nop;
+a0 = 0x1;
+a1 = a2;
+//nop;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+L404808:
+v0 = 0x10015350;
+t3 = 0x7;
+t4 = 0xa;
+t0 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 8) = t3;
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x2a;
+MEM_U8(v0 + 5) = (uint8_t)t2;
+MEM_U32(v0 + 12) = t4;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41000003 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s7 + 0);
+//nop;
+//nop;
+f_sym_init(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1001537c;
+a0 = MEM_U32(a0 + 0);
+//nop;
+if (a0 == 0) goto L4048bc;
+//nop;
+a1 = 0x1000e048;
+a1 = a1;
+v0 = wrapper_fopen(mem, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 56);
+a0 = v0;
+s0 = 0x10015364;
+MEM_U32(s0 + 0) = v0;
+if (v0 != 0) goto L4048c8;
+//nop;
+a1 = 0x1001537c;
+a0 = 0x1;
+a1 = MEM_U32(a1 + 0);
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+a0 = MEM_U32(s0 + 0);
+goto L4048c8;
+L4048bc:
+s0 = 0x10015364;
+a0 = 0xfb4ee44;
+MEM_U32(s0 + 0) = a0;
+L4048c8:
+//nop;
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+at = 0x23;
+// bdead 40020003 gp = MEM_U32(sp + 56);
+if (v0 == at) goto L4048f4;
+//nop;
+a0 = 0x1001537c;
+a0 = MEM_U32(a0 + 0);
+f_make_file(mem, sp, a0);
+// bdead 40020003 gp = MEM_U32(sp + 56);
+L4048f4:
+//nop;
+a0 = MEM_U32(s0 + 0);
+a1 = zero;
+a2 = zero;
+v0 = wrapper_fseek(mem, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+s0 = zero;
+s1 = 0x1001231c;
+v1 = 0x10014ac8;
+L404918:
+//nop;
+a0 = s0;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe007f t9 = t9;
+a2 = s0;
+MEM_U32(sp + 68) = v1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+v1 = MEM_U32(sp + 68);
+s0 = s0 + 0x1;
+at = (int)s0 < (int)0x20;
+s1 = s1 + 0x4;
+// bdead 4006001f gp = MEM_U32(sp + 56);
+v1 = v1 + 0x4;
+MEM_U32(v1 + -4) = v0;
+if (at != 0) goto L404918;
+s1 = 0x1001231c;
+s0 = 0x20;
+s1 = s1 + 0x80;
+L404960:
+//nop;
+a0 = s0;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe007f t9 = t9;
+a2 = s0 + 0xffffffe0;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+s0 = s0 + 0x1;
+at = (int)s0 < (int)0x40;
+s1 = s1 + 0x4;
+// bdead 40060003 gp = MEM_U32(sp + 56);
+if (at != 0) goto L404960;
+s1 = 0x1001231c;
+s0 = 0x40;
+s2 = 0x48;
+s1 = s1 + 0x100;
+L40499c:
+//nop;
+a0 = s0;
+a1 = MEM_U32(s1 + 0);
+// fdead 61fe007f t9 = t9;
+a2 = s0 + 0xffffffc0;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+s0 = s0 + 0x1;
+s1 = s1 + 0x4;
+// bdead 400e0003 gp = MEM_U32(sp + 56);
+if (s0 != s2) goto L40499c;
+//nop;
+a1 = 0x1000e04c;
+a0 = 0x1;
+// fdead 61fe007f t9 = t9;
+a2 = 0x1;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1a;
+a2 = 0x1b;
+//nop;
+a1 = 0x1000e050;
+// fdead 61fe00ff t9 = t9;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1b;
+a2 = 0x1c;
+//nop;
+a1 = 0x1000e058;
+// fdead 61fe00ff t9 = t9;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1c;
+a2 = 0x1d;
+//nop;
+a1 = 0x1000e060;
+// fdead 61fe00ff t9 = t9;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1d;
+a2 = 0x1e;
+//nop;
+a1 = 0x1000e064;
+// fdead 61fe00ff t9 = t9;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1e;
+a2 = 0x1f;
+//nop;
+a1 = 0x1000e068;
+// fdead 61fe00ff t9 = t9;
+a1 = a1;
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a0 = 0x1d;
+a2 = 0x1d;
+//nop;
+a1 = 0x100124f0;
+// fdead 61fe00ff t9 = t9;
+a1 = MEM_U32(a1 + 0);
+v0 = func_4042e0(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+a1 = zero;
+//nop;
+a0 = 0x100124f4;
+// fdead 61fe007f t9 = t9;
+a0 = MEM_U32(a0 + 0);
+func_404374(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+//nop;
+// fdead 61fe001f t9 = t9;
+//nop;
+func_4041e8(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 56);
+//nop;
+// fdead 61fe001f t9 = t9;
+//nop;
+func_404100(mem, sp);
+// bdead 3 gp = MEM_U32(sp + 56);
+v0 = 0x10014f50;
+v1 = v0 + 0x400;
+L404af0:
+v0 = v0 + 0x10;
+MEM_U32(v0 + -16) = zero;
+MEM_U32(v0 + -12) = zero;
+MEM_U32(v0 + -8) = zero;
+MEM_U32(v0 + -4) = zero;
+if (v0 != v1) goto L404af0;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x60;
+return;
+}
+
+static uint32_t f_main(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L404b34:
+//main:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 40000063 MEM_U32(sp + 28) = ra;
+// fdead 40000063 t9 = t9;
+// fdead 40000063 MEM_U32(sp + 24) = gp;
+// fdead 40000063 MEM_U32(sp + 20) = s0;
+func_4043fc(mem, sp, a0, a1);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+s0 = 0x10015364;
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U8(t6 + 12);
+t8 = t7 & 0x10;
+//nop;
+if (t8 != 0) goto L404bac;
+L404b78:
+//nop;
+//nop;
+f_readinline(mem, sp);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_Parsestmt(mem, sp);
+t9 = MEM_U32(s0 + 0);
+// bdead 44020183 gp = MEM_U32(sp + 24);
+t0 = MEM_U8(t9 + 12);
+t1 = t0 & 0x10;
+//nop;
+if (t1 == 0) goto L404b78;
+L404bac:
+t2 = 0x10013a44;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 == 0) goto L404bd8;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x1000e06c;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L404bd8:
+v0 = 0x10014ac4;
+v0 = MEM_U32(v0 + 0);
+//nop;
+if ((int)v0 < (int)0x2) goto L404c08;
+t3 = 0x10013a38;
+at = (int)v0 < (int)0x3;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 == 0) goto L404c1c;
+//nop;
+if (at == 0) goto L404c1c;
+L404c08:
+//nop;
+a0 = 0x1;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L404c1c:
+//nop;
+a0 = 0x1;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x10015380;
+a1 = 0x10015384;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+f_sym_finish(mem, sp, a0, a1);
+// bdead 3 ra = MEM_U32(sp + 28);
+// bdead 3 gp = MEM_U32(sp + 24);
+// bdead 3 s0 = MEM_U32(sp + 20);
+// bdead 3 sp = sp + 0x20;
+v0 = zero;
+return v0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+}
+
+static void func_404c80(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L404c80:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+v1 = 0x1;
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+// fdead 400001fb MEM_U32(sp + 24) = gp;
+a3 = a0;
+if (a0 == v1) goto L404cb8;
+at = 0x2;
+if (a0 == at) {
+at = 0x3;
+goto L404cd4;}
+at = 0x3;
+//nop;
+if (a0 == at) goto L404cf0;
+L404cb8:
+t7 = 0x100124f8;
+t6 = a2 << 3;
+t8 = t6 + t7;
+v0 = MEM_U32(t8 + 4);
+v0 = v0 << 17;
+v0 = v0 >> 27;
+goto L404d04;
+L404cd4:
+t0 = 0x100124f8;
+t9 = a2 << 3;
+t1 = t9 + t0;
+v0 = MEM_U32(t1 + 4);
+v0 = v0 << 22;
+v0 = v0 >> 27;
+goto L404d04;
+L404cf0:
+t3 = 0x100124f8;
+t2 = a2 << 3;
+t4 = t2 + t3;
+v0 = MEM_U32(t4 + 4);
+v0 = v0 & 0x1f;
+L404d04:
+if (v0 >= 0xd) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (v0) {
+case 0: goto L405254;
+case 1: goto L404d2c;
+case 2: goto L404db8;
+case 3: goto L404e14;
+case 4: goto L404f3c;
+case 5: goto L404f80;
+case 6: goto L405010;
+case 7: goto L404ea0;
+case 8: goto L404ee0;
+case 9: goto L4050e4;
+case 10: goto L40513c;
+case 11: goto L405188;
+case 12: goto L405214;
+}
+L404d2c:
+t6 = 0x10013a4c;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L404d78;
+//nop;
+if (a1 != v1) goto L404d78;
+t8 = 0x100121f4;
+t7 = a3 << 2;
+a0 = 0x1000e248;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x2;
+a0 = a0;
+//nop;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404d78:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404d88;
+if ((int)a1 < (int)0x20) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L404d88:
+t1 = 0x100121f4;
+//nop;
+a0 = 0x1000e264;
+t0 = a3 << 2;
+t1 = t1;
+t2 = t0 + t1;
+a1 = MEM_U32(t2 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404db8:
+t3 = 0x10013a3c;
+t3 = MEM_U8(t3 + 0);
+if ((int)t3 >= (int)0x3) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404de4;
+t4 = a1 & 0x1;
+if ((int)a1 >= (int)0x20) goto L404de4;
+if (t4 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L404de4:
+t6 = 0x100121f4;
+//nop;
+a0 = 0x1000e27c;
+t5 = a3 << 2;
+t6 = t6;
+t7 = t5 + t6;
+a1 = MEM_U32(t7 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404e14:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404e20;
+if ((int)a1 < (int)0x20) {
+at = 0x48;
+goto L404e5c;}
+L404e20:
+at = 0x48;
+//nop;
+if (a1 == at) goto L404e5c;
+t9 = 0x100121f4;
+t8 = a3 << 2;
+a0 = 0x1000e298;
+t9 = t9;
+t0 = t8 + t9;
+//nop;
+a1 = MEM_U32(t0 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404e5c:
+t1 = 0x10013a4c;
+t1 = MEM_U32(t1 + 0);
+if (t1 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+t2 = a3 << 2;
+if (a1 != v1) goto L405254;
+t3 = 0x100121f4;
+//nop;
+a0 = 0x1000e2b0;
+t3 = t3;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404ea0:
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404eb0;
+if ((int)a1 < (int)0x20) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L404eb0:
+t6 = 0x100121f4;
+//nop;
+a0 = 0x1000e2cc;
+t5 = a3 << 2;
+t6 = t6;
+t7 = t5 + t6;
+a1 = MEM_U32(t7 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404ee0:
+t8 = 0x10013a3c;
+t8 = MEM_U8(t8 + 0);
+if ((int)t8 >= (int)0x3) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+at = (int)a1 < (int)0x20;
+if ((int)a1 < 0) goto L404f0c;
+t9 = a1 & 0x1;
+if ((int)a1 >= (int)0x20) goto L404f0c;
+if (t9 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L404f0c:
+t1 = 0x100121f4;
+//nop;
+a0 = 0x1000e2ec;
+t0 = a3 << 2;
+t1 = t1;
+t2 = t0 + t1;
+a1 = MEM_U32(t2 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404f3c:
+t3 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404f54;
+if ((int)a1 < (int)0x40) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L404f54:
+t4 = 0x100121f4;
+//nop;
+a0 = 0x1000e310;
+t4 = t4;
+t5 = t3 + t4;
+a1 = MEM_U32(t5 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404f80:
+t6 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L404f98;
+//nop;
+if ((int)a1 < (int)0x40) goto L404fc4;
+L404f98:
+t7 = 0x100121f4;
+//nop;
+a0 = 0x1000e334;
+t7 = t7;
+t8 = t6 + t7;
+a1 = MEM_U32(t8 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L404fc4:
+t9 = 0x10013a3c;
+t0 = a1 & 0x1;
+t9 = MEM_U8(t9 + 0);
+if ((int)t9 >= (int)0x3) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+t1 = a3 << 2;
+if (t0 == 0) goto L405254;
+t2 = 0x100121f4;
+//nop;
+a0 = 0x1000e358;
+t2 = t2;
+t3 = t1 + t2;
+a1 = MEM_U32(t3 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L405010:
+t4 = a3 << 2;
+if ((int)a1 < (int)0x20) goto L405028;
+//nop;
+if ((int)a1 < (int)0x40) goto L405054;
+L405028:
+t5 = 0x100121f4;
+//nop;
+a0 = 0x1000e380;
+t5 = t5;
+t6 = t4 + t5;
+a1 = MEM_U32(t6 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L405054:
+v0 = 0x10013a3c;
+t7 = a1 & 0x1;
+v0 = MEM_U8(v0 + 0);
+if ((int)v0 < (int)0x3) {
+at = (int)v0 < (int)0x3;
+goto L4050a8;}
+if (t7 == zero) {
+at = (int)v0 < (int)0x3;
+goto L4050a8;}
+t9 = 0x100121f4;
+t8 = a3 << 2;
+a0 = 0x1000e3a4;
+t9 = t9;
+t0 = t8 + t9;
+//nop;
+a1 = MEM_U32(t0 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+// fdead 0 at = (int)v0 < (int)0x3;
+L4050a8:
+t1 = a1 & 0x3;
+if (at == 0) goto L405254;
+t2 = a3 << 2;
+if (t1 == 0) goto L405254;
+t3 = 0x100121f4;
+//nop;
+a0 = 0x1000e3cc;
+t3 = t3;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L4050e4:
+t5 = 0x10013a3c;
+t5 = MEM_U8(t5 + 0);
+if ((int)t5 >= (int)0x3) {
+at = (int)a1 < (int)0x20;
+goto L405254;}
+t6 = a1 & 0x1;
+if ((int)a1 < (int)0x20) goto L405254;
+if (t6 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+t8 = 0x100121f4;
+t7 = a3 << 2;
+a0 = 0x1000e3fc;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x1;
+a0 = a0;
+//nop;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L40513c:
+t0 = 0x10013a3c;
+t1 = a1 & 0x1;
+t0 = MEM_U8(t0 + 0);
+if ((int)t0 >= (int)0x3) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+t2 = a3 << 2;
+if (t1 == 0) goto L405254;
+t3 = 0x100121f4;
+//nop;
+a0 = 0x1000e428;
+t3 = t3;
+t4 = t2 + t3;
+a1 = MEM_U32(t4 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L405188:
+t5 = 0x10013a3c;
+t6 = a1 & 0x1;
+t0 = a1 & 0x3;
+t5 = MEM_U8(t5 + 0);
+//nop;
+if ((int)t5 < (int)0x3) goto L4051e0;
+if (t6 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+t8 = 0x100121f4;
+t7 = a3 << 2;
+a0 = 0x1000e44c;
+t8 = t8;
+t9 = t7 + t8;
+a1 = MEM_U32(t9 + 0);
+//nop;
+a2 = 0x1;
+a0 = a0;
+//nop;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L4051e0:
+t1 = a3 << 2;
+if (t0 == 0) goto L405254;
+t2 = 0x100121f4;
+//nop;
+a0 = 0x1000e470;
+t2 = t2;
+t3 = t1 + t2;
+a1 = MEM_U32(t3 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405254;
+L405214:
+t4 = a3 << 2;
+if ((int)a1 < (int)0x40) goto L40522c;
+if ((int)a1 < (int)0x48) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405258;}
+L40522c:
+t5 = 0x100121f4;
+//nop;
+a0 = 0x1000e494;
+t5 = t5;
+t6 = t4 + t5;
+a1 = MEM_U32(t6 + 0);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L405254:
+// bdead 1 ra = MEM_U32(sp + 28);
+L405258:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405264(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L405264:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+t1 = a1 << 1;
+t2 = t1 & 0x3fe;
+t3 = MEM_U16(v0 + 6);
+t1 = MEM_U8(v0 + 8);
+t6 = MEM_U8(v0 + 5);
+t4 = t3 & 0xfc01;
+t5 = t2 | t4;
+t9 = a2 << 1;
+t3 = t1 & 0xff01;
+t2 = t9 | t3;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x17;
+MEM_U8(v0 + 8) = (uint8_t)t2;
+t7 = MEM_U16(v0 + 8);
+MEM_U16(v0 + 6) = (uint16_t)t5;
+t5 = a3 << 2;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+t6 = t5 & 0x1fc;
+t8 = t7 & 0xfe03;
+t1 = t6 | t8;
+MEM_U16(v0 + 8) = (uint16_t)t1;
+v1 = MEM_U32(v0 + 8);
+sp = sp + 0xffffffe0;
+t3 = MEM_U32(sp + 48);
+t2 = v1 >> 14;
+t0 = 0x100121f0;
+t4 = t3 ^ t2;
+t5 = t4 << 28;
+t7 = t5 >> 14;
+t6 = t7 ^ v1;
+MEM_U32(v0 + 0) = a0;
+MEM_U32(v0 + 8) = t6;
+t8 = MEM_U32(t0 + 0);
+t3 = MEM_U16(v0 + 4);
+// fdead 4601fffb MEM_U32(sp + 20) = s0;
+t1 = t8 << 6;
+t9 = t1 & 0x1c0;
+t2 = t3 & 0xfe3f;
+t4 = t9 | t2;
+s0 = a1;
+// fdead 4603fffb MEM_U32(sp + 28) = ra;
+// fdead 4603fffb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+MEM_U16(v0 + 4) = (uint16_t)t4;
+if (t8 == 0) goto L405330;
+v1 = MEM_U32(sp + 56);
+MEM_U32(v0 + 12) = v1;
+L405330:
+t5 = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 56);
+//nop;
+if (t5 >= 0x10) goto L405584;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L40549c;
+case 1: goto L40549c;
+case 2: goto L405428;
+case 3: goto L4053a0;
+case 4: goto L40549c;
+case 5: goto L405538;
+case 6: goto L405420;
+case 7: goto L405518;
+case 8: goto L405538;
+case 9: goto L405518;
+case 10: goto L4055a4;
+case 11: goto L4055a4;
+case 12: goto L4054ec;
+case 13: goto L40557c;
+case 14: goto L405464;
+case 15: goto L405360;
+}
+L405360:
+a1 = 0x10015390;
+t8 = MEM_U8(v0 + 11);
+//nop;
+a1 = MEM_U32(a1 + 0);
+t1 = t8 & 0xff80;
+// bdead 40020549 t9 = t9;
+t6 = a1 & 0x7f;
+t3 = t6 | t1;
+MEM_U8(v0 + 11) = (uint8_t)t3;
+a0 = 0x3;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 44);
+v0 = 0x10015350;
+L4053a0:
+t2 = MEM_U32(sp + 52);
+t7 = MEM_U16(v0 + 10);
+//nop;
+t4 = t2 << 7;
+t5 = t4 & 0x3f80;
+t8 = t7 & 0xc07f;
+t6 = t5 | t8;
+// bdead 40028109 t9 = t9;
+MEM_U16(v0 + 10) = (uint16_t)t6;
+a0 = 0x1;
+a1 = MEM_U32(sp + 40);
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+a0 = 0x2;
+//nop;
+a2 = s0;
+// fdead 600200ff t9 = t9;
+//nop;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = 0x3;
+a1 = MEM_U32(sp + 52);
+//nop;
+a2 = s0;
+// fdead 600200ff t9 = t9;
+//nop;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L4055a4;
+L405420:
+MEM_U32(v0 + 12) = v1;
+goto L4055a4;
+L405428:
+t1 = MEM_U32(sp + 40);
+at = 0x48;
+//nop;
+if (t1 == at) goto L40545c;
+//nop;
+a0 = 0x1;
+a1 = t1;
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 56);
+v0 = 0x10015350;
+L40545c:
+MEM_U32(v0 + 12) = v1;
+goto L4055a4;
+L405464:
+at = 0x48;
+//nop;
+if (a3 == at) goto L405494;
+//nop;
+a0 = 0x2;
+a1 = a3;
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 56);
+v0 = 0x10015350;
+L405494:
+MEM_U32(v0 + 12) = v1;
+goto L4055a4;
+L40549c:
+//nop;
+a0 = 0x1;
+a1 = MEM_U32(sp + 40);
+// bdead 40020161 t9 = t9;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+a0 = 0x2;
+//nop;
+a2 = s0;
+// fdead 600200ff t9 = t9;
+//nop;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t3 = MEM_U32(sp + 56);
+v0 = 0x10015350;
+MEM_U32(v0 + 12) = t3;
+goto L4055a4;
+L4054ec:
+//nop;
+a0 = 0x1;
+a1 = MEM_U32(sp + 40);
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 56);
+v0 = 0x10015350;
+MEM_U32(v0 + 12) = t9;
+goto L4055a4;
+L405518:
+//nop;
+a0 = 0x1;
+a1 = MEM_U32(sp + 40);
+// bdead 40020061 t9 = t9;
+a2 = s0;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L4055a4;
+L405538:
+//nop;
+a0 = 0x1;
+a1 = MEM_U32(sp + 40);
+// bdead 40020161 t9 = t9;
+a2 = s0;
+MEM_U32(sp + 44) = a3;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 44);
+a0 = 0x2;
+//nop;
+a2 = s0;
+// fdead 600200ff t9 = t9;
+//nop;
+func_404c80(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L4055a4;
+L40557c:
+MEM_U32(v0 + 12) = v1;
+goto L4055a4;
+L405584:
+//nop;
+a0 = 0x1000e4c8;
+a1 = 0x1000e4d0;
+a2 = 0xf1;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L4055a4:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x20;
+return;
+}
+
+static void func_4055c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L4055c4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+MEM_U32(sp + 36) = a1;
+a3 = a0;
+a0 = 0x10015374;
+a1 = 0x1000e4dc;
+a2 = 0x10013a30;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+v0 = MEM_U32(sp + 36);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == 0) goto L40561c;
+a2 = v0;
+goto L405624;
+L40561c:
+a2 = 0x1000e4ec;
+a2 = a2;
+L405624:
+//nop;
+a0 = 0x10015374;
+a1 = 0x1000e4e4;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405650(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L405650:
+//nop;
+//nop;
+//nop;
+v1 = 0x10013a54;
+a1 = 0x10013a58;
+t7 = 0x1;
+t6 = MEM_U32(v1 + 0);
+t8 = t7 << (a0 & 0x1f);
+v0 = MEM_U32(a1 + 0);
+t9 = t6 + t8;
+t0 = t9 + 0xffffffff;
+t1 = (int)t0 >> (a0 & 0x1f);
+t2 = t1 << (a0 & 0x1f);
+MEM_U32(v1 + 0) = t2;
+if (v0 == 0) goto L4056a0;
+t3 = MEM_U32(v1 + 0);
+L405690:
+MEM_U32(v0 + 8) = t3;
+v0 = MEM_U32(v0 + 12);
+if (v0 != zero) {
+t3 = MEM_U32(v1 + 0);
+goto L405690;}
+L4056a0:
+MEM_U32(a1 + 0) = zero;
+return;
+}
+
+static void func_4056a8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4056a8:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L4056f8;
+//nop;
+a0 = 0x1000e4f0;
+a1 = MEM_U32(sp + 48);
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405794;
+L4056f8:
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+MEM_U32(sp + 44) = v0;
+t8 = 0x10014b48;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+//nop;
+MEM_U32(sp + 36) = v1;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_alloc_new_string(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 44);
+v1 = MEM_U32(sp + 36);
+a0 = 0x10013a58;
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+t1 = MEM_U32(a0 + 0);
+t4 = 0x4;
+MEM_U32(t2 + 12) = t1;
+t3 = MEM_U32(sp + 44);
+t5 = MEM_U32(sp + 44);
+MEM_U32(a0 + 0) = t3;
+MEM_U32(t5 + 16) = t4;
+t6 = MEM_U32(sp + 44);
+MEM_U32(t6 + 8) = zero;
+t7 = MEM_U32(sp + 44);
+MEM_U32(v1 + 0) = t7;
+L405794:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_4057a4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4057a4:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L405880;
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+MEM_U32(sp + 44) = v0;
+t8 = 0x10014b48;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+//nop;
+MEM_U32(sp + 32) = v1;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_alloc_new_string(mem, sp, a0);
+t0 = MEM_U32(sp + 44);
+// bdead 4000038b gp = MEM_U32(sp + 24);
+t1 = 0x4;
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+t3 = 0x1;
+a1 = zero;
+MEM_U32(t2 + 16) = t1;
+t4 = MEM_U32(sp + 44);
+MEM_U32(t4 + 20) = t3;
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_sym_enter(mem, sp, a0, a1);
+t5 = MEM_U32(sp + 44);
+// bdead 4000410b gp = MEM_U32(sp + 24);
+MEM_U32(t5 + 24) = v0;
+t7 = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 44);
+MEM_U32(t7 + 0) = t6;
+L405880:
+t8 = MEM_U32(sp + 44);
+t9 = 0x4;
+MEM_U32(t8 + 12) = zero;
+t0 = MEM_U32(sp + 44);
+MEM_U32(t0 + 16) = t9;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t1 = MEM_U32(sp + 44);
+// bdead 4000040b gp = MEM_U32(sp + 24);
+a1 = 0x5;
+MEM_U32(t1 + 8) = v0;
+t2 = MEM_U32(sp + 44);
+//nop;
+a0 = MEM_U32(t2 + 24);
+a2 = MEM_U32(t2 + 8);
+f_sym_define(mem, sp, a0, a1, a2);
+t3 = MEM_U32(sp + 36);
+// bdead 40001003 gp = MEM_U32(sp + 24);
+t4 = MEM_U32(sp + 44);
+if (t3 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L405924;}
+v0 = 0x10015350;
+t5 = MEM_U32(t4 + 24);
+t9 = MEM_U32(sp + 44);
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = t5;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x29;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+t0 = MEM_U32(t9 + 8);
+MEM_U32(v0 + 8) = t0;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+L405924:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static uint32_t func_405930(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L405930:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 < 0) goto L405968;
+if ((int)v0 < (int)0x400) {
+v0 = v1;
+goto L40598c;}
+v0 = v1;
+L405968:
+//nop;
+a0 = 0x1000e508;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40598c;
+L40598c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void func_40599c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40599c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+at = 0x1b;
+// fdead 4000006f MEM_U32(sp + 44) = ra;
+// fdead 4000006f MEM_U32(sp + 40) = gp;
+a1 = a0;
+if (a0 == at) goto L405a74;
+at = 0x198;
+a2 = zero;
+if (a0 != at) goto L4059fc;
+//nop;
+t6 = 0x3;
+MEM_U32(sp + 16) = t6;
+// fdead 400080ef t9 = t9;
+a0 = zero;
+a1 = 0x2;
+a3 = zero;
+MEM_U32(sp + 20) = zero;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L405b10;
+L4059fc:
+at = 0x199;
+a0 = zero;
+if (a1 != at) goto L405a44;
+t9 = 0x1;
+MEM_U32(sp + 24) = t9;
+//nop;
+t7 = 0x4;
+t8 = 0x48;
+// bdead 42010003 t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = 0x4f;
+a2 = zero;
+a3 = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L405b10;
+L405a44:
+//nop;
+t1 = 0x2;
+t2 = 0x48;
+// fdead 40000cef t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L405b10;
+L405a74:
+//nop;
+MEM_U32(sp + 56) = a1;
+// fdead 4000006f t9 = t9;
+//nop;
+v0 = func_405930(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+at = 0x23;
+a1 = MEM_U32(sp + 56);
+t3 = 0x100142b0;
+t0 = v0;
+t3 = MEM_U8(t3 + 0);
+//nop;
+if (t3 != at) goto L405ab0;
+v1 = zero;
+goto L405ad8;
+L405ab0:
+//nop;
+MEM_U32(sp + 56) = a1;
+MEM_U32(sp + 52) = t0;
+// fdead 6000125f t9 = t9;
+//nop;
+v0 = func_405930(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 56);
+t0 = MEM_U32(sp + 52);
+v1 = v0;
+L405ad8:
+//nop;
+t6 = v1 << 10;
+t7 = t6 + t0;
+t4 = 0xd;
+t5 = 0x48;
+// fdead 6001f25f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = t7;
+a0 = zero;
+a2 = 0x48;
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L405b10:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_405b20(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t6 = 0;
+L405b20:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffe0;
+at = 0x3a;
+v0 = MEM_U8(v0 + 0);
+// fdead 4000006f MEM_U32(sp + 28) = ra;
+// fdead 4000006f MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+if (v0 != at) goto L405b78;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t6 = MEM_U32(sp + 36);
+// bdead 8009 gp = MEM_U32(sp + 24);
+MEM_U32(t6 + 0) = v0;
+goto L405bd0;
+L405b78:
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L405b8c;}
+at = 0x2d;
+if (v0 != at) {
+at = 0x23;
+goto L405ba8;}
+L405b8c:
+//nop;
+a1 = MEM_U32(sp + 36);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405bd0;
+at = 0x23;
+L405ba8:
+if (v0 == at) {
+at = 0x2c;
+goto L405bd0;}
+at = 0x2c;
+a1 = zero;
+if (v0 == at) goto L405bd0;
+//nop;
+a0 = 0x1000e524;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L405bd0:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405be0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t6 = 0;
+L405be0:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffe0;
+at = 0x3a;
+v0 = MEM_U8(v0 + 0);
+// fdead 400000ef MEM_U32(sp + 28) = ra;
+// fdead 400000ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+if (v0 != at) goto L405c38;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t6 = MEM_U32(sp + 40);
+// bdead 8009 gp = MEM_U32(sp + 24);
+MEM_U32(t6 + 0) = v0;
+goto L405c90;
+L405c38:
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L405c4c;}
+at = 0x2d;
+if (v0 != at) {
+at = 0x23;
+goto L405c68;}
+L405c4c:
+//nop;
+a2 = MEM_U32(sp + 40);
+//nop;
+f_dw_GetItem(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L405c90;
+at = 0x23;
+L405c68:
+if (v0 == at) {
+at = 0x2c;
+goto L405c90;}
+at = 0x2c;
+a1 = zero;
+if (v0 == at) goto L405c90;
+//nop;
+a0 = 0x1000e544;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L405c90:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_405ca0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+L405ca0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+at = (int)a1 < (int)0x11;
+s0 = a1;
+s1 = a0;
+s2 = a2;
+s3 = a3;
+// fdead 401e01ef MEM_U32(sp + 44) = ra;
+// fdead 401e01ef MEM_U32(sp + 40) = gp;
+if (at != 0) goto L405ce4;
+s0 = 0x10;
+L405ce4:
+a0 = zero;
+if ((int)s0 <= 0) goto L405d6c;
+a2 = s0 & 0x3;
+a1 = a2;
+if (a2 == 0) goto L405d24;
+t6 = -s0;
+t8 = sp + 0x48;
+v0 = t6 + t8;
+v1 = s1;
+L405d08:
+t9 = MEM_U8(v1 + 0);
+a0 = a0 + 0x1;
+v0 = v0 + 0x1;
+v1 = v1 + 0x1;
+MEM_U8(v0 + 15) = (uint8_t)t9;
+if (a1 != a0) goto L405d08;
+if (a0 == s0) {
+t0 = -s0;
+goto L405d68;}
+L405d24:
+t0 = -s0;
+t1 = a0 + t0;
+t2 = sp + 0x48;
+v0 = t1 + t2;
+v1 = s1 + a0;
+L405d38:
+t3 = MEM_U8(v1 + 0);
+a0 = a0 + 0x4;
+v0 = v0 + 0x4;
+MEM_U8(v0 + 12) = (uint8_t)t3;
+t4 = MEM_U8(v1 + 1);
+v1 = v1 + 0x4;
+MEM_U8(v0 + 13) = (uint8_t)t4;
+t5 = MEM_U8(v1 + -2);
+MEM_U8(v0 + 14) = (uint8_t)t5;
+t6 = MEM_U8(v1 + -1);
+MEM_U8(v0 + 15) = (uint8_t)t6;
+if (a0 != s0) goto L405d38;
+L405d68:
+a0 = zero;
+L405d6c:
+t7 = 0x10;
+a1 = t7 - s0;
+s1 = sp + 0x50;
+if ((int)a1 <= 0) goto L405dd0;
+v0 = a1 & 0x3;
+v1 = v0;
+if (v0 == 0) goto L405da8;
+t8 = sp + 0x48;
+s0 = a0 + t8;
+v0 = 0x30;
+L405d94:
+a0 = a0 + 0x1;
+MEM_U8(s0 + 0) = (uint8_t)v0;
+s0 = s0 + 0x1;
+if (v1 != a0) goto L405d94;
+if (a0 == a1) {
+t9 = sp + 0x48;
+goto L405dd0;}
+L405da8:
+t9 = sp + 0x48;
+s0 = a0 + t9;
+v1 = a1 + t9;
+v0 = 0x30;
+L405db8:
+s0 = s0 + 0x4;
+MEM_U8(s0 + -3) = (uint8_t)v0;
+MEM_U8(s0 + -2) = (uint8_t)v0;
+MEM_U8(s0 + -1) = (uint8_t)v0;
+MEM_U8(s0 + -4) = (uint8_t)v0;
+if (s0 != v1) goto L405db8;
+L405dd0:
+MEM_U32(s2 + 0) = zero;
+MEM_U32(s3 + 0) = zero;
+s0 = sp + 0x48;
+L405ddc:
+//nop;
+a0 = MEM_U8(s0 + 0);
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t0 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+at = s0 < s1;
+t1 = t0 << 4;
+t2 = v0 + t1;
+// bdead 401e0805 gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 0) = t2;
+if (at != 0) goto L405ddc;
+s0 = sp + 0x50;
+s1 = sp + 0x58;
+L405e14:
+//nop;
+a0 = MEM_U8(s0 + 0);
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t3 = MEM_U32(s3 + 0);
+s0 = s0 + 0x1;
+// bdead 40161009 gp = MEM_U32(sp + 40);
+t4 = t3 << 4;
+t5 = v0 + t4;
+MEM_U32(s3 + 0) = t5;
+if (s0 != s1) goto L405e14;
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static uint32_t func_405e5c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L405e5c:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffd0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+// fdead 400001ef MEM_U32(sp + 28) = ra;
+// fdead 400001ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+if (v0 != at) goto L405f78;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x2c;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L405ec8;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x2c;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L405ec8:
+t6 = MEM_U32(sp + 44);
+at = 0x4;
+v0 = MEM_U32(t6 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L405efc;}
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+a2 = MEM_U32(sp + 60);
+f_dw_GetItem(mem, sp, a0, a1, a2);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L406034;
+at = 0x3;
+L405efc:
+a1 = zero;
+if (v0 != at) goto L405f48;
+t7 = MEM_U32(sp + 44);
+t9 = MEM_U32(sp + 48);
+t8 = MEM_U32(t7 + 24);
+MEM_U32(t9 + 0) = t8;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+a2 = MEM_U32(sp + 60);
+// fdead 600000ff t9 = t9;
+//nop;
+func_405be0(mem, sp, a0, a1, a2);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L406034;
+L405f48:
+//nop;
+a0 = 0x1000e564;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40605c;
+L405f78:
+at = 0x22;
+//nop;
+if (v0 != at) goto L405fd0;
+//nop;
+a0 = 0x100142b8;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a1 = v0;
+a2 = MEM_U32(sp + 52);
+//nop;
+a3 = MEM_U32(sp + 56);
+a0 = 0x100142b8;
+// fdead 600001ef t9 = t9;
+//nop;
+func_405ca0(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L405fe8;
+L405fd0:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L405fe8:
+t0 = 0x100142b0;
+at = 0x3a;
+t3 = MEM_U32(sp + 60);
+t0 = MEM_U8(t0 + 0);
+if (t0 != at) {
+t2 = 0x1;
+goto L406030;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t1 = MEM_U32(sp + 60);
+// bdead 40000509 gp = MEM_U32(sp + 24);
+MEM_U32(t1 + 0) = v0;
+goto L406034;
+t2 = 0x1;
+L406030:
+MEM_U32(t3 + 0) = t2;
+L406034:
+t4 = 0x100142b0;
+at = 0x2c;
+t4 = MEM_U8(t4 + 0);
+if (t4 != at) {
+v0 = 0x1;
+goto L40605c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+L40605c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void func_40606c(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L40606c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 60) = ra;
+// fdead 4000802b MEM_U32(sp + 56) = fp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 52) = gp;
+// fdead 4000802b MEM_U32(sp + 48) = s7;
+// fdead 4000802b MEM_U32(sp + 44) = s6;
+// fdead 4000802b MEM_U32(sp + 40) = s5;
+// fdead 4000802b MEM_U32(sp + 36) = s4;
+// fdead 4000802b MEM_U32(sp + 32) = s3;
+// fdead 4000802b MEM_U32(sp + 28) = s2;
+// fdead 4000802b MEM_U32(sp + 24) = s1;
+// fdead 4000802b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L4060cc;
+//nop;
+a0 = 0x2;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+L4060cc:
+fp = 0x100142b0;
+s7 = 0x23;
+s6 = 0x10013a50;
+s5 = sp + 0x50;
+s4 = sp + 0x48;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+L4060f0:
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 76) = zero;
+// bdead c1ff0003 t9 = t9;
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+a3 = s5;
+v0 = func_405e5c(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+if (v0 == 0) goto L4061d8;
+t8 = MEM_U32(s6 + 0);
+v0 = MEM_U32(sp + 80);
+t1 = MEM_U32(sp + 84);
+v0 = v0 << 2;
+if (t8 == 0) goto L406160;
+v1 = v0;
+if ((int)v0 >= (int)0x4) goto L406150;
+v1 = 0x4;
+goto L406150;
+L406150:
+t9 = MEM_U32(s1 + 0);
+t0 = v1 + t9;
+MEM_U32(s1 + 0) = t0;
+goto L4061cc;
+L406160:
+t2 = MEM_U8(s0 + 5);
+t5 = MEM_U32(sp + 76);
+t6 = MEM_U32(sp + 80);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x3b;
+MEM_U32(s0 + 0) = t1;
+MEM_U8(s0 + 5) = (uint8_t)t4;
+MEM_U32(s0 + 8) = t5;
+MEM_U32(s0 + 12) = t6;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t8 = MEM_U8(s0 + 5);
+t7 = MEM_U32(sp + 84);
+t1 = MEM_U32(sp + 72);
+t2 = MEM_U32(sp + 80);
+// bdead c3ff0c03 gp = MEM_U32(sp + 52);
+t9 = t8 & 0xffc0;
+t0 = t9 | 0x3b;
+MEM_U8(s0 + 5) = (uint8_t)t0;
+MEM_U32(s0 + 0) = t7;
+MEM_U32(s0 + 8) = t1;
+MEM_U32(s0 + 12) = t2;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+L4061cc:
+t3 = MEM_U8(fp + 0);
+//nop;
+if (s7 != t3) goto L4060f0;
+L4061d8:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_406208(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406208:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+MEM_U32(sp + 56) = zero;
+MEM_U32(sp + 52) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L406330;
+t6 = 0x100142b0;
+at = 0x22;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 != at) goto L406290;
+//nop;
+a0 = 0x100142b8;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = v0;
+a2 = sp + 0x38;
+//nop;
+a3 = sp + 0x34;
+a0 = 0x100142b8;
+// fdead 600001ef t9 = t9;
+//nop;
+func_405ca0(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+goto L4062a8;
+L406290:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+L4062a8:
+t7 = MEM_U32(sp + 60);
+t9 = 0x48;
+t0 = MEM_U32(sp + 56);
+a2 = MEM_U32(t7 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t8 = 0x2;
+MEM_U32(sp + 16) = t8;
+// bdead 40000283 t9 = t9;
+a0 = zero;
+a1 = MEM_U32(sp + 64);
+a3 = 0x48;
+MEM_U32(sp + 24) = t0;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t1 = MEM_U32(sp + 60);
+t4 = MEM_U32(sp + 52);
+//nop;
+a2 = MEM_U32(t1 + 20);
+t2 = 0x2;
+t3 = 0x48;
+// fdead 60003c9f t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t2;
+a0 = zero;
+a1 = MEM_U32(sp + 64);
+a3 = 0x48;
+MEM_U32(sp + 24) = t4;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L406330:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_406340(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406340:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(a0 + 0) = zero;
+t7 = MEM_U32(sp + 36);
+MEM_U32(t7 + 0) = zero;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a1 = 0x1000e57c;
+a0 = 0x100142b8;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L4063a8;
+at = 0x100121f0;
+t8 = 0x1;
+MEM_U32(at + 0) = t8;
+goto L40644c;
+L4063a8:
+//nop;
+a1 = 0x1000e580;
+a0 = 0x100142b8;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L4063d4;
+at = 0x100121f0;
+t9 = 0x2;
+MEM_U32(at + 0) = t9;
+goto L40644c;
+L4063d4:
+//nop;
+a1 = 0x1000e584;
+a0 = 0x100142b8;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L406400;
+at = 0x100121f0;
+t0 = 0x5;
+MEM_U32(at + 0) = t0;
+goto L40644c;
+L406400:
+//nop;
+a1 = 0x1000e58c;
+a0 = 0x100142b8;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40642c;
+at = 0x100121f0;
+t1 = 0x6;
+MEM_U32(at + 0) = t1;
+goto L40644c;
+L40642c:
+//nop;
+a0 = 0x1000e594;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L406614;
+L40644c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x28;
+a1 = zero;
+t2 = 0x100142b0;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 == at) goto L406490;
+//nop;
+a0 = 0x1000e5b4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L406614;
+L406490:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x69;
+t3 = 0x100142b0;
+t3 = MEM_U8(t3 + 0);
+//nop;
+if (t3 != at) goto L406598;
+//nop;
+a0 = 0x100142b8;
+a1 = MEM_U32(sp + 32);
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40651c;
+//nop;
+a0 = 0x100142b8;
+a1 = MEM_U32(sp + 32);
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 32);
+t4 = 0x10013a74;
+t4 = MEM_U32(t4 + 0);
+if (t4 == zero) {
+t7 = MEM_U32(sp + 32);
+goto L406520;}
+//nop;
+a0 = 0x1000e5d8;
+t6 = MEM_U32(t5 + 0);
+a2 = 0x2;
+a0 = a0;
+a1 = MEM_U32(t6 + 4);
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40651c:
+t7 = MEM_U32(sp + 32);
+L406520:
+at = 0x4;
+t8 = MEM_U32(t7 + 0);
+v0 = MEM_U32(t8 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L406540;}
+MEM_U32(t7 + 0) = zero;
+goto L406598;
+at = 0x3;
+L406540:
+//nop;
+if (v0 != at) goto L406598;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2b;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+at = 0x2d;
+goto L406598;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x29;
+goto L406598;}
+at = 0x29;
+a2 = 0x1;
+if (v1 == at) goto L406598;
+//nop;
+a0 = 0x1000e5f8;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L406614;
+L406598:
+v1 = 0x100142b0;
+at = 0x2b;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+at = 0x2d;
+goto L4065bc;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x69;
+goto L4065bc;}
+at = 0x69;
+if (v1 != at) {
+at = 0x29;
+goto L4065e0;}
+L4065bc:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 36);
+v1 = 0x100142b0;
+MEM_U32(t9 + 0) = v0;
+v1 = MEM_U8(v1 + 0);
+at = 0x29;
+L4065e0:
+a2 = 0x1;
+if (v1 == at) goto L406604;
+//nop;
+a0 = 0x1000e618;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L406614;
+L406604:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L406614:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_406624(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t6 = 0, t8 = 0, t9 = 0;
+L406624:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x64;
+a1 = zero;
+t6 = 0x100142b0;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 == at) goto L40667c;
+//nop;
+a0 = 0x1000e628;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L4066a4;
+L40667c:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 9 gp = MEM_U32(sp + 24);
+t8 = v0 & 0x3fff;
+v1 = 0x10015350;
+t9 = MEM_U16(v1 + 10);
+t0 = t9 & 0xc000;
+t1 = t8 | t0;
+MEM_U16(v1 + 10) = (uint16_t)t1;
+L4066a4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_4066b4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4066b4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 88) = a0;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L406b48;
+v1 = 0x100142b0;
+t6 = MEM_U32(v0 + 20);
+at = 0x22;
+v1 = MEM_U8(v1 + 0);
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 64) = t6;
+if (v1 != at) {
+at = 0x69;
+goto L4067cc;}
+//nop;
+MEM_U32(sp + 72) = zero;
+a0 = 0x100142b8;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = v0;
+a2 = sp + 0x4c;
+//nop;
+a3 = sp + 0x48;
+a0 = 0x100142b8;
+// fdead 600001ef t9 = t9;
+//nop;
+func_405ca0(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 76);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+t7 = 0x2;
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x48;
+MEM_U32(sp + 20) = t8;
+// bdead 40010003 t9 = t9;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 72);
+t0 = 0x2;
+//nop;
+t1 = 0x48;
+MEM_U32(sp + 20) = t1;
+// fdead 60000e1f t9 = t9;
+MEM_U32(sp + 16) = t0;
+a0 = zero;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406b48;
+at = 0x69;
+L4067cc:
+//nop;
+if (v1 != at) goto L4068e0;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x44;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L406838;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x44;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 68);
+a2 = 0x2;
+t3 = 0x10013a74;
+t3 = MEM_U32(t3 + 0);
+if (t3 == zero) {
+t5 = MEM_U32(sp + 68);
+goto L40683c;}
+//nop;
+a0 = 0x1000e63c;
+a1 = MEM_U32(t4 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L406838:
+t5 = MEM_U32(sp + 68);
+L40683c:
+at = 0x4;
+v0 = MEM_U32(t5 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L406858;}
+MEM_U32(sp + 68) = zero;
+goto L4068e0;
+at = 0x3;
+L406858:
+//nop;
+if (v0 != at) goto L4068e0;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 != at) {
+at = 0x2b;
+goto L4068a4;}
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+func_406624(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x2b;
+L4068a4:
+if (v1 == at) {
+at = 0x2d;
+goto L4068e0;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x28;
+goto L4068e0;}
+at = 0x28;
+if (v1 == at) {
+at = 0x23;
+goto L4068e0;}
+at = 0x23;
+a1 = zero;
+if (v1 == at) goto L4068e0;
+//nop;
+a0 = 0x1000e660;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406b48;
+L4068e0:
+v1 = 0x100142b0;
+at = 0x25;
+v1 = MEM_U8(v1 + 0);
+if (v1 != at) {
+at = 0x69;
+goto L40691c;}
+//nop;
+a0 = sp + 0x44;
+a1 = sp + 0x4c;
+// fdead 6000f0ff t9 = t9;
+//nop;
+func_406340(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x69;
+L40691c:
+if (v1 == at) {
+at = 0x64;
+goto L40695c;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L40695c;}
+at = 0x68;
+if (v1 == at) {
+at = 0x2b;
+goto L40695c;}
+at = 0x2b;
+if (v1 == at) {
+at = 0x2d;
+goto L40695c;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x7e;
+goto L40695c;}
+at = 0x7e;
+if (v1 == at) {
+at = 0x22;
+goto L40695c;}
+at = 0x22;
+if (v1 == at) {
+at = 0x28;
+goto L40695c;}
+at = 0x28;
+if (v1 != at) {
+t0 = MEM_U32(sp + 68);
+goto L406a2c;}
+L40695c:
+//nop;
+a0 = sp + 0x50;
+a1 = sp + 0x4c;
+//nop;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t6 = MEM_U32(sp + 80);
+// bdead 40008103 gp = MEM_U32(sp + 40);
+if (t6 != zero) {
+t0 = MEM_U32(sp + 68);
+goto L406a2c;}
+t7 = 0x100142b0;
+at = 0x28;
+t7 = MEM_U8(t7 + 0);
+if (t7 != at) {
+t0 = MEM_U32(sp + 68);
+goto L406a2c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 80) = v0;
+if (v0 == 0) goto L406b48;
+t8 = 0x100142b0;
+at = 0x29;
+a2 = 0x1;
+t8 = MEM_U8(t8 + 0);
+//nop;
+if (t8 == at) goto L4069f0;
+//nop;
+a0 = 0x1000e67c;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406b48;
+L4069f0:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x100142b0;
+t9 = MEM_U8(t9 + 0);
+if (t9 != at) {
+t0 = MEM_U32(sp + 68);
+goto L406a2c;}
+//nop;
+// bdead 40000103 t9 = t9;
+//nop;
+func_406624(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 68);
+L406a2c:
+t1 = MEM_U32(sp + 80);
+a0 = zero;
+t6 = 0x48;
+if (t0 != 0) goto L406a50;
+if (t1 != zero) {
+t3 = MEM_U32(sp + 68);
+goto L406a54;}
+t2 = 0x10014ac8;
+t2 = MEM_U32(t2 + 0);
+MEM_U32(sp + 80) = t2;
+L406a50:
+t3 = MEM_U32(sp + 68);
+L406a54:
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+t5 = MEM_U32(sp + 80);
+if (t3 == 0) goto L406b1c;
+t4 = 0x10015378;
+t4 = MEM_U32(t4 + 0);
+if (t4 == zero) {
+t5 = MEM_U32(sp + 80);
+goto L406a94;}
+//nop;
+a0 = MEM_U32(t3 + 24);
+a1 = 0x100142b8;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t5 = MEM_U32(sp + 80);
+L406a94:
+t0 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+if (t5 != 0) goto L406ae4;
+t6 = MEM_U32(sp + 68);
+t9 = MEM_U32(sp + 76);
+t7 = 0x1;
+a0 = MEM_U32(t6 + 24);
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x48;
+MEM_U32(sp + 20) = t8;
+// bdead 40010023 t9 = t9;
+MEM_U32(sp + 16) = t7;
+a1 = MEM_U32(sp + 88);
+a2 = MEM_U32(sp + 64);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+goto L406b40;
+L406ae4:
+t1 = MEM_U32(sp + 80);
+//nop;
+t3 = MEM_U32(sp + 76);
+a0 = MEM_U32(t0 + 24);
+a3 = MEM_U32(t1 + 20);
+t2 = 0x1;
+t4 = 0x48;
+// bdead 400039e3 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t2;
+MEM_U32(sp + 24) = t3;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+goto L406b40;
+L406b1c:
+//nop;
+t7 = MEM_U32(sp + 76);
+a3 = MEM_U32(t5 + 20);
+// bdead 400181e3 t9 = t9;
+MEM_U32(sp + 20) = t6;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 24) = t7;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+L406b40:
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+L406b48:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x58;
+//nop;
+return;
+}
+
+static void func_406b58(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406b58:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = zero;
+MEM_U32(sp + 72) = zero;
+MEM_U32(sp + 60) = zero;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 68) = v0;
+if ((int)v0 < 0) goto L406ba0;
+//nop;
+if ((int)v0 < (int)0x20) goto L406bbc;
+L406ba0:
+//nop;
+a0 = 0x1000e68c;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L406bbc:
+t6 = 0x100142b0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 != at) goto L406cb4;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x3c;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L406c34;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x3c;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 60);
+a2 = 0x2;
+t7 = 0x10013a74;
+t7 = MEM_U32(t7 + 0);
+if (t7 == zero) {
+t9 = MEM_U32(sp + 60);
+goto L406c38;}
+//nop;
+a0 = 0x1000e6b8;
+a1 = MEM_U32(t8 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L406c34:
+t9 = MEM_U32(sp + 60);
+L406c38:
+at = 0x4;
+v0 = MEM_U32(t9 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L406c54;}
+MEM_U32(sp + 60) = zero;
+goto L406cb4;
+at = 0x3;
+L406c54:
+//nop;
+if (v0 != at) goto L406cb4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x2d;
+goto L406cb4;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x28;
+goto L406cb4;}
+at = 0x28;
+if (v0 == at) {
+at = 0x23;
+goto L406cb4;}
+at = 0x23;
+a1 = zero;
+if (v0 == at) goto L406cb4;
+//nop;
+a0 = 0x1000e6dc;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406e98;
+L406cb4:
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x64;
+goto L406d00;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L406d00;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L406d00;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L406d00;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L406d00;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L406d00;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L406d00;}
+at = 0x28;
+if (v0 != at) {
+t3 = MEM_U32(sp + 60);
+goto L406da8;}
+L406d00:
+//nop;
+a0 = sp + 0x48;
+a1 = sp + 0x40;
+//nop;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t0 = MEM_U32(sp + 72);
+// bdead 40000303 gp = MEM_U32(sp + 40);
+if (t0 != zero) {
+t3 = MEM_U32(sp + 60);
+goto L406da8;}
+t1 = 0x100142b0;
+at = 0x28;
+t1 = MEM_U8(t1 + 0);
+if (t1 != at) {
+t3 = MEM_U32(sp + 60);
+goto L406da8;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 72) = v0;
+if (v0 == 0) goto L406e98;
+t2 = 0x100142b0;
+at = 0x29;
+a2 = 0x1;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 == at) goto L406d94;
+//nop;
+a0 = 0x1000e6f8;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406e98;
+L406d94:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 60);
+L406da8:
+t4 = MEM_U32(sp + 72);
+a0 = zero;
+t0 = 0x48;
+if (t3 != 0) goto L406dcc;
+if (t4 != zero) {
+t6 = MEM_U32(sp + 64);
+goto L406dd0;}
+t5 = 0x10014ac8;
+t5 = MEM_U32(t5 + 0);
+MEM_U32(sp + 72) = t5;
+L406dcc:
+t6 = MEM_U32(sp + 64);
+L406dd0:
+t8 = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 80);
+t7 = t6 & 0xffff;
+MEM_U32(sp + 64) = t7;
+if (t8 == 0) goto L406e68;
+t9 = MEM_U32(sp + 72);
+t2 = MEM_U32(sp + 60);
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 68);
+if (t9 != 0) goto L406e30;
+//nop;
+a0 = MEM_U32(t8 + 24);
+t0 = 0xe;
+t1 = 0x48;
+// bdead 40010621 t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+MEM_U32(sp + 24) = t7;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 68);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406e98;
+L406e30:
+t3 = MEM_U32(sp + 72);
+//nop;
+t6 = MEM_U32(sp + 64);
+a0 = MEM_U32(t2 + 24);
+a3 = MEM_U32(t3 + 20);
+t4 = 0xe;
+t5 = 0x48;
+// bdead 4000e1e1 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = t6;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L406e98;
+L406e68:
+t9 = MEM_U32(sp + 72);
+t1 = MEM_U32(sp + 64);
+t8 = 0xe;
+a3 = MEM_U32(t9 + 20);
+//nop;
+MEM_U32(sp + 20) = t0;
+MEM_U32(sp + 16) = t8;
+// bdead 40000561 t9 = t9;
+a2 = MEM_U32(sp + 68);
+MEM_U32(sp + 24) = t1;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L406e98:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_406ea8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L406ea8:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffc0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000806f MEM_U32(sp + 44) = ra;
+// fdead 4000806f MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+MEM_U32(sp + 56) = zero;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 52) = zero;
+if (t6 != at) goto L406fc4;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x34;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L406f44;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x34;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(sp + 52);
+a2 = 0x2;
+t7 = 0x10013a74;
+t7 = MEM_U32(t7 + 0);
+if (t7 == zero) {
+t9 = MEM_U32(sp + 52);
+goto L406f48;}
+//nop;
+a0 = 0x1000e708;
+a1 = MEM_U32(t8 + 4);
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L406f44:
+t9 = MEM_U32(sp + 52);
+L406f48:
+at = 0x4;
+v0 = MEM_U32(t9 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L406f64;}
+MEM_U32(sp + 52) = zero;
+goto L406fc4;
+at = 0x3;
+L406f64:
+//nop;
+if (v0 != at) goto L406fc4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x2d;
+goto L406fc4;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x28;
+goto L406fc4;}
+at = 0x28;
+if (v0 == at) {
+at = 0x23;
+goto L406fc4;}
+at = 0x23;
+a1 = zero;
+if (v0 == at) goto L406fc4;
+//nop;
+a0 = 0x1000e72c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4071a0;
+L406fc4:
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x64;
+goto L4070b4;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L4070b4;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L4070b4;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L4070b4;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L4070b4;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L4070b4;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L4070b4;}
+at = 0x28;
+if (v0 == at) {
+t3 = MEM_U32(sp + 52);
+goto L4070b8;}
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x38;
+//nop;
+f_GetBaseOrExpr(mem, sp, a0, a1);
+t0 = MEM_U32(sp + 60);
+// bdead 40000303 gp = MEM_U32(sp + 40);
+if (t0 != zero) {
+t3 = MEM_U32(sp + 52);
+goto L4070b8;}
+t1 = 0x100142b0;
+at = 0x28;
+t1 = MEM_U8(t1 + 0);
+if (t1 != at) {
+t3 = MEM_U32(sp + 52);
+goto L4070b8;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L4071a0;
+t2 = 0x100142b0;
+at = 0x29;
+a2 = 0x1;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 == at) goto L4070a4;
+//nop;
+a0 = 0x1000e748;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4071a0;
+L4070a4:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+L4070b4:
+t3 = MEM_U32(sp + 52);
+L4070b8:
+t4 = MEM_U32(sp + 60);
+a0 = zero;
+a2 = 0x48;
+if (t3 != 0) goto L4070dc;
+if (t4 != zero) {
+t6 = MEM_U32(sp + 52);
+goto L4070e0;}
+t5 = 0x10014ac8;
+t5 = MEM_U32(t5 + 0);
+MEM_U32(sp + 60) = t5;
+L4070dc:
+t6 = MEM_U32(sp + 52);
+L4070e0:
+a1 = MEM_U32(sp + 64);
+t7 = MEM_U32(sp + 60);
+//nop;
+if (t6 == 0) goto L407178;
+t7 = MEM_U32(sp + 60);
+t1 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 64);
+a2 = 0x48;
+if (t7 != 0) goto L407140;
+a0 = MEM_U32(t6 + 24);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t0 = MEM_U32(sp + 56);
+t8 = 0x1;
+// bdead 42000221 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a1 = MEM_U32(sp + 64);
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t0;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4071a0;
+L407140:
+t2 = MEM_U32(sp + 60);
+//nop;
+t5 = MEM_U32(sp + 56);
+a0 = MEM_U32(t1 + 24);
+a3 = MEM_U32(t2 + 20);
+t3 = 0x1;
+t4 = 0x48;
+// bdead 400071e1 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = t5;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4071a0;
+L407178:
+//nop;
+t8 = MEM_U32(sp + 56);
+a3 = MEM_U32(t7 + 20);
+t6 = 0x48;
+// bdead 420081e3 t9 = t9;
+MEM_U32(sp + 20) = t6;
+MEM_U32(sp + 16) = zero;
+MEM_U32(sp + 24) = t8;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L4071a0:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_4071b0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L4071b0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffb90;
+// fdead 4000002b MEM_U32(sp + 40) = s0;
+s0 = 0x100142b0;
+// fdead 4002002b MEM_U32(sp + 64) = s6;
+at = 0x2d;
+v0 = MEM_U8(s0 + 0);
+// fdead 4002002f MEM_U32(sp + 76) = ra;
+// fdead 4002002f MEM_U32(sp + 72) = gp;
+// fdead 4002002f MEM_U32(sp + 68) = s7;
+// fdead 4002002f MEM_U32(sp + 60) = s5;
+// fdead 4002002f MEM_U32(sp + 56) = s4;
+// fdead 4002002f MEM_U32(sp + 52) = s3;
+// fdead 4002002f MEM_U32(sp + 48) = s2;
+// fdead 4002002f MEM_U32(sp + 44) = s1;
+s6 = zero;
+if (v0 != at) goto L407218;
+//nop;
+s6 = 0x1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40820103 gp = MEM_U32(sp + 72);
+v0 = MEM_U8(s0 + 0);
+goto L407238;
+L407218:
+at = 0x2b;
+if (v0 != at) {
+at = 0x66;
+goto L40723c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40820103 gp = MEM_U32(sp + 72);
+v0 = MEM_U8(s0 + 0);
+L407238:
+at = 0x66;
+L40723c:
+a0 = sp + 0x60;
+if (v0 == at) goto L407284;
+//nop;
+a0 = 0x1000e758;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U8(s0 + 0);
+at = 0x23;
+// bdead 40008105 gp = MEM_U32(sp + 72);
+if (t6 == at) {
+// bdead 1 ra = MEM_U32(sp + 76);
+goto L4073e8;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 72);
+goto L4073e4;
+L407284:
+//nop;
+s7 = 0x100146b8;
+a1 = 0x100142b8;
+s7 = MEM_U32(s7 + 0);
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 41820103 gp = MEM_U32(sp + 72);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 41820003 gp = MEM_U32(sp + 72);
+at = 0x17;
+a0 = zero;
+s1 = 0x10015350;
+a3 = 0x48;
+t9 = 0x2;
+t7 = MEM_U16(s1 + 4);
+t0 = 0x48;
+t1 = s6 + s7;
+t8 = t7 & 0x3f;
+//nop;
+if (t8 != at) goto L40730c;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = MEM_U32(s1 + 4);
+a2 = MEM_U32(s1 + 8);
+// bdead 418407e3 t9 = t9;
+a1 = a1 << 22;
+a1 = a1 >> 23;
+MEM_U32(sp + 20) = t0;
+MEM_U32(sp + 24) = t1;
+a2 = a2 >> 25;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 41840003 gp = MEM_U32(sp + 72);
+goto L407368;
+L40730c:
+at = 0x10015350;
+t2 = s6 + s7;
+t4 = 0x1;
+MEM_U32(at + 8) = t2;
+t3 = MEM_U8(s0 + 0);
+at = 0x3a;
+if (t3 != at) {
+MEM_U32(s1 + 12) = t4;
+goto L407358;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 41840103 gp = MEM_U32(sp + 72);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4184000b gp = MEM_U32(sp + 72);
+MEM_U32(s1 + 12) = v0;
+goto L407358;
+// fdead 0 MEM_U32(s1 + 12) = t4;
+L407358:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41840003 gp = MEM_U32(sp + 72);
+L407368:
+v0 = 0x10;
+if (s7 == 0) goto L4073d4;
+s0 = sp + 0x60;
+s2 = s7 + s0;
+s5 = 0x2d;
+s4 = sp + 0x60;
+s3 = 0x10;
+L407384:
+if (v0 != s3) {
+t6 = MEM_U8(s0 + 0);
+goto L4073c0;}
+//nop;
+if (s0 == s4) goto L4073a4;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40fe0003 gp = MEM_U32(sp + 72);
+L4073a4:
+v0 = zero;
+if (s6 == 0) goto L4073bc;
+MEM_U8(s1 + 0) = (uint8_t)s5;
+s6 = zero;
+v0 = 0x1;
+goto L4073bc;
+L4073bc:
+t6 = MEM_U8(s0 + 0);
+L4073c0:
+s0 = s0 + 0x1;
+t7 = s1 + v0;
+v0 = v0 + 0x1;
+MEM_U8(t7 + 0) = (uint8_t)t6;
+if (s0 != s2) goto L407384;
+L4073d4:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 72);
+L4073e4:
+// bdead 1 ra = MEM_U32(sp + 76);
+L4073e8:
+// bdead 1 s0 = MEM_U32(sp + 40);
+// bdead 1 s1 = MEM_U32(sp + 44);
+// bdead 1 s2 = MEM_U32(sp + 48);
+// bdead 1 s3 = MEM_U32(sp + 52);
+// bdead 1 s4 = MEM_U32(sp + 56);
+// bdead 1 s5 = MEM_U32(sp + 60);
+// bdead 1 s6 = MEM_U32(sp + 64);
+// bdead 1 s7 = MEM_U32(sp + 68);
+// bdead 1 sp = sp + 0x470;
+return;
+}
+
+static void func_407410(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L407410:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015350;
+t9 = a0;
+t0 = t9 << 1;
+t6 = MEM_U8(v1 + 5);
+t2 = MEM_U16(v1 + 6);
+t1 = t0 & 0x3fe;
+t7 = t6 & 0xffc0;
+t3 = t2 & 0xfc01;
+t8 = t7 | 0x17;
+t4 = t1 | t3;
+MEM_U32(v1 + 0) = zero;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+MEM_U16(v1 + 6) = (uint16_t)t4;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4601be7b MEM_U32(sp + 28) = ra;
+// fdead 4601be7b MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+if (v0 == 0) goto L407488;
+t6 = MEM_U32(v0 + 20);
+t9 = MEM_U8(v1 + 8);
+t8 = t6 << 1;
+t0 = t9 & 0xff01;
+t2 = t8 | t0;
+MEM_U8(v1 + 8) = (uint8_t)t2;
+L407488:
+t1 = MEM_U16(v1 + 8);
+t3 = t1 & 0xfe03;
+t4 = t3 | 0x120;
+MEM_U16(v1 + 8) = (uint16_t)t4;
+v0 = MEM_U32(v1 + 8);
+t5 = v0 >> 14;
+t6 = t5 ^ 0x2;
+t7 = t6 << 28;
+t9 = t7 >> 14;
+t8 = t9 ^ v0;
+//nop;
+MEM_U32(v1 + 8) = t8;
+// bdead 40000101 t9 = t9;
+//nop;
+func_4071b0(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_4074d8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4074d8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+MEM_U32(sp + 64) = zero;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 48) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4077f8;
+t7 = 0x1001536c;
+t6 = MEM_U32(v0 + 20);
+t8 = MEM_U32(sp + 80);
+t7 = MEM_U32(t7 + 0);
+at = 0xcd;
+MEM_U32(sp + 72) = t6;
+//nop;
+if (t7 == 0) goto L4075bc;
+//nop;
+if (t8 != at) goto L4075bc;
+t9 = 0x100142b0;
+at = 0x69;
+t9 = MEM_U8(t9 + 0);
+//nop;
+if (t9 != at) goto L4075bc;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x30;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4075b8;
+t0 = MEM_U32(sp + 48);
+t1 = MEM_U32(t0 + 16);
+//nop;
+if (t1 != 0) goto L4075b0;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t2 = 0x100142b0;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 != at) goto L4075bc;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+goto L4075bc;
+L4075b0:
+MEM_U32(sp + 48) = zero;
+goto L4075bc;
+L4075b8:
+MEM_U32(sp + 48) = zero;
+L4075bc:
+t3 = 0x100142b0;
+at = 0x25;
+t3 = MEM_U8(t3 + 0);
+//nop;
+if (t3 != at) goto L4075f0;
+//nop;
+a0 = sp + 0x44;
+a1 = sp + 0x40;
+// bdead 40000163 t9 = t9;
+//nop;
+func_406340(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+goto L407710;
+L4075f0:
+t4 = 0x10013a3c;
+t4 = MEM_U8(t4 + 0);
+//nop;
+if ((int)t4 >= (int)0x3) goto L40761c;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+goto L407710;
+L40761c:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L407708;
+t5 = MEM_U32(sp + 80);
+at = 0xcd;
+a1 = zero;
+if (t5 != at) {
+t6 = MEM_U32(sp + 80);
+goto L407668;}
+//nop;
+a0 = 0x1000e77c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t6 = MEM_U32(sp + 80);
+L407668:
+at = 0x29;
+if (t6 == at) {
+t9 = MEM_U32(sp + 56);
+goto L407698;}
+//nop;
+a0 = 0x1000e79c;
+a1 = 0x1000e7a8;
+a2 = 0x44a;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t9 = MEM_U32(sp + 56);
+L407698:
+t7 = 0x2;
+t8 = 0x48;
+MEM_U32(sp + 24) = t9;
+//nop;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+// bdead 40000003 t9 = t9;
+a0 = zero;
+a1 = 0x14c;
+a2 = MEM_U32(sp + 72);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 52);
+t0 = 0x2;
+//nop;
+t1 = 0x48;
+MEM_U32(sp + 20) = t1;
+// fdead 60000e1f t9 = t9;
+MEM_U32(sp + 16) = t0;
+a0 = zero;
+a1 = 0x14c;
+a2 = MEM_U32(sp + 72);
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4077f8;
+L407708:
+t3 = MEM_U32(sp + 52);
+MEM_U32(sp + 64) = t3;
+L407710:
+t4 = MEM_U32(sp + 80);
+at = 0xcd;
+t5 = MEM_U32(sp + 68);
+if (t4 != at) {
+t0 = MEM_U32(sp + 68);
+goto L407760;}
+t6 = MEM_U32(sp + 64);
+if (t5 != 0) goto L40775c;
+t7 = t6 >> 16;
+a1 = zero;
+if (t7 == 0) goto L407750;
+//nop;
+a0 = 0x1000e7b4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+L407750:
+t8 = MEM_U32(sp + 64);
+t9 = t8 << 16;
+MEM_U32(sp + 64) = t9;
+L40775c:
+t0 = MEM_U32(sp + 68);
+L407760:
+a0 = zero;
+t1 = MEM_U32(sp + 80);
+at = 0xcd;
+if (t0 == 0) goto L407778;
+a0 = MEM_U32(t0 + 24);
+goto L407778;
+L407778:
+t2 = MEM_U32(sp + 48);
+if (t1 != at) goto L4077bc;
+a1 = t1;
+if (t2 == 0) goto L4077bc;
+//nop;
+t5 = MEM_U32(sp + 64);
+a3 = MEM_U32(t2 + 20);
+t3 = 0x4;
+t4 = 0x48;
+// bdead 40007163 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+a2 = MEM_U32(sp + 72);
+MEM_U32(sp + 24) = t5;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+goto L4077f0;
+L4077bc:
+//nop;
+t8 = MEM_U32(sp + 64);
+t6 = 0x2;
+t7 = 0x48;
+// bdead 42018023 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t6;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 72);
+a3 = 0x48;
+MEM_U32(sp + 24) = t8;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+L4077f0:
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+L4077f8:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_407808(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L407808:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 84) = zero;
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 60) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 92) = v0;
+if (v0 == 0) goto L4081ac;
+t6 = 0x100142b0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+if (t6 != at) {
+t1 = MEM_U32(sp + 80);
+goto L407918;}
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x58;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L407914;
+t7 = MEM_U32(sp + 88);
+t8 = MEM_U32(t7 + 16);
+if (t8 != zero) {
+t1 = MEM_U32(sp + 80);
+goto L407918;}
+//nop;
+MEM_U32(sp + 84) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (v0 != at) {
+at = 0x69;
+goto L4078cc;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+at = 0x69;
+L4078cc:
+if (v0 != at) {
+t1 = MEM_U32(sp + 80);
+goto L407918;}
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x58;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L407914;
+t9 = MEM_U32(sp + 88);
+t0 = MEM_U32(t9 + 16);
+if (t0 != zero) {
+t1 = MEM_U32(sp + 80);
+goto L407918;}
+MEM_U32(sp + 80) = t9;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L407914:
+t1 = MEM_U32(sp + 80);
+L407918:
+v1 = zero;
+if (t1 != zero) {
+t8 = MEM_U32(sp + 84);
+goto L407be8;}
+v0 = 0x100142b0;
+at = 0x25;
+t2 = MEM_U32(sp + 84);
+v0 = MEM_U8(v0 + 0);
+if (v0 != at) {
+at = 0x69;
+goto L4079dc;}
+a1 = zero;
+if (t2 != 0) goto L407960;
+//nop;
+a0 = 0x1000e7d4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407960:
+//nop;
+a0 = sp + 0x4c;
+a1 = sp + 0x44;
+// bdead 40000163 t9 = t9;
+//nop;
+func_406340(mem, sp, a0, a1);
+t3 = MEM_U32(sp + 76);
+// bdead 40001003 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 96);
+t4 = MEM_U32(sp + 92);
+if (t3 == 0) goto L407994;
+a0 = MEM_U32(t3 + 24);
+goto L407998;
+L407994:
+a0 = zero;
+L407998:
+t5 = MEM_U32(sp + 84);
+//nop;
+t7 = MEM_U32(sp + 68);
+a2 = MEM_U32(t4 + 20);
+a3 = MEM_U32(t5 + 20);
+t6 = 0x4;
+t8 = 0x48;
+// fdead 6201f1ff t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = t7;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+goto L4081ac;
+at = 0x69;
+L4079dc:
+if (v0 == at) {
+at = 0x64;
+goto L407a1c;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L407a1c;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L407a1c;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L407a1c;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L407a1c;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L407a1c;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L407a1c;}
+at = 0x28;
+//nop;
+if (v0 != at) goto L407a80;
+L407a1c:
+t0 = 0x10013a3c;
+t0 = MEM_U8(t0 + 0);
+//nop;
+if ((int)t0 >= (int)0x3) goto L407a48;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 68) = v0;
+goto L407a64;
+L407a48:
+//nop;
+a0 = sp + 0x40;
+a1 = sp + 0x44;
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+L407a64:
+t9 = MEM_U32(sp + 84);
+t1 = MEM_U32(sp + 92);
+//nop;
+if (t9 != 0) goto L407a78;
+MEM_U32(sp + 84) = t1;
+L407a78:
+v1 = 0x1;
+goto L407be4;
+L407a80:
+t2 = 0x10013a3c;
+a1 = MEM_U32(sp + 96);
+t2 = MEM_U8(t2 + 0);
+if ((int)t2 < (int)0x2) {
+at = (int)a1 < (int)0x110;
+goto L407bd4;}
+if ((int)a1 < (int)0x110) {
+at = (int)a1 < (int)0x15b;
+goto L407afc;}
+t4 = a1 + 0xfffffeb1;
+if ((int)a1 < (int)0x15b) goto L407ad4;
+t3 = a1 + 0xfffffe8c;
+if (t3 >= 0x18) {
+t5 = MEM_U32(sp + 84);
+goto L407bd8;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L407b5c;
+case 1: goto L407b5c;
+case 2: goto L407bd4;
+case 3: goto L407bd4;
+case 4: goto L407bd4;
+case 5: goto L407bd4;
+case 6: goto L407bd4;
+case 7: goto L407bd4;
+case 8: goto L407bd4;
+case 9: goto L407bd4;
+case 10: goto L407bd4;
+case 11: goto L407bd4;
+case 12: goto L407bd4;
+case 13: goto L407bd4;
+case 14: goto L407bd4;
+case 15: goto L407bd4;
+case 16: goto L407bd4;
+case 17: goto L407bd4;
+case 18: goto L407bd4;
+case 19: goto L407bd4;
+case 20: goto L407b5c;
+case 21: goto L407b5c;
+case 22: goto L407b5c;
+case 23: goto L407b5c;
+}
+L407ad4:
+if (t4 >= 0xc) {
+t5 = MEM_U32(sp + 84);
+goto L407bd8;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L407b98;
+case 1: goto L407b98;
+case 2: goto L407b98;
+case 3: goto L407b98;
+case 4: goto L407b98;
+case 5: goto L407b98;
+case 6: goto L407b98;
+case 7: goto L407b98;
+case 8: goto L407b98;
+case 9: goto L407b98;
+case 10: goto L407b98;
+case 11: goto L407b98;
+}
+L407afc:
+t6 = a1 + 0xffffff18;
+if ((int)a1 < (int)0xee) goto L407b34;
+t5 = a1 + 0xfffffef9;
+if (t5 >= 0x9) {
+t5 = MEM_U32(sp + 84);
+goto L407bd8;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L407b98;
+case 1: goto L407b98;
+case 2: goto L407b98;
+case 3: goto L407bd4;
+case 4: goto L407bd4;
+case 5: goto L407bd4;
+case 6: goto L407b98;
+case 7: goto L407b98;
+case 8: goto L407b98;
+}
+L407b34:
+if (t6 >= 0x6) {
+t5 = MEM_U32(sp + 84);
+goto L407bd8;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L407b98;
+case 1: goto L407b98;
+case 2: goto L407b98;
+case 3: goto L407b98;
+case 4: goto L407b98;
+case 5: goto L407b98;
+}
+L407b5c:
+t8 = MEM_U32(sp + 92);
+t7 = MEM_U32(sp + 84);
+t9 = 0x40;
+a2 = MEM_U32(t8 + 20);
+a3 = MEM_U32(t7 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t0 = 0x3;
+MEM_U32(sp + 16) = t0;
+// bdead 400001c3 t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407b98:
+t1 = MEM_U32(sp + 92);
+t2 = MEM_U32(sp + 84);
+//nop;
+a2 = MEM_U32(t1 + 20);
+a3 = MEM_U32(t2 + 20);
+t3 = 0x5;
+t4 = 0x48;
+// bdead 400031c3 t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407bd4:
+t5 = MEM_U32(sp + 84);
+L407bd8:
+t6 = MEM_U32(sp + 92);
+MEM_U32(sp + 80) = t5;
+MEM_U32(sp + 84) = t6;
+L407be4:
+t8 = MEM_U32(sp + 84);
+L407be8:
+// bdead 42000113 a1 = MEM_U32(sp + 96);
+t7 = MEM_U32(sp + 80);
+a2 = 0x1;
+if (t8 == 0) goto L407c08;
+a3 = MEM_U32(sp + 96);
+if (t7 != 0) goto L407c24;
+if (v1 != zero) {
+at = (int)a3 < (int)0xee;
+goto L407c28;}
+L407c08:
+//nop;
+a0 = 0x1000e7f0;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407c24:
+at = (int)a3 < (int)0xee;
+L407c28:
+v0 = a3;
+if (at != 0) goto L407cc4;
+t0 = v0 + 0xfffffe91;
+if ((int)a3 < (int)0x13d) goto L407c64;
+//nop;
+if (t0 >= 0x2e) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t0) {
+case 0: goto L407d98;
+case 1: goto L407d98;
+case 2: goto L407fb4;
+case 3: goto L407fb4;
+case 4: goto L407fb4;
+case 5: goto L407f88;
+case 6: goto L407f88;
+case 7: goto L407fb4;
+case 8: goto L407fb4;
+case 9: goto L407fb4;
+case 10: goto L407fb4;
+case 11: goto L407fb4;
+case 12: goto L407fb4;
+case 13: goto L407fb4;
+case 14: goto L407fb4;
+case 15: goto L407fb4;
+case 16: goto L407fb4;
+case 17: goto L407fb4;
+case 18: goto L407fb4;
+case 19: goto L407fb4;
+case 20: goto L407fb4;
+case 21: goto L407fb4;
+case 22: goto L407fb4;
+case 23: goto L407fb4;
+case 24: goto L407fb4;
+case 25: goto L407f88;
+case 26: goto L407f88;
+case 27: goto L407f88;
+case 28: goto L407f88;
+case 29: goto L407fb4;
+case 30: goto L407fb4;
+case 31: goto L407fb4;
+case 32: goto L407fb4;
+case 33: goto L407fb4;
+case 34: goto L407fb4;
+case 35: goto L407fb4;
+case 36: goto L407fb4;
+case 37: goto L407fb4;
+case 38: goto L407fb4;
+case 39: goto L407fb4;
+case 40: goto L407fb4;
+case 41: goto L407fb4;
+case 42: goto L407fb4;
+case 43: goto L407dd8;
+case 44: goto L407dd8;
+case 45: goto L407dd8;
+}
+L407c64:
+t1 = v0 + 0xfffffef9;
+if ((int)a3 < (int)0x110) goto L407c9c;
+t9 = v0 + 0xfffffecc;
+//nop;
+if (t9 >= 0x9) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t9) {
+case 0: goto L407e58;
+case 1: goto L407e58;
+case 2: goto L407fb4;
+case 3: goto L407fb4;
+case 4: goto L407fb4;
+case 5: goto L407fb4;
+case 6: goto L407d98;
+case 7: goto L407d98;
+case 8: goto L407d98;
+}
+L407c9c:
+//nop;
+if (t1 >= 0x9) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L407f58;
+case 1: goto L407f58;
+case 2: goto L407f58;
+case 3: goto L407fb4;
+case 4: goto L407fb4;
+case 5: goto L407fb4;
+case 6: goto L407f58;
+case 7: goto L407f58;
+case 8: goto L407f58;
+}
+L407cc4:
+t2 = v0 + 0xffffff2d;
+if ((int)a3 < (int)0x88) goto L407cf8;
+//nop;
+if (t2 >= 0x1b) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L407e58;
+case 1: goto L407e58;
+case 2: goto L407e58;
+case 3: goto L407e58;
+case 4: goto L407e58;
+case 5: goto L407e58;
+case 6: goto L407e58;
+case 7: goto L407fb4;
+case 8: goto L407fb4;
+case 9: goto L407fb4;
+case 10: goto L407fb4;
+case 11: goto L407fb4;
+case 12: goto L407fb4;
+case 13: goto L407fb4;
+case 14: goto L407fb4;
+case 15: goto L407fb4;
+case 16: goto L407fb4;
+case 17: goto L407fb4;
+case 18: goto L407fb4;
+case 19: goto L407fb4;
+case 20: goto L407fb4;
+case 21: goto L407f58;
+case 22: goto L407f58;
+case 23: goto L407f58;
+case 24: goto L407f58;
+case 25: goto L407f58;
+case 26: goto L407f58;
+}
+L407cf8:
+t4 = v0 + 0xffffffbc;
+if ((int)a3 < (int)0x55) goto L407d30;
+t3 = v0 + 0xffffff84;
+//nop;
+if (t3 >= 0xc) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L407f58;
+case 1: goto L407f58;
+case 2: goto L407f58;
+case 3: goto L407f58;
+case 4: goto L407f58;
+case 5: goto L407f58;
+case 6: goto L407f58;
+case 7: goto L407f58;
+case 8: goto L407f58;
+case 9: goto L407f58;
+case 10: goto L407f58;
+case 11: goto L407f58;
+}
+L407d30:
+//nop;
+if (t4 >= 0x11) goto L407fb4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L407d58;
+case 1: goto L407d58;
+case 2: goto L407fb4;
+case 3: goto L407fb4;
+case 4: goto L407fb4;
+case 5: goto L407fb4;
+case 6: goto L407fb4;
+case 7: goto L407fb4;
+case 8: goto L407fb4;
+case 9: goto L407fb4;
+case 10: goto L407fb4;
+case 11: goto L407d58;
+case 12: goto L407fb4;
+case 13: goto L407fb4;
+case 14: goto L407fb4;
+case 15: goto L407d58;
+case 16: goto L407d58;
+}
+L407d58:
+t5 = MEM_U32(sp + 68);
+if (v1 == 0) goto L407fb4;
+at = (int)t5 < (int)0x20;
+if ((int)t5 < 0) goto L407d78;
+t6 = MEM_U32(sp + 60);
+if ((int)t5 >= (int)0x20) goto L407d78;
+//nop;
+if (t6 == 0) goto L407fb4;
+L407d78:
+//nop;
+a0 = 0x1000e80c;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407d98:
+t8 = MEM_U32(sp + 68);
+if (v1 == 0) goto L407fb4;
+at = (int)t8 < (int)0x40;
+if ((int)t8 < 0) goto L407db8;
+t7 = MEM_U32(sp + 60);
+if ((int)t8 >= (int)0x40) goto L407db8;
+//nop;
+if (t7 == 0) goto L407fb4;
+L407db8:
+//nop;
+a0 = 0x1000e824;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407dd8:
+t0 = MEM_U32(sp + 68);
+if (v1 == 0) goto L407e18;
+at = (int)t0 < (int)0x20;
+if ((int)t0 < 0) goto L407df8;
+t9 = MEM_U32(sp + 60);
+if ((int)t0 >= (int)0x20) goto L407df8;
+if (t9 == zero) {
+t1 = MEM_U32(sp + 68);
+goto L407e1c;}
+L407df8:
+//nop;
+a0 = 0x1000e83c;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407e18:
+t1 = MEM_U32(sp + 68);
+L407e1c:
+at = 0x19a;
+t3 = 0x13a;
+t2 = t1 + 0x20;
+MEM_U32(sp + 68) = t2;
+if (v0 != at) goto L407e38;
+MEM_U32(sp + 96) = t3;
+goto L407fb4;
+L407e38:
+at = 0x19b;
+t5 = 0x13c;
+if (v0 != at) goto L407e50;
+t4 = 0x13b;
+MEM_U32(sp + 96) = t4;
+goto L407fb4;
+L407e50:
+MEM_U32(sp + 96) = t5;
+goto L407fb4;
+L407e58:
+at = 0xd7;
+if (v1 != 0) goto L407e80;
+//nop;
+a0 = 0x1000e854;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+L407e80:
+t6 = MEM_U32(sp + 68);
+if (a3 == at) goto L407e9c;
+at = 0xd8;
+if (a3 == at) {
+at = 0xd9;
+goto L407e9c;}
+at = 0xd9;
+t7 = MEM_U32(sp + 68);
+if (a3 != at) goto L407ee4;
+L407e9c:
+at = 0x10000;
+a2 = 0x1;
+if ((int)t6 >= (int)at) goto L407ebc;
+t8 = MEM_U32(sp + 60);
+if ((int)t6 < 0) goto L407ebc;
+//nop;
+if (t8 == 0) goto L407fb4;
+L407ebc:
+//nop;
+a0 = 0x1000e874;
+a1 = zero;
+MEM_U32(sp + 72) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 72);
+a3 = MEM_U32(sp + 96);
+goto L407fb4;
+L407ee4:
+at = 0x10000;
+a2 = 0x1;
+if ((int)t7 >= (int)at) goto L407f0c;
+at = 0x8000;
+if ((int)t7 < (int)at) {
+at = 0xffff0000;
+goto L407f0c;}
+at = 0xffff0000;
+t0 = t7 + at;
+MEM_U32(sp + 68) = t0;
+L407f0c:
+t9 = MEM_U32(sp + 68);
+at = 0x8000;
+if ((int)t9 >= (int)at) {
+at = (int)t9 < (int)0xffff8000;
+goto L407f30;}
+t1 = MEM_U32(sp + 60);
+if ((int)t9 < (int)0xffff8000) goto L407f30;
+//nop;
+if (t1 == 0) goto L407fb4;
+L407f30:
+//nop;
+a0 = 0x1000e890;
+a1 = zero;
+MEM_U32(sp + 72) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 72);
+a3 = MEM_U32(sp + 96);
+goto L407fb4;
+L407f58:
+a2 = 0x1;
+if (v1 == 0) goto L407fb4;
+//nop;
+a0 = 0x1000e8b0;
+a1 = zero;
+MEM_U32(sp + 72) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 72);
+a3 = MEM_U32(sp + 96);
+goto L407fb4;
+L407f88:
+a2 = 0x1;
+if (v1 == 0) goto L407fb4;
+//nop;
+a0 = 0x1000e8d4;
+a1 = zero;
+MEM_U32(sp + 72) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 72);
+a3 = MEM_U32(sp + 96);
+L407fb4:
+if (v1 == zero) {
+t4 = MEM_U32(sp + 92);
+goto L408170;}
+t2 = 0x10013a4c;
+t3 = MEM_U32(sp + 60);
+t4 = MEM_U32(sp + 96);
+t2 = MEM_U32(t2 + 0);
+MEM_U32(sp + 56) = t2;
+if (t3 == 0) goto L408128;
+t5 = t4 + 0xffffffe0;
+if ((int)t4 < (int)0x3) goto L408008;
+if (t5 >= 0x37) {
+t8 = MEM_U32(sp + 56);
+goto L408040;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t5) {
+case 0: goto L408020;
+case 1: goto L408020;
+case 2: goto L40803c;
+case 3: goto L40803c;
+case 4: goto L40803c;
+case 5: goto L40803c;
+case 6: goto L40803c;
+case 7: goto L40803c;
+case 8: goto L40803c;
+case 9: goto L40803c;
+case 10: goto L40803c;
+case 11: goto L40803c;
+case 12: goto L40803c;
+case 13: goto L40803c;
+case 14: goto L40803c;
+case 15: goto L40803c;
+case 16: goto L40803c;
+case 17: goto L40803c;
+case 18: goto L40803c;
+case 19: goto L40803c;
+case 20: goto L40803c;
+case 21: goto L40803c;
+case 22: goto L40803c;
+case 23: goto L40803c;
+case 24: goto L408020;
+case 25: goto L408020;
+case 26: goto L408020;
+case 27: goto L40803c;
+case 28: goto L40803c;
+case 29: goto L40803c;
+case 30: goto L40803c;
+case 31: goto L40803c;
+case 32: goto L40803c;
+case 33: goto L408020;
+case 34: goto L408020;
+case 35: goto L40803c;
+case 36: goto L40803c;
+case 37: goto L40803c;
+case 38: goto L40803c;
+case 39: goto L40803c;
+case 40: goto L40803c;
+case 41: goto L40803c;
+case 42: goto L40803c;
+case 43: goto L40803c;
+case 44: goto L40803c;
+case 45: goto L40803c;
+case 46: goto L40803c;
+case 47: goto L40803c;
+case 48: goto L40803c;
+case 49: goto L40803c;
+case 50: goto L40803c;
+case 51: goto L40803c;
+case 52: goto L40803c;
+case 53: goto L408020;
+case 54: goto L408020;
+}
+L408008:
+t6 = MEM_U32(sp + 96);
+at = 0x1;
+if (t6 == at) {
+at = 0x2;
+goto L408020;}
+at = 0x2;
+if (t6 != at) {
+t8 = MEM_U32(sp + 56);
+goto L408040;}
+L408020:
+//nop;
+a0 = 0x1000e8f8;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L40803c:
+t8 = MEM_U32(sp + 56);
+L408040:
+a1 = zero;
+if (t8 != zero) {
+t9 = MEM_U32(sp + 64);
+goto L408068;}
+//nop;
+a0 = 0x1000e918;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t9 = MEM_U32(sp + 64);
+L408068:
+at = 0x10013a4c;
+t7 = 0x2;
+MEM_U32(sp + 24) = t9;
+//nop;
+t0 = 0x48;
+MEM_U32(sp + 20) = t0;
+// bdead 40010007 t9 = t9;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t3 = MEM_U32(sp + 68);
+t1 = 0x2;
+//nop;
+t2 = 0x48;
+MEM_U32(sp + 20) = t2;
+// fdead 60001c1f t9 = t9;
+MEM_U32(sp + 16) = t1;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(sp + 24) = t3;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 92);
+t5 = MEM_U32(sp + 84);
+//nop;
+a2 = MEM_U32(t4 + 20);
+a3 = MEM_U32(t5 + 20);
+t6 = 0x3;
+t8 = 0x1;
+// fdead 6200e19f t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+a1 = MEM_U32(sp + 96);
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t7 = MEM_U32(sp + 56);
+at = 0x10013a4c;
+MEM_U32(at + 0) = t7;
+goto L4081ac;
+L408128:
+t9 = MEM_U32(sp + 84);
+t0 = MEM_U32(sp + 92);
+t3 = MEM_U32(sp + 68);
+a3 = MEM_U32(t9 + 20);
+//nop;
+a2 = MEM_U32(t0 + 20);
+t1 = 0x4;
+t2 = 0x48;
+// bdead 40001d83 t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a0 = zero;
+a1 = MEM_U32(sp + 96);
+MEM_U32(sp + 24) = t3;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4081ac;
+// fdead 0 t4 = MEM_U32(sp + 92);
+L408170:
+t5 = MEM_U32(sp + 84);
+t8 = MEM_U32(sp + 80);
+//nop;
+t6 = 0x3;
+a2 = MEM_U32(t4 + 20);
+a3 = MEM_U32(t5 + 20);
+MEM_U32(sp + 16) = t6;
+t7 = MEM_U32(t8 + 20);
+// bdead 40010183 t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+a1 = MEM_U32(sp + 96);
+MEM_U32(sp + 20) = t7;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L4081ac:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x60;
+//nop;
+return;
+}
+
+static void func_4081bc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4081bc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+t0 = v0;
+if (v0 == 0) goto L4082f0;
+t6 = 0x100142b0;
+at = 0x23;
+v1 = v0;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 == at) goto L408234;
+//nop;
+MEM_U32(sp + 60) = t0;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+t0 = MEM_U32(sp + 60);
+v1 = v0;
+if (v0 != 0) goto L408234;
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4082f4;
+L408234:
+a0 = zero;
+if ((int)a1 < (int)0x9d) goto L4082c4;
+//nop;
+if ((int)a1 >= (int)0xcd) goto L4082c4;
+t7 = 0x100142b0;
+at = 0x23;
+a2 = 0x40;
+t7 = MEM_U8(t7 + 0);
+if (t7 == at) {
+a3 = MEM_U32(t0 + 20);
+goto L408294;}
+//nop;
+a2 = MEM_U32(t0 + 20);
+MEM_U32(sp + 60) = v1;
+MEM_U32(sp + 48) = a2;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 64);
+a2 = MEM_U32(sp + 48);
+t0 = MEM_U32(sp + 60);
+v1 = v0;
+if (v0 == 0) goto L4082f0;
+a3 = MEM_U32(t0 + 20);
+L408294:
+t8 = 0x3;
+MEM_U32(sp + 16) = t8;
+t9 = MEM_U32(v1 + 20);
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+MEM_U32(sp + 20) = t9;
+//nop;
+// bdead 400001e1 t9 = t9;
+//nop;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4082f0;
+L4082c4:
+//nop;
+a2 = MEM_U32(t0 + 20);
+a3 = MEM_U32(v1 + 20);
+t1 = 0x5;
+t2 = 0x48;
+// fdead 60008fff t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L4082f0:
+// bdead 1 ra = MEM_U32(sp + 44);
+L4082f4:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_408300(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408300:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L4083f8;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4083f8;
+//nop;
+MEM_U32(sp + 56) = v0;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+t1 = v0;
+if (v0 == 0) goto L4083f8;
+t6 = 0x100142b0;
+at = 0x23;
+v1 = v0;
+t6 = MEM_U8(t6 + 0);
+if (t6 == at) {
+t1 = t0;
+goto L4083b0;}
+//nop;
+MEM_U32(sp + 56) = t0;
+MEM_U32(sp + 52) = t1;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+t1 = MEM_U32(sp + 52);
+v1 = v0;
+if (v0 != 0) goto L4083b4;
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L4083fc;
+// fdead 0 t1 = t0;
+L4083b0:
+t0 = MEM_U32(sp + 60);
+L4083b4:
+t7 = MEM_U32(v1 + 20);
+at = 0x10015390;
+t8 = MEM_U32(sp + 60);
+t9 = 0xf;
+MEM_U32(at + 0) = t7;
+a3 = MEM_U32(t0 + 20);
+a2 = MEM_U32(t8 + 20);
+MEM_U32(sp + 16) = t9;
+//nop;
+t2 = MEM_U32(t1 + 20);
+MEM_U32(sp + 24) = zero;
+// bdead 40000983 t9 = t9;
+a0 = zero;
+a1 = MEM_U32(sp + 64);
+MEM_U32(sp + 20) = t2;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L4083f8:
+// bdead 1 ra = MEM_U32(sp + 44);
+L4083fc:
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_408408(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408408:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+at = 0x194;
+// fdead 4000006f MEM_U32(sp + 44) = ra;
+// fdead 4000006f MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 72) = a0;
+if (a0 != at) goto L408480;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+if ((int)v0 < 0) goto L408450;
+if ((int)v0 < (int)0x20) {
+t7 = v1 & 0x1f;
+goto L408478;}
+L408450:
+//nop;
+a0 = 0x1000e94c;
+a1 = zero;
+a2 = 0x2;
+MEM_U32(sp + 56) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+t7 = v1 & 0x1f;
+L408478:
+MEM_U32(sp + 52) = t7;
+goto L40849c;
+L408480:
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L408594;
+t8 = MEM_U32(v0 + 20);
+MEM_U32(sp + 52) = t8;
+L40849c:
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+if (v0 == 0) goto L408594;
+t9 = 0x100142b0;
+at = 0x28;
+a1 = zero;
+t9 = MEM_U8(t9 + 0);
+//nop;
+if (t9 == at) goto L4084e8;
+//nop;
+a0 = 0x1000e96c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408594;
+L4084e8:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+if (v0 == 0) goto L408594;
+t0 = 0x100142b0;
+at = 0x29;
+a1 = zero;
+t0 = MEM_U8(t0 + 0);
+//nop;
+if (t0 == at) goto L408544;
+//nop;
+a0 = 0x1000e990;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408594;
+L408544:
+//nop;
+MEM_U32(sp + 60) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 60);
+t2 = MEM_U32(sp + 64);
+//nop;
+t1 = 0x3;
+a3 = MEM_U32(v1 + 20);
+MEM_U32(sp + 16) = t1;
+t3 = MEM_U32(t2 + 20);
+// fdead 60001d1f t9 = t9;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+a1 = MEM_U32(sp + 72);
+a2 = MEM_U32(sp + 52);
+MEM_U32(sp + 20) = t3;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L408594:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x48;
+//nop;
+return;
+}
+
+static void func_4085a4(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4085a4:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+if (v0 == 0) goto L408918;
+t6 = 0x100142b0;
+at = 0x69;
+MEM_U32(sp + 72) = zero;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 != at) goto L408650;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x44;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L408650;
+t7 = MEM_U32(sp + 68);
+t8 = MEM_U32(t7 + 16);
+//nop;
+if (t8 != 0) goto L408650;
+//nop;
+MEM_U32(sp + 72) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x100142b0;
+t9 = MEM_U8(t9 + 0);
+//nop;
+if (t9 != at) goto L408650;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L408650:
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x64;
+goto L40869c;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L40869c;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L40869c;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L40869c;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L40869c;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x22;
+goto L40869c;}
+at = 0x22;
+if (v0 == at) {
+at = 0x28;
+goto L40869c;}
+at = 0x28;
+t4 = MEM_U32(sp + 72);
+if (v0 != at) goto L4088b4;
+L40869c:
+t0 = 0x10013a3c;
+t0 = MEM_U8(t0 + 0);
+//nop;
+if ((int)t0 >= (int)0x3) goto L4086d0;
+//nop;
+MEM_U32(sp + 56) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+MEM_U32(sp + 64) = v0;
+goto L4086ec;
+L4086d0:
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x40;
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+L4086ec:
+t1 = MEM_U32(sp + 72);
+t2 = MEM_U32(sp + 64);
+//nop;
+if (t1 == 0) goto L408738;
+at = (int)t2 < (int)0x401;
+if ((int)t2 < 0) goto L408714;
+//nop;
+if ((int)t2 >= (int)0x401) goto L408714;
+//nop;
+if (v1 == 0) goto L408738;
+L408714:
+//nop;
+a0 = 0x1000e9b4;
+a1 = zero;
+a2 = 0x2;
+MEM_U32(sp + 56) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 56);
+L408738:
+t5 = MEM_U32(sp + 72);
+if (v1 == 0) goto L408830;
+t3 = 0x10013a4c;
+a1 = zero;
+t3 = MEM_U32(t3 + 0);
+MEM_U32(sp + 52) = t3;
+if (t3 != 0) goto L40876c;
+//nop;
+a0 = 0x1000e9e4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+L40876c:
+//nop;
+at = 0x10013a4c;
+t6 = MEM_U32(sp + 60);
+t4 = 0x2;
+t5 = 0x48;
+// fdead 6000fc5f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+MEM_U32(sp + 24) = t6;
+func_405264(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 64);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+t8 = 0x2;
+MEM_U32(sp + 24) = t9;
+//nop;
+t7 = 0x48;
+MEM_U32(sp + 20) = t7;
+// bdead 42000003 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 76);
+t1 = 0x4;
+//nop;
+a2 = MEM_U32(t0 + 20);
+t2 = 0x48;
+t3 = 0x8;
+// fdead 60001e9f t9 = t9;
+MEM_U32(sp + 24) = t3;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a0 = zero;
+a1 = MEM_U32(sp + 80);
+a3 = 0x1;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 52);
+at = 0x10013a4c;
+MEM_U32(at + 0) = t4;
+goto L408918;
+L408830:
+a0 = zero;
+if (t5 == 0) goto L408878;
+t6 = MEM_U32(sp + 76);
+t9 = MEM_U32(sp + 64);
+a3 = MEM_U32(t5 + 20);
+a2 = MEM_U32(t6 + 20);
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x4;
+t7 = 0x48;
+// bdead 42010183 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = MEM_U32(sp + 80);
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408918;
+L408878:
+t0 = MEM_U32(sp + 76);
+//nop;
+t3 = MEM_U32(sp + 64);
+a2 = MEM_U32(t0 + 20);
+t1 = 0x2;
+t2 = 0x48;
+// fdead 60005ebf t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+a1 = MEM_U32(sp + 80);
+a3 = 0x48;
+MEM_U32(sp + 24) = t3;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408918;
+L4088b4:
+a0 = zero;
+if (t4 != 0) goto L4088dc;
+//nop;
+a0 = 0x1000ea18;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408918;
+L4088dc:
+t6 = MEM_U32(sp + 76);
+t5 = MEM_U32(sp + 72);
+t9 = 0x8;
+a2 = MEM_U32(t6 + 20);
+a3 = MEM_U32(t5 + 20);
+MEM_U32(sp + 24) = t9;
+//nop;
+t8 = 0x4;
+t7 = 0x48;
+// bdead 420101a1 t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t8;
+a1 = MEM_U32(sp + 80);
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L408918:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_408928(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L408928:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+at = 0x2b;
+// fdead 4000006f MEM_U32(sp + 44) = ra;
+// fdead 4000006f MEM_U32(sp + 40) = gp;
+// fdead 4000006f MEM_U32(sp + 36) = s0;
+a2 = a0;
+if (a0 != at) goto L408958;
+a2 = 0x22;
+goto L408968;
+L408958:
+at = 0x32;
+//nop;
+if (a2 != at) goto L408968;
+a2 = 0x23;
+L408968:
+t7 = 0x100142b0;
+t6 = 0x48;
+at = 0x69;
+t7 = MEM_U8(t7 + 0);
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 84) = zero;
+MEM_U32(sp + 72) = t6;
+MEM_U32(sp + 80) = zero;
+if (t7 != at) goto L408c6c;
+//nop;
+s0 = sp + 0x50;
+a1 = s0;
+a0 = 0x100142b8;
+MEM_U32(sp + 88) = a2;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40020103 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L4089c4;
+//nop;
+a0 = 0x100142b8;
+a1 = s0;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L4089c4:
+t8 = MEM_U32(sp + 80);
+at = 0x3;
+v0 = MEM_U32(t8 + 16);
+//nop;
+if (v0 != at) goto L408b48;
+t9 = 0x10015378;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L408a04;
+//nop;
+a0 = MEM_U32(t8 + 24);
+a1 = 0x100142b8;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L408a04:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2b;
+MEM_U32(sp + 60) = zero;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+at = 0x2d;
+goto L408a60;}
+at = 0x2d;
+if (v1 == at) {
+at = 0x23;
+goto L408a60;}
+at = 0x23;
+s0 = 0x2c;
+if (v1 == at) goto L408a60;
+a1 = zero;
+if (s0 == v1) goto L408a60;
+//nop;
+a0 = 0x1000ea34;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408d40;
+L408a60:
+at = 0x23;
+s0 = 0x2c;
+if (v1 == at) goto L408c84;
+if (s0 == v1) {
+at = 0x23;
+goto L408a94;}
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4002010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x23;
+L408a94:
+if (v1 == at) {
+t3 = MEM_U32(sp + 84);
+goto L408c88;}
+//nop;
+if (s0 != v1) goto L408ab4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L408ab4:
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L408ae0;
+t0 = 0x100142b0;
+at = 0x23;
+t0 = MEM_U8(t0 + 0);
+//nop;
+if (t0 != at) goto L408b14;
+L408ae0:
+t1 = 0x100142b0;
+at = 0x23;
+a1 = zero;
+t1 = MEM_U8(t1 + 0);
+if (t1 != at) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408d44;}
+//nop;
+a0 = 0x1000ea50;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408d40;
+L408b14:
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+if (v0 == 0) goto L408d40;
+t2 = 0x100142b0;
+at = 0x23;
+t2 = MEM_U8(t2 + 0);
+if (t2 == at) {
+t3 = MEM_U32(sp + 84);
+goto L408c88;}
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408d44;
+L408b48:
+at = 0x4;
+if (v0 != 0) goto L408c2c;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(sp + 88);
+t3 = MEM_U32(sp + 80);
+v0 = 0x23;
+// bdead 4000310b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 80) = zero;
+MEM_U32(sp + 84) = t3;
+if (t4 != v0) goto L408c84;
+v1 = 0x100142b0;
+s0 = 0x2c;
+v1 = MEM_U8(v1 + 0);
+if (v0 == v1) {
+t3 = MEM_U32(sp + 84);
+goto L408c88;}
+if (s0 != v1) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L408d44;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+s0 = sp + 0x38;
+L408ba8:
+//nop;
+s0 = s0 + 0x4;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4002010b gp = MEM_U32(sp + 40);
+MEM_U32(s0 + 0) = v0;
+if (v0 == 0) goto L408d40;
+t5 = sp + 0x44;
+if (s0 == t5) {
+t7 = sp + 0x40;
+goto L408be8;}
+t6 = 0x100142b0;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 != at) goto L408ba8;
+t7 = sp + 0x40;
+L408be8:
+t9 = MEM_U32(sp + 84);
+if (s0 == t7) goto L408c84;
+t8 = MEM_U32(t9 + 20);
+t0 = MEM_U32(sp + 60);
+a2 = 0x2;
+MEM_U32(sp + 72) = t8;
+MEM_U32(sp + 84) = t0;
+t2 = MEM_U32(t0 + 20);
+if (t8 != t2) {
+t3 = MEM_U32(sp + 84);
+goto L408c88;}
+//nop;
+a0 = 0x1000ea70;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+goto L408c84;
+L408c2c:
+a2 = 0x1;
+if (v0 != at) goto L408c50;
+//nop;
+MEM_U32(sp + 80) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+goto L408c84;
+L408c50:
+//nop;
+a0 = 0x1000ea98;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408d40;
+L408c6c:
+//nop;
+MEM_U32(sp + 88) = a2;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 76) = v0;
+L408c84:
+t3 = MEM_U32(sp + 84);
+L408c88:
+a0 = zero;
+a1 = MEM_U32(sp + 88);
+t6 = MEM_U32(sp + 80);
+if (t3 == 0) goto L408cc8;
+//nop;
+a2 = MEM_U32(t3 + 20);
+t4 = 0x7;
+t5 = 0x48;
+// bdead 400060e3 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+MEM_U32(sp + 24) = zero;
+a3 = MEM_U32(sp + 72);
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408d40;
+L408cc8:
+a0 = zero;
+if (t6 == 0) goto L408d0c;
+a0 = MEM_U32(t6 + 24);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t8 = MEM_U32(sp + 76);
+t7 = 0x6;
+// bdead 42010021 t9 = t9;
+MEM_U32(sp + 16) = t7;
+a1 = MEM_U32(sp + 88);
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t8;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L408d40;
+L408d0c:
+//nop;
+t2 = MEM_U32(sp + 76);
+t0 = 0x6;
+t1 = 0x48;
+// bdead 40000e21 t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t0;
+a1 = MEM_U32(sp + 88);
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = t2;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L408d40:
+// bdead 1 ra = MEM_U32(sp + 44);
+L408d44:
+// bdead 1 s0 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x58;
+//nop;
+return;
+}
+
+static uint32_t func_408d54(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408d54:
+//nop;
+//nop;
+//nop;
+t6 = 0x100146b8;
+sp = sp + 0xffffffd8;
+at = 0x1;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806f MEM_U32(sp + 28) = ra;
+// fdead 4000806f MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+if (t6 != at) goto L408d94;
+t7 = 0x100142b8;
+at = 0x2e;
+t7 = MEM_U8(t7 + 0);
+//nop;
+if (t7 == at) goto L408d9c;
+L408d94:
+v0 = zero;
+goto L408f1c;
+L408d9c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2d;
+v1 = zero;
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (v0 != at) {
+at = 0x2b;
+goto L408dd0;}
+v1 = 0x1;
+goto L408df8;
+at = 0x2b;
+L408dd0:
+a1 = zero;
+if (v0 == at) goto L408df8;
+//nop;
+a0 = 0x1000eab4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L408f1c;
+L408df8:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x64;
+v1 = MEM_U32(sp + 36);
+t8 = 0x100142b0;
+a1 = zero;
+t8 = MEM_U8(t8 + 0);
+//nop;
+if (t8 == at) goto L408e48;
+//nop;
+a0 = 0x1000eacc;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L408f1c;
+L408e48:
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t9 = v0 & 0x3;
+// bdead 4400010b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+if (t9 == 0) goto L408e8c;
+//nop;
+a0 = 0x1000eae8;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L408f1c;
+L408e8c:
+at = 0x8001;
+a1 = zero;
+if ((int)v0 < (int)at) goto L408ebc;
+//nop;
+a0 = 0x1000eb0c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+v0 = 0x1;
+goto L408f1c;
+L408ebc:
+//nop;
+if (v1 != 0) goto L408ecc;
+//nop;
+if (v0 != 0) goto L408ef0;
+L408ecc:
+at = 0x100121f0;
+t0 = 0x4;
+MEM_U32(at + 0) = t0;
+v1 = (int)v0 >> 2;
+if ((int)v0 >= 0) goto L408ee8;
+at = v0 + 0x3;
+v1 = (int)at >> 2;
+L408ee8:
+t2 = MEM_U32(sp + 40);
+goto L408f14;
+L408ef0:
+at = 0x100121f0;
+t1 = 0x3;
+v1 = v0 + 0xfffffffc;
+MEM_U32(at + 0) = t1;
+at = v1;
+if ((int)v1 >= 0) goto L408f0c;
+at = v1 + 0x3;
+L408f0c:
+v1 = (int)at >> 2;
+t2 = MEM_U32(sp + 40);
+L408f14:
+v0 = 0x1;
+MEM_U32(t2 + 0) = v1;
+L408f1c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_408f2c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L408f2c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 96) = a0;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 88) = zero;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 92) = v0;
+if (v0 == 0) goto L40940c;
+t6 = 0x100142b0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+if (t6 != at) {
+t0 = MEM_U32(sp + 88);
+goto L408fe0;}
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x50;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L408fdc;
+t7 = MEM_U32(sp + 80);
+t8 = MEM_U32(t7 + 16);
+if (t8 != zero) {
+t0 = MEM_U32(sp + 88);
+goto L408fe0;}
+//nop;
+MEM_U32(sp + 88) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t9 = 0x100142b0;
+t9 = MEM_U8(t9 + 0);
+if (t9 != at) {
+t0 = MEM_U32(sp + 88);
+goto L408fe0;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L408fdc:
+t0 = MEM_U32(sp + 88);
+L408fe0:
+if (t0 != zero) {
+t3 = MEM_U32(sp + 88);
+goto L409074;}
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x64;
+goto L40901c;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L40901c;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L40901c;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L40901c;}
+at = 0x2d;
+if (v0 != at) {
+t3 = MEM_U32(sp + 88);
+goto L409074;}
+L40901c:
+t1 = 0x10013a3c;
+t1 = MEM_U8(t1 + 0);
+//nop;
+if ((int)t1 >= (int)0x3) goto L40904c;
+//nop;
+MEM_U32(sp + 64) = zero;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 72) = v0;
+goto L409068;
+L40904c:
+//nop;
+a0 = sp + 0x3c;
+a1 = sp + 0x48;
+//nop;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 64) = v0;
+L409068:
+t2 = 0x1;
+MEM_U32(sp + 76) = t2;
+t3 = MEM_U32(sp + 88);
+L409074:
+t4 = MEM_U32(sp + 76);
+//nop;
+if (t3 != 0) goto L4090a4;
+a1 = zero;
+if (t4 != 0) goto L4090a4;
+//nop;
+a0 = 0x1000eb2c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L40940c;
+L4090a4:
+t5 = 0x100142b0;
+at = 0x69;
+a1 = zero;
+t5 = MEM_U8(t5 + 0);
+//nop;
+if (t5 == at) goto L4090d8;
+//nop;
+a0 = 0x1000eb48;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L40940c;
+L4090d8:
+//nop;
+a0 = sp + 0x44;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_408d54(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4091a0;
+v0 = 0x10015350;
+t8 = MEM_U32(sp + 68);
+t2 = MEM_U32(sp + 76);
+t9 = MEM_U16(v0 + 10);
+t7 = t8 & 0x3fff;
+a0 = zero;
+t0 = t9 & 0xc000;
+t1 = t7 | t0;
+MEM_U16(v0 + 10) = (uint16_t)t1;
+if (t2 == 0) goto L40915c;
+t3 = MEM_U32(sp + 92);
+//nop;
+t6 = MEM_U32(sp + 72);
+a2 = MEM_U32(t3 + 20);
+t4 = 0xc;
+t5 = 0x48;
+// bdead 4000e083 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a1 = MEM_U32(sp + 96);
+a3 = 0x48;
+MEM_U32(sp + 24) = t6;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+goto L409194;
+L40915c:
+t9 = MEM_U32(sp + 88);
+t8 = MEM_U32(sp + 92);
+t7 = 0x8;
+a3 = MEM_U32(t9 + 20);
+//nop;
+a2 = MEM_U32(t8 + 20);
+t0 = 0x48;
+// bdead 400103a3 t9 = t9;
+MEM_U32(sp + 20) = t0;
+MEM_U32(sp + 24) = zero;
+MEM_U32(sp + 16) = t7;
+a1 = MEM_U32(sp + 96);
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+L409194:
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+goto L40940c;
+L4091a0:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x50;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4091f8;
+t1 = MEM_U32(sp + 80);
+at = 0x3;
+a2 = 0x1;
+t2 = MEM_U32(t1 + 16);
+//nop;
+if (t2 != at) goto L4091dc;
+MEM_U32(sp + 84) = t1;
+goto L409210;
+L4091dc:
+//nop;
+a0 = 0x1000eb58;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L40940c;
+L4091f8:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x54;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L409210:
+t3 = 0x10015378;
+t3 = MEM_U32(t3 + 0);
+//nop;
+if (t3 == 0) goto L409278;
+a1 = 0x100142b8;
+t5 = 0xfb4cba0;
+t4 = MEM_U8(a1 + 0);
+t6 = t4 + t5;
+t8 = MEM_U8(t6 + 1);
+t9 = t8 & 0x4;
+//nop;
+if (t9 == 0) goto L409260;
+//nop;
+t7 = MEM_U32(sp + 84);
+a1 = zero;
+// bdead 40010043 t9 = t9;
+a0 = MEM_U32(t7 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+goto L409278;
+L409260:
+//nop;
+t0 = MEM_U32(sp + 84);
+// bdead 40000243 t9 = t9;
+a0 = MEM_U32(t0 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L409278:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t2 = MEM_U32(sp + 76);
+// bdead 40000903 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 84);
+a1 = MEM_U32(sp + 96);
+if (t2 == 0) goto L4093d4;
+t1 = 0x10013a4c;
+t3 = MEM_U32(sp + 64);
+t5 = MEM_U32(sp + 84);
+t1 = MEM_U32(t1 + 0);
+a1 = MEM_U32(sp + 96);
+MEM_U32(sp + 56) = t1;
+if (t3 == 0) goto L409398;
+a1 = zero;
+if (t1 != 0) goto L4092d4;
+//nop;
+a0 = 0x1000eb70;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+L4092d4:
+//nop;
+at = 0x10013a4c;
+t6 = MEM_U32(sp + 60);
+t4 = 0x2;
+t5 = 0x48;
+// fdead 6000fe5f t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(at + 0) = zero;
+MEM_U32(sp + 24) = t6;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t9 = 0x48;
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = MEM_U32(sp + 72);
+t8 = 0x2;
+// bdead 42010003 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a0 = zero;
+a1 = 0x14c;
+a2 = 0x1;
+a3 = 0x48;
+MEM_U32(sp + 24) = t7;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 84);
+t2 = MEM_U32(sp + 92);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a2 = MEM_U32(t2 + 20);
+t3 = 0x8;
+t1 = 0x48;
+// fdead 60001ebf t9 = t9;
+MEM_U32(sp + 20) = t1;
+MEM_U32(sp + 16) = t3;
+MEM_U32(sp + 24) = zero;
+a1 = MEM_U32(sp + 96);
+a3 = 0x1;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 40);
+t4 = MEM_U32(sp + 56);
+at = 0x10013a4c;
+MEM_U32(at + 0) = t4;
+goto L40940c;
+L409398:
+t6 = MEM_U32(sp + 92);
+a0 = MEM_U32(t5 + 24);
+t9 = 0x48;
+a2 = MEM_U32(t6 + 20);
+MEM_U32(sp + 20) = t9;
+//nop;
+t7 = MEM_U32(sp + 72);
+t8 = 0xc;
+// bdead 420100e1 t9 = t9;
+MEM_U32(sp + 16) = t8;
+a3 = 0x48;
+MEM_U32(sp + 24) = t7;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L40940c;
+L4093d4:
+t2 = MEM_U32(sp + 92);
+t3 = MEM_U32(sp + 88);
+//nop;
+a0 = MEM_U32(t0 + 24);
+a2 = MEM_U32(t2 + 20);
+a3 = MEM_U32(t3 + 20);
+t1 = 0x8;
+t4 = 0x48;
+// fdead 60003fff t9 = t9;
+MEM_U32(sp + 20) = t4;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L40940c:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x60;
+//nop;
+return;
+}
+
+static void func_40941c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40941c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+at = 0xe3;
+// fdead 4000006f MEM_U32(sp + 44) = ra;
+// fdead 4000006f MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 64) = a0;
+if (a0 != at) goto L409450;
+t7 = 0x10014ac8;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(sp + 60) = t7;
+goto L4094bc;
+L409450:
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+MEM_U32(sp + 60) = v0;
+if (v0 == 0) goto L409698;
+v1 = MEM_U32(sp + 64);
+at = 0xe5;
+if (v1 == at) {
+at = 0x120;
+goto L409490;}
+at = 0x120;
+if (v1 == at) {
+at = 0xe4;
+goto L409490;}
+at = 0xe4;
+if (v1 == at) {
+at = 0x124;
+goto L409490;}
+at = 0x124;
+//nop;
+if (v1 != at) goto L4094bc;
+L409490:
+t8 = 0x10014ac8;
+a1 = zero;
+t8 = MEM_U32(t8 + 124);
+//nop;
+if (v0 != t8) goto L4094bc;
+//nop;
+a0 = 0x1000eba4;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L4094bc:
+t9 = 0x100142b0;
+at = 0x69;
+a1 = zero;
+t9 = MEM_U8(t9 + 0);
+//nop;
+if (t9 == at) goto L4094f0;
+//nop;
+a0 = 0x1000ebd4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L409698;
+L4094f0:
+//nop;
+a0 = sp + 0x30;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_408d54(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L40956c;
+v0 = 0x10015350;
+t1 = MEM_U32(sp + 48);
+t6 = MEM_U32(sp + 60);
+t3 = MEM_U16(v0 + 10);
+t2 = t1 & 0x3fff;
+//nop;
+t4 = t3 & 0xc000;
+t5 = t2 | t4;
+MEM_U16(v0 + 10) = (uint16_t)t5;
+a2 = MEM_U32(t6 + 20);
+t7 = 0x9;
+t8 = 0x48;
+// fdead 6201fc9f t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+a1 = MEM_U32(sp + 64);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+goto L409698;
+L40956c:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x34;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+t9 = MEM_U32(sp + 52);
+a3 = 0x100142b8;
+if (v0 == 0) goto L4095c8;
+t0 = MEM_U32(t9 + 16);
+at = 0x3;
+a1 = a3;
+//nop;
+if (t0 != at) goto L4095ac;
+MEM_U32(sp + 56) = t9;
+goto L4095e4;
+L4095ac:
+//nop;
+a0 = 0x1000ebe4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L409698;
+L4095c8:
+//nop;
+a0 = a3;
+a1 = sp + 0x38;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+a3 = 0x100142b8;
+L4095e4:
+t1 = 0x10015378;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 == 0) goto L40964c;
+t3 = MEM_U8(a3 + 0);
+t2 = 0xfb4cba0;
+t4 = t3 + t2;
+t5 = MEM_U8(t4 + 1);
+t6 = t5 & 0x4;
+//nop;
+if (t6 == 0) goto L409630;
+//nop;
+t7 = MEM_U32(sp + 56);
+a1 = zero;
+// bdead 40010043 t9 = t9;
+a0 = MEM_U32(t7 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+goto L40964c;
+L409630:
+//nop;
+t8 = MEM_U32(sp + 56);
+a1 = a3;
+// bdead 42000043 t9 = t9;
+a0 = MEM_U32(t8 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L40964c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 60);
+// bdead 44000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 56);
+a2 = MEM_U32(t9 + 20);
+//nop;
+a0 = MEM_U32(t0 + 24);
+t1 = 0x9;
+t3 = 0x48;
+// bdead 400014a3 t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+a1 = MEM_U32(sp + 64);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L409698:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void func_4096a8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4096a8:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffb0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000806f MEM_U32(sp + 44) = ra;
+// fdead 4000806f MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 80) = a0;
+if (t6 == at) goto L4096f4;
+//nop;
+a0 = 0x1000ebfc;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4099fc;
+L4096f4:
+t7 = MEM_U32(sp + 80);
+t8 = 0x40;
+a1 = sp + 0x44;
+v0 = t7 ^ 0x8;
+v1 = v0 < 0x1;
+v0 = t7 ^ 0x7;
+if (v1 != 0) goto L409730;
+v1 = v0 < 0x1;
+v0 = t7 ^ 0x128;
+if (v1 != 0) goto L409730;
+v1 = v0 < 0x1;
+//nop;
+if (v1 != 0) goto L409730;
+v1 = t7 ^ 0x127;
+v1 = v1 < 0x1;
+L409730:
+MEM_U32(sp + 52) = v1;
+if (v1 == 0) goto L4097a4;
+//nop;
+MEM_U32(sp + 60) = t8;
+a0 = 0x100142b8;
+MEM_U32(sp + 52) = v1;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4097a4;
+t9 = MEM_U32(sp + 68);
+t0 = MEM_U32(t9 + 16);
+//nop;
+if (t0 != 0) goto L4097a4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+at = 0x2c;
+t1 = 0x100142b0;
+t1 = MEM_U8(t1 + 0);
+if (t1 != at) {
+t2 = MEM_U32(sp + 68);
+goto L40979c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+t2 = MEM_U32(sp + 68);
+L40979c:
+t3 = MEM_U32(t2 + 20);
+MEM_U32(sp + 60) = t3;
+L4097a4:
+t4 = 0x100142b0;
+at = 0x69;
+v1 = MEM_U32(sp + 52);
+t4 = MEM_U8(t4 + 0);
+a1 = zero;
+//nop;
+if (t4 == at) goto L4097dc;
+//nop;
+a0 = 0x1000ec20;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4099fc;
+L4097dc:
+//nop;
+a0 = sp + 0x38;
+MEM_U32(sp + 52) = v1;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_408d54(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L409898;
+v0 = 0x10015350;
+t6 = MEM_U32(sp + 56);
+t1 = MEM_U32(sp + 52);
+t8 = MEM_U16(v0 + 10);
+t7 = t6 & 0x3fff;
+a0 = zero;
+t9 = t8 & 0xc000;
+t0 = t7 | t9;
+MEM_U16(v0 + 10) = (uint16_t)t0;
+if (t1 == 0) goto L40985c;
+//nop;
+t2 = 0x9;
+t3 = 0x48;
+// bdead 40001803 t9 = t9;
+MEM_U32(sp + 20) = t3;
+MEM_U32(sp + 16) = t2;
+a0 = zero;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 60);
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+goto L40988c;
+L40985c:
+//nop;
+t4 = 0xa;
+t5 = 0x48;
+// bdead 40006023 t9 = t9;
+MEM_U32(sp + 20) = t5;
+MEM_U32(sp + 16) = t4;
+a1 = MEM_U32(sp + 80);
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = zero;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 40);
+L40988c:
+at = 0x100121f0;
+MEM_U32(at + 0) = zero;
+goto L4099fc;
+L409898:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x48;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L4098f0;
+t6 = MEM_U32(sp + 72);
+at = 0x3;
+a2 = 0x1;
+t8 = MEM_U32(t6 + 16);
+//nop;
+if (t8 != at) goto L4098d4;
+MEM_U32(sp + 76) = t6;
+goto L409908;
+L4098d4:
+//nop;
+a0 = 0x1000ec30;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4099fc;
+L4098f0:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x4c;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L409908:
+t7 = 0x10015378;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L409970;
+a1 = 0x100142b8;
+t0 = 0xfb4cba0;
+t9 = MEM_U8(a1 + 0);
+t1 = t9 + t0;
+t2 = MEM_U8(t1 + 1);
+t3 = t2 & 0x4;
+//nop;
+if (t3 == 0) goto L409958;
+//nop;
+t4 = MEM_U32(sp + 76);
+a1 = zero;
+// bdead 40002043 t9 = t9;
+a0 = MEM_U32(t4 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+goto L409970;
+L409958:
+//nop;
+t5 = MEM_U32(sp + 76);
+// bdead 40004043 t9 = t9;
+a0 = MEM_U32(t5 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 40);
+L409970:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 52);
+// bdead 42000003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 76);
+a1 = MEM_U32(sp + 80);
+if (t8 == 0) goto L4099cc;
+t6 = MEM_U32(sp + 76);
+t9 = 0x48;
+t7 = 0x9;
+a0 = MEM_U32(t6 + 24);
+MEM_U32(sp + 20) = t9;
+//nop;
+MEM_U32(sp + 24) = zero;
+MEM_U32(sp + 16) = t7;
+// bdead 40000021 t9 = t9;
+a1 = MEM_U32(sp + 80);
+a2 = MEM_U32(sp + 60);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L4099fc;
+L4099cc:
+//nop;
+a0 = MEM_U32(t0 + 24);
+t1 = 0xa;
+t2 = 0x48;
+// fdead 62000e7f t9 = t9;
+MEM_U32(sp + 20) = t2;
+MEM_U32(sp + 16) = t1;
+MEM_U32(sp + 24) = zero;
+a2 = 0x48;
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L4099fc:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x50;
+//nop;
+return;
+}
+
+static void func_409a0c(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L409a0c:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffc8;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+// fdead 4000006f MEM_U32(sp + 44) = ra;
+// fdead 4000006f MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 56) = a0;
+if (v0 == at) goto L409a5c;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L409a5c;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L409a5c;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L409a5c;}
+at = 0x2d;
+a1 = zero;
+if (v0 != at) goto L409a74;
+L409a5c:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 40);
+v1 = v0;
+goto L409a90;
+L409a74:
+//nop;
+a0 = 0x1000ec48;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L409af0;
+L409a90:
+t6 = v0 >> 25;
+a1 = zero;
+if (t6 == 0) goto L409abc;
+//nop;
+a0 = 0x1000ec5c;
+a2 = 0x1;
+MEM_U32(sp + 52) = v1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 52);
+L409abc:
+//nop;
+t7 = 0x2;
+t8 = 0x48;
+// fdead 6201805f t9 = t9;
+MEM_U32(sp + 20) = t8;
+MEM_U32(sp + 16) = t7;
+a0 = zero;
+a1 = MEM_U32(sp + 56);
+a2 = 0x48;
+a3 = 0x48;
+MEM_U32(sp + 24) = v1;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L409af0:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_409b00(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L409b00:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+MEM_U32(sp + 48) = a0;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L409b60;
+//nop;
+a2 = MEM_U32(v0 + 20);
+t6 = 0x7;
+t7 = 0x48;
+// fdead 6001809b t9 = t9;
+MEM_U32(sp + 20) = t7;
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 24) = zero;
+a0 = zero;
+a1 = MEM_U32(sp + 48);
+a3 = 0x48;
+func_405264(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+L409b60:
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_409b70(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t2 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L409b70:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015350;
+t7 = a0 & 0x3f;
+sp = sp + 0xffffffe0;
+t8 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+// fdead 4201003b MEM_U32(sp + 28) = ra;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v1 + 5) = (uint8_t)t0;
+//nop;
+// fdead 4601023b MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+if (v0 == 0) goto L409be4;
+t2 = MEM_U32(v0 + 20);
+t5 = MEM_U8(v1 + 8);
+t4 = t2 << 1;
+t6 = t5 & 0xff01;
+t8 = t4 | t6;
+MEM_U8(v1 + 8) = (uint8_t)t8;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L409be4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_409bf4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L409bf4:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015350;
+sp = sp + 0xffffffe0;
+// fdead 4000003b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+// fdead 4000803b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0xf;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t9 = v0 & 0x3;
+a1 = zero;
+v1 = 0x10015350;
+MEM_U32(v1 + 8) = v0;
+if (t9 == 0) goto L409c60;
+//nop;
+a0 = 0x1000ec7c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L409c60:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_409c80(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0;
+L409c80:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v0 + 5);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x21;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if (v0 != 0) goto L409ce8;
+//nop;
+a0 = 0x1000ecb8;
+a1 = zero;
+a2 = 0x1;
+MEM_U32(sp + 36) = v0;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+L409ce8:
+v0 = 0x10015350;
+t0 = MEM_U32(v1 + 20);
+t3 = MEM_U8(v0 + 8);
+t2 = t0 << 1;
+t4 = t3 & 0xff01;
+t5 = t2 | t4;
+MEM_U8(v0 + 8) = (uint8_t)t5;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_409d24(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L409d24:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t6 = MEM_U32(sp + 36);
+at = 0x7;
+// bdead 40008107 gp = MEM_U32(sp + 24);
+a1 = zero;
+if (t6 == at) goto L409d84;
+//nop;
+a0 = 0x1000ece0;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L409d84:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_409d94(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L409d94:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 52) = v0;
+if (v0 == 0) goto L409f88;
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x64;
+goto L409e04;}
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L409e04;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L409e04;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L409e04;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L409e04;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L409e04;}
+at = 0x28;
+a1 = zero;
+if (v0 != at) goto L409e1c;
+L409e04:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 44) = v0;
+goto L409e38;
+L409e1c:
+//nop;
+a0 = 0x1000ed00;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L409f88;
+L409e38:
+t6 = 0x100142b0;
+at = 0x23;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 == at) goto L409e6c;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 48) = v0;
+if (v0 != 0) goto L409e78;
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L409f8c;
+L409e6c:
+t7 = 0x10014ac8;
+t7 = MEM_U32(t7 + 124);
+MEM_U32(sp + 48) = t7;
+L409e78:
+//nop;
+a0 = 0x100124f0;
+a1 = sp + 0x28;
+a0 = MEM_U32(a0 + 0);
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L409eb4;
+//nop;
+a0 = 0x1000ed14;
+a1 = 0x100124f0;
+a2 = 0x1;
+a0 = a0;
+a1 = MEM_U32(a1 + 0);
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L409eb4:
+v0 = MEM_U32(sp + 52);
+t9 = MEM_U32(sp + 40);
+a0 = 0x100124f4;
+t8 = MEM_U32(v0 + 8);
+a1 = sp + 0x28;
+MEM_U32(t9 + 8) = t8;
+t1 = MEM_U32(sp + 40);
+t0 = MEM_U32(v0 + 20);
+MEM_U32(t1 + 20) = t0;
+//nop;
+a0 = MEM_U32(a0 + 0);
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L409f10;
+//nop;
+a0 = 0x1000ed28;
+a1 = 0x100124f4;
+a2 = 0x1;
+a0 = a0;
+a1 = MEM_U32(a1 + 0);
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L409f10:
+t2 = MEM_U32(sp + 44);
+t3 = MEM_U32(sp + 40);
+v0 = 0x10015350;
+MEM_U32(t3 + 8) = t2;
+t4 = MEM_U8(v0 + 5);
+t7 = MEM_U32(sp + 52);
+MEM_U32(v0 + 0) = zero;
+t5 = t4 & 0xffc0;
+t6 = t5 | 0x2b;
+MEM_U8(v0 + 5) = (uint8_t)t6;
+t2 = MEM_U8(v0 + 12);
+t9 = MEM_U32(t7 + 20);
+t5 = MEM_U32(sp + 44);
+t6 = MEM_U32(sp + 48);
+t3 = t2 & 0xff01;
+t1 = t9 << 1;
+t4 = t1 | t3;
+MEM_U8(v0 + 12) = (uint8_t)t4;
+MEM_U32(v0 + 8) = t5;
+t8 = MEM_U32(t6 + 20);
+t2 = MEM_U16(v0 + 12);
+t9 = t8 << 2;
+t0 = t9 & 0x1fc;
+t1 = t2 & 0xfe03;
+t3 = t0 | t1;
+MEM_U16(v0 + 12) = (uint16_t)t3;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L409f88:
+// bdead 1 ra = MEM_U32(sp + 28);
+L409f8c:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_409f98(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, t6 = 0, t7 = 0;
+L409f98:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a58;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+//nop;
+if (t6 == 0) goto L409fd8;
+//nop;
+a0 = zero;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L409fd8:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead b gp = MEM_U32(sp + 24);
+t7 = 0x1;
+// bdead 1000b ra = MEM_U32(sp + 28);
+at = 0x10013a54;
+MEM_U32(at + 0) = v0;
+at = 0x10013a50;
+MEM_U32(at + 0) = t7;
+at = 0x10013a58;
+// bdead 7 sp = sp + 0x20;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static void func_40a010(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40a010:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp);
+at = 0x1;
+// bdead 4000010f gp = MEM_U32(sp + 24);
+v1 = v0;
+if (v0 == at) goto L40a064;
+//nop;
+a0 = 0x1000ed3c;
+a1 = zero;
+a2 = 0x1;
+MEM_U32(sp + 36) = v0;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 36);
+L40a064:
+v0 = 0x10015350;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 8) = v1;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x39;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+t9 = 0x1;
+at = 0x10015370;
+// bdead 4000005 sp = sp + 0x28;
+MEM_U32(at + 0) = t9;
+return;
+}
+
+static void func_40a0a8(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40a0a8:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+v1 = v0;
+if ((int)v0 < 0) goto L40a0e0;
+//nop;
+if ((int)v0 < (int)0xd) goto L40a100;
+L40a0e0:
+//nop;
+a0 = 0x1000ed5c;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40a164;
+L40a100:
+t6 = 0x10013a50;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L40a138;
+t7 = 0x10013a54;
+t8 = v0 << (v0 & 0x1f);
+at = 0x10013a54;
+t7 = MEM_U32(t7 + 0);
+t9 = t7 + t8;
+t0 = t9 + 0xffffffff;
+t1 = (int)t0 >> (v0 & 0x1f);
+t2 = t1 << (v0 & 0x1f);
+MEM_U32(at + 0) = t2;
+goto L40a164;
+L40a138:
+v0 = 0x10015350;
+t3 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 8) = v1;
+t4 = t3 & 0xffc0;
+t5 = t4 | 0x4;
+MEM_U8(v0 + 5) = (uint8_t)t5;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40a164:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40a174(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L40a174:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000002b MEM_U32(sp + 36) = s3;
+s3 = 0x10015350;
+v1 = 0x100146b8;
+t7 = a0 & 0x3f;
+t8 = MEM_U8(s3 + 5);
+MEM_U32(s3 + 0) = zero;
+// fdead 4211003b MEM_U32(sp + 28) = s1;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(s3 + 5) = (uint8_t)t0;
+v1 = MEM_U32(v1 + 0);
+// fdead 4611023b MEM_U32(sp + 44) = ra;
+// fdead 4611023b MEM_U32(sp + 40) = gp;
+// fdead 4611023b MEM_U32(sp + 32) = s2;
+// fdead 4611023b MEM_U32(sp + 24) = s0;
+v0 = 0x10;
+s1 = zero;
+MEM_U32(s3 + 8) = v1;
+if ((int)v1 <= 0) goto L40a21c;
+s0 = 0x100142b8;
+s2 = 0x10;
+L40a1d8:
+if (v0 != s2) {
+t1 = MEM_U8(s0 + 0);
+goto L40a200;}
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 401e0003 gp = MEM_U32(sp + 40);
+v0 = zero;
+v1 = 0x100146b8;
+v1 = MEM_U32(v1 + 0);
+t1 = MEM_U8(s0 + 0);
+L40a200:
+s1 = s1 + 0x1;
+at = (int)s1 < (int)v1;
+t2 = s3 + v0;
+s0 = s0 + 0x1;
+v0 = v0 + 0x1;
+MEM_U8(t2 + 0) = (uint8_t)t1;
+if (at != 0) goto L40a1d8;
+L40a21c:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 44);
+// bdead 1 gp = MEM_U32(sp + 40);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40a248(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t2 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0,
+t8 = 0, t9 = 0;
+L40a248:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 28) = s1;
+s1 = a0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4004802b MEM_U32(sp + 60) = ra;
+// fdead 4004802b MEM_U32(sp + 56) = gp;
+// fdead 4004802b MEM_U32(sp + 52) = s7;
+// fdead 4004802b MEM_U32(sp + 48) = s6;
+// fdead 4004802b MEM_U32(sp + 44) = s5;
+// fdead 4004802b MEM_U32(sp + 40) = s4;
+// fdead 4004802b MEM_U32(sp + 36) = s3;
+// fdead 4004802b MEM_U32(sp + 32) = s2;
+// fdead 4004802b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40a2a8;
+//nop;
+a0 = zero;
+// fdead 4004802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40040103 gp = MEM_U32(sp + 56);
+L40a2a8:
+v0 = 0x100142b0;
+s3 = 0x1000ed78;
+s7 = 0x100146b8;
+s6 = 0x10013a50;
+s5 = 0x2c;
+s4 = 0x23;
+s2 = 0x22;
+s0 = 0x10013a54;
+v0 = MEM_U8(v0 + 0);
+s3 = s3;
+L40a2d0:
+if (s2 == v0) {
+t7 = MEM_U32(s6 + 0);
+goto L40a300;}
+//nop;
+a0 = s3;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+goto L40a374;
+// fdead 0 t7 = MEM_U32(s6 + 0);
+L40a300:
+//nop;
+if (t7 == 0) goto L40a328;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(s7 + 0);
+t0 = t8 + t9;
+MEM_U32(s0 + 0) = t0;
+if (s1 == 0) goto L40a374;
+t2 = t0 + 0x1;
+MEM_U32(s0 + 0) = t2;
+goto L40a374;
+L40a328:
+//nop;
+if (s1 == 0) goto L40a354;
+//nop;
+a0 = 0x6;
+// bdead 41fe0023 t9 = t9;
+//nop;
+func_40a174(mem, sp, a0);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+goto L40a374;
+L40a354:
+//nop;
+a0 = 0x5;
+// bdead 41fe0023 t9 = t9;
+//nop;
+func_40a174(mem, sp, a0);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+L40a374:
+//nop;
+if (s4 == v0) goto L40a394;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+L40a394:
+//nop;
+if (s5 == v0) goto L40a2d0;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40a3c8(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40a3c8:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 60) = ra;
+// fdead 4000802b MEM_U32(sp + 56) = gp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 52) = s7;
+// fdead 4000802b MEM_U32(sp + 48) = s6;
+// fdead 4000802b MEM_U32(sp + 44) = s5;
+// fdead 4000802b MEM_U32(sp + 40) = s4;
+// fdead 4000802b MEM_U32(sp + 36) = s3;
+// fdead 4000802b MEM_U32(sp + 32) = s2;
+// fdead 4000802b MEM_U32(sp + 28) = s1;
+// fdead 4000802b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40a424;
+//nop;
+a0 = zero;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+L40a424:
+s7 = 0x1000ed90;
+s6 = 0x100142b0;
+s5 = 0x23;
+s4 = 0x10013a50;
+s3 = sp + 0x4c;
+s2 = sp + 0x48;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+s7 = s7;
+L40a448:
+//nop;
+a0 = s2;
+a1 = s3;
+//nop;
+f_GetItem(mem, sp, a0, a1);
+t7 = MEM_U32(s4 + 0);
+v0 = MEM_U32(sp + 72);
+// bdead 41ff010b gp = MEM_U32(sp + 56);
+at = (int)v0 < (int)0xffffff80;
+if (t7 == 0) goto L40a494;
+v1 = MEM_U32(sp + 76);
+v0 = v1;
+if ((int)v1 > 0) goto L40a484;
+v0 = 0x1;
+goto L40a484;
+L40a484:
+t8 = MEM_U32(s1 + 0);
+t9 = v0 + t8;
+MEM_U32(s1 + 0) = t9;
+goto L40a4f8;
+L40a494:
+if (at != 0) {
+at = (int)v0 < (int)0x100;
+goto L40a4a8;}
+if ((int)v0 < (int)0x100) {
+t0 = MEM_U8(s0 + 5);
+goto L40a4c8;}
+MEM_U32(sp + 72) = v0;
+L40a4a8:
+//nop;
+a0 = s7;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0003 gp = MEM_U32(sp + 56);
+v0 = zero;
+t0 = MEM_U8(s0 + 5);
+L40a4c8:
+v1 = MEM_U32(sp + 76);
+MEM_U32(s0 + 0) = zero;
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x7;
+MEM_U8(s0 + 5) = (uint8_t)t2;
+MEM_U32(s0 + 8) = v0;
+MEM_U32(s0 + 12) = v1;
+//nop;
+MEM_U32(sp + 72) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+L40a4f8:
+t3 = MEM_U8(s6 + 0);
+//nop;
+if (s5 != t3) goto L40a448;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static void func_40a530(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a530:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffc8;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000802f MEM_U32(sp + 28) = ra;
+// fdead 4000802f MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+if (t6 == at) goto L40a5a0;
+//nop;
+a0 = 0x1000eda8;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x23;
+t7 = 0x100142b0;
+t7 = MEM_U8(t7 + 0);
+if (t7 == at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40a7f8;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40a7f4;
+L40a5a0:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x34;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40a5dc;
+a2 = MEM_U32(sp + 56);
+//nop;
+a0 = 0x100142b8;
+a2 = a2 ^ 0x9;
+a2 = zero < a2;
+a1 = sp + 0x34;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40a5dc:
+t8 = 0x10015378;
+t9 = MEM_U32(sp + 52);
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 == 0) goto L40a60c;
+a0 = MEM_U32(t9 + 24);
+//nop;
+a1 = 0x100142b8;
+// bdead 40000063 t9 = t9;
+//nop;
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40a60c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t0 = 0x100142b0;
+t0 = MEM_U8(t0 + 0);
+if (t0 != at) {
+t1 = MEM_U32(sp + 56);
+goto L40a644;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 56);
+L40a644:
+at = 0x2d;
+MEM_U32(sp + 40) = zero;
+//nop;
+if (t1 != at) goto L40a670;
+v1 = 0x100142b0;
+at = 0x23;
+v1 = MEM_U8(v1 + 0);
+//nop;
+if (v1 != at) goto L40a670;
+MEM_U32(sp + 44) = zero;
+goto L40a68c;
+L40a670:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 44) = v0;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+L40a68c:
+at = 0x69;
+if (v1 != at) {
+t5 = MEM_U32(sp + 52);
+goto L40a6f8;}
+t2 = 0x100142b8;
+at = 0x53;
+a1 = zero;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 != at) goto L40a6cc;
+t3 = 0x100142b8;
+t4 = 0x1;
+t3 = MEM_U8(t3 + 1);
+//nop;
+if (t3 != 0) goto L40a6cc;
+MEM_U32(sp + 40) = t4;
+goto L40a6e4;
+L40a6cc:
+//nop;
+a0 = 0x1000edbc;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L40a6e4:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t5 = MEM_U32(sp + 52);
+L40a6f8:
+at = 0x3;
+a2 = 0x1;
+t6 = MEM_U32(t5 + 16);
+t7 = MEM_U32(sp + 52);
+//nop;
+if (t6 == at) goto L40a72c;
+//nop;
+a0 = 0x1000ede0;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40a7f4;
+L40a72c:
+v0 = 0x10015350;
+t0 = MEM_U32(sp + 56);
+t8 = MEM_U32(t7 + 24);
+t2 = MEM_U8(v0 + 5);
+t5 = MEM_U32(sp + 44);
+t6 = MEM_U32(sp + 40);
+t1 = t0 & 0x3f;
+t3 = t2 & 0xffc0;
+t4 = t1 | t3;
+MEM_U8(v0 + 5) = (uint8_t)t4;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(v0 + 8) = t5;
+MEM_U32(v0 + 12) = t6;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t7 = MEM_U32(sp + 56);
+at = 0x8;
+// bdead 40010105 gp = MEM_U32(sp + 24);
+t8 = 0x11;
+if (t7 == at) goto L40a7a0;
+at = 0x9;
+t9 = 0x21;
+if (t7 == at) goto L40a7a8;
+at = 0x2d;
+t0 = 0x22;
+if (t7 == at) goto L40a7b0;
+//nop;
+goto L40a7b8;
+L40a7a0:
+MEM_U32(sp + 48) = t8;
+goto L40a7d8;
+L40a7a8:
+MEM_U32(sp + 48) = t9;
+goto L40a7d8;
+L40a7b0:
+MEM_U32(sp + 48) = t0;
+goto L40a7d8;
+L40a7b8:
+//nop;
+a0 = 0x1000ee0c;
+a1 = 0x1000ee14;
+a2 = 0xa12;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40a7d8:
+//nop;
+t2 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 48);
+a2 = MEM_U32(sp + 44);
+a0 = MEM_U32(t2 + 24);
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40a7f4:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40a7f8:
+// bdead 1 sp = sp + 0x38;
+//nop;
+return;
+}
+
+static void func_40a804(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0,
+t8 = 0;
+L40a804:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffe0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000802f MEM_U32(sp + 28) = ra;
+// fdead 4000802f MEM_U32(sp + 24) = gp;
+a1 = zero;
+if (t6 == at) goto L40a84c;
+//nop;
+a0 = 0x1000ee20;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40a890;
+L40a84c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t7 = 0x100142b0;
+t7 = MEM_U8(t7 + 0);
+//nop;
+if (t7 != at) goto L40a880;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40a880:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40a890:
+t8 = 0x100142b0;
+at = 0x23;
+t8 = MEM_U8(t8 + 0);
+//nop;
+if (t8 == at) goto L40a8b4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40a8b4:
+//nop;
+a0 = 0x1000ee34;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40a8e0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40a8e0:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a58;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+a2 = a0;
+//nop;
+if (t6 == 0) goto L40a92c;
+//nop;
+a0 = zero;
+MEM_U32(sp + 32) = a2;
+// fdead 400080ab t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+L40a92c:
+at = 0x10013a50;
+v0 = 0x10015350;
+t8 = a2 & 0x3f;
+MEM_U32(at + 0) = zero;
+t9 = MEM_U8(v0 + 5);
+at = 0x15;
+MEM_U32(v0 + 0) = zero;
+t0 = t9 & 0xffc0;
+t1 = t8 | t0;
+MEM_U8(v0 + 5) = (uint8_t)t1;
+if (a2 != at) goto L40a980;
+t2 = 0x100142b0;
+at = 0x23;
+t2 = MEM_U8(t2 + 0);
+if (t2 == at) {
+MEM_U32(v0 + 8) = zero;
+goto L40a980;}
+t3 = 0x100146b8;
+t3 = MEM_U32(t3 + 0);
+MEM_U32(v0 + 8) = t3;
+goto L40a980;
+// fdead 0 MEM_U32(v0 + 8) = zero;
+L40a980:
+at = 0x15;
+//nop;
+if (a2 != at) goto L40aa04;
+t4 = 0x100142b0;
+at = 0x23;
+t4 = MEM_U8(t4 + 0);
+//nop;
+if (t4 == at) goto L40aa04;
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+a1 = 0x100146b8;
+a1 = MEM_U32(a1 + 0);
+//nop;
+if ((int)a1 <= 0) goto L40a9ec;
+v0 = 0x100142b8;
+v1 = 0x10015350;
+a0 = a1 + v0;
+L40a9d4:
+t6 = MEM_U8(v0 + 0);
+v0 = v0 + 0x1;
+at = v0 < a0;
+v1 = v1 + 0x1;
+MEM_U8(v1 + -1) = (uint8_t)t6;
+if (at != 0) goto L40a9d4;
+L40a9ec:
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+L40aa04:
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+f_put_binasmfyle(mem, sp);
+a2 = MEM_U32(sp + 32);
+at = 0xa;
+// bdead 40000185 gp = MEM_U32(sp + 24);
+if (a2 == at) {
+at = 0x15;
+goto L40aa58;}
+at = 0x15;
+if (a2 == at) {
+at = 0x19;
+goto L40aa48;}
+at = 0x19;
+v0 = 0x1a;
+if (a2 == at) goto L40aa68;
+//nop;
+if (a2 == v0) goto L40aa78;
+//nop;
+goto L40aa88;
+L40aa48:
+at = 0x10013a40;
+t7 = 0x1;
+MEM_U32(at + 0) = t7;
+goto L40aab0;
+L40aa58:
+at = 0x10013a40;
+t9 = 0x2;
+MEM_U32(at + 0) = t9;
+goto L40aab0;
+L40aa68:
+at = 0x10013a40;
+t8 = 0xd;
+MEM_U32(at + 0) = t8;
+goto L40aab0;
+L40aa78:
+at = 0x10013a40;
+t0 = 0xf;
+MEM_U32(at + 0) = t0;
+goto L40aab0;
+L40aa88:
+if (a2 == v0) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40aab4;}
+//nop;
+a0 = 0x1000ee54;
+a1 = 0x1000ee64;
+a2 = 0xa4d;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40aab0:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40aab4:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40aac0(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40aac0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 28) = s2;
+s2 = a0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4008802b MEM_U32(sp + 60) = ra;
+// fdead 4008802b MEM_U32(sp + 56) = fp;
+// fdead 4008802b MEM_U32(sp + 52) = gp;
+// fdead 4008802b MEM_U32(sp + 48) = s7;
+// fdead 4008802b MEM_U32(sp + 44) = s6;
+// fdead 4008802b MEM_U32(sp + 40) = s5;
+// fdead 4008802b MEM_U32(sp + 36) = s4;
+// fdead 4008802b MEM_U32(sp + 32) = s3;
+// fdead 4008802b MEM_U32(sp + 24) = s1;
+// fdead 4008802b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L40ab5c;
+s4 = 0x2;
+s3 = 0x4;
+if (a0 == s4) goto L40ab20;
+at = 0x1;
+if (a0 != s3) goto L40ab3c;
+L40ab20:
+//nop;
+a0 = 0x3;
+// fdead 4038802f t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40080103 gp = MEM_U32(sp + 52);
+goto L40ab5c;
+L40ab3c:
+if (s2 != at) {
+s3 = 0x4;
+goto L40ab60;}
+//nop;
+a0 = s4;
+// fdead 4038802f t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40080103 gp = MEM_U32(sp + 52);
+L40ab5c:
+s3 = 0x4;
+L40ab60:
+s4 = 0x2;
+fp = 0x2c;
+s7 = 0x2b;
+s6 = 0x2d;
+s5 = 0x10013a50;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+t7 = MEM_U32(s5 + 0);
+L40ab80:
+//nop;
+if (t7 == 0) goto L40abec;
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (s2 == s3) goto L40ab9c;
+if (s2 != s4) {
+t0 = MEM_U32(s1 + 0);
+goto L40abb0;}
+L40ab9c:
+t8 = MEM_U32(s1 + 0);
+t9 = t8 + 0x8;
+MEM_U32(s1 + 0) = t9;
+goto L40abb8;
+// fdead 0 t0 = MEM_U32(s1 + 0);
+L40abb0:
+t1 = t0 + 0x4;
+MEM_U32(s1 + 0) = t1;
+L40abb8:
+//nop;
+if (s6 == v0) goto L40abc8;
+//nop;
+if (s7 != v0) goto L40abd8;
+L40abc8:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+L40abd8:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+goto L40ac50;
+L40abec:
+MEM_U32(s0 + 0) = zero;
+if (s2 != s3) goto L40ac08;
+t2 = MEM_U8(s0 + 5);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x2c;
+MEM_U8(s0 + 5) = (uint8_t)t4;
+goto L40ac3c;
+L40ac08:
+at = 0x1;
+if (s2 != s4) goto L40ac24;
+t5 = MEM_U8(s0 + 5);
+t6 = t5 & 0xffc0;
+t7 = t6 | 0xb;
+MEM_U8(s0 + 5) = (uint8_t)t7;
+goto L40ac3c;
+L40ac24:
+//nop;
+if (s2 != at) goto L40ac3c;
+t8 = MEM_U8(s0 + 5);
+t9 = t8 & 0xffc0;
+t0 = t9 | 0xd;
+MEM_U8(s0 + 5) = (uint8_t)t0;
+L40ac3c:
+//nop;
+// bdead c1fe0103 t9 = t9;
+//nop;
+func_4071b0(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+L40ac50:
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+if (fp != v0) {
+at = 0x23;
+goto L40ac7c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+at = 0x23;
+L40ac7c:
+if (v0 != at) {
+t7 = MEM_U32(s5 + 0);
+goto L40ab80;}
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40acb4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40acb4:
+//nop;
+//nop;
+//nop;
+//nop;
+at = 0x10013a70;
+sp = sp + 0xffffffe0;
+// fdead 4000002f MEM_U32(sp + 28) = ra;
+// fdead 4000002f MEM_U32(sp + 24) = gp;
+MEM_U32(at + 0) = zero;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x22;
+a1 = zero;
+t6 = 0x100142b0;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 == at) goto L40ad10;
+//nop;
+a0 = 0x1000ee70;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40ad10:
+//nop;
+a0 = 0x100142b8;
+//nop;
+f_make_file(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_do_dot_end(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L40ad44:
+//do_dot_end:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 44) = ra;
+// fdead 4000006b MEM_U32(sp + 40) = gp;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+if (a0 != 0) goto L40ada4;
+s2 = 0x10012204;
+a1 = zero;
+s2 = s2;
+t6 = MEM_U32(s2 + 0);
+//nop;
+if (t6 != 0) goto L40ada4;
+//nop;
+a0 = 0x1000ee88;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 40);
+goto L40ae7c;
+L40ada4:
+s2 = 0x10012204;
+s2 = s2;
+a1 = MEM_U32(s2 + 0);
+if (a0 == 0) goto L40add8;
+a2 = 0x2;
+if (a1 == 0) goto L40add8;
+//nop;
+a0 = 0x1000ee9c;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40080003 gp = MEM_U32(sp + 40);
+a1 = MEM_U32(s2 + 0);
+L40add8:
+if (a1 == zero) {
+// bdead 1 ra = MEM_U32(sp + 44);
+goto L40ae80;}
+s3 = 0x1000eebc;
+s1 = 0x10015350;
+s3 = s3;
+L40adec:
+//nop;
+a0 = MEM_U32(a1 + 0);
+//nop;
+v0 = f_sym_undefined(mem, sp, a0);
+// bdead 401c0103 gp = MEM_U32(sp + 40);
+if (v0 == 0) goto L40ae20;
+//nop;
+a0 = s3;
+a1 = zero;
+a2 = 0x2;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 401c0003 gp = MEM_U32(sp + 40);
+goto L40ae38;
+L40ae20:
+//nop;
+t7 = MEM_U32(s2 + 0);
+a0 = MEM_U32(t7 + 0);
+v0 = f_st_procend(mem, sp, a0);
+// bdead 401c000b gp = MEM_U32(sp + 40);
+MEM_U32(s1 + 0) = v0;
+L40ae38:
+//nop;
+a0 = MEM_U32(s2 + 0);
+s0 = MEM_U32(a0 + 4);
+wrapper_free(mem, a0);
+t8 = MEM_U8(s1 + 5);
+// bdead 421e0003 gp = MEM_U32(sp + 40);
+MEM_U32(s2 + 0) = s0;
+t9 = t8 & 0xffc0;
+t0 = t9 | 0x18;
+MEM_U8(s1 + 5) = (uint8_t)t0;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+a1 = MEM_U32(s2 + 0);
+// bdead 401c0043 gp = MEM_U32(sp + 40);
+//nop;
+if (a1 != 0) goto L40adec;
+L40ae7c:
+// bdead 1 ra = MEM_U32(sp + 44);
+L40ae80:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x30;
+return;
+}
+
+static void func_40ae98(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40ae98:
+//nop;
+//nop;
+//nop;
+a1 = 0x10012204;
+//nop;
+sp = sp + 0xffffffd8;
+a1 = a1;
+t6 = MEM_U32(a1 + 0);
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+a0 = 0x8;
+MEM_U32(sp + 36) = t6;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+v1 = v0;
+a1 = 0x10012204;
+a1 = a1;
+MEM_U32(a1 + 0) = v0;
+if (v0 != 0) goto L40aefc;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40af10;
+L40aefc:
+t7 = MEM_U32(sp + 40);
+MEM_U32(v1 + 0) = t7;
+t9 = MEM_U32(a1 + 0);
+t8 = MEM_U32(sp + 36);
+MEM_U32(t9 + 4) = t8;
+L40af10:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40af20(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40af20:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a58;
+sp = sp + 0xffffffd8;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+//nop;
+if (t6 == 0) goto L40af64;
+//nop;
+a0 = zero;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40af64:
+v1 = 0x100142b0;
+at = 0x10013a50;
+t7 = MEM_U32(sp + 40);
+v1 = MEM_U8(v1 + 0);
+MEM_U32(at + 0) = zero;
+at = 0x69;
+t8 = MEM_U32(sp + 40);
+if (v1 == at) goto L40afac;
+at = 0x18;
+a1 = zero;
+if (t7 == at) goto L40afac;
+//nop;
+a0 = 0x1000eef0;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40b228;
+L40afac:
+at = 0x1b;
+if (t8 == at) {
+at = 0x2e;
+goto L40afc0;}
+at = 0x2e;
+t6 = MEM_U32(sp + 40);
+if (t8 != at) goto L40b1e4;
+L40afc0:
+t9 = 0x10013a44;
+t9 = MEM_U32(t9 + 0);
+//nop;
+if (t9 == 0) goto L40b018;
+//nop;
+a0 = 0x3;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x1000ef04;
+a2 = 0x100142b8;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b018:
+at = 0x10015350;
+t0 = MEM_U32(sp + 40);
+MEM_U32(at + 8) = zero;
+at = 0x1b;
+//nop;
+if (t0 != at) goto L40b074;
+t1 = 0x10012204;
+a2 = 0x2;
+t1 = MEM_U32(t1 + 0);
+//nop;
+if (t1 == 0) goto L40b0a8;
+//nop;
+a0 = 0x1000ef08;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a0 = zero;
+//nop;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+goto L40b0a8;
+L40b074:
+t2 = 0x10012204;
+a2 = 0x2;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 != 0) goto L40b0a8;
+//nop;
+a0 = 0x1000ef2c;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+t3 = 0x1b;
+// bdead 40001003 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = t3;
+L40b0a8:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40b0dc;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b0dc:
+t4 = MEM_U32(sp + 36);
+at = 0x3;
+a2 = 0x1;
+t5 = MEM_U32(t4 + 16);
+//nop;
+if (t5 == at) goto L40b10c;
+//nop;
+a0 = 0x1000ef54;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b10c:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 != at) {
+at = 0x64;
+goto L40b14c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x64;
+L40b14c:
+//nop;
+if (v1 != at) goto L40b164;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L40b164:
+//nop;
+t6 = MEM_U32(sp + 36);
+a1 = 0x23;
+a2 = zero;
+a0 = MEM_U32(t6 + 24);
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t7 = MEM_U32(sp + 36);
+//nop;
+a0 = MEM_U32(t7 + 24);
+// fdead 6001003f t9 = t9;
+//nop;
+func_40ae98(mem, sp, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 36);
+t1 = MEM_U32(sp + 40);
+at = 0x10015350;
+t9 = MEM_U32(t8 + 24);
+t3 = 0x10015350;
+t2 = t1 & 0x3f;
+MEM_U32(at + 0) = t9;
+t3 = MEM_U8(t3 + 5);
+//nop;
+at = 0x10015350;
+t4 = t3 & 0xffc0;
+t5 = t2 | t4;
+MEM_U8(at + 5) = (uint8_t)t5;
+f_put_binasmfyle(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+goto L40b20c;
+L40b1e4:
+at = 0x18;
+if (t6 != at) {
+at = 0x69;
+goto L40b210;}
+//nop;
+a0 = zero;
+//nop;
+f_do_dot_end(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+L40b20c:
+at = 0x69;
+L40b210:
+if (v1 != at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40b22c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40b228:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40b22c:
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40b238(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0;
+L40b238:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+v0 = 0x100142b0;
+// fdead 4000002b MEM_U32(sp + 36) = s4;
+// fdead 4000002b MEM_U32(sp + 32) = s3;
+// fdead 4000002b MEM_U32(sp + 28) = s2;
+// fdead 4000002b MEM_U32(sp + 24) = s1;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+// fdead 4000002b MEM_U32(sp + 44) = ra;
+// fdead 4000002b MEM_U32(sp + 40) = gp;
+s0 = 0x100142b8;
+s1 = MEM_U32(sp + 56);
+s2 = sp + 0x3c;
+s3 = 0x10015350;
+s4 = 0x69;
+v0 = MEM_U8(v0 + 0);
+L40b280:
+a1 = zero;
+if (s4 == v0) goto L40b2a4;
+//nop;
+a0 = 0x1000ef70;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+goto L40b388;
+L40b2a4:
+//nop;
+a0 = s0;
+a1 = s2;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L40b2d8;
+//nop;
+a0 = s0;
+a1 = s2;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 403e0003 gp = MEM_U32(sp + 40);
+L40b2d8:
+//nop;
+t6 = MEM_U32(sp + 60);
+a1 = 0x22;
+a2 = zero;
+a0 = MEM_U32(t6 + 24);
+f_sym_define(mem, sp, a0, a1, a2);
+t7 = MEM_U32(sp + 60);
+at = 0x3;
+// bdead 403f0107 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(t7 + 16);
+a1 = s0;
+//nop;
+if (t8 != at) goto L40b370;
+t9 = 0x10015378;
+t9 = MEM_U32(t9 + 0);
+if (t9 == zero) {
+t0 = MEM_U32(sp + 60);
+goto L40b33c;}
+//nop;
+a0 = MEM_U32(t7 + 24);
+a1 = s0;
+// bdead 403a0063 t9 = t9;
+//nop;
+func_4055c4(mem, sp, a0, a1);
+// bdead 403a0003 gp = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 60);
+L40b33c:
+t2 = MEM_U8(s3 + 5);
+t1 = MEM_U32(t0 + 24);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x2;
+MEM_U8(s3 + 5) = (uint8_t)t4;
+MEM_U32(s3 + 0) = t1;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+t5 = MEM_U32(sp + 60);
+// bdead 403a4103 gp = MEM_U32(sp + 40);
+s1 = MEM_U32(t5 + 24);
+goto L40b388;
+L40b370:
+//nop;
+a0 = 0x1000ef84;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+L40b388:
+v0 = 0x100142b0;
+at = 0x23;
+v0 = MEM_U8(v0 + 0);
+//nop;
+if (v0 == at) goto L40b3b4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+L40b3b4:
+if (s4 != v0) {
+at = 0x2c;
+goto L40b4c4;}
+//nop;
+a0 = s0;
+a1 = s2;
+//nop;
+v0 = f_opLookUp(mem, sp, a0, a1);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L40b3f8;
+//nop;
+a0 = 0x1000efa0;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+goto L40b4a8;
+L40b3f8:
+t6 = MEM_U32(sp + 60);
+at = 0x2;
+t8 = MEM_U32(t6 + 16);
+//nop;
+if (t8 != at) goto L40b4a8;
+v0 = MEM_U32(t6 + 20);
+at = 0xa;
+if (v0 == at) {
+at = 0x15;
+goto L40b458;}
+at = 0x15;
+if (v0 == at) {
+at = 0x19;
+goto L40b43c;}
+at = 0x19;
+if (v0 == at) {
+at = 0x1a;
+goto L40b474;}
+at = 0x1a;
+//nop;
+if (v0 == at) goto L40b490;
+//nop;
+goto L40b4a8;
+L40b43c:
+//nop;
+a0 = s1;
+a1 = 0x23;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+goto L40b4a8;
+L40b458:
+//nop;
+a0 = s1;
+a1 = 0x2;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+goto L40b4a8;
+L40b474:
+//nop;
+a0 = s1;
+a1 = 0xd;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+goto L40b4a8;
+L40b490:
+//nop;
+a0 = s1;
+a1 = 0xf;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+L40b4a8:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 403e0103 gp = MEM_U32(sp + 40);
+v0 = 0x100142b0;
+v0 = MEM_U8(v0 + 0);
+at = 0x2c;
+L40b4c4:
+//nop;
+if (v0 == at) goto L40b280;
+// bdead 40040001 ra = MEM_U32(sp + 44);
+MEM_U32(sp + 56) = s1;
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x40;
+return;
+}
+
+static void func_40b4f0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40b4f0:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffd0;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000800f MEM_U32(sp + 28) = ra;
+// fdead 4000800f MEM_U32(sp + 24) = gp;
+a1 = zero;
+if (t6 == at) goto L40b538;
+//nop;
+a0 = 0x1000efc8;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40b5c4;
+L40b538:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x2c;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40b56c;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x2c;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L40b56c:
+//nop;
+t7 = MEM_U32(sp + 44);
+a1 = 0x22;
+a2 = zero;
+a0 = MEM_U32(t7 + 24);
+f_sym_define(mem, sp, a0, a1, a2);
+t8 = MEM_U32(sp + 44);
+at = 0x3;
+// bdead 42000107 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(t8 + 16);
+a2 = 0x1;
+//nop;
+if (t9 != at) goto L40b5ac;
+t0 = MEM_U32(t8 + 24);
+MEM_U32(sp + 40) = t0;
+goto L40b5c4;
+L40b5ac:
+//nop;
+a0 = 0x1000efdc;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b5c4:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t1 = 0x100142b0;
+t1 = MEM_U8(t1 + 0);
+//nop;
+if (t1 != at) goto L40b5f8;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b5f8:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+at = 0x1;
+// bdead 4000010b gp = MEM_U32(sp + 24);
+if (v0 == at) goto L40b638;
+at = 0x2;
+a1 = zero;
+if (v0 != at) goto L40b654;
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = 0x23;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40b66c;
+L40b638:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = 0x2;
+a2 = zero;
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40b66c;
+L40b654:
+//nop;
+a0 = 0x1000eff8;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40b66c:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40b67c(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0,
+fp = 0;
+L40b67c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb0;
+// fdead 4000002b MEM_U32(sp + 48) = s7;
+s7 = 0x1000f008;
+v0 = 0x100142b0;
+// fdead 4100002b MEM_U32(sp + 56) = fp;
+// fdead 4100002b MEM_U32(sp + 44) = s6;
+// fdead 4100002b MEM_U32(sp + 40) = s5;
+// fdead 4100002b MEM_U32(sp + 36) = s4;
+// fdead 4100002b MEM_U32(sp + 32) = s3;
+// fdead 4100002b MEM_U32(sp + 28) = s2;
+// fdead 4100002b MEM_U32(sp + 24) = s1;
+// fdead 4100002b MEM_U32(sp + 20) = s0;
+// fdead 4100002b MEM_U32(sp + 60) = ra;
+// fdead 4100002b MEM_U32(sp + 52) = gp;
+s0 = 0x100142b8;
+s1 = 0x10015350;
+s2 = 0x100142b0;
+s3 = 0x2c;
+s4 = sp + 0x4c;
+s5 = sp + 0x48;
+s6 = 0x69;
+fp = 0x23;
+s7 = s7;
+v0 = MEM_U8(v0 + 0);
+L40b6e8:
+//nop;
+if (s6 == v0) goto L40b70c;
+//nop;
+a0 = s7;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+goto L40b838;
+L40b70c:
+//nop;
+a0 = s0;
+a1 = s4;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+if (v0 != 0) goto L40b740;
+//nop;
+a0 = s0;
+a1 = s4;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+L40b740:
+//nop;
+t6 = MEM_U32(sp + 76);
+a1 = 0x22;
+a2 = zero;
+a0 = MEM_U32(t6 + 24);
+f_sym_define(mem, sp, a0, a1, a2);
+t7 = MEM_U32(sp + 76);
+at = 0x3;
+// bdead c1ff0107 gp = MEM_U32(sp + 52);
+t8 = MEM_U32(t7 + 16);
+a1 = s0;
+//nop;
+if (t8 != at) goto L40b820;
+t0 = MEM_U8(s1 + 5);
+t9 = MEM_U32(t7 + 24);
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x12;
+MEM_U8(s1 + 5) = (uint8_t)t2;
+MEM_U32(s1 + 0) = t9;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U8(s2 + 0);
+// bdead c1fe1103 gp = MEM_U32(sp + 52);
+//nop;
+if (s3 != t3) goto L40b7b8;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+L40b7b8:
+//nop;
+a0 = s0;
+a1 = s5;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+if (v0 != 0) goto L40b7ec;
+//nop;
+a0 = s0;
+a1 = s5;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+L40b7ec:
+t4 = MEM_U32(sp + 72);
+t5 = MEM_U32(sp + 76);
+if (t4 == t5) {
+MEM_U32(s1 + 8) = zero;
+goto L40b80c;}
+t6 = MEM_U32(t4 + 24);
+MEM_U32(s1 + 8) = t6;
+goto L40b80c;
+// fdead 0 MEM_U32(s1 + 8) = zero;
+L40b80c:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+goto L40b838;
+L40b820:
+//nop;
+a0 = 0x1000f01c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+L40b838:
+v0 = MEM_U8(s2 + 0);
+//nop;
+if (fp == v0) goto L40b858;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+v0 = MEM_U8(s2 + 0);
+L40b858:
+//nop;
+if (s3 == v0) goto L40b6e8;
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x50;
+return;
+}
+
+static uint32_t func_40b890(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a3 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40b890:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffd8;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 400080ef MEM_U32(sp + 28) = ra;
+// fdead 400080ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+if (t6 != at) goto L40b9c8;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40b8f8;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40b8f8:
+t7 = MEM_U32(sp + 36);
+at = 0x4;
+v0 = MEM_U32(t7 + 16);
+if (v0 != at) {
+at = 0x3;
+goto L40b92c;}
+//nop;
+a0 = MEM_U32(sp + 44);
+a1 = MEM_U32(sp + 48);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40b9e0;
+at = 0x3;
+L40b92c:
+a2 = 0x1;
+if (v0 != at) goto L40b998;
+t8 = MEM_U32(sp + 36);
+t0 = MEM_U32(sp + 40);
+t9 = MEM_U32(t8 + 24);
+MEM_U32(t0 + 0) = t9;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 44);
+a1 = MEM_U32(sp + 48);
+//nop;
+// fdead 6000007f t9 = t9;
+//nop;
+func_405b20(mem, sp, a0, a1);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t1 = 0x100142b0;
+t1 = MEM_U8(t1 + 0);
+if (t1 != at) {
+v0 = 0x1;
+goto L40b9e4;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40b9e0;
+L40b998:
+//nop;
+a0 = 0x1000f038;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = zero;
+goto L40b9e4;
+L40b9c8:
+//nop;
+a0 = MEM_U32(sp + 44);
+a1 = MEM_U32(sp + 48);
+//nop;
+f_GetItem(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40b9e0:
+v0 = 0x1;
+L40b9e4:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void func_40b9f4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0,
+t9 = 0, fp = 0;
+L40b9f4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 60) = ra;
+// fdead 4000802b MEM_U32(sp + 56) = fp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 52) = gp;
+// fdead 4000802b MEM_U32(sp + 48) = s7;
+// fdead 4000802b MEM_U32(sp + 44) = s6;
+// fdead 4000802b MEM_U32(sp + 40) = s5;
+// fdead 4000802b MEM_U32(sp + 36) = s4;
+// fdead 4000802b MEM_U32(sp + 32) = s3;
+// fdead 4000802b MEM_U32(sp + 28) = s2;
+// fdead 4000802b MEM_U32(sp + 24) = s1;
+// fdead 4000802b MEM_U32(sp + 20) = s0;
+if (t6 == 0) goto L40ba54;
+//nop;
+a0 = 0x1;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 52);
+L40ba54:
+fp = 0x1;
+s7 = 0x100142b0;
+s6 = 0x23;
+s5 = 0x10013a50;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+L40ba78:
+//nop;
+MEM_U32(sp + 76) = zero;
+MEM_U32(sp + 80) = fp;
+// bdead c1fe0103 t9 = t9;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40b890(mem, sp, a0, a1, a2);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+if (v0 == 0) goto L40bb78;
+t7 = MEM_U32(s5 + 0);
+v0 = MEM_U32(sp + 80);
+v0 = v0 << 1;
+if (t7 == 0) goto L40bad8;
+v1 = v0;
+if ((int)v0 >= (int)0x2) goto L40bac8;
+v1 = 0x2;
+goto L40bac8;
+L40bac8:
+t8 = MEM_U32(s1 + 0);
+t9 = v1 + t8;
+MEM_U32(s1 + 0) = t9;
+goto L40bb64;
+L40bad8:
+t1 = 0x10015370;
+t0 = MEM_U32(sp + 76);
+a1 = zero;
+t1 = MEM_U32(t1 + 0);
+v0 = t0;
+if (fp != t1) {
+at = (int)v0 < (int)0xffff8000;
+goto L40bafc;}
+v0 = (int)t0 >> 1;
+at = (int)v0 < (int)0xffff8000;
+L40bafc:
+if (at != 0) {
+at = 0x10000;
+goto L40bb10;}
+at = 0x10000;
+if ((int)v0 < (int)at) {
+t3 = MEM_U8(s0 + 5);
+goto L40bb30;}
+L40bb10:
+//nop;
+a0 = 0x1000f050;
+a2 = fp;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+MEM_U32(sp + 76) = zero;
+t3 = MEM_U8(s0 + 5);
+L40bb30:
+t2 = MEM_U32(sp + 84);
+t6 = MEM_U32(sp + 76);
+t7 = MEM_U32(sp + 80);
+t4 = t3 & 0xffc0;
+t5 = t4 | 0xe;
+MEM_U8(s0 + 5) = (uint8_t)t5;
+MEM_U32(s0 + 0) = t2;
+MEM_U32(s0 + 8) = t6;
+MEM_U32(s0 + 12) = t7;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead c1fe0103 gp = MEM_U32(sp + 52);
+L40bb64:
+t8 = MEM_U8(s7 + 0);
+//nop;
+if (s6 != t8) goto L40ba78;
+at = 0x10015370;
+MEM_U32(at + 0) = zero;
+L40bb78:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40bba8(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40bba8:
+//nop;
+//nop;
+//nop;
+at = 0x10013a70;
+v0 = 0x10015350;
+sp = sp + 0xffffffe0;
+MEM_U32(at + 0) = zero;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+// fdead 4000802f MEM_U32(sp + 28) = ra;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x1c;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+// fdead 4201802f MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+t9 = 0x10013ea0;
+t0 = 0x100142b0;
+at = 0x10015350;
+t9 = MEM_U32(t9 + 0);
+t0 = MEM_U8(t0 + 0);
+MEM_U32(at + 8) = t9;
+at = 0x3a;
+//nop;
+if (t0 != at) goto L40bc24;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L40bc24:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = 0x10013ea4;
+at = 0x10015350;
+MEM_U32(v1 + 0) = v0;
+//nop;
+MEM_U32(at + 12) = v0;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40bc64(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40bc64:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x13;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 8) = v0;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 12) = v0;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40bcdc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40bcdc:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x32;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 8) = v0;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 12) = v0;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40bd54(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40bd54:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x33;
+MEM_U8(v0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 8) = v0;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 12) = v0;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40bdcc(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40bdcc:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015350;
+sp = sp + 0xffffffe0;
+// fdead 4000003b MEM_U32(sp + 28) = ra;
+t6 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+// fdead 4000803b MEM_U32(sp + 24) = gp;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x3c;
+MEM_U8(v1 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+MEM_U32(v1 + 8) = v0;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40be34(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0;
+L40be34:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+s0 = 0x10015350;
+// fdead 4002002b MEM_U32(sp + 28) = ra;
+// fdead 4002002b MEM_U32(sp + 24) = gp;
+t6 = MEM_U8(s0 + 5);
+MEM_U32(s0 + 0) = zero;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x3d;
+MEM_U8(s0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4002000b gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 8) = v0;
+if (v0 == 0) goto L40bf14;
+//nop;
+MEM_U32(sp + 36) = zero;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40beb4;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+a2 = zero;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+L40beb4:
+t0 = MEM_U32(sp + 36);
+t1 = MEM_U32(t0 + 24);
+MEM_U32(sp + 36) = zero;
+MEM_U32(s0 + 0) = t1;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a1 = sp + 0x24;
+//nop;
+a0 = 0x100142b8;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40bf08;
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+a2 = 0x1;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+L40bf08:
+t2 = MEM_U32(sp + 36);
+t3 = MEM_U32(t2 + 24);
+MEM_U32(s0 + 12) = t3;
+L40bf14:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40bf34(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40bf34:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015350;
+t7 = a0 & 0x3f;
+sp = sp + 0xffffffe0;
+t8 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+// fdead 4201002b MEM_U32(sp + 28) = ra;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v0 + 5) = (uint8_t)t0;
+//nop;
+// fdead 4601022b MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 8) = v0;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+//nop;
+at = 0x10015350;
+MEM_U32(at + 12) = v0;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40bfb0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+t8 = 0, t9 = 0;
+L40bfb0:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+t6 = 0x10013a50;
+// fdead 4000806b MEM_U32(sp + 52) = ra;
+// fdead 4000806b MEM_U32(sp + 48) = gp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 44) = s5;
+// fdead 4000806b MEM_U32(sp + 40) = s4;
+// fdead 4000806b MEM_U32(sp + 36) = s3;
+// fdead 4000806b MEM_U32(sp + 32) = s2;
+// fdead 4000806b MEM_U32(sp + 28) = s1;
+// fdead 4000806b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40c00c;
+//nop;
+a0 = 0x1000f06c;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+goto L40c11c;
+L40c00c:
+//nop;
+if (a0 == 0) goto L40c060;
+v0 = 0x10013a5c;
+a2 = 0x1;
+t8 = 0x1;
+t7 = MEM_U32(v0 + 0);
+//nop;
+if (t7 == 0) goto L40c048;
+//nop;
+a0 = 0x1000f08c;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+goto L40c11c;
+L40c048:
+at = 0x10013a60;
+s2 = 0x10013a64;
+MEM_U32(v0 + 0) = t8;
+MEM_U32(at + 0) = a1;
+MEM_U32(s2 + 0) = zero;
+goto L40c11c;
+L40c060:
+v0 = 0x10013a5c;
+t9 = MEM_U32(v0 + 0);
+//nop;
+if (t9 != 0) goto L40c090;
+//nop;
+a0 = 0x1000f0a4;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 48);
+goto L40c11c;
+L40c090:
+s5 = 0x10013a60;
+MEM_U32(v0 + 0) = zero;
+s5 = MEM_U32(s5 + 0);
+if (s5 == zero) {
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L40c120;}
+v0 = 0x10013a64;
+s4 = 0x10013a68;
+s3 = 0x10015350;
+s2 = 0x10013a64;
+v0 = MEM_U32(v0 + 0);
+L40c0b8:
+s0 = zero;
+if (v0 == 0) goto L40c110;
+s1 = zero;
+L40c0c4:
+t0 = MEM_U32(s4 + 0);
+t1 = t0 + s1;
+t3 = MEM_U32(t1 + 0);
+MEM_U32(s3 + 0) = t3;
+t2 = MEM_U32(t1 + 4);
+MEM_U32(s3 + 4) = t2;
+t3 = MEM_U32(t1 + 8);
+MEM_U32(s3 + 8) = t3;
+t2 = MEM_U32(t1 + 12);
+MEM_U32(s3 + 12) = t2;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+v0 = MEM_U32(s2 + 0);
+s0 = s0 + 0x1;
+s1 = s1 + 0x10;
+// bdead 407e000b gp = MEM_U32(sp + 48);
+if (s0 < v0) goto L40c0c4;
+L40c110:
+s5 = s5 + 0xffffffff;
+//nop;
+if (s5 != 0) goto L40c0b8;
+L40c11c:
+// bdead 1 ra = MEM_U32(sp + 52);
+L40c120:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x38;
+return;
+}
+
+static void func_40c140(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t6 = 0, t8 = 0, t9 = 0;
+L40c140:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a58;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+a1 = a0;
+//nop;
+if (t6 == 0) goto L40c18c;
+//nop;
+a0 = zero;
+MEM_U32(sp + 32) = a1;
+// fdead 4000806b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+L40c18c:
+at = 0x10013a50;
+v1 = 0x10015350;
+t8 = a1 & 0x3f;
+MEM_U32(at + 0) = zero;
+t9 = MEM_U8(v1 + 5);
+at = 0x24;
+t0 = t9 & 0xffc0;
+t1 = t8 | t0;
+MEM_U8(v1 + 5) = (uint8_t)t1;
+if (a1 != at) goto L40c1fc;
+t2 = 0x100142b0;
+at = 0x69;
+a1 = zero;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 != at) goto L40c1e0;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40c214;
+L40c1e0:
+//nop;
+a0 = 0x1000f0c4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40c214;
+L40c1fc:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+MEM_U32(v1 + 0) = v0;
+L40c214:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40c224(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t1 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+t8 = 0, t9 = 0;
+L40c224:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 20) = s0;
+s0 = 0x10015350;
+// fdead 4002002b MEM_U32(sp + 28) = ra;
+// fdead 4002002b MEM_U32(sp + 24) = gp;
+t6 = MEM_U8(s0 + 5);
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x25;
+MEM_U8(s0 + 5) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40020109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 == 0) goto L40c2b0;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 40020109 gp = MEM_U32(sp + 24);
+MEM_U32(s0 + 12) = v0;
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t9 = MEM_U32(sp + 36);
+MEM_U32(s0 + 0) = v0;
+t4 = MEM_U8(s0 + 8);
+t1 = MEM_U32(t9 + 20);
+// bdead 22401 gp = MEM_U32(sp + 24);
+t5 = t4 & 0xff01;
+t3 = t1 << 1;
+t6 = t3 | t5;
+MEM_U8(s0 + 8) = (uint8_t)t6;
+L40c2b0:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_40c2c4(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40c2c4:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffd8;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000802f MEM_U32(sp + 28) = ra;
+// fdead 4000802f MEM_U32(sp + 24) = gp;
+a1 = zero;
+if (t6 == at) goto L40c30c;
+//nop;
+a0 = 0x1000f0d8;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40c508;
+L40c30c:
+v1 = 0x10015350;
+a0 = 0x100146b8;
+t7 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x2f;
+MEM_U8(v1 + 5) = (uint8_t)t9;
+//nop;
+a0 = MEM_U32(a0 + 0);
+a0 = a0 + 0x2;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+t0 = 0x2d;
+MEM_U8(v0 + 0) = (uint8_t)t0;
+//nop;
+a0 = v0 + 0x1;
+a1 = 0x100142b8;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+//nop;
+//nop;
+v0 = f_which_opt(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+MEM_U32(sp + 36) = v0;
+//nop;
+//nop;
+wrapper_free(mem, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+a1 = MEM_U32(sp + 36);
+// bdead 40000143 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+if ((int)a1 < (int)0xc) goto L40c3d8;
+t1 = a1 + 0xffffffa9;
+//nop;
+if (t1 >= 0x6) goto L40c4dc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t1) {
+case 0: goto L40c48c;
+case 1: goto L40c4a4;
+case 2: goto L40c4c0;
+case 3: goto L40c4f8;
+case 4: goto L40c4f8;
+case 5: goto L40c4f8;
+}
+L40c3d8:
+t2 = a1 + 0xfffffffa;
+//nop;
+if (t2 >= 0x6) goto L40c4dc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t2) {
+case 0: goto L40c438;
+case 1: goto L40c404;
+case 2: goto L40c41c;
+case 3: goto L40c438;
+case 4: goto L40c454;
+case 5: goto L40c470;
+}
+L40c404:
+t3 = MEM_U8(v1 + 6);
+MEM_U32(v1 + 12) = zero;
+t4 = t3 & 0xff3f;
+t5 = t4 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t5;
+goto L40c4f8;
+L40c41c:
+t6 = MEM_U8(v1 + 6);
+t9 = 0x1;
+MEM_U32(v1 + 12) = t9;
+t7 = t6 & 0xff3f;
+t8 = t7 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t8;
+goto L40c4f8;
+L40c438:
+t0 = MEM_U8(v1 + 6);
+t3 = 0x2;
+MEM_U32(v1 + 12) = t3;
+t1 = t0 & 0xff3f;
+t2 = t1 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t2;
+goto L40c4f8;
+L40c454:
+t4 = MEM_U8(v1 + 6);
+t7 = 0x3;
+MEM_U32(v1 + 12) = t7;
+t5 = t4 & 0xff3f;
+t6 = t5 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t6;
+goto L40c4f8;
+L40c470:
+t8 = MEM_U8(v1 + 6);
+t1 = 0x4;
+MEM_U32(v1 + 12) = t1;
+t9 = t8 & 0xff3f;
+t0 = t9 | 0x40;
+MEM_U8(v1 + 6) = (uint8_t)t0;
+goto L40c4f8;
+L40c48c:
+t2 = MEM_U8(v1 + 6);
+MEM_U32(v1 + 12) = zero;
+t3 = t2 & 0xff3f;
+t4 = t3 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t4;
+goto L40c4f8;
+L40c4a4:
+t5 = MEM_U8(v1 + 6);
+t8 = 0x1;
+MEM_U32(v1 + 12) = t8;
+t6 = t5 & 0xff3f;
+t7 = t6 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t7;
+goto L40c4f8;
+L40c4c0:
+t9 = MEM_U8(v1 + 6);
+t2 = 0x2;
+MEM_U32(v1 + 12) = t2;
+t0 = t9 & 0xff3f;
+t1 = t0 | 0x80;
+MEM_U8(v1 + 6) = (uint8_t)t1;
+goto L40c4f8;
+L40c4dc:
+//nop;
+a0 = 0x1000f0f0;
+a1 = zero;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40c4f8:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40c508:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t func_40c518(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+L40c518:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s2 = a0;
+// fdead 4008006b MEM_U32(sp + 44) = ra;
+// fdead 4008006b MEM_U32(sp + 40) = gp;
+s0 = zero;
+s1 = 0x10012490;
+s3 = 0x11;
+L40c550:
+//nop;
+a0 = s2;
+a1 = MEM_U32(s1 + 0);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 401e0003 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L40c574;
+v0 = s0;
+goto L40c584;
+L40c574:
+s0 = s0 + 0x1;
+s1 = s1 + 0x4;
+if (s0 != s3) goto L40c550;
+v0 = zero;
+L40c584:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void func_40c5a0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L40c5a0:
+//nop;
+//nop;
+//nop;
+a1 = 0x10015350;
+t9 = 0x100142b0;
+sp = sp + 0xffffffe0;
+t6 = MEM_U8(a1 + 5);
+MEM_U32(a1 + 0) = zero;
+at = 0x69;
+t7 = t6 & 0xffc0;
+t8 = t7 | 0x20;
+MEM_U8(a1 + 5) = (uint8_t)t8;
+t9 = MEM_U8(t9 + 0);
+// fdead 4601806f MEM_U32(sp + 28) = ra;
+// fdead 4601806f MEM_U32(sp + 24) = gp;
+a1 = zero;
+if (t9 == at) goto L40c600;
+//nop;
+a0 = 0x1000f108;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L40c688;
+L40c600:
+//nop;
+a0 = 0x100142b8;
+// bdead 40000023 t9 = t9;
+//nop;
+v0 = func_40c518(mem, sp, a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x5;
+a2 = 0x2;
+a1 = 0x10015350;
+MEM_U32(a1 + 8) = v0;
+if (v0 == 0) goto L40c660;
+if (v0 == at) {
+at = 0x6;
+goto L40c644;}
+at = 0x6;
+//nop;
+if (v0 == at) goto L40c654;
+//nop;
+goto L40c678;
+L40c644:
+at = 0x10013a4c;
+t0 = 0x1;
+MEM_U32(at + 0) = t0;
+goto L40c678;
+L40c654:
+at = 0x10013a4c;
+MEM_U32(at + 0) = zero;
+goto L40c678;
+L40c660:
+//nop;
+a0 = 0x1000f120;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L40c678:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40c688:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40c6a8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40c6a8:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015350;
+t7 = a0 & 0x3f;
+sp = sp + 0xffffffe0;
+t8 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = zero;
+// fdead 4201003b MEM_U32(sp + 28) = ra;
+t9 = t8 & 0xffc0;
+t0 = t7 | t9;
+MEM_U8(v1 + 5) = (uint8_t)t0;
+//nop;
+// fdead 4601023b MEM_U32(sp + 24) = gp;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+if (v0 == 0) goto L40c750;
+t2 = MEM_U32(v0 + 20);
+t5 = MEM_U8(v1 + 6);
+t4 = t2 << 1;
+t6 = t5 & 0xff01;
+t8 = t4 | t6;
+MEM_U8(v1 + 6) = (uint8_t)t8;
+//nop;
+//nop;
+v0 = f_GetRegister(mem, sp);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+v1 = 0x10015350;
+if (v0 == 0) goto L40c750;
+t9 = MEM_U32(v0 + 20);
+t2 = MEM_U16(v1 + 6);
+t0 = t9 << 2;
+t1 = t0 & 0x1fc;
+t3 = t2 & 0xfe03;
+t5 = t1 | t3;
+MEM_U16(v1 + 6) = (uint16_t)t5;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40c750:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40c760(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40c760:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a58;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+//nop;
+if (t6 == 0) goto L40c7a0;
+//nop;
+a0 = zero;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40c7a0:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = v0;
+t7 = 0x10013a50;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L40c7e8;
+v1 = v0;
+if ((int)v0 >= 0) goto L40c7d4;
+v1 = zero;
+goto L40c7d4;
+L40c7d4:
+v0 = 0x10013a54;
+t8 = MEM_U32(v0 + 0);
+t9 = v1 + t8;
+MEM_U32(v0 + 0) = t9;
+goto L40c818;
+L40c7e8:
+v0 = 0x10015350;
+t0 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 8) = v1;
+t1 = t0 & 0xffc0;
+t2 = t1 | 0x14;
+MEM_U8(v0 + 5) = (uint8_t)t2;
+MEM_U32(v0 + 12) = zero;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40c818:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_40c828(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40c828:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 60) = ra;
+// fdead 4000802b MEM_U32(sp + 56) = gp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 52) = s7;
+// fdead 4000802b MEM_U32(sp + 48) = s6;
+// fdead 4000802b MEM_U32(sp + 44) = s5;
+// fdead 4000802b MEM_U32(sp + 40) = s4;
+// fdead 4000802b MEM_U32(sp + 36) = s3;
+// fdead 4000802b MEM_U32(sp + 32) = s2;
+// fdead 4000802b MEM_U32(sp + 28) = s1;
+// fdead 4000802b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40c884;
+//nop;
+a0 = 0x2;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+L40c884:
+s7 = 0x100142b0;
+s6 = 0x23;
+s5 = 0x10013a50;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+L40c8a4:
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 76) = zero;
+// bdead 41ff0103 t9 = t9;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40b890(mem, sp, a0, a1, a2);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+if (v0 == 0) goto L40c94c;
+t8 = MEM_U32(s5 + 0);
+v0 = MEM_U32(sp + 80);
+t1 = MEM_U32(sp + 84);
+v0 = v0 << 2;
+if (t8 == 0) goto L40c90c;
+v1 = v0;
+if ((int)v0 >= (int)0x4) goto L40c8fc;
+v1 = 0x4;
+goto L40c8fc;
+L40c8fc:
+t9 = MEM_U32(s1 + 0);
+t0 = v1 + t9;
+MEM_U32(s1 + 0) = t0;
+goto L40c940;
+L40c90c:
+t2 = MEM_U8(s0 + 5);
+t5 = MEM_U32(sp + 76);
+t6 = MEM_U32(sp + 80);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x16;
+MEM_U32(s0 + 0) = t1;
+MEM_U8(s0 + 5) = (uint8_t)t4;
+MEM_U32(s0 + 8) = t5;
+MEM_U32(s0 + 12) = t6;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+L40c940:
+t7 = MEM_U8(s7 + 0);
+//nop;
+if (s6 != t7) goto L40c8a4;
+L40c94c:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40c978(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0;
+L40c978:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+t6 = 0x10013a58;
+// fdead 4000802b MEM_U32(sp + 60) = ra;
+// fdead 4000802b MEM_U32(sp + 56) = gp;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 52) = s7;
+// fdead 4000802b MEM_U32(sp + 48) = s6;
+// fdead 4000802b MEM_U32(sp + 44) = s5;
+// fdead 4000802b MEM_U32(sp + 40) = s4;
+// fdead 4000802b MEM_U32(sp + 36) = s3;
+// fdead 4000802b MEM_U32(sp + 32) = s2;
+// fdead 4000802b MEM_U32(sp + 28) = s1;
+// fdead 4000802b MEM_U32(sp + 24) = s0;
+if (t6 == 0) goto L40c9d4;
+//nop;
+a0 = 0x2;
+// fdead 4000802b t9 = t9;
+//nop;
+func_405650(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 56);
+L40c9d4:
+s7 = 0x100142b0;
+s6 = 0x23;
+s5 = 0x10013a50;
+s4 = sp + 0x50;
+s3 = sp + 0x4c;
+s2 = sp + 0x54;
+s1 = 0x10013a54;
+s0 = 0x10015350;
+L40c9f4:
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 76) = zero;
+// bdead 41ff0103 t9 = t9;
+MEM_U32(sp + 80) = t7;
+MEM_U32(sp + 84) = zero;
+a0 = s2;
+a1 = s3;
+a2 = s4;
+v0 = func_40b890(mem, sp, a0, a1, a2);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+if (v0 == 0) goto L40ca9c;
+t8 = MEM_U32(s5 + 0);
+v0 = MEM_U32(sp + 80);
+t1 = MEM_U32(sp + 84);
+v0 = v0 << 2;
+if (t8 == 0) goto L40ca5c;
+v1 = v0;
+if ((int)v0 >= (int)0x4) goto L40ca4c;
+v1 = 0x4;
+goto L40ca4c;
+L40ca4c:
+t9 = MEM_U32(s1 + 0);
+t0 = t9 + v1;
+MEM_U32(s1 + 0) = t0;
+goto L40ca90;
+L40ca5c:
+t2 = MEM_U8(s0 + 5);
+t5 = MEM_U32(sp + 76);
+t6 = MEM_U32(sp + 80);
+t3 = t2 & 0xffc0;
+t4 = t3 | 0x10;
+MEM_U32(s0 + 0) = t1;
+MEM_U8(s0 + 5) = (uint8_t)t4;
+MEM_U32(s0 + 8) = t5;
+MEM_U32(s0 + 12) = t6;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 41fe0103 gp = MEM_U32(sp + 56);
+L40ca90:
+t7 = MEM_U8(s7 + 0);
+//nop;
+if (s6 != t7) goto L40c9f4;
+L40ca9c:
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 s6 = MEM_U32(sp + 48);
+// bdead 1 s7 = MEM_U32(sp + 52);
+// bdead 1 sp = sp + 0x58;
+return;
+}
+
+static void func_40cac8(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L40cac8:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 24) = gp;
+a1 = sp + 0x24;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40cb14;
+//nop;
+a0 = s0;
+a1 = sp + 0x24;
+a2 = zero;
+f_EnterSym(mem, sp, a0, a1, a2);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+L40cb14:
+t6 = MEM_U32(sp + 36);
+at = 0x3;
+t7 = MEM_U32(sp + 36);
+v0 = MEM_U32(t6 + 16);
+a2 = zero;
+if (v0 == at) {
+at = 0x4;
+goto L40cb54;}
+at = 0x4;
+a1 = s0;
+if (v0 == at) goto L40cb54;
+//nop;
+a0 = 0x1000f138;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40cc04;
+L40cb54:
+//nop;
+a1 = 0x10013a40;
+a0 = MEM_U32(t7 + 24);
+a1 = MEM_U32(a1 + 0);
+f_sym_define(mem, sp, a0, a1, a2);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 36);
+v1 = 0x10015350;
+t9 = MEM_U32(t8 + 24);
+t2 = 0x10015378;
+t0 = MEM_U8(v1 + 5);
+MEM_U32(v1 + 0) = t9;
+t1 = t0 & 0xffc0;
+MEM_U8(v1 + 5) = (uint8_t)t1;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 == 0) goto L40cbf4;
+t3 = MEM_U8(s0 + 0);
+t4 = 0xfb4cba0;
+t9 = MEM_U32(sp + 36);
+t5 = t3 + t4;
+t6 = MEM_U8(t5 + 1);
+t7 = t6 & 0x4;
+if (t7 == zero) {
+a0 = MEM_U32(t9 + 24);
+goto L40cbdc;}
+//nop;
+t8 = MEM_U32(sp + 36);
+a1 = zero;
+// bdead 42000041 t9 = t9;
+a0 = MEM_U32(t8 + 24);
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L40cbf4;
+// fdead 0 a0 = MEM_U32(t9 + 24);
+L40cbdc:
+//nop;
+a1 = s0;
+// bdead 40000061 t9 = t9;
+//nop;
+func_4055c4(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40cbf4:
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40cc04:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_Parsestmt(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40cc18:
+//Parsestmt:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbc8;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = sp + 0x38;
+//nop;
+a1 = 0x100142b8;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x23;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d74c;}
+t6 = 0x10013a70;
+t6 = MEM_U32(t6 + 0);
+if (t6 == zero) {
+at = 0x64;
+goto L40ccc4;}
+v0 = 0x10015350;
+t0 = 0x10013ea0;
+t1 = 0x10013ea4;
+t7 = MEM_U8(v0 + 5);
+MEM_U32(v0 + 0) = zero;
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x1c;
+MEM_U8(v0 + 5) = (uint8_t)t9;
+t0 = MEM_U32(t0 + 0);
+MEM_U32(v0 + 8) = t0;
+t1 = MEM_U32(t1 + 0);
+MEM_U32(v0 + 12) = t1;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x64;
+L40ccc4:
+if (v1 != at) {
+at = 0x69;
+goto L40cd44;}
+//nop;
+a0 = 0x100142b8;
+a1 = 0x100146b8;
+//nop;
+f_make_local_label(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a0 = sp + 0x38;
+//nop;
+a1 = 0x100142b8;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x3a;
+a1 = zero;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+at = 0x3d;
+goto L40cd84;}
+//nop;
+a0 = 0x1000f154;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+at = 0x69;
+L40cd44:
+a1 = zero;
+if (v1 == at) goto L40cd68;
+//nop;
+a0 = 0x1000f174;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+L40cd68:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+at = 0x3d;
+L40cd84:
+if (v1 != at) {
+at = 0x3a;
+goto L40cdac;}
+//nop;
+a0 = sp + 0x38;
+// fdead 6000007f t9 = t9;
+//nop;
+func_4057a4(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+at = 0x3a;
+L40cdac:
+//nop;
+if (v1 != at) goto L40ce68;
+t2 = 0x10013a50;
+t2 = MEM_U32(t2 + 0);
+//nop;
+if (t2 == 0) goto L40cde0;
+//nop;
+a0 = sp + 0x38;
+// fdead 6000087f t9 = t9;
+//nop;
+func_4056a8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40cdf8;
+L40cde0:
+//nop;
+a0 = sp + 0x38;
+// fdead 6000087f t9 = t9;
+//nop;
+func_40cac8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40cdf8:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x23;
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+if (v1 == at) {
+at = 0x69;
+goto L40d748;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L40ce40;
+//nop;
+a0 = 0x1000f188;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+L40ce40:
+//nop;
+a0 = sp + 0x38;
+a1 = 0x100142b8;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L40ce68:
+//nop;
+a0 = sp + 0x38;
+a1 = sp + 0x34;
+//nop;
+v0 = f_opLookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40ced8;
+//nop;
+a1 = 0x1000f19c;
+a0 = sp + 0x38;
+a1 = a1;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L40ceb8;
+//nop;
+// fdead 6000000f t9 = t9;
+//nop;
+func_40b4f0(mem, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+L40ceb8:
+//nop;
+a0 = 0x1000f1a4;
+a1 = sp + 0x38;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+L40ced8:
+t3 = MEM_U32(sp + 52);
+at = 0x2;
+v0 = MEM_U32(t3 + 16);
+if (v0 != at) {
+at = 0x1;
+goto L40d4e0;}
+a0 = MEM_U32(t3 + 20);
+t4 = a0 + 0xffffffff;
+//nop;
+if (t4 >= 0x3d) goto L40d478;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t4) {
+case 0: goto L40d1d4;
+case 1: goto L40d00c;
+case 2: goto L40d3f8;
+case 3: goto L40cf34;
+case 4: goto L40cf4c;
+case 5: goto L40cf68;
+case 6: goto L40cf84;
+case 7: goto L40cf9c;
+case 8: goto L40d054;
+case 9: goto L40cf1c;
+case 10: goto L40cfd4;
+case 11: goto L40d26c;
+case 12: goto L40cfb8;
+case 13: goto L40d03c;
+case 14: goto L40d414;
+case 15: goto L40d448;
+case 16: goto L40d42c;
+case 17: goto L40d024;
+case 18: goto L40d2b4;
+case 19: goto L40d0bc;
+case 20: goto L40cf1c;
+case 21: goto L40d0d4;
+case 22: goto L40d478;
+case 23: goto L40d104;
+case 24: goto L40cf1c;
+case 25: goto L40cf1c;
+case 26: goto L40d104;
+case 27: goto L40d134;
+case 28: goto L40d11c;
+case 29: goto L40d11c;
+case 30: goto L40d478;
+case 31: goto L40d0a4;
+case 32: goto L40d460;
+case 33: goto L40d164;
+case 34: goto L40d194;
+case 35: goto L40d11c;
+case 36: goto L40d14c;
+case 37: goto L40d1ec;
+case 38: goto L40d208;
+case 39: goto L40d1b4;
+case 40: goto L40d478;
+case 41: goto L40d254;
+case 42: goto L40d23c;
+case 43: goto L40cff0;
+case 44: goto L40d070;
+case 45: goto L40d104;
+case 46: goto L40d08c;
+case 47: goto L40d2cc;
+case 48: goto L40d2e8;
+case 49: goto L40d284;
+case 50: goto L40d29c;
+case 51: goto L40d224;
+case 52: goto L40d304;
+case 53: goto L40d304;
+case 54: goto L40d304;
+case 55: goto L40d304;
+case 56: goto L40d31c;
+case 57: goto L40d368;
+case 58: goto L40d0ec;
+case 59: goto L40d3c8;
+case 60: goto L40d3e0;
+}
+L40cf1c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a8e0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cf34:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a0a8(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cf4c:
+//nop;
+a0 = zero;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a248(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cf68:
+//nop;
+a0 = 0x1;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a248(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cf84:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a3c8(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cf9c:
+//nop;
+a0 = 0x8;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a530(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cfb8:
+//nop;
+a0 = 0x1;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40aac0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cfd4:
+//nop;
+a0 = 0x2;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40aac0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40cff0:
+//nop;
+a0 = 0x4;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40aac0(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d00c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40b238(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d024:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40b67c(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d03c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40b9f4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d054:
+//nop;
+a0 = 0x9;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a530(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d070:
+//nop;
+a0 = 0x2d;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a530(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d08c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c2c4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d0a4:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c5a0(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d0bc:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c760(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d0d4:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c828(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d0ec:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40606c(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d104:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40af20(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d11c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c140(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d134:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bba8(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d14c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c224(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d164:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a0 = 0x1;
+a1 = v0;
+//nop;
+// fdead 6000007f t9 = t9;
+//nop;
+func_40bfb0(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d194:
+//nop;
+a0 = zero;
+a1 = zero;
+// fdead 6000307f t9 = t9;
+//nop;
+func_40bfb0(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d1b4:
+//nop;
+a0 = 0x1000f1c4;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d1d4:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40a804(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d1ec:
+//nop;
+a0 = 0x26;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bf34(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d208:
+//nop;
+a0 = 0x27;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bf34(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d224:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409f98(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d23c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409d94(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d254:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409d24(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d26c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40acb4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d284:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bcdc(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d29c:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bd54(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d2b4:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bc64(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d2cc:
+//nop;
+a0 = 0x30;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c6a8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d2e8:
+//nop;
+a0 = 0x31;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c6a8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d304:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bf34(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d31c:
+t5 = 0x10015368;
+t5 = MEM_U32(t5 + 0);
+//nop;
+if (t5 == 0) goto L40d344;
+//nop;
+// fdead 6000703f t9 = t9;
+//nop;
+func_40a010(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d344:
+//nop;
+a0 = 0x1000f1e0;
+a1 = 0x1000f1e8;
+a2 = 0xe08;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d368:
+t6 = 0x10015368;
+t6 = MEM_U32(t6 + 0);
+//nop;
+if (t6 == 0) goto L40d3a4;
+t7 = 0x10015350;
+at = 0x10015350;
+t7 = MEM_U8(t7 + 5);
+t8 = t7 & 0xffc0;
+t9 = t8 | 0x3a;
+MEM_U8(at + 5) = (uint8_t)t9;
+//nop;
+//nop;
+f_put_binasmfyle(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d3a4:
+//nop;
+a0 = 0x1000f1f4;
+a1 = 0x1000f1fc;
+a2 = 0xe10;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d3c8:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40bdcc(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d3e0:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40be34(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d3f8:
+//nop;
+a0 = 0x3;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409b70(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d414:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409bf4(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d42c:
+//nop;
+a0 = 0x11;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409b70(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d448:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_40c978(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d460:
+//nop;
+// fdead 6000303f t9 = t9;
+//nop;
+func_409c80(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d498;
+L40d478:
+//nop;
+a0 = 0x1000f208;
+a1 = 0x1000f210;
+a2 = 0xe28;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40d498:
+t0 = 0x10014ac0;
+t0 = MEM_U32(t0 + 0);
+if (t0 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d74c;}
+t1 = 0x100142b0;
+at = 0x23;
+a1 = zero;
+t1 = MEM_U8(t1 + 0);
+if (t1 == at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d74c;}
+//nop;
+a0 = 0x1000f21c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+at = 0x1;
+L40d4e0:
+a1 = sp + 0x38;
+if (v0 != at) goto L40d730;
+t2 = MEM_U32(sp + 52);
+t3 = MEM_U32(t2 + 24);
+a0 = MEM_U32(t2 + 20);
+//nop;
+if (t3 >= 0x12) goto L40d6cc;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t3) {
+case 0: goto L40d51c;
+case 1: goto L40d594;
+case 2: goto L40d5c4;
+case 3: goto L40d57c;
+case 4: goto L40d564;
+case 5: goto L40d534;
+case 6: goto L40d624;
+case 7: goto L40d60c;
+case 8: goto L40d5f4;
+case 9: goto L40d63c;
+case 10: goto L40d54c;
+case 11: goto L40d5dc;
+case 12: goto L40d5ac;
+case 13: goto L40d654;
+case 14: goto L40d684;
+case 15: goto L40d66c;
+case 16: goto L40d69c;
+case 17: goto L40d6b4;
+}
+L40d51c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_40599c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d534:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_408928(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d54c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_409b00(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d564:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_4081bc(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d57c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_407808(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d594:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_4066b4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d5ac:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_406ea8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d5c4:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_4074d8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d5dc:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_407410(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d5f4:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_4096a8(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d60c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_40941c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d624:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_408f2c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d63c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_409a0c(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d654:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_4085a4(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d66c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_406b58(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d684:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_406208(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d69c:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_408300(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d6b4:
+//nop;
+// fdead 6000187f t9 = t9;
+//nop;
+func_408408(mem, sp, a0);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40d6ec;
+L40d6cc:
+//nop;
+a0 = 0x1000f23c;
+a1 = 0x1000f244;
+a2 = 0xe67;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40d6ec:
+t4 = 0x10014ac0;
+t4 = MEM_U32(t4 + 0);
+if (t4 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d74c;}
+t5 = 0x100142b0;
+at = 0x23;
+a1 = zero;
+t5 = MEM_U8(t5 + 0);
+if (t5 == at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d74c;}
+//nop;
+a0 = 0x1000f250;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d748;
+L40d730:
+//nop;
+a0 = 0x1000f270;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40d748:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40d74c:
+// bdead 1 sp = sp + 0x438;
+//nop;
+return;
+//nop;
+//nop;
+}
+
+static void func_40d760(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L40d760:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffee0;
+//nop;
+MEM_U32(sp + 292) = a1;
+a1 = a0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 288) = a0;
+MEM_U32(sp + 296) = a2;
+a2 = MEM_U32(sp + 292);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+a0 = sp + 0x20;
+a1 = MEM_U32(sp + 296);
+//nop;
+//nop;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x120;
+//nop;
+return;
+}
+
+static uint32_t f_sym_undefined(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40d7c4:
+//sym_undefined:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+t6 = sp + 0x28;
+// fdead 400080eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a1 = sp + 0x30;
+a2 = sp + 0x2c;
+a3 = sp + 0x34;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 ra = MEM_U32(sp + 36);
+v0 = MEM_U32(sp + 48);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x38;
+v0 = v0 < 0x1;
+return v0;
+}
+
+static void func_40d810(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40d810:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+at = at | 0xffff;
+// bdead 4000808f gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 52);
+v1 = v0;
+if (t6 != at) goto L40d99c;
+at = 0xe;
+v0 = a3 ^ 0x6;
+if (a3 == at) goto L40d870;
+a1 = v0 < 0x1;
+//nop;
+if (a1 == 0) goto L40d878;
+L40d870:
+a1 = MEM_U32(sp + 64);
+a1 = zero < a1;
+L40d878:
+//nop;
+a0 = MEM_U32(v1 + 4);
+MEM_U32(sp + 32) = a1;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(sp + 52);
+t1 = MEM_U8(v0 + 12);
+// bdead 4001050b gp = MEM_U32(sp + 24);
+t9 = t7 << 2;
+t2 = t1 & 0xff03;
+a1 = MEM_U32(sp + 32);
+t0 = MEM_U32(sp + 60);
+t3 = t9 | t2;
+MEM_U8(v0 + 12) = (uint8_t)t3;
+t5 = MEM_U32(sp + 56);
+t8 = MEM_U16(v0 + 12);
+t2 = 0x10012210;
+t6 = t5 << 5;
+t7 = t6 & 0x3e0;
+t1 = t8 & 0xfc1f;
+t9 = t7 | t1;
+MEM_U16(v0 + 12) = (uint16_t)t9;
+t2 = MEM_U32(t2 + 0);
+a2 = v0;
+if (t2 == zero) {
+MEM_U32(v0 + 8) = t0;
+goto L40d8fc;}
+t3 = MEM_U32(v0 + 8);
+//nop;
+if ((int)t3 >= (int)t0) goto L40d8fc;
+MEM_U32(v0 + 8) = t0;
+goto L40d8fc;
+// fdead 0 MEM_U32(v0 + 8) = t0;
+L40d8fc:
+if (a1 == zero) {
+v1 = MEM_U32(v0 + 12);
+goto L40d944;}
+//nop;
+a0 = 0xffffffff;
+MEM_U32(sp + 32) = a1;
+MEM_U32(sp + 44) = a2;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+a2 = MEM_U32(sp + 44);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = MEM_U32(a2 + 12);
+t4 = v0 ^ v1;
+t5 = t4 << 12;
+t6 = t5 >> 12;
+t8 = t6 ^ v1;
+MEM_U32(a2 + 12) = t8;
+goto L40d960;
+// fdead 0 v1 = MEM_U32(v0 + 12);
+L40d944:
+at = 0xf0000;
+at = at | 0xffff;
+t7 = v1 ^ at;
+t1 = t7 << 12;
+t9 = t1 >> 12;
+t2 = t9 ^ v1;
+MEM_U32(v0 + 12) = t2;
+L40d960:
+if (a1 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40d9b8;}
+//nop;
+MEM_U32(sp + 44) = a2;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+a2 = MEM_U32(sp + 44);
+// bdead 4000008b gp = MEM_U32(sp + 24);
+a0 = zero;
+MEM_U16(a2 + 2) = (uint16_t)v0;
+//nop;
+//nop;
+f_st_auxbtadd(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L40d9b4;
+L40d99c:
+//nop;
+a0 = 0x1000f800;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40d9b4:
+// bdead 1 ra = MEM_U32(sp + 28);
+L40d9b8:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40d9c4(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40d9c4:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+MEM_U32(sp + 44) = v0;
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+at = at | 0xffff;
+// bdead 40000183 gp = MEM_U32(sp + 32);
+if (t6 == at) goto L40da24;
+//nop;
+a0 = 0x1000f824;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+L40da24:
+//nop;
+t7 = MEM_U32(sp + 44);
+a0 = MEM_U32(t7 + 4);
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 52);
+at = 0xe;
+// bdead 4200010f gp = MEM_U32(sp + 32);
+s0 = v0;
+if (t8 == at) goto L40da54;
+at = 0x6;
+//nop;
+if (t8 != at) goto L40da6c;
+L40da54:
+//nop;
+a0 = 0x1000f848;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 32);
+L40da6c:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201c9 gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 40020009 gp = MEM_U32(sp + 32);
+t9 = 0xf0000;
+t9 = t9 | 0xffff;
+MEM_U32(sp + 16) = t9;
+//nop;
+a0 = v0;
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 52);
+a3 = MEM_U32(sp + 56);
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+t0 = MEM_U32(sp + 44);
+// bdead 400203c9 gp = MEM_U32(sp + 32);
+MEM_U32(t0 + 4) = v0;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t1 = MEM_U32(sp + 44);
+// bdead 20409 gp = MEM_U32(sp + 32);
+MEM_U32(t1 + 0) = v0;
+t2 = MEM_U8(s0 + 12);
+t3 = t2 & 0xff03;
+MEM_U8(s0 + 12) = (uint8_t)t3;
+t4 = MEM_U16(s0 + 12);
+t5 = t4 & 0xfc1f;
+MEM_U16(s0 + 12) = (uint16_t)t5;
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40db08(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40db08:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 76) = a1;
+MEM_U32(sp + 80) = a2;
+MEM_U32(sp + 84) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+MEM_U32(sp + 68) = v0;
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+at = at | 0xffff;
+// bdead 40000183 gp = MEM_U32(sp + 32);
+if (t6 == at) goto L40db68;
+//nop;
+a0 = 0x1000f86c;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 32);
+L40db68:
+//nop;
+t7 = MEM_U32(sp + 68);
+a0 = MEM_U32(t7 + 4);
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 76);
+// bdead 4000008b gp = MEM_U32(sp + 32);
+s0 = v0;
+a1 = a2 ^ 0xe;
+a1 = a1 < 0x1;
+a0 = a2 ^ 0x6;
+if (a1 != 0) goto L40dba0;
+v1 = a0 < 0x1;
+//nop;
+if (v1 == 0) goto L40dbc8;
+L40dba0:
+v1 = MEM_U32(v0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+v1 = v1 & at;
+v1 = v1 ^ at;
+v1 = v1 < 0x1;
+//nop;
+if (v1 == 0) goto L40dbc8;
+v1 = MEM_U32(sp + 88);
+v1 = zero < v1;
+L40dbc8:
+//nop;
+MEM_U32(sp + 60) = v1;
+a0 = MEM_U32(s0 + 4);
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 56) = v1;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+v1 = MEM_U32(sp + 56);
+// bdead 400201db gp = MEM_U32(sp + 32);
+MEM_U32(sp + 52) = v0;
+if (v1 == zero) {
+v1 = MEM_U32(s0 + 12);
+goto L40dc28;}
+//nop;
+a0 = 0xffffffff;
+//nop;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = v0;
+goto L40dc34;
+// fdead 0 v1 = MEM_U32(s0 + 12);
+L40dc28:
+at = 0xf0000;
+at = at | 0xffff;
+v1 = v1 & at;
+L40dc34:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 84);
+a2 = MEM_U32(sp + 76);
+a3 = MEM_U32(sp + 80);
+MEM_U32(sp + 16) = v1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(sp + 68);
+// bdead 420201cb gp = MEM_U32(sp + 32);
+MEM_U32(t8 + 4) = v0;
+t9 = MEM_U32(sp + 60);
+//nop;
+if (t9 == 0) goto L40dc7c;
+//nop;
+a0 = zero;
+//nop;
+f_st_auxbtadd(mem, sp, a0);
+// bdead 400201c3 gp = MEM_U32(sp + 32);
+L40dc7c:
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t0 = MEM_U32(sp + 68);
+// bdead 4002020b gp = MEM_U32(sp + 32);
+MEM_U32(t0 + 0) = v0;
+t1 = MEM_U8(s0 + 12);
+t2 = t1 & 0xff03;
+MEM_U8(s0 + 12) = (uint8_t)t2;
+t3 = MEM_U16(s0 + 12);
+t4 = t3 & 0xfc1f;
+MEM_U16(s0 + 12) = (uint16_t)t4;
+t5 = MEM_U32(sp + 44);
+if (t5 == zero) {
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40dcdc;}
+v0 = MEM_U32(s0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t6 = v0 ^ at;
+t7 = t6 << 12;
+t8 = t7 >> 12;
+t9 = t8 ^ v0;
+MEM_U32(s0 + 12) = t9;
+// bdead 1 ra = MEM_U32(sp + 36);
+L40dcdc:
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x48;
+//nop;
+return;
+}
+
+static uint32_t func_40dcec(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0;
+L40dcec:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L40dd40;
+//nop;
+a0 = 0x1000f890;
+a0 = a0;
+wrapper_perror(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x2;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L40dd40:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_sym_init(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, t6 = 0, t7 = 0;
+L40dd54:
+//sym_init:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+f_st_cuinit(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+// bdead 8003 ra = MEM_U32(sp + 28);
+at = 0x10012214;
+t7 = zero < t6;
+// bdead 10005 sp = sp + 0x20;
+MEM_U32(at + 0) = t7;
+return;
+}
+
+static void f_sym_finish(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0,
+t8 = 0, t9 = 0;
+L40dd98:
+//sym_finish:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 4000006b MEM_U32(sp + 32) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 68) = ra;
+// fdead 4002006b MEM_U32(sp + 64) = gp;
+// fdead 4002006b MEM_U32(sp + 60) = s7;
+// fdead 4002006b MEM_U32(sp + 56) = s6;
+// fdead 4002006b MEM_U32(sp + 52) = s5;
+// fdead 4002006b MEM_U32(sp + 48) = s4;
+// fdead 4002006b MEM_U32(sp + 44) = s3;
+// fdead 4002006b MEM_U32(sp + 40) = s2;
+// fdead 4002006b MEM_U32(sp + 36) = s1;
+MEM_U32(sp + 108) = a1;
+if (a1 != 0) goto L40de5c;
+//nop;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40020009 gp = MEM_U32(sp + 64);
+s1 = v0;
+a0 = v0;
+//nop;
+// fdead 6006002b t9 = t9;
+//nop;
+v0 = func_40dcec(mem, sp, a0);
+// bdead 40060009 gp = MEM_U32(sp + 64);
+a0 = v0 + 0x3;
+a1 = s0;
+//nop;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+MEM_U32(sp + 108) = v0;
+t7 = s1 + s0;
+t8 = MEM_U8(t7 + -1);
+at = 0x47;
+// bdead 4204000d gp = MEM_U32(sp + 64);
+t9 = 0x54;
+if (t8 != at) goto L40de44;
+t0 = v0 + s1;
+MEM_U8(t0 + -1) = (uint8_t)t9;
+goto L40de5c;
+L40de44:
+//nop;
+a1 = 0x1000f8a0;
+a0 = MEM_U32(sp + 108);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+L40de5c:
+//nop;
+s0 = 0x2;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t1 = MEM_U32(v0 + 60);
+// bdead 400205c1 gp = MEM_U32(sp + 64);
+s6 = 0x6;
+s5 = 0x1;
+if ((int)t1 < (int)0x3) goto L40df44;
+s7 = 0x1000f8a4;
+s4 = sp + 0x54;
+s3 = sp + 0x60;
+s2 = sp + 0x58;
+s1 = sp + 0x5c;
+s7 = s7;
+L40de9c:
+//nop;
+a0 = s0;
+a1 = s1;
+a2 = s2;
+a3 = s3;
+MEM_U32(sp + 16) = s4;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 92);
+a1 = v0;
+// bdead 41fe01c1 gp = MEM_U32(sp + 64);
+v0 = MEM_U32(sp + 88);
+if (a2 != 0) goto L40df20;
+a0 = s0;
+if (v0 != 0) goto L40def4;
+//nop;
+a1 = s5;
+a3 = MEM_U32(sp + 96);
+// fdead 61fe01ff t9 = t9;
+MEM_U32(sp + 16) = s5;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0001 gp = MEM_U32(sp + 64);
+goto L40df20;
+L40def4:
+//nop;
+if (v0 == s5) goto L40df20;
+//nop;
+if (v0 == s6) goto L40df20;
+//nop;
+a0 = s7;
+a2 = s5;
+// fdead 61fe00ff t9 = t9;
+//nop;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 41fe0001 gp = MEM_U32(sp + 64);
+L40df20:
+//nop;
+s0 = s0 + 0x1;
+//nop;
+v0 = f_st_currentpchdr(mem, sp);
+t2 = MEM_U32(v0 + 60);
+// bdead 41fe09c1 gp = MEM_U32(sp + 64);
+//nop;
+if ((int)s0 < (int)t2) goto L40de9c;
+L40df44:
+//nop;
+//nop;
+f_st_endallfiles(mem, sp);
+// bdead 40000001 gp = MEM_U32(sp + 64);
+a0 = MEM_U32(sp + 108);
+a1 = 0xffffffff;
+//nop;
+//nop;
+f_st_writebinary(mem, sp, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 68);
+// bdead 1 gp = MEM_U32(sp + 64);
+// bdead 1 s0 = MEM_U32(sp + 32);
+// bdead 1 s1 = MEM_U32(sp + 36);
+// bdead 1 s2 = MEM_U32(sp + 40);
+// bdead 1 s3 = MEM_U32(sp + 44);
+// bdead 1 s4 = MEM_U32(sp + 48);
+// bdead 1 s5 = MEM_U32(sp + 52);
+// bdead 1 s6 = MEM_U32(sp + 56);
+// bdead 1 s7 = MEM_U32(sp + 60);
+// bdead 1 sp = sp + 0x68;
+return;
+}
+
+static uint32_t f_sym_enter(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a2 = 0, a3 = 0, t6 = 0;
+L40df98:
+//sym_enter:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 44) = a1;
+v0 = f_st_extstradd(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+t6 = 0xf0000;
+t6 = t6 | 0xffff;
+//nop;
+MEM_U32(sp + 16) = t6;
+a0 = v0;
+a1 = zero;
+a2 = zero;
+a3 = zero;
+v0 = f_st_extadd(mem, sp, a0, a1, a2, a3);
+// bdead 40000189 gp = MEM_U32(sp + 32);
+a0 = v0;
+a1 = 0x1;
+//nop;
+//nop;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_sym_define(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e010:
+//sym_define:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+MEM_U32(sp + 68) = a1;
+MEM_U32(sp + 72) = a2;
+t6 = sp + 0x30;
+// fdead 400080eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 16) = t6;
+a2 = sp + 0x34;
+a1 = sp + 0x38;
+a3 = sp + 0x3c;
+MEM_U32(sp + 64) = a0;
+v0 = f_st_sym_idn(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 68);
+// bdead 4000008b gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+at = a2 < 0x24;
+a3 = MEM_U32(sp + 72);
+MEM_U32(sp + 44) = v0;
+if (at == 0) goto L40e670;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (a2) {
+case 0: goto L40e630;
+case 1: goto L40e124;
+case 2: goto L40e278;
+case 3: goto L40e670;
+case 4: goto L40e670;
+case 5: goto L40e088;
+case 6: goto L40e670;
+case 7: goto L40e670;
+case 8: goto L40e670;
+case 9: goto L40e670;
+case 10: goto L40e670;
+case 11: goto L40e670;
+case 12: goto L40e670;
+case 13: goto L40e278;
+case 14: goto L40e670;
+case 15: goto L40e278;
+case 16: goto L40e670;
+case 17: goto L40e33c;
+case 18: goto L40e670;
+case 19: goto L40e670;
+case 20: goto L40e670;
+case 21: goto L40e670;
+case 22: goto L40e670;
+case 23: goto L40e670;
+case 24: goto L40e670;
+case 25: goto L40e670;
+case 26: goto L40e670;
+case 27: goto L40e670;
+case 28: goto L40e670;
+case 29: goto L40e670;
+case 30: goto L40e670;
+case 31: goto L40e670;
+case 32: goto L40e670;
+case 33: goto L40e40c;
+case 34: goto L40e4dc;
+case 35: goto L40e594;
+}
+L40e088:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e0c8;
+a2 = 0x5;
+if (a1 != 0) goto L40e0c8;
+//nop;
+t8 = 0x1;
+MEM_U32(sp + 16) = t8;
+// fdead 620001ff t9 = t9;
+a1 = 0x2;
+a3 = MEM_U32(sp + 60);
+func_40db08(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e0c8:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e0fc;
+t9 = 0x1;
+if (a1 != 0) goto L40e0fc;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = 0x1;
+a2 = 0x5;
+// bdead 400000e1 t9 = t9;
+a3 = MEM_U32(sp + 60);
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e0fc:
+//nop;
+a0 = 0x1000f8bc;
+a1 = MEM_U32(sp + 44);
+// bdead 40000161 t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e124:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+at = 0xe;
+//nop;
+if (v0 != 0) goto L40e160;
+a2 = 0x1;
+if (a1 != 0) goto L40e160;
+//nop;
+a1 = 0x5;
+a3 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+MEM_U32(sp + 16) = zero;
+func_40db08(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e160:
+a1 = MEM_U32(sp + 56);
+if (v0 != at) goto L40e1c0;
+a2 = 0x1;
+if (a1 != 0) goto L40e1c0;
+//nop;
+t0 = 0x1;
+MEM_U32(sp + 16) = t0;
+// fdead 600003ff t9 = t9;
+a1 = 0xe;
+a3 = MEM_U32(sp + 60);
+MEM_U32(sp + 64) = a0;
+func_40db08(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+f_st_procbegin(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+f_st_pdadd_idn(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e1c0:
+at = 0x6;
+v1 = 0x1;
+if (v0 != at) goto L40e224;
+a2 = zero;
+if (a1 != 0) goto L40e224;
+//nop;
+t1 = 0x1;
+MEM_U32(sp + 16) = t1;
+// fdead 600005ff t9 = t9;
+a1 = 0x6;
+a3 = MEM_U32(sp + 60);
+MEM_U32(sp + 64) = a0;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+f_st_procbegin(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 64);
+//nop;
+//nop;
+f_st_pdadd_idn(mem, sp, a0);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e224:
+a2 = 0x1;
+if (v0 != v1) goto L40e254;
+a3 = MEM_U32(sp + 60);
+if (a1 != 0) goto L40e254;
+//nop;
+a1 = 0x5;
+a2 = 0x1;
+// fdead 600001ff t9 = t9;
+MEM_U32(sp + 16) = zero;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e254:
+//nop;
+a0 = 0x1000f8e0;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e278:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e2b4;
+//nop;
+if (a1 != 0) goto L40e2b4;
+//nop;
+a1 = 0x2;
+a3 = MEM_U32(sp + 60);
+// fdead 600001ff t9 = t9;
+//nop;
+func_40d9c4(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e2b4:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e2e4;
+a3 = MEM_U32(sp + 60);
+if (a1 != 0) goto L40e2e4;
+//nop;
+t2 = 0x1;
+MEM_U32(sp + 16) = t2;
+// fdead 600009ff t9 = t9;
+a1 = 0x1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e2e4:
+at = 0x11;
+if (v0 != v1) goto L40e314;
+a3 = MEM_U32(sp + 60);
+if (a1 != at) goto L40e314;
+//nop;
+t3 = 0x1;
+MEM_U32(sp + 16) = t3;
+// fdead 600011ff t9 = t9;
+a1 = 0x1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e314:
+//nop;
+a0 = 0x1000f904;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e33c:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e378;
+a2 = 0x11;
+if (a1 != 0) goto L40e378;
+//nop;
+t4 = 0x1;
+MEM_U32(sp + 16) = t4;
+// fdead 600021ff t9 = t9;
+a1 = 0x1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e378:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e3a8;
+a2 = 0x11;
+if (a1 != 0) goto L40e3a8;
+//nop;
+t5 = 0x1;
+MEM_U32(sp + 16) = t5;
+// fdead 600041ff t9 = t9;
+a1 = 0x1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e3a8:
+at = 0x11;
+if (v0 != v1) goto L40e3e4;
+a2 = 0x11;
+if (a1 != at) goto L40e3e4;
+//nop;
+at = 0x10012210;
+a1 = v1;
+// fdead 600001ff t9 = t9;
+MEM_U32(sp + 16) = v1;
+MEM_U32(at + 0) = v1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 32);
+at = 0x10012210;
+MEM_U32(at + 0) = zero;
+goto L40e690;
+L40e3e4:
+//nop;
+a0 = 0x1000f928;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e40c:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e448;
+//nop;
+if (a1 != 0) goto L40e448;
+//nop;
+a1 = 0x2;
+a2 = 0x11;
+// fdead 600001ff t9 = t9;
+//nop;
+func_40d9c4(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e448:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e478;
+a2 = 0x3;
+if (a1 != 0) goto L40e478;
+//nop;
+t6 = 0x1;
+MEM_U32(sp + 16) = t6;
+// fdead 600081ff t9 = t9;
+a1 = 0x1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e478:
+at = 0x3;
+if (v0 != v1) goto L40e4b4;
+a2 = 0x3;
+if (a1 != at) goto L40e4b4;
+//nop;
+at = 0x10012210;
+a1 = v1;
+// fdead 600001ff t9 = t9;
+MEM_U32(sp + 16) = v1;
+MEM_U32(at + 0) = v1;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 3 gp = MEM_U32(sp + 32);
+at = 0x10012210;
+MEM_U32(at + 0) = zero;
+goto L40e690;
+L40e4b4:
+//nop;
+a0 = 0x1000f95c;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e4dc:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e51c;
+a2 = zero;
+if (a1 != 0) goto L40e51c;
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 16) = t7;
+// fdead 600101ff t9 = t9;
+a1 = 0x1;
+a3 = MEM_U32(sp + 60);
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e51c:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e52c;
+if (a1 == zero) {
+// bdead 1 v0 = 0x1;
+goto L40e694;}
+L40e52c:
+at = 0x11;
+if (v0 != v1) goto L40e538;
+if (a1 == at) {
+at = 0xe;
+goto L40e690;}
+L40e538:
+at = 0xe;
+a2 = 0x1;
+if (v0 != at) goto L40e570;
+a3 = MEM_U32(sp + 60);
+if (a1 != 0) goto L40e570;
+//nop;
+t8 = 0x1;
+MEM_U32(sp + 16) = t8;
+// fdead 620001ff t9 = t9;
+a1 = 0x6;
+a2 = zero;
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e570:
+//nop;
+a0 = 0x1000f990;
+a1 = MEM_U32(sp + 44);
+// fdead 600001ff t9 = t9;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e594:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+v1 = 0x1;
+//nop;
+if (v0 != 0) goto L40e5d4;
+t9 = 0x1;
+if (a1 != 0) goto L40e5d4;
+MEM_U32(sp + 16) = t9;
+//nop;
+a1 = 0xe;
+a2 = zero;
+// bdead 400000e1 t9 = t9;
+a3 = MEM_U32(sp + 60);
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e5d4:
+a1 = MEM_U32(sp + 56);
+if (v0 != v1) goto L40e608;
+a2 = zero;
+if (a1 != 0) goto L40e608;
+//nop;
+t0 = 0x1;
+MEM_U32(sp + 16) = t0;
+// bdead 400000a1 t9 = t9;
+a1 = 0x6;
+a3 = MEM_U32(sp + 60);
+func_40d810(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+goto L40e690;
+L40e608:
+//nop;
+a0 = 0x1000f9c4;
+a1 = MEM_U32(sp + 44);
+// bdead 40000161 t9 = t9;
+a2 = 0x1;
+a0 = a0;
+func_40d760(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e630:
+v0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+if (v0 != 0) goto L40e650;
+//nop;
+if (a1 != 0) goto L40e650;
+// bdead 1 v0 = 0x1;
+goto L40e694;
+L40e650:
+//nop;
+a0 = 0x1000f9f8;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e670:
+//nop;
+a0 = 0x1000fa08;
+a1 = zero;
+a0 = a0;
+f_postcerror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 v0 = zero;
+goto L40e694;
+L40e690:
+// bdead 1 v0 = 0x1;
+L40e694:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static void f_st_feinit(uint8_t *mem, uint32_t sp) {
+L40e6a4:
+//st_feinit:
+//nop;
+return;
+}
+
+static uint32_t f_hex_to_num(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40e6f0:
+//hex_to_num:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = MEM_U8(sp + 35);
+v0 = wrapper_tolower(a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t6 = MEM_U8(sp + 35);
+a0 = v0;
+t7 = 0xfb4cba0;
+// bdead 18021 ra = MEM_U32(sp + 28);
+v1 = 0x57;
+t8 = t6 + t7;
+t9 = MEM_U8(t8 + 1);
+t0 = t9 & 0x4;
+//nop;
+if (t0 == 0) goto L40e74c;
+v1 = 0x30;
+goto L40e74c;
+L40e74c:
+v0 = a0 - v1;
+// bdead 9 sp = sp + 0x20;
+return v0;
+}
+
+static void f_make_local_label(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L40e758:
+//make_local_label:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 52) = a1;
+v0 = wrapper_strlen(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+a1 = MEM_U32(sp + 48);
+//nop;
+s0 = 0x100146c0;
+a0 = s0;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40e7c0;
+//nop;
+a0 = s0;
+a1 = MEM_U32(sp + 48);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+L40e7c0:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_atol(mem, a0);
+t6 = MEM_U32(sp + 36);
+at = v0 < 0x100;
+// bdead 4002810f gp = MEM_U32(sp + 24);
+t7 = s0 + t6;
+t8 = MEM_U8(t7 + -1);
+a2 = v0;
+MEM_U8(sp + 35) = (uint8_t)t8;
+if (at != 0) goto L40e810;
+//nop;
+a0 = 0x1000fac0;
+a1 = s0;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40020103 gp = MEM_U32(sp + 24);
+a2 = zero;
+L40e810:
+//nop;
+a0 = a2;
+a1 = s0;
+MEM_U32(sp + 44) = a2;
+f_ltoa(mem, sp, a0, a1);
+v0 = MEM_U8(sp + 35);
+at = 0x62;
+// bdead 4002000f gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+if (v0 != at) goto L40e850;
+t1 = 0x10014f50;
+t9 = a2 << 2;
+t2 = t9 + t1;
+a3 = MEM_U32(t2 + 0);
+a3 = a3 + 0xffffffff;
+goto L40e8c4;
+L40e850:
+at = 0x66;
+//nop;
+if (v0 != at) goto L40e870;
+t4 = 0x10014f50;
+t3 = a2 << 2;
+t5 = t3 + t4;
+a3 = MEM_U32(t5 + 0);
+goto L40e8c4;
+L40e870:
+t7 = 0x10014f50;
+t6 = a2 << 2;
+at = 0x7fff0000;
+v1 = t6 + t7;
+v0 = MEM_U32(v1 + 0);
+at = at | 0xffff;
+a1 = s0;
+a3 = v0;
+if ((int)v0 < (int)at) goto L40e8bc;
+//nop;
+a0 = 0x1000faf4;
+a2 = 0x1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 40);
+goto L40e8c4;
+L40e8bc:
+t8 = v0 + 0x1;
+MEM_U32(v1 + 0) = t8;
+L40e8c4:
+//nop;
+a0 = s0;
+MEM_U32(sp + 40) = a3;
+//nop;
+v0 = wrapper_strlen(mem, a0);
+a3 = MEM_U32(sp + 40);
+t9 = 0x24;
+t1 = s0 + v0;
+MEM_U8(t1 + 0) = (uint8_t)t9;
+t2 = MEM_U32(sp + 52);
+v1 = v0 + 0xb;
+// bdead 4002091b gp = MEM_U32(sp + 24);
+t3 = s0 + v1;
+MEM_U32(t2 + 0) = v1;
+v1 = 0xa;
+lo = a3 / v1; hi = a3 % v1;
+t4 = hi;
+a3 = lo;
+a1 = s0 + v0;
+a1 = a1 + 0x1;
+lo = a3 / v1; hi = a3 % v1;
+MEM_U8(t3 + 0) = (uint8_t)zero;
+t6 = hi;
+t0 = a1 + 0x9;
+a2 = 0x8;
+a3 = lo;
+a0 = a1 + a2;
+t7 = t6 + 0x30;
+t5 = t4 + 0x30;
+MEM_U8(t0 + 0) = (uint8_t)t5;
+MEM_U8(t0 + -1) = (uint8_t)t7;
+a0 = a0 + 0xffffffff;
+//nop;
+if (v1 != 0) goto L40e950;
+abort();
+L40e950:
+//nop;
+if (v1 != 0) goto L40e95c;
+abort();
+L40e95c:
+lo = a3 / v1; hi = a3 % v1;
+t8 = hi;
+a3 = lo;
+a2 = a2 + 0xfffffffc;
+t9 = t8 + 0x30;
+lo = a3 / v1; hi = a3 % v1;
+t1 = hi;
+a3 = lo;
+t2 = t1 + 0x30;
+//nop;
+if (v1 != 0) goto L40e98c;
+abort();
+L40e98c:
+lo = a3 / v1; hi = a3 % v1;
+t3 = hi;
+a3 = lo;
+t4 = t3 + 0x30;
+MEM_U8(a0 + -2) = (uint8_t)t4;
+lo = a3 / v1; hi = a3 % v1;
+t5 = hi;
+t6 = t5 + 0x30;
+a3 = lo;
+MEM_U8(a0 + -3) = (uint8_t)t6;
+MEM_U8(a0 + -1) = (uint8_t)t2;
+a0 = a0 + 0xfffffffc;
+MEM_U8(a0 + 4) = (uint8_t)t9;
+//nop;
+if (v1 != 0) goto L40e9cc;
+abort();
+L40e9cc:
+//nop;
+if (v1 != 0) goto L40e9d8;
+abort();
+L40e9d8:
+//nop;
+if (v1 != 0) goto L40e9e4;
+abort();
+L40e9e4:
+//nop;
+if (a2 != 0) goto L40e95c;
+//nop;
+a0 = s0;
+a1 = MEM_U32(sp + 48);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L40ea20;
+//nop;
+a0 = MEM_U32(sp + 48);
+a1 = s0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+L40ea20:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void f_unscan(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40ea34:
+//unscan:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffe0;
+//nop;
+MEM_U32(sp + 32) = a0;
+at = 0x10013ea8;
+a0 = 0x10013ea8;
+t6 = MEM_U8(t6 + 0);
+// fdead 4000802f MEM_U32(sp + 28) = ra;
+// fdead 4000802f MEM_U32(sp + 24) = gp;
+a1 = 0x100142b8;
+a0 = a0 + 0x1;
+MEM_U8(at + 0) = (uint8_t)t6;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+t8 = MEM_U8(sp + 35);
+t7 = 0x100146b8;
+at = 0x10013ea8;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(at + 1028) = t7;
+at = 0x100142b0;
+// bdead 2000005 sp = sp + 0x20;
+MEM_U8(at + 0) = (uint8_t)t8;
+return;
+}
+
+static void f_make_file(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L40eaa0:
+//make_file:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a48;
+t8 = 0x10013270;
+sp = sp + 0xffffffe0;
+t6 = MEM_U32(t6 + 0);
+// fdead 4200806b MEM_U32(sp + 28) = ra;
+// fdead 4200806b MEM_U32(sp + 24) = gp;
+t7 = t6 << 2;
+t9 = t7 + t8;
+a3 = MEM_U32(t9 + 0);
+//nop;
+a1 = 0x3;
+a2 = 0x1;
+//nop;
+v0 = f_st_filebegin(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 ra = MEM_U32(sp + 28);
+at = 0x10013ea0;
+// bdead d sp = sp + 0x20;
+MEM_U32(at + 0) = v0;
+return;
+}
+
+static uint32_t func_40eafc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L40eafc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+// fdead 400000eb MEM_U32(sp + 52) = ra;
+// fdead 400000eb MEM_U32(sp + 48) = gp;
+// fdead 400000eb MEM_U32(sp + 44) = s5;
+// fdead 400000eb MEM_U32(sp + 40) = s4;
+// fdead 400000eb MEM_U32(sp + 36) = s3;
+// fdead 400000eb MEM_U32(sp + 32) = s2;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 60) = a1;
+t6 = MEM_U8(a0 + 0);
+at = 0x30;
+a3 = a0;
+s2 = zero;
+if (t6 != at) goto L40eb74;
+v0 = MEM_U8(a0 + 1);
+at = 0x78;
+s5 = 0x10;
+//nop;
+if (v0 == at) goto L40eb64;
+at = 0x58;
+s4 = 0x1;
+if (v0 != at) goto L40eb6c;
+L40eb64:
+s4 = 0x2;
+goto L40eb7c;
+L40eb6c:
+s5 = 0x8;
+goto L40eb7c;
+L40eb74:
+s5 = 0xa;
+s4 = zero;
+L40eb7c:
+s0 = a3 + s4;
+a0 = MEM_U8(s0 + 0);
+t7 = 0x7fff0000;
+t7 = t7 | 0xffff;
+s3 = 0xffffffff;
+if (a0 == 0) goto L40ec20;
+lo = t7 / s5; hi = t7 % s5;
+s1 = lo;
+s1 = s1 << 1;
+s1 = s1 + 0x1;
+//nop;
+if (s5 != 0) goto L40ebb0;
+abort();
+L40ebb0:
+MEM_U32(sp + 56) = a3;
+L40ebb4:
+//nop;
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+// bdead 407e010b gp = MEM_U32(sp + 48);
+if (s1 < s2) goto L40ebe4;
+lo = s2 * s5; hi = (uint32_t)((uint64_t)s2 * (uint64_t)s5 >> 32);
+v1 = lo;
+t8 = s3 - v1;
+if (t8 >= v0) {
+a0 = MEM_U8(s0 + 1);
+goto L40ec0c;}
+L40ebe4:
+//nop;
+a0 = 0x1000fb0c;
+a1 = MEM_U32(sp + 56);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 200001 gp = MEM_U32(sp + 48);
+v0 = s4;
+goto L40ec7c;
+// fdead 0 a0 = MEM_U8(s0 + 1);
+L40ec0c:
+s2 = v1 + v0;
+s4 = s4 + 0x1;
+s0 = s0 + 0x1;
+if (a0 != 0) goto L40ebb4;
+a3 = MEM_U32(sp + 56);
+L40ec20:
+at = 0xa;
+s0 = 0x80000000;
+if (s5 != at) goto L40ec58;
+t9 = s2 & s0;
+if (t9 == zero) {
+t0 = MEM_U32(sp + 60);
+goto L40ec5c;}
+a1 = a3;
+if (s2 == s0) goto L40ec58;
+//nop;
+a0 = 0x1000fb18;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40080003 gp = MEM_U32(sp + 48);
+L40ec58:
+t0 = MEM_U32(sp + 60);
+L40ec5c:
+s0 = 0x80000000;
+s4 = s2;
+if (t0 == zero) {
+v0 = s4;
+goto L40ec7c;}
+if (s2 == s0) {
+v0 = s4;
+goto L40ec7c;}
+s4 = -s2;
+v0 = s4;
+L40ec7c:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint64_t func_40eca0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, t8 = 0;
+uint64_t temp64;
+L40eca0:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+at = 0xfb4ec80;
+sp = sp + 0xffffffd8;
+t6 = MEM_U8(t6 + 0);
+MEM_U32(at + 0) = zero;
+at = 0x68;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+if (t6 != at) goto L40ecfc;
+//nop;
+a1 = zero;
+a2 = 0x10;
+//nop;
+temp64 = wrapper_strtoull(mem, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+MEM_U32(sp + 36) = v1;
+goto L40ed1c;
+L40ecfc:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = zero;
+a2 = zero;
+temp64 = wrapper_strtoll(mem, a0, a1, a2);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+MEM_U32(sp + 36) = v1;
+L40ed1c:
+t7 = 0xfb4ec80;
+at = 0x22;
+a1 = MEM_U32(sp + 40);
+t7 = MEM_U32(t7 + 0);
+if (t7 != at) {
+t8 = MEM_U32(sp + 44);
+goto L40ed50;}
+//nop;
+a0 = 0x1000fb34;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t8 = MEM_U32(sp + 44);
+L40ed50:
+t1 = MEM_U32(sp + 36);
+t0 = MEM_U32(sp + 32);
+at = t1 < 0x1;
+if (t8 == 0) goto L40ed74;
+t2 = ~t0;
+t2 = t2 + at;
+t3 = -t1;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 32) = t2;
+L40ed74:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(sp + 32);
+v1 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x28;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_hash(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L40ed88:
+//hash:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 400201eb MEM_U32(sp + 24) = gp;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+a3 = v0;
+if ((int)v0 > 0) goto L40ede4;
+//nop;
+a0 = 0x1000fb48;
+a1 = 0x1000fb50;
+a2 = 0xe5;
+MEM_U32(sp + 32) = v0;
+a0 = a0;
+a1 = a1;
+f_assertion_failed(mem, sp, a0, a1, a2, a3);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 32);
+L40ede4:
+v0 = a3 + 0xffffffff;
+t6 = s0 + a3;
+if ((int)v0 < (int)0x2) goto L40edfc;
+t0 = v0;
+goto L40ee00;
+L40edfc:
+t0 = 0x1;
+L40ee00:
+v0 = a3 + 0xfffffffe;
+// bdead 28309 ra = MEM_U32(sp + 28);
+if ((int)v0 < (int)0x2) goto L40ee18;
+a1 = v0;
+goto L40ee1c;
+L40ee18:
+a1 = 0x1;
+L40ee1c:
+a2 = a3;
+if ((int)a3 < (int)0x4) goto L40ee30;
+a2 = 0x3;
+goto L40ee30;
+L40ee30:
+a0 = a3;
+if ((int)a3 < (int)0x3) goto L40ee44;
+a0 = 0x2;
+goto L40ee44;
+L40ee44:
+t7 = MEM_U8(t6 + 0);
+t9 = MEM_U8(s0 + 1);
+t3 = s0 + a0;
+t8 = t7 << 2;
+t8 = t8 + t7;
+t1 = t9 << 2;
+t8 = t8 << 2;
+t1 = t1 - t9;
+t1 = t1 << 2;
+t8 = t8 - t7;
+t7 = s0 + a2;
+t1 = t1 + t9;
+t9 = MEM_U8(t7 + 0);
+t4 = MEM_U8(t3 + 0);
+t2 = t8 + t1;
+t8 = t9 << 2;
+t8 = t8 - t9;
+t5 = t4 << 4;
+t8 = t8 << 2;
+t3 = s0 + a1;
+t5 = t5 + t4;
+t4 = MEM_U8(t3 + 0);
+t7 = s0 + t0;
+t8 = t8 - t9;
+t9 = MEM_U8(t7 + 0);
+t6 = t2 + t5;
+t1 = t6 + t8;
+t2 = t4 << 2;
+t2 = t2 - t4;
+t6 = t9 << 3;
+t5 = t1 + t2;
+t6 = t6 - t9;
+v1 = t5 + t6;
+v0 = v1 & 0x7f;
+if ((int)v1 >= 0) goto L40eedc;
+//nop;
+if (v0 == 0) goto L40eedc;
+v0 = v0 + 0xffffff80;
+L40eedc:
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_LookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40eee8:
+//LookUp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(a1 + 0) = zero;
+//nop;
+s1 = a0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t7 = v0 << 2;
+t8 = 0x10014b48;
+t9 = t7 + t8;
+s0 = MEM_U32(t9 + 0);
+if (s0 == zero) {
+v0 = zero;
+goto L40ef78;}
+L40ef3c:
+//nop;
+a0 = s1;
+a1 = MEM_U32(s0 + 4);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L40ef68;
+t0 = MEM_U32(sp + 44);
+v0 = 0x1;
+MEM_U32(t0 + 0) = s0;
+goto L40ef78;
+L40ef68:
+s0 = MEM_U32(s0 + 0);
+//nop;
+if (s0 != 0) goto L40ef3c;
+v0 = zero;
+L40ef78:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_opLookUp(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t0 = 0, t7 = 0, s0 = 0, s1 = 0, t8 = 0, t9 = 0;
+L40ef8c:
+//opLookUp:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(a1 + 0) = zero;
+//nop;
+s1 = a0;
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4004000b gp = MEM_U32(sp + 32);
+t7 = v0 << 2;
+t8 = 0x10014d50;
+t9 = t7 + t8;
+s0 = MEM_U32(t9 + 0);
+if (s0 == zero) {
+v0 = zero;
+goto L40f01c;}
+L40efe0:
+//nop;
+a0 = s1;
+a1 = MEM_U32(s0 + 4);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 40060003 gp = MEM_U32(sp + 32);
+if (v0 != 0) goto L40f00c;
+t0 = MEM_U32(sp + 44);
+v0 = 0x1;
+MEM_U32(t0 + 0) = s0;
+goto L40f01c;
+L40f00c:
+s0 = MEM_U32(s0 + 0);
+//nop;
+if (s0 != 0) goto L40efe0;
+v0 = zero;
+L40f01c:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void func_40f030(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L40f030:
+//nop;
+//nop;
+//nop;
+v0 = 0x10013a7c;
+t6 = 0x10013a78;
+sp = sp + 0xffffffe0;
+v0 = MEM_U32(v0 + 0);
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+if ((int)t6 < (int)v0) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40f0b4;}
+t7 = 0x10013a80;
+t9 = 0xfb4cba0;
+at = 0x39;
+t8 = v0 + t7;
+v1 = MEM_U8(t8 + 0);
+a1 = zero;
+t0 = v1 + t9;
+t1 = MEM_U8(t0 + 1);
+t2 = t1 & 0x3;
+//nop;
+if (t2 != 0) goto L40f098;
+if (v1 != at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40f0b4;}
+L40f098:
+//nop;
+a0 = 0x1000fb5c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+L40f0b4:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_consume(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40f0c0:
+//consume:
+//nop;
+//nop;
+//nop;
+v1 = 0x100146b8;
+v0 = MEM_U32(v1 + 0);
+//nop;
+if ((int)v0 >= (int)0x3ff) goto L40f100;
+a0 = 0x10013a7c;
+t7 = 0x10013a80;
+t0 = 0x100146c0;
+t6 = MEM_U32(a0 + 0);
+t1 = v0 + t0;
+t8 = t6 + t7;
+t9 = MEM_U8(t8 + 0);
+MEM_U8(t1 + 0) = (uint8_t)t9;
+L40f100:
+a0 = 0x10013a7c;
+t2 = v0 + 0x1;
+MEM_U32(v1 + 0) = t2;
+t3 = MEM_U32(a0 + 0);
+t4 = t3 + 0x1;
+MEM_U32(a0 + 0) = t4;
+return;
+}
+
+static uint32_t func_40f11c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0;
+L40f11c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+// fdead 400001eb MEM_U32(sp + 56) = fp;
+// fdead 400001eb MEM_U32(sp + 48) = s7;
+s7 = 0x10013a7c;
+fp = 0x10013a78;
+// fdead c10001eb MEM_U32(sp + 44) = s6;
+v1 = MEM_U32(s7 + 0);
+t6 = MEM_U32(fp + 0);
+// fdead c10081fb MEM_U32(sp + 28) = s2;
+s6 = a0;
+at = (int)t6 < (int)v1;
+// fdead c18081ff MEM_U32(sp + 60) = ra;
+// fdead c18081ff MEM_U32(sp + 52) = gp;
+// fdead c18081ff MEM_U32(sp + 40) = s5;
+// fdead c18081ff MEM_U32(sp + 36) = s4;
+// fdead c18081ff MEM_U32(sp + 32) = s3;
+// fdead c18081ff MEM_U32(sp + 24) = s1;
+// fdead c18081ff MEM_U32(sp + 20) = s0;
+s2 = 0x1;
+MEM_U32(sp + 64) = v1;
+if (at != 0) goto L40f240;
+s5 = 0x1000fb7c;
+s4 = 0xa;
+s3 = 0xfb4cba0;
+s1 = 0x10013a80;
+s5 = s5;
+t7 = s1 + v1;
+L40f194:
+s0 = MEM_U8(t7 + 0);
+t8 = s3 + s0;
+v0 = MEM_U8(t8 + 1);
+t9 = v0 & 0x4;
+t0 = v0 & 0x80;
+if (t9 == 0) goto L40f1c4;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead c1fc0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s7 + 0);
+goto L40f228;
+L40f1c4:
+if (t0 == zero) {
+s2 = zero;
+goto L40f228;}
+//nop;
+if (s6 != s4) goto L40f1ec;
+//nop;
+a0 = s5;
+a1 = zero;
+a2 = 0x1;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0003 gp = MEM_U32(sp + 52);
+L40f1ec:
+//nop;
+a0 = s0;
+//nop;
+v0 = wrapper_tolower(a0);
+t1 = MEM_U32(s7 + 0);
+// bdead c1fc040b gp = MEM_U32(sp + 52);
+t2 = s1 + t1;
+MEM_U8(t2 + 0) = (uint8_t)v0;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead c1fc0103 gp = MEM_U32(sp + 52);
+v1 = MEM_U32(s7 + 0);
+goto L40f228;
+// fdead 0 s2 = zero;
+L40f228:
+if (s2 == zero) {
+// bdead 40000011 ra = MEM_U32(sp + 60);
+goto L40f244;}
+t3 = MEM_U32(fp + 0);
+if ((int)t3 >= (int)v1) {
+t7 = s1 + v1;
+goto L40f194;}
+L40f240:
+// bdead 40000011 ra = MEM_U32(sp + 60);
+L40f244:
+t4 = MEM_U32(sp + 64);
+// bdead 2011 s0 = MEM_U32(sp + 20);
+// bdead 2011 s1 = MEM_U32(sp + 24);
+// bdead 2011 s2 = MEM_U32(sp + 28);
+// bdead 2011 s3 = MEM_U32(sp + 32);
+// bdead 2011 s4 = MEM_U32(sp + 36);
+// bdead 2011 s5 = MEM_U32(sp + 40);
+// bdead 2011 s6 = MEM_U32(sp + 44);
+// bdead 2011 s7 = MEM_U32(sp + 48);
+// bdead 2011 fp = MEM_U32(sp + 56);
+// bdead 2011 sp = sp + 0x48;
+v0 = (int)t4 < (int)v1;
+return v0;
+}
+
+static void func_40f278(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40f278:
+//nop;
+//nop;
+//nop;
+at = 0x100142b0;
+t6 = 0x68;
+t7 = 0x78;
+MEM_U8(at + 0) = (uint8_t)t6;
+at = 0x100146c0;
+v0 = 0x10013a7c;
+t8 = 0x2;
+MEM_U8(at + 1) = (uint8_t)t7;
+at = 0x100146b8;
+sp = sp + 0xffffffd0;
+// fdead 420181ef MEM_U32(sp + 28) = ra;
+MEM_U32(at + 0) = t8;
+t9 = MEM_U32(v0 + 0);
+// fdead 460181ef MEM_U32(sp + 24) = gp;
+a0 = 0x10;
+t0 = t9 + 0x1;
+//nop;
+MEM_U32(v0 + 0) = t0;
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_40f11c(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = v0;
+v1 = 0x10013a7c;
+t1 = 0x10013a78;
+v1 = MEM_U32(v1 + 0);
+t1 = MEM_U32(t1 + 0);
+//nop;
+if ((int)t1 < (int)v1) goto L40f350;
+t2 = 0x10013a80;
+at = 0x2e;
+t5 = 0x66;
+t3 = v1 + t2;
+t4 = MEM_U8(t3 + 0);
+//nop;
+if (t4 != at) goto L40f350;
+//nop;
+at = 0x100142b0;
+MEM_U32(sp + 44) = v0;
+MEM_U8(at + 0) = (uint8_t)t5;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a0 = 0x10;
+//nop;
+// fdead 6000003f t9 = t9;
+//nop;
+v0 = func_40f11c(mem, sp, a0, a1, a2, a3);
+a1 = MEM_U32(sp + 44);
+// bdead 4000014b gp = MEM_U32(sp + 24);
+a1 = a1 | v0;
+L40f350:
+//nop;
+if (a1 == 0) goto L40f4d4;
+v1 = 0x10013a7c;
+t6 = 0x10013a78;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(t6 + 0);
+//nop;
+if ((int)t6 < (int)v1) goto L40f4d4;
+t7 = 0x10013a80;
+//nop;
+t8 = v1 + t7;
+a0 = MEM_U8(t8 + 0);
+MEM_U32(sp + 44) = a1;
+v0 = wrapper_tolower(a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t1 = v0 & 0xff;
+at = 0x68;
+t9 = 0x10013a7c;
+t0 = 0x10013a80;
+a1 = MEM_U32(sp + 44);
+t9 = MEM_U32(t9 + 0);
+v1 = t9 + t0;
+MEM_U8(v1 + 0) = (uint8_t)v0;
+if (t1 != at) goto L40f4d4;
+//nop;
+at = 0x100142b0;
+t2 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t2;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+t3 = 0xa;
+v0 = 0x10013a78;
+v1 = 0x10013a7c;
+v0 = MEM_U32(v0 + 0);
+v1 = MEM_U32(v1 + 0);
+if ((int)v0 >= (int)v1) {
+at = (int)v1 < (int)v0;
+goto L40f3f8;}
+a1 = zero;
+goto L40f4d4;
+// fdead 0 at = (int)v1 < (int)v0;
+L40f3f8:
+MEM_U32(sp + 36) = t3;
+if (at == 0) goto L40f470;
+t4 = 0x10013a80;
+//nop;
+t5 = v1 + t4;
+a0 = MEM_U8(t5 + 1);
+v0 = wrapper_tolower(a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x30;
+t9 = v0 & 0xff;
+t6 = 0x10013a7c;
+t7 = 0x10013a80;
+t6 = MEM_U32(t6 + 0);
+v1 = t6 + t7;
+t8 = MEM_U8(v1 + 0);
+MEM_U8(v1 + 1) = (uint8_t)v0;
+if (t8 != at) {
+at = 0x78;
+goto L40f470;}
+at = 0x78;
+if (t9 != at) {
+t1 = MEM_U32(sp + 36);
+goto L40f474;}
+//nop;
+t0 = 0x10;
+MEM_U32(sp + 36) = t0;
+//nop;
+f_consume(mem, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40f470:
+t1 = MEM_U32(sp + 36);
+L40f474:
+at = 0xa;
+//nop;
+if (t1 != at) goto L40f4b8;
+t2 = 0x10013a7c;
+t3 = 0x10013a80;
+at = 0x2b;
+t2 = MEM_U32(t2 + 0);
+t4 = t2 + t3;
+v0 = MEM_U8(t4 + 0);
+if (v0 == at) {
+at = 0x2d;
+goto L40f4a8;}
+at = 0x2d;
+//nop;
+if (v0 != at) goto L40f4b8;
+L40f4a8:
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40f4b8:
+//nop;
+a0 = MEM_U32(sp + 36);
+// bdead 40000123 t9 = t9;
+//nop;
+v0 = func_40f11c(mem, sp, a0, a1, a2, a3);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+a1 = v0;
+L40f4d4:
+a2 = 0x1;
+if (a1 != 0) goto L40f4f8;
+//nop;
+a0 = 0x1000fb9c;
+a1 = zero;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L40f50c;
+L40f4f8:
+//nop;
+// bdead 40000103 t9 = t9;
+//nop;
+func_40f030(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L40f50c:
+t5 = 0x100142b0;
+at = 0x66;
+t5 = MEM_U8(t5 + 0);
+if (t5 != at) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40f560;}
+t6 = 0x100146b8;
+a1 = zero;
+t6 = MEM_U32(t6 + 0);
+if ((int)t6 < (int)0x400) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L40f560;}
+//nop;
+a0 = 0x1000fbc0;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+t7 = 0x3ff;
+at = 0x100146b8;
+MEM_U32(at + 0) = t7;
+// bdead 1 ra = MEM_U32(sp + 28);
+L40f560:
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static void func_40f56c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0,
+s2 = 0, t8 = 0, t9 = 0;
+L40f56c:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+at = 0x100142b0;
+// fdead 400001ef MEM_U32(sp + 24) = s1;
+// fdead 400001ef MEM_U32(sp + 20) = s0;
+s0 = 0x10013a7c;
+s1 = 0x10013a78;
+t6 = 0x64;
+MEM_U8(at + 0) = (uint8_t)t6;
+v0 = MEM_U32(s0 + 0);
+t7 = MEM_U32(s1 + 0);
+// fdead 400781ef MEM_U32(sp + 36) = ra;
+// fdead 400781ef MEM_U32(sp + 32) = gp;
+// fdead 400781ef MEM_U32(sp + 28) = s2;
+if ((int)v0 >= (int)t7) goto L40f614;
+s2 = 0x10013a80;
+t8 = s2 + v0;
+v1 = MEM_U8(t8 + 0);
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x39;
+goto L40f614;}
+//nop;
+if ((int)v1 >= (int)0x39) goto L40f614;
+L40f5d4:
+//nop;
+//nop;
+f_consume(mem, sp);
+v0 = MEM_U32(s0 + 0);
+t9 = MEM_U32(s1 + 0);
+// bdead 440e0109 gp = MEM_U32(sp + 32);
+t0 = s2 + v0;
+//nop;
+if ((int)v0 >= (int)t9) goto L40f614;
+v1 = MEM_U8(t0 + 0);
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x39;
+goto L40f614;}
+//nop;
+if ((int)v1 < (int)0x39) goto L40f5d4;
+L40f614:
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_40f030(mem, sp, a0, a1, a2, a3);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40f640(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+L40f640:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+s0 = 0x10013a7c;
+s1 = 0x10013a78;
+// fdead 400601eb MEM_U32(sp + 36) = ra;
+v0 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s1 + 0);
+// fdead 400681eb MEM_U32(sp + 32) = gp;
+// fdead 400681eb MEM_U32(sp + 28) = s2;
+if ((int)v0 >= (int)t6) {
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40f6e4;}
+s2 = 0x10013a80;
+t7 = s2 + v0;
+v1 = MEM_U8(t7 + 0);
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x3a;
+goto L40f6e0;}
+if ((int)v1 >= (int)0x3a) {
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40f6e4;}
+L40f6a0:
+//nop;
+//nop;
+f_consume(mem, sp);
+v0 = MEM_U32(s0 + 0);
+t8 = MEM_U32(s1 + 0);
+// bdead 20e000b gp = MEM_U32(sp + 32);
+if ((int)v0 >= (int)t8) {
+// bdead 1 ra = MEM_U32(sp + 36);
+goto L40f6e4;}
+t9 = s2 + v0;
+v1 = MEM_U8(t9 + 0);
+if ((int)v1 < (int)0x30) {
+at = (int)v1 < (int)0x3a;
+goto L40f6e0;}
+//nop;
+if ((int)v1 < (int)0x3a) goto L40f6a0;
+L40f6e0:
+// bdead 1 ra = MEM_U32(sp + 36);
+L40f6e4:
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x28;
+return;
+}
+
+static void func_40f6f8(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L40f6f8:
+//nop;
+//nop;
+//nop;
+v1 = 0x100146b8;
+sp = sp + 0xffffffe0;
+// fdead 400001fb MEM_U32(sp + 28) = ra;
+v0 = MEM_U32(v1 + 0);
+// fdead 400001fb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t6 = 0x3ff;
+if ((int)v0 < (int)0x400) goto L40f750;
+MEM_U32(v1 + 0) = t6;
+//nop;
+a0 = 0x1000fbe4;
+a1 = MEM_U32(sp + 32);
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v0 = 0x100146b8;
+v0 = MEM_U32(v0 + 0);
+L40f750:
+t7 = MEM_U32(sp + 32);
+t8 = t7 + v0;
+MEM_U8(t8 + 0) = (uint8_t)zero;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_dot_soon(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L40f76c:
+//dot_soon:
+//nop;
+//nop;
+//nop;
+v0 = 0x10013a78;
+t1 = 0x45;
+t0 = 0x65;
+v0 = MEM_U32(v0 + 0);
+if ((int)a0 >= (int)v0) {
+v0 = zero;
+goto L40f7f4;}
+t6 = 0x10013a80;
+t2 = 0xfb4cba0;
+a3 = 0x2e;
+a1 = a0 + t6;
+L40f7a4:
+v1 = MEM_U8(a1 + 0);
+a0 = a0 + 0x1;
+at = (int)a0 < (int)v0;
+t7 = t2 + v1;
+if (a3 == v1) goto L40f7c8;
+//nop;
+if (t0 == v1) goto L40f7c8;
+if (t1 != v1) {
+t8 = MEM_U8(t7 + 1);
+goto L40f7d4;}
+L40f7c8:
+v0 = 0x1;
+return v0;
+// fdead 0 t8 = MEM_U8(t7 + 1);
+L40f7d4:
+t9 = t8 & 0x4;
+//nop;
+if (t9 != 0) goto L40f7e8;
+v0 = zero;
+return v0;
+L40f7e8:
+a1 = a1 + 0x1;
+if (at != 0) goto L40f7a4;
+v0 = zero;
+L40f7f4:
+//nop;
+return v0;
+}
+
+static void f_nexttoken(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0,
+s5 = 0, t8 = 0, t9 = 0;
+L40f7fc:
+//nexttoken:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff98;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+s0 = 0x10013ea8;
+// fdead 400201eb MEM_U32(sp + 52) = ra;
+// fdead 400201eb MEM_U32(sp + 48) = gp;
+v0 = MEM_U8(s0 + 0);
+// fdead 400201eb MEM_U32(sp + 44) = s5;
+// fdead 400201eb MEM_U32(sp + 40) = s4;
+// fdead 400201eb MEM_U32(sp + 36) = s3;
+// fdead 400201eb MEM_U32(sp + 32) = s2;
+// fdead 400201eb MEM_U32(sp + 28) = s1;
+MEM_U32(sp + 76) = zero;
+if (v0 == 0) goto L40f874;
+at = 0x100142b0;
+a1 = 0x10013ea8;
+a0 = 0x100142b8;
+MEM_U8(at + 0) = (uint8_t)v0;
+MEM_U8(s0 + 0) = (uint8_t)zero;
+//nop;
+a1 = a1 + 0x1;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 48);
+t6 = MEM_U32(s0 + 1028);
+at = 0x100146b8;
+MEM_U32(at + 0) = t6;
+goto L410200;
+L40f874:
+s2 = 0x10013a7c;
+s5 = 0x10013a78;
+t0 = 0x100146b8;
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+MEM_U32(t0 + 0) = zero;
+if ((int)a0 >= (int)a2) {
+at = (int)a0 < (int)a2;
+goto L40f8d8;}
+s3 = 0x10013a80;
+v0 = 0x20;
+t7 = s3 + a0;
+t8 = MEM_U8(t7 + 0);
+if (v0 != t8) {
+at = (int)a0 < (int)a2;
+goto L40f8d8;}
+t9 = a0 + 0x1;
+L40f8b4:
+at = (int)t9 < (int)a2;
+a0 = t9;
+MEM_U32(s2 + 0) = t9;
+if (at == 0) goto L40f8d4;
+t1 = s3 + a0;
+t2 = MEM_U8(t1 + 0);
+if (v0 == t2) {
+t9 = a0 + 0x1;
+goto L40f8b4;}
+L40f8d4:
+at = (int)a0 < (int)a2;
+L40f8d8:
+s3 = 0x10013a80;
+if (at != 0) goto L40f8f0;
+at = 0x100142b0;
+t3 = 0x23;
+MEM_U8(at + 0) = (uint8_t)t3;
+goto L41016c;
+L40f8f0:
+t4 = s3 + a0;
+a1 = MEM_U8(t4 + 0);
+at = 0x100146c0;
+t5 = 0x1;
+MEM_U32(t0 + 0) = t5;
+MEM_U8(at + 0) = (uint8_t)a1;
+t6 = a0 + 0x1;
+at = (int)a1 < (int)0x5f;
+MEM_U32(s2 + 0) = t6;
+v1 = a1;
+if (at != 0) goto L40f938;
+at = 0x7c;
+if (v1 == at) {
+at = 0x7e;
+goto L40f980;}
+at = 0x7e;
+if (v1 == at) {
+v0 = 0x3c;
+goto L40f984;}
+at = (int)v1 < (int)0x31;
+goto L40f9d0;
+L40f938:
+t7 = v1 + 0xffffffde;
+if ((int)v1 < (int)0x3f) goto L40f958;
+at = 0x5e;
+if (v1 == at) {
+v0 = 0x3c;
+goto L40f984;}
+at = (int)v1 < (int)0x31;
+goto L40f9d0;
+L40f958:
+if (t7 >= 0x1d) {
+at = (int)v1 < (int)0x31;
+goto L40f9d0;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t7) {
+case 0: goto L40fe04;
+case 1: goto L40f9cc;
+case 2: goto L40f9cc;
+case 3: goto L40f980;
+case 4: goto L40f980;
+case 5: goto L40f9cc;
+case 6: goto L40f980;
+case 7: goto L40f980;
+case 8: goto L40f980;
+case 9: goto L40f980;
+case 10: goto L40f980;
+case 11: goto L40f980;
+case 12: goto L40f9cc;
+case 13: goto L40f980;
+case 14: goto L40f9cc;
+case 15: goto L40f9cc;
+case 16: goto L40f9cc;
+case 17: goto L40f9cc;
+case 18: goto L40f9cc;
+case 19: goto L40f9cc;
+case 20: goto L40f9cc;
+case 21: goto L40f9cc;
+case 22: goto L40f9cc;
+case 23: goto L40f9cc;
+case 24: goto L40f980;
+case 25: goto L40f980;
+case 26: goto L40f980;
+case 27: goto L40f980;
+case 28: goto L40f980;
+}
+L40f980:
+v0 = 0x3c;
+L40f984:
+if (v0 != v1) {
+v0 = 0x3e;
+goto L40f9a0;}
+a0 = MEM_U32(s2 + 0);
+t8 = s3 + a0;
+t9 = MEM_U8(t8 + 0);
+if (v0 == t9) {
+v0 = 0x3e;
+goto L40f9b8;}
+v0 = 0x3e;
+L40f9a0:
+//nop;
+if (v0 != v1) goto L40f9c0;
+a0 = MEM_U32(s2 + 0);
+t1 = s3 + a0;
+t2 = MEM_U8(t1 + 0);
+if (v0 != t2) {
+t3 = a0 + 0x1;
+goto L40f9c0;}
+L40f9b8:
+t3 = a0 + 0x1;
+MEM_U32(s2 + 0) = t3;
+L40f9c0:
+at = 0x100142b0;
+MEM_U8(at + 0) = (uint8_t)a1;
+goto L41016c;
+L40f9cc:
+at = (int)v1 < (int)0x31;
+L40f9d0:
+if (at != 0) {
+at = (int)v1 < (int)0x3a;
+goto L40f9e0;}
+if ((int)v1 < (int)0x3a) {
+v0 = 0x2e;
+goto L40fa48;}
+L40f9e0:
+a0 = MEM_U32(s2 + 0);
+v0 = 0x2e;
+if ((int)a0 >= (int)a2) {
+at = 0x30;
+goto L40fcc8;}
+t4 = s3 + a0;
+if (v0 != v1) goto L40fa14;
+s4 = 0xfb4cba0;
+t5 = MEM_U8(t4 + 0);
+t6 = t5 + s4;
+t7 = MEM_U8(t6 + 1);
+t8 = t7 & 0x4;
+if (t8 != 0) {
+at = 0x30;
+goto L40fa44;}
+L40fa14:
+at = 0x30;
+if (v1 != at) {
+at = 0x30;
+goto L40fcc8;}
+//nop;
+MEM_U32(sp + 60) = v1;
+MEM_U8(sp + 95) = (uint8_t)a1;
+//nop;
+v0 = f_dot_soon(mem, sp, a0);
+// bdead 4058010b gp = MEM_U32(sp + 48);
+v1 = MEM_U32(sp + 60);
+a1 = MEM_U8(sp + 95);
+if (v0 == 0) goto L40fcc4;
+L40fa44:
+v0 = 0x2e;
+L40fa48:
+s4 = 0xfb4cba0;
+if (v0 != v1) goto L40fa8c;
+at = 0x100142b0;
+t9 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t9;
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+//nop;
+// fdead 607a001f t9 = t9;
+//nop;
+func_40f640(mem, sp);
+// bdead 40780103 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+goto L40fbb4;
+L40fa8c:
+//nop;
+at = 0x100142b0;
+t1 = 0x64;
+// bdead 40780407 t9 = t9;
+MEM_U8(at + 0) = (uint8_t)t1;
+func_40f640(mem, sp);
+a2 = MEM_U32(s5 + 0);
+a0 = MEM_U32(s2 + 0);
+// bdead 407801a3 gp = MEM_U32(sp + 48);
+t2 = s3 + a0;
+if ((int)a2 >= (int)a0) goto L40fac4;
+//nop;
+goto L41016c;
+L40fac4:
+v0 = MEM_U8(t2 + 0);
+at = 0x62;
+if (v0 == at) {
+at = 0x66;
+goto L40fadc;}
+at = 0x66;
+if (v0 != at) {
+at = 0x2e;
+goto L40fb40;}
+L40fadc:
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+t3 = 0x69;
+//nop;
+at = 0x100142b0;
+a0 = 0x100146c0;
+// fdead 607a103f t9 = t9;
+MEM_U8(at + 0) = (uint8_t)t3;
+func_40f6f8(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 48);
+//nop;
+a0 = 0x100146c0;
+a1 = 0x100146b8;
+//nop;
+f_make_local_label(mem, sp, a0, a1);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+//nop;
+// fdead 607a000f t9 = t9;
+//nop;
+func_40f030(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+at = 0x2e;
+L40fb40:
+if (v0 == at) {
+at = 0x65;
+goto L40fb70;}
+at = 0x65;
+if (v0 == at) {
+at = 0x45;
+goto L40fb70;}
+at = 0x45;
+//nop;
+if (v0 == at) goto L40fb70;
+//nop;
+// fdead 607a08bf t9 = t9;
+//nop;
+func_40f030(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L40fb70:
+at = 0x100142b0;
+t4 = 0x66;
+MEM_U8(at + 0) = (uint8_t)t4;
+at = 0x2e;
+if (v0 != at) {
+at = (int)a0 < (int)a2;
+goto L40fbb8;}
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40780003 gp = MEM_U32(sp + 48);
+//nop;
+// fdead 607a001f t9 = t9;
+//nop;
+func_40f640(mem, sp);
+// bdead 40780103 gp = MEM_U32(sp + 48);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+L40fbb4:
+at = (int)a0 < (int)a2;
+L40fbb8:
+v1 = s3 + a0;
+if (at == 0) goto L40fcac;
+v0 = MEM_U8(v1 + 0);
+at = 0x65;
+t5 = 0x65;
+if (v0 == at) {
+at = 0x45;
+goto L40fbdc;}
+at = 0x45;
+//nop;
+if (v0 != at) goto L40fcac;
+L40fbdc:
+MEM_U8(v1 + 0) = (uint8_t)t5;
+//nop;
+//nop;
+f_consume(mem, sp);
+a0 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+// bdead 403001a3 gp = MEM_U32(sp + 48);
+t6 = s3 + a0;
+if ((int)a0 >= (int)a2) {
+at = (int)a0 < (int)a2;
+goto L40fc44;}
+v0 = MEM_U8(t6 + 0);
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L40fc20;}
+at = 0x2d;
+if (v0 != at) {
+at = (int)a0 < (int)a2;
+goto L40fc44;}
+L40fc20:
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 40300103 gp = MEM_U32(sp + 48);
+a0 = 0x10013a7c;
+a2 = 0x10013a78;
+a0 = MEM_U32(a0 + 0);
+a2 = MEM_U32(a2 + 0);
+at = (int)a0 < (int)a2;
+L40fc44:
+t7 = s3 + a0;
+if (at == 0) goto L40fc64;
+t8 = MEM_U8(t7 + 0);
+t9 = t8 + s4;
+t1 = MEM_U8(t9 + 1);
+t2 = t1 & 0x4;
+//nop;
+if (t2 != 0) goto L40fc98;
+L40fc64:
+//nop;
+a0 = 0x1000fbf8;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+t3 = 0x100146b8;
+at = 0x100146b8;
+t3 = MEM_U32(t3 + 0);
+t4 = t3 + 0xffffffff;
+MEM_U32(at + 0) = t4;
+goto L41016c;
+L40fc98:
+//nop;
+// bdead 40000001 t9 = t9;
+//nop;
+func_40f640(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+L40fcac:
+//nop;
+// fdead 607a68bf t9 = t9;
+//nop;
+func_40f030(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L40fcc4:
+at = 0x30;
+L40fcc8:
+v0 = 0x2e;
+s4 = 0xfb4cba0;
+if (v1 != at) goto L40fd3c;
+a0 = MEM_U32(s2 + 0);
+t6 = MEM_U32(s5 + 0);
+t5 = 0x1;
+MEM_U32(sp + 76) = t5;
+t7 = s3 + a0;
+if ((int)a0 >= (int)t6) goto L40fd20;
+v0 = MEM_U8(t7 + 0);
+at = 0x78;
+if (v0 == at) {
+at = 0x58;
+goto L40fd08;}
+at = 0x58;
+//nop;
+if (v0 != at) goto L40fd20;
+L40fd08:
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_40f278(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L40fd34;
+L40fd20:
+//nop;
+// bdead 40000101 t9 = t9;
+//nop;
+func_40f56c(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+L40fd34:
+//nop;
+goto L41016c;
+L40fd3c:
+t8 = s4 + a1;
+t9 = MEM_U8(t8 + 1);
+t1 = t9 & 0x3;
+//nop;
+if (t1 != 0) goto L40fd68;
+s0 = 0x5f;
+if (v0 == v1) goto L40fd68;
+s1 = 0x24;
+if (s0 == v1) goto L40fd68;
+//nop;
+if (s1 != v1) goto L40fdfc;
+L40fd68:
+at = 0x100142b0;
+t2 = 0x69;
+s0 = 0x5f;
+MEM_U8(at + 0) = (uint8_t)t2;
+t3 = MEM_U32(s5 + 0);
+a0 = MEM_U32(s2 + 0);
+s1 = 0x24;
+t4 = s3 + a0;
+if ((int)a0 >= (int)t3) goto L40fdf4;
+L40fd90:
+a1 = MEM_U8(t4 + 0);
+v0 = 0x2e;
+t5 = s4 + a1;
+t6 = MEM_U8(t5 + 1);
+t7 = t6 & 0x7;
+//nop;
+if (t7 != 0) goto L40fdc4;
+//nop;
+if (v0 == a1) goto L40fdc4;
+//nop;
+if (s0 == a1) goto L40fdc4;
+//nop;
+if (s1 != a1) goto L40fdd8;
+L40fdc4:
+//nop;
+//nop;
+f_consume(mem, sp);
+// bdead 407e0103 gp = MEM_U32(sp + 48);
+goto L40fde0;
+L40fdd8:
+//nop;
+goto L41016c;
+L40fde0:
+a0 = MEM_U32(s2 + 0);
+t8 = MEM_U32(s5 + 0);
+if ((int)a0 < (int)t8) {
+t4 = s3 + a0;
+goto L40fd90;}
+L40fdf4:
+//nop;
+goto L41016c;
+L40fdfc:
+//nop;
+goto L41016c;
+L40fe04:
+at = 0x100142b0;
+t9 = 0x22;
+a3 = 0x22;
+MEM_U8(at + 0) = (uint8_t)t9;
+a0 = MEM_U32(s2 + 0);
+MEM_U32(t0 + 0) = zero;
+if ((int)a0 >= (int)a2) {
+t1 = MEM_U32(t0 + 0);
+goto L410110;}
+s4 = 0xfb4cba0;
+L40fe2c:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+at = 0x5c;
+v1 = a1;
+if (a3 != a1) goto L40fe70;
+t3 = MEM_U32(t0 + 0);
+t2 = a0 + 0x1;
+MEM_U32(s2 + 0) = t2;
+a1 = zero;
+if (t3 != 0) goto L41016c;
+//nop;
+a0 = 0x1000fc24;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L40fe70:
+t4 = a0 + 0x1;
+if (v1 != at) goto L4100d8;
+at = (int)t4 < (int)a2;
+MEM_U32(s2 + 0) = t4;
+a0 = t4;
+if (at != 0) goto L40fea8;
+//nop;
+a0 = 0x1000fc38;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L40fea8:
+t5 = s3 + a0;
+a1 = MEM_U8(t5 + 0);
+v1 = a1;
+if ((int)a1 < (int)0x28) goto L40fee8;
+t6 = v1 + 0xffffffa4;
+if (t6 >= 0x1b) {
+at = (int)v1 < (int)0x30;
+goto L40ff3c;}
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L4100d8;
+case 1: goto L40ff38;
+case 2: goto L40ff38;
+case 3: goto L40ff38;
+case 4: goto L40ff38;
+case 5: goto L40ff00;
+case 6: goto L40ff08;
+case 7: goto L40ff38;
+case 8: goto L40ff38;
+case 9: goto L40ff38;
+case 10: goto L40ff10;
+case 11: goto L40ff38;
+case 12: goto L40ff38;
+case 13: goto L40ff38;
+case 14: goto L40ff38;
+case 15: goto L40ff38;
+case 16: goto L40ff38;
+case 17: goto L40ff38;
+case 18: goto L40ff18;
+case 19: goto L40ff38;
+case 20: goto L40ff38;
+case 21: goto L40ff38;
+case 22: goto L40ff20;
+case 23: goto L40ff38;
+case 24: goto L40ff28;
+case 25: goto L40ff38;
+case 26: goto L40ff30;
+}
+L40fee8:
+at = 0x27;
+if (v1 == a3) goto L4100d8;
+if (v1 == at) {
+v0 = MEM_U32(t0 + 0);
+goto L4100dc;}
+at = (int)v1 < (int)0x30;
+goto L40ff3c;
+L40ff00:
+a1 = 0x7;
+goto L4100d8;
+L40ff08:
+a1 = 0x8;
+goto L4100d8;
+L40ff10:
+a1 = 0xc;
+goto L4100d8;
+L40ff18:
+a1 = 0xa;
+goto L4100d8;
+L40ff20:
+a1 = 0xd;
+goto L4100d8;
+L40ff28:
+a1 = 0x9;
+goto L4100d8;
+L40ff30:
+a1 = 0xb;
+goto L4100d8;
+L40ff38:
+at = (int)v1 < (int)0x30;
+L40ff3c:
+if (at != 0) {
+at = (int)v1 < (int)0x38;
+goto L40ff48;}
+if ((int)v1 < (int)0x38) {
+at = 0x78;
+goto L40ff58;}
+L40ff48:
+at = 0x78;
+if (v1 == at) {
+at = 0x58;
+goto L40ff58;}
+at = 0x58;
+if (v1 != at) {
+t7 = 0x1;
+goto L4100d8;}
+L40ff58:
+t7 = 0x1;
+at = (int)v1 < (int)0x30;
+MEM_U32(sp + 76) = t7;
+s1 = zero;
+if (at != 0) goto L40ffec;
+s0 = 0x3;
+if ((int)v1 >= (int)0x38) goto L40ffec;
+t8 = s1 << 3;
+L40ff7c:
+t9 = a0 + 0x1;
+s1 = t8 + v1;
+at = (int)t9 < (int)a2;
+s1 = s1 + 0xffffffd0;
+MEM_U32(s2 + 0) = t9;
+a0 = t9;
+if (at != 0) goto L40ffb8;
+//nop;
+a0 = 0x1000fc58;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L40ffb8:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+s0 = s0 + 0xffffffff;
+v1 = a1;
+if ((int)a1 < (int)0x30) goto L410094;
+if ((int)a1 >= (int)0x38) {
+t5 = a0 + 0xffffffff;
+goto L410098;}
+if (s0 != zero) {
+t8 = s1 << 3;
+goto L40ff7c;}
+t5 = a0 + 0xffffffff;
+goto L410098;
+L40ffec:
+t2 = a0 + 0x1;
+t3 = s3 + t2;
+a1 = MEM_U8(t3 + 0);
+MEM_U32(s2 + 0) = t2;
+a0 = t2;
+t4 = s4 + a1;
+t5 = MEM_U8(t4 + 1);
+s0 = 0x2;
+t6 = t5 & 0x80;
+if (t6 == zero) {
+t5 = a0 + 0xffffffff;
+goto L410098;}
+L410018:
+//nop;
+a0 = a1 & 0xff;
+//nop;
+v0 = f_hex_to_num(mem, sp, a0);
+t8 = MEM_U32(s2 + 0);
+a2 = MEM_U32(s5 + 0);
+t7 = s1 << 4;
+a0 = t8 + 0x1;
+at = (int)a0 < (int)a2;
+s1 = v0 + t7;
+// bdead 407e01a7 gp = MEM_U32(sp + 48);
+MEM_U32(s2 + 0) = a0;
+if (at != 0) goto L41006c;
+//nop;
+a0 = 0x1000fc78;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L41006c:
+t1 = s3 + a0;
+a1 = MEM_U8(t1 + 0);
+s0 = s0 + 0xffffffff;
+t2 = s4 + a1;
+t3 = MEM_U8(t2 + 1);
+t4 = t3 & 0x80;
+if (t4 == zero) {
+t5 = a0 + 0xffffffff;
+goto L410098;}
+//nop;
+if (s0 != 0) goto L410018;
+L410094:
+t5 = a0 + 0xffffffff;
+L410098:
+at = (int)s1 < (int)0x100;
+a3 = 0x22;
+MEM_U32(s2 + 0) = t5;
+if (at == 0) goto L4100b8;
+a1 = s1 & 0xff;
+a0 = t5;
+t0 = 0x100146b8;
+goto L4100d8;
+L4100b8:
+//nop;
+a0 = 0x1000fc98;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+goto L41016c;
+L4100d8:
+v0 = MEM_U32(t0 + 0);
+L4100dc:
+t9 = a0 + 0x1;
+a0 = t9;
+t8 = v0 + 0x1;
+if ((int)v0 >= (int)0x3ff) goto L4100fc;
+t6 = 0x100146c0;
+t7 = v0 + t6;
+MEM_U8(t7 + 0) = (uint8_t)a1;
+L4100fc:
+at = (int)t9 < (int)a2;
+MEM_U32(t0 + 0) = t8;
+MEM_U32(s2 + 0) = t9;
+if (at != 0) goto L40fe2c;
+t1 = MEM_U32(t0 + 0);
+L410110:
+a1 = zero;
+if ((int)t1 < (int)0x400) {
+at = (int)a0 < (int)a2;
+goto L41014c;}
+//nop;
+a0 = 0x1000fcb4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+t2 = 0x3ff;
+at = 0x100146b8;
+MEM_U32(at + 0) = t2;
+goto L41016c;
+// fdead 0 at = (int)a0 < (int)a2;
+L41014c:
+a1 = zero;
+if (at != 0) goto L41016c;
+//nop;
+a0 = 0x1000fccc;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 48);
+L41016c:
+v0 = 0x100142b0;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+if (v0 == at) {
+at = 0x68;
+goto L4101a0;}
+at = 0x68;
+if (v0 == at) {
+at = 0x64;
+goto L4101a0;}
+at = 0x64;
+if (v0 == at) {
+at = 0x66;
+goto L4101a0;}
+at = 0x66;
+if (v0 == at) {
+at = 0x22;
+goto L4101a0;}
+at = 0x22;
+if (v0 != at) {
+// bdead 1 ra = MEM_U32(sp + 52);
+goto L410204;}
+L4101a0:
+//nop;
+a0 = 0x100146c0;
+// bdead 40000121 t9 = t9;
+//nop;
+func_40f6f8(mem, sp, a0, a1, a2, a3);
+t3 = MEM_U32(sp + 76);
+// bdead 40001001 gp = MEM_U32(sp + 48);
+//nop;
+if (t3 == 0) goto L4101e8;
+a2 = 0x100146b8;
+//nop;
+a0 = 0x100142b8;
+a2 = MEM_U32(a2 + 0);
+a1 = 0x100146c0;
+a2 = a2 + 0x1;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 48);
+goto L410200;
+L4101e8:
+//nop;
+a0 = 0x100142b8;
+a1 = 0x100146c0;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 48);
+L410200:
+// bdead 1 ra = MEM_U32(sp + 52);
+L410204:
+// bdead 1 s0 = MEM_U32(sp + 24);
+// bdead 1 s1 = MEM_U32(sp + 28);
+// bdead 1 s2 = MEM_U32(sp + 32);
+// bdead 1 s3 = MEM_U32(sp + 36);
+// bdead 1 s4 = MEM_U32(sp + 40);
+// bdead 1 s5 = MEM_U32(sp + 44);
+// bdead 1 sp = sp + 0x68;
+return;
+}
+
+static uint32_t func_410224(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, t8 = 0, t9 = 0,
+lo = 0, hi = 0;
+L410224:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbb0;
+//nop;
+// fdead 400001cb MEM_U32(sp + 28) = s2;
+s2 = 0x10015364;
+// fdead 400801cb MEM_U32(sp + 52) = ra;
+// fdead 400801cb MEM_U32(sp + 48) = gp;
+// fdead 400801cb MEM_U32(sp + 44) = s6;
+// fdead 400801cb MEM_U32(sp + 40) = s5;
+// fdead 400801cb MEM_U32(sp + 36) = s4;
+// fdead 400801cb MEM_U32(sp + 32) = s3;
+// fdead 400801cb MEM_U32(sp + 24) = s1;
+// fdead 400801cb MEM_U32(sp + 20) = s0;
+a0 = MEM_U32(s2 + 0);
+v0 = wrapper_fgetc(mem, a0);
+s5 = 0x20;
+a0 = v0 & 0xff;
+v1 = a0;
+// bdead 4048013b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (s5 == a0) goto L41028c;
+s4 = 0x9;
+if (s4 != a0) {
+at = 0x6c;
+goto L4102c0;}
+L41028c:
+//nop;
+s4 = 0x9;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+v1 = a0;
+// bdead 4068013b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (s5 == a0) goto L41028c;
+//nop;
+if (s4 == s0) goto L41028c;
+at = 0x6c;
+L4102c0:
+//nop;
+if (v1 != at) goto L4103a8;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+t6 = v0 & 0xff;
+at = 0x69;
+// bdead 40680103 gp = MEM_U32(sp + 48);
+if (t6 != at) goto L410328;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+t7 = v0 & 0xff;
+at = 0x6e;
+// bdead 40680103 gp = MEM_U32(sp + 48);
+if (t7 != at) goto L410328;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+t8 = v0 & 0xff;
+at = 0x65;
+// bdead 40680103 gp = MEM_U32(sp + 48);
+if (t8 == at) goto L410358;
+L410328:
+//nop;
+a0 = 0x1000fce8;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 40680003 gp = MEM_U32(sp + 48);
+L410358:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+// bdead 4068012b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410380;
+//nop;
+if (s4 != a0) goto L4103a8;
+L410380:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+// bdead 4068012b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (s5 == a0) goto L410380;
+//nop;
+if (s4 == s0) goto L410380;
+L4103a8:
+s1 = 0xfb4cba0;
+a1 = zero;
+t9 = s1 + a0;
+t0 = MEM_U8(t9 + 1);
+t1 = t0 & 0x4;
+if (t1 != zero) {
+s6 = zero;
+goto L4103f4;}
+//nop;
+a0 = 0x1000fd0c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 406e0003 gp = MEM_U32(sp + 48);
+s6 = zero;
+L4103f4:
+s3 = 0xa;
+L4103f8:
+lo = s6 * s3; hi = (uint32_t)((uint64_t)s6 * (uint64_t)s3 >> 32);
+//nop;
+a0 = MEM_U32(s2 + 0);
+t2 = lo;
+s6 = t2 + s0;
+s6 = s6 + 0xffffffd0;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+t3 = s1 + a0;
+t4 = MEM_U8(t3 + 1);
+// bdead 40fc212b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+t5 = t4 & 0x4;
+//nop;
+if (t5 != 0) goto L4103f8;
+//nop;
+if (s5 == s0) goto L410444;
+v1 = a0;
+if (s4 != a0) goto L41046c;
+L410444:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+v1 = v0 & 0xff;
+// bdead 40f8011b gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (s5 == v1) goto L410444;
+//nop;
+if (s4 == s0) goto L410444;
+L41046c:
+at = 0x22;
+a1 = zero;
+if (v1 == at) goto L410498;
+//nop;
+a0 = 0x1000fd30;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 48);
+v0 = s0;
+goto L4105c0;
+L410498:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+at = 0x22;
+// bdead 40d8012f gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+s1 = zero;
+if (a0 == at) goto L410528;
+if (s5 == a0) {
+at = (int)s1 < (int)0x400;
+goto L41052c;}
+at = 0xff;
+if (s3 == a0) goto L410528;
+s4 = sp + 0x44;
+if (a0 == at) goto L410528;
+at = (int)s1 < (int)0x3ff;
+L4104dc:
+t6 = s4 + s1;
+if (at == 0) goto L4104e8;
+MEM_U8(t6 + 0) = (uint8_t)a0;
+L4104e8:
+//nop;
+s1 = s1 + 0x1;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+a0 = v0 & 0xff;
+at = 0x22;
+// bdead 40fc012f gp = MEM_U32(sp + 48);
+s0 = v0 & 0xff;
+if (a0 == at) goto L410528;
+at = 0xff;
+if (s5 == a0) goto L410528;
+if (s3 == a0) {
+at = (int)s1 < (int)0x400;
+goto L41052c;}
+if (s0 != at) {
+at = (int)s1 < (int)0x3ff;
+goto L4104dc;}
+L410528:
+at = (int)s1 < (int)0x400;
+L41052c:
+s4 = sp + 0x44;
+s3 = s0;
+if (at != 0) goto L41055c;
+//nop;
+a0 = 0x1000fd54;
+MEM_U8(sp + 1091) = (uint8_t)zero;
+a1 = s4;
+a2 = 0x2;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40b80003 gp = MEM_U32(sp + 48);
+goto L410564;
+L41055c:
+t7 = s4 + s1;
+MEM_U8(t7 + 0) = (uint8_t)zero;
+L410564:
+t9 = 0x10013a70;
+at = 0x10013ea4;
+t8 = s6 + 0xfffffffe;
+t9 = MEM_U32(t9 + 0);
+MEM_U32(at + 0) = t8;
+if (t9 == zero) {
+at = 0x22;
+goto L410598;}
+//nop;
+a0 = s4;
+//nop;
+f_make_file(mem, sp, a0);
+// bdead 40180001 gp = MEM_U32(sp + 48);
+at = 0x22;
+L410598:
+v1 = s3;
+if (s3 != at) goto L4105bc;
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+// bdead 9 gp = MEM_U32(sp + 48);
+v1 = v0;
+goto L4105bc;
+L4105bc:
+v0 = v1 & 0xff;
+L4105c0:
+// bdead 9 ra = MEM_U32(sp + 52);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x450;
+return v0;
+}
+
+static void f_readinline(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, t8 = 0, t9 = 0;
+L4105e8:
+//readinline:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffb90;
+at = 0x10014ac0;
+// fdead 4000010f MEM_U32(sp + 36) = s3;
+// fdead 4000010f MEM_U32(sp + 32) = s2;
+// fdead 4000010f MEM_U32(sp + 28) = s1;
+// fdead 4000010f MEM_U32(sp + 24) = s0;
+// fdead 4000010f MEM_U32(sp + 44) = ra;
+// fdead 4000010f MEM_U32(sp + 40) = gp;
+s0 = zero;
+a2 = 0x20;
+t0 = 0x1;
+a1 = zero;
+s1 = 0xa;
+s2 = 0x10015364;
+s3 = 0xff;
+MEM_U32(at + 0) = zero;
+L410634:
+//nop;
+a0 = MEM_U32(s2 + 0);
+MEM_U32(sp + 1128) = a1;
+MEM_U8(sp + 1134) = (uint8_t)a2;
+MEM_U32(sp + 60) = t0;
+v0 = wrapper_fgetc(mem, a0);
+v1 = v0 & 0xff;
+at = 0x9;
+// bdead 401e001f gp = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 1128);
+a2 = MEM_U8(sp + 1134);
+t0 = MEM_U32(sp + 60);
+a3 = v0 & 0xff;
+if (v1 == at) goto L410678;
+at = 0xc;
+if (v1 != at) {
+at = 0x22;
+goto L410684;}
+L410678:
+a3 = 0x20;
+goto L4106d0;
+at = 0x22;
+L410684:
+if (v1 != at) {
+at = 0x5c;
+goto L41069c;}
+at = 0x5c;
+//nop;
+if (a2 == at) goto L41069c;
+t0 = t0 < 0x1;
+goto L4106d0;
+L41069c:
+//nop;
+if (s1 == v1) goto L4106ac;
+//nop;
+if (s3 != v1) goto L4106b4;
+L4106ac:
+a1 = 0x1;
+goto L4106d0;
+L4106b4:
+at = 0x3b;
+if (t0 == 0) goto L4106d0;
+if (v1 == at) {
+at = 0x23;
+goto L4106cc;}
+at = 0x23;
+//nop;
+if (v1 != at) goto L4106d0;
+L4106cc:
+a1 = 0x1;
+L4106d0:
+a2 = a3 & 0xff;
+if (a1 != 0) goto L4106f0;
+t6 = sp + 0x40;
+if ((int)s0 >= (int)0x41f) goto L4106ec;
+t7 = s0 + t6;
+MEM_U8(t7 + 0) = (uint8_t)a3;
+L4106ec:
+s0 = s0 + 0x1;
+L4106f0:
+//nop;
+if (a1 == 0) goto L410634;
+at = 0x23;
+v1 = a3;
+if (a3 != at) goto L410728;
+if (s0 != zero) {
+at = 0x3b;
+goto L41072c;}
+//nop;
+// fdead 601f83df t9 = t9;
+//nop;
+v0 = func_410224(mem, sp);
+a3 = v0 & 0xff;
+v1 = a3;
+// bdead 401e0113 gp = MEM_U32(sp + 40);
+L410728:
+at = 0x3b;
+L41072c:
+t2 = 0x1;
+if (v1 == at) goto L41073c;
+//nop;
+if (s3 != v1) goto L410768;
+L41073c:
+v1 = 0x100153a0;
+v1 = v1;
+t8 = MEM_U32(v1 + 0);
+//nop;
+if (t8 != 0) goto L410760;
+v0 = 0x10013ea4;
+t9 = MEM_U32(v0 + 0);
+t1 = t9 + 0x1;
+MEM_U32(v0 + 0) = t1;
+L410760:
+MEM_U32(v1 + 0) = t2;
+goto L4107e0;
+L410768:
+//nop;
+if (s1 == v1) goto L4107a0;
+//nop;
+if (s3 == v1) goto L4107a0;
+L410778:
+//nop;
+a0 = MEM_U32(s2 + 0);
+//nop;
+v0 = wrapper_fgetc(mem, a0);
+t3 = v0 & 0xff;
+// bdead 401e100b gp = MEM_U32(sp + 40);
+a3 = v0 & 0xff;
+if (s1 == t3) goto L4107a0;
+//nop;
+if (s3 != a3) goto L410778;
+L4107a0:
+t4 = 0x10013a70;
+t4 = MEM_U32(t4 + 0);
+//nop;
+if (t4 == 0) goto L4107d4;
+v1 = 0x100153a0;
+v1 = v1;
+t5 = MEM_U32(v1 + 0);
+//nop;
+if (t5 != 0) goto L4107d4;
+v0 = 0x10013ea4;
+t6 = MEM_U32(v0 + 0);
+t7 = t6 + 0x1;
+MEM_U32(v0 + 0) = t7;
+L4107d4:
+v1 = 0x100153a0;
+v1 = v1;
+MEM_U32(v1 + 0) = zero;
+L4107e0:
+a1 = zero;
+if ((int)s0 < (int)0x420) goto L410810;
+//nop;
+a0 = 0x1000fd78;
+s0 = 0x41f;
+a2 = 0x2;
+MEM_U8(sp + 1135) = (uint8_t)a3;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40120003 gp = MEM_U32(sp + 40);
+a3 = MEM_U8(sp + 1135);
+L410810:
+t8 = sp + 0x40;
+t9 = s0 + t8;
+MEM_U8(t9 + 0) = (uint8_t)zero;
+//nop;
+MEM_U8(sp + 1135) = (uint8_t)a3;
+a0 = 0x10013a80;
+a1 = sp + 0x40;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40120003 gp = MEM_U32(sp + 40);
+a3 = MEM_U8(sp + 1135);
+v1 = 0x10013a78;
+MEM_U32(v1 + 0) = s0;
+if (s0 != 0) goto L41085c;
+if (s3 == a3) {
+// bdead 3 ra = MEM_U32(sp + 44);
+goto L410860;}
+//nop;
+//nop;
+f_readinline(mem, sp);
+// bdead 3 gp = MEM_U32(sp + 40);
+L41085c:
+// bdead 3 ra = MEM_U32(sp + 44);
+L410860:
+at = 0x10013a7c;
+// bdead 7 s0 = MEM_U32(sp + 24);
+// bdead 7 s1 = MEM_U32(sp + 28);
+// bdead 7 s2 = MEM_U32(sp + 32);
+// bdead 7 s3 = MEM_U32(sp + 36);
+// bdead 7 sp = sp + 0x470;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static uint32_t f_alloc_new_sym(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L410880:
+//alloc_new_sym:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000000b MEM_U32(sp + 28) = ra;
+// fdead 4000000b MEM_U32(sp + 24) = gp;
+a0 = 0x1c;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if (v0 != 0) goto L4108c4;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L4108dc;
+L4108c4:
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = zero;
+a2 = 0x1c;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L4108dc:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_new_string(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L4108f0:
+//alloc_new_string:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+v0 = wrapper_strlen(mem, a0);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+a0 = v0 + 0x1;
+//nop;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+if (v0 != 0) goto L410944;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L410944:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_EnterSym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41096c:
+//EnterSym:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 52) = a1;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 48) = a0;
+MEM_U32(sp + 56) = a2;
+a1 = sp + 0x2c;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 != 0) goto L410a50;
+//nop;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_hash(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 40) = v0;
+//nop;
+//nop;
+v0 = f_alloc_new_sym(mem, sp);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 40);
+MEM_U32(sp + 44) = v0;
+t8 = 0x10014b48;
+t7 = t6 << 2;
+v1 = t7 + t8;
+t9 = MEM_U32(v1 + 0);
+MEM_U32(v0 + 0) = t9;
+//nop;
+MEM_U32(sp + 36) = v1;
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_alloc_new_string(mem, sp, a0);
+t0 = MEM_U32(sp + 44);
+// bdead 4000038b gp = MEM_U32(sp + 24);
+t1 = 0x3;
+MEM_U32(t0 + 4) = v0;
+t2 = MEM_U32(sp + 44);
+MEM_U32(t2 + 16) = t1;
+t3 = MEM_U32(sp + 44);
+MEM_U32(t3 + 8) = zero;
+t4 = MEM_U32(sp + 44);
+MEM_U32(t4 + 20) = zero;
+//nop;
+a1 = MEM_U32(sp + 56);
+a0 = MEM_U32(sp + 48);
+//nop;
+v0 = f_sym_enter(mem, sp, a0, a1);
+t5 = MEM_U32(sp + 44);
+// bdead 40004109 gp = MEM_U32(sp + 24);
+MEM_U32(t5 + 24) = v0;
+t7 = MEM_U32(sp + 36);
+t6 = MEM_U32(sp + 44);
+MEM_U32(t7 + 0) = t6;
+L410a50:
+t8 = MEM_U32(sp + 44);
+at = 0x3;
+a2 = 0x1;
+t9 = MEM_U32(t8 + 16);
+if (t9 == at) {
+t0 = MEM_U32(sp + 44);
+goto L410a84;}
+//nop;
+a0 = 0x1000fd88;
+a1 = 0x100142b8;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 44);
+L410a84:
+t1 = MEM_U32(sp + 52);
+MEM_U32(t1 + 0) = t0;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x30;
+//nop;
+return;
+}
+
+static uint32_t f_GetRegister(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L410a9c:
+//GetRegister:
+//nop;
+//nop;
+//nop;
+t6 = 0x100142b0;
+sp = sp + 0xffffffd8;
+at = 0x69;
+t6 = MEM_U8(t6 + 0);
+// fdead 400080ef MEM_U32(sp + 28) = ra;
+// fdead 400080ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = zero;
+if (t6 == at) goto L410ae8;
+//nop;
+a0 = 0x1000fda0;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410b58;
+L410ae8:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x24;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+t7 = MEM_U32(sp + 36);
+a1 = 0x100142b8;
+if (v0 != 0) goto L410b28;
+//nop;
+a0 = 0x1000fdb4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410b58;
+L410b28:
+t8 = MEM_U32(t7 + 16);
+t9 = MEM_U32(sp + 36);
+if (t8 == zero) {
+MEM_U32(sp + 32) = t9;
+goto L410b58;}
+//nop;
+a0 = 0x1000fdc8;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410b58;
+// fdead 0 MEM_U32(sp + 32) = t9;
+L410b58:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t0 = 0x100142b0;
+t0 = MEM_U8(t0 + 0);
+if (t0 != at) {
+// bdead 40000001 ra = MEM_U32(sp + 28);
+goto L410b90;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L410b90:
+v0 = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t func_410ba0(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L410ba0:
+//nop;
+//nop;
+//nop;
+v1 = 0x100142b0;
+sp = sp + 0xffffffc0;
+at = 0x2d;
+v1 = MEM_U8(v1 + 0);
+// fdead 400000ff MEM_U32(sp + 28) = ra;
+// fdead 400000ff MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = zero;
+MEM_U32(sp + 60) = zero;
+MEM_U32(sp + 56) = zero;
+if (v1 != at) goto L410bf8;
+//nop;
+t6 = 0x1;
+MEM_U32(sp + 60) = t6;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+goto L410c4c;
+L410bf8:
+at = 0x2b;
+if (v1 != at) {
+at = 0x7e;
+goto L410c24;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+goto L410c4c;
+at = 0x7e;
+L410c24:
+if (v1 != at) {
+at = 0x22;
+goto L410c50;}
+//nop;
+t7 = 0x1;
+MEM_U32(sp + 56) = t7;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+L410c4c:
+at = 0x22;
+L410c50:
+if (v1 == at) {
+at = 0x28;
+goto L410d80;}
+at = 0x28;
+if (v1 == at) {
+at = 0x64;
+goto L410c80;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L410d5c;}
+at = 0x68;
+if (v1 == at) {
+at = 0x69;
+goto L410d5c;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L410cdc;
+//nop;
+goto L410dc0;
+L410c80:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+v0 = func_411664(mem, sp);
+// bdead 4000010b gp = MEM_U32(sp + 24);
+at = 0x29;
+MEM_U32(sp + 52) = v0;
+t8 = 0x100142b0;
+a1 = zero;
+t8 = MEM_U8(t8 + 0);
+if (t8 == at) {
+t5 = MEM_U32(sp + 60);
+goto L410dec;}
+//nop;
+a0 = 0x1000fddc;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410de8;
+L410cdc:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x30;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 48);
+a3 = 0x100142b8;
+if (v0 != 0) goto L410d20;
+//nop;
+a0 = 0x1000fdf4;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410de8;
+L410d20:
+t0 = MEM_U32(t9 + 16);
+at = 0x4;
+a1 = a3;
+t1 = MEM_U32(sp + 48);
+if (t0 == at) goto L410d50;
+//nop;
+a0 = 0x1000fe14;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410de8;
+L410d50:
+t2 = MEM_U32(t1 + 8);
+MEM_U32(sp + 52) = t2;
+goto L410de8;
+L410d5c:
+//nop;
+a1 = MEM_U32(sp + 60);
+a0 = 0x100142b8;
+// fdead 600000ff t9 = t9;
+MEM_U32(sp + 60) = zero;
+v0 = func_40eafc(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 52) = v0;
+goto L410de8;
+L410d80:
+t4 = 0x100146b8;
+a3 = 0x100142b8;
+MEM_U32(sp + 60) = zero;
+t4 = MEM_U32(t4 + 0);
+t3 = MEM_U8(a3 + 0);
+a1 = a3;
+MEM_U32(sp + 52) = t3;
+if ((int)t4 < (int)0x2) goto L410de8;
+//nop;
+a0 = 0x1000fe34;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L410de8;
+L410dc0:
+//nop;
+a0 = 0x1000fe6c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L410de8:
+t5 = MEM_U32(sp + 60);
+L410dec:
+v1 = MEM_U32(sp + 52);
+t6 = MEM_U32(sp + 56);
+//nop;
+if (t5 == 0) goto L410e04;
+v1 = -v1;
+goto L410e18;
+L410e04:
+v1 = MEM_U32(sp + 52);
+if (t6 == 0) goto L410e18;
+v1 = MEM_U32(sp + 52);
+v1 = ~v1;
+goto L410e18;
+L410e18:
+//nop;
+MEM_U32(sp + 44) = v1;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static uint64_t func_410e3c(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L410e3c:
+//nop;
+//nop;
+//nop;
+v1 = 0x100142b0;
+sp = sp + 0xffffffb8;
+t6 = 0x0;
+v1 = MEM_U8(v1 + 0);
+t7 = 0x0;
+at = 0x2d;
+// fdead 400181ff MEM_U32(sp + 28) = ra;
+// fdead 400181ff MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 60) = t7;
+MEM_U32(sp + 56) = t6;
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 64) = zero;
+if (v1 != at) goto L410ea0;
+//nop;
+t8 = 0x1;
+MEM_U32(sp + 68) = t8;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+goto L410ef0;
+L410ea0:
+at = 0x2b;
+if (v1 != at) {
+at = 0x7e;
+goto L410ecc;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+goto L410ef0;
+at = 0x7e;
+L410ecc:
+t9 = 0x1;
+if (v1 != at) goto L410ef0;
+MEM_U32(sp + 64) = t9;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x100142b0;
+v1 = MEM_U8(v1 + 0);
+L410ef0:
+at = 0x22;
+t8 = 0x0;
+if (v1 == at) goto L411038;
+at = 0x28;
+if (v1 == at) {
+at = 0x64;
+goto L410f28;}
+at = 0x64;
+if (v1 == at) {
+at = 0x68;
+goto L411010;}
+at = 0x68;
+if (v1 == at) {
+at = 0x69;
+goto L411010;}
+at = 0x69;
+a1 = zero;
+if (v1 == at) goto L410f88;
+//nop;
+goto L41107c;
+L410f28:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+temp64 = func_411750(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000011b gp = MEM_U32(sp + 24);
+at = 0x29;
+MEM_U32(sp + 56) = v0;
+t0 = 0x100142b0;
+MEM_U32(sp + 60) = v1;
+a1 = zero;
+t0 = MEM_U8(t0 + 0);
+if (t0 == at) {
+t1 = MEM_U32(sp + 68);
+goto L4110a8;}
+//nop;
+a0 = 0x1000fe8c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L4110a4;
+L410f88:
+//nop;
+a0 = 0x100142b8;
+a1 = sp + 0x34;
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 52);
+a3 = 0x100142b8;
+if (v0 != 0) goto L410fcc;
+//nop;
+a0 = 0x1000fea4;
+a1 = zero;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L4110a4;
+L410fcc:
+t2 = MEM_U32(t1 + 16);
+at = 0x4;
+a1 = a3;
+t3 = MEM_U32(sp + 52);
+if (t2 == at) goto L410ffc;
+//nop;
+a0 = 0x1000fec4;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L4110a4;
+L410ffc:
+t4 = MEM_U32(t3 + 8);
+t6 = (int)t4 >> 31;
+MEM_U32(sp + 56) = t6;
+MEM_U32(sp + 60) = t4;
+goto L4110a4;
+L411010:
+//nop;
+a1 = MEM_U32(sp + 68);
+a0 = 0x100142b8;
+// bdead 40000063 t9 = t9;
+MEM_U32(sp + 68) = zero;
+temp64 = func_40eca0(mem, sp, a0, a1);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000119 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4110a4;
+L411038:
+t0 = 0x100146b8;
+a3 = 0x100142b8;
+MEM_U32(sp + 56) = t8;
+t0 = MEM_U32(t0 + 0);
+t5 = MEM_U8(a3 + 0);
+MEM_U32(sp + 68) = zero;
+MEM_U32(sp + 60) = t5;
+if ((int)t0 < (int)0x2) goto L4110a4;
+//nop;
+a0 = 0x1000fee4;
+a1 = a3;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+goto L4110a4;
+L41107c:
+//nop;
+a0 = 0x1000ff1c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L4110a4:
+t1 = MEM_U32(sp + 68);
+L4110a8:
+t2 = MEM_U32(sp + 56);
+t3 = MEM_U32(sp + 60);
+t6 = MEM_U32(sp + 64);
+if (t1 == 0) goto L4110d4;
+at = t3 < 0x1;
+t4 = ~t2;
+t4 = t4 + at;
+t5 = -t3;
+MEM_U32(sp + 44) = t5;
+MEM_U32(sp + 40) = t4;
+goto L411104;
+L4110d4:
+t2 = MEM_U32(sp + 56);
+if (t6 == 0) goto L4110f8;
+t8 = MEM_U32(sp + 56);
+t9 = MEM_U32(sp + 60);
+t0 = ~t8;
+t1 = ~t9;
+MEM_U32(sp + 44) = t1;
+MEM_U32(sp + 40) = t0;
+goto L411104;
+L4110f8:
+t3 = MEM_U32(sp + 60);
+MEM_U32(sp + 40) = t2;
+MEM_U32(sp + 44) = t3;
+L411104:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 ra = MEM_U32(sp + 28);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v0 = MEM_U32(sp + 40);
+v1 = MEM_U32(sp + 44);
+// bdead 19 sp = sp + 0x48;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_411128(uint8_t *mem, uint32_t sp) {
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0,
+s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0,
+fp = 0, lo = 0, hi = 0;
+L411128:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400000eb MEM_U32(sp + 60) = ra;
+// fdead 400000eb MEM_U32(sp + 56) = fp;
+// fdead 400000eb t9 = t9;
+// fdead 400000eb MEM_U32(sp + 52) = gp;
+// fdead 400000eb MEM_U32(sp + 48) = s7;
+// fdead 400000eb MEM_U32(sp + 44) = s6;
+// fdead 400000eb MEM_U32(sp + 40) = s5;
+// fdead 400000eb MEM_U32(sp + 36) = s4;
+// fdead 400000eb MEM_U32(sp + 32) = s3;
+// fdead 400000eb MEM_U32(sp + 28) = s2;
+// fdead 400000eb MEM_U32(sp + 24) = s1;
+// fdead 400000eb MEM_U32(sp + 20) = s0;
+v0 = func_410ba0(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 52);
+at = 0x2a;
+s2 = v0;
+a0 = 0x100142b0;
+s6 = 0x2f;
+a0 = MEM_U8(a0 + 0);
+v1 = a0;
+if (a0 == at) goto L4111c8;
+s7 = 0x25;
+if (s6 == v1) goto L4111c8;
+fp = 0x3c;
+if (s7 == v1) goto L4111c8;
+at = 0x3e;
+if (fp == v1) goto L4111c8;
+s3 = 0x5e;
+if (v1 == at) goto L4111c8;
+s5 = 0x26;
+if (s3 == v1) goto L4111c8;
+s4 = 0x7c;
+if (s5 == v1) goto L4111c8;
+if (s4 != v1) {
+// bdead 80001 ra = MEM_U32(sp + 60);
+goto L411358;}
+L4111c8:
+//nop;
+s3 = 0x5e;
+s4 = 0x7c;
+s5 = 0x26;
+s6 = 0x2f;
+s7 = 0x25;
+fp = 0x3c;
+s0 = s2;
+s1 = a0 & 0xff;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead c1fe0101 gp = MEM_U32(sp + 52);
+//nop;
+// fdead 6e1fe001f t9 = t9;
+//nop;
+v0 = func_410ba0(mem, sp);
+at = (int)s1 < (int)0x5f;
+// bdead c1fe010d gp = MEM_U32(sp + 52);
+v1 = s1;
+if (at != 0) goto L411224;
+if (v1 == s4) {
+s2 = s0 | v0;
+goto L411304;}
+//nop;
+goto L411304;
+L411224:
+t6 = v1 + 0xffffffdb;
+if ((int)v1 < (int)0x3f) goto L411240;
+//nop;
+if (v1 == s3) goto L4112f0;
+//nop;
+goto L411304;
+L411240:
+//nop;
+if (t6 >= 0x1a) goto L411304;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t6) {
+case 0: goto L4112ac;
+case 1: goto L4112f8;
+case 2: goto L411304;
+case 3: goto L411304;
+case 4: goto L411304;
+case 5: goto L411268;
+case 6: goto L411304;
+case 7: goto L411304;
+case 8: goto L411304;
+case 9: goto L411304;
+case 10: goto L411278;
+case 11: goto L411304;
+case 12: goto L411304;
+case 13: goto L411304;
+case 14: goto L411304;
+case 15: goto L411304;
+case 16: goto L411304;
+case 17: goto L411304;
+case 18: goto L411304;
+case 19: goto L411304;
+case 20: goto L411304;
+case 21: goto L411304;
+case 22: goto L411304;
+case 23: goto L4112e0;
+case 24: goto L411304;
+case 25: goto L4112e8;
+}
+L411268:
+lo = s0 * v0; hi = (uint32_t)((uint64_t)s0 * (uint64_t)v0 >> 32);
+s2 = lo;
+//nop;
+goto L411304;
+L411278:
+lo = (int)s0 / (int)v0; hi = (int)s0 % (int)v0;
+s2 = lo;
+//nop;
+if (v0 != 0) goto L41128c;
+abort();
+L41128c:
+at = 0xffffffff;
+if (v0 != at) {
+at = 0x80000000;
+goto L4112a4;}
+at = 0x80000000;
+//nop;
+if (s0 != at) goto L4112a4;
+abort();
+L4112a4:
+//nop;
+goto L411304;
+L4112ac:
+lo = (int)s0 / (int)v0; hi = (int)s0 % (int)v0;
+s2 = hi;
+//nop;
+if (v0 != 0) goto L4112c0;
+abort();
+L4112c0:
+at = 0xffffffff;
+if (v0 != at) {
+at = 0x80000000;
+goto L4112d8;}
+at = 0x80000000;
+//nop;
+if (s0 != at) goto L4112d8;
+abort();
+L4112d8:
+//nop;
+goto L411304;
+L4112e0:
+s2 = s0 << (v0 & 0x1f);
+goto L411304;
+L4112e8:
+s2 = s0 >> (v0 & 0x1f);
+goto L411304;
+L4112f0:
+s2 = s0 ^ v0;
+goto L411304;
+L4112f8:
+s2 = s0 & v0;
+goto L411304;
+// fdead 0 s2 = s0 | v0;
+L411304:
+a0 = 0x100142b0;
+at = 0x2a;
+a0 = MEM_U8(a0 + 0);
+v1 = a0;
+if (a0 == at) goto L4111c8;
+//nop;
+if (s6 == v1) goto L4111c8;
+//nop;
+if (s7 == v1) goto L4111c8;
+//nop;
+if (fp == v1) goto L4111c8;
+at = 0x3e;
+//nop;
+if (v1 == at) goto L4111c8;
+//nop;
+if (s3 == v1) goto L4111c8;
+//nop;
+if (s5 == v1) goto L4111c8;
+//nop;
+if (s4 == v1) goto L4111c8;
+// bdead 80001 ra = MEM_U32(sp + 60);
+L411358:
+v0 = s2;
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s3 = MEM_U32(sp + 32);
+// bdead 9 s4 = MEM_U32(sp + 36);
+// bdead 9 s5 = MEM_U32(sp + 40);
+// bdead 9 s6 = MEM_U32(sp + 44);
+// bdead 9 s7 = MEM_U32(sp + 48);
+// bdead 9 fp = MEM_U32(sp + 56);
+// bdead 9 sp = sp + 0x40;
+return v0;
+}
+
+static void func_411388(uint8_t *mem, uint32_t sp) {
+L411388:
+//nop;
+return;
+}
+
+static uint64_t func_411390(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+uint64_t temp64;
+L411390:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s2;
+// fdead 400001eb MEM_U32(sp + 24) = s1;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+temp64 = func_410e3c(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+//nop;
+// fdead 6000001b t9 = t9;
+//nop;
+func_411388(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+at = 0x2a;
+a1 = 0x100142b0;
+a1 = MEM_U8(a1 + 0);
+a0 = a1;
+if (a1 == at) goto L411430;
+at = 0x2f;
+if (a0 == at) {
+at = 0x25;
+goto L411430;}
+at = 0x25;
+if (a0 == at) {
+at = 0x3c;
+goto L411430;}
+at = 0x3c;
+if (a0 == at) {
+at = 0x3e;
+goto L411430;}
+at = 0x3e;
+s2 = 0x5e;
+if (a0 == at) goto L411430;
+at = 0x26;
+if (s2 == a0) goto L411430;
+s1 = 0x7c;
+if (a0 == at) goto L411430;
+if (s1 != a0) {
+// bdead 40000001 ra = MEM_U32(sp + 36);
+goto L411648;}
+L411430:
+//nop;
+t6 = MEM_U32(sp + 56);
+t7 = MEM_U32(sp + 60);
+s1 = 0x7c;
+s2 = 0x5e;
+s0 = a1 & 0xff;
+MEM_U32(sp + 48) = t6;
+MEM_U32(sp + 52) = t7;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 400e0101 gp = MEM_U32(sp + 32);
+//nop;
+// fdead 600e001f t9 = t9;
+//nop;
+temp64 = func_410e3c(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+at = (int)s0 < (int)0x5f;
+// bdead 400e011d gp = MEM_U32(sp + 32);
+MEM_U32(sp + 40) = v0;
+MEM_U32(sp + 44) = v1;
+a0 = s0;
+if (at != 0) goto L411490;
+t8 = MEM_U32(sp + 48);
+if (s0 == s1) goto L4115d0;
+//nop;
+goto L4115e4;
+L411490:
+t8 = a0 + 0xffffffdb;
+if ((int)a0 < (int)0x3f) goto L4114ac;
+t0 = MEM_U32(sp + 48);
+if (a0 == s2) goto L41159c;
+//nop;
+goto L4115e4;
+L4114ac:
+//nop;
+if (t8 >= 0x1a) goto L4115e4;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+switch (t8) {
+case 0: goto L411524;
+case 1: goto L4115b4;
+case 2: goto L4115e4;
+case 3: goto L4115e4;
+case 4: goto L4115e4;
+case 5: goto L4114d4;
+case 6: goto L4115e4;
+case 7: goto L4115e4;
+case 8: goto L4115e4;
+case 9: goto L4115e4;
+case 10: goto L4114fc;
+case 11: goto L4115e4;
+case 12: goto L4115e4;
+case 13: goto L4115e4;
+case 14: goto L4115e4;
+case 15: goto L4115e4;
+case 16: goto L4115e4;
+case 17: goto L4115e4;
+case 18: goto L4115e4;
+case 19: goto L4115e4;
+case 20: goto L4115e4;
+case 21: goto L4115e4;
+case 22: goto L4115e4;
+case 23: goto L41154c;
+case 24: goto L4115e4;
+case 25: goto L411574;
+}
+L4114d4:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+temp64 = wrapper___ll_mul((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4115e4;
+L4114fc:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+temp64 = wrapper___ll_div((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4115e4;
+L411524:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+temp64 = wrapper___ll_rem((((uint64_t)a0 << 32) | (uint64_t)a1), (int64_t)(((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4115e4;
+L41154c:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+temp64 = wrapper___ll_lshift((int64_t)(((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4115e4;
+L411574:
+//nop;
+a0 = MEM_U32(sp + 56);
+a1 = MEM_U32(sp + 60);
+a2 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 44);
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 400c0119 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+goto L4115e4;
+L41159c:
+t1 = MEM_U32(sp + 52);
+t2 = t0 ^ v0;
+MEM_U32(sp + 56) = t2;
+t3 = t1 ^ v1;
+MEM_U32(sp + 60) = t3;
+goto L4115e4;
+L4115b4:
+t4 = MEM_U32(sp + 48);
+t5 = MEM_U32(sp + 52);
+t6 = t4 & v0;
+t7 = t5 & v1;
+MEM_U32(sp + 60) = t7;
+MEM_U32(sp + 56) = t6;
+goto L4115e4;
+L4115d0:
+t9 = MEM_U32(sp + 52);
+t0 = t8 | v0;
+MEM_U32(sp + 56) = t0;
+t1 = t9 | v1;
+MEM_U32(sp + 60) = t1;
+L4115e4:
+a1 = 0x100142b0;
+at = 0x2a;
+a1 = MEM_U8(a1 + 0);
+a0 = a1;
+if (a1 == at) goto L411430;
+at = 0x2f;
+//nop;
+if (a0 == at) goto L411430;
+at = 0x25;
+//nop;
+if (a0 == at) goto L411430;
+at = 0x3c;
+//nop;
+if (a0 == at) goto L411430;
+at = 0x3e;
+//nop;
+if (a0 == at) goto L411430;
+//nop;
+if (s2 == a0) goto L411430;
+at = 0x26;
+//nop;
+if (a0 == at) goto L411430;
+//nop;
+if (s1 == a0) goto L411430;
+// bdead 40000001 ra = MEM_U32(sp + 36);
+L411648:
+v0 = MEM_U32(sp + 56);
+v1 = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 20);
+// bdead 19 s1 = MEM_U32(sp + 24);
+// bdead 19 s2 = MEM_U32(sp + 28);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t func_411664(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, s0 = 0, s1 = 0,
+s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+L411664:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 400000eb MEM_U32(sp + 52) = ra;
+// fdead 400000eb MEM_U32(sp + 48) = gp;
+// fdead 400000eb t9 = t9;
+// fdead 400000eb MEM_U32(sp + 44) = s5;
+// fdead 400000eb MEM_U32(sp + 40) = s4;
+// fdead 400000eb MEM_U32(sp + 36) = s3;
+// fdead 400000eb MEM_U32(sp + 32) = s2;
+// fdead 400000eb MEM_U32(sp + 28) = s1;
+// fdead 400000eb MEM_U32(sp + 24) = s0;
+v0 = func_411128(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 48);
+s3 = 0x2b;
+s2 = v0;
+s5 = 0x100142b0;
+s4 = 0x2d;
+a0 = MEM_U8(s5 + 0);
+v1 = a0;
+if (s3 == a0) goto L4116c8;
+if (s4 != v1) {
+// bdead 80001 ra = MEM_U32(sp + 52);
+goto L41172c;}
+L4116c8:
+//nop;
+s4 = 0x2d;
+s0 = s2;
+s1 = a0 & 0xff;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 407e0101 gp = MEM_U32(sp + 48);
+//nop;
+// fdead 607e001b t9 = t9;
+//nop;
+v0 = func_411128(mem, sp);
+// bdead 407e0109 gp = MEM_U32(sp + 48);
+if (s3 == s1) goto L411708;
+if (s1 == s4) {
+s2 = s0 - v0;
+goto L411714;}
+a0 = MEM_U8(s5 + 0);
+goto L411718;
+L411708:
+s2 = s0 + v0;
+goto L411714;
+// fdead 0 s2 = s0 - v0;
+L411714:
+a0 = MEM_U8(s5 + 0);
+L411718:
+v1 = a0;
+if (s3 == a0) goto L4116c8;
+//nop;
+if (s4 == v1) goto L4116c8;
+// bdead 80001 ra = MEM_U32(sp + 52);
+L41172c:
+v0 = s2;
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 s4 = MEM_U32(sp + 40);
+// bdead 9 s5 = MEM_U32(sp + 44);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static uint64_t func_411750(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L411750:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 40) = gp;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 36) = s3;
+// fdead 400001eb MEM_U32(sp + 32) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+temp64 = func_411390(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 40000019 gp = MEM_U32(sp + 40);
+MEM_U32(sp + 56) = v0;
+MEM_U32(sp + 60) = v1;
+//nop;
+// fdead 6000001b t9 = t9;
+//nop;
+func_411388(mem, sp);
+// bdead 40000101 gp = MEM_U32(sp + 40);
+s1 = 0x2b;
+s2 = 0x2d;
+s3 = 0x100142b0;
+a1 = MEM_U8(s3 + 0);
+a0 = a1;
+if (s1 == a1) goto L4117c4;
+if (s2 != a0) {
+// bdead 40000001 ra = MEM_U32(sp + 44);
+goto L411868;}
+L4117c4:
+//nop;
+t6 = MEM_U32(sp + 56);
+t7 = MEM_U32(sp + 60);
+s2 = 0x2d;
+s0 = a1 & 0xff;
+MEM_U32(sp + 48) = t6;
+MEM_U32(sp + 52) = t7;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 401e0101 gp = MEM_U32(sp + 40);
+//nop;
+// fdead 601e001f t9 = t9;
+//nop;
+temp64 = func_411390(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 401e0119 gp = MEM_U32(sp + 40);
+if (s1 == s0) goto L411810;
+t2 = MEM_U32(sp + 48);
+if (s0 == s2) goto L411834;
+a1 = MEM_U8(s3 + 0);
+goto L411854;
+L411810:
+t9 = MEM_U32(sp + 52);
+t8 = MEM_U32(sp + 48);
+t1 = t9 + v1;
+at = t1 < v1;
+t0 = at + t8;
+t0 = t0 + v0;
+MEM_U32(sp + 56) = t0;
+MEM_U32(sp + 60) = t1;
+goto L411850;
+L411834:
+t3 = MEM_U32(sp + 52);
+t4 = t2 - v0;
+at = t3 < v1;
+t4 = t4 - at;
+t5 = t3 - v1;
+MEM_U32(sp + 60) = t5;
+MEM_U32(sp + 56) = t4;
+L411850:
+a1 = MEM_U8(s3 + 0);
+L411854:
+a0 = a1;
+if (s1 == a1) goto L4117c4;
+//nop;
+if (s2 == a0) goto L4117c4;
+// bdead 40000001 ra = MEM_U32(sp + 44);
+L411868:
+v0 = MEM_U32(sp + 56);
+v1 = MEM_U32(sp + 60);
+// bdead 19 s0 = MEM_U32(sp + 24);
+// bdead 19 s1 = MEM_U32(sp + 28);
+// bdead 19 s2 = MEM_U32(sp + 32);
+// bdead 19 s3 = MEM_U32(sp + 36);
+// bdead 19 sp = sp + 0x40;
+return ((uint64_t)v0 << 32) | v1;
+}
+
+static uint32_t f_GetExpr(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L411888:
+//GetExpr:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffd8;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+// fdead 400000ef MEM_U32(sp + 28) = ra;
+// fdead 400000ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = zero;
+if (v0 == at) goto L4118f0;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L4118f0;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L4118f0;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L4118f0;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L4118f0;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L4118f0;}
+at = 0x28;
+if (v0 == at) {
+at = 0x22;
+goto L4118f0;}
+at = 0x22;
+a1 = zero;
+if (v0 != at) goto L411930;
+L4118f0:
+//nop;
+// fdead 400000ef t9 = t9;
+//nop;
+v0 = func_411664(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+at = 0x2c;
+MEM_U32(sp + 36) = v0;
+t6 = 0x100142b0;
+t6 = MEM_U8(t6 + 0);
+if (t6 != at) {
+// bdead 40000001 ra = MEM_U32(sp + 28);
+goto L41195c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+goto L411958;
+L411930:
+//nop;
+a0 = 0x1000ff3c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L411958:
+// bdead 40000001 ra = MEM_U32(sp + 28);
+L41195c:
+v0 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_dw_GetExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t8 = 0,
+t9 = 0;
+uint64_t temp64;
+L41196c:
+//dw_GetExpr:
+//nop;
+//nop;
+//nop;
+v0 = 0x100142b0;
+sp = sp + 0xffffffd8;
+at = 0x69;
+v0 = MEM_U8(v0 + 0);
+// fdead 400001ef MEM_U32(sp + 28) = ra;
+// fdead 400001ef MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+if (v0 == at) goto L4119d8;
+at = 0x64;
+if (v0 == at) {
+at = 0x68;
+goto L4119d8;}
+at = 0x68;
+if (v0 == at) {
+at = 0x2b;
+goto L4119d8;}
+at = 0x2b;
+if (v0 == at) {
+at = 0x2d;
+goto L4119d8;}
+at = 0x2d;
+if (v0 == at) {
+at = 0x7e;
+goto L4119d8;}
+at = 0x7e;
+if (v0 == at) {
+at = 0x28;
+goto L4119d8;}
+at = 0x28;
+if (v0 == at) {
+at = 0x22;
+goto L4119d8;}
+at = 0x22;
+a1 = zero;
+if (v0 != at) goto L411a30;
+L4119d8:
+//nop;
+// fdead 400001ef t9 = t9;
+//nop;
+temp64 = func_411750(mem, sp, a0, a1, a2, a3);
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+// bdead 4000001b gp = MEM_U32(sp + 24);
+MEM_U32(sp + 32) = v0;
+MEM_U32(sp + 36) = v1;
+//nop;
+// fdead 6000001f t9 = t9;
+//nop;
+func_411388(mem, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x2c;
+t6 = 0x100142b0;
+t6 = MEM_U8(t6 + 0);
+//nop;
+if (t6 != at) goto L411a58;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+goto L411a58;
+L411a30:
+//nop;
+a0 = 0x1000ff5c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L411a58:
+//nop;
+a0 = MEM_U32(sp + 32);
+a1 = MEM_U32(sp + 36);
+a2 = 0x0;
+a3 = 0x20;
+temp64 = wrapper___ull_rshift((((uint64_t)a0 << 32) | (uint64_t)a1), (((uint64_t)a2 << 32) | (uint64_t)a3));
+v0 = (uint32_t)(temp64 >> 32);
+v1 = (uint32_t)temp64;
+t8 = MEM_U32(sp + 40);
+// bdead 42000013 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 0) = v1;
+t2 = MEM_U32(sp + 44);
+t9 = MEM_U32(sp + 36);
+MEM_U32(t2 + 0) = t9;
+t3 = MEM_U32(sp + 40);
+// bdead 40001003 ra = MEM_U32(sp + 28);
+a0 = MEM_U32(t3 + 0);
+v0 = zero < a0;
+//nop;
+if (v0 == 0) goto L411abc;
+v0 = a0 + 0x1;
+v0 = zero < v0;
+t4 = MEM_U32(sp + 44);
+if (v0 != 0) goto L411abc;
+v0 = MEM_U32(t4 + 0);
+v0 = (int)v0 < (int)0x0;
+v0 = v0 ^ 0x1;
+L411abc:
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static void f_GetBaseOrExpr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L411ac4:
+//GetBaseOrExpr:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+t7 = 0x100142b0;
+// fdead 400100eb MEM_U32(sp + 28) = ra;
+// fdead 400100eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(a0 + 0) = zero;
+t7 = MEM_U8(t7 + 0);
+at = 0x28;
+//nop;
+if (t7 != at) goto L411bb8;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+at = 0x69;
+t8 = 0x100142b0;
+t8 = MEM_U8(t8 + 0);
+//nop;
+if (t8 != at) goto L411ba4;
+//nop;
+a0 = 0x100142b8;
+a1 = MEM_U32(sp + 32);
+//nop;
+v0 = f_LookUp(mem, sp, a0, a1);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+if (v0 == 0) goto L411ba4;
+t9 = MEM_U32(sp + 32);
+t0 = MEM_U32(t9 + 0);
+t1 = MEM_U32(t0 + 16);
+//nop;
+if (t1 != 0) goto L411ba4;
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+at = 0x29;
+a1 = zero;
+t2 = 0x100142b0;
+t2 = MEM_U8(t2 + 0);
+//nop;
+if (t2 == at) goto L411b90;
+//nop;
+a0 = 0x1000ff7c;
+a2 = 0x1;
+a0 = a0;
+f_posterror(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L411b90:
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L411bd0;
+L411ba4:
+//nop;
+a0 = 0x28;
+//nop;
+f_unscan(mem, sp, a0);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L411bb8:
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t3 = MEM_U32(sp + 36);
+// bdead 1009 gp = MEM_U32(sp + 24);
+MEM_U32(t3 + 0) = v0;
+L411bd0:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L411be0:
+//GetItem:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+v0 = f_GetExpr(mem, sp);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 32);
+at = 0x3a;
+t7 = 0x100142b0;
+MEM_U32(t6 + 0) = v0;
+t0 = MEM_U32(sp + 36);
+t7 = MEM_U8(t7 + 0);
+if (t7 != at) {
+t9 = 0x1;
+goto L411c5c;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t8 = MEM_U32(sp + 36);
+// bdead 2000009 gp = MEM_U32(sp + 24);
+MEM_U32(t8 + 0) = v0;
+goto L411c60;
+t9 = 0x1;
+L411c5c:
+MEM_U32(t0 + 0) = t9;
+L411c60:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_dw_GetItem(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L411c70:
+//dw_GetItem:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a2;
+v0 = f_dw_GetExpr(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+at = 0x3a;
+t9 = MEM_U32(sp + 40);
+t6 = 0x100142b0;
+t6 = MEM_U8(t6 + 0);
+if (t6 != at) {
+t8 = 0x1;
+goto L411ce0;}
+//nop;
+//nop;
+f_nexttoken(mem, sp, a0, a1, a2, a3);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+//nop;
+//nop;
+v0 = f_GetExpr(mem, sp);
+t7 = MEM_U32(sp + 40);
+// bdead 10009 gp = MEM_U32(sp + 24);
+MEM_U32(t7 + 0) = v0;
+goto L411ce4;
+t8 = 0x1;
+L411ce0:
+MEM_U32(t9 + 0) = t8;
+L411ce4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_put_binasmfyle(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L411cf4:
+//put_binasmfyle:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a5c;
+sp = sp + 0xffffffd8;
+// fdead 400081eb MEM_U32(sp + 36) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 32) = gp;
+//nop;
+if (t6 == 0) goto L411da8;
+t0 = 0x10013a68;
+t1 = 0x10013a64;
+a2 = 0x10;
+t7 = MEM_U32(t0 + 4);
+v1 = MEM_U32(t1 + 0);
+a1 = v1;
+if (v1 < t7) goto L411d68;
+//nop;
+a0 = 0x10013a68;
+a3 = MEM_U32(t0 + 0);
+MEM_U32(sp + 16) = zero;
+a0 = a0 + 0x4;
+v0 = f_grow_array(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 32);
+t0 = 0x10013a68;
+t1 = 0x10013a64;
+MEM_U32(t0 + 0) = v0;
+v1 = MEM_U32(t1 + 0);
+L411d68:
+t3 = 0x10015350;
+t8 = MEM_U32(t0 + 0);
+t9 = v1 << 4;
+t5 = MEM_U32(t3 + 0);
+t2 = t8 + t9;
+MEM_U32(t2 + 0) = t5;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t2 + 4) = t4;
+t5 = MEM_U32(t3 + 8);
+MEM_U32(t2 + 8) = t5;
+t4 = MEM_U32(t3 + 12);
+MEM_U32(t2 + 12) = t4;
+t6 = MEM_U32(t1 + 0);
+t7 = t6 + 0x1;
+MEM_U32(t1 + 0) = t7;
+goto L411df4;
+L411da8:
+//nop;
+a3 = 0x10015360;
+a0 = 0x10015350;
+a1 = 0x10;
+a2 = 0x1;
+a3 = MEM_U32(a3 + 0);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+a1 = zero;
+a2 = 0x10;
+//nop;
+a0 = 0x10015350;
+//nop;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 1 gp = MEM_U32(sp + 32);
+v1 = 0x10013a30;
+t8 = MEM_U32(v1 + 0);
+t9 = t8 + 0x1;
+MEM_U32(v1 + 0) = t9;
+L411df4:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+//nop;
+//nop;
+//nop;
+}
+
+static void f_ltoa(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L411e70:
+//ltoa:
+//nop;
+//nop;
+//nop;
+a2 = a0;
+//nop;
+a0 = a1;
+a1 = 0x100112f0;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L411eb4:
+//st_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x100112f4;
+a0 = 0xfb4ee44;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011300;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_warning(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0, a2 = 0, a3 = 0;
+L411f7c:
+//st_warning:
+//nop;
+//nop;
+//nop;
+// fdead 2b sp = sp + 0xffffffd8;
+//nop;
+// fdead 2b MEM_U32(sp + 40) = a0;
+// fdead 2b MEM_U32(sp + 44) = a1;
+a1 = 0x10011304;
+a0 = 0xfb4ee44;
+// fdead 6b MEM_U32(sp + 36) = ra;
+// fdead 6b MEM_U32(sp + 32) = gp;
+// fdead 6b MEM_U32(sp + 48) = a2;
+// fdead 6b MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+a0 = 0x2;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// fdead 1b gp = MEM_U32(sp + 32);
+// fdead 1b t6 = MEM_U32(sp + 52);
+// fdead 1b t7 = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+// fdead 3b a1 = MEM_U32(sp + 40);
+// fdead 3b a2 = MEM_U32(sp + 44);
+// fdead 3b a3 = MEM_U32(sp + 48);
+// fdead 3b MEM_U32(sp + 16) = t6;
+// fdead 3b MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011310;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// fdead b ra = MEM_U32(sp + 36);
+// fdead b gp = MEM_U32(sp + 32);
+// fdead b sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L4120c8:
+//st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+a1 = 0x10011314;
+a0 = 0xfb4ee44;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 48) = a2;
+MEM_U32(sp + 52) = a3;
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 32);
+a0 = zero;
+//nop;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011320;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void func_4121b0(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4121b0:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a44;
+sp = sp + 0xffffffe0;
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+a3 = a1;
+if (t6 == 0) goto L412238;
+at = 0x3;
+//nop;
+if (a1 == at) goto L412228;
+t7 = 0x10013284;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 == 0) goto L412238;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011358;
+MEM_U32(sp + 36) = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+at = 0x10013284;
+MEM_U32(at + 0) = zero;
+goto L412238;
+L412228:
+t8 = 0x10013284;
+t8 = MEM_U32(t8 + 0);
+if (t8 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412344;}
+L412238:
+v1 = 0x10014ac4;
+v0 = MEM_U32(v1 + 0);
+if ((int)v0 >= (int)a3) {
+MEM_U32(v1 + 0) = a3;
+goto L412258;}
+MEM_U32(v1 + 0) = v0;
+goto L412258;
+// fdead 0 MEM_U32(v1 + 0) = a3;
+L412258:
+at = 0x3;
+if (a3 == at) {
+v0 = 0x1;
+goto L412294;}
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x1001135c;
+a2 = 0x10011360;
+MEM_U32(sp + 36) = a3;
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = a2;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+v0 = 0x1;
+L412294:
+at = 0x3;
+if (a3 != v0) goto L4122a8;
+at = 0x10013a48;
+MEM_U32(at + 0) = zero;
+goto L4122bc;
+L4122a8:
+//nop;
+if (a3 != at) goto L4122bc;
+at = 0x10013284;
+MEM_U32(at + 0) = v0;
+goto L412340;
+L4122bc:
+t0 = 0x10013288;
+t9 = a3 << 2;
+a0 = 0xfb4ee44;
+t0 = t0;
+t1 = t9 + t0;
+//nop;
+a1 = 0x10011368;
+a2 = MEM_U32(t1 + 0);
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+t2 = MEM_U32(sp + 32);
+// bdead 40000901 gp = MEM_U32(sp + 24);
+t3 = MEM_U8(t2 + 0);
+//nop;
+if (t3 == 0) goto L41231c;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011370;
+a2 = t2;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000101 gp = MEM_U32(sp + 24);
+L41231c:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011374;
+a2 = 0x10013ea4;
+a0 = a0 + 0x20;
+a1 = a1;
+a2 = MEM_U32(a2 + 0);
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+L412340:
+// bdead 1 ra = MEM_U32(sp + 28);
+L412344:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void func_412350(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L412350:
+//nop;
+//nop;
+//nop;
+v0 = 0x10013280;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+v0 = v0;
+t6 = MEM_U32(v0 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+a2 = a0;
+//nop;
+if (t6 == 0) goto L412388;
+MEM_U8(a0 + 0) = (uint8_t)zero;
+goto L4123e4;
+L412388:
+a0 = 0x10013ea0;
+t7 = 0x1;
+MEM_U32(v0 + 0) = t7;
+a0 = MEM_U32(a0 + 0);
+at = 0xffffffff;
+if (a0 == at) {
+MEM_U8(a2 + 0) = (uint8_t)zero;
+goto L4123e0;}
+//nop;
+MEM_U32(sp + 32) = a2;
+//nop;
+v0 = f_st_str_idn(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 32);
+a1 = v0;
+//nop;
+//nop;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 3 gp = MEM_U32(sp + 24);
+v0 = 0x10013280;
+v0 = v0;
+goto L4123e0;
+// fdead 0 MEM_U8(a2 + 0) = (uint8_t)zero;
+L4123e0:
+MEM_U32(v0 + 0) = zero;
+L4123e4:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_call_name_and_line(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+L4123f4:
+//call_name_and_line:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffbe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 1056) = a0;
+// fdead 400001eb t9 = t9;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x20;
+func_412350(mem, sp, a0, a1, a2, a3);
+// bdead 40000081 gp = MEM_U32(sp + 24);
+a0 = sp + 0x20;
+a1 = MEM_U32(sp + 1056);
+//nop;
+// fdead 6000006b t9 = t9;
+//nop;
+func_4121b0(mem, sp, a0, a1);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x420;
+//nop;
+return;
+}
+
+static void f_call_perror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L412450:
+//call_perror:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+//nop;
+//nop;
+wrapper_perror(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+v0 = wrapper_fflush(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_new_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L4124b0:
+//new_error:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000014b MEM_U32(sp + 28) = ra;
+// fdead 4000014b MEM_U32(sp + 24) = gp;
+a0 = 0x1;
+a1 = zero;
+f_call_perror(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+v0 = wrapper_fflush(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_posterror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412500:
+//posterror:
+//nop;
+//nop;
+//nop;
+t6 = 0x10013a38;
+sp = sp + 0xffffffe0;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+if (t6 == 0) goto L41254c;
+v1 = 0x10014ac4;
+v0 = MEM_U32(v1 + 0);
+if ((int)v0 >= (int)a2) {
+MEM_U32(v1 + 0) = a2;
+goto L41254c;}
+MEM_U32(v1 + 0) = v0;
+goto L41254c;
+// fdead 0 MEM_U32(v1 + 0) = a2;
+L41254c:
+//nop;
+if ((int)a2 < (int)0x2) goto L412568;
+t7 = 0x10013a34;
+t7 = MEM_U32(t7 + 0);
+if (t7 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412634;}
+L412568:
+//nop;
+a0 = a2;
+//nop;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011380;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+a2 = MEM_U32(sp + 36);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+//nop;
+if (a2 == 0) goto L4125c8;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011384;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+goto L4125e4;
+L4125c8:
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x1001138c;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+L4125e4:
+t8 = 0x10014ac0;
+t8 = MEM_U32(t8 + 0);
+if (t8 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412634;}
+t9 = 0x10013a78;
+t9 = MEM_U32(t9 + 0);
+if ((int)t9 <= 0) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412634;}
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011390;
+a2 = 0x10013a80;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+t0 = 0x1;
+at = 0x10014ac0;
+MEM_U32(at + 0) = t0;
+// bdead 1 ra = MEM_U32(sp + 28);
+L412634:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_postcerror(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L412640:
+//postcerror:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a1;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+a2 = MEM_U32(sp + 32);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+if (a2 == zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L412698;}
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x1001139c;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 ra = MEM_U32(sp + 28);
+L412698:
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static void f_assertion_failed(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0;
+L4126a4:
+//assertion_failed:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 40) = a2;
+a0 = zero;
+f_call_name_and_line(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a3 = MEM_U32(sp + 40);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x100113a0;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+a2 = MEM_U32(sp + 32);
+// bdead 40000181 gp = MEM_U32(sp + 24);
+//nop;
+if (a2 == 0) goto L412724;
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x100113b0;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L412724:
+//nop;
+a0 = 0xfb4ee44;
+a0 = a0 + 0x20;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_which_opt(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+L41275c:
+//which_opt:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 4000006b MEM_U32(sp + 36) = s3;
+// fdead 4000006b MEM_U32(sp + 32) = s2;
+// fdead 4000006b MEM_U32(sp + 28) = s1;
+// fdead 4000006b MEM_U32(sp + 24) = s0;
+s2 = a0;
+// fdead 4008006b MEM_U32(sp + 44) = ra;
+// fdead 4008006b MEM_U32(sp + 40) = gp;
+s0 = zero;
+s1 = 0x1001329c;
+s3 = 0x6e;
+L412794:
+//nop;
+a0 = s2;
+a1 = MEM_U32(s1 + 0);
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 401e0001 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L4127b8;
+v0 = s0;
+goto L4127c8;
+L4127b8:
+s0 = s0 + 0x1;
+s1 = s1 + 0x4;
+if (s0 != s3) goto L412794;
+v0 = 0x6d;
+L4127c8:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 s2 = MEM_U32(sp + 32);
+// bdead 9 s3 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static uint32_t f_grow_array(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t2 = 0, t6 = 0, t7 = 0, s0 = 0,
+t8 = 0, t9 = 0, lo = 0, hi = 0;
+L4127e4:
+//grow_array:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 60) = a3;
+v0 = MEM_U32(a0 + 0);
+s0 = a0;
+at = a1 < 0x400;
+//nop;
+if (v0 != 0) goto L41289c;
+t7 = 0x400;
+if (at != 0) goto L41282c;
+t6 = a1 + 0x1;
+MEM_U32(a0 + 0) = t6;
+goto L412830;
+L41282c:
+MEM_U32(s0 + 0) = t7;
+L412830:
+t8 = MEM_U32(s0 + 0);
+//nop;
+lo = t8 * a2; hi = (uint32_t)((uint64_t)t8 * (uint64_t)a2 >> 32);
+a0 = lo;
+MEM_U32(sp + 36) = a0;
+//nop;
+v0 = f_xmalloc(mem, sp, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a3 = MEM_U32(sp + 36);
+s0 = v0;
+if (v0 != 0) goto L412870;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 24);
+goto L412930;
+L412870:
+t9 = MEM_U32(sp + 64);
+if (t9 == zero) {
+// bdead 20001 ra = MEM_U32(sp + 28);
+goto L412934;}
+//nop;
+a0 = s0;
+a1 = zero;
+a2 = a3;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 9 gp = MEM_U32(sp + 24);
+s0 = v0;
+goto L412930;
+L41289c:
+lo = v0 * a2; hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+t0 = v0 << 1;
+at = a1 < t0;
+MEM_U32(s0 + 0) = t0;
+v0 = t0;
+v1 = lo;
+//nop;
+if (at != 0) goto L4128c4;
+v0 = a1 + 0x1;
+MEM_U32(s0 + 0) = v0;
+L4128c4:
+lo = v0 * a2; hi = (uint32_t)((uint64_t)v0 * (uint64_t)a2 >> 32);
+//nop;
+a0 = MEM_U32(sp + 60);
+MEM_U32(sp + 40) = v1;
+a1 = lo;
+MEM_U32(sp + 36) = a1;
+//nop;
+v0 = f_xrealloc(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 40);
+a3 = MEM_U32(sp + 36);
+s0 = v0;
+if (v0 != 0) goto L41290c;
+//nop;
+//nop;
+f_new_error(mem, sp, a0, a1, a2, a3);
+// bdead 20001 gp = MEM_U32(sp + 24);
+goto L412930;
+L41290c:
+t2 = MEM_U32(sp + 64);
+if (t2 == zero) {
+// bdead 20001 ra = MEM_U32(sp + 28);
+goto L412934;}
+//nop;
+a0 = s0 + v1;
+a1 = zero;
+a2 = a3 - v1;
+v0 = wrapper_memset(mem, a0, a1, a2);
+// bdead 20001 gp = MEM_U32(sp + 24);
+L412930:
+// bdead 20001 ra = MEM_U32(sp + 28);
+L412934:
+v0 = s0;
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+return v0;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_st_symadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L412960:
+//st_symadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+t6 = 0x10015540;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 44) = a3;
+t7 = MEM_U32(t6 + 4);
+s0 = a2;
+//nop;
+if (t7 != 0) goto L4129b4;
+//nop;
+a0 = 0x10013460;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400201c3 gp = MEM_U32(sp + 24);
+L4129b4:
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+if (v1 != zero) {
+t8 = MEM_U32(v1 + 60);
+goto L4129e4;}
+//nop;
+a0 = 0x1001349c;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400201c3 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t8 = MEM_U32(v1 + 60);
+L4129e4:
+t9 = t8 & 0x2;
+if (t9 == zero) {
+t0 = MEM_U32(v1 + 0);
+goto L412a10;}
+//nop;
+a0 = 0x100134d0;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40020003 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t0 = MEM_U32(v1 + 0);
+L412a10:
+t1 = MEM_U32(v1 + 8);
+a1 = v1 + 0x8;
+a0 = MEM_U32(t0 + 20);
+if ((int)a0 < (int)t1) {
+t4 = MEM_U32(v1 + 4);
+goto L412a60;}
+//nop;
+a0 = MEM_U32(v1 + 4);
+a2 = 0xc;
+a3 = 0x40;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40020009 gp = MEM_U32(sp + 24);
+t2 = 0x1001553c;
+v1 = 0x1001553c;
+t2 = MEM_U32(t2 + 0);
+MEM_U32(t2 + 4) = v0;
+v1 = MEM_U32(v1 + 0);
+t3 = MEM_U32(v1 + 0);
+a0 = MEM_U32(t3 + 20);
+t4 = MEM_U32(v1 + 4);
+L412a60:
+t5 = a0 << 2;
+t5 = t5 - a0;
+t6 = MEM_U32(sp + 32);
+t5 = t5 << 2;
+v0 = t4 + t5;
+t1 = MEM_U8(v0 + 8);
+MEM_U32(v0 + 0) = t6;
+t7 = MEM_U32(sp + 36);
+t0 = s0 << 2;
+t2 = t1 & 0xff03;
+t3 = t0 | t2;
+MEM_U8(v0 + 8) = (uint8_t)t3;
+MEM_U32(v0 + 4) = t7;
+t5 = MEM_U32(sp + 44);
+t8 = MEM_U16(v0 + 8);
+at = 0xf0000;
+t6 = t5 << 5;
+t7 = t6 & 0x3e0;
+t9 = t8 & 0xfc1f;
+t1 = t7 | t9;
+MEM_U16(v0 + 8) = (uint16_t)t1;
+t0 = MEM_U8(v0 + 9);
+at = at | 0xffff;
+t2 = t0 & 0xffef;
+MEM_U8(v0 + 9) = (uint8_t)t2;
+t3 = MEM_U32(sp + 48);
+a1 = MEM_U32(v0 + 8);
+t4 = t3 & at;
+t5 = t4 ^ a1;
+t6 = t5 << 12;
+t8 = t6 >> 12;
+at = 0xe;
+t7 = t8 ^ a1;
+MEM_U32(v0 + 8) = t7;
+if (s0 == at) goto L412b08;
+at = 0x2;
+if (s0 == at) {
+at = 0x5;
+goto L412b08;}
+at = 0x5;
+if (s0 == at) {
+at = 0x6;
+goto L412b08;}
+at = 0x6;
+//nop;
+if (s0 != at) goto L412b20;
+L412b08:
+t9 = 0x1001553c;
+t9 = MEM_U32(t9 + 0);
+v1 = MEM_U32(t9 + 0);
+t1 = MEM_U8(v1 + 60);
+t0 = t1 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t0;
+L412b20:
+t2 = 0x1001553c;
+t2 = MEM_U32(t2 + 0);
+v1 = MEM_U32(t2 + 0);
+v0 = MEM_U32(v1 + 20);
+t3 = v0 + 0x1;
+MEM_U32(v1 + 20) = t3;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifd_pcfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412b4c:
+//st_ifd_pcfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+if (t7 != 0) goto L412b90;
+//nop;
+a0 = 0x10013460;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+L412b90:
+t8 = 0x1001553c;
+t8 = MEM_U32(t8 + 0);
+//nop;
+if (t8 != 0) goto L412bb4;
+//nop;
+a0 = 0x1001349c;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L412bb4:
+t0 = 0x10015540;
+t9 = MEM_U32(sp + 32);
+// bdead 4000201 ra = MEM_U32(sp + 28);
+t0 = MEM_U32(t0 + 0);
+t1 = MEM_U32(t0 + 4);
+// bdead 4000401 sp = sp + 0x20;
+v0 = t9 - t1;
+v0 = (int)v0 >> 6;
+return v0;
+}
+
+static uint32_t f_st_pcfd_ifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412bd8:
+//st_pcfd_ifd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+if (t7 != 0) goto L412c24;
+//nop;
+a0 = 0x10013460;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+L412c24:
+//nop;
+if ((int)a1 < 0) goto L412c44;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t8 = MEM_U32(v1 + 12);
+if ((int)a1 < (int)t8) {
+// bdead 51 ra = MEM_U32(sp + 28);
+goto L412c6c;}
+L412c44:
+//nop;
+a0 = 0x10011760;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+// bdead 51 ra = MEM_U32(sp + 28);
+L412c6c:
+t9 = MEM_U32(v1 + 4);
+t0 = a1 << 6;
+// bdead 4000201 sp = sp + 0x20;
+v0 = t9 + t0;
+return v0;
+}
+
+static uint32_t f_st_psym_ifd_isym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412c80:
+//st_psym_ifd_isym:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffd8;
+// fdead 400080eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 24) = gp;
+a3 = a0;
+t7 = MEM_U32(t6 + 4);
+a2 = a1;
+if (t7 != zero) {
+at = 0x7fff0000;
+goto L412cdc;}
+//nop;
+a0 = 0x10013460;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+at = 0x7fff0000;
+L412cdc:
+at = at | 0xffff;
+//nop;
+if (a3 != at) goto L412d04;
+//nop;
+a0 = a2;
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+v0 = v0 + 0x4;
+goto L412d98;
+L412d04:
+a1 = a3;
+if ((int)a3 < 0) goto L412d4c;
+//nop;
+if ((int)a2 < 0) goto L412d4c;
+v0 = 0x10015540;
+v0 = MEM_U32(v0 + 0);
+t8 = MEM_U32(v0 + 12);
+//nop;
+if ((int)a3 >= (int)t8) goto L412d4c;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+t2 = MEM_U32(t1 + 20);
+if ((int)a2 < (int)t2) {
+t7 = MEM_U32(v1 + 4);
+goto L412d88;}
+L412d4c:
+//nop;
+a0 = 0x10011784;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 44);
+t4 = 0x10015540;
+t4 = MEM_U32(t4 + 0);
+t5 = MEM_U32(t4 + 4);
+v1 = t5 + t6;
+t7 = MEM_U32(v1 + 4);
+L412d88:
+t8 = a2 << 2;
+t8 = t8 - a2;
+t8 = t8 << 2;
+v0 = t7 + t8;
+L412d98:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_paux_iaux(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L412da8:
+//st_paux_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+if (t7 != 0) goto L412dec;
+//nop;
+a0 = 0x10013460;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+L412dec:
+t8 = 0x1001553c;
+t8 = MEM_U32(t8 + 0);
+if (t8 != zero) {
+t9 = MEM_U32(sp + 32);
+goto L412e14;}
+//nop;
+a0 = 0x1001349c;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 24);
+t9 = MEM_U32(sp + 32);
+L412e14:
+//nop;
+if ((int)t9 < 0) goto L412e38;
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t0 = MEM_U32(v1 + 0);
+t1 = MEM_U32(t0 + 48);
+if ((int)t9 < (int)t1) {
+t3 = MEM_U32(sp + 32);
+goto L412e5c;}
+L412e38:
+//nop;
+a0 = 0x100117bc;
+a1 = MEM_U32(sp + 32);
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t3 = MEM_U32(sp + 32);
+L412e5c:
+// bdead 1011 ra = MEM_U32(sp + 28);
+t2 = MEM_U32(v1 + 12);
+t4 = t3 << 2;
+// bdead 2801 sp = sp + 0x20;
+v0 = t2 + t4;
+return v0;
+}
+
+static uint32_t f_st_str_ifd_iss(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L412e74:
+//st_str_ifd_iss:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+a2 = a0;
+t7 = MEM_U32(t6 + 4);
+if (t7 != zero) {
+at = 0x7fff0000;
+goto L412ecc;}
+//nop;
+a0 = 0x10013460;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 32) = a2;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 32);
+at = 0x7fff0000;
+L412ecc:
+at = at | 0xffff;
+//nop;
+if (a2 != at) goto L412ef0;
+//nop;
+a0 = a1;
+//nop;
+v0 = f__md_st_str_extiss(mem, sp, a0);
+// bdead 9 gp = MEM_U32(sp + 24);
+goto L412f34;
+L412ef0:
+//nop;
+a0 = a2;
+MEM_U32(sp + 36) = a1;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+a1 = MEM_U32(sp + 36);
+// bdead 200004b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(t8 + 12);
+at = (int)a1 < (int)v1;
+if (v1 == 0) goto L412f30;
+if ((int)a1 >= (int)v1) {
+v0 = zero;
+goto L412f34;}
+t9 = MEM_U32(v0 + 20);
+v0 = t9 + a1;
+goto L412f34;
+L412f30:
+v0 = zero;
+L412f34:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_cuinit(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, v1 = 0, a0 = 0, a1 = 0, t6 = 0;
+L413020:
+//st_cuinit:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+a0 = 0xbc;
+a1 = 0x1;
+v0 = wrapper_calloc(mem, a0, a1);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+v1 = v0;
+a1 = 0x10015540;
+MEM_U32(a1 + 0) = v0;
+if (v0 != 0) goto L413078;
+//nop;
+a0 = 0x100117f0;
+a0 = a0;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+a1 = 0x10015540;
+v1 = MEM_U32(a1 + 0);
+L413078:
+t6 = 0x2;
+MEM_U32(v1 + 60) = t6;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 v0 = MEM_U32(a1 + 0);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_extadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L413094:
+//st_extadd:
+//nop;
+//nop;
+//nop;
+t0 = 0x10015540;
+sp = sp + 0xffffffd8;
+// fdead 400003eb MEM_U32(sp + 20) = s0;
+t0 = MEM_U32(t0 + 0);
+s0 = a3;
+// fdead 400203eb MEM_U32(sp + 28) = ra;
+// fdead 400203eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+if (t0 != 0) goto L4130e8;
+//nop;
+a0 = 0x1001181c;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40020183 gp = MEM_U32(sp + 24);
+t0 = 0x10015540;
+t0 = MEM_U32(t0 + 0);
+L4130e8:
+a0 = MEM_U32(t0 + 28);
+t6 = MEM_U32(t0 + 32);
+a1 = t0 + 0x20;
+if ((int)a0 < (int)t6) {
+t8 = MEM_U32(t0 + 24);
+goto L413134;}
+//nop;
+a0 = MEM_U32(t0 + 24);
+a2 = 0x10;
+a3 = 0x20;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400201c9 gp = MEM_U32(sp + 24);
+t7 = 0x10015540;
+t0 = 0x10015540;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(t7 + 24) = v0;
+t0 = MEM_U32(t0 + 0);
+a0 = MEM_U32(t0 + 28);
+t8 = MEM_U32(t0 + 24);
+L413134:
+t9 = a0 << 4;
+v1 = t8 + t9;
+//nop;
+MEM_U32(sp + 36) = v1;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(sp + 36);
+// bdead 40020199 gp = MEM_U32(sp + 24);
+at = 0xf0000;
+t1 = MEM_U8(v1 + 0);
+MEM_U16(v1 + 2) = (uint16_t)v0;
+at = at | 0xffff;
+t3 = t1 & 0xff7f;
+t5 = t3 & 0xbf;
+t7 = t5 & 0xdf;
+MEM_U8(v1 + 0) = (uint8_t)t3;
+t9 = t7 & 0xef;
+MEM_U8(v1 + 0) = (uint8_t)t5;
+MEM_U8(v1 + 0) = (uint8_t)t7;
+t1 = t9 & 0xf7;
+MEM_U8(v1 + 0) = (uint8_t)t9;
+MEM_U8(v1 + 0) = (uint8_t)t1;
+t2 = MEM_U16(v1 + 0);
+t1 = MEM_U8(v1 + 12);
+t3 = t2 & 0xf800;
+MEM_U16(v1 + 0) = (uint16_t)t3;
+t4 = MEM_U32(sp + 40);
+t2 = t1 & 0xff03;
+MEM_U32(v1 + 4) = t4;
+t5 = MEM_U32(sp + 44);
+MEM_U32(v1 + 8) = t5;
+t7 = MEM_U32(sp + 48);
+t5 = s0 << 5;
+t6 = t5 & 0x3e0;
+t9 = t7 << 2;
+t3 = t9 | t2;
+MEM_U8(v1 + 12) = (uint8_t)t3;
+t7 = MEM_U16(v1 + 12);
+t8 = t7 & 0xfc1f;
+t1 = t6 | t8;
+MEM_U16(v1 + 12) = (uint16_t)t1;
+t9 = MEM_U8(v1 + 13);
+t2 = t9 & 0xffef;
+MEM_U8(v1 + 13) = (uint8_t)t2;
+t3 = MEM_U32(sp + 56);
+v0 = MEM_U32(v1 + 12);
+t4 = t3 & at;
+t5 = t4 ^ v0;
+t7 = t5 << 12;
+t6 = t7 >> 12;
+at = 0x12;
+t8 = t6 ^ v0;
+MEM_U32(v1 + 12) = t8;
+if (s0 == at) goto L413254;
+at = 0x11;
+//nop;
+if (s0 == at) goto L413254;
+at = 0x6;
+if (s0 == 0) goto L413254;
+if (s0 == at) {
+at = 0x15;
+goto L413254;}
+at = 0x15;
+//nop;
+if (s0 == at) goto L413254;
+//nop;
+a0 = MEM_U16(v1 + 2);
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 0);
+// bdead 11 gp = MEM_U32(sp + 24);
+t1 = MEM_U8(v1 + 60);
+t9 = t1 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t9;
+L413254:
+t0 = 0x10015540;
+t0 = MEM_U32(t0 + 0);
+v0 = MEM_U32(t0 + 28);
+t2 = v0 + 0x1;
+MEM_U32(t0 + 28) = t2;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_pext_iext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0;
+L41327c:
+//st_pext_iext:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L4132b4;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(v1 + 28);
+if ((int)t6 >= (int)a0) {
+// bdead 51 ra = MEM_U32(sp + 28);
+goto L4132dc;}
+L4132b4:
+//nop;
+a0 = 0x10011854;
+MEM_U32(sp + 32) = a1;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+// bdead 51 ra = MEM_U32(sp + 28);
+L4132dc:
+t7 = MEM_U32(v1 + 24);
+t8 = a1 << 4;
+// bdead 2010001 sp = sp + 0x20;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_idn_index_fext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L4132f0:
+//st_idn_index_fext:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015540;
+sp = sp + 0xffffffc8;
+// fdead 4000007b MEM_U32(sp + 28) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 4000007b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 56) = a0;
+MEM_U32(sp + 60) = a1;
+if (v1 != 0) goto L413338;
+//nop;
+a0 = 0x1001187c;
+a0 = a0;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000103 gp = MEM_U32(sp + 24);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+L413338:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+a2 = 0x8;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L41337c;
+//nop;
+a0 = MEM_U32(v1 + 56);
+MEM_U32(sp + 44) = v0;
+a3 = 0x80;
+v0 = f__md_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400001cb gp = MEM_U32(sp + 24);
+t0 = MEM_U32(sp + 44);
+t7 = 0x10015540;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(t7 + 56) = v0;
+L41337c:
+if (t0 != zero) {
+t1 = MEM_U32(sp + 60);
+goto L4133a4;}
+t8 = 0x10015540;
+//nop;
+a1 = 0x10;
+t8 = MEM_U32(t8 + 0);
+a0 = MEM_U32(t8 + 56);
+wrapper_bzero(mem, a0, a1);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 60);
+L4133a4:
+t9 = MEM_U32(sp + 56);
+t2 = 0x7fff0000;
+MEM_U32(sp + 52) = t9;
+if (t1 == 0) goto L4133c8;
+v1 = 0x10015540;
+t2 = t2 | 0xffff;
+MEM_U32(sp + 48) = t2;
+v1 = MEM_U32(v1 + 0);
+goto L4133e4;
+L4133c8:
+//nop;
+//nop;
+v0 = f__md_st_currentifd(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 48) = v0;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+L4133e4:
+t4 = MEM_U32(v1 + 60);
+t3 = MEM_U32(v1 + 56);
+t7 = sp + 0x30;
+t9 = MEM_U32(t7 + 0);
+t5 = t4 << 3;
+t6 = t3 + t5;
+MEM_U32(t6 + 0) = t9;
+t8 = MEM_U32(t7 + 4);
+v1 = 0x10015540;
+MEM_U32(t6 + 4) = t8;
+v1 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 60);
+t1 = v0 + 0x1;
+MEM_U32(v1 + 60) = t1;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_pdn_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41342c:
+//st_pdn_idn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a1 = a0;
+if ((int)a0 < 0) goto L413464;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(v1 + 60);
+if ((int)t6 >= (int)a0) {
+// bdead 51 ra = MEM_U32(sp + 28);
+goto L413498;}
+L413464:
+t7 = 0x10015540;
+//nop;
+a0 = 0x100118bc;
+t7 = MEM_U32(t7 + 0);
+a0 = a0;
+a2 = MEM_U32(t7 + 60);
+MEM_U32(sp + 32) = a1;
+f__md_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 32);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+// bdead 51 ra = MEM_U32(sp + 28);
+L413498:
+t8 = MEM_U32(v1 + 56);
+t9 = a1 << 3;
+// bdead 6000001 sp = sp + 0x20;
+v0 = t8 + t9;
+return v0;
+//nop;
+}
+
+static void f__md_st_internal(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0, t6 = 0, t7 = 0;
+L4134b0:
+//_md_st_internal:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 48) = a2;
+a2 = 0x10013580;
+a1 = 0x10011900;
+a0 = 0xfb4ee44;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+MEM_U32(sp + 52) = a3;
+a2 = MEM_U32(a2 + 0);
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011910;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f__md_st_error(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0, t6 = 0, t7 = 0;
+L41356c:
+//_md_st_error:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+//nop;
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+// fdead 4000006b MEM_U32(sp + 48) = a2;
+a2 = 0x10013580;
+a1 = 0x10011914;
+a0 = 0xfb4ee44;
+// fdead 400000eb MEM_U32(sp + 36) = ra;
+// fdead 400000eb MEM_U32(sp + 32) = gp;
+// fdead 400000eb MEM_U32(sp + 52) = a3;
+a2 = MEM_U32(a2 + 0);
+a1 = a1;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+t6 = MEM_U32(sp + 52);
+t7 = MEM_U32(sp + 56);
+//nop;
+a0 = 0xfb4ee44;
+a1 = MEM_U32(sp + 40);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 48);
+MEM_U32(sp + 16) = t6;
+MEM_U32(sp + 20) = t7;
+a0 = a0 + 0x20;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000181 gp = MEM_U32(sp + 32);
+//nop;
+a0 = 0xfb4ee44;
+a1 = 0x10011920;
+a0 = a0 + 0x20;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_fprintf(mem, a0, a1, sp);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+a0 = 0x1;
+//nop;
+//nop;
+wrapper_exit(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 gp = MEM_U32(sp + 32);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f__md_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L413628:
+//_md_st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L413660;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(v1 + 40);
+//nop;
+if ((int)a0 >= (int)t6) goto L413660;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L413660:
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t v0 = 0;
+L413734:
+//_md_st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x1001553c;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+a0 = MEM_U32(a0 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+//nop;
+if (a0 != 0) goto L413764;
+v0 = 0xffffffff;
+goto L413774;
+L413764:
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+L413774:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f__md_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L413784:
+//_md_st_malloc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+//nop;
+if (v0 == 0) goto L4137cc;
+at = 0xffffffff;
+if (a0 == 0) goto L4137cc;
+t0 = v0 << 1;
+if (a0 != at) goto L413864;
+L4137cc:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L41380c;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L413804;
+//nop;
+a0 = 0x10011924;
+a0 = a0;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+L413804:
+v0 = s1;
+goto L4138bc;
+L41380c:
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U32(sp + 48);
+//nop;
+lo = t6 * t7; hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4138b8;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(sp + 48);
+lo = t8 * t9; hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+a1 = lo;
+if (a1 == zero) {
+v0 = s1;
+goto L4138bc;}
+//nop;
+a0 = 0x10011964;
+a0 = a0;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+goto L4138b8;
+L413864:
+MEM_U32(s0 + 0) = t0;
+t2 = MEM_U32(sp + 48);
+//nop;
+a0 = s1;
+lo = t0 * t2; hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L4138b8;
+t3 = MEM_U32(s0 + 0);
+t4 = MEM_U32(sp + 48);
+//nop;
+a0 = 0x100119a8;
+lo = t3 * t4; hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+a0 = a0;
+a1 = lo;
+//nop;
+f__md_st_error(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 32);
+L4138b8:
+v0 = s1;
+L4138bc:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_currentpchdr(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0;
+L413978:
+//st_currentpchdr:
+//nop;
+//nop;
+//nop;
+v0 = 0x10015540;
+v0 = MEM_U32(v0 + 0);
+return v0;
+}
+
+static uint32_t f_st_extstradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+L413c74:
+//st_extstradd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+s1 = 0x10015540;
+// fdead 4004006b MEM_U32(sp + 36) = ra;
+// fdead 4004006b MEM_U32(sp + 32) = gp;
+t6 = MEM_U32(s1 + 0);
+// fdead 4004806b MEM_U32(sp + 28) = s2;
+// fdead 4004806b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 40) = a0;
+if (t6 != 0) goto L413cbc;
+//nop;
+a0 = 0x100119f0;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400401c1 gp = MEM_U32(sp + 32);
+L413cbc:
+t7 = MEM_U32(sp + 40);
+//nop;
+if (t7 != 0) goto L413cdc;
+//nop;
+a0 = 0x10011a2c;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40040001 gp = MEM_U32(sp + 32);
+L413cdc:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+s0 = MEM_U32(s1 + 0);
+// bdead 40060009 gp = MEM_U32(sp + 32);
+s2 = v0 + 0x1;
+v1 = MEM_U32(s0 + 40);
+t8 = MEM_U32(s0 + 44);
+t9 = v1 + v0;
+//nop;
+if ((int)t9 < (int)t8) goto L413d50;
+L413d10:
+//nop;
+a0 = MEM_U32(s0 + 36);
+a1 = s0 + 0x2c;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t0 = MEM_U32(s1 + 0);
+// bdead 400c0209 gp = MEM_U32(sp + 32);
+MEM_U32(t0 + 36) = v0;
+s0 = MEM_U32(s1 + 0);
+v1 = MEM_U32(s0 + 40);
+t1 = MEM_U32(s0 + 44);
+t2 = v1 + s2;
+//nop;
+if ((int)t1 < (int)t2) goto L413d10;
+L413d50:
+//nop;
+t3 = MEM_U32(s0 + 36);
+a1 = MEM_U32(sp + 40);
+a0 = t3 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+s0 = MEM_U32(s1 + 0);
+// bdead a0001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(s0 + 40);
+t4 = v0 + s2;
+MEM_U32(s0 + 40) = t4;
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_str_extiss(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t6 = 0, t7 = 0;
+L413d90:
+//st_str_extiss:
+//nop;
+//nop;
+//nop;
+v0 = zero;
+if ((int)a0 < 0) goto L413dc8;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t6 = MEM_U32(v1 + 40);
+//nop;
+if ((int)a0 >= (int)t6) goto L413dc8;
+t7 = MEM_U32(v1 + 36);
+v0 = t7 + a0;
+return v0;
+L413dc8:
+//nop;
+return v0;
+}
+
+static void f_st_idn_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t5 = 0, t6 = 0,
+t7 = 0, t9 = 0;
+L413dd0:
+//st_idn_dn:
+//nop;
+//nop;
+//nop;
+v1 = 0x10015540;
+// fdead 1fb sp = sp + 0xffffffd8;
+// fdead 1fb MEM_U32(sp + 28) = ra;
+v1 = MEM_U32(v1 + 0);
+// fdead 1fb MEM_U32(sp + 24) = gp;
+// fdead 1fb MEM_U32(sp + 40) = a0;
+// fdead 1fb MEM_U32(sp + 44) = a1;
+if (v1 != 0) goto L413e18;
+//nop;
+a0 = 0x10011a4c;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// fdead 3 gp = MEM_U32(sp + 24);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+L413e18:
+v0 = MEM_U32(v1 + 64);
+t6 = MEM_U32(v1 + 60);
+a1 = v1 + 0x40;
+a2 = 0x8;
+t0 = v0;
+if ((int)t6 < (int)v0) goto L413e64;
+//nop;
+a0 = MEM_U32(v1 + 56);
+// fdead 83ff MEM_U32(sp + 36) = v0;
+a3 = 0x80;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// fdead f gp = MEM_U32(sp + 24);
+// fdead f t0 = MEM_U32(sp + 36);
+t7 = 0x10015540;
+v1 = 0x10015540;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(t7 + 56) = v0;
+v1 = MEM_U32(v1 + 0);
+L413e64:
+if (t0 != zero) {
+t1 = MEM_U32(v1 + 60);
+goto L413e90;}
+//nop;
+a0 = MEM_U32(v1 + 56);
+a1 = 0x10;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// fdead 7 gp = MEM_U32(sp + 24);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+t1 = MEM_U32(v1 + 60);
+L413e90:
+t9 = MEM_U32(v1 + 56);
+// fdead 40187ff t8 = MEM_U32(sp + 40);
+v1 = 0x10015540;
+t2 = t1 << 3;
+t3 = t9 + t2;
+// fdead 4019fff MEM_U32(t3 + 0) = t8;
+v1 = MEM_U32(v1 + 0);
+// fdead 4019fff t4 = MEM_U32(sp + 44);
+t6 = MEM_U32(v1 + 60);
+t5 = MEM_U32(v1 + 56);
+v1 = 0x10015540;
+t7 = t6 << 3;
+t1 = t5 + t7;
+// fdead 401dfff MEM_U32(t1 + 4) = t4;
+v1 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 60);
+t9 = v0 + 0x1;
+MEM_U32(v1 + 60) = t9;
+// fdead 401dfff ra = MEM_U32(sp + 28);
+// fdead 401dfff sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_setidn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t6 = 0,
+t7 = 0, t8 = 0, t9 = 0;
+L41411c:
+//st_setidn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000006b MEM_U32(sp + 28) = ra;
+// fdead 4000006b MEM_U32(sp + 24) = gp;
+a2 = a0;
+if ((int)a0 < 0) goto L414164;
+//nop;
+if ((int)a1 < 0) goto L414164;
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 60);
+if ((int)a0 >= (int)v0) {
+at = (int)a1 < (int)v0;
+goto L414164;}
+if ((int)a1 < (int)v0) {
+v0 = MEM_U32(v1 + 56);
+goto L414194;}
+L414164:
+//nop;
+a0 = 0x10011b40;
+MEM_U32(sp + 36) = a1;
+MEM_U32(sp + 32) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 32);
+v1 = 0x10015540;
+v1 = MEM_U32(v1 + 0);
+v0 = MEM_U32(v1 + 56);
+L414194:
+t8 = a1 << 3;
+t6 = a2 << 3;
+t9 = v0 + t8;
+t1 = MEM_U32(t9 + 0);
+t7 = v0 + t6;
+MEM_U32(t7 + 0) = t1;
+t0 = MEM_U32(t9 + 4);
+MEM_U32(t7 + 4) = t0;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_filebegin(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0, t9 = 0;
+L414384:
+//st_filebegin:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 44) = ra;
+// fdead 400001eb MEM_U32(sp + 36) = s2;
+// fdead 400001eb MEM_U32(sp + 28) = s0;
+s2 = a0;
+// fdead 400801eb MEM_U32(sp + 40) = gp;
+// fdead 400801eb MEM_U32(sp + 32) = s1;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+s0 = zero;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400a0103 gp = MEM_U32(sp + 40);
+if ((int)v0 <= 0) goto L4144f4;
+s1 = 0x100153c0;
+s1 = s1;
+L4143d4:
+//nop;
+a0 = s0;
+a1 = 0x1;
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 400e000b gp = MEM_U32(sp + 40);
+a0 = s2;
+a1 = v0;
+//nop;
+//nop;
+v0 = wrapper_strcmp(mem, a0, a1);
+// bdead 400e01c3 gp = MEM_U32(sp + 40);
+if (v0 != 0) goto L4144d8;
+a0 = MEM_U32(s1 + 0);
+v1 = a0 + 0xffffffff;
+//nop;
+if ((int)v1 < 0) goto L414440;
+t6 = 0x100153bc;
+t7 = v1 << 3;
+t6 = MEM_U32(t6 + 0);
+v0 = t6 + t7;
+L414428:
+t8 = MEM_U32(v0 + 0);
+//nop;
+if (s0 == t8) goto L414440;
+v1 = v1 + 0xffffffff;
+v0 = v0 + 0xfffffff8;
+if ((int)v1 >= 0) goto L414428;
+L414440:
+//nop;
+if ((int)v1 < 0) goto L4144d8;
+v1 = 0x100153bc;
+t9 = a0 << 3;
+v1 = MEM_U32(v1 + 0);
+t0 = v1 + t9;
+t1 = MEM_U32(t0 + -8);
+t2 = a0 + 0xffffffff;
+if (s0 == t1) goto L4144a8;
+L414464:
+MEM_U32(s1 + 0) = t2;
+a0 = t2;
+if ((int)t2 >= 0) goto L414494;
+//nop;
+a0 = 0x10011c40;
+a1 = s2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400e01c1 gp = MEM_U32(sp + 40);
+a0 = MEM_U32(s1 + 0);
+v1 = 0x100153bc;
+v1 = MEM_U32(v1 + 0);
+L414494:
+t3 = a0 << 3;
+t4 = v1 + t3;
+t5 = MEM_U32(t4 + -8);
+if (s0 != t5) {
+t2 = a0 + 0xffffffff;
+goto L414464;}
+L4144a8:
+//nop;
+a0 = s0;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40001 gp = MEM_U32(sp + 40);
+t7 = MEM_U32(s1 + 0);
+t6 = 0x100153bc;
+t8 = t7 << 3;
+t6 = MEM_U32(t6 + 0);
+t9 = t6 + t8;
+v0 = MEM_U32(t9 + -4);
+goto L414608;
+L4144d8:
+//nop;
+s0 = s0 + 0x1;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400e0103 gp = MEM_U32(sp + 40);
+if ((int)s0 < (int)v0) goto L4143d4;
+L4144f4:
+//nop;
+s1 = 0x100153c0;
+a0 = s2;
+a1 = MEM_U32(sp + 52);
+a2 = MEM_U32(sp + 56);
+a3 = MEM_U32(sp + 60);
+s1 = s1;
+f_st_fdadd(mem, sp, a0, a1, a2, a3);
+// bdead 40040003 gp = MEM_U32(sp + 40);
+//nop;
+//nop;
+f_st_feinit(mem, sp);
+// bdead 40040103 gp = MEM_U32(sp + 40);
+t1 = MEM_U32(s1 + 0);
+a2 = 0x8;
+a1 = 0x100153c4;
+a1 = a1;
+t0 = MEM_U32(a1 + 0);
+//nop;
+if ((int)t1 < (int)t0) goto L414568;
+//nop;
+a0 = 0x100153bc;
+a3 = 0x19;
+a0 = MEM_U32(a0 + 0);
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 40);
+at = 0x100153bc;
+MEM_U32(at + 0) = v0;
+L414568:
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4004000b gp = MEM_U32(sp + 40);
+t3 = MEM_U32(s1 + 0);
+t7 = 0xf0000;
+t2 = 0x100153bc;
+t4 = t3 << 3;
+t7 = t7 | 0xffff;
+t2 = MEM_U32(t2 + 0);
+a0 = 0x1;
+a1 = zero;
+t5 = t2 + t4;
+MEM_U32(t5 + 0) = v0;
+//nop;
+MEM_U32(sp + 16) = t7;
+a2 = 0xb;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 4004018b gp = MEM_U32(sp + 40);
+a0 = v0;
+a1 = zero;
+//nop;
+//nop;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 40009 gp = MEM_U32(sp + 40);
+t8 = MEM_U32(s1 + 0);
+a1 = 0x100153bc;
+t9 = t8 << 3;
+a1 = a1;
+t6 = MEM_U32(a1 + 0);
+t0 = t6 + t9;
+MEM_U32(t0 + 4) = v0;
+a0 = MEM_U32(s1 + 0);
+t1 = MEM_U32(a1 + 0);
+t3 = a0 << 3;
+t2 = t1 + t3;
+v0 = MEM_U32(t2 + 4);
+t4 = a0 + 0x1;
+MEM_U32(s1 + 0) = t4;
+L414608:
+// bdead 9 ra = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 32);
+// bdead 9 s2 = MEM_U32(sp + 36);
+// bdead 9 sp = sp + 0x30;
+return v0;
+}
+
+static void f_st_endallfiles(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0,
+t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0,
+s1 = 0, s2 = 0, s3 = 0, s4 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L414620:
+//st_endallfiles:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffb8;
+//nop;
+// fdead 4000000b MEM_U32(sp + 52) = ra;
+// fdead 4000000b MEM_U32(sp + 48) = gp;
+// fdead 4000000b MEM_U32(sp + 44) = s4;
+// fdead 4000000b MEM_U32(sp + 40) = s3;
+// fdead 4000000b MEM_U32(sp + 36) = s2;
+// fdead 4000000b MEM_U32(sp + 32) = s1;
+// fdead 4000000b MEM_U32(sp + 28) = s0;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4000000b gp = MEM_U32(sp + 48);
+MEM_U32(sp + 56) = v0;
+s1 = zero;
+//nop;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 400401c3 gp = MEM_U32(sp + 48);
+if ((int)v0 <= 0) goto L414790;
+s4 = 0xc;
+s3 = 0x8;
+s2 = 0xffffffff;
+L414680:
+//nop;
+a0 = s1;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 4);
+// bdead 403c01db gp = MEM_U32(sp + 48);
+//nop;
+if (v1 == 0) goto L4146e4;
+//nop;
+if (s2 == v1) goto L4146e4;
+t6 = MEM_U32(v0 + 0);
+a0 = MEM_U32(t6 + 20);
+//nop;
+if ((int)a0 <= 0) goto L4146e4;
+lo = a0 * s4; hi = (uint32_t)((uint64_t)a0 * (uint64_t)s4 >> 32);
+at = 0xf0000;
+at = at | 0xffff;
+t7 = lo;
+t8 = v1 + t7;
+a1 = MEM_U32(t8 + -4);
+t9 = a1 >> 26;
+t0 = a1 & at;
+if (s3 != t9) goto L4146e4;
+//nop;
+if (t0 == 0) goto L414774;
+L4146e4:
+//nop;
+a0 = s1;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 403c0003 gp = MEM_U32(sp + 48);
+a0 = s1;
+a1 = zero;
+//nop;
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 403c000b gp = MEM_U32(sp + 48);
+a0 = MEM_U32(v0 + 0);
+MEM_U32(sp + 16) = zero;
+//nop;
+a1 = zero;
+a2 = 0x8;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 403c000b gp = MEM_U32(sp + 48);
+s0 = v0;
+a0 = s1;
+//nop;
+a1 = zero;
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+v1 = MEM_U32(v0 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+s0 = s0 + 0x1;
+t1 = s0 & at;
+t2 = t1 ^ v1;
+t3 = t2 << 12;
+t4 = t3 >> 12;
+// bdead 403c201b gp = MEM_U32(sp + 48);
+t5 = t4 ^ v1;
+MEM_U32(v0 + 8) = t5;
+L414774:
+//nop;
+s1 = s1 + 0x1;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 403c01c3 gp = MEM_U32(sp + 48);
+if ((int)s1 < (int)v0) goto L414680;
+L414790:
+//nop;
+a0 = MEM_U32(sp + 56);
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 48);
+s0 = 0x100153bc;
+//nop;
+s0 = s0;
+a0 = MEM_U32(s0 + 0);
+wrapper_free(mem, a0);
+// bdead 20003 gp = MEM_U32(sp + 48);
+MEM_U32(s0 + 0) = zero;
+// bdead 3 ra = MEM_U32(sp + 52);
+at = 0x100153c0;
+// bdead 7 s0 = MEM_U32(sp + 28);
+// bdead 7 s1 = MEM_U32(sp + 32);
+MEM_U32(at + 0) = zero;
+at = 0x100153c4;
+// bdead 7 s2 = MEM_U32(sp + 36);
+// bdead 7 s3 = MEM_U32(sp + 40);
+// bdead 7 s4 = MEM_U32(sp + 44);
+// bdead 7 sp = sp + 0x48;
+MEM_U32(at + 0) = zero;
+return;
+}
+
+static uint32_t f_st_procend(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0, t9 = 0;
+L414f18:
+//st_procend:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffa8;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+// fdead 4000002b MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 88) = a0;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// bdead 4200018b gp = MEM_U32(sp + 32);
+t6 = sp + 0x44;
+MEM_U32(t6 + 0) = t8;
+t7 = MEM_U32(v0 + 4);
+at = 0x7fff0000;
+at = at | 0xffff;
+MEM_U32(t6 + 4) = t7;
+t9 = MEM_U32(sp + 68);
+//nop;
+if (t9 != at) goto L414fd0;
+//nop;
+t0 = 0x1;
+MEM_U32(sp + 60) = t0;
+a0 = MEM_U32(sp + 72);
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+MEM_U32(sp + 84) = v0;
+a1 = MEM_U32(v0 + 12);
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+a0 = MEM_U16(v0 + 2);
+a1 = a1 & at;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t1 = MEM_U32(sp + 84);
+MEM_U32(sp + 80) = v0;
+at = 0xf0000;
+t2 = MEM_U16(t1 + 2);
+at = at | 0xffff;
+// bdead 40000dc7 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 68) = t2;
+s0 = MEM_U32(t1 + 12);
+s0 = s0 & at;
+MEM_U32(sp + 72) = s0;
+goto L414ff0;
+L414fd0:
+//nop;
+MEM_U32(sp + 60) = zero;
+a0 = MEM_U32(sp + 68);
+a1 = MEM_U32(sp + 72);
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 400001cb gp = MEM_U32(sp + 32);
+MEM_U32(sp + 80) = v0;
+s0 = MEM_U32(sp + 72);
+L414ff0:
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+MEM_U32(sp + 56) = v0;
+a0 = MEM_U32(sp + 68);
+//nop;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 32);
+t3 = MEM_U32(sp + 80);
+a1 = zero;
+//nop;
+a0 = MEM_U32(t3 + 0);
+MEM_U32(sp + 16) = s0;
+a2 = 0x8;
+a3 = 0x1;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 32);
+s0 = v0;
+a0 = MEM_U32(sp + 68);
+//nop;
+a1 = MEM_U32(sp + 72);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+MEM_U32(sp + 80) = v0;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(sp + 80);
+t5 = MEM_U32(v0 + 0);
+at = 0xf0000;
+a0 = MEM_U32(t4 + 8);
+t6 = MEM_U32(t5 + 48);
+at = at | 0xffff;
+a0 = a0 & at;
+// bdead 400201e3 gp = MEM_U32(sp + 32);
+if (t6 < a0) goto L4150cc;
+at = 0xf0000;
+at = at | 0xffff;
+if (a0 == at) {
+t8 = MEM_U32(sp + 60);
+goto L4150d0;}
+//nop;
+//nop;
+v0 = f_st_paux_iaux(mem, sp, a0);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+t7 = s0 + 0x1;
+MEM_U32(v0 + 0) = t7;
+L4150cc:
+t8 = MEM_U32(sp + 60);
+L4150d0:
+at = 0x1;
+t9 = MEM_U32(sp + 84);
+//nop;
+if (t8 != at) goto L415138;
+v0 = MEM_U32(t9 + 12);
+at = 0xe;
+a1 = zero;
+t0 = v0 >> 26;
+//nop;
+if (t0 != at) goto L415138;
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+a0 = v0 & at;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 4002010b gp = MEM_U32(sp + 32);
+a0 = MEM_U32(sp + 88);
+a1 = v0;
+//nop;
+//nop;
+f_st_setidn(mem, sp, a0, a1);
+t2 = MEM_U32(sp + 84);
+// bdead 40020983 gp = MEM_U32(sp + 32);
+t1 = MEM_U16(t2 + 12);
+t3 = t1 & 0xfc1f;
+MEM_U16(t2 + 12) = (uint16_t)t3;
+L415138:
+//nop;
+a0 = s0;
+a1 = zero;
+//nop;
+v0 = f_st_idn_index_fext(mem, sp, a0, a1);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 88) = v0;
+a0 = MEM_U32(sp + 56);
+//nop;
+//nop;
+f_st_setfd(mem, sp, a0, a1);
+// bdead 40000001 ra = MEM_U32(sp + 36);
+// bdead 40000001 gp = MEM_U32(sp + 32);
+v0 = MEM_U32(sp + 88);
+// bdead 9 s0 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x58;
+return v0;
+}
+
+static void f_st_procbegin(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L41517c:
+//st_procbegin:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 4000002b MEM_U32(sp + 36) = ra;
+// fdead 4000002b MEM_U32(sp + 32) = gp;
+// fdead 4000002b MEM_U32(sp + 28) = s0;
+MEM_U32(sp + 64) = a0;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// bdead 4200018b gp = MEM_U32(sp + 32);
+t6 = sp + 0x30;
+MEM_U32(t6 + 0) = t8;
+t7 = MEM_U32(v0 + 4);
+at = 0x7fff0000;
+at = at | 0xffff;
+MEM_U32(t6 + 4) = t7;
+t9 = MEM_U32(sp + 48);
+//nop;
+if (t9 == at) goto L4151d8;
+// bdead 1 v0 = MEM_U32(sp + 64);
+goto L415378;
+L4151d8:
+//nop;
+a0 = MEM_U32(sp + 52);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+t0 = MEM_U32(v0 + 12);
+at = 0x1;
+// bdead 400003cf gp = MEM_U32(sp + 32);
+t1 = t0 << 6;
+t2 = t1 >> 27;
+s0 = v0;
+if (t2 != at) goto L41520c;
+// bdead 1 v0 = MEM_U32(sp + 64);
+goto L415378;
+L41520c:
+t3 = MEM_U16(s0 + 12);
+t4 = t3 & 0xfc1f;
+t5 = t4 | 0x20;
+MEM_U16(s0 + 12) = (uint16_t)t5;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+t6 = MEM_U16(s0 + 2);
+// bdead 400281cb gp = MEM_U32(sp + 32);
+//nop;
+if (v0 == t6) goto L4152d4;
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t7 = MEM_U32(v0 + 0);
+// bdead 400301c3 gp = MEM_U32(sp + 32);
+t8 = MEM_U32(t7 + 48);
+//nop;
+if ((int)t8 <= 0) goto L4152c0;
+t9 = MEM_U32(s0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t0 = t9 & at;
+//nop;
+if (t0 == at) goto L4152c0;
+//nop;
+a0 = MEM_U16(s0 + 2);
+a1 = s0 + 0x4;
+//nop;
+v0 = f_st_iaux_copyty(mem, sp, a0, a1);
+v1 = MEM_U32(s0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t1 = v0 & at;
+t2 = t1 ^ v1;
+t3 = t2 << 12;
+t4 = t3 >> 12;
+// bdead 400221d3 gp = MEM_U32(sp + 32);
+t5 = t4 ^ v1;
+MEM_U32(s0 + 12) = t5;
+L4152c0:
+//nop;
+//nop;
+v0 = f_st_currentifd(mem, sp, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+MEM_U16(s0 + 2) = (uint16_t)v0;
+L4152d4:
+//nop;
+a0 = MEM_U32(s0 + 4);
+//nop;
+v0 = f_st_str_extiss(mem, sp, a0);
+// bdead 400201cb gp = MEM_U32(sp + 32);
+a0 = v0;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 4002000b gp = MEM_U32(sp + 32);
+v1 = MEM_U32(s0 + 12);
+at = 0xf0000;
+//nop;
+at = at | 0xffff;
+t6 = v1 & at;
+MEM_U32(sp + 16) = t6;
+a0 = v0;
+a1 = zero;
+a3 = 0x1;
+a2 = v1 >> 26;
+v0 = f_st_symadd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(s0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+t7 = v0 & at;
+t8 = t7 ^ v1;
+t9 = t8 << 12;
+// bdead 44020191 gp = MEM_U32(sp + 32);
+t0 = t9 >> 12;
+t1 = t0 ^ v1;
+MEM_U32(s0 + 12) = t1;
+//nop;
+a0 = MEM_U16(s0 + 2);
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+v1 = MEM_U32(v0 + 0);
+// bdead 11 gp = MEM_U32(sp + 32);
+t2 = MEM_U8(v1 + 60);
+t3 = t2 & 0xfffb;
+MEM_U8(v1 + 60) = (uint8_t)t3;
+// bdead 1 v0 = MEM_U32(sp + 64);
+L415378:
+// bdead 1 ra = MEM_U32(sp + 36);
+// bdead 1 s0 = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x40;
+//nop;
+return;
+}
+
+static uint32_t f_st_sym_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41538c:
+//st_sym_idn:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+//nop;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+MEM_U32(sp + 60) = a3;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// bdead 42000009 gp = MEM_U32(sp + 24);
+t6 = sp + 0x28;
+MEM_U32(t6 + 0) = t8;
+t7 = MEM_U32(v0 + 4);
+at = 0xf0000;
+at = at | 0xffff;
+MEM_U32(t6 + 4) = t7;
+t9 = MEM_U32(sp + 44);
+//nop;
+if (t9 != at) goto L4153ec;
+v0 = 0xffffffff;
+goto L415464;
+L4153ec:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+t0 = MEM_U32(v0 + 8);
+t3 = MEM_U32(sp + 52);
+// bdead 40001309 gp = MEM_U32(sp + 24);
+t1 = t0 << 6;
+t2 = t1 >> 27;
+MEM_U32(t3 + 0) = t2;
+t4 = MEM_U32(v0 + 8);
+t6 = MEM_U32(sp + 56);
+at = 0xf0000;
+t5 = t4 >> 26;
+MEM_U32(t6 + 0) = t5;
+t8 = MEM_U32(sp + 60);
+t7 = MEM_U32(v0 + 4);
+at = at | 0xffff;
+MEM_U32(t8 + 0) = t7;
+t9 = MEM_U32(v0 + 8);
+t1 = MEM_U32(sp + 64);
+t0 = t9 & at;
+MEM_U32(t1 + 0) = t0;
+//nop;
+a1 = MEM_U32(v0 + 0);
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+L415464:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_str_idn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L415474:
+//st_str_idn:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t8 = MEM_U32(v0 + 0);
+// bdead 42000009 gp = MEM_U32(sp + 24);
+t6 = sp + 0x28;
+MEM_U32(t6 + 0) = t8;
+t7 = MEM_U32(v0 + 4);
+at = 0xf0000;
+at = at | 0xffff;
+MEM_U32(t6 + 4) = t7;
+t9 = MEM_U32(sp + 44);
+//nop;
+if (t9 != at) goto L4154c8;
+v0 = 0xffffffff;
+goto L4154f8;
+L4154c8:
+//nop;
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+//nop;
+v0 = f_st_psym_ifd_isym(mem, sp, a0, a1);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(v0 + 0);
+//nop;
+//nop;
+v0 = f_st_str_ifd_iss(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+L4154f8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd_idn(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t6 = 0;
+L415910:
+//st_pdadd_idn:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 4000002b MEM_U32(sp + 28) = ra;
+// fdead 4000002b MEM_U32(sp + 24) = gp;
+v0 = f_st_pdn_idn(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+at = 0x7fff0000;
+at = at | 0xffff;
+// bdead 400081cd gp = MEM_U32(sp + 24);
+v1 = v0;
+if (t6 != at) goto L415970;
+//nop;
+a0 = MEM_U32(v1 + 4);
+//nop;
+v0 = f_st_pext_iext(mem, sp, a0, a1, a2, a3);
+a0 = MEM_U32(v0 + 12);
+at = 0xf0000;
+at = at | 0xffff;
+// bdead 400001e5 gp = MEM_U32(sp + 24);
+a0 = a0 & at;
+goto L415974;
+L415970:
+a0 = MEM_U32(v0 + 4);
+L415974:
+//nop;
+//nop;
+f_st_pdadd(mem, sp, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_currentifd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, a3 = 0;
+L415bf0:
+//st_currentifd:
+//nop;
+//nop;
+//nop;
+a0 = 0x1001553c;
+sp = sp + 0xffffffe0;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+a0 = MEM_U32(a0 + 0);
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+//nop;
+if (a0 != 0) goto L415c20;
+v0 = 0xffffffff;
+goto L415c30;
+L415c20:
+//nop;
+//nop;
+v0 = f_st_ifd_pcfd(mem, sp, a0, a1, a2, a3);
+// bdead 9 gp = MEM_U32(sp + 24);
+L415c30:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static uint32_t f_st_ifdmax(uint8_t *mem, uint32_t sp) {
+uint32_t v0 = 0, t6 = 0;
+L415c40:
+//st_ifdmax:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+t6 = MEM_U32(t6 + 0);
+v0 = MEM_U32(t6 + 12);
+return v0;
+}
+
+static void f_st_setfd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, a2 = 0, a3 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0,
+t9 = 0;
+L415c5c:
+//st_setfd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 4000806b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000806b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+v0 = MEM_U32(t6 + 4);
+if (v0 != zero) {
+t8 = MEM_U32(sp + 32);
+goto L415cb0;}
+//nop;
+a0 = 0x100135a0;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t7 = 0x10015540;
+t7 = MEM_U32(t7 + 0);
+v0 = MEM_U32(t7 + 4);
+t8 = MEM_U32(sp + 32);
+L415cb0:
+// bdead 2000009 ra = MEM_U32(sp + 28);
+at = 0x1001553c;
+t9 = t8 << 6;
+t0 = v0 + t9;
+// bdead 205 sp = sp + 0x20;
+MEM_U32(at + 0) = t0;
+return;
+}
+
+static void f_st_fdadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L415ccc:
+//st_fdadd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffff10;
+t2 = 0x10015540;
+// fdead 400009eb MEM_U32(sp + 28) = ra;
+// fdead 400009eb MEM_U32(sp + 24) = gp;
+t0 = MEM_U32(t2 + 0);
+MEM_U32(sp + 240) = a0;
+MEM_U32(sp + 244) = a1;
+MEM_U32(sp + 248) = a2;
+MEM_U32(sp + 252) = a3;
+t6 = MEM_U32(t0 + 12);
+at = 0x7fff0000;
+at = at | 0xffff;
+MEM_U32(sp + 36) = t6;
+if ((int)t6 < (int)at) goto L415d44;
+//nop;
+a0 = 0x10011cd0;
+a2 = 0x7fff0000;
+a2 = a2 | 0xffff;
+a1 = t6;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t2 = 0x10015540;
+t0 = MEM_U32(t2 + 0);
+t8 = MEM_U32(t0 + 12);
+MEM_U32(sp + 36) = t8;
+L415d44:
+v0 = MEM_U32(t0 + 16);
+t9 = MEM_U32(sp + 36);
+a1 = t0 + 0x10;
+a2 = 0x40;
+a3 = 0x19;
+if ((int)t9 < (int)v0) goto L415e38;
+//nop;
+MEM_U32(sp + 236) = v0;
+a0 = MEM_U32(t0 + 4);
+MEM_U32(sp + 232) = v0;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a1 = sp + 0xec;
+a2 = 0x48;
+t2 = 0x10015540;
+a3 = 0x19;
+t3 = MEM_U32(t2 + 0);
+MEM_U32(t3 + 4) = v0;
+//nop;
+t4 = MEM_U32(t2 + 0);
+a0 = MEM_U32(t4 + 8);
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 232);
+t2 = 0x10015540;
+t5 = MEM_U32(t2 + 0);
+MEM_U32(t5 + 8) = v0;
+t6 = MEM_U32(t2 + 0);
+t7 = MEM_U32(sp + 236);
+a3 = MEM_U32(sp + 240);
+a2 = MEM_U32(t6 + 16);
+a1 = t7;
+if (t7 == a2) {
+// bdead 40000c03 a0 = t1;
+goto L415df4;}
+//nop;
+a0 = 0x10011d04;
+MEM_U32(sp + 232) = t1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 232);
+t2 = 0x10015540;
+// bdead 40000c03 a0 = t1;
+L415df4:
+if (t1 == 0) {
+t1 = t1 + 0xffffffff;
+goto L415e38;}
+t1 = t1 + 0xffffffff;
+v1 = t1 << 3;
+v1 = v1 + t1;
+v1 = v1 << 3;
+v0 = t1 << 6;
+L415e0c:
+t0 = MEM_U32(t2 + 0);
+// bdead 40000e1b a0 = t1;
+t8 = MEM_U32(t0 + 8);
+t3 = MEM_U32(t0 + 4);
+t9 = t8 + v1;
+t4 = t3 + v0;
+v0 = v0 + 0xffffffc0;
+v1 = v1 + 0xffffffb8;
+MEM_U32(t4 + 0) = t9;
+if (t1 != 0) {
+t1 = t1 + 0xffffffff;
+goto L415e0c;}
+t1 = t1 + 0xffffffff;
+L415e38:
+t0 = MEM_U32(t2 + 0);
+t9 = 0x10015418;
+a1 = 0x1001553c;
+t6 = MEM_U32(t0 + 12);
+t5 = MEM_U32(t0 + 4);
+t9 = t9;
+t7 = t6 << 6;
+t3 = t5 + t7;
+t5 = t9 + 0x3c;
+MEM_U32(a1 + 0) = t3;
+L415e60:
+t6 = MEM_U32(t9 + 0);
+t9 = t9 + 0xc;
+t3 = t3 + 0xc;
+MEM_U32(t3 + -12) = t6;
+t4 = MEM_U32(t9 + -8);
+MEM_U32(t3 + -8) = t4;
+t6 = MEM_U32(t9 + -4);
+MEM_U32(t3 + -4) = t6;
+if (t9 != t5) goto L415e60;
+t6 = MEM_U32(t9 + 0);
+MEM_U32(t3 + 0) = t6;
+t0 = MEM_U32(t2 + 0);
+t3 = MEM_U32(a1 + 0);
+t7 = MEM_U32(t0 + 12);
+t5 = MEM_U32(t0 + 8);
+t8 = t7 << 3;
+t8 = t8 + t7;
+t8 = t8 << 3;
+t9 = t8 + t5;
+MEM_U32(t3 + 0) = t9;
+t0 = MEM_U32(t2 + 0);
+t5 = 0x100153d0;
+t4 = MEM_U32(t0 + 12);
+t5 = t5;
+t6 = t4 + 0x1;
+MEM_U32(t0 + 12) = t6;
+t7 = MEM_U32(a1 + 0);
+t4 = t5 + 0x48;
+t8 = MEM_U32(t7 + 0);
+L415ed4:
+t3 = MEM_U32(t5 + 0);
+t5 = t5 + 0xc;
+t8 = t8 + 0xc;
+MEM_U32(t8 + -12) = t3;
+t9 = MEM_U32(t5 + -8);
+MEM_U32(t8 + -8) = t9;
+t3 = MEM_U32(t5 + -4);
+MEM_U32(t8 + -4) = t3;
+if (t5 != t4) goto L415ed4;
+t6 = MEM_U32(a1 + 0);
+t4 = MEM_U32(sp + 244);
+v1 = MEM_U32(t6 + 0);
+t8 = t4 << 3;
+t9 = MEM_U8(v1 + 60);
+t3 = t9 & 0xff07;
+t6 = t8 | t3;
+MEM_U8(v1 + 60) = (uint8_t)t6;
+t7 = MEM_U32(a1 + 0);
+t5 = MEM_U32(sp + 248);
+v1 = MEM_U32(t7 + 0);
+t9 = t5 << 2;
+t8 = t9 & 0x4;
+t3 = MEM_U8(v1 + 60);
+t6 = t3 & 0xfffb;
+t7 = t8 | t6;
+MEM_U8(v1 + 60) = (uint8_t)t7;
+t4 = MEM_U32(a1 + 0);
+t9 = MEM_U32(sp + 252);
+v1 = MEM_U32(t4 + 0);
+t8 = t9 << 6;
+t6 = MEM_U8(v1 + 61);
+t7 = t6 & 0xff3f;
+t4 = t8 | t7;
+MEM_U8(v1 + 61) = (uint8_t)t4;
+//nop;
+//nop;
+v0 = f_gethostsex(mem, sp);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+t3 = v0 < 0x1;
+t6 = t3 & 0x1;
+a1 = 0x1001553c;
+a0 = 0x10011d3c;
+t5 = MEM_U32(a1 + 0);
+a0 = a0;
+v1 = MEM_U32(t5 + 0);
+t8 = MEM_U8(v1 + 60);
+t7 = t8 & 0xfffe;
+t4 = t6 | t7;
+MEM_U8(v1 + 60) = (uint8_t)t4;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 240);
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+a1 = 0x1001553c;
+t3 = 0x10013590;
+t5 = MEM_U32(a1 + 0);
+t9 = MEM_U32(t5 + 0);
+MEM_U32(t9 + 4) = v0;
+t3 = MEM_U32(t3 + 0);
+t8 = MEM_U32(sp + 252);
+if (t3 != zero) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L416360;}
+at = (int)t8 < (int)0x3;
+if (t8 == 0) goto L415ff0;
+if ((int)t8 < (int)0x3) {
+// bdead 1 ra = MEM_U32(sp + 28);
+goto L416360;}
+L415ff0:
+//nop;
+a0 = 0x10011d40;
+a0 = a0;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+t7 = 0x1;
+t6 = 0x1001364c;
+t6 = MEM_S8(t6 + 0);
+if (t6 != zero) {
+t8 = MEM_U32(sp + 240);
+goto L4161c8;}
+//nop;
+at = 0x1001364c;
+a0 = 0x10015458;
+a1 = 0x40;
+MEM_U8(at + 0) = (uint8_t)t7;
+a0 = a0;
+v0 = wrapper_gethostname(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+if ((int)v0 >= 0) goto L416060;
+t5 = 0x10011d4c;
+t4 = 0x10015458;
+t5 = t5;
+t3 = MEM_U8(t5 + 0);
+t9 = MEM_U8(t5 + 1);
+t4 = t4;
+MEM_U8(t4 + 0) = (uint8_t)t3;
+MEM_U8(t4 + 1) = (uint8_t)t9;
+goto L41607c;
+L416060:
+//nop;
+a0 = 0x10015458;
+a1 = 0x10011d50;
+a0 = a0;
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L41607c:
+//nop;
+a0 = MEM_U32(sp + 240);
+a1 = 0x5;
+//nop;
+v0 = wrapper_pathconf(mem, a0, a1);
+at = (int)v0 < (int)0x5;
+// bdead 4000000f gp = MEM_U32(sp + 24);
+v1 = v0;
+if (at == 0) goto L4160a4;
+v1 = 0x5;
+L4160a4:
+v1 = v1 << 2;
+//nop;
+v0 = v1 << 2;
+v0 = v0 - v1;
+v0 = v0 + 0xa;
+a0 = v0;
+MEM_U32(sp + 40) = v0;
+MEM_U32(sp + 228) = v1;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+a1 = MEM_U32(sp + 40);
+at = 0x100154a0;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L4160fc;
+//nop;
+a0 = 0x10011d54;
+MEM_U32(sp + 228) = v1;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+L4160fc:
+//nop;
+a0 = zero;
+a1 = MEM_U32(sp + 40);
+MEM_U32(sp + 228) = v1;
+v0 = wrapper_getcwd(mem, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+at = 0x100154a4;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L416184;
+//nop;
+a0 = 0x10011d80;
+MEM_U32(sp + 228) = v1;
+a0 = a0;
+v0 = wrapper_getenv(mem, a0);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+v1 = MEM_U32(sp + 228);
+a1 = v0;
+if (v0 != 0) goto L416150;
+a1 = 0x10011d84;
+a1 = a1;
+L416150:
+//nop;
+at = 0x100154a4;
+a0 = a1;
+MEM_U32(sp + 228) = v1;
+MEM_U32(at + 0) = a1;
+v0 = wrapper_strlen(mem, a0);
+v1 = MEM_U32(sp + 228);
+a0 = v0 + 0x1;
+// bdead 40000033 gp = MEM_U32(sp + 24);
+//nop;
+if ((int)v1 >= (int)a0) goto L416184;
+v1 = a0 << 1;
+L416184:
+//nop;
+a1 = v1 << 2;
+a1 = a1 + 0xa;
+a0 = a1;
+MEM_U32(sp + 40) = a1;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4000018b gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 40);
+at = 0x1001549c;
+MEM_U32(at + 0) = v0;
+if (v0 != 0) goto L4161c4;
+//nop;
+a0 = 0x10011d88;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L4161c4:
+t8 = MEM_U32(sp + 240);
+L4161c8:
+at = 0x2f;
+t6 = MEM_S8(t8 + 0);
+//nop;
+if (t6 == at) goto L41622c;
+//nop;
+a1 = 0x100154a4;
+a0 = 0x100154a0;
+a1 = MEM_U32(a1 + 0);
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x100154a0;
+a1 = 0x10011dc4;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 240);
+//nop;
+a0 = 0x100154a0;
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+goto L416244;
+L41622c:
+//nop;
+a0 = 0x100154a0;
+a1 = MEM_U32(sp + 240);
+a0 = MEM_U32(a0 + 0);
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+L416244:
+//nop;
+a0 = 0x1001549c;
+a1 = 0x10015458;
+a0 = MEM_U32(a0 + 0);
+a1 = a1;
+v0 = wrapper_strcpy(mem, a0, a1);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1001549c;
+a1 = 0x100154a0;
+a0 = MEM_U32(a0 + 0);
+a1 = MEM_U32(a1 + 0);
+v0 = wrapper_strcat(mem, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+//nop;
+a0 = 0x1001549c;
+a0 = MEM_U32(a0 + 0);
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+t4 = 0x1;
+t7 = 0x10013650;
+t7 = MEM_U32(t7 + 0);
+//nop;
+if (t7 != 0) goto L4162e4;
+//nop;
+at = 0x10013650;
+a0 = zero;
+MEM_U32(at + 0) = t4;
+v0 = wrapper_time(mem, a0);
+// bdead 40000109 gp = MEM_U32(sp + 24);
+a2 = v0;
+//nop;
+at = 0x100154c8;
+a0 = 0x100154a8;
+a1 = 0x10011dc8;
+MEM_U32(at + 0) = v0;
+a0 = a0;
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+L4162e4:
+//nop;
+a0 = 0x100154a8;
+a0 = a0;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 240);
+a1 = sp + 0x34;
+//nop;
+//nop;
+v0 = wrapper_stat(mem, a0, a1);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+if ((int)v0 >= 0) goto L41632c;
+//nop;
+a0 = 0x10011dcc;
+a0 = a0;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+goto L41635c;
+L41632c:
+//nop;
+a1 = 0x10011dd0;
+a0 = sp + 0xbc;
+a2 = MEM_U32(sp + 100);
+a1 = a1;
+MEM_U32(sp + 0) = a0;
+MEM_U32(sp + 4) = a1;
+MEM_U32(sp + 8) = a2;
+MEM_U32(sp + 12) = a3;
+v0 = wrapper_sprintf(mem, a0, a1, sp);
+// bdead 400001c1 gp = MEM_U32(sp + 24);
+a0 = sp + 0xbc;
+//nop;
+//nop;
+v0 = f_st_stradd(mem, sp, a0, a1);
+// bdead 1 gp = MEM_U32(sp + 24);
+L41635c:
+// bdead 1 ra = MEM_U32(sp + 28);
+L416360:
+// bdead 1 sp = sp + 0xf0;
+//nop;
+return;
+}
+
+static uint32_t f_st_auxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41636c:
+//st_auxadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 400080eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400080eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+if (t7 != 0) goto L4163b0;
+//nop;
+a0 = 0x100135a0;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+L4163b0:
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+if (v1 != zero) {
+t8 = MEM_U32(v1 + 60);
+goto L4163e0;}
+//nop;
+a0 = 0x100135dc;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t8 = MEM_U32(v1 + 60);
+L4163e0:
+t9 = t8 & 0x400;
+if (t9 == zero) {
+t0 = MEM_U32(v1 + 0);
+goto L41640c;}
+//nop;
+a0 = 0x10013610;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t0 = MEM_U32(v1 + 0);
+L41640c:
+t1 = MEM_U32(v1 + 16);
+a1 = v1 + 0x10;
+a0 = MEM_U32(t0 + 48);
+if ((int)a0 < (int)t1) {
+t4 = MEM_U32(v1 + 12);
+goto L41645c;}
+//nop;
+a0 = MEM_U32(v1 + 12);
+a2 = 0x4;
+a3 = 0x40;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t2 = 0x1001553c;
+v1 = 0x1001553c;
+t2 = MEM_U32(t2 + 0);
+MEM_U32(t2 + 12) = v0;
+v1 = MEM_U32(v1 + 0);
+t3 = MEM_U32(v1 + 0);
+a0 = MEM_U32(t3 + 48);
+t4 = MEM_U32(v1 + 12);
+L41645c:
+t7 = sp + 0x20;
+t9 = MEM_U32(t7 + 0);
+t0 = 0x1001553c;
+t5 = a0 << 2;
+t6 = t4 + t5;
+MEM_U32(t6 + 0) = t9;
+t0 = MEM_U32(t0 + 0);
+a1 = MEM_U32(t0 + 0);
+v0 = MEM_U32(a1 + 48);
+t1 = v0 + 0x1;
+MEM_U32(a1 + 48) = t1;
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_pdadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0, lo = 0,
+hi = 0;
+L416498:
+//st_pdadd:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffe0;
+// fdead 4000802b MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 4000802b MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 32) = a0;
+t7 = MEM_U32(t6 + 4);
+//nop;
+if (t7 != 0) goto L4164dc;
+//nop;
+a0 = 0x100135a0;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+L4164dc:
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+if (v1 != zero) {
+t8 = MEM_U32(v1 + 60);
+goto L41650c;}
+//nop;
+a0 = 0x100135dc;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400001c3 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t8 = MEM_U32(v1 + 60);
+L41650c:
+t9 = t8 & 0x100;
+if (t9 == zero) {
+t0 = MEM_U32(v1 + 0);
+goto L416538;}
+//nop;
+a0 = 0x10013610;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+v1 = 0x1001553c;
+v1 = MEM_U32(v1 + 0);
+t0 = MEM_U32(v1 + 0);
+L416538:
+t1 = MEM_U32(v1 + 56);
+a1 = v1 + 0x38;
+a0 = MEM_U16(t0 + 42);
+if (a0 < t1) {
+a3 = 0x34;
+goto L416588;}
+//nop;
+a0 = MEM_U32(v1 + 52);
+a2 = 0x34;
+a3 = 0x20;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+// bdead 40000009 gp = MEM_U32(sp + 24);
+t2 = 0x1001553c;
+v1 = 0x1001553c;
+t2 = MEM_U32(t2 + 0);
+MEM_U32(t2 + 52) = v0;
+v1 = MEM_U32(v1 + 0);
+t3 = MEM_U32(v1 + 0);
+a0 = MEM_U16(t3 + 42);
+a3 = 0x34;
+L416588:
+lo = a0 * a3; hi = (uint32_t)((uint64_t)a0 * (uint64_t)a3 >> 32);
+t7 = 0x100154d0;
+t4 = MEM_U32(v1 + 52);
+t7 = t7;
+t0 = t7 + 0x30;
+t5 = lo;
+t6 = t4 + t5;
+//nop;
+L4165a8:
+t9 = MEM_U32(t7 + 0);
+t7 = t7 + 0xc;
+t6 = t6 + 0xc;
+MEM_U32(t6 + -12) = t9;
+t8 = MEM_U32(t7 + -8);
+MEM_U32(t6 + -8) = t8;
+t9 = MEM_U32(t7 + -4);
+MEM_U32(t6 + -4) = t9;
+if (t7 != t0) goto L4165a8;
+t9 = MEM_U32(t7 + 0);
+v1 = 0x1001553c;
+t7 = 0x1001553c;
+MEM_U32(t6 + 0) = t9;
+v1 = MEM_U32(v1 + 0);
+t1 = MEM_U32(sp + 32);
+t3 = MEM_U32(v1 + 0);
+t2 = MEM_U32(v1 + 52);
+t4 = MEM_U16(t3 + 42);
+lo = t4 * a3; hi = (uint32_t)((uint64_t)t4 * (uint64_t)a3 >> 32);
+t5 = lo;
+t0 = t2 + t5;
+MEM_U32(t0 + 4) = t1;
+t7 = MEM_U32(t7 + 0);
+a1 = MEM_U32(t7 + 0);
+v0 = MEM_U16(a1 + 42);
+t6 = v0 + 0x1;
+MEM_U16(a1 + 42) = (uint16_t)t6;
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_st_stradd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0, t8 = 0,
+t9 = 0;
+L41674c:
+//st_stradd:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 40) = a0;
+if (a0 != 0) goto L41678c;
+//nop;
+a0 = 0x10011dd4;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 32);
+L41678c:
+//nop;
+a0 = MEM_U32(sp + 40);
+//nop;
+v0 = wrapper_strlen(mem, a0);
+// bdead 400001cb gp = MEM_U32(sp + 32);
+s2 = v0 + 0x1;
+t7 = 0x10015540;
+t7 = MEM_U32(t7 + 0);
+t8 = MEM_U32(t7 + 4);
+//nop;
+if (t8 != 0) goto L4167cc;
+//nop;
+a0 = 0x100135a0;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400801c3 gp = MEM_U32(sp + 32);
+L4167cc:
+s1 = 0x1001553c;
+s0 = MEM_U32(s1 + 0);
+if (s0 != zero) {
+t9 = MEM_U32(s0 + 60);
+goto L4167f8;}
+//nop;
+a0 = 0x100135dc;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400c01c3 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+t9 = MEM_U32(s0 + 60);
+L4167f8:
+t0 = t9 & 0x80;
+if (t0 == zero) {
+t1 = MEM_U32(s0 + 0);
+goto L416820;}
+//nop;
+a0 = 0x10013610;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 400c0001 gp = MEM_U32(sp + 32);
+s0 = MEM_U32(s1 + 0);
+t1 = MEM_U32(s0 + 0);
+L416820:
+t2 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t1 + 12);
+t3 = v1 + s2;
+//nop;
+if ((int)t2 >= (int)t3) goto L41687c;
+L416838:
+//nop;
+a0 = MEM_U32(s0 + 20);
+a1 = s0 + 0x18;
+a2 = 0x1;
+a3 = 0x200;
+v0 = f_st_malloc(mem, sp, a0, a1, a2, a3);
+t4 = MEM_U32(s1 + 0);
+// bdead 400c2009 gp = MEM_U32(sp + 32);
+MEM_U32(t4 + 20) = v0;
+s0 = MEM_U32(s1 + 0);
+t5 = MEM_U32(s0 + 0);
+t6 = MEM_U32(s0 + 24);
+v1 = MEM_U32(t5 + 12);
+t7 = v1 + s2;
+//nop;
+if ((int)t6 < (int)t7) goto L416838;
+L41687c:
+//nop;
+t8 = MEM_U32(s0 + 20);
+a1 = MEM_U32(sp + 40);
+a0 = t8 + v1;
+v0 = wrapper_strcpy(mem, a0, a1);
+t9 = MEM_U32(s1 + 0);
+// bdead 4080001 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(t9 + 0);
+v0 = MEM_U32(a0 + 12);
+t0 = v0 + s2;
+MEM_U32(a0 + 12) = t0;
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x28;
+return v0;
+}
+
+static uint32_t f_st_paux_ifd_iaux(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L416900:
+//st_paux_ifd_iaux:
+//nop;
+//nop;
+//nop;
+t6 = 0x10015540;
+sp = sp + 0xffffffd8;
+// fdead 400081eb MEM_U32(sp + 28) = ra;
+t6 = MEM_U32(t6 + 0);
+// fdead 400081eb MEM_U32(sp + 24) = gp;
+a3 = a0;
+t7 = MEM_U32(t6 + 4);
+a2 = a1;
+//nop;
+if (t7 != 0) goto L416958;
+//nop;
+a0 = 0x100135a0;
+MEM_U32(sp + 44) = a1;
+MEM_U32(sp + 40) = a3;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 44);
+a3 = MEM_U32(sp + 40);
+L416958:
+a1 = a3;
+if ((int)a3 < 0) goto L4169a0;
+//nop;
+if ((int)a2 < 0) goto L4169a0;
+v0 = 0x10015540;
+v0 = MEM_U32(v0 + 0);
+t8 = MEM_U32(v0 + 12);
+//nop;
+if ((int)a3 >= (int)t8) goto L4169a0;
+t9 = MEM_U32(v0 + 4);
+t0 = a3 << 6;
+v1 = t9 + t0;
+t1 = MEM_U32(v1 + 0);
+t2 = MEM_U32(t1 + 48);
+if ((int)a2 < (int)t2) {
+// bdead 91 ra = MEM_U32(sp + 28);
+goto L4169dc;}
+L4169a0:
+//nop;
+a0 = 0x10011df0;
+t3 = a3 << 6;
+MEM_U32(sp + 36) = t3;
+MEM_U32(sp + 44) = a2;
+a0 = a0;
+f_st_internal(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+t6 = MEM_U32(sp + 36);
+a2 = MEM_U32(sp + 44);
+t4 = 0x10015540;
+t4 = MEM_U32(t4 + 0);
+t5 = MEM_U32(t4 + 4);
+v1 = t5 + t6;
+// bdead 91 ra = MEM_U32(sp + 28);
+L4169dc:
+t7 = MEM_U32(v1 + 12);
+t8 = a2 << 2;
+// bdead 2010001 sp = sp + 0x28;
+v0 = t7 + t8;
+return v0;
+}
+
+static uint32_t f_st_malloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t0 = 0, t2 = 0, t3 = 0, t4 = 0, t6 = 0, t7 = 0,
+s0 = 0, s1 = 0, t8 = 0, t9 = 0, lo = 0, hi = 0;
+L416b90:
+//st_malloc:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+// fdead 400001eb MEM_U32(sp + 28) = s1;
+// fdead 400001eb MEM_U32(sp + 24) = s0;
+MEM_U32(sp + 48) = a2;
+v0 = MEM_U32(a1 + 0);
+s0 = a1;
+s1 = a0;
+//nop;
+if (v0 == 0) goto L416bd8;
+at = 0xffffffff;
+if (a0 == 0) goto L416bd8;
+t0 = v0 << 1;
+if (a0 != at) goto L416c70;
+L416bd8:
+MEM_U32(s0 + 0) = a3;
+if (a3 != 0) goto L416c18;
+//nop;
+a0 = 0x1;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 400001c9 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L416c10;
+//nop;
+a0 = 0x10011e60;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+L416c10:
+v0 = s1;
+goto L416cc8;
+L416c18:
+t6 = MEM_U32(s0 + 0);
+t7 = MEM_U32(sp + 48);
+//nop;
+lo = t6 * t7; hi = (uint32_t)((uint64_t)t6 * (uint64_t)t7 >> 32);
+a0 = lo;
+//nop;
+v0 = wrapper_malloc(mem, a0);
+// bdead 4002018b gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L416cc4;
+t8 = MEM_U32(s0 + 0);
+t9 = MEM_U32(sp + 48);
+lo = t8 * t9; hi = (uint32_t)((uint64_t)t8 * (uint64_t)t9 >> 32);
+a1 = lo;
+if (a1 == zero) {
+v0 = s1;
+goto L416cc8;}
+//nop;
+a0 = 0x10011e9c;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+goto L416cc4;
+L416c70:
+MEM_U32(s0 + 0) = t0;
+t2 = MEM_U32(sp + 48);
+//nop;
+a0 = s1;
+lo = t0 * t2; hi = (uint32_t)((uint64_t)t0 * (uint64_t)t2 >> 32);
+a1 = lo;
+//nop;
+v0 = wrapper_realloc(mem, a0, a1);
+// bdead 40020189 gp = MEM_U32(sp + 32);
+s1 = v0;
+if (v0 != 0) goto L416cc4;
+t3 = MEM_U32(s0 + 0);
+t4 = MEM_U32(sp + 48);
+//nop;
+a0 = 0x10011edc;
+lo = t3 * t4; hi = (uint32_t)((uint64_t)t3 * (uint64_t)t4 >> 32);
+a0 = a0;
+a1 = lo;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40001 gp = MEM_U32(sp + 32);
+L416cc4:
+v0 = s1;
+L416cc8:
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 s0 = MEM_U32(sp + 24);
+// bdead 9 s1 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x28;
+return v0;
+//nop;
+}
+
+static uint32_t f_gethostsex(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, t6 = 0, t7 = 0;
+L416ce0:
+//gethostsex:
+sp = sp + 0xfffffff8;
+t6 = 0x1;
+MEM_U32(sp + 4) = t6;
+t7 = MEM_S8(sp + 4);
+at = 0x1;
+v0 = zero;
+//nop;
+if (t7 != at) goto L416d08;
+v0 = 0x1;
+goto L416d08;
+L416d08:
+// bdead 9 sp = sp + 0x8;
+return v0;
+}
+
+static uint32_t f_st_iaux_copyty(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+t8 = 0, t9 = 0;
+L416ea8:
+//st_iaux_copyty:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+//nop;
+// fdead 4000006b MEM_U32(sp + 36) = ra;
+// fdead 4000006b MEM_U32(sp + 32) = gp;
+// fdead 4000006b MEM_U32(sp + 28) = s2;
+// fdead 4000006b MEM_U32(sp + 24) = s1;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 60) = a1;
+a1 = MEM_U32(a1 + 8);
+at = 0xf0000;
+at = at | 0xffff;
+s2 = a0;
+s1 = zero;
+a1 = a1 & at;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+a3 = MEM_U32(sp + 60);
+at = 0x6;
+// bdead 400c010f gp = MEM_U32(sp + 32);
+t7 = MEM_U32(a3 + 8);
+t8 = t7 >> 26;
+if (t8 != at) {
+v1 = s1 << 2;
+goto L416f14;}
+s1 = 0x1;
+v1 = s1 << 2;
+L416f14:
+a2 = v1 + v0;
+a0 = MEM_U8(a2 + 0);
+at = 0x25;
+v1 = v1 + 0x4;
+a0 = a0 & 0x3f;
+s1 = s1 + 0x1;
+if (a0 != at) goto L416f5c;
+t9 = v0 + v1;
+t1 = MEM_U32(t9 + 0);
+t0 = 0xfff;
+t2 = t1 >> 20;
+if (t0 != t2) {
+s1 = s1 + 0x1;
+goto L416f54;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x1;
+L416f54:
+v1 = v1 + 0x4;
+goto L416fec;
+L416f5c:
+at = 0x11;
+t3 = v0 + v1;
+if (a0 == at) goto L416f94;
+at = 0x14;
+if (a0 == at) {
+at = 0xc;
+goto L416f94;}
+at = 0xc;
+if (a0 == at) {
+at = 0xd;
+goto L416f94;}
+at = 0xd;
+if (a0 == at) {
+at = 0xf;
+goto L416f94;}
+at = 0xf;
+if (a0 == at) {
+at = 0xe;
+goto L416f94;}
+at = 0xe;
+if (a0 != at) {
+at = 0x10;
+goto L416fc0;}
+L416f94:
+t4 = MEM_U32(t3 + 0);
+t0 = 0xfff;
+t5 = t4 >> 20;
+if (t0 != t5) {
+s1 = s1 + 0x1;
+goto L416fb4;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x1;
+L416fb4:
+v1 = v1 + 0x4;
+goto L416fec;
+at = 0x10;
+L416fc0:
+t6 = v0 + v1;
+if (a0 != at) goto L416fec;
+t7 = MEM_U32(t6 + 0);
+t0 = 0xfff;
+t8 = t7 >> 20;
+if (t0 != t8) {
+s1 = s1 + 0x3;
+goto L416fe8;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x3;
+L416fe8:
+v1 = v1 + 0xc;
+L416fec:
+t9 = MEM_U16(a2 + 2);
+a0 = 0x3;
+t0 = 0xfff;
+t1 = t9 >> 12;
+t2 = v0 + v1;
+if (a0 != t1) goto L417024;
+t3 = MEM_U32(t2 + 0);
+t4 = t3 >> 20;
+if (t0 != t4) {
+s1 = s1 + 0x4;
+goto L417020;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x4;
+L417020:
+v1 = v1 + 0x10;
+L417024:
+t5 = MEM_U8(a2 + 2);
+t7 = v0 + v1;
+t6 = t5 & 0xf;
+if (a0 != t6) {
+t1 = MEM_U8(a2 + 3);
+goto L41705c;}
+t8 = MEM_U32(t7 + 0);
+t9 = t8 >> 20;
+if (t0 != t9) {
+s1 = s1 + 0x4;
+goto L417054;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x4;
+L417054:
+v1 = v1 + 0x10;
+t1 = MEM_U8(a2 + 3);
+L41705c:
+t3 = v0 + v1;
+t2 = t1 >> 4;
+if (a0 != t2) {
+a1 = MEM_U32(a2 + 0);
+goto L417090;}
+t4 = MEM_U32(t3 + 0);
+t5 = t4 >> 20;
+if (t0 != t5) {
+s1 = s1 + 0x4;
+goto L417088;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x4;
+L417088:
+v1 = v1 + 0x10;
+a1 = MEM_U32(a2 + 0);
+L417090:
+t7 = v0 + v1;
+t6 = a1 & 0xf;
+if (a0 != t6) {
+t1 = MEM_U8(a2 + 1);
+goto L4170c4;}
+t8 = MEM_U32(t7 + 0);
+t9 = t8 >> 20;
+if (t0 != t9) {
+s1 = s1 + 0x4;
+goto L4170bc;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x4;
+L4170bc:
+v1 = v1 + 0x10;
+t1 = MEM_U8(a2 + 1);
+L4170c4:
+t3 = v0 + v1;
+t2 = t1 >> 4;
+if (a0 != t2) {
+t6 = MEM_U16(a2 + 0);
+goto L4170f8;}
+t4 = MEM_U32(t3 + 0);
+t5 = t4 >> 20;
+if (t0 != t5) {
+s1 = s1 + 0x4;
+goto L4170f0;}
+s1 = s1 + 0x1;
+v1 = v1 + 0x4;
+s1 = s1 + 0x4;
+L4170f0:
+v1 = v1 + 0x10;
+t6 = MEM_U16(a2 + 0);
+L4170f8:
+t8 = v0 + v1;
+t2 = a1 >> 31;
+t7 = t6 & 0xf;
+//nop;
+if (a0 != t7) goto L417124;
+t9 = MEM_U32(t8 + 0);
+t1 = t9 >> 20;
+if (t0 != t1) {
+s1 = s1 + 0x4;
+goto L417124;}
+s1 = s1 + 0x1;
+s1 = s1 + 0x4;
+L417124:
+//nop;
+if (t2 == 0) goto L417130;
+s1 = s1 + 0x1;
+L417130:
+s0 = zero;
+if ((int)s1 <= 0) goto L4171c8;
+a3 = MEM_U32(sp + 60);
+L41713c:
+a0 = s2;
+v0 = MEM_U32(a3 + 8);
+if (s0 != 0) goto L417188;
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+t3 = v0 & at;
+a1 = t3 + s0;
+a0 = s2;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// bdead 400e01c9 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 400e0009 gp = MEM_U32(sp + 32);
+MEM_U32(sp + 44) = v0;
+goto L4171bc;
+L417188:
+//nop;
+at = 0xf0000;
+at = at | 0xffff;
+t6 = v0 & at;
+a1 = t6 + s0;
+v0 = f_st_paux_ifd_iaux(mem, sp, a0, a1);
+// bdead 400e01c9 gp = MEM_U32(sp + 32);
+a0 = MEM_U32(v0 + 0);
+//nop;
+MEM_U32(sp + 0) = a0;
+//nop;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 400e0001 gp = MEM_U32(sp + 32);
+L4171bc:
+s0 = s0 + 0x1;
+if (s0 != s1) {
+a3 = MEM_U32(sp + 60);
+goto L41713c;}
+L4171c8:
+// bdead 40000001 ra = MEM_U32(sp + 36);
+v0 = MEM_U32(sp + 44);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 s1 = MEM_U32(sp + 24);
+// bdead 9 s2 = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+return v0;
+}
+
+static void f_st_auxbtadd(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t7 = 0, t8 = 0, t9 = 0;
+L417434:
+//st_auxbtadd:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000ab MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 40) = a0;
+// fdead 400000ab MEM_U32(sp + 24) = gp;
+a0 = sp + 0x24;
+a1 = zero;
+a2 = 0x4;
+v0 = wrapper_memset(mem, a0, a1, a2);
+t7 = MEM_U32(sp + 40);
+t9 = MEM_U8(sp + 36);
+// bdead 440101c1 gp = MEM_U32(sp + 24);
+t8 = t7 & 0x3f;
+t0 = t9 & 0xffc0;
+t1 = t8 | t0;
+//nop;
+MEM_U8(sp + 36) = (uint8_t)t1;
+a0 = MEM_U32(sp + 36);
+MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static uint32_t f_st_auxisymadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0;
+L4174a4:
+//st_auxisymadd:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400000eb MEM_U32(sp + 28) = ra;
+// fdead 400000eb MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 36) = a0;
+MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 gp = MEM_U32(sp + 24);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_st_auxrndxadd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t at = 0, v0 = 0, a2 = 0, t9 = 0;
+L4174e0:
+//st_auxrndxadd:
+//nop;
+//nop;
+//nop;
+// fdead 6b sp = sp + 0xffffffd0;
+// fdead 6b t7 = MEM_U16(sp + 44);
+at = 0xf0000;
+at = at | 0xffff;
+// fdead 6f t8 = t7 | 0xfff0;
+// fdead 6f MEM_U16(sp + 44) = (uint16_t)t8;
+// fdead 6f t0 = MEM_U32(sp + 44);
+t9 = a1 & at;
+// fdead 400006f MEM_U32(sp + 28) = ra;
+// fdead 400006f t1 = t9 ^ t0;
+// fdead 400006f t2 = t1 << 12;
+// fdead 400006f t3 = t2 >> 12;
+// fdead 400006f t4 = t3 ^ t0;
+// fdead 400006f MEM_U32(sp + 24) = gp;
+// fdead 400006f MEM_U32(sp + 48) = a0;
+// fdead 400006f MEM_U32(sp + 44) = t4;
+// fdead 400006f t5 = sp + 0x2c;
+// fdead 400006f a0 = MEM_U32(t5 + 0);
+//nop;
+// fdead 400006f v0 = sp + 0x28;
+MEM_U32(v0 + 0) = a0;
+// fdead 400006f MEM_U32(sp + 0) = a0;
+v0 = f_st_auxadd(mem, sp, a0, a1, a2);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f MEM_U32(sp + 36) = v0;
+// fdead 1f a0 = MEM_U32(sp + 48);
+//nop;
+//nop;
+v0 = f_st_auxisymadd(mem, sp, a0, a1, a2);
+// fdead 1f ra = MEM_U32(sp + 28);
+// fdead 1f gp = MEM_U32(sp + 24);
+// fdead 1f v0 = MEM_U32(sp + 36);
+// fdead 1f sp = sp + 0x30;
+return;
+}
+
+static uint32_t func_418698(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, t6 = 0, t7 = 0, t8 = 0;
+L418698:
+//nop;
+//nop;
+//nop;
+// fdead 1eb sp = sp + 0xffffffe0;
+// fdead 1eb t6 = MEM_U32(sp + 48);
+// fdead 1eb MEM_U32(sp + 28) = ra;
+// fdead 1eb MEM_U32(sp + 24) = gp;
+// fdead 1eb MEM_U32(sp + 32) = a0;
+// fdead 1eb MEM_U32(sp + 40) = a2;
+// fdead 1eb MEM_U32(sp + 44) = a3;
+if (t6 != 0) goto L4186cc;
+v0 = zero;
+goto L418758;
+L4186cc:
+//nop;
+if (a1 != 0) goto L418714;
+//nop;
+// fdead 1eb a0 = MEM_U32(sp + 32);
+// fdead 1eb a1 = MEM_U32(sp + 40);
+a2 = zero;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// fdead b t7 = MEM_U32(sp + 40);
+// fdead b gp = MEM_U32(sp + 24);
+//nop;
+if (v0 == t7) goto L418714;
+//nop;
+a0 = 0x1001202c;
+a0 = a0;
+f_st_warning(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+v0 = 0xfffffffb;
+goto L418758;
+L418714:
+//nop;
+// fdead 1eb a0 = MEM_U32(sp + 32);
+// fdead 1eb a1 = MEM_U32(sp + 44);
+// fdead 1eb a2 = MEM_U32(sp + 48);
+v0 = wrapper_read(mem, a0, a1, a2);
+// fdead b t8 = MEM_U32(sp + 48);
+// fdead b gp = MEM_U32(sp + 24);
+if (v0 == t8) {
+v0 = zero;
+goto L418758;}
+//nop;
+a0 = 0x10012044;
+a0 = a0;
+f_st_warning(mem, sp, a0);
+// fdead b gp = MEM_U32(sp + 24);
+v0 = 0xfffffffa;
+goto L418758;
+// fdead 0 v0 = zero;
+L418758:
+// fdead 1eb ra = MEM_U32(sp + 28);
+// fdead 1eb sp = sp + 0x20;
+//nop;
+return v0;
+}
+
+static void f_st_writebinary(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0, a3 = 0;
+L418768:
+//st_writebinary:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 40000063 MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 44) = a1;
+// fdead 40000063 MEM_U32(sp + 24) = gp;
+MEM_U32(sp + 40) = a0;
+a1 = 0x102;
+a2 = 0x1b6;
+v0 = wrapper_open(mem, a0, a1, a2);
+// bdead 40000189 gp = MEM_U32(sp + 24);
+MEM_U32(sp + 36) = v0;
+if ((int)v0 >= 0) goto L4187bc;
+//nop;
+a0 = 0x1001205c;
+a1 = MEM_U32(sp + 40);
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+L4187bc:
+//nop;
+a0 = MEM_U32(sp + 36);
+a1 = MEM_U32(sp + 44);
+//nop;
+f_st_writest(mem, sp, a0, a1);
+// bdead 40000001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 36);
+//nop;
+//nop;
+v0 = wrapper_close(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 gp = MEM_U32(sp + 24);
+// bdead 1 sp = sp + 0x28;
+//nop;
+return;
+}
+
+static void f_st_writest(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, s0 = 0, s1 = 0, s2 = 0,
+s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, t8 = 0, t9 = 0, fp = 0,
+lo = 0, hi = 0;
+L4187f8:
+//st_writest:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xfffffe28;
+//nop;
+// fdead 4000006b MEM_U32(sp + 20) = s0;
+s0 = a0;
+// fdead 4002006b MEM_U32(sp + 60) = ra;
+MEM_U32(sp + 476) = a1;
+// fdead 4002006b MEM_U32(sp + 56) = fp;
+// fdead 4002006b MEM_U32(sp + 52) = gp;
+// fdead 4002006b MEM_U32(sp + 48) = s7;
+// fdead 4002006b MEM_U32(sp + 44) = s6;
+// fdead 4002006b MEM_U32(sp + 40) = s5;
+// fdead 4002006b MEM_U32(sp + 36) = s4;
+// fdead 4002006b MEM_U32(sp + 32) = s3;
+// fdead 4002006b MEM_U32(sp + 28) = s2;
+// fdead 4002006b MEM_U32(sp + 24) = s1;
+a1 = 0x48;
+a0 = sp + 0x18c;
+MEM_U32(sp + 288) = zero;
+wrapper_bzero(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+a0 = sp + 0x128;
+a1 = 0x60;
+//nop;
+//nop;
+wrapper_bzero(mem, a0, a1);
+// bdead 40020003 gp = MEM_U32(sp + 52);
+//nop;
+//nop;
+v0 = f_st_ifdmax(mem, sp);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 276) = v0;
+a0 = s0;
+//nop;
+a1 = zero;
+a2 = 0x1;
+//nop;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 272) = v0;
+a0 = s0;
+//nop;
+a1 = 0x60;
+a2 = 0x1;
+//nop;
+v0 = wrapper_lseek(mem, a0, a1, a2);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+t6 = MEM_U32(sp + 276);
+MEM_U32(sp + 284) = v0;
+t7 = 0x10015540;
+a0 = s0;
+t7 = MEM_U32(t7 + 0);
+MEM_U32(t7 + 12) = t6;
+//nop;
+//nop;
+v0 = wrapper_dup(mem, a0);
+// bdead 4002000b gp = MEM_U32(sp + 52);
+a0 = v0;
+//nop;
+a1 = 0x10012080;
+a1 = a1;
+v0 = wrapper_fdopen(mem, a0, a1);
+// bdead 4002018b gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+MEM_U32(sp + 268) = v0;
+if (v0 != 0) goto L418928;
+//nop;
+a0 = 0x10012084;
+a1 = s0;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L418928:
+t8 = MEM_U32(sp + 476);
+t9 = t8 & 0x4;
+if (t9 == zero) {
+t6 = MEM_U32(sp + 476);
+goto L418c9c;}
+t4 = MEM_U32(sp + 276);
+s6 = 0xffffffff;
+if ((int)t4 <= 0) {
+t4 = MEM_U32(sp + 300);
+goto L418c24;}
+MEM_U32(sp + 280) = zero;
+fp = sp + 0x68;
+L418950:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 292) = zero;
+MEM_U32(sp + 288) = t3;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(v0 + 0);
+// bdead c080418b gp = MEM_U32(sp + 52);
+t2 = MEM_U32(sp + 292);
+MEM_U32(sp + 392) = t5;
+v1 = MEM_U32(t5 + 28);
+t3 = MEM_U32(sp + 288);
+t1 = v0;
+if (v1 == zero) {
+v0 = MEM_U32(sp + 280);
+goto L418c10;}
+t7 = MEM_U32(v0 + 36);
+t8 = MEM_U32(sp + 300);
+if (t7 == zero) {
+v0 = MEM_U32(sp + 280);
+goto L418c10;}
+MEM_U32(t5 + 24) = t8;
+t4 = MEM_U32(sp + 300);
+t6 = MEM_U32(sp + 392);
+t5 = t4 + v1;
+MEM_U32(sp + 300) = t5;
+MEM_U32(t6 + 64) = t3;
+t7 = MEM_U32(sp + 392);
+MEM_U32(sp + 264) = zero;
+s1 = MEM_U16(t7 + 42);
+if (s1 == zero) {
+t8 = MEM_U32(sp + 392);
+goto L418c08;}
+MEM_U32(sp + 88) = zero;
+L4189c8:
+t8 = MEM_U32(t1 + 52);
+t9 = MEM_U32(sp + 88);
+t0 = t8 + t9;
+t4 = MEM_U32(t0 + 8);
+if (s6 == t4) {
+t9 = MEM_U32(sp + 264);
+goto L418be8;}
+t5 = MEM_U32(t0 + 40);
+if (s6 == t5) {
+t9 = MEM_U32(sp + 264);
+goto L418be8;}
+t6 = MEM_U32(t0 + 44);
+t7 = MEM_U32(sp + 392);
+if (s6 == t6) {
+t9 = MEM_U32(sp + 264);
+goto L418be8;}
+t8 = MEM_U32(t7 + 64);
+a0 = zero;
+t9 = t3 - t8;
+MEM_U32(t0 + 48) = t9;
+t4 = MEM_U32(sp + 392);
+s1 = MEM_U16(t4 + 42);
+a1 = MEM_U32(t4 + 28);
+//nop;
+if (s1 == 0) goto L418a70;
+a2 = MEM_U32(t0 + 8);
+v1 = MEM_U32(t1 + 52);
+L418a28:
+v0 = MEM_U32(v1 + 8);
+a0 = a0 + 0x1;
+if ((int)a2 >= (int)v0) {
+at = a0 < s1;
+goto L418a68;}
+t5 = MEM_U32(v1 + 40);
+if (s6 == t5) {
+at = a0 < s1;
+goto L418a68;}
+t6 = MEM_U32(v1 + 44);
+at = (int)v0 < (int)a1;
+if (s6 == t6) {
+at = a0 < s1;
+goto L418a68;}
+if (at == zero) {
+at = a0 < s1;
+goto L418a68;}
+a1 = v0;
+at = a0 < s1;
+L418a68:
+v1 = v1 + 0x34;
+if (at != 0) goto L418a28;
+L418a70:
+if ((int)a1 <= 0) {
+t9 = MEM_U32(sp + 264);
+goto L418be8;}
+a2 = MEM_U32(t0 + 8);
+s2 = s6;
+s4 = zero;
+t7 = a2 << 2;
+if ((int)a2 < 0) goto L418be4;
+v0 = MEM_U32(t1 + 36);
+s7 = a1 << 2;
+s5 = MEM_U32(t0 + 40);
+s3 = v0 + t7;
+v1 = v0 + s7;
+s0 = fp;
+if (v1 < s3) goto L418be4;
+L418aac:
+at = 0x8;
+if (s3 != v1) goto L418abc;
+v1 = 0x1;
+goto L418adc;
+L418abc:
+v0 = MEM_U32(s3 + 0);
+a0 = v0;
+if (v0 != 0) goto L418ad0;
+a0 = MEM_U32(t0 + 40);
+goto L418ad0;
+L418ad0:
+v1 = a0 - s5;
+v1 = v1 << 16;
+v1 = (int)v1 >> 16;
+L418adc:
+a0 = fp;
+if (v1 != 0) goto L418aec;
+v0 = s0 + 0x3;
+if (s2 != at) goto L418b50;
+L418aec:
+s5 = s5 + v1;
+if (s2 == s6) goto L418b18;
+if ((int)s4 < (int)0xfffffff9) {
+at = (int)s4 < (int)0x8;
+goto L418b18;}
+t4 = s4 << 4;
+if ((int)s4 >= (int)0x8) goto L418b18;
+t5 = t4 | s2;
+MEM_U8(s0 + 0) = (uint8_t)t5;
+s0 = s0 + 0x1;
+goto L418b3c;
+L418b18:
+t8 = (int)s4 >> 8;
+if (s2 == s6) goto L418b3c;
+MEM_U8(s0 + 0) = (uint8_t)s2;
+t6 = MEM_S8(s0 + 0);
+MEM_U8(s0 + 1) = (uint8_t)t8;
+MEM_U8(s0 + 2) = (uint8_t)s4;
+t7 = t6 | 0x80;
+MEM_U8(s0 + 0) = (uint8_t)t7;
+s0 = s0 + 0x3;
+L418b3c:
+s4 = v1 << 16;
+s2 = zero;
+s4 = (int)s4 >> 16;
+v0 = s0 + 0x3;
+goto L418b54;
+L418b50:
+s2 = s2 + 0x1;
+L418b54:
+t4 = sp + 0xe8;
+s1 = s0 - fp;
+if (v0 >= t4) goto L418b80;
+t5 = MEM_U32(t1 + 36);
+t6 = s0 - fp;
+v1 = t5 + s7;
+if (s3 != v1) {
+s3 = s3 + 0x4;
+goto L418bd0;}
+if ((int)t6 <= 0) {
+s3 = s3 + 0x4;
+goto L418bd0;}
+L418b80:
+//nop;
+a1 = s1;
+a2 = 0x1;
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 252) = t0;
+MEM_U32(sp + 468) = t1;
+MEM_U32(sp + 292) = t2;
+MEM_U32(sp + 288) = t3;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t1 = MEM_U32(sp + 468);
+t2 = MEM_U32(sp + 292);
+t3 = MEM_U32(sp + 288);
+t7 = MEM_U32(t1 + 36);
+// bdead c1fd1d83 gp = MEM_U32(sp + 52);
+t0 = MEM_U32(sp + 252);
+s0 = fp;
+t2 = t2 + s1;
+t3 = t3 + s1;
+v1 = t7 + s7;
+s3 = s3 + 0x4;
+L418bd0:
+//nop;
+if (v1 >= s3) goto L418aac;
+t8 = MEM_U32(sp + 392);
+s1 = MEM_U16(t8 + 42);
+L418be4:
+t9 = MEM_U32(sp + 264);
+L418be8:
+t5 = MEM_U32(sp + 88);
+t4 = t9 + 0x1;
+at = t4 < s1;
+t6 = t5 + 0x34;
+MEM_U32(sp + 88) = t6;
+MEM_U32(sp + 264) = t4;
+if (at != 0) goto L4189c8;
+t8 = MEM_U32(sp + 392);
+L418c08:
+MEM_U32(t8 + 68) = t2;
+v0 = MEM_U32(sp + 280);
+L418c10:
+t9 = MEM_U32(sp + 276);
+v0 = v0 + 0x1;
+MEM_U32(sp + 280) = v0;
+if (v0 != t9) goto L418950;
+t4 = MEM_U32(sp + 300);
+L418c24:
+s0 = -t3;
+s0 = s0 & 0x3;
+if (t4 == zero) {
+t6 = MEM_U32(sp + 476);
+goto L418c9c;}
+a1 = 0x1;
+if (s0 == 0) goto L418c8c;
+//nop;
+a0 = 0x10015510;
+a2 = s0;
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400201cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+if (v0 == s0) goto L418c80;
+//nop;
+a0 = 0x100120b0;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L418c80:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t3 = t3 & at;
+L418c8c:
+t5 = MEM_U32(sp + 284);
+MEM_U32(sp + 304) = t3;
+MEM_U32(sp + 308) = t5;
+t6 = MEM_U32(sp + 476);
+L418c9c:
+t7 = t6 & 0x100;
+if (t7 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418dc0;}
+t8 = MEM_U32(sp + 284);
+t4 = MEM_U32(sp + 276);
+s0 = 0x34;
+t9 = t8 + t3;
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+if ((int)t4 <= 0) goto L418da8;
+MEM_U32(sp + 280) = zero;
+s2 = 0x10013664;
+L418ccc:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t5 = MEM_U32(v0 + 0);
+t6 = MEM_U16(sp + 436);
+t7 = MEM_U16(sp + 438);
+t3 = MEM_U32(sp + 288);
+// bdead 400bd10b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t5;
+t8 = t6 + t7;
+MEM_U16(t5 + 40) = (uint16_t)t8;
+t4 = MEM_U32(sp + 392);
+a1 = s0;
+s1 = MEM_U16(t4 + 42);
+lo = s1 * s0; hi = (uint32_t)((uint64_t)s1 * (uint64_t)s0 >> 32);
+a2 = s1;
+a0 = lo;
+t3 = t3 + a0;
+if (s1 == zero) {
+t7 = MEM_U16(sp + 436);
+goto L418d70;}
+//nop;
+a0 = MEM_U32(v0 + 52);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t5 = MEM_U32(sp + 392);
+// bdead 400a41cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t6 = MEM_U16(t5 + 42);
+if (v0 == t6) {
+t7 = MEM_U16(sp + 436);
+goto L418d70;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t7 = MEM_U16(sp + 436);
+L418d70:
+t8 = MEM_U16(sp + 438);
+t4 = MEM_U32(sp + 392);
+v1 = MEM_U32(sp + 280);
+t9 = t7 + t8;
+MEM_U16(sp + 436) = (uint16_t)t9;
+t5 = MEM_U32(sp + 320);
+v0 = MEM_U16(t4 + 42);
+t7 = MEM_U32(sp + 276);
+v1 = v1 + 0x1;
+t6 = t5 + v0;
+MEM_U32(sp + 320) = t6;
+MEM_U32(sp + 280) = v1;
+MEM_U16(sp + 438) = (uint16_t)v0;
+if (v1 != t7) goto L418ccc;
+L418da8:
+t8 = MEM_U32(sp + 320);
+t9 = MEM_U32(sp + 284);
+if (t8 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418dc0;}
+MEM_U32(sp + 324) = t9;
+t4 = MEM_U32(sp + 476);
+L418dc0:
+s2 = 0x10013664;
+t5 = t4 & 0x2;
+if (t5 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418ee0;}
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 276);
+s0 = 0xc;
+t7 = t6 + t3;
+MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L418ec8;
+MEM_U32(sp + 280) = zero;
+L418df0:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 412);
+t5 = MEM_U32(sp + 416);
+t3 = MEM_U32(sp + 288);
+// bdead 440a710b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t9;
+t6 = t4 + t5;
+MEM_U32(t9 + 16) = t6;
+t8 = MEM_U32(sp + 392);
+a1 = s0;
+a2 = MEM_U32(t8 + 20);
+lo = a2 * s0; hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+a0 = lo;
+t3 = t3 + a0;
+if (a2 == zero) {
+t5 = MEM_U32(sp + 412);
+goto L418e90;}
+//nop;
+a0 = MEM_U32(v0 + 4);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 392);
+// bdead 440a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(t9 + 20);
+if (v0 == t4) {
+t5 = MEM_U32(sp + 412);
+goto L418e90;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t5 = MEM_U32(sp + 412);
+L418e90:
+t6 = MEM_U32(sp + 416);
+t8 = MEM_U32(sp + 392);
+t9 = MEM_U32(sp + 328);
+t7 = t5 + t6;
+MEM_U32(sp + 412) = t7;
+t5 = MEM_U32(sp + 280);
+a0 = MEM_U32(t8 + 20);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + 0x1;
+t4 = t9 + a0;
+MEM_U32(sp + 328) = t4;
+MEM_U32(sp + 280) = t6;
+MEM_U32(sp + 416) = a0;
+if (t6 != t7) goto L418df0;
+L418ec8:
+t8 = MEM_U32(sp + 328);
+t9 = MEM_U32(sp + 284);
+if (t8 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418ee0;}
+MEM_U32(sp + 332) = t9;
+t4 = MEM_U32(sp + 476);
+L418ee0:
+s0 = 0xc;
+t5 = t4 & 0x20;
+if (t5 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418ffc;}
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 276);
+t7 = t6 + t3;
+MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L418fe4;
+MEM_U32(sp + 280) = zero;
+L418f0c:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 428);
+t5 = MEM_U32(sp + 432);
+t3 = MEM_U32(sp + 288);
+// bdead 440a710b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t9;
+t6 = t4 + t5;
+MEM_U32(t9 + 32) = t6;
+t8 = MEM_U32(sp + 392);
+a1 = s0;
+a2 = MEM_U32(t8 + 36);
+lo = a2 * s0; hi = (uint32_t)((uint64_t)a2 * (uint64_t)s0 >> 32);
+a0 = lo;
+t3 = t3 + a0;
+if (a2 == zero) {
+t5 = MEM_U32(sp + 428);
+goto L418fac;}
+//nop;
+a0 = MEM_U32(v0 + 28);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 392);
+// bdead 440a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(t9 + 36);
+if (v0 == t4) {
+t5 = MEM_U32(sp + 428);
+goto L418fac;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400a0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t5 = MEM_U32(sp + 428);
+L418fac:
+t6 = MEM_U32(sp + 432);
+t8 = MEM_U32(sp + 392);
+t9 = MEM_U32(sp + 336);
+t7 = t5 + t6;
+MEM_U32(sp + 428) = t7;
+t5 = MEM_U32(sp + 280);
+a0 = MEM_U32(t8 + 36);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + 0x1;
+t4 = t9 + a0;
+MEM_U32(sp + 336) = t4;
+MEM_U32(sp + 280) = t6;
+MEM_U32(sp + 432) = a0;
+if (t6 != t7) goto L418f0c;
+L418fe4:
+t8 = MEM_U32(sp + 336);
+t9 = MEM_U32(sp + 284);
+if (t8 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L418ffc;}
+MEM_U32(sp + 340) = t9;
+t4 = MEM_U32(sp + 476);
+L418ffc:
+t5 = t4 & 0x400;
+if (t5 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L41910c;}
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 276);
+t7 = t6 + t3;
+MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L4190f4;
+MEM_U32(sp + 280) = zero;
+L419024:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 440);
+t5 = MEM_U32(sp + 444);
+t3 = MEM_U32(sp + 288);
+// bdead 4408710b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t9;
+t6 = t4 + t5;
+MEM_U32(t9 + 44) = t6;
+t8 = MEM_U32(sp + 392);
+a1 = 0x4;
+a2 = MEM_U32(t8 + 48);
+a0 = a2 << 2;
+t3 = t3 + a0;
+if (a2 == 0) goto L4190b8;
+//nop;
+a0 = MEM_U32(v0 + 12);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 392);
+// bdead 440801cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(t9 + 48);
+if (v0 == t4) {
+t5 = MEM_U32(sp + 440);
+goto L4190bc;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L4190b8:
+t5 = MEM_U32(sp + 440);
+L4190bc:
+t6 = MEM_U32(sp + 444);
+t8 = MEM_U32(sp + 392);
+t9 = MEM_U32(sp + 344);
+t7 = t5 + t6;
+MEM_U32(sp + 440) = t7;
+t5 = MEM_U32(sp + 280);
+a0 = MEM_U32(t8 + 48);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + 0x1;
+t4 = t9 + a0;
+MEM_U32(sp + 344) = t4;
+MEM_U32(sp + 280) = t6;
+MEM_U32(sp + 444) = a0;
+if (t6 != t7) goto L419024;
+L4190f4:
+t8 = MEM_U32(sp + 344);
+t9 = MEM_U32(sp + 284);
+if (t8 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L41910c;}
+MEM_U32(sp + 348) = t9;
+t4 = MEM_U32(sp + 476);
+L41910c:
+t5 = t4 & 0x80;
+if (t5 == zero) {
+t9 = MEM_U32(sp + 476);
+goto L419274;}
+t6 = MEM_U32(sp + 284);
+t8 = MEM_U32(sp + 276);
+t7 = t6 + t3;
+MEM_U32(sp + 284) = t7;
+t3 = zero;
+if ((int)t8 <= 0) goto L419200;
+MEM_U32(sp + 280) = zero;
+L419134:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t9 = MEM_U32(v0 + 0);
+t4 = MEM_U32(sp + 404);
+t5 = MEM_U32(sp + 408);
+t3 = MEM_U32(sp + 288);
+// bdead 4408710b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t9;
+t6 = t4 + t5;
+MEM_U32(t9 + 8) = t6;
+t8 = MEM_U32(sp + 392);
+a1 = 0x1;
+a2 = MEM_U32(t8 + 12);
+t3 = t3 + a2;
+if (a2 == 0) goto L4191c4;
+//nop;
+a0 = MEM_U32(v0 + 20);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t9 = MEM_U32(sp + 392);
+// bdead 440801cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t4 = MEM_U32(t9 + 12);
+if (v0 == t4) {
+t5 = MEM_U32(sp + 404);
+goto L4191c8;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L4191c4:
+t5 = MEM_U32(sp + 404);
+L4191c8:
+t6 = MEM_U32(sp + 408);
+t8 = MEM_U32(sp + 392);
+t9 = MEM_U32(sp + 352);
+t7 = t5 + t6;
+MEM_U32(sp + 404) = t7;
+t5 = MEM_U32(sp + 280);
+a0 = MEM_U32(t8 + 12);
+t7 = MEM_U32(sp + 276);
+t6 = t5 + 0x1;
+t4 = t9 + a0;
+MEM_U32(sp + 352) = t4;
+MEM_U32(sp + 280) = t6;
+MEM_U32(sp + 408) = a0;
+if (t6 != t7) goto L419134;
+L419200:
+s0 = -t3;
+s0 = s0 & 0x3;
+a1 = 0x1;
+if (s0 == 0) goto L419260;
+//nop;
+a0 = 0x10015510;
+a2 = s0;
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+if (v0 == s0) goto L419254;
+//nop;
+a0 = 0x100120d4;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L419254:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t3 = t3 & at;
+L419260:
+MEM_U32(sp + 352) = t3;
+if (t3 == 0) goto L419270;
+t8 = MEM_U32(sp + 284);
+MEM_U32(sp + 356) = t8;
+L419270:
+t9 = MEM_U32(sp + 476);
+L419274:
+t4 = t9 & 0x800;
+if (t4 == zero) {
+t5 = MEM_U32(sp + 476);
+goto L419370;}
+t0 = 0x10015540;
+t6 = MEM_U32(sp + 284);
+v0 = MEM_U32(t0 + 0);
+t7 = t6 + t3;
+t3 = zero;
+t5 = MEM_U32(v0 + 40);
+MEM_U32(sp + 284) = t7;
+MEM_U32(sp + 360) = t5;
+if (t5 == 0) goto L419308;
+t3 = MEM_U32(v0 + 40);
+MEM_U32(sp + 364) = t7;
+v1 = MEM_U32(v0 + 40);
+a1 = 0x1;
+a2 = v1;
+if (v1 == 0) goto L419308;
+//nop;
+a0 = MEM_U32(v0 + 36);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400801cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t9 = 0x10015540;
+t9 = MEM_U32(t9 + 0);
+t4 = MEM_U32(t9 + 40);
+if (v0 == t4) {
+s0 = -t3;
+goto L41930c;}
+//nop;
+a0 = 0x10013678;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L419308:
+s0 = -t3;
+L41930c:
+s0 = s0 & 0x3;
+a1 = 0x1;
+if (s0 == 0) goto L419368;
+//nop;
+a0 = 0x10015510;
+a2 = s0;
+a3 = MEM_U32(sp + 268);
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400a01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+if (v0 == s0) goto L41935c;
+//nop;
+a0 = 0x100120fc;
+MEM_U32(sp + 288) = t3;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40080183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L41935c:
+t3 = t3 + 0x3;
+at = 0xfffffffc;
+t3 = t3 & at;
+L419368:
+MEM_U32(sp + 360) = t3;
+t5 = MEM_U32(sp + 476);
+L419370:
+t0 = 0x10015540;
+s1 = 0x10013678;
+t6 = t5 & 0x200;
+if (t6 == zero) {
+t8 = MEM_U32(sp + 476);
+goto L419420;}
+v0 = MEM_U32(t0 + 0);
+t7 = MEM_U32(sp + 284);
+t8 = MEM_U32(v0 + 12);
+t9 = t7 + t3;
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+MEM_U32(sp + 368) = t8;
+if (t8 == 0) goto L419418;
+t3 = MEM_U32(v0 + 12);
+MEM_U32(sp + 372) = t9;
+v1 = MEM_U32(v0 + 12);
+at = t3;
+t3 = t3 << 3;
+t3 = t3 + at;
+t3 = t3 << 3;
+if (v1 == 0) goto L419418;
+//nop;
+a0 = MEM_U32(v0 + 8);
+MEM_U32(sp + 288) = t3;
+a1 = 0x48;
+a2 = v1;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400c01cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t5 = 0x10015540;
+t5 = MEM_U32(t5 + 0);
+t6 = MEM_U32(t5 + 12);
+//nop;
+if (v0 == t6) goto L419418;
+//nop;
+a0 = s1;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400c0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L419418:
+t0 = 0x10015540;
+t8 = MEM_U32(sp + 476);
+L419420:
+t4 = MEM_U32(sp + 284);
+t7 = t8 & 0x40;
+if (t7 == zero) {
+t8 = MEM_U32(sp + 476);
+goto L419534;}
+t5 = MEM_U32(sp + 276);
+t9 = t4 + t3;
+MEM_U32(sp + 284) = t9;
+t3 = zero;
+if ((int)t5 <= 0) goto L41951c;
+MEM_U32(sp + 280) = zero;
+L419448:
+//nop;
+a0 = MEM_U32(sp + 280);
+MEM_U32(sp + 288) = t3;
+//nop;
+v0 = f_st_pcfd_ifd(mem, sp, a0, a1, a2, a3);
+t6 = MEM_U32(v0 + 0);
+t8 = MEM_U32(sp + 448);
+t7 = MEM_U32(sp + 452);
+t3 = MEM_U32(sp + 288);
+// bdead 420d910b gp = MEM_U32(sp + 52);
+MEM_U32(sp + 392) = t6;
+t4 = t8 + t7;
+MEM_U32(t6 + 52) = t4;
+t5 = MEM_U32(sp + 392);
+a1 = 0x4;
+a2 = MEM_U32(t5 + 56);
+a0 = a2 << 2;
+t3 = t3 + a0;
+if (a2 == 0) goto L4194dc;
+//nop;
+a0 = MEM_U32(v0 + 44);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+t6 = MEM_U32(sp + 392);
+// bdead 400c81cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t8 = MEM_U32(t6 + 56);
+if (v0 == t8) {
+t7 = MEM_U32(sp + 448);
+goto L4194e0;}
+//nop;
+a0 = s2;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 400c0183 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L4194dc:
+t7 = MEM_U32(sp + 448);
+L4194e0:
+t4 = MEM_U32(sp + 452);
+t5 = MEM_U32(sp + 392);
+t6 = MEM_U32(sp + 376);
+t9 = t7 + t4;
+MEM_U32(sp + 448) = t9;
+t7 = MEM_U32(sp + 280);
+a0 = MEM_U32(t5 + 56);
+t9 = MEM_U32(sp + 276);
+t4 = t7 + 0x1;
+t8 = t6 + a0;
+MEM_U32(sp + 376) = t8;
+MEM_U32(sp + 280) = t4;
+MEM_U32(sp + 452) = a0;
+if (t4 != t9) goto L419448;
+t0 = 0x10015540;
+L41951c:
+t5 = MEM_U32(sp + 376);
+t6 = MEM_U32(sp + 284);
+if (t5 == zero) {
+t8 = MEM_U32(sp + 476);
+goto L419534;}
+MEM_U32(sp + 380) = t6;
+t8 = MEM_U32(sp + 476);
+L419534:
+t7 = t8 & 0x1;
+if (t7 == zero) {
+t4 = MEM_U32(sp + 476);
+goto L4195d0;}
+v0 = MEM_U32(t0 + 0);
+t9 = MEM_U32(sp + 284);
+t4 = MEM_U32(v0 + 28);
+t5 = t9 + t3;
+MEM_U32(sp + 284) = t5;
+t3 = zero;
+MEM_U32(sp + 384) = t4;
+if (t4 == 0) goto L4195c8;
+t3 = MEM_U32(v0 + 28);
+MEM_U32(sp + 388) = t5;
+v1 = MEM_U32(v0 + 28);
+a1 = 0x10;
+t3 = t3 << 4;
+a2 = v1;
+if (v1 == 0) goto L4195c8;
+//nop;
+a0 = MEM_U32(v0 + 24);
+MEM_U32(sp + 288) = t3;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+t8 = 0x10015540;
+t8 = MEM_U32(t8 + 0);
+t7 = MEM_U32(t8 + 28);
+//nop;
+if (v0 == t7) goto L4195c8;
+//nop;
+a0 = s1;
+MEM_U32(sp + 288) = t3;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40040003 gp = MEM_U32(sp + 52);
+t3 = MEM_U32(sp + 288);
+L4195c8:
+t0 = 0x10015540;
+t4 = MEM_U32(sp + 476);
+L4195d0:
+t9 = t4 & 0x10;
+//nop;
+if (t9 == 0) goto L419688;
+v0 = MEM_U32(t0 + 0);
+t6 = MEM_U32(v0 + 60);
+//nop;
+if (t6 == 0) goto L419688;
+t5 = MEM_U32(v0 + 56);
+MEM_U32(t5 + 0) = zero;
+t8 = MEM_U32(t0 + 0);
+t7 = MEM_U32(t8 + 56);
+MEM_U32(t7 + 4) = zero;
+t4 = MEM_U32(t0 + 0);
+t9 = MEM_U32(t4 + 56);
+MEM_U32(t9 + 8) = zero;
+t6 = MEM_U32(t0 + 0);
+t5 = MEM_U32(t6 + 56);
+MEM_U32(t5 + 12) = zero;
+v0 = MEM_U32(t0 + 0);
+t7 = MEM_U32(sp + 284);
+t8 = MEM_U32(v0 + 60);
+t4 = t7 + t3;
+MEM_U32(sp + 284) = t4;
+MEM_U32(sp + 312) = t8;
+if (t8 == 0) goto L419688;
+MEM_U32(sp + 316) = t4;
+v1 = MEM_U32(v0 + 60);
+a1 = 0x8;
+//nop;
+if (v1 == 0) goto L419688;
+//nop;
+a0 = MEM_U32(v0 + 56);
+a2 = v1;
+a3 = MEM_U32(sp + 268);
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+// bdead 400401cb gp = MEM_U32(sp + 52);
+t6 = 0x10015540;
+t6 = MEM_U32(t6 + 0);
+t5 = MEM_U32(t6 + 60);
+//nop;
+if (v0 == t5) goto L419688;
+//nop;
+a0 = s1;
+//nop;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+L419688:
+//nop;
+a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fflush(mem, a0);
+// bdead 40000003 gp = MEM_U32(sp + 52);
+a0 = MEM_U32(sp + 268);
+a1 = MEM_U32(sp + 272);
+//nop;
+a2 = zero;
+//nop;
+v0 = wrapper_fseek(mem, a0, a1, a2);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+t8 = 0x70a;
+MEM_U16(sp + 298) = (uint16_t)t8;
+t7 = 0x10013660;
+//nop;
+a0 = sp + 0x128;
+t7 = MEM_S16(t7 + 0);
+a1 = 0x1;
+a2 = 0x60;
+a3 = MEM_U32(sp + 268);
+MEM_U16(sp + 296) = (uint16_t)t7;
+v0 = wrapper_fwrite(mem, a0, a1, a2, a3);
+at = 0x60;
+// bdead 400001c1 gp = MEM_U32(sp + 52);
+if (v0 == at) goto L419704;
+//nop;
+a0 = 0x10012124;
+a0 = a0;
+f_st_error(mem, sp, a0, a1, a2, a3);
+// bdead 40000001 gp = MEM_U32(sp + 52);
+L419704:
+//nop;
+a0 = MEM_U32(sp + 268);
+//nop;
+v0 = wrapper_fclose(mem, a0);
+// bdead 1 ra = MEM_U32(sp + 60);
+// bdead 1 gp = MEM_U32(sp + 52);
+// bdead 1 s0 = MEM_U32(sp + 20);
+// bdead 1 s1 = MEM_U32(sp + 24);
+// bdead 1 s2 = MEM_U32(sp + 28);
+// bdead 1 s3 = MEM_U32(sp + 32);
+// bdead 1 s4 = MEM_U32(sp + 36);
+// bdead 1 s5 = MEM_U32(sp + 40);
+// bdead 1 s6 = MEM_U32(sp + 44);
+// bdead 1 s7 = MEM_U32(sp + 48);
+// bdead 1 fp = MEM_U32(sp + 56);
+// bdead 1 sp = sp + 0x1d8;
+return;
+}
+
+static void f_swap_hdr(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L419da0:
+//swap_hdr:
+// fdead 4b MEM_U32(sp + 4) = a1;
+// fdead 4b v1 = MEM_S16(a0 + 0);
+// fdead 4b a1 = MEM_S16(a0 + 2);
+// fdead 4b a2 = MEM_U32(a0 + 4);
+// fdead 4b t8 = v1 & 0xffff;
+// fdead 4b t9 = t8 >> 8;
+// fdead 4b t7 = v1 << 8;
+// fdead 4b t1 = t7 | t9;
+t4 = a1 & 0xffff;
+v0 = 0xff0000;
+t5 = t4 >> 8;
+t3 = a1 << 8;
+// fdead 704b t7 = a2 << 8;
+// fdead 704b a3 = MEM_U32(a0 + 8);
+// fdead 704b MEM_U16(a0 + 0) = (uint16_t)t1;
+t6 = t3 | t5;
+// fdead f04b t9 = t7 & v0;
+// fdead f04b t8 = a2 << 24;
+// fdead f04b t1 = t8 | t9;
+// fdead f04b t2 = (int)a2 >> 8;
+// fdead f04b t4 = t2 & 0xff00;
+// fdead f04b MEM_U16(a0 + 2) = (uint16_t)t6;
+// fdead f04b t3 = t1 | t4;
+// fdead f04b t5 = a2 >> 24;
+// fdead f04b t8 = a3 << 8;
+// fdead f04b t0 = MEM_U32(a0 + 12);
+t6 = t3 | t5;
+// fdead f04b t9 = t8 & v0;
+// fdead f04b t7 = a3 << 24;
+// fdead f04b t2 = t7 | t9;
+// fdead f04b t1 = (int)a3 >> 8;
+// fdead f04b t4 = t1 & 0xff00;
+// fdead f04b MEM_U32(a0 + 4) = t6;
+// fdead f04b t3 = t2 | t4;
+// fdead f04b t5 = a3 >> 24;
+// fdead f04b t7 = t0 << 8;
+// fdead f04b v1 = MEM_U32(a0 + 16);
+t6 = t3 | t5;
+// fdead f04b t9 = t7 & v0;
+// fdead f04b t8 = t0 << 24;
+// fdead f04b t1 = t8 | t9;
+// fdead f04b t2 = (int)t0 >> 8;
+// fdead f04b t4 = t2 & 0xff00;
+// fdead f04b MEM_U32(a0 + 8) = t6;
+// fdead f04b t3 = t1 | t4;
+// fdead f04b t5 = t0 >> 24;
+// fdead f04b t8 = v1 << 8;
+// fdead f04b a1 = MEM_U32(a0 + 20);
+t6 = t3 | t5;
+// fdead f04b t9 = t8 & v0;
+// fdead f04b t7 = v1 << 24;
+// fdead f04b t2 = t7 | t9;
+// fdead f04b t1 = (int)v1 >> 8;
+// fdead f04b t4 = t1 & 0xff00;
+// fdead f04b MEM_U32(a0 + 12) = t6;
+// fdead f04b t3 = t2 | t4;
+// fdead f04b t5 = v1 >> 24;
+t7 = a1 << 8;
+// fdead 1f04b a2 = MEM_U32(a0 + 24);
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 16) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+// fdead 601fc4b a3 = MEM_U32(a0 + 28);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 20) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+// fdead 601fc4b v1 = MEM_U32(a0 + 32);
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 24) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+// fdead 601fc4b a1 = MEM_U32(a0 + 36);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 28) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+// fdead 601fc4b a2 = MEM_U32(a0 + 40);
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 32) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+// fdead 601fc4b a3 = MEM_U32(a0 + 44);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 36) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+// fdead 601fc4b v1 = MEM_U32(a0 + 48);
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 40) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+// fdead 601fc4b a1 = MEM_U32(a0 + 52);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 44) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+// fdead 601fc4b a2 = MEM_U32(a0 + 56);
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 48) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+// fdead 601fc4b a3 = MEM_U32(a0 + 60);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 52) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+// fdead 601fc4b v1 = MEM_U32(a0 + 64);
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 56) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+// fdead 601fc4b a1 = MEM_U32(a0 + 68);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 60) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+// fdead 601fc4b a2 = MEM_U32(a0 + 72);
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 64) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+// fdead 601fc4b a3 = MEM_U32(a0 + 76);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 68) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+// fdead 601fc4b t7 = a3 << 8;
+// fdead 601fc4b v1 = MEM_U32(a0 + 80);
+t6 = t3 | t5;
+t9 = t7 & v0;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 72) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+// fdead 601fc4b t8 = v1 << 8;
+// fdead 601fc4b a1 = MEM_U32(a0 + 84);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = v1 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)v1 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 76) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = v1 >> 24;
+t7 = a1 << 8;
+// fdead 601fc4b a2 = MEM_U32(a0 + 88);
+t6 = t3 | t5;
+t9 = t7 & v0;
+t8 = a1 << 24;
+t1 = t8 | t9;
+t2 = (int)a1 >> 8;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 80) = t6;
+t3 = t1 | t4;
+t5 = a1 >> 24;
+// fdead 601fc4b t8 = a2 << 8;
+// fdead 601fc4b a3 = MEM_U32(a0 + 92);
+t6 = t3 | t5;
+t9 = t8 & v0;
+// fdead 601fc4b t7 = a2 << 24;
+t2 = t7 | t9;
+// fdead 601fc4b t1 = (int)a2 >> 8;
+t4 = t1 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 84) = t6;
+t3 = t2 | t4;
+// fdead 601fc4b t5 = a2 >> 24;
+t6 = t3 | t5;
+// fdead 601fc4b t7 = a3 << 8;
+t9 = t7 & v0;
+// fdead 601fc4b t2 = (int)a3 >> 8;
+// fdead 601fc4b t8 = a3 << 24;
+t1 = t8 | t9;
+t4 = t2 & 0xff00;
+// fdead 601fc4b MEM_U32(a0 + 88) = t6;
+t3 = t1 | t4;
+// fdead 601fc4b t5 = a3 >> 24;
+t6 = t3 | t5;
+// fdead 601fc4b MEM_U32(a0 + 92) = t6;
+return;
+}
+
+static void f_swap_fd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t7 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0,
+t9 = 0;
+L41a1d0:
+//swap_fd:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffff70;
+//nop;
+// fdead 8b MEM_U32(sp + 52) = ra;
+// fdead 8b MEM_U32(sp + 44) = s5;
+// fdead 8b MEM_U32(sp + 40) = s4;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a0;
+// fdead 8b s4 = a1;
+s5 = a2;
+// fdead 40008b MEM_U32(sp + 48) = gp;
+// fdead 40008b MEM_U32(sp + 36) = s3;
+// fdead 40008b MEM_U32(sp + 32) = s2;
+// fdead 40008b MEM_U32(sp + 28) = s1;
+v0 = f_gethostsex(mem, sp);
+// fdead 40000b gp = MEM_U32(sp + 48);
+if ((int)s4 <= 0) goto L41a794;
+// fdead 40000b t6 = s4 << 3;
+// fdead 40000b t6 = t6 + s4;
+// fdead 40000b t6 = t6 << 3;
+// fdead 40000b s3 = t6 + s0;
+// fdead 40000b v1 = s0;
+s2 = 0xff0000;
+// fdead 48000b s1 = sp + 0x40;
+a0 = 0xff0000;
+// fdead 48002b t9 = v1;
+L41a240:
+// fdead 48002b t6 = s1;
+// fdead 48002b at = v1 + 0x48;
+L41a248:
+// fdead 48002b t8 = MEM_U32(t9 + 0);
+// fdead 48002b t9 = t9 + 0xc;
+// fdead 48002b t6 = t6 + 0xc;
+// fdead 48002b MEM_U32(t6 + -12) = t8;
+// fdead 48002b t7 = MEM_U32(t9 + -8);
+// fdead 48002b MEM_U32(t6 + -8) = t7;
+// fdead 48002b t8 = MEM_U32(t9 + -4);
+// fdead 48002b MEM_U32(t6 + -4) = t8;
+if (t9 != at) goto L41a248;
+// fdead 48002b t9 = MEM_U32(sp + 64);
+// fdead 48002b a1 = MEM_U32(sp + 84);
+// fdead 48002b a2 = MEM_U32(sp + 88);
+// fdead 48002b t7 = t9 << 8;
+// fdead 48002b t8 = t7 & s2;
+// fdead 48002b t6 = t9 << 24;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t6 = t9 >> 8;
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t6 = t7 | t8;
+// fdead 48002b t7 = t9 >> 24;
+// fdead 48002b t9 = MEM_U32(sp + 68);
+// fdead 48002b t8 = t6 | t7;
+// fdead 48002b MEM_U32(sp + 64) = t8;
+// fdead 48002b t7 = t9 << 8;
+// fdead 48002b t8 = t7 & a0;
+// fdead 48002b t6 = t9 << 24;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t6 = (int)t9 >> 8;
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t6 = MEM_U32(sp + 68);
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b a3 = MEM_U32(sp + 92);
+// fdead 48002b t7 = t6 >> 24;
+// fdead 48002b t6 = MEM_U32(sp + 72);
+// fdead 48002b t8 = t9 | t7;
+// fdead 48002b MEM_U32(sp + 68) = t8;
+// fdead 48002b t7 = t6 << 8;
+// fdead 48002b t8 = t7 & a0;
+// fdead 48002b t9 = t6 << 24;
+// fdead 48002b t7 = t9 | t8;
+// fdead 48002b t9 = (int)t6 >> 8;
+// fdead 48002b t8 = t9 & 0xff00;
+// fdead 48002b t9 = MEM_U32(sp + 72);
+// fdead 48002b t6 = t7 | t8;
+// fdead 48002b t0 = MEM_U32(sp + 96);
+// fdead 48002b t7 = t9 >> 24;
+// fdead 48002b t9 = MEM_U32(sp + 76);
+// fdead 48002b t8 = t6 | t7;
+// fdead 48002b MEM_U32(sp + 72) = t8;
+// fdead 48002b t7 = t9 << 8;
+// fdead 48002b t8 = t7 & a0;
+// fdead 48002b t6 = t9 << 24;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t6 = (int)t9 >> 8;
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t6 = MEM_U32(sp + 76);
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b t1 = MEM_U32(sp + 100);
+// fdead 48002b t7 = t6 >> 24;
+// fdead 48002b t6 = MEM_U32(sp + 80);
+// fdead 48002b t8 = t9 | t7;
+// fdead 48002b MEM_U32(sp + 76) = t8;
+// fdead 48002b t7 = t6 << 8;
+// fdead 48002b t8 = t7 & a0;
+// fdead 48002b t9 = t6 << 24;
+// fdead 48002b t7 = t9 | t8;
+// fdead 48002b t9 = (int)t6 >> 8;
+// fdead 48002b t8 = t9 & 0xff00;
+// fdead 48002b t9 = MEM_U32(sp + 80);
+// fdead 48002b t6 = t7 | t8;
+// fdead 48002b t2 = MEM_U32(sp + 108);
+// fdead 48002b t7 = t9 >> 24;
+// fdead 48002b t8 = t6 | t7;
+// fdead 48002b t6 = a1 << 8;
+// fdead 48002b t7 = t6 & a0;
+// fdead 48002b MEM_U32(sp + 80) = t8;
+// fdead 48002b t9 = a1 << 24;
+// fdead 48002b t8 = t9 | t7;
+// fdead 48002b t6 = (int)a1 >> 8;
+// fdead 48002b t9 = t6 & 0xff00;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b t6 = a1 >> 24;
+// fdead 48002b a1 = t7 | t6;
+// fdead 48002b t9 = a2 << 8;
+// fdead 48002b t7 = t9 & a0;
+// fdead 48002b t8 = a2 << 24;
+// fdead 48002b t6 = t8 | t7;
+// fdead 48002b t9 = (int)a2 >> 8;
+// fdead 48002b t8 = t9 & 0xff00;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t9 = a2 >> 24;
+// fdead 48002b a2 = t7 | t9;
+// fdead 48002b t8 = a3 << 8;
+// fdead 48002b t7 = t8 & a0;
+// fdead 48002b t6 = a3 << 24;
+// fdead 48002b t9 = t6 | t7;
+// fdead 48002b t8 = (int)a3 >> 8;
+// fdead 48002b t6 = t8 & 0xff00;
+// fdead 48002b t7 = t9 | t6;
+// fdead 48002b t8 = a3 >> 24;
+// fdead 48002b a3 = t7 | t8;
+// fdead 48002b t6 = t0 << 8;
+// fdead 48002b t7 = t6 & a0;
+// fdead 48002b t9 = t0 << 24;
+// fdead 48002b t8 = t9 | t7;
+// fdead 48002b t6 = (int)t0 >> 8;
+// fdead 48002b t9 = t6 & 0xff00;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b t6 = t0 >> 24;
+// fdead 48002b t0 = t7 | t6;
+// fdead 48002b t9 = t1 << 8;
+// fdead 48002b t7 = t9 & a0;
+// fdead 48002b t8 = t1 << 24;
+// fdead 48002b t6 = t8 | t7;
+// fdead 48002b t9 = (int)t1 >> 8;
+// fdead 48002b t8 = t9 & 0xff00;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t9 = t1 >> 24;
+// fdead 48002b t1 = t7 | t9;
+// fdead 48002b t9 = MEM_U16(sp + 104);
+// fdead 48002b t8 = MEM_S16(sp + 104);
+// fdead 48002b t3 = MEM_U32(sp + 112);
+// fdead 48002b t6 = t9 >> 8;
+// fdead 48002b t7 = t8 << 8;
+// fdead 48002b t8 = t7 | t6;
+// fdead 48002b MEM_U16(sp + 104) = (uint16_t)t8;
+// fdead 48002b t8 = MEM_U16(sp + 106);
+// fdead 48002b t7 = MEM_S16(sp + 106);
+// fdead 48002b t4 = MEM_U32(sp + 116);
+// fdead 48002b t9 = t8 >> 8;
+// fdead 48002b t6 = t7 << 8;
+// fdead 48002b t7 = t6 | t9;
+// fdead 48002b t6 = t2 << 8;
+// fdead 48002b t9 = t6 & a0;
+// fdead 48002b MEM_U16(sp + 106) = (uint16_t)t7;
+// fdead 48002b t8 = t2 << 24;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b t6 = (int)t2 >> 8;
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b t6 = t2 >> 24;
+// fdead 48002b t2 = t9 | t6;
+// fdead 48002b t8 = t3 << 8;
+// fdead 48002b t9 = t8 & a0;
+// fdead 48002b t7 = t3 << 24;
+// fdead 48002b t6 = t7 | t9;
+// fdead 48002b t8 = (int)t3 >> 8;
+// fdead 48002b t7 = t8 & 0xff00;
+// fdead 48002b t9 = t6 | t7;
+// fdead 48002b t8 = t3 >> 24;
+// fdead 48002b t3 = t9 | t8;
+// fdead 48002b t7 = t4 << 8;
+// fdead 48002b t9 = t7 & a0;
+// fdead 48002b t6 = t4 << 24;
+// fdead 48002b t8 = t6 | t9;
+// fdead 48002b t7 = (int)t4 >> 8;
+// fdead 48002b t5 = MEM_U32(sp + 120);
+// fdead 48002b t6 = t7 & 0xff00;
+// fdead 48002b t9 = t8 | t6;
+// fdead 48002b t7 = t4 >> 24;
+// fdead 48002b t4 = t9 | t7;
+// fdead 48002b t6 = t5 << 8;
+// fdead 48002b t9 = t6 & a0;
+// fdead 48002b t8 = t5 << 24;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b t6 = (int)t5 >> 8;
+// fdead 48002b ra = MEM_U32(sp + 128);
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b t6 = t5 >> 24;
+// fdead 48002b t5 = t9 | t6;
+// fdead 48002b t8 = ra << 8;
+// fdead 48002b t9 = t8 & a0;
+// fdead 48002b t7 = ra << 24;
+// fdead 48002b t6 = t7 | t9;
+// fdead 48002b t8 = (int)ra >> 8;
+// fdead 48002b s0 = MEM_U32(sp + 132);
+// fdead 48002b t7 = t8 & 0xff00;
+// fdead 48002b t9 = t6 | t7;
+// fdead 48002b t8 = ra >> 24;
+// fdead 48002b ra = t9 | t8;
+// fdead 48002b t7 = s0 << 8;
+// fdead 48002b t9 = t7 & a0;
+// fdead 48002b t6 = s0 << 24;
+// fdead 48002b t8 = t6 | t9;
+// fdead 48002b t7 = (int)s0 >> 8;
+// fdead 48002b t6 = t7 & 0xff00;
+// fdead 48002b t9 = t8 | t6;
+// fdead 48002b t7 = s0 >> 24;
+// fdead 48002b s0 = t9 | t7;
+// fdead 48002b MEM_U32(sp + 132) = s0;
+// fdead 48002b MEM_U32(sp + 128) = ra;
+// fdead 48002b MEM_U32(sp + 120) = t5;
+// fdead 48002b MEM_U32(sp + 116) = t4;
+// fdead 48002b MEM_U32(sp + 112) = t3;
+// fdead 48002b MEM_U32(sp + 108) = t2;
+// fdead 48002b MEM_U32(sp + 100) = t1;
+// fdead 48002b MEM_U32(sp + 96) = t0;
+// fdead 48002b MEM_U32(sp + 92) = a3;
+// fdead 48002b MEM_U32(sp + 88) = a2;
+// fdead 48002b MEM_U32(sp + 84) = a1;
+if (s5 != v0) goto L41a678;
+// fdead 48002b t9 = s1;
+// fdead 48002b t7 = v1;
+// fdead 48002b at = s1 + 0x48;
+L41a57c:
+// fdead 48002b t6 = MEM_U32(t9 + 0);
+// fdead 48002b t9 = t9 + 0xc;
+// fdead 48002b t7 = t7 + 0xc;
+// fdead 48002b MEM_U32(t7 + -12) = t6;
+// fdead 48002b t8 = MEM_U32(t9 + -8);
+// fdead 48002b MEM_U32(t7 + -8) = t8;
+// fdead 48002b t6 = MEM_U32(t9 + -4);
+// fdead 48002b MEM_U32(t7 + -4) = t6;
+if (t9 != at) goto L41a57c;
+// fdead 48002b t9 = MEM_U32(sp + 124);
+// fdead 48002b t8 = t9 << 8;
+// fdead 48002b t6 = t8 & s2;
+// fdead 48002b t7 = t9 << 24;
+// fdead 48002b t8 = t7 | t6;
+// fdead 48002b t7 = t9 >> 8;
+// fdead 48002b t6 = t7 & 0xff00;
+// fdead 48002b t7 = t8 | t6;
+// fdead 48002b t8 = t9 >> 24;
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b MEM_U32(sp + 124) = t9;
+// fdead 48002b t6 = MEM_U8(v1 + 60);
+// fdead 48002b t8 = t9 << 3;
+// fdead 48002b t9 = t6 & 0xff07;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 48002b t6 = MEM_U32(sp + 124);
+// fdead 48002b t8 = t6 << 26;
+// fdead 48002b t9 = t8 >> 31;
+// fdead 48002b t8 = MEM_U8(v1 + 60);
+// fdead 48002b t7 = t9 << 2;
+// fdead 48002b t6 = t7 & 0x4;
+// fdead 48002b t9 = t8 & 0xfffb;
+// fdead 48002b t7 = t6 | t9;
+// fdead 48002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 48002b t8 = MEM_U32(sp + 124);
+// fdead 48002b t6 = t8 << 25;
+// fdead 48002b t9 = t6 >> 31;
+// fdead 48002b t6 = MEM_U8(v1 + 60);
+// fdead 48002b t7 = t9 << 1;
+// fdead 48002b t8 = t7 & 0x2;
+// fdead 48002b t9 = t6 & 0xfffd;
+// fdead 48002b t7 = t8 | t9;
+// fdead 48002b MEM_U8(v1 + 60) = (uint8_t)t7;
+// fdead 48002b t6 = MEM_U8(sp + 127);
+// fdead 48002b t8 = t6 >> 7;
+// fdead 48002b t9 = t8 & 0x1;
+// fdead 48002b t6 = t7 & 0xfffe;
+// fdead 48002b t8 = t9 | t6;
+// fdead 48002b MEM_U8(v1 + 60) = (uint8_t)t8;
+// fdead 48002b t9 = MEM_U8(sp + 126);
+// fdead 48002b t7 = MEM_U8(v1 + 61);
+// fdead 48002b t8 = t9 << 6;
+// fdead 48002b t9 = t7 & 0xff3f;
+// fdead 48002b t6 = t8 | t9;
+// fdead 48002b MEM_U8(v1 + 61) = (uint8_t)t6;
+// fdead 48002b t7 = MEM_U32(sp + 124);
+// fdead 48002b t9 = t7 >> 10;
+// fdead 48002b t7 = MEM_U16(v1 + 62);
+// fdead 48002b t6 = t9 & 0x1fff;
+// fdead 48002b t8 = t7 & 0xe000;
+// fdead 48002b t9 = t6 | t8;
+// fdead 48002b MEM_U16(v1 + 62) = (uint16_t)t9;
+goto L41a788;
+L41a678:
+// fdead 48002b t7 = MEM_U32(v1 + 60);
+// fdead 48002b t9 = MEM_U8(sp + 127);
+// fdead 48002b at = s1 + 0x48;
+// fdead 48002b t6 = t7 >> 27;
+// fdead 48002b t8 = t6 & 0x1f;
+// fdead 48002b t7 = t9 & 0xffe0;
+// fdead 48002b t6 = t8 | t7;
+// fdead 48002b MEM_U8(sp + 127) = (uint8_t)t6;
+// fdead 48002b t9 = MEM_U32(v1 + 60);
+// fdead 48002b t8 = t9 << 5;
+// fdead 48002b t7 = t8 >> 31;
+// fdead 48002b t9 = t7 << 5;
+// fdead 48002b t8 = t9 & 0x20;
+// fdead 48002b t7 = t6;
+// fdead 48002b t9 = t7 & 0xdf;
+// fdead 48002b t6 = t8 | t9;
+// fdead 48002b MEM_U8(sp + 127) = (uint8_t)t6;
+// fdead 48002b t7 = MEM_U32(v1 + 60);
+// fdead 48002b t8 = t7 << 6;
+// fdead 48002b t9 = t8 >> 31;
+// fdead 48002b t7 = t9 << 6;
+// fdead 48002b t8 = t7 & 0x40;
+// fdead 48002b t9 = t6;
+// fdead 48002b t7 = t9 & 0xbf;
+// fdead 48002b t6 = t8 | t7;
+// fdead 48002b MEM_U8(sp + 127) = (uint8_t)t6;
+// fdead 48002b t8 = MEM_U8(v1 + 60);
+// fdead 48002b t9 = t8 << 7;
+// fdead 48002b t8 = t6;
+// fdead 48002b t7 = t8 & 0x7f;
+// fdead 48002b t6 = t9 | t7;
+// fdead 48002b MEM_U8(sp + 127) = (uint8_t)t6;
+// fdead 48002b t8 = MEM_U8(v1 + 61);
+// fdead 48002b t6 = MEM_U8(sp + 126);
+// fdead 48002b t9 = t8 >> 6;
+// fdead 48002b t7 = t9 & 0x3;
+// fdead 48002b t8 = t6 & 0xfffc;
+// fdead 48002b t9 = t7 | t8;
+// fdead 48002b MEM_U8(sp + 126) = (uint8_t)t9;
+// fdead 48002b t8 = MEM_U32(sp + 124);
+// fdead 48002b t6 = MEM_U32(v1 + 60);
+// fdead 48002b t9 = t8 >> 10;
+// fdead 48002b t7 = t6 & 0x1fff;
+// fdead 48002b t6 = t7 ^ t9;
+// fdead 48002b t7 = t6 << 10;
+// fdead 48002b t9 = t7 ^ t8;
+// fdead 48002b t7 = t9 << 8;
+// fdead 48002b t8 = t7 & s2;
+// fdead 48002b t6 = t9 << 24;
+// fdead 48002b t7 = t6 | t8;
+// fdead 48002b t6 = t9 >> 8;
+// fdead 48002b t8 = t6 & 0xff00;
+// fdead 48002b t6 = t7 | t8;
+// fdead 48002b t7 = t9 >> 24;
+// fdead 48002b t8 = t6 | t7;
+// fdead 48002b MEM_U32(sp + 124) = t9;
+// fdead 48002b MEM_U32(sp + 124) = t8;
+// fdead 48002b t8 = v1;
+// fdead 48002b t7 = s1;
+L41a764:
+// fdead 48002b t6 = MEM_U32(t7 + 0);
+// fdead 48002b t7 = t7 + 0xc;
+// fdead 48002b t8 = t8 + 0xc;
+// fdead 48002b MEM_U32(t8 + -12) = t6;
+// fdead 48002b t9 = MEM_U32(t7 + -8);
+// fdead 48002b MEM_U32(t8 + -8) = t9;
+// fdead 48002b t6 = MEM_U32(t7 + -4);
+// fdead 48002b MEM_U32(t8 + -4) = t6;
+if (t7 != at) goto L41a764;
+L41a788:
+// fdead 48002b v1 = v1 + 0x48;
+if (v1 != s3) {
+// fdead 48002b t9 = v1;
+goto L41a240;}
+L41a794:
+// fdead 48002b ra = MEM_U32(sp + 52);
+// fdead 48002b s0 = MEM_U32(sp + 24);
+// fdead 48002b s1 = MEM_U32(sp + 28);
+// fdead 48002b s2 = MEM_U32(sp + 32);
+// fdead 48002b s3 = MEM_U32(sp + 36);
+// fdead 48002b s4 = MEM_U32(sp + 40);
+// fdead 48002b s5 = MEM_U32(sp + 44);
+// fdead 48002b sp = sp + 0x90;
+return;
+}
+
+static void f_swap_fi(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41a7b8:
+//swap_fi:
+// fdead 8b MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41a8e4;
+// fdead 8b a2 = a1 & 0x3;
+a3 = a2;
+if (a2 == 0) goto L41a818;
+t6 = zero << 2;
+// fdead 818b v1 = a0 + t6;
+t1 = 0xff0000;
+L41a7dc:
+// fdead 601fd8b a2 = MEM_U32(v1 + 0);
+v0 = v0 + 0x1;
+// fdead 601fd8b v1 = v1 + 0x4;
+t8 = a2 << 8;
+t9 = t8 & t1;
+t7 = a2 << 24;
+t3 = (int)a2 >> 8;
+t4 = t3 & 0xff00;
+t2 = t7 | t9;
+t5 = t2 | t4;
+t6 = a2 >> 24;
+t8 = t6 | t5;
+// fdead 601fd8b MEM_U32(v1 + -4) = t8;
+if (a3 != v0) goto L41a7dc;
+if (v0 == a1) {
+t7 = v0 << 2;
+goto L41a8e4;}
+L41a818:
+t7 = v0 << 2;
+// fdead 601fd8b t9 = a1 << 2;
+// fdead 601fd8b t0 = t9 + a0;
+// fdead 601fd8b v1 = a0 + t7;
+t1 = 0xff0000;
+L41a82c:
+// fdead 601fd8b a2 = MEM_U32(v1 + 0);
+// fdead 601fd8b v0 = MEM_U32(v1 + 4);
+// fdead 601fd8b a0 = MEM_U32(v1 + 8);
+t2 = a2 << 8;
+t4 = t2 & t1;
+t3 = a2 << 24;
+t5 = (int)a2 >> 8;
+t8 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = t6 | t8;
+t9 = a2 >> 24;
+t2 = t9 | t7;
+t4 = v0 << 8;
+t5 = t4 & t1;
+t8 = (int)v0 >> 8;
+t3 = v0 << 24;
+t6 = t3 | t5;
+t9 = t8 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 0) = t2;
+t7 = t6 | t9;
+t2 = v0 >> 24;
+t4 = t2 | t7;
+// fdead 601fd8b t5 = a0 << 8;
+// fdead 601fd8b a3 = MEM_U32(v1 + 12);
+t8 = t5 & t1;
+// fdead 601fd8b t9 = (int)a0 >> 8;
+// fdead 601fd8b t3 = a0 << 24;
+t6 = t3 | t8;
+t2 = t9 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 4) = t4;
+t7 = t6 | t2;
+// fdead 601fd8b t4 = a0 >> 24;
+t5 = t4 | t7;
+t8 = a3 << 8;
+t9 = t8 & t1;
+t2 = (int)a3 >> 8;
+t3 = a3 << 24;
+t6 = t3 | t9;
+t4 = t2 & 0xff00;
+// fdead 601fd8b MEM_U32(v1 + 8) = t5;
+t7 = t6 | t4;
+t5 = a3 >> 24;
+t8 = t5 | t7;
+// fdead 601fd8b v1 = v1 + 0x10;
+// fdead 601fd8b MEM_U32(v1 + -4) = t8;
+if (v1 != t0) goto L41a82c;
+L41a8e4:
+//nop;
+return;
+}
+
+static void f_swap_sym(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41a8ec:
+//swap_sym:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffb8;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+// fdead 4000b a0 = MEM_U32(sp + 72);
+if ((int)s0 <= 0) goto L41ab5c;
+// fdead 4000b t6 = s0 << 2;
+// fdead 4000b t6 = t6 - s0;
+// fdead 4000b t6 = t6 << 2;
+// fdead 4000b t0 = t6 + a0;
+// fdead 4000b v1 = a0;
+a3 = 0xff0000;
+a2 = 0xff0000;
+// fdead 4018b a1 = sp + 0x34;
+// fdead 4018b t8 = MEM_U32(v1 + 0);
+L41a950:
+// fdead 4018f MEM_U32(a1 + 0) = t8;
+// fdead 4018f t7 = MEM_U32(v1 + 4);
+// fdead 4018f MEM_U32(a1 + 4) = t7;
+// fdead 4018f t8 = MEM_U32(v1 + 8);
+// fdead 4018f MEM_U32(a1 + 8) = t8;
+// fdead 4018f t9 = MEM_U32(sp + 52);
+// fdead 4018f t2 = t9 << 8;
+// fdead 4018f t3 = t2 & a2;
+// fdead 4018f t1 = t9 << 24;
+// fdead 4018f t4 = t1 | t3;
+// fdead 4018f t3 = MEM_U32(sp + 56);
+// fdead 4018f t5 = (int)t9 >> 8;
+// fdead 4018f t6 = t5 & 0xff00;
+// fdead 4018f t7 = t4 | t6;
+// fdead 4018f t2 = t9 >> 24;
+// fdead 4018f t5 = t3 << 8;
+// fdead 4018f t1 = t7 | t2;
+// fdead 4018f t4 = t5 & a2;
+// fdead 4018f t9 = t3 << 24;
+// fdead 4018f t8 = (int)t3 >> 8;
+// fdead 4018f t7 = t8 & 0xff00;
+// fdead 4018f t6 = t9 | t4;
+// fdead 4018f t2 = t6 | t7;
+// fdead 4018f t5 = t3 >> 24;
+// fdead 4018f t9 = t2 | t5;
+// fdead 4018f MEM_U32(sp + 52) = t1;
+// fdead 4018f MEM_U32(sp + 56) = t9;
+if (s1 != v0) goto L41aa84;
+// fdead 4018f t3 = MEM_U32(a1 + 0);
+// fdead 4018f MEM_U32(v1 + 0) = t3;
+// fdead 4018f t4 = MEM_U32(a1 + 4);
+// fdead 4018f MEM_U32(v1 + 4) = t4;
+// fdead 4018f t3 = MEM_U32(a1 + 8);
+// fdead 4018f MEM_U32(v1 + 8) = t3;
+// fdead 4018f t8 = MEM_U32(sp + 60);
+// fdead 4018f t7 = t8 << 8;
+// fdead 4018f t1 = t7 & a3;
+// fdead 4018f t6 = t8 << 24;
+// fdead 4018f t5 = t8 >> 8;
+// fdead 4018f t9 = t5 & 0xff00;
+// fdead 4018f t2 = t6 | t1;
+// fdead 4018f t4 = t2 | t9;
+// fdead 4018f t3 = t8 >> 24;
+// fdead 4018f t6 = t4 | t3;
+// fdead 4018f MEM_U32(sp + 60) = t6;
+// fdead 4018f t2 = MEM_U8(v1 + 8);
+// fdead 4018f t5 = t6 << 2;
+// fdead 4018f t9 = t2 & 0xff03;
+// fdead 4018f t8 = t5 | t9;
+// fdead 4018f MEM_U8(v1 + 8) = (uint8_t)t8;
+// fdead 4018f t4 = MEM_U32(sp + 60);
+// fdead 4018f t2 = MEM_U16(v1 + 8);
+// fdead 4018f t3 = t4 << 21;
+// fdead 4018f t7 = t3 >> 27;
+// fdead 4018f t6 = t7 << 5;
+// fdead 4018f t1 = t6 & 0x3e0;
+// fdead 4018f t5 = t2 & 0xfc1f;
+// fdead 4018f t9 = t1 | t5;
+// fdead 4018f MEM_U16(v1 + 8) = (uint16_t)t9;
+// fdead 4018f t8 = MEM_U32(sp + 60);
+// fdead 4018f t2 = MEM_U8(v1 + 9);
+// fdead 4018f t4 = t8 << 20;
+// fdead 4018f t3 = t4 >> 31;
+// fdead 4018f t7 = t3 << 4;
+// fdead 4018f t6 = t7 & 0x10;
+// fdead 4018f t1 = t2 & 0xffef;
+// fdead 4018f t5 = t6 | t1;
+// fdead 4018f MEM_U8(v1 + 9) = (uint8_t)t5;
+// fdead 4018f t9 = MEM_U32(sp + 60);
+// fdead 4018f a0 = MEM_U32(v1 + 8);
+// fdead 4018f t8 = t9 >> 12;
+// fdead 4018f t4 = t8 ^ a0;
+// fdead 4018f t3 = t4 << 12;
+// fdead 4018f t7 = t3 >> 12;
+// fdead 4018f t2 = t7 ^ a0;
+// fdead 4018f MEM_U32(v1 + 8) = t2;
+goto L41ab50;
+L41aa84:
+// fdead 4018f t6 = MEM_U32(v1 + 8);
+// fdead 4018f t9 = MEM_U8(sp + 63);
+at = 0xf0000;
+// fdead 4018f t1 = t6 >> 26;
+// fdead 4018f t5 = t1 & 0x3f;
+// fdead 4018f t8 = t9 & 0xffc0;
+// fdead 4018f t4 = t5 | t8;
+// fdead 4018f MEM_U8(sp + 63) = (uint8_t)t4;
+// fdead 4018f t3 = MEM_U32(v1 + 8);
+// fdead 4018f t9 = MEM_U16(sp + 62);
+at = at | 0xffff;
+// fdead 4018f t7 = t3 << 6;
+// fdead 4018f t2 = t7 >> 27;
+// fdead 4018f t6 = t2 << 6;
+// fdead 4018f t1 = t6 & 0x7c0;
+// fdead 4018f t5 = t9 & 0xf83f;
+// fdead 4018f t8 = t1 | t5;
+// fdead 4018f MEM_U16(sp + 62) = (uint16_t)t8;
+// fdead 4018f t4 = MEM_U32(v1 + 8);
+// fdead 4018f t9 = MEM_U8(sp + 62);
+// fdead 4018f t3 = t4 << 11;
+// fdead 4018f t7 = t3 >> 31;
+// fdead 4018f t2 = t7 << 3;
+// fdead 4018f t6 = t2 & 0x8;
+// fdead 4018f t1 = t9 & 0xfff7;
+// fdead 4018f t5 = t6 | t1;
+// fdead 4018f MEM_U8(sp + 62) = (uint8_t)t5;
+// fdead 4018f t8 = MEM_U32(v1 + 8);
+// fdead 4018f t3 = MEM_U32(sp + 60);
+// fdead 4018f t4 = t8 & at;
+// fdead 4018f t7 = t3 >> 12;
+// fdead 4018f t2 = t4 ^ t7;
+// fdead 4018f t9 = t2 << 12;
+// fdead 4018f t6 = t9 ^ t3;
+// fdead 4018f t5 = t6 << 8;
+// fdead 4018f t8 = t5 & a3;
+// fdead 4018f t1 = t6 << 24;
+// fdead 4018f t7 = t6 >> 8;
+// fdead 4018f t2 = t7 & 0xff00;
+// fdead 4018f t4 = t1 | t8;
+// fdead 4018f t9 = t4 | t2;
+// fdead 4018f t3 = t6 >> 24;
+// fdead 4018f MEM_U32(sp + 60) = t6;
+// fdead 4018f t5 = t9 | t3;
+// fdead 4018f MEM_U32(sp + 60) = t5;
+// fdead 4018f t8 = MEM_U32(a1 + 0);
+// fdead 4018f MEM_U32(v1 + 0) = t8;
+// fdead 4018f t1 = MEM_U32(a1 + 4);
+// fdead 4018f MEM_U32(v1 + 4) = t1;
+// fdead 4018f t8 = MEM_U32(a1 + 8);
+// fdead 4018f MEM_U32(v1 + 8) = t8;
+L41ab50:
+// fdead 4018f v1 = v1 + 0xc;
+if (v1 != t0) {
+// fdead 4018f t8 = MEM_U32(v1 + 0);
+goto L41a950;}
+L41ab5c:
+// fdead 4018f ra = MEM_U32(sp + 36);
+// fdead 4018f s0 = MEM_U32(sp + 24);
+// fdead 4018f s1 = MEM_U32(sp + 28);
+// fdead 4018f sp = sp + 0x48;
+return;
+}
+
+static void f_swap_ext(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41ab70:
+//swap_ext:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffb8;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+// fdead 4000b a0 = MEM_U32(sp + 72);
+if ((int)s0 <= 0) goto L41af44;
+// fdead 4000b t6 = s0 << 4;
+// fdead 4000b t0 = t6 + a0;
+// fdead 4000b v1 = a0;
+a3 = 0xff0000;
+// fdead 4010b a2 = sp + 0x30;
+a1 = 0xff0000;
+// fdead 4014b t8 = MEM_U32(v1 + 0);
+L41abcc:
+// fdead 4014f MEM_U32(a2 + 0) = t8;
+// fdead 4014f t7 = MEM_U32(v1 + 4);
+// fdead 4014f MEM_U32(a2 + 4) = t7;
+// fdead 4014f t8 = MEM_U32(v1 + 8);
+// fdead 4014f MEM_U32(a2 + 8) = t8;
+// fdead 4014f t7 = MEM_U32(v1 + 12);
+// fdead 4014f MEM_U32(a2 + 12) = t7;
+// fdead 4014f t9 = MEM_U32(sp + 52);
+// fdead 4014f t2 = t9 << 8;
+// fdead 4014f t3 = t2 & a3;
+// fdead 4014f t1 = t9 << 24;
+// fdead 4014f t4 = t1 | t3;
+// fdead 4014f t3 = MEM_U32(sp + 56);
+// fdead 4014f t5 = (int)t9 >> 8;
+// fdead 4014f t6 = t5 & 0xff00;
+// fdead 4014f t7 = t4 | t6;
+// fdead 4014f t2 = t9 >> 24;
+// fdead 4014f t5 = t3 << 8;
+// fdead 4014f t1 = t7 | t2;
+// fdead 4014f t4 = t5 & a3;
+// fdead 4014f t9 = t3 << 24;
+// fdead 4014f t8 = (int)t3 >> 8;
+// fdead 4014f t7 = t8 & 0xff00;
+// fdead 4014f t6 = t9 | t4;
+// fdead 4014f t2 = t6 | t7;
+// fdead 4014f t5 = t3 >> 24;
+// fdead 4014f t9 = t2 | t5;
+// fdead 4014f MEM_U32(sp + 52) = t1;
+// fdead 4014f MEM_U32(sp + 56) = t9;
+if (s1 != v0) goto L41adb8;
+// fdead 4014f t3 = MEM_U32(a2 + 0);
+// fdead 4014f MEM_U32(v1 + 0) = t3;
+// fdead 4014f t4 = MEM_U32(a2 + 4);
+// fdead 4014f MEM_U32(v1 + 4) = t4;
+// fdead 4014f t3 = MEM_U32(a2 + 8);
+// fdead 4014f MEM_U32(v1 + 8) = t3;
+// fdead 4014f t4 = MEM_U32(a2 + 12);
+// fdead 4014f MEM_U32(v1 + 12) = t4;
+// fdead 4014f t8 = MEM_U32(sp + 60);
+// fdead 4014f t7 = t8 << 8;
+// fdead 4014f t1 = t7 & a1;
+// fdead 4014f t6 = t8 << 24;
+// fdead 4014f t5 = t8 >> 8;
+// fdead 4014f t9 = t5 & 0xff00;
+// fdead 4014f t2 = t6 | t1;
+// fdead 4014f t4 = t2 | t9;
+// fdead 4014f t3 = t8 >> 24;
+// fdead 4014f t6 = t4 | t3;
+// fdead 4014f MEM_U32(sp + 60) = t6;
+// fdead 4014f t2 = MEM_U8(v1 + 12);
+// fdead 4014f t5 = t6 << 2;
+// fdead 4014f t9 = t2 & 0xff03;
+// fdead 4014f t8 = t5 | t9;
+// fdead 4014f MEM_U8(v1 + 12) = (uint8_t)t8;
+// fdead 4014f t4 = MEM_U32(sp + 60);
+// fdead 4014f t2 = MEM_U16(v1 + 12);
+// fdead 4014f t3 = t4 << 21;
+// fdead 4014f t7 = t3 >> 27;
+// fdead 4014f t6 = t7 << 5;
+// fdead 4014f t1 = t6 & 0x3e0;
+// fdead 4014f t5 = t2 & 0xfc1f;
+// fdead 4014f t9 = t1 | t5;
+// fdead 4014f MEM_U16(v1 + 12) = (uint16_t)t9;
+// fdead 4014f t8 = MEM_U32(sp + 60);
+// fdead 4014f t2 = MEM_U8(v1 + 13);
+// fdead 4014f t4 = t8 << 20;
+// fdead 4014f t3 = t4 >> 31;
+// fdead 4014f t7 = t3 << 4;
+// fdead 4014f t6 = t7 & 0x10;
+// fdead 4014f t1 = t2 & 0xffef;
+// fdead 4014f t5 = t6 | t1;
+// fdead 4014f MEM_U8(v1 + 13) = (uint8_t)t5;
+// fdead 4014f t9 = MEM_U32(sp + 60);
+// fdead 4014f a0 = MEM_U32(v1 + 12);
+// fdead 4014f t8 = t9 >> 12;
+// fdead 4014f t4 = t8 ^ a0;
+// fdead 4014f t3 = t4 << 12;
+// fdead 4014f t7 = t3 >> 12;
+// fdead 4014f t2 = t7 ^ a0;
+// fdead 4014f MEM_U32(v1 + 12) = t2;
+// fdead 4014f t6 = MEM_U32(sp + 48);
+// fdead 4014f t5 = t6 << 8;
+// fdead 4014f t9 = t5 & a1;
+// fdead 4014f t1 = t6 << 24;
+// fdead 4014f t4 = t6 >> 8;
+// fdead 4014f t3 = t4 & 0xff00;
+// fdead 4014f t8 = t1 | t9;
+// fdead 4014f t7 = t8 | t3;
+// fdead 4014f t2 = t6 >> 24;
+// fdead 4014f t5 = t7 | t2;
+// fdead 4014f MEM_U32(sp + 48) = t5;
+// fdead 4014f t1 = MEM_S16(sp + 48);
+// fdead 4014f t6 = MEM_U16(v1 + 0);
+// fdead 4014f MEM_U16(v1 + 2) = (uint16_t)t1;
+// fdead 4014f t9 = MEM_U16(sp + 50);
+// fdead 4014f t7 = t6 & 0xf800;
+// fdead 4014f t8 = t9 >> 3;
+// fdead 4014f t3 = t8 & 0x7ff;
+// fdead 4014f t2 = t3 | t7;
+// fdead 4014f MEM_U16(v1 + 0) = (uint16_t)t2;
+// fdead 4014f t8 = MEM_U8(v1 + 0);
+// fdead 4014f t1 = MEM_U32(sp + 48);
+// fdead 4014f t6 = t8 & 0xff7f;
+// fdead 4014f t4 = t1 << 7;
+// fdead 4014f t8 = t4 | t6;
+// fdead 4014f MEM_U8(v1 + 0) = (uint8_t)t8;
+// fdead 4014f t7 = MEM_U32(sp + 48);
+// fdead 4014f t4 = t8 & 0xbf;
+// fdead 4014f t2 = t7 << 30;
+// fdead 4014f t5 = t2 >> 31;
+// fdead 4014f t1 = t5 << 6;
+// fdead 4014f t9 = t1 & 0x40;
+// fdead 4014f t8 = t9 | t4;
+// fdead 4014f MEM_U8(v1 + 0) = (uint8_t)t8;
+// fdead 4014f t3 = MEM_U32(sp + 48);
+// fdead 4014f t9 = t8 & 0xdf;
+// fdead 4014f t7 = t3 << 29;
+// fdead 4014f t2 = t7 >> 31;
+// fdead 4014f t5 = t2 << 5;
+// fdead 4014f t1 = t5 & 0x20;
+// fdead 4014f t4 = t1 | t9;
+// fdead 4014f MEM_U8(v1 + 0) = (uint8_t)t4;
+goto L41af38;
+L41adb8:
+// fdead 4014f t6 = MEM_U32(v1 + 12);
+// fdead 4014f t2 = MEM_U8(sp + 63);
+at = 0xf0000;
+// fdead 4014f t3 = t6 >> 26;
+// fdead 4014f t7 = t3 & 0x3f;
+// fdead 4014f t5 = t2 & 0xffc0;
+// fdead 4014f t8 = t7 | t5;
+// fdead 4014f MEM_U8(sp + 63) = (uint8_t)t8;
+// fdead 4014f t1 = MEM_U32(v1 + 12);
+// fdead 4014f t2 = MEM_U16(sp + 62);
+at = at | 0xffff;
+// fdead 4014f t9 = t1 << 6;
+// fdead 4014f t4 = t9 >> 27;
+// fdead 4014f t6 = t4 << 6;
+// fdead 4014f t3 = t6 & 0x7c0;
+// fdead 4014f t7 = t2 & 0xf83f;
+// fdead 4014f t5 = t3 | t7;
+// fdead 4014f MEM_U16(sp + 62) = (uint16_t)t5;
+// fdead 4014f t8 = MEM_U32(v1 + 12);
+// fdead 4014f t2 = MEM_U8(sp + 62);
+// fdead 4014f t1 = t8 << 11;
+// fdead 4014f t9 = t1 >> 31;
+// fdead 4014f t4 = t9 << 3;
+// fdead 4014f t6 = t4 & 0x8;
+// fdead 4014f t3 = t2 & 0xfff7;
+// fdead 4014f t7 = t6 | t3;
+// fdead 4014f MEM_U8(sp + 62) = (uint8_t)t7;
+// fdead 4014f t5 = MEM_U32(v1 + 12);
+// fdead 4014f t1 = MEM_U32(sp + 60);
+// fdead 4014f t8 = t5 & at;
+// fdead 4014f t9 = t1 >> 12;
+// fdead 4014f t4 = t8 ^ t9;
+// fdead 4014f t2 = t4 << 12;
+// fdead 4014f t6 = t2 ^ t1;
+// fdead 4014f t7 = t6 << 8;
+// fdead 4014f t5 = t7 & a1;
+// fdead 4014f t3 = t6 << 24;
+// fdead 4014f t9 = t6 >> 8;
+// fdead 4014f t4 = t9 & 0xff00;
+// fdead 4014f t8 = t3 | t5;
+// fdead 4014f t2 = t8 | t4;
+// fdead 4014f t1 = t6 >> 24;
+// fdead 4014f MEM_U32(sp + 60) = t6;
+// fdead 4014f t7 = t2 | t1;
+// fdead 4014f MEM_U32(sp + 60) = t7;
+// fdead 4014f t3 = MEM_U16(v1 + 2);
+// fdead 4014f t6 = MEM_U16(sp + 50);
+// fdead 4014f MEM_U16(sp + 48) = (uint16_t)t3;
+// fdead 4014f t5 = MEM_U16(v1 + 0);
+// fdead 4014f t2 = t6 & 0x7;
+// fdead 4014f t9 = t5 & 0x7ff;
+// fdead 4014f t4 = t9 << 3;
+// fdead 4014f t1 = t4 | t2;
+// fdead 4014f MEM_U16(sp + 50) = (uint16_t)t1;
+// fdead 4014f t7 = MEM_U32(v1 + 0);
+// fdead 4014f t6 = MEM_U8(sp + 51);
+// fdead 4014f t3 = t7 << 2;
+// fdead 4014f t5 = t3 >> 31;
+// fdead 4014f t9 = t5 << 2;
+// fdead 4014f t8 = t9 & 0x4;
+// fdead 4014f t4 = t6 & 0xfffb;
+// fdead 4014f t6 = t8 | t4;
+// fdead 4014f MEM_U8(sp + 51) = (uint8_t)t6;
+// fdead 4014f t1 = MEM_U32(v1 + 0);
+// fdead 4014f t8 = t6 & 0xfd;
+// fdead 4014f t7 = t1 << 1;
+// fdead 4014f t3 = t7 >> 31;
+// fdead 4014f t5 = t3 << 1;
+// fdead 4014f t9 = t5 & 0x2;
+// fdead 4014f t5 = t9 | t8;
+// fdead 4014f MEM_U8(sp + 51) = (uint8_t)t5;
+// fdead 4014f t1 = MEM_U32(v1 + 0);
+// fdead 4014f t2 = t5 & 0xfe;
+// fdead 4014f t7 = t1 >> 31;
+// fdead 4014f t3 = t7 & 0x1;
+// fdead 4014f t6 = t3 | t2;
+// fdead 4014f MEM_U8(sp + 51) = (uint8_t)t6;
+// fdead 4014f t9 = MEM_U32(sp + 48);
+// fdead 4014f t1 = t9 << 8;
+// fdead 4014f t7 = t1 & a1;
+// fdead 4014f t8 = t9 << 24;
+// fdead 4014f t5 = t9 >> 8;
+// fdead 4014f t3 = t5 & 0xff00;
+// fdead 4014f t4 = t8 | t7;
+// fdead 4014f t2 = t4 | t3;
+// fdead 4014f t6 = t9 >> 24;
+// fdead 4014f t1 = t2 | t6;
+// fdead 4014f MEM_U32(sp + 48) = t1;
+// fdead 4014f t7 = MEM_U32(a2 + 0);
+// fdead 4014f MEM_U32(v1 + 0) = t7;
+// fdead 4014f t8 = MEM_U32(a2 + 4);
+// fdead 4014f MEM_U32(v1 + 4) = t8;
+// fdead 4014f t7 = MEM_U32(a2 + 8);
+// fdead 4014f MEM_U32(v1 + 8) = t7;
+// fdead 4014f t8 = MEM_U32(a2 + 12);
+// fdead 4014f MEM_U32(v1 + 12) = t8;
+L41af38:
+// fdead 4014f v1 = v1 + 0x10;
+if (v1 != t0) {
+// fdead 4014f t8 = MEM_U32(v1 + 0);
+goto L41abcc;}
+L41af44:
+// fdead 4014f ra = MEM_U32(sp + 36);
+// fdead 4014f s0 = MEM_U32(sp + 24);
+// fdead 4014f s1 = MEM_U32(sp + 28);
+// fdead 4014f sp = sp + 0x48;
+return;
+}
+
+static void f_swap_pd(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t v0 = 0, v1 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41af58:
+//swap_pd:
+// fdead 8b MEM_U32(sp + 8) = a2;
+if ((int)a1 <= 0) goto L41b1cc;
+// fdead 8b t6 = a1 << 2;
+// fdead 8b t6 = t6 - a1;
+// fdead 8b t6 = t6 << 2;
+// fdead 8b t6 = t6 + a1;
+// fdead 8b t6 = t6 << 2;
+// fdead 8b a3 = t6 + a0;
+// fdead 8b v0 = a0;
+t1 = 0xff0000;
+t0 = 0xff0000;
+L41af84:
+v1 = MEM_U32(v0 + 0);
+a0 = MEM_U32(v0 + 4);
+v0 = v0 + 0x34;
+t7 = v1 >> 24;
+t8 = v1 << 24;
+t2 = v1 << 8;
+t3 = t2 & t0;
+t9 = t7 | t8;
+t5 = v1 >> 8;
+t6 = t5 & 0xff00;
+t4 = t9 | t3;
+t7 = t4 | t6;
+t2 = a0 << 8;
+v1 = MEM_U32(v0 + -44);
+t9 = t2 & t1;
+t5 = (int)a0 >> 8;
+t8 = a0 << 24;
+MEM_U32(v0 + -52) = t7;
+t3 = t8 | t9;
+t4 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = a0 >> 24;
+t2 = t7 | t6;
+t9 = v1 << 8;
+a0 = MEM_U32(v0 + -40);
+t5 = t9 & t1;
+t4 = (int)v1 >> 8;
+t8 = v1 << 24;
+MEM_U32(v0 + -48) = t2;
+t3 = t8 | t5;
+t7 = t4 & 0xff00;
+t6 = t3 | t7;
+t2 = v1 >> 24;
+t9 = t2 | t6;
+t5 = a0 << 8;
+v1 = MEM_U32(v0 + -36);
+t4 = t5 & t1;
+t7 = (int)a0 >> 8;
+t8 = a0 << 24;
+MEM_U32(v0 + -44) = t9;
+t3 = t8 | t4;
+t2 = t7 & 0xff00;
+t6 = t3 | t2;
+t9 = a0 >> 24;
+t5 = t9 | t6;
+t4 = v1 << 8;
+a0 = MEM_U32(v0 + -32);
+t7 = t4 & t1;
+t2 = (int)v1 >> 8;
+t8 = v1 << 24;
+MEM_U32(v0 + -40) = t5;
+t3 = t8 | t7;
+t9 = t2 & 0xff00;
+t6 = t3 | t9;
+t5 = v1 >> 24;
+t4 = t5 | t6;
+t7 = a0 << 8;
+v1 = MEM_U32(v0 + -28);
+t2 = t7 & t1;
+t9 = (int)a0 >> 8;
+t8 = a0 << 24;
+MEM_U32(v0 + -36) = t4;
+t3 = t8 | t2;
+t5 = t9 & 0xff00;
+t6 = t3 | t5;
+t4 = a0 >> 24;
+t7 = t4 | t6;
+t2 = v1 << 8;
+a0 = MEM_U32(v0 + -24);
+t9 = t2 & t1;
+t5 = (int)v1 >> 8;
+t8 = v1 << 24;
+MEM_U32(v0 + -32) = t7;
+t3 = t8 | t9;
+t4 = t5 & 0xff00;
+t6 = t3 | t4;
+t7 = v1 >> 24;
+t2 = t7 | t6;
+t9 = a0 << 8;
+v1 = MEM_U32(v0 + -20);
+t5 = t9 & t1;
+t4 = (int)a0 >> 8;
+t8 = a0 << 24;
+MEM_U32(v0 + -28) = t2;
+t3 = t8 | t5;
+t7 = t4 & 0xff00;
+t6 = t3 | t7;
+t2 = a0 >> 24;
+t9 = t2 | t6;
+t5 = v1 << 8;
+t4 = t5 & t1;
+t7 = (int)v1 >> 8;
+t8 = v1 << 24;
+MEM_U32(v0 + -24) = t9;
+t3 = t8 | t4;
+t2 = t7 & 0xff00;
+t6 = t3 | t2;
+t9 = v1 >> 24;
+t7 = MEM_S16(v0 + -16);
+t5 = t9 | t6;
+MEM_U32(v0 + -20) = t5;
+t5 = MEM_S16(v0 + -14);
+t8 = t7 & 0xffff;
+v1 = MEM_U32(v0 + -12);
+t4 = t8 >> 8;
+t3 = t7 << 8;
+t2 = t4 | t3;
+t9 = t5 & 0xffff;
+t6 = t9 >> 8;
+t8 = t5 << 8;
+t7 = t6 | t8;
+MEM_U16(v0 + -16) = (uint16_t)t2;
+t3 = v1 << 8;
+a0 = MEM_U32(v0 + -8);
+t2 = t3 & t1;
+t5 = (int)v1 >> 8;
+t4 = v1 << 24;
+MEM_U16(v0 + -14) = (uint16_t)t7;
+t9 = t4 | t2;
+t6 = t5 & 0xff00;
+t8 = t9 | t6;
+t7 = v1 >> 24;
+t3 = t7 | t8;
+t2 = a0 << 8;
+v1 = MEM_U32(v0 + -4);
+t5 = t2 & t1;
+t6 = (int)a0 >> 8;
+t4 = a0 << 24;
+MEM_U32(v0 + -12) = t3;
+t9 = t4 | t5;
+t7 = t6 & 0xff00;
+t8 = t9 | t7;
+t3 = a0 >> 24;
+t2 = t3 | t8;
+t5 = v1 << 8;
+t6 = t5 & t1;
+t7 = (int)v1 >> 8;
+t4 = v1 << 24;
+MEM_U32(v0 + -8) = t2;
+t9 = t4 | t6;
+t3 = t7 & 0xff00;
+t8 = t9 | t3;
+t2 = v1 >> 24;
+t5 = t2 | t8;
+MEM_U32(v0 + -4) = t5;
+if (v0 != a3) goto L41af84;
+L41b1cc:
+//nop;
+return;
+}
+
+static void f_swap_dn(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0,
+t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41b1d4:
+//swap_dn:
+// fdead 8b MEM_U32(sp + 8) = a2;
+v0 = zero;
+if ((int)a1 <= 0) goto L41b318;
+// fdead 8b v1 = a1 & 0x1;
+t1 = 0xff0000;
+if (v1 == 0) goto L41b24c;
+// fdead 48b a2 = MEM_U32(a0 + 0);
+// fdead 48b a3 = MEM_U32(a0 + 4);
+v0 = 0x1;
+t6 = a2 >> 24;
+t7 = a2 << 24;
+t9 = a2 << 8;
+t2 = t9 & t1;
+t8 = t6 | t7;
+t4 = a2 >> 8;
+t5 = t4 & 0xff00;
+t3 = t8 | t2;
+t6 = t3 | t5;
+// fdead 601fc8b t2 = a3 << 8;
+// fdead 601fc8b t7 = a3 >> 24;
+// fdead 601fc8b t9 = a3 << 24;
+t8 = t7 | t9;
+t4 = t2 & t1;
+// fdead 601fc8b MEM_U32(a0 + 0) = t6;
+// fdead 601fc8b t5 = a3 >> 8;
+t6 = t5 & 0xff00;
+t3 = t8 | t4;
+t7 = t3 | t6;
+// fdead 601fc8b MEM_U32(a0 + 4) = t7;
+if (v0 == a1) goto L41b318;
+L41b24c:
+t9 = v0 << 3;
+// fdead 601fc8b t2 = a1 << 3;
+// fdead 601fc8b t0 = t2 + a0;
+// fdead 601fc8b v1 = a0 + t9;
+t1 = 0xff0000;
+L41b260:
+// fdead 601fc8b v0 = MEM_U32(v1 + 0);
+// fdead 601fc8b a0 = MEM_U32(v1 + 4);
+// fdead 601fc8b a2 = MEM_U32(v1 + 8);
+t8 = v0 >> 24;
+t4 = v0 << 24;
+t3 = v0 << 8;
+t6 = t3 & t1;
+t5 = t8 | t4;
+t9 = v0 >> 8;
+t2 = t9 & 0xff00;
+t7 = t5 | t6;
+t8 = t7 | t2;
+// fdead 601fc8b t6 = a0 << 8;
+// fdead 601fc8b t4 = a0 >> 24;
+// fdead 601fc8b t3 = a0 << 24;
+// fdead 601fc8b MEM_U32(v1 + 0) = t8;
+t5 = t4 | t3;
+t9 = t6 & t1;
+// fdead 601fc8b t2 = a0 >> 8;
+t8 = t2 & 0xff00;
+t7 = t5 | t9;
+t4 = t7 | t8;
+// fdead 601fc8b a3 = MEM_U32(v1 + 12);
+t9 = a2 << 8;
+t6 = a2 << 24;
+t3 = a2 >> 24;
+t5 = t3 | t6;
+t2 = t9 & t1;
+// fdead 601fc8b MEM_U32(v1 + 4) = t4;
+t8 = a2 >> 8;
+t4 = t8 & 0xff00;
+t7 = t5 | t2;
+t3 = t7 | t4;
+// fdead 601fc8b t2 = a3 << 8;
+// fdead 601fc8b t9 = a3 << 24;
+// fdead 601fc8b t6 = a3 >> 24;
+t5 = t6 | t9;
+t8 = t2 & t1;
+// fdead 601fc8b MEM_U32(v1 + 8) = t3;
+// fdead 601fc8b t4 = a3 >> 8;
+t3 = t4 & 0xff00;
+t7 = t5 | t8;
+t6 = t7 | t3;
+// fdead 601fc8b v1 = v1 + 0x10;
+// fdead 601fc8b MEM_U32(v1 + -4) = t6;
+if (v1 != t0) goto L41b260;
+L41b318:
+//nop;
+return;
+}
+
+static void f_swap_opt(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+uint32_t at = 0, v0 = 0, v1 = 0, t0 = 0, s0 = 0, s1 = 0;
+L41b4e0:
+//swap_opt:
+//nop;
+//nop;
+//nop;
+// fdead 8b sp = sp + 0xffffffb8;
+//nop;
+// fdead 8b MEM_U32(sp + 36) = ra;
+// fdead 8b MEM_U32(sp + 28) = s1;
+// fdead 8b MEM_U32(sp + 24) = s0;
+// fdead 8b s0 = a1;
+s1 = a2;
+// fdead 4008b MEM_U32(sp + 32) = gp;
+// fdead 4008b MEM_U32(sp + 72) = a0;
+v0 = f_gethostsex(mem, sp);
+// fdead 4000b gp = MEM_U32(sp + 32);
+// fdead 4000b a0 = MEM_U32(sp + 72);
+if ((int)s0 <= 0) goto L41b74c;
+// fdead 4000b t6 = s0 << 2;
+// fdead 4000b t6 = t6 - s0;
+// fdead 4000b t6 = t6 << 2;
+// fdead 4000b t0 = t6 + a0;
+// fdead 4000b v1 = a0;
+// fdead 4000b a3 = sp + 0x34;
+a2 = 0xff0000;
+// fdead 4008b t8 = MEM_U32(v1 + 0);
+L41b540:
+// fdead 4008f MEM_U32(a3 + 0) = t8;
+// fdead 4008f t7 = MEM_U32(v1 + 4);
+// fdead 4008f MEM_U32(a3 + 4) = t7;
+// fdead 4008f t8 = MEM_U32(v1 + 8);
+// fdead 4008f MEM_U32(a3 + 8) = t8;
+// fdead 4008f t9 = MEM_U32(sp + 60);
+// fdead 4008f t2 = t9 << 8;
+// fdead 4008f t3 = t2 & a2;
+// fdead 4008f t1 = t9 << 24;
+// fdead 4008f t5 = t9 >> 8;
+// fdead 4008f t6 = t5 & 0xff00;
+// fdead 4008f t4 = t1 | t3;
+// fdead 4008f t7 = t4 | t6;
+// fdead 4008f t8 = t9 >> 24;
+// fdead 4008f t2 = t7 | t8;
+// fdead 4008f MEM_U32(sp + 60) = t2;
+if (s1 != v0) goto L41b660;
+// fdead 4008f t3 = MEM_U32(a3 + 0);
+at = 0xff0000;
+at = at | 0xffff;
+// fdead 4008f MEM_U32(v1 + 0) = t3;
+// fdead 4008f t1 = MEM_U32(a3 + 4);
+// fdead 4008f MEM_U32(v1 + 4) = t1;
+// fdead 4008f t3 = MEM_U32(a3 + 8);
+// fdead 4008f MEM_U32(v1 + 8) = t3;
+// fdead 4008f t5 = MEM_U32(sp + 52);
+// fdead 4008f t6 = t5 << 8;
+// fdead 4008f t9 = t6 & a2;
+// fdead 4008f t4 = t5 << 24;
+// fdead 4008f t7 = t4 | t9;
+// fdead 4008f t4 = MEM_U32(sp + 56);
+// fdead 4008f t8 = t5 >> 8;
+// fdead 4008f t2 = t8 & 0xff00;
+// fdead 4008f t1 = t7 | t2;
+// fdead 4008f t3 = t5 >> 24;
+// fdead 4008f t6 = t1 | t3;
+// fdead 4008f t8 = t4 << 8;
+// fdead 4008f t7 = t8 & a2;
+// fdead 4008f t9 = t4 << 24;
+// fdead 4008f MEM_U32(sp + 52) = t6;
+// fdead 4008f t2 = t9 | t7;
+// fdead 4008f t5 = t4 >> 8;
+// fdead 4008f t1 = t5 & 0xff00;
+// fdead 4008f t9 = MEM_U8(sp + 52);
+// fdead 4008f t3 = t2 | t1;
+// fdead 4008f t6 = t4 >> 24;
+// fdead 4008f t8 = t3 | t6;
+// fdead 4008f MEM_U32(sp + 56) = t8;
+// fdead 4008f MEM_U8(v1 + 0) = (uint8_t)t9;
+// fdead 4008f t7 = MEM_U32(sp + 52);
+// fdead 4008f a0 = MEM_U32(v1 + 0);
+// fdead 4008f a1 = MEM_U32(v1 + 4);
+// fdead 4008f t5 = t7 & at;
+// fdead 4008f t2 = t5 ^ a0;
+// fdead 4008f t1 = t2 << 8;
+// fdead 4008f t4 = t1 >> 8;
+// fdead 4008f t3 = t4 ^ a0;
+// fdead 4008f MEM_U32(v1 + 0) = t3;
+// fdead 4008f t6 = MEM_U32(sp + 56);
+// fdead 4008f t8 = t6 >> 12;
+// fdead 4008f t9 = t8 ^ a1;
+// fdead 4008f t7 = t9 << 12;
+// fdead 4008f t5 = t7 >> 12;
+// fdead 4008f t2 = t5 ^ a1;
+// fdead 4008f MEM_U32(v1 + 4) = t2;
+// fdead 4008f t8 = MEM_U16(v1 + 4);
+// fdead 4008f t4 = MEM_U32(sp + 56);
+// fdead 4008f t9 = t8 & 0xf;
+// fdead 4008f t6 = t4 << 4;
+// fdead 4008f t7 = t6 | t9;
+// fdead 4008f MEM_U16(v1 + 4) = (uint16_t)t7;
+goto L41b740;
+L41b660:
+// fdead 4008f t5 = MEM_U8(v1 + 0);
+at = 0xff0000;
+at = at | 0xffff;
+// fdead 4008f MEM_U8(sp + 52) = (uint8_t)t5;
+// fdead 4008f t2 = MEM_U32(v1 + 0);
+// fdead 4008f t4 = MEM_U32(sp + 52);
+// fdead 4008f t1 = t2 & at;
+// fdead 4008f t3 = t1 ^ t4;
+// fdead 4008f t8 = t3 << 8;
+// fdead 4008f t6 = t8 >> 8;
+// fdead 4008f t9 = t6 ^ t4;
+// fdead 4008f MEM_U32(sp + 52) = t9;
+// fdead 4008f t7 = MEM_U32(v1 + 4);
+// fdead 4008f t2 = MEM_U32(sp + 56);
+at = 0xf0000;
+at = at | 0xffff;
+// fdead 4008f t5 = t7 & at;
+// fdead 4008f t1 = t2 >> 12;
+// fdead 4008f t3 = t5 ^ t1;
+// fdead 4008f t8 = t3 << 12;
+// fdead 4008f t6 = t8 ^ t2;
+// fdead 4008f MEM_U32(sp + 56) = t6;
+// fdead 4008f t4 = MEM_U32(v1 + 4);
+// fdead 4008f t1 = MEM_U16(sp + 58);
+// fdead 4008f t6 = t9 << 8;
+// fdead 4008f t7 = t4 >> 20;
+// fdead 4008f t5 = t7 & 0xfff;
+// fdead 4008f t3 = t1 & 0xf000;
+// fdead 4008f t8 = t5 | t3;
+// fdead 4008f t4 = t6 & a2;
+// fdead 4008f t2 = t9 << 24;
+// fdead 4008f MEM_U16(sp + 58) = (uint16_t)t8;
+// fdead 4008f t7 = t2 | t4;
+// fdead 4008f t2 = MEM_U32(sp + 56);
+// fdead 4008f t1 = t9 >> 8;
+// fdead 4008f t5 = t1 & 0xff00;
+// fdead 4008f t3 = t7 | t5;
+// fdead 4008f t8 = t9 >> 24;
+// fdead 4008f t6 = t3 | t8;
+// fdead 4008f t1 = t2 << 8;
+// fdead 4008f t7 = t1 & a2;
+// fdead 4008f t9 = t2 >> 8;
+// fdead 4008f t4 = t2 << 24;
+// fdead 4008f MEM_U32(sp + 52) = t6;
+// fdead 4008f t5 = t4 | t7;
+// fdead 4008f t3 = t9 & 0xff00;
+// fdead 4008f t8 = t5 | t3;
+// fdead 4008f t6 = t2 >> 24;
+// fdead 4008f t1 = t8 | t6;
+// fdead 4008f MEM_U32(sp + 56) = t1;
+// fdead 4008f t7 = MEM_U32(a3 + 0);
+// fdead 4008f MEM_U32(v1 + 0) = t7;
+// fdead 4008f t4 = MEM_U32(a3 + 4);
+// fdead 4008f MEM_U32(v1 + 4) = t4;
+// fdead 4008f t7 = MEM_U32(a3 + 8);
+// fdead 4008f MEM_U32(v1 + 8) = t7;
+L41b740:
+// fdead 4008f v1 = v1 + 0xc;
+if (v1 != t0) {
+// fdead 4008f t8 = MEM_U32(v1 + 0);
+goto L41b540;}
+L41b74c:
+// fdead 4008f ra = MEM_U32(sp + 36);
+// fdead 4008f s0 = MEM_U32(sp + 24);
+// fdead 4008f s1 = MEM_U32(sp + 28);
+// fdead 4008f sp = sp + 0x48;
+return;
+}
+
+static uint32_t f_ldfsymorder(uint8_t *mem, uint32_t sp) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, a1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0,
+t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41c5f0:
+//ldfsymorder:
+// fdead b a2 = MEM_U32(a0 + 12);
+// fdead b v0 = a1 + 0x60;
+if (a2 == zero) {
+// fdead b v1 = MEM_U32(a0 + 8);
+goto L41c620;}
+// fdead b t6 = MEM_U32(a0 + 8);
+if (t6 == zero) {
+// fdead b v1 = MEM_U32(a0 + 8);
+goto L41c620;}
+if (v0 == a2) {
+// fdead b v1 = MEM_U32(a0 + 8);
+goto L41c620;}
+v0 = zero;
+return v0;
+// fdead 0 v1 = MEM_U32(a0 + 8);
+L41c620:
+// fdead b t7 = v1 & 0x3;
+if (t7 == zero) {
+// fdead b a1 = MEM_U32(a0 + 28);
+goto L41c638;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 28);
+L41c638:
+if (a1 == zero) {
+// fdead b t0 = MEM_U32(a0 + 24);
+goto L41c664;}
+// fdead b t8 = MEM_U32(a0 + 24);
+if (t8 == zero) {
+// fdead b t0 = MEM_U32(a0 + 24);
+goto L41c664;}
+// fdead b t9 = v0 + v1;
+if (t9 == a1) {
+// fdead b t0 = MEM_U32(a0 + 24);
+goto L41c664;}
+v0 = zero;
+return v0;
+// fdead 0 t0 = MEM_U32(a0 + 24);
+L41c664:
+// fdead b t1 = t0 << 2;
+// fdead b t1 = t1 - t0;
+// fdead b t1 = t1 << 2;
+// fdead b t1 = t1 + t0;
+// fdead b t1 = t1 << 2;
+// fdead b v1 = v1 + t1;
+// fdead b t2 = v1 & 0x3;
+if (t2 == zero) {
+// fdead b a1 = MEM_U32(a0 + 36);
+goto L41c694;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 36);
+L41c694:
+if (a1 == zero) {
+// fdead b t5 = MEM_U32(a0 + 32);
+goto L41c6c0;}
+// fdead b t3 = MEM_U32(a0 + 32);
+// fdead b t4 = v0 + v1;
+if (t3 == zero) {
+// fdead b t5 = MEM_U32(a0 + 32);
+goto L41c6c0;}
+if (t4 == a1) {
+// fdead b t5 = MEM_U32(a0 + 32);
+goto L41c6c0;}
+v0 = zero;
+return v0;
+// fdead 0 t5 = MEM_U32(a0 + 32);
+L41c6c0:
+a2 = 0xc;
+// fdead 8b lo = t5 * a2; hi = (uint32_t)((uint64_t)t5 * (uint64_t)a2 >> 32);
+// fdead 8b t6 = lo;
+// fdead 8b v1 = v1 + t6;
+// fdead 8b t7 = v1 & 0x3;
+if (t7 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 44);
+goto L41c6e8;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 44);
+L41c6e8:
+if (a1 == zero) {
+// fdead 8b t0 = MEM_U32(a0 + 40);
+goto L41c714;}
+// fdead 8b t8 = MEM_U32(a0 + 40);
+if (t8 == zero) {
+// fdead 8b t0 = MEM_U32(a0 + 40);
+goto L41c714;}
+// fdead 8b t9 = v0 + v1;
+if (t9 == a1) {
+// fdead 8b t0 = MEM_U32(a0 + 40);
+goto L41c714;}
+v0 = zero;
+return v0;
+// fdead 0 t0 = MEM_U32(a0 + 40);
+L41c714:
+// fdead 8b lo = t0 * a2; hi = (uint32_t)((uint64_t)t0 * (uint64_t)a2 >> 32);
+// fdead 8b t1 = lo;
+// fdead 8b v1 = v1 + t1;
+// fdead 8b t2 = v1 & 0x3;
+if (t2 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 52);
+goto L41c738;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 52);
+L41c738:
+if (a1 == zero) {
+// fdead 8b t5 = MEM_U32(a0 + 48);
+goto L41c764;}
+// fdead 8b t3 = MEM_U32(a0 + 48);
+// fdead 8b t4 = v0 + v1;
+if (t3 == zero) {
+// fdead 8b t5 = MEM_U32(a0 + 48);
+goto L41c764;}
+if (t4 == a1) {
+// fdead 8b t5 = MEM_U32(a0 + 48);
+goto L41c764;}
+v0 = zero;
+return v0;
+// fdead 0 t5 = MEM_U32(a0 + 48);
+L41c764:
+// fdead 8b t6 = t5 << 2;
+// fdead 8b v1 = v1 + t6;
+// fdead 8b t7 = v1 & 0x3;
+if (t7 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 60);
+goto L41c784;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 60);
+L41c784:
+if (a1 == zero) {
+// fdead 8b t0 = MEM_U32(a0 + 56);
+goto L41c7b0;}
+// fdead 8b t8 = MEM_U32(a0 + 56);
+if (t8 == zero) {
+// fdead 8b t0 = MEM_U32(a0 + 56);
+goto L41c7b0;}
+// fdead 8b t9 = v0 + v1;
+if (t9 == a1) {
+// fdead 8b t0 = MEM_U32(a0 + 56);
+goto L41c7b0;}
+v0 = zero;
+return v0;
+// fdead 0 t0 = MEM_U32(a0 + 56);
+L41c7b0:
+// fdead 8b v1 = v1 + t0;
+// fdead 8b t1 = v1 & 0x3;
+if (t1 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 68);
+goto L41c7cc;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 68);
+L41c7cc:
+if (a1 == zero) {
+// fdead 8b t4 = MEM_U32(a0 + 64);
+goto L41c7f8;}
+// fdead 8b t2 = MEM_U32(a0 + 64);
+// fdead 8b t3 = v0 + v1;
+if (t2 == zero) {
+// fdead 8b t4 = MEM_U32(a0 + 64);
+goto L41c7f8;}
+if (t3 == a1) {
+// fdead 8b t4 = MEM_U32(a0 + 64);
+goto L41c7f8;}
+v0 = zero;
+return v0;
+// fdead 0 t4 = MEM_U32(a0 + 64);
+L41c7f8:
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+if (t5 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 76);
+goto L41c814;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 76);
+L41c814:
+if (a1 == zero) {
+// fdead 8b t8 = MEM_U32(a0 + 72);
+goto L41c840;}
+// fdead 8b t6 = MEM_U32(a0 + 72);
+// fdead 8b t7 = v0 + v1;
+if (t6 == zero) {
+// fdead 8b t8 = MEM_U32(a0 + 72);
+goto L41c840;}
+if (t7 == a1) {
+// fdead 8b t8 = MEM_U32(a0 + 72);
+goto L41c840;}
+v0 = zero;
+return v0;
+// fdead 0 t8 = MEM_U32(a0 + 72);
+L41c840:
+// fdead 8b t9 = t8 << 3;
+// fdead 8b t9 = t9 + t8;
+// fdead 8b t9 = t9 << 3;
+// fdead 8b v1 = v1 + t9;
+// fdead 8b t0 = v1 & 0x3;
+if (t0 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 84);
+goto L41c868;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 84);
+L41c868:
+if (a1 == zero) {
+// fdead 8b t3 = MEM_U32(a0 + 80);
+goto L41c894;}
+// fdead 8b t1 = MEM_U32(a0 + 80);
+// fdead 8b t2 = v0 + v1;
+if (t1 == zero) {
+// fdead 8b t3 = MEM_U32(a0 + 80);
+goto L41c894;}
+if (t2 == a1) {
+// fdead 8b t3 = MEM_U32(a0 + 80);
+goto L41c894;}
+v0 = zero;
+return v0;
+// fdead 0 t3 = MEM_U32(a0 + 80);
+L41c894:
+// fdead 8b t4 = t3 << 2;
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+if (t5 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 92);
+goto L41c8b4;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 92);
+L41c8b4:
+if (a1 == zero) {
+// fdead 8b t8 = MEM_U32(a0 + 88);
+goto L41c8e0;}
+// fdead 8b t6 = MEM_U32(a0 + 88);
+// fdead 8b t7 = v0 + v1;
+if (t6 == zero) {
+// fdead 8b t8 = MEM_U32(a0 + 88);
+goto L41c8e0;}
+if (t7 == a1) {
+// fdead 8b t8 = MEM_U32(a0 + 88);
+goto L41c8e0;}
+v0 = zero;
+return v0;
+// fdead 0 t8 = MEM_U32(a0 + 88);
+L41c8e0:
+// fdead 8b t9 = t8 << 4;
+// fdead 8b v1 = v1 + t9;
+// fdead 8b t0 = v1 & 0x3;
+if (t0 == zero) {
+// fdead 8b a1 = MEM_U32(a0 + 20);
+goto L41c900;}
+v0 = zero;
+return v0;
+// fdead 0 a1 = MEM_U32(a0 + 20);
+L41c900:
+if (a1 == zero) {
+// fdead 8b t3 = MEM_U32(a0 + 16);
+goto L41c92c;}
+// fdead 8b t1 = MEM_U32(a0 + 16);
+// fdead 8b t2 = v0 + v1;
+if (t1 == zero) {
+// fdead 8b t3 = MEM_U32(a0 + 16);
+goto L41c92c;}
+if (t2 == a1) {
+// fdead 8b t3 = MEM_U32(a0 + 16);
+goto L41c92c;}
+v0 = zero;
+return v0;
+// fdead 0 t3 = MEM_U32(a0 + 16);
+L41c92c:
+// fdead 8b t4 = t3 << 3;
+// fdead 8b v1 = v1 + t4;
+// fdead 8b t5 = v1 & 0x3;
+// fdead 8b v0 = v1;
+if (t5 == 0) goto L41c948;
+v0 = zero;
+return v0;
+L41c948:
+//nop;
+return v0;
+}
+
+static uint32_t f_xrealloc(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, a2 = 0;
+L41c950:
+//xrealloc:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 36) = ra;
+// fdead 400001eb MEM_U32(sp + 32) = gp;
+a2 = 0x10015548;
+v0 = f_alloc_resize(mem, sp, a0, a1, a2);
+// bdead 9 ra = MEM_U32(sp + 36);
+// bdead 9 gp = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static void f_alloc_dispose(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0, t2 = 0,
+t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41c998:
+//alloc_dispose:
+t0 = MEM_U32(a1 + 0);
+a2 = a0 + 0xfffffff8;
+v0 = MEM_U32(t0 + 0);
+a3 = t0;
+if (v0 == zero) {
+a0 = MEM_U32(a2 + 4);
+goto L41caac;}
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41ca14;
+if ((int)a2 < (int)a3) {
+a3 = MEM_U32(a3 + 4);
+goto L41c9e4;}
+v1 = MEM_U32(a3 + 12);
+t8 = v1;
+if ((int)v1 >= 0) goto L41c9d0;
+t8 = -v1;
+L41c9d0:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L41ca14;
+a3 = MEM_U32(a3 + 4);
+L41c9e4:
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41ca14;
+if ((int)a2 < (int)a3) {
+a3 = MEM_U32(a3 + 4);
+goto L41c9e4;}
+t6 = MEM_U32(a3 + 12);
+t7 = t6;
+if ((int)t6 >= 0) goto L41ca04;
+t7 = -t6;
+L41ca04:
+v0 = a3 + t7;
+if ((int)v0 < (int)a2) {
+a3 = MEM_U32(a3 + 4);
+goto L41c9e4;}
+L41ca14:
+if (a3 != zero) {
+v1 = MEM_U32(a3 + 12);
+goto L41ca90;}
+a3 = t0;
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41ca84;
+if ((int)a2 < (int)a3) {
+a3 = MEM_U32(a3 + 0);
+goto L41ca54;}
+v1 = MEM_U32(a3 + 12);
+t8 = v1;
+if ((int)v1 >= 0) goto L41ca40;
+t8 = -v1;
+L41ca40:
+t9 = a3 + t8;
+//nop;
+if ((int)t9 >= (int)a2) goto L41ca84;
+a3 = MEM_U32(a3 + 0);
+L41ca54:
+at = (int)a2 < (int)a3;
+if (a3 == 0) goto L41ca84;
+if ((int)a2 < (int)a3) {
+a3 = MEM_U32(a3 + 0);
+goto L41ca54;}
+t6 = MEM_U32(a3 + 12);
+t7 = t6;
+if ((int)t6 >= 0) goto L41ca74;
+t7 = -t6;
+L41ca74:
+v0 = a3 + t7;
+if ((int)v0 < (int)a2) {
+a3 = MEM_U32(a3 + 0);
+goto L41ca54;}
+L41ca84:
+//nop;
+if (a3 == 0) goto L41cc38;
+v1 = MEM_U32(a3 + 12);
+L41ca90:
+if ((int)v1 >= 0) {
+a0 = MEM_U32(a2 + 4);
+goto L41caac;}
+a3 = MEM_U32(a3 + 0);
+L41ca9c:
+t8 = MEM_U32(a3 + 12);
+if ((int)t8 < 0) {
+a3 = MEM_U32(a3 + 0);
+goto L41ca9c;}
+a0 = MEM_U32(a2 + 4);
+L41caac:
+t4 = 0xfffffffc;
+a1 = a0 & t4;
+t1 = a2 + a1;
+t0 = t1;
+t2 = MEM_U32(t0 + 4);
+t9 = a0 & 0x2;
+t3 = t2 & t4;
+if (t9 != 0) goto L41cb94;
+t1 = MEM_U32(a2 + 0);
+t6 = t2 & 0x1;
+a0 = t1;
+t4 = a2 - a0;
+if (t6 != 0) goto L41cb48;
+t7 = a0 + a1;
+a0 = t7 + t3;
+t2 = MEM_U32(a3 + 8);
+if ((int)a0 < (int)0x100) goto L41cb14;
+if ((int)t1 >= (int)0x100) {
+v0 = a0 + 0x2;
+goto L41cb18;}
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L41cb14:
+v0 = a0 + 0x2;
+L41cb18:
+MEM_U32(t4 + 4) = v0;
+a1 = t4 + a0;
+MEM_U32(a1 + 0) = a0;
+if ((int)t3 < (int)0x100) goto L41cc38;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L41cc38;
+MEM_U32(a3 + 8) = t5;
+goto L41cc38;
+L41cb48:
+a0 = a0 + a1;
+if ((int)a0 < (int)0x100) {
+at = (int)t1 < (int)0x100;
+goto L41cb78;}
+if ((int)t1 >= (int)0x100) {
+v1 = a0 + 0x2;
+goto L41cb7c;}
+t2 = MEM_U32(a3 + 8);
+t5 = MEM_U32(t2 + 8);
+MEM_U32(t4 + 12) = t2;
+MEM_U32(t4 + 8) = t5;
+MEM_U32(t5 + 12) = t4;
+MEM_U32(t2 + 8) = t4;
+L41cb78:
+v1 = a0 + 0x2;
+L41cb7c:
+MEM_U32(t4 + 4) = v1;
+t8 = t3 + 0x1;
+MEM_U32(t0 + 4) = t8;
+t0 = t4 + a0;
+MEM_U32(t0 + 0) = a0;
+goto L41cc38;
+L41cb94:
+t9 = t2 & 0x1;
+if (t9 != zero) {
+at = (int)a1 < (int)0x100;
+goto L41cbfc;}
+a1 = a1 + t3;
+t2 = MEM_U32(a3 + 8);
+if ((int)a1 < (int)0x100) goto L41cbc4;
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+L41cbc4:
+t4 = a2 + a1;
+MEM_U32(t4 + 0) = a1;
+t6 = a1 + 0x2;
+MEM_U32(a2 + 4) = t6;
+if ((int)t3 < (int)0x100) goto L41cc38;
+t5 = MEM_U32(t0 + 12);
+a0 = MEM_U32(t0 + 8);
+MEM_U32(a0 + 12) = t5;
+MEM_U32(t5 + 8) = a0;
+if (t2 != t0) goto L41cc38;
+MEM_U32(a3 + 8) = t5;
+goto L41cc38;
+// fdead 0 at = (int)a1 < (int)0x100;
+L41cbfc:
+if (at != zero) {
+t4 = t1;
+goto L41cc20;}
+t2 = MEM_U32(a3 + 8);
+t5 = MEM_U32(t2 + 8);
+MEM_U32(a2 + 12) = t2;
+MEM_U32(a2 + 8) = t5;
+MEM_U32(t5 + 12) = a2;
+MEM_U32(t2 + 8) = a2;
+t4 = t1;
+L41cc20:
+MEM_U32(t4 + 0) = a1;
+t7 = a1 + 0x2;
+MEM_U32(a2 + 4) = t7;
+v0 = t3 + 0x1;
+MEM_U32(t0 + 4) = v0;
+return;
+L41cc38:
+//nop;
+return;
+}
+
+static uint32_t f_xmalloc(uint8_t *mem, uint32_t sp, uint32_t a0) {
+uint32_t v0 = 0, a1 = 0;
+L41cc40:
+//xmalloc:
+a1 = 0x10015548;
+v0 = f_alloc_new(mem, sp, a0, a1);
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}
+
+static uint32_t f_alloc_new(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+uint32_t v0 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0;
+L41cc5c:
+//alloc_new:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd8;
+// fdead 400001eb MEM_U32(sp + 32) = ra;
+L41cc70:
+// fdead 400001eb MEM_U32(sp + 28) = gp;
+t0 = MEM_U32(a1 + 0);
+a0 = a0 + 0xf;
+t5 = 0xfffffff8;
+if (t0 == 0) goto L41cd8c;
+L41cc84:
+t1 = MEM_U32(t0 + 8);
+a0 = a0 & t5;
+t2 = MEM_U32(t1 + 4);
+//nop;
+if ((int)a0 >= (int)0x10) goto L41cca0;
+a0 = 0x10;
+L41cca0:
+if ((int)t2 >= (int)a0) {
+t2 = t2 & t5;
+goto L41cccc;}
+t2 = t2 & t5;
+t3 = t1;
+L41ccb0:
+t1 = MEM_U32(t1 + 12);
+//nop;
+t2 = MEM_U32(t1 + 4);
+t4 = (int)t2 < (int)a0;
+if (t1 == t3) goto L41cd48;
+if ((int)t2 < (int)a0) {
+t2 = t2 & t5;
+goto L41ccb0;}
+t2 = t2 & t5;
+L41cccc:
+t3 = t2 + 0xffffff00;
+if ((int)a0 >= (int)t3) {
+t3 = t1 + t2;
+goto L41cd10;}
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t3 + 0) = a0;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+t3 = t3 - a0;
+t4 = a0 | 0x1;
+MEM_U32(t3 + 4) = t4;
+t2 = t2 - a0;
+MEM_U32(t3 + 0) = t2;
+t2 = t2 | 0x2;
+MEM_U32(t1 + 4) = t2;
+v0 = t3 + 0x8;
+goto L41cdc0;
+L41cd10:
+t3 = MEM_U32(t1 + 8);
+t4 = MEM_U32(t1 + 12);
+t5 = MEM_U32(t1 + 4);
+MEM_U32(t3 + 12) = t4;
+MEM_U32(t4 + 8) = t3;
+MEM_U32(t0 + 8) = t3;
+t5 = t5 | 0x1;
+t3 = t1 + t2;
+t4 = MEM_U32(t3 + 4);
+MEM_U32(t1 + 4) = t5;
+t4 = t4 | 0x2;
+MEM_U32(t3 + 4) = t4;
+v0 = t1 + 0x8;
+goto L41cdc0;
+L41cd48:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 36) = t0;
+//nop;
+//nop;
+a0 = a0 + 0xfffffffc;
+v0 = f_alloc_next_scb(mem, sp, a0, a1);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+t0 = MEM_U32(sp + 36);
+a0 = MEM_U32(sp + 40);
+if (v0 == 0) goto L41cd84;
+t1 = MEM_U32(t0 + 8);
+t5 = 0xfffffff8;
+t2 = MEM_U32(t1 + 4);
+t2 = t2 & t5;
+goto L41cccc;
+L41cd84:
+//nop;
+goto L41cdc0;
+L41cd8c:
+MEM_U32(sp + 40) = a0;
+MEM_U32(sp + 44) = a1;
+//nop;
+//nop;
+a0 = a1;
+v0 = f_alloc_mark(mem, sp, a0);
+// bdead 40000009 gp = MEM_U32(sp + 28);
+a0 = MEM_U32(sp + 40);
+a1 = MEM_U32(sp + 44);
+t0 = MEM_U32(a1 + 0);
+if (v0 == 0) goto L41cd84;
+t5 = 0xfffffff8;
+goto L41cc84;
+L41cdc0:
+// bdead 9 ra = MEM_U32(sp + 32);
+// bdead 9 sp = sp + 0x28;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_page(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, t0 = 0, t1 = 0, t6 = 0, t7 = 0,
+t8 = 0, t9 = 0;
+L41cdd0:
+//alloc_page:
+//nop;
+//nop;
+//nop;
+a1 = 0x10013690;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+v0 = MEM_U32(a1 + 0);
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+//nop;
+if (v0 == 0) goto L41ce08;
+t6 = MEM_U32(v0 + 12);
+if ((int)t6 >= (int)a0) {
+t1 = MEM_U32(v0 + 4);
+goto L41ce70;}
+L41ce08:
+//nop;
+//nop;
+v0 = wrapper_sbrk(mem, a0);
+at = 0xffffffff;
+// bdead 4000000f gp = MEM_U32(sp + 24);
+v1 = v0;
+if (v0 != at) goto L41ce2c;
+v1 = zero;
+goto L41ce78;
+L41ce2c:
+a1 = 0xfffff000;
+t7 = v0 & a1;
+t8 = v1 + 0xfff;
+if (v0 == t7) goto L41ce78;
+t9 = t8 & a1;
+a0 = t9 - v1;
+//nop;
+MEM_U32(sp + 32) = a0;
+MEM_U32(sp + 40) = v1;
+//nop;
+v0 = wrapper_sbrk(mem, a0);
+v1 = MEM_U32(sp + 40);
+t0 = MEM_U32(sp + 32);
+// bdead 211 gp = MEM_U32(sp + 24);
+v1 = v1 + t0;
+goto L41ce78;
+// fdead 0 t1 = MEM_U32(v0 + 4);
+L41ce70:
+v1 = v0;
+MEM_U32(a1 + 0) = t1;
+L41ce78:
+// bdead 11 ra = MEM_U32(sp + 28);
+// bdead 11 sp = sp + 0x30;
+v0 = v1;
+//nop;
+return v0;
+}
+
+static void f_alloc_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t v0 = 0, v1 = 0, a2 = 0, t0 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41cec0:
+//alloc_scb:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffe0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 32) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = a1;
+MEM_U32(sp + 36) = a1;
+v0 = f_alloc_page(mem, sp, a0);
+t6 = MEM_U32(sp + 32);
+// bdead 4000800b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+MEM_U32(t6 + 0) = v0;
+if (v0 == 0) goto L41cf48;
+a0 = v0 + a2;
+a0 = a0 + 0xfffffff8;
+a1 = a0 - v0;
+t7 = -a2;
+t8 = a1 + 0xfffffff2;
+MEM_U32(v0 + 12) = t7;
+MEM_U32(v0 + 0) = zero;
+MEM_U32(v0 + 4) = zero;
+MEM_U32(v0 + 16) = zero;
+MEM_U32(v0 + 20) = t8;
+t9 = a1 + 0xfffffff0;
+t0 = 0x1;
+MEM_U32(a0 + 0) = t9;
+MEM_U32(a0 + 4) = t0;
+v1 = v0 + 0x10;
+MEM_U32(v0 + 24) = v1;
+MEM_U32(v0 + 28) = v1;
+MEM_U32(v0 + 8) = v1;
+L41cf48:
+// bdead 1 ra = MEM_U32(sp + 28);
+// bdead 1 sp = sp + 0x20;
+//nop;
+return;
+}
+
+static uint32_t f_alloc_mark(uint8_t *mem, uint32_t sp, uint32_t a0) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a1 = 0, a2 = 0, a3 = 0, t0 = 0, t1 = 0,
+t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0, t8 = 0, t9 = 0;
+L41cf58:
+//alloc_mark:
+//nop;
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+MEM_U32(sp + 64) = a0;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+a0 = sp + 0x34;
+a1 = 0x10000;
+f_alloc_scb(mem, sp, a0, a1);
+a0 = MEM_U32(sp + 52);
+// bdead 40000023 gp = MEM_U32(sp + 24);
+t1 = MEM_U32(sp + 64);
+if (a0 != zero) {
+v1 = MEM_U32(t1 + 0);
+goto L41cfa4;}
+v0 = zero;
+goto L41d04c;
+// fdead 0 v1 = MEM_U32(t1 + 0);
+L41cfa4:
+t6 = MEM_U32(sp + 52);
+t0 = t6;
+if (v1 == 0) goto L41cfd8;
+v0 = MEM_U32(v1 + 4);
+a0 = t6;
+if (v0 == zero) {
+MEM_U32(v1 + 4) = a0;
+goto L41cfd4;}
+v1 = v0;
+L41cfc4:
+v0 = MEM_U32(v0 + 4);
+if (v0 != zero) {
+v1 = v0;
+goto L41cfc4;}
+MEM_U32(v1 + 4) = a0;
+L41cfd4:
+MEM_U32(a0 + 0) = v1;
+L41cfd8:
+t7 = MEM_U32(sp + 52);
+MEM_U32(t1 + 0) = t7;
+t8 = MEM_U32(sp + 52);
+t9 = MEM_U32(t8 + 12);
+t2 = t9;
+if ((int)t9 >= 0) goto L41cff4;
+t2 = -t9;
+L41cff4:
+MEM_U32(t8 + 12) = t2;
+t3 = MEM_U32(sp + 52);
+at = 0xfffffffc;
+t6 = 0x2;
+v1 = MEM_U32(t3 + 8);
+v0 = t0;
+a3 = MEM_U32(v1 + 4);
+a0 = v1 + 0x10;
+MEM_U32(v1 + 12) = a0;
+a3 = a3 & at;
+a1 = v1 + a3;
+a2 = a1 - v1;
+t4 = a2 + 0xfffffff0;
+MEM_U32(v1 + 8) = a0;
+MEM_U32(v1 + 28) = v1;
+MEM_U32(v1 + 24) = v1;
+MEM_U32(a1 + 0) = t4;
+t7 = MEM_U32(sp + 52);
+t5 = a2 + 0xfffffff2;
+MEM_U32(v1 + 20) = t5;
+MEM_U32(v1 + 4) = t6;
+MEM_U32(t7 + 8) = a0;
+L41d04c:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x40;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_next_scb(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a2 = 0, t0 = 0, t1 = 0, t2 = 0, t3 = 0,
+t6 = 0, t8 = 0, t9 = 0;
+L41d124:
+//alloc_next_scb:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffc8;
+a2 = a0;
+at = 0x7fff0000;
+MEM_U32(sp + 60) = a1;
+at = at | 0xf000;
+t6 = a2 + 0x1017;
+a1 = t6 & at;
+at = 0x10000;
+at = (int)a1 < (int)at;
+// fdead 400081ef MEM_U32(sp + 28) = ra;
+// fdead 400081ef MEM_U32(sp + 24) = gp;
+a0 = sp + 0x2c;
+if (at == 0) goto L41d168;
+a1 = 0x10000;
+L41d168:
+//nop;
+//nop;
+f_alloc_scb(mem, sp, a0, a1);
+t8 = MEM_U32(sp + 44);
+// bdead 42000003 gp = MEM_U32(sp + 24);
+a1 = MEM_U32(sp + 60);
+if (t8 != zero) {
+v1 = MEM_U32(a1 + 0);
+goto L41d194;}
+v0 = zero;
+goto L41d1f8;
+// fdead 0 v1 = MEM_U32(a1 + 0);
+L41d194:
+t9 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 4);
+if (v0 == zero) {
+t0 = MEM_U32(sp + 44);
+goto L41d1b8;}
+v1 = v0;
+L41d1a8:
+v0 = MEM_U32(v0 + 4);
+if (v0 != zero) {
+v1 = v0;
+goto L41d1a8;}
+t0 = MEM_U32(sp + 44);
+L41d1b8:
+MEM_U32(v1 + 4) = t9;
+MEM_U32(t0 + 0) = v1;
+v1 = MEM_U32(a1 + 0);
+t1 = MEM_U32(sp + 44);
+v0 = MEM_U32(v1 + 8);
+a0 = MEM_U32(t1 + 8);
+if (v0 == zero) {
+MEM_U32(v1 + 8) = a0;
+goto L41d1f4;}
+t2 = MEM_U32(v0 + 8);
+MEM_U32(a0 + 12) = v0;
+MEM_U32(a0 + 8) = t2;
+t3 = MEM_U32(v0 + 8);
+MEM_U32(t3 + 12) = a0;
+MEM_U32(v0 + 8) = a0;
+MEM_U32(v1 + 8) = a0;
+L41d1f4:
+v0 = 0x1;
+L41d1f8:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 sp = sp + 0x38;
+//nop;
+return v0;
+}
+
+static uint32_t f_alloc_resize(uint8_t *mem, uint32_t sp, uint32_t a0, uint32_t a1, uint32_t a2) {
+const uint32_t zero = 0;
+uint32_t at = 0, v0 = 0, v1 = 0, a3 = 0, t6 = 0, t7 = 0, s0 = 0, t8 = 0,
+t9 = 0;
+L41d208:
+//alloc_resize:
+//nop;
+//nop;
+//nop;
+sp = sp + 0xffffffd0;
+// fdead 400001eb MEM_U32(sp + 28) = ra;
+// fdead 400001eb MEM_U32(sp + 24) = gp;
+// fdead 400001eb MEM_U32(sp + 20) = s0;
+MEM_U32(sp + 52) = a1;
+MEM_U32(sp + 56) = a2;
+a3 = a0;
+if (a0 == 0) goto L41d2e0;
+t6 = MEM_U32(a0 + -4);
+s0 = a0 + 0xfffffff8;
+t8 = MEM_U32(sp + 52);
+t7 = t6 & 0x1;
+if (t7 != zero) {
+a2 = MEM_U32(s0 + 4);
+goto L41d258;}
+v0 = zero;
+goto L41d300;
+// fdead 0 a2 = MEM_U32(s0 + 4);
+L41d258:
+at = 0xfffffffc;
+t9 = t8 + 0x4;
+a2 = a2 & at;
+a0 = MEM_U32(sp + 52);
+if ((int)a2 < (int)t9) goto L41d278;
+v0 = a3;
+goto L41d300;
+L41d278:
+//nop;
+a1 = MEM_U32(sp + 56);
+MEM_U32(sp + 36) = a2;
+MEM_U32(sp + 48) = a3;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 4000000b gp = MEM_U32(sp + 24);
+a2 = MEM_U32(sp + 36);
+a3 = MEM_U32(sp + 48);
+s0 = v0;
+if (v0 != 0) goto L41d2a8;
+v0 = zero;
+goto L41d300;
+L41d2a8:
+//nop;
+a0 = s0;
+a1 = a3;
+MEM_U32(sp + 48) = a3;
+v0 = wrapper_memcpy(mem, a0, a1, a2);
+// bdead 40020001 gp = MEM_U32(sp + 24);
+a0 = MEM_U32(sp + 48);
+a1 = MEM_U32(sp + 56);
+//nop;
+//nop;
+f_alloc_dispose(mem, sp, a0, a1);
+// bdead 20001 gp = MEM_U32(sp + 24);
+v1 = s0;
+goto L41d2fc;
+L41d2e0:
+//nop;
+a0 = MEM_U32(sp + 52);
+a1 = MEM_U32(sp + 56);
+//nop;
+v0 = f_alloc_new(mem, sp, a0, a1);
+// bdead 9 gp = MEM_U32(sp + 24);
+v1 = v0;
+L41d2fc:
+v0 = v1;
+L41d300:
+// bdead 9 ra = MEM_U32(sp + 28);
+// bdead 9 s0 = MEM_U32(sp + 20);
+// bdead 9 sp = sp + 0x30;
+//nop;
+return v0;
+//nop;
+//nop;
+//nop;
+}